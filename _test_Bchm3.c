@@ -0,0 +1,8177 @@
+/* generated with rurban/nbperf 08a5797 -b _words */
+/* seed[0]: 294702567, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+const char * const hash_keys[20000] = {
+	"aa", "aaamvo", "aaaoepsaxqker", "aaawkatdsy",	/* 4 */
+	"aaazaiwmzo", "aabozllo", "aacwukjxnef", "aafjjxv",	/* 8 */
+	"aafkxt", "aafyjfdobuf", "aagbaqo", "aagwgqbdhc",	/* 12 */
+	"aahpgumys", "aahqwu", "aajoixnfterwky", "aakgie",	/* 16 */
+	"aalazfxybys", "aalqbxuarll", "aamevrbsmiecou", "aanimh",	/* 20 */
+	"aarfotdcsb", "aau", "aauljgrerearvd", "aaupkdl",	/* 24 */
+	"aavgjlqyprl", "aawplxnsl", "aaxw", "ab",	/* 28 */
+	"aba", "abb", "abcroqn", "abcyoudhuyoxv",	/* 32 */
+	"abded", "abdpauwxnyjjw", "abdvzz", "abemcsgtsaqf",	/* 36 */
+	"abgcyzzmsfaohz", "abgfzpabokt", "abghylkt", "abmtelekzgph",	/* 40 */
+	"abnnfppd", "abnznvhmvnpdsm", "abqg", "abrbqe",	/* 44 */
+	"abri", "abrsthrindrt", "abrvngkjcvst", "abttuirixp",	/* 48 */
+	"abucje", "abvlrapgztar", "abxrbvbhskm", "abzjq",	/* 52 */
+	"ac", "aca", "acat", "accdawrk",	/* 56 */
+	"acdumcj", "acfctctvvuqq", "acgeshhyiqp", "acgq",	/* 60 */
+	"acgsyaenn", "achaergtd", "acjqckgbahcww", "acklttjonmfsqw",	/* 64 */
+	"ackosnzmlndp", "aclya", "acndzbghzsnf", "acnjhah",	/* 68 */
+	"acq", "acqg", "acqzgdmgrudfev", "acrupnq",	/* 72 */
+	"actluu", "actnmsaqlxj", "acurtnbcgiuxz", "acvikspj",	/* 76 */
+	"acwmemtmnml", "acwuopbsjrdasc", "acyvmwnl", "ad",	/* 80 */
+	"adbb", "adcncxngm", "adcxr", "adfwg",	/* 84 */
+	"adgcouasqg", "adgnv", "adgorwmlnymtjv", "adgxbuovjvzrjs",	/* 88 */
+	"adhh", "adjgncgej", "adjzjjfcahdzbu", "adkrmjcofnbo",	/* 92 */
+	"adkvocwahadyny", "adnldbde", "adoalbcaylnjdp", "adoinuly",	/* 96 */
+	"adowolj", "adptyuhmk", "adsetbfuyqmlq", "adsyjfsp",	/* 100 */
+	"adu", "aduidlcplhjlw", "advxvdrmq", "advzb",	/* 104 */
+	"adwf", "adwfkizxbp", "adzplry", "adzrfo",	/* 108 */
+	"aeabb", "aeahcthpdbaspv", "aeahwehgc", "aebqchhcmwqshj",	/* 112 */
+	"aec", "aecdpkro", "aeckwcuomuwt", "aedk",	/* 116 */
+	"aedygfpc", "aeejqumjzwwp", "aegnwaegqii", "aegttb",	/* 120 */
+	"aegxoejdtmmrv", "aejhlhfpfwbweh", "aejijtnvnjlf", "aejzdahwbtl",	/* 124 */
+	"aeku", "aeooeu", "aepqhpwunt", "aernwcvnqoqe",	/* 128 */
+	"aerwh", "aesv", "aet", "aetazxsti",	/* 132 */
+	"aeuemhbrat", "aewcxnpkqffcsc", "aeyida", "aezbgcagmrrp",	/* 136 */
+	"af", "afa", "afabswrbr", "afapfsisywdfnf",	/* 140 */
+	"afcapeu", "afdajpdgtnfvw", "afdakepdzxw", "afddxironm",	/* 144 */
+	"affqgbqdmbu", "afftzswhrkc", "afkomgzyzuuwi", "afli",	/* 148 */
+	"afmnbtd", "afngooxtxdncoa", "afnnyjqxaxrb", "afnup",	/* 152 */
+	"afoeyyvxslene", "afovbwhaw", "afp", "afpbwckga",	/* 156 */
+	"afpnnyablos", "afqo", "afrhifomx", "afryjz",	/* 160 */
+	"afu", "afuza", "afwmxu", "afyiwr",	/* 164 */
+	"afypvnadao", "afystviiojvx", "afzaozrqjxnd", "agagun",	/* 168 */
+	"agb", "agbbgucvne", "agbeeflmdidbw", "agbsnfsithwad",	/* 172 */
+	"agbv", "agc", "agcsd", "agdehlqiefh",	/* 176 */
+	"agdpcsrr", "ageqe", "aggii", "agillaghnklvt",	/* 180 */
+	"agimtxt", "agl", "aglwcuiueqio", "agmgy",	/* 184 */
+	"agnqlevdskdkq", "ago", "agplhuovfvrna", "agqmjnishvnq",	/* 188 */
+	"agqynkpfvjit", "agsjix", "agtmromi", "agtybphmu",	/* 192 */
+	"aguaogtcduseei", "aguic", "aguytjckmbl", "agvqdjegqjuqsr",	/* 196 */
+	"agwprdfxkote", "agybygrpdnd", "ah", "ahbhifaktmf",	/* 200 */
+	"ahcct", "ahcsdwuzxmetm", "ahduwpxnwat", "ahefdmovzsj",	/* 204 */
+	"aheoqxi", "ahewgvpsiufqx", "ahf", "ahfqkurbpmnkzk",	/* 208 */
+	"ahhryg", "ahhsabofye", "ahhtnic", "ahlgnmozmmnkn",	/* 212 */
+	"ahlykcsbfezz", "ahmadaj", "ahor", "ahpib",	/* 216 */
+	"ahrkhwhlmdzr", "ahrycyyg", "ahs", "ahtjsnkbpuhw",	/* 220 */
+	"ahvmo", "ahwbwarqo", "ahylzbulai", "ahzhm",	/* 224 */
+	"ahzvwxaxic", "ai", "aiabbdwlhf", "aialwmtykvoz",	/* 228 */
+	"aiamjyqonb", "aicawrwtslqawy", "aig", "aihaiukqsvfylo",	/* 232 */
+	"aihejtm", "aihs", "aij", "aijbmhwsoasy",	/* 236 */
+	"aijebj", "aijjdynfcxgv", "aijsj", "aijxwzfpmr",	/* 240 */
+	"aikdmo", "ailhkdpxhle", "aingte", "aintnw",	/* 244 */
+	"air", "airrvbjwdb", "aitazbtn", "aiuvbj",	/* 248 */
+	"aivfpzdv", "aivraamggx", "aivrmjybsv", "aiwco",	/* 252 */
+	"aiwtcn", "aixlmqiyyutkb", "aiyzuochuktjgr", "aiz",	/* 256 */
+	"aizx", "aj", "ajcebz", "ajexeuma",	/* 260 */
+	"ajfujbdn", "ajirnfcltff", "ajj", "ajlw",	/* 264 */
+	"ajni", "ajogop", "ajpeg", "ajpkohinytla",	/* 268 */
+	"ajpnyfjl", "ajufbpaxc", "ajukmqlxl", "ajusjcrruqqrss",	/* 272 */
+	"ajvn", "ajwnad", "ajxfglmqkd", "ajxxmhjpbst",	/* 276 */
+	"ajy", "ajykjjue", "ajzkohlbnpfn", "ak",	/* 280 */
+	"akbzrbdp", "akcxbwl", "akd", "akdlazy",	/* 284 */
+	"akdwgr", "akdxmrlmj", "akefpqxsrzirma", "akfzpgvbi",	/* 288 */
+	"akgezjlnha", "akhowmxjnmg", "akjqay", "akkadpkznbkjrm",	/* 292 */
+	"aklkzzrtgi", "aklqzw", "aklyfeuf", "akmpovgxd",	/* 296 */
+	"akowhnzwlmbv", "akpca", "akpgjhg", "akpwxtipo",	/* 300 */
+	"akqwfhfoctaka", "akrjrqaqqwqed", "akroj", "akrupa",	/* 304 */
+	"akssyan", "aktpm", "akufanjkxmoxet", "akyaeacuxejm",	/* 308 */
+	"akywfelhvsbwzx", "akzcid", "akztebpoapmapf", "al",	/* 312 */
+	"aleejapuapcyzs", "alfzrlptvhdikn", "algykc", "alh",	/* 316 */
+	"alhwkvvhxdwq", "alipupnolwtat", "alirx", "aliu",	/* 320 */
+	"alkndu", "alllruhtbki", "alnncrnou", "alpgzprsmya",	/* 324 */
+	"alqlsmfpewpo", "alrokxhurell", "alrpbhdkfvd", "als",	/* 328 */
+	"aluqswv", "alv", "alwbqvrib", "alwodnzveidli",	/* 332 */
+	"alybopztfvkmwl", "am", "amafiexdione", "amagl",	/* 336 */
+	"amdtrjkowurky", "amdxqzu", "amepbcmqers", "amgl",	/* 340 */
+	"amglwwmvafic", "amhocvas", "amianjuvwy", "amiwnd",	/* 344 */
+	"amjfbefm", "amjr", "amjyxnjsu", "amk",	/* 348 */
+	"aml", "amlajk", "amlkgaoelk", "amnd",	/* 352 */
+	"amp", "amqumqgepywx", "amtespnycxhrna", "amua",	/* 356 */
+	"amuaclj", "amvjbh", "amvuhhqkzczohh", "amw",	/* 360 */
+	"amxjh", "amxqtdhni", "amyg", "amyic",	/* 364 */
+	"amypheipnls", "an", "anai", "anbvfjavrwpyin",	/* 368 */
+	"anemeaieosxx", "anff", "angdqpdmft", "anguwxzlilk",	/* 372 */
+	"aninljfxl", "anlfb", "anlvcbtkbgqhf", "anptornqlqtpis",	/* 376 */
+	"anpzxxcntx", "anqeya", "anqgigorvtg", "anqw",	/* 380 */
+	"anrkwivghygoiv", "ans", "ant", "anuuwxgudkzdw",	/* 384 */
+	"anwklkxyn", "anxwedh", "anzigluouypzo", "anzrgxko",	/* 388 */
+	"ao", "aoaqfafxmywmkf", "aob", "aobm",	/* 392 */
+	"aocbjq", "aocgprkwsyelk", "aofdiebh", "aofeeilsphqi",	/* 396 */
+	"aogr", "aohfxjunb", "aohshtvbl", "aoipkjqnskqxv",	/* 400 */
+	"aojp", "aojpzddjar", "aokjjy", "aokszgzzmb",	/* 404 */
+	"aolgzpjcanya", "aolismvrqhw", "aoluupkbomvtw", "aongrogeaitfe",	/* 408 */
+	"aonm", "aoobzdhtvvwy", "aooidxlqowtb", "aopphpcemi",	/* 412 */
+	"aoqclsk", "aoqvpwifudrraw", "aordmjaccjfra", "aoreagatoud",	/* 416 */
+	"aovjcrmiu", "aovk", "aovoufl", "aovvtczrc",	/* 420 */
+	"aovxq", "aox", "aoxkxeye", "aoxxzsgg",	/* 424 */
+	"aoyla", "aoymp", "aoz", "aozchu",	/* 428 */
+	"ap", "apdbribsdymcir", "apdq", "apdumidzy",	/* 432 */
+	"apfpjgsiztsi", "apght", "apijmcafchdgjq", "apjqh",	/* 436 */
+	"apmb", "apnbsvx", "apnsa", "apnxqbhntoevwz",	/* 440 */
+	"apoagwnopnc", "apoksoahdk", "apoxufrps", "appxvypap",	/* 444 */
+	"aprkejwd", "aprrxamsubs", "apszjdhexvgrhi", "aptmbojveltgbm",	/* 448 */
+	"aptnbhdxmvrqas", "apuw", "apv", "apvecnkopt",	/* 452 */
+	"apwilmyz", "apxvrkgnsi", "apyotdpei", "apzvkshb",	/* 456 */
+	"aq", "aqaeyen", "aqaxxjbxfl", "aqbacwwhqor",	/* 460 */
+	"aqbj", "aqdayjchue", "aqdekxkzks", "aqdhf",	/* 464 */
+	"aqfhlnmxzcdi", "aqftiwbsvmutcd", "aqfuykqjfa", "aqg",	/* 468 */
+	"aqgqyaujeajf", "aqiy", "aqjlr", "aqjra",	/* 472 */
+	"aqkr", "aql", "aqlduhjid", "aqlhyotznj",	/* 476 */
+	"aqlxubdylgq", "aqm", "aqnwqkbt", "aqozrrayhcz",	/* 480 */
+	"aqspytz", "aqt", "aqtkglsvjlwg", "aqvpvvskgmdzda",	/* 484 */
+	"aqxydxmjjdl", "aqynpq", "aqyom", "aqz",	/* 488 */
+	"aqzfqhxs", "aqzite", "ar", "ara",	/* 492 */
+	"arcpe", "arcuckn", "ardxeq", "ardzqqnzee",	/* 496 */
+	"are", "arghlqfwhnodip", "arhpfrahecaek", "aribks",	/* 500 */
+	"arict", "arikk", "arivnzklsg", "arjvyxuecqlsz",	/* 504 */
+	"ark", "arkhlu", "arlxkk", "armorcdpej",	/* 508 */
+	"armqdlybyplyn", "arms", "arnrjwcdzkwzqo", "arnzzukeimkcc",	/* 512 */
+	"arohoeaiy", "arqeqfnk", "arrbknk", "arrdni",	/* 516 */
+	"arrtztk", "aru", "arucxbw", "arxcppjvzzmw",	/* 520 */
+	"aryswrjcv", "arzbdrgcmfau", "arzhnfvf", "arzuljwsk",	/* 524 */
+	"asalrmfafppxfd", "asbeorwhpaatq", "ascmpo", "asdgbs",	/* 528 */
+	"asfxudbxe", "asgecyh", "asglzmhxtvfdk", "asgshnvjawpg",	/* 532 */
+	"ashlpq", "ashulbmpklnf", "asiozyxlcb", "asiq",	/* 536 */
+	"asitgqqvz", "asizstlxnmldg", "asjizgsn", "aslx",	/* 540 */
+	"asnhn", "asnjeueyiibnr", "aso", "asp",	/* 544 */
+	"asr", "asroqqyd", "assdbsqadkklyr", "asss",	/* 548 */
+	"assujmboblyla", "assvf", "asukvsmwgtztm", "asun",	/* 552 */
+	"asupfarknyyqhu", "asxbiaro", "asxtnyw", "aszjj",	/* 556 */
+	"aszqjyz", "at", "atasxvjfdd", "atbgsbxekj",	/* 560 */
+	"atdxmowgxodbg", "atg", "atgflcfwh", "atghmtgzeb",	/* 564 */
+	"atgs", "ath", "atij", "atkramwifnwq",	/* 568 */
+	"atkwncxsx", "atlzvm", "atmuiszpjkp", "ato",	/* 572 */
+	"atrb", "attdvy", "attt", "atuavewemtrsm",	/* 576 */
+	"atumme", "atur", "atvaeladu", "atvruu",	/* 580 */
+	"atwxgh", "atzyt", "au", "auarghyogn",	/* 584 */
+	"auby", "aucfoymvqzjeeq", "auehjyeax", "auemxrdoay",	/* 588 */
+	"auepbxwj", "aufjgmihgiwou", "augdbjermtl", "augkpkwxbi",	/* 592 */
+	"augpp", "augqmrgdnuuq", "augyhqves", "augyyboevwfgt",	/* 596 */
+	"auhr", "aujwepnim", "aulld", "aumywooz",	/* 600 */
+	"auomaojqsownim", "auoypcs", "auqrwvdyryab", "aurghovsqy",	/* 604 */
+	"aurwo", "ausybq", "autcnzpgn", "autoht",	/* 608 */
+	"auvbuykmd", "auvnrkb", "auvwrpfygwjgen", "auyxu",	/* 612 */
+	"av", "avap", "avbcyego", "avc",	/* 616 */
+	"avcmlnhmcmvwph", "avctrko", "avejfof", "avelskvcusw",	/* 620 */
+	"avfgogievupuf", "avhd", "avhks", "avhnhwgots",	/* 624 */
+	"avhrnkcn", "aviqn", "avknwpc", "avlbkhyycggr",	/* 628 */
+	"avlez", "avlijhsccnty", "avoewxrvewnk", "avpxgzavyb",	/* 632 */
+	"avrtcuwxd", "avsmcb", "avsnfa", "avsoi",	/* 636 */
+	"avstzwuxnyukeb", "avucflgumvboz", "avvm", "avvrcjnpw",	/* 640 */
+	"avytejzij", "avz", "aw", "awadf",	/* 644 */
+	"awaenhasdvibam", "awbxrtjoa", "awckekjgfbhfoz", "awdwwfpce",	/* 648 */
+	"awelebpxvyz", "awfzwgoeyh", "awktgwbrh", "awmr",	/* 652 */
+	"awpceoqjuewew", "awq", "awrlebnfhidt", "awrpp",	/* 656 */
+	"awwaipm", "awwbunk", "awwdaxmozk", "awwvjop",	/* 660 */
+	"awxjflfkvzcf", "awyyehm", "awzpvraboqxrh", "ax",	/* 664 */
+	"axbub", "axcus", "axfpbzmiscjwe", "axgvfbwvwn",	/* 668 */
+	"axifhymfsrre", "axirzlmia", "axjovnoynhxcgp", "axjqcyho",	/* 672 */
+	"axkyzbvmj", "axmatqc", "axpaljfblns", "axpjimge",	/* 676 */
+	"axqclcoujeu", "axqfflmwagnb", "axvbmjcmu", "axxhcrfysw",	/* 680 */
+	"axxwaq", "axzhnlgyw", "axznsdejodm", "ay",	/* 684 */
+	"ayaguqcyf", "ayardvhgchqlwt", "aybkz", "aybsbwif",	/* 688 */
+	"aycixdathok", "ayd", "aydt", "aydvrvlia",	/* 692 */
+	"aye", "ayfle", "ayfpvmjju", "ayfyqo",	/* 696 */
+	"aygjtv", "aygl", "aygse", "aygvbpwqxto",	/* 700 */
+	"ayk", "ayndurltg", "ayqroi", "ayrtxzkgx",	/* 704 */
+	"ayurhakpbgm", "ayv", "ayvhf", "ayvidfhrm",	/* 708 */
+	"ayvs", "ayvz", "ayxdzd", "ayxkgs",	/* 712 */
+	"ayy", "az", "azaeznmkwi", "azbibra",	/* 716 */
+	"azdcmxfes", "azdkvwfwudtabt", "azdrbjhmwqmlxq", "azeu",	/* 720 */
+	"azgiwdgycss", "azhq", "azhxsnqtjp", "azkewersoh",	/* 724 */
+	"azkgkokspcsxyy", "azlldh", "azmbiqx", "aznft",	/* 728 */
+	"azojzmhmvgw", "azqzqvhelmnekn", "azsjaleohobshu", "azunqkleaevv",	/* 732 */
+	"azuvj", "azuvtvfjghuvki", "azvkpvmmqv", "azzcerqz",	/* 736 */
+	"azzeqljhdz", "ba", "baazajzi", "babof",	/* 740 */
+	"badoc", "badrq", "baeaifbpywwns", "baediyfxp",	/* 744 */
+	"baefi", "baeq", "bagqafqf", "bagufnamedqhln",	/* 748 */
+	"bahpxm", "bahqzidllfa", "bahvobkwdidd", "baicsilotqif",	/* 752 */
+	"baixrb", "bajgfdbgxfkrlv", "bakpwahrebmdh", "bakvd",	/* 756 */
+	"bakxb", "balrxviengxws", "bammvjyqvjhx", "bamudyxdpugduv",	/* 760 */
+	"banv", "baotq", "bappr", "bav",	/* 764 */
+	"bawvglqhodxlv", "bawzbmwv", "baxmmnvestev", "baymotz",	/* 768 */
+	"baziywgorpwxn", "bb", "bbaibijfrptw", "bbaqrzywu",	/* 772 */
+	"bbayrlie", "bbbzxvaokcjjn", "bbdkzao", "bbdtbwrrzyp",	/* 776 */
+	"bbetmejicwr", "bbglsgkhhpjgy", "bbh", "bbjmzj",	/* 780 */
+	"bbrciffax", "bbtbfnuuhcind", "bbtjg", "bbtrkn",	/* 784 */
+	"bbuwoojy", "bbvatgkvdogzxw", "bbvkeedqgsf", "bbwoeopqygz",	/* 788 */
+	"bbww", "bbxgulxlql", "bbxy", "bbynjbzndb",	/* 792 */
+	"bbytzrg", "bc", "bca", "bcbogjbvqrza",	/* 796 */
+	"bcbue", "bccuohhjalg", "bcemhv", "bcf",	/* 800 */
+	"bcfqaunfrb", "bcfxvjqoqaccu", "bcgejmayphgj", "bcgfmuo",	/* 804 */
+	"bckeht", "bckldqjbp", "bclavkpvnjmu", "bcleg",	/* 808 */
+	"bclpx", "bcmtpljsczw", "bcnkqlrhjq", "bcnqq",	/* 812 */
+	"bcnzjtwyiyy", "bcosnlgqblp", "bcpkhby", "bcpkng",	/* 816 */
+	"bcqvvjzlegnf", "bcr", "bcrzqzn", "bcsm",	/* 820 */
+	"bcsykbyrcb", "bctpqwmsnvh", "bcuh", "bcvljjb",	/* 824 */
+	"bcvqnowfeg", "bcxd", "bczt", "bd",	/* 828 */
+	"bdacsmnculmcq", "bdcprnlpdkrvl", "bdfnevzpq", "bdhccb",	/* 832 */
+	"bdjilotpkildck", "bdkndvylxuxo", "bdl", "bdlyrtxes",	/* 836 */
+	"bdmfyqwxuf", "bdnbkoe", "bdnejntcdrqve", "bdnufpoxdxux",	/* 840 */
+	"bdpnc", "bdpybuwwa", "bdrapgoaq", "bdrkkeq",	/* 844 */
+	"bdrrborticaxib", "bdseqqylrizsul", "bdtqq", "bdudzrtalhwcap",	/* 848 */
+	"bdui", "bdvuvhboykx", "bdw", "bdycki",	/* 852 */
+	"bdyzmnp", "be", "beagrthtp", "becmmblivgijmo",	/* 856 */
+	"bedwfiaesztb", "beedabmibnzzb", "behahrymnzmlgc", "beilkaiubdvku",	/* 860 */
+	"beivnwe", "bekxbx", "belpl", "belw",	/* 864 */
+	"bemcinpjdq", "beolqvpzfxf", "beoxxqgo", "bepewpnpjatiru",	/* 868 */
+	"bepiorywl", "bepmsur", "beqzxtqbfdr", "berwgeebepz",	/* 872 */
+	"besmlmrphhawpr", "bevbeeofe", "bevz", "bewamoowipmcb",	/* 876 */
+	"bewwuq", "bexgr", "beyxvt", "bezoe",	/* 880 */
+	"bf", "bfasppnandsz", "bfcfvan", "bfdixpxt",	/* 884 */
+	"bfex", "bfezpbufygz", "bff", "bffuecdod",	/* 888 */
+	"bfgndmggnr", "bfgwpr", "bfirbahyc", "bfkjw",	/* 892 */
+	"bfleejld", "bfmoevqtgxr", "bfnotan", "bfocrratxrcfqm",	/* 896 */
+	"bfor", "bfqdcut", "bfqgtpjkndqch", "bfqhuvfmvzyji",	/* 900 */
+	"bfry", "bfud", "bfudo", "bfuelxdm",	/* 904 */
+	"bfulzk", "bfvkfarob", "bfvqoc", "bfx",	/* 908 */
+	"bfxojuzxhqu", "bfyavwepuqps", "bfyeovbyiuw", "bfzsfvxobwhfok",	/* 912 */
+	"bg", "bgaj", "bgakdggioxxtsd", "bganhvs",	/* 916 */
+	"bgaxooeiqvbmtz", "bgc", "bgckovjdh", "bgdfc",	/* 920 */
+	"bgdrlzv", "bgh", "bgiuabechv", "bgjingfapqbe",	/* 924 */
+	"bgld", "bgmlldvucq", "bgn", "bgnhp",	/* 928 */
+	"bgnkeruy", "bgonv", "bgqigoxdfl", "bgqkccdufr",	/* 932 */
+	"bgsdzqeklmuyn", "bgtfqtqzskrp", "bgu", "bgvwfdzhllnt",	/* 936 */
+	"bgwpygmkjptqi", "bgwzmhj", "bgyojmkonvnszc", "bgzyhxcsvstjpq",	/* 940 */
+	"bgzzd", "bh", "bhbidhdvx", "bhcklnltpaetl",	/* 944 */
+	"bhcqzspz", "bhdrcxio", "bhezkqganmkla", "bhftwm",	/* 948 */
+	"bhfukaju", "bhha", "bhjnmrmwuufq", "bhkdpkcplsk",	/* 952 */
+	"bhkmw", "bhmsap", "bhqjgtptbak", "bhrcwalapbux",	/* 956 */
+	"bhsfq", "bhswgx", "bhw", "bhwbjuoghpyphf",	/* 960 */
+	"bhwdvywdg", "bhwtetktboou", "bhyvanlexudizp", "bhyzesomeviv",	/* 964 */
+	"bi", "biamytpegbp", "bic", "bidznmilgb",	/* 968 */
+	"bigmtmnhlhcadk", "bikawv", "bimnkx", "bink",	/* 972 */
+	"biopdqt", "bip", "biph", "biqakmpoxsdtg",	/* 976 */
+	"biqgcz", "biqnbx", "birtinutrik", "bisahszesqkyfq",	/* 980 */
+	"biszstem", "bitbidpy", "biteikqwq", "bivh",	/* 984 */
+	"bivy", "biycafsmilc", "biygzzsmxiy", "biziirfyc",	/* 988 */
+	"bizj", "bizk", "bj", "bja",	/* 992 */
+	"bjbfr", "bjbiknmw", "bjceinmzedt", "bjcopoptplk",	/* 996 */
+	"bjd", "bjdiiqxrit", "bjeapaqyqb", "bjehuqnch",	/* 1000 */
+	"bjemyledserxxr", "bjhee", "bjhzcbtyddg", "bjibzwckdwu",	/* 1004 */
+	"bjidvw", "bjikqaerbgk", "bjjgfr", "bjjljfls",	/* 1008 */
+	"bjjnikgfcr", "bjkcpopbl", "bjkwytxbasocj", "bjlqgblbuvrr",	/* 1012 */
+	"bjlwqalwvlt", "bjlyvawtoksa", "bjmneuu", "bjmvo",	/* 1016 */
+	"bjnnv", "bjnsyaohwlw", "bjouwlztv", "bjpcl",	/* 1020 */
+	"bjpsj", "bjrpgwvmogoweb", "bjui", "bjupfsqvk",	/* 1024 */
+	"bjuvzhxdtnti", "bjvw", "bjwemmoe", "bjyblgkf",	/* 1028 */
+	"bjydptvnpmixkc", "bjztpomavlhpef", "bk", "bka",	/* 1032 */
+	"bkatjqwtsyubi", "bkbmmvkjqdzzp", "bkbqhnrjrf", "bkbymfdxh",	/* 1036 */
+	"bkcaozeooam", "bkcfh", "bkdjw", "bkfkbgzynp",	/* 1040 */
+	"bkfruuncovceme", "bkfrzgevc", "bkgy", "bkhbkldlaxnb",	/* 1044 */
+	"bkhbwawf", "bkhgsxoqh", "bkhploh", "bkhywfm",	/* 1048 */
+	"bkldofml", "bklqhjnblz", "bkmvcczanfo", "bknymoxhz",	/* 1052 */
+	"bko", "bkptozixprdqzv", "bksidfnqja", "bkt",	/* 1056 */
+	"bkttq", "bkvrwp", "bkvuqethv", "bkxbatuw",	/* 1060 */
+	"bkxzvsodhvhrpj", "bkyqw", "bkzcu", "bl",	/* 1064 */
+	"blacbniwpbec", "blathzohqkfnw", "blaxvvpocbww", "bldciboswxjez",	/* 1068 */
+	"bldmewvggqa", "bldqgafcg", "ble", "blfgcchmrbp",	/* 1072 */
+	"blfiutoezbuyon", "blhykgcjcfhj", "blijgbdkycir", "bljhuqjysfsjcy",	/* 1076 */
+	"blkaifdchb", "blkcnjswgc", "blkrddguar", "bllcswqruiw",	/* 1080 */
+	"blmxe", "blqzpgwnocn", "blrjnjnq", "blstd",	/* 1084 */
+	"blsz", "bltg", "blvjeisyf", "blx",	/* 1088 */
+	"blxd", "blydkbgx", "blywjk", "blz",	/* 1092 */
+	"blzgxrxchhoxy", "bmbbgumfhg", "bmbc", "bmbe",	/* 1096 */
+	"bmbsrkhll", "bmc", "bmcfywrj", "bmdtcrb",	/* 1100 */
+	"bmecwmmjs", "bmfvcfpke", "bmfvr", "bmgtfsuj",	/* 1104 */
+	"bmgxrjbk", "bmmdpbguuf", "bmmnkdgkem", "bmnjbn",	/* 1108 */
+	"bmnrvkp", "bmob", "bmpgfq", "bmqve",	/* 1112 */
+	"bmrinfm", "bmrkx", "bmstcbgj", "bmtcr",	/* 1116 */
+	"bmthbgy", "bmu", "bmucfzasp", "bmulp",	/* 1120 */
+	"bmwrfvqhqbfbal", "bmwtqi", "bmxaovs", "bmydpgfvtglwhl",	/* 1124 */
+	"bmyr", "bn", "bnbmofy", "bnbq",	/* 1128 */
+	"bncgas", "bncmzee", "bncvygl", "bndesm",	/* 1132 */
+	"bneoivryzmuppu", "bnidrmlvlos", "bniltwvov", "bnim",	/* 1136 */
+	"bniuiqrby", "bnjvveidsdmjd", "bnleecgutmj", "bnnyruuzyi",	/* 1140 */
+	"bnoudfoprj", "bnp", "bnppnvvkd", "bnprhihfej",	/* 1144 */
+	"bnprkgaeppi", "bnrv", "bntiwyeuqpri", "bntqm",	/* 1148 */
+	"bnuxju", "bnv", "bnvjukcxbhlp", "bnvooodksq",	/* 1152 */
+	"bnwmpyx", "bnwtdvtvc", "bnx", "bnxilwdggxxbn",	/* 1156 */
+	"bnxneruekx", "bnyaahtxwg", "bnybhazdp", "bnzdtu",	/* 1160 */
+	"bnzeafz", "bnzqfijlcvpenf", "bnzvqw", "bo",	/* 1164 */
+	"boalqokzfwvg", "bobhdqi", "bocymygfiudf", "bodaunvxsvxoo",	/* 1168 */
+	"bodpdbgihpbl", "bodrrxxlzglhc", "boedwt", "boeouhid",	/* 1172 */
+	"bofzyeqk", "boge", "boirp", "bondl",	/* 1176 */
+	"bop", "bopbayniqmdv", "boppn", "bopriurkxmpuqs",	/* 1180 */
+	"boqylknm", "borpgugei", "borrfniyw", "bort",	/* 1184 */
+	"boswkzi", "bouilvxgcj", "bovyhbyzoq", "bowlrctnvq",	/* 1188 */
+	"bowoaswn", "boxg", "bozvgokcfw", "bp",	/* 1192 */
+	"bpayshhqry", "bpbklkxzuhibbe", "bpbvmdp", "bpbzactoazuhe",	/* 1196 */
+	"bpczgeqm", "bpekn", "bpetdxjzskgczu", "bpgcvzoed",	/* 1200 */
+	"bphlu", "bphmydk", "bphuahvytcqi", "bpjl",	/* 1204 */
+	"bpjypmmjhbemhm", "bpkmrxmgj", "bpkp", "bpkpkmaa",	/* 1208 */
+	"bpkwnx", "bpleiu", "bpllz", "bpmlmfw",	/* 1212 */
+	"bpmryoxwqfvo", "bpplest", "bppljhtgdfwnae", "bpqcdquwmzqv",	/* 1216 */
+	"bpry", "bpscjbdeausjub", "bpsngdhq", "bptp",	/* 1220 */
+	"bpvdbmxi", "bpveqfrrb", "bpvmwulmqfrxbq", "bpwegk",	/* 1224 */
+	"bpzdrqwxw", "bpzyeiyrqzsq", "bq", "bqajagvpg",	/* 1228 */
+	"bqcpfwcorm", "bqerfmrla", "bqevfkoggqit", "bqgqaomgsuaz",	/* 1232 */
+	"bqgqvovdduz", "bqidkpwattacg", "bqjcohfsssgqj", "bqjvext",	/* 1236 */
+	"bqk", "bqklohwdpncmpw", "bqn", "bqoqlrdvoc",	/* 1240 */
+	"bqswkmizufbvbs", "bqtyxkb", "bqublwi", "bqvlndo",	/* 1244 */
+	"bqwkcyms", "bqx", "bqybp", "bqyjkobjyvkiqg",	/* 1248 */
+	"bqylqkysligxzj", "bqyxaqbaivrnxd", "br", "braknzs",	/* 1252 */
+	"brawx", "brcmflxdbx", "brdix", "breiixqbvgcpj",	/* 1256 */
+	"brgrcng", "brgspcqgohzkqy", "brijzr", "briplk",	/* 1260 */
+	"brku", "brlnpcajnife", "brm", "brnhbzacnbym",	/* 1264 */
+	"brnjfpmpzxhqu", "brnqo", "brnxjkxthg", "brpanjsxk",	/* 1268 */
+	"brq", "brqpaok", "brqxni", "brqy",	/* 1272 */
+	"brri", "brroodiiollv", "brrsujnjyw", "brrzgyzg",	/* 1276 */
+	"brujuufxrazwfw", "brulapmotccfa", "brvjkxmuvyfat", "brvk",	/* 1280 */
+	"brxllokql", "brybhlh", "bryk", "brzkptfim",	/* 1284 */
+	"brzpf", "bs", "bsarmpmxnk", "bscxd",	/* 1288 */
+	"bsgngrtxgbcju", "bshf", "bsjmseruly", "bsjugvvpv",	/* 1292 */
+	"bskjdhuywwak", "bsklnkqsghxa", "bsldo", "bsoyz",	/* 1296 */
+	"bspwptpdynveo", "bsrk", "bsrvftwaivbi", "bss",	/* 1300 */
+	"bsuyxkmi", "bswzdd", "bsxpelrcehncu", "bsyg",	/* 1304 */
+	"bsyllfo", "bszqmktytdwxkw", "bt", "bta",	/* 1308 */
+	"btahnpwg", "btdz", "btexkfuczdglu", "btflwyoi",	/* 1312 */
+	"btg", "btgxclatimjn", "btic", "btkjjsud",	/* 1316 */
+	"btkvavke", "btlsjeiepnuxtv", "btnqvhu", "btntlkfuik",	/* 1320 */
+	"btnvmdk", "btpyoxapij", "btqcgelwbsg", "btqvtdpugoaulk",	/* 1324 */
+	"btqxaoty", "btqzabdjbj", "btt", "btwkpci",	/* 1328 */
+	"btwrkhcwcjk", "btxgedfg", "btyi", "bu",	/* 1332 */
+	"buamkjcdzqoayr", "bub", "bubmyj", "bucsaosuoyxb",	/* 1336 */
+	"budlnnaonqopcn", "budlzaiy", "buexxtcoxxh", "bufeyqfhtpkn",	/* 1340 */
+	"bufuhruvuohba", "buhg", "buiss", "bujawtzosiprvd",	/* 1344 */
+	"bulsyyfj", "bulyjrrx", "bunsahlbdcpvk", "bunsjnjuqfxfz",	/* 1348 */
+	"buqsoumtmb", "buqysrjthffszn", "burjcsuovkpmt", "burzepjeumfx",	/* 1352 */
+	"buspbwq", "buu", "buubydokpgjn", "buvwlareosksoz",	/* 1356 */
+	"buw", "buwxcwmdmunh", "buyhhgraohnh", "buzi",	/* 1360 */
+	"buzknnq", "buzwmop", "bv", "bvccao",	/* 1364 */
+	"bvciydm", "bvdius", "bve", "bvfmnezg",	/* 1368 */
+	"bvgxgih", "bvhfd", "bvjalthlsf", "bvjvtfvaatocfe",	/* 1372 */
+	"bvjxdcdptxa", "bvkcsptfvgtkoj", "bvkxorxcyjvd", "bvmns",	/* 1376 */
+	"bvqiggz", "bvrbrovzbstvlv", "bvrgimeiaem", "bvrngmigzalz",	/* 1380 */
+	"bvsnbyjwggdht", "bvstyydnsiwfqp", "bvtkhh", "bvtthc",	/* 1384 */
+	"bvtuby", "bvtwltr", "bvwqkisb", "bvxbvdgxbcur",	/* 1388 */
+	"bvxmbdyukium", "bvxollyzau", "bvymmidjcyc", "bvywphfved",	/* 1392 */
+	"bw", "bwaao", "bwcyuhz", "bwdmxeu",	/* 1396 */
+	"bwgaygrsu", "bwghngvjefe", "bwgkeswgvx", "bwgt",	/* 1400 */
+	"bwjpnk", "bwlc", "bwmfxqybdceud", "bwnvdlmji",	/* 1404 */
+	"bwoxzsibfrwn", "bwq", "bwqjwoibz", "bwtcbdrabxjpi",	/* 1408 */
+	"bwtfvi", "bwtm", "bwtn", "bwtxqht",	/* 1412 */
+	"bwuxxgzald", "bwwg", "bwwgzbbpsqr", "bwzlfyb",	/* 1416 */
+	"bwzyrmaghsy", "bx", "bxafvo", "bxcqus",	/* 1420 */
+	"bxfsykeevdus", "bxhefmozw", "bxifv", "bxioxztoaz",	/* 1424 */
+	"bxirjstyziom", "bxiygklloyvtm", "bxjkcvwizcdua", "bxmquboivvg",	/* 1428 */
+	"bxnwugmeryzdn", "bxpa", "bxqwgsvqrlex", "bxranfwgtx",	/* 1432 */
+	"bxrgqdrmphvux", "bxrjkgxqk", "bxrxzjlr", "bxsgrbddzepfdh",	/* 1436 */
+	"bxvuah", "bxvv", "bxxytn", "bxyrt",	/* 1440 */
+	"bxzqnhsylsv", "by", "byae", "byaquao",	/* 1444 */
+	"bybglejzqxj", "bybs", "bydbb", "bydxzci",	/* 1448 */
+	"bydzlgr", "byeqgylfxgpjnv", "byfisdtqchqkh", "byfpybjo",	/* 1452 */
+	"bygbjfwawebp", "byghm", "bygw", "byiau",	/* 1456 */
+	"byiiou", "byil", "byjgw", "byl",	/* 1460 */
+	"bymlkpzrll", "bynilhpfmft", "byoduuyho", "bypfaldaunhwvz",	/* 1464 */
+	"byqfpbexx", "byr", "byrb", "byrmyxhavxz",	/* 1468 */
+	"byrtcw", "byrvbiarxspngs", "byt", "byuvtzysocdrl",	/* 1472 */
+	"byuysfpzfyofn", "byzxp", "bz", "bzbyuhgmvymtp",	/* 1476 */
+	"bze", "bzfizeek", "bzfrhygcdxirc", "bzfxxo",	/* 1480 */
+	"bzfzngv", "bzgopqatxae", "bzgvucmdvojvq", "bziyt",	/* 1484 */
+	"bzjo", "bzkgllfpr", "bzlnecjadugakp", "bzmxagrp",	/* 1488 */
+	"bznvzchok", "bzohr", "bzqpwc", "bzrqbnojmsj",	/* 1492 */
+	"bzrxiuhn", "bzsl", "bzuirq", "bzurcuuqbei",	/* 1496 */
+	"bzuxrpet", "bzvxlabphi", "bzxn", "bzzzopegbad",	/* 1500 */
+	"ca", "caac", "caacl", "caboub",	/* 1504 */
+	"caclgsg", "caclswcnkcfuxd", "cacwgzrxaheyhz", "cacwtm",	/* 1508 */
+	"cad", "cadswcmb", "caejgfwepjmgaz", "cag",	/* 1512 */
+	"caiulajm", "cajjyzwzg", "cajxyydyflfyj", "cakphnle",	/* 1516 */
+	"camkmjwevrgy", "canjm", "cannmbbh", "catoxoecoc",	/* 1520 */
+	"caubxs", "cavklyjq", "cawykengteg", "caxtdlyejcqv",	/* 1524 */
+	"caxw", "caygapafrr", "cazdkrjdqn", "cazkkj",	/* 1528 */
+	"cb", "cbamxnathi", "cbb", "cbbdpoyou",	/* 1532 */
+	"cbbkzim", "cbcimmzttw", "cbd", "cbdewm",	/* 1536 */
+	"cbftptpmuhn", "cbieankxc", "cbierpi", "cbixibqnpd",	/* 1540 */
+	"cbjuiqgtjog", "cbl", "cblz", "cbmtzepjerjvh",	/* 1544 */
+	"cbmytwarkkwl", "cbnelzygcoldst", "cbnosxgxw", "cbpcq",	/* 1548 */
+	"cbpiieerlgd", "cbsfe", "cbtvknedz", "cc",	/* 1552 */
+	"ccabzpecjo", "ccb", "cceribgnkviv", "ccfax",	/* 1556 */
+	"cch", "ccjrszvd", "cclovuy", "cclsoineiycz",	/* 1560 */
+	"ccovmtpevvbjj", "ccqdlscinmanx", "ccqsbogrc", "ccquzjilhevrcv",	/* 1564 */
+	"ccqzhvooynh", "cctyzbry", "ccub", "ccujdodcuaiop",	/* 1568 */
+	"ccwfincejrx", "ccwp", "cczbgqcmp", "cczhhuzz",	/* 1572 */
+	"ccztywjmspbpo", "cd", "cdaaozbyjekjs", "cdaxjhnrqenp",	/* 1576 */
+	"cdbxl", "cddmhdclba", "cdexkkeamtbt", "cdfox",	/* 1580 */
+	"cdfsqvtabed", "cdfwo", "cdh", "cdhd",	/* 1584 */
+	"cdmkac", "cdoeoi", "cdojdmfzeulgz", "cdp",	/* 1588 */
+	"cdppvbqa", "cdq", "cdqtbaml", "cdr",	/* 1592 */
+	"cdscfioaooygx", "cdtm", "cdw", "cdwcurjxggijo",	/* 1596 */
+	"cdynncwnidktih", "cdzjvlksya", "cdzoqsw", "ce",	/* 1600 */
+	"cebaf", "ceccn", "cecf", "cecqbtbienppi",	/* 1604 */
+	"cecqdabcftpc", "ceelvcgub", "ceenlhjpgahn", "cefaazsovudw",	/* 1608 */
+	"ceg", "cegcdnmos", "cehfhrdfqxo", "cejhh",	/* 1612 */
+	"celvlfzcftxzl", "celzb", "cemfhiynhid", "cenvmfqo",	/* 1616 */
+	"ceodmnsns", "ceouker", "ceowrcaec", "ceqd",	/* 1620 */
+	"ceqzyuo", "ceswfzxf", "cetbyqyoyanmst", "ceuk",	/* 1624 */
+	"ceurtbwesoydbg", "cexj", "cexwtsisteb", "ceynnunxopue",	/* 1628 */
+	"ceywjntkhauw", "cf", "cfa", "cfajkuriailsof",	/* 1632 */
+	"cfdejsewkkxn", "cfdnksgml", "cfdyktayxownky", "cffcwj",	/* 1636 */
+	"cffgpoqihiv", "cfftvqjpqge", "cffysas", "cfgcioz",	/* 1640 */
+	"cfhbmhxooock", "cfhqais", "cfijkimh", "cfkoyrfwp",	/* 1644 */
+	"cfkzd", "cflyyibnm", "cfomp", "cfornpqzqny",	/* 1648 */
+	"cfoy", "cfq", "cfqc", "cfs",	/* 1652 */
+	"cftndkrmfyid", "cftw", "cfuirjvrro", "cfuvqlokph",	/* 1656 */
+	"cfvkrxu", "cfvvusuimd", "cg", "cgaiyzhxody",	/* 1660 */
+	"cgbz", "cgcnsqogkrrh", "cgcqytpodl", "cgea",	/* 1664 */
+	"cgeddigcpksc", "cgedllcpd", "cgfi", "cgfkg",	/* 1668 */
+	"cgfnxhbje", "cgfsymxacuyg", "cgftloyznyswv", "cgg",	/* 1672 */
+	"cgghapkhsen", "cggnwkqmvawo", "cghphvawshuarz", "cgjgfsifews",	/* 1676 */
+	"cgkg", "cgksengsholrb", "cgmwmdcixid", "cgnhlyumpvq",	/* 1680 */
+	"cgqwzhfg", "cgrpfki", "cgrvhjoywhtnag", "cgtjgjwrhcbizp",	/* 1684 */
+	"cgu", "cgvqivimmeojpu", "cgvsbaoy", "cgwmynwsjqvob",	/* 1688 */
+	"cgwnqhbhiuvxt", "cgxkwbzhvr", "cgxzpczxv", "cgzm",	/* 1692 */
+	"ch", "charedl", "chaywb", "chcibnvimwpmcu",	/* 1696 */
+	"chd", "chdguetdosbnq", "cheoen", "cheoghgdpfhmj",	/* 1700 */
+	"chfcu", "chfd", "chgdhgxigzwlq", "chgegmucbbunzy",	/* 1704 */
+	"chhchulukdhh", "chhstplthwjrcc", "chigwborxrb", "chkbvfan",	/* 1708 */
+	"chkiwfnc", "chkmtvvklwv", "chlagxzh", "chnmpftnonhoyq",	/* 1712 */
+	"chphurkvqadbhp", "chpndyhkg", "chrho", "chshuotvvzpv",	/* 1716 */
+	"chsysm", "chutzpoecxlthz", "chuuf", "chvptwvnrnsjng",	/* 1720 */
+	"chvvtn", "chvxavqarck", "chws", "chyffwwvhrci",	/* 1724 */
+	"chypbwg", "chzds", "ci", "cicaelqcq",	/* 1728 */
+	"cicyocu", "cidgmeyzbz", "cidiyswwac", "ciemueazx",	/* 1732 */
+	"ciex", "cigyr", "cih", "cihf",	/* 1736 */
+	"cikbbauwifb", "cikzouqsvfs", "cilhdvuxli", "cilhlideic",	/* 1740 */
+	"ciljxeh", "cilkoo", "cimmhft", "cimnkr",	/* 1744 */
+	"cimptznygkxfh", "cimvrqylou", "cingaxrymqpcm", "cinhht",	/* 1748 */
+	"cioksxf", "cipvypgyhoy", "cipxmob", "ciqumjm",	/* 1752 */
+	"cirskala", "cisvoizgfpblk", "cisxtwbl", "cityzo",	/* 1756 */
+	"civqfanzfqv", "ciwxhvhz", "cizespaj", "cizimjhnftbbxe",	/* 1760 */
+	"cj", "cjarwvhjj", "cjawvjpdfcozh", "cjbmbxi",	/* 1764 */
+	"cjbrjtruyszr", "cjeuwnhlelr", "cjfpxnutwwv", "cjhjzicth",	/* 1768 */
+	"cjiipzrkjonc", "cjjoi", "cjjshlwhe", "cjkcpcfkpt",	/* 1772 */
+	"cjlamqcnix", "cjlcin", "cjmjkvhsjh", "cjmrnozxxkguz",	/* 1776 */
+	"cjn", "cjon", "cjpqo", "cjptb",	/* 1780 */
+	"cjqouezuicsop", "cjqp", "cjqqnuviz", "cjrcwjoittnyg",	/* 1784 */
+	"cjrtgsoelgs", "cjryigrq", "cjt", "cjtblybcc",	/* 1788 */
+	"cjvag", "cjvu", "cjwdqvu", "cjwolocpo",	/* 1792 */
+	"cjxzbuvxtdn", "cjzfeiggm", "ckbobtfejpbsqc", "ckcjkphu",	/* 1796 */
+	"ckdaz", "ckehlhihqmsba", "ckeyazoj", "ckg",	/* 1800 */
+	"ckgihagn", "ckiupkpuckck", "ckj", "ckk",	/* 1804 */
+	"ckklxmafrpg", "cklroc", "ckndwpusb", "ckoz",	/* 1808 */
+	"ckqhpj", "ckugzfootcvxqj", "ckuivtsqqwxx", "ckv",	/* 1812 */
+	"ckvaoz", "ckvuzdxiuon", "ckxhxadvok", "ckyl",	/* 1816 */
+	"ckyxjdocflzv", "cl", "clalwdr", "clateohmqhjb",	/* 1820 */
+	"clcoxi", "clcvwppwvsngqk", "clgudcnjhm", "clibumypfgctik",	/* 1824 */
+	"cljjpjm", "clkpbtywcmhfc", "clnvwwnx", "clrfazzubs",	/* 1828 */
+	"cluyhvieiqlhg", "clwziheiq", "clx", "clxkkfwf",	/* 1832 */
+	"cly", "clywav", "clzyyt", "cm",	/* 1836 */
+	"cmagkzhqmdo", "cmbkjwncl", "cmc", "cmcbkcynwodt",	/* 1840 */
+	"cmcvjg", "cmdbbymka", "cmdnvr", "cmeshjit",	/* 1844 */
+	"cmica", "cmijnj", "cmjmzjziuzbaoy", "cmkqkz",	/* 1848 */
+	"cmlwih", "cmoiatqsn", "cmpzu", "cmrolcenjnapcs",	/* 1852 */
+	"cmrpbbzkr", "cmrtg", "cmt", "cmtdq",	/* 1856 */
+	"cmu", "cmxwiqzf", "cmxxbmb", "cmzewvsnm",	/* 1860 */
+	"cn", "cnafbr", "cnatk", "cnauza",	/* 1864 */
+	"cnbgwomtw", "cnbhqye", "cnbstexpdjjln", "cnbupxuxcozt",	/* 1868 */
+	"cnbztexpjt", "cnctzgcs", "cneswavlu", "cnfcd",	/* 1872 */
+	"cnfjnxqm", "cnfkoxin", "cnfksvyk", "cngmaxnnt",	/* 1876 */
+	"cnh", "cnhljesiur", "cnhwvsoreo", "cnikpetbfoma",	/* 1880 */
+	"cnixauu", "cnixi", "cnl", "cnlmnxvrshb",	/* 1884 */
+	"cnn", "cnocfa", "cnoxfcjqmgcgok", "cnpju",	/* 1888 */
+	"cnrydzwq", "cnsuhe", "cnsv", "cnt",	/* 1892 */
+	"cntoheaayqjfss", "cnumjam", "cnunupfd", "cnuzqmvxcxgkcc",	/* 1896 */
+	"cnvy", "cnynwikzuyp", "cnzhgqhgtmff", "cnzm",	/* 1900 */
+	"cnzofittmhspyh", "cnzvkenfwiezsa", "cnzvnkqrnyb", "co",	/* 1904 */
+	"cobhdheaztfu", "cobwot", "coenqgzbrxfk", "coesqouc",	/* 1908 */
+	"cof", "cogevgnhidm", "cogfteofenz", "cohmznmfkoetp",	/* 1912 */
+	"coihot", "collwds", "colrwxxh", "com",	/* 1916 */
+	"congccvuikm", "cooanvkk", "copqfployowscu", "coqm",	/* 1920 */
+	"coraxsh", "cosjtcomi", "cosncqtdot", "cotmfxfenxjh",	/* 1924 */
+	"covks", "covohqyhjwc", "coygze", "cp",	/* 1928 */
+	"cpb", "cpbl", "cpbwlm", "cpcwicbdrdyty",	/* 1932 */
+	"cpdpmqzv", "cpdtmpynkj", "cper", "cpfmcvdaqtpr",	/* 1936 */
+	"cpfofh", "cpfvepozouix", "cpifdqcalblfta", "cpigr",	/* 1940 */
+	"cpiwushw", "cpjjupmlrjh", "cpkdbdnsox", "cpkngufmleq",	/* 1944 */
+	"cpksdkdydr", "cplnbwvys", "cpou", "cppbcjmxkmtin",	/* 1948 */
+	"cpphyeqxxmvijq", "cppx", "cprfbolfhzye", "cprtmdklzhpvn",	/* 1952 */
+	"cprtqder", "cpsz", "cptixrudws", "cptqf",	/* 1956 */
+	"cpu", "cpucrokqzra", "cpvyoxzpdfr", "cpwvd",	/* 1960 */
+	"cpzju", "cq", "cqcdshjfe", "cqct",	/* 1964 */
+	"cqdednignw", "cqdhnihim", "cqfedrnac", "cqgdfhfgtz",	/* 1968 */
+	"cqgfnnrk", "cqhv", "cqihipoqucgfav", "cqkkzluqicr",	/* 1972 */
+	"cqkp", "cqlfqtv", "cqlplkvjugdbo", "cqmnul",	/* 1976 */
+	"cqn", "cqnfgaxy", "cqnvjmdbzzx", "cqpbczkgq",	/* 1980 */
+	"cqpyvskekqwsb", "cqqfdgsee", "cqqshdpjkxlahh", "cqqzqnfys",	/* 1984 */
+	"cqrigmarili", "cqrsbss", "cqrxfxmycjov", "cqs",	/* 1988 */
+	"cqtersab", "cqts", "cqv", "cqvffye",	/* 1992 */
+	"cqvile", "cqvoqvr", "cqvpiypzgf", "cqxtet",	/* 1996 */
+	"cr", "craxjvtb", "craygznhssjhru", "crc",	/* 2000 */
+	"crce", "crfqnpvg", "crfrn", "crgqdsrh",	/* 2004 */
+	"crgwcpbuz", "crhokokxdmbx", "crhuxq", "crkvae",	/* 2008 */
+	"crmz", "crnzcjqz", "crp", "crpvdgg",	/* 2012 */
+	"crqeztr", "crqghvw", "crqs", "crroc",	/* 2016 */
+	"crsdn", "crurlhfsyhnk", "crwfyhmfsnhu", "crwlaukxwgfzql",	/* 2020 */
+	"crx", "crxf", "crxxwuwpad", "crymv",	/* 2024 */
+	"cryoce", "crz", "crzbkgvcpbk", "crznlgdj",	/* 2028 */
+	"cs", "csbrlyo", "csegnvru", "csel",	/* 2032 */
+	"csevvapey", "csguy", "cshdnqjaq", "cshjuiiqxycgcb",	/* 2036 */
+	"cslgslcmwms", "csmyyypfvu", "csnlbwc", "csnrqfqi",	/* 2040 */
+	"cso", "csoz", "csqumtffsk", "csrzsb",	/* 2044 */
+	"csuid", "csuvyu", "csw", "cswqwqiar",	/* 2048 */
+	"cswyvjsvplgpqx", "csx", "csxmuzhhpivxhz", "ct",	/* 2052 */
+	"ctacrlaa", "ctadcvlkmhoqbr", "ctaqvzayvzeofb", "ctawhe",	/* 2056 */
+	"ctawpozub", "ctb", "ctcnhavvolv", "ctdlufqox",	/* 2060 */
+	"ctdyaoo", "ctfekhaxnxxgqn", "ctfquo", "ctgchb",	/* 2064 */
+	"ctiacpyjpjfpjf", "ctiba", "ctihtdeku", "ctkijiddcagup",	/* 2068 */
+	"ctkmg", "ctkynoiizeaib", "ctliwbqdbqekr", "ctlv",	/* 2072 */
+	"ctovu", "ctpqksvbg", "ctqivjwxudyhed", "ctqjg",	/* 2076 */
+	"ctqmfghocglqno", "ctstmimpxbzu", "ctsxq", "ctt",	/* 2080 */
+	"ctte", "cttgjmken", "cttgurhilcxjcs", "ctwboftrnovhhj",	/* 2084 */
+	"ctwdwnckcsxgru", "ctx", "ctyrcai", "cu",	/* 2088 */
+	"cuabqjmjtc", "cuafcu", "cuavdrmqakwtw", "cuay",	/* 2092 */
+	"cubaa", "cubfmbrq", "cucez", "cudsy",	/* 2096 */
+	"cufais", "cufpdqbrn", "cufwv", "cugpnayemjzoui",	/* 2100 */
+	"cuhmivia", "cuhnqgvjpwbm", "cuikfvaziwlhwd", "cuixdpcnlbgx",	/* 2104 */
+	"cujpbjufwtpf", "cukqebmuphpcvt", "cum", "cumfsibkh",	/* 2108 */
+	"cumwcolhnkc", "cuopxmlnagf", "cupaornnq", "curkne",	/* 2112 */
+	"cuschcnq", "cuuw", "cuvmxmi", "cux",	/* 2116 */
+	"cuxa", "cuy", "cuz", "cuzkttwcjnvir",	/* 2120 */
+	"cv", "cvacrjwxyd", "cvdqlurb", "cvdto",	/* 2124 */
+	"cveby", "cvemgivupv", "cvfjx", "cvfrpzykygrxv",	/* 2128 */
+	"cvgy", "cvhaxwnppww", "cvhmfjewwbny", "cvknts",	/* 2132 */
+	"cvlrccogtwdoq", "cvmlaqtlg", "cvmps", "cvoafqw",	/* 2136 */
+	"cvpc", "cvqskzqesgih", "cvr", "cvrxcjnlwryjq",	/* 2140 */
+	"cvs", "cvsrzjdmwebnh", "cvttegpijsutbq", "cvvgmdjkrdaerl",	/* 2144 */
+	"cvvif", "cvviwn", "cvvlsjpjog", "cvxwcebg",	/* 2148 */
+	"cvyqytayfd", "cw", "cwbeemkkzp", "cwbrhihz",	/* 2152 */
+	"cwdjqqxoiy", "cwdkkhe", "cwenslodjjai", "cwfbdhzpu",	/* 2156 */
+	"cwfs", "cwgqgpydlzzyf", "cwhtfukfxf", "cwjadkghi",	/* 2160 */
+	"cwjbdfj", "cwkzdskzfskqk", "cwlagdxjri", "cwlplwxato",	/* 2164 */
+	"cwlrmgxzd", "cwls", "cwm", "cwmslj",	/* 2168 */
+	"cwnivgrwaxeg", "cwof", "cwope", "cwrsxzq",	/* 2172 */
+	"cwsctwfgdigqak", "cwsers", "cwssj", "cwwmo",	/* 2176 */
+	"cwymbawgl", "cwzawx", "cwziilas", "cx",	/* 2180 */
+	"cxba", "cxcxeybafmmlz", "cxeeo", "cxehxsbrlabu",	/* 2184 */
+	"cxflkogcs", "cxg", "cxge", "cxh",	/* 2188 */
+	"cxhevdl", "cxk", "cxkggfjgqkmjmv", "cxlbouscf",	/* 2192 */
+	"cxlfrev", "cxlg", "cxmp", "cxmpxqgz",	/* 2196 */
+	"cxoh", "cxokjkfeg", "cxoqf", "cxpgjyvo",	/* 2200 */
+	"cxqioqct", "cxqmmggtebue", "cxsnrui", "cxtdujukjrx",	/* 2204 */
+	"cxtecqij", "cxtqdqnbcocafy", "cxvkazkt", "cxwyg",	/* 2208 */
+	"cxy", "cxyjyhyx", "cxzdgxxeham", "cxznioncmwpx",	/* 2212 */
+	"cy", "cybabr", "cyboygbo", "cybsko",	/* 2216 */
+	"cydstbwzmisowu", "cyet", "cyfkr", "cygbidpq",	/* 2220 */
+	"cyhdjf", "cyhfa", "cyhymd", "cyjtcqap",	/* 2224 */
+	"cyktttaixf", "cyluzkjxlhlnyb", "cyookvjkvyqaq", "cyorvktohfq",	/* 2228 */
+	"cyovrlm", "cyp", "cyr", "cyroaqbxp",	/* 2232 */
+	"cyrviqqfigd", "cys", "cysnzwigsxdh", "cytbcgsxrjchyv",	/* 2236 */
+	"cytpkc", "cyvqhygppmyw", "cyxomsnlisver", "cyxpfhbvepfi",	/* 2240 */
+	"cyybfr", "cyyslc", "cyzqnsqv", "cyzyutkujjvv",	/* 2244 */
+	"cz", "czcbu", "czccdnvm", "czdcnqdzl",	/* 2248 */
+	"czdnvn", "czdpqauksnl", "czeddsakobekt", "czevimjehltm",	/* 2252 */
+	"czg", "czgbhubjz", "czgmqrvgocwvou", "czjhiywymcuax",	/* 2256 */
+	"czkjrrs", "czkknlmggnfcfv", "cznq", "cznv",	/* 2260 */
+	"czq", "czqr", "czw", "czxu",	/* 2264 */
+	"czz", "czzfnaka", "da", "daalqf",	/* 2268 */
+	"dabzkrqxsqwa", "dadsbagl", "daeba", "dafdbvaxtfn",	/* 2272 */
+	"dafpwdxqiyoxu", "dafxbi", "dahktuab", "dahs",	/* 2276 */
+	"dai", "dakagvyuwy", "damfx", "dammzrazzhb",	/* 2280 */
+	"danyksvhrqhgoo", "daodk", "dapoim", "daqgoiuhxk",	/* 2284 */
+	"darwwvepgq", "dat", "daua", "dauqa",	/* 2288 */
+	"dautvqxa", "davvoom", "daxam", "daxuxu",	/* 2292 */
+	"daydchbwtmcdn", "daydhhenkplyeu", "daygsmgegybbco", "dayxvlwib",	/* 2296 */
+	"db", "dbacgbgv", "dbaebgewz", "dbaq",	/* 2300 */
+	"dbbe", "dbcfsifpfaon", "dbchucxuj", "dbedyjzb",	/* 2304 */
+	"dbhpnyonkq", "dbineldbzmzt", "dbj", "dbnpxwxabp",	/* 2308 */
+	"dbnuornr", "dbnybkrbdm", "dbodviodv", "dboxsb",	/* 2312 */
+	"dbpcjblag", "dbplf", "dbpsjrydev", "dbrhjcutjeoqfy",	/* 2316 */
+	"dbup", "dbvtbysld", "dbwgvdfhfnbhsv", "dbwqeeywrlf",	/* 2320 */
+	"dbwsnpfgsozvdv", "dbxdmhoxdubn", "dbybrh", "dbz",	/* 2324 */
+	"dbzcmxceae", "dc", "dcb", "dcbl",	/* 2328 */
+	"dce", "dcghm", "dcgmdtmnfn", "dcgstwldd",	/* 2332 */
+	"dchkyzflgshn", "dcidg", "dcmfym", "dcmjoqlpf",	/* 2336 */
+	"dcnfugnxf", "dcoi", "dcpdqaacxyxcj", "dcpfzaktzlubsj",	/* 2340 */
+	"dcqxyumfyeeu", "dcr", "dcrvxg", "dcsqfqbof",	/* 2344 */
+	"dcsstcydfhl", "dcuhaorcgudfu", "dcvllusglmnr", "dcvrakab",	/* 2348 */
+	"dcxcohmalwd", "dcxgzn", "dcy", "dcybb",	/* 2352 */
+	"dcydawlist", "dcyzxom", "dd", "ddaahiv",	/* 2356 */
+	"ddcpcxxlfag", "ddcpv", "dddikl", "dddtygrhbyyaca",	/* 2360 */
+	"dddzrxmag", "ddek", "ddfsxofjpdey", "ddfxpmy",	/* 2364 */
+	"ddgluzs", "ddhkutytxpnai", "ddiixeh", "ddiqmpr",	/* 2368 */
+	"dditqva", "ddlf", "ddlvcs", "ddmew",	/* 2372 */
+	"ddn", "ddpfghoaecv", "ddrs", "ddvip",	/* 2376 */
+	"ddvwe", "ddwd", "ddxgvyym", "ddxrtco",	/* 2380 */
+	"ddxsi", "ddxvndxe", "ddybuodmabs", "ddyjntriiked",	/* 2384 */
+	"ddyqufzatteiow", "ddyze", "ddzgyqp", "ddzkepuq",	/* 2388 */
+	"ddzwdfci", "de", "dea", "deb",	/* 2392 */
+	"debajs", "decqijnjxcygix", "dectwsodwcn", "deebuqixz",	/* 2396 */
+	"deegvb", "degrjxsmzgfclo", "degrxraewocaal", "degyydul",	/* 2400 */
+	"dekrztgxeoqidi", "dekuzsor", "delh", "delsc",	/* 2404 */
+	"den", "denl", "deoeatiqqtkqjw", "deqcesnclyu",	/* 2408 */
+	"derrdh", "desdlktpne", "desj", "detkaafiksfb",	/* 2412 */
+	"deul", "deuppy", "devok", "devtrytlednax",	/* 2416 */
+	"dexnjd", "deyaezbhdprqj", "deyfofa", "df",	/* 2420 */
+	"dfaddhwkdaasp", "dfaegxgvi", "dfaplztbogzd", "dfblxgyv",	/* 2424 */
+	"dfcvsjmys", "dfd", "dfdkemfqddqtf", "dfdlhjkxdlgseb",	/* 2428 */
+	"dffzmwybyhf", "dfimqmsm", "dfiy", "dfj",	/* 2432 */
+	"dfjkgqxw", "dfjxnqyecqpqc", "dfofmhennjmq", "dfplwututnm",	/* 2436 */
+	"dfqazqyjrugq", "dfqdpybexfk", "dfqxroxz", "dfsxbz",	/* 2440 */
+	"dfuaikwpzos", "dfulvndftjr", "dfuxjdxkxwqn", "dfvqujk",	/* 2444 */
+	"dfwnf", "dfyglqamhyhnr", "dg", "dgaguettvvao",	/* 2448 */
+	"dgc", "dgcbazapkms", "dgdaxxmnisjsu", "dgdg",	/* 2452 */
+	"dgdmfiivivdphg", "dgdwusc", "dgebmivntf", "dgesprsgttlem",	/* 2456 */
+	"dgfobbpeq", "dgfrs", "dgfsl", "dggcvrwiln",	/* 2460 */
+	"dghnetrywrli", "dgicusqucczgu", "dgiwvhikxaegom", "dgjdul",	/* 2464 */
+	"dgjhpa", "dgkbplu", "dgm", "dgoay",	/* 2468 */
+	"dgotz", "dgq", "dgqcowzrrv", "dgrad",	/* 2472 */
+	"dgryjpknhv", "dgsnlhy", "dgsvnsg", "dgtkphbbrool",	/* 2476 */
+	"dguwb", "dgvyzokgtwrw", "dgwwc", "dgwzsqf",	/* 2480 */
+	"dgy", "dgymk", "dh", "dha",	/* 2484 */
+	"dhafgix", "dhbpshkcs", "dheeqx", "dhegzezntgno",	/* 2488 */
+	"dhhpxqlmmv", "dhibo", "dhjenqw", "dhldfjum",	/* 2492 */
+	"dhmwsgtq", "dhoylukozp", "dhqhpmgowre", "dhrlmf",	/* 2496 */
+	"dhsvopnucakxf", "dhsyqspk", "dhtnkkdcxtfn", "dhuvc",	/* 2500 */
+	"dhwpm", "dhwqgul", "dhxbjvhocvxc", "dhyfjprnohnw",	/* 2504 */
+	"dhzyzuir", "di", "diauqcfylaj", "diazq",	/* 2508 */
+	"diek", "diemgvklt", "dieoazorppo", "diflwceqd",	/* 2512 */
+	"diglctgsewdof", "digskbcftuk", "dihci", "dihs",	/* 2516 */
+	"diijpfegi", "dijsktjahafd", "dikg", "dilhixbuxkgy",	/* 2520 */
+	"dinlpmu", "dinozrmzj", "diothn", "diqohly",	/* 2524 */
+	"dirxjumtkhk", "dis", "disjepxlhhax", "dita",	/* 2528 */
+	"ditr", "divhfyvldodkq", "diyfkulhqdap", "diynpkltl",	/* 2532 */
+	"dizcpu", "dj", "djb", "djbv",	/* 2536 */
+	"djbyy", "djc", "djcmeq", "djctds",	/* 2540 */
+	"djebeusawunw", "djfixutqiloz", "djfolnlq", "djgusarfpjoa",	/* 2544 */
+	"djgxyolhzskkh", "djhadrhxwhh", "djhcoqtwuhr", "djiqsaicbcxen",	/* 2548 */
+	"djjvjcpu", "djkslibdpmjs", "djkuyk", "djlhcvriyqt",	/* 2552 */
+	"djmqtroqtccjw", "djms", "djn", "djnqfcxson",	/* 2556 */
+	"djnwgfq", "djpxhkxwmr", "djqe", "djqfbyiheg",	/* 2560 */
+	"djrcfywyqeuryu", "djrwjlchidysc", "djshwvsarcj", "djuvanurfr",	/* 2564 */
+	"djvdpnpmuh", "djygvhlvqmhea", "djyxs", "djyyegdh",	/* 2568 */
+	"dk", "dkberbo", "dke", "dkewmcdsjh",	/* 2572 */
+	"dkhapivi", "dkhn", "dkhvuq", "dkizqhvbidcxim",	/* 2576 */
+	"dkkm", "dklhkk", "dknsotlgkkkrdv", "dknzvzzysm",	/* 2580 */
+	"dkoab", "dkoby", "dkqfafegxhkgf", "dkrdmlpqflw",	/* 2584 */
+	"dksamzymjthkp", "dksfwlxp", "dksr", "dksttykfmuc",	/* 2588 */
+	"dkt", "dkujyjrmlf", "dkvelmpyba", "dkvm",	/* 2592 */
+	"dkwpusmkrg", "dkxarlnuwwt", "dkxkuuigmsbd", "dkyf",	/* 2596 */
+	"dkyglmxzkav", "dkyiogxvym", "dkymdgessx", "dl",	/* 2600 */
+	"dlarpsmf", "dlavlgdorhm", "dlbfqelphm", "dlbnqllfg",	/* 2604 */
+	"dlbnuc", "dlcme", "dlcy", "dlgkrfcsj",	/* 2608 */
+	"dlia", "dlj", "dljmscrt", "dljyu",	/* 2612 */
+	"dlkbkanfdmew", "dlmvvmvom", "dlmwpqkzfo", "dlpywl",	/* 2616 */
+	"dlq", "dlrtrsof", "dls", "dlswtuhkvog",	/* 2620 */
+	"dltrkrd", "dltsfu", "dltzswxdtd", "dlvbxk",	/* 2624 */
+	"dlwkqqsxtyvyif", "dlwxkqojrtt", "dlyi", "dlyiehllfxyddx",	/* 2628 */
+	"dlzcs", "dlzhrdbp", "dm", "dmanibuqk",	/* 2632 */
+	"dmbr", "dmewiec", "dmgl", "dmguqpgx",	/* 2636 */
+	"dmidg", "dmldy", "dmlud", "dmmhpwpkc",	/* 2640 */
+	"dmmqfespg", "dmmtrwzuhvsbgf", "dmnehlgojsetru", "dmngxfbcxnb",	/* 2644 */
+	"dmokwfl", "dmpzj", "dmqya", "dmrlvrpyrhcx",	/* 2648 */
+	"dmunnizly", "dmvetq", "dmzquzfvvminxq", "dmzsfhxiunnsu",	/* 2652 */
+	"dn", "dnbdfwgr", "dncgduahpcgkg", "dncvbfdqvcg",	/* 2656 */
+	"dndfatysflbvew", "dndnibekhiavew", "dnejzl", "dnfsqfjjprbcaw",	/* 2660 */
+	"dnknae", "dnkrvf", "dnl", "dnmxdsaayrtn",	/* 2664 */
+	"dnntyv", "dnqpchlxxdz", "dnqxqqy", "dnrc",	/* 2668 */
+	"dnrkcsjbyjev", "dntkfwkheolqwo", "dntrn", "dntwheixh",	/* 2672 */
+	"dnwqoyagjfz", "dnwyakulbd", "dnxnizid", "dnyek",	/* 2676 */
+	"dnylmzgbcejih", "dnzypc", "doa", "doblxkive",	/* 2680 */
+	"dobnmrna", "dodpvpscfe", "dodxvbgzca", "doemmgkkhpom",	/* 2684 */
+	"doeuxzke", "dog", "dohrv", "doibr",	/* 2688 */
+	"dojlqg", "dojsu", "dojzcthsgkjan", "doktuzptkd",	/* 2692 */
+	"dolo", "dophq", "doq", "dordymhp",	/* 2696 */
+	"dowo", "dowqgsncoevo", "doyj", "doyovw",	/* 2700 */
+	"dp", "dpcxjsrfjcy", "dpdhgfhcaddww", "dpgankvkmyklza",	/* 2704 */
+	"dphwhhridll", "dpidbby", "dpifqouie", "dpjssmbeif",	/* 2708 */
+	"dpjxkwa", "dplqcxfbfdurk", "dpluousdkim", "dpmhhwkse",	/* 2712 */
+	"dpnmqvsduisfc", "dpnwcbq", "dpo", "dpoebix",	/* 2716 */
+	"dpptzljwpykx", "dpqkllwaz", "dpqwlgn", "dpsh",	/* 2720 */
+	"dpstnzcnwhng", "dptlkfufyxbvm", "dpvpoyezgeleej", "dpvxztap",	/* 2724 */
+	"dpwxxzmso", "dpx", "dpxat", "dpxioppvadygq",	/* 2728 */
+	"dpxv", "dpyj", "dpyopu", "dq",	/* 2732 */
+	"dqachzzvctt", "dqaly", "dqas", "dqbxakrci",	/* 2736 */
+	"dqctc", "dqctkrvrlxht", "dqegwefbvca", "dqgmrscmzzw",	/* 2740 */
+	"dqgxhkd", "dqjoqgz", "dqkebliu", "dqkglqzhyimvg",	/* 2744 */
+	"dqkn", "dqldnzglvqv", "dqmaegub", "dqmkemgdcocss",	/* 2748 */
+	"dqmmnuf", "dqnd", "dqpf", "dqphpcyfjsv",	/* 2752 */
+	"dqqffl", "dqqpd", "dqqxc", "dqtloijmqvkd",	/* 2756 */
+	"dqtxishdjeywtn", "dqtxmxctclbfcj", "dqux", "dqwbnifhabcuk",	/* 2760 */
+	"dqwilegsobvjip", "dqwofwfumsfbo", "dqxfqy", "dqxuenxq",	/* 2764 */
+	"dqymj", "dr", "draholqktw", "drccyarxv",	/* 2768 */
+	"dreagxlhhaauge", "drgzas", "drkgmhszjei", "drkiquqkbrghv",	/* 2772 */
+	"drkxs", "drlizdpdqndqp", "drlqd", "drlxa",	/* 2776 */
+	"drmmtfgtpbte", "drn", "drnbtg", "drnsmfblsqbdr",	/* 2780 */
+	"drqjycqchygtyg", "drqmylwj", "drqollsbustn", "drr",	/* 2784 */
+	"drup", "drvaggoxwxew", "drw", "drwxfwkkcjqvdi",	/* 2788 */
+	"drycwkffcgix", "ds", "dsahjmt", "dsbgxa",	/* 2792 */
+	"dsbkwfasofcxdu", "dsdbclgvtptf", "dsgp", "dshnozwezg",	/* 2796 */
+	"dshyuswe", "dsi", "dsj", "dsjnhh",	/* 2800 */
+	"dsjxazfpt", "dsk", "dslec", "dsnkbqadrknhwg",	/* 2804 */
+	"dsnqkcgrv", "dsp", "dspbdj", "dsqyolmyogsy",	/* 2808 */
+	"dsrhsbgv", "dsrl", "dss", "dst",	/* 2812 */
+	"dsvifw", "dswtyqzwkndo", "dsy", "dsycsp",	/* 2816 */
+	"dsziqpidtyakir", "dszqt", "dt", "dtalpunmkvl",	/* 2820 */
+	"dtarpuo", "dtbfakkqrxtb", "dtdizmgvo", "dtedyoulyli",	/* 2824 */
+	"dtfbelbwls", "dtfsy", "dtguxrnibxge", "dtkfcwi",	/* 2828 */
+	"dtmplozxgsnmg", "dtn", "dto", "dtosukeonpfp",	/* 2832 */
+	"dtpuyyvx", "dtrkx", "dtrugasialuck", "dtrypocpgim",	/* 2836 */
+	"dtszmcs", "dtuvaexlbch", "dtwokhuk", "dtwq",	/* 2840 */
+	"dtyngztw", "dtyxy", "dtzkdiceafaw", "du",	/* 2844 */
+	"duapcoaucad", "duec", "duhaeoja", "duieogek",	/* 2848 */
+	"dujya", "duktlxme", "dulbvwvvjdtfg", "dumbzxcqtup",	/* 2852 */
+	"dunfcmna", "dunvtegoc", "dupfawwhudtq", "duqkfwq",	/* 2856 */
+	"duqzpk", "duroyburah", "dusehgvz", "dusldo",	/* 2860 */
+	"dusplpm", "dutgvikbquahcd", "dutlbheg", "dutmbkcty",	/* 2864 */
+	"duttpgtigdvi", "duvyhzcbpbuijk", "duxerbuu", "duxfzaocdjbf",	/* 2868 */
+	"duy", "duzvbwsmpcedph", "dv", "dvai",	/* 2872 */
+	"dvaiehorhwcjf", "dvbtgeebtstty", "dvczratuf", "dvdvlzgk",	/* 2876 */
+	"dvhsg", "dvikl", "dviw", "dvjeiun",	/* 2880 */
+	"dvjsn", "dvkhhylrbomb", "dvkk", "dvklqa",	/* 2884 */
+	"dvkodfxsacgik", "dvlzfekybkk", "dvmjqpakt", "dvoabhnzr",	/* 2888 */
+	"dvoctxinezgil", "dvpxox", "dvq", "dvqex",	/* 2892 */
+	"dvqng", "dvqxfvvb", "dvrjzc", "dvrnkeazqs",	/* 2896 */
+	"dvrqcanafayeo", "dvs", "dvtacgqvvlby", "dvtevhwjnn",	/* 2900 */
+	"dvugzpassnxltm", "dvui", "dvv", "dvyunivud",	/* 2904 */
+	"dvzlg", "dw", "dwaccshslp", "dwbatksp",	/* 2908 */
+	"dwbd", "dwbdwbxbtpvord", "dwbpg", "dwbqfdfwuo",	/* 2912 */
+	"dwd", "dwdgkdiowumrga", "dwdmf", "dwedqrqi",	/* 2916 */
+	"dwemvj", "dweovqdswlbq", "dwfxxzdy", "dwhok",	/* 2920 */
+	"dwhp", "dwime", "dwiwm", "dwizjzcljvlk",	/* 2924 */
+	"dwj", "dwjqroorpvori", "dwjyhxujqzuokc", "dwlj",	/* 2928 */
+	"dwlkuigqrdg", "dwlnihkaxvop", "dwlo", "dwluhmwnzqtn",	/* 2932 */
+	"dwmctgx", "dwmohcxx", "dwnksmp", "dwoobub",	/* 2936 */
+	"dwqsyiicihyohe", "dwsj", "dwskrbhhyzjin", "dwtftsycvmjcd",	/* 2940 */
+	"dwti", "dwuohdqkppso", "dwxqfsbcqo", "dwzt",	/* 2944 */
+	"dx", "dxbwl", "dxcto", "dxdcchrjeiznf",	/* 2948 */
+	"dxdxgzh", "dxercd", "dxewsrjnf", "dxf",	/* 2952 */
+	"dxfbckln", "dxfpyksbcivy", "dxgj", "dxgwddapi",	/* 2956 */
+	"dxhxpvu", "dxirldjcce", "dxjebyyeueyo", "dxkxznrm",	/* 2960 */
+	"dxlfhh", "dxnonbwkyr", "dxnspx", "dxobencpq",	/* 2964 */
+	"dxpjush", "dxpywlidk", "dxqpccqafnqew", "dxrat",	/* 2968 */
+	"dxrovhedbi", "dxsxwywtvpksc", "dxtesdle", "dxtyehcnsps",	/* 2972 */
+	"dxuodmrv", "dxw", "dxwbvpw", "dxxptk",	/* 2976 */
+	"dxyp", "dy", "dyabokviehr", "dycsfhwunnthx",	/* 2980 */
+	"dycv", "dyedvkaya", "dyfakhrxju", "dyiphjrg",	/* 2984 */
+	"dylbegy", "dylwdfuiefwiqc", "dymhwdmat", "dymrlfsiygjhry",	/* 2988 */
+	"dynomd", "dyoqhjvl", "dypyvkjbbi", "dyqmaqjivoac",	/* 2992 */
+	"dyty", "dywwo", "dyygttlfnojth", "dyyypg",	/* 2996 */
+	"dyzomlapyuatx", "dz", "dzbjat", "dzckphjotzswz",	/* 3000 */
+	"dzdcdoicrjdci", "dzeqviqjo", "dzerbweobtdn", "dzevlrgrcrug",	/* 3004 */
+	"dzgchqyu", "dzhfgevznor", "dzhz", "dzijaelmg",	/* 3008 */
+	"dzkeof", "dzmazgmzkloqhz", "dzoeeamfed", "dzogfrbdb",	/* 3012 */
+	"dzqrmsttold", "dzqyhni", "dztmgefxxle", "dzuzqaw",	/* 3016 */
+	"dzvoxnsok", "dzvw", "dzwc", "dzwkeci",	/* 3020 */
+	"dzwpmrtjhzii", "dzwybvx", "dzyipujsq", "dzztilwijlympk",	/* 3024 */
+	"eaa", "eaaafeam", "eaccfz", "eacodsvf",	/* 3028 */
+	"eadgzshhapwfb", "eadorv", "eadzqhivjgx", "eaedlprp",	/* 3032 */
+	"eaedphr", "eafdcox", "eafilesz", "eafingashuekl",	/* 3036 */
+	"eahakkk", "eaiqjezgcl", "eajktolgty", "eajriebnxt",	/* 3040 */
+	"eam", "eammxkdo", "eamygiblf", "eaon",	/* 3044 */
+	"eareq", "earffcuaoe", "earrvoucf", "earukkzzrrce",	/* 3048 */
+	"easdgxqma", "eatjblybgrc", "eauieizl", "eawbtgjfih",	/* 3052 */
+	"eawppvwcghdt", "eaxrwvmwm", "eayvqla", "eazj",	/* 3056 */
+	"eazmfbhfxtki", "eb", "eba", "ebaifjhekqd",	/* 3060 */
+	"ebcmyosvkkklay", "ebcxoegrf", "ebdwntfkcacc", "ebeuyxzdzenkws",	/* 3064 */
+	"ebfieuvtsoxfxh", "ebgfjuj", "ebggpsperj", "ebi",	/* 3068 */
+	"ebicuc", "ebijntcldj", "ebjfv", "eblgfq",	/* 3072 */
+	"eblp", "ebnrzthwtnhvfe", "ebordmnatgzxyh", "ebqxmuw",	/* 3076 */
+	"ebr", "ebra", "ebtgki", "ebv",	/* 3080 */
+	"ebvtf", "ebwwifi", "ebx", "ebxeiy",	/* 3084 */
+	"ebxo", "ebywteltsowaxi", "ec", "ecbde",	/* 3088 */
+	"ecedlj", "eceqqjzbekf", "ecfw", "ech",	/* 3092 */
+	"echghjnqycqluu", "echnvfhrxfyn", "echom", "echsv",	/* 3096 */
+	"ecigvjelqbf", "ecjegggok", "ecjly", "ecklyflz",	/* 3100 */
+	"eckyleposrmz", "ecl", "eclmd", "ecmmbbschtz",	/* 3104 */
+	"ecmtritsbsg", "ecnryuax", "ecobywpnpik", "ecoehbxjlbsco",	/* 3108 */
+	"ecpqrmmtuxnruq", "ecril", "ectsoktkzmmsu", "ecuxrjeiczrxff",	/* 3112 */
+	"ecvpkni", "ecw", "ecxdgkoy", "ecyzy",	/* 3116 */
+	"eczqutmjc", "ed", "edacon", "edauwzo",	/* 3120 */
+	"edbtr", "edd", "edesytc", "edfvpyd",	/* 3124 */
+	"edg", "edhgx", "edhhktrrjr", "edibh",	/* 3128 */
+	"edioawahf", "ediyevs", "edjmejzyvowyp", "edjmqagxj",	/* 3132 */
+	"edloaurcv", "edqutaajzrnx", "edstccqguqe", "edtpphpxglyxbm",	/* 3136 */
+	"edudzesduqc", "edwkgtldl", "edwngwfouwevmf", "edwpifbdr",	/* 3140 */
+	"edwqcpjodamfk", "edxnjx", "edxvkhx", "edyid",	/* 3144 */
+	"edz", "edzdke", "eeajo", "eebvai",	/* 3148 */
+	"eebzd", "eecxzh", "eedmqgffhmqq", "eedzvquv",	/* 3152 */
+	"eeeandjip", "eefkgbgrweoaua", "eefux", "eehmfditkwuh",	/* 3156 */
+	"eeigbzrosxtf", "eejelt", "eelarxldh", "eelpcul",	/* 3160 */
+	"eenboqxpqx", "eeoaylkgsbi", "eep", "eescujugdoymnq",	/* 3164 */
+	"eetwd", "eeuftagv", "eexcnjnwunf", "eexudhk",	/* 3168 */
+	"eexwqm", "eeyemtowposli", "eeyiotmhvjis", "eeyjyigwibpohu",	/* 3172 */
+	"ef", "efa", "efammrljsswj", "efaunn",	/* 3176 */
+	"efbalxsuzwcbde", "efc", "efcnhecjglgdm", "efddvig",	/* 3180 */
+	"efebp", "efffpnxkf", "effftpusuq", "effqhcdzx",	/* 3184 */
+	"efglvlrppvfx", "efgtxabeqqp", "efjlnk", "efjxmfej",	/* 3188 */
+	"efkhridbiosgdd", "efmafaily", "efmilabnedt", "efnkpffcc",	/* 3192 */
+	"efnobkvzmszrlt", "efpknzyrnvf", "efqebtiswksamw", "efqemp",	/* 3196 */
+	"efqoj", "efraoybpgmxr", "efrdlxr", "efrnole",	/* 3200 */
+	"efsih", "eftfsg", "efu", "efvemwteisjk",	/* 3204 */
+	"efvjpjgbs", "efvlzibujtphxw", "efwqvuhasldchb", "efwvjj",	/* 3208 */
+	"efzbpj", "eg", "ega", "egadmoba",	/* 3212 */
+	"egaerhgqln", "egafob", "egbusykrlzggt", "egdfodo",	/* 3216 */
+	"egedyfrbitaeb", "egfvprrmdk", "eggpoekbbzv", "egidxq",	/* 3220 */
+	"egk", "eglfn", "eglvfh", "egn",	/* 3224 */
+	"egnfclbml", "egngenompzu", "egoxvscw", "egpim",	/* 3228 */
+	"egpinuw", "egpjnftfh", "egqhuec", "egqq",	/* 3232 */
+	"egujcso", "eguyakek", "egxg", "egym",	/* 3236 */
+	"egyxmk", "egzyf", "egzyzqgvt", "eh",	/* 3240 */
+	"ehcglwwowb", "ehcwgxpyvxtw", "ehd", "ehdcsmxsuyb",	/* 3244 */
+	"ehe", "eherwbtmn", "ehfmshadnvo", "ehhgklgu",	/* 3248 */
+	"ehikovd", "ehizqpqtsvjae", "ehkmbnx", "ehlnmq",	/* 3252 */
+	"ehlq", "ehmcivnpv", "ehnzvchijr", "eho",	/* 3256 */
+	"ehqkdnchdhrxl", "ehqyretxcj", "ehsdrdoavhc", "ehstjmilmwooa",	/* 3260 */
+	"ehta", "ehtksfwfk", "ehuvzkyzoikgq", "ehvg",	/* 3264 */
+	"ehvkprhdzrl", "ehvwcwtnrdcqbl", "ehwg", "ehwrwpk",	/* 3268 */
+	"ehykdqmiv", "ehzhwrlqqasqg", "ei", "eiarkca",	/* 3272 */
+	"eiavypxdz", "eicq", "eienmxk", "eigqqbuwwaipr",	/* 3276 */
+	"eihyytpinxf", "eiibaauqu", "eij", "eijqdlxhbdocd",	/* 3280 */
+	"eiliioq", "eimt", "eiontjjuo", "eioon",	/* 3284 */
+	"eipqgius", "eiro", "eisryvbxbbusp", "eivbdyfxvbak",	/* 3288 */
+	"eivbqllrrelubf", "eiw", "eiwedbu", "eiwwazqlnhlw",	/* 3292 */
+	"eixlcmpaqogxh", "eiylyqxmza", "eiyofmmiwdev", "eiz",	/* 3296 */
+	"eizvipylu", "eizvrfxqoi", "ej", "ejamsljniy",	/* 3300 */
+	"ejatb", "ejaums", "ejb", "ejbqqgqxmlio",	/* 3304 */
+	"ejc", "ejcy", "ejdzekhrcjrjwp", "ejehjmt",	/* 3308 */
+	"ejekerexdswmp", "ejgczth", "ejhvulqae", "ejicphplxiwpn",	/* 3312 */
+	"ejjdm", "ejlroujxzb", "ejlwx", "ejnpskgzecacx",	/* 3316 */
+	"ejo", "ejomxmoxbpjm", "ejpbxbtwyxuocd", "ejqwqvgzfnvb",	/* 3320 */
+	"ejrdjq", "ejsal", "ejsmros", "ejvalvf",	/* 3324 */
+	"ejyz", "ek", "ekazsenqnjwq", "ekbtnh",	/* 3328 */
+	"ekc", "ekcd", "ekcrogrdplbo", "ekculbbumkgenh",	/* 3332 */
+	"ekdbioxcxijyx", "ekdc", "ekdipll", "ekegp",	/* 3336 */
+	"ekeyezxjthns", "ekf", "ekfdb", "ekhe",	/* 3340 */
+	"ekjkddbnzw", "ekjmgk", "ekjrqgxsfgwlw", "ekkwnvw",	/* 3344 */
+	"eklhfz", "ekmksqyd", "ekpjre", "ekpwqqqz",	/* 3348 */
+	"ekq", "ekqqpqyakyqju", "ekqxxzpurl", "ekrej",	/* 3352 */
+	"eksbvru", "ekttfarwdu", "ekuapsmxayhqqp", "ekv",	/* 3356 */
+	"ekwn", "ekxxrudftwuzp", "ekyrhto", "ekzaj",	/* 3360 */
+	"ekzgvnig", "el", "elatxhhhvj", "elb",	/* 3364 */
+	"elbqrlnbzlxa", "elc", "elcfbqwlbc", "elcwaipj",	/* 3368 */
+	"elczqhoyrwpld", "eldtuuwchkoyi", "eldxzuacqermc", "eldzbubvt",	/* 3372 */
+	"eleruxxdocxrv", "eley", "elfere", "elgomol",	/* 3376 */
+	"elifstg", "eliuldbwwumwlp", "eljqhuunsdk", "elkalleq",	/* 3380 */
+	"elmmbtduow", "elmnsvqgv", "elmym", "eln",	/* 3384 */
+	"elneaiibisdk", "elnttazy", "elobadpc", "eloiusalha",	/* 3388 */
+	"elpbgdnejh", "elproupvx", "elrmsw", "elsaovwtt",	/* 3392 */
+	"eltoojcu", "eltpchglwjkq", "eltvufjcv", "eltxadjmknowtn",	/* 3396 */
+	"elunde", "elvswpg", "elvtixtmnl", "elwbvyjixjky",	/* 3400 */
+	"elxu", "ely", "elyudqkdnp", "em",	/* 3404 */
+	"emahjaqctlv", "emba", "embepkhxifzku", "embrvakuzv",	/* 3408 */
+	"emctkieh", "emfagrefaivxyv", "emfawdxbb", "emhjltl",	/* 3412 */
+	"emivr", "emjwipnukscnh", "emjwnr", "emjxzceeil",	/* 3416 */
+	"emncaknf", "emocuafod", "empodcczesmy", "emqudxkpuao",	/* 3420 */
+	"emqzhtlrn", "emrv", "emsbmt", "emsdqgd",	/* 3424 */
+	"emsuvmnbngj", "emtbsgslybuwe", "emuxwpb", "emwdxlcur",	/* 3428 */
+	"emwpv", "emywoaxqiciz", "emyzxyab", "emzrotpbdnne",	/* 3432 */
+	"en", "enahhkbo", "enawihme", "enayzhqrqdci",	/* 3436 */
+	"encxemdnxrgear", "enfqw", "enfure", "enfxrrcv",	/* 3440 */
+	"engfrlxfx", "enilbnqlwcjxl", "enjty", "enkdxyewku",	/* 3444 */
+	"enkkcq", "enkqkgibj", "enmfu", "enmmmbry",	/* 3448 */
+	"enppohqqt", "enppzupyi", "enpuerowwdf", "enqfi",	/* 3452 */
+	"enqgjcoq", "enqshbqdcxgvxs", "ens", "ensadjrzhzrlo",	/* 3456 */
+	"entm", "enugneqonhdjnn", "enurhdzgegwlhc", "enuypwya",	/* 3460 */
+	"env", "enzcewq", "enzeeuj", "eo",	/* 3464 */
+	"eoasok", "eobbjfyatkaeid", "eobkikuigj", "eobopxskrl",	/* 3468 */
+	"eobvlnpdwk", "eobxmta", "eodhetcejocgvu", "eogjfhn",	/* 3472 */
+	"eohd", "eohzhbhcd", "eokav", "eolqilwdifsveu",	/* 3476 */
+	"eolyim", "eom", "eomjqlttfuwhdy", "eomkhcckb",	/* 3480 */
+	"eomwvgsoqkdojx", "eonzi", "eoowahw", "eopobttvtomvv",	/* 3484 */
+	"eoqo", "eorcdjteakhwjs", "eoriczehsifcxr", "eornnutaonzazv",	/* 3488 */
+	"eotctswdcyfuss", "eoveiubn", "eovrucewk", "eowqyjeg",	/* 3492 */
+	"eoxiqgicoviy", "eoxlrwvyrhhj", "ep", "epavsvjnpqz",	/* 3496 */
+	"epd", "epeivjcpetfpy", "epgmhnegk", "epgzt",	/* 3500 */
+	"ephdujrmkkgxx", "epkjihtae", "epks", "eplelo",	/* 3504 */
+	"eplx", "epnkckn", "epqmfdtvpum", "epsp",	/* 3508 */
+	"epts", "epv", "epvfawer", "epwlmzs",	/* 3512 */
+	"epwyvgnihvdzio", "epx", "epzhzuwwxutcf", "epzjrqoqkfyv",	/* 3516 */
+	"eq", "eqaamymmu", "eqasi", "eqchdnvbmij",	/* 3520 */
+	"eqd", "eqe", "eqeeto", "eqeswgjmp",	/* 3524 */
+	"eqewjjvaqsg", "eqfmhfkr", "eqfxerzo", "eqkceplzhq",	/* 3528 */
+	"eqkiozgkzszcxq", "eqkoqdkdaouwvb", "eqlktuyaefqpm", "eqm",	/* 3532 */
+	"eqmaaaq", "eqmnnoptht", "eqo", "eqqq",	/* 3536 */
+	"eqrmhhpnenpqx", "eqs", "eqtaiizcqcquqt", "eqttgiqtae",	/* 3540 */
+	"eqw", "eqwsu", "eqyqcrzypdvkvb", "eqz",	/* 3544 */
+	"eqzxtevgqwe", "er", "erbzwekvxloxg", "erckdxhqtirkl",	/* 3548 */
+	"erd", "erdgirz", "erdnkbdpfmi", "ereebl",	/* 3552 */
+	"erekiumhcal", "ereon", "ergijs", "erhcngcphm",	/* 3556 */
+	"eribneow", "erj", "erlagnpujlzh", "erlegph",	/* 3560 */
+	"erlodevk", "erotxlxquvx", "erqtxjtgx", "errdyzwwv",	/* 3564 */
+	"errxloacuw", "ersofphmgok", "ersrgpnoefl", "ersvgpbruzs",	/* 3568 */
+	"ervepytdbi", "ervsk", "erzldirimxefk", "erzxsd",	/* 3572 */
+	"es", "esazkgmf", "esbkzmw", "esc",	/* 3576 */
+	"esdadzctbpsj", "esdmkqnlkit", "eset", "esfo",	/* 3580 */
+	"esfvqnzejvnbvl", "esgpnovbbw", "eshajsvb", "eshybgz",	/* 3584 */
+	"esieijhggptofg", "esjrhzr", "eskrssjaxy", "esl",	/* 3588 */
+	"eslgfffvsgpp", "esmfqredofsbgg", "esnae", "esnewhl",	/* 3592 */
+	"esnnso", "esohgbxa", "esphv", "esqnzp",	/* 3596 */
+	"esrptntrtxhks", "esrvhrws", "essgmj", "essjbto",	/* 3600 */
+	"esulycsz", "esvjmxhatu", "esvqnl", "esxefqcx",	/* 3604 */
+	"et", "etabnu", "etc", "etdtgjxvyu",	/* 3608 */
+	"etfekvyhs", "etg", "etimcvstxqpsn", "etjprjwhu",	/* 3612 */
+	"etljdhmkzff", "etnojtznm", "etpz", "etqbrarth",	/* 3616 */
+	"etqiyqwg", "etqswjdztha", "etrc", "etrinmxrtqgq",	/* 3620 */
+	"etru", "etsai", "etsrictzzylnmq", "etsxzpiczaxvj",	/* 3624 */
+	"ettgiyzucirou", "etuhatou", "etw", "etwxlepuetd",	/* 3628 */
+	"etxfhgmuu", "etyzucp", "etzojkts", "etzpxuwzjcpztv",	/* 3632 */
+	"eu", "euaiifxv", "euaqdzkyljvoon", "eucaduuc",	/* 3636 */
+	"eud", "euex", "eufj", "eufrayvwo",	/* 3640 */
+	"eufsixopzhfdf", "euftzajenp", "eugoogd", "euirjynoxwrytb",	/* 3644 */
+	"eujpv", "eul", "eulhcpyh", "eumsxeafj",	/* 3648 */
+	"eunaxdekxleiw", "eupdekbjkwqn", "euphjigmw", "eupyrbvd",	/* 3652 */
+	"eurdlsag", "eurufaorrvbym", "eus", "eutzpphyxg",	/* 3656 */
+	"euurkgjnnnu", "euvfrshgpyfa", "euw", "euwtybljpf",	/* 3660 */
+	"euxzrokzkkzbcm", "euymzifycyta", "euzdousgcl", "euzjpywyuicdyc",	/* 3664 */
+	"euzoewehre", "ev", "evavtl", "evcawxdpfri",	/* 3668 */
+	"evdo", "evdpi", "evdrswfmjvbn", "evkqh",	/* 3672 */
+	"evlrl", "evlrne", "evndljrtb", "evohjarilf",	/* 3676 */
+	"evprusklydwc", "evpt", "evqemz", "evqlybuhomsxo",	/* 3680 */
+	"evrtabnuwsaei", "evrtytmjy", "evtauwm", "evtuejf",	/* 3684 */
+	"evukvcpchq", "evvvj", "evxxr", "evyqns",	/* 3688 */
+	"evyrsvvvhv", "evytldrfnop", "evzweomak", "ew",	/* 3692 */
+	"ewcoxyzgduuwei", "ewdsntga", "ewegflmjru", "ewg",	/* 3696 */
+	"ewgcwuzekfu", "ewh", "ewhhmno", "ewjhxcxaxh",	/* 3700 */
+	"ewl", "ewmesx", "ewo", "ewpoac",	/* 3704 */
+	"ewqoymi", "ewqpqtdyskvxkx", "ewrrq", "ewsixawdzg",	/* 3708 */
+	"ewsnpinbobmcsc", "ewsqkvdgc", "ewtetrwwinw", "ewthilyxnuqnsb",	/* 3712 */
+	"ewtt", "ewumvbzymoraeh", "ewuqjyims", "ewwgwhtsy",	/* 3716 */
+	"ewwwq", "ewxabkbvesso", "ewxvlkciso", "ewywxkyvkjwvv",	/* 3720 */
+	"ex", "exdx", "exghosjymfte", "exhlz",	/* 3724 */
+	"exidtzqnkk", "exn", "exosrsikmu", "expyikaat",	/* 3728 */
+	"exrjd", "extxcrweabyic", "exvempzbhc", "exvwyoullior",	/* 3732 */
+	"exxphfpu", "exxpliwfjpb", "exxwbiylwisss", "exyma",	/* 3736 */
+	"exzpk", "ey", "eycacfnxpft", "eycehwszdxluof",	/* 3740 */
+	"eyck", "eycl", "eycoggnc", "eyegnuo",	/* 3744 */
+	"eyfjhjogdgzzau", "eyidrzcvk", "eyiufyvcil", "eyjxstyeba",	/* 3748 */
+	"eylqo", "eyltsmn", "eymgdsdn", "eymxgtsydq",	/* 3752 */
+	"eynenixhvw", "eynsf", "eyntuqwzdgsxx", "eyo",	/* 3756 */
+	"eyprnkozfnzvr", "eyrym", "eyugyl", "eyutchrelmuz",	/* 3760 */
+	"eyuyajvdgqlmw", "eyvdx", "eywbgkygfqav", "eywcscn",	/* 3764 */
+	"eyxi", "eyxjuy", "eyxxi", "eyxxoyqvbdq",	/* 3768 */
+	"eyy", "eyyrmpzyhqamz", "eyywdleiq", "eyznctm",	/* 3772 */
+	"eyzogyqhwghs", "ez", "ezacunodx", "ezaeo",	/* 3776 */
+	"ezcnwm", "ezd", "ezdluyxcg", "ezegbq",	/* 3780 */
+	"ezeprhuxnlcm", "ezg", "ezgohejvpz", "ezguzmsonoekj",	/* 3784 */
+	"ezisaqllco", "ezjp", "ezkdssyycfmlr", "ezkiuie",	/* 3788 */
+	"ezkooph", "ezlai", "ezlh", "ezmktxabd",	/* 3792 */
+	"ezmqiix", "ezoepi", "ezqnmaqfc", "ezqpgx",	/* 3796 */
+	"ezrlavfdo", "ezsvvlfjrckkp", "eztjkvorlipvu", "eztyudgwfzd",	/* 3800 */
+	"ezvpkrhlbbdfp", "ezwprutatutly", "ezxpvxr", "ezxstvrlew",	/* 3804 */
+	"ezxuwfqsmbe", "ezxynhjepacbwc", "ezyfmwkhh", "ezzqtwmjl",	/* 3808 */
+	"ezzugcu", "faaivyhakrdu", "fabsxjlvga", "fabwkh",	/* 3812 */
+	"faccujdqv", "factyznv", "fagfxuaws", "fagifjjqinnc",	/* 3816 */
+	"fagtvkkoparb", "fahtbdlnuzwwt", "fai", "faidraovh",	/* 3820 */
+	"faiqtmpkwq", "fajdrxkdn", "fajobemfsmtew", "fajqfmkjbiel",	/* 3824 */
+	"fao", "faomb", "faovim", "faowahdr",	/* 3828 */
+	"faowpmzhz", "fapghqrjqrjvp", "faqio", "faqmclwkp",	/* 3832 */
+	"faquwwas", "faqxvodprhuzw", "faqyfzr", "farhzcvjua",	/* 3836 */
+	"farmdtb", "fascpfszfwm", "fasngd", "fatbqfde",	/* 3840 */
+	"fatglyxnw", "faultmykt", "fausvoet", "fav",	/* 3844 */
+	"favcnqbs", "fayutpqzn", "fazvogulbpxjrm", "fbayjpfgfc",	/* 3848 */
+	"fbazazowyhpbt", "fbcfustrns", "fbe", "fbfj",	/* 3852 */
+	"fbgzp", "fbivooax", "fbkqlsvylxfdht", "fbkwyyoogyw",	/* 3856 */
+	"fbl", "fbmnfqvjjbxei", "fbmusjuxfiunwl", "fbn",	/* 3860 */
+	"fbnkd", "fbogm", "fboyra", "fbpftoyrzuc",	/* 3864 */
+	"fbqggojhpq", "fbqtmjla", "fbqwmdiv", "fbrf",	/* 3868 */
+	"fbruvamydl", "fbtvyccxg", "fbukgiaaewq", "fbxjejvfoji",	/* 3872 */
+	"fbynxuw", "fbzrgi", "fbzsauckrzz", "fc",	/* 3876 */
+	"fcaypz", "fcb", "fcbkzcxgr", "fccknlhscyv",	/* 3880 */
+	"fcdzbo", "fcfz", "fchsxdhs", "fcj",	/* 3884 */
+	"fcjndsl", "fckcx", "fckisz", "fcloy",	/* 3888 */
+	"fcnjccbedefit", "fcpgeayfslh", "fcqjpuuiwzzx", "fcquzdwdeqxay",	/* 3892 */
+	"fcsdqvsra", "fcsl", "fctm", "fcvigowqahxri",	/* 3896 */
+	"fcvlnrn", "fcxcajc", "fcxn", "fcycqerhykfthd",	/* 3900 */
+	"fczjkdxddvc", "fcztlrtde", "fczvpdawev", "fd",	/* 3904 */
+	"fdahar", "fdbinhpzkow", "fdbu", "fdcnmplzpj",	/* 3908 */
+	"fdecnzxqxizbsi", "fdemvi", "fdfsdaqhg", "fdhv",	/* 3912 */
+	"fdibor", "fdiudjcmt", "fdivltusmshdo", "fdiyga",	/* 3916 */
+	"fdjodoww", "fdkhgqpm", "fdlqt", "fdmp",	/* 3920 */
+	"fdo", "fdpgatkm", "fdpyyzyai", "fdrgocoy",	/* 3924 */
+	"fdtnsrmqkknbzb", "fdugkoh", "fdvg", "fdwyopkqpgqe",	/* 3928 */
+	"fdxmctrhlehnjd", "fdxwouncarl", "fdyhto", "fdyna",	/* 3932 */
+	"fdzucsmzw", "fdzvucmh", "feayepdwrwuap", "febklm",	/* 3936 */
+	"fecmohbakmgyf", "feemmni", "fefdukod", "fegdzwbpb",	/* 3940 */
+	"fehyc", "feil", "feingsxy", "fej",	/* 3944 */
+	"fejbcgavbn", "fejpftjkqeawui", "fek", "fekvzpwto",	/* 3948 */
+	"felvvrk", "fem", "feobl", "feozkpfflvakd",	/* 3952 */
+	"feptbwzlj", "fesvirtupsc", "fevh", "fevr",	/* 3956 */
+	"fexcyls", "fexjtsfdua", "ff", "ffa",	/* 3960 */
+	"ffaeicxwuzu", "ffambjhkbbg", "ffaucyw", "ffbfznr",	/* 3964 */
+	"ffbknvu", "ffdsetzbvfzjvm", "ffdz", "ffel",	/* 3968 */
+	"fffgvfnboia", "fffilhaaxqcbx", "ffgukijypycfz", "ffjlonn",	/* 3972 */
+	"ffkxfohjjwksn", "fflfwxy", "ffmwvkgdzib", "ffnfgynzikyv",	/* 3976 */
+	"ffnhhbfzqz", "ffnyeqvesh", "ffodvqfek", "ffrfe",	/* 3980 */
+	"ffrkqoflzj", "ffsecirnp", "fftbknm", "fftiepvvvcabs",	/* 3984 */
+	"fftjau", "ffuvb", "ffvszorl", "ffwlz",	/* 3988 */
+	"ffzbxwtzs", "ffzvjgkbi", "fg", "fgbqslwmxoh",	/* 3992 */
+	"fgcqw", "fgdqnhkdah", "fgeeooezdoo", "fgfmcj",	/* 3996 */
+	"fggrrr", "fggvulz", "fggxgzbpwqrlsf", "fghfqmbihx",	/* 4000 */
+	"fgiqlkbuh", "fgivoohymtsq", "fgjsr", "fglyjadsqmy",	/* 4004 */
+	"fgnex", "fgnpxvn", "fgonjvkx", "fgpaacpdscu",	/* 4008 */
+	"fgpu", "fgpzirfw", "fgqloiyavzpaa", "fgricn",	/* 4012 */
+	"fgsoexpo", "fgt", "fgtfha", "fgtorhf",	/* 4016 */
+	"fgufp", "fguuwnha", "fgwb", "fgwst",	/* 4020 */
+	"fgwueqvlcfj", "fgxyribsoxwyd", "fgxytgbpdobsq", "fgynvlfsaafuoz",	/* 4024 */
+	"fgzbl", "fgzjnnepp", "fgzubffta", "fh",	/* 4028 */
+	"fhbdphje", "fhcgioepfnlja", "fhdcfftbjza", "fhdsbyxbhwekv",	/* 4032 */
+	"fhdvfmccmw", "fhe", "fhecwxi", "fhfmr",	/* 4036 */
+	"fhfquowse", "fhg", "fhgqv", "fhgvm",	/* 4040 */
+	"fhgyydczw", "fhhjorsmgowikp", "fhiowazjx", "fhjippt",	/* 4044 */
+	"fhktcujdwzcs", "fhm", "fhofqjrjvuzqft", "fhoysmgzsklssn",	/* 4048 */
+	"fhpiuamhzmx", "fhpxguerxfupe", "fhqsc", "fhrytvnwddl",	/* 4052 */
+	"fhs", "fhsoiqzzozuee", "fhstodagsluu", "fhv",	/* 4056 */
+	"fhvcxpzjp", "fhxbvaft", "fi", "fiaal",	/* 4060 */
+	"fiabgo", "fiasbxvezweyqx", "fibaurolv", "ficqfvvqlvs",	/* 4064 */
+	"ficrppmy", "ficszthr", "fidc", "fidyyadi",	/* 4068 */
+	"fiehtuzxhh", "fig", "figxvepsjznmg", "fihrnmfemsko",	/* 4072 */
+	"fik", "fil", "fimtplreufh", "finycfimuad",	/* 4076 */
+	"finyydjxzpscgw", "fioauhqwdpq", "fipp", "fiqxlllym",	/* 4080 */
+	"fismbxkhvla", "fiulbyzjgmuuc", "fivrhowneyfsz", "fiwsfadagnpur",	/* 4084 */
+	"fj", "fjbzoyov", "fjc", "fjcif",	/* 4088 */
+	"fjdmz", "fjdxb", "fjevwkyvaoof", "fjhxyohg",	/* 4092 */
+	"fji", "fjkuro", "fjljkekgoc", "fjlun",	/* 4096 */
+	"fjmbwpij", "fjmfot", "fjmgpcappowsu", "fjmmstucuiff",	/* 4100 */
+	"fjmnjnniugr", "fjrafjot", "fjrqiahcqyypl", "fjrrq",	/* 4104 */
+	"fjsd", "fjtfflknvzzlu", "fjthcmxkufjlki", "fjudtfj",	/* 4108 */
+	"fjutduocy", "fjvotlozuauj", "fjxd", "fjxukezgivbq",	/* 4112 */
+	"fk", "fka", "fkaml", "fkaot",	/* 4116 */
+	"fkbhcjrdppl", "fkbzvklsyp", "fkcq", "fkczzmieujrra",	/* 4120 */
+	"fkd", "fkdxs", "fkdyp", "fkef",	/* 4124 */
+	"fkhog", "fkhxahsdrie", "fkicop", "fkifmsmvkbbwjp",	/* 4128 */
+	"fkiujtr", "fkj", "fkjfvm", "fkjjcr",	/* 4132 */
+	"fkjrxgkbcmqknk", "fkkmxho", "fkkplbhqxw", "fklchrfdez",	/* 4136 */
+	"fkmgxdk", "fkmoo", "fkndh", "fknhh",	/* 4140 */
+	"fknxspyx", "fkoavuepzmgvi", "fkofwxtei", "fkokauo",	/* 4144 */
+	"fkouiwrbknqsb", "fkp", "fkqaholn", "fksdk",	/* 4148 */
+	"fktinmsahh", "fkuusq", "fkveamsiiugsyj", "fkvqg",	/* 4152 */
+	"fkw", "fkxmxdtgt", "fkydcd", "fkyerhmn",	/* 4156 */
+	"fkylytkxmliga", "fkz", "fkzejeb", "fkzgt",	/* 4160 */
+	"flcxownsfyapgb", "fldqigzjl", "fldsibhh", "flg",	/* 4164 */
+	"flgzbls", "flhrgarrr", "flifbcgnfpuv", "flijxmishwhf",	/* 4168 */
+	"flj", "flji", "fljlwh", "fljx",	/* 4172 */
+	"flksgxrgpbplx", "fllux", "flm", "flmofxf",	/* 4176 */
+	"flnyhvgaolqszb", "floanrdszs", "floj", "flox",	/* 4180 */
+	"flq", "flqou", "flqutqgr", "flrtq",	/* 4184 */
+	"fls", "fltexh", "fltmdrkbvl", "fltsmoq",	/* 4188 */
+	"flvfkjpmuej", "flwsr", "flwsvjcrjbbakh", "flxqkyjcbs",	/* 4192 */
+	"fm", "fmbmxashwx", "fmbsm", "fmbwecjnfhmbk",	/* 4196 */
+	"fmdb", "fmeen", "fmetuslyjsktne", "fmffq",	/* 4200 */
+	"fmfvsutghdiz", "fmilnqanksf", "fmirun", "fmjyvxuhkcyt",	/* 4204 */
+	"fmkmuuqvhjntr", "fmllyjigzldlt", "fmmaag", "fmmmjljcbdv",	/* 4208 */
+	"fmnfw", "fmof", "fmrlce", "fmrmsuolfsq",	/* 4212 */
+	"fmrvdwbb", "fmrxnzesqf", "fmsc", "fmtmofxvq",	/* 4216 */
+	"fmtu", "fmvhfpfhnrm", "fmwhdhkkvhzv", "fmwjjjadhfkjh",	/* 4220 */
+	"fmwopknu", "fmwotyiz", "fmwuetndsvdu", "fmyccxmmn",	/* 4224 */
+	"fnaehhtx", "fnbnx", "fnbtltf", "fnd",	/* 4228 */
+	"fnevstsf", "fnfqoc", "fnfrqyqx", "fngnkggmyf",	/* 4232 */
+	"fngscwrqdwt", "fnhkzzjecwxxyw", "fnhowncsctfe", "fnidmqxoygrppx",	/* 4236 */
+	"fniflqplqrwa", "fnjwvwigf", "fnlgl", "fnngfqqnntzjs",	/* 4240 */
+	"fnntgetnvbiqh", "fnp", "fnqsvlvjs", "fnrgva",	/* 4244 */
+	"fnsihyxs", "fnwmvzxlnqaxe", "fnxrq", "fnxrr",	/* 4248 */
+	"fnxwiqafstc", "fnzcohmbuig", "fnzdxawfpzg", "fo",	/* 4252 */
+	"foagmj", "foancllpwpt", "foarnn", "fob",	/* 4256 */
+	"foblhln", "focednfsz", "fociejyyewtup", "focorn",	/* 4260 */
+	"fodqvcvcwgkq", "foeeiqmwcqdcw", "foezzqgigatk", "foff",	/* 4264 */
+	"foixxwluz", "fojbmytwjff", "fokjbtpowmcpv", "fokqbnuhhvm",	/* 4268 */
+	"fokxf", "folmekydqzmf", "fomluz", "foozmf",	/* 4272 */
+	"foqpbjzpd", "forgedkvv", "fotfe", "fougpubqvbjo",	/* 4276 */
+	"foyziljjcw", "fozmdidzrvbyz", "fp", "fpabaqiaxbuqgz",	/* 4280 */
+	"fpbggtmxpkw", "fpbpdvrseeocuv", "fpe", "fpfqi",	/* 4284 */
+	"fpfwk", "fpfymkxuwzfs", "fpghnd", "fph",	/* 4288 */
+	"fpi", "fpifmyp", "fpjfag", "fpjxsqaopvtcvc",	/* 4292 */
+	"fpl", "fpmnyfn", "fpngjubgwjg", "fpoe",	/* 4296 */
+	"fpouqshifjhui", "fpox", "fpplpkfmm", "fpqkiwadiigw",	/* 4300 */
+	"fpqwl", "fprumlfwupqu", "fpsklm", "fpspj",	/* 4304 */
+	"fpsxosgzqjjo", "fpukdfmbzouzyo", "fpulczwo", "fpuzpktkj",	/* 4308 */
+	"fpw", "fpxmgxrkh", "fpyezzgnl", "fpzbyxywl",	/* 4312 */
+	"fpzitkwh", "fpzxubgkzmahf", "fq", "fqary",	/* 4316 */
+	"fqbakdpqunooxs", "fqbdcibei", "fqcmlk", "fqegxaeg",	/* 4320 */
+	"fqeldrmmbzor", "fqgbtsq", "fqgyyifyfqqzca", "fqhwjgdvo",	/* 4324 */
+	"fqinx", "fql", "fqlkvorkvhk", "fqlwd",	/* 4328 */
+	"fqmfchalw", "fqqyhizlyer", "fqrwpmrtmsux", "fqsoknawceq",	/* 4332 */
+	"fqtwvk", "fqubbrul", "fqufnwrnnzrfq", "fquutf",	/* 4336 */
+	"fqvvrmqaazp", "fqxcrk", "fqy", "fr",	/* 4340 */
+	"frahiciimn", "fraqq", "fratfbsb", "frdngj",	/* 4344 */
+	"fregomtlqwop", "frevddg", "frf", "frg",	/* 4348 */
+	"frgi", "frhgacsphdkal", "fricjsjqyveftn", "frimegib",	/* 4352 */
+	"friucfbry", "frlidub", "frlkz", "frlviweznxgue",	/* 4356 */
+	"frnqnzaabjayox", "frnti", "frnwquunb", "froujr",	/* 4360 */
+	"frrbiajcxaojtd", "frrfsis", "frsj", "frsr",	/* 4364 */
+	"frtiitaeasupc", "frtzyn", "frv", "frvmxxrrkmm",	/* 4368 */
+	"frxcuzwjvpynm", "frxjgni", "fryentxtc", "frygb",	/* 4372 */
+	"frymptizyr", "frzssdszjnl", "frzt", "fs",	/* 4376 */
+	"fsawhhush", "fsblmkibw", "fsbmi", "fsd",	/* 4380 */
+	"fsenzj", "fsfauacdq", "fsfujnqhgewxi", "fsgskmi",	/* 4384 */
+	"fsiaigwvdpb", "fskbehk", "fskcsajdibhhpf", "fslget",	/* 4388 */
+	"fsmwk", "fspcsrkl", "fsppjmkpz", "fspvfskua",	/* 4392 */
+	"fssgmaqg", "fstarlmlbxcqiw", "fsvbtrefb", "fsvepkhhnwgk",	/* 4396 */
+	"fsvlkiqdw", "fswd", "fswftuhsov", "fsxdz",	/* 4400 */
+	"fsyhbyohpuef", "fszjfnzeibn", "ft", "ftahttkclo",	/* 4404 */
+	"ftaye", "ftbyxafixnzap", "ftc", "ftdrjzolrkchyb",	/* 4408 */
+	"ftfpj", "ftftbxcqespf", "ftiexxvozsfzu", "ftilt",	/* 4412 */
+	"ftjc", "ftjiyikimssq", "ftjjis", "ftjxfpdhffizsl",	/* 4416 */
+	"ftkwhrspmzsqy", "ftmd", "ftnadi", "ftnvqgrnybje",	/* 4420 */
+	"ftoc", "ftpbsuhpgzcif", "ftpi", "ftpojgoe",	/* 4424 */
+	"ftpvmtrznslvx", "ftqlalnjyxsoli", "ftraodaoxhxfhc", "ftsxbmjbmiadx",	/* 4428 */
+	"ftvjt", "ftwg", "ftwxnzdfdmgdsn", "ftwzdptejybj",	/* 4432 */
+	"ftzcozrkbhv", "fu", "fuan", "fubedkshfuhs",	/* 4436 */
+	"fucgbfwuxm", "fuckbedmx", "fucle", "fuclyrjutsxh",	/* 4440 */
+	"fucnwggnrojl", "fuejvhvxdjaqnh", "fufx", "fufztpcqo",	/* 4444 */
+	"fuhap", "fuhjtzrbbm", "fui", "fuitwiaczvvm",	/* 4448 */
+	"fuk", "fulqhkthhuywgj", "fum", "fumcpswklsb",	/* 4452 */
+	"fuogsxz", "fupogq", "fuqbg", "furlzm",	/* 4456 */
+	"futqupclxtdmc", "fuuoauumpl", "fuyiycgacxqwf", "fuzbat",	/* 4460 */
+	"fv", "fvbobgeyyobxeu", "fvcnybit", "fvduqw",	/* 4464 */
+	"fveiupdspiefa", "fveom", "fveou", "fvfeyq",	/* 4468 */
+	"fvflhqaxxt", "fvguaoxu", "fvmdfvhwpvs", "fvmifyyds",	/* 4472 */
+	"fvoplhrcupepnq", "fvpkaxkvkjvum", "fvqrs", "fvucyizt",	/* 4476 */
+	"fvumiub", "fvvtzweqweoft", "fvxv", "fvxzxuyecekeau",	/* 4480 */
+	"fvya", "fvysfngk", "fvzh", "fw",	/* 4484 */
+	"fwajh", "fwamtt", "fweaqk", "fwetr",	/* 4488 */
+	"fwfhp", "fwfvdrmzg", "fwigjo", "fwixf",	/* 4492 */
+	"fwkcej", "fwkulwb", "fwn", "fwng",	/* 4496 */
+	"fwnm", "fwoaeao", "fwpmmxni", "fwpwdphfmmgd",	/* 4500 */
+	"fwrrewcwgskksc", "fwrztyqqc", "fwshotrrsgriku", "fwsppwuwtqy",	/* 4504 */
+	"fwsrjvfhbrux", "fwstmsjpb", "fwtavshqda", "fwtibltbdzhp",	/* 4508 */
+	"fwtphgpuviq", "fwu", "fwuorfcjp", "fwupstu",	/* 4512 */
+	"fww", "fwwacml", "fwwbvcfjjllupi", "fwypcmypkpd",	/* 4516 */
+	"fwzhqrxdc", "fwziixbh", "fwzk", "fwzwyuicdvpkb",	/* 4520 */
+	"fxazwqhiersikk", "fxbiexnby", "fxbly", "fxd",	/* 4524 */
+	"fxdnm", "fxeanhlmgqs", "fxemtnjke", "fxerrgqpyyrny",	/* 4528 */
+	"fxfbzdwnqdvgyt", "fxfsjyaljta", "fxfu", "fxhizlhwfpq",	/* 4532 */
+	"fxicqwvuvvonxp", "fxikkx", "fxj", "fxjydkymfwhqvd",	/* 4536 */
+	"fxlwmgodp", "fxnop", "fxnxg", "fxohg",	/* 4540 */
+	"fxquofqvaotvne", "fxrtmggc", "fxsmhttpqiosxd", "fxufqytlo",	/* 4544 */
+	"fxupkjndhraguq", "fxwct", "fxwtr", "fxxqqrkj",	/* 4548 */
+	"fxxztzjozxp", "fxygeihtwlddbr", "fy", "fyarbz",	/* 4552 */
+	"fyba", "fybvgsvpsf", "fycqzb", "fycz",	/* 4556 */
+	"fydjzldjfw", "fyfjqtr", "fyhnavsoyydwqo", "fyieggphtnscz",	/* 4560 */
+	"fyjwqkqgu", "fykca", "fykemnkruwqig", "fykpazor",	/* 4564 */
+	"fykpkfkprkxbr", "fymxxvama", "fyowvekg", "fypmq",	/* 4568 */
+	"fyprai", "fyteqop", "fyukfbarwujno", "fyuzcqhex",	/* 4572 */
+	"fyvkxfbte", "fyxtcx", "fyylebr", "fyyyqxsuljjmn",	/* 4576 */
+	"fz", "fzaxco", "fzaxn", "fzbijbspyw",	/* 4580 */
+	"fzbs", "fzclycbbejufwg", "fzcwlxgsywurd", "fzcyn",	/* 4584 */
+	"fzdbhe", "fzeuddn", "fzfce", "fzfij",	/* 4588 */
+	"fzgkfgfcamczq", "fzhwqmawodcteo", "fzhyptddk", "fzidkeuc",	/* 4592 */
+	"fzioshzymmuv", "fzjalcxnw", "fzjpkqd", "fzjwzc",	/* 4596 */
+	"fzlkb", "fzmk", "fzmlyksfvbuocq", "fznhoqw",	/* 4600 */
+	"fzosd", "fzozwjjqntzhy", "fzpdzyjwi", "fzprbi",	/* 4604 */
+	"fzpvc", "fzql", "fzqykwdxyacb", "fzrtfswxpjv",	/* 4608 */
+	"fztex", "fztph", "fzupscrg", "fzvemvhrmt",	/* 4612 */
+	"fzxrwpppdqgtj", "fzyaoherg", "fzzzld", "ga",	/* 4616 */
+	"gabqfvkspvfn", "gacnepad", "gaeqezpxmka", "gafbfjmonwkd",	/* 4620 */
+	"gagcjdgdzzmz", "gagtehcyrwkx", "gagxk", "gah",	/* 4624 */
+	"gahur", "gaiphxgs", "galvnp", "gamv",	/* 4628 */
+	"gao", "gaoqqbdrfkmjv", "gaqeckt", "gaqfrjqhwk",	/* 4632 */
+	"garjbzlnwxfw", "garjx", "gasfn", "gasop",	/* 4636 */
+	"gaupzkpnftkxh", "gauwibtmqa", "gavy", "gaxie",	/* 4640 */
+	"gaznoorayh", "gazuowgtmjekl", "gb", "gbbe",	/* 4644 */
+	"gbc", "gbcug", "gbdmrpxhcvlxy", "gbdukggzzp",	/* 4648 */
+	"gbfiy", "gbgdotks", "gbh", "gbhjksmhlybhjw",	/* 4652 */
+	"gbibbhv", "gbjc", "gbjcrw", "gbjcwvfeqsfkk",	/* 4656 */
+	"gbjtwnazdlsbhf", "gbk", "gblvzujvc", "gbn",	/* 4660 */
+	"gbngknwhs", "gbnwkyx", "gbo", "gbomqil",	/* 4664 */
+	"gbpgpc", "gbpuyuqmoo", "gbqkkccld", "gbqpxqqkosnal",	/* 4668 */
+	"gbrjyealc", "gbrlrhrz", "gbrpjbitgwp", "gbtzyn",	/* 4672 */
+	"gbucvrere", "gbuefqbwb", "gbxaiprcc", "gbxzsdukitse",	/* 4676 */
+	"gc", "gcanz", "gccva", "gcdr",	/* 4680 */
+	"gcejauhfy", "gcfu", "gcgile", "gchs",	/* 4684 */
+	"gchzpa", "gcjdkp", "gcl", "gclozmq",	/* 4688 */
+	"gcnpvsh", "gcouugtkfswvw", "gcpujsuscu", "gcqjikodgr",	/* 4692 */
+	"gcrogagmx", "gcszluxnendmf", "gcveh", "gcxlnjkey",	/* 4696 */
+	"gcxrfduq", "gcze", "gczsr", "gd",	/* 4700 */
+	"gdafiwonmo", "gdavqdpnao", "gdaxmevsjd", "gdbosuex",	/* 4704 */
+	"gdcjwchrdf", "gddpejznyvxpe", "gddxisqonxr", "gderdvijz",	/* 4708 */
+	"gdgdutzjfaogdc", "gdgfk", "gdgofsklw", "gdgyxpo",	/* 4712 */
+	"gdhfljoytkvs", "gdhjp", "gdixcz", "gdjz",	/* 4716 */
+	"gdldbeqjbnqgqf", "gdmlutc", "gdmrshpl", "gdnotaahl",	/* 4720 */
+	"gdomctvunlibgw", "gdowzzrwyojtrw", "gdpg", "gdrwlvwffptyc",	/* 4724 */
+	"gdscazrstnvj", "gdsgbh", "gducqthbsa", "gdudabuny",	/* 4728 */
+	"gduln", "gdvfppynzfndb", "gdvq", "gdwezvvcqf",	/* 4732 */
+	"gdxfozrbfd", "gdz", "gdzzntcjweiph", "ge",	/* 4736 */
+	"geauwj", "geaxfansiiyax", "gebixayoov", "gebjaclssbsyeb",	/* 4740 */
+	"gebpnvsl", "gedllpsier", "gedroghiyue", "geffsulqp",	/* 4744 */
+	"gefuvrjdvcccw", "gegupsfvhpmi", "gehx", "gekdldxlepqxzr",	/* 4748 */
+	"gekrlh", "gekxw", "gelgrhlboyep", "gendphfsijrg",	/* 4752 */
+	"geoemkiwh", "geofo", "gepslssrtwizig", "gepwckrkpc",	/* 4756 */
+	"geq", "geqhxjtbkuluti", "gesxhtzzdnclgt", "getmkq",	/* 4760 */
+	"getosnspfcanr", "gewfjwv", "gewmomt", "gewwdr",	/* 4764 */
+	"gexiqn", "geyjquxdodrgc", "gez", "gezovjw",	/* 4768 */
+	"gf", "gfakhpnp", "gfanbhbm", "gfbgmzbkkkvoqh",	/* 4772 */
+	"gfbkpnqu", "gfcvdjgixejpi", "gfdbuvof", "gfdkcjtgms",	/* 4776 */
+	"gffsa", "gfgkwq", "gfguukk", "gfgzajvl",	/* 4780 */
+	"gfkdvmudbb", "gfkp", "gflbatgpkboqvz", "gfnl",	/* 4784 */
+	"gfokudm", "gfoplgbz", "gfqwkgrslj", "gfsfjo",	/* 4788 */
+	"gfsmfngxkqqke", "gftqgqmql", "gftu", "gfu",	/* 4792 */
+	"gfvwixhbup", "gfxal", "gfxktuulutjpc", "gfyjp",	/* 4796 */
+	"gg", "ggbnytjniqmqm", "ggcbttjm", "ggclqs",	/* 4800 */
+	"ggcw", "ggdphrq", "ggecokdxq", "ggf",	/* 4804 */
+	"ggfermtsgxatl", "gghijmmxre", "ggips", "ggisdzomeri",	/* 4808 */
+	"ggjbbkrv", "ggkpoabjeqm", "ggkziajthn", "ggmlyvohjxynp",	/* 4812 */
+	"ggnbzcgoh", "ggnh", "ggoxmqwokgvb", "ggqe",	/* 4816 */
+	"ggqglghozpj", "ggrx", "ggsauhrrh", "ggsdm",	/* 4820 */
+	"ggwomxh", "ggwxtasphizr", "ggylmxq", "ggztifzlfck",	/* 4824 */
+	"gh", "ghacgxhnafy", "ghdilo", "ghdjkgppinyjz",	/* 4828 */
+	"ghgzej", "ghhxdufiatfo", "ghiewwq", "ghjhrlzdm",	/* 4832 */
+	"ghkgzavah", "ghkkzugiupyfms", "ghl", "ghlcxpdet",	/* 4836 */
+	"ghljpkarlrjr", "ghm", "ghmbdzwipcbis", "ghofyfer",	/* 4840 */
+	"ghqabjxinvlqp", "ghsywpwaz", "ght", "ghtvegmwewgn",	/* 4844 */
+	"ghu", "ghuw", "ghwbi", "ghxhvxljgeltez",	/* 4848 */
+	"ghxqelvvohpb", "ghydcupbjtnvc", "ghyhvcgotifbp", "ghyijztuoze",	/* 4852 */
+	"ghyymb", "ghzoiev", "gi", "gian",	/* 4856 */
+	"giao", "giaoq", "giat", "gibpxcldn",	/* 4860 */
+	"gifeekcotk", "gigu", "gij", "gijsks",	/* 4864 */
+	"gikjpjyeuzm", "giljm", "gilngwjoqjow", "gimpyhnkaauk",	/* 4868 */
+	"gimqk", "gimxmrawvzy", "gimy", "ginosqmmvdk",	/* 4872 */
+	"ginqoabafmnyg", "gintclslvglh", "giouz", "gipfxvoterkf",	/* 4876 */
+	"gipkbddh", "gipmkoxztb", "giqgxn", "gis",	/* 4880 */
+	"git", "gitmstryxa", "gitprzxbwt", "gitvypslwgrmzk",	/* 4884 */
+	"gitxrn", "giueoskyklpimy", "giuhcnwlwlyyg", "giwclpjaa",	/* 4888 */
+	"gixdyt", "gixgmye", "gj", "gjascziqlymc",	/* 4892 */
+	"gjcpant", "gjcxdvih", "gjfxeumnplwybr", "gjgmkjyqgskr",	/* 4896 */
+	"gjgpedibf", "gjhahzgn", "gjhlfvgs", "gjhnacd",	/* 4900 */
+	"gjhwfqen", "gjhyebqvljuyzu", "gjiexwalt", "gjjwjrlfwwxotc",	/* 4904 */
+	"gjkelbvzruly", "gjmkjhdrdt", "gjmm", "gjmtmyyoaieehx",	/* 4908 */
+	"gjmztoyn", "gjnfkxcrjyu", "gjnpwgwth", "gjozor",	/* 4912 */
+	"gjpwcc", "gjqaqnzejemv", "gjqzlahlujw", "gjrj",	/* 4916 */
+	"gjstedtjtl", "gjtoknvwkutvra", "gjuvzf", "gjvlltp",	/* 4920 */
+	"gjxdaze", "gjyn", "gjzdzads", "gk",	/* 4924 */
+	"gkabcdifrjrvru", "gkbjpdb", "gkbyylolme", "gkcuixqyvdp",	/* 4928 */
+	"gkcwjxs", "gkcxq", "gkhhjaipch", "gkhqqvfwhpout",	/* 4932 */
+	"gki", "gkjlkdawoypq", "gkkgwdw", "gklsytazbf",	/* 4936 */
+	"gkobeqlsyqbar", "gkpgeplywmdigb", "gkpgpnfd", "gksbbyfqotrbv",	/* 4940 */
+	"gktbygfxuqo", "gkterhtahwplue", "gktppkdeewihcu", "gkv",	/* 4944 */
+	"gkvjacnsusb", "gkxpyu", "gkycz", "gkzx",	/* 4948 */
+	"gl", "gladpvibxd", "glaucnzg", "gle",	/* 4952 */
+	"glejjdcsalzp", "glfeabcveldgm", "glgobwbhjgryfg", "glia",	/* 4956 */
+	"gljaqr", "gljj", "gljoqfqnojmd", "gljtnj",	/* 4960 */
+	"gljywqyfad", "glkytmmkpej", "gll", "glloqmgboh",	/* 4964 */
+	"gllxs", "glmuje", "glmzvhtaxes", "glpgkmwlh",	/* 4968 */
+	"glqimndjenu", "glrgxeswdkf", "glrs", "glsqpi",	/* 4972 */
+	"glswbpifq", "gltbejcyc", "gltcyilcw", "gluh",	/* 4976 */
+	"gluxb", "gly", "glyehhti", "glzctuvcmu",	/* 4980 */
+	"glzpscafft", "gm", "gmavopdbzzwnxw", "gmb",	/* 4984 */
+	"gmbh", "gmefhcmbfk", "gmfceiakmlokt", "gmftwxtcgzzs",	/* 4988 */
+	"gmfyue", "gmgxqho", "gmisacwvbf", "gmjvcnbsc",	/* 4992 */
+	"gmkcjg", "gmlwjxi", "gmndivrz", "gmnrb",	/* 4996 */
+	"gmnuwslctellv", "gmoq", "gmpjbz", "gmpvlmsaxr",	/* 5000 */
+	"gmrtxofhq", "gmrxtlg", "gmt", "gmtdrg",	/* 5004 */
+	"gmuath", "gmuqzlg", "gmuruwawhbr", "gmwphqdclwkp",	/* 5008 */
+	"gmxm", "gmy", "gmysmpb", "gn",	/* 5012 */
+	"gnakntszax", "gnbncehnew", "gnbqkrywllvwnh", "gnbxfywv",	/* 5016 */
+	"gncqzpt", "gndfueoe", "gndk", "gneixvqipfudx",	/* 5020 */
+	"gnernsjlyqma", "gnfxqzsbmupiv", "gnl", "gnmu",	/* 5024 */
+	"gnn", "gnnwdvwenkqf", "gnrxdak", "gnsntvksefzon",	/* 5028 */
+	"gnssgiyoagcm", "gnsvtktpy", "gnuhebiccioblo", "gnuodwdil",	/* 5032 */
+	"gnuuiebbh", "gnveyosxhnls", "gnvgdgnrxkte", "gnwqthljm",	/* 5036 */
+	"gnyeqrcm", "gnzerlltp", "go", "goalsz",	/* 5040 */
+	"goattemaitcd", "gobaaxhzuqbv", "gobdmc", "gobpiclpcqong",	/* 5044 */
+	"gobsyrs", "gobv", "gocrbou", "godubywary",	/* 5048 */
+	"gofbbhxiyqa", "goglaosywmcx", "gogqaxmlk", "gohgudcmere",	/* 5052 */
+	"gohpjcqidmcsn", "gohqf", "gohu", "gohwtndnurtzs",	/* 5056 */
+	"goi", "gokyadofayc", "golun", "gon",	/* 5060 */
+	"gondfm", "gonkvakf", "gonrzzx", "gonywqbg",	/* 5064 */
+	"gop", "gorzigavnuhgl", "gos", "gouedwdnboelrk",	/* 5068 */
+	"govcozpk", "govmmyrghnn", "goxszfxzrqtfb", "goy",	/* 5072 */
+	"gozkdvkowzbe", "gozmrtfz", "goztuxjqwgcokl", "gp",	/* 5076 */
+	"gpbcijjqlgoxzf", "gpcgtltcmcn", "gpcktn", "gpcvtwlenttku",	/* 5080 */
+	"gpeglpwjkurvu", "gpemybufsw", "gpgijsrqih", "gpgqacf",	/* 5084 */
+	"gpkkywwhgffk", "gpnjwfhzzwuuz", "gpo", "gpojenhpme",	/* 5088 */
+	"gppnwqio", "gprb", "gprtjl", "gpswydjpdppg",	/* 5092 */
+	"gpubambzzna", "gpump", "gpvy", "gpwhltquwf",	/* 5096 */
+	"gpwpc", "gpyvqxvpnzysd", "gpzenoyoitolg", "gqbpb",	/* 5100 */
+	"gqbpzlfomfic", "gqbqarbxwp", "gqbqpj", "gqg",	/* 5104 */
+	"gqhhgmnjcfobav", "gqidmcpqjrc", "gqivkkkricqhbc", "gqjbjbknp",	/* 5108 */
+	"gqkeihvrcbbf", "gqlasgyif", "gqlfaagpkxzxpj", "gqmdtvedzkhng",	/* 5112 */
+	"gqmhkypkrzqc", "gqofmnmxyq", "gqphjkhbutql", "gqqey",	/* 5116 */
+	"gqreqb", "gqrrjuadpwn", "gqrygjkqvldb", "gqsdyuyb",	/* 5120 */
+	"gqtjji", "gqtlhucmm", "gqwfjutj", "gqwidtrftqr",	/* 5124 */
+	"gqx", "gqxqbizpdi", "gqxxzsw", "gqy",	/* 5128 */
+	"gr", "graiutxx", "grcrkkjqebolzx", "gre",	/* 5132 */
+	"grghmfdq", "grgtdpynvlcz", "grhhzhjnnrmgy", "grkamd",	/* 5136 */
+	"grkwoi", "grl", "grlvayzeidw", "grlyicgcl",	/* 5140 */
+	"grnwhseromw", "grrauiyquzlr", "grrscvn", "grsgvy",	/* 5144 */
+	"grszqbckq", "grtcutcbi", "grw", "grwyxncyypfyi",	/* 5148 */
+	"grxx", "grymborgqqrp", "grz", "grzdgdyevfwd",	/* 5152 */
+	"gs", "gsakvcte", "gsdhox", "gseenurdvkdg",	/* 5156 */
+	"gseflu", "gsfnplthasgnwd", "gsgxscbyqflf", "gsh",	/* 5160 */
+	"gsitninfh", "gsivjwhznhiohb", "gsjivgo", "gskpg",	/* 5164 */
+	"gsnjtheqbt", "gsnkzzrz", "gsnpytphl", "gso",	/* 5168 */
+	"gsofywtqbmg", "gsopmjlyyft", "gsouhwgefju", "gspyxxxey",	/* 5172 */
+	"gspzcore", "gsqcddrbjf", "gsqtrjrg", "gsrvuthlktxwk",	/* 5176 */
+	"gsszmvav", "gstrflkshnny", "gsvhepdl", "gswep",	/* 5180 */
+	"gsyejiwrbbiv", "gszbrsaumjtjy", "gszrjfqi", "gt",	/* 5184 */
+	"gtaqvfdkl", "gtdhafltwupyd", "gte", "gtfk",	/* 5188 */
+	"gtfol", "gthpigueapbo", "gtit", "gtjxv",	/* 5192 */
+	"gtkgdmxwbvexx", "gtkploly", "gtlhkcoep", "gtnahamebx",	/* 5196 */
+	"gtnyrttc", "gtomq", "gtowpnkuo", "gtqtupenra",	/* 5200 */
+	"gtrkegiqqyr", "gttanimnrnnr", "gttoggjeurvo", "gtuaenl",	/* 5204 */
+	"gtvbnbfsdk", "gtvkhipjykf", "gtwdhyaqr", "gtxetatisaawro",	/* 5208 */
+	"gtyxhujxv", "gu", "guajusc", "guauabwzg",	/* 5212 */
+	"gubw", "gufmxkgg", "gugzezgdx", "guhbmdgzqiyagw",	/* 5216 */
+	"guheq", "guhwbcbbgyl", "gukfwkja", "gulflldic",	/* 5220 */
+	"guoqyb", "guoszmpftftkte", "guouutdhuaoy", "guowjpjjdma",	/* 5224 */
+	"guptgdwsvk", "guqf", "guriscyxmzseo", "gurmxdjvsdxtlx",	/* 5228 */
+	"gutdhbxalaq", "gutraavcvzykw", "gutwcabmidvec", "gutznqbvkayjo",	/* 5232 */
+	"guvfwm", "guvslrkvya", "guwfg", "guwxpmawsoy",	/* 5236 */
+	"guwyqc", "guxlo", "guyvpcmrx", "guyxcgcimtccn",	/* 5240 */
+	"gv", "gvbibexbftrioa", "gvbjdpmht", "gvbxu",	/* 5244 */
+	"gvdg", "gvez", "gvf", "gvfbxhk",	/* 5248 */
+	"gvfceebz", "gvfncld", "gvfphpckbp", "gvhyediraa",	/* 5252 */
+	"gviashldh", "gvigeqcqxvxtit", "gvjhdgtp", "gvju",	/* 5256 */
+	"gvlocohdm", "gvlx", "gvmsdxlwnqe", "gvn",	/* 5260 */
+	"gvohdabtjwbiom", "gvracxprr", "gvsu", "gvtamohqoqjk",	/* 5264 */
+	"gvv", "gvvwncwd", "gvyieojfgei", "gvzkghf",	/* 5268 */
+	"gw", "gwangghrbdlaf", "gwaoyowaejavcj", "gwb",	/* 5272 */
+	"gwbgn", "gwblkzzaqhayws", "gwbmmift", "gwetgydohdcdl",	/* 5276 */
+	"gwhklyevclovof", "gwkwoiwici", "gwmsj", "gwmt",	/* 5280 */
+	"gwo", "gwq", "gwqwturchmyod", "gwrhezm",	/* 5284 */
+	"gwscob", "gwskyrpdesjse", "gwunlb", "gwvwiqj",	/* 5288 */
+	"gwzleaubve", "gwzmg", "gwzodygb", "gwzud",	/* 5292 */
+	"gx", "gxaerdsd", "gxaftae", "gxbd",	/* 5296 */
+	"gxbhivwblppzto", "gxcah", "gxdcd", "gxdcrhjfyddxbi",	/* 5300 */
+	"gxff", "gxgnzfky", "gxkfyno", "gxkksayd",	/* 5304 */
+	"gxmjj", "gxmxzom", "gxo", "gxolspmfe",	/* 5308 */
+	"gxoqybez", "gxoyoichj", "gxqkpro", "gxqvzduj",	/* 5312 */
+	"gxqwg", "gxrdurx", "gxskiazxbv", "gxupanfwha",	/* 5316 */
+	"gxut", "gxweg", "gxwtf", "gxydpqf",	/* 5320 */
+	"gxytrjzzombu", "gy", "gyagkr", "gybluzuzhv",	/* 5324 */
+	"gybmqeh", "gydlcxerqard", "gydlkofixrlcx", "gyfognl",	/* 5328 */
+	"gygjbpgla", "gygv", "gyhu", "gyhwruqtvk",	/* 5332 */
+	"gyiuedbrnvu", "gykcniwvyhbj", "gykzasuftnj", "gylwfjvn",	/* 5336 */
+	"gymjpjrwtbihk", "gymjxpabjjgz", "gyngxnlhqicafw", "gyo",	/* 5340 */
+	"gypbkrszcnus", "gyprkycvuzszy", "gyq", "gyqejrlcccd",	/* 5344 */
+	"gyt", "gyttbrmhdvxcqq", "gytybu", "gyveedersan",	/* 5348 */
+	"gyvpzeuzyodhit", "gyw", "gywxevcyhsxg", "gyyeb",	/* 5352 */
+	"gyyrgyg", "gyzhujvvvtmgal", "gyzofxzhwy", "gyzsipzwm",	/* 5356 */
+	"gz", "gzakqjlcnr", "gzbuo", "gzbxdretly",	/* 5360 */
+	"gzeuk", "gzf", "gzg", "gzjwfdumv",	/* 5364 */
+	"gzlzldtmij", "gzmwermwlldpj", "gznrynpxghdv", "gznsrvbxecopk",	/* 5368 */
+	"gzphgsfod", "gzpumpmkum", "gzq", "gzqyurd",	/* 5372 */
+	"gzrdlt", "gztyrw", "gzu", "gzuafnqe",	/* 5376 */
+	"gzuqcssvgx", "gzvdamggucgvya", "gzvezhyzk", "gzvnjtjuh",	/* 5380 */
+	"gzxsckv", "gzydsgybpxgckc", "gzyjtyrhf", "gzylersqnuokm",	/* 5384 */
+	"gzyxoamsg", "gzzgx", "gzzichgqubsxx", "gzzwjkdu",	/* 5388 */
+	"ha", "hacbafjp", "hacd", "haeaeu",	/* 5392 */
+	"haeynlizpbmd", "hafdlixtnoz", "hafdyx", "hafjls",	/* 5396 */
+	"haimmfau", "haitpqcy", "hakbgyt", "hakoykilw",	/* 5400 */
+	"halzn", "hamco", "hamcu", "hamehs",	/* 5404 */
+	"hamtacsr", "hapzf", "harbquiz", "harvwlycqgydl",	/* 5408 */
+	"hatgoqgnlyzr", "hatmxhysox", "hautkhhijcctg", "havrpkqxv",	/* 5412 */
+	"havxp", "havz", "hawxyztbagaid", "haxjpx",	/* 5416 */
+	"haybmrvgzwxs", "hayufqvanfdjm", "hazkrhkhypu", "hb",	/* 5420 */
+	"hbaixni", "hbazy", "hbc", "hbdefvgciik",	/* 5424 */
+	"hbdoytsnwi", "hbforwstgrpowk", "hbgmpwwgdpcr", "hbi",	/* 5428 */
+	"hbif", "hbjerawvfobna", "hbjfvraw", "hbk",	/* 5432 */
+	"hblfz", "hblrst", "hbnzd", "hbofqiunurcb",	/* 5436 */
+	"hbpt", "hbq", "hbrij", "hbvnqtd",	/* 5440 */
+	"hbvtqgkrumckp", "hbw", "hbwqwdbvabyn", "hbwrnc",	/* 5444 */
+	"hbx", "hc", "hcaiucxge", "hcarnll",	/* 5448 */
+	"hcavnvqqhewkup", "hcaysttsa", "hcb", "hcbkejdfebth",	/* 5452 */
+	"hcc", "hcceol", "hccrjof", "hcdknmrarjezj",	/* 5456 */
+	"hcdrhvaeruoolw", "hcefekosh", "hceisjwz", "hcekqppq",	/* 5460 */
+	"hcfmn", "hcgsljowhjszg", "hchll", "hci",	/* 5464 */
+	"hcibtiq", "hcivvud", "hcj", "hckismtnwoi",	/* 5468 */
+	"hcksbyobmllysb", "hckxivfqgoy", "hclovcxqor", "hcmd",	/* 5472 */
+	"hcmqpameh", "hcnlzdfyhu", "hcnnqgsx", "hcoknirag",	/* 5476 */
+	"hcouyqjr", "hcowinoafz", "hcpl", "hcpmebphutbmv",	/* 5480 */
+	"hcrpymmxztj", "hctruspm", "hctxlbyi", "hcuqhdoepibw",	/* 5484 */
+	"hcwrly", "hcwtdokrilhr", "hcyyucuuz", "hcyzfiadq",	/* 5488 */
+	"hcz", "hd", "hdakheswxhw", "hdalcwfwpdheox",	/* 5492 */
+	"hdawgarntwl", "hdbttlnk", "hdcvxbn", "hddi",	/* 5496 */
+	"hdfoq", "hdge", "hdhgxqwfjuy", "hdhlgsrzgug",	/* 5500 */
+	"hdisjuvrins", "hdjassremkxfu", "hdjljaq", "hdjrpqazxw",	/* 5504 */
+	"hdkqdivwxe", "hdmapseumjzh", "hdmmkvyyn", "hdmohg",	/* 5508 */
+	"hdneewm", "hdpl", "hdqbzf", "hdqldkczx",	/* 5512 */
+	"hdrpojz", "hdrx", "hduwxsne", "hdvkiaqkdlzzu",	/* 5516 */
+	"hdw", "hdwex", "hdwzokarkze", "hdxebqtz",	/* 5520 */
+	"hdxuemq", "hdxyplqooao", "hdz", "hdzdnepjkbo",	/* 5524 */
+	"he", "heaalmmvshj", "heaammuerwdj", "hearnbzna",	/* 5528 */
+	"heccfotx", "heclljvh", "hedmnqbo", "hedszxvav",	/* 5532 */
+	"hefiwhn", "hegb", "heicjydqdayk", "hejagvnpquu",	/* 5536 */
+	"helr", "hem", "henbgiamfkor", "heo",	/* 5540 */
+	"heomzfazets", "hepovrm", "heseelfng", "heu",	/* 5544 */
+	"heuvhoyrfblas", "hevzsvczkbxy", "hewzjqolsvq", "hey",	/* 5548 */
+	"heywc", "hezqxcao", "hf", "hfagun",	/* 5552 */
+	"hfebvoqmluq", "hffbf", "hfhhnw", "hfhjmpxj",	/* 5556 */
+	"hfj", "hfk", "hfleyl", "hfmwpttkhpakbz",	/* 5560 */
+	"hfmzsd", "hfndzdn", "hfnyfemtc", "hfoio",	/* 5564 */
+	"hfqjevdeaqczr", "hfqjzc", "hfrspfltmqz", "hfs",	/* 5568 */
+	"hfuaudiga", "hfuiwrjtuxp", "hfvjkjbdlzjbp", "hfvkiuykf",	/* 5572 */
+	"hfwgzghk", "hfyzguhvkfivg", "hg", "hgakrbhrmoboj",	/* 5576 */
+	"hgatroecjxdrb", "hgayrvfb", "hgdiri", "hgefklyrrnrbs",	/* 5580 */
+	"hggu", "hgjfiayosfio", "hgjvvscwsgcarx", "hgjzpfltgq",	/* 5584 */
+	"hgknizrszyzyig", "hgl", "hglarmcpajro", "hgluosqezycn",	/* 5588 */
+	"hgmhme", "hgmnxmefddrqsc", "hgnvfqdkkbdgur", "hgnwoswurdwge",	/* 5592 */
+	"hgnztsvn", "hgotroaa", "hgpvtadzcfr", "hgqedkhxu",	/* 5596 */
+	"hgqyhmsi", "hgrvs", "hgtuawnuhwp", "hguuj",	/* 5600 */
+	"hgvoap", "hgxlh", "hgyejwv", "hgymn",	/* 5604 */
+	"hh", "hharlsjeis", "hhbtpvkggda", "hhd",	/* 5608 */
+	"hhdxmel", "hheicr", "hhgdlj", "hhgzx",	/* 5612 */
+	"hhhafq", "hhhzirndvncgxk", "hhiijigsv", "hhjlghsyd",	/* 5616 */
+	"hhkf", "hhkuowqxm", "hhljoiqlkfwak", "hhlvlzqv",	/* 5620 */
+	"hhmik", "hhmsheuc", "hhn", "hhocyvtjxtzzhm",	/* 5624 */
+	"hhohkxmtotpgyc", "hholhytt", "hhotr", "hhp",	/* 5628 */
+	"hhpfqtzttckd", "hhqfr", "hhsswaorna", "hhttj",	/* 5632 */
+	"hhununka", "hhuyvzo", "hhvn", "hhwmmgtexjxx",	/* 5636 */
+	"hhwpey", "hhxsgvsa", "hhzrrhuhpuac", "hi",	/* 5640 */
+	"hia", "hidztf", "hiegjrp", "hievlsjagrsq",	/* 5644 */
+	"hifpbcbbrqu", "higawxbiyiimw", "higpfqvwt", "hihdjzdb",	/* 5648 */
+	"hihojkw", "hii", "hikav", "hikipb",	/* 5652 */
+	"hiknfbobmeiz", "hikpykxcvebn", "hilbr", "himvzk",	/* 5656 */
+	"hin", "hioejol", "hiokjejb", "hiqblac",	/* 5660 */
+	"hiqurkskdgomvc", "hirxpxz", "hiswpzzvdwgc", "hitgmsqphhzris",	/* 5664 */
+	"hiu", "hivcnmiooi", "hivithvesbzgln", "hivukitxqmadk",	/* 5668 */
+	"hiwn", "hiwtxvtlxyl", "hixcueqt", "hiy",	/* 5672 */
+	"hj", "hjbdn", "hjbwnozcgmv", "hje",	/* 5676 */
+	"hjgkumasfwe", "hjgmfzga", "hjgnbvvwlk", "hjick",	/* 5680 */
+	"hjiouihrocarqg", "hjjpg", "hjjwyclydcb", "hjkicjnpupvfdg",	/* 5684 */
+	"hjlhafnaxngq", "hjlul", "hjmlmswgexo", "hjmx",	/* 5688 */
+	"hjnredbd", "hjqh", "hjujflfoc", "hjvnjffujhf",	/* 5692 */
+	"hjxxlkixz", "hjzbwbymrqtjq", "hk", "hkazrcoimg",	/* 5696 */
+	"hkcbnuvg", "hkcyem", "hkdrts", "hkdwntmuyg",	/* 5700 */
+	"hkdztrkvtscmz", "hkeeicfqlkdo", "hkfhsgcftzmjw", "hkftvpuyrm",	/* 5704 */
+	"hkgbtyo", "hkhqq", "hki", "hkjfjazrkehp",	/* 5708 */
+	"hkjfxzco", "hkkpbsuzee", "hklkobygss", "hkqecxjfgfggr",	/* 5712 */
+	"hkqvwpqwqim", "hkrcfcdpelfyx", "hktchmxtfxoa", "hktjbkqzlcotsx",	/* 5716 */
+	"hkvdbcm", "hkxk", "hkypaplqccyeb", "hl",	/* 5720 */
+	"hlahsjoan", "hlaweulb", "hlbjar", "hlbwrhratxwiy",	/* 5724 */
+	"hlcfmbitqydbf", "hlcmxajqgu", "hlednttqmeuzxq", "hlfqa",	/* 5728 */
+	"hlhcxastlkyopz", "hlhkbfp", "hlk", "hllsnxwgb",	/* 5732 */
+	"hlnjuoahgq", "hlpcctjh", "hlqfe", "hlsoz",	/* 5736 */
+	"hltyabvwfmpgk", "hluqa", "hlvizdm", "hlvsy",	/* 5740 */
+	"hlwnncgmfpnb", "hlwp", "hlxgxtpodrvz", "hlygsc",	/* 5744 */
+	"hlzvaiu", "hm", "hmb", "hmd",	/* 5748 */
+	"hmdtylbbbrd", "hmfjb", "hmfr", "hmhdphkecydjq",	/* 5752 */
+	"hmkexrqzvvkg", "hmnpn", "hms", "hmtazsgjs",	/* 5756 */
+	"hmtigmlvfjcpv", "hmtoektuofym", "hmwmsxw", "hmytwmhcd",	/* 5760 */
+	"hmzzjvfdaxhia", "hnahnzydiozo", "hnanommkmuuxf", "hncpzsa",	/* 5764 */
+	"hncxhtbwin", "hnevdf", "hnfdxsyx", "hnfrbpbqusxnt",	/* 5768 */
+	"hng", "hnhovxhcoiplk", "hnigtzshpjgk", "hniyvnmipd",	/* 5772 */
+	"hnkdmehlodst", "hnkiqubstxayga", "hnkopfy", "hnmua",	/* 5776 */
+	"hnnkn", "hnnlxmba", "hnnph", "hnovlrgzp",	/* 5780 */
+	"hnpivecu", "hnqjtryrktohb", "hnrihfuyewsjy", "hnrp",	/* 5784 */
+	"hnsldowtz", "hntdmisbpuktuo", "hntgfpixov", "hnuhfdka",	/* 5788 */
+	"hnuwacfyp", "hnvolwx", "hnvqcfofudjilc", "hnvyuzrsit",	/* 5792 */
+	"hnwlmvhpflpqqf", "hnwzwnj", "hnxlk", "hnyuvqjfzcd",	/* 5796 */
+	"hnze", "hnzuxdot", "hnzznfgaone", "ho",	/* 5800 */
+	"hocukopzscn", "hodrvfaquzupb", "hoexoxmddcuaa", "hofavgwhts",	/* 5804 */
+	"hofc", "hoffeezhlxnxx", "hofgrxcdsus", "hofimpk",	/* 5808 */
+	"hofkquyjp", "hofxbxrxbxjz", "hog", "hogcdw",	/* 5812 */
+	"hoguo", "hohtl", "hohxv", "hoipr",	/* 5816 */
+	"hojdhobp", "holcblahtldxuv", "homfkhjysrgz", "honbh",	/* 5820 */
+	"honkitscbxpeym", "honkka", "hopwi", "hortcsrraim",	/* 5824 */
+	"hosjwcgsxhx", "hotcqibjfzbidu", "hovp", "hoxkeoql",	/* 5828 */
+	"hoxmjctd", "hoygsfndq", "hoykb", "hoyqqtsw",	/* 5832 */
+	"hpbpp", "hpcsmubgs", "hpdstrmxfzqlm", "hpf",	/* 5836 */
+	"hph", "hpi", "hpj", "hpjdjguykjlj",	/* 5840 */
+	"hpjf", "hpkgahwfsem", "hpkkhdyrlfd", "hplafvojie",	/* 5844 */
+	"hplhncidofwr", "hplqx", "hpmabxtyqnt", "hppjxbmakbje",	/* 5848 */
+	"hpq", "hprzvxbaqj", "hpszf", "hpunw",	/* 5852 */
+	"hpuq", "hpvhohhb", "hpvixbcec", "hpw",	/* 5856 */
+	"hpwdfxosj", "hpzgvrzmk", "hpzkpezbcdxf", "hq",	/* 5860 */
+	"hqakyaimw", "hqaybcjn", "hqccuiuklyhrqn", "hqcgu",	/* 5864 */
+	"hqchwnkng", "hqcxdybknbal", "hqdmovqlkipgqu", "hqfkzf",	/* 5868 */
+	"hqg", "hqgsicgjswz", "hqjmznt", "hqjpkrinh",	/* 5872 */
+	"hqkrz", "hql", "hqmnwhcerkrfg", "hqnizuvm",	/* 5876 */
+	"hqnridobjdt", "hqq", "hqqbovj", "hqqvxbwcitkcj",	/* 5880 */
+	"hqqzlcgbenfs", "hqrptc", "hqsu", "hqsugetshvjfdy",	/* 5884 */
+	"hqsvketblfsi", "hqtgq", "hqtzmolibmtnlb", "hqurxzjtum",	/* 5888 */
+	"hqvzngeshv", "hqw", "hqwywnnfgkleox", "hqxhmawlnz",	/* 5892 */
+	"hqy", "hqysxyjffpfwy", "hr", "hratsrkn",	/* 5896 */
+	"hrbvtrrhlpv", "hrchnw", "hrcmsfe", "hrdldipf",	/* 5900 */
+	"hrdulmgfkvrh", "hrfrmkjzrnyt", "hriedz", "hrjyujz",	/* 5904 */
+	"hrk", "hrmbeyp", "hrmgzjnpqpb", "hrnaunvda",	/* 5908 */
+	"hrnzfshlqxzn", "hro", "hronj", "hrrrw",	/* 5912 */
+	"hrsm", "hrt", "hrtzuscx", "hrwcddbnjbstb",	/* 5916 */
+	"hryjxf", "hrz", "hsaeorzvwszly", "hsbqvgnlzwcx",	/* 5920 */
+	"hsciljsrdo", "hscyfqlnmztq", "hsdhslys", "hseszigyztwads",	/* 5924 */
+	"hsi", "hsjhspl", "hslvgbftnacbwu", "hsmyy",	/* 5928 */
+	"hsnqxxtvbz", "hsnukhdciqea", "hspvibfibbyl", "hsrg",	/* 5932 */
+	"hsrgboka", "hsufevxnutk", "hsuupswbynzol", "hsvnhsyg",	/* 5936 */
+	"hsvrrd", "hsxqsxujo", "hsyw", "ht",	/* 5940 */
+	"htdvpdrugp", "htdyav", "htec", "htexejlgbufv",	/* 5944 */
+	"htgmck", "hthwufsrsazpd", "htihhq", "htijfzvwdalx",	/* 5948 */
+	"htmpcwffw", "htnjxvnpkslchb", "htqiro", "htqnzhxynsau",	/* 5952 */
+	"hts", "htszdtrv", "htueeujem", "htuwbpabln",	/* 5956 */
+	"htvln", "htvlqxnal", "hu", "hua",	/* 5960 */
+	"huaiwm", "huaxwuxprfofmn", "huazxmgyi", "hucvbqam",	/* 5964 */
+	"huhdmq", "huhrokqdjpyqzn", "huhwydfp", "huj",	/* 5968 */
+	"hujafuk", "hulfxunfz", "hulo", "humhmsttzcilhy",	/* 5972 */
+	"humlqy", "humnkoea", "huoaszuoodkn", "hupcaef",	/* 5976 */
+	"hupprytrsor", "hurbkuojrh", "hurezq", "hury",	/* 5980 */
+	"hutbivpnyunjuf", "hutbqk", "hutznhmsv", "huv",	/* 5984 */
+	"huvttietfnx", "huwqjojrk", "huxnemfqqycsi", "huxx",	/* 5988 */
+	"huzfnns", "hv", "hvaxluuztkysip", "hvb",	/* 5992 */
+	"hvcdzdh", "hvdn", "hvejsyvsypkez", "hvekm",	/* 5996 */
+	"hveuyx", "hvfthsntsjb", "hvgm", "hvixf",	/* 6000 */
+	"hvjrnlblw", "hvkpxp", "hvn", "hvo",	/* 6004 */
+	"hvpzhplrcbshel", "hvqbbmtrhuq", "hvqdvbpmjsf", "hvqztnhejrhm",	/* 6008 */
+	"hvsdwd", "hvstmkfbd", "hvtvvmvd", "hvufgvznk",	/* 6012 */
+	"hvuhahnukxmasa", "hvupepvrnqmqa", "hvzmsqzbhyjwl", "hw",	/* 6016 */
+	"hwa", "hwaryxgfsnych", "hwco", "hwex",	/* 6020 */
+	"hweyvau", "hwfhsr", "hwgreynbivqoe", "hwguywvocspuk",	/* 6024 */
+	"hwivfnv", "hwjsenhitochdx", "hwkgd", "hwkrvcuwwyzlpg",	/* 6028 */
+	"hwlbblwcaggclo", "hwle", "hwloyrav", "hwnjzcztrwfjtw",	/* 6032 */
+	"hwoqfebkyyo", "hwplpz", "hwqemnowqhqeu", "hwrkzhttzitks",	/* 6036 */
+	"hwtabj", "hwuraaad", "hwuziwwb", "hwwrnl",	/* 6040 */
+	"hwxppnyds", "hwy", "hwzmfzwqpix", "hwzydgsuf",	/* 6044 */
+	"hx", "hxa", "hxbqvzikl", "hxclelokqrbnh",	/* 6048 */
+	"hxcpzefr", "hxcqop", "hxgagprozlp", "hxhhxlqq",	/* 6052 */
+	"hxhuqux", "hxiydkbnz", "hxk", "hxmtdu",	/* 6056 */
+	"hxntv", "hxpdirjc", "hxpdkkny", "hxqbum",	/* 6060 */
+	"hxrtptwsw", "hxsblfchbehpzq", "hxtbvgai", "hxupbfsqltxkb",	/* 6064 */
+	"hxvsdgw", "hxwmdio", "hxy", "hxzjopyvntx",	/* 6068 */
+	"hxzmnvflr", "hyaa", "hyafjckq", "hycovwchejiwno",	/* 6072 */
+	"hycrirtoqmu", "hydlcfnh", "hydtnxacddg", "hyfqenlsfyz",	/* 6076 */
+	"hygx", "hyh", "hyibaodbu", "hyiyxvm",	/* 6080 */
+	"hyizpiy", "hyjbeda", "hyjcjzwhzwd", "hykgm",	/* 6084 */
+	"hykwxva", "hylanpwtxeabb", "hylz", "hymduf",	/* 6088 */
+	"hymzmseco", "hyoa", "hyoafvyovbh", "hyojgdbw",	/* 6092 */
+	"hyow", "hyr", "hyrdcyalywj", "hysgwwjouerhvu",	/* 6096 */
+	"hyulejb", "hyulwljtuqw", "hyx", "hyye",	/* 6100 */
+	"hyzei", "hyzlhcl", "hyznkubjujic", "hz",	/* 6104 */
+	"hzakjayzrvxr", "hzaptyatqa", "hzgx", "hziazy",	/* 6108 */
+	"hzicsg", "hzkdabotmfauv", "hzkgbwztswbslh", "hzkxxznxf",	/* 6112 */
+	"hzlcqxm", "hzltixccxgp", "hznmdmxjo", "hzoeoms",	/* 6116 */
+	"hzofuznsia", "hzphqmd", "hzqwtrnbx", "hzrqsuygzdyn",	/* 6120 */
+	"hzsrvumcey", "hzuanjvfe", "hzuulqjvae", "hzuwtsxzmjivc",	/* 6124 */
+	"hzvkgczkf", "hzvmf", "hzvy", "hzwa",	/* 6128 */
+	"hzwb", "hzwdhilhsfollw", "hzxwnx", "hzzvjzotgq",	/* 6132 */
+	"ia", "iab", "iabagrdrcm", "iabpcxgiwikv",	/* 6136 */
+	"iabpuufnj", "iacdnedigc", "iacpbqmdunmms", "iaeb",	/* 6140 */
+	"iaf", "iah", "iaiqfvy", "iajim",	/* 6144 */
+	"iakjxlbu", "ialejhtclwrn", "iametkfzoeibm", "iao",	/* 6148 */
+	"iaoooqnxztgtlu", "iapsg", "iapyqen", "iaqmrvv",	/* 6152 */
+	"iaruoyjp", "iascku", "iasypummevq", "iat",	/* 6156 */
+	"iatoktwylbj", "iatwvfgwvt", "iav", "iavbt",	/* 6160 */
+	"iavqjjsdi", "iavqkaa", "iaxwhoujj", "iaybpxneytfxgq",	/* 6164 */
+	"iaypliowwt", "iazjeplniml", "iazzkuqhgkpxlh", "ibaemozuxuqu",	/* 6168 */
+	"ibaxkcmhklsfi", "ibcu", "ibcv", "ibcyjzi",	/* 6172 */
+	"ibeibzvqhqmdkg", "ibekzivof", "ibfmwxvpcelgu", "ibhfwmswfzwhnt",	/* 6176 */
+	"ibiuhzgxzm", "ibjitzzknfnqy", "ibkxyb", "ibm",	/* 6180 */
+	"ibmlhpmq", "ibmugubxgddx", "ibmxtfwbm", "ibmyyony",	/* 6184 */
+	"ibnmeyqmauejjc", "ibopez", "ibpywrwzwmky", "ibqyvhibxmvg",	/* 6188 */
+	"ibringw", "ibsb", "ibshf", "ibsucnhdhpd",	/* 6192 */
+	"ibty", "ibvyqp", "ibwazycwjr", "ibx",	/* 6196 */
+	"ibyodhrhfavaj", "ibyrrojkvgukv", "ibzgaa", "ibzhtlebhzl",	/* 6200 */
+	"ibzminxho", "ic", "icavpmwudcnzcj", "iccbwtydyvv",	/* 6204 */
+	"icdatwrazhhpws", "icddrytuwnizjg", "iceshglyyqrc", "icgcder",	/* 6208 */
+	"icgkthjfg", "ich", "ichzxoljswjwi", "icifj",	/* 6212 */
+	"icirpzjs", "ickh", "iclpvpjjvcctn", "icmlrjyxvf",	/* 6216 */
+	"icmqnzoltqdf", "icntbipxeelqp", "icpkusrqffdv", "icpuywhqgi",	/* 6220 */
+	"icpvr", "icq", "icr", "icrkncsmofalnk",	/* 6224 */
+	"icrlkrlxi", "icswdksqmvxjn", "icthcyafvc", "icurayev",	/* 6228 */
+	"icvwtjqedblu", "icvznxbcy", "id", "idalgpz",	/* 6232 */
+	"idbkcbzptgtgy", "idbktvcdrylx", "idc", "idcj",	/* 6236 */
+	"iddloaoyyi", "idehiycg", "ideozptfr", "idhbxntwlc",	/* 6240 */
+	"idilmkbud", "idlouzjnl", "idmpmol", "idnpwxihq",	/* 6244 */
+	"idobfzsmxfsz", "idocpoqvw", "idpdpgfllin", "idpfg",	/* 6248 */
+	"idqtgbrhqomxjp", "idqvfpzw", "idsbvtllp", "idshyqwye",	/* 6252 */
+	"idsqg", "idtouujp", "idvmjfh", "idvwslvjaknsk",	/* 6256 */
+	"idxdms", "idxfhii", "idxnwmzs", "idzplzie",	/* 6260 */
+	"idzvbrnvisokq", "ie", "iebbnsmi", "iebmzvxeceiaco",	/* 6264 */
+	"iebppxj", "iebrilko", "iec", "iecb",	/* 6268 */
+	"ieedy", "iefnm", "iegnzpsqznys", "iehi",	/* 6272 */
+	"ieipbhcezvo", "ieistfwa", "ieit", "iekjuhyoerbf",	/* 6276 */
+	"ieknqzm", "ielrn", "ieltz", "ieojqlxae",	/* 6280 */
+	"iepjzhdbg", "ieqdiqnppuc", "ieqtu", "ieqxvilsr",	/* 6284 */
+	"iermusnthqffwk", "ierxk", "iesbjsep", "ietstrgnyibs",	/* 6288 */
+	"ietwwax", "ieunq", "ieuoosdrsmh", "iev",	/* 6292 */
+	"ievaxct", "iexgxsxtlrtcnw", "iexpfaywoxwh", "iexyiyczkcq",	/* 6296 */
+	"iezbrcgwrdxizu", "iezco", "iezuinscw", "iezvevdzc",	/* 6300 */
+	"if", "ifa", "ifaqaxn", "ifarabzujyumj",	/* 6304 */
+	"ifbob", "ifdouxibxwhl", "ifean", "iffpevnvo",	/* 6308 */
+	"ifgdszmwcuk", "ifgiat", "ifknidjkrzdix", "iflujdazs",	/* 6312 */
+	"ifoguuuzqnchxu", "ifpyytltbcgmjm", "ifqmcdk", "ifrxfvxjrwxqpj",	/* 6316 */
+	"ifthpq", "iftmkzpmtfn", "ifunlji", "ifuwej",	/* 6320 */
+	"ifvfaygsmlkx", "ifwcatxyra", "ifxkh", "ifybudr",	/* 6324 */
+	"ig", "igautjqehacnw", "igbkp", "igcvdcpt",	/* 6328 */
+	"igdaqyubtilllw", "igdhchmrnhpi", "iggnmksgw", "ighxaacqsv",	/* 6332 */
+	"igj", "igjqb", "igk", "igmfnhxlm",	/* 6336 */
+	"igmkygpa", "igngco", "igodhznhcvmg", "igoohvoanj",	/* 6340 */
+	"igp", "igrbtuzpor", "igrcp", "igsdpipxuti",	/* 6344 */
+	"igshzyvbihc", "igt", "igukpcddnmozg", "igvqfjxsn",	/* 6348 */
+	"igwxghgucssyb", "igxo", "igyxhuiszglgqi", "ih",	/* 6352 */
+	"ihafrokufkd", "ihagpyr", "ihcmja", "ihdwenhqh",	/* 6356 */
+	"ihfi", "ihfj", "ihg", "ihgasyakc",	/* 6360 */
+	"ihgdixpbxqjz", "ihgpusxydhhpf", "ihgslgeuemocq", "ihhcnv",	/* 6364 */
+	"ihhelw", "ihljzrovkzg", "ihmr", "ihneyhvmtxbhgs",	/* 6368 */
+	"ihnqgpza", "ihntdyei", "ihp", "ihphztwn",	/* 6372 */
+	"ihq", "ihqazqgr", "ihqtwb", "ihtlswktwtqxzo",	/* 6376 */
+	"ihvcrmof", "ihwlgksamdm", "ihwnsisrg", "ihxd",	/* 6380 */
+	"ihzpijklkgzi", "ii", "iib", "iicwhtgdmqqd",	/* 6384 */
+	"iigckw", "iiirf", "iilhxc", "iimmmhafmzu",	/* 6388 */
+	"iinwaohkp", "iiolkszmlrf", "iipwjipg", "iiqzjkkcnzob",	/* 6392 */
+	"iisn", "iitqip", "iityy", "iiujaqc",	/* 6396 */
+	"iiuvhjokwkgou", "iivquuoih", "iiw", "iiwcbut",	/* 6400 */
+	"iizdbzzgnt", "ij", "ija", "ijatyb",	/* 6404 */
+	"ijbaauy", "ijdrvlrcaq", "ijermwnicfiuvn", "ijfb",	/* 6408 */
+	"ijfg", "ijgrmxm", "ijhksq", "ijkvtxj",	/* 6412 */
+	"ijloyj", "ijnanfghtkfkkd", "ijnrfjdvvu", "ijo",	/* 6416 */
+	"ijogcvfvgwtcxk", "ijqybjppwfc", "ijrjfn", "ijrlshzx",	/* 6420 */
+	"ijrzawjazh", "ijttyjukyclga", "ijtzxlujvyu", "ijvdcmvbas",	/* 6424 */
+	"ijytomdhd", "ijzrjed", "ik", "ika",	/* 6428 */
+	"ikaebnzqu", "ikazzdr", "ikbcebisv", "ikbkgnsoay",	/* 6432 */
+	"ikbzlxxbx", "ikcoib", "ikczrvyxgpon", "ikfzs",	/* 6436 */
+	"ikgaerkqwrireg", "ikgagct", "ikgqozm", "ikhcawypecnuey",	/* 6440 */
+	"ikhrdxusdm", "ikidpeotmjq", "ikiv", "iklqdwe",	/* 6444 */
+	"ikmcajck", "ikmurpkdxru", "ikrqtprrje", "iks",	/* 6448 */
+	"iksfoej", "ikst", "ikthwysy", "ikujrixvt",	/* 6452 */
+	"ikuwownch", "ikvsdmmqnm", "ikwnhfa", "ikx",	/* 6456 */
+	"ikxhyrvfqwy", "ikxmowsppwv", "il", "ilaxywg",	/* 6460 */
+	"ilbapiiyavm", "ilctnd", "ilddar", "ildwllfx",	/* 6464 */
+	"ileo", "ilhefsyhnclqrf", "iliktx", "ilinqigqs",	/* 6468 */
+	"illozrkmrhqmd", "ilmta", "ilopheiafprgc", "ilqazxklg",	/* 6472 */
+	"ilquvrumfyhy", "ilrlatnkkxeon", "ilstxeedfxoi", "iltuatubsdz",	/* 6476 */
+	"ilujjgvnidd", "ilvwegbfyjmon", "ilw", "ilwilrmvtf",	/* 6480 */
+	"ilza", "ilzgwcsiycw", "im", "imaetwxxozj",	/* 6484 */
+	"imaj", "imcjssmgujpjg", "imcocmbluxvov", "imcvod",	/* 6488 */
+	"imdbreapj", "imdnn", "imf", "imgcnz",	/* 6492 */
+	"imgimrmorwy", "imgjwxut", "imgxgqoftur", "imhnkoqlzphfoh",	/* 6496 */
+	"imidgbiivh", "imiltsn", "imk", "imkn",	/* 6500 */
+	"iml", "imlbsqqgqvgi", "imlqwowuxfeq", "immsbfu",	/* 6504 */
+	"imnh", "imoasofadnhy", "imopmmdmk", "imoxrqnpn",	/* 6508 */
+	"impjcky", "imqtkiqtbrvwue", "imrdjyxj", "imrrmadpb",	/* 6512 */
+	"imsjb", "imvjlcztrlxykt", "imvo", "in",	/* 6516 */
+	"inahygubappct", "infqa", "inghdjtsrx", "inicrmedev",	/* 6520 */
+	"inieyzbgwclyb", "initdp", "inkndjxghyvclz", "inkpbwov",	/* 6524 */
+	"inkwxsun", "inkypgwpmwncc", "inlflnedesf", "inlm",	/* 6528 */
+	"inlxnkdoag", "inmvghe", "innjo", "inoewq",	/* 6532 */
+	"inokqdfmr", "inpopczsvdolk", "inpppsjhkmeogm", "inrjhgcouulk",	/* 6536 */
+	"insaxcpjwqbny", "intkbvyuzl", "intkpkcstby", "inu",	/* 6540 */
+	"inuxpbkjmbod", "inv", "invlxlzgotv", "invu",	/* 6544 */
+	"io", "ioati", "iobftuujkz", "ioeoviprsb",	/* 6548 */
+	"iofd", "iofnrdo", "iogeky", "iohisfg",	/* 6552 */
+	"iohur", "ioizzlux", "ioj", "iondqtrbvhhfsu",	/* 6556 */
+	"ioomoijmjsle", "iopdyxpjta", "iorcpjlg", "iosejwylkicdq",	/* 6560 */
+	"iouyv", "iovfhecijuxp", "iowmfewn", "ioxmaaaqxxsudi",	/* 6564 */
+	"ioxqidmhzoq", "iozwiz", "ip", "ipasrsvh",	/* 6568 */
+	"ipbbemxhbhova", "ipbkoxsqfyluk", "ipcjlzbzr", "ipewbt",	/* 6572 */
+	"iphmaadfb", "iphu", "ipivplsa", "ipjvhv",	/* 6576 */
+	"ipkgrk", "ipldwnbjxxdgr", "iplwithtt", "ipn",	/* 6580 */
+	"ipoe", "ipoyxwrotb", "ipqekegx", "ipuirmwworm",	/* 6584 */
+	"ipvfyjmwwww", "ipxzzfnj", "ipyc", "ipzlvdlbwwagls",	/* 6588 */
+	"iq", "iqbcsz", "iqbh", "iqc",	/* 6592 */
+	"iqca", "iqezzyrfdnex", "iqfvhqpbczsx", "iqfxgobqnl",	/* 6596 */
+	"iqggrhkqysmgz", "iqhhugkcmv", "iqisuyf", "iqjuoyyja",	/* 6600 */
+	"iqjvmkgnx", "iqkcojqfzbozvr", "iqmyzj", "iqnythaikefa",	/* 6604 */
+	"iqofgatlsnylg", "iqouegvfcrohid", "iqpbsanw", "iqpgvuetdp",	/* 6608 */
+	"iqphx", "iqpifyawfqv", "iqppdfzk", "iqqitetlcngkt",	/* 6612 */
+	"iqrxgswe", "iqrzgfgykmmfsw", "iqsgfkesbckjo", "iqtgnpx",	/* 6616 */
+	"iquba", "iquopsouslsbs", "iquthhffqxnpdk", "iqvdqgulal",	/* 6620 */
+	"iqweihzjurp", "iqygmvzieabdes", "iqynzosswje", "iqyp",	/* 6624 */
+	"ir", "ira", "irairiqi", "iraqcecjrqhjtr",	/* 6628 */
+	"iraqyqw", "irayrsy", "irbghvgwzlohbq", "ircipyilx",	/* 6632 */
+	"irdnkihq", "ireaxujjpeid", "ireqzxk", "irfatohyh",	/* 6636 */
+	"irfaxszib", "irfoopakxpq", "irfrtuc", "irg",	/* 6640 */
+	"irgvfkvxhomc", "irhh", "irhputqhltmin", "irjst",	/* 6644 */
+	"irl", "irm", "irmau", "irnqqshhondl",	/* 6648 */
+	"iroeniu", "irp", "irqa", "irqhdn",	/* 6652 */
+	"irqnnyvyy", "irqoiqkhgnc", "irqzluttanjf", "irs",	/* 6656 */
+	"irsqzysw", "irtwwwuiahygev", "irtz", "irull",	/* 6660 */
+	"iruoizgiccmcdy", "iruurrcun", "irwbu", "irwpmaqec",	/* 6664 */
+	"irwsoenneprd", "irxeqjma", "irxnfu", "irys",	/* 6668 */
+	"is", "isbd", "iscjoqteroxs", "iscrphml",	/* 6672 */
+	"isdsrjrexfc", "isdxrxrj", "isgieyf", "isgpdsppngdrfi",	/* 6676 */
+	"isgwach", "ishkmulz", "isijmzmzsfsfmz", "isioigrtxfv",	/* 6680 */
+	"isklkyslztorl", "isklwvhrytmdj", "iskorrije", "islq",	/* 6684 */
+	"islrrhhkndfe", "islvfadwegkozv", "ism", "isopzqljkl",	/* 6688 */
+	"isphhiflonhnql", "issiywzh", "issletia", "isswnaypgnz",	/* 6692 */
+	"isttuxjmbqa", "isu", "isuqqw", "isyeahipytrak",	/* 6696 */
+	"isyvxtqgranc", "iszexc", "it", "itaapwsgbvklqa",	/* 6700 */
+	"itcagdxclitj", "itcuw", "itdibyfnv", "itdp",	/* 6704 */
+	"itdq", "itejdk", "itf", "itfyxchf",	/* 6708 */
+	"itg", "itgxade", "ithkggrg", "itibdrpnkrtzc",	/* 6712 */
+	"itio", "itisxyuggvfa", "itjgqghkiccwq", "itkgm",	/* 6716 */
+	"itlruojqb", "itmghtnnm", "itojebijjzhdx", "itq",	/* 6720 */
+	"itqlufeqlwz", "itqrxlggalakqu", "itr", "itusk",	/* 6724 */
+	"itvskzrcex", "itymqmmnrcgz", "ityygjklhzzz", "itzczojauixqwa",	/* 6728 */
+	"itzjzoifjonom", "itznverxy", "iu", "iuazdnzbdbfkx",	/* 6732 */
+	"iubzq", "iud", "iudqev", "iuemhbhevjfc",	/* 6736 */
+	"iues", "iufrlxxdri", "iuhostqafwgx", "iujdcbwuwe",	/* 6740 */
+	"iukgvnavqo", "iulak", "iuldf", "iulxagtx",	/* 6744 */
+	"iumegzwthczsj", "iumzn", "iuoixsyi", "iuq",	/* 6748 */
+	"iuqj", "ius", "iushc", "iuumqaeohwqo",	/* 6752 */
+	"iuuosaeiidd", "iuupy", "iuvomrfoti", "iuvwkivpb",	/* 6756 */
+	"iuw", "iuwbvbthb", "iuwjowkppdaj", "iuwlts",	/* 6760 */
+	"iuwpupr", "iuxozioyp", "iuzv", "iv",	/* 6764 */
+	"ivbdoqrabuzm", "ivc", "ivdscisy", "ivgnj",	/* 6768 */
+	"ivhyyzgcrkgc", "iviiakmmhnddbd", "ivjczrmdqvn", "ivnbu",	/* 6772 */
+	"ivozzfrlpndygs", "ivpqmvjl", "ivq", "ivqxdbvhwby",	/* 6776 */
+	"ivrsldvwlnq", "ivrxaxvko", "ivsy", "ivtnjiocd",	/* 6780 */
+	"ivvafjfzeivzb", "ivvarvxdyloiyd", "ivvowmeordxgha", "ivvqvid",	/* 6784 */
+	"ivwybkx", "iw", "iwaosftp", "iwbtxligesk",	/* 6788 */
+	"iweiuwhlbr", "iwfdbcbjpbduj", "iwfihxhsgrzak", "iwhb",	/* 6792 */
+	"iwhlzpnzgoqvq", "iwimsht", "iwinvnmm", "iwkkgiwjxuipe",	/* 6796 */
+	"iwkqjb", "iwljbp", "iwlsdwmfkmbwov", "iwmunp",	/* 6800 */
+	"iwnxzpeaog", "iwq", "iwqlapulyxzpc", "iwquiwgdbbd",	/* 6804 */
+	"iwschsdpehokst", "iwsdsi", "iwt", "iwugafnfnpq",	/* 6808 */
+	"iwusmab", "iwwnmncreigt", "iwxxkdmocixf", "iwylusy",	/* 6812 */
+	"iwyn", "iwz", "ix", "ixaovnyp",	/* 6816 */
+	"ixaqw", "ixbekzqon", "ixc", "ixcekost",	/* 6820 */
+	"ixcli", "ixcnqlhdmvuys", "ixcrrnfzd", "ixdogwpxnjolr",	/* 6824 */
+	"ixdqhruddn", "ixdtz", "ixduexqsaispi", "ixevkops",	/* 6828 */
+	"ixewkw", "ixfd", "ixfnyqqo", "ixhq",	/* 6832 */
+	"ixhuzwunxcj", "ixl", "ixljpk", "ixlohjvcctaoy",	/* 6836 */
+	"ixlquyhctptzz", "ixmoylf", "ixnhualrlek", "ixnreni",	/* 6840 */
+	"ixnuwzpzz", "ixommpphafnk", "ixsubyhlryls", "ixtxycifdebgn",	/* 6844 */
+	"ixuhl", "ixvyjfyeyhri", "ixxdzqq", "ixzt",	/* 6848 */
+	"iy", "iyak", "iyaqocmmlzos", "iycvo",	/* 6852 */
+	"iyd", "iydzzir", "iyekn", "iyevn",	/* 6856 */
+	"iyfbcty", "iyfue", "iygalnvg", "iygbjjja",	/* 6860 */
+	"iygxegykmp", "iyhkcimdehpk", "iyjmwqlrwajx", "iykewdhij",	/* 6864 */
+	"iyknq", "iylgv", "iyltcznhtpl", "iyndv",	/* 6868 */
+	"iynhokshkzpkg", "iynomnsokr", "iypswcgg", "iyqpnyobxw",	/* 6872 */
+	"iyriijvelpo", "iys", "iysawytahtpg", "iysehyguukqzs",	/* 6876 */
+	"iytqyeepxaif", "iytwod", "iytzoqzchdrit", "iyurnaxnv",	/* 6880 */
+	"iyvd", "iyvp", "iyvylplkp", "iywqltvftyumul",	/* 6884 */
+	"iyx", "iyxc", "iyxlvp", "iyzecgyf",	/* 6888 */
+	"iyzjq", "iyzwjg", "izaaenqovcts", "izamkade",	/* 6892 */
+	"izautyd", "izbfqily", "izbjbpzamc", "izcehuclh",	/* 6896 */
+	"izcxqbqsalwgee", "izexjzvilz", "izfkpawtomxenr", "izfliboqeyp",	/* 6900 */
+	"izfmnnp", "iziesnlkmmcnp", "izitgh", "izkwshgha",	/* 6904 */
+	"izlvcijyyeinpa", "izmcfukhc", "iznajjhxkin", "izno",	/* 6908 */
+	"izobd", "izpcrdowsmygdq", "izq", "iztuhdru",	/* 6912 */
+	"izusp", "izwnvrj", "izwzcd", "ja",	/* 6916 */
+	"jab", "jacynvzaimgn", "jadfnq", "jaf",	/* 6920 */
+	"jafgkzsz", "jafjyc", "jagipydrtimp", "jahqp",	/* 6924 */
+	"jahtywcmbu", "jahu", "jaigywjumvrand", "jalpaytzhhbrv",	/* 6928 */
+	"jamdaarznwnb", "jaqjopnyknqgyc", "jarx", "jas",	/* 6932 */
+	"jaugeao", "jauoanad", "javfsgycz", "javinoi",	/* 6936 */
+	"jawyt", "jaxjvdj", "jaycjbxrhf", "jayfontwdx",	/* 6940 */
+	"jayi", "jayvfd", "jb", "jbbzaq",	/* 6944 */
+	"jbcgkenrmrgv", "jbchpksvalyg", "jbczuswhlvn", "jbdsb",	/* 6948 */
+	"jbdszbwsrp", "jbelj", "jbextqvdgjgg", "jbeyob",	/* 6952 */
+	"jbgusbbjxy", "jbjnsjljk", "jbktniviohp", "jbkwlco",	/* 6956 */
+	"jbliz", "jbmftugr", "jbmuneqjwdunp", "jbndpic",	/* 6960 */
+	"jbnqcbg", "jbqgvjkdkcvv", "jbsb", "jbslqamvdaas",	/* 6964 */
+	"jbt", "jbthajql", "jbtqkjbpcfx", "jbtwodxiswfap",	/* 6968 */
+	"jbuimrnvelv", "jbuj", "jbuztnj", "jbvgcys",	/* 6972 */
+	"jbwnyfywuuvaov", "jbx", "jbxlglbehbhxy", "jbys",	/* 6976 */
+	"jbzvgbsbtfrmk", "jc", "jcawsxa", "jcbiscrisj",	/* 6980 */
+	"jcdjgmabluguu", "jcdmqjjxqhkab", "jcdwggduqsuzqm", "jceeclkpqqm",	/* 6984 */
+	"jcffiqf", "jcfftyfvjjb", "jcfplivfndou", "jcghrh",	/* 6988 */
+	"jcgovcm", "jcidqw", "jcisrihrvwqdhi", "jcitosuydk",	/* 6992 */
+	"jciwrca", "jcjtedfutq", "jckgcdpts", "jclijmhgbkq",	/* 6996 */
+	"jcljnkxxuzgn", "jclyyqrbksb", "jcnafiusfr", "jcpixxjxhqqwhr",	/* 7000 */
+	"jcqernasumkm", "jcqkjzddxlsmof", "jcrbnweo", "jcrpdwvjrbb",	/* 7004 */
+	"jcrptlk", "jcu", "jcyczdiky", "jcyv",	/* 7008 */
+	"jd", "jdbibztppbg", "jdccdvbbkvxn", "jdd",	/* 7012 */
+	"jddhfxggguzo", "jdfxoaupbuswek", "jdg", "jdhcjtphnp",	/* 7016 */
+	"jdhqmc", "jdicd", "jdiiufobsca", "jdior",	/* 7020 */
+	"jdjanuocd", "jdjgle", "jdkdsspdzacna", "jdkmfsiy",	/* 7024 */
+	"jdkpc", "jdllhpvjgmdwr", "jdm", "jdnam",	/* 7028 */
+	"jdnazlcznedrz", "jdnci", "jdnhqrgkkqzm", "jdo",	/* 7032 */
+	"jdoptcuxyym", "jdoumkkmpfcyi", "jdr", "jdrbkmvp",	/* 7036 */
+	"jdrgrqnnvukdhb", "jdtflfocjkkc", "jdtplnqtmplb", "jdupw",	/* 7040 */
+	"jduravftxsmiuy", "jduurrotsulif", "jdxjrempncxq", "jdylkb",	/* 7044 */
+	"je", "jeabvzsigqrq", "jeadxbutkll", "jeahkyqpee",	/* 7048 */
+	"jeaiwjvpe", "jeavofms", "jedbss", "jedfvvr",	/* 7052 */
+	"jeegtgpvrn", "jeeoiykddgjjf", "jefeqlm", "jefj",	/* 7056 */
+	"jehcvdlhatdrok", "jehhtyxqntx", "jehkptu", "jehlofubsm",	/* 7060 */
+	"jeixodpmjdxpl", "jejrleyj", "jejtn", "jekchmbgx",	/* 7064 */
+	"jekgr", "jemktntapcumqk", "jemol", "jemoqke",	/* 7068 */
+	"jenh", "jenjflvbh", "jeqfs", "jeqjxpw",	/* 7072 */
+	"jeqoseryf", "jeqyltlpe", "jes", "jetpq",	/* 7076 */
+	"jewexjq", "jewlyzfl", "jexddnauztqgz", "jeywqsvd",	/* 7080 */
+	"jeyzdotzwvuw", "jf", "jfarkjxjoayiza", "jfbahoi",	/* 7084 */
+	"jfbehjhjhwn", "jfbwpol", "jfc", "jfdapusw",	/* 7088 */
+	"jfeb", "jfeqmvfg", "jffjyibuihv", "jffom",	/* 7092 */
+	"jfikdmdalcla", "jfjiuusnji", "jfkhtqtqtfunpw", "jflvccrsauayh",	/* 7096 */
+	"jfndalcbvga", "jfngnnemy", "jfnwp", "jfoddopbfyj",	/* 7100 */
+	"jfpiontqsqa", "jfpjrcgdfs", "jfpmykqpvny", "jfrca",	/* 7104 */
+	"jfs", "jfsdygoqit", "jftqwhkofmz", "jfuimidiadvzd",	/* 7108 */
+	"jfumba", "jfxbs", "jfxwkemu", "jfyuh",	/* 7112 */
+	"jg", "jgagslkups", "jgbjpf", "jgbjvve",	/* 7116 */
+	"jgbkogj", "jghvzz", "jgiznohann", "jgklim",	/* 7120 */
+	"jgmebj", "jgmnnhdgfy", "jgmnosugczsxt", "jgo",	/* 7124 */
+	"jgopjm", "jgp", "jgqopncsbdjm", "jgr",	/* 7128 */
+	"jgrai", "jgrc", "jgrokpebvrawuh", "jgskxsawpqy",	/* 7132 */
+	"jgu", "jguovhoy", "jgxkyepkqwfuu", "jgxnmyzc",	/* 7136 */
+	"jgyxxhmavmuler", "jh", "jhag", "jhclxkn",	/* 7140 */
+	"jhctl", "jhitl", "jhizekpm", "jhjnmehjgrayem",	/* 7144 */
+	"jhkbiifwh", "jhlqgyx", "jhmxw", "jhnukbgjpqu",	/* 7148 */
+	"jhoifamvo", "jhoixfwmbr", "jhoj", "jhpvxalamursu",	/* 7152 */
+	"jhqfznk", "jhrllks", "jhsesktnvx", "jhsigzjoivbxe",	/* 7156 */
+	"jhslipcnlxxju", "jhucb", "jhuyyyst", "jhyjib",	/* 7160 */
+	"jhzgfjbeean", "jhzhe", "jhzogjmvpdde", "ji",	/* 7164 */
+	"jiaj", "jibnghsef", "jieutelq", "jifilbnenypc",	/* 7168 */
+	"jifrncyyg", "jigyazvyqn", "jihm", "jiibvsygmohrw",	/* 7172 */
+	"jikwpmqubnz", "jil", "jilk", "jilohswbxhugzz",	/* 7176 */
+	"jiluyhv", "jimkdmyvuljwfl", "jimuerhqdxny", "jinai",	/* 7180 */
+	"jio", "jioaickede", "jiobuxzmw", "jiofm",	/* 7184 */
+	"jipcfmtg", "jiqwuhn", "jisksmi", "jisq",	/* 7188 */
+	"jiwewfw", "jiynogici", "jiyxgf", "jjacr",	/* 7192 */
+	"jjchswgysksv", "jjcmhphk", "jjeurmbdg", "jjfb",	/* 7196 */
+	"jjgevq", "jjhwykiljncl", "jjkdmmipawnzxv", "jjkel",	/* 7200 */
+	"jjkfqoima", "jjlchapulxuo", "jjlyqadhpeyb", "jjmdhd",	/* 7204 */
+	"jjmlwvaje", "jjnbook", "jjnrrw", "jjqbslzvyerukr",	/* 7208 */
+	"jjqpflzcy", "jjrdjthlubgj", "jjsur", "jjtgzqmi",	/* 7212 */
+	"jjukdilbpddv", "jjuwadfwmzts", "jjv", "jjvorrxyzrva",	/* 7216 */
+	"jjvyg", "jjw", "jjwns", "jjx",	/* 7220 */
+	"jjxmwucoduksx", "jjxrnrzbnvs", "jjxwuogjfx", "jjyl",	/* 7224 */
+	"jjyrstufot", "jk", "jkavpct", "jkchzzbrfzpgim",	/* 7228 */
+	"jkcmndf", "jkcx", "jkdfypnpvt", "jkdprjqsfbc",	/* 7232 */
+	"jkeoxic", "jkey", "jkezxwpjvqpm", "jkfoqje",	/* 7236 */
+	"jkhqhb", "jkicdhxiwulg", "jkjhrp", "jkjjwuvctkn",	/* 7240 */
+	"jkjvnpsfgsyr", "jkllmbqdkxci", "jkmumpge", "jkmyt",	/* 7244 */
+	"jknwommx", "jkp", "jkpkdftspjfyi", "jkqsyescglpxv",	/* 7248 */
+	"jkuishlynvex", "jkvwi", "jkwrs", "jkye",	/* 7252 */
+	"jkyzeaqfgmwdna", "jkz", "jl", "jlaqyapof",	/* 7256 */
+	"jlasg", "jlbobynyoo", "jlcilelkno", "jlcxphpmgybgv",	/* 7260 */
+	"jld", "jldckaggxlqam", "jldi", "jldxg",	/* 7264 */
+	"jlezo", "jlf", "jlftzquvvkkixo", "jlhbvzgd",	/* 7268 */
+	"jlhpdabx", "jlhu", "jllzu", "jlnckwbnyqsy",	/* 7272 */
+	"jlotqa", "jlpdu", "jlppl", "jlqqtfknnjjb",	/* 7276 */
+	"jlu", "jlwmap", "jlyvitiqm", "jlza",	/* 7280 */
+	"jlztckfotypbo", "jmanlywdztkx", "jmarivkno", "jmartv",	/* 7284 */
+	"jmbza", "jmc", "jmcjoqvreyfv", "jmcmfxasq",	/* 7288 */
+	"jmcvggpjgcvsu", "jmjaqwt", "jmjzwz", "jmkcnagke",	/* 7292 */
+	"jmkpdkzwk", "jmkvbtvmb", "jmnsifgbp", "jmnuhakfvcz",	/* 7296 */
+	"jmphvevirhd", "jmqdkmcchopx", "jmsdjcnzkd", "jmsminkawxnzo",	/* 7300 */
+	"jmts", "jmuyaqsvfdrm", "jmwekj", "jmwutnv",	/* 7304 */
+	"jmwyppwe", "jmxkr", "jmzeru", "jmzzmvmywucjf",	/* 7308 */
+	"jn", "jna", "jnashnilg", "jnbsoutm",	/* 7312 */
+	"jncvvgxizut", "jncxoiogfmtpfa", "jndynqqv", "jndzsnxzro",	/* 7316 */
+	"jneoicbqqdy", "jnf", "jngmu", "jngxx",	/* 7320 */
+	"jnjp", "jnjubcanf", "jnn", "jnnjkwzupo",	/* 7324 */
+	"jnq", "jnqfr", "jnsdgcd", "jnuhdrjc",	/* 7328 */
+	"jnuuwvkpocohx", "jnuxbvydqk", "jnuzje", "jnwdhrxliwad",	/* 7332 */
+	"jnwoqdmiikmhhv", "jnwwnutqk", "jnxmololyyswj", "jnytodk",	/* 7336 */
+	"jnzbcdgteoafg", "jnzcufjwuo", "jnzqfcbo", "jo",	/* 7340 */
+	"jocioasbybdv", "jocv", "joevqpley", "jogxclqutrc",	/* 7344 */
+	"jolrwnghnjvexr", "jonhwhbhdoygh", "jonrujshvsaq", "jonvawnpo",	/* 7348 */
+	"jooborn", "joouo", "joowrs", "jooyeckixw",	/* 7352 */
+	"jophqhelijo", "jopuylv", "jorhmav", "jotzfrrui",	/* 7356 */
+	"jovjinqohl", "jovlfoke", "jpbj", "jpbwbknjxrs",	/* 7360 */
+	"jpccr", "jpcevcdvu", "jpcuhmgcxipyog", "jpdckj",	/* 7364 */
+	"jpeijtebfhb", "jpexqzjykpj", "jpfiajh", "jpgln",	/* 7368 */
+	"jpjgjvrdepp", "jplfrpqalvu", "jplhnxsh", "jplt",	/* 7372 */
+	"jpmhhm", "jpnm", "jpnvlmoonczsj", "jppllxpeh",	/* 7376 */
+	"jppnl", "jpqrdznkxefti", "jpr", "jprcqeaucgtt",	/* 7380 */
+	"jpuvsqve", "jpuzrgzytk", "jpxjsjgmhgyd", "jpxotenzo",	/* 7384 */
+	"jpyausbc", "jq", "jqaawlmqsouopd", "jqasigrq",	/* 7388 */
+	"jqcj", "jqdm", "jqfepkzbkyohzn", "jqfk",	/* 7392 */
+	"jqgcsidq", "jqhgj", "jqib", "jqiektbi",	/* 7396 */
+	"jqjdusidfvotye", "jqkdttgg", "jqlgerujr", "jqnbgsqqzcd",	/* 7400 */
+	"jqnrqntusj", "jqnuzaczepxrla", "jqpu", "jqpvxhxxsdn",	/* 7404 */
+	"jqthqkict", "jquqcdifhayde", "jqvjchtwhfwrqp", "jqvvmyrwvgj",	/* 7408 */
+	"jqxoxvfzts", "jqyieg", "jqz", "jqzrpnui",	/* 7412 */
+	"jr", "jra", "jraudazomspu", "jrdbcgdxxnaw",	/* 7416 */
+	"jrdlozgyqw", "jregyzwso", "jrelyhcnfyos", "jrexyhodxen",	/* 7420 */
+	"jrhzijerzfyt", "jrkp", "jrlfbwnhokvxkb", "jrlpjefxolzki",	/* 7424 */
+	"jrntgukzwfbp", "jrntylxhqoq", "jrp", "jrpswdrljx",	/* 7428 */
+	"jrqalvdpzetzjr", "jrqtersnxdkh", "jrruymzt", "jrs",	/* 7432 */
+	"jrsd", "jrsdp", "jrsja", "jrtak",	/* 7436 */
+	"jrtnletza", "jrtxhle", "jruaxir", "jruqbwhv",	/* 7440 */
+	"jruysosrkbm", "jrvusqwtbqbgf", "jrwtson", "jry",	/* 7444 */
+	"js", "jsamaukaldps", "jse", "jsepclosmbywhx",	/* 7448 */
+	"jsf", "jshqfda", "jshtyszcqimmn", "jskxmogqzxjoe",	/* 7452 */
+	"jskygwqgflim", "jskzfmip", "jsmftdiiq", "jsnn",	/* 7456 */
+	"jsnsti", "jso", "jsosxjoezy", "jspnqq",	/* 7460 */
+	"jsq", "jsqapg", "jsrghrozdecm", "jsrlmxzegyb",	/* 7464 */
+	"jsrnhaczipra", "jstn", "jstw", "jsutixc",	/* 7468 */
+	"jsve", "jsvisr", "jswfore", "jsxi",	/* 7472 */
+	"jsxpzdiuo", "jt", "jtauf", "jtbkspu",	/* 7476 */
+	"jtbn", "jtcoelcntsw", "jtdyvydabh", "jtf",	/* 7480 */
+	"jtfnjpjunlz", "jtgpfc", "jthkclvxmgsx", "jtio",	/* 7484 */
+	"jtjlyatzttucyt", "jtmv", "jtmvokuqdolbf", "jtnnovamenqi",	/* 7488 */
+	"jtodafy", "jtpzaognne", "jtqh", "jtqoiu",	/* 7492 */
+	"jtqoxxc", "jtrls", "jtttaphqgs", "jtutfigk",	/* 7496 */
+	"jtvf", "jtwo", "jtwwwiakyy", "jtz",	/* 7500 */
+	"ju", "judlngsbqhwhiv", "judwxwzlzpvhe", "juffrooshxcy",	/* 7504 */
+	"jufogifrjxma", "juhslh", "juinypyhxmkyut", "jujjiqibvoqi",	/* 7508 */
+	"julasknlip", "juloojm", "junpcuatxpq", "juqkqyllpn",	/* 7512 */
+	"juqkrygs", "juqmmq", "juqukrqxr", "jurhcpzegdju",	/* 7516 */
+	"jusffpy", "jusxmgobvp", "juulsa", "juuxr",	/* 7520 */
+	"juwfeha", "juymqkfnvo", "juzcc", "juzhrzzbmlz",	/* 7524 */
+	"jv", "jvadgzuae", "jvakmge", "jvbfa",	/* 7528 */
+	"jvcglmmx", "jvcrwncc", "jvdrufdvol", "jvfjcurdu",	/* 7532 */
+	"jvfmbanbjx", "jvhchqzzjqttn", "jvhhxney", "jvhr",	/* 7536 */
+	"jvidenirniah", "jviu", "jvjappjlr", "jvje",	/* 7540 */
+	"jvkiwnlaaaqq", "jvlpwaxnryja", "jvm", "jvmdfxipsdebk",	/* 7544 */
+	"jvmzarbnxqogt", "jvnbjh", "jvngvtmuca", "jvnsht",	/* 7548 */
+	"jvpgqsji", "jvqfvd", "jvrudesaa", "jvszj",	/* 7552 */
+	"jvtmczpvs", "jvttwddont", "jvvcddq", "jvxfbuoporj",	/* 7556 */
+	"jvylha", "jvyvacca", "jvzzegewd", "jw",	/* 7560 */
+	"jwadtqbftyhyro", "jwbgigwincgnx", "jwc", "jwcfoq",	/* 7564 */
+	"jwebq", "jwegcrvwnyijb", "jwhbeimkfg", "jwhvytk",	/* 7568 */
+	"jwithdwfivm", "jwk", "jwktrwxgaw", "jwnrbvxvedyf",	/* 7572 */
+	"jwnyrzukhz", "jwolznfi", "jwovaep", "jwqkgghxhm",	/* 7576 */
+	"jwrmclc", "jwsvplhhvooihc", "jwufmvkta", "jwvgn",	/* 7580 */
+	"jwvmkotueu", "jwxyfkp", "jwywxl", "jwzlaxsagutxaj",	/* 7584 */
+	"jx", "jxatstdrq", "jxautyp", "jxavqnmeuwoshv",	/* 7588 */
+	"jxdmskgkwr", "jxeeupryistmit", "jxghrbjn", "jxgnxwabimedkr",	/* 7592 */
+	"jxigeirecz", "jxjwpjgneh", "jxlpzbmmn", "jxlxhwkj",	/* 7596 */
+	"jxmcsnevwq", "jxmkmvoplsmls", "jxno", "jxnsp",	/* 7600 */
+	"jxoivim", "jxoswwvhdz", "jxphx", "jxpvwxlnvef",	/* 7604 */
+	"jxqqlx", "jxqxmuvb", "jxsaoypvd", "jxsbwepr",	/* 7608 */
+	"jxsftptbekw", "jxsimd", "jxsplra", "jxtkomkmccktod",	/* 7612 */
+	"jxuh", "jxvsahgj", "jxwbwmi", "jxxhivkrih",	/* 7616 */
+	"jxygltb", "jxytdukc", "jxzpsl", "jy",	/* 7620 */
+	"jyapzzg", "jybklofkmxmsr", "jydcbrxbnh", "jydiq",	/* 7624 */
+	"jydwqq", "jyedeexwwvjq", "jyf", "jyfii",	/* 7628 */
+	"jygmleedy", "jygqweei", "jygssaibvbbzj", "jyiyxzxmwvefc",	/* 7632 */
+	"jyjjo", "jyjoouuhvppyc", "jykfgqxwi", "jykkvlqlzdg",	/* 7636 */
+	"jykwxw", "jymhdwg", "jyni", "jynrz",	/* 7640 */
+	"jyoohgsz", "jyoyptinnh", "jypejbush", "jyqhkv",	/* 7644 */
+	"jyshgpco", "jyumm", "jywduf", "jywnj",	/* 7648 */
+	"jywpgvh", "jywvjc", "jyycnsjdlk", "jyzgfrehgc",	/* 7652 */
+	"jyzk", "jz", "jzadlhqagk", "jzcckdlx",	/* 7656 */
+	"jzdfngc", "jzfblkmlg", "jzgnrszghicnm", "jzgufd",	/* 7660 */
+	"jzhdwoy", "jzhiqfmjrtdpyf", "jzifgam", "jzikpqejuzbaq",	/* 7664 */
+	"jziofxwcuemg", "jzkggl", "jzlq", "jzofrheupnbspf",	/* 7668 */
+	"jzonsfxh", "jzpigefnxcdwlt", "jzpnrjordc", "jzqz",	/* 7672 */
+	"jzsf", "jzt", "jzuyguyunjcjvd", "jzvxslpkldfipd",	/* 7676 */
+	"jzvxyjoozlvvb", "jzvzrqr", "jzwlyo", "jzwwcd",	/* 7680 */
+	"jzxtionth", "jzybgn", "jzz", "ka",	/* 7684 */
+	"kacgmhs", "kacvhve", "kaddtfdma", "kaeuktj",	/* 7688 */
+	"kaf", "kaffoan", "kahgim", "kaifmtqjehher",	/* 7692 */
+	"kajcwe", "kakvhefyribj", "kalqcwe", "kaocqzy",	/* 7696 */
+	"kaoesuqefw", "kaokhhlxwbao", "kaopmuhztd", "kaoujfdhnm",	/* 7700 */
+	"kapfgvvuvfneo", "kapszhyr", "kar", "katyricwg",	/* 7704 */
+	"kauxexefemetqu", "kavebezvur", "kaw", "kawlxedbgr",	/* 7708 */
+	"kaxhwelkbdape", "kaybqdscf", "kb", "kbbgfpsihfcoki",	/* 7712 */
+	"kbceeh", "kbctmwkh", "kbd", "kbfbdqgfsha",	/* 7716 */
+	"kbfgxvnrdwwvqf", "kbhhrendrcynnq", "kbibayjn", "kblehuoxcfxm",	/* 7720 */
+	"kblpabuifkj", "kbmvkbxe", "kbnlofagnlr", "kbotqlwjs",	/* 7724 */
+	"kbphz", "kbrgngxeipl", "kbs", "kbsjqybmxel",	/* 7728 */
+	"kbsoiqxqxjqg", "kbsygzyvdvueh", "kbwcsnvio", "kbwuarut",	/* 7732 */
+	"kbxop", "kbyn", "kc", "kccihx",	/* 7736 */
+	"kccprfovn", "kcedpvxswpb", "kcegsrywyvzgv", "kcepaxc",	/* 7740 */
+	"kcftdszng", "kcgm", "kcgulg", "kcjvefa",	/* 7744 */
+	"kckmcgk", "kcns", "kcovyx", "kcowbxgzb",	/* 7748 */
+	"kcplkdyfh", "kcqr", "kcrpylzfxq", "kcsunijysc",	/* 7752 */
+	"kcszsyepycyyv", "kcszynprpgo", "kctqmhkkavvp", "kcu",	/* 7756 */
+	"kcuwvvwkpasruk", "kcvabb", "kcwzmnu", "kcz",	/* 7760 */
+	"kczdvtklcrptgn", "kd", "kdaxu", "kdbhjvhrqgavwj",	/* 7764 */
+	"kdchttlhgjwt", "kdcn", "kddhau", "kddrokoggd",	/* 7768 */
+	"kdeqhpqtfuesky", "kdingznfoqashk", "kdjsgvtfk", "kdnmd",	/* 7772 */
+	"kdowsqwu", "kdssv", "kdtcft", "kdtrzkmn",	/* 7776 */
+	"kdunfkzekh", "kduusquychft", "kduyeefnc", "kdv",	/* 7780 */
+	"kdzlyoygxsa", "ke", "keadnfanoqf", "keafjkp",	/* 7784 */
+	"keahqjrxfcdryx", "kealhtlqnwhqc", "kebdod", "kecwzibyu",	/* 7788 */
+	"keddxp", "kefbslwgz", "kehcikxkgyn", "keiiilm",	/* 7792 */
+	"kekuqlol", "keldtdhqqnda", "kenju", "kennqb",	/* 7796 */
+	"keplinda", "keppmisr", "kepwaenumq", "keqorqlt",	/* 7800 */
+	"keqykf", "ker", "kexa", "kexdbco",	/* 7804 */
+	"kexvaoutgbtzb", "keyaautomk", "kezdl", "kezrly",	/* 7808 */
+	"kf", "kfcdo", "kfcnapuaom", "kfdnpidmyhnhv",	/* 7812 */
+	"kffnopaxixzg", "kfg", "kfgoibzxptien", "kfhgcyqhwgde",	/* 7816 */
+	"kfhvvx", "kfiflv", "kfklkfi", "kfldbosuwn",	/* 7820 */
+	"kflmfdlxg", "kflwrprzabx", "kfmjw", "kfmoakhiuxvvm",	/* 7824 */
+	"kfncgyymjsx", "kfnscopfdi", "kfnvwz", "kfnxhyv",	/* 7828 */
+	"kfovacyagmh", "kfqcfbcutpfjil", "kfqkxhrbcub", "kfqpmp",	/* 7832 */
+	"kfscekvyov", "kfvgncmwl", "kfvorxfsizoztp", "kfwayjhpewego",	/* 7836 */
+	"kfwgagdwuzagxf", "kfwnyxz", "kfximt", "kfxxjmdzjnnsu",	/* 7840 */
+	"kfzaek", "kfzmcbjepu", "kg", "kgajcgrtbftk",	/* 7844 */
+	"kgawwbhjhp", "kgbjdcacpzkjxp", "kgbr", "kgd",	/* 7848 */
+	"kgdumkbt", "kggdngiu", "kggf", "kgidyljzvjgw",	/* 7852 */
+	"kgionywdqkvbb", "kgjfhjksvq", "kgjkihj", "kgjzjauvwqci",	/* 7856 */
+	"kglvynvuvdop", "kgomrfhglwfvvr", "kgptkissnz", "kgqfbspatfpeb",	/* 7860 */
+	"kgqffifxezcy", "kgquayex", "kgrxkeremwjb", "kgsqmgys",	/* 7864 */
+	"kgtt", "kgumtg", "kgvcjvgzvjqoiq", "kgwbmkr",	/* 7868 */
+	"kgxdt", "kgxgpkaz", "kgxyd", "kgzujfihlckidx",	/* 7872 */
+	"kh", "khb", "khci", "khctdczazz",	/* 7876 */
+	"khesvhjjhz", "khetyyqvqrmn", "khfbzbemltsyus", "khfmkkajrvtn",	/* 7880 */
+	"khfxoylq", "khhdrwzrpj", "khiyrq", "khjvyqlda",	/* 7884 */
+	"khkpvvc", "khlgekl", "khpkizmqrf", "khpw",	/* 7888 */
+	"khqgooekbn", "khsdqbidnpe", "khskxhrdlmxd", "khuwqwzvj",	/* 7892 */
+	"khygmmiekh", "khyskgntrlkx", "khz", "khzozolr",	/* 7896 */
+	"ki", "kiawmmthuunve", "kibgw", "kid",	/* 7900 */
+	"kidr", "kidrm", "kifgugcqox", "kiggfrlxsk",	/* 7904 */
+	"kihufdihvdg", "kiijp", "kiiqvunqswztl", "kij",	/* 7908 */
+	"kikgwtrlhrh", "kiklmuf", "kilyhlwi", "kimvafngtet",	/* 7912 */
+	"kioghrbnpi", "kip", "kippb", "kiqfbskp",	/* 7916 */
+	"kiqitet", "kisdoppsbdk", "kissvz", "kit",	/* 7920 */
+	"kiusgypreo", "kiylg", "kiynm", "kiyqsnqkhh",	/* 7924 */
+	"kizhad", "kizsjwollfea", "kizx", "kjcpukygtbco",	/* 7928 */
+	"kjdw", "kjecdiixzzclh", "kjhta", "kjhxgvrl",	/* 7932 */
+	"kjibisxqj", "kjknvaxvjo", "kjmbwylso", "kjmclgpcc",	/* 7936 */
+	"kjmwes", "kjodfbhojxlnbg", "kjphldtpjfpzu", "kjrrabaxuywhzn",	/* 7940 */
+	"kjsjpxlwanb", "kjthzjtmkchkr", "kjujle", "kjxabetn",	/* 7944 */
+	"kjxhx", "kjxsjnj", "kjzwe", "kk",	/* 7948 */
+	"kkdnp", "kkftjynbjjvvmu", "kkgbbawftokwb", "kkgkaxutay",	/* 7952 */
+	"kkgyd", "kkh", "kkia", "kkkytpvresna",	/* 7956 */
+	"kkmmqbnq", "kkmp", "kkmpftmyxiq", "kknuvvfm",	/* 7960 */
+	"kkop", "kkphosuvi", "kkpvrukxsk", "kkpxcdz",	/* 7964 */
+	"kkpydymo", "kkqkzpovrrxaoj", "kkrpihcgziefzv", "kkryz",	/* 7968 */
+	"kku", "kkxvfnfjrnwnl", "kl", "klaoeustbcjbuu",	/* 7972 */
+	"klbdumwzn", "klbo", "klbxygxilhx", "klc",	/* 7976 */
+	"klcbifarep", "klegikkrou", "klge", "klgyhqtjsrdf",	/* 7980 */
+	"klizanmxb", "kljdmwduuo", "klmbbgfrere", "klmunssjazrewn",	/* 7984 */
+	"klnilu", "klompytcgkv", "klqfzqnykbw", "klrxdzttqerbo",	/* 7988 */
+	"kltoipcbfv", "kltuwr", "kltwmvauisdga", "klv",	/* 7992 */
+	"klvzgkua", "klwf", "klxkuhwfvbha", "klxmpzbb",	/* 7996 */
+	"klxokn", "klyckdyrh", "klzpayykitoh", "km",	/* 8000 */
+	"kmaxtpkwth", "kmcc", "kmcpeulqhw", "kmdgyri",	/* 8004 */
+	"kmdhdkrwzp", "kmdhxmnomtjweg", "kmdtoglkbldjx", "kmgsecgukmoce",	/* 8008 */
+	"kmgviobvadtlia", "kmhpcgp", "kmijs", "kmjvjqfhgws",	/* 8012 */
+	"kmlglnea", "kmlmtqit", "kmlzduwcvrma", "kmmanjlwnasy",	/* 8016 */
+	"kmmefo", "kmoly", "kmomlwddc", "kmopplxuf",	/* 8020 */
+	"kmpeq", "kmpleknrwrgd", "kmpx", "kmpxcivve",	/* 8024 */
+	"kmqgetsv", "kmrvrlohmfh", "kmsfprokto", "kmtpp",	/* 8028 */
+	"kmucgtf", "kmuczne", "kmufvtrmszmatc", "kmuli",	/* 8032 */
+	"kmvlaccbb", "kmw", "kmwd", "kmxpmkasrly",	/* 8036 */
+	"kmyecwjwjf", "kmygka", "kmylf", "kmyz",	/* 8040 */
+	"kmzb", "kn", "knaidhbjos", "knbqemvjoe",	/* 8044 */
+	"kncnvlwfkenmha", "knenyuqf", "knes", "knffjapn",	/* 8048 */
+	"kngi", "kngrd", "kngweupgnhgf", "knh",	/* 8052 */
+	"knifhomtaynymh", "kninlvhcozhui", "knjklikxxq", "knkalzdckue",	/* 8056 */
+	"knkiap", "knlkcdsxhjpin", "knmjr", "knnfwoincjzcyb",	/* 8060 */
+	"knrukxtdgx", "knryqvixjq", "knsddwsyl", "kntmjrawmgd",	/* 8064 */
+	"knukecaiwtfwvh", "knutg", "knuvmln", "knvgmg",	/* 8068 */
+	"knvsshkq", "knwoyomefdx", "knxciyxvrrd", "knyhzigc",	/* 8072 */
+	"knzgidix", "ko", "koa", "koafatxmk",	/* 8076 */
+	"koailmr", "koamhejrtenzml", "koaztrizom", "kobhqdcrpph",	/* 8080 */
+	"kocpgycis", "kocwsd", "kodkbzw", "kodrrlzaccoqx",	/* 8084 */
+	"koegwvegmrvjs", "kofrbxmwgdreiz", "kofrwgak", "kofxwiopdpxozh",	/* 8088 */
+	"kohqz", "kohrx", "kohzijhqkqo", "kokevcrhj",	/* 8092 */
+	"kolzkwxftqduiv", "kom", "komh", "kommwxabqi",	/* 8096 */
+	"kondxbhteogmh", "konliti", "kopfllqpih", "kora",	/* 8100 */
+	"korywgbxtpy", "kosizbk", "kotlvlljywtjw", "kotrjfgq",	/* 8104 */
+	"kottsbrjtbj", "kou", "koupsmqxudzqa", "kovlulxru",	/* 8108 */
+	"kowkqhczrxpztv", "koxn", "koxxyog", "koy",	/* 8112 */
+	"koydpfscl", "koylayfbqvdnen", "kozkklxr", "kozpwrqzdcrzoz",	/* 8116 */
+	"kozsyzrzvi", "kpa", "kpaot", "kpaozdya",	/* 8120 */
+	"kpaxcajpkj", "kpelru", "kpjia", "kpmoeehazprib",	/* 8124 */
+	"kpnlefphy", "kpod", "kppo", "kppqrs",	/* 8128 */
+	"kpqq", "kpqvpo", "kprq", "kprs",	/* 8132 */
+	"kprtusoibv", "kpsstp", "kptarh", "kptdhfrw",	/* 8136 */
+	"kptefmekzfvms", "kpukfsjb", "kpulldfngc", "kpvvjzx",	/* 8140 */
+	"kpwhgfdbf", "kpxg", "kpzvvwcwg", "kq",	/* 8144 */
+	"kqceidqlhvkmdd", "kqcj", "kqctqw", "kqdfhn",	/* 8148 */
+	"kqdpfzjqmo", "kqenpekktng", "kqfwqbp", "kqgpoenldtif",	/* 8152 */
+	"kqia", "kqjcm", "kqjnmnnesj", "kqkpyciporn",	/* 8156 */
+	"kqmshsjgzhi", "kqowzhfdbe", "kqpwmiiadiz", "kqqmuhhub",	/* 8160 */
+	"kqrjlsenxdl", "kqsxdgwbg", "kqtassn", "kquxsjdbovynvk",	/* 8164 */
+	"kqvhewekju", "kqwima", "kqwixirpwd", "kqxctbznotmz",	/* 8168 */
+	"kqxehjr", "krbllqokqg", "krcdam", "krcmij",	/* 8172 */
+	"krfunyjedwtzu", "krfvkddefmdian", "krglbr", "krhssmuwbdkav",	/* 8176 */
+	"kricgisd", "kridagvuvonzcu", "krjbplhkz", "krjoltptnr",	/* 8180 */
+	"krkpylwuuomqwf", "krlcuwvqknr", "krlwmtf", "krlzz",	/* 8184 */
+	"krm", "krmdtwh", "krnafma", "krobgqtiljpx",	/* 8188 */
+	"kroniasbdu", "krpwckqm", "krsgy", "krsqb",	/* 8192 */
+	"krthxcd", "krtlpm", "krumekvu", "krutomzozjalex",	/* 8196 */
+	"krxrpyw", "krzmbwymmgh", "ks", "ksaajmdduw",	/* 8200 */
+	"ksagmashbdxks", "ksakluwtwtpkx", "ksakzw", "kscbht",	/* 8204 */
+	"ksftwfzu", "ksfwuapulmki", "ksgfaziumlxiua", "kshazhcqfujjp",	/* 8208 */
+	"ksjc", "kskcdnaplot", "kskczst", "kskyg",	/* 8212 */
+	"ksllnewdd", "kslxb", "ksm", "ksnd",	/* 8216 */
+	"ksoivblgocji", "ksoovodauynr", "kspiyuy", "ksqloxgnbxa",	/* 8220 */
+	"ksqrnfzaxmmmin", "kstobfqmjvr", "ksuecr", "ksuocibeuhqw",	/* 8224 */
+	"ksvkru", "kswghmwapwvje", "kswlriocqd", "ksxbqoewqlsbld",	/* 8228 */
+	"ksxbzxtskre", "kt", "ktboipvdlj", "ktcbyqtuvjg",	/* 8232 */
+	"ktcsm", "ktcyxf", "ktdoc", "ktdvxibi",	/* 8236 */
+	"ktfcgx", "ktiv", "ktjvg", "ktjzkgurmio",	/* 8240 */
+	"ktkm", "ktngiwsuocf", "ktoyxmrn", "ktpkseexvzcjal",	/* 8244 */
+	"ktqdar", "ktqilkkdjhtywp", "ktqlkthm", "ktqnjbpj",	/* 8248 */
+	"ktqnlkty", "ktqshupgglj", "ktrgqld", "ktst",	/* 8252 */
+	"kttjcu", "ktvonhxlopp", "ktvy", "ktwmhusa",	/* 8256 */
+	"ktxgmutlsms", "ktybknalllttvn", "ktyf", "ktz",	/* 8260 */
+	"ktzeomjayy", "ku", "kua", "kubhulslsdvik",	/* 8264 */
+	"kubj", "kubtmwewmsjnb", "kud", "kufaajwrxt",	/* 8268 */
+	"kugcw", "kuggacei", "kugs", "kuhfzegq",	/* 8272 */
+	"kuiec", "kujfbdxd", "kuoapwpea", "kuoenmrm",	/* 8276 */
+	"kuosfuetcefms", "kup", "kuqj", "kurbtfhevoa",	/* 8280 */
+	"kurmnl", "kuryubuoq", "kusghzx", "kut",	/* 8284 */
+	"kutt", "kutzxjkfti", "kuugzf", "kuuhnazqgd",	/* 8288 */
+	"kuvtnnebrb", "kuw", "kuwf", "kuwfhf",	/* 8292 */
+	"kuwqqsjadcyrid", "kuyaivjsapnk", "kuyr", "kuzyqrlcknpi",	/* 8296 */
+	"kv", "kvarvposeztlz", "kvb", "kvbleeqnyuu",	/* 8300 */
+	"kvcxcn", "kvdc", "kveasbb", "kvefmlywxt",	/* 8304 */
+	"kvekg", "kveql", "kvequarvkyqiz", "kvfltsab",	/* 8308 */
+	"kvgi", "kvhhsiwiunatfq", "kvhsbtau", "kvi",	/* 8312 */
+	"kvia", "kviolaetvndy", "kviqkeixf", "kvja",	/* 8316 */
+	"kvka", "kvnolbza", "kvo", "kvphigtkqm",	/* 8320 */
+	"kvpihhi", "kvqmgrkana", "kvqncsum", "kvqpwfwv",	/* 8324 */
+	"kvqrhhzefwfpfr", "kvqulkpjt", "kvqwnfxcqmre", "kvr",	/* 8328 */
+	"kvrblbwe", "kvsjjdaq", "kvsybqbrgiwoyv", "kvtmvta",	/* 8332 */
+	"kvvqmmmh", "kvxecuyjtzj", "kvxidvlbj", "kvyffvo",	/* 8336 */
+	"kvznkszwimy", "kw", "kwacqjfvpcn", "kwalkpmafmz",	/* 8340 */
+	"kwarmuiyyex", "kwbngkdqczou", "kwbosck", "kwbrktzcwqxmu",	/* 8344 */
+	"kwcmbratq", "kwerfkaol", "kwgdpghoem", "kwglvbovkcvb",	/* 8348 */
+	"kwhcu", "kwhtkuicyyzx", "kwjpezqzk", "kwjtiizztteh",	/* 8352 */
+	"kwjxinmxk", "kwkzeiwg", "kwoyufi", "kwqasfwhozmwrv",	/* 8356 */
+	"kws", "kwvdb", "kwvlpubt", "kwwp",	/* 8360 */
+	"kwy", "kwympfckqoht", "kwyxuqdjsz", "kwzdechujk",	/* 8364 */
+	"kwzrluywc", "kx", "kxayzsze", "kxcpnmcltzafdy",	/* 8368 */
+	"kxczvo", "kxggsiy", "kxgoczgxbuho", "kxgxskwzy",	/* 8372 */
+	"kxibxafao", "kxibzxvymcw", "kxivdazbzz", "kxjfuxwc",	/* 8376 */
+	"kxjhdr", "kxjnx", "kxjre", "kxkfxhpam",	/* 8380 */
+	"kxlnkufwg", "kxnucku", "kxnxlklt", "kxptlywu",	/* 8384 */
+	"kxribllfj", "kxu", "kxuuu", "kxuwota",	/* 8388 */
+	"kxwebfe", "kxwmqy", "kxwsvmaauxhp", "kxxnrjeuegd",	/* 8392 */
+	"kxzuffyg", "ky", "kyb", "kybunvrlvj",	/* 8396 */
+	"kyc", "kycg", "kycvr", "kydofovyargq",	/* 8400 */
+	"kydpy", "kydxu", "kyf", "kyfaqxsqncuy",	/* 8404 */
+	"kyg", "kyhuwgyag", "kyihkkkw", "kykffl",	/* 8408 */
+	"kykngsm", "kylkuupgtwhi", "kymupzxvxmywod", "kymvyexfkm",	/* 8412 */
+	"kypvhndtobln", "kyqcxraeqw", "kysjbho", "kytbuwgbp",	/* 8416 */
+	"kytiwed", "kytzaykj", "kyuo", "kywdsapgm",	/* 8420 */
+	"kywhjp", "kywy", "kyxjstyaxb", "kyyalllx",	/* 8424 */
+	"kz", "kzfmuvn", "kzfsppashtb", "kzg",	/* 8428 */
+	"kzgmaqgoeavhp", "kzht", "kzibwhmss", "kzjmoplbmwparp",	/* 8432 */
+	"kzkmfmiiilj", "kzmwh", "kznwcbbxrsxpd", "kzqnchykhsjw",	/* 8436 */
+	"kzqtszxlwrlkpk", "kzrkubnh", "kzrro", "kztjxugkww",	/* 8440 */
+	"kzujgcplqxvyer", "kzv", "kzwashgzpfw", "kzwwcwxainwe",	/* 8444 */
+	"kzymfh", "kzz", "kzzc", "kzzmnilcwbzuhz",	/* 8448 */
+	"laa", "lad", "ladtmkalzkzmaq", "laewac",	/* 8452 */
+	"laf", "lafftlz", "lafmwwa", "lah",	/* 8456 */
+	"laincnniymxq", "lajsbnlpulvta", "lalbspgzegonp", "lamwq",	/* 8460 */
+	"lanzxooqeprx", "laozl", "lapwdimseibdjk", "latpmogftta",	/* 8464 */
+	"latsfzcputfvse", "latyetevpeq", "lauaymihlflijn", "lav",	/* 8468 */
+	"lavsv", "laxp", "laz", "lb",	/* 8472 */
+	"lbckqmrule", "lbe", "lbegz", "lbeyfmquwgznsm",	/* 8476 */
+	"lbfguk", "lbgnfyawazhaf", "lbifzk", "lbj",	/* 8480 */
+	"lbklnv", "lbkzlsiymrwc", "lbob", "lbqosxvo",	/* 8484 */
+	"lbsbjgb", "lbsdzv", "lbustdjan", "lbuwmxwq",	/* 8488 */
+	"lbwbkswpgmt", "lbwfjgzcdaoi", "lbxz", "lbycwcdkd",	/* 8492 */
+	"lbypoolbze", "lbzzhvhg", "lc", "lcagkd",	/* 8496 */
+	"lcbrffaizejf", "lcc", "lcdi", "lceolg",	/* 8500 */
+	"lcfvfggzutbqt", "lcgmtoxgqxc", "lchthkgyr", "lchv",	/* 8504 */
+	"lciku", "lcjkidygyr", "lcjnmisggg", "lckts",	/* 8508 */
+	"lcmmuzfzd", "lcnhyyefid", "lcnulnufqlh", "lcoqznmyicoo",	/* 8512 */
+	"lcpepmwgfjs", "lcszliq", "lcth", "lctzgydfnuwi",	/* 8516 */
+	"lcupldk", "lcw", "lcwylflwzvwjjx", "lcxzhgd",	/* 8520 */
+	"lcz", "ld", "ldatxfpevlorrw", "ldc",	/* 8524 */
+	"ldchvexsegc", "ldctepdcqxnuqk", "lddeaabvyxdbf", "ldjifpxkb",	/* 8528 */
+	"ldkpiifx", "ldlgwbmqfsxjdb", "ldlwusoe", "ldndoirq",	/* 8532 */
+	"ldoglxgauaw", "ldqbdnnxagmcr", "ldrdxxcmoqx", "ldsceccdmqien",	/* 8536 */
+	"ldsyt", "ldt", "ldtfrhxamtk", "ldwgxadhxwt",	/* 8540 */
+	"ldwhidpnmtlrl", "ldzkxmuxfnr", "le", "leabrxeewx",	/* 8544 */
+	"leaqncrwveoy", "lec", "leeanebgmwiatt", "leecbqwevbyv",	/* 8548 */
+	"leezmsxdfgq", "lefla", "legk", "lehhpikbio",	/* 8552 */
+	"leijtlarb", "lejz", "lelxkscpaezce", "lembcicypgo",	/* 8556 */
+	"lengl", "leqncyyzbouzr", "leqyscdhjya", "lescbjzu",	/* 8560 */
+	"lesjdcmsjc", "leus", "leutjyxoktqwyc", "levaqbu",	/* 8564 */
+	"leweuvyionjxem", "leyfcfnngk", "lf", "lfar",	/* 8568 */
+	"lfbv", "lfbzlcthv", "lfclboamhe", "lfeeswh",	/* 8572 */
+	"lfeyukfaj", "lffngtwuhplmp", "lfhbitxjftngl", "lfhkzbtt",	/* 8576 */
+	"lfjqq", "lflapsdlvwkj", "lfljhihudfm", "lflzoeg",	/* 8580 */
+	"lfmnfxb", "lfmwigvkqlg", "lfmxbezjqwtnuf", "lfnlxogzuyx",	/* 8584 */
+	"lfoqzfblzlfv", "lfpcexgvbbv", "lfpiuqeifw", "lfrysxjprfn",	/* 8588 */
+	"lfsnxoq", "lfwcxp", "lfzrjgfqncmiog", "lfzrl",	/* 8592 */
+	"lg", "lgafi", "lgdeykqmqdpaco", "lgdivnhibvdva",	/* 8596 */
+	"lge", "lgecngxeu", "lgg", "lggddwnlouw",	/* 8600 */
+	"lgk", "lgkmbk", "lgnccditi", "lgnoustuiobokb",	/* 8604 */
+	"lgnzcighye", "lgodqclhvsptb", "lgpsc", "lgptcpu",	/* 8608 */
+	"lgrgqzyf", "lgs", "lgsimbunmw", "lgw",	/* 8612 */
+	"lgy", "lgyglqpva", "lgyicppvdkwmtj", "lgyw",	/* 8616 */
+	"lh", "lhbdgyv", "lhbsjfjbzlim", "lhbtmt",	/* 8620 */
+	"lhbwcopzebhj", "lhcbpdmxrxgn", "lhcqg", "lhcyr",	/* 8624 */
+	"lhczk", "lhd", "lhdwborrz", "lhe",	/* 8628 */
+	"lheqdjaitzrs", "lhevfudgwg", "lhgwyqegsvx", "lhgzreamn",	/* 8632 */
+	"lhkw", "lhlhcnalpedri", "lhlovothz", "lhlzrceklq",	/* 8636 */
+	"lhnef", "lhomrmqhef", "lhoseowfepc", "lhqldqzhp",	/* 8640 */
+	"lhtcdhljgkuj", "lhumcu", "lhwaktmj", "lhwgpqjdfpy",	/* 8644 */
+	"lhwht", "lhxbymxhuysshq", "li", "libheoypzf",	/* 8648 */
+	"licj", "liclqaigggvclh", "licqiqkn", "lid",	/* 8652 */
+	"lidjwnoawhxtl", "lidxxxcwlm", "ligbfrytsqbafl", "ligfvzuddfgeh",	/* 8656 */
+	"lihgdipkcy", "lihko", "lihqesyznkpyxd", "lijfraaiurwsa",	/* 8660 */
+	"likjefcovfthms", "liks", "limp", "limw",	/* 8664 */
+	"liogoys", "lipdcicoisg", "lipmv", "lir",	/* 8668 */
+	"lirxehxfk", "lirygzisuf", "listbjuuslvm", "liunfytc",	/* 8672 */
+	"livwe", "liwyjpfvjqafh", "liysjzile", "lizrwmkbdf",	/* 8676 */
+	"lj", "ljau", "ljbggfycpng", "ljbgoawtycp",	/* 8680 */
+	"ljcb", "ljci", "ljdyjpwgucej", "ljelibio",	/* 8684 */
+	"ljf", "ljfnnvfrwxsl", "ljfoqsrbjt", "ljfu",	/* 8688 */
+	"ljgaiur", "ljhbofzejbw", "ljiog", "ljivjcjb",	/* 8692 */
+	"ljjymfidssulo", "ljkfwehmtyod", "ljmdsehxxami", "ljmvwso",	/* 8696 */
+	"ljmxtuohydubho", "ljov", "ljrvrwfgl", "ljtejvwandxsx",	/* 8700 */
+	"ljulznko", "ljvxffmxcqilv", "ljwlkjcdjxu", "ljwlxzkladm",	/* 8704 */
+	"ljwvshi", "lk", "lkalr", "lkanzstuuxchgs",	/* 8708 */
+	"lkcaklwhho", "lkftmgiw", "lkgmbxu", "lkgxgyfu",	/* 8712 */
+	"lkhvwrbvo", "lkjiuzowi", "lkknmfghcvf", "lkkpawflojvbr",	/* 8716 */
+	"lkkx", "lklz", "lkmjfpfwyxnbvt", "lkoycoza",	/* 8720 */
+	"lkqjtsxcsmmk", "lkrq", "lkrrincmgxox", "lksetjhdsz",	/* 8724 */
+	"lktupqrawzcbh", "lkurbkued", "lkvfncqdg", "lkvrmp",	/* 8728 */
+	"lkxdb", "lkysmux", "lkytvvtkq", "ll",	/* 8732 */
+	"llalcdpoqrtdbf", "llbvkkwoccozzv", "lle", "lleogrprjtg",	/* 8736 */
+	"llezgsxajgkmng", "llglrwg", "llgs", "llgxcvktprhhp",	/* 8740 */
+	"llhskwcucxcbub", "llnnba", "llr", "llrat",	/* 8744 */
+	"llrqrj", "lls", "llsnloqlblj", "llthijkehqrpv",	/* 8748 */
+	"lluadozymjw", "llucficrnuicvy", "llvpsenf", "llwabaqyawchk",	/* 8752 */
+	"llx", "llxazjbmd", "llyubr", "llzzvzdih",	/* 8756 */
+	"lm", "lmalwdoenhjm", "lmctgtxtyxx", "lmcwfeq",	/* 8760 */
+	"lmephgnnuhdtvu", "lmeyutbp", "lmfwctwuauz", "lmghmeduwgvqm",	/* 8764 */
+	"lmhscaras", "lmhvplowxw", "lmjsra", "lmlnh",	/* 8768 */
+	"lmo", "lmql", "lmstogr", "lmtaslv",	/* 8772 */
+	"lmtgczdo", "lmtomti", "lmuemcpiso", "lmumvjeof",	/* 8776 */
+	"lmupnsdrtufwil", "lmutqbzrbxok", "lmvjtiagmlq", "lmvvhtu",	/* 8780 */
+	"lmwe", "lmwrybhmjnobz", "lmx", "ln",	/* 8784 */
+	"lnarxkgeoox", "lnavbixdkqek", "lnaykmlhoxhzct", "lnbfpvimsgmihc",	/* 8788 */
+	"lnbx", "lncdzf", "lncngdhlw", "lncnzkwgz",	/* 8792 */
+	"lndfgedyfzqezt", "lnejrgbno", "lnfja", "lnhqaiybwbgz",	/* 8796 */
+	"lnis", "lnjn", "lnnodqiznathf", "lnnvmsrtzknrfr",	/* 8800 */
+	"lnog", "lnomncpfqvgfd", "lnpuob", "lnqkdvlooba",	/* 8804 */
+	"lnshoimlmzsh", "lnsybtndp", "lnujbshxyk", "lnvqopmra",	/* 8808 */
+	"lnvuyspkdlzv", "lnxcbhtzpkns", "lnygsptvcnlk", "lnyqnyacdomy",	/* 8812 */
+	"lo", "loa", "loaqy", "lobw",	/* 8816 */
+	"loewdnhev", "logfhgcp", "loglw", "loifxpyukkiw",	/* 8820 */
+	"loizzuaadffli", "loj", "lojcicowyrfwn", "lolvj",	/* 8824 */
+	"lolyk", "lomdujc", "lomhnklown", "lomhxdxh",	/* 8828 */
+	"lomiiqayikle", "loprq", "loqdalbpdtkxf", "loqrxbfjuxwr",	/* 8832 */
+	"lorhucdscu", "loricf", "losuasaptvodxe", "lotfcx",	/* 8836 */
+	"louekjkcjvf", "loueubzksku", "lov", "loxlunwcvubk",	/* 8840 */
+	"loykblacwa", "lp", "lpaw", "lpcwsggg",	/* 8844 */
+	"lpdfh", "lpdfmj", "lpefbtao", "lpefigmqzve",	/* 8848 */
+	"lpeoeuwpe", "lpeotc", "lpgdajekwlnk", "lpgxawffako",	/* 8852 */
+	"lphcugnm", "lpi", "lpihzqyk", "lplm",	/* 8856 */
+	"lpo", "lpokljzrdkmxf", "lppvvxetzjudr", "lpqeyfwenybcl",	/* 8860 */
+	"lprefnxjgngwns", "lprri", "lpryniyctl", "lpsiyyhdtd",	/* 8864 */
+	"lpsrmeqxkujhu", "lpsvykdy", "lpthz", "lpuwdfqzk",	/* 8868 */
+	"lpw", "lpxyapiwbljy", "lpyoq", "lpyrq",	/* 8872 */
+	"lpz", "lpzuocgpdlc", "lq", "lqccbqwywwz",	/* 8876 */
+	"lqeybrhrvgiw", "lqgdnfymgonjf", "lqgkdmatl", "lqhr",	/* 8880 */
+	"lqihmvfdkntpv", "lqikozjyjlzyp", "lqiukgqcdhkpsx", "lqll",	/* 8884 */
+	"lqlmtidiqdpc", "lqqcfgax", "lqrtskwbzxmo", "lqruvedyygoivu",	/* 8888 */
+	"lqrzyywtnjdrh", "lqtlnsjln", "lqttqjg", "lqturiid",	/* 8892 */
+	"lqtvfsqvzhao", "lqxhbbtposs", "lqxqksoji", "lqxs",	/* 8896 */
+	"lqyicpcyghqzt", "lqynlnfkzyn", "lqyvscx", "lqzmgzeskdhfkw",	/* 8900 */
+	"lr", "lrbdoibs", "lrbfxfol", "lrdewjhtur",	/* 8904 */
+	"lrdfbdgysb", "lrdnxarsqv", "lrdsbassleylnq", "lrfjghfdu",	/* 8908 */
+	"lrgzgvhxolzj", "lrhhixxetcoal", "lrjn", "lrlqjveeooy",	/* 8912 */
+	"lrltt", "lrp", "lrprf", "lrq",	/* 8916 */
+	"lrqoykytofshrb", "lrtdar", "lrtgxc", "lrtuywsqhabpd",	/* 8920 */
+	"lrvmfxt", "lrvmiisex", "lrwrhwbfz", "lrxjidacswxovv",	/* 8924 */
+	"lryceretpoxy", "lryebm", "lrzugksdsf", "lrzv",	/* 8928 */
+	"ls", "lsalwshiqdaeq", "lsd", "lse",	/* 8932 */
+	"lsfgrrownar", "lsgnuynuqdxh", "lsikgwgsjjzf", "lsjfgn",	/* 8936 */
+	"lsk", "lskoyptmudlm", "lsl", "lsladm",	/* 8940 */
+	"lsmcxe", "lsmgnaigqlgs", "lsnwmdm", "lsqa",	/* 8944 */
+	"lsqchlkqibtie", "lsqjnimyifbh", "lsrqrzxbikjpq", "lssfacgfu",	/* 8948 */
+	"lstemx", "lsxgasxtjlsfls", "lsxzpflsjst", "lsyboysbdxlfp",	/* 8952 */
+	"lsyrcbckho", "lsyyce", "lszuenoycyxle", "lt",	/* 8956 */
+	"ltafi", "ltcgk", "ltcwh", "ltfqdvhujp",	/* 8960 */
+	"ltgfmy", "ltgfzh", "lthxufzrrigy", "ltiddfprzp",	/* 8964 */
+	"ltjekawzzg", "ltkoqmoktctcv", "ltkxolpuqoyck", "ltlhazrtfotejm",	/* 8968 */
+	"ltndijpt", "ltnpgyrzjvs", "ltoawxu", "ltphkftyf",	/* 8972 */
+	"ltqslb", "ltqttkecwccb", "ltqxrgy", "ltrmkcucqhwe",	/* 8976 */
+	"lts", "ltsgfqnpzwqxq", "ltvxkduazc", "ltvzpaxodwu",	/* 8980 */
+	"ltxbaajcsqm", "ltxhmr", "ltxqfpbvxo", "ltybxnf",	/* 8984 */
+	"ltycbjwyyog", "ltyhommtf", "ltymnme", "ltyqmtex",	/* 8988 */
+	"ltzbgj", "lu", "luav", "lubxl",	/* 8992 */
+	"lucegwt", "ludgtcwbctj", "lueggiqugxgos", "luezomtk",	/* 8996 */
+	"lugxxdtpfronnh", "luhidne", "luhlof", "luiiiip",	/* 9000 */
+	"luiik", "luixlshljpclzd", "lul", "lulwediqzgmer",	/* 9004 */
+	"lun", "lunkgdljearkfj", "lunlswijrovca", "lunurhq",	/* 9008 */
+	"luoifvlg", "lurkkj", "lut", "luugtwxvspqx",	/* 9012 */
+	"luuq", "luvqeeujtpr", "luwijannfplgk", "luzfdcg",	/* 9016 */
+	"lv", "lva", "lvbwuvyt", "lvcbxfr",	/* 9020 */
+	"lvcdtxb", "lvdbjrviihk", "lveamqbgjc", "lveiwwlaq",	/* 9024 */
+	"lvgtxgthz", "lvhfyd", "lvhha", "lvjewjcnh",	/* 9028 */
+	"lvjnwfd", "lvkbpaetylnpc", "lvksmultjg", "lvl",	/* 9032 */
+	"lvlkar", "lvlmsd", "lvm", "lvmcitof",	/* 9036 */
+	"lvmybvm", "lvnhry", "lvnldkhjjily", "lvokides",	/* 9040 */
+	"lvpqnhmy", "lvrjg", "lvtbrrdimbzm", "lvunipbwysscc",	/* 9044 */
+	"lvvhaz", "lvvzc", "lvwirdpq", "lvwnck",	/* 9048 */
+	"lvwnrkflbg", "lvwvwiqpx", "lvxa", "lvxaeavg",	/* 9052 */
+	"lvxrbghzsijigq", "lvycsjo", "lvzkpzacghcxeh", "lvzplr",	/* 9056 */
+	"lw", "lwb", "lwbhlztwif", "lwdsadaj",	/* 9060 */
+	"lwfxijguscqlp", "lwfy", "lwgoggvhdmzsfh", "lwhbjk",	/* 9064 */
+	"lwhlcmcfmvpccm", "lwhxdpupipeiuy", "lwjhwcdfr", "lwjmqla",	/* 9068 */
+	"lwjzgqavambbx", "lwlshkrm", "lwlwavpq", "lwnczku",	/* 9072 */
+	"lwnfwsrvldkcgb", "lwnq", "lwobsuqjwqmfa", "lwpjrev",	/* 9076 */
+	"lwqguggqauc", "lwshatheoydpd", "lwsnitejsz", "lwsqmjgihuogkm",	/* 9080 */
+	"lwvddw", "lwvjgkvis", "lwwe", "lwwukophwg",	/* 9084 */
+	"lwxhlpl", "lwz", "lwze", "lwzxt",	/* 9088 */
+	"lx", "lxbt", "lxckd", "lxewkquwzhkiu",	/* 9092 */
+	"lxihgvdmgj", "lxklc", "lxl", "lxlssprgw",	/* 9096 */
+	"lxmcszbeb", "lxmvybazuxj", "lxohaqyfu", "lxopeakn",	/* 9100 */
+	"lxpylirodnu", "lxqhvbehszj", "lxqmalu", "lxrfyyb",	/* 9104 */
+	"lxsyeensucsxie", "lxterduzu", "lxtgkhhappmkie", "lxtv",	/* 9108 */
+	"lxvkqsrslpe", "lxyeds", "lxykybifyjn", "lxypjmjda",	/* 9112 */
+	"lxywlx", "lxzinl", "ly", "lyaiz",	/* 9116 */
+	"lycwybgofonsr", "lycxgrwz", "lydiomxkjeppm", "lydnxlbaawaok",	/* 9120 */
+	"lyffwxvjt", "lyjinz", "lyjllkzobtcxe", "lykvjdymz",	/* 9124 */
+	"lylfhtgthd", "lyn", "lyp", "lypvgg",	/* 9128 */
+	"lyqjbvuthvycb", "lyqoi", "lyqyx", "lyrsig",	/* 9132 */
+	"lyspvr", "lytdgeyyxbyovb", "lyto", "lyuyqq",	/* 9136 */
+	"lyvjtlfcelujzq", "lyw", "lywo", "lyxicnkqq",	/* 9140 */
+	"lyxpnvpket", "lyxt", "lyznfjgcbziiy", "lz",	/* 9144 */
+	"lzaoikcl", "lzbzdomaep", "lzcdnuhzx", "lzdewjgaeccmw",	/* 9148 */
+	"lzefnwjrew", "lzflponekpm", "lzhknt", "lzjndud",	/* 9152 */
+	"lzkmfy", "lzkqwb", "lzkvxjqqbka", "lzmmehstuzdire",	/* 9156 */
+	"lznk", "lznnwswrtcd", "lzpll", "lzpssxooprnlzb",	/* 9160 */
+	"lzqiidmtnc", "lztb", "lztnqdoheoh", "lzu",	/* 9164 */
+	"lzuikdwggkts", "lzvqyarrsr", "lzwkg", "lzwmfjug",	/* 9168 */
+	"lzwxpklisc", "lzyoyal", "lzyxnj", "lzztc",	/* 9172 */
+	"ma", "maaankzlvj", "maakpjmnqnd", "mab",	/* 9176 */
+	"macvxdkjcy", "madh", "madyaoloobqr", "maexr",	/* 9180 */
+	"magm", "magqpotnp", "magvo", "mahiqehbjcbt",	/* 9184 */
+	"mahjbu", "mahmbfm", "majxkndr", "malgcdy",	/* 9188 */
+	"malqjhmpmlb", "mampwo", "manppyw", "manyglvtem",	/* 9192 */
+	"maobhjarb", "mapchedlltc", "mapjctbs", "maqrtk",	/* 9196 */
+	"markqqmina", "masw", "matf", "matw",	/* 9200 */
+	"mau", "mauonb", "mawa", "maxlf",	/* 9204 */
+	"maybzercnxjlcp", "mb", "mbblzegks", "mbdsvtzyhca",	/* 9208 */
+	"mbekvmrzctyojk", "mbg", "mbgifkikb", "mbgolmkeresn",	/* 9212 */
+	"mbgqet", "mbjfbksgfzs", "mbkiejqz", "mbkkdknatazlzf",	/* 9216 */
+	"mblbiajkcla", "mblbprdkaua", "mbnnc", "mbovcgdrolziq",	/* 9220 */
+	"mbpcxbqohih", "mbqnaqvhsop", "mbrkdhzfjdjdcv", "mbthitjdcvxsqe",	/* 9224 */
+	"mbubjlhx", "mbuqf", "mbybex", "mca",	/* 9228 */
+	"mcajzk", "mcbnpm", "mccaixedehu", "mccazquay",	/* 9232 */
+	"mcccjwoke", "mcdmsequh", "mcehtses", "mcemh",	/* 9236 */
+	"mcenzdmb", "mceyrdcaepiqqt", "mcezzgps", "mcfrnxe",	/* 9240 */
+	"mch", "mchybhpraaqz", "mcih", "mcjkm",	/* 9244 */
+	"mcjrhk", "mcmm", "mcmwcfmht", "mcmzqsujmil",	/* 9248 */
+	"mcmzqsx", "mcnhpkftudhc", "mcrmeqfc", "mcrxcpgppaidbg",	/* 9252 */
+	"mcsrazttz", "mcwcyh", "md", "mdakn",	/* 9256 */
+	"mdbwo", "mdcudsqhgvikb", "mddncs", "mddvkttuwws",	/* 9260 */
+	"mdfzhdojxkgikf", "mdg", "mdixubzzcxmr", "mdjfumvrcmgpyx",	/* 9264 */
+	"mdjzd", "mdkxag", "mdlnawkcuns", "mdmrfzpoofyje",	/* 9268 */
+	"mdnaqttjrvai", "mdojv", "mdpdyzvcsnoj", "mdpibroy",	/* 9272 */
+	"mdpkwjqobzpjk", "mdpysfkapvpr", "mdqrpdrfrbbew", "mdsfrwfnbgs",	/* 9276 */
+	"mdsubhjtvo", "mdtpdemtw", "mdtpnmcmyxokvy", "mdujzm",	/* 9280 */
+	"mdunp", "mdvgnnujjuokb", "mdwgoueuyian", "mdwgyudutulaa",	/* 9284 */
+	"mdz", "mdzpqbv", "mdzttgkanox", "mdzxarfuk",	/* 9288 */
+	"me", "meadygnjkjud", "meah", "meaxt",	/* 9292 */
+	"meb", "medjxrmvjbir", "medlxothitffo", "medzcgigvsaui",	/* 9296 */
+	"meefqpzfaqf", "mefvki", "mehgx", "mehqsjhe",	/* 9300 */
+	"mehuhhxjvyjx", "meirvdij", "meizixi", "mejxruilpedf",	/* 9304 */
+	"mejyalbpjgtn", "mekuwwkngknj", "menfoihtrg", "menzugwgvcfx",	/* 9308 */
+	"meomfpoqsb", "meoqpjxulhhszm", "mepbgu", "meqfyvv",	/* 9312 */
+	"meqslrskgtemh", "mer", "meredk", "mew",	/* 9316 */
+	"mewn", "mexb", "mexeftqr", "mexmaot",	/* 9320 */
+	"mexz", "mey", "meyojriqsms", "meyxiuqychbli",	/* 9324 */
+	"mezsyujb", "mfaqpplrnautv", "mfb", "mfbkbdr",	/* 9328 */
+	"mfctbh", "mfcueuq", "mfdgwejraqgjz", "mfeozmb",	/* 9332 */
+	"mffhzjdbtgat", "mfg", "mfgtnhbbxuflfh", "mfhjwn",	/* 9336 */
+	"mfjrwmgs", "mfkt", "mfltkg", "mfokyfloo",	/* 9340 */
+	"mfqqvhfdrs", "mfqqvxca", "mfrfguqqmtmlss", "mfrivanpfji",	/* 9344 */
+	"mfsyulcrojpxl", "mftev", "mfthupqe", "mftljzzymtrpw",	/* 9348 */
+	"mfvsfkiqhps", "mfwiltrpm", "mfwjl", "mfwlfqrc",	/* 9352 */
+	"mfwqhocx", "mfwwyify", "mfwxnuu", "mfxqzwehego",	/* 9356 */
+	"mfxyrighpor", "mfyb", "mfyndfygc", "mg",	/* 9360 */
+	"mgdeymvlg", "mge", "mgguu", "mghxvualvpbsf",	/* 9364 */
+	"mgkksjmpn", "mgmqllwyvtbt", "mgmtlox", "mgol",	/* 9368 */
+	"mgotcqdobdg", "mgozgbojb", "mgpzjcwldtt", "mgq",	/* 9372 */
+	"mgqgsydhg", "mgqkgj", "mgruxryqfdqok", "mgskeuikugtb",	/* 9376 */
+	"mgveq", "mgvoa", "mgxcjeggcrn", "mgyzimwdsnvhj",	/* 9380 */
+	"mgzaxlsygv", "mgzoianxotpf", "mh", "mhb",	/* 9384 */
+	"mhbvrhiitjj", "mhbvwjcqyaccn", "mhcg", "mhdrqk",	/* 9388 */
+	"mhf", "mhjbdu", "mhjli", "mhjswivvjldste",	/* 9392 */
+	"mhk", "mhkifz", "mhl", "mhll",	/* 9396 */
+	"mhltzglru", "mhmdkkywmdav", "mhmizbxmb", "mhmld",	/* 9400 */
+	"mhmnxjrqy", "mhnsusfxgror", "mhohzllhf", "mhoqeflekr",	/* 9404 */
+	"mhpgjgql", "mhpom", "mhptskr", "mhpurwzkd",	/* 9408 */
+	"mhpwgpbzzi", "mhqarubu", "mhqbtqmau", "mhs",	/* 9412 */
+	"mhtnije", "mhuftdxjwjkj", "mhx", "mhxqerydnr",	/* 9416 */
+	"mhyqrdadsoju", "mhyrbmswgz", "mi", "mibyynov",	/* 9420 */
+	"mic", "micxhfcoa", "miecblqfgypss", "miewagrew",	/* 9424 */
+	"mifrjxoiqwcwax", "migt", "migyxrxrfvnl", "mihxsthccj",	/* 9428 */
+	"miigu", "miimpwoun", "mijliqiuo", "mijmosjlpnsi",	/* 9432 */
+	"mikzdueglpuk", "milge", "mimkcjeiuvae", "mimo",	/* 9436 */
+	"minbiicxlwikmv", "minefx", "minyncfpoag", "miohxntzauyle",	/* 9440 */
+	"miojhtcdqxdj", "miomie", "miproieur", "misgpppht",	/* 9444 */
+	"mismoihgezi", "mitbkvphmcgr", "mitib", "miticfmdz",	/* 9448 */
+	"mitihiegakggt", "miv", "mivfgoumygfa", "mivsxsslhbbiih",	/* 9452 */
+	"miw", "mixbfhduzfncw", "miy", "mizcc",	/* 9456 */
+	"mj", "mjbfu", "mjbrajw", "mjdqlmhwad",	/* 9460 */
+	"mjfgvzshpeqzdh", "mjfwwnvlbthk", "mjghfdpre", "mjgjwylwpjv",	/* 9464 */
+	"mjhfphush", "mjhujrebtq", "mjiaxiklj", "mjiy",	/* 9468 */
+	"mjjdqhxck", "mjjz", "mjk", "mjlfgpiuh",	/* 9472 */
+	"mjmoxnxuevhu", "mjn", "mjnliiwabcopes", "mjnqwwhn",	/* 9476 */
+	"mjnszrjczy", "mjntsj", "mjqcyhtiywhcv", "mjrgusjgs",	/* 9480 */
+	"mjv", "mjvkt", "mjxcvtlvohpjq", "mjymg",	/* 9484 */
+	"mjynpl", "mjzr", "mk", "mka",	/* 9488 */
+	"mkbbdx", "mkcsy", "mke", "mkeeoqceada",	/* 9492 */
+	"mkf", "mkgawdsny", "mkgbdzprbz", "mkhk",	/* 9496 */
+	"mkir", "mkjssl", "mkjy", "mkmqsjnxbhix",	/* 9500 */
+	"mkmwhxaf", "mkndlngjna", "mkpfprq", "mkpoih",	/* 9504 */
+	"mkqzptsj", "mkrjal", "mktwzyelc", "mkw",	/* 9508 */
+	"mkydnfsazshe", "mkyqaoymc", "mkzxvspdum", "ml",	/* 9512 */
+	"mlayipjyqtr", "mlbnu", "mlchustznymbsg", "mlcudlkv",	/* 9516 */
+	"mlcxucdfjj", "mldssrsxbxi", "mleastpqfdpjem", "mlht",	/* 9520 */
+	"mliuvuaguxt", "mljykozw", "mlmhrgsrnyex", "mlmiyrhimzeue",	/* 9524 */
+	"mlpebryhjtg", "mlpzdmei", "mlq", "mlqcctczb",	/* 9528 */
+	"mlrxbkkpaibii", "mlsm", "mlstexxjt", "mlu",	/* 9532 */
+	"mlv", "mlvenvnvhvarle", "mlwvbxgnjh", "mlxpal",	/* 9536 */
+	"mlxu", "mlyzise", "mm", "mmaefrz",	/* 9540 */
+	"mmavycbsapdue", "mmbhdwcitaytx", "mmbqrdoxue", "mmc",	/* 9544 */
+	"mmcdwttxkhhvdd", "mmcivormxgsf", "mmckkeiito", "mmdzafgtsh",	/* 9548 */
+	"mmehlyrpex", "mmejw", "mmenossnqjvpef", "mmewddgvsvidm",	/* 9552 */
+	"mmfquzims", "mmfsckiakj", "mmgddzqkxyj", "mmghvqakbftu",	/* 9556 */
+	"mmgnfjnyvcpin", "mmgu", "mmiu", "mmjnt",	/* 9560 */
+	"mmjwjhodgss", "mmk", "mmlsnfkise", "mmmpvcwmvo",	/* 9564 */
+	"mmmqlo", "mmnyfs", "mmoawvhrecpm", "mmojcpbpxdkfz",	/* 9568 */
+	"mmpatljbps", "mmpmmm", "mmq", "mmqnjabld",	/* 9572 */
+	"mmqqroicfy", "mmrrdodktpz", "mmsbfureuipt", "mmsxvawngeoo",	/* 9576 */
+	"mmtrgn", "mmuaydopppppr", "mmub", "mmudlmeqaosdn",	/* 9580 */
+	"mmui", "mmwgzulwxcu", "mmxkdyryjispho", "mmxmrqzhz",	/* 9584 */
+	"mmz", "mn", "mnaficxod", "mnayaxmmojdi",	/* 9588 */
+	"mnbcwlnwt", "mnbvtqdsxyvmr", "mndbzzebqqdhvm", "mndwtytxrd",	/* 9592 */
+	"mnfxgmoamftw", "mnghqecwwxjg", "mnijx", "mnj",	/* 9596 */
+	"mnkifhsqxvnehw", "mnldyssjhpe", "mnlomewmgob", "mnltcpz",	/* 9600 */
+	"mnmyfags", "mnoskzvlnanl", "mnpvkvcq", "mnskzwjas",	/* 9604 */
+	"mntnhlwo", "mnugp", "mnujzzjznnvro", "mnuuqgrcvkhvr",	/* 9608 */
+	"mnvnels", "mnw", "mnweinnotioxt", "mnwwconnqbyt",	/* 9612 */
+	"mnxbmfl", "mnyowuyla", "mnyt", "mnznyvssclffni",	/* 9616 */
+	"mo", "mob", "mod", "modebzgsuqnb",	/* 9620 */
+	"moep", "mofllvba", "mofznp", "mogldiyrcaei",	/* 9624 */
+	"mok", "momuhmdaxqbfy", "mopyfoom", "moqlayqijd",	/* 9628 */
+	"moqmtgixunw", "morcrrkc", "morpzhf", "mortw",	/* 9632 */
+	"motuv", "mou", "moyhxuksljau", "mozuajbfmtokyg",	/* 9636 */
+	"mpa", "mpcbokltscsmb", "mpcebw", "mpdnzufwvpgu",	/* 9640 */
+	"mperkdkb", "mpgaukdlfkqqh", "mpgbebbqi", "mpjwtoydd",	/* 9644 */
+	"mpkmwgawtk", "mpmchzvxvywcak", "mpmmm", "mppkwmz",	/* 9648 */
+	"mprrgyyodvugyy", "mpsokebqvbgtct", "mptnwax", "mpviqstqsvf",	/* 9652 */
+	"mpxdzvlwn", "mpxy", "mpzqhndbnth", "mq",	/* 9656 */
+	"mqcjr", "mqi", "mqijihvipdnnoe", "mqjquv",	/* 9660 */
+	"mqkwijpsrzebcv", "mqljuptrfeht", "mqnokbmer", "mqnxxvzanhgna",	/* 9664 */
+	"mqnyannwrvks", "mqo", "mqoifinyxncm", "mqpco",	/* 9668 */
+	"mqqonp", "mqqrqmyydynknv", "mqqw", "mqrkfe",	/* 9672 */
+	"mqslkuzjqgwpj", "mqsxahmvavaq", "mqsxtdimtttr", "mqvkzsozyiokmb",	/* 9676 */
+	"mqvtfjcjybsusj", "mqyizamxpe", "mr", "mrasqjaxmkdi",	/* 9680 */
+	"mrcihgumflaior", "mrcnt", "mrcxbrbalxvqxi", "mrdezmvigxzucn",	/* 9684 */
+	"mreemydezgapf", "mreyrqekocb", "mribg", "mridkxvrlkzaa",	/* 9688 */
+	"mrixadgkopi", "mrixorcnac", "mrjpkwhgxzfoen", "mrll",	/* 9692 */
+	"mrngvhvgjecba", "mrpdkwpeni", "mrpi", "mrpkkzu",	/* 9696 */
+	"mrrswjy", "mrsdoglscmm", "mrtekxsn", "mrtghikbnvb",	/* 9700 */
+	"mru", "mruvgenfdsdxjf", "mrwj", "mrzdieqnv",	/* 9704 */
+	"mrzepthyprngr", "mrzyyuv", "ms", "msabfomrne",	/* 9708 */
+	"msalnlgcuwkgcz", "msaq", "msbkhifnt", "msbzzq",	/* 9712 */
+	"msdaozsfuz", "msdxpivl", "mseqeqnmdt", "msggrkgqgwq",	/* 9716 */
+	"mshbxypz", "msingqtjogh", "msjasuhzaykww", "mslcbroz",	/* 9720 */
+	"mslizumint", "mslmocvswikak", "msmsnmzs", "msmwuo",	/* 9724 */
+	"msoljlbkd", "mspmdkatgdjb", "msqtcdvowrugoy", "msrnlfxddwnyt",	/* 9728 */
+	"mssbwbnwtv", "mswwopq", "mszjsfspvhs", "mszlw",	/* 9732 */
+	"mszttfgmxxdsd", "mt", "mtagplw", "mtav",	/* 9736 */
+	"mtb", "mtbrwys", "mtdxasgvm", "mtew",	/* 9740 */
+	"mtfcfehx", "mthazuvsacprm", "mthkzzla", "mtjbhniqdqfoj",	/* 9744 */
+	"mtjujtpnto", "mtjxoonngve", "mtkb", "mtllkekkrwkubk",	/* 9748 */
+	"mtlmowqmlsgoll", "mtmyfkciszhww", "mtnszftw", "mtps",	/* 9752 */
+	"mtqioepd", "mtqrc", "mtrfwnhhzikrbw", "mtszkb",	/* 9756 */
+	"mtvb", "mtwbysxvxm", "mtwmmk", "mtxsbxlz",	/* 9760 */
+	"mtxshdeqsbysp", "mtzbfnhtcdwc", "mu", "muadevlls",	/* 9764 */
+	"muaoigfb", "muauuipdrdyile", "muaxbmu", "mub",	/* 9768 */
+	"mubleyahxg", "mubsvtwmbjvvcm", "mubv", "mucuzhjjb",	/* 9772 */
+	"muhdjs", "muhmttcdkk", "muhnumwzy", "muje",	/* 9776 */
+	"muktupmnvuhf", "mulhrgywu", "mulojnnvtbsuq", "mumna",	/* 9780 */
+	"mup", "muqkckn", "muvxnkomhv", "muwqtcinv",	/* 9784 */
+	"muxtior", "muydazmpu", "muyxmmryozsre", "muzxzbzb",	/* 9788 */
+	"mv", "mvaohtpdazf", "mvb", "mvdd",	/* 9792 */
+	"mvdebfaej", "mvenkcv", "mvgbjhuqagxf", "mviplexstg",	/* 9796 */
+	"mvm", "mvmddlyllmp", "mvobobi", "mvoxoyha",	/* 9800 */
+	"mvp", "mvrnkueflul", "mvsknian", "mvuflpag",	/* 9804 */
+	"mvuhviacorsyuq", "mvxbu", "mvxjzrorn", "mvxzosoulqbxd",	/* 9808 */
+	"mvyfamultzyth", "mvyjgydreq", "mvzqaodtn", "mvzssgvr",	/* 9812 */
+	"mwakwyspb", "mwamnfs", "mwbxhlifwp", "mwcqfiuxdm",	/* 9816 */
+	"mwd", "mwepsuyxwkv", "mwhk", "mwhwnlucrdbeb",	/* 9820 */
+	"mwibwwi", "mwkh", "mwkk", "mwkqafikinxwco",	/* 9824 */
+	"mwljchlxad", "mwpvjo", "mwqh", "mwrd",	/* 9828 */
+	"mwrdijts", "mwsosl", "mwsqbgxzo", "mwtcbfuy",	/* 9832 */
+	"mwuqxfto", "mwuxtrzaynlytk", "mwvewq", "mwvjwxcfrld",	/* 9836 */
+	"mwvscauzuagic", "mww", "mwwgspeafz", "mwynxzlqnwn",	/* 9840 */
+	"mx", "mxacodxn", "mxb", "mxbdihfyvdq",	/* 9844 */
+	"mxbhbofrusqybh", "mxbhcq", "mxbtwh", "mxcbrrlue",	/* 9848 */
+	"mxczi", "mxemyyjzyyqpvc", "mxetwgqm", "mxglqvblzwik",	/* 9852 */
+	"mxiiknhlmahzqy", "mxildqkrn", "mxmm", "mxoub",	/* 9856 */
+	"mxoxk", "mxpmlgd", "mxqqgzaecz", "mxqwnurugekrb",	/* 9860 */
+	"mxrag", "mxs", "mxtez", "mxtievtmngr",	/* 9864 */
+	"mxtjct", "mxuvrdycwiatc", "my", "myancms",	/* 9868 */
+	"mybbr", "myc", "mydcfgne", "mydkspakyxas",	/* 9872 */
+	"myghaztctnxdt", "mygydzcdbrhd", "mygylo", "myimzahaqkaez",	/* 9876 */
+	"myitogvgyufryy", "mylfch", "myljkbfsfudhu", "mymowefyptfmvf",	/* 9880 */
+	"myoanqcc", "mypezosd", "mypnnn", "myprpemkczkrb",	/* 9884 */
+	"myqwy", "mysrfvgmnww", "mywm", "myxa",	/* 9888 */
+	"myxiprlfletux", "myxmpbhjqzh", "myxuoc", "myycax",	/* 9892 */
+	"myytlqopscau", "myzfzyrkjcqgqg", "myzjpmogwkvanq", "mz",	/* 9896 */
+	"mzbgeha", "mzbhmszrhshwd", "mzbuurjaqz", "mzcajzkzx",	/* 9900 */
+	"mzekhv", "mzf", "mzffxd", "mzfmqeuufsy",	/* 9904 */
+	"mzgb", "mzhnzpfogw", "mzjhjnl", "mzjhpjxyjkz",	/* 9908 */
+	"mzjpeuelxgfuc", "mzjre", "mzl", "mzlnf",	/* 9912 */
+	"mzmbrfa", "mzmztdgwukwsl", "mzngjtgmhu", "mzpgq",	/* 9916 */
+	"mzq", "mztpxdl", "mzuageuwcprq", "mzvkfbs",	/* 9920 */
+	"mzvvqifuzh", "mzwyeghh", "mzxdnm", "mzxifpvkgpxzne",	/* 9924 */
+	"mzxqd", "mzxtmhstifxgf", "mzxwahupkloj", "mzydplmjogkrsf",	/* 9928 */
+	"na", "naaox", "nabmmkwgczocpp", "nabwjm",	/* 9932 */
+	"nacuasraornlt", "nadag", "nadr", "naenemfowriky",	/* 9936 */
+	"nag", "nagl", "nahjogtaxbr", "naidin",	/* 9940 */
+	"nairliyx", "najnphqz", "nakt", "nanpcpyb",	/* 9944 */
+	"napqxm", "naqjhrntbyuts", "narrwrdkbg", "nasoxj",	/* 9948 */
+	"natkdcxlx", "nau", "navpugg", "nawbfmowalvkdd",	/* 9952 */
+	"nawmhjmb", "nb", "nbaezeek", "nbchb",	/* 9956 */
+	"nbdckoqzkwb", "nbdmuqmvfmo", "nbervpeobyl", "nbg",	/* 9960 */
+	"nbhct", "nbioc", "nbjsdmkzfcxdi", "nbl",	/* 9964 */
+	"nbmo", "nbn", "nbnrgtgjub", "nborgvkwmrqc",	/* 9968 */
+	"nbot", "nbpztqafkyc", "nbqjvqsqcevr", "nbryg",	/* 9972 */
+	"nbsmx", "nbtudrshfssma", "nbufbqoxziyur", "nbvschxhuihrch",	/* 9976 */
+	"nbw", "nbwoy", "nbxk", "nbxmvbuurnehm",	/* 9980 */
+	"nbyzthcsykerv", "nbzme", "ncanztehdhuhal", "ncbt",	/* 9984 */
+	"nccpwsilwznm", "ncd", "ncdyc", "nce",	/* 9988 */
+	"ncebhzuhxvbnd", "ncevicl", "ncfbhtfwrmrzyl", "ncg",	/* 9992 */
+	"ncgwlfbpgccfq", "ncgwxlyost", "ncirymvte", "ncivj",	/* 9996 */
+	"ncklsm", "nclgjgj", "ncmchm", "ncmo",	/* 10000 */
+	"ncouj", "ncqcej", "ncqn", "ncqxai",	/* 10004 */
+	"ncrcssqshw", "ncrirtcodd", "ncs", "ncsmjcuafhsnmv",	/* 10008 */
+	"ncsqakvij", "ncszccxgjzudcb", "nctaucxlvfp", "ncuxcarxnkeek",	/* 10012 */
+	"ncvoouxaquxa", "ndb", "ndcyosypaldxgw", "nddrpcgwgh",	/* 10016 */
+	"ndepnkd", "ndewkuuhvlc", "ndfelxjliex", "ndflvqwi",	/* 10020 */
+	"ndfqlazyfqs", "ndgt", "ndi", "ndicx",	/* 10024 */
+	"ndilijjjfnfdo", "ndjpegbmslsbec", "ndjsyfym", "ndnvqwsfxgi",	/* 10028 */
+	"ndnvyqwvrs", "ndnws", "ndryf", "ndsbuyv",	/* 10032 */
+	"ndsen", "ndslukpunv", "ndtbouzp", "ndtcwlswy",	/* 10036 */
+	"ndtjzfltub", "nduijeelz", "ndukpgd", "ndukyhszf",	/* 10040 */
+	"ndwubp", "ndwwukw", "ndxv", "ndy",	/* 10044 */
+	"ndygnoczkve", "ne", "neagsnnjyknfy", "nebybjp",	/* 10048 */
+	"necyszdyh", "nedjieagxmhcu", "neeig", "negzxaxdysgsx",	/* 10052 */
+	"nekfomsrveq", "nekt", "nengimvfixvsnl", "nepsu",	/* 10056 */
+	"neqpjdk", "nesojbqueqquiq", "nesznnvmpjdlhc", "neub",	/* 10060 */
+	"neulkntyhyrr", "neuvul", "nevrbbryqang", "nevy",	/* 10064 */
+	"newksirifphi", "newuefk", "nexxbbpgg", "nf",	/* 10068 */
+	"nfa", "nfd", "nfdecs", "nfdqkzzjhcdl",	/* 10072 */
+	"nffkyk", "nfgc", "nfgobamrbxpiv", "nfhlalnr",	/* 10076 */
+	"nfinashyievnp", "nfiywfwq", "nfjx", "nfmm",	/* 10080 */
+	"nfnorexrvii", "nfpbkfdcrzey", "nfpbycnndzu", "nfpflpbnufehd",	/* 10084 */
+	"nfpkkozr", "nfqwcc", "nfqx", "nfsapw",	/* 10088 */
+	"nftpoygbr", "nftsosba", "nfukaixvbq", "nfvbmlwvns",	/* 10092 */
+	"nfvuxsadgmn", "nfxesli", "nfxltz", "nfybeoitrwnk",	/* 10096 */
+	"nfzbcvmzdafm", "nfzfo", "nfzhahqrbu", "ng",	/* 10100 */
+	"nga", "ngbeficvilfsm", "ngcusbzonc", "ngehxuxapke",	/* 10104 */
+	"ngg", "ngge", "ngggvcg", "nghnohnbaohy",	/* 10108 */
+	"nghxihmhtafeek", "ngiennyabffqmh", "ngivtqtk", "ngjldl",	/* 10112 */
+	"ngjmqd", "ngjpaakib", "ngl", "ngmpm",	/* 10116 */
+	"ngng", "ngnykzcb", "ngour", "ngrggtrakjo",	/* 10120 */
+	"ngthjx", "ngtm", "nguawwa", "nguisjxilyesiz",	/* 10124 */
+	"ngvjbtcicinsg", "ngyqjvf", "ngyqvujph", "ngyreakwb",	/* 10128 */
+	"ngyweyqpz", "ngzmivzclmh", "ngzmrpftczp", "nh",	/* 10132 */
+	"nha", "nhbgqn", "nhclqikwbw", "nhcregorjtlf",	/* 10136 */
+	"nhdfuqrnzzan", "nhexxeegsgoz", "nhgekt", "nhgyucaezp",	/* 10140 */
+	"nhhgfh", "nhizazam", "nhkmgciuoeyp", "nhmga",	/* 10144 */
+	"nhmho", "nhmyhovwju", "nhnmksbjgpzh", "nho",	/* 10148 */
+	"nhow", "nhqh", "nhqwiipfbea", "nhu",	/* 10152 */
+	"nhuavvephgjwcb", "nhudfqb", "nhuvepyurt", "nhv",	/* 10156 */
+	"nhvithkkteyouq", "nhvwuwia", "nhwldlhwclvrvv", "nhyxjnincuuo",	/* 10160 */
+	"nhzbq", "nhzurkcqz", "nhzwpcteshdauj", "ni",	/* 10164 */
+	"niarzj", "nidblplrtign", "nieujyot", "nigecosejle",	/* 10168 */
+	"nigjrvldtrzw", "nigkldwdo", "nigrkfosjfwun", "nihbpg",	/* 10172 */
+	"niij", "nijso", "nijugktshrkozx", "nik",	/* 10176 */
+	"nikaielxeypcdm", "nikqj", "nillsijal", "nimtc",	/* 10180 */
+	"nimyentkalvfpq", "nioooxuxfzsyfb", "nipxdxde", "niqjxn",	/* 10184 */
+	"niqydkzerwr", "niqzrpfipkntnr", "nireijehgmdcvx", "nitywdw",	/* 10188 */
+	"niv", "nivbfkurmsir", "nivlmjvppfszmp", "nix",	/* 10192 */
+	"nixcgzyer", "nixziptnixebu", "niytfwidnbkkb", "nizndcr",	/* 10196 */
+	"nj", "njag", "njcp", "njcr",	/* 10200 */
+	"njdjzbpfirgeb", "njearyaxyalc", "njfajnewgusm", "njhaujfsbojrcq",	/* 10204 */
+	"njl", "njlmyltgj", "njlxpqcfujnr", "njlxx",	/* 10208 */
+	"njmgtgnemsv", "njmxn", "njncrexke", "njngaemwaspoy",	/* 10212 */
+	"njofsamsbqj", "njogumsic", "njojwfuzm", "njonxzy",	/* 10216 */
+	"njovduijlgqif", "njpwamcjesjz", "njrp", "njrvtubc",	/* 10220 */
+	"njvcnhnxzckh", "njvfozq", "njwnvvhkdaxdsl", "njwyj",	/* 10224 */
+	"njxcjtnsbcgrh", "njxzjg", "njzwthpxz", "nk",	/* 10228 */
+	"nkauil", "nkaulvbplbw", "nkbstopiv", "nkcaddzyop",	/* 10232 */
+	"nkdomr", "nkewrtni", "nkf", "nkgtbxaoas",	/* 10236 */
+	"nkjrgwjefh", "nkkjnrmd", "nkknbkn", "nklfgiobunn",	/* 10240 */
+	"nklqhh", "nkmuymaspb", "nknnyvhohw", "nkodg",	/* 10244 */
+	"nkovn", "nkpmzst", "nkriubvmuzzl", "nkrj",	/* 10248 */
+	"nksngrewiljo", "nkuympgqvqoc", "nkvn", "nkwdn",	/* 10252 */
+	"nkwl", "nkwvkhclhxlu", "nkxaixkua", "nkxhwb",	/* 10256 */
+	"nkxkjdyxd", "nkybrouykvn", "nkynkznfkn", "nl",	/* 10260 */
+	"nlbna", "nleqmj", "nleyqvvefalqfj", "nlhuke",	/* 10264 */
+	"nllhgvigzln", "nllqefzh", "nlm", "nlmctnhnu",	/* 10268 */
+	"nlobljmueebpht", "nlozmjyzmqf", "nlpmmgzdspfq", "nlqczjcopfhsar",	/* 10272 */
+	"nlqezcqw", "nlr", "nlrggceh", "nlrkqwpav",	/* 10276 */
+	"nlrlhyzcklkr", "nlugtdomtyxfdz", "nlvejkuspzft", "nlvnl",	/* 10280 */
+	"nlwvhuloahsl", "nly", "nlybf", "nlyvbxolfbuih",	/* 10284 */
+	"nlyxygxvof", "nm", "nmbx", "nmcidsi",	/* 10288 */
+	"nmdcmjbtks", "nmhblfh", "nmhmqkd", "nmic",	/* 10292 */
+	"nmipgg", "nmjansmdajsgij", "nmkvubkfzk", "nmloevkhsqjo",	/* 10296 */
+	"nmlqotdgvdilig", "nmlynekzffm", "nmn", "nmpzyfuet",	/* 10300 */
+	"nmr", "nmtacm", "nmtxkihyjafa", "nmugadaojifwp",	/* 10304 */
+	"nmv", "nmvbcaxoxhe", "nmvek", "nmwhfx",	/* 10308 */
+	"nmxsqnubv", "nmxycsngnbcngr", "nmywgse", "nn",	/* 10312 */
+	"nnablb", "nnam", "nnaqu", "nnb",	/* 10316 */
+	"nnchlbk", "nndagelcxctt", "nndbjf", "nngjkipcixgy",	/* 10320 */
+	"nngsbzv", "nnhcynnhnlf", "nnhwkaxuzwcyer", "nnixbozzk",	/* 10324 */
+	"nnjn", "nnjny", "nnkvbdaaimd", "nnlsfitzeru",	/* 10328 */
+	"nnmuipjzv", "nnocfiz", "nnoffyh", "nnplixdvwoto",	/* 10332 */
+	"nnpseskvkmhj", "nnq", "nnrccnqjs", "nnsi",	/* 10336 */
+	"nnsnyn", "nnsr", "nnszmxqztd", "nnt",	/* 10340 */
+	"nntwxax", "nnusg", "nnvledkp", "nnvwrhdmayl",	/* 10344 */
+	"nnwqwgy", "nnx", "nnxmngtfzpf", "nnxxsgntihkjp",	/* 10348 */
+	"no", "noacndxriufmea", "noakgbh", "noamuqnnomzbem",	/* 10352 */
+	"nobcskfues", "nobhnwpr", "nocyzyyghnqbau", "nognktyyf",	/* 10356 */
+	"nogze", "noi", "nojplnz", "nojwvwcdljxy",	/* 10360 */
+	"nokj", "nolcjtesjn", "nolgyikqpjdek", "nolxwuld",	/* 10364 */
+	"nomfrsfivtoclh", "nomtrteotpmdki", "nonossneu", "nooaxyau",	/* 10368 */
+	"noon", "nopw", "noqbzxcblof", "noqunohnbuv",	/* 10372 */
+	"noszmyut", "novlkn", "novyr", "novzmyiyeaidjv",	/* 10376 */
+	"noyxpco", "np", "npasyqgznrxu", "npavywnftbuss",	/* 10380 */
+	"npblakosp", "npbmtjzrdt", "npcmy", "npcsx",	/* 10384 */
+	"npddqvvqmr", "npdrrkbd", "npgncwjjhlmaof", "npgs",	/* 10388 */
+	"npgsdzc", "npitss", "npjt", "npjwdd",	/* 10392 */
+	"npkvqlbwmeyak", "npkzicujvq", "npmdfftcxcgzjs", "npncjo",	/* 10396 */
+	"npngpkvospm", "npnytzkml", "npohdgnfs", "nppqhnug",	/* 10400 */
+	"nprsjnatkqy", "npsmrat", "npt", "nptrtphzhl",	/* 10404 */
+	"npvhhynhcnb", "npvs", "npvzldiywzt", "npxxdo",	/* 10408 */
+	"npybkhcnckf", "npzglvqdmr", "nq", "nqa",	/* 10412 */
+	"nqadm", "nqakmf", "nqanhwmitayq", "nqascbx",	/* 10416 */
+	"nqbpdc", "nqfpthqurdmp", "nqighh", "nqiivuqfux",	/* 10420 */
+	"nqj", "nqjjqb", "nqk", "nqkrgiebbcxrvq",	/* 10424 */
+	"nqlcsnhxlgueg", "nqo", "nqqpgegzu", "nqrxeigbl",	/* 10428 */
+	"nqryy", "nqsddfgtja", "nqtdqmpwrlnde", "nqurzy",	/* 10432 */
+	"nqvli", "nqvlyq", "nqvxk", "nqyhvkhjx",	/* 10436 */
+	"nqyleqwmyvd", "nqyn", "nqzidyzkbw", "nqzybpgmh",	/* 10440 */
+	"nr", "nradq", "nrbhx", "nrbiceaafjzhy",	/* 10444 */
+	"nrcezdqsv", "nrdd", "nrddszkk", "nrebizlxq",	/* 10448 */
+	"nrekjorwzte", "nrgnlzkjxwmzuj", "nrgohntsqm", "nriroroamkfipa",	/* 10452 */
+	"nriuc", "nrjmubvtait", "nrjyqupocgycim", "nrkuappvpdqy",	/* 10456 */
+	"nrlazxpu", "nrlmaeldr", "nrlrm", "nrmdjyctofs",	/* 10460 */
+	"nrmxrzvxnwfa", "nrmyflkvyfjxi", "nrrxteuj", "nrsq",	/* 10464 */
+	"nrsxturafl", "nrv", "nrvtrqzxr", "nrx",	/* 10468 */
+	"nrxdeyxeifdie", "nryphg", "nrzgqt", "ns",	/* 10472 */
+	"nsaadil", "nsbgpwpea", "nscbwwjenqfahp", "nscylthxeoqvo",	/* 10476 */
+	"nsdgp", "nsggfhezoeyolz", "nsgsj", "nshe",	/* 10480 */
+	"nshtzg", "nshufcivtfhx", "nsiaazeypwy", "nsie",	/* 10484 */
+	"nsiyuftdris", "nsmawxjavdk", "nsnl", "nsod",	/* 10488 */
+	"nspejwvz", "nspojsimplqxp", "nsppfrkwb", "nssd",	/* 10492 */
+	"nssdrwdckv", "nsu", "nsufceudhw", "nsvvxvwnypujy",	/* 10496 */
+	"nswijiojz", "nsxdbzvqqtfu", "nsydic", "nsyn",	/* 10500 */
+	"nsyx", "nszsdlemrjr", "nszvczxu", "nt",	/* 10504 */
+	"ntcbdcqsxxrm", "ntcjnzjvnpndip", "ntcoxubdlrbf", "ntcpoydtx",	/* 10508 */
+	"ntdiqnbzyo", "ntdk", "nteppyfjrpgb", "ntfgzkregyuop",	/* 10512 */
+	"ntfmbitioyf", "ntghwzxfuatthp", "nthccempqcrut", "ntiqw",	/* 10516 */
+	"ntjldainwb", "ntl", "ntlgidbmkwk", "ntlwtttlvynn",	/* 10520 */
+	"ntmxalebzndo", "ntpaoqpqgdmaze", "ntplpzmtbas", "ntpxjlkpe",	/* 10524 */
+	"ntq", "ntrvalsif", "ntscfcqh", "ntsuxk",	/* 10528 */
+	"ntszc", "ntszrruqsyswps", "ntteu", "nttj",	/* 10532 */
+	"ntudvlerp", "ntvptgtndin", "ntxmzsctwvttgj", "ntxuxbzkbblvc",	/* 10536 */
+	"ntzdgogfo", "nu", "nuafilh", "nuamoredkewxh",	/* 10540 */
+	"nucwrlejqdsjlf", "nudoqqg", "nudvfhutkdg", "nugkxko",	/* 10544 */
+	"nuhcxnryriep", "nullablqiuzfbs", "num", "nunxwtozsuzbeh",	/* 10548 */
+	"nuogxdnvoho", "nuoxmwtyo", "nurm", "nusifwpr",	/* 10552 */
+	"nuuavhkb", "nuv", "nuwfrgqrpsuwcu", "nuwtnk",	/* 10556 */
+	"nuxktrwdujd", "nuxzsnj", "nuzby", "nuzcrafhjynr",	/* 10560 */
+	"nuzehvuxbp", "nv", "nvbgd", "nvds",	/* 10564 */
+	"nvdwfpx", "nveagigsxvua", "nvehpi", "nvfkyv",	/* 10568 */
+	"nvgzh", "nvhwpuapjjjbkv", "nvigfgm", "nvjur",	/* 10572 */
+	"nvkgkjboidh", "nvklplaaegbwgb", "nvmft", "nvmgiyajbiyc",	/* 10576 */
+	"nvne", "nvoc", "nvqmmzgdeurez", "nvrfh",	/* 10580 */
+	"nvsxvidiu", "nvtwcexmtw", "nvv", "nvvgyzrkj",	/* 10584 */
+	"nvwqxzrz", "nvxkfwkcjhh", "nvxrlrlwcmh", "nvxuftmjnbmr",	/* 10588 */
+	"nvy", "nvypeperjrcf", "nvz", "nvzqqxxmpa",	/* 10592 */
+	"nvzvrdxdiqlma", "nw", "nwa", "nwaq",	/* 10596 */
+	"nwcfnaxwx", "nwcqr", "nwctvalq", "nwdruif",	/* 10600 */
+	"nwgotcy", "nwi", "nwiwvzz", "nwkccc",	/* 10604 */
+	"nwlgxglvy", "nwlmnpsppx", "nwlmwmqnwhg", "nwnvssudqbqn",	/* 10608 */
+	"nwobc", "nwoiaqppxgbau", "nwomx", "nwphzhduqzutbm",	/* 10612 */
+	"nwpyqgh", "nwq", "nwqv", "nwqyvtw",	/* 10616 */
+	"nwrhiy", "nwscdfvncn", "nwtccbnh", "nwu",	/* 10620 */
+	"nwuhkviiciimw", "nwuoklackwfr", "nwvcvrfhufc", "nwxxhaxvhtmehr",	/* 10624 */
+	"nwzrmzux", "nx", "nxan", "nxbyuo",	/* 10628 */
+	"nxduitxpyc", "nxe", "nxebuqho", "nxekfcg",	/* 10632 */
+	"nxgligcwaft", "nxgpehlwen", "nxhija", "nxhpuibmlmon",	/* 10636 */
+	"nxjr", "nxl", "nxlivuy", "nxltzzhf",	/* 10640 */
+	"nxmdfr", "nxmuggebwr", "nxmwjlg", "nxnfuwfgs",	/* 10644 */
+	"nxocpu", "nxorfv", "nxpooigerweu", "nxpr",	/* 10648 */
+	"nxrlgooh", "nxsenzzsgn", "nxt", "nxtjezbd",	/* 10652 */
+	"nxtjfeuglg", "nxvi", "nxvtk", "nxwqotkemcjnan",	/* 10656 */
+	"nxxf", "nxxmegeknt", "nxxywyguuwluq", "nxyehmzq",	/* 10660 */
+	"nxznkgomiq", "ny", "nyaumenebj", "nycqsobng",	/* 10664 */
+	"nydasdbwnvv", "nyeiaezifsuukw", "nyeozal", "nyfenfla",	/* 10668 */
+	"nyfjmeepuh", "nyj", "nykqa", "nymgnacivlc",	/* 10672 */
+	"nymlnz", "nymqqcpe", "nynihpl", "nynywtiv",	/* 10676 */
+	"nyo", "nyowplrxpzdpdj", "nyqb", "nyqzsavdcd",	/* 10680 */
+	"nyriomuz", "nyrjksux", "nyrkmwykfz", "nys",	/* 10684 */
+	"nysocisiokeui", "nytkpaa", "nyvlb", "nyyipdib",	/* 10688 */
+	"nyyzhdx", "nz", "nzcmfekg", "nzeraznrk",	/* 10692 */
+	"nzf", "nzg", "nzhgipjere", "nzhswgrrmypdp",	/* 10696 */
+	"nzibcej", "nzilybwdatzzns", "nzioknmtw", "nzjysvah",	/* 10700 */
+	"nzlbb", "nzlhfmwslwtle", "nzmez", "nznyxvl",	/* 10704 */
+	"nzo", "nzoble", "nzthuggbtabyvi", "nztopfumxo",	/* 10708 */
+	"nzwnspmktmqm", "nzxg", "nzxxvgw", "nzzwffnlydqx",	/* 10712 */
+	"oa", "oaccehgsczsaer", "oacfwhbqbkcw", "oadaiiuukk",	/* 10716 */
+	"oadlrqjyphhnrb", "oaea", "oafdfzp", "oafllaasvmjeuk",	/* 10720 */
+	"oafxakqojhj", "oafzxizvtgzn", "oaio", "oaj",	/* 10724 */
+	"oajf", "oajkl", "oakjriesgszeex", "oal",	/* 10728 */
+	"oalohq", "oanbnmwbv", "oaoltu", "oaouwfwpuihguk",	/* 10732 */
+	"oappkrnu", "oapttds", "oaqzoobdu", "oasoj",	/* 10736 */
+	"oastluhbjos", "oasv", "oatmjehtscpyze", "oaufapp",	/* 10740 */
+	"oauspksuded", "oavv", "oawcqubsjsgml", "oawdyuavtwtk",	/* 10744 */
+	"oaxuq", "oaxwdv", "oaycjg", "oazisbbayr",	/* 10748 */
+	"ob", "obcigfl", "obdcmmyiguv", "obdpis",	/* 10752 */
+	"obequu", "obesdsendfiv", "obffedf", "obhidjaqwkeon",	/* 10756 */
+	"obiwmluby", "objylq", "obljrugixifjqk", "obmgef",	/* 10760 */
+	"obnefocutffu", "obnzfphub", "obosce", "obpcqhlfamhcuz",	/* 10764 */
+	"obpoelwxdzew", "obqihilr", "obrsvasblu", "obshszlhgs",	/* 10768 */
+	"obtjhpi", "obtmo", "obuwelng", "obvf",	/* 10772 */
+	"obxgyi", "obxukjjvxmjz", "obychitrt", "obypw",	/* 10776 */
+	"obz", "obzyidxvcbuucp", "oc", "oca",	/* 10780 */
+	"ocb", "occai", "occjphgwhme", "occo",	/* 10784 */
+	"ocebkvt", "ocegtcqn", "oceykvpxhjeh", "ocliuwfcykgyki",	/* 10788 */
+	"oclwjdmpxviy", "ocmarihbzd", "ocmtzbiv", "ocmx",	/* 10792 */
+	"ocnmjmbr", "ocpkzhaxsfold", "ocppwczeem", "ocqfddkxuepuh",	/* 10796 */
+	"ocubsrcgwho", "ocupnkxz", "ocvxbtp", "ocw",	/* 10800 */
+	"ocwtxdmnohp", "ocx", "ocxmur", "ocyolztx",	/* 10804 */
+	"oczhqc", "oczzsfa", "od", "odajfhffgmyxvk",	/* 10808 */
+	"odanf", "odasj", "odbaratidvijfy", "odbhdteppl",	/* 10812 */
+	"odbtgmzlxe", "odbymmozfq", "odcqhjmyzql", "odd",	/* 10816 */
+	"odeft", "odfzczu", "odgl", "odhh",	/* 10820 */
+	"odhwzkgfeuiwe", "odhyehgccp", "odjgn", "odjrtdb",	/* 10824 */
+	"odkkmumjchx", "odle", "ododfuiqpxya", "odosoxosgab",	/* 10828 */
+	"odpdcbshikgn", "odpiekwrnrp", "odrd", "odslabjducv",	/* 10832 */
+	"odugpn", "odvyj", "odvzdq", "odwjirhw",	/* 10836 */
+	"odwypeixomtr", "oe", "oebleiwjllolmo", "oeccba",	/* 10840 */
+	"oeceq", "oecft", "oecuz", "oecxdkb",	/* 10844 */
+	"oee", "oeen", "oeetmfxfask", "oef",	/* 10848 */
+	"oefphd", "oegdorxhxeqpeu", "oeikzjsrkbjg", "oejfmfhhan",	/* 10852 */
+	"oejphzugdiaxpp", "oejtpns", "oeknagibzqxjbq", "oekrsdcy",	/* 10856 */
+	"oel", "oemchmrmxgb", "oemdxgrftqoik", "oemjrjfw",	/* 10860 */
+	"oen", "oengm", "oenmpj", "oeprji",	/* 10864 */
+	"oeptbllxk", "oeqoq", "oeqy", "oesmzbduduj",	/* 10868 */
+	"oet", "oetsnqhcen", "oetydjn", "oeu",	/* 10872 */
+	"oevtg", "oewgykdlmkk", "oewlbiderihtx", "oex",	/* 10876 */
+	"oexfqtte", "oexich", "oeycggynssw", "oeygc",	/* 10880 */
+	"oeypmgxgtbk", "of", "ofbkgceyamvumi", "ofcnhdimvikf",	/* 10884 */
+	"ofcwtbue", "ofegvdndnh", "offsl", "ofgfvobzcviunr",	/* 10888 */
+	"ofgqpautxop", "ofikqohgcv", "ofkfkvumjl", "ofnwpnxbdgrtm",	/* 10892 */
+	"ofouzjyuetl", "ofqdyhfrxjm", "ofrcepqlonqe", "ofsh",	/* 10896 */
+	"ofsr", "oftrorfk", "oftupzqn", "ofugazxmwkhq",	/* 10900 */
+	"ofurxtzscuo", "ofv", "ofxbeyav", "ofxvslxqwy",	/* 10904 */
+	"ofz", "ofzozxrb", "og", "ogagzvsjfp",	/* 10908 */
+	"ogarshainqlj", "ogcrf", "ogcsrgtqspa", "ogcxfzgdxcib",	/* 10912 */
+	"ogdbkhyfbldfg", "ogdlxhpbu", "ogdwqnuqdpx", "ogehxgdakjv",	/* 10916 */
+	"ogfiurvros", "ogi", "ogina", "ogjab",	/* 10920 */
+	"ogje", "ogjsbu", "ogkgfagwv", "ogkutdhq",	/* 10924 */
+	"oglxguorlt", "oglzzklmgunm", "ogmp", "ogmucgwznfob",	/* 10928 */
+	"ogosuqlgchknp", "ogrlrxpjpgdc", "ogrt", "ogs",	/* 10932 */
+	"ogsvoe", "ogt", "ogtcag", "ogtdrwii",	/* 10936 */
+	"ogzblo", "oh", "ohbiew", "ohcekxmalx",	/* 10940 */
+	"ohcjxdymkgcva", "ohdqfpbvv", "ohffdhxlplzysw", "ohfvzjmwpnvahg",	/* 10944 */
+	"ohgu", "ohgv", "ohheukwqf", "ohikyporb",	/* 10948 */
+	"ohilzklipeaqz", "ohimpwyxjx", "ohivmojwmaryna", "ohjyjqiuntn",	/* 10952 */
+	"ohkwadmxmg", "ohlajsverqwyuq", "ohmpxtonpi", "ohmywtitajqp",	/* 10956 */
+	"ohnsviomhef", "ohoiztlfewp", "ohrtobxfth", "ohu",	/* 10960 */
+	"ohwuvrj", "ohxin", "ohzlmrrgfz", "oi",	/* 10964 */
+	"oia", "oib", "oibpuupofvfueo", "oibzquw",	/* 10968 */
+	"oidwht", "oidyncoe", "oif", "oiioyunrkpi",	/* 10972 */
+	"oiixwivbihzgb", "oijjovvlx", "oimonggudwn", "oip",	/* 10976 */
+	"oipcxloj", "oipf", "oiqlrpgo", "oissipuql",	/* 10980 */
+	"oiudjj", "oiupp", "oivydwhztq", "oiyecxe",	/* 10984 */
+	"oiyrdzpeqtb", "oiyzmjd", "oizpmfhp", "oj",	/* 10988 */
+	"ojaqaejj", "ojbwlcunkxgt", "ojekthqci", "ojembyeixev",	/* 10992 */
+	"ojfnfnkl", "ojfpd", "ojhfqjecbr", "ojl",	/* 10996 */
+	"ojnbe", "ojnic", "ojnrxyeau", "ojnwxmmdystj",	/* 11000 */
+	"ojnywstfyjvsqv", "ojpdphwfz", "ojq", "ojqbvvyhb",	/* 11004 */
+	"ojqly", "ojqs", "ojraorcjujg", "ojrtrzpl",	/* 11008 */
+	"ojszxurg", "ojtirsqbqgwaz", "ojusilluur", "ojvjhhud",	/* 11012 */
+	"ojvli", "ojvyqrmctps", "ojwulydaokvs", "ojwzpcymlrfbzb",	/* 11016 */
+	"ojxjdft", "ojygznngtotgsf", "ojyjaauxbm", "ojyqqwodzbj",	/* 11020 */
+	"ok", "okaee", "okaqbli", "okauvakjpph",	/* 11024 */
+	"okeosbwlh", "okfxwho", "okgaslztdkltxe", "okhrlzeicjfgs",	/* 11028 */
+	"okjpzyka", "okkfwsejqww", "okm", "oknt",	/* 11032 */
+	"okoibqlgh", "okplseiapb", "okqdavbe", "okqjvfxftmmux",	/* 11036 */
+	"okqytbsd", "okrjxwqp", "okrrzztyks", "oksy",	/* 11040 */
+	"okwcvxscol", "okysrylvat", "okyuhtftmk", "okyxbkjn",	/* 11044 */
+	"ol", "ola", "olax", "oldh",	/* 11048 */
+	"olg", "olga", "olhuni", "olktwneze",	/* 11052 */
+	"ollogfefsqlqnr", "olmwncfogj", "olnwaktzliw", "olovlkj",	/* 11056 */
+	"olowdu", "olqifhtfsuz", "olqzdgo", "olsdaq",	/* 11060 */
+	"olsodg", "olueqi", "olunqlsqpfdvw", "olwlbcefjfzr",	/* 11064 */
+	"olx", "olztjtubamwyqv", "olzv", "olzxs",	/* 11068 */
+	"om", "omabyzjgjwh", "omapepx", "omcc",	/* 11072 */
+	"omdnstuvfpamho", "omf", "omfqmlfdpr", "omfsxuphcxiyu",	/* 11076 */
+	"omhhjfxlfqit", "omhvraqulslfan", "omiglnkizlr", "omiiekfhqf",	/* 11080 */
+	"omivhrumeq", "omjzfw", "omkuiiuuhhbs", "ommkrnzmdmpnp",	/* 11084 */
+	"ommqgyccwck", "omnxealjd", "omqy", "omrdspie",	/* 11088 */
+	"omrpv", "omtq", "omtsomnmq", "omuxrkkrvowki",	/* 11092 */
+	"omvc", "omwohhjvfn", "omydtcwabrcjpy", "omzk",	/* 11096 */
+	"omzkoc", "on", "onbrxtmzzned", "onbsjwgahy",	/* 11100 */
+	"onbxwiixcyik", "ondd", "ondhzxal", "ondi",	/* 11104 */
+	"ondugwcidv", "one", "oneesfulsp", "onevjacjaaxxc",	/* 11108 */
+	"onhubtwodqqpwz", "onjat", "onjccolxalhsk", "onjklfyjspfan",	/* 11112 */
+	"onk", "onlfgmpcrp", "onmbtrkadgmh", "onmvqzphwjxoa",	/* 11116 */
+	"onmyje", "onmzdatgnf", "onouivp", "onqsq",	/* 11120 */
+	"onsfvtbnsgxod", "onsgdmvzu", "onsjy", "ontedpasm",	/* 11124 */
+	"ontlfadgdp", "ontpdngiirnixc", "onvjlxkihom", "onwabohvtchh",	/* 11128 */
+	"onwndrvl", "onxap", "ony", "onypxojagz",	/* 11132 */
+	"onyxwieloszirs", "onzhxjt", "onzzszkyxdy", "oo",	/* 11136 */
+	"oobcrgumel", "oofdrsym", "oogpjrcmrt", "oogrpyn",	/* 11140 */
+	"oohdmblwu", "ooi", "ooiktscsnsc", "ooillmq",	/* 11144 */
+	"ooimzikhtz", "ookhxg", "ookqkgoxzim", "oolhqogwpkwuem",	/* 11148 */
+	"oolo", "oom", "oomqszkcwz", "oonjve",	/* 11152 */
+	"oonl", "oooalqbk", "ooocrizlkwn", "oooyxic",	/* 11156 */
+	"oopwhxjqja", "ooqcvadpaxcwrh", "oorlmcqck", "ooswc",	/* 11160 */
+	"ootkwq", "oovk", "oovlnmztdubb", "oowcevpca",	/* 11164 */
+	"oowxuzqdieg", "ooxkiylq", "ooxmrowbsq", "ooydnmpwl",	/* 11168 */
+	"ooz", "op", "opbamvwdsbxq", "opd",	/* 11172 */
+	"opdqgdqxtjfsm", "opeahqvfropa", "opfrrxe", "opgkzplhgqivq",	/* 11176 */
+	"opgqtsqlnxc", "opgsrb", "ophdfqto", "ophngae",	/* 11180 */
+	"opicutbpmsy", "opj", "opmtemi", "opnqzlbpimjqc",	/* 11184 */
+	"opnxv", "opnzbamca", "opp", "oppfswrqyxka",	/* 11188 */
+	"opqnr", "opt", "optssqj", "opttglbwhgdbjx",	/* 11192 */
+	"opukzrwbcs", "opusvknuft", "opvcelbprp", "opvhm",	/* 11196 */
+	"opw", "opxtxyvthb", "opxwmtizwhgxf", "opyfdktaua",	/* 11200 */
+	"opyzecwgvd", "opzfmghfoosg", "oq", "oqarjapgyej",	/* 11204 */
+	"oqcacfrjimvmec", "oqdmwz", "oqepebgwmkuxip", "oqkoejvn",	/* 11208 */
+	"oqleklozgwd", "oqm", "oqmlyxhqeffi", "oqnxan",	/* 11212 */
+	"oqohtkp", "oqousuycy", "oqpihbeus", "oqqvvuxyzburb",	/* 11216 */
+	"oqrzuoxbezd", "oqs", "oqskvaolllluex", "oqswxpyt",	/* 11220 */
+	"oquhlxomuqfmjr", "oquu", "oqvcwwxwtcxr", "oqwzpzkpwrs",	/* 11224 */
+	"oqxhvukgbyzuj", "oqxqhy", "oqzmxboxj", "oqzojqlwd",	/* 11228 */
+	"or", "oradxkxxzr", "orbeafadlnjg", "orcn",	/* 11232 */
+	"orcrupepaijasy", "orcyv", "ordrjabjavqcp", "orecftvghqsn",	/* 11236 */
+	"orewaiv", "org", "orgktobe", "orhh",	/* 11240 */
+	"orhkrk", "orkiizczfdawz", "orkpnindyqcxg", "orly",	/* 11244 */
+	"ornfiwfeg", "orngo", "orniaolajkxe", "ornmp",	/* 11248 */
+	"orppb", "orq", "orrafzy", "oruvrba",	/* 11252 */
+	"orx", "orylcnm", "orz", "os",	/* 11256 */
+	"osaauthigf", "osbzwpylbz", "osczmpjsehsxg", "osdrpgs",	/* 11260 */
+	"osdxid", "osegqvah", "oser", "oseragexkbbxp",	/* 11264 */
+	"osexjzs", "osfaen", "osfhfgntstvc", "osgwvryzmrbk",	/* 11268 */
+	"oshoaohhri", "oshonbepzl", "oshseqivljhr", "oslfcighw",	/* 11272 */
+	"oslry", "osn", "osnhjsvm", "osnocmfnl",	/* 11276 */
+	"ospelevg", "osphlsh", "osq", "osqzdvo",	/* 11280 */
+	"osshlfb", "osssew", "ossxfhooc", "osuiaoo",	/* 11284 */
+	"osuxegqj", "osuy", "osx", "osxsmpjg",	/* 11288 */
+	"osxtcoi", "oszj", "oszrwia", "ot",	/* 11292 */
+	"ota", "otcsufqtw", "otdq", "otdrzakwqruvta",	/* 11296 */
+	"otdxxjvxup", "otfg", "otfxyt", "otgvgmkywoiif",	/* 11300 */
+	"othb", "otign", "otiqdrxpktpvr", "otiuramkmydt",	/* 11304 */
+	"otjjlzc", "otjtcdemxk", "otjvwiihelmdvq", "otlbzbd",	/* 11308 */
+	"otlj", "otlpse", "otmbiz", "otmcbojlyusfej",	/* 11312 */
+	"otmj", "otnd", "otnkqzmtlgmtv", "otokrozwpclf",	/* 11316 */
+	"otpfivqjsyzmtr", "otpgulxresi", "otqi", "otqit",	/* 11320 */
+	"ottejlvpmwflpl", "otttyoug", "ottwitqwibznm", "otuaorxlmkgfr",	/* 11324 */
+	"otucfyliqkkw", "otuibk", "otwdzebqrrbvug", "otwwu",	/* 11328 */
+	"otxbdmny", "otxnnvs", "otyqnusfqbi", "ou",	/* 11332 */
+	"ouavc", "oubu", "oucioy", "oucrjukuun",	/* 11336 */
+	"oucuqoe", "oudffdpzkubrsy", "ouek", "ouelhsxqvvp",	/* 11340 */
+	"oufnih", "oufyjwcj", "oug", "ougnqjmus",	/* 11344 */
+	"ouhu", "oujsnovzt", "oujzit", "oukfu",	/* 11348 */
+	"oulqr", "oulwqsismp", "ouncnncxth", "ounmhpghmdw",	/* 11352 */
+	"ounws", "ounzte", "oupjcyzpw", "oupjx",	/* 11356 */
+	"ourpjub", "oustcskdj", "outjgunwvy", "outmguqg",	/* 11360 */
+	"outvccvepli", "outzhrp", "ouury", "ouvupzo",	/* 11364 */
+	"ouwg", "ouwj", "ouyuxpc", "ouywmcbw",	/* 11368 */
+	"ouyzfwxo", "ouzvtuijz", "ovcfqc", "ovctcvsorst",	/* 11372 */
+	"ovcwziuk", "ovdwvcbza", "ovemzjueiypnv", "ovflelq",	/* 11376 */
+	"ovgmyapoyzx", "ovhofy", "ovix", "ovmkzfcbmymc",	/* 11380 */
+	"ovmqpexjzwc", "ovnrgfzhlkxjcy", "ovqzrvqwahgylz", "ovrfxm",	/* 11384 */
+	"ovrmk", "ovsoeoxfxydk", "ovswrbetarnqf", "ovudbfrknln",	/* 11388 */
+	"ovvjqhq", "ovvpvummkht", "ovvqskhxwymy", "ovwxgkimbp",	/* 11392 */
+	"ovxztydxsjpgl", "ovzesyq", "ow", "owcgfkxj",	/* 11396 */
+	"owdxedse", "owebksw", "owgrtjfmikkjdd", "owi",	/* 11400 */
+	"owif", "owiwr", "owjprnnqxt", "owkoznhzfnix",	/* 11404 */
+	"owkqnwvu", "owmwsak", "ownnv", "ownwmjvemnylzo",	/* 11408 */
+	"owotildpxaqum", "owpgvqoldkykm", "owq", "owqv",	/* 11412 */
+	"owroatfonr", "owsblqs", "owswsfnkgpthub", "owu",	/* 11416 */
+	"owuggdbrbpithq", "owwd", "owwgyft", "owx",	/* 11420 */
+	"owxnexswg", "owxxdxryb", "owymyhltbo", "ox",	/* 11424 */
+	"oxalb", "oxcd", "oxck", "oxdhbxkkmhzxw",	/* 11428 */
+	"oxflwwmmllwo", "oxg", "oxgcbzqgt", "oxghpnihedatr",	/* 11432 */
+	"oxgm", "oxgoypqlgbyt", "oxhasztnl", "oxhgnp",	/* 11436 */
+	"oxhmasmhm", "oxhtlmqctrqx", "oxhxa", "oxi",	/* 11440 */
+	"oxjninvljjunhm", "oxl", "oxnudq", "oxpdjlhdpenb",	/* 11444 */
+	"oxrlcamnuoe", "oxsuxagb", "oxszvyzrnaazoy", "oxvfjogljp",	/* 11448 */
+	"oxvgqgd", "oxvinhqlsts", "oxwrdgbzgut", "oxxmbcrd",	/* 11452 */
+	"oxzq", "oy", "oycmrswbt", "oycqaqgdbva",	/* 11456 */
+	"oydaacbgzzyg", "oyddggizviy", "oydsocytk", "oye",	/* 11460 */
+	"oyenicizsi", "oyeoyckctrw", "oygabdlgxxkou", "oygjpzihpueq",	/* 11464 */
+	"oyjbgdoumcwjxx", "oyl", "oymfsqejnjyxy", "oynlqcsmrozuwy",	/* 11468 */
+	"oynlyzfcfwt", "oyomzncunsjjn", "oyooze", "oyoyrojnwtq",	/* 11472 */
+	"oypjzhy", "oyqmjpoelgzbfm", "oysei", "oysfvky",	/* 11476 */
+	"oysqykeylze", "oytsovkciqqd", "oyujakffvb", "oyumuw",	/* 11480 */
+	"oyvdhtlbc", "oywrevgcvds", "oyxcmlvornz", "oyxmmivcvhdppj",	/* 11484 */
+	"oyxocxel", "oyxxjzkvrrqlrr", "oyyabvllseu", "oz",	/* 11488 */
+	"ozabibqpxugl", "ozbwowqtpjrmnz", "ozbyrv", "ozcgnhtbth",	/* 11492 */
+	"ozcmlajg", "ozd", "ozdkyymhoocm", "ozdvbhjdjuo",	/* 11496 */
+	"ozerliithowpyx", "ozfe", "ozftxcnoeyiu", "ozgvt",	/* 11500 */
+	"ozhnrqola", "ozi", "ozivppllilueyc", "ozjcm",	/* 11504 */
+	"ozkcbjgkbw", "ozlaiqs", "ozlsywvascx", "ozmdbtkookoiz",	/* 11508 */
+	"ozmhkh", "ozmod", "ozoavtwko", "ozot",	/* 11512 */
+	"ozqxpdy", "ozqyftqjew", "ozt", "oztfgiu",	/* 11516 */
+	"oztgyxr", "ozud", "ozvkymqrnt", "ozvlb",	/* 11520 */
+	"ozvuc", "ozxzbmcaq", "ozyfmupsfb", "ozyuck",	/* 11524 */
+	"ozzgemmgp", "pa", "pabajrdy", "pacbsi",	/* 11528 */
+	"padxxpyc", "paebvqy", "paexx", "pafio",	/* 11532 */
+	"paflavewbrqbg", "pah", "pahoflbr", "pajbkmujawwww",	/* 11536 */
+	"palftgskujj", "paljcztwiimq", "pallo", "palwwnkixjj",	/* 11540 */
+	"pam", "pamlxwrdslce", "panokfhppkc", "papcev",	/* 11544 */
+	"paqdxzwz", "paqmung", "par", "paranof",	/* 11548 */
+	"parhgtb", "pasgcl", "pavczo", "pawrkng",	/* 11552 */
+	"paxqvsmv", "payax", "paygftuxzzk", "paywjsipddwa",	/* 11556 */
+	"pazpdizs", "pb", "pbcbmipcogtlnm", "pbcic",	/* 11560 */
+	"pbclnre", "pbcqmc", "pbdqkfaaueud", "pbeebnbvucsj",	/* 11564 */
+	"pbfng", "pbiccehmw", "pbikmnljtn", "pbisaw",	/* 11568 */
+	"pbisoiswxuigh", "pbjmo", "pbjmuubnukxcp", "pbkhtjfuoblop",	/* 11572 */
+	"pblvfmcplzsefn", "pbpmpux", "pbq", "pbrddfx",	/* 11576 */
+	"pbsim", "pbtpeyjzovns", "pbucerpsegl", "pbupozklfrflav",	/* 11580 */
+	"pbvrilgsisar", "pbvtzk", "pbwbffmrrqgh", "pbwjpch",	/* 11584 */
+	"pbwp", "pbwvn", "pbzqln", "pbzvs",	/* 11588 */
+	"pc", "pcamzlg", "pcazhldqvsffn", "pccr",	/* 11592 */
+	"pce", "pcfeftpcwulrpr", "pcgdfn", "pcgjkokpqji",	/* 11596 */
+	"pcgrqj", "pcjpdjdwbhyr", "pckpbppcyiu", "pcmafyzoepws",	/* 11600 */
+	"pcmyer", "pcnnslmhvjhwbo", "pcojinhhpm", "pcorhk",	/* 11604 */
+	"pcpuaiccnotsey", "pcqzidhdnmedvo", "pcrxnwwhzfan", "pcsrnefbm",	/* 11608 */
+	"pcsuxxzlv", "pct", "pcvp", "pcvzf",	/* 11612 */
+	"pcxkciwzqjv", "pcxue", "pczl", "pcznhbnpjs",	/* 11616 */
+	"pd", "pdas", "pdbkfyrfcz", "pdbtmo",	/* 11620 */
+	"pdeilidi", "pdeuoqrxswq", "pdgcf", "pdhacxffhaxqy",	/* 11624 */
+	"pdhhfjuibakca", "pdhqlposdpednl", "pdisr", "pdkjczbbgxfho",	/* 11628 */
+	"pdkkuuwkge", "pdkqqakolbkwi", "pdkyx", "pdlxsbfpbq",	/* 11632 */
+	"pdmnbmcqvqrsn", "pdpcuxlvxfqz", "pdqhtxuxinlz", "pdqwguw",	/* 11636 */
+	"pdrggm", "pdrvttmymjlv", "pdsqlaxmlgehi", "pdxcksyprudwgq",	/* 11640 */
+	"pdxlaotacr", "pdxwwwmxhztqc", "pdxyhf", "pdzjekolhpwq",	/* 11644 */
+	"pe", "peaidclwr", "pebpfj", "pecl",	/* 11648 */
+	"peconvslalzhtn", "pedunp", "pefvqrp", "pefy",	/* 11652 */
+	"pegqnvdrnkbl", "pegtg", "pehkqqxljrtxo", "pejhvtn",	/* 11656 */
+	"pelsmhncdt", "penbinsusvrkml", "peprbvi", "peprvbs",	/* 11660 */
+	"pequrywajt", "peqwcksif", "pesdbi", "pesfxq",	/* 11664 */
+	"pevqsjyibwgqmw", "pewjigxscutuw", "pexdwtn", "pezj",	/* 11668 */
+	"pezx", "pf", "pfa", "pfbjizhgdbnyof",	/* 11672 */
+	"pferaxitobtxm", "pffdusls", "pfhhpxcb", "pfhpsnsk",	/* 11676 */
+	"pfjabsraxfus", "pfjntovtjintj", "pfknh", "pfko",	/* 11680 */
+	"pfmlnwqqjdsq", "pfpllcthkijkn", "pfpmy", "pfqqi",	/* 11684 */
+	"pfrjkjr", "pfrreuopav", "pfthsd", "pftslfyzd",	/* 11688 */
+	"pfuooo", "pfwmeokddzy", "pfxmynjehiiig", "pfysqrnxzyvz",	/* 11692 */
+	"pfzvbfwgrznswn", "pg", "pgaepot", "pgcb",	/* 11696 */
+	"pgctnqcob", "pgdshs", "pgg", "pggmjm",	/* 11700 */
+	"pggzvmwv", "pghjtgessxjll", "pgjfwjmtzsike", "pgjhetz",	/* 11704 */
+	"pgjxrgxo", "pgl", "pgmihmapclairj", "pgnaanxkxmpgr",	/* 11708 */
+	"pgnwix", "pgohoixp", "pgokaoayznaylw", "pgomdid",	/* 11712 */
+	"pgpogcphqcnrkl", "pgptlowdndnos", "pgrazryqm", "pgsbhlkxlymp",	/* 11716 */
+	"pgtrrieaddqb", "pgtu", "pgus", "pgv",	/* 11720 */
+	"pgykpewcqi", "pgyqkeyaaanow", "pgzx", "ph",	/* 11724 */
+	"phafpwphdzkb", "phalafjeii", "phcgidb", "phfmyqgpav",	/* 11728 */
+	"phg", "phizonwetiwo", "phkgjks", "phkl",	/* 11732 */
+	"phlxssgzjfoyxy", "phnuyxpc", "phpkb", "phqiuvtfcovz",	/* 11736 */
+	"phr", "phrq", "phssrvklzwhwbi", "phtuhdmefyz",	/* 11740 */
+	"phtz", "phucqpnzz", "phuifeok", "phuvfvommh",	/* 11744 */
+	"phvpvpzpufnoye", "phxdok", "pi", "piavf",	/* 11748 */
+	"pibilqzyoyo", "pibojwdlcbo", "picuttqwtkuix", "pidvnqxvdyhisu",	/* 11752 */
+	"pidxtbtbdla", "piesoaut", "pifv", "pihoxlbumjjq",	/* 11756 */
+	"piimcmwpesog", "piizagzd", "pijk", "pikbixhyugnsj",	/* 11760 */
+	"piowvirbeezg", "pipoqctaqzomwg", "pirqcanzhqdlj", "pitqlgogilszjt",	/* 11764 */
+	"piuusxswh", "piuwinsptbjqz", "pivzhehfcimg", "piwsheqtfni",	/* 11768 */
+	"pixfr", "pixmforb", "pixrqn", "pixztvq",	/* 11772 */
+	"piywlqahptaqo", "pizud", "pj", "pjacokiz",	/* 11776 */
+	"pjblm", "pjdh", "pjepfiqmenkyk", "pjesnaxezaj",	/* 11780 */
+	"pjintzronk", "pjjhmncqyilter", "pjjzhs", "pjkgupegmwl",	/* 11784 */
+	"pjkvqidzqhuyf", "pjky", "pjmwzksafqe", "pjn",	/* 11788 */
+	"pjo", "pjoooggdsuntm", "pjoqlfk", "pjpnpaewkfhdny",	/* 11792 */
+	"pjql", "pjretbqsh", "pjv", "pjvdsvua",	/* 11796 */
+	"pjvtyxpnlxmwcb", "pjxfdtzhcrn", "pjxwwvd", "pjybykgswgoa",	/* 11800 */
+	"pjyfxyfgtht", "pjzvvfl", "pk", "pkckuarmsji",	/* 11804 */
+	"pkgwat", "pkhh", "pki", "pkij",	/* 11808 */
+	"pkjvviof", "pkmirymgnlcwr", "pkmllrghfufbn", "pkpmwcwzfepf",	/* 11812 */
+	"pkpnoeangl", "pkqeve", "pkrh", "pksjcx",	/* 11816 */
+	"pksmpgbjzhvaii", "pktefe", "pkuggaowljztb", "pkwzohludsjxsv",	/* 11820 */
+	"pkxggv", "pkyozuiteccmst", "pkzwunfljvbvl", "pkzwyzkq",	/* 11824 */
+	"pl", "plalgwzec", "plapadvusvt", "plbihbkrv",	/* 11828 */
+	"plclndfccyzpm", "plcrgarvoiyfz", "pldw", "plfgprgqx",	/* 11832 */
+	"plfmfxoifnizp", "plgbqnhp", "plhtfvuupzbd", "pliwerolvijwo",	/* 11836 */
+	"plj", "plkx", "plnd", "ploymgnkw",	/* 11840 */
+	"plqtxvgzdwzfak", "plqvvdga", "plskcff", "pltrq",	/* 11844 */
+	"plvkoyx", "plwlke", "plydsxwvy", "plyvnfpxv",	/* 11848 */
+	"pm", "pmamrxrxofssl", "pmauvbdytdm", "pmcubjbmx",	/* 11852 */
+	"pmdjqmpjqrtlvz", "pmet", "pmfkc", "pmh",	/* 11856 */
+	"pmjk", "pmlfviaawikn", "pmlnbc", "pmmewnninspoum",	/* 11860 */
+	"pmmjbnaefam", "pmpi", "pmpogwptkhil", "pmpyto",	/* 11864 */
+	"pmrfcwsuo", "pmrfyg", "pmtsvemnbqqvod", "pn",	/* 11868 */
+	"pnaldbl", "pncowzenit", "pncwqngjs", "pndblukjbj",	/* 11872 */
+	"pndr", "pnev", "pnfyhkdyd", "pngauusn",	/* 11876 */
+	"pngauzjiaktgxr", "pngcma", "pnhergezycrm", "pnizpepppfmey",	/* 11880 */
+	"pnjeqrjmisouh", "pnjwwgz", "pnmfvdrndv", "pnovjpkvkoz",	/* 11884 */
+	"pnpjvhg", "pnpko", "pnppzgteg", "pnpshkfgiozla",	/* 11888 */
+	"pnpyfpx", "pnqkck", "pnulm", "pnvhblfuq",	/* 11892 */
+	"pnwywhys", "pnxkihkjkywpmt", "pnycklgcgtnz", "pnyfvuqkpgb",	/* 11896 */
+	"pnyjadbbsmnw", "po", "poafllvuzayrp", "poblhzfacfx",	/* 11900 */
+	"poblrlglouacw", "pocbhldcfpfnyl", "poddhutbxkw", "podqs",	/* 11904 */
+	"podrbdhlz", "podznbjszwd", "poezkmveeadwnp", "pog",	/* 11908 */
+	"poijlqj", "pokejv", "poktcydtystm", "pollblw",	/* 11912 */
+	"polymbioabjx", "pom", "ponsmjyiamyhpb", "pooljigrf",	/* 11916 */
+	"pop", "popyknvaers", "posazhkalyr", "posevvnl",	/* 11920 */
+	"potdofhyrkt", "potiuauqkndwr", "potkglfbskl", "potm",	/* 11924 */
+	"pou", "poudr", "poumsy", "poupgwjec",	/* 11928 */
+	"pourtweq", "pousidkkcos", "poxdslncfzxac", "poxdtd",	/* 11932 */
+	"poyv", "pozboazhaiy", "pozxvkwuuyby", "pp",	/* 11936 */
+	"ppargdqv", "ppc", "ppdo", "ppdztooone",	/* 11940 */
+	"ppfdbetrpfu", "ppgkem", "ppgyenrvw", "pphnurggrtlz",	/* 11944 */
+	"ppiqbypyt", "ppmtxyhxu", "pppkdslmonyim", "ppptwbm",	/* 11948 */
+	"pppwq", "pprcilfiojrl", "pprersxa", "pprs",	/* 11952 */
+	"ppslejrsbc", "ppud", "ppulxbpdkutvlg", "ppwpwbte",	/* 11956 */
+	"ppxnblseyviwo", "ppyolrypie", "ppyqfsi", "ppzeyerd",	/* 11960 */
+	"ppzwxigmjr", "pq", "pqaacubzcko", "pqbsnsgjnxg",	/* 11964 */
+	"pqekbofk", "pqerdcilaemj", "pqgpjk", "pqhlo",	/* 11968 */
+	"pqhwzn", "pqiew", "pqjlo", "pqkepxjnpt",	/* 11972 */
+	"pqkgqjlpxkbm", "pqlbul", "pqlnvfcaan", "pqmdhwdatxkq",	/* 11976 */
+	"pqmfgwryf", "pqmtsphrne", "pqmzmvkwpdqb", "pqnljwxjqy",	/* 11980 */
+	"pqozrhecg", "pqpimofkfksn", "pqqjko", "pqqrizpigpunqj",	/* 11984 */
+	"pqqsceq", "pqseuc", "pqsjtf", "pqslvyy",	/* 11988 */
+	"pqv", "pqvnibaagaob", "pqxjyklxyojwf", "pqxlaucv",	/* 11992 */
+	"pqxzkisb", "pqzczwbernr", "pr", "prazg",	/* 11996 */
+	"prbc", "prbnduzfmul", "prcbfgp", "prcellhwvy",	/* 12000 */
+	"prdqhiyzgh", "prekoa", "prf", "prfdenrjof",	/* 12004 */
+	"prgkrzvrdxkw", "prgoaixxxbe", "prgphxiw", "prgunnsis",	/* 12008 */
+	"prhuswxju", "prhxoox", "pri", "priohfws",	/* 12012 */
+	"prjcgs", "prkrxszn", "prn", "prpsyzxmyg",	/* 12016 */
+	"prpttp", "prqaewnwvb", "prqoiuzqfprk", "prsi",	/* 12020 */
+	"prud", "prudmo", "prupbfdhdtgegq", "prvuc",	/* 12024 */
+	"prw", "prwkkrxefpdrhl", "prygclfzg", "ps",	/* 12028 */
+	"psbviy", "pscucqgwnwq", "pscwxgsruo", "psczhlqhxq",	/* 12032 */
+	"psdat", "pse", "pseall", "psekewjvolgi",	/* 12036 */
+	"psfhlgraeh", "psgawgwrvi", "pshgrr", "pshuspeovf",	/* 12040 */
+	"psizhwsxkl", "psknqw", "psloe", "psmgw",	/* 12044 */
+	"psnlau", "psok", "pspddjlehsqe", "pspyic",	/* 12048 */
+	"psqf", "psqtiqcvlkx", "pstrehbrzj", "psuximccpsnbda",	/* 12052 */
+	"psw", "psyoax", "psyynkx", "pt",	/* 12056 */
+	"ptchpkol", "ptetd", "ptfxkadnjtdny", "ptgdqayyrjn",	/* 12060 */
+	"ptid", "ptivbhvrshdrhu", "ptjeqvky", "ptlauthnmpsew",	/* 12064 */
+	"ptljlr", "ptlrenyey", "ptnpwfhazwru", "ptnxhtq",	/* 12068 */
+	"ptny", "ptozkwmuah", "ptp", "ptpunqgd",	/* 12072 */
+	"ptpwzmjdikztky", "ptqzwequw", "ptsxgh", "pttftdnomxlg",	/* 12076 */
+	"ptu", "ptwegwdk", "ptwyxds", "ptwza",	/* 12080 */
+	"ptxdvlwskkp", "ptxyjbtb", "ptyunlqfeunpwx", "pu",	/* 12084 */
+	"pubdhplhwknt", "puckv", "puemex", "puexcarw",	/* 12088 */
+	"pufoqvnxdzpb", "pugjailfeqor", "pugozxnezuwbyg", "puhunvmfzpsfsp",	/* 12092 */
+	"puibvqrlwltk", "puiijkw", "pujktmp", "pukcgpunick",	/* 12096 */
+	"pukclfuxxd", "pulzdrpmpkela", "pumfpact", "pumrlblel",	/* 12100 */
+	"punaahs", "puneoxixy", "pup", "pupeejb",	/* 12104 */
+	"puqqbfb", "puqz", "puribu", "puuuw",	/* 12108 */
+	"puvfz", "puwhtmhniv", "puwhuwv", "puwmvqavvmsr",	/* 12112 */
+	"puwufehzjqji", "puxog", "puzgughzgl", "pv",	/* 12116 */
+	"pvamz", "pvaqt", "pvatao", "pvbkzotkwr",	/* 12120 */
+	"pvbprygkwvmpbr", "pvcefr", "pvcmgltldqrgeu", "pvcmqp",	/* 12124 */
+	"pvdgstzgluoct", "pveadii", "pveizpvxacf", "pvgfhnow",	/* 12128 */
+	"pvgq", "pvhsulj", "pvi", "pvioqw",	/* 12132 */
+	"pvkryodyeobhy", "pvl", "pvldewqvder", "pvlepkj",	/* 12136 */
+	"pvls", "pvntz", "pvooarfhxibe", "pvpogrtbmkp",	/* 12140 */
+	"pvqiktawhwlit", "pvrmxm", "pvshtetcmfop", "pvtbziwo",	/* 12144 */
+	"pvvnjcwtpddyz", "pvxmp", "pvyshkrfh", "pvzocvtdjgv",	/* 12148 */
+	"pvztzarijmzsxh", "pw", "pwaw", "pwbdyydad",	/* 12152 */
+	"pwbsxru", "pwcpsnbvsjnvgl", "pweiwmt", "pwfubwdqtrcau",	/* 12156 */
+	"pwhxqtfwsoxwoz", "pwhzthdrlfdybw", "pwijfuu", "pwjw",	/* 12160 */
+	"pwkakqdrco", "pwlfhbjuorrotj", "pwln", "pwloyszocgeatk",	/* 12164 */
+	"pwofit", "pwognqup", "pwqefaqvo", "pwqi",	/* 12168 */
+	"pwrddbpmqh", "pwrhz", "pwtvifegj", "pwurtlrc",	/* 12172 */
+	"pwv", "pwwaapjkd", "pwxtsnqqfbtjh", "pwz",	/* 12176 */
+	"pwzjhgt", "pwzjibyb", "pwztxsobuwozl", "pxacvmeembvjkm",	/* 12180 */
+	"pxapbjw", "pxbcq", "pxbqvqeiookxti", "pxc",	/* 12184 */
+	"pxd", "pxe", "pxeosngcnttqqz", "pxfmbcsgkbqx",	/* 12188 */
+	"pxgmsplaz", "pxkopdprgslnnn", "pxmgjhsygoay", "pxnonvv",	/* 12192 */
+	"pxpishfuyejobi", "pxrfvgckopyoi", "pxrjfrafzf", "pxrzsynvyjti",	/* 12196 */
+	"pxsbwrtofdb", "pxshdtqag", "pxtcvu", "pxujfzyoqvsm",	/* 12200 */
+	"pxuzbxdxmse", "pxvwjri", "pxx", "pxxxe",	/* 12204 */
+	"pxyjtft", "py", "pyabmuwnx", "pycnsyfumuakv",	/* 12208 */
+	"pycoqty", "pydm", "pydmqvqgjpde", "pydslwzhmoyxk",	/* 12212 */
+	"pyhdebyxeuuey", "pyihvpfung", "pyiveybh", "pyizjd",	/* 12216 */
+	"pylwsuk", "pym", "pymbudjwx", "pymsizhplbg",	/* 12220 */
+	"pyqynxfldiny", "pyrrqunupklckx", "pysftfp", "pysnwg",	/* 12224 */
+	"pyta", "pyugqhe", "pyvedlwpgiolpb", "pyvsdossl",	/* 12228 */
+	"pywceyvkcv", "pywtp", "pyx", "pyxoprpo",	/* 12232 */
+	"pyy", "pyzqcluu", "pyzqlqoir", "pz",	/* 12236 */
+	"pzadeyr", "pzcrldhbutrvo", "pzdxap", "pzhledvoqlymv",	/* 12240 */
+	"pzi", "pzkohqdnc", "pzmedac", "pznaxdel",	/* 12244 */
+	"pznnnyltxpy", "pzokmgtskhl", "pzowzggybno", "pzp",	/* 12248 */
+	"pzperk", "pzpi", "pzpwqh", "pzqrkxpjhtgkbc",	/* 12252 */
+	"pzrgdcgysj", "pzsdqhyp", "pztcqgoud", "pztsh",	/* 12256 */
+	"pzum", "pzyiszckgu", "pzykfzabuua", "pzzyxiyfp",	/* 12260 */
+	"qa", "qadpkakhyfbc", "qafkcvvj", "qaglmkihuy",	/* 12264 */
+	"qagxdlxbuwo", "qaijanprnt", "qainvcgfvicnc", "qajhkxdac",	/* 12268 */
+	"qajtsicehihv", "qakdannoknptug", "qakimksajaxp", "qakltzdtei",	/* 12272 */
+	"qakwztjvj", "qalejfjse", "qalorb", "qalwmzo",	/* 12276 */
+	"qalz", "qaniyxjnemzdl", "qap", "qaprbshj",	/* 12280 */
+	"qaqgunkyhsfivw", "qarkztjw", "qaryrygdavpjt", "qasmczznj",	/* 12284 */
+	"qatfyfrwvksp", "qaultsx", "qawzz", "qazdoviwkm",	/* 12288 */
+	"qazlbcfonfy", "qazwfrpgbrwsvk", "qb", "qba",	/* 12292 */
+	"qbcgtvn", "qbchpbpwrtka", "qbdh", "qbdyocjvmyt",	/* 12296 */
+	"qbhrwram", "qbiffesik", "qbilmlymlm", "qbiqdxsnc",	/* 12300 */
+	"qbkdy", "qblvxed", "qbntk", "qbqhteauxq",	/* 12304 */
+	"qbqtzphjfreh", "qbrzhhohb", "qbsaudboeggy", "qbso",	/* 12308 */
+	"qbux", "qbvtpu", "qbvtxkxvj", "qbzbe",	/* 12312 */
+	"qbzvj", "qc", "qcaihkhr", "qcciemi",	/* 12316 */
+	"qccscrdjan", "qcczmper", "qcezkdv", "qcffvho",	/* 12320 */
+	"qcfqeiuc", "qcfqulednqyb", "qcfu", "qcgtver",	/* 12324 */
+	"qch", "qci", "qcieqzvijbgam", "qckvbis",	/* 12328 */
+	"qckyrztal", "qcnaqutookfnf", "qcomcuqiw", "qcor",	/* 12332 */
+	"qcpxuno", "qcrlalglgsqp", "qcsfibea", "qcsl",	/* 12336 */
+	"qcv", "qcvnzofobdq", "qcvpdtglsmuyo", "qcwlfsp",	/* 12340 */
+	"qcxvqpkwzlv", "qcydipugx", "qcyfrk", "qd",	/* 12344 */
+	"qdasrtjsc", "qdauovhpvtjml", "qdb", "qdbscnz",	/* 12348 */
+	"qdbx", "qdclliqlu", "qddnyzjlapm", "qddpck",	/* 12352 */
+	"qdds", "qdfloiagrwsaau", "qdfzvmf", "qdhl",	/* 12356 */
+	"qdi", "qdje", "qdjjug", "qdjqi",	/* 12360 */
+	"qdk", "qdkzkssyqxv", "qdldsqldzgjao", "qdllexos",	/* 12364 */
+	"qdltxxxkh", "qdmtiz", "qdntphfo", "qdnykynjzczlc",	/* 12368 */
+	"qdorkxgbixcl", "qdq", "qdr", "qdsrlskli",	/* 12372 */
+	"qdswp", "qdtezzjj", "qduzifmxubo", "qdvepsc",	/* 12376 */
+	"qdwmtxbqpmycc", "qdxnqrkygunyvl", "qdystwwupmknr", "qdyxkikvafipd",	/* 12380 */
+	"qdzguu", "qe", "qeamhjru", "qeatsnmlzrieki",	/* 12384 */
+	"qeaxrytsyp", "qebxhnqctqtak", "qecblpk", "qeeepnktdqbsyo",	/* 12388 */
+	"qeeixn", "qefdk", "qefii", "qefrwbfgu",	/* 12392 */
+	"qehejmttipdrn", "qeheuugvjjkeif", "qehia", "qehtrcjrvcta",	/* 12396 */
+	"qeizryf", "qej", "qejqpgyvz", "qem",	/* 12400 */
+	"qemdtmlhadg", "qemnokue", "qeni", "qenie",	/* 12404 */
+	"qenpfsbeqdus", "qensnnqkp", "qeocdbcu", "qeojhntcifsn",	/* 12408 */
+	"qepu", "qer", "qeshrgknxogas", "qesipdt",	/* 12412 */
+	"qetzxzjwyp", "qeurti", "qewc", "qewusnpi",	/* 12416 */
+	"qewxbxexiuws", "qex", "qexqxglxgmwi", "qexsycayecmv",	/* 12420 */
+	"qeyrzrjfowacqy", "qf", "qfat", "qfbnhivqogb",	/* 12424 */
+	"qfbxtrptb", "qfccmx", "qfdggixtgretw", "qffhoettytyjsk",	/* 12428 */
+	"qffouomn", "qfgvhxlhner", "qfhbup", "qfhlsgm",	/* 12432 */
+	"qfhrn", "qfirqnpmxt", "qfizf", "qfjvbyarirprg",	/* 12436 */
+	"qfjzrygkzyv", "qfkjrx", "qflitgzztzwxv", "qfojwncqxtgnk",	/* 12440 */
+	"qfonsutqkwhh", "qfp", "qfpp", "qfqifem",	/* 12444 */
+	"qfqrqfofrnw", "qfqzrpcyx", "qfrcq", "qfrdtvorgf",	/* 12448 */
+	"qfrkjt", "qftok", "qfu", "qfuydahfnzgp",	/* 12452 */
+	"qfv", "qfwotql", "qfxgwnvdsxscas", "qfxwoo",	/* 12456 */
+	"qfy", "qfzhch", "qfzhrjyyh", "qfzj",	/* 12460 */
+	"qg", "qgamdorp", "qgbvfhlhi", "qgdxollxb",	/* 12464 */
+	"qgfcogiyggsj", "qgfelq", "qggdgybzb", "qgghts",	/* 12468 */
+	"qgievn", "qgijdnoqs", "qgimdnliwz", "qgiwipklrco",	/* 12472 */
+	"qgjtkpbkr", "qgk", "qglqavmsnmkt", "qglxo",	/* 12476 */
+	"qgmhzmnhsgcxgi", "qgod", "qgotqnxwjwfot", "qgpfcowfrkahi",	/* 12480 */
+	"qgrwagyhvzn", "qgspcpptm", "qgtqpgv", "qgwembfgn",	/* 12484 */
+	"qgwomcxacjxto", "qgxxzxjzorz", "qgytarrjv", "qgz",	/* 12488 */
+	"qha", "qhax", "qhbsrzcbjoha", "qhcuzwqi",	/* 12492 */
+	"qhdgrcnanasip", "qhefovbz", "qheyd", "qhgru",	/* 12496 */
+	"qhhdov", "qhhoy", "qhhqlqv", "qhiavphubb",	/* 12500 */
+	"qhinfob", "qhj", "qhjbnantco", "qhjcwrfalomcl",	/* 12504 */
+	"qhjunwzs", "qhjwrbcsimuil", "qhklpmbhfizc", "qhkmwktq",	/* 12508 */
+	"qhlm", "qhlqssf", "qhmuqmv", "qhmwxttofqr",	/* 12512 */
+	"qhnudu", "qhoexz", "qhoigcw", "qhperrkql",	/* 12516 */
+	"qhpr", "qhqcovlhx", "qhromdewiafptd", "qhscl",	/* 12520 */
+	"qhshludle", "qhtiyg", "qhtrmzjefgqcg", "qhtsrtlxq",	/* 12524 */
+	"qhtxexcmmw", "qhu", "qhvaxdmpoyzxw", "qhvdk",	/* 12528 */
+	"qhwdnvwgf", "qhxnnwdu", "qia", "qiafsza",	/* 12532 */
+	"qiaglsynd", "qiawroweoqqls", "qibajpm", "qibirki",	/* 12536 */
+	"qibmqdhtatph", "qicmorww", "qifdhxbns", "qifeberbrlb",	/* 12540 */
+	"qifvspn", "qihdstoaueyl", "qihi", "qihq",	/* 12544 */
+	"qiih", "qiivxxhnwryyge", "qikbxmvhx", "qimfvclel",	/* 12548 */
+	"qimhgstcrvdpez", "qimwchahiev", "qinxlz", "qinyxw",	/* 12552 */
+	"qipwglwy", "qiq", "qiqhorwvbqwjui", "qirz",	/* 12556 */
+	"qisaivteuluwaf", "qitbbki", "qiubuzwqtbhr", "qiytpojiwgsk",	/* 12560 */
+	"qizl", "qizowkkpfrhc", "qizpwnp", "qj",	/* 12564 */
+	"qjcboehyh", "qje", "qjeafpyjwfxbcb", "qjeekwdosmrib",	/* 12568 */
+	"qjefdgct", "qjfmcrlknf", "qjgl", "qjgmbknsw",	/* 12572 */
+	"qjgrnz", "qjhkpcwhbodii", "qjjtnqoxeqmk", "qjjtpcnhwgpd",	/* 12576 */
+	"qjkciauev", "qjmkenuzpe", "qjnoyaneoqkxa", "qjo",	/* 12580 */
+	"qjowuo", "qjqhbu", "qjqsdn", "qjqtguklkgh",	/* 12584 */
+	"qjrdkbkeixgo", "qjrmmvykipca", "qjtgglnoied", "qjuwzbg",	/* 12588 */
+	"qjvcbtvqdpc", "qjvisbz", "qjwkwkevaudi", "qjwtbznn",	/* 12592 */
+	"qjyazetsoljwsd", "qjyeqndbkumyqa", "qjyohmusk", "qka",	/* 12596 */
+	"qkbgcqtig", "qkbvs", "qkddjpdwtccx", "qkdjt",	/* 12600 */
+	"qkeffkpvwcmgvz", "qkfmtbopdukgc", "qkfzpxbrkgdywe", "qkgrof",	/* 12604 */
+	"qkgvmxm", "qkhlbxyor", "qkilbamgpavvmr", "qkipbgfibj",	/* 12608 */
+	"qkj", "qkjmitmarn", "qklakh", "qkmewsfdo",	/* 12612 */
+	"qkmqqrmhu", "qkmrvghobgp", "qkofiajomdt", "qkosjkceddv",	/* 12616 */
+	"qkpubpugr", "qkqnnmenpidn", "qkqu", "qkrmnuycqbqd",	/* 12620 */
+	"qkrqrtittz", "qkv", "qkvgxbxfnmwdgb", "qkvl",	/* 12624 */
+	"qkxdsyiacumtm", "qkxsnvjgu", "qkxyjnrphg", "qkzieb",	/* 12628 */
+	"ql", "qlbnrsi", "qlcayxiflbc", "qlclvdeid",	/* 12632 */
+	"qldcaohyqtol", "qldoruigypnth", "qldtkgledygdf", "qlewmosyxacxvn",	/* 12636 */
+	"qlgcaam", "qlgupjm", "qlh", "qlineqwajmrvi",	/* 12640 */
+	"qlno", "qlpgeerwuhqxqk", "qlpiudpajt", "qlqdnt",	/* 12644 */
+	"qlsbfnh", "qlwcwh", "qlxa", "qlysuspbzhuw",	/* 12648 */
+	"qlzrkpcz", "qm", "qmbplulg", "qmeiq",	/* 12652 */
+	"qmiyafjqyitnsc", "qmjfwha", "qmjwqj", "qmna",	/* 12656 */
+	"qmneryjnhe", "qmnynga", "qmpem", "qmq",	/* 12660 */
+	"qmqcbefqq", "qmt", "qmtbutcwieo", "qmu",	/* 12664 */
+	"qmudsuxiykkh", "qmuqrigt", "qmux", "qmvuhhg",	/* 12668 */
+	"qmxaqsdujzy", "qmyfylyfcnqah", "qmzdsapfxys", "qn",	/* 12672 */
+	"qnas", "qnda", "qndkgglzoab", "qndu",	/* 12676 */
+	"qnef", "qnfghdsesqdx", "qnhbdwknbr", "qnikzlrydz",	/* 12680 */
+	"qnksrl", "qnlnat", "qnmj", "qnmoyvbhlixpd",	/* 12684 */
+	"qnnc", "qnndwp", "qnnnwc", "qnphkxbmsaweaa",	/* 12688 */
+	"qnplxeiph", "qnrgxexgjiep", "qnsdosvzt", "qnuttz",	/* 12692 */
+	"qnuxeeexic", "qnwljqtwh", "qnxphmyjkbur", "qnxscqlypmbdgt",	/* 12696 */
+	"qnzsjfdhngfc", "qnztegv", "qo", "qoab",	/* 12700 */
+	"qoablzkhdxhlby", "qoawskmc", "qobcddtwnyix", "qodbrzsspxncd",	/* 12704 */
+	"qofme", "qoftqhvmfckln", "qogcxfqt", "qogmrnyyj",	/* 12708 */
+	"qohmdtbfk", "qoidjpukyt", "qoiyjeikqwlof", "qojhdn",	/* 12712 */
+	"qojyrsws", "qok", "qoklcrqvxjota", "qokuqrrwnow",	/* 12716 */
+	"qolyfmonbp", "qomufixxo", "qonwv", "qooajdbhkbsee",	/* 12720 */
+	"qoqfhyy", "qoqh", "qoqpunhylhou", "qoqtkngzsytr",	/* 12724 */
+	"qorhsxwpabuyxa", "qorlkapmh", "qosjg", "qosy",	/* 12728 */
+	"qouppebhurrkwg", "qovc", "qovczkgmesf", "qoyhx",	/* 12732 */
+	"qoyufeakempczz", "qozaglyx", "qp", "qpcbosxadh",	/* 12736 */
+	"qpe", "qphprcspa", "qphsanvedkclu", "qpiy",	/* 12740 */
+	"qpk", "qplystcu", "qpmhflaufut", "qpmlgqc",	/* 12744 */
+	"qpprdphuc", "qpq", "qpspwkqzfs", "qpssganftmjefo",	/* 12748 */
+	"qptirqtkio", "qptwqbyt", "qpubdtwnu", "qpvtatqlyc",	/* 12752 */
+	"qpwwiyrru", "qpx", "qpyiovzxahd", "qq",	/* 12756 */
+	"qqafd", "qqayotyxnp", "qqbitckezednru", "qqcodnufascqen",	/* 12760 */
+	"qqdrzioewud", "qqdtyk", "qqemuqq", "qqexbj",	/* 12764 */
+	"qqgljj", "qqgnfdkbyuclj", "qqhkauf", "qqjrqkmkqbgnw",	/* 12768 */
+	"qqkhbdqixap", "qqknkmh", "qqlrcskpan", "qqlrhfblx",	/* 12772 */
+	"qqmhqh", "qqmjgx", "qqodtk", "qqptp",	/* 12776 */
+	"qqqdpousqqqg", "qqqqiulowkddx", "qqr", "qqrqyv",	/* 12780 */
+	"qqrzxvravexx", "qqrzzrnwflh", "qqs", "qqusxdkthc",	/* 12784 */
+	"qqv", "qqvxlygwggzv", "qqwdbxkbfz", "qqxd",	/* 12788 */
+	"qqxzgergocsigp", "qqyntvxs", "qqyrnbhixoog", "qr",	/* 12792 */
+	"qrbcoboazvveqf", "qrdsagedhbpkue", "qrdtr", "qrenbnyzvwiq",	/* 12796 */
+	"qrfob", "qrg", "qrgcbgczfjiv", "qrgfjaxsb",	/* 12800 */
+	"qrhmzopnaoxlk", "qrijtwrfphfaw", "qrikfnamwmoi", "qrilhisnajuaag",	/* 12804 */
+	"qriwtage", "qrjzbhc", "qrkmtlxuoxym", "qrlq",	/* 12808 */
+	"qrlsukjdy", "qrmqn", "qrmr", "qrmsq",	/* 12812 */
+	"qrmsqsaf", "qrntjqnehkmpr", "qrpayvbh", "qrq",	/* 12816 */
+	"qrquujpft", "qrrrwmsn", "qrryzxwf", "qrs",	/* 12820 */
+	"qru", "qruhuzbw", "qruwjpjrqtripo", "qruwtjr",	/* 12824 */
+	"qrvgcddbp", "qrvo", "qrwsa", "qrx",	/* 12828 */
+	"qrxbwvajdbqew", "qrxoujjpeawonv", "qrz", "qrzv",	/* 12832 */
+	"qs", "qsadd", "qsakjyibvgte", "qsbmpforivync",	/* 12836 */
+	"qsccpiz", "qsdjfsj", "qsdmcvjqzrbnjq", "qsdtrnijfk",	/* 12840 */
+	"qselrvanhvhmbg", "qsendocksnhfca", "qsenv", "qsfvuxhuaxye",	/* 12844 */
+	"qsfyelq", "qsgt", "qshav", "qsihrqdii",	/* 12848 */
+	"qsjfepyxzxv", "qsjuqzhibb", "qsjwyppfvnpqrs", "qsm",	/* 12852 */
+	"qsmai", "qsnbvbgtqokpc", "qsnwza", "qsqll",	/* 12856 */
+	"qsrjmjcoq", "qst", "qstluaqkk", "qstshteja",	/* 12860 */
+	"qstvxgnjbb", "qsuoxadfpibjw", "qsusls", "qsvksfuxiatjlg",	/* 12864 */
+	"qsvr", "qswjvyuthdzkap", "qsx", "qsxasbwdbwbcdh",	/* 12868 */
+	"qsxzupzbfskuoh", "qt", "qtazlaccdw", "qtdqwsyxktbcw",	/* 12872 */
+	"qtetyy", "qtf", "qtfo", "qtfzyhcnvevb",	/* 12876 */
+	"qtfzzaaxozwbc", "qtgndjiuam", "qtgtidd", "qtgtzcz",	/* 12880 */
+	"qtiqdajz", "qtiznnqnsny", "qtjeelwehxohft", "qtkplynwo",	/* 12884 */
+	"qtlle", "qtllfuxjrhios", "qtndufbadfx", "qtolfdxak",	/* 12888 */
+	"qtp", "qtqwed", "qtsjwvycbqw", "qtspazwyipded",	/* 12892 */
+	"qtxfra", "qtxjmn", "qtxozqddwnd", "qu",	/* 12896 */
+	"quarypykfnyzj", "qubnh", "qubtqiadnjnf", "qucgnys",	/* 12900 */
+	"qudda", "quepb", "quhhgpgdyeeaa", "quhmnbbxxglmky",	/* 12904 */
+	"quklywkdstqxp", "quladmdwtm", "qulxclkz", "qumicwbviusyq",	/* 12908 */
+	"qumrhqrkiiu", "qumsnvnag", "qunfufh", "qunhnzbhcjwdwc",	/* 12912 */
+	"qunytehbvwri", "quogy", "quoyegk", "quqqer",	/* 12916 */
+	"qurdfymrzeigp", "qutbqelgzugi", "qutdbtk", "qutwsbcmx",	/* 12920 */
+	"qutzvu", "quzqj", "quzsj", "quzvlkudfmbitw",	/* 12924 */
+	"qv", "qvaesil", "qvaifi", "qvanhohqdkt",	/* 12928 */
+	"qvaxweaf", "qvbqxyinoo", "qvccxum", "qvdagjav",	/* 12932 */
+	"qvdemebihmvdr", "qvdjpibiwfoueb", "qveyfrrbqg", "qvfkl",	/* 12936 */
+	"qvgvqruz", "qvleelzbiiadhy", "qvm", "qvmlsyt",	/* 12940 */
+	"qvnwldd", "qvoctk", "qvolrib", "qvpgmiqu",	/* 12944 */
+	"qvpvfe", "qvrbjdajn", "qvrfzhufnzh", "qvsnkbelv",	/* 12948 */
+	"qvtdiwl", "qvtmnrgiwdfxcj", "qvvk", "qvwfkzvor",	/* 12952 */
+	"qvwfzau", "qvyln", "qvymytt", "qvyody",	/* 12956 */
+	"qvyovxq", "qvyygzfqoi", "qvzfiagsbhr", "qvzujdqexqx",	/* 12960 */
+	"qvzypug", "qw", "qwadw", "qwarctividyac",	/* 12964 */
+	"qwbgvtuo", "qwccgbs", "qwcfskyrlw", "qwegz",	/* 12968 */
+	"qwemhxbtzuf", "qweyib", "qwfkjpp", "qwftdokzdov",	/* 12972 */
+	"qwgc", "qwiaqls", "qwivncdbe", "qwj",	/* 12976 */
+	"qwkaordsymsvn", "qwm", "qwmkkb", "qwmnqhplgl",	/* 12980 */
+	"qwntglrqc", "qwozsbdoj", "qwpgplj", "qwpxv",	/* 12984 */
+	"qwqeyli", "qwrbnmddsb", "qwsxqyjrawudc", "qwvgbtvtxwf",	/* 12988 */
+	"qwwfcyopnt", "qwy", "qwytngrtfykzdd", "qwzpzrudvlcrr",	/* 12992 */
+	"qx", "qxaqrqdg", "qxasyujgbjdy", "qxbw",	/* 12996 */
+	"qxffhzma", "qxfphepnhs", "qxguduaiwp", "qxjezosax",	/* 13000 */
+	"qxjmagp", "qxlcxl", "qxlr", "qxofwzxcrywb",	/* 13004 */
+	"qxq", "qxqnbegaj", "qxrhtllbicm", "qxsbucj",	/* 13008 */
+	"qxscnpsyylp", "qxszcpduq", "qxtd", "qxvir",	/* 13012 */
+	"qxwaordetctchg", "qxwnoqymjxjuar", "qxysrpcfuyxpz", "qy",	/* 13016 */
+	"qybjbclldvqo", "qybkjfgqdeu", "qydldumgppnph", "qydrkwjjrlejk",	/* 13020 */
+	"qyfyrvufqb", "qygepwppzz", "qygovaxyjr", "qygqaie",	/* 13024 */
+	"qygviqqde", "qyjaoebhw", "qyjen", "qyjxsvtni",	/* 13028 */
+	"qykupee", "qylhvdm", "qymid", "qyo",	/* 13032 */
+	"qyokhfgos", "qypnksgwfacqpd", "qypuhr", "qyrzyqidxo",	/* 13036 */
+	"qysslaybyup", "qysv", "qyswnwyjc", "qytyuzqrnoktm",	/* 13040 */
+	"qyudx", "qyvknr", "qyywz", "qyz",	/* 13044 */
+	"qyzrhrqypeyvbf", "qz", "qza", "qzank",	/* 13048 */
+	"qzapxk", "qzbbvncn", "qzbnmdaykpdnv", "qzbtuujofctup",	/* 13052 */
+	"qzcnpybjxyw", "qzcy", "qzdvzlmndejm", "qze",	/* 13056 */
+	"qzfbeiqonbnomw", "qzi", "qzif", "qziqb",	/* 13060 */
+	"qzlhrtcgqpt", "qzliyemicuzw", "qzon", "qzonvuoogtzkx",	/* 13064 */
+	"qzoolsffleb", "qzp", "qzphbmlut", "qzpqcqscpkj",	/* 13068 */
+	"qzptsvrqptvxs", "qzqme", "qzrano", "qzrblnim",	/* 13072 */
+	"qzregtervrqyrp", "qzrpsxttfrpzkt", "qzsdkpxqqnqzj", "qzssnbloagj",	/* 13076 */
+	"qztht", "qzumvskm", "qzuwiffofgfveg", "qzvvqjoylsw",	/* 13080 */
+	"qzwbhfjz", "qzxlpetni", "qzxwscguxme", "qzynaea",	/* 13084 */
+	"qzyuank", "qzzkgpqlxbuso", "ra", "raaai",	/* 13088 */
+	"rabcyrlpbvq", "racrogodl", "racz", "radic",	/* 13092 */
+	"radmeejzayaa", "raekuhdvlhaah", "raet", "rafhv",	/* 13096 */
+	"rafjrppamxwze", "rafxd", "ragljxjmtxg", "rajwbnjkm",	/* 13100 */
+	"rak", "ralqpqlhmtxnuo", "ramdhufev", "ramvgnxaqhyo",	/* 13104 */
+	"ramxbsnaje", "rapwhud", "rascqmf", "rastrwldigddw",	/* 13108 */
+	"ratipsdd", "ratjqnsigzc", "raukksem", "rauzigminkdqs",	/* 13112 */
+	"ravsudjphn", "raw", "raxiu", "raxyflxaeeoof",	/* 13116 */
+	"raz", "razgww", "rb", "rbarmi",	/* 13120 */
+	"rbblprlep", "rbc", "rbcoi", "rbdbgttsitvkci",	/* 13124 */
+	"rbdnyvdhg", "rbdxpmiue", "rbfhyijiyamd", "rbfnnlmhrrmvg",	/* 13128 */
+	"rbfvumbdk", "rbfzgxruhu", "rbgczghwz", "rbguyxzmaazlh",	/* 13132 */
+	"rbieqkjgz", "rbihbd", "rbmaks", "rbnoorrnruc",	/* 13136 */
+	"rbnstjn", "rboapmsuvypk", "rbofhsfvbg", "rbonamlerq",	/* 13140 */
+	"rbpjlqxexzqtr", "rbqdfdyijf", "rbqmzm", "rbqojaghkx",	/* 13144 */
+	"rbsk", "rbtkzassdkwx", "rbvrq", "rbwrv",	/* 13148 */
+	"rbxojlpjatu", "rbxsacagrxj", "rbygr", "rbyjbzycw",	/* 13152 */
+	"rbzevekq", "rbzrpkyatwpphn", "rc", "rcbbprk",	/* 13156 */
+	"rccmcxjh", "rcebdlxk", "rceeynil", "rcfucrozrmni",	/* 13160 */
+	"rcgiur", "rchd", "rchif", "rchmejgvxm",	/* 13164 */
+	"rcizuxhy", "rcjvyxhbya", "rckovi", "rckqq",	/* 13168 */
+	"rcmktn", "rcmrqkydrhmjt", "rcno", "rco",	/* 13172 */
+	"rcoatre", "rcpfdywav", "rcphzuo", "rcpw",	/* 13176 */
+	"rcqyjcblqpjc", "rcrvvjxfcu", "rctmwdzjdrddt", "rcttsstalqeq",	/* 13180 */
+	"rcvslmis", "rcvv", "rcvyugpwbww", "rcwmizmhwmj",	/* 13184 */
+	"rcwntezhwpgg", "rcza", "rczjbh", "rd",	/* 13188 */
+	"rdaco", "rdajvvhkpyo", "rdb", "rdbdoposox",	/* 13192 */
+	"rdcmjwaexcmzfn", "rddigydtj", "rddrcsznqx", "rddsjnawe",	/* 13196 */
+	"rdevecymzaf", "rdfba", "rdhk", "rdhtmwy",	/* 13200 */
+	"rdhzifaaxm", "rdiiyofcrf", "rdintjblpo", "rdipxfniljki",	/* 13204 */
+	"rdkcuqbgamtfc", "rdkhniv", "rdmkcb", "rdn",	/* 13208 */
+	"rdowzeniuchn", "rdp", "rdpasjuizewb", "rdpfg",	/* 13212 */
+	"rdpzrpvkxm", "rdqilfdvsi", "rdrlavaqcwcew", "rdrryhfnntyf",	/* 13216 */
+	"rdsejrjwzvp", "rdsjdwzpikgvma", "rdsrikjklifjtx", "rdtfidgbvve",	/* 13220 */
+	"rdtxcrvicf", "rdxjcr", "rdybj", "rdybuxpw",	/* 13224 */
+	"rdzeoahq", "rdzqy", "rdzsdu", "re",	/* 13228 */
+	"recohfpc", "redb", "redqgsdrphdity", "reegckzjfbptzh",	/* 13232 */
+	"reeghhlw", "ref", "regubqvnrezty", "reh",	/* 13236 */
+	"rejl", "reklpjwoofjk", "relgqpdcfd", "relk",	/* 13240 */
+	"rem", "reowhzqiumer", "repjwr", "rerjfhzmdc",	/* 13244 */
+	"reryaimmtnuoyx", "res", "resicyvofvql", "reudmhk",	/* 13248 */
+	"rewozpedrykpa", "rexmqn", "reye", "rezpnfpzchslx",	/* 13252 */
+	"rf", "rfbymkxvhltf", "rfcfpnjz", "rfdpfstft",	/* 13256 */
+	"rffgkiddiyj", "rffuygsggr", "rfgddehcu", "rfgdpeyvxwt",	/* 13260 */
+	"rfgo", "rfgqxfhnkuclsz", "rfh", "rfhcgpfbvmjae",	/* 13264 */
+	"rfi", "rfitndkcxyyw", "rfjedawevjjvux", "rfkvqdovfilihy",	/* 13268 */
+	"rfl", "rflqbw", "rfoorosvebaugm", "rfr",	/* 13272 */
+	"rfswuhsjmrjisv", "rftzqp", "rfwfrnsly", "rfzipwown",	/* 13276 */
+	"rfztzshegavl", "rfzuysbw", "rg", "rgapeotsr",	/* 13280 */
+	"rgc", "rgcenueozgt", "rgcwpomozs", "rgdkvpg",	/* 13284 */
+	"rgdkwjnxzhwxfi", "rgdnemoac", "rgen", "rgeubuzfdbk",	/* 13288 */
+	"rggkpp", "rgh", "rgingkbqt", "rgjjlsjnlehg",	/* 13292 */
+	"rgmnhsgsrpr", "rgnbplsrgqnpln", "rgndvxtujzv", "rgovvtc",	/* 13296 */
+	"rgp", "rgpeqxnpolp", "rgpjf", "rgqmylws",	/* 13300 */
+	"rgrc", "rgrdvmkrxso", "rgswqmendlbtrw", "rgthb",	/* 13304 */
+	"rgttogtc", "rgud", "rgwovkzix", "rgxnzhmgdkfmv",	/* 13308 */
+	"rgzrvmdyewmntw", "rh", "rhaqfsa", "rhbjpabfc",	/* 13312 */
+	"rhbsjezbsiig", "rheuijn", "rhfc", "rhfp",	/* 13316 */
+	"rhhbtw", "rhhktev", "rhlfcomyrlu", "rhlhvhyoj",	/* 13320 */
+	"rhmqlsloiv", "rhnk", "rhnlwlivk", "rhnnqixfs",	/* 13324 */
+	"rhounoryhkqz", "rhpexvapsx", "rhqiyeqpsawi", "rhskshxxrpmpe",	/* 13328 */
+	"rhsvkwbghxqrm", "rhswdadtvmtdev", "rhtxthdurvzs", "rhuzwqoh",	/* 13332 */
+	"rhvuciadrgooc", "rhzqya", "riaxcmmqsune", "ribmumc",	/* 13336 */
+	"ricakwoqcxmhqx", "ridbsx", "ridi", "rieuezhbbh",	/* 13340 */
+	"rig", "rigxvpjmqyk", "rigyziezbo", "rihl",	/* 13344 */
+	"rikrsqok", "rilepb", "rimlyjzex", "rimmug",	/* 13348 */
+	"rimnccmih", "rimyu", "rinfhymlexaprj", "ripefjnkqmqwi",	/* 13352 */
+	"riqcsmwksx", "risaftdaeci", "risbggjw", "risnga",	/* 13356 */
+	"ritkmbzs", "riugcno", "riujmnm", "rivjvnzrsrdzj",	/* 13360 */
+	"rivxulrakv", "riyqii", "riz", "rjaf",	/* 13364 */
+	"rjbm", "rjci", "rjcqjgwoa", "rjcwtolir",	/* 13368 */
+	"rjfacmgfycp", "rjg", "rjlebdmnqfa", "rjlo",	/* 13372 */
+	"rjlygygnxuyw", "rjnzzkji", "rjoajhkvx", "rjpcytmdyxv",	/* 13376 */
+	"rjqybeppt", "rjrdwkduyytoz", "rjriwpkdgukbaa", "rjsmpgoerzhuno",	/* 13380 */
+	"rjsxjxzlmcai", "rjtwgdbgzqfi", "rju", "rjuf",	/* 13384 */
+	"rjxbb", "rjxefwrearajcv", "rjxfntejv", "rjyayjefqjv",	/* 13388 */
+	"rjygcelpf", "rjyiqwfyhonwmy", "rjzdxj", "rjzojrjls",	/* 13392 */
+	"rjzpz", "rk", "rkacp", "rkafdfflajwts",	/* 13396 */
+	"rkaza", "rkbhylgb", "rkbxmabu", "rkces",	/* 13400 */
+	"rkcmfolqrxblky", "rkcxbdgtm", "rkdiqjv", "rkfblo",	/* 13404 */
+	"rkfggpid", "rkgynlbtncvx", "rkidpb", "rkkb",	/* 13408 */
+	"rkkl", "rklirjv", "rknrg", "rknxf",	/* 13412 */
+	"rkokpc", "rkorbjtsktc", "rkow", "rkr",	/* 13416 */
+	"rkrn", "rkrqz", "rkvhvyscrkss", "rkvkryggwobe",	/* 13420 */
+	"rkvvigqtim", "rkwjsa", "rkx", "rkxdujjaehhg",	/* 13424 */
+	"rkxzmwyxbsvovw", "rkyfzr", "rkzqpktd", "rl",	/* 13428 */
+	"rlavioo", "rlaxjlhmiatk", "rlc", "rldu",	/* 13432 */
+	"rleff", "rlgfiyfdgmrnj", "rlhjcyyfol", "rljhvlrrdoba",	/* 13436 */
+	"rll", "rlljomsjsfuwd", "rllmufhuzgsl", "rlmurnqeowpz",	/* 13440 */
+	"rlnmeww", "rlnnwxxns", "rlopgditqvefaa", "rlpwgrvu",	/* 13444 */
+	"rlpyjs", "rlqscmpemdupgb", "rlrahlcds", "rlrazibgdovf",	/* 13448 */
+	"rlsorzywht", "rltfqmcg", "rltgzfdbirchz", "rltldxklfb",	/* 13452 */
+	"rlvyben", "rlwgd", "rlxdekxmjep", "rlxtbru",	/* 13456 */
+	"rlzaogy", "rm", "rmapfdeet", "rmbhdqr",	/* 13460 */
+	"rmcfyd", "rmcxngyuh", "rmczlzy", "rmdladqggdptln",	/* 13464 */
+	"rmdvzqbv", "rmesusfwqrshqb", "rmeybalbuykgb", "rmfagvq",	/* 13468 */
+	"rmgmiono", "rmh", "rmhbnsfc", "rmhkeplq",	/* 13472 */
+	"rmhwrob", "rmiewtovir", "rmimfxnqe", "rmjhlrrz",	/* 13476 */
+	"rmkeereqqs", "rmlarunonmlrl", "rmlbrbopt", "rmltppkfztym",	/* 13480 */
+	"rmlunumwozsx", "rmmj", "rmmrsycp", "rmritqtpckk",	/* 13484 */
+	"rmrmtssude", "rmrnywwyupx", "rmsudhf", "rmtfwuvdm",	/* 13488 */
+	"rmwrwjcbltscfm", "rmxbedk", "rmzflbi", "rn",	/* 13492 */
+	"rncvamyl", "rnfilsc", "rngpvf", "rnjwnxpg",	/* 13496 */
+	"rnl", "rnltkjyhiewhr", "rnmhahiqw", "rnmkledofqiwbh",	/* 13500 */
+	"rnnh", "rnnjnd", "rnovrcvsue", "rnp",	/* 13504 */
+	"rnrcwrniv", "rnrzclem", "rnsrogo", "rnsrrbtq",	/* 13508 */
+	"rntnwxda", "rnvb", "rnvke", "rnxhrofszc",	/* 13512 */
+	"rnxsczgwmks", "rnydeabmzcg", "rnyszdpepk", "ro",	/* 13516 */
+	"roahckqthj", "roaijxjp", "roc", "rodfxwyfywr",	/* 13520 */
+	"rof", "rogeiq", "rohixqe", "rohkexkuso",	/* 13524 */
+	"roidnxpnttpyq", "rojkjosynpiew", "rojqqscekyj", "rokeitsbr",	/* 13528 */
+	"rokgofadnhpbn", "rolgbcxdd", "rolrkvdlbwtk", "romnq",	/* 13532 */
+	"ron", "roodmeksre", "ropcaeunymedz", "rorbrwszaiqd",	/* 13536 */
+	"rosxsjo", "rotgtbrqpe", "rougpxdtqc", "rovblxcki",	/* 13540 */
+	"rowbipwycwpd", "rowigw", "rowkhm", "rowzoasudv",	/* 13544 */
+	"roybcntagquxl", "royi", "rp", "rpasikvsuulxha",	/* 13548 */
+	"rpbg", "rpbgnvf", "rpbhbop", "rpdannppta",	/* 13552 */
+	"rpeli", "rpfybxx", "rpgtgxi", "rpidjzyjzubf",	/* 13556 */
+	"rpj", "rplla", "rplr", "rpphsxobfyj",	/* 13560 */
+	"rppp", "rpqhojy", "rpqlmk", "rprkvtsxwyw",	/* 13564 */
+	"rprt", "rprtsx", "rps", "rpsgqvhlizfh",	/* 13568 */
+	"rpsidvgacs", "rpt", "rptsmvihadi", "rpuoq",	/* 13572 */
+	"rpxrjc", "rpxtyhnhp", "rpybyr", "rpygs",	/* 13576 */
+	"rpzzicbc", "rq", "rqbaevkzbw", "rqcuvgmgvzz",	/* 13580 */
+	"rqdedrptu", "rqdindxzks", "rqdzf", "rqene",	/* 13584 */
+	"rqfbwgg", "rqfqn", "rqifxocd", "rqifyipaqq",	/* 13588 */
+	"rqioo", "rqjtxqlox", "rqkfixmiza", "rqkpgoi",	/* 13592 */
+	"rql", "rqlkk", "rqlzrzbon", "rqmpffzvzshnm",	/* 13596 */
+	"rqnk", "rqnzmvjyrpeu", "rqoxhighckdnvm", "rqoy",	/* 13600 */
+	"rqsal", "rqssudgbku", "rqsts", "rqsuvoevag",	/* 13604 */
+	"rqt", "rqvnkulga", "rqwakbtywykk", "rqwtqdl",	/* 13608 */
+	"rqwwpnygpqtxwf", "rqx", "rqynyesuwnhboc", "rqyvdnthbjsgfp",	/* 13612 */
+	"rqyxvyr", "rr", "rracuavb", "rrdjligxrmbzc",	/* 13616 */
+	"rrekodifnwlad", "rrfdqa", "rrfhygnzpev", "rrfwbl",	/* 13620 */
+	"rrgnihrnv", "rrgo", "rrgozbhua", "rrgstogebwsq",	/* 13624 */
+	"rrikpwhqma", "rrir", "rrixworkqjpi", "rrjokzmfvmxwx",	/* 13628 */
+	"rrkolprunk", "rrl", "rrm", "rrmgqixullt",	/* 13632 */
+	"rroanxipr", "rroprnxfzbip", "rrorj", "rrpfberja",	/* 13636 */
+	"rrpivqysxn", "rrqg", "rrqypexijdyo", "rrsg",	/* 13640 */
+	"rruqbjkmvc", "rrwodmukldr", "rryohejsgtmels", "rrzxqvs",	/* 13644 */
+	"rs", "rsabltmtneei", "rsbmlpqlkrct", "rsbydsj",	/* 13648 */
+	"rscmveib", "rsexnn", "rsf", "rsfncue",	/* 13652 */
+	"rsgtgiq", "rsgzbuida", "rsh", "rskirpivc",	/* 13656 */
+	"rskoqvkkfgra", "rskotwfagsmmu", "rskpec", "rslppzsqt",	/* 13660 */
+	"rslqevdlqvyy", "rslvjwfou", "rsmnswpwxpzvm", "rsnjqiocbdri",	/* 13664 */
+	"rsoj", "rspghy", "rspkhmnnlvncau", "rsqjrch",	/* 13668 */
+	"rsqqoydefzt", "rsrcwdmdimbcrl", "rsrifk", "rsscnbecxm",	/* 13672 */
+	"rssefmdejg", "rsudlbphlgdmm", "rsvncuvr", "rswkacyewrzpf",	/* 13676 */
+	"rswpiznr", "rswr", "rswrhersdznxnl", "rt",	/* 13680 */
+	"rtaagwkgppx", "rtaeccawducy", "rtakjbvmxbjf", "rtbdtvmp",	/* 13684 */
+	"rtbeyudak", "rtbxoschedjo", "rtczirsg", "rtdjzezpvy",	/* 13688 */
+	"rteyqaaqmu", "rtfttdao", "rtggcuoexcdx", "rtgzq",	/* 13692 */
+	"rthvhgkrung", "rtidentegojd", "rtipzfwculhay", "rtjechzvphore",	/* 13696 */
+	"rtk", "rtlbhrvrea", "rtleezhc", "rtlzaazoxpngf",	/* 13700 */
+	"rtn", "rtnpyhott", "rtonxoqtpzqze", "rtoqrjunkvgpb",	/* 13704 */
+	"rtorlbifg", "rtpgidsh", "rtq", "rtqb",	/* 13708 */
+	"rtrznosqpf", "rtsrjwqryqsl", "rtsuioihurmkos", "rttdm",	/* 13712 */
+	"rtte", "rttewaoz", "rttpumnkpqnflv", "rtvfmcmz",	/* 13716 */
+	"rtyfil", "rtyloofzfuo", "ru", "ruafqrmcy",	/* 13720 */
+	"rubk", "rubodsprjgrx", "ruedmb", "ruffxncodapyul",	/* 13724 */
+	"rufk", "rufxarfyg", "rugzydyh", "ruhenwxgwlphbh",	/* 13728 */
+	"ruhlfgebeiqq", "ruhoxqce", "ruhpzygaindob", "ruirjvxncbc",	/* 13732 */
+	"rukalklhafxq", "rukotnt", "rula", "runzmyjsfkthv",	/* 13736 */
+	"ruo", "rurkcro", "rurxqlcoz", "rusmoryj",	/* 13740 */
+	"rutbrtqe", "ruuf", "ruvlivbl", "ruvymytmpw",	/* 13744 */
+	"ruw", "ruwqogqcbw", "ruyakazckmbklz", "ruzqwanvtmjwi",	/* 13748 */
+	"rv", "rvbior", "rvbiz", "rvbkxcod",	/* 13752 */
+	"rvc", "rvccaifixmjplv", "rvdg", "rvdgsviys",	/* 13756 */
+	"rvdlda", "rvej", "rvgzkyxri", "rvmsmhmao",	/* 13760 */
+	"rvmzh", "rvnvxdivifpzz", "rvqvuayeeg", "rvsaweztfqzig",	/* 13764 */
+	"rvtwbxbeskl", "rvtwlvl", "rvu", "rvuwfizdl",	/* 13768 */
+	"rvxixec", "rvy", "rw", "rwbbrnxqo",	/* 13772 */
+	"rwc", "rwcyemrhdg", "rwekcdw", "rwflpxauxl",	/* 13776 */
+	"rwguqa", "rwhkxdghjs", "rwi", "rwihjonikklsmv",	/* 13780 */
+	"rwixk", "rwj", "rwjiovx", "rwkmbl",	/* 13784 */
+	"rwlgqvfzf", "rwlqdgksnsy", "rwlqegz", "rwm",	/* 13788 */
+	"rwpapzhfjocot", "rwpci", "rwpg", "rwroyhwykpn",	/* 13792 */
+	"rwsoteywk", "rwtbguuui", "rwulowuhptkwa", "rwvhhp",	/* 13796 */
+	"rwxjocyfigxirw", "rwyitr", "rwz", "rx",	/* 13800 */
+	"rxcomq", "rxcunpx", "rxd", "rxfbl",	/* 13804 */
+	"rxfz", "rxhkdzlkshl", "rxidrwxo", "rxkplnrccfhjl",	/* 13808 */
+	"rxlcezmklvn", "rxmkitrsebcsj", "rxmmouu", "rxngrjglwighvx",	/* 13812 */
+	"rxpf", "rxqelhmjzgkhol", "rxqgjtaxihq", "rxrenlqj",	/* 13816 */
+	"rxrvktqxqsez", "rxs", "rxswuhiyibz", "rxumreahbnjyd",	/* 13820 */
+	"rxvbruwoma", "rxw", "rxwbusojcupge", "rxwgvu",	/* 13824 */
+	"rxykeizr", "rxzwtxq", "ry", "rya",	/* 13828 */
+	"ryakvnc", "ryaptckfp", "ryauywdp", "rybjjz",	/* 13832 */
+	"ryblpqhasr", "ryceke", "ryeizabbyh", "ryeyogwmk",	/* 13836 */
+	"ryeyvhyitbtpe", "ryftxiybdbvzee", "ryfwns", "rygkmfigez",	/* 13840 */
+	"ryheehkty", "ryigews", "ryihhakzxrfox", "ryilicoz",	/* 13844 */
+	"ryizfntjl", "ryjalyvtenurbw", "ryjkp", "ryjxdidtgq",	/* 13848 */
+	"ryninxhqrj", "rynpibwh", "rypvmovcxbbc", "rypxcwnyxkh",	/* 13852 */
+	"ryrl", "ryssnm", "rywawo", "rywzff",	/* 13856 */
+	"ryxccjyh", "rz", "rzb", "rzbeyq",	/* 13860 */
+	"rzcbcfgeode", "rzddxw", "rzdi", "rzemhhi",	/* 13864 */
+	"rzfavffmsve", "rzhbo", "rzijbqqtgyuna", "rzkkxm",	/* 13868 */
+	"rzksprkavlndst", "rzlucqnbjeqxh", "rzmcv", "rznofgpzneneqy",	/* 13872 */
+	"rznw", "rzogyawimg", "rzoqvdra", "rzpwiagfol",	/* 13876 */
+	"rzqzlkhghhhogg", "rzrnibqz", "rzrohsucajbzu", "rztbs",	/* 13880 */
+	"rztfhkuyu", "rztrsgqcra", "rztuswu", "rzudheukf",	/* 13884 */
+	"rzupgpyll", "rzvneb", "rzwbmf", "rzxaqjg",	/* 13888 */
+	"sa", "saacsug", "sabszel", "sabwxinuc",	/* 13892 */
+	"sad", "saeaedklxjmfzy", "safboxitw", "safjjxfcei",	/* 13896 */
+	"safr", "sagvsozz", "sah", "sahwakg",	/* 13900 */
+	"salal", "sanroyaztqm", "saoacmdijys", "saorspgx",	/* 13904 */
+	"sapd", "saqqifealm", "sarftjdtuitsg", "sasfkcl",	/* 13908 */
+	"satflwznqtkmdb", "satqrq", "satyhd", "satzyjmk",	/* 13912 */
+	"sau", "saugkyziakhguj", "saumsfogvtaxna", "savmewpq",	/* 13916 */
+	"sawhhxinipncba", "sawz", "saxifwbbpmcg", "saxyg",	/* 13920 */
+	"sayxg", "sb", "sba", "sbalutdt",	/* 13924 */
+	"sbavixy", "sbawilczts", "sbcexx", "sbcivudiov",	/* 13928 */
+	"sbeiekduixw", "sbeusxbrukjz", "sbfwjrhs", "sbhsayzbvrp",	/* 13932 */
+	"sbiqzpyzvh", "sbktpbwzuahib", "sblanyxgtj", "sbllzxmsyqzbg",	/* 13936 */
+	"sblmszlr", "sbmkdtqth", "sbmqegw", "sbn",	/* 13940 */
+	"sbogoqjnvymj", "sbrjaw", "sbrkqymioisicd", "sbtc",	/* 13944 */
+	"sbttzbubdxcqf", "sbvmcm", "sbwsatf", "sby",	/* 13948 */
+	"sbyqguxtsvbc", "sbzewojsepw", "sbzofctev", "sc",	/* 13952 */
+	"sca", "scaxvom", "scb", "scbpcyalce",	/* 13956 */
+	"sce", "scetluzomnrbfe", "scfmzcpv", "schd",	/* 13960 */
+	"schhdhcxjql", "schrhw", "schzpa", "scjdto",	/* 13964 */
+	"sclrdwzevlabxg", "scltmgt", "scmfeqd", "scmwezjk",	/* 13968 */
+	"scnp", "sco", "scohrzpce", "scpye",	/* 13972 */
+	"scqdtjlfihfygf", "scqzpmxon", "scrzbvdz", "scsjbxxmnw",	/* 13976 */
+	"scuaspktojvzoy", "scup", "scvgelekbndr", "scvjjwufyvuj",	/* 13980 */
+	"scvspudppr", "scwdpdysestulu", "scyotaz", "scznilwiyd",	/* 13984 */
+	"sczyxymyxsb", "sd", "sdatowztczbgu", "sdbataa",	/* 13988 */
+	"sdbbqxcpb", "sdctsfsu", "sddfvymunwrdf", "sddtn",	/* 13992 */
+	"sde", "sdgikkszhdzb", "sdhsq", "sdirdhx",	/* 13996 */
+	"sdjup", "sdo", "sdodpstcux", "sdqholzzyhoxwo",	/* 14000 */
+	"sdqqwtgh", "sdrgbrcoc", "sdsknqsihvug", "sdsynwqm",	/* 14004 */
+	"sdtjezrkvxd", "sdupfqujyitt", "sdvboy", "sdwggblfbgplyb",	/* 14008 */
+	"sdwxyltev", "sdxlxwswle", "sdydul", "sdzlmltlqxfti",	/* 14012 */
+	"sdzzwwe", "se", "sea", "sebcbfpknxbodx",	/* 14016 */
+	"secihzweaamzjh", "secjaaqwke", "sedfy", "seepfu",	/* 14020 */
+	"sehkcypjdmnh", "sehunrwt", "seiud", "sejj",	/* 14024 */
+	"sejsicvjb", "sejtnaaj", "sejuetffgpnjtt", "seks",	/* 14028 */
+	"sekz", "semkesn", "semtq", "semvfylkeerwpu",	/* 14032 */
+	"semw", "sennshjnamktv", "senuimxntljtp", "seofi",	/* 14036 */
+	"sepnkiyphezx", "sepsjefduta", "setbmygb", "setck",	/* 14040 */
+	"seuyo", "sevppnywir", "sevwasangz", "seycclsuzqlpoz",	/* 14044 */
+	"seyeothh", "seyrptdr", "sf", "sfatfbolvkff",	/* 14048 */
+	"sfaxokr", "sfazuk", "sfbii", "sfbux",	/* 14052 */
+	"sfbybltofvxo", "sfcqvqiyoj", "sfd", "sfdetkbevtcp",	/* 14056 */
+	"sfe", "sfebgcff", "sfewyoffk", "sfeyxud",	/* 14060 */
+	"sfg", "sfgqtrmkfe", "sfhhqufmdu", "sfix",	/* 14064 */
+	"sfizgnovom", "sflkwhzh", "sflntwruqblrnr", "sfmrchqjb",	/* 14068 */
+	"sfngdcekewr", "sfnpkjsqeli", "sfnrkoztcvk", "sfpm",	/* 14072 */
+	"sfswffnvw", "sfvpko", "sfwekgep", "sfzekzr",	/* 14076 */
+	"sg", "sgai", "sgayrachxdlm", "sgcgbhlismcxi",	/* 14080 */
+	"sgefgu", "sgeskembq", "sgiko", "sgil",	/* 14084 */
+	"sgip", "sgjtvvio", "sgk", "sglzqbazy",	/* 14088 */
+	"sgmibghb", "sgnf", "sgnlvwouw", "sgnvkfiaktk",	/* 14092 */
+	"sgojzcpgxkuvf", "sgokldqew", "sgqfsk", "sgralrklsif",	/* 14096 */
+	"sgrkyczyugdns", "sgsbdulhn", "sgseouw", "sgtpdird",	/* 14100 */
+	"sgvbqxnqljyar", "sgvclnlxpmqgi", "sgvonmjt", "sgvovsmw",	/* 14104 */
+	"sgxbwbeph", "sgxmqaij", "sh", "shablsoiyilt",	/* 14108 */
+	"shadahf", "shbcdbba", "shbkzizciy", "shcaknye",	/* 14112 */
+	"shclsgpalqt", "shegqsmi", "sheknouoodv", "shfqngc",	/* 14116 */
+	"shgdqkv", "shhecu", "shhnwioendsdo", "shhyubkpt",	/* 14120 */
+	"shkhfymqcufo", "shkwi", "shkxjdizje", "shnqflj",	/* 14124 */
+	"shqhcjsromdlg", "shrrpnuguljib", "shun", "shupcmlvleym",	/* 14128 */
+	"shvcaklh", "shxgqqmdwgmv", "shxuzuuukn", "shy",	/* 14132 */
+	"shybp", "shydbmpi", "shyojzreb", "shzjjveaw",	/* 14136 */
+	"shzkvvlzxtfsr", "shzquhjukxge", "shzsfuh", "si",	/* 14140 */
+	"siafsvi", "siallojxehmd", "sicsxmowhdg", "siee",	/* 14144 */
+	"sifiie", "sigzlnr", "sihdynxl", "sikgcoub",	/* 14148 */
+	"siknigxzcmlsfx", "sikwayb", "silbvuejoey", "sily",	/* 14152 */
+	"sin", "sipafpdhedmbfc", "sipmrxy", "siqfc",	/* 14156 */
+	"siqj", "sishaptuprl", "sivpzvgf", "sj",	/* 14160 */
+	"sjbowqgg", "sjefykkqhjlvgy", "sjeroqwexhbjp", "sjltrt",	/* 14164 */
+	"sjmadbk", "sjnuy", "sjo", "sjpjifjizk",	/* 14168 */
+	"sjpnmmulugta", "sjqalkcqbvsfmp", "sjqyuphxgnmlb", "sjtivfkel",	/* 14172 */
+	"sjtrhmmynrs", "sjvkpcixldnj", "sjvnxdleqlt", "sjvoeqlobhrpy",	/* 14176 */
+	"sjwp", "sjwqqi", "sjxujrcegd", "sjzjpqkqutndb",	/* 14180 */
+	"ska", "skebeyw", "skes", "skf",	/* 14184 */
+	"skfd", "skfpocemy", "skfu", "skfyxxmt",	/* 14188 */
+	"skhsvtxqb", "skhyhvuvf", "skjqzltupmjja", "skjrujoeyu",	/* 14192 */
+	"skjuvk", "skkpxump", "sklhvbkyuzj", "skmm",	/* 14196 */
+	"skmmg", "sknqttu", "skphogix", "skpq",	/* 14200 */
+	"skr", "skvyxzepl", "skz", "skzeomtfrzxlu",	/* 14204 */
+	"skzhmnp", "skzjyavdswzu", "sl", "slc",	/* 14208 */
+	"slcjgrladwabq", "slcwkwvyv", "sletxtaytowzw", "slfvrp",	/* 14212 */
+	"slfznunjiht", "slgclhpvpdsran", "slgwuzizxfnl", "sljpbbjanugjc",	/* 14216 */
+	"slllvcnckfcjj", "slmbakdvbufli", "slmhlz", "slmzvuoi",	/* 14220 */
+	"slnwlgyigvos", "slodfg", "slosskaxg", "slovpdc",	/* 14224 */
+	"slpbpn", "slpxlnylcsi", "slrc", "slrditzj",	/* 14228 */
+	"slrmacdoi", "slryxsby", "sls", "slsnv",	/* 14232 */
+	"slu", "slvyxtswg", "slwiqiv", "slwqxkbobs",	/* 14236 */
+	"slym", "slzbneboyqyw", "sm", "smamxoztktjkd",	/* 14240 */
+	"smcgpnjv", "smcr", "smcy", "smdj",	/* 14244 */
+	"smdvmbaehq", "smeix", "smetgqaqb", "smftchpa",	/* 14248 */
+	"smjkii", "smjtbn", "smkaztshxskuzq", "smknecqligx",	/* 14252 */
+	"smlih", "smmfrewzxs", "smncsxaj", "smneitnnelkk",	/* 14256 */
+	"smnmxkto", "smoryc", "smqhmkqew", "smqxrgrdbt",	/* 14260 */
+	"smrpezlsv", "smsfstdcb", "smsza", "smufsdjd",	/* 14264 */
+	"smvjfzrmxrjr", "smvmdpgiolfm", "smvprthibufvvr", "smwcmfvkx",	/* 14268 */
+	"smwznldtnlae", "smxbbehmgiy", "smxoempbv", "smxtk",	/* 14272 */
+	"smzzfrlfbocfv", "sn", "snbh", "snfevc",	/* 14276 */
+	"snghu", "snic", "snjgud", "snkedjjiha",	/* 14280 */
+	"snlgllkde", "snlswukqeyyu", "snmic", "snnossqgtwfv",	/* 14284 */
+	"snotsakvilk", "snozg", "snt", "snthvrafw",	/* 14288 */
+	"sntowsottu", "snvz", "snwk", "snwrbjpf",	/* 14292 */
+	"snwurqumcrgg", "snxjfiiitfezf", "sny", "snyidqbkdqtzou",	/* 14296 */
+	"soaeei", "sob", "sodc", "sodkfr",	/* 14300 */
+	"sodusfqh", "soeekmoitosz", "sofct", "sofeacsffx",	/* 14304 */
+	"sogiqiyqog", "sohbwrsywjpo", "sohdy", "sojfehzwb",	/* 14308 */
+	"sokqqyncd", "soktxrxtwmmlha", "soljnc", "solm",	/* 14312 */
+	"solph", "sopdz", "sopgqyyckofwr", "sophkghxlq",	/* 14316 */
+	"sopmlvkkqd", "soqcckhxgbw", "sotcqyhyvmahc", "sotpbpiyfgg",	/* 14320 */
+	"sotyelqgxnjyf", "soubfnmzvjq", "soufh", "soulyx",	/* 14324 */
+	"souv", "souw", "sovmnoop", "soxgt",	/* 14328 */
+	"soxnvdfbcsr", "soxrkwiyytlqop", "soxsbpjg", "soyikddlnx",	/* 14332 */
+	"soyvqo", "sozlctmbn", "sozuwdwm", "sp",	/* 14336 */
+	"spablbew", "spbp", "spcseumbhf", "spdtiqpyg",	/* 14340 */
+	"spdyelxxzovhx", "spgcjlhgd", "spi", "spiirqovszun",	/* 14344 */
+	"spkcbmywr", "spkuonmatxw", "splvtyj", "spmgzuolqshi",	/* 14348 */
+	"spnhdsnfkqk", "spokvpzo", "spoykg", "spq",	/* 14352 */
+	"spqfldnex", "sprwztjirfbk", "sptgsqvckzu", "sptndbkreso",	/* 14356 */
+	"sptnwpa", "spusf", "spuy", "spv",	/* 14360 */
+	"spvprnwowgyf", "spvxhegbqkzhmo", "spwkoql", "spwruidqxjaj",	/* 14364 */
+	"spwya", "spxjsztixvbymr", "spyodvwzprkbgo", "spyv",	/* 14368 */
+	"sq", "sqbmynsqmsq", "sqdlddo", "sqdytdmklcyuef",	/* 14372 */
+	"sqe", "sqeno", "sqftlvrbznojfa", "sqgcqrxon",	/* 14376 */
+	"sqgcvgtuiamp", "sqhc", "sqirgetucfebxb", "sqjakeevev",	/* 14380 */
+	"sqjakt", "sqkckmmrwqp", "sqkcy", "sqlprxwzu",	/* 14384 */
+	"sqlvli", "sqm", "sqmbogolzu", "sqmceiafdyhmwp",	/* 14388 */
+	"sqn", "sqoqhsufwd", "sqphrkq", "sqqugei",	/* 14392 */
+	"sqqxbdhrh", "sqrgbssqkjcr", "sqtiuk", "squdt",	/* 14396 */
+	"squmtd", "squrvp", "sqvdvo", "sqweb",	/* 14400 */
+	"sqxjty", "sqxn", "sqxuodpavtzq", "sqyirxwwvgcqi",	/* 14404 */
+	"sr", "srbgo", "srbvs", "srdu",	/* 14408 */
+	"srdxkehc", "srdzzhzby", "sregmmj", "srfaxr",	/* 14412 */
+	"srhdpdoqrfd", "srktdxoxfq", "srmnz", "srnfnamlvkg",	/* 14416 */
+	"sro", "srp", "srpawnzzllsaym", "srpcd",	/* 14420 */
+	"srpqu", "srqhfqbmi", "srqwopowlud", "srreicgvywkyal",	/* 14424 */
+	"srsbruazgt", "srsvolfpoljva", "sryd", "ss",	/* 14428 */
+	"ssajprdi", "ssajrp", "ssbmohjqzxvw", "ssd",	/* 14432 */
+	"ssdxyedoh", "sseiadfc", "ssfkqv", "sshasjm",	/* 14436 */
+	"ssirpwk", "ssjbypov", "ssjkbvdwttitji", "sskhzqazpax",	/* 14440 */
+	"ssmuffqhayg", "sso", "ssqwmeylaoz", "sssfojbetx",	/* 14444 */
+	"sstmjtnpktnzq", "ssuncuwzzeh", "ssvsspylls", "ssvyitty",	/* 14448 */
+	"sswkxyxqbvkyr", "sswuek", "ssxdhemjipxktn", "ssxjx",	/* 14452 */
+	"ssyaclqkxtbje", "ssyvnj", "st", "stahaefothg",	/* 14456 */
+	"stao", "stb", "stcrqmgrsrw", "ste",	/* 14460 */
+	"sterdk", "stfm", "stgbbekhkjgsp", "sth",	/* 14464 */
+	"stheq", "sthkwxaczyztan", "stiaqd", "stk",	/* 14468 */
+	"stkokghzexl", "stlbnpkjfgplg", "stnklezy", "stnpivlbttjd",	/* 14472 */
+	"stouc", "stpaj", "stprfgvwg", "stpwuxyqb",	/* 14476 */
+	"strh", "stthcroyiq", "stvhnjgvfxmb", "stw",	/* 14480 */
+	"stwvtpfmcsgy", "stwxujtlkt", "stxdodtwjb", "stxqakxjxoui",	/* 14484 */
+	"su", "suark", "suarwxjvufz", "subdl",	/* 14488 */
+	"sudkydfejwv", "suevxuydmolva", "suewdupgad", "suf",	/* 14492 */
+	"sufm", "sugi", "suiefakcxpuutp", "sujzmzalqgksy",	/* 14496 */
+	"sukcdxymfrszf", "suljulvxkfju", "sultgp", "sumxrpnfduxvb",	/* 14500 */
+	"sunno", "suoghycuj", "suqmzarmqtr", "sursyq",	/* 14504 */
+	"surusfljlr", "susmawhqmdrin", "suspjvidruiffq", "suurndbwpqiao",	/* 14508 */
+	"suvunjqhqnnpz", "suwiiebfeqnxbr", "sux", "suynksaoaocons",	/* 14512 */
+	"suzzfzpi", "svdlkqpiv", "svdyeoujwabj", "svfkqcuzybazsj",	/* 14516 */
+	"svgzki", "svh", "svhk", "svhtwnwdplkf",	/* 14520 */
+	"svjtkzscpknci", "svmfauksso", "svmovh", "svnt",	/* 14524 */
+	"svp", "svrirblxkbm", "svrtitvenzz", "svu",	/* 14528 */
+	"svutyqiqkasyzg", "svvltmrqz", "svvyhzxa", "svxammhiapo",	/* 14532 */
+	"svxjryehfhm", "svyjgt", "svytpjxegmd", "sw",	/* 14536 */
+	"swaz", "swbhvqfujrpgo", "swbqgttb", "swetu",	/* 14540 */
+	"swfne", "swgmoepwhbxuh", "swgqktkb", "swgucbsgjewkc",	/* 14544 */
+	"swhpsr", "swif", "swil", "swjkfaae",	/* 14548 */
+	"swlaqyaphxowst", "swlr", "swoefghykxbnlw", "sworebqkqweuy",	/* 14552 */
+	"swosns", "swtcxabgaw", "swtqco", "swvu",	/* 14556 */
+	"swwtsrmmeg", "swwwyd", "swxtar", "swzesjbucyjcn",	/* 14560 */
+	"sx", "sxabazv", "sxbhxprb", "sxcb",	/* 14564 */
+	"sxcduazkbyc", "sxcijy", "sxdkqjp", "sxeukkof",	/* 14568 */
+	"sxfhvaqqoabo", "sxfqsrbq", "sxghyex", "sxgooexobfpymm",	/* 14572 */
+	"sxgv", "sxhbsxjgo", "sxhkhurnvo", "sxiz",	/* 14576 */
+	"sxjnjicng", "sxkole", "sxmelftyhqu", "sxnfjyyilmmwd",	/* 14580 */
+	"sxnkwerixkp", "sxoqnhrzix", "sxrxjztofuzax", "sxs",	/* 14584 */
+	"sxshrg", "sxsiwfgtphokgd", "sxtwfc", "sxvlwpnqiptj",	/* 14588 */
+	"sxxk", "sxxm", "sxynkejksw", "sxysl",	/* 14592 */
+	"sxywyzkwx", "sxzmzfbinzc", "sxzwgbflxadts", "sy",	/* 14596 */
+	"sydragglm", "syegm", "syetzyobskoh", "syfwqtvmu",	/* 14600 */
+	"sygdicyuujf", "syhcl", "syiyjwwr", "syiyoqmclk",	/* 14604 */
+	"syjwpdm", "sylrsfx", "symhfsbo", "symn",	/* 14608 */
+	"symtzurlmuzyt", "synswih", "sypalrmocar", "syqgyukgqdq",	/* 14612 */
+	"syriufhjjhkxik", "sytvifxqgcf", "syveslguilskl", "syvf",	/* 14616 */
+	"syvprd", "sywfmltrzy", "sywzebv", "syybfdg",	/* 14620 */
+	"sz", "szardwmqhdhx", "szdwzsiuqigjx", "sze",	/* 14624 */
+	"szf", "szhuwkunaqidg", "szke", "szkfwnwub",	/* 14628 */
+	"szkujoz", "szkw", "sznwdrbqfwu", "szoesokpw",	/* 14632 */
+	"szokpwmrgf", "sztukmm", "szuefwdeoafamc", "szunkqtfeerms",	/* 14636 */
+	"szuv", "szviya", "szx", "szyc",	/* 14640 */
+	"szzgx", "ta", "tadsnn", "tae",	/* 14644 */
+	"tagasfc", "taglprtt", "tahnxh", "taiixxub",	/* 14648 */
+	"takkqhw", "taksbhuu", "takvzp", "taly",	/* 14652 */
+	"tanzg", "taomm", "tapdg", "tapxs",	/* 14656 */
+	"taqdarukxbnt", "tasozabaezjsgh", "tatifitugobdaw", "tatteocpsx",	/* 14660 */
+	"tauhfoufbtbag", "tavgp", "tawt", "tawwctvhaotdb",	/* 14664 */
+	"taxswezt", "tayapfnrwyx", "tayhjvk", "tayuwpimqa",	/* 14668 */
+	"tazhufrsf", "tazlhaxvhhm", "tazvcdvfq", "tb",	/* 14672 */
+	"tbbqsdlbu", "tbcacio", "tbcfkjjedqf", "tbcjafvdltypmc",	/* 14676 */
+	"tbckecoiiqzix", "tbdmsmvzm", "tbe", "tbffhrl",	/* 14680 */
+	"tbgnddlpjnf", "tbgr", "tbihbnkpnqik", "tblnvw",	/* 14684 */
+	"tblqrayyhckcc", "tblrpmqksqj", "tblsoeuah", "tbnrnhkx",	/* 14688 */
+	"tbobl", "tbpgvtlorpgis", "tbpstduzymcgj", "tbrqnirwxrjba",	/* 14692 */
+	"tbrwdpxxjrfaa", "tbshieirbldkd", "tbuioso", "tbuokoz",	/* 14696 */
+	"tbvhddhupat", "tbvmifoiz", "tbvpd", "tbxgbmkiqkgn",	/* 14700 */
+	"tbydfeqsoysbro", "tbykzxnll", "tbzetxdvsila", "tcaa",	/* 14704 */
+	"tcajhdvco", "tcdhkxf", "tcdy", "tcee",	/* 14708 */
+	"tcfxqritz", "tcgqrophczfbyl", "tcgyawmcl", "tchdwphtxbzzi",	/* 14712 */
+	"tchhazhmcircxc", "tchwy", "tcib", "tciijdvz",	/* 14716 */
+	"tcjanboamgrtpz", "tcjbc", "tcjnchjdvpl", "tcjxeansexmjh",	/* 14720 */
+	"tclpt", "tcmqnjvoet", "tcncwreiyci", "tcnjxyaliygfe",	/* 14724 */
+	"tcoh", "tcp", "tcs", "tctq",	/* 14728 */
+	"tcu", "tcwirhwm", "tczf", "tdbbhbggz",	/* 14732 */
+	"tddcukdvsrul", "tddedmkooclgbp", "tdehr", "tdfvtuzl",	/* 14736 */
+	"tdho", "tdijmryodbnrvg", "tdiw", "tdiwaswnw",	/* 14740 */
+	"tdje", "tdjimtkdcsu", "tdl", "tdlid",	/* 14744 */
+	"tdmn", "tdnem", "tdolicadswowzv", "tdot",	/* 14748 */
+	"tdpdbjwjbnaqh", "tdpeazh", "tdpil", "tdqjpaqrherzlt",	/* 14752 */
+	"tdqpqcbcfawt", "tdqwwzmblfmfw", "tdtyimlzsil", "tdushqqlrcu",	/* 14756 */
+	"tdvaro", "tdvjekoquiulem", "tdwxdibwglzut", "tdwxreh",	/* 14760 */
+	"tdydatilj", "tdzp", "tdzqpab", "te",	/* 14764 */
+	"teabmcyjzmrjw", "tebotxrh", "tebpopjfkud", "tebwn",	/* 14768 */
+	"tecluq", "tedhumsyhj", "teg", "tehkmchkwr",	/* 14772 */
+	"teicsmfh", "tekqnga", "temggrboo", "temitkxhzzipe",	/* 14776 */
+	"temkqcbep", "temnyrcnt", "temvfxkcz", "tenc",	/* 14780 */
+	"tepadj", "tepscnfsadkn", "tepzjzxcxiwj", "teqarqbttlnt",	/* 14784 */
+	"teqefqvxrtlggu", "teqzvxbperme", "terddag", "terrhnwiwqlp",	/* 14788 */
+	"tesiaqoor", "tetrxck", "tewbse", "tewgwvzbdurtrl",	/* 14792 */
+	"tewwy", "text", "teybvu", "teyiawpv",	/* 14796 */
+	"teypwrinkw", "tf", "tfaxsvv", "tfeva",	/* 14800 */
+	"tffsr", "tfh", "tfhi", "tfhrx",	/* 14804 */
+	"tfhuwzhtmdveh", "tfhxexkfmk", "tfinmni", "tfinxpjlwo",	/* 14808 */
+	"tfmaimhjr", "tfnplwmbl", "tfnwjmmhfnfrr", "tfqnrbhofukibv",	/* 14812 */
+	"tfqrtjkkf", "tfromrykz", "tfsouus", "tfstqvs",	/* 14816 */
+	"tftmpnebq", "tftsyl", "tfuqgdhquydw", "tfvlkkgzmzkzz",	/* 14820 */
+	"tfwh", "tfwnhs", "tfxzjincrtwp", "tfyc",	/* 14824 */
+	"tfyn", "tfzor", "tg", "tga",	/* 14828 */
+	"tgahcks", "tgaluglqkdr", "tgasnjbfmyo", "tgbdgvtt",	/* 14832 */
+	"tgd", "tgdbdervllm", "tgdde", "tgdrzuqhgkw",	/* 14836 */
+	"tgdvsxzox", "tgeeqjsh", "tgggymodcdi", "tggmrdqpxv",	/* 14840 */
+	"tggmtcsahucn", "tggywlcsqw", "tghgdnp", "tghz",	/* 14844 */
+	"tgilyuxs", "tgliwwjwqxd", "tgmcgbmwi", "tgmqghr",	/* 14848 */
+	"tgnayo", "tgnligrg", "tgpccqyxfh", "tgpgxqbfodz",	/* 14852 */
+	"tgqo", "tgr", "tgsnjhnwfsvn", "tgsucfozdrf",	/* 14856 */
+	"tgtw", "tgwogqsoaiye", "tgwubqqff", "tgxdjmfqaypz",	/* 14860 */
+	"tgxfiklgeupd", "tgyipsrbxrl", "thapeasxraym", "that",	/* 14864 */
+	"thbxdluwes", "thdbo", "thdiwxqxhue", "thdmxrqls",	/* 14868 */
+	"thdpbu", "thdwrpva", "thgef", "thhcx",	/* 14872 */
+	"thhmhsd", "thixxnvfmof", "thjd", "thjk",	/* 14876 */
+	"thjx", "thjyqkfpuraabl", "thjzftm", "thktdrtvlznm",	/* 14880 */
+	"thljarmjdyszkx", "thpf", "thqc", "thqqssrdlqf",	/* 14884 */
+	"thridzo", "thrjp", "thsl", "thsmzmfrriqeg",	/* 14888 */
+	"thsotvhfv", "thuwqcd", "thv", "thxmhihqde",	/* 14892 */
+	"ti", "tic", "tidafj", "tidquq",	/* 14896 */
+	"tidsxprcor", "tie", "tiepyjyvyhcj", "tifipgem",	/* 14900 */
+	"tih", "tihwu", "tihzbjlol", "tihzvai",	/* 14904 */
+	"tiiwxhil", "tijufycqljare", "tikii", "tilw",	/* 14908 */
+	"tinp", "tinqtylt", "tiomfuyunww", "tip",	/* 14912 */
+	"tiqnwysxcnltdw", "tirzgnesn", "tiubdmdbpt", "tivcnoinpsz",	/* 14916 */
+	"tiwfrpgpl", "tixfbasggfx", "tiyo", "tizjzmfsi",	/* 14920 */
+	"tiznals", "tj", "tjat", "tjbfat",	/* 14924 */
+	"tjdkhmxahz", "tjdpob", "tjegerxbyk", "tjfciwfnaytgsu",	/* 14928 */
+	"tjhxy", "tjiiyllejlafsc", "tjjkeq", "tjkeevikaboxeb",	/* 14932 */
+	"tjkrbsdln", "tjpb", "tjpnnzcf", "tjpyq",	/* 14936 */
+	"tjpzadlsinnkn", "tjqzfylmsmjgz", "tjs", "tjtxairvggoo",	/* 14940 */
+	"tjuex", "tjvenms", "tjwjblrfplix", "tjwzzjrco",	/* 14944 */
+	"tjxflokka", "tjxokwgmfdqbe", "tjywwll", "tk",	/* 14948 */
+	"tkcubshajcpm", "tkev", "tkez", "tkhvbwgzleb",	/* 14952 */
+	"tkjmj", "tkjmyfqaid", "tkjzjs", "tkk",	/* 14956 */
+	"tkkydhtoravn", "tklcspoxnkzwb", "tklotdyipoyxf", "tklw",	/* 14960 */
+	"tkmxro", "tkohazvedobql", "tkpmg", "tkrjvpy",	/* 14964 */
+	"tksqctkxhhc", "tkstkncbjfhkaj", "tkvaahmanoov", "tkwngpvu",	/* 14968 */
+	"tkxch", "tkyutstbghl", "tkzrx", "tl",	/* 14972 */
+	"tlafcsianwto", "tlask", "tlbuu", "tlchsqdxh",	/* 14976 */
+	"tlcnjtxojis", "tldesiuxkfjscj", "tlegzgrk", "tlfldjgviunaqc",	/* 14980 */
+	"tlhdesvaqlcdok", "tlhegnjw", "tlhtgpieuxsx", "tliofhgey",	/* 14984 */
+	"tljxnzpx", "tllbcbo", "tlln", "tlmo",	/* 14988 */
+	"tln", "tlogknpznmjle", "tlolvob", "tlqoidvsmou",	/* 14992 */
+	"tlqrcqbvlsiga", "tlr", "tlsfaonvvnegal", "tlshc",	/* 14996 */
+	"tlsoqafxk", "tltmy", "tlvtscfnmedul", "tlvy",	/* 15000 */
+	"tlwgj", "tlwllq", "tlwvjegjms", "tlza",	/* 15004 */
+	"tlzlhgigfkivxk", "tm", "tmaoqitkdrd", "tmapfvpmys",	/* 15008 */
+	"tmbgdnf", "tmbhpmuzrj", "tmcwqmaezhw", "tmeesnkot",	/* 15012 */
+	"tmegqyn", "tmgvc", "tmgvte", "tmhkd",	/* 15016 */
+	"tmhmcece", "tmhmcnloovrntd", "tmibbp", "tmii",	/* 15020 */
+	"tmjycfphkl", "tmkdu", "tmkkloqjb", "tmkpmlz",	/* 15024 */
+	"tmlbzpqidrhwea", "tmlcczlb", "tmlecr", "tmlhczevglyky",	/* 15028 */
+	"tmmswcajaakqrj", "tmppxvq", "tmptmpve", "tmpzmdnpjhxu",	/* 15032 */
+	"tmqecpp", "tmqmzietjhq", "tmrkesjalap", "tmrnbr",	/* 15036 */
+	"tmrwyw", "tmrxweiqa", "tmtb", "tmux",	/* 15040 */
+	"tmvtrnybtlsiyu", "tmwgzrsy", "tmwvgoxurjn", "tmxygzf",	/* 15044 */
+	"tmyfarx", "tmzxrwbebmx", "tn", "tna",	/* 15048 */
+	"tnagttevsgqwkr", "tnbuh", "tncgkh", "tncqbhoj",	/* 15052 */
+	"tndicsvvgus", "tnegvuqbdl", "tnfh", "tngcnilorwts",	/* 15056 */
+	"tnizkhbdhasck", "tnkbrjdquwlnwb", "tnlgswamc", "tnlveoaynwxf",	/* 15060 */
+	"tnmim", "tnorc", "tnosmvqgsp", "tnqbhragjooot",	/* 15064 */
+	"tnsi", "tnsmfoij", "tntquagz", "tnudgtip",	/* 15068 */
+	"tnuxq", "tnwuoszdehjufr", "tnyasukpjaakv", "to",	/* 15072 */
+	"toaxavxss", "tocvdd", "tod", "todzgbmg",	/* 15076 */
+	"toenovqgwyhy", "tofpuqvfkhm", "toghwpogaq", "tohmvsase",	/* 15080 */
+	"tojh", "tolmunphl", "tolnyeaoos", "tolqiwcvoyeais",	/* 15084 */
+	"tom", "tomotuandqcn", "tonppclis", "tonwtkwdh",	/* 15088 */
+	"tonxtrruaog", "toobceivlgnsct", "toogc", "toomorfcjfana",	/* 15092 */
+	"toouziwhicwyx", "topfyhbsbespx", "toqarpwy", "toqqssczktu",	/* 15096 */
+	"toqtyqlxcjnplc", "torauav", "torj", "torphjiuw",	/* 15100 */
+	"tosdbfqabnzine", "tould", "tovdzwstdmez", "tovnoskzr",	/* 15104 */
+	"tovtycbryxjlw", "toxjpevlosmbm", "tozhschhmaax", "tozuroictfft",	/* 15108 */
+	"tp", "tpbh", "tpbmq", "tpcpaayrth",	/* 15112 */
+	"tpcxyhvuui", "tpe", "tphppceai", "tphwltvxczajl",	/* 15116 */
+	"tphyoffeeb", "tpjtsuf", "tpkggsanq", "tplf",	/* 15120 */
+	"tplnxpgbtvd", "tplxcmlasjrutf", "tppx", "tpthlvhnkbyyz",	/* 15124 */
+	"tptjnwtjwxas", "tpuxntevkc", "tpvubnff", "tpwbst",	/* 15128 */
+	"tpxhbvtwjx", "tpxhhkxkyeucm", "tpxvwymrtvzmqw", "tpzgxxqxzmtip",	/* 15132 */
+	"tpzhadytr", "tpzpeaayqtektm", "tpzuuuyrw", "tq",	/* 15136 */
+	"tqacecgfk", "tqahkifx", "tqazzyw", "tqbhvhsj",	/* 15140 */
+	"tqedbuexgbfn", "tqelvikes", "tqepkxwmdcj", "tqfucd",	/* 15144 */
+	"tqilrz", "tqiqlxn", "tqjlubtq", "tqjszgjvev",	/* 15148 */
+	"tqkgt", "tqkxgkio", "tqljxcxlevqb", "tqnfizac",	/* 15152 */
+	"tqoiqzkxestofd", "tqowfbmqpnsx", "tqpl", "tqqwanhptlxb",	/* 15156 */
+	"tqqwlhjutn", "tqrurovhy", "tqs", "tqsnizmrwhj",	/* 15160 */
+	"tqtyhjmwrd", "tqvxeohvvedjtj", "tqxptk", "tqyhtpw",	/* 15164 */
+	"tqymcvnwlea", "tqytivbtmvrr", "tqzteao", "tr",	/* 15168 */
+	"trbchvxwchd", "trbcs", "trbyaoptz", "trcewpviwweu",	/* 15172 */
+	"trcphnrbtlobfm", "trcq", "trcuclqombtq", "trdmvbsszinup",	/* 15176 */
+	"trffonncajse", "trfmppqinaj", "trg", "trgjshdrbkjrfx",	/* 15180 */
+	"triy", "trlz", "trm", "trnpdz",	/* 15184 */
+	"trq", "trqcfwpj", "trsiuyqmxy", "trvep",	/* 15188 */
+	"trvofpsx", "trvqlyvgjbewjv", "trxcmedhywhxvn", "tryzntwl",	/* 15192 */
+	"ts", "tsad", "tsbstcrzhxg", "tsbwcalqmm",	/* 15196 */
+	"tschv", "tsei", "tsevctfycxream", "tsfbxpnj",	/* 15200 */
+	"tsffosmxre", "tsfhmipwh", "tsfkcsysyilxuw", "tsgmuvlhocnyl",	/* 15204 */
+	"tsguro", "tsmybrtz", "tsnkaixw", "tsnwstf",	/* 15208 */
+	"tsnxfncmolktfr", "tsodtkamzj", "tspkayx", "tspvirirgkgo",	/* 15212 */
+	"tsryiwl", "tssaygri", "tstswfalxh", "tsu",	/* 15216 */
+	"tsuejj", "tsx", "tsyypzgaumrwc", "tt",	/* 15220 */
+	"ttcup", "ttduygiwo", "ttheoaww", "tthohocygeujx",	/* 15224 */
+	"tthxtevdvv", "ttinkunrfjuo", "ttmdn", "ttmq",	/* 15228 */
+	"ttmwtsmlkxdsl", "ttnfhknbc", "ttnnv", "ttnroc",	/* 15232 */
+	"ttozbixbuczw", "ttppspmpc", "ttpq", "ttpslook",	/* 15236 */
+	"ttpy", "ttqkfrgbjs", "ttqygknjbx", "ttsdeifewcn",	/* 15240 */
+	"ttsukrxpmhkoyp", "tttbicpxbkupo", "tttowo", "ttukgrby",	/* 15244 */
+	"ttvekurwaizu", "ttvilm", "ttvpzdsqszefs", "ttvvdfqiqugl",	/* 15248 */
+	"ttvxajcidy", "ttvzvmu", "ttwer", "tu",	/* 15252 */
+	"tubaml", "tudiw", "tudkvdjmhoywk", "tuecrgezh",	/* 15256 */
+	"tufdspnp", "tufvehppindm", "tugjb", "tugtmqtbbowlic",	/* 15260 */
+	"tugyekamdngjqj", "tugyo", "tuhegvukuas", "tuheyikhvhow",	/* 15264 */
+	"tuhtkgcfxg", "tuhvhlieynq", "tukny", "tulmbj",	/* 15268 */
+	"tuokgfh", "tupkscgflwxcz", "tuqnaini", "turdfjuhc",	/* 15272 */
+	"turmlofwayit", "tus", "tuuolbgvieqyx", "tuvsqc",	/* 15276 */
+	"tuwbb", "tuxzbqfqpjua", "tuynwmmu", "tv",	/* 15280 */
+	"tvaltclmv", "tvaubjhctn", "tvbisfbmukbz", "tvbjhvb",	/* 15284 */
+	"tvbx", "tvcuhupfkw", "tvfssp", "tvghv",	/* 15288 */
+	"tvi", "tviyngjwhu", "tvltdbk", "tvmb",	/* 15292 */
+	"tvn", "tvnilnmt", "tvpfjisonykx", "tvqqdo",	/* 15296 */
+	"tvrxaijcrsj", "tvtilzwts", "tvtqnlsagloaye", "tvubxecnyppj",	/* 15300 */
+	"tvxkfbj", "tvxszh", "tvyfybta", "tvyglqno",	/* 15304 */
+	"twackpv", "twbwhwasntyjc", "twcda", "twcich",	/* 15308 */
+	"twcpooci", "twcsdkdnfr", "twd", "twfks",	/* 15312 */
+	"twfnhjf", "twgc", "twh", "twhhfnfmv",	/* 15316 */
+	"twhvat", "twiqvlkfbeoo", "twjrupvfehr", "twkhebktdwhqe",	/* 15320 */
+	"twkugwcw", "twlf", "twndjd", "twolch",	/* 15324 */
+	"twpginwfmh", "twputx", "twqttz", "twribcijigtb",	/* 15328 */
+	"twsdg", "twswpvlvqrwp", "twtkxl", "twtv",	/* 15332 */
+	"twvc", "twwf", "twwubwrmxql", "twxcuajf",	/* 15336 */
+	"twzbwt", "twzguqwoz", "tx", "txaauqvokv",	/* 15340 */
+	"txajsfpgjgb", "txamzxqzeq", "txbik", "txboqykqxc",	/* 15344 */
+	"txc", "txcikemtib", "txdfnonkkngoqv", "txdkatmexvqydl",	/* 15348 */
+	"txdonjpcfq", "txdzjtwjo", "txf", "txgpuzefzcm",	/* 15352 */
+	"txhwcs", "txilwphwpc", "txlhuaa", "txlkmfvr",	/* 15356 */
+	"txlpxuhiiryw", "txmgltv", "txpbaqwpim", "txpqekel",	/* 15360 */
+	"txtpt", "txuvtpabc", "txwrvjftf", "txxkzhslr",	/* 15364 */
+	"txyvwopqf", "txzccfcz", "txzxovhdaqwf", "ty",	/* 15368 */
+	"tyak", "tydligq", "tygipvsxu", "tygvxtrjlbygj",	/* 15372 */
+	"tygzo", "tyheksnydxtwed", "tyjapdhgluf", "tyjpbgvi",	/* 15376 */
+	"tympmf", "tymvgknwsqle", "tynfarmkdk", "tynlktyhivcqz",	/* 15380 */
+	"tyopulpddlvt", "typdaunvsdeh", "tyrk", "tyrqrhlg",	/* 15384 */
+	"tyrx", "tyt", "tytddhlluo", "tytkinw",	/* 15388 */
+	"tytza", "tyvcej", "tyxl", "tyxqvfwy",	/* 15392 */
+	"tyxrnaacybzdn", "tyyyj", "tz", "tzadiymazaa",	/* 15396 */
+	"tzcpqofcoodfrn", "tze", "tzermhexw", "tzeufvosj",	/* 15400 */
+	"tzfdlwfwntiur", "tzfocey", "tzhbf", "tzhitoc",	/* 15404 */
+	"tziswwt", "tzitpfjaoimsfo", "tzjhiucfue", "tzjinehmqg",	/* 15408 */
+	"tzjthc", "tzkototbkclu", "tzl", "tzlrfx",	/* 15412 */
+	"tzpakoe", "tzptyzlh", "tzqehtdo", "tzqmczh",	/* 15416 */
+	"tzshoxjqu", "tzsmranfulxox", "tzsuoar", "tztopaznmidlyi",	/* 15420 */
+	"tzuxbnyucucnqo", "tzyueujaky", "ua", "uaa",	/* 15424 */
+	"uabdnpgm", "uabslekzfbmc", "uachsqblhxg", "uaejya",	/* 15428 */
+	"uaflxcvoiyph", "uaglejpur", "uagnlduxlqf", "uahjxwoqutrw",	/* 15432 */
+	"uahnivgvlhwnhb", "uaipioqtpbrjyd", "uajmxmiyfvrdy", "uakbfmb",	/* 15436 */
+	"ualcksgp", "ualfkobwajl", "uamvszkvun", "uanxvs",	/* 15440 */
+	"uanynfn", "uapuklcvc", "uaqpesaerasdzu", "uaqvlpv",	/* 15444 */
+	"uatxreuso", "uav", "uavqkq", "uaxzyzuzrskbls",	/* 15448 */
+	"uayczhkex", "uayudk", "ub", "ubaulomhjdanpq",	/* 15452 */
+	"ubcujxiban", "ubdcvxeparhl", "ube", "ubg",	/* 15456 */
+	"ubidvobtdandag", "ubis", "ubkhwmdnkbi", "ubmcrdupbqh",	/* 15460 */
+	"ubncmdrjhayh", "ubogxsmusrt", "ubojkzdxlrhztg", "ubonvpffdfwi",	/* 15464 */
+	"ubouopbb", "ubp", "ubq", "ubsdvrkc",	/* 15468 */
+	"ubsfneq", "ubsrdkesvhxx", "ubtigawzao", "ubtrkgwfmc",	/* 15472 */
+	"ubuof", "ubvjjrwtjowp", "ubxqiowltmmhr", "ubyratvgeyq",	/* 15476 */
+	"ubzouyntc", "uc", "ucbooqrljww", "ucegkihlgtipx",	/* 15480 */
+	"ucfsnenczq", "uch", "ucjcnghmfu", "ucjwwzgebwmy",	/* 15484 */
+	"uckjvkqkgb", "ucleexycljhmy", "uclhc", "ucljuwr",	/* 15488 */
+	"uclpdoc", "uclsza", "ucoub", "ucpeqwdrubm",	/* 15492 */
+	"ucpghomk", "ucqpvdkrqmnqkl", "ucrihfwg", "ucrryhxsfzne",	/* 15496 */
+	"ucrzbbiyh", "ucsjmtfwcxxhfe", "ucsmdpyiqexpu", "uctq",	/* 15500 */
+	"ucv", "ucvkez", "ucvwrw", "ucw",	/* 15504 */
+	"ucwgclzz", "ucxt", "ucyfghfjzd", "ucyfwhgugzcp",	/* 15508 */
+	"ucyjglfexkkkfu", "ucyynengt", "uczcgmui", "uczhajcvo",	/* 15512 */
+	"uczkutbvvdnp", "uczpj", "ud", "udcdkgbwujno",	/* 15516 */
+	"udclq", "udcztsy", "udfgyrk", "udhrnrjz",	/* 15520 */
+	"udhw", "udhxydwuqwu", "udjwtngqk", "udkdpbgipodbx",	/* 15524 */
+	"udkoyvxfltmfun", "udlmlyhvcx", "udmorcbvlr", "udppfbhirhz",	/* 15528 */
+	"udqhohnkhatbgg", "udredlxjuwef", "udsqnrlveth", "udtryxsgis",	/* 15532 */
+	"udu", "uduuwl", "udvnmfxzlodfm", "udw",	/* 15536 */
+	"udxdylenwqx", "udxykfmeknojr", "udzngiyrrv", "ue",	/* 15540 */
+	"ueazdfycv", "uebdysvq", "uebnjj", "uebrwwlhns",	/* 15544 */
+	"ueenravnbon", "ueexkwj", "ueftrpiqums", "uefxmotg",	/* 15548 */
+	"uehp", "uehqe", "uehvl", "uehvnos",	/* 15552 */
+	"uekpenhqwo", "uemn", "uenkhlzvswmuc", "ueob",	/* 15556 */
+	"uep", "uercpiux", "uerucpnwhs", "uesfqnwoh",	/* 15560 */
+	"ueshrugp", "ueuom", "ueuymwlhhuihmx", "uevvuzmzkbqrm",	/* 15564 */
+	"uevyvarbn", "uewwyiiftivcqn", "uexsdisku", "ueytwkzhuikb",	/* 15568 */
+	"ueyx", "uezltsuscwar", "ufbbpm", "ufbdfzwdpx",	/* 15572 */
+	"ufcbprr", "ufccgxe", "ufchmhtxd", "ufcpilt",	/* 15576 */
+	"ufcynct", "ufeufnomvdv", "ufezsakwy", "ufgynjpcjurrmf",	/* 15580 */
+	"ufimddbsd", "ufionjpv", "ufiqtoyamruth", "ufj",	/* 15584 */
+	"ufksguhp", "uflsesq", "ufltcmofgi", "ufmohjarqxfj",	/* 15588 */
+	"ufnw", "ufqgmodki", "ufqmgltxvuexa", "ufqv",	/* 15592 */
+	"uftgek", "ufu", "ufulgsh", "ufvctxxttacg",	/* 15596 */
+	"ufvjob", "ufwbhncvrj", "ufxp", "ufyhqpcz",	/* 15600 */
+	"ufyrshdx", "ug", "ugafoxp", "ugawmf",	/* 15604 */
+	"ugbporm", "ugdgwdcaurgkw", "ugdteosr", "ugetkfqm",	/* 15608 */
+	"ugexqzzckp", "uggwx", "ugheiy", "ughuhbn",	/* 15612 */
+	"ugi", "ugijfmxyv", "ugjy", "ugkahgihcfft",	/* 15616 */
+	"uglpnvycsnmfi", "ugm", "ugoflu", "ugoj",	/* 15620 */
+	"ugokburqwnrla", "ugozdjb", "ugpoeed", "ugqyongxmmf",	/* 15624 */
+	"ugrlltqkxokvib", "ugsenfx", "ugsg", "ugssor",	/* 15628 */
+	"ugt", "ugth", "ugtmfeiaosn", "ugudbysyph",	/* 15632 */
+	"ugugqgkcbgv", "ugvnqyoxxqps", "ugwpyqtnfj", "ugxbeqcseiqdcy",	/* 15636 */
+	"ugxooshmxemra", "ugybinw", "ugyfo", "ugzmuosnwdpi",	/* 15640 */
+	"uh", "uhaghobocjfx", "uhai", "uhcdxkjswiycyv",	/* 15644 */
+	"uhcosuspzyxn", "uhdlxjeqeic", "uhhqk", "uhhwxsjqtn",	/* 15648 */
+	"uhklkcgmw", "uhkltzygy", "uhkqgsuzdlb", "uhljndccl",	/* 15652 */
+	"uhmtxajvoo", "uhniwaidbzwhld", "uhnytqtlc", "uhofmangshlslr",	/* 15656 */
+	"uhpf", "uhrtixaiejyzo", "uhtuzz", "uhvtfta",	/* 15660 */
+	"uhxlbwucx", "uhytrtd", "uhzwtjwiity", "ui",	/* 15664 */
+	"uibvghqfaalzx", "uiceqzqhlxqz", "uieubghfjyaqf", "uifotgmmkhp",	/* 15668 */
+	"uifsbot", "uifyppchg", "uigdl", "uigu",	/* 15672 */
+	"uiixlqqsysl", "uijxhxb", "uikqikctit", "uimgswgi",	/* 15676 */
+	"uimkxyaa", "uimlqoijgp", "uimmtvuqyfnee", "uinjaxycof",	/* 15680 */
+	"uinpk", "uipamf", "uipdjddfsjhv", "uiperkvz",	/* 15684 */
+	"uiptkhlnlbjpe", "uipwipsj", "uipwuevowwbwks", "uiriqttzt",	/* 15688 */
+	"uiuhbcyqulfqy", "uiujnftaxuedyg", "uiwxvxaxmiqa", "uixuqov",	/* 15692 */
+	"uixxtxm", "uiyibqcd", "uizbbgnihvolkn", "uj",	/* 15696 */
+	"ujbnkqxsui", "ujbrdfryenyvvi", "ujdisptetnwgi", "ujf",	/* 15700 */
+	"ujfbokjlgqoia", "ujfgzxkjn", "ujfosr", "ujgfplyhofpnyn",	/* 15704 */
+	"ujgm", "uji", "ujjdesafyncqwl", "ujkmguyq",	/* 15708 */
+	"ujl", "ujmrnxtbtm", "ujpvpyqstvsuoh", "ujrzyhaiyoam",	/* 15712 */
+	"ujsj", "ujslbqxbtxxwwr", "ujslvaf", "ujto",	/* 15716 */
+	"ujtrcumdfhz", "ujuryy", "ujw", "ujwaujehtiqedq",	/* 15720 */
+	"ujwqauncigzzv", "ujwu", "ujyafuwja", "ujzrvinajyc",	/* 15724 */
+	"uk", "ukaxpl", "ukbeo", "ukbgnkzzr",	/* 15728 */
+	"ukegdxtybh", "ukesfum", "ukfhtszbifsd", "ukfipjc",	/* 15732 */
+	"ukgqpunyzvgh", "ukgwouzujoizsg", "ukhmjbkfkzs", "ukhqakkazwmvtb",	/* 15736 */
+	"ukhrxfjuuf", "ukknzu", "ukkxgyavsb", "ukm",	/* 15740 */
+	"ukmqfhpzmc", "ukndjuadp", "ukodta", "ukopdztg",	/* 15744 */
+	"ukpvsyfcusl", "ukq", "ukqwzmshqdzoh", "uktghtmeu",	/* 15748 */
+	"uktqrc", "ukurnnkbvbwfqt", "ukuyvgxp", "ukvbasd",	/* 15752 */
+	"ukwywado", "ukwzphsupxvk", "ukxdl", "ukxmh",	/* 15756 */
+	"ukygnggqwsfzk", "ukypitl", "ukzjtbarbw", "ukzjzsex",	/* 15760 */
+	"ukzn", "ul", "ulbacvpcbngxsz", "ulcx",	/* 15764 */
+	"ulfpgtv", "ulgvpgzpkq", "ulhsvhgejkqa", "ulkrrgg",	/* 15768 */
+	"ulkzhyyxfax", "ulmjotkrqfaeiv", "ulmpufpzkrxng", "uln",	/* 15772 */
+	"ulowtckpv", "ulsxmvkc", "ultkhmufqmikxe", "ululrigmnjctc",	/* 15776 */
+	"ulupra", "ulveaiwkmsu", "ulvixxyhc", "ulvllmtpl",	/* 15780 */
+	"ulxqgsduyvdp", "uly", "ulyauikeekt", "ulzjdxshhnbnnj",	/* 15784 */
+	"ulzyxsvuvy", "um", "umalhg", "umarssziwcv",	/* 15788 */
+	"umbnpuusvfimfw", "umbq", "umcsafbcemozkh", "umdjbtt",	/* 15792 */
+	"umemcitr", "umfubjrmdnh", "umgiehugme", "umhh",	/* 15796 */
+	"umhyjy", "umjbqzkkywfrb", "umjqgea", "umk",	/* 15800 */
+	"umkejtess", "umle", "umlkscwe", "umlurvoepqti",	/* 15804 */
+	"umluvpwmd", "umlxxrvvjexd", "ummjtbjrlw", "ummtrewytgcay",	/* 15808 */
+	"ummvl", "ummxwrf", "umnejf", "umns",	/* 15812 */
+	"umquducp", "umtrdyqa", "umuflatrxr", "umukm",	/* 15816 */
+	"umuofqujqfospl", "umvcjdjxarmnll", "umvjflxp", "umwbxthjkk",	/* 15820 */
+	"umwdsvnvert", "umxfzhjppdsk", "umxsuogmkvthnm", "umzeebylkrynr",	/* 15824 */
+	"un", "uncwirx", "undks", "unfo",	/* 15828 */
+	"ungaair", "ungfhcto", "unhpzfraxhovwf", "unirwjndnpgq",	/* 15832 */
+	"unjfksxitnpiso", "unjpbxo", "unjxsvcnrlloq", "unkvfl",	/* 15836 */
+	"unlrwsix", "unltzsocy", "unmwblxlovcg", "unng",	/* 15840 */
+	"unpgtjxlk", "unpmxxuhqvryt", "unsabwlseseeii", "unsdjet",	/* 15844 */
+	"untesimiikcfaa", "untfky", "unvfnfmugnm", "unvjpxykhjt",	/* 15848 */
+	"unwpbbfecs", "unxagcdy", "unxayftqhf", "unxiqoula",	/* 15852 */
+	"unyelqaonq", "unyoshacgtrky", "unzknoirecey", "unzxxrmyl",	/* 15856 */
+	"uo", "uoadrfnwljp", "uocaraeharbq", "uocwkzilsafs",	/* 15860 */
+	"uodgjnrgmqq", "uodgs", "uodhgmohd", "uodhstfqaqdyh",	/* 15864 */
+	"uoe", "uoesqufdx", "uofbrotydsrr", "uofcbnqyc",	/* 15868 */
+	"uofxk", "uogdezmdmyqs", "uoglbmmeuq", "uoguv",	/* 15872 */
+	"uogwclp", "uohachrfmil", "uojqfqglpz", "uojydhqiiw",	/* 15876 */
+	"uolloanptg", "uooudtm", "uoozzhyliwry", "uoq",	/* 15880 */
+	"uoqyucujjwf", "uoqznrfwmw", "uorqsmyaxvawso", "uorytbdrzqxqy",	/* 15884 */
+	"uowilsles", "uowqt", "uoxbeavxpybyl", "up",	/* 15888 */
+	"upa", "upamzfjfpmazip", "upanzejkimyu", "upeolko",	/* 15892 */
+	"upfk", "upfmxiihmauxni", "upfrdqlmd", "upfwepeog",	/* 15896 */
+	"uphgcwgnotwxl", "upjcfswzx", "upjpsvsy", "upkaykc",	/* 15900 */
+	"upktchrxytta", "upm", "upmqte", "upmsfzsvpgjk",	/* 15904 */
+	"upniltsegp", "upnn", "uppljeo", "upqdbjkbbibnl",	/* 15908 */
+	"upqmr", "uprttofbnnvsd", "upsi", "upuqzjmtf",	/* 15912 */
+	"upzzxxjkmvg", "uq", "uqaba", "uqbwlwxvudyxea",	/* 15916 */
+	"uqclit", "uqdjykvnm", "uqdkwsa", "uqdnorqj",	/* 15920 */
+	"uqezeldqcfeni", "uqfmvzdzkdsdcr", "uqhpi", "uqhysozqppf",	/* 15924 */
+	"uqidfxuy", "uqjaefersta", "uqkhomcan", "uqkrifhvhe",	/* 15928 */
+	"uqkyrxji", "uqlqcisdojb", "uqlu", "uqn",	/* 15932 */
+	"uqndmtdvhje", "uqnhb", "uqohr", "uqokcuv",	/* 15936 */
+	"uqozccfloehmws", "uqpzfveafjfuue", "uqroxmitqibcj", "uqsfyoval",	/* 15940 */
+	"uqtmtx", "uqu", "uqwnewhle", "uqwnw",	/* 15944 */
+	"uqzfbzldnpwxu", "uqzp", "ur", "urafxj",	/* 15948 */
+	"urbgaubb", "urbr", "urclfahp", "urcsjln",	/* 15952 */
+	"urcto", "ureemetwxk", "urfeq", "urg",	/* 15956 */
+	"urjdbbqo", "urlrldiyzczrvz", "urmlpypdcjcoo", "uroiq",	/* 15960 */
+	"urpziibkrnek", "urrkdmeumvfe", "ursvzle", "urvgow",	/* 15964 */
+	"urw", "urx", "urxlznwkkr", "uryl",	/* 15968 */
+	"urzvfb", "us", "usajbes", "usartmqpcfnbpy",	/* 15972 */
+	"uscapzwl", "uscghqo", "usd", "usdlbewyn",	/* 15976 */
+	"usgjgnfvu", "usgmfbyqmxpqn", "usgudbxc", "usj",	/* 15980 */
+	"uskbdhpkyvts", "uskj", "uslytmzhdiodra", "usmkvicc",	/* 15984 */
+	"usordsvgeb", "uswsbx", "uswwzpfpxperfl", "usyaipqm",	/* 15988 */
+	"usz", "ut", "utaf", "utbe",	/* 15992 */
+	"utbgwrsecskb", "utbjasqvbhea", "utccb", "utdsho",	/* 15996 */
+	"utdxvpkd", "utenjwe", "utimom", "utjiurhsrnrfkd",	/* 16000 */
+	"utkefrvlofqcq", "utkvmaa", "utkwo", "utlpnkakngu",	/* 16004 */
+	"utlvaxiwof", "utmvw", "utnlq", "uto",	/* 16008 */
+	"utqeb", "utqtnvmc", "utr", "utrwxeg",	/* 16012 */
+	"utsiknjsrfksvg", "uttyhaxtz", "utv", "utvhuvvgryjpk",	/* 16016 */
+	"utvsfum", "utwegqjug", "utwnmoxyggfgz", "utxbgcyp",	/* 16020 */
+	"uu", "uubryglzyqzwq", "uubt", "uucikrbkzvm",	/* 16024 */
+	"uucvdaacu", "uud", "uudne", "uufenhtw",	/* 16028 */
+	"uugotx", "uugzzjlknar", "uuibrjgsalmgpp", "uukcceon",	/* 16032 */
+	"uumpbbxpmbbjyt", "uuoe", "uuonjlzanrl", "uuowhs",	/* 16036 */
+	"uuozcdkmxpuiw", "uuqltyhgdt", "uuqywofjj", "uusjdbewrp",	/* 16040 */
+	"uut", "uuuxxkouj", "uuuybmdznu", "uuwarsrkvbm",	/* 16044 */
+	"uuwxmz", "uux", "uuxpdcctlxpsxk", "uuzohznji",	/* 16048 */
+	"uv", "uvaxlkmwpgmc", "uvbjctxtfub", "uvbmky",	/* 16052 */
+	"uvcbrmmazjx", "uvcbugmieks", "uvetpogvv", "uvfqkfcddevxo",	/* 16056 */
+	"uvfzq", "uvimkev", "uvjhezii", "uvkbsahdrz",	/* 16060 */
+	"uvke", "uvlhvu", "uvlot", "uvn",	/* 16064 */
+	"uvnd", "uvoccclo", "uvqagvs", "uvrvxh",	/* 16068 */
+	"uvsgaudvevzx", "uvssedwpudepx", "uvtaow", "uvtsxdempsgu",	/* 16072 */
+	"uvutzohalnz", "uvvukrnmagle", "uvwqnv", "uvwrie",	/* 16076 */
+	"uvwzqsiodire", "uvxka", "uvyeqq", "uvzouilicpdxt",	/* 16080 */
+	"uw", "uwacfpnacxmvqt", "uway", "uwbjcmfeei",	/* 16084 */
+	"uwbjx", "uwcgdfzqatojbr", "uwcr", "uwdtvoootsjkq",	/* 16088 */
+	"uwevtyg", "uwhbtlk", "uwidzfigm", "uwjpor",	/* 16092 */
+	"uwjpzyt", "uwjt", "uwk", "uwkdnnmcmf",	/* 16096 */
+	"uwkvymwzkaijl", "uwncqruaifg", "uwntrpnlf", "uwohfdfjlgo",	/* 16100 */
+	"uworczlf", "uwosvgisbayw", "uwpjkr", "uwpx",	/* 16104 */
+	"uwqayr", "uwqslrwzunrbnr", "uwqyte", "uwrxforse",	/* 16108 */
+	"uwttwwtjom", "uwuhvuvcpvemq", "uwwrtyj", "uwwthjcevgxbxc",	/* 16112 */
+	"uwxeyge", "uwxpyyvsj", "uwytcfwfstc", "ux",	/* 16116 */
+	"uxbqw", "uxcvbly", "uxcvtmvccaa", "uxe",	/* 16120 */
+	"uxehfb", "uxel", "uxelukidclax", "uxfyxcieizxcjw",	/* 16124 */
+	"uxgji", "uxgkvroitqwfl", "uxhitzfdaiscu", "uxhwpuqg",	/* 16128 */
+	"uxi", "uxifmjghrd", "uxjghcavhyy", "uxkdrikuss",	/* 16132 */
+	"uxkivvpgivvwex", "uxkmta", "uxkvrhqozdz", "uxlmgvzhzobjdb",	/* 16136 */
+	"uxlpdggkx", "uxmjvccvmztjr", "uxnedsd", "uxpbvvknzoknlr",	/* 16140 */
+	"uxqrm", "uxskhmwuycw", "uxsuaf", "uxtfzvtuh",	/* 16144 */
+	"uxubhnoohejk", "uxwjdplc", "uxylhdg", "uxyyss",	/* 16148 */
+	"uxzrwiq", "uy", "uyanaxkr", "uyanj",	/* 16152 */
+	"uybsiberzhm", "uydg", "uydmc", "uydmmgqmwirpjr",	/* 16156 */
+	"uydplgy", "uydtiisir", "uydunf", "uyegatvsm",	/* 16160 */
+	"uyfhyrkwn", "uyfzwxqeztlsux", "uygqhs", "uygyddikwgphb",	/* 16164 */
+	"uyh", "uyhqrehslosl", "uyksvitspjtvd", "uylrflkns",	/* 16168 */
+	"uymd", "uymy", "uyoxphpmjqupgf", "uypbgfxpcohd",	/* 16172 */
+	"uyspq", "uyxvjcoaltj", "uyzrct", "uz",	/* 16176 */
+	"uzc", "uzdyczbcs", "uzgt", "uzhrnnxua",	/* 16180 */
+	"uzhvutn", "uzi", "uzibueas", "uzigcqq",	/* 16184 */
+	"uzjxcngh", "uzk", "uzmmlfqvbfel", "uznaebhvn",	/* 16188 */
+	"uznplxnlqj", "uznxxyr", "uzojudqxz", "uzoqxnrrlfymww",	/* 16192 */
+	"uzqqkoacqhjw", "uztiqmluwsjzz", "uztnwzb", "uzttqprw",	/* 16196 */
+	"uzugrollzu", "uzuvzfmrx", "uzvwfrbhrpbujc", "uzwz",	/* 16200 */
+	"uzxnmnsn", "uzyszjxy", "va", "vabwnfctcmwqj",	/* 16204 */
+	"vad", "vadqd", "vadv", "vadygfeoa",	/* 16208 */
+	"vag", "vahnyzynycqju", "vaihlytbu", "vajsdzaxo",	/* 16212 */
+	"vamax", "vamcbvujwdaavx", "vamcf", "vamrctobuh",	/* 16216 */
+	"vanb", "vanpdnjc", "vansaqbfvzt", "vaoeug",	/* 16220 */
+	"vapnopagwj", "vaprgel", "vasaxvlk", "vaskmbl",	/* 16224 */
+	"vasnmxfkshaceh", "vav", "vavmrnmhhcqij", "vaw",	/* 16228 */
+	"vaxy", "vaxyblzrb", "vayphngdmh", "vaytnnlbgowkkl",	/* 16232 */
+	"vazymmtbzyi", "vb", "vbalyxxhrlrpxs", "vbbhrhulp",	/* 16236 */
+	"vbdn", "vbgsy", "vbhaizbjjrs", "vbhtbsywq",	/* 16240 */
+	"vbhxw", "vbhzoszotqe", "vbineurlibja", "vbjnn",	/* 16244 */
+	"vbkyzplqaebpk", "vblqoysizbkzrz", "vblwhyjdybh", "vbnfb",	/* 16248 */
+	"vbqnjhsxhyehws", "vbsg", "vbsme", "vbsn",	/* 16252 */
+	"vbsxtgcr", "vbt", "vbtkw", "vbu",	/* 16256 */
+	"vbwh", "vbxijayza", "vbxmeuufzpdke", "vbxrrsimbwrlh",	/* 16260 */
+	"vbysqhodvst", "vc", "vcajapmjeg", "vcd",	/* 16264 */
+	"vcdqghmxopvfk", "vcecdcyqlzwv", "vcetvondfyrn", "vcfrmk",	/* 16268 */
+	"vcfshyiqmuhf", "vcfyd", "vcgbfruimec", "vcgjbdkx",	/* 16272 */
+	"vcgrtrxljfh", "vchz", "vcjtx", "vckgvclldjm",	/* 16276 */
+	"vcldfq", "vclfbvp", "vclwhvdc", "vcnmszrohdwxt",	/* 16280 */
+	"vcnxhkgqlfb", "vcodairnwp", "vcplnzk", "vcqspkfxd",	/* 16284 */
+	"vcr", "vcruqbucmrzxza", "vcsgyni", "vctheliit",	/* 16288 */
+	"vcwr", "vcysim", "vcyttr", "vcyukzphqrfk",	/* 16292 */
+	"vd", "vdbducsmrb", "vdflh", "vdggluc",	/* 16296 */
+	"vdgxuyfiozlkz", "vdid", "vdijpchjvmzuic", "vdixwmpgial",	/* 16300 */
+	"vdj", "vdkgztrjvot", "vdlbwq", "vdnwjjwkfhsjf",	/* 16304 */
+	"vdovguilwsy", "vdpzxsdio", "vdqfruu", "vdqzvhhbjcakp",	/* 16308 */
+	"vds", "vdsdqzkdjafc", "vdtaqejucn", "vdtlpenb",	/* 16312 */
+	"vdurdnlui", "vduytcmu", "vdvmcz", "vdvzkzsupxb",	/* 16316 */
+	"vdxamsvrklq", "vdxybzrdz", "vdyfwvpvl", "veakt",	/* 16320 */
+	"veal", "veb", "vebrze", "vechvf",	/* 16324 */
+	"vecjzhmcww", "vedkcchtuabnew", "veecsevgp", "vegcflsxhxyl",	/* 16328 */
+	"vehdrxvdh", "vehlevorihyz", "vehmgct", "veht",	/* 16332 */
+	"vejvouwe", "vel", "vemfjic", "veonrgntrfh",	/* 16336 */
+	"veoxjnade", "vepbkcu", "vepotjaisjn", "vepublmnfpywf",	/* 16340 */
+	"vereexv", "verujbj", "vesavzcg", "vetdclpduw",	/* 16344 */
+	"vevcj", "vewfm", "vewphi", "vexhxldk",	/* 16348 */
+	"vf", "vfcgxx", "vfczk", "vfenmme",	/* 16352 */
+	"vfhjxcfolm", "vfhkptt", "vfhldarenevijy", "vfhnfzyft",	/* 16356 */
+	"vfifwatvzmad", "vfky", "vflnmv", "vflsrhyfif",	/* 16360 */
+	"vfmvccpv", "vfnrhilyyu", "vfnu", "vfoismcmew",	/* 16364 */
+	"vfp", "vfsebnbmvrqy", "vfsf", "vfsmzqcn",	/* 16368 */
+	"vfsoviuexqrp", "vfspykeuvb", "vfsrofjzkrqpdv", "vfsvyxadoaf",	/* 16372 */
+	"vfsz", "vfvqabp", "vfwdypndzs", "vfxplhizwhkgo",	/* 16376 */
+	"vfzba", "vfzvy", "vfzzhirhuz", "vg",	/* 16380 */
+	"vgak", "vgbxyohdexjz", "vgcodqva", "vggey",	/* 16384 */
+	"vghcugfwjccwg", "vgioprycebhna", "vgiubdpgahaxo", "vgjjspqmsb",	/* 16388 */
+	"vgmef", "vgng", "vgnkuaivyycllq", "vgojryp",	/* 16392 */
+	"vgpthp", "vgqmbbykwxvtmr", "vgryep", "vgszscqvhyahj",	/* 16396 */
+	"vgtqxae", "vgvckvibvzdg", "vh", "vham",	/* 16400 */
+	"vhaorb", "vhcjddouvvgupw", "vhcnl", "vhcymxm",	/* 16404 */
+	"vhcyrrf", "vhdbhcccvv", "vhdrkglxbiw", "vhdymdyzslfbh",	/* 16408 */
+	"vhevrkncfsqia", "vhhj", "vhi", "vhj",	/* 16412 */
+	"vhjkbnagnt", "vhjrfgfxl", "vhjvzpj", "vhldjzxsfyehvu",	/* 16416 */
+	"vhmyn", "vhopj", "vhpirdiityfgdo", "vhpxpcskeercv",	/* 16420 */
+	"vhqyi", "vhrn", "vhuqabskktlarl", "vhutjtbjguamj",	/* 16424 */
+	"vhvoljfhnqvowg", "vhxld", "vhxlzt", "vhxwkozvhehtji",	/* 16428 */
+	"vhzoml", "viacym", "viasw", "vicgrykhiagz",	/* 16432 */
+	"vidtwfd", "vienlulym", "vihfxsubnrb", "viklgdcrkhj",	/* 16436 */
+	"vikn", "vikpjzpx", "vilwtmiqm", "vimbajainf",	/* 16440 */
+	"vimkqurbvmlefv", "vimm", "vinufsihjy", "vio",	/* 16444 */
+	"violjxkfiyd", "viom", "vioygn", "vipngmcxkwhhs",	/* 16448 */
+	"viptozzibfxf", "viscpqkhs", "visjvirtqczdv", "visvffeo",	/* 16452 */
+	"vitde", "vitzzqxlntw", "viuvpk", "viyxubs",	/* 16456 */
+	"vizseheecm", "vj", "vjauvnyte", "vjbhuabn",	/* 16460 */
+	"vjccga", "vjcdhmkpdfbbz", "vjcghozsspiwk", "vjcp",	/* 16464 */
+	"vjdmpf", "vjfibtpon", "vjfmwuys", "vjgo",	/* 16468 */
+	"vji", "vjjwgfsrc", "vjldw", "vjlievhpcjne",	/* 16472 */
+	"vjlrcpmnnrp", "vjn", "vjnblzofh", "vjnkayajthc",	/* 16476 */
+	"vjnqnv", "vjptptybhdbmfx", "vjqygbct", "vjram",	/* 16480 */
+	"vjrsmfrsin", "vjtbprvmw", "vjtiw", "vjuexg",	/* 16484 */
+	"vjulxlmgfuql", "vjumecoaao", "vjun", "vjunninj",	/* 16488 */
+	"vjuxqcwr", "vjvke", "vjvyclbybob", "vjwjoqvjfo",	/* 16492 */
+	"vjxthvfs", "vjyurkostma", "vjyzi", "vk",	/* 16496 */
+	"vkbmqqlcrp", "vkcuzaprqsuptr", "vkdpfihszxkhra", "vkhvph",	/* 16500 */
+	"vkjrxivq", "vkkyuzwsofgy", "vklokpytqi", "vkltstctpbi",	/* 16504 */
+	"vkmztwoa", "vkntodib", "vknx", "vkobzhmkgf",	/* 16508 */
+	"vkq", "vkqedtvxotksic", "vkrs", "vksaxfzifvzlqt",	/* 16512 */
+	"vksc", "vktng", "vktzkxmdf", "vkvlwlm",	/* 16516 */
+	"vkvyx", "vkwshlcwjdke", "vkxivsnk", "vkyknchluria",	/* 16520 */
+	"vkz", "vl", "vlada", "vlak",	/* 16524 */
+	"vlbxp", "vleu", "vlifrgjgh", "vlimrbvdnhd",	/* 16528 */
+	"vlnxkh", "vlolda", "vlpttau", "vlq",	/* 16532 */
+	"vlqvdghu", "vlqzbzw", "vlraaozjmxf", "vlrbh",	/* 16536 */
+	"vlrjkfh", "vluojsszqc", "vlvnnklblq", "vlwukb",	/* 16540 */
+	"vlxhtbiaoalcgm", "vlyipgi", "vm", "vmao",	/* 16544 */
+	"vmbalpnfyzvqin", "vmcliascj", "vmcnuojx", "vmefzfckgpwad",	/* 16548 */
+	"vmehogzv", "vmezvqazdr", "vmgujg", "vmipkywyzzr",	/* 16552 */
+	"vmlrxezt", "vmlvhc", "vmlwqcqxbhnc", "vmmjdjckqf",	/* 16556 */
+	"vmmpi", "vmmxohhpaji", "vmmziczyl", "vmnntubhv",	/* 16560 */
+	"vmofvadzjgny", "vmqkz", "vmr", "vmsc",	/* 16564 */
+	"vmtd", "vmtizijldtp", "vmummyfkdzhg", "vmw",	/* 16568 */
+	"vmwduhj", "vmwgedmocidji", "vmxam", "vmxqifbhvbszr",	/* 16572 */
+	"vmy", "vmyeout", "vmzcrsiqfnmbtr", "vn",	/* 16576 */
+	"vnaemw", "vncwg", "vndqoyd", "vnesqwnuagzj",	/* 16580 */
+	"vnfidrbmfap", "vnfj", "vngoixmjnxtxmz", "vnjni",	/* 16584 */
+	"vnlk", "vnm", "vnoop", "vnpipevvgmbi",	/* 16588 */
+	"vnpjcsk", "vnpmzincmrbus", "vnrcniwuyyrvja", "vnuckaoogkyy",	/* 16592 */
+	"vnupoizgekztn", "vnvfji", "vnvkvngmyq", "vo",	/* 16596 */
+	"voaixtzl", "vod", "vodfoin", "vodkbkvaeclfzb",	/* 16600 */
+	"vof", "voflbegxpejfrg", "vogx", "voidctjvhsew",	/* 16604 */
+	"vokxgfkqmomvdn", "vonp", "vopiyvlfn", "vopnyxepyov",	/* 16608 */
+	"voqcgwzpocblo", "vosbpktwnrwm", "votgmrorwc", "voucx",	/* 16612 */
+	"vovbdysuejm", "vowce", "vowgezhmju", "vowphj",	/* 16616 */
+	"voxmbkzce", "voyla", "vozjd", "vozx",	/* 16620 */
+	"vozzrxrwxoor", "vp", "vpb", "vpcbdeerg",	/* 16624 */
+	"vpdcjkji", "vpekq", "vpfgmhqksbrx", "vpfno",	/* 16628 */
+	"vpgnxf", "vpgyddvcu", "vphtjdotc", "vpjmsopdqkhn",	/* 16632 */
+	"vpm", "vpnoegzltxgmeq", "vpnwtmai", "vppwvjbqohc",	/* 16636 */
+	"vpt", "vptcaihfxbzsgc", "vptdxtrvfq", "vptyvfic",	/* 16640 */
+	"vpvcmiadbcxt", "vpvepua", "vpvv", "vpxhaljgb",	/* 16644 */
+	"vpy", "vpzkofgyguzoi", "vq", "vqavdm",	/* 16648 */
+	"vqcmbsxec", "vqdblixik", "vqiiwrflnlgibx", "vqims",	/* 16652 */
+	"vqixaxvvfgnwj", "vqjhhgmgskux", "vqls", "vqlsceeqfyjbfo",	/* 16656 */
+	"vqm", "vqoimqhioo", "vqpo", "vqrpbntl",	/* 16660 */
+	"vqrrjd", "vqu", "vqunktweh", "vqvaezen",	/* 16664 */
+	"vqvu", "vqwshse", "vqwtt", "vqx",	/* 16668 */
+	"vqxdixn", "vqxoanbnzh", "vqxyccuhaidjip", "vqzebeuresaq",	/* 16672 */
+	"vqzviafbflzze", "vr", "vrbxlkutbb", "vrcdvlxx",	/* 16676 */
+	"vrchxq", "vrcnynhvx", "vrcoosvailoc", "vrdbiar",	/* 16680 */
+	"vrdufvrfmgtl", "vreosr", "vrfqrmqazqn", "vrftvgicxhudqp",	/* 16684 */
+	"vrgxshuks", "vri", "vriodiqbyzz", "vriwtdy",	/* 16688 */
+	"vrj", "vrkmoyn", "vrlcdozjzpzl", "vrnmhxiiautcg",	/* 16692 */
+	"vropldbnjmgq", "vrov", "vrpwlzkbjc", "vrromzm",	/* 16696 */
+	"vrrxbbssiwxi", "vrsahlprcfw", "vrsefv", "vrsotjbgoyn",	/* 16700 */
+	"vrx", "vrxyyatylln", "vs", "vsasksvix",	/* 16704 */
+	"vsbdqg", "vsc", "vsccctfymsurug", "vscitscqxhc",	/* 16708 */
+	"vscnyrtrxlrgh", "vsctpb", "vseihhmwsltt", "vsfhzchlykeob",	/* 16712 */
+	"vsfrtcopvl", "vsgnsmbf", "vsiz", "vskr",	/* 16716 */
+	"vslwcd", "vsnnxkmzoj", "vsqsumaqdxw", "vsrovbzbsfet",	/* 16720 */
+	"vsrraagp", "vsryc", "vstk", "vstywgfoewwpsu",	/* 16724 */
+	"vsuok", "vswi", "vsxxqssnyqyhm", "vszsrcyrdpwq",	/* 16728 */
+	"vtcphbfdn", "vtd", "vtefkvdt", "vtexsprddmwmmo",	/* 16732 */
+	"vthleipqz", "vtjsn", "vtjuwudf", "vtlqoafpn",	/* 16736 */
+	"vtmfar", "vtmhb", "vtmkerlhrovaza", "vtmw",	/* 16740 */
+	"vtnfnxrokdcukt", "vtpbvn", "vtr", "vttm",	/* 16744 */
+	"vtvd", "vtvjzlsmsysc", "vtwaoykl", "vtwojib",	/* 16748 */
+	"vtwvhvtutlrmyh", "vtxrmvvo", "vtxzxyzhfzwvro", "vtyl",	/* 16752 */
+	"vu", "vuatbgoi", "vubjlvyukwbw", "vucj",	/* 16756 */
+	"vuees", "vueukwem", "vufmufznb", "vufyyelgis",	/* 16760 */
+	"vugqoj", "vugr", "vuhfmdtkvswiys", "vuhpncnkepixnf",	/* 16764 */
+	"vuidpmanlqbur", "vuilfmxpmyj", "vuj", "vujsqrbnw",	/* 16768 */
+	"vuk", "vukkhtlxslh", "vumemviuygpz", "vumtoznlfbaa",	/* 16772 */
+	"vunfpdaohtapfh", "vuoiwdquyj", "vuoqcwzummflsm", "vuoxen",	/* 16776 */
+	"vup", "vupw", "vurfss", "vutezcjxnto",	/* 16780 */
+	"vuuvu", "vuvlcuzvlg", "vuxhhkpvp", "vuxnhrx",	/* 16784 */
+	"vuxqzdbrpneyj", "vuynprkr", "vuzebixwm", "vuzfhi",	/* 16788 */
+	"vuzytgqc", "vv", "vvdlgfkec", "vvdmjnbhkn",	/* 16792 */
+	"vvegiwqt", "vvewqoshjsu", "vvhlo", "vvii",	/* 16796 */
+	"vvjebcmutzzz", "vvknufaeebgeh", "vvlmjsgooqosu", "vvmituld",	/* 16800 */
+	"vvmomdstccwiy", "vvoymqjdk", "vvprc", "vvqutgoderl",	/* 16804 */
+	"vvrvppqxdbhbf", "vvs", "vvsztqriinog", "vvtlwmra",	/* 16808 */
+	"vvttc", "vvvf", "vvvhvftegyr", "vvvsrlxb",	/* 16812 */
+	"vvxn", "vvxrgu", "vvxrvjt", "vvxz",	/* 16816 */
+	"vvyxapq", "vvyzchzuxl", "vvzdnzrpl", "vvziflx",	/* 16820 */
+	"vvzuta", "vw", "vwanoe", "vwauvb",	/* 16824 */
+	"vwaycu", "vwctysfiuxve", "vwdzvrrg", "vwfdz",	/* 16828 */
+	"vwferevvbesajm", "vwgekeaqeq", "vwgkgmftgoe", "vwgvxe",	/* 16832 */
+	"vwizzmuhkgpyu", "vwjtkwe", "vwkxpnozqgilii", "vwojdtzfnofnd",	/* 16836 */
+	"vwpxsclwyuwl", "vwvdvsaingpgl", "vwwpzok", "vwwtrbcnxq",	/* 16840 */
+	"vwxbne", "vwxmbfe", "vwytiefuumrch", "vx",	/* 16844 */
+	"vxayxoq", "vxcabxgfhkmg", "vxck", "vxcm",	/* 16848 */
+	"vxfziaerwziclt", "vxgssuy", "vxgxgivi", "vxhwxrrildvabp",	/* 16852 */
+	"vxjsetqt", "vxkbtcnl", "vxmtbv", "vxmzysmyv",	/* 16856 */
+	"vxncngmjqdyf", "vxnypapxwor", "vxozzey", "vxpmws",	/* 16860 */
+	"vxpwzfss", "vxqzloykc", "vxrhslfyvggjzn", "vxrqohgdarutn",	/* 16864 */
+	"vxsyevfmmqev", "vxvgfaktuyg", "vxwz", "vxzrkswia",	/* 16868 */
+	"vy", "vyaaggjynb", "vyamfzbeicx", "vyayn",	/* 16872 */
+	"vybau", "vybmelem", "vybpkkuhnpkwag", "vybqvnrsp",	/* 16876 */
+	"vybtbfgh", "vybtq", "vybwiwhzlthyxt", "vydka",	/* 16880 */
+	"vydnveqoj", "vyehp", "vyfeauzq", "vyfreiswwn",	/* 16884 */
+	"vyjqeprphp", "vylhl", "vylie", "vylnwtnmgmprc",	/* 16888 */
+	"vymkqgn", "vymrfsvwxa", "vyndgseqyv", "vyodeemwpsos",	/* 16892 */
+	"vyodidrkax", "vyqgdvjpyv", "vyrgt", "vyrpgrggj",	/* 16896 */
+	"vytbjcig", "vytrbojaijenx", "vytzdaimtu", "vywayegrnrm",	/* 16900 */
+	"vywlgnahyj", "vyxiniw", "vyxpvkfyowiaw", "vz",	/* 16904 */
+	"vzad", "vzayazsyf", "vzazulgxyad", "vzdo",	/* 16908 */
+	"vzdob", "vze", "vzeftvqz", "vzgfgilwkl",	/* 16912 */
+	"vzhzsmnabmna", "vzjumxumjn", "vzk", "vzkfucmaq",	/* 16916 */
+	"vzmhneqsocpinx", "vzmrjkpz", "vzocypejtqc", "vzokb",	/* 16920 */
+	"vzrdlw", "vzrftgcprvjx", "vztcmznejmhg", "vztwgptqexhs",	/* 16924 */
+	"vzubsaitaigukg", "vzuciiixhmvsd", "vzumr", "vzvdm",	/* 16928 */
+	"vzvmwjmocrx", "vzwafol", "vzxcutitta", "vzy",	/* 16932 */
+	"wa", "waa", "waayldidlz", "wacaxtpoksn",	/* 16936 */
+	"wacbabrkkzata", "wacfcvbd", "wacknpkamvnq", "wadegerqbmye",	/* 16940 */
+	"waeaoisfkdrfk", "waeeufnzwwa", "waekydif", "waexalhcxwzcgw",	/* 16944 */
+	"wafpkvysslxr", "wahfzufvwr", "wahknrx", "waiflowydtzf",	/* 16948 */
+	"waiol", "wajmcvxoliman", "walnl", "walrprkwlf",	/* 16952 */
+	"wanjhodug", "waorvuziwhwodx", "wapgifvvcsob", "waptkabtejv",	/* 16956 */
+	"waqi", "waqqndlqnnum", "waqtpoi", "warg",	/* 16960 */
+	"warkebvneivo", "waryxuasurbe", "wasftizpm", "wasgceuytublc",	/* 16964 */
+	"wasljgtos", "wasspmhtcqehbr", "wasu", "watmloqwdf",	/* 16968 */
+	"wavesjhklz", "wavlkb", "wax", "waxphbpnsw",	/* 16972 */
+	"wb", "wbaufecgnl", "wbavis", "wbbb",	/* 16976 */
+	"wbbiktbarcu", "wbbrik", "wbcyq", "wbdcpg",	/* 16980 */
+	"wbdsxjkckuayxy", "wbeiornocn", "wbexdpjsmc", "wbgdmd",	/* 16984 */
+	"wbgkmacxlbp", "wbgl", "wbgtm", "wbh",	/* 16988 */
+	"wbhm", "wbitra", "wbjyayv", "wbknkiybnorsn",	/* 16992 */
+	"wbnhnrftecvd", "wbp", "wbqgouei", "wbqiyyzk",	/* 16996 */
+	"wbrwlaysbzqne", "wbsfvdhsgq", "wbsfwpiclrcqeb", "wbsgrekpawbjmy",	/* 17000 */
+	"wbsllfpxfpie", "wbsruf", "wbt", "wbuepc",	/* 17004 */
+	"wbvdzip", "wbvntg", "wbvqbms", "wbzqcziikh",	/* 17008 */
+	"wbztlsifqf", "wc", "wccijbqnh", "wccnfqelxbzyn",	/* 17012 */
+	"wccyg", "wceqthzeivce", "wcflbvglqbj", "wcfmqhvfam",	/* 17016 */
+	"wcfuamjq", "wcfvzqgkl", "wcgzrh", "wchlimwmywotvr",	/* 17020 */
+	"wcifdkec", "wcikwd", "wcjdz", "wcje",	/* 17024 */
+	"wcjhfqqnw", "wcjlzjkiv", "wckbpxpujyaxl", "wckq",	/* 17028 */
+	"wckrtreffh", "wclr", "wcmu", "wcn",	/* 17032 */
+	"wcnuey", "wcq", "wcqradklfe", "wcquoalxlmnz",	/* 17036 */
+	"wcrfat", "wcsmwvvdelotw", "wcsnyhivz", "wcsxmpw",	/* 17040 */
+	"wcsz", "wcvhengkjqscxo", "wcxtryzsfxln", "wd",	/* 17044 */
+	"wda", "wdab", "wdabd", "wdaoziit",	/* 17048 */
+	"wdbkecibshvkmn", "wdboyjuqngwxp", "wdcagpfznx", "wdcefrzmlkea",	/* 17052 */
+	"wdcocmbbmxuu", "wddjrw", "wdhopcbzituyx", "wdhpjo",	/* 17056 */
+	"wdiprcgpmrp", "wdive", "wdlswypkutel", "wdnsklri",	/* 17060 */
+	"wdoofxkjrssw", "wdowakzbb", "wdozxeknrsfag", "wdphezrsuog",	/* 17064 */
+	"wdpwfutq", "wdqhqfnha", "wdqrbmomnc", "wdslltij",	/* 17068 */
+	"wdsocqyuagqy", "wdtca", "wdtcc", "wduswqw",	/* 17072 */
+	"wdvqdwunpxr", "wdwptmkzuxxuvh", "wdwr", "wdx",	/* 17076 */
+	"wdywd", "we", "weaaejsywak", "wechtwkmrdc",	/* 17080 */
+	"weedwcy", "weehuleb", "weejjwahnuuea", "wegi",	/* 17084 */
+	"weimkatcorxwx", "welpnknylnark", "wepujofgeobdj", "wes",	/* 17088 */
+	"wesdih", "wet", "wev", "wewnqyrk",	/* 17092 */
+	"wf", "wfbewhsdrgj", "wfbsziefthahuf", "wfcg",	/* 17096 */
+	"wfcjoqf", "wfdrtfwn", "wfeioxtacosno", "wfelaqdpeud",	/* 17100 */
+	"wff", "wfghoahih", "wfgocxpjw", "wfhdfjwpfvq",	/* 17104 */
+	"wfhogbsvugu", "wfiiktvnfahkce", "wfjfwznof", "wfkg",	/* 17108 */
+	"wfktecik", "wflzlvx", "wfnbilahwu", "wfnzlbk",	/* 17112 */
+	"wforai", "wfpqvmknsuhwvs", "wfqtwyznaxqdhm", "wfrztlobbhe",	/* 17116 */
+	"wfthorq", "wftjhgbduqmk", "wfto", "wfva",	/* 17120 */
+	"wfvbcpvb", "wfwgv", "wfwlrkunuvd", "wfxagi",	/* 17124 */
+	"wfxseifqqish", "wfxz", "wfyjg", "wfzgofdgofyt",	/* 17128 */
+	"wgaacmpibdxs", "wgfgdgclo", "wggyxhufxwavqu", "wghlwz",	/* 17132 */
+	"wghuo", "wgi", "wgilpoth", "wgl",	/* 17136 */
+	"wgljqlokugss", "wglopcrsanpsf", "wgmjvqzb", "wgnbby",	/* 17140 */
+	"wgnqxqwtqt", "wgop", "wgoqlokgazen", "wgpimdqcdlf",	/* 17144 */
+	"wgrkpej", "wgtyovfaygba", "wgumlloecqzk", "wguwdcjuvubnsk",	/* 17148 */
+	"wgvf", "wgwahnity", "wgwflxt", "wgwjqyiwdetwe",	/* 17152 */
+	"wgxrnbzvjrjdi", "wh", "whajcbe", "whfbife",	/* 17156 */
+	"whgacamornp", "whhqciof", "whi", "whicwqkhuztr",	/* 17160 */
+	"whjs", "whjv", "whlitbstipd", "whlmzp",	/* 17164 */
+	"whmalzydzauigd", "whnvkch", "whnzrlkzukeu", "whoolqejczq",	/* 17168 */
+	"whpbmhsfpbymfw", "whpdwgcgxd", "whpmadoebr", "whsiinl",	/* 17172 */
+	"whu", "whwp", "whxiohqsqq", "wi",	/* 17176 */
+	"wiaxem", "wib", "widgeqybluxt", "wiebuzvbejnxf",	/* 17180 */
+	"wif", "wifayuwwqjm", "wiff", "wifs",	/* 17184 */
+	"wihwia", "wiisdtx", "wil", "wilhyjtgmj",	/* 17188 */
+	"wilwwzt", "wimrs", "wimuf", "win",	/* 17192 */
+	"wiovhvamdxm", "wioymgjhiofjy", "wiqjeni", "wirtfx",	/* 17196 */
+	"wisw", "witlvwlmyfm", "wivkdkfktjpicv", "wivwztjwez",	/* 17200 */
+	"wiwsa", "wiwtdebboc", "wizbtj", "wj",	/* 17204 */
+	"wjabecaxbmjol", "wjafmhcaoch", "wjcl", "wjcwuyzzwhfnaw",	/* 17208 */
+	"wjdtahicgm", "wjecxmz", "wjemae", "wjfw",	/* 17212 */
+	"wjfyeditezf", "wjghdnfdt", "wjgsqd", "wjihaqrd",	/* 17216 */
+	"wjipvgtyhixyey", "wjiufcf", "wjlfdgggqzcv", "wjmbwojfvese",	/* 17220 */
+	"wjnapudjdpvd", "wjnzwgccmdub", "wjofecrr", "wjqrybjuzms",	/* 17224 */
+	"wjrj", "wjs", "wjuumdldjey", "wjuywk",	/* 17228 */
+	"wjvg", "wjvgkfnf", "wjvlprvbplqtez", "wjvuajk",	/* 17232 */
+	"wjwkhaibb", "wjxdxzdqc", "wjyzafu", "wjzcjfoyzltnq",	/* 17236 */
+	"wjzghyuc", "wjzkxvbpjruwfg", "wk", "wkab",	/* 17240 */
+	"wkajhcviwkav", "wkfqxlxyjuxpj", "wkgl", "wkgp",	/* 17244 */
+	"wkhujoyuqlk", "wkhux", "wkijx", "wkjctwa",	/* 17248 */
+	"wkkssfclrbbt", "wklvq", "wklwmpybys", "wkn",	/* 17252 */
+	"wkoyzhtz", "wkq", "wkqfpcb", "wkrqqqxpsmvnmi",	/* 17256 */
+	"wkszgbkx", "wku", "wkv", "wkwhlas",	/* 17260 */
+	"wkxbirklpqjc", "wky", "wl", "wlainkqoyenpx",	/* 17264 */
+	"wlaoqtkm", "wlap", "wlc", "wlcirgnfsneshm",	/* 17268 */
+	"wlcmnnakfp", "wlcqpctn", "wldktamyg", "wletzl",	/* 17272 */
+	"wlfmkqxjj", "wlg", "wliio", "wljlqtu",	/* 17276 */
+	"wlk", "wlkyz", "wll", "wlnkoydu",	/* 17280 */
+	"wlnvqivn", "wlpjrsrgdgj", "wlpsw", "wlpxlsf",	/* 17284 */
+	"wlrgnwqabjllmk", "wlrxpmmskifmul", "wltozpsb", "wluksyaxujhg",	/* 17288 */
+	"wlve", "wlvpfksvstt", "wlxybevluwrvis", "wlyyowsmclsu",	/* 17292 */
+	"wm", "wmafcudses", "wmasqpv", "wmbd",	/* 17296 */
+	"wmfe", "wmgsp", "wmhkdljrptwr", "wmipyl",	/* 17300 */
+	"wmiquilvbawvsx", "wmjqtqdwfhqrc", "wmkuujua", "wmlataub",	/* 17304 */
+	"wmlx", "wmmlp", "wmmzi", "wmndsvgfajrq",	/* 17308 */
+	"wmnmqnioksa", "wmqpjfoahsk", "wmqvsfpgxuei", "wmrhnwqwbni",	/* 17312 */
+	"wmrhprnumbfw", "wmsifpzqkioaio", "wmsxhk", "wmtlxnpon",	/* 17316 */
+	"wmufauf", "wmugkqhxtfekb", "wmurjzu", "wmutrnhqmpxk",	/* 17320 */
+	"wmvmdioak", "wmvugzzjnbtqz", "wmvxtwbz", "wmwqfhnefooxk",	/* 17324 */
+	"wmyvtsc", "wn", "wnb", "wnbhsdy",	/* 17328 */
+	"wnc", "wndtckegpnkwgq", "wngot", "wnhanbwshbli",	/* 17332 */
+	"wnhsxyuclcqaap", "wniyjiumxtk", "wnkfhgj", "wnkrt",	/* 17336 */
+	"wnlbproqcjwkez", "wnlqigh", "wnmbpmwxei", "wnnishwk",	/* 17340 */
+	"wnocztqm", "wnopwnyy", "wnpjhfoihfr", "wnpwgn",	/* 17344 */
+	"wnrqdphi", "wntcl", "wnu", "wnvvlvrovia",	/* 17348 */
+	"wnwlvabmdibb", "wnwzktyv", "wnyhhq", "wnyhssfhxlbn",	/* 17352 */
+	"wnytler", "wo", "woawrvnbzbmvbu", "wob",	/* 17356 */
+	"wobkkndasf", "wod", "wodgasz", "wodkksqqftbvr",	/* 17360 */
+	"wodktd", "wodmgsx", "wodpafdqsrdu", "woefxxtuvggzm",	/* 17364 */
+	"wofq", "wofqipzaaw", "wogt", "wohhrpptdiyran",	/* 17368 */
+	"woicdwjjyzgpx", "woiiqptemraky", "woiuevfs", "wokmmqa",	/* 17372 */
+	"womtn", "woozxs", "woqipzd", "worlnkvnc",	/* 17376 */
+	"worwtreoorwz", "woryhdgteryee", "woss", "wossvigqpuo",	/* 17380 */
+	"wosxmjdxylojd", "wott", "wouha", "wowfsfgjqpg",	/* 17384 */
+	"woxcevlpko", "woyrfwzz", "wp", "wparp",	/* 17388 */
+	"wpbeq", "wpcvcuzr", "wpdgwkqn", "wpfxqjerox",	/* 17392 */
+	"wpgaqxfg", "wpgcg", "wphukjqklgnrd", "wpi",	/* 17396 */
+	"wpjytzhrazqbai", "wpkegczippoko", "wplgf", "wpm",	/* 17400 */
+	"wppijlvdfzntz", "wpqfles", "wprbftgpzim", "wpreww",	/* 17404 */
+	"wprqtishwwgqky", "wprvkdusgewwyd", "wpuovrgdkuxan", "wpvhe",	/* 17408 */
+	"wpvxp", "wpw", "wpwd", "wpycb",	/* 17412 */
+	"wpzflv", "wq", "wqalzlwdm", "wqbjecsjpk",	/* 17416 */
+	"wqbuvoxfp", "wqcbgfrxnhfoi", "wqfv", "wqgthzkcui",	/* 17420 */
+	"wqgypoznvupaqx", "wqhiavciwmfiy", "wqjgjabcsij", "wqjiazou",	/* 17424 */
+	"wqnlmvzl", "wqoaxbibwb", "wqosml", "wqovvhpocxmna",	/* 17428 */
+	"wqpb", "wqpbxmnomk", "wqpqzglsjcu", "wqqun",	/* 17432 */
+	"wqr", "wqsepfqxghmom", "wqskzdnqyko", "wqtnmatfjtfpn",	/* 17436 */
+	"wquy", "wqvm", "wqzj", "wr",	/* 17440 */
+	"wra", "wrc", "wrdcov", "wrdxwhtyyddp",	/* 17444 */
+	"wrecfjutgb", "wretlqsfjquvn", "wrgaaptn", "wrhfocvf",	/* 17448 */
+	"wrji", "wrldrnfhnesvuu", "wrltrgrm", "wrlvefrm",	/* 17452 */
+	"wrnd", "wrnvc", "wrplnhtgrtgv", "wrqiwvir",	/* 17456 */
+	"wrqpazl", "wrqz", "wrt", "wrtkxghjsbk",	/* 17460 */
+	"wru", "wruc", "wruga", "wrutruab",	/* 17464 */
+	"wrwlk", "wrxjcdqq", "wryhhjcsbdeohf", "ws",	/* 17468 */
+	"wsdobvn", "wser", "wsfer", "wsgmsoemw",	/* 17472 */
+	"wsgsplwzpibezo", "wshrib", "wsiedxxqec", "wsikaenb",	/* 17476 */
+	"wsjuxsikrogkr", "wsjyircbstayjb", "wskcp", "wskkcung",	/* 17480 */
+	"wsktqpjh", "wsmkqectwaspis", "wsnuidsif", "wsoouzrj",	/* 17484 */
+	"wspiz", "wsrqglf", "wssh", "wssjnoscsel",	/* 17488 */
+	"wstem", "wsxnnveuo", "wsym", "wszmawazeyzlpc",	/* 17492 */
+	"wt", "wtbacyn", "wtdb", "wteasyn",	/* 17496 */
+	"wteqdssdfppy", "wtfqcytbtjqn", "wtgcejpjkmv", "wthjowfx",	/* 17500 */
+	"wthtvv", "wthwiartjsctkv", "wtkudewh", "wtm",	/* 17504 */
+	"wtnj", "wtnmqwpz", "wtnvgibaj", "wtod",	/* 17508 */
+	"wtrbusnveypupa", "wtrskkc", "wtswckhjfz", "wttnf",	/* 17512 */
+	"wtudmrdu", "wtupnjugyafasj", "wtvpqz", "wtvqlfatsqrdt",	/* 17516 */
+	"wtwdhhofrgahq", "wtwrgsnrtawn", "wtxj", "wtzsqgg",	/* 17520 */
+	"wtzwtrraako", "wu", "wuardjqxkyrus", "wube",	/* 17524 */
+	"wubiphv", "wubuwl", "wucgz", "wueiov",	/* 17528 */
+	"wugshkciyjkuxt", "wuh", "wuidec", "wuil",	/* 17532 */
+	"wuiojmfwneuglu", "wuiypct", "wujhif", "wujjfeuul",	/* 17536 */
+	"wujph", "wukfj", "wukfq", "wunnibgx",	/* 17540 */
+	"wuoaudchjrgxv", "wup", "wuq", "wuqavnpyubr",	/* 17544 */
+	"wur", "wuriffgrpoaazo", "wuscqopavv", "wusvyngwojnk",	/* 17548 */
+	"wutjqkestitb", "wutmlibkx", "wuutsysgau", "wuwrvdmfjdv",	/* 17552 */
+	"wuxvoayxviyz", "wuygc", "wuyo", "wuypeepxqssanl",	/* 17556 */
+	"wuznvsonklm", "wv", "wvayeviseq", "wvbhx",	/* 17560 */
+	"wvcdrztyddr", "wvdguwvvw", "wvdraebojo", "wvfglbqsgqsa",	/* 17564 */
+	"wvfnjf", "wvfoolndonti", "wvgtbtozivvoop", "wvhomhlw",	/* 17568 */
+	"wvhtfwzas", "wvk", "wvklnlygats", "wvlsylq",	/* 17572 */
+	"wvoybo", "wvpluzjrjwhrzb", "wvqetdjcdfqyc", "wvtnsxkolqg",	/* 17576 */
+	"wvudhpzonpdkrl", "wvvcgsxrtvyj", "wvwtpui", "wvxg",	/* 17580 */
+	"wvxgdtedrdai", "wvxxnjufdmqqat", "wvzmvbljeu", "wvzo",	/* 17584 */
+	"wvzzshxb", "ww", "wwaswiyuxtuci", "wwb",	/* 17588 */
+	"wwgihek", "wwgswoludcawxs", "wwhmz", "wwi",	/* 17592 */
+	"wwifpdrqmnmfwu", "wwixhlkfld", "wwjcwvwhxmx", "wwjfxtdahz",	/* 17596 */
+	"wwkrzf", "wwlswjyxtjdin", "wwnoruyvx", "wwnxegxwjha",	/* 17600 */
+	"wwozivubc", "wwraxudzamjdu", "wwrbwrudvdrry", "wwsfrxwfhq",	/* 17604 */
+	"wwtj", "wwuwrkw", "wwxxdwuyay", "wwyyvpqsi",	/* 17608 */
+	"wx", "wxbxhbjxvxlf", "wxcynt", "wxdy",	/* 17612 */
+	"wxe", "wxeaicyognmid", "wxebmrl", "wxefouueef",	/* 17616 */
+	"wxenuuhig", "wxexd", "wxfacpuvygud", "wxftwxsempt",	/* 17620 */
+	"wxjjrtjnr", "wxjnrmhauqgsf", "wxkn", "wxmbho",	/* 17624 */
+	"wxmhlbh", "wxog", "wxoi", "wxolzidgcziww",	/* 17628 */
+	"wxpjp", "wxr", "wxtekf", "wxuquumqbpm",	/* 17632 */
+	"wxvstt", "wxxhytuuomzqeh", "wxygru", "wxyroycfuxh",	/* 17636 */
+	"wy", "wyazgins", "wyctjkwfymuld", "wyctsucdjfojr",	/* 17640 */
+	"wydfec", "wye", "wyfiwfkmvt", "wyfohlnb",	/* 17644 */
+	"wyfzbxkddm", "wygezlycmleys", "wygxmuomomaq", "wygyxrlu",	/* 17648 */
+	"wyihxp", "wyiyip", "wyiyondsqfjg", "wymzc",	/* 17652 */
+	"wyoiyqx", "wypgrdcgrcu", "wytkh", "wytypkfxm",	/* 17656 */
+	"wyujl", "wyum", "wyuycn", "wyvln",	/* 17660 */
+	"wywcmmqbbay", "wywi", "wyxnsg", "wyydyosbayd",	/* 17664 */
+	"wyzgi", "wz", "wzanlbmzjxfbko", "wzaxw",	/* 17668 */
+	"wzbvrakqak", "wzcatzvzbglsj", "wzecikgikmww", "wzedeejmbzgck",	/* 17672 */
+	"wzgwska", "wzhww", "wzisqyfzcicvq", "wzjpz",	/* 17676 */
+	"wzjwwjxqaidtbx", "wzjzgeonyxp", "wzkhcdnxnuu", "wzl",	/* 17680 */
+	"wzljl", "wzlundlncjuz", "wznfdfsdxofea", "wzonwrr",	/* 17684 */
+	"wzorq", "wzpfsqzyvdh", "wzpv", "wztzfndp",	/* 17688 */
+	"wzugyhv", "wzwe", "wzwjgex", "wzy",	/* 17692 */
+	"wzyck", "xa", "xaakcv", "xaalzzucyeghc",	/* 17696 */
+	"xaaplzbjfc", "xacbtqvke", "xafan", "xafjpc",	/* 17700 */
+	"xahftwbiw", "xahubwlcvkab", "xaigmpjo", "xaiujnwztjq",	/* 17704 */
+	"xajmmcsevxdq", "xakfekhnsfwp", "xalan", "xanjihkow",	/* 17708 */
+	"xapshy", "xapzhyoepoufb", "xaq", "xaqbqkcwlenpz",	/* 17712 */
+	"xaqnb", "xarahgpwgxuxi", "xarnmuxp", "xasambocoejrt",	/* 17716 */
+	"xatfnewfhpgfae", "xavcvzigbtdeou", "xawluiqvixtb", "xaxpzoyxiwnrwz",	/* 17720 */
+	"xaxzabw", "xaz", "xazqyqes", "xb",	/* 17724 */
+	"xbbadjod", "xbbzq", "xbcldmshaejmvl", "xbcsbubsla",	/* 17728 */
+	"xbdhidemkc", "xbf", "xbfrmzvvp", "xbgiekytgvvb",	/* 17732 */
+	"xbhiauqxn", "xbjmakkjsz", "xbjoqwluae", "xbkrnpdpyqtwh",	/* 17736 */
+	"xblil", "xblpshzzxcxfh", "xbmgzfl", "xbnervga",	/* 17740 */
+	"xbogecpuxxvb", "xbpapytbmb", "xbqpiximcgyr", "xbrjjcwyss",	/* 17744 */
+	"xbrofdxewafwoz", "xbs", "xbt", "xbtdzgmtkwf",	/* 17748 */
+	"xbu", "xbwcmyp", "xbxqvuy", "xbykkowlsoik",	/* 17752 */
+	"xbyrgxgwgjfo", "xbzoaqvhjfnwzz", "xc", "xcapjznz",	/* 17756 */
+	"xcapxdbtz", "xcb", "xccbwknwssjxxb", "xcdrsgsnvywbz",	/* 17760 */
+	"xcduhzygoq", "xcf", "xcffvljzgtjgao", "xcfgg",	/* 17764 */
+	"xcfmfjyt", "xcfmlcazsphcan", "xcgl", "xchqrtzzit",	/* 17768 */
+	"xcjjlhkbadkzeh", "xck", "xckwzssurnlvvv", "xcnyhz",	/* 17772 */
+	"xcoy", "xcpb", "xcpcrysnrzwli", "xcrellfjpxtmp",	/* 17776 */
+	"xctffrk", "xcthulyruswrq", "xcuknemlyqsp", "xcv",	/* 17780 */
+	"xcvcpae", "xcw", "xcwtmgrushop", "xcxack",	/* 17784 */
+	"xcytvoyyo", "xczhz", "xczvbm", "xd",	/* 17788 */
+	"xdbbnzgsuid", "xdbg", "xdbnr", "xdcb",	/* 17792 */
+	"xdcqgqbf", "xdczzxhjwiqnh", "xddkltyp", "xde",	/* 17796 */
+	"xdetyf", "xdiy", "xdj", "xdjymyohm",	/* 17800 */
+	"xdkpqyc", "xdlal", "xdllyftpf", "xdlqgymm",	/* 17804 */
+	"xdmlhwfk", "xdn", "xdnke", "xdosvth",	/* 17808 */
+	"xdowlcoxus", "xdp", "xdrcnuk", "xdrs",	/* 17812 */
+	"xdtcwgiedo", "xdustsjhbgaev", "xduwgyp", "xduwmvohjw",	/* 17816 */
+	"xdvapwxujdrmd", "xdvzzjq", "xdw", "xdwmxmvlqqli",	/* 17820 */
+	"xebrrrsoysm", "xecihwisfon", "xedinlt", "xef",	/* 17824 */
+	"xefgqquqfivymy", "xehg", "xehh", "xehhjznbkeqd",	/* 17828 */
+	"xeiaxdcpfd", "xeiqkrtsf", "xeizmzd", "xek",	/* 17832 */
+	"xekllwluzyxmt", "xel", "xelhnuiyil", "xemno",	/* 17836 */
+	"xencn", "xenzmguajtyr", "xeorvh", "xepzpbbgxopqtg",	/* 17840 */
+	"xeslethm", "xeuu", "xevnynnycojq", "xex",	/* 17844 */
+	"xexbgfhevh", "xexcbigmctnns", "xezvegubzfsbt", "xf",	/* 17848 */
+	"xfacntbrgrnl", "xfamcepl", "xfbahpydqivgk", "xfbj",	/* 17852 */
+	"xfbseyyfom", "xfbtf", "xfcpde", "xfcr",	/* 17856 */
+	"xfctssmtcjh", "xfgnkre", "xfhcpkxrdb", "xfhjwel",	/* 17860 */
+	"xfhvdgdgxuhbn", "xfiggq", "xfikapas", "xfilso",	/* 17864 */
+	"xfitrdz", "xfkz", "xflnxh", "xfmd",	/* 17868 */
+	"xfnccxpcmwynnx", "xfnwc", "xfnyhqq", "xfoha",	/* 17872 */
+	"xfon", "xfp", "xfpitjns", "xfq",	/* 17876 */
+	"xfrbwswv", "xfsosxetioqf", "xftedtttqxmq", "xftse",	/* 17880 */
+	"xfugdf", "xfuymsvviw", "xfw", "xfxnbzntwjb",	/* 17884 */
+	"xfydxcbfclb", "xgai", "xgbncbgaqru", "xgbxigdo",	/* 17888 */
+	"xgbzim", "xgcnwvhugn", "xgcyowyoft", "xgdwxgqkwzm",	/* 17892 */
+	"xgeo", "xgeuotgosx", "xgiyxqak", "xgjp",	/* 17896 */
+	"xgksv", "xglavappo", "xglqhrh", "xglyubvznz",	/* 17900 */
+	"xguyl", "xgvbhj", "xgxjbhglbxfh", "xgzxaxvqsxu",	/* 17904 */
+	"xh", "xhadfauda", "xhbtsejdvzxnkt", "xhdnzcpji",	/* 17908 */
+	"xhdthu", "xhehwvs", "xhfhiyjwybmyx", "xhfkntz",	/* 17912 */
+	"xhgkziry", "xhgwersmeswefl", "xhgyutnsvwwuue", "xhioratppdmo",	/* 17916 */
+	"xhjxhnfna", "xhkfrf", "xhkkuzf", "xhlbynzbpn",	/* 17920 */
+	"xhlgpir", "xhlnrw", "xhlqyiro", "xhmbbcmebdevpo",	/* 17924 */
+	"xhpxmaqid", "xhqamztxwkdrg", "xhqxmhl", "xhrkvkhahizcbe",	/* 17928 */
+	"xhsejouyqrswx", "xhssma", "xhstpjfldtlgt", "xhszytwer",	/* 17932 */
+	"xhuehz", "xhukviawjwsbi", "xhvdyu", "xhweizrxpmqjbk",	/* 17936 */
+	"xhxcnvczplspsz", "xhxnanmn", "xhyjmrt", "xhzbbicxjydaxc",	/* 17940 */
+	"xhzpvofdbvjt", "xiamxqmeftidn", "xiaprbdhxo", "xices",	/* 17944 */
+	"xicszmmia", "xid", "xidezqoctwxf", "xidhgchgtso",	/* 17948 */
+	"xidr", "xiex", "xieznwozknk", "xifwld",	/* 17952 */
+	"xifwwiubcjpvr", "xiimov", "xiivpstljwje", "xijnb",	/* 17956 */
+	"xildjzo", "xilfvrdqry", "xilfwsznogckw", "ximftmrcb",	/* 17960 */
+	"ximtquhr", "ximzqznqvx", "xipx", "xiq",	/* 17964 */
+	"xiquhygrvad", "xiqvc", "xiqx", "xirbcxeblv",	/* 17968 */
+	"xit", "xiuzhdbj", "xivfmyfdr", "xivg",	/* 17972 */
+	"xivry", "xiztf", "xj", "xjbqyzddg",	/* 17976 */
+	"xjbzscdyu", "xjcsp", "xjcxvjnisucvkx", "xjd",	/* 17980 */
+	"xjdunrrxirw", "xjebp", "xjetx", "xjfaeonmdy",	/* 17984 */
+	"xjfavul", "xjfjjfrtiobdvb", "xjhrkib", "xjhxmeat",	/* 17988 */
+	"xjkffb", "xjkopmotjpvii", "xjltlsrq", "xjme",	/* 17992 */
+	"xjmmnstgk", "xjnfu", "xjoguurvqkvina", "xjpcusfts",	/* 17996 */
+	"xjqdysjfbsd", "xjqmyfswvdv", "xjqu", "xjsgtb",	/* 18000 */
+	"xjt", "xjtav", "xjtuclkydmz", "xjwfmdhlzo",	/* 18004 */
+	"xjwhpmoxdceo", "xjygvnoaieykp", "xjzlhkdhls", "xjznu",	/* 18008 */
+	"xk", "xkaygjghzprzyx", "xkbipdy", "xkbrpgyriefo",	/* 18012 */
+	"xkcof", "xkddhgrckge", "xkdkjumlxbtun", "xkg",	/* 18016 */
+	"xkh", "xkhbqttquxu", "xkhgeesq", "xkhordfdalph",	/* 18020 */
+	"xkhylrbydunuu", "xkiqetn", "xkiscfaromniud", "xkjiflvqxxlc",	/* 18024 */
+	"xklwijjmhzrgch", "xkmad", "xknukerxtehov", "xkomtkf",	/* 18028 */
+	"xkpn", "xkprdteebkk", "xkqjcvctjakzu", "xkqpkmrb",	/* 18032 */
+	"xkvezxhbfbck", "xkvmkavmnn", "xkvnittpeo", "xkxslbekkejynr",	/* 18036 */
+	"xkydodrwyqm", "xkynzkrdva", "xkyqxucvqiyyll", "xkywmsxtslzp",	/* 18040 */
+	"xkzhswcyedcff", "xl", "xlazthazvwo", "xlcsaznmpjsef",	/* 18044 */
+	"xlcxcmjoyba", "xldnmbdtbdozb", "xlftyvsfbtx", "xlge",	/* 18048 */
+	"xljsrxvktta", "xlnoyptqia", "xlokulv", "xlooun",	/* 18052 */
+	"xlqbxf", "xlqsj", "xlqvlidstx", "xlrgbaekm",	/* 18056 */
+	"xlsjlyhmnsnpbm", "xlsukyqtefd", "xltgamybcptx", "xluv",	/* 18060 */
+	"xlvecdir", "xlwlgadumst", "xlxnzqor", "xlyuwjjjtzy",	/* 18064 */
+	"xlzfbhvbqqjsf", "xlzpqirrekj", "xm", "xmayfdrqbxd",	/* 18068 */
+	"xmc", "xmceztio", "xmcokiubutbdrg", "xmeskixmxkeaa",	/* 18072 */
+	"xmf", "xmfblfkiv", "xmfggqevy", "xmhqfljfuwiema",	/* 18076 */
+	"xmkgtikvaafuv", "xmksayqljfynl", "xmkxblihwmllb", "xmlvnmbci",	/* 18080 */
+	"xmmdlejxr", "xmmeb", "xmmywkso", "xmncpm",	/* 18084 */
+	"xmnqgu", "xmoruwemcqbf", "xmpdcj", "xmrny",	/* 18088 */
+	"xmrzocwbb", "xmsx", "xmvhcegke", "xmwpmfqh",	/* 18092 */
+	"xmyyjubumtqo", "xn", "xnccxvrcbp", "xnczksy",	/* 18096 */
+	"xndgsotgprj", "xndxylksmetsmb", "xnehoqb", "xnepbnk",	/* 18100 */
+	"xnhy", "xnhychuu", "xnkd", "xnlkbjnhixidw",	/* 18104 */
+	"xnlqcmfa", "xnlwhplbcyt", "xnmeudipfwzwbr", "xnmjd",	/* 18108 */
+	"xnnhhamswh", "xnnvhpasdybvrq", "xnojuwypct", "xnooovt",	/* 18112 */
+	"xnoz", "xnpdmohzcgd", "xnplpfyrug", "xnqimcv",	/* 18116 */
+	"xnrapsilwyuae", "xnrjqgdmkpecb", "xns", "xnsrifgm",	/* 18120 */
+	"xntxkuwe", "xnudlvtxojivi", "xnvzuzuvwbcl", "xnwgsbstsykxb",	/* 18124 */
+	"xnwkzhw", "xnwugwslvkpa", "xnxkwzme", "xnyiypk",	/* 18128 */
+	"xnywq", "xo", "xoakhd", "xoapoxfgjlst",	/* 18132 */
+	"xob", "xoc", "xocxgfmiererr", "xodvst",	/* 18136 */
+	"xoejobe", "xoeykz", "xohtkktkdejz", "xoirnhq",	/* 18140 */
+	"xojhysjvwylpqk", "xojum", "xok", "xokpzi",	/* 18144 */
+	"xoljbrpfijnjo", "xomdfr", "xopfasuoipzxsy", "xopfruqhwbf",	/* 18148 */
+	"xopje", "xoqddr", "xoqk", "xoraceaxrvba",	/* 18152 */
+	"xordbzfzjws", "xorkdb", "xorqamfp", "xosh",	/* 18156 */
+	"xoti", "xotoredmgxh", "xotylgkyz", "xougyg",	/* 18160 */
+	"xouuhfrsge", "xowazitgy", "xowbqp", "xoyaut",	/* 18164 */
+	"xoybsqysmmmqo", "xp", "xpacsdppf", "xpbtgmwxpdbmil",	/* 18168 */
+	"xpc", "xpcitdvlnzs", "xpczjfwoicy", "xpdcwrryiivc",	/* 18172 */
+	"xpdel", "xpe", "xpfjw", "xphkkjdzqnatag",	/* 18176 */
+	"xphubteccpnkc", "xpjpwrg", "xpkkno", "xpl",	/* 18180 */
+	"xplnyzubqq", "xplpuyvxg", "xplwdokahj", "xplwthn",	/* 18184 */
+	"xpocfiqaznjsrs", "xppuvirxycctnv", "xppwjnitlah", "xpqxzusxjxx",	/* 18188 */
+	"xprgklbe", "xprjslmmt", "xpspoyzayeixnh", "xptjewzwlw",	/* 18192 */
+	"xpvtlsgwri", "xpwjtqje", "xpxgizdbcdtr", "xpzgedvolcmqp",	/* 18196 */
+	"xpzyoxiyt", "xq", "xqakxrhwvjafjw", "xqdmdbxk",	/* 18200 */
+	"xqff", "xqgarknthnmq", "xqgsizvtjrdhnb", "xqif",	/* 18204 */
+	"xqirudrnpavop", "xqjqxi", "xqlnurkbrz", "xqmnojdvnmk",	/* 18208 */
+	"xqmylewbzfzo", "xqnkwzijev", "xqohhpfmkjucs", "xqqaymtwaxtkol",	/* 18212 */
+	"xqsxeqdcjtl", "xqtakhbambzp", "xquagmnqckmckf", "xqubuwebsu",	/* 18216 */
+	"xqvpiuyjl", "xqvqjk", "xqwgtqkxcfdnnr", "xqwpvsmf",	/* 18220 */
+	"xqxhvismphthd", "xqxkpkjm", "xqxtxi", "xqxzjijjyidta",	/* 18224 */
+	"xqzd", "xr", "xranckeff", "xrc",	/* 18228 */
+	"xrfpi", "xrgquxyfmphi", "xrhoddqa", "xrjjgaiu",	/* 18232 */
+	"xrkpjrz", "xrkrgxyiffuro", "xrl", "xrlaf",	/* 18236 */
+	"xrne", "xrnuwxqse", "xrowz", "xrpcfxkxofby",	/* 18240 */
+	"xrpmequgb", "xrq", "xrqiuntdek", "xrqlwte",	/* 18244 */
+	"xrqmtsyyyaus", "xrrvfjyuxjiqq", "xrshbm", "xrsx",	/* 18248 */
+	"xrtznuusckork", "xruunczeoq", "xrwj", "xrxa",	/* 18252 */
+	"xryk", "xrynuihlvhqoc", "xrynwhscjeo", "xrysmwzpwfw",	/* 18256 */
+	"xrzgllbl", "xs", "xsa", "xsd",	/* 18260 */
+	"xsdtx", "xsejvabpnqrte", "xsems", "xsfiilr",	/* 18264 */
+	"xsfmurezzd", "xsg", "xsgp", "xsgyuuvjjynjch",	/* 18268 */
+	"xshfcbblszk", "xsiis", "xsjtydgz", "xskfz",	/* 18272 */
+	"xskn", "xsmf", "xsn", "xspmddvlop",	/* 18276 */
+	"xspnccb", "xspqdu", "xspqhbiima", "xsrbtyxrrzchwr",	/* 18280 */
+	"xsvmhadn", "xswlhidfgslp", "xsxojlhpet", "xsyd",	/* 18284 */
+	"xszidnq", "xt", "xtbjqpeu", "xtbzdrvi",	/* 18288 */
+	"xtdyxsllpmqdj", "xtekaxfvmm", "xtemqh", "xtemtrsyvakmr",	/* 18292 */
+	"xtepbnowaa", "xtie", "xtkck", "xtkzf",	/* 18296 */
+	"xtmmxfziz", "xtoe", "xtqjhrwnooqrjf", "xtqr",	/* 18300 */
+	"xtqrin", "xtqv", "xtsqpnkkcjxie", "xtvo",	/* 18304 */
+	"xtvwjxg", "xtwcpriluiqh", "xtxbanjade", "xtxyavgnf",	/* 18308 */
+	"xtz", "xtzshpvzxxd", "xtzuwpt", "xu",	/* 18312 */
+	"xuab", "xualidhfhh", "xudoiltputo", "xuefzammr",	/* 18316 */
+	"xuehldduyi", "xueugjutorto", "xufn", "xuguerogtjnkm",	/* 18320 */
+	"xuh", "xukztocaaaort", "xunb", "xunjxkcjtwennx",	/* 18324 */
+	"xunpcq", "xunpugdgtis", "xuoezhqjhl", "xuoj",	/* 18328 */
+	"xur", "xusgwwf", "xusmwbiktdn", "xuvfbe",	/* 18332 */
+	"xuvgycsvfxc", "xuvpb", "xuwwzekvg", "xuyjvppobmlj",	/* 18336 */
+	"xuykapilqiio", "xuymundivzunf", "xuzwhguim", "xv",	/* 18340 */
+	"xvaldnecwnhv", "xvbfodxpw", "xvcxoycygxgzea", "xvdzjazeqap",	/* 18344 */
+	"xvewqleoow", "xveyeawhacqupv", "xvfaqqg", "xvfzuzsv",	/* 18348 */
+	"xvgbbn", "xvghqmpxspq", "xvgrwndvb", "xvhcqehutrufsg",	/* 18352 */
+	"xvhugyd", "xvkaucrds", "xvlck", "xvlgmzurmpcmp",	/* 18356 */
+	"xvmqubqspxxdh", "xvn", "xvnyuexil", "xvocucf",	/* 18360 */
+	"xvodljlmxpapbj", "xvpadajfdo", "xvpfudz", "xvpwdmubgdqjk",	/* 18364 */
+	"xvsmrui", "xvucypftjotkzq", "xvukvsjl", "xvut",	/* 18368 */
+	"xvuufmbim", "xvwde", "xvyhxer", "xvyicjo",	/* 18372 */
+	"xvymurr", "xw", "xwadgtxtjytcpj", "xwcoyhmqbikc",	/* 18376 */
+	"xwewshg", "xwfk", "xwfsiet", "xwgbpymvcc",	/* 18380 */
+	"xwgwclpzzdgzex", "xwhn", "xwi", "xwjsho",	/* 18384 */
+	"xwjusm", "xwjw", "xwkaqpvokajsn", "xwlfattz",	/* 18388 */
+	"xwncc", "xwoqfemmevg", "xwqmo", "xwrfejxjdc",	/* 18392 */
+	"xwrq", "xwsg", "xwsrru", "xwvecmbaecx",	/* 18396 */
+	"xwvfafqtul", "xwvktealyfhhwp", "xwxcpxhuuju", "xwxewaewykpkd",	/* 18400 */
+	"xwzjvixlljnm", "xx", "xxbcw", "xxbmhv",	/* 18404 */
+	"xxbyx", "xxcnzo", "xxcvvxgjivd", "xxdeb",	/* 18408 */
+	"xxdi", "xxfqmo", "xxgzldedlej", "xxit",	/* 18412 */
+	"xxjawwpc", "xxjljixy", "xxjsb", "xxkxblqof",	/* 18416 */
+	"xxmhvtiyckcdn", "xxnbzmgitc", "xxnojwyh", "xxnsgbttk",	/* 18420 */
+	"xxntnzkxfo", "xxnuelmhy", "xxo", "xxoosptbtpjke",	/* 18424 */
+	"xxpeody", "xxqdun", "xxsxcxzbbdwi", "xxudaxxxs",	/* 18428 */
+	"xxv", "xxvex", "xxvihh", "xxwsxnzfrz",	/* 18432 */
+	"xxxkjhugmr", "xxyop", "xxyrfbw", "xxyrh",	/* 18436 */
+	"xy", "xybbmkoxygb", "xybdnglz", "xyd",	/* 18440 */
+	"xyefsiyeimhkmb", "xyegd", "xyfj", "xyizricymbsr",	/* 18444 */
+	"xyjah", "xymppxb", "xynbdepodvfav", "xyojipyhkgvqrr",	/* 18448 */
+	"xyrxa", "xytetjayqswfo", "xytiztbi", "xytnlmgpflbjdb",	/* 18452 */
+	"xytssr", "xyvamzs", "xyvki", "xywfsttyfpzqp",	/* 18456 */
+	"xywqldoi", "xyx", "xyxecclajlu", "xyymfcixmwoubu",	/* 18460 */
+	"xyyoxidrr", "xyzraqjxnfmn", "xzafmitufghw", "xzaqktv",	/* 18464 */
+	"xzatomr", "xzb", "xzcqqvft", "xze",	/* 18468 */
+	"xzeyrobcp", "xzffsb", "xzfldskocwq", "xzfxogjyzp",	/* 18472 */
+	"xzghvwlztxugf", "xzjdlwg", "xzlczju", "xznuuxdap",	/* 18476 */
+	"xznuycss", "xzo", "xzqy", "xzs",	/* 18480 */
+	"xzsvtgu", "xztvndx", "xzuefjtocaiyu", "xzuglocxy",	/* 18484 */
+	"xzvdak", "xzxwsrngxnvl", "xzzf", "xzzg",	/* 18488 */
+	"ya", "yaaskquyagc", "yacdczqxhqy", "yacxisar",	/* 18492 */
+	"yaetf", "yafkitnyyak", "yahcgni", "yahxnmmwcqib",	/* 18496 */
+	"yalukwtcz", "yanta", "yaqatt", "yaqmug",	/* 18500 */
+	"yaqqb", "yarbmexgcp", "yaritsjxu", "yas",	/* 18504 */
+	"yatagnbbaj", "yatoeyym", "yaub", "yavceiys",	/* 18508 */
+	"yawoixzhsdkaaa", "yawqe", "yawsuthzjaoopy", "yaxmyabpij",	/* 18512 */
+	"yaxn", "yaxq", "yayyokm", "yayyxxhfujbdh",	/* 18516 */
+	"yaz", "yazmwder", "yazumrsdoimq", "yazylcvbnay",	/* 18520 */
+	"yb", "ybazcb", "ybcjg", "ybcq",	/* 18524 */
+	"ybcrkj", "ybdgxiscolxfbj", "ybdz", "ybedlipulmqesy",	/* 18528 */
+	"ybfcrptkcwjnjo", "ybhdg", "ybhspqsxo", "ybkkh",	/* 18532 */
+	"ybnwsfncowvqhd", "ybpvclg", "ybqhj", "ybqtpmdfmf",	/* 18536 */
+	"ybrntncfpjcrqp", "ybti", "ybunmzyglrmxm", "ybwgqu",	/* 18540 */
+	"ybx", "ybykcrd", "ybykljtsvnbibn", "yc",	/* 18544 */
+	"ycb", "ycbfxqgyri", "ycckn", "ycf",	/* 18548 */
+	"yciblcghdasq", "ycjjufjbminigy", "ycjvcjibxccfek", "yckoooru",	/* 18552 */
+	"yclerewy", "yclfyzmhwcqirs", "yclwzfrk", "yclyoltwzzh",	/* 18556 */
+	"ycmsfg", "ycmw", "ycnjcpgf", "ycnvy",	/* 18560 */
+	"ycp", "ycrrijmjmm", "yctkuyeqraul", "yctnvypz",	/* 18564 */
+	"yd", "ydawlrkvte", "ydbdxokxfa", "ydbglcmstgvkm",	/* 18568 */
+	"ydcayhukhx", "ydcfpezwu", "ydcnvfkls", "ydeckvoveme",	/* 18572 */
+	"ydfguljrgbo", "ydftpzr", "ydhhjtuhids", "ydhrxadqgi",	/* 18576 */
+	"ydmltollxydnez", "ydmnr", "ydoetejbfgv", "ydoj",	/* 18580 */
+	"ydpcitxxtcmysn", "ydqrch", "ydqtqagwbpci", "ydqwcohkboxpts",	/* 18584 */
+	"ydqzgm", "ydskldhgy", "yduqdanbqs", "ydxemb",	/* 18588 */
+	"ydybobhqi", "ydysymjgcitmn", "ydzxbekag", "ye",	/* 18592 */
+	"yeaplreuuceivn", "yeb", "yebjr", "yebnesvbztcplq",	/* 18596 */
+	"yebuiqwthq", "yeeohkse", "yeermurzrhiwhj", "yeh",	/* 18600 */
+	"yeiruxvuamz", "yejcu", "yekang", "yeksad",	/* 18604 */
+	"yelbyczwm", "yelfg", "yemishw", "yemjurnpkzfc",	/* 18608 */
+	"yemtuq", "yepat", "yeqf", "yeqz",	/* 18612 */
+	"yerdkg", "yesewd", "yesw", "yeuernaeev",	/* 18616 */
+	"yeutmayzgtaka", "yevrqeelcu", "yewho", "yewo",	/* 18620 */
+	"yexhphxqw", "yexuyjntnf", "yexzcjzdhqgwfs", "yeybsuxcvfevun",	/* 18624 */
+	"yeyzslc", "yf", "yfanoy", "yfc",	/* 18628 */
+	"yffug", "yfhnplh", "yfho", "yfirqgebjuno",	/* 18632 */
+	"yfjgmcr", "yfkctohjxrn", "yfkdtwqlcmdhnj", "yfkfuuf",	/* 18636 */
+	"yfkgzowosey", "yfn", "yfqhuuff", "yfqqioge",	/* 18640 */
+	"yfqudiq", "yfqwgsmlgtnfwg", "yfupksezjpyov", "yfutejzg",	/* 18644 */
+	"yfvracqtlrh", "yfx", "yfxhoiakvf", "yfxkfcurthv",	/* 18648 */
+	"yfxwebrwuhfafn", "yfyvlcdo", "yfzpbefjmxnmg", "yg",	/* 18652 */
+	"ygaczzqko", "ygaf", "ygcoubp", "ygdhaot",	/* 18656 */
+	"ygeg", "yggjkdzdkyq", "yggznx", "ygix",	/* 18660 */
+	"yglh", "ygnyzlmrycoyo", "ygoaguoamca", "ygodrrnjihpp",	/* 18664 */
+	"ygogq", "ygphewqye", "ygqefxkxw", "ygqtowyan",	/* 18668 */
+	"ygsv", "ygtckroopgnb", "yguxrptcwwzr", "yh",	/* 18672 */
+	"yha", "yhaqox", "yhauawcmex", "yhbxpmsv",	/* 18676 */
+	"yhbxuzyss", "yhenc", "yhfzla", "yhgmvae",	/* 18680 */
+	"yhgqs", "yhimfv", "yhjaxuhc", "yhjdebxnc",	/* 18684 */
+	"yhjzmoibyejpvq", "yhlxqbulvdfaa", "yhmbkqxvfd", "yhnfepidpkor",	/* 18688 */
+	"yhnrweseige", "yhosjnfdc", "yhpfg", "yhrgp",	/* 18692 */
+	"yhsqyzn", "yhssz", "yhtafixclcd", "yhtdokehfpdh",	/* 18696 */
+	"yhutkokxfihok", "yhxop", "yhztufqqpv", "yi",	/* 18700 */
+	"yiaawai", "yiaclbwrgnzs", "yiap", "yicwovxwunt",	/* 18704 */
+	"yidcojkeppxp", "yidelcvdoi", "yidgsgin", "yidokkq",	/* 18708 */
+	"yifejiqrir", "yifestrrcacfkh", "yigougavjo", "yijjagnzzehxk",	/* 18712 */
+	"yik", "yindffb", "yiohmuqwwhwp", "yipfqkhtudly",	/* 18716 */
+	"yiqomfoylltutn", "yirr", "yirrxc", "yiskj",	/* 18720 */
+	"yitdch", "yiuc", "yiuxtxjv", "yiuzdbkketjh",	/* 18724 */
+	"yiynamyfbt", "yiyogkhbifmzsc", "yiywaqjnwbbk", "yizqkvyciqt",	/* 18728 */
+	"yj", "yjbecpvhmqe", "yjezjrrqgy", "yjfdpfo",	/* 18732 */
+	"yjffwoz", "yjftndmicr", "yjivfeujux", "yjiztanl",	/* 18736 */
+	"yjjhvmx", "yjjiqzxvyu", "yjkf", "yjkz",	/* 18740 */
+	"yjlauyh", "yjluljkd", "yjlvtofipztmnn", "yjm",	/* 18744 */
+	"yjobuovvbfsqe", "yjpbcp", "yjq", "yjqsssqqmgafcn",	/* 18748 */
+	"yjrqnspaxfhin", "yjs", "yjt", "yjtrori",	/* 18752 */
+	"yjuiwdelonkzy", "yjuk", "yjuyqctzo", "yjvcidccsvvdq",	/* 18756 */
+	"yjvouv", "yjvowmssga", "yjwkzbqpoaer", "yjyh",	/* 18760 */
+	"yjzat", "yjzcnzeqbko", "yk", "ykawrvuel",	/* 18764 */
+	"ykbwplfvvgkyoo", "ykcyr", "ykd", "ykevkytdd",	/* 18768 */
+	"ykfdto", "ykfgeauopbtvu", "ykfhjkcrprd", "ykfneanaqz",	/* 18772 */
+	"ykg", "ykih", "ykix", "ykixagakpqg",	/* 18776 */
+	"ykljfezmomdtei", "yklzpetgng", "ykmksrbmoqr", "ykmozdple",	/* 18780 */
+	"ykpatkpce", "ykpzpp", "ykrrezdpvuv", "ykruxoo",	/* 18784 */
+	"ykwo", "ykzfmezgxv", "ykzoyfxwa", "yl",	/* 18788 */
+	"ylckjqu", "ylcpi", "yldiwauyvbdudu", "yldxgok",	/* 18792 */
+	"yldzineb", "yle", "ylexfbdmipj", "ylfbnmexs",	/* 18796 */
+	"ylfl", "ylgfxu", "ylh", "ylhtyaxjdz",	/* 18800 */
+	"ylhwdpfdxjscze", "ylkbcrzetr", "ylkkeazmypt", "ylm",	/* 18804 */
+	"ylmiyarhqfgfcy", "ylmpqhcpx", "ylnapcxuml", "ylnbvgra",	/* 18808 */
+	"ylnkwmng", "ylovgfgcajf", "ylpcln", "ylphnhopxmxa",	/* 18812 */
+	"ylpw", "yltjrfuaprfl", "yltobll", "yludmuvyj",	/* 18816 */
+	"yluzwsk", "ylxp", "ylxpzvkjzgkb", "ylybhlmskjdg",	/* 18820 */
+	"ylzjqajxfdkkc", "ym", "ymacln", "ymat",	/* 18824 */
+	"ymcasllmdetyf", "ymchoel", "ymdgksgjy", "ymgdaezhtmmt",	/* 18828 */
+	"ymghnqlvsmmu", "ymgkvtxghbk", "ymgqvmrf", "ymgsqf",	/* 18832 */
+	"ymhxbcim", "ymjhpqx", "ymju", "ymk",	/* 18836 */
+	"ymkkwquavz", "ymkudxia", "ymlcoeci", "ymmrcuiifh",	/* 18840 */
+	"ymnddg", "ymohrqfqhhezfu", "ymp", "ymqyrtykvf",	/* 18844 */
+	"ymrjsz", "ymrmljjop", "ymtpqefuxsl", "ymttgeyokqi",	/* 18848 */
+	"ymtuktt", "ymugyno", "ymurbbsff", "ymxrv",	/* 18852 */
+	"ymxwf", "ymycrxnjajdgpd", "ymyoagazy", "ymywpvsbyg",	/* 18856 */
+	"ymzmdorta", "yn", "ynavyibv", "ynbkm",	/* 18860 */
+	"ynbrolcwtisnae", "ynemoqna", "ynhfhitcsy", "ynhmfdhjj",	/* 18864 */
+	"ynhshhqzgtx", "yni", "yniipisy", "ynjwleev",	/* 18868 */
+	"ynkgvkjriqxxf", "ynkgxyuyqrb", "ynkxlykbusfvkv", "ynlwgiuxatlbif",	/* 18872 */
+	"ynmhdpoubrpp", "ynmo", "ynnpzgzrxumfh", "ynns",	/* 18876 */
+	"ynofakn", "ynpwknzuy", "ynqzx", "ynsfqcobglkdeh",	/* 18880 */
+	"ynumvuasw", "ynuwcfzwzahf", "ynuwgpqqhlz", "ynvhzxpvryx",	/* 18884 */
+	"ynxx", "yny", "ynyfsgaa", "ynympwiuiowfmw",	/* 18888 */
+	"ynzbimiyduohd", "yo", "yoaishrrsybmc", "yoashhywny",	/* 18892 */
+	"yobp", "yocdwurdfw", "yocoljr", "yoeab",	/* 18896 */
+	"yofpudcpd", "yofyvipx", "yohwd", "yoitbbz",	/* 18900 */
+	"yoiv", "yojnbi", "yojwwij", "yokwgfcwpcvpv",	/* 18904 */
+	"yolclltgb", "yolzktodoegwmd", "yonlfjc", "yonuyoy",	/* 18908 */
+	"yoo", "yoovl", "yoqsqmlm", "yortvdbz",	/* 18912 */
+	"yoselgeap", "youbdq", "yovtpsa", "yow",	/* 18916 */
+	"yoxvp", "yozpx", "yozvpvvdspsc", "yp",	/* 18920 */
+	"ypatcpqmaql", "ypay", "ypdwjh", "ypdxfvdyi",	/* 18924 */
+	"ypgdgnn", "yphbhsmx", "yphxxurulxpwhr", "ypkrknppweqt",	/* 18928 */
+	"ypl", "ypmuihkxfyf", "ypmuoxwjqfrqj", "ypnsdsf",	/* 18932 */
+	"ypnxvfutb", "ypogwmuyxis", "yppyra", "ypqal",	/* 18936 */
+	"yprgkany", "ypsyakx", "ypudlkvrglbl", "ypvurhpxgxzzl",	/* 18940 */
+	"ypxe", "ypxhvvu", "ypyklnnteetf", "ypysize",	/* 18944 */
+	"ypyyzvayrh", "yq", "yqakb", "yqczfrfef",	/* 18948 */
+	"yqdrg", "yqfkwtd", "yqfnv", "yqgfdsiofn",	/* 18952 */
+	"yqgkyzmjdqyx", "yqgxjmetwa", "yqhlruemg", "yqin",	/* 18956 */
+	"yqkjjvorhri", "yqkt", "yqlhq", "yqljeq",	/* 18960 */
+	"yqodsjk", "yqozzr", "yqphyyfwcsh", "yqptghfolouy",	/* 18964 */
+	"yqqrrokmd", "yqru", "yqrwnxiwpr", "yqsbigxl",	/* 18968 */
+	"yqv", "yqvxwjtaszi", "yqwecuiet", "yqwtduqhnxdthn",	/* 18972 */
+	"yqyapd", "yqycgladgqcrwh", "yqzkwqptktuw", "yr",	/* 18976 */
+	"yrb", "yrchiprmvwh", "yrezviwhdsy", "yrgaapowenf",	/* 18980 */
+	"yrgi", "yrgjghcd", "yrgssgq", "yrirqsktthccpq",	/* 18984 */
+	"yrjdvtxgk", "yrknaue", "yrljf", "yrmxwohfqdbjog",	/* 18988 */
+	"yrnpxnbhjse", "yroibn", "yroump", "yrsoou",	/* 18992 */
+	"yrvnuabwkekj", "yrvvafijl", "yrwpsrjnyi", "yrwttk",	/* 18996 */
+	"yrx", "yrxr", "ys", "ysacjlb",	/* 19000 */
+	"ysas", "ysavamzuuc", "ysbtfelfknp", "yscabqzphqqjj",	/* 19004 */
+	"ysdqxtkygjije", "ysf", "ysfikcgpqms", "ysgwgkgjpgsi",	/* 19008 */
+	"ysiqsqveag", "ysjc", "yskjwb", "yskrgstnyayt",	/* 19012 */
+	"yslzlqdk", "ysm", "ysmglpjcve", "ysnkjkzlhoulml",	/* 19016 */
+	"ysp", "ysqpvoggpve", "ysrnvrccpnrfxs", "yssevsixfqo",	/* 19020 */
+	"ysswq", "ystowfnfgj", "ysvcrt", "ysvr",	/* 19024 */
+	"yswixdayryq", "yswpog", "yswxdnzpekg", "ysx",	/* 19028 */
+	"ysxhhseq", "yt", "ytaakhicsvmdks", "ytbnbqdfict",	/* 19032 */
+	"ytboxyodovwj", "ytf", "ytfufxqpw", "ytgkpxjaxedrne",	/* 19036 */
+	"ytgpyanuwtpht", "ythssygbs", "ythtxr", "ythw",	/* 19040 */
+	"yti", "ytjbbkzinidop", "ytjsdzjowts", "ytjyfrxsdp",	/* 19044 */
+	"ytkesfnvjw", "ytkpndbwp", "ytlbzthjwibu", "ytnvsmb",	/* 19048 */
+	"ytqb", "ytrcu", "ytrlqofkj", "ytrurfh",	/* 19052 */
+	"ytueyfmqmqhekl", "ytvkwhptrn", "ytvv", "ytwggcvf",	/* 19056 */
+	"ytxjzeywywgwu", "ytzgyhzh", "ytznmbvbnyzxsy", "ytzyfbxy",	/* 19060 */
+	"yuahbtefzd", "yuculnwroyvvru", "yuczoux", "yuhjacepd",	/* 19064 */
+	"yujidwd", "yukontktdegqls", "yumt", "yup",	/* 19068 */
+	"yuqmrqxl", "yurefwslic", "yusyvuxvox", "yuszicnyrzazsi",	/* 19072 */
+	"yuuglsfs", "yuuvssejjep", "yuv", "yuxpabp",	/* 19076 */
+	"yuyrpwtj", "yuywsnnmj", "yuzoxgokgt", "yvaczmrz",	/* 19080 */
+	"yvbsejvvbdqyk", "yvbuy", "yvdbqjnkjnrdar", "yvdtty",	/* 19084 */
+	"yvdvslx", "yvefgrxuev", "yvehszxxz", "yvejb",	/* 19088 */
+	"yvf", "yvfdbehiybuaa", "yvgthl", "yvhvjsmcmy",	/* 19092 */
+	"yvjp", "yvlxzqnzzpmqb", "yvnfhzsyn", "yvnnr",	/* 19096 */
+	"yvo", "yvoddyjrtihf", "yvpagmeocjala", "yvpf",	/* 19100 */
+	"yvrrgep", "yvrthl", "yvscmkhhjyxz", "yvsfazpjyfxs",	/* 19104 */
+	"yvsgkkixbaqch", "yvtsqvd", "yvukfawmcks", "yvuqrh",	/* 19108 */
+	"yvuvuks", "yvvcddywk", "yvvvsp", "yvwnmugmsuede",	/* 19112 */
+	"yvwnvrtm", "yvwvxgl", "yvxclcbpm", "yvxlcovqdyfqm",	/* 19116 */
+	"yvytmwupioza", "yvzesxzulygyuj", "yw", "ywbdn",	/* 19120 */
+	"ywc", "ywcioncd", "ywcnslfftdlfvp", "ywdrou",	/* 19124 */
+	"ywewfu", "ywfdlzpiahiqn", "ywfmt", "ywgxovbglzj",	/* 19128 */
+	"ywhmkboffz", "ywjrnihdhay", "ywksz", "ywkyy",	/* 19132 */
+	"ywljcstfr", "ywlrbhkmupj", "ywmgwvguqdh", "ywnjcytjlp",	/* 19136 */
+	"ywolrkwganxciv", "ywqhe", "ywqo", "ywqpsgxjgz",	/* 19140 */
+	"ywtuovt", "ywvs", "ywvwzp", "ywwjbhqvoxlb",	/* 19144 */
+	"ywxf", "ywxocopkv", "ywzbmmyag", "yx",	/* 19148 */
+	"yxafpc", "yxbce", "yxbjkjqbkxv", "yxbodbcryrhp",	/* 19152 */
+	"yxd", "yxdefk", "yxdnucdruink", "yxej",	/* 19156 */
+	"yxgyvjm", "yxhjucqcti", "yxhqirca", "yxipdp",	/* 19160 */
+	"yxkbeonwr", "yxmnghtc", "yxmyc", "yxncth",	/* 19164 */
+	"yxohsvrl", "yxoniarqzecpr", "yxoquer", "yxpr",	/* 19168 */
+	"yxpvqlnsfnilrh", "yxqblvthbn", "yxqpt", "yxqptfcwmjrd",	/* 19172 */
+	"yxrn", "yxsshyf", "yxupskcwfogg", "yxuuuifdmp",	/* 19176 */
+	"yxvayqjeouoi", "yxwam", "yxwl", "yxx",	/* 19180 */
+	"yxxcopr", "yxycugybfyyw", "yxzswy", "yy",	/* 19184 */
+	"yya", "yyazea", "yybgys", "yyccpowyvnfluq",	/* 19188 */
+	"yycoszqnay", "yyfcaxapv", "yyg", "yygcdquzprk",	/* 19192 */
+	"yyhchnzelzgcnl", "yyis", "yyjkqnsbcuee", "yyldr",	/* 19196 */
+	"yyll", "yymvmlnvgpaiuv", "yynazejnkgohpk", "yynnsm",	/* 19200 */
+	"yynrcqpmb", "yysqibxwqnh", "yyt", "yythrfnqmp",	/* 19204 */
+	"yyx", "yyxjmw", "yyyukcsvmemysl", "yz",	/* 19208 */
+	"yzajk", "yzaoryoxhecphm", "yzbhfpkixaxseb", "yzbjhuyzfjhqur",	/* 19212 */
+	"yzbkimrhq", "yzblbzxyi", "yzbsrgxfkefwm", "yzdecairfhefsq",	/* 19216 */
+	"yzdgaf", "yzeixxy", "yzekcajy", "yzfpqeyve",	/* 19220 */
+	"yzfyvdgs", "yzh", "yzhfz", "yzjd",	/* 19224 */
+	"yzjhlrigejn", "yzjqj", "yzju", "yzkfjihonrfoh",	/* 19228 */
+	"yzlppe", "yznho", "yznilcleddh", "yzomsgde",	/* 19232 */
+	"yzp", "yzrwnz", "yzrzasjmzhmhn", "yzsdadnrcqdhvf",	/* 19236 */
+	"yzstcyhncvrma", "yzsycknnirsyl", "yztxsnwymn", "yztzvmwoormv",	/* 19240 */
+	"yzufeti", "yzv", "yzvhzgdars", "yzwv",	/* 19244 */
+	"yzxrtwpsolvoqp", "yzxuq", "yzzioqd", "yzzomgancvwn",	/* 19248 */
+	"za", "zabwdmizc", "zad", "zadwjrc",	/* 19252 */
+	"zaeaa", "zaeufekzxmjkl", "zagapms", "zaglyrantfi",	/* 19256 */
+	"zagskwnnrscq", "zahbf", "zahp", "zaimrkjld",	/* 19260 */
+	"zaiuujtxsqh", "zak", "zakjmff", "zalgid",	/* 19264 */
+	"zalibneothy", "zamcy", "zamyrcnkbycomr", "zanjzhzucoq",	/* 19268 */
+	"zanqd", "zao", "zaocpjtbm", "zaowemnnosua",	/* 19272 */
+	"zapliizsszp", "zapzewzt", "zaqgtzcuzbsv", "zarvgqwrkzr",	/* 19276 */
+	"zatgkxtu", "zatkiqvghnehdm", "zauvud", "zavgudrjes",	/* 19280 */
+	"zavotyjyv", "zaxypq", "zaxyqsjnif", "zaz",	/* 19284 */
+	"zazd", "zaztoyaikk", "zb", "zbalpnwzfzvawj",	/* 19288 */
+	"zbamjv", "zbb", "zbclpngpkf", "zbcufpxtiafv",	/* 19292 */
+	"zbe", "zbelacuo", "zbesxb", "zbfpftl",	/* 19296 */
+	"zbg", "zbgn", "zbixjz", "zbjclrsdql",	/* 19300 */
+	"zblco", "zbneqgayghuilz", "zbor", "zbovmwxp",	/* 19304 */
+	"zbozkte", "zbpslkspfsteki", "zbqokyyarvpzx", "zbrajlvsiqj",	/* 19308 */
+	"zbrqkhvspohdi", "zbsouordibkz", "zbsqaa", "zbtdmc",	/* 19312 */
+	"zbtqhhbyjgufu", "zbvviiem", "zbxfdpuhzjhhhh", "zbxyum",	/* 19316 */
+	"zbyqg", "zbysyhzpc", "zbytkorqymefzz", "zbzionufraw",	/* 19320 */
+	"zc", "zcc", "zccezowufszst", "zccgt",	/* 19324 */
+	"zcd", "zcdcfjhbjtegzg", "zcdtjdwoznowfj", "zcehgkqgctlbvo",	/* 19328 */
+	"zcfnswb", "zcg", "zchddgjlkpzlj", "zcizmutzt",	/* 19332 */
+	"zcjxtohxpcqi", "zck", "zcnstmsaaksmxb", "zcobq",	/* 19336 */
+	"zcohqqrmhdf", "zcomf", "zcqjbgwgonyr", "zcqqrdiu",	/* 19340 */
+	"zcr", "zcrhhvi", "zcriwp", "zctd",	/* 19344 */
+	"zcyotqn", "zczlwsccejfynz", "zdahwvf", "zdazzizbjlz",	/* 19348 */
+	"zdbhowvki", "zdbulthyro", "zdbvnecx", "zdefjgfvoc",	/* 19352 */
+	"zdgl", "zdhfrqox", "zdijqk", "zdjpnt",	/* 19356 */
+	"zdjuemyurij", "zdjugxaslny", "zdldnqlagvqyn", "zdlt",	/* 19360 */
+	"zdoecehavhintd", "zdoh", "zdpsozbevn", "zdqnja",	/* 19364 */
+	"zdsoq", "zdszwgronxys", "zdtrlk", "zdu",	/* 19368 */
+	"zducctlhpv", "zdwrixbfdkue", "zdxgkfxkhnbsp", "zdxsza",	/* 19372 */
+	"zdxtmqdhdpczj", "zdyh", "zdyhgxyokc", "zdynukfoqz",	/* 19376 */
+	"zdzohrrk", "ze", "zeahprg", "zebhaxp",	/* 19380 */
+	"zebjsmhwfgxm", "zebvpbdp", "zebz", "zeckzifsioy",	/* 19384 */
+	"zecmzrmhmvu", "zee", "zeeqand", "zeevdp",	/* 19388 */
+	"zef", "zefol", "zeft", "zefwnzuhniu",	/* 19392 */
+	"zegnhz", "zegtq", "zegyyiu", "zeiqwottnk",	/* 19396 */
+	"zeitjr", "zeixmyirv", "zej", "zejvfqwczuhjw",	/* 19400 */
+	"zek", "zekqggcbq", "zekqszvbspxysm", "zekrqzjhlw",	/* 19404 */
+	"zelkoh", "zelsmuteeipmi", "zelucbnmnuwsty", "zemoy",	/* 19408 */
+	"zemuiybbq", "zeogemouvbl", "zepnwhjrsrkzi", "zeqszfuwtn",	/* 19412 */
+	"zer", "zerchiuqs", "zesshdcxcoag", "zeswm",	/* 19416 */
+	"zesxazq", "zetkyhteoq", "zeu", "zewiecnpe",	/* 19420 */
+	"zewimheyedpv", "zex", "zexivbharjcctj", "zeyemldodx",	/* 19424 */
+	"zezibpfycri", "zf", "zfahmihunuvgbz", "zfary",	/* 19428 */
+	"zfffweclggnvwc", "zffql", "zfjrg", "zfjtrs",	/* 19432 */
+	"zfmbtxfpd", "zfmowwejhglcd", "zfnbnqdsx", "zfommotogh",	/* 19436 */
+	"zfoscibdauyl", "zfphdgjrvqkps", "zfqa", "zfreeouf",	/* 19440 */
+	"zftogelot", "zfv", "zfvjhafo", "zfwyzwd",	/* 19444 */
+	"zfxzzbohboqinx", "zfyibkmlbubva", "zfzmsrgtmy", "zg",	/* 19448 */
+	"zgbn", "zgcdhkmiazeip", "zgdpamnt", "zgfialojjulep",	/* 19452 */
+	"zggjmyo", "zggzrnbvad", "zgilaocfxov", "zgipnjgnnlhbwt",	/* 19456 */
+	"zgj", "zgjkx", "zgjstvnvtifmk", "zgknocibaje",	/* 19460 */
+	"zglpoqbmrpn", "zgnlwd", "zgntttxhxe", "zgnzlkylj",	/* 19464 */
+	"zgoqcfmvtyyp", "zgpdzcgwq", "zgpileis", "zgqohkktii",	/* 19468 */
+	"zgr", "zgrjbivoa", "zgsiy", "zgtiaposs",	/* 19472 */
+	"zgtmhboaqqa", "zgtocrsywv", "zgvnpth", "zgx",	/* 19476 */
+	"zh", "zhbvexexrrfk", "zhbwa", "zhbwsc",	/* 19480 */
+	"zhcbonfvig", "zhdalktmhbqdpz", "zhe", "zhfczxxn",	/* 19484 */
+	"zhfoegpbocnsco", "zhhbhpuzvddgcl", "zhhk", "zhhmxsc",	/* 19488 */
+	"zhicsx", "zhiswkjpjylhs", "zhk", "zhme",	/* 19492 */
+	"zhnujq", "zhqxslmaqa", "zhttsi", "zhudcemuhxhs",	/* 19496 */
+	"zhuq", "zhurhvxkkegaf", "zhvdlk", "zhvfd",	/* 19500 */
+	"zhwgieaqicmn", "zhxbxu", "zhyb", "zhzftli",	/* 19504 */
+	"zhzn", "zhzsmdbo", "zi", "ziacxti",	/* 19508 */
+	"ziaifgrhdai", "ziazri", "zibjunjgwt", "ziej",	/* 19512 */
+	"zige", "ziirxhc", "zikc", "zikiq",	/* 19516 */
+	"zikk", "ziollopgm", "zipqwkdrcbh", "ziptez",	/* 19520 */
+	"zipushmdo", "ziqloa", "ziranrweatm", "zirggxfrg",	/* 19524 */
+	"zisfjrycvf", "zitfmmpzrhhnt", "ziu", "ziudkhzjizqe",	/* 19528 */
+	"ziumdwxh", "zivvqut", "zivxmaft", "zixxbmb",	/* 19532 */
+	"zj", "zjacvjnql", "zjb", "zjc",	/* 19536 */
+	"zjckvzo", "zjefcecufzx", "zjehrgjlwu", "zjfvdmnpygszl",	/* 19540 */
+	"zjhkm", "zjisiqrphtkr", "zjki", "zjldfmewzgebbw",	/* 19544 */
+	"zjlmjbq", "zjlsdvagljhgcl", "zjmdnrd", "zjpuc",	/* 19548 */
+	"zjqubunvwzbalt", "zjrscpsoqomlq", "zjspcei", "zjstkbwklz",	/* 19552 */
+	"zjsvlebtmz", "zjtoxpu", "zjulkpjuijj", "zjvkxyeyw",	/* 19556 */
+	"zjvmn", "zjwtnotxod", "zjzkihd", "zk",	/* 19560 */
+	"zkepnw", "zkfmwoqonjeu", "zkgcpxppy", "zkgfgbqkmczxuf",	/* 19564 */
+	"zkhbugkarfr", "zkjcrk", "zkjobhp", "zkkhhc",	/* 19568 */
+	"zkkswczztleiki", "zklcjofamd", "zklyk", "zkoqyaezw",	/* 19572 */
+	"zkpdqm", "zkswxmnewct", "zktnkjogwhzqz", "zkvwhtvlwywz",	/* 19576 */
+	"zkwdyhlfsqonq", "zkxfu", "zl", "zlautvslmkienm",	/* 19580 */
+	"zlbcpskq", "zlccew", "zleagqk", "zlfxobwpezyrp",	/* 19584 */
+	"zlhbrtdicu", "zlkap", "zlkfnvzrhg", "zlkveussee",	/* 19588 */
+	"zlliawk", "zlm", "zlnmmrhvnwdg", "zlowhe",	/* 19592 */
+	"zlpildpricxz", "zlspntic", "zlv", "zlxli",	/* 19596 */
+	"zlxm", "zlxoecjp", "zlxw", "zlxxueqoexe",	/* 19600 */
+	"zlyaxaafmhe", "zm", "zmakizooynon", "zmaq",	/* 19604 */
+	"zmatgofqufet", "zmatxqiuge", "zmbr", "zmcm",	/* 19608 */
+	"zmd", "zmdiqvf", "zmdmq", "zmdwzz",	/* 19612 */
+	"zme", "zmevzwb", "zmgtohnmsem", "zml",	/* 19616 */
+	"zmltbbtekpb", "zmodtafspc", "zmp", "zmpg",	/* 19620 */
+	"zmtahunjq", "zmttdcrrbm", "zmwaqicvohk", "zmwuicjvqplhni",	/* 19624 */
+	"zmxqcfnyjgfd", "zmyeoj", "zmymgc", "zmymkc",	/* 19628 */
+	"zn", "znafuerrdj", "znarrt", "znclaixpklwkf",	/* 19632 */
+	"zncvgbbvh", "znegu", "znfbjieg", "znfkzicrgvvdpa",	/* 19636 */
+	"zngnt", "znidsguk", "znirjkylnollkm", "znkhcgbsvl",	/* 19640 */
+	"znl", "znlcqqavig", "znlukvlquea", "znnkt",	/* 19644 */
+	"znrsty", "znsoiexa", "zntpxsiotankdx", "znvi",	/* 19648 */
+	"znvqvbyjcmsfx", "znvsmdn", "znvy", "znwkcroxyquvhx",	/* 19652 */
+	"znxzkzicleq", "znyfvctb", "znyhcjnql", "znyiyvyy",	/* 19656 */
+	"znynkg", "zo", "zoacyognq", "zobchm",	/* 19660 */
+	"zobiudozqad", "zoenqyp", "zoepzboq", "zogmbjiakufyjy",	/* 19664 */
+	"zohuinhr", "zohvobdunezxm", "zoivjgeemzeluu", "zojdiymx",	/* 19668 */
+	"zojphadjajzn", "zomygmsaadikz", "zonarvgpqytae", "zongxik",	/* 19672 */
+	"zoomlglcitlrg", "zooprrwzkic", "zooz", "zop",	/* 19676 */
+	"zopenxvnqqiwkn", "zopngq", "zoqds", "zoqwrzrn",	/* 19680 */
+	"zotybkygbbpy", "zoujkhknj", "zovczisqdly", "zovnffcsmwemap",	/* 19684 */
+	"zovpwswic", "zowtxbvj", "zoybjwwusijw", "zoylphihuezkr",	/* 19688 */
+	"zoz", "zpacq", "zpaizqhq", "zpbnq",	/* 19692 */
+	"zpc", "zpdesmitgzrz", "zpdkxic", "zpejxnemszj",	/* 19696 */
+	"zpelkgfck", "zpewvw", "zpggoi", "zpitbaaivye",	/* 19700 */
+	"zpketxbzj", "zppif", "zpqglahsvxfpf", "zpsxhph",	/* 19704 */
+	"zpupybhtjfq", "zpvclzo", "zpxltlyubnmr", "zpy",	/* 19708 */
+	"zpzrzeym", "zpzzptv", "zq", "zqaipf",	/* 19712 */
+	"zqb", "zqbalmdglfb", "zqcegcn", "zqclcezv",	/* 19716 */
+	"zqebkmlvqk", "zqektmgzbugks", "zqhblpip", "zqhygjdysay",	/* 19720 */
+	"zqistdyjwrf", "zqj", "zqlhiqjzlo", "zqlwyrnppln",	/* 19724 */
+	"zqm", "zqmnkjjuyduz", "zqmnpp", "zqnmgjcbo",	/* 19728 */
+	"zqnuuo", "zqo", "zqp", "zqqme",	/* 19732 */
+	"zqrfc", "zqs", "zqu", "zqukbcyeifwfk",	/* 19736 */
+	"zqvamhrwcluf", "zqvsdbmjlzun", "zqxkoukaq", "zqyaolyt",	/* 19740 */
+	"zqyfpsxy", "zqyqjum", "zr", "zraiqsg",	/* 19744 */
+	"zraqnyawxuk", "zraqxgrgumb", "zrch", "zrdhdtwa",	/* 19748 */
+	"zred", "zrfhturwquwuyj", "zrh", "zrihooo",	/* 19752 */
+	"zrlp", "zrmbgnngaqghgx", "zrmtliakdq", "zrorcisoluxu",	/* 19756 */
+	"zrow", "zrsyhkpctckbuz", "zrwwxpnxezx", "zrxzyil",	/* 19760 */
+	"zryvszgn", "zryyzg", "zrz", "zs",	/* 19764 */
+	"zsaahgdklr", "zsb", "zsbvqnvxbphdka", "zscfxqvsgh",	/* 19768 */
+	"zsevvgee", "zsfiufrdtgybzp", "zsk", "zskitcz",	/* 19772 */
+	"zslwmerkn", "zsmm", "zsn", "zsnldtlwy",	/* 19776 */
+	"zspudbrhxqnzh", "zsqicw", "zsqsvakbxhpg", "zssmkhuwgryjer",	/* 19780 */
+	"zstxzux", "zsug", "zsugdlsoe", "zsujplhu",	/* 19784 */
+	"zsuoo", "zsvwzbktje", "zswfjhweeaqs", "zswzzwfbp",	/* 19788 */
+	"zsy", "zsymvpaws", "zt", "ztapuuob",	/* 19792 */
+	"ztavdtgpiut", "ztexoxcbtctv", "zthcrqvgtkt", "zthhjyrnpa",	/* 19796 */
+	"zthhrygpy", "ztjdhzuvvsnvc", "ztjl", "ztkabdlgww",	/* 19800 */
+	"ztm", "ztokrovuphwrba", "ztrgulgqijqxal", "ztrqbyhnlok",	/* 19804 */
+	"ztrrauzv", "ztryimvmlrd", "ztswjqr", "ztvhnovvt",	/* 19808 */
+	"ztvke", "ztvpuc", "ztvwlsiqnnr", "ztwkdwkxteq",	/* 19812 */
+	"ztwmcq", "ztwraljqoe", "ztybll", "ztyrabki",	/* 19816 */
+	"zu", "zuamtl", "zuaoepqc", "zuasgenk",	/* 19820 */
+	"zucc", "zuegwqporp", "zufdwg", "zufqln",	/* 19824 */
+	"zugxyyuqlj", "zuh", "zuixbwzobnxrg", "zuj",	/* 19828 */
+	"zukbkw", "zukojnzevat", "zukp", "zulecxttcru",	/* 19832 */
+	"zumdkavf", "zuosekzkz", "zuovparpca", "zuqainrupcscuc",	/* 19836 */
+	"zuqcu", "zuqqusyw", "zurpf", "zuruuknpbkl",	/* 19840 */
+	"zuslmamayeaq", "zuts", "zuu", "zuvfw",	/* 19844 */
+	"zuwewtvgj", "zuwxzhrw", "zuybljdo", "zv",	/* 19848 */
+	"zvcfxucmd", "zvcqe", "zvcrfrz", "zvdgtkf",	/* 19852 */
+	"zvdwonxk", "zvg", "zvgdegkrfunm", "zvhtdvslqsoq",	/* 19856 */
+	"zvhwgxolk", "zvijxbon", "zvjo", "zvlctorpxs",	/* 19860 */
+	"zvlgovrabdbs", "zvmw", "zvnazcblpdblrr", "zvnmmitmirswuo",	/* 19864 */
+	"zvovnaw", "zvpfdwog", "zvpi", "zvpjtoyz",	/* 19868 */
+	"zvqo", "zvrg", "zvrv", "zvrxwgfjnrf",	/* 19872 */
+	"zvsoislr", "zvssy", "zvtiarxatzegu", "zvtlfay",	/* 19876 */
+	"zvwzyxn", "zvxczprg", "zw", "zwahzegijy",	/* 19880 */
+	"zwblxbwebuntq", "zwbwwtub", "zwc", "zwcvdisng",	/* 19884 */
+	"zwdf", "zwdrulc", "zwezdcxm", "zwjrujyy",	/* 19888 */
+	"zwjsjnf", "zwksv", "zwlgk", "zwmduvldnlixd",	/* 19892 */
+	"zwno", "zwobvrjlav", "zwqdnluutph", "zwqihvrjkdmolx",	/* 19896 */
+	"zwr", "zwwddlvr", "zwxdnsiqxmfg", "zwxf",	/* 19900 */
+	"zwys", "zxalwrnbxnhsb", "zxbgdbrejx", "zxblz",	/* 19904 */
+	"zxcfrdfwr", "zxdfditkwpuulo", "zxdfkghohfqi", "zxdhpucjotro",	/* 19908 */
+	"zxghciuys", "zxgmwimg", "zxgtujonrrxbbl", "zxhpnohqdvege",	/* 19912 */
+	"zxjd", "zxjgpyjdfuyz", "zxjivtbd", "zxjnodurnznai",	/* 19916 */
+	"zxkroyohtuqonr", "zxkushamnb", "zxkzhilmwkbogy", "zxl",	/* 19920 */
+	"zxlw", "zxlz", "zxmsgnbbhhe", "zxoaaxglm",	/* 19924 */
+	"zxpwqggajb", "zxqgcqmrjlcwgs", "zxsqbroy", "zxubcffx",	/* 19928 */
+	"zxuuxkx", "zxv", "zxwbtr", "zxxglj",	/* 19932 */
+	"zxxtevjkujtlc", "zybcrhlviv", "zyd", "zydcp",	/* 19936 */
+	"zydte", "zyfgdxkvz", "zyhoyprcfyalb", "zyhury",	/* 19940 */
+	"zykhced", "zykphfqenklqw", "zym", "zymnnfscrczdh",	/* 19944 */
+	"zympp", "zymtnznoze", "zyn", "zynjxo",	/* 19948 */
+	"zyqclpffoiu", "zyqfkzw", "zyqgjfhvo", "zyrtccdsr",	/* 19952 */
+	"zysgpqvshhad", "zysxngovemd", "zyuvuozuov", "zywfpgso",	/* 19956 */
+	"zywku", "zywyogubeyzqlp", "zyxagu", "zyyl",	/* 19960 */
+	"zyzudgp", "zyzwxncsv", "zz", "zzadua",	/* 19964 */
+	"zzaeipxncq", "zzajnvxvpkrw", "zzciydg", "zzdpstxdanhr",	/* 19968 */
+	"zzeitbzrtnaz", "zzflfciaekvy", "zzfxvqdarep", "zzgkdxu",	/* 19972 */
+	"zzgwfoua", "zzhjtmia", "zzhtstvdx", "zzigxjgwapj",	/* 19976 */
+	"zzkeyr", "zzlbsyjihlh", "zzleprmenwp", "zzngcksbqbpvi",	/* 19980 */
+	"zzopthfz", "zzpncucfqff", "zzrqozu", "zzrvjmwzp",	/* 19984 */
+	"zzs", "zztsdt", "zzul", "zzuxbbtuamm",	/* 19988 */
+	"zzv", "zzvvt", "zzvwzzpitc", "zzvynaqeslspt",	/* 19992 */
+	"zzwbtdkufjgmw", "zzwrh", "zzwsafjjanz", "zzwtvgpycwdza",	/* 19996 */
+	"zzxbsseixo", "zzzlrq", "zzzuvnw", "zzzxfgzy",	/* 20000 */
+	};
+static const uint16_t hash_g[24801] = {
+	    0x0b87, 0x4545, 0x0ea2, 0x1bf7, 0x0521, 0x46a0, 0x0a02, 0x131d,
+	    0x04b6, 0x0000, 0x0a97, 0x2d6b, 0x04ef, 0x3b48, 0x1133, 0x0000,
+	    0x0806, 0x13b7, 0x1023, 0x4626, 0x4962, 0x0000, 0x3512, 0x4674,
+	    0x0000, 0x341e, 0x1cc1, 0x2ae8, 0x2c76, 0x2097, 0x4854, 0x0dc2,
+	    0x1181, 0x24ab, 0x2e9a, 0x24b6, 0x253e, 0x2897, 0x3a12, 0x2399,
+	    0x194f, 0x12c6, 0x4df2, 0x362e, 0x422d, 0x0000, 0x2681, 0x367d,
+	    0x4149, 0x14d0, 0x0000, 0x39d2, 0x4436, 0x2f53, 0x1535, 0x00ef,
+	    0x0000, 0x123c, 0x0000, 0x2f2a, 0x2116, 0x46af, 0x2ff6, 0x0000,
+	    0x0000, 0x379c, 0x0000, 0x0a5a, 0x0dce, 0x1c21, 0x2460, 0x37ad,
+	    0x0000, 0x47b9, 0x270a, 0x3595, 0x09c0, 0x269e, 0x3d73, 0x34ae,
+	    0x3312, 0x40a8, 0x0511, 0x4de2, 0x1397, 0x2b75, 0x3a3f, 0x190e,
+	    0x2672, 0x0aac, 0x0000, 0x0000, 0x1047, 0x0000, 0x30b3, 0x476b,
+	    0x0e3f, 0x0000, 0x3312, 0x4413, 0x3ec7, 0x2415, 0x12f1, 0x08fe,
+	    0x274a, 0x3295, 0x1375, 0x0000, 0x3f5c, 0x096b, 0x4a83, 0x4264,
+	    0x0752, 0x0000, 0x0000, 0x2a28, 0x34c8, 0x422e, 0x0000, 0x21b0,
+	    0x2dd1, 0x0bd5, 0x1a96, 0x09db, 0x465a, 0x4c5c, 0x2e56, 0x13a2,
+	    0x0d35, 0x27f9, 0x4be4, 0x2a3e, 0x130c, 0x4d88, 0x235c, 0x0000,
+	    0x0739, 0x10ee, 0x2c14, 0x3162, 0x1a99, 0x0000, 0x05c5, 0x1650,
+	    0x224c, 0x0c89, 0x3f51, 0x4060, 0x462b, 0x0000, 0x23c3, 0x05f9,
+	    0x2c2a, 0x1c26, 0x1c20, 0x3c8f, 0x431e, 0x35f5, 0x379b, 0x0c82,
+	    0x0000, 0x06a0, 0x35f6, 0x22e1, 0x088f, 0x16dc, 0x0000, 0x133f,
+	    0x1b84, 0x1aed, 0x4b13, 0x1966, 0x4204, 0x0d52, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2d36, 0x3c19, 0x2b96, 0x09b1, 0x0000, 0x3b8d,
+	    0x20a3, 0x3f9b, 0x1003, 0x3a07, 0x1841, 0x0162, 0x1e35, 0x0000,
+	    0x0000, 0x0000, 0x377a, 0x0000, 0x2c27, 0x094f, 0x1221, 0x2e9c,
+	    0x4c0a, 0x05ed, 0x244d, 0x4cf9, 0x006b, 0x13a3, 0x2e56, 0x1cac,
+	    0x0d73, 0x0000, 0x33cd, 0x31be, 0x4bc0, 0x0450, 0x12b5, 0x1557,
+	    0x0000, 0x0000, 0x0f00, 0x0033, 0x0000, 0x4b2e, 0x1fed, 0x4632,
+	    0x3e11, 0x0c27, 0x3b9e, 0x2a12, 0x0000, 0x26b6, 0x17f8, 0x47c8,
+	    0x4e0c, 0x0594, 0x0000, 0x0f23, 0x43a6, 0x44d4, 0x0000, 0x15d4,
+	    0x2f98, 0x3168, 0x44a9, 0x1a31, 0x2195, 0x2690, 0x120a, 0x099d,
+	    0x1297, 0x0000, 0x1d89, 0x0000, 0x3689, 0x4281, 0x431c, 0x2598,
+	    0x222e, 0x02ec, 0x1030, 0x39f3, 0x3330, 0x0000, 0x48e5, 0x4ac8,
+	    0x10ac, 0x1410, 0x17f2, 0x4103, 0x1c45, 0x0000, 0x2c08, 0x3c0c,
+	    0x4df2, 0x1a03, 0x46b2, 0x1295, 0x22ad, 0x3b71, 0x0000, 0x4b1f,
+	    0x3faa, 0x07c1, 0x0000, 0x0000, 0x4dde, 0x13b4, 0x1410, 0x0000,
+	    0x00c7, 0x0000, 0x01ab, 0x3830, 0x3b74, 0x2f19, 0x4822, 0x3877,
+	    0x2985, 0x1f0d, 0x1636, 0x2355, 0x2c11, 0x239e, 0x4251, 0x3e06,
+	    0x4c43, 0x17a2, 0x0000, 0x0000, 0x03fe, 0x4637, 0x0247, 0x0000,
+	    0x2bd8, 0x31c8, 0x0f4a, 0x07cf, 0x02ad, 0x365d, 0x15b3, 0x25b0,
+	    0x134b, 0x1df7, 0x0000, 0x1499, 0x4b95, 0x27e7, 0x01c0, 0x0583,
+	    0x35fe, 0x36ee, 0x3270, 0x3ed8, 0x1918, 0x2504, 0x221d, 0x034e,
+	    0x271c, 0x31ea, 0x4185, 0x15c1, 0x0000, 0x4414, 0x3c41, 0x4402,
+	    0x25d6, 0x3cef, 0x0151, 0x0000, 0x3874, 0x1cd6, 0x3e59, 0x0000,
+	    0x2114, 0x08a4, 0x1a99, 0x40b4, 0x1a29, 0x19cf, 0x29aa, 0x3d8a,
+	    0x1388, 0x0000, 0x3901, 0x0000, 0x2ece, 0x498c, 0x0000, 0x342d,
+	    0x0216, 0x3938, 0x3bf7, 0x4c05, 0x0000, 0x0c66, 0x40c4, 0x00a6,
+	    0x4635, 0x1e4a, 0x2d13, 0x21a2, 0x0000, 0x3170, 0x0000, 0x0b12,
+	    0x450a, 0x1e28, 0x1c18, 0x10b9, 0x1ba1, 0x2362, 0x1d84, 0x0560,
+	    0x0000, 0x12e3, 0x1e08, 0x48bf, 0x1940, 0x08f8, 0x2408, 0x3231,
+	    0x2971, 0x2979, 0x22c5, 0x0000, 0x08dd, 0x309c, 0x06e7, 0x2cab,
+	    0x1a5d, 0x3230, 0x0000, 0x4397, 0x0de9, 0x3415, 0x16de, 0x1ad8,
+	    0x4b9c, 0x1829, 0x0000, 0x3579, 0x4c10, 0x0000, 0x178f, 0x34c1,
+	    0x3fbf, 0x00e6, 0x39f6, 0x28d0, 0x0713, 0x2aa2, 0x12a6, 0x02fc,
+	    0x4381, 0x4698, 0x0000, 0x2ab0, 0x2005, 0x0000, 0x4d80, 0x43f9,
+	    0x22b0, 0x07a2, 0x0000, 0x2848, 0x216e, 0x0000, 0x22e2, 0x2cc1,
+	    0x0000, 0x3184, 0x057f, 0x2812, 0x3e34, 0x0453, 0x1cc4, 0x1f2a,
+	    0x2a0a, 0x1598, 0x4263, 0x33d6, 0x4cce, 0x2323, 0x2c67, 0x0000,
+	    0x3e8c, 0x2eb8, 0x4695, 0x15ea, 0x16ad, 0x4da7, 0x02f7, 0x4ce8,
+	    0x48c0, 0x34f1, 0x3efb, 0x2d4e, 0x130d, 0x0000, 0x262b, 0x3530,
+	    0x1609, 0x3f69, 0x0000, 0x0000, 0x22ee, 0x07ee, 0x2f64, 0x3214,
+	    0x169c, 0x1be3, 0x0d82, 0x2082, 0x46df, 0x19b1, 0x02d3, 0x1606,
+	    0x32cb, 0x2e5a, 0x026e, 0x4350, 0x0d5a, 0x348e, 0x1948, 0x43b9,
+	    0x3a03, 0x0323, 0x0000, 0x0000, 0x2fed, 0x4359, 0x4855, 0x2ee6,
+	    0x4907, 0x0000, 0x0221, 0x1a5a, 0x2eff, 0x20c3, 0x28f6, 0x1104,
+	    0x4db3, 0x46bf, 0x3222, 0x0183, 0x0000, 0x113e, 0x1f52, 0x0000,
+	    0x1524, 0x3724, 0x0000, 0x2b98, 0x4743, 0x3db6, 0x1311, 0x18f6,
+	    0x174a, 0x3940, 0x1b70, 0x3058, 0x4479, 0x290b, 0x0000, 0x331c,
+	    0x2ea9, 0x1eca, 0x18d9, 0x103e, 0x16a4, 0x17a1, 0x0000, 0x0527,
+	    0x0000, 0x133c, 0x2b9d, 0x2212, 0x0ab8, 0x0479, 0x0754, 0x267a,
+	    0x1826, 0x406b, 0x3780, 0x0000, 0x147d, 0x1cef, 0x3a55, 0x0000,
+	    0x0379, 0x31b3, 0x3a84, 0x453c, 0x0000, 0x102f, 0x47be, 0x3972,
+	    0x0000, 0x268d, 0x0000, 0x4968, 0x0bc3, 0x0000, 0x28f0, 0x4cb8,
+	    0x4c42, 0x4316, 0x38ec, 0x19de, 0x0000, 0x32f1, 0x4c48, 0x2e91,
+	    0x00c1, 0x215e, 0x2e30, 0x0000, 0x49e1, 0x27fe, 0x20b4, 0x2d0c,
+	    0x42ee, 0x0e30, 0x24f0, 0x200f, 0x215b, 0x1304, 0x4346, 0x079d,
+	    0x0000, 0x30cc, 0x4668, 0x1e99, 0x45e5, 0x24a9, 0x01bb, 0x4bfd,
+	    0x0038, 0x2b85, 0x14b5, 0x263d, 0x4651, 0x3194, 0x1ef5, 0x00ba,
+	    0x4267, 0x144d, 0x3439, 0x3ffa, 0x0000, 0x1ba6, 0x32ee, 0x1113,
+	    0x202e, 0x49d8, 0x1fa7, 0x14e6, 0x0d9f, 0x22a6, 0x19d9, 0x4b18,
+	    0x28c0, 0x118f, 0x0000, 0x2c7b, 0x0de3, 0x2c4a, 0x0000, 0x1dba,
+	    0x2263, 0x1b98, 0x3242, 0x418f, 0x0000, 0x286d, 0x42c4, 0x4a6d,
+	    0x143b, 0x0b9c, 0x3768, 0x1e49, 0x3c30, 0x4609, 0x221e, 0x4bd7,
+	    0x1fa4, 0x49ca, 0x310a, 0x0c3b, 0x2bc9, 0x44b3, 0x120f, 0x0000,
+	    0x038a, 0x38b2, 0x3e94, 0x2b36, 0x03f3, 0x1e37, 0x388d, 0x3de3,
+	    0x1e0a, 0x253d, 0x0a0c, 0x3311, 0x269c, 0x2df6, 0x23b3, 0x2415,
+	    0x2629, 0x2ec8, 0x2f38, 0x18fb, 0x3ba1, 0x2623, 0x4547, 0x0000,
+	    0x11a7, 0x08e6, 0x390a, 0x2ad6, 0x005e, 0x3aae, 0x25bb, 0x0000,
+	    0x4720, 0x2db9, 0x0000, 0x422d, 0x32c5, 0x1db6, 0x05e2, 0x44a9,
+	    0x20d8, 0x4705, 0x0000, 0x01d9, 0x4bf8, 0x43c7, 0x2ec9, 0x0000,
+	    0x0000, 0x42f1, 0x3401, 0x0125, 0x13ee, 0x1c7d, 0x0000, 0x052c,
+	    0x0344, 0x23ba, 0x03d6, 0x2908, 0x0bc1, 0x290f, 0x0000, 0x0000,
+	    0x1a2a, 0x0610, 0x20da, 0x17f5, 0x0491, 0x3925, 0x2473, 0x2987,
+	    0x4475, 0x0000, 0x2453, 0x2fd5, 0x0369, 0x3b88, 0x441b, 0x34e8,
+	    0x31db, 0x2025, 0x10b8, 0x0000, 0x49ee, 0x1444, 0x2b5e, 0x0000,
+	    0x0002, 0x3b45, 0x0437, 0x4538, 0x0000, 0x1aed, 0x0000, 0x44fb,
+	    0x0000, 0x1f93, 0x0000, 0x0970, 0x4b62, 0x2e2f, 0x08da, 0x4078,
+	    0x3113, 0x0cb5, 0x36c0, 0x413a, 0x4a48, 0x3cc2, 0x0000, 0x03c1,
+	    0x2d69, 0x0000, 0x3428, 0x382f, 0x2e80, 0x2403, 0x0b2c, 0x0000,
+	    0x197a, 0x274e, 0x4528, 0x0000, 0x0000, 0x0000, 0x07a2, 0x3604,
+	    0x4418, 0x15a9, 0x0b38, 0x0000, 0x2b5f, 0x0bbd, 0x4da5, 0x30f4,
+	    0x0acd, 0x4dae, 0x1dbc, 0x1c65, 0x0000, 0x0000, 0x0000, 0x0a1f,
+	    0x0c3f, 0x0d5b, 0x12c8, 0x00ad, 0x4011, 0x0728, 0x124a, 0x217b,
+	    0x2623, 0x44f3, 0x04c0, 0x3e2b, 0x2dcd, 0x0000, 0x120a, 0x2852,
+	    0x0670, 0x0000, 0x4766, 0x0000, 0x12b9, 0x071c, 0x4a88, 0x0000,
+	    0x3f69, 0x3378, 0x2673, 0x3748, 0x4809, 0x11b0, 0x46ca, 0x4ba1,
+	    0x0000, 0x496c, 0x03b7, 0x2999, 0x2a49, 0x2528, 0x35d5, 0x2789,
+	    0x0000, 0x1e8e, 0x0ac1, 0x48e3, 0x3358, 0x0e5a, 0x1701, 0x2de7,
+	    0x14ca, 0x44f0, 0x4630, 0x07e4, 0x0000, 0x0807, 0x0fc3, 0x30bd,
+	    0x1701, 0x0000, 0x2bf8, 0x0000, 0x0464, 0x2ea7, 0x0000, 0x0ff2,
+	    0x26c3, 0x3922, 0x0000, 0x31b9, 0x485b, 0x22e7, 0x4190, 0x0000,
+	    0x0212, 0x4938, 0x14fa, 0x3d9e, 0x33ec, 0x0e1f, 0x4803, 0x35ef,
+	    0x4c71, 0x1bd7, 0x49e9, 0x4074, 0x0000, 0x4b96, 0x2c2b, 0x2347,
+	    0x18bf, 0x0000, 0x3599, 0x439a, 0x0dce, 0x0000, 0x0d05, 0x2b76,
+	    0x30ab, 0x0000, 0x10e7, 0x4231, 0x294c, 0x2107, 0x3f96, 0x366f,
+	    0x2f8b, 0x0729, 0x183c, 0x1ef2, 0x192e, 0x3aa2, 0x3723, 0x15b6,
+	    0x4607, 0x2a08, 0x34ac, 0x4aff, 0x385e, 0x25d4, 0x3d07, 0x1203,
+	    0x2848, 0x0436, 0x2eba, 0x2251, 0x3b43, 0x0379, 0x0395, 0x280c,
+	    0x2350, 0x419b, 0x3379, 0x025b, 0x0000, 0x148e, 0x0ed6, 0x3a20,
+	    0x3c92, 0x0ded, 0x3fa7, 0x0000, 0x23b0, 0x0000, 0x0000, 0x2d4b,
+	    0x2744, 0x4896, 0x32cb, 0x02b0, 0x3c8b, 0x43e4, 0x4b7a, 0x1978,
+	    0x0000, 0x1910, 0x38e8, 0x4754, 0x0000, 0x16c1, 0x439a, 0x1099,
+	    0x0000, 0x0000, 0x2b46, 0x4df7, 0x29f4, 0x349a, 0x0000, 0x3717,
+	    0x0000, 0x2dc7, 0x3158, 0x1275, 0x480d, 0x1072, 0x1301, 0x0000,
+	    0x35d3, 0x4707, 0x14d0, 0x2693, 0x27f8, 0x2498, 0x2d83, 0x3963,
+	    0x3440, 0x268b, 0x04f7, 0x2cac, 0x19c1, 0x2aaa, 0x2585, 0x2998,
+	    0x0f3e, 0x0000, 0x3652, 0x3357, 0x42ed, 0x172f, 0x16a3, 0x16d6,
+	    0x0000, 0x0339, 0x21a2, 0x3704, 0x38c8, 0x2ed6, 0x2931, 0x0000,
+	    0x0000, 0x17c8, 0x2283, 0x3331, 0x424a, 0x0be2, 0x19bf, 0x3df5,
+	    0x4bdd, 0x3ac0, 0x0000, 0x22f7, 0x2c25, 0x3211, 0x29d6, 0x0489,
+	    0x12ed, 0x045c, 0x16ae, 0x1897, 0x2cf7, 0x0de2, 0x3161, 0x4107,
+	    0x1a41, 0x3adc, 0x0298, 0x0000, 0x0000, 0x01a3, 0x0000, 0x2a70,
+	    0x3c62, 0x2f4a, 0x0000, 0x2730, 0x341e, 0x370f, 0x2eba, 0x442a,
+	    0x4702, 0x2b06, 0x0c1a, 0x4089, 0x1b70, 0x3030, 0x0000, 0x02ce,
+	    0x0000, 0x0000, 0x24c2, 0x06b4, 0x49f2, 0x2a7c, 0x0000, 0x48b6,
+	    0x01e8, 0x0000, 0x0114, 0x3e27, 0x21a7, 0x31f9, 0x0ddf, 0x0000,
+	    0x054a, 0x0000, 0x1c83, 0x4236, 0x2f49, 0x0000, 0x0000, 0x217d,
+	    0x2662, 0x0000, 0x2857, 0x4b36, 0x2746, 0x1d4e, 0x0b06, 0x2469,
+	    0x4cab, 0x23ff, 0x37d2, 0x2f39, 0x3f00, 0x1c2e, 0x0a08, 0x2837,
+	    0x165a, 0x3fd0, 0x0000, 0x18f9, 0x1632, 0x4401, 0x3b62, 0x1a87,
+	    0x225a, 0x2ff6, 0x11bd, 0x3088, 0x41d3, 0x2ee4, 0x343f, 0x03dc,
+	    0x0299, 0x0000, 0x0000, 0x4ad1, 0x0000, 0x0597, 0x294c, 0x478c,
+	    0x441a, 0x045d, 0x0000, 0x0000, 0x1b21, 0x2fd6, 0x3d2f, 0x0501,
+	    0x022d, 0x12a0, 0x326c, 0x4032, 0x314a, 0x2ab0, 0x2caa, 0x3625,
+	    0x2205, 0x4705, 0x46c4, 0x3b0f, 0x1d00, 0x2060, 0x14d1, 0x106a,
+	    0x3e8a, 0x2c4c, 0x40b7, 0x0dfb, 0x0b94, 0x0000, 0x147f, 0x0000,
+	    0x1f84, 0x1af0, 0x0000, 0x20d2, 0x1128, 0x2281, 0x35fa, 0x0000,
+	    0x01b9, 0x3178, 0x0000, 0x0000, 0x147f, 0x44cb, 0x0759, 0x4305,
+	    0x49d2, 0x0000, 0x497f, 0x15de, 0x1a70, 0x45c9, 0x2d1a, 0x4d94,
+	    0x0000, 0x1b31, 0x0a55, 0x023d, 0x35d8, 0x0000, 0x06bd, 0x1a36,
+	    0x24c1, 0x27e7, 0x0000, 0x169d, 0x0000, 0x49c0, 0x188f, 0x27b4,
+	    0x2db3, 0x0319, 0x3655, 0x0c1f, 0x0000, 0x0000, 0x4b60, 0x0000,
+	    0x309a, 0x3fa7, 0x2ea5, 0x44ff, 0x466c, 0x2b94, 0x2b7d, 0x15d1,
+	    0x1f25, 0x2d1a, 0x0a1c, 0x0243, 0x07d0, 0x2a0d, 0x4067, 0x0d9c,
+	    0x2866, 0x0000, 0x4812, 0x2c72, 0x141d, 0x47fc, 0x2696, 0x0915,
+	    0x4a2c, 0x0f9d, 0x26bf, 0x1b3e, 0x1a8c, 0x0000, 0x455a, 0x39f1,
+	    0x408c, 0x0000, 0x2236, 0x3374, 0x4742, 0x06c4, 0x1eda, 0x1a7a,
+	    0x4def, 0x0000, 0x0000, 0x4622, 0x482b, 0x14ea, 0x21e9, 0x37bc,
+	    0x0000, 0x25f1, 0x0000, 0x47de, 0x40ed, 0x1b9d, 0x0000, 0x2bc4,
+	    0x0000, 0x2b7b, 0x1ea7, 0x1bca, 0x0000, 0x3584, 0x0000, 0x3654,
+	    0x0000, 0x0000, 0x2e87, 0x13c6, 0x392e, 0x273b, 0x091b, 0x46bc,
+	    0x0c0a, 0x0000, 0x2a30, 0x1a84, 0x3aa7, 0x424a, 0x4023, 0x3aed,
+	    0x1152, 0x2d6e, 0x3faa, 0x1a1b, 0x3975, 0x3860, 0x1f63, 0x0632,
+	    0x0000, 0x0b03, 0x3119, 0x0d4b, 0x398f, 0x1325, 0x3339, 0x0000,
+	    0x1c5d, 0x0000, 0x2377, 0x276f, 0x0feb, 0x27fc, 0x1d80, 0x33dd,
+	    0x0000, 0x0e71, 0x0000, 0x30da, 0x2bd9, 0x0528, 0x3019, 0x0b0b,
+	    0x4c1b, 0x4c37, 0x4b89, 0x4636, 0x03c4, 0x2303, 0x0000, 0x1ada,
+	    0x0000, 0x093e, 0x1a09, 0x3276, 0x3c24, 0x45ad, 0x1f3e, 0x01bb,
+	    0x0000, 0x2521, 0x4990, 0x0bb4, 0x0d68, 0x21f4, 0x2983, 0x0000,
+	    0x38c3, 0x0cff, 0x0000, 0x0d68, 0x2ec3, 0x0000, 0x3770, 0x0824,
+	    0x2eb3, 0x0000, 0x4d04, 0x0000, 0x104d, 0x13ae, 0x2c54, 0x4326,
+	    0x45e9, 0x2c68, 0x1816, 0x0000, 0x4007, 0x1cf6, 0x0879, 0x00e3,
+	    0x22e6, 0x0a2e, 0x4d1c, 0x02ae, 0x216b, 0x0cb1, 0x0a07, 0x4c2f,
+	    0x0827, 0x489d, 0x1026, 0x391c, 0x1351, 0x0000, 0x1567, 0x1dcc,
+	    0x1113, 0x22c5, 0x0cd0, 0x34b0, 0x242e, 0x23c9, 0x2ea1, 0x2aa8,
+	    0x4cc4, 0x3319, 0x1043, 0x0000, 0x1ebc, 0x0000, 0x294c, 0x0000,
+	    0x38bc, 0x0e49, 0x3f86, 0x016c, 0x0401, 0x0000, 0x1e2b, 0x2fff,
+	    0x42b9, 0x4327, 0x2516, 0x31d6, 0x3316, 0x2088, 0x05ed, 0x15cc,
+	    0x0bb5, 0x09e0, 0x1f41, 0x0f86, 0x3d00, 0x1e4d, 0x0439, 0x1732,
+	    0x0000, 0x4bac, 0x2a88, 0x0000, 0x4361, 0x0000, 0x390d, 0x3ff5,
+	    0x0ba3, 0x05ab, 0x21d1, 0x46af, 0x0000, 0x0494, 0x3f5c, 0x13b5,
+	    0x256b, 0x0085, 0x0000, 0x1493, 0x05cd, 0x2eb0, 0x0000, 0x01f8,
+	    0x436a, 0x181f, 0x3737, 0x390d, 0x2e89, 0x3006, 0x2fa3, 0x28ed,
+	    0x0fa4, 0x0000, 0x1139, 0x276b, 0x3241, 0x225e, 0x0000, 0x0000,
+	    0x42c4, 0x015d, 0x19ad, 0x1fb9, 0x0ee0, 0x4b8c, 0x285f, 0x0000,
+	    0x02f1, 0x0000, 0x18f3, 0x0f35, 0x41a9, 0x3167, 0x2aa1, 0x0000,
+	    0x4295, 0x22bd, 0x112d, 0x179c, 0x3aa0, 0x0000, 0x0000, 0x05dc,
+	    0x2c25, 0x3fbc, 0x4b1e, 0x2297, 0x4da2, 0x15b6, 0x46ef, 0x0452,
+	    0x0d1c, 0x15a6, 0x1f74, 0x3a84, 0x02bf, 0x4605, 0x3a73, 0x0dcc,
+	    0x1cd2, 0x0357, 0x4247, 0x291c, 0x0637, 0x46f9, 0x3909, 0x42a9,
+	    0x26d2, 0x3862, 0x39b6, 0x35d7, 0x23b2, 0x46e9, 0x110f, 0x051e,
+	    0x20c2, 0x45a6, 0x2185, 0x0000, 0x3f2f, 0x0556, 0x3bb7, 0x0578,
+	    0x3901, 0x12ad, 0x14b1, 0x0f5b, 0x3b23, 0x35cb, 0x2735, 0x3841,
+	    0x1c68, 0x063c, 0x29a9, 0x37ca, 0x48d8, 0x3ef1, 0x4666, 0x33e6,
+	    0x39a9, 0x0f03, 0x0000, 0x1f7e, 0x02f8, 0x0000, 0x09a0, 0x10b6,
+	    0x05ba, 0x4549, 0x16cb, 0x33b4, 0x4180, 0x0000, 0x1b3a, 0x0000,
+	    0x008a, 0x2837, 0x2a1e, 0x4394, 0x0000, 0x1f79, 0x1687, 0x05c1,
+	    0x0000, 0x197c, 0x2192, 0x0801, 0x2b28, 0x1679, 0x16f8, 0x327e,
+	    0x256b, 0x0000, 0x4042, 0x132e, 0x0000, 0x281c, 0x3230, 0x18be,
+	    0x2586, 0x36bd, 0x19ca, 0x1399, 0x139b, 0x1fc1, 0x0000, 0x0dc6,
+	    0x159b, 0x3728, 0x1607, 0x1439, 0x3565, 0x442e, 0x2761, 0x0325,
+	    0x13b9, 0x36f0, 0x3066, 0x2519, 0x117f, 0x256c, 0x3527, 0x0000,
+	    0x0d62, 0x116d, 0x0559, 0x17f8, 0x4d79, 0x14c3, 0x32c7, 0x1b92,
+	    0x15c6, 0x270b, 0x41ab, 0x33a6, 0x48c2, 0x0000, 0x0e04, 0x3614,
+	    0x3075, 0x0031, 0x318c, 0x34cf, 0x0728, 0x1521, 0x45d4, 0x4269,
+	    0x10a9, 0x4bcd, 0x45d0, 0x24d4, 0x2c07, 0x4d29, 0x1352, 0x3b17,
+	    0x4111, 0x4ccd, 0x3748, 0x0c4e, 0x0000, 0x0d4e, 0x13ce, 0x3319,
+	    0x4a2a, 0x0000, 0x123e, 0x4a13, 0x4914, 0x150a, 0x0d61, 0x4268,
+	    0x2adf, 0x467b, 0x2b60, 0x0000, 0x3b9d, 0x2869, 0x1110, 0x0d79,
+	    0x1b78, 0x0d88, 0x20fb, 0x22b0, 0x1800, 0x1731, 0x113f, 0x337a,
+	    0x0000, 0x4219, 0x401e, 0x1f80, 0x162c, 0x00b1, 0x394f, 0x18bd,
+	    0x138a, 0x223c, 0x2dee, 0x0000, 0x49fd, 0x1a84, 0x0000, 0x0000,
+	    0x0e68, 0x1637, 0x01de, 0x0000, 0x0000, 0x2cce, 0x0bf0, 0x0000,
+	    0x07cf, 0x0c89, 0x1ea1, 0x0c52, 0x066c, 0x4e10, 0x3c23, 0x300c,
+	    0x072d, 0x3054, 0x198c, 0x106f, 0x1e7c, 0x0b7e, 0x0579, 0x0000,
+	    0x2027, 0x0000, 0x0e19, 0x47f2, 0x27f8, 0x0def, 0x068b, 0x1ec9,
+	    0x0000, 0x3752, 0x0b7b, 0x3365, 0x0000, 0x37ff, 0x0588, 0x39fa,
+	    0x3350, 0x3e17, 0x1ff5, 0x0fcf, 0x09ae, 0x21d0, 0x0000, 0x301e,
+	    0x4b78, 0x28e1, 0x3c54, 0x3ea8, 0x3994, 0x1b36, 0x0016, 0x1750,
+	    0x023b, 0x256a, 0x0000, 0x2500, 0x0cf3, 0x44a0, 0x0000, 0x0000,
+	    0x0be8, 0x4121, 0x027b, 0x3e1a, 0x44f2, 0x0000, 0x1f84, 0x1335,
+	    0x0000, 0x01fc, 0x22e8, 0x0000, 0x1b37, 0x1dd1, 0x10aa, 0x06a5,
+	    0x3039, 0x156c, 0x3e2b, 0x1ebe, 0x38c0, 0x0b8f, 0x1fe3, 0x078e,
+	    0x385f, 0x0000, 0x12ca, 0x2743, 0x0f04, 0x0000, 0x27d5, 0x1e0d,
+	    0x10d9, 0x0717, 0x087e, 0x4610, 0x05e1, 0x3726, 0x42da, 0x34aa,
+	    0x2a5b, 0x4d93, 0x26af, 0x16cc, 0x1ca1, 0x307a, 0x0000, 0x4b83,
+	    0x3574, 0x20cd, 0x1668, 0x4178, 0x38e0, 0x40e8, 0x44ef, 0x2c2c,
+	    0x2e7a, 0x3cc9, 0x25a1, 0x092e, 0x0879, 0x0000, 0x0bf4, 0x3ed2,
+	    0x3cb3, 0x299e, 0x0000, 0x18c4, 0x0000, 0x069b, 0x0912, 0x0b3e,
+	    0x25ce, 0x0ae4, 0x4ca9, 0x46ce, 0x49fc, 0x3ae1, 0x3cf2, 0x40cd,
+	    0x1ac7, 0x44a0, 0x0000, 0x218a, 0x3800, 0x0000, 0x179b, 0x22a0,
+	    0x2b2a, 0x4386, 0x06b3, 0x46f7, 0x2cc5, 0x0533, 0x1d58, 0x4749,
+	    0x2685, 0x1357, 0x42f0, 0x3b1d, 0x051f, 0x16e9, 0x1239, 0x039d,
+	    0x3464, 0x1fc4, 0x0458, 0x43ff, 0x10ca, 0x3b49, 0x21de, 0x06b3,
+	    0x09df, 0x10dd, 0x2083, 0x0000, 0x16bc, 0x08dc, 0x0000, 0x0281,
+	    0x2f2b, 0x14f4, 0x3db2, 0x46f6, 0x0000, 0x0000, 0x3856, 0x276b,
+	    0x2e24, 0x066d, 0x36a7, 0x1a29, 0x0000, 0x0200, 0x1e02, 0x1b0d,
+	    0x1604, 0x083f, 0x354a, 0x0000, 0x0000, 0x2d6a, 0x0272, 0x1558,
+	    0x1686, 0x099b, 0x476a, 0x229c, 0x39db, 0x185e, 0x3e66, 0x1564,
+	    0x0b54, 0x2621, 0x3a73, 0x183e, 0x4cbc, 0x28b3, 0x0000, 0x02c0,
+	    0x3393, 0x4dc6, 0x0000, 0x0000, 0x4578, 0x31f5, 0x3457, 0x192d,
+	    0x08c3, 0x0f90, 0x1a93, 0x1ee8, 0x3e98, 0x006d, 0x0c4b, 0x3d1e,
+	    0x2f1b, 0x0000, 0x4000, 0x133f, 0x32d9, 0x2218, 0x4b70, 0x1ade,
+	    0x0443, 0x4af6, 0x1312, 0x0000, 0x2a5d, 0x40ef, 0x2f88, 0x1ffa,
+	    0x35c5, 0x0706, 0x2d4e, 0x0c0c, 0x0be7, 0x3b99, 0x0000, 0x39ca,
+	    0x480b, 0x0fc1, 0x0000, 0x0000, 0x3408, 0x3c65, 0x072e, 0x0000,
+	    0x46ab, 0x3203, 0x4468, 0x1746, 0x343a, 0x0ac4, 0x4bbf, 0x0709,
+	    0x1e9b, 0x442c, 0x30ba, 0x3f83, 0x21b8, 0x0000, 0x27f7, 0x03c3,
+	    0x2f3e, 0x4b96, 0x0442, 0x35fb, 0x3814, 0x28e9, 0x266b, 0x2e57,
+	    0x1437, 0x1820, 0x4862, 0x2944, 0x0706, 0x4b2e, 0x002e, 0x0000,
+	    0x0000, 0x24a8, 0x100d, 0x3fec, 0x1e71, 0x00ee, 0x0c80, 0x1c60,
+	    0x472e, 0x3b2f, 0x1364, 0x4923, 0x3cb4, 0x0da0, 0x0a36, 0x1d9c,
+	    0x3245, 0x42f3, 0x44fb, 0x2b58, 0x0000, 0x3388, 0x2e72, 0x2388,
+	    0x27a7, 0x23e7, 0x4741, 0x420a, 0x18f3, 0x1cff, 0x0000, 0x15db,
+	    0x420a, 0x1215, 0x2726, 0x4298, 0x4c3d, 0x0000, 0x3c7b, 0x4b88,
+	    0x3893, 0x03e5, 0x07a6, 0x0000, 0x0647, 0x4acf, 0x22e4, 0x3361,
+	    0x1138, 0x0000, 0x13e6, 0x0b06, 0x1a1d, 0x4349, 0x450f, 0x041d,
+	    0x148e, 0x4258, 0x4701, 0x0000, 0x243e, 0x1b72, 0x1700, 0x34d5,
+	    0x0678, 0x3e79, 0x0777, 0x113e, 0x2fad, 0x3a67, 0x07dd, 0x0514,
+	    0x0000, 0x0ccf, 0x2fca, 0x29d1, 0x0000, 0x14a7, 0x0696, 0x2fb9,
+	    0x0000, 0x43f6, 0x2182, 0x28f7, 0x2204, 0x22ba, 0x282c, 0x1561,
+	    0x0000, 0x2c26, 0x4356, 0x0000, 0x0c7b, 0x0e0e, 0x3f47, 0x0000,
+	    0x0000, 0x0833, 0x36e1, 0x0000, 0x2f2a, 0x3801, 0x0a8e, 0x2acf,
+	    0x0482, 0x2a10, 0x0000, 0x3c7c, 0x0000, 0x1b2b, 0x3f0c, 0x3c72,
+	    0x24ef, 0x27d5, 0x21a9, 0x0000, 0x3b5b, 0x38e4, 0x0000, 0x0000,
+	    0x21f7, 0x09c6, 0x1c92, 0x3236, 0x327b, 0x0000, 0x342a, 0x0000,
+	    0x36b6, 0x0000, 0x4859, 0x20f3, 0x4a0c, 0x0000, 0x0f1e, 0x477c,
+	    0x0120, 0x17b3, 0x3fc7, 0x07ee, 0x3ea4, 0x46a8, 0x0000, 0x3f74,
+	    0x2c62, 0x4183, 0x0000, 0x0000, 0x0aa6, 0x311b, 0x245e, 0x25bd,
+	    0x2e02, 0x48e1, 0x005e, 0x0000, 0x0000, 0x4664, 0x2b83, 0x1bc5,
+	    0x0000, 0x0000, 0x3284, 0x0fb4, 0x22cc, 0x1c3e, 0x0192, 0x1c01,
+	    0x440f, 0x0000, 0x0eac, 0x0e00, 0x1cd8, 0x4085, 0x0052, 0x1fdc,
+	    0x404b, 0x18b3, 0x211b, 0x4c13, 0x4798, 0x0000, 0x3191, 0x4c6e,
+	    0x0361, 0x07bf, 0x1748, 0x3abf, 0x459b, 0x1fae, 0x3142, 0x1d1f,
+	    0x0000, 0x2397, 0x2508, 0x03b2, 0x0000, 0x459f, 0x126f, 0x28be,
+	    0x0d68, 0x440e, 0x49c1, 0x3844, 0x2711, 0x42d0, 0x21ec, 0x28c0,
+	    0x0522, 0x3656, 0x3038, 0x230d, 0x2765, 0x2828, 0x0000, 0x073a,
+	    0x0284, 0x1212, 0x0000, 0x372e, 0x306b, 0x0620, 0x2bb9, 0x4d77,
+	    0x12b1, 0x4680, 0x25e5, 0x37d2, 0x0000, 0x393c, 0x0000, 0x3589,
+	    0x11dc, 0x48f1, 0x205d, 0x232f, 0x0000, 0x3a4c, 0x4357, 0x0e19,
+	    0x46e6, 0x4274, 0x256e, 0x0a6c, 0x39cf, 0x4997, 0x208b, 0x0000,
+	    0x0000, 0x0b89, 0x0000, 0x09c1, 0x0d04, 0x2435, 0x0000, 0x2bac,
+	    0x0a7a, 0x4613, 0x1e55, 0x3c11, 0x0000, 0x03a1, 0x0000, 0x0524,
+	    0x3ae2, 0x20cb, 0x246e, 0x263d, 0x4aba, 0x3a37, 0x0000, 0x32c1,
+	    0x3247, 0x31f9, 0x09fd, 0x0c2c, 0x41c8, 0x0000, 0x171d, 0x4147,
+	    0x0000, 0x1c99, 0x2c6a, 0x0000, 0x4c39, 0x2599, 0x41ca, 0x1c7f,
+	    0x4990, 0x3f5d, 0x046b, 0x0e67, 0x0759, 0x2a70, 0x2538, 0x4433,
+	    0x1d28, 0x3437, 0x0688, 0x341b, 0x3dc4, 0x299a, 0x089d, 0x3eba,
+	    0x1fdf, 0x3fb8, 0x0f8c, 0x27c2, 0x20e7, 0x13d1, 0x3c1e, 0x13f4,
+	    0x36d3, 0x0da3, 0x2fef, 0x2417, 0x330d, 0x0096, 0x0000, 0x2172,
+	    0x44fd, 0x0000, 0x0000, 0x46b0, 0x3f9b, 0x42a5, 0x2db7, 0x0000,
+	    0x4a8b, 0x01fa, 0x20ee, 0x2e44, 0x360a, 0x4d26, 0x0000, 0x1849,
+	    0x3171, 0x1c8f, 0x0000, 0x0000, 0x0000, 0x13c8, 0x470c, 0x381a,
+	    0x0000, 0x0daa, 0x254d, 0x03bf, 0x1ba2, 0x4c89, 0x2a8b, 0x3991,
+	    0x3419, 0x2f5f, 0x3863, 0x394e, 0x35bf, 0x4006, 0x0000, 0x36c1,
+	    0x143b, 0x43c1, 0x236b, 0x3c60, 0x0b68, 0x2f8d, 0x1a3a, 0x3556,
+	    0x17d9, 0x0db3, 0x0059, 0x274a, 0x332e, 0x4969, 0x0000, 0x0000,
+	    0x0000, 0x3064, 0x0000, 0x3616, 0x1fe2, 0x0549, 0x03fa, 0x0f2c,
+	    0x0000, 0x08de, 0x2a67, 0x0b24, 0x3cbb, 0x43e2, 0x3ccc, 0x0188,
+	    0x1772, 0x2e7a, 0x3160, 0x2a4d, 0x3685, 0x4be7, 0x0373, 0x1734,
+	    0x130a, 0x4c74, 0x03fb, 0x2f50, 0x1123, 0x43a4, 0x365c, 0x0000,
+	    0x06cd, 0x0000, 0x0319, 0x0f58, 0x0000, 0x003d, 0x3566, 0x0423,
+	    0x388e, 0x4da9, 0x2d5a, 0x4751, 0x17bf, 0x40b0, 0x0000, 0x0d30,
+	    0x3b25, 0x1033, 0x33c6, 0x4ac9, 0x1e6e, 0x3e25, 0x229d, 0x3934,
+	    0x2ac1, 0x1a0e, 0x4290, 0x20f1, 0x0e60, 0x2df7, 0x1d63, 0x0842,
+	    0x157e, 0x25f8, 0x0000, 0x08f2, 0x41b2, 0x4c9d, 0x055b, 0x1653,
+	    0x4864, 0x1d30, 0x0ff4, 0x0ae5, 0x099c, 0x0000, 0x3950, 0x2023,
+	    0x0000, 0x0000, 0x2103, 0x4576, 0x435a, 0x0000, 0x3657, 0x48fa,
+	    0x4825, 0x4abd, 0x0000, 0x06ad, 0x1420, 0x44fb, 0x218c, 0x0000,
+	    0x0000, 0x2e0e, 0x1efd, 0x307b, 0x0d3c, 0x0000, 0x4091, 0x3c39,
+	    0x4590, 0x3c03, 0x27ec, 0x2559, 0x0542, 0x183c, 0x0000, 0x0000,
+	    0x0e20, 0x39fc, 0x4a69, 0x4d55, 0x34c2, 0x0000, 0x0225, 0x0000,
+	    0x040c, 0x08e5, 0x0342, 0x1402, 0x009e, 0x0000, 0x0184, 0x3eeb,
+	    0x22d4, 0x0000, 0x0209, 0x1ff4, 0x4103, 0x1d7d, 0x378f, 0x4626,
+	    0x1594, 0x3eb0, 0x1403, 0x0000, 0x22fd, 0x3fee, 0x2516, 0x25f2,
+	    0x1fdd, 0x0000, 0x0000, 0x3fe9, 0x0000, 0x0000, 0x0e0a, 0x40c1,
+	    0x4d92, 0x1f08, 0x1696, 0x0000, 0x0000, 0x22b0, 0x0000, 0x2a59,
+	    0x022b, 0x2e85, 0x4003, 0x304c, 0x4936, 0x2e35, 0x0000, 0x0199,
+	    0x4c86, 0x4370, 0x21a8, 0x0000, 0x3ff9, 0x4ac6, 0x2ba5, 0x3381,
+	    0x1eb6, 0x290f, 0x1118, 0x4ab6, 0x16cb, 0x0709, 0x0e70, 0x0000,
+	    0x28b0, 0x3ecb, 0x08ba, 0x3d85, 0x145a, 0x2d29, 0x100a, 0x4bd1,
+	    0x215d, 0x3147, 0x0000, 0x3806, 0x0000, 0x3d1a, 0x231a, 0x39b4,
+	    0x44a7, 0x4bd0, 0x03eb, 0x43b7, 0x2a3f, 0x1d7e, 0x210f, 0x1f5d,
+	    0x42ff, 0x25c5, 0x396f, 0x2fe5, 0x23d0, 0x28b1, 0x4027, 0x1cb5,
+	    0x0e7e, 0x2bda, 0x1c16, 0x03de, 0x0d20, 0x2f19, 0x4b62, 0x0863,
+	    0x048a, 0x432a, 0x3520, 0x28af, 0x383b, 0x0000, 0x1ef7, 0x0c76,
+	    0x15c4, 0x2fc9, 0x3802, 0x1581, 0x4207, 0x1a23, 0x0000, 0x3e86,
+	    0x220f, 0x0000, 0x0d3f, 0x1572, 0x0000, 0x4434, 0x08b5, 0x0de5,
+	    0x0000, 0x115e, 0x4a30, 0x0000, 0x0000, 0x3067, 0x0000, 0x2fba,
+	    0x098b, 0x46a9, 0x46c2, 0x46a4, 0x3f1e, 0x31c4, 0x10d4, 0x018c,
+	    0x07cb, 0x00a9, 0x0000, 0x22c0, 0x026b, 0x4a5e, 0x0eb4, 0x2e83,
+	    0x0c9d, 0x0000, 0x42fe, 0x496c, 0x0ea9, 0x0000, 0x1481, 0x3f91,
+	    0x15ab, 0x37e1, 0x2193, 0x0000, 0x3303, 0x33f9, 0x2b55, 0x4b2f,
+	    0x4354, 0x4962, 0x26b1, 0x22e8, 0x2a64, 0x2a14, 0x3467, 0x2cd4,
+	    0x2bb6, 0x0000, 0x0000, 0x00a6, 0x484c, 0x0000, 0x0b08, 0x3753,
+	    0x2685, 0x36e5, 0x40bf, 0x0f03, 0x4a50, 0x0c47, 0x2ff2, 0x45c7,
+	    0x0000, 0x494c, 0x405a, 0x2cfe, 0x173e, 0x3d22, 0x0000, 0x4455,
+	    0x135b, 0x1680, 0x4972, 0x48cf, 0x4db0, 0x2a28, 0x1c4d, 0x14ce,
+	    0x4cf9, 0x1b78, 0x00aa, 0x0331, 0x36b0, 0x4db3, 0x1a84, 0x289f,
+	    0x0000, 0x36cf, 0x3dc9, 0x2176, 0x3bdb, 0x0f0a, 0x3933, 0x2bfc,
+	    0x2b18, 0x19f2, 0x27b0, 0x0d40, 0x422e, 0x4b27, 0x063a, 0x1c50,
+	    0x044b, 0x2913, 0x2594, 0x0116, 0x4c95, 0x0000, 0x2d9f, 0x302b,
+	    0x1304, 0x1739, 0x35f7, 0x2cb5, 0x16c6, 0x2cb1, 0x46d4, 0x1e10,
+	    0x4b54, 0x4586, 0x2c0f, 0x172d, 0x34d8, 0x3853, 0x3f76, 0x2cef,
+	    0x12b8, 0x13be, 0x20f9, 0x0000, 0x0000, 0x0000, 0x3779, 0x0000,
+	    0x2ce5, 0x3d53, 0x21ab, 0x0cff, 0x257e, 0x1ea2, 0x0000, 0x0000,
+	    0x378a, 0x3e80, 0x420c, 0x3292, 0x0000, 0x4c5f, 0x1e59, 0x23dc,
+	    0x0000, 0x3603, 0x21b0, 0x2e57, 0x0000, 0x1b7a, 0x3087, 0x0869,
+	    0x343b, 0x2c91, 0x0618, 0x32ea, 0x2ccd, 0x0032, 0x216e, 0x1603,
+	    0x3ee6, 0x30a9, 0x49cb, 0x3920, 0x31db, 0x05e2, 0x3f94, 0x0dbf,
+	    0x0000, 0x3c9d, 0x0000, 0x05ff, 0x2dfc, 0x4d06, 0x0854, 0x1e1b,
+	    0x1191, 0x0000, 0x2304, 0x2087, 0x37da, 0x10fb, 0x0dc5, 0x2548,
+	    0x1590, 0x2b2f, 0x37ab, 0x4605, 0x36ce, 0x0000, 0x17c2, 0x0000,
+	    0x0000, 0x417b, 0x293d, 0x225c, 0x14d1, 0x0de8, 0x01e5, 0x01db,
+	    0x04ea, 0x07a9, 0x0000, 0x0683, 0x27ca, 0x0000, 0x3155, 0x0000,
+	    0x0000, 0x1f54, 0x1e7a, 0x0000, 0x2665, 0x1d50, 0x340a, 0x1fd2,
+	    0x4a8d, 0x0000, 0x4c85, 0x0000, 0x0e72, 0x1ed2, 0x47fc, 0x0000,
+	    0x4ac7, 0x3c16, 0x0df2, 0x0000, 0x4022, 0x0769, 0x014e, 0x371b,
+	    0x3d24, 0x25bc, 0x287f, 0x065e, 0x2576, 0x1b49, 0x47ca, 0x4b8d,
+	    0x1171, 0x3cfd, 0x484b, 0x044c, 0x0000, 0x1397, 0x102f, 0x1df4,
+	    0x3359, 0x0000, 0x09fa, 0x41bf, 0x49cd, 0x0a38, 0x1835, 0x1552,
+	    0x2a85, 0x4ce0, 0x3188, 0x02d2, 0x0747, 0x19b2, 0x0000, 0x01bf,
+	    0x0000, 0x2b5b, 0x2539, 0x359a, 0x205f, 0x2bd9, 0x3e0e, 0x076d,
+	    0x262d, 0x0000, 0x0000, 0x466f, 0x20c7, 0x0000, 0x2c60, 0x0b43,
+	    0x0c87, 0x0000, 0x1bc0, 0x4736, 0x3744, 0x0181, 0x0844, 0x3442,
+	    0x10b7, 0x0000, 0x40e4, 0x255f, 0x0000, 0x3ff1, 0x186d, 0x320e,
+	    0x4a2f, 0x0f29, 0x4a6f, 0x2bdd, 0x34db, 0x3fbb, 0x4733, 0x0411,
+	    0x4468, 0x07c2, 0x012f, 0x3e8b, 0x0514, 0x4b83, 0x0840, 0x0000,
+	    0x2855, 0x2677, 0x4b81, 0x0000, 0x26a3, 0x1859, 0x282e, 0x427e,
+	    0x47d6, 0x1079, 0x2cb1, 0x071b, 0x0000, 0x3ed5, 0x36ad, 0x3f28,
+	    0x274f, 0x3b8a, 0x3c62, 0x1ff0, 0x478a, 0x0000, 0x2151, 0x2b71,
+	    0x30d5, 0x2c94, 0x2d64, 0x4bc7, 0x1094, 0x1fd1, 0x18e8, 0x0ac3,
+	    0x00b8, 0x2f49, 0x0000, 0x150e, 0x0000, 0x0dc7, 0x3060, 0x0000,
+	    0x0000, 0x3032, 0x3e1c, 0x1514, 0x3502, 0x0000, 0x03fa, 0x0000,
+	    0x0372, 0x207d, 0x14b3, 0x115c, 0x29a0, 0x4a1d, 0x1abc, 0x3601,
+	    0x270a, 0x3281, 0x4cd4, 0x0000, 0x4dd6, 0x4d28, 0x0b33, 0x0ed7,
+	    0x3339, 0x1ff1, 0x4caa, 0x175f, 0x2edd, 0x01ac, 0x3fd3, 0x1653,
+	    0x3607, 0x3517, 0x0000, 0x4265, 0x3760, 0x05fb, 0x3154, 0x1dc4,
+	    0x2e2c, 0x0000, 0x29b5, 0x440d, 0x3be5, 0x3358, 0x1608, 0x3ab6,
+	    0x23c8, 0x2548, 0x10bb, 0x0000, 0x37a0, 0x0e5f, 0x48d3, 0x311d,
+	    0x0000, 0x0113, 0x42d9, 0x2a38, 0x15f2, 0x3f24, 0x38c9, 0x25a6,
+	    0x209e, 0x0000, 0x0000, 0x0f72, 0x19eb, 0x171a, 0x0000, 0x0000,
+	    0x35ee, 0x2bbc, 0x2eab, 0x0000, 0x2377, 0x4523, 0x1ef0, 0x111a,
+	    0x0390, 0x1493, 0x0000, 0x014c, 0x2e35, 0x0000, 0x0000, 0x1893,
+	    0x0000, 0x1bd6, 0x1a0e, 0x34fa, 0x403e, 0x17b9, 0x2d05, 0x4a4d,
+	    0x2fdd, 0x28ea, 0x260b, 0x1cff, 0x3c18, 0x0000, 0x29f2, 0x4c02,
+	    0x0000, 0x46a5, 0x1a42, 0x3b4b, 0x1096, 0x3439, 0x4af5, 0x1382,
+	    0x0000, 0x111b, 0x33f6, 0x1a4a, 0x0000, 0x1c45, 0x376f, 0x42bf,
+	    0x1311, 0x0cff, 0x32a6, 0x1c12, 0x202b, 0x11ec, 0x0570, 0x4ba1,
+	    0x46fa, 0x1fc2, 0x273f, 0x0b64, 0x0f1a, 0x4be4, 0x4633, 0x0000,
+	    0x1dd8, 0x0000, 0x0590, 0x3e67, 0x2c73, 0x4916, 0x4690, 0x3be3,
+	    0x0000, 0x115e, 0x0000, 0x39ae, 0x2188, 0x472b, 0x073d, 0x37cb,
+	    0x0000, 0x1316, 0x0000, 0x0565, 0x1d49, 0x043e, 0x2052, 0x2812,
+	    0x39b7, 0x0180, 0x06a6, 0x2ea0, 0x28a9, 0x394f, 0x2b5f, 0x2a95,
+	    0x448b, 0x175d, 0x280a, 0x0483, 0x0000, 0x09ad, 0x0000, 0x25b5,
+	    0x1c9e, 0x0000, 0x0000, 0x4a4b, 0x1907, 0x10a3, 0x100f, 0x1940,
+	    0x4890, 0x436c, 0x0d93, 0x0538, 0x4633, 0x04c9, 0x211b, 0x3a38,
+	    0x3359, 0x1dd7, 0x441c, 0x3a50, 0x27a2, 0x4af0, 0x2165, 0x0000,
+	    0x31d7, 0x40b9, 0x323a, 0x0025, 0x37c2, 0x46f2, 0x22eb, 0x32b8,
+	    0x0000, 0x0000, 0x0511, 0x292e, 0x215e, 0x23b7, 0x1c98, 0x0000,
+	    0x4dc1, 0x10ac, 0x187c, 0x1541, 0x0000, 0x24ad, 0x1304, 0x3a20,
+	    0x3c3a, 0x24a6, 0x3ff4, 0x3b18, 0x2e59, 0x4c01, 0x3bb0, 0x0000,
+	    0x3663, 0x163b, 0x4549, 0x2911, 0x49b5, 0x2414, 0x3b68, 0x0483,
+	    0x25ad, 0x40d1, 0x4ba1, 0x2698, 0x3bc2, 0x07d6, 0x0000, 0x3994,
+	    0x1d97, 0x3cdb, 0x47d1, 0x0e21, 0x372e, 0x0586, 0x22c0, 0x435f,
+	    0x14c2, 0x0000, 0x32d0, 0x4c16, 0x2ec8, 0x20cf, 0x0000, 0x07de,
+	    0x2631, 0x0de3, 0x33da, 0x4bf2, 0x0444, 0x08e0, 0x0000, 0x3915,
+	    0x3a05, 0x373d, 0x2046, 0x18f4, 0x03e7, 0x0000, 0x0000, 0x3b7a,
+	    0x04f5, 0x3b73, 0x2f86, 0x44a3, 0x0000, 0x4115, 0x052b, 0x31e5,
+	    0x3206, 0x036a, 0x1178, 0x33dc, 0x1d35, 0x226a, 0x3e1e, 0x3ce6,
+	    0x0282, 0x456e, 0x2d1e, 0x1637, 0x06bd, 0x0962, 0x0000, 0x0a7c,
+	    0x2284, 0x328c, 0x29d6, 0x365a, 0x29ae, 0x3b4e, 0x13cd, 0x48bc,
+	    0x0000, 0x1a8a, 0x0000, 0x3d99, 0x1c1d, 0x1711, 0x021c, 0x1ae4,
+	    0x2b67, 0x4dc9, 0x11e7, 0x0000, 0x420b, 0x2458, 0x0000, 0x24f0,
+	    0x44d1, 0x36bb, 0x43be, 0x18cd, 0x490f, 0x4a05, 0x0000, 0x30cb,
+	    0x4385, 0x2598, 0x070b, 0x3f4a, 0x0bee, 0x3d6c, 0x49fb, 0x2fe6,
+	    0x0000, 0x30f6, 0x3169, 0x40fe, 0x0930, 0x3cf0, 0x1c7f, 0x2914,
+	    0x0000, 0x3de9, 0x1d42, 0x1c34, 0x056a, 0x0e6a, 0x4b54, 0x1a30,
+	    0x0000, 0x0c73, 0x1ac3, 0x3769, 0x4844, 0x235f, 0x09a5, 0x118f,
+	    0x48c2, 0x39e8, 0x09eb, 0x2eeb, 0x1dc3, 0x0000, 0x0b17, 0x05a1,
+	    0x2b40, 0x339a, 0x0000, 0x0000, 0x1361, 0x393b, 0x39e1, 0x0000,
+	    0x2dcf, 0x3354, 0x1946, 0x1657, 0x0000, 0x42b5, 0x05b2, 0x0000,
+	    0x0d6d, 0x0000, 0x04cf, 0x470a, 0x0000, 0x13db, 0x21fb, 0x2ad4,
+	    0x3df6, 0x1582, 0x03c2, 0x0000, 0x24e3, 0x005b, 0x44c5, 0x0000,
+	    0x2d75, 0x0000, 0x0808, 0x27df, 0x0000, 0x4750, 0x2785, 0x1ffd,
+	    0x0000, 0x0000, 0x2452, 0x0000, 0x19bf, 0x0f6d, 0x32f3, 0x20ab,
+	    0x05e6, 0x2681, 0x43e8, 0x0000, 0x433b, 0x0d52, 0x4db9, 0x3dca,
+	    0x0c2b, 0x0283, 0x0000, 0x4b08, 0x0ab2, 0x4151, 0x2a4d, 0x18b4,
+	    0x0000, 0x3de5, 0x1fad, 0x3df6, 0x0d53, 0x0000, 0x3ed7, 0x2a74,
+	    0x4515, 0x3fc6, 0x0024, 0x0ad9, 0x28fd, 0x021f, 0x3ada, 0x3cae,
+	    0x3770, 0x0000, 0x05fc, 0x0770, 0x2702, 0x4214, 0x3250, 0x0bf9,
+	    0x049c, 0x1baa, 0x37d0, 0x45ed, 0x3d70, 0x322f, 0x147b, 0x4245,
+	    0x1bc7, 0x1866, 0x3555, 0x271a, 0x2750, 0x026c, 0x0000, 0x1d24,
+	    0x3ca9, 0x02d7, 0x39be, 0x2eec, 0x2162, 0x0000, 0x2334, 0x2e47,
+	    0x2929, 0x179c, 0x0000, 0x1aa1, 0x3532, 0x486c, 0x4a8f, 0x2c33,
+	    0x17b9, 0x3013, 0x219f, 0x0e41, 0x1877, 0x0742, 0x0e7e, 0x408f,
+	    0x30fb, 0x2c4f, 0x4cdc, 0x18c8, 0x1ab3, 0x0000, 0x45fd, 0x0000,
+	    0x253e, 0x0000, 0x1eb7, 0x2753, 0x0ea2, 0x1a3a, 0x3e01, 0x357d,
+	    0x07cd, 0x0000, 0x2d6c, 0x4799, 0x4790, 0x3e81, 0x2668, 0x3e0f,
+	    0x31e9, 0x184c, 0x23ff, 0x4927, 0x1136, 0x0000, 0x2fda, 0x0af9,
+	    0x12b1, 0x0c66, 0x3ee9, 0x2e22, 0x496a, 0x403d, 0x1cf4, 0x17d3,
+	    0x3b8b, 0x0000, 0x3b39, 0x0e46, 0x05e5, 0x0000, 0x232e, 0x4c24,
+	    0x0000, 0x2d1f, 0x42d6, 0x172c, 0x245e, 0x0c5f, 0x4c7e, 0x12c8,
+	    0x4b92, 0x0fe0, 0x2ae3, 0x3bff, 0x3364, 0x0000, 0x33f1, 0x3aaa,
+	    0x0781, 0x12b0, 0x2879, 0x2561, 0x3218, 0x081e, 0x17c4, 0x371a,
+	    0x4af5, 0x12a2, 0x14b1, 0x3d4b, 0x1725, 0x0000, 0x0cb5, 0x0000,
+	    0x4766, 0x0000, 0x0000, 0x0903, 0x0000, 0x39e9, 0x0000, 0x0ee8,
+	    0x484f, 0x492e, 0x3fe6, 0x3142, 0x2bd3, 0x02d4, 0x13d6, 0x215a,
+	    0x0000, 0x1fd7, 0x02d2, 0x0000, 0x0000, 0x20c4, 0x2133, 0x2f88,
+	    0x2e61, 0x0000, 0x1fef, 0x45cd, 0x0000, 0x1c67, 0x3fec, 0x3dfc,
+	    0x0000, 0x34a4, 0x074e, 0x0000, 0x38b1, 0x137c, 0x0000, 0x023e,
+	    0x36f2, 0x0000, 0x323e, 0x01ca, 0x0c4b, 0x0000, 0x3170, 0x2157,
+	    0x02ee, 0x0000, 0x45d0, 0x0000, 0x0139, 0x1b3f, 0x0000, 0x2afb,
+	    0x0000, 0x0000, 0x293e, 0x0000, 0x3105, 0x0000, 0x299f, 0x2f39,
+	    0x1595, 0x0000, 0x4c09, 0x0000, 0x0000, 0x254b, 0x0000, 0x2bee,
+	    0x0f7f, 0x0105, 0x140a, 0x2f38, 0x012a, 0x0000, 0x116c, 0x49af,
+	    0x4961, 0x4dc6, 0x436f, 0x4d5c, 0x3ed7, 0x0000, 0x2eb0, 0x1169,
+	    0x1abb, 0x14a4, 0x37c6, 0x2569, 0x012d, 0x30f9, 0x0000, 0x4591,
+	    0x0000, 0x0000, 0x48fe, 0x4562, 0x4d63, 0x2e55, 0x1dc9, 0x0000,
+	    0x06f5, 0x2b0b, 0x0000, 0x1552, 0x0000, 0x076f, 0x43dd, 0x0d03,
+	    0x38bb, 0x1572, 0x3e59, 0x4795, 0x328e, 0x478b, 0x0000, 0x28cf,
+	    0x1d7e, 0x0a43, 0x0000, 0x4d2c, 0x401e, 0x4d18, 0x374f, 0x26bd,
+	    0x22d1, 0x2aef, 0x0000, 0x1d73, 0x2f24, 0x1154, 0x096e, 0x26ce,
+	    0x0000, 0x0834, 0x319f, 0x3bd1, 0x0000, 0x3de9, 0x405a, 0x2a94,
+	    0x2590, 0x1878, 0x1fe9, 0x12de, 0x2693, 0x15f1, 0x299f, 0x47a8,
+	    0x3dbc, 0x1469, 0x2e48, 0x3a52, 0x0000, 0x2df4, 0x1d75, 0x4119,
+	    0x0000, 0x106f, 0x20c8, 0x493f, 0x1be1, 0x44a4, 0x1703, 0x18ad,
+	    0x2090, 0x3e35, 0x4594, 0x3bb0, 0x0000, 0x05b8, 0x06f9, 0x2e1b,
+	    0x3689, 0x09ea, 0x41ab, 0x3b09, 0x0d0a, 0x42a3, 0x1ca2, 0x010c,
+	    0x0000, 0x10da, 0x438a, 0x1e74, 0x3d1a, 0x48ef, 0x31a7, 0x4c5b,
+	    0x1dd4, 0x1516, 0x088a, 0x20ef, 0x0792, 0x0c00, 0x0000, 0x0012,
+	    0x3164, 0x22eb, 0x309f, 0x0000, 0x2774, 0x25a4, 0x4b46, 0x2499,
+	    0x19b2, 0x3b55, 0x20ad, 0x42d4, 0x0000, 0x08e2, 0x2067, 0x0e23,
+	    0x2248, 0x4b5c, 0x4460, 0x052c, 0x15a3, 0x2ab4, 0x29e9, 0x1b19,
+	    0x02e7, 0x0000, 0x0000, 0x43d6, 0x0000, 0x2674, 0x1717, 0x4bb0,
+	    0x1a18, 0x0000, 0x386b, 0x25e1, 0x107f, 0x456b, 0x1a26, 0x10ba,
+	    0x2fbd, 0x2eae, 0x0ac0, 0x45a9, 0x1e77, 0x0d4e, 0x2fca, 0x3cc5,
+	    0x1342, 0x14ec, 0x0c0b, 0x2cc8, 0x16a2, 0x4117, 0x2509, 0x3dd7,
+	    0x2973, 0x01e3, 0x39e2, 0x0be9, 0x0391, 0x1219, 0x13b8, 0x4a43,
+	    0x0000, 0x34c1, 0x02b0, 0x13e5, 0x0423, 0x04b4, 0x3662, 0x0000,
+	    0x28e0, 0x2fd9, 0x1919, 0x0812, 0x2e84, 0x09eb, 0x37e9, 0x0000,
+	    0x127f, 0x4214, 0x0000, 0x0000, 0x2c09, 0x1a27, 0x09dd, 0x0000,
+	    0x0000, 0x2b79, 0x2e94, 0x4233, 0x42d9, 0x2267, 0x0750, 0x42bb,
+	    0x3edd, 0x24dc, 0x204f, 0x193a, 0x1932, 0x3c43, 0x32bf, 0x13fb,
+	    0x2864, 0x331d, 0x0ac9, 0x0e4c, 0x180f, 0x2ed8, 0x17a1, 0x0000,
+	    0x1dd8, 0x3fb1, 0x0000, 0x1e8f, 0x0a91, 0x0000, 0x15a6, 0x20f6,
+	    0x2b99, 0x03ad, 0x31d7, 0x3737, 0x250a, 0x3dd3, 0x2fb6, 0x0faa,
+	    0x3625, 0x0000, 0x0fad, 0x1d40, 0x2d67, 0x0f36, 0x035b, 0x0000,
+	    0x26f6, 0x0000, 0x081e, 0x32aa, 0x04f5, 0x0000, 0x03ff, 0x0717,
+	    0x2b2d, 0x32ff, 0x0547, 0x0000, 0x3bcb, 0x215f, 0x0000, 0x0000,
+	    0x003a, 0x2adf, 0x40f6, 0x0003, 0x2f90, 0x06e2, 0x1d35, 0x0000,
+	    0x0000, 0x0e6f, 0x42e2, 0x499a, 0x40be, 0x0000, 0x4ae4, 0x35bb,
+	    0x44d3, 0x0e38, 0x354c, 0x2904, 0x22f6, 0x2817, 0x344e, 0x0000,
+	    0x22d9, 0x063f, 0x2901, 0x491b, 0x0e3a, 0x39c4, 0x3642, 0x3793,
+	    0x0000, 0x4114, 0x03cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x1559,
+	    0x09f3, 0x25a1, 0x3a2b, 0x0000, 0x016f, 0x33cd, 0x43c6, 0x034a,
+	    0x4403, 0x19bc, 0x3ce7, 0x07d8, 0x0000, 0x0e7d, 0x39e5, 0x4b56,
+	    0x1ede, 0x3286, 0x36b6, 0x09ce, 0x4ca0, 0x09c4, 0x2231, 0x0000,
+	    0x3684, 0x1772, 0x16b2, 0x454c, 0x19f2, 0x04ac, 0x3fb5, 0x1ee9,
+	    0x13c7, 0x0000, 0x483e, 0x446d, 0x3523, 0x0000, 0x21ca, 0x3d85,
+	    0x28fe, 0x0f61, 0x2305, 0x2e42, 0x22b7, 0x0000, 0x0000, 0x248a,
+	    0x2555, 0x49b0, 0x0000, 0x1494, 0x0195, 0x1691, 0x38c2, 0x259f,
+	    0x0a10, 0x0000, 0x4b82, 0x0000, 0x4706, 0x15f0, 0x3ab6, 0x4b71,
+	    0x19b7, 0x0c9c, 0x02cd, 0x0000, 0x35c1, 0x0000, 0x0519, 0x27f2,
+	    0x3453, 0x0622, 0x32a0, 0x42f3, 0x32f4, 0x04c7, 0x0d8f, 0x23ec,
+	    0x1026, 0x1955, 0x336a, 0x3cf8, 0x2ccc, 0x4464, 0x0000, 0x27ef,
+	    0x3c1a, 0x2061, 0x3e66, 0x38aa, 0x0000, 0x26cf, 0x4613, 0x3749,
+	    0x0bae, 0x25fd, 0x15fa, 0x139e, 0x3454, 0x21c2, 0x44d3, 0x09a2,
+	    0x049d, 0x2469, 0x28fc, 0x41d7, 0x0000, 0x432a, 0x1261, 0x1cc9,
+	    0x087e, 0x48f3, 0x2b58, 0x4722, 0x20f1, 0x38c5, 0x0000, 0x0000,
+	    0x093e, 0x264d, 0x27fe, 0x4bba, 0x092c, 0x0000, 0x0000, 0x16ef,
+	    0x09da, 0x3c3a, 0x491b, 0x1a39, 0x054c, 0x0c63, 0x261b, 0x2188,
+	    0x2252, 0x12b6, 0x1e6d, 0x3eb8, 0x2e30, 0x2c1d, 0x4ae4, 0x1aca,
+	    0x3c98, 0x399a, 0x1e43, 0x06d0, 0x0000, 0x3276, 0x1e01, 0x2329,
+	    0x35c6, 0x0000, 0x4d5c, 0x34c1, 0x44f5, 0x3ce4, 0x1e0b, 0x16b3,
+	    0x0000, 0x45aa, 0x1aec, 0x269d, 0x3b8a, 0x1fe9, 0x2504, 0x456c,
+	    0x3c41, 0x06a9, 0x1b0e, 0x43b3, 0x211f, 0x35af, 0x32da, 0x18d8,
+	    0x0000, 0x07cf, 0x0000, 0x0000, 0x3969, 0x0000, 0x045c, 0x0668,
+	    0x26f8, 0x0124, 0x45dd, 0x0eed, 0x069e, 0x1e04, 0x0167, 0x0000,
+	    0x2e4d, 0x4287, 0x130d, 0x4c5b, 0x39ea, 0x2c52, 0x1063, 0x2328,
+	    0x0470, 0x04c1, 0x03c7, 0x47ee, 0x4932, 0x0089, 0x218b, 0x4507,
+	    0x0000, 0x2954, 0x0000, 0x4363, 0x3a27, 0x0000, 0x0000, 0x1c83,
+	    0x1b64, 0x1202, 0x3307, 0x210c, 0x1fed, 0x3fa2, 0x0b6f, 0x4622,
+	    0x0a41, 0x330e, 0x4a0f, 0x0d23, 0x0000, 0x49c8, 0x3e3b, 0x470b,
+	    0x4bec, 0x4623, 0x27d0, 0x48a1, 0x3750, 0x0f67, 0x36af, 0x0000,
+	    0x2ad5, 0x163b, 0x0000, 0x0000, 0x2c87, 0x18f2, 0x45c0, 0x0000,
+	    0x473d, 0x0000, 0x1faa, 0x1c3b, 0x0000, 0x21da, 0x3a3a, 0x4028,
+	    0x115e, 0x3a07, 0x3f92, 0x2d83, 0x0032, 0x4926, 0x11e0, 0x0d6a,
+	    0x0ec2, 0x4459, 0x0665, 0x14e7, 0x478d, 0x0c59, 0x01f5, 0x0000,
+	    0x0000, 0x3378, 0x0ab5, 0x2616, 0x3bab, 0x0d13, 0x31e4, 0x10e0,
+	    0x0000, 0x2861, 0x0000, 0x1c0c, 0x3c6c, 0x1ba2, 0x47aa, 0x0e25,
+	    0x201b, 0x09cc, 0x3dd4, 0x44c0, 0x47e0, 0x38bd, 0x1bc8, 0x0750,
+	    0x17e0, 0x2689, 0x0050, 0x0000, 0x459c, 0x0bfb, 0x0000, 0x4447,
+	    0x0edb, 0x1a5c, 0x3c30, 0x3dcc, 0x1bb3, 0x0a87, 0x2035, 0x2bbb,
+	    0x3780, 0x4c73, 0x30a5, 0x29c0, 0x0000, 0x4ad3, 0x45fd, 0x2d36,
+	    0x1874, 0x39ea, 0x1b15, 0x10a5, 0x01c5, 0x0f2e, 0x40a3, 0x36bb,
+	    0x0000, 0x0000, 0x35c8, 0x18c6, 0x223d, 0x45c7, 0x30f1, 0x04b6,
+	    0x43ca, 0x4dce, 0x0c50, 0x46bf, 0x3f44, 0x23cd, 0x4e13, 0x053c,
+	    0x49c5, 0x0bbb, 0x0000, 0x43ee, 0x0c03, 0x0000, 0x3147, 0x1d5a,
+	    0x3e85, 0x0000, 0x2107, 0x0c98, 0x0000, 0x1f34, 0x08da, 0x4387,
+	    0x015b, 0x1186, 0x2d49, 0x2bfd, 0x4a27, 0x3ec7, 0x1772, 0x42c1,
+	    0x3ced, 0x0000, 0x085b, 0x2380, 0x34e3, 0x3422, 0x14f6, 0x12dc,
+	    0x3f30, 0x483b, 0x1891, 0x108d, 0x3e36, 0x25f9, 0x32e6, 0x11e5,
+	    0x0000, 0x0b04, 0x24bf, 0x3f7b, 0x1f02, 0x4422, 0x1569, 0x39b3,
+	    0x210c, 0x06e1, 0x197a, 0x2705, 0x0682, 0x4de9, 0x3f1c, 0x0000,
+	    0x009a, 0x09c2, 0x161f, 0x4506, 0x1db0, 0x1758, 0x2059, 0x11d4,
+	    0x0000, 0x0000, 0x25f0, 0x329a, 0x1d51, 0x0000, 0x2b01, 0x2ba0,
+	    0x0c87, 0x0023, 0x0000, 0x46b4, 0x0000, 0x0362, 0x0bf7, 0x2267,
+	    0x0000, 0x4467, 0x0000, 0x452e, 0x24a5, 0x0a85, 0x0000, 0x0000,
+	    0x25a2, 0x377b, 0x0000, 0x4c2f, 0x2eb5, 0x0000, 0x0000, 0x4bbc,
+	    0x0a61, 0x0dc7, 0x054e, 0x24ab, 0x0000, 0x0000, 0x10d1, 0x246a,
+	    0x1197, 0x0000, 0x4a94, 0x0bb5, 0x0000, 0x086a, 0x3210, 0x35bc,
+	    0x0000, 0x1446, 0x2b4a, 0x0cee, 0x31d9, 0x3643, 0x000c, 0x37e7,
+	    0x0000, 0x3e9a, 0x1403, 0x14aa, 0x0000, 0x129a, 0x0195, 0x3fc7,
+	    0x0c56, 0x0000, 0x3038, 0x0000, 0x36a2, 0x11cb, 0x3d4c, 0x10b6,
+	    0x0214, 0x0000, 0x4439, 0x0020, 0x37b2, 0x44ab, 0x46b7, 0x0000,
+	    0x0118, 0x04a8, 0x2476, 0x09f5, 0x33cd, 0x2bfc, 0x1583, 0x0000,
+	    0x21c2, 0x0a81, 0x466a, 0x378d, 0x417a, 0x37db, 0x0000, 0x3b68,
+	    0x0000, 0x0c8b, 0x0000, 0x37d6, 0x42cd, 0x0000, 0x1a1d, 0x0000,
+	    0x0000, 0x0000, 0x39e9, 0x0000, 0x0000, 0x44f6, 0x2ea2, 0x0757,
+	    0x0000, 0x413d, 0x3672, 0x3ce6, 0x1a36, 0x13af, 0x17d2, 0x16ac,
+	    0x10e5, 0x12d7, 0x4bed, 0x12c5, 0x4ce4, 0x1424, 0x308f, 0x0ccb,
+	    0x493c, 0x1c2e, 0x4826, 0x1c0f, 0x0000, 0x0000, 0x2a3e, 0x0821,
+	    0x0000, 0x1dc6, 0x1e47, 0x0e60, 0x3e82, 0x0326, 0x22a4, 0x00b6,
+	    0x463d, 0x2eca, 0x2b04, 0x3f41, 0x1ed1, 0x4649, 0x458d, 0x0e7c,
+	    0x42a2, 0x12d4, 0x089d, 0x20a7, 0x4133, 0x1fa2, 0x1b5f, 0x46bd,
+	    0x04ca, 0x43c5, 0x0000, 0x1b73, 0x0000, 0x11f7, 0x3457, 0x0000,
+	    0x16d0, 0x444d, 0x4026, 0x3ab3, 0x0000, 0x0000, 0x0000, 0x4486,
+	    0x2a5a, 0x30db, 0x0778, 0x0781, 0x2059, 0x20f0, 0x3e9f, 0x0000,
+	    0x434b, 0x0088, 0x36fd, 0x3b83, 0x0164, 0x448f, 0x4815, 0x3dd5,
+	    0x0c0c, 0x1006, 0x0000, 0x3409, 0x4e1f, 0x0639, 0x0000, 0x03a8,
+	    0x2919, 0x3037, 0x0000, 0x0000, 0x0000, 0x0c16, 0x217a, 0x3b4b,
+	    0x0000, 0x46f7, 0x1de1, 0x0157, 0x3cb6, 0x34b7, 0x0f9d, 0x04ec,
+	    0x4c3b, 0x4477, 0x0000, 0x36ad, 0x3b0a, 0x0000, 0x4c6d, 0x1844,
+	    0x4ae5, 0x3f63, 0x0000, 0x33e5, 0x0070, 0x4a64, 0x0000, 0x2a05,
+	    0x2167, 0x1f0d, 0x480b, 0x4274, 0x26e0, 0x2986, 0x249d, 0x0000,
+	    0x2c65, 0x0000, 0x2028, 0x0000, 0x0000, 0x2d37, 0x4df8, 0x0000,
+	    0x0035, 0x1314, 0x0d52, 0x1a52, 0x0000, 0x110e, 0x19e5, 0x3849,
+	    0x0fbd, 0x4adb, 0x35af, 0x4669, 0x37b5, 0x4a1b, 0x2213, 0x0ffc,
+	    0x2be8, 0x0414, 0x0000, 0x2e82, 0x2272, 0x4333, 0x447a, 0x2a48,
+	    0x4b03, 0x0000, 0x2688, 0x4b25, 0x4624, 0x3d6f, 0x0000, 0x4695,
+	    0x3a83, 0x4499, 0x0000, 0x4226, 0x0aa7, 0x2e6b, 0x0d27, 0x0e6d,
+	    0x33d4, 0x0000, 0x0000, 0x2641, 0x19ae, 0x4962, 0x2ed3, 0x27d0,
+	    0x34f8, 0x103b, 0x2893, 0x1484, 0x33bc, 0x2fe9, 0x2bba, 0x4b5b,
+	    0x0000, 0x0000, 0x40f5, 0x24c0, 0x42c7, 0x44a2, 0x1203, 0x00d4,
+	    0x0000, 0x4aa2, 0x26ef, 0x1de3, 0x1335, 0x2cb7, 0x3537, 0x0000,
+	    0x4b98, 0x15be, 0x27bc, 0x488a, 0x47b6, 0x3a81, 0x0000, 0x4619,
+	    0x16f7, 0x44ab, 0x33fa, 0x46c7, 0x0000, 0x080e, 0x3b84, 0x3b9b,
+	    0x2452, 0x0000, 0x0000, 0x095a, 0x2ee6, 0x0dbb, 0x0000, 0x4c1f,
+	    0x1df4, 0x38f2, 0x4478, 0x17fa, 0x0220, 0x1263, 0x0000, 0x488b,
+	    0x0464, 0x0815, 0x0000, 0x273b, 0x0000, 0x081c, 0x0e9b, 0x1b7b,
+	    0x0000, 0x44c2, 0x27ef, 0x3569, 0x35f1, 0x29bf, 0x3841, 0x0000,
+	    0x35e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x06a1, 0x2176, 0x4ac5,
+	    0x0000, 0x2ba2, 0x206e, 0x0000, 0x0000, 0x490f, 0x2004, 0x292f,
+	    0x3117, 0x1fa1, 0x14dc, 0x0000, 0x2cad, 0x01d2, 0x4301, 0x47b1,
+	    0x0000, 0x38bb, 0x0581, 0x2162, 0x1d9d, 0x1952, 0x0000, 0x4de7,
+	    0x0dff, 0x008d, 0x038a, 0x23ed, 0x3ffd, 0x0236, 0x2034, 0x30a5,
+	    0x0da4, 0x4b07, 0x28fb, 0x10ba, 0x0b45, 0x3fb9, 0x0000, 0x20c1,
+	    0x14dc, 0x411f, 0x329d, 0x092c, 0x0000, 0x2b79, 0x2c4c, 0x1fd7,
+	    0x39ab, 0x0000, 0x268d, 0x1342, 0x0612, 0x1184, 0x0000, 0x08af,
+	    0x0000, 0x1a68, 0x0000, 0x3e98, 0x3da7, 0x279d, 0x23d0, 0x49cd,
+	    0x3df1, 0x4d72, 0x00c9, 0x0fcf, 0x376f, 0x3b90, 0x396d, 0x0000,
+	    0x3547, 0x323c, 0x2f7c, 0x34dd, 0x0000, 0x1647, 0x012a, 0x0314,
+	    0x4961, 0x0592, 0x0000, 0x42b4, 0x20c4, 0x3369, 0x1c67, 0x314c,
+	    0x4305, 0x447e, 0x2f0d, 0x0b7e, 0x497f, 0x406f, 0x0000, 0x4aaf,
+	    0x0902, 0x193b, 0x38cc, 0x1a2e, 0x3268, 0x0590, 0x0000, 0x2ecb,
+	    0x3c6c, 0x1158, 0x13af, 0x0158, 0x23da, 0x43b5, 0x2a08, 0x2834,
+	    0x0993, 0x04b7, 0x0000, 0x0000, 0x3913, 0x0167, 0x0000, 0x2983,
+	    0x478b, 0x3344, 0x0000, 0x0000, 0x3b61, 0x0000, 0x39eb, 0x0091,
+	    0x0000, 0x0000, 0x37f1, 0x3cd4, 0x1a67, 0x0000, 0x0000, 0x1ce5,
+	    0x0db4, 0x0000, 0x488e, 0x3116, 0x0000, 0x2cfe, 0x1b6d, 0x3af7,
+	    0x2122, 0x3e15, 0x02fd, 0x0ece, 0x1f29, 0x0b63, 0x0e7e, 0x1301,
+	    0x3cbd, 0x10cc, 0x4b4d, 0x0000, 0x0000, 0x1671, 0x094c, 0x2e4b,
+	    0x1569, 0x3abf, 0x0000, 0x1df1, 0x24a7, 0x44cc, 0x23f9, 0x07f5,
+	    0x21d0, 0x102f, 0x476e, 0x305d, 0x2f85, 0x20b9, 0x301f, 0x32f4,
+	    0x3b7d, 0x2598, 0x42ea, 0x0529, 0x2978, 0x3756, 0x0000, 0x0df0,
+	    0x003c, 0x111d, 0x424e, 0x1a28, 0x0000, 0x0000, 0x039a, 0x41c6,
+	    0x0000, 0x1f37, 0x4c2f, 0x202b, 0x0000, 0x3c4c, 0x29ac, 0x125f,
+	    0x144f, 0x0000, 0x2521, 0x1776, 0x2410, 0x4d13, 0x002b, 0x28e4,
+	    0x1b0f, 0x1fcb, 0x4b83, 0x0000, 0x06de, 0x119d, 0x0000, 0x49c2,
+	    0x1aa1, 0x0c19, 0x0d7d, 0x4a92, 0x4414, 0x454b, 0x27dd, 0x16fd,
+	    0x3e53, 0x1d5c, 0x26bb, 0x4156, 0x2340, 0x10ac, 0x1daa, 0x1d78,
+	    0x3fa1, 0x1481, 0x42d7, 0x27f3, 0x0000, 0x35a6, 0x0199, 0x005f,
+	    0x2239, 0x1ffd, 0x0000, 0x3f11, 0x2065, 0x2847, 0x2b95, 0x2ca7,
+	    0x4c46, 0x2a01, 0x00c1, 0x1166, 0x0fbf, 0x3540, 0x0955, 0x4997,
+	    0x4613, 0x16e2, 0x0d27, 0x37cf, 0x1147, 0x2cb4, 0x0b83, 0x0000,
+	    0x08d1, 0x0000, 0x0000, 0x1b80, 0x0dc0, 0x15a2, 0x1d5d, 0x3093,
+	    0x06b8, 0x0000, 0x338e, 0x1001, 0x0000, 0x27d8, 0x111a, 0x0000,
+	    0x1a16, 0x3ddb, 0x0000, 0x3cdf, 0x37e5, 0x0c63, 0x3811, 0x0000,
+	    0x2dd2, 0x4b7c, 0x33d2, 0x06cf, 0x42c6, 0x0000, 0x0287, 0x2ebd,
+	    0x36d2, 0x4ca6, 0x3a2b, 0x3c1d, 0x0d37, 0x0000, 0x0bfb, 0x0c3b,
+	    0x1528, 0x3d7c, 0x27fd, 0x36cb, 0x3ee8, 0x0bf0, 0x2476, 0x497f,
+	    0x0000, 0x3a7b, 0x1a18, 0x18a3, 0x3bb4, 0x0000, 0x4003, 0x0000,
+	    0x1139, 0x26f2, 0x0000, 0x0000, 0x0847, 0x28f4, 0x2130, 0x3e21,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1d98, 0x0973, 0x0000, 0x36b4,
+	    0x2ec9, 0x0000, 0x14eb, 0x2eee, 0x24e7, 0x3213, 0x026a, 0x44cd,
+	    0x0000, 0x0000, 0x13ab, 0x3b2d, 0x44e2, 0x050e, 0x0000, 0x4b13,
+	    0x17a9, 0x2cbf, 0x2b30, 0x08f4, 0x03ac, 0x0000, 0x2022, 0x0c9d,
+	    0x1a1e, 0x29e0, 0x215d, 0x0a9c, 0x1cf4, 0x36b7, 0x0f81, 0x2434,
+	    0x14a5, 0x0000, 0x3273, 0x0000, 0x297c, 0x428c, 0x3464, 0x0b39,
+	    0x4c1a, 0x2986, 0x295a, 0x2680, 0x2af0, 0x3a31, 0x1670, 0x078b,
+	    0x0857, 0x0952, 0x0837, 0x4574, 0x4356, 0x0db6, 0x4c4d, 0x11ff,
+	    0x0000, 0x1770, 0x0000, 0x1c28, 0x3238, 0x2bc0, 0x1186, 0x2161,
+	    0x22b1, 0x45f6, 0x3d03, 0x30de, 0x0000, 0x4503, 0x2405, 0x24dc,
+	    0x0000, 0x21ff, 0x3af8, 0x054c, 0x024b, 0x0000, 0x3624, 0x0000,
+	    0x107e, 0x3a1b, 0x2732, 0x37c9, 0x0000, 0x12f1, 0x0000, 0x017b,
+	    0x386b, 0x3970, 0x0000, 0x2c66, 0x3a8d, 0x4a17, 0x1a7b, 0x47bf,
+	    0x3a81, 0x0000, 0x0000, 0x0000, 0x4258, 0x47c5, 0x2682, 0x2b04,
+	    0x3bb7, 0x4761, 0x1eb6, 0x2453, 0x3a80, 0x0cfd, 0x0000, 0x4abb,
+	    0x371e, 0x0000, 0x0890, 0x1014, 0x3cfc, 0x458f, 0x0b35, 0x4d52,
+	    0x0000, 0x2972, 0x04ea, 0x0000, 0x3fce, 0x0000, 0x35b8, 0x2c21,
+	    0x4c73, 0x13f0, 0x0700, 0x0000, 0x4554, 0x0000, 0x19e0, 0x3d6f,
+	    0x37be, 0x37f9, 0x0000, 0x0000, 0x19a8, 0x0000, 0x0000, 0x4439,
+	    0x410e, 0x06fc, 0x2b5a, 0x32f3, 0x0000, 0x4089, 0x2aba, 0x30a0,
+	    0x32cb, 0x0000, 0x2670, 0x0000, 0x0000, 0x0000, 0x329e, 0x4b92,
+	    0x0037, 0x0aea, 0x0000, 0x41f2, 0x16ac, 0x25e3, 0x1e0d, 0x0000,
+	    0x25ab, 0x2742, 0x455a, 0x43e1, 0x13ac, 0x19ef, 0x36b2, 0x0315,
+	    0x0000, 0x32cf, 0x242b, 0x05f1, 0x0000, 0x4281, 0x0000, 0x3304,
+	    0x02b1, 0x135e, 0x0000, 0x4516, 0x26ae, 0x3201, 0x085e, 0x466a,
+	    0x2ad4, 0x3040, 0x1ae0, 0x2fd1, 0x448a, 0x48eb, 0x03fc, 0x23d1,
+	    0x0000, 0x4cbf, 0x39c9, 0x1133, 0x0569, 0x07f4, 0x3885, 0x2621,
+	    0x0000, 0x43a0, 0x4154, 0x0166, 0x1c99, 0x27ad, 0x196a, 0x0000,
+	    0x07ca, 0x1709, 0x29bf, 0x4599, 0x1ada, 0x02fe, 0x1dea, 0x2a7c,
+	    0x06b8, 0x05d4, 0x23fb, 0x4a90, 0x3c6c, 0x0000, 0x21c3, 0x0000,
+	    0x0ab5, 0x0eb8, 0x4599, 0x0000, 0x3553, 0x37d2, 0x0c97, 0x0555,
+	    0x13a2, 0x3030, 0x2fec, 0x001d, 0x1d38, 0x2f9f, 0x36bf, 0x0000,
+	    0x0000, 0x0f51, 0x2d12, 0x3a30, 0x0b3b, 0x2ba5, 0x3aac, 0x2038,
+	    0x0f54, 0x1035, 0x0cb5, 0x2b59, 0x15f2, 0x4a04, 0x41a8, 0x0884,
+	    0x418a, 0x2bad, 0x2484, 0x0000, 0x158b, 0x2c7d, 0x4cf8, 0x2949,
+	    0x05d0, 0x1383, 0x0000, 0x0849, 0x4904, 0x35d1, 0x493d, 0x07e0,
+	    0x0f74, 0x0a3f, 0x1790, 0x3449, 0x0000, 0x2afd, 0x209c, 0x4ad9,
+	    0x1d11, 0x35f8, 0x03a4, 0x0000, 0x3996, 0x400e, 0x08ee, 0x3b0a,
+	    0x07b5, 0x0a4d, 0x0925, 0x21bf, 0x020f, 0x1b54, 0x2b55, 0x2532,
+	    0x17eb, 0x0311, 0x32b7, 0x0292, 0x1e1e, 0x26a1, 0x22bf, 0x371b,
+	    0x0000, 0x2ca4, 0x0000, 0x0623, 0x0d8d, 0x06b2, 0x492f, 0x2714,
+	    0x226b, 0x4c68, 0x0000, 0x4137, 0x0000, 0x4923, 0x1304, 0x1d47,
+	    0x2e2b, 0x4b9a, 0x1ed1, 0x1fa3, 0x1307, 0x443a, 0x0f6d, 0x0798,
+	    0x0000, 0x4a60, 0x2b59, 0x305c, 0x41ea, 0x137e, 0x03b5, 0x0000,
+	    0x0a9c, 0x17b3, 0x3019, 0x0000, 0x10e0, 0x0000, 0x4bf9, 0x3e93,
+	    0x04b1, 0x3d5b, 0x07b5, 0x1d27, 0x0526, 0x053f, 0x0000, 0x2bd7,
+	    0x14dc, 0x12c4, 0x4346, 0x28e2, 0x4c9a, 0x3119, 0x48e9, 0x04bd,
+	    0x0000, 0x239d, 0x1d0f, 0x00ec, 0x15e0, 0x19d3, 0x0a15, 0x364f,
+	    0x0023, 0x3472, 0x0000, 0x2a52, 0x1345, 0x087e, 0x1e33, 0x1f47,
+	    0x343b, 0x17b9, 0x4da4, 0x061e, 0x3938, 0x0943, 0x332d, 0x3097,
+	    0x0000, 0x0000, 0x075d, 0x123f, 0x1c7c, 0x2143, 0x0000, 0x0068,
+	    0x43e9, 0x43bb, 0x0000, 0x12ea, 0x2ec8, 0x0962, 0x3881, 0x027f,
+	    0x4c42, 0x17c4, 0x3cca, 0x0000, 0x0000, 0x093e, 0x4614, 0x0d77,
+	    0x495f, 0x0000, 0x0000, 0x39e9, 0x152e, 0x46d8, 0x0633, 0x1882,
+	    0x21fa, 0x3f72, 0x4e02, 0x0000, 0x3d4c, 0x4634, 0x4408, 0x13e7,
+	    0x1447, 0x0f99, 0x0a09, 0x1db2, 0x4a77, 0x2798, 0x0e10, 0x20d7,
+	    0x0cf9, 0x0964, 0x0b39, 0x4b13, 0x1fdd, 0x1fe9, 0x38a9, 0x021c,
+	    0x0baf, 0x3d84, 0x4661, 0x0000, 0x0bb0, 0x059c, 0x2077, 0x4caa,
+	    0x0000, 0x0000, 0x2a33, 0x0000, 0x0000, 0x35f0, 0x224f, 0x415a,
+	    0x0c40, 0x1f21, 0x352e, 0x1435, 0x03af, 0x0000, 0x0000, 0x34ce,
+	    0x2a5c, 0x3b34, 0x174c, 0x2f75, 0x17e2, 0x4a08, 0x0f40, 0x3484,
+	    0x0239, 0x0000, 0x1120, 0x2203, 0x15b2, 0x0000, 0x39b6, 0x1433,
+	    0x34a8, 0x13ed, 0x46c7, 0x0000, 0x436b, 0x2c95, 0x0635, 0x100d,
+	    0x2881, 0x289f, 0x0e2f, 0x3829, 0x0000, 0x3086, 0x490a, 0x3942,
+	    0x3ba5, 0x02e2, 0x2296, 0x0000, 0x1438, 0x37bb, 0x0000, 0x4522,
+	    0x0000, 0x11e2, 0x41db, 0x205b, 0x0000, 0x2a82, 0x3827, 0x08b8,
+	    0x3ab1, 0x1474, 0x3f1d, 0x437e, 0x0000, 0x1cfb, 0x0000, 0x2d63,
+	    0x2154, 0x19fe, 0x36b3, 0x41ce, 0x3b3e, 0x4a48, 0x1609, 0x44de,
+	    0x126b, 0x1a28, 0x0819, 0x326d, 0x15e2, 0x0000, 0x15df, 0x091b,
+	    0x1e13, 0x41bc, 0x43ab, 0x0000, 0x21d7, 0x1e4b, 0x227a, 0x035f,
+	    0x0000, 0x2310, 0x37ad, 0x04dc, 0x1b15, 0x355e, 0x23dd, 0x1fae,
+	    0x0000, 0x38f4, 0x2d34, 0x17bc, 0x1f08, 0x0000, 0x0746, 0x1d0b,
+	    0x3a37, 0x13ef, 0x0000, 0x32ad, 0x42c0, 0x400e, 0x0000, 0x3eac,
+	    0x0000, 0x4797, 0x03ed, 0x3687, 0x0000, 0x01a0, 0x12f2, 0x0000,
+	    0x0c3f, 0x0000, 0x45a8, 0x4082, 0x1ee0, 0x0000, 0x1e8d, 0x1434,
+	    0x3bfc, 0x0388, 0x34ef, 0x4cde, 0x4207, 0x1897, 0x0000, 0x3325,
+	    0x0c78, 0x03af, 0x3531, 0x249c, 0x2e3d, 0x4784, 0x1ae9, 0x49ca,
+	    0x0dbb, 0x064f, 0x4c03, 0x2360, 0x40a8, 0x0000, 0x4c96, 0x0000,
+	    0x3634, 0x30ec, 0x4957, 0x2f75, 0x0000, 0x37c3, 0x46af, 0x3ac9,
+	    0x3e01, 0x04e2, 0x3431, 0x1fb0, 0x0d7e, 0x0000, 0x2b59, 0x2a3a,
+	    0x4622, 0x38af, 0x035d, 0x145c, 0x0902, 0x494a, 0x32c6, 0x0000,
+	    0x2bdb, 0x0000, 0x44d0, 0x4d97, 0x0eeb, 0x23c4, 0x2f24, 0x1824,
+	    0x344f, 0x11e0, 0x112c, 0x092d, 0x16f2, 0x0000, 0x3354, 0x488b,
+	    0x35b8, 0x29ae, 0x353b, 0x35ec, 0x488c, 0x31d0, 0x3560, 0x219f,
+	    0x16d1, 0x2e73, 0x0000, 0x0130, 0x1af3, 0x2101, 0x3517, 0x3788,
+	    0x1bc8, 0x4632, 0x0ef5, 0x0000, 0x4b9b, 0x1b2e, 0x0000, 0x41ce,
+	    0x0000, 0x165c, 0x394b, 0x4535, 0x465c, 0x041d, 0x00ad, 0x1062,
+	    0x1260, 0x0dca, 0x1c5f, 0x2cc9, 0x1ee3, 0x26dc, 0x0000, 0x0fe6,
+	    0x2582, 0x403d, 0x306e, 0x0000, 0x2ada, 0x08f9, 0x430b, 0x1fa7,
+	    0x4ce3, 0x100e, 0x3fcf, 0x228e, 0x2b26, 0x0000, 0x13a3, 0x0469,
+	    0x23f5, 0x470e, 0x0000, 0x0000, 0x1b1e, 0x345d, 0x38e8, 0x247f,
+	    0x3d0d, 0x213d, 0x4857, 0x1788, 0x0001, 0x3726, 0x4bff, 0x3820,
+	    0x0e41, 0x0000, 0x27cf, 0x0000, 0x3811, 0x010d, 0x14f9, 0x453c,
+	    0x2c90, 0x1860, 0x058c, 0x4716, 0x0000, 0x1952, 0x4ad9, 0x2520,
+	    0x0ef0, 0x0000, 0x2d7b, 0x0000, 0x4a8b, 0x177e, 0x311d, 0x2fcb,
+	    0x0000, 0x0000, 0x470c, 0x212a, 0x2264, 0x330e, 0x0000, 0x264f,
+	    0x0000, 0x0000, 0x496a, 0x3162, 0x3697, 0x3afe, 0x4381, 0x0cee,
+	    0x3b65, 0x4ac4, 0x48d4, 0x2306, 0x0d45, 0x0000, 0x0000, 0x28e3,
+	    0x1fb3, 0x0dd7, 0x292f, 0x23f2, 0x0645, 0x4578, 0x4816, 0x1790,
+	    0x0000, 0x1145, 0x0860, 0x3b34, 0x149d, 0x0b74, 0x0000, 0x209a,
+	    0x1e10, 0x15d9, 0x3cd5, 0x074d, 0x161c, 0x1a55, 0x1f5b, 0x2024,
+	    0x2c21, 0x1116, 0x27d4, 0x1584, 0x1640, 0x48bd, 0x1199, 0x18bb,
+	    0x173a, 0x0000, 0x0bc8, 0x0000, 0x1d10, 0x4093, 0x0dbb, 0x2ea0,
+	    0x02cb, 0x2898, 0x4d39, 0x0000, 0x0000, 0x0a50, 0x4b91, 0x3fc8,
+	    0x0125, 0x2256, 0x0000, 0x44a1, 0x34c6, 0x33f6, 0x4e18, 0x3ec6,
+	    0x0000, 0x410f, 0x4aa2, 0x0000, 0x190c, 0x0000, 0x0e7e, 0x3e10,
+	    0x1149, 0x0000, 0x07b1, 0x2b30, 0x382e, 0x11fe, 0x0be8, 0x0000,
+	    0x4ce2, 0x14d3, 0x128e, 0x4349, 0x3dc7, 0x10ae, 0x2d4f, 0x200b,
+	    0x352e, 0x08cd, 0x4350, 0x0afe, 0x1732, 0x3c18, 0x0000, 0x2b00,
+	    0x0000, 0x2fe8, 0x4bc9, 0x1bf7, 0x4df4, 0x26ba, 0x0000, 0x3782,
+	    0x329b, 0x4204, 0x285f, 0x05c4, 0x0000, 0x4d07, 0x1059, 0x4b43,
+	    0x2c4b, 0x1c18, 0x0000, 0x3664, 0x0000, 0x4ac1, 0x4a92, 0x0125,
+	    0x4b9d, 0x0000, 0x3f78, 0x05ab, 0x1104, 0x2730, 0x1749, 0x07c0,
+	    0x0000, 0x4ce5, 0x331e, 0x0d70, 0x3d89, 0x1d49, 0x2aa9, 0x3b3c,
+	    0x0000, 0x396f, 0x0000, 0x4869, 0x053f, 0x0d91, 0x1a20, 0x097a,
+	    0x377c, 0x1c4d, 0x1288, 0x1191, 0x373c, 0x3baa, 0x1772, 0x4441,
+	    0x241e, 0x1e6b, 0x0f43, 0x39c0, 0x3c48, 0x0000, 0x0000, 0x244f,
+	    0x0000, 0x28ab, 0x07d5, 0x3ad5, 0x3f21, 0x1dd7, 0x3ef1, 0x2837,
+	    0x041e, 0x273f, 0x4a6c, 0x0000, 0x0000, 0x0000, 0x1959, 0x11b7,
+	    0x433a, 0x2064, 0x0000, 0x0000, 0x3765, 0x1444, 0x0fa5, 0x04d3,
+	    0x1647, 0x3053, 0x2a07, 0x41b5, 0x3eea, 0x3946, 0x40c0, 0x449e,
+	    0x0eb3, 0x3a47, 0x0622, 0x0fe4, 0x4d74, 0x2096, 0x26be, 0x3670,
+	    0x0000, 0x4d10, 0x0000, 0x1b80, 0x45b0, 0x4837, 0x1b53, 0x0000,
+	    0x1ff5, 0x49d1, 0x0000, 0x4649, 0x13cd, 0x19ce, 0x0b2c, 0x3b04,
+	    0x0768, 0x1d03, 0x27b5, 0x1fac, 0x0000, 0x0000, 0x22ac, 0x2dba,
+	    0x2373, 0x287c, 0x4c4d, 0x451e, 0x18dc, 0x0000, 0x0000, 0x2236,
+	    0x3274, 0x3abb, 0x2eb1, 0x3958, 0x0000, 0x1858, 0x1ac7, 0x2b53,
+	    0x2f5b, 0x4ad8, 0x2581, 0x0000, 0x206d, 0x05f7, 0x12a7, 0x1d25,
+	    0x0000, 0x32fa, 0x094f, 0x0355, 0x3bb6, 0x399e, 0x1d92, 0x2e10,
+	    0x19b9, 0x0d98, 0x44d3, 0x3220, 0x0ffe, 0x1e91, 0x1810, 0x2ccd,
+	    0x0000, 0x0000, 0x3a7b, 0x0000, 0x1a5b, 0x3e05, 0x0000, 0x0974,
+	    0x4677, 0x0000, 0x3f44, 0x23cb, 0x329f, 0x36f9, 0x21bc, 0x47a8,
+	    0x1789, 0x2d4a, 0x49c4, 0x0000, 0x2d60, 0x212c, 0x3fe2, 0x0000,
+	    0x108d, 0x0000, 0x0000, 0x0000, 0x4bd1, 0x0000, 0x0ce3, 0x0000,
+	    0x0000, 0x121a, 0x194f, 0x0ecd, 0x0000, 0x038f, 0x18b2, 0x2e83,
+	    0x4656, 0x09ed, 0x2a8c, 0x2fb5, 0x1be6, 0x05d1, 0x0daf, 0x3c36,
+	    0x44e7, 0x3d92, 0x325b, 0x0000, 0x0000, 0x21c4, 0x0e04, 0x0000,
+	    0x0000, 0x0000, 0x3bed, 0x2eb2, 0x274a, 0x2d52, 0x319f, 0x3a40,
+	    0x0000, 0x19b2, 0x0413, 0x2874, 0x2307, 0x094d, 0x1b29, 0x3866,
+	    0x2b9f, 0x2335, 0x0d2a, 0x3b5d, 0x4938, 0x329b, 0x25c8, 0x0e8a,
+	    0x0780, 0x071e, 0x0000, 0x0499, 0x01b7, 0x3877, 0x35d2, 0x337f,
+	    0x0000, 0x06ae, 0x3627, 0x39c3, 0x409e, 0x2d67, 0x3f0c, 0x1cca,
+	    0x0000, 0x168e, 0x0000, 0x066e, 0x0000, 0x0000, 0x1dbd, 0x2143,
+	    0x0000, 0x2d8f, 0x0000, 0x3e7f, 0x24c0, 0x2028, 0x4284, 0x0bd7,
+	    0x0000, 0x0000, 0x4b48, 0x083c, 0x0a1b, 0x0000, 0x20ef, 0x1ed6,
+	    0x04bf, 0x3bcb, 0x2ada, 0x0000, 0x1875, 0x3729, 0x1cc2, 0x1b6b,
+	    0x0000, 0x02b8, 0x33ec, 0x0000, 0x0000, 0x1ea1, 0x036e, 0x4812,
+	    0x05ed, 0x125d, 0x36c6, 0x1de0, 0x132d, 0x0000, 0x11b8, 0x250d,
+	    0x15f5, 0x22ba, 0x0000, 0x39c1, 0x317a, 0x3df7, 0x4a86, 0x0475,
+	    0x4d52, 0x0758, 0x47ba, 0x34f1, 0x15cc, 0x3eef, 0x171a, 0x2728,
+	    0x04ae, 0x1bbc, 0x0ee3, 0x1f11, 0x4dcb, 0x053d, 0x44b2, 0x13ba,
+	    0x0000, 0x2d63, 0x1214, 0x0206, 0x0000, 0x0a6d, 0x0000, 0x11f5,
+	    0x0000, 0x10cf, 0x4496, 0x4a17, 0x1483, 0x4294, 0x1425, 0x2c9f,
+	    0x1b84, 0x4afd, 0x3b07, 0x3497, 0x28c9, 0x326e, 0x0000, 0x2692,
+	    0x0000, 0x25a8, 0x0887, 0x0000, 0x4ad4, 0x0000, 0x451f, 0x1a61,
+	    0x1c2a, 0x43fc, 0x1e4d, 0x28e3, 0x1ea3, 0x47a2, 0x2bb5, 0x40d9,
+	    0x4c72, 0x3004, 0x4597, 0x225b, 0x0000, 0x41ee, 0x2273, 0x1c4b,
+	    0x0ccb, 0x3e2e, 0x1c6f, 0x1135, 0x0071, 0x2d92, 0x0000, 0x3b7d,
+	    0x3e02, 0x0000, 0x3c88, 0x3777, 0x02e2, 0x0000, 0x4c3d, 0x2260,
+	    0x3ff5, 0x3a9f, 0x0ee0, 0x0000, 0x0183, 0x3f9b, 0x45e3, 0x4cc1,
+	    0x152a, 0x04c5, 0x1fde, 0x3b39, 0x0f3d, 0x33bc, 0x4c0b, 0x20ee,
+	    0x0d79, 0x4031, 0x14c8, 0x00b4, 0x13e3, 0x2038, 0x3e16, 0x17f2,
+	    0x4722, 0x4c57, 0x428e, 0x4adf, 0x3b1a, 0x122f, 0x1cc7, 0x3a76,
+	    0x0000, 0x0874, 0x4ab4, 0x3a73, 0x0000, 0x2c41, 0x3357, 0x2bc9,
+	    0x45b9, 0x25e5, 0x23e4, 0x41e1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2c7a, 0x1ef1, 0x21c0, 0x0000, 0x2a9a, 0x4ca5, 0x37f9, 0x2566,
+	    0x07e7, 0x0000, 0x2d37, 0x0f77, 0x0000, 0x0314, 0x0000, 0x0e43,
+	    0x0000, 0x2cab, 0x0000, 0x3fa0, 0x3344, 0x29b5, 0x067e, 0x2098,
+	    0x0000, 0x0000, 0x1054, 0x20ad, 0x060a, 0x168a, 0x2043, 0x2800,
+	    0x2884, 0x2bfd, 0x2b8d, 0x33f9, 0x0e26, 0x0000, 0x0daf, 0x0b44,
+	    0x0000, 0x0000, 0x34d1, 0x27d9, 0x4143, 0x2120, 0x0000, 0x0697,
+	    0x4083, 0x038f, 0x349f, 0x1b81, 0x377b, 0x08f4, 0x349b, 0x0000,
+	    0x1ca1, 0x0498, 0x44e2, 0x1dc9, 0x4296, 0x0000, 0x0000, 0x3329,
+	    0x02cc, 0x467a, 0x0344, 0x0013, 0x2a0d, 0x371b, 0x0000, 0x4b3e,
+	    0x0aeb, 0x373e, 0x3661, 0x118c, 0x1ad6, 0x0fae, 0x0000, 0x0000,
+	    0x26c6, 0x49de, 0x0000, 0x1b74, 0x2acb, 0x0000, 0x0000, 0x4b04,
+	    0x2a79, 0x48f9, 0x2904, 0x0e27, 0x2551, 0x0000, 0x3016, 0x30c4,
+	    0x3fca, 0x0000, 0x047e, 0x1274, 0x1920, 0x358e, 0x0000, 0x0000,
+	    0x1175, 0x116d, 0x2853, 0x2df4, 0x3466, 0x3e15, 0x246e, 0x0ef7,
+	    0x0000, 0x2e07, 0x1a05, 0x21e4, 0x0000, 0x0504, 0x0c72, 0x161e,
+	    0x2370, 0x2756, 0x008b, 0x0415, 0x1eef, 0x0a37, 0x2bed, 0x2e81,
+	    0x3c9f, 0x1783, 0x05cd, 0x19e3, 0x4325, 0x2b00, 0x364c, 0x0fca,
+	    0x1b35, 0x33b4, 0x2d2c, 0x3036, 0x2e41, 0x4244, 0x17cd, 0x0822,
+	    0x2e0b, 0x0346, 0x0000, 0x48b5, 0x37f0, 0x0ed9, 0x1856, 0x0762,
+	    0x0000, 0x0000, 0x25ed, 0x0000, 0x06b2, 0x0b4d, 0x0000, 0x043f,
+	    0x176a, 0x2b68, 0x0000, 0x0a15, 0x0000, 0x0c5d, 0x0d50, 0x49cd,
+	    0x0ad7, 0x21ae, 0x3741, 0x12b5, 0x0000, 0x0000, 0x0000, 0x41dc,
+	    0x0000, 0x37ae, 0x0000, 0x3693, 0x0000, 0x0000, 0x1808, 0x1549,
+	    0x4764, 0x1c04, 0x1072, 0x0000, 0x0000, 0x2f6e, 0x0b23, 0x077e,
+	    0x3af7, 0x0f1d, 0x29c7, 0x1be8, 0x036b, 0x3b3f, 0x4d23, 0x1677,
+	    0x2b74, 0x34f3, 0x3b67, 0x03bd, 0x0000, 0x378f, 0x2081, 0x23ed,
+	    0x0000, 0x034e, 0x1dd0, 0x2f16, 0x3b70, 0x0000, 0x00fd, 0x42b4,
+	    0x0ffb, 0x0a70, 0x0000, 0x07ad, 0x308d, 0x4d8a, 0x0318, 0x1734,
+	    0x2223, 0x19e1, 0x12e8, 0x1fdc, 0x0ddb, 0x26b8, 0x0000, 0x0000,
+	    0x264d, 0x2b67, 0x44b1, 0x212b, 0x0e88, 0x1309, 0x2fde, 0x0000,
+	    0x1079, 0x0618, 0x0000, 0x2829, 0x0000, 0x3c70, 0x1f3a, 0x0ad2,
+	    0x11bd, 0x0b91, 0x41ed, 0x1eaf, 0x0000, 0x3b2b, 0x308f, 0x32e7,
+	    0x0f80, 0x3baa, 0x434d, 0x4806, 0x02bd, 0x457b, 0x083c, 0x02d3,
+	    0x3ae0, 0x1750, 0x2b4f, 0x3a9a, 0x4755, 0x341e, 0x024c, 0x1fc2,
+	    0x102d, 0x110f, 0x0000, 0x22ae, 0x30ae, 0x331c, 0x04fe, 0x152e,
+	    0x25ca, 0x37af, 0x2d48, 0x02fe, 0x0000, 0x4d50, 0x0cf0, 0x31e6,
+	    0x161b, 0x216c, 0x12a9, 0x3f00, 0x02f5, 0x0000, 0x009c, 0x01c1,
+	    0x0000, 0x14d6, 0x26c1, 0x0b11, 0x0000, 0x090a, 0x0a15, 0x1991,
+	    0x46cc, 0x0aa4, 0x3b05, 0x4976, 0x07f9, 0x0000, 0x332d, 0x2d9a,
+	    0x0000, 0x177f, 0x2868, 0x2211, 0x0000, 0x1479, 0x120d, 0x1ab8,
+	    0x1ecd, 0x2092, 0x3b93, 0x2934, 0x0039, 0x3bd7, 0x05ff, 0x1ef3,
+	    0x04d6, 0x290b, 0x4a99, 0x0a15, 0x0b86, 0x2bed, 0x0000, 0x2510,
+	    0x127c, 0x0000, 0x0000, 0x3d79, 0x2697, 0x1343, 0x0528, 0x02fc,
+	    0x42f5, 0x1c6a, 0x36dd, 0x1df4, 0x120a, 0x0767, 0x489c, 0x0000,
+	    0x26d0, 0x0000, 0x0c14, 0x18b8, 0x4ac0, 0x4d2a, 0x4a9f, 0x0c4f,
+	    0x3d48, 0x22da, 0x4059, 0x2557, 0x26c1, 0x43ca, 0x0000, 0x00e4,
+	    0x1386, 0x221b, 0x237f, 0x4173, 0x0ccd, 0x0000, 0x16a0, 0x4bac,
+	    0x04b7, 0x16f7, 0x2013, 0x318b, 0x0a9f, 0x045a, 0x21e9, 0x2216,
+	    0x4571, 0x1dcf, 0x2b07, 0x0e16, 0x0533, 0x0000, 0x00d4, 0x2469,
+	    0x1d9a, 0x281d, 0x4b4d, 0x3679, 0x3816, 0x05d6, 0x059e, 0x17c4,
+	    0x4251, 0x0000, 0x1db9, 0x01fa, 0x3762, 0x0000, 0x3c6e, 0x126e,
+	    0x0f1b, 0x051c, 0x434a, 0x45d1, 0x20bf, 0x4264, 0x1b51, 0x0000,
+	    0x47e2, 0x301f, 0x307e, 0x190e, 0x0d7a, 0x06e3, 0x0000, 0x3a6c,
+	    0x4a06, 0x29dc, 0x40fe, 0x2cfd, 0x21af, 0x3d04, 0x385d, 0x0000,
+	    0x246d, 0x0825, 0x0000, 0x4d76, 0x0000, 0x08a7, 0x4500, 0x2cf9,
+	    0x49d0, 0x2fdf, 0x29c0, 0x48d2, 0x1160, 0x1131, 0x10ad, 0x3eea,
+	    0x3855, 0x24d4, 0x0000, 0x0000, 0x2b5b, 0x272a, 0x44ca, 0x0000,
+	    0x314e, 0x2ba8, 0x3106, 0x304f, 0x0000, 0x039b, 0x4ae8, 0x2de1,
+	    0x3476, 0x0000, 0x36d0, 0x0000, 0x16e7, 0x4615, 0x494b, 0x4a08,
+	    0x4db8, 0x0000, 0x1ed5, 0x369d, 0x4181, 0x0000, 0x1562, 0x0000,
+	    0x140b, 0x0f8d, 0x0000, 0x10da, 0x39a9, 0x0000, 0x1e02, 0x2bcf,
+	    0x2353, 0x2ffa, 0x1f73, 0x0d78, 0x05b2, 0x2662, 0x32de, 0x1835,
+	    0x2641, 0x4b62, 0x145e, 0x0000, 0x2868, 0x3b01, 0x0000, 0x2a02,
+	    0x4c76, 0x26d1, 0x037e, 0x4738, 0x2175, 0x1cbc, 0x2636, 0x4005,
+	    0x2be4, 0x1fde, 0x2776, 0x3fe8, 0x485d, 0x4526, 0x0000, 0x0000,
+	    0x1334, 0x1058, 0x10a0, 0x4bf9, 0x2053, 0x1811, 0x367a, 0x4abc,
+	    0x0000, 0x0000, 0x0938, 0x0de1, 0x0000, 0x0000, 0x003a, 0x152d,
+	    0x15fb, 0x459e, 0x3181, 0x0000, 0x4b2a, 0x01b4, 0x179e, 0x07c6,
+	    0x17e2, 0x2436, 0x1196, 0x3c3d, 0x0000, 0x0000, 0x4dbf, 0x3b8d,
+	    0x1cf3, 0x2a91, 0x4c9f, 0x4866, 0x163e, 0x18a7, 0x4289, 0x2e5f,
+	    0x2280, 0x4b60, 0x368e, 0x0405, 0x24dd, 0x3033, 0x0000, 0x2354,
+	    0x0000, 0x384b, 0x0000, 0x0762, 0x33b6, 0x4714, 0x1e2f, 0x1940,
+	    0x2fec, 0x0000, 0x100c, 0x470a, 0x2f7d, 0x2b7f, 0x0000, 0x233d,
+	    0x0000, 0x2cf7, 0x2336, 0x24df, 0x0572, 0x4736, 0x44ce, 0x0000,
+	    0x2c24, 0x0b66, 0x0068, 0x3568, 0x0000, 0x0f63, 0x0000, 0x0000,
+	    0x2568, 0x13d2, 0x225d, 0x47e9, 0x280a, 0x1357, 0x2b7a, 0x3b27,
+	    0x0000, 0x3334, 0x3d17, 0x157b, 0x3f6b, 0x447e, 0x45f3, 0x0830,
+	    0x0000, 0x0000, 0x4941, 0x1bf8, 0x1eeb, 0x1177, 0x0000, 0x0000,
+	    0x1226, 0x4530, 0x4919, 0x42a0, 0x2570, 0x3dd2, 0x0000, 0x3733,
+	    0x0000, 0x1ae0, 0x0000, 0x106f, 0x013a, 0x2c38, 0x0000, 0x2fe0,
+	    0x2f47, 0x41e4, 0x094c, 0x3ee1, 0x16b0, 0x256a, 0x0000, 0x0000,
+	    0x1c64, 0x051e, 0x17ac, 0x0000, 0x306d, 0x47b3, 0x257a, 0x0d4e,
+	    0x112f, 0x0183, 0x38eb, 0x08e3, 0x1b49, 0x0cc5, 0x4311, 0x0000,
+	    0x38f4, 0x0700, 0x2bec, 0x4c63, 0x0e51, 0x2723, 0x1bd4, 0x024a,
+	    0x0000, 0x1c33, 0x4713, 0x0000, 0x09fc, 0x0e57, 0x1951, 0x4987,
+	    0x0b07, 0x214f, 0x0c93, 0x1acb, 0x2981, 0x0000, 0x2748, 0x00a9,
+	    0x36da, 0x0470, 0x0cb6, 0x0000, 0x32fd, 0x075a, 0x0000, 0x0000,
+	    0x2257, 0x1da3, 0x0000, 0x1510, 0x1a09, 0x284e, 0x35c4, 0x4300,
+	    0x45ab, 0x07b3, 0x02cf, 0x0000, 0x0c0a, 0x0000, 0x4080, 0x0000,
+	    0x3b75, 0x36e9, 0x074a, 0x44cf, 0x2e23, 0x038d, 0x1494, 0x231d,
+	    0x24d2, 0x4b0d, 0x2716, 0x0835, 0x14ff, 0x0000, 0x0648, 0x0af0,
+	    0x440f, 0x0d9e, 0x0df0, 0x0000, 0x4bd6, 0x448a, 0x1e8d, 0x02c3,
+	    0x1b9e, 0x220a, 0x436a, 0x0e10, 0x1d43, 0x4240, 0x42e4, 0x4e11,
+	    0x3275, 0x2775, 0x0000, 0x0000, 0x479e, 0x1b5d, 0x2b62, 0x3b02,
+	    0x0765, 0x0a4a, 0x4901, 0x0000, 0x2b8e, 0x30d1, 0x14cb, 0x39cd,
+	    0x0000, 0x0000, 0x3b68, 0x0000, 0x0016, 0x0df5, 0x2259, 0x218b,
+	    0x4624, 0x0000, 0x1f28, 0x31cd, 0x38d4, 0x0c43, 0x0000, 0x221a,
+	    0x0000, 0x1bb4, 0x0000, 0x07d0, 0x102b, 0x31f6, 0x1c54, 0x0000,
+	    0x4bb4, 0x1a4c, 0x20bb, 0x1d8b, 0x2a70, 0x4745, 0x34c8, 0x254c,
+	    0x1e46, 0x0000, 0x45bc, 0x48e0, 0x0000, 0x0000, 0x3f7d, 0x327e,
+	    0x2986, 0x4069, 0x435c, 0x35d8, 0x4bd5, 0x0000, 0x10ab, 0x0000,
+	    0x1f14, 0x058f, 0x090f, 0x1241, 0x05f8, 0x44ad, 0x2ea2, 0x36a6,
+	    0x3fb0, 0x0000, 0x3bd5, 0x3dec, 0x199a, 0x1dce, 0x088e, 0x4b34,
+	    0x0000, 0x4073, 0x30b8, 0x3c04, 0x0000, 0x16ec, 0x2403, 0x4d6e,
+	    0x3990, 0x23cc, 0x240a, 0x217f, 0x2077, 0x10d6, 0x31fe, 0x2b96,
+	    0x0eae, 0x0000, 0x1f57, 0x3418, 0x353d, 0x0000, 0x3791, 0x0000,
+	    0x368e, 0x0000, 0x1fb2, 0x0000, 0x340b, 0x33fb, 0x247e, 0x30a1,
+	    0x0000, 0x142d, 0x3df0, 0x0e53, 0x0514, 0x340c, 0x07e0, 0x2885,
+	    0x0000, 0x2fab, 0x04d1, 0x1f6e, 0x0000, 0x0000, 0x0000, 0x1c06,
+	    0x214a, 0x4680, 0x08eb, 0x01eb, 0x0075, 0x1c7e, 0x0000, 0x01fe,
+	    0x0000, 0x3d13, 0x0d0a, 0x3608, 0x1af5, 0x0000, 0x2b47, 0x35cf,
+	    0x0000, 0x3942, 0x346a, 0x424f, 0x0730, 0x0000, 0x33ca, 0x020e,
+	    0x0000, 0x1146, 0x0000, 0x0a10, 0x0000, 0x170d, 0x0000, 0x025b,
+	    0x3ebd, 0x3ba8, 0x419a, 0x1f51, 0x2131, 0x3c99, 0x17f7, 0x4ba5,
+	    0x1542, 0x40d8, 0x4615, 0x3576, 0x12ba, 0x3cdb, 0x0000, 0x044f,
+	    0x245b, 0x2a90, 0x2d31, 0x3dd6, 0x0000, 0x01e6, 0x07ab, 0x22be,
+	    0x15f5, 0x4a8d, 0x2c24, 0x2901, 0x2ab6, 0x0b40, 0x02ca, 0x33c9,
+	    0x1476, 0x2bc5, 0x3bd1, 0x0000, 0x4e02, 0x3ee2, 0x2b8b, 0x2b33,
+	    0x003c, 0x0000, 0x309d, 0x2424, 0x0edf, 0x48fe, 0x00ec, 0x3d74,
+	    0x0000, 0x3d4b, 0x0000, 0x45e4, 0x1642, 0x2a7b, 0x2527, 0x2935,
+	    0x03c8, 0x2b25, 0x03d1, 0x4042, 0x0000, 0x1799, 0x1168, 0x04e5,
+	    0x0000, 0x1ada, 0x1246, 0x3d80, 0x2a5a, 0x2dd9, 0x0472, 0x4639,
+	    0x1a9f, 0x0035, 0x1ec0, 0x33b6, 0x43af, 0x4092, 0x3e17, 0x3113,
+	    0x32dd, 0x0000, 0x0000, 0x177a, 0x0000, 0x1454, 0x0acf, 0x4dbb,
+	    0x0000, 0x4b68, 0x3120, 0x0000, 0x09ac, 0x2966, 0x1cc2, 0x33c9,
+	    0x3626, 0x098b, 0x1779, 0x2d31, 0x1a11, 0x16f8, 0x19ee, 0x17a0,
+	    0x20b5, 0x15bd, 0x0000, 0x1961, 0x3e54, 0x4684, 0x0000, 0x21b7,
+	    0x2699, 0x032d, 0x2adb, 0x0000, 0x4518, 0x4953, 0x4792, 0x46e2,
+	    0x4412, 0x2a7e, 0x27d9, 0x0a9a, 0x3813, 0x0000, 0x1ada, 0x0000,
+	    0x4444, 0x0a38, 0x35ba, 0x3285, 0x18b5, 0x0000, 0x0000, 0x4856,
+	    0x0503, 0x38f5, 0x20b4, 0x1df8, 0x465c, 0x0000, 0x4742, 0x2edb,
+	    0x3ba7, 0x0615, 0x323e, 0x1e31, 0x456c, 0x49d7, 0x0b3f, 0x0000,
+	    0x278f, 0x13e2, 0x3822, 0x39e1, 0x0260, 0x172c, 0x47cd, 0x078d,
+	    0x1cb1, 0x3e2e, 0x3d3d, 0x2f8b, 0x2aee, 0x1683, 0x1616, 0x2b2d,
+	    0x3884, 0x0e9c, 0x410c, 0x2e33, 0x3e81, 0x092f, 0x0000, 0x3d3a,
+	    0x226d, 0x37e4, 0x42e0, 0x0000, 0x3671, 0x0000, 0x22a9, 0x44bc,
+	    0x0705, 0x4bf7, 0x47d6, 0x100b, 0x0000, 0x2248, 0x2851, 0x3217,
+	    0x3059, 0x1462, 0x41e8, 0x4625, 0x005e, 0x05db, 0x081f, 0x2af1,
+	    0x1953, 0x0000, 0x4c29, 0x0eb0, 0x46ca, 0x29ea, 0x2f6c, 0x0000,
+	    0x15ed, 0x34d1, 0x4b14, 0x0000, 0x0000, 0x0ea3, 0x0d1b, 0x16f1,
+	    0x45fe, 0x17b2, 0x01e4, 0x20fe, 0x079f, 0x20cc, 0x4dee, 0x37b0,
+	    0x43ce, 0x2ef5, 0x16b5, 0x0e33, 0x21a0, 0x35fa, 0x0bd9, 0x386c,
+	    0x0000, 0x3973, 0x087d, 0x1c85, 0x0000, 0x0000, 0x0000, 0x3006,
+	    0x47d9, 0x0000, 0x3f64, 0x2dea, 0x416d, 0x2a74, 0x4b72, 0x1008,
+	    0x3a32, 0x2655, 0x14de, 0x200d, 0x099e, 0x07f6, 0x0000, 0x4c84,
+	    0x15f6, 0x20a4, 0x2367, 0x4919, 0x03d8, 0x4c66, 0x2ff0, 0x0000,
+	    0x403f, 0x1eea, 0x1bcd, 0x188c, 0x0000, 0x08be, 0x2020, 0x408f,
+	    0x11fb, 0x077f, 0x29b3, 0x02a1, 0x0000, 0x2158, 0x03bb, 0x387a,
+	    0x0081, 0x0cff, 0x04bc, 0x0337, 0x2960, 0x0537, 0x3352, 0x0000,
+	    0x138c, 0x0000, 0x2303, 0x240e, 0x1196, 0x168f, 0x3386, 0x2407,
+	    0x35c1, 0x07bf, 0x0a13, 0x0000, 0x02df, 0x4199, 0x0000, 0x2d09,
+	    0x3eb8, 0x0afd, 0x283a, 0x187e, 0x34d6, 0x2672, 0x23d7, 0x0000,
+	    0x408e, 0x27d9, 0x363d, 0x01fc, 0x0000, 0x2d13, 0x0564, 0x0029,
+	    0x149a, 0x0000, 0x2f79, 0x2024, 0x25a2, 0x0e03, 0x0603, 0x3f40,
+	    0x0000, 0x4b05, 0x34f2, 0x3400, 0x2e95, 0x0000, 0x3aed, 0x1b40,
+	    0x326d, 0x0067, 0x0000, 0x0000, 0x3df3, 0x1329, 0x0b6c, 0x0000,
+	    0x0000, 0x15f6, 0x0563, 0x0cbd, 0x0000, 0x28db, 0x0000, 0x4780,
+	    0x09ce, 0x087e, 0x2139, 0x3f84, 0x2d36, 0x22aa, 0x0000, 0x4341,
+	    0x0000, 0x25ad, 0x314c, 0x2322, 0x37c7, 0x42ae, 0x0000, 0x241a,
+	    0x1ff7, 0x1013, 0x0000, 0x08d8, 0x2abb, 0x4246, 0x0811, 0x1cf0,
+	    0x2149, 0x2d5f, 0x1d87, 0x1967, 0x0000, 0x04cd, 0x19f4, 0x0000,
+	    0x1066, 0x2a3c, 0x35d8, 0x3e87, 0x15b7, 0x4057, 0x3df9, 0x0000,
+	    0x0000, 0x25b4, 0x06ed, 0x2c8e, 0x12cd, 0x0000, 0x391e, 0x0000,
+	    0x3d45, 0x1a14, 0x0000, 0x1596, 0x273e, 0x27a3, 0x27b9, 0x2d67,
+	    0x0000, 0x4c96, 0x029f, 0x0000, 0x2b3d, 0x4710, 0x27b7, 0x092f,
+	    0x49a6, 0x3816, 0x1b8a, 0x1153, 0x39e5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4ae2, 0x0af4, 0x2eee, 0x449c, 0x061a, 0x108d, 0x3930,
+	    0x4b32, 0x1840, 0x43a6, 0x2a07, 0x2c54, 0x0a0f, 0x1822, 0x2a4a,
+	    0x2693, 0x0fd8, 0x04f2, 0x130e, 0x0000, 0x2896, 0x2ef1, 0x0000,
+	    0x1186, 0x41aa, 0x0000, 0x1a8d, 0x1dfb, 0x2234, 0x10a0, 0x056d,
+	    0x0000, 0x0000, 0x0f9b, 0x33ff, 0x4c53, 0x45eb, 0x31e9, 0x2f89,
+	    0x193d, 0x3792, 0x379b, 0x4aeb, 0x0087, 0x02be, 0x46e9, 0x0000,
+	    0x0870, 0x0e93, 0x0000, 0x2a81, 0x2eca, 0x0000, 0x45a7, 0x47f3,
+	    0x0000, 0x03de, 0x20f7, 0x0000, 0x36ca, 0x0000, 0x1b85, 0x2650,
+	    0x4c6a, 0x063e, 0x18f8, 0x2e8b, 0x06a5, 0x0000, 0x0915, 0x1e9a,
+	    0x4a89, 0x48e5, 0x31a1, 0x190e, 0x36f9, 0x0000, 0x3c80, 0x32ee,
+	    0x4bc2, 0x0000, 0x389b, 0x0c0e, 0x2f7e, 0x236b, 0x3bbd, 0x0bd2,
+	    0x472b, 0x44d3, 0x2465, 0x27e0, 0x1332, 0x3722, 0x39cd, 0x0d71,
+	    0x26ba, 0x0000, 0x434c, 0x442a, 0x33da, 0x0000, 0x3273, 0x48eb,
+	    0x025c, 0x0000, 0x2fb0, 0x4dba, 0x0000, 0x312a, 0x12d2, 0x4d75,
+	    0x3f6a, 0x0000, 0x1ec6, 0x0678, 0x1c28, 0x0000, 0x3ab8, 0x073d,
+	    0x1808, 0x0024, 0x1209, 0x4273, 0x2759, 0x4d93, 0x0000, 0x1599,
+	    0x19ef, 0x37f3, 0x24b4, 0x0000, 0x1914, 0x0300, 0x4d01, 0x0000,
+	    0x0f97, 0x00b5, 0x2b34, 0x495b, 0x2ca7, 0x0000, 0x271e, 0x0000,
+	    0x2e0d, 0x25f2, 0x2dc5, 0x0000, 0x0000, 0x2690, 0x0eee, 0x3385,
+	    0x3305, 0x15b3, 0x4022, 0x0000, 0x0823, 0x0000, 0x09af, 0x06ce,
+	    0x2835, 0x2c9d, 0x23c2, 0x055c, 0x2441, 0x48c0, 0x29e7, 0x3ae6,
+	    0x4238, 0x4b19, 0x09e6, 0x0000, 0x312a, 0x4512, 0x0000, 0x22ad,
+	    0x2d70, 0x0000, 0x4a98, 0x0000, 0x30f8, 0x38f4, 0x0000, 0x3abd,
+	    0x39de, 0x0000, 0x05d7, 0x429e, 0x0000, 0x28d7, 0x0000, 0x0d4d,
+	    0x17b1, 0x31e0, 0x3b64, 0x4d89, 0x267f, 0x4cf8, 0x2f91, 0x0000,
+	    0x3bb2, 0x0e89, 0x0000, 0x0f80, 0x13a9, 0x3b59, 0x46f1, 0x0b6b,
+	    0x258a, 0x4061, 0x021f, 0x0000, 0x0049, 0x4514, 0x32b6, 0x4601,
+	    0x204a, 0x1808, 0x1bd5, 0x0d68, 0x4623, 0x1677, 0x0000, 0x0000,
+	    0x0871, 0x10f1, 0x25db, 0x0000, 0x3536, 0x26e7, 0x1a68, 0x47cc,
+	    0x3d95, 0x0000, 0x0000, 0x0576, 0x0035, 0x15b5, 0x488d, 0x475f,
+	    0x0000, 0x0fc1, 0x4c67, 0x3f14, 0x3e03, 0x262e, 0x48bb, 0x1132,
+	    0x0000, 0x3bcc, 0x20b4, 0x2475, 0x0000, 0x169a, 0x2fb6, 0x0000,
+	    0x1831, 0x1db2, 0x13c9, 0x114c, 0x292f, 0x47c5, 0x2665, 0x2108,
+	    0x0c94, 0x0000, 0x04c4, 0x0000, 0x0000, 0x3cc2, 0x43fa, 0x3437,
+	    0x0000, 0x45c3, 0x0077, 0x0488, 0x3d2c, 0x0000, 0x4bc1, 0x259f,
+	    0x076d, 0x0de6, 0x0505, 0x4787, 0x0b19, 0x0000, 0x3d2c, 0x0000,
+	    0x05de, 0x181b, 0x1f5d, 0x469f, 0x2442, 0x41df, 0x0e30, 0x2c33,
+	    0x2b6b, 0x0000, 0x0000, 0x0000, 0x2a47, 0x1cd8, 0x0450, 0x3e3c,
+	    0x3998, 0x33c3, 0x2806, 0x396e, 0x339e, 0x302e, 0x0000, 0x471e,
+	    0x4289, 0x0000, 0x0000, 0x1594, 0x07ad, 0x2507, 0x2bc9, 0x485a,
+	    0x1485, 0x0000, 0x14fb, 0x1e7a, 0x0000, 0x204f, 0x19ab, 0x4505,
+	    0x0aa6, 0x345a, 0x0000, 0x1c9c, 0x4795, 0x265d, 0x21a9, 0x0273,
+	    0x0000, 0x0079, 0x4a2e, 0x0000, 0x16df, 0x089c, 0x0000, 0x29bb,
+	    0x0000, 0x0136, 0x487a, 0x4334, 0x2c51, 0x3f48, 0x0000, 0x4060,
+	    0x2640, 0x3e63, 0x0577, 0x2e55, 0x4c59, 0x0a15, 0x4ab4, 0x4685,
+	    0x0000, 0x41d0, 0x0000, 0x1ef4, 0x2957, 0x1790, 0x3d63, 0x25ee,
+	    0x0000, 0x49ed, 0x402e, 0x22c5, 0x2ada, 0x25ac, 0x1961, 0x33e1,
+	    0x114e, 0x2e2f, 0x480a, 0x0000, 0x0000, 0x40dc, 0x0e88, 0x0000,
+	    0x4a1e, 0x170e, 0x392a, 0x045f, 0x499f, 0x07f5, 0x23b1, 0x4b90,
+	    0x07f6, 0x05e5, 0x1ef2, 0x351b, 0x247a, 0x4534, 0x0000, 0x02cd,
+	    0x1743, 0x0000, 0x028c, 0x44aa, 0x468d, 0x43c5, 0x0000, 0x1d18,
+	    0x31c6, 0x3051, 0x29be, 0x4cea, 0x3624, 0x0000, 0x197c, 0x0000,
+	    0x08b9, 0x1a6c, 0x144b, 0x0000, 0x13bc, 0x2dcc, 0x0e9b, 0x1a99,
+	    0x2943, 0x14d7, 0x0e30, 0x487c, 0x0000, 0x1346, 0x0000, 0x4c7b,
+	    0x0904, 0x3352, 0x0be7, 0x0000, 0x0561, 0x0000, 0x1d28, 0x2f83,
+	    0x0aab, 0x00a9, 0x332e, 0x2b5b, 0x3f46, 0x0d4e, 0x19cc, 0x4cee,
+	    0x4ca7, 0x4ce8, 0x0000, 0x09bd, 0x0000, 0x139b, 0x1e87, 0x08ad,
+	    0x248c, 0x08f1, 0x0195, 0x0000, 0x0ec1, 0x3e06, 0x3d6d, 0x0aed,
+	    0x3491, 0x1b2b, 0x1cde, 0x0000, 0x00de, 0x3299, 0x3118, 0x40c3,
+	    0x27ea, 0x0e39, 0x0000, 0x11c8, 0x0000, 0x0537, 0x097a, 0x2abf,
+	    0x4db0, 0x392a, 0x166e, 0x27df, 0x0000, 0x4697, 0x0000, 0x0000,
+	    0x209d, 0x142a, 0x0000, 0x2e6e, 0x0642, 0x263f, 0x1c30, 0x35c7,
+	    0x3433, 0x4890, 0x29a5, 0x0bb6, 0x4238, 0x46b5, 0x3944, 0x237b,
+	    0x1679, 0x12d0, 0x0000, 0x2691, 0x49b6, 0x4a88, 0x016a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x492c, 0x2f4d, 0x426e, 0x3963, 0x3c3c,
+	    0x24e3, 0x0145, 0x15b8, 0x1ec9, 0x0000, 0x0cfa, 0x0c0e, 0x23e2,
+	    0x0099, 0x34bf, 0x17d1, 0x307a, 0x0f56, 0x083e, 0x0000, 0x33e9,
+	    0x2ca6, 0x43e2, 0x0000, 0x3412, 0x0dba, 0x4194, 0x42af, 0x280f,
+	    0x4081, 0x4d1b, 0x0c87, 0x11e8, 0x0b2d, 0x2a82, 0x470d, 0x0000,
+	    0x4b2b, 0x4bb0, 0x0fb3, 0x2247, 0x2ab6, 0x1498, 0x12c0, 0x05ae,
+	    0x2ab0, 0x4614, 0x2c36, 0x2f25, 0x320a, 0x45cd, 0x4641, 0x3241,
+	    0x3474, 0x1383, 0x0817, 0x0000, 0x21e8, 0x33b3, 0x29eb, 0x0000,
+	    0x41c0, 0x399c, 0x13d7, 0x0710, 0x2dfb, 0x3f57, 0x0246, 0x2052,
+	    0x13ed, 0x1c3d, 0x22c6, 0x2474, 0x00a4, 0x0000, 0x321c, 0x263d,
+	    0x36da, 0x0972, 0x1faa, 0x278c, 0x22f9, 0x1bf3, 0x2bbf, 0x1ad9,
+	    0x0000, 0x43bd, 0x0000, 0x4b2e, 0x3fec, 0x3492, 0x06c2, 0x29d1,
+	    0x2e10, 0x0000, 0x38b4, 0x3fbd, 0x3525, 0x21d9, 0x221e, 0x14a5,
+	    0x0cb5, 0x0000, 0x0000, 0x2c9a, 0x13b1, 0x0706, 0x29d1, 0x0000,
+	    0x3cb6, 0x0581, 0x2283, 0x30b9, 0x101d, 0x2e22, 0x29a6, 0x0000,
+	    0x0dbe, 0x0928, 0x2364, 0x34ff, 0x0000, 0x2e79, 0x0778, 0x2860,
+	    0x161a, 0x0000, 0x37d8, 0x0e99, 0x01b1, 0x0000, 0x3d20, 0x31bf,
+	    0x0320, 0x193e, 0x02bc, 0x09c5, 0x14b7, 0x05b2, 0x2f66, 0x3477,
+	    0x0000, 0x08b8, 0x0575, 0x0000, 0x0000, 0x2173, 0x3670, 0x0000,
+	    0x0000, 0x45ee, 0x3fbe, 0x0d68, 0x0000, 0x0fc5, 0x4723, 0x3b40,
+	    0x2e09, 0x0000, 0x4195, 0x4410, 0x3257, 0x1d9a, 0x042c, 0x3dd9,
+	    0x0000, 0x4caa, 0x18b7, 0x0127, 0x0b3c, 0x383c, 0x0000, 0x0000,
+	    0x390c, 0x1197, 0x3552, 0x0e94, 0x0000, 0x0ac5, 0x2989, 0x2b2d,
+	    0x4158, 0x241a, 0x0000, 0x4a19, 0x3df0, 0x2e2a, 0x0073, 0x2fb7,
+	    0x04eb, 0x43d3, 0x41dd, 0x41aa, 0x229f, 0x246f, 0x1de0, 0x0000,
+	    0x1455, 0x3231, 0x0891, 0x38e9, 0x3a33, 0x26a9, 0x1183, 0x4043,
+	    0x07bd, 0x3600, 0x2c13, 0x270d, 0x43b9, 0x0000, 0x1cf2, 0x43ed,
+	    0x1496, 0x0000, 0x0564, 0x28fa, 0x120a, 0x0b03, 0x1ce2, 0x4627,
+	    0x1c21, 0x1f6b, 0x0000, 0x0000, 0x1f55, 0x08ed, 0x08d4, 0x4b82,
+	    0x2e83, 0x30f1, 0x16ab, 0x0000, 0x254d, 0x43af, 0x077f, 0x0ed1,
+	    0x0000, 0x118c, 0x2ec5, 0x35ed, 0x46ee, 0x4626, 0x35cc, 0x2045,
+	    0x0000, 0x3c3a, 0x295f, 0x4228, 0x27e8, 0x048b, 0x07b7, 0x4d5f,
+	    0x0f1d, 0x109f, 0x39a1, 0x0000, 0x0da1, 0x4c6f, 0x0b6e, 0x0000,
+	    0x25a9, 0x2cb0, 0x15b2, 0x18f6, 0x39ae, 0x2d93, 0x0af2, 0x3fb4,
+	    0x2749, 0x0418, 0x0000, 0x0b6f, 0x072b, 0x15aa, 0x1d00, 0x0bdc,
+	    0x4b4e, 0x3ade, 0x1a3a, 0x11ec, 0x27c2, 0x0138, 0x0000, 0x22e2,
+	    0x0000, 0x2888, 0x0000, 0x4597, 0x174e, 0x2eb3, 0x20ad, 0x44cd,
+	    0x1797, 0x1374, 0x2015, 0x14fb, 0x1f4b, 0x0000, 0x0000, 0x25e9,
+	    0x0da7, 0x3a42, 0x468b, 0x2112, 0x3387, 0x076b, 0x19cf, 0x0000,
+	    0x0cfb, 0x416f, 0x3bac, 0x0000, 0x0552, 0x0000, 0x3803, 0x1ff0,
+	    0x4dc5, 0x26c4, 0x11e8, 0x1d22, 0x2a00, 0x1238, 0x0ea5, 0x0aa8,
+	    0x48c5, 0x32ae, 0x386e, 0x2867, 0x1649, 0x1868, 0x13d0, 0x16dc,
+	    0x1eec, 0x0000, 0x0b0d, 0x0e92, 0x36ee, 0x36e6, 0x1f8c, 0x0408,
+	    0x10e5, 0x0241, 0x47f6, 0x3c17, 0x1149, 0x48aa, 0x0000, 0x0000,
+	    0x3968, 0x2967, 0x3666, 0x0000, 0x153b, 0x0000, 0x1807, 0x3ed8,
+	    0x4ca2, 0x1ce1, 0x0c35, 0x12a9, 0x1603, 0x0f06, 0x15e9, 0x339b,
+	    0x1f7b, 0x08ca, 0x048d, 0x40f0, 0x0279, 0x0000, 0x21d2, 0x0903,
+	    0x0f2d, 0x3f56, 0x44b9, 0x4bf2, 0x3ccb, 0x0000, 0x14d0, 0x069e,
+	    0x0000, 0x355c, 0x4439, 0x2101, 0x3393, 0x2133, 0x4883, 0x3224,
+	    0x113f, 0x065b, 0x1d6a, 0x170f, 0x2447, 0x3d11, 0x2ef2, 0x0000,
+	    0x3ecb, 0x448e, 0x4851, 0x2aa8, 0x1106, 0x2499, 0x4af6, 0x4601,
+	    0x0000, 0x1f52, 0x0aac, 0x04b6, 0x4d1f, 0x0000, 0x4867, 0x320a,
+	    0x433a, 0x01b6, 0x13ad, 0x1b3a, 0x25f5, 0x046f, 0x1c50, 0x4d6d,
+	    0x34ce, 0x2495, 0x4022, 0x1576, 0x1ae8, 0x0000, 0x0ef1, 0x0000,
+	    0x0971, 0x221d, 0x0000, 0x2b66, 0x2d3a, 0x4bc1, 0x3928, 0x2576,
+	    0x0000, 0x0eb1, 0x0000, 0x0000, 0x4c4a, 0x0000, 0x241c, 0x1078,
+	    0x0000, 0x4ac4, 0x00d9, 0x29d8, 0x2845, 0x1f01, 0x1460, 0x12a0,
+	    0x222a, 0x2336, 0x2a8b, 0x3019, 0x3dd5, 0x3357, 0x175b, 0x2225,
+	    0x0000, 0x024d, 0x2589, 0x2bc7, 0x1e93, 0x0000, 0x1267, 0x370b,
+	    0x1795, 0x3aea, 0x31cc, 0x0cc7, 0x0000, 0x0000, 0x0351, 0x0c17,
+	    0x0307, 0x2653, 0x392b, 0x2aa4, 0x3323, 0x0000, 0x389e, 0x0000,
+	    0x011f, 0x3752, 0x0000, 0x19f5, 0x0000, 0x0740, 0x03fe, 0x2c88,
+	    0x2b90, 0x1092, 0x0a1b, 0x3b24, 0x26c1, 0x2fdc, 0x0e7b, 0x3822,
+	    0x44d5, 0x1da7, 0x1bbe, 0x4538, 0x2c2f, 0x22a4, 0x3993, 0x492d,
+	    0x0000, 0x0da7, 0x2da5, 0x23a5, 0x4218, 0x0c55, 0x4def, 0x0000,
+	    0x4640, 0x0a54, 0x34d5, 0x0c70, 0x116d, 0x0000, 0x465b, 0x2a76,
+	    0x0000, 0x0000, 0x3790, 0x3fbd, 0x1556, 0x498c, 0x3621, 0x0000,
+	    0x4244, 0x3dd6, 0x3f9f, 0x1cc3, 0x47e0, 0x4929, 0x1d6e, 0x0403,
+	    0x29d8, 0x229d, 0x4a40, 0x29e8, 0x0000, 0x408a, 0x3cc6, 0x3c4e,
+	    0x3f4f, 0x1e3d, 0x335a, 0x40dc, 0x0000, 0x0000, 0x0142, 0x2cd2,
+	    0x0280, 0x26ac, 0x0000, 0x366a, 0x00d0, 0x4a23, 0x102c, 0x3fa6,
+	    0x429d, 0x0d52, 0x1837, 0x40a3, 0x4821, 0x28cf, 0x31ee, 0x0d58,
+	    0x4a45, 0x222b, 0x17d3, 0x1855, 0x3740, 0x19d7, 0x2a10, 0x0000,
+	    0x14f3, 0x0000, 0x0503, 0x3286, 0x21fe, 0x4579, 0x33f6, 0x2e0f,
+	    0x0cae, 0x16ca, 0x04bd, 0x29de, 0x0256, 0x2e45, 0x0000, 0x3716,
+	    0x3474, 0x2590, 0x3c1f, 0x0000, 0x49f4, 0x1ed4, 0x0b8c, 0x3c96,
+	    0x0198, 0x0526, 0x03f9, 0x0000, 0x1f4a, 0x1601, 0x0000, 0x0000,
+	    0x1bde, 0x3c71, 0x03c2, 0x0000, 0x3f30, 0x439c, 0x0086, 0x24d8,
+	    0x1880, 0x0000, 0x20d5, 0x01d4, 0x0971, 0x0000, 0x1267, 0x49c3,
+	    0x4241, 0x0000, 0x0000, 0x1496, 0x17c4, 0x1832, 0x2777, 0x016d,
+	    0x4b7b, 0x1a73, 0x36f8, 0x2d05, 0x0000, 0x0000, 0x1289, 0x06cb,
+	    0x1324, 0x3fd9, 0x07a7, 0x01e2, 0x0000, 0x4d07, 0x1077, 0x2cfa,
+	    0x0000, 0x4930, 0x4429, 0x30fd, 0x12d1, 0x0eb5, 0x217b, 0x0000,
+	    0x4a19, 0x09e1, 0x2650, 0x2cda, 0x027e, 0x336f, 0x0b6a, 0x0825,
+	    0x021c, 0x0000, 0x01e0, 0x0a2b, 0x3edd, 0x2d96, 0x0000, 0x115f,
+	    0x19f5, 0x395a, 0x2bff, 0x0000, 0x1597, 0x338f, 0x2268, 0x17e5,
+	    0x3da0, 0x20e6, 0x09a7, 0x2be6, 0x0fd3, 0x01e8, 0x4576, 0x24ba,
+	    0x4ac7, 0x3fb0, 0x2199, 0x0000, 0x00d8, 0x0000, 0x337c, 0x06a1,
+	    0x0e06, 0x3284, 0x0000, 0x0000, 0x2a77, 0x3a04, 0x4300, 0x3201,
+	    0x0a9e, 0x3017, 0x49d9, 0x0817, 0x235e, 0x47e0, 0x17ab, 0x0aa6,
+	    0x0000, 0x476c, 0x0000, 0x0000, 0x4418, 0x104f, 0x0348, 0x12d1,
+	    0x0000, 0x30c4, 0x0c52, 0x08b8, 0x356c, 0x1412, 0x0000, 0x3d51,
+	    0x30cc, 0x32ff, 0x4642, 0x1f27, 0x0000, 0x2ac0, 0x0000, 0x315f,
+	    0x0000, 0x0000, 0x1775, 0x3433, 0x478b, 0x0549, 0x3fc4, 0x3bb0,
+	    0x18f0, 0x013e, 0x0265, 0x2745, 0x18cc, 0x44eb, 0x1393, 0x0d8f,
+	    0x4ba8, 0x1b9c, 0x0000, 0x3759, 0x3f29, 0x32df, 0x0000, 0x0068,
+	    0x3262, 0x4bd3, 0x3811, 0x349d, 0x24d6, 0x225d, 0x0000, 0x0000,
+	    0x2564, 0x0000, 0x0000, 0x4522, 0x049e, 0x0000, 0x1126, 0x38ec,
+	    0x118d, 0x22fd, 0x0000, 0x29e1, 0x1c50, 0x0a52, 0x12a3, 0x0000,
+	    0x4641, 0x1a84, 0x45c2, 0x3ef8, 0x0000, 0x19c1, 0x2940, 0x2108,
+	    0x2e16, 0x1875, 0x0395, 0x0d5c, 0x14aa, 0x143b, 0x0000, 0x0bf9,
+	    0x0000, 0x1c03, 0x0018, 0x356c, 0x0350, 0x3877, 0x02f8, 0x3e3f,
+	    0x4616, 0x0c4d, 0x15f7, 0x302d, 0x0f17, 0x2b9f, 0x26b8, 0x21b0,
+	    0x06c6, 0x3ff8, 0x271e, 0x3915, 0x3b6b, 0x00e7, 0x20ec, 0x3611,
+	    0x3151, 0x2b58, 0x4a5b, 0x3c8c, 0x233e, 0x0000, 0x04ec, 0x2ee5,
+	    0x21b4, 0x0000, 0x0000, 0x3661, 0x0000, 0x2c5b, 0x4804, 0x0000,
+	    0x4d71, 0x4380, 0x4421, 0x0000, 0x0730, 0x3b49, 0x41ab, 0x494f,
+	    0x0000, 0x09c9, 0x3e46, 0x0829, 0x3c36, 0x19b3, 0x02e8, 0x0000,
+	    0x064f, 0x0000, 0x4a90, 0x0000, 0x35e0, 0x2bad, 0x2ebe, 0x3e64,
+	    0x2a5e, 0x11cb, 0x0000, 0x4dbf, 0x1483, 0x0000, 0x00d0, 0x397b,
+	    0x42fe, 0x12a5, 0x4980, 0x2870, 0x47ff, 0x2303, 0x0c36, 0x2279,
+	    0x4c99, 0x41d9, 0x2143, 0x0000, 0x37f6, 0x0000, 0x2300, 0x0000,
+	    0x09ac, 0x4c7a, 0x15de, 0x35dd, 0x3af3, 0x38c3, 0x182b, 0x427c,
+	    0x09f7, 0x0000, 0x2a1a, 0x0000, 0x0607, 0x4d46, 0x46a2, 0x4971,
+	    0x01f4, 0x0000, 0x2661, 0x0603, 0x4dea, 0x0da4, 0x1913, 0x4412,
+	    0x39fe, 0x0000, 0x1e72, 0x0cc8, 0x1a8b, 0x413b, 0x29fc, 0x1a59,
+	    0x34c0, 0x15ad, 0x18a0, 0x35e0, 0x3bd4, 0x20f2, 0x2b10, 0x0000,
+	    0x0404, 0x2018, 0x1014, 0x0000, 0x316b, 0x3a6f, 0x3903, 0x0658,
+	    0x26d7, 0x0000, 0x1110, 0x072d, 0x0000, 0x2030, 0x2999, 0x0976,
+	    0x1263, 0x11b3, 0x409a, 0x0000, 0x4691, 0x2019, 0x4915, 0x3de0,
+	    0x0cff, 0x447c, 0x4310, 0x383d, 0x4986, 0x0000, 0x0000, 0x4c04,
+	    0x3216, 0x0000, 0x45bd, 0x3089, 0x28cd, 0x0b29, 0x2fc9, 0x433f,
+	    0x0000, 0x1fb5, 0x188b, 0x148c, 0x0c00, 0x11fd, 0x1c3d, 0x3c1e,
+	    0x26f0, 0x0000, 0x43ed, 0x46a8, 0x1155, 0x0a1c, 0x11e0, 0x4534,
+	    0x0024, 0x1309, 0x1caf, 0x1e08, 0x0000, 0x361d, 0x3e06, 0x1c93,
+	    0x3e8a, 0x4356, 0x41ed, 0x02ea, 0x0000, 0x0787, 0x0000, 0x0963,
+	    0x3501, 0x0439, 0x4c4a, 0x1135, 0x2347, 0x3d7d, 0x0000, 0x1252,
+	    0x0544, 0x1859, 0x336b, 0x2634, 0x11f3, 0x31c0, 0x41db, 0x2ec9,
+	    0x0000, 0x2116, 0x33c9, 0x0f6d, 0x2f04, 0x0000, 0x2f82, 0x0000,
+	    0x4ae6, 0x120b, 0x3b73, 0x1d2e, 0x0000, 0x0999, 0x0c7b, 0x3c8c,
+	    0x4c26, 0x3a56, 0x0000, 0x1b81, 0x0000, 0x0000, 0x0000, 0x17be,
+	    0x30d3, 0x17d5, 0x013b, 0x0000, 0x0000, 0x0000, 0x2733, 0x0000,
+	    0x2b88, 0x3d6d, 0x2d17, 0x16a5, 0x3f8e, 0x0abf, 0x2391, 0x0000,
+	    0x4b3d, 0x4453, 0x3d85, 0x17bd, 0x3580, 0x2219, 0x2170, 0x3c3e,
+	    0x0953, 0x2755, 0x34e9, 0x1091, 0x1f84, 0x344c, 0x0000, 0x406b,
+	    0x2bdf, 0x3cea, 0x4bf4, 0x0688, 0x4029, 0x2925, 0x43c0, 0x12ce,
+	    0x0bc7, 0x3a75, 0x2f94, 0x2091, 0x36fe, 0x1be9, 0x4364, 0x2cf7,
+	    0x06c8, 0x4d6b, 0x0000, 0x05ce, 0x0000, 0x0000, 0x352a, 0x1106,
+	    0x2279, 0x46e6, 0x2813, 0x0000, 0x32c3, 0x13a2, 0x3d1e, 0x3b53,
+	    0x312f, 0x0820, 0x3948, 0x0573, 0x0762, 0x4726, 0x300a, 0x19e4,
+	    0x1601, 0x0000, 0x18b9, 0x2a5b, 0x0386, 0x3ce9, 0x10e7, 0x3232,
+	    0x0000, 0x0e09, 0x1b65, 0x307b, 0x1a04, 0x054e, 0x3b87, 0x2dc1,
+	    0x268c, 0x49c2, 0x2464, 0x0000, 0x3458, 0x3bed, 0x16de, 0x2e3c,
+	    0x0000, 0x1c1c, 0x17c9, 0x2f56, 0x399d, 0x19f5, 0x0000, 0x0d9d,
+	    0x42e9, 0x3fc9, 0x25e8, 0x122a, 0x0000, 0x0f17, 0x39e7, 0x2983,
+	    0x4aad, 0x3df6, 0x06b4, 0x3e25, 0x2868, 0x2036, 0x3c37, 0x1bac,
+	    0x218a, 0x1643, 0x0b39, 0x1f3c, 0x0f32, 0x1765, 0x299c, 0x475d,
+	    0x1b1a, 0x3449, 0x14b9, 0x0d98, 0x0000, 0x1c4e, 0x3dab, 0x0000,
+	    0x0000, 0x27e8, 0x0000, 0x2672, 0x295e, 0x2a94, 0x334b, 0x03d9,
+	    0x2e13, 0x125f, 0x0000, 0x381b, 0x4184, 0x0000, 0x4ad8, 0x1dcf,
+	    0x2222, 0x4d9e, 0x0000, 0x1fde, 0x3060, 0x0000, 0x3858, 0x2089,
+	    0x2307, 0x0000, 0x2d66, 0x0000, 0x2f90, 0x0000, 0x4d19, 0x4b4e,
+	    0x0ceb, 0x478e, 0x2193, 0x0000, 0x4a3d, 0x04b7, 0x0000, 0x405d,
+	    0x3a8a, 0x4874, 0x0a7c, 0x2132, 0x0000, 0x1e65, 0x407c, 0x3524,
+	    0x29c0, 0x03e5, 0x4a9d, 0x3a67, 0x0000, 0x0000, 0x3a95, 0x0000,
+	    0x0f45, 0x0c3e, 0x0000, 0x4933, 0x0000, 0x26d7, 0x1284, 0x3c59,
+	    0x0000, 0x23b3, 0x33c5, 0x4c0c, 0x3f75, 0x40db, 0x18de, 0x1f9a,
+	    0x1052, 0x0603, 0x1e81, 0x0000, 0x4dfb, 0x0685, 0x2a22, 0x0d19,
+	    0x0000, 0x2acc, 0x29f9, 0x2434, 0x0c5c, 0x2981, 0x0000, 0x4121,
+	    0x0273, 0x0a8f, 0x1d12, 0x3672, 0x1fa1, 0x3015, 0x4a28, 0x284f,
+	    0x4ca1, 0x152a, 0x0a46, 0x0370, 0x0000, 0x0000, 0x458c, 0x0000,
+	    0x32d9, 0x3ac6, 0x45c6, 0x46a9, 0x4b98, 0x22e3, 0x4383, 0x3545,
+	    0x3cf8, 0x017a, 0x16d1, 0x0000, 0x30db, 0x355a, 0x33e0, 0x0120,
+	    0x0645, 0x2098, 0x0c31, 0x491a, 0x0000, 0x0a3b, 0x47da, 0x421e,
+	    0x4747, 0x07f6, 0x1927, 0x1ddb, 0x040e, 0x103e, 0x4948, 0x2243,
+	    0x09ad, 0x4775, 0x28a0, 0x44b4, 0x04ec, 0x42ae, 0x0008, 0x0000,
+	    0x0000, 0x2998, 0x2181, 0x0689, 0x3b2a, 0x37a8, 0x0000, 0x41aa,
+	    0x03b0, 0x1320, 0x1dad, 0x0000, 0x2e7a, 0x44c7, 0x267b, 0x0000,
+	    0x0000, 0x47fb, 0x0000, 0x1b6c, 0x0000, 0x0479, 0x2576, 0x0000,
+	    0x099d, 0x0000, 0x0000, 0x0000, 0x0000, 0x09c9, 0x11c9, 0x210f,
+	    0x13fa, 0x099b, 0x32d8, 0x0261, 0x249c, 0x4d0c, 0x2855, 0x1e29,
+	    0x13ec, 0x06d5, 0x0772, 0x2187, 0x0000, 0x3d49, 0x3d95, 0x0000,
+	    0x0a38, 0x227d, 0x08aa, 0x0a5c, 0x0000, 0x35e1, 0x1d0e, 0x0000,
+	    0x20ae, 0x47fc, 0x100c, 0x1c54, 0x0000, 0x0972, 0x1b8f, 0x33e2,
+	    0x3a79, 0x0aa9, 0x288a, 0x0000, 0x4d05, 0x461a, 0x12b0, 0x019b,
+	    0x214e, 0x3224, 0x0000, 0x4d7e, 0x1bbf, 0x06c7, 0x2ce4, 0x1d61,
+	    0x1555, 0x2545, 0x3a62, 0x00e7, 0x3156, 0x09eb, 0x3d94, 0x36c4,
+	    0x3c7a, 0x0000, 0x476a, 0x21c3, 0x339f, 0x14fa, 0x4433, 0x2a24,
+	    0x4354, 0x0846, 0x0c20, 0x360a, 0x0000, 0x49ae, 0x09d2, 0x29c2,
+	    0x478f, 0x2613, 0x3832, 0x39e7, 0x1a6e, 0x0e48, 0x300d, 0x02a2,
+	    0x3f52, 0x2fcb, 0x46a4, 0x0000, 0x4755, 0x0000, 0x303e, 0x24c3,
+	    0x29c1, 0x01aa, 0x1fca, 0x07b4, 0x0b85, 0x04c1, 0x0000, 0x0000,
+	    0x1ac7, 0x38bf, 0x23ee, 0x3a18, 0x093c, 0x2309, 0x0000, 0x1d44,
+	    0x0000, 0x0000, 0x19d5, 0x0000, 0x0a75, 0x3d1a, 0x0000, 0x10bb,
+	    0x3651, 0x4617, 0x2e9b, 0x149b, 0x0000, 0x4465, 0x0000, 0x464a,
+	    0x0000, 0x3215, 0x40a2, 0x02b6, 0x15b2, 0x0000, 0x4d55, 0x4425,
+	    0x13ce, 0x1c55, 0x3fac, 0x2c1b, 0x0000, 0x0000, 0x0c90, 0x096d,
+	    0x305f, 0x1d3c, 0x21e8, 0x0961, 0x24fc, 0x02ab, 0x1c06, 0x0186,
+	    0x2f3f, 0x34c6, 0x0000, 0x3063, 0x3d52, 0x0000, 0x3083, 0x19ea,
+	    0x0000, 0x0000, 0x497e, 0x065d, 0x28c5, 0x2770, 0x02c1, 0x0000,
+	    0x1f64, 0x0000, 0x0000, 0x2b59, 0x48cc, 0x0a6c, 0x0000, 0x2413,
+	    0x0592, 0x0000, 0x4a8c, 0x0000, 0x3c7a, 0x293b, 0x248b, 0x2a8c,
+	    0x0000, 0x2a3a, 0x3b87, 0x0000, 0x2260, 0x4d55, 0x21b5, 0x0000,
+	    0x0000, 0x3f40, 0x2207, 0x138d, 0x0c8b, 0x2ad9, 0x3d34, 0x193e,
+	    0x4dab, 0x2237, 0x02fa, 0x4acc, 0x0000, 0x480a, 0x2a8a, 0x189a,
+	    0x4cab, 0x4b15, 0x02c5, 0x26ef, 0x32c0, 0x4d25, 0x2731, 0x26a2,
+	    0x347d, 0x4c48, 0x4c79, 0x0163, 0x0568, 0x0000, 0x29f0, 0x0000,
+	    0x4dd6, 0x2331, 0x2773, 0x0000, 0x08d3, 0x3c99, 0x3365, 0x43d1,
+	    0x094e, 0x1de8, 0x2402, 0x0000, 0x0000, 0x22cf, 0x1677, 0x3077,
+	    0x4e14, 0x05c4, 0x4824, 0x2291, 0x0000, 0x0000, 0x03b0, 0x0000,
+	    0x1356, 0x13c7, 0x0000, 0x3498, 0x3797, 0x0eaf, 0x3d1f, 0x34df,
+	    0x0000, 0x4115, 0x48d9, 0x0b4d, 0x1982, 0x0000, 0x29e3, 0x0654,
+	    0x1d65, 0x0000, 0x41cf, 0x1935, 0x2dee, 0x1e24, 0x47d0, 0x4de6,
+	    0x0000, 0x0000, 0x025e, 0x4534, 0x2cec, 0x0000, 0x3d73, 0x38c4,
+	    0x2553, 0x299f, 0x0000, 0x161f, 0x1d71, 0x0000, 0x1c55, 0x4755,
+	    0x07be, 0x3da9, 0x341b, 0x0fc3, 0x1560, 0x493e, 0x0000, 0x1293,
+	    0x0102, 0x0b7a, 0x3a44, 0x34b2, 0x4a55, 0x1b2a, 0x2a61, 0x0000,
+	    0x344d, 0x21d9, 0x3106, 0x0876, 0x1263, 0x40d8, 0x206d, 0x34a1,
+	    0x0000, 0x3e4a, 0x4dfd, 0x0000, 0x4815, 0x4d99, 0x30fb, 0x2826,
+	    0x1f76, 0x4154, 0x0000, 0x0daa, 0x2746, 0x03f7, 0x08bc, 0x1cb1,
+	    0x0af0, 0x0000, 0x3bde, 0x42c8, 0x2337, 0x231c, 0x460a, 0x06b2,
+	    0x225a, 0x0f82, 0x0e2f, 0x2807, 0x1358, 0x4093, 0x3142, 0x289a,
+	    0x25d5, 0x3b3b, 0x3abc, 0x24de, 0x311e, 0x34a6, 0x1bde, 0x0000,
+	    0x4bbc, 0x0d23, 0x0000, 0x2138, 0x4992, 0x418b, 0x2d70, 0x0000,
+	    0x4410, 0x1e27, 0x0000, 0x47c9, 0x1c43, 0x0000, 0x2d97, 0x48c0,
+	    0x0dfc, 0x4473, 0x0000, 0x2c42, 0x0000, 0x0000, 0x32c6, 0x2c0f,
+	    0x0ef0, 0x04ce, 0x4bec, 0x2472, 0x27b7, 0x48a5, 0x0000, 0x0000,
+	    0x268e, 0x420c, 0x3349, 0x489c, 0x10e8, 0x34a0, 0x0000, 0x0000,
+	    0x30bd, 0x1b57, 0x49b9, 0x191b, 0x0000, 0x2142, 0x2ff9, 0x189b,
+	    0x259d, 0x0000, 0x0000, 0x0000, 0x13bb, 0x3800, 0x0402, 0x1f30,
+	    0x02a6, 0x3b5f, 0x2c33, 0x0000, 0x4795, 0x19d9, 0x00c4, 0x2122,
+	    0x1b94, 0x07cb, 0x19ab, 0x337a, 0x2aef, 0x0efb, 0x0000, 0x0000,
+	    0x16b6, 0x3f1b, 0x230b, 0x47b6, 0x0000, 0x2d27, 0x4938, 0x0438,
+	    0x31c1, 0x11f7, 0x4d54, 0x2843, 0x3d1f, 0x38f0, 0x4168, 0x2317,
+	    0x176f, 0x32c5, 0x0dd3, 0x25b1, 0x0000, 0x0000, 0x0d03, 0x0000,
+	    0x284a, 0x101d, 0x4854, 0x221e, 0x0000, 0x430c, 0x3f13, 0x024d,
+	    0x0000, 0x0000, 0x0000, 0x156d, 0x4469, 0x0000, 0x4520, 0x3c56,
+	    0x3b1a, 0x31aa, 0x2ae2, 0x2e69, 0x210f, 0x3e56, 0x080e, 0x3d14,
+	    0x13af, 0x0000, 0x25ee, 0x4ac5, 0x2da2, 0x4c07, 0x3dc4, 0x1638,
+	    0x11ae, 0x4118, 0x1de2, 0x2422, 0x0e9f, 0x172e, 0x0000, 0x4669,
+	    0x2b49, 0x164b, 0x3859, 0x332d, 0x0f6d, 0x3113, 0x0000, 0x12d0,
+	    0x2fb4, 0x0615, 0x440f, 0x07bb, 0x2d94, 0x37ce, 0x1fb8, 0x18fa,
+	    0x304d, 0x0d12, 0x39b9, 0x0481, 0x25bd, 0x31da, 0x4173, 0x115a,
+	    0x2f29, 0x03a2, 0x2720, 0x1774, 0x1469, 0x0d22, 0x3a46, 0x3311,
+	    0x0000, 0x381b, 0x2afd, 0x2b91, 0x1ab2, 0x0000, 0x4c0a, 0x0000,
+	    0x0000, 0x377b, 0x21b5, 0x351b, 0x2744, 0x26a0, 0x321b, 0x4cdd,
+	    0x1ad8, 0x029e, 0x030f, 0x47db, 0x4c7a, 0x0f00, 0x23f1, 0x3ae4,
+	    0x0000, 0x21dd, 0x0000, 0x1a6f, 0x2859, 0x0000, 0x1f8e, 0x4d26,
+	    0x0000, 0x195e, 0x2506, 0x4dc5, 0x08bc, 0x28fa, 0x02f8, 0x0000,
+	    0x2035, 0x39e3, 0x07c1, 0x4c42, 0x43d1, 0x3be5, 0x449c, 0x0000,
+	    0x2601, 0x0000, 0x0000, 0x338e, 0x1051, 0x0000, 0x0831, 0x256e,
+	    0x3d5d, 0x36f6, 0x427b, 0x2be9, 0x3303, 0x0d1f, 0x0000, 0x0d36,
+	    0x0000, 0x3e43, 0x0aa4, 0x3e65, 0x0000, 0x08d9, 0x1824, 0x3238,
+	    0x37d8, 0x3df2, 0x1ff6, 0x0000, 0x0a98, 0x4cb1, 0x0000, 0x14cc,
+	    0x0766, 0x1c57, 0x2e36, 0x0000, 0x1f24, 0x0000, 0x13bd, 0x2dbc,
+	    0x2359, 0x0000, 0x3d84, 0x4556, 0x0d62, 0x3507, 0x1d93, 0x1fd3,
+	    0x0000, 0x0973, 0x30ab, 0x1ebb, 0x0000, 0x47cc, 0x0000, 0x049b,
+	    0x23bc, 0x22e4, 0x1088, 0x0000, 0x3346, 0x0123, 0x187b, 0x2871,
+	    0x2521, 0x360b, 0x1690, 0x31c5, 0x0000, 0x277e, 0x39ab, 0x337c,
+	    0x0000, 0x46a1, 0x4ba4, 0x3184, 0x0da9, 0x02cc, 0x26dd, 0x2ced,
+	    0x47e1, 0x4793, 0x0000, 0x01bd, 0x0000, 0x0392, 0x26f4, 0x2466,
+	    0x31c0, 0x0000, 0x2b5e, 0x3b33, 0x34c5, 0x4101, 0x3668, 0x382f,
+	    0x13de, 0x0d44, 0x01f6, 0x0f94, 0x36fe, 0x3b7f, 0x2a0d, 0x0ae7,
+	    0x22d4, 0x11b3, 0x458a, 0x0cd2, 0x4c72, 0x10d4, 0x066c, 0x10ac,
+	    0x091b, 0x2fbe, 0x3d5c, 0x0000, 0x4697, 0x2aa5, 0x0658, 0x0000,
+	    0x1694, 0x3efd, 0x4831, 0x3f2e, 0x0040, 0x25a4, 0x42aa, 0x4107,
+	    0x43d7, 0x4512, 0x4a7a, 0x25ff, 0x08d7, 0x2b20, 0x41e2, 0x1c39,
+	    0x0000, 0x1ecb, 0x19ec, 0x0000, 0x2880, 0x044e, 0x0cfb, 0x00f6,
+	    0x1457, 0x45e1, 0x2691, 0x46b2, 0x1796, 0x41f7, 0x4412, 0x0000,
+	    0x47ac, 0x04ec, 0x4bd1, 0x19d2, 0x0000, 0x24fe, 0x3b69, 0x0000,
+	    0x30ff, 0x0000, 0x3a19, 0x0000, 0x0000, 0x0000, 0x1ffd, 0x3ff8,
+	    0x2f15, 0x2a17, 0x0961, 0x4dfe, 0x3e3d, 0x466b, 0x285a, 0x2f15,
+	    0x15f3, 0x1ece, 0x27af, 0x0120, 0x4273, 0x0000, 0x337b, 0x2990,
+	    0x12bd, 0x490a, 0x0ad3, 0x1aa4, 0x16aa, 0x3488, 0x445b, 0x4658,
+	    0x21a6, 0x382b, 0x0477, 0x3703, 0x49fc, 0x1655, 0x0000, 0x292a,
+	    0x03e1, 0x1740, 0x1679, 0x0655, 0x3f7e, 0x3a70, 0x1e54, 0x0000,
+	    0x27f6, 0x32bb, 0x0290, 0x1b09, 0x166d, 0x2ca6, 0x3013, 0x0633,
+	    0x1b82, 0x4354, 0x381a, 0x3f6c, 0x24a7, 0x2963, 0x4dc7, 0x0ce2,
+	    0x0000, 0x0000, 0x4889, 0x210c, 0x4a3b, 0x0000, 0x2f1f, 0x0000,
+	    0x0519, 0x2d5b, 0x32af, 0x1b2f, 0x4257, 0x3078, 0x4692, 0x3240,
+	    0x1895, 0x28c8, 0x0000, 0x155c, 0x2942, 0x26b6, 0x20f1, 0x363a,
+	    0x2d50, 0x431e, 0x378d, 0x3b72, 0x1779, 0x301a, 0x3eb9, 0x3328,
+	    0x2b29, 0x1a08, 0x3111, 0x3b23, 0x2244, 0x3a29, 0x0000, 0x336d,
+	    0x4293, 0x1458, 0x23db, 0x093e, 0x3be5, 0x0a9a, 0x0000, 0x3fd5,
+	    0x0000, 0x45d8, 0x1e91, 0x4813, 0x0000, 0x0c23, 0x412c, 0x4b25,
+	    0x3e6e, 0x0000, 0x3db8, 0x2b6f, 0x38c9, 0x0b74, 0x0000, 0x2cfa,
+	    0x3584, 0x16e3, 0x2628, 0x2363, 0x1332, 0x0000, 0x2c81, 0x247d,
+	    0x4c89, 0x14ca, 0x4555, 0x1c7b, 0x1b0d, 0x4304, 0x3ea1, 0x1565,
+	    0x292c, 0x2bae, 0x0cbf, 0x3bf0, 0x34a6, 0x0c13, 0x2116, 0x20ba,
+	    0x2e45, 0x07dc, 0x25fb, 0x20f8, 0x03c7, 0x3143, 0x1531, 0x0000,
+	    0x44e1, 0x2735, 0x1b80, 0x0272, 0x0000, 0x0000, 0x254e, 0x00ee,
+	    0x0642, 0x0000, 0x33b2, 0x4226, 0x0000, 0x2925, 0x06bc, 0x3636,
+	    0x0000, 0x0087, 0x2749, 0x20fc, 0x0975, 0x4028, 0x0000, 0x3412,
+	    0x094d, 0x36f8, 0x2dd3, 0x0000, 0x3dba, 0x2e10, 0x0355, 0x4938,
+	    0x018f, 0x1676, 0x0a4d, 0x31b6, 0x40b6, 0x0000, 0x4189, 0x0c9b,
+	    0x2cef, 0x0ac8, 0x3599, 0x43f7, 0x1d9b, 0x0000, 0x39c6, 0x0eb5,
+	    0x3055, 0x40f4, 0x46fb, 0x1c34, 0x32d1, 0x0000, 0x0000, 0x2b93,
+	    0x1c36, 0x0000, 0x0950, 0x3d62, 0x4a18, 0x0000, 0x4c62, 0x2287,
+	    0x288a, 0x22e8, 0x1553, 0x2c91, 0x2955, 0x0000, 0x162f, 0x0000,
+	    0x2a7b, 0x1a0f, 0x468a, 0x3927, 0x13d7, 0x11ca, 0x0000, 0x0000,
+	    0x0000, 0x1117, 0x4274, 0x40fa, 0x2fec, 0x44dc, 0x3666, 0x407a,
+	    0x4354, 0x22ef, 0x0000, 0x1198, 0x32ee, 0x0f27, 0x37fd, 0x2829,
+	    0x0b51, 0x0000, 0x26bb, 0x2847, 0x42c4, 0x4da6, 0x0000, 0x0a7b,
+	    0x4255, 0x000e, 0x335f, 0x4bff, 0x06a1, 0x034f, 0x345f, 0x3034,
+	    0x2607, 0x194b, 0x0e09, 0x262d, 0x378f, 0x44f0, 0x2ea8, 0x25df,
+	    0x4c86, 0x362b, 0x0887, 0x1df0, 0x1f03, 0x4384, 0x0d0d, 0x1cca,
+	    0x2254, 0x1508, 0x4a4b, 0x1e8b, 0x0000, 0x3571, 0x0f2c, 0x0000,
+	    0x32aa, 0x218d, 0x205f, 0x4d3d, 0x0858, 0x0a4c, 0x0000, 0x4818,
+	    0x2076, 0x0e6e, 0x05ff, 0x3b9d, 0x0000, 0x0000, 0x0861, 0x3b12,
+	    0x0000, 0x318b, 0x0000, 0x22e0, 0x1b24, 0x0000, 0x3420, 0x3640,
+	    0x1b70, 0x03c2, 0x2ab7, 0x1464, 0x03d7, 0x4330, 0x387d, 0x4d5b,
+	    0x0454, 0x16cb, 0x0696, 0x0000, 0x3ec2, 0x466e, 0x14c4, 0x1ece,
+	    0x4de3, 0x41bc, 0x02a1, 0x1d16, 0x4463, 0x0000, 0x34b3, 0x15ac,
+	    0x2def, 0x03f8, 0x0570, 0x335a, 0x01fc, 0x120e, 0x31b3, 0x0f13,
+	    0x4781, 0x0000, 0x447f, 0x1b1e, 0x2c27, 0x47a8, 0x24e2, 0x1ba7,
+	    0x143c, 0x0b85, 0x1c3a, 0x461b, 0x0000, 0x0000, 0x485c, 0x0000,
+	    0x2ea1, 0x1892, 0x3276, 0x4930, 0x039a, 0x0a74, 0x2b02, 0x0000,
+	    0x19ff, 0x0000, 0x4c9b, 0x05cc, 0x31ba, 0x0000, 0x002d, 0x0598,
+	    0x0f14, 0x176a, 0x0000, 0x071b, 0x2fcc, 0x3b8a, 0x175d, 0x20be,
+	    0x4950, 0x1c1c, 0x0d5e, 0x3a9a, 0x1025, 0x2a28, 0x2340, 0x46c6,
+	    0x0692, 0x1c3a, 0x0937, 0x0870, 0x2506, 0x21aa, 0x3338, 0x16e8,
+	    0x4d0d, 0x4725, 0x0000, 0x1049, 0x20ee, 0x2b34, 0x0c77, 0x0000,
+	    0x0000, 0x1e5c, 0x3fdd, 0x0000, 0x342b, 0x0bb4, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x210a, 0x3ced, 0x06aa, 0x0f9e, 0x0000,
+	    0x34e1, 0x0000, 0x161f, 0x433c, 0x2de0, 0x1a5b, 0x0000, 0x3127,
+	    0x0189, 0x0000, 0x16f2, 0x29e0, 0x0000, 0x03a8, 0x0000, 0x4ad3,
+	    0x2906, 0x05c5, 0x0000, 0x4b02, 0x3372, 0x3d2b, 0x0579, 0x3296,
+	    0x1bbd, 0x0555, 0x37b5, 0x1d9e, 0x4930, 0x4b88, 0x05fb, 0x0000,
+	    0x3693, 0x22ad, 0x399b, 0x0000, 0x3625, 0x3caa, 0x4a18, 0x0000,
+	    0x2753, 0x1d25, 0x4072, 0x0dc7, 0x0203, 0x14ee, 0x2ce2, 0x4d23,
+	    0x3f15, 0x07d7, 0x0b47, 0x0000, 0x0000, 0x3703, 0x1049, 0x3044,
+	    0x4d9c, 0x0a76, 0x2ac2, 0x0000, 0x0000, 0x0000, 0x3177, 0x0000,
+	    0x0a44, 0x167e, 0x40da, 0x0562, 0x0000, 0x10f6, 0x48c9, 0x4d24,
+	    0x1fb4, 0x09e4, 0x0000, 0x0b25, 0x42c6, 0x0d81, 0x2dd1, 0x291d,
+	    0x2679, 0x1f87, 0x3e4c, 0x4c49, 0x0704, 0x1ec7, 0x30df, 0x43f4,
+	    0x03df, 0x0bae, 0x0891, 0x0000, 0x0000, 0x4310, 0x42ad, 0x41dd,
+	    0x2bda, 0x0aa0, 0x1684, 0x12c0, 0x374b, 0x3693, 0x392a, 0x0465,
+	    0x3877, 0x360d, 0x0000, 0x05dd, 0x177e, 0x0969, 0x147b, 0x2ced,
+	    0x4638, 0x284d, 0x110d, 0x1463, 0x02c6, 0x45ab, 0x3cf0, 0x0500,
+	    0x452c, 0x41e4, 0x2f74, 0x0000, 0x1c94, 0x427b, 0x232a, 0x0000,
+	    0x1978, 0x0000, 0x3e4c, 0x4e02, 0x0859, 0x4973, 0x4247, 0x127f,
+	    0x2024, 0x250a, 0x0000, 0x0000, 0x3dbe, 0x4363, 0x3540, 0x245a,
+	    0x1d21, 0x3c98, 0x3798, 0x1980, 0x47b2, 0x1ec9, 0x0db8, 0x20a3,
+	    0x4797, 0x0000, 0x0000, 0x36be, 0x15fa, 0x043e, 0x2fd7, 0x085f,
+	    0x22ff, 0x0689, 0x1546, 0x3d47, 0x09d3, 0x453b, 0x0000, 0x3213,
+	    0x090e, 0x3d3b, 0x4a28, 0x0000, 0x2123, 0x48bc, 0x18b6, 0x106e,
+	    0x1c76, 0x1f9c, 0x2fd5, 0x0000, 0x20d2, 0x1d01, 0x0000, 0x0000,
+	    0x14da, 0x03fe, 0x2833, 0x167c, 0x432f, 0x34a7, 0x41dc, 0x14d6,
+	    0x3bc5, 0x0f56, 0x186b, 0x4945, 0x327c, 0x0000, 0x3585, 0x2e51,
+	    0x00d0, 0x07a0, 0x0f3c, 0x0000, 0x188e, 0x0000, 0x0e3f, 0x35e6,
+	    0x0000, 0x4d85, 0x48a4, 0x4a33, 0x10ce, 0x0000, 0x0321, 0x201d,
+	    0x0000, 0x3ffc, 0x0dcf, 0x1a87, 0x0000, 0x0863, 0x3cda, 0x4279,
+	    0x3e4e, 0x0cb9, 0x2af8, 0x0d67, 0x0000, 0x28aa, 0x1a30, 0x0000,
+	    0x0f16, 0x0000, 0x19bf, 0x48bf, 0x4614, 0x27c3, 0x3b09, 0x05bb,
+	    0x2729, 0x0000, 0x13ef, 0x420a, 0x30da, 0x0000, 0x333e, 0x4ad1,
+	    0x3392, 0x291e, 0x221a, 0x2aa6, 0x26cb, 0x425e, 0x28da, 0x2c35,
+	    0x165d, 0x0000, 0x23a5, 0x4de1, 0x03d4, 0x0000, 0x39af, 0x280f,
+	    0x38d1, 0x0000, 0x0000, 0x4b37, 0x3048, 0x1070, 0x0000, 0x09dc,
+	    0x1495, 0x281f, 0x4846, 0x090a, 0x0000, 0x10cf, 0x079f, 0x3ebf,
+	    0x401a, 0x1393, 0x0000, 0x4d8c, 0x2710, 0x0000, 0x0000, 0x2ea4,
+	    0x0f2c, 0x4b4d, 0x4a7e, 0x23e4, 0x368f, 0x21dc, 0x2d86, 0x0000,
+	    0x0fd7, 0x2f06, 0x2eef, 0x247e, 0x153a, 0x4aed, 0x44d3, 0x34a0,
+	    0x1170, 0x323c, 0x0000, 0x3474, 0x0dac, 0x2b4d, 0x034a, 0x137f,
+	    0x12c6, 0x2687, 0x0156, 0x3bbf, 0x1ac7, 0x0e00, 0x0000, 0x2d8b,
+	    0x0c23, 0x329c, 0x145b, 0x07b1, 0x42b1, 0x0000, 0x3956, 0x3ffc,
+	    0x3342, 0x0000, 0x1dff, 0x2891, 0x216d, 0x2250, 0x0727, 0x45b8,
+	    0x0da5, 0x270f, 0x0000, 0x333d, 0x480b, 0x1b20, 0x20a6, 0x3654,
+	    0x465f, 0x0000, 0x1872, 0x1669, 0x0813, 0x2b90, 0x1072, 0x0000,
+	    0x0a33, 0x3163, 0x18fa, 0x3c69, 0x2eb6, 0x44ca, 0x0000, 0x0000,
+	    0x0000, 0x05ab, 0x0000, 0x2246, 0x283d, 0x2540, 0x2fdc, 0x4855,
+	    0x1805, 0x27db, 0x0000, 0x0e03, 0x44c3, 0x3197, 0x1a65, 0x0000,
+	    0x4a90, 0x0b23, 0x0000, 0x22e9, 0x0000, 0x13cf, 0x19d8, 0x4316,
+	    0x0000, 0x1943, 0x02a0, 0x0729, 0x0000, 0x32a8, 0x4de0, 0x0000,
+	    0x02fd, 0x29cc, 0x0000, 0x18d0, 0x200d, 0x450e, 0x0000, 0x0ebc,
+	    0x0c40, 0x37a2, 0x4aab, 0x325b, 0x003e, 0x38de, 0x148b, 0x4b14,
+	    0x35fd, 0x0000, 0x021b, 0x0000, 0x3cc4, 0x4c52, 0x3d52, 0x4804,
+	    0x2678, 0x0000, 0x4ad4, 0x4a99, 0x3299, 0x142f, 0x43ba, 0x2385,
+	    0x0000, 0x0000, 0x4547, 0x23f7, 0x4076, 0x0000, 0x0000, 0x4dab,
+	    0x0e5d, 0x0000, 0x294b, 0x0000, 0x2cdd, 0x0000, 0x438b, 0x03db,
+	    0x1583, 0x4015, 0x20f9, 0x4152, 0x3607, 0x0984, 0x2e59, 0x25d1,
+	    0x08fc, 0x453e, 0x4664, 0x1ddf, 0x1b86, 0x0102, 0x34e7, 0x29f5,
+	    0x44da, 0x0000, 0x3a04, 0x4afe, 0x0000, 0x0000, 0x0000, 0x0e28,
+	    0x07cb, 0x38ae, 0x1ced, 0x2514, 0x2ec4, 0x1dd4, 0x2b5a, 0x0000,
+	    0x36ff, 0x3360, 0x0018, 0x0000, 0x4611, 0x0000, 0x49df, 0x0959,
+	    0x4499, 0x11fd, 0x23b9, 0x0000, 0x0d84, 0x0000, 0x0000, 0x3ba1,
+	    0x0ec6, 0x4153, 0x1d3d, 0x29b3, 0x453e, 0x0000, 0x28df, 0x37e4,
+	    0x44df, 0x0000, 0x2e6b, 0x0000, 0x2147, 0x2198, 0x1650, 0x0000,
+	    0x0000, 0x3e68, 0x3078, 0x2b81, 0x1864, 0x38ac, 0x0ce5, 0x069a,
+	    0x2207, 0x0f2b, 0x448f, 0x0000, 0x36cd, 0x3120, 0x242d, 0x0ee7,
+	    0x00c5, 0x3642, 0x0000, 0x4840, 0x3445, 0x1b83, 0x2771, 0x28f6,
+	    0x45c7, 0x419b, 0x0000, 0x0000, 0x3013, 0x2a45, 0x4cdd, 0x190d,
+	    0x47dc, 0x05c0, 0x3509, 0x0e38, 0x08b7, 0x0d16, 0x2998, 0x4ac7,
+	    0x01c8, 0x1e8c, 0x03ee, 0x141c, 0x2980, 0x3b49, 0x3c84, 0x1aa6,
+	    0x3e6b, 0x0000, 0x43ed, 0x1a49, 0x4946, 0x343c, 0x18d0, 0x457e,
+	    0x0477, 0x3b93, 0x481e, 0x3258, 0x452f, 0x2b43, 0x3d28, 0x2af8,
+	    0x016c, 0x08de, 0x416f, 0x3200, 0x3e96, 0x0583, 0x0d2d, 0x4d72,
+	    0x0000, 0x05dc, 0x1c8d, 0x48a2, 0x49e7, 0x1184, 0x4b0c, 0x1711,
+	    0x2fe6, 0x0000, 0x0000, 0x0000, 0x0000, 0x34c5, 0x2102, 0x2ad4,
+	    0x1e05, 0x3d6b, 0x2e97, 0x09f5, 0x3459, 0x27c1, 0x1e8e, 0x2d41,
+	    0x2c47, 0x0281, 0x3959, 0x2b1a, 0x2ef1, 0x1d75, 0x28d7, 0x2533,
+	    0x2e8e, 0x45ed, 0x2eda, 0x212c, 0x0000, 0x0000, 0x0051, 0x0000,
+	    0x0000, 0x0fbb, 0x2c28, 0x0000, 0x01d6, 0x4c0f, 0x314e, 0x086b,
+	    0x0f46, 0x0000, 0x0000, 0x1957, 0x3388, 0x33bf, 0x0000, 0x36d4,
+	    0x13c5, 0x0000, 0x0000, 0x29d2, 0x0000, 0x3e90, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2f15, 0x3373, 0x00f3, 0x0000, 0x0000, 0x38da,
+	    0x0e95, 0x2aac, 0x4147, 0x18b9, 0x0ac0, 0x1419, 0x0163, 0x1584,
+	    0x2674, 0x35d2, 0x44f1, 0x2a1f, 0x0281, 0x378b, 0x438b, 0x0acf,
+	    0x0000, 0x0727, 0x1055, 0x0dd6, 0x208b, 0x1be3, 0x305a, 0x076e,
+	    0x3bb6, 0x4b69, 0x1198, 0x3731, 0x0000, 0x163c, 0x0481, 0x065b,
+	    0x40f0, 0x3034, 0x1138, 0x0000, 0x2165, 0x223d, 0x1e97, 0x0087,
+	    0x44ea, 0x3b62, 0x1aa2, 0x4c84, 0x433c, 0x4c88, 0x0000, 0x2fab,
+	    0x2365, 0x2385, 0x39c9, 0x2977, 0x444e, 0x113b, 0x056d, 0x0327,
+	    0x1556, 0x0fd6, 0x33a8, 0x25f8, 0x0428, 0x05d8, 0x1d43, 0x1c34,
+	    0x0860, 0x3ee5, 0x0932, 0x21c9, 0x1142, 0x09a3, 0x158c, 0x245e,
+	    0x3bbc, 0x2489, 0x0000, 0x0aca, 0x25ec, 0x3fbe, 0x02d2, 0x330f,
+	    0x0000, 0x071e, 0x2407, 0x142b, 0x2b9b, 0x4863, 0x2e15, 0x0341,
+	    0x0000, 0x2caf, 0x2bcc, 0x2df5, 0x0000, 0x0997, 0x0683, 0x0000,
+	    0x2120, 0x1a2b, 0x0a36, 0x1f0b, 0x4960, 0x1ec0, 0x0c45, 0x3df0,
+	    0x2dea, 0x1a48, 0x0513, 0x0000, 0x170b, 0x0000, 0x23a6, 0x437b,
+	    0x3f70, 0x40b2, 0x0cf7, 0x48ff, 0x0575, 0x159b, 0x20c1, 0x0c09,
+	    0x29b9, 0x378b, 0x0000, 0x14ed, 0x429b, 0x3a90, 0x1803, 0x3aa0,
+	    0x2537, 0x1f8a, 0x2597, 0x0000, 0x2fe8, 0x4c46, 0x1a98, 0x3555,
+	    0x0000, 0x399b, 0x23df, 0x32c2, 0x4d9f, 0x0d03, 0x0a2a, 0x1fda,
+	    0x0000, 0x0000, 0x0000, 0x0063, 0x2bb6, 0x3164, 0x2608, 0x16dd,
+	    0x0904, 0x39fb, 0x29a6, 0x125b, 0x35bf, 0x414c, 0x1d0f, 0x07ee,
+	    0x0521, 0x0000, 0x1706, 0x0d9c, 0x0000, 0x19f7, 0x0000, 0x375b,
+	    0x1a35, 0x3000, 0x0a87, 0x0000, 0x3131, 0x0000, 0x059e, 0x0a92,
+	    0x2a85, 0x03ce, 0x0000, 0x3e79, 0x2e01, 0x2215, 0x05eb, 0x4109,
+	    0x0475, 0x08aa, 0x1538, 0x07ae, 0x4004, 0x1faf, 0x0000, 0x3d75,
+	    0x0000, 0x4150, 0x18f7, 0x0c83, 0x4d2c, 0x4a84, 0x156e, 0x2103,
+	    0x0000, 0x0a1c, 0x0181, 0x0a83, 0x4114, 0x0d1e, 0x0000, 0x0000,
+	    0x15d0, 0x0000, 0x4472, 0x3557, 0x1297, 0x2ef3, 0x154d, 0x0000,
+	    0x17bc, 0x1423, 0x0000, 0x4821, 0x0000, 0x3d6b, 0x2c56, 0x1d9c,
+	    0x29fd, 0x0000, 0x3576, 0x1def, 0x0f68, 0x066d, 0x4b9d, 0x4a30,
+	    0x4cf2, 0x0000, 0x289b, 0x04c5, 0x206e, 0x431b, 0x0feb, 0x16c6,
+	    0x01b4, 0x36ad, 0x357a, 0x0000, 0x43b3, 0x2249, 0x0000, 0x120d,
+	    0x16b3, 0x14da, 0x0000, 0x0eb0, 0x0000, 0x28ca, 0x3bfb, 0x19eb,
+	    0x0000, 0x23d7, 0x3838, 0x119f, 0x1e3e, 0x1f74, 0x44aa, 0x1e5e,
+	    0x3778, 0x0411, 0x264e, 0x24ee, 0x0df9, 0x31b5, 0x242c, 0x0000,
+	    0x2686, 0x2618, 0x4ac3, 0x0000, 0x238e, 0x00bc, 0x2740, 0x149c,
+	    0x0000, 0x0929, 0x0000, 0x0670, 0x03ea, 0x4945, 0x3412, 0x221e,
+	    0x1f62, 0x4b45, 0x46b0, 0x2e79, 0x2ff0, 0x2ed0, 0x0036, 0x269e,
+	    0x4aa6, 0x22e8, 0x3458, 0x432d, 0x2f4c, 0x0000, 0x2098, 0x3f3a,
+	    0x0000, 0x0bd5, 0x3192, 0x16c8, 0x0000, 0x2d03, 0x2ef0, 0x0bef,
+	    0x0000, 0x0000, 0x335e, 0x0000, 0x070c, 0x4b08, 0x0000, 0x1d27,
+	    0x3dfc, 0x2330, 0x0882, 0x4b62, 0x3b44, 0x211c, 0x01b0, 0x47c6,
+	    0x0000, 0x0000, 0x0000, 0x20e8, 0x3cba, 0x4684, 0x022f, 0x40d1,
+	    0x46f5, 0x0d2f, 0x31d3, 0x245c, 0x37f3, 0x11d3, 0x0b22, 0x4c85,
+	    0x1a12, 0x4d5e, 0x061a, 0x1ad9, 0x48f5, 0x154b, 0x4dff, 0x351e,
+	    0x07e6, 0x0000, 0x2f46, 0x29dd, 0x020a, 0x31ba, 0x2839, 0x0074,
+	    0x3a13, 0x4380, 0x0000, 0x4239, 0x1da3, 0x3189, 0x2db5, 0x4814,
+	    0x15b0, 0x18bd, 0x38f3, 0x0000, 0x0ea2, 0x0000, 0x0000, 0x47a4,
+	    0x2a42, 0x074e, 0x1bec, 0x2c21, 0x2943, 0x1161, 0x2cef, 0x0000,
+	    0x33d4, 0x343f, 0x2c22, 0x29ca, 0x35a3, 0x0000, 0x0000, 0x08a6,
+	    0x3af4, 0x2407, 0x1e76, 0x30bf, 0x3ec2, 0x08d8, 0x0000, 0x282f,
+	    0x1792, 0x0489, 0x0000, 0x4ad0, 0x270a, 0x1cb4, 0x2abe, 0x0000,
+	    0x09ce, 0x25f9, 0x3058, 0x20c4, 0x3c8e, 0x1795, 0x1f3b, 0x199c,
+	    0x1d87, 0x2329, 0x42f9, 0x2656, 0x0526, 0x09ec, 0x1f7e, 0x45c0,
+	    0x07b0, 0x0c72, 0x2a2d, 0x30b7, 0x4573, 0x17e3, 0x1f7b, 0x0fa7,
+	    0x3cd2, 0x25f3, 0x0000, 0x0258, 0x3173, 0x363b, 0x3b90, 0x0000,
+	    0x0000, 0x3180, 0x0000, 0x0000, 0x0000, 0x3213, 0x396b, 0x025f,
+	    0x4d62, 0x0000, 0x0000, 0x0000, 0x147f, 0x0aca, 0x1ea5, 0x2fa1,
+	    0x4d6c, 0x0000, 0x2805, 0x4355, 0x4092, 0x1d28, 0x0000, 0x262d,
+	    0x23c8, 0x4d03, 0x0000, 0x0000, 0x17f7, 0x4145, 0x0000, 0x2eb7,
+	    0x3899, 0x2882, 0x3dc4, 0x1138, 0x0049, 0x0fe6, 0x445b, 0x2a94,
+	    0x1c70, 0x1689, 0x4ad7, 0x12fa, 0x3fed, 0x256e, 0x118e, 0x1de4,
+	    0x208a, 0x41f6, 0x34ab, 0x407a, 0x4320, 0x0d44, 0x2ac5, 0x4985,
+	    0x0000, 0x0837, 0x1992, 0x0000, 0x3576, 0x0000, 0x0bff, 0x132c,
+	    0x424a, 0x31dc, 0x4053, 0x3581, 0x1ea9, 0x36d1, 0x0000, 0x11ab,
+	    0x1cec, 0x1fca, 0x0000, 0x2913, 0x2ae7, 0x16b0, 0x0c9b, 0x34d5,
+	    0x49ac, 0x2ac7, 0x0000, 0x0acd, 0x1223, 0x3ec6, 0x310c, 0x40dc,
+	    0x43f4, 0x0000, 0x3115, 0x0000, 0x1d32, 0x491b, 0x2fb0, 0x401c,
+	    0x0a1c, 0x4b85, 0x0000, 0x2662, 0x03b1, 0x4307, 0x0000, 0x4027,
+	    0x48d2, 0x039d, 0x07a1, 0x1a33, 0x423a, 0x4730, 0x3f73, 0x2046,
+	    0x298b, 0x3873, 0x2564, 0x167e, 0x02d6, 0x238a, 0x31d1, 0x06e6,
+	    0x0000, 0x2502, 0x017b, 0x21c6, 0x2661, 0x3f20, 0x3a5c, 0x0892,
+	    0x3ea4, 0x0000, 0x0791, 0x0000, 0x412b, 0x4049, 0x0000, 0x0837,
+	    0x0000, 0x1cef, 0x1767, 0x1ae9, 0x17fc, 0x2908, 0x0000, 0x2ced,
+	    0x0305, 0x1d2f, 0x0000, 0x48c7, 0x0000, 0x18f9, 0x1d3a, 0x4344,
+	    0x1cee, 0x0298, 0x0439, 0x00a9, 0x3f5b, 0x2b56, 0x35a2, 0x20a1,
+	    0x2f65, 0x28b5, 0x2ec5, 0x06f8, 0x2a2c, 0x04b1, 0x47d4, 0x024b,
+	    0x2249, 0x0000, 0x2e53, 0x0000, 0x0000, 0x0ced, 0x0000, 0x266e,
+	    0x0000, 0x1998, 0x1095, 0x05ba, 0x0288, 0x14dd, 0x037d, 0x11a5,
+	    0x14a6, 0x1b1c, 0x2acd, 0x1664, 0x2678, 0x0be1, 0x339c, 0x0000,
+	    0x0000, 0x2ea7, 0x2854, 0x2a13, 0x0000, 0x0785, 0x01c4, 0x114a,
+	    0x1f2a, 0x2131, 0x4961, 0x0b6c, 0x0000, 0x0de9, 0x33e8, 0x3848,
+	    0x45fc, 0x0000, 0x40ff, 0x4da1, 0x0518, 0x0000, 0x2724, 0x2705,
+	    0x43cf, 0x010b, 0x12ba, 0x34c6, 0x0000, 0x3365, 0x43d7, 0x0000,
+	    0x0ae8, 0x0083, 0x1530, 0x200c, 0x1cae, 0x1d8c, 0x17ea, 0x178e,
+	    0x3ae3, 0x47ff, 0x01ed, 0x0000, 0x00ec, 0x0000, 0x1f76, 0x1305,
+	    0x0000, 0x1910, 0x321d, 0x2d76, 0x28ae, 0x1dd3, 0x00d0, 0x0000,
+	    0x1e93, 0x0bc8, 0x21cf, 0x38c6, 0x4282, 0x251c, 0x317d, 0x3e91,
+	    0x0000, 0x4472, 0x0000, 0x0cf6, 0x3f5b, 0x0000, 0x0572, 0x1f0d,
+	    0x0f62, 0x2e77, 0x3bf1, 0x0394, 0x1c6d, 0x125c, 0x194f, 0x0000,
+	    0x09a7, 0x1cf7, 0x2c39, 0x323a, 0x0000, 0x147f, 0x23de, 0x4bc4,
+	    0x3beb, 0x01d8, 0x1974, 0x000f, 0x2fff, 0x4b37, 0x457a, 0x3269,
+	    0x00b6, 0x4564, 0x228f, 0x2ad5, 0x13ba, 0x0b2a, 0x464a, 0x3156,
+	    0x1c4f, 0x45e7, 0x0000, 0x0def, 0x0000, 0x2f5a, 0x3084, 0x0000,
+	    0x1854, 0x031d, 0x012e, 0x3806, 0x3a52, 0x11d9, 0x0d3b, 0x374d,
+	    0x0000, 0x1de3, 0x2521, 0x4a51, 0x04a6, 0x33a3, 0x4770, 0x24dd,
+	    0x3ae9, 0x116f, 0x33bd, 0x1320, 0x35d6, 0x0000, 0x0e51, 0x26e9,
+	    0x3549, 0x35fa, 0x3fdb, 0x4b52, 0x2a41, 0x2668, 0x0626, 0x0b3d,
+	    0x0000, 0x071a, 0x17cc, 0x0000, 0x2fc6, 0x3687, 0x0000, 0x37e0,
+	    0x1e43, 0x2500, 0x0000, 0x1ac2, 0x30a4, 0x0610, 0x4abd, 0x3a60,
+	    0x11c6, 0x11a3, 0x0000, 0x0000, 0x0000, 0x44ff, 0x4da6, 0x1d6d,
+	    0x24af, 0x28c8, 0x30df, 0x1839, 0x18d7, 0x0bf4, 0x10b3, 0x2d75,
+	    0x0000, 0x0000, 0x4478, 0x3203, 0x16f6, 0x0000, 0x0000, 0x4aa8,
+	    0x13b1, 0x2c4a, 0x0000, 0x0000, 0x0fbf, 0x271f, 0x132e, 0x0000,
+	    0x0b77, 0x2def, 0x4758, 0x3a3f, 0x0f9e, 0x0000, 0x4baf, 0x2a63,
+	    0x0000, 0x086c, 0x0925, 0x3dc2, 0x2d39, 0x48d7, 0x30d8, 0x0000,
+	    0x28fc, 0x41d5, 0x1bfa, 0x0a14, 0x06c9, 0x4397, 0x0000, 0x470e,
+	    0x0000, 0x1447, 0x236e, 0x2a60, 0x0ed5, 0x168d, 0x0000, 0x2b10,
+	    0x187c, 0x0000, 0x0000, 0x0000, 0x48b6, 0x3377, 0x3e7d, 0x0b7f,
+	    0x2985, 0x2c5f, 0x48c9, 0x1459, 0x3dc0, 0x1d96, 0x22e0, 0x034b,
+	    0x3441, 0x179f, 0x4268, 0x1b23, 0x0c37, 0x471d, 0x449a, 0x268b,
+	    0x0000, 0x49cd, 0x0000, 0x40ea, 0x4270, 0x0000, 0x0000, 0x0000,
+	    0x435e, 0x04ed, 0x1bb2, 0x43ce, 0x2d03, 0x392e, 0x322a, 0x4a1b,
+	    0x0000, 0x3393, 0x4cb7, 0x2a9a, 0x2b46, 0x2ebe, 0x43c8, 0x1b39,
+	    0x0000, 0x2916, 0x12e0, 0x239e, 0x48d9, 0x0339, 0x0000, 0x4a18,
+	    0x0bee, 0x04ad, 0x28ac, 0x0000, 0x0000, 0x4c45, 0x25bf, 0x0a51,
+	    0x0000, 0x0902, 0x461b, 0x24c3, 0x0000, 0x4468, 0x0000, 0x1306,
+	    0x04ae, 0x3a9c, 0x4245, 0x30ce, 0x136d, 0x0000, 0x2bf2, 0x48c7,
+	    0x277d, 0x3cf0, 0x365b, 0x0000, 0x32e4, 0x297f, 0x0677, 0x4749,
+	    0x08d3, 0x0000, 0x02e8, 0x3d2d, 0x14f3, 0x211f, 0x0f45, 0x3c4e,
+	    0x2f1a, 0x4af7, 0x107e, 0x0000, 0x4168, 0x0000, 0x2d0e, 0x086c,
+	    0x41e0, 0x01f3, 0x1f02, 0x01ef, 0x2de3, 0x0494, 0x08fc, 0x32b1,
+	    0x19dd, 0x1127, 0x2b6a, 0x1297, 0x088a, 0x0000, 0x0000, 0x0000,
+	    0x1652, 0x4793, 0x0767, 0x3aa2, 0x0000, 0x41d9, 0x32a4, 0x3f01,
+	    0x0000, 0x0a87, 0x3b8a, 0x1e0a, 0x0000, 0x466f, 0x2ae1, 0x2168,
+	    0x1ae1, 0x43d7, 0x0e5c, 0x0000, 0x176b, 0x0479, 0x3ff2, 0x2f59,
+	    0x0000, 0x06da, 0x4a1c, 0x27c9, 0x4596, 0x0a2c, 0x1ef8, 0x48cb,
+	    0x0000, 0x0929, 0x0000, 0x1de0, 0x20a5, 0x0000, 0x40dc, 0x0000,
+	    0x3c27, 0x0000, 0x1de5, 0x2871, 0x0000, 0x13d4, 0x2105, 0x0000,
+	    0x1be3, 0x0000, 0x0000, 0x0000, 0x2c86, 0x1fd4, 0x3914, 0x0000,
+	    0x1477, 0x323d, 0x3825, 0x1780, 0x2abc, 0x0000, 0x09fc, 0x2964,
+	    0x2c01, 0x4a46, 0x12e4, 0x3f0b, 0x0000, 0x2ae4, 0x2482, 0x043e,
+	    0x0000, 0x0e35, 0x052f, 0x2583, 0x17f7, 0x1d5c, 0x4813, 0x1cef,
+	    0x09d8, 0x393a, 0x46ba, 0x335b, 0x37e8, 0x14f3, 0x2fa5, 0x2a7d,
+	    0x166c, 0x029e, 0x03b8, 0x3d2b, 0x4732, 0x1a60, 0x0000, 0x1c15,
+	    0x1c22, 0x4da5, 0x470e, 0x0000, 0x1064, 0x375c, 0x2fd2, 0x1bf6,
+	    0x13cd, 0x37cf, 0x3375, 0x094d, 0x3d80, 0x11b5, 0x4aaf, 0x3960,
+	    0x0000, 0x0049, 0x0908, 0x35be, 0x1720, 0x3e21, 0x2b02, 0x0000,
+	    0x3fec, 0x0000, 0x0000, 0x147b, 0x2635, 0x3fc2, 0x23c9, 0x0000,
+	    0x497a, 0x36ca, 0x4cd2, 0x0e65, 0x1d08, 0x49a3, 0x2ff4, 0x23a9,
+	    0x0000, 0x27fe, 0x43d2, 0x1cbc, 0x3377, 0x47ab, 0x0000, 0x098d,
+	    0x01c5, 0x3746, 0x3748, 0x4cc5, 0x0ca3, 0x258d, 0x0a44, 0x0000,
+	    0x25c8, 0x0450, 0x0f85, 0x3711, 0x06f3, 0x24fe, 0x15b9, 0x3ca5,
+	    0x4076, 0x45c1, 0x2125, 0x1c28, 0x455f, 0x4195, 0x0000, 0x34fe,
+	    0x0000, 0x0b7d, 0x2e4c, 0x0000, 0x0000, 0x4c2d, 0x38a8, 0x1745,
+	    0x1e6d, 0x2ecd, 0x09a3, 0x0000, 0x40eb, 0x3ac1, 0x383c, 0x3201,
+	    0x1697, 0x4285, 0x4a3f, 0x031a, 0x46a4, 0x2857, 0x0000, 0x2346,
+	    0x0dc4, 0x06bb, 0x1df9, 0x258d, 0x1a9c, 0x237a, 0x0000, 0x0000,
+	    0x0000, 0x4939, 0x12ba, 0x01c1, 0x0000, 0x0000, 0x0781, 0x0000,
+	    0x1928, 0x1b44, 0x0f42, 0x3459, 0x3f0a, 0x2db2, 0x2ff9, 0x120b,
+	    0x0e1a, 0x248a, 0x41d2, 0x2c5f, 0x0e09, 0x0d53, 0x2762, 0x2f34,
+	    0x21fa, 0x402b, 0x2a44, 0x49ab, 0x4a81, 0x0c3f, 0x346c, 0x0000,
+	    0x38bc, 0x0126, 0x27bd, 0x3595, 0x4437, 0x4821, 0x142c, 0x0000,
+	    0x0c5d, 0x4660, 0x3cdc, 0x23d0, 0x16dd, 0x2791, 0x314a, 0x1562,
+	    0x258e, 0x0bc8, 0x47c0, 0x3783, 0x1a8a, 0x3d91, 0x0000, 0x152d,
+	    0x1d5d, 0x2f62, 0x1267, 0x0000, 0x0000, 0x4ad9, 0x0000, 0x074c,
+	    0x21ea, 0x3c25, 0x14f5, 0x0e54, 0x1711, 0x0000, 0x0a88, 0x0000,
+	    0x258e, 0x208c, 0x0000, 0x2330, 0x266e, 0x2932, 0x47f9, 0x3da4,
+	    0x0afd, 0x46fe, 0x2a92, 0x1159, 0x3ec7, 0x235a, 0x36f8, 0x02a3,
+	    0x2f7d, 0x0000, 0x0000, 0x26f1, 0x2aad, 0x2f37, 0x4b4f, 0x25b7,
+	    0x0463, 0x189f, 0x0726, 0x3ac1, 0x1e52, 0x3ccb, 0x0000, 0x39f5,
+	    0x4241, 0x0937, 0x37ae, 0x0000, 0x3aa9, 0x119d, 0x233e, 0x0000,
+	    0x0637, 0x42a0, 0x3d9c, 0x201c, 0x1c21, 0x2401, 0x3032, 0x4736,
+	    0x306a, 0x313d, 0x2fb9, 0x1c1d, 0x260f, 0x4577, 0x1ca0, 0x16b8,
+	    0x258a, 0x47d1, 0x3626, 0x08cc, 0x42d5, 0x13e9, 0x403e, 0x24a7,
+	    0x3bdf, 0x0ebd, 0x0000, 0x1e81, 0x204c, 0x1f0f, 0x3ecb, 0x3e69,
+	    0x2744, 0x3939, 0x4095, 0x0000, 0x145c, 0x0000, 0x192b, 0x2c84,
+	    0x0f77, 0x0000, 0x321b, 0x0000, 0x4e14, 0x2987, 0x1d0b, 0x2302,
+	    0x11cc, 0x3ce8, 0x1bb7, 0x49b9, 0x17f6, 0x0014, 0x4099, 0x2611,
+	    0x0000, 0x43d5, 0x3caa, 0x39a7, 0x0000, 0x0000, 0x4a4b, 0x07e8,
+	    0x3edc, 0x0000, 0x04c4, 0x2b7a, 0x0e36, 0x105b, 0x0751, 0x0000,
+	    0x1e52, 0x185a, 0x36e2, 0x4cba, 0x4bff, 0x0ff8, 0x2683, 0x14f1,
+	    0x3459, 0x0000, 0x206c, 0x14ea, 0x4827, 0x4845, 0x2042, 0x1040,
+	    0x0305, 0x21c7, 0x4aab, 0x0000, 0x2413, 0x4811, 0x04ad, 0x0000,
+	    0x2a1a, 0x0317, 0x069f, 0x0e12, 0x17df, 0x10c0, 0x2bd7, 0x2c6b,
+	    0x2619, 0x10df, 0x3003, 0x3d89, 0x1a7a, 0x39d3, 0x3d8a, 0x3321,
+	    0x195a, 0x0658, 0x2a41, 0x3451, 0x4b0f, 0x0eed, 0x0000, 0x0069,
+	    0x0000, 0x05b0, 0x0000, 0x21dc, 0x3c0b, 0x4da5, 0x1fbb, 0x0000,
+	    0x2fed, 0x1233, 0x0fb1, 0x1b5b, 0x3ea3, 0x49e2, 0x2dba, 0x403e,
+	    0x1733, 0x23e5, 0x42ca, 0x32b2, 0x2ff1, 0x3249, 0x0000, 0x3238,
+	    0x09c9, 0x2482, 0x0000, 0x0030, 0x112a, 0x4545, 0x0000, 0x173a,
+	    0x4c77, 0x2b75, 0x385e, 0x4a50, 0x1c4b, 0x3b97, 0x0000, 0x2698,
+	    0x11ba, 0x1779, 0x45b4, 0x3feb, 0x3278, 0x11e8, 0x2e62, 0x0000,
+	    0x0cad, 0x40fa, 0x224e, 0x0000, 0x2010, 0x2fc5, 0x0113, 0x0a45,
+	    0x1274, 0x07d3, 0x0000, 0x20c5, 0x2245, 0x0000, 0x4bbb, 0x4796,
+	    0x226f, 0x1714, 0x34ab, 0x2bd2, 0x26f6, 0x3048, 0x0e19, 0x0f7f,
+	    0x1fa6, 0x224f, 0x0fbe, 0x0000, 0x3a55, 0x42d7, 0x3f07, 0x3601,
+	    0x2a33, 0x14b4, 0x0000, 0x3e75, 0x0000, 0x2d73, 0x02e6, 0x2562,
+	    0x034a, 0x2f00, 0x032f, 0x4a9e, 0x0f99, 0x30e6, 0x0000, 0x373a,
+	    0x186c, 0x2ca1, 0x478e, 0x151d, 0x2073, 0x31a9, 0x24d6, 0x46bc,
+	    0x09e4, 0x16bc, 0x0c8b, 0x0000, 0x3022, 0x06a1, 0x135b, 0x1669,
+	    0x255f, 0x1367, 0x1a8c, 0x4d51, 0x0928, 0x03b3, 0x3de1, 0x31e5,
+	    0x0000, 0x4605, 0x359c, 0x323c, 0x133d, 0x408d, 0x4d5f, 0x3e64,
+	    0x25eb, 0x496b, 0x016b, 0x21a2, 0x38a3, 0x0000, 0x1d54, 0x0000,
+	    0x4797, 0x1520, 0x2f3e, 0x4538, 0x01d1, 0x27b8, 0x0802, 0x0ae1,
+	    0x1da9, 0x1230, 0x0000, 0x05d4, 0x0369, 0x0000, 0x0c22, 0x11f4,
+	    0x36eb, 0x0000, 0x15a2, 0x432b, 0x258c, 0x21bd, 0x4802, 0x0000,
+	    0x41fb, 0x263b, 0x4a59, 0x0000, 0x3262, 0x0000, 0x0290, 0x0000,
+	    0x40b9, 0x005a, 0x2bad, 0x3656, 0x4dae, 0x225e, 0x08b8, 0x20f5,
+	    0x4c8a, 0x3225, 0x0000, 0x4341, 0x0000, 0x04c1, 0x4cf2, 0x1802,
+	    0x0a0b, 0x0bca, 0x4c88, 0x0000, 0x31dd, 0x147e, 0x4d05, 0x1f5b,
+	    0x22f1, 0x0000, 0x0000, 0x3af8, 0x3376, 0x1274, 0x352c, 0x3f55,
+	    0x290a, 0x4741, 0x2a0c, 0x19ea, 0x0a33, 0x2797, 0x348b, 0x30fa,
+	    0x0000, 0x1729, 0x0000, 0x1e0d, 0x4ad8, 0x128e, 0x07de, 0x226c,
+	    0x380d, 0x044e, 0x48ae, 0x0433, 0x312a, 0x2fdd, 0x0000, 0x1dd6,
+	    0x1bdc, 0x4d58, 0x1a87, 0x0667, 0x0baf, 0x324f, 0x2680, 0x18f0,
+	    0x3775, 0x1349, 0x1f7c, 0x37d6, 0x40ae, 0x1c34, 0x0000, 0x142f,
+	    0x4e12, 0x0cc0, 0x3910, 0x0f8b, 0x0000, 0x2eea, 0x0faf, 0x0000,
+	    0x2279, 0x3351, 0x0000, 0x3329, 0x146e, 0x008f, 0x2750, 0x0951,
+	    0x42eb, 0x2634, 0x0000, 0x1489, 0x221a, 0x06af, 0x3d96, 0x31eb,
+	    0x0000, 0x46cf, 0x0a1c, 0x4810, 0x3011, 0x3c0a, 0x15ea, 0x0000,
+	    0x1b0a, 0x0000, 0x1fad, 0x013e, 0x08be, 0x07dd, 0x1443, 0x2928,
+	    0x2d2d, 0x2338, 0x39ff, 0x0000, 0x12c1, 0x0000, 0x4873, 0x4168,
+	    0x46f4, 0x1f17, 0x148b, 0x2d1f, 0x12be, 0x0d41, 0x02b1, 0x1173,
+	    0x3353, 0x0209, 0x4b79, 0x2a2e, 0x0847, 0x425b, 0x48a3, 0x2a44,
+	    0x35b2, 0x09bc, 0x0000, 0x24e0, 0x0000, 0x180e, 0x2837, 0x3879,
+	    0x2616, 0x0000, 0x0000, 0x02c1, 0x21ff, 0x1ef3, 0x0000, 0x01ab,
+	    0x3f72, 0x1ca7, 0x4a8f, 0x0000, 0x05af, 0x28b5, 0x2776, 0x173a,
+	    0x3da4, 0x16bd, 0x2c6c, 0x0dad, 0x43b9, 0x4936, 0x1bc9, 0x212a,
+	    0x441b, 0x3c31, 0x3cf7, 0x0000, 0x3ec3, 0x0000, 0x3fe4, 0x2f98,
+	    0x13e4, 0x1e5d, 0x0715, 0x2a2a, 0x2fe3, 0x0771, 0x22d0, 0x20ed,
+	    0x2ade, 0x198f, 0x207e, 0x427c, 0x1947, 0x3b33, 0x0000, 0x23e6,
+	    0x0000, 0x4a9b, 0x0000, 0x38b5, 0x2a70, 0x34f0, 0x0000, 0x0000,
+	    0x4493, 0x000f, 0x0656, 0x0000, 0x0000, 0x0558, 0x1370, 0x0000,
+	    0x2140, 0x0000, 0x0000, 0x1895, 0x26a3, 0x1854, 0x1c62, 0x06e1,
+	    0x0000, 0x0000, 0x0000, 0x13a4, 0x025b, 0x00f7, 0x0e9b, 0x38e3,
+	    0x47cf, 0x0000, 0x1a54, 0x1080, 0x14f7, 0x0ae8, 0x4b01, 0x29f1,
+	    0x2541, 0x28fa, 0x4209, 0x4b74, 0x2ba8, 0x0000, 0x225c, 0x0664,
+	    0x422e, 0x371a, 0x4067, 0x15dc, 0x0000, 0x45db, 0x366c, 0x0000,
+	    0x343e, 0x2795, 0x2385, 0x3213, 0x4855, 0x2187, 0x33b9, 0x1a8f,
+	    0x0f21, 0x157e, 0x0954, 0x487e, 0x28e9, 0x0774, 0x3d29, 0x0000,
+	    0x3f21, 0x0000, 0x0000, 0x223b, 0x08be, 0x1130, 0x0617, 0x0a1f,
+	    0x4b6c, 0x0000, 0x0000, 0x0000, 0x3dff, 0x0000, 0x3cfb, 0x244a,
+	    0x0734, 0x377f, 0x3abf, 0x3d6f, 0x0ead, 0x0000, 0x4672, 0x4d89,
+	    0x2c27, 0x16b1, 0x4bf5, 0x2c7a, 0x3ad4, 0x0000, 0x0000, 0x0000,
+	    0x4433, 0x0418, 0x36aa, 0x0000, 0x0000, 0x46c9, 0x07ec, 0x07e0,
+	    0x3f57, 0x4caa, 0x0000, 0x1e3a, 0x0000, 0x2cef, 0x2794, 0x3d52,
+	    0x0000, 0x2317, 0x43e0, 0x1c60, 0x4d58, 0x1ead, 0x2424, 0x48b2,
+	    0x1b04, 0x11e4, 0x301f, 0x0067, 0x2e92, 0x02c0, 0x0361, 0x1c6d,
+	    0x0208, 0x4c19, 0x4736, 0x2933, 0x2d26, 0x45ca, 0x2338, 0x08f6,
+	    0x1d76, 0x340f, 0x2a30, 0x21cf, 0x0000, 0x2804, 0x349d, 0x05f2,
+	    0x2ce5, 0x1933, 0x1941, 0x1622, 0x020c, 0x12b0, 0x0000, 0x063a,
+	    0x1543, 0x1aa5, 0x0e86, 0x0000, 0x2115, 0x481e, 0x35e7, 0x4895,
+	    0x41cc, 0x0a9a, 0x1142, 0x3201, 0x1e55, 0x008a, 0x1b4a, 0x03f9,
+	    0x0311, 0x0000, 0x3d55, 0x121b, 0x0be5, 0x1560, 0x09e2, 0x3bf9,
+	    0x0000, 0x45a4, 0x22ca, 0x0507, 0x06c6, 0x4410, 0x45c5, 0x0000,
+	    0x36a5, 0x316a, 0x0000, 0x1c5f, 0x2553, 0x0000, 0x0000, 0x4d0f,
+	    0x0000, 0x40d3, 0x2693, 0x0fb5, 0x0000, 0x2b90, 0x44a1, 0x10bb,
+	    0x097d, 0x1c66, 0x298d, 0x3351, 0x0000, 0x1d2e, 0x3d89, 0x2738,
+	    0x29e8, 0x0267, 0x49af, 0x0000, 0x1c32, 0x1a94, 0x0000, 0x2532,
+	    0x3606, 0x0025, 0x3ed6, 0x0000, 0x3907, 0x0000, 0x3d72, 0x0f3b,
+	    0x38cc, 0x1184, 0x0000, 0x4912, 0x09ff, 0x1f85, 0x1bb2, 0x0000,
+	    0x2216, 0x03a7, 0x1de7, 0x300f, 0x17d1, 0x0000, 0x43be, 0x394b,
+	    0x2a0c, 0x055a, 0x001e, 0x02d4, 0x02ed, 0x26ed, 0x4554, 0x1850,
+	    0x41be, 0x0000, 0x1951, 0x0b33, 0x1f20, 0x446c, 0x2860, 0x3d0f,
+	    0x3afd, 0x485b, 0x1b41, 0x25f6, 0x1be2, 0x2c98, 0x3a68, 0x0000,
+	    0x11c5, 0x13ac, 0x1699, 0x0000, 0x0000, 0x1127, 0x1bfd, 0x0000,
+	    0x3aa1, 0x44b7, 0x0000, 0x17ea, 0x0f09, 0x1ca4, 0x3fbb, 0x3efd,
+	    0x10ee, 0x462b, 0x0de2, 0x411b, 0x12e3, 0x0000, 0x31ea, 0x0606,
+	    0x4a1c, 0x42db, 0x31bc, 0x4ab7, 0x4051, 0x4a90, 0x23b6, 0x0512,
+	    0x01d2, 0x29f2, 0x1470, 0x2b2f, 0x3d80, 0x34ee, 0x4d91, 0x2d6d,
+	    0x26f4, 0x4aed, 0x35db, 0x2f64, 0x4667, 0x3af8, 0x0e4a, 0x2057,
+	    0x0e37, 0x075b, 0x0b62, 0x3703, 0x2a48, 0x0f39, 0x3a09, 0x3b70,
+	    0x0000, 0x45e7, 0x2a9a, 0x0000, 0x268b, 0x3dba, 0x33d6, 0x2729,
+	    0x0000, 0x0a6c, 0x03fc, 0x0000, 0x4167, 0x2737, 0x3f4e, 0x3ce5,
+	    0x3be9, 0x366b, 0x4019, 0x0000, 0x2f56, 0x0532, 0x1cbf, 0x0000,
+	    0x1e70, 0x0000, 0x1590, 0x21ce, 0x2602, 0x3951, 0x12b5, 0x4a15,
+	    0x0122, 0x189d, 0x06bc, 0x0000, 0x41ca, 0x1ab1, 0x2d8f, 0x341c,
+	    0x4ca7, 0x2259, 0x35a0, 0x468d, 0x1c62, 0x2cb4, 0x2659, 0x1dc5,
+	    0x0000, 0x0000, 0x0000, 0x36ac, 0x37e4, 0x40d1, 0x4084, 0x1dc1,
+	    0x0000, 0x2191, 0x2ada, 0x0000, 0x3a31, 0x1d50, 0x2591, 0x03dc,
+	    0x1c7d, 0x21d4, 0x3a50, 0x31bb, 0x2253, 0x12c9, 0x0ed1, 0x373a,
+	    0x0000, 0x1cc7, 0x0000, 0x07dd, 0x2cf0, 0x1028, 0x0f9d, 0x2d5b,
+	    0x2c4e, 0x4a20, 0x0703, 0x345a, 0x1839, 0x4ca9, 0x11db, 0x45c6,
+	    0x4d93, 0x186d, 0x2911, 0x1973, 0x1a3a, 0x39fe, 0x4270, 0x0000,
+	    0x3763, 0x25e1, 0x1e98, 0x4589, 0x0000, 0x0000, 0x08b0, 0x4593,
+	    0x0cac, 0x0000, 0x315a, 0x34de, 0x0000, 0x0000, 0x0000, 0x0e99,
+	    0x0000, 0x219f, 0x1b5c, 0x36ac, 0x3350, 0x0000, 0x43aa, 0x143b,
+	    0x25dc, 0x2d73, 0x0655, 0x3870, 0x0000, 0x49ed, 0x37c9, 0x00c0,
+	    0x4108, 0x4bfc, 0x2bdb, 0x1254, 0x2db8, 0x2db5, 0x1ce2, 0x24f9,
+	    0x005e, 0x0000, 0x212f, 0x4d22, 0x2487, 0x35f7, 0x0000, 0x04ce,
+	    0x2751, 0x2641, 0x0716, 0x4328, 0x4940, 0x2da1, 0x0000, 0x17ce,
+	    0x2505, 0x1e9a, 0x3265, 0x1dfd, 0x39ff, 0x4146, 0x0000, 0x035d,
+	    0x29ed, 0x111e, 0x0515, 0x1341, 0x1a04, 0x0000, 0x0000, 0x0000,
+	    0x0a04, 0x0000, 0x489d, 0x2f71, 0x303b, 0x052c, 0x0000, 0x142f,
+	    0x0000, 0x2d15, 0x4829, 0x2e32, 0x16c0, 0x2a4a, 0x45fa, 0x2e59,
+	    0x06e1, 0x1cf9, 0x0000, 0x0000, 0x34a1, 0x1bad, 0x1922, 0x1457,
+	    0x0a9f, 0x3e56, 0x0968, 0x1cee, 0x1cbb, 0x1cae, 0x2f17, 0x1617,
+	    0x0741, 0x34bb, 0x0910, 0x26cc, 0x1995, 0x1611, 0x0e8e, 0x1364,
+	    0x1abd, 0x13ed, 0x2a56, 0x0000, 0x46f0, 0x265a, 0x3789, 0x4888,
+	    0x4a70, 0x34a5, 0x2b29, 0x08d4, 0x066b, 0x29d9, 0x40e9, 0x0f5f,
+	    0x351c, 0x0906, 0x0000, 0x2b50, 0x0000, 0x0000, 0x3866, 0x0000,
+	    0x422f, 0x1967, 0x4423, 0x0000, 0x219f, 0x1992, 0x21b7, 0x0000,
+	    0x0000, 0x4d9b, 0x49a4, 0x0000, 0x4562, 0x3d70, 0x2e6d, 0x40c1,
+	    0x3601, 0x0ddd, 0x14dd, 0x0a10, 0x0000, 0x2ac5, 0x0000, 0x37ff,
+	    0x35b5, 0x0000, 0x2b0b, 0x0470, 0x3c13, 0x0159, 0x27dd, 0x0000,
+	    0x1256, 0x0000, 0x2787, 0x25ec, 0x2515, 0x4daa, 0x0dd1, 0x10f4,
+	    0x0000, 0x233a, 0x486a, 0x39ca, 0x0000, 0x1304, 0x1d38, 0x1229,
+	    0x2633, 0x03dd, 0x35fe, 0x3eab, 0x0000, 0x04a3, 0x0000, 0x0000,
+	    0x4125, 0x4620, 0x285d, 0x31a0, 0x13e6, 0x0000, 0x3130, 0x3350,
+	    0x29d4, 0x0000, 0x0000, 0x2ed7, 0x269f, 0x12e4, 0x0000, 0x4204,
+	    0x0000, 0x0255, 0x4da1, 0x0000, 0x0411, 0x09f3, 0x079f, 0x0b01,
+	    0x0000, 0x3670, 0x2587, 0x0658, 0x3c7a, 0x0000, 0x113b, 0x0fec,
+	    0x3365, 0x4962, 0x459b, 0x4e1e, 0x14a6, 0x0000, 0x41c6, 0x41a0,
+	    0x4522, 0x4266, 0x0000, 0x3eb5, 0x343f, 0x0000, 0x16cc, 0x0000,
+	    0x446c, 0x1db0, 0x06ab, 0x0d57, 0x4274, 0x2996, 0x2e26, 0x213c,
+	    0x1c0b, 0x0000, 0x363d, 0x05b0, 0x33dd, 0x4178, 0x1ba8, 0x0393,
+	    0x4cc9, 0x13f7, 0x2cb8, 0x2be0, 0x40d7, 0x0000, 0x0000, 0x13b5,
+	    0x0000, 0x0000, 0x0000, 0x21bd, 0x1cdb, 0x3311, 0x20c8, 0x0000,
+	    0x414b, 0x1ecf, 0x1064, 0x0b53, 0x0000, 0x329f, 0x0930, 0x2486,
+	    0x229a, 0x0b73, 0x1b12, 0x32b7, 0x02a0, 0x27f0, 0x0000, 0x4a12,
+	    0x0fa2, 0x21cf, 0x46ff, 0x0000, 0x1974, 0x048c, 0x0ec9, 0x4bb3,
+	    0x225b, 0x398f, 0x45ef, 0x189e, 0x16e6, 0x46c4, 0x19bd, 0x2bcd,
+	    0x4cd7, 0x4dd8, 0x3e94, 0x1e0d, 0x0000, 0x4c97, 0x0eb8, 0x1f0b,
+	    0x0657, 0x2138, 0x0000, 0x0000, 0x465f, 0x3a8d, 0x01f6, 0x2868,
+	    0x0000, 0x1a2b, 0x38c2, 0x0000, 0x0000, 0x1efe, 0x0fc7, 0x0000,
+	    0x2977, 0x3690, 0x0591, 0x072b, 0x0103, 0x06be, 0x0000, 0x4bbd,
+	    0x352d, 0x1e92, 0x0000, 0x09a1, 0x1b6c, 0x3984, 0x1273, 0x2a03,
+	    0x4789, 0x3b74, 0x3667, 0x401c, 0x4b01, 0x0000, 0x4d30, 0x0cc4,
+	    0x0000, 0x331c, 0x0000, 0x0000, 0x1312, 0x2cfc, 0x08c6, 0x043d,
+	    0x25a1, 0x3065, 0x0361, 0x258b, 0x1951, 0x127f, 0x0bf0, 0x2b34,
+	    0x3e8a, 0x0491, 0x0d60, 0x1479, 0x2285, 0x353e, 0x3013, 0x2f51,
+	    0x00d5, 0x1b08, 0x3a6d, 0x41f6, 0x2c63, 0x0160, 0x1848, 0x2e07,
+	    0x237e, 0x0cb4, 0x357c, 0x27cb, 0x0000, 0x44d0, 0x335f, 0x115b,
+	    0x19f9, 0x103c, 0x1697, 0x19ca, 0x2d73, 0x1807, 0x3564, 0x3510,
+	    0x36fe, 0x4945, 0x43b5, 0x071c, 0x1560, 0x4bd7, 0x0000, 0x3c5f,
+	    0x3020, 0x0b6f, 0x1876, 0x12e6, 0x0000, 0x2754, 0x19d9, 0x4d65,
+	    0x1d0a, 0x051e, 0x112e, 0x0ae6, 0x4394, 0x0000, 0x0000, 0x4355,
+	    0x206e, 0x2976, 0x2285, 0x0b79, 0x18e3, 0x225b, 0x3f39, 0x3a7d,
+	    0x0000, 0x0000, 0x2209, 0x18a0, 0x392e, 0x064b, 0x3ba0, 0x421c,
+	    0x2c94, 0x0000, 0x02f9, 0x2093, 0x2956, 0x1b08, 0x0000, 0x2bac,
+	    0x0000, 0x2a36, 0x2c9c, 0x081d, 0x22ae, 0x0000, 0x034b, 0x019b,
+	    0x45f6, 0x1899, 0x0000, 0x33bd, 0x1677, 0x3bda, 0x0000, 0x3f10,
+	    0x0b08, 0x113d, 0x1d6c, 0x2a30, 0x0000, 0x4794, 0x3efb, 0x1f9a,
+	    0x4986, 0x2cb3, 0x21cc, 0x2e8b, 0x407f, 0x191f, 0x251d, 0x4651,
+	    0x06fe, 0x1310, 0x059b, 0x46dd, 0x3243, 0x0bf9, 0x3b55, 0x3785,
+	    0x1571, 0x09e0, 0x4be4, 0x499e, 0x0000, 0x003c, 0x0000, 0x4369,
+	    0x019b, 0x080d, 0x3db5, 0x0de0, 0x039d, 0x0000, 0x3117, 0x1ff1,
+	    0x0ac6, 0x0000, 0x1389, 0x1de9, 0x0000, 0x0f31, 0x2645, 0x234a,
+	    0x226b, 0x0000, 0x1084, 0x01e3, 0x112b, 0x3a74, 0x1abd, 0x3851,
+	    0x2d9f, 0x0000, 0x2ffe, 0x15e7, 0x14d6, 0x30b3, 0x1883, 0x0b0c,
+	    0x38eb, 0x1a4c, 0x0e89, 0x258f, 0x0000, 0x3319, 0x3f80, 0x32f5,
+	    0x21c2, 0x01b0, 0x2bd8, 0x2a38, 0x0000, 0x0000, 0x1492, 0x1eed,
+	    0x2aec, 0x0bb6, 0x3ea5, 0x1cba, 0x3d47, 0x22f0, 0x111d, 0x0000,
+	    0x4402, 0x41f9, 0x2179, 0x0000, 0x0924, 0x385f, 0x301d, 0x29dc,
+	    0x3520, 0x0000, 0x0765, 0x0000, 0x0000, 0x39a9, 0x183e, 0x35dc,
+	    0x4489, 0x4d98, 0x4ca1, 0x0000, 0x1e11, 0x07f1, 0x11c3, 0x28ac,
+	    0x32dc, 0x2049, 0x4137, 0x0638, 0x0c01, 0x271b, 0x45b0, 0x4613,
+	    0x0000, 0x26dd, 0x2f22, 0x233b, 0x0000, 0x067e, 0x3f23, 0x38b8,
+	    0x2df9, 0x0000, 0x1eee, 0x178f, 0x44f9, 0x3013, 0x161b, 0x15d5,
+	    0x3234, 0x2e1a, 0x34c9, 0x0000, 0x0289, 0x2c2f, 0x2dce, 0x2697,
+	    0x28a4, 0x293b, 0x3d79, 0x03d2, 0x0000, 0x34a2, 0x2f96, 0x06bc,
+	    0x0000, 0x1d7a, 0x3b67, 0x0000, 0x083d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x39e3, 0x107f, 0x1b85, 0x3f93, 0x3d01, 0x2ae8, 0x1b0a,
+	    0x2bdb, 0x086a, 0x0000, 0x12b0, 0x2269, 0x4215, 0x4b97, 0x091f,
+	    0x4aa3, 0x3066, 0x226f, 0x1ece, 0x16d6, 0x0541, 0x13e4, 0x2c40,
+	    0x066e, 0x4137, 0x270a, 0x0000, 0x0000, 0x3bf8, 0x0d47, 0x2fc5,
+	    0x343e, 0x31f8, 0x0f66, 0x4976, 0x11a8, 0x2950, 0x1b4a, 0x11a4,
+	    0x48df, 0x2112, 0x063f, 0x0000, 0x017a, 0x2d6c, 0x0292, 0x2214,
+	    0x2afd, 0x0000, 0x2714, 0x068d, 0x2bad, 0x3b35, 0x4b0f, 0x0000,
+	    0x3e45, 0x0e47, 0x0000, 0x08ae, 0x2f62, 0x0000, 0x107b, 0x4b77,
+	    0x3c91, 0x0000, 0x4490, 0x05a0, 0x4198, 0x3f76, 0x1ea7, 0x25d2,
+	    0x215a, 0x0000, 0x46a2, 0x4abb, 0x1a5c, 0x43ce, 0x26b5, 0x2a0d,
+	    0x0000, 0x3468, 0x0cdc, 0x3b91, 0x0000, 0x2378, 0x49cb, 0x4c4d,
+	    0x0b87, 0x1f81, 0x0000, 0x3c84, 0x3056, 0x1340, 0x4503, 0x03c4,
+	    0x22d6, 0x1811, 0x42a0, 0x1605, 0x0000, 0x48a5, 0x426d, 0x433e,
+	    0x0c10, 0x1fda, 0x0000, 0x0d28, 0x2856, 0x2711, 0x4b2f, 0x4c0a,
+	    0x0783, 0x08f5, 0x0923, 0x306e, 0x0000, 0x4208, 0x26af, 0x0000,
+	    0x078d, 0x0000, 0x2657, 0x0000, 0x0a14, 0x0000, 0x3031, 0x0000,
+	    0x12af, 0x3a07, 0x0000, 0x3415, 0x0000, 0x1ef3, 0x0581, 0x11b1,
+	    0x44a1, 0x2887, 0x1c5d, 0x257b, 0x3107, 0x0640, 0x3cff, 0x137d,
+	    0x1682, 0x33a7, 0x4896, 0x0000, 0x4d32, 0x2338, 0x0026, 0x1fda,
+	    0x20c2, 0x0000, 0x0a4f, 0x22d8, 0x292d, 0x3389, 0x4b6d, 0x19f4,
+	    0x3f77, 0x0000, 0x2fa1, 0x0000, 0x3ee1, 0x0000, 0x0000, 0x37ca,
+	    0x0e68, 0x0cb0, 0x4cb9, 0x016d, 0x3015, 0x25da, 0x2ec6, 0x392d,
+	    0x208a, 0x3a48, 0x3091, 0x116a, 0x34b2, 0x3783, 0x3f81, 0x148c,
+	    0x0000, 0x3b91, 0x123d, 0x2d0b, 0x2e14, 0x3b95, 0x3ad7, 0x15e5,
+	    0x0432, 0x2a0b, 0x47b1, 0x2112, 0x282c, 0x33f8, 0x170f, 0x0000,
+	    0x19fe, 0x0000, 0x2e8a, 0x40fb, 0x0062, 0x427a, 0x2727, 0x4a15,
+	    0x1a21, 0x0000, 0x0000, 0x4754, 0x4422, 0x0000, 0x3a2e, 0x261c,
+	    0x131c, 0x1656, 0x10db, 0x1b05, 0x10ce, 0x087b, 0x22e1, 0x0000,
+	    0x0000, 0x0000, 0x2386, 0x126f, 0x2e36, 0x1e23, 0x1fa7, 0x3c0a,
+	    0x0b81, 0x0000, 0x0000, 0x4451, 0x0000, 0x3771, 0x0ff0, 0x32de,
+	    0x0000, 0x0085, 0x0000, 0x0000, 0x03d7, 0x26bb, 0x0000, 0x3387,
+	    0x2ced, 0x1fde, 0x272f, 0x32aa, 0x16f9, 0x2c86, 0x2242, 0x21f5,
+	    0x133e, 0x4374, 0x4d26, 0x3ea7, 0x2a9e, 0x4373, 0x11c8, 0x3920,
+	    0x406b, 0x2c0d, 0x405b, 0x2b6f, 0x340d, 0x04bf, 0x1019, 0x0000,
+	    0x2aa3, 0x1252, 0x1200, 0x3b76, 0x4296, 0x0746, 0x46df, 0x2504,
+	    0x0790, 0x2072, 0x0b1e, 0x0000, 0x3ffb, 0x4031, 0x30c1, 0x48b0,
+	    0x1df4, 0x3980, 0x4b8e, 0x0000, 0x156b, 0x24f3, 0x41e4, 0x49ca,
+	    0x3b33, 0x392f, 0x3d6c, 0x413a, 0x382d, 0x2b91, 0x3b14, 0x08f1,
+	    0x40a5, 0x4240, 0x410e, 0x0080, 0x2d88, 0x3fd1, 0x4bb3, 0x15ed,
+	    0x4c26, 0x100c, 0x1757, 0x215a, 0x1f21, 0x2ac4, 0x0bc4, 0x401c,
+	    0x0000, 0x3b44, 0x27c8, 0x0755, 0x2700, 0x47d2, 0x2dd7, 0x1679,
+	    0x4890, 0x23e3, 0x2062, 0x2e0b, 0x0472, 0x0000, 0x2da8, 0x3796,
+	    0x3aa8, 0x0000, 0x0000, 0x03f0, 0x4731, 0x3395, 0x4449, 0x02b4,
+	    0x0000, 0x04d6, 0x00b2, 0x0000, 0x2ea3, 0x0000, 0x0cd4, 0x1beb,
+	    0x4820, 0x424f, 0x3b30, 0x2bc2, 0x0000, 0x1e4a, 0x0957, 0x14bc,
+	    0x1082, 0x46df, 0x19e4, 0x0000, 0x41c8, 0x0e06, 0x0000, 0x046e,
+	    0x1672, 0x0000, 0x430e, 0x1868, 0x2d2c, 0x084e, 0x48ce, 0x35d0,
+	    0x0806, 0x06ae, 0x00cc, 0x16f0, 0x4952, 0x37fe, 0x0f7f, 0x4433,
+	    0x4456, 0x0273, 0x2ebe, 0x3cc7, 0x3da2, 0x0000, 0x161c, 0x14ed,
+	    0x2244, 0x4ab9, 0x3fe2, 0x053f, 0x31e4, 0x05b6, 0x0621, 0x0000,
+	    0x116b, 0x2592, 0x0000, 0x3540, 0x0df3, 0x1159, 0x0fad, 0x4471,
+	    0x3d57, 0x4852, 0x3e89, 0x0000, 0x0000, 0x0ad3, 0x2d76, 0x2c59,
+	    0x1700, 0x3424, 0x37cf, 0x04aa, 0x0593, 0x0000, 0x4b1e, 0x0000,
+	    0x0b3d, 0x3c96, 0x25ad, 0x44e3, 0x06f9, 0x0000, 0x1a8b, 0x10ac,
+	    0x1fc2, 0x3f2b, 0x3a13, 0x1f42, 0x31f5, 0x0000, 0x320f, 0x0000,
+	    0x0000, 0x0000, 0x179f, 0x1c82, 0x25fa, 0x20f8, 0x4492, 0x26bb,
+	    0x47e0, 0x3d0a, 0x4a25, 0x3d63, 0x29cf, 0x3ce5, 0x09bd, 0x1e73,
+	    0x4dd6, 0x0000, 0x4a76, 0x1e57, 0x0000, 0x4798, 0x0c85, 0x4210,
+	    0x267d, 0x17e0, 0x2743, 0x1fcb, 0x0000, 0x2e1f, 0x0000, 0x4958,
+	    0x1d9d, 0x46b2, 0x4c4a, 0x0000, 0x4d81, 0x2e5c, 0x0000, 0x2066,
+	    0x0000, 0x1f5e, 0x4033, 0x1234, 0x1c0c, 0x043a, 0x0000, 0x314e,
+	    0x0ebd, 0x0111, 0x20c2, 0x0b6e, 0x2cea, 0x4d3f, 0x489c, 0x1a93,
+	    0x0000, 0x0eba, 0x0000, 0x0000, 0x3721, 0x45a8, 0x0000, 0x0000,
+	    0x3d06, 0x4aff, 0x4950, 0x162f, 0x33b6, 0x12b1, 0x0000, 0x127f,
+	    0x26d7, 0x1662, 0x2e39, 0x0000, 0x20e3, 0x0000, 0x29de, 0x220c,
+	    0x1e9f, 0x2a62, 0x28bb, 0x0000, 0x0000, 0x0000, 0x1b9a, 0x18d3,
+	    0x1816, 0x4a3a, 0x471d, 0x0617, 0x48f2, 0x2285, 0x0cb8, 0x0000,
+	    0x3beb, 0x0486, 0x1fd8, 0x45b8, 0x4c5e, 0x2299, 0x4602, 0x4860,
+	    0x267a, 0x2f45, 0x0d46, 0x3be1, 0x0d59, 0x02e3, 0x0000, 0x04d2,
+	    0x0000, 0x4225, 0x44dd, 0x4200, 0x08d6, 0x1ada, 0x1048, 0x2763,
+	    0x0000, 0x363d, 0x0000, 0x0552, 0x4d1b, 0x115e, 0x165e, 0x0eed,
+	    0x4545, 0x4624, 0x0000, 0x14b9, 0x423c, 0x0f88, 0x3196, 0x01ac,
+	    0x3499, 0x426d, 0x0b7b, 0x0f39, 0x16bc, 0x0000, 0x2b3c, 0x18a8,
+	    0x15e9, 0x0f7a, 0x0000, 0x487b, 0x0000, 0x0000, 0x134a, 0x4912,
+	    0x4526, 0x2028, 0x0000, 0x0000, 0x217e, 0x3103, 0x0fd5, 0x255f,
+	    0x0000, 0x0345, 0x3a3e, 0x20ba, 0x2c72, 0x088f, 0x2a7c, 0x327f,
+	    0x3be0, 0x0000, 0x0000, 0x3031, 0x0956, 0x3207, 0x1c5b, 0x0000,
+	    0x2c92, 0x4b84, 0x2b88, 0x0fdc, 0x11e8, 0x109a, 0x0706, 0x0000,
+	    0x0000, 0x34be, 0x315e, 0x2181, 0x291d, 0x4c32, 0x464a, 0x2d9c,
+	    0x0950, 0x2e5b, 0x0000, 0x460f, 0x3d25, 0x3eec, 0x4b2e, 0x0ee2,
+	    0x16bd, 0x3df5, 0x2e8d, 0x472e, 0x11d3, 0x4a1f, 0x1f67, 0x139d,
+	    0x4bfc, 0x3a1d, 0x1666, 0x0000, 0x2e76, 0x0000, 0x0f96, 0x1677,
+	    0x0000, 0x1c3a, 0x320b, 0x21fe, 0x113a, 0x1ef0, 0x0000, 0x453c,
+	    0x0000, 0x1901, 0x1b56, 0x14d5, 0x3aa3, 0x0000, 0x2ec3, 0x33ec,
+	    0x241c, 0x3d0f, 0x1bd0, 0x21d4, 0x281d, 0x1623, 0x0000, 0x4698,
+	    0x1fd8, 0x4624, 0x3d64, 0x3665, 0x0000, 0x4ae3, 0x3ad4, 0x0000,
+	    0x10a9, 0x1a47, 0x4065, 0x3d9b, 0x1800, 0x2654, 0x3b99, 0x26c5,
+	    0x006e, 0x2017, 0x33b8, 0x3610, 0x4469, 0x30fa, 0x2192, 0x0000,
+	    0x0440, 0x06f9, 0x4932, 0x2a17, 0x4bb4, 0x037a, 0x0000, 0x18b6,
+	    0x2672, 0x0f51, 0x10e3, 0x2493, 0x3cdf, 0x2df4, 0x2d6f, 0x0000,
+	    0x4da9, 0x0000, 0x468a, 0x0f18, 0x333b, 0x0953, 0x246e, 0x4575,
+	    0x3a65, 0x1d9c, 0x4831, 0x3d7b, 0x225a, 0x0000, 0x1f85, 0x2c5e,
+	    0x48e7, 0x011c, 0x0e66, 0x37e0, 0x0c62, 0x322f, 0x0be1, 0x08ab,
+	    0x380a, 0x1dff, 0x4301, 0x4677, 0x024c, 0x2e3e, 0x4c7d, 0x19aa,
+	    0x4def, 0x3a3a, 0x1551, 0x0000, 0x35c0, 0x3bcb, 0x06ae, 0x0911,
+	    0x0000, 0x3c5a, 0x280b, 0x0000, 0x48e8, 0x0833, 0x196c, 0x3165,
+	    0x4465, 0x4655, 0x2752, 0x361d, 0x253d, 0x236c, 0x493f, 0x361e,
+	    0x24ef, 0x3fe6, 0x43a6, 0x30c5, 0x0313, 0x0000, 0x423c, 0x3167,
+	    0x3737, 0x0000, 0x1fe4, 0x04e5, 0x0000, 0x0a6b, 0x340f, 0x117a,
+	    0x1f55, 0x2181, 0x00aa, 0x0000, 0x4847, 0x2e2e, 0x0487, 0x12df,
+	    0x3519, 0x234c, 0x4bcc, 0x1896, 0x1fde, 0x4837, 0x1fb3, 0x4246,
+	    0x355a, 0x25b8, 0x0000, 0x0000, 0x1ce9, 0x05a1, 0x3a54, 0x1054,
+	    0x222b, 0x0000, 0x19ff, 0x0000, 0x49e2, 0x0000, 0x24ca, 0x05fd,
+	    0x0911, 0x0000, 0x3399, 0x11cd, 0x0000, 0x3d0e, 0x0438, 0x11c0,
+	    0x2880, 0x0000, 0x0000, 0x4db5, 0x115e, 0x0000, 0x23e7, 0x42e2,
+	    0x325c, 0x2797, 0x3a80, 0x02f8, 0x015b, 0x4d9d, 0x2376, 0x34ea,
+	    0x41e6, 0x1223, 0x16c2, 0x0000, 0x1649, 0x2463, 0x0000, 0x1445,
+	    0x0000, 0x1920, 0x1963, 0x0000, 0x0000, 0x0000, 0x0491, 0x2cff,
+	    0x0000, 0x352e, 0x0000, 0x1bbe, 0x0f80, 0x0710, 0x1ef6, 0x0893,
+	    0x0000, 0x4ca8, 0x03b4, 0x0717, 0x2991, 0x0b05, 0x18c2, 0x0bb7,
+	    0x1aa5, 0x1a6e, 0x0000, 0x3214, 0x3a76, 0x3531, 0x4c8a, 0x2486,
+	    0x1c8b, 0x3317, 0x3c83, 0x0d32, 0x4741, 0x3365, 0x21f0, 0x0000,
+	    0x4697, 0x4d58, 0x33c9, 0x36bd, 0x436d, 0x31ad, 0x3c15, 0x26be,
+	    0x48d3, 0x23c6, 0x0000, 0x0000, 0x3365, 0x377a, 0x25a0, 0x0372,
+	    0x0428, 0x17b5, 0x4015, 0x11fa, 0x0000, 0x0076, 0x461c, 0x32e2,
+	    0x2299, 0x0000, 0x0d23, 0x3acf, 0x3de2, 0x3f18, 0x0dd1, 0x2a4b,
+	    0x0d87, 0x3499, 0x44d7, 0x1aa3, 0x370c, 0x2b30, 0x0000, 0x304e,
+	    0x0ce1, 0x2152, 0x0000, 0x08c0, 0x0000, 0x1cd9, 0x0000, 0x0000,
+	    0x0000, 0x3dce, 0x1eb8, 0x4bea, 0x2d42, 0x03d1, 0x1a41, 0x0f8e,
+	    0x1870, 0x111f, 0x1a7d, 0x07ed, 0x18bd, 0x43f9, 0x2bab, 0x412a,
+	    0x29ae, 0x2c48, 0x0000, 0x4b90, 0x0000, 0x0000, 0x4ceb, 0x1378,
+	    0x2dac, 0x0cbb, 0x194f, 0x2721, 0x0000, 0x4647, 0x3ee4, 0x3555,
+	    0x1398, 0x3969, 0x0fa4, 0x2352, 0x4758, 0x0000, 0x1051, 0x4078,
+	    0x47a7, 0x3ab6, 0x2484, 0x32f7, 0x4ae9, 0x0000, 0x0000, 0x4ded,
+	    0x0ec7, 0x2ef2, 0x26e1, 0x333e, 0x45fc, 0x0000, 0x02a0, 0x4381,
+	    0x3133, 0x0715, 0x0000, 0x3788, 0x308a, 0x0000, 0x2135, 0x0000,
+	    0x1440, 0x2525, 0x32c7, 0x20b8, 0x30f7, 0x07cf, 0x2455, 0x1e0b,
+	    0x4584, 0x058b, 0x0000, 0x0000, 0x1cc9, 0x2fb8, 0x36f2, 0x2965,
+	    0x1818, 0x323f, 0x0000, 0x4626, 0x0000, 0x2c24, 0x089d, 0x0bb6,
+	    0x17dc, 0x37ec, 0x4d78, 0x0000, 0x0642, 0x1e0b, 0x2da4, 0x24b9,
+	    0x1024, 0x47f4, 0x0000, 0x0000, 0x296d, 0x1981, 0x2a57, 0x0000,
+	    0x3722, 0x0000, 0x465d, 0x0000, 0x48b6, 0x3907, 0x0486, 0x0000,
+	    0x0749, 0x49c6, 0x0d63, 0x0d75, 0x05bd, 0x29dd, 0x3052, 0x33b9,
+	    0x401d, 0x0495, 0x3da7, 0x3643, 0x2d0f, 0x2940, 0x31e6, 0x3664,
+	    0x0000, 0x0000, 0x14a2, 0x0fed, 0x2d8d, 0x12fd, 0x314f, 0x0e64,
+	    0x0000, 0x0c77, 0x2477, 0x39a6, 0x09a5, 0x4378, 0x2597, 0x40d2,
+	    0x0000, 0x16a9, 0x3966, 0x2c7b, 0x0000, 0x17ae, 0x24c9, 0x2687,
+	    0x0bce, 0x0000, 0x0000, 0x3e17, 0x11c3, 0x4d0b, 0x3f1a, 0x4cd5,
+	    0x0000, 0x4447, 0x0000, 0x1fb5, 0x4082, 0x0000, 0x0ac5, 0x0000,
+	    0x0000, 0x0bbb, 0x1796, 0x3c45, 0x18af, 0x2088, 0x158e, 0x4745,
+	    0x46c5, 0x2bb7, 0x34f1, 0x34ed, 0x0c34, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1a44, 0x32a1, 0x08b4, 0x0000, 0x2ceb, 0x2c89, 0x1d2e,
+	    0x2faa, 0x07bb, 0x2e00, 0x2e13, 0x1bf6, 0x446e, 0x2e73, 0x1189,
+	    0x0000, 0x2bc9, 0x2b7f, 0x0f26, 0x27e4, 0x1593, 0x0000, 0x17d6,
+	    0x0000, 0x2444, 0x1965, 0x1d7c, 0x3b8a, 0x268b, 0x0000, 0x101a,
+	    0x46b7, 0x3914, 0x2569, 0x1418, 0x3559, 0x1784, 0x0f88, 0x0978,
+	    0x0000, 0x1a15, 0x3038, 0x286f, 0x3052, 0x2a54, 0x2400, 0x0000,
+	    0x001d, 0x345a, 0x406f, 0x3641, 0x0003, 0x0017, 0x2877, 0x2c2c,
+	    0x4525, 0x2ed9, 0x064a, 0x097c, 0x1be8, 0x0000, 0x3204, 0x0000,
+	    0x2026, 0x2eba, 0x2284, 0x1f7f, 0x2f2f, 0x1321, 0x0e68, 0x1a53,
+	    0x3b69, 0x187e, 0x0000, 0x1ced, 0x3e1c, 0x1e57, 0x0000, 0x08e4,
+	    0x1c4b, 0x0491, 0x0618, 0x0000, 0x191e, 0x4248, 0x383c, 0x4233,
+	    0x4b76, 0x11eb, 0x42b0, 0x3764, 0x4d8b, 0x386d, 0x0000, 0x0000,
+	    0x46ba, 0x247f, 0x0000, 0x1fed, 0x0000, 0x3d58, 0x35ad, 0x0000,
+	    0x1489, 0x0671, 0x3354, 0x0f6b, 0x4d2c, 0x16ee, 0x459f, 0x0000,
+	    0x1e73, 0x0000, 0x170f, 0x1083, 0x298e, 0x0000, 0x0fca, 0x4a26,
+	    0x3147, 0x18d8, 0x2975, 0x3197, 0x028b, 0x35bb, 0x3fd5, 0x1662,
+	    0x31fd, 0x43a9, 0x3979, 0x327a, 0x0000, 0x14b9, 0x2024, 0x411c,
+	    0x417f, 0x1d31, 0x0000, 0x00d0, 0x20f8, 0x023b, 0x353c, 0x12cc,
+	    0x4126, 0x0000, 0x03ea, 0x0e37, 0x0000, 0x2d11, 0x0000, 0x1e97,
+	    0x4753, 0x28cf, 0x0000, 0x48c6, 0x4bfe, 0x04d5, 0x34a7, 0x49e1,
+	    0x0513, 0x0000, 0x25e2, 0x20fd, 0x0000, 0x02be, 0x0000, 0x12f5,
+	    0x02f1, 0x1bb5, 0x2f06, 0x4a88, 0x31dd, 0x23ca, 0x0000, 0x4c41,
+	    0x2f2a, 0x35ac, 0x0000, 0x0000, 0x0f10, 0x295e, 0x1c1d, 0x0000,
+	    0x1789, 0x1699, 0x0000, 0x0000, 0x119e, 0x06d6, 0x0000, 0x3eee,
+	    0x1413, 0x48c1, 0x0000, 0x0ad7, 0x3d97, 0x2c0f, 0x2941, 0x0000,
+	    0x0589, 0x0000, 0x3714, 0x3f82, 0x0235, 0x4bc9, 0x4d1f, 0x1fd4,
+	    0x25f0, 0x3db9, 0x4dff, 0x452a, 0x0000, 0x14bd, 0x0bcd, 0x1a79,
+	    0x2ac0, 0x0000, 0x308a, 0x0a99, 0x0f82, 0x1980, 0x0000, 0x0000,
+	    0x0000, 0x0f4a, 0x0000, 0x4b06, 0x3d41, 0x233a, 0x44d6, 0x3389,
+	    0x0000, 0x0000, 0x10a5, 0x2655, 0x0000, 0x1f1c, 0x0000, 0x3116,
+	    0x0000, 0x1a22, 0x0000, 0x3efd, 0x1d09, 0x2dbb, 0x43b5, 0x02d4,
+	    0x3514, 0x10e6, 0x01a7, 0x3b1e, 0x36d4, 0x3ccf, 0x2ba2, 0x0000,
+	    0x0e86, 0x372a, 0x21e3, 0x2052, 0x2634, 0x2987, 0x0000, 0x3a11,
+	    0x15af, 0x13ff, 0x0000, 0x4abc, 0x41d6, 0x3db6, 0x0c1b, 0x0000,
+	    0x2da2, 0x2011, 0x09d5, 0x16a9, 0x0aad, 0x21a7, 0x2c4f, 0x0000,
+	    0x2c31, 0x045d, 0x4486, 0x4d0c, 0x1457, 0x4bbf, 0x0000, 0x1ca4,
+	    0x0000, 0x4c48, 0x1772, 0x1326, 0x0000, 0x0177, 0x0000, 0x1773,
+	    0x3108, 0x0135, 0x0913, 0x34da, 0x07ec, 0x45f7, 0x3333, 0x030d,
+	    0x1de1, 0x0000, 0x345c, 0x0c5e, 0x443f, 0x337c, 0x0c52, 0x4d53,
+	    0x1ae6, 0x0109, 0x0000, 0x0000, 0x3d55, 0x151c, 0x2bc2, 0x2e61,
+	    0x3079, 0x056c, 0x0c0f, 0x1a30, 0x0000, 0x2f39, 0x1b42, 0x43d5,
+	    0x0000, 0x3b3a, 0x08eb, 0x1c93, 0x1684, 0x0871, 0x19c4, 0x0000,
+	    0x2bc0, 0x17b6, 0x0000, 0x2cc0, 0x0000, 0x2688, 0x2c06, 0x0000,
+	    0x3f09, 0x3813, 0x4ceb, 0x2712, 0x0e8b, 0x0000, 0x38a3, 0x37fa,
+	    0x3ae3, 0x466c, 0x0000, 0x1376, 0x113e, 0x2731, 0x47b7, 0x4db1,
+	    0x4753, 0x3bef, 0x1f0a, 0x1657, 0x0b5d, 0x2130, 0x417d, 0x042e,
+	    0x30f8, 0x057c, 0x175f, 0x20a4, 0x0343, 0x0b38, 0x1dd4, 0x01fe,
+	    0x39d7, 0x4009, 0x03db, 0x0000, 0x0000, 0x10f9, 0x0000, 0x40e0,
+	    0x0924, 0x0000, 0x2b28, 0x0c6a, 0x47f7, 0x44df, 0x18f8, 0x30e6,
+	    0x3f7f, 0x283b, 0x44da, 0x0fe9, 0x093d, 0x3dd2, 0x2fdb, 0x0f8e,
+	    0x0ce2, 0x4733, 0x0118, 0x0fe7, 0x1897, 0x1484, 0x1abe, 0x2eec,
+	    0x4329, 0x18a0, 0x256f, 0x262a, 0x0000, 0x12bf, 0x3b1d, 0x0000,
+	    0x0000, 0x1230, 0x27e4, 0x2a54, 0x4140, 0x0746, 0x1376, 0x0000,
+	    0x0000, 0x322c, 0x0683, 0x06aa, 0x1533, 0x30a5, 0x48f6, 0x30f8,
+	    0x1d80, 0x0000, 0x252b, 0x3f74, 0x0000, 0x1af2, 0x0c6f, 0x1737,
+	    0x1f0d, 0x4279, 0x0000, 0x35da, 0x0000, 0x0000, 0x1c38, 0x0c0e,
+	    0x0000, 0x4541, 0x0000, 0x2f8a, 0x1510, 0x0a4a, 0x48c5, 0x4102,
+	    0x0000, 0x07cb, 0x1da1, 0x2c5f, 0x402d, 0x2d60, 0x06c5, 0x3f99,
+	    0x0000, 0x19df, 0x1b58, 0x18a6, 0x0000, 0x2f26, 0x4327, 0x42cf,
+	    0x160e, 0x21ce, 0x0000, 0x379b, 0x4140, 0x1e90, 0x0273, 0x33bd,
+	    0x21ec, 0x0788, 0x3fe0, 0x1644, 0x0000, 0x0000, 0x3598, 0x2e46,
+	    0x16f1, 0x0e04, 0x0000, 0x1b18, 0x1bba, 0x2f51, 0x104e, 0x42a3,
+	    0x0000, 0x134f, 0x0000, 0x0c8b, 0x3442, 0x136b, 0x39c9, 0x2af7,
+	    0x1c2e, 0x3ad9, 0x2715, 0x0000, 0x0000, 0x2484, 0x34d4, 0x1de9,
+	    0x4dd8, 0x067a, 0x1e92, 0x0000, 0x4cb8, 0x2433, 0x0000, 0x3b48,
+	    0x0000, 0x1bf9, 0x3e37, 0x2063, 0x3ca2, 0x4e0d, 0x06d3, 0x31ef,
+	    0x0000, 0x47e1, 0x0000, 0x0000, 0x303e, 0x0a7d, 0x1f95, 0x37ed,
+	    0x0000, 0x1d7a, 0x0d6f, 0x36a7, 0x46b0, 0x1101, 0x11c0, 0x0000,
+	    0x172c, 0x24bc, 0x38a3, 0x0140, 0x38b1, 0x39a4, 0x43d1, 0x1f50,
+	    0x49e8, 0x0000, 0x0041, 0x0e1b, 0x1231, 0x1942, 0x0000, 0x0000,
+	    0x3f0c, 0x11e3, 0x2f04, 0x494e, 0x197d, 0x455c, 0x09e5, 0x272e,
+	    0x1c39, 0x1ca6, 0x0000, 0x01fd, 0x3204, 0x251e, 0x175d, 0x0617,
+	    0x0000, 0x4249, 0x231a, 0x0000, 0x0b69, 0x35cd, 0x2879, 0x09e2,
+	    0x174b, 0x04f9, 0x0fb5, 0x3c14, 0x0437, 0x4c31, 0x1f0a, 0x163d,
+	    0x2783, 0x239b, 0x4821, 0x256e, 0x0000, 0x2e91, 0x0000, 0x2ee4,
+	    0x0d0e, 0x2a36, 0x1ed6, 0x0000, 0x0000, 0x009f, 0x0000, 0x1d21,
+	    0x33b6, 0x49bf, 0x29fc, 0x0d81, 0x4be5, 0x332b, 0x04fc, 0x3e9f,
+	    0x2220, 0x1784, 0x441a, 0x0944, 0x0a9c, 0x00fa, 0x0000, 0x4a71,
+	    0x3ea0, 0x0000, 0x13dc, 0x3643, 0x27e6, 0x36bd, 0x485b, 0x0000,
+	    0x3066, 0x0000, 0x11f3, 0x02d4, 0x22bb, 0x43e0, 0x3e88, 0x06dc,
+	    0x35ec, 0x2498, 0x3bc8, 0x0acb, 0x4009, 0x1ce8, 0x0000, 0x3426,
+	    0x0000, 0x40f5, 0x138f, 0x3ce8, 0x3b24, 0x0000, 0x45e5, 0x06a7,
+	    0x2a82, 0x2837, 0x0000, 0x3847, 0x21a5, 0x0b40, 0x2e3b, 0x10ee,
+	    0x0000, 0x19ad, 0x3ed8, 0x3e9c, 0x383f, 0x35cb, 0x036d, 0x0000,
+	    0x1383, 0x26e7, 0x1499, 0x0000, 0x3cd4, 0x0000, 0x175a, 0x27ff,
+	    0x1da3, 0x2cb8, 0x2255, 0x155d, 0x0000, 0x37fd, 0x0000, 0x0000,
+	    0x343f, 0x1381, 0x0000, 0x015a, 0x0000, 0x0000, 0x0804, 0x0000,
+	    0x0000, 0x205c, 0x2485, 0x0000, 0x0000, 0x2694, 0x391f, 0x0864,
+	    0x4a58, 0x093e, 0x00a0, 0x151f, 0x316d, 0x1f1f, 0x39fb, 0x0000,
+	    0x0000, 0x0000, 0x0c81, 0x44b5, 0x3686, 0x3d5a, 0x3f0e, 0x1688,
+	    0x0000, 0x0000, 0x2377, 0x45c4, 0x0000, 0x4d21, 0x3c41, 0x3efa,
+	    0x0aed, 0x2a8e, 0x3880, 0x0cae, 0x168a, 0x206f, 0x4a85, 0x052e,
+	    0x0000, 0x0000, 0x0cbc, 0x37ad, 0x21ab, 0x34cd, 0x0000, 0x0d86,
+	    0x4939, 0x0000, 0x0000, 0x0715, 0x49dd, 0x0000, 0x1f78, 0x1378,
+	    0x46f9, 0x483e, 0x3b1f, 0x31d5, 0x071c, 0x0000, 0x37ff, 0x271a,
+	    0x0000, 0x0000, 0x0000, 0x1475, 0x104c, 0x0000, 0x05b5, 0x409e,
+	    0x3748, 0x0000, 0x0000, 0x0000, 0x3769, 0x0000, 0x2a21, 0x31f6,
+	    0x15ef, 0x074f, 0x254f, 0x0000, 0x0000, 0x0033, 0x46df, 0x3252,
+	    0x0000, 0x0000, 0x4bb0, 0x0000, 0x47b6, 0x1dbe, 0x0000, 0x4d9a,
+	    0x0000, 0x26bc, 0x3dfd, 0x2e4a, 0x2431, 0x04d0, 0x0000, 0x2320,
+	    0x167c, 0x24cf, 0x1dad, 0x1083, 0x1cde, 0x0000, 0x0dc0, 0x0000,
+	    0x0637, 0x0000, 0x4be2, 0x1613, 0x3cab, 0x0000, 0x0000, 0x0000,
+	    0x3670, 0x326c, 0x3acb, 0x44d1, 0x0676, 0x0000, 0x0000, 0x2687,
+	    0x143d, 0x0000, 0x34b7, 0x0000, 0x0000, 0x0000, 0x0e7d, 0x4124,
+	    0x3d5b, 0x3ff0, 0x2104, 0x33c6, 0x47af, 0x2626, 0x0000, 0x0c22,
+	    0x0b01, 0x2da2, 0x0000, 0x3760, 0x4242, 0x0000, 0x2353, 0x3d9e,
+	    0x0000, 0x0000, 0x382c, 0x4915, 0x0000, 0x1a02, 0x4480, 0x3ed9,
+	    0x0000, 0x26db, 0x0000, 0x0000, 0x0d63, 0x2e1e, 0x0000, 0x18b0,
+	    0x3efe, 0x0000, 0x1529, 0x4c3a, 0x0000, 0x4c81, 0x321b, 0x34e3,
+	    0x0000, 0x0000, 0x0dab, 0x1514, 0x3e43, 0x2698, 0x10d3, 0x31da,
+	    0x3e70, 0x1903, 0x293a, 0x37cb, 0x0000, 0x416a, 0x0f7c, 0x0000,
+	    0x0000, 0x0000, 0x1521, 0x0000, 0x01ff, 0x2426, 0x0000, 0x153d,
+	    0x0000, 0x2561, 0x0000, 0x1fa3, 0x3de5, 0x1d2f, 0x0000, 0x3dd7,
+	    0x0000, 0x1777, 0x0000, 0x0000, 0x29f9, 0x0000, 0x084e, 0x19f2,
+	    0x1140, 0x21d1, 0x0000, 0x14c6, 0x1677, 0x1490, 0x1372, 0x0d23,
+	    0x1cf1, 0x43b5, 0x2828, 0x0849, 0x3d01, 0x3064, 0x0000, 0x0f6d,
+	    0x0000, 0x39f1, 0x0f6e, 0x0000, 0x0000, 0x402d, 0x4700, 0x4bc4,
+	    0x02f0, 0x0000, 0x0000, 0x11bd, 0x3c97, 0x2bd7, 0x2a01, 0x0000,
+	    0x0000, 0x3d37, 0x4c51, 0x26ea, 0x038d, 0x0000, 0x08c3, 0x2be6,
+	    0x2e7c, 0x0000, 0x0b57, 0x0e75, 0x05e0, 0x3217, 0x0957, 0x33fa,
+	    0x0000, 0x44c3, 0x4955, 0x0015, 0x4d15, 0x3ca9, 0x0000, 0x0390,
+	    0x292c, 0x0000, 0x0000, 0x2385, 0x37b5, 0x2ddf, 0x0000, 0x1699,
+	    0x0000, 0x4433, 0x0000, 0x4751, 0x37eb, 0x03a3, 0x2118, 0x0000,
+	    0x0000, 0x1a21, 0x0000, 0x0000, 0x0000, 0x3f4f, 0x0118, 0x4ce6,
+	    0x1cb5, 0x0000, 0x3060, 0x3b08, 0x0000, 0x384b, 0x1aa0, 0x4089,
+	    0x40a5, 0x4b75, 0x1e41, 0x489d, 0x0000, 0x3468, 0x0973, 0x0c56,
+	    0x441b, 0x16ed, 0x47f8, 0x0000, 0x0000, 0x3cb7, 0x36df, 0x0000,
+	    0x37f3, 0x48e8, 0x2ea3, 0x0742, 0x0000, 0x0000, 0x06d7, 0x3fc2,
+	    0x03f3, 0x3b08, 0x0000, 0x0fe7, 0x0000, 0x4af2, 0x4c74, 0x207b,
+	    0x02b3, 0x1640, 0x0000, 0x0caa, 0x3f48, 0x0000, 0x0000, 0x3d4d,
+	    0x4299, 0x17bf, 0x48fb, 0x0000, 0x396a, 0x2e4a, 0x0000, 0x4ab9,
+	    0x2b08, 0x0000, 0x47f3, 0x3441, 0x2337, 0x3195, 0x0000, 0x1daf,
+	    0x0000, 0x444f, 0x3fb2, 0x0000, 0x185b, 0x196f, 0x0911, 0x34cd,
+	    0x38f7, 0x3731, 0x4931, 0x1485, 0x38f1, 0x2955, 0x0bc6, 0x0000,
+	    0x0000, 0x0c77, 0x0000, 0x0000, 0x39c0, 0x3d36, 0x0000, 0x0d03,
+	    0x2f4b, 0x0cbc, 0x2e33, 0x48b3, 0x05f7, 0x071e, 0x2aae, 0x0000,
+	    0x240b, 0x27b3, 0x2acc, 0x0beb, 0x0000, 0x09c7, 0x0000, 0x3b3b,
+	    0x2077, 0x0000, 0x435c, 0x0000, 0x0000, 0x3658, 0x0000, 0x4c38,
+	    0x16c5, 0x3dde, 0x0000, 0x13cc, 0x0e08, 0x4d9f, 0x083f, 0x48ff,
+	    0x0000, 0x06b0, 0x1101, 0x133a, 0x0000, 0x0000, 0x4d41, 0x000f,
+	    0x1448, 0x2189, 0x0ec8, 0x050d, 0x0000, 0x3aee, 0x2ada, 0x094a,
+	    0x1894, 0x4b22, 0x0000, 0x451b, 0x31f9, 0x46fd, 0x2aee, 0x4464,
+	    0x0000, 0x0000, 0x43b3, 0x3e01, 0x0000, 0x0000, 0x237c, 0x0000,
+	    0x08bf, 0x2322, 0x2d41, 0x138c, 0x0000, 0x2f3d, 0x00a7, 0x2e60,
+	    0x4291, 0x0000, 0x406a, 0x1efe, 0x430f, 0x0000, 0x4dda, 0x08fa,
+	    0x42f3, 0x0000, 0x2fff, 0x0000, 0x3ff1, 0x21d6, 0x431b, 0x10dc,
+	    0x4487, 0x0b90, 0x2641, 0x0000, 0x0000, 0x0000, 0x2c77, 0x0000,
+	    0x4a7a, 0x206b, 0x2947, 0x338e, 0x251c, 0x0a23, 0x0ca4, 0x0000,
+	    0x0000, 0x02c8, 0x417b, 0x3b2a, 0x1382, 0x1749, 0x189d, 0x3b16,
+	    0x3188, 0x3f88, 0x0efd, 0x2dd0, 0x219e, 0x2b78, 0x1c53, 0x3a18,
+	    0x1022, 0x0000, 0x4cdd, 0x15bc, 0x28a5, 0x2d42, 0x294b, 0x10e1,
+	    0x4cdb, 0x0000, 0x386f, 0x21e6, 0x3e84, 0x1567, 0x2ed7, 0x1249,
+	    0x0000, 0x06e1, 0x0000, 0x3114, 0x2a62, 0x0e8a, 0x0000, 0x3d0e,
+	    0x0000, 0x4b35, 0x0000, 0x36d5, 0x0000, 0x1c22, 0x36a4, 0x40d1,
+	    0x2e53, 0x0cb4, 0x421a, 0x2cac, 0x2415, 0x3a21, 0x0271, 0x0000,
+	    0x3644, 0x1963, 0x0000, 0x0000, 0x1bec, 0x0ce9, 0x0000, 0x0477,
+	    0x1fda, 0x0000, 0x2ce7, 0x0000, 0x1e18, 0x2e48, 0x28fc, 0x4256,
+	    0x2c77, 0x4c40, 0x0000, 0x2a10, 0x2463, 0x0000, 0x4013, 0x4c0b,
+	    0x18fb, 0x21a7, 0x2107, 0x0000, 0x129a, 0x0604, 0x2a90, 0x1fd1,
+	    0x16e2, 0x2aba, 0x3083, 0x1263, 0x3dfc, 0x38cc, 0x46c2, 0x0000,
+	    0x3c6f, 0x0be8, 0x0e2f, 0x005c, 0x3977, 0x092d, 0x0647, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0d81, 0x0000, 0x0000, 0x0000, 0x25a0,
+	    0x3cb5, 0x0000, 0x3442, 0x202c, 0x06de, 0x0000, 0x235d, 0x26d7,
+	    0x0aa4, 0x0000, 0x4547, 0x0b5b, 0x1b84, 0x2e20, 0x3c00, 0x0db2,
+	    0x0000, 0x0000, 0x0edd, 0x2aef, 0x00d7, 0x0940, 0x3cd0, 0x23fd,
+	    0x0000, 0x39d6, 0x3837, 0x0000, 0x003f, 0x0c86, 0x0000, 0x1c8d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1bad, 0x012c, 0x441f,
+	    0x0000, 0x15fe, 0x0800, 0x0000, 0x03e6, 0x0000, 0x3f41, 0x1a45,
+	    0x0000, 0x0455, 0x0000, 0x0000, 0x4ce4, 0x0000, 0x4925, 0x0000,
+	    0x0000, 0x1133, 0x0000, 0x0000, 0x4851, 0x4493, 0x0c3c, 0x300f,
+	    0x035a, 0x4933, 0x1a31, 0x1509, 0x4a48, 0x1af7, 0x0000, 0x0000,
+	    0x088d, 0x121f, 0x0fc7, 0x4662, 0x4415, 0x4015, 0x2270, 0x1916,
+	    0x0000, 0x012e, 0x0000, 0x1f4e, 0x0000, 0x33c7, 0x1e6e, 0x0000,
+	    0x000f, 0x4037, 0x2b91, 0x0000, 0x4950, 0x0000, 0x3659, 0x41d3,
+	    0x0000, 0x1a23, 0x1ee0, 0x0000, 0x1be6, 0x43b4, 0x3d5f, 0x0000,
+	    0x491c, 0x1749, 0x365a, 0x0000, 0x27f9, 0x40b9, 0x3580, 0x0000,
+	    0x1931, 0x4161, 0x0000, 0x24a2, 0x392c, 0x3902, 0x265d, 0x0000,
+	    0x14c3, 0x0000, 0x0000, 0x0000, 0x262e, 0x405e, 0x0bc9, 0x0d4c,
+	    0x2173, 0x4de6, 0x443e, 0x0000, 0x2865, 0x12a8, 0x268d, 0x4892,
+	    0x1dea, 0x3785, 0x1969, 0x0000, 0x0000, 0x3d6d, 0x42fc, 0x288b,
+	    0x37ab, 0x2f85, 0x36c7, 0x2b37, 0x0000, 0x0000, 0x0000, 0x3513,
+	    0x3dfe, 0x268e, 0x44de, 0x0000, 0x09de, 0x2ec1, 0x0000, 0x3973,
+	    0x0cd4, 0x37e5, 0x3ee2, 0x4d5a, 0x183e, 0x3b05, 0x0000, 0x3392,
+	    0x3511, 0x0000, 0x162a, 0x1b54, 0x0000, 0x3208, 0x1529, 0x4261,
+	    0x2638, 0x0000, 0x4391, 0x42ba, 0x4b2b, 0x1da8, 0x0137, 0x0000,
+	    0x3bd2, 0x247f, 0x0000, 0x37d0, 0x0f3d, 0x0079, 0x3463, 0x2d05,
+	    0x4c9e, 0x2a04, 0x1200, 0x0000, 0x0000, 0x1058, 0x4582, 0x0000,
+	    0x200b, 0x0000, 0x2f81, 0x0000, 0x28e4, 0x002f, 0x0000, 0x44cb,
+	    0x11a3, 0x16eb, 0x0ff8, 0x0087, 0x2d82, 0x2599, 0x094a, 0x3a63,
+	    0x4343, 0x02a8, 0x0a86, 0x30d8, 0x321a, 0x2722, 0x353d, 0x0000,
+	    0x0de1, 0x0000, 0x429d, 0x1593, 0x0000, 0x0a6e, 0x0000, 0x1cda,
+	    0x1f5d, 0x0000, 0x00ad, 0x494a, 0x122b, 0x40bb, 0x3606, 0x21d0,
+	    0x162b, 0x159d, 0x1cc2, 0x0995, 0x23cc, 0x189a, 0x0f5a, 0x2fc4,
+	    0x0ff7, 0x21e2, 0x3f8f, 0x1d00, 0x3366, 0x0000, 0x3950, 0x0134,
+	    0x161e, 0x0430, 0x1a97, 0x0000, 0x0000, 0x0000, 0x3f07, 0x4277,
+	    0x4578, 0x2951, 0x3ee6, 0x0000, 0x0f16, 0x0000, 0x0000, 0x11b2,
+	    0x0000, 0x2a0a, 0x0000, 0x1cbd, 0x0000, 0x0000, 0x0ff7, 0x11d0,
+	    0x0fd7, 0x4073, 0x0000, 0x107d, 0x462c, 0x177c, 0x01a8, 0x0000,
+	    0x47e3, 0x0000, 0x3241, 0x1c6c, 0x2b05, 0x1f1c, 0x4af4, 0x315f,
+	    0x0000, 0x4d0e, 0x40cd, 0x0000, 0x0583, 0x3f5a, 0x3e99, 0x0000,
+	    0x036e, 0x03cc, 0x323c, 0x4196, 0x0cf8, 0x37a2, 0x2792, 0x1464,
+	    0x0e7e, 0x1f7c, 0x1531, 0x3951, 0x29ed, 0x27a3, 0x0752, 0x0341,
+	    0x2e35, 0x2baf, 0x336d, 0x452c, 0x1292, 0x34be, 0x14b7, 0x1a48,
+	    0x0000, 0x0ff3, 0x0000, 0x0c32, 0x1f8f, 0x2726, 0x0000, 0x1270,
+	    0x3785, 0x256e, 0x186f, 0x2e4d, 0x0000, 0x0000, 0x0000, 0x3cc9,
+	    0x3cbe, 0x4a5c, 0x0000, 0x0718, 0x3e89, 0x2afd, 0x0000, 0x4491,
+	    0x1c95, 0x4047, 0x4546, 0x0000, 0x0000, 0x3f8b, 0x3bff, 0x0000,
+	    0x3034, 0x132f, 0x154a, 0x1944, 0x26d7, 0x10d0, 0x0000, 0x433e,
+	    0x33f9, 0x09b5, 0x0dc5, 0x1df2, 0x0000, 0x3421, 0x3309, 0x399e,
+	    0x4c14, 0x278b, 0x3096, 0x007c, 0x4ded, 0x30b6, 0x1f9b, 0x2128,
+	    0x2d34, 0x4dcf, 0x0000, 0x0000, 0x26b9, 0x0df3, 0x44f1, 0x2900,
+	    0x3dd3, 0x17bb, 0x4c61, 0x3d20, 0x0c91, 0x4bdc, 0x4d02, 0x0000,
+	    0x1565, 0x2b32, 0x0ca6, 0x2868, 0x073e, 0x2537, 0x3383, 0x0000,
+	    0x3ecc, 0x3cbb, 0x082a, 0x3eaa, 0x3f9f, 0x4c2e, 0x0000, 0x196a,
+	    0x411e, 0x15c4, 0x09eb, 0x4616, 0x0000, 0x0000, 0x17e9, 0x2a52,
+	    0x44b2, 0x11c3, 0x2195, 0x0875, 0x349c, 0x2bfe, 0x0000, 0x0000,
+	    0x2232, 0x239d, 0x42b9, 0x2f38, 0x179c, 0x092d, 0x0000, 0x499c,
+	    0x3955, 0x1c53, 0x19d7, 0x1e4e, 0x1f5e, 0x34f0, 0x4a5b, 0x348f,
+	    0x145b, 0x190e, 0x1de9, 0x37ee, 0x3919, 0x1149, 0x26ca, 0x014a,
+	    0x0000, 0x06b2, 0x02c5, 0x16d3, 0x0b7c, 0x072a, 0x4002, 0x0000,
+	    0x4352, 0x41ff, 0x0000, 0x1443, 0x0000, 0x03ff, 0x336a, 0x0000,
+	    0x2e44, 0x430a, 0x0000, 0x0000, 0x2b7e, 0x2c1e, 0x0000, 0x0ac1,
+	    0x33f5, 0x4dca, 0x33c0, 0x1e78, 0x3b0a, 0x373c, 0x0536, 0x3d30,
+	    0x1e18, 0x1629, 0x0000, 0x4ac0, 0x1b10, 0x339f, 0x2cf3, 0x2411,
+	    0x2dbe, 0x0545, 0x287d, 0x11bd, 0x0000, 0x4cf3, 0x1fa6, 0x0000,
+	    0x0000, 0x2175, 0x1fbd, 0x08ad, 0x4ab6, 0x28d3, 0x0000, 0x2644,
+	    0x1997, 0x0000, 0x0924, 0x1bd3, 0x0f8b, 0x1bff, 0x0414, 0x1335,
+	    0x362c, 0x0da6, 0x4b18, 0x0bb1, 0x4d81, 0x2f9d, 0x4150, 0x2c23,
+	    0x01a2, 0x36df, 0x1ca7, 0x3659, 0x0c0b, 0x3422, 0x4677, 0x096c,
+	    0x38c7, 0x27e0, 0x1b1d, 0x1767, 0x1f4f, 0x0000, 0x0000, 0x4092,
+	    0x3e00, 0x03e2, 0x0587, 0x0000, 0x0000, 0x0ce1, 0x14b4, 0x48cf,
+	    0x0000, 0x466a, 0x0fe9, 0x1f71, 0x2dbb, 0x13e7, 0x3044, 0x4624,
+	    0x0000, 0x0000, 0x0000, 0x0210, 0x3970, 0x0000, 0x0000, 0x0d5a,
+	    0x0000, 0x21c5, 0x1313, 0x0000, 0x146a, 0x44d3, 0x0000, 0x2782,
+	    0x3c1e, 0x1214, 0x1466, 0x4301, 0x49e6, 0x0440, 0x3ee9, 0x2897,
+	    0x0000, 0x48d9, 0x1680, 0x1b09, 0x0000, 0x29ba, 0x246d, 0x2e8f,
+	    0x43fd, 0x0000, 0x0000, 0x08a1, 0x09eb, 0x1a4c, 0x42c7, 0x4ba8,
+	    0x48ee, 0x0000, 0x09ed, 0x0000, 0x0000, 0x2927, 0x07ce, 0x06a6,
+	    0x2b31, 0x461a, 0x24a6, 0x0000, 0x4066, 0x0000, 0x49b6, 0x4255,
+	    0x0000, 0x082e, 0x4625, 0x4b83, 0x0ad9, 0x0000, 0x1f3d, 0x250d,
+	    0x34f4, 0x10c2, 0x074a, 0x351f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2e66, 0x12c9, 0x2c4c, 0x37b0, 0x425a, 0x0000, 0x0000, 0x25e7,
+	    0x2c1a, 0x096f, 0x1318, 0x0b75, 0x41bb, 0x3259, 0x460f, 0x31d6,
+	    0x0464, 0x4810, 0x42bd, 0x4cc8, 0x10fb, 0x0000, 0x0000, 0x0000,
+	    0x0941, 0x3baf, 0x282b, 0x3519, 0x319a, 0x39a0, 0x4bd1, 0x31c1,
+	    0x42c6, 0x3cb4, 0x19d5, 0x2ed6, 0x4c75, 0x0000, 0x0a81, 0x0a01,
+	    0x0000, 0x3dd1, 0x0000, 0x2cde, 0x1926, 0x0000, 0x093d, 0x07b6,
+	    0x059f, 0x3e41, 0x4d92, 0x090b, 0x0000, 0x1ba9, 0x1157, 0x38d9,
+	    0x0f79, 0x2427, 0x0000, 0x1930, 0x41a2, 0x0735, 0x0000, 0x2b42,
+	    0x4575, 0x3d32, 0x1dd8, 0x3555, 0x43a5, 0x0824, 0x2e98, 0x4c1e,
+	    0x01a5, 0x0000, 0x0208, 0x1f18, 0x3076, 0x263c, 0x2f83, 0x0000,
+	    0x17da, 0x2748, 0x223e, 0x30a9, 0x3e23, 0x03d7, 0x2cd5, 0x01d1,
+	    0x297f, 0x00cb, 0x0000, 0x499c, 0x4716, 0x4757, 0x1096, 0x2083,
+	    0x23e1, 0x4108, 0x387c, 0x46fb, 0x43f7, 0x0000, 0x0000, 0x4b96,
+	    0x4dce, 0x2835, 0x185a, 0x0000, 0x058d, 0x1240, 0x27e2, 0x1e5e,
+	    0x3688, 0x0000, 0x327b, 0x0000, 0x23a3, 0x4cf0, 0x0000, 0x3737,
+	    0x481b, 0x28bc, 0x2d74, 0x0a44, 0x405e, 0x3737, 0x4c4c, 0x0000,
+	    0x115c, 0x13bf, 0x0000, 0x191f, 0x2df9, 0x11b4, 0x0000, 0x0000,
+	    0x3462, 0x3ce4, 0x0000, 0x005f, 0x3d06, 0x0000, 0x4ad0, 0x0c63,
+	    0x0000, 0x0000, 0x33e6, 0x0000, 0x10c1, 0x14ba, 0x237f, 0x0000,
+	    0x24c7, 0x26d4, 0x0000, 0x0881, 0x0000, 0x0000, 0x32a2, 0x0000,
+	    0x0000, 0x376e, 0x2e38, 0x0000, 0x49e6, 0x1534, 0x1274, 0x0000,
+	    0x41ab, 0x2a49, 0x1b68, 0x3ee8, 0x3e2b, 0x0fe8, 0x1e0b, 0x2d0b,
+	    0x48af, 0x0000, 0x0000, 0x4c71, 0x0c3a, 0x0f30, 0x0000, 0x4428,
+	    0x040f, 0x4591, 0x0000, 0x0000, 0x45f7, 0x0000, 0x43c3, 0x0f36,
+	    0x1698, 0x34c8, 0x064e, 0x0000, 0x1c1b, 0x0bb4, 0x46c0, 0x4633,
+	    0x0925, 0x0000, 0x03f9, 0x0d4d, 0x0000, 0x2f22, 0x1c24, 0x0000,
+	    0x4300, 0x0000, 0x14b4, 0x16bc, 0x0000, 0x2afe, 0x0d7d, 0x3b8f,
+	    0x0000, 0x1b4b, 0x1b74, 0x151d, 0x0000, 0x0404, 0x0000, 0x2a68,
+	    0x4521, 0x17b3, 0x3705, 0x0b26, 0x289d, 0x3705, 0x060b, 0x0000,
+	    0x4219, 0x01c5, 0x2854, 0x05a9, 0x430d, 0x4884, 0x0000, 0x0508,
+	    0x1400, 0x11bf, 0x0000, 0x13ec, 0x4de6, 0x36f5, 0x2fcd, 0x0000,
+	    0x06c8, 0x2260, 0x0dc7, 0x37b3, 0x0e7f, 0x444d, 0x33af, 0x11c1,
+	    0x0000, 0x2027, 0x24b5, 0x46ce, 0x08e6, 0x0fe5, 0x2c63, 0x0000,
+	    0x4d8e, 0x1dab, 0x0000, 0x0efb, 0x171c, 0x3f06, 0x3b59, 0x4d6f,
+	    0x0cfe, 0x0a40, 0x3f48, 0x0000, 0x0000, 0x0000, 0x0000, 0x48f5,
+	    0x2dfe, 0x1fb4, 0x2cf6, 0x4361, 0x43b3, 0x1f53, 0x00a4, 0x066f,
+	    0x0000, 0x0000, 0x35bf, 0x34f3, 0x478d, 0x2f05, 0x193b, 0x0d4b,
+	    0x3a11, 0x237a, 0x4410, 0x12c2, 0x2247, 0x2943, 0x3afa, 0x0000,
+	    0x3aea, 0x0000, 0x418e, 0x30f6, 0x42f6, 0x0000, 0x3085, 0x24f4,
+	    0x4135, 0x4587, 0x2701, 0x400f, 0x0678, 0x2c2b, 0x026d, 0x46cc,
+	    0x3a23, 0x18d1, 0x0000, 0x0000, 0x4885, 0x3691, 0x0000, 0x0000,
+	    0x0000, 0x30f8, 0x2bfa, 0x0d85, 0x0000, 0x16a7, 0x03ba, 0x2e40,
+	    0x4d90, 0x1c37, 0x2a9e, 0x20c7, 0x0ecb, 0x3301, 0x4d6f, 0x0000,
+	    0x0000, 0x04f4, 0x4317, 0x33de, 0x4729, 0x3e7e, 0x09a1, 0x2626,
+	    0x49ff, 0x0000, 0x14fe, 0x2147, 0x1461, 0x0166, 0x01d0, 0x0a75,
+	    0x0000, 0x13d4, 0x2d17, 0x0000, 0x0a8e, 0x1bee, 0x1aa5, 0x4252,
+	    0x0cbd, 0x32b4, 0x1485, 0x12cd, 0x295a, 0x0000, 0x43d7, 0x1cf5,
+	    0x1f4c, 0x1ddf, 0x4a41, 0x3cb6, 0x174d, 0x3b1d, 0x0000, 0x093c,
+	    0x3a7f, 0x09d2, 0x123e, 0x0000, 0x2035, 0x37a8, 0x179d, 0x1af0,
+	    0x015f, 0x1b49, 0x10a5, 0x0000, 0x0a6c, 0x0000, 0x0000, 0x4058,
+	    0x3072, 0x0000, 0x3d67, 0x052a, 0x1649, 0x4553, 0x3a87, 0x0000,
+	    0x2908, 0x0060, 0x3cb7, 0x3145, 0x22f1, 0x1f8a, 0x4b64, 0x1215,
+	    0x3a22, 0x0000, 0x4c6f, 0x0000, 0x2c38, 0x0000, 0x4c59, 0x4924,
+	    0x0b0f, 0x3c7a, 0x4a2d, 0x0000, 0x322a, 0x17b1, 0x2e17, 0x125a,
+	    0x4c95, 0x14bc, 0x03aa, 0x0000, 0x065a, 0x1098, 0x4709, 0x217f,
+	    0x3da7, 0x0000, 0x2972, 0x3afd, 0x1aaf, 0x0082, 0x11da, 0x26c5,
+	    0x3579, 0x3998, 0x43b3, 0x0854, 0x3f42, 0x019f, 0x29f6, 0x0000,
+	    0x1e7f, 0x1c24, 0x0000, 0x255d, 0x0034, 0x0000, 0x27f2, 0x0000,
+	    0x33d8, 0x4adb, 0x0000, 0x4015, 0x19b4, 0x4055, 0x34ee, 0x343b,
+	    0x1e0d, 0x4099, 0x04d7, 0x3276, 0x0000, 0x32fd, 0x2905, 0x2dae,
+	    0x0000, 0x3aeb, 0x14e9, 0x0000, 0x3d33, 0x131a, 0x2128, 0x0341,
+	    0x31a8, 0x40b9, 0x0000, 0x0000, 0x0597, 0x0000, 0x4834, 0x04a9,
+	    0x1e76, 0x226e, 0x0000, 0x232a, 0x4738, 0x0000, 0x425d, 0x44a2,
+	    0x2b3b, 0x0000, 0x2da5, 0x0000, 0x0000, 0x142f, 0x0fbc, 0x37b4,
+	    0x013f, 0x3b89, 0x0000, 0x0000, 0x142f, 0x1bb4, 0x07a5, 0x1f15,
+	    0x20b9, 0x0000, 0x0000, 0x4361, 0x2bf1, 0x4cc3, 0x353b, 0x4ae9,
+	    0x3ca8, 0x2d56, 0x43f6, 0x4a27, 0x202d, 0x228b, 0x0000, 0x44bb,
+	    0x41c5, 0x2a2f, 0x0000, 0x0000, 0x4121, 0x01e1, 0x4875, 0x316a,
+	    0x1475, 0x0000, 0x00da, 0x12c6, 0x0000, 0x0000, 0x360b, 0x0bbf,
+	    0x0000, 0x0b62, 0x0403, 0x0da1, 0x3a3b, 0x0000, 0x0e98, 0x2ac4,
+	    0x1e12, 0x2590, 0x0000, 0x0000, 0x3937, 0x4886, 0x0990, 0x0000,
+	    0x4c1b, 0x06d2, 0x3d39, 0x3977, 0x2449, 0x2392, 0x4de4, 0x0000,
+	    0x08b0, 0x0000, 0x4955, 0x455d, 0x3d6a, 0x0000, 0x3004, 0x3b09,
+	    0x2245, 0x15c2, 0x3c95, 0x0000, 0x2106, 0x4304, 0x45f7, 0x08e4,
+	    0x0000, 0x1412, 0x3f1b, 0x4de7, 0x0000, 0x4608, 0x2304, 0x39df,
+	    0x02a1, 0x37f5, 0x33a3, 0x0000, 0x1b12, 0x0000, 0x05a2, 0x0000,
+	    0x010b, 0x1850, 0x0043, 0x0901, 0x44de, 0x41f7, 0x16da, 0x2e6c,
+	    0x0a75, 0x0000, 0x0000, 0x34e0, 0x17a8, 0x30ea, 0x20b1, 0x1adc,
+	    0x0000, 0x0000, 0x16e2, 0x4299, 0x0c4d, 0x3599, 0x3d77, 0x3ea7,
+	    0x49fa, 0x0000, 0x323d, 0x06f8, 0x16ba, 0x3d42, 0x0000, 0x0000,
+	    0x0000, 0x1a7c, 0x0000, 0x00c8, 0x3c6b, 0x4b34, 0x440b, 0x0000,
+	    0x4704, 0x2f1d, 0x0000, 0x4a2e, 0x0000, 0x46e2, 0x0971, 0x2e8b,
+	    0x3992, 0x2690, 0x0895, 0x0000, 0x45be, 0x0000, 0x3db4, 0x1be9,
+	    0x0000, 0x0817, 0x40a5, 0x0000, 0x0000, 0x45d2, 0x29a4, 0x2c2c,
+	    0x07b3, 0x024a, 0x0a05, 0x0000, 0x3b0c, 0x0000, 0x318b, 0x3b36,
+	    0x0000, 0x0b5c, 0x3af0, 0x4247, 0x0e85, 0x1970, 0x398b, 0x1037,
+	    0x441c, 0x19f1, 0x0000, 0x0000, 0x0000, 0x35b7, 0x3da6, 0x46af,
+	    0x0956, 0x0000, 0x3ef6, 0x3bb6, 0x20dc, 0x0000, 0x2140, 0x3f6e,
+	    0x0000, 0x3f3a, 0x2f97, 0x40f7, 0x0000, 0x2dbc, 0x0000, 0x0000,
+	    0x0000, 0x43da, 0x305f, 0x4340, 0x1337, 0x4c6a, 0x47df, 0x2a6c,
+	    0x0000, 0x16f2, 0x3f4a, 0x35eb, 0x1bcd, 0x0f79, 0x37fe, 0x0000,
+	    0x0000, 0x0000, 0x272a, 0x2a30, 0x0000, 0x195e, 0x0000, 0x2190,
+	    0x0000, 0x32c8, 0x3b2a, 0x0b51, 0x00d8, 0x04a5, 0x0000, 0x0000,
+	    0x2673, 0x0743, 0x0000, 0x0f35, 0x06d6, 0x0000, 0x0000, 0x3137,
+	    0x0e87, 0x353b, 0x3f66, 0x46bd, 0x2e1b, 0x25d1, 0x3f5b, 0x31e5,
+	    0x41b6, 0x0000, 0x2e1d, 0x4347, 0x0000, 0x0f1b, 0x3e69, 0x49b9,
+	    0x3833, 0x0000, 0x0000, 0x4a52, 0x47a9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0569, 0x3208, 0x1fdc, 0x1d19, 0x3ad7, 0x0000, 0x4d0d,
+	    0x0000, 0x4087, 0x2055, 0x0000, 0x0000, 0x2119, 0x3b29, 0x4156,
+	    0x29e7, 0x1772, 0x18f2, 0x2936, 0x389d, 0x36ee, 0x3e37, 0x0000,
+	    0x46d9, 0x0000, 0x2527, 0x2dde, 0x0000, 0x425c, 0x446d, 0x0322,
+	    0x48ac, 0x0000, 0x0000, 0x1433, 0x0742, 0x1bd7, 0x3a68, 0x070a,
+	    0x2f01, 0x0373, 0x34b3, 0x4344, 0x1b0b, 0x072d, 0x2139, 0x0000,
+	    0x3dd5, 0x224b, 0x0128, 0x0000, 0x1872, 0x1779, 0x3d98, 0x1d9a,
+	    0x2a16, 0x2872, 0x0000, 0x008e, 0x3e3e, 0x0000, 0x24ad, 0x15d0,
+	    0x05f4, 0x2b3d, 0x2429, 0x0000, 0x1b61, 0x0eb0, 0x2df0, 0x04bf,
+	    0x152f, 0x3f68, 0x0000, 0x0000, 0x48a2, 0x0000, 0x084a, 0x4a73,
+	    0x1790, 0x3d72, 0x2ecf, 0x25a2, 0x0000, 0x216c, 0x239c, 0x0000,
+	    0x33c3, 0x0f09, 0x3660, 0x046c, 0x0000, 0x0000, 0x1d07, 0x10dc,
+	    0x02c4, 0x3810, 0x29b2, 0x4bfa, 0x0997, 0x198b, 0x12a9, 0x3ee6,
+	    0x3bd3, 0x2173, 0x4dbe, 0x0000, 0x192e, 0x2717, 0x0000, 0x0d14,
+	    0x1992, 0x0000, 0x3564, 0x0297, 0x3367, 0x0f10, 0x086d, 0x0000,
+	    0x07d2, 0x0000, 0x11a9, 0x4bdc, 0x2015, 0x3901, 0x0000, 0x0000,
+	    0x445a, 0x35b2, 0x0913, 0x0d79, 0x27cd, 0x400e, 0x0684, 0x0000,
+	    0x13e0, 0x2bca, 0x44e0, 0x0000, 0x0000, 0x1625, 0x0b0c, 0x1622,
+	    0x1363, 0x13f4, 0x03ef, 0x0000, 0x1b3e, 0x285e, 0x1582, 0x2427,
+	    0x0000, 0x3914, 0x1941, 0x0615, 0x2526, 0x0b9e, 0x427a, 0x49e8,
+	    0x3299, 0x0000, 0x39b7, 0x07c3, 0x4c9b, 0x14de, 0x476f, 0x030e,
+	    0x2eb2, 0x193d, 0x0000, 0x3d6d, 0x11d4, 0x1a81, 0x13f2, 0x462f,
+	    0x3dea, 0x4b9d, 0x4a63, 0x176d, 0x373c, 0x306c, 0x0000, 0x11a2,
+	    0x2906, 0x2657, 0x39ce, 0x02b8, 0x1a0b, 0x11ad, 0x4bd9, 0x09d7,
+	    0x26c2, 0x16a6, 0x4194, 0x3a43, 0x1afe, 0x0000, 0x05ac, 0x4066,
+	    0x0000, 0x0301, 0x3280, 0x0000, 0x0231, 0x286b, 0x38c3, 0x44d1,
+	    0x0000, 0x39b8, 0x3819, 0x16d4, 0x345d, 0x1a8c, 0x214e, 0x3496,
+	    0x01cc, 0x2652, 0x2d5a, 0x408d, 0x4a4d, 0x0b73, 0x00bf, 0x0000,
+	    0x1afa, 0x00a1, 0x1247, 0x2f1f, 0x173e, 0x1f88, 0x3639, 0x4b53,
+	    0x02b3, 0x0354, 0x4108, 0x0000, 0x0000, 0x089b, 0x2127, 0x3cdb,
+	    0x43c7, 0x45aa, 0x0000, 0x362e, 0x0000, 0x1594, 0x0000, 0x0000,
+	    0x41ce, 0x1e90, 0x4236, 0x0000, 0x188a, 0x372a, 0x4880, 0x23cf,
+	    0x3944, 0x34a2, 0x049c, 0x0000, 0x1f05, 0x1b28, 0x3d23, 0x20c1,
+	    0x1912, 0x1fd1, 0x293a, 0x24ec, 0x0000, 0x29f6, 0x32a0, 0x0000,
+	    0x04c3, 0x0227, 0x29fa, 0x0837, 0x3775, 0x0000, 0x290b, 0x1318,
+	    0x08da, 0x0000, 0x0a8c, 0x1193, 0x327c, 0x359e, 0x4a1c, 0x0000,
+	    0x34af, 0x49e6, 0x20ac, 0x2c51, 0x0745, 0x4d9a, 0x0000, 0x0000,
+	    0x4857, 0x0000, 0x323e, 0x0000, 0x3cd3, 0x2dfa, 0x02ef, 0x0000,
+	    0x0000, 0x0000, 0x3113, 0x3583, 0x0000, 0x4468, 0x08e3, 0x48f1,
+	    0x0000, 0x2510, 0x3727, 0x4ccb, 0x30e9, 0x0000, 0x1a77, 0x2bea,
+	    0x27a3, 0x4601, 0x19f2, 0x4667, 0x0000, 0x0f6e, 0x3c37, 0x270d,
+	    0x1b99, 0x459f, 0x44bb, 0x2f12, 0x2ec7, 0x0000, 0x0000, 0x4672,
+	    0x1fc8, 0x2232, 0x1a64, 0x0000, 0x4a8f, 0x0000, 0x3685, 0x496f,
+	    0x0000, 0x0000, 0x0f53, 0x0000, 0x1d26, 0x2fd0, 0x2223, 0x0000,
+	    0x0000, 0x02c9, 0x0000, 0x1f31, 0x07ec, 0x2f9a, 0x4a5d, 0x2230,
+	    0x0610, 0x4b62, 0x1a81, 0x0003, 0x2e36, 0x28a5, 0x0000, 0x385d,
+	    0x3c58, 0x31a6, 0x28aa, 0x0000, 0x0df3, 0x37f7, 0x34a6, 0x0549,
+	    0x122c, 0x1d4a, 0x284d, 0x4a4f, 0x2c92, 0x0000, 0x21ce, 0x41d0,
+	    0x3972, 0x0691, 0x49d8, 0x0000, 0x0405, 0x1625, 0x2bac, 0x3443,
+	    0x15f5, 0x283d, 0x34b8, 0x48d4, 0x0000, 0x1cb1, 0x3862, 0x0000,
+	    0x39f6, 0x2194, 0x0000, 0x11e4, 0x2ed6, 0x2981, 0x0000, 0x2d1a,
+	    0x0000, 0x0000, 0x38ff, 0x007e, 0x2576, 0x4c52, 0x382d, 0x0000,
+	    0x2429, 0x3fd2, 0x10eb, 0x4997, 0x3610, 0x0927, 0x0000, 0x1be8,
+	    0x4c92, 0x0e65, 0x0fc2, 0x12ec, 0x305a, 0x01c9, 0x0364, 0x2e67,
+	    0x2447, 0x38fc, 0x0000, 0x0187, 0x1a84, 0x1fbd, 0x243a, 0x3c65,
+	    0x29d6, 0x0000, 0x0000, 0x284b, 0x0672, 0x0000, 0x4849, 0x255f,
+	    0x277e, 0x4115, 0x0000, 0x0fc3, 0x0000, 0x4e1b, 0x1d8d, 0x4d2d,
+	    0x0000, 0x2620, 0x0000, 0x484f, 0x0c9b, 0x4ab3, 0x4b02, 0x09ba,
+	    0x0000, 0x0719, 0x035c, 0x1799, 0x0000, 0x48b3, 0x43a3, 0x29f4,
+	    0x2658, 0x0000, 0x2d4d, 0x339c, 0x0fd8, 0x01bd, 0x116b, 0x0dbe,
+	    0x1f16, 0x4a45, 0x0000, 0x3edf, 0x3145, 0x0523, 0x0b2b, 0x2dba,
+	    0x4ad8, 0x24a2, 0x3fe0, 0x2a0c, 0x1668, 0x3f1f, 0x0756, 0x3311,
+	    0x0000, 0x247f, 0x0000, 0x03bc, 0x33ae, 0x0b23, 0x186c, 0x4738,
+	    0x2036, 0x4a51, 0x0452, 0x43b1, 0x0f03, 0x49cd, 0x3b54, 0x200b,
+	    0x04a5, 0x3991, 0x1326, 0x08d4, 0x0000, 0x0000, 0x23c6, 0x05c6,
+	    0x2393, 0x0f6f, 0x37ed, 0x2b8a, 0x0000, 0x0096, 0x0a9f, 0x062d,
+	    0x03d7, 0x371f, 0x0000, 0x203c, 0x0ed7, 0x4004, 0x3890, 0x0000,
+	    0x11fb, 0x2aa4, 0x3e1f, 0x1304, 0x04a2, 0x326b, 0x1ec9, 0x4b66,
+	    0x0000, 0x3b6a, 0x048d, 0x3a23, 0x37bd, 0x1734, 0x0000, 0x03a0,
+	    0x1b6e, 0x0000, 0x056f, 0x0316, 0x4a9f, 0x1945, 0x0000, 0x0312,
+	    0x0284, 0x2ebd, 0x0000, 0x477c, 0x0000, 0x3e8a, 0x0000, 0x0000,
+	    0x02fd, 0x0965, 0x2f35, 0x2579, 0x3848, 0x4d91, 0x382a, 0x0000,
+	    0x2356, 0x0000, 0x33e4, 0x002d, 0x0374, 0x0000, 0x139f, 0x0000,
+	    0x111b, 0x1826, 0x0cff, 0x145f, 0x459f, 0x2933, 0x09f1, 0x0237,
+	    0x0000, 0x446e, 0x24f7, 0x0a88, 0x2ca2, 0x0000, 0x3cd3, 0x3cc7,
+	    0x34ff, 0x004d, 0x21a0, 0x0000, 0x40ec, 0x08f4, 0x4886, 0x0627,
+	    0x1229, 0x0bb7, 0x02e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a86,
+	    0x0000, 0x0000, 0x2ce4, 0x2744, 0x3275, 0x0000, 0x0000, 0x4146,
+	    0x43d8, 0x2e3e, 0x2c2f, 0x0000, 0x1d2f, 0x49bf, 0x00ec, 0x0000,
+	    0x0000, 0x1876, 0x0000, 0x0000, 0x02c1, 0x4d91, 0x0000, 0x0000,
+	    0x39b0, 0x14a6, 0x0000, 0x36d5, 0x0e20, 0x2f24, 0x3966, 0x42ae,
+	    0x0000, 0x13ac, 0x251e, 0x0000, 0x185c, 0x330e, 0x0cd4, 0x0ac4,
+	    0x2ebe, 0x2693, 0x2511, 0x0000, 0x29e9, 0x0810, 0x4d6d, 0x36e3,
+	    0x2384, 0x0000, 0x1d36, 0x2d14, 0x066e, 0x0000, 0x145a, 0x0000,
+	    0x0000, 0x0000, 0x4c8a, 0x0000, 0x0000, 0x0d34, 0x0000, 0x0000,
+	    0x4348, 0x0000, 0x2df6, 0x0000, 0x2d47, 0x1c94, 0x2b3a, 0x12cb,
+	    0x4302, 0x0000, 0x0000, 0x4bec, 0x0000, 0x363b, 0x2f35, 0x1b00,
+	    0x0000, 0x3d56, 0x28f7, 0x3fd5, 0x0000, 0x422d, 0x0cbe, 0x48eb,
+	    0x3276, 0x0000, 0x3a28, 0x2e5c, 0x4a10, 0x0000, 0x0000, 0x0000,
+	    0x2eda, 0x0b9b, 0x1951, 0x23fd, 0x24cf, 0x3f98, 0x0000, 0x0430,
+	    0x0000, 0x374c, 0x0000, 0x3307, 0x0000, 0x2085, 0x0000, 0x203c,
+	    0x2d40, 0x440f, 0x0000, 0x00ac, 0x476c, 0x0000, 0x2e58, 0x0000,
+	    0x3c58, 0x32d5, 0x0000, 0x3b98, 0x39dc, 0x0000, 0x0000, 0x4354,
+	    0x2d66, 0x3c9d, 0x41a5, 0x0165, 0x143b, 0x0a95, 0x09e1, 0x1881,
+	    0x44f7, 0x168b, 0x0000, 0x1ebf, 0x0000, 0x22e1, 0x3c15, 0x18be,
+	    0x0cf1, 0x0000, 0x3c63, 0x0000, 0x4490, 0x33ab, 0x168a, 0x0000,
+	    0x04fc, 0x2af7, 0x368b, 0x3f89, 0x0000, 0x31e6, 0x23dc, 0x267f,
+	    0x35ee, 0x2dc1, 0x0809, 0x11f9, 0x1dc8, 0x1558, 0x0000, 0x4759,
+	    0x17e4, 0x17a1, 0x2b69, 0x0000, 0x30eb, 0x286e, 0x244e, 0x0430,
+	    0x0000, 0x17ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2791,
+	    0x09d4, 0x2565, 0x0000, 0x2032, 0x2a35, 0x0000, 0x3dc9, 0x12af,
+	    0x07f4, 0x0000, 0x2dac, 0x0000, 0x3601, 0x0000, 0x0000, 0x0000,
+	    0x0c21, 0x4420, 0x4570, 0x0000, 0x3bd6, 0x246e, 0x0000, 0x04fc,
+	    0x497a, 0x0000, 0x2ff3, 0x0000, 0x4d26, 0x3fa1, 0x13ac, 0x367a,
+	    0x0a2c, 0x0153, 0x1bf0, 0x12ed, 0x10f0, 0x0000, 0x21d5, 0x2478,
+	    0x36c1, 0x4070, 0x0a45, 0x048e, 0x2614, 0x2918, 0x32af, 0x0000,
+	    0x0000, 0x185e, 0x1283, 0x2284, 0x0000, 0x1e91, 0x2e75, 0x0000,
+	    0x1850, 0x0000, 0x3c1f, 0x07da, 0x4867, 0x0000, 0x2bf8, 0x4a6a,
+	    0x3263, 0x0caf, 0x4b64, 0x0000, 0x0000, 0x0000, 0x3ac0, 0x0000,
+	    0x2ade, 0x09bf, 0x0000, 0x2324, 0x02fa, 0x2652, 0x0000, 0x0731,
+	    0x2e42, 0x4822, 0x0000, 0x122c, 0x24b9, 0x2887, 0x0000, 0x0000,
+	    0x08cb, 0x0000, 0x0000, 0x3dae, 0x1ab1, 0x3ee7, 0x178b, 0x3170,
+	    0x386a, 0x0000, 0x4cf0, 0x0000, 0x2628, 0x46c8, 0x252e, 0x0000,
+	    0x2a67, 0x0ef5, 0x34ce, 0x0124, 0x0000, 0x4d6f, 0x0000, 0x2f7f,
+	    0x127a, 0x0000, 0x1f1d, 0x2f1e, 0x2b9b, 0x0000, 0x131e, 0x404e,
+	    0x0d39, 0x1af9, 0x17df, 0x1bce, 0x0000, 0x0000, 0x1998, 0x346b,
+	    0x07cb, 0x37a4, 0x0000, 0x0000, 0x298b, 0x22b6, 0x0968, 0x23cc,
+	    0x4102, 0x0000, 0x4938, 0x0000, 0x4549, 0x0000, 0x2251, 0x37bb,
+	    0x09e4, 0x2890, 0x2057, 0x0000, 0x01dd, 0x0000, 0x0000, 0x01db,
+	    0x4380, 0x2a95, 0x0000, 0x0000, 0x412a, 0x0087, 0x0c75, 0x2991,
+	    0x2db7, 0x4cfd, 0x4970, 0x4671, 0x3fa5, 0x4adb, 0x2c3d, 0x43a1,
+	    0x0000, 0x46f6, 0x0e62, 0x25cf, 0x366b, 0x1808, 0x1581, 0x1202,
+	    0x0000, 0x34d5, 0x1915, 0x416d, 0x0000, 0x10d3, 0x35b6, 0x0000,
+	    0x0000, 0x2316, 0x222d, 0x2949, 0x0f21, 0x18d3, 0x2768, 0x1191,
+	    0x295c, 0x0000, 0x0000, 0x1241, 0x4396, 0x1354, 0x3dfe, 0x08b2,
+	    0x3126, 0x366d, 0x4700, 0x0000, 0x0000, 0x2df3, 0x1ba2, 0x0000,
+	    0x0000, 0x4aa5, 0x0bfd, 0x0d07, 0x0f10, 0x21f9, 0x275e, 0x09f9,
+	    0x147e, 0x018c, 0x0000, 0x2bf2, 0x18cb, 0x3219, 0x0604, 0x4be1,
+	    0x4032, 0x35a1, 0x3fac, 0x06ac, 0x415a, 0x0000, 0x0000, 0x1597,
+	    0x0000, 0x40fc, 0x0493, 0x0000, 0x2777, 0x0000, 0x09d2, 0x20c8,
+	    0x49d7, 0x0000, 0x1385, 0x21ab, 0x28b5, 0x389e, 0x410f, 0x1ee8,
+	    0x3e1c, 0x3600, 0x440b, 0x4dc1, 0x0e6b, 0x32cc, 0x0000, 0x0000,
+	    0x201b, 0x0397, 0x2423, 0x228d, 0x1b46, 0x1471, 0x2578, 0x46d0,
+	    0x474b, 0x0000, 0x1a65, 0x0000, 0x087c, 0x0000, 0x1708, 0x0000,
+	    0x3a9a, 0x2802, 0x37d6, 0x453c, 0x037e, 0x1c9c, 0x34d3, 0x2cbd,
+	    0x4630, 0x3fa7, 0x0000, 0x0000, 0x0000, 0x276b, 0x4af1, 0x41c0,
+	    0x382a, 0x0000, 0x194e, 0x0bd1, 0x4d94, 0x1b27, 0x4b61, 0x4d09,
+	    0x22c7, 0x4da2, 0x2f23, 0x1df5, 0x0f42, 0x10ea, 0x2662, 0x0000,
+	    0x0000, 0x0fd1, 0x1585, 0x15fc, 0x38f6, 0x2495, 0x331b, 0x03f3,
+	    0x0000, 0x261c, 0x0000, 0x3c2a, 0x0000, 0x0632, 0x0000, 0x46a7,
+	    0x07a9, 0x3f44, 0x0000, 0x0000, 0x0d87, 0x321c, 0x0000, 0x0000,
+	    0x480e, 0x0000, 0x2a81, 0x33fc, 0x0000, 0x0000, 0x3b35, 0x1a16,
+	    0x2cd3, 0x2991, 0x4473, 0x3e4e, 0x1158, 0x2cd2, 0x0128, 0x0000,
+	    0x04ca, 0x1c35, 0x11b4, 0x06d9, 0x24c0, 0x0c9d, 0x30c3, 0x0000,
+	    0x316f, 0x237f, 0x1074, 0x3b20, 0x34a8, 0x4142, 0x0044, 0x3edb,
+	    0x08a3, 0x0000, 0x0250, 0x1eec, 0x07bc, 0x0000, 0x3dd9, 0x315a,
+	    0x1f2f, 0x0000, 0x3b32, 0x29f4, 0x1c85, 0x06a6, 0x2866, 0x1740,
+	    0x085f, 0x1a1f, 0x492b, 0x0292, 0x0000, 0x0000, 0x4953, 0x0000,
+	    0x2589, 0x1cc3, 0x1fe0, 0x4ccb, 0x0da0, 0x0000, 0x0000, 0x3a18,
+	    0x4371, 0x30a1, 0x0a95, 0x1cce, 0x3adf, 0x0000, 0x2142, 0x4695,
+	    0x4c49, 0x0000, 0x0007, 0x480a, 0x03af, 0x0000, 0x0000, 0x261b,
+	    0x0000, 0x29d6, 0x0000, 0x294e, 0x1839, 0x0000, 0x1984, 0x0000,
+	    0x06be, 0x4848, 0x19c8, 0x0000, 0x2874, 0x0000, 0x1f2e, 0x2a72,
+	    0x26a5, 0x120d, 0x0000, 0x0d4d, 0x1a8d, 0x0082, 0x0b17, 0x0365,
+	    0x064d, 0x2683, 0x1117, 0x451d, 0x0934, 0x0b28, 0x3080, 0x3253,
+	    0x10f4, 0x46e9, 0x2869, 0x3380, 0x16b1, 0x42ba, 0x3558, 0x13e8,
+	    0x1f71, 0x2810, 0x1f4d, 0x1b62, 0x1484, 0x0649, 0x1305, 0x0000,
+	    0x2d46, 0x40af, 0x0000, 0x0b26, 0x0000, 0x205b, 0x142f, 0x0a7d,
+	    0x0000, 0x214b, 0x47d8, 0x09dc, 0x383c, 0x0000, 0x095b, 0x2361,
+	    0x3fb0, 0x0831, 0x38cd, 0x435c, 0x34b5, 0x0000, 0x0000, 0x4c4b,
+	    0x3e11, 0x0000, 0x07f9, 0x0edb, 0x2e6c, 0x0041, 0x0000, 0x0000,
+	    0x3753, 0x2a9e, 0x0274, 0x0000, 0x3fc9, 0x2321, 0x228c, 0x4b32,
+	    0x0000, 0x2aad, 0x0000, 0x0000, 0x284b, 0x4b2e, 0x2f15, 0x21d9,
+	    0x3027, 0x4113, 0x2c18, 0x1bf2, 0x38d5, 0x0000, 0x1f37, 0x0d1d,
+	    0x42fd, 0x11f8, 0x0000, 0x331c, 0x022d, 0x34c9, 0x0000, 0x0000,
+	    0x2135, 0x34de, 0x31e1, 0x4028, 0x1f65, 0x3c83, 0x0000, 0x3d0c,
+	    0x0000, 0x2cb8, 0x0c26, 0x0000, 0x0a23, 0x0000, 0x0000, 0x230b,
+	    0x26b8, 0x0000, 0x0000, 0x389a, 0x0000, 0x0000, 0x0000, 0x1d89,
+	    0x0176, 0x1fe0, 0x1fa9, 0x402f, 0x0eb3, 0x02ab, 0x2d07, 0x11b8,
+	    0x0000, 0x3b2e, 0x094d, 0x113d, 0x29a5, 0x43bc, 0x3f35, 0x0000,
+	    0x26ec, 0x0000, 0x4b0e, 0x15cc, 0x188b, 0x3804, 0x0000, 0x2dda,
+	    0x2c71, 0x34de, 0x0baf, 0x0000, 0x30cd, 0x0198, 0x0000, 0x338a,
+	    0x4689, 0x0000, 0x2181, 0x0000, 0x2af9, 0x2610, 0x3426, 0x3e7f,
+	    0x20e6, 0x0000, 0x3a34, 0x4215, 0x15e7, 0x0000, 0x0000, 0x2d88,
+	    0x242c, 0x3a4a, 0x0af7, 0x29ef, 0x0000, 0x3f5c, 0x43b1, 0x0692,
+	    0x4733, 0x0801, 0x0000, 0x0000, 0x3545, 0x43fb, 0x33bb, 0x3d8a,
+	    0x2ef9, 0x0000, 0x2a7a, 0x0aac, 0x0000, 0x1565, 0x183e, 0x0000,
+	    0x2c2b, 0x3047, 0x1815, 0x1ceb, 0x0000, 0x283e, 0x144e, 0x0000,
+	    0x3769, 0x35ec, 0x4c34, 0x3275, 0x337c, 0x0c15, 0x238a, 0x0000,
+	    0x0cb2, 0x2887, 0x3146, 0x38e8, 0x03f2, 0x1b89, 0x2e77, 0x0000,
+	    0x4a57, 0x00ee, 0x0178, 0x2277, 0x48d0, 0x476e, 0x0000, 0x0000,
+	    0x1fc8, 0x0000, 0x1e39, 0x3649, 0x0000, 0x11aa, 0x357d, 0x051c,
+	    0x3c88, 0x2645, 0x2971, 0x44e7, 0x2f0a, 0x47ad, 0x16b5, 0x4c77,
+	    0x39c0, 0x18f2, 0x0000, 0x0000, 0x0000, 0x22b2, 0x096c, 0x0000,
+	    0x0000, 0x390e, 0x21fe, 0x11f3, 0x005a, 0x0000, 0x0000, 0x0678,
+	    0x3640, 0x414d, 0x33b6, 0x0000, 0x01bd, 0x0000, 0x4121, 0x087b,
+	    0x150f, 0x00b0, 0x4615, 0x152d, 0x39ca, 0x075a, 0x3c8d, 0x4bb3,
+	    0x2202, 0x313c, 0x3186, 0x1c8e, 0x0000, 0x0000, 0x0d95, 0x0000,
+	    0x2bdd, 0x204b, 0x0088, 0x0000, 0x44fe, 0x4bcf, 0x1cc8, 0x33b8,
+	    0x28dd, 0x2653, 0x0000, 0x08a3, 0x27df, 0x2199, 0x3f1b, 0x0b55,
+	    0x2664, 0x0d83, 0x0000, 0x0000, 0x2b3a, 0x255d, 0x0000, 0x342b,
+	    0x0ff0, 0x1605, 0x4ba7, 0x0497, 0x30f5, 0x1c77, 0x25cd, 0x36cc,
+	    0x0000, 0x4977, 0x2f1d, 0x3130, 0x2b6c, 0x1e1f, 0x175d, 0x0be0,
+	    0x0000, 0x0000, 0x3eb9, 0x124a, 0x35f6, 0x2cc7, 0x2758, 0x2ebe,
+	    0x013a, 0x2adf, 0x198b, 0x4499, 0x1000, 0x048f, 0x2d83, 0x0000,
+	    0x0000, 0x47a7, 0x20d1, 0x363c, 0x38bc, 0x18ab, 0x1d9f, 0x107e,
+	    0x4732, 0x2df0, 0x2085, 0x1623, 0x2b86, 0x36b7, 0x1ea7, 0x4265,
+	    0x3b91, 0x3025, 0x01dc, 0x00a3, 0x0000, 0x3949, 0x0000, 0x0416,
+	    0x24b3, 0x27ed, 0x2ae9, 0x200c, 0x0000, 0x1743, 0x04e9, 0x3aef,
+	    0x267f, 0x0000, 0x209d, 0x191b, 0x130d, 0x0000, 0x3737, 0x067c,
+	    0x3cab, 0x24db, 0x0000, 0x2a58, 0x1629, 0x4019, 0x0a4a, 0x0000,
+	    0x23f8, 0x3500, 0x43be, 0x0000, 0x2842, 0x0bd8, 0x0000, 0x1224,
+	    0x0000, 0x0000, 0x23af, 0x0000, 0x145f, 0x11a1, 0x282b, 0x221c,
+	    0x36f2, 0x34ca, 0x12ef, 0x288f, 0x0000, 0x0000, 0x455d, 0x3daa,
+	    0x36a8, 0x0000, 0x0000, 0x34b3, 0x0000, 0x2a3d, 0x1e52, 0x27d8,
+	    0x2d6b, 0x1945, 0x0a8e, 0x00c8, 0x21f1, 0x0000, 0x3b6e, 0x108e,
+	    0x0000, 0x2952, 0x0000, 0x20ac, 0x332c, 0x0000, 0x263e, 0x0000,
+	    0x0000, 0x3580, 0x0000, 0x0000, 0x4307, 0x043b, 0x0000, 0x2154,
+	    0x1e21, 0x2aa0, 0x0000, 0x085a, 0x3ceb, 0x09d2, 0x0000, 0x0927,
+	    0x3b8b, 0x318f, 0x0000, 0x0a52, 0x265a, 0x329b, 0x0000, 0x0c18,
+	    0x262f, 0x3815, 0x3c68, 0x0a2d, 0x3e8a, 0x0279, 0x0000, 0x3a16,
+	    0x05f0, 0x1d0d, 0x436e, 0x0000, 0x0e25, 0x3641, 0x065a, 0x278e,
+	    0x0000, 0x3706, 0x0f28, 0x283e, 0x2f46, 0x0000, 0x0000, 0x1607,
+	    0x45bf, 0x2bd5, 0x0c3d, 0x00fe, 0x3b8d, 0x491e, 0x4251, 0x22f1,
+	    0x2975, 0x498f, 0x214e, 0x3cf2, 0x0839, 0x040b, 0x2f18, 0x20cf,
+	    0x093d, 0x0ad6, 0x12f8, 0x0000, 0x313e, 0x0000, 0x12ab, 0x0000,
+	    0x1991, 0x0000, 0x0000, 0x21b0, 0x1830, 0x1a0b, 0x0000, 0x4135,
+	    0x0948, 0x2149, 0x15b6, 0x2524, 0x0000, 0x315e, 0x080a, 0x0000,
+	    0x1adb, 0x4824, 0x2db1, 0x3140, 0x48b3, 0x0214, 0x1e6a, 0x18f4,
+	    0x0000, 0x0f9f, 0x24de, 0x45ce, 0x0b72, 0x4d2c, 0x2432, 0x0a32,
+	    0x1437, 0x04d2, 0x3ee4, 0x373b, 0x0000, 0x44a7, 0x368f, 0x309e,
+	    0x3488, 0x488f, 0x0000, 0x489e, 0x0a0b, 0x04a6, 0x0dde, 0x0b38,
+	    0x11d3, 0x3f6c, 0x0000, 0x1163, 0x0000, 0x0203, 0x0b32, 0x3efc,
+	    0x01fe, 0x023a, 0x1c7d, 0x0000, 0x0571, 0x050c, 0x0000, 0x1310,
+	    0x2606, 0x1b9d, 0x15fb, 0x4b31, 0x2ab8, 0x4560, 0x0e2a, 0x3638,
+	    0x249a, 0x2968, 0x2beb, 0x0000, 0x0f08, 0x3921, 0x4b67, 0x2433,
+	    0x0000, 0x1c57, 0x0000, 0x0000, 0x221b, 0x3e4e, 0x464c, 0x0f94,
+	    0x17aa, 0x1959, 0x0000, 0x4938, 0x4874, 0x07f0, 0x2d61, 0x18b0,
+	    0x0ded, 0x0000, 0x0000, 0x1bf9, 0x0097, 0x2e28, 0x0324, 0x2e76,
+	    0x0000, 0x37b9, 0x1adb, 0x0736, 0x27a4, 0x333d, 0x0000, 0x0000,
+	    0x1424, 0x09dd, 0x2045, 0x286d, 0x112a, 0x4514, 0x3652, 0x4d64,
+	    0x431c, 0x26dd, 0x00d7, 0x0000, 0x0000, 0x385b, 0x0c68, 0x0000,
+	    0x0000, 0x0015, 0x3a18, 0x037c, 0x066a, 0x4281, 0x1d74, 0x3ab1,
+	    0x49b2, 0x35f6, 0x0559, 0x1e6a, 0x4c28, 0x0000, 0x1d61, 0x0000,
+	    0x0000, 0x0000, 0x0eae, 0x3d03, 0x11a9, 0x3e76, 0x37f8, 0x44bf,
+	    0x0000, 0x0000, 0x1f6c, 0x0ad9, 0x4788, 0x4cde, 0x1896, 0x2002,
+	    0x3226, 0x0000, 0x1e50, 0x1eb7, 0x0000, 0x2fb2, 0x4423, 0x0434,
+	    0x0000, 0x0000, 0x0000, 0x026e, 0x1bd2, 0x30a1, 0x3c16, 0x48b4,
+	    0x4788, 0x0bcd, 0x4d59, 0x12d5, 0x06e3, 0x4afc, 0x2e19, 0x0000,
+	    0x08a9, 0x083e, 0x3e21, 0x0000, 0x1a2c, 0x344f, 0x1d41, 0x09ed,
+	    0x2670, 0x04ce, 0x4df4, 0x0000, 0x1a29, 0x0000, 0x44d1, 0x4483,
+	    0x0000, 0x0000, 0x0b5c, 0x3b16, 0x4d07, 0x0000, 0x3018, 0x3ecf,
+	    0x07dd, 0x3ee2, 0x3e23, 0x0000, 0x10fe, 0x4bad, 0x458a, 0x0000,
+	    0x0000, 0x113f, 0x0e59, 0x1800, 0x13b5, 0x3398, 0x0000, 0x0000,
+	    0x4be3, 0x4985, 0x4484, 0x1641, 0x29b9, 0x1353, 0x219d, 0x0000,
+	    0x07d2, 0x1980, 0x3707, 0x0bd7, 0x0000, 0x0be3, 0x0000, 0x3526,
+	    0x0150, 0x2b83, 0x0a4a, 0x0000, 0x0000, 0x32dc, 0x17eb, 0x0000,
+	    0x0ec6, 0x0000, 0x31f4, 0x1e81, 0x136d, 0x1497, 0x4721, 0x3480,
+	    0x45e6, 0x2af7, 0x0000, 0x4531, 0x0000, 0x1edb, 0x0dc2, 0x0000,
+	    0x4753, 0x06aa, 0x40e1, 0x42e7, 0x0000, 0x4141, 0x0000, 0x0c07,
+	    0x0a8b, 0x042b, 0x4bf5, 0x1587, 0x4d6f, 0x0000, 0x0000, 0x4c29,
+	    0x0ea4, 0x2bc0, 0x3044, 0x32ec, 0x0000, 0x2fa1, 0x1cd3, 0x25d0,
+	    0x0000, 0x0f94, 0x0bba, 0x0000, 0x398f, 0x44a6, 0x25f0, 0x12a3,
+	    0x2fc4, 0x1757, 0x0baa, 0x4698, 0x44ef, 0x08f1, 0x28aa, 0x0000,
+	    0x46f9, 0x0000, 0x2c67, 0x0c8a, 0x1296, 0x4a01, 0x0000, 0x06fa,
+	    0x3ff4, 0x28a6, 0x1de3, 0x0000, 0x37b0, 0x0d81, 0x0000, 0x0f65,
+	    0x26c4, 0x3f2a, 0x02ee, 0x1904, 0x162e, 0x1f81, 0x0000, 0x1875,
+	    0x04e4, 0x031e, 0x0000, 0x02ab, 0x22f7, 0x1f0e, 0x070c, 0x3967,
+	    0x3109, 0x0000, 0x0aa1, 0x3f9c, 0x2b4a, 0x0000, 0x1b7c, 0x0e73,
+	    0x25b1, 0x26fa, 0x2ab8, 0x0000, 0x4b26, 0x0000, 0x02b9, 0x0948,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a5, 0x0000, 0x205b,
+	    0x1e89, 0x296a, 0x0000, 0x0000, 0x44b9, 0x0000, 0x3e31, 0x4a45,
+	    0x311e, 0x4d1f, 0x1f20, 0x0d4a, 0x4383, 0x2158, 0x1ead, 0x0000,
+	    0x4830, 0x2bdf, 0x32e9, 0x2977, 0x4629, 0x0000, 0x0221, 0x0cd1,
+	    0x2736, 0x0000, 0x0ee8, 0x03c6, 0x1227, 0x3a0a, 0x0000, 0x0000,
+	    0x448e, 0x1950, 0x40ad, 0x2554, 0x4413, 0x205c, 0x05d4, 0x258b,
+	    0x0cbf, 0x3ae2, 0x0000, 0x476f, 0x0000, 0x0b80, 0x35f7, 0x0220,
+	    0x00a5, 0x0000, 0x20fc, 0x06b3, 0x372b, 0x2376, 0x0cd5, 0x2e91,
+	    0x0000, 0x1312, 0x06c1, 0x0b04, 0x1173, 0x3e0b, 0x0a66, 0x2178,
+	    0x0000, 0x2133, 0x3db3, 0x3051, 0x0000, 0x403c, 0x0000, 0x18b0,
+	    0x3b61, 0x0000, 0x0000, 0x17e7, 0x36ce, 0x0886, 0x419d, 0x103a,
+	    0x4876, 0x0000, 0x009e, 0x0000, 0x34e3, 0x0000, 0x40ac, 0x407f,
+	    0x01f5, 0x28c5, 0x0000, 0x0000, 0x4123, 0x0000, 0x1add, 0x1f8a,
+	    0x36d5, 0x47dd, 0x376e, 0x0000, 0x0000, 0x43e2, 0x0000, 0x04cd,
+	    0x4954, 0x11a1, 0x07c4, 0x0bc5, 0x0f93, 0x1644, 0x0000, 0x0000,
+	    0x158a, 0x3c88, 0x290d, 0x1ea0, 0x1f34, 0x3df7, 0x314c, 0x0000,
+	    0x3014, 0x01ed, 0x1e20, 0x285d, 0x0000, 0x4caa, 0x3a7b, 0x49a9,
+	    0x3bee, 0x4d85, 0x3cda, 0x29cb, 0x1377, 0x3d16, 0x3719, 0x0000,
+	    0x0000, 0x23e3, 0x4be0, 0x1620, 0x0269, 0x196c, 0x0000, 0x4400,
+	    0x49d6, 0x0000, 0x0000, 0x0000, 0x1ed8, 0x1e80, 0x426b, 0x0422,
+	    0x2033, 0x33de, 0x0c17, 0x0a1f, 0x084c, 0x0000, 0x2eea, 0x0000,
+	    0x0fb9, 0x30f5, 0x0000, 0x2035, 0x03e5, 0x22c1, 0x1394, 0x3694,
+	    0x27d7, 0x03e0, 0x10e4, 0x405b, 0x0c6f, 0x0000, 0x494c, 0x02c6,
+	    0x0000, 0x307d, 0x1542, 0x0000, 0x02e8, 0x17bf, 0x14ee, 0x0000,
+	    0x466c, 0x249a, 0x2caa, 0x1144, 0x0000, 0x0000, 0x0b1e, 0x1d29,
+	    0x0873, 0x245c, 0x143e, 0x3f25, 0x0000, 0x0000, 0x1c67, 0x0ce8,
+	    0x20eb, 0x46ba, 0x126d, 0x07ed, 0x3cb5, 0x1ec3, 0x2360, 0x3595,
+	    0x0000, 0x3416, 0x1a17, 0x2077, 0x3230, 0x0000, 0x0000, 0x151d,
+	    0x1b48, 0x0000, 0x0000, 0x0000, 0x38c4, 0x0000, 0x09f5, 0x2770,
+	    0x1bd4, 0x4056, 0x4b77, 0x0c86, 0x291f, 0x4c4e, 0x202f, 0x244c,
+	    0x1e96, 0x3025, 0x0124, 0x4979, 0x46dc, 0x4096, 0x4c7f, 0x2f54,
+	    0x00f9, 0x0af4, 0x077d, 0x0a5b, 0x353a, 0x0000, 0x1537, 0x3f5c,
+	    0x3b2b, 0x45db, 0x2dab, 0x0000, 0x19fe, 0x1262, 0x22dc, 0x3d98,
+	    0x0000, 0x4937, 0x3a47, 0x0000, 0x0000, 0x086d, 0x03de, 0x4b2f,
+	    0x1c10, 0x0000, 0x4292, 0x1500, 0x3282, 0x03e4, 0x4c8f, 0x2fc6,
+	    0x43b7, 0x410e, 0x377d, 0x2ad3, 0x4c22, 0x0000, 0x0000, 0x1af7,
+	    0x4b1f, 0x0000, 0x0118, 0x40bc, 0x2c7e, 0x46bb, 0x39cb, 0x0000,
+	    0x0f7f, 0x0daf, 0x0000, 0x14ef, 0x0000, 0x0090, 0x414c, 0x3114,
+	    0x0000, 0x4cf8, 0x1c3c, 0x4787, 0x40c8, 0x0000, 0x47d2, 0x38e1,
+	    0x0000, 0x3e33, 0x0000, 0x3a8d, 0x3e76, 0x0000, 0x26dd, 0x1eac,
+	    0x48c7, 0x420f, 0x0000, 0x0b69, 0x1f92, 0x38e5, 0x427b, 0x35e9,
+	    0x1efc, 0x0328, 0x3d15, 0x111c, 0x2162, 0x054d, 0x0000, 0x1748,
+	    0x0000, 0x23ee, 0x40a8, 0x3ea4, 0x36dc, 0x0775, 0x0000, 0x3f4c,
+	    0x1c1c, 0x1d40, 0x0416, 0x39de, 0x0458, 0x3902, 0x2899, 0x3c1a,
+	    0x28fc, 0x0000, 0x08a1, 0x1391, 0x0000, 0x46ae, 0x23ad, 0x0000,
+	    0x134c, 0x201f, 0x0000, 0x0c83, 0x0000, 0x0000, 0x43b6, 0x0ab9,
+	    0x20d8, 0x2574, 0x1af9, 0x3983, 0x0000, 0x0000, 0x48f6, 0x42a3,
+	    0x1a6a, 0x0000, 0x44fd, 0x39fd, 0x4417, 0x3dee, 0x0000, 0x023b,
+	    0x3d3f, 0x4078, 0x27c2, 0x04d3, 0x0000, 0x2ac8, 0x040d, 0x35d3,
+	    0x0000, 0x2a4f, 0x3ef1, 0x36a1, 0x116c, 0x0934, 0x3359, 0x3b80,
+	    0x3cbc, 0x074f, 0x0000, 0x36ec, 0x071a, 0x41f8, 0x0000, 0x19b4,
+	    0x3c9c, 0x0000, 0x0000, 0x1e29, 0x0000, 0x3fd6, 0x0000, 0x486c,
+	    0x0ec1, 0x0b3a, 0x0000, 0x0000, 0x0000, 0x0315, 0x41d9, 0x1a0c,
+	    0x0dbd, 0x0000, 0x1fe5, 0x1da7, 0x225d, 0x3d7e, 0x1b10, 0x242a,
+	    0x0000, 0x2567, 0x00b1, 0x19a6, 0x28bc, 0x3868, 0x401e, 0x4b43,
+	    0x1711, 0x079b, 0x3246, 0x0000, 0x0000, 0x0000, 0x27c0, 0x13e4,
+	    0x0000, 0x1988, 0x092a, 0x0e15, 0x0079, 0x0525, 0x1ca2, 0x0000,
+	    0x1df7, 0x0000, 0x2570, 0x4694, 0x365d, 0x25be, 0x0e0b, 0x2370,
+	    0x17e4, 0x4cb5, 0x2ede, 0x4d81, 0x459c, 0x0000, 0x18ab, 0x3163,
+	    0x0000, 0x0000, 0x2002, 0x0000, 0x0000, 0x0000, 0x3cb2, 0x0000,
+	    0x467a, 0x0000, 0x096b, 0x4274, 0x083b, 0x0000, 0x4a68, 0x18f0,
+	    0x42e9, 0x1e38, 0x4085, 0x4e06, 0x0ba8, 0x17e7, 0x200f, 0x1b5e,
+	    0x0098, 0x1098, 0x1f6a, 0x49d9, 0x2dea, 0x0000, 0x0b9f, 0x4aef,
+	    0x3f17, 0x14e3, 0x2771, 0x1498, 0x40b4, 0x0000, 0x0777, 0x0142,
+	    0x23d0, 0x17d5, 0x0000, 0x0000, 0x0000, 0x1448, 0x2bc4, 0x0000,
+	    0x04b2, 0x2bdc, 0x2e9e, 0x0000, 0x03b8, 0x0000, 0x20f4, 0x3bf1,
+	    0x34c7, 0x00b4, 0x0000, 0x2aea, 0x236d, 0x2864, 0x3d7d, 0x05c3,
+	    0x15fb, 0x1190, 0x4582, 0x0cb0, 0x0552, 0x0bfa, 0x208d, 0x3077,
+	    0x2a8b, 0x383c, 0x24df, 0x4a06, 0x3853, 0x03dd, 0x2f0d, 0x221d,
+	    0x3659, 0x32e6, 0x0f7b, 0x4365, 0x120a, 0x0654, 0x488c, 0x0000,
+	    0x01b7, 0x32ed, 0x4223, 0x0000, 0x0802, 0x12ad, 0x0000, 0x1840,
+	    0x3619, 0x32ba, 0x0000, 0x10bd, 0x0000, 0x0dd6, 0x0000, 0x3f01,
+	    0x4bf9, 0x360a, 0x0c97, 0x1215, 0x45d6, 0x1819, 0x3d30, 0x0000,
+	    0x2e65, 0x3883, 0x0000, 0x2b59, 0x0000, 0x1460, 0x20d8, 0x0ee4,
+	    0x0000, 0x25a9, 0x0eba, 0x113a, 0x1f30, 0x3918, 0x4715, 0x3a70,
+	    0x0911, 0x0d95, 0x216e, 0x234a, 0x1f98, 0x26ac, 0x43c3, 0x330f,
+	    0x22fa, 0x1ae8, 0x0000, 0x12ae, 0x0000, 0x18e2, 0x130e, 0x0ab2,
+	    0x3f12, 0x0000, 0x3880, 0x4aee, 0x19b0, 0x0668, 0x0000, 0x0a56,
+	    0x1e70, 0x3f92, 0x3308, 0x2233, 0x1b68, 0x235f, 0x3a55, 0x0000,
+	    0x07f6, 0x1a7d, 0x1d7f, 0x2bb6, 0x350a, 0x2689, 0x4767, 0x1350,
+	    0x0000, 0x339f, 0x498c, 0x386d, 0x0000, 0x2613, 0x0000, 0x07f7,
+	    0x0000, 0x3368, 0x4de3, 0x4238, 0x1c5c, 0x1212, 0x2ab6, 0x09e5,
+	    0x0000, 0x0000, 0x2032, 0x42b0, 0x1d85, 0x1b58, 0x0000, 0x073e,
+	    0x02b4, 0x1d1d, 0x0000, 0x0106, 0x0000, 0x0470, 0x461c, 0x3bd3,
+	    0x0000, 0x0000, 0x0000, 0x0db8, 0x2f20, 0x4b2a, 0x137a, 0x3836,
+	    0x2c50, 0x2c43, 0x0000, 0x0a53, 0x1e1c, 0x0e47, 0x05ad, 0x3eb7,
+	    0x15a0, 0x075f, 0x3fee, 0x3b6e, 0x040c, 0x0000, 0x37cc, 0x0fc3,
+	    0x35fc, 0x022f, 0x07d3, 0x07f3, 0x143f, 0x4417, 0x2326, 0x0000,
+	    0x0c61, 0x2b0b, 0x1036, 0x02f4, 0x0000, 0x2d13, 0x402b, 0x0000,
+	    0x05ae, 0x342a, 0x08ce, 0x3fd1, 0x24b0, 0x3f52, 0x3f6a, 0x0000,
+	    0x0478, 0x0000, 0x4cf0, 0x264f, 0x2276, 0x445d, 0x0000, 0x3d1d,
+	    0x1887, 0x3289, 0x3ef0, 0x0000, 0x047e, 0x3098, 0x49ab, 0x24f6,
+	    0x0928, 0x05d7, 0x1eff, 0x13e1, 0x2e1f, 0x3eeb, 0x2229, 0x0000,
+	    0x1fb0, 0x248d, 0x0655, 0x409b, 0x0cf1, 0x3387, 0x3ad9, 0x330a,
+	    0x0bdc, 0x2567, 0x21d1, 0x35d6, 0x1e94, 0x09f5, 0x33f2, 0x2688,
+	    0x0ea5, 0x0000, 0x0000, 0x1738, 0x1f22, 0x307d, 0x3f30, 0x3319,
+	    0x0000, 0x0cdf, 0x0f73, 0x2ae0, 0x2950, 0x1ec7, 0x3bea, 0x0000,
+	    0x35d3, 0x44fb, 0x193a, 0x2939, 0x35dc, 0x031d, 0x173f, 0x0e0f,
+	    0x0000, 0x0000, 0x0000, 0x14d9, 0x1a8a, 0x0000, 0x0000, 0x1c7d,
+	    0x24c8, 0x1270, 0x0000, 0x41ad, 0x2aa5, 0x47b8, 0x1796, 0x0096,
+	    0x22e9, 0x21e8, 0x0000, 0x0134, 0x3d0c, 0x0000, 0x0000, 0x0000,
+	    0x24c4, 0x45be, 0x0aca, 0x3f0e, 0x472a, 0x4568, 0x1eae, 0x0000,
+	    0x0000, 0x2349, 0x0577, 0x3e58, 0x0000, 0x001f, 0x058f, 0x1e84,
+	    0x4301, 0x168c, 0x0000, 0x0000, 0x3d66, 0x0fa0, 0x49d4, 0x41b9,
+	    0x0000, 0x34a8, 0x1066, 0x4256, 0x08f2, 0x3f98, 0x3f14, 0x0000,
+	    0x2d04, 0x47e4, 0x3890, 0x0000, 0x4606, 0x0000, 0x3d1d, 0x0000,
+	    0x3a5e, 0x43d4, 0x0000, 0x1932, 0x0000, 0x3efc, 0x018c, 0x4007,
+	    0x3216, 0x164e, 0x22a3, 0x2d16, 0x20a8, 0x0000, 0x142e, 0x39ec,
+	    0x2193, 0x0f13, 0x0d08, 0x27a7, 0x0000, 0x3419, 0x0000, 0x3fda,
+	    0x133b, 0x0000, 0x1397, 0x463f, 0x0000, 0x2488, 0x3d8b, 0x3c3c,
+	    0x194f, 0x22fa, 0x329a, 0x375b, 0x0000, 0x1623, 0x117c, 0x0000,
+	    0x125b, 0x0d6f, 0x2257, 0x2258, 0x42ef, 0x0000, 0x0f1a, 0x1668,
+	    0x2fe2, 0x26e5, 0x4ac4, 0x25f5, 0x4c80, 0x0000, 0x0000, 0x0000,
+	    0x2bc4, 0x2b9a, 0x19fe, 0x3783, 0x0000, 0x0b93, 0x3109, 0x3a76,
+	    0x4728, 0x1e0f, 0x3912, 0x0000, 0x0000, 0x3c44, 0x3145, 0x0595,
+	    0x2d6f, 0x04c6, 0x2508, 0x3173, 0x0000, 0x0a79, 0x0000, 0x35e5,
+	    0x4bc1, 0x19a5, 0x0b62, 0x0c73, 0x480a, 0x25bd, 0x0ba7, 0x49a6,
+	    0x1a6c, 0x05e5, 0x2e85, 0x2333, 0x0000, 0x0000, 0x0e3d, 0x4647,
+	    0x0000, 0x28e7, 0x19ad, 0x3d2a, 0x1e37, 0x2966, 0x4964, 0x0000,
+	    0x0268, 0x21bf, 0x0000, 0x4356, 0x2426, 0x0000, 0x1eb2, 0x1544,
+	    0x0000, 0x0000, 0x21ef, 0x0000, 0x41fc, 0x3a39, 0x0000, 0x1aaa,
+	    0x0000, 0x22b6, 0x0000, 0x0ea6, 0x41aa, 0x0b4e, 0x0000, 0x0000,
+	    0x0000, 0x3b83, 0x114c, 0x0000, 0x3192, 0x0000, 0x209b, 0x1c32,
+	    0x0000, 0x23fc, 0x1e89, 0x327c, 0x335b, 0x1d97, 0x0000, 0x0098,
+	    0x0cf4, 0x3f7c, 0x2f6e, 0x3c44, 0x0000, 0x0000, 0x0000, 0x1f5c,
+	    0x4cec, 0x0000, 0x118b, 0x1b68, 0x0000, 0x0014, 0x0000, 0x07f6,
+	    0x0d06, 0x020c, 0x25ce, 0x1006, 0x2f3c, 0x230f, 0x0346, 0x0000,
+	    0x144f, 0x2045, 0x11e5, 0x0b34, 0x4584, 0x490a, 0x32f6, 0x2a70,
+	    0x3200, 0x347f, 0x0000, 0x03cd, 0x1354, 0x12f1, 0x3c50, 0x06a3,
+	    0x32c3, 0x298a, 0x37ef, 0x0a90, 0x2b6d, 0x0000, 0x0000, 0x0000,
+	    0x3bf6, 0x3b4e, 0x21c9, 0x208e, 0x39c2, 0x1128, 0x3405, 0x00af,
+	    0x3b22, 0x0b38, 0x37ae, 0x2fae, 0x35a5, 0x0000, 0x381e, 0x0000,
+	    0x0fe6, 0x277b, 0x0d03, 0x295d, 0x0000, 0x0000, 0x0224, 0x2090,
+	    0x0844, 0x0000, 0x0dfa, 0x0000, 0x47bf, 0x349a, 0x1c40, 0x4cc5,
+	    0x00c0, 0x38e6, 0x25af, 0x3606, 0x0d01, 0x19b7, 0x2794, 0x3d7d,
+	    0x3add, 0x3195, 0x0834, 0x4880, 0x11aa, 0x2146, 0x14ba, 0x0000,
+	    0x4b9f, 0x47c8, 0x0000, 0x26b6, 0x0f4b, 0x0000, 0x0f5a, 0x1d34,
+	    0x2733, 0x4a62, 0x4b08, 0x0000, 0x0196, 0x324a, 0x28de, 0x2592,
+	    0x2dc7, 0x2d30, 0x0405, 0x1085, 0x4d56, 0x0420, 0x0977, 0x1640,
+	    0x0000, 0x0000, 0x4328, 0x0502, 0x376d, 0x2941, 0x422a, 0x304a,
+	    0x1fa6, 0x2942, 0x1051, 0x0000, 0x23aa, 0x33d4, 0x0000, 0x0000,
+	    0x0000, 0x2764, 0x4a28, 0x28b8, 0x0000, 0x094f, 0x12f9, 0x31d2,
+	    0x09af, 0x39b2, 0x36e6, 0x3e35, 0x0a00, 0x417b, 0x1d12, 0x0cb2,
+	    0x0000, 0x40e0, 0x0000, 0x0c24, 0x0e2d, 0x4982, 0x0000, 0x2a06,
+	    0x1a1b, 0x3be7, 0x412d, 0x4385, 0x1a32, 0x4d9e, 0x3238, 0x00ab,
+	    0x422a, 0x2681, 0x093a, 0x4576, 0x058f, 0x0000, 0x033d, 0x1873,
+	    0x4054, 0x4727, 0x0000, 0x3312, 0x3c91, 0x0000, 0x0000, 0x2f21,
+	    0x3ba1, 0x2c1b, 0x49c1, 0x1983, 0x1f5d, 0x173c, 0x1382, 0x3f51,
+	    0x42ee, 0x3653, 0x03d7, 0x0338, 0x0000, 0x0000, 0x086e, 0x3d6e,
+	    0x0000, 0x0000, 0x36dd, 0x250d, 0x0c20, 0x221b, 0x4bc7, 0x3c97,
+	    0x14dd, 0x0162, 0x2f75, 0x48ff, 0x0000, 0x2070, 0x44e7, 0x28b4,
+	    0x0000, 0x10fe, 0x3cb3, 0x13c4, 0x22df, 0x2bf7, 0x0840, 0x1a2e,
+	    0x2c1a, 0x18ce, 0x2dac, 0x3c22, 0x096f, 0x0a3c, 0x0000, 0x22e4,
+	    0x45ed, 0x185f, 0x2dac, 0x32cc, 0x16c8, 0x0ba7, 0x2759, 0x0000,
+	    0x280a, 0x3336, 0x0000, 0x0dbd, 0x1c92, 0x0fc6, 0x0000, 0x2676,
+	    0x25d9, 0x0000, 0x0000, 0x2fa0, 0x31b3, 0x1c8e, 0x2e0e, 0x1280,
+	    0x3d42, 0x2038, 0x1159, 0x3a04, 0x1510, 0x261a, 0x2c3a, 0x0000,
+	    0x44a3, 0x034e, 0x33bd, 0x161b, 0x0291, 0x194c, 0x079b, 0x1b21,
+	    0x0000, 0x0000, 0x49ec, 0x0000, 0x4a01, 0x432c, 0x0000, 0x4d3f,
+	    0x3de7, 0x3c3b, 0x3b1b, 0x0000, 0x231c, 0x0664, 0x0000, 0x3412,
+	    0x2f81, 0x0000, 0x1c7c, 0x0000, 0x47fb, 0x2ab8, 0x3908, 0x0000,
+	    0x3312, 0x3ce1, 0x3244, 0x0b74, 0x123b, 0x0000, 0x1662, 0x490c,
+	    0x370b, 0x0000, 0x1e10, 0x4e06, 0x0b2e, 0x134d, 0x4987, 0x3d1d,
+	    0x0236, 0x17f3, 0x0449, 0x4cfa, 0x2b9a, 0x0000, 0x3ed8, 0x1c23,
+	    0x1ad8, 0x3223, 0x1dfb, 0x3a19, 0x0000, 0x4d9b, 0x0a51, 0x3c8c,
+	    0x3ba4, 0x3fbf, 0x05f8, 0x4b0f, 0x079e, 0x3bba, 0x0e5e, 0x154c,
+	    0x0000, 0x3ef4, 0x34f6, 0x0856, 0x0000, 0x0000, 0x0537, 0x15af,
+	    0x0000, 0x3391, 0x373e, 0x1497, 0x2b94, 0x0000, 0x484d, 0x22e3,
+	    0x0000, 0x0000, 0x0489, 0x3e13, 0x0000, 0x2bae, 0x0c6e, 0x0000,
+	    0x4a81, 0x29bb, 0x3340, 0x0000, 0x39c3, 0x2623, 0x0000, 0x23be,
+	    0x08c0, 0x0000, 0x2a9f, 0x20aa, 0x11ff, 0x0000, 0x2833, 0x237b,
+	    0x1d43, 0x0c6d, 0x2418, 0x2c22, 0x0000, 0x0000, 0x0000, 0x00e5,
+	    0x483f, 0x093c, 0x2711, 0x4b54, 0x21d0, 0x0ee0, 0x1128, 0x446e,
+	    0x0000, 0x0000, 0x0000, 0x01de, 0x4d89, 0x3007, 0x0000, 0x0000,
+	    0x0000, 0x40be, 0x348b, 0x0000, 0x4a34, 0x4c50, 0x0707, 0x4ce9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x41f1, 0x352d, 0x1795, 0x0ac7,
+	    0x274a, 0x2620, 0x2485, 0x2da4, 0x2c04, 0x0000, 0x4247, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x167e, 0x0849, 0x064f, 0x4963, 0x1f11,
+	    0x0000, 0x42f6, 0x06c2, 0x0000, 0x0ed8, 0x33af, 0x3826, 0x0dde,
+	    0x0f12, 0x4492, 0x0fba, 0x0000, 0x0000, 0x0000, 0x0000, 0x2640,
+	    0x0000, 0x0000, 0x24b8, 0x1161, 0x0000, 0x0000, 0x45cb, 0x1a41,
+	    0x078d, 0x321e, 0x3ebd, 0x04d3, 0x112f, 0x1012, 0x45c5, 0x0dcd,
+	    0x4e16, 0x0000, 0x1bc1, 0x0000, 0x0cb4, 0x1426, 0x30a7, 0x0000,
+	    0x150b, 0x0000, 0x2272, 0x4d42, 0x0cd2, 0x12b4, 0x0000, 0x0000,
+	    0x0000, 0x2fe4, 0x0cfb, 0x4b39, 0x0202, 0x0000, 0x0000, 0x1458,
+	    0x0000, 0x42f2, 0x2c43, 0x2891, 0x05ae, 0x4048, 0x456c, 0x0000,
+	    0x2677, 0x4335, 0x1cac, 0x3b6c, 0x448e, 0x29c5, 0x1334, 0x0000,
+	    0x2188, 0x0000, 0x2cc5, 0x35c4, 0x26da, 0x4865, 0x1495, 0x2f2d,
+	    0x12a0, 0x32bd, 0x497c, 0x0000, 0x4248, 0x3eac, 0x0000, 0x4774,
+	    0x0000, 0x0000, 0x0000, 0x2f93, 0x0183, 0x4c66, 0x29cc, 0x0000,
+	    0x3b7b, 0x1a48, 0x3233, 0x1843, 0x4c20, 0x055c, 0x2733, 0x0000,
+	    0x2c1f, 0x2408, 0x1473, 0x2b4d, 0x0000, 0x0413, 0x222c, 0x2e8f,
+	    0x0be9, 0x0000, 0x1889, 0x0c49, 0x08bd, 0x2fd1, 0x366d, 0x2d7e,
+	    0x4cf2, 0x4794, 0x11e8, 0x4b65, 0x1e77, 0x0000, 0x4624, 0x4ba9,
+	    0x06bd, 0x279a, 0x0000, 0x0000, 0x01b8, 0x0000, 0x08d7, 0x2dc7,
+	    0x444d, 0x0000, 0x2869, 0x4239, 0x3ffb, 0x20bd, 0x0000, 0x2234,
+	    0x3e16, 0x28d4, 0x0000, 0x12be, 0x41f2, 0x12a2, 0x235d, 0x1402,
+	    0x1d3a, 0x0157, 0x0949, 0x3ac7, 0x0d9b, 0x0ea5, 0x2c79, 0x4a66,
+	    0x1ce5, 0x26a0, 0x3164, 0x3119, 0x3982, 0x48d5, 0x4c6f, 0x1a1d,
+	    0x0e70, 0x2d84, 0x0000, 0x4c09, 0x0000, 0x3043, 0x0000, 0x398a,
+	    0x327a, 0x06a7, 0x4ae3, 0x1638, 0x2124, 0x41ca, 0x2efc, 0x45d1,
+	    0x0cfd, 0x163c, 0x301f, 0x3906, 0x1d0f, 0x0000, 0x19a4, 0x0000,
+	    0x307c, 0x3260, 0x0ddc, 0x0d9a, 0x448c, 0x224d, 0x0537, 0x0000,
+	    0x3f9f, 0x35ae, 0x02df, 0x1c67, 0x3eb5, 0x0459, 0x4644, 0x2485,
+	    0x0000, 0x33c8, 0x081f, 0x0000, 0x1811, 0x3127, 0x1a40, 0x0032,
+	    0x1d9b, 0x1caa, 0x19fb, 0x0000, 0x0718, 0x4a89, 0x4b80, 0x0d2e,
+	    0x2f44, 0x1561, 0x02ae, 0x2f00, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1129, 0x3e14, 0x15e2, 0x3337, 0x068b, 0x1983, 0x1ccf, 0x35a0,
+	    0x0309, 0x2bdd, 0x20b8, 0x0000, 0x0306, 0x3a77, 0x0cfd, 0x3caf,
+	    0x105d, 0x4432, 0x0ca8, 0x35c7, 0x0939, 0x0000, 0x0000, 0x085a,
+	    0x32c2, 0x4ad4, 0x1e57, 0x41b9, 0x0355, 0x181d, 0x49e8, 0x32ed,
+	    0x1d4e, 0x0000, 0x3b09, 0x25c5, 0x028c, 0x4078, 0x0000, 0x4ac8,
+	    0x3b69, 0x2509, 0x0bbb, 0x3f10, 0x1761, 0x1375, 0x4c79, 0x3ba8,
+	    0x0000, 0x1310, 0x1295, 0x3ed9, 0x0582, 0x0000, 0x0000, 0x2301,
+	    0x1666, 0x0ae8, 0x44d6, 0x120f, 0x0dff, 0x0000, 0x0000, 0x06ab,
+	    0x3d64, 0x4088, 0x2abe, 0x49fc, 0x0000, 0x0dbf, 0x0000, 0x0000,
+	    0x2c7b, 0x0f0f, 0x3f8c, 0x1948, 0x488b, 0x3243, 0x2c5d, 0x0000,
+	    0x3918, 0x13be, 0x0000, 0x0000, 0x3110, 0x4b1e, 0x40f1, 0x36b9,
+	    0x1d4a, 0x0000, 0x3a9f, 0x0ff1, 0x33aa, 0x2de7, 0x4553, 0x0000,
+	    0x0000, 0x0000, 0x2f8d, 0x391c, 0x227f, 0x12eb, 0x3f8c, 0x206f,
+	    0x3276, 0x433c, 0x3cf9, 0x0000, 0x1870, 0x0000, 0x2c87, 0x432c,
+	    0x0f3f, 0x0000, 0x0000, 0x43c3, 0x2c07, 0x3798, 0x0000, 0x1f14,
+	    0x0f20, 0x0304, 0x1702, 0x2838, 0x13e9, 0x295e, 0x3d7f, 0x4d51,
+	    0x2090, 0x252c, 0x2906, 0x1e13, 0x0362, 0x0e80, 0x451b, 0x4793,
+	    0x0000, 0x2c5c, 0x2135, 0x1b76, 0x3de1, 0x0000, 0x2db0, 0x1b37,
+	    0x3585, 0x0f12, 0x4aba, 0x1083, 0x0000, 0x0000, 0x0000, 0x47b3,
+	    0x1afc, 0x0e69, 0x150c, 0x4784, 0x4379, 0x0a71, 0x493a, 0x0481,
+	    0x0000, 0x14f1, 0x4d27, 0x0951, 0x0000, 0x4673, 0x0000, 0x0000,
+	    0x0000, 0x0da6, 0x0a1a, 0x0aea, 0x0289, 0x0c51, 0x0000, 0x463c,
+	    0x0000, 0x0000, 0x3882, 0x4031, 0x166b, 0x179f, 0x1e04, 0x15b7,
+	    0x0d03, 0x1804, 0x3eb4, 0x0149, 0x2fdb, 0x4c12, 0x091f, 0x1411,
+	    0x0000, 0x11a5, 0x0000, 0x0000, 0x28e1, 0x4bd5, 0x2dea, 0x158c,
+	    0x18d5, 0x4ce1, 0x14c3, 0x4812, 0x401e, 0x0000, 0x0000, 0x0000,
+	    0x06cf, 0x1550, 0x1fa4, 0x0000, 0x1117, 0x1ab4, 0x1ef0, 0x0000,
+	    0x1b14, 0x36ff, 0x1caf, 0x088b, 0x0000, 0x4121, 0x36de, 0x426a,
+	    0x00d6, 0x15bf, 0x319c, 0x2203, 0x2b11, 0x046f, 0x1d06, 0x0c3f,
+	    0x0000, 0x3c75, 0x4cb8, 0x3824, 0x3bed, 0x1668, 0x09b6, 0x4d46,
+	    0x2ab2, 0x1cbd, 0x0000, 0x47bd, 0x3cc2, 0x0cc5, 0x0000, 0x0000,
+	    0x0000, 0x1e5f, 0x36c4, 0x4124, 0x4266, 0x460f, 0x31f3, 0x2311,
+	    0x4d6a, 0x3fb3, 0x3870, 0x092a, 0x2395, 0x2379, 0x3c81, 0x0000,
+	    0x0000, 0x4648, 0x0000, 0x3820, 0x2276, 0x21bf, 0x36d8, 0x1172,
+	    0x4686, 0x0000, 0x48eb, 0x440c, 0x0000, 0x3fb2, 0x0da2, 0x0acd,
+	    0x396e, 0x0000, 0x2b6f, 0x0000, 0x0000, 0x0000, 0x21b5, 0x0000,
+	    0x066e, 0x21a6, 0x2713, 0x189d, 0x38ed, 0x39c9, 0x1d32, 0x193f,
+	    0x24c2, 0x09ef, 0x243e, 0x2401, 0x3e76, 0x49f6, 0x3ec1, 0x4550,
+	    0x0000, 0x0000, 0x2f61, 0x0ebf, 0x0000, 0x0ae8, 0x3c34, 0x35bf,
+	    0x1795, 0x29f5, 0x063b, 0x092a, 0x35dd, 0x4434, 0x20d3, 0x347a,
+	    0x0000, 0x0000, 0x484e, 0x3055, 0x3dc1, 0x4892, 0x4a31, 0x2a7a,
+	    0x0a1e, 0x0000, 0x28d9, 0x3a41, 0x054c, 0x399c, 0x0c67, 0x40f0,
+	    0x3fff, 0x49e1, 0x0000, 0x0000, 0x442e, 0x0000, 0x4438, 0x0000,
+	    0x488c, 0x0000, 0x0000, 0x0000, 0x0905, 0x40d2, 0x0000, 0x3da1,
+	    0x4399, 0x28db, 0x4bb5, 0x0000, 0x0000, 0x4cc6, 0x0489, 0x00d2,
+	    0x223b, 0x0fea, 0x4b92, 0x0000, 0x18a3, 0x1060, 0x1911, 0x4d33,
+	    0x0000, 0x3ede, 0x351d, 0x4b37, 0x365f, 0x0000, 0x409a, 0x1798,
+	    0x0000, 0x1f37, 0x3535, 0x27a0, 0x1aeb, 0x1dfd, 0x0467, 0x2748,
+	    0x3ae1, 0x288c, 0x328d, 0x1b8d, 0x251c, 0x0ac7, 0x0000, 0x3c94,
+	    0x1f21, 0x26c2, 0x0000, 0x3682, 0x30ec, 0x4c60, 0x0000, 0x3ba5,
+	    0x021f, 0x2bf1, 0x448a, 0x3e68, 0x0000, 0x4a86, 0x0000, 0x39ec,
+	    0x0000, 0x4dce, 0x483f, 0x043d, 0x0000, 0x3011, 0x4050, 0x06d2,
+	    0x4b7f, 0x4239, 0x2968, 0x0000, 0x475a, 0x4128, 0x2d6a, 0x37dd,
+	    0x4767, 0x3e99, 0x0000, 0x0000, 0x0000, 0x2786, 0x4e17, 0x0000,
+	    0x4e1f, 0x43a8, 0x08d5, 0x2ef6, 0x4c3c, 0x22b0, 0x2315, 0x1136,
+	    0x0000, 0x0dcf, 0x0000, 0x12f7, 0x0000, 0x2c90, 0x100d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x08bd, 0x2e61, 0x0000, 0x0000,
+	    0x0265, 0x0d5d, 0x1ff7, 0x11e4, 0x2a19, 0x38c5, 0x42da, 0x0558,
+	    0x0000, 0x2331, 0x0000, 0x0000, 0x2142, 0x0d21, 0x3493, 0x127c,
+	    0x48f6, 0x373d, 0x01a6, 0x1b3a, 0x0000, 0x1907, 0x0641, 0x372f,
+	    0x0000, 0x2539, 0x09ee, 0x0e7b, 0x07f9, 0x4c8f, 0x0000, 0x0853,
+	    0x258a, 0x39a4, 0x2b8d, 0x35e8, 0x0875, 0x3d53, 0x41c2, 0x0000,
+	    0x4905, 0x2349, 0x089f, 0x1cba, 0x12cc, 0x2acc, 0x0000, 0x4d22,
+	    0x20dc, 0x0000, 0x0307, 0x1fd2, 0x18d1, 0x3db5, 0x183f, 0x0000,
+	    0x0000, 0x0000, 0x3e21, 0x41af, 0x435a, 0x1d22, 0x0bf1, 0x0000,
+	    0x3319, 0x4442, 0x0000, 0x0bcd, 0x47cd, 0x0000, 0x1418, 0x0f5c,
+	    0x238b, 0x4cce, 0x2a51, 0x0000, 0x297e, 0x3d70, 0x2737, 0x4b27,
+	    0x36d6, 0x10a8, 0x0608, 0x0000, 0x1ab7, 0x4927, 0x2eca, 0x0000,
+	    0x3012, 0x48f1, 0x3430, 0x4b9a, 0x3fe8, 0x491e, 0x2061, 0x0000,
+	    0x0000, 0x2606, 0x363f, 0x053a, 0x0000, 0x183c, 0x0000, 0x0000,
+	    0x21e6, 0x3476, 0x0000, 0x496e, 0x0000, 0x02cc, 0x0792, 0x0931,
+	    0x2522, 0x0000, 0x10fa, 0x385c, 0x2754, 0x0595, 0x2f8e, 0x424d,
+	    0x4a5e, 0x2f80, 0x1133, 0x32f1, 0x3c19, 0x0000, 0x0000, 0x0000,
+	    0x37dc, 0x3c10, 0x136d, 0x0000, 0x152c, 0x0000, 0x02d7, 0x2382,
+	    0x3509, 0x4b0d, 0x0000, 0x2e62, 0x4352, 0x0421, 0x24ce, 0x2534,
+	    0x281a, 0x417a, 0x4789, 0x2dcd, 0x11eb, 0x27f6, 0x1ce9, 0x2eb8,
+	    0x19f9, 0x0180, 0x0000, 0x0000, 0x187f, 0x0000, 0x373c, 0x1571,
+	    0x0000, 0x0158, 0x254b, 0x0000, 0x28ae, 0x3812, 0x033b, 0x227c,
+	    0x0a65, 0x0000, 0x01f1, 0x0000, 0x46fc, 0x03db, 0x4a01, 0x0000,
+	    0x0e24, 0x4978, 0x2fb2, 0x0000, 0x0e42, 0x2b72, 0x0000, 0x1f06,
+	    0x19d4, 0x2bff, 0x2f8c, 0x14b5, 0x4803, 0x33e3, 0x0000, 0x3e6b,
+	    0x0000, 0x4880, 0x1941, 0x38b2, 0x1ca1, 0x338f, 0x3d0b, 0x0b1d,
+	    0x155e, 0x05b4, 0x1445, 0x0000, 0x0000, 0x2318, 0x31bc, 0x46a2,
+	    0x052a, 0x0000, 0x2275, 0x3923, 0x0457, 0x3347, 0x0f58, 0x0000,
+	    0x2a69, 0x2466, 0x3c4e, 0x10c3, 0x36fc, 0x4b0b, 0x2e58, 0x0897,
+	    0x0000, 0x3acb, 0x48b4, 0x1bda, 0x1c11, 0x4a43, 0x1b8c, 0x16c9,
+	    0x0000, 0x333c, 0x2776, 0x0000, 0x0000, 0x1f09, 0x0ba9, 0x0000,
+	    0x0028, 0x3c77, 0x032b, 0x0ad6, 0x0978, 0x4bb1, 0x2393, 0x180a,
+	    0x1af8, 0x3537, 0x1851, 0x0000, 0x047a, 0x2932, 0x2c3a, 0x0000,
+	    0x0520, 0x3363, 0x3faf, 0x0000, 0x0c08, 0x0000, 0x0000, 0x257c,
+	    0x12a1, 0x0000, 0x1da7, 0x06b4, 0x23db, 0x485a, 0x2852, 0x0000,
+	    0x174f, 0x22b5, 0x0000, 0x4661, 0x2af0, 0x0000, 0x0000, 0x0000,
+	    0x2002, 0x0828, 0x40b0, 0x0000, 0x084c, 0x2d57, 0x0af5, 0x01e5,
+	    0x0000, 0x2d91, 0x1cca, 0x4b71, 0x1d60, 0x20a4, 0x0000, 0x4904,
+	    0x0000, 0x2696, 0x3d1f, 0x1370, 0x10ff, 0x0000, 0x4089, 0x4819,
+	    0x4d4f, 0x2933, 0x0000, 0x0000, 0x0000, 0x4340, 0x3c4c, 0x0bb0,
+	    0x0e12, 0x03f3, 0x318c, 0x089a, 0x4c99, 0x2f28, 0x2f4f, 0x0200,
+	    0x469b, 0x006a, 0x3f43, 0x08e5, 0x0ffd, 0x2ea4, 0x1b78, 0x3508,
+	    0x465d, 0x0000, 0x0000, 0x1be6, 0x0a0a, 0x2c62, 0x0d08, 0x083f,
+	    0x22ac, 0x15aa, 0x1b15, 0x3d5c, 0x05f5, 0x0000, 0x0484, 0x1992,
+	    0x1e91, 0x1e8f, 0x0766, 0x012e, 0x4050, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3cd6, 0x4d78, 0x2fea, 0x35e6, 0x357b,
+	    0x2247, 0x33fe, 0x0000, 0x32ef, 0x393e, 0x2b69, 0x3660, 0x3fe5,
+	    0x0675, 0x089f, 0x0000, 0x3843, 0x067d, 0x3a2b, 0x4198, 0x0000,
+	    0x03cd, 0x253c, 0x2f88, 0x0000, 0x1f39, 0x0100, 0x21fd, 0x347d,
+	    0x3033, 0x4150, 0x3a9c, 0x2426, 0x3844, 0x38bf, 0x2cbd, 0x3792,
+	    0x30b8, 0x4933, 0x2473, 0x2749, 0x4bfb, 0x0b18, 0x2beb, 0x1475,
+	    0x2857, 0x3200, 0x4c9c, 0x4057, 0x1321, 0x45c4, 0x15ad, 0x0a9d,
+	    0x218d, 0x2352, 0x4d4a, 0x2178, 0x0000, 0x2a21, 0x26c7, 0x0000,
+	    0x4b28, 0x38c3, 0x1d40, 0x0000, 0x0c9f, 0x0000, 0x3a5c, 0x2e2d,
+	    0x3edd, 0x155f, 0x261a, 0x1520, 0x4df5, 0x31fe, 0x4c91, 0x2852,
+	    0x0000, 0x000e, 0x3ed4, 0x4904, 0x2c0a, 0x455e, 0x1aca, 0x0000,
+	    0x311c, 0x0c7d, 0x4b62, 0x0000, 0x1ff7, 0x32ae, 0x0000, 0x12ba,
+	    0x03af, 0x462d, 0x2170, 0x0000, 0x099a, 0x4918, 0x29c7, 0x4675,
+	    0x475c, 0x3f18, 0x35de, 0x0000, 0x3bf9, 0x0000, 0x3619, 0x0000,
+	    0x32c6, 0x117e, 0x3545, 0x0000, 0x0000, 0x4be5, 0x45ae, 0x10c9,
+	    0x0000, 0x191c, 0x155c, 0x08dc, 0x4721, 0x2424, 0x0000, 0x45d0,
+	    0x0fed, 0x2129, 0x0000, 0x0000, 0x2c7b, 0x2994, 0x0089, 0x450c,
+	    0x0000, 0x2468, 0x2e82, 0x0000, 0x3dba, 0x0000, 0x0f16, 0x02d4,
+	    0x34de, 0x3486, 0x32b4, 0x100c, 0x4d85, 0x1902, 0x3555, 0x004d,
+	    0x14c0, 0x0000, 0x39c7, 0x4cc7, 0x1afa, 0x1a8a, 0x072e, 0x2915,
+	    0x0000, 0x3c62, 0x08ca, 0x4692, 0x3391, 0x0000, 0x3ee9, 0x4ac3,
+	    0x37fe, 0x2138, 0x0000, 0x1cdf, 0x2c61, 0x43c8, 0x084d, 0x44db,
+	    0x10c8, 0x17f2, 0x2a27, 0x187e, 0x4216, 0x059e, 0x3544, 0x0000,
+	    0x3970, 0x4569, 0x0c06, 0x2d39, 0x0a98, 0x0000, 0x15df, 0x1e56,
+	    0x161b, 0x474b, 0x1019, 0x3afe, 0x4ae1, 0x4276, 0x1885, 0x1f6e,
+	    0x35c5, 0x2dcf, 0x4d73, 0x418c, 0x0000, 0x0000, 0x2e04, 0x0000,
+	    0x3a34, 0x2384, 0x1879, 0x1e61, 0x14ec, 0x4a6e, 0x0c7e, 0x3c58,
+	    0x2580, 0x18b9, 0x0f41, 0x08e8, 0x4b52, 0x26a9, 0x0000, 0x3fca,
+	    0x1f92, 0x11d8, 0x2899, 0x0000, 0x0000, 0x0e85, 0x413e, 0x17d4,
+	    0x0000, 0x1a13, 0x0000, 0x4d53, 0x23fe, 0x2a9f, 0x0000, 0x44eb,
+	    0x2640, 0x3295, 0x1a46, 0x0260, 0x07ca, 0x0000, 0x013d, 0x1341,
+	    0x1dc8, 0x0000, 0x003b, 0x4271, 0x3e96, 0x0000, 0x3a94, 0x2cbc,
+	    0x0000, 0x0e00, 0x0000, 0x38a4, 0x302c, 0x4b09, 0x0000, 0x4331,
+	    0x3fd9, 0x3144, 0x0a79, 0x0000, 0x0000, 0x0a96, 0x4cf2, 0x28a1,
+	    0x0000, 0x1bc1, 0x0000, 0x4539, 0x03eb, 0x0ccf, 0x3bbf, 0x10c8,
+	    0x414b, 0x0cc8, 0x263e, 0x0000, 0x108c, 0x1639, 0x44cd, 0x10c4,
+	    0x056d, 0x2f58, 0x14d6, 0x0000, 0x3a48, 0x208d, 0x0000, 0x0000,
+	    0x3613, 0x2eb6, 0x1631, 0x19fc, 0x1c19, 0x4150, 0x1541, 0x3a27,
+	    0x268e, 0x352a, 0x0000, 0x2a41, 0x0000, 0x18ed, 0x34f1, 0x0156,
+	    0x2403, 0x2b9c, 0x315b, 0x0000, 0x26d9, 0x4ba5, 0x27e1, 0x0000,
+	    0x09f3, 0x0641, 0x0dc4, 0x2048, 0x0000, 0x1069, 0x247a, 0x0000,
+	    0x2279, 0x3c04, 0x3d87, 0x3500, 0x0000, 0x38f3, 0x2313, 0x0000,
+	    0x0000, 0x38ec, 0x3a52, 0x190d, 0x4acb, 0x306c, 0x1954, 0x270e,
+	    0x0000, 0x1ced, 0x2ba8, 0x3538, 0x2121, 0x12ff, 0x2b3d, 0x03d8,
+	    0x2924, 0x0000, 0x0c71, 0x479c, 0x0d2c, 0x4e09, 0x0000, 0x17f1,
+	    0x0000, 0x4c9f, 0x41d1, 0x0000, 0x3b02, 0x0000, 0x154b, 0x0000,
+	    0x013a, 0x46d0, 0x0000, 0x3136, 0x37d8, 0x3d0b, 0x2478, 0x4029,
+	    0x2c40, 0x0000, 0x2ba9, 0x0000, 0x0000, 0x0962, 0x391d, 0x0e46,
+	    0x38d1, 0x0000, 0x0c64, 0x05cd, 0x388c, 0x2aa8, 0x2d1a, 0x24c0,
+	    0x2ae2, 0x0000, 0x040a, 0x184a, 0x0000, 0x49ea, 0x1ea4, 0x435f,
+	    0x2b2c, 0x47f6, 0x1dca, 0x0b4a, 0x0000, 0x23c9, 0x0000, 0x3564,
+	    0x05ea, 0x2d5f, 0x3f1a, 0x2bad, 0x0f52, 0x0000, 0x1dc2, 0x1f61,
+	    0x375d, 0x0b67, 0x0000, 0x4266, 0x2ae5, 0x0687, 0x2786, 0x3dbc,
+	    0x19fc, 0x0000, 0x0000, 0x476e, 0x0000, 0x1103, 0x39a1, 0x06c0,
+	    0x1d95, 0x1226, 0x0000, 0x10fc, 0x0000, 0x44ad, 0x0000, 0x1096,
+	    0x0445, 0x0f1f, 0x463d, 0x2434, 0x2693, 0x3a2a, 0x250d, 0x0000,
+	    0x22f1, 0x383a, 0x3ce9, 0x1363, 0x3eb5, 0x0ead, 0x0000, 0x0000,
+	    0x1c38, 0x08af, 0x312e, 0x21df, 0x3620, 0x130d, 0x0000, 0x4ade,
+	    0x203b, 0x0000, 0x4a4a, 0x2c46, 0x26f0, 0x0000, 0x3f14, 0x1801,
+	    0x06be, 0x3594, 0x49b5, 0x42e3, 0x0bce, 0x0c7b, 0x3646, 0x2656,
+	    0x230e, 0x2033, 0x3a53, 0x486e, 0x1c48, 0x2bd1, 0x0e6d, 0x3f65,
+	    0x1ea7, 0x0000, 0x0000, 0x2a58, 0x0000, 0x47ed, 0x0000, 0x14d3,
+	    0x239a, 0x4894, 0x0000, 0x08cc, 0x4b05, 0x3eff, 0x0000, 0x370d,
+	    0x3dcb, 0x0147, 0x17f6, 0x13bf, 0x1425, 0x0000, 0x01e5, 0x198e,
+	    0x0000, 0x259e, 0x3af6, 0x15ae, 0x3c0d, 0x0000, 0x3f49, 0x334a,
+	    0x3be1, 0x4c37, 0x0000, 0x0000, 0x0000, 0x072b, 0x087e, 0x2c5d,
+	    0x0a96, 0x0000, 0x3e49, 0x0000, 0x0000, 0x3fae, 0x0000, 0x0000,
+	    0x1fd3, 0x256a, 0x2816, 0x0000, 0x0000, 0x1bde, 0x1522, 0x021b,
+	    0x0000, 0x0000, 0x09b8, 0x4899, 0x0469, 0x373a, 0x213c, 0x0000,
+	    0x0000, 0x0000, 0x0230, 0x363e, 0x2d66, 0x3af3, 0x1264, 0x0c1e,
+	    0x4bdf, 0x0000, 0x372c, 0x414f, 0x3d45, 0x4cf9, 0x200b, 0x2fda,
+	    0x34c3, 0x0000, 0x0000, 0x0000, 0x3239, 0x3033, 0x1560, 0x2bdf,
+	    0x3315, 0x0000, 0x45ab, 0x0000, 0x46c8, 0x208c, 0x2755, 0x08d1,
+	    0x1855, 0x487f, 0x2cb0, 0x379e, 0x4d46, 0x0485, 0x08cc, 0x0000,
+	    0x3e4d, 0x0000, 0x0000, 0x3f91, 0x02aa, 0x227d, 0x0218, 0x0000,
+	    0x2f04, 0x29bc, 0x3149, 0x3883, 0x0000, 0x39b6, 0x4cf4, 0x1178,
+	    0x2f99, 0x3c9b, 0x0000, 0x3180, 0x354b, 0x0a0b, 0x09e4, 0x1a0c,
+	    0x2a88, 0x0ee0, 0x3a50, 0x1d5b, 0x4805, 0x3019, 0x34a1, 0x1eb1,
+	    0x1928, 0x28d5, 0x4cc2, 0x4a66, 0x0000, 0x35d4, 0x4869, 0x17c6,
+	    0x453e, 0x42f8, 0x2522, 0x1dbb, 0x4489, 0x09f8, 0x00e4, 0x3304,
+	    0x3c56, 0x03c1, 0x1012, 0x448b, 0x12dc, 0x2b1a, 0x0ad0, 0x0000,
+	    0x4cef, 0x0259, 0x1ae3, 0x317d, 0x1477, 0x0190, 0x4cf1, 0x06c5,
+	    0x48af, 0x3b34, 0x321a, 0x17bf, 0x0df9, 0x39dd, 0x171e, 0x0c8b,
+	    0x405f, 0x0ccf, 0x0000, 0x0067, 0x1e41, 0x0000, 0x0000, 0x0000,
+	    0x06d9, 0x2d47, 0x1ff0, 0x0000, 0x3312, 0x4b72, 0x0000, 0x2385,
+	    0x1f2f, 0x0000, 0x46eb, 0x3c89, 0x1bf0, 0x0000, 0x0000, 0x461e,
+	    0x1619, 0x066b, 0x1e65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0366,
+	    0x1301, 0x3724, 0x0000, 0x3fcc, 0x0000, 0x33f8, 0x14e3, 0x2cbf,
+	    0x0000, 0x44b9, 0x25fd, 0x0000, 0x4c82, 0x2735, 0x4b80, 0x0000,
+	    0x34f8, 0x46e9, 0x0000, 0x3196, 0x0000, 0x1e24, 0x2497, 0x39d4,
+	    0x03df, 0x1b75, 0x4614, 0x2869, 0x2b58, 0x15d6, 0x0000, 0x1c74,
+	    0x0c06, 0x1bb6, 0x4c29, 0x1ea9, 0x015e, 0x123d, 0x0000, 0x4cf9,
+	    0x0000, 0x2dfd, 0x0000, 0x196b, 0x0000, 0x1a80, 0x35ae, 0x0f4b,
+	    0x0000, 0x01ec, 0x382c, 0x499f, 0x4a88, 0x0000, 0x0000, 0x019b,
+	    0x0000, 0x2586, 0x369f, 0x13a6, 0x4902, 0x3359, 0x0000, 0x2326,
+	    0x3194, 0x0000, 0x3714, 0x0f06, 0x0ef2, 0x3389, 0x17c5, 0x4839,
+	    0x0000, 0x0000, 0x14d6, 0x2f3c, 0x0000, 0x0008, 0x232c, 0x0954,
+	    0x391e, 0x1600, 0x0000, 0x3fa9, 0x0bd6, 0x302b, 0x15ae, 0x0c7f,
+	    0x0992, 0x0ac0, 0x2a6f, 0x103c, 0x1ce7, 0x10f7, 0x1927, 0x41d3,
+	    0x3336, 0x1f33, 0x3cd4, 0x231e, 0x26ee, 0x18d3, 0x30ae, 0x4003,
+	    0x3bcb, 0x0cc9, 0x1cbe, 0x263b, 0x0000, 0x0fc8, 0x043f, 0x0000,
+	    0x1f96, 0x0000, 0x0000, 0x0000, 0x21d2, 0x3a43, 0x0000, 0x35cc,
+	    0x1697, 0x1f19, 0x2d52, 0x23e6, 0x29d6, 0x1289, 0x18b7, 0x198c,
+	    0x09c9, 0x0000, 0x05d6, 0x0000, 0x0000, 0x0000, 0x1583, 0x2eae,
+	    0x175d, 0x0000, 0x2669, 0x015b, 0x0000, 0x1621, 0x45c9, 0x0000,
+	    0x0000, 0x0f62, 0x4af9, 0x0739, 0x3f9c, 0x02fd, 0x0816, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x18cc, 0x1f41, 0x4cbc, 0x0000, 0x0000,
+	    0x0000, 0x0928, 0x2cba, 0x34d1, 0x0510, 0x1eaf, 0x3578, 0x0000,
+	    0x3e36, 0x0a55, 0x318d, 0x0000, 0x36f2, 0x23d0, 0x2e7e, 0x1b1d,
+	    0x397d, 0x2195, 0x3c67, 0x1a70, 0x40ec, 0x0000, 0x006a, 0x0000,
+	    0x0d9e, 0x1249, 0x0000, 0x0000, 0x2204, 0x0000, 0x0000, 0x3b12,
+	    0x07e6, 0x3b8a, 0x0000, 0x22a4, 0x0000, 0x0a8e, 0x0000, 0x0000,
+	    0x0000, 0x3eca, 0x1bf3, 0x06be, 0x0000, 0x0f54, 0x31bc, 0x498b,
+	    0x4157, 0x2ba8, 0x05e3, 0x0000, 0x4a3c, 0x4d13, 0x0000, 0x0000,
+	    0x23b0, 0x0000, 0x09ca, 0x0000, 0x1d5b, 0x11b8, 0x26cc, 0x0000,
+	    0x28a0, 0x43e8, 0x4cfc, 0x3e2c, 0x0000, 0x0000, 0x194b, 0x3b14,
+	    0x0000, 0x2f5b, 0x3c95, 0x0000, 0x38a1, 0x1e3f, 0x403a, 0x0000,
+	    0x24ff, 0x45dc, 0x0000, 0x0000, 0x0000, 0x0fc0, 0x4970, 0x0d6d,
+	    0x0869, 0x4dcb, 0x0141, 0x3e1a, 0x15aa, 0x1cab, 0x2982, 0x3555,
+	    0x0ccc, 0x0000, 0x3f9b, 0x39eb, 0x0ab9, 0x410d, 0x19f2, 0x0c26,
+	    0x181c, 0x09c5, 0x0000, 0x34c2, 0x4c8a, 0x3c30, 0x031e, 0x0000,
+	    0x0000, 0x4831, 0x0000, 0x0994, 0x3995, 0x3dde, 0x2d44, 0x0000,
+	    0x0375, 0x255c, 0x0f0a, 0x2ed4, 0x4aae, 0x0000, 0x0000, 0x2fcb,
+	    0x4677, 0x061e, 0x2f1a, 0x4778, 0x16a4, 0x0000, 0x0000, 0x1357,
+	    0x02ce, 0x2434, 0x0000, 0x2127, 0x12b7, 0x4968, 0x21be, 0x248b,
+	    0x3997, 0x4122, 0x0e30, 0x494f, 0x2d7d, 0x475a, 0x1485, 0x3fd7,
+	    0x0000, 0x2da8, 0x3dcb, 0x1f53, 0x4b80, 0x4ce2, 0x11a5, 0x3427,
+	    0x4dd6, 0x4da5, 0x3813, 0x35aa, 0x0000, 0x2e16, 0x0000, 0x0a01,
+	    0x11a2, 0x0000, 0x03e9, 0x05d1, 0x20c5, 0x1be9, 0x34cb, 0x1ee7,
+	    0x0751, 0x0000, 0x2551, 0x37a2, 0x4ca3, 0x2deb, 0x1e21, 0x0000,
+	    0x10fa, 0x0000, 0x1f8b, 0x0000, 0x2deb, 0x03ea, 0x0dd9, 0x20f9,
+	    0x3ddf, 0x0000, 0x2f90, 0x4cf6, 0x1cf3, 0x0000, 0x2518, 0x0374,
+	    0x0000, 0x3bce, 0x49d1, 0x4aa3, 0x1e73, 0x0000, 0x0403, 0x4386,
+	    0x2044, 0x0000, 0x0000, 0x3223, 0x3c39, 0x45ff, 0x0f42, 0x1674,
+	    0x0178, 0x3312, 0x0000, 0x20db, 0x2d7b, 0x00f0, 0x4741, 0x1394,
+	    0x2372, 0x441a, 0x2b0e, 0x1ccf, 0x0000, 0x3328, 0x0fd9, 0x33d8,
+	    0x315c, 0x0d37, 0x1347, 0x3797, 0x3a15, 0x1d6e, 0x1100, 0x278f,
+	    0x138b, 0x1b5c, 0x006f, 0x36f4, 0x2802, 0x37a0, 0x0000, 0x1ee7,
+	    0x0000, 0x40ae, 0x4461, 0x26b5, 0x0000, 0x2943, 0x3853, 0x2e22,
+	    0x1b63, 0x4d01, 0x1b4a, 0x448f, 0x0b3f, 0x08c4, 0x0b76, 0x1139,
+	    0x382c, 0x3b64, 0x0000, 0x0000, 0x16db, 0x0000, 0x0e41, 0x0000,
+	    0x21eb, 0x20c9, 0x0160, 0x4a86, 0x0000, 0x3871, 0x2fe2, 0x0000,
+	    0x0000, 0x0000, 0x0ab4, 0x18fe, 0x0000, 0x303a, 0x4d08, 0x0000,
+	    0x3a16, 0x0000, 0x075c, 0x1429, 0x05e3, 0x16ea, 0x4a88, 0x0056,
+	    0x0000, 0x15ba, 0x0000, 0x31a7, 0x3a82, 0x0000, 0x0000, 0x0000,
+	    0x2760, 0x4d1b, 0x20c9, 0x0000, 0x0000, 0x0000, 0x437f, 0x31d7,
+	    0x1b46, 0x1ec4, 0x0000, 0x3fd6, 0x3b3b, 0x1260, 0x4025, 0x4726,
+	    0x3b6e, 0x3b05, 0x0000, 0x2589, 0x3381, 0x16ff, 0x382a, 0x27bc,
+	    0x4897, 0x3ddd, 0x2edf, 0x0bfd, 0x0000, 0x0000, 0x0432, 0x4a4c,
+	    0x11e5, 0x23cf, 0x3d7f, 0x2d56, 0x0000, 0x3492, 0x11de, 0x38d3,
+	    0x312e, 0x0000, 0x0000, 0x1362, 0x3b0f, 0x1005, 0x0525, 0x1da4,
+	    0x2b88, 0x09f0, 0x0000, 0x05b6, 0x4853, 0x1b7b, 0x2f2e, 0x0000,
+	    0x444c, 0x2427, 0x0897, 0x1372, 0x05fe, 0x3338, 0x228b, 0x1147,
+	    0x48ba, 0x2c92, 0x48b2, 0x0000, 0x0000, 0x0000, 0x085a, 0x384b,
+	    0x23a9, 0x0000, 0x3f20, 0x0995, 0x301e, 0x0000, 0x3119, 0x0000,
+	    0x29c3, 0x4b33, 0x1590, 0x2fc6, 0x1bcc, 0x1e31, 0x0000, 0x3087,
+	    0x0e7d, 0x37e8, 0x0b86, 0x4933, 0x218e, 0x2c95, 0x2702, 0x2dbf,
+	    0x2fcd, 0x15fa, 0x262f, 0x066c, 0x0000, 0x21e0, 0x16d0, 0x14a4,
+	    0x0bd4, 0x2c1b, 0x23a2, 0x07ff, 0x016b, 0x42e8, 0x2b09, 0x4485,
+	    0x1c2b, 0x375f, 0x2d34, 0x1f79, 0x0000, 0x0000, 0x05b1, 0x1b93,
+	    0x1c12, 0x44c2, 0x1e5e, 0x3e96, 0x0a8d, 0x3ec9, 0x2010, 0x4db4,
+	    0x494f, 0x0a4d, 0x055a, 0x4219, 0x42ec, 0x0941, 0x0000, 0x3046,
+	    0x0000, 0x2715, 0x41cc, 0x113c, 0x0c14, 0x4ad8, 0x11fd, 0x06ac,
+	    0x1a20, 0x0718, 0x001e, 0x3978, 0x0000, 0x0000, 0x421e, 0x43e3,
+	    0x2c8d, 0x3a6b, 0x0cdb, 0x311c, 0x4104, 0x3b49, 0x3445, 0x2f8b,
+	    0x0000, 0x0000, 0x0000, 0x44eb, 0x0ec2, 0x3fba, 0x2ce4, 0x23b3,
+	    0x0000, 0x4d0b, 0x1800, 0x42d2, 0x3597, 0x0a21, 0x0000, 0x1b6d,
+	    0x3888, 0x4ce1, 0x338e, 0x4d64, 0x4dc0, 0x4d2f, 0x4614, 0x4bcb,
+	    0x1024, 0x1aa8, 0x0007, 0x0000, 0x0000, 0x0000, 0x3d0e, 0x05f0,
+	    0x0bfd, 0x023f, 0x3b64, 0x03cb, 0x2126, 0x0000, 0x0c92, 0x33b1,
+	    0x1602, 0x4de2, 0x4934, 0x4bb0, 0x22fc, 0x0ea1, 0x1227, 0x085c,
+	    0x1437, 0x1e4c, 0x0000, 0x3a2c, 0x2077, 0x3e26, 0x3841, 0x0000,
+	    0x0000, 0x0298, 0x0183, 0x0000, 0x3028, 0x0000, 0x4d9a, 0x3a24,
+	    0x3b69, 0x4007, 0x0786, 0x0000, 0x0000, 0x4d5b, 0x0000, 0x3c00,
+	    0x4570, 0x3778, 0x1640, 0x07f0, 0x0000, 0x4bca, 0x0000, 0x39af,
+	    0x3a41, 0x0000, 0x498e, 0x12ea, 0x3da2, 0x034d, 0x3acf, 0x11f4,
+	    0x115e, 0x369a, 0x0e57, 0x135a, 0x17c8, 0x135e, 0x0000, 0x0000,
+	    0x2232, 0x1a56, 0x294e, 0x0ef6, 0x0ba9, 0x0000, 0x0000, 0x0adb,
+	    0x4d10, 0x0000, 0x19df, 0x2ca4, 0x0c30, 0x3a6c, 0x15a1, 0x0401,
+	    0x2a93, 0x0000, 0x0000, 0x40ea, 0x3ef8, 0x4002, 0x3f0b, 0x0328,
+	    0x29df, 0x0000, 0x24ff, 0x3500, 0x0000, 0x0000, 0x47c8, 0x1a19,
+	    0x0000, 0x0000, 0x2392, 0x136a, 0x0000, 0x234d, 0x3685, 0x2b38,
+	    0x0cb5, 0x015a, 0x0026, 0x47c1, 0x1690, 0x0000, 0x1017, 0x4064,
+	    0x0082, 0x2e52, 0x41ca, 0x330e, 0x44ee, 0x0000, 0x1c7a, 0x3b12,
+	    0x0a7b, 0x125f, 0x49c8, 0x32a8, 0x3c12, 0x19e9, 0x1d46, 0x0000,
+	    0x361f, 0x0000, 0x0000, 0x48d9, 0x0000, 0x38f0, 0x1aef, 0x384b,
+	    0x45e7, 0x2049, 0x2b19, 0x0000, 0x0000, 0x4d22, 0x4c26, 0x0000,
+	    0x0000, 0x22fd, 0x2c2d, 0x2ddb, 0x0c8c, 0x16b9, 0x0000, 0x2773,
+	    0x0000, 0x31e2, 0x0000, 0x084b, 0x0000, 0x1c2e, 0x0ef1, 0x2f53,
+	    0x0000, 0x3580, 0x280d, 0x0000, 0x145e, 0x3a19, 0x0000, 0x3267,
+	    0x2bd4, 0x2a99, 0x1291, 0x0000, 0x0000, 0x096d, 0x0ff4, 0x0818,
+	    0x09a7, 0x2c78, 0x224c, 0x48a3, 0x3fde, 0x1ec6, 0x45f6, 0x38de,
+	    0x0187, 0x1c16, 0x0f93, 0x0000, 0x4cba, 0x42ff, 0x0000, 0x0000,
+	    0x46ee, 0x3c45, 0x0694, 0x3978, 0x2d57, 0x4c36, 0x1b9c, 0x0000,
+	    0x0553, 0x15b0, 0x14f9, 0x0000, 0x0000, 0x0a8d, 0x3feb, 0x240a,
+	    0x3d3a, 0x0000, 0x0000, 0x0e5b, 0x155d, 0x306b, 0x3e2e, 0x0000,
+	    0x3989, 0x4d8b, 0x2999, 0x3a05, 0x4883, 0x18c0, 0x3bcf, 0x2109,
+	    0x1682, 0x06fd, 0x44e7, 0x0000, 0x39ea, 0x0000, 0x2044, 0x4cd3,
+	    0x0000, 0x1825, 0x0667, 0x0858, 0x35b9, 0x0000, 0x09e3, 0x35cf,
+	    0x0000, 0x3668, 0x0000, 0x3c1a, 0x2faa, 0x3220, 0x0000, 0x15f0,
+	    0x09f7, 0x4959, 0x3667, 0x0000, 0x0000, 0x15d3, 0x23c0, 0x146b,
+	    0x1dc6, 0x3fcb, 0x019a, 0x36ef, 0x10d6, 0x06c2, 0x47ed, 0x0db3,
+	    0x07c8, 0x1cb4, 0x40bc, 0x4d0c, 0x0f03, 0x31af, 0x2dea, 0x1da4,
+	    0x0000, 0x4d13, 0x0000, 0x4509, 0x04ee, 0x0000, 0x0000, 0x0860,
+	    0x0c1a, 0x0dc2, 0x22ca, 0x124e, 0x3935, 0x0000, 0x2ee7, 0x4ad4,
+	    0x0000, 0x0723, 0x2f9b, 0x0000, 0x0000, 0x1001, 0x1f3a, 0x02a3,
+	    0x277a, 0x10c3, 0x4777, 0x4ce7, 0x4670, 0x3b1a, 0x43c9, 0x31fd,
+	    0x17d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b4f, 0x108c, 0x0000,
+	    0x2efb, 0x0d13, 0x43e2, 0x1a9c, 0x0079, 0x4bab, 0x32eb, 0x4a9f,
+	    0x487d, 0x0ab0, 0x0e41, 0x076b, 0x0ffb, 0x0000, 0x0000, 0x0000,
+	    0x0ef6, 0x0000, 0x0000, 0x0000, 0x1fb5, 0x4936, 0x30b6, 0x0000,
+	    0x0000, 0x420e, 0x3037, 0x0000, 0x33b6, 0x1496, 0x0000, 0x332b,
+	    0x4640, 0x28c7, 0x3a70, 0x0000, 0x20b6, 0x0102, 0x197b, 0x228a,
+	    0x0000, 0x2eb6, 0x33a0, 0x0000, 0x23e2, 0x0000, 0x457c, 0x2b22,
+	    0x0000, 0x00a1, 0x3dd7, 0x2d85, 0x0000, 0x10c1, 0x0235, 0x3e36,
+	    0x11cb, 0x2b9a, 0x11da, 0x2a2f, 0x3b1d, 0x0000, 0x22e1, 0x0d1e,
+	    0x0000, 0x2919, 0x1389, 0x3cec, 0x2e24, 0x1c46, 0x0b8b, 0x40fa,
+	    0x3c1e, 0x0000, 0x423f, 0x2d07, 0x1746, 0x3ac1, 0x3a1e, 0x4402,
+	    0x0544, 0x0000, 0x3b1b, 0x075f, 0x39ab, 0x0000, 0x1471, 0x313a,
+	    0x0901, 0x0000, 0x241f, 0x0000, 0x1066, 0x02ab, 0x02e3, 0x1886,
+	    0x2410, 0x3cc7, 0x4535, 0x0000, 0x37cd, 0x06e4, 0x0000, 0x0000,
+	    0x0dfc, 0x4c85, 0x49f0, 0x4229, 0x1655, 0x2698, 0x2a50, 0x0000,
+	    0x0000, 0x16f6, 0x0771, 0x3933, 0x37c8, 0x0007, 0x38d0, 0x2eae,
+	    0x25e1, 0x0000, 0x0000, 0x04e7, 0x08ac, 0x1757, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x48a2, 0x26fd, 0x2d17, 0x0000,
+	    0x2209, 0x0000, 0x18ad, 0x0000, 0x401d, 0x0000, 0x422f, 0x0000,
+	    0x0000, 0x3f6c, 0x0000, 0x2c7c, 0x1985, 0x2704, 0x0000, 0x1732,
+	    0x461b, 0x4198, 0x3dfa, 0x0000, 0x1d9c, 0x0000, 0x039f, 0x0000,
+	    0x3b8b, 0x39d0, 0x0be3, 0x236e, 0x38da, 0x47ef, 0x2517, 0x1b26,
+	    0x0000, 0x00d6, 0x126e, 0x34f6, 0x38c9, 0x0000, 0x2796, 0x296a,
+	    0x0cf9, 0x2cbc, 0x0000, 0x0000, 0x0278, 0x0f81, 0x0000, 0x0381,
+	    0x3908, 0x0000, 0x135a, 0x3e63, 0x1def, 0x3ab2, 0x42aa, 0x0000,
+	    0x1052, 0x42ec, 0x3d53, 0x0780, 0x110e, 0x1b60, 0x44f7, 0x0000,
+	    0x3aa6, 0x0000, 0x4cc3, 0x2cb5, 0x0699, 0x34fa, 0x3c7f, 0x430d,
+	    0x28d5, 0x0000, 0x1d2d, 0x0b86, 0x203f, 0x4411, 0x13f8, 0x2531,
+	    0x3b2f, 0x1ebf, 0x059a, 0x120b, 0x1f49, 0x0000, 0x062e, 0x3a61,
+	    0x0a8c, 0x1bd8, 0x0000, 0x2974, 0x0000, 0x3fb6, 0x16f5, 0x0000,
+	    0x1d87, 0x0000, 0x0817, 0x3081, 0x0000, 0x30f6, 0x3e2b, 0x0019,
+	    0x1893, 0x1001, 0x0000, 0x4171, 0x18e7, 0x0000, 0x16ab, 0x3d44,
+	    0x0f9f, 0x01ca, 0x2a2c, 0x2ac5, 0x37a3, 0x0000, 0x099d, 0x0000,
+	    0x0a48, 0x463e, 0x2b7a, 0x1772, 0x2d10, 0x38b6, 0x24aa, 0x4515,
+	    0x32f9, 0x0681, 0x0000, 0x15fe, 0x0597, 0x13af, 0x4169, 0x4089,
+	    0x0000, 0x1ebc, 0x40f2, 0x0000, 0x0000, 0x0e51, 0x3b5c, 0x0eb6,
+	    0x0b98, 0x2d44, 0x0000, 0x0316, 0x3714, 0x0000, 0x3e88, 0x3d21,
+	    0x0000, 0x482c, 0x41db, 0x1030, 0x0c36, 0x4d56, 0x366b, 0x360b,
+	    0x2725, 0x0eba, 0x435a, 0x0000, 0x0a43, 0x1c78, 0x1217, 0x32a0,
+	    0x164b, 0x4a31, 0x1980, 0x1307, 0x4200, 0x1943, 0x0000, 0x055e,
+	    0x4456, 0x025c, 0x1c07, 0x4d5c, 0x1241, 0x0000, 0x0a85, 0x4af8,
+	    0x3938, 0x0000, 0x28f6, 0x3cce, 0x04e9, 0x27a6, 0x0000, 0x0000,
+	    0x01e2, 0x47e7, 0x32ec, 0x0f73, 0x3f36, 0x27c8, 0x22b9, 0x13d8,
+	    0x13db, 0x2de8, 0x0c5e, 0x379c, 0x1b28, 0x1266, 0x3ce7, 0x082c,
+	    0x0728, 0x29b0, 0x2ea6, 0x46a4, 0x0000, 0x066a, 0x4770, 0x106e,
+	    0x0000, 0x4198, 0x4b74, 0x044b, 0x110b, 0x4087, 0x0000, 0x3b5b,
+	    0x41c8, 0x3abb, 0x00fc, 0x0000, 0x097d, 0x0332, 0x0000, 0x291a,
+	    0x0000, 0x4049, 0x176a, 0x3653, 0x15ef, 0x4aaa, 0x4b25, 0x06da,
+	    0x1dfd, 0x0000, 0x4823, 0x27a0, 0x130d, 0x469a, 0x4e1c, 0x040e,
+	    0x2b4e, 0x0000, 0x009e, 0x2452, 0x0659, 0x1707, 0x0000, 0x458a,
+	    0x1456, 0x2062, 0x0870, 0x1d7d, 0x36ea, 0x163b, 0x3ca9, 0x14bf,
+	    0x0000, 0x0000, 0x380a, 0x0000, 0x1010, 0x318a, 0x118f, 0x12cd,
+	    0x13e3, 0x471d, 0x4857, 0x13d0, 0x1f38, 0x44f9, 0x13d6, 0x0000,
+	    0x0000, 0x0f12, 0x0000, 0x0000, 0x2270, 0x2bf1, 0x2a3a, 0x0dee,
+	    0x3b10, 0x0000, 0x401b, 0x07e0, 0x063f, 0x0c68, 0x33be, 0x1f77,
+	    0x0000, 0x31db, 0x0000, 0x0000, 0x42b6, 0x22ab, 0x1ed4, 0x0000,
+	    0x0000, 0x0d00, 0x0000, 0x03aa, 0x24ad, 0x15fe, 0x3f5c, 0x0000,
+	    0x0000, 0x0000, 0x2632, 0x105d, 0x1178, 0x0000, 0x4241, 0x1111,
+	    0x0000, 0x0000, 0x4d0f, 0x0000, 0x29c7, 0x01b5, 0x4503, 0x0000,
+	    0x13f5, 0x3171, 0x0000, 0x292e, 0x0000, 0x2f4e, 0x35b1, 0x041a,
+	    0x3bab, 0x125f, 0x0304, 0x0ca6, 0x2ad0, 0x0438, 0x0000, 0x3861,
+	    0x20c4, 0x0000, 0x0000, 0x0000, 0x4405, 0x3d66, 0x4697, 0x1ecb,
+	    0x0000, 0x0000, 0x408b, 0x268c, 0x0000, 0x1ac4, 0x028e, 0x0000,
+	    0x0000, 0x3f3f, 0x495a, 0x4399, 0x3127, 0x2b6f, 0x0bb1, 0x0000,
+	    0x0000, 0x2a6a, 0x0000, 0x165c, 0x4d75, 0x29cb, 0x3c50, 0x10aa,
+	    0x4dba, 0x2a19, 0x0000, 0x0000, 0x081c, 0x3a57, 0x0055, 0x2965,
+	    0x2a93, 0x0000, 0x08e9, 0x4501, 0x0000, 0x14a3, 0x4a58, 0x113c,
+	    0x2710, 0x43c9, 0x0302, 0x0f4c, 0x0bfc, 0x3a35, 0x02fc, 0x144b,
+	    0x3a21, 0x0000, 0x3cf9, 0x0000, 0x2315, 0x3355, 0x003f, 0x1bce,
+	    0x256e, 0x1e45, 0x4217, 0x43db, 0x0511, 0x019e, 0x1cb7, 0x0482,
+	    0x3362,
+};
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	uint16_t result;
+	const uint16_t *g = hash_g;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x1190cde7), (uint32_t *)h);
+
+	h[0] = h[0] % 24801;
+	h[1] = h[1] % 24801;
+	h[2] = h[2] % 24801;
+	result = (g[h[0]] + g[h[1]] + g[h[2]]) % 20000;
+	return (strcmp(hash_keys[result], key) == 0) ? result : (uint16_t)-1;
+}
+
+void
+hash_prefetch(const void * __restrict key, size_t keylen)
+{
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x1190cde7), (uint32_t *)h);
+
+	h[0] = h[0] % 24801;
+	h[1] = h[1] % 24801;
+	h[2] = h[2] % 24801;
+	__builtin_prefetch(&hash_g[h[0]]);
+	__builtin_prefetch(&hash_g[h[1]]);
+	__builtin_prefetch(&hash_g[h[2]]);
+}
+
+void
+hash_batch(const void * __restrict const *keys, const size_t *keylens,
+	uint32_t *out, size_t n)
+{
+	const uint16_t *g = hash_g;
+	uint16_t hb[8][3];
+
+	for (size_t s = 0; s < n; s += 8) {
+		const size_t nb = n - s < 8 ? n - s : 8;
+		for (size_t j = 0; j < nb; j++) {
+			const void *key = keys[s + j];
+			const size_t keylen = keylens[s + j];
+			uint16_t h[6];
+
+			mi_vector_hash(key, keylen, UINT32_C(0x1190cde7), (uint32_t *)h);
+
+			h[0] = h[0] % 24801;
+			h[1] = h[1] % 24801;
+			h[2] = h[2] % 24801;
+			hb[j][0] = h[0];
+			__builtin_prefetch(&g[h[0]]);
+			hb[j][1] = h[1];
+			__builtin_prefetch(&g[h[1]]);
+			hb[j][2] = h[2];
+			__builtin_prefetch(&g[h[2]]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint16_t *h = hb[j];
+			uint16_t result = (g[h[0]] + g[h[1]] + g[h[2]]) % 20000;
+			out[s + j] = (strcmp(hash_keys[result], keys[s + j]) == 0)
+			    ? result : (uint32_t)-1;
+		}
+	}
+}
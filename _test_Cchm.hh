@@ -0,0 +1,530 @@
+/* generated with rurban/nbperf 08a5797 -C _words1000 */
+/* seed[0]: 596516649, seed[1]: 0 */
+#include <stdint.h>
+#include "nbperf_constexpr.h"
+
+inline constexpr std::string_view words_keys[1000] = {
+	{"aa", 2}, {"aaamvo", 6}, {"aaaoepsaxqker", 13}, {"aaawkatdsy", 10},	/* 4 */
+	{"aaazaiwmzo", 10}, {"aabozllo", 8}, {"aacwukjxnef", 11}, {"aafjjxv", 7},	/* 8 */
+	{"aafkxt", 6}, {"aafyjfdobuf", 11}, {"aagbaqo", 7}, {"aagwgqbdhc", 10},	/* 12 */
+	{"aahpgumys", 9}, {"aahqwu", 6}, {"aajoixnfterwky", 14}, {"aakgie", 6},	/* 16 */
+	{"aalazfxybys", 11}, {"aalqbxuarll", 11}, {"aamevrbsmiecou", 14}, {"aanimh", 6},	/* 20 */
+	{"aarfotdcsb", 10}, {"aau", 3}, {"aauljgrerearvd", 14}, {"aaupkdl", 7},	/* 24 */
+	{"aavgjlqyprl", 11}, {"aawplxnsl", 9}, {"aaxw", 4}, {"ab", 2},	/* 28 */
+	{"aba", 3}, {"abb", 3}, {"abcroqn", 7}, {"abcyoudhuyoxv", 13},	/* 32 */
+	{"abded", 5}, {"abdpauwxnyjjw", 13}, {"abdvzz", 6}, {"abemcsgtsaqf", 12},	/* 36 */
+	{"abgcyzzmsfaohz", 14}, {"abgfzpabokt", 11}, {"abghylkt", 8}, {"abmtelekzgph", 12},	/* 40 */
+	{"abnnfppd", 8}, {"abnznvhmvnpdsm", 14}, {"abqg", 4}, {"abrbqe", 6},	/* 44 */
+	{"abri", 4}, {"abrsthrindrt", 12}, {"abrvngkjcvst", 12}, {"abttuirixp", 10},	/* 48 */
+	{"abucje", 6}, {"abvlrapgztar", 12}, {"abxrbvbhskm", 11}, {"abzjq", 5},	/* 52 */
+	{"ac", 2}, {"aca", 3}, {"acat", 4}, {"accdawrk", 8},	/* 56 */
+	{"acdumcj", 7}, {"acfctctvvuqq", 12}, {"acgeshhyiqp", 11}, {"acgq", 4},	/* 60 */
+	{"acgsyaenn", 9}, {"achaergtd", 9}, {"acjqckgbahcww", 13}, {"acklttjonmfsqw", 14},	/* 64 */
+	{"ackosnzmlndp", 12}, {"aclya", 5}, {"acndzbghzsnf", 12}, {"acnjhah", 7},	/* 68 */
+	{"acq", 3}, {"acqg", 4}, {"acqzgdmgrudfev", 14}, {"acrupnq", 7},	/* 72 */
+	{"actluu", 6}, {"actnmsaqlxj", 11}, {"acurtnbcgiuxz", 13}, {"acvikspj", 8},	/* 76 */
+	{"acwmemtmnml", 11}, {"acwuopbsjrdasc", 14}, {"acyvmwnl", 8}, {"ad", 2},	/* 80 */
+	{"adbb", 4}, {"adcncxngm", 9}, {"adcxr", 5}, {"adfwg", 5},	/* 84 */
+	{"adgcouasqg", 10}, {"adgnv", 5}, {"adgorwmlnymtjv", 14}, {"adgxbuovjvzrjs", 14},	/* 88 */
+	{"adhh", 4}, {"adjgncgej", 9}, {"adjzjjfcahdzbu", 14}, {"adkrmjcofnbo", 12},	/* 92 */
+	{"adkvocwahadyny", 14}, {"adnldbde", 8}, {"adoalbcaylnjdp", 14}, {"adoinuly", 8},	/* 96 */
+	{"adowolj", 7}, {"adptyuhmk", 9}, {"adsetbfuyqmlq", 13}, {"adsyjfsp", 8},	/* 100 */
+	{"adu", 3}, {"aduidlcplhjlw", 13}, {"advxvdrmq", 9}, {"advzb", 5},	/* 104 */
+	{"adwf", 4}, {"adwfkizxbp", 10}, {"adzplry", 7}, {"adzrfo", 6},	/* 108 */
+	{"aeabb", 5}, {"aeahcthpdbaspv", 14}, {"aeahwehgc", 9}, {"aebqchhcmwqshj", 14},	/* 112 */
+	{"aec", 3}, {"aecdpkro", 8}, {"aeckwcuomuwt", 12}, {"aedk", 4},	/* 116 */
+	{"aedygfpc", 8}, {"aeejqumjzwwp", 12}, {"aegnwaegqii", 11}, {"aegttb", 6},	/* 120 */
+	{"aegxoejdtmmrv", 13}, {"aejhlhfpfwbweh", 14}, {"aejijtnvnjlf", 12}, {"aejzdahwbtl", 11},	/* 124 */
+	{"aeku", 4}, {"aeooeu", 6}, {"aepqhpwunt", 10}, {"aernwcvnqoqe", 12},	/* 128 */
+	{"aerwh", 5}, {"aesv", 4}, {"aet", 3}, {"aetazxsti", 9},	/* 132 */
+	{"aeuemhbrat", 10}, {"aewcxnpkqffcsc", 14}, {"aeyida", 6}, {"aezbgcagmrrp", 12},	/* 136 */
+	{"af", 2}, {"afa", 3}, {"afabswrbr", 9}, {"afapfsisywdfnf", 14},	/* 140 */
+	{"afcapeu", 7}, {"afdajpdgtnfvw", 13}, {"afdakepdzxw", 11}, {"afddxironm", 10},	/* 144 */
+	{"affqgbqdmbu", 11}, {"afftzswhrkc", 11}, {"afkomgzyzuuwi", 13}, {"afli", 4},	/* 148 */
+	{"afmnbtd", 7}, {"afngooxtxdncoa", 14}, {"afnnyjqxaxrb", 12}, {"afnup", 5},	/* 152 */
+	{"afoeyyvxslene", 13}, {"afovbwhaw", 9}, {"afp", 3}, {"afpbwckga", 9},	/* 156 */
+	{"afpnnyablos", 11}, {"afqo", 4}, {"afrhifomx", 9}, {"afryjz", 6},	/* 160 */
+	{"afu", 3}, {"afuza", 5}, {"afwmxu", 6}, {"afyiwr", 6},	/* 164 */
+	{"afypvnadao", 10}, {"afystviiojvx", 12}, {"afzaozrqjxnd", 12}, {"agagun", 6},	/* 168 */
+	{"agb", 3}, {"agbbgucvne", 10}, {"agbeeflmdidbw", 13}, {"agbsnfsithwad", 13},	/* 172 */
+	{"agbv", 4}, {"agc", 3}, {"agcsd", 5}, {"agdehlqiefh", 11},	/* 176 */
+	{"agdpcsrr", 8}, {"ageqe", 5}, {"aggii", 5}, {"agillaghnklvt", 13},	/* 180 */
+	{"agimtxt", 7}, {"agl", 3}, {"aglwcuiueqio", 12}, {"agmgy", 5},	/* 184 */
+	{"agnqlevdskdkq", 13}, {"ago", 3}, {"agplhuovfvrna", 13}, {"agqmjnishvnq", 12},	/* 188 */
+	{"agqynkpfvjit", 12}, {"agsjix", 6}, {"agtmromi", 8}, {"agtybphmu", 9},	/* 192 */
+	{"aguaogtcduseei", 14}, {"aguic", 5}, {"aguytjckmbl", 11}, {"agvqdjegqjuqsr", 14},	/* 196 */
+	{"agwprdfxkote", 12}, {"agybygrpdnd", 11}, {"ah", 2}, {"ahbhifaktmf", 11},	/* 200 */
+	{"ahcct", 5}, {"ahcsdwuzxmetm", 13}, {"ahduwpxnwat", 11}, {"ahefdmovzsj", 11},	/* 204 */
+	{"aheoqxi", 7}, {"ahewgvpsiufqx", 13}, {"ahf", 3}, {"ahfqkurbpmnkzk", 14},	/* 208 */
+	{"ahhryg", 6}, {"ahhsabofye", 10}, {"ahhtnic", 7}, {"ahlgnmozmmnkn", 13},	/* 212 */
+	{"ahlykcsbfezz", 12}, {"ahmadaj", 7}, {"ahor", 4}, {"ahpib", 5},	/* 216 */
+	{"ahrkhwhlmdzr", 12}, {"ahrycyyg", 8}, {"ahs", 3}, {"ahtjsnkbpuhw", 12},	/* 220 */
+	{"ahvmo", 5}, {"ahwbwarqo", 9}, {"ahylzbulai", 10}, {"ahzhm", 5},	/* 224 */
+	{"ahzvwxaxic", 10}, {"ai", 2}, {"aiabbdwlhf", 10}, {"aialwmtykvoz", 12},	/* 228 */
+	{"aiamjyqonb", 10}, {"aicawrwtslqawy", 14}, {"aig", 3}, {"aihaiukqsvfylo", 14},	/* 232 */
+	{"aihejtm", 7}, {"aihs", 4}, {"aij", 3}, {"aijbmhwsoasy", 12},	/* 236 */
+	{"aijebj", 6}, {"aijjdynfcxgv", 12}, {"aijsj", 5}, {"aijxwzfpmr", 10},	/* 240 */
+	{"aikdmo", 6}, {"ailhkdpxhle", 11}, {"aingte", 6}, {"aintnw", 6},	/* 244 */
+	{"air", 3}, {"airrvbjwdb", 10}, {"aitazbtn", 8}, {"aiuvbj", 6},	/* 248 */
+	{"aivfpzdv", 8}, {"aivraamggx", 10}, {"aivrmjybsv", 10}, {"aiwco", 5},	/* 252 */
+	{"aiwtcn", 6}, {"aixlmqiyyutkb", 13}, {"aiyzuochuktjgr", 14}, {"aiz", 3},	/* 256 */
+	{"aizx", 4}, {"aj", 2}, {"ajcebz", 6}, {"ajexeuma", 8},	/* 260 */
+	{"ajfujbdn", 8}, {"ajirnfcltff", 11}, {"ajj", 3}, {"ajlw", 4},	/* 264 */
+	{"ajni", 4}, {"ajogop", 6}, {"ajpeg", 5}, {"ajpkohinytla", 12},	/* 268 */
+	{"ajpnyfjl", 8}, {"ajufbpaxc", 9}, {"ajukmqlxl", 9}, {"ajusjcrruqqrss", 14},	/* 272 */
+	{"ajvn", 4}, {"ajwnad", 6}, {"ajxfglmqkd", 10}, {"ajxxmhjpbst", 11},	/* 276 */
+	{"ajy", 3}, {"ajykjjue", 8}, {"ajzkohlbnpfn", 12}, {"ak", 2},	/* 280 */
+	{"akbzrbdp", 8}, {"akcxbwl", 7}, {"akd", 3}, {"akdlazy", 7},	/* 284 */
+	{"akdwgr", 6}, {"akdxmrlmj", 9}, {"akefpqxsrzirma", 14}, {"akfzpgvbi", 9},	/* 288 */
+	{"akgezjlnha", 10}, {"akhowmxjnmg", 11}, {"akjqay", 6}, {"akkadpkznbkjrm", 14},	/* 292 */
+	{"aklkzzrtgi", 10}, {"aklqzw", 6}, {"aklyfeuf", 8}, {"akmpovgxd", 9},	/* 296 */
+	{"akowhnzwlmbv", 12}, {"akpca", 5}, {"akpgjhg", 7}, {"akpwxtipo", 9},	/* 300 */
+	{"akqwfhfoctaka", 13}, {"akrjrqaqqwqed", 13}, {"akroj", 5}, {"akrupa", 6},	/* 304 */
+	{"akssyan", 7}, {"aktpm", 5}, {"akufanjkxmoxet", 14}, {"akyaeacuxejm", 12},	/* 308 */
+	{"akywfelhvsbwzx", 14}, {"akzcid", 6}, {"akztebpoapmapf", 14}, {"al", 2},	/* 312 */
+	{"aleejapuapcyzs", 14}, {"alfzrlptvhdikn", 14}, {"algykc", 6}, {"alh", 3},	/* 316 */
+	{"alhwkvvhxdwq", 12}, {"alipupnolwtat", 13}, {"alirx", 5}, {"aliu", 4},	/* 320 */
+	{"alkndu", 6}, {"alllruhtbki", 11}, {"alnncrnou", 9}, {"alpgzprsmya", 11},	/* 324 */
+	{"alqlsmfpewpo", 12}, {"alrokxhurell", 12}, {"alrpbhdkfvd", 11}, {"als", 3},	/* 328 */
+	{"aluqswv", 7}, {"alv", 3}, {"alwbqvrib", 9}, {"alwodnzveidli", 13},	/* 332 */
+	{"alybopztfvkmwl", 14}, {"am", 2}, {"amafiexdione", 12}, {"amagl", 5},	/* 336 */
+	{"amdtrjkowurky", 13}, {"amdxqzu", 7}, {"amepbcmqers", 11}, {"amgl", 4},	/* 340 */
+	{"amglwwmvafic", 12}, {"amhocvas", 8}, {"amianjuvwy", 10}, {"amiwnd", 6},	/* 344 */
+	{"amjfbefm", 8}, {"amjr", 4}, {"amjyxnjsu", 9}, {"amk", 3},	/* 348 */
+	{"aml", 3}, {"amlajk", 6}, {"amlkgaoelk", 10}, {"amnd", 4},	/* 352 */
+	{"amp", 3}, {"amqumqgepywx", 12}, {"amtespnycxhrna", 14}, {"amua", 4},	/* 356 */
+	{"amuaclj", 7}, {"amvjbh", 6}, {"amvuhhqkzczohh", 14}, {"amw", 3},	/* 360 */
+	{"amxjh", 5}, {"amxqtdhni", 9}, {"amyg", 4}, {"amyic", 5},	/* 364 */
+	{"amypheipnls", 11}, {"an", 2}, {"anai", 4}, {"anbvfjavrwpyin", 14},	/* 368 */
+	{"anemeaieosxx", 12}, {"anff", 4}, {"angdqpdmft", 10}, {"anguwxzlilk", 11},	/* 372 */
+	{"aninljfxl", 9}, {"anlfb", 5}, {"anlvcbtkbgqhf", 13}, {"anptornqlqtpis", 14},	/* 376 */
+	{"anpzxxcntx", 10}, {"anqeya", 6}, {"anqgigorvtg", 11}, {"anqw", 4},	/* 380 */
+	{"anrkwivghygoiv", 14}, {"ans", 3}, {"ant", 3}, {"anuuwxgudkzdw", 13},	/* 384 */
+	{"anwklkxyn", 9}, {"anxwedh", 7}, {"anzigluouypzo", 13}, {"anzrgxko", 8},	/* 388 */
+	{"ao", 2}, {"aoaqfafxmywmkf", 14}, {"aob", 3}, {"aobm", 4},	/* 392 */
+	{"aocbjq", 6}, {"aocgprkwsyelk", 13}, {"aofdiebh", 8}, {"aofeeilsphqi", 12},	/* 396 */
+	{"aogr", 4}, {"aohfxjunb", 9}, {"aohshtvbl", 9}, {"aoipkjqnskqxv", 13},	/* 400 */
+	{"aojp", 4}, {"aojpzddjar", 10}, {"aokjjy", 6}, {"aokszgzzmb", 10},	/* 404 */
+	{"aolgzpjcanya", 12}, {"aolismvrqhw", 11}, {"aoluupkbomvtw", 13}, {"aongrogeaitfe", 13},	/* 408 */
+	{"aonm", 4}, {"aoobzdhtvvwy", 12}, {"aooidxlqowtb", 12}, {"aopphpcemi", 10},	/* 412 */
+	{"aoqclsk", 7}, {"aoqvpwifudrraw", 14}, {"aordmjaccjfra", 13}, {"aoreagatoud", 11},	/* 416 */
+	{"aovjcrmiu", 9}, {"aovk", 4}, {"aovoufl", 7}, {"aovvtczrc", 9},	/* 420 */
+	{"aovxq", 5}, {"aox", 3}, {"aoxkxeye", 8}, {"aoxxzsgg", 8},	/* 424 */
+	{"aoyla", 5}, {"aoymp", 5}, {"aoz", 3}, {"aozchu", 6},	/* 428 */
+	{"ap", 2}, {"apdbribsdymcir", 14}, {"apdq", 4}, {"apdumidzy", 9},	/* 432 */
+	{"apfpjgsiztsi", 12}, {"apght", 5}, {"apijmcafchdgjq", 14}, {"apjqh", 5},	/* 436 */
+	{"apmb", 4}, {"apnbsvx", 7}, {"apnsa", 5}, {"apnxqbhntoevwz", 14},	/* 440 */
+	{"apoagwnopnc", 11}, {"apoksoahdk", 10}, {"apoxufrps", 9}, {"appxvypap", 9},	/* 444 */
+	{"aprkejwd", 8}, {"aprrxamsubs", 11}, {"apszjdhexvgrhi", 14}, {"aptmbojveltgbm", 14},	/* 448 */
+	{"aptnbhdxmvrqas", 14}, {"apuw", 4}, {"apv", 3}, {"apvecnkopt", 10},	/* 452 */
+	{"apwilmyz", 8}, {"apxvrkgnsi", 10}, {"apyotdpei", 9}, {"apzvkshb", 8},	/* 456 */
+	{"aq", 2}, {"aqaeyen", 7}, {"aqaxxjbxfl", 10}, {"aqbacwwhqor", 11},	/* 460 */
+	{"aqbj", 4}, {"aqdayjchue", 10}, {"aqdekxkzks", 10}, {"aqdhf", 5},	/* 464 */
+	{"aqfhlnmxzcdi", 12}, {"aqftiwbsvmutcd", 14}, {"aqfuykqjfa", 10}, {"aqg", 3},	/* 468 */
+	{"aqgqyaujeajf", 12}, {"aqiy", 4}, {"aqjlr", 5}, {"aqjra", 5},	/* 472 */
+	{"aqkr", 4}, {"aql", 3}, {"aqlduhjid", 9}, {"aqlhyotznj", 10},	/* 476 */
+	{"aqlxubdylgq", 11}, {"aqm", 3}, {"aqnwqkbt", 8}, {"aqozrrayhcz", 11},	/* 480 */
+	{"aqspytz", 7}, {"aqt", 3}, {"aqtkglsvjlwg", 12}, {"aqvpvvskgmdzda", 14},	/* 484 */
+	{"aqxydxmjjdl", 11}, {"aqynpq", 6}, {"aqyom", 5}, {"aqz", 3},	/* 488 */
+	{"aqzfqhxs", 8}, {"aqzite", 6}, {"ar", 2}, {"ara", 3},	/* 492 */
+	{"arcpe", 5}, {"arcuckn", 7}, {"ardxeq", 6}, {"ardzqqnzee", 10},	/* 496 */
+	{"are", 3}, {"arghlqfwhnodip", 14}, {"arhpfrahecaek", 13}, {"aribks", 6},	/* 500 */
+	{"arict", 5}, {"arikk", 5}, {"arivnzklsg", 10}, {"arjvyxuecqlsz", 13},	/* 504 */
+	{"ark", 3}, {"arkhlu", 6}, {"arlxkk", 6}, {"armorcdpej", 10},	/* 508 */
+	{"armqdlybyplyn", 13}, {"arms", 4}, {"arnrjwcdzkwzqo", 14}, {"arnzzukeimkcc", 13},	/* 512 */
+	{"arohoeaiy", 9}, {"arqeqfnk", 8}, {"arrbknk", 7}, {"arrdni", 6},	/* 516 */
+	{"arrtztk", 7}, {"aru", 3}, {"arucxbw", 7}, {"arxcppjvzzmw", 12},	/* 520 */
+	{"aryswrjcv", 9}, {"arzbdrgcmfau", 12}, {"arzhnfvf", 8}, {"arzuljwsk", 9},	/* 524 */
+	{"asalrmfafppxfd", 14}, {"asbeorwhpaatq", 13}, {"ascmpo", 6}, {"asdgbs", 6},	/* 528 */
+	{"asfxudbxe", 9}, {"asgecyh", 7}, {"asglzmhxtvfdk", 13}, {"asgshnvjawpg", 12},	/* 532 */
+	{"ashlpq", 6}, {"ashulbmpklnf", 12}, {"asiozyxlcb", 10}, {"asiq", 4},	/* 536 */
+	{"asitgqqvz", 9}, {"asizstlxnmldg", 13}, {"asjizgsn", 8}, {"aslx", 4},	/* 540 */
+	{"asnhn", 5}, {"asnjeueyiibnr", 13}, {"aso", 3}, {"asp", 3},	/* 544 */
+	{"asr", 3}, {"asroqqyd", 8}, {"assdbsqadkklyr", 14}, {"asss", 4},	/* 548 */
+	{"assujmboblyla", 13}, {"assvf", 5}, {"asukvsmwgtztm", 13}, {"asun", 4},	/* 552 */
+	{"asupfarknyyqhu", 14}, {"asxbiaro", 8}, {"asxtnyw", 7}, {"aszjj", 5},	/* 556 */
+	{"aszqjyz", 7}, {"at", 2}, {"atasxvjfdd", 10}, {"atbgsbxekj", 10},	/* 560 */
+	{"atdxmowgxodbg", 13}, {"atg", 3}, {"atgflcfwh", 9}, {"atghmtgzeb", 10},	/* 564 */
+	{"atgs", 4}, {"ath", 3}, {"atij", 4}, {"atkramwifnwq", 12},	/* 568 */
+	{"atkwncxsx", 9}, {"atlzvm", 6}, {"atmuiszpjkp", 11}, {"ato", 3},	/* 572 */
+	{"atrb", 4}, {"attdvy", 6}, {"attt", 4}, {"atuavewemtrsm", 13},	/* 576 */
+	{"atumme", 6}, {"atur", 4}, {"atvaeladu", 9}, {"atvruu", 6},	/* 580 */
+	{"atwxgh", 6}, {"atzyt", 5}, {"au", 2}, {"auarghyogn", 10},	/* 584 */
+	{"auby", 4}, {"aucfoymvqzjeeq", 14}, {"auehjyeax", 9}, {"auemxrdoay", 10},	/* 588 */
+	{"auepbxwj", 8}, {"aufjgmihgiwou", 13}, {"augdbjermtl", 11}, {"augkpkwxbi", 10},	/* 592 */
+	{"augpp", 5}, {"augqmrgdnuuq", 12}, {"augyhqves", 9}, {"augyyboevwfgt", 13},	/* 596 */
+	{"auhr", 4}, {"aujwepnim", 9}, {"aulld", 5}, {"aumywooz", 8},	/* 600 */
+	{"auomaojqsownim", 14}, {"auoypcs", 7}, {"auqrwvdyryab", 12}, {"aurghovsqy", 10},	/* 604 */
+	{"aurwo", 5}, {"ausybq", 6}, {"autcnzpgn", 9}, {"autoht", 6},	/* 608 */
+	{"auvbuykmd", 9}, {"auvnrkb", 7}, {"auvwrpfygwjgen", 14}, {"auyxu", 5},	/* 612 */
+	{"av", 2}, {"avap", 4}, {"avbcyego", 8}, {"avc", 3},	/* 616 */
+	{"avcmlnhmcmvwph", 14}, {"avctrko", 7}, {"avejfof", 7}, {"avelskvcusw", 11},	/* 620 */
+	{"avfgogievupuf", 13}, {"avhd", 4}, {"avhks", 5}, {"avhnhwgots", 10},	/* 624 */
+	{"avhrnkcn", 8}, {"aviqn", 5}, {"avknwpc", 7}, {"avlbkhyycggr", 12},	/* 628 */
+	{"avlez", 5}, {"avlijhsccnty", 12}, {"avoewxrvewnk", 12}, {"avpxgzavyb", 10},	/* 632 */
+	{"avrtcuwxd", 9}, {"avsmcb", 6}, {"avsnfa", 6}, {"avsoi", 5},	/* 636 */
+	{"avstzwuxnyukeb", 14}, {"avucflgumvboz", 13}, {"avvm", 4}, {"avvrcjnpw", 9},	/* 640 */
+	{"avytejzij", 9}, {"avz", 3}, {"aw", 2}, {"awadf", 5},	/* 644 */
+	{"awaenhasdvibam", 14}, {"awbxrtjoa", 9}, {"awckekjgfbhfoz", 14}, {"awdwwfpce", 9},	/* 648 */
+	{"awelebpxvyz", 11}, {"awfzwgoeyh", 10}, {"awktgwbrh", 9}, {"awmr", 4},	/* 652 */
+	{"awpceoqjuewew", 13}, {"awq", 3}, {"awrlebnfhidt", 12}, {"awrpp", 5},	/* 656 */
+	{"awwaipm", 7}, {"awwbunk", 7}, {"awwdaxmozk", 10}, {"awwvjop", 7},	/* 660 */
+	{"awxjflfkvzcf", 12}, {"awyyehm", 7}, {"awzpvraboqxrh", 13}, {"ax", 2},	/* 664 */
+	{"axbub", 5}, {"axcus", 5}, {"axfpbzmiscjwe", 13}, {"axgvfbwvwn", 10},	/* 668 */
+	{"axifhymfsrre", 12}, {"axirzlmia", 9}, {"axjovnoynhxcgp", 14}, {"axjqcyho", 8},	/* 672 */
+	{"axkyzbvmj", 9}, {"axmatqc", 7}, {"axpaljfblns", 11}, {"axpjimge", 8},	/* 676 */
+	{"axqclcoujeu", 11}, {"axqfflmwagnb", 12}, {"axvbmjcmu", 9}, {"axxhcrfysw", 10},	/* 680 */
+	{"axxwaq", 6}, {"axzhnlgyw", 9}, {"axznsdejodm", 11}, {"ay", 2},	/* 684 */
+	{"ayaguqcyf", 9}, {"ayardvhgchqlwt", 14}, {"aybkz", 5}, {"aybsbwif", 8},	/* 688 */
+	{"aycixdathok", 11}, {"ayd", 3}, {"aydt", 4}, {"aydvrvlia", 9},	/* 692 */
+	{"aye", 3}, {"ayfle", 5}, {"ayfpvmjju", 9}, {"ayfyqo", 6},	/* 696 */
+	{"aygjtv", 6}, {"aygl", 4}, {"aygse", 5}, {"aygvbpwqxto", 11},	/* 700 */
+	{"ayk", 3}, {"ayndurltg", 9}, {"ayqroi", 6}, {"ayrtxzkgx", 9},	/* 704 */
+	{"ayurhakpbgm", 11}, {"ayv", 3}, {"ayvhf", 5}, {"ayvidfhrm", 9},	/* 708 */
+	{"ayvs", 4}, {"ayvz", 4}, {"ayxdzd", 6}, {"ayxkgs", 6},	/* 712 */
+	{"ayy", 3}, {"az", 2}, {"azaeznmkwi", 10}, {"azbibra", 7},	/* 716 */
+	{"azdcmxfes", 9}, {"azdkvwfwudtabt", 14}, {"azdrbjhmwqmlxq", 14}, {"azeu", 4},	/* 720 */
+	{"azgiwdgycss", 11}, {"azhq", 4}, {"azhxsnqtjp", 10}, {"azkewersoh", 10},	/* 724 */
+	{"azkgkokspcsxyy", 14}, {"azlldh", 6}, {"azmbiqx", 7}, {"aznft", 5},	/* 728 */
+	{"azojzmhmvgw", 11}, {"azqzqvhelmnekn", 14}, {"azsjaleohobshu", 14}, {"azunqkleaevv", 12},	/* 732 */
+	{"azuvj", 5}, {"azuvtvfjghuvki", 14}, {"azvkpvmmqv", 10}, {"azzcerqz", 8},	/* 736 */
+	{"azzeqljhdz", 10}, {"ba", 2}, {"baazajzi", 8}, {"babof", 5},	/* 740 */
+	{"badoc", 5}, {"badrq", 5}, {"baeaifbpywwns", 13}, {"baediyfxp", 9},	/* 744 */
+	{"baefi", 5}, {"baeq", 4}, {"bagqafqf", 8}, {"bagufnamedqhln", 14},	/* 748 */
+	{"bahpxm", 6}, {"bahqzidllfa", 11}, {"bahvobkwdidd", 12}, {"baicsilotqif", 12},	/* 752 */
+	{"baixrb", 6}, {"bajgfdbgxfkrlv", 14}, {"bakpwahrebmdh", 13}, {"bakvd", 5},	/* 756 */
+	{"bakxb", 5}, {"balrxviengxws", 13}, {"bammvjyqvjhx", 12}, {"bamudyxdpugduv", 14},	/* 760 */
+	{"banv", 4}, {"baotq", 5}, {"bappr", 5}, {"bav", 3},	/* 764 */
+	{"bawvglqhodxlv", 13}, {"bawzbmwv", 8}, {"baxmmnvestev", 12}, {"baymotz", 7},	/* 768 */
+	{"baziywgorpwxn", 13}, {"bb", 2}, {"bbaibijfrptw", 12}, {"bbaqrzywu", 9},	/* 772 */
+	{"bbayrlie", 8}, {"bbbzxvaokcjjn", 13}, {"bbdkzao", 7}, {"bbdtbwrrzyp", 11},	/* 776 */
+	{"bbetmejicwr", 11}, {"bbglsgkhhpjgy", 13}, {"bbh", 3}, {"bbjmzj", 6},	/* 780 */
+	{"bbrciffax", 9}, {"bbtbfnuuhcind", 13}, {"bbtjg", 5}, {"bbtrkn", 6},	/* 784 */
+	{"bbuwoojy", 8}, {"bbvatgkvdogzxw", 14}, {"bbvkeedqgsf", 11}, {"bbwoeopqygz", 11},	/* 788 */
+	{"bbww", 4}, {"bbxgulxlql", 10}, {"bbxy", 4}, {"bbynjbzndb", 10},	/* 792 */
+	{"bbytzrg", 7}, {"bc", 2}, {"bca", 3}, {"bcbogjbvqrza", 12},	/* 796 */
+	{"bcbue", 5}, {"bccuohhjalg", 11}, {"bcemhv", 6}, {"bcf", 3},	/* 800 */
+	{"bcfqaunfrb", 10}, {"bcfxvjqoqaccu", 13}, {"bcgejmayphgj", 12}, {"bcgfmuo", 7},	/* 804 */
+	{"bckeht", 6}, {"bckldqjbp", 9}, {"bclavkpvnjmu", 12}, {"bcleg", 5},	/* 808 */
+	{"bclpx", 5}, {"bcmtpljsczw", 11}, {"bcnkqlrhjq", 10}, {"bcnqq", 5},	/* 812 */
+	{"bcnzjtwyiyy", 11}, {"bcosnlgqblp", 11}, {"bcpkhby", 7}, {"bcpkng", 6},	/* 816 */
+	{"bcqvvjzlegnf", 12}, {"bcr", 3}, {"bcrzqzn", 7}, {"bcsm", 4},	/* 820 */
+	{"bcsykbyrcb", 10}, {"bctpqwmsnvh", 11}, {"bcuh", 4}, {"bcvljjb", 7},	/* 824 */
+	{"bcvqnowfeg", 10}, {"bcxd", 4}, {"bczt", 4}, {"bd", 2},	/* 828 */
+	{"bdacsmnculmcq", 13}, {"bdcprnlpdkrvl", 13}, {"bdfnevzpq", 9}, {"bdhccb", 6},	/* 832 */
+	{"bdjilotpkildck", 14}, {"bdkndvylxuxo", 12}, {"bdl", 3}, {"bdlyrtxes", 9},	/* 836 */
+	{"bdmfyqwxuf", 10}, {"bdnbkoe", 7}, {"bdnejntcdrqve", 13}, {"bdnufpoxdxux", 12},	/* 840 */
+	{"bdpnc", 5}, {"bdpybuwwa", 9}, {"bdrapgoaq", 9}, {"bdrkkeq", 7},	/* 844 */
+	{"bdrrborticaxib", 14}, {"bdseqqylrizsul", 14}, {"bdtqq", 5}, {"bdudzrtalhwcap", 14},	/* 848 */
+	{"bdui", 4}, {"bdvuvhboykx", 11}, {"bdw", 3}, {"bdycki", 6},	/* 852 */
+	{"bdyzmnp", 7}, {"be", 2}, {"beagrthtp", 9}, {"becmmblivgijmo", 14},	/* 856 */
+	{"bedwfiaesztb", 12}, {"beedabmibnzzb", 13}, {"behahrymnzmlgc", 14}, {"beilkaiubdvku", 13},	/* 860 */
+	{"beivnwe", 7}, {"bekxbx", 6}, {"belpl", 5}, {"belw", 4},	/* 864 */
+	{"bemcinpjdq", 10}, {"beolqvpzfxf", 11}, {"beoxxqgo", 8}, {"bepewpnpjatiru", 14},	/* 868 */
+	{"bepiorywl", 9}, {"bepmsur", 7}, {"beqzxtqbfdr", 11}, {"berwgeebepz", 11},	/* 872 */
+	{"besmlmrphhawpr", 14}, {"bevbeeofe", 9}, {"bevz", 4}, {"bewamoowipmcb", 13},	/* 876 */
+	{"bewwuq", 6}, {"bexgr", 5}, {"beyxvt", 6}, {"bezoe", 5},	/* 880 */
+	{"bf", 2}, {"bfasppnandsz", 12}, {"bfcfvan", 7}, {"bfdixpxt", 8},	/* 884 */
+	{"bfex", 4}, {"bfezpbufygz", 11}, {"bff", 3}, {"bffuecdod", 9},	/* 888 */
+	{"bfgndmggnr", 10}, {"bfgwpr", 6}, {"bfirbahyc", 9}, {"bfkjw", 5},	/* 892 */
+	{"bfleejld", 8}, {"bfmoevqtgxr", 11}, {"bfnotan", 7}, {"bfocrratxrcfqm", 14},	/* 896 */
+	{"bfor", 4}, {"bfqdcut", 7}, {"bfqgtpjkndqch", 13}, {"bfqhuvfmvzyji", 13},	/* 900 */
+	{"bfry", 4}, {"bfud", 4}, {"bfudo", 5}, {"bfuelxdm", 8},	/* 904 */
+	{"bfulzk", 6}, {"bfvkfarob", 9}, {"bfvqoc", 6}, {"bfx", 3},	/* 908 */
+	{"bfxojuzxhqu", 11}, {"bfyavwepuqps", 12}, {"bfyeovbyiuw", 11}, {"bfzsfvxobwhfok", 14},	/* 912 */
+	{"bg", 2}, {"bgaj", 4}, {"bgakdggioxxtsd", 14}, {"bganhvs", 7},	/* 916 */
+	{"bgaxooeiqvbmtz", 14}, {"bgc", 3}, {"bgckovjdh", 9}, {"bgdfc", 5},	/* 920 */
+	{"bgdrlzv", 7}, {"bgh", 3}, {"bgiuabechv", 10}, {"bgjingfapqbe", 12},	/* 924 */
+	{"bgld", 4}, {"bgmlldvucq", 10}, {"bgn", 3}, {"bgnhp", 5},	/* 928 */
+	{"bgnkeruy", 8}, {"bgonv", 5}, {"bgqigoxdfl", 10}, {"bgqkccdufr", 10},	/* 932 */
+	{"bgsdzqeklmuyn", 13}, {"bgtfqtqzskrp", 12}, {"bgu", 3}, {"bgvwfdzhllnt", 12},	/* 936 */
+	{"bgwpygmkjptqi", 13}, {"bgwzmhj", 7}, {"bgyojmkonvnszc", 14}, {"bgzyhxcsvstjpq", 14},	/* 940 */
+	{"bgzzd", 5}, {"bh", 2}, {"bhbidhdvx", 9}, {"bhcklnltpaetl", 13},	/* 944 */
+	{"bhcqzspz", 8}, {"bhdrcxio", 8}, {"bhezkqganmkla", 13}, {"bhftwm", 6},	/* 948 */
+	{"bhfukaju", 8}, {"bhha", 4}, {"bhjnmrmwuufq", 12}, {"bhkdpkcplsk", 11},	/* 952 */
+	{"bhkmw", 5}, {"bhmsap", 6}, {"bhqjgtptbak", 11}, {"bhrcwalapbux", 12},	/* 956 */
+	{"bhsfq", 5}, {"bhswgx", 6}, {"bhw", 3}, {"bhwbjuoghpyphf", 14},	/* 960 */
+	{"bhwdvywdg", 9}, {"bhwtetktboou", 12}, {"bhyvanlexudizp", 14}, {"bhyzesomeviv", 12},	/* 964 */
+	{"bi", 2}, {"biamytpegbp", 11}, {"bic", 3}, {"bidznmilgb", 10},	/* 968 */
+	{"bigmtmnhlhcadk", 14}, {"bikawv", 6}, {"bimnkx", 6}, {"bink", 4},	/* 972 */
+	{"biopdqt", 7}, {"bip", 3}, {"biph", 4}, {"biqakmpoxsdtg", 13},	/* 976 */
+	{"biqgcz", 6}, {"biqnbx", 6}, {"birtinutrik", 11}, {"bisahszesqkyfq", 14},	/* 980 */
+	{"biszstem", 8}, {"bitbidpy", 8}, {"biteikqwq", 9}, {"bivh", 4},	/* 984 */
+	{"bivy", 4}, {"biycafsmilc", 11}, {"biygzzsmxiy", 11}, {"biziirfyc", 9},	/* 988 */
+	{"bizj", 4}, {"bizk", 4}, {"bj", 2}, {"bja", 3},	/* 992 */
+	{"bjbfr", 5}, {"bjbiknmw", 8}, {"bjceinmzedt", 11}, {"bjcopoptplk", 11},	/* 996 */
+	{"bjd", 3}, {"bjdiiqxrit", 10}, {"bjeapaqyqb", 10}, {"bjehuqnch", 9},	/* 1000 */
+};
+
+inline constexpr uint16_t words_g[2001] = {
+	    0x02f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0342, 0x0000, 0x0000, 0x0000, 0x00d2, 0x0000,
+	    0x0174, 0x0000, 0x0000, 0x025d, 0x0058, 0x032b, 0x0000, 0x0000,
+	    0x0000, 0x029f, 0x0000, 0x0000, 0x00e5, 0x0000, 0x003c, 0x0224,
+	    0x00c1, 0x0000, 0x02f0, 0x0123, 0x0000, 0x0000, 0x015b, 0x01f3,
+	    0x0000, 0x029d, 0x0000, 0x0061, 0x03c4, 0x0316, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0278, 0x02ac, 0x0000, 0x01ec, 0x0000,
+	    0x0000, 0x0000, 0x0099, 0x004c, 0x0000, 0x02a1, 0x039d, 0x0000,
+	    0x0307, 0x020d, 0x03db, 0x0369, 0x0389, 0x035e, 0x03b7, 0x0000,
+	    0x00c0, 0x008b, 0x02e9, 0x0378, 0x0000, 0x0000, 0x0000, 0x002b,
+	    0x023a, 0x0078, 0x00cb, 0x0000, 0x0000, 0x0000, 0x0285, 0x03a7,
+	    0x0000, 0x021d, 0x0052, 0x0000, 0x03de, 0x0205, 0x03c4, 0x0000,
+	    0x0000, 0x0000, 0x02b9, 0x03cf, 0x0352, 0x0000, 0x0000, 0x02cd,
+	    0x00d7, 0x03c6, 0x0000, 0x02da, 0x0000, 0x0153, 0x01b6, 0x02ae,
+	    0x0000, 0x0000, 0x02b6, 0x0000, 0x0000, 0x0377, 0x011f, 0x013c,
+	    0x033b, 0x0000, 0x0029, 0x0000, 0x013b, 0x0073, 0x0157, 0x00be,
+	    0x0000, 0x0383, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x031e, 0x030d, 0x0000, 0x02da, 0x01e9, 0x0000, 0x0000, 0x0000,
+	    0x00b0, 0x032d, 0x034a, 0x03dd, 0x03d7, 0x0022, 0x0023, 0x0203,
+	    0x036d, 0x0000, 0x0169, 0x0385, 0x0000, 0x0000, 0x029d, 0x0000,
+	    0x00a5, 0x0000, 0x0258, 0x0000, 0x0000, 0x0000, 0x0242, 0x0021,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0105, 0x03cd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0343, 0x025e, 0x0000, 0x0000,
+	    0x0159, 0x01bb, 0x018b, 0x0000, 0x0000, 0x0008, 0x0000, 0x0000,
+	    0x029e, 0x0000, 0x0000, 0x0000, 0x0000, 0x01a5, 0x01c3, 0x016d,
+	    0x0000, 0x0000, 0x0000, 0x03de, 0x0000, 0x01ea, 0x02d6, 0x01ae,
+	    0x0379, 0x0000, 0x0000, 0x0000, 0x012a, 0x0000, 0x009d, 0x0000,
+	    0x0274, 0x012c, 0x01f0, 0x0000, 0x00c5, 0x0000, 0x00d7, 0x010c,
+	    0x0382, 0x0000, 0x0378, 0x018e, 0x004e, 0x02d4, 0x0320, 0x03b7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x034a, 0x0000,
+	    0x0000, 0x0000, 0x006d, 0x0000, 0x03c9, 0x0000, 0x01d1, 0x0197,
+	    0x00b8, 0x02ab, 0x0000, 0x0000, 0x02ec, 0x0330, 0x0128, 0x0000,
+	    0x0074, 0x03d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0374, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0153, 0x0003, 0x036b, 0x02c9, 0x0073,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02fc,
+	    0x03ac, 0x0168, 0x0000, 0x0247, 0x0000, 0x0165, 0x0108, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00ae, 0x0000, 0x0085, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a9, 0x0302, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0163, 0x0000, 0x0217, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x036a, 0x0026, 0x0125,
+	    0x0000, 0x00fd, 0x0134, 0x0000, 0x0000, 0x0281, 0x0000, 0x0217,
+	    0x0192, 0x0166, 0x00a5, 0x01b2, 0x0000, 0x0000, 0x022f, 0x0304,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0329, 0x01de,
+	    0x02f7, 0x0000, 0x015f, 0x01da, 0x037e, 0x0000, 0x02d4, 0x00a9,
+	    0x0000, 0x03e7, 0x0116, 0x00d7, 0x01b4, 0x0094, 0x0000, 0x0000,
+	    0x0004, 0x03ad, 0x0000, 0x00eb, 0x0000, 0x029c, 0x03df, 0x0000,
+	    0x00ae, 0x0356, 0x0000, 0x0000, 0x0000, 0x0079, 0x0306, 0x0000,
+	    0x0000, 0x0106, 0x0000, 0x0000, 0x0092, 0x0330, 0x0000, 0x00ac,
+	    0x0000, 0x0000, 0x0000, 0x037c, 0x00cf, 0x0004, 0x02e7, 0x0240,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0208, 0x0000, 0x0120,
+	    0x0000, 0x0000, 0x0000, 0x0182, 0x0275, 0x02c1, 0x0029, 0x0000,
+	    0x00df, 0x0000, 0x0000, 0x0000, 0x0000, 0x01a5, 0x0137, 0x0000,
+	    0x00c9, 0x0000, 0x0000, 0x0000, 0x009f, 0x0357, 0x0000, 0x0000,
+	    0x0000, 0x03bb, 0x0000, 0x02df, 0x0000, 0x0383, 0x0088, 0x00f6,
+	    0x0000, 0x0000, 0x03e7, 0x0000, 0x01d8, 0x03a3, 0x0000, 0x00bf,
+	    0x0000, 0x0000, 0x02a5, 0x0139, 0x0351, 0x0149, 0x0000, 0x03e1,
+	    0x01b3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0121, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0185, 0x00ad, 0x0326, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02bf, 0x032f, 0x0354, 0x0000, 0x03d2,
+	    0x0108, 0x0000, 0x0000, 0x0000, 0x0143, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02c0, 0x0000, 0x0055, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0048, 0x0211, 0x0311, 0x003e, 0x0000,
+	    0x022f, 0x0000, 0x026f, 0x0342, 0x0046, 0x0000, 0x0000, 0x0000,
+	    0x0122, 0x0337, 0x03ab, 0x0000, 0x012b, 0x0000, 0x0000, 0x0000,
+	    0x0270, 0x01c3, 0x0000, 0x020a, 0x0000, 0x0327, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024c, 0x01f3, 0x0175,
+	    0x002f, 0x0000, 0x0000, 0x037a, 0x0000, 0x0313, 0x02c1, 0x03e2,
+	    0x0353, 0x0000, 0x0201, 0x0065, 0x0000, 0x0000, 0x00f6, 0x0000,
+	    0x03a7, 0x0000, 0x008d, 0x0000, 0x02d3, 0x03d7, 0x0000, 0x0000,
+	    0x0000, 0x01b1, 0x0000, 0x0155, 0x0359, 0x00da, 0x0000, 0x0000,
+	    0x0189, 0x0000, 0x0000, 0x01d3, 0x0000, 0x0305, 0x0000, 0x038f,
+	    0x0000, 0x0264, 0x0000, 0x0000, 0x035f, 0x0000, 0x0335, 0x0000,
+	    0x0000, 0x0000, 0x03d3, 0x020b, 0x0000, 0x02ea, 0x0000, 0x0026,
+	    0x0000, 0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0347, 0x0000,
+	    0x0000, 0x0000, 0x00f8, 0x0192, 0x0000, 0x0000, 0x0205, 0x0000,
+	    0x00a6, 0x00ca, 0x0000, 0x02ec, 0x0250, 0x00f3, 0x01ba, 0x0000,
+	    0x0000, 0x0000, 0x0225, 0x0379, 0x02cd, 0x01f5, 0x01c5, 0x01c3,
+	    0x0000, 0x01b9, 0x01dc, 0x0000, 0x0000, 0x0000, 0x010b, 0x02bd,
+	    0x0000, 0x001c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0127, 0x01a1,
+	    0x0185, 0x027b, 0x0133, 0x0296, 0x0360, 0x0064, 0x023a, 0x0288,
+	    0x029a, 0x015d, 0x015a, 0x0364, 0x000f, 0x0000, 0x0258, 0x0000,
+	    0x03ac, 0x0000, 0x02f7, 0x0026, 0x036d, 0x0000, 0x0183, 0x0000,
+	    0x0000, 0x0046, 0x034d, 0x0384, 0x0000, 0x003d, 0x0000, 0x0000,
+	    0x0000, 0x023b, 0x0087, 0x0000, 0x02c8, 0x02b2, 0x0000, 0x0000,
+	    0x0000, 0x0039, 0x0000, 0x004c, 0x00a1, 0x0000, 0x0000, 0x021f,
+	    0x0000, 0x01ff, 0x0151, 0x0000, 0x0150, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0371, 0x0000, 0x0000, 0x003f,
+	    0x0000, 0x0000, 0x0000, 0x03ab, 0x0190, 0x0000, 0x0000, 0x0392,
+	    0x0280, 0x00c1, 0x00e8, 0x0000, 0x0303, 0x0000, 0x0000, 0x012d,
+	    0x01d4, 0x0000, 0x0144, 0x0000, 0x01be, 0x00ff, 0x0000, 0x0000,
+	    0x03aa, 0x009c, 0x0000, 0x0000, 0x00f6, 0x0287, 0x03b0, 0x0000,
+	    0x014b, 0x0269, 0x0000, 0x0000, 0x01c8, 0x0000, 0x025f, 0x0000,
+	    0x0298, 0x017a, 0x00f3, 0x0221, 0x0262, 0x02c7, 0x0063, 0x0000,
+	    0x0000, 0x033d, 0x03b8, 0x00fc, 0x0000, 0x00ab, 0x0144, 0x0000,
+	    0x0000, 0x005c, 0x0000, 0x0000, 0x0000, 0x0352, 0x015d, 0x0334,
+	    0x036c, 0x0000, 0x038d, 0x0375, 0x0000, 0x0000, 0x0347, 0x0000,
+	    0x0000, 0x02f3, 0x0000, 0x0000, 0x02b6, 0x017b, 0x0000, 0x0000,
+	    0x0000, 0x0281, 0x01b7, 0x02df, 0x0358, 0x0232, 0x0000, 0x0187,
+	    0x0000, 0x00ca, 0x0151, 0x0000, 0x0189, 0x0358, 0x0184, 0x0000,
+	    0x0000, 0x021e, 0x0000, 0x0250, 0x0000, 0x0000, 0x0000, 0x013c,
+	    0x011f, 0x0000, 0x03e5, 0x0000, 0x02ab, 0x0162, 0x0000, 0x013c,
+	    0x0309, 0x0000, 0x03d3, 0x0000, 0x0047, 0x0000, 0x0047, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x004c, 0x0316,
+	    0x0160, 0x00e5, 0x0230, 0x03dc, 0x0000, 0x021b, 0x0000, 0x0138,
+	    0x03a1, 0x031f, 0x02bd, 0x03a7, 0x0000, 0x03b3, 0x00bf, 0x0396,
+	    0x0016, 0x00f9, 0x0353, 0x028f, 0x0000, 0x0000, 0x029b, 0x0000,
+	    0x0000, 0x01f5, 0x0346, 0x0097, 0x0059, 0x0186, 0x03b7, 0x0000,
+	    0x0095, 0x03b0, 0x0000, 0x0000, 0x0360, 0x0241, 0x0000, 0x0000,
+	    0x0144, 0x027f, 0x0000, 0x0121, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x027f, 0x00b8, 0x01a1, 0x009e, 0x0000, 0x0000, 0x01f1, 0x0000,
+	    0x0000, 0x0193, 0x0000, 0x01a9, 0x037e, 0x031c, 0x0325, 0x0259,
+	    0x0000, 0x030f, 0x0340, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01e0, 0x00a9, 0x0260, 0x0048, 0x02cc, 0x0336, 0x0000,
+	    0x01b4, 0x003d, 0x0000, 0x0000, 0x0000, 0x0198, 0x0000, 0x0084,
+	    0x0000, 0x0218, 0x02f3, 0x0000, 0x02e7, 0x0252, 0x029c, 0x02de,
+	    0x02e8, 0x0000, 0x007c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0326,
+	    0x0000, 0x03a4, 0x0000, 0x0000, 0x0000, 0x00f9, 0x01a0, 0x0269,
+	    0x0270, 0x00fb, 0x0081, 0x001c, 0x025a, 0x0000, 0x01e0, 0x03d6,
+	    0x0000, 0x00eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ed, 0x0000,
+	    0x0000, 0x01ac, 0x03d0, 0x0000, 0x0000, 0x02ce, 0x0000, 0x0000,
+	    0x03c9, 0x0000, 0x02a0, 0x0000, 0x0019, 0x033c, 0x0103, 0x03c9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0299, 0x03a4, 0x0000, 0x03a4,
+	    0x0000, 0x0273, 0x00f6, 0x0000, 0x024e, 0x0000, 0x03ca, 0x02d9,
+	    0x0000, 0x01ae, 0x0000, 0x0000, 0x034b, 0x0207, 0x0000, 0x0000,
+	    0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x02af, 0x0000, 0x00ee,
+	    0x02ee, 0x0000, 0x0298, 0x0000, 0x0202, 0x0000, 0x0000, 0x0000,
+	    0x03e6, 0x003d, 0x0232, 0x0366, 0x01c2, 0x0000, 0x03ad, 0x01c7,
+	    0x0181, 0x02b9, 0x0000, 0x0000, 0x00b9, 0x03bd, 0x02d5, 0x02ef,
+	    0x0000, 0x01e1, 0x0000, 0x0000, 0x02f3, 0x0258, 0x03e5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x026a, 0x0000, 0x012d,
+	    0x0388, 0x0000, 0x0000, 0x0308, 0x0000, 0x00aa, 0x0113, 0x0000,
+	    0x0000, 0x017d, 0x02c3, 0x0000, 0x024f, 0x0351, 0x0000, 0x0000,
+	    0x00aa, 0x00f5, 0x0000, 0x0130, 0x0149, 0x0213, 0x0000, 0x038f,
+	    0x0000, 0x0363, 0x0354, 0x01f3, 0x0000, 0x0000, 0x020b, 0x0000,
+	    0x0000, 0x01f9, 0x0000, 0x0257, 0x02d4, 0x0000, 0x033d, 0x0000,
+	    0x0000, 0x018f, 0x03b0, 0x0000, 0x01fd, 0x0317, 0x0000, 0x0000,
+	    0x0000, 0x03c9, 0x0000, 0x0000, 0x00aa, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x03de, 0x00d4, 0x0000, 0x0019, 0x0181, 0x023d,
+	    0x0036, 0x0267, 0x02ef, 0x035a, 0x0000, 0x008f, 0x0000, 0x008d,
+	    0x0000, 0x01eb, 0x01e3, 0x03b4, 0x03bb, 0x026e, 0x0142, 0x0000,
+	    0x00e7, 0x0070, 0x0008, 0x0235, 0x0000, 0x01f7, 0x0000, 0x0000,
+	    0x010d, 0x01ee, 0x0000, 0x03ce, 0x01be, 0x0040, 0x0159, 0x02de,
+	    0x00d1, 0x0000, 0x0345, 0x0000, 0x0000, 0x0000, 0x0000, 0x0093,
+	    0x02de, 0x02d4, 0x015d, 0x0344, 0x0238, 0x02f4, 0x0000, 0x02b2,
+	    0x0000, 0x0000, 0x0000, 0x00a8, 0x0350, 0x0386, 0x032a, 0x0000,
+	    0x0000, 0x0000, 0x0367, 0x02b5, 0x0000, 0x0385, 0x03e5, 0x0000,
+	    0x028e, 0x008d, 0x0000, 0x0342, 0x0203, 0x0170, 0x0086, 0x0000,
+	    0x0000, 0x025d, 0x01bc, 0x0000, 0x0000, 0x0000, 0x0054, 0x0068,
+	    0x0000, 0x0000, 0x02f4, 0x0373, 0x0117, 0x0000, 0x00fd, 0x002a,
+	    0x02f9, 0x0000, 0x035b, 0x0000, 0x0000, 0x0118, 0x01d1, 0x0012,
+	    0x0000, 0x00a4, 0x0000, 0x02ca, 0x0000, 0x02a6, 0x0000, 0x0361,
+	    0x0161, 0x0252, 0x039a, 0x0017, 0x0015, 0x0089, 0x0000, 0x0000,
+	    0x0000, 0x0228, 0x0000, 0x0081, 0x0000, 0x0341, 0x0000, 0x0000,
+	    0x006a, 0x0000, 0x0000, 0x0000, 0x0000, 0x02af, 0x03db, 0x0381,
+	    0x0000, 0x03a2, 0x0104, 0x0000, 0x03db, 0x0174, 0x01bb, 0x00cc,
+	    0x0000, 0x0387, 0x0000, 0x0390, 0x02a5, 0x0000, 0x0000, 0x0072,
+	    0x0000, 0x038f, 0x0000, 0x01ba, 0x0275, 0x00b8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x005e, 0x0000, 0x0328, 0x00ea, 0x0000, 0x0000,
+	    0x0000, 0x0139, 0x0000, 0x03e6, 0x003e, 0x0000, 0x02f0, 0x0000,
+	    0x0000, 0x013e, 0x036e, 0x0000, 0x01ad, 0x00ea, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00fe, 0x023e, 0x0000, 0x0000, 0x0000,
+	    0x02fb, 0x0090, 0x00c1, 0x0000, 0x0000, 0x0017, 0x0285, 0x0000,
+	    0x0000, 0x0260, 0x0000, 0x01a4, 0x01aa, 0x0000, 0x0000, 0x0268,
+	    0x0000, 0x0000, 0x0266, 0x01b0, 0x01b5, 0x0000, 0x020c, 0x019e,
+	    0x012b, 0x000b, 0x0000, 0x0180, 0x0027, 0x016b, 0x0095, 0x0000,
+	    0x016c, 0x0000, 0x0000, 0x0080, 0x0000, 0x01c8, 0x01e5, 0x0316,
+	    0x0024, 0x000f, 0x0000, 0x0000, 0x00e4, 0x0000, 0x0000, 0x0000,
+	    0x03c7, 0x0000, 0x0000, 0x0000, 0x007b, 0x0000, 0x027e, 0x0000,
+	    0x0200, 0x0214, 0x0261, 0x0000, 0x0000, 0x0392, 0x0000, 0x031b,
+	    0x0009, 0x0000, 0x0000, 0x0267, 0x0000, 0x0000, 0x02a0, 0x0000,
+	    0x02c8, 0x0000, 0x02e2, 0x0000, 0x0198, 0x0096, 0x0000, 0x011f,
+	    0x0310, 0x00b8, 0x0000, 0x0000, 0x011b, 0x014b, 0x0000, 0x0000,
+	    0x0000, 0x02ca, 0x0394, 0x01b4, 0x0199, 0x01a7, 0x005c, 0x0000,
+	    0x0138, 0x0214, 0x0000, 0x0000, 0x0000, 0x0000, 0x009c, 0x0100,
+	    0x0000, 0x0000, 0x021a, 0x0159, 0x0120, 0x0000, 0x0000, 0x02fb,
+	    0x0036, 0x0000, 0x021c, 0x0000, 0x0257, 0x0000, 0x03d8, 0x0018,
+	    0x00b4, 0x0000, 0x0000, 0x0000, 0x0091, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0365, 0x0000, 0x0365, 0x0000, 0x0000, 0x0000, 0x00b9,
+	    0x02f6, 0x0264, 0x0000, 0x0000, 0x036f, 0x0000, 0x022e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0289, 0x031c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02f5, 0x025c, 0x0290, 0x0000, 0x0000,
+	    0x0000, 0x03da, 0x0000, 0x0000, 0x00c3, 0x0000, 0x03cd, 0x0000,
+	    0x0000, 0x0000, 0x033a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01d9, 0x0000, 0x0000, 0x0000, 0x03a0, 0x02a0, 0x0000, 0x03d7,
+	    0x0248, 0x0000, 0x0000, 0x03ac, 0x0000, 0x0000, 0x00c2, 0x0000,
+	    0x0000, 0x0141, 0x0000, 0x0070, 0x016f, 0x0160, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0235, 0x0000, 0x0000, 0x0356,
+	    0x0073, 0x0000, 0x0274, 0x000f, 0x024e, 0x0000, 0x02e5, 0x0000,
+	    0x018b, 0x0191, 0x0000, 0x0000, 0x0000, 0x030e, 0x01d2, 0x0000,
+	    0x025f, 0x0394, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x037f, 0x0000, 0x0163, 0x0133, 0x0000, 0x00ec,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0105,
+	    0x0099, 0x00cd, 0x00dc, 0x019a, 0x026f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0187, 0x02f6, 0x02ec, 0x0000, 0x021c, 0x00d1, 0x00a2,
+	    0x0000, 0x0000, 0x020c, 0x009f, 0x0162, 0x0000, 0x0000, 0x0000,
+	    0x006d, 0x0000, 0x0362, 0x0194, 0x0000, 0x0080, 0x02d2, 0x02e2,
+	    0x0000, 0x00d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01b9, 0x00e0, 0x0000, 0x0000, 0x03d5, 0x0031, 0x0000,
+	    0x01c8, 0x02c3, 0x02f1, 0x0000, 0x0000, 0x03c5, 0x02a4, 0x02d3,
+	    0x025a, 0x02fb, 0x0000, 0x0000, 0x0000, 0x01da, 0x0000, 0x0000,
+	    0x02e9, 0x039a, 0x0210, 0x0032, 0x02dc, 0x0000, 0x0283, 0x0000,
+	    0x0000, 0x00ec, 0x0215, 0x0020, 0x0000, 0x0000, 0x0000, 0x009c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0331, 0x0000, 0x0240, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x03a3, 0x0000, 0x0000, 0x0186,
+	    0x02df, 0x0000, 0x0153, 0x0000, 0x0000, 0x0000, 0x0319, 0x0000,
+	    0x0000, 0x03a4, 0x0000, 0x0000, 0x025e, 0x0000, 0x0000, 0x03cb,
+	    0x00fa, 0x0000, 0x0120, 0x0000, 0x00df, 0x0000, 0x0284, 0x0000,
+	    0x0133, 0x0000, 0x0000, 0x0000, 0x01c9, 0x0000, 0x0000, 0x0000,
+	    0x0232, 0x013f, 0x0000, 0x0246, 0x01a6, 0x0266, 0x022d, 0x0000,
+	    0x0000, 0x0000, 0x01bc, 0x0320, 0x00fa, 0x02bf, 0x0000, 0x03ae,
+	    0x0000, 0x0235, 0x009a, 0x0000, 0x0000, 0x0088, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0135, 0x0000, 0x0355, 0x0000, 0x0000, 0x004a,
+	    0x0000, 0x01e1, 0x0000, 0x0000, 0x0000, 0x02e0, 0x0343, 0x0264,
+	    0x0009, 0x0395, 0x0000, 0x0117, 0x0000, 0x01cd, 0x004f, 0x0000,
+	    0x0000, 0x02dc, 0x035d, 0x0000, 0x0198, 0x0249, 0x03d6, 0x0308,
+	    0x01ba, 0x0000, 0x01ba, 0x0000, 0x0000, 0x0000, 0x0314, 0x02ad,
+	    0x0089, 0x0000, 0x0000, 0x015a, 0x0364, 0x020c, 0x0222, 0x0000,
+	    0x0320, 0x0000, 0x005c, 0x0000, 0x00ea, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02a8, 0x02ca, 0x0336, 0x0280, 0x0000, 0x0000,
+	    0x0000, 0x0056, 0x01ff, 0x01dc, 0x0230, 0x0000, 0x0000, 0x0000,
+	    0x0219, 0x01fe, 0x0367, 0x0000, 0x0000, 0x03bd, 0x0000, 0x0055,
+	    0x0000, 0x0000, 0x0039, 0x0000, 0x0000, 0x0011, 0x0000, 0x001d,
+	    0x0000, 0x0000, 0x0000, 0x0101, 0x0323, 0x0000, 0x0000, 0x03d1,
+	    0x02db, 0x0000, 0x0000, 0x0000, 0x01f0, 0x0000, 0x0062, 0x0000,
+	    0x0109, 0x026d, 0x00db, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0273, 0x01e5, 0x0000, 0x0000, 0x0000, 0x0076,
+	    0x0000, 0x019b, 0x0000, 0x0000, 0x0291, 0x0000, 0x015f, 0x0093,
+	    0x0000, 0x0000, 0x0000, 0x030c, 0x0000, 0x03c6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x038b, 0x0237, 0x0360, 0x0000, 0x0000, 0x0000,
+	    0x01c3, 0x0000, 0x0170, 0x027f, 0x03e6, 0x01f2, 0x0000, 0x0314,
+	    0x01e6, 0x038f, 0x0209, 0x0000, 0x0000, 0x0125, 0x0000, 0x034d,
+	    0x0000, 0x0036, 0x0000, 0x0000, 0x0229, 0x00d9, 0x0299, 0x0000,
+	    0x0000, 0x0240, 0x0000, 0x0256, 0x01c4, 0x0110, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02a2, 0x0000, 0x0000, 0x027a, 0x0000, 0x0397,
+	    0x0188, 0x01a8, 0x00af, 0x004a, 0x022d, 0x0360, 0x0000, 0x02ef,
+	    0x0000, 0x0000, 0x01a7, 0x0000, 0x0000, 0x0000, 0x0270, 0x008d,
+	    0x0143, 0x0000, 0x026c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x019a, 0x012e, 0x0000, 0x001f, 0x01f4, 0x0000, 0x0000, 0x0000,
+	    0x0318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0229, 0x0253, 0x022c, 0x0000, 0x02b7, 0x0150, 0x00c8,
+	    0x005e, 0x021c, 0x0000, 0x0330, 0x0000, 0x00f3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0040, 0x0000, 0x0000, 0x0345, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x015e, 0x0347, 0x0000, 0x0000,
+	    0x0317, 0x0000, 0x0000, 0x01d9, 0x0339, 0x00a6, 0x0196, 0x0000,
+	    0x0000, 0x014c, 0x0000, 0x028c, 0x03bf, 0x0000, 0x00c2, 0x0234,
+	    0x0000, 0x0000, 0x02f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x008a, 0x0025, 0x01e1, 0x0000, 0x0000, 0x03b1, 0x0281, 0x0000,
+	    0x0000, 0x02c8, 0x02d1, 0x0203, 0x0000, 0x017b, 0x0000, 0x0000,
+	    0x0000,
+};
+
+constexpr uint16_t
+words(const char *key, size_t keylen)
+{
+	const uint16_t *g = words_g;
+	auto h = nbperf::split16(nbperf::mi_vector_hash(key, keylen, UINT32_C(0x238e1f29)));
+
+	h[0] = h[0] % 2001;
+	h[1] = h[1] % 2001;
+	const uint16_t result = (g[h[0]] + g[h[1]]) % 1000;
+	return words_keys[result] == std::string_view(key, keylen)
+	    ? result : (uint16_t)-1;
+}
+
+constexpr uint16_t
+words(std::string_view key)
+{
+	return words(key.data(), key.size());
+}
@@ -0,0 +1,146 @@
+/* generated with rurban/nbperf 08a5797 -b -e _test_Ebdz.bin _words */
+/* seed[0]: 1726956429, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#error "the tables in _test_Ebdz.bin are little-endian"
+#endif
+#ifdef __has_embed
+static _Alignas(64) const unsigned char hash_blob[] = {
+#embed "_test_Ebdz.bin"
+};
+#elif defined __ELF__
+__asm__(".pushsection .rodata\n"
+	".balign 64\n"
+	"hash_blob:\n"
+	".incbin \"_test_Ebdz.bin\"\n"
+	".popsection\n");
+extern const unsigned char hash_blob[];
+#else
+#error "_test_Ebdz.bin needs #embed or an ELF assembler"
+#endif
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+static const uint64_t *const hash_g = (const uint64_t *)(hash_blob + 0);
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	const uint64_t *g = hash_g;
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+	h[0] = h[0] % 24800;
+	h[1] = h[1] % 24800;
+	h[2] = h[2] % 24800;
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 24800;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return base_rank;
+}
+
+void
+hash_prefetch(const void * __restrict key, size_t keylen)
+{
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+	h[0] = h[0] % 24800;
+	h[1] = h[1] % 24800;
+	h[2] = h[2] % 24800;
+	__builtin_prefetch(&hash_g[GWORD(h[0])]);
+	__builtin_prefetch(&hash_g[GWORD(h[1])]);
+	__builtin_prefetch(&hash_g[GWORD(h[2])]);
+}
+
+void
+hash_batch(const void * __restrict const *keys, const size_t *keylens,
+	uint32_t *out, size_t n)
+{
+	const uint64_t *g = hash_g;
+	uint16_t hb[8][3];
+	uint32_t vb[8];
+
+	for (size_t s = 0; s < n; s += 8) {
+		const size_t nb = n - s < 8 ? n - s : 8;
+		for (size_t j = 0; j < nb; j++) {
+			const void *key = keys[s + j];
+			const size_t keylen = keylens[s + j];
+			uint16_t h[6];
+
+			mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+			h[0] = h[0] % 24800;
+			h[1] = h[1] % 24800;
+			h[2] = h[2] % 24800;
+			hb[j][0] = h[0];
+			__builtin_prefetch(&g[GWORD(h[0])]);
+			hb[j][1] = h[1];
+			__builtin_prefetch(&g[GWORD(h[1])]);
+			hb[j][2] = h[2];
+			__builtin_prefetch(&g[GWORD(h[2])]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint16_t *h = hb[j];
+			const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+			vb[j] = h[i % 3] % 24800;
+			__builtin_prefetch(&g[(vb[j] >> 5) / 7 * 8]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint32_t vertex = vb[j];
+			uint32_t index, base_rank, idx_v, idx_b;
+			const uint64_t *blk;
+			uint32_t result;
+			index = vertex >> 5;
+			idx_v = index % 7;
+			blk = g + index / 7 * 8;
+			base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+			base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+			idx_b = (vertex & 31) << 1;
+			base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+			    & ((UINT64_C(1) << idx_b) - 1));
+			result = base_rank;
+			out[s + j] = result;
+		}
+	}
+}
@@ -0,0 +1,112 @@
+/* generated with rurban/nbperf 08a5797 -b -e _test_Echm.bin _words */
+/* seed[0]: 1676902021, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#error "the tables in _test_Echm.bin are little-endian"
+#endif
+#ifdef __has_embed
+static _Alignas(64) const unsigned char hash_blob[] = {
+#embed "_test_Echm.bin"
+};
+#elif defined __ELF__
+__asm__(".pushsection .rodata\n"
+	".balign 64\n"
+	"hash_blob:\n"
+	".incbin \"_test_Echm.bin\"\n"
+	".popsection\n");
+extern const unsigned char hash_blob[];
+#else
+#error "_test_Echm.bin needs #embed or an ELF assembler"
+#endif
+
+#include <string.h>
+
+#ifndef NBPERF_GETBITS
+#define NBPERF_GETBITS
+static inline uint32_t _getbits(const uint8_t *g, uint64_t i, const unsigned bits)
+{
+	uint64_t x;
+	const uint64_t bit = i * bits;
+	memcpy(&x, g + (bit >> 3), sizeof(x));
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	x = __builtin_bswap64(x);
+#endif
+	return (uint32_t)((x >> (bit & 7)) & ((UINT64_C(1) << bits) - 1));
+}
+#endif
+
+const char *const hash_pool = (const char *)(hash_blob + 0);
+static const uint8_t *const hash_off = (const uint8_t *)(hash_blob + 166016);
+
+static inline int
+hash_keycmp(uint32_t i, const void *key, size_t keylen)
+{
+	const uint32_t o = _getbits(hash_off, i, 18);
+
+	return _getbits(hash_off, i + 1, 18) - o == keylen &&
+	    memcmp(hash_pool + o, key, keylen) == 0;
+}
+
+static const uint16_t *const hash_g = (const uint16_t *)(hash_blob + 211072);
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	uint16_t result;
+	const uint16_t *g = hash_g;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x63f37e85), (uint32_t *)h);
+
+	h[0] = h[0] % 40001;
+	h[1] = h[1] % 40001;
+	result = (g[h[0]] + g[h[1]]) % 20000;
+	return hash_keycmp(result, key, keylen) ? result : (uint16_t)-1;
+}
+
+void
+hash_prefetch(const void * __restrict key, size_t keylen)
+{
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x63f37e85), (uint32_t *)h);
+
+	h[0] = h[0] % 40001;
+	h[1] = h[1] % 40001;
+	__builtin_prefetch(&hash_g[h[0]]);
+	__builtin_prefetch(&hash_g[h[1]]);
+}
+
+void
+hash_batch(const void * __restrict const *keys, const size_t *keylens,
+	uint32_t *out, size_t n)
+{
+	const uint16_t *g = hash_g;
+	uint16_t hb[8][2];
+
+	for (size_t s = 0; s < n; s += 8) {
+		const size_t nb = n - s < 8 ? n - s : 8;
+		for (size_t j = 0; j < nb; j++) {
+			const void *key = keys[s + j];
+			const size_t keylen = keylens[s + j];
+			uint16_t h[6];
+
+			mi_vector_hash(key, keylen, UINT32_C(0x63f37e85), (uint32_t *)h);
+
+			h[0] = h[0] % 40001;
+			h[1] = h[1] % 40001;
+			hb[j][0] = h[0];
+			__builtin_prefetch(&g[h[0]]);
+			hb[j][1] = h[1];
+			__builtin_prefetch(&g[h[1]]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint16_t *h = hb[j];
+			uint16_t result = (g[h[0]] + g[h[1]]) % 20000;
+			out[s + j] = hash_keycmp(result, keys[s + j], keylens[s + j])
+			    ? result : (uint32_t)-1;
+		}
+	}
+}
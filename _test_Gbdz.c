@@ -0,0 +1,4195 @@
+/* generated with rurban/nbperf 08a5797 -b _words */
+/* seed[0]: 1726956429, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+
+#ifndef NBPERF_GETBITS
+#define NBPERF_GETBITS
+static inline uint32_t _getbits(const uint8_t *g, uint64_t i, const unsigned bits)
+{
+	uint64_t x;
+	const uint64_t bit = i * bits;
+	memcpy(&x, g + (bit >> 3), sizeof(x));
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	x = __builtin_bswap64(x);
+#endif
+	return (uint32_t)((x >> (bit & 7)) & ((UINT64_C(1) << bits) - 1));
+}
+#endif
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+static const uint8_t hash_output_order[37508] = {
+	     0x69, 0xb0, 0xf4, 0x1f, 0x19, 0x44, 0x4b, 0x09, 0xf4, 0x1b,
+	     0xdc, 0xd5, 0x0c, 0x66, 0x8f, 0x65, 0x23, 0x63, 0x50, 0xca,
+	     0x47, 0x1b, 0x41, 0x16, 0x04, 0xab, 0x58, 0x2f, 0xc9, 0x94,
+	     0x8a, 0xa8, 0x7c, 0x1d, 0x0b, 0xe8, 0x20, 0x08, 0xa5, 0x1a,
+	     0x01, 0xb9, 0xfe, 0xe2, 0x7e, 0x16, 0xa2, 0x80, 0x9a, 0x83,
+	     0x41, 0x01, 0xd6, 0xb3, 0xbb, 0x75, 0xcd, 0x4f, 0x84, 0x3e,
+	     0x1e, 0x9a, 0x1f, 0x15, 0xff, 0xed, 0x50, 0x12, 0xe0, 0xc2,
+	     0x44, 0x92, 0x5d, 0x0c, 0x96, 0x7d, 0xa4, 0xc7, 0x65, 0x05,
+	     0xa3, 0xaa, 0x65, 0x2b, 0xbb, 0x50, 0x45, 0x31, 0x98, 0x09,
+	     0x2e, 0x10, 0xbb, 0xd7, 0x24, 0xe2, 0x10, 0xe7, 0x41, 0x0b,
+	     0xbb, 0xa4, 0x97, 0x7c, 0x07, 0x55, 0x2f, 0x81, 0xc1, 0x1d,
+	     0x82, 0xb7, 0x37, 0x1f, 0x01, 0x06, 0x62, 0x5c, 0x3e, 0x5f,
+	     0xe8, 0x4c, 0x31, 0x1b, 0x10, 0x47, 0xe7, 0xd2, 0x26, 0x3a,
+	     0x40, 0xa0, 0x69, 0xa4, 0x49, 0xd1, 0x0e, 0xd0, 0x21, 0xe6,
+	     0x90, 0xd2, 0xb6, 0xdf, 0xa0, 0xab, 0x25, 0x29, 0xd6, 0x84,
+	     0xaa, 0xa6, 0x6c, 0x66, 0x15, 0x26, 0x61, 0x01, 0x4f, 0x2b,
+	     0x07, 0xc2, 0xac, 0x78, 0x97, 0x2c, 0x22, 0xf1, 0x42, 0xef,
+	     0xc8, 0xc0, 0x84, 0x10, 0x2a, 0xec, 0xe9, 0x1f, 0xaf, 0x7e,
+	     0xa2, 0xba, 0x0f, 0xe4, 0xa9, 0x51, 0x54, 0xc6, 0xfc, 0x63,
+	     0x7e, 0x05, 0x37, 0xee, 0x60, 0x24, 0x41, 0x4f, 0xe6, 0x95,
+	     0xab, 0xd4, 0x94, 0xa1, 0x9a, 0xd4, 0x81, 0x78, 0xd6, 0x5f,
+	     0x3a, 0x0a, 0x4c, 0x0f, 0x74, 0xe5, 0x0a, 0x73, 0xeb, 0xeb,
+	     0x01, 0x5e, 0x16, 0xed, 0x67, 0xa4, 0x9e, 0xaa, 0xe2, 0xd1,
+	     0x23, 0x88, 0xe2, 0x4a, 0x00, 0x00, 0x59, 0x74, 0x4a, 0x54,
+	     0xd2, 0xbf, 0x57, 0xa3, 0x5d, 0xa6, 0x31, 0xc1, 0xed, 0xd9,
+	     0x60, 0x76, 0x06, 0x6f, 0x95, 0x94, 0x3b, 0x36, 0x1d, 0xc5,
+	     0xcf, 0x3c, 0x16, 0x36, 0x33, 0xc4, 0x79, 0x64, 0x5e, 0x8e,
+	     0x14, 0x46, 0x35, 0xdc, 0x6b, 0xad, 0xac, 0x99, 0x9e, 0x58,
+	     0x06, 0xbd, 0xe0, 0x46, 0x3c, 0x19, 0x11, 0xab, 0x1f, 0x5f,
+	     0x0d, 0xde, 0xe5, 0x8f, 0x09, 0x3e, 0x9c, 0x29, 0x5c, 0x12,
+	     0x5f, 0x09, 0x6a, 0x12, 0xb0, 0x24, 0x57, 0xd4, 0x53, 0x78,
+	     0x89, 0xb0, 0x08, 0x35, 0x7b, 0x85, 0x9d, 0xb8, 0x52, 0xa6,
+	     0x8a, 0xb5, 0x15, 0xa3, 0x09, 0x78, 0xb8, 0xe8, 0xd8, 0x13,
+	     0x2f, 0xa6, 0xd3, 0x8d, 0xc6, 0x4f, 0x28, 0x53, 0x8a, 0xf4,
+	     0xce, 0xa9, 0xfb, 0x12, 0x35, 0x18, 0x4a, 0xb3, 0x10, 0x7d,
+	     0xb1, 0x46, 0x33, 0xb4, 0x53, 0x2b, 0x79, 0xb3, 0xe6, 0x1d,
+	     0x2d, 0x91, 0xf9, 0x8d, 0x45, 0x0e, 0x93, 0x88, 0x0a, 0x59,
+	     0xde, 0xc8, 0x76, 0x50, 0x98, 0xbd, 0x9c, 0xdf, 0x4b, 0x50,
+	     0xea, 0x8f, 0xc2, 0xa8, 0xb2, 0xcc, 0xb0, 0x37, 0x6a, 0x2b,
+	     0xab, 0x39, 0xcc, 0x19, 0x29, 0x2c, 0x13, 0x01, 0x2c, 0x6b,
+	     0x0c, 0xc0, 0x05, 0xe6, 0x43, 0xd2, 0x00, 0x60, 0x1f, 0x50,
+	     0x89, 0xe9, 0x67, 0xb9, 0x00, 0x9a, 0xc5, 0x33, 0x93, 0x8d,
+	     0xae, 0x86, 0xa0, 0x03, 0x2e, 0xa9, 0x76, 0x25, 0x7b, 0x04,
+	     0x79, 0x00, 0xdc, 0x82, 0x5f, 0x02, 0x87, 0x60, 0xd9, 0x9b,
+	     0x46, 0xcf, 0x97, 0x0f, 0xb3, 0xc6, 0x20, 0x7c, 0x26, 0x40,
+	     0x6f, 0xb2, 0xb4, 0xdc, 0x43, 0x80, 0xc5, 0xc6, 0x0b, 0xab,
+	     0x00, 0x94, 0xa9, 0x96, 0x48, 0xea, 0xb0, 0x18, 0x5d, 0xd4,
+	     0x2f, 0x48, 0x49, 0xe2, 0xf8, 0x1e, 0xa4, 0x20, 0x80, 0x6c,
+	     0xda, 0x2f, 0xe1, 0x5e, 0xde, 0x50, 0x23, 0xc8, 0x6e, 0xc2,
+	     0xaf, 0xbd, 0x0d, 0x20, 0x42, 0xfe, 0x05, 0x01, 0x19, 0xf1,
+	     0xa6, 0x1d, 0xd6, 0xc4, 0x1c, 0x6b, 0x99, 0x14, 0x74, 0x50,
+	     0x31, 0x0d, 0x8d, 0x96, 0x80, 0x85, 0x88, 0xe6, 0x78, 0x32,
+	     0x5f, 0x7e, 0x73, 0x8c, 0x26, 0x7e, 0x05, 0xfc, 0x80, 0x4d,
+	     0x33, 0xcd, 0xc8, 0xda, 0x71, 0x59, 0x34, 0x77, 0xd6, 0x00,
+	     0x67, 0x2e, 0xc5, 0xcb, 0xa5, 0x09, 0x97, 0xf7, 0x7a, 0x81,
+	     0x1a, 0x5c, 0xdf, 0xf6, 0x35, 0x33, 0x41, 0x61, 0x19, 0x5f,
+	     0xc7, 0xf0, 0x22, 0xb5, 0xbb, 0x54, 0x09, 0x57, 0xca, 0x66,
+	     0xd9, 0x1f, 0xcf, 0x63, 0xbd, 0x62, 0x1a, 0xf0, 0x16, 0xea,
+	     0x21, 0x0e, 0x13, 0xb6, 0x21, 0xbc, 0x05, 0x2a, 0x15, 0xf8,
+	     0x01, 0x61, 0x85, 0x4a, 0x3b, 0x98, 0x34, 0x0f, 0x90, 0x52,
+	     0xee, 0x1e, 0x80, 0x02, 0x4d, 0xd1, 0xbe, 0xf4, 0x5f, 0xcb,
+	     0x81, 0x71, 0x8b, 0x3a, 0x93, 0xd9, 0x82, 0x3f, 0x55, 0xfb,
+	     0x2e, 0xdc, 0x74, 0x46, 0xd1, 0x44, 0x2e, 0xa8, 0x60, 0x31,
+	     0xfa, 0x21, 0x24, 0x09, 0xf6, 0x01, 0x69, 0xa9, 0x7b, 0xeb,
+	     0x35, 0x62, 0x81, 0x64, 0x7f, 0x72, 0x11, 0x43, 0x63, 0xa2,
+	     0xae, 0x74, 0xa9, 0x4d, 0x92, 0x8a, 0x24, 0xdd, 0x7c, 0x5b,
+	     0x40, 0xb0, 0xe3, 0x14, 0x1e, 0xe8, 0xbe, 0x03, 0x0d, 0x92,
+	     0xae, 0x89, 0x61, 0x4a, 0x64, 0x89, 0x2c, 0xec, 0x51, 0x66,
+	     0xae, 0xd7, 0x42, 0x48, 0xc1, 0xa3, 0xec, 0x39, 0x78, 0x30,
+	     0xc6, 0x1f, 0x6e, 0x9a, 0x42, 0x42, 0x5c, 0x90, 0x3f, 0x7c,
+	     0x7d, 0x70, 0x24, 0x6f, 0x4f, 0xcd, 0xae, 0x67, 0x53, 0x6d,
+	     0xa7, 0x8e, 0xf7, 0x3d, 0x29, 0x68, 0xc1, 0x5b, 0x9a, 0x56,
+	     0xcf, 0x24, 0x53, 0xa0, 0x14, 0x70, 0x18, 0x58, 0x99, 0x88,
+	     0x5e, 0x8a, 0xa2, 0x2e, 0x71, 0x1c, 0xcc, 0x16, 0x46, 0xf5,
+	     0xf1, 0x0d, 0xd7, 0x09, 0x13, 0x9a, 0xc8, 0xdf, 0x06, 0x43,
+	     0xa6, 0x05, 0x62, 0x0e, 0x32, 0xc0, 0x70, 0xf8, 0xca, 0xc2,
+	     0x10, 0x7e, 0x0b, 0xee, 0x40, 0x0d, 0xa8, 0xd4, 0x86, 0xcf,
+	     0x68, 0x42, 0x55, 0x22, 0xdc, 0x49, 0xa6, 0xb4, 0x74, 0x19,
+	     0xfd, 0xa8, 0x5d, 0x0e, 0xcb, 0x49, 0x46, 0xb6, 0x9f, 0xb4,
+	     0x57, 0x49, 0xcc, 0x62, 0x29, 0x44, 0x19, 0x4a, 0x1c, 0x64,
+	     0xae, 0x50, 0xc0, 0xd0, 0xe3, 0xcb, 0x91, 0xb4, 0x36, 0x83,
+	     0x7e, 0x1e, 0x7b, 0xc9, 0x01, 0xe1, 0x5e, 0xb4, 0xa4, 0xb0,
+	     0xa0, 0xf4, 0xfd, 0x58, 0x3a, 0x10, 0xb8, 0x87, 0x0d, 0xf5,
+	     0x91, 0x5e, 0x88, 0x55, 0xf8, 0x63, 0x78, 0x2d, 0xdc, 0x45,
+	     0x91, 0x9c, 0x36, 0x13, 0xfa, 0x11, 0xb6, 0xc5, 0x74, 0xda,
+	     0x05, 0x08, 0x01, 0x3d, 0x4c, 0xbd, 0x30, 0xb0, 0x21, 0xef,
+	     0x83, 0x52, 0x49, 0x31, 0x60, 0xd6, 0x1c, 0x7e, 0x26, 0x21,
+	     0x0e, 0xca, 0x35, 0x10, 0xc1, 0x45, 0x35, 0x82, 0x6e, 0xa1,
+	     0xa6, 0xa8, 0x43, 0x1c, 0x7c, 0xe7, 0x2b, 0xf0, 0x14, 0x0d,
+	     0x4c, 0x5f, 0x68, 0x05, 0x60, 0x1d, 0x70, 0x9e, 0xcc, 0x17,
+	     0xba, 0x31, 0xfd, 0x14, 0xfe, 0x82, 0xd1, 0x16, 0xa4, 0x8a,
+	     0x6a, 0x62, 0x00, 0xab, 0x01, 0xcd, 0x44, 0xf9, 0x21, 0x64,
+	     0x50, 0x1c, 0x20, 0x4f, 0xf2, 0x93, 0x11, 0x60, 0x76, 0x05,
+	     0x6e, 0x9c, 0x26, 0xdc, 0x5b, 0xc7, 0x97, 0xa2, 0xa4, 0x44,
+	     0x3f, 0x79, 0x09, 0x00, 0x4e, 0x0e, 0x23, 0x37, 0xdf, 0x30,
+	     0x0e, 0x4f, 0xd3, 0xa7, 0x69, 0x60, 0xd2, 0x08, 0x8d, 0x8a,
+	     0x02, 0xb6, 0x43, 0x85, 0x2a, 0x83, 0x19, 0x14, 0xa8, 0xeb,
+	     0x12, 0xe9, 0x9c, 0x54, 0x00, 0xc8, 0x17, 0xde, 0xd5, 0x0b,
+	     0xab, 0xad, 0x02, 0x6f, 0x4c, 0x44, 0xd4, 0x31, 0x83, 0x8f,
+	     0x1e, 0xae, 0xd3, 0x64, 0x0b, 0x25, 0xd8, 0x36, 0x2a, 0xf1,
+	     0xd2, 0x81, 0x37, 0x77, 0x2f, 0x47, 0xcc, 0x7f, 0x24, 0xac,
+	     0x2a, 0x30, 0xe0, 0x45, 0x2c, 0xb1, 0x69, 0x25, 0xf8, 0x5a,
+	     0xa9, 0xc6, 0x94, 0xd7, 0xf0, 0x4e, 0x8d, 0x23, 0x75, 0xf4,
+	     0x5d, 0xd0, 0x28, 0x03, 0x77, 0xfb, 0x35, 0x63, 0xcf, 0xbe,
+	     0xa8, 0x57, 0x72, 0x0d, 0x10, 0x41, 0xc8, 0xca, 0x22, 0x26,
+	     0x67, 0x06, 0xf4, 0xa4, 0xae, 0x46, 0x31, 0xa1, 0x18, 0x14,
+	     0x5c, 0x78, 0x2d, 0x5d, 0x46, 0x97, 0x46, 0x15, 0x86, 0x04,
+	     0xb3, 0x83, 0xa7, 0xc6, 0x13, 0x03, 0xb0, 0x90, 0xa8, 0x6b,
+	     0x01, 0x09, 0xb8, 0xdf, 0x0e, 0x23, 0x44, 0xa7, 0xb5, 0x5c,
+	     0x1a, 0x85, 0x67, 0x54, 0x51, 0xaa, 0x18, 0x59, 0xde, 0x72,
+	     0xa0, 0x62, 0xd7, 0xac, 0x2c, 0xcd, 0xed, 0xa7, 0x5e, 0x7f,
+	     0x05, 0x01, 0x47, 0xd2, 0x8b, 0xa7, 0xc5, 0x05, 0x26, 0xdb,
+	     0xf1, 0xa4, 0x65, 0xc6, 0x25, 0x22, 0x9a, 0x86, 0x0f, 0x27,
+	     0xf3, 0xa2, 0xe3, 0xd9, 0xe0, 0x37, 0xf0, 0xfd, 0x04, 0x92,
+	     0x48, 0x48, 0xd4, 0x46, 0x79, 0x4d, 0x97, 0x46, 0xb3, 0xf4,
+	     0x25, 0x25, 0x16, 0xe3, 0x62, 0xfd, 0xb1, 0x8a, 0xc8, 0xee,
+	     0x6d, 0x24, 0xf2, 0xa0, 0x8c, 0x68, 0xd6, 0x1d, 0x48, 0x4f,
+	     0xfb, 0x21, 0x6d, 0xdd, 0x41, 0x07, 0xbe, 0x35, 0x9b, 0x92,
+	     0x90, 0x3d, 0xb8, 0xde, 0x85, 0x78, 0xb8, 0x2b, 0x8a, 0x69,
+	     0x24, 0x28, 0x12, 0xf0, 0x5a, 0x9c, 0xd5, 0x60, 0x18, 0x98,
+	     0x61, 0x38, 0x40, 0x1d, 0xd3, 0xd0, 0x00, 0x67, 0xad, 0x93,
+	     0x40, 0xe6, 0xa1, 0x54, 0x20, 0xd0, 0x04, 0xc1, 0x56, 0x7a,
+	     0x63, 0xaa, 0x81, 0x45, 0x43, 0x9a, 0x14, 0x1d, 0x38, 0x56,
+	     0xaf, 0x1c, 0x44, 0x5a, 0x73, 0x8e, 0xb4, 0xe8, 0x5c, 0x00,
+	     0x24, 0xcd, 0xcc, 0x86, 0x14, 0x4d, 0x49, 0xbd, 0xe2, 0x56,
+	     0x4a, 0xb9, 0x22, 0x41, 0xe9, 0xda, 0xe8, 0x05, 0x9c, 0x62,
+	     0xc1, 0x24, 0x33, 0x11, 0x55, 0x92, 0x3f, 0x76, 0x89, 0x9c,
+	     0x8f, 0xa9, 0xce, 0x58, 0x9a, 0x7c, 0x23, 0x88, 0x92, 0x57,
+	     0x8a, 0x75, 0x56, 0x6b, 0x74, 0x6c, 0xbd, 0xf4, 0xac, 0x3f,
+	     0x39, 0x95, 0x97, 0x81, 0xee, 0x50, 0x48, 0x74, 0x2e, 0x5a,
+	     0x94, 0xd8, 0x36, 0x61, 0x51, 0x80, 0x42, 0xc0, 0xd9, 0xe1,
+	     0x91, 0x64, 0x27, 0x9e, 0x39, 0x0b, 0x2e, 0x13, 0x84, 0x1c,
+	     0x36, 0x25, 0x6e, 0xa4, 0x01, 0x2b, 0xef, 0x82, 0xbf, 0xb2,
+	     0x7a, 0x35, 0x4c, 0x70, 0x6e, 0xf8, 0x90, 0x24, 0x0d, 0xba,
+	     0xc3, 0xde, 0xe7, 0x48, 0xe8, 0x8b, 0x9d, 0xcd, 0x92, 0x65,
+	     0x83, 0x1b, 0x35, 0x51, 0xa0, 0xf1, 0xb4, 0x01, 0x7f, 0xba,
+	     0xca, 0xe8, 0x06, 0x98, 0x40, 0x2b, 0xba, 0x33, 0x8c, 0x99,
+	     0xb1, 0xd9, 0x91, 0x7e, 0x4b, 0xed, 0xf9, 0x16, 0x06, 0x19,
+	     0xb6, 0xc0, 0xd9, 0x62, 0x8c, 0x30, 0x39, 0xf6, 0x87, 0xf8,
+	     0x75, 0xe1, 0x1a, 0x90, 0x68, 0x4f, 0x98, 0x6b, 0x0b, 0x4b,
+	     0xf2, 0xc8, 0xb1, 0xb0, 0x10, 0x01, 0xba, 0xba, 0x4a, 0x14,
+	     0x70, 0x48, 0xa9, 0xd2, 0xd1, 0xa2, 0xe3, 0xd5, 0xbd, 0xfa,
+	     0xf7, 0x10, 0x43, 0x52, 0x0b, 0xa4, 0x9f, 0x21, 0x43, 0x64,
+	     0x91, 0x0f, 0x49, 0x6b, 0xa8, 0x11, 0xbc, 0x5d, 0x3e, 0x5a,
+	     0xad, 0xbc, 0x90, 0x54, 0x16, 0xae, 0x3e, 0x19, 0x38, 0x49,
+	     0x5b, 0xa5, 0x7f, 0x24, 0x09, 0xda, 0xbc, 0x23, 0x8d, 0x90,
+	     0xf0, 0x37, 0x24, 0x16, 0x9b, 0x61, 0x46, 0x06, 0x57, 0x85,
+	     0xc5, 0x04, 0x4b, 0x8b, 0xb1, 0xa9, 0x79, 0xc6, 0xb4, 0x64,
+	     0xe5, 0xe9, 0x0c, 0x38, 0x2c, 0xa9, 0x10, 0x68, 0xd2, 0x59,
+	     0x4c, 0x50, 0xe6, 0x33, 0x33, 0x0c, 0xd9, 0x42, 0x7a, 0x8b,
+	     0xf7, 0x82, 0x2f, 0x94, 0xc0, 0x91, 0x46, 0x41, 0xd6, 0xf8,
+	     0x25, 0xe2, 0x93, 0x7e, 0x3c, 0x0e, 0x88, 0xda, 0x9f, 0x22,
+	     0xe8, 0x65, 0x03, 0x1e, 0x5c, 0x47, 0xb9, 0x11, 0xe3, 0x24,
+	     0x4f, 0xb8, 0x8a, 0x66, 0xe2, 0x0a, 0xe5, 0x13, 0x8c, 0x39,
+	     0x2e, 0x05, 0x6f, 0x48, 0x3e, 0x15, 0x96, 0x5a, 0x51, 0x04,
+	     0xb2, 0x28, 0xe9, 0x65, 0xe0, 0x6a, 0x65, 0x57, 0x08, 0x75,
+	     0xee, 0xc2, 0xca, 0x98, 0xd0, 0x8c, 0x50, 0xf4, 0x87, 0xd4,
+	     0x1a, 0xd8, 0x9c, 0xae, 0x1d, 0x2b, 0x25, 0x4b, 0x4a, 0x1d,
+	     0x28, 0x17, 0x36, 0x2b, 0x9c, 0xbf, 0x1d, 0x2c, 0xac, 0x46,
+	     0xa1, 0x3b, 0xf1, 0xe6, 0xd1, 0xe6, 0xad, 0xf5, 0x32, 0x24,
+	     0x6b, 0x25, 0x18, 0xee, 0x47, 0xef, 0x31, 0x89, 0x85, 0xc6,
+	     0xcb, 0x7b, 0x94, 0xbf, 0xc2, 0xcf, 0x78, 0xf2, 0x4a, 0x6d,
+	     0x45, 0x0b, 0x83, 0x18, 0x19, 0x86, 0x64, 0xf0, 0xf2, 0x48,
+	     0x01, 0x55, 0xac, 0xce, 0x1f, 0x75, 0x10, 0x36, 0xcd, 0x03,
+	     0x0f, 0xa5, 0x82, 0x3e, 0xe2, 0xdb, 0x98, 0x70, 0x42, 0x82,
+	     0xd9, 0xaf, 0xfe, 0xe6, 0x58, 0x72, 0x44, 0x19, 0x58, 0x34,
+	     0xaa, 0x61, 0x6b, 0xce, 0x9b, 0x69, 0x06, 0x29, 0x04, 0x7a,
+	     0xd0, 0x65, 0x85, 0xf3, 0xf0, 0x77, 0xa9, 0x76, 0x94, 0x0b,
+	     0xab, 0xa2, 0x89, 0x65, 0xad, 0x06, 0x4f, 0xa6, 0x2d, 0xe2,
+	     0x12, 0xf2, 0x62, 0xb8, 0x0d, 0xd5, 0x19, 0x7a, 0x4f, 0x1e,
+	     0xa5, 0x0a, 0x27, 0x97, 0x1c, 0x66, 0x00, 0x34, 0xa7, 0x81,
+	     0xbd, 0x0f, 0x54, 0x50, 0x64, 0x2b, 0xd8, 0xc0, 0x9e, 0x8c,
+	     0x1d, 0x85, 0x08, 0xe1, 0x92, 0x52, 0x81, 0x2a, 0x85, 0x92,
+	     0xe4, 0x0c, 0x84, 0xfb, 0x49, 0xf8, 0xe5, 0x0b, 0x12, 0x80,
+	     0x1e, 0x43, 0xfc, 0x83, 0xc0, 0x27, 0x90, 0xc4, 0x09, 0x6c,
+	     0x16, 0x96, 0x0c, 0x36, 0x6d, 0xd0, 0x45, 0xb2, 0x53, 0x05,
+	     0xea, 0xf0, 0x22, 0x1a, 0xfc, 0x7a, 0x38, 0xf1, 0x02, 0x32,
+	     0x62, 0x01, 0x15, 0x4c, 0x03, 0x20, 0x31, 0x03, 0x7c, 0x2a,
+	     0xa3, 0x91, 0x1e, 0x1d, 0x48, 0x7e, 0x91, 0x21, 0x09, 0xd0,
+	     0x0a, 0x1f, 0xd3, 0x62, 0x68, 0x35, 0x2e, 0x46, 0x10, 0x13,
+	     0x46, 0x49, 0x87, 0x07, 0xa6, 0xf2, 0xb8, 0x65, 0x86, 0x30,
+	     0x63, 0x09, 0xac, 0x78, 0x33, 0x05, 0x27, 0x6c, 0xa5, 0x1b,
+	     0x52, 0x18, 0x21, 0x25, 0x58, 0x3a, 0x9c, 0xd8, 0x0a, 0x7e,
+	     0x54, 0xc8, 0x4f, 0x8e, 0x7b, 0x93, 0x48, 0x63, 0x75, 0xd3,
+	     0x42, 0x46, 0x38, 0x77, 0x55, 0x8e, 0x01, 0xc2, 0xd0, 0x6d,
+	     0x82, 0x40, 0xc5, 0xd0, 0x82, 0x08, 0xd0, 0x37, 0x67, 0x89,
+	     0xa6, 0x25, 0xf0, 0xcb, 0x75, 0x27, 0xdc, 0xd1, 0x60, 0x39,
+	     0x1c, 0x92, 0xa0, 0x4a, 0x3d, 0xad, 0x08, 0xe5, 0x17, 0x8e,
+	     0xe3, 0x63, 0x23, 0x9d, 0xf2, 0xf5, 0x35, 0xf5, 0x2c, 0x4e,
+	     0x8c, 0x47, 0xb1, 0xd5, 0xc2, 0x6e, 0xb8, 0xa4, 0x75, 0x31,
+	     0x29, 0x31, 0x01, 0x67, 0x05, 0x97, 0x8e, 0x11, 0x42, 0x3b,
+	     0x2e, 0x34, 0xd8, 0x8c, 0x6a, 0xb0, 0x7d, 0x7c, 0x34, 0x3c,
+	     0xba, 0x23, 0x30, 0x45, 0xbb, 0xc0, 0x71, 0xc2, 0xda, 0xf3,
+	     0x38, 0xa6, 0x55, 0xa6, 0x23, 0xc8, 0xc7, 0x7c, 0x93, 0x04,
+	     0xc2, 0x9b, 0x12, 0x89, 0xf3, 0x24, 0x36, 0x9f, 0x80, 0x06,
+	     0x87, 0x83, 0x95, 0xdb, 0xeb, 0x20, 0x0a, 0x06, 0x59, 0x7a,
+	     0x54, 0xa8, 0x59, 0xc8, 0x23, 0xc5, 0x49, 0x60, 0x8a, 0x38,
+	     0xa7, 0xd6, 0x12, 0xcc, 0x43, 0x13, 0xe6, 0x28, 0xfe, 0x0e,
+	     0xab, 0x15, 0x65, 0xe0, 0x8e, 0x4e, 0xe5, 0x13, 0x6b, 0xf3,
+	     0x2b, 0x1e, 0x00, 0x37, 0x2b, 0x6b, 0xbe, 0x0f, 0x8a, 0x01,
+	     0xa9, 0xf2, 0x92, 0xe5, 0xb9, 0x38, 0xa2, 0x53, 0x92, 0x70,
+	     0xaf, 0x80, 0x6c, 0x85, 0x11, 0x62, 0x1c, 0x49, 0x8d, 0xf1,
+	     0x0d, 0x54, 0x36, 0xe8, 0x51, 0xf7, 0x0d, 0xdc, 0xd6, 0xc5,
+	     0x6b, 0x34, 0xf1, 0x00, 0x9b, 0x33, 0xa8, 0x30, 0xe9, 0x35,
+	     0x89, 0xa7, 0xb0, 0xe2, 0xb5, 0x87, 0xeb, 0x67, 0x0d, 0xe9,
+	     0x98, 0x1c, 0xd3, 0x9c, 0x5f, 0x8e, 0xbc, 0x64, 0x11, 0x9d,
+	     0x0e, 0xb6, 0xc8, 0x7e, 0x62, 0x22, 0xc1, 0x21, 0xee, 0x17,
+	     0xfa, 0x96, 0xb1, 0x26, 0xd3, 0x44, 0x96, 0xf6, 0x66, 0x0a,
+	     0xb2, 0xac, 0x67, 0x4a, 0x90, 0xfa, 0x2c, 0xce, 0xc0, 0x05,
+	     0x50, 0xff, 0x50, 0xee, 0xf1, 0x6e, 0x74, 0x1f, 0x07, 0x38,
+	     0xa1, 0x1b, 0xda, 0xdb, 0x64, 0x2d, 0xd8, 0x88, 0x03, 0x4c,
+	     0xdf, 0x55, 0x84, 0xf2, 0x18, 0xe3, 0xbd, 0x9a, 0xcc, 0x85,
+	     0x0f, 0xef, 0x31, 0xd1, 0xe3, 0x17, 0x64, 0x40, 0x52, 0x5f,
+	     0x8d, 0x10, 0x10, 0x1b, 0xee, 0xd2, 0xa0, 0xe2, 0x5a, 0x7a,
+	     0xbf, 0xd4, 0x08, 0xa7, 0x55, 0x93, 0x36, 0xb7, 0xe5, 0x5a,
+	     0x10, 0x0e, 0x60, 0xbd, 0x88, 0x58, 0x82, 0x04, 0xc7, 0x63,
+	     0x98, 0x4b, 0x8e, 0xd3, 0x19, 0xab, 0x83, 0x05, 0xbc, 0x21,
+	     0xc1, 0xa9, 0xb5, 0x76, 0x25, 0x51, 0xca, 0xdc, 0x16, 0x27,
+	     0x0e, 0x77, 0x47, 0x9d, 0x9b, 0x5f, 0xf8, 0x20, 0xc8, 0x7d,
+	     0x82, 0xa9, 0x9a, 0x8f, 0xc2, 0xe2, 0x1e, 0x32, 0x1a, 0x28,
+	     0x3c, 0xf2, 0x29, 0x65, 0x57, 0x71, 0x03, 0x45, 0xc0, 0x84,
+	     0x4f, 0x03, 0x86, 0xb0, 0xc9, 0xdf, 0x05, 0x6b, 0xd6, 0x0c,
+	     0x4d, 0x8e, 0x78, 0x0c, 0xbf, 0xaa, 0xcc, 0xc8, 0x1a, 0x4a,
+	     0x53, 0x4c, 0x87, 0xf4, 0x99, 0x32, 0xc8, 0x26, 0x54, 0x14,
+	     0x10, 0xe5, 0xe8, 0x18, 0x43, 0x0b, 0xca, 0x14, 0x52, 0x4f,
+	     0x37, 0xb5, 0x11, 0x87, 0x50, 0xa1, 0x3b, 0xa2, 0x9b, 0x61,
+	     0x21, 0x0a, 0x2a, 0x3c, 0x9b, 0x3a, 0x15, 0x3f, 0x89, 0xf9,
+	     0xb0, 0xc6, 0x84, 0x64, 0x4a, 0xcc, 0xb5, 0x3f, 0x56, 0x15,
+	     0x01, 0x4d, 0xf8, 0x43, 0x36, 0x48, 0x3b, 0x17, 0x0c, 0x3b,
+	     0xba, 0x60, 0x8d, 0xb2, 0x2f, 0xfc, 0x39, 0x24, 0x11, 0x1f,
+	     0x45, 0x24, 0xa5, 0x20, 0xd4, 0xbd, 0xcc, 0xa2, 0x36, 0x14,
+	     0xb9, 0x4a, 0x89, 0xc2, 0xad, 0x22, 0x51, 0x00, 0x57, 0xf9,
+	     0xfb, 0x08, 0x46, 0x9c, 0x55, 0xa3, 0x9d, 0x64, 0x4d, 0xe0,
+	     0x32, 0xb7, 0x47, 0xf4, 0xc1, 0x1a, 0xa0, 0x65, 0xb6, 0x73,
+	     0x5d, 0x14, 0x5d, 0xd5, 0x26, 0x88, 0xf2, 0xe1, 0x37, 0xd1,
+	     0xcf, 0x84, 0xf2, 0x92, 0x1f, 0xeb, 0x09, 0xdf, 0xca, 0x34,
+	     0x12, 0x88, 0x22, 0x9f, 0x7a, 0x4d, 0xc4, 0x26, 0x3a, 0x08,
+	     0x2a, 0xbf, 0x29, 0xce, 0x03, 0xd2, 0x7f, 0xc4, 0xb1, 0x93,
+	     0x1e, 0x42, 0x80, 0xb2, 0x80, 0xa2, 0x1f, 0xf9, 0x9f, 0x1e,
+	     0xaf, 0xb1, 0x18, 0xcc, 0x6a, 0x53, 0xd8, 0x0d, 0x39, 0x7c,
+	     0x38, 0xc5, 0x9b, 0x43, 0x76, 0xab, 0x36, 0x43, 0x0a, 0x72,
+	     0x8b, 0x61, 0x94, 0x8e, 0x14, 0x52, 0x24, 0xe2, 0x5e, 0x8e,
+	     0x80, 0x47, 0x22, 0x6b, 0x83, 0xee, 0xd4, 0xe1, 0x02, 0x68,
+	     0xfe, 0x16, 0xd2, 0xdf, 0xee, 0x4a, 0x9d, 0x00, 0x0d, 0x94,
+	     0x7b, 0x9d, 0x2e, 0x08, 0x0b, 0x7d, 0x34, 0x99, 0x5a, 0xdd,
+	     0x68, 0x2d, 0x81, 0x05, 0xb0, 0x35, 0x1c, 0x10, 0xfd, 0x19,
+	     0x5b, 0x32, 0x2b, 0x16, 0x45, 0xad, 0xbc, 0x95, 0x9f, 0x9a,
+	     0x77, 0xdd, 0x8c, 0xa4, 0x93, 0x2e, 0xcd, 0x50, 0xca, 0x7e,
+	     0xb1, 0x4a, 0x90, 0x2b, 0x50, 0xd0, 0xe8, 0x83, 0xea, 0x75,
+	     0xfd, 0xae, 0x52, 0xa3, 0xd3, 0xe9, 0x40, 0x33, 0xf5, 0x28,
+	     0x88, 0xb9, 0x30, 0xef, 0x4d, 0x06, 0x17, 0x1f, 0x49, 0x50,
+	     0xae, 0x31, 0xa3, 0x8f, 0xb9, 0x0a, 0xec, 0x12, 0x73, 0x06,
+	     0x54, 0xc0, 0xf4, 0x93, 0xcb, 0x27, 0xa8, 0x84, 0xa4, 0x04,
+	     0xf0, 0xb0, 0x64, 0xac, 0x09, 0xf3, 0x06, 0xfe, 0xa2, 0xf0,
+	     0x6e, 0x77, 0x34, 0x9e, 0x68, 0xaa, 0xec, 0x94, 0x8c, 0x56,
+	     0x8d, 0x2d, 0x96, 0x5e, 0x91, 0x11, 0xd0, 0x66, 0xf3, 0x93,
+	     0x59, 0x9e, 0xe3, 0xac, 0x78, 0x7c, 0xc0, 0x33, 0x02, 0xc8,
+	     0x0a, 0xfc, 0x14, 0xd4, 0x2a, 0xa1, 0x18, 0x11, 0xb1, 0x5f,
+	     0x88, 0x1d, 0x88, 0x9a, 0xa9, 0xf0, 0x82, 0x59, 0x54, 0xe0,
+	     0x0f, 0x7e, 0x1b, 0x7a, 0x0c, 0x21, 0xaf, 0xc8, 0x5b, 0xa9,
+	     0xcc, 0x2c, 0xc9, 0x5b, 0xa3, 0x50, 0xe5, 0x42, 0xc8, 0x93,
+	     0xe5, 0xb9, 0x19, 0x54, 0xd8, 0x6b, 0x2d, 0xa6, 0x8a, 0x58,
+	     0x23, 0x64, 0xb6, 0xd0, 0x0d, 0xaf, 0x4d, 0x22, 0x8b, 0x6b,
+	     0x28, 0xd6, 0x27, 0x7b, 0x80, 0x1a, 0xf9, 0x25, 0xf9, 0x2d,
+	     0xe8, 0x92, 0xca, 0x49, 0x3a, 0x60, 0xe5, 0x84, 0xd9, 0x44,
+	     0xd9, 0xe8, 0x82, 0xc0, 0x6c, 0x2e, 0x2a, 0xfc, 0xa2, 0x33,
+	     0x8c, 0xfb, 0x35, 0x8d, 0x21, 0x68, 0x8d, 0xa3, 0xec, 0x40,
+	     0x92, 0xb2, 0x9e, 0x0f, 0x68, 0x83, 0xed, 0xb8, 0xb4, 0x39,
+	     0x83, 0x44, 0xec, 0xec, 0x83, 0x3e, 0x3d, 0x97, 0xe4, 0x39,
+	     0x4b, 0x13, 0xb1, 0x3e, 0x43, 0x45, 0x64, 0xca, 0x24, 0x17,
+	     0x4d, 0x94, 0x01, 0x5b, 0x4b, 0x82, 0x58, 0x46, 0xb1, 0xd4,
+	     0x5c, 0x09, 0xbc, 0x36, 0x69, 0x70, 0x8b, 0xd0, 0x15, 0x99,
+	     0x6b, 0x1f, 0x35, 0x21, 0x20, 0x64, 0x1c, 0x4d, 0x98, 0x8c,
+	     0xdb, 0xcd, 0x62, 0x5a, 0x3a, 0x08, 0x9b, 0xa6, 0x1e, 0x31,
+	     0x34, 0x88, 0x05, 0xc1, 0x8a, 0x40, 0x85, 0xbe, 0x83, 0x32,
+	     0xef, 0x68, 0x69, 0xac, 0x83, 0xc9, 0x69, 0x4c, 0x6a, 0x7c,
+	     0x73, 0xa2, 0xb6, 0x97, 0x56, 0x32, 0xa7, 0x17, 0x4d, 0x50,
+	     0x4c, 0x3d, 0x18, 0x75, 0x75, 0xe2, 0xb0, 0x5c, 0x61, 0x23,
+	     0xed, 0x90, 0x04, 0xa7, 0xaa, 0xa2, 0x21, 0x5a, 0x0e, 0x58,
+	     0x81, 0x00, 0x69, 0xc9, 0xe5, 0xcc, 0x33, 0x78, 0xd5, 0xfa,
+	     0x01, 0x9e, 0x07, 0xe2, 0x47, 0x6d, 0x3a, 0x7e, 0xcc, 0x64,
+	     0x25, 0x49, 0xf8, 0x8e, 0xc1, 0x88, 0xd0, 0x27, 0x67, 0x1f,
+	     0x5b, 0x1f, 0x80, 0x4e, 0xd8, 0x8d, 0xa6, 0x83, 0xd3, 0xd3,
+	     0x39, 0x60, 0xa4, 0x90, 0x0e, 0xca, 0x94, 0x90, 0x93, 0xe7,
+	     0xe2, 0x3a, 0x62, 0xe1, 0xda, 0x95, 0x6d, 0x3d, 0xc6, 0x04,
+	     0x41, 0xc9, 0xf2, 0x93, 0x95, 0xe8, 0x9f, 0x74, 0x3b, 0x69,
+	     0x7a, 0xed, 0xdc, 0xc8, 0x72, 0xab, 0x47, 0xed, 0x13, 0x17,
+	     0x67, 0xff, 0xd7, 0x72, 0xe3, 0xff, 0xd4, 0x4a, 0x0c, 0x49,
+	     0x2b, 0x94, 0xf1, 0x4d, 0x56, 0xc7, 0x6c, 0x93, 0xab, 0xe3,
+	     0xb5, 0x35, 0x70, 0x22, 0x32, 0xd9, 0x49, 0xbd, 0xd0, 0x17,
+	     0xa7, 0xe0, 0x00, 0x29, 0x5b, 0xd4, 0x85, 0xef, 0x6a, 0x1a,
+	     0x8f, 0x94, 0x7b, 0xce, 0x52, 0xab, 0xe1, 0x68, 0xc3, 0x82,
+	     0xc1, 0xe8, 0x81, 0x38, 0x19, 0xf1, 0x2d, 0x5e, 0x15, 0x35,
+	     0x00, 0x51, 0x91, 0x23, 0xfc, 0x0f, 0x26, 0x40, 0xe0, 0x72,
+	     0x70, 0x0d, 0x72, 0x8e, 0xb1, 0x84, 0x38, 0x76, 0x17, 0xa8,
+	     0x4f, 0xb8, 0xeb, 0xe6, 0x34, 0x04, 0x9a, 0xe9, 0x01, 0x27,
+	     0x8a, 0xc4, 0x18, 0x06, 0x21, 0x2e, 0x1e, 0x75, 0x2c, 0x89,
+	     0x09, 0x8f, 0x82, 0x54, 0x41, 0xb2, 0x16, 0x04, 0x1b, 0xd9,
+	     0xd2, 0x30, 0xa5, 0xb4, 0x37, 0x36, 0x22, 0x36, 0x8a, 0x1c,
+	     0xe9, 0x8f, 0x80, 0xc8, 0xfb, 0x1d, 0x85, 0x27, 0x0a, 0x0d,
+	     0x5d, 0x1f, 0x85, 0xc3, 0x8e, 0xe6, 0xf7, 0x08, 0xdd, 0x38,
+	     0x32, 0x31, 0x9e, 0x52, 0x75, 0xbc, 0x10, 0x89, 0x5c, 0x4a,
+	     0x72, 0x4f, 0xc2, 0x5e, 0xfb, 0xa4, 0x54, 0x05, 0x9c, 0x40,
+	     0x51, 0x05, 0x46, 0x8f, 0x9b, 0x43, 0x34, 0x40, 0xcb, 0x74,
+	     0x27, 0x91, 0xd3, 0x18, 0x0c, 0x29, 0x04, 0x9b, 0x61, 0xc0,
+	     0x8a, 0xa9, 0x49, 0xc4, 0x9b, 0x64, 0xf1, 0x68, 0x46, 0x50,
+	     0x56, 0xa0, 0xaf, 0x51, 0x52, 0x09, 0x29, 0xf7, 0xb4, 0x31,
+	     0x07, 0x59, 0xac, 0xda, 0x78, 0x70, 0x94, 0xbc, 0x56, 0xc5,
+	     0x83, 0x80, 0xa9, 0x3e, 0x43, 0x7f, 0x35, 0xb3, 0xda, 0x37,
+	     0x7d, 0x97, 0x76, 0x80, 0xeb, 0xc3, 0x54, 0x94, 0x66, 0xa2,
+	     0xd4, 0xf4, 0xe0, 0x3c, 0x8d, 0xd1, 0x89, 0x5a, 0x1f, 0x9a,
+	     0x83, 0xfa, 0x10, 0x18, 0xd2, 0xf3, 0x10, 0xe9, 0x6a, 0x02,
+	     0x28, 0x2b, 0x97, 0x61, 0xce, 0xf2, 0x13, 0x09, 0xf8, 0x30,
+	     0xf9, 0x15, 0x9d, 0x06, 0x6f, 0xa9, 0xcc, 0xf4, 0x20, 0xd5,
+	     0x4b, 0x96, 0xb5, 0xb3, 0xea, 0xf5, 0xd1, 0xa2, 0x26, 0x43,
+	     0xc5, 0x23, 0x5d, 0x1c, 0x8a, 0xc7, 0x23, 0xc7, 0x12, 0x70,
+	     0xe1, 0x05, 0x5d, 0x86, 0x01, 0x02, 0xb7, 0x1a, 0xd1, 0xd6,
+	     0x61, 0x7b, 0xa1, 0x22, 0x62, 0x89, 0xad, 0xe1, 0x8e, 0x59,
+	     0x32, 0x99, 0xf9, 0xe4, 0xca, 0xe3, 0x4f, 0xb4, 0xc0, 0xe8,
+	     0xbb, 0xe5, 0xf1, 0xd6, 0x75, 0x2d, 0xcc, 0x6f, 0x60, 0xd4,
+	     0x68, 0x20, 0x81, 0xff, 0xf3, 0xf7, 0x79, 0x71, 0x36, 0x84,
+	     0xc7, 0xb3, 0xaf, 0x0d, 0xf8, 0x82, 0x13, 0xd0, 0x54, 0x4c,
+	     0x84, 0x11, 0xec, 0xe2, 0x34, 0x1b, 0x0e, 0x17, 0xc0, 0x57,
+	     0x71, 0x92, 0xc2, 0xa3, 0xea, 0x99, 0x05, 0xae, 0x54, 0x90,
+	     0x3f, 0x2b, 0x27, 0xc9, 0x6a, 0xaa, 0xcb, 0xd3, 0x3f, 0xa1,
+	     0xe7, 0x95, 0xcf, 0xc8, 0x68, 0x7a, 0x44, 0x1a, 0x4e, 0xb2,
+	     0x8d, 0xb2, 0x89, 0x33, 0x5b, 0x3f, 0xba, 0x43, 0x8a, 0x88,
+	     0xe7, 0xad, 0xc6, 0xa5, 0x7b, 0x8b, 0xe4, 0xb7, 0x55, 0xf8,
+	     0x66, 0x14, 0x12, 0x1d, 0x47, 0xe2, 0xa1, 0xeb, 0xc6, 0x52,
+	     0xd2, 0xbe, 0xf0, 0xbf, 0xc1, 0x2f, 0x2c, 0x37, 0xc7, 0x31,
+	     0x83, 0x18, 0x8c, 0xe6, 0xe9, 0x52, 0x5f, 0x33, 0x0d, 0xba,
+	     0xa5, 0xb4, 0x1d, 0xb6, 0x5f, 0x1d, 0x95, 0x29, 0x89, 0x16,
+	     0x24, 0x7d, 0x38, 0x7a, 0xa9, 0xa8, 0x69, 0x04, 0x5e, 0x5f,
+	     0x4d, 0x41, 0x5a, 0xc2, 0xcd, 0x4b, 0x70, 0xb3, 0xd5, 0x70,
+	     0x69, 0x99, 0x9d, 0xb0, 0x82, 0x84, 0x2b, 0x25, 0x46, 0x43,
+	     0x12, 0xfd, 0x10, 0xf2, 0x31, 0x1b, 0x18, 0x66, 0xce, 0x80,
+	     0x9a, 0x24, 0x3b, 0x43, 0x46, 0xea, 0x7b, 0x97, 0x0b, 0x80,
+	     0x20, 0xc2, 0x67, 0xd2, 0x11, 0xd1, 0xa0, 0x6e, 0x53, 0xbf,
+	     0x8e, 0xb7, 0x25, 0x19, 0xf8, 0xcf, 0xec, 0x9e, 0x36, 0x61,
+	     0xfa, 0x01, 0x47, 0xca, 0xf7, 0xe6, 0xe2, 0xb1, 0xa8, 0x99,
+	     0x82, 0x65, 0x31, 0x6c, 0x13, 0xfb, 0xb6, 0x30, 0x43, 0xb3,
+	     0x49, 0xb4, 0x62, 0x3d, 0x62, 0xae, 0x58, 0xa1, 0x54, 0x6c,
+	     0x27, 0x33, 0xf0, 0xe1, 0xa8, 0xb0, 0x30, 0x72, 0x6a, 0x10,
+	     0x4e, 0x60, 0x34, 0xc2, 0x3b, 0x27, 0xa0, 0x2b, 0x18, 0xad,
+	     0x8d, 0x16, 0x03, 0xe9, 0x90, 0xb7, 0x34, 0xc3, 0xa8, 0x21,
+	     0xa6, 0x2e, 0x34, 0x62, 0x94, 0x4d, 0x26, 0xb5, 0x94, 0x0a,
+	     0x20, 0x4e, 0x6d, 0x18, 0x4b, 0x50, 0x97, 0xf8, 0x9d, 0x08,
+	     0x4c, 0x25, 0x50, 0xda, 0x63, 0x64, 0xb8, 0xdd, 0xd4, 0x26,
+	     0x43, 0xc9, 0x0f, 0x10, 0x2b, 0xa0, 0x5d, 0x78, 0x2c, 0x80,
+	     0x3c, 0xf2, 0x30, 0x03, 0x51, 0x31, 0x94, 0x3c, 0x47, 0xe6,
+	     0x24, 0xf0, 0x23, 0x2a, 0xf9, 0x6c, 0xb8, 0x28, 0x34, 0x20,
+	     0x8a, 0x3d, 0x85, 0x21, 0xff, 0xe6, 0x15, 0x36, 0x68, 0x9b,
+	     0x5f, 0x4e, 0xc7, 0xc4, 0x07, 0x4e, 0xb7, 0xe7, 0xc5, 0x1d,
+	     0x04, 0x43, 0x55, 0xe1, 0x71, 0x9f, 0xa9, 0xab, 0x7e, 0x14,
+	     0xe6, 0x83, 0x67, 0xd4, 0x2c, 0x03, 0xf3, 0xe2, 0xbd, 0x81,
+	     0x46, 0xe2, 0x3a, 0x4a, 0x42, 0xd5, 0x44, 0x5c, 0x94, 0xe3,
+	     0xec, 0x92, 0xc5, 0x61, 0x70, 0x0c, 0xca, 0xd9, 0x26, 0x4c,
+	     0xaa, 0x10, 0xdd, 0xd7, 0xb6, 0x41, 0x3f, 0xa7, 0xbb, 0xb2,
+	     0xa9, 0x00, 0x07, 0x55, 0x15, 0x0d, 0x1d, 0xca, 0xa1, 0xe7,
+	     0x0f, 0xd4, 0x55, 0xab, 0xc3, 0x87, 0x69, 0x2c, 0xc7, 0x07,
+	     0x35, 0xbd, 0x85, 0x46, 0x19, 0x2f, 0x30, 0x27, 0xaf, 0x9b,
+	     0xe2, 0x39, 0xc1, 0x5c, 0x37, 0xb0, 0x01, 0x76, 0x4f, 0xdf,
+	     0xc2, 0xbc, 0x36, 0x58, 0x81, 0x80, 0xcd, 0xf7, 0x4a, 0x99,
+	     0xdf, 0x47, 0x83, 0xdc, 0x5d, 0x2f, 0x6e, 0x78, 0x3f, 0x43,
+	     0x15, 0xc0, 0x8b, 0x8c, 0x67, 0x57, 0x85, 0xf1, 0xe3, 0x55,
+	     0x08, 0xbb, 0x03, 0x46, 0x12, 0x50, 0x86, 0x44, 0x4e, 0x53,
+	     0x0f, 0xb6, 0xe5, 0x83, 0xb5, 0xd1, 0x8b, 0x11, 0x85, 0x0c,
+	     0x27, 0x60, 0xd9, 0xca, 0x82, 0xc3, 0xbd, 0xc5, 0xe1, 0x81,
+	     0xed, 0xa6, 0xf9, 0xd3, 0xa8, 0x44, 0x6d, 0x55, 0x24, 0x13,
+	     0xca, 0x24, 0xec, 0x60, 0x1b, 0x8c, 0xd3, 0x03, 0x76, 0x3c,
+	     0xd1, 0xcd, 0xcb, 0x50, 0x27, 0x72, 0x82, 0x9d, 0x88, 0x9b,
+	     0xe5, 0xa4, 0xe9, 0x4b, 0x14, 0xe2, 0x5d, 0x08, 0xab, 0x57,
+	     0x42, 0xba, 0xac, 0x81, 0xd8, 0xa9, 0x38, 0xa0, 0x57, 0x13,
+	     0xe0, 0x7d, 0xab, 0x1c, 0x11, 0x3d, 0x24, 0xdc, 0x87, 0x48,
+	     0xd3, 0xad, 0x65, 0x6e, 0x42, 0x9d, 0xed, 0x1e, 0xc2, 0x14,
+	     0x99, 0x11, 0x35, 0xd9, 0x66, 0xa9, 0xab, 0x22, 0x44, 0xcb,
+	     0x3f, 0x2e, 0x03, 0xed, 0x39, 0x81, 0x16, 0xa6, 0x4d, 0xda,
+	     0x42, 0x8a, 0x51, 0x28, 0xb1, 0x25, 0x92, 0x1d, 0x95, 0x03,
+	     0x63, 0xc8, 0xd1, 0x1e, 0x62, 0x84, 0x84, 0x74, 0x63, 0x1a,
+	     0xca, 0x60, 0x3a, 0x9e, 0x9a, 0xda, 0x2e, 0xcd, 0xc7, 0x99,
+	     0x6f, 0x09, 0x92, 0x56, 0xc3, 0x05, 0x0c, 0xca, 0x9e, 0x50,
+	     0x03, 0x92, 0x3a, 0x53, 0x95, 0xe1, 0x84, 0x63, 0xee, 0x40,
+	     0xed, 0x28, 0x2b, 0x07, 0x07, 0xcd, 0xa9, 0xa5, 0xa5, 0x8b,
+	     0x28, 0x67, 0xb8, 0x32, 0x59, 0x58, 0x82, 0xea, 0xcc, 0x66,
+	     0x6a, 0xa3, 0x2d, 0xa0, 0x46, 0xea, 0x80, 0xb6, 0x0d, 0x88,
+	     0x46, 0x3a, 0xd2, 0x36, 0x46, 0xc6, 0x3c, 0xfe, 0x9e, 0xa6,
+	     0x66, 0x6e, 0xb2, 0xfa, 0xb9, 0xa8, 0xb0, 0x48, 0x14, 0x8c,
+	     0xb1, 0x3c, 0x31, 0x53, 0x29, 0x0e, 0x0a, 0x61, 0x78, 0x73,
+	     0x54, 0xec, 0x00, 0xea, 0x23, 0xf4, 0xb2, 0x18, 0xa5, 0x86,
+	     0xc1, 0x98, 0xc9, 0x99, 0x62, 0x1c, 0x81, 0x56, 0x98, 0x92,
+	     0x78, 0xa3, 0x20, 0x07, 0x2c, 0x43, 0xb3, 0x06, 0xa6, 0x29,
+	     0xbc, 0x8c, 0x6c, 0x8e, 0x0a, 0x6f, 0x10, 0x17, 0xdb, 0x49,
+	     0x30, 0x0f, 0x00, 0x68, 0x0c, 0xac, 0x50, 0x26, 0xdf, 0x0a,
+	     0xb1, 0x0b, 0xf7, 0x8b, 0xc4, 0x68, 0xc0, 0xb5, 0x45, 0xbb,
+	     0x3b, 0x0e, 0xf3, 0xae, 0x33, 0x36, 0xb0, 0xef, 0xcb, 0x10,
+	     0x93, 0x5c, 0xf3, 0x95, 0x53, 0x43, 0x9a, 0x7e, 0x9e, 0x5b,
+	     0x19, 0xb6, 0x2c, 0xa4, 0xd5, 0xd0, 0x3c, 0xf3, 0x64, 0xf8,
+	     0x2c, 0xe8, 0x8d, 0xd4, 0x73, 0xc4, 0x8c, 0x54, 0xcc, 0x30,
+	     0x86, 0x46, 0x70, 0xf2, 0x13, 0x50, 0xa5, 0x13, 0x36, 0x67,
+	     0xc0, 0x0a, 0x95, 0x64, 0x7b, 0xc7, 0x3c, 0x38, 0x98, 0x50,
+	     0x0a, 0x04, 0xec, 0x5a, 0x8a, 0xd7, 0x82, 0x49, 0x51, 0x35,
+	     0xa9, 0xb6, 0x61, 0x1b, 0xf9, 0x2d, 0x24, 0x96, 0xd0, 0x75,
+	     0xe2, 0x4a, 0xcc, 0xd3, 0x84, 0x2e, 0x81, 0x69, 0x2e, 0xd0,
+	     0x8e, 0x31, 0xa7, 0x4c, 0x07, 0x08, 0x85, 0xcb, 0x64, 0x05,
+	     0xd2, 0x86, 0x70, 0x4c, 0x34, 0x1a, 0x19, 0x7e, 0x44, 0x7e,
+	     0xca, 0xb7, 0x12, 0x56, 0x8a, 0x08, 0x65, 0xb4, 0x4b, 0x8a,
+	     0x9d, 0x4c, 0x9d, 0x1e, 0x69, 0x02, 0x0c, 0xa8, 0xcf, 0x21,
+	     0xf1, 0x85, 0xb9, 0x03, 0xcc, 0xa2, 0x80, 0x5a, 0xa6, 0x3b,
+	     0xd2, 0x32, 0xbd, 0x9e, 0x92, 0xef, 0x67, 0x20, 0x36, 0xd2,
+	     0x08, 0xfd, 0xf7, 0x3e, 0x30, 0xb5, 0xb2, 0xdb, 0x52, 0x06,
+	     0xcd, 0x59, 0xe8, 0x3f, 0x09, 0x0a, 0xd5, 0xac, 0x2a, 0x3f,
+	     0x9b, 0x23, 0x14, 0x09, 0x7f, 0xea, 0x12, 0x95, 0x48, 0xd1,
+	     0x2c, 0xac, 0x39, 0xdc, 0x0e, 0xa6, 0x35, 0x49, 0xc8, 0x23,
+	     0x73, 0x11, 0x28, 0x65, 0xb0, 0xa6, 0x10, 0x0f, 0x1d, 0x4c,
+	     0xdb, 0xaa, 0xc9, 0x47, 0x54, 0x6d, 0xd3, 0xe1, 0x0e, 0xe0,
+	     0x29, 0xfe, 0x0f, 0x39, 0x33, 0x5c, 0xb2, 0xab, 0xe5, 0x7f,
+	     0x83, 0x32, 0x87, 0xa8, 0x04, 0x6e, 0x9c, 0x08, 0xea, 0x65,
+	     0xbb, 0x98, 0x5c, 0x92, 0x04, 0xa1, 0xa3, 0x71, 0x06, 0x23,
+	     0x59, 0x09, 0x73, 0xb6, 0x8f, 0xb5, 0x4c, 0xfe, 0x42, 0x7d,
+	     0x8b, 0xfc, 0x35, 0x39, 0x53, 0xfa, 0x94, 0x4b, 0xd0, 0x67,
+	     0x9f, 0x2a, 0xfc, 0xe4, 0x43, 0x09, 0x29, 0xd6, 0xe1, 0x24,
+	     0x9c, 0x05, 0xe7, 0x9a, 0x2b, 0xf7, 0x01, 0x52, 0x1b, 0xdd,
+	     0xb2, 0xb2, 0xb0, 0x65, 0x0b, 0xdb, 0x40, 0xc8, 0xf6, 0x66,
+	     0x10, 0x16, 0x53, 0x87, 0x3c, 0x27, 0x17, 0x77, 0x5b, 0x10,
+	     0xd3, 0xc9, 0xad, 0x9e, 0x6a, 0x71, 0x10, 0x8b, 0xd1, 0xab,
+	     0x8d, 0x01, 0xd9, 0xc9, 0x59, 0xa8, 0xa0, 0x4f, 0xdc, 0x18,
+	     0xb0, 0x09, 0x12, 0x5d, 0x7b, 0x10, 0x2f, 0x97, 0x45, 0x50,
+	     0x4b, 0x99, 0xac, 0xa6, 0x83, 0xf5, 0xae, 0xc6, 0xe4, 0x44,
+	     0xed, 0x99, 0xf0, 0x44, 0xe0, 0x58, 0x90, 0x8f, 0xda, 0x25,
+	     0x83, 0xa4, 0xd1, 0xda, 0xca, 0xa2, 0x57, 0xe9, 0x36, 0x70,
+	     0x98, 0x9d, 0xb4, 0x3a, 0x07, 0xdf, 0x31, 0xdb, 0x02, 0xcb,
+	     0x22, 0x16, 0x05, 0x5f, 0xf9, 0x29, 0x62, 0x97, 0xfc, 0x15,
+	     0x73, 0x99, 0xe6, 0x4d, 0x73, 0x0c, 0x9c, 0xa4, 0x4a, 0xda,
+	     0xbe, 0x31, 0xb0, 0x2a, 0x37, 0x5d, 0x20, 0x07, 0xde, 0x7b,
+	     0x89, 0xf7, 0x13, 0x61, 0x92, 0xbc, 0x28, 0x56, 0xea, 0x56,
+	     0x59, 0xca, 0x9e, 0x12, 0x93, 0x03, 0x7e, 0x79, 0x0a, 0x28,
+	     0x5d, 0xad, 0xa7, 0x32, 0x7c, 0x93, 0x02, 0xa1, 0x01, 0xe3,
+	     0x22, 0x43, 0xd3, 0xd6, 0xe8, 0x26, 0xb8, 0x29, 0x47, 0x01,
+	     0x5d, 0x4d, 0xe3, 0x01, 0x84, 0x4a, 0xb7, 0xb3, 0x47, 0x03,
+	     0x0c, 0x11, 0xa7, 0x04, 0x22, 0x6b, 0x4d, 0x47, 0x14, 0xc4,
+	     0x2d, 0xf6, 0x87, 0xc6, 0xda, 0x2f, 0x29, 0x2d, 0x9c, 0x48,
+	     0x1b, 0x44, 0x69, 0xa4, 0x3b, 0x2d, 0x26, 0xf9, 0x0f, 0x73,
+	     0xd8, 0x80, 0xd0, 0x28, 0x4d, 0x34, 0x8e, 0xa5, 0x17, 0x75,
+	     0xb3, 0xb2, 0xf4, 0xa7, 0x00, 0x0f, 0x49, 0xe1, 0xf0, 0x5a,
+	     0xc9, 0x25, 0xe9, 0x48, 0xaa, 0xc1, 0xd0, 0xb4, 0x50, 0xf8,
+	     0x0e, 0xd9, 0x0b, 0xe8, 0x72, 0xdd, 0x9b, 0x0d, 0x93, 0x70,
+	     0x2b, 0x75, 0x97, 0x63, 0x50, 0x27, 0xd1, 0x61, 0x36, 0x21,
+	     0x43, 0xb1, 0xba, 0x19, 0xf6, 0x8f, 0x92, 0x44, 0xc4, 0xac,
+	     0x98, 0xc9, 0xee, 0xe4, 0x62, 0xcd, 0x85, 0x9e, 0x65, 0xbe,
+	     0xad, 0xbf, 0xb2, 0x5b, 0x39, 0x6e, 0x70, 0x5d, 0x22, 0x77,
+	     0xd9, 0xb0, 0x14, 0x17, 0x27, 0xa5, 0x1e, 0xb7, 0x28, 0x6a,
+	     0x3b, 0xba, 0xe1, 0xbc, 0x1d, 0xb8, 0x30, 0x1a, 0x17, 0x94,
+	     0x63, 0x86, 0xb3, 0x18, 0x54, 0x6a, 0x84, 0x39, 0xf6, 0x57,
+	     0x61, 0x43, 0xb8, 0x95, 0x33, 0x2b, 0x34, 0xc1, 0x03, 0xc3,
+	     0xb8, 0x81, 0x31, 0xe1, 0x31, 0xed, 0x3e, 0x31, 0x65, 0xa5,
+	     0x07, 0x22, 0x62, 0x36, 0xd2, 0xc6, 0x60, 0xe6, 0xae, 0x8a,
+	     0x3f, 0x91, 0x5d, 0x1e, 0x37, 0x25, 0x9e, 0x12, 0x6e, 0x41,
+	     0x1a, 0xf9, 0xf6, 0xb2, 0x23, 0x72, 0x87, 0xac, 0x46, 0x1b,
+	     0x60, 0x30, 0x85, 0xc5, 0x54, 0x54, 0xe0, 0x75, 0x46, 0x1d,
+	     0xc9, 0x96, 0xc4, 0xc7, 0x7d, 0x6d, 0x13, 0x55, 0x41, 0x22,
+	     0xad, 0x90, 0x10, 0x59, 0x65, 0x15, 0xa0, 0x2b, 0x1d, 0x6d,
+	     0xc9, 0xa2, 0xc0, 0xe9, 0x18, 0x11, 0x82, 0x2a, 0x21, 0x46,
+	     0xc2, 0xca, 0xd5, 0x1a, 0x58, 0x81, 0xa8, 0x13, 0xbb, 0xe2,
+	     0x3b, 0x94, 0x65, 0xe4, 0x6e, 0x1b, 0x34, 0x81, 0x9e, 0x1d,
+	     0x31, 0x9c, 0xe8, 0x5b, 0x0a, 0x33, 0xc2, 0x54, 0x7a, 0x4b,
+	     0x8f, 0xa6, 0xdc, 0x20, 0xfd, 0xe7, 0x0f, 0xe4, 0xbd, 0xb8,
+	     0x4f, 0xaa, 0x7f, 0x8c, 0x02, 0x38, 0x02, 0x92, 0x50, 0xc9,
+	     0x62, 0xe2, 0xb4, 0x80, 0x59, 0x25, 0xf5, 0x27, 0x49, 0x55,
+	     0x50, 0xcb, 0x9a, 0x42, 0x56, 0xd0, 0xd6, 0x91, 0x70, 0xa3,
+	     0x16, 0x34, 0x1d, 0x33, 0x28, 0x49, 0xb9, 0xbd, 0x13, 0xba,
+	     0x08, 0xaa, 0xb6, 0x62, 0x79, 0xcf, 0xb9, 0x42, 0xba, 0x94,
+	     0xaa, 0xca, 0xbd, 0xc6, 0xe0, 0x08, 0x97, 0xf1, 0xf2, 0x2a,
+	     0x0d, 0xf5, 0x1e, 0x51, 0x7b, 0xd0, 0xb7, 0x4c, 0x24, 0x33,
+	     0xe0, 0x89, 0x13, 0x6d, 0x00, 0x45, 0x99, 0xf5, 0x8e, 0x07,
+	     0x9d, 0xba, 0x9f, 0xdc, 0xcc, 0x4e, 0x86, 0x14, 0x24, 0x50,
+	     0x32, 0xe6, 0xd4, 0x24, 0x63, 0x42, 0x32, 0xe9, 0xdc, 0xda,
+	     0x91, 0x84, 0xa1, 0xb2, 0x5b, 0xac, 0xa9, 0x37, 0x02, 0x83,
+	     0xfb, 0x32, 0xe9, 0xde, 0xd8, 0x65, 0x08, 0x78, 0x6d, 0x1a,
+	     0xc3, 0x89, 0xb0, 0x12, 0x54, 0xf9, 0x9e, 0x32, 0xcf, 0x8e,
+	     0x04, 0x26, 0x66, 0x9a, 0x7c, 0x18, 0x25, 0x5c, 0x5e, 0x75,
+	     0xc8, 0xae, 0xe9, 0xc6, 0x11, 0xf2, 0xb7, 0x52, 0x77, 0x8b,
+	     0x85, 0xf9, 0x0b, 0x7d, 0x30, 0x8b, 0xbe, 0x42, 0xd4, 0x70,
+	     0x10, 0xd2, 0xc8, 0x93, 0x29, 0x66, 0x26, 0xb5, 0xa4, 0x74,
+	     0x56, 0x1f, 0x72, 0x5e, 0x8b, 0xae, 0xa2, 0x68, 0x04, 0x42,
+	     0x46, 0xb0, 0x41, 0xe0, 0x88, 0xab, 0xa0, 0x24, 0x07, 0x10,
+	     0x32, 0xae, 0xb9, 0xad, 0xf3, 0x47, 0x54, 0x0a, 0x38, 0x50,
+	     0x91, 0x42, 0xec, 0x5a, 0xe7, 0x72, 0x9f, 0x03, 0xbe, 0x12,
+	     0x6f, 0x41, 0xaf, 0xa4, 0x7e, 0x72, 0x88, 0x5f, 0x95, 0xe1,
+	     0x52, 0xc4, 0xf5, 0xbb, 0x93, 0x0d, 0x25, 0xf2, 0x36, 0x80,
+	     0x86, 0x3f, 0xbd, 0xdc, 0x4b, 0x48, 0x79, 0xc6, 0x16, 0x61,
+	     0x79, 0xcd, 0x40, 0xe0, 0x04, 0x9b, 0x14, 0x03, 0x1e, 0x3b,
+	     0x6f, 0x42, 0x43, 0x5e, 0x70, 0xf6, 0xbd, 0x37, 0x53, 0x37,
+	     0x79, 0x8d, 0xc6, 0x02, 0x3c, 0x6c, 0xdf, 0xe8, 0x37, 0x63,
+	     0xb0, 0x11, 0x98, 0x8e, 0x38, 0xc8, 0x85, 0xd9, 0xc8, 0x02,
+	     0x51, 0xac, 0xd5, 0xbc, 0x83, 0x48, 0xb1, 0x2b, 0x9e, 0x2b,
+	     0x10, 0x05, 0x12, 0xc1, 0xb8, 0x43, 0x67, 0x74, 0xbc, 0xe9,
+	     0x81, 0x20, 0x87, 0xe0, 0x67, 0x23, 0xb5, 0xa4, 0xcb, 0x2e,
+	     0xa5, 0x23, 0x46, 0x44, 0x68, 0x21, 0x0c, 0xd7, 0x9e, 0x40,
+	     0x0e, 0x37, 0x65, 0xda, 0x23, 0xec, 0x31, 0x84, 0x60, 0x00,
+	     0x15, 0x1e, 0x11, 0x17, 0x39, 0xf7, 0xab, 0xe7, 0x97, 0x8b,
+	     0xf2, 0x8a, 0xa8, 0x8f, 0xc4, 0x93, 0x64, 0xf5, 0xec, 0x0d,
+	     0x67, 0x15, 0x30, 0x1c, 0xa2, 0x0b, 0x26, 0x51, 0x43, 0x28,
+	     0x0a, 0xc6, 0x25, 0x59, 0x5a, 0x3a, 0xa9, 0x57, 0x8a, 0xbb,
+	     0xe2, 0x6d, 0x91, 0x71, 0xda, 0x68, 0xf1, 0xe3, 0xa4, 0x67,
+	     0x6e, 0x17, 0x3f, 0x90, 0xa0, 0x71, 0x09, 0x60, 0xbb, 0xac,
+	     0x1a, 0xb0, 0xe7, 0x88, 0x43, 0x8d, 0x47, 0xcb, 0x80, 0x57,
+	     0x2e, 0x4c, 0x55, 0xf1, 0x23, 0xa9, 0x31, 0xd9, 0xc8, 0x78,
+	     0x9b, 0x2c, 0x5d, 0x9e, 0x15, 0x01, 0x26, 0x09, 0x9d, 0x30,
+	     0x3b, 0xa6, 0x72, 0x6c, 0x69, 0x9f, 0x29, 0x8b, 0x92, 0xb3,
+	     0x11, 0x2a, 0x82, 0xb7, 0x4b, 0x89, 0xe9, 0x0d, 0x37, 0x3f,
+	     0x8a, 0xbf, 0xa9, 0x0a, 0xdd, 0x22, 0x68, 0x31, 0xfe, 0xb1,
+	     0x74, 0xb5, 0x1b, 0x69, 0x3d, 0xc0, 0xbc, 0x99, 0x02, 0x51,
+	     0x0c, 0xe9, 0xd7, 0xff, 0xe8, 0x47, 0x84, 0xce, 0x66, 0x36,
+	     0x6d, 0x06, 0xd0, 0x93, 0xaa, 0x84, 0x2f, 0x69, 0x29, 0xea,
+	     0x08, 0xe2, 0x13, 0xd6, 0x32, 0xc7, 0xab, 0x14, 0x93, 0x76,
+	     0xc1, 0xc1, 0x16, 0x81, 0x79, 0x17, 0x60, 0xfe, 0xd8, 0x18,
+	     0x26, 0x98, 0xc8, 0x80, 0x74, 0x10, 0x64, 0xc3, 0xa7, 0xf3,
+	     0x68, 0x0c, 0x93, 0xbe, 0x10, 0x97, 0xa0, 0x38, 0x18, 0x42,
+	     0x8c, 0x41, 0x91, 0x86, 0xb2, 0x3f, 0xe0, 0xb4, 0xc8, 0x48,
+	     0xcd, 0xa0, 0xeb, 0xc7, 0xf4, 0xf2, 0x7c, 0x24, 0x28, 0x64,
+	     0x2a, 0xd9, 0x2b, 0xeb, 0x5c, 0x03, 0x01, 0xcd, 0xcd, 0x72,
+	     0x8c, 0xc1, 0xa7, 0x9a, 0xe3, 0x2a, 0xa8, 0x78, 0xe4, 0x80,
+	     0x8c, 0x9c, 0x53, 0x95, 0x04, 0x8a, 0x26, 0x72, 0x14, 0xb8,
+	     0xb5, 0x99, 0xf2, 0x4c, 0x55, 0x8e, 0xc0, 0x91, 0x52, 0xe0,
+	     0xec, 0x09, 0xe8, 0xcc, 0x9c, 0x26, 0x39, 0x71, 0x98, 0x69,
+	     0x1f, 0xc4, 0x2e, 0x1e, 0x48, 0xe1, 0xdd, 0x90, 0xdb, 0xe8,
+	     0xe1, 0xa9, 0x74, 0x30, 0x69, 0xd3, 0xab, 0xa4, 0x46, 0x7f,
+	     0x6e, 0xe4, 0xa7, 0x70, 0x02, 0x9d, 0xf4, 0x70, 0xb2, 0x27,
+	     0x41, 0x80, 0xc4, 0x81, 0x6f, 0x31, 0x9f, 0x87, 0x9c, 0xb2,
+	     0x41, 0xf8, 0xd5, 0x7c, 0x5e, 0x9e, 0x2a, 0x92, 0x97, 0x64,
+	     0xe5, 0x2e, 0x27, 0x12, 0xf0, 0xcf, 0x6c, 0x26, 0x3b, 0x68,
+	     0x3b, 0x88, 0x4d, 0x89, 0x77, 0x70, 0xc8, 0x97, 0xbb, 0x8b,
+	     0x81, 0xfd, 0x24, 0xe6, 0x12, 0xeb, 0x1c, 0x68, 0xa1, 0xf4,
+	     0xc9, 0xbf, 0x52, 0xbb, 0x70, 0xa3, 0x84, 0x00, 0xad, 0x16,
+	     0xb5, 0x49, 0x11, 0x5d, 0x6d, 0x80, 0xd5, 0xb2, 0x27, 0xd2,
+	     0x8a, 0x2d, 0x09, 0x5e, 0x04, 0x16, 0x21, 0x7b, 0x13, 0x7f,
+	     0xc9, 0xe7, 0xb7, 0x6e, 0x51, 0x3e, 0x5d, 0xd4, 0x12, 0x60,
+	     0x7c, 0x97, 0xb8, 0x8e, 0x40, 0xd3, 0xd8, 0x62, 0xbb, 0x22,
+	     0x9f, 0xf5, 0x99, 0x8e, 0x49, 0x96, 0xb1, 0x9f, 0x90, 0xde,
+	     0xab, 0x04, 0x54, 0x80, 0xab, 0x1e, 0x11, 0x8d, 0xee, 0x22,
+	     0x94, 0x3c, 0x42, 0x8e, 0x54, 0xaf, 0x14, 0x66, 0xf3, 0x79,
+	     0x2d, 0x45, 0xae, 0x62, 0x20, 0xc3, 0x32, 0x4d, 0x54, 0x4b,
+	     0xcd, 0x0b, 0x74, 0x27, 0xbc, 0x99, 0xe8, 0x2e, 0x1a, 0x29,
+	     0x37, 0x91, 0x03, 0x48, 0x7a, 0xa4, 0x64, 0x73, 0xc6, 0x69,
+	     0xef, 0x69, 0x1c, 0x46, 0x6d, 0xa3, 0x46, 0x63, 0xc4, 0x0d,
+	     0x8d, 0x65, 0xb5, 0x7f, 0x33, 0x42, 0x3e, 0x07, 0x85, 0x67,
+	     0xee, 0xb9, 0x5e, 0x21, 0x7e, 0x93, 0x58, 0x97, 0xa5, 0xb3,
+	     0x06, 0x8c, 0x47, 0x8e, 0x5f, 0x7d, 0xb9, 0x67, 0xe1, 0x4d,
+	     0xa7, 0xa3, 0xd4, 0x04, 0xf1, 0x14, 0xfa, 0xd6, 0x9e, 0x98,
+	     0xd9, 0x42, 0xc3, 0x18, 0x38, 0x30, 0x7a, 0x08, 0x22, 0x33,
+	     0x93, 0xc8, 0x20, 0xfa, 0x04, 0xe7, 0x91, 0x87, 0x02, 0xfc,
+	     0x27, 0x8a, 0x16, 0x48, 0xec, 0xc2, 0xc0, 0x1e, 0x59, 0x1b,
+	     0xe9, 0x0a, 0x66, 0x0b, 0xa3, 0x60, 0x1b, 0x81, 0x8a, 0xa9,
+	     0x9f, 0x7d, 0xf2, 0xce, 0x96, 0x1b, 0xa0, 0xec, 0x8c, 0x2e,
+	     0xe6, 0xcf, 0xb1, 0x0f, 0x70, 0xe8, 0x95, 0x00, 0x93, 0x8f,
+	     0x0b, 0x4e, 0xca, 0xc3, 0x28, 0x41, 0xd8, 0xc5, 0x4e, 0x31,
+	     0x8a, 0x6c, 0xa3, 0x4a, 0x89, 0xfa, 0xbd, 0xc0, 0x06, 0xe8,
+	     0x8e, 0x3c, 0xe1, 0xc8, 0xe0, 0xcd, 0x55, 0x08, 0xc6, 0x83,
+	     0x94, 0x1b, 0x69, 0xe0, 0x60, 0x52, 0xa0, 0x71, 0xa7, 0x23,
+	     0x23, 0x9e, 0x2f, 0x00, 0x2c, 0x5e, 0x34, 0xd1, 0xd8, 0xc3,
+	     0xa3, 0xfd, 0xf3, 0xf1, 0x93, 0xdc, 0xf9, 0x03, 0x0c, 0x81,
+	     0x35, 0x9b, 0x58, 0x52, 0x28, 0xa9, 0xb7, 0x69, 0x5a, 0x81,
+	     0x9c, 0x45, 0x16, 0x60, 0x37, 0xee, 0xc0, 0x01, 0x15, 0x9d,
+	     0xa2, 0x8c, 0x32, 0x9e, 0xe9, 0x63, 0x7d, 0xe8, 0x94, 0x88,
+	     0xe5, 0x48, 0x0f, 0xc8, 0x86, 0x8e, 0xa9, 0x65, 0x45, 0xc1,
+	     0xa1, 0x7c, 0x22, 0x46, 0x45, 0x58, 0x87, 0x10, 0x84, 0xa6,
+	     0xa4, 0xd9, 0x43, 0x43, 0x09, 0xd0, 0x45, 0xb0, 0x54, 0x03,
+	     0x5b, 0x43, 0xdd, 0x81, 0xc2, 0xe6, 0x4a, 0x18, 0x15, 0xf8,
+	     0x66, 0xc1, 0x33, 0xf0, 0x82, 0x48, 0xaa, 0xbf, 0x91, 0x11,
+	     0x80, 0x21, 0x69, 0xd8, 0xba, 0x67, 0xcd, 0x33, 0xc1, 0x33,
+	     0x01, 0x8b, 0x8f, 0x84, 0xd7, 0x67, 0x8e, 0x74, 0x23, 0x0c,
+	     0xf6, 0x2d, 0x1c, 0x86, 0x18, 0x23, 0x08, 0x07, 0x8d, 0xe2,
+	     0x8d, 0xc7, 0xc7, 0x29, 0x1c, 0x60, 0xa8, 0x9d, 0x4e, 0x83,
+	     0x93, 0x86, 0x4e, 0x86, 0x3f, 0xaf, 0xb0, 0x32, 0xba, 0x9b,
+	     0x17, 0xc0, 0xed, 0x76, 0x28, 0xc1, 0xc1, 0x5d, 0xe4, 0xc2,
+	     0xf0, 0x3a, 0x21, 0x89, 0x13, 0x67, 0x22, 0x32, 0xdc, 0x08,
+	     0xc7, 0x49, 0x63, 0xdf, 0x1e, 0x6a, 0x4d, 0x74, 0xd2, 0xe3,
+	     0xde, 0x1c, 0x29, 0x5b, 0x37, 0x23, 0x96, 0xd1, 0xd9, 0xd4,
+	     0x02, 0x36, 0xc7, 0x66, 0x12, 0x59, 0x76, 0x36, 0x73, 0x90,
+	     0x86, 0x98, 0x48, 0x20, 0x07, 0x90, 0x7e, 0xc0, 0xd3, 0xd3,
+	     0x43, 0xae, 0x60, 0xee, 0x33, 0xe3, 0xb8, 0x91, 0x19, 0x03,
+	     0xca, 0x9d, 0x42, 0x8a, 0xc0, 0x76, 0xbc, 0x4c, 0xba, 0x79,
+	     0xf9, 0x91, 0xc2, 0x83, 0xa1, 0xc2, 0x2a, 0xb5, 0x99, 0x60,
+	     0x13, 0xb1, 0x2d, 0x8a, 0x1d, 0xc7, 0xa1, 0x8a, 0xc9, 0xd6,
+	     0xc5, 0xcd, 0x05, 0x28, 0x3a, 0x70, 0x76, 0x37, 0x3c, 0x11,
+	     0xeb, 0x13, 0x8e, 0xdb, 0xc6, 0xc9, 0xf2, 0x30, 0xeb, 0x5b,
+	     0x55, 0x4e, 0x72, 0x82, 0x2f, 0x47, 0xaf, 0xa7, 0xe2, 0x20,
+	     0x07, 0x45, 0x60, 0x87, 0x80, 0x30, 0x2e, 0x31, 0x7a, 0x7b,
+	     0x05, 0x36, 0xf8, 0x61, 0x61, 0x42, 0x32, 0x59, 0x64, 0x4b,
+	     0x3b, 0x31, 0x3e, 0x88, 0x85, 0x99, 0x15, 0x58, 0x81, 0xa7,
+	     0x84, 0xa2, 0xf0, 0xb3, 0xe3, 0x15, 0x94, 0x60, 0x26, 0x3a,
+	     0xfb, 0x91, 0x10, 0x91, 0xdd, 0x63, 0x21, 0x90, 0xdf, 0xaa,
+	     0xce, 0xad, 0xf4, 0x3c, 0x9c, 0x60, 0xc6, 0x37, 0x49, 0x77,
+	     0x21, 0xad, 0x70, 0xda, 0x6c, 0x04, 0xb8, 0xf1, 0x44, 0x31,
+	     0xfc, 0xb4, 0x6a, 0x5b, 0x0b, 0xc2, 0x20, 0x99, 0xd6, 0xa4,
+	     0xa2, 0x89, 0x43, 0xf8, 0x14, 0xc0, 0x44, 0x3a, 0xdb, 0xeb,
+	     0x66, 0x87, 0xc7, 0xba, 0x12, 0x67, 0x68, 0x37, 0xf7, 0x1e,
+	     0x8d, 0x0a, 0xe0, 0x61, 0x68, 0x4a, 0x9b, 0x88, 0x6c, 0x63,
+	     0x46, 0xda, 0x99, 0x02, 0x11, 0x91, 0x47, 0x1d, 0xdc, 0xe5,
+	     0x4b, 0x34, 0xa7, 0xe4, 0x79, 0x58, 0x54, 0xc8, 0xe2, 0x2f,
+	     0xb1, 0xc5, 0xa6, 0x13, 0x2a, 0xf2, 0x48, 0x94, 0x78, 0x43,
+	     0x69, 0x51, 0xc1, 0xc8, 0x9a, 0x45, 0x86, 0x63, 0x57, 0x00,
+	     0x0b, 0xfa, 0x70, 0xe7, 0x22, 0x93, 0x39, 0x0d, 0x48, 0x63,
+	     0x96, 0xbb, 0x34, 0xcc, 0x4c, 0x2d, 0x31, 0xa1, 0xd8, 0x64,
+	     0xe8, 0x30, 0x15, 0x0e, 0x30, 0xf0, 0x42, 0x73, 0x94, 0x25,
+	     0xc3, 0x27, 0x27, 0x56, 0xd8, 0xb5, 0x15, 0x7c, 0x2e, 0x14,
+	     0x2c, 0xb0, 0x6b, 0x15, 0x66, 0x6f, 0x27, 0x94, 0xd3, 0xc9,
+	     0xcb, 0x21, 0x2f, 0x8e, 0x95, 0xb4, 0x8a, 0xf1, 0x56, 0x05,
+	     0xb3, 0x3b, 0x01, 0x26, 0x72, 0x95, 0xcd, 0x62, 0xb0, 0x09,
+	     0xff, 0x4a, 0x90, 0xc8, 0x12, 0x10, 0x88, 0x59, 0x5f, 0x42,
+	     0x2f, 0x86, 0xda, 0x0c, 0x0c, 0xa7, 0x85, 0x2e, 0x40, 0xc7,
+	     0x80, 0x37, 0xb4, 0x30, 0xc2, 0xa0, 0xc5, 0x07, 0xf3, 0x09,
+	     0xb7, 0x26, 0x2a, 0x02, 0x85, 0x6b, 0xb4, 0x19, 0xdf, 0x58,
+	     0x4d, 0x88, 0x28, 0xb6, 0x92, 0xe7, 0x3f, 0xb2, 0x5d, 0x25,
+	     0x42, 0x72, 0x76, 0xe9, 0x5a, 0x0d, 0x88, 0x21, 0x43, 0x0b,
+	     0xe5, 0x9b, 0x65, 0x07, 0xba, 0xaf, 0x6a, 0x21, 0xd1, 0xd0,
+	     0xae, 0xf9, 0xce, 0x88, 0x69, 0x88, 0xa9, 0xed, 0x91, 0x8d,
+	     0x8f, 0x61, 0x07, 0x3c, 0x09, 0xf8, 0x15, 0xcb, 0x96, 0x12,
+	     0x21, 0xbb, 0x2e, 0x9c, 0xf3, 0xce, 0xb5, 0xe6, 0x3b, 0x79,
+	     0x00, 0x3c, 0xc8, 0x42, 0x24, 0x39, 0xc0, 0x6a, 0x65, 0x72,
+	     0xb0, 0xc8, 0xb7, 0xeb, 0x02, 0xd2, 0x75, 0x67, 0x08, 0x6d,
+	     0x5c, 0xc5, 0x80, 0xc1, 0x2a, 0x10, 0x5b, 0x34, 0xfa, 0x71,
+	     0xf0, 0x78, 0x07, 0x62, 0x7e, 0xe5, 0x8a, 0x67, 0x81, 0xa6,
+	     0x09, 0x24, 0x77, 0x46, 0x93, 0x9c, 0x44, 0xfc, 0x9e, 0x63,
+	     0xf6, 0x39, 0xc6, 0x89, 0x7d, 0x8c, 0x15, 0x01, 0x87, 0x4a,
+	     0xe7, 0xc0, 0x89, 0x42, 0x27, 0x16, 0x31, 0xd0, 0x26, 0x5d,
+	     0x84, 0x70, 0x38, 0x63, 0x8c, 0x8a, 0x51, 0x48, 0x9e, 0x46,
+	     0x6d, 0x16, 0x96, 0x8f, 0xba, 0x65, 0x2a, 0x52, 0x98, 0x9c,
+	     0xcb, 0x71, 0xc7, 0x2c, 0x1b, 0x70, 0x26, 0x25, 0x03, 0x48,
+	     0xf2, 0x50, 0x19, 0xef, 0x00, 0x54, 0x98, 0x69, 0xca, 0x2f,
+	     0xb3, 0xb3, 0x39, 0x85, 0xd9, 0x81, 0xe6, 0x54, 0x84, 0xe0,
+	     0x93, 0x8c, 0xba, 0x70, 0x18, 0x4b, 0x16, 0x91, 0xd0, 0x1e,
+	     0x73, 0x68, 0xf2, 0x89, 0x22, 0x4b, 0x1a, 0x03, 0x12, 0x01,
+	     0xf3, 0x3a, 0x40, 0x48, 0xfd, 0x8f, 0xfd, 0xc5, 0x42, 0xe0,
+	     0x50, 0xbe, 0x08, 0x97, 0x55, 0x43, 0x82, 0x8f, 0x17, 0x9d,
+	     0x28, 0x2e, 0x07, 0x25, 0x0b, 0xd7, 0x71, 0x51, 0x72, 0x17,
+	     0x01, 0x12, 0xa1, 0x0e, 0xa1, 0xa6, 0x8f, 0x31, 0x69, 0x12,
+	     0xf0, 0x65, 0x00, 0x89, 0x5a, 0x13, 0x33, 0x56, 0x56, 0x3d,
+	     0x49, 0x8b, 0x61, 0xff, 0x03, 0x44, 0x01, 0x99, 0xe8, 0x15,
+	     0xbc, 0xa6, 0xd3, 0x88, 0xf6, 0xce, 0x05, 0xd4, 0x28, 0x99,
+	     0x7e, 0xf8, 0xa0, 0x22, 0x37, 0x90, 0x23, 0xe1, 0x10, 0x68,
+	     0x72, 0x7c, 0x31, 0x51, 0xf9, 0x2f, 0x7e, 0xc4, 0x3e, 0x27,
+	     0x1d, 0x29, 0x49, 0x0a, 0x2e, 0x61, 0xae, 0x34, 0x53, 0x52,
+	     0x9c, 0xf4, 0x6e, 0x60, 0x48, 0x5a, 0x1e, 0xdb, 0xe1, 0xa0,
+	     0x6f, 0xb1, 0x61, 0xda, 0x99, 0x7e, 0x99, 0xae, 0x56, 0x83,
+	     0x71, 0x81, 0xed, 0x1a, 0x61, 0xce, 0xe9, 0xa7, 0x16, 0x61,
+	     0x23, 0x51, 0x12, 0x92, 0x40, 0xce, 0x41, 0x19, 0xde, 0xef,
+	     0xa1, 0x4b, 0x48, 0x2b, 0x69, 0x59, 0x96, 0xbe, 0xe2, 0x6e,
+	     0xd4, 0x34, 0x31, 0xe6, 0x25, 0x42, 0x5f, 0x44, 0x09, 0xc9,
+	     0x98, 0x4c, 0x91, 0x64, 0x2c, 0x75, 0x43, 0x68, 0x1d, 0xcd,
+	     0xe7, 0xfc, 0x10, 0x94, 0xa0, 0x0f, 0x0a, 0x9b, 0x4e, 0x58,
+	     0xf0, 0xc4, 0x07, 0x06, 0x66, 0x00, 0xb3, 0x24, 0xe0, 0xa8,
+	     0x86, 0x98, 0x05, 0x8a, 0x1a, 0xef, 0x3f, 0x5d, 0x12, 0xda,
+	     0xcb, 0x2b, 0xe0, 0x2e, 0x90, 0x53, 0xba, 0x00, 0xe9, 0x5f,
+	     0xf8, 0xa3, 0xdd, 0x10, 0x15, 0xc4, 0x54, 0xd1, 0x1b, 0x43,
+	     0xaf, 0xa8, 0x3c, 0xe6, 0x7d, 0xbc, 0x8e, 0xca, 0x19, 0xa5,
+	     0x85, 0xf3, 0xe7, 0x6e, 0xe9, 0xe0, 0xe0, 0x2b, 0xb6, 0x90,
+	     0xc1, 0x89, 0x41, 0x5d, 0x6b, 0x45, 0xfd, 0x84, 0x4a, 0x62,
+	     0x64, 0xa9, 0x1b, 0x51, 0x6b, 0x96, 0x2c, 0x60, 0x17, 0x01,
+	     0x05, 0x66, 0x86, 0xee, 0x51, 0x82, 0x64, 0xf1, 0xce, 0x5f,
+	     0x90, 0x4c, 0xd8, 0x21, 0x76, 0x6e, 0xa7, 0x27, 0xc8, 0x31,
+	     0xe3, 0x49, 0x40, 0x4a, 0x74, 0xc4, 0x41, 0xcb, 0x13, 0x5f,
+	     0x70, 0xf0, 0x74, 0x32, 0x11, 0x1c, 0x90, 0x51, 0xa4, 0x89,
+	     0x3f, 0xc2, 0xe1, 0xc7, 0xcc, 0x8a, 0x82, 0xe8, 0x9b, 0x14,
+	     0x13, 0x00, 0x25, 0x4b, 0x2a, 0x44, 0x89, 0x70, 0x9b, 0x78,
+	     0x8e, 0xab, 0xd7, 0xa1, 0xf4, 0x92, 0x60, 0x69, 0x98, 0x74,
+	     0x7e, 0x2d, 0xf0, 0x91, 0x33, 0xc5, 0x6f, 0x79, 0x9c, 0x70,
+	     0x0f, 0x65, 0x34, 0x2e, 0x31, 0x9a, 0x22, 0xa4, 0x45, 0xa1,
+	     0x90, 0x0a, 0xa0, 0xfa, 0xc3, 0x51, 0x4a, 0x7f, 0x74, 0x0b,
+	     0xd3, 0x8b, 0xa4, 0x99, 0xee, 0x52, 0x39, 0xc1, 0x00, 0x58,
+	     0x16, 0x4a, 0x7e, 0xa4, 0x2e, 0xbc, 0xb4, 0x8a, 0x51, 0x47,
+	     0xcb, 0x6e, 0x52, 0x21, 0x72, 0x2a, 0x6d, 0x09, 0xaf, 0x63,
+	     0x8c, 0x29, 0x81, 0xd4, 0x3d, 0xa2, 0x1b, 0x65, 0x74, 0x09,
+	     0x62, 0x54, 0xd6, 0xfc, 0x05, 0xb2, 0x1a, 0x5e, 0xd9, 0xcd,
+	     0xd0, 0x7d, 0xc8, 0xd0, 0x58, 0x82, 0xc9, 0x1a, 0x4a, 0x8f,
+	     0xec, 0x00, 0xe1, 0x4f, 0x59, 0x2b, 0xfe, 0x47, 0xa2, 0x21,
+	     0x54, 0x11, 0x37, 0x79, 0x00, 0xac, 0x1f, 0x2d, 0xca, 0x40,
+	     0x21, 0x86, 0x11, 0xbf, 0xdc, 0xd9, 0x2d, 0x34, 0x57, 0x1b,
+	     0x0b, 0x13, 0xb3, 0x4b, 0x7a, 0xc7, 0x11, 0xe4, 0xbd, 0x4b,
+	     0xdb, 0x4d, 0xa6, 0x92, 0x85, 0x90, 0x2e, 0x53, 0xd6, 0x9e,
+	     0xab, 0x42, 0xf2, 0x53, 0x59, 0x12, 0xd5, 0x8b, 0x4a, 0x2c,
+	     0x81, 0x89, 0xa3, 0x83, 0x2c, 0x11, 0x83, 0x44, 0xc5, 0xbc,
+	     0x73, 0x98, 0xa9, 0x72, 0x42, 0x55, 0xc8, 0x97, 0xc5, 0x67,
+	     0xa8, 0xaa, 0x54, 0xbf, 0xdb, 0x9d, 0xb4, 0x1e, 0xde, 0x2a,
+	     0x24, 0x4a, 0x98, 0xa0, 0x93, 0xe1, 0x1b, 0xa6, 0x98, 0x8c,
+	     0x51, 0xbd, 0xdf, 0x7e, 0x19, 0xdc, 0xb9, 0x0c, 0xa3, 0x1b,
+	     0x24, 0x0c, 0x06, 0xeb, 0x38, 0xac, 0x24, 0xfe, 0x8c, 0x50,
+	     0xfe, 0xa7, 0x62, 0xd3, 0xc1, 0xe6, 0x33, 0x76, 0x49, 0x28,
+	     0x0e, 0x52, 0x34, 0x89, 0x24, 0x25, 0xcb, 0x2b, 0x0e, 0x80,
+	     0xd2, 0x75, 0xc0, 0xf3, 0x92, 0x19, 0x18, 0x60, 0x66, 0x18,
+	     0xf8, 0x92, 0xd3, 0x89, 0x4d, 0x83, 0x30, 0x28, 0x69, 0x12,
+	     0x07, 0xca, 0xcc, 0x44, 0x27, 0xb4, 0x35, 0xb7, 0x4a, 0x85,
+	     0x73, 0x2b, 0xf1, 0xfb, 0x50, 0x18, 0x59, 0x2a, 0xd8, 0x90,
+	     0x0f, 0x94, 0xb0, 0xa3, 0xa9, 0x61, 0x90, 0xe2, 0x36, 0x7a,
+	     0x59, 0x2a, 0x1f, 0x95, 0x2f, 0x15, 0x2e, 0xfc, 0xe3, 0xe5,
+	     0x0a, 0x1a, 0xf5, 0x90, 0xa0, 0x97, 0xd0, 0xea, 0x0e, 0x56,
+	     0x35, 0xbb, 0x4a, 0x9c, 0x11, 0x41, 0x04, 0xd7, 0x01, 0xd3,
+	     0x01, 0xed, 0xb7, 0x02, 0x50, 0x66, 0x8f, 0x06, 0x86, 0x50,
+	     0xce, 0xe1, 0xa8, 0x50, 0x60, 0xae, 0x71, 0x0d, 0x66, 0x28,
+	     0x75, 0x4d, 0xfa, 0x92, 0xb5, 0x70, 0xf1, 0xe7, 0xc8, 0xcc,
+	     0x4a, 0x10, 0xf4, 0x90, 0x08, 0xb2, 0x31, 0x36, 0x4c, 0x10,
+	     0x8a, 0x9e, 0xa9, 0xd7, 0x5c, 0x51, 0x9e, 0x2f, 0x3f, 0x6f,
+	     0x03, 0x32, 0xdb, 0x64, 0x62, 0xa4, 0x7f, 0xb6, 0xcb, 0xac,
+	     0xc6, 0x09, 0x32, 0xe2, 0x0d, 0x61, 0xa9, 0xa4, 0xdd, 0x3d,
+	     0x6e, 0x9a, 0xd5, 0x98, 0x3a, 0x26, 0x74, 0x03, 0x75, 0x05,
+	     0xe0, 0x0e, 0x51, 0x40, 0x14, 0x69, 0xd5, 0x35, 0x8d, 0x92,
+	     0x75, 0x38, 0xd6, 0xd8, 0x86, 0x20, 0xbc, 0xae, 0x5c, 0x88,
+	     0xf1, 0xb0, 0x09, 0xd1, 0x29, 0x19, 0x4e, 0x14, 0x15, 0x70,
+	     0xb6, 0xbc, 0x58, 0x90, 0xce, 0x62, 0x70, 0x51, 0xcb, 0x22,
+	     0x63, 0xda, 0xba, 0xd0, 0x31, 0x93, 0x12, 0x01, 0x11, 0x31,
+	     0xcc, 0xa3, 0xc0, 0xf6, 0x39, 0xbd, 0x20, 0x18, 0x1f, 0x48,
+	     0x1b, 0x95, 0xc2, 0xe6, 0xe4, 0x21, 0xd0, 0x93, 0x6b, 0x7a,
+	     0x30, 0xd4, 0x19, 0x60, 0x5e, 0xc4, 0xa3, 0x40, 0xdb, 0x86,
+	     0xad, 0x92, 0xd6, 0xcd, 0xc8, 0xb2, 0x7c, 0x27, 0x48, 0x98,
+	     0x5d, 0x32, 0x58, 0x66, 0x8b, 0xc4, 0xc7, 0x98, 0x71, 0xfb,
+	     0x49, 0xd5, 0x94, 0xf0, 0x88, 0xee, 0x36, 0xa6, 0xce, 0x61,
+	     0x82, 0xb2, 0x04, 0x7b, 0x49, 0xfb, 0x08, 0x37, 0xc0, 0x6f,
+	     0x3f, 0x36, 0xec, 0x62, 0x64, 0x4e, 0x43, 0xf2, 0xe9, 0x99,
+	     0x20, 0x5c, 0x69, 0x0c, 0x74, 0x70, 0x92, 0xbb, 0x4f, 0x38,
+	     0xa6, 0x77, 0xc9, 0x3f, 0x12, 0x9d, 0xed, 0x58, 0xc8, 0x99,
+	     0x5b, 0x35, 0xd3, 0x18, 0xc5, 0x84, 0x67, 0xa3, 0xe1, 0x6a,
+	     0xd7, 0xf1, 0x65, 0x30, 0x59, 0xd3, 0x3b, 0xed, 0x51, 0x39,
+	     0x2d, 0x4d, 0x99, 0x4b, 0x20, 0x11, 0xae, 0xe7, 0xc8, 0x70,
+	     0x88, 0x1a, 0x5e, 0x43, 0x87, 0xa5, 0x04, 0x50, 0xfc, 0x70,
+	     0x67, 0xc4, 0x16, 0x96, 0x3d, 0xb0, 0x2b, 0xef, 0x44, 0xd1,
+	     0x30, 0xe7, 0x34, 0xc9, 0xd0, 0xc0, 0x51, 0x1a, 0xdb, 0x79,
+	     0x07, 0xb2, 0x3f, 0xe5, 0xfe, 0xa5, 0x0f, 0xe9, 0xc1, 0x54,
+	     0x1b, 0x3a, 0x89, 0xd6, 0x94, 0x56, 0x39, 0x09, 0x46, 0x15,
+	     0x4c, 0x5e, 0x79, 0x66, 0x54, 0xdf, 0xb5, 0x2b, 0x84, 0x42,
+	     0xa8, 0xc5, 0x7c, 0xd6, 0xff, 0x24, 0x65, 0x42, 0x0e, 0x30,
+	     0x6c, 0x20, 0x1f, 0x9c, 0x41, 0xeb, 0xa7, 0xfd, 0xa1, 0xdd,
+	     0x06, 0x05, 0xf4, 0x0e, 0x44, 0xb3, 0x44, 0x55, 0x84, 0x08,
+	     0x15, 0x42, 0xf9, 0xa5, 0x21, 0x32, 0x80, 0xc1, 0x45, 0x90,
+	     0xe7, 0x81, 0x77, 0x26, 0x93, 0xa1, 0xc5, 0x43, 0x5d, 0xa1,
+	     0x4a, 0xa6, 0x31, 0x3b, 0x5c, 0xb3, 0x19, 0x10, 0xe0, 0x5c,
+	     0x74, 0x27, 0xa7, 0xe2, 0xb1, 0x47, 0x8e, 0x03, 0xba, 0xe2,
+	     0xc0, 0x88, 0x97, 0x96, 0x22, 0xd1, 0x27, 0xf3, 0x49, 0x19,
+	     0x83, 0x5f, 0xf8, 0xd4, 0x61, 0xe3, 0x34, 0x1d, 0x86, 0x10,
+	     0x9a, 0x8d, 0xcd, 0xc2, 0xa5, 0x4d, 0x10, 0x34, 0x79, 0x84,
+	     0xff, 0x89, 0xdb, 0xc0, 0x85, 0x1e, 0x32, 0xd4, 0x56, 0x61,
+	     0x8b, 0x36, 0x85, 0x42, 0x72, 0xec, 0x68, 0x44, 0x02, 0x86,
+	     0xbb, 0x83, 0x91, 0xa1, 0x16, 0xeb, 0xb1, 0x07, 0xc6, 0xb0,
+	     0x3e, 0xad, 0x11, 0xd5, 0x8b, 0x1d, 0x9b, 0x8d, 0x47, 0x6e,
+	     0x24, 0xe2, 0x55, 0x6e, 0xb3, 0x4b, 0xee, 0xce, 0x7a, 0x75,
+	     0xb7, 0xc7, 0x88, 0xcb, 0xe3, 0x0c, 0x8b, 0xe4, 0x6c, 0xf2,
+	     0x55, 0x21, 0xb7, 0x20, 0x1b, 0xf5, 0xbe, 0xa0, 0xcd, 0x45,
+	     0xc3, 0xa4, 0xd5, 0xca, 0x61, 0xb2, 0xf0, 0xc6, 0xea, 0x44,
+	     0xf5, 0x16, 0xb9, 0xc5, 0x55, 0x33, 0xf5, 0x46, 0x9b, 0xc9,
+	     0x2b, 0x80, 0x01, 0x7a, 0x54, 0x7f, 0x3d, 0xf2, 0x94, 0x46,
+	     0xd2, 0x4d, 0x46, 0xb5, 0x6a, 0x50, 0x6d, 0x48, 0x00, 0x13,
+	     0xd8, 0x9f, 0x48, 0xcb, 0x9c, 0xc0, 0x5d, 0xe3, 0x19, 0xb1,
+	     0x1c, 0xd2, 0x7e, 0x96, 0x16, 0x35, 0x46, 0xa7, 0x55, 0xd8,
+	     0x4e, 0x1d, 0x88, 0x1a, 0x3c, 0xcd, 0x60, 0x92, 0x68, 0x37,
+	     0x2a, 0x1c, 0xe0, 0x98, 0x6c, 0x61, 0x62, 0x27, 0xd6, 0xc9,
+	     0xfc, 0x90, 0x34, 0x41, 0x58, 0x25, 0x0d, 0xf6, 0x4b, 0x7d,
+	     0x70, 0x33, 0xf3, 0xd0, 0x43, 0xca, 0xd0, 0x39, 0xa8, 0x1a,
+	     0x37, 0x14, 0xf9, 0x85, 0x1c, 0xf2, 0xfe, 0xd2, 0x47, 0x91,
+	     0x11, 0xad, 0x91, 0x72, 0x58, 0x8f, 0x90, 0x25, 0x9e, 0x31,
+	     0x01, 0x32, 0x63, 0xc3, 0xbb, 0x29, 0xb2, 0x0e, 0x73, 0x30,
+	     0x32, 0xca, 0x9f, 0x26, 0xa5, 0x47, 0x9c, 0xe0, 0xab, 0x80,
+	     0x1f, 0xd4, 0x2a, 0x20, 0x48, 0x6b, 0x49, 0xe6, 0x96, 0x42,
+	     0x91, 0x43, 0xb7, 0x41, 0x11, 0x99, 0xcc, 0x6b, 0xd8, 0x41,
+	     0x86, 0x02, 0x20, 0x25, 0xf6, 0x09, 0x9f, 0x75, 0xe0, 0x6b,
+	     0x5c, 0xe8, 0x72, 0xb0, 0x17, 0x63, 0x96, 0xbc, 0xd7, 0x5f,
+	     0xe8, 0xf5, 0xe4, 0x55, 0x4c, 0xa8, 0x41, 0x2b, 0x92, 0x1d,
+	     0x1e, 0x21, 0x44, 0xc2, 0x82, 0x65, 0xc6, 0xd4, 0x81, 0x02,
+	     0x0b, 0x28, 0x11, 0xcc, 0x21, 0x84, 0xcd, 0xda, 0xd0, 0x6e,
+	     0x13, 0xc9, 0xc7, 0xe1, 0xfa, 0x2a, 0x98, 0x4b, 0x3a, 0x7a,
+	     0x8e, 0x0f, 0xa9, 0xd1, 0x62, 0xca, 0x0c, 0x13, 0xc7, 0x59,
+	     0xe0, 0x28, 0x31, 0x4f, 0x6d, 0xcb, 0x47, 0xe6, 0x63, 0x9c,
+	     0xcb, 0xb9, 0x16, 0x0e, 0xb4, 0xe4, 0x11, 0x44, 0x96, 0x3f,
+	     0xb9, 0xc9, 0xad, 0x88, 0xa4, 0x27, 0x22, 0x60, 0xe7, 0x03,
+	     0x08, 0x66, 0xd4, 0x84, 0x8a, 0x59, 0x18, 0x53, 0xd0, 0x63,
+	     0xcd, 0xb1, 0x50, 0x08, 0xd9, 0x7e, 0xfc, 0x4e, 0x34, 0x61,
+	     0xa4, 0x02, 0xa3, 0x03, 0xd5, 0x66, 0x9c, 0x94, 0x31, 0x62,
+	     0x75, 0x3d, 0xd1, 0x06, 0x71, 0x19, 0x83, 0x13, 0x94, 0x00,
+	     0x4b, 0x25, 0xa1, 0x18, 0x69, 0x13, 0x26, 0xe8, 0xd0, 0x6b,
+	     0x2c, 0x3b, 0x82, 0x23, 0xd6, 0x4c, 0x5e, 0x72, 0x56, 0xb8,
+	     0xab, 0x48, 0x65, 0x58, 0x0e, 0xae, 0x42, 0x13, 0x25, 0x0e,
+	     0x4c, 0x00, 0x90, 0xe0, 0xab, 0x19, 0xdd, 0x1c, 0x81, 0x08,
+	     0x02, 0x23, 0x02, 0xd2, 0x9a, 0xa5, 0xfc, 0xb5, 0x57, 0x28,
+	     0xaa, 0x60, 0x1a, 0x90, 0x8c, 0xcb, 0xc1, 0xc9, 0x55, 0xb4,
+	     0xa4, 0xa1, 0x08, 0xfa, 0xf9, 0xdb, 0xe1, 0x2c, 0xee, 0x50,
+	     0xf5, 0xa7, 0xb8, 0x10, 0xef, 0xa2, 0xe3, 0x91, 0x37, 0xea,
+	     0xc3, 0x4d, 0x4c, 0x20, 0x92, 0xc2, 0x01, 0x3e, 0x16, 0x0e,
+	     0x04, 0x9a, 0x21, 0xe3, 0x10, 0x19, 0xb8, 0x22, 0x3d, 0x56,
+	     0xd0, 0x22, 0xe8, 0x26, 0xbd, 0x41, 0x96, 0x21, 0xa4, 0x3a,
+	     0xa1, 0x79, 0x58, 0x86, 0x9a, 0xf6, 0x81, 0x26, 0x8e, 0xba,
+	     0x84, 0x60, 0x71, 0x2f, 0x14, 0x25, 0x01, 0x0c, 0x4e, 0x45,
+	     0x13, 0x92, 0xf1, 0x90, 0x60, 0x4e, 0xd7, 0xe8, 0xf3, 0x08,
+	     0x29, 0x6c, 0xe5, 0xd4, 0x43, 0x0e, 0x16, 0x37, 0x60, 0x99,
+	     0xe2, 0x5e, 0x16, 0xbd, 0x3b, 0x18, 0xd2, 0xbc, 0xd4, 0x60,
+	     0x74, 0xae, 0xe9, 0x9f, 0x85, 0xcd, 0xdc, 0x16, 0xe3, 0xa1,
+	     0xac, 0xa9, 0x16, 0xc4, 0x92, 0x3a, 0x90, 0x6d, 0xcc, 0xe6,
+	     0x4d, 0x95, 0x96, 0x02, 0xa3, 0xd4, 0xb1, 0x31, 0xc5, 0x65,
+	     0x8a, 0xc3, 0x07, 0xc9, 0x58, 0x4c, 0xc4, 0x02, 0x43, 0x31,
+	     0x1c, 0x9c, 0x9e, 0xac, 0x63, 0x86, 0x41, 0xaa, 0x40, 0xee,
+	     0x30, 0xa8, 0x28, 0xe8, 0x81, 0x14, 0x2c, 0x81, 0x06, 0x61,
+	     0x2f, 0x48, 0xde, 0xe4, 0x53, 0xe8, 0xa1, 0x82, 0x18, 0xb3,
+	     0x28, 0xe2, 0xdb, 0x3a, 0x41, 0xba, 0x0d, 0x2b, 0x46, 0x3a,
+	     0xd1, 0x0e, 0x52, 0xe4, 0x08, 0xa6, 0x85, 0x61, 0xee, 0x0d,
+	     0x5e, 0x33, 0x23, 0xdd, 0x9b, 0xe3, 0x64, 0xf8, 0x04, 0xf9,
+	     0x33, 0xee, 0xf1, 0xbc, 0x85, 0x87, 0x87, 0x77, 0x87, 0xc5,
+	     0x46, 0x0d, 0x11, 0xd5, 0xd1, 0xfc, 0x0d, 0xc7, 0xfc, 0x97,
+	     0xe7, 0x9e, 0x6b, 0xa3, 0xc0, 0x29, 0xcf, 0x53, 0x13, 0x7c,
+	     0x81, 0x99, 0x68, 0x48, 0x35, 0x81, 0x47, 0xaa, 0xd4, 0xdb,
+	     0x0b, 0x72, 0xf9, 0x59, 0x43, 0xb1, 0x44, 0x27, 0x41, 0x05,
+	     0xb8, 0x48, 0x88, 0x61, 0xf6, 0x63, 0x69, 0xb8, 0x56, 0x63,
+	     0xb5, 0x61, 0xfc, 0xe8, 0x43, 0x97, 0x0c, 0xa6, 0xc0, 0x29,
+	     0x70, 0xdd, 0x65, 0xfe, 0xfa, 0xae, 0x60, 0x61, 0xa6, 0x05,
+	     0x99, 0x85, 0xa5, 0xdb, 0xa5, 0xb2, 0xb4, 0x50, 0x39, 0x1a,
+	     0xc8, 0x98, 0x1f, 0x26, 0x51, 0x50, 0x3f, 0x8c, 0xe1, 0x98,
+	     0xc1, 0xba, 0x81, 0x99, 0x12, 0xd2, 0x0c, 0x1d, 0xc3, 0x41,
+	     0xe3, 0xab, 0x3e, 0xa1, 0x67, 0x0f, 0x50, 0x75, 0x96, 0x48,
+	     0xfd, 0xf0, 0x37, 0x5a, 0x21, 0xd6, 0x12, 0x03, 0x44, 0x43,
+	     0x29, 0x4c, 0x08, 0x9c, 0xc9, 0x30, 0xdd, 0x42, 0x78, 0x9b,
+	     0xc3, 0x22, 0xf2, 0x80, 0x6c, 0x4a, 0x9c, 0x07, 0x24, 0x60,
+	     0x09, 0xfa, 0x29, 0x60, 0x0d, 0x1d, 0xc6, 0x59, 0x04, 0x91,
+	     0x8b, 0x15, 0x86, 0xcd, 0x83, 0x3b, 0xee, 0x3b, 0x74, 0x76,
+	     0xb2, 0x88, 0x97, 0xdf, 0x38, 0xcf, 0x18, 0xb8, 0x91, 0x80,
+	     0xe7, 0xdd, 0xb0, 0xc4, 0x23, 0x92, 0x2d, 0x22, 0xe1, 0xb1,
+	     0x0d, 0xb3, 0x85, 0x57, 0xb4, 0x0e, 0x29, 0xe2, 0x5a, 0x0b,
+	     0x8d, 0x21, 0x49, 0xe0, 0x83, 0xe0, 0x79, 0x06, 0xc1, 0x98,
+	     0x28, 0xfd, 0x48, 0x7a, 0x2f, 0xee, 0x84, 0x75, 0x45, 0xf7,
+	     0xc7, 0xa0, 0x53, 0x14, 0xe8, 0x41, 0x72, 0x14, 0x70, 0x5f,
+	     0xda, 0x46, 0x80, 0x48, 0x7b, 0x88, 0xc9, 0xb7, 0xe8, 0xe9,
+	     0x79, 0x74, 0xc3, 0xe4, 0x5b, 0x1c, 0x90, 0x1b, 0x5f, 0xba,
+	     0xe7, 0x5d, 0x22, 0x88, 0x2b, 0xaf, 0x98, 0xe9, 0x40, 0x4c,
+	     0x48, 0x8c, 0xc8, 0x52, 0xb8, 0x4c, 0x73, 0xa9, 0x2a, 0xd3,
+	     0x52, 0x50, 0x03, 0x73, 0x72, 0xb0, 0x0f, 0x9d, 0x1c, 0x31,
+	     0x6f, 0x13, 0x83, 0xa0, 0xf2, 0x52, 0xd1, 0x02, 0xb1, 0x28,
+	     0x95, 0xb0, 0x6c, 0xd2, 0x27, 0x0c, 0x98, 0x03, 0x8e, 0x44,
+	     0x91, 0x29, 0x22, 0xef, 0x53, 0x2e, 0x2e, 0x04, 0x41, 0x1f,
+	     0x08, 0x84, 0x94, 0xfa, 0xa0, 0x5d, 0xf4, 0x4b, 0xe2, 0x27,
+	     0xca, 0x06, 0xb3, 0xd8, 0xbb, 0x6d, 0xe9, 0xc2, 0x6b, 0xc9,
+	     0xf8, 0x71, 0x26, 0x37, 0x55, 0xb2, 0x9b, 0x4d, 0x17, 0x7e,
+	     0x90, 0x9d, 0x95, 0x33, 0xe2, 0xbe, 0x81, 0x4c, 0x2c, 0x80,
+	     0xb9, 0x8f, 0xe3, 0xe1, 0x87, 0xd1, 0x29, 0xf3, 0x63, 0x59,
+	     0x6f, 0xba, 0xab, 0xee, 0x86, 0xd5, 0x4d, 0xad, 0xd3, 0xb2,
+	     0xee, 0x08, 0x75, 0xb9, 0x53, 0x98, 0xa0, 0x0f, 0x0e, 0x19,
+	     0xda, 0x03, 0x64, 0x05, 0x7c, 0xf3, 0x58, 0x64, 0x7a, 0x3a,
+	     0xe9, 0x30, 0x1c, 0xa7, 0x18, 0x21, 0x4b, 0xb2, 0x87, 0x9e,
+	     0x08, 0xf3, 0x95, 0x08, 0x71, 0x65, 0x61, 0x70, 0x5a, 0x3c,
+	     0x08, 0x8d, 0x18, 0xc2, 0xb4, 0xcd, 0x71, 0x89, 0x7d, 0x6b,
+	     0x69, 0x2c, 0x31, 0x39, 0x35, 0x91, 0x8a, 0xad, 0x85, 0xf3,
+	     0x2d, 0xc1, 0x92, 0x46, 0x8b, 0x05, 0x16, 0x6a, 0x2a, 0x4f,
+	     0x2f, 0xa3, 0x01, 0xe0, 0xba, 0x66, 0x79, 0x62, 0xff, 0x32,
+	     0x25, 0x00, 0xbd, 0x5a, 0x1e, 0xb6, 0x25, 0x68, 0x00, 0x98,
+	     0x32, 0x82, 0x36, 0x2f, 0x11, 0x39, 0xee, 0x03, 0x2f, 0x4b,
+	     0x04, 0x44, 0x7f, 0x59, 0x7a, 0xd1, 0x33, 0x56, 0xc2, 0x8b,
+	     0x19, 0xe6, 0x68, 0x7c, 0x05, 0x3f, 0xa0, 0xb6, 0xe4, 0xad,
+	     0x04, 0x4b, 0xa0, 0x4e, 0x71, 0x47, 0xa8, 0xf0, 0x0e, 0x4d,
+	     0xe1, 0x9b, 0x51, 0xe4, 0xc5, 0x87, 0xed, 0x86, 0x92, 0x9b,
+	     0x7d, 0x79, 0x4e, 0x66, 0x46, 0x5c, 0x43, 0xbf, 0x86, 0x66,
+	     0x85, 0x06, 0x52, 0x20, 0xe2, 0x67, 0x7c, 0xd3, 0x0e, 0x32,
+	     0x5b, 0x1b, 0x56, 0x25, 0x28, 0xc6, 0x24, 0x21, 0x03, 0x48,
+	     0xea, 0x04, 0x03, 0x23, 0x52, 0xb1, 0x1a, 0x1c, 0xd1, 0x06,
+	     0x26, 0xee, 0xf0, 0x8a, 0xc4, 0xe7, 0xe5, 0xdd, 0x60, 0x04,
+	     0xcb, 0x02, 0x0c, 0xd6, 0x63, 0xea, 0xd1, 0x85, 0x1b, 0xec,
+	     0x25, 0x26, 0x1a, 0x4f, 0x7d, 0x53, 0xb5, 0xff, 0xc3, 0xe8,
+	     0x4a, 0x44, 0x84, 0x3d, 0x2c, 0x00, 0x50, 0xe0, 0x2c, 0x67,
+	     0xb1, 0x3b, 0x6a, 0x0f, 0xe7, 0x88, 0xf2, 0xa2, 0x59, 0x5c,
+	     0xa2, 0x89, 0x13, 0x3b, 0x70, 0x85, 0x03, 0x48, 0x1d, 0x31,
+	     0xe8, 0x5c, 0x33, 0x7e, 0x28, 0xc8, 0x75, 0x4e, 0x18, 0x45,
+	     0xab, 0x08, 0xee, 0xe5, 0xb0, 0x60, 0x22, 0x81, 0x81, 0x7c,
+	     0x99, 0xb5, 0x12, 0x59, 0x20, 0xfa, 0x23, 0x86, 0x97, 0x33,
+	     0x71, 0xa5, 0x20, 0x0c, 0x84, 0x22, 0x60, 0x75, 0x7e, 0x5f,
+	     0xfe, 0x2b, 0x59, 0xe6, 0x9c, 0x0a, 0x6f, 0x46, 0xd7, 0x02,
+	     0xba, 0x6c, 0xc6, 0xfe, 0x86, 0xf8, 0xba, 0xd5, 0xd8, 0x17,
+	     0x29, 0x59, 0x97, 0x9f, 0x13, 0x2d, 0x80, 0x09, 0xe9, 0x62,
+	     0xea, 0x43, 0xd6, 0xc3, 0x1c, 0x73, 0x48, 0x25, 0x4b, 0xfa,
+	     0x83, 0xe8, 0xd7, 0xb4, 0x54, 0xa2, 0x88, 0xaf, 0x10, 0x68,
+	     0xcb, 0x32, 0xb8, 0xd8, 0x02, 0x6c, 0x45, 0xb1, 0xc4, 0x10,
+	     0x61, 0x2e, 0xf9, 0x0b, 0xc6, 0x20, 0xb3, 0x78, 0x27, 0x40,
+	     0x10, 0xa6, 0xba, 0x70, 0x7b, 0x85, 0xab, 0xa4, 0x5e, 0x5e,
+	     0x4a, 0xed, 0xf7, 0x3d, 0xf3, 0x26, 0x0c, 0x50, 0x04, 0x26,
+	     0x68, 0x39, 0x01, 0x67, 0x4c, 0x21, 0xb4, 0x16, 0xa0, 0xa2,
+	     0x94, 0xf9, 0x55, 0xd0, 0x68, 0x1a, 0xac, 0xac, 0x13, 0x4a,
+	     0x92, 0xe6, 0x31, 0x41, 0x29, 0x03, 0xda, 0xe8, 0x44, 0x61,
+	     0x49, 0x29, 0x7f, 0x11, 0x26, 0xef, 0xcf, 0x02, 0x07, 0x1a,
+	     0x2a, 0x68, 0x26, 0xdb, 0x19, 0xbb, 0xa2, 0xe0, 0x64, 0x37,
+	     0xd2, 0x25, 0x72, 0xfd, 0x19, 0x08, 0x29, 0xae, 0x3a, 0x0e,
+	     0xda, 0xa9, 0xa3, 0x01, 0x67, 0xae, 0xa1, 0x16, 0x44, 0x32,
+	     0xbd, 0x34, 0x13, 0x56, 0x71, 0x44, 0x9b, 0x26, 0x09, 0xdb,
+	     0x86, 0xeb, 0xc3, 0x5d, 0xb1, 0x24, 0x8d, 0x92, 0x2a, 0x7d,
+	     0x79, 0xa7, 0x09, 0x88, 0x7f, 0x48, 0x2c, 0xe1, 0x05, 0xfb,
+	     0x1c, 0x4a, 0xb3, 0x54, 0x54, 0xe8, 0x29, 0x04, 0x06, 0xb9,
+	     0xc4, 0x36, 0x27, 0x69, 0xfc, 0x4d, 0xc2, 0x28, 0x9b, 0x6e,
+	     0x44, 0x26, 0x04, 0x1d, 0x00, 0x45, 0xb5, 0xf8, 0x09, 0x69,
+	     0x62, 0x94, 0x21, 0x30, 0x46, 0xd8, 0xab, 0x3c, 0x9b, 0x5d,
+	     0xe1, 0x94, 0x67, 0x71, 0xbb, 0xbf, 0x71, 0xb6, 0x7a, 0x2b,
+	     0xda, 0x8f, 0x75, 0xe6, 0xc8, 0xab, 0x12, 0xc0, 0x6c, 0xa0,
+	     0x2a, 0x68, 0x10, 0xfb, 0x60, 0xf3, 0x29, 0x76, 0x86, 0xe3,
+	     0x8d, 0x3b, 0x02, 0x4f, 0x18, 0x03, 0xfe, 0x83, 0x64, 0x4a,
+	     0x1c, 0x9f, 0x6b, 0x20, 0x0e, 0xa8, 0xca, 0x57, 0xed, 0xda,
+	     0x51, 0x96, 0xa6, 0x26, 0x13, 0x19, 0x17, 0x02, 0xde, 0xda,
+	     0x82, 0x24, 0x61, 0x43, 0x31, 0x72, 0x40, 0x59, 0x72, 0x8e,
+	     0xf9, 0x45, 0x53, 0x14, 0x14, 0x45, 0x2b, 0x02, 0x1f, 0xf0,
+	     0xb4, 0xed, 0x21, 0xd7, 0x14, 0xbb, 0x10, 0xaf, 0x63, 0x3f,
+	     0x31, 0x5c, 0xf1, 0xe8, 0x01, 0x8b, 0x48, 0x51, 0xda, 0x69,
+	     0xb6, 0x01, 0x35, 0xc0, 0xd4, 0xc1, 0x27, 0xd3, 0xd1, 0xf9,
+	     0x15, 0x1c, 0xc6, 0x56, 0x7f, 0x44, 0x21, 0xe2, 0x9f, 0xf8,
+	     0x4e, 0x5c, 0xf5, 0x1a, 0xfa, 0x8a, 0x5d, 0x9e, 0x1a, 0x11,
+	     0xca, 0x42, 0x3f, 0x96, 0x77, 0x0a, 0xb7, 0x24, 0xd6, 0xac,
+	     0x39, 0xf5, 0x37, 0xfe, 0x05, 0x0f, 0x34, 0x0f, 0x55, 0x82,
+	     0x4c, 0xc0, 0xf0, 0x51, 0x63, 0xdd, 0x30, 0xdf, 0xec, 0x97,
+	     0x9d, 0x10, 0x8c, 0x22, 0xbf, 0x0b, 0x30, 0xd7, 0x88, 0x4c,
+	     0x40, 0x2a, 0x9b, 0x64, 0x21, 0x77, 0x4a, 0x82, 0x09, 0xd1,
+	     0x90, 0xd0, 0x58, 0xbe, 0xa8, 0xd7, 0x58, 0x1a, 0x27, 0x88,
+	     0x3c, 0x90, 0xff, 0x63, 0x1e, 0x69, 0x16, 0x79, 0x7f, 0xf0,
+	     0xd8, 0x50, 0x32, 0x37, 0x87, 0x52, 0x03, 0xe1, 0xdf, 0x5d,
+	     0x22, 0x13, 0x54, 0xb8, 0x74, 0xb3, 0xf9, 0xd2, 0xc8, 0x19,
+	     0xe3, 0x97, 0x77, 0x5c, 0x76, 0x82, 0x6c, 0xe5, 0xba, 0x30,
+	     0x23, 0xa9, 0xad, 0x60, 0x2c, 0x9e, 0x03, 0x0c, 0xc9, 0x55,
+	     0x29, 0x4c, 0x57, 0xf9, 0xe3, 0x38, 0xb4, 0x1f, 0xcc, 0x5d,
+	     0xae, 0xc9, 0xb0, 0x20, 0x8b, 0xc7, 0xf8, 0x47, 0x9d, 0x82,
+	     0xcf, 0x55, 0xba, 0xbe, 0x51, 0xfa, 0x3a, 0x43, 0xd8, 0xaf,
+	     0xe8, 0x9d, 0x52, 0xd3, 0xaa, 0x50, 0x85, 0x6c, 0x7c, 0x00,
+	     0x39, 0x45, 0x1b, 0xa4, 0x38, 0xe9, 0x20, 0x61, 0xf9, 0xa1,
+	     0x45, 0xe6, 0x20, 0x70, 0x15, 0xdc, 0x40, 0x10, 0x63, 0xdc,
+	     0xeb, 0x0d, 0x26, 0xaa, 0x6c, 0xf4, 0xb5, 0xaf, 0x0c, 0x80,
+	     0x6a, 0x82, 0x9b, 0x1d, 0x58, 0xd0, 0x9f, 0x63, 0x8b, 0xb1,
+	     0xf2, 0x18, 0x0a, 0xd3, 0x0b, 0xee, 0x2f, 0x35, 0x06, 0x9f,
+	     0x0c, 0xe7, 0xa7, 0x8e, 0x54, 0x0b, 0xb0, 0x30, 0x46, 0x4c,
+	     0x5b, 0xac, 0xb1, 0x41, 0x38, 0xe9, 0x75, 0xd1, 0x28, 0x94,
+	     0x1d, 0xde, 0xe1, 0x30, 0x20, 0x87, 0xa7, 0xa3, 0x0f, 0x21,
+	     0x2c, 0x68, 0x64, 0x17, 0x21, 0x47, 0xfa, 0x36, 0x19, 0x24,
+	     0x2c, 0x18, 0x88, 0x0b, 0xb2, 0xe8, 0x7e, 0x98, 0x43, 0x21,
+	     0x59, 0x34, 0x95, 0x4a, 0x76, 0x12, 0xac, 0x46, 0x8c, 0x86,
+	     0xe3, 0x4c, 0xa8, 0x5a, 0x79, 0x68, 0x98, 0x52, 0x8a, 0x20,
+	     0x18, 0xa0, 0x43, 0x0b, 0xf0, 0xaa, 0x5d, 0x05, 0xdd, 0xfa,
+	     0x64, 0xe2, 0xbf, 0x36, 0x22, 0x1a, 0xba, 0x14, 0xcb, 0x1f,
+	     0x20, 0x1e, 0xf8, 0x69, 0x29, 0x67, 0x20, 0xfa, 0x32, 0x37,
+	     0xc8, 0x9f, 0xa9, 0x23, 0x10, 0x29, 0x94, 0xa3, 0x85, 0xb3,
+	     0x45, 0x1d, 0xf9, 0xfa, 0x2d, 0x39, 0x80, 0x5e, 0x06, 0x09,
+	     0x2d, 0x91, 0x73, 0x11, 0x2a, 0x0c, 0x01, 0x83, 0x28, 0x82,
+	     0x24, 0x0d, 0x73, 0x63, 0x38, 0xce, 0x28, 0x04, 0x99, 0x80,
+	     0x13, 0xc2, 0x75, 0x64, 0x93, 0x06, 0x96, 0x69, 0xa1, 0xc0,
+	     0xd0, 0x17, 0x78, 0x0f, 0x93, 0x6d, 0x4d, 0x61, 0xe8, 0x4f,
+	     0x67, 0x23, 0x32, 0x0b, 0xcd, 0xa6, 0x16, 0x35, 0x55, 0x5a,
+	     0xcb, 0x65, 0x38, 0x3e, 0x93, 0x0e, 0xb4, 0x6f, 0x0d, 0x6c,
+	     0xc5, 0x62, 0x28, 0x69, 0x3b, 0x6b, 0xd9, 0x82, 0x10, 0x88,
+	     0x65, 0x29, 0x34, 0x48, 0xba, 0x12, 0x2e, 0x93, 0xf1, 0xb1,
+	     0x35, 0xda, 0xbb, 0x94, 0x90, 0x46, 0x9b, 0x45, 0xcc, 0x72,
+	     0xa4, 0x65, 0xf1, 0xb6, 0xe9, 0x4f, 0x10, 0x19, 0x17, 0x6f,
+	     0x2e, 0x0c, 0x2b, 0x65, 0x5a, 0x80, 0x52, 0xa4, 0xa8, 0x3a,
+	     0xdc, 0x40, 0x4b, 0x8c, 0x9b, 0xc3, 0x4b, 0x43, 0x9e, 0x5b,
+	     0xaf, 0x4d, 0xf6, 0x77, 0x9b, 0xff, 0xd5, 0x10, 0x3f, 0x4e,
+	     0xd4, 0x3c, 0xea, 0x4d, 0xc5, 0xe6, 0x9e, 0xa2, 0xba, 0xbb,
+	     0x45, 0xda, 0xe3, 0x44, 0x0e, 0xf8, 0x37, 0x09, 0xde, 0x62,
+	     0x0e, 0x04, 0xc3, 0x8a, 0xe1, 0x4b, 0x19, 0xdc, 0x28, 0x32,
+	     0x56, 0xb6, 0xd8, 0x5a, 0x6a, 0x0e, 0xbd, 0x03, 0x12, 0x50,
+	     0xb6, 0xd4, 0xaa, 0xc6, 0x4d, 0x4a, 0x38, 0x3e, 0x98, 0x17,
+	     0xe0, 0x46, 0xb3, 0xb9, 0xac, 0x3a, 0xb6, 0x6d, 0xfa, 0x6a,
+	     0x62, 0x1e, 0x9a, 0x04, 0xd0, 0x91, 0xc3, 0x66, 0x6a, 0xe3,
+	     0x71, 0x68, 0xf4, 0x56, 0x35, 0x21, 0x90, 0x95, 0x1c, 0x0e,
+	     0x60, 0x62, 0x50, 0xd4, 0x49, 0xf3, 0xf4, 0x26, 0x40, 0x20,
+	     0x82, 0x21, 0xff, 0x9e, 0x82, 0xcb, 0xa6, 0x63, 0x74, 0xfc,
+	     0xbc, 0x80, 0xc6, 0x86, 0x57, 0x2a, 0x0a, 0x5c, 0xd6, 0x22,
+	     0x61, 0x6e, 0x75, 0xc5, 0x13, 0x2b, 0x45, 0x28, 0x5b, 0x3e,
+	     0xc0, 0xaa, 0x78, 0xd5, 0xb4, 0x0b, 0x40, 0xe6, 0xbe, 0x14,
+	     0x59, 0x90, 0x36, 0xc0, 0x95, 0xb7, 0x46, 0x5f, 0x63, 0x05,
+	     0x6d, 0xce, 0x31, 0x1e, 0x58, 0xe9, 0x60, 0xb8, 0xae, 0x80,
+	     0xf6, 0x3d, 0xc0, 0xc0, 0xd6, 0x0d, 0x3f, 0x34, 0x07, 0xba,
+	     0x03, 0x36, 0x1e, 0x3e, 0x7a, 0xa6, 0xb9, 0x90, 0x4a, 0x86,
+	     0x60, 0x09, 0x33, 0x0f, 0xfb, 0x2d, 0xc6, 0xaf, 0x7a, 0x02,
+	     0x53, 0x97, 0xe4, 0x53, 0x51, 0xcf, 0xa1, 0xd3, 0xff, 0x4a,
+	     0x03, 0x68, 0x94, 0x7c, 0x76, 0x83, 0x97, 0x0c, 0x4e, 0x9d,
+	     0xce, 0x1f, 0xd5, 0x8e, 0x41, 0x86, 0xf1, 0x8e, 0x26, 0x3f,
+	     0x1a, 0x24, 0x0b, 0x5f, 0x25, 0x89, 0xe0, 0x90, 0x81, 0xfa,
+	     0x3f, 0x95, 0xef, 0xbe, 0x41, 0xae, 0x4c, 0x67, 0xa0, 0x07,
+	     0xe2, 0x1f, 0x78, 0x0b, 0x70, 0x5a, 0xa2, 0x46, 0x86, 0x1a,
+	     0xd3, 0x47, 0x94, 0x1a, 0x56, 0x02, 0x4a, 0x34, 0x54, 0x62,
+	     0x2d, 0x6e, 0x53, 0xcc, 0x69, 0xd5, 0x94, 0x42, 0x13, 0x9c,
+	     0x6e, 0xcb, 0x93, 0x96, 0xa4, 0x59, 0x41, 0xff, 0x4c, 0x66,
+	     0xfe, 0x4a, 0x15, 0x96, 0xba, 0x6c, 0x92, 0x54, 0x97, 0x94,
+	     0x4b, 0x45, 0x84, 0xf4, 0x67, 0xed, 0x97, 0xc0, 0x4b, 0xf4,
+	     0x2f, 0x2c, 0xb3, 0x07, 0x52, 0x51, 0x52, 0x67, 0xf6, 0x59,
+	     0xec, 0x16, 0x79, 0x47, 0xf4, 0x22, 0xc4, 0xa0, 0x8c, 0x91,
+	     0xdf, 0xb8, 0x05, 0xb3, 0x19, 0x0c, 0x98, 0xff, 0x99, 0xe0,
+	     0x32, 0x54, 0xb5, 0xae, 0xe4, 0x6f, 0x52, 0xbc, 0x56, 0x88,
+	     0x1a, 0x96, 0x9d, 0x60, 0x41, 0xc8, 0x66, 0x86, 0x3a, 0x92,
+	     0x13, 0xa2, 0x1b, 0x75, 0x08, 0xeb, 0x40, 0xe7, 0xe3, 0xcd,
+	     0x09, 0xf8, 0xd6, 0xff, 0x49, 0x1a, 0x78, 0x65, 0x5c, 0x4c,
+	     0x17, 0x22, 0xc2, 0x94, 0xe9, 0x41, 0x5f, 0xb1, 0x57, 0x24,
+	     0xf6, 0xfc, 0xd3, 0x9e, 0x03, 0x87, 0x98, 0x0a, 0xe0, 0x1f,
+	     0x46, 0xd4, 0x52, 0x4c, 0x4a, 0xfa, 0x1c, 0x5b, 0xb4, 0x80,
+	     0x8d, 0xca, 0xf0, 0x19, 0x89, 0xc5, 0xc0, 0x36, 0x23, 0xb3,
+	     0x1f, 0x22, 0x43, 0xfc, 0x63, 0x3b, 0x02, 0x83, 0x54, 0x38,
+	     0x22, 0x6e, 0x02, 0x26, 0xf9, 0x1b, 0xec, 0x2a, 0xc4, 0x6f,
+	     0x3b, 0x0f, 0xda, 0x16, 0x6e, 0x2d, 0x82, 0x33, 0xae, 0xa4,
+	     0x25, 0x7e, 0x2f, 0x95, 0x9b, 0x33, 0x18, 0xc1, 0x9b, 0x66,
+	     0x4c, 0x8e, 0xa8, 0x7f, 0x51, 0x66, 0xb0, 0x1a, 0x8a, 0x90,
+	     0x1d, 0xb7, 0xf7, 0xd6, 0xe5, 0x48, 0xde, 0xe0, 0x9f, 0x1c,
+	     0x91, 0x04, 0x0f, 0x0e, 0x02, 0xc2, 0xc8, 0x4c, 0xde, 0x1b,
+	     0xa7, 0xb9, 0xd7, 0xef, 0x4b, 0xec, 0x7c, 0x04, 0xfe, 0x0a,
+	     0xec, 0xa3, 0xc4, 0x16, 0xd4, 0xa3, 0x3c, 0x40, 0xa5, 0x21,
+	     0x99, 0x5d, 0xa3, 0x58, 0x27, 0xf4, 0x91, 0xd2, 0x19, 0xea,
+	     0x8f, 0xdc, 0x70, 0x51, 0xc4, 0xa6, 0xac, 0x4d, 0x10, 0x02,
+	     0x6d, 0x46, 0x22, 0x96, 0x89, 0x31, 0xf0, 0x16, 0x23, 0xc9,
+	     0x5c, 0x2d, 0x11, 0x9a, 0x88, 0x5a, 0x15, 0xbb, 0x0b, 0xca,
+	     0xd2, 0x98, 0x74, 0xc3, 0x40, 0xbf, 0xa9, 0xa6, 0xd0, 0x6e,
+	     0x37, 0x3c, 0xe8, 0x45, 0xfb, 0x89, 0xbd, 0x38, 0xe3, 0xf0,
+	     0x84, 0x90, 0x2b, 0xf4, 0x08, 0xd4, 0x8f, 0x95, 0xd9, 0xf0,
+	     0x0d, 0x0e, 0x33, 0x7e, 0xc3, 0x6a, 0x86, 0x31, 0xf0, 0x7a,
+	     0x60, 0xb5, 0x5c, 0xe0, 0xa5, 0x4e, 0x99, 0xa9, 0xce, 0x6a,
+	     0x95, 0x85, 0x3f, 0x12, 0x84, 0x1c, 0xc4, 0x19, 0x98, 0x61,
+	     0xb3, 0xec, 0x13, 0x5a, 0x31, 0xc5, 0x65, 0x28, 0xf9, 0x62,
+	     0xde, 0xbe, 0x06, 0x1f, 0x22, 0x52, 0x80, 0xa6, 0xd6, 0x09,
+	     0xbf, 0xf0, 0x67, 0x20, 0x2d, 0xed, 0xc4, 0xcd, 0x0d, 0xdb,
+	     0xa5, 0x76, 0x93, 0x3e, 0x2b, 0xfa, 0x09, 0x17, 0xd2, 0x7e,
+	     0x9a, 0x44, 0x9b, 0x9b, 0xea, 0x02, 0xbe, 0xd7, 0xba, 0x70,
+	     0x50, 0xc0, 0xc6, 0xba, 0x5f, 0x74, 0xb8, 0xd8, 0x03, 0x0a,
+	     0x8d, 0xfa, 0x57, 0x39, 0x64, 0x30, 0xc5, 0x15, 0x0c, 0x3d,
+	     0x7a, 0x07, 0xa3, 0x85, 0x29, 0x67, 0x1c, 0x61, 0x36, 0x29,
+	     0xa5, 0x0d, 0x11, 0x8d, 0x05, 0xc1, 0xcd, 0x89, 0x80, 0x3d,
+	     0x32, 0x65, 0x69, 0xff, 0x70, 0x33, 0x7c, 0x95, 0xe4, 0x67,
+	     0xf2, 0x15, 0x7c, 0x20, 0xe0, 0xaa, 0x95, 0xe1, 0x47, 0xb2,
+	     0xc9, 0x14, 0xa5, 0x1c, 0x21, 0x17, 0xbc, 0xff, 0x95, 0x22,
+	     0x93, 0x6c, 0x69, 0xa8, 0x03, 0x4e, 0x64, 0xe2, 0xfc, 0x5b,
+	     0x83, 0xaa, 0xff, 0xd4, 0xaa, 0x0e, 0x4a, 0xd1, 0xb3, 0xd8,
+	     0xe2, 0x69, 0x03, 0x9b, 0x43, 0x1b, 0xb7, 0x01, 0x5c, 0x7e,
+	     0x0c, 0xc1, 0x72, 0x7b, 0x30, 0x4e, 0x6e, 0x7a, 0xce, 0x78,
+	     0x03, 0xbb, 0x20, 0x64, 0x99, 0xd0, 0x73, 0x98, 0x61, 0x28,
+	     0xbf, 0x0d, 0x61, 0xa0, 0x99, 0x2a, 0x30, 0x95, 0xe5, 0x9b,
+	     0x91, 0xc0, 0x48, 0xe2, 0x71, 0x8e, 0x14, 0xc8, 0xe2, 0x00,
+	     0x96, 0x1b, 0xfd, 0xcd, 0x2d, 0x43, 0xaf, 0x43, 0x4f, 0x8c,
+	     0x35, 0x51, 0xac, 0xb4, 0x3b, 0xde, 0x3a, 0xd4, 0x5c, 0xab,
+	     0x0e, 0xfc, 0x91, 0x21, 0x14, 0x56, 0xb9, 0x0d, 0x47, 0x06,
+	     0xfc, 0x11, 0x22, 0x5b, 0xd7, 0xc8, 0xcb, 0xd1, 0x56, 0xb2,
+	     0x3e, 0x3e, 0x92, 0x66, 0x4b, 0x53, 0x88, 0xb2, 0x24, 0x0e,
+	     0xca, 0x9c, 0x21, 0x14, 0xbc, 0xe8, 0xc9, 0x84, 0x68, 0x3b,
+	     0xf3, 0xa4, 0x4d, 0x05, 0x76, 0x0c, 0xd2, 0x04, 0x84, 0x23,
+	     0x02, 0x7d, 0x2c, 0x73, 0x2e, 0xb6, 0x1e, 0xa5, 0x18, 0x1d,
+	     0x8d, 0x62, 0xb6, 0x98, 0xb8, 0x2e, 0x9c, 0x35, 0x7e, 0x5c,
+	     0xc7, 0x38, 0xe9, 0x0e, 0x6b, 0x33, 0x38, 0xb3, 0x54, 0x99,
+	     0x2f, 0x22, 0x7a, 0x68, 0x88, 0xaf, 0x2a, 0x32, 0xdd, 0x7e,
+	     0x0c, 0xfc, 0x17, 0x6a, 0x2a, 0x9d, 0x78, 0x21, 0x1d, 0x50,
+	     0xce, 0x88, 0x8d, 0xdf, 0x5e, 0x48, 0x9c, 0x76, 0x67, 0x5a,
+	     0xa6, 0x54, 0x62, 0xa6, 0x27, 0x3f, 0x31, 0x63, 0xe2, 0x70,
+	     0x2b, 0x36, 0x65, 0x17, 0xea, 0x34, 0xba, 0xf6, 0x8c, 0x7c,
+	     0xc6, 0x97, 0xf7, 0x44, 0x60, 0x2a, 0x3e, 0x02, 0x23, 0xb2,
+	     0x7a, 0xbc, 0x57, 0x90, 0x97, 0x74, 0x29, 0x69, 0x0d, 0x3f,
+	     0x31, 0x79, 0xe3, 0xd6, 0xc4, 0xbd, 0xc0, 0xdd, 0x04, 0x32,
+	     0x28, 0x94, 0xb7, 0x0c, 0x54, 0xe7, 0x85, 0xe7, 0xf8, 0x71,
+	     0x60, 0xd0, 0x09, 0xab, 0x20, 0x73, 0x96, 0x33, 0xc9, 0xcc,
+	     0xc3, 0xf9, 0x34, 0xfb, 0x03, 0x8f, 0x04, 0x0e, 0xd7, 0x8c,
+	     0x56, 0xa1, 0x16, 0x92, 0xd4, 0x90, 0x89, 0xb2, 0x40, 0x1a,
+	     0x20, 0x11, 0x7c, 0x1a, 0x0d, 0x3c, 0x40, 0x1a, 0xc2, 0x63,
+	     0x20, 0xde, 0x88, 0xdf, 0xea, 0x41, 0xec, 0xfe, 0xb4, 0x09,
+	     0x5a, 0xb6, 0x47, 0xc6, 0xf9, 0x30, 0xf8, 0x07, 0x70, 0x10,
+	     0x54, 0xe6, 0x3b, 0x30, 0x45, 0x4c, 0x18, 0xdf, 0xdb, 0x4b,
+	     0xac, 0xe1, 0x64, 0x57, 0x89, 0xd0, 0x65, 0x19, 0x77, 0x8b,
+	     0xaf, 0x34, 0x6d, 0xe6, 0x8a, 0xa4, 0x0b, 0x56, 0x1d, 0xe9,
+	     0x22, 0xe0, 0x02, 0x97, 0x3c, 0xcd, 0x8b, 0x9d, 0x82, 0xb0,
+	     0xe0, 0x44, 0x95, 0x09, 0x44, 0xa0, 0x14, 0xbc, 0x4e, 0x49,
+	     0x17, 0x05, 0x62, 0xc0, 0xe5, 0x84, 0x56, 0x24, 0xcf, 0xc8,
+	     0x39, 0x64, 0xb4, 0x26, 0x9c, 0xc0, 0x8b, 0xe9, 0x0f, 0x48,
+	     0x2c, 0x4e, 0x25, 0x3c, 0x1c, 0x33, 0x81, 0x99, 0xec, 0x14,
+	     0x72, 0x3f, 0x6d, 0x49, 0xcd, 0x91, 0xad, 0xe8, 0x66, 0x34,
+	     0x04, 0x1d, 0x17, 0xfe, 0x4a, 0x2c, 0x39, 0x1b, 0xd9, 0xbe,
+	     0x89, 0xa9, 0x11, 0x89, 0x52, 0xa4, 0xb4, 0x65, 0x12, 0x0b,
+	     0x7c, 0x43, 0x70, 0x05, 0x77, 0x60, 0x24, 0x20, 0x9e, 0x40,
+	     0x84, 0xe5, 0x12, 0xcf, 0x6c, 0x91, 0x0d, 0x42, 0x41, 0x4e,
+	     0x2a, 0xec, 0x97, 0xbd, 0xd3, 0x95, 0x64, 0x23, 0xc9, 0x0c,
+	     0x18, 0x0a, 0x39, 0xda, 0x3f, 0x71, 0x76, 0xb2, 0x70, 0x8a,
+	     0x71, 0xa1, 0xa6, 0x8e, 0x18, 0x2e, 0x34, 0x9a, 0x9e, 0x55,
+	     0x6f, 0x6b, 0x96, 0xe9, 0x01, 0x64, 0x24, 0x57, 0x16, 0x79,
+	     0xd1, 0x2d, 0x70, 0x15, 0x4e, 0xc0, 0x48, 0x79, 0x1e, 0x74,
+	     0x6f, 0x78, 0xa6, 0x36, 0x45, 0x2e, 0x18, 0x14, 0x0c, 0xaf,
+	     0xe2, 0x75, 0x88, 0x3b, 0xe4, 0x3d, 0xd1, 0x0e, 0x76, 0x70,
+	     0xf3, 0x99, 0x19, 0x8b, 0x8c, 0xc9, 0x59, 0xb6, 0x6d, 0xb9,
+	     0x0e, 0xc4, 0x21, 0xfa, 0x4e, 0xf7, 0x2f, 0x8d, 0x8a, 0x9d,
+	     0x8a, 0x8f, 0x63, 0xb3, 0x61, 0x13, 0xe4, 0xb2, 0xf4, 0x18,
+	     0x1f, 0x83, 0xdf, 0xd8, 0xec, 0x09, 0x8c, 0xf2, 0x08, 0x64,
+	     0xf0, 0x58, 0x39, 0x64, 0x7b, 0xf4, 0xab, 0xf3, 0x0f, 0x09,
+	     0x6c, 0x7e, 0x28, 0xe0, 0x9a, 0x2b, 0x8a, 0x02, 0xeb, 0x90,
+	     0xf2, 0xa1, 0xd2, 0xca, 0x83, 0x0e, 0x72, 0x17, 0x24, 0x8b,
+	     0xee, 0x89, 0x2f, 0x8d, 0x1a, 0x73, 0x0c, 0x7c, 0x0a, 0xda,
+	     0x08, 0x6a, 0x51, 0x8e, 0x1a, 0x6c, 0x96, 0x64, 0x14, 0x62,
+	     0x2e, 0x1d, 0x33, 0x13, 0x50, 0x06, 0x4c, 0x05, 0xcc, 0xe0,
+	     0xdd, 0xe1, 0xd8, 0xee, 0x4e, 0x8c, 0x3a, 0x0a, 0x0b, 0x87,
+	     0x69, 0xe5, 0x48, 0xb7, 0x72, 0xcf, 0xc4, 0x09, 0x9d, 0x04,
+	     0x03, 0x4e, 0x98, 0x8d, 0xa3, 0x51, 0xc8, 0x65, 0x9f, 0xb2,
+	     0x20, 0xd6, 0xc5, 0xb4, 0x91, 0x8c, 0xab, 0x84, 0xd6, 0x98,
+	     0x6a, 0x80, 0xa7, 0x6e, 0x28, 0xc5, 0x1c, 0x7a, 0x04, 0x5f,
+	     0xd2, 0x47, 0xf4, 0x02, 0x9c, 0x42, 0x6d, 0xa1, 0x10, 0xd8,
+	     0x23, 0xa2, 0x0e, 0x6d, 0x0f, 0x07, 0xb7, 0x3c, 0xc9, 0x2f,
+	     0x2a, 0x92, 0x50, 0x1b, 0x7b, 0x4d, 0xfa, 0xab, 0x0c, 0x66,
+	     0xea, 0x31, 0xc7, 0x8d, 0x78, 0xc0, 0x21, 0xb8, 0x1b, 0xc4,
+	     0x58, 0xac, 0xd3, 0x84, 0x6a, 0xa2, 0x47, 0x29, 0x07, 0xcf,
+	     0xc3, 0x0c, 0x29, 0xd1, 0x89, 0xb3, 0xac, 0xe0, 0xc4, 0x0c,
+	     0xe5, 0x3f, 0xcd, 0x11, 0x48, 0xb1, 0x41, 0x36, 0xc3, 0x53,
+	     0x1c, 0xf5, 0x15, 0x42, 0x7d, 0xea, 0xa0, 0x6f, 0x23, 0x07,
+	     0x6b, 0x9b, 0x23, 0x0b, 0x04, 0x5c, 0xde, 0x05, 0xbb, 0x83,
+	     0xbe, 0x20, 0x7a, 0x1c, 0xdf, 0xe3, 0xf6, 0xa5, 0x95, 0x11,
+	     0x6c, 0x96, 0x13, 0x09, 0x06, 0x70, 0x25, 0x0d, 0x54, 0xf6,
+	     0xd0, 0xea, 0x70, 0xcd, 0xb2, 0xcf, 0x78, 0x94, 0xfc, 0x98,
+	     0xc7, 0xc5, 0xa2, 0x95, 0xe9, 0x2d, 0x09, 0x19, 0x9d, 0xba,
+	     0x21, 0x35, 0xc6, 0x5c, 0x35, 0xd5, 0x93, 0xbc, 0xa3, 0x3a,
+	     0x8e, 0x2b, 0xa7, 0x40, 0xb2, 0xbe, 0x29, 0x74, 0x2e, 0x83,
+	     0x5c, 0x34, 0x7b, 0x1b, 0xa7, 0xe5, 0x98, 0xa2, 0x3f, 0x79,
+	     0x05, 0x91, 0x5c, 0x24, 0x35, 0x00, 0x46, 0xa0, 0x08, 0xba,
+	     0x06, 0xc8, 0xa2, 0x5e, 0x60, 0xff, 0xc9, 0x15, 0x11, 0x9b,
+	     0xeb, 0x30, 0x29, 0x55, 0xf6, 0xec, 0x18, 0x23, 0x0a, 0xfa,
+	     0x00, 0xc4, 0x3d, 0x80, 0x2b, 0x32, 0xbb, 0x3a, 0xc2, 0xe4,
+	     0xce, 0xbb, 0x45, 0xbb, 0x7a, 0x06, 0x0d, 0x05, 0x35, 0x76,
+	     0x5c, 0x80, 0xc8, 0x4b, 0x8f, 0xa5, 0xb0, 0x86, 0x2e, 0x70,
+	     0xfb, 0xdd, 0xef, 0xcc, 0x37, 0x0b, 0x12, 0xde, 0xa0, 0x0c,
+	     0x0e, 0x70, 0x58, 0xad, 0x6b, 0xd8, 0x50, 0xdf, 0xf0, 0x01,
+	     0xac, 0x9a, 0xf2, 0x43, 0x0c, 0xc0, 0x21, 0xf1, 0x33, 0x0c,
+	     0x9b, 0x24, 0xd8, 0x9c, 0x5b, 0x5d, 0xc9, 0x5a, 0x92, 0xe8,
+	     0xa1, 0xdf, 0x34, 0xcd, 0x8b, 0x6d, 0x7d, 0x90, 0x3e, 0x32,
+	     0x82, 0x43, 0x40, 0x90, 0xdc, 0x27, 0xeb, 0x07, 0xab, 0xec,
+	     0xa6, 0xd9, 0xcb, 0x82, 0x95, 0xe4, 0xc1, 0x88, 0xce, 0x08,
+	     0x86, 0x16, 0xe6, 0x90, 0x0c, 0x6b, 0x3a, 0xa7, 0xc2, 0x64,
+	     0xc5, 0x37, 0xd0, 0x17, 0xf0, 0x31, 0x34, 0x29, 0x0f, 0xe8,
+	     0xda, 0x9d, 0x27, 0xfc, 0x17, 0x18, 0x3c, 0x5e, 0x64, 0xa4,
+	     0xf2, 0x25, 0xd9, 0x4c, 0x62, 0xa4, 0x89, 0xe4, 0x74, 0x65,
+	     0x3d, 0x34, 0x74, 0xa0, 0x0d, 0x29, 0x3c, 0x09, 0x11, 0xa3,
+	     0x83, 0xe1, 0x2d, 0xd0, 0x91, 0xbd, 0xc8, 0x78, 0x96, 0x51,
+	     0xaa, 0x91, 0x83, 0xca, 0x54, 0x52, 0xcd, 0x25, 0xa1, 0x5f,
+	     0x2e, 0x81, 0x2a, 0x19, 0x6c, 0x0a, 0x23, 0xf9, 0x4a, 0x22,
+	     0x32, 0x74, 0x7b, 0x40, 0x76, 0x3f, 0xbc, 0x89, 0x5f, 0x0a,
+	     0xa7, 0x60, 0x18, 0xdf, 0x94, 0x36, 0x86, 0xac, 0x5e, 0x4e,
+	     0xfd, 0xb2, 0x82, 0x4d, 0x55, 0xc3, 0x2d, 0xb9, 0xef, 0x1b,
+	     0x64, 0x2a, 0x43, 0x3e, 0x47, 0xd4, 0x4a, 0xb2, 0x43, 0x86,
+	     0x62, 0x55, 0x90, 0x8f, 0x23, 0xea, 0x7d, 0x5c, 0x48, 0x89,
+	     0xba, 0x8a, 0x98, 0x0c, 0xb6, 0x6f, 0x5c, 0xf4, 0x2d, 0x9c,
+	     0x4a, 0x60, 0x05, 0xae, 0x8e, 0x9f, 0xca, 0xb3, 0x9c, 0x68,
+	     0x66, 0x22, 0x55, 0x7c, 0x2c, 0x46, 0x38, 0x2c, 0xa4, 0x03,
+	     0x27, 0x25, 0x64, 0x0d, 0x43, 0x0c, 0xa6, 0xb8, 0x54, 0x43,
+	     0x26, 0x85, 0xe4, 0xb4, 0x2d, 0xf3, 0x97, 0xaa, 0x1a, 0x3c,
+	     0x62, 0x0d, 0x26, 0x3a, 0x02, 0x69, 0x3d, 0x2b, 0x90, 0x6f,
+	     0x16, 0xac, 0x13, 0xe2, 0x98, 0x8d, 0x31, 0x50, 0x99, 0x32,
+	     0xa9, 0x3c, 0x16, 0x34, 0x0a, 0x61, 0x9a, 0x97, 0x0e, 0x31,
+	     0xeb, 0x7f, 0x87, 0x7a, 0xf8, 0xb0, 0x95, 0x97, 0xd4, 0x50,
+	     0x22, 0x41, 0x70, 0x1e, 0x2a, 0x60, 0x30, 0x06, 0xfb, 0xfb,
+	     0x3a, 0x0c, 0x77, 0x9a, 0x02, 0x48, 0x36, 0x12, 0x82, 0xc8,
+	     0xcc, 0x23, 0x96, 0xd3, 0x2a, 0x02, 0x0a, 0xdb, 0x72, 0x6d,
+	     0x57, 0x2b, 0x00, 0x1b, 0x28, 0xf1, 0x0b, 0xa6, 0x4a, 0xb4,
+	     0x66, 0x7d, 0xe1, 0xb4, 0x17, 0xa8, 0x28, 0x87, 0x4c, 0x6f,
+	     0x84, 0x00, 0x54, 0xae, 0x8c, 0x47, 0xd0, 0x85, 0xdc, 0x6f,
+	     0x59, 0xa4, 0xe8, 0xd2, 0xf5, 0x42, 0xc5, 0x05, 0xeb, 0xcb,
+	     0xc7, 0x40, 0xae, 0x60, 0x16, 0xca, 0x82, 0x2b, 0x19, 0xd3,
+	     0x20, 0x49, 0xf0, 0xdd, 0xb2, 0xda, 0x91, 0x3f, 0x4a, 0x03,
+	     0x65, 0xca, 0x63, 0x5f, 0x78, 0xeb, 0xb8, 0x63, 0xf2, 0x40,
+	     0x66, 0xca, 0x82, 0x22, 0x93, 0x67, 0x29, 0x1e, 0xe5, 0x95,
+	     0xb2, 0xc2, 0x40, 0x73, 0xe1, 0x63, 0x82, 0xa5, 0xda, 0x33,
+	     0x62, 0x1f, 0x3f, 0x9c, 0x20, 0x12, 0x31, 0x64, 0xae, 0x03,
+	     0xfc, 0xf1, 0x15, 0x43, 0x02, 0x59, 0x34, 0x07, 0xd0, 0x42,
+	     0x6f, 0x8e, 0xd8, 0x09, 0xa0, 0x2b, 0x5d, 0x9c, 0x5c, 0x8b,
+	     0x6d, 0x13, 0x07, 0x4c, 0xe4, 0xa0, 0x60, 0x24, 0xd0, 0x1a,
+	     0xef, 0x1c, 0x73, 0xd6, 0x31, 0x1d, 0x94, 0x83, 0x88, 0xfd,
+	     0xc5, 0x90, 0x32, 0x0b, 0xa1, 0xc1, 0x8c, 0xb0, 0x26, 0x44,
+	     0x38, 0x16, 0x0a, 0xa4, 0x37, 0xc6, 0x7b, 0x55, 0x41, 0xb9,
+	     0xf6, 0xcd, 0xe2, 0xa2, 0x20, 0xb0, 0xa4, 0x2d, 0x89, 0x25,
+	     0xed, 0x22, 0x07, 0x24, 0x12, 0x40, 0xda, 0xce, 0x78, 0x50,
+	     0x41, 0xb0, 0x3a, 0x89, 0x84, 0xc7, 0x7c, 0x65, 0x2d, 0x00,
+	     0xf9, 0x80, 0x92, 0x46, 0x6e, 0x3f, 0x0b, 0x1a, 0x44, 0x6e,
+	     0x80, 0x8a, 0x11, 0x97, 0xc2, 0x3b, 0x25, 0xd2, 0xa0, 0x21,
+	     0x4d, 0x24, 0x55, 0x01, 0x21, 0xa8, 0x27, 0x47, 0x7e, 0xe4,
+	     0x31, 0x00, 0x20, 0x51, 0x76, 0x7a, 0x26, 0x86, 0x09, 0x1c,
+	     0xe4, 0x28, 0xc4, 0x9e, 0x9a, 0xb4, 0xf0, 0xe2, 0xc6, 0x3a,
+	     0x9b, 0xc2, 0x12, 0x81, 0x7f, 0x6d, 0x30, 0x28, 0x91, 0x48,
+	     0x7a, 0xd9, 0x72, 0x44, 0x4f, 0x4d, 0xc8, 0xb2, 0x62, 0xce,
+	     0xe2, 0x38, 0x72, 0x11, 0xd0, 0x1c, 0xd6, 0x63, 0x48, 0x75,
+	     0x22, 0x32, 0x5c, 0x99, 0xb1, 0xf2, 0x50, 0x06, 0x4e, 0x29,
+	     0x8f, 0x08, 0xda, 0xb8, 0x5b, 0x9c, 0x45, 0xb0, 0x09, 0x60,
+	     0xf3, 0x7d, 0xb7, 0x88, 0x42, 0xff, 0xc1, 0xba, 0x74, 0x28,
+	     0x04, 0x1e, 0xcd, 0x13, 0x69, 0x6f, 0xa6, 0xe8, 0x01, 0xc3,
+	     0x82, 0xbc, 0x23, 0x5e, 0x38, 0xeb, 0x3b, 0xf3, 0x4a, 0x2f,
+	     0x0f, 0x34, 0x01, 0xb6, 0xba, 0x21, 0xb2, 0xab, 0x36, 0x2e,
+	     0xb6, 0x0d, 0xad, 0xe1, 0x87, 0x43, 0x36, 0x17, 0x0b, 0x28,
+	     0xe5, 0x74, 0x93, 0x0e, 0x39, 0xd0, 0xb9, 0x7e, 0xc3, 0xd5,
+	     0xa5, 0xe9, 0xc3, 0x10, 0xe8, 0x0d, 0xe9, 0x32, 0x77, 0x4d,
+	     0xc3, 0x85, 0x89, 0xcd, 0x42, 0xa8, 0x03, 0xf4, 0x34, 0x29,
+	     0x66, 0xe8, 0x2a, 0x85, 0x04, 0x0f, 0xa6, 0x45, 0xd9, 0xd8,
+	     0x81, 0xaf, 0xf4, 0x42, 0x50, 0x2d, 0x59, 0xca, 0x36, 0x1f,
+	     0xe5, 0x1c, 0x71, 0x0f, 0xce, 0x49, 0xd1, 0x38, 0xa8, 0x90,
+	     0xe9, 0x08, 0xfb, 0xee, 0x8c, 0x9a, 0x2c, 0x39, 0x8a, 0xb3,
+	     0xcd, 0xf2, 0xc8, 0x59, 0x01, 0x44, 0x0a, 0x2d, 0x1b, 0x3b,
+	     0x2d, 0x3f, 0x42, 0x24, 0xd2, 0x0b, 0x55, 0x46, 0x89, 0x9c,
+	     0xf1, 0xc4, 0x2b, 0x62, 0x3e, 0x7d, 0x19, 0x37, 0xc0, 0xd3,
+	     0xe7, 0xff, 0x95, 0x1d, 0x8a, 0xa6, 0x40, 0x15, 0x87, 0x3a,
+	     0x00, 0xc7, 0x85, 0x84, 0x56, 0xb1, 0x1e, 0xa1, 0xa1, 0xfa,
+	     0x39, 0x3c, 0x1c, 0x4f, 0x47, 0xed, 0x90, 0x6a, 0xc9, 0xe9,
+	     0xb0, 0x38, 0x04, 0x5d, 0x52, 0x3c, 0x26, 0x6e, 0x1e, 0x5b,
+	     0x17, 0x08, 0x44, 0x43, 0x4e, 0xb2, 0xae, 0x10, 0xa3, 0xd8,
+	     0x49, 0x48, 0x2e, 0xff, 0x21, 0xbf, 0x83, 0x02, 0xe7, 0xa8,
+	     0xa5, 0x22, 0x13, 0x95, 0x52, 0x48, 0x61, 0x0a, 0x1c, 0x77,
+	     0x5b, 0x28, 0x8b, 0xc7, 0x76, 0xf2, 0x51, 0x12, 0x28, 0x5c,
+	     0xff, 0x3c, 0x1d, 0x4b, 0x98, 0xf2, 0x84, 0xfb, 0x56, 0x1b,
+	     0x4b, 0x0c, 0x55, 0xfb, 0xf8, 0x14, 0xf1, 0x06, 0xd2, 0x61,
+	     0xa7, 0xbb, 0xfb, 0x0d, 0xc4, 0x6b, 0xc1, 0x90, 0x56, 0x54,
+	     0x19, 0x34, 0xf9, 0xca, 0x05, 0xd8, 0x02, 0x8b, 0x41, 0x41,
+	     0x44, 0x55, 0x47, 0xfd, 0xfa, 0x30, 0x44, 0xeb, 0x62, 0x1d,
+	     0x32, 0xb0, 0xb4, 0xcb, 0x1b, 0x86, 0x31, 0xf9, 0xe6, 0x79,
+	     0xf7, 0x94, 0x4d, 0x46, 0x63, 0xdc, 0x97, 0x84, 0x95, 0x95,
+	     0x22, 0xbc, 0x61, 0xda, 0x2a, 0x5e, 0x15, 0xcf, 0x1c, 0x3e,
+	     0xcb, 0x4c, 0x4a, 0xc7, 0x27, 0x41, 0x86, 0x05, 0x9d, 0xbc,
+	     0xf2, 0x29, 0x92, 0x1c, 0x86, 0x6b, 0x15, 0xb3, 0x5c, 0xbd,
+	     0xf1, 0x00, 0x04, 0xbd, 0x1b, 0x36, 0xae, 0x72, 0xfe, 0x34,
+	     0xc1, 0x92, 0x06, 0x81, 0xef, 0xab, 0xd5, 0x47, 0x96, 0xf2,
+	     0xac, 0x94, 0x10, 0x07, 0x0e, 0xaf, 0xb8, 0x95, 0x06, 0xc4,
+	     0x07, 0x55, 0xd4, 0x38, 0xb1, 0xd2, 0x2c, 0xdc, 0x8c, 0x66,
+	     0xd1, 0x91, 0x6c, 0xe3, 0x8f, 0x29, 0x78, 0x32, 0xe1, 0xf8,
+	     0xb5, 0x65, 0xab, 0xec, 0x69, 0x95, 0xaf, 0xdf, 0xde, 0x4b,
+	     0x30, 0x22, 0x28, 0x55, 0xa0, 0x39, 0x60, 0xe9, 0xce, 0x86,
+	     0x72, 0x43, 0x6e, 0x9c, 0xac, 0xd0, 0x04, 0xa5, 0xdf, 0x09,
+	     0x6a, 0x5e, 0x63, 0x00, 0x4a, 0x67, 0x4a, 0x3c, 0xc2, 0xd7,
+	     0x2e, 0xda, 0x72, 0x20, 0x11, 0x77, 0xf1, 0x23, 0x10, 0x57,
+	     0x22, 0x97, 0xf4, 0xcb, 0x81, 0xc3, 0x2b, 0x48, 0x17, 0x54,
+	     0x27, 0x6e, 0x12, 0x16, 0x8c, 0xd6, 0x2f, 0x83, 0x82, 0xd4,
+	     0xc3, 0xef, 0x65, 0x63, 0xea, 0x54, 0xce, 0xee, 0xca, 0x88,
+	     0x3c, 0xb7, 0xd6, 0x0c, 0xdb, 0x23, 0x84, 0x92, 0x32, 0x98,
+	     0x27, 0xcc, 0x11, 0x82, 0x23, 0x50, 0x07, 0xeb, 0x1e, 0x6f,
+	     0x42, 0xe8, 0xe1, 0xa0, 0xeb, 0x7c, 0x11, 0x3c, 0xf0, 0x0d,
+	     0xb2, 0x2a, 0xa1, 0xa1, 0xd4, 0xa4, 0xc6, 0x81, 0x88, 0x01,
+	     0xf1, 0xe9, 0x3e, 0xde, 0x1e, 0x9b, 0xca, 0x14, 0xe5, 0xe9,
+	     0xa0, 0x2a, 0x91, 0x82, 0xbc, 0x2c, 0x4c, 0x2a, 0x85, 0x23,
+	     0xe2, 0xbe, 0x54, 0x25, 0x24, 0xcf, 0x0c, 0xc4, 0xf9, 0xfa,
+	     0x70, 0x71, 0xc1, 0xf2, 0x37, 0x69, 0xa5, 0xb3, 0x8d, 0xa3,
+	     0xa7, 0x35, 0x25, 0xa1, 0x3c, 0x38, 0x45, 0x59, 0x02, 0x5a,
+	     0x48, 0xc1, 0x4c, 0x25, 0x3b, 0x0a, 0xd6, 0x84, 0x7f, 0x69,
+	     0xb3, 0x39, 0x6b, 0x22, 0x45, 0xce, 0x96, 0xfa, 0x17, 0xd4,
+	     0xec, 0x63, 0xe2, 0x9f, 0x10, 0x3f, 0xf1, 0x7d, 0x98, 0x43,
+	     0xc5, 0x0a, 0x53, 0x62, 0x1e, 0xc4, 0xaa, 0xe1, 0x58, 0xe4,
+	     0x72, 0xb0, 0x01, 0x42, 0x2f, 0xcc, 0x99, 0x28, 0x9f, 0x0b,
+	     0xa5, 0x56, 0xb9, 0x2d, 0x50, 0x41, 0xa8, 0xcd, 0xa4, 0x2d,
+	     0xf1, 0x00, 0x02, 0x00, 0x28, 0xc1, 0xf7, 0xe3, 0x22, 0x38,
+	     0xbc, 0xf1, 0x39, 0x30, 0x1e, 0xad, 0x41, 0xbe, 0xc4, 0xee,
+	     0x03, 0xd4, 0x01, 0xe1, 0xc8, 0xa4, 0xe1, 0xfe, 0x7a, 0x86,
+	     0x95, 0xc4, 0x31, 0x58, 0xf5, 0x26, 0xc7, 0x11, 0x8b, 0xbb,
+	     0x0b, 0xed, 0x64, 0x30, 0x64, 0x7f, 0xb2, 0x72, 0xdd, 0x7d,
+	     0x21, 0x58, 0xc8, 0x8a, 0x24, 0xe9, 0x60, 0xb4, 0xc8, 0x95,
+	     0x0c, 0xc2, 0x84, 0x40, 0x5f, 0x29, 0x00, 0x01, 0x30, 0x8a,
+	     0x17, 0x6c, 0x47, 0xd0, 0x36, 0x6d, 0xa3, 0x0f, 0x85, 0x60,
+	     0xe6, 0x55, 0xa9, 0x77, 0xfb, 0x0e, 0x6a, 0x98, 0x10, 0x65,
+	     0x29, 0x37, 0x02, 0x84, 0x1d, 0xa5, 0x38, 0x32, 0x26, 0x7c,
+	     0x07, 0xe8, 0x30, 0x3c, 0x44, 0x7b, 0x19, 0x83, 0x48, 0x80,
+	     0x6f, 0xe6, 0x13, 0xd0, 0x78, 0xd7, 0xa1, 0x97, 0x3a, 0x96,
+	     0x0c, 0x30, 0x5d, 0x1b, 0x05, 0xa5, 0xf7, 0x33, 0x45, 0x6b,
+	     0xdc, 0xb8, 0x9e, 0xde, 0x14, 0xda, 0x91, 0x48, 0x83, 0x89,
+	     0x21, 0x84, 0xf6, 0x96, 0x20, 0x2d, 0x75, 0xab, 0x24, 0x83,
+	     0xf0, 0x9d, 0x57, 0x53, 0xf2, 0x01, 0x1c, 0x31, 0xfc, 0xaa,
+	     0x27, 0xfa, 0xb9, 0xf8, 0x21, 0x38, 0x4c, 0x6d, 0x83, 0x90,
+	     0x89, 0x86, 0xb6, 0x9f, 0xb8, 0x0e, 0x22, 0xe1, 0xc6, 0x7d,
+	     0x48, 0x42, 0x1a, 0xa3, 0x08, 0xcd, 0x8b, 0xb2, 0xd9, 0x23,
+	     0xc7, 0x0c, 0x81, 0x12, 0x3c, 0x8f, 0x20, 0xad, 0x8f, 0x21,
+	     0x64, 0x32, 0xb0, 0x18, 0x3b, 0xde, 0x61, 0xab, 0x7e, 0x97,
+	     0x07, 0x3b, 0x9e, 0xd4, 0xf3, 0x6a, 0x3a, 0xb1, 0xf5, 0x7a,
+	     0xe8, 0x70, 0xa3, 0x66, 0x96, 0x59, 0x07, 0x7d, 0x04, 0x15,
+	     0xf1, 0xb9, 0xf6, 0x1e, 0x62, 0x4b, 0xae, 0x17, 0xa5, 0x6c,
+	     0xc2, 0x0c, 0x02, 0x56, 0xca, 0xa9, 0x51, 0x53, 0x11, 0x5c,
+	     0xbf, 0xdc, 0xf6, 0x6c, 0x07, 0x07, 0x9f, 0x1d, 0x92, 0xfb,
+	     0xe8, 0x5b, 0x94, 0xc9, 0x54, 0xae, 0x35, 0x64, 0xbc, 0x84,
+	     0xd7, 0xa4, 0xd9, 0x64, 0x17, 0xe4, 0x42, 0x82, 0x4b, 0xc4,
+	     0x9f, 0x7d, 0x06, 0x3b, 0x22, 0x43, 0x95, 0x2f, 0xcf, 0x75,
+	     0x32, 0x20, 0x17, 0x5d, 0xe9, 0x3a, 0x25, 0xca, 0xb4, 0x6a,
+	     0xde, 0x30, 0xd0, 0x4b, 0x4e, 0x41, 0x14, 0xd9, 0x19, 0x80,
+	     0x0a, 0x26, 0x13, 0x00, 0x24, 0xb2, 0x8a, 0x1f, 0xe5, 0x54,
+	     0xcf, 0x16, 0x67, 0xb3, 0xc3, 0xef, 0x29, 0x24, 0xc7, 0x44,
+	     0x4a, 0x39, 0x6a, 0xdd, 0x49, 0x26, 0x68, 0xd6, 0x03, 0xb3,
+	     0x84, 0x21, 0x81, 0xdc, 0x02, 0x3a, 0x89, 0x62, 0x63, 0x5b,
+	     0x0d, 0x68, 0x98, 0xe4, 0x31, 0x65, 0x2c, 0x36, 0x91, 0x8b,
+	     0x5a, 0x3b, 0x34, 0x1d, 0xcd, 0xe0, 0x96, 0x33, 0xf1, 0x60,
+	     0x34, 0x61, 0x6e, 0x4c, 0x74, 0xfc, 0x28, 0x04, 0x02, 0x57,
+	     0x6a, 0x0d, 0x22, 0xbd, 0xa3, 0x44, 0x6d, 0x0b, 0xa7, 0x66,
+	     0x62, 0xb8, 0xc7, 0x24, 0x3a, 0xe8, 0xeb, 0xc4, 0xa9, 0x20,
+	     0xbd, 0x5c, 0x13, 0xb3, 0x4d, 0x3a, 0xba, 0x56, 0x45, 0x6e,
+	     0xc7, 0x20, 0xc1, 0xf3, 0xa9, 0xab, 0x6d, 0x86, 0xb4, 0x55,
+	     0x5b, 0x4c, 0x56, 0x94, 0x74, 0xa1, 0xb5, 0xa4, 0x15, 0x18,
+	     0xfb, 0x6c, 0xcf, 0x06, 0x3d, 0xae, 0x85, 0x7d, 0x45, 0x71,
+	     0x6e, 0x31, 0x80, 0x5c, 0x8b, 0x6a, 0x3d, 0x35, 0x1a, 0x2d,
+	     0x38, 0x98, 0x3b, 0x52, 0x5b, 0x81, 0x4e, 0xc2, 0x56, 0xa2,
+	     0xdf, 0x25, 0x0b, 0x5c, 0x6e, 0x60, 0xae, 0x52, 0xa0, 0xc9,
+	     0x09, 0x69, 0x83, 0x43, 0xf0, 0xa6, 0x5d, 0x2e, 0xbe, 0x6b,
+	     0xb3, 0xc0, 0x56, 0xd6, 0x39, 0xd1, 0x9a, 0x94, 0xf5, 0x19,
+	     0x04, 0xb9, 0x99, 0x56, 0x9a, 0x7b, 0x4b, 0x99, 0x9c, 0x35,
+	     0x90, 0xb0, 0x15, 0xda, 0xfb, 0x39, 0x09, 0xaf, 0x8a, 0x51,
+	     0x76, 0x12, 0x62, 0xa5, 0xe1, 0xea, 0xb6, 0x06, 0xd3, 0x40,
+	     0xea, 0x48, 0x94, 0xea, 0x95, 0xaa, 0x13, 0x7d, 0x53, 0x0a,
+	     0x13, 0x88, 0x76, 0xf2, 0x40, 0x0e, 0x7a, 0x48, 0xfa, 0x94,
+	     0xf1, 0x16, 0xe1, 0x11, 0x32, 0xf2, 0x6e, 0x11, 0xd7, 0xb8,
+	     0xec, 0x71, 0xf4, 0x80, 0x5f, 0x18, 0x81, 0xda, 0x53, 0xb4,
+	     0xec, 0x0c, 0xa0, 0x38, 0x50, 0x83, 0xd8, 0xde, 0x86, 0x95,
+	     0x9f, 0x26, 0x07, 0x21, 0x8b, 0x2e, 0xf6, 0x93, 0xe2, 0x8b,
+	     0x79, 0xec, 0xd8, 0x4c, 0x75, 0xcb, 0xa3, 0x9e, 0xa0, 0x9b,
+	     0x08, 0x02, 0x23, 0xaf, 0x11, 0x10, 0xd8, 0x1f, 0x25, 0x84,
+	     0xdf, 0x3f, 0xb5, 0x4f, 0x45, 0x87, 0x4c, 0x31, 0xc6, 0xd3,
+	     0xee, 0x35, 0x9a, 0x42, 0x3f, 0x6b, 0x11, 0x50, 0x1b, 0x47,
+	     0x23, 0xc7, 0x53, 0x59, 0x74, 0x64, 0x7d, 0x34, 0xe6, 0x74,
+	     0x5f, 0x03, 0xf2, 0xde, 0xfe, 0x24, 0xda, 0xb5, 0xf6, 0xfb,
+	     0x1f, 0xd4, 0x37, 0x53, 0x83, 0x59, 0xa3, 0x9c, 0x08, 0xcb,
+	     0xa3, 0x29, 0xd2, 0x97, 0x9a, 0x07, 0x88, 0x4f, 0xac, 0x0f,
+	     0xbd, 0x24, 0xf5, 0xa3, 0xea, 0x48, 0x02, 0xc0, 0xb3, 0x7a,
+	     0xb6, 0x3d, 0xd3, 0x0c, 0x4b, 0xef, 0xa3, 0xb1, 0x90, 0x0e,
+	     0x31, 0x38, 0x86, 0x90, 0xa0, 0xa9, 0x5c, 0x21, 0x60, 0x45,
+	     0x01, 0xce, 0x62, 0xd1, 0xc2, 0x6c, 0x03, 0x72, 0xa0, 0x3a,
+	     0x36, 0xad, 0x2e, 0xf6, 0x08, 0x12, 0x24, 0x1b, 0x86, 0x24,
+	     0x88, 0x90, 0xd5, 0x76, 0xba, 0x2b, 0x46, 0xcd, 0x40, 0x37,
+	     0xba, 0x40, 0x8e, 0x57, 0xa6, 0x64, 0x2e, 0x52, 0x94, 0xb3,
+	     0xa5, 0xa8, 0x4c, 0x04, 0x80, 0x14, 0xc9, 0xc6, 0x07, 0x62,
+	     0x21, 0xb2, 0x63, 0xbf, 0x91, 0xd0, 0x2c, 0x92, 0xf4, 0x01,
+	     0xf2, 0xa2, 0x0d, 0x5c, 0x37, 0xe0, 0xca, 0x06, 0x73, 0x33,
+	     0xee, 0x98, 0xfb, 0x56, 0x5c, 0xb0, 0x2c, 0x57, 0x18, 0x61,
+	     0x27, 0x6a, 0xf1, 0x95, 0x11, 0x8f, 0xfd, 0x73, 0xbe, 0x4b,
+	     0x21, 0x8f, 0xf8, 0x4d, 0x60, 0x8d, 0x05, 0xb8, 0x01, 0x60,
+	     0x17, 0x8c, 0x4d, 0x92, 0x8a, 0xf3, 0x08, 0x71, 0x93, 0xf7,
+	     0x72, 0x93, 0x51, 0x92, 0x4a, 0xfc, 0xf4, 0x63, 0x2e, 0x97,
+	     0x5c, 0x44, 0x3c, 0xa3, 0x0b, 0xeb, 0x10, 0xe2, 0x74, 0x71,
+	     0xc7, 0xa4, 0x24, 0xda, 0x4b, 0x5f, 0x81, 0xbc, 0x8e, 0x59,
+	     0x6b, 0xfa, 0x76, 0x71, 0x98, 0x7a, 0xf1, 0xfb, 0x12, 0x76,
+	     0x37, 0x30, 0xc6, 0x9e, 0xeb, 0x65, 0xbe, 0xc5, 0x07, 0x11,
+	     0x48, 0x1c, 0x5f, 0x6c, 0x06, 0xf1, 0x9d, 0x64, 0x9f, 0x83,
+	     0xc4, 0x0d, 0xf3, 0x2a, 0xfb, 0x48, 0x2d, 0x00, 0x2c, 0x23,
+	     0xa0, 0x06, 0x6f, 0xa4, 0xa7, 0x82, 0x65, 0x03, 0x98, 0x22,
+	     0x89, 0x88, 0xd1, 0xe2, 0x91, 0x2f, 0x35, 0xef, 0x4b, 0x67,
+	     0x6e, 0xd8, 0x95, 0xb7, 0xca, 0x2c, 0x61, 0x29, 0x94, 0x3d,
+	     0xd0, 0x9b, 0x6e, 0x05, 0xcb, 0x0d, 0xb6, 0x21, 0xe1, 0xc4,
+	     0x15, 0xb0, 0x0a, 0xc8, 0x4a, 0x52, 0x1e, 0x0e, 0x89, 0x6e,
+	     0x6b, 0xf3, 0x67, 0xe4, 0x2a, 0x51, 0x56, 0xb2, 0xc8, 0x77,
+	     0x86, 0x29, 0x4f, 0x0f, 0xbb, 0x64, 0xbf, 0x23, 0xc5, 0x61,
+	     0xbd, 0x04, 0x0d, 0x53, 0x9a, 0x1c, 0x34, 0x87, 0xc8, 0x29,
+	     0xd3, 0x79, 0xe1, 0x64, 0x12, 0xd0, 0x70, 0x0b, 0x60, 0x4e,
+	     0x4d, 0xb6, 0x0c, 0x9e, 0x9f, 0x81, 0xef, 0xb6, 0xb5, 0x43,
+	     0x3c, 0x86, 0x9f, 0x22, 0x8c, 0x93, 0x3f, 0x6c, 0x10, 0x7e,
+	     0xee, 0x8b, 0x07, 0xeb, 0x01, 0x03, 0x92, 0xab, 0xdc, 0x8b,
+	     0x28, 0xaa, 0x37, 0xcb, 0xf4, 0x28, 0x46, 0xa6, 0x33, 0xf4,
+	     0x5b, 0x1c, 0x14, 0x42, 0x2c, 0xb6, 0x2c, 0xa2, 0xa5, 0x63,
+	     0xc6, 0xd5, 0x37, 0xb5, 0x04, 0xa6, 0x91, 0x7b, 0xc8, 0x90,
+	     0x42, 0xb0, 0x89, 0x42, 0x37, 0xab, 0xe3, 0x08, 0xaf, 0x21,
+	     0x72, 0x84, 0x37, 0x87, 0x28, 0x7b, 0x03, 0xad, 0x07, 0x05,
+	     0x80, 0xdc, 0x28, 0x5c, 0x83, 0x58, 0x89, 0x2d, 0x49, 0x73,
+	     0x9b, 0xc5, 0xaa, 0xc7, 0x76, 0x6b, 0x48, 0x18, 0x28, 0x4b,
+	     0x4d, 0x12, 0x00, 0x7b, 0x98, 0xb7, 0xc5, 0xed, 0x82, 0x03,
+	     0xa7, 0xbd, 0xe6, 0x67, 0xf9, 0x57, 0xa4, 0x22, 0xfc, 0x8b,
+	     0x46, 0x9a, 0xbc, 0x48, 0x90, 0xed, 0x70, 0xf4, 0xad, 0xac,
+	     0x42, 0x25, 0x10, 0x0e, 0x8b, 0xd7, 0xad, 0x2e, 0xa6, 0x41,
+	     0xc8, 0x8f, 0x68, 0xe5, 0x12, 0x66, 0xc9, 0x2e, 0xa3, 0x5e,
+	     0x90, 0x37, 0xd8, 0x57, 0x80, 0xc5, 0x51, 0x00, 0x32, 0x7c,
+	     0x27, 0x6d, 0xac, 0x1a, 0x82, 0xa7, 0x38, 0x90, 0x0e, 0xc9,
+	     0xd1, 0x1a, 0xe1, 0xbe, 0x7b, 0x3e, 0x52, 0xb6, 0x8a, 0x3c,
+	     0x13, 0x4a, 0x4f, 0x81, 0x97, 0x6d, 0x2a, 0x59, 0x4c, 0x89,
+	     0x23, 0x62, 0xf4, 0xda, 0x9b, 0x83, 0x06, 0xe7, 0xe1, 0x30,
+	     0x8c, 0xf6, 0x27, 0x89, 0xc0, 0xac, 0x85, 0x10, 0xdd, 0x7b,
+	     0xb8, 0xa0, 0xa4, 0x51, 0xea, 0x8c, 0xbd, 0x73, 0x1e, 0x2b,
+	     0xa9, 0x21, 0xea, 0xc0, 0x04, 0x3a, 0x9b, 0xef, 0x85, 0x70,
+	     0x27, 0xd4, 0x51, 0xc6, 0x7c, 0xa6, 0x44, 0x6b, 0xa8, 0x64,
+	     0x7a, 0x2c, 0x6b, 0x4d, 0x6c, 0xa6, 0x0f, 0xd0, 0x53, 0xe4,
+	     0x00, 0x31, 0xc7, 0xb2, 0x0c, 0x23, 0x48, 0x3e, 0x1c, 0x37,
+	     0x63, 0x86, 0x28, 0x7c, 0xe9, 0x26, 0x62, 0x04, 0x0f, 0x85,
+	     0x6d, 0xcd, 0x24, 0x98, 0x9c, 0x44, 0x0e, 0xc4, 0x55, 0x1b,
+	     0xdb, 0xdd, 0xcc, 0x2a, 0x38, 0x8c, 0x03, 0x23, 0x5b, 0xe4,
+	     0xd2, 0x61, 0x40, 0x85, 0xa8, 0x49, 0xca, 0x31, 0x08, 0x33,
+	     0xaf, 0x0a, 0x3a, 0x54, 0x93, 0x72, 0x9f, 0xd2, 0x3b, 0x21,
+	     0x1e, 0x00, 0x54, 0x94, 0x58, 0xb9, 0x13, 0x0b, 0x1e, 0x08,
+	     0x63, 0xb0, 0x84, 0xfc, 0xd2, 0x9d, 0x99, 0x1c, 0xcb, 0x48,
+	     0x16, 0x4a, 0x9f, 0xc6, 0x6f, 0x27, 0x24, 0x46, 0x84, 0x82,
+	     0xfc, 0x29, 0x6e, 0x90, 0x67, 0xf7, 0xc4, 0x07, 0x82, 0x31,
+	     0x0e, 0xe5, 0x70, 0xbe, 0x0b, 0xba, 0x21, 0x94, 0xc8, 0x54,
+	     0xf9, 0x93, 0xbf, 0xcd, 0xe0, 0x51, 0x37, 0x07, 0xe0, 0x30,
+	     0x0e, 0xd5, 0x1d, 0x53, 0x8b, 0x40, 0x8a, 0x5f, 0x07, 0x32,
+	     0x66, 0x62, 0xd5, 0x72, 0x14, 0x20, 0x0a, 0x26, 0xfb, 0x0b,
+	     0x6c, 0x39, 0x8a, 0xc7, 0x9f, 0xaf, 0xda, 0x33, 0x0e, 0xcc,
+	     0x53, 0x26, 0x7a, 0x86, 0x42, 0x5b, 0x98, 0x52, 0x92, 0x96,
+	     0x86, 0xa7, 0x00, 0x37, 0x0b, 0x14, 0x84, 0x0b, 0x3d, 0x81,
+	     0x0a, 0x80, 0x8a, 0x93, 0x1c, 0xc0, 0xcc, 0x16, 0x32, 0x43,
+	     0x48, 0x86, 0x99, 0x82, 0x26, 0x2a, 0x85, 0xfc, 0x8b, 0x16,
+	     0xaa, 0xc4, 0x74, 0x0b, 0x12, 0x3b, 0x2a, 0xb4, 0x86, 0x21,
+	     0xf4, 0xba, 0xf6, 0x81, 0xf8, 0xe3, 0x2a, 0x15, 0x36, 0x98,
+	     0x2e, 0x1d, 0xc2, 0x98, 0x20, 0x6c, 0x86, 0xd6, 0x06, 0xc6,
+	     0xa1, 0x8a, 0x92, 0xac, 0x80, 0x04, 0x18, 0x55, 0xd2, 0x69,
+	     0xfb, 0x3b, 0xc2, 0xdb, 0xab, 0xe0, 0x09, 0x91, 0x9c, 0x09,
+	     0x5d, 0x98, 0xe1, 0xb8, 0x2c, 0xed, 0x13, 0x50, 0x16, 0xac,
+	     0x30, 0x3a, 0x60, 0xcb, 0xc8, 0xd5, 0x84, 0xa0, 0x08, 0x63,
+	     0xa9, 0x29, 0x0d, 0x04, 0x57, 0x69, 0x45, 0x28, 0x96, 0x6a,
+	     0x48, 0x70, 0x4d, 0x96, 0x79, 0x5e, 0x9e, 0xa2, 0x22, 0x64,
+	     0x07, 0xb7, 0xc1, 0x41, 0xb2, 0xaa, 0xed, 0xa6, 0x8c, 0x33,
+	     0x7f, 0x95, 0x20, 0xdd, 0xf8, 0x52, 0x0a, 0x64, 0xfc, 0x48,
+	     0x67, 0x92, 0x15, 0x77, 0x19, 0x1b, 0x3b, 0xef, 0x26, 0x7a,
+	     0x8c, 0x96, 0x11, 0x61, 0xd9, 0x10, 0x71, 0xe1, 0xca, 0x7a,
+	     0xc5, 0x3e, 0xe5, 0x43, 0x6f, 0x63, 0x1b, 0x28, 0x02, 0xb2,
+	     0xef, 0x64, 0x0e, 0x5d, 0x63, 0x01, 0x47, 0xee, 0x02, 0xe2,
+	     0x63, 0x98, 0xc6, 0xd6, 0x93, 0x74, 0x9d, 0x91, 0xae, 0x08,
+	     0xbe, 0xa8, 0x1a, 0x4e, 0x4a, 0xcf, 0x75, 0xe7, 0x44, 0x14,
+	     0xb3, 0x3c, 0x1e, 0xb5, 0x8b, 0xd5, 0x33, 0x48, 0x15, 0x25,
+	     0x43, 0xe2, 0xe6, 0xf2, 0xc0, 0x67, 0x4e, 0xd8, 0x10, 0x7a,
+	     0x32, 0x42, 0x3d, 0x4d, 0x31, 0x27, 0x5d, 0x40, 0x8d, 0x2b,
+	     0x3b, 0x65, 0x0a, 0x74, 0x7b, 0x4c, 0xc5, 0xa3, 0x0a, 0x49,
+	     0x4c, 0xcd, 0x31, 0x87, 0x63, 0x84, 0xa5, 0xeb, 0xba, 0x4a,
+	     0x86, 0x84, 0xf5, 0xdf, 0x03, 0x2a, 0xf3, 0xe8, 0xfa, 0x02,
+	     0x03, 0x19, 0x1f, 0xce, 0x0b, 0xe5, 0x93, 0xf9, 0x1d, 0x84,
+	     0x30, 0x33, 0x68, 0xfe, 0x63, 0x28, 0x80, 0x13, 0xc7, 0x10,
+	     0x5a, 0x4d, 0x79, 0x9a, 0xf8, 0xa8, 0x68, 0x63, 0x22, 0xe3,
+	     0xe9, 0x30, 0x19, 0x16, 0x3c, 0x08, 0x2f, 0x57, 0x87, 0x43,
+	     0xa0, 0x7e, 0x63, 0xd2, 0xf1, 0x4d, 0x79, 0x70, 0x40, 0x21,
+	     0x7c, 0x0d, 0x83, 0x57, 0xf4, 0x81, 0xb0, 0xb1, 0x2f, 0x59,
+	     0x85, 0xcd, 0x1d, 0xa5, 0x51, 0x35, 0x1e, 0xce, 0xd5, 0xe0,
+	     0x87, 0x40, 0xd2, 0x67, 0x4b, 0xe8, 0x11, 0xbd, 0xca, 0x6c,
+	     0x35, 0x91, 0xed, 0x62, 0x23, 0xef, 0xd6, 0x51, 0x93, 0x68,
+	     0x30, 0x60, 0x82, 0xda, 0x63, 0xca, 0x39, 0x80, 0x0f, 0x97,
+	     0xc1, 0xbf, 0x74, 0x34, 0xfa, 0x5c, 0xe2, 0x14, 0x3e, 0x2b,
+	     0x55, 0x00, 0xcc, 0x47, 0x20, 0xa8, 0x43, 0x34, 0xdc, 0x18,
+	     0xdb, 0x4c, 0x6a, 0xba, 0x05, 0x8d, 0x1e, 0x06, 0x04, 0xd8,
+	     0x03, 0x16, 0x47, 0x04, 0xa9, 0xef, 0xf0, 0xf3, 0x78, 0x1b,
+	     0x81, 0x2d, 0x34, 0xd4, 0xe4, 0x29, 0xd2, 0xa7, 0x60, 0x68,
+	     0xbe, 0x14, 0x62, 0xa6, 0x9b, 0x4e, 0x49, 0xbe, 0xca, 0x2e,
+	     0x8c, 0xbc, 0xb8, 0x1e, 0xe9, 0x8e, 0xb1, 0xcf, 0x4a, 0x2f,
+	     0xd2, 0xc2, 0x7a, 0xe4, 0xb1, 0x21, 0x93, 0x68, 0xb0, 0x92,
+	     0x7c, 0xb1, 0x0d, 0x24, 0x82, 0x89, 0x92, 0xb0, 0x86, 0x72,
+	     0xac, 0x69, 0x70, 0xce, 0x60, 0xf4, 0x99, 0x01, 0xf7, 0x89,
+	     0xaf, 0x2d, 0xea, 0x24, 0x39, 0x85, 0x99, 0xf5, 0xf4, 0xb8,
+	     0x68, 0xc2, 0x2b, 0x66, 0x3b, 0xa0, 0x3c, 0x46, 0x23, 0x0e,
+	     0x0e, 0x37, 0x91, 0x53, 0x6a, 0xd6, 0x99, 0x5a, 0x22, 0x1a,
+	     0xcc, 0x40, 0xec, 0xa6, 0x6b, 0x6a, 0x00, 0x02, 0xf1, 0x2b,
+	     0xde, 0xe0, 0xdd, 0xa0, 0x27, 0x2d, 0xad, 0x37, 0x83, 0x8d,
+	     0x47, 0x3e, 0xf0, 0xab, 0x2b, 0xc3, 0x71, 0x65, 0x94, 0x45,
+	     0x3b, 0xaa, 0x3e, 0xde, 0x3b, 0x71, 0xb9, 0x60, 0x2b, 0xfc,
+	     0x52, 0xa2, 0x52, 0x28, 0x07, 0x5c, 0x23, 0x6e, 0x99, 0x57,
+	     0x29, 0x45, 0x71, 0x29, 0xf8, 0x39, 0x0e, 0xc0, 0x3e, 0x0e,
+	     0xa1, 0x0f, 0xc9, 0x22, 0xae, 0x04, 0xc6, 0xc0, 0x36, 0x3a,
+	     0x81, 0x88, 0x63, 0xd8, 0x78, 0xc5, 0xb0, 0x39, 0x16, 0xc2,
+	     0x22, 0x94, 0x76, 0x99, 0x53, 0x12, 0x01, 0xbc, 0x68, 0x0c,
+	     0x51, 0xc7, 0xc0, 0x24, 0x32, 0x4e, 0x95, 0xb9, 0xe1, 0xe4,
+	     0x2d, 0x62, 0x65, 0x32, 0x0a, 0x7a, 0x27, 0x4c, 0xc8, 0x52,
+	     0x61, 0xc0, 0x98, 0x50, 0x60, 0xec, 0xa8, 0x67, 0xda, 0x1b,
+	     0x2d, 0x18, 0xda, 0xd3, 0x4d, 0xa0, 0x49, 0x78, 0xef, 0x91,
+	     0x42, 0x66, 0x35, 0xa5, 0x62, 0x0f, 0x19, 0x0c, 0x07, 0xa8,
+	     0x88, 0x90, 0xc6, 0xa4, 0x78, 0xd6, 0x04, 0x13, 0xdc, 0x5d,
+	     0x4c, 0x80, 0xc6, 0xdb, 0x01, 0x27, 0x78, 0x27, 0x4f, 0x31,
+	     0x0a, 0xa6, 0xe8, 0x9e, 0x7d, 0xa6, 0x4b, 0x7b, 0x54, 0x20,
+	     0x2e, 0x42, 0x16, 0x02, 0x28, 0xfb, 0x79, 0xd4, 0x8e, 0x86,
+	     0xb0, 0x33, 0x20, 0x5e, 0xdd, 0x69, 0x9c, 0xe2, 0x2a, 0xea,
+	     0x04, 0x5e, 0xc6, 0x80, 0x64, 0x9b, 0x0d, 0x0e, 0xce, 0x1e,
+	     0xee, 0x94, 0xd0, 0x01, 0x91, 0x5d, 0xc4, 0x32, 0x90, 0x2e,
+	     0x65, 0xa5, 0x4e, 0x81, 0xb4, 0x09, 0x6c, 0x41, 0xb0, 0x3a,
+	     0x62, 0xc1, 0x17, 0x6e, 0x54, 0x99, 0xcd, 0xbc, 0x58, 0xac,
+	     0x44, 0xc8, 0x30, 0xc4, 0x52, 0x11, 0xec, 0x2c, 0xa2, 0x88,
+	     0x73, 0x26, 0xc6, 0x9a, 0x68, 0xc7, 0x76, 0x62, 0xde, 0xca,
+	     0x40, 0xf4, 0xa0, 0xb0, 0x92, 0x72, 0x28, 0xef, 0x48, 0x99,
+	     0x43, 0x25, 0x32, 0xee, 0xd9, 0x75, 0x60, 0x14, 0x0c, 0x01,
+	     0xe7, 0xa6, 0xa6, 0xe6, 0x5f, 0xeb, 0xd5, 0xe5, 0xe0, 0xb2,
+	     0x02, 0xa6, 0x3a, 0x3a, 0x53, 0x57, 0xa4, 0xb9, 0xc0, 0x1b,
+	     0x48, 0xe7, 0x93, 0x7e, 0xa4, 0x57, 0xce, 0x01, 0x5a, 0x34,
+	     0xd9, 0xc7, 0x19, 0x5a, 0x76, 0x8f, 0xce, 0x07, 0x6d, 0x79,
+	     0xcc, 0x14, 0xe2, 0x0e, 0x17, 0xc7, 0xcc, 0x6b, 0x8a, 0xdd,
+	     0x12, 0xf4, 0xe1, 0xd8, 0x5c, 0x42, 0x65, 0x20, 0x0d, 0x60,
+	     0xb4, 0xca, 0xd0, 0x08, 0x4f, 0xe9, 0xeb, 0x37, 0x04, 0x00,
+	     0x59, 0x20, 0xee, 0xb2, 0x76, 0x48, 0x89, 0xd0, 0xce, 0x1d,
+	     0xe6, 0xa2, 0x34, 0x77, 0xd8, 0xb5, 0xb8, 0x38, 0xf0, 0x4a,
+	     0x8d, 0xa4, 0xfa, 0x81, 0x7f, 0xe4, 0xe6, 0x76, 0x31, 0x74,
+	     0x0b, 0xfd, 0x97, 0xe2, 0x78, 0x2e, 0x3e, 0xbd, 0x23, 0xd7,
+	     0xea, 0xe1, 0x02, 0xef, 0x68, 0x19, 0xf8, 0x6e, 0xb4, 0x7d,
+	     0xdf, 0x85, 0xba, 0x8a, 0x04, 0x8d, 0x5c, 0x36, 0x2e, 0x40,
+	     0xbb, 0x44, 0xce, 0xd6, 0x98, 0xb8, 0x34, 0x65, 0xce, 0xcb,
+	     0x65, 0x07, 0xc4, 0x8a, 0x5b, 0x55, 0x79, 0x0d, 0x97, 0x6f,
+	     0x93, 0x8d, 0x51, 0x86, 0x61, 0x42, 0xea, 0x80, 0x02, 0x11,
+	     0x6a, 0x4c, 0xc3, 0x98, 0x24, 0x98, 0x3e, 0xf9, 0x1a, 0x24,
+	     0x50, 0x9d, 0xb9, 0x5c, 0xb2, 0x62, 0x3a, 0xd5, 0xd6, 0x93,
+	     0x4f, 0x9a, 0xb2, 0x80, 0x00, 0xee, 0x64, 0xd7, 0x7c, 0xc3,
+	     0x4e, 0x4e, 0xe5, 0x26, 0x5e, 0x7e, 0x9f, 0xe7, 0x5e, 0x3c,
+	     0x4d, 0x17, 0x41, 0x7a, 0x08, 0x7c, 0x7c, 0x06, 0xd2, 0x5e,
+	     0xda, 0x13, 0x0a, 0x53, 0xac, 0x8a, 0x5a, 0xd4, 0x4f, 0x20,
+	     0x24, 0x28, 0xfb, 0xfe, 0x98, 0xc2, 0x29, 0x5f, 0x58, 0x1d,
+	     0x86, 0x02, 0x63, 0x56, 0x91, 0xd2, 0xdc, 0xca, 0xb0, 0x03,
+	     0xa7, 0x1e, 0x0d, 0x1b, 0xeb, 0x43, 0x16, 0xd9, 0xe9, 0xa0,
+	     0x10, 0xdd, 0x7f, 0x96, 0x57, 0x1b, 0x19, 0x3c, 0x11, 0x90,
+	     0xa4, 0xdc, 0xe0, 0x59, 0xfb, 0x17, 0xf5, 0x33, 0xe9, 0x09,
+	     0x5e, 0x8a, 0x29, 0x66, 0x38, 0x4d, 0xd3, 0xb3, 0xee, 0x4b,
+	     0x5d, 0xc0, 0xf1, 0xee, 0x35, 0x70, 0xb6, 0xb5, 0x97, 0xba,
+	     0x89, 0xae, 0xf3, 0xd5, 0xe0, 0x55, 0x9a, 0x34, 0x98, 0x72,
+	     0xad, 0xa7, 0xaa, 0x5e, 0xa1, 0xf1, 0x72, 0x90, 0xc4, 0xba,
+	     0x67, 0x5a, 0xe9, 0x74, 0x78, 0xac, 0xa2, 0xf3, 0x06, 0x74,
+	     0x68, 0x3a, 0x70, 0x60, 0x18, 0x1d, 0x56, 0x34, 0xa8, 0x6a,
+	     0xa7, 0x32, 0x46, 0x07, 0xb8, 0xef, 0x19, 0xc0, 0x2e, 0xc3,
+	     0xc3, 0x08, 0x5b, 0x20, 0x87, 0x86, 0x81, 0x4a, 0x0e, 0x8c,
+	     0xe7, 0x7d, 0x43, 0x90, 0x5a, 0xee, 0x34, 0x0b, 0x22, 0x4a,
+	     0x68, 0x0f, 0xa3, 0x58, 0xc4, 0x61, 0xff, 0xe1, 0x15, 0xca,
+	     0x57, 0x4a, 0x25, 0x82, 0x99, 0xf7, 0x98, 0xe2, 0x42, 0x74,
+	     0x73, 0xa9, 0xe1, 0xc3, 0x98, 0x05, 0x41, 0xd9, 0x3c, 0x94,
+	     0xc4, 0x8d, 0x85, 0xcf, 0x0b, 0x22, 0x32, 0xe3, 0x89, 0xa4,
+	     0x6c, 0x3c, 0x2d, 0xf9, 0x07, 0xf8, 0x83, 0xe4, 0x9e, 0x12,
+	     0x8c, 0x74, 0x85, 0xd5, 0x03, 0xe4, 0xfc, 0x14, 0xe0, 0x06,
+	     0x3b, 0xb1, 0xd4, 0x9f, 0x27, 0x46, 0xc2, 0x87, 0xc1, 0xc4,
+	     0x2c, 0xb8, 0x7f, 0x62, 0x7c, 0x94, 0xa9, 0x4a, 0x49, 0xbc,
+	     0x8f, 0xa0, 0xe8, 0xe9, 0x88, 0xb4, 0x1d, 0x35, 0x52, 0x71,
+	     0xc9, 0x1e, 0x55, 0x0b, 0xd5, 0x2e, 0x70, 0x33, 0x35, 0x92,
+	     0x18, 0xa8, 0x09, 0x63, 0x98, 0xdd, 0xb5, 0xa5, 0xdf, 0xd2,
+	     0xac, 0x83, 0xf8, 0x8c, 0x63, 0xde, 0xe9, 0xcd, 0xb4, 0x3a,
+	     0xb6, 0x2f, 0x3b, 0xa1, 0xdb, 0xc6, 0xa8, 0x55, 0xa0, 0x13,
+	     0x29, 0x0a, 0x02, 0xd2, 0x1d, 0x23, 0x0b, 0x27, 0x65, 0xce,
+	     0x03, 0x39, 0xa6, 0xb5, 0xe2, 0x19, 0x79, 0xca, 0x0e, 0x04,
+	     0x3a, 0x30, 0x9c, 0x1a, 0x12, 0xd3, 0xf0, 0x65, 0x94, 0x4b,
+	     0x23, 0x82, 0x25, 0xf8, 0x95, 0x00, 0x17, 0xbd, 0x1d, 0x00,
+	     0x91, 0x9b, 0x08, 0x04, 0x4c, 0xa2, 0xed, 0x1a, 0x48, 0x45,
+	     0xd8, 0x95, 0xc9, 0x05, 0xa9, 0x11, 0x26, 0x23, 0x42, 0x51,
+	     0x6f, 0x69, 0x8c, 0x6a, 0x94, 0x0c, 0xc5, 0x0c, 0x4f, 0xe9,
+	     0x86, 0x22, 0x14, 0x13, 0xe1, 0x32, 0x6e, 0x28, 0x93, 0x9b,
+	     0x2a, 0x24, 0x23, 0xc6, 0x6c, 0xa5, 0xb3, 0xa6, 0x6a, 0x9c,
+	     0xe7, 0xa1, 0x2f, 0x61, 0x0a, 0x82, 0x23, 0xfd, 0x8a, 0xbe,
+	     0xcb, 0xbb, 0x44, 0x61, 0x2b, 0xf5, 0xa1, 0x73, 0xc0, 0x8b,
+	     0xb6, 0x9b, 0x4f, 0x03, 0xb7, 0x63, 0x43, 0x60, 0x56, 0x03,
+	     0x3b, 0xbd, 0xaf, 0xbe, 0x53, 0xfd, 0x27, 0xe3, 0x40, 0x6f,
+	     0x30, 0xb6, 0xc2, 0x23, 0x42, 0xf0, 0x41, 0x17, 0x50, 0x26,
+	     0xf2, 0xcd, 0x06, 0x1d, 0x7f, 0xa7, 0x6a, 0x62, 0x78, 0xda,
+	     0x65, 0x41, 0x42, 0x1c, 0x7d, 0xa0, 0x47, 0x21, 0xc4, 0x37,
+	     0x81, 0x22, 0xd2, 0x35, 0xa8, 0x8a, 0x75, 0x19, 0xc3, 0x90,
+	     0xeb, 0x04, 0x2a, 0x13, 0xee, 0x8d, 0x50, 0xd9, 0x37, 0x5b,
+	     0x43, 0x71, 0x34, 0x39, 0x08, 0xe9, 0x23, 0x03, 0x4a, 0xba,
+	     0x0c, 0x59, 0xd8, 0x13, 0x8a, 0x99, 0xad, 0xae, 0x62, 0x40,
+	     0x7a, 0x15, 0x63, 0x85, 0x52, 0x72, 0x0a, 0x30, 0x64, 0x51,
+	     0xd7, 0x38, 0x87, 0x18, 0x46, 0x2c, 0x3c, 0x0b, 0xc7, 0x45,
+	     0x8b, 0x86, 0x65, 0xa4, 0xd2, 0xb3, 0x98, 0x50, 0x30, 0x26,
+	     0xb0, 0x10, 0x40, 0x0a, 0x80, 0x60, 0x7d, 0x83, 0xf5, 0xe1,
+	     0x18, 0xc6, 0xdc, 0x18, 0x67, 0x5c, 0xac, 0xc1, 0x9e, 0xa8,
+	     0xe1, 0x2a, 0x17, 0x17, 0x1c, 0x46, 0xc5, 0xd8, 0x84, 0x99,
+	     0x5d, 0x9d, 0x90, 0x51, 0xe2, 0x52, 0x19, 0xe7, 0x1b, 0xb9,
+	     0xaa, 0x15, 0x4d, 0x3c, 0x58, 0x58, 0x93, 0x1f, 0x83, 0xd3,
+	     0x03, 0xb9, 0x22, 0x6e, 0x3c, 0xbb, 0xdc, 0xc2, 0xfc, 0x21,
+	     0x32, 0x23, 0x36, 0xd4, 0xa8, 0x6a, 0xad, 0x91, 0x39, 0xdb,
+	     0xe8, 0xd5, 0xa3, 0x52, 0x8f, 0x0e, 0xc4, 0x64, 0x54, 0xa1,
+	     0x65, 0xb4, 0x35, 0xab, 0x70, 0x97, 0x65, 0x42, 0xcc, 0x77,
+	     0x11, 0x38, 0xb4, 0xe4, 0x1c, 0x26, 0x50, 0xd5, 0x0a, 0x78,
+	     0xe4, 0x28, 0x35, 0x61, 0x07, 0x37, 0x1b, 0x10, 0x47, 0x5e,
+	     0xe8, 0x6a, 0xf3, 0xb9, 0x93, 0x16, 0x18, 0x41, 0x18, 0x0d,
+	     0x7b, 0x13, 0x50, 0xc5, 0xed, 0xc5, 0xd0, 0xa2, 0xa3, 0x2c,
+	     0x30, 0x88, 0x29, 0xc2, 0x88, 0xbb, 0x88, 0x7e, 0x1b, 0x62,
+	     0xaf, 0x02, 0x92, 0xb4, 0x62, 0xe7, 0xcc, 0x64, 0x58, 0x90,
+	     0x11, 0xc7, 0xcc, 0x5e, 0xe6, 0x89, 0xfe, 0x51, 0xe5, 0x48,
+	     0x0d, 0x28, 0xaf, 0x02, 0x31, 0xc1, 0xa8, 0x6c, 0x4a, 0x15,
+	     0x81, 0x0d, 0xe8, 0xf5, 0x1a, 0x1f, 0x01, 0x90, 0xa6, 0x64,
+	     0x57, 0x86, 0xba, 0x06, 0x18, 0x8f, 0xdf, 0xf3, 0xc8, 0xaa,
+	     0x03, 0x46, 0x3e, 0x8e, 0x1d, 0x5d, 0x06, 0xe5, 0xcc, 0x3d,
+	     0x2a, 0x58, 0xa7, 0xcf, 0xa8, 0x4e, 0xe4, 0x22, 0x01, 0x98,
+	     0x4f, 0x3c, 0xcf, 0x87, 0x93, 0x23, 0xd8, 0xd2, 0x85, 0x84,
+	     0xf3, 0x2c, 0x3d, 0x92, 0x4d, 0xac, 0x8b, 0x16, 0x55, 0x19,
+	     0x44, 0xda, 0xe1, 0x61, 0x2b, 0xc3, 0x10, 0x9c, 0x06, 0x35,
+	     0xc2, 0x8e, 0x75, 0x15, 0x99, 0x90, 0x81, 0xb1, 0xde, 0x2a,
+	     0xf9, 0xcc, 0x9f, 0xb4, 0x8c, 0xf7, 0x24, 0x98, 0x00, 0xde,
+	     0x11, 0xcc, 0x81, 0x2f, 0x12, 0xeb, 0x11, 0xd4, 0x1c, 0x80,
+	     0x65, 0x3e, 0x8e, 0x20, 0x13, 0xef, 0xe4, 0x25, 0x3b, 0x89,
+	     0x46, 0x88, 0x24, 0xfc, 0x99, 0x8d, 0x04, 0x03, 0x00, 0xef,
+	     0xf1, 0x73, 0x81, 0xce, 0x02, 0x32, 0xd2, 0xdc, 0x64, 0x4f,
+	     0x3a, 0x11, 0xd0, 0x12, 0x28, 0x33, 0x39, 0x29, 0xbe, 0x2a,
+	     0x1c, 0xee, 0x28, 0x26, 0x80, 0xf2, 0xa7, 0x96, 0x4c, 0x6c,
+	     0xc0, 0x7e, 0x64, 0xbc, 0x48, 0x47, 0xe5, 0x07, 0x7e, 0x31,
+	     0x90, 0x0b, 0x45, 0x83, 0x86, 0xd0, 0x46, 0xe0, 0x6d, 0x34,
+	     0xd0, 0xc4, 0x0e, 0x21, 0x1e, 0x83, 0x85, 0x7a, 0x4f, 0x84,
+	     0xe1, 0x72, 0x43, 0xb5, 0x58, 0x0f, 0xea, 0x01, 0xd2, 0x6e,
+	     0x19, 0x41, 0xc9, 0x02, 0xc6, 0xcc, 0x96, 0x39, 0xd1, 0x28,
+	     0x12, 0x02, 0x84, 0x6c, 0x8f, 0xec, 0x87, 0x27, 0x1f, 0x50,
+	     0x8d, 0x8a, 0x92, 0x3e, 0xb0, 0x15, 0x71, 0x88, 0x14, 0x98,
+	     0x2d, 0x1b, 0x79, 0x26, 0x77, 0xcf, 0xff, 0x73, 0xd6, 0x6b,
+	     0x09, 0x84, 0x82, 0x6e, 0x14, 0x4c, 0x15, 0x49, 0x4b, 0x80,
+	     0xd0, 0x7d, 0xb0, 0x00, 0x72, 0x74, 0xc9, 0x9c, 0x8e, 0x74,
+	     0xe5, 0xc2, 0x0f, 0x0b, 0x86, 0xa1, 0x60, 0xd1, 0x90, 0xa2,
+	     0x9c, 0xe5, 0x3d, 0x18, 0x5b, 0xe8, 0x2d, 0x2d, 0xc4, 0xdc,
+	     0x83, 0x24, 0x25, 0xad, 0x52, 0xfe, 0x20, 0xfb, 0x1a, 0x19,
+	     0xf1, 0x1e, 0x10, 0x64, 0x1b, 0xd1, 0x64, 0x21, 0x48, 0x68,
+	     0xb1, 0x85, 0x31, 0xed, 0x56, 0xd4, 0x20, 0x7c, 0xd3, 0x30,
+	     0x91, 0x6a, 0xd2, 0xb4, 0x73, 0x28, 0x21, 0xd6, 0x00, 0x1b,
+	     0xbb, 0xaf, 0x70, 0x5f, 0x4d, 0x6c, 0x59, 0x21, 0xf1, 0x03,
+	     0xd0, 0x39, 0x1f, 0xf6, 0x36, 0x56, 0x4b, 0x04, 0xdb, 0xd3,
+	     0xe9, 0xe9, 0x07, 0xa7, 0xb4, 0x32, 0x2d, 0x6b, 0xa0, 0x5e,
+	     0xee, 0x9d, 0xdd, 0x1e, 0x70, 0x32, 0x8f, 0x20, 0x1b, 0x39,
+	     0xc2, 0x8d, 0x22, 0x6a, 0x42, 0x15, 0xcb, 0xf6, 0x61, 0x53,
+	     0x2d, 0xc9, 0x56, 0x19, 0xe2, 0x5c, 0xa2, 0x0b, 0xa1, 0x47,
+	     0x77, 0x1a, 0x9d, 0x50, 0xd5, 0x07, 0xab, 0x14, 0x35, 0x54,
+	     0x42, 0x44, 0x25, 0x7e, 0x28, 0x3f, 0xb2, 0x73, 0x50, 0xae,
+	     0x81, 0x68, 0x67, 0xd8, 0x89, 0x3d, 0x72, 0x6b, 0x28, 0x89,
+	     0x87, 0x2b, 0x27, 0xa6, 0xf2, 0x06, 0x2a, 0x13, 0x47, 0xa2,
+	     0x1f, 0xc2, 0x9d, 0x5e, 0x09, 0x00, 0x88, 0xca, 0x23, 0x97,
+	     0x47, 0xa8, 0xa9, 0x51, 0x5c, 0x63, 0x40, 0x88, 0x12, 0x68,
+	     0xeb, 0x07, 0x88, 0x85, 0x2f, 0x72, 0x41, 0x87, 0x83, 0xac,
+	     0x9d, 0x81, 0x1d, 0x84, 0x76, 0x87, 0x8d, 0xc8, 0x1e, 0xe1,
+	     0xc1, 0xf8, 0xc8, 0xcc, 0xd4, 0x70, 0x26, 0x13, 0xa3, 0x28,
+	     0x48, 0x30, 0x25, 0x54, 0x01, 0xd1, 0x3d, 0x89, 0xb1, 0x52,
+	     0x2a, 0x38, 0x96, 0x32, 0x3b, 0x37, 0x9c, 0x5a, 0xc8, 0xc9,
+	     0x45, 0x67, 0x55, 0x91, 0xb2, 0x2e, 0xad, 0xed, 0x00, 0x30,
+	     0x33, 0x47, 0x9f, 0x82, 0x3b, 0xc8, 0x17, 0xf3, 0x46, 0xcb,
+	     0x02, 0xf9, 0x1e, 0xca, 0x34, 0x39, 0x46, 0xdb, 0x8a, 0x7b,
+	     0x61, 0x6e, 0x14, 0x41, 0x49, 0x9e, 0xe5, 0x6d, 0x74, 0x92,
+	     0x6f, 0x04, 0xad, 0xd6, 0x01, 0xb2, 0x75, 0x02, 0x55, 0x68,
+	     0xce, 0x70, 0x0f, 0x8b, 0x6a, 0xa9, 0x0c, 0x11, 0x65, 0x96,
+	     0x63, 0x85, 0x54, 0xc6, 0x02, 0xd6, 0xf4, 0xb4, 0xaa, 0x34,
+	     0xf6, 0xa0, 0xfb, 0xc8, 0xc1, 0x43, 0x4e, 0xd3, 0xb2, 0x93,
+	     0xab, 0xcc, 0xed, 0x40, 0x6b, 0xe9, 0xaf, 0x00, 0x43, 0x64,
+	     0x45, 0x6d, 0xe0, 0x4a, 0xa4, 0x8c, 0x74, 0xb1, 0x80, 0x18,
+	     0xa8, 0x25, 0xa8, 0x9d, 0x66, 0x93, 0xd2, 0x50, 0x8a, 0x98,
+	     0x04, 0x6d, 0x11, 0x25, 0x14, 0xdb, 0xb1, 0x62, 0x09, 0x50,
+	     0x6b, 0xe8, 0x43, 0x82, 0xe8, 0x17, 0xf1, 0xa2, 0x4e, 0x2b,
+	     0x18, 0xb8, 0x6e, 0x11, 0x1d, 0x28, 0x29, 0xd2, 0x61, 0x93,
+	     0xf9, 0xe0, 0x66, 0x86, 0x11, 0xce, 0xa8, 0x5f, 0x1e, 0x22,
+	     0x05, 0x8c, 0x95, 0x91, 0x94, 0x41, 0x31, 0xa8, 0x74, 0x7f,
+	     0xfb, 0x1f, 0x3f, 0xc7, 0xa5, 0x0f, 0x08, 0x80, 0x35, 0xac,
+	     0x52, 0xcd, 0x9c, 0xa8, 0x3e, 0xa7, 0xc8, 0x1e, 0xa3, 0xf9,
+	     0x91, 0x9d, 0x64, 0xab, 0x28, 0x68, 0x26, 0xc4, 0xb2, 0x7f,
+	     0x90, 0x0f, 0xf3, 0x0f, 0xa4, 0x30, 0x7c, 0x32, 0x41, 0xb2,
+	     0x48, 0x74, 0x2e, 0x56, 0x25, 0x2c, 0xa3, 0xfd, 0xdc, 0x6e,
+	     0x86, 0x81, 0x16, 0xd9, 0x44, 0xb8, 0x79, 0x31, 0xd1, 0x73,
+	     0x45, 0x98, 0xab, 0x04, 0x92, 0x03, 0xe4, 0x02, 0x78, 0xe9,
+	     0x18, 0xd6, 0xfd, 0xa8, 0x99, 0x2e, 0x9b, 0x0b, 0x22, 0xc7,
+	     0xa8, 0xdf, 0x73, 0x67, 0x60, 0x2c, 0x50, 0xd9, 0xd4, 0x54,
+	     0x82, 0x3d, 0xbe, 0xc9, 0x75, 0xed, 0xbb, 0x37, 0x42, 0xeb,
+	     0x44, 0x80, 0x70, 0x4a, 0x3b, 0x56, 0x9d, 0x98, 0x03, 0xeb,
+	     0xcf, 0x4a, 0x70, 0x2e, 0xb4, 0x40, 0xf0, 0x99, 0x86, 0x4c,
+	     0x88, 0xcc, 0xa8, 0x15, 0xa7, 0xaa, 0x54, 0x12, 0x68, 0x2a,
+	     0xc6, 0xec, 0x2e, 0xb8, 0x4b, 0x2d, 0xc1, 0xdb, 0x05, 0x43,
+	     0xe6, 0x62, 0x33, 0x04, 0x71, 0x54, 0x62, 0xc1, 0x06, 0x2a,
+	     0xe0, 0xb1, 0x56, 0xd0, 0xb3, 0xe7, 0xda, 0xf5, 0x9b, 0xe9,
+	     0x22, 0x42, 0x72, 0xfc, 0x38, 0x6c, 0x29, 0x2d, 0x19, 0x71,
+	     0xc1, 0x4c, 0x58, 0x42, 0x98, 0x54, 0xe9, 0x2f, 0x23, 0x50,
+	     0x7c, 0x21, 0x3a, 0xcf, 0x32, 0x6b, 0xe2, 0x00, 0xc5, 0x43,
+	     0xe2, 0x79, 0xb9, 0x76, 0x5c, 0xb7, 0x82, 0x85, 0xdc, 0x9b,
+	     0xe0, 0xdb, 0x32, 0x71, 0x6c, 0x7e, 0x00, 0x10, 0xe4, 0x05,
+	     0x75, 0x03, 0x90, 0x04, 0x80, 0x8a, 0x49, 0x10, 0x1d, 0x8c,
+	     0xe6, 0xd1, 0x29, 0xa9, 0x4b, 0xc4, 0x84, 0x1c, 0x15, 0x12,
+	     0xea, 0x1b, 0x40, 0xf9, 0xe2, 0x56, 0xad, 0x66, 0x3c, 0x39,
+	     0xcb, 0x24, 0x03, 0x41, 0xd9, 0x62, 0x17, 0xd4, 0x40, 0xca,
+	     0xc6, 0x91, 0x5f, 0x3a, 0x2f, 0xf8, 0x0c, 0x3c, 0x43, 0xa3,
+	     0x0b, 0x39, 0x67, 0x15, 0xd9, 0x39, 0xd0, 0xfd, 0xfe, 0x12,
+	     0x64, 0x9a, 0x63, 0xc4, 0x33, 0xb0, 0x69, 0x08, 0xe9, 0xcb,
+	     0x07, 0xfc, 0xe5, 0x5e, 0x85, 0x88, 0x13, 0x08, 0x96, 0xcb,
+	     0x61, 0xa6, 0x32, 0x2b, 0x2b, 0x4e, 0xe4, 0x21, 0x10, 0x2a,
+	     0x59, 0x36, 0x42, 0x5f, 0xb2, 0x0b, 0x99, 0x32, 0xbf, 0xd2,
+	     0x1a, 0x21, 0x59, 0x64, 0x54, 0x48, 0xac, 0x97, 0x5d, 0x5e,
+	     0x31, 0x6d, 0xc8, 0xa4, 0xb9, 0xfe, 0xe5, 0xbe, 0x4c, 0x67,
+	     0xd4, 0x81, 0xa1, 0x53, 0x7b, 0xce, 0x0f, 0xe8, 0xc7, 0x58,
+	     0xed, 0x79, 0xb1, 0x20, 0x5b, 0x75, 0x2c, 0x79, 0x20, 0x8b,
+	     0x4a, 0xac, 0x38, 0xa0, 0x61, 0xc6, 0x45, 0xaa, 0xe6, 0x15,
+	     0x4c, 0x33, 0x9f, 0x84, 0x4e, 0x30, 0xc9, 0xf4, 0x25, 0x79,
+	     0x02, 0xb8, 0x23, 0x4d, 0x70, 0x1f, 0xb4, 0xa2, 0xd9, 0x4a,
+	     0x0b, 0x6d, 0x00, 0x3b, 0xf9, 0x01, 0x8c, 0x1a, 0x30, 0x19,
+	     0xda, 0xa5, 0x5b, 0xe0, 0x58, 0x83, 0x1f, 0x38, 0x03, 0xbc,
+	     0x47, 0xba, 0x1e, 0xc6, 0x24, 0x59, 0x95, 0xe9, 0x64, 0xae,
+	     0xcc, 0x17, 0x01, 0x01, 0xe1, 0x42, 0xc8, 0xbf, 0x4e, 0x64,
+	     0xc4, 0x27, 0x30, 0x4c, 0x86, 0x13, 0xd3, 0x56, 0x57, 0x94,
+	     0xbe, 0x30, 0x31, 0xd8, 0x37, 0x2b, 0x84, 0xb1, 0xca, 0x90,
+	     0xa3, 0x2d, 0x04, 0xd8, 0xa9, 0x2f, 0x3e, 0x33, 0xab, 0x91,
+	     0xbd, 0xb5, 0xda, 0x8b, 0x13, 0x22, 0x4e, 0x59, 0x07, 0x30,
+	     0x86, 0xa5, 0x96, 0xdc, 0x3c, 0x15, 0x84, 0x41, 0x62, 0xa8,
+	     0xc4, 0x7b, 0x90, 0xe2, 0x30, 0x32, 0x69, 0x3b, 0x42, 0x26,
+	     0x76, 0xcc, 0x98, 0x54, 0xe9, 0xe1, 0x6a, 0xb1, 0x99, 0x93,
+	     0xea, 0x24, 0x35, 0x9f, 0x77, 0x92, 0x00, 0x83, 0xc9, 0xbb,
+	     0x22, 0x6b, 0xd9, 0x1c, 0xe1, 0x42, 0x6d, 0x0c, 0xe2, 0x13,
+	     0x83, 0xb9, 0xdd, 0x04, 0xb0, 0xc3, 0x0c, 0xa2, 0xea, 0xeb,
+	     0x0c, 0x99, 0x32, 0x7d, 0x38, 0xad, 0x14, 0x95, 0x9e, 0x9d,
+	     0xec, 0x3c, 0x77, 0x5e, 0x84, 0xbf, 0xe4, 0x90, 0xca, 0x08,
+	     0x16, 0xbd, 0x0e, 0xd7, 0xaa, 0xe9, 0x09, 0xe9, 0x9b, 0xb1,
+	     0x21, 0xa6, 0x78, 0x4a, 0x5d, 0xc6, 0xb5, 0xf8, 0x83, 0x0f,
+	     0xe5, 0xd7, 0x48, 0xef, 0xdb, 0x2d, 0x38, 0x05, 0x6a, 0x16,
+	     0x0b, 0xb4, 0xd1, 0xc2, 0xcf, 0xab, 0x99, 0x01, 0xc9, 0x3a,
+	     0xfb, 0x45, 0x13, 0x21, 0x04, 0xcc, 0x0b, 0x47, 0xdd, 0xc5,
+	     0x8a, 0x5f, 0xe4, 0x94, 0xba, 0xdb, 0x25, 0x4c, 0x60, 0x24,
+	     0x9b, 0x1d, 0xe5, 0x9e, 0x68, 0xb1, 0xc6, 0xc6, 0x36, 0xdb,
+	     0xcf, 0xb4, 0x47, 0x5a, 0x9b, 0xcd, 0x94, 0x45, 0xc4, 0x73,
+	     0xf2, 0x13, 0x78, 0x41, 0x5a, 0xf7, 0x60, 0x78, 0x32, 0x35,
+	     0x7c, 0xcd, 0xfd, 0xa3, 0xc7, 0xeb, 0xfd, 0x08, 0x82, 0x23,
+	     0x9a, 0xa1, 0xcc, 0xd4, 0x9a, 0x5e, 0x8f, 0x7f, 0x17, 0xf9,
+	     0xed, 0x1b, 0x37, 0x6d, 0x3a, 0xb1, 0x8c, 0xea, 0xc2, 0x00,
+	     0x63, 0x98, 0x86, 0xc5, 0xa5, 0x68, 0xf6, 0xc3, 0xec, 0xf1,
+	     0x85, 0x54, 0x33, 0xd4, 0x05, 0x4e, 0xcd, 0x2f, 0x48, 0x3b,
+	     0x01, 0xf9, 0xc4, 0x84, 0x53, 0xd3, 0x25, 0x7f, 0x9e, 0x94,
+	     0x0f, 0xb5, 0x86, 0x96, 0xa6, 0x4d, 0xa8, 0x97, 0x90, 0x92,
+	     0xcb, 0xe4, 0x31, 0xb9, 0x93, 0x8b, 0x48, 0xea, 0x61, 0xdc,
+	     0x8e, 0x57, 0x02, 0x3c, 0xdb, 0xf9, 0x65, 0x72, 0x8a, 0x4b,
+	     0xcd, 0x0a, 0x8e, 0x10, 0xfe, 0xe7, 0x17, 0x62, 0x92, 0xe3,
+	     0x48, 0xbd, 0x4d, 0xea, 0x72, 0x8d, 0x30, 0x45, 0x01, 0xad,
+	     0xea, 0xdd, 0x64, 0xd3, 0xfa, 0x23, 0xea, 0x0a, 0x69, 0x66,
+	     0x3e, 0x9b, 0x72, 0x57, 0x11, 0x07, 0xcf, 0x84, 0xa0, 0x81,
+	     0x4a, 0x1a, 0x3d, 0xca, 0x8b, 0xec, 0xc1, 0x27, 0xe3, 0xde,
+	     0xe8, 0x1c, 0x25, 0x77, 0x4c, 0x6c, 0x26, 0x82, 0x70, 0x86,
+	     0xdf, 0x0e, 0x4a, 0xd8, 0xc7, 0x6a, 0x6d, 0xc9, 0xfb, 0xfa,
+	     0x36, 0xd1, 0xe2, 0xe0, 0x5f, 0x22, 0x05, 0xa4, 0x19, 0x38,
+	     0x60, 0x1d, 0x47, 0x12, 0x18, 0x67, 0xc4, 0xde, 0xc8, 0x09,
+	     0xdf, 0xa7, 0x59, 0x12, 0x3a, 0xa0, 0xbe, 0xe7, 0x62, 0x14,
+	     0x3c, 0xcc, 0x97, 0xea, 0x2b, 0x8e, 0xc7, 0x09, 0xc0, 0xe2,
+	     0xa0, 0x48, 0xc2, 0xe0, 0xbc, 0xd6, 0x79, 0xf0, 0x06, 0x90,
+	     0xe8, 0x0c, 0xfd, 0x87, 0x1d, 0x87, 0xc0, 0xd0, 0xcd, 0x7c,
+	     0xd0, 0xc0, 0x6d, 0xb8, 0x12, 0x80, 0x05, 0x0a, 0x5e, 0x24,
+	     0xf2, 0x03, 0xc8, 0x4c, 0xd1, 0x61, 0xd9, 0x70, 0xcc, 0x39,
+	     0xf4, 0x48, 0x3e, 0x86, 0x1c, 0x13, 0xe2, 0x24, 0xfc, 0xb8,
+	     0xa0, 0xe1, 0x15, 0xfc, 0x6e, 0x2d, 0x96, 0xd2, 0x93, 0x08,
+	     0x87, 0x70, 0xe0, 0x10, 0x43, 0xa8, 0xa5, 0x68, 0xb4, 0x08,
+	     0x74, 0x9c, 0x3d, 0xdb, 0x48, 0x70, 0xe0, 0xe5, 0xf4, 0xc2,
+	     0x0b, 0x11, 0xd6, 0x52, 0x5b, 0x62, 0x22, 0x09, 0xd0, 0xac,
+	     0x6a, 0xeb, 0x08, 0x42, 0x6c, 0x29, 0x64, 0xc7, 0x6e, 0x12,
+	     0xde, 0xaf, 0xf5, 0x00, 0x9b, 0x65, 0xe1, 0xb2, 0xb2, 0xa1,
+	     0x5d, 0xfe, 0x01, 0x3d, 0x7d, 0x06, 0x99, 0x44, 0x8b, 0xb1,
+	     0x6c, 0x85, 0x15, 0xfb, 0x7a, 0x92, 0xe8, 0x7e, 0x76, 0x97,
+	     0xe4, 0xb0, 0x07, 0x4e, 0x4a, 0x07, 0x74, 0xb0, 0x7d, 0x32,
+	     0xfd, 0x9d, 0x76, 0xb2, 0x7d, 0x3e, 0x24, 0x5e, 0x1d, 0x81,
+	     0x4e, 0x36, 0xc0, 0xfb, 0x0b, 0x55, 0x7c, 0x1f, 0x0a, 0x49,
+	     0x26, 0x82, 0x5a, 0x5b, 0xf0, 0x87, 0xac, 0xa2, 0x24, 0x34,
+	     0x66, 0xfd, 0x74, 0x5c, 0x34, 0xac, 0xc9, 0xe2, 0xcf, 0x7f,
+	     0xb2, 0xd6, 0xa5, 0x17, 0x59, 0x50, 0x1c, 0x2f, 0xc3, 0x24,
+	     0x5d, 0x93, 0x71, 0x8b, 0x2a, 0xc7, 0x64, 0xf3, 0x81, 0xa8,
+	     0xa6, 0x5d, 0x52, 0xd0, 0x64, 0xbc, 0x20, 0x1d, 0x49, 0x79,
+	     0x0a, 0x1c, 0x53, 0xe0, 0x2b, 0x29, 0xfc, 0xd1, 0x56, 0x6d,
+	     0xf5, 0x05, 0xb0, 0xe4, 0xed, 0xe3, 0x28, 0xe5, 0x6f, 0x44,
+	     0x30, 0x6d, 0x0c, 0xc1, 0x3e, 0xe6, 0x00, 0x2c, 0xc3, 0x11,
+	     0xe1, 0x43, 0xf6, 0x54, 0xaa, 0x23, 0xe9, 0x21, 0xe4, 0x13,
+	     0x40, 0xa3, 0x9b, 0xcc, 0xcc, 0x0b, 0x59, 0x47, 0xca, 0x74,
+	     0x16, 0x9c, 0x05, 0xb6, 0x09, 0x4a, 0x82, 0x43, 0x1f, 0xb5,
+	     0x11, 0x9e, 0x55, 0x82, 0xc0, 0x07, 0xc9, 0xd5, 0x2c, 0x60,
+	     0xf5, 0xa1, 0x18, 0x91, 0x91, 0x62, 0xf7, 0xd8, 0x26, 0x11,
+	     0xa5, 0xb5, 0x0d, 0x8d, 0x85, 0x9e, 0x99, 0xdf, 0x48, 0x32,
+	     0x8d, 0x81, 0xa3, 0x14, 0x2c, 0xbe, 0x14, 0x32, 0xf4, 0x32,
+	     0xdf, 0xb6, 0xb9, 0x56, 0x84, 0xad, 0xc3, 0x67, 0x15, 0x43,
+	     0x22, 0x3d, 0x5d, 0x4e, 0x92, 0x37, 0x8d, 0xb6, 0x5b, 0x2a,
+	     0x2d, 0xc4, 0xb5, 0xa7, 0x59, 0x2b, 0x6c, 0x2b, 0xf6, 0x76,
+	     0x05, 0x90, 0xb3, 0x5a, 0x75, 0x8c, 0xd0, 0x55, 0xa9, 0x52,
+	     0x3d, 0xd4, 0x5f, 0xfa, 0x8f, 0x95, 0x96, 0xb4, 0xc9, 0x26,
+	     0xe2, 0xc4, 0x84, 0xc0, 0x7a, 0x36, 0x48, 0xa2, 0xf6, 0x61,
+	     0xd7, 0x03, 0x4b, 0x8e, 0x2b, 0xc2, 0x5b, 0xc2, 0x1e, 0xb0,
+	     0xb2, 0xc0, 0x35, 0x0d, 0x68, 0xc6, 0x41, 0xb9, 0xa6, 0x62,
+	     0x4c, 0xd6, 0xc3, 0xcd, 0xd1, 0x11, 0xd6, 0x1e, 0x5c, 0x2b,
+	     0xd9, 0x4b, 0x0d, 0xa5, 0xaf, 0xeb, 0x3d, 0x28, 0x12, 0x8b,
+	     0xbe, 0x21, 0x9b, 0x44, 0x6d, 0xec, 0xb8, 0x0b, 0x9c, 0xe6,
+	     0x45, 0xd1, 0xf3, 0xbc, 0xe4, 0xbf, 0x58, 0xd0, 0xca, 0x06,
+	     0xaa, 0x4b, 0x72, 0x0b, 0x7d, 0x0b, 0x5a, 0xc3, 0x7f, 0x88,
+	     0x59, 0xf2, 0xc8, 0x04, 0x4b, 0xc1, 0x9c, 0xe3, 0x4f, 0x48,
+	     0x82, 0x55, 0x62, 0x20, 0x91, 0x61, 0xdc, 0x83, 0x3e, 0x8e,
+	     0xdd, 0x4b, 0x68, 0x9e, 0x11, 0x4e, 0x7f, 0x15, 0x5d, 0x9b,
+	     0xa0, 0x91, 0x8e, 0x42, 0x11, 0xe6, 0xac, 0xd4, 0x15, 0x23,
+	     0xaa, 0xb1, 0x27, 0x61, 0x22, 0x7c, 0xb9, 0x06, 0xe9, 0x80,
+	     0xe6, 0xb7, 0x22, 0x58, 0x36, 0xc7, 0x6a, 0x60, 0xa5, 0x1a,
+	     0x94, 0x10, 0x5d, 0x42, 0x87, 0xb7, 0x39, 0x02, 0x98, 0x32,
+	     0x32, 0xeb, 0xb2, 0xbb, 0x93, 0xc5, 0x54, 0xcb, 0xa8, 0x4e,
+	     0x4e, 0x94, 0xa5, 0x01, 0x99, 0xf1, 0x43, 0xb9, 0x8c, 0x24,
+	     0x7d, 0x1d, 0xa3, 0xe0, 0x27, 0x15, 0x9a, 0xf1, 0x9a, 0xd2,
+	     0x0b, 0x3c, 0x10, 0x71, 0xfa, 0x21, 0x42, 0xa1, 0x12, 0x2a,
+	     0x45, 0x37, 0x67, 0x47, 0x00, 0xe7, 0x6b, 0xc6, 0x45, 0x5a,
+	     0x09, 0xd6, 0x4f, 0x4a, 0x95, 0x38, 0xba, 0x90, 0xd0, 0x9a,
+	     0xc0, 0xc8, 0xe0, 0xd1, 0x62, 0x42, 0x44, 0x32, 0x0b, 0x6e,
+	     0x6b, 0xab, 0xdc, 0x9c, 0x1b, 0x13, 0xfa, 0xa4, 0xbc, 0x14,
+	     0x3e, 0x28, 0x02, 0x6f, 0x2e, 0x85, 0x37, 0x00, 0x43, 0x1a,
+	     0xf3, 0x87, 0x74, 0x76, 0xc0, 0xcb, 0x20, 0x4b, 0x26, 0x90,
+	     0xa1, 0x4b, 0x0c, 0x1b, 0x03, 0xc1, 0xd2, 0x96, 0xb3, 0xa2,
+	     0x38, 0xe4, 0xec, 0x9a, 0x7e, 0x64, 0x04, 0xfd, 0x13, 0x53,
+	     0x2f, 0xb3, 0xe6, 0x59, 0xf4, 0xcf, 0xad, 0xaf, 0xac, 0x27,
+	     0x5a, 0x82, 0x23, 0x9a, 0x37, 0xe0, 0x81, 0x39, 0x85, 0xb2,
+	     0x42, 0x96, 0xc7, 0x4a, 0x7e, 0x19, 0x4d, 0x63, 0xd7, 0xfd,
+	     0xcf, 0x50, 0x32, 0xcb, 0x5c, 0x49, 0x19, 0x1c, 0x11, 0x48,
+	     0xd4, 0xcb, 0x9d, 0x0b, 0x07, 0x2c, 0x0a, 0x97, 0x18, 0x08,
+	     0x43, 0x40, 0x16, 0x63, 0x4e, 0xd1, 0x8d, 0xf5, 0x8a, 0xca,
+	     0x70, 0xb5, 0xf5, 0xc6, 0x04, 0x56, 0xf6, 0xa2, 0xd8, 0x0a,
+	     0x96, 0x39, 0xfd, 0xd8, 0xaa, 0x43, 0x6b, 0x31, 0x77, 0xb2,
+	     0x5b, 0x78, 0x25, 0x4e, 0x52, 0x72, 0xb2, 0xdb, 0x8a, 0x26,
+	     0xc5, 0x44, 0x71, 0x83, 0x53, 0x33, 0x36, 0x8d, 0x74, 0x2b,
+	     0x04, 0x0c, 0x32, 0x84, 0xdf, 0x6e, 0x9b, 0xf7, 0x7a, 0xcb,
+	     0x0b, 0xa4, 0x05, 0xc3, 0x2c, 0x7f, 0xc9, 0xec, 0x15, 0x55,
+	     0x05, 0xc0, 0x29, 0x0c, 0x50, 0x56, 0x14, 0xdb, 0xac, 0x15,
+	     0x03, 0x4a, 0x91, 0x0d, 0xb7, 0xf0, 0xeb, 0xd3, 0x1f, 0x9a,
+	     0x53, 0xaa, 0xd6, 0x5c, 0x90, 0x9e, 0x8c, 0xb2, 0x17, 0x2c,
+	     0xe2, 0xac, 0x99, 0x44, 0x59, 0xb6, 0xb4, 0x74, 0x92, 0x98,
+	     0x48, 0x9e, 0x35, 0x9a, 0x03, 0x73, 0xe5, 0x73, 0xf6, 0xc9,
+	     0xa8, 0x7c, 0x45, 0x78, 0x37, 0xde, 0x8c, 0x04, 0xe3, 0x0a,
+	     0xcf, 0xac, 0x54, 0x2b, 0x2c, 0xd8, 0xed, 0x0b, 0xd1, 0x3f,
+	     0xa7, 0xb0, 0xe4, 0x1a, 0x8d, 0x4a, 0x92, 0x65, 0xa9, 0x74,
+	     0x9e, 0xe0, 0x35, 0xd3, 0x84, 0x28, 0x85, 0x2b, 0xd0, 0x48,
+	     0xc8, 0x52, 0xc2, 0x5e, 0x00, 0x72, 0xa5, 0x1d, 0xf8, 0x57,
+	     0x50, 0x98, 0x93, 0x55, 0xde, 0xc1, 0x23, 0x45, 0x75, 0xe4,
+	     0x21, 0x76, 0xd1, 0x26, 0x4b, 0x4e, 0x1b, 0x78, 0x9c, 0x86,
+	     0x0c, 0xf5, 0x26, 0x5f, 0xf0, 0x20, 0x98, 0x8f, 0xb6, 0x87,
+	     0x60, 0x19, 0x6b, 0x66, 0xbf, 0x30, 0x42, 0x05, 0x42, 0xa9,
+	     0x78, 0x45, 0x4d, 0x36, 0x4f, 0xfb, 0x38, 0x45, 0x06, 0x20,
+	     0xab, 0xc3, 0x60, 0x0d, 0x72, 0x8e, 0xfd, 0x23, 0x2a, 0x60,
+	     0x8e, 0x92, 0xab, 0x60, 0x54, 0xd1, 0x38, 0xe6, 0x65, 0xb4,
+	     0x8d, 0xe1, 0x25, 0x68, 0x4a, 0x07, 0xbf, 0x8c, 0xcd, 0x69,
+	     0x2f, 0x2b, 0xf4, 0xf5, 0x0a, 0x16, 0x81, 0xbb, 0x44, 0x90,
+	     0x12, 0xad, 0x40, 0xda, 0x7f, 0xc8, 0xf7, 0xf7, 0xcc, 0xd8,
+	     0x9e, 0xa0, 0x15, 0xdf, 0x7b, 0x98, 0x99, 0x9c, 0x09, 0x83,
+	     0xe3, 0x23, 0x47, 0x94, 0x42, 0x14, 0x32, 0x50, 0x4a, 0x22,
+	     0xce, 0x3d, 0x8f, 0x1b, 0x95, 0x08, 0xfd, 0x61, 0xc2, 0x50,
+	     0x80, 0xc8, 0x40, 0x4c, 0x86, 0x39, 0x04, 0xeb, 0x60, 0x56,
+	     0x51, 0xa6, 0xd5, 0xc9, 0x9a, 0x24, 0xaa, 0x98, 0x4e, 0x1c,
+	     0x31, 0x45, 0x4e, 0x5e, 0x61, 0xd1, 0x09, 0x23, 0xab, 0xcb,
+	     0xca, 0xe0, 0xd9, 0x7c, 0x2a, 0x44, 0x0a, 0xe5, 0x54, 0x18,
+	     0x85, 0x30, 0x41, 0x38, 0xb1, 0xaf, 0xc1, 0xca, 0xe8, 0x97,
+	     0x58, 0xb1, 0x5e, 0x10, 0xb6, 0xe9, 0x1f, 0x03, 0x58, 0x74,
+	     0x0a, 0xee, 0xfa, 0x08, 0x8b, 0x04, 0xca, 0x29, 0x5f, 0xa1,
+	     0x2e, 0x03, 0x96, 0xcb, 0x99, 0xcd, 0x50, 0xfd, 0x0a, 0x18,
+	     0x35, 0x0a, 0xb5, 0x58, 0xd0, 0x12, 0x9a, 0xa8, 0x49, 0x43,
+	     0x87, 0x0d, 0xf1, 0xd2, 0x1e, 0x36, 0xc7, 0x41, 0x82, 0xdd,
+	     0xac, 0xe4, 0xb4, 0x5e, 0x23, 0xf4, 0x20, 0x12, 0x19, 0x70,
+	     0xcf, 0x1b, 0x9e, 0x09, 0xb3, 0xe4, 0x07, 0x12, 0x6b, 0x99,
+	     0x56, 0xb6, 0xad, 0x08, 0x64, 0x14, 0x09, 0x09, 0x20, 0x74,
+	     0x4a, 0xbd, 0x44, 0xb7, 0x49, 0xbc, 0x98, 0xd4, 0x2e, 0x5b,
+	     0x1e, 0x18, 0x46, 0x25, 0x72, 0x06, 0x31, 0x68, 0x25, 0x91,
+	     0x22, 0x40, 0x9d, 0xd6, 0x59, 0x47, 0xb2, 0x96, 0x91, 0x6f,
+	     0xc2, 0xe0, 0x03, 0x7f, 0x5c, 0x19, 0xe4, 0x61, 0x12, 0x12,
+	     0x90, 0x21, 0x59, 0x00, 0x22, 0xc4, 0xb3, 0x20, 0x7e, 0x21,
+	     0x26, 0x2a, 0x48, 0x4e, 0x46, 0xf2, 0x8a, 0x9a, 0xdb, 0x26,
+	     0xc9, 0x55, 0xc5, 0x09, 0xb9, 0x29, 0x70, 0x1f, 0x13, 0x94,
+	     0xda, 0xab, 0x66, 0x66, 0x00, 0x72, 0xae, 0x07, 0x9b, 0x9c,
+	     0x70, 0x61, 0x35, 0xf8, 0x1d, 0xd7, 0x27, 0x03, 0x1f, 0x3a,
+	     0xc9, 0x77, 0xd8, 0xbf, 0xd2, 0xfe, 0x0d, 0x2b, 0x84, 0x3d,
+	     0x1a, 0xb1, 0xcb, 0x14, 0x55, 0x28, 0x56, 0x89, 0x80, 0x6b,
+	     0x4b, 0x08, 0x55, 0x96, 0x58, 0xe1, 0x25, 0xb4, 0xde, 0xe4,
+	     0xf0, 0xb2, 0xe2, 0xdc, 0x44, 0x35, 0x09, 0xa0, 0x4a, 0x66,
+	     0xdc, 0x3a, 0xd8, 0x1e, 0xcc, 0xd1, 0xda, 0x87, 0xbc, 0x8b,
+	     0xef, 0x91, 0xa6, 0x8e, 0x1f, 0x3c, 0xae, 0x85, 0x58, 0x37,
+	     0x88, 0x2d, 0xf6, 0x36, 0x3b, 0x49, 0xa8, 0x05, 0x91, 0x10,
+	     0xcc, 0x22, 0xd5, 0x0d, 0xab, 0xf1, 0xb9, 0xa0, 0x3c, 0x58,
+	     0x1f, 0xf1, 0x33, 0xd5, 0x47, 0x35, 0x20, 0xc9, 0x0e, 0xbc,
+	     0xa4, 0x05, 0x57, 0x4f, 0xa8, 0x5a, 0xfa, 0x4a, 0x7e, 0x65,
+	     0xef, 0x4a, 0xf5, 0x5f, 0x7f, 0x69, 0x56, 0xf4, 0x29, 0x24,
+	     0xa2, 0x2c, 0xad, 0x76, 0x5e, 0xe5, 0x0e, 0x14, 0xe2, 0x40,
+	     0xc7, 0x03, 0x35, 0xc6, 0x22, 0x76, 0x01, 0x8b, 0x7e, 0x37,
+	     0xa2, 0x8e, 0x79, 0x1b, 0x04, 0xf3, 0x0c, 0x97, 0x6f, 0xe4,
+	     0x9d, 0x44, 0xf4, 0x5e, 0x23, 0xd3, 0x22, 0x8c, 0xa3, 0xdb,
+	     0xc7, 0x19, 0x42, 0x8a, 0xa1, 0x4a, 0x3c, 0x67, 0x0a, 0x47,
+	     0xcc, 0x49, 0xf5, 0xca, 0xbd, 0xaf, 0x64, 0x55, 0xac, 0xda,
+	     0x13, 0xee, 0x26, 0xb7, 0x33, 0x53, 0xc5, 0xdd, 0x21, 0x37,
+	     0x88, 0x08, 0x40, 0x6f, 0x7b, 0x7c, 0x90, 0x72, 0xc2, 0x4a,
+	     0xda, 0xb2, 0x60, 0x45, 0xa2, 0xd2, 0x62, 0xb7, 0x16, 0x90,
+	     0xc0, 0x11, 0x55, 0xe4, 0x3c, 0xb1, 0x22, 0xb6, 0x09, 0xf5,
+	     0x6a, 0xdc, 0xc0, 0x9b, 0x42, 0x56, 0xa2, 0x1e, 0xcd, 0x43,
+	     0x24, 0xa3, 0x4e, 0x8b, 0x8e, 0xc8, 0x4f, 0xc4, 0x1a, 0x14,
+	     0xd7, 0x41, 0xdd, 0x7e, 0x41, 0x5d, 0x91, 0x59, 0xc9, 0x61,
+	     0xe0, 0xcf, 0x80, 0x3c, 0x28, 0xe8, 0x59, 0xab, 0xc2, 0x3f,
+	     0xce, 0x1f, 0xb3, 0x88, 0x42, 0xcf, 0x88, 0xe6, 0xf9, 0xea,
+	     0x9a, 0xf1, 0xfc, 0x8e, 0x48, 0x5e, 0xbc, 0x87, 0x41, 0x81,
+	     0xc4, 0x71, 0x35, 0x1c, 0x19, 0xa2, 0x21, 0xce, 0x54, 0x1f,
+	     0x61, 0x91, 0x13, 0x4d, 0x8f, 0xab, 0x31, 0x07, 0xab, 0x69,
+	     0xc6, 0xc4, 0x0a, 0x1c, 0x1b, 0x66, 0xcc, 0xd4, 0xce, 0x02,
+	     0x6f, 0x78, 0x54, 0xc9, 0x88, 0xe9, 0x59, 0x2b, 0x21, 0x9a,
+	     0x4f, 0x37, 0x34, 0x43, 0x68, 0x40, 0x86, 0x32, 0xf4, 0x98,
+	     0x87, 0x34, 0x69, 0x9e, 0x45, 0xa3, 0x21, 0x45, 0x9f, 0xcc,
+	     0xa2, 0x0e, 0x21, 0xd3, 0xeb, 0x0f, 0xfc, 0xe8, 0x5e, 0x63,
+	     0xfc, 0x36, 0x3e, 0x50, 0xf5, 0x65, 0xf1, 0xf0, 0x39, 0x73,
+	     0xea, 0xcd, 0xe7, 0x7a, 0x01, 0x33, 0x80, 0x66, 0x51, 0xae,
+	     0x07, 0x55, 0x67, 0x7b, 0x01, 0x24, 0x02, 0x7f, 0xf2, 0x83,
+	     0x08, 0x97, 0x1b, 0x20, 0xb7, 0x8b, 0xac, 0x70, 0x4d, 0x00,
+	     0x37, 0x00, 0x0a, 0x52, 0x56, 0xa3, 0xc9, 0xc6, 0xcb, 0x32,
+	     0xce, 0xba, 0x96, 0x8d, 0x21, 0x45, 0xf5, 0xd4, 0x04, 0x76,
+	     0xa3, 0x15, 0x02, 0x05, 0xf1, 0x2c, 0x30, 0x23, 0x17, 0xec,
+	     0x46, 0x28, 0x50, 0xd2, 0x7a, 0x88, 0x08, 0x42, 0x44, 0x68,
+	     0xe3, 0xb4, 0x74, 0x5c, 0x19, 0x34, 0xd6, 0x50, 0xf4, 0x70,
+	     0xcc, 0xb6, 0xc1, 0x57, 0xb9, 0xcf, 0x15, 0xd5, 0xe7, 0x71,
+	     0x02, 0xd8, 0x60, 0x8c, 0x64, 0x7a, 0x41, 0xb4, 0xcf, 0x38,
+	     0xcc, 0x51, 0xe8, 0xa3, 0x82, 0xbe, 0x30, 0x89, 0x4a, 0x85,
+	     0x40, 0x3e, 0x73, 0xc5, 0x11, 0x64, 0xf5, 0xf5, 0x7c, 0x01,
+	     0x36, 0x00, 0x5a, 0x30, 0x3f, 0x09, 0xc9, 0xd5, 0x50, 0x99,
+	     0x21, 0x6e, 0xf3, 0x06, 0xd4, 0x72, 0xd0, 0xed, 0x14, 0x18,
+	     0xdd, 0x93, 0x81, 0x13, 0x84, 0xa6, 0xe8, 0xe3, 0x4c, 0x48,
+	     0x11, 0x62, 0x98, 0x0e, 0x33, 0xd3, 0x44, 0x89, 0xd4, 0x72,
+	     0x08, 0xeb, 0x18, 0x8b, 0x28, 0x4f, 0x46, 0xca, 0x22, 0x47,
+	     0x99, 0xa9, 0x7c, 0xdf, 0x44, 0x10, 0x5d, 0xe6, 0xe0, 0xdc,
+	     0x26, 0x52, 0x29, 0xa7, 0x53, 0xb5, 0x1e, 0x89, 0xca, 0xda,
+	     0x6c, 0x83, 0x60, 0x78, 0xec, 0xbe, 0x89, 0x3b, 0xfa, 0x6b,
+	     0x2d, 0x2b, 0xcb, 0x4b, 0x44, 0x71, 0x58, 0xf8, 0x05, 0x6c,
+	     0x0a, 0x69, 0x59, 0x1c, 0x7b, 0xc6, 0x86, 0x1a, 0xd7, 0x3e,
+	     0xf2, 0x75, 0x57, 0xc8, 0xf2, 0xd1, 0x11, 0x62, 0xd6, 0x41,
+	     0xbf, 0x86, 0x18, 0x8e, 0x20, 0xaa, 0xe4, 0xd6, 0x16, 0x31,
+	     0xfb, 0x79, 0x04, 0x7c, 0x16, 0x3d, 0x9b, 0x31, 0xa5, 0xd8,
+	     0x0f, 0x89, 0x98, 0xa7, 0x00, 0x8c, 0x05, 0x1c, 0xbe, 0x40,
+	     0xf1, 0xa2, 0x7e, 0x47, 0x75, 0x6a, 0xa3, 0x66, 0x9a, 0x30,
+	     0xe7, 0x61, 0xb7, 0xd2, 0x90, 0xae, 0xc0, 0xa5, 0x93, 0xd4,
+	     0x49, 0x2d, 0x91, 0xc8, 0xbc, 0xaa, 0x74, 0x25, 0x5e, 0x0b,
+	     0xcd, 0x48, 0x2e, 0x8c, 0x6b, 0xa3, 0x6d, 0x59, 0x2d, 0xb4,
+	     0xb6, 0x5c, 0x18, 0x59, 0x4d, 0x1f, 0xc9, 0xb9, 0xd9, 0xfa,
+	     0xf2, 0x44, 0x62, 0x30, 0x14, 0x3b, 0x2c, 0x15, 0xc1, 0x5a,
+	     0xb5, 0x84, 0x98, 0x0b, 0xbe, 0xcf, 0x0b, 0x11, 0xa8, 0xf9,
+	     0x70, 0xea, 0x22, 0xeb, 0x01, 0x2e, 0x24, 0x8f, 0xc9, 0xcc,
+	     0xcd, 0x56, 0x65, 0x22, 0x39, 0x9a, 0x91, 0xfd, 0xd2, 0x40,
+	     0xf8, 0x9d, 0x80, 0x82, 0x34, 0xc1, 0xed, 0xa1, 0x58, 0x6c,
+	     0x70, 0x65, 0x58, 0x06, 0x30, 0x88, 0x1f, 0xd1, 0x41, 0xa6,
+	     0x89, 0x9f, 0x83, 0xa0, 0xf0, 0x55, 0x0e, 0x89, 0x1a, 0x24,
+	     0xa9, 0xa2, 0x90, 0x1f, 0xe1, 0x6e, 0x9e, 0xe3, 0x23, 0xe4,
+	     0xff, 0xbd, 0xb9, 0x3e, 0x84, 0xd3, 0x9a, 0x7c, 0xc9, 0x08,
+	     0x0e, 0xdb, 0x63, 0x40, 0x54, 0xfd, 0xac, 0x7a, 0x84, 0x48,
+	     0xde, 0xca, 0x72, 0x40, 0xf2, 0x04, 0xed, 0xe0, 0x80, 0x2b,
+	     0x64, 0x9a, 0xcf, 0x0e, 0x45, 0x91, 0x2e, 0x5d, 0x13, 0xf5,
+	     0xac, 0x25, 0x36, 0x58, 0x63, 0xac, 0x90, 0x50, 0x0c, 0x98,
+	     0x60, 0x1d, 0xb9, 0x1d, 0x08, 0x82, 0xf0, 0xd8, 0xb9, 0x62,
+	     0x2d, 0xcc, 0x2e, 0x74, 0x66, 0x26, 0xae, 0xfe, 0x16, 0x68,
+	     0x0e, 0x41, 0xf6, 0x8e, 0xe2, 0x9c, 0x75, 0xc6, 0xc8, 0x71,
+	     0xdd, 0x39, 0x59, 0x02, 0x58, 0x73, 0x34, 0xf8, 0xfc, 0x49,
+	     0xf5, 0x68, 0xf9, 0x9e, 0x06, 0xca, 0x0e, 0xf4, 0x61, 0xcd,
+	     0xd2, 0x89, 0xb0, 0x45, 0xba, 0x49, 0xa6, 0x90, 0x98, 0x19,
+	     0x58, 0xbf, 0x5e, 0x8c, 0xe9, 0xe6, 0x1c, 0x22, 0x84, 0x9c,
+	     0xdc, 0x2c, 0x0a, 0x9a, 0x60, 0x3e, 0x01, 0x85, 0x60, 0x2b,
+	     0xe9, 0x86, 0xf0, 0x6f, 0x7c, 0x63, 0x59, 0x65, 0x38, 0x64,
+	     0x9e, 0xa5, 0x5c, 0x23, 0x23, 0x33, 0x17, 0xa4, 0x05, 0xd2,
+	     0xea, 0x4d, 0xd3, 0xfc, 0x8e, 0xce, 0x8c, 0x99, 0x8e, 0x69,
+	     0xef, 0x4b, 0xd3, 0x73, 0x6c, 0xa0, 0xc0, 0xa0, 0x4c, 0x49,
+	     0xce, 0x3c, 0x1f, 0x1a, 0xb8, 0x65, 0x75, 0x13, 0xe5, 0x38,
+	     0x0d, 0xa5, 0x25, 0xdc, 0x32, 0xfa, 0x24, 0xaa, 0xcb, 0x8b,
+	     0x2a, 0x60, 0xc9, 0xb6, 0x93, 0xb6, 0x85, 0x5c, 0x50, 0x44,
+	     0x73, 0x1d, 0xfe, 0x87, 0xce, 0x2d, 0x85, 0x02, 0xb0, 0x44,
+	     0x31, 0x12, 0x02, 0xf0, 0x90, 0xdd, 0xb2, 0xc3, 0xe4, 0x59,
+	     0x27, 0xfe, 0xc8, 0xcc, 0x59, 0xce, 0xcc, 0x51, 0xa8, 0x32,
+	     0x45, 0x21, 0x75, 0xc0, 0x91, 0x50, 0xde, 0x58, 0xe2, 0x78,
+	     0x2c, 0x49, 0x08, 0xe0, 0x5a, 0xc4, 0x16, 0xb7, 0x52, 0x7a,
+	     0xe6, 0x18, 0xe6, 0xe1, 0x13, 0xd4, 0xcd, 0xd8, 0x24, 0x8f,
+	     0x33, 0xa9, 0x63, 0x48, 0x0c, 0x26, 0x45, 0x46, 0x3a, 0x24,
+	     0xe4, 0xd9, 0x2b, 0x8a, 0x2e, 0x95, 0x32, 0x78, 0x81, 0xe2,
+	     0xa1, 0x06, 0xa5, 0x0d, 0x31, 0x63, 0x90, 0x4a, 0x14, 0x6b,
+	     0x4f, 0xad, 0xea, 0xc6, 0xdf, 0xcb, 0x04, 0xa4, 0xdf, 0xec,
+	     0x1a, 0x56, 0xfb, 0x00, 0x47, 0xd0, 0xac, 0x8b, 0x54, 0x17,
+	     0xc3, 0xd7, 0xe2, 0xca, 0xf8, 0x34, 0xc2, 0x00, 0x2d, 0x93,
+	     0x06, 0x03, 0xe0, 0xc8, 0xb5, 0xd2, 0x1f, 0x38, 0x3f, 0x98,
+	     0xed, 0xa5, 0x01, 0x2b, 0x5b, 0x0d, 0x2b, 0x10, 0x02, 0x35,
+	     0x12, 0x75, 0x01, 0xb8, 0x60, 0x75, 0x24, 0x06, 0x99, 0x50,
+	     0x96, 0x28, 0xaf, 0x18, 0x17, 0x50, 0x07, 0x98, 0x9d, 0x83,
+	     0x83, 0xc1, 0x98, 0xb0, 0x44, 0xde, 0x8a, 0xcc, 0xa5, 0x1f,
+	     0xf2, 0xdf, 0xa7, 0xb3, 0xb4, 0xee, 0x0c, 0x1f, 0xbf, 0x08,
+	     0x61, 0x8b, 0x52, 0xde, 0x5b, 0x40, 0x6a, 0x65, 0x8e, 0x1c,
+	     0xfd, 0xb9, 0x82, 0xd2, 0x49, 0xea, 0xcb, 0x5b, 0x96, 0xa9,
+	     0x8c, 0xa2, 0xf2, 0x11, 0x52, 0xa3, 0xcd, 0x52, 0xdc, 0x48,
+	     0xe3, 0x93, 0x25, 0xca, 0xd8, 0x71, 0xe1, 0x15, 0xaf, 0x93,
+	     0xe0, 0xc4, 0x1c, 0x7b, 0x09, 0xff, 0x9a, 0x26, 0x01, 0x5c,
+	     0xaa, 0x34, 0xc6, 0x6d, 0x24, 0x17, 0xb0, 0x28, 0x70, 0x99,
+	     0x5e, 0x3d, 0xb5, 0xd7, 0xb6, 0x64, 0x68, 0x91, 0xe7, 0x93,
+	     0xf6, 0xa5, 0x2a, 0x1a, 0x6b, 0x25, 0xc7, 0x6c, 0xe5, 0x32,
+	     0x63, 0xa5, 0x88, 0xc5, 0x9a, 0x65, 0xe1, 0xc1, 0xe4, 0x20,
+	     0x6d, 0x3d, 0x55, 0xc3, 0xac, 0x11, 0x9c, 0xd0, 0x62, 0xfc,
+	     0xe1, 0x58, 0x61, 0x9e, 0x75, 0x79, 0xc2, 0xe1, 0xa4, 0x27,
+	     0x41, 0x8c, 0xe3, 0x8c, 0xcb, 0xf6, 0x64, 0xc9, 0x38, 0x32,
+	     0x68, 0x9e, 0x57, 0xc9, 0x05, 0x27, 0xf7, 0xd2, 0x93, 0x11,
+	     0xb2, 0x00, 0x56, 0x26, 0x9b, 0x7e, 0xb1, 0xc7, 0x26, 0xeb,
+	     0x4d, 0xc5, 0x87, 0xc7, 0x9c, 0xe5, 0xf0, 0x0f, 0x9d, 0x03,
+	     0x26, 0x8e, 0xa8, 0xdb, 0xc6, 0xe4, 0x3b, 0xb9, 0xf6, 0x58,
+	     0xbf, 0x01, 0x22, 0x96, 0x88, 0x1f, 0x3b, 0x3a, 0xa4, 0x5e,
+	     0x12, 0x1b, 0x73, 0x01, 0x89, 0x41, 0x5c, 0x0a, 0xa1, 0x94,
+	     0x6f, 0xbe, 0xcb, 0x23, 0x8f, 0x10, 0x67, 0x30, 0xe7, 0x0a,
+	     0x90, 0x01, 0xfa, 0x4c, 0x3e, 0x50, 0x48, 0xdb, 0x54, 0xca,
+	     0xe6, 0x40, 0x38, 0x93, 0x30, 0x09, 0xee, 0xb5, 0xd2, 0x6b,
+	     0xfe, 0x86, 0x6e, 0x9f, 0x54, 0xc5, 0x56, 0x83, 0x17, 0xa9,
+	     0x54, 0x0e, 0x67, 0x60, 0x8c, 0x6c, 0x88, 0xe5, 0x64, 0xb3,
+	     0x41, 0x3f, 0x59, 0x26, 0xf2, 0xa4, 0xad, 0xac, 0x04, 0x24,
+	     0xfa, 0x94, 0xb6, 0x0f, 0x28, 0xd2, 0x14, 0x41, 0x94, 0x43,
+	     0xdf, 0xb8, 0x8e, 0x76, 0x2a, 0xc9, 0x8b, 0xf5, 0x52, 0xe2,
+	     0xec, 0x04, 0xe1, 0xf1, 0xc3, 0x38, 0x41, 0x41, 0xc6, 0x32,
+	     0xdc, 0x1d, 0x25, 0x45, 0x76, 0x83, 0xbe, 0x87, 0x08, 0x44,
+	     0x0d, 0x78, 0x2c, 0x33, 0x7f, 0xf6, 0x8b, 0xce, 0x23, 0x97,
+	     0x68, 0xc4, 0x26, 0xc0, 0xd1, 0x21, 0x41, 0x6a, 0xb2, 0x16,
+	     0xbe, 0xb1, 0x45, 0x87, 0x97, 0x49, 0x71, 0xc1, 0x3d, 0x80,
+	     0xbc, 0x30, 0x26, 0x04, 0x8a, 0x49, 0x27, 0xb5, 0x9e, 0x80,
+	     0x10, 0xb5, 0xe9, 0x89, 0x02, 0xbe, 0xe0, 0xa4, 0x0a, 0x82,
+	     0xc7, 0xc1, 0x48, 0x06, 0x01, 0xce, 0x8a, 0x24, 0x1d, 0x7a,
+	     0x3f, 0x58, 0x54, 0x0a, 0x90, 0x28, 0x8d, 0x92, 0x11, 0x84,
+	     0x0e, 0x44, 0xa2, 0xf5, 0x5b, 0x79, 0x61, 0xeb, 0x2a, 0x1d,
+	     0x56, 0x30, 0x01, 0xdd, 0x17, 0x60, 0x32, 0x77, 0x1b, 0xb0,
+	     0x31, 0x9e, 0x59, 0x6c, 0x7a, 0xd4, 0x31, 0x96, 0xd4, 0xdf,
+	     0x24, 0x93, 0x20, 0xbc, 0x84, 0x69, 0xb6, 0xc6, 0x94, 0x78,
+	     0x32, 0x45, 0xcf, 0x9d, 0x99, 0x0b, 0xfb, 0xc1, 0x3e, 0x1c,
+	     0x04, 0x5e, 0x01, 0x34, 0x19, 0x59, 0x2c, 0x26, 0x0f, 0x18,
+	     0xcd, 0x71, 0xc8, 0x49, 0xb2, 0x50, 0x58, 0x2c, 0xb5, 0x15,
+	     0xb8, 0x2b, 0x87, 0xe5, 0x7d, 0x8f, 0xba, 0xd0, 0xaa, 0x7a,
+	     0xcb, 0x59, 0x1c, 0x54, 0x6e, 0xab, 0xc3, 0x34, 0x95, 0xeb,
+	     0xb2, 0xeb, 0x91, 0x29, 0x94, 0x83, 0xed, 0x33, 0xb9, 0x21,
+	     0x4e, 0x3a, 0x24, 0xc8, 0x26, 0x2f, 0x18, 0x44, 0x79, 0x12,
+	     0x2a, 0x89, 0x8b, 0x96, 0x67, 0x7b, 0x37, 0xc6, 0xdd, 0xd5,
+	     0x47, 0x39, 0x08, 0x92, 0x69, 0x1c, 0x7a, 0xa1, 0xe8, 0x2f,
+	     0x51, 0x88, 0x03, 0x12, 0x2b, 0x90, 0xc6, 0xd3, 0xde, 0xd2,
+	     0x8b, 0xf9, 0x5d, 0x68, 0x59, 0xa2, 0xbc, 0x67, 0xd5, 0x1e,
+	     0xeb, 0x01, 0x94, 0x12, 0xf4, 0x81, 0x59, 0x1a, 0x9c, 0x7c,
+	     0x74, 0x04, 0xdc, 0x4e, 0xdb, 0xe2, 0xe3, 0xb6, 0x0a, 0xf0,
+	     0x96, 0x11, 0x23, 0x8c, 0x30, 0x1c, 0xb8, 0xd3, 0x1f, 0xc2,
+	     0xaf, 0x48, 0x50, 0xbe, 0x6a, 0x4f, 0x59, 0x58, 0xf8, 0x61,
+	     0x95, 0x22, 0x90, 0x1a, 0xb9, 0x2b, 0x4a, 0xa6, 0x72, 0x91,
+	     0xcf, 0xbd, 0x2d, 0x69, 0x76, 0x57, 0x10, 0xdc, 0x59, 0xa9,
+	     0x01, 0x27, 0xa2, 0x44, 0xcb, 0x46, 0x31, 0xab, 0xe0, 0x2c,
+	     0xc6, 0x1c, 0xdf, 0x5d, 0xb2, 0x8a, 0xc2, 0x97, 0x3d, 0x18,
+	     0x1f, 0xfe, 0x57, 0xa4, 0x64, 0x4d, 0x93, 0x2c, 0x93, 0x9f,
+	     0x80, 0xe2, 0x44, 0xe9, 0x53, 0xab, 0x71, 0x36, 0xff, 0x1d,
+	     0xec, 0xb6, 0xa1, 0xc8, 0x86, 0x01, 0xe0, 0x37, 0xd7, 0x50,
+	     0x72, 0x5d, 0x6a, 0x8e, 0x19, 0xf1, 0x12, 0xf0, 0x1d, 0x72,
+	     0x67, 0x67, 0xf3, 0xd1, 0x7c, 0x10, 0x96, 0xc5, 0x28, 0x41,
+	     0x17, 0x20, 0xe2, 0x8b, 0x1a, 0x69, 0xd6, 0xa2, 0xb7, 0xc0,
+	     0xa7, 0x55, 0xd7, 0x50, 0x60, 0x04, 0x28, 0xfb, 0x26, 0x05,
+	     0x8a, 0x7b, 0xc6, 0x00, 0x61, 0x27, 0x92, 0xe2, 0x2c, 0x7f,
+	     0x62, 0x84, 0x45, 0x48, 0x91, 0xeb, 0x8b, 0xa5, 0xd6, 0x48,
+	     0x45, 0x56, 0x7f, 0x3e, 0x23, 0xda, 0xca, 0x3c, 0xa2, 0x0c,
+	     0xc6, 0x7a, 0x27, 0x39, 0x92, 0x75, 0xc5, 0xbb, 0x20, 0x06,
+	     0xf4, 0x1b, 0xa7, 0x04, 0x35, 0x67, 0xfb, 0xd2, 0x6b, 0x18,
+	     0xd2, 0x90, 0xca, 0x04, 0x1b, 0x83, 0x2d, 0x86, 0x1a, 0x70,
+	     0x08, 0x5c, 0x62, 0xe6, 0xc3, 0x3d, 0xb2, 0x18, 0xaf, 0x22,
+	     0x19, 0xa0, 0x6f, 0xdd, 0x85, 0x41, 0x7d, 0x42, 0x90, 0xe3,
+	     0x72, 0xd5, 0x1e, 0x77, 0x96, 0x9d, 0x0f, 0xe7, 0xd1, 0x1b,
+	     0x62, 0x6c, 0xb8, 0xdb, 0x59, 0xdb, 0x18, 0x28, 0x30, 0x57,
+	     0xc4, 0x92, 0x31, 0x9f, 0x70, 0x33, 0x8a, 0x99, 0xdf, 0x9c,
+	     0xba, 0x8d, 0xf2, 0x44, 0x88, 0x8b, 0xc5, 0x62, 0xa5, 0x94,
+	     0x24, 0x7f, 0x96, 0x5c, 0x24, 0xbb, 0x19, 0xf1, 0x6a, 0x47,
+	     0xcd, 0x2d, 0x25, 0x53, 0xe1, 0xa6, 0xb6, 0x08, 0xbc, 0x7b,
+	     0xaa, 0x98, 0x19, 0xc6, 0x28, 0xd3, 0x32, 0x8e, 0x04, 0x52,
+	     0x43, 0x63, 0x71, 0xb4, 0x1a, 0x44, 0x79, 0x2c, 0x62, 0x59,
+	     0x94, 0x12, 0x4e, 0x4c, 0xb5, 0x45, 0x91, 0x53, 0x80, 0xe8,
+	     0xea, 0x95, 0x3c, 0x64, 0x22, 0x19, 0x2b, 0x8a, 0x9b, 0x8a,
+	     0x61, 0x63, 0xd6, 0x81, 0x64, 0x04, 0xdd, 0xee, 0x00, 0x65,
+	     0xd5, 0xb0, 0xdb, 0x06, 0x0f, 0xae, 0xcb, 0x15, 0x64, 0xe8,
+	     0x59, 0x71, 0xd9, 0x0e, 0x67, 0xa8, 0x2b, 0x22, 0x60, 0xb4,
+	     0x6f, 0x26, 0xf6, 0xdb, 0xc4, 0x47, 0xaa, 0xa7, 0xaa, 0x2a,
+	     0x5f, 0xc6, 0xa3, 0xe6, 0x18, 0xa4, 0x35, 0xd4, 0x26, 0xc0,
+	     0x44, 0xe0, 0xf9, 0x02, 0x23, 0x47, 0xb5, 0xaa, 0xc3, 0x27,
+	     0xe9, 0x7c, 0x83, 0xf1, 0x7a, 0x56, 0x1e, 0xb6, 0xe8, 0x0c,
+	     0x9a, 0x38, 0xd2, 0xe0, 0x11, 0x60, 0xac, 0x70, 0x4a, 0xbc,
+	     0x80, 0xb1, 0xd2, 0xd2, 0x28, 0xec, 0xab, 0x2d, 0x53, 0xc0,
+	     0x45, 0x62, 0xb2, 0x4f, 0xa3, 0xd6, 0xf8, 0xc3, 0x18, 0x11,
+	     0x3e, 0x84, 0x65, 0x4e, 0x12, 0x8f, 0xad, 0x05, 0x25, 0x5c,
+	     0xa4, 0xd5, 0xf9, 0xcc, 0x8b, 0x4d, 0x08, 0xce, 0x06, 0x64,
+	     0x6f, 0xfb, 0xe3, 0xb3, 0x0c, 0xf1, 0xc1, 0x27, 0xca, 0x33,
+	     0x27, 0x9f, 0xd9, 0x81, 0xc6, 0xca, 0x60, 0x23, 0xf2, 0x29,
+	     0x24, 0xc4, 0x17, 0xed, 0x7a, 0x0e, 0xa9, 0x33, 0x15, 0xb3,
+	     0x11, 0xd8, 0x06, 0x47, 0x83, 0xa5, 0xd0, 0x69, 0xdc, 0x7f,
+	     0x50, 0x20, 0x67, 0x97, 0x10, 0x8b, 0x1c, 0x45, 0xdd, 0x89,
+	     0x66, 0x85, 0xc6, 0xda, 0x38, 0xfa, 0xb4, 0x91, 0x54, 0xdc,
+	     0x07, 0x3b, 0x05, 0xd0, 0xf3, 0xaa, 0x61, 0x1f, 0x7d, 0x3a,
+	     0xe1, 0x4b, 0x17, 0x5c, 0xae, 0x2a, 0x3d, 0xb4, 0xc8, 0xb8,
+	     0x37, 0xa2, 0x12, 0xda, 0x59, 0x39, 0x12, 0x5f, 0x06, 0xcf,
+	     0x0c, 0x02, 0xf8, 0x11, 0xe1, 0xe5, 0x09, 0x04, 0x61, 0x26,
+	     0x3b, 0x18, 0xfd, 0x61, 0x06, 0xce, 0x0d, 0x25, 0xd5, 0x08,
+	     0x69, 0x36, 0x1f, 0xb7, 0x04, 0x72, 0x2c, 0xaf, 0xdf, 0x22,
+	     0x6b, 0x47, 0xb6, 0x4b, 0x08, 0x18, 0x31, 0x85, 0x36, 0x82,
+	     0x27, 0x4a, 0x85, 0x4f, 0xdc, 0xca, 0x46, 0x02, 0x0e, 0x13,
+	     0xd4, 0x08, 0xc0, 0x8a, 0x91, 0x41, 0x18, 0xd9, 0x52, 0xac,
+	     0x91, 0x1e, 0x10, 0x64, 0x42, 0x6c, 0x21, 0x5e, 0x50, 0x7d,
+	     0x01, 0xb0, 0xc0, 0xc5, 0x09, 0xec, 0xe2, 0x37, 0x25, 0x3c,
+	     0x9d, 0x8d, 0x33, 0xf1, 0x8d, 0x88, 0xc9, 0x8f, 0x99, 0x9e,
+	     0xae, 0x5a, 0xd3, 0x59, 0xb2, 0x8e, 0x80, 0xf9, 0x4c, 0x32,
+	     0x5b, 0x4b, 0x2b, 0x8e, 0xfd, 0xc9, 0x80, 0x11, 0xe0, 0xc9,
+	     0x49, 0xb4, 0x2f, 0x88, 0x8f, 0x2d, 0x95, 0x31, 0x42, 0x1d,
+	     0xec, 0xcb, 0xa6, 0x43, 0x23, 0x39, 0x55, 0x6d, 0xa6, 0x74,
+	     0xe3, 0xaa, 0x56, 0xc2, 0xb5, 0xe8, 0x4d, 0x94, 0xf3, 0x0a,
+	     0xda, 0xa1, 0x9e, 0x6c, 0x11, 0xef, 0x1f, 0x48, 0x9b, 0xd2,
+	     0x0c, 0x6c, 0x00, 0x6f, 0xda, 0x72, 0x70, 0x22, 0x64, 0x08,
+	     0x23, 0x9d, 0xbe, 0xd7, 0xd3, 0x0a, 0xf2, 0xa4, 0x51, 0xfb,
+	     0x94, 0x71, 0x9f, 0xce, 0x42, 0x1a, 0x37, 0x04, 0x8f, 0xff,
+	     0x4d, 0x69, 0x95, 0xc2, 0x80, 0xa1, 0xb1, 0x12, 0x2e, 0x74,
+	     0x47, 0x92, 0x3c, 0x98, 0x24, 0x6d, 0xa8, 0xb5, 0x59, 0xdb,
+	     0x17, 0xa4, 0x0b, 0x13, 0x14, 0xce, 0xa4, 0xc8, 0x98, 0x3a,
+	     0x87, 0xbe, 0xa2, 0xf5, 0xf2, 0x15, 0xf1, 0x05, 0xea, 0x14,
+	     0x89, 0x29, 0x5b, 0x1f, 0xa8, 0xe4, 0xb5, 0x22, 0x50, 0x89,
+	     0x8a, 0x4c, 0x1f, 0xa6, 0x88, 0x7b, 0xbd, 0xbe, 0x91, 0xef,
+	     0x65, 0x0f, 0xd2, 0xd4, 0x21, 0x8b, 0x14, 0xb7, 0x4a, 0x9b,
+	     0x11, 0x33, 0x54, 0x98, 0x98, 0x03, 0xa9, 0x36, 0xb3, 0xc0,
+	     0xc4, 0x74, 0x08, 0xcb, 0x1f, 0x2b, 0xc8, 0xaa, 0x8b, 0x89,
+	     0x10, 0x06, 0xb4, 0xcd, 0x68, 0xd7, 0x70, 0x1a, 0x03, 0x29,
+	     0xc4, 0x18, 0x14, 0x5f, 0x32, 0xa3, 0xf1, 0x55, 0xb6, 0x7a,
+	     0xc9, 0xac, 0xfc, 0x22, 0x04, 0xb7, 0xb8, 0x07, 0x4c, 0x80,
+	     0x23, 0x59, 0xc2, 0x96, 0x11, 0xa0, 0x80, 0x88, 0x96, 0x10,
+	     0xfc, 0x3b, 0x3d, 0xa3, 0x5f, 0x8a, 0xe1, 0xf1, 0xb0, 0x6b,
+	     0x2d, 0xc6, 0xca, 0xac, 0x71, 0x0c, 0x07, 0xe9, 0x17, 0xfb,
+	     0x27, 0x4f, 0xc0, 0x0b, 0x58, 0xfa, 0x34, 0x34, 0x55, 0x07,
+	     0x8c, 0x0d, 0x5a, 0x90, 0xc5, 0x65, 0x12, 0x37, 0x00, 0xc0,
+	     0xa0, 0x30, 0x09, 0x5f, 0x2a, 0x78, 0x82, 0x2e, 0x1f, 0x43,
+	     0xa2, 0x02, 0xa1, 0x9e, 0x14, 0x53, 0xcd, 0x15, 0xaa, 0x22,
+	     0xa1, 0x1e, 0xf9, 0x0e, 0xd9, 0x6b, 0xdc, 0xe8, 0x68, 0x19,
+	     0xd9, 0xad, 0x30, 0x58, 0x2c, 0xe4, 0x93, 0x78, 0x58, 0xf1,
+	     0xae, 0x75, 0x88, 0x5a, 0xc1, 0x59, 0x95, 0xb9, 0x56, 0x47,
+	     0x76, 0x9d, 0xb8, 0x59, 0x7e, 0x07, 0x37, 0xd7, 0xe1, 0x59,
+	     0x40, 0xd4, 0xd1, 0x6e, 0x0d, 0xa3, 0x0d, 0x7a, 0x48, 0xf7,
+	     0xa5, 0x2a, 0x54, 0x4a, 0xb0, 0x4f, 0x64, 0x2c, 0x76, 0x98,
+	     0x0f, 0x93, 0x32, 0xd8, 0x39, 0x25, 0xc9, 0x60, 0x2f, 0x12,
+	     0xa6, 0x61, 0x37, 0xae, 0x4e, 0x9d, 0xa8, 0x30, 0x4e, 0xb9,
+	     0x49, 0xfe, 0x90, 0xf0, 0xc9, 0x75, 0xb0, 0xfc, 0x2a, 0x41,
+	     0x83, 0x99, 0x70, 0x81, 0x73, 0x63, 0xa9, 0x97, 0xde, 0x8a,
+	     0x65, 0x9a, 0x2d, 0x5a, 0x88, 0xee, 0x1c, 0x69, 0x0c, 0x96,
+	     0x6f, 0x82, 0xa9, 0x05, 0x38, 0x57, 0xc1, 0x91, 0x3c, 0x49,
+	     0xba, 0x27, 0x42, 0xcb, 0x92, 0x2d, 0x6d, 0xa0, 0xc7, 0x7c,
+	     0x70, 0x8a, 0xf4, 0xe4, 0x7b, 0xd2, 0x4b, 0xd2, 0x48, 0xf8,
+	     0x48, 0x43, 0x80, 0xbc, 0x8a, 0x03, 0x7a, 0x0f, 0x81, 0x4e,
+	     0xce, 0x83, 0x2d, 0x91, 0x34, 0x2e, 0xb8, 0xc5, 0x0a, 0x49,
+	     0x4d, 0x94, 0x68, 0x00, 0x7b, 0x40, 0x89, 0x64, 0x18, 0x8e,
+	     0x27, 0x51, 0x25, 0x78, 0xa2, 0xa9, 0x59, 0x6a, 0xa8, 0x3a,
+	     0x90, 0x8a, 0x8a, 0x04, 0xa5, 0x50, 0xf1, 0x94, 0x14, 0x73,
+	     0x4b, 0xa0, 0x00, 0x34, 0x53, 0xf2, 0xc8, 0x00, 0x25, 0x2a,
+	     0xee, 0x10, 0xe1, 0xd9, 0x49, 0x14, 0x86, 0x53, 0x3a, 0x13,
+	     0xc4, 0x87, 0xd8, 0x99, 0xff, 0x6c, 0x15, 0xf9, 0xa2, 0x31,
+	     0x79, 0x95, 0x48, 0x72, 0x98, 0x51, 0x0d, 0x55, 0x10, 0x67,
+	     0xa1, 0x47, 0xd7, 0xd3, 0x69, 0x2c, 0x0d, 0x98, 0x50, 0x2f,
+	     0x0a, 0xbe, 0x47, 0x40, 0xc5, 0xe7, 0x39, 0xe2, 0x29, 0xca,
+	     0x00, 0xec, 0x1d, 0x8f, 0x73, 0x55, 0xcd, 0x88, 0xc7, 0xd8,
+	     0x09, 0xa0, 0xf6, 0xc4, 0x88, 0x19, 0x0c, 0x0d, 0xd5, 0x85,
+	     0x35, 0x9d, 0xd7, 0x95, 0xa8, 0xe8, 0x96, 0x48, 0xd2, 0xdb,
+	     0xb3, 0xc0, 0x03, 0xef, 0x98, 0xc1, 0x81, 0x02, 0x96, 0x37,
+	     0x48, 0x4a, 0xb8, 0xef, 0x22, 0x18, 0x05, 0x32, 0xf7, 0x07,
+	     0x41, 0x8a, 0x2c, 0x17, 0xd3, 0xe8, 0xb9, 0x58, 0xdf, 0xd0,
+	     0xbf, 0x01, 0x61, 0x24, 0x89, 0x28, 0x08, 0x5b, 0xd2, 0x07,
+	     0xea, 0x75, 0x89, 0x04, 0x50, 0x5b, 0x26, 0xbc, 0x42, 0x70,
+	     0xf4, 0x2c, 0x5d, 0x98, 0xa0, 0xe9, 0x11, 0x73, 0x9d, 0xd2,
+	     0x50, 0xb0, 0xa9, 0x56, 0x31, 0x33, 0x2c, 0xd4, 0x4f, 0x7e,
+	     0xe2, 0x39, 0xc7, 0x88, 0xb9, 0x40, 0x95, 0x6d, 0xf8, 0x96,
+	     0x27, 0x1b, 0xf6, 0xa6, 0xa7, 0x61, 0xdb, 0x91, 0x9f, 0xd9,
+	     0x6a, 0xa9, 0xed, 0xf4, 0x51, 0xb6, 0x4a, 0xea, 0x01, 0x9e,
+	     0xaa, 0x91, 0xd5, 0x2c, 0x31, 0x7f, 0xd0, 0xcd, 0xf4, 0x39,
+	     0xb8, 0x95, 0x51, 0x1c, 0x9e, 0xae, 0xd1, 0xd6, 0xf8, 0x2b,
+	     0x43, 0x15, 0x11, 0x5c, 0x6d, 0x37, 0xa5, 0xa1, 0x1b, 0x8f,
+	     0x49, 0x6c, 0x30, 0x69, 0xbc, 0x6c, 0x48, 0x7c, 0x24, 0x39,
+	     0x82, 0x9f, 0x9b, 0xd0, 0x2b, 0xc2, 0x78, 0x08, 0x75, 0xa4,
+	     0xea, 0x75, 0x57, 0xfa, 0x30, 0x00, 0x43, 0x9b, 0x17, 0x8e,
+	     0x4c, 0x9a, 0xf7, 0xcb, 0xec, 0x70, 0xf8, 0x6f, 0xf0, 0x0e,
+	     0x84, 0x28, 0x3c, 0x61, 0x2a, 0xe8, 0x9f, 0xa1, 0x1d, 0xec,
+	     0x01, 0xf0, 0x5c, 0xd0, 0x55, 0x32, 0x82, 0x7e, 0x58, 0x89,
+	     0xa8, 0x4e, 0xa0, 0x5b, 0x33, 0x86, 0x70, 0x03, 0x36, 0x01,
+	     0x0a, 0xba, 0xfb, 0xc9, 0x5f, 0xd3, 0x28, 0x63, 0x1a, 0x22,
+	     0xbe, 0xfd, 0x3d, 0xea, 0x59, 0x0c, 0x3f, 0xed, 0xe5, 0x72,
+	     0x4d, 0x90, 0xb8, 0x45, 0xa0, 0x1b, 0x71, 0x9a, 0xbe, 0x15,
+	     0x5c, 0x4d, 0x9d, 0x87, 0x6a, 0xe3, 0x31, 0xb2, 0xe2, 0x0b,
+	     0x5e, 0xea, 0xc9, 0xa8, 0x74, 0x0a, 0xb2, 0xf3, 0x90, 0xa5,
+	     0x47, 0x7f, 0x27, 0xc3, 0x81, 0x9e, 0x85, 0x23, 0x95, 0x86,
+	     0x1b, 0xc7, 0x94, 0xa1, 0xe6, 0xc0, 0xe2, 0x67, 0x4e, 0xac,
+	     0x75, 0x48, 0x8a, 0x90, 0x27, 0x47, 0x9e, 0xe8, 0xd9, 0x05,
+	     0x63, 0x2f, 0x49, 0x60, 0xe1, 0x46, 0xa4, 0xc5, 0xfa, 0x37,
+	     0x9a, 0xa1, 0x31, 0x0f, 0xd6, 0xf2, 0xcc, 0x73, 0x7c, 0x10,
+	     0x03, 0x59, 0x05, 0x2c, 0x57, 0x03, 0xbe, 0x84, 0xcd, 0xfa,
+	     0xf0, 0xb4, 0x46, 0xa1, 0x80, 0x71, 0x11, 0xd7, 0x38, 0x59,
+	     0x68, 0xa1, 0xa6, 0x58, 0x26, 0x49, 0x8d, 0xb5, 0x36, 0x2c,
+	     0x7a, 0xf1, 0x0e, 0x74, 0x8e, 0xe2, 0x42, 0x24, 0x8e, 0x5b,
+	     0x4d, 0x59, 0x72, 0x0d, 0xe1, 0x31, 0x76, 0xee, 0xd0, 0x76,
+	     0xbb, 0x0d, 0x12, 0x89, 0x6b, 0x8e, 0xbd, 0x74, 0x79, 0x19,
+	     0xf2, 0x94, 0x35, 0x4c, 0x90, 0x11, 0x9f, 0xd7, 0x4f, 0x54,
+	     0xb2, 0x6e, 0x91, 0x6e, 0xab, 0xbd, 0xa9, 0x34, 0x4e, 0x28,
+	     0x44, 0x85, 0xe1, 0xc3, 0x84, 0xc5, 0xf5, 0x73, 0xee, 0x2a,
+	     0x49, 0x8e, 0xdb, 0xec, 0x08, 0x55, 0xb9, 0xf1, 0x24, 0x76,
+	     0x2f, 0x52, 0xa2, 0x76, 0x71, 0x9b, 0x40, 0x50, 0xb6, 0x43,
+	     0x48, 0x02, 0xb9, 0xc0, 0x94, 0x92, 0x31, 0xd4, 0x23, 0x7a,
+	     0x69, 0x48, 0x0f, 0xd0, 0x89, 0xf8, 0x29, 0xb5, 0x10, 0x4e,
+	     0x73, 0x62, 0xa8, 0xd1, 0xc1, 0x57, 0x35, 0x36, 0x67, 0x7a,
+	     0xef, 0x3e, 0xb7, 0x9d, 0x4a, 0xb3, 0xab, 0x30, 0x93, 0xfb,
+	     0xc3, 0xcd, 0x37, 0x0e, 0x2a, 0xfa, 0xbf, 0x67, 0xc7, 0x10,
+	     0x2a, 0xcf, 0x34, 0x9d, 0x41, 0xb6, 0x20, 0x83, 0x5c, 0x8e,
+	     0x80, 0xc9, 0x8f, 0x60, 0x86, 0x08, 0x47, 0x58, 0x44, 0x91,
+	     0x5e, 0xcd, 0x24, 0x9f, 0x7f, 0xa4, 0x49, 0x1d, 0xa4, 0x8d,
+	     0xeb, 0x7b, 0x54, 0x0f, 0x11, 0x74, 0xa1, 0xaa, 0x94, 0x7a,
+	     0x25, 0x93, 0x02, 0x01, 0x96, 0x65, 0x20, 0x28, 0xb2, 0x42,
+	     0x64, 0xa1, 0xf4, 0x0c, 0x27, 0x56, 0xc6, 0x09, 0x5c, 0x0b,
+	     0xef, 0x46, 0xa0, 0xe0, 0x40, 0x66, 0x2d, 0x2e, 0x83, 0x7a,
+	     0xc4, 0x1d, 0xe4, 0x08, 0x6c, 0xe7, 0xa0, 0x75, 0x70, 0xa4,
+	     0x6a, 0x36, 0x37, 0xb6, 0x8c, 0xc6, 0x94, 0xc3, 0x10, 0x56,
+	     0xca, 0xa3, 0x23, 0xb1, 0x6a, 0x53, 0x51, 0xec, 0xf8, 0x65,
+	     0x34, 0x00, 0xbc, 0xd5, 0x02, 0x52, 0xc9, 0x66, 0xfb, 0x00,
+	     0x69, 0x92, 0x3b, 0x14, 0x44, 0x3c, 0x11, 0xf2, 0x05, 0x83,
+	     0xeb, 0x5e, 0x99, 0x75, 0xfb, 0xd7, 0xb1, 0x68, 0x8a, 0x94,
+	     0xe6, 0x86, 0x68, 0x1a, 0x9a, 0xaa, 0x6f, 0xe3, 0x05, 0xa9,
+	     0xe5, 0x68, 0xba, 0x78, 0x09, 0x06, 0x9c, 0xdd, 0x58, 0xe1,
+	     0xc3, 0x0f, 0x55, 0xc4, 0x12, 0x28, 0xec, 0xd6, 0xfc, 0x49,
+	     0x57, 0x2f, 0x6a, 0x03, 0x27, 0x71, 0x84, 0x63, 0xde, 0x21,
+	     0xdd, 0x04, 0x16, 0x92, 0x43, 0x19, 0x0f, 0x0e, 0x47, 0x31,
+	     0x48, 0xc2, 0x42, 0x6a, 0x71, 0x09, 0x62, 0x33, 0xe3, 0x14,
+	     0x71, 0x34, 0xf9, 0x63, 0xcb, 0xcc, 0x54, 0x12, 0xb9, 0x48,
+	     0x29, 0x6e, 0xbe, 0xe8, 0x05, 0x4d, 0x05, 0x74, 0x25, 0xb3,
+	     0xe0, 0x53, 0x27, 0xc6, 0x32, 0x57, 0xa2, 0x20, 0x19, 0x2c,
+	     0xa5, 0x83, 0x65, 0xd3, 0xf2, 0xf2, 0x3f, 0x71, 0x74, 0x0a,
+	     0x49, 0x56, 0xde, 0x6e, 0x83, 0xea, 0x41, 0xab, 0xd6, 0x0b,
+	     0x60, 0xad, 0xe5, 0x71, 0xb1, 0x63, 0x40, 0x1f, 0x21, 0x94,
+	     0x3a, 0xbd, 0xea, 0x41, 0xba, 0x84, 0xb4, 0x69, 0x6b, 0x53,
+	     0x4e, 0xd2, 0x5a, 0x52, 0x1a, 0xe2, 0x07, 0x38, 0x0d, 0xd5,
+	     0x4d, 0xbd, 0x89, 0x89, 0x62, 0xd0, 0xd1, 0x4e, 0x52, 0x16,
+	     0x5b, 0xb1, 0x55, 0x99, 0xfb, 0xa1, 0x34, 0x29, 0x8e, 0x30,
+	     0xd9, 0x09, 0x3a, 0xb0, 0x67, 0x02, 0x01, 0x40, 0x97, 0xd7,
+	     0x44, 0xf2, 0xa1, 0x7d, 0x73, 0x1c, 0xac, 0xd8, 0x1a, 0x2b,
+	     0x57, 0x8c, 0x4d, 0xc3, 0xd0, 0xac, 0x8b, 0x84, 0xc6, 0x39,
+	     0x97, 0xd0, 0xe6, 0x88, 0x33, 0x53, 0x83, 0x05, 0x41, 0x38,
+	     0xc0, 0x32, 0x71, 0xf8, 0x7b, 0x67, 0x60, 0x99, 0x8a, 0x70,
+	     0xa7, 0xaf, 0xe0, 0x87, 0x47, 0x82, 0xfb, 0xd0, 0x2a, 0xc4,
+	     0xf2, 0x78, 0x17, 0x50, 0x34, 0x23, 0x2a, 0x0d, 0x20, 0xe9,
+	     0xd2, 0xa0, 0x28, 0x53, 0x59, 0x40, 0x6d, 0x2f, 0xa3, 0x33,
+	     0xd3, 0xa7, 0x96, 0x17, 0x7f, 0xd2, 0xa8, 0xe4, 0x68, 0xb3,
+	     0x4c, 0xe1, 0x4e, 0x3a, 0x85, 0x7f, 0x28, 0x92, 0x82, 0x9f,
+	     0xc9, 0x84, 0x30, 0xd3, 0x62, 0x74, 0x89, 0x69, 0x6e, 0x50,
+	     0x47, 0x94, 0xa1, 0x81, 0x07, 0xf2, 0x29, 0x68, 0x01, 0x31,
+	     0xf1, 0x6c, 0x30, 0x00, 0x3d, 0xf3, 0x2a, 0x3d, 0xca, 0x17,
+	     0xf3, 0x39, 0x01, 0x6d, 0x10, 0x31, 0x2a, 0x3f, 0xd6, 0x21,
+	     0x26, 0x93, 0xdb, 0x56, 0xf3, 0x8b, 0x98, 0xb4, 0x6a, 0x6c,
+	     0x3c, 0x85, 0x70, 0x82, 0x78, 0x68, 0x33, 0x0f, 0x85, 0xd4,
+	     0xa2, 0xd8, 0x15, 0x8b, 0x09, 0x1d, 0x68, 0x1d, 0xf5, 0x05,
+	     0x18, 0xbb, 0xd4, 0x8a, 0x2a, 0xa1, 0xbf, 0xb8, 0x47, 0x31,
+	     0x0d, 0xc6, 0x54, 0xdc, 0x23, 0x04, 0xb1, 0xb4, 0x99, 0xa6,
+	     0x8a, 0x02, 0x48, 0xf5, 0xc0, 0x74, 0xd1, 0xd8, 0x4e, 0x5b,
+	     0x38, 0x9b, 0x7f, 0x16, 0x2d, 0xe7, 0xbe, 0xc8, 0x14, 0x93,
+	     0xdc, 0x20, 0x30, 0xff, 0x1a, 0xcc, 0x4b, 0x41, 0x1a, 0xa6,
+	     0xa2, 0xac, 0x26, 0x87, 0x89, 0x63, 0x44, 0x49, 0x4a, 0x05,
+	     0xbf, 0x38, 0x55, 0x64, 0xf2, 0xe5, 0x8e, 0xe0, 0xaf, 0x23,
+	     0x34, 0x00, 0xa3, 0x4a, 0x47, 0x4d, 0x40, 0xaf, 0x15, 0x0e,
+	     0xe7, 0x4b, 0xf6, 0x4b, 0xeb, 0x99, 0xc8, 0xd0, 0x02, 0x79,
+	     0x21, 0x2c, 0xf2, 0x0e, 0xd7, 0x2e, 0x1a, 0x22, 0x02, 0xa0,
+	     0x56, 0xa0, 0x14, 0x79, 0x2c, 0xf8, 0xa5, 0x7a, 0xd8, 0x16,
+	     0xa5, 0xb8, 0xa2, 0x4c, 0x50, 0x58, 0x25, 0x0c, 0x5a, 0x4e,
+	     0x15, 0x01, 0x73, 0x26, 0x39, 0xab, 0x06, 0x39, 0xa3, 0x04,
+	     0x67, 0x05, 0xb1, 0xac, 0x7c, 0x0e, 0x32, 0xef, 0xc9, 0xa0,
+	     0x65, 0xc5, 0x64, 0x44, 0x49, 0xc4, 0xa4, 0x0a, 0x51, 0x43,
+	     0xc3, 0x0e, 0x55, 0x8f, 0xa8, 0x07, 0x5f, 0x99, 0x2f, 0x6b,
+	     0x6a, 0xed, 0x01, 0xd3, 0x0f, 0x2e, 0x1e, 0x4a, 0x44, 0x0d,
+	     0xb0, 0xf5, 0x81, 0x1f, 0x33, 0x66, 0x68, 0x80, 0x02, 0x0d,
+	     0x37, 0x22, 0x10, 0xc3, 0xd8, 0xed, 0x2a, 0x49, 0xc3, 0x9b,
+	     0x50, 0x90, 0xcd, 0x6a, 0x1e, 0x23, 0xb2, 0xe4, 0xd7, 0x48,
+	     0xc6, 0x04, 0xc1, 0xfc, 0x81, 0x0d, 0xb9, 0xb1, 0xe4, 0x4c,
+	     0xff, 0x05, 0x33, 0x9a, 0x99, 0x2c, 0x44, 0x86, 0xde, 0x8b,
+	     0xd9, 0xe8, 0xa2, 0x62, 0x42, 0x27, 0x4b, 0x81, 0xc5, 0xa3,
+	     0x48, 0x6c, 0xf2, 0x24, 0x1c, 0x06, 0x61, 0x21, 0x22, 0x12,
+	     0x5d, 0x2d, 0xf2, 0x50, 0xff, 0xad, 0x7e, 0x94, 0x30, 0x9b,
+	     0x35, 0x65, 0x4d, 0xfc, 0x32, 0x95, 0x0b, 0x7b, 0x00, 0x40,
+	     0xee, 0x09, 0xd6, 0x18, 0x84, 0xee, 0x1d, 0xd4, 0x6c, 0x94,
+	     0x09, 0xc3, 0xa9, 0xcc, 0xa6, 0xae, 0xf5, 0xa2, 0x69, 0x54,
+	     0x15, 0xc6, 0x4c, 0xd0, 0x23, 0xe5, 0x89, 0x8f, 0x8a, 0xaa,
+	     0xaa, 0xfe, 0xa8, 0xf1, 0x70, 0x54, 0x55, 0x9f, 0xbe, 0x30,
+	     0xe7, 0x24, 0x31, 0x48, 0xe3, 0x20, 0xb6, 0x94, 0x0f, 0xa2,
+	     0x1f, 0x25, 0x80, 0x20, 0x72, 0xe7, 0xbe, 0x37, 0x25, 0x3a,
+	     0x4f, 0xe2, 0xb8, 0x53, 0x3b, 0x2c, 0x58, 0x16, 0x87, 0x38,
+	     0xc7, 0x8a, 0xe1, 0xc9, 0x67, 0x4f, 0xa9, 0x85, 0xe8, 0x20,
+	     0x55, 0xd6, 0x39, 0x28, 0x40, 0x22, 0x04, 0x58, 0x0e, 0xbb,
+	     0x10, 0xb2, 0x69, 0xa9, 0x0b, 0x4e, 0xc9, 0x6c, 0xc0, 0x36,
+	     0xd5, 0x43, 0xfa, 0x42, 0xbd, 0x50, 0xa7, 0xa5, 0x04, 0x78,
+	     0xef, 0xd0, 0x15, 0xa7, 0x87, 0x92, 0xb9, 0x30, 0x9b, 0x65,
+	     0xe9, 0x33, 0xb7, 0x97, 0x33, 0xf5, 0xa5, 0x39, 0xbe, 0x73,
+	     0x73, 0x31, 0xf2, 0x86, 0x9f, 0xd0, 0xea, 0xe2, 0x08, 0x73,
+	     0xc8, 0x69, 0xa3, 0x30, 0x3b, 0xf1, 0x9c, 0xe4, 0xdd, 0xec,
+	     0xa6, 0xf4, 0xe3, 0x26, 0xe1, 0xb3, 0x34, 0x29, 0x2c, 0x91,
+	     0x17, 0x84, 0xec, 0xd2, 0xa4, 0x10, 0xc3, 0x27, 0x8f, 0x22,
+	     0x93, 0x00, 0x0e, 0x58, 0x58, 0x57, 0x93, 0x63, 0xa0, 0x1a,
+	     0x05, 0x7c, 0xb0, 0x0b, 0x9c, 0x35, 0xc8, 0xf5, 0x6a, 0x00,
+	     0xe5, 0xaa, 0x10, 0x95, 0x7b, 0x60, 0xa9, 0x93, 0x97, 0x00,
+	     0x7c, 0xd9, 0x18, 0x08, 0x9c, 0xcb, 0x18, 0xf5, 0xdb, 0x82,
+	     0xcf, 0x04, 0x20, 0x92, 0xdc, 0x44, 0x12, 0x46, 0x32, 0x58,
+	     0xf1, 0x37, 0xd6, 0x1a, 0xad, 0x26, 0x23, 0x60, 0x5b, 0x6c,
+	     0x01, 0xa6, 0x91, 0x4e, 0x22, 0xa9, 0xb1, 0xea, 0x02, 0x67,
+	     0x68, 0xbf, 0x70, 0x6d, 0x93, 0xd6, 0xad, 0x1b, 0x84, 0x2e,
+	     0xfc, 0x13, 0x56, 0x26, 0x89, 0xef, 0xab, 0x95, 0x72, 0x69,
+	     0xcb, 0x91, 0x6f, 0xae, 0x79, 0xe1, 0xc3, 0xd6, 0x01, 0x9a,
+	     0x4b, 0x85, 0x28, 0x9a, 0x6c, 0x43, 0x31, 0x0f, 0xe4, 0x70,
+	     0x48, 0x8a, 0xcb, 0xc0, 0x7c, 0x87, 0xb8, 0x32, 0xd2, 0xc8,
+	     0x61, 0xac, 0x5e, 0xf6, 0x60, 0xdf, 0xc3, 0x8f, 0xc7, 0x53,
+	     0x24, 0xda, 0x03, 0x05, 0x24, 0x20, 0xac, 0x37, 0x0e, 0x66,
+	     0x47, 0x25, 0x91, 0x08, 0x79, 0xee, 0xa6, 0x75, 0x22, 0x1c,
+	     0x98, 0xa0, 0x37, 0xb6, 0x49, 0x1d, 0x05, 0x05, 0x4e, 0x80,
+	     0xe9, 0x6b, 0xd8, 0x73, 0x1b, 0x4a, 0xe8, 0xd8, 0x9c, 0x72,
+	     0x30, 0x8a, 0xd3, 0x9b, 0xe5, 0x6d, 0xba, 0x88, 0x3d, 0xe0,
+	     0xd7, 0x50, 0xc6, 0xc4, 0x28, 0xaf, 0x19, 0x78, 0xdf, 0x4d,
+	     0xcc, 0x33, 0xa7, 0x8e, 0x29, 0x6f, 0x34, 0xa2, 0x16, 0x44,
+	     0xaf, 0x16, 0x0e, 0x05, 0xe1, 0x06, 0x55, 0x81, 0xd6, 0xc9,
+	     0x73, 0x41, 0x2c, 0xad, 0x51, 0xb1, 0xa1, 0xcc, 0xc5, 0xcf,
+	     0xe3, 0x28, 0x12, 0x06, 0xaa, 0xca, 0x14, 0x5c, 0x0c, 0x47,
+	     0xc4, 0x2b, 0xa2, 0xe4, 0x7c, 0x80, 0x6b, 0x71, 0x1b, 0xcb,
+	     0xfb, 0x2d, 0xc9, 0x32, 0x8a, 0x40, 0x20, 0x25, 0xdd, 0x4f,
+	     0xef, 0x37, 0x20, 0xea, 0x3b, 0x8b, 0x8c, 0xd3, 0xba, 0x96,
+	     0x5e, 0x91, 0x8f, 0x0e, 0x69, 0xa0, 0xf9, 0x37, 0xd6, 0x03,
+	     0x23, 0x9e, 0x2d, 0x1e, 0x37, 0x37, 0xa9, 0x89, 0x11, 0xef,
+	     0x05, 0x29, 0x34, 0x73, 0xf0, 0x09, 0x5a, 0x09, 0xa3, 0x78,
+	     0x11, 0xa2, 0x28, 0xdd, 0x39, 0x01, 0x13, 0xa6, 0x58, 0xb8,
+	     0x9a, 0xa1, 0x5c, 0x5c, 0x69, 0xab, 0x13, 0x9d, 0xc6, 0xd7,
+	     0x2a, 0x84, 0x54, 0xc5, 0x4b, 0x31, 0x32, 0x2a, 0xe4, 0x33,
+	     0x11, 0x85, 0x27, 0x0b, 0x6c, 0x29, 0x99, 0xa9, 0x38, 0xab,
+	     0xb3, 0xb0, 0xd4, 0x3c, 0x03, 0xde, 0x3f, 0x1f, 0x99, 0x29,
+	     0x86, 0xe2, 0x33, 0xf2, 0xd1, 0x24, 0x78, 0x7e, 0x40, 0x7b,
+	     0x5b, 0xa5, 0x6b, 0xc6, 0x21, 0x0f, 0x25, 0x74, 0x6e, 0xdb,
+	     0x70, 0xbd, 0xa9, 0xbe, 0x4c, 0xfd, 0xa0, 0x4e, 0x1a, 0xf3,
+	     0x01, 0x48, 0x95, 0x33, 0x9b, 0xaf, 0x05, 0xe0, 0x0e, 0x77,
+	     0x71, 0x46, 0xae, 0x47, 0xfc, 0x40, 0x5e, 0xf5, 0xd6, 0x43,
+	     0x77, 0x65, 0x13, 0x62, 0x2c, 0x9b, 0x02, 0x14, 0x43, 0x6e,
+	     0xa2, 0xfa, 0x07, 0x8d, 0xe0, 0x11, 0xc4, 0x8c, 0xd8, 0x4e,
+	     0x14, 0x2c, 0xbc, 0x9f, 0xaa, 0x23, 0x4e, 0x60, 0x42, 0x6a,
+	     0x49, 0xfd, 0xdf, 0x94, 0x96, 0xe9, 0x48, 0x3b, 0x1d, 0x6d,
+	     0xb0, 0x87, 0x40, 0xbe, 0x6a, 0x4a, 0x79, 0x9f, 0x3e, 0x3c,
+	     0xe2, 0xa0, 0xe6, 0x80, 0xa0, 0x64, 0x22, 0x56, 0xec, 0xd9,
+	     0xdc, 0xb9, 0xb3, 0xee, 0x0a, 0xb4, 0x17, 0x02, 0xce, 0xfb,
+	     0xcb, 0xfb, 0xe3, 0x3e, 0x21, 0x2a, 0x95, 0x23, 0x1c, 0x28,
+	     0x1e, 0xc6, 0x35, 0x56, 0x11, 0x29, 0x1c, 0x16, 0x22, 0xa0,
+	     0x1c, 0xf5, 0x49, 0x98, 0x85, 0x79, 0x41, 0x5f, 0x4d, 0x87,
+	     0xc0, 0x12, 0x54, 0x72, 0x41, 0xf3, 0x45, 0x2b, 0x5e, 0x14,
+	     0xb6, 0xbd, 0x9a, 0x1f, 0x8c, 0x4a, 0xa0, 0x93, 0xdd, 0x1c,
+	     0x3d, 0x65, 0xfa, 0xda, 0x76, 0x33, 0xa4, 0x28, 0x8f, 0xbe,
+	     0x67, 0xed, 0x84, 0x30, 0xba, 0xc5, 0xe4, 0x01, 0x27, 0x78,
+	     0x90, 0x9e, 0xd1, 0x41, 0x8f, 0xe9, 0xd3, 0x55, 0x79, 0x20,
+	     0x13, 0xd1, 0xc8, 0x00, 0x01, 0x76, 0xa3, 0xfb, 0x12, 0x0a,
+	     0x03, 0x83, 0x91, 0xdc, 0xd8, 0xde, 0x9d, 0x30, 0x29, 0x59,
+	     0x1e, 0x1e, 0x70, 0x5b, 0xa7, 0xca, 0xb2, 0x26, 0xc6, 0x63,
+	     0x6c, 0x4a, 0xbd, 0x9a, 0x27, 0x6e, 0x1a, 0x2d, 0x92, 0x9e,
+	     0xeb, 0xb0, 0x36, 0x7a, 0x8b, 0x6d, 0x46, 0x2c, 0x02, 0x4e,
+	     0x3f, 0xb7, 0x18, 0x83, 0xf6, 0x07, 0xb9, 0x87, 0x5a, 0xc0,
+	     0x49, 0x12, 0x6c, 0xa6, 0x3c, 0xdc, 0x23, 0x2a, 0xe1, 0x54,
+	     0xd0, 0xa8, 0x33, 0x43, 0x88, 0x80, 0x84, 0x79, 0x32, 0x43,
+	     0xbd, 0xc3, 0xcf, 0x0c, 0x83, 0x12, 0x7c, 0x52, 0xf0, 0xd0,
+	     0x6d, 0x2e, 0xba, 0xc0, 0x45, 0x1c, 0x1b, 0x01, 0x53, 0x77,
+	     0x87, 0x04, 0x02, 0x49, 0x94, 0xc7, 0x51, 0x19, 0x3a, 0x9a,
+	     0xef, 0x91, 0xa5, 0x1d, 0x1a, 0x93, 0x21, 0x37, 0xd2, 0x9a,
+	     0xfb, 0xcd, 0x2a, 0x2f, 0x65, 0xe0, 0x85, 0x6b, 0x0e, 0x6e,
+	     0x2a, 0x99, 0x73, 0xe0, 0x32, 0x4a, 0xbc, 0x90, 0x4e, 0x70,
+	     0x2f, 0xab, 0x8e, 0x11, 0x00, 0x2a, 0xc7, 0xd7, 0x72, 0x41,
+	     0x4d, 0x86, 0xb1, 0x9e, 0x5c, 0xb2, 0x23, 0x5f, 0x1b, 0x90,
+	     0x01, 0x35, 0x36, 0xb7, 0x21, 0xd9, 0x6c, 0xc3, 0xae, 0x1e,
+	     0x47, 0xae, 0x29, 0xcb, 0xfb, 0x90, 0x05, 0x70, 0x77, 0x61,
+	     0x63, 0x51, 0x0d, 0x27, 0x63, 0x7c, 0xc6, 0x3a, 0x63, 0xe7,
+	     0x09, 0x61, 0x12, 0x89, 0xe8, 0xf9, 0x45, 0xe3, 0xb4, 0x72,
+	     0x30, 0x3c, 0x43, 0x26, 0x68, 0x8a, 0x5c, 0xb8, 0x51, 0xfc,
+	     0xc1, 0xf4, 0x31, 0xdd, 0x10, 0xcc, 0xc4, 0xbc, 0x8c, 0x9f,
+	     0x4f, 0xf5, 0x54, 0xcf, 0x71, 0xe9, 0x5d, 0xf7, 0x16, 0x1e,
+	     0xd1, 0xc2, 0x51, 0xa6, 0x7a, 0xef, 0x60, 0x14, 0xd2, 0xd9,
+	     0x3c, 0x1e, 0xc5, 0x90, 0x39, 0xae, 0x89, 0x1c, 0x4e, 0xb5,
+	     0x21, 0xcf, 0x90, 0xcb, 0x1b, 0x2f, 0xb9, 0x09, 0x63, 0x0d,
+	     0xb7, 0x9e, 0xeb, 0x61, 0x7a, 0x52, 0xdc, 0x72, 0x3e, 0x09,
+	     0xe9, 0x81, 0x33, 0xf5, 0x79, 0x30, 0xac, 0x97, 0x9c, 0x0a,
+	     0x28, 0xec, 0xd3, 0x9a, 0x1b, 0x5b, 0x3e, 0x44, 0x26, 0x32,
+	     0xf1, 0x8f, 0x31, 0x05, 0xaf, 0x07, 0x80, 0xe5, 0xa5, 0xa1,
+	     0xbb, 0xe4, 0x64, 0x3c, 0x97, 0xa3, 0xbe, 0x88, 0x1c, 0x70,
+	     0x27, 0xe7, 0x06, 0x89, 0x3c, 0x63, 0x6c, 0x97, 0x3a, 0x6d,
+	     0xb1, 0x27, 0xd7, 0x16, 0x0f, 0x6d, 0x23, 0xa4, 0xc5, 0xd4,
+	     0x98, 0x59, 0x3f, 0x48, 0x81, 0x56, 0xc1, 0xff, 0x40, 0xf3,
+	     0x30, 0x6e, 0x71, 0x1f, 0x2c, 0xfd, 0xb1, 0xb9, 0x70, 0x85,
+	     0xcb, 0x27, 0x11, 0x03, 0x58, 0x4f, 0x22, 0x40, 0xc6, 0xf9,
+	     0x72, 0xc9, 0xc2, 0xc0, 0x75, 0x66, 0xa8, 0x56, 0xa4, 0xd0,
+	     0x4f, 0xc1, 0x64, 0x02, 0x4c, 0x19, 0x99, 0x14, 0x25, 0x4e,
+	     0x0b, 0xa6, 0x84, 0x0c, 0xa4, 0xf2, 0x49, 0x25, 0x1c, 0xeb,
+	     0x27, 0x75, 0x15, 0x83, 0x84, 0x1e, 0x8e, 0xa0, 0x46, 0x5d,
+	     0x87, 0x95, 0xe2, 0x18, 0x79, 0x1c, 0x34, 0x12, 0xa7, 0x14,
+	     0x21, 0xbc, 0x78, 0x82, 0x0d, 0x0a, 0xdf, 0xb5, 0x88, 0x2b,
+	     0x36, 0xc4, 0x74, 0x28, 0x72, 0x99, 0xae, 0x5b, 0x4d, 0x03,
+	     0x8c, 0x76, 0xc8, 0x43, 0x0a, 0xa8, 0x9c, 0xd7, 0xa2, 0x14,
+	     0xcf, 0x92, 0xbf, 0xa0, 0x9f, 0x8e, 0x5b, 0x21, 0x11, 0x39,
+	     0x6e, 0xd2, 0x30, 0x2a, 0x15, 0x4c, 0xca, 0x72, 0x63, 0xba,
+	     0xb1, 0xb5, 0x76, 0x9b, 0xd2, 0x1b, 0x40, 0x46, 0x5c, 0x75,
+	     0x55, 0xa9, 0x73, 0xde, 0x27, 0xd1, 0x3a, 0xf7, 0x68, 0x48,
+	     0xb1, 0x4d, 0xb5, 0x3a, 0x7f, 0x9d, 0x0d, 0x56, 0x06, 0x38,
+	     0xc3, 0xc2, 0x69, 0x0d, 0x93, 0x37, 0xe5, 0xe0, 0x66, 0x61,
+	     0x70, 0x93, 0x4c, 0x51, 0x44, 0x8c, 0xa2, 0x17, 0x10, 0x49,
+	     0xef, 0x85, 0x07, 0x8b, 0x98, 0x03, 0x3f, 0xd1, 0xc4, 0x71,
+	     0x0c, 0xf1, 0x85, 0x9c, 0x38, 0xd5, 0x25, 0x43, 0x36, 0x54,
+	     0xda, 0x87, 0x83, 0xd8, 0xb2, 0x04, 0x47, 0x11, 0x6d, 0x8c,
+	     0x02, 0x14, 0x74, 0x12, 0x42, 0xf2, 0x90, 0x6f, 0xc9, 0x4d,
+	     0x45, 0xee, 0x54, 0xa0, 0x90, 0x84, 0xfd, 0xfe, 0x46, 0x1f,
+	     0x81, 0xa5, 0x09, 0xcf, 0x67, 0x2b, 0xf4, 0x58, 0x68, 0xf3,
+	     0x29, 0x06, 0x88, 0xdc, 0x1f, 0xf1, 0x44, 0x29, 0x16, 0x69,
+	     0xe2, 0xdc, 0x92, 0x12, 0x81, 0xd7, 0x05, 0x03, 0xb4, 0x71,
+	     0x97, 0x0f, 0x94, 0xce, 0x4a, 0xa6, 0xea, 0xe6, 0xdf, 0x38,
+	     0xbb, 0x25, 0x00, 0xa2, 0x99, 0x2c, 0xae, 0x48, 0xcc, 0x91,
+	     0x25, 0x6f, 0xc7, 0x4f, 0x42, 0xdd, 0xcd, 0x12, 0x46, 0x62,
+	     0xdb, 0x1b, 0x9d, 0x42, 0x59, 0xe7, 0x29, 0xf0, 0x62, 0xe8,
+	     0x36, 0x8e, 0xf0, 0x2a, 0x07, 0x45, 0xa3, 0xf7, 0x94, 0x0f,
+	     0x0f, 0x8d, 0x74, 0xb1, 0xe4, 0xa9, 0xc8, 0x24, 0xdf, 0x7e,
+	     0x6c, 0x12, 0x50, 0xc0, 0x20, 0x4f, 0xd9, 0xd5, 0xa3, 0x31,
+	     0x4e, 0xb0, 0x12, 0x4b, 0x83, 0x43, 0x30, 0x42, 0xc7, 0x45,
+	     0x66, 0x1d, 0x50, 0xbd, 0x08, 0x7d, 0x31, 0x2d, 0xa6, 0x76,
+	     0x48, 0x9f, 0x9f, 0x56, 0x7f, 0xcf, 0x4b, 0xb9, 0xd0, 0x59,
+	     0x52, 0x2d, 0xb9, 0x16, 0x5a, 0x36, 0x80, 0x15, 0x9a, 0x10,
+	     0xe6, 0x95, 0x79, 0x28, 0x28, 0x43, 0xae, 0x93, 0xee, 0x28,
+	     0x8c, 0x3f, 0x6c, 0x59, 0x30, 0x8e, 0xf0, 0x77, 0x22, 0x12,
+	     0x5f, 0x30, 0xbe, 0x74, 0x02, 0xeb, 0x0e, 0x60, 0xdd, 0x86,
+	     0x87, 0xcf, 0xd3, 0xd2, 0x9c, 0x69, 0x28, 0x0f, 0xc9, 0x0f,
+	     0xb5, 0x93, 0xcf, 0x07, 0x7a, 0x00, 0x8a, 0x85, 0x86, 0x90,
+	     0xe4, 0x85, 0x29, 0x27, 0x69, 0xee, 0xa8, 0xeb, 0x65, 0xfb,
+	     0x0b, 0x01, 0x86, 0x63, 0x24, 0x1b, 0xf4, 0xff, 0xba, 0x74,
+	     0x40, 0x07, 0xb1, 0xdb, 0xf3, 0x08, 0xc7, 0x84, 0x91, 0x48,
+	     0xe8, 0x4c, 0x84, 0x1c, 0x8c, 0x96, 0x0f, 0x83, 0x47, 0xcf,
+	     0x28, 0x5c, 0xb3, 0x0f, 0x5a, 0x47, 0xf6, 0x08, 0x83, 0x38,
+	     0xa4, 0x3b, 0x8f, 0x5d, 0x0a, 0x84, 0x30, 0xc9, 0xd5, 0xe1,
+	     0xaa, 0xdc, 0x03, 0x97, 0x62, 0x50, 0xcc, 0x69, 0x4a, 0x31,
+	     0xe0, 0x8f, 0xd3, 0xd7, 0x40, 0x47, 0xf4, 0x08, 0x28, 0x31,
+	     0x0e, 0x93, 0xcd, 0x15, 0x45, 0x2c, 0x85, 0x08, 0x6a, 0x1c,
+	     0x27, 0x84, 0x64, 0x44, 0x99, 0xf7, 0x0f, 0x0e, 0x63, 0xaa,
+	     0xa0, 0xa1, 0x61, 0x46, 0x38, 0xc9, 0xc1, 0xab, 0x86, 0x8b,
+	     0xa7, 0x96, 0x6b, 0xa4, 0xc8, 0xab, 0xdd, 0xb0, 0x08, 0x82,
+	     0x05, 0x76, 0xf2, 0x48, 0x4d, 0x8f, 0x09, 0xea, 0xc8, 0xeb,
+	     0x28, 0xea, 0xa3, 0xcb, 0xe2, 0xd9, 0x89, 0xcf, 0xf2, 0x5f,
+	     0x76, 0xa9, 0x65, 0x18, 0x30, 0x2c, 0x08, 0x41, 0x28, 0x91,
+	     0xb1, 0xcd, 0x19, 0x15, 0x5e, 0x91, 0x46, 0x8e, 0x8b, 0xb5,
+	     0x41, 0x3f, 0xc2, 0xf1, 0xdb, 0xe2, 0xc4, 0x10, 0x29, 0x3f,
+	     0xa3, 0x34, 0x95, 0xda, 0xc2, 0x31, 0x80, 0x47, 0x86, 0xc2,
+	     0x4c, 0xda, 0x30, 0xc3, 0x0f, 0xec, 0x3d, 0x7a, 0x4c, 0x11,
+	     0x23, 0x39, 0x90, 0x91, 0x93, 0x22, 0xda, 0x02, 0x7a, 0x6c,
+	     0x08, 0x3c, 0x2a, 0x81, 0xfb, 0xa2, 0xe3, 0xd2, 0x47, 0xd4,
+	     0x0a, 0xb6, 0x57, 0xde, 0x8d, 0x08, 0x4b, 0x5d, 0xcb, 0xa9,
+	     0xa3, 0xbb, 0x55, 0x33, 0x11, 0x16, 0xc2, 0x1b, 0x32, 0x74,
+	     0xfe, 0x47, 0x5b, 0xc2, 0x29, 0xa5, 0x6a, 0xe7, 0x97, 0xc3,
+	     0x52, 0x5d, 0xa1, 0xc2, 0x43, 0xf3, 0x20, 0x20, 0x94, 0x37,
+	     0x47, 0xe9, 0x72, 0xbd, 0x49, 0x4c, 0x4a, 0x17, 0xc9, 0x7f,
+	     0xd4, 0x8d, 0x64, 0xa0, 0xe4, 0xc1, 0x38, 0x65, 0xd7, 0x52,
+	     0xc9, 0x95, 0x37, 0xf7, 0x95, 0xb2, 0x4a, 0x21, 0x23, 0x92,
+	     0xac, 0x4c, 0xa6, 0xfc, 0x5b, 0x5c, 0x05, 0x32, 0x56, 0x8b,
+	     0x9f, 0x82, 0xce, 0x8d, 0x56, 0x89, 0xd8, 0x96, 0x7a, 0x21,
+	     0xa5, 0x75, 0x32, 0x8f, 0x91, 0x84, 0xa4, 0x0a, 0x5e, 0x7e,
+	     0x09, 0x25, 0xd2, 0x9e, 0x44, 0x36, 0xaa, 0x64, 0xc6, 0x6a,
+	     0xf1, 0x28, 0x5b, 0x58, 0xaa, 0xc9, 0x4b, 0x56, 0x71, 0xf1,
+	     0x12, 0xe9, 0x02, 0x36, 0x0e, 0x2c, 0x86, 0x06, 0x02, 0x14,
+	     0x4e, 0x5c, 0x01, 0xa2, 0x60, 0x6b, 0x6c, 0x33, 0x03, 0x14,
+	     0xa9, 0x24, 0x3e, 0xd7, 0x95, 0x71, 0xf4, 0x70, 0x94, 0xbb,
+	     0x5d, 0xa5, 0x2e, 0xa7, 0x0c, 0xd1, 0x97, 0x06, 0xc8, 0xa4,
+	     0xe7, 0xb3, 0x49, 0xaf, 0x72, 0xcd, 0x34, 0xd3, 0x92, 0x94,
+	     0x1f, 0x9a, 0xb0, 0x1e, 0x3c, 0x13, 0x11, 0x50, 0x6f, 0xf8,
+	     0x4b, 0x99, 0x47, 0xec, 0x5c, 0x53, 0x85, 0x69, 0x63, 0xe6,
+	     0x00, 0x01, 0x30, 0x23, 0x1c, 0xb8, 0xa8, 0x11, 0x9f, 0x1c,
+	     0x66, 0xbb, 0x05, 0x65, 0xee, 0xc0, 0xf6, 0x07, 0x24, 0x5c,
+	     0x9c, 0x38, 0x7d, 0x06, 0x1b, 0x26, 0x3d, 0xc0, 0x13, 0x70,
+	     0x8b, 0x63, 0xf9, 0x0e, 0x62, 0x58, 0x82, 0x9c, 0xe2, 0x49,
+	     0x10, 0xb3, 0x0f, 0x8e, 0x77, 0x92, 0xd5, 0x23, 0xb6, 0x03,
+	     0xd7, 0xd0, 0x84, 0xa4, 0x52, 0x40, 0xb1, 0xd2, 0x84, 0x1e,
+	     0x30, 0xc8, 0x68, 0xd0, 0x63, 0x86, 0x88, 0x30, 0x1a, 0x67,
+	     0x66, 0x99, 0x93, 0x83, 0x5c, 0x8b, 0xa8, 0x38, 0x7f, 0x9c,
+	     0x93, 0xdc, 0xdd, 0xa0, 0x3c, 0x22, 0x12, 0x2d, 0xc9, 0x5b,
+	     0x43, 0x18, 0xa2, 0x80, 0x2a, 0x75, 0xe8, 0x18, 0xd0, 0x6d,
+	     0xad, 0x9a, 0xbe, 0x41, 0x0c, 0x2a, 0x00, 0x84, 0xfc, 0xd0,
+	     0x04, 0x8e, 0xbf, 0xe6, 0x85, 0xd5, 0x37, 0xcc, 0x51, 0x71,
+	     0xaf, 0x02, 0xc7, 0xee, 0x38, 0x67, 0xde, 0x1d, 0x86, 0x2d,
+	     0xee, 0x86, 0xa6, 0x4b, 0xe0, 0x6f, 0x14, 0x76, 0x70, 0x18,
+	     0x9b, 0x6d, 0x04, 0xfe, 0x60, 0xe7, 0x49, 0xb0, 0x4b, 0x5c,
+	     0xa6, 0x7c, 0x38, 0x99, 0xd1, 0x43, 0x1d, 0x1d, 0xf9, 0x04,
+	     0x59, 0x85, 0x60, 0x47, 0x0b, 0x6d, 0xe8, 0xa7, 0xbe, 0x8a,
+	     0xe2, 0xf8, 0xdb, 0x60, 0x90, 0xa5, 0xad, 0xae, 0x0c, 0x94,
+	     0x60, 0xb6, 0xe5, 0x5d, 0x73, 0x3b, 0xb1, 0x50, 0x0a, 0x91,
+	     0xbb, 0x01, 0xc6, 0x03, 0xce, 0xf2, 0x76, 0x06, 0xb1, 0x33,
+	     0x7a, 0x6d, 0x21, 0x56, 0x89, 0xd2, 0x31, 0x43, 0x59, 0x92,
+	     0x2c, 0xf3, 0x06, 0xc2, 0xa4, 0x19, 0x8d, 0xfd, 0x7c, 0x70,
+	     0xc3, 0x0b, 0xac, 0xc5, 0x99, 0x8e, 0x83, 0xb2, 0xa5, 0xec,
+	     0x98, 0xa1, 0xd8, 0xf4, 0x3e, 0xc2, 0x93, 0xf9, 0x59, 0x92,
+	     0xce, 0xa2, 0x19, 0xf4, 0xb1, 0x88, 0x68, 0x35, 0x70, 0x7d,
+	     0x01, 0x41, 0x79, 0x96, 0xcb, 0x85, 0x8b, 0x71, 0x13, 0xec,
+	     0x61, 0x44, 0x2b, 0xf7, 0x14, 0x07, 0x0c, 0x51, 0x81, 0x0e,
+	     0xf3, 0x5a, 0xc2, 0x51, 0x2b, 0x20, 0xe1, 0xb9, 0xb8, 0x02,
+	     0xd4, 0xae, 0x40, 0x25, 0x03, 0xcf, 0x07, 0x24, 0xa1, 0x1a,
+	     0x36, 0xb8, 0x1a, 0xad, 0x4a, 0xe7, 0x1d, 0xa5, 0x84, 0x3e,
+	     0x71, 0xb2, 0x93, 0x2f, 0x9a, 0x8a, 0xd5, 0x52, 0x96, 0x74,
+	     0x49, 0x08, 0x87, 0x93, 0xbc, 0x4b, 0xe1, 0x37, 0x07, 0xdc,
+	     0xc7, 0x1c, 0x18, 0xfb, 0x29, 0x46, 0x85, 0x2d, 0x98, 0xd3,
+	     0x4c, 0xa7, 0x58, 0xb8, 0xdb, 0xf3, 0x39, 0x56, 0x7a, 0x4f,
+	     0xeb, 0x3d, 0xd2, 0x90, 0x34, 0x43, 0xeb, 0x00, 0xe0, 0xbb,
+	     0x1a, 0x39, 0x0d, 0xfb, 0x80, 0x30, 0xad, 0x9b, 0xa5, 0xac,
+	     0x25, 0x41, 0x82, 0x92, 0x00, 0x46, 0x2a, 0xa3, 0x42, 0x59,
+	     0xfe, 0x26, 0x88, 0x16, 0xaf, 0x68, 0x72, 0xd9, 0x50, 0xf0,
+	     0x26, 0x65, 0x2f, 0xc4, 0x72, 0xc3, 0x1b, 0x03, 0x27, 0xd3,
+	     0x2e, 0x08, 0x42, 0x3a, 0x28, 0xe9, 0xe0, 0x71, 0x66, 0x42,
+	     0x42, 0xa7, 0xc5, 0x4e, 0x78, 0x40, 0x4c, 0xb2, 0x55, 0x84,
+	     0x38, 0x9e, 0x23, 0x39, 0x90, 0x1d, 0xba, 0x9b, 0x4f, 0x2e,
+	     0x62, 0x9e, 0xd1, 0x2a, 0x90, 0x0f, 0x66, 0xd7, 0x18, 0x3f,
+	     0x33, 0x0a, 0x3d, 0xd5, 0x4f, 0x4d, 0x5e, 0x36, 0xcd, 0x0c,
+	     0x16, 0x98, 0x27, 0x1f, 0x05, 0x47, 0x46, 0x62, 0x0a, 0x68,
+	     0x80, 0x9c, 0x84, 0x3a, 0x00, 0x2d, 0x26, 0x1c, 0x5a, 0x0e,
+	     0x92, 0x0d, 0x16, 0x5f, 0xaf, 0xc0, 0x34, 0x80, 0x30, 0xbc,
+	     0x19, 0x0c, 0x37, 0xfb, 0x02, 0x74, 0x09, 0x46, 0xc2, 0xab,
+	     0x6f, 0x1a, 0x01, 0x66, 0x70, 0x9d, 0x25, 0xee, 0x34, 0x77,
+	     0xa2, 0x0c, 0x9b, 0x00, 0xaa, 0x24, 0x2c, 0xf7, 0xf0, 0x51,
+	     0x38, 0xe2, 0x2d, 0x6b, 0x10, 0x30, 0x38, 0x25, 0xcc, 0x0a,
+	     0x0c, 0xa9, 0x34, 0x02, 0x61, 0x05, 0xd5, 0x69, 0x9c, 0x16,
+	     0x82, 0x09, 0x43, 0x0d, 0x40, 0xd1, 0xb4, 0x09, 0x55, 0x92,
+	     0x0a, 0x05, 0x49, 0x3c, 0x71, 0x86, 0x39, 0x3e, 0xcc, 0x37,
+	     0xef, 0x8e, 0x56, 0xd8, 0xf8, 0xef, 0x60, 0x64, 0x92, 0x2a,
+	     0x62, 0xc2, 0xf8, 0xcf, 0x19, 0xd3, 0x6b, 0x94, 0x5b, 0xa1,
+	     0x28, 0x15, 0xb3, 0x04, 0x08, 0x6e, 0x82, 0xa8, 0x01, 0x44,
+	     0x22, 0x86, 0x56, 0xc2, 0x29, 0x0c, 0xe0, 0x16, 0x6b, 0x83,
+	     0xfc, 0x00, 0xcf, 0xc3, 0x54, 0xc0, 0x24, 0x59, 0x4d, 0x40,
+	     0x59, 0x00, 0x35, 0x46, 0x2a, 0x51, 0x39, 0xc7, 0x5f, 0x28,
+	     0xc0, 0x3e, 0x79, 0xa9, 0x58, 0x71, 0xac, 0x80, 0x20, 0x45,
+	     0xe5, 0x1f, 0x03, 0xc8, 0x81, 0x52, 0x95, 0xe5, 0x1a, 0x99,
+	     0x75, 0x9c, 0x1e, 0x9b, 0x57, 0x31, 0xb1, 0x87, 0x20, 0x92,
+	     0xe6, 0x08, 0xd3, 0xa5, 0x20, 0x46, 0x52, 0x33, 0x4e, 0x0f,
+	     0xad, 0x81, 0x7c, 0xc6, 0x4e, 0xaa, 0xb9, 0x44, 0x93, 0x1b,
+	     0x19, 0x15, 0xa9, 0xe8, 0x6e, 0x9b, 0x4c, 0xb6, 0x55, 0x2a,
+	     0x71, 0xbc, 0x10, 0x93, 0x30, 0x6e, 0xe4, 0x52, 0x78, 0x0f,
+	     0xf5, 0xb7, 0x77, 0xde, 0x3f, 0x0f, 0x5f, 0x23, 0x91, 0xb4,
+	     0xcb, 0xf5, 0x6a, 0xfa, 0x2c, 0x58, 0xb9, 0x3e, 0x91, 0xb5,
+	     0x4d, 0x1d, 0x11, 0x09, 0x58, 0x49, 0xcc, 0x57, 0xb0, 0x1e,
+	     0x0a, 0x8d, 0x48, 0x0d, 0x97, 0x66, 0x31, 0x23, 0x22, 0xec,
+	     0xfa, 0x99, 0x39, 0x72, 0x02, 0xf6, 0xac, 0x33, 0x53, 0xf4,
+	     0xa3, 0xb8, 0x28, 0xa9, 0x9c, 0xf8, 0xd4, 0x6d, 0xc6, 0x2b,
+	     0xfd, 0x90, 0x15, 0x94, 0x8d, 0xcd, 0x84, 0xc9, 0x98, 0xa1,
+	     0x75, 0x1d, 0xaa, 0xde, 0x3e, 0x9a, 0xad, 0x52, 0x95, 0x53,
+	     0x81, 0x79, 0xc5, 0xa3, 0x2b, 0x94, 0x2d, 0x0a, 0x85, 0x17,
+	     0x71, 0xb2, 0x08, 0x60, 0x87, 0x8c, 0x1d, 0x69, 0x39, 0x5a,
+	     0xb9, 0x00, 0x6a, 0xa6, 0x37, 0xe6, 0x84, 0xc2, 0x53, 0xdb,
+	     0xaf, 0x12, 0x42, 0x31, 0x42, 0x71, 0xc8, 0x0e, 0xb4, 0x85,
+	     0x19, 0x4c, 0x9b, 0x98, 0xc1, 0xe9, 0xd0, 0x10, 0xd6, 0x7a,
+	     0x9f, 0xb8, 0x76, 0xa4, 0x61, 0x6b, 0x97, 0xa6, 0xc5, 0x6b,
+	     0x11, 0x3a, 0xb8, 0xe1, 0x83, 0x81, 0xd1, 0x1f, 0x69, 0x69,
+	     0xaf, 0x07, 0xdf, 0x15, 0x67, 0x09, 0x04, 0x70, 0x4f, 0xd3,
+	     0x53, 0x92, 0x09, 0xd0, 0x15, 0xec, 0x2e, 0x5f, 0x00, 0x1d,
+	     0x82, 0xdf, 0xb4, 0x4a, 0xd9, 0xfd, 0xd0, 0x98, 0x14, 0x1f,
+	     0xc9, 0x85, 0xbd, 0x54, 0x69, 0x8d, 0xd8, 0x80, 0x51, 0x49,
+	     0x3a, 0xf8, 0xe6, 0x80, 0x71, 0xa3, 0x90, 0x02, 0xd8, 0xb9,
+	     0x42, 0x70, 0x07, 0xe0, 0x8a, 0x3a, 0x05, 0x00, 0x95, 0x8a,
+	     0x8c, 0xb8, 0x6d, 0xdc, 0xc3, 0x8a, 0x02, 0x42, 0x1c, 0x10,
+	     0xdd, 0x91, 0x2e, 0x36, 0x58, 0x7b, 0x80, 0x92, 0xd6, 0x9d,
+	     0xcf, 0xcf, 0x68, 0x88, 0xd0, 0x18, 0x06, 0xd5, 0xa2, 0x36,
+	     0x50, 0xbd, 0x7d, 0x52, 0x0d, 0x89, 0xf2, 0x37, 0x5b, 0x00,
+	     0x10, 0xbe, 0xdd, 0x6c, 0x8a, 0x42, 0xa9, 0xde, 0x43, 0x40,
+	     0x91, 0xb4, 0xa6, 0xb2, 0x3a, 0x7b, 0x15, 0xc2, 0xea, 0x1d,
+	     0x1e, 0x94, 0x9f, 0x51, 0xe4, 0xe7, 0x13, 0x04, 0x03, 0x69,
+	     0x07, 0xbe, 0x8b, 0x22, 0x4d, 0x95, 0x4b, 0x60, 0xd2, 0xc9,
+	     0x31, 0xbf, 0x87, 0x12, 0x70, 0xce, 0x58, 0x27, 0x0a, 0x73,
+	     0x65, 0x00, 0x0a, 0x82, 0x1d, 0x49, 0x91, 0xc6, 0xa4, 0xb2,
+	     0x48, 0x32, 0xf2, 0x1a, 0x7e, 0xda, 0x20, 0x6e, 0xd8, 0x06,
+	     0xca, 0x84, 0x77, 0xb2, 0x70, 0x29, 0x2c, 0xe7, 0x5a, 0x69,
+	     0x4e, 0x0a, 0x84, 0x13, 0x2f, 0xb0, 0xc5, 0x57, 0xbd, 0x2b,
+	     0x5e, 0x00, 0xf7, 0x2a, 0x74, 0x79, 0xac, 0xc5, 0xa4, 0x3f,
+	     0xae, 0xcb, 0x16, 0xce, 0x82, 0x22, 0x65, 0x10, 0x8d, 0x8c,
+	     0x30, 0x21, 0xc9, 0x90, 0x07, 0xa9, 0xd0, 0x95, 0x57, 0xa2,
+	     0xf2, 0x99, 0x35, 0xfb, 0x59, 0x8b, 0x1f, 0x31, 0x1f, 0xe9,
+	     0x6c, 0x19, 0x61, 0x24, 0x31, 0xb6, 0xfd, 0x6c, 0x10, 0x25,
+	     0xc0, 0x04, 0x18, 0x61, 0x12, 0x71, 0x89, 0x83, 0x29, 0xe1,
+	     0x09, 0xa2, 0xf0, 0xd6, 0x17, 0xd8, 0x11, 0x63, 0xd1, 0x2f,
+	     0x42, 0xf5, 0x98, 0xbf, 0x70, 0x41, 0x79, 0x59, 0x2c, 0x5a,
+	     0xa4, 0xae, 0xad, 0x4c, 0xa1, 0xb2, 0xc9, 0x72, 0x52, 0x51,
+	     0x57, 0xa6, 0x53, 0x76, 0x38, 0x5c, 0x33, 0x92, 0x4a, 0xb7,
+	     0x83, 0x71, 0x78, 0x0c, 0xa0, 0x21, 0xd1, 0x80, 0xa0, 0x74,
+	     0xee, 0x29, 0xb0, 0xdd, 0x85, 0x83, 0x91, 0x14, 0x14, 0x53,
+	     0x6e, 0xf9, 0x3b, 0xe0, 0x2e, 0x6b, 0x9c, 0xfb, 0x66, 0xf2,
+	     0xcd, 0x23, 0x82, 0x85, 0x3b, 0xe5, 0xf4, 0x21, 0xd4, 0x7c,
+	     0x59, 0x9a, 0x2f, 0xd5, 0x87, 0x48, 0x14, 0xd7, 0x9b, 0x61,
+	     0x51, 0x56, 0xb0, 0x4c, 0x62, 0xe9, 0x29, 0x95, 0x0a, 0x58,
+	     0x0e, 0xba, 0x36, 0x5a, 0xb2, 0x6b, 0x6a, 0x46, 0x8c, 0x3c,
+	     0xd1, 0xb0, 0x29, 0xca, 0xfe, 0x48, 0xe8, 0xe0, 0x70, 0xa0,
+	     0xe2, 0x65, 0x36, 0xb0, 0x80, 0x38, 0x1f, 0xe8, 0x65, 0x0a,
+	     0xaf, 0x7e, 0xb9, 0x27, 0xb0, 0xb3, 0xfc, 0x04, 0x3e, 0x8a,
+	     0xcb, 0xaf, 0xd8, 0xd8, 0x7b, 0x00, 0xad, 0xe5, 0x31, 0xca,
+	     0x4f, 0xfa, 0x9a, 0x66, 0x7e, 0xa8, 0xc4, 0x7b, 0x06, 0x78,
+	     0xf2, 0x7a, 0x66, 0xf9, 0xa2, 0x67, 0xb4, 0xe4, 0xac, 0x2b,
+	     0x6b, 0xa1, 0x80, 0x18, 0xe6, 0x41, 0xe6, 0xa6, 0xe8, 0x52,
+	     0x5e, 0xa0, 0x11, 0xda, 0x7f, 0xb3, 0x89, 0xfe, 0x8c, 0x77,
+	     0xd1, 0x19, 0x40, 0x5e, 0xa3, 0x10, 0x9e, 0x1b, 0x9b, 0x66,
+	     0xd3, 0x86, 0x0b, 0x4d, 0x62, 0x6d, 0x02, 0x71, 0x7f, 0xba,
+	     0xa2, 0x29, 0x42, 0x72, 0x8f, 0x1f, 0x4c, 0xd9, 0x07, 0x7f,
+	     0x00, 0x1e, 0x09, 0x78, 0x2b, 0x4a, 0xbc, 0xed, 0xc4, 0x6b,
+	     0x7b, 0x07, 0xb7, 0x54, 0x42, 0xf1, 0x12, 0x88, 0x47, 0x92,
+	     0x8c, 0xf4, 0x7a, 0xd6, 0x3c, 0x37, 0x3d, 0xdf, 0x0e, 0x73,
+	     0x02, 0xa8, 0x58, 0x06, 0x02, 0x11, 0x90, 0x99, 0x84, 0x62,
+	     0x69, 0xba, 0x98, 0x52, 0xf7, 0xe0, 0x41, 0x34, 0xca, 0x2a,
+	     0x1b, 0x82, 0x02, 0x7d, 0x3c, 0xc0, 0xc5, 0x43, 0x50, 0xa3,
+	     0x51, 0x11, 0x01, 0x09, 0x7a, 0x5c, 0x2d, 0x8b, 0x86, 0x7d,
+	     0xb7, 0x4b, 0x43, 0x1f, 0x03, 0x31, 0x10, 0xd9, 0xdb, 0x59,
+	     0xf1, 0x58, 0xcc, 0xc6, 0x68, 0x75, 0x2a, 0xbc, 0x21, 0x80,
+	     0x68, 0x64, 0x35, 0xa8, 0x64, 0x1f, 0x30, 0x42, 0xaa, 0x44,
+	     0x97, 0x9c, 0xde, 0xdd, 0xb4, 0x87, 0x38, 0xe9, 0x92, 0xba,
+	     0x45, 0x30, 0x11, 0xc3, 0x5d, 0x1a, 0x14, 0x33, 0x41, 0xae,
+	     0x6f, 0xef, 0xc2, 0xb9, 0x83, 0xb5, 0xb4, 0x79, 0x6c, 0x17,
+	     0xfa, 0x38, 0x4d, 0x0c, 0x3a, 0x8d, 0xbf, 0x96, 0xfb, 0xcb,
+	     0x8a, 0xd8, 0x21, 0xcd, 0x81, 0xfb, 0x4d, 0x52, 0x52, 0x95,
+	     0x11, 0x38, 0x55, 0x56, 0x50, 0xe7, 0xc5, 0x34, 0xb3, 0x79,
+	     0x3f, 0x1a, 0x97, 0x98, 0x54, 0xd0, 0xc0, 0x63, 0x24, 0xb4,
+	     0x77, 0xf0, 0xcf, 0x0e, 0x28, 0xb5, 0xbb, 0xde, 0x5b, 0x07,
+	     0x73, 0xad, 0xf3, 0xdf, 0x32, 0x19, 0x28, 0xfd, 0x92, 0x24,
+	     0xa3, 0x0b, 0xb4, 0x89, 0x94, 0x88, 0x84, 0xd3, 0x28, 0xea,
+	     0x44, 0xe2, 0xef, 0x3e, 0x04, 0x7e, 0x2b, 0x64, 0xc6, 0xd8,
+	     0xea, 0x76, 0xa3, 0x50, 0x0b, 0xd8, 0x4c, 0x30, 0xee, 0x09,
+	     0x72, 0x83, 0x63, 0x59, 0xca, 0x8c, 0x1d, 0xa1, 0x63, 0x12,
+	     0xce, 0x64, 0x52, 0x3c, 0x93, 0x22, 0x37, 0x81, 0x4b, 0x83,
+	     0x49, 0x8b, 0xf7, 0x6a, 0x10, 0x3a, 0x12, 0xa3, 0xb8, 0x79,
+	     0x23, 0x24, 0x0d, 0xc2, 0x50, 0x4d, 0x0a, 0xf3, 0x8f, 0xca,
+	     0x45, 0x51, 0x87, 0xc8, 0x62, 0x0d, 0x3d, 0x98, 0x0f, 0x8e,
+	     0x24, 0x7d, 0x61, 0x06, 0xf8, 0xd2, 0xb5, 0x73, 0x90, 0x2a,
+	     0x7f, 0x36, 0xe9, 0x87, 0x48, 0x6b, 0x4d, 0x77, 0x7d, 0x91,
+	     0x6e, 0xd9, 0x86, 0xa6, 0x56, 0x00, 0xa9, 0x1a, 0x56, 0xee,
+	     0xe8, 0x00, 0x50, 0xb9, 0x4a, 0xe0, 0x00, 0x6e, 0x84, 0x88,
+	     0xa5, 0xba, 0x04, 0x67, 0x1a, 0x27, 0xe3, 0xc5, 0x25, 0xd1,
+	     0x0d, 0x99, 0xa4, 0x50, 0x35, 0xad, 0x8e, 0xd2, 0x5b, 0xd2,
+	     0x22, 0x1d, 0x83, 0x53, 0xaa, 0x66, 0x55, 0x77, 0x44, 0x54,
+	     0x51, 0xc1, 0x15, 0x45, 0x21, 0xa5, 0xfb, 0x10, 0x74, 0xb4,
+	     0x0b, 0xa2, 0x2a, 0xfb, 0x3a, 0x68, 0x46, 0xe8, 0xc8, 0x0c,
+	     0xc2, 0x9f, 0x86, 0x93, 0xa9, 0x5f, 0xf1, 0x76, 0xb0, 0x25,
+	     0x50, 0x1c, 0xee, 0xc9, 0x59, 0x69, 0xed, 0xd3, 0x80, 0xb9,
+	     0x77, 0xd0, 0xc7, 0x08, 0x68, 0x09, 0x27, 0xbc, 0x24, 0x73,
+	     0xd3, 0xf6, 0xb4, 0xb5, 0x12, 0xc7, 0x41, 0x35, 0xb4, 0x68,
+	     0xed, 0xae, 0xe2, 0x25, 0xc9, 0xa3, 0xef, 0x81, 0x44, 0x69,
+	     0xc5, 0x9d, 0xb2, 0xfa, 0x87, 0xec, 0x34, 0x77, 0x07, 0x9e,
+	     0xa3, 0x7c, 0x99, 0x7f, 0x20, 0x01, 0x04, 0x0f, 0x09, 0x1c,
+	     0x00, 0x2b, 0x04, 0x27, 0xa0, 0x01, 0xa5, 0x24, 0x3f, 0x7a,
+	     0x70, 0x9c, 0x9d, 0xe0, 0x38, 0x57, 0x83, 0x6d, 0x65, 0x0e,
+	     0x48, 0x01, 0x21, 0x2c, 0x12, 0x2c, 0xa2, 0x72, 0x8a, 0x8e,
+	     0xde, 0x33, 0x17, 0x49, 0x01, 0xed, 0xd7, 0x42, 0x65, 0x09,
+	     0xd1, 0xc0, 0x25, 0xee, 0x64, 0x16, 0xcc, 0xd9, 0x03, 0x40,
+	     0x4c, 0x53, 0x61, 0x8c, 0xe9, 0x5a, 0x20, 0x9a, 0x1c, 0x31,
+	     0x12, 0x86, 0xc8, 0x84, 0x9c, 0x65, 0x24, 0x91, 0xc0, 0xc8,
+	     0x91, 0x29, 0x10, 0x9a, 0x5c, 0x73, 0x21, 0x9f, 0x55, 0x2b,
+	     0x6a, 0x3f, 0x50, 0x63, 0xf0, 0x3a, 0xe4, 0xf0, 0x2e, 0x79,
+	     0x74, 0xc6, 0xa3, 0x20, 0x5c, 0x0c, 0x69, 0x85, 0xa7, 0x98,
+	     0xb3, 0xe1, 0x4d, 0x9c, 0x3a, 0x71, 0x86, 0x9e, 0x1e, 0x82,
+	     0xa8, 0xed, 0xf1, 0xc3, 0x9c, 0xae, 0x90, 0x31, 0xe8, 0x1d,
+	     0x3f, 0x3e, 0xe7, 0x59, 0x3e, 0xc9, 0x53, 0xc3, 0x4d, 0x28,
+	     0x5b, 0x9a, 0xb0, 0x94, 0x8b, 0x90, 0x04, 0x78, 0x4f, 0xde,
+	     0xc0, 0xab, 0x71, 0x2a, 0xc9, 0xa7, 0xc1, 0x2b, 0x53, 0x01,
+	     0x84, 0x27, 0x67, 0x1d, 0x81, 0x28, 0x8d, 0xe1, 0xdd, 0x23,
+	     0x0b, 0xc1, 0x94, 0x54, 0x43, 0x30, 0xbe, 0x42, 0x9e, 0x51,
+	     0xef, 0x45, 0x97, 0x71, 0xec, 0xa4, 0x38, 0x7b, 0x32, 0x31,
+	     0x57, 0xac, 0xac, 0x23, 0xe7, 0x04, 0xc4, 0x22, 0xf8, 0x78,
+	     0x6c, 0x84, 0xe6, 0xfe, 0x62, 0x2b, 0xa2, 0x33, 0xc4, 0x3e,
+	     0x2f, 0x79, 0x25, 0x62, 0x73, 0x79, 0x65, 0x90, 0x92, 0x36,
+	     0xe0, 0xa5, 0x7a, 0x1a, 0xd9, 0x47, 0x5b, 0xe3, 0xaa, 0xa4,
+	     0xf2, 0x08, 0x41, 0xe2, 0x35, 0xc3, 0x97, 0x78, 0x48, 0xbe,
+	     0xaa, 0x07, 0x34, 0xfe, 0xb8, 0x5b, 0x82, 0x11, 0x10, 0x47,
+	     0x4b, 0xc6, 0xd3, 0x0f, 0x23, 0x00, 0x1e, 0x45, 0x16, 0x10,
+	     0x7e, 0x59, 0x0a, 0x96, 0x7f, 0x3f, 0x28, 0xde, 0x19, 0xc0,
+	     0x8e, 0x36, 0xf0, 0x8f, 0x4b, 0xf4, 0x61, 0x52, 0x0c, 0x54,
+	     0xdc, 0xcd, 0xc8, 0xc3, 0x96, 0x6e, 0x9e, 0xa2, 0x23, 0x18,
+	     0xba, 0xc0, 0xdb, 0x9e, 0x86, 0x72, 0x84, 0xbe, 0x25, 0xdf,
+	     0x00, 0x11, 0x67, 0xf7, 0x01, 0xb9, 0x7d, 0xb0, 0xbe, 0x3a,
+	     0x87, 0xac, 0xb3, 0x63, 0xb4, 0x49, 0x12, 0xb3, 0xd3, 0xf4,
+	     0xba, 0xc8, 0x19, 0x7f, 0x44, 0xb4, 0xc7, 0x43, 0x8a, 0x3f,
+	     0x05, 0xa4, 0x04, 0x71, 0xf8, 0x61, 0xb9, 0x4c, 0x4a, 0x29,
+	     0x7d, 0x0e, 0xbd, 0xc9, 0x06, 0x8c, 0x64, 0x02, 0xce, 0x19,
+	     0x28, 0xee, 0xb4, 0x18, 0x3e, 0x6d, 0x3e, 0x5c, 0xdd, 0xb1,
+	     0x70, 0x56, 0x47, 0xe2, 0x32, 0xdc, 0x55, 0x28, 0x7c, 0x20,
+	     0x3b, 0x83, 0x03, 0x26, 0x61, 0x80, 0x47, 0x41, 0x1b, 0xc2,
+	     0x70, 0x5a, 0x19, 0x0c, 0x90, 0xf0, 0x45, 0x81, 0xcd, 0xa3,
+	     0x45, 0xca, 0xb4, 0x2b, 0x8c, 0xde, 0x2c, 0xa7, 0x50, 0x59,
+	     0x4f, 0xc4, 0x26, 0x1a, 0xc1, 0x0c, 0x77, 0xa3, 0x52, 0x92,
+	     0x02, 0xc0, 0xd5, 0x54, 0x36, 0x07, 0xa5, 0x07, 0x1c, 0x1a,
+	     0xc0, 0x5e, 0x33, 0xe7, 0x49, 0x88, 0x14, 0xf1, 0x12, 0x1c,
+	     0x27, 0xc0, 0x47, 0xd5, 0x0a, 0x13, 0x65, 0x60, 0x18, 0x09,
+	     0x36, 0xf5, 0x2b, 0x4b, 0x3c, 0x62, 0xa1, 0xfd, 0x05, 0x75,
+	     0xd0, 0xd5, 0x83, 0xf7, 0x82, 0x0a, 0x44, 0x8b, 0xda, 0x4d,
+	     0x87, 0x1d, 0xb3, 0x46, 0x5c, 0x02, 0x4d, 0xc1, 0xf1, 0x60,
+	     0x7b, 0xbd, 0x05, 0xbd, 0x4e, 0x88, 0x87, 0xe6, 0x9a, 0xdf,
+	     0xc8, 0xd7, 0xa1, 0xb9, 0xa0, 0xe2, 0x54, 0x1c, 0x62, 0x02,
+	     0x48, 0xbb, 0x6d, 0x99, 0x34, 0xcd, 0xde, 0x62, 0xea, 0xb9,
+	     0x7e, 0x01, 0x1e, 0x44, 0x30, 0x9c, 0x1c, 0x12, 0xd5, 0x39,
+	     0x8c, 0x2b, 0x62, 0x9e, 0xab, 0x32, 0x95, 0x8b, 0x32, 0x66,
+	     0xe7, 0x25, 0xd3, 0xc6, 0x06, 0x8f, 0xdb, 0xa2, 0x1a, 0x6c,
+	     0xb5, 0xc0, 0x19, 0x00, 0x18, 0x86, 0x45, 0x0e, 0x21, 0x5e,
+	     0x43, 0x4f, 0xc8, 0x1d, 0x7a, 0xe6, 0xf0, 0x53, 0xc2, 0x0d,
+	     0xaa, 0xb0, 0x19, 0x50, 0x1a, 0xa2, 0xa2, 0x35, 0x88, 0x64,
+	     0xaa, 0xc1, 0xfc, 0xac, 0x69, 0x0a, 0x18, 0x1e, 0x9e, 0xc6,
+	     0xf1, 0xb6, 0x29, 0x3f, 0xc1, 0x3d, 0x24, 0x3d, 0x9e, 0x0e,
+	     0x4a, 0x0f, 0x4f, 0xcb, 0xc2, 0xef, 0x5d, 0x25, 0x4c, 0x30,
+	     0x9d, 0xfc, 0xb6, 0x3a, 0x8b, 0xde, 0xbc, 0x4f, 0x87, 0x69,
+	     0x11, 0x24, 0xe4, 0x1d, 0xeb, 0xec, 0xe0, 0x0b, 0xba, 0x85,
+	     0xe0, 0x38, 0x16, 0x53, 0xfe, 0x49, 0xe9, 0xf4, 0x58, 0x04,
+	     0x64, 0x56, 0x26, 0xfb, 0x19, 0xae, 0x26, 0x42, 0x9c, 0xdf,
+	     0x23, 0x14, 0x46, 0x83, 0x02, 0x5f, 0x56, 0x49, 0x8a, 0x3b,
+	     0x47, 0xaa, 0x9a, 0x0b, 0xbe, 0x70, 0x26, 0xd2, 0xdb, 0x42,
+	     0xcf, 0x48, 0xe5, 0x62, 0x1c, 0x59, 0xaf, 0x52, 0x10, 0x04,
+	     0x42, 0xb0, 0xa6, 0x6f, 0x8b, 0x10, 0x5a, 0x04, 0xe3, 0x4d,
+	     0xce, 0x9d, 0x6a, 0x14, 0xce, 0xa1, 0x8a, 0x49, 0xbd, 0x23,
+	     0x68, 0x84, 0x0f, 0x82, 0x2b, 0xbb, 0x3a, 0xd6, 0x65, 0x78,
+	     0xcc, 0x02, 0x40, 0x59, 0x94, 0xe6, 0xa8, 0x52, 0x42, 0x3c,
+	     0x67, 0xc4, 0x76, 0x44, 0xcc, 0x02, 0x53, 0xf7, 0xa0, 0x62,
+	     0x03, 0x15, 0x0f, 0xda, 0x99, 0xd8, 0xac, 0xd9, 0x80, 0x02,
+	     0x10, 0x43, 0xa0, 0x5b, 0xe2, 0x0a, 0xed, 0x21, 0x92, 0x12,
+	     0xbf, 0x41, 0x15, 0x63, 0x52, 0x28, 0xbc, 0x52, 0x42, 0xa2,
+	     0xb8, 0x84, 0x10, 0xa2, 0x34, 0xf9, 0x3f, 0x4d, 0x1d, 0xd6,
+	     0x25, 0xb8, 0xa0, 0xff, 0xb9, 0xb4, 0xb4, 0x24, 0xbb, 0x5e,
+	     0xd6, 0xa2, 0x81, 0x87, 0xdf, 0xc1, 0x08, 0x48, 0x41, 0xa3,
+	     0xcb, 0x18, 0x8f, 0xcc, 0x55, 0x47, 0xc5, 0xc5, 0x8b, 0x5d,
+	     0xc0, 0x11, 0x47, 0xb5, 0xf4, 0x39, 0xf9, 0xa9, 0xf6, 0x75,
+	     0xa8, 0x2f, 0xb9, 0x46, 0x38, 0x67, 0x9d, 0xb8, 0x66, 0x62,
+	     0x3f, 0x56, 0x28, 0xeb, 0x2e, 0xce, 0x86, 0xd2, 0xe1, 0x9e,
+	     0x2a, 0x4d, 0x40, 0x62, 0x88, 0x02, 0x8d, 0xb9, 0xfa, 0x76,
+	     0xf2, 0xc9, 0xcf, 0x92, 0xdc, 0x64, 0xc2, 0x60, 0xfd, 0x8b,
+	     0x1e, 0xbc, 0x06, 0x42, 0x81, 0x48, 0x91, 0x37, 0x86, 0x44,
+	     0x6f, 0x4c, 0x17, 0x16, 0x23, 0x78, 0xc5, 0xe4, 0x6a, 0x81,
+	     0x56, 0x32, 0x1c, 0x4d, 0x48, 0xcb, 0x26, 0x87, 0x04, 0x54,
+	     0x21, 0x30, 0x0f, 0x99, 0x8b, 0xc5, 0x13, 0x7b, 0x4f, 0x6e,
+	     0xec, 0xd4, 0xa5, 0x85, 0xa1, 0xe8, 0x14, 0x14, 0xc4, 0x66,
+	     0xad, 0x3d, 0xff, 0xe1, 0x32, 0x71, 0x40, 0x98, 0xef, 0x02,
+	     0xea, 0xdc, 0x25, 0x97, 0x26, 0x93, 0xb2, 0x69, 0x1c, 0xad,
+	     0x70, 0x25, 0x14, 0x8a, 0x5b, 0x47, 0xb4, 0x02, 0xf7, 0x19,
+	     0x25, 0x28, 0x1d, 0x0d, 0x8b, 0x6c, 0x0b, 0x40, 0xbc, 0x84,
+	     0x8a, 0xf1, 0x69, 0xce, 0x50, 0xad, 0x98, 0x53, 0xd4, 0xba,
+	     0x28, 0x81, 0xc2, 0xe2, 0x90, 0x6f, 0xb4, 0x7b, 0x90, 0x47,
+	     0x51, 0xc2, 0x93, 0x53, 0x06, 0xe1, 0x6e, 0x06, 0x69, 0x40,
+	     0x65, 0xd0, 0x15, 0xee, 0x52, 0xf6, 0x8c, 0x26, 0x90, 0x10,
+	     0xca, 0xb2, 0x57, 0x8a, 0xca, 0xa3, 0xd1, 0xfa, 0xde, 0x1f,
+	     0xd7, 0x08, 0x4e, 0xa5, 0xc8, 0x6e, 0xd0, 0x54, 0xc8, 0xb9,
+	     0x9b, 0x64, 0x94, 0xb2, 0x83, 0x9d, 0x0a, 0x05, 0xd6, 0x5d,
+	     0x4c, 0x09, 0xb4, 0xc7, 0x89, 0xe0, 0x0d, 0x1c, 0xe3, 0x63,
+	     0x69, 0xb6, 0x48, 0x07, 0x6d, 0xa4, 0xb3, 0x05, 0x72, 0x88,
+	     0x20, 0xd9, 0x0d, 0xf0, 0x89, 0xbc, 0xc4, 0x1a, 0x06, 0x3c,
+	     0xc8, 0x9e, 0xa9, 0x22, 0x8b, 0xf3, 0x1d, 0x58, 0x2e, 0x2c,
+	     0x09, 0x47, 0x4f, 0x10, 0x05, 0xc7, 0xc7, 0x54, 0xed, 0x20,
+	     0x25, 0x14, 0xcc, 0xec, 0x31, 0x39, 0x8d, 0x90, 0x63, 0x8c,
+	     0xe9, 0x96, 0x99, 0xcc, 0xe2, 0x8c, 0x61, 0x23, 0x79, 0x16,
+	     0x3d, 0x91, 0xbe, 0xa1, 0xfd, 0xca, 0xb9, 0xe4, 0x35, 0xf8,
+	     0x62, 0x18, 0x04, 0x3b, 0x00, 0x2f, 0x92, 0x2c, 0x45, 0x72,
+	     0x2b, 0xfb, 0x30, 0x1c, 0x9a, 0x72, 0x6c, 0x12, 0xf5, 0x5b,
+	     0xbd, 0x2a, 0x52, 0x88, 0xfa, 0xc6, 0xee, 0xc8, 0xa5, 0x08,
+	     0xf2, 0x9c, 0x16, 0x27, 0x61, 0xfd, 0x97, 0xa0, 0x4e, 0x4c,
+	     0xab, 0x1c, 0xf6, 0x64, 0xcb, 0x92, 0xd0, 0x3a, 0x5a, 0x23,
+	     0x1f, 0x3e, 0x4d, 0x4e, 0x6d, 0x09, 0x9c, 0x66, 0x89, 0x48,
+	     0x64, 0xf4, 0x35, 0x8f, 0x75, 0x38, 0x44, 0x9e, 0x5a, 0x90,
+	     0x4f, 0xbc, 0xf8, 0xda, 0x19, 0x22, 0x98, 0x2a, 0x63, 0x1b,
+	     0x08, 0xca, 0x57, 0x4d, 0x4f, 0xea, 0xf0, 0x85, 0x2d, 0x34,
+	     0x2c, 0xac, 0x0c, 0xff, 0x9b, 0x04, 0xc9, 0x39, 0x21, 0x4b,
+	     0x61, 0xac, 0xc8, 0x11, 0xe8, 0x91, 0xc4, 0x67, 0x20, 0x0f,
+	     0x75, 0x8c, 0x4b, 0xa6, 0x10, 0x80, 0xef, 0xa4, 0xf8, 0x02,
+	     0x1e, 0xc9, 0xa2, 0xd0, 0x78, 0x27, 0xa4, 0xfd, 0x8a, 0x2f,
+	     0xaf, 0x01, 0xc9, 0x24, 0x2b, 0xef, 0x98, 0x2c, 0xf9, 0x17,
+	     0xf4, 0xa9, 0x64, 0x12, 0x05, 0xec, 0xf1, 0xc5, 0x9a, 0x18,
+	     0x61, 0x2c, 0x3f, 0x34, 0x0f, 0x65, 0x26, 0x67, 0xc5, 0x84,
+	     0x51, 0x81, 0x96, 0x3c, 0x3c, 0x7b, 0x10, 0x8b, 0xaa, 0x92,
+	     0x74, 0x2c, 0x83, 0x5f, 0x3f, 0x8e, 0x42, 0xa3, 0x39, 0xe3,
+	     0xbc, 0x05, 0x94, 0xf6, 0x82, 0xc2, 0xb0, 0xa7, 0x44, 0x01,
+	     0xc7, 0x1c, 0x71, 0x11, 0x6b, 0xe2, 0x41, 0x25, 0xac, 0x8b,
+	     0xaa, 0x38, 0xe3, 0x65, 0xcd, 0x41, 0x45, 0xc3, 0x18, 0x4c,
+	     0x0a, 0x32, 0xf7, 0x82, 0x06, 0x8f, 0x43, 0x8e, 0x88, 0x3f,
+	     0x91, 0x91, 0xf8, 0x35, 0xa9, 0x06, 0x7e, 0x89, 0xb6, 0x02,
+	     0xc0, 0xac, 0x73, 0x0e, 0x96, 0x6b, 0xba, 0xb7, 0xd8, 0xcb,
+	     0xb4, 0xa5, 0x9b, 0xb2, 0x04, 0x2b, 0xc0, 0x93, 0x18, 0x55,
+	     0xe4, 0xf1, 0xb0, 0x90, 0xaa, 0xcc, 0x05, 0x90, 0x58, 0x33,
+	     0xc6, 0x45, 0xa0, 0x85, 0x9a, 0x09, 0xf3, 0xb6, 0x39, 0xc0,
+	     0x0c, 0x2e, 0x32, 0x3d, 0x88, 0x69, 0xb8, 0x48, 0x16, 0x9a,
+	     0xad, 0xa4, 0x18, 0xb1, 0x51, 0x63, 0x76, 0xe3, 0xae, 0x47,
+	     0x03, 0x4b, 0x0f, 0x61, 0x9f, 0x4f, 0x33, 0xb0, 0x09, 0x44,
+	     0x48, 0xc5, 0x72, 0xb2, 0x5a, 0xb2, 0x9c, 0x1e, 0x59, 0xc5,
+	     0xc2, 0xe8, 0xa6, 0xcd, 0xe8, 0x49, 0x84, 0xf7, 0xba, 0x9b,
+	     0x73, 0x8b, 0x2d, 0xc8, 0x32, 0xad, 0xfb, 0xf4, 0x1a, 0x74,
+	     0x8f, 0xd5, 0xd4, 0x08, 0x42, 0x17, 0x2e, 0x7a, 0x4a, 0xba,
+	     0x6b, 0x8e, 0xa3, 0xda, 0xd4, 0xf6, 0x18, 0x2c, 0x32, 0x0d,
+	     0x82, 0xbe, 0x31, 0x12, 0xb7, 0x4d, 0x9b, 0xe5, 0x14, 0x11,
+	     0xf8, 0xe1, 0xb1, 0xe4, 0x4b, 0x64, 0xc0, 0x1c, 0xe5, 0x9f,
+	     0x4b, 0xd7, 0xd0, 0x44, 0x80, 0xf0, 0xb1, 0xdf, 0x60, 0x6a,
+	     0x32, 0x1e, 0x61, 0xa3, 0x65, 0x81, 0x25, 0x12, 0xd7, 0x92,
+	     0x88, 0xe1, 0x20, 0x28, 0x2b, 0x2c, 0x21, 0x19, 0xdf, 0x53,
+	     0x0f, 0xc2, 0xd3, 0x37, 0x91, 0xbd, 0x85, 0x60, 0x88, 0x94,
+	     0x6c, 0x30, 0x98, 0x8e, 0x45, 0xe3, 0x3c, 0xb3, 0x90, 0xe9,
+	     0x56, 0xd2, 0x68, 0x60, 0x96, 0xa5, 0xac, 0xe2, 0xdf, 0xd3,
+	     0x6c, 0x67, 0xf6, 0x78, 0x42, 0x19, 0xfa, 0x35, 0xfd, 0x08,
+	     0xb7, 0xaa, 0x98, 0x15, 0x41, 0x47, 0x62, 0xe8, 0x7d, 0xd8,
+	     0x41, 0x96, 0x66, 0xae, 0x0e, 0x81, 0x4d, 0x9c, 0xce, 0x14,
+	     0x01, 0x7f, 0xc9, 0x5b, 0x99, 0x64, 0xf6, 0xda, 0x7c, 0x06,
+	     0xcd, 0x10, 0xd6, 0x97, 0xcb, 0x20, 0x31, 0xb4, 0xda, 0x6c,
+	     0x08, 0x4c, 0x02, 0x6c, 0x0a, 0x68, 0xa0, 0x50, 0x99, 0xa2,
+	     0xa6, 0xde, 0x24, 0x8e, 0xf4, 0x46, 0x8c, 0x1e, 0xfb, 0x3e,
+	     0x07, 0x3c, 0x9e, 0x58, 0x6c, 0x72, 0xef, 0xb3, 0x36, 0x60,
+	     0x4a, 0x88, 0x30, 0xc9, 0x21, 0xb8, 0x1a, 0xb7, 0x63, 0x6a,
+	     0xcd, 0xe5, 0x17, 0x8f, 0xc3, 0x51, 0xd5, 0x45, 0xfe, 0x58,
+	     0x86, 0x33, 0x28, 0x5a, 0x9c, 0xa3, 0xa2, 0x77, 0xb1, 0x40,
+	     0x26, 0xce, 0xf9, 0x52, 0x80, 0x0d, 0xac, 0xd7, 0xe3, 0xb2,
+	     0x72, 0xcc, 0x18, 0xf0, 0xd1, 0xf8, 0xc0, 0x43, 0xcc, 0x14,
+	     0x54, 0x8e, 0xba, 0xd7, 0x57, 0x85, 0xfe, 0xa6, 0x21, 0xda,
+	     0x11, 0x42, 0x0d, 0x79, 0x8d, 0xde, 0x36, 0x65, 0x0d, 0x72,
+	     0xf2, 0x84, 0x77, 0x94, 0x00, 0x2e, 0x91, 0x25, 0xd6, 0x63,
+	     0x4c, 0x84, 0x87, 0xa4, 0x85, 0x91, 0x38, 0x27, 0x96, 0xc1,
+	     0x22, 0x0e, 0xcc, 0xb8, 0x90, 0x99, 0x87, 0x26, 0xcf, 0x4a,
+	     0x45, 0x25, 0x58, 0xe1, 0x48, 0x46, 0xe2, 0x9e, 0xf8, 0x4f,
+	     0x5c, 0x07, 0x84, 0x19, 0x70, 0xce, 0xa7, 0xa9, 0x96, 0xab,
+	     0x2e, 0xb5, 0xdf, 0xc0, 0x65, 0xbf, 0x8a, 0xd9, 0x8b, 0xd1,
+	     0x4e, 0x86, 0xb9, 0x90, 0xdc, 0xf1, 0xd1, 0x36, 0x52, 0x79,
+	     0x1a, 0x89, 0x89, 0xa6, 0xec, 0x27, 0xa1, 0x29, 0xd9, 0x53,
+	     0xb6, 0x05, 0x11, 0x60, 0x38, 0x71, 0xc5, 0xf6, 0xc0, 0xe6,
+	     0xc4, 0x0e, 0x77, 0x04, 0x04, 0xdf, 0x2c, 0x9a, 0xd8, 0x99,
+	     0xb6, 0x9d, 0x68, 0xd5, 0x41, 0xa8, 0x62, 0xd8, 0xbf, 0xb8,
+	     0x5f, 0x66, 0x25, 0xc9, 0x89, 0xa1, 0x48, 0xd0, 0xc2, 0x4e,
+	     0xb1, 0x60, 0xb2, 0xba, 0x5c, 0xae, 0x00, 0x85, 0xea, 0x28,
+	     0x4a, 0x1d, 0xa0, 0x8a, 0xf7, 0x11, 0x22, 0xc3, 0x5f, 0x79,
+	     0x43, 0x1e, 0x4e, 0x1e, 0x7f, 0xf5, 0x1f, 0x3f, 0x84, 0x8d,
+	     0xb0, 0xbb, 0x47, 0x03, 0x14, 0x0e, 0x32, 0xbb, 0xd8, 0x5b,
+	     0xc8, 0xbc, 0x3b, 0xa2, 0xca, 0xd1, 0xe3, 0xd4, 0x17, 0xa2,
+	     0x1b, 0x76, 0xad, 0x8a, 0x33, 0x55, 0x27, 0x92, 0xa4, 0xa8,
+	     0x06, 0xd6, 0x68, 0x73, 0x19, 0xd3, 0xfc, 0x0a, 0xbf, 0x90,
+	     0xef, 0xb2, 0xdc, 0x43, 0xa6, 0x62, 0xb7, 0x74, 0xcd, 0x9c,
+	     0xf1, 0x19, 0x2d, 0x31, 0x99, 0x2f, 0x18, 0x05, 0x5b, 0x22,
+	     0xe1, 0xfb, 0x73, 0x00, 0xe3, 0xb4, 0x09, 0x0f, 0xde, 0x21,
+	     0x8b, 0xc4, 0x37, 0x1e, 0x27, 0x4c, 0x31, 0xa4, 0x4b, 0x49,
+	     0x72, 0x15, 0xc9, 0x7e, 0x96, 0x48, 0xad, 0xe4, 0xc8, 0xa3,
+	     0xa3, 0x5d, 0xd9, 0x57, 0xa1, 0x6b, 0x7a, 0xf9, 0x7e, 0x1c,
+	     0x6e, 0x34, 0xb8, 0xde, 0x86, 0x65, 0x07, 0x12, 0x7c, 0xab,
+	     0x9a, 0x99, 0x40, 0x5e, 0x9a, 0x17, 0x4a, 0x61, 0x8d, 0xdb,
+	     0x6b, 0x4b, 0x61, 0x1c, 0x21, 0x40, 0xd6, 0x40, 0x6a, 0x78,
+	     0xe9, 0x93, 0xbf, 0x25, 0x0e, 0xab, 0x9c, 0xd7, 0x75, 0xd9,
+	     0xf3, 0xac, 0xd4, 0x80, 0x9b, 0xd9, 0x3a, 0xe9, 0x9b, 0x2e,
+	     0x71, 0xd0, 0x35, 0x5d, 0x1b, 0xc2, 0x81, 0x32, 0x02, 0x07,
+	     0x6e, 0x1d, 0xac, 0x8d, 0xf4, 0xe8, 0x1b, 0x43, 0xc7, 0xeb,
+	     0x0e, 0x1d, 0xe0, 0x42, 0x7f, 0x98, 0x0b, 0xaa, 0xc1, 0xb6,
+	     0x67, 0x14, 0xc5, 0x33, 0x14, 0xb2, 0x15, 0x03, 0x73, 0x19,
+	     0xbc, 0xbe, 0xbd, 0x12, 0xe3, 0x25, 0x39, 0x27, 0xde, 0x40,
+	     0xfb, 0x7d, 0x19, 0x80, 0x6b, 0x6c, 0xc4, 0xa4, 0xa4, 0x68,
+	     0xc4, 0x20, 0x00, 0x43, 0x6c, 0x23, 0x21, 0x40, 0x3a, 0x4d,
+	     0xca, 0xbb, 0x04, 0xc4, 0x06, 0x82, 0x88, 0x83, 0x86, 0xa4,
+	     0xc2, 0x5c, 0x4c, 0x78, 0x96, 0xc5, 0x29, 0x0c, 0xc2, 0x00,
+	     0x2a, 0xd5, 0x87, 0x6d, 0x19, 0x9c, 0x58, 0xe2, 0xee, 0x75,
+	     0xf6, 0xc5, 0x5a, 0x80, 0x2a, 0x80, 0x88, 0x98, 0x68, 0x6b,
+	     0x5a, 0x6e, 0x1e, 0x76, 0x5b, 0xb1, 0x83, 0x04, 0xd6, 0x17,
+	     0xa5, 0x40, 0x38, 0xaa, 0xec, 0x89, 0xd9, 0x28, 0xfe, 0x2f,
+	     0x12, 0xa1, 0x3a, 0x14, 0x5a, 0x6a, 0x38, 0xa7, 0x09, 0xe2,
+	     0x23, 0x2a, 0x23, 0xfe, 0x02, 0x3c, 0x1c, 0x41, 0x96, 0x5b,
+	     0x23, 0xc9, 0xb7, 0x37, 0x3c, 0x9b, 0xcc, 0x55, 0x82, 0x02,
+	     0xe9, 0x9b, 0x9c, 0x4d, 0x08, 0x92, 0x2a, 0xb6, 0xbf, 0x6c,
+	     0x97, 0x55, 0x29, 0xe7, 0x50, 0xa8, 0xcb, 0x18, 0x20, 0x4d,
+	     0xc3, 0xaf, 0x97, 0x6a, 0x99, 0x02, 0x5e, 0x1f, 0x7d, 0x43,
+	     0x64, 0x13, 0x3a, 0x8b, 0xaf, 0x4e, 0xa2, 0x26, 0xc4, 0x20,
+	     0x04, 0x6e, 0xa9, 0x66, 0x90, 0x56, 0x38, 0xa4, 0x63, 0x10,
+	     0x2d, 0xea, 0x61, 0xd4, 0x54, 0xda, 0xcd, 0x36, 0xdf, 0x0b,
+	     0x06, 0xa3, 0x31, 0xd9, 0xdd, 0x43, 0xbc, 0xa3, 0x80, 0x14,
+	     0x5d, 0xca, 0x85, 0x46, 0x0a, 0xff, 0x11, 0xba, 0xe4, 0xe8,
+	     0x06, 0xda, 0x64, 0xf3, 0x40, 0x0f, 0xb1, 0x0c, 0xbb, 0x62,
+	     0x43, 0x36, 0x40, 0x98, 0xc2, 0xad, 0xaf, 0x77, 0x26, 0xa3,
+	     0x66, 0x7d, 0x16, 0xfb, 0x8a, 0xe1, 0xb5, 0x26, 0x80, 0xea,
+	     0x65, 0x4d, 0x05, 0xc7, 0x34, 0x30, 0x76, 0xa1, 0xd4, 0x1f,
+	     0x9f, 0xbe, 0xf0, 0x94, 0x65, 0xeb, 0xa9, 0x90, 0x7b, 0x52,
+	     0xb8, 0x48, 0x57, 0x6c, 0x26, 0x0e, 0x82, 0x68, 0xdb, 0xa4,
+	     0xc2, 0xba, 0xf9, 0xbd, 0x62, 0x18, 0x7c, 0xf0, 0x58, 0x68,
+	     0x53, 0x4d, 0x5a, 0x88, 0x87, 0xae, 0x16, 0x86, 0xf1, 0x51,
+	     0x18, 0xe8, 0x20, 0x28, 0x52, 0xbf, 0x48, 0xed, 0xd9, 0xcb,
+	     0x4d, 0xcd, 0x45, 0x4b, 0xc1, 0x42, 0x01, 0x46, 0x46, 0x73,
+	     0x00, 0x99, 0x07, 0xcb, 0xbf, 0xa9, 0x1a, 0x41, 0x34, 0x39,
+	     0x97, 0x55, 0x1b, 0x13, 0x1b, 0xfd, 0xc0, 0x3d, 0x19, 0x64,
+	     0x8d, 0x31, 0x26, 0x6b, 0x6a, 0x47, 0x0e, 0x38, 0x5e, 0x80,
+	     0x16, 0x84, 0x2b, 0xcf, 0xab, 0xe7, 0x32, 0x33, 0xc1, 0x42,
+	     0x37, 0xc1, 0x2d, 0xaf, 0x77, 0x1f, 0xaa, 0x5a, 0x1a, 0xe8,
+	     0x6d, 0x5a, 0x47, 0xd8, 0x0b, 0x8f, 0x20, 0x1c, 0xf2, 0x2b,
+	     0xba, 0xbb, 0x2f, 0x22, 0xca, 0x09, 0xaf, 0xa2, 0xae, 0x53,
+	     0xb1, 0x8c, 0x2a, 0x6a, 0x23, 0x42, 0x8b, 0x82, 0x04, 0x1d,
+	     0x20, 0xf3, 0x05, 0xcc, 0x54, 0xfc, 0x58, 0x25, 0x36, 0x16,
+	     0x02, 0xb3, 0x69, 0x46, 0x4a, 0x0e, 0xe4, 0x17, 0x9e, 0x63,
+	     0xf3, 0xf1, 0x84, 0x40, 0x2a, 0x1e, 0x02, 0x0a, 0x59, 0x2e,
+	     0x8d, 0x44, 0xb4, 0x7a, 0xeb, 0x53, 0x5c, 0x83, 0x2e, 0x90,
+	     0xe0, 0xb5, 0x83, 0x1c, 0x28, 0x45, 0xc9, 0x42, 0x8f, 0x08,
+	     0x25, 0x36, 0x27, 0x65, 0x80, 0x50, 0x06, 0xb2, 0x4c, 0x72,
+	     0xa2, 0xfe, 0xb1, 0x48, 0x79, 0xa2, 0x50, 0xe1, 0x20, 0x8a,
+	     0x92, 0x0e, 0xa9, 0x56, 0x42, 0x63, 0xdd, 0x08, 0x8d, 0x9b,
+	     0x1a, 0x82, 0xa0, 0x02, 0x7a, 0x93, 0x41, 0xab, 0x02, 0x35,
+	     0xf1, 0xab, 0x76, 0x94, 0xa1, 0x5c, 0x4a, 0xd5, 0xa6, 0x7e,
+	     0x36, 0x87, 0xe5, 0x21, 0x3d, 0xac, 0xc4, 0x40, 0x55, 0xec,
+	     0x00, 0xaa, 0xae, 0xa8, 0x8b, 0x1b, 0x0d, 0xdc, 0xd8, 0xc7,
+	     0x02, 0x18, 0x03, 0x01, 0xf0, 0x74, 0x25, 0x98, 0x26, 0x5f,
+	     0x64, 0x0e, 0x69, 0xc5, 0x94, 0x0a, 0x3e, 0xe5, 0x8d, 0x43,
+	     0x6e, 0x9c, 0xdc, 0x76, 0x8c, 0x30, 0x0f, 0x44, 0xe3, 0x3b,
+	     0x47, 0x6f, 0xa3, 0xc3, 0xa9, 0x64, 0xd2, 0x1d, 0xc5, 0x22,
+	     0xd4, 0xb6, 0x8d, 0x8f, 0xe1, 0xc3, 0x4e, 0xc9, 0x8f, 0x1c,
+	     0xf0, 0x6c, 0x77, 0x6a, 0x97, 0x92, 0x3e, 0x4e, 0x10, 0x09,
+	     0x8f, 0x34, 0x53, 0xf5, 0x93, 0xd8, 0x5d, 0x42, 0x4e, 0x14,
+	     0x5c, 0x37, 0x04, 0x64, 0x9e, 0xce, 0x8e, 0x06, 0x89, 0xb3,
+	     0xaf, 0xec, 0xe9, 0x4e, 0x06, 0xa3, 0x1a, 0xb4, 0x1a, 0xdc,
+	     0x61, 0xf6, 0x76, 0x8a, 0x19, 0xfe, 0xac, 0x1c, 0x28, 0x5a,
+	     0xd7, 0xb9, 0x17, 0x51, 0x6d, 0x2a, 0xee, 0x42, 0xad, 0x32,
+	     0x12, 0x80, 0x59, 0xd0, 0x04, 0x5d, 0x16, 0xd6, 0xe3, 0xcf,
+	     0x87, 0x1a, 0x71, 0x8d, 0xc3, 0x09, 0xaa, 0x15, 0xbb, 0x53,
+	     0x5c, 0x1b, 0x46, 0xe1, 0x33, 0x2c, 0xa4, 0xc1, 0xc1, 0x48,
+	     0xb5, 0xa5, 0x12, 0x58, 0x49, 0x0b, 0x36, 0x45, 0x5b, 0xc6,
+	     0xa1, 0xfc, 0xc8, 0x77, 0x74, 0x74, 0x4c, 0x19, 0x11, 0x87,
+	     0x90, 0x34, 0x83, 0x06, 0xd2, 0x6d, 0xd3, 0x54, 0xc0, 0x44,
+	     0xf9, 0xe5, 0xa3, 0x08, 0x12, 0x26, 0xaa, 0x5a, 0x86, 0xe6,
+	     0x0b, 0x82, 0xd3, 0xa4, 0xc3, 0x4f, 0x94, 0x24, 0xbe, 0x5d,
+	     0x05, 0x25, 0x14, 0x61, 0xeb, 0xac, 0xdd, 0x96, 0x9b, 0xc2,
+	     0x45, 0x2c, 0xfb, 0xf2, 0x89, 0x84, 0x17, 0xf2, 0xa1, 0xd1,
+	     0x27, 0x38, 0x44, 0xfb, 0x68, 0x4b, 0xc5, 0x2b, 0x91, 0x03,
+	     0xb1, 0x4b, 0xe2, 0x4f, 0xeb, 0x2e, 0x5b, 0xd6, 0x16, 0x38,
+	     0x48, 0x72, 0x3f, 0x30, 0x34, 0xe0, 0x90, 0xd4, 0x83, 0x93,
+	     0x45, 0xa4, 0x04, 0x67, 0x34, 0xa5, 0x79, 0x1c, 0xb6, 0x57,
+	     0x1d, 0x39, 0xc5, 0x8e, 0x9a, 0x62, 0xe0, 0x96, 0x10, 0x8c,
+	     0x31, 0x2a, 0xdd, 0x42, 0x5d, 0x9f, 0x1f, 0x82, 0xdf, 0x02,
+	     0xe1, 0x49, 0x41, 0xac, 0x92, 0x53, 0xcd, 0xd5, 0xa4, 0x9b,
+	     0x71, 0x84, 0x39, 0x5a, 0x60, 0xa7, 0x2b, 0x54, 0xe1, 0xfb,
+	     0xea, 0x49, 0x67, 0x70, 0x2e, 0xfd, 0x9c, 0x5a, 0x4c, 0x5b,
+	     0xb1, 0xfa, 0x91, 0x08, 0xcc, 0x33, 0x96, 0x55, 0xe0, 0x23,
+	     0x7e, 0x90, 0x46, 0xc7, 0xb4, 0xc5, 0x76, 0xf7, 0xae, 0x21,
+	     0x7d, 0x80, 0x68, 0x06, 0x5a, 0x5e, 0xb7, 0x5e, 0x45, 0x48,
+	     0x8d, 0x46, 0x04, 0x1a, 0x0a, 0xe8, 0x44, 0x30, 0x5d, 0x32,
+	     0x9f, 0x38, 0x67, 0x25, 0xae, 0xa9, 0xeb, 0x48, 0x2d, 0xa3,
+	     0x14, 0x18, 0x28, 0xdf, 0x2d, 0x69, 0x10, 0xa2, 0xc7, 0xdb,
+	     0xea, 0xdc, 0x41, 0x41, 0x4a, 0x39, 0x42, 0x99, 0xee, 0x25,
+	     0xee, 0xa7, 0xfa, 0xd8, 0xb6, 0x89, 0xe9, 0x41, 0x2b, 0x88,
+	     0xa8, 0x4d, 0x46, 0x58, 0x4a, 0x98, 0x21, 0xd0, 0x59, 0x0c,
+	     0x6e, 0xdc, 0x65, 0x09, 0x59, 0x4e, 0xb8, 0xae, 0x38, 0x34,
+	     0x3f, 0x02, 0xb3, 0xd7, 0x27, 0xe6, 0x06, 0x79, 0x71, 0x53,
+	     0xcb, 0xfc, 0xd6, 0x52, 0x4a, 0x0b, 0x32, 0x68, 0x5a, 0x24,
+	     0xcd, 0x87, 0x59, 0x7c, 0x80, 0x22, 0x86, 0x09, 0xba, 0x1a,
+	     0xff, 0x12, 0x0d, 0x4d, 0x87, 0x89, 0x1e, 0xe4, 0xd5, 0xc9,
+	     0x67, 0x36, 0x36, 0x56, 0x1f, 0x60, 0x1e, 0x31, 0x06, 0x14,
+	     0x43, 0xb4, 0x76, 0x68, 0x9b, 0x43, 0x10, 0x14, 0xd0, 0x57,
+	     0x08, 0x34, 0xd7, 0xdb, 0x47, 0xa9, 0x41, 0x48, 0x92, 0xc3,
+	     0x21, 0xed, 0x35, 0xf5, 0x20, 0xc3, 0x89, 0xd5, 0xc1, 0x82,
+	     0xab, 0x45, 0xf0, 0xcc, 0xe2, 0xa8, 0x14, 0xa6, 0xa6, 0x09,
+	     0x41, 0xcc, 0xc3, 0x65, 0xea, 0xe4, 0x74, 0x75, 0xd7, 0x80,
+	     0x02, 0x70, 0x67, 0x9c, 0x97, 0x92, 0xc8, 0x38, 0xcf, 0x9c,
+	     0xec, 0x90, 0xb6, 0xa1, 0x51, 0x15, 0x29, 0x71, 0x86, 0x4f,
+	     0xc3, 0x2c, 0x14, 0x9c, 0xa2, 0x4c, 0x00, 0xf3, 0xc8, 0x53,
+	     0xaa, 0xc0, 0xa4, 0x7a, 0x1c, 0xfd, 0x80, 0x4c, 0x47, 0xa1,
+	     0x22, 0xa9, 0x46, 0xfd, 0xa1, 0x6e, 0x05, 0xf6, 0xf4, 0x0d,
+	     0xd8, 0x85, 0x44, 0x85, 0x45, 0x0d, 0x16, 0x86, 0x93, 0xf0,
+	     0x5c, 0x31, 0x17, 0x36, 0x5e, 0x28, 0x04, 0xe1, 0x63, 0xdd,
+	     0x24, 0x54, 0x49, 0x84, 0x73, 0x4c, 0xce, 0x86, 0x48, 0x59,
+	     0xfb, 0x33, 0x58, 0x9b, 0x5b, 0xa4, 0x22, 0xb9, 0x10, 0x11,
+	     0x20, 0xd9, 0xfd, 0xa8, 0x24, 0x52, 0x9f, 0xc3, 0x9e, 0xe4,
+	     0xf0, 0xed, 0x80, 0xc6, 0x88, 0x13, 0x75, 0xca, 0x4e, 0x0c,
+	     0xe7, 0x17, 0xe7, 0x5f, 0x15, 0x28, 0x22, 0xc2, 0xb7, 0xd2,
+	     0x75, 0xdc, 0x40, 0xc6, 0x16, 0x08, 0xc1, 0x65, 0x57, 0xe1,
+	     0x84, 0xbb, 0x48, 0xa1, 0x94, 0x99, 0x0c, 0x53, 0x98, 0x83,
+	     0x6c, 0x01, 0x3e, 0x54, 0xf0, 0x08, 0xdb, 0x65, 0x32, 0xda,
+	     0xee, 0x6d, 0xf5, 0xb4, 0x6d, 0x44, 0xc7, 0xd2, 0xe2, 0xdc,
+	     0x45, 0xfb, 0xf8, 0x8e, 0xdc, 0xd4, 0xc8, 0x34, 0x73, 0x82,
+	     0xe0, 0xc7, 0xf5, 0xc7, 0x65, 0x93, 0x51, 0xf3, 0x94, 0x69,
+	     0xd8, 0x09, 0x1a, 0x86, 0x3d, 0x66, 0xc3, 0xf0, 0x23, 0x17,
+	     0xf3, 0x24, 0x00, 0xa2, 0xeb, 0xe3, 0x08, 0x5a, 0x32, 0x3a,
+	     0xf0, 0x8b, 0x78, 0xdb, 0x40, 0x4e, 0x48, 0xa9, 0x66, 0xd8,
+	     0x71, 0x20, 0x16, 0x27, 0x5a, 0xc9, 0x20, 0xd8, 0x60, 0x32,
+	     0x65, 0x48, 0x79, 0xb4, 0x53, 0x8e, 0x38, 0x79, 0x28, 0x39,
+	     0xda, 0x09, 0x4b, 0x53, 0xba, 0x01, 0x7e, 0x67, 0xff, 0xb1,
+	     0xc3, 0x1c, 0x88, 0x7e, 0x68, 0xa0, 0x9d, 0xba, 0xc4, 0x0a,
+	     0xc2, 0x88, 0x25, 0x4b, 0x41, 0x4b, 0x68, 0xcd, 0x1e, 0x89,
+	     0x9f, 0x1a, 0x94, 0xd4, 0x39, 0x10, 0x00, 0x48, 0x28, 0x4b,
+	     0x06, 0x44, 0x17, 0xee, 0x2b, 0x5f, 0x47, 0xce, 0x8f, 0xa8,
+	     0xc9, 0xfc, 0x14, 0x1f, 0xd0, 0x68, 0xac, 0xee, 0x3c, 0x66,
+	     0x51, 0xa6, 0xf4, 0x5c, 0x14, 0x61, 0xdf, 0x20, 0xa8, 0xaa,
+	     0x34, 0x66, 0x1a, 0xc3, 0x8d, 0x44, 0x1e, 0xa2, 0x5f, 0x31,
+	     0xc4, 0xbe, 0x91, 0xce, 0x4a, 0x42, 0x31, 0x9f, 0x42, 0x16,
+	     0x96, 0x93, 0xf9, 0x42, 0xa5, 0xe1, 0xc7, 0x88, 0x78, 0x83,
+	     0x2b, 0xae, 0x21, 0x48, 0x1d, 0x07, 0x29, 0x11, 0x53, 0x0a,
+	     0x06, 0xd7, 0x35, 0x79, 0xe9, 0x1c, 0x29, 0x03, 0xfa, 0x8d,
+	     0xd0, 0x3e, 0x29, 0xe5, 0xe4, 0x88, 0x6b, 0xa9, 0xa4, 0xa1,
+	     0x62, 0xb1, 0x08, 0x58, 0x47, 0x0c, 0x97, 0xdb, 0xcf, 0x69,
+	     0x4c, 0xf4, 0x61, 0x91, 0x31, 0x3e, 0x3d, 0x10, 0x45, 0x1e,
+	     0x8f, 0x42, 0xf3, 0x54, 0x32, 0x6f, 0x8a, 0xe5, 0xa0, 0xb2,
+	     0x2b, 0x61, 0xe2, 0x74, 0x4a, 0x1e, 0x4d, 0x2d, 0xd8, 0x04,
+	     0x4c, 0xbb, 0xc5, 0x47, 0x43, 0x51, 0x0e, 0x0c, 0x9c, 0x84,
+	     0x9f, 0x80, 0x6f, 0x44, 0x98, 0xe8, 0xe1, 0x97, 0xc9, 0xc8,
+	     0x6f, 0x6c, 0x59, 0x1c, 0x7e, 0xfb, 0x41, 0x3e, 0x9b, 0xbc,
+	     0xed, 0xcb, 0x51, 0x14, 0x09, 0xab, 0x84, 0xad, 0x46, 0x3d,
+	     0x52, 0x8a, 0x13, 0x0f, 0x64, 0xe1, 0x25, 0xf0, 0x4a, 0x74,
+	     0x24, 0x26, 0x8a, 0x76, 0x68, 0xa2, 0x21, 0x15, 0x9c, 0x18,
+	     0x49, 0x73, 0xe2, 0xf1, 0x60, 0x2d, 0x15, 0x0f, 0x3b, 0x0f,
+	     0xfd, 0x48, 0xa1, 0xc0, 0x36, 0x4d, 0xc7, 0xd5, 0x5d, 0x12,
+	     0x5d, 0x30, 0x4a, 0x50, 0x50, 0xf2, 0x45, 0xef, 0x0c, 0xec,
+	     0x28, 0xbd, 0x49, 0xff, 0x63, 0x73, 0x24, 0x8c, 0x6a, 0x68,
+	     0xed, 0xb3, 0xdf, 0x06, 0x9b, 0x8c, 0x29, 0x73, 0x8e, 0xc0,
+	     0x54, 0xf9, 0xff, 0xea, 0x82, 0x4b, 0xa1, 0x6b, 0x85, 0x3a,
+	     0x4d, 0xa3, 0xb9, 0x47, 0xb2, 0x51, 0xc5, 0x8d, 0x72, 0x7e,
+	     0x59, 0x39, 0xe7, 0xe2, 0x81, 0xce, 0xb8, 0xa0, 0xc8, 0x52,
+	     0x0f, 0xc0, 0x38, 0xaa, 0x56, 0x4e, 0x9a, 0x02, 0x4a, 0x4c,
+	     0xd0, 0xe2, 0x78, 0xe3, 0x59, 0xee, 0xb9, 0x4a, 0xf2, 0x0b,
+	     0xbf, 0x39, 0xbd, 0x4b, 0xf3, 0x12, 0xb3, 0x52, 0x28, 0xa2,
+	     0x0f, 0x20, 0xaa, 0x20, 0x07, 0xc8, 0x1b, 0x9e, 0x46, 0xd7,
+	     0xc1, 0x93, 0xf5, 0x9e, 0x11, 0x1f, 0x16, 0x37, 0x55, 0x5f,
+	     0xb6, 0x92, 0xbd, 0xc0, 0xe3, 0x4e, 0xb6, 0xf2, 0x88, 0xa3,
+	     0x91, 0x00, 0x7e, 0xee, 0x6d, 0x72, 0x8a, 0x4b, 0x8f, 0xd1,
+	     0x29, 0x71, 0xb8, 0x2d, 0x8a, 0x5f, 0xac, 0xb9, 0xc6, 0x5e,
+	     0x2d, 0x0a, 0xa9, 0xe6, 0xb4, 0x84, 0x26, 0x20, 0xba, 0x09,
+	     0x01, 0xfd, 0x2e, 0xd0, 0x4a, 0xfa, 0xca, 0xa8, 0x0c, 0x5e,
+	     0x0d, 0x8f, 0x16, 0xb5, 0xdb, 0x6e, 0x24, 0x22, 0x99, 0x67,
+	     0xba, 0x87, 0xf1, 0x99, 0xca, 0x88, 0x9b, 0x69, 0x6a, 0x7a,
+	     0xa1, 0x6c, 0x4d, 0xdc, 0x4b, 0xff, 0x3f, 0x10, 0x15, 0xcf,
+	     0x31, 0x22, 0xf9, 0xc9, 0x18, 0xa1, 0x14, 0x0b, 0xb9, 0x54,
+	     0xbe, 0x27, 0xed, 0x0b, 0xb5, 0xf0, 0xba, 0xf8, 0x46, 0x0a,
+	     0xa6, 0xa0, 0xe3, 0x62, 0x15, 0xbd, 0x2f, 0x7a, 0x52, 0x5c,
+	     0xa5, 0x77, 0xd1, 0x7f, 0x78, 0x58, 0xee, 0xe4, 0x2e, 0x01,
+	     0x24, 0x20, 0xa0, 0x80, 0x12, 0x10, 0xc7, 0x77, 0x52, 0x1b,
+	     0x2c, 0xf6, 0xa9, 0x90, 0x06, 0xf3, 0x16, 0x31, 0x99, 0xaf,
+	     0xf0, 0xf2, 0x96, 0x81, 0xd1, 0xf0, 0xe5, 0x10, 0x5f, 0x67,
+	     0x96, 0x42, 0xfc, 0x0d, 0xe6, 0x00, 0x28, 0x48, 0x58, 0x61,
+	     0x41, 0x39, 0xec, 0xc2, 0x0b, 0x67, 0x49, 0x4e, 0x19, 0xc7,
+	     0x24, 0x75, 0xe4, 0x31, 0x30, 0x4c, 0x96, 0x6a, 0x3a, 0x4e,
+	     0x87, 0x0e, 0x0a, 0x8f, 0x86, 0xf1, 0x19, 0xa1, 0x94, 0x22,
+	     0x6d, 0x35, 0xfb, 0x70, 0x3d, 0xb2, 0x02, 0x98, 0xc1, 0x2a,
+	     0x73, 0x49, 0x72, 0xc7, 0x03, 0x06, 0x3c, 0x40, 0x68, 0x47,
+	     0x83, 0x33, 0x8c, 0x65, 0xba, 0xc8, 0x55, 0x71, 0xe3, 0x22,
+	     0x3a, 0xfd, 0x2a, 0x33, 0x61, 0x13, 0xb2, 0x2e, 0x0d, 0x81,
+	     0xc0, 0x40, 0xd6, 0x2a, 0x02, 0x3c, 0x26, 0xe3, 0xa4, 0x11,
+	     0xc6, 0xad, 0x5a, 0x81, 0x48, 0x0d, 0xd3, 0x12, 0x9f, 0xe2,
+	     0x33, 0xd0, 0x4f, 0xb8, 0x7c, 0x54, 0xa8, 0x15, 0x81, 0xf2,
+	     0x88, 0x29, 0xa8, 0x33, 0x91, 0x5c, 0x39, 0x01, 0x51, 0x5e,
+	     0x7e, 0xca, 0x55, 0x96, 0xd9, 0x6d, 0x36, 0x77, 0xd7, 0x09,
+	     0xb5, 0x0c, 0x30, 0x8f, 0x47, 0x93, 0x37, 0xf1, 0xe4, 0xa4,
+	     0x2b, 0xd1, 0xb4, 0x6c, 0xeb, 0xa5, 0x31, 0x54, 0xb4, 0x26,
+	     0xe9, 0x15, 0x82, 0x66, 0x2c, 0x8d, 0xc4, 0x14, 0x10, 0x5a,
+	     0x31, 0x10, 0x12, 0xdd, 0x79, 0xc5, 0xaf, 0x62, 0xe2, 0x99,
+	     0x00, 0x95, 0xe7, 0x4a, 0xb1, 0x35, 0xe5, 0xc9, 0xea, 0x96,
+	     0x51, 0x17, 0x7c, 0x59, 0x24, 0xa4, 0x75, 0x99, 0x76, 0x24,
+	     0xc1, 0x18, 0x1e, 0x34, 0x05, 0xc6, 0x8e, 0xc5, 0x42, 0xc6,
+	     0x10, 0x78, 0x09, 0xc1, 0x83, 0x27, 0x3d, 0x12, 0x58, 0x66,
+	     0xb0, 0x07, 0xa8, 0x50, 0x82, 0x20, 0x16, 0x02, 0x09, 0x2b,
+	     0xe3, 0x70, 0x5e, 0x0c, 0x40, 0x1d, 0x1f, 0x33, 0x0a, 0x07,
+	     0x00, 0xf9, 0xd7, 0x0a, 0xb3, 0x27, 0x32, 0x2c, 0x16, 0x4b,
+	     0x5a, 0x85, 0x2d, 0x97, 0x4b, 0x0e, 0x96, 0x10, 0x77, 0xcc,
+	     0x1f, 0xdc, 0x86, 0x42, 0x4c, 0xb3, 0xb4, 0xee, 0x47, 0x25,
+	     0x72, 0xa1, 0x96, 0x19, 0x58, 0xa7, 0xc8, 0xe9, 0xd2, 0x1a,
+	     0x2b, 0x46, 0x8c, 0x58, 0x8f, 0xc2, 0x9c, 0xe2, 0x20, 0x72,
+	     0xb5, 0x3c, 0xb4, 0xb8, 0x6b, 0x9d, 0x9e, 0xf6, 0x84, 0xd2,
+	     0x68, 0x95, 0xe0, 0xa6, 0xa8, 0x38, 0x32, 0xa3, 0x04, 0x83,
+	     0x9d, 0x9f, 0xbf, 0xd5, 0xcc, 0x90, 0x35, 0xd6, 0x15, 0x5c,
+	     0x00, 0x22, 0x0e, 0xa0, 0x65, 0xe0, 0xb3, 0x92, 0x40, 0x68,
+	     0x33, 0x28, 0xe8, 0xf3, 0x99, 0xd1, 0x1d, 0x02, 0xef, 0x32,
+	     0x86, 0xaa, 0x3c, 0x4b, 0xf5, 0xc1, 0x08, 0xb6, 0xd4, 0xec,
+	     0xc4, 0x64, 0x41, 0xb0, 0x19, 0x1d, 0x01, 0x5e, 0x56, 0xd3,
+	     0x23, 0x50, 0xb4, 0x43, 0x70, 0x57, 0x7e, 0xfe, 0x7a, 0x9a,
+	     0xfb, 0xaa, 0xd6, 0x96, 0xea, 0xed, 0x9b, 0x94, 0x38, 0x91,
+	     0x14, 0x66, 0x1b, 0xe4, 0x31, 0x0d, 0x44, 0x8e, 0x98, 0x1d,
+	     0xac, 0x73, 0xa6, 0xef, 0xe8, 0x65, 0xf2, 0x20, 0xa7, 0x5c,
+	     0x88, 0x24, 0x40, 0x93, 0x64, 0x2a, 0x18, 0x72, 0x1f, 0x83,
+	     0xb9, 0x84, 0x85, 0xd4, 0x15, 0x6d, 0xc1, 0x1c, 0x48, 0x3e,
+	     0xe7, 0xad, 0x54, 0x76, 0x14, 0xa2, 0x4c, 0x73, 0x02, 0x52,
+	     0xd8, 0x00, 0xe6, 0x89, 0x33, 0x67, 0xbd, 0xe0, 0x4f, 0x60,
+	     0x96, 0x9d, 0xe6, 0x06, 0x6a, 0xe1, 0x4c, 0xd0, 0xa0, 0xbe,
+	     0x8a, 0x12, 0xa0, 0x87, 0x91, 0xdb, 0x10, 0xb8, 0x66, 0x79,
+	     0x91, 0xa4, 0xf3, 0x5b, 0x9f, 0xe1, 0xf7, 0xc3, 0x15, 0x9b,
+	     0x58, 0x38, 0x5f, 0x9e, 0x07, 0xce, 0x98, 0x44, 0x17, 0xaa,
+	     0x4d, 0x26, 0xd8, 0x39, 0x5c, 0x34, 0x7a, 0x24, 0xaf, 0x1c,
+	     0xe5, 0x23, 0xe4, 0x52, 0xd3, 0x66, 0xf0, 0x27, 0xe2, 0x38,
+	     0x05, 0x25, 0xe2, 0xe8, 0x0f, 0x8f, 0x3e, 0xb9, 0xd9, 0x9e,
+	     0x89, 0x5b, 0xf2, 0x93, 0xdc, 0x1a, 0x94, 0x43, 0x00, 0x33,
+	     0x44, 0x2a, 0x80, 0x19, 0x9a, 0x49, 0x45, 0xd7, 0x69, 0x08,
+	     0x30, 0x3a, 0xe1, 0xc4, 0x7f, 0x40, 0x3d, 0xe4, 0x61, 0xae,
+	     0x42, 0x50, 0x74, 0x37, 0x7a, 0xbc, 0x39, 0x14, 0x94, 0x8e,
+	     0x44, 0x02, 0x14, 0x96, 0x20, 0xaf, 0x35, 0x49, 0x9f, 0xc9,
+	     0x06, 0xd4, 0x7e, 0x6c, 0x83, 0x83, 0xac, 0xf3, 0x0a, 0x40,
+	     0x23, 0x75, 0xd0, 0x3d, 0xe3, 0x50, 0x09, 0xb5, 0xea, 0x33,
+	     0xf2, 0x44, 0xee, 0x46, 0xdd, 0x2e, 0xff, 0x56, 0x16, 0xf9,
+	     0xd3, 0xb5, 0xb5, 0xf0, 0x23, 0x18, 0x46, 0x9b, 0x90, 0x9b,
+	     0x8e, 0x21, 0xe2, 0x5e, 0xd3, 0x2d, 0x62, 0xb5, 0x94, 0x3b,
+	     0xec, 0xbb, 0x0b, 0x9b, 0x54, 0x32, 0x9b, 0x48, 0x3f, 0xf3,
+	     0xd4, 0x41, 0x32, 0xe2, 0x28, 0xd2, 0xa2, 0x2b, 0x45, 0x5f,
+	     0x2b, 0x5e, 0x98, 0x5f, 0x7b, 0x29, 0x68, 0x1e, 0x6b, 0x98,
+	     0xdd, 0x01, 0xaa, 0xc3, 0xc5, 0x6e, 0x4d, 0x53, 0x59, 0x41,
+	     0x32, 0x84, 0x43, 0x7a, 0x4d, 0x1a, 0x17, 0x22, 0x1f, 0x7b,
+	     0x65, 0x13, 0xb7, 0x8f, 0xb8, 0xc9, 0x21, 0x20, 0x78, 0x11,
+	     0x20, 0x0d, 0x17, 0x42, 0x76, 0x67, 0xc8, 0xd5, 0x86, 0x54,
+	     0x03, 0x72, 0xd2, 0xcc, 0x2d, 0x8b, 0x95, 0xe0, 0x95, 0x3d,
+	     0x69, 0x82, 0x23, 0x0f, 0x1b, 0xd1, 0xb9, 0xfb, 0xda, 0x28,
+	     0xf2, 0x3b, 0x3b, 0x8d, 0x73, 0x25, 0xd2, 0x43, 0xed, 0xc3,
+	     0xde, 0x1c, 0x2c, 0x45, 0x46, 0x47, 0x3c, 0xde, 0x5b, 0xd9,
+	     0x23, 0x89, 0x43, 0xa5, 0xa8, 0x18, 0x10, 0x21, 0x9f, 0x72,
+	     0x68, 0x98, 0x3f, 0x8f, 0x39, 0x46, 0x97, 0x40, 0x19, 0xa0,
+	     0xad, 0x58, 0x48, 0x4e, 0x15, 0x4e, 0x93, 0xff, 0x4f, 0xeb,
+	     0x71, 0xb2, 0x38, 0x0a, 0xdc, 0x0a, 0x0e, 0x07, 0xaa, 0x0a,
+	     0x00, 0xbc, 0x2a, 0x86, 0x6a, 0x06, 0xfc, 0x05, 0x89, 0xb8,
+	     0x8c, 0xd8, 0x66, 0xf4, 0x1c, 0x34, 0xbe, 0x8c, 0x18, 0x40,
+	     0x12, 0x6f, 0x00, 0xa0, 0x01, 0xfa, 0xc4, 0x08, 0xb6, 0x03,
+	     0x5e, 0xcd, 0x11, 0x83, 0x03, 0x6c, 0x54, 0xa6, 0x69, 0xd1,
+	     0xdd, 0x38, 0xa1, 0xc8, 0x41, 0xba, 0xa9, 0xdf, 0x84, 0xd8,
+	     0x30, 0x72, 0x32, 0xce, 0x52, 0xd4, 0xd5, 0x3d, 0x2a, 0x6c,
+	     0x3e, 0xb6, 0x25, 0x87, 0x8f, 0xf2, 0xe0, 0xb2, 0xa8, 0x1a,
+	     0x7d, 0x11, 0x2b, 0x2a, 0x72, 0x41, 0x2b, 0x5f, 0xdc, 0x1b,
+	     0x91, 0x58, 0xc0, 0xec, 0xeb, 0x50, 0x54, 0x66, 0x66, 0x54,
+	     0x3b, 0xa2, 0x89, 0xa4, 0x7c, 0xec, 0x35, 0xb5, 0xbf, 0x31,
+	     0x85, 0x98, 0xa5, 0x28, 0x74, 0x8e, 0x21, 0xb8, 0xd0, 0x43,
+	     0xb1, 0x83, 0xe1, 0xda, 0x74, 0x08, 0xe9, 0xa8, 0x38, 0x8e,
+	     0x45, 0xb1, 0x63, 0x1e, 0xf0, 0xe0, 0x4d, 0x18, 0x0d, 0x08,
+	     0x26, 0x36, 0xa9, 0xa2, 0x96, 0x5d, 0xb5, 0xe7, 0x06, 0xb9,
+	     0x6e, 0x29, 0xb7, 0xb2, 0x23, 0x54, 0xd4, 0xb6, 0x8e, 0x60,
+	     0xbe, 0x32, 0xaa, 0xa0, 0x06, 0x2f, 0xbe, 0xd6, 0x30, 0x04,
+	     0x3e, 0xf0, 0xa9, 0x8a, 0x32, 0xde, 0xaa, 0xca, 0xe0, 0x38,
+	     0x51, 0xaf, 0x70, 0x6a, 0x52, 0x14, 0xfe, 0x03, 0x96, 0x70,
+	     0x58, 0xc5, 0xdc, 0x0f, 0x51, 0x20, 0x4b, 0x94, 0x63, 0xc9,
+	     0xb5, 0x38, 0x8b, 0xf8, 0x25, 0x63, 0x1c, 0xcd, 0x0c, 0x34,
+	     0xc7, 0xc5, 0x20, 0x58, 0xf1, 0xa3, 0x5c, 0xc5, 0xd8, 0x31,
+	     0xb5, 0x86, 0xf7, 0x99, 0x1e, 0xa7, 0xc0, 0x38, 0x78, 0x30,
+	     0x56, 0x9d, 0x20, 0xe1, 0x58, 0x53, 0x1f, 0xf2, 0x41, 0x00,
+	     0x44, 0x29, 0xf4, 0x29, 0x61, 0x17, 0x25, 0x2c, 0xfd, 0x86,
+	     0x68, 0x22, 0xf2, 0x4c, 0xe6, 0xa5, 0x76, 0x68, 0xcd, 0x53,
+	     0x89, 0x05, 0xab, 0x66, 0x6b, 0xbf, 0x84, 0x8a, 0xd8, 0xa5,
+	     0x41, 0x35, 0xc6, 0xaf, 0xc3, 0x69, 0x8c, 0xeb, 0x02, 0x0f,
+	     0xd9, 0x2e, 0xb9, 0x07, 0x3f, 0x68, 0x40, 0x77, 0xe1, 0xb4,
+	     0x0e, 0x40, 0x28, 0x80, 0x96, 0x21, 0x0a, 0x94, 0x4c, 0xa0,
+	     0xcf, 0x7e, 0x77, 0x08, 0x60, 0x10, 0xe0, 0x46, 0x7c, 0x09,
+	     0x72, 0x89, 0x4a, 0xca, 0xe4, 0x80, 0x7b, 0xf7, 0xa8, 0x93,
+	     0x1f, 0x84, 0x91, 0x6e, 0x40, 0x85, 0x85, 0x39, 0xe4, 0x7f,
+	     0xec, 0x19, 0x52, 0xa4, 0xf3, 0x99, 0xe8, 0x74, 0xa2, 0x73,
+	     0xf3, 0xc0, 0x37, 0x4a, 0x68, 0x68, 0x1b, 0xc9, 0x0e, 0x83,
+	     0x32, 0x7a, 0x02, 0x5c, 0x66, 0x12, 0x8e, 0xb9, 0x66, 0x0c,
+	     0xab, 0x5a, 0xb1, 0xa4, 0x61, 0x86, 0xc1, 0x36, 0x3d, 0x7a,
+	     0x44, 0xa4, 0xb9, 0x81, 0x8f, 0x0f, 0xaa, 0x05, 0xaa, 0xb2,
+	     0x33, 0x92, 0x00, 0x2d, 0x81, 0x1d, 0x19, 0xc9, 0xda, 0xcf,
+	     0xa4, 0x53, 0x74, 0xd4, 0xe3, 0x61, 0x15, 0x06, 0x1d, 0x9a,
+	     0x0f, 0x0a, 0x19, 0x57, 0x2f, 0xc2, 0x82, 0x91, 0xd7, 0x93,
+	     0x6c, 0x36, 0x35, 0x50, 0x13, 0x8d, 0x91, 0x8a, 0xdb, 0x53,
+	     0xaa, 0x93, 0xc4, 0x26, 0x24, 0x5c, 0xb8, 0xe5, 0x52, 0x59,
+	     0x77, 0xa2, 0xd6, 0xd5, 0x67, 0xe7, 0x99, 0xc8, 0x43, 0xb9,
+	     0x32, 0x69, 0xe4, 0xde, 0x4e, 0xd1, 0xc7, 0xe6, 0x43, 0x69,
+	     0x23, 0xaf, 0xd2, 0x95, 0x22, 0xde, 0x41, 0x7b, 0x6e, 0x2d,
+	     0x91, 0x2f, 0x18, 0x9d, 0x84, 0x51, 0x81, 0xf7, 0x0a, 0x9c,
+	     0x6f, 0xe6, 0xde, 0xe0, 0x22, 0xcc, 0x1b, 0xa7, 0xd6, 0x20,
+	     0xe0, 0x6f, 0x96, 0xf9, 0x90, 0x79, 0xa4, 0x03, 0xa3, 0x0e,
+	     0xc2, 0xb8, 0xe0, 0x19, 0x43, 0x30, 0xa2, 0xa5, 0xa0, 0x18,
+	     0x71, 0xc5, 0x9f, 0x1e, 0x91, 0x71, 0xa0, 0xff, 0xd1, 0xe0,
+	     0x2a, 0x5a, 0x80, 0x25, 0x3b, 0xb2, 0xd5, 0x85, 0xb4, 0x0c,
+	     0x01, 0xb3, 0x77, 0xd8, 0x83, 0xc7, 0x9b, 0x58, 0x5a, 0x22,
+	     0xeb, 0x74, 0xdb, 0x42, 0x4f, 0x8c, 0x40, 0xea, 0x45, 0xd9,
+	     0xe5, 0xb1, 0x43, 0x49, 0x11, 0x21, 0x39, 0x72, 0xc4, 0x37,
+	     0xd5, 0xaa, 0x02, 0x4b, 0xd6, 0xf0, 0x62, 0x56, 0x4e, 0x52,
+	     0x8a, 0xa4, 0x14, 0xee, 0x07, 0x1b, 0xa9, 0x16, 0x98, 0xa0,
+	     0x20, 0x9d, 0x37, 0x6c, 0xc2, 0x35, 0xf6, 0x06, 0x86, 0x5e,
+	     0x11, 0x15, 0x8a, 0x4d, 0x09, 0x43, 0xa5, 0xd8, 0xed, 0x42,
+	     0xcd, 0xa0, 0x43, 0x4e, 0x8c, 0x30, 0x43, 0x60, 0xcf, 0x14,
+	     0x28, 0x77, 0x29, 0xb4, 0x61, 0x56, 0x9a, 0x22, 0xef, 0x79,
+	     0x4c, 0x26, 0x18, 0x26, 0x15, 0xa9, 0xba, 0x87, 0x6a, 0x20,
+	     0xba, 0x9d, 0x32, 0xce, 0x90, 0x05, 0x26, 0x9a, 0x23, 0x70,
+	     0x81, 0x96, 0xd4, 0xeb, 0x50, 0x77, 0x29, 0x62, 0xf0, 0x4f,
+	     0x0a, 0x21, 0x49, 0x66, 0x4d, 0x53, 0x07, 0xd0, 0x76, 0xc9,
+	     0x5b, 0x6a, 0x73, 0x64, 0x86, 0xcc, 0x08, 0x28, 0x89, 0xb7,
+	     0x48, 0x06, 0x74, 0xd5, 0x71, 0x05, 0x6c, 0x8d, 0xac, 0x07,
+	     0x39, 0x3a, 0x10, 0xa5, 0x71, 0xcf, 0x0a, 0xc1, 0x50, 0x72,
+	     0x5b, 0xbd, 0x94, 0xc4, 0x80, 0x63, 0xa9, 0x1d, 0xd6, 0x6f,
+	     0x8a, 0xae, 0x97, 0x92, 0x1a, 0x40, 0x88, 0x64, 0x60, 0x97,
+	     0xe7, 0x3d, 0x04, 0x47, 0xe1, 0x8f, 0xe1, 0x56, 0x51, 0x60,
+	     0x10, 0xb1, 0x05, 0x49, 0x01, 0xbf, 0xb7, 0xbe, 0x84, 0x9d,
+	     0x2d, 0xfb, 0xd6, 0x77, 0x74, 0x3f, 0xaa, 0x3b, 0x5c, 0x96,
+	     0x38, 0x31, 0xb4, 0x88, 0x90, 0xa4, 0x19, 0xb7, 0x29, 0x1b,
+	     0x14, 0xec, 0xe2, 0x7c, 0x1c, 0x59, 0x9c, 0xac, 0xc0, 0x68,
+	     0xe4, 0xdc, 0x40, 0x4d, 0xf0, 0xf8, 0x24, 0xc6, 0x7a, 0x21,
+	     0x9a, 0xb7, 0x53, 0x9a, 0x3a, 0x23, 0xdb, 0xd1, 0xe9, 0xca,
+	     0x90, 0x8c, 0x30, 0xcb, 0x99, 0x88, 0x99, 0xd6, 0x97, 0x20,
+	     0xa6, 0x3f, 0xc5, 0x4c, 0x82, 0x1b, 0x21, 0x9e, 0x02, 0x34,
+	     0xe6, 0x9a, 0xad, 0xa6, 0x13, 0xeb, 0x36, 0x59, 0x04, 0x5a,
+	     0xe5, 0xb1, 0xe1, 0x72, 0x9a, 0x73, 0xaf, 0x49, 0x9e, 0x89,
+	     0x85, 0x62, 0xd8, 0x51, 0xe4, 0xc9, 0x29, 0x1d, 0x06, 0x04,
+	     0x6b, 0x07, 0x99, 0x17, 0x2c, 0xf2, 0x4b, 0x91, 0x4a, 0xf1,
+	     0x11, 0xc9, 0x3f, 0xb8, 0x1a, 0x8a, 0x4b, 0xb2, 0xcd, 0xc5,
+	     0xc5, 0xf3, 0xb4, 0xa2, 0x62, 0x0e, 0xc0, 0xd7, 0x34, 0x7d,
+	     0x79, 0x35, 0x9d, 0xd7, 0x41, 0x33, 0xd0, 0x01, 0x00, 0x78,
+	     0xe6, 0x15, 0x1c, 0xdb, 0x49, 0x30, 0x1a, 0x29, 0x26, 0x1d,
+	     0x91, 0x08, 0x66, 0x5e, 0x30, 0x64, 0xf9, 0x75, 0x72, 0x4b,
+	     0x63, 0x01, 0x03, 0x91, 0xdc, 0xf2, 0x51, 0xd6, 0xca, 0xc4,
+	     0x2d, 0xd8, 0x0f, 0xfe, 0x78, 0x89, 0xa4, 0xc4, 0xc5, 0x46,
+	     0x07, 0xf6, 0xe4, 0x64, 0x63, 0x5f, 0xe8, 0x64, 0xd8, 0x43,
+	     0x08, 0xc0, 0xd8, 0x4b, 0x7d, 0xaa, 0xca, 0xe6, 0x07, 0x7b,
+	     0x7a, 0x8d, 0x88, 0x7a, 0x28, 0x7f, 0xa6, 0x7a, 0x9e, 0x50,
+	     0xd2, 0x31, 0x31, 0x3b, 0x52, 0x92, 0xf9, 0x20, 0x91, 0x65,
+	     0xce, 0x12, 0x7c, 0x44, 0x02, 0x31, 0x41, 0x14, 0x87, 0xeb,
+	     0x51, 0x8e, 0x82, 0x6c, 0x70, 0xee, 0xb8, 0x97, 0x96, 0x25,
+	     0xe0, 0xf4, 0x91, 0x91, 0x41, 0x7d, 0x00, 0x21, 0x7a, 0x07,
+	     0x5e, 0x04, 0xfb, 0xdb, 0x15, 0x0e, 0x10, 0xe8, 0x39, 0xea,
+	     0xc5, 0xa9, 0xa3, 0xac, 0x93, 0xbb, 0xa8, 0xbf, 0xc5, 0xce,
+	     0xa4, 0x29, 0x83, 0xbb, 0xb8, 0xcd, 0x98, 0x7d, 0x34, 0x00,
+	     0x1c, 0xb3, 0x4c, 0x54, 0x0e, 0xed, 0x69, 0x77, 0xd0, 0x03,
+	     0x43, 0x71, 0x2e, 0xa0, 0x7c, 0x78, 0x97, 0x9a, 0x1c, 0xda,
+	     0x49, 0x3c, 0x85, 0xd6, 0x68, 0x53, 0x3e, 0xda, 0x00, 0x6b,
+	     0x37, 0x32, 0x4e, 0x64, 0xcf, 0x20, 0x9e, 0x27, 0xe7, 0xfa,
+	     0xbb, 0xc0, 0x15, 0x72, 0x37, 0x60, 0x23, 0x80, 0x45, 0x75,
+	     0x51, 0x56, 0x04, 0x33, 0x12, 0x36, 0xc8, 0x36, 0xcf, 0x95,
+	     0x5c, 0x3c, 0xed, 0x46, 0x17, 0xd0, 0x75, 0x08, 0x8a, 0xf3,
+	     0x0f, 0x6a, 0x64, 0xbe, 0x29, 0x87, 0x29, 0x7d, 0xd9, 0x60,
+	     0x04, 0x6b, 0x07, 0x05, 0x1b, 0x39, 0xdd, 0x21, 0x51, 0x1d,
+	     0x4d, 0x22, 0xcf, 0x56, 0xab, 0xa9, 0x4e, 0x09, 0x0e, 0xfa,
+	     0xb2, 0x10, 0x35, 0x7f, 0x60, 0x93, 0x84, 0x77, 0x5a, 0x04,
+	     0x81, 0x97, 0x43, 0x52, 0xaa, 0xcf, 0x21, 0x37, 0x97, 0x17,
+	     0x11, 0x00, 0xd9, 0x9a, 0xbb, 0x49, 0xda, 0xc0, 0x52, 0x59,
+	     0x2d, 0x49, 0x2c, 0x11, 0x72, 0x98, 0x45, 0x72, 0x60, 0x6a,
+	     0xf3, 0x6a, 0x88, 0x45, 0x30, 0x1a, 0x16, 0x54, 0xa4, 0x41,
+	     0x7b, 0xb1, 0x55, 0xd4, 0x66, 0xb3, 0x66, 0x96, 0x40, 0x52,
+	     0x28, 0x5d, 0x6b, 0x0c, 0x4a, 0x48, 0x2e, 0x1f, 0x20, 0xa1,
+	     0xe9, 0xe1, 0x75, 0x21, 0x13, 0x33, 0x2a, 0x2a, 0x1d, 0x1a,
+	     0x96, 0xbe, 0x66, 0xcb, 0x07, 0xac, 0x1c, 0x53, 0xf7, 0x29,
+	     0x70, 0xe8, 0x4b, 0xfa, 0x69, 0x28, 0x37, 0xf6, 0x98, 0x32,
+	     0x11, 0xce, 0x81, 0x68, 0x0b, 0x5f, 0xf4, 0xc9, 0x8a, 0x05,
+	     0xc8, 0x86, 0xdf, 0x15, 0x5f, 0x0f, 0x7a, 0x28, 0x34, 0xb2,
+	     0x40, 0xb1, 0x56, 0xd6, 0x05, 0xdb, 0x46, 0x08, 0x43, 0xa5,
+	     0x2e, 0x84, 0xf1, 0x61, 0x1a, 0x4f, 0xbd, 0x8d, 0xda, 0x10,
+	     0xc0, 0xbf, 0xaf, 0x60, 0xf8, 0xcb, 0x7a, 0x56, 0xe8, 0xa8,
+	     0xe6, 0xb5, 0xba, 0x04, 0x3b, 0x7f, 0x19, 0x3c, 0x84, 0xc6,
+	     0x00, 0xfe, 0x36, 0xdd, 0xba, 0x07, 0x30, 0xb9, 0xfe, 0x8e,
+	     0x4a, 0x19, 0xec, 0x1d, 0x18, 0xa7, 0x85, 0x25, 0x02, 0x61,
+	     0x56, 0xdc, 0x79, 0x56, 0x19, 0x2f, 0x0c, 0x99, 0xcb, 0x14,
+	     0x64, 0x40, 0xc4, 0xd9, 0x1b, 0x5a, 0x69, 0x32, 0x7d, 0x4a,
+	     0xf9, 0x21, 0xd1, 0x92, 0x3d, 0x22, 0x8b, 0xd9, 0xcd, 0x59,
+	     0x1f, 0xec, 0x2a, 0x59, 0x15, 0x61, 0x9d, 0xb0, 0xc3, 0xfb,
+	     0xe9, 0x4b, 0x90, 0x19, 0x23, 0xeb, 0x65, 0x3d, 0x08, 0x2a,
+	     0x0d, 0x8e, 0x39, 0x98, 0xd4, 0x32, 0xe5, 0x30, 0xff, 0xe8,
+	     0xf8, 0x11, 0x32, 0x63, 0x85, 0x36, 0x10, 0x2e, 0x9d, 0xa8,
+	     0x0b, 0x22, 0x48, 0x24, 0xb2, 0x30, 0xe9, 0xd1, 0xd2, 0x22,
+	     0x87, 0x4c, 0x94, 0x98, 0x7a, 0x62, 0xa4, 0xf9, 0x2f, 0xe3,
+	     0x24, 0x64, 0xc8, 0xbc, 0x5a, 0x63, 0x8e, 0x6c, 0xda, 0xf9,
+	     0xc0, 0x02, 0x59, 0x19, 0xe0, 0xac, 0x85, 0x96, 0x9e, 0x3b,
+	     0xb2, 0x89, 0x02, 0x4c, 0x12, 0x81, 0xb2, 0x27, 0xfb, 0x02,
+	     0x9c, 0x58, 0xa8, 0xd8, 0x3c, 0x03, 0x0b, 0xd2, 0xc9, 0x5f,
+	     0x2d, 0x16, 0x59, 0x48, 0x53, 0xdb, 0xf4, 0xca, 0xea, 0x64,
+	     0xc6, 0x13, 0x8a, 0xa2, 0xe7, 0x86, 0xf2, 0xe8, 0xd0, 0x32,
+	     0x24, 0xba, 0xc8, 0xba, 0x1c, 0xb2, 0x0d, 0x45, 0x98, 0xfb,
+	     0x86, 0xd3, 0x15, 0x0a, 0x19, 0x22, 0xbd, 0x2f, 0x1c, 0x56,
+	     0x42, 0x89, 0xdb, 0x9f, 0x35, 0xb2, 0x04, 0xb2, 0x3a, 0x83,
+	     0x56, 0xe5, 0x86, 0xfe, 0x4e, 0x1f, 0x90, 0xcb, 0x0e, 0x4a,
+	     0x73, 0xdd, 0xd4, 0xb8, 0x22, 0x10, 0xfa, 0x6d, 0x54, 0x5a,
+	     0x28, 0x1c, 0x75, 0x51, 0x16, 0x02, 0x52, 0x42, 0x39, 0xb1,
+	     0xf0, 0x0c, 0x18, 0x6c, 0x96, 0x90, 0x13, 0x55, 0x17, 0x42,
+	     0x53, 0x05, 0x45, 0x0c, 0xbc, 0x59, 0xf4, 0xef, 0x7c, 0x8e,
+	     0x7b, 0xbf, 0x11, 0xd8, 0xa1, 0x86, 0x07, 0xd4, 0x89, 0x83,
+	     0xa8, 0x5c, 0x1b, 0xe0, 0x39, 0xf8, 0x93, 0xfa, 0x05, 0xcd,
+	     0x82, 0xa3, 0x35, 0x65, 0x22, 0x03, 0xb9, 0x33, 0xbd, 0x51,
+	     0xde, 0x26, 0x9f, 0x18, 0xaf, 0x46, 0x4b, 0x04, 0x2c, 0x20,
+	     0xab, 0x41, 0xb9, 0x38, 0x3a, 0xf1, 0x39, 0x14, 0xe0, 0x2b,
+	     0x83, 0x68, 0x60, 0x72, 0x61, 0xe2, 0x0c, 0x8a, 0xe0, 0x47,
+	     0x0a, 0x11, 0xcd, 0x5c, 0x6d, 0x6e, 0x35, 0xe9, 0x13, 0x71,
+	     0x92, 0xb1, 0x6b, 0x1c, 0x73, 0xb8, 0x9c, 0x36, 0x9c, 0xcc,
+	     0xe1, 0xa8, 0x45, 0x5f, 0x3b, 0x5e, 0x44, 0xaf, 0x92, 0x00,
+	     0x4b, 0x42, 0xb4, 0xe3, 0xfd, 0x71, 0x60, 0x68, 0x11, 0xd0,
+	     0x84, 0xa0, 0x28, 0x48, 0x96, 0x01, 0x18, 0xb8, 0x8f, 0xca,
+	     0x22, 0x6d, 0x84, 0x9d, 0x41, 0x46, 0xc1, 0x7e, 0xbc, 0x35,
+	     0x8f, 0x4a, 0xbf, 0x41, 0x75, 0x68, 0x9c, 0xd3, 0x47, 0xb0,
+	     0x2e, 0x68, 0x20, 0xd3, 0x55, 0x5a, 0x21, 0xea, 0x0a, 0x88,
+	     0x0b, 0xd5, 0x92, 0xf3, 0x79, 0x21, 0x6e, 0xe1, 0xd2, 0x03,
+	     0x5a, 0x2e, 0x81, 0xdc, 0x4e, 0x87, 0xe7, 0x54, 0xac, 0x5b,
+	     0xd1, 0x1c, 0x19, 0x80, 0x21, 0x3c, 0x4d, 0x6b, 0xe2, 0x3a,
+	     0x0f, 0xe7, 0x65, 0x2e, 0x34, 0x46, 0x56, 0x18, 0x87, 0x8c,
+	     0xe4, 0x22, 0x9f, 0x0b, 0x6d, 0x13, 0xf8, 0x21, 0xef, 0x19,
+	     0x68, 0xda, 0x0a, 0x44, 0x3c, 0x78, 0x8c, 0x24, 0xa3, 0xd0,
+	     0x8a, 0xc6, 0xe2, 0x17, 0xb4, 0x76, 0x75, 0xd4, 0xcc, 0x82,
+	     0xfe, 0xcd, 0xa4, 0x61, 0x58, 0x6d, 0x94, 0x12, 0xf8, 0x32,
+	     0x17, 0x79, 0xbb, 0x9a, 0x39, 0x26, 0xa2, 0x94, 0x87, 0xaf,
+	     0x07, 0xfa, 0x81, 0x46, 0xc1, 0x0b, 0xec, 0x6e, 0x42, 0x0e,
+	     0x68, 0xb8, 0x12, 0x63, 0x10, 0x50, 0xdd, 0x76, 0x6c, 0xa4,
+	     0x7b, 0xad, 0x76, 0xb2, 0x52, 0xa6, 0x00, 0xaa, 0x51, 0x51,
+	     0xc9, 0x85, 0x58, 0xa0, 0x32, 0xeb, 0x78, 0x1b, 0xf6, 0x2a,
+	     0x37, 0x3f, 0x6c, 0xc3, 0xb1, 0xca, 0xa6, 0x86, 0x3b, 0x4a,
+	     0x95, 0xd8, 0xed, 0xec, 0x78, 0xe5, 0xbd, 0x48, 0x41, 0x94,
+	     0xc0, 0x93, 0x92, 0x99, 0x6c, 0x32, 0x66, 0x8e, 0xf0, 0x51,
+	     0x4c, 0x2b, 0x45, 0x5e, 0xe3, 0xae, 0x9b, 0x62, 0x35, 0x53,
+	     0xf3, 0x34, 0x28, 0xba, 0x38, 0x1e, 0x45, 0xf7, 0x4a, 0x76,
+	     0xa1, 0xd9, 0x86, 0xc3, 0x73, 0xda, 0x71, 0x4a, 0xf8, 0x97,
+	     0x3c, 0x87, 0x55, 0xc8, 0x71, 0x46, 0xe2, 0x25, 0x08, 0x34,
+	     0x74, 0x5c, 0x50, 0x6c, 0x5b, 0x3b, 0x1f, 0xc0, 0x1d, 0x56,
+	     0xc4, 0x27, 0xe4, 0xcd, 0x8c, 0xab, 0x65, 0x66, 0xb8, 0x7d,
+	     0xb4, 0x46, 0x81, 0xd0, 0xbd, 0x85, 0xdd, 0xb7, 0xdc, 0xfa,
+	     0x7e, 0xe9, 0x46, 0x14, 0x5b, 0x61, 0x04, 0x2d, 0xa2, 0x2b,
+	     0x8f, 0xbc, 0x89, 0x8f, 0xb3, 0x98, 0xd4, 0x95, 0x68, 0x65,
+	     0x6c, 0xbf, 0xa1, 0xa5, 0x03, 0x21, 0x5c, 0x04, 0x5b, 0xc8,
+	     0x71, 0x55, 0x94, 0x74, 0x30, 0x49, 0x81, 0x74, 0x48, 0x77,
+	     0x11, 0xa9, 0xb7, 0x1a, 0xd1, 0x4d, 0x94, 0x94, 0xe0, 0x4b,
+	     0x00, 0x26, 0xab, 0x64, 0xe8, 0xa8, 0xbf, 0x43, 0xc7, 0xe4,
+	     0x1d, 0x46, 0xd6, 0x5a, 0x94, 0x3e, 0x07, 0x51, 0x48, 0x40,
+	     0xc0, 0xea, 0x44, 0x67, 0x3a, 0x0c, 0x16, 0xa0, 0x9e, 0x91,
+	     0x2a, 0xc0, 0xf8, 0x92, 0x36, 0xc5, 0x6c, 0xf5, 0xc4, 0x1a,
+	     0xcb, 0x8d, 0x25, 0xd4, 0x2a, 0xdf, 0x10, 0x29, 0x9a, 0x83,
+	     0x63, 0xe4, 0x12, 0xce, 0x40, 0x40, 0x65, 0xa1, 0xf8, 0x15,
+	     0x2f, 0x87, 0x94, 0xdd, 0xf8, 0x8e, 0xde, 0x35, 0x92, 0x6c,
+	     0x1e, 0x99, 0x37, 0x70, 0x07, 0xe6, 0x24, 0x0b, 0x50, 0xb5,
+	     0xa0, 0x8d, 0xf9, 0x27, 0xf8, 0xc9, 0xec, 0xbd, 0x8a, 0x35,
+	     0x20, 0xc2, 0x11, 0x62, 0xf8, 0x6f, 0xd3, 0x87, 0x26, 0x81,
+	     0x25, 0xbe, 0x13, 0xea, 0x81, 0x78, 0x4a, 0x3c, 0x40, 0xbd,
+	     0xc0, 0xdf, 0xe3, 0xd3, 0x9a, 0x75, 0xc1, 0xaf, 0x44, 0x59,
+	     0x01, 0x49, 0xac, 0x15, 0x65, 0xc7, 0x0f, 0x50, 0x41, 0xcc,
+	     0x16, 0x21, 0x82, 0xd6, 0x4a, 0xa0, 0x20, 0x9a, 0xe6, 0xc4,
+	     0x4d, 0xd1, 0x72, 0x49, 0x1a, 0x28, 0x0d, 0xcf, 0x50, 0x85,
+	     0x5b, 0x21, 0x46, 0x8b, 0x9a, 0x72, 0xf8, 0xa7, 0xe3, 0x00,
+	     0x37, 0xe1, 0x62, 0xec, 0x43, 0x58, 0x46, 0x83, 0x9a, 0xe6,
+	     0xc7, 0x97, 0xb5, 0x67, 0xe0, 0xa5, 0x88, 0xb6, 0xce, 0x05,
+	     0x00, 0x1c, 0x5c, 0x65, 0x33, 0x42, 0xdb, 0xf4, 0x53, 0x1a,
+	     0xcd, 0x70, 0x2f, 0x00, 0x26, 0xb8, 0x38, 0xd1, 0x9e, 0x0b,
+	     0x62, 0x74, 0x69, 0xd5, 0x0c, 0xb8, 0x79, 0x00, 0x07, 0x1a,
+	     0x67, 0x22, 0xe9, 0xc9, 0xc8, 0x64, 0xbd, 0xd3, 0x17, 0x2c,
+	     0x44, 0xa4, 0x6a, 0xb2, 0x53, 0x1e, 0xa0, 0x67, 0x4c, 0xa6,
+	     0xee, 0x02, 0x10, 0x84, 0xbb, 0x1c, 0x2a, 0xab, 0x02, 0x59,
+	     0x0c, 0x2b, 0x0f, 0x9c, 0xb1, 0xd1, 0xa1, 0xf6, 0x9f, 0x0b,
+	     0x46, 0x9e, 0x00, 0x2e, 0x46, 0x5a, 0xba, 0xca, 0x0e, 0x41,
+	     0x80, 0x3e, 0x57, 0xb4, 0x13, 0x6b, 0xbc, 0x01, 0x98, 0x8e,
+	     0x85, 0x31, 0x1b, 0xc7, 0x3b, 0x33, 0xb7, 0x10, 0xc1, 0x20,
+	     0x65, 0xe0, 0x3b, 0xe8, 0x69, 0x1a, 0x1b, 0xba, 0xc3, 0x25,
+	     0x6c, 0x0d, 0x53, 0x4b, 0x7c, 0x22, 0x4d, 0xd9, 0xee, 0x58,
+	     0x1d, 0x2a, 0x31, 0x18, 0xf6, 0x72, 0x37, 0xf7, 0xa9, 0x58,
+	     0x3d, 0x25, 0x59, 0xe0, 0x37, 0x34, 0x13, 0x6b, 0x06, 0xb2,
+	     0x63, 0x6c, 0x34, 0x34, 0x32, 0x6f, 0x66, 0x2c, 0x55, 0x35,
+	     0xda, 0x15, 0xe1, 0x64, 0xd8, 0xe3, 0xe1, 0x46, 0x5e, 0x29,
+	     0x5a, 0xde, 0x27, 0xe8, 0x64, 0xa1, 0x02, 0x04, 0x50, 0xc7,
+	     0x2a, 0x9a, 0xd4, 0xfa, 0x1b, 0x2a, 0x5a, 0x18, 0x7e, 0x81,
+	     0x9b, 0x16, 0x08, 0xd7, 0x45, 0xc2, 0x1e, 0x28, 0x79, 0x6b,
+	     0xa8, 0xb4, 0x5b, 0x54, 0x79, 0xd2, 0x1e, 0xb3, 0xc4, 0x70,
+	     0x45, 0x86, 0xf8, 0x16, 0xa9, 0x12, 0x82, 0x1c, 0xa5, 0x1b,
+	     0xff, 0xcc, 0x26, 0x0c, 0x42, 0x24, 0x6b, 0x56, 0xa5, 0x73,
+	     0x29, 0xb2, 0x85, 0x44, 0x2f, 0xdf, 0xc4, 0x92, 0x43, 0x75,
+	     0xd2, 0x6a, 0x42, 0x74, 0x70, 0x0d, 0x50, 0x5f, 0x42, 0x5b,
+	     0x68, 0xc3, 0x7c, 0xa4, 0xfe, 0xab, 0x33, 0x22, 0x38, 0x73,
+	     0x09, 0x45, 0x12, 0x33, 0x77, 0x37, 0x86, 0x6a, 0x0e, 0x60,
+	     0x30, 0x10, 0x02, 0x44, 0x7c, 0x60, 0x5d, 0x89, 0x20, 0x29,
+	     0xc5, 0xa7, 0x99, 0x01, 0x91, 0x8c, 0x39, 0x82, 0x16, 0xd0,
+	     0xce, 0xc4, 0x17, 0xee, 0x38, 0x73, 0x4b, 0x53, 0x4d, 0xe7,
+	     0x6d, 0xe4, 0xa1, 0xc1, 0x70, 0x5e, 0x35, 0xc9, 0x1e, 0x66,
+	     0x77, 0x4d, 0xeb, 0x54, 0xa9, 0x82, 0x1e, 0x98, 0xf7, 0x59,
+	     0x7c, 0xc8, 0xaf, 0xac, 0x2a, 0x69, 0x29, 0x5e, 0x12, 0x96,
+	     0xc4, 0x99, 0x76, 0x7b, 0xcb, 0x2e, 0xf2, 0x96, 0x80, 0x72,
+	     0x2a, 0xb3, 0xef, 0x9b, 0x2a, 0x90, 0x9e, 0xa3, 0x63, 0x89,
+	     0x9e, 0x8c, 0x8e, 0xee, 0x15, 0x40, 0x4d, 0x4f, 0x98, 0xe0,
+	     0x65, 0xa6, 0xa9, 0xda, 0x73, 0x46, 0x1e, 0x09, 0x4a, 0x62,
+	     0x41, 0x19, 0x13, 0xd3, 0xc3, 0x30, 0x62, 0xf5, 0x45, 0x5b,
+	     0x84, 0xb5, 0x00, 0xc8, 0x16, 0xd4, 0x93, 0x22, 0xda, 0x81,
+	     0x02, 0x1c, 0xc5, 0x6e, 0x6c, 0x32, 0x7c, 0x1e, 0x7e, 0x29,
+	     0x3d, 0xac, 0x20, 0x62, 0xac, 0xc7, 0x7a, 0xa5, 0xe8, 0xa0,
+	     0x1b, 0xa0, 0xc5, 0x58, 0x39, 0xad, 0x1f, 0x71, 0x4d, 0x83,
+	     0xe7, 0xce, 0x32, 0x9e, 0x3b, 0x3f, 0x29, 0x4d, 0x0c, 0x1c,
+	     0xea, 0x9d, 0xb7, 0x5a, 0x03, 0x4d, 0x41, 0xa9, 0x28, 0xc9,
+	     0x7f, 0xd8, 0xa4, 0x2c, 0x31, 0x48, 0x98, 0xbf, 0x8e, 0xac,
+	     0x91, 0x6c, 0x24, 0x80, 0x10, 0x24, 0x41, 0x92, 0x1e, 0x7c,
+	     0x3f, 0x84, 0xce, 0x8a, 0x8d, 0x85, 0xeb, 0x15, 0xe6, 0x7b,
+	     0x8b, 0x61, 0x43, 0x82, 0x5e, 0x48, 0x85, 0x6c, 0xcb, 0x8c,
+	     0x08, 0x66, 0xb7, 0x6a, 0xb9, 0x60, 0x39, 0x55, 0xf2, 0x11,
+	     0xa5, 0x91, 0xbe, 0x64, 0xb7, 0x25, 0x6b, 0x05, 0xf7, 0xc2,
+	     0xf3, 0x1c, 0x6b, 0x9c, 0x5c, 0x13, 0x42, 0x0a, 0xa7, 0xa2,
+	     0x68, 0x02, 0x03, 0x00, 0x71, 0x15, 0x58, 0x3b, 0x0a, 0x08,
+	     0xb1, 0xc1, 0x25, 0x5f, 0x50, 0x41, 0x99, 0x25, 0x46, 0x44,
+	     0x28, 0x2a, 0x66, 0xa0, 0x34, 0x77, 0x92, 0x04, 0xd4, 0x30,
+	     0x73, 0xfe, 0xa5, 0x47, 0xa2, 0x3d, 0x3c, 0x8e, 0x94, 0x4b,
+	     0x77, 0xb6, 0x1b, 0x44, 0xc7, 0x22, 0x60, 0x22, 0x08, 0x21,
+	     0x29, 0x62, 0xc3, 0x0e, 0x3c, 0x2b, 0xcb, 0x20, 0x97, 0x21,
+	     0x27, 0x9c, 0x87, 0x74, 0x12, 0x50, 0x28, 0x10, 0x6f, 0x98,
+	     0x6d, 0xb1, 0xc1, 0xe5, 0xf9, 0x6c, 0x71, 0x54, 0x26, 0x30,
+	     0x7d, 0x9d, 0x84, 0x4a, 0x7c, 0x42, 0x91, 0x6c, 0x56, 0xf4,
+	     0x67, 0x2d, 0x05, 0x9e, 0xfb, 0x8e, 0x40, 0x4c, 0x6c, 0x16,
+	     0x0a, 0xcd, 0xdc, 0xcc, 0x40, 0x6f, 0xd7, 0x68, 0xa1, 0xc9,
+	     0x65, 0x6a, 0xdd, 0x12, 0x8f, 0x05, 0x4b, 0xc4, 0xc0, 0xdc,
+	     0x27, 0x05, 0x67, 0x05, 0xf1, 0x67, 0x61, 0x26, 0x22, 0x24,
+	     0x99, 0x80, 0x51, 0x0c, 0x6d, 0xe2, 0x2d, 0x25, 0x48, 0x31,
+	     0x39, 0x48, 0x10, 0xe3, 0x74, 0x56, 0x44, 0x01, 0xa6, 0x43,
+	     0x51, 0xa7, 0x29, 0xfa, 0xf2, 0x22, 0x7d, 0x77, 0x18, 0x97,
+	     0x52, 0x28, 0xee, 0x5f, 0xe4, 0x8f, 0x28, 0xb8, 0xc0, 0xcc,
+	     0x5b, 0x60, 0x36, 0x86, 0x91, 0x44, 0xb5, 0x82, 0xc1, 0x34,
+	     0xe4, 0x96, 0x80, 0xb1, 0x51, 0x0c, 0xc0, 0xea, 0x00, 0x09,
+	     0xb1, 0x9b, 0xed, 0xe0, 0xdb, 0x71, 0xd7, 0x83, 0x4d, 0x1c,
+	     0x43, 0xe1, 0x52, 0x46, 0x89, 0x76, 0x0e, 0x68, 0x0a, 0x85,
+	     0xc1, 0xfc, 0xc2, 0x7f, 0xf4, 0x7d, 0x7c, 0x6e, 0xfa, 0x5c,
+	     0x73, 0xc1, 0xfe, 0x81, 0xee, 0x91, 0x6a, 0x96, 0x66, 0x91,
+	     0xc8, 0x8c, 0xa6, 0x56, 0x0d, 0xc7, 0x12, 0x68, 0x87, 0x31,
+	     0xcd, 0x6b, 0x43, 0x60, 0xcb, 0x86, 0x84, 0x0c, 0x8c, 0x35,
+	     0xe9, 0x0f, 0x61, 0x52, 0x79, 0x30, 0x86, 0xd4, 0xe0, 0x1c,
+	     0x60, 0xf9, 0x07, 0x26, 0x7d, 0x28, 0xae, 0x2a, 0xcb, 0xd7,
+	     0x0d, 0xf4, 0x70, 0x49, 0xa3, 0x2d, 0xea, 0xfd, 0xd2, 0x2d,
+	     0xbd, 0xbf, 0xfa, 0x1a, 0x4d, 0xa1, 0xca, 0x65, 0x41, 0xc2,
+	     0xfb, 0xe8, 0x7a, 0x40, 0x3d, 0xe9, 0x38, 0xa7, 0x83, 0x60,
+	     0x80, 0x4e, 0x50, 0x9b, 0x78, 0x34, 0x3e, 0x25, 0xed, 0x4e,
+	     0x36, 0x20, 0x4c, 0x0e, 0x34, 0xa6, 0xa5, 0xa7, 0x5f, 0x44,
+	     0x44, 0x61, 0x10, 0x5d, 0x49, 0xc4, 0x09, 0xda, 0x99, 0x45,
+	     0x0a, 0xa9, 0xa9, 0x22, 0xb9, 0xa6, 0x6d, 0xdb, 0xbe, 0x3d,
+	     0x54, 0xa5, 0x00, 0xc1, 0x11, 0x88, 0x24, 0x63, 0x57, 0x83,
+	     0x8c, 0x1d, 0xf7, 0x48, 0x58, 0x1b, 0x24, 0xdb, 0x8f, 0x85,
+	     0x00, 0x00, 0xe6, 0x17, 0x88, 0x8d, 0x70, 0x1e, 0xa4, 0x5c,
+	     0x51, 0x06, 0x27, 0x64, 0xa1, 0xaf, 0x4b, 0x95, 0x63, 0xf2,
+	     0x3b, 0x99, 0x84, 0x14, 0x09, 0x72, 0x3e, 0x9b, 0x48, 0x59,
+	     0x8e, 0xdd, 0x80, 0x81, 0x30, 0x70, 0xfd, 0x96, 0xfc, 0x34,
+	     0x05, 0x0d, 0x07, 0x96, 0xe8, 0x6d, 0x4f, 0xd9, 0x9c, 0xc8,
+	     0x8a, 0xa9, 0x1f, 0x00, 0x95, 0xfe, 0x87, 0x17, 0x1b, 0xce,
+	     0x31, 0x94, 0x90, 0x0f, 0xb1, 0x87, 0x6c, 0xf9, 0x78, 0x18,
+	     0xcd, 0xc1, 0xc4, 0xd1, 0x2d, 0x49, 0xa7, 0xd6, 0xa0, 0x14,
+	     0xf2, 0xcd, 0x04, 0x40, 0x40, 0x84, 0x4b, 0x93, 0x5b, 0x24,
+	     0x28, 0x32, 0xe4, 0x04, 0x89, 0x9f, 0xc5, 0xba, 0xf2, 0x90,
+	     0x30, 0x80, 0x76, 0xca, 0x8c, 0x46, 0xd7, 0x47, 0x72, 0xf0,
+	     0x49, 0x82, 0xc0, 0x04, 0x96, 0x53, 0x9d, 0x94, 0x0c, 0xae,
+	     0x2a, 0x1e, 0xf4, 0xc1, 0xc0, 0x6f, 0x28, 0x39, 0x26, 0x22,
+	     0xac, 0x27, 0xb0, 0x58, 0xff, 0xe8, 0x92, 0xa8, 0x1f, 0xf4,
+	     0xfb, 0x9d, 0xb8, 0x86, 0x64, 0x70, 0x32, 0xce, 0x8e, 0xec,
+	     0x25, 0xbc, 0xd8, 0x91, 0xb4, 0x37, 0xd6, 0x07, 0x04, 0x0b,
+	     0xa4, 0xbc, 0xab, 0x5d, 0x41, 0x0d, 0xd7, 0xe2, 0x85, 0x2b,
+	     0x58, 0x65, 0x6b, 0x1c, 0x2f, 0x92, 0xa5, 0xcf, 0x95, 0xce,
+	     0x2f, 0x07, 0x25, 0x00, 0x22, 0x55, 0x98, 0x2e, 0xd8, 0x94,
+	     0xde, 0x96, 0x7c, 0x0d, 0x4e, 0x48, 0xaf, 0x74, 0x9f, 0x73,
+	     0x4e, 0x22, 0x70, 0x96, 0x8e, 0xce, 0x1b, 0xcc, 0x18, 0x0c,
+	     0xc2, 0xb0, 0x57, 0x6c, 0xd9, 0x19, 0x55, 0x8b, 0x4a, 0x60,
+	     0xe4, 0x9f, 0x71, 0xc8, 0x75, 0x73, 0xec, 0xf1, 0xec, 0x12,
+	     0x6d, 0xda, 0x15, 0x29, 0x33, 0x0b, 0x38, 0xe3, 0x97, 0x32,
+	     0x68, 0x6f, 0xc5, 0x48, 0x69, 0x29, 0x35, 0xcc, 0x2a, 0x9b,
+	     0x96, 0x95, 0x8d, 0xe6, 0x73, 0x28, 0x35, 0xa4, 0x50, 0x51,
+	     0x1f, 0x24, 0x94, 0x20, 0x08, 0x12, 0x98, 0x4a, 0x61, 0x3d,
+	     0x45, 0x6c, 0xa1, 0xb0, 0x1c, 0x48, 0xb2, 0x30, 0x5f, 0x1b,
+	     0xa1, 0xa8, 0x79, 0x9a, 0x1a, 0x46, 0x9a, 0x29, 0xb6, 0x09,
+	     0xf7, 0x28, 0x6d, 0xde, 0x74, 0xe3, 0x27, 0x61, 0xa2, 0xe9,
+	     0xae, 0x03, 0xe1, 0x68, 0x88, 0x25, 0xfe, 0x1b, 0xb4, 0x52,
+	     0x00, 0x38, 0x69, 0x4a, 0x48, 0x51, 0x61, 0xd7, 0xd6, 0x49,
+	     0xa1, 0xa9, 0x25, 0xa5, 0x20, 0x44, 0xab, 0x57, 0x51, 0xc4,
+	     0x08, 0x3e, 0x34, 0xae, 0x38, 0x78, 0x85, 0x32, 0x28, 0x17,
+	     0xfd, 0x9a, 0x35, 0x59, 0xe9, 0xae, 0x51, 0xe6, 0x28, 0xea,
+	     0x96, 0xf4, 0x54, 0xec, 0x29, 0x6e, 0xc5, 0xfc, 0x11, 0x63,
+	     0x11, 0x61, 0x57, 0xf8, 0x31, 0xa1, 0x05, 0xd8, 0x68, 0x98,
+	     0x75, 0x9e, 0x7c, 0xc5, 0x45, 0xf2, 0xbd, 0xb8, 0x46, 0x91,
+	     0x56, 0x62, 0x03, 0x43, 0x45, 0x1d, 0x89, 0xae, 0xc0, 0x78,
+	     0xe3, 0x54, 0x60, 0xc4, 0xf4, 0x08, 0xe6, 0x53, 0x9c, 0x1f,
+	     0x93, 0x48, 0x86, 0xcd, 0x8e, 0x81, 0xd8, 0x37, 0x10, 0x99,
+	     0x9a, 0xc0, 0xf9, 0x1a, 0x46, 0x16, 0x8b, 0x33, 0x4d, 0x73,
+	     0x33, 0x80, 0xc0, 0x52, 0x7c, 0xac, 0x24, 0x1d, 0xff, 0x2d,
+	     0xd6, 0x43, 0x0c, 0xc0, 0x7c, 0x82, 0xf3, 0xb8, 0xf8, 0x8a,
+	     0x1f, 0x6a, 0x76, 0x5c, 0x27, 0xd6, 0xad, 0xa1, 0x0d, 0x0c,
+	     0x63, 0xd1, 0xe2, 0x55, 0x79, 0x9d, 0x2c, 0x19, 0xd4, 0x6c,
+	     0x98, 0x04, 0xe1, 0x52, 0xa0, 0xcb, 0xe2, 0x93, 0x8a, 0xaa,
+	     0xc6, 0xd8, 0x25, 0x16, 0x82, 0x37, 0x46, 0xf9, 0x48, 0x3f,
+	     0x0f, 0x7f, 0x68, 0xb3, 0x52, 0x1d, 0x2e, 0x0c, 0xfa, 0x23,
+	     0x6c, 0x35, 0xe7, 0xdc, 0x97, 0xef, 0xba, 0xb2, 0xc7, 0x68,
+	     0x73, 0xd5, 0xe0, 0x10, 0x73, 0x8a, 0x3b, 0x11, 0x5e, 0x72,
+	     0x0a, 0x54, 0xa6, 0x41, 0xbb, 0x59, 0x1d, 0x34, 0x78, 0x23,
+	     0x04, 0x4b, 0x81, 0x92, 0xcf, 0x4d, 0xfc, 0x35, 0xbb, 0x6a,
+	     0x99, 0xa0, 0x01, 0x5f, 0x21, 0xd8, 0x1c, 0xbd, 0x04, 0x17,
+	     0x44, 0xb1, 0xc4, 0xcd, 0x6a, 0xe6, 0xe1, 0x7b, 0xf2, 0x9a,
+	     0x0c, 0x27, 0xff, 0x0e, 0xd0, 0x6e, 0x87, 0x08, 0xab, 0x70,
+	     0x0f, 0xea, 0x4e, 0xf4, 0x13, 0x31, 0xaf, 0x7d, 0x8f, 0xf6,
+	     0xb0, 0x74, 0x41, 0x6c, 0xfc, 0x5a, 0x44, 0x77, 0x4e, 0x11,
+	     0xfc, 0x89, 0x78, 0x06, 0xc9, 0x4d, 0x46, 0x07, 0xba, 0xd0,
+	     0x0e, 0x4c, 0x2b, 0xb2, 0x84, 0x5c, 0x4a, 0x08, 0x49, 0xbe,
+	     0x45, 0xde, 0x67, 0x56, 0x2c, 0x04, 0x42, 0xd8, 0xca, 0x74,
+	     0x6f, 0xa8, 0xe4, 0x1f, 0x56, 0x65, 0xff, 0x94, 0x8b, 0xd1,
+	     0xa6, 0xd9, 0xc3, 0x62, 0x75, 0xee, 0x2b, 0xd6, 0x5d, 0xf6,
+	     0x69, 0xac, 0x24, 0xd1, 0xec, 0x94, 0x90, 0x23, 0xf8, 0x09,
+	     0x83, 0x9d, 0x1d, 0x93, 0x21, 0x0a, 0x0e, 0x98, 0x5b, 0xb3,
+	     0x6b, 0x98, 0xc3, 0xa4, 0x5d, 0xb2, 0xbe, 0xbe, 0x08, 0xc9,
+	     0xd0, 0x7f, 0x97, 0x22, 0x10, 0xba, 0x39, 0x19, 0x97, 0x32,
+	     0xd5, 0xaf, 0xc5, 0x85, 0x03, 0x00, 0xaa, 0x72, 0xef, 0x2a,
+	     0xcc, 0x94, 0x25, 0x98, 0x58, 0x64, 0x9e, 0xca, 0xde, 0x2c,
+	     0x60, 0x58, 0x67, 0xd9, 0xd9, 0x39, 0x3e, 0x89, 0x3e, 0x4f,
+	     0x2a, 0x29, 0x77, 0xe2, 0xdc, 0xcd, 0x77, 0x54, 0xf9, 0x10,
+	     0xc6, 0x68, 0x87, 0x8a, 0x71, 0xaa, 0xad, 0x6d, 0xd0, 0xac,
+	     0x66, 0x23, 0xb9, 0x68, 0x63, 0x48, 0x61, 0x1e, 0x35, 0x95,
+	     0x33, 0xae, 0x05, 0xca, 0x31, 0x68, 0x29, 0x90, 0x55, 0xa2,
+	     0x45, 0xd8, 0xb1, 0x82, 0x3d, 0x58, 0x42, 0x33, 0x22, 0x1d,
+	     0x64, 0x28, 0x65, 0x39, 0x20, 0xb3, 0xf1, 0x45, 0xfa, 0x83,
+	     0x34, 0xbf, 0xa4, 0x02, 0x3a, 0x41, 0xd3, 0x00, 0xfa, 0x93,
+	     0x34, 0x5c, 0x59, 0xf2, 0x26, 0x20, 0xaf, 0x45, 0xe5, 0x57,
+	     0xca, 0xea, 0x78, 0x36, 0x08, 0x81, 0xd5, 0xe2, 0x40, 0x66,
+	     0xf1, 0x15, 0x42, 0x21, 0xb4, 0xb2, 0x3b, 0xf9, 0x27, 0xb9,
+	     0x15, 0x9a, 0x97, 0xca, 0x71, 0x06, 0xa8, 0x3c, 0x0e, 0x1b,
+	     0xcd, 0xa7, 0x96, 0x11, 0x5a, 0x28, 0x01, 0x4d, 0x32, 0x76,
+	     0xe0, 0x1e, 0xc2, 0xcf, 0x5a, 0xcf, 0xff, 0x21, 0xff, 0x19,
+	     0x51, 0xdc, 0x00, 0xf4, 0x24, 0xef, 0xb5, 0x9a, 0x62, 0xaa,
+	     0xaa, 0x43, 0x02, 0x41, 0x8b, 0x0e, 0x35, 0xe0, 0xd8, 0x23,
+	     0xd4, 0x12, 0x61, 0x90, 0xe1, 0x66, 0x46, 0x80, 0xff, 0x58,
+	     0x36, 0x2a, 0xd5, 0x52, 0x42, 0xa0, 0x3e, 0xcc, 0x9d, 0xe3,
+	     0xa2, 0x14, 0x42, 0x81, 0x10, 0x25, 0x26, 0x65, 0x74, 0x64,
+	     0x6e, 0x2a, 0xe6, 0x47, 0x9a, 0x4b, 0xd5, 0x66, 0x87, 0xb2,
+	     0x24, 0xd4, 0x11, 0x31, 0x65, 0xd8, 0x36, 0xb9, 0x8e, 0xb5,
+	     0x8c, 0x41, 0x06, 0x9b, 0xf1, 0xda, 0x2d, 0x1b, 0xf6, 0x16,
+	     0xe7, 0x80, 0xbb, 0x97, 0x87, 0x41, 0xdf, 0x38, 0x74, 0x08,
+	     0x66, 0xf0, 0xd8, 0x22, 0x79, 0x9b, 0x1c, 0xec, 0xcb, 0xce,
+	     0x89, 0x67, 0xe0, 0x1b, 0x6c, 0x96, 0x95, 0x0f, 0xee, 0x56,
+	     0xf5, 0x12, 0x4d, 0x5e, 0xb6, 0x2d, 0x2c, 0xe0, 0x7f, 0xa1,
+	     0x53, 0xbd, 0x7c, 0x26, 0x81, 0x19, 0x09, 0x26, 0x98, 0xcc,
+	     0xea, 0x21, 0x37, 0x28, 0x94, 0xf9, 0xa9, 0xbf, 0xfa, 0x50,
+	     0xe0, 0x02, 0xfa, 0x05, 0x6b, 0x80, 0x07, 0x21, 0xf9, 0xab,
+	     0x30, 0x7d, 0x3f, 0x7c, 0x0d, 0x69, 0x84, 0x6f, 0x66, 0x51,
+	     0xcb, 0x89, 0x46, 0x13, 0x7b, 0x1f, 0x48, 0xaa, 0xa2, 0x47,
+	     0xba, 0x49, 0x40, 0x5a, 0xab, 0x8d, 0xe5, 0xd8, 0x3b, 0xd3,
+	     0x12, 0x5e, 0x78, 0x84, 0x73, 0x33, 0x93, 0x6f, 0xd9, 0x99,
+	     0xc3, 0xa9, 0x31, 0xcc, 0x19, 0x74, 0xe8, 0xc1, 0x10, 0x45,
+	     0xbf, 0x9e, 0xc6, 0x91, 0x9a, 0xc4, 0x47, 0x43, 0x83, 0x33,
+	     0xb4, 0xa9, 0x26, 0x02, 0x28, 0x9f, 0xac, 0xe1, 0xe1, 0x6d,
+	     0xc4, 0x88, 0x94, 0xbe, 0x62, 0xcf, 0x10, 0x04, 0xdf, 0x1b,
+	     0x04, 0x25, 0x57, 0x1c, 0x4d, 0x32, 0xb7, 0x69, 0x42, 0x04,
+	     0x50, 0xd4, 0x05, 0x92, 0x0d, 0xd0, 0x02, 0xfb, 0x88, 0x8c,
+	     0xe4, 0x9f, 0xa0, 0xa0, 0x1a, 0x96, 0x8c, 0x6b, 0x30, 0x8d,
+	     0x05, 0xc5, 0x5a, 0xc4, 0x77, 0x86, 0xe9, 0x06, 0xf9, 0x52,
+	     0x10, 0x74, 0x12, 0xb5, 0x05, 0x74, 0xa4, 0x0d, 0xd9, 0x20,
+	     0x22, 0x84, 0x59, 0xca, 0x08, 0x94, 0x0c, 0x0e, 0x59, 0x73,
+	     0x03, 0x9b, 0x8c, 0x5e, 0x91, 0x88, 0xd5, 0x37, 0xe9, 0x60,
+	     0xdc, 0x8c, 0x81, 0x70, 0x76, 0x32, 0x46, 0xce, 0xa1, 0x12,
+	     0x05, 0x8f, 0x27, 0x2c, 0x61, 0x00, 0x3d, 0x00, 0xb1, 0x90,
+	     0x44, 0x0d, 0x12, 0xa4, 0x05, 0xc6, 0x2f, 0xf1, 0x4b, 0x1a,
+	     0x59, 0x32, 0x46, 0xd0, 0x96, 0xa2, 0xaa, 0x98, 0x9d, 0x42,
+	     0x46, 0x6f, 0x79, 0xb6, 0x83, 0x8e, 0x11, 0x9b, 0x34, 0x13,
+	     0xf5, 0xa0, 0x85, 0x95, 0xf0, 0x06, 0x6d, 0x11, 0xd7, 0x7b,
+	     0xbc, 0x50, 0xae, 0xc2, 0x95, 0x8d, 0x1f, 0x7c, 0x8e, 0xb5,
+	     0xe9, 0xc5, 0xc5, 0xe1, 0x01, 0x0b, 0x41, 0x06, 0x70, 0x03,
+	     0x0c, 0x1a, 0xa4, 0xc7, 0x85, 0xc0, 0x1f, 0xf9, 0x24, 0xb0,
+	     0xf6, 0xd4, 0xa5, 0xd0, 0x13, 0xca, 0x93, 0xe3, 0xd3, 0x66,
+	     0x60, 0x8c, 0x49, 0x0b, 0xe8, 0x05, 0x46, 0xf5, 0xd8, 0x08,
+	     0x77, 0x8a, 0x7a, 0x26, 0xd8, 0x4d, 0x4e, 0x34, 0x15, 0xea,
+	     0xf1, 0xad, 0xd2, 0x5a, 0x84, 0x92, 0x83, 0x68, 0xcc, 0x46,
+	     0x21, 0x4d, 0xf4, 0x66, 0xf3, 0x07, 0xb5, 0x84, 0x58, 0x70,
+	     0x45, 0x8f, 0x67, 0x23, 0x62, 0x65, 0x0c, 0x70, 0x57, 0xda,
+	     0xef, 0xbd, 0x2f, 0xeb, 0x19, 0x0b, 0xc2, 0xc3, 0x88, 0xbf,
+	     0x24, 0x09, 0xc3, 0xfe, 0x00, 0xfb, 0xf5, 0x0b, 0xf4, 0x1e,
+	     0x29, 0x86, 0xbd, 0xc8, 0xf3, 0x29, 0x54, 0x37, 0x10, 0xb3,
+	     0xd1, 0x5c, 0x4f, 0x56, 0x0b, 0xf0, 0x0d, 0x66, 0x5d, 0x74,
+	     0x71, 0x19, 0x72, 0x58, 0x02, 0x59, 0x86, 0x01, 0x39, 0x78,
+	     0xcc, 0xbc, 0x3c, 0xd0, 0x82, 0xc3, 0x0c, 0x46, 0xea, 0x83,
+	     0x63, 0x44, 0xa3, 0x04, 0x6a, 0xb4, 0xbd, 0x0e, 0xd2, 0x7d,
+	     0x88, 0x8e, 0x21, 0x37, 0xaa, 0x2d, 0x6c, 0x0f, 0x10, 0x5a,
+	     0x1b, 0xb1, 0x22, 0x0b, 0xdd, 0x27, 0xc4, 0x81, 0x8d, 0x4b,
+	     0x7c, 0x79, 0x3f, 0xf4, 0x81, 0x98, 0xc0, 0xcc, 0xc4, 0xf4,
+	     0xac, 0xfd, 0xd8, 0x00, 0xf4, 0x31, 0x88, 0x52, 0x18, 0x42,
+	     0xc9, 0xcb, 0x4a, 0x1e, 0x9f, 0xd0, 0x0e, 0xb8, 0x57, 0x93,
+	     0x28, 0x0a, 0x71, 0xb2, 0x36, 0xdc, 0x24, 0xd9, 0xa2, 0xa3,
+	     0x4c, 0x1f, 0xe6, 0x67, 0xe3, 0x4e, 0x68, 0x9c, 0x64, 0x0c,
+	     0x14, 0x0d, 0xbc, 0xd4, 0xe0, 0x63, 0x22, 0x57, 0x64, 0x0a,
+	     0x15, 0xf6, 0xa6, 0x44, 0x1b, 0x57, 0x8d, 0x93, 0xc2, 0xd1,
+	     0xaf, 0xc5, 0x21, 0xa1, 0x93, 0x2b, 0xad, 0x01, 0x3f, 0x6d,
+	     0x18, 0x3a, 0x10, 0x20, 0x1e, 0x30, 0x2e, 0x72, 0xa3, 0x2b,
+	     0x3b, 0xb4, 0x8e, 0xc4, 0x8f, 0x92, 0x8a, 0xc7, 0x58, 0x1b,
+	     0x4d, 0x57, 0x34, 0x7f, 0x58, 0xdc, 0xb0, 0x19, 0xd3, 0x96,
+	     0x6b, 0xc5, 0xe5, 0x62, 0x82, 0xab, 0xd3, 0xd7, 0xb7, 0x02,
+	     0xd8, 0x80, 0x6a, 0xc0, 0x3f, 0x8b, 0x27, 0x6c, 0xc5, 0x8b,
+	     0x25, 0x7b, 0xc3, 0x05, 0x9a, 0x4b, 0x35, 0x80, 0xa4, 0x6e,
+	     0x37, 0x98, 0xa1, 0x1e, 0x6d, 0x21, 0x6d, 0xf3, 0x7c, 0x03,
+	     0xe4, 0x81, 0x9a, 0x98, 0x73, 0x80, 0x0e, 0x09, 0x1b, 0x84,
+	     0xe9, 0x3d, 0x49, 0x1b, 0xfb, 0x4c, 0xe8, 0x35, 0x90, 0x8a,
+	     0x3d, 0x1e, 0xb5, 0x82, 0x28, 0x21, 0xf4, 0x90, 0x88, 0x7a,
+	     0x75, 0x14, 0x35, 0xa3, 0x44, 0x40, 0x0f, 0x12, 0x5b, 0x1c,
+	     0xb2, 0x6d, 0xe0, 0xb6, 0x80, 0x1e, 0x68, 0x71, 0x20, 0x36,
+	     0x0d, 0xaf, 0x11, 0x60, 0x39, 0xcb, 0xb2, 0xb9, 0x03, 0x63,
+	     0x36, 0xc9, 0x23, 0x48, 0x85, 0x8d, 0x82, 0x5f, 0x53, 0xad,
+	     0x49, 0xf0, 0xc7, 0x32, 0x91, 0x07, 0x55, 0x9a, 0xb0, 0x42,
+	     0x0b, 0x10, 0x0c, 0x0b, 0x18, 0xcc, 0x8f, 0x96, 0xe1, 0xba,
+	     0xc0, 0x5c, 0x86, 0xb0, 0x5e, 0x6d, 0x0c, 0xf2, 0x56, 0xb3,
+	     0xca, 0x33, 0x71, 0x59, 0x6b, 0x04, 0x89, 0xb9, 0x18, 0x65,
+	     0xc9, 0x98, 0x75, 0xc9, 0x12, 0x32, 0xc2, 0x25, 0x7c, 0x23,
+	     0x8f, 0x29, 0x58, 0x4c, 0x1f, 0x5e, 0x98, 0xc8, 0x21, 0x98,
+	     0x6e, 0xfb, 0xf7, 0x98, 0x23, 0xc8, 0x7c, 0x48, 0xf0, 0x50,
+	     0x75, 0xad, 0xc2, 0xd9, 0xf2, 0x25, 0x69, 0xf9, 0x73, 0x91,
+	     0xda, 0x08, 0x9f, 0x0c, 0x9a, 0x95, 0x3b, 0x33, 0xe5, 0x39,
+	     0x8d, 0x60, 0x48, 0xb4, 0xf0, 0x19, 0x5e, 0x97, 0x40, 0x06,
+	     0xfa, 0x83, 0xb1, 0xa0, 0x0f, 0xf1, 0xae, 0xb6, 0x79, 0xa1,
+	     0xee, 0x41, 0xe5, 0x46, 0x34, 0x53, 0x82, 0x12, 0x5c, 0x42,
+	     0xee, 0x90, 0x80, 0xa9, 0x41, 0x2c, 0xa9, 0xd7, 0x22, 0x06,
+	     0xb8, 0x4d, 0x76, 0x20, 0xb2, 0x2a, 0x1b, 0xb1, 0x8c, 0x2a,
+	     0x42, 0xf1, 0x24, 0x39, 0x0d, 0x0f, 0x21, 0xbe, 0x42, 0x02,
+	     0x0f, 0xcf, 0xe2, 0x0d, 0x99, 0x42, 0x72, 0xa7, 0x08, 0x6e,
+	     0x26, 0x36, 0xff, 0x41, 0x87, 0x66, 0x23, 0xe7, 0x22, 0xdc,
+	     0x4e, 0x44, 0xb9, 0xe8, 0x26, 0x0e, 0xc8, 0x17, 0x14, 0x10,
+	     0x04, 0xd8, 0x32, 0x16, 0x69, 0x08, 0xb9, 0x94, 0x00, 0x02,
+	     0x88, 0x9b, 0xef, 0xa6, 0x72, 0x63, 0xa4, 0x47, 0xec, 0xb0,
+	     0xde, 0x18, 0x59, 0xaa, 0x99, 0xed, 0xa8, 0x90, 0x1b, 0xdb,
+	     0x81, 0x5e, 0xa4, 0x19, 0x1c, 0x17, 0x06, 0x17, 0x89, 0x10,
+	     0x4c, 0x34, 0xa4, 0x80, 0x80, 0x71, 0x27, 0x00, 0x4f, 0x81,
+	     0xb6, 0x71, 0x0c, 0x3e, 0x86, 0x8f, 0x8b, 0xf1, 0x5f, 0x70,
+	     0xa9, 0x80, 0x77, 0x75, 0xf3, 0x34, 0xb5, 0x1a, 0x24, 0x05,
+	     0xa6, 0x46, 0x65, 0x98, 0x21, 0x43, 0x20, 0xc6, 0x88, 0x44,
+	     0x38, 0xca, 0xe5, 0xbe, 0x2e, 0x54, 0xad, 0x60, 0x44, 0x75,
+	     0x60, 0x6d, 0x14, 0x9a, 0x11, 0x4d, 0x55, 0x79, 0xb0, 0x38,
+	     0xc5, 0x8d, 0x01, 0xe2, 0x1f, 0x09, 0x57, 0xb4, 0xed, 0xeb,
+	     0x32, 0x45, 0x78, 0x1c, 0x0f, 0x70, 0xc1, 0x11, 0x63, 0xb9,
+	     0x85, 0xd2, 0x85, 0xde, 0x04, 0x46, 0x6c, 0x94, 0x98, 0x1b,
+	     0xc2, 0x0a, 0xc2, 0xd1, 0x50, 0x60, 0x25, 0x89, 0x94, 0xf4,
+	     0x2b, 0xed, 0x34, 0xde, 0x92, 0x3e, 0x2c, 0x9c, 0x8a, 0x54,
+	     0xf1, 0x5f, 0xd5, 0xe6, 0x98, 0x6c, 0x25, 0x8f, 0x9a, 0x4c,
+	     0xb4, 0xbc, 0x8d, 0xcd, 0x94, 0x08, 0x61, 0xf0, 0xdc, 0xbc,
+	     0xa5, 0x55, 0x07, 0x3d, 0x18, 0xc6, 0x3b, 0xc8, 0xa4, 0x8e,
+	     0x8f, 0xd7, 0x95, 0x16, 0x0a, 0x35, 0xbe, 0xd0, 0x6c, 0x46,
+	     0x86, 0xb4, 0xeb, 0xc3, 0x8d, 0xe4, 0x35, 0xf7, 0x83, 0xd8,
+	     0xd6, 0xdc, 0xa9, 0xaa, 0x3a, 0xae, 0x9c, 0x8e, 0x10, 0x43,
+	     0x13, 0x53, 0x68, 0x21, 0x14, 0x97, 0xa8, 0x5f, 0x7c, 0x14,
+	     0x56, 0x34, 0x3b, 0x80, 0x48, 0xe3, 0x49, 0xf6, 0xd5, 0x64,
+	     0x30, 0x22, 0x13, 0x5c, 0x1a, 0x54, 0x46, 0x9b, 0xc4, 0xf9,
+	     0x51, 0xe4, 0xa4, 0x72, 0x48, 0x74, 0x58, 0x15, 0xaf, 0x43,
+	     0x6b, 0x48, 0x1c, 0x17, 0xab, 0x8e, 0xbe, 0xf1, 0xab, 0xf1,
+	     0x65, 0xea, 0xc4, 0x02, 0x98, 0x2b, 0x01, 0x3e, 0xc2, 0x23,
+	     0xc2, 0xdb, 0x13, 0x01, 0x6b, 0x58, 0x62, 0x9a, 0x0a, 0x5f,
+	     0x22, 0xbe, 0x9e, 0xa4, 0x1f, 0x86, 0xe9, 0xf5, 0x02, 0x41,
+	     0xf6, 0xa0, 0x5f, 0xee, 0x00, 0xcf, 0x07, 0xfd, 0x42, 0x1b,
+	     0x88, 0x97, 0x01, 0x92, 0xa2, 0x1e, 0xe9, 0xb5, 0x7e, 0x01,
+	     0x14, 0x0b, 0xcf, 0x99, 0x78, 0xe5, 0x9f, 0xd2, 0x73, 0x78,
+	     0xf1, 0x21, 0x0d, 0xc5, 0x3f, 0x23, 0x87, 0xbf, 0x48, 0x65,
+	     0x84, 0x88, 0xb1, 0x14, 0x54, 0xd6, 0xa5, 0x02, 0x75, 0x3c,
+	     0x35, 0xb0, 0x06, 0x91, 0x9e, 0x4d, 0xbf, 0x21, 0x56, 0xe3,
+	     0x15, 0x86, 0x6a, 0xcc, 0x7b, 0xa2, 0x8a, 0x86, 0x1c, 0x29,
+	     0x45, 0x56, 0xc2, 0xb2, 0x9c, 0x1f, 0x75, 0x2f, 0x10, 0x32,
+	     0xd2, 0x9b, 0xbd, 0x0e, 0xe8, 0x12, 0xa0, 0x65, 0xb0, 0x3b,
+	     0x18, 0xa4, 0xc7, 0x28, 0x13, 0x57, 0x2a, 0x09, 0x11, 0xc3,
+	     0xb0, 0xa4, 0xf7, 0x81, 0x3b, 0x44, 0x05, 0x81, 0xe0, 0x01,
+	     0xfc, 0xaf, 0x1b, 0x5b, 0x6c, 0x27, 0xe2, 0x76, 0x29, 0xc1,
+	     0xa8, 0xf9, 0x36, 0xb2, 0x54, 0x6c, 0x8a, 0xb8, 0xd3, 0xc8,
+	     0x91, 0xe2, 0xb8, 0xd9, 0x82, 0x5a, 0x05, 0xfd, 0x40, 0x23,
+	     0x34, 0xc3, 0x87, 0x54, 0xb8, 0x8a, 0xfb, 0x03, 0x40, 0x7b,
+	     0xfc, 0xd0, 0x05, 0x5a, 0x3d, 0xfc, 0x2d, 0x6c, 0x04, 0x78,
+	     0xc3, 0xfb, 0x06, 0x7b, 0xeb, 0xd3, 0xd5, 0x0f, 0xe7, 0x95,
+	     0x0a, 0xce, 0x56, 0x89, 0x49, 0xe0, 0x1a, 0xa6, 0x44, 0x2a,
+	     0x02, 0xcc, 0x7b, 0xc0, 0x96, 0xdc, 0x41, 0x33, 0x4e, 0x9a,
+	     0x0f, 0x59, 0x90, 0xc4, 0x20, 0x5f, 0x12, 0x3e, 0x08, 0x21,
+	     0x49, 0x24, 0x9c, 0x1c, 0x8d, 0x0e, 0x67, 0xe4, 0xa4, 0x22,
+	     0xbd, 0x9d, 0x2a, 0x31, 0x44, 0xa3, 0x45, 0x8c, 0xce, 0x0f,
+	     0x32, 0x77, 0x95, 0x0a, 0x5b, 0x19, 0x69, 0x03, 0xe6, 0x8d,
+	     0x7b, 0x18, 0xfa, 0x4e, 0x62, 0x6f, 0x1e, 0x43, 0x57, 0x11,
+	     0x9c, 0x04, 0x55, 0x84, 0x98, 0x3d, 0xaf, 0x9e, 0x93, 0xa4,
+	     0x0e, 0x76, 0xf1, 0xb5, 0x1c, 0x63, 0xfc, 0x72, 0x60, 0x01,
+	     0xba, 0xc1, 0x16, 0x48, 0x24, 0x6c, 0xbc, 0x08, 0xd6, 0xc0,
+	     0xaf, 0x30, 0x00, 0xd9, 0x12, 0x6d, 0xc0, 0x02, 0x60, 0x61,
+	     0x29, 0xa5, 0x82, 0xa6, 0x1c, 0x1e, 0x24, 0x1a, 0xfc, 0x42,
+	     0xa4, 0x06, 0x54, 0x97, 0x69, 0xa6, 0x46, 0x45, 0x0d, 0xeb,
+	     0x1e, 0xa6, 0xd4, 0xa6, 0x34, 0xa3, 0x93, 0x01, 0x85, 0x49,
+	     0x53, 0x85, 0x26, 0x1b, 0xc4, 0x4d, 0x56, 0xb1, 0x1a, 0x6e,
+	     0xc1, 0x2e, 0xca, 0x02, 0x2c, 0x2f, 0xd7, 0xf5, 0x1d, 0x88,
+	     0x7f, 0x09, 0x53, 0x38, 0x05, 0xe9, 0x1a, 0x91, 0xca, 0x6c,
+	     0x2c, 0x30, 0xd6, 0xbe, 0xcc, 0x02, 0x64, 0x8f, 0x3e, 0x69,
+	     0x0d, 0x46, 0x14, 0x13, 0x19, 0xec, 0xae, 0x85, 0x19, 0xe9,
+	     0xec, 0xcd, 0x48, 0xa8, 0x1d, 0xa9, 0x32, 0x53, 0x58, 0x74,
+	     0x4c, 0xfa, 0x00, 0x37, 0x4c, 0x1d, 0xb2, 0xd9, 0x1a, 0x10,
+	     0xa3, 0x82, 0x35, 0xde, 0x40, 0xea, 0x49, 0x47, 0x09, 0xac,
+	     0x1d, 0x64, 0x11, 0x6b, 0x52, 0x39, 0x31, 0x1c, 0x5a, 0xd8,
+	     0x32, 0x8c, 0x16, 0xa1, 0xc9, 0x60, 0x2c, 0x2a, 0xc6, 0x65,
+	     0xe1, 0xb7, 0x75, 0x46, 0x9e, 0xa8, 0x53, 0xe3, 0x62, 0xb9,
+	     0x08, 0xb6, 0xa0, 0x48, 0x64, 0xe6, 0x09, 0x95, 0x13, 0x06,
+	     0xec, 0xf8, 0x26, 0x73, 0x3c, 0x85, 0xf4, 0xe6, 0x20, 0x2b,
+	     0xfa, 0x0b, 0x0c, 0xd4, 0xf1, 0xe4, 0xbb, 0xe8, 0x5d, 0xf1,
+	     0x06, 0xb2, 0x46, 0xa0, 0x36, 0xec, 0xca, 0xb9, 0xe1, 0x96,
+	     0xa1, 0xba, 0x75, 0x98, 0x03, 0xa5, 0x61, 0x39, 0xb0, 0x43,
+	     0x52, 0xc6, 0x15, 0x4e, 0xe0, 0xa8, 0x98, 0xa7, 0xb5, 0xb9,
+	     0x88, 0x48, 0xc1, 0x9e, 0x27, 0xfb, 0x16, 0x8e, 0xa2, 0x5d,
+	     0x4c, 0xec, 0x21, 0x04, 0xd2, 0x85, 0xec, 0x46, 0x14, 0x1b,
+	     0x26, 0x30, 0xc1, 0xd8, 0x88, 0x0f, 0xad, 0x09, 0x3a, 0xba,
+	     0x18, 0xe8, 0x43, 0xaa, 0x88, 0xec, 0x10, 0x8c, 0xdc, 0x03,
+	     0x62, 0xe0, 0x23, 0x78, 0xac, 0x91, 0x04, 0xd7, 0xd2, 0x3a,
+	     0xd3, 0x8e, 0x88, 0x61, 0x96, 0x0f, 0x51, 0xd0, 0x0c, 0x48,
+	     0x91, 0x64, 0x4b, 0x78, 0x5a, 0xbe, 0xc7, 0x3c, 0x9c, 0x57,
+	     0xe1, 0xb5, 0x37, 0x94, 0x6b, 0x78, 0x94, 0x87, 0x7a, 0x93,
+	     0x2a, 0x8e, 0x1c, 0x51, 0x2d, 0x72, 0x12, 0x43, 0xa9, 0x60,
+	     0x20, 0xd1, 0xa4, 0x04, 0x3c, 0x06, 0xad, 0xfc, 0x65, 0x2f,
+	     0x65, 0xdb, 0x45, 0x93, 0x01, 0x43, 0x8e, 0x72, 0xe0, 0x83,
+	     0x5c, 0xc1, 0x40, 0x8e, 0x48, 0xa7, 0xb6, 0x29, 0x32, 0x6c,
+	     0xc3, 0x8c, 0x9a, 0x56, 0x64, 0x8f, 0x1a, 0x05, 0x10, 0xbc,
+	     0x8c, 0x8c, 0xe5, 0xc4, 0x90, 0x73, 0x0c, 0xab, 0xfe, 0x8a,
+	     0x0d, 0x87, 0x28, 0x15, 0xe7, 0xe3, 0x6e, 0x60, 0xe9, 0xa0,
+	     0x08, 0xbc, 0xf2, 0x08, 0x4b, 0x1c, 0x25, 0x01, 0x88, 0x31,
+	     0x0a, 0xbc, 0xc5, 0xc4, 0xa4, 0x0c, 0x85, 0x4b, 0x34, 0x85,
+	     0x75, 0x3d, 0x65, 0xa3, 0xbb, 0xe4, 0x56, 0x07, 0x06, 0x91,
+	     0x5e, 0x94, 0xe4, 0x04, 0x99, 0xb7, 0xc3, 0xfd, 0x57, 0x8b,
+	     0x89, 0xfc, 0xc4, 0x21, 0xe0, 0x43, 0x3c, 0xa2, 0xa4, 0x2c,
+	     0x31, 0xc8, 0xb3, 0xd5, 0x73, 0xc9, 0xcc, 0x22, 0xf0, 0x80,
+	     0xdd, 0xb1, 0x5c, 0x5e, 0x51, 0xa2, 0x42, 0xb5, 0x07, 0xa0,
+	     0xe4, 0xa4, 0xc1, 0x93, 0x90, 0xc5, 0x11, 0xb7, 0x56, 0x00,
+	     0x4e, 0xa1, 0x41, 0x08, 0x78, 0xa5, 0x4b, 0x92, 0x3b, 0xdb,
+	     0xae, 0x54, 0x57, 0x14, 0x66, 0xbf, 0xb0, 0x66, 0x60, 0x1b,
+	     0xa1, 0xc0, 0xd3, 0x94, 0x78, 0x7e, 0xc4, 0x31, 0xaf, 0x57,
+	     0x07, 0xc5, 0x79, 0xd3, 0x10, 0x92, 0x55, 0x75, 0xe2, 0x0b,
+	     0x24, 0x74, 0x1b, 0x7a, 0x5d, 0xe3, 0x4d, 0x49, 0xc9, 0xe7,
+	     0xa0, 0xc0, 0xd5, 0x08, 0x0c, 0x2b, 0xf0, 0x78, 0x6a, 0x74,
+	     0x88, 0x9c, 0xe8, 0x97, 0xe7, 0xa5, 0x33, 0x53, 0x0d, 0x52,
+	     0xcc, 0x2d, 0xcb, 0x0c, 0x5d, 0xa1, 0x37, 0xec, 0xc9, 0x42,
+	     0x91, 0xd6, 0xb4, 0x19, 0x49, 0x3c, 0xd8, 0x22, 0x27, 0x7b,
+	     0x16, 0x9c, 0x92, 0x60, 0x0a, 0xe0, 0x27, 0x68, 0x03, 0xe4,
+	     0x09, 0xc0, 0xc8, 0x92, 0x44, 0x31, 0xb5, 0xe5, 0x46, 0x6b,
+	     0xc7, 0x1d, 0xd6, 0x73, 0xe9, 0x12, 0x34, 0xf0, 0xf2, 0x3f,
+	     0x50, 0x4d, 0x7d, 0xdf, 0x4b, 0x42, 0x48, 0x01, 0x9e, 0xa8,
+	     0xe2, 0x94, 0x83, 0x1a, 0x75, 0x7a, 0x29, 0xc6, 0x9b, 0x72,
+	     0xe8, 0xe7, 0x17, 0x9b, 0x9b, 0x0d, 0x1e, 0xa0, 0x1c, 0x53,
+	     0x33, 0x86, 0x68, 0x86, 0x42, 0x2e, 0xe8, 0x14, 0xb7, 0x7c,
+	     0x38, 0x7d, 0x10, 0xdc, 0x8d, 0x5c, 0xc9, 0x16, 0x19, 0x71,
+	     0x69, 0x79, 0x50, 0x35, 0xf4, 0xa8, 0x1c, 0x21, 0x80, 0x4d,
+	     0x12, 0x97, 0xf0, 0x55, 0x6d, 0x4d, 0x3c, 0x38, 0x92, 0xb3,
+	     0x13, 0xcc, 0xe3, 0x54, 0x84, 0x2f, 0x4a, 0x04, 0x89, 0x88,
+	     0xc0, 0x39, 0xc1, 0x74, 0x68, 0x01, 0x61, 0xf1, 0x5a, 0x86,
+	     0x11, 0x20, 0xbb, 0xc3, 0x8d, 0x52, 0xec, 0xf2, 0xd0, 0x24,
+	     0x66, 0xc2, 0xd8, 0x2c, 0x43, 0xa5, 0x80, 0x2a, 0x20, 0xa7,
+	     0x6e, 0xd6, 0xa6, 0xf0, 0x90, 0x2e, 0x7d, 0x09, 0x43, 0x6c,
+	     0xc6, 0x15, 0x8c, 0x10, 0x84, 0xf3, 0x5e, 0x95, 0x0f, 0x84,
+	     0xe8, 0x25, 0x12, 0xfb, 0x15, 0x6d, 0x9a, 0x5e, 0x56, 0x55,
+	     0xd0, 0xc7, 0xb2, 0x9d, 0xa2, 0x10, 0x6c, 0x75, 0xc4, 0x59,
+	     0xf3, 0x2c, 0x2e, 0x41, 0x99, 0x65, 0x9b, 0x65, 0x9d, 0x91,
+	     0x49, 0x50, 0x30, 0x51, 0x1e, 0x61, 0xa7, 0x7d, 0x42, 0xdb,
+	     0x6c, 0x90, 0xc6, 0x84, 0x9c, 0x2e, 0x90, 0x9b, 0x92, 0x20,
+	     0x5b, 0xa7, 0x14, 0x54, 0xf7, 0xaf, 0xec, 0xf6, 0x79, 0x2c,
+	     0x7d, 0xa4, 0x2f, 0x81, 0x58, 0x85, 0x0b, 0x0d, 0x0c, 0x0c,
+	     0xa1, 0xe1, 0x32, 0x0e, 0x90, 0x89, 0x09, 0xe1, 0x8c, 0x38,
+	     0xb0, 0x12, 0x9f, 0x54, 0x70, 0x27, 0xb6, 0x57, 0x42, 0x8b,
+	     0x0a, 0xd9, 0xeb, 0x72, 0x6c, 0x81, 0x30, 0xe8, 0x4f, 0x81,
+	     0x92, 0x3a, 0x21, 0x57, 0xe8, 0x5f, 0x42, 0x34, 0x0c, 0x2b,
+	     0xd0, 0xae, 0x72, 0xd9, 0x3c, 0x4a, 0x10, 0x76, 0x56, 0x74,
+	     0xa9, 0x88, 0xf7, 0x80, 0x52, 0x7a, 0x2b, 0xed, 0x24, 0xe2,
+	     0x02, 0x99, 0xb6, 0x7f, 0xb0, 0x78, 0x59, 0xe0, 0x3a, 0x76,
+	     0x0a, 0x1e, 0x7a, 0xa3, 0xef, 0xf2, 0x1b, 0x49, 0xe6, 0x23,
+	     0x9e, 0xfc, 0x09, 0xab, 0x10, 0x9e, 0xa1, 0x50, 0x66, 0x53,
+	     0x2e, 0x49, 0xf5, 0xce, 0xba, 0x16, 0xbe, 0x14, 0xc9, 0x00,
+	     0x2e, 0x27, 0x04, 0x4c, 0xd2, 0xe4, 0xb8, 0x06, 0x35, 0x19,
+	     0x11, 0x94, 0xb8, 0x52, 0x54, 0x15, 0x15, 0x7a, 0x53, 0x38,
+	     0xaa, 0x5b, 0x47, 0x5a, 0xb8, 0x30, 0x1d, 0x98, 0xf2, 0x66,
+	     0xd8, 0x28, 0x70, 0xe3, 0x69, 0xa0, 0x48, 0x03, 0x0b, 0x82,
+	     0x89, 0x70, 0x1d, 0xe3, 0x50, 0xc4, 0x0f, 0xb4, 0x4a, 0x0f,
+	     0xc6, 0x15, 0x93, 0x04, 0xbc, 0xdb, 0x00, 0x96, 0xa6, 0x2f,
+	     0xa8, 0x1b, 0xb4, 0x55, 0xc3, 0xe0, 0x32, 0x61, 0xb5, 0x79,
+	     0x96, 0x3d, 0x79, 0xdc, 0x0a, 0xcd, 0x46, 0x68, 0x58, 0xd5,
+	     0xe8, 0xd9, 0x72, 0x94, 0x44, 0x5f, 0x2c, 0x86, 0xd2, 0x58,
+	     0x34, 0x2d, 0x3a, 0x8a, 0x43, 0xa5, 0xbd, 0x20, 0xa3, 0x40,
+	     0x47, 0xb1, 0xeb, 0xc6, 0x88, 0xfc, 0x2c, 0x43, 0x51, 0x6a,
+	     0xa6, 0x9c, 0xe0, 0xdd, 0x41, 0x5c, 0x42, 0x7e, 0xe0, 0x1f,
+	     0x89, 0x15, 0x2a, 0x97, 0xc4, 0x61, 0x8b, 0x21, 0xf1, 0x00,
+	     0xd2, 0x78, 0x01, 0xe3, 0x43, 0x35, 0x32, 0xdb, 0x9a, 0x4b,
+	     0xad, 0x1b, 0xd2, 0xd3, 0x28, 0xc8, 0x90, 0x0d, 0xeb, 0x84,
+	     0x55, 0xa4, 0x35, 0x09, 0xc2, 0x63, 0x41, 0xa3, 0x67, 0x88,
+	     0x8c, 0xcc, 0x36, 0xd4, 0x40, 0x42, 0xaf, 0x7c, 0x61, 0x16,
+	     0x6c, 0x03, 0x89, 0x75, 0xba, 0xb1, 0x00, 0x24, 0xd4, 0x8e,
+	     0x0e, 0x17, 0x35, 0xc2, 0x0e, 0x4a, 0x25, 0x64, 0x2a, 0xc8,
+	     0x64, 0xc5, 0xb1, 0x3c, 0x6f, 0xe4, 0xb6, 0x3a, 0xce, 0xae,
+	     0x86, 0xf2, 0x56, 0x6f, 0x9b, 0xe3, 0x1d, 0xba, 0x9e, 0x16,
+	     0x41, 0xa2, 0x94, 0x1f, 0xfb, 0x92, 0x35, 0xc5, 0xb6, 0x84,
+	     0x4c, 0x01, 0x6d, 0xf8, 0x44, 0xb6, 0x96, 0xff, 0x07, 0x2f,
+	     0x53, 0x6a, 0x06, 0x36, 0xe3, 0x7b, 0xcd, 0x8b, 0xa6, 0x52,
+	     0x16, 0x32, 0x16, 0x4e, 0x9a, 0xe4, 0x77, 0x18, 0x96, 0x48,
+	     0xd3, 0x98, 0x15, 0x36, 0x8c, 0xa6, 0x43, 0x68, 0xa3, 0xb9,
+	     0xc7, 0x68, 0x30, 0x39, 0x21, 0x80, 0xb0, 0x0c, 0xf8, 0x8d,
+	     0x33, 0x38, 0x99, 0x00, 0x28, 0xc2, 0xce, 0x13, 0xe1, 0xdb,
+	     0x5c, 0xf8, 0xa7, 0x6a, 0x79, 0x36, 0x49, 0x02, 0x5f, 0x14,
+	     0x8a, 0x76, 0x57, 0x63, 0x21, 0x51, 0xbc, 0xbb, 0xee, 0x18,
+	     0x09, 0x98, 0x71, 0x90, 0xe8, 0x2f, 0x85, 0xd5, 0xee, 0xc0,
+	     0x85, 0x78, 0x87, 0x8c, 0x57, 0xe2, 0xa8, 0xa4, 0x9f, 0xb7,
+	     0xa0, 0xf9, 0xd3, 0x10, 0x01, 0x16, 0xc6, 0xcb, 0xb4, 0x61,
+	     0x76, 0xa2, 0xdb, 0x51, 0xb2, 0xf2, 0xc6, 0x71, 0x25, 0x99,
+	     0xc2, 0x2d, 0xb0, 0x86, 0x35, 0x25, 0x2f, 0x94, 0xe0, 0x3e,
+	     0x84, 0x0f, 0x60, 0xc9, 0x8c, 0x32, 0x1a, 0x6f, 0x46, 0x00,
+	     0xc9, 0x08, 0x9a, 0x20, 0x6e, 0x88, 0x19, 0x83, 0xb7, 0xe9,
+	     0x5d, 0xd5, 0xbe, 0x20, 0x51, 0x9c, 0xbe, 0x73, 0x5d, 0x37,
+	     0xc6, 0x53, 0xf9, 0xcb, 0x32, 0x97, 0xdd, 0x0e, 0xe8, 0x1e,
+	     0xba, 0x2e, 0x54, 0xcf, 0xbf, 0x4d, 0x83, 0xd3, 0x3e, 0x2a,
+	     0x2f, 0xe0, 0x41, 0x90, 0x81, 0xc1, 0x0b, 0xc9, 0x0c, 0x36,
+	     0x69, 0xdd, 0x36, 0xed, 0xbb, 0x45, 0x81, 0x66, 0xd8, 0x2a,
+	     0x9a, 0x80, 0xcd, 0x54, 0xf0, 0x69, 0x49, 0xc9, 0xb7, 0xb8,
+	     0xed, 0x30, 0x5f, 0xa4, 0x7c, 0x81, 0x27, 0xb7, 0xd9, 0xcd,
+	     0x03, 0x15, 0xd8, 0x88, 0x7b, 0x49, 0xb1, 0x13, 0xe2, 0x30,
+	     0xf6, 0x42, 0xd7, 0xa3, 0xa3, 0xa9, 0x2e, 0xe3, 0x74, 0xf4,
+	     0x00, 0x10, 0xe3, 0x38, 0x83, 0xa6, 0xc7, 0x5b, 0xde, 0xe2,
+	     0xf1, 0x10, 0xb9, 0x64, 0xfa, 0x6e, 0xa8, 0x2f, 0xb8, 0x4d,
+	     0x26, 0x11, 0xa8, 0x14, 0x05, 0x83, 0x3f, 0x74, 0x9a, 0x28,
+	     0x93, 0x0c, 0x8c, 0xea, 0x6c, 0x7f, 0x3f, 0x09, 0x89, 0x85,
+	     0x2e, 0x44, 0xc9, 0x92, 0x40, 0x70, 0x55, 0xda, 0xa2, 0x4a,
+	     0x7a, 0x0a, 0xa7, 0x51, 0x7c, 0xd2, 0x3c, 0xc0, 0x43, 0x50,
+	     0xf7, 0x30, 0x7d, 0xa0, 0x33, 0x08, 0x1d, 0x39, 0x1e, 0x7d,
+	     0x62, 0xf5, 0xf0, 0xeb, 0x43, 0xdf, 0x71, 0x20, 0xf8, 0x7c,
+	     0x52, 0x3c, 0x83, 0x83, 0x0d, 0xad, 0xb3, 0x30, 0xa4, 0x7b,
+	     0x71, 0x38, 0xbe, 0x40, 0x61, 0x2e, 0xb0, 0x81, 0x55, 0x24,
+	     0xc5, 0xbe, 0x85, 0x55, 0x5b, 0xdc, 0xd1, 0x5b, 0xd6, 0x65,
+	     0x00, 0x8f, 0xe9, 0x9c, 0x7e, 0xa9, 0x10, 0x24, 0x4e, 0x69,
+	     0x88, 0x25, 0x77, 0x44, 0x8d, 0x6c, 0x4d, 0x61, 0x54, 0x9c,
+	     0x0d, 0x03, 0x43, 0x6d, 0xe1, 0xc8, 0xed, 0x0c, 0x4f, 0x30,
+	     0xa5, 0x16, 0xac, 0x1b, 0xf3, 0x28, 0x48, 0x13, 0xfb, 0x90,
+	     0x3c, 0x35, 0xb1, 0x56, 0x20, 0x11, 0x08, 0xca, 0xa0, 0xf1,
+	     0x8d, 0x1b, 0x93, 0x5b, 0x74, 0x83, 0x85, 0x1a, 0x8a, 0x63,
+	     0xa7, 0x42, 0xb3, 0xe5, 0xb0, 0xad, 0xb9, 0xd8, 0x9a, 0x80,
+	     0x4f, 0x72, 0xaf, 0x1a, 0x34, 0xc0, 0x46, 0x7b, 0xc2, 0x60,
+	     0x00, 0x94, 0xa3, 0x27, 0x78, 0x38, 0xd4, 0xab, 0xde, 0x8a,
+	     0x97, 0x3f, 0xb1, 0x8a, 0xa6, 0xa3, 0x00, 0x94, 0xa7, 0xe9,
+	     0x24, 0x28, 0x12, 0xb7, 0x7e, 0x8c, 0x39, 0x23, 0x51, 0x9f,
+	     0xf1, 0x54, 0xc3, 0xd2, 0xb0, 0xbe, 0x1c, 0xdd, 0x6c, 0x47,
+	     0x20, 0x3d, 0x1d, 0x63, 0x14, 0x46, 0x4d, 0x53, 0xdb, 0x6b,
+	     0xd6, 0xc4, 0x12, 0x58, 0x10, 0x26, 0x3e, 0xda, 0x64, 0xd8,
+	     0x88, 0x33, 0x92, 0x6f, 0x88, 0x50, 0x00, 0xe2, 0xca, 0x76,
+	     0xa2, 0xab, 0x42, 0x0f, 0x62, 0x83, 0xf8, 0xc5, 0xad, 0x5c,
+	     0x17, 0x0e, 0x58, 0xdc, 0x13, 0xe2, 0x86, 0x2b, 0xe4, 0x64,
+	     0x21, 0x0c, 0x55, 0x53, 0x49, 0x1e, 0xac, 0x44, 0xc0, 0x7b,
+	     0x71, 0x26, 0x73, 0x5c, 0x56, 0x0d, 0x64, 0x84, 0xa5, 0x6c,
+	     0x55, 0xbe, 0xc8, 0x82, 0x1e, 0x12, 0xae, 0xf9, 0x20, 0x73,
+	     0x07, 0x45, 0x37, 0x8f, 0x14, 0x1d, 0x6e, 0x2c, 0x67, 0x97,
+	     0xbb, 0xb4, 0xed, 0x43, 0x07, 0x06, 0xc8, 0xc3, 0x5c, 0xba,
+	     0xea, 0xe1, 0xda, 0x06, 0x40, 0x2e, 0x9c, 0x4a, 0xa0, 0xd8,
+	     0xab, 0xb7, 0x20, 0x67, 0x28, 0xae, 0x69, 0x30, 0x65, 0x67,
+	     0xbf, 0xa7, 0xa7, 0xd8, 0x57, 0xd2, 0xb8, 0x14, 0xa9, 0xeb,
+	     0x1e, 0xad, 0xc4, 0xba, 0x10, 0xcb, 0x00, 0xd5, 0x24, 0xa7,
+	     0xc8, 0x2b, 0x29, 0xac, 0x23, 0x5e, 0x20, 0xfe, 0x26, 0x2e,
+	     0x4a, 0x83, 0xe3, 0x9f, 0x2f, 0x47, 0x59, 0x26, 0x82, 0x92,
+	     0xd1, 0x2c, 0xef, 0x30, 0x01, 0xfa, 0x04, 0xa6, 0xcb, 0x39,
+	     0xe6, 0x15, 0xf3, 0xbf, 0x9c, 0x83, 0x08, 0x17, 0x1f, 0x27,
+	     0x40, 0x37, 0xec, 0x84, 0xd1, 0x2f, 0xc2, 0x31, 0x9c, 0xda,
+	     0x33, 0xde, 0xfd, 0x24, 0x49, 0x96, 0xaa, 0x2b, 0xa6, 0x28,
+	     0x07, 0x3a, 0x80, 0x6a, 0xcc, 0x53, 0xe1, 0x18, 0xaa, 0x4d,
+	     0x6a, 0xb7, 0xcb, 0x4f, 0x00, 0xa0, 0x85, 0x03, 0x73, 0xf8,
+	     0xf6, 0xe1, 0xc5, 0xba, 0x77, 0x8b, 0x86, 0x90, 0x52, 0x1b,
+	     0x84, 0x29, 0x92, 0x1d, 0x48, 0x09, 0xe0, 0x5b, 0x20, 0x90,
+	     0xf3, 0x44, 0xf8, 0x58, 0x0c, 0xef, 0x2c, 0x03, 0xf7, 0x38,
+	     0x7c, 0xc8, 0x66, 0xf8, 0x78, 0x10, 0xa8, 0x93, 0xa2, 0x99,
+	     0x27, 0x57, 0xb2, 0x1e, 0xe2, 0x4c, 0x50, 0xaa, 0x88, 0x23,
+	     0x1f, 0x23, 0xcb, 0x25, 0x69, 0xe7, 0x38, 0xa0, 0x59, 0x62,
+	     0x15, 0xc2, 0xe1, 0x90, 0x74, 0x8e, 0x00, 0xc1, 0xd5, 0x0b,
+	     0xa8, 0xeb, 0x76, 0x68, 0x24, 0x8a, 0x48, 0x6c, 0xa8, 0x4f,
+	     0x36, 0x41, 0x97, 0x9d, 0x1f, 0x2f, 0xf2, 0xc4, 0x65, 0x5a,
+	     0x04, 0x50, 0x81, 0x98, 0x1d, 0x68, 0x30, 0x95, 0x17, 0x85,
+	     0xe3, 0xf2, 0x90, 0xd6, 0x32, 0x5c, 0xfc, 0xcc, 0xf8, 0x66,
+	     0x8d, 0xcc, 0x50, 0x0c, 0xfb, 0x84, 0x58, 0xb3, 0x05, 0x32,
+	     0xce, 0xd9, 0xdd, 0x5a, 0x6f, 0xbf, 0xb3, 0x4c, 0xcb, 0x00,
+	     0x21, 0x01, 0x17, 0x99, 0x8a, 0xe6, 0x90, 0x97, 0x5e, 0x8c,
+	     0x38, 0x13, 0x1f, 0x81, 0xc3, 0xab, 0x68, 0x90, 0x97, 0x94,
+	     0x80, 0xa5, 0xf1, 0xc0, 0x4a, 0x3f, 0xb8, 0xfa, 0x43, 0x0b,
+	     0x32, 0x10, 0x48, 0x84, 0xa1, 0xa4, 0xb5, 0x88, 0xec, 0x27,
+	     0x06, 0xc2, 0x04, 0x0d, 0x87, 0xf3, 0x4a, 0xe0, 0xe3, 0x52,
+	     0x34, 0x71, 0x0e, 0x0c, 0x6b, 0xc2, 0xbc, 0xe3, 0x23, 0xc3,
+	     0xec, 0xad, 0xa9, 0x65, 0xc2, 0x36, 0x42, 0x6e, 0xd8, 0x3a,
+	     0x0b, 0x30, 0xa5, 0x52, 0x91, 0x22, 0xb8, 0x67, 0xb5, 0x92,
+	     0xbb, 0xec, 0x25, 0x06, 0x68, 0xc0, 0x81, 0x72, 0x0d, 0xdf,
+	     0xae, 0x1d, 0xd4, 0xa8, 0x6a, 0x17, 0xf5, 0x8a, 0xe8, 0x1a,
+	     0xd6, 0x9c, 0x09, 0x54, 0x05, 0x06, 0x12, 0x63, 0x9a, 0x12,
+	     0x44, 0x3c, 0x99, 0xd2, 0x64, 0x2a, 0x14, 0x98, 0x1e, 0x1f,
+	     0x29, 0x82, 0x78, 0xc2, 0xf0, 0xd7, 0x04, 0x2a, 0x00, 0x31,
+	     0xd7, 0xb2, 0xc7, 0xe0, 0x06, 0x67, 0xe6, 0x72, 0x2b, 0x7a,
+	     0x1b, 0xc2, 0xd2, 0x30, 0x27, 0x5c, 0xa7, 0x74, 0x5f, 0xcd,
+	     0xcb, 0x9e, 0x07, 0x5b, 0xf3, 0x7f, 0x85, 0x25, 0x0b, 0x34,
+	     0xa5, 0xa2, 0x5f, 0xc9, 0x79, 0x4a, 0x1a, 0x52, 0x4e, 0xa1,
+	     0x41, 0xf6, 0x41, 0x6c, 0x75, 0xcf, 0xa9, 0x87, 0x58, 0x34,
+	     0x50, 0xed, 0x90, 0xce, 0x70, 0x03, 0x85, 0xf1, 0x6a, 0x86,
+	     0x9b, 0xc6, 0x90, 0xe1, 0x09, 0xe1, 0xa3, 0x50, 0x08, 0x58,
+	     0xd8, 0xa0, 0x15, 0xfa, 0x55, 0xd9, 0x40, 0xda, 0x17, 0x1c,
+	     0x81, 0x1a, 0xf5, 0x2f, 0xac, 0x24, 0x38, 0x22, 0xc1, 0x10,
+	     0xd5, 0xcb, 0x4a, 0x8d, 0x74, 0x42, 0xc8, 0xb3, 0x76, 0x03,
+	     0x7b, 0x3d, 0x0f, 0x4b, 0x9a, 0x0e, 0x10, 0xce, 0x8d, 0xa1,
+	     0x92, 0xda, 0x44, 0x8a, 0x5c, 0x2a, 0xfd, 0x30, 0xa8, 0x72,
+	     0xff, 0x8b, 0x55, 0x9f, 0xa6, 0xac, 0x2c, 0x34, 0xff, 0x49,
+	     0x8d, 0x38, 0x6a, 0x4c, 0x47, 0x40, 0x0e, 0x79, 0xe1, 0x48,
+	     0x71, 0xd6, 0xd3, 0xad, 0xc1, 0x62, 0xb4, 0x17, 0x25, 0x19,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint64_t hash_g[888] NBPERF_ALIGN64 = {
+	UINT64_C(0x9f6d350000000000), UINT64_C(0x1d4b103492ea82b8), UINT64_C(0x2b8666a282b97d2f),
+	UINT64_C(0x6429698105b934d2), UINT64_C(0x131da41bf964a019), UINT64_C(0x65018e94e54d225a),
+	UINT64_C(0x4bb3d7ed187c4723), UINT64_C(0xd86ef4acbdaca015), UINT64_C(0xa06b3400000000b7),
+	UINT64_C(0x4353f865c88b10d3), UINT64_C(0x550b2801b05e6507), UINT64_C(0xac0152428c742d1c),
+	UINT64_C(0x6774985f4511a141), UINT64_C(0x61b85b6738011d41), UINT64_C(0x34630949af8e8963),
+	UINT64_C(0x04a08b4489d7256a), UINT64_C(0x9f6f360000000174), UINT64_C(0x208d94d39ea38766),
+	UINT64_C(0x5734e60a9c081955), UINT64_C(0xe2664802151af5a4), UINT64_C(0x3806ab70b6850924),
+	UINT64_C(0xfdaa301b9a4b1c95), UINT64_C(0x1f0a7a1fab3988ee), UINT64_C(0x2a3398c76c931104),
+	UINT64_C(0xa46833000000022d), UINT64_C(0x34992bc288c786b5), UINT64_C(0xd9f32979c16a961e),
+	UINT64_C(0xe4cb29101149d801), UINT64_C(0xc67301615ccec050), UINT64_C(0x2611686245652990),
+	UINT64_C(0x228a867ee28a69e0), UINT64_C(0x332aa4a82010acc8), UINT64_C(0x97643400000002ed),
+	UINT64_C(0xc0437a3259bbd452), UINT64_C(0x17a6303e884d4096), UINT64_C(0xfba26fb54f9299ff),
+	UINT64_C(0x51802ce9d3952059), UINT64_C(0x56ddba47a8f1a617), UINT64_C(0x456ae7367500e796),
+	UINT64_C(0x66c6928144ae268b), UINT64_C(0xa9703800000003a1), UINT64_C(0x6a0400da236492e9),
+	UINT64_C(0x74e4b68a519b8e41), UINT64_C(0x0a2ad4b0ce8ee290), UINT64_C(0x9029515542de9409),
+	UINT64_C(0x0290525840a955ab), UINT64_C(0xc747029da34e4a08), UINT64_C(0x000a3edde4eb2167),
+	UINT64_C(0xa46f390000000462), UINT64_C(0x46ac1418fd5806aa), UINT64_C(0x40861481fa108031),
+	UINT64_C(0x0b5ef84432604201), UINT64_C(0x2e0630a57d100c50), UINT64_C(0xbd9f8d96ba3948d5),
+	UINT64_C(0x8a28a5818a0a5f9c), UINT64_C(0xec737ae36f96520c), UINT64_C(0xa37035000000051c),
+	UINT64_C(0xe4a7f6e292808e59), UINT64_C(0x061c34224855cb72), UINT64_C(0x46a7604ab1a05d20),
+	UINT64_C(0x14268a114966ace2), UINT64_C(0xcc34f406c8b9c250), UINT64_C(0x8bc358194d871959),
+	UINT64_C(0x43186422300977c2), UINT64_C(0x9f673500000005da), UINT64_C(0x7a681a9639150d6e),
+	UINT64_C(0x9b83e4c70e908831), UINT64_C(0xa6c477fc42bea15b), UINT64_C(0x3a6c7ea54568088d),
+	UINT64_C(0x312941aa10c85966), UINT64_C(0x595a778daea1d8e1), UINT64_C(0xfad23738d49e033a),
+	UINT64_C(0xa26633000000068f), UINT64_C(0x02b6cbde2004ee8e), UINT64_C(0x62346d6c6db51121),
+	UINT64_C(0x320b4528100485dc), UINT64_C(0x86a035ecb9d6ee3b), UINT64_C(0x8024981a9ea69644),
+	UINT64_C(0x0091d5894009d22c), UINT64_C(0x1705730d6a2a3099), UINT64_C(0x9d6936000000074c),
+	UINT64_C(0xaf30c19ba10bd119), UINT64_C(0x1f016a2630298666), UINT64_C(0x043fe5c2a58c4d98),
+	UINT64_C(0xd857724af1c64911), UINT64_C(0x3471053938149abd), UINT64_C(0xa7664978900c7cd8),
+	UINT64_C(0x066a639c22260994), UINT64_C(0xa36c340000000807), UINT64_C(0x0a81e3124c6e8898),
+	UINT64_C(0x8fae1004911dcbbb), UINT64_C(0x65396aa9aea52d95), UINT64_C(0x0f2a405416120f67),
+	UINT64_C(0x4497bba508d46821), UINT64_C(0x60d2a31aace01187), UINT64_C(0xc9f44b2804095cbc),
+	UINT64_C(0xa1683300000008c3), UINT64_C(0xd69af2884aad3d06), UINT64_C(0xdb1311c99ba6c11c),
+	UINT64_C(0x760ed19b198bc719), UINT64_C(0x85cd514090e6951e), UINT64_C(0x850550c98827a355),
+	UINT64_C(0x308a9893b85534a5), UINT64_C(0xa5543e549db8ba39), UINT64_C(0x9c6a32000000097e),
+	UINT64_C(0xcbe60c483387d98f), UINT64_C(0xf204d92852862c92), UINT64_C(0x0d99a9ba7605290c),
+	UINT64_C(0x01660a5d59b4eb44), UINT64_C(0xefe0d8630b04d116), UINT64_C(0xa9c3005b912e670b),
+	UINT64_C(0x192a98a5a64f432a), UINT64_C(0x9f672f0000000a37), UINT64_C(0x2a5d84d7cd715ab5),
+	UINT64_C(0x420cea252eecc2ff), UINT64_C(0x00db620064c6324a), UINT64_C(0x90db617622656398),
+	UINT64_C(0x185c9a70f6928512), UINT64_C(0x836918309f58a294), UINT64_C(0x4471299d07aeaf3d),
+	UINT64_C(0x9f6c380000000aee), UINT64_C(0x45da83a9414c9082), UINT64_C(0x25f13686e10246e9),
+	UINT64_C(0x26a635c78f448882), UINT64_C(0xcebb94e8aa39828c), UINT64_C(0xd4430bb28dea0eec),
+	UINT64_C(0x928e3291629b95ca), UINT64_C(0x6e9f64292ec285d7), UINT64_C(0xa56a370000000ba6),
+	UINT64_C(0xa41da0524de0a560), UINT64_C(0x3b91aa30ba064797), UINT64_C(0x46338f84f5256f18),
+	UINT64_C(0x8b9ee664938969c5), UINT64_C(0x18a2517696293a84), UINT64_C(0x0295afa02086a8b1),
+	UINT64_C(0x201845d94a9e8752), UINT64_C(0x9d6a340000000c68), UINT64_C(0x6422275128d81c78),
+	UINT64_C(0xbd365f0f18242b12), UINT64_C(0x3e642b25a9247763), UINT64_C(0x482286c2349c80e9),
+	UINT64_C(0x48a92b11a4cce3a0), UINT64_C(0xe05196f4f30c124d), UINT64_C(0xcc856cacec14e92e),
+	UINT64_C(0xa06b380000000d1d), UINT64_C(0x62064964c3119613), UINT64_C(0xdaa32a78196921dd),
+	UINT64_C(0x995cc18bc609d499), UINT64_C(0xa3168f365c74d2e6), UINT64_C(0xa83b5485faac972d),
+	UINT64_C(0xa80106934640caed), UINT64_C(0xa512626739b6022c), UINT64_C(0xa36b340000000dd9),
+	UINT64_C(0x2553254c5b5e4215), UINT64_C(0x96f15ccc683e82e2), UINT64_C(0x1179b212d48ad1fa),
+	UINT64_C(0x97990264e929d941), UINT64_C(0xd812201c6968a06f), UINT64_C(0x320445a22e1d0d46),
+	UINT64_C(0x659da2819314a652), UINT64_C(0xa36c360000000e9a), UINT64_C(0x8952fc2839fa5891),
+	UINT64_C(0x844c4362b822a2c4), UINT64_C(0x8227a4856658b88c), UINT64_C(0xd508c6a50cf75867),
+	UINT64_C(0x0ad8808e69f64d69), UINT64_C(0xec70a2171891501a), UINT64_C(0x38fcb7514284ea68),
+	UINT64_C(0xa471370000000f56), UINT64_C(0xd4a1ed8a4b112970), UINT64_C(0x429416ac48766d17),
+	UINT64_C(0x6a4540a6535a2b5d), UINT64_C(0x7d2a6e6208410011), UINT64_C(0x75144b6350a1193c),
+	UINT64_C(0xcd6ba4f0b6228d78), UINT64_C(0x818260726d94e850), UINT64_C(0xa56f340000001017),
+	UINT64_C(0x4c2e068d88cb1940), UINT64_C(0xb84f1e04453a0b07), UINT64_C(0xa905e06484285b34),
+	UINT64_C(0x1118361199c95202), UINT64_C(0x4352e912c4c82084), UINT64_C(0x26614c06337da64b),
+	UINT64_C(0x54616e2197a85076), UINT64_C(0x96602d00000010d9), UINT64_C(0x389f7c6067c2fd9e),
+	UINT64_C(0x6a26f64e8dfb62ab), UINT64_C(0x45b7173841d1a962), UINT64_C(0x80a8d6cc5dbbf528),
+	UINT64_C(0x15aa8bc821f10175), UINT64_C(0x0b872292f8e48180), UINT64_C(0xa210895e1e06dc6d),
+	UINT64_C(0x91642f000000118a), UINT64_C(0xb0cd566e273d1280), UINT64_C(0x1de9fc974fa5b8c5),
+	UINT64_C(0x598c6e0621681e40), UINT64_C(0x3d00ddcd2a5c2439), UINT64_C(0xdb4403c37938ea2f),
+	UINT64_C(0xf35531e1e6b124be), UINT64_C(0x251259087f154b95), UINT64_C(0xa46e370000001237),
+	UINT64_C(0x8381015314530853), UINT64_C(0xba1894402057313e), UINT64_C(0x424ad04881455923),
+	UINT64_C(0x43e7a345692a3c47), UINT64_C(0x5f185c8b91245131), UINT64_C(0x7b4d0969b150b180),
+	UINT64_C(0x2f5f1caae45c5981), UINT64_C(0xa16a3400000012f4), UINT64_C(0xf749548fa6843880),
+	UINT64_C(0x62e7bc0c78154850), UINT64_C(0xd1115a11fc0d8674), UINT64_C(0x6247366908491bc2),
+	UINT64_C(0x02e8781889da8651), UINT64_C(0x96a87cbd9e174680), UINT64_C(0x1a41d2366310833e),
+	UINT64_C(0x9e683200000013af), UINT64_C(0x125306ed1c27711e), UINT64_C(0x09c893b39a0e8e4c),
+	UINT64_C(0xea280681be220fad), UINT64_C(0x1414145502a6cddd), UINT64_C(0xeb908647716e10ec),
+	UINT64_C(0x7292629c5160957a), UINT64_C(0x7c180c1ca89da84a), UINT64_C(0xa8733c0000001468),
+	UINT64_C(0x641092a31e808ca3), UINT64_C(0xa6811a1515482162), UINT64_C(0xb1d52aba21a22aca),
+	UINT64_C(0x9b06b54617b44557), UINT64_C(0x8220a21ca162d75a), UINT64_C(0xd10750780ac7f8da),
+	UINT64_C(0x079f7b38d2ae4368), UINT64_C(0x905f2f0000001527), UINT64_C(0xb05f31bc43a5606e),
+	UINT64_C(0x6742fddb0db9c295), UINT64_C(0xcd09f91d36f65de4), UINT64_C(0x8db0948c5a5b2e31),
+	UINT64_C(0x05e192d2a2f353f3), UINT64_C(0x3c66e4ba51c09355), UINT64_C(0x3543b0000131705e),
+	UINT64_C(0x96623500000015d1), UINT64_C(0x166d644915e91b6e), UINT64_C(0xc28c467acdc0559c),
+	UINT64_C(0xa3979c37de8bef2c), UINT64_C(0x9bb571a432bae175), UINT64_C(0x69e1225f298f5763),
+	UINT64_C(0x202c303a14a53c61), UINT64_C(0x6536fdb47842ce56), UINT64_C(0xa7743c000000167f),
+	UINT64_C(0xa6586495a000a274), UINT64_C(0x002927961483c615), UINT64_C(0x72ea464d1aae12b9),
+	UINT64_C(0x10b5293968415321), UINT64_C(0x2db9466d22242ead), UINT64_C(0xc7b610ee445ebab4),
+	UINT64_C(0x2e184a1f729332d5), UINT64_C(0xa86e37000000173f), UINT64_C(0x78553c72d32c6660),
+	UINT64_C(0x1a006315184104d1), UINT64_C(0x68b699b187a099af), UINT64_C(0xc89293a15a0ed095),
+	UINT64_C(0x6d998105001ab582), UINT64_C(0xa91b1909c828acc8), UINT64_C(0x22f33d3a62968114),
+	UINT64_C(0x9864300000001801), UINT64_C(0x5e9218b43c7ff71d), UINT64_C(0x2e65f3214ba68469),
+	UINT64_C(0x55c89fe0716a908c), UINT64_C(0x527131ed57ad511a), UINT64_C(0xba43769ba5579543),
+	UINT64_C(0x1b212f5a01f66a70), UINT64_C(0xc31e961e4905a249), UINT64_C(0xa06b3300000018b5),
+	UINT64_C(0xa8f19854372da670), UINT64_C(0xed02268c2e07f611), UINT64_C(0x340196a9a4ccea78),
+	UINT64_C(0x9e8aa108c4823965), UINT64_C(0x1f5c2c104456d007), UINT64_C(0x520c50327326a467),
+	UINT64_C(0x2667443709012ac5), UINT64_C(0x9e6b340000001971), UINT64_C(0x6867c8270bc146b1),
+	UINT64_C(0x5d434381a2c91b0d), UINT64_C(0xe849f155a9a9b08b), UINT64_C(0xe9f280285160a172),
+	UINT64_C(0xd2166a92f715191b), UINT64_C(0x8fe8e2dca67e1204), UINT64_C(0x98f004031455a184),
+	UINT64_C(0x996a330000001a2c), UINT64_C(0x03b6a828161fe747), UINT64_C(0x3293148c423de91a),
+	UINT64_C(0x35213101dbb858e3), UINT64_C(0x16a861a41a43ca20), UINT64_C(0xb15cc89c143ab037),
+	UINT64_C(0x6e838ef55fa6dc14), UINT64_C(0x62810ca468524b09), UINT64_C(0x9a61320000001ae3),
+	UINT64_C(0x6702e2b460443f35), UINT64_C(0x32fed79568558979), UINT64_C(0x76e2b712c1c4c453),
+	UINT64_C(0x1b15801f8cfc3927), UINT64_C(0x85c836d945dde288), UINT64_C(0xa95600956504d594),
+	UINT64_C(0x44250aea1b987241), UINT64_C(0xa66f370000001b9a), UINT64_C(0x69484519d5dc4c19),
+	UINT64_C(0x6b1c91939c159676), UINT64_C(0xf022221e6618a1f6), UINT64_C(0x2ade81662534a206),
+	UINT64_C(0x51e546b251003d5b), UINT64_C(0x488de58c121a446b), UINT64_C(0x1e650a6d2b21511c),
+	UINT64_C(0x9d64340000001c5c), UINT64_C(0x64b28ba60d4840bc), UINT64_C(0xee9c69a03389c447),
+	UINT64_C(0x6942517d2931f12f), UINT64_C(0x19c2fdf02d5840c3), UINT64_C(0x510045d608730ae9),
+	UINT64_C(0x19d11c00d6299954), UINT64_C(0x366a4d34f0a06c29), UINT64_C(0xad74370000001d13),
+	UINT64_C(0x6d099f54f8ab8116), UINT64_C(0x9824ed0a40466174), UINT64_C(0x0415d4aaa8a88224),
+	UINT64_C(0x96281a4203aa0714), UINT64_C(0xaaa2a64c0d808c6c), UINT64_C(0x2a507459d5654d69),
+	UINT64_C(0xae9400c0dd63c380), UINT64_C(0xa16c350000001dd9), UINT64_C(0x979c12ae9aabc80c),
+	UINT64_C(0x3f250d219b52a628), UINT64_C(0xcc17a888c4325392), UINT64_C(0x9f9061667a245660),
+	UINT64_C(0x2b6c059633f28e92), UINT64_C(0x915656439805de6e), UINT64_C(0x3d09e5ae61217c06),
+	UINT64_C(0xa16d360000001e94), UINT64_C(0x5998b6632872d3a9), UINT64_C(0x44941db084af6b14),
+	UINT64_C(0x99a83e32527b1b7a), UINT64_C(0x92a8150b1a067014), UINT64_C(0x413caa8163a73301),
+	UINT64_C(0x6b0b0b928f257869), UINT64_C(0x8769129a081d884a), UINT64_C(0x9d67380000001f53),
+	UINT64_C(0x1402741321107010), UINT64_C(0x0b33b885e4862a1a), UINT64_C(0x073f831e72ea430d),
+	UINT64_C(0x494b3da2fe301688), UINT64_C(0x160bd02278daa6cd), UINT64_C(0x410082ca8c69d760),
+	UINT64_C(0x9528a49ec04cc9b9), UINT64_C(0xa87234000000200b), UINT64_C(0x131ef659c0ab04b2),
+	UINT64_C(0xa892714a71d3966b), UINT64_C(0x4604882002114123), UINT64_C(0x84a8502c426aa602),
+	UINT64_C(0x7d59d845a78a24c6), UINT64_C(0xe9e2a5264ee1860c), UINT64_C(0x2390351ba692e302),
+	UINT64_C(0xa36c3600000020ce), UINT64_C(0x1355a5da9553429a), UINT64_C(0x7007e6ca8b448ca3),
+	UINT64_C(0x4d982588f57ba042), UINT64_C(0x4596122f082ea39c), UINT64_C(0x618aa06c26ed0801),
+	UINT64_C(0xee9048802e64e8cd), UINT64_C(0x9af4bd7a0458c29b), UINT64_C(0xa86f36000000218a),
+	UINT64_C(0xb42bb06565e2762b), UINT64_C(0x7490caa00985c710), UINT64_C(0x558f52b964ead480),
+	UINT64_C(0x1c26149695402031), UINT64_C(0x79118758a1289e66), UINT64_C(0x2dd9b541d22256a2),
+	UINT64_C(0xac216b67280809a3), UINT64_C(0xa57339000000224e), UINT64_C(0x1758eb242458e944),
+	UINT64_C(0x4caeaab885aa5061), UINT64_C(0xc049055a58455879), UINT64_C(0x0411861ba028ae0f),
+	UINT64_C(0x70358d44c124cae6), UINT64_C(0xb8f73180ca2d9517), UINT64_C(0x422eae8585854097),
+	UINT64_C(0x9e68320000002310), UINT64_C(0x390de62ed2e7b416), UINT64_C(0x1ed46bb44c3a8506),
+	UINT64_C(0x5d6a54652f390b2e), UINT64_C(0x65a3a8e1496bc501), UINT64_C(0x47489aa18aae291c),
+	UINT64_C(0x7520dbc6554332e2), UINT64_C(0x781b8a950ba864ae), UINT64_C(0x99643100000023ca),
+	UINT64_C(0x58f05158245ecead), UINT64_C(0x9c75674663581ffe), UINT64_C(0x2d8741b59ac94516),
+	UINT64_C(0x00665e7c8fef49c6), UINT64_C(0x993991a1a0590c2b), UINT64_C(0xd99b9a755fb348c9),
+	UINT64_C(0x5e53888537a5089c), UINT64_C(0x9c6935000000247e), UINT64_C(0xe9ce7744b56d6942),
+	UINT64_C(0x282066a03612076f), UINT64_C(0x05e57273625cac00), UINT64_C(0xb1e614d7ab5815b8),
+	UINT64_C(0x463ac190481ffc28), UINT64_C(0x9c11c88af6d621d9), UINT64_C(0xb01e20126b048810),
+	UINT64_C(0xa16d370000002537), UINT64_C(0x9ea64825c6027446), UINT64_C(0xc961a3549e4ee95d),
+	UINT64_C(0x873c3a28be914a5c), UINT64_C(0x81a000045cf92911), UINT64_C(0xf27eaac4813562b8),
+	UINT64_C(0x961981680dd6139f), UINT64_C(0x855279648cb40262), UINT64_C(0xaa733800000025f5),
+	UINT64_C(0xc62674a200a00b28), UINT64_C(0x63db5991aa8561cc), UINT64_C(0x1516b6a542a628e4),
+	UINT64_C(0x67560230b4229080), UINT64_C(0xda3aa1950411b899), UINT64_C(0xc6298d0be399452d),
+	UINT64_C(0x6770213de2d00162), UINT64_C(0x9e6b3500000026b9), UINT64_C(0x52100a489e60e6bd),
+	UINT64_C(0x210c29eeef816e96), UINT64_C(0x3507c0a5c2415b66), UINT64_C(0x42c464bb984149e3),
+	UINT64_C(0xdc4fe93044dec829), UINT64_C(0x8523aad8469813ca), UINT64_C(0x29119d7137848279),
+	UINT64_C(0xa36e390000002772), UINT64_C(0x96491668994691f7), UINT64_C(0x5c944022f9453024),
+	UINT64_C(0xb85e864850b0d4b1), UINT64_C(0x0a309bf9da275a89), UINT64_C(0x2ed6300142239d38),
+	UINT64_C(0x6c84a31f0b481842), UINT64_C(0xd91a9dab1fe7959b), UINT64_C(0x9f6b38000000282d),
+	UINT64_C(0x2a02cda6718b1022), UINT64_C(0x43926aea8e685031), UINT64_C(0x282441df9c1edc7a),
+	UINT64_C(0x1e09cc19893411d6), UINT64_C(0x35926518b5d443b5), UINT64_C(0xa7cb0d139474985b),
+	UINT64_C(0xa9a750bec8393cd5), UINT64_C(0x9a643500000028e4), UINT64_C(0x148182e7f4a60b2d),
+	UINT64_C(0x2d4c59852c06ac76), UINT64_C(0x04baeca152b8dab6), UINT64_C(0x2b8a03ad5cc3d3ef),
+	UINT64_C(0x68228db45929a83d), UINT64_C(0x0458d0f6087ec808), UINT64_C(0xe1887ad796069978),
+	UINT64_C(0xa56c370000002999), UINT64_C(0x26a02aec519ad116), UINT64_C(0x28979aab27586773),
+	UINT64_C(0x5a8525707a595843), UINT64_C(0x47cd9819525377db), UINT64_C(0x2585ca8d872ad891),
+	UINT64_C(0x1a6517a0a11a348e), UINT64_C(0x1a718ae2c9864ea2), UINT64_C(0x9f6a360000002a5a),
+	UINT64_C(0x91a5a2416974fdaa), UINT64_C(0xa38477407f418561), UINT64_C(0xeeb06c03cf58b42b),
+	UINT64_C(0x1a741e521528992a), UINT64_C(0x4494b7864a6b1756), UINT64_C(0xd07ead10c2b5560c),
+	UINT64_C(0x04998848a8840087), UINT64_C(0xa46e380000002b18), UINT64_C(0xa489548605412fa8),
+	UINT64_C(0x70e93941d4b06c69), UINT64_C(0xc836ea0250dc2931), UINT64_C(0x4472126352dd55a4),
+	UINT64_C(0xd28a3d907c094904), UINT64_C(0x0ed5d02ca2248d46), UINT64_C(0x695c7e7a146a4813),
+	UINT64_C(0x9c6a360000002bd7), UINT64_C(0x2955c7020c849de9), UINT64_C(0x882ad3f5e2956592),
+	UINT64_C(0x94884c9500af32a7), UINT64_C(0x160cf2264bacba74), UINT64_C(0x4c55abb023191d63),
+	UINT64_C(0xcc8893a4700dcf41), UINT64_C(0x4d61799672b02251), UINT64_C(0xa46d380000002c8f),
+	UINT64_C(0xaba6ea9702f20265), UINT64_C(0xa9126360e18c2a65), UINT64_C(0xa4409cc0bca378c3),
+	UINT64_C(0x8156d2b601e90659), UINT64_C(0x24d7a8c979a70684), UINT64_C(0x55560469cc27661e),
+	UINT64_C(0x1cc9a10e2401599a), UINT64_C(0xa36c350000002d50), UINT64_C(0x224ad58b1f20f2da),
+	UINT64_C(0xa484401e93cab195), UINT64_C(0x386a3282536149a4), UINT64_C(0x521094557cee270e),
+	UINT64_C(0x046a269c5631ea9a), UINT64_C(0xb26064737e200c10), UINT64_C(0xcac5ba001ab7ca47),
+	UINT64_C(0x9e67330000002e0c), UINT64_C(0xa3c0a40bd971bd0d), UINT64_C(0xe501ada1a528c47b),
+	UINT64_C(0x70044c4aba0a5f22), UINT64_C(0x7355e6d61e96da0e), UINT64_C(0x0155a500c440a411),
+	UINT64_C(0xff10316445083c74), UINT64_C(0xa240c4c88c7cf402), UINT64_C(0xad73350000002ec3),
+	UINT64_C(0x096781d02892174b), UINT64_C(0x92f3f0092b61b102), UINT64_C(0x64018296405609a2),
+	UINT64_C(0x21214ec810195161), UINT64_C(0x8044600421221015), UINT64_C(0xb4c5b2c2a5814cd6),
+	UINT64_C(0x6f05701a66ac0851), UINT64_C(0x955e310000002f8c), UINT64_C(0x041caf7740bc0d9e),
+	UINT64_C(0xe81e03434ec2a610), UINT64_C(0x022f8621d38c30cb), UINT64_C(0x7138e0eccec79abd),
+	UINT64_C(0x84a06ed81429f84f), UINT64_C(0x161479896a42ba67), UINT64_C(0x02f1e28fa3a90541),
+	UINT64_C(0x945f31000000303b), UINT64_C(0xdeed5aea9f5b611e), UINT64_C(0x612c91da32f165d1),
+	UINT64_C(0x30366b47366dd6b6), UINT64_C(0xd2dd09375ec6d70c), UINT64_C(0x72722749ad8b460e),
+	UINT64_C(0x653574f286b090a1), UINT64_C(0x63f76928b7885750), UINT64_C(0x96653800000030e8),
+	UINT64_C(0x60a7c9ec6b4681a9), UINT64_C(0x290229ca13324aa8), UINT64_C(0xd28caf79bcc57aa9),
+	UINT64_C(0x176421ddede3ee3a), UINT64_C(0xc2300a0d35187ddb), UINT64_C(0xee258ec1d8adb408),
+	UINT64_C(0x25b3888a71a92a51), UINT64_C(0x9d652b000000319b), UINT64_C(0x37eab7633b06f6ff),
+	UINT64_C(0x031097cf30910d24), UINT64_C(0x9488e40da814af0a), UINT64_C(0x90794257a40885aa),
+	UINT64_C(0xd555600849024105), UINT64_C(0x169bad3e1c8af619), UINT64_C(0x331ea22224e6b859),
+	UINT64_C(0xa76f350000003253), UINT64_C(0x43e02a512280d0a1), UINT64_C(0x8b02bc16ac86eb4f),
+	UINT64_C(0xb35c5fa524625218), UINT64_C(0x28e6114162920945), UINT64_C(0x42b12ba1156c643b),
+	UINT64_C(0x559860ad925531a3), UINT64_C(0xb12800408294a9e6), UINT64_C(0x9c67310000003318),
+	UINT64_C(0x176721d9e71cee52), UINT64_C(0x69b91676301f765c), UINT64_C(0x75606f48059f3e57),
+	UINT64_C(0xb8c180020a602204), UINT64_C(0x1064424c4497723f), UINT64_C(0xa6a164831413ab2f),
+	UINT64_C(0x492201b2eaeca7f3), UINT64_C(0x96633500000033cc), UINT64_C(0x232d6c49571da528),
+	UINT64_C(0x29b40bd1254b3163), UINT64_C(0xe3cb5d9af59282df), UINT64_C(0x97cacb2abc2d36aa),
+	UINT64_C(0xa36e556917c15e53), UINT64_C(0x763d5af386910670), UINT64_C(0x4238e80126ca067f),
+	UINT64_C(0x925e2d000000347c), UINT64_C(0x3eb63ef1f492fefd), UINT64_C(0xdb88163a474511a6),
+	UINT64_C(0xe07131270577d293), UINT64_C(0x3aae6177ade89474), UINT64_C(0xb00030b84b7398c4),
+	UINT64_C(0xba86aa0f891189be), UINT64_C(0x7066ae11b47685fd), UINT64_C(0x8a582e0000003527),
+	UINT64_C(0x2679a4f694f0d1d4), UINT64_C(0x082cf975fee95fc1), UINT64_C(0x7e233795c99a0354),
+	UINT64_C(0xd1dcd7d4f9ff383e), UINT64_C(0x69fa964285a002ab), UINT64_C(0xd8ef13acd4cd43c8),
+	UINT64_C(0x06a8243a46aa8c61), UINT64_C(0x945f3400000035cf), UINT64_C(0x2b2096e60e51ba8f),
+	UINT64_C(0x9610c5e4ab66530f), UINT64_C(0x3ff104736afc912d), UINT64_C(0x38cc0ac3db0989df),
+	UINT64_C(0x221374ca96493522), UINT64_C(0x8550ad326cf43a2b), UINT64_C(0x33877d55159c7c53),
+	UINT64_C(0x935f32000000367a), UINT64_C(0x84fa56346b5a963e), UINT64_C(0xf1699374473e8e01),
+	UINT64_C(0x126cdcc735d33024), UINT64_C(0xeafab7b6910d3da7), UINT64_C(0x6a639eb942a7c393),
+	UINT64_C(0x56510087e35ba963), UINT64_C(0xb62beca446286344), UINT64_C(0x8f5b2c0000003728),
+	UINT64_C(0x70cfcf3fa6518579), UINT64_C(0x8637932020dabfcb), UINT64_C(0xd8fca1c96b01c571),
+	UINT64_C(0xb887707a8be2af83), UINT64_C(0xb1797a9780064a39), UINT64_C(0x6e8129b410fd9e32),
+	UINT64_C(0x6a03ebf2d3550eb3), UINT64_C(0x8f612a00000037cd), UINT64_C(0xf88cf7cc9f863f33),
+	UINT64_C(0x088b47bd50e1f84a), UINT64_C(0xd59c1bd046448b42), UINT64_C(0x69392d49aaf616a0),
+	UINT64_C(0xd23acba86a8fd24f), UINT64_C(0x19025e271f4f703e), UINT64_C(0x44640ece7c97bb0f),
+	UINT64_C(0x9466340000003872), UINT64_C(0x7e93de25a805baa6), UINT64_C(0x11c7a302b286193c),
+	UINT64_C(0xcc6755ce792acd76), UINT64_C(0x244260cf68656837), UINT64_C(0x51efadd09ed6a3cb),
+	UINT64_C(0xf43d8f593989630a), UINT64_C(0x7e0258ee62086608), UINT64_C(0x905a310000003922),
+	UINT64_C(0x46fbc9014fb132fc), UINT64_C(0x111675acd5104780), UINT64_C(0xd8fd079d7f17b7ca),
+	UINT64_C(0x2eb934dc4b7c94f4), UINT64_C(0xc58837c0aa2727a6), UINT64_C(0x660045c9509f03a9),
+	UINT64_C(0x25f50adc46b55120), UINT64_C(0x8a5d3000000039cd), UINT64_C(0xc57fd15fdd9c3291),
+	UINT64_C(0x69136cdc4280ad2a), UINT64_C(0x65cfa1acd31bc57d), UINT64_C(0xc31cae4ee6b9ed54),
+	UINT64_C(0x34f7dc679563dce1), UINT64_C(0x024c87379913b05f), UINT64_C(0x886b3d27f31123da),
+	UINT64_C(0x935f310000003a6e), UINT64_C(0x099600676acd91e6), UINT64_C(0xd966d8f5a33bf20f),
+	UINT64_C(0x03d3b434ec345084), UINT64_C(0x4713d567f3f2ae04), UINT64_C(0xf52843f8428d25c8),
+	UINT64_C(0xf01f91429a385a46), UINT64_C(0x6ca7dd7e0ad984fa), UINT64_C(0x9262330000003b18),
+	UINT64_C(0x043c5854d6308ad7), UINT64_C(0xa7e922419e733c80), UINT64_C(0x3cf948d1a0e67a31),
+	UINT64_C(0x1c4b2c2e935bdd6e), UINT64_C(0xcd96831d6c15c479), UINT64_C(0x979f8c579db63c9a),
+	UINT64_C(0x4c9b4862c646310e), UINT64_C(0x93632f0000003bc5), UINT64_C(0x3dd87850c84eafd2),
+	UINT64_C(0x1648eaa323d7d1dc), UINT64_C(0xcb2f426820c831aa), UINT64_C(0x711f614d63136a8a),
+	UINT64_C(0x01a8f6a0c2eba536), UINT64_C(0x8ac3d1c97379d67d), UINT64_C(0x34dc154204154619),
+	UINT64_C(0x8e60330000003c75), UINT64_C(0x5f92b3455926a60e), UINT64_C(0x7250d568cd1c8edc),
+	UINT64_C(0xc12f796e37a2f665), UINT64_C(0x65c1b3e1b75c2c5f), UINT64_C(0x49492d6fed04fd34),
+	UINT64_C(0x8aa1c8d2fddb43e0), UINT64_C(0x9b47c0fb60279252), UINT64_C(0x8d5f310000003d1c),
+	UINT64_C(0x7131f1b3b9d0570b), UINT64_C(0x02808117221adbdd), UINT64_C(0xb69fea44c0bd0f02),
+	UINT64_C(0x3f8a26de45c29fd0), UINT64_C(0x3aef5f0fc813c68c), UINT64_C(0x376e78d965366120),
+	UINT64_C(0x6e31d6d6b830614b), UINT64_C(0x915e310000003dc2), UINT64_C(0xfea17399dde87593),
+	UINT64_C(0x13410785c600d9a3), UINT64_C(0xe474f3d5cc26f63d), UINT64_C(0xea65c60f15fd8250),
+	UINT64_C(0xeded0194a6a959ba), UINT64_C(0xec68db865e04cdc8), UINT64_C(0xb6260d6d360e7c08),
+	UINT64_C(0x9868350000003e6c), UINT64_C(0x503414b422228149), UINT64_C(0x12334f3e02b94707),
+	UINT64_C(0x2c744e977c4ffc51), UINT64_C(0x1e25660863984619), UINT64_C(0xe2d4a52e095bbf5b),
+	UINT64_C(0x3cd8e002c523b2ca), UINT64_C(0xcff2014894e8895b), UINT64_C(0x93652d0000003f1d),
+	UINT64_C(0xde0d792ef06fa683), UINT64_C(0xde4bc300d5ba1d0d), UINT64_C(0x0135150b48556383),
+	UINT64_C(0x4a05263987b03692), UINT64_C(0xf5776586c1e1db80), UINT64_C(0x35e8795f2f236ab7),
+	UINT64_C(0x0d04442e014fddad), UINT64_C(0x8c5a310000003fc9), UINT64_C(0x372001dc58cb58ab),
+	UINT64_C(0x05ce9a840dfc0b0b), UINT64_C(0xb1b1710e53fc4cb0), UINT64_C(0xddf57f04fceaed12),
+	UINT64_C(0x12d42015d6a99dd3), UINT64_C(0xad8c0fee35382871), UINT64_C(0x32015a2fe0907459),
+	UINT64_C(0x915e2d0000004070), UINT64_C(0xd660d7d3db1a5952), UINT64_C(0x7db35ddb5f28a3af),
+	UINT64_C(0x3407f5800f01a75d), UINT64_C(0x4bf5d463a5493796), UINT64_C(0xe475086f2f0079c8),
+	UINT64_C(0xbb60a39565f08421), UINT64_C(0xf904856dea9546c5), UINT64_C(0x8d5f2d000000411c),
+	UINT64_C(0x4239bcf7242dbf85), UINT64_C(0xbd831cd503d57ba1), UINT64_C(0xac884b757478e232),
+	UINT64_C(0x521709ea1b807c37), UINT64_C(0x5b6f45c7ce7b868d), UINT64_C(0x97b54bee9bcb9652),
+	UINT64_C(0x1c0d041953277e47), UINT64_C(0x8f5d2e00000041c2), UINT64_C(0xc678590c8d7f74f2),
+	UINT64_C(0x8b2be112e90bb3ba), UINT64_C(0xbece28cdd6c9b8f1), UINT64_C(0x90fadd46e98565a7),
+	UINT64_C(0xe2ca8a7c9179da4f), UINT64_C(0x80e42278a850e3cc), UINT64_C(0x64132fcaf858d0f4),
+	UINT64_C(0x9c66320000004268), UINT64_C(0xa858b755506f8f8d), UINT64_C(0x3731265c638b01c0),
+	UINT64_C(0xe7eabe0588410380), UINT64_C(0x1650dd8560bab13c), UINT64_C(0x9c8a2012e055198d),
+	UINT64_C(0x0ad7240e31a3ac87), UINT64_C(0x159a9e4f00b46618), UINT64_C(0x905f300000004320),
+	UINT64_C(0x9181cfeda90c8230), UINT64_C(0xe2325960e3fabb32), UINT64_C(0x443ade26867d97d1),
+	UINT64_C(0xdfa1de674df288d0), UINT64_C(0xccc65895252908db), UINT64_C(0xbf6da83659d32d0f),
+	UINT64_C(0x7a7fb11ae6fc6324), UINT64_C(0x94613000000043c6), UINT64_C(0x8b1698af3c86cce7),
+	UINT64_C(0xf2739ca321a42da9), UINT64_C(0xae83186e4c5d06b4), UINT64_C(0xcee8a79d550c6dcd),
+	UINT64_C(0x877679373482a01a), UINT64_C(0x098bdcb2418672f5), UINT64_C(0xf9a0074f695d4413),
+	UINT64_C(0x8d62300000004473), UINT64_C(0xde1c5436c1021369), UINT64_C(0x02dc64b023f0f04f),
+	UINT64_C(0x73181a14ddd216ef), UINT64_C(0xa207105acb0f3244), UINT64_C(0x97de237369ea8d35),
+	UINT64_C(0xf55b9cd7e2e6e3db), UINT64_C(0x58272d8096c4b861), UINT64_C(0x926130000000451c),
+	UINT64_C(0x550592178f939f5f), UINT64_C(0x9d91a0bc9c60fb76), UINT64_C(0x097cc30b46393bad),
+	UINT64_C(0x39db9af94e4482a4), UINT64_C(0xb4f00bb09e60c585), UINT64_C(0x49dd7513c47d126b),
+	UINT64_C(0x2d888a24d7228563), UINT64_C(0x99643100000045ca), UINT64_C(0x2e6c854f0e3031b2),
+	UINT64_C(0xe893a2538e0277e6), UINT64_C(0xc52d71a81288b5ec), UINT64_C(0xb16d8c4296792e7d),
+	UINT64_C(0x81c2ce4461a5b706), UINT64_C(0x8665768317f3a228), UINT64_C(0xfb6b7c801b66aafd),
+	UINT64_C(0x8d5e2e0000004679), UINT64_C(0xfdf833615500839e), UINT64_C(0xb77c28d1afe200ac),
+	UINT64_C(0x51dc5778a41210c3), UINT64_C(0xe2cdee6ecd92bca8), UINT64_C(0xc577b56dae59b3d8),
+	UINT64_C(0x9797a0acecc0ab2e), UINT64_C(0x8a3591706b052cc4), UINT64_C(0x8b5c310000004721),
+	UINT64_C(0x9401d3d53f85472a), UINT64_C(0xda8d2b130ecd08e4), UINT64_C(0x9fb7d32b22395b87),
+	UINT64_C(0xc55710fc1c2fbd53), UINT64_C(0xb8357434c62035fa), UINT64_C(0xff9346c96c406f19),
+	UINT64_C(0x9f063460be7e9f27), UINT64_C(0x9d633200000047c2), UINT64_C(0xcbd9112f1878c1a3),
+	UINT64_C(0xb03839119a53fa82), UINT64_C(0x0b38043c670ec108), UINT64_C(0x7f941391d9fd690a),
+	UINT64_C(0x4508a7214678ae79), UINT64_C(0x120955485ae69740), UINT64_C(0x70ac166031bf7420),
+	UINT64_C(0x9260350000004878), UINT64_C(0x445ac7bfd1339517), UINT64_C(0x97905504b5549619),
+	UINT64_C(0x6f0fc9818d48fed3), UINT64_C(0xbf4fc4938e92e329), UINT64_C(0xc90c72a9034f5308),
+	UINT64_C(0x83d2c2c697c915c0), UINT64_C(0x1767beec58e3b156), UINT64_C(0x8859310000004921),
+	UINT64_C(0x0ecfd29f5d231408), UINT64_C(0x329efe50aa5e2646), UINT64_C(0xe9fbf0e47f413ff8),
+	UINT64_C(0x39341cc4967c2f6e), UINT64_C(0x5c73c5a08f2ce9e1), UINT64_C(0xa33d0997eb853759),
+	UINT64_C(0x1607e05b243462d2), UINT64_C(0x8b5c2900000049c4), UINT64_C(0xad5ebfdc57b5fdb4),
+	UINT64_C(0xdf8ca525c1435fed), UINT64_C(0xf51027bb6e3a987b), UINT64_C(0xa9c1d02011a59323),
+	UINT64_C(0xe1ccaeadf33134bf), UINT64_C(0x922e05763086a6ac), UINT64_C(0xdea2ba0e724813ff),
+	UINT64_C(0x925e320000004a65), UINT64_C(0x638fdd8a4707c4a6), UINT64_C(0xbd85563066d37812),
+	UINT64_C(0x6c1e723367d5c021), UINT64_C(0x8bb89443efbb9edf), UINT64_C(0x3410846bd572497a),
+	UINT64_C(0x2f96766809c252f7), UINT64_C(0xfee3cfdbd9d239f2), UINT64_C(0x9161310000004b08),
+	UINT64_C(0x000bb42137fd9176), UINT64_C(0xac11979efd06286d), UINT64_C(0x09d903e6c79c4b4d),
+	UINT64_C(0xe0be544052e80f4f), UINT64_C(0xbea48b63f63f6036), UINT64_C(0x001b1244bc2e4f06),
+	UINT64_C(0x8f1e02c60511b2ec), UINT64_C(0x88592d0000004bb2), UINT64_C(0x15dc50e9fdb48eee),
+	UINT64_C(0xfc23ced92a67481b), UINT64_C(0xd8c1fb564c331dd3), UINT64_C(0xdf934eadd8c6029e),
+	UINT64_C(0x88abeea8561faecd), UINT64_C(0x3d75f614b1524cbc), UINT64_C(0x4fea05632ba4480d),
+	UINT64_C(0x9465350000004c54), UINT64_C(0x994be58d2f57a7c2), UINT64_C(0xeca575108a95988a),
+	UINT64_C(0x38c1ae2c1d326376), UINT64_C(0x13f52830e3301d25), UINT64_C(0x5c8a745666988158),
+	UINT64_C(0x18cff0f5bbe75cfe), UINT64_C(0xa0a70da608fedaea), UINT64_C(0x9266340000004d01),
+	UINT64_C(0x5953370226bf44b2), UINT64_C(0xc1288941ab67d45d), UINT64_C(0x1587fe94cc4363b6),
+	UINT64_C(0x0b7aa0d00352a81b), UINT64_C(0x01764d0e56f5387b), UINT64_C(0x7f5630e2f3f43d11),
+	UINT64_C(0x3c8688d6c98429d6), UINT64_C(0x7659270000004dae), UINT64_C(0x5ac1efff1e93fd51),
+	UINT64_C(0xdf828d70ffe26335), UINT64_C(0x77840272e12b09dd), UINT64_C(0x7199bc72e83549c2),
+	UINT64_C(0x8f15a17f212d82d0), UINT64_C(0xffffffffffffff00), UINT64_C(0xffffffffffffffff),
+};
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	const uint8_t *output_order = hash_output_order;
+	const uint64_t *g = hash_g;
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+	h[0] = h[0] % 24800;
+	h[1] = h[1] % 24800;
+	h[2] = h[2] % 24800;
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 24800;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return (uint32_t)_getbits(output_order, base_rank, 15);
+}
+
+void
+hash_prefetch(const void * __restrict key, size_t keylen)
+{
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+	h[0] = h[0] % 24800;
+	h[1] = h[1] % 24800;
+	h[2] = h[2] % 24800;
+	__builtin_prefetch(&hash_g[GWORD(h[0])]);
+	__builtin_prefetch(&hash_g[GWORD(h[1])]);
+	__builtin_prefetch(&hash_g[GWORD(h[2])]);
+}
+
+void
+hash_batch(const void * __restrict const *keys, const size_t *keylens,
+	uint32_t *out, size_t n)
+{
+	const uint8_t *output_order = hash_output_order;
+	const uint64_t *g = hash_g;
+	uint16_t hb[8][3];
+	uint32_t vb[8];
+
+	for (size_t s = 0; s < n; s += 8) {
+		const size_t nb = n - s < 8 ? n - s : 8;
+		for (size_t j = 0; j < nb; j++) {
+			const void *key = keys[s + j];
+			const size_t keylen = keylens[s + j];
+			uint16_t h[6];
+
+			mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+			h[0] = h[0] % 24800;
+			h[1] = h[1] % 24800;
+			h[2] = h[2] % 24800;
+			hb[j][0] = h[0];
+			__builtin_prefetch(&g[GWORD(h[0])]);
+			hb[j][1] = h[1];
+			__builtin_prefetch(&g[GWORD(h[1])]);
+			hb[j][2] = h[2];
+			__builtin_prefetch(&g[GWORD(h[2])]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint16_t *h = hb[j];
+			const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+			vb[j] = h[i % 3] % 24800;
+			__builtin_prefetch(&g[(vb[j] >> 5) / 7 * 8]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint32_t vertex = vb[j];
+			uint32_t index, base_rank, idx_v, idx_b;
+			const uint64_t *blk;
+			uint32_t result;
+			index = vertex >> 5;
+			idx_v = index % 7;
+			blk = g + index / 7 * 8;
+			base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+			base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+			idx_b = (vertex & 31) << 1;
+			base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+			    & ((UINT64_C(1) << idx_b) - 1));
+			result = (uint32_t)_getbits(output_order, base_rank, 15);
+			out[s + j] = result;
+		}
+	}
+}
@@ -0,0 +1,4737 @@
+/* generated with rurban/nbperf 08a5797 -b _words */
+/* seed[0]: 294702567, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+
+#ifndef NBPERF_GETBITS
+#define NBPERF_GETBITS
+static inline uint32_t _getbits(const uint8_t *g, uint64_t i, const unsigned bits)
+{
+	uint64_t x;
+	const uint64_t bit = i * bits;
+	memcpy(&x, g + (bit >> 3), sizeof(x));
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	x = __builtin_bswap64(x);
+#endif
+	return (uint32_t)((x >> (bit & 7)) & ((UINT64_C(1) << bits) - 1));
+}
+#endif
+
+static const uint8_t hash_g[46510] = {
+	     0x87, 0x8b, 0xa2, 0xa2, 0xa8, 0xe3, 0x7e, 0x13, 0x52, 0x00,
+	     0x35, 0x0a, 0x28, 0x3a, 0x26, 0xb6, 0x04, 0x00, 0xc0, 0xa5,
+	     0x62, 0xad, 0xf5, 0x4e, 0x40, 0xda, 0xcd, 0x44, 0x00, 0x00,
+	     0x06, 0x88, 0xdb, 0xc9, 0x08, 0xc4, 0xc4, 0x28, 0x96, 0x04,
+	     0x00, 0x48, 0xd4, 0xe8, 0x8c, 0x00, 0x00, 0x0f, 0x5a, 0x30,
+	     0x07, 0x5d, 0x65, 0xc7, 0xba, 0x04, 0x51, 0x21, 0x85, 0x1b,
+	     0x81, 0x91, 0x55, 0x92, 0xa6, 0xcb, 0x96, 0xe4, 0x53, 0xba,
+	     0x44, 0x49, 0xe8, 0x32, 0x47, 0x4f, 0x19, 0x63, 0x89, 0x7c,
+	     0xd3, 0xc5, 0xd6, 0x22, 0x04, 0x00, 0x04, 0x9a, 0xfa, 0x6c,
+	     0x49, 0x41, 0x68, 0x0a, 0x00, 0x40, 0x3a, 0x67, 0x43, 0x9c,
+	     0x7a, 0xd5, 0x54, 0xde, 0x01, 0x00, 0x00, 0x1e, 0x09, 0x00,
+	     0x40, 0xe5, 0x65, 0x11, 0x7a, 0x35, 0xda, 0xbf, 0x00, 0x00,
+	     0x00, 0x00, 0xce, 0x1b, 0x00, 0x40, 0x4b, 0xe1, 0xdc, 0x08,
+	     0xe1, 0x80, 0x91, 0x5a, 0x6f, 0x00, 0x80, 0xdc, 0xa3, 0xc2,
+	     0xa9, 0xb2, 0x06, 0x9c, 0xf0, 0x34, 0xcd, 0xf5, 0x5c, 0x69,
+	     0x12, 0x33, 0x54, 0x60, 0x44, 0x41, 0xbc, 0x79, 0x39, 0xa9,
+	     0x5b, 0xfd, 0xe8, 0x1c, 0x32, 0x72, 0x26, 0x56, 0x05, 0x00,
+	     0x00, 0x00, 0x70, 0x04, 0x01, 0x00, 0xcc, 0xc2, 0xd6, 0x8e,
+	     0x3f, 0x0e, 0x00, 0x80, 0xc4, 0x6c, 0x82, 0x78, 0xec, 0xab,
+	     0x20, 0xc5, 0x4b, 0xfc, 0x11, 0x4a, 0xa7, 0x4a, 0x59, 0xdd,
+	     0x04, 0x00, 0xc0, 0xf5, 0x5b, 0x4b, 0x0c, 0x2a, 0xc9, 0x84,
+	     0x52, 0x07, 0x00, 0x00, 0x00, 0x00, 0x45, 0x85, 0x4c, 0x73,
+	     0x11, 0x02, 0x00, 0x60, 0x43, 0xd1, 0xad, 0xea, 0x85, 0xa5,
+	     0x66, 0x3b, 0xa1, 0x65, 0xe4, 0x62, 0x5a, 0xb9, 0x44, 0x27,
+	     0x35, 0x8d, 0xfc, 0x13, 0xf9, 0xd2, 0x47, 0xc5, 0x30, 0x41,
+	     0x6c, 0x72, 0x8d, 0x00, 0x00, 0x39, 0x07, 0x77, 0x08, 0x05,
+	     0x4b, 0x2c, 0x96, 0xa9, 0x01, 0x00, 0x14, 0x17, 0xa0, 0x2c,
+	     0x4c, 0xa2, 0x44, 0x46, 0xd4, 0x0f, 0x0c, 0xb8, 0x62, 0x04,
+	     0x00, 0x0c, 0x8f, 0xf2, 0x0b, 0x2a, 0x2c, 0x13, 0x0e, 0x08,
+	     0xe7, 0x91, 0xe7, 0x31, 0xac, 0xaf, 0x6d, 0xde, 0x04, 0x19,
+	     0x00, 0x00, 0x50, 0x83, 0x7d, 0x2d, 0x5c, 0xf4, 0x88, 0xe0,
+	     0xb6, 0x00, 0x00, 0x7e, 0x26, 0x84, 0x9b, 0x76, 0xcd, 0xc4,
+	     0xd2, 0x2c, 0x43, 0x20, 0x94, 0x6a, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x80, 0x4d, 0x2b, 0x83, 0x67, 0xb9, 0x8a,
+	     0x4d, 0x00, 0x00, 0x1a, 0x77, 0xa3, 0xa0, 0xcd, 0xdf, 0x00,
+	     0xe4, 0x40, 0x17, 0x84, 0x11, 0x0b, 0xd4, 0x78, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x80, 0xde, 0x0d, 0x00, 0x70, 0xc2, 0x7a,
+	     0x4a, 0x84, 0x48, 0x38, 0x5d, 0x0a, 0xcc, 0xf6, 0x42, 0x13,
+	     0x29, 0x9f, 0xb9, 0x06, 0x18, 0x9d, 0x58, 0xb9, 0x58, 0x39,
+	     0x73, 0x0d, 0x00, 0x40, 0xf3, 0xcc, 0x37, 0x06, 0xbc, 0x84,
+	     0x22, 0xd4, 0x4a, 0xae, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xc0,
+	     0x63, 0x06, 0x00, 0x00, 0x70, 0x59, 0xb6, 0x7f, 0x64, 0x8c,
+	     0x11, 0xbe, 0x13, 0x86, 0xe7, 0x4e, 0x42, 0x05, 0x00, 0xb0,
+	     0x35, 0xe1, 0x5f, 0x90, 0x8f, 0x0c, 0x4e, 0xca, 0x02, 0x00,
+	     0x60, 0xe4, 0x61, 0x3a, 0xa4, 0x26, 0x02, 0x00, 0xa8, 0x2b,
+	     0x98, 0x2f, 0xb4, 0x58, 0x2a, 0x31, 0x46, 0x53, 0x19, 0x82,
+	     0x34, 0x29, 0x48, 0x3a, 0x13, 0x97, 0x12, 0x00, 0x40, 0x62,
+	     0x07, 0x00, 0x90, 0x68, 0x0b, 0x14, 0x72, 0x0c, 0x31, 0x4b,
+	     0x2e, 0x22, 0x76, 0x01, 0x0c, 0x64, 0x3e, 0x07, 0x33, 0x03,
+	     0x00, 0x94, 0x23, 0x91, 0x95, 0xac, 0x10, 0x08, 0x8a, 0xfc,
+	     0x65, 0x20, 0x58, 0xc4, 0x01, 0x00, 0x20, 0xb0, 0x18, 0x78,
+	     0xf2, 0xcd, 0x01, 0x8d, 0xac, 0xb1, 0x52, 0xd2, 0x2a, 0x8a,
+	     0xdb, 0x01, 0x00, 0x3e, 0x96, 0xaa, 0xbf, 0xe0, 0x03, 0x00,
+	     0x00, 0x00, 0xe0, 0xdd, 0xa4, 0x9d, 0x40, 0x50, 0x00, 0x00,
+	     0xc7, 0x00, 0x00, 0xc0, 0x6a, 0x00, 0x06, 0x47, 0xb7, 0xcb,
+	     0x78, 0x89, 0x20, 0xef, 0x70, 0x85, 0xa9, 0x86, 0x8f, 0x8d,
+	     0xa5, 0x6a, 0x14, 0xc1, 0xf2, 0x1c, 0x45, 0x09, 0x0d, 0x7c,
+	     0x43, 0x4c, 0xd1, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x3f, 0xb8,
+	     0x31, 0x1e, 0x09, 0x00, 0x00, 0xd8, 0x2b, 0xe4, 0x98, 0xd2,
+	     0xe3, 0xf9, 0xd0, 0x2a, 0xe8, 0xb2, 0xcd, 0x56, 0x60, 0x4b,
+	     0x4b, 0x93, 0xfb, 0x0e, 0x00, 0x20, 0x93, 0x52, 0xb9, 0x3c,
+	     0x3f, 0x01, 0x07, 0x06, 0x0b, 0xfe, 0x35, 0x77, 0x1b, 0x9c,
+	     0x0c, 0xdb, 0x87, 0x91, 0x21, 0x28, 0x75, 0x88, 0x9c, 0x06,
+	     0x1c, 0x27, 0xf5, 0x58, 0x61, 0x30, 0xb8, 0x02, 0x00, 0xa0,
+	     0x20, 0x06, 0xf1, 0x04, 0x88, 0xd6, 0xa5, 0x77, 0x5e, 0x54,
+	     0x00, 0x00, 0x40, 0x87, 0xb3, 0xe6, 0x64, 0xf9, 0x00, 0x00,
+	     0x14, 0x21, 0x52, 0x44, 0xa6, 0x86, 0x16, 0x98, 0xa2, 0x79,
+	     0xce, 0xa8, 0xa6, 0x14, 0x7b, 0x88, 0x13, 0x00, 0x40, 0x40,
+	     0x0e, 0x00, 0xe0, 0xec, 0x62, 0x4c, 0x02, 0x00, 0x5a, 0x68,
+	     0x16, 0x02, 0x9c, 0xdc, 0xfd, 0xae, 0x80, 0x09, 0x00, 0x30,
+	     0x63, 0x10, 0x03, 0x4d, 0x01, 0x35, 0x46, 0x25, 0xcf, 0x44,
+	     0x4b, 0x34, 0x04, 0x00, 0x80, 0x8b, 0x01, 0x00, 0x24, 0x16,
+	     0x0a, 0x45, 0x14, 0x0f, 0x06, 0x27, 0x17, 0x12, 0xba, 0x11,
+	     0x1b, 0x11, 0x76, 0xc0, 0x0a, 0x00, 0x80, 0x71, 0x09, 0x82,
+	     0xe7, 0x17, 0x09, 0x94, 0xc1, 0x47, 0x20, 0x90, 0x62, 0x64,
+	     0x71, 0xa9, 0xbc, 0x54, 0xb1, 0x08, 0x00, 0xd0, 0x8d, 0xe0,
+	     0x84, 0x9d, 0x1b, 0x56, 0x59, 0x5d, 0x1a, 0x18, 0x19, 0x00,
+	     0xe0, 0x72, 0x98, 0xde, 0xa8, 0xa0, 0x79, 0x5b, 0xb0, 0x35,
+	     0x9c, 0xcb, 0x14, 0x0c, 0x00, 0x20, 0xaf, 0x06, 0xc1, 0x04,
+	     0x00, 0x3c, 0x5e, 0x82, 0x69, 0xbf, 0x3f, 0x73, 0x80, 0x7d,
+	     0x0e, 0x1a, 0x35, 0x71, 0x10, 0x55, 0x99, 0x4a, 0xf8, 0x05,
+	     0x81, 0x43, 0x4c, 0x23, 0x00, 0x00, 0x56, 0x55, 0x00, 0x02,
+	     0x00, 0x00, 0x36, 0xf3, 0x87, 0xb0, 0x22, 0xd1, 0x03, 0x00,
+	     0x00, 0x09, 0xe5, 0x16, 0x02, 0x00, 0x88, 0x8b, 0x82, 0x59,
+	     0x00, 0x00, 0xc2, 0xd8, 0x5f, 0x41, 0x02, 0x45, 0xe3, 0x9b,
+	     0x22, 0x10, 0x73, 0x54, 0x3e, 0x0a, 0x2a, 0xcc, 0xca, 0x98,
+	     0xd0, 0x7a, 0xe6, 0xcc, 0x1c, 0x19, 0x9d, 0xb1, 0x00, 0x00,
+	     0x8c, 0x3e, 0x5c, 0x57, 0xa5, 0x51, 0xbd, 0xd2, 0x6a, 0x39,
+	     0x6d, 0xde, 0x0b, 0xd0, 0x99, 0xc0, 0xc8, 0x78, 0xda, 0xbe,
+	     0xcf, 0xa9, 0xd5, 0x30, 0x01, 0x00, 0xac, 0x98, 0x60, 0x6a,
+	     0x09, 0x96, 0xb4, 0x1f, 0x00, 0x00, 0x00, 0xe0, 0x2e, 0x72,
+	     0x3f, 0x90, 0xbd, 0x28, 0x64, 0x9c, 0x96, 0xf1, 0x8d, 0x60,
+	     0x43, 0x10, 0xf4, 0x6d, 0x8c, 0xcd, 0x4c, 0x0b, 0x0c, 0x2c,
+	     0xcb, 0x32, 0x2d, 0x97, 0x9b, 0x00, 0x6a, 0xa8, 0xd5, 0x70,
+	     0xa4, 0x21, 0x65, 0x72, 0x87, 0x03, 0xba, 0x91, 0x01, 0x00,
+	     0x00, 0x00, 0xd0, 0xfe, 0xca, 0x1a, 0x56, 0x21, 0xcd, 0x5d,
+	     0x07, 0x49, 0x00, 0x40, 0x88, 0x40, 0x4b, 0xf3, 0xef, 0x1a,
+	     0x06, 0xd9, 0xa3, 0x08, 0x22, 0xb3, 0xcd, 0x5f, 0xa3, 0x88,
+	     0x6c, 0x30, 0x00, 0x00, 0xf0, 0x89, 0x48, 0x7d, 0x00, 0x00,
+	     0x24, 0x15, 0x92, 0x1b, 0x00, 0x00, 0x73, 0x35, 0x74, 0xb4,
+	     0xed, 0x45, 0x4c, 0xec, 0x31, 0x4a, 0x17, 0xa0, 0x1c, 0xdc,
+	     0x06, 0x0b, 0x96, 0x47, 0x5c, 0x48, 0x01, 0x00, 0x38, 0x66,
+	     0xa9, 0x2e, 0x65, 0x4f, 0x36, 0xc6, 0x07, 0x42, 0x6a, 0x09,
+	     0xbd, 0x00, 0x00, 0x4e, 0x0a, 0x00, 0x00, 0x9e, 0x49, 0xe7,
+	     0x4a, 0x42, 0x84, 0xab, 0xc8, 0x23, 0x50, 0x1d, 0xf4, 0x4c,
+	     0x26, 0x98, 0x35, 0x20, 0xe0, 0x0d, 0x00, 0xd0, 0x47, 0x79,
+	     0xe7, 0x54, 0xe9, 0x00, 0x00, 0x79, 0x83, 0xd9, 0x18, 0xa1,
+	     0x8e, 0xa7, 0x08, 0x00, 0x78, 0x81, 0xf8, 0x1e, 0xe5, 0x72,
+	     0x00, 0x80, 0x46, 0x13, 0x00, 0x00, 0x2d, 0x39, 0xbc, 0x00,
+	     0x00, 0xc0, 0xa3, 0x70, 0x99, 0x42, 0x4c, 0x8b, 0x21, 0x3b,
+	     0xce, 0x3b, 0x03, 0x00, 0x88, 0x97, 0x21, 0x31, 0x23, 0x5d,
+	     0xc1, 0x00, 0xaf, 0x10, 0x8c, 0x0b, 0x00, 0x10, 0x9e, 0xf4,
+	     0x3f, 0xd1, 0x82, 0x18, 0x5a, 0xee, 0x42, 0x18, 0x07, 0x3c,
+	     0xe9, 0x01, 0xb4, 0x15, 0x22, 0x98, 0x18, 0x0d, 0x3b, 0x0f,
+	     0x00, 0x00, 0x66, 0x18, 0x9a, 0x31, 0xd3, 0x53, 0x5e, 0x4c,
+	     0x25, 0xed, 0x06, 0xfa, 0x97, 0x38, 0x80, 0xc2, 0x55, 0x2d,
+	     0xa5, 0xc7, 0x14, 0x65, 0xa4, 0x8c, 0xd5, 0x7b, 0x74, 0x01,
+	     0x67, 0xc2, 0x26, 0x4a, 0x0e, 0x4d, 0xff, 0x07, 0x00, 0x30,
+	     0xdd, 0xb8, 0xcb, 0x26, 0x22, 0x2e, 0x20, 0xec, 0xe4, 0xe9,
+	     0xc7, 0x9c, 0xf2, 0xd9, 0x30, 0x15, 0x65, 0x67, 0x30, 0x96,
+	     0xc0, 0xa8, 0xc7, 0x08, 0x00, 0x60, 0x8f, 0x35, 0xde, 0x50,
+	     0x62, 0x01, 0x00, 0x74, 0x3b, 0x63, 0x22, 0xcc, 0x8d, 0x90,
+	     0xec, 0x31, 0x08, 0x00, 0x68, 0x43, 0x11, 0x0b, 0xdb, 0x94,
+	     0x3b, 0x14, 0xce, 0x05, 0xda, 0x2d, 0xc9, 0x03, 0xc3, 0x4b,
+	     0x30, 0x7a, 0x88, 0xae, 0x97, 0xa4, 0x1f, 0xe5, 0xa4, 0x42,
+	     0x6c, 0x87, 0x91, 0xbc, 0x9a, 0x25, 0x3e, 0x48, 0x00, 0x00,
+	     0x8a, 0x03, 0x59, 0x1c, 0xa5, 0xcf, 0x66, 0x35, 0x3f, 0xb8,
+	     0xf1, 0x34, 0xe2, 0xc6, 0x7b, 0x0a, 0x9e, 0x9e, 0x12, 0x83,
+	     0x22, 0x62, 0xc6, 0x69, 0xb2, 0x6f, 0xcd, 0x8e, 0x2a, 0x48,
+	     0x29, 0x26, 0x64, 0x17, 0xce, 0x6b, 0x1f, 0x13, 0xba, 0x1b,
+	     0x31, 0x1d, 0x15, 0x01, 0x00, 0xa7, 0x11, 0x73, 0x84, 0x42,
+	     0xce, 0x5a, 0xe5, 0x05, 0x70, 0xd5, 0xed, 0x96, 0x00, 0x00,
+	     0x20, 0xc7, 0xdc, 0x16, 0x00, 0xa0, 0x45, 0x58, 0x2c, 0xb3,
+	     0xed, 0x88, 0x17, 0x52, 0x89, 0xd8, 0xa0, 0x82, 0x23, 0x00,
+	     0x20, 0x3b, 0x80, 0xbf, 0x3c, 0x1e, 0x26, 0xbb, 0x00, 0x00,
+	     0x00, 0x80, 0x78, 0x61, 0x00, 0xad, 0x24, 0xe0, 0x3e, 0xe9,
+	     0xe3, 0x00, 0x00, 0x58, 0x0a, 0x44, 0x03, 0xdd, 0x91, 0xf5,
+	     0x00, 0x21, 0x15, 0xbc, 0x78, 0x48, 0x01, 0x00, 0x00, 0x00,
+	     0x2a, 0x1a, 0x08, 0x83, 0x36, 0xa8, 0xfe, 0x12, 0x49, 0x28,
+	     0xc9, 0xcd, 0x91, 0x0e, 0x53, 0x75, 0x44, 0x00, 0xc0, 0x14,
+	     0xa9, 0xfa, 0x95, 0x36, 0x40, 0xdc, 0x6d, 0x10, 0xd1, 0x69,
+	     0xdb, 0xb1, 0x12, 0x10, 0x2e, 0x04, 0x00, 0xe0, 0x9e, 0x24,
+	     0xa2, 0x78, 0xad, 0x00, 0x00, 0x02, 0x80, 0xa2, 0xdd, 0x0d,
+	     0x01, 0xa7, 0x08, 0x00, 0x68, 0xd7, 0x00, 0x00, 0xf6, 0x89,
+	     0x00, 0x80, 0xc9, 0x0f, 0x00, 0x00, 0x2e, 0x21, 0xb6, 0x7c,
+	     0x71, 0x69, 0x23, 0xf0, 0x80, 0x13, 0xb1, 0x5a, 0x06, 0xb0,
+	     0x4d, 0x27, 0x88, 0xa4, 0x14, 0xe6, 0x01, 0x00, 0x82, 0x07,
+	     0x69, 0x2d, 0x00, 0x00, 0x0a, 0xed, 0x05, 0x07, 0xe8, 0x1a,
+	     0x20, 0xb1, 0x2c, 0x00, 0x00, 0x7a, 0x19, 0xa7, 0x13, 0x4a,
+	     0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x1e, 0x08, 0x6c,
+	     0x18, 0xc4, 0xd4, 0x0a, 0xce, 0x02, 0x00, 0xf0, 0xb5, 0xea,
+	     0x5d, 0x94, 0x36, 0xe9, 0x61, 0xcd, 0x0a, 0xd7, 0x26, 0x6f,
+	     0xa7, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x14,
+	     0x3f, 0x8c, 0xad, 0x06, 0xb2, 0xa4, 0x15, 0x10, 0x01, 0x44,
+	     0x39, 0x28, 0x49, 0xf6, 0x42, 0x23, 0xa6, 0x79, 0x22, 0x30,
+	     0x61, 0xc5, 0xd7, 0xdc, 0x02, 0x00, 0x28, 0x48, 0xa4, 0x50,
+	     0x70, 0x06, 0x00, 0x80, 0xd9, 0x11, 0x00, 0x90, 0x2b, 0xe1,
+	     0x38, 0x20, 0x2a, 0x01, 0x00, 0x69, 0x3f, 0xbc, 0xd9, 0x9c,
+	     0x09, 0xe9, 0x96, 0x80, 0x84, 0x8d, 0x28, 0x1b, 0x43, 0x97,
+	     0x00, 0x00, 0xb6, 0xe4, 0xed, 0x20, 0x33, 0x95, 0xa4, 0x42,
+	     0x29, 0x55, 0xd7, 0x12, 0x4f, 0x00, 0x00, 0x47, 0x4f, 0xb0,
+	     0x62, 0x1c, 0x89, 0x35, 0xd3, 0x72, 0x04, 0x5c, 0xce, 0x5b,
+	     0xca, 0x14, 0x78, 0x22, 0x8c, 0x91, 0xfc, 0x00, 0x00, 0x38,
+	     0x40, 0x0c, 0x3f, 0x7a, 0x61, 0x01, 0x17, 0x00, 0x00, 0xfe,
+	     0x0a, 0x00, 0x40, 0x46, 0x38, 0x75, 0x01, 0x00, 0xe4, 0x1f,
+	     0xc3, 0x26, 0x91, 0x1c, 0x00, 0x20, 0x37, 0xb6, 0x85, 0x3c,
+	     0x17, 0x41, 0x06, 0x01, 0x00, 0x12, 0x02, 0x9c, 0xa4, 0x3e,
+	     0xc5, 0xb3, 0xc7, 0x3e, 0xfb, 0x70, 0x0c, 0x20, 0xdf, 0x6b,
+	     0x71, 0xcc, 0xeb, 0x4d, 0x7a, 0x92, 0x0e, 0x08, 0x00, 0xb0,
+	     0x5c, 0xae, 0xb0, 0x8e, 0x46, 0xbf, 0x18, 0x00, 0x40, 0x66,
+	     0x4d, 0x73, 0xe8, 0xdc, 0x00, 0x00, 0x14, 0x34, 0xec, 0x56,
+	     0xab, 0x30, 0x00, 0xc0, 0x39, 0x24, 0x46, 0xc8, 0x94, 0x3a,
+	     0x08, 0x59, 0xfe, 0xde, 0x6c, 0x8b, 0xaf, 0x94, 0x03, 0x0f,
+	     0x46, 0xde, 0xe3, 0x92, 0x11, 0xd5, 0x8d, 0xdc, 0x6c, 0x2b,
+	     0x07, 0x46, 0x04, 0x15, 0x2b, 0xed, 0x5f, 0xe9, 0x85, 0xa3,
+	     0x2e, 0x1d, 0xf4, 0x06, 0x24, 0x48, 0x28, 0x1b, 0x82, 0xae,
+	     0x2b, 0x4a, 0x34, 0xb4, 0xcb, 0x1b, 0x54, 0x0e, 0x18, 0x50,
+	     0x50, 0xa3, 0xcd, 0x60, 0xde, 0x6c, 0x4b, 0x00, 0x00, 0x70,
+	     0xa4, 0x58, 0x3b, 0x40, 0x74, 0x92, 0xbc, 0xf6, 0xc6, 0xe9,
+	     0x0f, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x00, 0x96, 0x5a,
+	     0x44, 0x27, 0x4b, 0xe4, 0xb2, 0x0c, 0x56, 0xb0, 0xc8, 0x23,
+	     0x1f, 0xea, 0x2d, 0xf1, 0x32, 0x00, 0x00, 0x88, 0x0c, 0x3a,
+	     0x8e, 0xea, 0x08, 0x00, 0x08, 0xb6, 0x68, 0x0e, 0x33, 0x21,
+	     0x00, 0x00, 0x00, 0x80, 0xd1, 0xea, 0xbe, 0x49, 0x9f, 0xd2,
+	     0xa4, 0x01, 0x00, 0x2e, 0x6e, 0x00, 0x80, 0xe3, 0x16, 0x56,
+	     0xac, 0x4e, 0xd2, 0x80, 0x94, 0x83, 0x04, 0x4c, 0x00, 0x00,
+	     0xd3, 0xb5, 0x83, 0x23, 0x34, 0x65, 0xd2, 0x84, 0x7f, 0xc2,
+	     0x24, 0x0d, 0xb6, 0xc6, 0x72, 0x40, 0xb4, 0x45, 0xd3, 0x3d,
+	     0x81, 0x95, 0x15, 0x9c, 0x51, 0x55, 0x15, 0x96, 0x30, 0x53,
+	     0x3e, 0x0f, 0x00, 0x80, 0x94, 0xed, 0x6a, 0xd6, 0x2e, 0x7c,
+	     0xb9, 0x8c, 0x5a, 0xac, 0x2d, 0x00, 0x80, 0x9c, 0x81, 0x68,
+	     0x88, 0xe0, 0x86, 0x8c, 0xb3, 0x76, 0xc5, 0xa4, 0x00, 0x00,
+	     0x00, 0x00, 0xe4, 0xcb, 0xa0, 0x28, 0x66, 0xa6, 0x24, 0x14,
+	     0x5f, 0xfc, 0x66, 0xea, 0x7b, 0xdd, 0x4b, 0x60, 0x1d, 0x00,
+	     0xe0, 0x5e, 0x54, 0xc2, 0x8a, 0x90, 0x59, 0xa7, 0x12, 0x09,
+	     0xed, 0x12, 0x2e, 0x82, 0xab, 0xe5, 0x12, 0x73, 0xcf, 0x12,
+	     0x6f, 0x84, 0xc5, 0x0e, 0x82, 0x41, 0x1a, 0x6e, 0x1d, 0xa6,
+	     0x00, 0x00, 0x00, 0x00, 0x18, 0x0d, 0x00, 0x00, 0xe0, 0x54,
+	     0x62, 0x3c, 0xa5, 0x17, 0x00, 0x00, 0xe6, 0xe4, 0x41, 0x7b,
+	     0xb8, 0xe9, 0xba, 0x54, 0x88, 0x02, 0x47, 0x83, 0x95, 0x06,
+	     0x23, 0x11, 0x08, 0xb7, 0x81, 0x81, 0x01, 0x00, 0x9c, 0x05,
+	     0x00, 0x00, 0x00, 0x80, 0x30, 0x89, 0xd6, 0x20, 0x9f, 0xe4,
+	     0x53, 0x01, 0x00, 0x6c, 0x91, 0xe8, 0x01, 0x00, 0x00, 0x45,
+	     0xe0, 0xc4, 0x77, 0x1a, 0xca, 0x8f, 0x7d, 0x37, 0x00, 0x00,
+	     0x4a, 0x05, 0x00, 0xc0, 0x20, 0xc7, 0x46, 0x98, 0xf4, 0x02,
+	     0x00, 0x00, 0x00, 0xfa, 0x42, 0x62, 0x26, 0x00, 0xc0, 0x15,
+	     0xca, 0x66, 0x69, 0x74, 0x72, 0xea, 0x18, 0x2c, 0xd2, 0x48,
+	     0xab, 0xcc, 0xff, 0x91, 0xf4, 0x2d, 0xe7, 0x05, 0xf0, 0x73,
+	     0xe1, 0x20, 0x28, 0x6e, 0x50, 0x5a, 0x16, 0xe8, 0x1f, 0x00,
+	     0x20, 0x1f, 0x23, 0x63, 0x09, 0x20, 0x8a, 0xed, 0x0e, 0x35,
+	     0x5a, 0x22, 0xfb, 0x57, 0x6f, 0x04, 0x11, 0x36, 0x1d, 0x24,
+	     0x77, 0xfd, 0xd0, 0xb8, 0x07, 0x99, 0x02, 0x00, 0x00, 0x00,
+	     0x20, 0x5a, 0x09, 0x00, 0xb8, 0x2c, 0x30, 0xa5, 0x18, 0x8f,
+	     0x1a, 0xc4, 0x2e, 0x02, 0x00, 0x00, 0x00, 0x10, 0xb2, 0xb1,
+	     0x7e, 0xbd, 0xf4, 0x02, 0x0a, 0x2d, 0x02, 0x50, 0x09, 0x9b,
+	     0x4c, 0x06, 0xa8, 0x14, 0x83, 0x55, 0xa9, 0xb2, 0x4a, 0x6c,
+	     0x05, 0xa2, 0x82, 0x23, 0xb1, 0xf1, 0x61, 0x07, 0xd0, 0x01,
+	     0x03, 0x45, 0x53, 0xd4, 0x20, 0x8a, 0x3e, 0x26, 0xd6, 0x2d,
+	     0x70, 0xbf, 0x41, 0xb9, 0x00, 0x00, 0xfc, 0x51, 0x00, 0x00,
+	     0x84, 0x1f, 0x78, 0x0d, 0x00, 0x40, 0x1a, 0x84, 0x12, 0x09,
+	     0x14, 0xe9, 0xd7, 0x00, 0x00, 0xb9, 0x01, 0xbc, 0x18, 0x00,
+	     0x00, 0x00, 0xf0, 0x47, 0x59, 0x26, 0x66, 0x1d, 0x0a, 0x86,
+	     0xd2, 0x49, 0x00, 0xc0, 0x5f, 0xd2, 0xbb, 0x02, 0xa7, 0x49,
+	     0x2e, 0x6a, 0xb4, 0x28, 0x9b, 0x00, 0x80, 0x98, 0x4d, 0x95,
+	     0xa2, 0x47, 0x80, 0x5d, 0x03, 0x00, 0xf4, 0x1a, 0x6c, 0x34,
+	     0xc1, 0xa4, 0xf3, 0x13, 0x00, 0xa0, 0xd3, 0x02, 0x00, 0x00,
+	     0x4e, 0x3e, 0x62, 0x68, 0x4f, 0xb3, 0xad, 0x8c, 0x41, 0x95,
+	     0xed, 0x83, 0x01, 0x00, 0x00, 0x00, 0x80, 0x2d, 0x01, 0x00,
+	     0x9a, 0xb0, 0xd3, 0x5f, 0xa9, 0xeb, 0x9f, 0xc8, 0x66, 0xa4,
+	     0x5c, 0xf5, 0xad, 0xa2, 0x2b, 0x25, 0x1f, 0x8d, 0x16, 0x87,
+	     0x62, 0x48, 0x00, 0x7d, 0x68, 0x50, 0x9d, 0x01, 0x39, 0x1b,
+	     0x66, 0x28, 0x00, 0x80, 0x04, 0x52, 0x8e, 0xd5, 0x41, 0xe1,
+	     0x3f, 0x5a, 0x9a, 0x2a, 0x12, 0x2c, 0xca, 0xce, 0xc7, 0xaf,
+	     0xc9, 0x67, 0xc3, 0xa8, 0x01, 0x00, 0x68, 0x15, 0xe3, 0x73,
+	     0x8c, 0x40, 0x00, 0x80, 0x8d, 0x88, 0x6e, 0x26, 0x74, 0x24,
+	     0x36, 0x68, 0x7b, 0xf4, 0x34, 0xef, 0x4d, 0x00, 0x00, 0x00,
+	     0x40, 0xc4, 0xb8, 0x82, 0x54, 0xa7, 0xa4, 0x87, 0x78, 0x6f,
+	     0x00, 0x80, 0xf8, 0x12, 0x00, 0xc0, 0xfb, 0xd8, 0x0e, 0xec,
+	     0xdc, 0x00, 0x00, 0x88, 0x57, 0x00, 0x80, 0xbd, 0xd5, 0xa9,
+	     0x47, 0x79, 0x03, 0x00, 0x20, 0xac, 0x01, 0x00, 0xa8, 0x6c,
+	     0x00, 0x00, 0x00, 0xc0, 0xa1, 0xcb, 0x78, 0xe2, 0x92, 0xdb,
+	     0x39, 0x6d, 0x24, 0x78, 0x8d, 0x0a, 0x0c, 0x00, 0x00, 0x8c,
+	     0x8a, 0x50, 0x73, 0xaa, 0x53, 0x12, 0x8e, 0x00, 0xdb, 0x75,
+	     0x52, 0x11, 0xb7, 0x96, 0xea, 0x6f, 0x43, 0x53, 0x97, 0x03,
+	     0xc3, 0x8d, 0x7d, 0x64, 0x0c, 0x00, 0x80, 0x81, 0x45, 0x46,
+	     0x6c, 0xa9, 0xf1, 0x98, 0x2b, 0x99, 0xe4, 0xcc, 0x00, 0x00,
+	     0x5d, 0x1c, 0x00, 0xc0, 0xdd, 0xe8, 0xed, 0xb4, 0xfe, 0xe0,
+	     0x3f, 0x01, 0x76, 0xba, 0x67, 0x00, 0x80, 0x38, 0x07, 0x00,
+	     0x40, 0x1b, 0x96, 0xbd, 0x42, 0x29, 0x64, 0xc0, 0x16, 0x16,
+	     0x1b, 0xcc, 0x1b, 0x66, 0xe2, 0xd2, 0xc6, 0x48, 0x3c, 0x18,
+	     0x18, 0x01, 0x00, 0xb4, 0x35, 0x00, 0x00, 0x9f, 0x44, 0x82,
+	     0xc6, 0x4e, 0x46, 0xc2, 0x6b, 0x2d, 0xfa, 0x7c, 0x76, 0x03,
+	     0x00, 0x80, 0x90, 0x12, 0x64, 0x92, 0x76, 0x81, 0xd6, 0xa0,
+	     0x0f, 0x0d, 0xa6, 0x00, 0x00, 0xc3, 0xb8, 0x7f, 0x06, 0x00,
+	     0x00, 0xad, 0x31, 0xec, 0x02, 0x00, 0xc0, 0xdd, 0x48, 0x10,
+	     0xb3, 0x2e, 0x00, 0x00, 0x41, 0x13, 0x00, 0xd0, 0x04, 0x71,
+	     0x9d, 0x50, 0xb1, 0x4c, 0x86, 0xe9, 0x45, 0x34, 0x96, 0x05,
+	     0x06, 0x00, 0x70, 0x00, 0xb4, 0xe7, 0xe4, 0x21, 0xc6, 0x01,
+	     0xe6, 0x22, 0x17, 0x05, 0x47, 0xd3, 0x55, 0xb0, 0x16, 0x8a,
+	     0x65, 0x1c, 0x28, 0x5e, 0x98, 0x27, 0x88, 0x4e, 0xa4, 0x09,
+	     0x84, 0x23, 0x17, 0x35, 0x01, 0x00, 0x9c, 0x55, 0x98, 0x3b,
+	     0x13, 0x91, 0x62, 0x11, 0x34, 0x03, 0x96, 0xe6, 0x42, 0x4a,
+	     0x1e, 0x85, 0xba, 0x50, 0x55, 0xc4, 0xcc, 0x8c, 0xd9, 0x10,
+	     0x04, 0x00, 0xc0, 0xeb, 0x01, 0x00, 0x30, 0xa5, 0x00, 0x00,
+	     0xbc, 0xb8, 0x24, 0x87, 0xe1, 0x8f, 0x2d, 0x10, 0x40, 0x00,
+	     0x00, 0xac, 0x78, 0xfe, 0x5f, 0xb9, 0xc2, 0x93, 0xa1, 0x45,
+	     0xc9, 0x3a, 0x66, 0x31, 0x43, 0x04, 0xb5, 0x17, 0x98, 0x2b,
+	     0xb5, 0x0b, 0xf0, 0x44, 0xd0, 0xc7, 0xf0, 0x01, 0xd0, 0x6b,
+	     0xf2, 0xe4, 0x10, 0x64, 0x2e, 0x00, 0x00, 0xd6, 0x25, 0xa2,
+	     0x0a, 0x00, 0x10, 0x36, 0x04, 0x00, 0x34, 0xe4, 0xea, 0x7f,
+	     0xa3, 0x8b, 0xd5, 0x42, 0x74, 0xe8, 0xd5, 0x08, 0x00, 0xa0,
+	     0x24, 0x70, 0xfd, 0x6a, 0x27, 0x6b, 0xa5, 0x42, 0x00, 0x00,
+	     0x60, 0x92, 0xd2, 0x5c, 0x80, 0x75, 0x01, 0x00, 0xf0, 0x03,
+	     0x6a, 0xc3, 0x0f, 0xcc, 0xcd, 0xad, 0x21, 0x97, 0xe8, 0x32,
+	     0x80, 0x8d, 0xbe, 0xda, 0x51, 0xa4, 0x0f, 0x00, 0x40, 0x4e,
+	     0x64, 0xed, 0x14, 0x24, 0xf3, 0x12, 0x01, 0x00, 0x00, 0x00,
+	     0xc4, 0xc2, 0xae, 0x40, 0x6b, 0x26, 0xf7, 0x03, 0xee, 0x60,
+	     0x5c, 0x7e, 0xa1, 0x00, 0x00, 0xf1, 0x02, 0x00, 0xc0, 0x3c,
+	     0xa6, 0xe6, 0x91, 0x1a, 0x3c, 0x8b, 0x85, 0xaa, 0x00, 0x00,
+	     0x95, 0xc2, 0x5e, 0x51, 0x4b, 0x84, 0xf3, 0x02, 0xaa, 0x03,
+	     0x00, 0x00, 0x00, 0xb8, 0x0b, 0x25, 0x2c, 0xde, 0x9f, 0xc7,
+	     0xf2, 0x52, 0x24, 0xda, 0xb4, 0xad, 0xbc, 0x1b, 0xa5, 0x08,
+	     0x1c, 0x0d, 0xd3, 0x0a, 0xdd, 0x87, 0x50, 0xf7, 0x2b, 0x28,
+	     0x30, 0xce, 0xe9, 0x98, 0x1b, 0xd2, 0x9c, 0xab, 0xc1, 0x91,
+	     0x90, 0x23, 0x75, 0x63, 0xc8, 0x37, 0x26, 0xe4, 0x52, 0x85,
+	     0xd2, 0x26, 0x31, 0x9c, 0x6d, 0xee, 0xba, 0x26, 0x3b, 0x4a,
+	     0x37, 0x3e, 0x44, 0x3c, 0x0a, 0xc2, 0x20, 0xd3, 0x62, 0x61,
+	     0x08, 0x00, 0xf0, 0xf2, 0xb3, 0x2a, 0xdc, 0xee, 0xf0, 0x0a,
+	     0x01, 0xb9, 0x56, 0x49, 0x2c, 0x65, 0xeb, 0x31, 0xb2, 0x5b,
+	     0xae, 0xd5, 0x9c, 0x82, 0x70, 0x68, 0x1c, 0x1e, 0x43, 0x6a,
+	     0x4a, 0xf9, 0x86, 0x8d, 0x8c, 0xf7, 0x99, 0x19, 0xcd, 0x67,
+	     0xa9, 0xb9, 0x81, 0x07, 0x00, 0xc0, 0xef, 0x83, 0x2f, 0x00,
+	     0x00, 0x80, 0x26, 0x6c, 0x21, 0xba, 0x85, 0xa4, 0xe2, 0xb2,
+	     0x85, 0x76, 0x06, 0x18, 0x04, 0x00, 0xe8, 0x6c, 0x00, 0x00,
+	     0x8a, 0x80, 0x1b, 0x94, 0x87, 0x8a, 0x72, 0x08, 0x00, 0xc8,
+	     0xfb, 0x1c, 0x5a, 0x82, 0x0b, 0x00, 0x00, 0xbe, 0x8c, 0x64,
+	     0x28, 0x00, 0x81, 0xb2, 0xca, 0xb3, 0xe0, 0x5b, 0xfc, 0x64,
+	     0x6b, 0x25, 0x00, 0x80, 0x10, 0xd0, 0x65, 0x02, 0x00, 0xe0,
+	     0x40, 0xc1, 0xc8, 0x7c, 0x31, 0x86, 0xa5, 0x5e, 0x9b, 0x72,
+	     0x26, 0x73, 0xb2, 0x39, 0x09, 0xfe, 0x00, 0x00, 0x8c, 0x1b,
+	     0x9b, 0x15, 0x94, 0xdb, 0x81, 0x25, 0x87, 0x52, 0x56, 0x73,
+	     0x21, 0x86, 0x9d, 0x4a, 0x06, 0xb9, 0x13, 0x78, 0x9b, 0x19,
+	     0x2c, 0xa3, 0xf4, 0x17, 0x61, 0x2b, 0x9d, 0xd4, 0x00, 0x00,
+	     0x62, 0x8d, 0xb6, 0x48, 0x56, 0x01, 0xff, 0x92, 0xd7, 0x1c,
+	     0xa6, 0x1c, 0xcb, 0x24, 0x37, 0xc6, 0x95, 0x85, 0xd3, 0x6a,
+	     0xd0, 0x74, 0x26, 0x8c, 0x04, 0x00, 0x10, 0x38, 0x28, 0x6c,
+	     0x75, 0xb0, 0x18, 0x00, 0x63, 0xec, 0x99, 0x86, 0x72, 0x08,
+	     0xa9, 0x50, 0x17, 0xd3, 0x84, 0xa9, 0x90, 0xe6, 0x25, 0x74,
+	     0x91, 0x9a, 0x74, 0xc0, 0x4a, 0x69, 0x4a, 0x4d, 0x2e, 0x76,
+	     0x11, 0xc1, 0x66, 0x26, 0xd2, 0xcd, 0x89, 0x01, 0x00, 0x70,
+	     0x6a, 0x38, 0x4f, 0x32, 0x66, 0x2a, 0x4a, 0x00, 0x80, 0x8f,
+	     0x64, 0x42, 0x49, 0x91, 0x54, 0xa8, 0x84, 0x35, 0xd0, 0x84,
+	     0xdf, 0xaa, 0x3d, 0x23, 0xd8, 0x0a, 0x00, 0xd0, 0xb9, 0x4b,
+	     0x43, 0x41, 0x44, 0xf2, 0x1a, 0x78, 0x1b, 0xc4, 0xc6, 0x3e,
+	     0x08, 0x56, 0x04, 0x80, 0x89, 0xb9, 0xfc, 0x44, 0xf4, 0x66,
+	     0x00, 0x80, 0x0c, 0xa1, 0x07, 0x10, 0xf0, 0xc3, 0x62, 0x89,
+	     0x05, 0x3c, 0xe5, 0x7a, 0x31, 0x8a, 0x13, 0x1e, 0x91, 0x7b,
+	     0x0b, 0x00, 0xd0, 0x9f, 0x24, 0xd4, 0x00, 0x00, 0x00, 0x00,
+	     0x68, 0x8e, 0x1b, 0x8b, 0x77, 0x00, 0x00, 0x00, 0x00, 0x70,
+	     0x66, 0xc1, 0x2f, 0x00, 0x00, 0xcf, 0x87, 0x44, 0x46, 0xa8,
+	     0x47, 0x8a, 0xc1, 0x66, 0x80, 0x70, 0x8e, 0xf0, 0x18, 0x60,
+	     0x2d, 0x07, 0x2a, 0x18, 0x63, 0xe6, 0x0d, 0xc2, 0xe7, 0xf1,
+	     0x5b, 0xe4, 0x15, 0x00, 0x00, 0x27, 0x20, 0x00, 0x40, 0x86,
+	     0x43, 0xfe, 0x88, 0x7f, 0x7a, 0x6f, 0x2c, 0x1a, 0x92, 0x3d,
+	     0x00, 0x00, 0xa9, 0xdb, 0xde, 0xa2, 0x6c, 0x06, 0x00, 0xf8,
+	     0xbf, 0x21, 0x16, 0xf4, 0x73, 0x50, 0xb3, 0x0b, 0x5f, 0xfd,
+	     0xe7, 0xf9, 0xe1, 0x9a, 0x80, 0x0e, 0x01, 0x00, 0x3c, 0x60,
+	     0x78, 0xcb, 0x70, 0x14, 0x15, 0x0f, 0xd5, 0x47, 0x99, 0xb3,
+	     0xd9, 0x58, 0x00, 0xa0, 0x2e, 0x3b, 0x02, 0xb5, 0x12, 0x00,
+	     0x00, 0xa0, 0x34, 0xcf, 0x00, 0x25, 0x02, 0x00, 0x00, 0x00,
+	     0xe8, 0x8b, 0x90, 0xe0, 0x9e, 0x40, 0xc3, 0x27, 0x4f, 0x04,
+	     0x00, 0x10, 0x7e, 0x6a, 0x26, 0x00, 0x00, 0xfe, 0x00, 0xba,
+	     0x08, 0x00, 0x70, 0xb3, 0x89, 0xee, 0xa8, 0x42, 0x4a, 0x0d,
+	     0x39, 0x30, 0xb6, 0xca, 0x8a, 0xcf, 0xd7, 0x03, 0x8c, 0x7b,
+	     0x5c, 0x8c, 0x7f, 0x1c, 0x0f, 0x5f, 0x38, 0x00, 0x80, 0xb2,
+	     0x64, 0xe8, 0x44, 0xf0, 0x00, 0x00, 0x54, 0x9f, 0x1a, 0x3c,
+	     0xd9, 0x90, 0x8b, 0x83, 0x1f, 0x02, 0xc2, 0x18, 0x5e, 0x30,
+	     0xb9, 0x69, 0x0b, 0x55, 0x69, 0x5b, 0xaa, 0xc9, 0xe6, 0xab,
+	     0x89, 0xd9, 0x12, 0xca, 0xd1, 0x83, 0x01, 0x00, 0x06, 0x97,
+	     0x74, 0xb5, 0x66, 0x10, 0x9a, 0x05, 0x2f, 0x08, 0x8e, 0x43,
+	     0x07, 0xbe, 0x13, 0x59, 0x58, 0x7a, 0xae, 0x64, 0x5e, 0x68,
+	     0xc9, 0x25, 0x91, 0x87, 0x00, 0x00, 0xd0, 0x2f, 0xa4, 0x7d,
+	     0xb3, 0x3c, 0xcf, 0x14, 0x00, 0x80, 0x18, 0x03, 0x00, 0xd8,
+	     0x34, 0x48, 0x24, 0x7c, 0x16, 0xce, 0x25, 0x72, 0x45, 0x2a,
+	     0xd3, 0xd9, 0xc8, 0x9f, 0x0c, 0xd7, 0xc9, 0xf3, 0x9a, 0x81,
+	     0xc7, 0x1a, 0x50, 0x22, 0x00, 0x40, 0x31, 0x04, 0x80, 0x03,
+	     0x00, 0x6c, 0x5e, 0x40, 0x45, 0x2a, 0x2b, 0xc3, 0xe1, 0xac,
+	     0xe1, 0xde, 0x58, 0xcc, 0x9a, 0x29, 0x60, 0x75, 0x92, 0x8e,
+	     0x85, 0xa6, 0xab, 0x09, 0xbc, 0xb0, 0x63, 0xf7, 0x51, 0x48,
+	     0xb7, 0xe4, 0x48, 0x3a, 0x07, 0x64, 0x34, 0xe2, 0x0f, 0x16,
+	     0xe1, 0x7f, 0xa8, 0x0c, 0x49, 0xda, 0x79, 0x87, 0x66, 0x0d,
+	     0xdf, 0x89, 0x6e, 0xc8, 0x20, 0x08, 0x00, 0xc0, 0x6b, 0xe1,
+	     0x46, 0x00, 0x00, 0x02, 0x05, 0x2b, 0x2f, 0x7a, 0x8a, 0x6c,
+	     0xcf, 0xde, 0x08, 0x00, 0x00, 0x00, 0x58, 0xe1, 0xd6, 0x4e,
+	     0x24, 0xae, 0x36, 0xc3, 0xa9, 0x2d, 0x45, 0x03, 0x00, 0x00,
+	     0x10, 0x08, 0x78, 0x1a, 0x36, 0x04, 0x96, 0x1f, 0x84, 0x52,
+	     0x0d, 0x00, 0x00, 0x00, 0x50, 0x6b, 0xc9, 0x09, 0xb0, 0x2a,
+	     0x86, 0x96, 0xcd, 0x84, 0xda, 0x91, 0x53, 0xb4, 0x9d, 0xf3,
+	     0xc2, 0x98, 0xf9, 0xc8, 0x2a, 0x54, 0x8b, 0x10, 0xd3, 0x9c,
+	     0xce, 0x07, 0xc3, 0xcb, 0x9c, 0x45, 0x01, 0x00, 0x80, 0x05,
+	     0x93, 0x33, 0xe3, 0x26, 0x00, 0x00, 0x00, 0x80, 0x57, 0xac,
+	     0x8f, 0x5d, 0xd1, 0x5a, 0x32, 0xc3, 0x08, 0xc8, 0xc7, 0xa4,
+	     0x06, 0xdd, 0x83, 0xe9, 0x6b, 0x03, 0x2c, 0x31, 0x3c, 0x7a,
+	     0x1b, 0x2f, 0x00, 0x00, 0x00, 0xf0, 0x67, 0x92, 0x2d, 0xc3,
+	     0x10, 0xc1, 0x2d, 0xbd, 0x35, 0x43, 0x04, 0x7b, 0xa5, 0xc4,
+	     0x04, 0x00, 0xd0, 0xa5, 0x7a, 0x07, 0x22, 0xbe, 0xf4, 0x3f,
+	     0xc5, 0x35, 0x83, 0x83, 0x53, 0x8b, 0x81, 0x71, 0xbe, 0xc8,
+	     0xdc, 0x01, 0x00, 0x94, 0x73, 0x0b, 0xc8, 0xe0, 0x07, 0x00,
+	     0x00, 0x00, 0x80, 0x40, 0x2b, 0xe3, 0xb9, 0x1c, 0x00, 0x00,
+	     0xab, 0xc6, 0x01, 0x19, 0x1a, 0xd1, 0xe8, 0xa2, 0x43, 0x23,
+	     0x56, 0xfc, 0x2e, 0x13, 0x0e, 0x9b, 0x1e, 0x16, 0xa2, 0x2e,
+	     0x6c, 0xf0, 0x87, 0x1b, 0x02, 0x00, 0xdc, 0x9f, 0x86, 0x07,
+	     0x3e, 0x2f, 0xcb, 0xa5, 0x10, 0x61, 0xbf, 0x46, 0x81, 0x4b,
+	     0x47, 0xad, 0x99, 0xae, 0x5c, 0x37, 0x14, 0x10, 0x8c, 0x18,
+	     0x92, 0x28, 0x65, 0x70, 0x70, 0x59, 0xba, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x54, 0x52, 0x03, 0x84, 0xfd, 0x17, 0xe7, 0x71,
+	     0x07, 0x00, 0x32, 0xc0, 0x38, 0x2e, 0xc7, 0x97, 0x1d, 0xd9,
+	     0x64, 0x24, 0x49, 0xcb, 0x03, 0x6d, 0xd8, 0x28, 0x38, 0x3b,
+	     0x45, 0xb2, 0x79, 0xe1, 0x3e, 0x11, 0x6b, 0x05, 0x00, 0x40,
+	     0x9c, 0xc9, 0xb9, 0x10, 0x47, 0xa7, 0xa7, 0xf3, 0x51, 0xd0,
+	     0x51, 0x41, 0x38, 0x8f, 0xf9, 0xe7, 0x00, 0x00, 0xb6, 0x2b,
+	     0x0a, 0xc2, 0x0a, 0x89, 0xc9, 0x09, 0x53, 0xd8, 0xc3, 0x04,
+	     0x00, 0xec, 0xf1, 0x10, 0x97, 0x93, 0xb8, 0xf2, 0x81, 0xe9,
+	     0x01, 0x00, 0x70, 0x64, 0x78, 0x56, 0x92, 0x8b, 0xc2, 0x66,
+	     0x38, 0x11, 0x00, 0x80, 0xf9, 0xc4, 0x60, 0xd1, 0xa1, 0x49,
+	     0x1a, 0x3e, 0x14, 0x3b, 0x08, 0x8e, 0x14, 0x2c, 0x61, 0xc0,
+	     0x11, 0x00, 0xe0, 0x43, 0x92, 0xdb, 0x00, 0x5c, 0xaa, 0x69,
+	     0x78, 0x86, 0x3c, 0xdf, 0xdd, 0xc1, 0x27, 0xd2, 0xfa, 0x3a,
+	     0xd3, 0x75, 0x1f, 0x28, 0x0a, 0x00, 0x80, 0x67, 0x86, 0xf2,
+	     0x2b, 0x3a, 0x05, 0x00, 0x38, 0xa5, 0x58, 0x1a, 0x72, 0x5f,
+	     0x00, 0x00, 0xfb, 0xa1, 0x60, 0xe8, 0x1e, 0x45, 0x20, 0xd2,
+	     0x15, 0xb1, 0xa0, 0xc2, 0x2a, 0x00, 0x00, 0x13, 0x96, 0xd5,
+	     0x10, 0x00, 0xb0, 0xc7, 0x70, 0x70, 0x1c, 0xfd, 0x00, 0x00,
+	     0x00, 0x80, 0x19, 0x44, 0xb8, 0x0d, 0x00, 0xa0, 0xf2, 0x0a,
+	     0xc0, 0x39, 0x2a, 0x9e, 0x55, 0x82, 0x04, 0x08, 0x15, 0x00,
+	     0x80, 0x8f, 0x07, 0x00, 0x58, 0xd9, 0x30, 0xfc, 0xe4, 0x78,
+	     0xef, 0xa4, 0xea, 0x53, 0x6a, 0x08, 0x00, 0xb0, 0xb5, 0x23,
+	     0xc7, 0x01, 0x00, 0x00, 0x00, 0xf7, 0x21, 0xe3, 0x84, 0x24,
+	     0xc7, 0x46, 0xb6, 0x27, 0x03, 0x00, 0xa8, 0xd0, 0x00, 0x00,
+	     0xb6, 0x36, 0x00, 0x40, 0x16, 0x72, 0x1e, 0xc4, 0xa0, 0x04,
+	     0x00, 0x78, 0x3c, 0xf8, 0x8e, 0x20, 0x81, 0xd9, 0xcb, 0xf1,
+	     0xcf, 0xfd, 0x40, 0xea, 0x43, 0x35, 0x02, 0x00, 0xe8, 0x7e,
+	     0x62, 0xac, 0xc1, 0x20, 0x00, 0x00, 0x00, 0x60, 0xaa, 0xd8,
+	     0x88, 0x79, 0x91, 0x7a, 0x4b, 0x02, 0xae, 0x70, 0xa4, 0x17,
+	     0x00, 0x00, 0x00, 0x00, 0x20, 0x33, 0x0e, 0xae, 0x8a, 0x37,
+	     0x00, 0x00, 0x00, 0x00, 0xa1, 0x8c, 0xf6, 0xc1, 0x2c, 0xf2,
+	     0xe1, 0x48, 0x06, 0x02, 0x38, 0x0f, 0x44, 0x00, 0x00, 0xab,
+	     0x03, 0xc0, 0x81, 0xcd, 0x29, 0x04, 0x4a, 0x01, 0xb8, 0x3f,
+	     0x4b, 0xc0, 0x59, 0xcc, 0x46, 0x68, 0x82, 0x89, 0x79, 0x04,
+	     0x00, 0x44, 0xc6, 0xdc, 0x98, 0x61, 0x83, 0xdf, 0x03, 0xd2,
+	     0xe5, 0x57, 0xb7, 0x59, 0x74, 0xfd, 0x08, 0xc5, 0x3e, 0x3a,
+	     0x00, 0x80, 0xcb, 0x11, 0x42, 0x49, 0x76, 0x00, 0x00, 0xf8,
+	     0x2c, 0xbe, 0x49, 0x7c, 0x51, 0x68, 0x0d, 0x07, 0x62, 0x70,
+	     0x92, 0x08, 0x17, 0x71, 0x82, 0x16, 0xb2, 0x87, 0x80, 0x51,
+	     0x22, 0x05, 0x2b, 0x1b, 0x0e, 0xac, 0x61, 0x54, 0x76, 0x42,
+	     0x41, 0x01, 0x00, 0x74, 0x0e, 0x84, 0x02, 0x09, 0x09, 0x00,
+	     0xc0, 0xe5, 0xb6, 0x06, 0x03, 0x31, 0xe4, 0xae, 0xee, 0x9a,
+	     0xb1, 0x12, 0x40, 0x63, 0x79, 0x49, 0xfa, 0x06, 0x00, 0xe0,
+	     0xc9, 0x01, 0x00, 0x12, 0x6b, 0xdc, 0x91, 0x78, 0x64, 0x17,
+	     0xe8, 0x65, 0x04, 0x00, 0x60, 0xd2, 0x5d, 0x0d, 0x33, 0x1c,
+	     0xe6, 0x46, 0x3a, 0xa1, 0x5b, 0x89, 0x4d, 0xf1, 0x9c, 0xbb,
+	     0x4c, 0x2e, 0x82, 0x00, 0x00, 0x00, 0x80, 0xc4, 0x05, 0x00,
+	     0x20, 0x38, 0x41, 0xd0, 0xa8, 0x21, 0x01, 0x00, 0x58, 0x57,
+	     0x7a, 0x8a, 0x09, 0x63, 0x95, 0x27, 0x82, 0x07, 0x00, 0x08,
+	     0x1d, 0x00, 0x00, 0x48, 0x0a, 0xe2, 0xba, 0x65, 0x90, 0x1b,
+	     0xa9, 0xc7, 0xa4, 0xab, 0xbc, 0xd1, 0x01, 0x00, 0x82, 0x65,
+	     0x47, 0xb2, 0xfc, 0x58, 0x7f, 0x82, 0x85, 0x81, 0x1c, 0x04,
+	     0x00, 0x74, 0x5c, 0x8e, 0x82, 0x00, 0x80, 0x4c, 0x8e, 0x1a,
+	     0x0b, 0x00, 0x90, 0xc3, 0xcc, 0x2c, 0x29, 0x07, 0xff, 0x38,
+	     0x90, 0xc9, 0xae, 0xdf, 0x1a, 0xe1, 0xcc, 0x91, 0x75, 0x80,
+	     0x53, 0xe1, 0x94, 0x66, 0x88, 0x28, 0x9d, 0x1b, 0x1a, 0xa2,
+	     0x61, 0x83, 0x46, 0xdc, 0xd3, 0x4c, 0x75, 0x22, 0x74, 0x7d,
+	     0xdf, 0x1f, 0xdc, 0x1f, 0xe3, 0x43, 0xf8, 0x74, 0x0e, 0x8a,
+	     0x9e, 0x78, 0xf0, 0xe8, 0x27, 0xd3, 0xb6, 0xd1, 0xc6, 0xfb,
+	     0xeb, 0x82, 0xd4, 0x30, 0xb3, 0x04, 0x00, 0x00, 0xe4, 0x42,
+	     0xfd, 0x44, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xb8, 0xf9, 0x2b,
+	     0x15, 0xde, 0xb6, 0x00, 0x00, 0x8b, 0x4a, 0xfd, 0x80, 0x3b,
+	     0x88, 0xc8, 0xa5, 0x60, 0x33, 0x69, 0x02, 0x00, 0x92, 0x30,
+	     0x71, 0xb1, 0x47, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+	     0x9e, 0x30, 0x1c, 0x35, 0x70, 0x00, 0x00, 0xd5, 0x46, 0x53,
+	     0xe9, 0x77, 0x20, 0xba, 0x49, 0x64, 0x2e, 0xaa, 0x22, 0x73,
+	     0x19, 0xb4, 0xaf, 0xd7, 0x18, 0xce, 0x29, 0xf7, 0x5b, 0x33,
+	     0x00, 0x02, 0x00, 0x82, 0x6d, 0x3b, 0x94, 0xe0, 0xe1, 0xda,
+	     0x08, 0x8c, 0x87, 0xb6, 0x68, 0x7c, 0xe9, 0x68, 0xac, 0x6a,
+	     0xd9, 0x97, 0xd9, 0x46, 0x16, 0x40, 0xe9, 0xe4, 0x32, 0x4b,
+	     0x4b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x18, 0x00,
+	     0xc0, 0xc2, 0x26, 0xfe, 0x49, 0x2a, 0xe8, 0x0f, 0x58, 0x1e,
+	     0x00, 0x00, 0x6f, 0xc4, 0x99, 0x8a, 0x64, 0xb1, 0xcb, 0x13,
+	     0x1f, 0x32, 0xf3, 0x10, 0x03, 0x72, 0x17, 0x3d, 0x17, 0x58,
+	     0xac, 0x49, 0x55, 0x68, 0x3b, 0x5f, 0xce, 0x0d, 0x68, 0x2e,
+	     0x0a, 0x13, 0x3a, 0xe6, 0xfe, 0x00, 0xea, 0x35, 0x12, 0x21,
+	     0x1d, 0x72, 0xd9, 0x00, 0x00, 0xcd, 0x06, 0x00, 0x40, 0xc6,
+	     0x00, 0xeb, 0x01, 0x00, 0xe8, 0x01, 0x98, 0xd5, 0x46, 0x08,
+	     0x8e, 0xb8, 0xd4, 0xa6, 0x56, 0x2b, 0xea, 0xf8, 0x7b, 0x81,
+	     0x05, 0x02, 0x00, 0x60, 0x1a, 0x25, 0xbb, 0x19, 0x88, 0xf1,
+	     0x2c, 0x59, 0xe9, 0xe6, 0x29, 0xf1, 0x75, 0x8a, 0x68, 0x72,
+	     0xc1, 0x2a, 0x07, 0x0d, 0xa4, 0x30, 0x1e, 0x04, 0xe6, 0xb8,
+	     0x6f, 0x8d, 0x75, 0x84, 0x10, 0x7e, 0x15, 0xfc, 0x12, 0x00,
+	     0x40, 0x1e, 0x21, 0x1b, 0xec, 0x64, 0x6e, 0x15, 0xa6, 0x2c,
+	     0x64, 0x48, 0x98, 0x0e, 0xfd, 0xa3, 0x5c, 0xc1, 0x99, 0x00,
+	     0x00, 0x40, 0xe5, 0x46, 0x40, 0x00, 0x00, 0x00, 0xc0, 0x40,
+	     0xc8, 0xae, 0xa8, 0x35, 0x04, 0x00, 0x5c, 0xd9, 0xf4, 0x91,
+	     0x25, 0xc8, 0x5e, 0x25, 0x00, 0xa0, 0xd5, 0x00, 0x42, 0xd9,
+	     0x27, 0x32, 0x86, 0x00, 0x00, 0x00, 0x00, 0x07, 0x57, 0xbf,
+	     0x67, 0x0f, 0xc6, 0xd3, 0x00, 0x00, 0x44, 0x02, 0x73, 0x78,
+	     0x90, 0xc5, 0x01, 0x1e, 0xfb, 0x29, 0xab, 0x24, 0x54, 0xe0,
+	     0xc1, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0e, 0xfe, 0x5c, 0x9a,
+	     0xb2, 0xaa, 0x29, 0x4c, 0x03, 0x00, 0x94, 0x08, 0x00, 0x00,
+	     0x0c, 0x84, 0x72, 0x84, 0xd0, 0x40, 0x80, 0xe2, 0x09, 0x00,
+	     0x00, 0x10, 0x06, 0xd6, 0x7d, 0xd4, 0x22, 0x00, 0x40, 0x82,
+	     0x80, 0xfe, 0x33, 0x10, 0xec, 0xeb, 0x3c, 0xde, 0x4c, 0x8c,
+	     0x94, 0x15, 0x58, 0xdf, 0x00, 0x05, 0x00, 0xd0, 0x2f, 0x72,
+	     0xff, 0x59, 0x94, 0xe4, 0x4b, 0xdd, 0x1f, 0x00, 0x00, 0x00,
+	     0x20, 0xfd, 0x07, 0x00, 0x00, 0x00, 0x28, 0x38, 0x82, 0x81,
+	     0x92, 0x4d, 0x84, 0x8f, 0xa5, 0x05, 0x00, 0x00, 0x00, 0x80,
+	     0x15, 0x01, 0x00, 0xb2, 0x54, 0x2b, 0x82, 0x42, 0xd7, 0x00,
+	     0x90, 0x09, 0x66, 0x93, 0xac, 0x71, 0x01, 0x00, 0x32, 0x03,
+	     0x86, 0x4c, 0xb8, 0x21, 0x6a, 0x08, 0x00, 0x90, 0xff, 0x33,
+	     0x56, 0x96, 0xae, 0x02, 0x67, 0xb6, 0x9e, 0x87, 0x14, 0x46,
+	     0xc4, 0x56, 0xb9, 0x6c, 0x49, 0x38, 0xc0, 0x39, 0x00, 0x00,
+	     0xb0, 0xa8, 0x65, 0x9f, 0x2e, 0xa2, 0xb0, 0xa7, 0x45, 0x49,
+	     0x69, 0x29, 0x40, 0xa2, 0x97, 0x5d, 0xa1, 0xa3, 0x18, 0x00,
+	     0xc0, 0x00, 0x07, 0x00, 0xd0, 0xe8, 0x69, 0x8c, 0x68, 0x73,
+	     0xa7, 0x44, 0xe8, 0xe5, 0xfa, 0xe0, 0x76, 0xf8, 0xa3, 0xf2,
+	     0xeb, 0x3c, 0x84, 0xba, 0x3e, 0xff, 0xc2, 0xe2, 0xd2, 0x5b,
+	     0xae, 0xfc, 0x05, 0x3d, 0x8a, 0x45, 0x9d, 0x00, 0x6b, 0x39,
+	     0x7e, 0x0e, 0xed, 0x95, 0x05, 0xc7, 0x7b, 0x00, 0xd2, 0xc8,
+	     0x78, 0x89, 0x2d, 0xc7, 0x10, 0x8a, 0x04, 0x95, 0x21, 0x48,
+	     0xed, 0x15, 0xb5, 0x83, 0x03, 0x00, 0xdc, 0x7b, 0xec, 0x18,
+	     0xc4, 0x95, 0xe4, 0x97, 0x00, 0x2e, 0xb0, 0x72, 0x20, 0x1c,
+	     0xd1, 0x00, 0x00, 0x0c, 0x7d, 0x0f, 0x22, 0x00, 0xc0, 0x4f,
+	     0x43, 0xae, 0x02, 0x00, 0xa0, 0x21, 0xd6, 0x22, 0xca, 0x1b,
+	     0x00, 0x00, 0xaf, 0x08, 0x8c, 0x12, 0x00, 0x00, 0x00, 0x38,
+	     0x83, 0x01, 0x00, 0x74, 0x5f, 0x8b, 0x89, 0x54, 0xa3, 0xb0,
+	     0x91, 0xd4, 0xe8, 0xf1, 0x23, 0x8e, 0x51, 0x43, 0x18, 0x03,
+	     0xcb, 0x87, 0x54, 0x00, 0x00, 0x00, 0x58, 0xb4, 0x26, 0xf0,
+	     0x52, 0xd2, 0x3a, 0x06, 0x5d, 0x9d, 0x0c, 0x00, 0x80, 0xbf,
+	     0x90, 0x2d, 0x99, 0xea, 0x00, 0x00, 0x04, 0x52, 0x22, 0x7f,
+	     0xab, 0x95, 0xf0, 0xdb, 0x64, 0x08, 0x00, 0x30, 0x30, 0xcb,
+	     0x9f, 0x55, 0xad, 0x5e, 0x96, 0x54, 0x43, 0xb1, 0x64, 0xac,
+	     0x09, 0x5d, 0x44, 0xa6, 0xa2, 0x50, 0x9d, 0xd1, 0xa8, 0x59,
+	     0xb6, 0x2b, 0x00, 0x00, 0x00, 0xc0, 0x14, 0xc0, 0x84, 0x04,
+	     0x00, 0x20, 0x2c, 0xa6, 0x6e, 0x85, 0xa6, 0x72, 0xdb, 0x2f,
+	     0x70, 0xe0, 0x01, 0xa5, 0x3c, 0x62, 0xc8, 0xbf, 0x8e, 0x8b,
+	     0x00, 0x00, 0xa6, 0xa4, 0x16, 0xd0, 0x9f, 0xe5, 0x73, 0x11,
+	     0xe9, 0x01, 0x00, 0xaa, 0x88, 0x5b, 0x13, 0x40, 0x8b, 0x5c,
+	     0xf2, 0x19, 0x09, 0xdb, 0x44, 0x51, 0x35, 0x71, 0x9c, 0x29,
+	     0xf9, 0x4c, 0xbc, 0x8d, 0x2a, 0x20, 0x66, 0x00, 0x6b, 0x9b,
+	     0x6d, 0x12, 0x6a, 0x3e, 0x51, 0x00, 0x80, 0x67, 0x5b, 0x72,
+	     0xcf, 0x2e, 0xb4, 0xbd, 0x53, 0x78, 0xcc, 0xe4, 0xf8, 0x57,
+	     0x18, 0x2b, 0xf9, 0x0c, 0xec, 0x09, 0xa8, 0xe1, 0x22, 0x3c,
+	     0x59, 0xea, 0x18, 0xa0, 0x38, 0x4b, 0x84, 0x89, 0x14, 0x65,
+	     0xc9, 0x22, 0x50, 0xc9, 0x04, 0x00, 0x7c, 0xb6, 0x56, 0x60,
+	     0x04, 0x93, 0x9c, 0xcb, 0x7d, 0xad, 0x96, 0x65, 0x6c, 0x89,
+	     0x65, 0x51, 0x1b, 0x21, 0x3c, 0x54, 0x4b, 0xc3, 0xe2, 0x03,
+	     0xab, 0xe5, 0x82, 0x4d, 0x9b, 0xc2, 0xd9, 0xfd, 0xde, 0x59,
+	     0xb8, 0x12, 0xdf, 0x49, 0x3e, 0x08, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0xe4, 0xdd, 0x00, 0x00, 0xe5, 0xac, 0xa9, 0xde, 0x6a,
+	     0xe8, 0x9f, 0xe1, 0x57, 0x12, 0xf5, 0x00, 0x00, 0x00, 0x00,
+	     0x8a, 0x37, 0x40, 0x1f, 0x83, 0x50, 0x52, 0x06, 0x00, 0xf8,
+	     0x62, 0x66, 0x79, 0xb8, 0x47, 0x00, 0x80, 0x01, 0x1b, 0x6c,
+	     0xe8, 0xca, 0x05, 0x00, 0xd0, 0xdb, 0x1c, 0xc2, 0xd2, 0x10,
+	     0x3b, 0xb4, 0x48, 0x16, 0x86, 0x41, 0x5d, 0xd6, 0xcc, 0x92,
+	     0x01, 0xb8, 0x85, 0x06, 0x2c, 0xe6, 0xbe, 0x54, 0xd8, 0x72,
+	     0x12, 0x24, 0xb7, 0x1d, 0x13, 0x2f, 0x50, 0xfe, 0x7e, 0x1b,
+	     0x00, 0x80, 0x4e, 0x1e, 0x00, 0xe0, 0xbf, 0xc0, 0xdf, 0x32,
+	     0x68, 0x52, 0x21, 0x36, 0x3c, 0x91, 0x11, 0x00, 0x00, 0xc1,
+	     0xe8, 0x10, 0xa4, 0x7d, 0xdb, 0x87, 0x14, 0x37, 0x90, 0x4a,
+	     0x90, 0x95, 0x97, 0xd5, 0xea, 0xad, 0xc0, 0xe8, 0x6c, 0x03,
+	     0x00, 0x08, 0x5f, 0x00, 0x00, 0x00, 0x80, 0xbd, 0x60, 0x4f,
+	     0x8a, 0x4b, 0x14, 0x4d, 0x41, 0x6f, 0x94, 0x07, 0xb6, 0x03,
+	     0xea, 0x84, 0xd4, 0x03, 0x00, 0x60, 0xd0, 0xa0, 0x7c, 0x02,
+	     0x00, 0x54, 0xc5, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x8f, 0x9e,
+	     0x07, 0x00, 0x50, 0x66, 0x82, 0xea, 0x28, 0xd0, 0xa4, 0x3f,
+	     0x8d, 0x4a, 0x00, 0x40, 0x21, 0x13, 0x00, 0x20, 0xe7, 0x90,
+	     0xf6, 0xf0, 0x1f, 0x01, 0x00, 0xc7, 0x4a, 0x0b, 0x9e, 0x7c,
+	     0x03, 0x00, 0x20, 0x02, 0x4c, 0x3b, 0x38, 0x05, 0x36, 0x6e,
+	     0x24, 0x3d, 0xde, 0xd2, 0x1f, 0xca, 0xcb, 0x60, 0x57, 0x4a,
+	     0xda, 0x28, 0x1f, 0x1b, 0x97, 0x71, 0x91, 0x7e, 0xde, 0x12,
+	     0x92, 0x89, 0x00, 0x00, 0xb8, 0x9c, 0xbc, 0x40, 0xe8, 0x3b,
+	     0x59, 0x33, 0x00, 0x80, 0x7e, 0xe2, 0x37, 0xd8, 0x9c, 0xc4,
+	     0x51, 0xd4, 0x60, 0xa4, 0x2a, 0x85, 0x2a, 0x70, 0x26, 0x62,
+	     0x4c, 0x5a, 0x70, 0x74, 0x90, 0xcd, 0x00, 0x00, 0x7e, 0x03,
+	     0x00, 0x80, 0xad, 0x55, 0x4e, 0x49, 0xb3, 0xf6, 0x05, 0xca,
+	     0x5e, 0x39, 0xf8, 0xda, 0x0e, 0x2d, 0x26, 0x00, 0x00, 0x00,
+	     0xe0, 0xcd, 0x78, 0x0c, 0x02, 0x00, 0x80, 0xb1, 0x86, 0x16,
+	     0x87, 0x0c, 0x00, 0x00, 0xf0, 0xc6, 0xe6, 0x48, 0x74, 0x0b,
+	     0x0c, 0x10, 0x21, 0x84, 0x68, 0xb7, 0x10, 0x00, 0x00, 0x39,
+	     0xf0, 0xab, 0x04, 0x00, 0x88, 0xff, 0xb5, 0x61, 0x1c, 0x64,
+	     0x2f, 0xca, 0x94, 0xc7, 0x9b, 0xb2, 0x7b, 0xb5, 0x4d, 0xdb,
+	     0xfd, 0xcd, 0x1c, 0x23, 0x08, 0x68, 0x44, 0xe1, 0xc3, 0x4b,
+	     0x60, 0xd1, 0x47, 0x51, 0x18, 0x5c, 0x02, 0x21, 0x00, 0x00,
+	     0x55, 0xa8, 0x3b, 0x53, 0xe0, 0x12, 0x00, 0x30, 0x6a, 0xca,
+	     0xc2, 0xb8, 0xa0, 0xfc, 0x84, 0xd6, 0xc7, 0x3c, 0x48, 0x2c,
+	     0x6b, 0xe3, 0x00, 0x00, 0xa8, 0xf6, 0xb5, 0xda, 0x50, 0x7e,
+	     0x4f, 0x27, 0xc5, 0x9d, 0x18, 0x0f, 0xfe, 0xa3, 0x78, 0x04,
+	     0x00, 0x44, 0x85, 0xe2, 0x56, 0xd5, 0x30, 0x4a, 0x16, 0x59,
+	     0xeb, 0x78, 0x49, 0x09, 0x89, 0xfe, 0xa0, 0x63, 0x86, 0x15,
+	     0xb8, 0x80, 0xa4, 0x17, 0x00, 0xc0, 0xa1, 0x02, 0x00, 0x38,
+	     0x6e, 0x80, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x19, 0x18, 0x87,
+	     0x8f, 0xa2, 0x22, 0x50, 0x03, 0x00, 0xe8, 0x0f, 0x00, 0x00,
+	     0x72, 0x83, 0x3e, 0xd0, 0x2c, 0x85, 0x2b, 0x02, 0x9a, 0xea,
+	     0x50, 0xf2, 0x6a, 0x02, 0x6c, 0x0a, 0xa7, 0x40, 0x19, 0x35,
+	     0x13, 0x00, 0x60, 0xdd, 0x44, 0x69, 0xce, 0x2c, 0xae, 0x1d,
+	     0x39, 0xb3, 0xf8, 0x8f, 0x2a, 0xf3, 0xeb, 0xd2, 0xed, 0x62,
+	     0x0d, 0x4c, 0xff, 0xa6, 0x2c, 0x07, 0xb6, 0x8b, 0x1a, 0x00,
+	     0xa0, 0x4c, 0x08, 0x76, 0xdb, 0x2f, 0x50, 0xc5, 0x88, 0x3b,
+	     0x2c, 0x2e, 0x00, 0x40, 0x6d, 0xaa, 0x81, 0x58, 0xbe, 0xc3,
+	     0x9a, 0x21, 0x58, 0x6c, 0x75, 0xc8, 0x23, 0xa4, 0xd2, 0x2e,
+	     0x04, 0x00, 0x00, 0x7a, 0xfb, 0x72, 0x4c, 0x23, 0x3b, 0x62,
+	     0x00, 0x80, 0x89, 0x40, 0xb6, 0x10, 0x47, 0x25, 0x5f, 0x21,
+	     0xf9, 0x25, 0xe3, 0x4c, 0x4b, 0x9e, 0x20, 0x00, 0x00, 0x00,
+	     0x40, 0xee, 0xb1, 0x9e, 0xd1, 0xb8, 0x00, 0x00, 0x00, 0x00,
+	     0xee, 0x35, 0xde, 0xd5, 0xaa, 0x0b, 0x00, 0x70, 0x37, 0x1a,
+	     0x29, 0xc2, 0x7b, 0x34, 0x22, 0x90, 0x83, 0x49, 0x0a, 0x00,
+	     0x80, 0x29, 0x50, 0xe3, 0x02, 0x00, 0x00, 0x00, 0x26, 0x31,
+	     0x00, 0x00, 0xeb, 0x8d, 0x83, 0x46, 0x9f, 0xe6, 0x03, 0xcc,
+	     0xbd, 0x14, 0xb4, 0x9a, 0x94, 0xdd, 0x2f, 0x75, 0xd4, 0x82,
+	     0xe9, 0x9f, 0x83, 0xc1, 0x03, 0x00, 0xc8, 0xa7, 0x04, 0x98,
+	     0x00, 0x80, 0x52, 0xa3, 0x90, 0x66, 0x69, 0x67, 0x09, 0xc9,
+	     0xa1, 0xd5, 0x2b, 0x05, 0x27, 0x00, 0x80, 0x8d, 0x88, 0xfd,
+	     0x4c, 0x49, 0x03, 0x00, 0x28, 0xe2, 0xbc, 0xdd, 0x7e, 0x85,
+	     0x11, 0x93, 0x7f, 0x86, 0xa9, 0x4c, 0x82, 0xb3, 0x02, 0x62,
+	     0x8f, 0xc0, 0x15, 0x42, 0x97, 0xfa, 0x46, 0xe1, 0xcf, 0xcf,
+	     0x89, 0x6c, 0xa1, 0xf1, 0x20, 0x5f, 0xce, 0x18, 0x01, 0x00,
+	     0xd8, 0x1d, 0x00, 0x00, 0x64, 0xe1, 0xcc, 0x37, 0xc7, 0xb2,
+	     0x48, 0x42, 0x1a, 0xc7, 0x77, 0x00, 0x00, 0xaf, 0x08, 0x00,
+	     0xc0, 0x35, 0x87, 0x18, 0x5a, 0x39, 0xf6, 0x1c, 0x96, 0x6f,
+	     0x00, 0x00, 0x8b, 0x09, 0x00, 0xa0, 0xac, 0x90, 0xd4, 0xf1,
+	     0x21, 0x48, 0x81, 0x24, 0x50, 0xb7, 0x39, 0xc0, 0x80, 0xa9,
+	     0x01, 0xd4, 0x95, 0x8a, 0x7a, 0xca, 0x7d, 0xad, 0x2a, 0x55,
+	     0x8b, 0xc4, 0xae, 0x8b, 0x02, 0x6a, 0x90, 0x00, 0x00, 0x68,
+	     0x4d, 0x00, 0x00, 0x6a, 0x4b, 0x9e, 0x1c, 0x00, 0x00, 0x00,
+	     0x60, 0x49, 0x79, 0x90, 0x19, 0x85, 0x3c, 0x40, 0x80, 0x32,
+	     0x90, 0x48, 0xb6, 0xe1, 0x64, 0x03, 0xa7, 0x30, 0x63, 0x4c,
+	     0x26, 0x6c, 0x84, 0x70, 0x74, 0x59, 0xb3, 0xeb, 0x0e, 0x07,
+	     0x11, 0x4a, 0x27, 0x7a, 0x82, 0x57, 0x96, 0x85, 0x00, 0x00,
+	     0xd7, 0xb1, 0x5c, 0xa0, 0x8e, 0xac, 0x04, 0x20, 0x7c, 0x93,
+	     0x37, 0xae, 0x8b, 0x70, 0x65, 0x00, 0x00, 0x00, 0x40, 0x44,
+	     0xc1, 0x25, 0xe5, 0x15, 0xba, 0x1d, 0x61, 0x72, 0x00, 0x00,
+	     0xc1, 0x4d, 0x56, 0x08, 0x1f, 0x26, 0xa8, 0x02, 0x00, 0x68,
+	     0x25, 0x11, 0x4c, 0x40, 0x74, 0x3a, 0x3c, 0x53, 0x12, 0xfd,
+	     0x0f, 0x63, 0x97, 0xe5, 0x0a, 0x60, 0xc2, 0xee, 0x00, 0x00,
+	     0x63, 0xb6, 0x1d, 0x4b, 0x52, 0x31, 0x22, 0x55, 0x9b, 0xa4,
+	     0x20, 0xa1, 0xed, 0x06, 0x09, 0xad, 0xa5, 0x68, 0x60, 0xe8,
+	     0x12, 0xd3, 0x24, 0xbc, 0xb3, 0x3e, 0x00, 0x00, 0x28, 0x73,
+	     0x97, 0x9d, 0x6d, 0x5e, 0xf4, 0x31, 0xc4, 0xe1, 0x72, 0x33,
+	     0x2c, 0x00, 0x8b, 0xbe, 0x86, 0xc2, 0x14, 0x00, 0x00, 0xb4,
+	     0xcc, 0x82, 0x89, 0xec, 0x7a, 0x06, 0x01, 0x00, 0xbc, 0x0f,
+	     0x31, 0xa6, 0xf1, 0x86, 0xf6, 0x4c, 0x7e, 0x49, 0x44, 0x00,
+	     0x47, 0x00, 0x00, 0x2a, 0x72, 0x05, 0xba, 0x9e, 0x9b, 0x11,
+	     0x88, 0x1e, 0x73, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x76,
+	     0xf5, 0x84, 0xb9, 0x9d, 0xe1, 0x6b, 0x94, 0x08, 0x00, 0xa8,
+	     0x08, 0xae, 0x14, 0xca, 0x63, 0x06, 0x32, 0xb5, 0x01, 0x5e,
+	     0x84, 0x7b, 0x56, 0xd3, 0x51, 0x13, 0x79, 0xf8, 0xcc, 0x79,
+	     0x82, 0x02, 0xb7, 0xa2, 0x47, 0xeb, 0xc6, 0xd2, 0x6b, 0x10,
+	     0x4b, 0x00, 0x00, 0xf8, 0x14, 0x84, 0x22, 0x46, 0x99, 0x75,
+	     0x4a, 0xcb, 0xe6, 0x9a, 0x72, 0xda, 0x35, 0x4f, 0x78, 0x91,
+	     0x00, 0x00, 0x45, 0x0d, 0x00, 0x20, 0xb3, 0xd7, 0xc1, 0x89,
+	     0xb8, 0x70, 0x08, 0xc8, 0x35, 0x67, 0xab, 0xe4, 0xe6, 0x79,
+	     0x04, 0x00, 0xb0, 0x20, 0xc4, 0x22, 0x01, 0x00, 0xe0, 0x49,
+	     0xd1, 0xc4, 0x5d, 0x9b, 0xef, 0xb0, 0x19, 0xf3, 0x90, 0x2c,
+	     0x50, 0x02, 0x00, 0x96, 0x61, 0x85, 0x43, 0xcc, 0xd2, 0xc2,
+	     0x41, 0xe9, 0xe7, 0xbe, 0x60, 0xeb, 0xed, 0x27, 0xcd, 0x5f,
+	     0x00, 0x00, 0x7b, 0x58, 0x5a, 0xcc, 0x1f, 0x08, 0x93, 0x80,
+	     0xe7, 0xfd, 0x71, 0x28, 0x52, 0x00, 0x80, 0xf4, 0x9e, 0x50,
+	     0x87, 0x86, 0xa3, 0x56, 0x50, 0x73, 0x50, 0x2d, 0x61, 0x34,
+	     0x00, 0x80, 0x39, 0xc6, 0xb0, 0x26, 0xed, 0x46, 0x84, 0xfc,
+	     0x1a, 0x95, 0x26, 0x1e, 0x23, 0xc2, 0x48, 0xf4, 0xdc, 0x7a,
+	     0x62, 0xdd, 0x35, 0xdc, 0x01, 0x00, 0x5c, 0x2c, 0x42, 0x0b,
+	     0x40, 0x2b, 0xcd, 0x19, 0x00, 0x00, 0x00, 0x10, 0x36, 0xd9,
+	     0xc9, 0x85, 0xe7, 0x00, 0x00, 0xcf, 0x2d, 0xaa, 0x99, 0x51,
+	     0xe6, 0xca, 0x02, 0x00, 0xa8, 0x15, 0xca, 0x16, 0x00, 0x00,
+	     0x6d, 0x0d, 0x00, 0xc0, 0x33, 0x41, 0xe1, 0x08, 0x00, 0xd8,
+	     0x9e, 0xec, 0x87, 0xa8, 0x55, 0xf6, 0x3d, 0xc1, 0x8a, 0xf0,
+	     0x00, 0x00, 0x30, 0x4e, 0xda, 0x02, 0x14, 0x13, 0x01, 0x00,
+	     0x75, 0x2d, 0x00, 0x00, 0x02, 0xe2, 0xfb, 0x04, 0x00, 0x80,
+	     0x3a, 0x16, 0x9e, 0xfa, 0x3f, 0x00, 0x00, 0x00, 0x80, 0x14,
+	     0x09, 0x00, 0xf0, 0x9b, 0x69, 0x7b, 0xcc, 0xcb, 0x56, 0x41,
+	     0xe6, 0x85, 0x40, 0x13, 0xfa, 0x10, 0x00, 0xb0, 0x33, 0x94,
+	     0x6a, 0xe4, 0x36, 0x95, 0x7b, 0x2b, 0x8c, 0x41, 0x01, 0x00,
+	     0x00, 0x61, 0x29, 0xab, 0x88, 0x0a, 0x36, 0xa9, 0x68, 0x31,
+	     0x00, 0x80, 0xf2, 0x5e, 0xeb, 0xc7, 0xbe, 0x37, 0xd5, 0x00,
+	     0x00, 0x5c, 0xfb, 0xe8, 0x54, 0x15, 0x45, 0xe3, 0x1f, 0x09,
+	     0x20, 0x5b, 0xd1, 0x8f, 0xfa, 0x10, 0x68, 0xeb, 0x5c, 0x79,
+	     0x70, 0x37, 0x00, 0x00, 0x7f, 0x01, 0xee, 0x20, 0x70, 0xa2,
+	     0x10, 0x42, 0xc9, 0xf2, 0x17, 0x9c, 0x04, 0xd5, 0x0d, 0xf4,
+	     0xad, 0xbd, 0x08, 0xd7, 0x7b, 0x91, 0xed, 0x51, 0x8a, 0x84,
+	     0xc7, 0x1b, 0x33, 0x4c, 0x55, 0x4d, 0xe3, 0x04, 0x75, 0x62,
+	     0x13, 0x00, 0x00, 0x48, 0x3a, 0xa9, 0xbc, 0x6b, 0x81, 0x6f,
+	     0x8e, 0xdd, 0x25, 0x16, 0x02, 0x00, 0xd0, 0x8c, 0x8e, 0x5c,
+	     0x29, 0x29, 0xce, 0x0b, 0x00, 0x20, 0x54, 0x23, 0x53, 0x63,
+	     0x43, 0x3e, 0x2a, 0x67, 0x58, 0xb9, 0x97, 0x09, 0xd8, 0x67,
+	     0x28, 0xc8, 0x71, 0x87, 0x11, 0x3a, 0xf8, 0x39, 0x1e, 0x81,
+	     0xfb, 0xb0, 0x27, 0x16, 0x37, 0x13, 0x19, 0x33, 0xab, 0x01,
+	     0x00, 0xf4, 0x17, 0x01, 0x00, 0x3e, 0x25, 0x00, 0xc0, 0xad,
+	     0x67, 0xea, 0x24, 0xea, 0xd0, 0xd1, 0x04, 0xf8, 0xfa, 0x6a,
+	     0xcd, 0x07, 0x00, 0x00, 0x5b, 0x2b, 0xf3, 0x08, 0x79, 0x0c,
+	     0xf4, 0xa1, 0x99, 0x1e, 0x7c, 0xe9, 0x31, 0x26, 0xcc, 0xff,
+	     0xe8, 0x24, 0x69, 0x13, 0x01, 0x00, 0x68, 0xbf, 0xf2, 0x15,
+	     0xb1, 0x12, 0x33, 0x46, 0xba, 0x4f, 0xc4, 0xa5, 0x96, 0xec,
+	     0x01, 0xd2, 0x73, 0xa6, 0x2f, 0x8b, 0x3b, 0x00, 0x40, 0xce,
+	     0xce, 0xc8, 0x51, 0x5e, 0x00, 0x00, 0xb8, 0x8c, 0x48, 0x98,
+	     0x00, 0x80, 0x8f, 0x96, 0xb5, 0x90, 0xe5, 0xe2, 0x45, 0xfa,
+	     0x62, 0xf8, 0x31, 0x91, 0x25, 0x92, 0x4b, 0xf0, 0xc7, 0xb8,
+	     0xea, 0x7f, 0x47, 0x36, 0x03, 0x00, 0xc4, 0xcf, 0x54, 0x75,
+	     0x81, 0x07, 0x58, 0x49, 0x1e, 0x2a, 0xac, 0x84, 0x21, 0xf3,
+	     0x40, 0x10, 0x5f, 0x34, 0x6e, 0xf5, 0x4a, 0x51, 0x49, 0x2c,
+	     0x65, 0xa9, 0x57, 0x72, 0x01, 0x00, 0xd4, 0x32, 0x00, 0x00,
+	     0x66, 0x47, 0x00, 0x00, 0x00, 0x60, 0x20, 0x01, 0x00, 0x48,
+	     0xcf, 0x01, 0x00, 0xd0, 0x1d, 0x4f, 0x48, 0x97, 0xa4, 0xf9,
+	     0x4f, 0x28, 0x36, 0xbd, 0xa2, 0x16, 0x58, 0x4f, 0xb4, 0x42,
+	     0x00, 0x80, 0xeb, 0x8f, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x20,
+	     0x06, 0xcd, 0x84, 0x10, 0x5f, 0x61, 0x2e, 0x00, 0xc0, 0xfb,
+	     0xa7, 0xb9, 0x08, 0x00, 0x38, 0xe3, 0xb0, 0xff, 0xf8, 0x7b,
+	     0x00, 0x00, 0x52, 0x9a, 0xd3, 0x01, 0x00, 0x10, 0x8b, 0xe3,
+	     0x9b, 0x00, 0x00, 0x7c, 0x04, 0xf2, 0x36, 0x00, 0x80, 0x8f,
+	     0x4c, 0x39, 0xb0, 0xc4, 0x00, 0x00, 0xc0, 0xc5, 0xae, 0x42,
+	     0xee, 0x02, 0x00, 0x00, 0x74, 0x11, 0x00, 0x90, 0x13, 0xf8,
+	     0xd9, 0x00, 0x00, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x80, 0x4f,
+	     0x0a, 0x00, 0x50, 0x10, 0x03, 0x00, 0x7c, 0xa6, 0x72, 0x5e,
+	     0x95, 0x15, 0x00, 0x40, 0x02, 0x13, 0x00, 0x00, 0x00, 0x58,
+	     0x2a, 0x01, 0x00, 0xdc, 0x57, 0x7f, 0x8f, 0x82, 0x80, 0x02,
+	     0x05, 0xe7, 0xa5, 0x12, 0x00, 0x00, 0xb0, 0x45, 0x5e, 0x93,
+	     0x61, 0x49, 0xe3, 0xe6, 0xdb, 0x90, 0xab, 0x79, 0xed, 0x03,
+	     0x00, 0xc0, 0xba, 0xd2, 0x22, 0xbb, 0x1a, 0x52, 0x8a, 0xf1,
+	     0x2d, 0xad, 0xd4, 0x12, 0xc8, 0x87, 0x01, 0x00, 0x22, 0x8b,
+	     0x00, 0x00, 0x00, 0x80, 0x3f, 0x52, 0xac, 0x38, 0xd6, 0xac,
+	     0x72, 0x25, 0x77, 0x00, 0x00, 0xf5, 0x86, 0x85, 0x15, 0x00,
+	     0x40, 0xaa, 0x02, 0x00, 0x78, 0x3b, 0x74, 0x0f, 0x07, 0x1a,
+	     0xbb, 0x38, 0xb9, 0x4a, 0x96, 0xaf, 0xf2, 0xe8, 0x28, 0x5b,
+	     0x3c, 0x02, 0x00, 0x9e, 0x51, 0x7e, 0x9d, 0x21, 0x05, 0x00,
+	     0x80, 0xa5, 0xe9, 0x01, 0xc4, 0x68, 0x3e, 0xdd, 0x7a, 0x4d,
+	     0xd1, 0xa2, 0x77, 0x15, 0x00, 0x60, 0xae, 0x43, 0xf2, 0xa2,
+	     0x8a, 0xb8, 0x25, 0x9c, 0x4d, 0x00, 0x00, 0x1a, 0xc4, 0x67,
+	     0x2c, 0x7a, 0x07, 0x00, 0x48, 0xef, 0x69, 0x01, 0x29, 0x55,
+	     0x90, 0x25, 0x3c, 0x4c, 0xfa, 0xc7, 0x5b, 0x32, 0x69, 0x8a,
+	     0xaf, 0x7c, 0xa6, 0x50, 0x8f, 0xbc, 0xbd, 0x34, 0x0a, 0x92,
+	     0x4b, 0x4a, 0x07, 0x00, 0xa0, 0x6f, 0xd5, 0x75, 0x32, 0x82,
+	     0x00, 0x80, 0x37, 0x08, 0x32, 0xe8, 0x27, 0x19, 0xbe, 0x21,
+	     0x25, 0x0e, 0x5c, 0x5a, 0x31, 0x90, 0xa0, 0x1a, 0x1f, 0x65,
+	     0x11, 0x76, 0x07, 0x00, 0xc0, 0x2d, 0xe4, 0x1b, 0x36, 0x5c,
+	     0x89, 0x36, 0xf5, 0xc4, 0x6a, 0x30, 0x61, 0xa7, 0xd0, 0x18,
+	     0x15, 0x8a, 0x72, 0x18, 0x02, 0x00, 0x00, 0x6d, 0x88, 0xe2,
+	     0x90, 0xce, 0xa3, 0xd1, 0x7b, 0x47, 0x9e, 0xc6, 0xb6, 0x98,
+	     0xd4, 0x1d, 0x8b, 0x8a, 0x22, 0xe2, 0x1d, 0x24, 0x79, 0x00,
+	     0x60, 0x00, 0x00, 0x24, 0x00, 0x64, 0xb1, 0x75, 0xd1, 0x27,
+	     0x0c, 0x00, 0x40, 0x77, 0x22, 0x2d, 0x19, 0x2d, 0x33, 0x49,
+	     0xb2, 0x99, 0xaa, 0x5d, 0x2b, 0x88, 0x5a, 0x08, 0x00, 0x10,
+	     0x47, 0x9c, 0x81, 0x46, 0x1c, 0x48, 0x22, 0xae, 0x25, 0x18,
+	     0x91, 0xa5, 0x30, 0x5a, 0xa1, 0x55, 0xa5, 0xa7, 0x32, 0x36,
+	     0xe7, 0x02, 0x00, 0x00, 0x00, 0xc0, 0x7a, 0x08, 0x00, 0xa0,
+	     0x33, 0x5d, 0x5c, 0x60, 0x97, 0x18, 0x1a, 0x00, 0xc0, 0x1a,
+	     0x2e, 0xbc, 0xf4, 0x07, 0x59, 0x2b, 0x9a, 0x68, 0x74, 0x21,
+	     0xbd, 0x2f, 0x57, 0x17, 0xb0, 0x22, 0xb5, 0x78, 0xe7, 0x71,
+	     0x6a, 0x28, 0xbf, 0x8a, 0x79, 0x42, 0x13, 0x76, 0xca, 0x02,
+	     0x03, 0x99, 0x25, 0x6a, 0xb9, 0x08, 0x26, 0x94, 0xae, 0x7b,
+	     0x73, 0xa9, 0xf1, 0x80, 0x78, 0x2e, 0x7d, 0x11, 0x39, 0xc8,
+	     0x90, 0xe0, 0x4e, 0x86, 0x94, 0x00, 0x80, 0x60, 0x1a, 0xac,
+	     0xa0, 0x7c, 0x32, 0x42, 0xa0, 0x25, 0x88, 0xd9, 0x00, 0x00,
+	     0xe0, 0xa8, 0xec, 0x57, 0x46, 0x46, 0x02, 0x41, 0xe8, 0x5a,
+	     0x4f, 0xa4, 0xdf, 0x00, 0x00, 0x7f, 0x12, 0x0a, 0x21, 0x00,
+	     0x00, 0x00, 0x90, 0xc0, 0x3a, 0xd1, 0x74, 0x27, 0x00, 0x00,
+	     0x00, 0x80, 0xbc, 0x15, 0xa5, 0x6b, 0x46, 0x98, 0x2d, 0x3c,
+	     0x13, 0x41, 0x1d, 0x76, 0x85, 0xdd, 0x3e, 0x6e, 0xd2, 0x13,
+	     0x48, 0x27, 0x23, 0x93, 0x19, 0xe2, 0xfd, 0xca, 0xf6, 0x27,
+	     0x64, 0xa8, 0x8e, 0x59, 0xb2, 0x82, 0xc9, 0xf1, 0x80, 0xc1,
+	     0x76, 0x85, 0x5e, 0x00, 0x00, 0xd8, 0x9d, 0xd8, 0x1f, 0x00,
+	     0xe0, 0xd1, 0x13, 0xa9, 0x00, 0x00, 0x98, 0x56, 0xec, 0x41,
+	     0x99, 0xab, 0xd6, 0xc1, 0x75, 0xec, 0xe6, 0xa6, 0x50, 0x9a,
+	     0xee, 0xd9, 0xbe, 0x54, 0x1f, 0x25, 0x36, 0x00, 0x40, 0xeb,
+	     0x03, 0xa8, 0x73, 0xd6, 0xb2, 0x79, 0x6c, 0x0d, 0x00, 0x00,
+	     0xf6, 0x26, 0x00, 0x80, 0x07, 0x42, 0x55, 0x56, 0x4f, 0x00,
+	     0x00, 0xfc, 0x0f, 0x2e, 0x0e, 0x2d, 0xab, 0x7f, 0xd9, 0x51,
+	     0x01, 0x00, 0xb0, 0xbc, 0xfb, 0x0a, 0x01, 0x00, 0x00, 0x00,
+	     0x3a, 0x80, 0x6f, 0x95, 0x3d, 0x70, 0x00, 0x00, 0xf9, 0x12,
+	     0x37, 0xd4, 0x74, 0x00, 0x00, 0x00, 0x80, 0x37, 0x87, 0xb8,
+	     0x50, 0x33, 0xe9, 0x0b, 0x04, 0x00, 0x90, 0x2b, 0x77, 0x6b,
+	     0xd3, 0x44, 0x1c, 0x07, 0x53, 0x8d, 0x20, 0x65, 0x2f, 0xba,
+	     0x40, 0x39, 0xd1, 0x00, 0x00, 0xd9, 0xa2, 0x1f, 0x43, 0x40,
+	     0x6a, 0x23, 0xa9, 0xe3, 0x20, 0xce, 0x09, 0xd9, 0x26, 0x6f,
+	     0x00, 0x00, 0x8a, 0xe0, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0xb2, 0x2a, 0xf3, 0x89, 0xd0, 0xd2, 0x8a,
+	     0x0e, 0x00, 0xf0, 0x16, 0x68, 0x9e, 0x19, 0x0f, 0x95, 0x06,
+	     0x03, 0x44, 0xde, 0xcc, 0x39, 0x0f, 0xfb, 0x00, 0x00, 0xe8,
+	     0x73, 0x94, 0xe7, 0xac, 0x96, 0xde, 0x1e, 0x43, 0x99, 0xad,
+	     0xcd, 0x39, 0x01, 0xca, 0x24, 0x4e, 0xc4, 0x88, 0x00, 0x00,
+	     0x84, 0x36, 0xb9, 0x8b, 0xac, 0x85, 0xa9, 0x28, 0x9f, 0x61,
+	     0x25, 0xd4, 0xfe, 0xd2, 0x3d, 0xc7, 0x13, 0x00, 0x80, 0x0f,
+	     0xb2, 0x8d, 0x38, 0x52, 0x03, 0x00, 0x28, 0x87, 0x0a, 0x7b,
+	     0xfe, 0xa8, 0xb0, 0x47, 0xc1, 0x48, 0xc8, 0x75, 0x2b, 0x02,
+	     0x00, 0x00, 0x00, 0x14, 0x49, 0x55, 0x25, 0xd8, 0x24, 0x00,
+	     0x80, 0x92, 0x52, 0x19, 0x88, 0xb4, 0x08, 0xe3, 0x3e, 0x4b,
+	     0x10, 0x0a, 0x00, 0x80, 0xe0, 0x12, 0x00, 0x60, 0x70, 0x84,
+	     0xaf, 0xd8, 0xea, 0xe2, 0x96, 0xb7, 0x19, 0x4e, 0x46, 0xb3,
+	     0x00, 0x00, 0x10, 0x5c, 0x03, 0x00, 0x64, 0x14, 0xe4, 0x4f,
+	     0x53, 0x34, 0x11, 0x03, 0xa8, 0x6c, 0x5e, 0x48, 0x2f, 0x3b,
+	     0x26, 0x3c, 0x36, 0xd8, 0x47, 0x26, 0x90, 0xaa, 0x8c, 0xda,
+	     0x0c, 0x9f, 0xc7, 0xcc, 0x22, 0x23, 0x02, 0x00, 0xde, 0x4f,
+	     0x1a, 0xbc, 0x30, 0x90, 0x99, 0x4f, 0x15, 0x07, 0x00, 0x78,
+	     0x36, 0x4d, 0x18, 0x93, 0x6e, 0xae, 0x8b, 0xfe, 0x92, 0x7e,
+	     0xc5, 0x73, 0x42, 0x45, 0x13, 0x0e, 0x4d, 0x13, 0x45, 0x13,
+	     0x9d, 0x84, 0x34, 0x12, 0x3f, 0xea, 0x3a, 0x08, 0x00, 0x50,
+	     0x19, 0x86, 0x49, 0x92, 0x39, 0x7e, 0x88, 0x79, 0x24, 0xd6,
+	     0x4a, 0xe4, 0x18, 0x0f, 0x2a, 0xc6, 0x01, 0x00, 0x00, 0x00,
+	     0x3e, 0x89, 0x26, 0x93, 0xff, 0x49, 0x77, 0xc9, 0x92, 0x00,
+	     0x00, 0x00, 0x00, 0xde, 0x2d, 0xda, 0x09, 0x1d, 0xde, 0x46,
+	     0x32, 0x47, 0xc3, 0x54, 0x18, 0x63, 0x6c, 0x98, 0x10, 0x43,
+	     0x52, 0x22, 0x5b, 0x49, 0x9b, 0x07, 0xd7, 0x07, 0xe3, 0xea,
+	     0x60, 0x91, 0x2b, 0x95, 0x35, 0x98, 0x3c, 0xcd, 0xdc, 0x90,
+	     0x07, 0xda, 0x00, 0x00, 0xb0, 0x93, 0x05, 0x78, 0x52, 0x46,
+	     0xc6, 0x35, 0x00, 0x00, 0x57, 0x33, 0x98, 0x56, 0x4f, 0x24,
+	     0xe7, 0x2d, 0x78, 0x66, 0x2d, 0x00, 0x00, 0xd5, 0x22, 0xbb,
+	     0xa6, 0xd3, 0xa4, 0xb8, 0x4b, 0xff, 0x10, 0x94, 0xd8, 0x8a,
+	     0x41, 0xbc, 0x54, 0x83, 0xc3, 0x66, 0x76, 0xf8, 0x11, 0x7a,
+	     0xad, 0x69, 0xcb, 0xb0, 0x31, 0x00, 0x80, 0xe7, 0x03, 0x00,
+	     0x00, 0x00, 0x90, 0x96, 0x03, 0x00, 0x70, 0x11, 0xd0, 0x0c,
+	     0xf8, 0x26, 0x92, 0x40, 0x77, 0xb1, 0xdd, 0xe1, 0x69, 0x20,
+	     0xf0, 0x9c, 0x05, 0x00, 0x00, 0x4d, 0xae, 0x43, 0x61, 0xc3,
+	     0x64, 0x8b, 0xa9, 0x9e, 0x93, 0x62, 0x8d, 0x41, 0x50, 0x46,
+	     0x70, 0x84, 0x60, 0xc2, 0xf1, 0xc0, 0xfd, 0x28, 0x93, 0x4c,
+	     0x04, 0x2c, 0x86, 0x0e, 0x8a, 0x00, 0x00, 0xaa, 0x14, 0x00,
+	     0x60, 0x6c, 0x78, 0xa2, 0x03, 0x00, 0x00, 0x00, 0x06, 0x39,
+	     0x64, 0x1b, 0x01, 0xc9, 0xc1, 0x8c, 0x21, 0xd4, 0xfe, 0x11,
+	     0xfd, 0xbd, 0x2d, 0x44, 0x8c, 0x41, 0x0a, 0x87, 0xd9, 0x83,
+	     0x72, 0xa4, 0x01, 0x00, 0x40, 0x4e, 0xee, 0xf8, 0x16, 0x8e,
+	     0xec, 0xcb, 0x11, 0x23, 0xf4, 0x29, 0x14, 0x09, 0x75, 0x3b,
+	     0x7b, 0xbc, 0xda, 0x00, 0x00, 0xd5, 0xaa, 0x1d, 0x0b, 0x00,
+	     0x00, 0x00, 0x70, 0xc8, 0x92, 0xc7, 0x00, 0x17, 0x01, 0x00,
+	     0x3d, 0x47, 0x00, 0x80, 0xea, 0x67, 0x87, 0x03, 0x00, 0xd0,
+	     0x0e, 0xe9, 0xe8, 0x50, 0x80, 0x5e, 0x91, 0x03, 0x9d, 0xe4,
+	     0x6f, 0xb0, 0x25, 0x03, 0x30, 0x49, 0x82, 0x47, 0xd4, 0x1a,
+	     0xc2, 0x8e, 0x2c, 0x62, 0x99, 0xe1, 0x9c, 0xd2, 0x78, 0xcc,
+	     0x62, 0xd4, 0x07, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x59, 0xad,
+	     0xc2, 0xc2, 0xb4, 0xba, 0x9b, 0x68, 0x90, 0xc7, 0xc0, 0x21,
+	     0x00, 0x80, 0x30, 0x14, 0x00, 0x80, 0x81, 0xc3, 0xc6, 0x13,
+	     0xdd, 0xa8, 0x1e, 0x4b, 0x1c, 0x1b, 0x20, 0xe6, 0x04, 0x75,
+	     0x0f, 0x98, 0x08, 0x7e, 0xec, 0xc5, 0x21, 0x6f, 0xa0, 0x0e,
+	     0xe0, 0x97, 0x44, 0x13, 0x14, 0x00, 0x00, 0xc0, 0x59, 0xdc,
+	     0x5f, 0x00, 0x00, 0x8e, 0x88, 0xdb, 0x0e, 0x2e, 0x0d, 0x0c,
+	     0x8f, 0xb9, 0x37, 0xbb, 0x39, 0x54, 0xd4, 0x80, 0x76, 0x57,
+	     0x80, 0xb7, 0x39, 0x66, 0x29, 0x0c, 0x38, 0x05, 0x00, 0x98,
+	     0x56, 0xf6, 0x17, 0x6d, 0x5a, 0x74, 0x18, 0xf5, 0x5c, 0xc5,
+	     0xa6, 0x14, 0x52, 0x1c, 0x70, 0x79, 0x8c, 0x02, 0x77, 0x6d,
+	     0x00, 0x00, 0x00, 0x00, 0x72, 0xcd, 0x18, 0xd3, 0x23, 0x3a,
+	     0x2e, 0xc6, 0xc3, 0x6c, 0x09, 0xca, 0x43, 0xe7, 0x26, 0x14,
+	     0xe3, 0xd7, 0x48, 0xf4, 0x6b, 0x1e, 0x4d, 0x38, 0x79, 0x0a,
+	     0xc5, 0xc9, 0xdd, 0x05, 0x00, 0xc0, 0x7d, 0x38, 0xc0, 0x00,
+	     0x00, 0x1c, 0xc5, 0xb4, 0x3a, 0x85, 0x3e, 0x00, 0xc0, 0x41,
+	     0x08, 0x93, 0x01, 0x00, 0xa0, 0xf9, 0x68, 0x23, 0x0e, 0x87,
+	     0x5b, 0x01, 0xc3, 0x48, 0x52, 0xab, 0x7f, 0x75, 0xa2, 0x3c,
+	     0xf6, 0xc9, 0x5d, 0x82, 0x85, 0xed, 0x3c, 0x00, 0xc0, 0x16,
+	     0x02, 0x70, 0x34, 0x4e, 0x13, 0xa1, 0xd9, 0x53, 0xb8, 0x25,
+	     0x30, 0xbf, 0x1d, 0x64, 0x24, 0xa6, 0x11, 0x62, 0xe3, 0xcb,
+	     0x2f, 0x99, 0xcb, 0xca, 0x23, 0x00, 0x00, 0x82, 0xc5, 0x2f,
+	     0x69, 0xef, 0x27, 0xf0, 0x11, 0x21, 0xa6, 0x55, 0x66, 0x73,
+	     0x0c, 0xa1, 0x70, 0x83, 0x5e, 0xa6, 0xe0, 0x24, 0x68, 0x48,
+	     0x6f, 0x72, 0xfc, 0x00, 0x00, 0x9a, 0x00, 0xe1, 0xc4, 0x87,
+	     0xc5, 0xa0, 0x08, 0xdb, 0xc1, 0xba, 0x64, 0x81, 0xa8, 0x23,
+	     0x00, 0x00, 0x00, 0x00, 0x7c, 0x49, 0x53, 0x16, 0xd5, 0x01,
+	     0x00, 0x04, 0xac, 0x40, 0x57, 0x87, 0x8c, 0x11, 0x00, 0x00,
+	     0x80, 0xd6, 0x08, 0x00, 0x10, 0x1b, 0xdc, 0x2f, 0xce, 0x44,
+	     0x00, 0x80, 0x33, 0x22, 0x00, 0xc0, 0xa5, 0x58, 0x4a, 0x2a,
+	     0x54, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xa5, 0xbd, 0x1b, 0x00,
+	     0xe0, 0x85, 0x59, 0xeb, 0x02, 0x00, 0x00, 0x00, 0x78, 0x97,
+	     0x61, 0x8a, 0xe3, 0x86, 0x53, 0x61, 0x95, 0x04, 0x00, 0x00,
+	     0x00, 0x44, 0x43, 0xd4, 0x48, 0x97, 0x11, 0x00, 0x00, 0xa5,
+	     0xb2, 0x76, 0x01, 0x00, 0x50, 0x43, 0x40, 0xc8, 0x78, 0x6b,
+	     0x00, 0x00, 0x23, 0x8a, 0xd2, 0xca, 0x9d, 0x91, 0x1d, 0x1b,
+	     0xb2, 0x31, 0x00, 0xce, 0x6f, 0x00, 0x00, 0x4d, 0xdf, 0x00,
+	     0x45, 0x95, 0x02, 0x00, 0xd0, 0x94, 0x54, 0x06, 0x8e, 0x7f,
+	     0x56, 0x0c, 0x00, 0x00, 0x0e, 0x0c, 0x00, 0x20, 0x6a, 0x5b,
+	     0x8e, 0x30, 0xf5, 0x6c, 0x21, 0x14, 0x02, 0x00, 0x40, 0x0e,
+	     0x11, 0x04, 0x20, 0x7b, 0x5b, 0x25, 0xde, 0x1a, 0x01, 0x00,
+	     0x18, 0x01, 0x54, 0x82, 0x1d, 0xa9, 0x3e, 0xd1, 0x3c, 0xe3,
+	     0x5f, 0x0d, 0x56, 0x00, 0x00, 0xc2, 0xa1, 0x40, 0x85, 0x9a,
+	     0xb1, 0xf1, 0xa6, 0x17, 0xdc, 0xbe, 0x01, 0x00, 0xd0, 0x76,
+	     0x00, 0x80, 0x45, 0x06, 0x00, 0xc0, 0xfa, 0xd6, 0x2c, 0x04,
+	     0x00, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x7a,
+	     0x0e, 0x00, 0x00, 0x00, 0xb0, 0x27, 0x8a, 0xba, 0xae, 0x0e,
+	     0x00, 0x80, 0x9e, 0xa0, 0x9c, 0xcd, 0x9c, 0x67, 0xa3, 0x79,
+	     0x9d, 0x48, 0x5f, 0x58, 0x2d, 0xe5, 0x90, 0x6b, 0x49, 0xfb,
+	     0xb2, 0x58, 0x42, 0xce, 0x24, 0xa1, 0x3c, 0xc2, 0x96, 0x19,
+	     0x3c, 0x49, 0x17, 0x8e, 0x09, 0xf2, 0x81, 0x03, 0x00, 0x00,
+	     0x00, 0xf8, 0xa8, 0x42, 0x10, 0x00, 0x00, 0xe3, 0xce, 0x91,
+	     0x07, 0xcc, 0x21, 0xe8, 0x33, 0x19, 0x90, 0x8a, 0x6c, 0x01,
+	     0x3d, 0x46, 0x65, 0x17, 0xc1, 0x2a, 0xe8, 0x17, 0xed, 0x49,
+	     0x32, 0x36, 0x16, 0xf9, 0x1c, 0xa2, 0x42, 0x6a, 0x49, 0x27,
+	     0xe2, 0x14, 0x34, 0x13, 0x14, 0xfd, 0x7c, 0x6d, 0x7a, 0x8d,
+	     0xca, 0x84, 0xe2, 0x21, 0x00, 0x60, 0x6e, 0x03, 0x00, 0xb8,
+	     0x8f, 0x5c, 0xd1, 0x00, 0x00, 0xd0, 0x96, 0x26, 0xa2, 0x09,
+	     0x70, 0x56, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x89,
+	     0x5a, 0xaa, 0x6d, 0x18, 0xde, 0x21, 0xf0, 0x90, 0x05, 0x82,
+	     0x07, 0x7d, 0xfa, 0x00, 0x00, 0x4b, 0x43, 0x44, 0x40, 0xbf,
+	     0x6d, 0x70, 0x47, 0x16, 0x78, 0x24, 0x56, 0x20, 0xab, 0x7b,
+	     0x0c, 0x0c, 0x03, 0x08, 0x00, 0x20, 0x81, 0xf6, 0xe1, 0xcc,
+	     0x31, 0x00, 0x00, 0x50, 0x07, 0x19, 0xa9, 0x1b, 0x18, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0xb0, 0x60, 0xe8, 0x85, 0x96, 0x76,
+	     0x00, 0x80, 0x7b, 0x63, 0x78, 0xe7, 0x2a, 0x60, 0xcb, 0xbb,
+	     0xa5, 0x75, 0x3e, 0xd8, 0x09, 0x3b, 0xcc, 0x3b, 0x22, 0x00,
+	     0xa0, 0xd5, 0xa6, 0xb0, 0x03, 0x00, 0xb4, 0x31, 0x89, 0x30,
+	     0xe5, 0xca, 0xb1, 0x1f, 0x00, 0xa0, 0x7c, 0x06, 0x07, 0x20,
+	     0x53, 0x02, 0x00, 0x0a, 0x54, 0x67, 0xa1, 0x86, 0xcf, 0x02,
+	     0x92, 0x4e, 0x08, 0x6e, 0x32, 0x4c, 0x75, 0x92, 0x00, 0x00,
+	     0x65, 0x2c, 0x00, 0x00, 0x0a, 0x08, 0x00, 0x00, 0x00, 0xb8,
+	     0x69, 0xe1, 0x37, 0x01, 0x00, 0x35, 0x00, 0x8a, 0x89, 0x54,
+	     0x43, 0x4a, 0x03, 0x00, 0x70, 0x88, 0x94, 0x67, 0x92, 0x70,
+	     0xbd, 0x8f, 0x6d, 0xe5, 0x6b, 0x2d, 0xcd, 0x58, 0x7b, 0xdb,
+	     0x50, 0x4e, 0x88, 0xf8, 0x1f, 0xe8, 0x2b, 0x0a, 0x02, 0x00,
+	     0x40, 0xd0, 0x25, 0x27, 0x9a, 0x19, 0xea, 0x11, 0x91, 0x54,
+	     0x03, 0x4b, 0x00, 0x00, 0xa2, 0xa9, 0x64, 0x49, 0x62, 0x7c,
+	     0xeb, 0x01, 0x00, 0x2a, 0x8d, 0x83, 0xba, 0x4c, 0x22, 0x00,
+	     0xc0, 0x44, 0x78, 0xaa, 0x58, 0x73, 0x9d, 0x34, 0xda, 0x1c,
+	     0xd4, 0x33, 0x00, 0x00, 0x00, 0x20, 0xc8, 0xe4, 0x9a, 0x11,
+	     0x4b, 0x4e, 0xbb, 0xa0, 0x4f, 0xf8, 0xb4, 0x1d, 0xc8, 0x24,
+	     0x8a, 0x90, 0xc2, 0x3b, 0x4b, 0x7f, 0xe9, 0xae, 0xb6, 0x96,
+	     0x00, 0x00, 0x00, 0x40, 0x3d, 0x10, 0x98, 0x74, 0x2c, 0x14,
+	     0x25, 0x0e, 0x48, 0xa8, 0x01, 0x00, 0x00, 0x51, 0xe5, 0xbb,
+	     0x69, 0xbc, 0x53, 0x33, 0xb9, 0x65, 0xdd, 0xd4, 0x00, 0x00,
+	     0x98, 0x4b, 0xdf, 0x0a, 0xef, 0x49, 0x11, 0x69, 0x7b, 0x0c,
+	     0xd4, 0x01, 0x00, 0x32, 0x8c, 0xf7, 0x96, 0x55, 0xa2, 0xfe,
+	     0xec, 0xd8, 0x08, 0x00, 0x70, 0x40, 0x10, 0xee, 0x36, 0x77,
+	     0x52, 0x24, 0x00, 0x00, 0x00, 0x40, 0x2b, 0x61, 0xee, 0xda,
+	     0x6d, 0x00, 0x00, 0x3e, 0x98, 0xf4, 0x1d, 0x79, 0x1c, 0x1e,
+	     0x51, 0xff, 0x02, 0x22, 0x18, 0x93, 0x00, 0x00, 0x16, 0x91,
+	     0x64, 0x84, 0x0a, 0x04, 0x00, 0x60, 0xe7, 0x04, 0x00, 0xe0,
+	     0x40, 0x6c, 0x3a, 0xf6, 0x36, 0x00, 0x00, 0x61, 0xe2, 0xfb,
+	     0x29, 0xad, 0x16, 0x5f, 0xfb, 0x4d, 0x05, 0xe1, 0x00, 0x00,
+	     0xe4, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	     0x35, 0xd8, 0x85, 0x8a, 0x95, 0x00, 0x00, 0xd1, 0x95, 0x1b,
+	     0x08, 0x00, 0x00, 0x00, 0x78, 0x48, 0x12, 0x80, 0x5e, 0x52,
+	     0x17, 0xb1, 0xd0, 0x0f, 0x37, 0x05, 0x00, 0xd0, 0xca, 0x92,
+	     0x0e, 0x04, 0x0c, 0x63, 0x8f, 0x00, 0x80, 0x5d, 0x5c, 0x60,
+	     0x41, 0x2c, 0xd4, 0xd9, 0x91, 0xca, 0x00, 0x00, 0xce, 0x9b,
+	     0xff, 0x8d, 0x46, 0x80, 0xe2, 0xa0, 0x7d, 0xd4, 0xff, 0xb3,
+	     0x11, 0xd0, 0x80, 0x4a, 0x61, 0xa4, 0x8d, 0x83, 0xe5, 0x3e,
+	     0x4a, 0x17, 0x52, 0xb4, 0xc8, 0xfd, 0x01, 0x00, 0x82, 0x41,
+	     0xdc, 0x94, 0x8f, 0x60, 0xa7, 0x8c, 0x25, 0x01, 0x00, 0xc8,
+	     0x5b, 0x31, 0xb1, 0xae, 0x3f, 0xab, 0x39, 0x00, 0x40, 0xa3,
+	     0x49, 0x68, 0x22, 0x61, 0x20, 0x8c, 0x00, 0x00, 0x5e, 0x11,
+	     0x00, 0x00, 0x34, 0x0d, 0x00, 0x00, 0xd3, 0x77, 0xda, 0xeb,
+	     0x3c, 0x41, 0x8f, 0x9a, 0x93, 0xf1, 0x3d, 0xb9, 0x66, 0x32,
+	     0xe0, 0xf9, 0xf1, 0x76, 0x83, 0xdc, 0xb5, 0xe5, 0x00, 0x00,
+	     0x47, 0x35, 0x1e, 0x19, 0xdf, 0xab, 0x9b, 0x06, 0x00, 0x38,
+	     0xb2, 0xa8, 0x04, 0x28, 0x06, 0x61, 0x49, 0xc9, 0x02, 0x00,
+	     0x80, 0x56, 0x48, 0x0c, 0x4a, 0x9b, 0x9d, 0x71, 0x98, 0x62,
+	     0x05, 0x43, 0x3f, 0x62, 0xc3, 0xcb, 0x6f, 0xf1, 0x97, 0x7c,
+	     0x03, 0x02, 0x00, 0x5e, 0x95, 0x02, 0x89, 0x9d, 0x0c, 0x33,
+	     0xce, 0x45, 0x83, 0x26, 0x83, 0x2c, 0x00, 0x00, 0x96, 0x5d,
+	     0x6c, 0x3c, 0xac, 0xc8, 0xeb, 0x04, 0x2b, 0xa0, 0x3d, 0xaa,
+	     0x1d, 0x22, 0xa8, 0x68, 0x50, 0x93, 0x89, 0x5b, 0x02, 0x00,
+	     0x00, 0x00, 0x30, 0x91, 0x3b, 0x0b, 0x00, 0x00, 0x06, 0x53,
+	     0x8b, 0x47, 0xa2, 0x19, 0x00, 0x00, 0x00, 0x10, 0xb6, 0x03,
+	     0x00, 0xac, 0xe7, 0x22, 0x01, 0x00, 0x00, 0x00, 0x40, 0xfc,
+	     0x8d, 0x9a, 0x77, 0xa6, 0x01, 0x00, 0x00, 0x00, 0xca, 0x39,
+	     0xb4, 0x0d, 0x00, 0x80, 0x23, 0xd2, 0x22, 0x06, 0x00, 0xf0,
+	     0x67, 0xb5, 0x6d, 0xee, 0x75, 0x22, 0xa1, 0x0a, 0x5f, 0xbf,
+	     0xc0, 0xd9, 0x91, 0xf2, 0x19, 0x5b, 0xf8, 0x39, 0x02, 0x26,
+	     0xbd, 0x3c, 0x66, 0x48, 0xd3, 0x12, 0x00, 0x00, 0x00, 0x88,
+	     0xb3, 0x30, 0x25, 0x96, 0x5c, 0x69, 0x95, 0x5f, 0x1d, 0x00,
+	     0x20, 0xbe, 0x73, 0x4a, 0x62, 0x26, 0xe6, 0x8f, 0xea, 0x0f,
+	     0xd0, 0xa1, 0x17, 0x88, 0xdb, 0xb1, 0x0b, 0x56, 0xf8, 0xca,
+	     0x05, 0x7d, 0xc0, 0xe8, 0x65, 0x7d, 0x3b, 0xcc, 0x92, 0xba,
+	     0x30, 0xa5, 0x80, 0x97, 0xb2, 0xba, 0x01, 0x00, 0xe0, 0x1b,
+	     0x3c, 0x80, 0x8e, 0x88, 0x93, 0x10, 0x45, 0x03, 0x00, 0x00,
+	     0x00, 0x68, 0x0e, 0x8c, 0x83, 0x00, 0x80, 0x9b, 0xcf, 0x0b,
+	     0x73, 0x05, 0x04, 0x00, 0x60, 0xe2, 0xb1, 0xa6, 0xbe, 0x24,
+	     0x4f, 0x14, 0x00, 0x40, 0x48, 0xc9, 0xee, 0x02, 0x41, 0x9a,
+	     0x68, 0xae, 0x00, 0xc8, 0x51, 0x0f, 0x9b, 0xe5, 0xcf, 0xe0,
+	     0x12, 0x00, 0xe0, 0x6d, 0xe8, 0x8c, 0x00, 0x00, 0x84, 0x93,
+	     0xa1, 0x9a, 0x0c, 0x46, 0x5f, 0x43, 0x52, 0x49, 0x41, 0x5c,
+	     0x2a, 0x76, 0x9f, 0xfa, 0x2d, 0x53, 0x3e, 0xae, 0xce, 0xae,
+	     0xc9, 0x2a, 0x08, 0x34, 0x62, 0x85, 0xa8, 0x76, 0xf0, 0x3a,
+	     0xa1, 0xbf, 0x40, 0xca, 0xb5, 0x70, 0xfe, 0x04, 0x00, 0x30,
+	     0xad, 0x65, 0x06, 0xbe, 0x00, 0x39, 0xa2, 0xfe, 0x0f, 0x00,
+	     0x20, 0xe2, 0x57, 0x06, 0x3a, 0x42, 0x55, 0xae, 0x4e, 0x59,
+	     0x46, 0xcc, 0x00, 0x55, 0x30, 0xc0, 0x2c, 0xf2, 0xfb, 0x00,
+	     0xaa, 0x55, 0x25, 0x2e, 0x93, 0x13, 0x46, 0x71, 0xcb, 0x49,
+	     0xe3, 0xf9, 0x76, 0x14, 0xa1, 0x65, 0x0d, 0x2e, 0x00, 0x00,
+	     0xd1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0xdc, 0x10,
+	     0xad, 0x74, 0x75, 0x26, 0x61, 0xb8, 0x06, 0x00, 0x80, 0xe3,
+	     0x2c, 0x00, 0x02, 0x00, 0xc0, 0x3e, 0x69, 0x44, 0x00, 0x00,
+	     0x16, 0x9a, 0xed, 0x1e, 0x00, 0xe0, 0x9b, 0x57, 0x7e, 0x1b,
+	     0x63, 0x44, 0xe0, 0x00, 0x00, 0xd2, 0x2d, 0xbe, 0xa5, 0xf4,
+	     0xec, 0xd9, 0x60, 0x2c, 0x04, 0x00, 0x1c, 0x0a, 0x7a, 0x5d,
+	     0xd2, 0x36, 0x53, 0xe6, 0x8a, 0xae, 0x83, 0x77, 0xd3, 0x00,
+	     0x00, 0xec, 0x2f, 0x76, 0x18, 0x28, 0x15, 0xbe, 0x5e, 0xff,
+	     0x69, 0xd9, 0x86, 0xee, 0x83, 0x5f, 0xd8, 0x91, 0xfe, 0x92,
+	     0x00, 0x80, 0x3d, 0x1d, 0x86, 0x66, 0x14, 0x43, 0xbb, 0x03,
+	     0x00, 0x0c, 0x00, 0x01, 0x00, 0x39, 0x11, 0x79, 0x13, 0x00,
+	     0x00, 0x00, 0x70, 0x84, 0xa0, 0x47, 0xc1, 0x84, 0x42, 0x7c,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd9, 0x99,
+	     0x4b, 0x00, 0x00, 0x68, 0x6d, 0xc9, 0x2e, 0x00, 0xc0, 0x3a,
+	     0xc5, 0xdd, 0x75, 0x4e, 0x9a, 0x90, 0xa9, 0x09, 0x9a, 0x89,
+	     0x00, 0x00, 0x00, 0xc0, 0xea, 0xa4, 0x65, 0x27, 0x4e, 0x74,
+	     0x28, 0x00, 0x00, 0x26, 0x96, 0xa9, 0x97, 0x5f, 0x16, 0xcc,
+	     0x8a, 0x1e, 0xc1, 0x3a, 0x00, 0x00, 0x88, 0x80, 0x3a, 0x19,
+	     0x1e, 0x1a, 0xf0, 0x54, 0x57, 0x88, 0x53, 0x41, 0xcf, 0xb9,
+	     0xb5, 0x05, 0x3e, 0x68, 0x48, 0xa5, 0x14, 0x00, 0xc0, 0x9c,
+	     0x0c, 0x00, 0xc0, 0x97, 0x62, 0x14, 0x92, 0xd1, 0x72, 0x16,
+	     0x1a, 0x4c, 0xc3, 0x94, 0x56, 0x0a, 0xd0, 0x04, 0xaf, 0x8a,
+	     0xd1, 0xc1, 0x59, 0x16, 0x0f, 0x57, 0x08, 0xa9, 0xc4, 0x0d,
+	     0x82, 0xae, 0x68, 0x35, 0xb4, 0x6d, 0x34, 0x31, 0xff, 0x23,
+	     0x00, 0x00, 0xb8, 0x0b, 0x00, 0x00, 0x85, 0x83, 0x23, 0x03,
+	     0x5e, 0x19, 0x46, 0xc2, 0x42, 0xb1, 0x22, 0xfb, 0xe2, 0x40,
+	     0xcf, 0x1b, 0x06, 0x00, 0x18, 0x28, 0x16, 0x90, 0xb8, 0x49,
+	     0x00, 0x80, 0xff, 0x10, 0xbe, 0x8e, 0xa9, 0xb0, 0x24, 0x00,
+	     0x00, 0x90, 0xd8, 0x00, 0x00, 0x7e, 0x90, 0x0d, 0x9d, 0xcc,
+	     0x29, 0xf9, 0x06, 0x00, 0x88, 0x97, 0x00, 0x00, 0xf6, 0x02,
+	     0x6b, 0x38, 0xb8, 0x1c, 0x00, 0xc0, 0x8c, 0xd5, 0xa8, 0xbb,
+	     0x50, 0xee, 0x69, 0x7e, 0x8f, 0x81, 0x3a, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x80, 0x25, 0x2c, 0x3e, 0x0a, 0x9a, 0x08, 0x56,
+	     0xb7, 0xbb, 0xb0, 0xa3, 0xad, 0x67, 0x8a, 0x04, 0xa8, 0xeb,
+	     0x67, 0x00, 0x00, 0x76, 0x95, 0x1e, 0x37, 0x00, 0x00, 0x24,
+	     0x82, 0x02, 0xc2, 0xcf, 0x7b, 0x2c, 0xd6, 0x2c, 0xa4, 0x9a,
+	     0x00, 0x00, 0xb9, 0x94, 0x3a, 0x01, 0x00, 0xe0, 0xfc, 0x03,
+	     0x00, 0xe0, 0xd6, 0x42, 0x58, 0x73, 0x4c, 0xf8, 0x09, 0xc0,
+	     0x01, 0x00, 0x40, 0x55, 0x04, 0x00, 0x80, 0x67, 0xde, 0x7a,
+	     0xbe, 0xb7, 0xfc, 0x1b, 0x00, 0x00, 0x00, 0x80, 0x9a, 0x01,
+	     0x00, 0x00, 0x00, 0x72, 0x88, 0x0e, 0x41, 0x7e, 0x83, 0xd6,
+	     0x6a, 0x5e, 0x06, 0x00, 0x48, 0x04, 0xea, 0xaa, 0x40, 0x61,
+	     0xcb, 0x32, 0x00, 0x00, 0x9c, 0x09, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x78, 0xca, 0x24, 0x97, 0x37, 0x00, 0x75, 0x05, 0x00,
+	     0x40, 0x3e, 0xc8, 0x6a, 0x19, 0x2f, 0x35, 0x78, 0x00, 0x00,
+	     0xab, 0x25, 0xa1, 0x93, 0x56, 0x31, 0x7c, 0xc8, 0x3a, 0x79,
+	     0xcf, 0xc8, 0xda, 0x2a, 0x06, 0x00, 0x80, 0x67, 0xd9, 0x0a,
+	     0x29, 0xbe, 0x00, 0x00, 0x08, 0x14, 0x02, 0x00, 0x08, 0x66,
+	     0xb1, 0x02, 0xaf, 0x09, 0x00, 0xc0, 0xa2, 0xe8, 0x6a, 0x0a,
+	     0x90, 0x79, 0x21, 0xd4, 0x8c, 0xd4, 0x2a, 0x20, 0x18, 0xb8,
+	     0x26, 0xfa, 0xa5, 0x48, 0x5c, 0x47, 0xf2, 0x0f, 0xa2, 0x47,
+	     0x00, 0x80, 0x5f, 0x66, 0x72, 0x6e, 0x26, 0x92, 0x56, 0xa0,
+	     0x3f, 0x14, 0xe2, 0x42, 0x4c, 0x00, 0x00, 0xd0, 0x21, 0x55,
+	     0xd0, 0x2c, 0x90, 0xc9, 0x69, 0x3d, 0xa9, 0x65, 0x00, 0x00,
+	     0xca, 0x87, 0x84, 0xcb, 0x6f, 0x2a, 0xb3, 0xa8, 0xad, 0xf1,
+	     0x17, 0xa8, 0x77, 0xf8, 0x54, 0xb8, 0x06, 0xea, 0xc2, 0xfe,
+	     0x08, 0x52, 0xc9, 0xc6, 0x03, 0x00, 0x0c, 0x87, 0x00, 0x00,
+	     0xb5, 0x0a, 0x5c, 0x47, 0x66, 0x11, 0x00, 0x30, 0x55, 0x93,
+	     0xbe, 0x5d, 0x32, 0xaa, 0x0a, 0xa2, 0x13, 0x18, 0x18, 0xfb,
+	     0xab, 0x03, 0x80, 0xd3, 0xf9, 0x7c, 0xfd, 0xda, 0x00, 0x00,
+	     0x00, 0x80, 0xa8, 0x87, 0x44, 0x0b, 0x46, 0xb7, 0xb3, 0x28,
+	     0x5d, 0xb1, 0xea, 0x70, 0x40, 0x54, 0x8f, 0x1a, 0x48, 0x2d,
+	     0x23, 0x6b, 0x25, 0x5f, 0x21, 0x50, 0xa2, 0x06, 0x09, 0x11,
+	     0x8a, 0xc1, 0xd6, 0x15, 0x21, 0x09, 0x00, 0xb0, 0x58, 0xe9,
+	     0x63, 0xe1, 0x33, 0x93, 0x52, 0xd0, 0x85, 0xc1, 0x09, 0x00,
+	     0x20, 0x09, 0x41, 0x90, 0x8c, 0xae, 0xf5, 0x24, 0xc1, 0x0f,
+	     0x74, 0x8f, 0x1f, 0x05, 0xe4, 0x25, 0x89, 0x06, 0x00, 0xe8,
+	     0x57, 0x71, 0x82, 0xb2, 0x95, 0x11, 0x1d, 0xfc, 0x1a, 0xe9,
+	     0x00, 0x00, 0x60, 0x99, 0x73, 0x00, 0xba, 0x23, 0x14, 0x76,
+	     0xb5, 0x87, 0x26, 0x45, 0x49, 0xe2, 0x37, 0xf4, 0x20, 0xa0,
+	     0xda, 0x54, 0xad, 0x64, 0x4a, 0xeb, 0x97, 0x88, 0xc1, 0xad,
+	     0x4c, 0x52, 0xe0, 0xe1, 0x09, 0x35, 0xfd, 0x8a, 0x36, 0x6e,
+	     0x00, 0x00, 0x52, 0x16, 0x00, 0x60, 0xc4, 0xd0, 0xd8, 0x90,
+	     0x35, 0xbc, 0x24, 0x29, 0x4e, 0x6b, 0x22, 0x34, 0x26, 0x00,
+	     0xe0, 0x26, 0x08, 0x00, 0x18, 0x49, 0x12, 0x4c, 0x8e, 0x3a,
+	     0x2b, 0x2e, 0xcd, 0x65, 0xb4, 0x67, 0xf4, 0x73, 0x30, 0xd1,
+	     0x21, 0xb6, 0x3d, 0x30, 0x0f, 0x00, 0x00, 0x30, 0x65, 0xd6,
+	     0x8a, 0x0b, 0xa6, 0x1e, 0xf4, 0x9b, 0xd4, 0x0e, 0x00, 0x00,
+	     0x9c, 0x8a, 0xd9, 0x4b, 0x06, 0x0c, 0x00, 0x00, 0x0e, 0x01,
+	     0x00, 0xe4, 0x2f, 0x27, 0x7d, 0xb1, 0x84, 0xad, 0x5e, 0xed,
+	     0xe1, 0xa4, 0x63, 0x52, 0xf8, 0x29, 0x00, 0x00, 0xae, 0x57,
+	     0xdc, 0x14, 0x62, 0x89, 0xd1, 0x50, 0x1c, 0xa5, 0xc9, 0xcc,
+	     0x88, 0xa5, 0x23, 0x7b, 0x09, 0x00, 0x80, 0xce, 0xd1, 0x43,
+	     0x87, 0x1d, 0x00, 0x5e, 0x99, 0xce, 0x54, 0x28, 0x9e, 0x6c,
+	     0x23, 0x00, 0x39, 0x1a, 0x00, 0x40, 0x4a, 0x55, 0x34, 0xf1,
+	     0x43, 0xcc, 0x78, 0x8e, 0x3e, 0x3b, 0xb4, 0xdc, 0x0b, 0x69,
+	     0xd3, 0xc3, 0x80, 0x93, 0x1b, 0x4a, 0xb4, 0xcc, 0x2e, 0x61,
+	     0x00, 0x00, 0x00, 0x40, 0xd7, 0xe1, 0x47, 0xc2, 0xc7, 0x19,
+	     0x0a, 0x01, 0x00, 0xd0, 0x00, 0xe9, 0xc3, 0xdd, 0x21, 0x00,
+	     0x40, 0x5d, 0x82, 0xec, 0x12, 0x4b, 0x04, 0xe2, 0xfe, 0x04,
+	     0x42, 0x4c, 0xe2, 0x8b, 0x32, 0x0f, 0x00, 0x00, 0x00, 0xf0,
+	     0x49, 0x50, 0x18, 0xef, 0x1a, 0x5f, 0x49, 0x00, 0x00, 0x00,
+	     0x20, 0x3d, 0xe7, 0x52, 0xc1, 0x36, 0xce, 0x18, 0x04, 0x31,
+	     0xfa, 0x21, 0xb9, 0x9f, 0x80, 0x13, 0x00, 0xc0, 0xd4, 0xa3,
+	     0x31, 0x22, 0x10, 0xcf, 0x27, 0x47, 0x94, 0xcc, 0x47, 0x82,
+	     0x42, 0xb6, 0x73, 0xa7, 0xc4, 0x3c, 0x41, 0x38, 0xae, 0x41,
+	     0xf9, 0x0c, 0xb2, 0x44, 0xce, 0x62, 0x62, 0xd9, 0xfd, 0x49,
+	     0xff, 0xa4, 0xe2, 0x38, 0x04, 0xaf, 0x0b, 0xc2, 0x5e, 0x98,
+	     0x11, 0x00, 0x00, 0xbb, 0xe0, 0x2c, 0xdc, 0x81, 0x54, 0x99,
+	     0x00, 0x00, 0x00, 0xc0, 0x8c, 0x0a, 0x00, 0x00, 0x00, 0x80,
+	     0xaf, 0x3d, 0x89, 0xb4, 0x82, 0x40, 0x8c, 0x90, 0x8f, 0x4b,
+	     0xad, 0x86, 0xf2, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x69,
+	     0x5c, 0x2a, 0x9a, 0x1d, 0xd3, 0xa5, 0xee, 0x25, 0x7e, 0x41,
+	     0x50, 0x02, 0x3d, 0x08, 0x69, 0x39, 0x02, 0x00, 0x00, 0x48,
+	     0x64, 0x40, 0x24, 0x5b, 0x01, 0x00, 0xd8, 0xe6, 0x66, 0x28,
+	     0xa8, 0xb4, 0xf6, 0xc9, 0xb1, 0x11, 0x00, 0xb0, 0x36, 0xac,
+	     0x64, 0xd5, 0x18, 0x1a, 0x20, 0x81, 0xa8, 0x4f, 0xd4, 0x8b,
+	     0x23, 0x05, 0x07, 0x00, 0x30, 0x84, 0x29, 0x24, 0x85, 0x72,
+	     0xa5, 0x3b, 0x71, 0x81, 0xa5, 0x08, 0x00, 0x80, 0x43, 0xd9,
+	     0xbd, 0x01, 0x00, 0x44, 0x8a, 0x00, 0x00, 0xf1, 0xc8, 0x76,
+	     0x70, 0x0b, 0x04, 0x00, 0x10, 0x54, 0x9d, 0xe0, 0x70, 0x11,
+	     0xb1, 0x3a, 0x3a, 0x4a, 0xc7, 0xcf, 0x6f, 0x08, 0x00, 0xd8,
+	     0xe7, 0x00, 0x00, 0xc6, 0x5a, 0x54, 0x21, 0xff, 0xcc, 0xac,
+	     0xcd, 0x39, 0xe8, 0xb3, 0x43, 0x52, 0x26, 0x58, 0xbc, 0x89,
+	     0x6b, 0x12, 0x14, 0x4d, 0x06, 0xa2, 0x4d, 0x26, 0x5e, 0x01,
+	     0x00, 0x7c, 0x57, 0x36, 0x12, 0x13, 0x1e, 0xde, 0xe0, 0xea,
+	     0x10, 0x00, 0x70, 0x1d, 0x5a, 0xf2, 0xe8, 0x89, 0xbe, 0x06,
+	     0x00, 0x00, 0x88, 0x51, 0xeb, 0x8d, 0x9b, 0x50, 0xb1, 0xf1,
+	     0xaa, 0x75, 0x8f, 0x5c, 0x3f, 0x00, 0x00, 0x7a, 0x1c, 0x4d,
+	     0x8b, 0xf7, 0x82, 0xf0, 0x01, 0x00, 0x18, 0x1d, 0x16, 0x3a,
+	     0x37, 0xba, 0xf7, 0x09, 0x00, 0xa0, 0x55, 0x06, 0x2c, 0x74,
+	     0x00, 0x02, 0x00, 0x58, 0x7d, 0x00, 0x80, 0xcb, 0x63, 0xfb,
+	     0xe0, 0xd0, 0x06, 0x00, 0x00, 0x0d, 0xc8, 0x4b, 0x00, 0x00,
+	     0x3f, 0x0c, 0x00, 0x00, 0x6a, 0x51, 0x10, 0x08, 0xee, 0x01,
+	     0x00, 0x34, 0x7a, 0x68, 0x28, 0xfc, 0x3b, 0xc4, 0xc1, 0x3b,
+	     0xcd, 0x9b, 0x79, 0x20, 0xbc, 0xc4, 0x00, 0x00, 0x4a, 0x66,
+	     0x78, 0x8c, 0xd7, 0x41, 0x4c, 0x8d, 0x93, 0xd4, 0xe3, 0x22,
+	     0x3c, 0xa6, 0x6b, 0x94, 0x93, 0xbb, 0x8d, 0x27, 0xc3, 0x00,
+	     0x13, 0x6c, 0x84, 0x0a, 0x04, 0x00, 0x58, 0x32, 0x01, 0x00,
+	     0x34, 0x36, 0x76, 0xd8, 0x55, 0xb2, 0xee, 0x05, 0x00, 0x18,
+	     0xbe, 0xbd, 0x1a, 0x93, 0x75, 0x01, 0x3e, 0x71, 0x42, 0x0c,
+	     0x0d, 0xf6, 0xe3, 0xd7, 0x00, 0x00, 0x64, 0xad, 0x74, 0x54,
+	     0x22, 0xc6, 0x57, 0x5c, 0xd7, 0x80, 0x8b, 0x22, 0x90, 0x50,
+	     0x4a, 0x1a, 0xcb, 0x00, 0x00, 0xdb, 0x2b, 0x00, 0x00, 0x34,
+	     0xf1, 0xb2, 0xb9, 0xee, 0x20, 0x1e, 0x91, 0xbc, 0x48, 0x30,
+	     0x4f, 0x34, 0xf0, 0x08, 0x4b, 0xa4, 0x25, 0x21, 0x6f, 0x01,
+	     0x00, 0x50, 0xcd, 0x16, 0x91, 0xb8, 0x35, 0xd7, 0xd4, 0x4e,
+	     0x8d, 0xbd, 0xc6, 0x88, 0x84, 0x8e, 0x81, 0xd5, 0x3e, 0x43,
+	     0xd1, 0x96, 0x39, 0x17, 0x00, 0x00, 0x26, 0x30, 0xaf, 0x09,
+	     0x08, 0x5d, 0xd4, 0x10, 0x6f, 0xc8, 0x1b, 0x19, 0x63, 0xbd,
+	     0x03, 0x00, 0xb0, 0xb9, 0x74, 0xd9, 0x00, 0x00, 0x9c, 0x83,
+	     0x00, 0x00, 0x2e, 0xcb, 0x52, 0xae, 0xa6, 0xc8, 0x65, 0xec,
+	     0x20, 0xb4, 0x02, 0xc4, 0x20, 0x60, 0x12, 0xe5, 0xc6, 0x17,
+	     0x27, 0x99, 0x35, 0xee, 0xe1, 0x36, 0x01, 0x00, 0xcc, 0x1f,
+	     0x82, 0xa5, 0x1e, 0xa0, 0x1b, 0x0c, 0x00, 0xa0, 0xad, 0xca,
+	     0x47, 0x2c, 0x0c, 0x4f, 0x3f, 0xe3, 0x4c, 0x07, 0xc8, 0xf3,
+	     0xcf, 0x51, 0x64, 0xb2, 0x02, 0x00, 0x8c, 0x4e, 0xd2, 0x08,
+	     0xf5, 0x23, 0x87, 0x23, 0x00, 0x00, 0x00, 0xe0, 0xb1, 0xe9,
+	     0xa2, 0xa1, 0xe3, 0xfe, 0x48, 0x0d, 0xbd, 0x9e, 0xd0, 0x15,
+	     0x12, 0xf1, 0x12, 0x00, 0x30, 0xb9, 0xfd, 0x2f, 0x41, 0x70,
+	     0x41, 0x0e, 0x00, 0xc0, 0xf3, 0x09, 0x00, 0x10, 0x81, 0x6b,
+	     0x08, 0xe4, 0x53, 0x78, 0x8a, 0x90, 0x2c, 0x30, 0x0c, 0x63,
+	     0xc1, 0xe2, 0x08, 0x00, 0x90, 0xca, 0x64, 0x2b, 0x41, 0x4a,
+	     0xf0, 0x0e, 0x00, 0xc0, 0x5e, 0x0b, 0x00, 0xb0, 0xa8, 0xf4,
+	     0xbb, 0x74, 0xc4, 0x96, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xc3,
+	     0x51, 0x25, 0x44, 0x26, 0x72, 0x98, 0x01, 0x00, 0x9e, 0x4c,
+	     0x00, 0x00, 0x00, 0x80, 0x5a, 0x52, 0x2c, 0x76, 0x69, 0xf3,
+	     0xd7, 0x05, 0x0e, 0xdd, 0x19, 0x65, 0x3b, 0x62, 0x25, 0x35,
+	     0xd2, 0x60, 0x54, 0xd4, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x51,
+	     0xb3, 0x9f, 0xeb, 0xc6, 0x4b, 0x4a, 0x7e, 0x54, 0x64, 0xc0,
+	     0x2b, 0x5a, 0x20, 0x21, 0x2f, 0x00, 0x80, 0xa2, 0x08, 0x18,
+	     0x82, 0x66, 0xd7, 0x49, 0xa1, 0x5b, 0x00, 0x00, 0x34, 0x41,
+	     0x10, 0x9e, 0xec, 0x4a, 0x35, 0xaf, 0xe9, 0xc0, 0x61, 0xa9,
+	     0xd2, 0x6c, 0x7d, 0x48, 0x40, 0x21, 0x2c, 0x8b, 0x08, 0xf5,
+	     0x89, 0xb0, 0x02, 0x64, 0xe9, 0x45, 0x66, 0x46, 0x76, 0x31,
+	     0x3a, 0x17, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0xd1, 0x99,
+	     0x04, 0xee, 0x36, 0x40, 0x5d, 0xcb, 0x02, 0x4c, 0x54, 0x4e,
+	     0x13, 0x00, 0x00, 0x00, 0x80, 0x52, 0x44, 0x2e, 0x91, 0x7f,
+	     0x25, 0x01, 0x2b, 0x11, 0x00, 0x20, 0x94, 0x68, 0x4c, 0xb3,
+	     0x9f, 0x61, 0x38, 0x8d, 0x7d, 0x00, 0x80, 0x87, 0xa0, 0xa8,
+	     0x12, 0x00, 0xc0, 0x90, 0x01, 0x00, 0xf8, 0x39, 0x20, 0x7c,
+	     0x49, 0x11, 0x00, 0x40, 0xec, 0x01, 0x66, 0xe5, 0x82, 0xf3,
+	     0x8f, 0xa0, 0x2f, 0x00, 0x00, 0xe2, 0xcc, 0x69, 0x8a, 0xa3,
+	     0x24, 0x69, 0x78, 0xdc, 0x73, 0x85, 0x3c, 0xb5, 0x16, 0x40,
+	     0x2e, 0xb5, 0x66, 0x04, 0xd4, 0xd0, 0x5f, 0x21, 0x73, 0xc1,
+	     0xe0, 0x01, 0x00, 0x00, 0x56, 0x00, 0x00, 0xf4, 0x57, 0xf2,
+	     0xf2, 0x7e, 0x43, 0xdf, 0xd4, 0x35, 0x01, 0x00, 0x04, 0x6f,
+	     0x9b, 0x32, 0x02, 0xe1, 0x17, 0x8a, 0xb8, 0x00, 0x00, 0x38,
+	     0x68, 0x66, 0x41, 0x86, 0x96, 0x4b, 0x2c, 0x0c, 0x0e, 0x00,
+	     0x80, 0xcc, 0x06, 0x00, 0x08, 0x56, 0x4a, 0x2a, 0x4b, 0x02,
+	     0x9d, 0x4b, 0x00, 0x00, 0xde, 0x6f, 0xb5, 0x40, 0x10, 0x81,
+	     0x39, 0x25, 0x5d, 0x80, 0x0f, 0x00, 0x80, 0x72, 0xa6, 0xc7,
+	     0x0c, 0xae, 0x91, 0xd8, 0x4b, 0xea, 0xa4, 0xaa, 0x78, 0x76,
+	     0x00, 0x80, 0xb7, 0x1c, 0x00, 0x20, 0x0d, 0xf9, 0x53, 0x88,
+	     0x6c, 0x80, 0x68, 0xf4, 0x12, 0x7c, 0xb7, 0x26, 0x0e, 0xa2,
+	     0x24, 0x32, 0xc2, 0x73, 0x53, 0xdd, 0xc9, 0x5d, 0x82, 0x88,
+	     0x1e, 0xa4, 0x35, 0xcf, 0xd0, 0x03, 0x38, 0x87, 0xc4, 0x03,
+	     0x00, 0x00, 0x00, 0x9e, 0x48, 0x00, 0x80, 0x55, 0x54, 0xf5,
+	     0xa1, 0x5a, 0x17, 0xf2, 0xbb, 0xee, 0xc4, 0xfb, 0x6e, 0x50,
+	     0x1e, 0x84, 0x9f, 0x13, 0x9b, 0x12, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x64, 0x65, 0x6e, 0x23, 0x3a, 0x43, 0x32, 0x10, 0x00,
+	     0x00, 0x00, 0x50, 0x76, 0x23, 0xa2, 0x94, 0x3e, 0xa6, 0x09,
+	     0x47, 0x96, 0x29, 0xd8, 0x81, 0xaa, 0x36, 0xa8, 0xee, 0x33,
+	     0xca, 0x01, 0x03, 0x3d, 0x89, 0xb3, 0x8e, 0x23, 0x9d, 0x88,
+	     0x81, 0xfc, 0x41, 0xd7, 0xb4, 0x04, 0xf9, 0x9a, 0xe0, 0x6c,
+	     0x00, 0x00, 0x88, 0x26, 0x00, 0x00, 0x70, 0x03, 0x5b, 0xbc,
+	     0x41, 0x4e, 0x6d, 0x00, 0x00, 0xf5, 0x9f, 0xe8, 0x24, 0x00,
+	     0x20, 0xc9, 0xd8, 0x3c, 0x71, 0xce, 0xb0, 0x2c, 0x08, 0x76,
+	     0x68, 0x87, 0x81, 0x4e, 0xed, 0x89, 0xf5, 0x03, 0x00, 0x00,
+	     0x00, 0xb0, 0x8a, 0x74, 0x5b, 0x73, 0x23, 0x3e, 0x54, 0x13,
+	     0xd3, 0xa3, 0xc8, 0x8d, 0x01, 0x00, 0x00, 0x00, 0x6c, 0x44,
+	     0x74, 0xb2, 0x5d, 0x5d, 0xac, 0x0b, 0x2b, 0x07, 0x00, 0xc0,
+	     0xc2, 0x1c, 0x6b, 0xa6, 0x56, 0x5b, 0x2f, 0x6c, 0x65, 0x60,
+	     0x09, 0x00, 0xd0, 0x06, 0xba, 0x2f, 0x9c, 0x4a, 0x4a, 0x3a,
+	     0x00, 0x00, 0x7d, 0xd9, 0x53, 0xa2, 0x6a, 0x60, 0xbb, 0xf3,
+	     0xcc, 0x49, 0x76, 0x20, 0x5c, 0xb9, 0x19, 0xcc, 0xc6, 0x34,
+	     0x11, 0x44, 0xe6, 0xff, 0x88, 0xf4, 0x40, 0x60, 0x9a, 0x59,
+	     0x00, 0x00, 0x00, 0xc0, 0x9e, 0x0e, 0x00, 0xb0, 0xa5, 0x29,
+	     0xf0, 0x01, 0x00, 0xe8, 0x12, 0x77, 0x46, 0x00, 0x00, 0xd1,
+	     0x6f, 0x79, 0xf4, 0x29, 0xcb, 0xb7, 0xf1, 0x86, 0x50, 0x8f,
+	     0x89, 0x17, 0xa5, 0x16, 0x71, 0x12, 0x00, 0x00, 0xd6, 0x62,
+	     0x09, 0x89, 0xff, 0x00, 0x00, 0x8d, 0x10, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x10, 0xbd, 0x04, 0x00, 0x8c, 0x33, 0x00, 0x00,
+	     0x00, 0x00, 0x0d, 0xc9, 0x53, 0xa6, 0xd9, 0x01, 0x00, 0x78,
+	     0x1c, 0xc8, 0x62, 0x06, 0x5d, 0x56, 0xc6, 0xf6, 0x04, 0xa3,
+	     0xaa, 0xf6, 0x65, 0xbe, 0x89, 0x2e, 0xbc, 0x36, 0x6c, 0x78,
+	     0xe7, 0x44, 0xc9, 0xde, 0x96, 0x0c, 0x00, 0x00, 0x00, 0x20,
+	     0x0e, 0x11, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfb,
+	     0x4e, 0xd6, 0xa5, 0x74, 0x92, 0x6a, 0x7d, 0xc6, 0x80, 0x74,
+	     0x00, 0x00, 0xd9, 0xcc, 0x04, 0x81, 0x0e, 0x75, 0x30, 0x6a,
+	     0x4a, 0xa4, 0x6c, 0xcc, 0x70, 0x9f, 0xab, 0x9a, 0x91, 0x4a,
+	     0xa3, 0x6b, 0x87, 0x93, 0xdc, 0x94, 0x21, 0x97, 0x14, 0x1d,
+	     0x80, 0x07, 0x8f, 0x03, 0x00, 0x20, 0x93, 0x70, 0x1b, 0xb8,
+	     0xc3, 0x49, 0xd7, 0xfe, 0x66, 0x00, 0x00, 0x57, 0xc3, 0x89,
+	     0x6d, 0x38, 0xe7, 0x09, 0x3c, 0x6b, 0x31, 0xfc, 0x94, 0x39,
+	     0x00, 0x00, 0x47, 0x0b, 0x00, 0xc0, 0xcd, 0x00, 0x00, 0x00,
+	     0x00, 0xf4, 0x76, 0x86, 0x42, 0x00, 0x80, 0xc7, 0x16, 0x00,
+	     0xe0, 0xcf, 0x07, 0x4c, 0x42, 0x01, 0x11, 0x0a, 0xaf, 0x17,
+	     0x00, 0x00, 0x00, 0x00, 0xd2, 0x92, 0x07, 0xb1, 0xa1, 0x00,
+	     0x00, 0xbc, 0x83, 0xac, 0x3d, 0xbf, 0x84, 0xe5, 0x9d, 0xb6,
+	     0x0a, 0x00, 0x50, 0x87, 0x49, 0xb9, 0x09, 0x73, 0xd6, 0x36,
+	     0x00, 0x00, 0x5c, 0x01, 0xfb, 0x0c, 0x00, 0x00, 0x00, 0x08,
+	     0xf5, 0xb8, 0x0d, 0x24, 0x90, 0xed, 0x85, 0x2e, 0x89, 0xb1,
+	     0x0d, 0xbc, 0xd3, 0x32, 0x01, 0x00, 0xe0, 0x46, 0x1a, 0x4a,
+	     0xf5, 0x15, 0x5d, 0x11, 0x00, 0x20, 0x38, 0xa7, 0x17, 0xbb,
+	     0xef, 0x19, 0x2a, 0xeb, 0x08, 0x52, 0x4d, 0xac, 0x83, 0xee,
+	     0x31, 0x9e, 0xc6, 0x5c, 0x79, 0xf7, 0x69, 0x5c, 0x50, 0x4e,
+	     0xae, 0x04, 0xde, 0xcd, 0xb8, 0x23, 0xe2, 0xb3, 0xdc, 0xec,
+	     0x29, 0xc8, 0x12, 0x75, 0x27, 0x00, 0x80, 0xb1, 0x16, 0x85,
+	     0xc4, 0x40, 0x00, 0x00, 0x68, 0x53, 0x00, 0x00, 0xea, 0x23,
+	     0x00, 0x80, 0x67, 0x88, 0x25, 0xf1, 0x42, 0x39, 0x48, 0xa1,
+	     0x14, 0x96, 0x50, 0x3e, 0x59, 0x84, 0x9b, 0x7e, 0xe5, 0xc1,
+	     0xee, 0x92, 0x96, 0x8c, 0x72, 0x93, 0x01, 0x00, 0x24, 0x4d,
+	     0x00, 0x00, 0xd4, 0xd2, 0x21, 0x02, 0x00, 0x40, 0xad, 0x04,
+	     0x00, 0x7c, 0x14, 0xc3, 0x34, 0x2a, 0x1c, 0xfe, 0x61, 0x93,
+	     0x67, 0x1c, 0x35, 0xea, 0x11, 0x3d, 0xd6, 0xae, 0xb2, 0x81,
+	     0x72, 0x4c, 0x02, 0xd8, 0x65, 0x71, 0x4b, 0x04, 0x00, 0x70,
+	     0x0f, 0xce, 0x89, 0x96, 0x38, 0xcb, 0x0c, 0x17, 0xdf, 0x1b,
+	     0xa7, 0x26, 0x12, 0x07, 0x90, 0x6c, 0x01, 0x00, 0xfa, 0x76,
+	     0x02, 0x3e, 0x00, 0x00, 0x22, 0xef, 0xee, 0x26, 0x2e, 0x00,
+	     0x00, 0xf4, 0x30, 0xc1, 0x44, 0xf5, 0xbf, 0x4f, 0x1d, 0xb8,
+	     0x03, 0x00, 0x30, 0x18, 0xd8, 0xfc, 0x8d, 0x17, 0x83, 0x99,
+	     0x2a, 0x95, 0x62, 0x82, 0xf7, 0x27, 0x67, 0xd7, 0xf3, 0xe0,
+	     0x9d, 0x2d, 0x30, 0xdd, 0x41, 0x79, 0x8d, 0x18, 0x20, 0x32,
+	     0x85, 0x16, 0x30, 0x3e, 0xc1, 0x01, 0x59, 0xf8, 0xe4, 0x2f,
+	     0x22, 0xc7, 0x2b, 0xa6, 0xa3, 0xf0, 0x5b, 0xa9, 0xb1, 0x7b,
+	     0x91, 0x1c, 0x73, 0xec, 0x74, 0x00, 0x00, 0x3a, 0x04, 0xad,
+	     0x72, 0x4e, 0x07, 0x00, 0x08, 0x62, 0x5d, 0xcd, 0x92, 0x57,
+	     0xb9, 0xc5, 0xf2, 0x12, 0xf9, 0x28, 0x3c, 0x08, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xac, 0x78, 0x0f, 0x70,
+	     0x08, 0x00, 0xa0, 0xa9, 0x2a, 0x65, 0xe6, 0xdf, 0xcc, 0x4a,
+	     0xe7, 0x07, 0x00, 0xc0, 0x4d, 0xeb, 0xee, 0x01, 0x00, 0xa0,
+	     0x18, 0x00, 0x00, 0x86, 0x1c, 0x00, 0x80, 0x55, 0x16, 0x00,
+	     0x00, 0xf4, 0x47, 0x34, 0xab, 0x4d, 0xf9, 0x19, 0x30, 0x41,
+	     0x00, 0x00, 0x00, 0x00, 0x15, 0xa4, 0x15, 0xa4, 0x60, 0x50,
+	     0xb4, 0x0c, 0x81, 0x00, 0x50, 0x84, 0xa8, 0xfe, 0x55, 0xe3,
+	     0x2a, 0x7f, 0x66, 0xe2, 0x00, 0x00, 0xbc, 0x36, 0x88, 0x16,
+	     0x00, 0x00, 0x00, 0x40, 0x34, 0x2d, 0xfb, 0x34, 0x14, 0x04,
+	     0x09, 0x01, 0x00, 0x2e, 0x0d, 0x83, 0xc0, 0xc7, 0xc1, 0x27,
+	     0x2d, 0x70, 0xb3, 0x77, 0xa3, 0x47, 0x6c, 0xd2, 0x00, 0x00,
+	     0xa1, 0x1c, 0x4c, 0x82, 0x38, 0x31, 0xb9, 0x63, 0x29, 0x04,
+	     0x00, 0x00, 0x00, 0x52, 0x66, 0xcc, 0x02, 0x3d, 0x23, 0xd1,
+	     0x60, 0x02, 0xd0, 0xa0, 0xda, 0xb8, 0x01, 0x00, 0x7c, 0x96,
+	     0xeb, 0x0a, 0x9f, 0x5b, 0x98, 0x8d, 0x31, 0x62, 0xad, 0x71,
+	     0x7d, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x26, 0xef, 0x24, 0x00,
+	     0x80, 0x6e, 0xb3, 0xac, 0x02, 0x00, 0x00, 0x00, 0x08, 0x96,
+	     0x79, 0xaa, 0x7c, 0x24, 0x41, 0xea, 0xc4, 0x11, 0x55, 0x02,
+	     0x00, 0x58, 0xc0, 0x88, 0x61, 0xca, 0x3f, 0x00, 0x80, 0x1f,
+	     0x81, 0x4e, 0x02, 0x92, 0x71, 0xac, 0x01, 0x00, 0x00, 0x00,
+	     0x75, 0x91, 0xb6, 0xc8, 0x14, 0x8a, 0xbe, 0x65, 0x46, 0xab,
+	     0xf0, 0xb9, 0x91, 0xee, 0x1d, 0x00, 0x80, 0x03, 0x57, 0x81,
+	     0x86, 0x3c, 0x04, 0x00, 0x20, 0x28, 0xc8, 0x31, 0x3c, 0x2c,
+	     0x70, 0x23, 0xab, 0xd3, 0x22, 0xa0, 0x82, 0xf0, 0xee, 0xb9,
+	     0x51, 0xb4, 0xaf, 0x02, 0x5d, 0x9f, 0xbc, 0xc1, 0x4b, 0x73,
+	     0x61, 0x3c, 0x53, 0x32, 0x04, 0x58, 0x31, 0xd9, 0x94, 0x1f,
+	     0x35, 0x1b, 0xda, 0x19, 0x4b, 0xcb, 0x06, 0x16, 0xe4, 0x22,
+	     0x12, 0x36, 0x5f, 0x44, 0x10, 0x0b, 0x2e, 0xa3, 0x01, 0x00,
+	     0xa0, 0x16, 0x09, 0x7f, 0xcb, 0x76, 0x58, 0x61, 0xc4, 0x0e,
+	     0x00, 0x00, 0x00, 0x40, 0x7b, 0x09, 0x00, 0x20, 0x6b, 0x68,
+	     0x5a, 0x00, 0x00, 0x7e, 0x08, 0x6a, 0x17, 0xb4, 0x15, 0x00,
+	     0xa0, 0x42, 0x01, 0x00, 0xe8, 0x62, 0x40, 0x35, 0x9a, 0x93,
+	     0xd7, 0x0a, 0xd7, 0x50, 0xd0, 0xad, 0x56, 0x02, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0xb8, 0x83, 0x00, 0x00, 0xd7, 0x1b, 0x00,
+	     0x60, 0xd2, 0x06, 0x00, 0x00, 0x00, 0x20, 0x60, 0x92, 0x2a,
+	     0x64, 0x47, 0x02, 0x8e, 0x1c, 0x04, 0x00, 0x00, 0x00, 0x70,
+	     0x7b, 0x8d, 0x2c, 0xfc, 0x0e, 0xf7, 0xba, 0x8e, 0xc7, 0x71,
+	     0x0a, 0x7d, 0xb3, 0x36, 0xf8, 0xd9, 0x8d, 0x34, 0xef, 0x2c,
+	     0x74, 0xab, 0x79, 0xda, 0xd9, 0xae, 0x77, 0x00, 0x00, 0x78,
+	     0xbc, 0x05, 0x82, 0xda, 0x47, 0x00, 0x00, 0xa7, 0x01, 0x74,
+	     0xc7, 0xe2, 0x05, 0xb7, 0x03, 0x00, 0xf4, 0x03, 0x68, 0x85,
+	     0xfb, 0x0f, 0x38, 0x05, 0x00, 0xa0, 0xf5, 0xd0, 0x08, 0x53,
+	     0x6c, 0x62, 0x0c, 0x68, 0x2e, 0x23, 0xa2, 0xf0, 0x0c, 0xba,
+	     0x84, 0xfb, 0xb3, 0xdd, 0xc0, 0x35, 0x01, 0x00, 0x00, 0x00,
+	     0x4d, 0xa6, 0xb3, 0x55, 0x2c, 0x71, 0x25, 0x84, 0xe8, 0x48,
+	     0x98, 0x78, 0xbf, 0x00, 0x00, 0x79, 0x10, 0x0c, 0x03, 0x00,
+	     0x20, 0x05, 0x05, 0x00, 0x80, 0xe3, 0xe9, 0x7c, 0xa4, 0x15,
+	     0xbd, 0x91, 0xc8, 0x45, 0x7b, 0xf0, 0xd5, 0x03, 0x00, 0x58,
+	     0xd9, 0x3d, 0xc2, 0xce, 0x65, 0x80, 0x0f, 0xd5, 0x5d, 0xd3,
+	     0xd0, 0x00, 0xd9, 0x2b, 0xd8, 0x2b, 0xf2, 0x20, 0xa6, 0x05,
+	     0xe0, 0x3a, 0xa8, 0xcb, 0xd3, 0x4a, 0x53, 0x57, 0x75, 0xf4,
+	     0xa0, 0x31, 0x09, 0x84, 0x3f, 0x2d, 0x90, 0x87, 0x08, 0x00,
+	     0xc0, 0x55, 0xe4, 0x0a, 0xe3, 0x98, 0xf9, 0x13, 0x5c, 0x2a,
+	     0xca, 0xa5, 0xd7, 0x1b, 0x52, 0xcb, 0x5f, 0x00, 0x00, 0x80,
+	     0x6a, 0xc2, 0x33, 0xcc, 0x63, 0x1b, 0x16, 0xb6, 0x50, 0xaa,
+	     0x04, 0xe0, 0x57, 0x2f, 0x00, 0x00, 0x70, 0x02, 0x82, 0x03,
+	     0x00, 0x00, 0x6b, 0x4a, 0xb0, 0x29, 0x62, 0x01, 0x00, 0x50,
+	     0x48, 0x54, 0x28, 0x22, 0x33, 0xcc, 0x46, 0x52, 0x45, 0xc1,
+	     0xce, 0x2e, 0x99, 0x7f, 0x00, 0x00, 0xb4, 0xcc, 0x34, 0x5b,
+	     0x00, 0x80, 0xbf, 0x0b, 0x1a, 0x2a, 0x42, 0x04, 0x00, 0xc8,
+	     0xa3, 0x34, 0x48, 0x70, 0x35, 0xcd, 0x1e, 0x49, 0xd0, 0xe4,
+	     0x8e, 0x26, 0x95, 0x03, 0xb8, 0xde, 0xfd, 0x17, 0xe6, 0x3d,
+	     0xd6, 0x84, 0x85, 0x54, 0xa6, 0xb2, 0x42, 0x61, 0xb8, 0x68,
+	     0x5f, 0x01, 0x00, 0x20, 0x4a, 0x7c, 0x12, 0x00, 0x00, 0x00,
+	     0x20, 0xaf, 0x77, 0x69, 0x1a, 0x9a, 0xa0, 0x14, 0xf8, 0x05,
+	     0xf5, 0x42, 0x35, 0x4e, 0xb7, 0x8d, 0xbe, 0xa3, 0x20, 0x39,
+	     0x3b, 0x70, 0x22, 0x01, 0x00, 0xd0, 0x26, 0x00, 0x00, 0x05,
+	     0x03, 0x17, 0x03, 0xac, 0x54, 0x69, 0x7e, 0x2a, 0x9f, 0x18,
+	     0x48, 0x3d, 0x6d, 0x51, 0x16, 0xf0, 0xaa, 0x14, 0x6c, 0x52,
+	     0x1e, 0x02, 0x00, 0xc8, 0x01, 0x86, 0x93, 0x0d, 0xd1, 0xdf,
+	     0x68, 0x2e, 0xd8, 0xcc, 0x00, 0x00, 0x80, 0x5a, 0x58, 0x97,
+	     0xb7, 0x84, 0x7b, 0xcb, 0x04, 0x68, 0x31, 0xf6, 0xa9, 0xd0,
+	     0x22, 0xa4, 0x87, 0x2c, 0x44, 0x71, 0xc5, 0xe7, 0xce, 0xc1,
+	     0xca, 0xc2, 0x31, 0x53, 0x00, 0x00, 0x50, 0x03, 0xd2, 0x48,
+	     0x9a, 0x9d, 0x0e, 0x54, 0xd3, 0x32, 0xcf, 0x66, 0x81, 0xb3,
+	     0x2e, 0x78, 0x16, 0x88, 0x2f, 0x51, 0x42, 0x00, 0x40, 0x6e,
+	     0x47, 0x3f, 0x20, 0x76, 0x03, 0x00, 0xb8, 0xf1, 0xdc, 0x24,
+	     0x1b, 0x0f, 0x8e, 0x82, 0xd2, 0x30, 0xba, 0xf8, 0x0b, 0x22,
+	     0x13, 0x46, 0x6d, 0x00, 0x00, 0xe2, 0xc7, 0x0f, 0x98, 0x1f,
+	     0xcc, 0x21, 0xa3, 0xd7, 0x18, 0x37, 0x00, 0x00, 0xd8, 0x74,
+	     0x06, 0x4a, 0xee, 0x94, 0x3f, 0xb0, 0x9f, 0xf5, 0x1a, 0x22,
+	     0xe8, 0x75, 0xe1, 0x00, 0x00, 0x6d, 0xa4, 0x12, 0x04, 0x00,
+	     0xc0, 0xae, 0x09, 0x00, 0x38, 0x45, 0x00, 0x14, 0xf3, 0x59,
+	     0xd0, 0xc9, 0xef, 0x17, 0x70, 0x4a, 0x1a, 0x09, 0x16, 0x89,
+	     0x89, 0xb4, 0x42, 0xd4, 0x7d, 0x55, 0x38, 0x6a, 0x12, 0x00,
+	     0x00, 0x00, 0xb0, 0xb5, 0x52, 0x39, 0x29, 0x13, 0x01, 0x00,
+	     0x4e, 0x31, 0xd4, 0x95, 0x41, 0xec, 0x09, 0x06, 0x00, 0xd8,
+	     0x1c, 0xa0, 0x2b, 0xc3, 0x5b, 0x76, 0x34, 0x00, 0x00, 0xb4,
+	     0x0d, 0x00, 0x70, 0x6e, 0xa9, 0x30, 0x2e, 0x25, 0x11, 0x94,
+	     0xb8, 0x4d, 0x00, 0x40, 0xb5, 0xa7, 0xd3, 0x16, 0x18, 0x04,
+	     0x00, 0x88, 0x55, 0x00, 0x00, 0x0b, 0x94, 0xc6, 0x07, 0x00,
+	     0x40, 0x1b, 0x92, 0x9a, 0x03, 0x00, 0x08, 0x78, 0x9e, 0x57,
+	     0x53, 0x23, 0xfd, 0xd7, 0xdc, 0x07, 0xaf, 0x21, 0x5b, 0x10,
+	     0x33, 0x79, 0xcb, 0x6a, 0x30, 0x41, 0x26, 0xb1, 0xa5, 0x17,
+	     0x05, 0x00, 0x80, 0x86, 0x0a, 0xd8, 0x01, 0x00, 0x04, 0x54,
+	     0x76, 0xcc, 0x68, 0x93, 0xdf, 0x00, 0xe7, 0x58, 0x17, 0xe2,
+	     0xe5, 0xd8, 0x98, 0x0a, 0x80, 0xe4, 0x2b, 0xef, 0x8f, 0xdd,
+	     0x09, 0xfd, 0xd7, 0x85, 0x34, 0x29, 0x02, 0x00, 0x00, 0x00,
+	     0x34, 0x13, 0x2c, 0x08, 0x28, 0x24, 0x7f, 0x39, 0x05, 0x8a,
+	     0xc0, 0xe8, 0xd9, 0x78, 0x95, 0x00, 0x00, 0x00, 0x00, 0x4e,
+	     0x22, 0xbc, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x5a, 0x2a,
+	     0xfb, 0x15, 0xcf, 0x62, 0x60, 0x0c, 0x00, 0xa0, 0xb2, 0xa4,
+	     0x0d, 0x78, 0x5e, 0x8c, 0x0f, 0xe2, 0x17, 0x1b, 0x92, 0x65,
+	     0xa4, 0x87, 0x07, 0x00, 0x00, 0x00, 0xfc, 0x36, 0x1b, 0x77,
+	     0xf3, 0x9c, 0x48, 0xd5, 0x27, 0xd3, 0x0c, 0xe9, 0x63, 0x39,
+	     0xc5, 0x24, 0x0a, 0xbf, 0x5c, 0x80, 0x22, 0xb0, 0xa5, 0xa3,
+	     0xad, 0x80, 0xd0, 0x4d, 0x9a, 0x81, 0x01, 0x00, 0xa8, 0x46,
+	     0x00, 0x80, 0x25, 0x1c, 0x00, 0x40, 0xec, 0x60, 0x3b, 0xa3,
+	     0x38, 0xbe, 0x78, 0x80, 0x32, 0xec, 0x2f, 0x00, 0x00, 0x03,
+	     0x44, 0xe1, 0xd8, 0xf7, 0xfa, 0x5b, 0x01, 0x00, 0x7a, 0x46,
+	     0x00, 0x80, 0x7b, 0x96, 0xcd, 0xe8, 0x9b, 0x24, 0x57, 0xb0,
+	     0x39, 0x3a, 0x13, 0x01, 0x00, 0x24, 0x2c, 0xb3, 0x05, 0x1a,
+	     0x00, 0xad, 0x06, 0x00, 0x18, 0x7b, 0x00, 0x00, 0x00, 0x00,
+	     0x68, 0x25, 0xe9, 0x49, 0x97, 0x28, 0xfd, 0xa8, 0x80, 0xba,
+	     0x9a, 0xe8, 0xad, 0x4e, 0x76, 0x00, 0x00, 0x9a, 0xd9, 0x45,
+	     0x6f, 0xaf, 0xb2, 0xf6, 0xf3, 0x23, 0xce, 0x17, 0x61, 0x10,
+	     0x00, 0x00, 0x00, 0x40, 0x50, 0x12, 0x7f, 0xb3, 0xee, 0xb9,
+	     0x8b, 0x00, 0x00, 0x00, 0x00, 0x26, 0x12, 0x98, 0x62, 0x46,
+	     0x12, 0x54, 0x08, 0x57, 0x92, 0xee, 0x01, 0x00, 0x66, 0x6e,
+	     0x00, 0x00, 0x70, 0x0d, 0x00, 0xe0, 0x0d, 0xa2, 0x13, 0xc0,
+	     0x61, 0x01, 0x00, 0xc0, 0x5f, 0x47, 0x2f, 0xf2, 0x20, 0x53,
+	     0x22, 0xdc, 0x07, 0x6b, 0x51, 0x2b, 0x01, 0x00, 0x00, 0x00,
+	     0x64, 0x1c, 0x8f, 0x02, 0xeb, 0x05, 0x00, 0xd0, 0x06, 0x9b,
+	     0x3d, 0xea, 0x95, 0x9c, 0x1a, 0x2f, 0x91, 0xc1, 0xc0, 0x3a,
+	     0x6e, 0x1c, 0x91, 0xb4, 0x29, 0x66, 0x44, 0x0c, 0x01, 0x00,
+	     0xf4, 0x38, 0x80, 0x03, 0xfb, 0x6a, 0x8c, 0x19, 0xe5, 0x18,
+	     0x39, 0x51, 0x6f, 0x94, 0x04, 0x00, 0x80, 0x19, 0xce, 0xc4,
+	     0x11, 0x00, 0xc0, 0x9f, 0xb8, 0x72, 0x44, 0x65, 0x0e, 0x93,
+	     0x07, 0x8b, 0xa7, 0xd0, 0x24, 0x63, 0x59, 0x13, 0x98, 0x02,
+	     0x00, 0x20, 0x9d, 0x52, 0x01, 0xda, 0x36, 0x38, 0x82, 0x2d,
+	     0x03, 0x00, 0xd0, 0x2f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00,
+	     0x57, 0xa2, 0xd1, 0x0e, 0x00, 0x00, 0xa2, 0x92, 0xa0, 0x71,
+	     0x42, 0x11, 0xd7, 0x00, 0x86, 0xab, 0xc5, 0xd9, 0xc3, 0xb3,
+	     0x00, 0x00, 0xa0, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+	     0x75, 0xbb, 0x74, 0x9b, 0xd2, 0xe1, 0x99, 0x38, 0xe2, 0x6a,
+	     0x1c, 0x50, 0x52, 0x3a, 0x46, 0xd2, 0xa4, 0x86, 0xa5, 0xc5,
+	     0xa9, 0x06, 0xf1, 0x4f, 0x01, 0x00, 0x20, 0x19, 0xe0, 0x15,
+	     0x0f, 0x44, 0xcf, 0x06, 0x7c, 0x03, 0x00, 0x60, 0xbd, 0x54,
+	     0x24, 0x36, 0x7a, 0x86, 0x05, 0x9e, 0x1b, 0x05, 0x91, 0xda,
+	     0x10, 0xc2, 0x31, 0xd4, 0x01, 0x12, 0x92, 0x0b, 0x23, 0x9c,
+	     0x75, 0xb2, 0xba, 0x13, 0x00, 0x00, 0x00, 0xe0, 0x79, 0xec,
+	     0xda, 0x88, 0xad, 0x04, 0x76, 0x65, 0x07, 0x25, 0x45, 0x40,
+	     0x12, 0x00, 0xe0, 0xb8, 0x8a, 0x86, 0x2d, 0x53, 0x9a, 0x73,
+	     0x00, 0x00, 0x00, 0x00, 0xda, 0x0e, 0x00, 0x60, 0x01, 0xa8,
+	     0x6f, 0x64, 0x89, 0x16, 0x43, 0x24, 0x46, 0x00, 0x00, 0xca,
+	     0xa7, 0x39, 0x46, 0x8d, 0x1b, 0x62, 0x00, 0x00, 0x34, 0x44,
+	     0x00, 0x00, 0xda, 0x0d, 0x00, 0x00, 0xfa, 0xb0, 0x02, 0xb1,
+	     0x8f, 0x51, 0x71, 0x00, 0x00, 0xb4, 0x4b, 0x26, 0xcd, 0x2e,
+	     0x68, 0xb1, 0x03, 0xa7, 0x2a, 0x3a, 0x22, 0xd3, 0x98, 0x4a,
+	     0x46, 0x1e, 0x00, 0x00, 0x6f, 0x11, 0x1c, 0x09, 0x00, 0x00,
+	     0x00, 0xf4, 0xfd, 0xfc, 0x64, 0x86, 0xa9, 0x34, 0x20, 0xd7,
+	     0x10, 0xbb, 0x56, 0xbd, 0x04, 0x00, 0xac, 0x42, 0x00, 0x00,
+	     0x14, 0x9f, 0xc7, 0xc2, 0x43, 0x22, 0x48, 0x82, 0x5f, 0x68,
+	     0x25, 0x8a, 0xba, 0x4c, 0x6d, 0xb0, 0x3f, 0x00, 0x40, 0xf5,
+	     0x8e, 0xbd, 0xa7, 0x99, 0x71, 0xee, 0x38, 0x22, 0x68, 0x96,
+	     0x00, 0x80, 0x39, 0x20, 0x2e, 0x8c, 0x80, 0x07, 0x00, 0x60,
+	     0xb7, 0x0c, 0x90, 0xdc, 0x9a, 0x90, 0x39, 0xe6, 0x91, 0x02,
+	     0xe9, 0x2f, 0x74, 0x07, 0xb2, 0x86, 0xf8, 0xc7, 0x2c, 0x57,
+	     0xae, 0x0e, 0x00, 0xc0, 0xd5, 0x07, 0x83, 0xd6, 0x53, 0x03,
+	     0x00, 0x44, 0xde, 0x00, 0x00, 0x8e, 0x36, 0x00, 0x80, 0xec,
+	     0x07, 0x00, 0xb0, 0x40, 0xdb, 0x9f, 0xf9, 0x91, 0x42, 0x61,
+	     0x00, 0x80, 0x16, 0x0a, 0x7c, 0x6f, 0xca, 0x41, 0x51, 0x60,
+	     0xa0, 0x81, 0x1f, 0x0a, 0x51, 0x00, 0x80, 0xd5, 0x57, 0x34,
+	     0xc1, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x38,
+	     0x4a, 0x21, 0x40, 0xe3, 0x3a, 0x62, 0x3d, 0x50, 0x07, 0xf0,
+	     0xe3, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x80, 0x89, 0x9e, 0x42,
+	     0x03, 0xc1, 0x56, 0xaf, 0x01, 0x00, 0x1c, 0xad, 0x9e, 0x6b,
+	     0x00, 0x00, 0xa1, 0x9c, 0x1a, 0xed, 0x49, 0x08, 0x73, 0x00,
+	     0x00, 0x28, 0xcf, 0x1c, 0x04, 0x00, 0x00, 0xa3, 0x08, 0x00,
+	     0x00, 0x42, 0x01, 0x00, 0x68, 0xb8, 0x00, 0x00, 0xb6, 0x04,
+	     0xbd, 0x3e, 0xd4, 0x9d, 0x66, 0x30, 0xea, 0x13, 0x13, 0xca,
+	     0xe4, 0xdd, 0x5f, 0x4a, 0x97, 0x42, 0x15, 0x6c, 0x60, 0x85,
+	     0xd1, 0xae, 0xa6, 0x2b, 0xd9, 0xe6, 0x01, 0x00, 0x9e, 0x08,
+	     0x5b, 0x24, 0x48, 0x55, 0x4c, 0xcb, 0xba, 0x07, 0x00, 0x30,
+	     0x0f, 0xac, 0x1e, 0x7c, 0x45, 0xf5, 0x95, 0x46, 0x25, 0x09,
+	     0x2b, 0x20, 0x65, 0xab, 0x02, 0x5a, 0x28, 0x0b, 0x92, 0x67,
+	     0x76, 0x94, 0xe2, 0x55, 0xf4, 0x0e, 0x00, 0x20, 0xe0, 0x14,
+	     0xf7, 0x2d, 0xae, 0x66, 0x56, 0x3c, 0x00, 0x00, 0x40, 0x27,
+	     0x8c, 0x84, 0xf4, 0xed, 0xf0, 0x47, 0xb2, 0x03, 0xe8, 0x7a,
+	     0x00, 0x80, 0xa5, 0x1e, 0x00, 0x80, 0xbc, 0x28, 0x64, 0xd9,
+	     0x53, 0x9d, 0x94, 0x6a, 0x52, 0xc8, 0x83, 0x92, 0x55, 0xf4,
+	     0x40, 0x08, 0x08, 0x00, 0xc8, 0xbc, 0xa0, 0x45, 0xca, 0x09,
+	     0x00, 0x00, 0x6d, 0x8d, 0x91, 0x04, 0xb0, 0xa7, 0xa5, 0xca,
+	     0x6e, 0xc9, 0x11, 0x72, 0x8c, 0x9f, 0x9a, 0x1a, 0x00, 0xb0,
+	     0xc7, 0x76, 0xf6, 0x3a, 0x94, 0x04, 0x5e, 0xf8, 0x26, 0x62,
+	     0xdd, 0x32, 0x00, 0x00, 0x00, 0x40, 0xef, 0x02, 0x00, 0xa0,
+	     0xa2, 0x3c, 0x2b, 0x76, 0x9b, 0x00, 0x00, 0xb4, 0x25, 0x48,
+	     0x0c, 0x00, 0xc0, 0x9a, 0x30, 0x4b, 0x09, 0x73, 0x92, 0x67,
+	     0x26, 0xb6, 0xc5, 0x44, 0xde, 0x25, 0xa6, 0x15, 0xa1, 0xc1,
+	     0xb7, 0xb8, 0x67, 0x40, 0x2f, 0xb5, 0xa0, 0xde, 0x0a, 0x00,
+	     0x20, 0x2c, 0x43, 0xe5, 0x23, 0x34, 0x02, 0x00, 0x6e, 0x43,
+	     0x99, 0xa6, 0x96, 0xc1, 0xb6, 0x0a, 0x00, 0x80, 0x51, 0x9c,
+	     0x4a, 0x4a, 0x1e, 0xc5, 0x8d, 0x12, 0x44, 0x3f, 0x55, 0xf6,
+	     0x49, 0x53, 0x31, 0x81, 0x03, 0x00, 0x68, 0x6b, 0x00, 0x00,
+	     0x44, 0x44, 0x1c, 0x85, 0x6e, 0xad, 0x50, 0x56, 0x8b, 0x01,
+	     0x00, 0x00, 0x00, 0xac, 0x90, 0x03, 0x85, 0x7a, 0x1c, 0x2d,
+	     0x08, 0xbf, 0xc3, 0x65, 0x04, 0x00, 0x08, 0x1d, 0xb7, 0x5d,
+	     0xa7, 0xbb, 0x0a, 0x83, 0x8f, 0x2c, 0xc6, 0xc3, 0x56, 0xbc,
+	     0x4e, 0xfe, 0x2c, 0x00, 0x00, 0x8f, 0x27, 0xf1, 0x89, 0x08,
+	     0x2e, 0x3c, 0x07, 0x26, 0x60, 0xb9, 0x34, 0x1f, 0x1b, 0x0f,
+	     0xb1, 0x1c, 0x17, 0x5f, 0x4f, 0x6f, 0xf1, 0xe5, 0xae, 0x1a,
+	     0xb4, 0x58, 0x58, 0x5a, 0x56, 0x84, 0x38, 0x4e, 0x07, 0x43,
+	     0x70, 0xc6, 0x15, 0xe8, 0x7b, 0x49, 0x00, 0x00, 0x74, 0x7a,
+	     0x6d, 0x22, 0xf2, 0x1b, 0xb8, 0x10, 0x00, 0x10, 0x67, 0x03,
+	     0x00, 0xa4, 0x8a, 0x78, 0x89, 0x05, 0x87, 0xfb, 0xa5, 0xf5,
+	     0x71, 0x01, 0x02, 0x00, 0x40, 0x12, 0x45, 0xa1, 0x2e, 0x64,
+	     0x59, 0x30, 0x31, 0x0a, 0x7a, 0xb0, 0xc4, 0xe8, 0x05, 0xd8,
+	     0x2e, 0x7c, 0x20, 0xe2, 0x55, 0x53, 0x19, 0x00, 0x40, 0x0a,
+	     0x13, 0xd6, 0xa1, 0x6c, 0x54, 0x4f, 0xb1, 0xbd, 0x00, 0x00,
+	     0xed, 0x95, 0x68, 0x1a, 0xc5, 0x12, 0x00, 0x00, 0x00, 0x18,
+	     0x75, 0x6c, 0x34, 0xe2, 0x2d, 0xfe, 0x45, 0xd9, 0x0b, 0x79,
+	     0xc0, 0x1f, 0xf4, 0x79, 0x60, 0x06, 0xb9, 0x37, 0x61, 0x6f,
+	     0xce, 0xc3, 0x7a, 0x57, 0xad, 0x65, 0xc6, 0x01, 0x1a, 0xd2,
+	     0xaf, 0x65, 0x2f, 0xd8, 0x70, 0x00, 0x80, 0xb9, 0x5c, 0x1f,
+	     0xa2, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x60,
+	     0xd9, 0x47, 0x00, 0x00, 0xd9, 0x4f, 0xbd, 0xd5, 0x16, 0xa4,
+	     0x53, 0xc9, 0x2d, 0x11, 0x20, 0x32, 0xba, 0x2a, 0x93, 0x37,
+	     0xa5, 0x01, 0xe4, 0x99, 0xb0, 0x3f, 0x00, 0x00, 0x08, 0x99,
+	     0xf6, 0x15, 0x52, 0xd0, 0xd9, 0x28, 0x23, 0x89, 0x3d, 0x30,
+	     0x63, 0xc2, 0xbf, 0x00, 0x00, 0x3f, 0x40, 0x75, 0x4f, 0xf3,
+	     0x86, 0x11, 0x03, 0x00, 0xf0, 0x45, 0x80, 0x80, 0x1e, 0x81,
+	     0xfb, 0x91, 0xbf, 0xc3, 0x6c, 0x2a, 0x54, 0x00, 0x00, 0xc0,
+	     0x0a, 0xed, 0x0e, 0xf4, 0x70, 0x81, 0x80, 0x7f, 0x06, 0x2f,
+	     0xe1, 0x66, 0x00, 0x96, 0xba, 0x29, 0x48, 0xcd, 0x00, 0x00,
+	     0x8c, 0x13, 0x00, 0xc0, 0xc0, 0xc8, 0x81, 0x64, 0x19, 0x79,
+	     0xb4, 0x18, 0xce, 0x0e, 0x48, 0xc1, 0xb5, 0xdf, 0xc3, 0x84,
+	     0x02, 0x00, 0xf0, 0x2d, 0xc8, 0x0c, 0x02, 0x00, 0x12, 0x5a,
+	     0xb8, 0xbe, 0x7e, 0x85, 0x0e, 0xca, 0x0f, 0x63, 0x4d, 0x93,
+	     0x33, 0x5d, 0x8f, 0x00, 0x00, 0x8e, 0xc0, 0xec, 0x53, 0x8f,
+	     0x8d, 0x3f, 0x00, 0x00, 0x98, 0x68, 0x91, 0x15, 0x52, 0x00,
+	     0x9a, 0x14, 0x00, 0x40, 0xde, 0x8b, 0x04, 0x24, 0x5a, 0x1a,
+	     0x70, 0x0c, 0x18, 0x80, 0x7e, 0x00, 0x80, 0x82, 0xa5, 0x3c,
+	     0x0d, 0x80, 0x56, 0xe9, 0x02, 0x00, 0xb4, 0xeb, 0x80, 0x36,
+	     0x6d, 0xb2, 0x33, 0x00, 0x00, 0x00, 0x00, 0x30, 0xdf, 0x4b,
+	     0x99, 0xb0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xca, 0x58,
+	     0xa1, 0x97, 0x01, 0x00, 0xd8, 0x46, 0x01, 0x00, 0x00, 0x8f,
+	     0xce, 0x09, 0x3f, 0x44, 0x4e, 0x88, 0xf0, 0x67, 0xd3, 0x52,
+	     0x15, 0x01, 0x00, 0x82, 0x86, 0x00, 0x80, 0xd6, 0x12, 0x53,
+	     0x4c, 0x64, 0x74, 0x7c, 0x73, 0x15, 0x02, 0x00, 0x34, 0x48,
+	     0xf7, 0x9f, 0x09, 0x08, 0x00, 0x00, 0x1b, 0xb1, 0xab, 0x32,
+	     0x12, 0x46, 0x20, 0xe0, 0x39, 0x49, 0xa1, 0xaf, 0xd6, 0x61,
+	     0xe7, 0x2c, 0x03, 0x00, 0x68, 0x26, 0xd0, 0x67, 0x00, 0x00,
+	     0x66, 0x10, 0x1e, 0x15, 0x76, 0xed, 0xd0, 0x77, 0x5b, 0xb9,
+	     0x02, 0xe6, 0xf7, 0x00, 0x00, 0x00, 0x00, 0xda, 0x52, 0xbb,
+	     0xc1, 0x91, 0xd5, 0x2c, 0x01, 0x00, 0x78, 0xe4, 0x00, 0x00,
+	     0x45, 0x3d, 0x0a, 0x0d, 0x00, 0xc0, 0xb2, 0xe2, 0x73, 0x1a,
+	     0x3d, 0xe5, 0x9e, 0xce, 0x5a, 0x00, 0x00, 0x4b, 0xe6, 0xa7,
+	     0x00, 0x00, 0xd0, 0xb3, 0x82, 0x38, 0xde, 0x9e, 0x5e, 0x12,
+	     0xa6, 0x49, 0x0b, 0x9c, 0xe2, 0x66, 0x2a, 0x52, 0x9e, 0x03,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x25, 0xbd,
+	     0xc2, 0xdd, 0xc5, 0x49, 0xd4, 0x30, 0x34, 0x42, 0x60, 0x72,
+	     0x32, 0x4b, 0x20, 0x8c, 0xe9, 0xf0, 0x40, 0x45, 0xc5, 0x7a,
+	     0x50, 0x88, 0x60, 0x94, 0x54, 0x93, 0x26, 0xec, 0x87, 0x3c,
+	     0xc1, 0x61, 0x02, 0x00, 0xb0, 0x44, 0xc5, 0xbb, 0x00, 0x00,
+	     0x86, 0x11, 0xd5, 0x20, 0x00, 0xa0, 0x51, 0xb3, 0xdf, 0xa1,
+	     0x11, 0x81, 0x42, 0xda, 0x0a, 0x00, 0x00, 0x00, 0xc0, 0xe6,
+	     0xe3, 0x7f, 0x36, 0xc5, 0x5c, 0x2f, 0xa6, 0xc7, 0x12, 0x5f,
+	     0x3d, 0x19, 0xc9, 0xdb, 0xe6, 0x6d, 0x5d, 0x79, 0x08, 0xf0,
+	     0x15, 0xa4, 0x1b, 0x01, 0x00, 0x70, 0x88, 0x49, 0x07, 0x00,
+	     0x20, 0x50, 0xa5, 0xec, 0x02, 0x00, 0x9c, 0x16, 0xe7, 0x8f,
+	     0x00, 0x00, 0xef, 0xc1, 0x3d, 0x08, 0x00, 0xa0, 0x6c, 0x03,
+	     0x00, 0x14, 0x6e, 0xa0, 0x4c, 0x6a, 0x4c, 0x1f, 0x03, 0x3e,
+	     0x66, 0xd1, 0x55, 0x6a, 0x00, 0x00, 0x54, 0x24, 0x34, 0x3d,
+	     0x89, 0xca, 0x72, 0x64, 0x68, 0xcc, 0x21, 0x93, 0x6f, 0x03,
+	     0x00, 0x00, 0xf2, 0xdc, 0x65, 0xc2, 0x4b, 0x00, 0xc0, 0x26,
+	     0xce, 0x81, 0xe1, 0xf7, 0x5a, 0x1b, 0xf5, 0xee, 0xa4, 0x17,
+	     0x2b, 0xc7, 0x69, 0x62, 0x19, 0x09, 0xfc, 0x24, 0x33, 0x11,
+	     0xb9, 0x35, 0xe7, 0xe2, 0x1a, 0xba, 0x26, 0x00, 0x00, 0xd3,
+	     0x50, 0x85, 0xa8, 0x3d, 0x03, 0x00, 0xcc, 0xc9, 0xd6, 0x91,
+	     0x5c, 0x02, 0x00, 0x00, 0xec, 0x4b, 0xb7, 0x09, 0x00, 0x50,
+	     0x89, 0x49, 0x4b, 0xea, 0x9a, 0x6a, 0x3f, 0x00, 0x80, 0xb1,
+	     0x07, 0xcf, 0x80, 0xc2, 0x01, 0x00, 0xe0, 0xea, 0x7a, 0x0e,
+	     0x08, 0x18, 0x12, 0x40, 0x82, 0x64, 0x4e, 0x98, 0x75, 0x9a,
+	     0x6c, 0x02, 0x00, 0x32, 0x2b, 0xef, 0x99, 0xf9, 0x1b, 0x2d,
+	     0x09, 0x00, 0x40, 0x91, 0x01, 0x18, 0x04, 0x34, 0x01, 0x00,
+	     0x97, 0x8f, 0x5a, 0x00, 0xcd, 0x6a, 0x2b, 0x79, 0xca, 0x02,
+	     0x00, 0x78, 0x9c, 0x00, 0x00, 0x0d, 0x2e, 0xf9, 0x52, 0x71,
+	     0x0b, 0x00, 0x00, 0x00, 0x80, 0x34, 0xb9, 0x3b, 0x0a, 0x67,
+	     0x05, 0xb3, 0xd9, 0x8a, 0x08, 0x10, 0x00, 0x30, 0x82, 0x00,
+	     0x00, 0xbc, 0x26, 0x9c, 0x0d, 0x35, 0xa8, 0x4e, 0x96, 0xf0,
+	     0x88, 0xab, 0x10, 0x44, 0x02, 0x46, 0x9e, 0xa7, 0xcc, 0x75,
+	     0x38, 0xc2, 0x8c, 0xa5, 0x79, 0x02, 0x00, 0xa0, 0x12, 0x93,
+	     0x28, 0x02, 0x00, 0x5a, 0x45, 0x70, 0x2d, 0x00, 0x00, 0xa6,
+	     0x12, 0x00, 0x80, 0x0f, 0xa3, 0xc7, 0x01, 0x00, 0x7a, 0x75,
+	     0xde, 0x39, 0x00, 0xc0, 0x75, 0xc1, 0x53, 0x08, 0x00, 0xb8,
+	     0x46, 0x01, 0x00, 0x9a, 0x1a, 0xb1, 0x17, 0xf0, 0x18, 0xd9,
+	     0x2e, 0xb1, 0xf9, 0x67, 0xc2, 0x67, 0x46, 0xbe, 0x00, 0x00,
+	     0xb2, 0xbb, 0x44, 0x07, 0x00, 0x00, 0xf0, 0x91, 0x3a, 0xc9,
+	     0xda, 0xc5, 0x1b, 0xd7, 0x16, 0x8a, 0xa5, 0x30, 0xe0, 0x87,
+	     0x00, 0x00, 0x90, 0x04, 0xa0, 0x28, 0xda, 0xca, 0x02, 0x8c,
+	     0x4a, 0x20, 0x04, 0x4c, 0xf5, 0x06, 0xad, 0x31, 0x62, 0xbc,
+	     0xb3, 0x00, 0x00, 0x00, 0x00, 0x71, 0x88, 0x78, 0xc8, 0x76,
+	     0x09, 0x00, 0x60, 0x53, 0x3b, 0x37, 0xa1, 0x69, 0x98, 0x8f,
+	     0x95, 0x3d, 0x00, 0x00, 0x00, 0xc0, 0xae, 0x50, 0x03, 0xa8,
+	     0xad, 0x34, 0x22, 0xbf, 0x8e, 0x00, 0x80, 0xe0, 0xc7, 0x19,
+	     0x93, 0xe2, 0x37, 0xe0, 0x73, 0x31, 0xed, 0x22, 0x65, 0x22,
+	     0x00, 0x00, 0xe6, 0x1d, 0x2d, 0xa8, 0x8e, 0x04, 0x00, 0xd0,
+	     0xb4, 0xd8, 0xbe, 0x00, 0x00, 0x31, 0x18, 0xd9, 0x4e, 0xf2,
+	     0x84, 0x29, 0xf2, 0x92, 0x2a, 0x3e, 0x96, 0x99, 0x10, 0x42,
+	     0x94, 0x0c, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x00, 0x10,
+	     0xe6, 0xe9, 0x0f, 0x6f, 0x68, 0x00, 0x80, 0xe1, 0xe2, 0x1d,
+	     0x00, 0x91, 0xc0, 0xd2, 0x03, 0x00, 0x04, 0x2f, 0x3f, 0x4b,
+	     0x6d, 0x07, 0xf3, 0x46, 0x41, 0xe1, 0xf0, 0x98, 0xb1, 0x00,
+	     0x00, 0xb0, 0xf4, 0x00, 0x00, 0xde, 0x85, 0x0d, 0x4c, 0xd7,
+	     0xe7, 0xd3, 0x28, 0x44, 0xfa, 0x0e, 0xc2, 0x38, 0x66, 0x58,
+	     0x6b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xa4, 0xc2,
+	     0xe6, 0x40, 0x11, 0x78, 0x7c, 0x98, 0xb9, 0xe1, 0x99, 0x01,
+	     0xca, 0x2d, 0xe7, 0x39, 0x73, 0x81, 0x01, 0x00, 0x3c, 0x8e,
+	     0x89, 0x42, 0x00, 0x00, 0x00, 0x80, 0xb2, 0xd2, 0x7a, 0x38,
+	     0x28, 0x25, 0xaf, 0xb4, 0x90, 0x85, 0x14, 0x00, 0xc0, 0x3e,
+	     0x45, 0xcf, 0x03, 0x00, 0x78, 0x02, 0xad, 0x66, 0x0a, 0x8a,
+	     0xa6, 0x0a, 0x2d, 0x1a, 0x00, 0x80, 0x93, 0x53, 0x79, 0xec,
+	     0x32, 0xa5, 0x86, 0xe6, 0x04, 0x00, 0x80, 0x3c, 0x80, 0x8b,
+	     0x12, 0x00, 0xf0, 0x6d, 0xe1, 0x44, 0x00, 0x00, 0x76, 0x53,
+	     0x00, 0x00, 0x9b, 0x80, 0x1e, 0x92, 0x66, 0x18, 0xc5, 0x42,
+	     0xfa, 0x01, 0x00, 0xc0, 0x80, 0x40, 0xa6, 0x31, 0xdf, 0x5d,
+	     0xa1, 0xca, 0x95, 0xc5, 0xac, 0x50, 0xd0, 0x2a, 0x0b, 0x8d,
+	     0x00, 0x00, 0xe8, 0x20, 0x00, 0x80, 0xde, 0x73, 0x95, 0x82,
+	     0xbc, 0x8c, 0xf5, 0xdc, 0x4b, 0x00, 0x80, 0xf6, 0xa4, 0x0b,
+	     0xb0, 0x58, 0xa4, 0xad, 0x62, 0x2d, 0x85, 0x65, 0xc2, 0x67,
+	     0x4e, 0x91, 0x17, 0x97, 0x02, 0x12, 0x00, 0x00, 0x00, 0xe0,
+	     0x06, 0x22, 0x3a, 0x00, 0x00, 0x1e, 0x4a, 0x87, 0x8b, 0x4a,
+	     0xee, 0x8b, 0xf0, 0x99, 0xac, 0x3f, 0xc4, 0x8e, 0x20, 0x97,
+	     0xf6, 0x87, 0xf2, 0x82, 0xbc, 0x67, 0xa3, 0xa6, 0x47, 0xa2,
+	     0x29, 0x02, 0x00, 0x9a, 0x05, 0x43, 0x17, 0x00, 0x00, 0xa3,
+	     0x40, 0x95, 0xd8, 0x68, 0x2c, 0x1e, 0x02, 0x00, 0x30, 0x3a,
+	     0xc6, 0xb1, 0x28, 0x98, 0x6f, 0x4a, 0x9d, 0x49, 0x62, 0x03,
+	     0x00, 0xf0, 0x65, 0x00, 0x00, 0xb9, 0x08, 0x36, 0xcd, 0x12,
+	     0x05, 0x00, 0xc0, 0x3b, 0x61, 0x6e, 0x6d, 0x3a, 0x32, 0x35,
+	     0x43, 0xa9, 0x6b, 0x0a, 0x8c, 0x83, 0x0f, 0x09, 0x00, 0x30,
+	     0x9a, 0x00, 0x00, 0xf6, 0x98, 0x04, 0x09, 0xa9, 0xd9, 0xf9,
+	     0x02, 0x00, 0x10, 0x56, 0x00, 0x00, 0xa0, 0x74, 0x06, 0x5f,
+	     0xab, 0x8a, 0x54, 0x80, 0xcb, 0x6c, 0x6b, 0x65, 0xf4, 0x73,
+	     0x6a, 0x30, 0x67, 0xdc, 0x99, 0xa7, 0x4c, 0x74, 0x26, 0x00,
+	     0xa0, 0x37, 0x01, 0x00, 0xd8, 0x9c, 0x1c, 0x7a, 0x5a, 0x11,
+	     0x8c, 0xa4, 0x78, 0x44, 0x65, 0x00, 0x00, 0x10, 0xec, 0x30,
+	     0xf0, 0xb5, 0xf5, 0xda, 0x15, 0x91, 0xb4, 0x95, 0x8d, 0x37,
+	     0x07, 0x00, 0xe0, 0x0d, 0xc8, 0x94, 0x61, 0xc4, 0x86, 0x81,
+	     0xea, 0xa7, 0x1c, 0x07, 0x00, 0x00, 0x39, 0x02, 0x00, 0xb8,
+	     0x29, 0xe8, 0x25, 0x7e, 0x55, 0xb0, 0x4d, 0x95, 0x9c, 0x9b,
+	     0xe5, 0xfb, 0x04, 0x00, 0xb8, 0x34, 0x02, 0x00, 0x00, 0x00,
+	     0x9d, 0x20, 0x15, 0x0a, 0x00, 0xc0, 0xcd, 0x25, 0x64, 0xf8,
+	     0x31, 0xc1, 0x70, 0x8e, 0x6b, 0x33, 0x34, 0x48, 0x64, 0x69,
+	     0xca, 0x76, 0x81, 0x23, 0xac, 0x35, 0x12, 0xe5, 0xf6, 0x46,
+	     0x79, 0x16, 0x68, 0x09, 0x00, 0x20, 0xd2, 0x64, 0x9b, 0x44,
+	     0x54, 0xaa, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x80, 0x25, 0xd9, 0xf4, 0x72, 0x13, 0x8e, 0xe5, 0x78, 0x78,
+	     0xe3, 0xa4, 0xa2, 0x00, 0x6e, 0x25, 0xd9, 0x03, 0x00, 0xd0,
+	     0x67, 0x38, 0x30, 0xc4, 0x47, 0x99, 0x80, 0x5f, 0x5a, 0xf4,
+	     0x45, 0x0f, 0x66, 0xf5, 0xf0, 0x41, 0x00, 0x00, 0xd2, 0x67,
+	     0xa6, 0x2c, 0xf1, 0x21, 0x00, 0x40, 0x82, 0xa6, 0xdb, 0xa0,
+	     0x0c, 0xbe, 0x0a, 0x1f, 0x50, 0x81, 0xc0, 0x8d, 0xe6, 0x21,
+	     0x03, 0x3d, 0xd2, 0xb2, 0x10, 0x54, 0x35, 0x1c, 0x01, 0x00,
+	     0x2b, 0x4b, 0xd8, 0xe5, 0xec, 0xe3, 0x48, 0x64, 0xab, 0xc2,
+	     0xa4, 0x00, 0x4b, 0x5c, 0x0b, 0xb0, 0x2a, 0x0a, 0xa3, 0x0d,
+	     0xab, 0xe4, 0xa5, 0x20, 0x6b, 0x2e, 0x06, 0x19, 0x83, 0x64,
+	     0x74, 0xb4, 0xc1, 0xc9, 0x05, 0x02, 0x00, 0x80, 0x1e, 0x9a,
+	     0x9d, 0xad, 0xa7, 0x00, 0x00, 0xc0, 0x41, 0xce, 0xdc, 0xf5,
+	     0x04, 0xe2, 0xb0, 0xdf, 0xba, 0xfa, 0x19, 0x09, 0xa4, 0x40,
+	     0xed, 0x93, 0x1e, 0x8e, 0xb1, 0x88, 0x8e, 0x44, 0x0a, 0x00,
+	     0x00, 0x70, 0xc8, 0x7a, 0x4c, 0xda, 0x36, 0xb9, 0x84, 0xea,
+	     0x87, 0xf1, 0x94, 0x2f, 0x9a, 0xdf, 0xfc, 0xae, 0xb2, 0x35,
+	     0x00, 0x80, 0xde, 0x21, 0x00, 0xc0, 0x65, 0xc9, 0xfe, 0x93,
+	     0xa4, 0x09, 0x1b, 0xa2, 0x53, 0x10, 0x2e, 0x00, 0x00, 0x2d,
+	     0xae, 0xf7, 0x57, 0x52, 0xcb, 0x0e, 0x79, 0x88, 0x4a, 0x29,
+	     0xb5, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x93, 0x15, 0x3b, 0x31,
+	     0x38, 0x44, 0xa7, 0x00, 0x00, 0xb6, 0xbc, 0xc0, 0xc2, 0xa0,
+	     0x28, 0x17, 0xd6, 0x01, 0x11, 0x71, 0x99, 0xa6, 0x00, 0x00,
+	     0xbe, 0x0d, 0x94, 0x04, 0xd9, 0xe8, 0x9f, 0x06, 0x00, 0xc8,
+	     0x73, 0xe1, 0x1d, 0xc0, 0x50, 0x1a, 0x16, 0x00, 0x00, 0xf6,
+	     0x2d, 0xd3, 0x11, 0x1b, 0x00, 0x00, 0x80, 0xf4, 0x7e, 0x63,
+	     0x20, 0x03, 0x9f, 0x0c, 0xaf, 0xa0, 0x38, 0x71, 0x4b, 0x91,
+	     0x2d, 0x98, 0xbd, 0xee, 0x68, 0x00, 0x00, 0x5c, 0x44, 0x5d,
+	     0x01, 0x00, 0x00, 0x00, 0x98, 0x0b, 0xc1, 0xd9, 0x00, 0x00,
+	     0x00, 0x00, 0xf7, 0xa2, 0xef, 0x0f, 0xad, 0x01, 0x00, 0x28,
+	     0x7e, 0x8c, 0x1c, 0x81, 0x76, 0x09, 0x2e, 0x00, 0x40, 0x65,
+	     0x10, 0x82, 0x78, 0x25, 0xd3, 0xec, 0xb0, 0x10, 0xb2, 0x7b,
+	     0x00, 0x00, 0x55, 0xe6, 0x2d, 0xe6, 0x24, 0xc0, 0xb3, 0xe0,
+	     0xc1, 0x01, 0x00, 0x00, 0x00, 0x0c, 0xb9, 0xcb, 0x88, 0x54,
+	     0x8d, 0xd2, 0x01, 0x00, 0x28, 0x56, 0x24, 0xa6, 0x5a, 0x56,
+	     0x58, 0x41, 0x0d, 0x12, 0x00, 0x20, 0x43, 0x09, 0xdf, 0x53,
+	     0x71, 0xcd, 0x01, 0x6e, 0x5f, 0xeb, 0x84, 0xe9, 0x61, 0x77,
+	     0x50, 0x35, 0xf8, 0x29, 0x7a, 0x23, 0x81, 0x77, 0x00, 0x00,
+	     0x55, 0x94, 0x18, 0x59, 0x24, 0x22, 0x1d, 0x37, 0xa3, 0x4b,
+	     0x35, 0x0d, 0x46, 0x86, 0x80, 0xbd, 0x07, 0x00, 0xdb, 0x04,
+	     0xab, 0xe1, 0x94, 0x3b, 0x04, 0x00, 0xc8, 0x73, 0xda, 0x87,
+	     0x96, 0x14, 0x00, 0x00, 0x59, 0x41, 0x1f, 0xa5, 0x20, 0x19,
+	     0x58, 0x88, 0x73, 0x4e, 0x8c, 0x21, 0x9c, 0xb5, 0x0f, 0x00,
+	     0x00, 0x00, 0x50, 0xf5, 0x69, 0x47, 0x50, 0x23, 0x04, 0x97,
+	     0x83, 0xae, 0x78, 0xd8, 0xaa, 0x05, 0x00, 0xd0, 0x54, 0x7a,
+	     0x1d, 0xfe, 0x1d, 0xa2, 0x1d, 0x00, 0x00, 0xc6, 0x48, 0xb1,
+	     0xab, 0xbd, 0xe6, 0x6e, 0x34, 0x31, 0x32, 0xd7, 0x8a, 0x40,
+	     0x00, 0x00, 0x1d, 0xde, 0x57, 0x0a, 0x45, 0x88, 0x7e, 0x5a,
+	     0x24, 0xdc, 0x1e, 0xbe, 0x9a, 0x1d, 0x8f, 0x4f, 0x48, 0x68,
+	     0x0e, 0x00, 0x10, 0xda, 0x78, 0x63, 0xba, 0x2d, 0x00, 0x00,
+	     0xa9, 0x25, 0x58, 0x96, 0x6c, 0xc5, 0x1e, 0xe3, 0x9a, 0x9b,
+	     0x6c, 0xc9, 0x2b, 0x68, 0x7f, 0x49, 0x27, 0x0c, 0x02, 0x00,
+	     0xe0, 0x6d, 0xb1, 0x72, 0x50, 0xad, 0x00, 0x74, 0xb8, 0x17,
+	     0x4e, 0x4b, 0x6f, 0x9d, 0x8e, 0x86, 0x3d, 0x22, 0x7c, 0xc2,
+	     0x09, 0x00, 0x00, 0xc4, 0x45, 0x00, 0x00, 0x44, 0x14, 0x00,
+	     0xe0, 0xb2, 0xe8, 0x74, 0x99, 0x75, 0xb5, 0x82, 0x9a, 0x89,
+	     0x97, 0x17, 0xba, 0x49, 0x05, 0x68, 0x9f, 0xb2, 0xf4, 0x01,
+	     0x00, 0x00, 0x00, 0xd2, 0x4b, 0xa7, 0x0d, 0x21, 0xdd, 0xa2,
+	     0x51, 0x22, 0x74, 0x38, 0x5b, 0x3b, 0x3c, 0x67, 0x00, 0x00,
+	     0xfb, 0x8c, 0xb7, 0x20, 0xeb, 0x0e, 0x00, 0x20, 0x55, 0x00,
+	     0x00, 0x0c, 0xe0, 0xe0, 0x3f, 0xc5, 0x4d, 0x62, 0x13, 0x7a,
+	     0x44, 0xa4, 0x03, 0xa0, 0xc2, 0x91, 0x94, 0x3a, 0x50, 0x15,
+	     0xc5, 0x48, 0x57, 0x99, 0x1b, 0xee, 0x0c, 0x95, 0x64, 0x41,
+	     0xc3, 0x40, 0x4f, 0xb8, 0x2d, 0xec, 0x1e, 0x00, 0x40, 0xc3,
+	     0x42, 0xd2, 0xe1, 0x6e, 0x33, 0xb7, 0x31, 0x7e, 0x10, 0x08,
+	     0xe5, 0x90, 0x20, 0x81, 0xfd, 0xf1, 0x82, 0x97, 0x14, 0x51,
+	     0x45, 0x02, 0x00, 0x00, 0x00, 0x68, 0xb9, 0xb3, 0x94, 0x99,
+	     0x0d, 0x00, 0xb0, 0x53, 0x01, 0x00, 0x1c, 0x60, 0xb0, 0x7d,
+	     0xa2, 0xcc, 0x70, 0x4e, 0x0d, 0x23, 0x55, 0x32, 0x60, 0x31,
+	     0x78, 0xa4, 0x57, 0x36, 0x67, 0x7b, 0x1f, 0x65, 0x44, 0x23,
+	     0x01, 0x1e, 0x98, 0x27, 0x00, 0x00, 0x48, 0x87, 0x06, 0x12,
+	     0x2d, 0x0f, 0xab, 0x5f, 0x2e, 0x51, 0x7e, 0xb9, 0xcc, 0x03,
+	     0x00, 0x40, 0x53, 0x3c, 0x0d, 0x00, 0x00, 0xae, 0x5a, 0x0e,
+	     0x31, 0x20, 0x34, 0x39, 0x9b, 0x09, 0x0d, 0x22, 0x49, 0x64,
+	     0x3f, 0x91, 0x2d, 0x83, 0x5a, 0xe7, 0xe1, 0x72, 0x44, 0x8a,
+	     0xe8, 0xc9, 0xbb, 0x00, 0x00, 0xcb, 0x3e, 0x47, 0x62, 0x14,
+	     0x12, 0x55, 0x65, 0x10, 0xc9, 0x24, 0xd9, 0x2b, 0x03, 0x8c,
+	     0x00, 0x00, 0xa9, 0x0f, 0xab, 0xc2, 0x96, 0xf0, 0xd1, 0x04,
+	     0x00, 0x9c, 0x21, 0x15, 0x64, 0x3a, 0x43, 0xdb, 0x40, 0xeb,
+	     0x44, 0x67, 0x53, 0x5f, 0x7a, 0x23, 0x40, 0x71, 0xda, 0x9a,
+	     0xce, 0xb4, 0x4a, 0x92, 0x08, 0xd0, 0xae, 0x82, 0xae, 0x01,
+	     0x00, 0xc4, 0x3b, 0x00, 0x00, 0x71, 0x89, 0x0e, 0x11, 0x00,
+	     0xc0, 0x6c, 0xa5, 0xd3, 0x0a, 0x5e, 0xa2, 0xe4, 0xec, 0x4a,
+	     0x00, 0x80, 0x58, 0x07, 0x00, 0x00, 0x00, 0xa0, 0xc4, 0x04,
+	     0x00, 0x70, 0x90, 0xf0, 0x20, 0x00, 0x00, 0x62, 0x65, 0x36,
+	     0x00, 0x3b, 0x55, 0x84, 0x0a, 0xf8, 0x80, 0x51, 0x40, 0x25,
+	     0x2a, 0x22, 0x9b, 0xd1, 0xa2, 0x2a, 0x03, 0x56, 0xdd, 0xbb,
+	     0x9a, 0x6d, 0x5d, 0x4a, 0x44, 0x00, 0x80, 0x26, 0x41, 0x62,
+	     0xe9, 0x78, 0x35, 0xe9, 0x01, 0x00, 0x9c, 0x49, 0x16, 0x6e,
+	     0x95, 0x17, 0x75, 0x1d, 0x73, 0xec, 0x98, 0x01, 0x00, 0x00,
+	     0x00, 0x44, 0x0d, 0x2e, 0x18, 0x07, 0x83, 0x29, 0xd3, 0x4a,
+	     0x8e, 0x54, 0x35, 0x32, 0x03, 0x00, 0x78, 0xe2, 0x00, 0x00,
+	     0x1f, 0x01, 0xa9, 0x1b, 0x00, 0xa0, 0x3e, 0x03, 0x00, 0x00,
+	     0x3a, 0xf8, 0x0f, 0x10, 0x59, 0x90, 0x2b, 0x49, 0xc8, 0x86,
+	     0x82, 0x64, 0x17, 0x6c, 0xe2, 0x7e, 0xed, 0x39, 0x44, 0x70,
+	     0xd5, 0xc4, 0xd3, 0x8e, 0xef, 0x06, 0xa7, 0xf8, 0xc2, 0x22,
+	     0x15, 0x4d, 0xe6, 0x5a, 0x92, 0x00, 0x80, 0xd3, 0x46, 0x69,
+	     0xab, 0x74, 0x84, 0x21, 0xac, 0x62, 0xbc, 0x37, 0x01, 0x00,
+	     0x40, 0x46, 0x2a, 0x45, 0x35, 0x0d, 0x8e, 0xd1, 0x16, 0x01,
+	     0x00, 0x6c, 0x19, 0xed, 0x54, 0x00, 0x00, 0x00, 0x00, 0xe4,
+	     0xad, 0xf7, 0x67, 0x55, 0x61, 0x4c, 0x86, 0xd8, 0x00, 0x00,
+	     0x44, 0x42, 0xeb, 0xde, 0xe7, 0x6f, 0x98, 0x03, 0x7e, 0x4c,
+	     0x49, 0xba, 0x75, 0x06, 0x08, 0xd8, 0xa9, 0x4e, 0x11, 0x90,
+	     0x12, 0x3d, 0x05, 0x00, 0x50, 0x04, 0x1a, 0xf3, 0x9c, 0x78,
+	     0x4f, 0xbf, 0x1e, 0x8f, 0xd6, 0x8c, 0x1b, 0x08, 0x00, 0x00,
+	     0x00, 0x08, 0x05, 0xa4, 0x59, 0x80, 0x02, 0x56, 0x13, 0x00,
+	     0x40, 0xcd, 0x06, 0x0d, 0x18, 0x51, 0xb2, 0x40, 0x4c, 0x7f,
+	     0x9d, 0x42, 0xa9, 0xc6, 0x0d, 0x66, 0x14, 0x18, 0x82, 0x7c,
+	     0x46, 0xb9, 0xc7, 0xb0, 0x1a, 0x45, 0xca, 0x15, 0xd1, 0xf4,
+	     0xa5, 0x0a, 0x03, 0x74, 0xbb, 0xce, 0x40, 0xa8, 0x00, 0x00,
+	     0xf3, 0x14, 0x00, 0xc0, 0x40, 0xc1, 0x50, 0xe6, 0x1f, 0xca,
+	     0x2b, 0xda, 0xcf, 0x1e, 0x5c, 0xae, 0x0c, 0x65, 0x4b, 0x2f,
+	     0xc1, 0x3b, 0x65, 0x25, 0x28, 0x72, 0x01, 0x00, 0x2c, 0x6e,
+	     0x74, 0x34, 0xc8, 0xd2, 0x07, 0x0f, 0x00, 0x40, 0x9f, 0xa4,
+	     0xf6, 0x30, 0x2e, 0x2c, 0x79, 0x98, 0x01, 0x93, 0x42, 0xfe,
+	     0x00, 0x00, 0xa0, 0xf4, 0x09, 0xb0, 0x00, 0x00, 0x00, 0x00,
+	     0xde, 0x9b, 0x38, 0x9e, 0xf0, 0x00, 0x00, 0x00, 0xf3, 0xe3,
+	     0x1c, 0x1a, 0x02, 0xb0, 0x49, 0x80, 0x18, 0x00, 0x40, 0x35,
+	     0x88, 0x3a, 0x10, 0x97, 0x00, 0x00, 0x9c, 0x49, 0x86, 0x93,
+	     0x41, 0x42, 0x00, 0x00, 0x00, 0xc0, 0x92, 0x42, 0x7c, 0x91,
+	     0xc1, 0xdc, 0x9d, 0xda, 0x02, 0x7b, 0xcb, 0x39, 0x0d, 0xbe,
+	     0xad, 0xa0, 0x05, 0x00, 0x00, 0x00, 0x24, 0x4a, 0x96, 0x0d,
+	     0x24, 0x93, 0xec, 0xdf, 0xe9, 0x41, 0x3c, 0x00, 0x00, 0x38,
+	     0x68, 0xde, 0x41, 0xf4, 0x59, 0x00, 0x00, 0x98, 0x64, 0x0a,
+	     0xb1, 0x1f, 0x16, 0x2d, 0xa9, 0x75, 0xec, 0x85, 0x00, 0x00,
+	     0x19, 0xca, 0xf0, 0x04, 0x94, 0x49, 0x9b, 0xe5, 0x27, 0x78,
+	     0x9b, 0xa9, 0x2d, 0x4a, 0x10, 0x1c, 0x02, 0x00, 0x00, 0x78,
+	     0x60, 0x45, 0xd1, 0xed, 0xb3, 0x6c, 0x01, 0x00, 0xbe, 0x22,
+	     0xf5, 0x19, 0xad, 0xdc, 0xff, 0x0a, 0x00, 0x70, 0x59, 0x79,
+	     0x9c, 0xa1, 0x89, 0xca, 0x2f, 0xa0, 0x3d, 0x73, 0xd0, 0x69,
+	     0xc2, 0x7c, 0x35, 0xfd, 0x40, 0x0f, 0xd8, 0x15, 0x75, 0x49,
+	     0xc7, 0x4a, 0xd8, 0x5f, 0x66, 0x08, 0x00, 0x80, 0x0d, 0x00,
+	     0x00, 0xf0, 0xcd, 0x42, 0x0d, 0x06, 0x0e, 0x42, 0x19, 0x00,
+	     0x00, 0x00, 0x70, 0xa7, 0x22, 0xd0, 0x01, 0x0c, 0x03, 0x64,
+	     0x9e, 0x8a, 0x0b, 0x58, 0x76, 0xf2, 0x02, 0xe1, 0x35, 0x02,
+	     0x3f, 0xae, 0x5e, 0x4c, 0x15, 0x00, 0x00, 0xb6, 0x23, 0x00,
+	     0x00, 0x00, 0x80, 0x41, 0x7c, 0x82, 0x20, 0x0d, 0xa2, 0x25,
+	     0x00, 0x00, 0x62, 0x98, 0x14, 0x03, 0x17, 0xc1, 0x56, 0x93,
+	     0xa0, 0x00, 0x00, 0xa2, 0x7a, 0xcc, 0xb0, 0x7f, 0x99, 0x90,
+	     0xf1, 0xe4, 0x03, 0x00, 0x00, 0x56, 0x01, 0x00, 0xbe, 0x62,
+	     0x00, 0x00, 0x00, 0x40, 0xdd, 0x65, 0x86, 0xb6, 0x78, 0x4c,
+	     0x2a, 0x10, 0xff, 0x60, 0x77, 0xf0, 0x18, 0x9f, 0x40, 0x99,
+	     0xa0, 0xe8, 0xc4, 0x8c, 0x59, 0x27, 0x4e, 0x4e, 0x1e, 0x1b,
+	     0xa8, 0x4b, 0xce, 0x0d, 0x00, 0x20, 0xeb, 0x96, 0xf2, 0xfb,
+	     0x96, 0x01, 0x00, 0xd0, 0x00, 0x62, 0xb2, 0xe9, 0x65, 0x04,
+	     0xae, 0x93, 0x66, 0x4d, 0xea, 0x12, 0x01, 0x00, 0x00, 0x00,
+	     0x64, 0x25, 0x00, 0x00, 0x00, 0x40, 0xa4, 0xe8, 0x49, 0x00,
+	     0x00, 0x98, 0x44, 0xd8, 0x71, 0x8d, 0x91, 0x7e, 0x11, 0x00,
+	     0x20, 0x3c, 0x05, 0xc5, 0x91, 0x52, 0x8c, 0x4a, 0x00, 0x00,
+	     0x41, 0x46, 0x42, 0x8d, 0x70, 0x11, 0xdf, 0x07, 0x00, 0x08,
+	     0xce, 0x00, 0xa5, 0x10, 0x42, 0x16, 0xae, 0x3a, 0x4c, 0xe5,
+	     0x80, 0xab, 0xa1, 0x4a, 0xd9, 0xa1, 0x00, 0x00, 0xf2, 0x17,
+	     0x00, 0x80, 0x01, 0x0e, 0x06, 0x80, 0xad, 0x06, 0x35, 0xb8,
+	     0xc3, 0xe1, 0x0b, 0x7e, 0x7c, 0x16, 0xc6, 0x26, 0xc6, 0x7d,
+	     0xa5, 0x05, 0x76, 0xf1, 0xf8, 0x5c, 0xe1, 0x9a, 0x60, 0x43,
+	     0xc6, 0x06, 0xfc, 0x9f, 0xc7, 0xa9, 0x22, 0xb7, 0xb6, 0x3b,
+	     0x07, 0xb0, 0x83, 0x22, 0x6c, 0x51, 0x31, 0xac, 0xd5, 0x96,
+	     0x92, 0x91, 0xe7, 0x33, 0x02, 0x00, 0xb0, 0x13, 0xca, 0x5d,
+	     0xb4, 0x21, 0x00, 0x00, 0x00, 0x20, 0xcc, 0x06, 0x00, 0xd8,
+	     0x62, 0x11, 0x20, 0x01, 0x00, 0x71, 0x4d, 0xc0, 0x61, 0x08,
+	     0x11, 0x00, 0x00, 0x73, 0x48, 0xda, 0xad, 0x06, 0x9f, 0x92,
+	     0x00, 0x80, 0xe4, 0x84, 0x91, 0x2f, 0x05, 0x61, 0xc3, 0x9b,
+	     0xcd, 0xa0, 0x0b, 0x00, 0x00, 0x4f, 0x06, 0x00, 0x00, 0xa4,
+	     0x12, 0x00, 0x00, 0x5e, 0x6b, 0x5d, 0xf9, 0xba, 0xc8, 0x7c,
+	     0x5e, 0xaa, 0xe5, 0x08, 0x00, 0xe0, 0xb7, 0x39, 0x48, 0x01,
+	     0x00, 0x40, 0x03, 0xf6, 0x72, 0xfe, 0xc2, 0x52, 0x09, 0x60,
+	     0x12, 0x0e, 0xf5, 0x7f, 0x1c, 0x18, 0xd9, 0x30, 0xf2, 0x44,
+	     0x99, 0xcc, 0xec, 0xe0, 0x50, 0x08, 0x00, 0x60, 0x7f, 0x03,
+	     0x00, 0x00, 0x8c, 0x00, 0x00, 0xac, 0x09, 0x3d, 0xa6, 0x77,
+	     0xa5, 0xbb, 0x36, 0xaf, 0x1b, 0xc6, 0xad, 0x60, 0xf8, 0x84,
+	     0xf7, 0x09, 0x00, 0x80, 0x86, 0x0a, 0x00, 0x70, 0x60, 0x30,
+	     0x6a, 0x8a, 0x1a, 0xe3, 0x92, 0xf4, 0x01, 0x00, 0x40, 0x98,
+	     0x69, 0xc0, 0xa0, 0xde, 0x24, 0x6d, 0x4c, 0x64, 0x24, 0x88,
+	     0xfe, 0x39, 0x00, 0x80, 0x9c, 0x07, 0x99, 0xb1, 0xa8, 0xd9,
+	     0x09, 0xf2, 0xa7, 0xb2, 0x34, 0xc0, 0xb4, 0xd6, 0x0a, 0x28,
+	     0x06, 0xbc, 0x46, 0xbd, 0x93, 0x07, 0x41, 0xac, 0x00, 0x00,
+	     0x04, 0x04, 0x0c, 0x10, 0x05, 0x04, 0x00, 0xb0, 0x16, 0x7b,
+	     0xd3, 0x0d, 0xe4, 0xb0, 0x0c, 0xd7, 0x26, 0x00, 0x00, 0x44,
+	     0xa4, 0xe5, 0x00, 0x00, 0x80, 0x01, 0x65, 0xa6, 0xec, 0x12,
+	     0x63, 0x92, 0xd9, 0x88, 0x26, 0x10, 0x00, 0x10, 0x69, 0xcc,
+	     0x00, 0x55, 0x24, 0xc1, 0x7b, 0xff, 0x0c, 0x3e, 0x22, 0xc4,
+	     0xb0, 0x07, 0x67, 0x98, 0x04, 0x00, 0x00, 0x00, 0x08, 0x98,
+	     0x16, 0x32, 0x00, 0x40, 0x6f, 0x31, 0x11, 0xd6, 0x8c, 0x4a,
+	     0x59, 0x24, 0xbf, 0x7e, 0x86, 0x00, 0x80, 0xda, 0xcf, 0x22,
+	     0x86, 0x91, 0x02, 0xc0, 0xe8, 0x8f, 0xf4, 0x70, 0x3c, 0x78,
+	     0xf0, 0x26, 0x00, 0x40, 0xfb, 0x10, 0xd5, 0x58, 0x15, 0xe1,
+	     0x50, 0x80, 0x47, 0x68, 0x8a, 0x24, 0x80, 0x84, 0xc9, 0x2b,
+	     0x07, 0xc1, 0x03, 0x00, 0xe8, 0xb0, 0x19, 0xf8, 0x26, 0x39,
+	     0x8a, 0x3e, 0xab, 0x61, 0x7b, 0x50, 0x5d, 0x00, 0x00, 0x38,
+	     0x3c, 0x00, 0x00, 0xc6, 0x12, 0x01, 0xb5, 0x1c, 0x82, 0x12,
+	     0xb3, 0x26, 0x72, 0x34, 0xea, 0xeb, 0x01, 0x00, 0xa4, 0x24,
+	     0x44, 0x85, 0x2c, 0xcc, 0xda, 0x8c, 0xc6, 0x34, 0x1f, 0x01,
+	     0x8e, 0x6d, 0x07, 0x93, 0x5d, 0x00, 0x00, 0x8b, 0x50, 0xf2,
+	     0xac, 0xed, 0x41, 0xf0, 0x02, 0x00, 0x08, 0xbe, 0x00, 0x00,
+	     0xe6, 0xca, 0x05, 0xc9, 0xdc, 0xce, 0xa5, 0x03, 0x00, 0xc8,
+	     0x4c, 0xec, 0x31, 0x18, 0x79, 0x26, 0x4c, 0x2b, 0x1d, 0x00,
+	     0x20, 0x70, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x2f,
+	     0xd3, 0xb0, 0xea, 0xcb, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0xcc, 0x9c, 0x00, 0x00, 0x88, 0xab, 0xb6, 0xde, 0x45,
+	     0xab, 0xd4, 0xe2, 0xf8, 0xfb, 0x55, 0x44, 0x8e, 0x00, 0x00,
+	     0x3d, 0xcb, 0x29, 0x62, 0x61, 0xaf, 0xf7, 0x02, 0x58, 0xcb,
+	     0x10, 0xc1, 0x85, 0x7c, 0x78, 0x53, 0x89, 0xaa, 0x53, 0x3a,
+	     0x2d, 0x12, 0x42, 0xf8, 0x61, 0xa2, 0x01, 0x00, 0xd6, 0x80,
+	     0xdf, 0x2b, 0x75, 0x1e, 0xfd, 0x12, 0xd1, 0x90, 0x02, 0x2c,
+	     0x49, 0x01, 0x0f, 0x9d, 0x25, 0xc7, 0x8b, 0x3a, 0x1d, 0xe5,
+	     0x2b, 0x12, 0xe4, 0x6f, 0x4b, 0xdf, 0x90, 0x0d, 0xef, 0x59,
+	     0xc8, 0x86, 0xb5, 0x26, 0x00, 0xc0, 0xb9, 0x00, 0x00, 0x00,
+	     0x00, 0xa8, 0xd4, 0x0c, 0x22, 0x79, 0x22, 0x73, 0xe3, 0x04,
+	     0x0a, 0x00, 0x30, 0x2c, 0x13, 0x9d, 0x78, 0xf4, 0xa6, 0x76,
+	     0x2f, 0x31, 0x10, 0x04, 0x52, 0x6e, 0xae, 0x20, 0x76, 0x30,
+	     0x39, 0x2a, 0xc0, 0xc8, 0x33, 0x01, 0x16, 0x00, 0x40, 0x2e,
+	     0x66, 0x4b, 0x65, 0x38, 0x48, 0xe7, 0x9d, 0x43, 0x64, 0x64,
+	     0x00, 0x80, 0x04, 0x47, 0xd9, 0x66, 0x0f, 0x46, 0xa0, 0x71,
+	     0x2a, 0x1c, 0xee, 0x82, 0x5b, 0x8c, 0x26, 0xe1, 0x24, 0x19,
+	     0x09, 0x00, 0x80, 0x45, 0x6b, 0xdf, 0x79, 0x5b, 0x78, 0x5c,
+	     0x00, 0x00, 0x0e, 0x4e, 0xf2, 0xc5, 0xea, 0xd5, 0x99, 0xab,
+	     0xcf, 0x00, 0x00, 0x3a, 0x1b, 0xe9, 0xc2, 0xe4, 0x1f, 0x7a,
+	     0x49, 0x45, 0x02, 0x00, 0xb8, 0x78, 0x9c, 0xe7, 0x06, 0x53,
+	     0xad, 0x4a, 0xfb, 0x1e, 0xad, 0xa1, 0xc4, 0x87, 0x86, 0xb2,
+	     0x01, 0xdd, 0xf0, 0x58, 0x37, 0x8a, 0xa1, 0x21, 0x4b, 0xce,
+	     0x82, 0xe7, 0x23, 0xf3, 0x28, 0xbb, 0x70, 0xa6, 0xba, 0x8e,
+	     0x1a, 0x9b, 0x24, 0x5a, 0x2e, 0x05, 0xb3, 0x01, 0x00, 0x70,
+	     0xe2, 0xac, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x13, 0x00,
+	     0x40, 0xce, 0xe4, 0x95, 0xa2, 0x54, 0x2d, 0xcd, 0xb2, 0x07,
+	     0x13, 0xae, 0x2f, 0x09, 0x00, 0x60, 0x03, 0x47, 0x18, 0x04,
+	     0x00, 0x60, 0x2b, 0x9f, 0x3b, 0x22, 0x22, 0xcf, 0x26, 0x00,
+	     0xc0, 0xfb, 0x03, 0x06, 0x03, 0x00, 0x60, 0xe1, 0x12, 0x41,
+	     0x07, 0x23, 0x00, 0x80, 0x59, 0x0b, 0x00, 0x00, 0xf9, 0x02,
+	     0x00, 0x64, 0x34, 0x9d, 0x96, 0xeb, 0x0c, 0xc7, 0xe3, 0x64,
+	     0x08, 0x00, 0xd0, 0xa3, 0xbc, 0x25, 0x00, 0x00, 0xba, 0x80,
+	     0x8a, 0x3a, 0x3a, 0x24, 0x9f, 0x42, 0x26, 0x04, 0x00, 0x28,
+	     0xf3, 0xf0, 0x01, 0x49, 0x6a, 0xc0, 0xa9, 0xf2, 0x41, 0xa7,
+	     0xf2, 0x4c, 0x07, 0x00, 0x00, 0x00, 0x54, 0xea, 0x00, 0x00,
+	     0x45, 0x0f, 0x1f, 0x06, 0x00, 0x60, 0x26, 0x09, 0x00, 0xb8,
+	     0x36, 0x11, 0x4a, 0xb2, 0x78, 0x00, 0x80, 0xd9, 0x51, 0xf1,
+	     0x8c, 0x81, 0x59, 0xf7, 0xdb, 0x06, 0x7a, 0x63, 0x34, 0x3f,
+	     0x52, 0x90, 0x01, 0x43, 0xa0, 0x07, 0x00, 0xb0, 0xdf, 0x2c,
+	     0x34, 0x88, 0xa8, 0x32, 0x1a, 0x00, 0x00, 0x66, 0x55, 0x7e,
+	     0x8a, 0x86, 0xc4, 0xc5, 0x08, 0x4c, 0x01, 0x00, 0x42, 0x82,
+	     0x73, 0x82, 0x47, 0x85, 0x44, 0x47, 0xce, 0x16, 0xfa, 0xa9,
+	     0x80, 0xa1, 0x28, 0x9f, 0x50, 0xa1, 0x4c, 0x95, 0x8a, 0x91,
+	     0x02, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x30, 0x16, 0x01, 0x00,
+	     0xd9, 0x32, 0x63, 0x9d, 0x71, 0x31, 0xd5, 0x88, 0xb9, 0x1c,
+	     0x17, 0x0d, 0x0e, 0x8b, 0x6a, 0xf8, 0x3c, 0xbd, 0x40, 0xb4,
+	     0x05, 0x00, 0xb0, 0x0d, 0xd3, 0xaa, 0x81, 0xcf, 0x40, 0x02,
+	     0x45, 0x06, 0x4c, 0x50, 0x0c, 0x43, 0x23, 0x09, 0x00, 0xd8,
+	     0x51, 0x68, 0x1f, 0x3d, 0x84, 0x47, 0x47, 0xfb, 0xc3, 0x49,
+	     0x66, 0xbb, 0xe3, 0x40, 0xf0, 0x81, 0x20, 0x25, 0x87, 0x44,
+	     0xad, 0x89, 0xba, 0x23, 0x28, 0x8a, 0x96, 0xc8, 0x4e, 0x70,
+	     0x15, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x54, 0x60,
+	     0x28, 0xd1, 0xa0, 0xb2, 0x43, 0xbd, 0x01, 0x00, 0x54, 0x83,
+	     0xb0, 0x03, 0x90, 0x49, 0x6b, 0x07, 0x00, 0xa0, 0xe7, 0x3a,
+	     0x26, 0xee, 0x99, 0x00, 0x00, 0x00, 0x80, 0xfd, 0x23, 0x00,
+	     0x80, 0x6d, 0x03, 0x00, 0xc8, 0x23, 0xd8, 0x95, 0x00, 0x00,
+	     0x9d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+	     0x4e, 0x24, 0x47, 0x1e, 0x42, 0xfa, 0x93, 0xcd, 0x04, 0xb6,
+	     0x2c, 0x4c, 0xc0, 0x49, 0x62, 0x68, 0x56, 0xa1, 0x52, 0x3c,
+	     0xec, 0x93, 0x6a, 0x83, 0xdc, 0xe1, 0x30, 0x04, 0x00, 0x48,
+	     0xea, 0x55, 0xf6, 0x00, 0x00, 0x38, 0x8a, 0x3e, 0x91, 0x2a,
+	     0x82, 0x4b, 0x01, 0x00, 0x08, 0xaf, 0x39, 0x74, 0x00, 0x00,
+	     0xae, 0x20, 0xfe, 0x23, 0x03, 0x84, 0x8a, 0x03, 0x00, 0x90,
+	     0x4b, 0x3c, 0x6e, 0xc4, 0x67, 0x79, 0xba, 0x54, 0x85, 0x22,
+	     0x0a, 0x00, 0x50, 0xd0, 0xd4, 0x30, 0xc2, 0x4a, 0x36, 0x03,
+	     0x4e, 0x21, 0x12, 0x19, 0x00, 0xc0, 0xaf, 0xf9, 0xbb, 0x39,
+	     0x36, 0x90, 0xb3, 0xc2, 0x3a, 0x55, 0x95, 0xa2, 0x92, 0x98,
+	     0xee, 0x1c, 0x60, 0x15, 0x5b, 0x4f, 0x50, 0xf6, 0x88, 0x6d,
+	     0x7a, 0x3c, 0x00, 0x80, 0xda, 0x71, 0x38, 0xf4, 0x39, 0xd3,
+	     0xa7, 0xcc, 0x10, 0x49, 0x54, 0x54, 0x43, 0x23, 0x04, 0x08,
+	     0x43, 0xc1, 0x06, 0x00, 0x70, 0x4d, 0x4a, 0x27, 0x84, 0x53,
+	     0x8f, 0xc7, 0x09, 0x93, 0x0c, 0xee, 0x3c, 0xe7, 0xa6, 0x41,
+	     0x72, 0x34, 0xc0, 0x44, 0x05, 0x52, 0xbf, 0xe5, 0x17, 0xa9,
+	     0x11, 0x00, 0x50, 0x75, 0x04, 0x00, 0xf8, 0xc0, 0x86, 0x49,
+	     0xc1, 0x29, 0xd5, 0x80, 0xf2, 0x87, 0xf6, 0x50, 0xb8, 0x08,
+	     0x26, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x9a, 0x5f, 0x9c, 0xfb,
+	     0x08, 0x43, 0xc7, 0x93, 0x48, 0x18, 0x01, 0x00, 0x88, 0x3a,
+	     0x00, 0x00, 0x00, 0x40, 0x75, 0x06, 0x00, 0x50, 0xa7, 0xd0,
+	     0xe8, 0x01, 0x00, 0x76, 0x21, 0x51, 0xb6, 0x0b, 0xe3, 0xa6,
+	     0x6b, 0x93, 0x02, 0x00, 0x28, 0x23, 0x02, 0x00, 0x94, 0x8c,
+	     0x00, 0x80, 0x0a, 0x99, 0x28, 0xd0, 0x56, 0x20, 0x5b, 0x01,
+	     0x00, 0x54, 0x35, 0x4b, 0x88, 0xce, 0x93, 0x2a, 0x0e, 0xeb,
+	     0x6f, 0x83, 0x05, 0x00, 0x00, 0x00, 0x40, 0x32, 0xda, 0x12,
+	     0x5f, 0x30, 0x9e, 0x0e, 0x7a, 0x28, 0x2c, 0xc1, 0x4f, 0x5a,
+	     0x15, 0x18, 0x70, 0x0c, 0x03, 0x3f, 0x2f, 0x63, 0x1a, 0x00,
+	     0x60, 0x0c, 0x26, 0xd5, 0x03, 0x00, 0x0c, 0xc2, 0xd4, 0x33,
+	     0x00, 0x00, 0x00, 0x80, 0x5f, 0xb2, 0xcb, 0x50, 0x8c, 0x82,
+	     0x3b, 0x05, 0x0b, 0x00, 0x00, 0x64, 0x1f, 0x00, 0x00, 0x00,
+	     0x20, 0x6b, 0xc5, 0x8c, 0x64, 0x53, 0x00, 0x00, 0x26, 0x48,
+	     0x92, 0x05, 0x00, 0x00, 0xa3, 0x12, 0x00, 0xa0, 0xc7, 0xdb,
+	     0x49, 0x2d, 0x92, 0x18, 0x55, 0x00, 0x00, 0x1d, 0xd5, 0xe1,
+	     0x0e, 0x00, 0x00, 0x26, 0xaa, 0x6a, 0xd6, 0x86, 0x00, 0x00,
+	     0x00, 0x00, 0xa0, 0xdf, 0x81, 0xa8, 0x71, 0xb2, 0xc8, 0xc8,
+	     0x56, 0xd1, 0xf4, 0x7c, 0x32, 0xab, 0xcd, 0x1b, 0x91, 0xbe,
+	     0x80, 0x59, 0x09, 0x00, 0x50, 0x40, 0x2a, 0xaa, 0x34, 0x31,
+	     0xab, 0xcc, 0x8a, 0x65, 0xb1, 0xe0, 0xdd, 0x04, 0x2c, 0x2b,
+	     0x69, 0xc6, 0x9c, 0x44, 0x4d, 0x7d, 0x34, 0x24, 0x66, 0x1e,
+	     0x73, 0x2c, 0x80, 0x56, 0x00, 0x00, 0xc0, 0xa7, 0x00, 0x00,
+	     0xd6, 0xcd, 0x98, 0xd1, 0xdc, 0x09, 0x00, 0x30, 0x8d, 0xc8,
+	     0xe4, 0x95, 0xcd, 0xa2, 0x87, 0x4e, 0x09, 0xf4, 0x8e, 0x00,
+	     0x09, 0x00, 0x00, 0x00, 0x78, 0x16, 0xdd, 0x59, 0xee, 0x60,
+	     0x14, 0x4e, 0xe2, 0x02, 0x09, 0x32, 0x52, 0x04, 0x00, 0x00,
+	     0x00, 0xc0, 0x0e, 0x00, 0x00, 0x56, 0x93, 0xe3, 0x09, 0x00,
+	     0x00, 0x93, 0x76, 0x79, 0x7b, 0x75, 0x7c, 0xf4, 0xbe, 0x69,
+	     0x00, 0x80, 0x8a, 0x60, 0x36, 0xb2, 0x69, 0x21, 0x98, 0x01,
+	     0x00, 0x8c, 0xa7, 0xa8, 0x0c, 0x65, 0x1d, 0x00, 0xc0, 0x73,
+	     0xb0, 0x26, 0xe3, 0xde, 0x22, 0xf1, 0x40, 0x1f, 0xcd, 0x9b,
+	     0x00, 0x00, 0x00, 0x80, 0x97, 0x80, 0xa6, 0xc8, 0xce, 0x02,
+	     0x00, 0xcc, 0xf5, 0x88, 0x71, 0x53, 0xa5, 0xcf, 0x14, 0x00,
+	     0xe0, 0xc3, 0x12, 0xd7, 0x01, 0x00, 0x54, 0x71, 0xaa, 0x8e,
+	     0xbe, 0x87, 0xd4, 0xde, 0x06, 0x6d, 0xf8, 0x01, 0x56, 0xf1,
+	     0x49, 0x02, 0x00, 0x26, 0x25, 0x02, 0x01, 0xbd, 0x05, 0x91,
+	     0x4e, 0x96, 0x56, 0xa5, 0x54, 0xd9, 0x84, 0xa9, 0x00, 0x00,
+	     0x4d, 0xb4, 0xec, 0x90, 0x41, 0xcc, 0x0e, 0x31, 0x26, 0xc1,
+	     0x06, 0xb6, 0x81, 0x42, 0x69, 0x00, 0x00, 0x25, 0x5f, 0x7f,
+	     0x13, 0x00, 0x50, 0x81, 0xcc, 0x6c, 0xee, 0xc3, 0x4c, 0x50,
+	     0x76, 0x1f, 0xaa, 0x20, 0x00, 0x40, 0xb5, 0x61, 0x74, 0xba,
+	     0x1f, 0xf0, 0x22, 0x62, 0x39, 0xf0, 0x0a, 0x00, 0x80, 0xf7,
+	     0x0e, 0x59, 0x78, 0x33, 0xe2, 0x18, 0x29, 0x18, 0x65, 0x0d,
+	     0x5a, 0x22, 0xc1, 0xc7, 0x8b, 0xe3, 0x00, 0x85, 0x35, 0x99,
+	     0x04, 0x0a, 0xc5, 0x34, 0x51, 0xd5, 0xa5, 0x9d, 0x1d, 0xaf,
+	     0xce, 0x9b, 0xe4, 0x11, 0x33, 0xa5, 0x79, 0x6f, 0x00, 0x00,
+	     0xbc, 0xcb, 0x91, 0x06, 0x00, 0x00, 0x27, 0x24, 0x99, 0x5c,
+	     0x0c, 0xc2, 0xb5, 0x00, 0x00, 0x10, 0xc4, 0x13, 0x0f, 0x00,
+	     0x20, 0xf9, 0x38, 0xc4, 0x01, 0x00, 0x5c, 0xb6, 0x80, 0x91,
+	     0xfc, 0x8d, 0x39, 0x22, 0x00, 0x40, 0x88, 0x05, 0x00, 0x00,
+	     0x00, 0x18, 0xcb, 0x1e, 0x58, 0xf0, 0x0e, 0x67, 0x02, 0xfb,
+	     0x52, 0x8e, 0x74, 0x7b, 0x2a, 0x45, 0x02, 0x00, 0x00, 0x00,
+	     0x8e, 0x26, 0x06, 0x61, 0xd2, 0x8c, 0x13, 0x89, 0x0e, 0x01,
+	     0xa5, 0x01, 0x00, 0x00, 0x00, 0xbd, 0xb0, 0xab, 0x4d, 0x6e,
+	     0x72, 0x23, 0x03, 0x00, 0x10, 0x0a, 0xe5, 0xbf, 0x36, 0x31,
+	     0x9d, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x3b, 0x01,
+	     0xc0, 0x09, 0x10, 0x60, 0x3e, 0xa6, 0x82, 0xaf, 0xdd, 0x0c,
+	     0x0b, 0x00, 0x50, 0x79, 0xcc, 0xce, 0x10, 0x03, 0x44, 0x42,
+	     0x94, 0x9b, 0xe5, 0xc3, 0x6a, 0x46, 0x6f, 0xf6, 0xae, 0xda,
+	     0x77, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x96, 0x8d, 0xdf, 0xc2,
+	     0xc8, 0xf6, 0x08, 0x00, 0x38, 0x69, 0xe1, 0x24, 0x71, 0x08,
+	     0xc1, 0xb1, 0xfb, 0x08, 0x55, 0x73, 0x08, 0xf5, 0xd1, 0x83,
+	     0xc7, 0xa1, 0x05, 0x2f, 0x46, 0x6f, 0x97, 0x62, 0xd9, 0x74,
+	     0x23, 0xb6, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x34, 0x00, 0x00,
+	     0x4a, 0xa8, 0x0e, 0x08, 0x15, 0xd2, 0x43, 0x04, 0x00, 0x60,
+	     0x18, 0x4e, 0xfc, 0x9a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0xa0, 0xad, 0x92, 0x46, 0x04, 0x00, 0x80, 0x14, 0xad, 0x78,
+	     0x1a, 0x3b, 0xd5, 0x98, 0xb8, 0x2a, 0xcd, 0xf5, 0x10, 0xb2,
+	     0xf2, 0x39, 0x20, 0x28, 0x7a, 0xaf, 0x13, 0x00, 0x80, 0x7b,
+	     0xa9, 0x58, 0x29, 0xda, 0x3a, 0x60, 0x12, 0xf7, 0x70, 0x2c,
+	     0xae, 0x11, 0x8c, 0xa0, 0x78, 0x47, 0x84, 0xf4, 0xe9, 0x70,
+	     0xb9, 0x00, 0x00, 0xd2, 0x8c, 0x49, 0xab, 0x25, 0x4b, 0x16,
+	     0xae, 0x65, 0xd6, 0xf6, 0x98, 0x88, 0x01, 0x00, 0xa0, 0x25,
+	     0xb4, 0xaf, 0x0a, 0xc3, 0x03, 0x71, 0xf7, 0x40, 0xd9, 0x72,
+	     0xbe, 0xe1, 0x7e, 0xf4, 0x31, 0x4d, 0x30, 0x89, 0x46, 0x6e,
+	     0x2e, 0x90, 0xd0, 0x5b, 0xd2, 0x8e, 0xcd, 0x05, 0xb5, 0x22,
+	     0x29, 0x2f, 0xd1, 0x01, 0xc8, 0x89, 0xee, 0x92, 0x46, 0x11,
+	     0x69, 0x18, 0xe9, 0x22, 0x66, 0x00, 0x80, 0x0d, 0x5c, 0xbf,
+	     0x2a, 0x72, 0x25, 0xab, 0x01, 0x00, 0x28, 0x30, 0x01, 0x00,
+	     0x00, 0x80, 0xbd, 0x5b, 0x6d, 0x68, 0xa3, 0x46, 0x74, 0x02,
+	     0x35, 0x6d, 0xc8, 0xba, 0x99, 0xd8, 0x1a, 0x4f, 0xc1, 0xc3,
+	     0x60, 0xfb, 0xa8, 0xc7, 0x04, 0x78, 0xc4, 0x8f, 0xc8, 0x75,
+	     0x00, 0x80, 0xee, 0x10, 0x00, 0xe0, 0x4d, 0x93, 0x85, 0x02,
+	     0x00, 0x38, 0x7e, 0x4c, 0x9a, 0x00, 0x00, 0xaf, 0x8c, 0x41,
+	     0xa9, 0xb8, 0xc9, 0x8b, 0xd0, 0x47, 0xe1, 0x0b, 0x00, 0x00,
+	     0x35, 0xa0, 0xf1, 0x5c, 0xf0, 0x41, 0x88, 0x19, 0x3d, 0x2c,
+	     0xdf, 0x71, 0x12, 0x01, 0x00, 0x01, 0x26, 0x00, 0x00, 0x00,
+	     0xc0, 0x71, 0x16, 0x05, 0x01, 0x00, 0xc4, 0x20, 0xdc, 0x4a,
+	     0x5d, 0x3d, 0x7b, 0xdb, 0x9e, 0x30, 0x7d, 0x35, 0x30, 0xfb,
+	     0x68, 0x00, 0x00, 0x6c, 0x1a, 0x00, 0x80, 0x21, 0x1f, 0xa9,
+	     0xa2, 0xcc, 0x07, 0x00, 0xc8, 0x46, 0x90, 0x60, 0x70, 0x64,
+	     0xd8, 0x37, 0xf9, 0x9e, 0xfd, 0x07, 0x00, 0x80, 0xa9, 0x88,
+	     0x65, 0x02, 0x00, 0x98, 0x29, 0x66, 0x87, 0x2b, 0x8e, 0x8d,
+	     0x0b, 0x00, 0x40, 0xf2, 0x01, 0x00, 0xf4, 0x4e, 0x78, 0x5b,
+	     0x59, 0x23, 0x00, 0x00, 0x61, 0xcf, 0xaa, 0x28, 0xd6, 0x38,
+	     0xa8, 0x4d, 0x76, 0xa6, 0x3f, 0x00, 0x80, 0xb9, 0xc4, 0x2a,
+	     0x6c, 0xd7, 0x03, 0x00, 0x60, 0x3e, 0x02, 0x00, 0x36, 0x09,
+	     0xbc, 0x23, 0x72, 0x11, 0x22, 0x04, 0x00, 0x60, 0x34, 0x1b,
+	     0x09, 0xec, 0x61, 0xe2, 0x50, 0x21, 0xa5, 0x05, 0x1b, 0xa4,
+	     0xa5, 0x38, 0x06, 0x00, 0xf0, 0x3b, 0xad, 0xe6, 0xf8, 0x66,
+	     0x00, 0x80, 0x50, 0x23, 0xe9, 0x92, 0x30, 0x96, 0xda, 0x60,
+	     0x16, 0x74, 0x9b, 0xda, 0x59, 0xe1, 0xc7, 0xc9, 0x23, 0x00,
+	     0xa0, 0x37, 0x00, 0x00, 0x90, 0x1c, 0xd0, 0x9b, 0xcc, 0x48,
+	     0xc0, 0x31, 0x00, 0x80, 0xd7, 0x6a, 0x66, 0x57, 0x4c, 0x0b,
+	     0x08, 0xa2, 0xd9, 0x5e, 0x70, 0xde, 0x13, 0xa2, 0x86, 0x7d,
+	     0x80, 0xf2, 0xe1, 0x6f, 0xfb, 0xdb, 0x35, 0xa8, 0xce, 0x15,
+	     0xd4, 0xa2, 0xd9, 0x88, 0x62, 0x51, 0x9a, 0x21, 0xc7, 0xa4,
+	     0x86, 0xb0, 0x19, 0x58, 0x21, 0x1b, 0x09, 0xdf, 0x17, 0x57,
+	     0x0f, 0x00, 0x70, 0x69, 0x2c, 0x55, 0x61, 0x19, 0x00, 0x00,
+	     0x94, 0x96, 0x7e, 0x5f, 0x0c, 0xd2, 0xe5, 0x07, 0x04, 0x20,
+	     0x2d, 0xa9, 0x0a, 0x0f, 0x82, 0xd7, 0x43, 0x89, 0xa2, 0x9e,
+	     0xf2, 0xbf, 0x74, 0x8d, 0x00, 0x59, 0x89, 0x07, 0x73, 0x38,
+	     0x00, 0x80, 0x65, 0x0f, 0x7b, 0x06, 0x00, 0x00, 0x88, 0x72,
+	     0x22, 0xec, 0x33, 0xec, 0x01, 0x57, 0x94, 0xf0, 0x62, 0xa4,
+	     0x49, 0xd6, 0x68, 0x79, 0xb9, 0x0f, 0x4a, 0x10, 0x01, 0x00,
+	     0xac, 0x47, 0x76, 0x42, 0xf4, 0x52, 0x3a, 0x03, 0x00, 0xf0,
+	     0x27, 0xa5, 0xed, 0x00, 0x00, 0xff, 0x30, 0x00, 0x40, 0x86,
+	     0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x7f, 0xf0, 0x7f,
+	     0x15, 0xaf, 0x0b, 0x55, 0x58, 0xc2, 0xbf, 0xd9, 0xe3, 0x5b,
+	     0x33, 0x6a, 0xa1, 0x2a, 0x5e, 0xf3, 0x15, 0x67, 0xcf, 0xeb,
+	     0x09, 0x24, 0x30, 0x27, 0x04, 0x00, 0xec, 0xcd, 0x20, 0x53,
+	     0xbd, 0x12, 0x85, 0xe4, 0xb4, 0x82, 0x54, 0xa3, 0x6a, 0x41,
+	     0xa4, 0x6d, 0x11, 0xb1, 0x8c, 0xa6, 0xa1, 0x15, 0xdc, 0x1d,
+	     0x61, 0xe0, 0xc6, 0x9f, 0xac, 0xb2, 0x00, 0x00, 0x54, 0x52,
+	     0xe1, 0x03, 0xa0, 0x4b, 0x9e, 0xa5, 0xca, 0xe0, 0xf7, 0x83,
+	     0xd3, 0x51, 0x79, 0x00, 0x00, 0xf6, 0xa7, 0x5d, 0x19, 0xa4,
+	     0x20, 0x61, 0xd3, 0x66, 0x31, 0x65, 0x4d, 0xc0, 0x66, 0x0c,
+	     0x82, 0x1b, 0xaa, 0xa1, 0x06, 0x8e, 0xed, 0x77, 0x4a, 0x1a,
+	     0x4b, 0x1d, 0x37, 0xc5, 0x19, 0x00, 0x00, 0x00, 0x40, 0x22,
+	     0x92, 0x21, 0xb4, 0xa3, 0x04, 0x00, 0x7c, 0xbc, 0x00, 0x00,
+	     0x19, 0x85, 0xad, 0xd6, 0xab, 0xec, 0x65, 0x73, 0x25, 0xc4,
+	     0x83, 0x49, 0x1a, 0x81, 0x64, 0x95, 0x18, 0x64, 0x14, 0x00,
+	     0x80, 0xab, 0x22, 0x94, 0xb2, 0x35, 0xc5, 0x83, 0x74, 0x6c,
+	     0x50, 0x2d, 0x8f, 0x61, 0xe3, 0x4d, 0x6e, 0x97, 0x77, 0xd1,
+	     0x80, 0xe5, 0xfa, 0x50, 0x66, 0x29, 0x2b, 0x04, 0x4d, 0x44,
+	     0x6c, 0x64, 0x47, 0x24, 0x4a, 0xd1, 0x01, 0x00, 0xda, 0x66,
+	     0x93, 0x42, 0x2c, 0xca, 0xf6, 0xc8, 0x27, 0x51, 0xbe, 0xd3,
+	     0x54, 0x00, 0x00, 0xaa, 0x7f, 0x00, 0x00, 0xec, 0x62, 0xa4,
+	     0x67, 0x02, 0x09, 0x00, 0x18, 0x61, 0xb0, 0x04, 0x4b, 0x96,
+	     0x6e, 0x3e, 0x00, 0x00, 0x6e, 0xef, 0x6d, 0x95, 0x8c, 0xa3,
+	     0x5b, 0x00, 0x00, 0xf4, 0x59, 0x84, 0xb5, 0x71, 0x0b, 0x8a,
+	     0x69, 0x6c, 0x24, 0x33, 0x01, 0x00, 0x04, 0xb2, 0xfa, 0x48,
+	     0x89, 0x4c, 0x65, 0x4a, 0x55, 0x71, 0x8f, 0xd3, 0xb0, 0x21,
+	     0x18, 0x86, 0xfa, 0xca, 0x2a, 0x2c, 0x29, 0xd7, 0xd5, 0x2f,
+	     0x03, 0x7e, 0x67, 0x4a, 0x9b, 0x60, 0x58, 0x84, 0x74, 0x41,
+	     0x45, 0x2e, 0xee, 0xc3, 0x7e, 0x09, 0x1f, 0x74, 0x3c, 0x18,
+	     0x8a, 0xc5, 0x54, 0x00, 0x00, 0xe1, 0xc4, 0x9a, 0x13, 0xe0,
+	     0x46, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x38, 0x95, 0xdc, 0x01,
+	     0x42, 0x06, 0x00, 0x80, 0xec, 0xcc, 0x44, 0x08, 0x00, 0x28,
+	     0x49, 0xf1, 0x1a, 0x6c, 0x6c, 0x00, 0x80, 0x43, 0x40, 0xd2,
+	     0x89, 0x1f, 0x54, 0x97, 0x40, 0x01, 0x02, 0x00, 0x24, 0x68,
+	     0x4d, 0x09, 0x7c, 0xdb, 0x74, 0x0b, 0x00, 0xa0, 0xdb, 0x83,
+	     0x70, 0x55, 0x0d, 0x70, 0x92, 0x8f, 0x01, 0x3b, 0x4b, 0x93,
+	     0xc2, 0x36, 0x66, 0x0b, 0x04, 0x00, 0x24, 0x06, 0x37, 0x19,
+	     0xef, 0x2c, 0x64, 0x45, 0x66, 0xed, 0x7e, 0xb8, 0xd9, 0x01,
+	     0x00, 0x18, 0xe7, 0x6a, 0x1d, 0x55, 0x30, 0x7a, 0xe0, 0xbe,
+	     0x91, 0x86, 0x13, 0x2d, 0x03, 0x00, 0x00, 0x00, 0x26, 0x57,
+	     0x36, 0x1c, 0x00, 0x00, 0x54, 0x42, 0xac, 0x87, 0xa1, 0x04,
+	     0x00, 0x88, 0x31, 0x0f, 0x45, 0x8a, 0x28, 0x74, 0xd1, 0x54,
+	     0x25, 0x92, 0x55, 0x95, 0x02, 0x00, 0xbc, 0x58, 0x00, 0x00,
+	     0x7b, 0xaa, 0x07, 0x8d, 0xa2, 0xf1, 0x24, 0x77, 0x3d, 0x51,
+	     0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8b, 0x08, 0x9d,
+	     0x50, 0x1f, 0xc8, 0xfe, 0xe2, 0x26, 0x9a, 0xd9, 0xf4, 0x80,
+	     0x54, 0xc3, 0x77, 0x11, 0x00, 0x00, 0x33, 0xe2, 0x2e, 0x3b,
+	     0x79, 0xf4, 0xdf, 0x52, 0x50, 0x51, 0x0b, 0x00, 0xc0, 0xae,
+	     0xe9, 0x08, 0x45, 0x2c, 0x34, 0x6d, 0x02, 0x00, 0xf6, 0x14,
+	     0x55, 0x42, 0x07, 0xc0, 0xd7, 0xec, 0x7f, 0x19, 0x6a, 0x78,
+	     0x1a, 0x7c, 0xd1, 0x68, 0x60, 0x07, 0xa6, 0xa5, 0x4c, 0x82,
+	     0xa3, 0xc5, 0xf4, 0x78, 0x83, 0x27, 0xa2, 0xba, 0xbe, 0x4b,
+	     0x86, 0xcc, 0x15, 0xdb, 0x21, 0x02, 0xbe, 0x33, 0xf0, 0x21,
+	     0x1c, 0x36, 0x34, 0x94, 0x39, 0x54, 0x22, 0x84, 0xca, 0x92,
+	     0x72, 0xd1, 0x03, 0x00, 0x88, 0xab, 0xb1, 0x3c, 0x00, 0x00,
+	     0xaa, 0xb2, 0xc6, 0xd0, 0x17, 0xa8, 0xa7, 0x89, 0x85, 0x60,
+	     0x52, 0x00, 0x00, 0x30, 0x90, 0x76, 0x20, 0x37, 0xc7, 0x7f,
+	     0xa1, 0x73, 0x07, 0x00, 0x00, 0x00, 0x84, 0x21, 0x24, 0x76,
+	     0x00, 0x80, 0xc5, 0x18, 0x00, 0x00, 0x5c, 0x44, 0xb2, 0x01,
+	     0x00, 0x80, 0xd0, 0x80, 0x6c, 0x70, 0x1b, 0xe1, 0xc1, 0xad,
+	     0x8a, 0x8c, 0x72, 0x3d, 0x80, 0x19, 0xf6, 0xe1, 0xb6, 0x9a,
+	     0x54, 0x84, 0x65, 0x8b, 0xa5, 0x01, 0x00, 0x20, 0xec, 0x73,
+	     0x33, 0x12, 0x53, 0x9c, 0x3d, 0xe3, 0x4d, 0xde, 0x60, 0xa8,
+	     0xc0, 0xa2, 0x33, 0x46, 0x04, 0x00, 0xcc, 0xd2, 0x58, 0x2b,
+	     0xef, 0x2d, 0xfc, 0x01, 0x5c, 0x41, 0x6b, 0xc6, 0x1f, 0x70,
+	     0x90, 0xcc, 0xc6, 0x26, 0x1e, 0x81, 0x47, 0x00, 0xc0, 0x1f,
+	     0xd1, 0x63, 0x73, 0xc2, 0x42, 0x3d, 0x8a, 0x93, 0x4e, 0x37,
+	     0x3c, 0x94, 0xc2, 0x85, 0x0e, 0x67, 0xc3, 0x08, 0x00, 0x00,
+	     0x00, 0x70, 0x21, 0x01, 0x00, 0xa1, 0x2e, 0x49, 0x8c, 0x9d,
+	     0x0c, 0x26, 0xa9, 0x39, 0xa0, 0x53, 0x08, 0xac, 0x00, 0x00,
+	     0xff, 0x19, 0x00, 0xc0, 0x26, 0x93, 0xb9, 0xa0, 0x1b, 0x03,
+	     0x00, 0xb4, 0x00, 0x30, 0x0b, 0x14, 0x0f, 0xb5, 0x0b, 0x00,
+	     0x60, 0xe3, 0xc0, 0xfc, 0x52, 0xdc, 0x75, 0x5d, 0x7c, 0x41,
+	     0x50, 0x49, 0x0e, 0x8e, 0x57, 0x43, 0x53, 0x57, 0x02, 0x41,
+	     0x51, 0x01, 0x8d, 0x8c, 0x8d, 0x92, 0x06, 0x1d, 0xce, 0x4d,
+	     0x02, 0x0e, 0x61, 0x50, 0x52, 0x0d, 0xe1, 0xcc, 0xd0, 0x2d,
+	     0x0d, 0xcd, 0x92, 0x23, 0x00, 0x20, 0x09, 0xe2, 0x0e, 0xa2,
+	     0x59, 0xdd, 0x31, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x4f, 0xf7,
+	     0x0f, 0x00, 0xb0, 0x42, 0xa3, 0x5d, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x21, 0xd4, 0xce, 0x53,
+	     0x35, 0x78, 0x3e, 0x00, 0x00, 0xe1, 0x34, 0x00, 0xc0, 0x87,
+	     0x85, 0x67, 0x08, 0xde, 0xda, 0xd2, 0x00, 0x00, 0x4e, 0x62,
+	     0x89, 0x01, 0x00, 0x80, 0xbc, 0x05, 0x3c, 0x05, 0x00, 0x40,
+	     0x1d, 0x00, 0x00, 0xa6, 0x95, 0x06, 0xa9, 0xe2, 0x02, 0x00,
+	     0x40, 0x60, 0x29, 0x37, 0x5b, 0xe9, 0xe5, 0x15, 0x2c, 0x65,
+	     0xbd, 0x9b, 0xaa, 0x42, 0xed, 0xcd, 0xb3, 0x03, 0x93, 0x44,
+	     0x5c, 0xee, 0x17, 0x00, 0x00, 0x93, 0xb6, 0x56, 0xd1, 0x66,
+	     0x0e, 0x00, 0x50, 0x62, 0x53, 0xe5, 0x61, 0x28, 0x01, 0x00,
+	     0x53, 0xa7, 0x92, 0x8e, 0x1c, 0xf0, 0xb8, 0x31, 0x20, 0x70,
+	     0xa7, 0x88, 0xb3, 0x46, 0x9a, 0x15, 0xbf, 0xeb, 0xc3, 0xd1,
+	     0x02, 0x00, 0x00, 0x00, 0x18, 0xb8, 0x25, 0x41, 0x88, 0x60,
+	     0x9c, 0x4d, 0x3b, 0x85, 0xb0, 0x0a, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0xdc, 0xc5, 0x00, 0x00, 0x44, 0x0a, 0x3f, 0x8b, 0x36,
+	     0x50, 0xac, 0x00, 0x00, 0xb0, 0x87, 0x24, 0x23, 0x49, 0x9a,
+	     0xb4, 0x1f, 0xf2, 0x04, 0x00, 0xa0, 0x64, 0x61, 0x2c, 0x0c,
+	     0x6c, 0x44, 0xb7, 0x3a, 0x52, 0x79, 0xa6, 0xc3, 0x0f, 0x93,
+	     0x2f, 0x89, 0x49, 0x70, 0x38, 0xf6, 0x7c, 0xc3, 0xe8, 0x87,
+	     0xdf, 0x03, 0xd7, 0x45, 0x24, 0x02, 0x00, 0x00, 0x00, 0x80,
+	     0x18, 0xb6, 0x0a, 0xbb, 0x83, 0xda, 0x2b, 0x50, 0x05, 0xa1,
+	     0x05, 0x58, 0xb2, 0x74, 0x9b, 0xb4, 0xa9, 0xe4, 0xca, 0x08,
+	     0x77, 0xb8, 0x06, 0x1b, 0x00, 0xa0, 0xbb, 0xe0, 0x77, 0x49,
+	     0x4b, 0xec, 0x51, 0xda, 0x59, 0x38, 0xc6, 0x26, 0x54, 0x43,
+	     0x64, 0x8c, 0x62, 0x2c, 0x58, 0x2d, 0xc2, 0xf3, 0x00, 0x0a,
+	     0x2c, 0x45, 0xf2, 0x20, 0xdd, 0x0b, 0x00, 0x40, 0xc9, 0xd9,
+	     0x13, 0xaa, 0x8c, 0x00, 0x00, 0x78, 0x19, 0x00, 0x00, 0x93,
+	     0x4f, 0xc0, 0x99, 0x85, 0x98, 0x4b, 0x1e, 0x09, 0xff, 0x24,
+	     0x24, 0x20, 0x85, 0x12, 0x00, 0x00, 0x00, 0xe0, 0xdb, 0x1b,
+	     0x1b, 0x02, 0xd5, 0xb4, 0x48, 0x21, 0x1d, 0x4c, 0x1e, 0xe6,
+	     0x0d, 0x30, 0x23, 0x7b, 0x4c, 0xf6, 0xe0, 0x36, 0x46, 0x41,
+	     0x97, 0x47, 0x00, 0x00, 0x00, 0xc0, 0xd7, 0xa6, 0x5f, 0xf1,
+	     0x21, 0x5c, 0xbf, 0xbe, 0x10, 0xff, 0xa2, 0x44, 0x83, 0x51,
+	     0xe5, 0xa8, 0x37, 0x9d, 0xd8, 0x29, 0x02, 0x00, 0x26, 0x64,
+	     0x0e, 0x89, 0x9d, 0x1e, 0x8a, 0x12, 0x00, 0x30, 0x12, 0xe2,
+	     0x45, 0xda, 0x62, 0xdc, 0x20, 0x76, 0x1c, 0xce, 0x4f, 0xf5,
+	     0x0b, 0x00, 0x20, 0x0d, 0x0a, 0xe8, 0x00, 0x00, 0x00, 0x00,
+	     0xda, 0x14, 0xff, 0xc1, 0x0c, 0x8a, 0xcf, 0xf2, 0x32, 0x3c,
+	     0xa5, 0x71, 0x07, 0xad, 0x29, 0xc5, 0x3b, 0xab, 0xc7, 0x1a,
+	     0xa6, 0x28, 0xc9, 0x27, 0x03, 0x00, 0x14, 0xd6, 0xa2, 0x5c,
+	     0xd0, 0x00, 0xd0, 0x03, 0xcf, 0x03, 0x00, 0xe0, 0x88, 0x01,
+	     0x00, 0xfc, 0x38, 0xcc, 0x6b, 0x00, 0x80, 0xc2, 0x26, 0x29,
+	     0x72, 0x46, 0xe9, 0x0c, 0x01, 0x00, 0x84, 0x0c, 0x3a, 0x40,
+	     0x00, 0x00, 0xfe, 0xdf, 0x73, 0xe3, 0x50, 0x03, 0x00, 0x18,
+	     0x43, 0x68, 0xf3, 0xf2, 0x84, 0x4e, 0xbe, 0x5c, 0x06, 0xbe,
+	     0xea, 0xac, 0x01, 0x00, 0x50, 0x45, 0xc1, 0x68, 0x00, 0x00,
+	     0x16, 0x0f, 0x00, 0xc0, 0x6f, 0xe6, 0x17, 0x49, 0x61, 0x1c,
+	     0x3e, 0x25, 0xec, 0x76, 0x0b, 0x29, 0x27, 0x00, 0xc0, 0xfb,
+	     0x44, 0x41, 0xa8, 0x0d, 0x03, 0x00, 0xf8, 0xcc, 0xa2, 0x95,
+	     0x92, 0x33, 0x8f, 0x94, 0x86, 0xc8, 0x54, 0xb5, 0x6c, 0xf2,
+	     0x12, 0x6a, 0xa3, 0x6a, 0x58, 0x5d, 0x16, 0x00, 0x40, 0xe9,
+	     0x28, 0xbc, 0x49, 0x3d, 0x00, 0x00, 0xbc, 0xe6, 0x1e, 0x50,
+	     0xd1, 0x38, 0x00, 0x00, 0x00, 0xe0, 0x66, 0x89, 0x04, 0x83,
+	     0x83, 0x00, 0x00, 0xb8, 0x13, 0x95, 0x94, 0x0f, 0x94, 0x11,
+	     0x52, 0x21, 0x01, 0x00, 0x78, 0x86, 0x7c, 0x1e, 0x7e, 0x7d,
+	     0x1a, 0xc0, 0xc9, 0x09, 0x00, 0x80, 0xb1, 0x09, 0x71, 0x02,
+	     0x00, 0x00, 0x00, 0x48, 0x5d, 0x2c, 0x8f, 0xa6, 0xa5, 0x9f,
+	     0x92, 0x7c, 0xf4, 0x68, 0xe3, 0x0e, 0x19, 0xb6, 0x00, 0x00,
+	     0xd7, 0x0f, 0x83, 0xd7, 0xbb, 0xcb, 0x8f, 0xa4, 0x53, 0x69,
+	     0x57, 0x4e, 0x13, 0x41, 0x69, 0x70, 0x11, 0x1e, 0x19, 0x00,
+	     0x80, 0x8e, 0xc6, 0xda, 0x68, 0x5a, 0x29, 0x0d, 0xfe, 0x26,
+	     0xc6, 0x92, 0x43, 0x93, 0x55, 0xe0, 0x77, 0x77, 0xac, 0x01,
+	     0x70, 0x00, 0x00, 0x16, 0x5b, 0x23, 0x0c, 0x4e, 0xd9, 0x16,
+	     0x25, 0xf6, 0x10, 0x2b, 0x04, 0x00, 0x58, 0xe5, 0xf8, 0x7f,
+	     0x42, 0x33, 0x00, 0xc0, 0x7f, 0x27, 0x12, 0xd5, 0x16, 0x82,
+	     0x12, 0x9d, 0x1c, 0x70, 0x8b, 0xa5, 0x8d, 0x87, 0x13, 0x00,
+	     0xa0, 0x67, 0xb6, 0x80, 0x04, 0xd9, 0x98, 0x82, 0xa8, 0x6c,
+	     0x5f, 0x46, 0x00, 0x80, 0x1c, 0x26, 0xcd, 0x32, 0x81, 0x80,
+	     0x5c, 0xc9, 0x41, 0x00, 0x00, 0x33, 0x8a, 0xb1, 0x98, 0x3e,
+	     0x26, 0x8d, 0x67, 0xeb, 0x52, 0x26, 0x02, 0x00, 0x00, 0x00,
+	     0x00, 0x80, 0xd5, 0x02, 0x00, 0xc0, 0x48, 0xd4, 0x83, 0x02,
+	     0x2a, 0x71, 0xbf, 0xaa, 0x90, 0x05, 0x98, 0xed, 0x13, 0x00,
+	     0x60, 0xc0, 0x31, 0x4c, 0xbc, 0x8c, 0x95, 0x69, 0x00, 0x00,
+	     0x90, 0xca, 0x91, 0x05, 0x00, 0x20, 0x5d, 0x04, 0x00, 0x78,
+	     0x9e, 0x60, 0x67, 0x2c, 0x86, 0x00, 0x80, 0xa1, 0x0c, 0xa8,
+	     0x20, 0xe5, 0x00, 0x00, 0x40, 0x95, 0x81, 0x37, 0x01, 0x00,
+	     0xfd, 0x02, 0xe6, 0x14, 0x00, 0x00, 0x1a, 0xd3, 0x00, 0x72,
+	     0x28, 0x02, 0x00, 0x78, 0x1d, 0x40, 0x0c, 0xd1, 0xdb, 0xaa,
+	     0x72, 0x4b, 0xe6, 0x03, 0xf0, 0xc6, 0x2d, 0x52, 0x28, 0x96,
+	     0xfd, 0x35, 0x00, 0xc0, 0x86, 0x00, 0x00, 0x40, 0xcc, 0x93,
+	     0x62, 0x4a, 0xf5, 0x08, 0x90, 0x78, 0x26, 0x00, 0x00, 0xb5,
+	     0x32, 0x53, 0x99, 0x29, 0x7b, 0xa1, 0xe8, 0x0e, 0x0b, 0x47,
+	     0x00, 0x00, 0x00, 0xc0, 0x51, 0xf1, 0x7e, 0x64, 0x07, 0x04,
+	     0x00, 0x00, 0x00, 0x56, 0x9b, 0x5d, 0x0e, 0x00, 0xc0, 0x52,
+	     0x0a, 0x00, 0xd0, 0xcd, 0x02, 0x00, 0x2c, 0x0e, 0xb7, 0x07,
+	     0x83, 0x95, 0x0a, 0x60, 0x3e, 0x48, 0x2a, 0x78, 0x60, 0x23,
+	     0x4c, 0x64, 0xb9, 0xa2, 0x4b, 0xfc, 0x08, 0x9f, 0x22, 0x99,
+	     0xf1, 0xbb, 0x63, 0xb8, 0x11, 0x08, 0x9c, 0xd3, 0xea, 0x53,
+	     0xda, 0x44, 0x00, 0x00, 0x81, 0xce, 0x5f, 0x09, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x50, 0x1c, 0xcb, 0x07, 0x57, 0x5c, 0x3b,
+	     0x87, 0xa2, 0x44, 0xec, 0xa2, 0xee, 0x68, 0xad, 0x00, 0x00,
+	     0xff, 0x36, 0xb0, 0x19, 0x06, 0x00, 0x00, 0x10, 0x61, 0x04,
+	     0x00, 0x7c, 0x27, 0xb3, 0x12, 0x99, 0xc4, 0xfe, 0x48, 0xee,
+	     0x08, 0x00, 0x40, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x42, 0x77,
+	     0xc6, 0x8e, 0xa9, 0x60, 0x4f, 0x67, 0x36, 0xe5, 0x53, 0x04,
+	     0x00, 0x7c, 0xa3, 0xc8, 0x6f, 0xdf, 0x44, 0x00, 0xc0, 0x9a,
+	     0x0b, 0x00, 0x70, 0x14, 0xc2, 0x0c, 0x41, 0x59, 0x00, 0x00,
+	     0x00, 0x00, 0x34, 0x1f, 0x1e, 0x2c, 0x70, 0x45, 0x86, 0x61,
+	     0xc5, 0x95, 0x33, 0x34, 0x0d, 0x07, 0xa2, 0x95, 0xc7, 0x23,
+	     0x11, 0x00, 0xd0, 0x6c, 0x03, 0x89, 0xb5, 0x90, 0xce, 0x1d,
+	     0xc5, 0x00, 0x21, 0x1b, 0x00, 0x00, 0x08, 0x59, 0x44, 0x1b,
+	     0xdc, 0xc4, 0x9d, 0xec, 0x51, 0xc7, 0xc5, 0xcd, 0x20, 0x00,
+	     0x00, 0x00, 0x30, 0x01, 0x2b, 0x52, 0x75, 0x33, 0x1b, 0x32,
+	     0xdc, 0x47, 0xe0, 0x42, 0x42, 0x0d, 0xc7, 0x71, 0x8b, 0xb0,
+	     0x68, 0x60, 0xa6, 0x8e, 0x95, 0xc8, 0x01, 0x46, 0x8f, 0xfb,
+	     0x80, 0x83, 0x02, 0x98, 0x4a, 0xda, 0x11, 0xf2, 0x4c, 0x35,
+	     0x6b, 0x3e, 0x00, 0x40, 0xfb, 0x30, 0x49, 0x63, 0x94, 0xe4,
+	     0xa1, 0x41, 0x63, 0xfc, 0x8a, 0x77, 0x84, 0xc9, 0x9d, 0x07,
+	     0x12, 0x4b, 0xf6, 0x52, 0x1c, 0x5a, 0xa1, 0xf4, 0xf0, 0x55,
+	     0x6c, 0x01, 0x6f, 0xc4, 0x5b, 0x10, 0x40, 0x66, 0xe9, 0x1b,
+	     0x2c, 0xb4, 0x34, 0xe4, 0x9a, 0x00, 0x00, 0xee, 0x42, 0x23,
+	     0x47, 0x14, 0x79, 0x9e, 0x24, 0x8c, 0x30, 0x2c, 0x23, 0x2e,
+	     0xe6, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+	     0xa6, 0x09, 0x84, 0xa8, 0x55, 0x05, 0x9e, 0xb5, 0xde, 0xa5,
+	     0xab, 0x3e, 0x91, 0x45, 0x0b, 0x3e, 0x39, 0x7a, 0x82, 0x5a,
+	     0x47, 0xac, 0x40, 0x41, 0x56, 0x4e, 0x63, 0x15, 0xef, 0xaa,
+	     0xeb, 0x5c, 0xa3, 0x66, 0x4a, 0x8e, 0xae, 0xf6, 0xa2, 0xb6,
+	     0x8b, 0x25, 0x04, 0x00, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
+	     0x00, 0x80, 0xdd, 0x07, 0x0a, 0x0b, 0x00, 0x60, 0x1d, 0x78,
+	     0x60, 0x3a, 0xc5, 0xd6, 0x10, 0x46, 0x0f, 0x00, 0x00, 0x00,
+	     0xe0, 0x2a, 0x83, 0x38, 0xfb, 0x9d, 0x01, 0x00, 0xa8, 0x6d,
+	     0xc5, 0x13, 0x00, 0x00, 0x00, 0x40, 0x3a, 0x05, 0x00, 0x80,
+	     0xf4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xc5,
+	     0x6b, 0x6e, 0x36, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x71,
+	     0x95, 0x0e, 0x56, 0xd5, 0x51, 0x30, 0x17, 0x03, 0xac, 0xc8,
+	     0xa0, 0x8c, 0x05, 0x08, 0x2b, 0x74, 0x26, 0xe9, 0x5a, 0x3c,
+	     0xf1, 0x43, 0x15, 0x28, 0x58, 0xbc, 0x2d, 0x0e, 0x9f, 0x15,
+	     0x00, 0x80, 0x93, 0x43, 0x15, 0xc4, 0xba, 0xb1, 0x08, 0x1a,
+	     0xdf, 0x68, 0xc1, 0xdc, 0x0e, 0xb6, 0xbb, 0xb4, 0x25, 0x66,
+	     0x24, 0xe6, 0x06, 0x00, 0xe0, 0xb1, 0x04, 0x12, 0xb6, 0x0c,
+	     0xf0, 0x40, 0x1a, 0x18, 0x4e, 0x04, 0x00, 0x50, 0x16, 0xea,
+	     0x11, 0x5d, 0x7a, 0x0e, 0x01, 0xea, 0x44, 0xb1, 0x9d, 0xa8,
+	     0x86, 0x90, 0xc9, 0x33, 0x44, 0x64, 0x02, 0x00, 0x56, 0x5f,
+	     0x65, 0xa3, 0xc2, 0x51, 0x72, 0xee, 0x2e, 0xe5, 0x44, 0xdc,
+	     0x89, 0xb4, 0x15, 0x4e, 0x06, 0x56, 0x15, 0xeb, 0x07, 0xea,
+	     0x0c, 0xbf, 0x84, 0x42, 0xc0, 0x2e, 0x0c, 0x75, 0x68, 0x38,
+	     0x60, 0x88, 0x72, 0x9f, 0x4c, 0x22, 0x39, 0x24, 0x14, 0x19,
+	     0x4d, 0x30, 0x56, 0xbc, 0x48, 0xbc, 0xbb, 0x44, 0x12, 0x00,
+	     0x40, 0x59, 0xc1, 0x5e, 0xf2, 0xfd, 0x49, 0x0b, 0x1e, 0x66,
+	     0x00, 0x00, 0x8f, 0xc3, 0x01, 0x69, 0x85, 0xb2, 0xb9, 0x1a,
+	     0x43, 0x56, 0xb8, 0x82, 0x06, 0x00, 0x80, 0x57, 0x16, 0xf3,
+	     0xaa, 0xbe, 0x05, 0x00, 0xb8, 0x4c, 0x0c, 0x1a, 0x00, 0x00,
+	     0x20, 0xa1, 0x15, 0x8d, 0x8d, 0x62, 0xe1, 0x03, 0x96, 0x04,
+	     0xf6, 0x14, 0x31, 0xe0, 0x7b, 0xea, 0x2d, 0x24, 0xcd, 0x44,
+	     0x01, 0x00, 0xb0, 0x70, 0x01, 0x00, 0x98, 0x8e, 0xf6, 0x86,
+	     0x70, 0x3f, 0x59, 0xe0, 0x3d, 0xe3, 0x1f, 0x59, 0x57, 0xd8,
+	     0xac, 0x04, 0x83, 0x12, 0x18, 0xb9, 0xa9, 0xc5, 0x1b, 0x00,
+	     0xa0, 0x9d, 0xb2, 0x29, 0x84, 0xd4, 0x0d, 0x60, 0x40, 0x75,
+	     0x37, 0x25, 0xc5, 0xcf, 0x65, 0x09, 0x00, 0x80, 0xfe, 0x32,
+	     0x62, 0x62, 0x6a, 0xaa, 0x6a, 0x00, 0x80, 0xcd, 0xdc, 0xf7,
+	     0x48, 0x58, 0xf6, 0xd9, 0x1c, 0x68, 0xa8, 0x28, 0xb4, 0x3f,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0x60, 0xbb, 0x22,
+	     0x8b, 0x21, 0x98, 0xba, 0x2d, 0x04, 0x89, 0xfd, 0x9c, 0x69,
+	     0x6a, 0x4b, 0xf2, 0x5b, 0x63, 0x0a, 0x3e, 0x74, 0xdc, 0x0f,
+	     0x21, 0x05, 0x00, 0x80, 0xc1, 0x85, 0xb3, 0x01, 0x00, 0xb8,
+	     0xcf, 0x00, 0x00, 0xb6, 0x6e, 0x35, 0x1a, 0x00, 0xd8, 0xa1,
+	     0x02, 0x00, 0x10, 0x13, 0x03, 0x00, 0x78, 0x16, 0x24, 0x15,
+	     0x85, 0x2a, 0xe7, 0x01, 0x00, 0x20, 0xcf, 0x17, 0xe0, 0xaa,
+	     0x10, 0xad, 0x17, 0x12, 0x82, 0x75, 0x04, 0x55, 0x04, 0x4e,
+	     0xc5, 0xf5, 0x40, 0x00, 0x7c, 0xfd, 0x00, 0x00, 0xea, 0x7a,
+	     0x00, 0x00, 0xa8, 0xe0, 0x3d, 0x66, 0x90, 0xc1, 0xd2, 0x24,
+	     0x54, 0xba, 0x55, 0x06, 0x42, 0x00, 0x00, 0x0e, 0x45, 0x60,
+	     0x60, 0x50, 0x41, 0x11, 0xf4, 0x68, 0x00, 0x00, 0x00, 0x00,
+	     0xd0, 0x15, 0x00, 0x80, 0x1c, 0xf1, 0xaa, 0x76, 0x29, 0x99,
+	     0x77, 0x35, 0x55, 0x00, 0x00, 0xbc, 0x97, 0x11, 0x0a, 0x00,
+	     0x20, 0x04, 0x09, 0x00, 0x58, 0xeb, 0x59, 0xb1, 0x38, 0x3b,
+	     0xfd, 0x29, 0x00, 0x80, 0x5d, 0xed, 0xbd, 0x83, 0xf6, 0x68,
+	     0x33, 0x74, 0x2e, 0x61, 0x94, 0xf2, 0x4c, 0x00, 0xc0, 0x26,
+	     0xaa, 0x98, 0xe0, 0x06, 0xda, 0x18, 0xae, 0x3f, 0x8c, 0x2d,
+	     0xb4, 0x81, 0x56, 0x9b, 0x5e, 0x0d, 0x00, 0x30, 0x3b, 0x4c,
+	     0x12, 0x01, 0x00, 0x1a, 0x24, 0xb3, 0x16, 0x6d, 0x0a, 0x00,
+	     0x00, 0xd6, 0x01, 0x00, 0x50, 0x46, 0xed, 0xef, 0xd6, 0x33,
+	     0x00, 0x80, 0xeb, 0x11, 0x0e, 0xee, 0x33, 0xe2, 0xe3, 0xa1,
+	     0xfb, 0xa8, 0x12, 0xbd, 0x3c, 0x78, 0xb7, 0x08, 0x82, 0x93,
+	     0xc9, 0x9d, 0x94, 0xdf, 0xa8, 0x8d, 0xb1, 0x90, 0x00, 0x00,
+	     0x86, 0x26, 0x0c, 0xd3, 0xb0, 0x12, 0x00, 0xe0, 0x38, 0xe2,
+	     0x05, 0x00, 0x9d, 0x38, 0x29, 0x00, 0x80, 0x94, 0x04, 0x00,
+	     0x00, 0xce, 0xa0, 0x3e, 0x28, 0x4a, 0x4a, 0xd0, 0x3c, 0x44,
+	     0x62, 0x9f, 0xa2, 0x25, 0xac, 0x31, 0xcf, 0x05, 0xff, 0x82,
+	     0x76, 0xd9, 0x00, 0x3c, 0x4d, 0xa6, 0x4a, 0x74, 0x11, 0x16,
+	     0xad, 0x65, 0xc8, 0xf4, 0x02, 0x00, 0x60, 0x82, 0x74, 0x7e,
+	     0x00, 0x80, 0xea, 0x85, 0x64, 0x0c, 0xd9, 0x02, 0x00, 0x18,
+	     0x68, 0xc1, 0xbb, 0xde, 0x17, 0x00, 0x00, 0x00, 0x80, 0xd7,
+	     0x0c, 0x00, 0xc0, 0x70, 0x40, 0x58, 0x02, 0x00, 0x4e, 0x3a,
+	     0xfc, 0x3d, 0x98, 0x91, 0x20, 0x42, 0x6c, 0x49, 0xb4, 0xe3,
+	     0x08, 0xc1, 0x06, 0x8c, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x1d, 0xa4, 0xcb, 0x23, 0x34, 0xbe, 0x08, 0xa2, 0x81,
+	     0xf5, 0xc6, 0x97, 0xc6, 0x74, 0x8c, 0x8b, 0x34, 0x7f, 0x9b,
+	     0x8e, 0x88, 0x2c, 0x0a, 0x99, 0x12, 0x1a, 0xaf, 0xa6, 0x86,
+	     0x21, 0x5b, 0x53, 0x8f, 0x5c, 0xaa, 0xfc, 0x37, 0x3d, 0x6a,
+	     0xe6, 0x07, 0x00, 0x80, 0xd1, 0xab, 0x3b, 0xa5, 0x20, 0xd0,
+	     0x8d, 0xe5, 0xa0, 0xe8, 0x00, 0x13, 0x3a, 0xc0, 0x21, 0x00,
+	     0x20, 0x47, 0x38, 0xda, 0x49, 0x8c, 0xd5, 0xb6, 0x28, 0x90,
+	     0xb0, 0x95, 0x5e, 0xcc, 0x3c, 0x0e, 0x00, 0x20, 0xea, 0x00,
+	     0x00, 0x00, 0x00, 0x48, 0x8f, 0x42, 0x2a, 0xa7, 0x03, 0xfb,
+	     0x26, 0x84, 0x35, 0x94, 0x0a, 0x8b, 0xbc, 0xb3, 0x00, 0x00,
+	     0xd4, 0xb3, 0x1f, 0x9a, 0x08, 0x4b, 0x39, 0x35, 0x5a, 0x03,
+	     0x00, 0x00, 0x00, 0x4c, 0x11, 0xf4, 0xba, 0x03, 0x92, 0x9d,
+	     0xe7, 0x17, 0x26, 0xec, 0xc3, 0x46, 0x00, 0x00, 0x5e, 0x50,
+	     0x92, 0x97, 0x44, 0x02, 0x00, 0x00, 0x5a, 0xa9, 0x70, 0xa2,
+	     0xe5, 0xf8, 0xaa, 0x00, 0x00, 0xce, 0x89, 0xfc, 0x12, 0x16,
+	     0x8c, 0x18, 0xe4, 0xc8, 0xab, 0xbc, 0xec, 0x7c, 0x38, 0x33,
+	     0x87, 0x9d, 0x94, 0x51, 0xbe, 0xd0, 0xca, 0x64, 0x52, 0x60,
+	     0x4f, 0xf8, 0x7d, 0x80, 0x8b, 0xb0, 0x07, 0x39, 0x46, 0x8b,
+	     0xea, 0x16, 0x36, 0x57, 0x1c, 0xbf, 0xec, 0x7d, 0x4e, 0x1f,
+	     0xd2, 0xbc, 0xf9, 0x12, 0x00, 0x00, 0x4b, 0x30, 0x17, 0xdb,
+	     0xb1, 0x41, 0xee, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x98, 0x90, 0xad, 0xe5, 0xbe, 0x04,
+	     0x62, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x47, 0x51,
+	     0x56, 0x94, 0x7a, 0x42, 0x5f, 0x6c, 0x4d, 0x00, 0x40, 0x01,
+	     0xaa, 0x6a, 0x28, 0x09, 0x44, 0xe9, 0x00, 0x00, 0x5a, 0x4c,
+	     0xc8, 0xa3, 0x81, 0x26, 0x00, 0x00, 0x00, 0x70, 0x7f, 0x29,
+	     0x0a, 0x02, 0x00, 0x6e, 0x5d, 0x99, 0x38, 0x41, 0x14, 0x71,
+	     0x0f, 0x27, 0x92, 0x04, 0x30, 0x7f, 0x6c, 0x11, 0x29, 0x55,
+	     0x70, 0x9c, 0x44, 0xcb, 0xb5, 0x52, 0x5f, 0xd2, 0xfe, 0x73,
+	     0x2b, 0x39, 0x46, 0xc8, 0x3b, 0x8a, 0x20, 0xfb, 0xe0, 0x2a,
+	     0x4d, 0x0f, 0x08, 0x32, 0x24, 0x6a, 0x14, 0xab, 0x0a, 0x93,
+	     0x00, 0x80, 0x1b, 0x84, 0x64, 0x06, 0x00, 0x60, 0x57, 0x03,
+	     0x00, 0xfc, 0x2f, 0x58, 0x26, 0x4a, 0x42, 0xee, 0xd8, 0x14,
+	     0x30, 0xb0, 0x96, 0xea, 0x89, 0xb6, 0x01, 0x00, 0x56, 0x23,
+	     0xec, 0x1c, 0xe5, 0x0f, 0x00, 0x60, 0x22, 0x75, 0xae, 0x82,
+	     0xb5, 0x6c, 0x32, 0xaa, 0x69, 0xac, 0xc9, 0x63, 0x15, 0x00,
+	     0xa0, 0x59, 0x31, 0x22, 0x31, 0xf6, 0x31, 0xc4, 0xb8, 0x81,
+	     0xf4, 0x43, 0x00, 0x40, 0x45, 0x0c, 0x00, 0x20, 0xd3, 0xd9,
+	     0x48, 0xc2, 0xbe, 0x38, 0x80, 0x1c, 0x8a, 0xc2, 0x25, 0x00,
+	     0x40, 0xcc, 0x14, 0x3b, 0x38, 0x18, 0x02, 0x00, 0x4e, 0x80,
+	     0xd2, 0xc8, 0xce, 0x41, 0xe8, 0x61, 0x46, 0xa3, 0x23, 0x84,
+	     0x39, 0xce, 0xfd, 0x8c, 0x40, 0x8b, 0xa9, 0x39, 0x1c, 0x59,
+	     0xc9, 0xcf, 0x62, 0x2d, 0x50, 0x1c, 0x45, 0xc7, 0xcc, 0x0d,
+	     0x00, 0x00, 0x81, 0xd2, 0x5e, 0xc0, 0x38, 0x14, 0x66, 0x02,
+	     0xf9, 0x71, 0xe9, 0x24, 0x11, 0xa4, 0x3e, 0x00, 0x40, 0xe4,
+	     0x01, 0x00, 0xb0, 0x12, 0x4c, 0x02, 0x02, 0x00, 0x6e, 0x10,
+	     0x00, 0x80, 0x77, 0xce, 0xd9, 0x25, 0x5d, 0xc3, 0x7f, 0x41,
+	     0x48, 0x01, 0x00, 0xda, 0x59, 0x05, 0x83, 0x97, 0x0e, 0x00,
+	     0xe0, 0x18, 0x09, 0x00, 0xc8, 0xc7, 0xe8, 0x74, 0x88, 0x86,
+	     0xee, 0x1c, 0x4c, 0x41, 0x0e, 0x21, 0x15, 0xb0, 0xf5, 0xb3,
+	     0x5a, 0x89, 0xd6, 0x42, 0x41, 0x65, 0xaf, 0x5a, 0x54, 0xb1,
+	     0x0b, 0xdf, 0xc0, 0xa2, 0x8a, 0x25, 0x50, 0x1f, 0x97, 0x04,
+	     0x49, 0x22, 0x00, 0xc0, 0x94, 0x0b, 0x00, 0x00, 0x00, 0x68,
+	     0x67, 0x00, 0x00, 0xdc, 0x4c, 0x00, 0x00, 0xcc, 0x4c, 0x25,
+	     0x44, 0xb7, 0x80, 0x28, 0xe8, 0xa6, 0xf4, 0x0d, 0x4a, 0x23,
+	     0xa6, 0x14, 0x8e, 0x4d, 0xb3, 0x8a, 0xcc, 0x82, 0x67, 0x0a,
+	     0x5f, 0x70, 0xce, 0x00, 0x00, 0x00, 0x80, 0x53, 0x17, 0x15,
+	     0x6a, 0x42, 0x05, 0x00, 0x28, 0x3c, 0x10, 0x07, 0x94, 0x22,
+	     0x2a, 0x9f, 0x98, 0x50, 0x58, 0x92, 0x6d, 0x01, 0x00, 0x48,
+	     0x6f, 0xa0, 0xcf, 0x90, 0x70, 0xfc, 0x45, 0x00, 0xc0, 0x3f,
+	     0x30, 0xb4, 0x89, 0x51, 0x00, 0x00, 0x90, 0x9c, 0x0a, 0x4e,
+	     0xcf, 0xc3, 0x85, 0x80, 0xae, 0xc4, 0x98, 0x06, 0x00, 0x28,
+	     0x9b, 0x5d, 0x0f, 0x01, 0x00, 0xe8, 0x8a, 0x41, 0x00, 0x4c,
+	     0x85, 0x01, 0xe4, 0xca, 0x61, 0xec, 0xa8, 0x5f, 0x1c, 0x2f,
+	     0xe3, 0xba, 0xff, 0x63, 0x7b, 0x00, 0x00, 0xc0, 0x0e, 0x00,
+	     0x00, 0xd8, 0x7d, 0x0a, 0x26, 0x00, 0x00, 0x88, 0x4c, 0x87,
+	     0xcc, 0xae, 0xe5, 0x8a, 0x9a, 0xee, 0x40, 0x03, 0x00, 0x00,
+	     0x93, 0x1e, 0xe4, 0xc5, 0x73, 0xc8, 0x18, 0x27, 0x28, 0xe4,
+	     0x28, 0xf5, 0xc5, 0x22, 0x7d, 0x00, 0x00, 0x39, 0x22, 0x00,
+	     0xc0, 0x9e, 0xb1, 0xf5, 0x03, 0x00, 0xc8, 0x15, 0x1a, 0x3e,
+	     0x62, 0x8f, 0x3b, 0x57, 0xfc, 0x8e, 0x72, 0xd0, 0xc6, 0xe1,
+	     0x92, 0x3c, 0x65, 0x00, 0x00, 0xa7, 0x89, 0x7b, 0x4e, 0x0e,
+	     0x4b, 0x47, 0x06, 0x00, 0xf8, 0xa3, 0x78, 0x8f, 0x88, 0x97,
+	     0xeb, 0x3b, 0xec, 0x00, 0x5d, 0xe6, 0x01, 0xf0, 0xff, 0xba,
+	     0x59, 0xea, 0x15, 0xd3, 0x64, 0xb6, 0x00, 0xb2, 0xe2, 0xa3,
+	     0xa8, 0x5a, 0xa5, 0x3b, 0x51, 0x59, 0x28, 0x19, 0xad, 0x62,
+	     0x4f, 0x9c, 0xf3, 0x22, 0x00, 0xe0, 0xbd, 0x01, 0x00, 0xd0,
+	     0x7a, 0x11, 0xc2, 0x00, 0x00, 0x54, 0x98, 0x8e, 0x81, 0x4b,
+	     0xc0, 0x00, 0x27, 0xa5, 0xcb, 0x8e, 0xec, 0x34, 0x9a, 0x6e,
+	     0x00, 0x80, 0xf1, 0x4e, 0x48, 0x29, 0x4a, 0x69, 0x4a, 0x18,
+	     0x9d, 0xc1, 0x1d, 0xbb, 0x49, 0xe9, 0xba, 0xb7, 0x48, 0xef,
+	     0x0c, 0x64, 0x62, 0x5d, 0x03, 0x00, 0x44, 0x39, 0xd2, 0x4d,
+	     0x49, 0x35, 0xfd, 0xda, 0xf6, 0x4f, 0x6a, 0x19, 0xa4, 0x42,
+	     0x33, 0x99, 0x18, 0x7a, 0x16, 0x00, 0x00, 0x8d, 0x03, 0xf3,
+	     0x05, 0x00, 0x60, 0xfc, 0x3a, 0xb4, 0x01, 0x00, 0xc0, 0x6f,
+	     0x43, 0x1e, 0x80, 0x12, 0x00, 0x40, 0x58, 0x43, 0x0a, 0x83,
+	     0x30, 0xf4, 0x2a, 0xc1, 0x74, 0xc6, 0x91, 0xd1, 0x08, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0xf8, 0x27, 0x9a, 0x36, 0xdb, 0x3a,
+	     0xaf, 0x24, 0x64, 0xd4, 0x37, 0x2c, 0x07, 0x73, 0x8d, 0xa1,
+	     0x5f, 0xcc, 0x42, 0xea, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x1e,
+	     0x71, 0x40, 0x66, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x50, 0x95,
+	     0xb1, 0x13, 0x25, 0x16, 0x00, 0x00, 0x00, 0xf0, 0xfb, 0xf8,
+	     0x38, 0xb9, 0x4c, 0x00, 0x00, 0x77, 0x8b, 0xf7, 0x16, 0xd6,
+	     0xf1, 0x47, 0xe7, 0xf9, 0x00, 0x00, 0xbc, 0x2e, 0xc7, 0x54,
+	     0x00, 0x00, 0x36, 0x44, 0x49, 0x42, 0xb8, 0x97, 0xd3, 0xba,
+	     0x46, 0x62, 0xc3, 0x00, 0x00, 0xfc, 0xa8, 0xea, 0xa0, 0xfe,
+	     0x86, 0x42, 0x91, 0x6c, 0xb8, 0x1c, 0x02, 0x00, 0x1c, 0x8e,
+	     0x00, 0x80, 0x23, 0x8a, 0xdb, 0x08, 0x4c, 0x55, 0xed, 0x68,
+	     0xb4, 0x00, 0x00, 0x20, 0x56, 0x7c, 0x18, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x60, 0x8b, 0xbc, 0x9b, 0xf5, 0xf9, 0xfe, 0x16,
+	     0x85, 0xa9, 0x2f, 0x56, 0x32, 0x32, 0x8b, 0x02, 0xdc, 0xb3,
+	     0xec, 0x80, 0x8b, 0x96, 0x06, 0x41, 0xb4, 0xcf, 0x0b, 0x9a,
+	     0x70, 0x64, 0x73, 0xc3, 0xe8, 0x38, 0x6a, 0x12, 0x17, 0x4d,
+	     0x00, 0x80, 0xe6, 0x24, 0x00, 0x40, 0x1d, 0x08, 0x27, 0x04,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xc3, 0x76, 0x82, 0xec,
+	     0xc6, 0x79, 0x38, 0xd0, 0x72, 0xc9, 0xa9, 0xc8, 0x36, 0x94,
+	     0x00, 0x80, 0xc9, 0xd9, 0x2d, 0x53, 0x53, 0x65, 0xb4, 0xf2,
+	     0x75, 0x21, 0x0f, 0x73, 0x36, 0x00, 0x00, 0x8b, 0x14, 0xb8,
+	     0xc4, 0x73, 0x94, 0x8d, 0xcc, 0x19, 0x00, 0x00, 0x30, 0x94,
+	     0xee, 0x8b, 0x56, 0x02, 0x2b, 0x0a, 0x00, 0x00, 0x00, 0x28,
+	     0x62, 0xfe, 0x96, 0xa2, 0x14, 0x00, 0x00, 0x81, 0xc4, 0x86,
+	     0x71, 0x98, 0x04, 0x00, 0x40, 0x23, 0x02, 0x00, 0x0c, 0x26,
+	     0xae, 0x04, 0x4e, 0x5d, 0x91, 0xd0, 0x19, 0xd6, 0x36, 0x01,
+	     0x00, 0xc8, 0xaf, 0x8e, 0x91, 0x7d, 0x27, 0x78, 0xde, 0x96,
+	     0x0d, 0x00, 0x40, 0x2e, 0xfb, 0x4b, 0xdd, 0x19, 0x92, 0x8e,
+	     0xd3, 0x08, 0x00, 0x00, 0xba, 0xa0, 0xa5, 0x37, 0x4f, 0xf9,
+	     0x08, 0x15, 0x3d, 0x9c, 0x78, 0x1a, 0xaf, 0x7b, 0xa5, 0x1f,
+	     0x04, 0x00, 0x80, 0x16, 0x04, 0x00, 0x38, 0xb4, 0xd8, 0x10,
+	     0xe0, 0xc1, 0xf9, 0x80, 0xc0, 0xe7, 0x3d, 0x30, 0xde, 0xa2,
+	     0x24, 0xf0, 0x23, 0x62, 0x65, 0xdd, 0x99, 0x93, 0x88, 0xda,
+	     0xea, 0x52, 0xa2, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x52, 0x96, 0xc9, 0xe3, 0xd9, 0x41, 0x54, 0x07, 0x00, 0xc8,
+	     0x0e, 0x92, 0xca, 0x02, 0x7e, 0x00, 0x80, 0x43, 0x85, 0xe2,
+	     0x4e, 0xc1, 0x03, 0x00, 0x78, 0x33, 0x86, 0xab, 0xd0, 0x42,
+	     0xe1, 0x9a, 0xeb, 0x21, 0x97, 0x03, 0x00, 0xb0, 0x76, 0xc9,
+	     0x23, 0xc8, 0xff, 0xb2, 0x5e, 0x00, 0x00, 0x6d, 0x03, 0x87,
+	     0x32, 0xf9, 0x64, 0x59, 0x64, 0x51, 0xe0, 0x7b, 0x96, 0x91,
+	     0x00, 0x80, 0x94, 0x04, 0x00, 0x00, 0xbc, 0x53, 0x0a, 0x02,
+	     0x00, 0x70, 0x03, 0x01, 0x00, 0x27, 0x3c, 0x00, 0x40, 0x79,
+	     0x27, 0x0e, 0x05, 0x00, 0xa0, 0x9e, 0x14, 0x84, 0x00, 0x00,
+	     0xe3, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0xa2,
+	     0xfe, 0x50, 0xe4, 0x00, 0x00, 0x77, 0x94, 0x1e, 0x59, 0x09,
+	     0x0e, 0xf0, 0xc2, 0xab, 0x02, 0x00, 0xf0, 0x27, 0xc8, 0x52,
+	     0x01, 0x2c, 0x23, 0x25, 0xb9, 0x64, 0xe1, 0x07, 0x00, 0x20,
+	     0x57, 0x09, 0x92, 0x7c, 0x08, 0x00, 0x80, 0x1a, 0xc7, 0x4b,
+	     0x61, 0xb0, 0x74, 0x7f, 0xe1, 0xea, 0x4c, 0x20, 0xdf, 0x39,
+	     0xd8, 0x09, 0x9d, 0x9c, 0xae, 0x71, 0x6b, 0x86, 0x7e, 0x9b,
+	     0xa7, 0x94, 0xbe, 0xfa, 0x54, 0x6c, 0x16, 0x4f, 0x01, 0xee,
+	     0x60, 0xa5, 0x27, 0x73, 0x04, 0xd3, 0x00, 0x00, 0x2a, 0x38,
+	     0x22, 0x9c, 0xd2, 0xa6, 0xc3, 0x11, 0x00, 0x40, 0x06, 0xe1,
+	     0xba, 0x49, 0xbf, 0xec, 0x37, 0xcd, 0x93, 0xe7, 0x5b, 0xdd,
+	     0xac, 0x29, 0x01, 0xd8, 0xab, 0x8d, 0xbc, 0x2a, 0xc1, 0x72,
+	     0x00, 0x80, 0x24, 0x00, 0x42, 0xc2, 0xb7, 0x06, 0x72, 0x09,
+	     0xf1, 0x09, 0xac, 0x00, 0x00, 0xec, 0x3f, 0x00, 0x00, 0x00,
+	     0x60, 0x8f, 0x52, 0x63, 0x12, 0xfe, 0x25, 0x8f, 0x00, 0x00,
+	     0x7a, 0x49, 0x65, 0x9b, 0x34, 0xb3, 0xcc, 0x81, 0xd0, 0x19,
+	     0x4d, 0xd2, 0xbf, 0x52, 0x47, 0x00, 0x00, 0xff, 0x93, 0xf4,
+	     0x90, 0x97, 0x73, 0x37, 0x5b, 0x3d, 0x02, 0x00, 0x1a, 0x13,
+	     0xc5, 0x01, 0xa3, 0x1b, 0xd2, 0xad, 0x98, 0x39, 0xca, 0x68,
+	     0x2c, 0x11, 0x29, 0x00, 0x00, 0xc8, 0x25, 0x28, 0x42, 0xe1,
+	     0x23, 0xe2, 0x36, 0x6f, 0xf0, 0x27, 0xe5, 0x56, 0x4a, 0x79,
+	     0x76, 0xc0, 0xe0, 0x62, 0x49, 0x08, 0x85, 0xf3, 0x55, 0xac,
+	     0x0c, 0x02, 0x00, 0xfc, 0x69, 0x00, 0x80, 0xbe, 0x05, 0x93,
+	     0x0b, 0x00, 0x00, 0x00, 0x68, 0x61, 0xa2, 0xe2, 0x8a, 0x2e,
+	     0x6d, 0x9e, 0x66, 0xd7, 0x68, 0x02, 0x00, 0xb0, 0x0e, 0x0c,
+	     0xd6, 0xf1, 0xe0, 0x02, 0x64, 0x97, 0x96, 0x42, 0xe1, 0x8f,
+	     0x52, 0x63, 0x40, 0x6a, 0xbc, 0x42, 0x01, 0x00, 0x8c, 0x46,
+	     0xc4, 0x8d, 0x5d, 0x43, 0x7e, 0xa7, 0xb1, 0xc4, 0xa9, 0xd1,
+	     0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9c, 0xa4, 0xae,
+	     0x24, 0x38, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x00, 0x00,
+	     0x28, 0x19, 0xa2, 0x8d, 0xd0, 0x23, 0x8b, 0xa6, 0xf0, 0x93,
+	     0x6d, 0xe5, 0xbf, 0x16, 0x24, 0x1a, 0x0e, 0x45, 0x92, 0x74,
+	     0xf0, 0x8b, 0x95, 0xe0, 0x98, 0x6a, 0x88, 0x9d, 0x68, 0x5e,
+	     0xfa, 0xa1, 0x15, 0x20, 0x91, 0x6a, 0x35, 0x19, 0xa8, 0xfc,
+	     0x61, 0xb0, 0xd1, 0x00, 0x00, 0xbc, 0x38, 0x93, 0x40, 0xef,
+	     0xa9, 0xb2, 0x76, 0x43, 0x0c, 0x41, 0xb2, 0x50, 0x00, 0x00,
+	     0x5d, 0x0c, 0x30, 0x23, 0x37, 0x0f, 0x7a, 0xd4, 0x6d, 0x89,
+	     0x3c, 0x29, 0xc5, 0xc4, 0x2a, 0x8e, 0x25, 0xe4, 0x05, 0xf0,
+	     0x71, 0xf0, 0xa6, 0xa8, 0x89, 0xec, 0x01, 0x00, 0x5a, 0x2a,
+	     0x5d, 0x1d, 0xb1, 0xd7, 0x99, 0x04, 0x00, 0x00, 0x00, 0xc8,
+	     0x56, 0x02, 0x00, 0x98, 0x0e, 0xea, 0xa1, 0x12, 0x5e, 0x3d,
+	     0x85, 0xca, 0x11, 0x71, 0x01, 0x00, 0x20, 0x2a, 0x00, 0x00,
+	     0x8e, 0x25, 0x46, 0x10, 0x00, 0x00, 0x66, 0xe4, 0x66, 0x92,
+	     0x49, 0xe5, 0x1f, 0x49, 0x7b, 0xfd, 0x0a, 0x7f, 0xa3, 0xa4,
+	     0x2a, 0x2b, 0x72, 0xec, 0xd3, 0x1a, 0xe1, 0xdb, 0x46, 0x05,
+	     0x7d, 0x2f, 0x00, 0x00, 0x00, 0x20, 0xde, 0xd4, 0xaa, 0xba,
+	     0x79, 0x3d, 0x2d, 0x6f, 0x4b, 0x63, 0x84, 0x4f, 0x8c, 0xc9,
+	     0x21, 0x58, 0x27, 0xe5, 0x59, 0xe6, 0x01, 0x00, 0xea, 0x73,
+	     0x41, 0xc2, 0x9b, 0x84, 0xeb, 0x0d, 0x00, 0x90, 0xaa, 0xeb,
+	     0x8c, 0xf8, 0x8c, 0x00, 0x00, 0x37, 0x06, 0x50, 0x21, 0x67,
+	     0x8f, 0x03, 0x14, 0xc2, 0x09, 0x20, 0xc9, 0xc0, 0x6c, 0x8e,
+	     0x6a, 0xb0, 0x9e, 0x58, 0xee, 0xab, 0x83, 0xf3, 0x60, 0xba,
+	     0x2b, 0x82, 0x72, 0x70, 0x2d, 0x8a, 0xa5, 0xe8, 0xa3, 0x89,
+	     0x8d, 0x19, 0x51, 0x2d, 0x4c, 0x9f, 0xf8, 0x00, 0x4f, 0x49,
+	     0xdf, 0xbb, 0x5e, 0x07, 0x00, 0x20, 0xd0, 0xc3, 0x04, 0x7a,
+	     0xf8, 0x2c, 0xfb, 0xd2, 0x7c, 0x44, 0xa7, 0x9c, 0x5c, 0x25,
+	     0x10, 0x00, 0xc0, 0x45, 0x01, 0x00, 0xac, 0x64, 0x08, 0x59,
+	     0x77, 0x0f, 0x00, 0xc0, 0x86, 0x0c, 0x00, 0x40, 0xe1, 0x3c,
+	     0x4c, 0x2d, 0x74, 0x04, 0x46, 0xcc, 0x11, 0x74, 0xde, 0xed,
+	     0x26, 0x37, 0x69, 0x7f, 0xa1, 0x00, 0x64, 0x02, 0x23, 0x4c,
+	     0x00, 0x80, 0xea, 0xa1, 0x2a, 0xef, 0x34, 0x07, 0x00, 0x00,
+	     0x00, 0x2c, 0x29, 0xd1, 0x0f, 0xdc, 0x3e, 0x00, 0x00, 0x31,
+	     0x41, 0x6f, 0x65, 0xe3, 0xd8, 0x82, 0x44, 0x1d, 0x00, 0x00,
+	     0x52, 0x1e, 0x2d, 0x8c, 0xb8, 0x4d, 0x97, 0xf9, 0xbf, 0xc4,
+	     0x7f, 0x0c, 0x9a, 0xe2, 0x29, 0x59, 0x34, 0x00, 0x00, 0x1b,
+	     0x48, 0x9d, 0x72, 0x82, 0x2c, 0x42, 0x0a, 0x81, 0x80, 0x20,
+	     0x05, 0x83, 0xe3, 0xd0, 0xaa, 0x12, 0x00, 0x30, 0x41, 0x8a,
+	     0x40, 0xb6, 0x12, 0x00, 0x00, 0x1a, 0xaa, 0x8b, 0xc1, 0xa7,
+	     0x41, 0xc2, 0xf1, 0x7d, 0x01, 0x86, 0x5c, 0xaf, 0xd6, 0x58,
+	     0x19, 0xa6, 0x6f, 0xc8, 0x00, 0x2c, 0xb1, 0xa7, 0xa7, 0x99,
+	     0xce, 0x29, 0xf6, 0x42, 0x66, 0x5a, 0x19, 0x2c, 0x43, 0x90,
+	     0x2a, 0x8a, 0xf6, 0xb0, 0x6c, 0x77, 0x00, 0x00, 0xd2, 0x00,
+	     0x00, 0x00, 0xd8, 0x02, 0x00, 0x80, 0x3b, 0xb4, 0xc0, 0x2b,
+	     0x6d, 0xee, 0x7e, 0x00, 0x00, 0xed, 0xaf, 0x19, 0x49, 0xec,
+	     0x63, 0x6b, 0x33, 0xea, 0x13, 0x4f, 0xea, 0xb6, 0x7c, 0x80,
+	     0x33, 0x97, 0xf2, 0x91, 0xb2, 0x50, 0x56, 0x16, 0xff, 0x4a,
+	     0x92, 0x01, 0x00, 0x70, 0x64, 0xc9, 0x09, 0x41, 0x12, 0x00,
+	     0x00, 0x06, 0xa0, 0x12, 0x29, 0x2a, 0x02, 0x00, 0x74, 0x2e,
+	     0x77, 0xcc, 0xba, 0x95, 0x17, 0x0e, 0x4a, 0xb9, 0xc4, 0xb9,
+	     0xdc, 0x01, 0x00, 0x30, 0x4d, 0xba, 0x91, 0xbc, 0x0b, 0x6d,
+	     0x71, 0xfd, 0x87, 0x27, 0x43, 0x8f, 0x88, 0xb9, 0x00, 0x00,
+	     0xad, 0x0c, 0x7d, 0xa0, 0x93, 0x08, 0x00, 0x00, 0x01, 0x2a,
+	     0x7e, 0x4d, 0x04, 0x8a, 0x14, 0x74, 0x92, 0xe9, 0x03, 0x00,
+	     0xa0, 0x18, 0x54, 0x24, 0x02, 0x00, 0xec, 0x2e, 0x2d, 0x8f,
+	     0x6f, 0x22, 0x8a, 0xcb, 0x2a, 0x4d, 0x7a, 0x65, 0x6f, 0x42,
+	     0x82, 0x65, 0x38, 0xfe, 0x1e, 0xa6, 0x9f, 0x27, 0x91, 0xef,
+	     0x03, 0x00, 0x50, 0xa5, 0xbb, 0x16, 0x1e, 0xfc, 0x02, 0x6c,
+	     0x33, 0x2a, 0x5a, 0x0a, 0x00, 0xa0, 0xce, 0x07, 0x00, 0x98,
+	     0x6b, 0x99, 0x0b, 0xc4, 0x4a, 0x4a, 0x03, 0x80, 0xd7, 0xcb,
+	     0xc0, 0x53, 0x99, 0xf9, 0x30, 0x87, 0x01, 0x00, 0x74, 0x6e,
+	     0x6c, 0x98, 0x50, 0x96, 0xe3, 0xb1, 0xa3, 0x32, 0x07, 0x4a,
+	     0x8d, 0x59, 0x93, 0x78, 0x8d, 0xe4, 0x09, 0x5e, 0xcb, 0x22,
+	     0x03, 0x00, 0x20, 0x02, 0x0b, 0x35, 0x6c, 0x4d, 0xd2, 0x2c,
+	     0x5f, 0xa5, 0xb3, 0x09, 0xa3, 0x26, 0xaa, 0x89, 0x92, 0x98,
+	     0x1d, 0x84, 0xf7, 0xca, 0x63, 0x00, 0x80, 0x02, 0x23, 0x67,
+	     0x8d, 0x47, 0xd6, 0x33, 0x69, 0x04, 0x7e, 0x35, 0xc9, 0x7c,
+	     0xeb, 0xa5, 0xb5, 0xe4, 0x5a, 0x40, 0x34, 0x34, 0x8a, 0x03,
+	     0x00, 0x50, 0x75, 0x00, 0x00, 0x97, 0x47, 0x90, 0x8a, 0xcf,
+	     0x0b, 0xa7, 0x18, 0x1d, 0xc0, 0x3d, 0x09, 0x20, 0xc2, 0x15,
+	     0xa9, 0x1d, 0x18, 0x09, 0x00, 0x80, 0xba, 0x90, 0x36, 0x00,
+	     0x00, 0x88, 0x30, 0xe8, 0x23, 0xeb, 0x36, 0x00, 0x80, 0x68,
+	     0x65, 0x65, 0xc8, 0x58, 0xea, 0x0d, 0x09, 0x20, 0x01, 0x00,
+	     0xfb, 0xc1, 0x1d, 0x53, 0x96, 0x12, 0x00, 0x20, 0x26, 0x03,
+	     0x00, 0x40, 0x0a, 0x00, 0x00, 0xb9, 0x40, 0x2d, 0x40, 0xeb,
+	     0xca, 0xca, 0xe6, 0xda, 0xf4, 0x12, 0xe1, 0x22, 0xea, 0x41,
+	     0x8a, 0xcc, 0x12, 0x19, 0x00, 0x20, 0x68, 0x08, 0x00, 0x08,
+	     0x26, 0xc8, 0x33, 0x05, 0x30, 0x0b, 0x0a, 0xe5, 0x05, 0x22,
+	     0x13, 0x00, 0xd0, 0x1d, 0xf3, 0xa3, 0x14, 0x34, 0xb7, 0x3e,
+	     0xf1, 0x22, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x67, 0x37, 0xa3,
+	     0x93, 0xb0, 0xd4, 0xaa, 0x7e, 0x0a, 0xa9, 0xa0, 0x23, 0x83,
+	     0x4a, 0x3d, 0x33, 0xa3, 0xb8, 0x3c, 0x2d, 0xd2, 0xf4, 0x61,
+	     0x00, 0x80, 0x94, 0x0b, 0x00, 0xa0, 0xc1, 0x83, 0xad, 0x74,
+	     0x94, 0x78, 0x1f, 0xd8, 0x44, 0x0d, 0x38, 0x27, 0x82, 0x2b,
+	     0x72, 0x86, 0xa0, 0x12, 0xeb, 0x7e, 0x01, 0x00, 0xac, 0x3b,
+	     0xdc, 0x1b, 0xac, 0xe6, 0xa1, 0xe6, 0xcc, 0xf0, 0xba, 0x78,
+	     0x92, 0x01, 0x9a, 0xe0, 0x31, 0x75, 0xb7, 0xa4, 0x09, 0xdf,
+	     0xc7, 0xfa, 0xe6, 0x0a, 0xa4, 0xe1, 0x00, 0x00, 0x5e, 0x28,
+	     0x12, 0x4e, 0x60, 0x06, 0x44, 0x6e, 0xf1, 0x01, 0x00, 0x50,
+	     0x77, 0xbd, 0x3e, 0x00, 0x00, 0x79, 0xa2, 0xa8, 0x19, 0x00,
+	     0x20, 0x65, 0xe6, 0x46, 0x79, 0x04, 0x40, 0x9d, 0xa2, 0x12,
+	     0xeb, 0x42, 0x1a, 0x13, 0x00, 0x20, 0x91, 0xa2, 0x21, 0x7a,
+	     0x35, 0x58, 0xf6, 0xd6, 0x63, 0x00, 0x80, 0x67, 0x23, 0x87,
+	     0x02, 0x02, 0x19, 0x01, 0x53, 0xe0, 0xa9, 0x57, 0x00, 0x00,
+	     0x0a, 0x1b, 0x00, 0x40, 0xeb, 0xc7, 0x27, 0xe0, 0x8b, 0xe8,
+	     0x3e, 0x0c, 0x51, 0x50, 0x52, 0x2d, 0x2d, 0x9c, 0xd1, 0x7f,
+	     0x0e, 0x00, 0x10, 0x2c, 0x01, 0x00, 0xcc, 0x21, 0xd1, 0x82,
+	     0xf4, 0xc6, 0x8b, 0xcf, 0x22, 0xe5, 0xa3, 0xe5, 0x2b, 0x09,
+	     0x6a, 0xc4, 0x0a, 0xe6, 0x22, 0x53, 0xb3, 0x04, 0x41, 0xde,
+	     0xd2, 0x45, 0x75, 0x84, 0xd8, 0x12, 0x8e, 0x22, 0x89, 0x54,
+	     0xb2, 0x35, 0xde, 0x04, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x70,
+	     0xc0, 0xdc, 0xa0, 0xf2, 0x70, 0x16, 0x26, 0x00, 0x00, 0x00,
+	     0x20, 0x58, 0xf0, 0x1f, 0x9a, 0xf7, 0x00, 0x00, 0x56, 0x03,
+	     0x72, 0xbf, 0x53, 0xce, 0xa3, 0x12, 0x00, 0xf0, 0x5a, 0xa8,
+	     0x45, 0xd9, 0x9d, 0x74, 0x2e, 0xa4, 0xbd, 0x5e, 0x0b, 0x1b,
+	     0xab, 0xb5, 0x91, 0x3b, 0xb4, 0x49, 0x26, 0x6f, 0x54, 0x42,
+	     0x1b, 0xc4, 0x18, 0xde, 0x3d, 0x0f, 0x00, 0x30, 0xec, 0x03,
+	     0x00, 0x90, 0xff, 0x30, 0x5f, 0xe4, 0x93, 0x2e, 0x4f, 0xc5,
+	     0x41, 0x45, 0x35, 0xfe, 0x8a, 0x3b, 0x40, 0x8b, 0xda, 0x41,
+	     0xde, 0xaa, 0xc7, 0x8c, 0x1f, 0x88, 0x4f, 0x78, 0x94, 0x99,
+	     0xd9, 0x01, 0x00, 0xcc, 0x47, 0x00, 0x80, 0x4d, 0x25, 0x00,
+	     0xa0, 0x16, 0x07, 0xa7, 0x82, 0xa7, 0x01, 0x00, 0x00, 0x00,
+	     0x93, 0xc4, 0x07, 0x80, 0x95, 0x01, 0x00, 0x00, 0x00, 0xc0,
+	     0x2a, 0xc0, 0x4d, 0x00, 0x00, 0x40, 0x21, 0x00, 0x00, 0x00,
+	     0xa0, 0x12, 0x33, 0x6a, 0xa2, 0xc2, 0x88, 0x71, 0xc2, 0x0d,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x74, 0xb2, 0x25, 0xb8,
+	     0x07, 0x6c, 0x3a, 0xc6, 0x71, 0xcf, 0x47, 0x00, 0x00, 0x95,
+	     0x06, 0x10, 0x72, 0x4f, 0x41, 0x57, 0x04, 0x2c, 0xe3, 0x53,
+	     0x41, 0x25, 0x7d, 0x54, 0x82, 0x90, 0x6e, 0x89, 0xba, 0x02,
+	     0x00, 0x70, 0x89, 0xc8, 0x0c, 0x2e, 0x42, 0x8d, 0xdb, 0x19,
+	     0x90, 0xbb, 0x02, 0x00, 0xd8, 0x2e, 0xb2, 0xd9, 0x00, 0x00,
+	     0x3e, 0xb4, 0xca, 0x53, 0xe1, 0x68, 0x42, 0x56, 0x85, 0x3c,
+	     0x0c, 0xe5, 0xce, 0x1e, 0x35, 0x21, 0x0f, 0xbf, 0x0a, 0x55,
+	     0xc2, 0x0f, 0x99, 0x8e, 0xa2, 0x3b, 0xa4, 0xf4, 0x00, 0x00,
+	     0x21, 0x3f, 0x00, 0x00, 0x00, 0x60, 0x47, 0xe4, 0x8b, 0x80,
+	     0x89, 0x5c, 0x18, 0x3e, 0x14, 0x6c, 0x4b, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0xf0, 0xdf, 0x03, 0x00, 0xec, 0xf3, 0x94, 0x48,
+	     0x34, 0x87, 0xbf, 0xdb, 0xaf, 0xee, 0xad, 0xd7, 0xea, 0x00,
+	     0x00, 0xc8, 0x19, 0x13, 0x9b, 0x27, 0xac, 0x58, 0x4b, 0xfd,
+	     0x52, 0x8f, 0x45, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x33, 0x44, 0x0c, 0x82, 0xaa, 0x0d, 0x00, 0x00, 0x00, 0x48,
+	     0x36, 0xb2, 0x1f, 0xc0, 0x0f, 0x57, 0x3f, 0x55, 0x26, 0x00,
+	     0x40, 0xc7, 0x03, 0x00, 0x78, 0x67, 0x51, 0x9e, 0xa4, 0x7a,
+	     0x00, 0x80, 0x8b, 0x11, 0xf8, 0x10, 0x8c, 0x83, 0xd5, 0x6c,
+	     0xf5, 0x90, 0x90, 0x64, 0x91, 0x04, 0x1b, 0xf2, 0xc8, 0x07,
+	     0xec, 0x0c, 0x20, 0xe9, 0x02, 0x16, 0x84, 0x0d, 0xda, 0x38,
+	     0x08, 0x82, 0x0c, 0xa6, 0xcd, 0x71, 0x26, 0x65, 0xd2, 0x52,
+	     0x2e, 0xe2, 0x8c, 0xec, 0x11, 0x76, 0x9d, 0x07, 0x1a, 0x8c,
+	     0xea, 0x39, 0x04, 0x00, 0x20, 0x40, 0x75, 0xd2, 0xe4, 0x0b,
+	     0xe5, 0xac, 0x99, 0x4c, 0x50, 0x46, 0xc4, 0xc2, 0x20, 0x80,
+	     0x95, 0x00, 0x00, 0x74, 0x0c, 0x43, 0x95, 0x52, 0x8d, 0xa1,
+	     0x03, 0x00, 0x50, 0x11, 0xf2, 0x40, 0x9e, 0xd7, 0x2a, 0x91,
+	     0xcc, 0x41, 0x4d, 0x85, 0x50, 0x24, 0x40, 0x56, 0xe5, 0x51,
+	     0x04, 0x28, 0x6d, 0xf2, 0x07, 0x11, 0x03, 0x00, 0x40, 0x55,
+	     0x6f, 0x43, 0x52, 0xbe, 0x00, 0xab, 0x88, 0x27, 0xf2, 0x77,
+	     0x00, 0x00, 0xd2, 0xa2, 0xb2, 0xe8, 0xa0, 0x60, 0x6c, 0x80,
+	     0x20, 0x16, 0x17, 0x01, 0x00, 0xa5, 0x36, 0xb5, 0x18, 0x00,
+	     0xe0, 0x8b, 0x33, 0x55, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x9a,
+	     0x00, 0x80, 0x69, 0xe0, 0xa4, 0xa9, 0xf6, 0x01, 0x00, 0x80,
+	     0x5c, 0x85, 0x12, 0x77, 0x21, 0x7d, 0x09, 0x33, 0x4e, 0x63,
+	     0x2a, 0x6a, 0x06, 0x00, 0x70, 0xe9, 0x24, 0xf6, 0x70, 0x4e,
+	     0xe8, 0xa9, 0x33, 0xc1, 0x6b, 0x12, 0x00, 0x20, 0xc3, 0xa1,
+	     0xd4, 0x00, 0x00, 0x64, 0x4a, 0x06, 0xb6, 0x12, 0x80, 0xb5,
+	     0x0f, 0x00, 0x70, 0x90, 0x03, 0x00, 0xc8, 0xf5, 0x76, 0x1e,
+	     0xcc, 0x38, 0xc2, 0x08, 0x00, 0x40, 0x22, 0xf9, 0x9f, 0x28,
+	     0xfc, 0xc8, 0x6e, 0x00, 0x00, 0x16, 0xa2, 0xd3, 0xc1, 0x79,
+	     0xe7, 0x01, 0x16, 0x7d, 0x01, 0x00, 0xf8, 0x0e, 0x97, 0x72,
+	     0x0c, 0x2a, 0xad, 0x82, 0x07, 0x80, 0x5a, 0xd0, 0x2e, 0x68,
+	     0x37, 0x51, 0x15, 0xa1, 0x30, 0xbe, 0x41, 0x00, 0x40, 0x54,
+	     0x66, 0x66, 0x01, 0xf2, 0x61, 0x23, 0x82, 0xa1, 0x1e, 0x7a,
+	     0xfd, 0xba, 0x2d, 0x64, 0xd0, 0xc6, 0xbe, 0x24, 0xbe, 0xc1,
+	     0x64, 0xa1, 0xe9, 0x00, 0x00, 0xc5, 0x11, 0xd6, 0x49, 0xa6,
+	     0x05, 0x00, 0x00, 0x00, 0x38, 0x89, 0xf4, 0x6f, 0x00, 0x00,
+	     0xa1, 0xba, 0x5b, 0x22, 0x00, 0x40, 0xfd, 0x92, 0xf0, 0x20,
+	     0xe5, 0xec, 0xfe, 0xfa, 0x7d, 0xee, 0x90, 0x15, 0xa3, 0x78,
+	     0x63, 0x23, 0x38, 0x2e, 0x01, 0x00, 0xa8, 0xc7, 0x0c, 0x0c,
+	     0x1c, 0xca, 0x6d, 0x21, 0x6f, 0xec, 0x56, 0x19, 0x05, 0x84,
+	     0x54, 0xda, 0x8e, 0x24, 0x0a, 0xd2, 0x01, 0xf9, 0x14, 0x1c,
+	     0xe5, 0x65, 0x05, 0xd8, 0x73, 0xa7, 0x45, 0x36, 0xdb, 0x5a,
+	     0xf4, 0xa6, 0x76, 0xe5, 0x76, 0x8d, 0xec, 0x75, 0x66, 0xc4,
+	     0xd7, 0x29, 0x39, 0xae, 0x40, 0x37, 0x8e, 0xad, 0x83, 0xd8,
+	     0x62, 0xe0, 0x86, 0xa4, 0xca, 0x79, 0x24, 0xe8, 0xe0, 0x76,
+	     0x00, 0x80, 0xf3, 0xa2, 0xa6, 0x0a, 0x00, 0xb0, 0x68, 0xd2,
+	     0xed, 0x59, 0xcf, 0x52, 0x4e, 0x00, 0x00, 0x36, 0x05, 0xff,
+	     0x00, 0x00, 0x70, 0x16, 0xbc, 0x39, 0x39, 0xfd, 0xca, 0x79,
+	     0xe9, 0xbb, 0x35, 0x5b, 0x06, 0x10, 0x00, 0x60, 0xf5, 0x92,
+	     0x29, 0xfc, 0x72, 0x00, 0x00, 0x70, 0x1e, 0x00, 0x00, 0x64,
+	     0xc5, 0x39, 0x24, 0x60, 0x8a, 0xca, 0xd5, 0x4a, 0x2a, 0x94,
+	     0x22, 0x81, 0x4e, 0x0c, 0xaf, 0x01, 0x00, 0xa0, 0x1c, 0x8c,
+	     0xd5, 0x3c, 0xb6, 0x38, 0x68, 0xa7, 0xcc, 0x2c, 0x11, 0x68,
+	     0xad, 0xd1, 0x28, 0xc6, 0xa1, 0x65, 0x65, 0x99, 0x8a, 0x3b,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd5, 0x46, 0x7e, 0x8b,
+	     0x06, 0x12, 0x02, 0x83, 0x3b, 0x00, 0x80, 0xc8, 0x90, 0xb6,
+	     0x0a, 0x00, 0x10, 0xa3, 0x83, 0xea, 0x44, 0x96, 0xb8, 0x07,
+	     0x7d, 0x1c, 0xea, 0x10, 0x94, 0x6e, 0x37, 0x36, 0x25, 0x4a,
+	     0x96, 0x44, 0x3b, 0x74, 0x6e, 0x00, 0x80, 0x63, 0x0e, 0x00,
+	     0xa0, 0xfb, 0x00, 0xcf, 0x42, 0x81, 0x74, 0x3e, 0xb6, 0x5a,
+	     0x4e, 0x2c, 0x10, 0xe5, 0xc0, 0x41, 0x8b, 0x96, 0x83, 0x49,
+	     0x65, 0x6e, 0x47, 0x8c, 0x8b, 0x93, 0xcd, 0x36, 0x4c, 0x44,
+	     0x6a, 0x2e, 0xa3, 0xa3, 0xf1, 0xcf, 0xc1, 0x09, 0x01, 0x00,
+	     0x63, 0xb7, 0xf0, 0x12, 0xa6, 0x27, 0xb1, 0x08, 0x00, 0x00,
+	     0x00, 0xc0, 0x22, 0x26, 0x8b, 0xac, 0x0c, 0x00, 0x80, 0x56,
+	     0xcc, 0x9b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1d,
+	     0x00, 0x80, 0xcf, 0x10, 0xd7, 0x86, 0xd5, 0x06, 0x35, 0x03,
+	     0x00, 0xa8, 0x0e, 0x77, 0x28, 0xdc, 0xa5, 0xb9, 0x56, 0x95,
+	     0x01, 0x0e, 0x07, 0x00, 0x68, 0x4f, 0x26, 0xdf, 0x80, 0x01,
+	     0x08, 0x41, 0xfe, 0xe5, 0xf6, 0x8a, 0x4a, 0x82, 0xdb, 0xaa,
+	     0x6d, 0x89, 0x73, 0xf2, 0x49, 0x5e, 0x00, 0x00, 0xc0, 0x4b,
+	     0x48, 0xa4, 0x79, 0x48, 0xba, 0xaf, 0x01, 0x00, 0x9c, 0x09,
+	     0x51, 0xa7, 0x20, 0x93, 0xc5, 0x01, 0x65, 0x08, 0x94, 0x0c,
+	     0x6d, 0x01, 0x00, 0x9c, 0x2f, 0x05, 0x25, 0x4d, 0x4f, 0x99,
+	     0xac, 0xbf, 0xf3, 0x9f, 0x33, 0x0a, 0x02, 0x00, 0xba, 0x06,
+	     0xed, 0x29, 0x8f, 0x48, 0x45, 0x21, 0x68, 0x42, 0xa0, 0x01,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x40, 0x27,
+	     0x32, 0xee, 0xb5, 0x03, 0x63, 0x29, 0x00, 0x00, 0x5e, 0x28,
+	     0x00, 0x80, 0x8a, 0x56, 0x0a, 0x52, 0xc6, 0x05, 0x6c, 0x51,
+	     0x52, 0xe9, 0x17, 0xb3, 0x5c, 0xe1, 0x86, 0x7c, 0x0e, 0x00,
+	     0x00, 0x00, 0x10, 0x4a, 0x6b, 0xdd, 0x88, 0x64, 0xae, 0x28,
+	     0x9f, 0x0a, 0x2b, 0x1f, 0x5a, 0xc2, 0x9d, 0xb3, 0xcb, 0x71,
+	     0xe5, 0x5c, 0xbc, 0x2e, 0x2c, 0x41, 0x87, 0x5d, 0x1a, 0x44,
+	     0x82, 0xd9, 0x54, 0x99, 0x89, 0xb0, 0x38, 0x3a, 0xc8, 0x26,
+	     0xbd, 0x9a, 0xf6, 0x89, 0x95, 0x0a, 0x00, 0x00, 0x6f, 0xd4,
+	     0x32, 0x25, 0xde, 0x10, 0x91, 0x70, 0xca, 0x52, 0x5a, 0xca,
+	     0x8a, 0x1a, 0xb1, 0x66, 0xc8, 0x4e, 0xa5, 0x03, 0xbf, 0x1e,
+	     0x1c, 0x35, 0x83, 0x04, 0x00, 0x00, 0x6a, 0x05, 0x00, 0x00,
+	     0x00, 0x98, 0xe1, 0x00, 0x00, 0x2f, 0xc2, 0xb3, 0xcc, 0x08,
+	     0x11, 0x00, 0xf0, 0x19, 0x92, 0xcc, 0xdc, 0x86, 0x00, 0x00,
+	     0x00, 0x80, 0xcd, 0x26, 0x69, 0x12, 0x00, 0x20, 0x56, 0x84,
+	     0xeb, 0xb5, 0xb9, 0x82, 0x81, 0x01, 0xb6, 0xee, 0x46, 0x37,
+	     0x05, 0x42, 0x01, 0x00, 0x28, 0x56, 0x01, 0x00, 0xfe, 0x6f,
+	     0xb5, 0x35, 0x00, 0xc0, 0xc2, 0x0a, 0x8e, 0x30, 0xc1, 0xcb,
+	     0x0a, 0x74, 0x9f, 0x00, 0x00, 0x56, 0x12, 0x00, 0xc0, 0xe1,
+	     0x89, 0xbd, 0x54, 0x51, 0x52, 0x6d, 0x46, 0x37, 0xe8, 0x21,
+	     0x00, 0x00, 0x9d, 0x91, 0x1a, 0x52, 0x39, 0x07, 0x00, 0x20,
+	     0x98, 0xe0, 0x74, 0x52, 0x24, 0x33, 0xa6, 0xee, 0x81, 0x7f,
+	     0x6d, 0xd5, 0x07, 0x00, 0x18, 0x25, 0x00, 0x00, 0x00, 0x00,
+	     0x25, 0x41, 0x10, 0x63, 0x17, 0x0a, 0x34, 0x66, 0x3e, 0x01,
+	     0x00, 0xc0, 0xc4, 0xa0, 0x66, 0xd4, 0x29, 0x00, 0x00, 0x00,
+	     0xe0, 0xda, 0xf5, 0x69, 0x22, 0x97, 0x00, 0x00, 0x08, 0x84,
+	     0x00, 0x80, 0x2a, 0x41, 0x68, 0x13, 0x00, 0x10, 0x41, 0x98,
+	     0x4f, 0x7c, 0x1e, 0x02, 0x16, 0x00, 0x00, 0x38, 0xdb, 0x61,
+	     0x09, 0xcb, 0xa0, 0xc7, 0x03, 0x00, 0xec, 0x44, 0xd8, 0x1f,
+	     0x65, 0x33, 0xb1, 0xe4, 0x66, 0xd1, 0xc3, 0x69, 0x4a, 0x01,
+	     0x00, 0x18, 0x07, 0x41, 0x83, 0x22, 0x45, 0x33, 0x21, 0x00,
+	     0xa0, 0xd6, 0xf7, 0x43, 0x03, 0x00, 0x30, 0x5b, 0x00, 0x00,
+	     0x6c, 0x44, 0xd8, 0xce, 0xaa, 0xe1, 0xaa, 0x41, 0x27, 0xb4,
+	     0x4c, 0x99, 0xb8, 0x78, 0x42, 0x0b, 0x1c, 0x00, 0x40, 0x8f,
+	     0x0d, 0xb6, 0xd0, 0x3d, 0xc3, 0x0b, 0xa2, 0x6e, 0x26, 0x07,
+	     0xc9, 0xcc, 0xfb, 0x09, 0x2e, 0x0b, 0x7c, 0x75, 0x0d, 0x04,
+	     0x00, 0x00, 0x00, 0x6a, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0xa0, 0x37, 0xb4, 0xcd, 0x89, 0x98, 0x21, 0x83, 0x00, 0x00,
+	     0x4b, 0xc1, 0x67, 0x0f, 0x19, 0x64, 0x6a, 0x01, 0x00, 0xf8,
+	     0x94, 0xc1, 0x24, 0x0c, 0x49, 0x9a, 0xa2, 0xb9, 0x85, 0xc4,
+	     0xe6, 0x56, 0x06, 0x2a, 0x80, 0x3f, 0x01, 0x00, 0x24, 0x94,
+	     0xa2, 0x8f, 0xe7, 0xd0, 0xbf, 0x11, 0x00, 0x40, 0x97, 0x61,
+	     0x24, 0x24, 0x3b, 0x66, 0x97, 0x5b, 0xa2, 0xc7, 0xdc, 0x7b,
+	     0xd1, 0x13, 0x63, 0x6e, 0x21, 0x36, 0xf6, 0x66, 0x9a, 0x57,
+	     0xd7, 0x4c, 0xec, 0x26, 0xa5, 0xaf, 0xc1, 0x03, 0x00, 0xb8,
+	     0x64, 0xe2, 0x3a, 0x16, 0x3e, 0x57, 0x06, 0x9c, 0x10, 0x00,
+	     0x00, 0x00, 0xf0, 0x65, 0x6c, 0xd4, 0xd9, 0x07, 0xd0, 0x50,
+	     0x00, 0x80, 0x15, 0x8d, 0x30, 0x0e, 0x00, 0x00, 0x00, 0xf0,
+	     0xf7, 0x1c, 0x3f, 0x00, 0x00, 0x77, 0x29, 0x48, 0x5b, 0x64,
+	     0x61, 0xe5, 0x30, 0x10, 0xf0, 0x35, 0x00, 0x00, 0x7a, 0x97,
+	     0x2d, 0x35, 0x49, 0x0f, 0x00, 0x20, 0x34, 0xc1, 0xb6, 0x21,
+	     0xcc, 0xcd, 0x49, 0x06, 0x54, 0x89, 0x47, 0xba, 0xdd, 0x99,
+	     0x8d, 0x03, 0x18, 0xb0, 0x04, 0x00, 0xc0, 0x34, 0x89, 0x19,
+	     0x00, 0x00, 0x8e, 0x19, 0x00, 0x00, 0x00, 0x20, 0x31, 0xe1,
+	     0x67, 0x19, 0x23, 0x7a, 0x08, 0xa1, 0xa5, 0x32, 0x58, 0xd8,
+	     0x60, 0xb1, 0x14, 0x95, 0xf9, 0x93, 0xc0, 0x2f, 0x68, 0x56,
+	     0x8a, 0xbe, 0x48, 0x02, 0x58, 0x23, 0x8f, 0x52, 0x28, 0xf2,
+	     0xa9, 0x4d, 0xc0, 0xa2, 0x5e, 0xd5, 0x00, 0x84, 0x4d, 0x9b,
+	     0xce, 0x3e, 0x38, 0xc6, 0x02, 0x0b, 0x20, 0x61, 0x0e, 0x5c,
+	     0x7e, 0x23, 0x5a, 0x06, 0x5f, 0x6d, 0xf9, 0x04, 0x00, 0x80,
+	     0x26, 0x7e, 0xcd, 0xb6, 0x22, 0xf9, 0x19, 0x1e, 0xc8, 0xa5,
+	     0x45, 0x39, 0x33, 0xd7, 0x3a, 0xc0, 0x90, 0xd5, 0x20, 0x6a,
+	     0xfe, 0xb6, 0xa2, 0x64, 0xed, 0x90, 0xe3, 0x00, 0x56, 0xb9,
+	     0x5e, 0x02, 0x00, 0xbe, 0x78, 0x20, 0xb0, 0xb7, 0x85, 0x1d,
+	     0xc6, 0x5c, 0x02, 0x00, 0xa0, 0x3a, 0x65, 0x67, 0xca, 0x9a,
+	     0x0a, 0x1d, 0x8f, 0x82, 0x4b, 0xc4, 0x5c, 0x41, 0x39, 0x04,
+	     0x00, 0x00, 0x00, 0xaa, 0x86, 0x6e, 0x20, 0xbb, 0x54, 0xa1,
+	     0x28, 0x6f, 0x31, 0x8e, 0xd9, 0x12, 0xe5, 0xfc, 0xfa, 0x74,
+	     0x00, 0x00, 0x00, 0x40, 0x82, 0x08, 0x14, 0xe3, 0x92, 0x5b,
+	     0x32, 0x80, 0xee, 0x38, 0x84, 0x94, 0x2c, 0x00, 0x40, 0xbe,
+	     0x60, 0x12, 0x64, 0x95, 0x42, 0xd8, 0x00, 0x00, 0x58, 0x57,
+	     0x00, 0x00, 0x1b, 0x15, 0x27, 0xab, 0x03, 0xe1, 0x2a, 0x02,
+	     0x00, 0x2c, 0x0d, 0x36, 0x03, 0xf6, 0xc5, 0x4c, 0x0c, 0x00,
+	     0xa0, 0x77, 0x76, 0x67, 0xd1, 0xde, 0x01, 0x00, 0x20, 0x7e,
+	     0x08, 0x8b, 0x9e, 0x08, 0x5b, 0x07, 0x46, 0x05, 0x00, 0xa0,
+	     0x3c, 0xee, 0xfb, 0x34, 0x3f, 0x86, 0xc9, 0x59, 0x16, 0x73,
+	     0x68, 0xd1, 0xf5, 0x07, 0xfc, 0xc8, 0x74, 0x94, 0xa2, 0x8c,
+	     0xfe, 0x06, 0x88, 0xc9, 0x66, 0xa1, 0xdb, 0x38, 0x24, 0xcb,
+	     0x5f, 0x54, 0xed, 0x0a, 0x6f, 0x71, 0x15, 0xf0, 0x04, 0xf9,
+	     0xd2, 0x33, 0x09, 0x00, 0xe0, 0x01, 0x00, 0x00, 0xd2, 0x86,
+	     0x9b, 0x81, 0x06, 0x44, 0x6d, 0x0f, 0xbc, 0xd1, 0x39, 0x00,
+	     0x00, 0x5c, 0xc4, 0xe2, 0x3f, 0xc6, 0x0a, 0x00, 0x40, 0xe2,
+	     0x24, 0xbd, 0x03, 0x00, 0x88, 0x79, 0x14, 0x99, 0x94, 0x46,
+	     0x6b, 0x22, 0x00, 0x00, 0x21, 0x64, 0x3c, 0xb0, 0x12, 0xa1,
+	     0xd3, 0xf5, 0x6a, 0xa2, 0x70, 0x9f, 0x2d, 0x00, 0x80, 0xff,
+	     0xeb, 0xbc, 0x62, 0x4d, 0x99, 0x85, 0x0d, 0x62, 0x18, 0x16,
+	     0xeb, 0x38, 0x26, 0x4d, 0xa2, 0xe3, 0xb1, 0x04, 0x00, 0xc8,
+	     0x98, 0x01, 0xfe, 0xea, 0x65, 0xc2, 0x21, 0xd8, 0x00, 0xf6,
+	     0x0a, 0x47, 0x05, 0x00, 0x00, 0x00, 0x48, 0x52, 0xda, 0x3d,
+	     0xec, 0x2a, 0xdb, 0x45, 0xa9, 0x4f, 0x97, 0x73, 0xd4, 0x83,
+	     0x17, 0x75, 0x44, 0x00, 0x00, 0x02, 0xc4, 0xfc, 0x60, 0x5e,
+	     0x08, 0x00, 0x40, 0x92, 0xf8, 0xc2, 0x75, 0xc0, 0xb8, 0x53,
+	     0x20, 0x35, 0x00, 0x40, 0xd9, 0x01, 0x00, 0x00, 0x00, 0x48,
+	     0xcd, 0xf9, 0x60, 0xb8, 0x6b, 0x89, 0x44, 0xcc, 0x66, 0x28,
+	     0x13, 0x00, 0x10, 0xe1, 0x89, 0x3f, 0x0c, 0x47, 0x58, 0x51,
+	     0xdc, 0xb2, 0x24, 0xd0, 0x4d, 0x10, 0xc7, 0x10, 0xc0, 0xd8,
+	     0x38, 0xc1, 0x16, 0x27, 0x8c, 0x00, 0x80, 0x6e, 0x93, 0xc8,
+	     0x6b, 0x67, 0x04, 0x00, 0xf0, 0x33, 0x8c, 0xfc, 0x70, 0x71,
+	     0xf9, 0x2d, 0x00, 0x80, 0xbb, 0xe7, 0xf1, 0x92, 0x4f, 0x9c,
+	     0x80, 0x6d, 0x58, 0xaa, 0x2b, 0x34, 0x32, 0x0d, 0x57, 0x32,
+	     0x0d, 0x00, 0x90, 0x28, 0x78, 0x61, 0x39, 0xb7, 0x2e, 0x4d,
+	     0xa4, 0xa8, 0x9d, 0x54, 0x5e, 0x4f, 0x7a, 0x00, 0x00, 0x10,
+	     0xa5, 0x59, 0xbe, 0x78, 0x0d, 0x00, 0x00, 0xbd, 0xce, 0xd9,
+	     0x0e, 0x00, 0xd0, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x80, 0xf1, 0xdc, 0x1f, 0xa4, 0x70, 0x33, 0xf9, 0x0b,
+	     0xe8, 0xa1, 0xab, 0x14, 0x36, 0xdb, 0x2b, 0x35, 0x04, 0x00,
+	     0x00, 0x56, 0x92, 0x26, 0xaa, 0x10, 0x5e, 0x2e, 0x3f, 0x12,
+	     0xa3, 0x4a, 0x33, 0xd8, 0x9b, 0xc8, 0xd9, 0x63, 0x6d, 0x09,
+	     0x2a, 0x90, 0x4f, 0x80, 0x58, 0x6e, 0x86, 0x9b, 0xa0, 0xc2,
+	     0x09, 0x00, 0x00, 0x00, 0xc0, 0xdf, 0x1d, 0x35, 0x8a, 0x5f,
+	     0x3e, 0x34, 0xfc, 0x98, 0xd9, 0xc3, 0x2e, 0x89, 0x1a, 0x81,
+	     0x4a, 0x29, 0x6d, 0x48, 0x23, 0xdf, 0x48, 0x89, 0xd0, 0x8f,
+	     0x01, 0x00, 0xa0, 0x17, 0x60, 0x6b, 0x49, 0x0a, 0x28, 0x44,
+	     0xfd, 0x2a, 0x00, 0x00, 0xc5, 0xa9, 0xd1, 0xd0, 0xba, 0xaa,
+	     0xd9, 0x3d, 0x2c, 0x01, 0x00, 0x45, 0xbe, 0x23, 0x07, 0x00,
+	     0xc0, 0x15, 0x21, 0xf6, 0x02, 0x00, 0xec, 0x41, 0xee, 0x96,
+	     0x91, 0x3c, 0x00, 0x00, 0x24, 0x11, 0xb4, 0x80, 0x19, 0xb4,
+	     0xfb, 0x9d, 0x7a, 0xa4, 0x4b, 0x5a, 0x21, 0x00, 0x80, 0xa8,
+	     0x71, 0x57, 0xc9, 0xa5, 0x71, 0x1e, 0xd6, 0x9a, 0x1a, 0x54,
+	     0x00, 0x00, 0x34, 0x1a, 0x37, 0x23, 0x72, 0x07, 0x00, 0xc0,
+	     0x1b, 0x2d, 0x27, 0x9b, 0x98, 0x87, 0x8b, 0xc0, 0x0f, 0x00,
+	     0x80, 0x90, 0x67, 0x05, 0x03, 0x9a, 0x0c, 0x14, 0x89, 0x07,
+	     0xd6, 0xa2, 0x08, 0x0c, 0xa8, 0xb0, 0xc0, 0x02, 0x00, 0x28,
+	     0x45, 0xb6, 0x09, 0x7d, 0x86, 0x10, 0x0c, 0xed, 0x0f, 0x00,
+	     0x00, 0xa5, 0x61, 0x85, 0x8a, 0x38, 0xbd, 0x2c, 0x15, 0x98,
+	     0x83, 0x87, 0x7a, 0xc4, 0x48, 0xc2, 0x0d, 0x06, 0x00, 0x40,
+	     0x10, 0xbe, 0x9a, 0x00, 0x00, 0x8d, 0x07, 0x00, 0xc0, 0x95,
+	     0x09, 0x00, 0x40, 0xa1, 0x00, 0x00, 0xc4, 0xc0, 0x00, 0x00,
+	     0xaf, 0x92, 0x03, 0x1d, 0x00, 0xa0, 0x82, 0x06, 0x00, 0x98,
+	     0xf7, 0x04, 0x16, 0x62, 0x23, 0xa1, 0xc4, 0x43, 0x54, 0x17,
+	     0x67, 0xaf, 0x74, 0x10, 0x03, 0x32, 0xfc, 0xf3, 0xfa, 0x26,
+	     0x82, 0x96, 0xd3, 0x99, 0x25, 0x12, 0x00, 0x20, 0xd3, 0xc4,
+	     0x19, 0x99, 0x00, 0xb4, 0x3f, 0xc2, 0x20, 0x00, 0xc0, 0x93,
+	     0x02, 0x5b, 0xd4, 0x92, 0x4a, 0x9c, 0xb5, 0x2d, 0xe9, 0x33,
+	     0x77, 0x3f, 0x00, 0x40, 0xe8, 0x0b, 0x00, 0x10, 0xee, 0x03,
+	     0x00, 0x00, 0x00, 0x94, 0x6f, 0x68, 0x0e, 0x58, 0x46, 0x2e,
+	     0xb3, 0x2d, 0x50, 0x01, 0xd3, 0x2e, 0x19, 0xbb, 0x5a, 0x72,
+	     0x8a, 0x20, 0x24, 0x5d, 0x24, 0x4c, 0x2d, 0x22, 0x4b, 0x1b,
+	     0xbc, 0x05, 0xfe, 0x18, 0x29, 0x00, 0x80, 0xc8, 0x5d, 0x8f,
+	     0x64, 0xa1, 0x45, 0xe1, 0xaa, 0xdc, 0x5d, 0xeb, 0xca, 0x2b,
+	     0x32, 0x84, 0x05, 0x55, 0xec, 0x51, 0x22, 0xc4, 0x82, 0xc2,
+	     0x9f, 0x3d, 0x5c, 0x00, 0x00, 0xfe, 0x19, 0x00, 0x80, 0xa2,
+	     0x6b, 0x1f, 0x28, 0x06, 0xd0, 0x13, 0x9e, 0x9c, 0x2a, 0x94,
+	     0x21, 0x1a, 0x00, 0x00, 0x00, 0x80, 0xea, 0x28, 0x42, 0x04,
+	     0x00, 0xb8, 0xe8, 0x38, 0x4c, 0x1c, 0x13, 0x2b, 0xcb, 0x36,
+	     0xa4, 0x60, 0xe3, 0x0c, 0xd9, 0x43, 0x84, 0x8b, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x80, 0xe1, 0xe8, 0x4d, 0x62, 0xe3, 0x1a,
+	     0xf1, 0x9c, 0x7e, 0x14, 0x78, 0x81, 0x0b, 0x00, 0x00, 0x00,
+	     0x20, 0x8a, 0x08, 0x00, 0x88, 0xbb, 0xc1, 0x3f, 0xbc, 0x65,
+	     0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x00, 0x70, 0x3d, 0xd8,
+	     0x35, 0x01, 0x00, 0x0e, 0x67, 0xed, 0x2c, 0xef, 0xcf, 0xcb,
+	     0x49, 0x55, 0x96, 0x6f, 0x31, 0x64, 0x09, 0x89, 0xea, 0x43,
+	     0x3e, 0x13, 0xba, 0xa1, 0x49, 0xf3, 0xd4, 0xe7, 0xa9, 0x9a,
+	     0x1b, 0x22, 0x47, 0x40, 0x72, 0x6b, 0xc0, 0x06, 0xd6, 0x16,
+	     0xf0, 0x6d, 0xd5, 0x40, 0xfb, 0x25, 0x64, 0x40, 0x00, 0x00,
+	     0xa3, 0x2a, 0x29, 0x09, 0x80, 0xc4, 0x6e, 0x67, 0x29, 0x34,
+	     0x3a, 0x7c, 0x1b, 0x09, 0x4a, 0x90, 0x07, 0x39, 0x90, 0xc7,
+	     0x02, 0x00, 0xb0, 0xff, 0x8b, 0x01, 0x06, 0xc3, 0x60, 0x91,
+	     0xf4, 0x1d, 0xc0, 0x9c, 0xe3, 0x12, 0x00, 0xb0, 0x56, 0x99,
+	     0x27, 0x91, 0x07, 0x95, 0x93, 0x33, 0xbb, 0x97, 0x1c, 0x5b,
+	     0x4f, 0x27, 0xd8, 0x82, 0x8b, 0x5c, 0x51, 0xec, 0xe2, 0x11,
+	     0xa5, 0x40, 0x20, 0xa1, 0x43, 0x10, 0x10, 0x80, 0xd8, 0x8a,
+	     0xfe, 0xcd, 0x2e, 0xdb, 0x2b, 0x26, 0x4c, 0x06, 0xc8, 0xd5,
+	     0x45, 0x2b, 0x14, 0xf2, 0x21, 0x56, 0x11, 0x2f, 0x38, 0x80,
+	     0x00, 0x00, 0xa2, 0x1d, 0xf2, 0xa9, 0xea, 0x00, 0x70, 0x92,
+	     0x3e, 0x5e, 0xb7, 0xf2, 0x2c, 0x90, 0xc8, 0xf1, 0x91, 0x18,
+	     0x68, 0xc1, 0x25, 0x47, 0x00, 0x00, 0xa0, 0xb6, 0x2c, 0x6f,
+	     0xa8, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x10, 0x73, 0xac,
+	     0x9c, 0x25, 0x11, 0x69, 0x05, 0x00, 0x00, 0x6b, 0x82, 0x2c,
+	     0x00, 0x00, 0x30, 0xea, 0x02, 0x00, 0x50, 0x33, 0xd6, 0x37,
+	     0x20, 0xc8, 0x27, 0x21, 0xcc, 0x4e, 0x78, 0x05, 0x00, 0x50,
+	     0xf2, 0x5c, 0x25, 0x78, 0x29, 0x82, 0x90, 0x6f, 0x23, 0x79,
+	     0x06, 0x00, 0x80, 0x1c, 0x34, 0x70, 0x00, 0x00, 0xdc, 0x08,
+	     0x72, 0x16, 0x00, 0x80, 0xc3, 0x10, 0x0d, 0xc3, 0xd2, 0x72,
+	     0x42, 0x38, 0x23, 0xa1, 0x6b, 0x06, 0x08, 0x57, 0x03, 0x33,
+	     0x00, 0xde, 0x22, 0x95, 0xf4, 0xbf, 0xfd, 0x3d, 0x66, 0x88,
+	     0x56, 0xc4, 0x39, 0x81, 0xaf, 0xeb, 0x98, 0x27, 0xda, 0x03,
+	     0x00, 0x70, 0x58, 0xda, 0x29, 0x44, 0xa2, 0x5c, 0xa5, 0xf8,
+	     0xef, 0xa7, 0x40, 0x1e, 0xb3, 0x2d, 0x84, 0x18, 0x00, 0x00,
+	     0x6b, 0x11, 0xc9, 0x12, 0x00, 0x00, 0xa8, 0x36, 0xdf, 0xc8,
+	     0x8a, 0xb4, 0x3e, 0xe2, 0x88, 0x57, 0x3d, 0x29, 0x64, 0xa2,
+	     0x0f, 0x00, 0x00, 0x00, 0x98, 0x56, 0xd8, 0xb5, 0xb2, 0x58,
+	     0x00, 0x17, 0x12, 0xda, 0xf3, 0x4d, 0x95, 0x30, 0x59, 0x00,
+	     0x00, 0x78, 0x2c, 0x01, 0x00, 0x3d, 0x0b, 0x4b, 0x5e, 0x6b,
+	     0x69, 0x9c, 0x98, 0x6f, 0x00, 0x00, 0x2c, 0x6a, 0x58, 0x21,
+	     0xc2, 0x9f, 0x95, 0xdf, 0x84, 0x4e, 0xe8, 0x53, 0x1f, 0x03,
+	     0x00, 0x3c, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe7,
+	     0x45, 0x90, 0xa3, 0x5f, 0xc2, 0x07, 0x49, 0x12, 0x77, 0x4d,
+	     0xe0, 0x47, 0x85, 0x5e, 0x89, 0x72, 0xac, 0xf7, 0x9c, 0x2a,
+	     0xe7, 0xf5, 0x26, 0xe6, 0x3c, 0xd6, 0x4d, 0x00, 0x80, 0x9d,
+	     0xf2, 0xca, 0x03, 0x00, 0xc0, 0x3c, 0x16, 0x32, 0x20, 0x84,
+	     0x7d, 0x26, 0xf0, 0xcb, 0xd0, 0x69, 0xf9, 0x03, 0x00, 0xf8,
+	     0x70, 0x01, 0x00, 0xb0, 0x92, 0x9d, 0x1d, 0x59, 0xa3, 0x12,
+	     0x13, 0x00, 0x10, 0xd8, 0xe4, 0x72, 0x01, 0x00, 0xcc, 0x40,
+	     0x00, 0x00, 0xaf, 0xcf, 0x0c, 0x90, 0x46, 0xc2, 0xc0, 0xd1,
+	     0x21, 0x00, 0x00, 0x9c, 0x62, 0xbd, 0x8e, 0x88, 0x80, 0x30,
+	     0xc8, 0x6d, 0xa1, 0xce, 0xfa, 0x69, 0x72, 0x22, 0x27, 0x35,
+	     0x00, 0x00, 0x5d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x72, 0x43,
+	     0x2d, 0x02, 0x00, 0x00, 0x00, 0x06, 0xbd, 0x7f, 0x25, 0x54,
+	     0xf2, 0xc5, 0x62, 0x3b, 0x8b, 0x95, 0x00, 0x00, 0xfe, 0x24,
+	     0xd7, 0x26, 0x31, 0x4b, 0x8e, 0x0b, 0x00, 0x30, 0x0e, 0x02,
+	     0x00, 0x78, 0xa7, 0x18, 0x44, 0x9f, 0x1e, 0x31, 0xd5, 0x2e,
+	     0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x6e, 0xa6, 0x31,
+	     0x16, 0x18, 0x1d, 0x65, 0xc7, 0xf1, 0xc2, 0x20, 0x8f, 0x2c,
+	     0x14, 0xe1, 0x32, 0x00, 0x00, 0xeb, 0x3b, 0x43, 0x02, 0xf6,
+	     0x07, 0xb7, 0xe8, 0xc5, 0xcc, 0x14, 0x09, 0x18, 0xc1, 0x90,
+	     0x7a, 0xa6, 0xa2, 0x97, 0x51, 0x23, 0x7c, 0x97, 0xd5, 0x18,
+	     0x17, 0x00, 0x00, 0xa4, 0x09, 0x00, 0x80, 0x12, 0x61, 0x37,
+	     0x11, 0x40, 0x68, 0x8d, 0xd0, 0xd6, 0x20, 0x41, 0xc6, 0x4e,
+	     0x00, 0x80, 0x1e, 0x1b, 0x00, 0x40, 0xaa, 0xb0, 0xd1, 0xf4,
+	     0x8a, 0x78, 0x59, 0xda, 0x1d, 0x45, 0x45, 0x12, 0x23, 0x00,
+	     0x20, 0x97, 0xc2, 0x23, 0x44, 0x7c, 0x58, 0xc6, 0x58, 0x03,
+	     0x99, 0xb4, 0x36, 0xe1, 0xde, 0x22, 0xe7, 0xc1, 0x6b, 0x01,
+	     0x00, 0xf0, 0xac, 0x50, 0x31, 0xe9, 0x15, 0xbd, 0x07, 0x00,
+	     0x60, 0x0f, 0x09, 0x00, 0x00, 0x00, 0x28, 0x4d, 0x24, 0x92,
+	     0x26, 0x45, 0x14, 0x10, 0x00, 0x00, 0x00, 0xe0, 0x17, 0x1a,
+	     0x88, 0x55, 0x3f, 0xbe, 0x4a, 0x00, 0x80, 0xa2, 0x81, 0x8f,
+	     0x4e, 0x17, 0x24, 0xc7, 0x7a, 0x44, 0xf0, 0xa9, 0xfe, 0x64,
+	     0xe0, 0x3b, 0x00, 0x00, 0x00, 0x20, 0x06, 0x66, 0x95, 0x38,
+	     0x90, 0x6d, 0x71, 0x00, 0x00, 0x92, 0x2c, 0xc2, 0x25, 0xe2,
+	     0x8a, 0xfb, 0x81, 0x1e, 0xd1, 0x84, 0x18, 0x1c, 0x00, 0x00,
+	     0x00, 0x00, 0x5f, 0x9a, 0x57, 0x2c, 0x30, 0xd4, 0x91, 0x92,
+	     0x61, 0x2a, 0x19, 0x39, 0x5b, 0x50, 0x89, 0x2d, 0x17, 0x00,
+	     0xe0, 0xc1, 0x58, 0xd2, 0x63, 0xf7, 0xb9, 0x2c, 0xc5, 0x1d,
+	     0xbd, 0x96, 0xfa, 0x5e, 0xa3, 0xcb, 0xe5, 0x38, 0x1d, 0xf9,
+	     0x50, 0x9e, 0x7d, 0x3a, 0x27, 0xfc, 0xcb, 0x0e, 0x9d, 0x99,
+	     0x05, 0x00, 0x60, 0xe7, 0x02, 0x00, 0x58, 0x3e, 0xee, 0x2c,
+	     0x00, 0x00, 0x1d, 0xce, 0x82, 0xcc, 0x3f, 0xa4, 0x13, 0x81,
+	     0xf7, 0x00, 0x00, 0x78, 0x8a, 0x00, 0x80, 0x80, 0x8c, 0xd5,
+	     0xa6, 0x9a, 0x32, 0xaa, 0x03, 0x00, 0x0c, 0xbb, 0xd8, 0x67,
+	     0x1c, 0xa4, 0x87, 0x1e, 0xf4, 0x86, 0x3a, 0xd4, 0x81, 0x1a,
+	     0xb1, 0x00, 0x00, 0x30, 0x8d, 0xd8, 0x1f, 0x12, 0x23, 0x59,
+	     0xaf, 0xcc, 0x06, 0x00, 0x18, 0x57, 0x52, 0xeb, 0x00, 0x00,
+	     0xa9, 0x90, 0x23, 0x4d, 0x19, 0x70, 0xb3, 0x07, 0x80, 0xa1,
+	     0x32, 0x65, 0xee, 0x8a, 0x4d, 0x6e, 0x80, 0x0b, 0x10, 0xee,
+	     0x0c, 0xc2, 0x96, 0x46, 0xd4, 0x87, 0x49, 0x86, 0x00, 0x00,
+	     0x40, 0x84, 0x7c, 0x83, 0x4c, 0xf2, 0x42, 0x45, 0xbb, 0xd4,
+	     0x1b, 0x00, 0x00, 0x6c, 0x31, 0x72, 0xa6, 0xa8, 0xc7, 0x38,
+	     0x64, 0x92, 0xf4, 0xcd, 0xa3, 0x6f, 0xbd, 0xb5, 0x00, 0x00,
+	     0xa9, 0x4d, 0x00, 0x80, 0xa2, 0x11, 0xe3, 0xb1, 0x33, 0x9b,
+	     0x4a, 0xb8, 0x91, 0xea, 0x8a, 0x65, 0x3a, 0xce, 0x4e, 0x0c,
+	     0x72, 0xaf, 0xa7, 0x25, 0x02, 0x00, 0x14, 0x7e, 0xbc, 0x58,
+	     0xe7, 0x48, 0x8e, 0x80, 0x99, 0x03, 0xfc, 0x26, 0xc6, 0x78,
+	     0x91, 0x85, 0x2f, 0x56, 0x11, 0x0a, 0xb8, 0xff, 0x4e, 0xc0,
+	     0xf0, 0xce, 0xc8, 0x24, 0xf0, 0x71, 0xf5, 0x31, 0x55, 0x33,
+	     0xef, 0x4d, 0x1d, 0x5d, 0x54, 0x05, 0x00, 0x00, 0x5c, 0x5b,
+	     0xde, 0xb9, 0x1a, 0x22, 0x12, 0x00, 0x00, 0x2d, 0xde, 0x02,
+	     0x0a, 0x00, 0x80, 0x8e, 0x9c, 0x41, 0xb0, 0x65, 0xca, 0x62,
+	     0x65, 0xc4, 0x2a, 0xa3, 0xd4, 0xa9, 0xc3, 0xd6, 0x53, 0x62,
+	     0x1b, 0xfd, 0x24, 0x3d, 0x6c, 0xef, 0x24, 0xf3, 0x9f, 0xe9,
+	     0xb0, 0x18, 0x36, 0x31, 0x00, 0x00, 0xf0, 0x08, 0xcf, 0x62,
+	     0x37, 0x37, 0x00, 0x00, 0xf9, 0xa7, 0x9c, 0x00, 0x00, 0x58,
+	     0x53, 0x3c, 0xd0, 0xf4, 0x22, 0x55, 0x9f, 0xc0, 0x90, 0x2a,
+	     0x00, 0x00, 0x70, 0x84, 0x74, 0x71, 0x1d, 0x12, 0xbe, 0x25,
+	     0x19, 0x35, 0xa6, 0x11, 0xf3, 0xd2, 0x12, 0xe3, 0xfd, 0xb9,
+	     0x41, 0xce, 0x7e, 0x8c, 0x84, 0x5a, 0x35, 0xdc, 0x12, 0x00,
+	     0x00, 0x00, 0x90, 0xce, 0x09, 0x2d, 0x50, 0xe9, 0xa8, 0x20,
+	     0x2b, 0x22, 0x00, 0xc0, 0x7f, 0x06, 0x00, 0x20, 0x9e, 0x04,
+	     0x00, 0x28, 0x93, 0xfa, 0x0b, 0x11, 0x09, 0x00, 0x40, 0xe6,
+	     0xac, 0x39, 0x02, 0x00, 0x70, 0xe8, 0xe1, 0x10, 0x80, 0x23,
+	     0x80, 0x28, 0x00, 0x00, 0x00, 0xa0, 0xb6, 0xe9, 0x15, 0x01,
+	     0x00, 0x9c, 0x8f, 0xc4, 0x85, 0x5c, 0xb2, 0xcb, 0x13, 0xa0,
+	     0x0e, 0x5f, 0xb0, 0x15, 0xe8, 0x6c, 0xda, 0x8d, 0xd4, 0x69,
+	     0xe6, 0xc1, 0x11, 0x89, 0xb0, 0x05, 0x00, 0x90, 0x64, 0x19,
+	     0x23, 0x01, 0x00, 0x8a, 0x28, 0x00, 0x00, 0x90, 0xcc, 0x58,
+	     0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x12, 0xfe, 0x59,
+	     0x00, 0x00, 0x97, 0x1a, 0x00, 0xc0, 0x77, 0x03, 0xf8, 0x80,
+	     0x38, 0xd8, 0x7b, 0x26, 0x11, 0x00, 0x00, 0x54, 0x26, 0xed,
+	     0xe0, 0xe2, 0x10, 0x99, 0x2a, 0x58, 0x08, 0x63, 0x6e, 0x17,
+	     0xa5, 0x1a, 0x37, 0x0d, 0x00, 0x80, 0x42, 0x66, 0xa7, 0x8b,
+	     0xa9, 0x29, 0x32, 0x0d, 0x49, 0x8b, 0x9c, 0x8b, 0xd9, 0x20,
+	     0x4f, 0xa6, 0x11, 0x74, 0x2c, 0x9b, 0xc1, 0x87, 0x00, 0x00,
+	     0x97, 0x46, 0xac, 0x66, 0xf2, 0xac, 0xd7, 0xd6, 0x36, 0x6c,
+	     0x8d, 0x55, 0xf0, 0x7c, 0x4d, 0xd3, 0x48, 0xe3, 0x11, 0x00,
+	     0x00, 0x00, 0x50, 0x36, 0xd3, 0xbb, 0x81, 0x96, 0xe4, 0x06,
+	     0x28, 0x84, 0xda, 0x4b, 0x05, 0x50, 0x3f, 0x02, 0x00, 0xb0,
+	     0x03, 0x70, 0x18, 0xc5, 0x65, 0x99, 0x22, 0x00, 0xc0, 0x48,
+	     0xe3, 0x59, 0x27, 0xde, 0xc3, 0xf8, 0x45, 0x37, 0x96, 0x54,
+	     0x87, 0x8d, 0x4c, 0xda, 0x35, 0x71, 0x54, 0xc3, 0x70, 0x83,
+	     0x59, 0x01, 0x00, 0x9c, 0x60, 0xe1, 0x0c, 0xa9, 0x10, 0x00,
+	     0x00, 0x18, 0x01, 0x00, 0xc8, 0xe6, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0xe7, 0x1e, 0xae, 0x47, 0x7d, 0x29, 0xd4, 0x8a,
+	     0x1e, 0x04, 0x69, 0x1c, 0x1f, 0x70, 0x98, 0x8f, 0x48, 0x9f,
+	     0xa6, 0xfd, 0xd0, 0x8b, 0xc9, 0x1f, 0xae, 0xae, 0x54, 0x82,
+	     0xae, 0x29, 0x24, 0x16, 0x00, 0x00, 0x72, 0x09, 0x00, 0x00,
+	     0x00, 0xac, 0x33, 0xf1, 0x26, 0xac, 0xad, 0x5d, 0xc6, 0x53,
+	     0x26, 0xe4, 0x04, 0x00, 0x38, 0x32, 0x92, 0xfb, 0xaa, 0x6a,
+	     0x98, 0x93, 0xb4, 0x1c, 0xe9, 0x43, 0x6a, 0x84, 0x75, 0x04,
+	     0x00, 0x44, 0x41, 0xf0, 0x80, 0xa7, 0x47, 0x5b, 0x1d, 0x21,
+	     0xe9, 0x5e, 0x96, 0xae, 0x04, 0x00, 0x00, 0x00, 0xda, 0x9b,
+	     0xc7, 0x0e, 0x79, 0x57, 0xb8, 0xc9, 0x67, 0xc6, 0x5f, 0x04,
+	     0x00, 0x80, 0x0a, 0x02, 0x87, 0x33, 0xb1, 0x8a, 0x03, 0x00,
+	     0x00, 0xf1, 0xa6, 0x08, 0x03, 0x00, 0xd4, 0x84, 0x00, 0x00,
+	     0x40, 0x94, 0x92, 0xd2, 0xb1, 0x0c, 0x17, 0x74, 0x0f, 0x7b,
+	     0x3e, 0x54, 0x91, 0x16, 0x3c, 0x84, 0xc5, 0xc5, 0x02, 0x00,
+	     0x00, 0x00, 0x90, 0xcc, 0xc1, 0x7d, 0xc9, 0xdb, 0xca, 0x52,
+	     0x18, 0x98, 0x1f, 0x19, 0x00, 0xc0, 0xc4, 0x08, 0x00, 0x20,
+	     0x61, 0x75, 0x22, 0x6c, 0x17, 0xdc, 0x17, 0xf6, 0x1b, 0x5e,
+	     0x13, 0x00, 0x20, 0x64, 0x58, 0xf0, 0x90, 0xb6, 0x72, 0x49,
+	     0x24, 0x10, 0xfa, 0x23, 0x00, 0x00, 0x00, 0xd0, 0x96, 0x0a,
+	     0xcc, 0x5c, 0xa9, 0x00, 0x00, 0x22, 0x37, 0x00, 0x40, 0x97,
+	     0x11, 0x00, 0x60, 0x8b, 0x3c, 0xc8, 0x19, 0x12, 0x00, 0x00,
+	     0x49, 0x07, 0xe3, 0xe4, 0x58, 0xa3, 0xae, 0xd1, 0x5b, 0xe8,
+	     0x4e, 0x49, 0xc1, 0x72, 0x67, 0x1d, 0xc0, 0x4a, 0xc2, 0x69,
+	     0x6f, 0xc8, 0xf6, 0xd0, 0x02, 0x4a, 0x99, 0xc7, 0xc8, 0x6c,
+	     0x00, 0x00, 0x00, 0x80, 0x28, 0xa5, 0xfd, 0xd1, 0xd8, 0xea,
+	     0x97, 0x3c, 0xc5, 0xc8, 0x1c, 0x00, 0x80, 0x3b, 0xc6, 0x1d,
+	     0xc9, 0x34, 0x57, 0x9a, 0xc0, 0x1b, 0x5e, 0x96, 0xa4, 0x81,
+	     0x00, 0x80, 0x54, 0x8b, 0x59, 0x6e, 0x8f, 0x05, 0x00, 0x70,
+	     0xbd, 0x24, 0x93, 0x0e, 0x4d, 0xce, 0x0b, 0x00, 0x00, 0x00,
+	     0xe0, 0xc2, 0x37, 0x1c, 0x59, 0x68, 0x6a, 0xfc, 0xaa, 0x99,
+	     0x00, 0x80, 0x23, 0x22, 0x00, 0xa0, 0xf6, 0x23, 0x08, 0x04,
+	     0x00, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x80, 0xdd, 0x85, 0xe5,
+	     0xa5, 0x88, 0xf7, 0x8a, 0x41, 0x04, 0x39, 0x56, 0x8a, 0x8e,
+	     0xc5, 0xc6, 0xdb, 0x55, 0x3c, 0xad, 0x9d, 0x46, 0xc3, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4d, 0xa8,
+	     0x8c, 0x16, 0x01, 0x00, 0x58, 0x67, 0x25, 0xb2, 0x5c, 0x3a,
+	     0xaa, 0xaf, 0xdd, 0x03, 0x80, 0x6b, 0xc2, 0x65, 0xbf, 0x71,
+	     0x23, 0xce, 0xb9, 0x12, 0x23, 0x00, 0x80, 0xe4, 0xd5, 0xdf,
+	     0xca, 0xe4, 0x41, 0x7e, 0x9a, 0xac, 0x00, 0x00, 0xac, 0x2f,
+	     0x00, 0x00, 0x22, 0x52, 0x59, 0x86, 0xaf, 0xa3, 0xb8, 0x5b,
+	     0x34, 0x01, 0x00, 0x34, 0x20, 0xb7, 0x46, 0x8a, 0x5c, 0x5a,
+	     0x09, 0x83, 0x92, 0x55, 0x23, 0xbc, 0x20, 0x3e, 0xf0, 0x12,
+	     0x00, 0x80, 0x0a, 0x0d, 0x0e, 0xec, 0x0d, 0x25, 0x05, 0xa3,
+	     0x52, 0x01, 0x90, 0x00, 0x00, 0x1d, 0x00, 0x2d, 0xda, 0x1b,
+	     0x30, 0xc8, 0x36, 0x00, 0xb8, 0x00, 0xdc, 0xa1, 0x58, 0x58,
+	     0x25, 0xc5, 0x6c, 0x97, 0x92, 0x81, 0x2f, 0x81, 0xbe, 0x01,
+	     0x00, 0x10, 0xc8, 0x00, 0x00, 0x26, 0x20, 0x5d, 0x17, 0xa1,
+	     0xe8, 0xef, 0xf3, 0xf2, 0x0a, 0x99, 0xa0, 0x39, 0xa6, 0x34,
+	     0x69, 0x3b, 0x3f, 0x0c, 0x00, 0xa0, 0x9d, 0xc3, 0xe1, 0xbb,
+	     0xf2, 0x00, 0x00, 0xc8, 0x11, 0x4b, 0x9c, 0x48, 0x02, 0x86,
+	     0x01, 0x00, 0xe0, 0x91, 0x41, 0x12, 0xf2, 0xe0, 0x66, 0x84,
+	     0x76, 0xcb, 0xf5, 0x08, 0xac, 0x90, 0xec, 0xb6, 0xd8, 0x6c,
+	     0xc3, 0x01, 0x00, 0x00, 0x00, 0xba, 0xc6, 0x3f, 0x12, 0x00,
+	     0xa0, 0xfd, 0x03, 0x00, 0xc0, 0xea, 0xb5, 0xd6, 0x00, 0x00,
+	     0x89, 0x94, 0x38, 0x03, 0xd5, 0x6c, 0xed, 0xc1, 0xd2, 0x74,
+	     0xb7, 0x7c, 0x16, 0x01, 0x00, 0x73, 0x1e, 0x00, 0xc0, 0xc3,
+	     0x65, 0x10, 0xe2, 0x98, 0x02, 0x00, 0x28, 0x3f, 0x4c, 0x94,
+	     0x47, 0x31, 0x6c, 0x4c, 0x5d, 0xea, 0x32, 0xb6, 0x28, 0xd8,
+	     0xad, 0x55, 0xff, 0xc4, 0x2c, 0xfd, 0xb1, 0xd4, 0x61, 0x5e,
+	     0x4e, 0x4f, 0x06, 0x00, 0xc8, 0xa5, 0x90, 0x80, 0x38, 0x82,
+	     0x7f, 0xc1, 0x98, 0x0e, 0x00, 0x00, 0x1a, 0x80, 0x0f, 0xda,
+	     0x11, 0xf0, 0xd4, 0x98, 0x25, 0x26, 0x41, 0x00, 0x80, 0xfa,
+	     0xe0, 0xc6, 0x01, 0x00, 0x88, 0x68, 0x01, 0x00, 0x2e, 0x3d,
+	     0x53, 0xc7, 0x67, 0x14, 0x00, 0xc0, 0x18, 0xe9, 0xbf, 0xac,
+	     0x26, 0x9c, 0xd2, 0xc2, 0x93, 0x13, 0x05, 0x00, 0x80, 0x78,
+	     0xa9, 0x1f, 0x04, 0x00, 0xf0, 0x15, 0x00, 0x00, 0xea, 0x25,
+	     0xf1, 0x82, 0xda, 0x8d, 0xc1, 0x0b, 0x51, 0xd9, 0x1d, 0x53,
+	     0x1e, 0x01, 0x00, 0x82, 0x98, 0x2a, 0x2f, 0xd6, 0x1a, 0x00,
+	     0x00, 0x00, 0x00, 0xf1, 0xf0, 0x4a, 0x75, 0x70, 0x00, 0x00,
+	     0x89, 0x97, 0x4c, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x19, 0xb1,
+	     0x36, 0x00, 0x00, 0xdc, 0x7d, 0x13, 0x94, 0x60, 0x24, 0x00,
+	     0xe0, 0x5a, 0x71, 0xd9, 0x7b, 0x60, 0x05, 0xa5, 0x00, 0x00,
+	     0x89, 0x05, 0x00, 0x00, 0xc5, 0x4d, 0xf0, 0x57, 0x23, 0x48,
+	     0x5e, 0x7e, 0x34, 0xa9, 0x3f, 0xf0, 0xa5, 0xdc, 0xde, 0x7f,
+	     0x53, 0xa5, 0x08, 0x00, 0xe8, 0xa5, 0x34, 0x2f, 0xf2, 0x34,
+	     0xc0, 0x2a, 0x00, 0x80, 0x22, 0x2c, 0x53, 0x21, 0xf8, 0x00,
+	     0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x07, 0x00,
+	     0xc0, 0x60, 0x19, 0xd4, 0xd3, 0x19, 0x59, 0x13, 0x13, 0x67,
+	     0x00, 0x00, 0x00, 0x40, 0x29, 0xa4, 0xca, 0x04, 0x00, 0xe0,
+	     0xf8, 0x00, 0x00, 0x2c, 0x62, 0x00, 0x00, 0x11, 0x0d, 0x00,
+	     0xa0, 0xdf, 0x97, 0xd0, 0xd9, 0x6d, 0xd5, 0x0e, 0xa9, 0x05,
+	     0x14, 0x35, 0x73, 0xc8, 0x69, 0xc0, 0x63, 0x47, 0x6d, 0x7b,
+	     0xe6, 0x89, 0xae, 0x00, 0x00, 0x86, 0x0e, 0x95, 0xdb, 0x78,
+	     0x48, 0x0a, 0x44, 0x63, 0x3a, 0x4c, 0x01, 0x00, 0x22, 0x74,
+	     0xaf, 0x95, 0xff, 0x09, 0x00, 0x80, 0x57, 0x69, 0x1d, 0xb4,
+	     0xed, 0x6d, 0x30, 0x00, 0x00, 0xa2, 0xad, 0x08, 0x50, 0x75,
+	     0x22, 0xd5, 0xd2, 0xaa, 0x38, 0x0d, 0x3d, 0xb1, 0x00, 0x00,
+	     0x31, 0xac, 0x2e, 0x82, 0x21, 0x91, 0xa1, 0x79, 0x45, 0xf9,
+	     0x5d, 0x02, 0x00, 0x48, 0x39, 0x00, 0x00, 0x24, 0xa6, 0xdc,
+	     0xc5, 0x64, 0x02, 0x00, 0xb8, 0x0b, 0x00, 0x00, 0xe6, 0x2e,
+	     0x08, 0xb1, 0x9a, 0xc0, 0x44, 0x42, 0x9b, 0xc6, 0x7e, 0xb8,
+	     0x2f, 0xce, 0xcc, 0x1a, 0x06, 0xe1, 0x1d, 0x00, 0x00, 0x17,
+	     0xcd, 0x8b, 0xf1, 0x43, 0xe4, 0x9b, 0x49, 0x31, 0xa6, 0x9a,
+	     0xe6, 0x9a, 0x84, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd5, 0xe3,
+	     0xa8, 0x08, 0xaf, 0xc2, 0x5c, 0x79, 0x30, 0xb6, 0xc2, 0x03,
+	     0x03, 0x46, 0x03, 0x00, 0xc8, 0x79, 0x09, 0x6d, 0xaa, 0x87,
+	     0x00, 0x00, 0x9d, 0xdd, 0x3a, 0x62, 0x92, 0x43, 0x68, 0x89,
+	     0x43, 0x10, 0x67, 0x00, 0x00, 0xc0, 0x2b, 0xdb, 0x0b, 0x00,
+	     0x00, 0x98, 0x05, 0x00, 0x40, 0x34, 0x19, 0xb0, 0x00, 0x00,
+	     0x09, 0xbf, 0x09, 0xdc, 0x3a, 0x53, 0xe2, 0xb4, 0xe8, 0x00,
+	     0x00, 0x8c, 0xe2, 0xf4, 0x6f, 0xe3, 0x3a, 0x36, 0x23, 0x00,
+	     0xc0, 0x6e, 0xe2, 0x13, 0x89, 0x39, 0xdd, 0x1e, 0x63, 0x9b,
+	     0x53, 0xc7, 0xf7, 0x9d, 0xc2, 0xe7, 0xca, 0xd2, 0xb5, 0x80,
+	     0x09, 0xf5, 0x05, 0x5d, 0x08, 0xf8, 0x30, 0xbe, 0xc2, 0xd7,
+	     0x85, 0x14, 0x34, 0x34, 0xc0, 0x59, 0x50, 0x77, 0xfc, 0x03,
+	     0xd7, 0xb9, 0x04, 0xe0, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xc8,
+	     0x87, 0x00, 0x00, 0xc0, 0x81, 0x24, 0x09, 0x00, 0x00, 0xca,
+	     0x4a, 0x8d, 0x71, 0x7f, 0xfc, 0x26, 0xe2, 0x63, 0xcc, 0x61,
+	     0x7f, 0xbf, 0x1d, 0x94, 0x36, 0x31, 0xfd, 0xd1, 0x93, 0x90,
+	     0xee, 0x6d, 0xbf, 0x1c, 0x1f, 0xe2, 0x8c, 0x99, 0x23, 0x46,
+	     0xe0, 0xfc, 0x71, 0x89, 0x21, 0xa4, 0xf8, 0x6a, 0xd8, 0x5d,
+	     0x29, 0x43, 0x50, 0xcc, 0x5b, 0x49, 0xc5, 0x04, 0x00, 0xf8,
+	     0x95, 0x74, 0xec, 0x00, 0x00, 0x00, 0x00, 0x18, 0x09, 0xf9,
+	     0x89, 0x4a, 0x05, 0x14, 0x34, 0x3a, 0xd8, 0x4d, 0x00, 0x00,
+	     0x00, 0x00, 0x16, 0xd9, 0xa0, 0x41, 0xd5, 0x30, 0x53, 0x29,
+	     0x85, 0xd9, 0x23, 0xf1, 0x61, 0x80, 0x1d, 0x00, 0xc0, 0x4a,
+	     0x89, 0xee, 0x07, 0x00, 0x90, 0xd7, 0xbc, 0x31, 0x6e, 0x2e,
+	     0x0d, 0x9f, 0x3c, 0x21, 0x00, 0x40, 0xbb, 0x06, 0x00, 0x00,
+	     0x00, 0xe0, 0x70, 0x1c, 0x18, 0x00, 0x80, 0xa0, 0x22, 0x00,
+	     0x40, 0xf1, 0x05, 0x51, 0x51, 0x52, 0x14, 0x23, 0x05, 0x82,
+	     0x00, 0x80, 0xe5, 0x43, 0x68, 0xe7, 0x8b, 0xd5, 0x02, 0x04,
+	     0x6b, 0x15, 0x1b, 0x32, 0x7f, 0x00, 0x80, 0xef, 0x0c, 0xd6,
+	     0xc6, 0x14, 0x03, 0x00, 0x30, 0x79, 0x9d, 0x0c, 0x9f, 0x85,
+	     0x0e, 0x16, 0xe7, 0x10, 0x00, 0x60, 0xf3, 0x06, 0x14, 0x84,
+	     0xf4, 0xcc, 0x09, 0x7a, 0x67, 0xec, 0x21, 0xc4, 0x03, 0xf8,
+	     0x8f, 0xc8, 0x02, 0x00, 0x00, 0x00, 0x60, 0xd6, 0x8c, 0x5c,
+	     0xf1, 0x16, 0x02, 0x07, 0x00, 0x00, 0x63, 0xa3, 0xbb, 0x89,
+	     0x7a, 0x39, 0x41, 0x46, 0x85, 0x00, 0x80, 0xa7, 0x09, 0x00,
+	     0x60, 0x91, 0x21, 0x44, 0x5b, 0x9b, 0x24, 0xe7, 0xee, 0x55,
+	     0x2e, 0x9c, 0x6c, 0x5d, 0xc5, 0x09, 0x00, 0x00, 0x00, 0x20,
+	     0x24, 0x51, 0xd3, 0xd2, 0x3b, 0xd8, 0x4d, 0x3d, 0x83, 0xa4,
+	     0x07, 0x00, 0x80, 0xcb, 0x9c, 0x21, 0x01, 0x00, 0x90, 0x76,
+	     0x00, 0x80, 0xfc, 0xcd, 0x8d, 0x6f, 0x0c, 0x24, 0xca, 0x6b,
+	     0x70, 0x4e, 0x1b, 0xde, 0x63, 0x00, 0x80, 0xf0, 0x23, 0x00,
+	     0x00, 0x00, 0xe0, 0x03, 0xeb, 0x53, 0x54, 0x7e, 0xda, 0x6f,
+	     0x00, 0x00, 0xbd, 0xce, 0x5b, 0xe3, 0xd4, 0x06, 0x6b, 0x0c,
+	     0x88, 0x00, 0x47, 0x00, 0x00, 0x2c, 0x17, 0x5e, 0xd2, 0x28,
+	     0x0e, 0x28, 0x10, 0x8b, 0x23, 0xcd, 0x45, 0x0f, 0xa1, 0x3e,
+	     0xe8, 0x49, 0x00, 0x40, 0x10, 0x60, 0xc3, 0x11, 0x23, 0x11,
+	     0xca, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xbf, 0xf1, 0x08, 0xc1,
+	     0xcb, 0x29, 0xd9, 0x97, 0xe1, 0x2a, 0x96, 0x27, 0x5c, 0x4e,
+	     0x39, 0x1c, 0x53, 0x0e, 0x00, 0xa0, 0x3f, 0x40, 0x20, 0xf3,
+	     0x28, 0x75, 0x5d, 0x2e, 0x0c, 0x00, 0x80, 0x24, 0xa1, 0xc6,
+	     0x08, 0x00, 0x90, 0xb6, 0x68, 0xae, 0xe5, 0xa1, 0xc4, 0x13,
+	     0x4b, 0x97, 0x7c, 0x42, 0xed, 0x83, 0x82, 0x77, 0x43, 0x88,
+	     0x61, 0x2a, 0x7c, 0x7a, 0x2c, 0x83, 0xa7, 0xcd, 0x51, 0x08,
+	     0xd2, 0xad, 0x04, 0x00, 0x88, 0x74, 0x01, 0x00, 0xc8, 0x5d,
+	     0x0e, 0x0d, 0x1b, 0x95, 0xb5, 0x07, 0x00, 0x00, 0x00, 0xf8,
+	     0x04, 0x00, 0x00, 0x42, 0x3a, 0xb6, 0xb3, 0xdf, 0x24, 0x7f,
+	     0x2a, 0xb0, 0x51, 0xbe, 0x5c, 0x99, 0xf1, 0x13, 0x3e, 0x7d,
+	     0x20, 0x22, 0xc2, 0x8b, 0x06, 0x91, 0x28, 0xc1, 0xa9, 0xd0,
+	     0x07, 0x00, 0x00, 0xe2, 0x94, 0xa0, 0x3e, 0x00, 0x00, 0xf7,
+	     0x64, 0xc8, 0x66, 0x7e, 0xea, 0xb5, 0x6d, 0x21, 0x01, 0x00,
+	     0x66, 0x30, 0x00, 0xc0, 0x7c, 0x84, 0x5a, 0xb0, 0x2b, 0x02,
+	     0x1f, 0x22, 0xfa, 0xb8, 0x0d, 0xec, 0x35, 0x4c, 0x12, 0xf2,
+	     0x6e, 0x59, 0x91, 0x00, 0x44, 0xe7, 0x00, 0x00, 0x4c, 0x68,
+	     0x00, 0x80, 0x7a, 0xe0, 0xe3, 0x04, 0x9d, 0x47, 0xb2, 0x03,
+	     0x00, 0x94, 0x17, 0x4f, 0x0d, 0x82, 0xaa, 0x1b, 0x14, 0x00,
+	     0xe0, 0x08, 0x57, 0x1a, 0x02, 0x5a, 0xec, 0xb8, 0xdc, 0x21,
+	     0x00, 0x80, 0xd6, 0x0c, 0xb6, 0x8f, 0xd3, 0xf7, 0x83, 0x5b,
+	     0xae, 0xb5, 0x0d, 0x00, 0x00, 0x83, 0x93, 0x73, 0x53, 0x26,
+	     0x05, 0x00, 0x40, 0xcd, 0x03, 0x00, 0x68, 0x5d, 0xfe, 0x4f,
+	     0xa3, 0x1d, 0x5c, 0x56, 0x95, 0xa8, 0xab, 0x02, 0x00, 0xe8,
+	     0xbf, 0x01, 0x00, 0x00, 0x00, 0x3f, 0xb4, 0xc0, 0x09, 0x00,
+	     0x40, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00,
+	     0x00, 0x00, 0x2e, 0x50, 0x21, 0x09, 0x00, 0x00, 0x00, 0xa0,
+	     0x34, 0x7d, 0xe4, 0xc8, 0x10, 0x58, 0x4a, 0x9f, 0x04, 0x28,
+	     0xe0, 0xa3, 0xd2, 0x16, 0xfb, 0xf8, 0xec, 0xe7, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x40, 0x20, 0xa3, 0x96, 0x68, 0x68, 0xd3,
+	     0xea, 0x39, 0xfc, 0x10, 0x2d, 0x00, 0x00, 0x00, 0xc0, 0xdd,
+	     0x88, 0xb8, 0x08, 0x00, 0x08, 0x69, 0x06, 0xf1, 0xf4, 0x7d,
+	     0xed, 0x0a, 0x47, 0x15, 0x20, 0xce, 0x95, 0xa1, 0x68, 0x79,
+	     0x03, 0x15, 0x2a, 0x5d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x2f,
+	     0xa3, 0xf5, 0xb6, 0x1a, 0x6a, 0xa6, 0x01, 0x00, 0x0c, 0x1b,
+	     0x39, 0x49, 0x00, 0x00, 0x00, 0xa0, 0xe2, 0xd0, 0x9d, 0x04,
+	     0x00, 0xe0, 0x7d, 0xf0, 0x26, 0xf9, 0x46, 0x1f, 0xe4, 0xc7,
+	     0xae, 0x3a, 0xc6, 0x71, 0x00, 0x00, 0xfc, 0xdf, 0x34, 0x4e,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x8e, 0xc2, 0x04, 0x01,
+	     0x00, 0xd4, 0x16, 0x3c, 0x81, 0x48, 0x37, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x90, 0x76, 0x03, 0x00, 0x84, 0xa8, 0xec, 0x63,
+	     0xef, 0x95, 0xa7, 0xc3, 0x53, 0x09, 0x00, 0x00, 0x00, 0x98,
+	     0x01, 0x7c, 0x1b, 0xa5, 0x64, 0x00, 0x00, 0x00, 0x00, 0xec,
+	     0x12, 0x00, 0x60, 0x7b, 0xf4, 0xed, 0x00, 0x00, 0x34, 0x9b,
+	     0x00, 0x00, 0x5e, 0x53, 0x7f, 0x4f, 0xc9, 0x15, 0x43, 0x82,
+	     0x26, 0x00, 0x00, 0x40, 0x46, 0x7c, 0x96, 0x67, 0x52, 0x6b,
+	     0x67, 0x10, 0xe2, 0xcd, 0x01, 0x00, 0x00, 0x37, 0x00, 0x00,
+	     0x37, 0x06, 0x00, 0x80, 0xf8, 0x72, 0xc2, 0xb2, 0xca, 0x03,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x36, 0x36, 0xd9, 0xb2,
+	     0x2e, 0x9a, 0x68, 0x67, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x4d,
+	     0x3d, 0x14, 0x00, 0xc0, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0xf4, 0x39, 0x48, 0x82, 0x5b, 0x3d, 0xf8, 0x1f, 0x41,
+	     0xc8, 0x78, 0xf6, 0x7a, 0x34, 0x31, 0x01, 0x00, 0x44, 0x18,
+	     0x01, 0x0b, 0xd1, 0x16, 0x00, 0x00, 0xec, 0x26, 0x24, 0x04,
+	     0x00, 0x4c, 0x8d, 0x3c, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	     0xae, 0x22, 0x09, 0x00, 0x10, 0xd0, 0x00, 0x12, 0xb3, 0x7d,
+	     0x00, 0x80, 0x6d, 0x13, 0x00, 0x00, 0x00, 0x30, 0xd6, 0xf0,
+	     0x70, 0x01, 0x00, 0x60, 0x31, 0xfe, 0x3e, 0x00, 0x40, 0x4a,
+	     0x45, 0x87, 0x09, 0x00, 0x08, 0x64, 0x6e, 0xc8, 0xc6, 0x69,
+	     0x00, 0x00, 0x00, 0xc0, 0x6a, 0x83, 0xa2, 0x32, 0xe4, 0xc3,
+	     0x34, 0x4d, 0x43, 0xb4, 0x63, 0x70, 0xbe, 0x81, 0x8c, 0x4e,
+	     0x6a, 0xf9, 0x06, 0x00, 0x50, 0x0b, 0xf2, 0x3d, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x40, 0x48, 0x05, 0x00, 0xf0, 0x1f, 0x30,
+	     0x21, 0x01, 0x00, 0x7a, 0x2a, 0x00, 0x80, 0xb0, 0x12, 0x00,
+	     0x60, 0xf4, 0x53, 0xde, 0x7b, 0xe9, 0x00, 0x00, 0xae, 0x7b,
+	     0x00, 0x80, 0xbb, 0x0b, 0x00, 0x00, 0x00, 0x90, 0x9f, 0x02,
+	     0x00, 0x38, 0x21, 0xe4, 0x33, 0x40, 0x91, 0xe8, 0x10, 0x00,
+	     0xc0, 0x98, 0x72, 0x67, 0x81, 0xa4, 0xc8, 0x4d, 0x46, 0x1a,
+	     0xf1, 0x9c, 0xda, 0x21, 0x0a, 0x2a, 0x09, 0x11, 0xd0, 0x23,
+	     0x83, 0x01, 0x00, 0xda, 0x1e, 0x00, 0x80, 0xf8, 0x9c, 0xdb,
+	     0x03, 0x00, 0x00, 0x00, 0x68, 0x01, 0x02, 0x1c, 0x89, 0x97,
+	     0xf0, 0x02, 0x00, 0x00, 0x00, 0xa0, 0x37, 0x72, 0xc9, 0xbb,
+	     0x5e, 0x05, 0xa8, 0x00, 0x00, 0x00, 0x80, 0x9b, 0x5e, 0x14,
+	     0x53, 0xdd, 0xd4, 0x38, 0x00, 0x00, 0x0c, 0x23, 0xcc, 0x57,
+	     0x7c, 0x2e, 0x00, 0xc0, 0xd5, 0xa2, 0xce, 0x01, 0x5e, 0xb8,
+	     0x90, 0x5d, 0x25, 0xf4, 0x67, 0x00, 0x80, 0x61, 0x62, 0x55,
+	     0xb2, 0x02, 0x50, 0xd1, 0x4c, 0xe5, 0x01, 0x00, 0x20, 0x07,
+	     0x2c, 0x29, 0x00, 0x00, 0x00, 0xa0, 0x70, 0x54, 0x7b, 0xfb,
+	     0x6e, 0x01, 0x00, 0x32, 0x2d, 0x00, 0x80, 0x19, 0x22, 0x00,
+	     0x20, 0xea, 0xb8, 0x7e, 0x1b, 0x1d, 0x60, 0x84, 0x00, 0x00,
+	     0x00, 0x80, 0x10, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	     0xfa, 0x61, 0x04, 0xcc, 0x99, 0xb5, 0x1c, 0x00, 0x00, 0x18,
+	     0x0c, 0x61, 0x07, 0x00, 0x58, 0xc2, 0x81, 0x6a, 0x12, 0x81,
+	     0xa5, 0xc0, 0xba, 0x65, 0x90, 0xa7, 0x13, 0x09, 0x00, 0x40,
+	     0xa3, 0xcd, 0x25, 0xac, 0x18, 0x1b, 0xc4, 0x76, 0x0b, 0xfe,
+	     0x11, 0x00, 0x00, 0x00, 0xb8, 0xe5, 0x7d, 0xdb, 0x00, 0x00,
+	     0xf3, 0x37, 0x74, 0xe4, 0xa8, 0x4b, 0xe8, 0x00, 0x00, 0x00,
+	     0x00, 0x5c, 0x1b, 0x84, 0x7f, 0xf3, 0x03, 0x84, 0x1d, 0x00,
+	     0xe0, 0xfc, 0x01, 0x00, 0x90, 0x57, 0xd2, 0x31, 0xf7, 0x40,
+	     0xb3, 0x02, 0x20, 0x0b, 0x00, 0x40, 0x95, 0x81, 0xf4, 0x03,
+	     0x00, 0x00, 0x00, 0x9a, 0x7a, 0x99, 0xc2, 0xdf, 0xcb, 0x3e,
+	     0x12, 0x00, 0xa0, 0x96, 0x53, 0x72, 0x01, 0x00, 0x72, 0x95,
+	     0x08, 0x2b, 0x00, 0xc0, 0xfc, 0x31, 0x88, 0x76, 0x33, 0xaa,
+	     0x8c, 0x01, 0x00, 0x5e, 0x3b, 0x00, 0x80, 0x27, 0xa2, 0xec,
+	     0x0f, 0x00, 0xb0, 0x85, 0x79, 0xcb, 0x44, 0x24, 0x9a, 0x69,
+	     0xf7, 0xb8, 0x98, 0x5b, 0x4c, 0xb2, 0x90, 0x12, 0x8f, 0xab,
+	     0x4a, 0x19, 0x2f, 0x00, 0x00, 0x00, 0x80, 0x3b, 0x06, 0x00,
+	     0x00, 0x00, 0x00, 0x9c, 0xb3, 0xe9, 0x01, 0x00, 0x06, 0x1a,
+	     0x4b, 0x2f, 0x5e, 0xc6, 0x8c, 0x6b, 0x16, 0x79, 0x5f, 0xf0,
+	     0x38, 0xb8, 0xaa, 0x00, 0x00, 0x0b, 0xa4, 0xd9, 0x13, 0xb3,
+	     0x6a, 0x7d, 0x01, 0x00, 0x38, 0x4e, 0x00, 0x00, 0x76, 0x76,
+	     0x77, 0x20, 0x00, 0x00, 0xd7, 0x10, 0x00, 0x00, 0x00, 0xc0,
+	     0xb2, 0x01, 0x00, 0x70, 0x98, 0xc5, 0x16, 0xef, 0x1e, 0x00,
+	     0x80, 0x79, 0x82, 0xe0, 0xf8, 0x6c, 0xfe, 0x20, 0xfe, 0x91,
+	     0x00, 0x00, 0x58, 0x43, 0x40, 0x44, 0x67, 0x02, 0x00, 0x00,
+	     0x00, 0x04, 0x35, 0x1f, 0x00, 0x48, 0x94, 0xc4, 0x10, 0xb2,
+	     0xa3, 0xa1, 0x00, 0x00, 0x70, 0xd7, 0x69, 0xab, 0x94, 0x12,
+	     0x94, 0x18, 0x91, 0x25, 0x00, 0x60, 0xa3, 0x98, 0x1f, 0xeb,
+	     0x37, 0xba, 0xab, 0xc8, 0x88, 0x00, 0x00, 0x00, 0xc0, 0xec,
+	     0x30, 0xc0, 0x07, 0x00, 0x00, 0x00, 0xf0, 0x8d, 0x00, 0x00,
+	     0xbf, 0x08, 0x91, 0x51, 0x50, 0x8b, 0x71, 0x02, 0x00, 0xe8,
+	     0x79, 0x9d, 0x02, 0xc0, 0x5c, 0x91, 0x42, 0x00, 0x80, 0x1a,
+	     0xd0, 0xdf, 0xf3, 0x30, 0x04, 0x00, 0x68, 0x37, 0xf5, 0x11,
+	     0xf3, 0x42, 0x00, 0xc0, 0xff, 0x0b, 0x00, 0x10, 0xff, 0xb3,
+	     0x0e, 0x6d, 0x0c, 0xb9, 0x21, 0x87, 0x44, 0xc8, 0x45, 0x90,
+	     0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xb1, 0x00, 0x00,
+	     0x7a, 0xca, 0x35, 0xd0, 0x51, 0xca, 0x71, 0xc6, 0x51, 0x1a,
+	     0x51, 0x90, 0x32, 0x00, 0x00, 0x00, 0x00, 0x64, 0xc1, 0x5e,
+	     0x50, 0x65, 0x27, 0x38, 0x49, 0xba, 0x74, 0x62, 0x2c, 0x76,
+	     0x88, 0x31, 0xc4, 0x5f, 0xbf, 0x03, 0xba, 0xe5, 0x19, 0xc2,
+	     0x5b, 0x4d, 0x71, 0x30, 0x74, 0x22, 0x10, 0x00, 0x40, 0x37,
+	     0x93, 0xb7, 0x52, 0x8a, 0x12, 0x6a, 0x2d, 0xa5, 0xc2, 0x21,
+	     0xdb, 0x4c, 0x00, 0xc0, 0x1b, 0xce, 0x3c, 0x44, 0xe8, 0x3b,
+	     0xab, 0x5c, 0xbb, 0x92, 0x24, 0x00, 0x80, 0x70, 0x03, 0x00,
+	     0x80, 0x22, 0x26, 0xa6, 0x52, 0x74, 0x00, 0x00, 0x1c, 0x7a,
+	     0x00, 0x80, 0x9a, 0x25, 0x00, 0xa0, 0xda, 0x06, 0x00, 0x10,
+	     0xe1, 0x90, 0xda, 0xa2, 0x81, 0x53, 0x2e, 0x5a, 0x86, 0x86,
+	     0x90, 0x95, 0x55, 0x41, 0x0a, 0xd1, 0xc5, 0x09, 0x00, 0x00,
+	     0x44, 0xb6, 0xb1, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0xbe, 0x49,
+	     0x67, 0x00, 0x00, 0xee, 0x08, 0xda, 0x1f, 0x00, 0xc0, 0x39,
+	     0x0b, 0x00, 0x80, 0xe1, 0x41, 0x72, 0xf1, 0xa3, 0xac, 0x84,
+	     0x77, 0x2c, 0x20, 0x26, 0x00, 0x00, 0x42, 0x35, 0x46, 0x02,
+	     0x00, 0x4c, 0x00, 0x17, 0x98, 0xfb, 0x98, 0xd3, 0xd0, 0x41,
+	     0x08, 0x00, 0xa0, 0x29, 0x21, 0x30, 0x40, 0xaa, 0xa2, 0x3f,
+	     0xe2, 0x16, 0x5d, 0xd5, 0x20, 0x6c, 0x4c, 0xc2, 0xdf, 0x63,
+	     0xc6, 0x09, 0x1b, 0x01, 0x00, 0x6f, 0x3c, 0xf4, 0xc5, 0x8b,
+	     0x83, 0x0b, 0x70, 0x97, 0x6b, 0x49, 0x1c, 0x19, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xb0, 0x01, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x40, 0x4b, 0xb5, 0x3c, 0x00, 0x80, 0x10,
+	     0x8d, 0x05, 0xe4, 0x6d, 0x00, 0x00, 0x74, 0x8d, 0xae, 0x4d,
+	     0xa4, 0x0a, 0x00, 0xc0, 0x51, 0x71, 0x6b, 0x41, 0xb8, 0x01,
+	     0x71, 0x01, 0xf0, 0x64, 0x1b, 0x00, 0x00, 0x00, 0x40, 0xb7,
+	     0xe3, 0x5d, 0x75, 0x0d, 0x00, 0x4a, 0x40, 0xf3, 0xfa, 0x47,
+	     0x00, 0x00, 0xeb, 0xdc, 0x0d, 0x0e, 0x00, 0xf0, 0x03, 0x30,
+	     0x64, 0x00, 0x00, 0x1a, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x68, 0xdd, 0xb0, 0x04, 0x3e, 0x88,
+	     0x00, 0x00, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x60, 0x3e, 0x00,
+	     0x00, 0x04, 0xfd, 0x8a, 0x34, 0x00, 0x80, 0x2a, 0x02, 0x00,
+	     0x00, 0x00, 0x40, 0xce, 0x04, 0x00, 0x94, 0x24, 0x01, 0x00,
+	     0x00, 0x80, 0x99, 0x08, 0x00, 0x00, 0x00, 0x10, 0x85, 0x9c,
+	     0x24, 0xf2, 0x30, 0x1e, 0x60, 0x5a, 0x83, 0x99, 0x64, 0x8c,
+	     0x26, 0xa1, 0x82, 0xa4, 0xbc, 0xd7, 0x00, 0x00, 0x00, 0x00,
+	     0x8d, 0x88, 0x0f, 0xc9, 0xf1, 0x43, 0xcc, 0x58, 0x41, 0xac,
+	     0x00, 0xc2, 0x89, 0x2c, 0x32, 0x00, 0x00, 0x97, 0x00, 0x00,
+	     0xc0, 0xe9, 0x03, 0x00, 0x38, 0x9e, 0xb9, 0x79, 0x00, 0x00,
+	     0x0f, 0x80, 0x1b, 0x60, 0xe4, 0x0a, 0x00, 0x00, 0x95, 0x04,
+	     0x00, 0x64, 0xd9, 0xa6, 0x83, 0x00, 0x80, 0x11, 0x0d, 0xb8,
+	     0x07, 0x00, 0x60, 0xbe, 0xa1, 0x1d, 0x7e, 0xf5, 0x00, 0x00,
+	     0x1c, 0xc9, 0xa4, 0x8b, 0x96, 0x0d, 0x00, 0x90, 0x7f, 0xca,
+	     0x05, 0x02, 0xd6, 0x00, 0x00, 0x31, 0x99, 0xb0, 0x20, 0x00,
+	     0x40, 0x94, 0xc4, 0x92, 0x13, 0xc8, 0x75, 0x99, 0x00, 0x00,
+	     0xc3, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x62, 0xf2,
+	     0x02, 0x26, 0x2f, 0x98, 0x1a, 0x73, 0x21, 0xf3, 0xa6, 0x0f,
+	     0x11, 0x00, 0x50, 0x86, 0x42, 0x95, 0x34, 0x9a, 0x24, 0x91,
+	     0xea, 0x9d, 0xc2, 0x5b, 0x5a, 0x06, 0x00, 0x00, 0x00, 0x68,
+	     0xeb, 0xf1, 0x0b, 0x17, 0x51, 0xab, 0xb7, 0xc2, 0xd7, 0xb1,
+	     0xed, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x6a,
+	     0xfe, 0x3d, 0x47, 0x93, 0x37, 0x11, 0x00, 0xe0, 0x9d, 0x08,
+	     0x76, 0x01, 0x00, 0xe6, 0x72, 0xd4, 0x8c, 0xf2, 0x9b, 0xb8,
+	     0x4f, 0xab, 0xe9, 0x83, 0x29, 0xd8, 0x01, 0x00, 0x24, 0x67,
+	     0x11, 0x35, 0x00, 0x80, 0x8a, 0x85, 0x6a, 0x03, 0x00, 0x40,
+	     0x90, 0xa5, 0x54, 0xc2, 0x84, 0x38, 0x26, 0x00, 0x40, 0xe4,
+	     0x50, 0x57, 0xb8, 0xb2, 0x44, 0xed, 0xdc, 0x04, 0x00, 0x00,
+	     0xd2, 0xbb, 0x3f, 0x12, 0x00, 0x00, 0xfa, 0xd6, 0xf3, 0xc8,
+	     0x03, 0x8c, 0xd1, 0x0a, 0x5a, 0x9e, 0x4c, 0x02, 0x15, 0x80,
+	     0x04, 0x00, 0x00, 0x00, 0xc0, 0x82, 0x08, 0x16, 0x01, 0x00,
+	     0x0b, 0x20, 0x00, 0x40, 0xe0, 0x0b, 0x00, 0x40, 0x8e, 0x7a,
+	     0x01, 0x00, 0x00, 0x96, 0x89, 0xa3, 0x91, 0x75, 0x0b, 0xfe,
+	     0xe3, 0x10, 0x20, 0xd8, 0xca, 0x2c, 0x29, 0x25, 0xc6, 0x74,
+	     0x43, 0x43, 0x54, 0x81, 0xa1, 0x02, 0x1b, 0xa6, 0x21, 0x13,
+	     0x39, 0xf5, 0xd4, 0x00, 0x00, 0xe1, 0x0d, 0x00, 0x40, 0xa7,
+	     0x70, 0xb2, 0x02, 0x00, 0x70, 0x53, 0x00, 0x00, 0xb4, 0x39,
+	     0x5d, 0x1f, 0x00, 0x40, 0x2b, 0x40, 0x29, 0xb9, 0x22, 0xd9,
+	     0x05, 0x1a, 0xd8, 0xa0, 0x43, 0x2b, 0x96, 0xce, 0x8a, 0x30,
+	     0xa7, 0x32, 0xc1, 0x3c, 0xd2, 0xc4, 0x68, 0x3d, 0x88, 0x5f,
+	     0xf7, 0x0f, 0xf1, 0xd0, 0xe3, 0x0f, 0xa0, 0x63, 0x36, 0x03,
+	     0x00, 0x40, 0xe5, 0x68, 0x02, 0x1e, 0x16, 0x18, 0xc2, 0xa5,
+	     0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xfc, 0xee, 0x84,
+	     0x78, 0xc5, 0xa8, 0x94, 0xb9, 0x0f, 0x00, 0x60, 0xf1, 0x00,
+	     0x00, 0x00, 0x00, 0x64, 0x23, 0x00, 0x00, 0x05, 0x15, 0x00,
+	     0xa0, 0x97, 0x03, 0x00, 0x00, 0x00, 0xdc, 0x3f, 0xa0, 0x23,
+	     0xd7, 0x8f, 0x39, 0x20, 0x00, 0xa0, 0x0f, 0xc2, 0x62, 0xe4,
+	     0xbb, 0xa0, 0x06, 0x00, 0x00, 0xe3, 0x47, 0x00, 0x40, 0x90,
+	     0x8c, 0x8d, 0x53, 0xb0, 0xe2, 0xf8, 0xd0, 0x2b, 0xbf, 0x62,
+	     0x00, 0x00, 0x87, 0x66, 0x33, 0x10, 0x00, 0x30, 0x58, 0xd0,
+	     0xfa, 0x65, 0xfa, 0x00, 0x00, 0x6e, 0x03, 0xe6, 0x01, 0x8f,
+	     0xcc, 0x32, 0x88, 0xcf, 0x10, 0xbd, 0x49, 0x9e, 0xc8, 0x28,
+	     0x7e, 0x0e, 0xbe, 0x4f, 0x4c, 0x25, 0x2a, 0xd7, 0x9e, 0x1a,
+	     0x3d, 0x49, 0x1d, 0x82, 0x06, 0x35, 0xae, 0xd7, 0x55, 0xdb,
+	     0x8c, 0xa5, 0x28, 0x29, 0xf1, 0xa5, 0xdd, 0x52, 0x90, 0x34,
+	     0x00, 0x80, 0xf9, 0x07, 0x00, 0x40, 0x86, 0xf1, 0xf8, 0x31,
+	     0x39, 0x01, 0x00, 0xe0, 0x24, 0x85, 0x37, 0xb7, 0xd2, 0x1b,
+	     0xa6, 0xc9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x79,
+	     0xbe, 0x3c, 0x2e, 0x25, 0x00, 0x00, 0xe3, 0x90, 0xe8, 0xeb,
+	     0x57, 0x01, 0x00, 0x22, 0x89, 0x95, 0x9c, 0x23, 0xa0, 0x51,
+	     0x11, 0x00, 0x00, 0x00, 0x58, 0xfc, 0xfd, 0xef, 0x00, 0x00,
+	     0x34, 0xb0, 0x97, 0x89, 0x52, 0x85, 0x28, 0x73, 0x6d, 0x82,
+	     0x86, 0x00, 0x00, 0x7c, 0x86, 0xf9, 0xb3, 0xda, 0x44, 0x71,
+	     0x43, 0xbe, 0x03, 0x00, 0x08, 0xa1, 0x25, 0xcc, 0x3c, 0x73,
+	     0x14, 0xcc, 0xc5, 0x93, 0x25, 0x8c, 0x0f, 0xd0, 0xde, 0xb4,
+	     0x85, 0x6d, 0x7e, 0x50, 0x42, 0x34, 0xad, 0xe7, 0x26, 0x00,
+	     0x00, 0x00, 0x90, 0x6b, 0x9a, 0x6f, 0xc4, 0x13, 0x01, 0x52,
+	     0xd3, 0xbd, 0xdd, 0x4b, 0x18, 0x13, 0xa4, 0x17, 0xc9, 0xe0,
+	     0x5e, 0x0a, 0x34, 0x01, 0x00, 0x65, 0x15, 0x99, 0x95, 0x29,
+	     0x03, 0x0d, 0xe5, 0x73, 0xb8, 0x29, 0x0d, 0xce, 0x00, 0x00,
+	     0xcc, 0xbe, 0x5d, 0x9e, 0x0a, 0x42, 0xd5, 0xf7, 0xf9, 0x73,
+	     0x61, 0x02, 0x00, 0xd4, 0x32, 0x1e, 0x41, 0xe2, 0xca, 0x7a,
+	     0xc2, 0xc2, 0x08, 0x00, 0x00, 0x00, 0xa4, 0x5f, 0xa4, 0x54,
+	     0xb2, 0xc4, 0xe1, 0x48, 0x65, 0xa8, 0x0e, 0xc1, 0x49, 0xf3,
+	     0x5f, 0x01, 0x00, 0x00, 0x00, 0x32, 0xa2, 0xce, 0x51, 0xae,
+	     0x10, 0xe7, 0xc5, 0x79, 0x69, 0x49, 0x00, 0x00, 0x38, 0x93,
+	     0x55, 0xb9, 0x29, 0xce, 0x75, 0xc6, 0xc9, 0xe3, 0xf5, 0x81,
+	     0xa7, 0x6d, 0x29, 0x1f, 0x69, 0x5b, 0x14, 0x87, 0x4c, 0x7a,
+	     0xc7, 0xfd, 0x96, 0x91, 0x4b, 0x8a, 0x28, 0x9b, 0x94, 0x02,
+	     0x00, 0x00, 0x59, 0x43, 0xb1, 0x60, 0xda, 0xc2, 0xb7, 0x50,
+	     0x39, 0x08, 0x00, 0x01, 0x00, 0x52, 0xc3, 0xff, 0x20, 0x00,
+	     0x60, 0x88, 0x02, 0x00, 0xf8, 0x1f, 0xa8, 0xcd, 0x00, 0x00,
+	     0x44, 0x2e, 0x85, 0x21, 0x00, 0x00, 0x00, 0xe0, 0xb7, 0xf2,
+	     0x60, 0x01, 0x00, 0x82, 0x15, 0xf5, 0x33, 0xe5, 0x26, 0xf0,
+	     0x0c, 0xcf, 0xa3, 0xb0, 0xe3, 0xb9, 0xd9, 0x14, 0x60, 0x7a,
+	     0x18, 0x9e, 0x14, 0x0b, 0x00, 0x00, 0x58, 0x09, 0xb1, 0xf9,
+	     0x9c, 0xcd, 0xb3, 0x22, 0x48, 0xbe, 0xad, 0xa2, 0x42, 0x1f,
+	     0xaa, 0x37, 0x02, 0x00, 0x98, 0x67, 0x9a, 0x7e, 0x00, 0x00,
+	     0x00, 0x80, 0xba, 0x50, 0xef, 0xa7, 0x15, 0x61, 0xab, 0x9c,
+	     0x46, 0x01, 0x00, 0x88, 0x4c, 0x97, 0x19, 0x00, 0x00, 0x49,
+	     0x62, 0x7a, 0xb3, 0xf8, 0xf8, 0xdf, 0x50, 0x10, 0x6a, 0x26,
+	     0x2c, 0x36, 0xd3, 0x06, 0xc6, 0x32, 0x76, 0x11, 0xd8, 0xec,
+	     0x7c, 0x41, 0x05, 0x47, 0x58, 0xa2, 0x81, 0x6f, 0xdb, 0x29,
+	     0x27, 0xcb, 0xb6, 0xc0, 0x10, 0xa1, 0xdd, 0x19, 0xd9, 0x12,
+	     0xc7, 0x38, 0xf0, 0x53, 0xc7, 0xe6, 0xec, 0xf2, 0xf4, 0x01,
+	     0x00, 0x00, 0x00, 0x24, 0x81, 0x00, 0x3e, 0xf1, 0xc1, 0x61,
+	     0x01, 0x00, 0x00, 0x00, 0x08, 0x67, 0xd0, 0x52, 0x9e, 0x91,
+	     0x00, 0x00, 0x35, 0x63, 0xfa, 0x23, 0xee, 0xb3, 0xdb, 0x3a,
+	     0x9f, 0x10, 0xc1, 0x48, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x42, 0x00, 0x97, 0x03, 0x00, 0x00, 0x00, 0xb4, 0x1a,
+	     0x00, 0x80, 0xe2, 0xd0, 0xc4, 0x04, 0x00, 0xa0, 0x46, 0x99,
+	     0x26, 0x02, 0x00, 0x04, 0x4f, 0x1e, 0x3c, 0x0a, 0x89, 0x19,
+	     0x25, 0x60, 0x68, 0x9e, 0x04, 0x22, 0xa4, 0xfb, 0x2e, 0x51,
+	     0x00, 0x80, 0x6c, 0x24, 0xa0, 0x25, 0x61, 0x03, 0x00, 0xd0,
+	     0x4d, 0xb5, 0x91, 0x1e, 0x5d, 0xfd, 0x43, 0x00, 0x00, 0x00,
+	     0x20, 0x14, 0xb1, 0x9e, 0x60, 0xd2, 0x1c, 0x0b, 0x51, 0x97,
+	     0xee, 0x48, 0x00, 0x40, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x38,
+	     0x49, 0x39, 0x1f, 0x4c, 0x0d, 0x31, 0x2b, 0x0d, 0xa3, 0x29,
+	     0x09, 0x00, 0x60, 0x06, 0x04, 0x00, 0xd8, 0x26, 0xab, 0x84,
+	     0x00, 0x00, 0x17, 0x44, 0x89, 0x71, 0x70, 0x99, 0xad, 0x00,
+	     0x00, 0xf4, 0x7c, 0x1a, 0x4a, 0xf4, 0x34, 0x61, 0x88, 0xd2,
+	     0xe1, 0xa3, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x66, 0xae, 0x64, 0x09, 0x13, 0x0b, 0xf6, 0xa6, 0x25, 0x04,
+	     0x00, 0x00, 0x00, 0xce, 0x4b, 0x1a, 0xac, 0xb7, 0x04, 0xc6,
+	     0xa4, 0x6e, 0xb1, 0x1b, 0xcc, 0x92, 0x3d, 0x18, 0xad, 0x63,
+	     0x64, 0x04, 0x08, 0x64, 0xaf, 0x10, 0x99, 0xb9, 0x0f, 0x01,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x89, 0xd7, 0xdd, 0x0a,
+	     0x2a, 0xa3, 0xa6, 0x19, 0x03, 0xcd, 0x45, 0x2f, 0x83, 0x63,
+	     0xc6, 0x42, 0x5a, 0x5e, 0x75, 0xc6, 0xda, 0x55, 0xc7, 0x04,
+	     0x00, 0x04, 0x2a, 0x02, 0x14, 0x00, 0x80, 0xe8, 0x1e, 0x00,
+	     0xc0, 0x9b, 0x65, 0x92, 0x01, 0x00, 0xf4, 0x24, 0x6c, 0x0f,
+	     0x9f, 0x85, 0x20, 0x9f, 0x64, 0x73, 0x21, 0x01, 0x00, 0x48,
+	     0xdd, 0x5c, 0x45, 0xb2, 0x71, 0x79, 0x8f, 0x13, 0x12, 0x00,
+	     0x00, 0x26, 0x23, 0x1a, 0xac, 0x39, 0x00, 0x00, 0x84, 0x56,
+	     0x75, 0x45, 0x99, 0x1e, 0x76, 0xa7, 0xaa, 0x56, 0x3a, 0x24,
+	     0x41, 0x60, 0xba, 0x3c, 0x98, 0xa5, 0x01, 0x00, 0x00, 0x82,
+	     0x00, 0xe3, 0x63, 0x07, 0xe3, 0x31, 0x0d, 0xbe, 0x00, 0x00,
+	     0xda, 0x17, 0xa4, 0x93, 0x8f, 0x28, 0x15, 0x36, 0xe2, 0xbb,
+	     0x1e, 0x54, 0xb3, 0xa2, 0x03, 0x7f, 0xa9, 0x65, 0x00, 0x00,
+	     0x80, 0x33, 0x69, 0x71, 0xbc, 0x3a, 0x5a, 0x42, 0x06, 0x41,
+	     0xe1, 0x23, 0x84, 0x20, 0x1f, 0x6e, 0xdf, 0x78, 0x3f, 0x04,
+	     0x00, 0x00, 0x00, 0x2c, 0x97, 0xce, 0xcd, 0x1a, 0x94, 0x16,
+	     0x06, 0x00, 0xd0, 0x58, 0x00, 0x92, 0x88, 0x9f, 0xbc, 0x3c,
+	     0x88, 0x36, 0x00, 0xc0, 0x9e, 0x0c, 0x00, 0x30, 0x3a, 0x82,
+	     0x67, 0x02, 0x00, 0x6e, 0x6e, 0x1b, 0x48, 0x5e, 0x14, 0x5d,
+	     0x8b, 0x48, 0xe1, 0x05, 0xbc, 0xb9, 0x31, 0x31, 0x01, 0x00,
+	     0x5c, 0x91, 0xdf, 0x09, 0x00, 0xe0, 0x23, 0x93, 0xdf, 0xa2,
+	     0x8d, 0x00, 0x00, 0x00, 0x00, 0x62, 0x34, 0x72, 0x1e, 0x00,
+	     0xe0, 0x0b, 0x60, 0xd0, 0x03, 0x00, 0x40, 0x2b, 0xc7, 0x18,
+	     0x00, 0x00, 0x00, 0x80, 0xf9, 0x0c, 0x00, 0x10, 0x0c, 0xd1,
+	     0xa5, 0xfc, 0x8d, 0x00, 0x00, 0xc7, 0x24, 0x6a, 0x13, 0x00,
+	     0x20, 0x10, 0x01, 0x00, 0x00, 0x00, 0x88, 0xca, 0x00, 0x00,
+	     0x00, 0x00, 0xb7, 0x1b, 0x8e, 0x0b, 0x00, 0x60, 0x9e, 0xa4,
+	     0xa9, 0xd0, 0x49, 0x00, 0x00, 0xab, 0xc1, 0x24, 0x15, 0xda,
+	     0x06, 0xdd, 0xb7, 0xe2, 0x43, 0x7f, 0x2c, 0x78, 0x16, 0x5a,
+	     0xaf, 0x48, 0x00, 0x00, 0x00, 0x20, 0x8e, 0xa9, 0xc3, 0x80,
+	     0x79, 0x00, 0x00, 0x50, 0x88, 0x0f, 0x84, 0xc8, 0x22, 0x00,
+	     0x00, 0x00, 0x70, 0x5f, 0x04, 0x00, 0x0c, 0x0f, 0x6d, 0x1e,
+	     0x98, 0x16, 0x64, 0x9a, 0x93, 0x01, 0x00, 0xb0, 0xc1, 0xa1,
+	     0x5d, 0x00, 0x1b, 0x67, 0x8c, 0x25, 0x09, 0x00, 0x40, 0xfe,
+	     0xa0, 0xa9, 0x01, 0x00, 0x10, 0x79, 0x91, 0x70, 0x00, 0x00,
+	     0x00, 0x43, 0x00, 0x00, 0x2d, 0x85, 0xd7, 0x02, 0x00, 0xf0,
+	     0x57, 0xf5, 0x35, 0x1e, 0x77, 0x00, 0x80, 0xa5, 0x0d, 0xdd,
+	     0xa6, 0xa3, 0x02, 0x00, 0x20, 0x20, 0x00, 0x00, 0xd0, 0x54,
+	     0x21, 0xc5, 0xd9, 0x4b, 0xc1, 0xcd, 0x64, 0xd1, 0x89, 0x2a,
+	     0xb8, 0x2d, 0x18, 0x00, 0x00, 0x19, 0xc2, 0xe2, 0x00, 0x15,
+	     0x2a, 0xb5, 0xd0, 0x30, 0x24, 0x44, 0x02, 0x00, 0x10, 0x0a,
+	     0x00, 0x94, 0xdf, 0x08, 0x00, 0x80, 0x7d, 0x62, 0xde, 0xac,
+	     0xb7, 0x35, 0xbf, 0x00, 0x00, 0xc8, 0x06, 0x30, 0xd1, 0x71,
+	     0x63, 0xf6, 0xf6, 0xe7, 0x68, 0x22, 0xbe, 0xce, 0x82, 0x23,
+	     0x00, 0x80, 0x13, 0x50, 0x2d, 0xc9, 0xd9, 0x68, 0x8e, 0x28,
+	     0x7f, 0x8c, 0xb1, 0x00, 0x00, 0x8e, 0xcd, 0xd5, 0x0e, 0x00,
+	     0x60, 0xdf, 0xc1, 0x71, 0x31, 0xf8, 0x65, 0xed, 0xde, 0x9a,
+	     0xfe, 0x0c, 0x20, 0x05, 0xd2, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0xea, 0x91, 0xfe, 0x2d, 0xda, 0x8f, 0x3d,
+	     0x2b, 0x6c, 0x38, 0x3b, 0x9c, 0xfa, 0x90, 0x02, 0xde, 0x0c,
+	     0x00, 0x00, 0x00, 0xc0, 0x6f, 0x6d, 0x9e, 0xd6, 0x78, 0x2c,
+	     0x78, 0xed, 0x64, 0x96, 0x1a, 0x11, 0x3a, 0xbd, 0x11, 0x04,
+	     0x51, 0x58, 0x72, 0x24, 0x1a, 0x4a, 0xe9, 0xeb, 0x00, 0x00,
+	     0xea, 0x3a, 0x00, 0x80, 0x63, 0xd0, 0x1e, 0x66, 0x2f, 0x04,
+	     0x00, 0x14, 0xc2, 0xe8, 0x49, 0x35, 0xc1, 0xc3, 0x62, 0xc0,
+	     0xe9, 0x01, 0x88, 0x67, 0x58, 0x61, 0xb5, 0x09, 0x98, 0x8d,
+	     0x23, 0xba, 0x68, 0x0c, 0x00, 0x00, 0x00, 0x50, 0x88, 0x8c,
+	     0xb4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x98, 0xfe,
+	     0xaa, 0xb0, 0x01, 0x00, 0x38, 0xb5, 0xe8, 0x0e, 0x80, 0x5c,
+	     0x90, 0xcd, 0x1b, 0x8e, 0xa7, 0xea, 0x18, 0xb4, 0xec, 0x08,
+	     0x98, 0xbd, 0x35, 0x01, 0x00, 0x00, 0x00, 0x7a, 0xc2, 0xc5,
+	     0xd0, 0x7b, 0x96, 0x72, 0xf4, 0xf3, 0x85, 0x26, 0x4c, 0x4c,
+	     0xff, 0x49, 0x00, 0x80, 0x3f, 0xe5, 0x28, 0x14, 0x46, 0x31,
+	     0x0b, 0x40, 0x07, 0xea, 0x14, 0x00, 0x00, 0xea, 0xc9, 0x45,
+	     0x0b, 0x00, 0xe0, 0xa8, 0x70, 0xdf, 0x94, 0x6a, 0xa4, 0x84,
+	     0xbd, 0x0c, 0x5a, 0x59, 0x21, 0xa5, 0x59, 0xa2, 0x95, 0x02,
+	     0x00, 0x5c, 0x0f, 0xeb, 0x39, 0x4c, 0x9f, 0xef, 0x4e, 0x90,
+	     0xd2, 0x96, 0xd7, 0x74, 0xe9, 0xd8, 0x01, 0x00, 0x78, 0x12,
+	     0x7f, 0x3a, 0xe9, 0x84, 0x8f, 0x04, 0x00, 0x50, 0x03, 0x42,
+	     0xbd, 0x75, 0x5e, 0xe0, 0x35, 0x5f, 0x81, 0xa4, 0x4d, 0x29,
+	     0x04, 0x00, 0xc0, 0xa6, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x80,
+	     0x72, 0x30, 0x00, 0xc0, 0x59, 0x4f, 0xa5, 0x90, 0x64, 0x99,
+	     0x2a, 0x1e, 0xea, 0x00, 0x00, 0x08, 0x29, 0x30, 0xc0, 0x2d,
+	     0xaf, 0x28, 0x16, 0x2f, 0x52, 0xfc, 0x90, 0x2d, 0x2b, 0x24,
+	     0x22, 0x3a, 0x00, 0xc0, 0x1b, 0x13, 0x00, 0x80, 0xc3, 0x02,
+	     0x00, 0x64, 0x31, 0x49, 0x92, 0x0f, 0x0b, 0x3d, 0x5e, 0x8b,
+	     0x12, 0x00, 0xa0, 0x22, 0x8b, 0xbd, 0x5c, 0xb8, 0xb4, 0x24,
+	     0x95, 0x4c, 0x5e, 0x8a, 0xea, 0x00, 0x00, 0xa0, 0x65, 0xc0,
+	     0x84, 0x24, 0x1c, 0xff, 0x42, 0xa7, 0x3d, 0x00, 0x80, 0x5c,
+	     0xaa, 0x5f, 0xf7, 0xaa, 0x11, 0x04, 0x68, 0x47, 0x8a, 0x4d,
+	     0x79, 0x35, 0xcc, 0xdc, 0xec, 0x90, 0x0a, 0x21, 0xf4, 0xfb,
+	     0x0c, 0xd8, 0xa7, 0x00, 0x00, 0x7f, 0x1e, 0x12, 0x0e, 0x00,
+	     0xa0, 0xab, 0x44, 0x03, 0x00, 0x00, 0xc8, 0x9f, 0x00, 0x00,
+	     0xd8, 0xb3, 0x6d, 0x25, 0x00, 0xa0, 0x02, 0x48, 0x9b, 0xa9,
+	     0x02, 0xba, 0xd3, 0x76, 0x68, 0x0d, 0x9e, 0x4c, 0xe0, 0x35,
+	     0xc1, 0x4e, 0x06, 0x00, 0xe8, 0x97, 0x15, 0xa4, 0x5c, 0x5b,
+	     0x00, 0x80, 0x75, 0x5d, 0x3a, 0x05, 0x00, 0x30, 0xd3, 0xd3,
+	     0x98, 0xa0, 0x84, 0x82, 0x06, 0xa8, 0xb1, 0x5c, 0x20, 0x00,
+	     0x00, 0x00, 0x70, 0x59, 0x00, 0x00, 0xd0, 0x20, 0x53, 0x09,
+	     0x76, 0x1e, 0x37, 0x11, 0x00, 0x40, 0x65, 0x84, 0x73, 0x04,
+	     0x00, 0x74, 0x09, 0x45, 0x89, 0x3b, 0x2b, 0x00, 0x40, 0x69,
+	     0x0b, 0x00, 0x00, 0x00, 0x78, 0xa1, 0xf0, 0x3e, 0x68, 0x6f,
+	     0x3f, 0x81, 0xc4, 0x1d, 0x00, 0x00, 0x00, 0xf0, 0x42, 0xa1,
+	     0xdd, 0x94, 0x1e, 0x2a, 0x3e, 0xb9, 0x20, 0x00, 0x00, 0x00,
+	     0x20, 0x6c, 0x18, 0xbf, 0x1a, 0x66, 0xee, 0xd4, 0xd2, 0x95,
+	     0xa8, 0x3c, 0xab, 0x96, 0xfd, 0xf0, 0x44, 0xd9, 0x02, 0x5a,
+	     0x14, 0x01, 0x00, 0x76, 0x89, 0xc5, 0xc1, 0x17, 0x15, 0x00,
+	     0x00, 0x00, 0x10, 0x12, 0x0c, 0x0f, 0xd4, 0x21, 0xd5, 0x62,
+	     0x75, 0x14, 0x00, 0x80, 0x36, 0xc0, 0x58, 0x02, 0x00, 0x00,
+	     0x00, 0x2c, 0xd8, 0x7e, 0x17, 0x00, 0x00, 0xb1, 0xc5, 0x00,
+	     0x21, 0xb4, 0xb1, 0xa3, 0x03, 0x00, 0x60, 0x3a, 0x88, 0x55,
+	     0x12, 0x1e, 0xc8, 0x12, 0x00, 0x00, 0x00, 0x70, 0x93, 0x33,
+	     0x44, 0x42, 0x26, 0x00, 0x00, 0x1b, 0x4c, 0x69, 0x43, 0x4e,
+	     0xef, 0x2e, 0x97, 0x44, 0x92, 0x1c, 0x91, 0x37, 0x01, 0x00,
+	     0xb0, 0x08, 0x00, 0x40, 0x55, 0xb2, 0xab, 0xa8, 0xd6, 0x03,
+	     0x00, 0x10, 0xc0, 0x12, 0x76, 0x45, 0x22, 0xe1, 0x4a, 0x25,
+	     0x0f, 0x00, 0x60, 0x10, 0x22, 0x18, 0xde, 0x17, 0xc9, 0x11,
+	     0x00, 0x00, 0x09, 0xca, 0xc6, 0xef, 0xbc, 0x09, 0x00, 0x40,
+	     0x30, 0x12, 0x8c, 0xbe, 0x73, 0xa1, 0x82, 0xfa, 0xdb, 0xe8,
+	     0x0c, 0x00, 0x20, 0xb1, 0x01, 0x00, 0x88, 0x16, 0x00, 0x00,
+	     0x0b, 0x01, 0x28, 0xcc, 0x10, 0x20, 0x20, 0xe1, 0x4d, 0xbc,
+	     0x0f, 0x6a, 0x5b, 0xd8, 0x5c, 0x75, 0x0a, 0x00, 0x00, 0x00,
+	     0x00, 0x9c, 0x86, 0x7a, 0x51, 0x87, 0xc5, 0x82, 0xb8, 0x35,
+	     0x00, 0x00, 0x00, 0x80, 0xb8, 0x25, 0x53, 0xd8, 0xc4, 0xc8,
+	     0xac, 0xdd, 0xf5, 0x4e, 0x7d, 0xfa, 0x49, 0x00, 0x40, 0x8f,
+	     0x0c, 0xdf, 0xa0, 0x6b, 0x11, 0xea, 0x01, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x3e, 0x0d, 0x00, 0x00, 0x19, 0xb0, 0xc6, 0xa3,
+	     0x59, 0x2e, 0x10, 0x01, 0x00, 0x04, 0xc7, 0x8e, 0x17, 0x00,
+	     0xc0, 0x45, 0x09, 0x00, 0x10, 0x37, 0xc6, 0x25, 0x16, 0x5d,
+	     0x92, 0x39, 0x48, 0x53, 0x25, 0x02, 0x00, 0xe0, 0x5b, 0x04,
+	     0x00, 0xd0, 0xf6, 0xd2, 0x37, 0x00, 0x80, 0x0b, 0x44, 0x29,
+	     0x10, 0x00, 0x00, 0x00, 0x90, 0x2e, 0x92, 0xa6, 0x58, 0x58,
+	     0xb3, 0x07, 0x25, 0x41, 0x81, 0x02, 0x00, 0xc0, 0xb0, 0x03,
+	     0x00, 0x2c, 0xc6, 0x6c, 0x76, 0x00, 0x00, 0xae, 0x05, 0xbc,
+	     0xee, 0x48, 0x58, 0xe8, 0x80, 0xcb, 0x2c, 0xe6, 0x6e, 0x20,
+	     0x1c, 0xc4, 0xf8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8,
+	     0xad, 0x99, 0xf6, 0x5e, 0x8d, 0x56, 0x09, 0x00, 0x80, 0xbd,
+	     0xcf, 0x76, 0xc7, 0x0d, 0x02, 0x00, 0x00, 0x85, 0xdc, 0x7e,
+	     0x00, 0x00, 0x9d, 0xdf, 0xe5, 0xeb, 0x1e, 0x08, 0x00, 0xe0,
+	     0x6d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xe1, 0x17,
+	     0x0c, 0x68, 0x78, 0x33, 0x51, 0x63, 0x7e, 0x1f, 0xd9, 0x54,
+	     0x00, 0x00, 0x79, 0x8b, 0xd2, 0x6f, 0xbd, 0xd6, 0xbc, 0xc9,
+	     0x7b, 0xf8, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xca,
+	     0x09, 0x46, 0x05, 0x00, 0xf0, 0xca, 0x00, 0x00, 0x20, 0x43,
+	     0x00, 0x00, 0x64, 0x99, 0xca, 0x2e, 0x6a, 0x81, 0x0d, 0x28,
+	     0x25, 0x00, 0x00, 0x00, 0x00, 0x73, 0xa6, 0xa1, 0x03, 0x00,
+	     0xa0, 0xe6, 0x61, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x62,
+	     0x87, 0x8e, 0x9d, 0x9a, 0xd9, 0xaf, 0xd7, 0xb8, 0xe1, 0x8a,
+	     0x2e, 0x6d, 0xfd, 0xca, 0x63, 0xb6, 0x41, 0x00, 0x40, 0x87,
+	     0xeb, 0x68, 0x08, 0x00, 0xd8, 0x78, 0xa4, 0xf9, 0x72, 0x93,
+	     0x33, 0x38, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x99, 0x7a, 0x04,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xb4, 0x02, 0x82,
+	     0x8c, 0xfb, 0x93, 0xd1, 0xb9, 0xd6, 0x01, 0x00, 0x1a, 0x9a,
+	     0x00, 0x80, 0x43, 0x60, 0x15, 0x08, 0x00, 0x00, 0x00, 0xc8,
+	     0x08, 0xa5, 0xec, 0xac, 0x82, 0xe7, 0x29, 0xb9, 0x8b, 0x3c,
+	     0xc6, 0x26, 0xd5, 0x89, 0x73, 0xb7, 0xdd, 0xf8, 0x00, 0x00,
+	     0xd9, 0x46, 0x00, 0xc0, 0x49, 0xc9, 0xbb, 0x05, 0x00, 0xe0,
+	     0x12, 0xb6, 0x11, 0x45, 0x06, 0xac, 0x48, 0x00, 0x00, 0x00,
+	     0x60, 0x86, 0x22, 0x74, 0xb8, 0xde, 0xa0, 0xe9, 0x14, 0x0e,
+	     0x01, 0xaf, 0xb9, 0xc1, 0x2c, 0x8d, 0x68, 0xb8, 0xb0, 0x69,
+	     0x39, 0xe4, 0x84, 0x00, 0x00, 0xd5, 0xbd, 0x25, 0x11, 0x4a,
+	     0x00, 0x00, 0x20, 0x87, 0xc9, 0xbb, 0x60, 0xf6, 0x34, 0x3b,
+	     0x16, 0x2a, 0x39, 0x14, 0x00, 0xc0, 0x11, 0xe0, 0xe3, 0x03,
+	     0x00, 0xb4, 0x92, 0xa0, 0x2b, 0xf4, 0x85, 0x9e, 0x55, 0x0a,
+	     0x09, 0x00, 0x10, 0xb6, 0x81, 0x75, 0xc0, 0xb7, 0x7e, 0x09,
+	     0x2f, 0x15, 0xb4, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x8a, 0x04,
+	     0x00, 0x28, 0x21, 0xe6, 0x94, 0x90, 0x17, 0xb9, 0xde, 0xb3,
+	     0x4b, 0xb4, 0x04, 0x00, 0x60, 0x0b, 0x71, 0x8e, 0x00, 0x00,
+	     0xc3, 0xb3, 0x84, 0x07, 0x98, 0x8d, 0x8d, 0x00, 0x00, 0x00,
+	     0x00, 0x1c, 0x74, 0xb8, 0x21, 0xc4, 0x02, 0x08, 0x9c, 0x6c,
+	     0x4a, 0x7f, 0x79, 0x99, 0x58, 0xcc, 0xa4, 0x4a, 0xcc, 0x7d,
+	     0xd3, 0xbb, 0xb9, 0x90, 0x6f, 0x13, 0x00, 0xe0, 0x92, 0xb9,
+	     0x38, 0x01, 0x00, 0x28, 0x1a, 0x92, 0x19, 0x00, 0x00, 0x59,
+	     0xed, 0x52, 0x70, 0x36, 0x83, 0x78, 0xb4, 0x21, 0x00, 0x00,
+	     0xd2, 0x07, 0x00, 0x40, 0x6a, 0x84, 0x7b, 0x59, 0x01, 0x0a,
+	     0xc8, 0x01, 0x00, 0x00, 0x00, 0x5a, 0x44, 0xd9, 0xda, 0x44,
+	     0x22, 0xaf, 0xd1, 0x7c, 0x72, 0x00, 0x12, 0x1a, 0x00, 0x00,
+	     0xe0, 0x13, 0xe5, 0x15, 0x38, 0x11, 0x00, 0x00, 0x00, 0x28,
+	     0xb1, 0x30, 0x2c, 0x44, 0x2c, 0x63, 0x13, 0xfa, 0xc9, 0xfb,
+	     0x00, 0x00, 0xe0, 0xb3, 0xf1, 0x42, 0x09, 0x56, 0x4e, 0x48,
+	     0x00, 0x00, 0x8a, 0x5c, 0x50, 0xa6, 0xc2, 0x60, 0x52, 0xf2,
+	     0x5c, 0xe8, 0x09, 0xd1, 0x93, 0x99, 0x32, 0x00, 0xc0, 0x6d,
+	     0x6e, 0xf8, 0xb0, 0xc9, 0xf4, 0xa6, 0xbc, 0x1d, 0x1d, 0x06,
+	     0xb2, 0xae, 0x9e, 0x0c, 0x00, 0xa0, 0xad, 0x47, 0x1d, 0x09,
+	     0xd4, 0xc8, 0x4f, 0x5e, 0x8c, 0xea, 0xbd, 0xce, 0xe5, 0x98,
+	     0xb2, 0xed, 0xc2, 0x73, 0x63, 0x83, 0x01, 0x00, 0x44, 0x23,
+	     0x06, 0xa9, 0x2b, 0x93, 0x73, 0x0e, 0x57, 0xb0, 0xa0, 0x69,
+	     0x8d, 0x64, 0x2f, 0xaf, 0x13, 0xc2, 0x26, 0x53, 0x0b, 0x65,
+	     0x70, 0x48, 0xe7, 0xaf, 0x01, 0x00, 0xb0, 0x16, 0xcc, 0x80,
+	     0x00, 0x80, 0x80, 0x01, 0xa0, 0x0c, 0x00, 0x10, 0x23, 0x58,
+	     0x43, 0x0d, 0xe3, 0xa2, 0x89, 0x00, 0x00, 0xdc, 0x5c, 0x06,
+	     0x8e, 0xda, 0xd2, 0x45, 0x63, 0xd4, 0x38, 0x85, 0x2c, 0x69,
+	     0xcc, 0x01, 0x29, 0x93, 0x56, 0xab, 0x11, 0xd8, 0xa4, 0x9c,
+	     0x5b, 0xfc, 0x02, 0x00, 0x00, 0xfa, 0x9a, 0x50, 0xc0, 0x91,
+	     0xe4, 0xe3, 0xe5, 0x73, 0x41, 0xfc, 0xe4, 0xd8, 0xa6, 0x96,
+	     0xb3, 0x02, 0xaa, 0x01, 0x42, 0x10, 0x00, 0x00, 0x00, 0xd8,
+	     0x44, 0x9c, 0x84, 0xb6, 0x79, 0xc7, 0x43, 0xd5, 0x22, 0x00,
+	     0xc0, 0xc5, 0x06, 0x00, 0xa0, 0xac, 0x00, 0x00, 0x00, 0x00,
+	     0xce, 0x41, 0x48, 0x8f, 0x8d, 0x10, 0x00, 0xa0, 0x88, 0x51,
+	     0xb9, 0x01, 0x22, 0x9f, 0x47, 0x44, 0x39, 0x51, 0x1a, 0x27,
+	     0x01, 0x00, 0x50, 0xf0, 0x41, 0xd9, 0x8c, 0xf4, 0x82, 0x41,
+	     0x12, 0x99, 0xe8, 0x8f, 0x4e, 0x8a, 0x9d, 0x04, 0x00, 0xb0,
+	     0x4f, 0x81, 0xca, 0x00, 0x00, 0xc3, 0x84, 0x13, 0x81, 0x7e,
+	     0xea, 0x06, 0x51, 0x77, 0x03, 0x00, 0x2c, 0xa4, 0x30, 0x26,
+	     0xda, 0x08, 0x00, 0x00, 0xa3, 0x62, 0x32, 0xc2, 0x27, 0xf3,
+	     0xac, 0x71, 0x28, 0x01, 0x00, 0xaf, 0x34, 0xf3, 0x24, 0x2b,
+	     0x28, 0x8a, 0x55, 0x74, 0xd0, 0x6c, 0x02, 0x00, 0x00, 0x00,
+	     0x57, 0x48, 0x00, 0x80, 0x8f, 0x0c, 0x00, 0x30, 0xcd, 0xd3,
+	     0x6f, 0xbd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x44,
+	     0x6c, 0xb0, 0x06, 0x00, 0x40, 0x23, 0x8e, 0x23, 0xe2, 0x91,
+	     0x00, 0x00, 0x88, 0xd2, 0xc9, 0x6d, 0x99, 0x99, 0x0e, 0x03,
+	     0x00, 0xdc, 0x69, 0xd4, 0x57, 0xa3, 0xa7, 0x00, 0xa3, 0x7c,
+	     0xe6, 0xcc, 0x08, 0x00, 0x70, 0x7b, 0xdc, 0xf0, 0x1a, 0x4e,
+	     0x99, 0x9b, 0xcf, 0xe2, 0x2e, 0x51, 0xe2, 0x75, 0xec, 0x02,
+	     0x00, 0x00, 0x00, 0xe4, 0x8c, 0xc8, 0x1f, 0x19, 0x11, 0x99,
+	     0x06, 0x00, 0xf0, 0xa8, 0x04, 0x00, 0x14, 0xda, 0xde, 0x92,
+	     0x00, 0x00, 0x00, 0xc0, 0xd4, 0x03, 0x00, 0x60, 0xd2, 0x81,
+	     0x7e, 0x8d, 0x88, 0x00, 0x00, 0x00, 0x80, 0x64, 0x01, 0x00,
+	     0x20, 0xe6, 0xc3, 0x7e, 0xd0, 0x7c, 0x75, 0x29, 0x61, 0x44,
+	     0x10, 0x06, 0xb1, 0x65, 0xa0, 0x66, 0x00, 0x60, 0xe3, 0x2a,
+	     0x45, 0x01, 0x00, 0xba, 0x70, 0x58, 0x3c, 0xd3, 0x98, 0x2a,
+	     0x0a, 0x00, 0x30, 0xdf, 0xb8, 0xbf, 0x99, 0xd2, 0x92, 0x0a,
+	     0x2c, 0x12, 0xa5, 0x4e, 0x13, 0xea, 0x49, 0x29, 0xc9, 0x02,
+	     0x00, 0x38, 0x87, 0xa0, 0x83, 0x72, 0xb9, 0x48, 0x03, 0x76,
+	     0x12, 0x00, 0x50, 0x40, 0x28, 0xb1, 0xb0, 0xae, 0x86, 0x68,
+	     0xf5, 0x95, 0x1e, 0x14, 0x2e, 0x8d, 0x1a, 0x09, 0x00, 0x88,
+	     0xe5, 0x88, 0xe1, 0x00, 0x00, 0xf6, 0x39, 0xca, 0x10, 0x00,
+	     0x80, 0x3c, 0x62, 0xed, 0x0a, 0x4c, 0x01, 0x00, 0x34, 0x5a,
+	     0x00, 0x00, 0x00, 0xc0, 0x3f, 0xce, 0x0f, 0x60, 0x57, 0x92,
+	     0x62, 0xb6, 0xe0, 0x00, 0x00, 0x29, 0x24, 0xe9, 0xdf, 0x3a,
+	     0xe4, 0x32, 0x09, 0x61, 0x3b, 0x49, 0x00, 0x00, 0xd0, 0x37,
+	     0x92, 0xcc, 0x32, 0x87, 0xf0, 0x83, 0x5d, 0xa2, 0x05, 0x4b,
+	     0x0e, 0x90, 0x0d, 0xce, 0x5c, 0x47, 0x24, 0x7e, 0x1c, 0x00,
+	     0xe0, 0x30, 0x40, 0xa8, 0xe9, 0xfd, 0xe8, 0x90, 0xca, 0x78,
+	     0xd6, 0x29, 0x00, 0x00, 0x00, 0x60, 0x09, 0x25, 0x67, 0x00,
+	     0x00, 0x24, 0x21, 0xbf, 0x4a, 0x7e, 0xa7, 0x8a, 0x20, 0x00,
+	     0x60, 0xf8, 0x01, 0x00, 0xd8, 0x70, 0x36, 0x76, 0x5a, 0x9a,
+	     0x00, 0x00, 0x10, 0x13, 0x00, 0xe0, 0x09, 0xb9, 0xc9, 0x98,
+	     0x55, 0x0a, 0x2c, 0x75, 0x13, 0x00, 0x80, 0x8c, 0x03, 0xd7,
+	     0x20, 0xf3, 0x02, 0x00, 0x98, 0x45, 0x8e, 0x0e, 0xe9, 0x53,
+	     0x58, 0x26, 0x00, 0x40, 0x53, 0x8b, 0x73, 0x86, 0xfd, 0xe8,
+	     0x0d, 0xac, 0x45, 0x7c, 0x1b, 0x16, 0x9f, 0x22, 0x25, 0x00,
+	     0xe0, 0xdb, 0x57, 0x14, 0x1b, 0x29, 0xac, 0x2c, 0x74, 0x5b,
+	     0xd8, 0x4a, 0x51, 0x12, 0xf8, 0x8f, 0x41, 0x85, 0x66, 0xf9,
+	     0xf8, 0x59, 0x1d, 0x22, 0x66, 0x00, 0x80, 0x3f, 0x12, 0x00,
+	     0x80, 0x77, 0xe0, 0x3a, 0x1b, 0x59, 0xb0, 0x61, 0x70, 0x8e,
+	     0x36, 0xa0, 0x28, 0xa5, 0x14, 0x21, 0x76, 0x38, 0xf0, 0x68,
+	     0x4e, 0x52, 0xed, 0x16, 0x40, 0xa5, 0x84, 0xc8, 0x9c, 0xc9,
+	     0x84, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x18, 0x8f, 0x8c, 0x0b,
+	     0x93, 0xa3, 0xb7, 0x47, 0xfb, 0x4d, 0x71, 0x05, 0x00, 0xb0,
+	     0x04, 0x7c, 0x2a, 0x5a, 0x0c, 0xd7, 0x83, 0x8f, 0x1b, 0x00,
+	     0x80, 0x07, 0x74, 0xed, 0x20, 0x00, 0x42, 0xe2, 0x00, 0x00,
+	     0xfb, 0x11, 0x52, 0xd5, 0x87, 0x8f, 0x60, 0x22, 0x4a, 0x58,
+	     0x93, 0x25, 0x7b, 0xcc, 0x96, 0x00, 0x00, 0xb5, 0x5d, 0x23,
+	     0x61, 0x44, 0xd7, 0x7b, 0xa3, 0xb9, 0x00, 0x00, 0x40, 0x07,
+	     0x6e, 0x1b, 0x00, 0xc0, 0x5b, 0xc1, 0x62, 0xf0, 0xa9, 0x2c,
+	     0xca, 0x00, 0x00, 0x24, 0x06, 0x84, 0x82, 0x5e, 0x17, 0x00,
+	     0x80, 0xef, 0x08, 0x00, 0x50, 0xf4, 0x01, 0x00, 0x00, 0x00,
+	     0xfd, 0x82, 0xb2, 0x44, 0xcd, 0x2b, 0xaf, 0x84, 0x84, 0x8b,
+	     0x6c, 0xaa, 0xe0, 0x00, 0x00, 0x56, 0x23, 0x00, 0x00, 0xf9,
+	     0xac, 0x05, 0x40, 0x37, 0x00, 0x00, 0x7c, 0x4e, 0x00, 0x00,
+	     0x1b, 0x11, 0x13, 0xcc, 0x3f, 0xe3, 0x8b, 0xf2, 0x59, 0x9c,
+	     0x49, 0xc5, 0x27, 0x6e, 0x04, 0x00, 0x00, 0x37, 0xe2, 0x3d,
+	     0x09, 0x51, 0x21, 0xca, 0x02, 0x00, 0x4c, 0xf3, 0x8e, 0x79,
+	     0xff, 0xb4, 0x26, 0x00, 0x68, 0x08, 0x00, 0xc0, 0x0e, 0xa4,
+	     0x47, 0x18, 0x22, 0x4f, 0x0c, 0x29, 0x92, 0xdb, 0x45, 0xb8,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x35,
+	     0x00, 0x00, 0x00, 0x00, 0x39, 0x8b, 0xe8, 0x54, 0x27, 0x03,
+	     0x00, 0x00, 0x00, 0x8c, 0x82, 0xd8, 0x43, 0x1f, 0xd7, 0x0b,
+	     0x0b, 0x00, 0xf0, 0xd2, 0xf9, 0x4d, 0xb2, 0x03, 0x00, 0x00,
+	     0x00, 0x00, 0x3b, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x88,
+	     0x6c, 0x02, 0x00, 0x00, 0x00, 0xb0, 0x39, 0x53, 0x0a, 0x00,
+	     0xa0, 0xda, 0x06, 0xe2, 0x20, 0x79, 0x99, 0xe5, 0x5c, 0x85,
+	     0x00, 0x00, 0xd6, 0x89, 0x47, 0x09, 0x00, 0xc0, 0x85, 0x71,
+	     0x98, 0x51, 0x33, 0x88, 0x15, 0xbe, 0xae, 0x49, 0x53, 0x44,
+	     0x09, 0x00, 0x90, 0x9e, 0x82, 0x40, 0xb4, 0x35, 0xc7, 0x6d,
+	     0x84, 0x23, 0x00, 0x80, 0x4d, 0x87, 0xa2, 0xe5, 0x66, 0x00,
+	     0x00, 0x68, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x22,
+	     0x13, 0x00, 0x00, 0x00, 0xa0, 0x69, 0x00, 0x00, 0x00, 0x00,
+	     0x48, 0x43, 0x00, 0x80, 0x7d, 0x0b, 0x00, 0x70, 0xd4, 0xa2,
+	     0xe4, 0xe8, 0xac, 0x96, 0x25, 0x02, 0x43, 0x00, 0x00, 0x00,
+	     0x80, 0x7d, 0x09, 0x00, 0xd8, 0xb1, 0xd5, 0xbc, 0x00, 0x36,
+	     0x00, 0x00, 0xab, 0xde, 0x3d, 0xaa, 0xfa, 0x07, 0x00, 0x68,
+	     0x11, 0xfa, 0x32, 0xd6, 0x91, 0x76, 0x32, 0x00, 0x00, 0x8a,
+	     0x8e, 0xcb, 0x05, 0xa1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0xda, 0xae, 0xcd, 0x45, 0x54, 0xa6, 0x7f, 0xf4, 0x4c, 0xc2,
+	     0xfc, 0x01, 0x00, 0x60, 0x08, 0x00, 0x00, 0xa6, 0x1b, 0x00,
+	     0xe0, 0x60, 0x06, 0x00, 0x28, 0x04, 0x01, 0x00, 0x78, 0x40,
+	     0x40, 0xad, 0x07, 0x22, 0x00, 0x80, 0x15, 0xc0, 0x76, 0x04,
+	     0x00, 0x60, 0xb9, 0x00, 0x00, 0x58, 0xbc, 0x6a, 0x19, 0x00,
+	     0x00, 0x73, 0xc7, 0x9d, 0x03, 0x00, 0x00, 0x00, 0xa8, 0x86,
+	     0x66, 0xad, 0x4e, 0x5e, 0x69, 0xb0, 0x2c, 0xb0, 0x43, 0xa9,
+	     0x54, 0x84, 0x27, 0x02, 0x31, 0xf7, 0xc4, 0x45, 0x0b, 0x00,
+	     0xe0, 0xd7, 0x03, 0x00, 0x08, 0x17, 0x55, 0xf0, 0x7c, 0x31,
+	     0xf1, 0x0c, 0x00, 0xc0, 0x18, 0x0f, 0x00, 0x00, 0x49, 0x5c,
+	     0x9d, 0x29, 0x5a, 0x00, 0x00, 0xfc, 0x84, 0x7b, 0xd5, 0xa2,
+	     0x2d, 0xf1, 0x07, 0x00, 0x30, 0x8f, 0x71, 0x8f, 0xfe, 0x4c,
+	     0xee, 0xb5, 0xe0, 0x56, 0x02, 0x22, 0x3f, 0x82, 0xdc, 0xc1,
+	     0xaa, 0x00, 0x00, 0xb2, 0x8e, 0xe4, 0x97, 0xd0, 0x4b, 0xda,
+	     0x0a, 0x00, 0xb0, 0x0e, 0x73, 0x43, 0x39, 0x91, 0x60, 0x08,
+	     0x00, 0x00, 0xf6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x22, 0x4f, 0xd4, 0x89, 0xb2, 0x12, 0x00,
+	     0x40, 0x06, 0x54, 0xa3, 0x02, 0x00, 0x24, 0xf7, 0x5e, 0x25,
+	     0xf4, 0x07, 0x00, 0x00, 0x6b, 0x0b, 0x00, 0x10, 0x60, 0x03,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x0c, 0x10, 0x22, 0x5c,
+	     0x11, 0x00, 0x60, 0xbd, 0x73, 0x23, 0x01, 0x00, 0xf8, 0x09,
+	     0x7a, 0x49, 0x00, 0xc0, 0xfc, 0x0b, 0x00, 0x60, 0xd2, 0x0c,
+	     0xfd, 0xb1, 0x4e, 0xf4, 0x6c, 0x2c, 0x8a, 0xa9, 0x00, 0xfc,
+	     0xa6, 0x5d, 0x02, 0x0f, 0x01, 0x00, 0x54, 0x87, 0xf0, 0x48,
+	     0xc1, 0x36, 0x38, 0x60, 0x91, 0xc2, 0x91, 0x40, 0x61, 0xc2,
+	     0x48, 0xbd, 0xca, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xcc, 0xa0,
+	     0x84, 0x50, 0x04, 0x00, 0x88, 0xf4, 0xd4, 0xb9, 0x00, 0x00,
+	     0x50, 0x18, 0x00, 0xc0, 0x07, 0x4f, 0xfb, 0x70, 0x86, 0x04,
+	     0x00, 0xe0, 0xaf, 0xd4, 0x94, 0x63, 0xb2, 0x57, 0x06, 0xd9,
+	     0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00,
+	     0xde, 0xaa, 0xdf, 0x04, 0x00, 0x80, 0x64, 0xa4, 0x2f, 0x90,
+	     0x32, 0x01, 0x00, 0x62, 0x0e, 0x42, 0x2e, 0x11, 0x24, 0x00,
+	     0x80, 0x45, 0x92, 0x4b, 0x3a, 0x44, 0x01, 0x00, 0x00, 0x00,
+	     0xcb, 0x08, 0x00, 0x00, 0x00, 0xc0, 0xb5, 0x17, 0xab, 0x39,
+	     0xf7, 0x2d, 0x5e, 0xe0, 0x62, 0x6a, 0x38, 0x00, 0x00, 0x3c,
+	     0x13, 0x00, 0x80, 0x62, 0x42, 0x36, 0xba, 0x94, 0x00, 0x00,
+	     0x67, 0xaa, 0x7a, 0x87, 0x33, 0x8d, 0x24, 0x00, 0x00, 0x78,
+	     0x6b, 0x02, 0x00, 0xfe, 0x5e, 0x7a, 0x12, 0x00, 0x40, 0xc7,
+	     0xc7, 0xe3, 0xb5, 0xb9, 0x02, 0x00, 0x78, 0x4c, 0x9c, 0x80,
+	     0x39, 0x8d, 0x7c, 0xcd, 0xf7, 0xc5, 0x79, 0x03, 0x00, 0x00,
+	     0x00, 0x60, 0x66, 0xd6, 0x68, 0xcb, 0x07, 0xd2, 0x1b, 0x00,
+	     0x00, 0x00, 0xb0, 0x98, 0xb2, 0x15, 0xa1, 0x25, 0x98, 0x47,
+	     0x02, 0x41, 0x00, 0x00, 0x4e, 0x12, 0x00, 0x90, 0x54, 0x04,
+	     0x00, 0x44, 0x89, 0x76, 0x6f, 0xe4, 0x09, 0x48, 0xd4, 0x15,
+	     0x08, 0x00, 0xd0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x03,
+	     0x80, 0xc3, 0x4a, 0x15, 0x00, 0x00, 0x00, 0xa0, 0x12, 0x3c,
+	     0x04, 0xd4, 0x31, 0x22, 0x53, 0xb7, 0xad, 0x7e, 0x26, 0x5c,
+	     0x32, 0xce, 0x58, 0xfa, 0xdb, 0x56, 0xf6, 0xb0, 0x42, 0x87,
+	     0x00, 0x00, 0x7b, 0xa3, 0x98, 0xe3, 0xb9, 0xb4, 0x66, 0x43,
+	     0xc0, 0x04, 0x56, 0x04, 0x24, 0x00, 0x80, 0x6a, 0x5a, 0x45,
+	     0xa6, 0x2d, 0x08, 0x00, 0x98, 0x86, 0xd8, 0xd6, 0x00, 0x00,
+	     0x00, 0x00, 0x8b, 0x51, 0x8b, 0x28, 0x29, 0x15, 0xf2, 0x98,
+	     0xc6, 0xa0, 0x9d, 0x22, 0x23, 0x5c, 0x29, 0x00, 0x00, 0x00,
+	     0x20, 0x48, 0x62, 0x39, 0xa4, 0x9a, 0xf8, 0xf7, 0x64, 0x11,
+	     0x26, 0xb1, 0x36, 0x1b, 0xc0, 0x11, 0x00, 0x00, 0x00, 0x98,
+	     0x6f, 0x89, 0x6e, 0x00, 0x00, 0x00, 0x80, 0x52, 0x65, 0xff,
+	     0xe2, 0xa0, 0x01, 0xf1, 0xc8, 0x0f, 0x79, 0x9d, 0xf2, 0x13,
+	     0x7e, 0x14, 0xc6, 0x00, 0x00, 0x40, 0x7e, 0xb5, 0x8c, 0xc9,
+	     0x90, 0x11, 0x18, 0xc2, 0x97, 0x32, 0xc0, 0xd0, 0x1a, 0xeb,
+	     0x8f, 0xd5, 0xa0, 0x15, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x2b,
+	     0x00, 0x00, 0x7e, 0xe0, 0x24, 0x01, 0x00, 0x70, 0x77, 0x02,
+	     0x00, 0x48, 0x27, 0x90, 0x41, 0xd7, 0x49, 0x00, 0x40, 0xe1,
+	     0x64, 0x35, 0x54, 0x8b, 0xf2, 0xc4, 0x3d, 0x04, 0xd1, 0x3d,
+	     0x1c, 0x3e, 0x00, 0xdb, 0x02, 0x31, 0xb8, 0xb9, 0xe6, 0x60,
+	     0x96, 0x01, 0x00, 0x00, 0x00, 0x1b, 0xa0, 0xcb, 0xc1, 0x08,
+	     0xa9, 0x51, 0x64, 0xb4, 0x89, 0xa3, 0xe0, 0x95, 0xa0, 0x8d,
+	     0x4b, 0x47, 0x00, 0x40, 0x99, 0x06, 0x00, 0xc0, 0x87, 0x00,
+	     0x00, 0x20, 0x5c, 0x00, 0x00, 0x9a, 0x3a, 0x01, 0x94, 0xf5,
+	     0x8d, 0xa7, 0xe8, 0x37, 0xe0, 0xe4, 0x4c, 0xd3, 0x7a, 0x59,
+	     0x30, 0xc6, 0xd3, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
+	     0x3b, 0xc5, 0x2b, 0x81, 0x83, 0x2a, 0x38, 0x00, 0x80, 0x53,
+	     0x26, 0x7a, 0x41, 0xd9, 0x3c, 0xd9, 0x84, 0x2d, 0x13, 0x9a,
+	     0xc7, 0x22, 0xd1, 0xe6, 0xc8, 0xab, 0xbe, 0x23, 0xf4, 0x50,
+	     0x87, 0x88, 0x99, 0x00, 0x00, 0x00, 0x80, 0xe8, 0x47, 0x61,
+	     0x85, 0xbf, 0x62, 0x8f, 0xab, 0x24, 0x6d, 0xcc, 0xe6, 0x07,
+	     0x00, 0x00, 0x0e, 0x13, 0x00, 0x40, 0x85, 0x07, 0x00, 0x90,
+	     0x31, 0x00, 0x00, 0x4e, 0x8d, 0xa9, 0x07, 0xa2, 0x1f, 0x00,
+	     0x00, 0x00, 0x70, 0xd8, 0xe0, 0x90, 0x01, 0x00, 0x00, 0x00,
+	     0x0e, 0x48, 0x00, 0x40, 0xa0, 0x8a, 0x7f, 0x06, 0x00, 0x00,
+	     0x00, 0xd4, 0xec, 0x2c, 0x34, 0xd3, 0xac, 0xc8, 0xd4, 0x1c,
+	     0xd1, 0xc9, 0x87, 0x15, 0x91, 0x66, 0xa1, 0x04, 0x00, 0x00,
+	     0xca, 0x84, 0x1a, 0x0e, 0x6d, 0x24, 0xdb, 0x00, 0x4c, 0xea,
+	     0x64, 0x0c, 0xc3, 0x00, 0x00, 0x6f, 0xb1, 0xbf, 0x11, 0x1d,
+	     0x04, 0x64, 0x87, 0x4a, 0x13, 0x0a, 0x12, 0x01, 0xb6, 0x7d,
+	     0xa3, 0x08, 0x00, 0x00, 0x94, 0x80, 0xdd, 0xc3, 0x7b, 0x00,
+	     0x00, 0x64, 0xf7, 0xb4, 0x62, 0x2f, 0x1f, 0x00, 0x80, 0xcc,
+	     0x8e, 0x3e, 0x55, 0xc8, 0x31, 0x35, 0x98, 0xa1, 0x80, 0x2e,
+	     0x5f, 0x88, 0x0f, 0xcd, 0x4a, 0x52, 0x52, 0x00, 0x00, 0x00,
+	     0x00, 0x4c, 0x25, 0x01, 0x00, 0x89, 0xa5, 0x61, 0x0e, 0xf8,
+	     0x67, 0x99, 0x09, 0xda, 0x00, 0x00, 0x00, 0x00, 0x30, 0x74,
+	     0x71, 0xc3, 0x50, 0x58, 0xa5, 0xc2, 0x99, 0xf3, 0xad, 0x03,
+	     0x00, 0x08, 0x85, 0x2a, 0x8d, 0x49, 0x4c, 0x00, 0xc0, 0x01,
+	     0x40, 0x01, 0xf9, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x36, 0x4c,
+	     0x00, 0x00, 0xeb, 0x14, 0x00, 0xc0, 0x29, 0x95, 0x83, 0x01,
+	     0x00, 0x10, 0x66, 0x00, 0x00, 0xbe, 0x06, 0x24, 0x24, 0x72,
+	     0x06, 0x00, 0x40, 0x87, 0x02, 0x00, 0xb8, 0x7c, 0xe4, 0x54,
+	     0xa5, 0xa6, 0x06, 0x09, 0x00, 0xa0, 0xa9, 0xd1, 0xa8, 0x11,
+	     0x04, 0x5c, 0x2c, 0xca, 0x06, 0x4d, 0x86, 0x41, 0xd3, 0x45,
+	     0xa4, 0xa3, 0x48, 0x93, 0x40, 0x59, 0x00, 0xc2, 0xa6, 0x64,
+	     0xf4, 0x90, 0x74, 0x63, 0x1a, 0x0a, 0x70, 0x16, 0x6b, 0xd1,
+	     0x15, 0x62, 0xd5, 0xd0, 0x27, 0x71, 0x1f, 0x08, 0x54, 0xd3,
+	     0x47, 0x6c, 0x43, 0x48, 0x49, 0x32, 0x14, 0x4c, 0x00, 0x00,
+	     0x46, 0xad, 0x57, 0x20, 0x00, 0xc0, 0x64, 0x01, 0x00, 0xd8,
+	     0x02, 0xbd, 0x50, 0xfa, 0x14, 0x00, 0x80, 0xa5, 0x10, 0xf6,
+	     0x91, 0x3b, 0xc1, 0x83, 0x03, 0x00, 0x6c, 0x25, 0xc2, 0x46,
+	     0xb0, 0xbf, 0x18, 0x44, 0x33, 0x8e, 0x6b, 0x58, 0x4b, 0x03,
+	     0x00, 0x00, 0x00, 0x96, 0x98, 0x11, 0x3e, 0x00, 0x40, 0xfe,
+	     0x61, 0xdb, 0xc1, 0xe6, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x00,
+	     0x53, 0x37, 0x4f, 0x15, 0x9d, 0x00, 0x00, 0x90, 0xfc, 0x0b,
+	     0x19, 0x31, 0x8a, 0x64, 0x96, 0x00, 0x80, 0x56, 0x15, 0x00,
+	     0x00, 0x00, 0xb0, 0x84, 0x72, 0x59, 0x56, 0xbc, 0xb2, 0x43,
+	     0x27, 0xb0, 0x89, 0x20, 0x06, 0x4b, 0x7e, 0x53, 0x8d, 0x03,
+	     0x00, 0xdc, 0x7c, 0x3a, 0x1a, 0xfd, 0x42, 0xfc, 0x08, 0x00,
+	     0x80, 0x63, 0xd6, 0x22, 0x48, 0xa6, 0x01, 0x00, 0x00, 0x00,
+	     0x35, 0x21, 0x6f, 0x5a, 0x78, 0x0c, 0x05, 0x58, 0xf6, 0x19,
+	     0xe4, 0x01, 0x00, 0x18, 0x7a, 0x00, 0x00, 0x5c, 0x96, 0x09,
+	     0x03, 0x00, 0x30, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x16, 0x46,
+	     0xb8, 0x26, 0x00, 0x00, 0x00, 0x40, 0x13, 0x07, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x12, 0x3b, 0x76, 0x01, 0xf0, 0x4f, 0xea,
+	     0xe7, 0x05, 0x38, 0xeb, 0x58, 0x15, 0x1c, 0xb4, 0x70, 0x23,
+	     0x00, 0x00, 0x97, 0x5d, 0x53, 0xa2, 0x27, 0x52, 0x9a, 0xe2,
+	     0x1d, 0xd6, 0xfc, 0x00, 0x00, 0xec, 0x26, 0x00, 0x80, 0xc3,
+	     0x92, 0xb9, 0xb2, 0x88, 0x21, 0xc0, 0x01, 0x00, 0xb4, 0x5b,
+	     0x71, 0x2c, 0x6f, 0xda, 0xeb, 0x02, 0x00, 0xd0, 0x0c, 0xc3,
+	     0x0c, 0x00, 0x00, 0x14, 0x67, 0x89, 0x46, 0x00, 0x40, 0x60,
+	     0x08, 0x00, 0x90, 0xaf, 0x82, 0x30, 0x99, 0xd0, 0xfe, 0x7c,
+	     0xe6, 0x20, 0x00, 0x00, 0x8d, 0xae, 0x42, 0x78, 0x5e, 0x01,
+	     0x00, 0x00, 0x00, 0x10, 0x5b, 0x2c, 0x24, 0x25, 0xdd, 0xbd,
+	     0xe2, 0x3d, 0x05, 0x00, 0xe0, 0xfa, 0xc5, 0x0e, 0x25, 0x0d,
+	     0x33, 0xc7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x54, 0xdb,
+	     0x1f, 0xee, 0xce, 0x14, 0x7b, 0xf9, 0x2e, 0x00, 0x80, 0x9e,
+	     0x8a, 0x55, 0x01, 0x00, 0x28, 0xab, 0xf8, 0x60, 0x00, 0x00,
+	     0x2b, 0xac, 0x23, 0x58, 0x05, 0x66, 0x9d, 0x03, 0x00, 0xf0,
+	     0x41, 0x39, 0x51, 0x00, 0x00, 0x69, 0x37, 0xf6, 0x1a, 0x0d,
+	     0xb3, 0x4e, 0xc6, 0x37, 0xab, 0x60, 0x28, 0x8e, 0x00, 0x00,
+	     0xb2, 0x8c, 0x43, 0x94, 0x51, 0x0c, 0x1d, 0x27, 0x3f, 0x48,
+	     0xdc, 0xdc, 0xb9, 0x00, 0x00, 0x57, 0x4a, 0x77, 0x00, 0x5e,
+	     0xe0, 0x4e, 0x04, 0x8d, 0x74, 0x3b, 0x02, 0x00, 0x00, 0x00,
+	     0xc8, 0x1f, 0x00, 0x40, 0x8e, 0x27, 0xc9, 0x06, 0x00, 0x50,
+	     0x8d, 0xf4, 0xd5, 0x38, 0x0a, 0x88, 0xbc, 0x22, 0x53, 0x5c,
+	     0xea, 0x9c, 0xa8, 0xf0, 0x6a, 0x3d, 0xd6, 0x5a, 0xee, 0x98,
+	     0xc0, 0x39, 0x79, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+	     0x15, 0xb1, 0x25, 0x00, 0x00, 0x00, 0x00, 0x87, 0x9c, 0x7f,
+	     0x68, 0x3e, 0xa2, 0x05, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0c,
+	     0x40, 0xb6, 0xa6, 0xa0, 0xed, 0x0c, 0x00, 0xd0, 0x1b, 0x00,
+	     0x00, 0x84, 0x04, 0xf7, 0x10, 0x0f, 0x15, 0x58, 0x40, 0x85,
+	     0xb1, 0xa5, 0xa2, 0x9c, 0xd3, 0x3a, 0x34, 0xf2, 0x66, 0x97,
+	     0x02, 0x22, 0x9e, 0x98, 0x61, 0xcc, 0x91, 0x03, 0x00, 0x00,
+	     0x00, 0x54, 0x36, 0x00, 0x00, 0xdd, 0xab, 0x25, 0x10, 0x22,
+	     0x00, 0x00, 0xe0, 0x4f, 0x7c, 0x5e, 0x22, 0x73, 0x70, 0x67,
+	     0xdd, 0xa8, 0x29, 0x13, 0x00, 0x60, 0x14, 0xf1, 0x7d, 0xca,
+	     0x0c, 0x6d, 0xfc, 0xaa, 0x16, 0x64, 0xa6, 0xc1, 0x06, 0x00,
+	     0x00, 0x00, 0xa0, 0xb3, 0xea, 0x2a, 0x01, 0x00, 0x56, 0x68,
+	     0xf0, 0x8f, 0x02, 0xcb, 0xe9, 0xf2, 0x92, 0x50, 0x0f, 0xbb,
+	     0xe3, 0x34, 0x97, 0x98, 0x6d, 0x00, 0x80, 0xbb, 0x64, 0xc7,
+	     0x0b, 0x26, 0xc6, 0xb6, 0xfa, 0xf0, 0x74, 0x5d, 0xc0, 0x17,
+	     0x00, 0x00, 0x00, 0x40, 0xae, 0x4f, 0x49, 0x62, 0x5f, 0x3b,
+	     0x66, 0x61, 0x9d, 0x7c, 0x5d, 0x3a, 0x81, 0x6f, 0xd5, 0x62,
+	     0x26, 0x93, 0x08, 0x00, 0x79, 0x24, 0x0c, 0xb6, 0x00, 0x00,
+	     0x00, 0x80, 0xd3, 0x63, 0x34, 0x88, 0xc7, 0xc6, 0x8b, 0x5b,
+	     0xc5, 0x7c, 0x76, 0xfc, 0x20, 0x32, 0x47, 0xf8, 0x56, 0x21,
+	     0x68, 0xc4, 0x62, 0xb8, 0xba, 0xb5, 0x9d, 0x7a, 0xca, 0x84,
+	     0x91, 0xbb, 0x12, 0x18, 0x77, 0x60, 0x14, 0x00, 0x00, 0x48,
+	     0xca, 0x01, 0x00, 0x2c, 0x08, 0xb3, 0xa4, 0xf6, 0x53, 0xba,
+	     0x8a, 0x01, 0x04, 0x00, 0x18, 0xba, 0xa4, 0x13, 0xde, 0x75,
+	     0x7f, 0x26, 0x00, 0x40, 0x27, 0x68, 0x23, 0xd3, 0x30, 0x01,
+	     0x00, 0xdc, 0xdc, 0xf8, 0x0c, 0xab, 0xbc, 0x6d, 0x12, 0x00,
+	     0x00, 0x4b, 0x95, 0x62, 0xc9, 0x00, 0x2a, 0x29, 0x00, 0x00,
+	     0xf8, 0x23, 0x80, 0x9a, 0xef, 0x10, 0x00, 0x20, 0x84, 0xc2,
+	     0x5e, 0x00, 0x00, 0x48, 0x24, 0x00, 0x00, 0x00, 0xc0, 0xeb,
+	     0x08, 0x00, 0xf0, 0x45, 0x09, 0x8d, 0xac, 0xa0, 0x38, 0x44,
+	     0xf2, 0x36, 0x65, 0xda, 0xbb, 0xe4, 0x11, 0x05, 0x00, 0x00,
+	     0x00, 0x74, 0x15, 0x55, 0x7b, 0xa8, 0x36, 0x00, 0x00, 0x00,
+	     0x60, 0x96, 0x06, 0x00, 0xe8, 0x51, 0x49, 0x79, 0xb0, 0x4f,
+	     0x6b, 0xad, 0xa2, 0x8c, 0xa3, 0x02, 0x19, 0x10, 0x1f, 0x02,
+	     0x00, 0xb8, 0xed, 0x1c, 0x21, 0x00, 0x00, 0xa9, 0x14, 0x00,
+	     0x80, 0x15, 0xc4, 0x32, 0x03, 0x00, 0xf8, 0x98, 0x00, 0x00,
+	     0x00, 0x00, 0xc0, 0x1a, 0x00, 0x00, 0x00, 0x70, 0x30, 0xdc,
+	     0x21, 0x00, 0x00, 0xa8, 0x42, 0x21, 0x1e, 0x50, 0x15, 0x00,
+	     0x40, 0x0b, 0xb1, 0xce, 0x93, 0x4e, 0x00, 0x00, 0x4e, 0x12,
+	     0x8b, 0xbb, 0xc7, 0x18, 0x00, 0x40, 0x4a, 0xa1, 0x65, 0xda,
+	     0x94, 0x01, 0x00, 0x30, 0x18, 0x2f, 0xa6, 0x0a, 0x1c, 0x1a,
+	     0xaf, 0x45, 0xa1, 0xe8, 0xcb, 0x13, 0x00, 0x00, 0x2c, 0x74,
+	     0xf0, 0x85, 0x86, 0x8e, 0xdb, 0x10, 0x00, 0x50, 0xe2, 0x08,
+	     0xb2, 0x69, 0x19, 0x1c, 0x4f, 0x00, 0x00, 0x83, 0x1b, 0xca,
+	     0xc3, 0x07, 0x65, 0xf4, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x2c,
+	     0xbf, 0xc5, 0xea, 0x55, 0x0f, 0xc3, 0x1f, 0xd0, 0xb8, 0xf3,
+	     0x48, 0x46, 0x09, 0xe3, 0x45, 0x75, 0xa9, 0xc7, 0xa4, 0x53,
+	     0x48, 0x9e, 0x97, 0x83, 0x58, 0x20, 0x60, 0xbc, 0x9e, 0x41,
+	     0x3d, 0x09, 0x6b, 0x05, 0xbe, 0x04, 0x00, 0xe0, 0x13, 0x03,
+	     0x00, 0xac, 0x4a, 0x00, 0x00, 0x91, 0x19, 0x00, 0x00, 0x00,
+	     0x00, 0x36, 0x04, 0x83, 0x59, 0xd0, 0x00, 0x00, 0x6a, 0x82,
+	     0x48, 0x89, 0xa4, 0x90, 0x6d, 0x85, 0xa4, 0x04, 0x00, 0xf0,
+	     0x8a, 0x29, 0x20, 0x00, 0x00, 0xdb, 0x1a, 0x12, 0x64, 0x6c,
+	     0x0b, 0x28, 0x36, 0x8b, 0xa4, 0x10, 0xa8, 0x79, 0xe8, 0x31,
+	     0x00, 0x80, 0xcf, 0x87, 0x37, 0xc9, 0xb9, 0x28, 0xb7, 0x60,
+	     0x69, 0xca, 0x90, 0x64, 0x14, 0x37, 0x14, 0x69, 0x02, 0xb9,
+	     0x6f, 0xe7, 0x06, 0x00, 0x38, 0x25, 0x3e, 0xda, 0x3c, 0x61,
+	     0x88, 0xb4, 0x47, 0x24, 0x00, 0xc0, 0x13, 0xb9, 0xa0, 0x30,
+	     0x25, 0x78, 0x37, 0x70, 0x16, 0xd3, 0x11, 0xb6, 0x1f, 0x00,
+	     0x60, 0x2c, 0x02, 0x00, 0x18, 0x10, 0xc8, 0x2c, 0xf8, 0x7d,
+	     0xfe, 0x01, 0x1d, 0x41, 0x1f, 0x07, 0x00, 0x10, 0x57, 0x60,
+	     0x28, 0x00, 0x00, 0x20, 0x26, 0x06, 0xa6, 0xce, 0xcd, 0x7e,
+	     0x25, 0x66, 0x89, 0xab, 0x02, 0x2b, 0xaa, 0x38, 0x70, 0x6c,
+	     0x9a, 0x24, 0xb4, 0xd4, 0xfa, 0x0a, 0x00, 0x80, 0xf0, 0x08,
+	     0xc9, 0x9d, 0x2d, 0x67, 0x48, 0x00, 0x80, 0x2b, 0x0e, 0x00,
+	     0x00, 0x00, 0xb0, 0x21, 0x72, 0xf2, 0x31, 0x19, 0x29, 0x1f,
+	     0xaa, 0x97, 0xac, 0x0c, 0x00, 0x00, 0x27, 0x49, 0x87, 0x84,
+	     0x3f, 0x84, 0xb5, 0x60, 0x31, 0xed, 0x0d, 0x00, 0x00, 0x00,
+	     0x20, 0x7f, 0x73, 0x09, 0x40, 0x71, 0x91, 0x0c, 0xec, 0x5c,
+	     0x00, 0x80, 0xdc, 0xdb, 0xb6, 0xc6, 0xe6, 0x40, 0x7a, 0xea,
+	     0x99, 0x01, 0x00, 0x00, 0x00, 0x24, 0x94, 0xee, 0x44, 0x11,
+	     0xa8, 0x0d, 0xa5, 0x12, 0xa1, 0x28, 0x4a, 0xd9, 0xc8, 0x9a,
+	     0x1c, 0xc3, 0x6e, 0xd3, 0x35, 0x00, 0x00, 0x00, 0x00, 0xd8,
+	     0xc2, 0xa1, 0x31, 0x00, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x86,
+	     0x8e, 0x6f, 0xa0, 0x66, 0x08, 0x14, 0xd2, 0x75, 0x62, 0x75,
+	     0xb2, 0x49, 0xfb, 0x5a, 0x56, 0x41, 0xcd, 0x83, 0xc2, 0x04,
+	     0x00, 0x84, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xab,
+	     0x63, 0xa0, 0x97, 0x1a, 0xb1, 0xf3, 0xe1, 0xdf, 0x7e, 0x89,
+	     0x00, 0x00, 0x00, 0x00, 0xdb, 0x27, 0x5b, 0x81, 0x78, 0xf4,
+	     0x66, 0x5a, 0x62, 0x04, 0x40, 0x26, 0x32, 0x00, 0x00, 0x94,
+	     0xe7, 0xd6, 0x03, 0x00, 0x90, 0x7d, 0x8d, 0x10, 0x69, 0x08,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x4d, 0x20, 0xbd, 0x09,
+	     0x85, 0x59, 0xf0, 0x68, 0x91, 0x88, 0xc7, 0xe6, 0x45, 0x56,
+	     0xb3, 0x5a, 0x32, 0x6e, 0xe0, 0x57, 0x66, 0xb8, 0x00, 0x00,
+	     0xa9, 0x08, 0x1f, 0x44, 0x88, 0x0f, 0x00, 0xc0, 0xa2, 0x79,
+	     0xa2, 0x05, 0x75, 0xda, 0x13, 0x70, 0x26, 0x67, 0x02, 0x7d,
+	     0x13, 0x00, 0x90, 0xa2, 0x01, 0x00, 0x44, 0x13, 0x07, 0x89,
+	     0x00, 0x00, 0x00, 0x00, 0xd7, 0xc2, 0x62, 0x77, 0xd0, 0x04,
+	     0x00, 0x60, 0xc0, 0x9e, 0x7d, 0xdd, 0x07, 0x71, 0xdf, 0x88,
+	     0x0f, 0x00, 0xe0, 0x0f, 0x69, 0x5d, 0x2a, 0x16, 0x01, 0x00,
+	     0x00, 0x80, 0x9f, 0x48, 0x96, 0x03, 0x00, 0x53, 0x3b, 0xc1,
+	     0x9c, 0x01, 0x00, 0x00, 0x00, 0xe3, 0xcb, 0xc2, 0x24, 0x21,
+	     0x31, 0xc8, 0x92, 0x9b, 0x9a, 0x9a, 0x74, 0x86, 0x00, 0x00,
+	     0xd2, 0x07, 0xc0, 0xcc, 0xc1, 0xed, 0x7a, 0x01, 0x00, 0x18,
+	     0x5f, 0x00, 0x00, 0x4c, 0x6a, 0x50, 0x81, 0xc1, 0x95, 0x92,
+	     0x02, 0x00, 0x00, 0x00, 0xe0, 0x96, 0xad, 0x5f, 0x00, 0x00,
+	     0xc6, 0x0e, 0x00, 0x00, 0x7d, 0x2c, 0xd0, 0xd3, 0x36, 0xb9,
+	     0xa4, 0x84, 0x1c, 0x01, 0x69, 0xe6, 0xc5, 0x7b, 0x15, 0x00,
+	     0x20, 0xa6, 0x08, 0x00, 0xd8, 0xf6, 0x08, 0x37, 0x00, 0x00,
+	     0x53, 0x47, 0x55, 0x43, 0x38, 0xf0, 0x5c, 0x08, 0x00, 0x08,
+	     0x0a, 0x02, 0x00, 0x0e, 0x18, 0x8b, 0x8a, 0x15, 0x42, 0xfd,
+	     0xf2, 0xb0, 0xf2, 0xd6, 0x04, 0x00, 0x00, 0x00, 0x52, 0x98,
+	     0xa4, 0x0e, 0xe0, 0x15, 0x11, 0x8c, 0x5d, 0x06, 0x00, 0x08,
+	     0x7d, 0x4d, 0x73, 0xa0, 0x4b, 0x00, 0x00, 0xca, 0x87, 0xee,
+	     0x02, 0x00, 0xf0, 0x98, 0x33, 0x25, 0xc2, 0x97, 0x46, 0x25,
+	     0xc4, 0xaf, 0xab, 0x8b, 0xea, 0x02, 0xd3, 0xf8, 0x4e, 0x8c,
+	     0x47, 0xa8, 0xa2, 0x00, 0x00, 0xf9, 0x46, 0x00, 0xc0, 0x19,
+	     0x4b, 0x91, 0x61, 0x29, 0x09, 0x50, 0x02, 0x00, 0xf4, 0x0d,
+	     0xf4, 0x3f, 0x53, 0xd4, 0x78, 0x07, 0x00, 0x00, 0x7b, 0x0b,
+	     0x6c, 0x00, 0x00, 0xca, 0x1e, 0xc4, 0x26, 0x95, 0x9f, 0xbb,
+	     0x80, 0x20, 0xe3, 0x62, 0x09, 0xfc, 0x00, 0x00, 0xea, 0x30,
+	     0xe4, 0x04, 0x8f, 0x01, 0x00, 0x60, 0x55, 0x70, 0x2f, 0x72,
+	     0xf8, 0x30, 0x1c, 0xce, 0x72, 0x09, 0x31, 0x00, 0x40, 0xa8,
+	     0x82, 0xf3, 0xa7, 0xb4, 0x02, 0x00, 0xf0, 0x6d, 0xe6, 0x1c,
+	     0xb1, 0x25, 0x7d, 0x13, 0xae, 0x0a, 0x00, 0x60, 0xb2, 0x04,
+	     0x00, 0xe4, 0x0a, 0x90, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x28, 0x8d, 0x01, 0x00, 0xb6, 0x40,
+	     0x89, 0x1e, 0xb5, 0x14, 0x00, 0x00, 0x00, 0x90, 0x4b, 0x04,
+	     0x00, 0xc4, 0xf8, 0x8a, 0x94, 0x1e, 0xb1, 0x8f, 0x26, 0xc8,
+	     0x47, 0xa9, 0x31, 0x38, 0xc4, 0x0a, 0xb5, 0x7a, 0x00, 0x00,
+	     0x30, 0xc8, 0xef, 0x55, 0xba, 0xec, 0x2e, 0x95, 0x62, 0x04,
+	     0x00, 0x84, 0x08, 0xa2, 0x19, 0x36, 0x27, 0x00, 0x00, 0xba,
+	     0xc3, 0x78, 0x70, 0x22, 0x51, 0xd0, 0x01, 0x00, 0x00, 0x00,
+	     0x8e, 0x44, 0xa8, 0x4c, 0x2b, 0x90, 0xaa, 0x34, 0x41, 0xe4,
+	     0x02, 0x51, 0x17, 0x16, 0x4b, 0xbf, 0x0c, 0x71, 0x1d, 0x00,
+	     0xe0, 0xed, 0x08, 0x00, 0x00, 0x5c, 0xdc, 0xd7, 0x40, 0x04,
+	     0xa5, 0x00, 0x00, 0x00, 0x3f, 0x68, 0xd6, 0xb0, 0x72, 0xb3,
+	     0x1b, 0x55, 0x33, 0x22, 0x5d, 0x00, 0x00, 0x89, 0x49, 0xb0,
+	     0x81, 0x60, 0x31, 0x17, 0x59, 0xf0, 0x99, 0x29, 0xf0, 0x42,
+	     0x00, 0x80, 0x99, 0xd0, 0x6c, 0x2f, 0x0a, 0x06, 0x00, 0xe0,
+	     0x01, 0x02, 0x00, 0x60, 0x31, 0x61, 0x3b, 0x00, 0x00, 0x00,
+	     0xe0, 0xfc, 0xe2, 0x6c, 0x33, 0x44, 0x74, 0x06, 0x75, 0x20,
+	     0x76, 0x48, 0x00, 0x80, 0x27, 0x00, 0x00, 0x30, 0x4e, 0x03,
+	     0x00, 0xb0, 0x02, 0xff, 0x80, 0xf5, 0x81, 0x62, 0x14, 0x00,
+	     0x00, 0x00, 0x30, 0x12, 0x04, 0x00, 0x74, 0x6b, 0x14, 0x3f,
+	     0xd5, 0xb6, 0xee, 0xa3, 0xdb, 0x0d, 0x00, 0x00, 0x00, 0x10,
+	     0x1f, 0x02, 0x00, 0x9a, 0x09, 0x54, 0xc9, 0xd0, 0x08, 0xf1,
+	     0xa1, 0x78, 0x31, 0xf9, 0x20, 0xb2, 0x00, 0x00, 0x00, 0x00,
+	     0x8a, 0x15, 0x44, 0x5e, 0x43, 0x0a, 0xd4, 0x43, 0xf3, 0xb9,
+	     0xef, 0x31, 0xc5, 0x00, 0x00, 0x14, 0xb0, 0xf6, 0x00, 0x88,
+	     0xa7, 0x0b, 0x05, 0x00, 0x50, 0x65, 0xee, 0xe9, 0x52, 0x93,
+	     0xee, 0xbb, 0xc2, 0xa6, 0x36, 0x6f, 0x39, 0x75, 0x37, 0xb1,
+	     0xe8, 0x65, 0xdc, 0x00, 0x00, 0x00, 0x80, 0xf1, 0x11, 0xf8,
+	     0x12, 0xc4, 0x92, 0x26, 0x60, 0xcb, 0x00, 0x00, 0x00, 0x88,
+	     0xd6, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xed, 0x01,
+	     0xf4, 0xac, 0x09, 0x45, 0x08, 0x33, 0x20, 0xef, 0xd9, 0x05,
+	     0xe3, 0x43, 0xc1, 0x84, 0x00, 0x00, 0xa8, 0xbb, 0x00, 0x00,
+	     0xb9, 0x8f, 0x7a, 0x18, 0x00, 0xa0, 0x06, 0x54, 0x3e, 0x08,
+	     0x16, 0x51, 0x4e, 0x28, 0x6d, 0xd7, 0x27, 0xf0, 0x01, 0x39,
+	     0x64, 0x0b, 0xf8, 0xc6, 0x00, 0x00, 0x30, 0x25, 0x8d, 0x05,
+	     0x00, 0x80, 0x3e, 0x98, 0x50, 0x05, 0x00, 0x80, 0x2e, 0xf8,
+	     0xbd, 0xb8, 0x53, 0x00, 0x00, 0x6c, 0x46, 0x4d, 0x92, 0x2a,
+	     0x8b, 0x28, 0x02, 0x00, 0x00, 0x00, 0x78, 0x2c, 0x52, 0x3a,
+	     0x73, 0x08, 0x2e, 0x92, 0x0f, 0xa5, 0xe4, 0x07, 0x00, 0x00,
+	     0x00, 0x9c, 0x71, 0xd0, 0x19, 0xeb, 0x20, 0x5d, 0x63, 0x9b,
+	     0xa4, 0xfd, 0x50, 0xcb, 0x1b, 0xf6, 0x80, 0x8d, 0x2a, 0x6b,
+	     0x00, 0x00, 0x0b, 0xda, 0x85, 0xe6, 0x0e, 0x04, 0x23, 0x03,
+	     0x00, 0x00, 0x00, 0x3a, 0x2a, 0x48, 0x1b, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x40, 0x8c, 0x03, 0x00, 0xd4, 0x27, 0xe0, 0x4e,
+	     0xd4, 0x1b, 0x2b, 0xe0, 0xdd, 0xd2, 0x90, 0xf1, 0x91, 0x72,
+	     0x62, 0xbe, 0x80, 0x98, 0x48, 0x96, 0x9e, 0x12, 0x18, 0x49,
+	     0x20, 0x2f, 0xc9, 0x6d, 0xb4, 0x04, 0xfe, 0x31, 0xa9, 0x5e,
+	     0xf9, 0x00, 0x7a, 0x45, 0xdf, 0x61, 0x4b, 0xa1, 0x53, 0x03,
+	     0x00, 0xdc, 0x54, 0xb8, 0x7e, 0x2b, 0xbb, 0xed, 0xe2, 0x6a,
+	     0x0b, 0x00, 0xe0, 0x9f, 0x11, 0x93, 0x70, 0x8b, 0x30, 0x7b,
+	     0x00, 0x80, 0x9b, 0xe4, 0x91, 0x0e, 0x00, 0x00, 0x00, 0x68,
+	     0x43, 0x78, 0x0f, 0x5e, 0x96, 0x10, 0x1c, 0x00, 0x80, 0xa4,
+	     0x10, 0xa0, 0x22, 0x28, 0x23, 0x1f, 0x3c, 0x32, 0x8d, 0x5f,
+	     0xb7, 0x43, 0x87, 0x60, 0xdf, 0x6d, 0x5a, 0x25, 0xc2, 0x04,
+	     0x00, 0x00, 0x00, 0xee, 0x35, 0x1f, 0x4b, 0x00, 0x00, 0x46,
+	     0x80, 0x17, 0xe8, 0xc7, 0xda, 0x35, 0x2e, 0xe7, 0x00, 0x00,
+	     0x7f, 0x8f, 0xd7, 0x06, 0x00, 0xe0, 0x9d, 0x02, 0x00, 0x80,
+	     0x04, 0x30, 0x05, 0x29, 0x62, 0x00, 0x00, 0x7c, 0x26, 0x0f,
+	     0xe7, 0xf0, 0x88, 0x0c, 0x04, 0x00, 0x48, 0x1f, 0xc3, 0x71,
+	     0x00, 0x80, 0x19, 0x1f, 0x00, 0xa0, 0x51, 0x67, 0xe7, 0x03,
+	     0x00, 0x74, 0x9b, 0x58, 0x3d, 0xc7, 0xc8, 0x07, 0x21, 0x00,
+	     0x20, 0x6d, 0x21, 0xf9, 0x29, 0xc7, 0xed, 0x09, 0xd3, 0x6b,
+	     0xfc, 0x1e, 0x94, 0x41, 0x45, 0x8f, 0x23, 0x22, 0x16, 0x6a,
+	     0x2a, 0x00, 0x00, 0x90, 0x2e, 0x00, 0x00, 0xf7, 0x11, 0x2a,
+	     0x90, 0xd4, 0xc7, 0x6d, 0xab, 0x3b, 0x00, 0x00, 0x98, 0x7e,
+	     0x1c, 0x1c, 0xa0, 0x8e, 0x05, 0xc1, 0x3b, 0x87, 0x45, 0x10,
+	     0xc8, 0x65, 0xa2, 0x34, 0x78, 0xfc, 0x28, 0x00, 0x40, 0x28,
+	     0x22, 0x72, 0x02, 0x00, 0x70, 0x35, 0xb6, 0x8e, 0x00, 0x00,
+	     0x4c, 0x93, 0x0f, 0x10, 0x00, 0x60, 0x90, 0x01, 0x00, 0x00,
+	     0x00, 0xd8, 0x0e, 0x73, 0x15, 0xd8, 0x20, 0xba, 0x52, 0xbe,
+	     0x66, 0x30, 0x07, 0x00, 0x00, 0x00, 0xd8, 0x23, 0x47, 0x85,
+	     0x6a, 0x1a, 0x00, 0x40, 0x3f, 0xb1, 0x3f, 0x77, 0x41, 0x74,
+	     0xef, 0x01, 0x00, 0x76, 0x04, 0x3f, 0x3d, 0x3c, 0xa0, 0xf0,
+	     0x69, 0x9a, 0x00, 0x00, 0x40, 0x56, 0x35, 0x10, 0xa6, 0x6b,
+	     0x00, 0x80, 0x27, 0x55, 0xbc, 0x2f, 0xd4, 0xc6, 0x16, 0xa1,
+	     0x49, 0x64, 0xcd, 0x00, 0x77, 0xbc, 0xbc, 0xa7, 0x03, 0x00,
+	     0x80, 0xdd, 0xa6, 0x71, 0xc0, 0x0f, 0x02, 0x00, 0x68, 0x33,
+	     0x9c, 0x3c, 0x00, 0x00, 0x00, 0x20, 0xc5, 0x03, 0x00, 0xb0,
+	     0xfe, 0x01, 0x00, 0xd8, 0x90, 0xc1, 0x0e, 0x9d, 0x05, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0xa8, 0x18, 0x64, 0x07, 0x19, 0x34,
+	     0xbd, 0x0d, 0x00, 0x40, 0xf9, 0xe7, 0xb4, 0xd3, 0x25, 0xf2,
+	     0xeb, 0x41, 0x6c, 0x54, 0x48, 0x00, 0x80, 0xb3, 0x52, 0x2c,
+	     0xc0, 0x34, 0xc3, 0x8b, 0x42, 0xc3, 0x79, 0x00, 0x87, 0x96,
+	     0x11, 0x97, 0xcd, 0x83, 0x91, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x9f, 0xc8, 0x27, 0x00, 0x00, 0xc4, 0x8c, 0x4a,
+	     0xa2, 0xc2, 0x91, 0x07, 0x28, 0x29, 0x88, 0x72, 0x00, 0x00,
+	     0xf7, 0x1d, 0x00, 0x00, 0x5c, 0x89, 0xd2, 0xd8, 0x65, 0xf3,
+	     0x2d, 0x2d, 0x38, 0xe0, 0x46, 0xe4, 0x97, 0x5a, 0xa6, 0xb7,
+	     0x2b, 0xb0, 0xc9, 0x59, 0x04, 0x00, 0xac, 0x62, 0xc6, 0x62,
+	     0x00, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0xc8, 0xf2, 0x00, 0x00, 0x7a, 0x46, 0x00, 0xc0, 0x5a,
+	     0x82, 0x4e, 0xb8, 0x83, 0x00, 0x00, 0xa0, 0x29, 0xe1, 0x31,
+	     0xe9, 0x42, 0x1c, 0x4f, 0x21, 0xd0, 0xc0, 0x89, 0xba, 0x38,
+	     0xbf, 0x3c, 0x80, 0xbc, 0x36, 0x98, 0x00, 0x4c, 0x88, 0xda,
+	     0x27, 0x3b, 0xa9, 0xde, 0x02, 0x00, 0x7c, 0x2e, 0xde, 0x95,
+	     0x17, 0xbf, 0x71, 0x4a, 0xdc, 0x09, 0x93, 0x42, 0x0b, 0x04,
+	     0x00, 0xdc, 0x1d, 0x84, 0x02, 0xd0, 0xa3, 0xea, 0x0b, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x40, 0xa2, 0x10, 0xaf, 0x00, 0x00,
+	     0xb2, 0x04, 0xee, 0x95, 0xa7, 0x0b, 0x00, 0x80, 0x3b, 0x00,
+	     0x00, 0xd0, 0x83, 0xe2, 0x77, 0xc7, 0x34, 0x5a, 0x00, 0x00,
+	     0x40, 0x5d, 0xd5, 0x36, 0x22, 0x43, 0xf5, 0xf5, 0x86, 0x0b,
+	     0xfb, 0x15, 0xc8, 0x88, 0x60, 0x11, 0x96, 0x21, 0x55, 0xd0,
+	     0x5f, 0x34, 0x82, 0xee, 0x60, 0x8b, 0x2a, 0x1e, 0xdc, 0x37,
+	     0xc9, 0x40, 0x39, 0x85, 0xeb, 0x1e, 0x34, 0xbc, 0x3a, 0x44,
+	     0x59, 0x36, 0x73, 0xd9, 0xde, 0xa3, 0x6c, 0xa8, 0x20, 0xa1,
+	     0x32, 0x30, 0x22, 0x01, 0x00, 0xb7, 0x81, 0x76, 0xd9, 0x88,
+	     0x10, 0x00, 0x20, 0x80, 0x68, 0x95, 0x00, 0x00, 0x80, 0x30,
+	     0x19, 0x36, 0x5d, 0x19, 0x00, 0xa0, 0x17, 0x02, 0x00, 0xb0,
+	     0x6e, 0x00, 0x00, 0x02, 0x7e, 0xf9, 0x4b, 0x05, 0xdb, 0x25,
+	     0xa3, 0x42, 0x62, 0x5d, 0xcc, 0xc0, 0xc0, 0xf4, 0x00, 0x00,
+	     0x65, 0xae, 0x41, 0x1c, 0x00, 0x20, 0x6b, 0x05, 0x00, 0x00,
+	     0xa3, 0x60, 0x83, 0xc8, 0x1d, 0x00, 0x80, 0xd4, 0x92, 0xae,
+	     0x43, 0x27, 0x02, 0xf3, 0xc1, 0xc8, 0x55, 0x1c, 0xe1, 0x74,
+	     0x11, 0x89, 0xca, 0x86, 0x5b, 0x48, 0x69, 0x84, 0xf9, 0x61,
+	     0x35, 0x0d, 0x0f, 0x1f, 0x66, 0xfa, 0x22, 0x74, 0x0d, 0x00,
+	     0xc0, 0x55, 0x02, 0x00, 0x10, 0xc7, 0x38, 0x4c, 0x64, 0x15,
+	     0x12, 0x3f, 0x00, 0x00, 0x20, 0xce, 0x5d, 0x09, 0x9b, 0x41,
+	     0x33, 0x00, 0x00, 0xac, 0x14, 0x70, 0x1e, 0xc9, 0x1f, 0xc2,
+	     0x6c, 0x46, 0x84, 0xb6, 0xf9, 0x1a, 0x55, 0xe9, 0x00, 0x00,
+	     0xf6, 0x87, 0x3e, 0xcd, 0x5f, 0xc7, 0x76, 0xa5, 0x50, 0x4b,
+	     0x34, 0x9d, 0x1d, 0xa1, 0x26, 0x00, 0x80, 0xcf, 0x19, 0x63,
+	     0xb2, 0x0d, 0x07, 0x00, 0x98, 0x30, 0x01, 0x00, 0xee, 0x0f,
+	     0x00, 0x00, 0xb4, 0xd9, 0x78, 0x13, 0x47, 0xc8, 0xc5, 0x91,
+	     0x90, 0xd8, 0xaa, 0xca, 0x13, 0x00, 0x00, 0x00, 0x80, 0x0c,
+	     0x08, 0x56, 0x58, 0xd8, 0xc1, 0xda, 0x00, 0x00, 0x7c, 0x0e,
+	     0xb4, 0x82, 0x8e, 0x0e, 0x00, 0xc0, 0x20, 0x00, 0x00, 0x80,
+	     0x23, 0x70, 0x18, 0xa7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0xb7, 0x01, 0xf2, 0x52, 0x59, 0xea, 0x4d, 0x6c, 0x70,
+	     0x50, 0xac, 0x21, 0x16, 0x00, 0x60, 0x4a, 0xc1, 0xe1, 0x39,
+	     0x72, 0xb4, 0x16, 0x6e, 0x7d, 0xa0, 0x95, 0xaf, 0x83, 0xfb,
+	     0xcf, 0x6d, 0xc7, 0x40, 0x00, 0x00, 0x30, 0xdf, 0x86, 0x1f,
+	     0xfc, 0xb5, 0x17, 0xc1, 0xf4, 0x61, 0xfe, 0xf0, 0x43, 0xb9,
+	     0x20, 0x9a, 0x8c, 0x00, 0x00, 0x61, 0x8c, 0x85, 0x95, 0x0d,
+	     0x84, 0x5e, 0x00, 0x00, 0x98, 0x68, 0xad, 0x00, 0x01, 0x00,
+	     0xae, 0x05, 0x15, 0x9a, 0x33, 0x22, 0xfa, 0x07, 0x4b, 0x92,
+	     0xfa, 0xa9, 0xfd, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00, 0x3c,
+	     0xf3, 0xc9, 0x64, 0x27, 0xea, 0x22, 0x02, 0x00, 0x3a, 0x7a,
+	     0x87, 0x98, 0x44, 0x19, 0xbc, 0x0f, 0x00, 0xe0, 0x47, 0xc0,
+	     0x84, 0xad, 0x26, 0xed, 0x49, 0x28, 0x89, 0xeb, 0xc2, 0xbf,
+	     0x27, 0x7c, 0xf2, 0xe1, 0x5a, 0xf7, 0xa5, 0x88, 0x00, 0x00,
+	     0xb0, 0x9f, 0x46, 0x52, 0x95, 0x61, 0x13, 0x18, 0xcf, 0x38,
+	     0x9c, 0x65, 0xeb, 0x14, 0x66, 0xdc, 0x8b, 0xb3, 0x52, 0x74,
+	     0xc8, 0xba, 0x46, 0xe9, 0xa9, 0x4f, 0xc8, 0xcf, 0x10, 0x4d,
+	     0xa5, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x22, 0xf2, 0xe9,
+	     0x83, 0xc1, 0xfc, 0x32, 0x66, 0x00, 0x80, 0x6f, 0xc6, 0xdc,
+	     0x03, 0x5c, 0x05, 0x95, 0x3a, 0xf6, 0xa8, 0xef, 0x00, 0x00,
+	     0xd3, 0xb5, 0x7d, 0xa2, 0x4e, 0x26, 0x27, 0xc5, 0x5d, 0xeb,
+	     0x18, 0xfc, 0x5c, 0x1e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x20, 0x9b, 0xa2, 0xa8, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x38,
+	     0xc8, 0x24, 0x38, 0x09, 0x00, 0xa0, 0x35, 0x58, 0xaa, 0xc2,
+	     0x3d, 0x5a, 0x5e, 0x2c, 0x01, 0xe9, 0x22, 0xf4, 0x10, 0x00,
+	     0x80, 0x26, 0xc0, 0xd0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0xc4, 0x24, 0xdf, 0xa2, 0xb2, 0xc2, 0xe1, 0xa7, 0x72, 0x44,
+	     0x2b, 0xba, 0x7a, 0x00, 0x00, 0x00, 0x80, 0xa4, 0xd1, 0x5d,
+	     0x01, 0xcb, 0x07, 0x00, 0xf8, 0x00, 0x3c, 0x16, 0x08, 0x3d,
+	     0x01, 0x43, 0x46, 0x0b, 0x00, 0x00, 0x00, 0x60, 0xd6, 0x03,
+	     0x7d, 0x50, 0x27, 0x73, 0x83, 0x00, 0x00, 0x54, 0x9a, 0x19,
+	     0xc4, 0x4a, 0x28, 0x8f, 0xc0, 0xfc, 0x51, 0xfc, 0x00, 0x00,
+	     0x04, 0x2d, 0xf2, 0x23, 0x24, 0x0e, 0x00, 0x60, 0x60, 0x04,
+	     0x00, 0x74, 0xf4, 0x00, 0x00, 0x5e, 0x3a, 0xea, 0x21, 0x00,
+	     0x40, 0x26, 0x03, 0x00, 0xe0, 0xf7, 0x31, 0x06, 0x0e, 0x80,
+	     0x16, 0x32, 0x27, 0xcb, 0xa8, 0xc8, 0xa2, 0x85, 0x0a, 0x02,
+	     0x00, 0xb8, 0x50, 0xd8, 0x73, 0x93, 0xa1, 0x89, 0x07, 0x42,
+	     0xe3, 0xf4, 0x04, 0x00, 0xc8, 0xa0, 0x01, 0x00, 0xb4, 0x7f,
+	     0x3b, 0x13, 0x00, 0xc0, 0xe5, 0xe4, 0xc7, 0x08, 0x00, 0x40,
+	     0x24, 0x2d, 0xf6, 0x78, 0x78, 0x4f, 0x19, 0x7d, 0x91, 0xa6,
+	     0x6c, 0xeb, 0x06, 0x00, 0x18, 0xb1, 0xf0, 0x45, 0x00, 0x00,
+	     0x5b, 0x92, 0xb7, 0xc6, 0x95, 0x08, 0x4b, 0xf4, 0x2e, 0x04,
+	     0x00, 0x68, 0x3c, 0xd0, 0x2c, 0xe2, 0xaf, 0x72, 0x13, 0xb1,
+	     0xb2, 0xbe, 0x04, 0xc8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0xc4, 0x2b, 0xcd, 0x95, 0x7f, 0x66, 0xf0, 0x06, 0x00, 0x98,
+	     0x5c, 0x24, 0xc4, 0xec, 0x74, 0x28, 0xc7, 0x07, 0x8f, 0x44,
+	     0x0e, 0x00, 0x00, 0x00, 0x20, 0xe2, 0x15, 0xc5, 0x2a, 0x0b,
+	     0x6f, 0x2d, 0x63, 0x02, 0x42, 0x69, 0x2e, 0x06, 0x00, 0xc8,
+	     0x53, 0x00, 0x00, 0xca, 0x6b, 0xc1, 0xcb, 0xd2, 0x8c, 0xd8,
+	     0x62, 0x8e, 0xa1, 0x80, 0xec, 0x2d, 0x9d, 0x2e, 0x4c, 0x93,
+	     0x6c, 0x9a, 0xf2, 0x42, 0xa1, 0x6b, 0x66, 0x04, 0x00, 0x00,
+	     0x00, 0xf4, 0x38, 0x8e, 0x8c, 0x00, 0x80, 0x73, 0x54, 0x6b,
+	     0x46, 0xa5, 0x77, 0xe3, 0x31, 0x4b, 0x91, 0x25, 0x01, 0x00,
+	     0x68, 0x82, 0xdf, 0x10, 0x00, 0xc0, 0x6a, 0x68, 0x42, 0x02,
+	     0x00, 0xc8, 0x7a, 0x88, 0x2a, 0x00, 0x00, 0x00, 0xc0, 0x7b,
+	     0x08, 0x00, 0xc0, 0x1f, 0xcc, 0xd1, 0x01, 0x00, 0x54, 0x35,
+	     0x00, 0x00, 0x5b, 0x11, 0x00, 0xc0, 0xd4, 0xa1, 0x1a, 0x74,
+	     0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc1, 0x1d, 0x53,
+	     0x04, 0x00, 0x20, 0x19, 0x03, 0x00, 0x6c, 0x82, 0x64, 0x38,
+	     0x00, 0x00, 0xfe, 0x51, 0xa2, 0x87, 0x4f, 0xb6, 0x35, 0xbb,
+	     0xec, 0x00, 0x00, 0x30, 0x01, 0xf4, 0x0c, 0xbe, 0x9f, 0xdb,
+	     0x8b, 0x88, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x3e,
+	     0xec, 0x4c, 0x00, 0xc0, 0x62, 0x04, 0x6d, 0x03, 0x00, 0xa0,
+	     0x00, 0x00, 0x00, 0xec, 0x0f, 0x06, 0x0d, 0x06, 0x81, 0x73,
+	     0xc9, 0x00, 0xc2, 0xf3, 0x7a, 0x18, 0x19, 0x0d, 0x00, 0x00,
+	     0x4f, 0x94, 0x22, 0x50, 0x79, 0x84, 0x66, 0x41, 0x58, 0x54,
+	     0x48, 0xda, 0xcb, 0xe0, 0x54, 0x00, 0xb2, 0x3f, 0x1a, 0x00,
+	     0xa0, 0x79, 0x40, 0x35, 0x89, 0x97, 0x40, 0xf1, 0x46, 0x0d,
+	     0xc3, 0x32, 0xc5, 0xd4, 0xfb, 0x0d, 0x52, 0xd1, 0xb6, 0x02,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x3b, 0xa7, 0x5d, 0x72,
+	     0xc8, 0x11, 0x24, 0x9c, 0x43, 0x89, 0x14, 0xd0, 0x5e, 0x01,
+	     0x22, 0x3b, 0x9c, 0x85, 0xeb, 0xcd, 0xf5, 0x55, 0x5a, 0x03,
+	     0x00, 0x78, 0xe0, 0x00, 0x00, 0xe6, 0x8f, 0xbd, 0xd3, 0x40,
+	     0xa3, 0x2b, 0x05, 0x00, 0x00, 0x00, 0x90, 0x08, 0x20, 0x41,
+	     0x44, 0x08, 0x00, 0x80, 0x7e, 0x03, 0x00, 0xf0, 0x7b, 0xd4,
+	     0xa4, 0x01, 0x71, 0x8a, 0x99, 0xc0, 0x00, 0x73, 0xdc, 0x6b,
+	     0xc9, 0xc0, 0x16, 0xd0, 0xb8, 0xcd, 0x50, 0x9e, 0xfa, 0x7a,
+	     0xdd, 0xba, 0xca, 0x18, 0x0d, 0x02, 0x10, 0xa9, 0x1a, 0x31,
+	     0x0a, 0xe9, 0x52, 0x00, 0x00, 0x9f, 0x4b, 0xe4, 0x23, 0x00,
+	     0xc0, 0xd6, 0xb4, 0xf4, 0x00, 0x00, 0x68, 0x3d, 0x68, 0x3a,
+	     0x33, 0x27, 0x31, 0x25, 0xc2, 0x12, 0x00, 0x60, 0x19, 0x50,
+	     0x92, 0x79, 0xa3, 0x24, 0x4b, 0xc7, 0x2d, 0x98, 0x56, 0x01,
+	     0xa1, 0x10, 0x62, 0xd5, 0x04, 0x21, 0xdc, 0x25, 0x80, 0x2c,
+	     0x00, 0x00, 0x00, 0x00, 0xca, 0x50, 0xa0, 0xd0, 0x76, 0x0b,
+	     0x4a, 0xa9, 0x08, 0x95, 0x60, 0xa6, 0x1f, 0xa1, 0x54, 0x14,
+	     0x04, 0x00, 0xa0, 0x3a, 0xa2, 0x9e, 0x01, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0xb2, 0x13, 0x8a, 0x12, 0x17, 0x05, 0x00, 0x78,
+	     0x4a, 0xe4, 0x4b, 0xa4, 0x63, 0xaf, 0x09, 0xd9, 0x9c, 0xb9,
+	     0xad, 0xc6, 0x07, 0xa0, 0xd8, 0x0b, 0x4a, 0x74, 0x64, 0x19,
+	     0x00, 0x00, 0x70, 0x20, 0x00, 0x80, 0x84, 0xd1, 0xe2, 0x10,
+	     0x4c, 0x02, 0x00, 0x0c, 0x54, 0x1b, 0x9a, 0xf3, 0x5d, 0x4b,
+	     0xb0, 0x70, 0x28, 0xa3, 0xf1, 0x6c, 0xe2, 0xc8, 0x56, 0x01,
+	     0x2a, 0xc2, 0x40, 0x93, 0x4e, 0xc2, 0xae, 0xf8, 0x58, 0x00,
+	     0x00, 0xf4, 0x0c, 0xe6, 0x30, 0x54, 0xc0, 0x93, 0x23, 0x00,
+	     0x40, 0x62, 0x16, 0xc9, 0x03, 0x00, 0x00, 0x00, 0x42, 0x5e,
+	     0xa1, 0xbb, 0x0d, 0x56, 0x70, 0x72, 0x30, 0xd3, 0xf5, 0xe1,
+	     0xb9, 0x08, 0x4e, 0xa2, 0x7e, 0xee, 0xc2, 0x29, 0xdb, 0xf5,
+	     0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x21, 0xdc, 0x7a,
+	     0x00, 0x00, 0x00, 0x40, 0xb7, 0xad, 0xa1, 0x04, 0xc2, 0xd8,
+	     0x10, 0x1d, 0x2f, 0x2f, 0x79, 0xdd, 0x14, 0xb1, 0x40, 0xdd,
+	     0xeb, 0x1f, 0x09, 0x00, 0x80, 0x03, 0x9d, 0x13, 0x69, 0x51,
+	     0x00, 0x00, 0x7f, 0xc8, 0x2c, 0x8f, 0x78, 0xf2, 0x2d, 0xba,
+	     0x5f, 0x01, 0x21, 0x5c, 0x34, 0x1a, 0x2c, 0x67, 0x0c, 0x6b,
+	     0x4b, 0x84, 0xf7, 0x96, 0xe0, 0x51, 0x00, 0x00, 0xc8, 0x45,
+	     0xed, 0xc5, 0x2f, 0x0c, 0x6b, 0x8b, 0x59, 0x86, 0x6c, 0x39,
+	     0x5d, 0x64, 0x9d, 0x00, 0x00, 0x0a, 0x28, 0x9b, 0x19, 0x00,
+	     0xa0, 0xb7, 0x21, 0xc9, 0x31, 0x7e, 0x00, 0x00, 0xec, 0x4c,
+	     0xd9, 0x25, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x35, 0x1b, 0x73,
+	     0xe4, 0x38, 0xb8, 0x00, 0x25, 0x42, 0x3d, 0x1c, 0x50, 0x56,
+	     0x84, 0x40, 0x07, 0x51, 0xd1, 0x30, 0xe9, 0xb0, 0x00, 0x00,
+	     0xa3, 0x44, 0xa7, 0x41, 0xef, 0x6c, 0xc3, 0x12, 0x29, 0x60,
+	     0xca, 0x6c, 0x1e, 0x42, 0x36, 0x00, 0x00, 0x00, 0x00, 0x7b,
+	     0x12, 0x00, 0x10, 0xa0, 0x64, 0x19, 0x02, 0x00, 0x7e, 0x9a,
+	     0xe7, 0xbd, 0x1d, 0xde, 0xc6, 0x0e, 0x00, 0xc0, 0x31, 0x22,
+	     0x33, 0x00, 0x00, 0x24, 0x68, 0x81, 0x2f, 0x00, 0x00, 0x1f,
+	     0x07, 0x00, 0xb0, 0x7f, 0xc4, 0x55, 0x21, 0xe4, 0x00, 0x00,
+	     0x12, 0xb3, 0x70, 0x1e, 0x91, 0x8c, 0x6e, 0xb1, 0x23, 0x01,
+	     0x00, 0x88, 0x59, 0x18, 0x92, 0x0b, 0x37, 0x00, 0x00, 0x84,
+	     0xc7, 0xc0, 0xe9, 0xb2, 0x68, 0x9a, 0x1c, 0x26, 0x3b, 0x7a,
+	     0x36, 0x82, 0xf9, 0x4b, 0x12, 0x41, 0x9f, 0xa9, 0xb9, 0x02,
+	     0x00, 0x60, 0xfb, 0x46, 0x38, 0xd8, 0x9a, 0x11, 0xd9, 0x7e,
+	     0x27, 0x43, 0x07, 0x00, 0xd8, 0x6c, 0x46, 0x29, 0x18, 0x79,
+	     0xa4, 0xbb, 0xdf, 0x1f, 0x7e, 0xe1, 0x61, 0xe9, 0x79, 0xd0,
+	     0xdd, 0x79, 0x39, 0x98, 0x2a, 0x00, 0x00, 0x7a, 0x9f, 0x3d,
+	     0xcd, 0x0a, 0x01, 0x00, 0x00, 0x00, 0xdc, 0x14, 0x5e, 0x2b,
+	     0x00, 0x80, 0xc8, 0x99, 0xcf, 0xed, 0x92, 0x42, 0xb9, 0x02,
+	     0x00, 0x34, 0x21, 0xc7, 0x45, 0x00, 0x00, 0x00, 0x40, 0x22,
+	     0x61, 0xc2, 0x07, 0x00, 0x70, 0x5d, 0xb9, 0x31, 0x00, 0x00,
+	     0x81, 0xca, 0xdd, 0x14, 0xd0, 0x0c, 0x00, 0x30, 0x9c, 0x1b,
+	     0x31, 0x01, 0x00, 0x7c, 0x47, 0xc0, 0x08, 0x00, 0xc0, 0xa7,
+	     0x4a, 0x15, 0xf4, 0x1f, 0x01, 0x00, 0xcc, 0xa0, 0xf6, 0x46,
+	     0x43, 0x9d, 0x36, 0x06, 0x06, 0x49, 0x84, 0x05, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0xca, 0x01, 0x3f, 0x48, 0x9e, 0x44, 0xc4,
+	     0x89, 0x6a, 0x09, 0x1d, 0x02, 0x77, 0xa0, 0x44, 0xdc, 0x88,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3b, 0x90, 0xd8, 0x3c,
+	     0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0x22,
+	     0x0d, 0x00, 0x40, 0xa3, 0x84, 0x62, 0x1e, 0x1c, 0xd2, 0x99,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x6c,
+	     0xa9, 0x55, 0x5e, 0x8e, 0x15, 0x4a, 0x27, 0x10, 0x53, 0x21,
+	     0x89, 0xb4, 0x45, 0xc0, 0x02, 0x00, 0x1c, 0x09, 0x01, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xcf, 0x92, 0x84, 0x78,
+	     0x32, 0x8c, 0x25, 0x23, 0x3e, 0x00, 0x00, 0x7b, 0xa1, 0xb0,
+	     0x01, 0x00, 0x80, 0xed, 0x78, 0x9d, 0x99, 0xe0, 0xbc, 0x1b,
+	     0x12, 0x0f, 0x49, 0xa2, 0xee, 0x03, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x80, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x2e,
+	     0x29, 0x2c, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x17, 0x83, 0x34,
+	     0x8d, 0x07, 0x0f, 0x59, 0xaf, 0x6f, 0x9a, 0xf0, 0x12, 0x91,
+	     0x80, 0x14, 0x17, 0x9b, 0x1b, 0x16, 0x4e, 0x00, 0x40, 0xf0,
+	     0x06, 0x00, 0x40, 0xcb, 0x30, 0xa1, 0x9c, 0xc2, 0x00, 0x00,
+	     0x0b, 0x15, 0x00, 0x80, 0x9c, 0x48, 0xa8, 0x29, 0xcd, 0xa0,
+	     0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xd7, 0x3e,
+	     0x23, 0x67, 0x29, 0x20, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x28,
+	     0x00, 0x00, 0x79, 0xe1, 0x10, 0x2b, 0x12, 0xe5, 0x5a, 0x40,
+	     0x02, 0xb2, 0x15, 0x01, 0x00, 0x77, 0xa6, 0x9a, 0x21, 0x2b,
+	     0x87, 0x6d, 0xe7, 0x48, 0x2c, 0x4e, 0xd1, 0x4c, 0x00, 0x00,
+	     0x88, 0x21, 0x00, 0x40, 0x31, 0x8b, 0xb8, 0xa6, 0x6d, 0x2a,
+	     0x43, 0x56, 0x52, 0x5a, 0x5e, 0xa0, 0x92, 0x5e, 0x19, 0x5f,
+	     0x12, 0x00, 0x80, 0x24, 0x64, 0xf5, 0x01, 0x00, 0xe8, 0x8e,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xf2, 0x35, 0x18, 0x30,
+	     0x63, 0x32, 0xa7, 0x00, 0x00, 0x7b, 0x3b, 0x24, 0xcd, 0x8c,
+	     0x6c, 0x08, 0x03, 0xc2, 0xe4, 0x2a, 0xcc, 0x9c, 0x00, 0x00,
+	     0x1f, 0x2c, 0x04, 0xd2, 0x1c, 0xa5, 0x69, 0x05, 0x00, 0x98,
+	     0x20, 0xb0, 0x88, 0x1e, 0x5d, 0xe9, 0x0b, 0x00, 0x40, 0x22,
+	     0x26, 0x89, 0xd1, 0x8b, 0x88, 0x7e, 0xb5, 0xd9, 0xfc, 0x5a,
+	     0xf2, 0x4c, 0xca, 0x23, 0x7a, 0xa4, 0x6c, 0x79, 0xe7, 0x01,
+	     0x00, 0x90, 0x18, 0x53, 0x97, 0xbd, 0x06, 0xcd, 0x13, 0x00,
+	     0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0x5c, 0x23, 0x8e, 0x5b,
+	     0x4d, 0x44, 0x00, 0x40, 0x1a, 0x2a, 0x47, 0xb8, 0xff, 0xeb,
+	     0x05, 0x01, 0x00, 0x68, 0x44, 0x16, 0x3e, 0x6a, 0x14, 0x00,
+	     0xc0, 0x57, 0x22, 0x1f, 0x14, 0x95, 0x74, 0x8d, 0x04, 0x28,
+	     0x3a, 0x9d, 0xab, 0x40, 0x52, 0xe2, 0x58, 0xb7, 0xd9, 0x28,
+	     0x75, 0xe4, 0xb1, 0xcc, 0x94, 0xe5, 0x1c, 0x50, 0x13, 0x59,
+	     0x2c, 0x23, 0x26, 0x98, 0xab, 0x46, 0xbe, 0x31, 0x3b, 0x34,
+	     0x70, 0x0e, 0xc2, 0x16, 0x00, 0x20, 0x81, 0x09, 0x00, 0x18,
+	     0x82, 0x01, 0x00, 0x14, 0x73, 0x7a, 0xb2, 0x53, 0xc3, 0xb8,
+	     0x12, 0xc7, 0x42, 0x12, 0x52, 0x0e, 0xf2, 0xbb, 0xa2, 0x8b,
+	     0xfd, 0x0c, 0x1e, 0xcb, 0x07, 0xcc, 0x20, 0xf7, 0xd0, 0x01,
+	     0x00, 0x90, 0x66, 0x00, 0x00, 0x7c, 0x30, 0x30, 0x19, 0x77,
+	     0x43, 0xb3, 0xc1, 0x48, 0x6c, 0x12, 0xdd, 0x14, 0x00, 0x00,
+	     0x9f, 0x3f, 0xd7, 0xda, 0xb7, 0xe0, 0x8c, 0x53, 0xeb, 0xcb,
+	     0x22, 0x10, 0x19, 0x0b, 0x49, 0x00, 0x00, 0xe4, 0xd9, 0x07,
+	     0x02, 0x00, 0x10, 0x81, 0x39, 0x89, 0x01, 0x69, 0x64, 0x00,
+	     0x9b, 0x1d, 0x55, 0xce, 0x7e, 0x06, 0x00, 0x80, 0x71, 0x48,
+	     0x54, 0x02, 0x2e, 0x5d, 0x1a, 0x44, 0xaf, 0xb0, 0x8a, 0xab,
+	     0x00, 0xe0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x29, 0x11, 0x0a, 0x9f, 0x78, 0xe5, 0x66, 0xb6, 0x68, 0x18,
+	     0xcc, 0x3c, 0x73, 0x40, 0x6b, 0x09, 0x83, 0xee, 0x15, 0x2e,
+	     0x08, 0x00, 0x60, 0x30, 0xb8, 0xd3, 0xf5, 0x33, 0x5e, 0x79,
+	     0x5d, 0x10, 0x19, 0x22, 0x2a, 0xe3, 0xb8, 0x96, 0x93, 0x00,
+	     0x00, 0x00, 0x00, 0xb4, 0x10, 0xc2, 0x32, 0x6a, 0xe5, 0x95,
+	     0x27, 0x37, 0x58, 0x35, 0xe8, 0xc0, 0xa0, 0x27, 0xdb, 0x65,
+	     0x4e, 0x1d, 0x00, 0x40, 0xc2, 0xae, 0xb8, 0xc4, 0x28, 0xc0,
+	     0x03, 0x02, 0x00, 0x90, 0x95, 0x69, 0xbb, 0x84, 0xd2, 0xee,
+	     0x02, 0xe2, 0x17, 0x76, 0xa9, 0x9b, 0xe4, 0x31, 0x51, 0x77,
+	     0x00, 0x00, 0x88, 0x49, 0xa5, 0x24, 0xdb, 0x27, 0x58, 0x00,
+	     0x00, 0x00, 0x00, 0x02, 0x46, 0x66, 0x16, 0x74, 0x85, 0x35,
+	     0xf1, 0x41, 0xf2, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0d,
+	     0x64, 0x3d, 0x44, 0xa0, 0xaf, 0x8a, 0x3f, 0x09, 0x00, 0xf8,
+	     0x6d, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xac, 0x87, 0x07, 0xe3,
+	     0x0f, 0x29, 0xb3, 0x88, 0x1c, 0x92, 0x75, 0xb1, 0x00, 0x00,
+	     0x18, 0x39, 0xdf, 0x09, 0x00, 0x00, 0x00, 0x00, 0x11, 0xf3,
+	     0x58, 0xc6, 0x03, 0x73, 0x6d, 0x4a, 0x1d, 0x00, 0xc0, 0xa7,
+	     0x2e, 0xfe, 0xa1, 0x3a, 0x3b, 0x6f, 0x4d, 0x15, 0x01, 0x00,
+	     0x00, 0x00, 0x00, 0x40, 0xe3, 0x8b, 0x23, 0xf7, 0x27, 0x5a,
+	     0x97, 0x30, 0xfe, 0xde, 0x40, 0x76, 0x32, 0x9e, 0x61, 0x3e,
+	     0x0f, 0x00, 0x00, 0x87, 0x01, 0x00, 0x1c, 0xb2, 0x58, 0x86,
+	     0x3f, 0x0f, 0x00, 0x00, 0x00, 0x60, 0x78, 0x78, 0xc0, 0xc2,
+	     0xbc, 0x01, 0x00, 0x28, 0x3e, 0x20, 0x0f, 0x82, 0x81, 0xc0,
+	     0x05, 0x07, 0x95, 0x3e, 0xf1, 0x4a, 0xfd, 0xf5, 0xa2, 0x9a,
+	     0x90, 0x20, 0x96, 0x92, 0x41, 0x6a, 0xc2, 0x23, 0x36, 0x00,
+	     0x74, 0x6c, 0x14, 0x27, 0x8f, 0x00, 0x00, 0x2e, 0x56, 0x4d,
+	     0xc8, 0x6e, 0x13, 0xde, 0x03, 0x00, 0xc0, 0xb6, 0x6e, 0x36,
+	     0x85, 0x35, 0x89, 0x87, 0xae, 0x72, 0x10, 0x02, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x66, 0x8f, 0xfc, 0x9a, 0x34, 0x07, 0x43,
+	     0x85, 0xf0, 0x98, 0x37, 0x8c, 0x53, 0xe8, 0x24, 0x03, 0x09,
+	     0x00, 0x80, 0x78, 0xca, 0x49, 0x33, 0x2a, 0x01, 0x00, 0x98,
+	     0x33, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x86, 0x86,
+	     0x42, 0x5d, 0x91, 0x28, 0x88, 0x62, 0x00, 0x00, 0x78, 0x8c,
+	     0x00, 0x00, 0x00, 0x80, 0x20, 0x2e, 0x06, 0xb8, 0x66, 0xf9,
+	     0xbc, 0x10, 0x78, 0x6e, 0x2b, 0x03, 0x0d, 0x02, 0x0c, 0xad,
+	     0x2f, 0x29, 0xb0, 0xfd, 0x92, 0x60, 0x7e, 0x24, 0x22, 0x28,
+	     0x00, 0x80, 0xd2, 0x08, 0x00, 0x00, 0x00, 0x10, 0x8e, 0xaa,
+	     0x5e, 0xaa, 0xb7, 0x18, 0x2b, 0xd5, 0x98, 0x70, 0xe6, 0x30,
+	     0x45, 0x02, 0xe9, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0xcf, 0x06, 0xa8, 0x0a, 0xe9, 0x07, 0x00, 0x70, 0x11, 0xa1,
+	     0xd5, 0xc0, 0x7b, 0x00, 0x00, 0x14, 0x9b, 0x7f, 0xdb, 0x2b,
+	     0x67, 0x11, 0x01, 0x00, 0x08, 0x09, 0x7a, 0xdb, 0xd4, 0x84,
+	     0xd6, 0x80, 0xdf, 0x0a, 0x67, 0x6c, 0x40, 0x14, 0xb1, 0x7a,
+	     0x23, 0x18, 0x74, 0x7e, 0x18, 0x00, 0x80, 0x3a, 0x1e, 0x2e,
+	     0x93, 0x04, 0xd7, 0xbe, 0x43, 0xb3, 0xd8, 0x26, 0x8c, 0x9a,
+	     0xb2, 0xaa, 0x5e, 0x0e, 0x00, 0xa0, 0xf7, 0x28, 0xcc, 0x2b,
+	     0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2f, 0x0f, 0xb1,
+	     0x8d, 0x24, 0x68, 0x26, 0x7c, 0x30, 0xce, 0xc7, 0x22, 0x46,
+	     0x6a, 0xcd, 0xd9, 0x1f, 0x1c, 0x4e, 0x25, 0x51, 0x39, 0xca,
+	     0x1b, 0x05, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x24, 0x23, 0x00,
+	     0x00, 0x04, 0x67, 0x27, 0xfa, 0x0d, 0x61, 0xdb, 0xe4, 0x22,
+	     0x86, 0x46, 0x00, 0xc0, 0x3a, 0x92, 0x81, 0x08, 0x00, 0x90,
+	     0xfd, 0x89, 0x36, 0x9a, 0x15, 0x6e, 0x39, 0x00, 0xc0, 0xdb,
+	     0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x86, 0x00, 0x00,
+	     0x6e, 0x06, 0xd3, 0xd0, 0xc4, 0xa9, 0x13, 0xd3, 0x8e, 0x4b,
+	     0xce, 0xc9, 0x74, 0x7e, 0x32, 0xc2, 0xa4, 0xf7, 0x84, 0x0f,
+	     0x29, 0x80, 0x64, 0xe7, 0xb3, 0x4f, 0x06, 0xfb, 0xa0, 0x8a,
+	     0x00, 0x00, 0x00, 0x40, 0xd8, 0xeb, 0xd7, 0x01, 0x00, 0x40,
+	     0x57, 0xd0, 0xf0, 0x7e, 0x6b, 0x95, 0x97, 0xfa, 0xd4, 0x8e,
+	     0x41, 0x25, 0xd1, 0x5d, 0xa3, 0x21, 0x4e, 0x83, 0xf4, 0x68,
+	     0x00, 0x00, 0x00, 0x80, 0x13, 0xb2, 0x0a, 0x16, 0xdc, 0x93,
+	     0x44, 0xc6, 0x28, 0xf5, 0x54, 0x1e, 0x0a, 0x00, 0x40, 0x36,
+	     0x2a, 0x48, 0xc7, 0x54, 0xe0, 0xcc, 0x9d, 0x31, 0xe0, 0x81,
+	     0xff, 0xbf, 0xf0, 0x24, 0x00, 0x00, 0x00, 0xe0, 0x42, 0x04,
+	     0x00, 0xe0, 0x10, 0x01, 0x00, 0x8c, 0x48, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x50, 0x90, 0x90, 0x06, 0x02, 0x00, 0x42, 0x7b,
+	     0x99, 0xc3, 0x6d, 0x54, 0xed, 0x12, 0x00, 0x00, 0x00, 0x30,
+	     0x66, 0x26, 0x12, 0xa4, 0x01, 0x3b, 0x22, 0xf5, 0x87, 0xe4,
+	     0x12, 0x00, 0x30, 0x8a, 0x01, 0x83, 0x44, 0x64, 0x66, 0x9a,
+	     0x00, 0x00, 0x6f, 0x5f, 0x47, 0xed, 0x66, 0xf9, 0x65, 0x03,
+	     0x00, 0x68, 0x02, 0x31, 0x2f, 0x00, 0x80, 0x9b, 0x4f, 0x4d,
+	     0x0d, 0xf4, 0xb4, 0xae, 0xe9, 0xef, 0x9c, 0x11, 0x90, 0x4e,
+	     0xe1, 0x3a, 0x46, 0x54, 0xa3, 0xac, 0x71, 0xc3, 0x51, 0x3a,
+	     0x56, 0x00, 0x00, 0x28, 0x79, 0x21, 0x1f, 0x61, 0x13, 0x00,
+	     0x40, 0xd0, 0xc6, 0x0e, 0x03, 0x63, 0x02, 0x00, 0x4a, 0x77,
+	     0x1f, 0x82, 0xf8, 0x95, 0x22, 0x11, 0xcd, 0x07, 0x00, 0x30,
+	     0x54, 0x02, 0x00, 0xd8, 0x73, 0x00, 0x00, 0xe7, 0xe6, 0x0f,
+	     0xb2, 0x87, 0x00, 0x00, 0x88, 0x80, 0x41, 0x01, 0xa5, 0x0d,
+	     0x7f, 0xcb, 0x1c, 0x21, 0x5a, 0x0a, 0x00, 0xa0, 0x75, 0x44,
+	     0x09, 0xaa, 0xb5, 0xba, 0x6f, 0x67, 0xc7, 0x4c, 0x1f, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x30, 0x3c, 0x5d, 0x38, 0x01, 0x00,
+	     0x1f, 0x4e, 0xd4, 0x61, 0x35, 0xc2, 0xde, 0xc5, 0xc3, 0x84,
+	     0x15, 0x55, 0x8c, 0x6c, 0x22, 0x00, 0x80, 0xe7, 0x06, 0x00,
+	     0xe0, 0x5e, 0x02, 0x00, 0x80, 0x64, 0x35, 0x40, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x8b, 0x08,
+	     0x73, 0x01, 0x00, 0x00, 0x00, 0x65, 0x82, 0xae, 0xc6, 0xfd,
+	     0x87, 0x3c, 0x92, 0xa1, 0x2a, 0xc6, 0x69, 0x0b, 0xb1, 0x0a,
+	     0x00, 0x80, 0x98, 0x11, 0x00, 0x00, 0x00, 0x20, 0x14, 0x0a,
+	     0x69, 0x4c, 0xd2, 0xf8, 0x24, 0xf6, 0xc8, 0x9e, 0x9b, 0x69,
+	     0x40, 0x67, 0x03, 0x00, 0x38, 0xc8, 0x04, 0x19, 0x5e, 0x6e,
+	     0x00, 0x80, 0x9c, 0x92, 0x7b, 0x62, 0xcf, 0x91, 0x7f, 0x78,
+	     0x64, 0x02, 0x00, 0xa6, 0x10, 0x8a, 0x25, 0xd2, 0x5c, 0xe3,
+	     0x0a, 0xbd, 0x56, 0x87, 0x98, 0xea, 0x09, 0x07, 0x01, 0x00,
+	     0x05, 0xc9, 0xa4, 0xd1, 0x27, 0x42, 0x97, 0xc3, 0x2c, 0x61,
+	     0x56, 0x01, 0x00, 0x44, 0x9a, 0xdc, 0x20, 0x00, 0xc0, 0xc1,
+	     0x40, 0xfa, 0x13, 0x8d, 0xa9, 0xed, 0xfd, 0x60, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x40, 0x88, 0xef, 0x35, 0xa8, 0x35, 0x14,
+	     0xe9, 0xc4, 0x2f, 0x00, 0x00, 0x19, 0x33, 0x21, 0x22, 0x00,
+	     0xa0, 0x79, 0xd1, 0x7c, 0x04, 0x00, 0x60, 0x50, 0xb8, 0x1e,
+	     0x8b, 0x23, 0x67, 0x66, 0x94, 0x0a, 0x00, 0xe0, 0x97, 0x82,
+	     0xeb, 0xdd, 0x9c, 0x4e, 0x96, 0xd6, 0x36, 0x54, 0x08, 0x82,
+	     0x01, 0x00, 0x70, 0xab, 0x39, 0x49, 0x2a, 0xbb, 0x00, 0x00,
+	     0x12, 0xb0, 0x78, 0x24, 0x0c, 0x4d, 0x73, 0x89, 0xfe, 0xf3,
+	     0x48, 0x86, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd3, 0x8f,
+	     0x4d, 0xa7, 0x00, 0x00, 0xe0, 0xc1, 0x00, 0x00, 0x00, 0x00,
+	     0xe6, 0x21, 0x3b, 0x1a, 0x00, 0xc0, 0x2d, 0x09, 0x00, 0x60,
+	     0x16, 0x48, 0x1e, 0x62, 0x12, 0x22, 0x25, 0x00, 0x80, 0x3e,
+	     0x84, 0x0b, 0x47, 0x75, 0xaa, 0x2c, 0x38, 0xbe, 0x9a, 0x84,
+	     0x5e, 0x4a, 0xc0, 0xd7, 0x4c, 0x24, 0x5e, 0x96, 0xc1, 0x03,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x37, 0x08, 0x5e, 0xdb,
+	     0x04, 0x00, 0xc0, 0x52, 0x01, 0x00, 0x5c, 0x0b, 0x04, 0x47,
+	     0x09, 0xb5, 0x86, 0x25, 0x00, 0x40, 0xcc, 0x25, 0x35, 0x0c,
+	     0x21, 0x38, 0x93, 0x68, 0x4a, 0x1a, 0x28, 0xbd, 0x60, 0xe2,
+	     0xb1, 0xb9, 0xb5, 0x1e, 0xb1, 0x3f, 0xa5, 0x73, 0x70, 0x5d,
+	     0xf9, 0x19, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x87, 0x01,
+	     0x00, 0xf0, 0xdc, 0xe2, 0x2a, 0x00, 0x00, 0xac, 0xc0, 0x52,
+	     0x09, 0x00, 0xe0, 0x8a, 0x92, 0xc0, 0xed, 0x0c, 0xf8, 0x44,
+	     0x65, 0x0a, 0x00, 0x40, 0x7c, 0x00, 0x00, 0xc0, 0x6f, 0xdc,
+	     0x1e, 0x04, 0x28, 0x01, 0x00, 0x24, 0x0e, 0xbc, 0xa4, 0xec,
+	     0x0b, 0x00, 0x20, 0xe4, 0x90, 0x5b, 0x01, 0x00, 0x0c, 0x3e,
+	     0xd4, 0x99, 0xff, 0x15, 0xe3, 0xab, 0x96, 0x32, 0x80, 0x1c,
+	     0x9f, 0x01, 0x00, 0xd6, 0x7c, 0x00, 0x00, 0x40, 0x64, 0x50,
+	     0x46, 0x16, 0x17, 0xca, 0x79, 0x9c, 0x2d, 0xf4, 0x3a, 0x16,
+	     0x5e, 0x15, 0xda, 0x42, 0x11, 0x05, 0x00, 0x00, 0x00, 0xc0,
+	     0x18, 0xf1, 0xc6, 0x44, 0x8d, 0x2a, 0x05, 0x00, 0x40, 0x9d,
+	     0x68, 0x24, 0x77, 0x45, 0x38, 0x9a, 0x61, 0x3d, 0x00, 0x00,
+	     0x69, 0x2a, 0x33, 0x92, 0x13, 0x6f, 0x18, 0xc2, 0x6f, 0x5b,
+	     0x58, 0x62, 0xb9, 0x2e, 0x11, 0x00, 0x80, 0x65, 0x1d, 0x2d,
+	     0x52, 0x7b, 0x13, 0xc1, 0x19, 0x52, 0x32, 0x6e, 0x92, 0x2d,
+	     0x00, 0x00, 0x9e, 0x99, 0xdd, 0x09, 0x00, 0x00, 0x00, 0x48,
+	     0xf8, 0xa4, 0x2e, 0x00, 0x00, 0x28, 0x80, 0x3b, 0xde, 0xca,
+	     0xc0, 0x5a, 0x81, 0x97, 0x88, 0x5d, 0x4e, 0x8e, 0x14, 0x30,
+	     0xf8, 0x9a, 0x9b, 0x5a, 0x14, 0x06, 0x00, 0xa0, 0x47, 0x90,
+	     0x49, 0xe9, 0xb0, 0x00, 0x00, 0x20, 0x85, 0xb1, 0xd9, 0xeb,
+	     0x0f, 0x00, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x4a,
+	     0xa1, 0x12, 0x00, 0xc0, 0x69, 0x87, 0xd6, 0xb0, 0x3d, 0xd2,
+	     0x42, 0x4a, 0xa1, 0x00, 0x00, 0x4f, 0x97, 0x5a, 0x11, 0x00,
+	     0x20, 0xcc, 0x08, 0xaf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x02, 0x20, 0x14, 0x04, 0x2c, 0x10, 0x00, 0xc0, 0x84, 0xb8,
+	     0x6a, 0xd5, 0x2b, 0xca, 0x03, 0x00, 0x80, 0xc8, 0x96, 0x32,
+	     0x27, 0x6e, 0x09, 0xd6, 0x21, 0x05, 0x01, 0x00, 0x08, 0x92,
+	     0x00, 0x00, 0x4b, 0xd3, 0x47, 0x0f, 0x6e, 0xf2, 0x0f, 0x01,
+	     0x00, 0x24, 0x02, 0x33, 0x90, 0x4f, 0xcd, 0x99, 0x14, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x32, 0xf1, 0x60, 0x17,
+	     0x12, 0x8e, 0xf9, 0x01, 0x63, 0x4c, 0x13, 0x91, 0xc9, 0x44,
+	     0x79, 0x3d, 0xbd, 0x00, 0x04, 0x9b, 0x46, 0x35, 0xc0, 0xd0,
+	     0xaf, 0x1c, 0xd1, 0xff, 0x20, 0x75, 0xe1, 0x6d, 0x10, 0x6a,
+	     0x5d, 0x46, 0x00, 0x00, 0x00, 0xc0, 0x7c, 0xa3, 0xa0, 0x10,
+	     0x63, 0x21, 0x34, 0x7e, 0x10, 0xac, 0x22, 0xd5, 0x4a, 0xc5,
+	     0x86, 0xab, 0x57, 0x5f, 0x00, 0x00, 0x10, 0x12, 0x24, 0x33,
+	     0x91, 0x9e, 0x47, 0x8f, 0xd9, 0xc1, 0x25, 0x00, 0x05, 0x04,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0xc0, 0x9a, 0x87, 0xd7, 0x54, 0x7f, 0x99, 0xd7, 0xf6, 0x6a,
+	     0x47, 0x22, 0xff, 0x19, 0x00, 0xe0, 0x5d, 0xe6, 0x93, 0x4b,
+	     0x5b, 0x81, 0xd9, 0xca, 0x7f, 0x75, 0x86, 0x4f, 0x04, 0x00,
+	     0x60, 0x08, 0xd7, 0x67, 0x58, 0xd1, 0x61, 0x06, 0x01, 0x00,
+	     0xcd, 0x03, 0x9e, 0x12, 0xe2, 0x0b, 0x00, 0x90, 0xf3, 0x01,
+	     0x08, 0xf4, 0x87, 0xfa, 0x68, 0x33, 0x30, 0xa8, 0x20, 0xa7,
+	     0xce, 0x84, 0x44, 0x84, 0xfb, 0xc5, 0xf5, 0xb2, 0x24, 0x6f,
+	     0xb8, 0xb0, 0x99, 0xe4, 0x1c, 0x29, 0xe9, 0xb4, 0xbf, 0xc4,
+	     0x58, 0xac, 0xaf, 0xea, 0x28, 0x57, 0x28, 0x00, 0x19, 0x27,
+	     0xf3, 0x0a, 0x18, 0x32, 0x21, 0x2e, 0xb6, 0x56, 0x3a, 0x15,
+	     0x8d, 0x21, 0xa9, 0x91, 0x52, 0x13, 0x2f, 0x04, 0x00, 0x08,
+	     0x51, 0x1d, 0x9b, 0x00, 0x00, 0x28, 0xcb, 0x61, 0x1c, 0x50,
+	     0x07, 0x00, 0xf0, 0xc9, 0x00, 0x00, 0x70, 0xe9, 0x5a, 0x5c,
+	     0xdd, 0xbe, 0xaf, 0x8a, 0x86, 0x09, 0xa4, 0x52, 0xdf, 0xf4,
+	     0x8f, 0x45, 0x32, 0xa5, 0x50, 0x00, 0x00, 0x07, 0x00, 0xb5,
+	     0x8f, 0x20, 0xa9, 0xc0, 0xf2, 0x2a, 0x2a, 0x6b, 0x00, 0x00,
+	     0x1c, 0xb1, 0x3e, 0x86, 0xd8, 0x12, 0x00, 0x70, 0xff, 0x71,
+	     0x95, 0x01, 0x00, 0x74, 0x25, 0xaf, 0x83, 0x16, 0x23, 0x5c,
+	     0x08, 0x00, 0xa0, 0x99, 0xc0, 0x48, 0x1e, 0xa7, 0xea, 0x8c,
+	     0x5c, 0x47, 0x8c, 0x9f, 0x77, 0x0d, 0x00, 0x90, 0xbf, 0x03,
+	     0x00, 0x64, 0xd8, 0x00, 0x00, 0xc6, 0x32, 0xbf, 0x48, 0x51,
+	     0x0d, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xba, 0x16, 0x93, 0x21,
+	     0x00, 0x00, 0x8e, 0x0c, 0x57, 0x85, 0x1b, 0x11, 0x72, 0x24,
+	     0x21, 0x01, 0x00, 0xa0, 0x8b, 0xed, 0x8f, 0x94, 0x10, 0x00,
+	     0x00, 0x00, 0xb0, 0xc7, 0xa2, 0x4c, 0x25, 0x02, 0x18, 0x8a,
+	     0x00, 0x00, 0x34, 0x92, 0xa0, 0x0b, 0x00, 0xa0, 0xdb, 0x03,
+	     0x00, 0x58, 0x3c, 0xa8, 0x05, 0xde, 0x34, 0x43, 0x1a, 0xad,
+	     0x8c, 0x01, 0x52, 0xd8, 0x14, 0xc8, 0x54, 0xd5, 0x9a, 0x00,
+	     0xc0, 0x14, 0x00, 0xc0, 0x71, 0xee, 0x98, 0xa9, 0xaf, 0x51,
+	     0xd4, 0xb8, 0x1c, 0x2a, 0x52, 0x00, 0x00, 0x31, 0x9e, 0x32,
+	     0x42, 0xd2, 0x18, 0x39, 0x03, 0x00, 0xa4, 0xfb, 0x86, 0x95,
+	     0xfe, 0x37, 0x9c, 0x10, 0x00, 0xe0, 0x9b, 0x13, 0xc6, 0x42,
+	     0x1e, 0x36, 0x21, 0xb6, 0x89, 0xc8, 0x10, 0xf9, 0xcb, 0x89,
+	     0xca, 0x0f, 0x63, 0x21, 0xf4, 0x2c, 0x10, 0xd5, 0x00, 0x00,
+	     0x70, 0xb9, 0xb4, 0xa2, 0x01, 0x23, 0xa7, 0x85, 0xa9, 0x00,
+	     0x00, 0x7c, 0x57, 0xac, 0x3c, 0x1b, 0x96, 0xa5, 0x63, 0x06,
+	     0xc4, 0x5f, 0x17, 0xae, 0xb4, 0x13, 0x16, 0x62, 0xdc, 0x3e,
+	     0xc5, 0xb5, 0xe7, 0xd6, 0x5c, 0x93, 0x31, 0x08, 0x00, 0x00,
+	     0x00, 0x10, 0xb8, 0x00, 0x00, 0x34, 0x3a, 0xc2, 0x51, 0x1e,
+	     0x26, 0xcc, 0xc3, 0x4e, 0x71, 0x53, 0xfa, 0x31, 0xb0, 0x78,
+	     0x80, 0xa5, 0x5c, 0x4c, 0xd0, 0x03, 0x1d, 0x21, 0xb5, 0x4c,
+	     0x35, 0x01, 0x00, 0x94, 0x7f, 0x92, 0x1f, 0xec, 0x48, 0x26,
+	     0x0a, 0x00, 0x00, 0x00, 0x28, 0x74, 0xf8, 0x04, 0xa9, 0x2f,
+	     0x00, 0x80, 0x09, 0x0d, 0x00, 0x60, 0xaa, 0xe9, 0x3f, 0xfa,
+	     0x54, 0x01, 0x00, 0xd6, 0x89, 0x40, 0xa6, 0x4a, 0x99, 0x91,
+	     0x06, 0x4c, 0xa0, 0x7c, 0x00, 0x00, 0xf4, 0x04, 0x82, 0x26,
+	     0xc8, 0x1d, 0x00, 0xc0, 0x0e, 0x20, 0x4e, 0x68, 0xe9, 0x03,
+	     0x00, 0x50, 0xea, 0x78, 0x59, 0x00, 0x00, 0x00, 0x07, 0x00,
+	     0x80, 0x14, 0xc7, 0x02, 0x4b, 0x58, 0x02, 0x00, 0x62, 0x86,
+	     0xd9, 0x3f, 0xa2, 0x58, 0x9e, 0x02, 0x00, 0x00, 0x00, 0xb0,
+	     0x54, 0xc8, 0x33, 0x43, 0x51, 0x00, 0x80, 0xe0, 0x0d, 0x00,
+	     0x20, 0xa7, 0xb8, 0x3e, 0x78, 0x66, 0xfc, 0xee, 0x90, 0x21,
+	     0x4b, 0x41, 0x64, 0x86, 0x8f, 0x09, 0x00, 0xc0, 0x08, 0xc9,
+	     0xb1, 0x34, 0x13, 0x89, 0x21, 0x6d, 0x05, 0xac, 0x97, 0x35,
+	     0x05, 0x00, 0x80, 0xa4, 0x6b, 0x04, 0x01, 0x00, 0x00, 0x00,
+	     0x13, 0x36, 0x5b, 0x57, 0x8c, 0x85, 0x3f, 0x93, 0xc1, 0x81,
+	     0x0a, 0x06, 0x55, 0x4e, 0x74, 0x8e, 0x26, 0x95, 0x1a, 0x00,
+	     0x20, 0x48, 0x05, 0x00, 0x68, 0xc7, 0xc4, 0xd3, 0xac, 0x02,
+	     0x03, 0x24, 0xce, 0xd5, 0x56, 0x0c, 0x00, 0x90, 0x6d, 0x2a,
+	     0x5d, 0x86, 0x9f, 0x00, 0x00, 0xf3, 0x89, 0x20, 0x03, 0x71,
+	     0x03, 0x09, 0x04, 0x00, 0x48, 0x83, 0xe8, 0x91, 0x00, 0x00,
+	     0x79, 0x22, 0x02, 0xde, 0x61, 0x0f, 0xa0, 0x06, 0x00, 0x98,
+	     0xc7, 0x4d, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x76, 0x9c, 0x94,
+	     0xae, 0x21, 0xb3, 0xac, 0x64, 0x83, 0x51, 0x65, 0x1c, 0x4e,
+	     0x00, 0x80, 0x76, 0x0e, 0xea, 0x0a, 0xa7, 0x16, 0x12, 0xfa,
+	     0x97, 0xf4, 0xac, 0xb0, 0x07, 0x24, 0x29, 0x00, 0x40, 0x1c,
+	     0x83, 0xf3, 0xc8, 0xd2, 0x48, 0x70, 0x02, 0x00, 0xe2, 0x2f,
+	     0x00, 0x80, 0x4f, 0x66, 0x74, 0x10, 0x00, 0x20, 0xb0, 0x03,
+	     0x00, 0x2c, 0x55, 0x00, 0x00, 0x3a, 0x01, 0x68, 0x23, 0x00,
+	     0xc0, 0x26, 0x86, 0x7d, 0x5b, 0xe8, 0xe1, 0x91, 0x52, 0x80,
+	     0x40, 0x2c, 0x00, 0x40, 0xea, 0x0a, 0x00, 0x00, 0x00, 0x10,
+	     0x4b, 0x74, 0xe4, 0x8c, 0x1c, 0xd1, 0x38, 0x00, 0x00, 0x19,
+	     0xa3, 0xb9, 0xc0, 0x88, 0x43, 0x55, 0x69, 0xb4, 0x80, 0x49,
+	     0xe2, 0x2a, 0x00, 0x80, 0x02, 0x41, 0x09, 0x03, 0x00, 0x50,
+	     0x4f, 0x92, 0x7a, 0xbe, 0x86, 0x2c, 0x2b, 0xfb, 0xa3, 0x72,
+	     0x47, 0x69, 0x01, 0x00, 0x48, 0x1e, 0x01, 0x00, 0xc8, 0x6a,
+	     0xea, 0x85, 0xaf, 0x96, 0xc6, 0xaf, 0x75, 0x25, 0xf5, 0x00,
+	     0x00, 0x08, 0x77, 0xc2, 0x3e, 0x5d, 0xb7, 0xb3, 0x05, 0x00,
+	     0xc0, 0x4c, 0x58, 0xae, 0x3a, 0x34, 0x18, 0x9e, 0x78, 0x7b,
+	     0xfc, 0x19, 0x00, 0x00, 0x00, 0xc0, 0xed, 0x08, 0x00, 0x18,
+	     0x88, 0x84, 0xe6, 0x80, 0x0d, 0x95, 0x1d, 0x13, 0x09, 0x00,
+	     0x80, 0x1f, 0x02, 0x00, 0x68, 0x25, 0x02, 0x00, 0x2c, 0x21,
+	     0x45, 0x84, 0x8f, 0x47, 0x8f, 0x91, 0x86, 0x34, 0x69, 0x52,
+	     0xd1, 0x35, 0x94, 0x00, 0x00, 0xf1, 0x22, 0x1d, 0x5c, 0x3a,
+	     0x6f, 0x6c, 0x52, 0xeb, 0x6b, 0x75, 0x00, 0x00, 0x00, 0x00,
+	     0x38, 0x9c, 0x57, 0x84, 0x4b, 0xec, 0x3b, 0x04, 0x62, 0x6b,
+	     0x98, 0x00, 0x00, 0xbc, 0x95, 0x3b, 0x20, 0x00, 0x80, 0x92,
+	     0xd2, 0x88, 0x05, 0x6f, 0x02, 0x00, 0x50, 0xfc, 0x02, 0x30,
+	     0xbe, 0x06, 0xca, 0x5a, 0x6d, 0x72, 0x5c, 0xe8, 0xbc, 0xd8,
+	     0x63, 0x18, 0xd9, 0xac, 0x4c, 0x0e, 0xa3, 0x19, 0xd0, 0x94,
+	     0xce, 0x0d, 0x89, 0xc4, 0x89, 0x5e, 0xb5, 0x39, 0xca, 0x7e,
+	     0xa7, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x05, 0x00, 0x68,
+	     0x3f, 0x02, 0x00, 0xa6, 0x29, 0x9a, 0x23, 0x4a, 0x24, 0x00,
+	     0x80, 0x19, 0x51, 0xb0, 0xfc, 0xf7, 0x01, 0x00, 0x1a, 0x6e,
+	     0xcb, 0xbd, 0xa3, 0x80, 0xfd, 0xe5, 0x77, 0x52, 0x42, 0x01,
+	     0x00, 0x94, 0x07, 0x1c, 0x33, 0x00, 0x00, 0xcf, 0x92, 0xbd,
+	     0xce, 0xb5, 0xd2, 0xc0, 0x03, 0x00, 0x24, 0xfd, 0x94, 0x66,
+	     0xe1, 0xbb, 0x1b, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
+	     0x39, 0xf8, 0x21, 0xba, 0x58, 0x96, 0x0a, 0x00, 0x40, 0x92,
+	     0x0f, 0x00, 0x00, 0x00, 0x70, 0xfd, 0x01, 0x00, 0x00, 0x00,
+	     0xd3, 0x1f, 0xb5, 0x92, 0x05, 0x0a, 0x00, 0x00, 0x00, 0xf0,
+	     0xde, 0x88, 0x54, 0x36, 0x04, 0x00, 0x00, 0x00, 0x00, 0x6e,
+	     0x22, 0x13, 0x99, 0x46, 0xd0, 0xb9, 0xf1, 0x84, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x8c, 0xc0, 0xc7, 0x66, 0xd6, 0x9a,
+	     0xd7, 0x91, 0x49, 0x3c, 0x18, 0xdf, 0x4b, 0x00, 0x00, 0xcb,
+	     0xed, 0x29, 0x58, 0xd4, 0xcb, 0x67, 0x2e, 0x80, 0xb4, 0x5f,
+	     0xc3, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x23, 0x9b,
+	     0x81, 0x81, 0x55, 0xbe, 0x57, 0x15, 0x33, 0x00, 0xc0, 0x6a,
+	     0x11, 0x00, 0x80, 0x6c, 0x64, 0x04, 0x55, 0x9d, 0xa2, 0x11,
+	     0x55, 0x98, 0x3f, 0x24, 0x2c, 0xcb, 0xf3, 0x66, 0xd4, 0x2c,
+	     0x24, 0x30, 0x23, 0x00, 0x00, 0x4d, 0x3e, 0x00, 0x00, 0x00,
+	     0x20, 0xf2, 0xa7, 0x2a, 0xe8, 0x13, 0x61, 0x08, 0x00, 0x00,
+	     0x04, 0x2f, 0xde, 0x54, 0x52, 0x6c, 0x10, 0x07, 0x00, 0xb0,
+	     0xcd, 0xd1, 0x33, 0xf1, 0x22, 0x99, 0xaf, 0x4d, 0x1e, 0x00,
+	     0x00, 0x30, 0xb6, 0x54, 0x5b, 0x50, 0x90, 0x27, 0x18, 0x34,
+	     0x88, 0x2a, 0x70, 0x07, 0x94, 0x6e, 0xab, 0x53, 0x80, 0xcc,
+	     0x80, 0x85, 0xd2, 0x62, 0x3d, 0x28, 0x99, 0x6a, 0x94, 0x30,
+	     0xd3, 0x4c, 0x09, 0x00, 0xa0, 0xae, 0xa5, 0x21, 0x8d, 0x2f,
+	     0x3e, 0x45, 0x7c, 0xa1, 0x48, 0x69, 0xb7, 0x93, 0x48, 0xc4,
+	     0x4f, 0x90, 0x03, 0x08, 0x66, 0x56, 0xbc, 0xe0, 0x81, 0x04,
+	     0x64, 0x91, 0xc8, 0x2d, 0xd1, 0x58, 0x41, 0x2b, 0x00, 0x00,
+	     0xef, 0xcc, 0x2c, 0xc1, 0xb8, 0xa6, 0x2f, 0x76, 0x47, 0x81,
+	     0x0c, 0xc4, 0x33, 0x8b, 0x0d, 0xaf, 0x48, 0x9a, 0x9d, 0x86,
+	     0xec, 0xf7, 0x92, 0xdf, 0xe8, 0xce, 0x79, 0x5c, 0x16, 0x19,
+	     0x5f, 0xc0, 0x67, 0x06, 0x00, 0xe0, 0x0c, 0x10, 0xe4, 0x01,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x86, 0xa3, 0x16, 0xfc,
+	     0x07, 0x00, 0x20, 0x31, 0x93, 0x5b, 0x02, 0x00, 0x0a, 0x47,
+	     0x2f, 0x1f, 0x00, 0xc0, 0xba, 0x31, 0x91, 0x07, 0xbf, 0x01,
+	     0x00, 0x00, 0x00, 0x3c, 0x8c, 0x19, 0x96, 0x35, 0x43, 0x99,
+	     0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x06,
+	     0x01, 0x13, 0x92, 0x1b, 0x00, 0x80, 0xf9, 0x07, 0x00, 0xc0,
+	     0x9f, 0x8d, 0x53, 0x7e, 0x59, 0x00, 0x80, 0x5c, 0x62, 0x7f,
+	     0x09, 0x00, 0x20, 0xc8, 0xac, 0x39, 0x01, 0x2e, 0x01, 0x00,
+	     0xf8, 0xb4, 0x74, 0x23, 0x00, 0xc0, 0x32, 0x06, 0x00, 0x20,
+	     0xf1, 0x5c, 0x92, 0xa8, 0x73, 0xdf, 0x83, 0xba, 0x0d, 0x85,
+	     0x31, 0x0d, 0x85, 0xb5, 0xb2, 0xae, 0x00, 0x00, 0xe8, 0x38,
+	     0x06, 0x0c, 0xdb, 0x4d, 0x0a, 0x33, 0xd5, 0xe3, 0x15, 0xe8,
+	     0x91, 0x00, 0x00, 0xf2, 0x99, 0x00, 0x80, 0xfe, 0x16, 0x00,
+	     0x60, 0x2d, 0x03, 0x00, 0x00, 0xd4, 0xb8, 0xd6, 0x96, 0x1e,
+	     0x00, 0x00, 0xf6, 0x00, 0x0b, 0xee, 0x33, 0x89, 0xa8, 0x04,
+	     0x00, 0x00, 0x00, 0x36, 0x03, 0x00, 0x00, 0xc3, 0xd2, 0xa7,
+	     0xcd, 0x74, 0x22, 0x90, 0xcc, 0x9a, 0x01, 0x00, 0x4c, 0x46,
+	     0x94, 0x31, 0x00, 0x00, 0xc5, 0xcd, 0xe0, 0x21, 0xef, 0x48,
+	     0x9c, 0x15, 0x5f, 0x72, 0x90, 0x00, 0x00, 0x00, 0x80, 0x35,
+	     0x85, 0xe7, 0x05, 0x00, 0x40, 0x00, 0xb0, 0x8c, 0xa8, 0x12,
+	     0x1e, 0x39, 0x00, 0x0b, 0x00, 0x20, 0xf5, 0x67, 0xbd, 0x58,
+	     0x81, 0xb9, 0x56, 0xfe, 0x18, 0x92, 0x09, 0x60, 0xc5, 0x9b,
+	     0x8a, 0x07, 0x72, 0xce, 0xb9, 0x87, 0x9c, 0x64, 0xa6, 0x83,
+	     0x36, 0xb3, 0x99, 0x0f, 0x35, 0xcf, 0x63, 0xe4, 0x6e, 0x9a,
+	     0xc6, 0xb8, 0xc2, 0x06, 0x80, 0xcb, 0xbb, 0x64, 0x86, 0x2f,
+	     0x67, 0xc7, 0x04, 0x00, 0x40, 0x7e, 0xfc, 0x10, 0x00, 0x00,
+	     0x96, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1d, 0x1a,
+	     0xd2, 0x01, 0x00, 0x98, 0x6b, 0x97, 0x96, 0x8c, 0x8f, 0x54,
+	     0xcb, 0x7c, 0x64, 0x9d, 0x4a, 0x94, 0xdc, 0x62, 0x18, 0x33,
+	     0xc9, 0x09, 0x00, 0x80, 0x75, 0x01, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x0c, 0x56, 0x5c, 0x5d, 0x5d, 0x17, 0x00, 0x40, 0x9a,
+	     0x69, 0x2b, 0x00, 0x00, 0x08, 0xb1, 0x24, 0x17, 0x01, 0x00,
+	     0x00, 0x00, 0xb1, 0x47, 0xbe, 0x32, 0xe7, 0xc0, 0xf9, 0xeb,
+	     0x17, 0x58, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x80, 0x19, 0x13, 0xf4, 0xe1, 0x65, 0x02, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x94, 0x84, 0x2e, 0x2b, 0x9a, 0x06, 0x51, 0x78,
+	     0xf5, 0xe0, 0xd5, 0x00, 0x00, 0x36, 0xbe, 0x2a, 0x45, 0x63,
+	     0x0c, 0x00, 0x20, 0x6f, 0x83, 0x1e, 0xf9, 0xb9, 0x3a, 0x36,
+	     0x7d, 0xb9, 0xca, 0xd0, 0x19, 0x0f, 0x4e, 0xc3, 0x0e, 0x04,
+	     0x00, 0xa8, 0x01, 0x00, 0x00, 0x9e, 0x8d, 0x24, 0x09, 0x00,
+	     0x00, 0x00, 0x40, 0x20, 0x02, 0x00, 0x00, 0x00, 0x24, 0x76,
+	     0xe6, 0x07, 0xc5, 0x1d, 0x00, 0x80, 0x54, 0x04, 0x00, 0x70,
+	     0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xdf, 0xfc,
+	     0xc6, 0xd7, 0x00, 0x00, 0xa0, 0x7a, 0xf0, 0xc6, 0x16, 0x93,
+	     0x57, 0x41, 0xd4, 0xd5, 0x78, 0x01, 0x00, 0xc0, 0xa3, 0x9c,
+	     0x68, 0x02, 0x00, 0x00, 0x00, 0xb0, 0x23, 0x00, 0x80, 0x72,
+	     0x02, 0x00, 0xb0, 0xd5, 0xc1, 0x8d, 0x30, 0x9b, 0x00, 0x00,
+	     0xa0, 0x28, 0xf4, 0x21, 0x3f, 0x93, 0xc5, 0x07, 0x00, 0x00,
+	     0x00, 0x2c, 0x65, 0x28, 0x76, 0x00, 0x80, 0xad, 0x57, 0x25,
+	     0x0f, 0x00, 0x10, 0x8a, 0xfb, 0xf1, 0xe8, 0x00, 0x01, 0x00,
+	     0xff, 0x24, 0xee, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x7e, 0xc0, 0x25, 0xdb, 0x1a, 0x69, 0x88, 0xe5, 0x66, 0x50,
+	     0x40, 0xc3, 0xa7, 0x5a, 0x59, 0xe5, 0x08, 0xa6, 0xaa, 0x6a,
+	     0xcc, 0x0c, 0x00, 0xc0, 0xe6, 0x6f, 0x3d, 0x97, 0xab, 0x68,
+	     0x08, 0xca, 0x67, 0x4c, 0x18, 0x1c, 0x98, 0xe2, 0x04, 0x00,
+	     0x40, 0x98, 0xa6, 0xc8, 0x84, 0xe1, 0x79, 0x0c, 0x00, 0x00,
+	     0x00, 0x80, 0x18, 0x24, 0x00, 0x80, 0x32, 0x51, 0x99, 0xf3,
+	     0xee, 0x11, 0xb5, 0x00, 0x00, 0x75, 0x03, 0xae, 0x92, 0xc2,
+	     0x83, 0xda, 0xe5, 0xaa, 0x04, 0x00, 0x00, 0x00, 0x96, 0x5f,
+	     0x77, 0x46, 0x0f, 0x83, 0xc6, 0x0b, 0xef, 0x48, 0x6a, 0x01,
+	     0x00, 0x00, 0x00, 0xae, 0x26, 0xce, 0x02, 0x1a, 0x12, 0x00,
+	     0xe0, 0x24, 0x74, 0x2b, 0x41, 0x4b, 0xfa, 0x86, 0x16, 0x49,
+	     0x97, 0x39, 0x91, 0x20, 0x8c, 0xe3, 0x29, 0xd9, 0xd7, 0xd2,
+	     0x3a, 0x16, 0x52, 0xae, 0x7f, 0x00, 0x00, 0xd4, 0xd6, 0x72,
+	     0x6f, 0xea, 0x03, 0xb8, 0x14, 0x67, 0x96, 0x46, 0x4e, 0x68,
+	     0xd6, 0xcd, 0xd2, 0xe6, 0x04, 0x4e, 0xb5, 0x06, 0x00, 0xb0,
+	     0x70, 0x01, 0x00, 0x02, 0x14, 0xa2, 0x11, 0x00, 0x40, 0xfa,
+	     0x20, 0xba, 0x50, 0x0c, 0x4a, 0xdf, 0x2c, 0xd3, 0xce, 0x3d,
+	     0x51, 0x07, 0x00, 0x40, 0x54, 0x49, 0xf4, 0x36, 0xca, 0x5c,
+	     0x6f, 0x85, 0x78, 0x00, 0x00, 0xfa, 0x10, 0x00, 0xc0, 0xe2,
+	     0x07, 0x00, 0xb0, 0xde, 0x52, 0x1f, 0x64, 0x37, 0xf2, 0x41,
+	     0xdf, 0x3d, 0x00, 0x00, 0xe4, 0xcb, 0x9e, 0x39, 0xcf, 0x01,
+	     0x00, 0x60, 0x94, 0xe8, 0x06, 0x00, 0x00, 0xe7, 0x5d, 0x74,
+	     0x72, 0x54, 0x39, 0xe7, 0x01, 0x00, 0x0c, 0x10, 0x0c, 0x87,
+	     0x44, 0x20, 0x00, 0x00, 0x00, 0x60, 0x44, 0x96, 0xc3, 0xfb,
+	     0x2f, 0x0a, 0x3d, 0xe8, 0x2c, 0x78, 0x01, 0x89, 0x19, 0x00,
+	     0x60, 0x1b, 0xb4, 0xd7, 0x82, 0x07, 0x04, 0x1d, 0x29, 0x27,
+	     0x72, 0x23, 0x0d, 0xa2, 0xc3, 0xea, 0x99, 0x03, 0x00, 0x40,
+	     0x99, 0x65, 0x3f, 0xb0, 0x67, 0x5c, 0xb1, 0x9b, 0xc6, 0xd1,
+	     0xe4, 0xf2, 0x56, 0xa1, 0x73, 0xeb, 0x00, 0x44, 0x1e, 0x4f,
+	     0x8b, 0x13, 0xae, 0xcd, 0x1b, 0x80, 0xde, 0x26, 0x80, 0x02,
+	     0xbd, 0x01, 0x00, 0xce, 0x3d, 0x00, 0x00, 0x57, 0x60, 0x18,
+	     0xb1, 0xd6, 0x04, 0x00, 0x18, 0x4a, 0x4d, 0xe1, 0x44, 0x5c,
+	     0x63, 0x9b, 0x80, 0xa6, 0xd2, 0xe6, 0x91, 0xf8, 0xb3, 0x20,
+	     0x46, 0xd8, 0x2d, 0x72, 0x22, 0x2c, 0x38, 0xb2, 0x1d, 0x00,
+	     0x00, 0x00, 0xb0, 0x6d, 0x01, 0x00, 0x04, 0x39, 0x00, 0x00,
+	     0xeb, 0xa1, 0x64, 0x10, 0x58, 0xc0, 0x50, 0x09, 0x00, 0x88,
+	     0xc3, 0x89, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad,
+	     0xc2, 0x1f, 0x03, 0x00, 0xd0, 0x81, 0x21, 0x34, 0x01, 0x00,
+	     0x16, 0x3a, 0x00, 0x00, 0xd7, 0x21, 0x85, 0x32, 0x5e, 0x50,
+	     0xb7, 0x20, 0x2a, 0xad, 0x00, 0x00, 0x00, 0xdd, 0x0a, 0x00,
+	     0xe0, 0x34, 0x26, 0xa8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x60, 0xa7, 0x8d, 0x66, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0xfc, 0x0d, 0xaf, 0x63, 0x46, 0x1b, 0x62, 0x0f, 0x00,
+	     0xc0, 0xfa, 0xb7, 0xb3, 0x03, 0x93, 0x94, 0x00, 0x4d, 0x8e,
+	     0x6e, 0xbb, 0x82, 0x1d, 0x00, 0x20, 0xb1, 0x14, 0x38, 0xfb,
+	     0xb7, 0xa8, 0xe0, 0x78, 0x4f, 0x97, 0xc8, 0xee, 0xde, 0xb7,
+	     0xab, 0x7f, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x10, 0x98, 0x94,
+	     0xe5, 0x91, 0xe7, 0xd1, 0x5f, 0xcf, 0xaa, 0x05, 0x00, 0x90,
+	     0xa4, 0x79, 0x47, 0xa6, 0x71, 0x2e, 0x31, 0x00, 0x00, 0x00,
+	     0x40, 0x6c, 0xf2, 0xb0, 0x2b, 0x80, 0x94, 0x14, 0x48, 0x3b,
+	     0x88, 0x2b, 0xf8, 0x04, 0x00, 0xc0, 0xb6, 0x30, 0x85, 0xdc,
+	     0xdb, 0xb8, 0xbc, 0x00, 0x00, 0x4c, 0xc4, 0x13, 0xd2, 0x25,
+	     0x42, 0x6e, 0xe2, 0x5f, 0xc0, 0x99, 0x2d, 0x8a, 0x8e, 0x22,
+	     0xba, 0x48, 0x49, 0x96, 0x2c, 0x12, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x68, 0x21, 0x96, 0x70, 0xa9, 0x23, 0x00, 0x00, 0xc8,
+	     0xaf, 0x32, 0xe1, 0x01, 0x03, 0x00, 0x64, 0xc4, 0x00, 0x00,
+	     0xc3, 0xa9, 0x99, 0x25, 0x64, 0xc5, 0xf8, 0xc5, 0xbc, 0x89,
+	     0xf1, 0x00, 0x00, 0x0e, 0x61, 0x7d, 0x0e, 0xf4, 0x9b, 0xe1,
+	     0x62, 0x26, 0xe9, 0x18, 0xaa, 0x64, 0x09, 0x9c, 0x7e, 0x5b,
+	     0xcd, 0x2f, 0xfd, 0xca, 0x8b, 0x89, 0xcd, 0x00, 0x00, 0x00,
+	     0x0f, 0x41, 0x5b, 0x48, 0x29, 0xd4, 0x8b, 0x0d, 0x96, 0xe8,
+	     0xe8, 0xff, 0xb0, 0x16, 0x40, 0x17, 0x26, 0xac, 0x0a, 0x89,
+	     0x2b, 0x9c, 0xaf, 0x1b, 0x4d, 0x2b, 0xef, 0x03, 0x00, 0x00,
+	     0x00, 0xc4, 0x16, 0x26, 0x37, 0x12, 0x1c, 0x61, 0xa2, 0x97,
+	     0xc7, 0xd2, 0xd7, 0xa8, 0x48, 0xf6, 0x41, 0x80, 0x68, 0x9b,
+	     0x4f, 0xc9, 0x26, 0x85, 0x56, 0x21, 0x43, 0xc8, 0x2e, 0x0c,
+	     0x4a, 0x00, 0x00, 0x8c, 0x60, 0x00, 0x80, 0x8a, 0x13, 0x73,
+	     0x90, 0x27, 0x42, 0xc1, 0xc0, 0x56, 0xf6, 0x47, 0x58, 0x0d,
+	     0x20, 0x1a, 0x8c, 0x83, 0x07, 0x00, 0x2f, 0x07, 0x00, 0x00,
+	     0x00, 0x78, 0x08, 0xc7, 0x87, 0x8d, 0xac, 0x35, 0xdd, 0x36,
+	     0x83, 0x23, 0x46, 0x10, 0x4c, 0xda, 0x15, 0xd1, 0x16, 0x5f,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x9d, 0x28, 0xec, 0xd0,
+	     0xfd, 0x91, 0xb3, 0x66, 0x47, 0x00, 0x80, 0x85, 0x26, 0x00,
+	     0x46, 0x5a, 0x78, 0x59, 0x0b, 0x51, 0x00, 0x00, 0xda, 0x36,
+	     0x88, 0xb8, 0x70, 0xa6, 0xe3, 0x8c, 0xac, 0x09, 0xdc, 0x7c,
+	     0x69, 0x52, 0x18, 0x97, 0x97, 0x24, 0x10, 0x54, 0xcd, 0x01,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf4, 0xe0, 0x0b,
+	     0xfd, 0x8b, 0x1f, 0x01, 0xd9, 0x6e, 0x79, 0x60, 0x12, 0x02,
+	     0x00, 0x48, 0x32, 0x62, 0x67, 0x02, 0x16, 0xf1, 0x26, 0x4d,
+	     0x12, 0x76, 0xc9, 0x2f, 0x0a, 0x75, 0x9c, 0x48, 0xb8, 0x10,
+	     0x37, 0x14, 0x26, 0x0f, 0x00, 0x80, 0x45, 0x77, 0x07, 0x32,
+	     0xf1, 0x05, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xc1, 0x60,
+	     0x00, 0x00, 0x80, 0x02, 0x03, 0x00, 0x68, 0x36, 0x49, 0x74,
+	     0x69, 0xbb, 0x03, 0xa0, 0xe1, 0x01, 0x00, 0x00, 0x00, 0xd8,
+	     0x6a, 0x02, 0x00, 0x00, 0x78, 0x70, 0x45, 0xbc, 0x1b, 0x90,
+	     0x05, 0xfe, 0x00, 0x00, 0x50, 0x5e, 0x02, 0x00, 0x5e, 0x73,
+	     0x41, 0x3a, 0x00, 0x80, 0x63, 0x52, 0x5d, 0x22, 0xda, 0x6b,
+	     0x1a, 0x3c, 0xeb, 0xe8, 0x23, 0x5e, 0x11, 0x4d, 0xdb, 0x95,
+	     0x43, 0x6b, 0x82, 0x7c, 0xf1, 0x9a, 0x00, 0x00, 0x00, 0x00,
+	     0x32, 0x22, 0x2b, 0x8d, 0x53, 0xca, 0xde, 0x91, 0xba, 0x00,
+	     0x00, 0x00, 0x00, 0xb6, 0x15, 0x10, 0x4d, 0x00, 0xc0, 0x77,
+	     0x86, 0x94, 0x05, 0xc3, 0x60, 0xd3, 0x85, 0x56, 0x02, 0x08,
+	     0x93, 0x2a, 0x00, 0x00, 0x00, 0x40, 0x1d, 0x88, 0xef, 0x13,
+	     0x00, 0x2e, 0xfc, 0x50, 0x06, 0xdf, 0x29, 0x00, 0xc0, 0x3f,
+	     0x09, 0xa0, 0x06, 0x00, 0x00, 0x00, 0x20, 0x1f, 0x33, 0x34,
+	     0x00, 0x00, 0x00, 0x80, 0xe4, 0x48, 0x6d, 0x02, 0x00, 0x68,
+	     0x1a, 0x15, 0xda, 0x70, 0x56, 0xb5, 0x0c, 0xad, 0x80, 0x09,
+	     0x20, 0xf8, 0x08, 0x69, 0x01, 0x00, 0x5c, 0x40, 0xc8, 0x80,
+	     0x82, 0x00, 0x29, 0x97, 0x72, 0xd0, 0x61, 0xe6, 0x4e, 0x04,
+	     0x00, 0xe8, 0x71, 0x24, 0x76, 0x7b, 0x8a, 0x2f, 0x09, 0x72,
+	     0x12, 0x55, 0x26, 0xc1, 0x4b, 0xcf, 0x18, 0x75, 0x00, 0x00,
+	     0x1f, 0x36, 0x00, 0x00, 0x00, 0x20, 0x1b, 0x09, 0x00, 0x80,
+	     0xc7, 0xbd, 0x6b, 0x96, 0x70, 0xe7, 0xc5, 0x24, 0x50, 0xc6,
+	     0x0a, 0x00, 0x00, 0x00, 0x10, 0x69, 0x9a, 0x30, 0x01, 0x00,
+	     0x00, 0x80, 0x7e, 0x51, 0x0b, 0x6b, 0xbb, 0xc5, 0xc8, 0xc8,
+	     0xb5, 0x00, 0x00, 0xe6, 0x4e, 0x00, 0x00, 0xf1, 0x18, 0x00,
+	     0x60, 0x09, 0x01, 0x00, 0x70, 0xe1, 0xc4, 0x3b, 0xa6, 0x5e,
+	     0x00, 0x00, 0xc0, 0x5a, 0x03, 0x0a, 0x00, 0xe0, 0x45, 0xc9,
+	     0xd0, 0x01, 0x00, 0xce, 0x64, 0xd4, 0xab, 0x4c, 0x55, 0xa4,
+	     0x04, 0x00, 0x00, 0x00, 0x68, 0x4b, 0xd0, 0x3f, 0x30, 0x10,
+	     0xa7, 0x09, 0x3c, 0x16, 0x93, 0x68, 0x14, 0xe9, 0xfd, 0x33,
+	     0xf6, 0xd8, 0x17, 0xbd, 0x71, 0x87, 0x01, 0x0b, 0xce, 0xe4,
+	     0x03, 0x00, 0xa0, 0xcb, 0xfc, 0x17, 0x02, 0x00, 0x00, 0x00,
+	     0xee, 0xc6, 0x22, 0x1e, 0xa5, 0x01, 0x2f, 0x77, 0xd5, 0xb2,
+	     0x61, 0x72, 0x6e, 0x00, 0x00, 0x53, 0x05, 0xd8, 0x4a, 0x3e,
+	     0x05, 0x00, 0x00, 0x00, 0x68, 0x54, 0xac, 0xff, 0x14, 0x48,
+	     0x3a, 0x3d, 0x00, 0x00, 0x00, 0x60, 0xcb, 0xd1, 0x55, 0x59,
+	     0x83, 0xb9, 0xf8, 0x00, 0x00, 0x89, 0xb9, 0xc5, 0x66, 0x66,
+	     0xaa, 0x40, 0x37, 0x88, 0x04, 0xc6, 0x3c, 0xef, 0x12, 0x42,
+	     0x82, 0x96, 0x7e, 0xc3, 0x39, 0x11, 0x00, 0xa0, 0x9e, 0x03,
+	     0x00, 0x10, 0x81, 0xa6, 0x99, 0x00, 0x80, 0x12, 0xcc, 0x99,
+	     0x01, 0x0b, 0x91, 0x5b, 0x03, 0x00, 0x8c, 0x27, 0x9e, 0x6b,
+	     0x00, 0x00, 0x34, 0x1b, 0x00, 0x40, 0x83, 0xa7, 0xfa, 0x02,
+	     0x91, 0x01, 0x00, 0xe0, 0x2b, 0xf7, 0x89, 0xac, 0xe4, 0x99,
+	     0x0d, 0x00, 0x00, 0x00, 0x98, 0xae, 0x00, 0x8f, 0xd6, 0x28,
+	     0xc6, 0x9d, 0xe5, 0x9f, 0x66, 0xe0, 0xdd, 0x66, 0x0d, 0x11,
+	     0x36, 0xb4, 0x1f, 0x67, 0x1b, 0xc8, 0x07, 0x5a, 0x0e, 0x2f,
+	     0x90, 0xa1, 0x39, 0xf0, 0x78, 0x8d, 0xa9, 0xb7, 0x48, 0x3b,
+	     0x00, 0x80, 0x89, 0x26, 0x00, 0x20, 0xa1, 0xe8, 0x4e, 0x00,
+	     0x00, 0x00, 0x00, 0xc0, 0x10, 0x1a, 0x0c, 0xe1, 0x86, 0xb2,
+	     0xc8, 0x49, 0x52, 0x93, 0x03, 0x00, 0x9c, 0xbb, 0xa8, 0x95,
+	     0x00, 0x80, 0x91, 0xc3, 0xe6, 0x0b, 0x00, 0x00, 0x00, 0x08,
+	     0x80, 0xe8, 0x7c, 0x46, 0x05, 0x7a, 0xa7, 0x61, 0xc8, 0xdd,
+	     0xf1, 0x9c, 0x09, 0x67, 0xd4, 0xd8, 0x25, 0x0f, 0xfb, 0x63,
+	     0xd4, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	     0xda, 0x30, 0x42, 0x00, 0x00, 0xfb, 0xae, 0x89, 0x86, 0xf8,
+	     0x90, 0x53, 0x93, 0x07, 0x58, 0x5d, 0xae, 0xcb, 0x3e, 0x95,
+	     0x7d, 0x48, 0x58, 0x45, 0x90, 0x63, 0xed, 0xb0, 0xff, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x0e, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x50, 0xfb, 0xb1, 0x49, 0xda, 0xc2, 0x00, 0x00,
+	     0x00, 0x00, 0x07, 0xe1, 0x0d, 0x0c, 0x00, 0x60, 0x3b, 0xb3,
+	     0xa4, 0x00, 0x00, 0x56, 0x66, 0x40, 0xc6, 0x63, 0x14, 0x9c,
+	     0x0e, 0x00, 0x60, 0x0b, 0x12, 0x08, 0xec, 0x65, 0x14, 0x45,
+	     0x00, 0x00, 0x5b, 0x17, 0xe8, 0x0c, 0x00, 0x20, 0x3e, 0x02,
+	     0x00, 0xf0, 0x15, 0x45, 0x56, 0x00, 0x80, 0x50, 0xc0, 0x75,
+	     0xaf, 0xb0, 0x05, 0x00, 0x08, 0x86, 0xd4, 0x08, 0x6c, 0x7c,
+	     0xcb, 0x11, 0xcd, 0x95, 0x76, 0xe4, 0x45, 0xd5, 0xb1, 0x03,
+	     0x00, 0x84, 0x8b, 0x3c, 0x1a, 0x00, 0x80, 0x8c, 0x54, 0xe2,
+	     0x84, 0x9d, 0x47, 0xe2, 0x32, 0xe2, 0x2c, 0x2e, 0xf4, 0x81,
+	     0x1e, 0x3c, 0x00, 0xc0, 0x8f, 0xf0, 0xa0, 0x65, 0x74, 0x09,
+	     0xd6, 0x79, 0xe8, 0x04, 0x88, 0x44, 0x05, 0x00, 0xc0, 0xc6,
+	     0xee, 0xeb, 0xb0, 0x9a, 0x03, 0x00, 0xc4, 0x51, 0x74, 0x62,
+	     0x01, 0x09, 0x00, 0xc0, 0x07, 0x09, 0x00, 0x60, 0x06, 0x59,
+	     0x15, 0x8c, 0x0b, 0x0c, 0x31, 0x10, 0xa4, 0x63, 0x5e, 0x4d,
+	     0x11, 0x00, 0xd0, 0x7c, 0x23, 0x37, 0x00, 0x00, 0x00, 0x00,
+	     0xfc, 0x8d, 0x42, 0x26, 0x7c, 0x32, 0x45, 0x58, 0x65, 0xc1,
+	     0x34, 0x41, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x4b, 0xdc,
+	     0x61, 0x26, 0x87, 0x7c, 0x3b, 0x00, 0x40, 0xe3, 0x5c, 0x5d,
+	     0xe1, 0x25, 0x00, 0x00, 0x00, 0xe0, 0x9c, 0xc0, 0x8a, 0xb8,
+	     0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x20, 0x8a, 0xec, 0x37, 0x5d, 0xb4, 0x00, 0x00,
+	     0x09, 0x22, 0x00, 0x40, 0x2b, 0x06, 0x00, 0xd0, 0x01, 0x04,
+	     0x00, 0xbc, 0x08, 0x01, 0x00, 0x00, 0x00, 0xb6, 0x1f, 0x00,
+	     0x80, 0x8f, 0x55, 0x98, 0x21, 0x38, 0x01, 0x00, 0x64, 0x2e,
+	     0x1b, 0x46, 0xcc, 0xa0, 0x7e, 0x0f, 0x00, 0xc0, 0xd9, 0x01,
+	     0x00, 0x7c, 0x0e, 0x00, 0x00, 0x8b, 0x3b, 0xe8, 0xdc, 0xf8,
+	     0xc2, 0x6d, 0xa4, 0x8d, 0x7b, 0x3f, 0x5e, 0x94, 0x4c, 0x36,
+	     0x00, 0x00, 0x6b, 0x80, 0x9b, 0xc4, 0x9e, 0x96, 0x8c, 0x03,
+	     0x00, 0x58, 0x9e, 0xd4, 0x52, 0xf9, 0x0c, 0x5e, 0x16, 0x00,
+	     0x00, 0x00, 0x80, 0x27, 0x08, 0x7c, 0x00, 0x00, 0x02, 0x07,
+	     0x08, 0x39, 0x00, 0x80, 0xd6, 0x64, 0xcc, 0xf7, 0xde, 0x91,
+	     0xd5, 0xa9, 0x0a, 0x01, 0x00, 0x52, 0x10, 0x76, 0xe1, 0x54,
+	     0x0f, 0xf0, 0xe0, 0x10, 0x01, 0xdb, 0xdc, 0x13, 0x01, 0x00,
+	     0xa6, 0x3a, 0x00, 0xc0, 0x30, 0xb3, 0x96, 0x95, 0x69, 0xd0,
+	     0xa7, 0xfd, 0xf1, 0x1a, 0x86, 0xd5, 0x28, 0x00, 0x40, 0x4b,
+	     0xc7, 0x70, 0xf1, 0x03, 0x8a, 0x20, 0xe2, 0x4f, 0x62, 0x4a,
+	     0x2f, 0xbb, 0x5f, 0x8f, 0x66, 0x61, 0x41, 0x92, 0xf4, 0x01,
+	     0x00, 0xb8, 0x18, 0xc2, 0x74, 0x8c, 0x0a, 0xec, 0x0d, 0x00,
+	     0x80, 0x2e, 0x05, 0x00, 0xb0, 0xfd, 0xd5, 0x5b, 0x00, 0x00,
+	     0x87, 0x1d, 0x00, 0xc0, 0x05, 0x22, 0x10, 0x06, 0x00, 0xb0,
+	     0x87, 0xad, 0xf8, 0x32, 0x00, 0x93, 0x98, 0x00, 0x08, 0x00,
+	     0x20, 0x2e, 0x78, 0x8e, 0x01, 0x00, 0xac, 0x5a, 0x88, 0x7a,
+	     0x9f, 0x0f, 0xe5, 0x00, 0x8b, 0xaa, 0x58, 0x35, 0x7a, 0x03,
+	     0x00, 0x74, 0x26, 0x00, 0x00, 0x48, 0x0a, 0x1f, 0xa3, 0xde,
+	     0x4a, 0xee, 0x02, 0xd1, 0xb2, 0xc5, 0xa9, 0x92, 0x2a, 0x8a,
+	     0xf9, 0xb2, 0x40, 0x03, 0x00, 0xc0, 0xbf, 0x72, 0x59, 0x78,
+	     0x9d, 0xa4, 0x05, 0x13, 0x81, 0x00, 0x00, 0x5e, 0x8f, 0x3c,
+	     0x10, 0x00, 0x00, 0x00, 0x88, 0x72, 0x70, 0xed, 0x6c, 0x1d,
+	     0x98, 0x0b, 0xa2, 0x16, 0x00, 0xc0, 0x62, 0x40, 0x71, 0x03,
+	     0x00, 0x20, 0xfa, 0x42, 0x7a, 0x00, 0x00, 0x16, 0xe4, 0x76,
+	     0x10, 0x06, 0x62, 0xc3, 0xb0, 0x6a, 0xae, 0xd9, 0x16, 0x6c,
+	     0x25, 0x27, 0x5d, 0x87, 0xd6, 0x10, 0x00, 0x30, 0xa4, 0xc0,
+	     0xe3, 0x5c, 0x48, 0x40, 0x65, 0x4b, 0x96, 0x18, 0x25, 0x60,
+	     0xe6, 0x60, 0x02, 0x20, 0x1c, 0xca, 0x00, 0x00, 0xbc, 0x0a,
+	     0x56, 0x44, 0x2e, 0xc1, 0x01, 0x87, 0xab, 0x19, 0x24, 0x01,
+	     0x00, 0x14, 0x2a, 0xf0, 0x95, 0x38, 0x39, 0x00, 0x80, 0x3d,
+	     0xca, 0x99, 0x97, 0x4e, 0x30, 0x3d, 0x01, 0x00, 0x00, 0x00,
+	     0xe2, 0x81, 0xf3, 0x23, 0xbb, 0x6c, 0xee, 0x61, 0xf3, 0x43,
+	     0x3e, 0xe5, 0x8a, 0xb0, 0x27, 0xdb, 0x13, 0xf4, 0x96, 0x17,
+	     0x83, 0xf3, 0x86, 0xb2, 0x31, 0x93, 0x9c, 0xf3, 0x58, 0x10,
+	     0x28, 0x07, 0xd8, 0x94, 0xa9, 0x8b, 0xd4, 0x08, 0x00, 0x50,
+	     0x33, 0xc0, 0x1d, 0xdd, 0x20, 0x00, 0x00, 0xcc, 0x20, 0xdd,
+	     0x72, 0x89, 0xb0, 0x10, 0x39, 0x04, 0x02, 0x00, 0xb6, 0x76,
+	     0xc8, 0xc1, 0x5d, 0x1d, 0x3f, 0x00, 0x00, 0xd0, 0x97, 0x90,
+	     0x19, 0x00, 0x00, 0x34, 0x52, 0x00, 0x80, 0x24, 0xa0, 0xda,
+	     0x65, 0xca, 0xf6, 0x5e, 0x51, 0x55, 0x96, 0x2c, 0xb5, 0x0d,
+	     0xfd, 0x1d, 0x00, 0xc0, 0x08, 0x12, 0xf4, 0xd4, 0x30, 0xd1,
+	     0x34, 0x72, 0x38, 0x1d, 0x08, 0x4e, 0x2b, 0x00, 0x80, 0x27,
+	     0x40, 0x8a, 0x94, 0x65, 0x38, 0xb8, 0x00, 0x00, 0x14, 0x8b,
+	     0x56, 0x14, 0x31, 0x10, 0x1c, 0xa2, 0xaf, 0xa3, 0x6e, 0xdb,
+	     0xb1, 0xa4, 0xf2, 0x7e, 0x29, 0x00, 0x00, 0x00, 0x80, 0x02,
+	     0x0e, 0x00, 0x00, 0x01, 0x51, 0x8c, 0x3d, 0x46, 0x9a, 0x25,
+	     0xe3, 0x93, 0x8e, 0xe3, 0x15, 0x12, 0x7a, 0x82, 0xf3, 0xc9,
+	     0x27, 0x5a, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x89, 0x07, 0x00,
+	     0x00, 0x00, 0x00, 0x27, 0x8a, 0x5f, 0xe9, 0xa8, 0xdc, 0x1b,
+	     0x10, 0x3b, 0x00, 0xc0, 0x06, 0x10, 0xfc, 0xf0, 0x63, 0x40,
+	     0x63, 0xf8, 0xce, 0xee, 0x3e, 0x00, 0x80, 0xed, 0x18, 0x00,
+	     0x00, 0x00, 0x60, 0x2b, 0x5c, 0x15, 0x51, 0x7b, 0x00, 0x00,
+	     0x00, 0x00, 0x80, 0x06, 0x00, 0x40, 0x75, 0xd0, 0x4a, 0xf2,
+	     0xaf, 0x70, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8c,
+	     0xa9, 0x0b, 0x82, 0x17, 0x01, 0x00, 0x04, 0x09, 0x23, 0x22,
+	     0x00, 0x00, 0x00, 0xc0, 0x43, 0x13, 0x00, 0x70, 0x9c, 0xaa,
+	     0x0d, 0x0c, 0x14, 0x01, 0x00, 0xf5, 0x93, 0xb8, 0x18, 0x00,
+	     0xc0, 0x25, 0x05, 0x00, 0x70, 0x7a, 0xc5, 0xd6, 0x34, 0x08,
+	     0xab, 0xbb, 0x2f, 0x09, 0xc1, 0xc0, 0x94, 0x01, 0xad, 0xc2,
+	     0x21, 0x00, 0x00, 0xc2, 0x70, 0xc4, 0x20, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x50, 0x40, 0x34, 0xeb, 0x5d, 0x1a, 0x97, 0x3d,
+	     0x00, 0x00, 0x00, 0xc0, 0x22, 0x90, 0xd1, 0x04, 0x00, 0x20,
+	     0xd6, 0x38, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x9f, 0x9f, 0x56,
+	     0x32, 0x73, 0x78, 0x12, 0x7b, 0x5b, 0xc5, 0x2e, 0x00, 0x00,
+	     0x00, 0x00, 0x35, 0x15, 0x00, 0x80, 0xcb, 0x52, 0xd7, 0x5c,
+	     0x4e, 0x41, 0xf1, 0x54, 0x21, 0xba, 0xcd, 0x0c, 0x15, 0x00,
+	     0x00, 0x00, 0xc0, 0x81, 0xb8, 0xd2, 0x55, 0x01, 0xca, 0x52,
+	     0x93, 0x2a, 0x00, 0x40, 0x3a, 0x22, 0xa0, 0x08, 0x00, 0x18,
+	     0xa5, 0x60, 0x29, 0x79, 0x22, 0x10, 0xa7, 0xe4, 0xa1, 0xc0,
+	     0x80, 0xe9, 0xc1, 0xbf, 0xa8, 0xd1, 0xf1, 0x0b, 0x96, 0x28,
+	     0x21, 0x3a, 0x00, 0x40, 0x3e, 0x0f, 0x00, 0x50, 0x31, 0xaa,
+	     0x9a, 0xfd, 0x00, 0x9c, 0x37, 0x6e, 0xa5, 0x22, 0xcf, 0x85,
+	     0x70, 0x7b, 0x18, 0x51, 0xf0, 0x0c, 0xdc, 0x72, 0x04, 0x09,
+	     0x62, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	const uint8_t *g = hash_g;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x1190cde7), (uint32_t *)h);
+
+	h[0] = h[0] % 24801;
+	h[1] = h[1] % 24801;
+	h[2] = h[2] % 24801;
+	return (_getbits(g, h[0], 15) + _getbits(g, h[1], 15) + _getbits(g, h[2], 15)) % 20000;
+}
+
+void
+hash_prefetch(const void * __restrict key, size_t keylen)
+{
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x1190cde7), (uint32_t *)h);
+
+	h[0] = h[0] % 24801;
+	h[1] = h[1] % 24801;
+	h[2] = h[2] % 24801;
+	__builtin_prefetch(&hash_g[(h[0] * 15) >> 3]);
+	__builtin_prefetch(&hash_g[(h[1] * 15) >> 3]);
+	__builtin_prefetch(&hash_g[(h[2] * 15) >> 3]);
+}
+
+void
+hash_batch(const void * __restrict const *keys, const size_t *keylens,
+	uint32_t *out, size_t n)
+{
+	const uint8_t *g = hash_g;
+	uint16_t hb[8][3];
+
+	for (size_t s = 0; s < n; s += 8) {
+		const size_t nb = n - s < 8 ? n - s : 8;
+		for (size_t j = 0; j < nb; j++) {
+			const void *key = keys[s + j];
+			const size_t keylen = keylens[s + j];
+			uint16_t h[6];
+
+			mi_vector_hash(key, keylen, UINT32_C(0x1190cde7), (uint32_t *)h);
+
+			h[0] = h[0] % 24801;
+			h[1] = h[1] % 24801;
+			h[2] = h[2] % 24801;
+			hb[j][0] = h[0];
+			__builtin_prefetch(&g[(h[0] * 15) >> 3]);
+			hb[j][1] = h[1];
+			__builtin_prefetch(&g[(h[1] * 15) >> 3]);
+			hb[j][2] = h[2];
+			__builtin_prefetch(&g[(h[2] * 15) >> 3]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint16_t *h = hb[j];
+			uint16_t result = (_getbits(g, h[0], 15) + _getbits(g, h[1], 15) + _getbits(g, h[2], 15)) % 20000;
+			out[s + j] = result;
+		}
+	}
+}
@@ -0,0 +1,29599 @@
+/* generated with rurban/nbperf 08a5797 -b _words */
+/* seed[0]: 1676902021, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+
+#ifndef NBPERF_GETBITS
+#define NBPERF_GETBITS
+static inline uint32_t _getbits(const uint8_t *g, uint64_t i, const unsigned bits)
+{
+	uint64_t x;
+	const uint64_t bit = i * bits;
+	memcpy(&x, g + (bit >> 3), sizeof(x));
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	x = __builtin_bswap64(x);
+#endif
+	return (uint32_t)((x >> (bit & 7)) & ((UINT64_C(1) << bits) - 1));
+}
+#endif
+
+const char hash_pool[166012] =
+	"aa"
+	"aaamvo"
+	"aaaoepsaxqker"
+	"aaawkatdsy"
+	"aaazaiwmzo"
+	"aabozllo"
+	"aacwukjxnef"
+	"aafjjxv"
+	"aafkxt"
+	"aafyjfdobuf"
+	"aagbaqo"
+	"aagwgqbdhc"
+	"aahpgumys"
+	"aahqwu"
+	"aajoixnfterwky"
+	"aakgie"
+	"aalazfxybys"
+	"aalqbxuarll"
+	"aamevrbsmiecou"
+	"aanimh"
+	"aarfotdcsb"
+	"aau"
+	"aauljgrerearvd"
+	"aaupkdl"
+	"aavgjlqyprl"
+	"aawplxnsl"
+	"aaxw"
+	"ab"
+	"aba"
+	"abb"
+	"abcroqn"
+	"abcyoudhuyoxv"
+	"abded"
+	"abdpauwxnyjjw"
+	"abdvzz"
+	"abemcsgtsaqf"
+	"abgcyzzmsfaohz"
+	"abgfzpabokt"
+	"abghylkt"
+	"abmtelekzgph"
+	"abnnfppd"
+	"abnznvhmvnpdsm"
+	"abqg"
+	"abrbqe"
+	"abri"
+	"abrsthrindrt"
+	"abrvngkjcvst"
+	"abttuirixp"
+	"abucje"
+	"abvlrapgztar"
+	"abxrbvbhskm"
+	"abzjq"
+	"ac"
+	"aca"
+	"acat"
+	"accdawrk"
+	"acdumcj"
+	"acfctctvvuqq"
+	"acgeshhyiqp"
+	"acgq"
+	"acgsyaenn"
+	"achaergtd"
+	"acjqckgbahcww"
+	"acklttjonmfsqw"
+	"ackosnzmlndp"
+	"aclya"
+	"acndzbghzsnf"
+	"acnjhah"
+	"acq"
+	"acqg"
+	"acqzgdmgrudfev"
+	"acrupnq"
+	"actluu"
+	"actnmsaqlxj"
+	"acurtnbcgiuxz"
+	"acvikspj"
+	"acwmemtmnml"
+	"acwuopbsjrdasc"
+	"acyvmwnl"
+	"ad"
+	"adbb"
+	"adcncxngm"
+	"adcxr"
+	"adfwg"
+	"adgcouasqg"
+	"adgnv"
+	"adgorwmlnymtjv"
+	"adgxbuovjvzrjs"
+	"adhh"
+	"adjgncgej"
+	"adjzjjfcahdzbu"
+	"adkrmjcofnbo"
+	"adkvocwahadyny"
+	"adnldbde"
+	"adoalbcaylnjdp"
+	"adoinuly"
+	"adowolj"
+	"adptyuhmk"
+	"adsetbfuyqmlq"
+	"adsyjfsp"
+	"adu"
+	"aduidlcplhjlw"
+	"advxvdrmq"
+	"advzb"
+	"adwf"
+	"adwfkizxbp"
+	"adzplry"
+	"adzrfo"
+	"aeabb"
+	"aeahcthpdbaspv"
+	"aeahwehgc"
+	"aebqchhcmwqshj"
+	"aec"
+	"aecdpkro"
+	"aeckwcuomuwt"
+	"aedk"
+	"aedygfpc"
+	"aeejqumjzwwp"
+	"aegnwaegqii"
+	"aegttb"
+	"aegxoejdtmmrv"
+	"aejhlhfpfwbweh"
+	"aejijtnvnjlf"
+	"aejzdahwbtl"
+	"aeku"
+	"aeooeu"
+	"aepqhpwunt"
+	"aernwcvnqoqe"
+	"aerwh"
+	"aesv"
+	"aet"
+	"aetazxsti"
+	"aeuemhbrat"
+	"aewcxnpkqffcsc"
+	"aeyida"
+	"aezbgcagmrrp"
+	"af"
+	"afa"
+	"afabswrbr"
+	"afapfsisywdfnf"
+	"afcapeu"
+	"afdajpdgtnfvw"
+	"afdakepdzxw"
+	"afddxironm"
+	"affqgbqdmbu"
+	"afftzswhrkc"
+	"afkomgzyzuuwi"
+	"afli"
+	"afmnbtd"
+	"afngooxtxdncoa"
+	"afnnyjqxaxrb"
+	"afnup"
+	"afoeyyvxslene"
+	"afovbwhaw"
+	"afp"
+	"afpbwckga"
+	"afpnnyablos"
+	"afqo"
+	"afrhifomx"
+	"afryjz"
+	"afu"
+	"afuza"
+	"afwmxu"
+	"afyiwr"
+	"afypvnadao"
+	"afystviiojvx"
+	"afzaozrqjxnd"
+	"agagun"
+	"agb"
+	"agbbgucvne"
+	"agbeeflmdidbw"
+	"agbsnfsithwad"
+	"agbv"
+	"agc"
+	"agcsd"
+	"agdehlqiefh"
+	"agdpcsrr"
+	"ageqe"
+	"aggii"
+	"agillaghnklvt"
+	"agimtxt"
+	"agl"
+	"aglwcuiueqio"
+	"agmgy"
+	"agnqlevdskdkq"
+	"ago"
+	"agplhuovfvrna"
+	"agqmjnishvnq"
+	"agqynkpfvjit"
+	"agsjix"
+	"agtmromi"
+	"agtybphmu"
+	"aguaogtcduseei"
+	"aguic"
+	"aguytjckmbl"
+	"agvqdjegqjuqsr"
+	"agwprdfxkote"
+	"agybygrpdnd"
+	"ah"
+	"ahbhifaktmf"
+	"ahcct"
+	"ahcsdwuzxmetm"
+	"ahduwpxnwat"
+	"ahefdmovzsj"
+	"aheoqxi"
+	"ahewgvpsiufqx"
+	"ahf"
+	"ahfqkurbpmnkzk"
+	"ahhryg"
+	"ahhsabofye"
+	"ahhtnic"
+	"ahlgnmozmmnkn"
+	"ahlykcsbfezz"
+	"ahmadaj"
+	"ahor"
+	"ahpib"
+	"ahrkhwhlmdzr"
+	"ahrycyyg"
+	"ahs"
+	"ahtjsnkbpuhw"
+	"ahvmo"
+	"ahwbwarqo"
+	"ahylzbulai"
+	"ahzhm"
+	"ahzvwxaxic"
+	"ai"
+	"aiabbdwlhf"
+	"aialwmtykvoz"
+	"aiamjyqonb"
+	"aicawrwtslqawy"
+	"aig"
+	"aihaiukqsvfylo"
+	"aihejtm"
+	"aihs"
+	"aij"
+	"aijbmhwsoasy"
+	"aijebj"
+	"aijjdynfcxgv"
+	"aijsj"
+	"aijxwzfpmr"
+	"aikdmo"
+	"ailhkdpxhle"
+	"aingte"
+	"aintnw"
+	"air"
+	"airrvbjwdb"
+	"aitazbtn"
+	"aiuvbj"
+	"aivfpzdv"
+	"aivraamggx"
+	"aivrmjybsv"
+	"aiwco"
+	"aiwtcn"
+	"aixlmqiyyutkb"
+	"aiyzuochuktjgr"
+	"aiz"
+	"aizx"
+	"aj"
+	"ajcebz"
+	"ajexeuma"
+	"ajfujbdn"
+	"ajirnfcltff"
+	"ajj"
+	"ajlw"
+	"ajni"
+	"ajogop"
+	"ajpeg"
+	"ajpkohinytla"
+	"ajpnyfjl"
+	"ajufbpaxc"
+	"ajukmqlxl"
+	"ajusjcrruqqrss"
+	"ajvn"
+	"ajwnad"
+	"ajxfglmqkd"
+	"ajxxmhjpbst"
+	"ajy"
+	"ajykjjue"
+	"ajzkohlbnpfn"
+	"ak"
+	"akbzrbdp"
+	"akcxbwl"
+	"akd"
+	"akdlazy"
+	"akdwgr"
+	"akdxmrlmj"
+	"akefpqxsrzirma"
+	"akfzpgvbi"
+	"akgezjlnha"
+	"akhowmxjnmg"
+	"akjqay"
+	"akkadpkznbkjrm"
+	"aklkzzrtgi"
+	"aklqzw"
+	"aklyfeuf"
+	"akmpovgxd"
+	"akowhnzwlmbv"
+	"akpca"
+	"akpgjhg"
+	"akpwxtipo"
+	"akqwfhfoctaka"
+	"akrjrqaqqwqed"
+	"akroj"
+	"akrupa"
+	"akssyan"
+	"aktpm"
+	"akufanjkxmoxet"
+	"akyaeacuxejm"
+	"akywfelhvsbwzx"
+	"akzcid"
+	"akztebpoapmapf"
+	"al"
+	"aleejapuapcyzs"
+	"alfzrlptvhdikn"
+	"algykc"
+	"alh"
+	"alhwkvvhxdwq"
+	"alipupnolwtat"
+	"alirx"
+	"aliu"
+	"alkndu"
+	"alllruhtbki"
+	"alnncrnou"
+	"alpgzprsmya"
+	"alqlsmfpewpo"
+	"alrokxhurell"
+	"alrpbhdkfvd"
+	"als"
+	"aluqswv"
+	"alv"
+	"alwbqvrib"
+	"alwodnzveidli"
+	"alybopztfvkmwl"
+	"am"
+	"amafiexdione"
+	"amagl"
+	"amdtrjkowurky"
+	"amdxqzu"
+	"amepbcmqers"
+	"amgl"
+	"amglwwmvafic"
+	"amhocvas"
+	"amianjuvwy"
+	"amiwnd"
+	"amjfbefm"
+	"amjr"
+	"amjyxnjsu"
+	"amk"
+	"aml"
+	"amlajk"
+	"amlkgaoelk"
+	"amnd"
+	"amp"
+	"amqumqgepywx"
+	"amtespnycxhrna"
+	"amua"
+	"amuaclj"
+	"amvjbh"
+	"amvuhhqkzczohh"
+	"amw"
+	"amxjh"
+	"amxqtdhni"
+	"amyg"
+	"amyic"
+	"amypheipnls"
+	"an"
+	"anai"
+	"anbvfjavrwpyin"
+	"anemeaieosxx"
+	"anff"
+	"angdqpdmft"
+	"anguwxzlilk"
+	"aninljfxl"
+	"anlfb"
+	"anlvcbtkbgqhf"
+	"anptornqlqtpis"
+	"anpzxxcntx"
+	"anqeya"
+	"anqgigorvtg"
+	"anqw"
+	"anrkwivghygoiv"
+	"ans"
+	"ant"
+	"anuuwxgudkzdw"
+	"anwklkxyn"
+	"anxwedh"
+	"anzigluouypzo"
+	"anzrgxko"
+	"ao"
+	"aoaqfafxmywmkf"
+	"aob"
+	"aobm"
+	"aocbjq"
+	"aocgprkwsyelk"
+	"aofdiebh"
+	"aofeeilsphqi"
+	"aogr"
+	"aohfxjunb"
+	"aohshtvbl"
+	"aoipkjqnskqxv"
+	"aojp"
+	"aojpzddjar"
+	"aokjjy"
+	"aokszgzzmb"
+	"aolgzpjcanya"
+	"aolismvrqhw"
+	"aoluupkbomvtw"
+	"aongrogeaitfe"
+	"aonm"
+	"aoobzdhtvvwy"
+	"aooidxlqowtb"
+	"aopphpcemi"
+	"aoqclsk"
+	"aoqvpwifudrraw"
+	"aordmjaccjfra"
+	"aoreagatoud"
+	"aovjcrmiu"
+	"aovk"
+	"aovoufl"
+	"aovvtczrc"
+	"aovxq"
+	"aox"
+	"aoxkxeye"
+	"aoxxzsgg"
+	"aoyla"
+	"aoymp"
+	"aoz"
+	"aozchu"
+	"ap"
+	"apdbribsdymcir"
+	"apdq"
+	"apdumidzy"
+	"apfpjgsiztsi"
+	"apght"
+	"apijmcafchdgjq"
+	"apjqh"
+	"apmb"
+	"apnbsvx"
+	"apnsa"
+	"apnxqbhntoevwz"
+	"apoagwnopnc"
+	"apoksoahdk"
+	"apoxufrps"
+	"appxvypap"
+	"aprkejwd"
+	"aprrxamsubs"
+	"apszjdhexvgrhi"
+	"aptmbojveltgbm"
+	"aptnbhdxmvrqas"
+	"apuw"
+	"apv"
+	"apvecnkopt"
+	"apwilmyz"
+	"apxvrkgnsi"
+	"apyotdpei"
+	"apzvkshb"
+	"aq"
+	"aqaeyen"
+	"aqaxxjbxfl"
+	"aqbacwwhqor"
+	"aqbj"
+	"aqdayjchue"
+	"aqdekxkzks"
+	"aqdhf"
+	"aqfhlnmxzcdi"
+	"aqftiwbsvmutcd"
+	"aqfuykqjfa"
+	"aqg"
+	"aqgqyaujeajf"
+	"aqiy"
+	"aqjlr"
+	"aqjra"
+	"aqkr"
+	"aql"
+	"aqlduhjid"
+	"aqlhyotznj"
+	"aqlxubdylgq"
+	"aqm"
+	"aqnwqkbt"
+	"aqozrrayhcz"
+	"aqspytz"
+	"aqt"
+	"aqtkglsvjlwg"
+	"aqvpvvskgmdzda"
+	"aqxydxmjjdl"
+	"aqynpq"
+	"aqyom"
+	"aqz"
+	"aqzfqhxs"
+	"aqzite"
+	"ar"
+	"ara"
+	"arcpe"
+	"arcuckn"
+	"ardxeq"
+	"ardzqqnzee"
+	"are"
+	"arghlqfwhnodip"
+	"arhpfrahecaek"
+	"aribks"
+	"arict"
+	"arikk"
+	"arivnzklsg"
+	"arjvyxuecqlsz"
+	"ark"
+	"arkhlu"
+	"arlxkk"
+	"armorcdpej"
+	"armqdlybyplyn"
+	"arms"
+	"arnrjwcdzkwzqo"
+	"arnzzukeimkcc"
+	"arohoeaiy"
+	"arqeqfnk"
+	"arrbknk"
+	"arrdni"
+	"arrtztk"
+	"aru"
+	"arucxbw"
+	"arxcppjvzzmw"
+	"aryswrjcv"
+	"arzbdrgcmfau"
+	"arzhnfvf"
+	"arzuljwsk"
+	"asalrmfafppxfd"
+	"asbeorwhpaatq"
+	"ascmpo"
+	"asdgbs"
+	"asfxudbxe"
+	"asgecyh"
+	"asglzmhxtvfdk"
+	"asgshnvjawpg"
+	"ashlpq"
+	"ashulbmpklnf"
+	"asiozyxlcb"
+	"asiq"
+	"asitgqqvz"
+	"asizstlxnmldg"
+	"asjizgsn"
+	"aslx"
+	"asnhn"
+	"asnjeueyiibnr"
+	"aso"
+	"asp"
+	"asr"
+	"asroqqyd"
+	"assdbsqadkklyr"
+	"asss"
+	"assujmboblyla"
+	"assvf"
+	"asukvsmwgtztm"
+	"asun"
+	"asupfarknyyqhu"
+	"asxbiaro"
+	"asxtnyw"
+	"aszjj"
+	"aszqjyz"
+	"at"
+	"atasxvjfdd"
+	"atbgsbxekj"
+	"atdxmowgxodbg"
+	"atg"
+	"atgflcfwh"
+	"atghmtgzeb"
+	"atgs"
+	"ath"
+	"atij"
+	"atkramwifnwq"
+	"atkwncxsx"
+	"atlzvm"
+	"atmuiszpjkp"
+	"ato"
+	"atrb"
+	"attdvy"
+	"attt"
+	"atuavewemtrsm"
+	"atumme"
+	"atur"
+	"atvaeladu"
+	"atvruu"
+	"atwxgh"
+	"atzyt"
+	"au"
+	"auarghyogn"
+	"auby"
+	"aucfoymvqzjeeq"
+	"auehjyeax"
+	"auemxrdoay"
+	"auepbxwj"
+	"aufjgmihgiwou"
+	"augdbjermtl"
+	"augkpkwxbi"
+	"augpp"
+	"augqmrgdnuuq"
+	"augyhqves"
+	"augyyboevwfgt"
+	"auhr"
+	"aujwepnim"
+	"aulld"
+	"aumywooz"
+	"auomaojqsownim"
+	"auoypcs"
+	"auqrwvdyryab"
+	"aurghovsqy"
+	"aurwo"
+	"ausybq"
+	"autcnzpgn"
+	"autoht"
+	"auvbuykmd"
+	"auvnrkb"
+	"auvwrpfygwjgen"
+	"auyxu"
+	"av"
+	"avap"
+	"avbcyego"
+	"avc"
+	"avcmlnhmcmvwph"
+	"avctrko"
+	"avejfof"
+	"avelskvcusw"
+	"avfgogievupuf"
+	"avhd"
+	"avhks"
+	"avhnhwgots"
+	"avhrnkcn"
+	"aviqn"
+	"avknwpc"
+	"avlbkhyycggr"
+	"avlez"
+	"avlijhsccnty"
+	"avoewxrvewnk"
+	"avpxgzavyb"
+	"avrtcuwxd"
+	"avsmcb"
+	"avsnfa"
+	"avsoi"
+	"avstzwuxnyukeb"
+	"avucflgumvboz"
+	"avvm"
+	"avvrcjnpw"
+	"avytejzij"
+	"avz"
+	"aw"
+	"awadf"
+	"awaenhasdvibam"
+	"awbxrtjoa"
+	"awckekjgfbhfoz"
+	"awdwwfpce"
+	"awelebpxvyz"
+	"awfzwgoeyh"
+	"awktgwbrh"
+	"awmr"
+	"awpceoqjuewew"
+	"awq"
+	"awrlebnfhidt"
+	"awrpp"
+	"awwaipm"
+	"awwbunk"
+	"awwdaxmozk"
+	"awwvjop"
+	"awxjflfkvzcf"
+	"awyyehm"
+	"awzpvraboqxrh"
+	"ax"
+	"axbub"
+	"axcus"
+	"axfpbzmiscjwe"
+	"axgvfbwvwn"
+	"axifhymfsrre"
+	"axirzlmia"
+	"axjovnoynhxcgp"
+	"axjqcyho"
+	"axkyzbvmj"
+	"axmatqc"
+	"axpaljfblns"
+	"axpjimge"
+	"axqclcoujeu"
+	"axqfflmwagnb"
+	"axvbmjcmu"
+	"axxhcrfysw"
+	"axxwaq"
+	"axzhnlgyw"
+	"axznsdejodm"
+	"ay"
+	"ayaguqcyf"
+	"ayardvhgchqlwt"
+	"aybkz"
+	"aybsbwif"
+	"aycixdathok"
+	"ayd"
+	"aydt"
+	"aydvrvlia"
+	"aye"
+	"ayfle"
+	"ayfpvmjju"
+	"ayfyqo"
+	"aygjtv"
+	"aygl"
+	"aygse"
+	"aygvbpwqxto"
+	"ayk"
+	"ayndurltg"
+	"ayqroi"
+	"ayrtxzkgx"
+	"ayurhakpbgm"
+	"ayv"
+	"ayvhf"
+	"ayvidfhrm"
+	"ayvs"
+	"ayvz"
+	"ayxdzd"
+	"ayxkgs"
+	"ayy"
+	"az"
+	"azaeznmkwi"
+	"azbibra"
+	"azdcmxfes"
+	"azdkvwfwudtabt"
+	"azdrbjhmwqmlxq"
+	"azeu"
+	"azgiwdgycss"
+	"azhq"
+	"azhxsnqtjp"
+	"azkewersoh"
+	"azkgkokspcsxyy"
+	"azlldh"
+	"azmbiqx"
+	"aznft"
+	"azojzmhmvgw"
+	"azqzqvhelmnekn"
+	"azsjaleohobshu"
+	"azunqkleaevv"
+	"azuvj"
+	"azuvtvfjghuvki"
+	"azvkpvmmqv"
+	"azzcerqz"
+	"azzeqljhdz"
+	"ba"
+	"baazajzi"
+	"babof"
+	"badoc"
+	"badrq"
+	"baeaifbpywwns"
+	"baediyfxp"
+	"baefi"
+	"baeq"
+	"bagqafqf"
+	"bagufnamedqhln"
+	"bahpxm"
+	"bahqzidllfa"
+	"bahvobkwdidd"
+	"baicsilotqif"
+	"baixrb"
+	"bajgfdbgxfkrlv"
+	"bakpwahrebmdh"
+	"bakvd"
+	"bakxb"
+	"balrxviengxws"
+	"bammvjyqvjhx"
+	"bamudyxdpugduv"
+	"banv"
+	"baotq"
+	"bappr"
+	"bav"
+	"bawvglqhodxlv"
+	"bawzbmwv"
+	"baxmmnvestev"
+	"baymotz"
+	"baziywgorpwxn"
+	"bb"
+	"bbaibijfrptw"
+	"bbaqrzywu"
+	"bbayrlie"
+	"bbbzxvaokcjjn"
+	"bbdkzao"
+	"bbdtbwrrzyp"
+	"bbetmejicwr"
+	"bbglsgkhhpjgy"
+	"bbh"
+	"bbjmzj"
+	"bbrciffax"
+	"bbtbfnuuhcind"
+	"bbtjg"
+	"bbtrkn"
+	"bbuwoojy"
+	"bbvatgkvdogzxw"
+	"bbvkeedqgsf"
+	"bbwoeopqygz"
+	"bbww"
+	"bbxgulxlql"
+	"bbxy"
+	"bbynjbzndb"
+	"bbytzrg"
+	"bc"
+	"bca"
+	"bcbogjbvqrza"
+	"bcbue"
+	"bccuohhjalg"
+	"bcemhv"
+	"bcf"
+	"bcfqaunfrb"
+	"bcfxvjqoqaccu"
+	"bcgejmayphgj"
+	"bcgfmuo"
+	"bckeht"
+	"bckldqjbp"
+	"bclavkpvnjmu"
+	"bcleg"
+	"bclpx"
+	"bcmtpljsczw"
+	"bcnkqlrhjq"
+	"bcnqq"
+	"bcnzjtwyiyy"
+	"bcosnlgqblp"
+	"bcpkhby"
+	"bcpkng"
+	"bcqvvjzlegnf"
+	"bcr"
+	"bcrzqzn"
+	"bcsm"
+	"bcsykbyrcb"
+	"bctpqwmsnvh"
+	"bcuh"
+	"bcvljjb"
+	"bcvqnowfeg"
+	"bcxd"
+	"bczt"
+	"bd"
+	"bdacsmnculmcq"
+	"bdcprnlpdkrvl"
+	"bdfnevzpq"
+	"bdhccb"
+	"bdjilotpkildck"
+	"bdkndvylxuxo"
+	"bdl"
+	"bdlyrtxes"
+	"bdmfyqwxuf"
+	"bdnbkoe"
+	"bdnejntcdrqve"
+	"bdnufpoxdxux"
+	"bdpnc"
+	"bdpybuwwa"
+	"bdrapgoaq"
+	"bdrkkeq"
+	"bdrrborticaxib"
+	"bdseqqylrizsul"
+	"bdtqq"
+	"bdudzrtalhwcap"
+	"bdui"
+	"bdvuvhboykx"
+	"bdw"
+	"bdycki"
+	"bdyzmnp"
+	"be"
+	"beagrthtp"
+	"becmmblivgijmo"
+	"bedwfiaesztb"
+	"beedabmibnzzb"
+	"behahrymnzmlgc"
+	"beilkaiubdvku"
+	"beivnwe"
+	"bekxbx"
+	"belpl"
+	"belw"
+	"bemcinpjdq"
+	"beolqvpzfxf"
+	"beoxxqgo"
+	"bepewpnpjatiru"
+	"bepiorywl"
+	"bepmsur"
+	"beqzxtqbfdr"
+	"berwgeebepz"
+	"besmlmrphhawpr"
+	"bevbeeofe"
+	"bevz"
+	"bewamoowipmcb"
+	"bewwuq"
+	"bexgr"
+	"beyxvt"
+	"bezoe"
+	"bf"
+	"bfasppnandsz"
+	"bfcfvan"
+	"bfdixpxt"
+	"bfex"
+	"bfezpbufygz"
+	"bff"
+	"bffuecdod"
+	"bfgndmggnr"
+	"bfgwpr"
+	"bfirbahyc"
+	"bfkjw"
+	"bfleejld"
+	"bfmoevqtgxr"
+	"bfnotan"
+	"bfocrratxrcfqm"
+	"bfor"
+	"bfqdcut"
+	"bfqgtpjkndqch"
+	"bfqhuvfmvzyji"
+	"bfry"
+	"bfud"
+	"bfudo"
+	"bfuelxdm"
+	"bfulzk"
+	"bfvkfarob"
+	"bfvqoc"
+	"bfx"
+	"bfxojuzxhqu"
+	"bfyavwepuqps"
+	"bfyeovbyiuw"
+	"bfzsfvxobwhfok"
+	"bg"
+	"bgaj"
+	"bgakdggioxxtsd"
+	"bganhvs"
+	"bgaxooeiqvbmtz"
+	"bgc"
+	"bgckovjdh"
+	"bgdfc"
+	"bgdrlzv"
+	"bgh"
+	"bgiuabechv"
+	"bgjingfapqbe"
+	"bgld"
+	"bgmlldvucq"
+	"bgn"
+	"bgnhp"
+	"bgnkeruy"
+	"bgonv"
+	"bgqigoxdfl"
+	"bgqkccdufr"
+	"bgsdzqeklmuyn"
+	"bgtfqtqzskrp"
+	"bgu"
+	"bgvwfdzhllnt"
+	"bgwpygmkjptqi"
+	"bgwzmhj"
+	"bgyojmkonvnszc"
+	"bgzyhxcsvstjpq"
+	"bgzzd"
+	"bh"
+	"bhbidhdvx"
+	"bhcklnltpaetl"
+	"bhcqzspz"
+	"bhdrcxio"
+	"bhezkqganmkla"
+	"bhftwm"
+	"bhfukaju"
+	"bhha"
+	"bhjnmrmwuufq"
+	"bhkdpkcplsk"
+	"bhkmw"
+	"bhmsap"
+	"bhqjgtptbak"
+	"bhrcwalapbux"
+	"bhsfq"
+	"bhswgx"
+	"bhw"
+	"bhwbjuoghpyphf"
+	"bhwdvywdg"
+	"bhwtetktboou"
+	"bhyvanlexudizp"
+	"bhyzesomeviv"
+	"bi"
+	"biamytpegbp"
+	"bic"
+	"bidznmilgb"
+	"bigmtmnhlhcadk"
+	"bikawv"
+	"bimnkx"
+	"bink"
+	"biopdqt"
+	"bip"
+	"biph"
+	"biqakmpoxsdtg"
+	"biqgcz"
+	"biqnbx"
+	"birtinutrik"
+	"bisahszesqkyfq"
+	"biszstem"
+	"bitbidpy"
+	"biteikqwq"
+	"bivh"
+	"bivy"
+	"biycafsmilc"
+	"biygzzsmxiy"
+	"biziirfyc"
+	"bizj"
+	"bizk"
+	"bj"
+	"bja"
+	"bjbfr"
+	"bjbiknmw"
+	"bjceinmzedt"
+	"bjcopoptplk"
+	"bjd"
+	"bjdiiqxrit"
+	"bjeapaqyqb"
+	"bjehuqnch"
+	"bjemyledserxxr"
+	"bjhee"
+	"bjhzcbtyddg"
+	"bjibzwckdwu"
+	"bjidvw"
+	"bjikqaerbgk"
+	"bjjgfr"
+	"bjjljfls"
+	"bjjnikgfcr"
+	"bjkcpopbl"
+	"bjkwytxbasocj"
+	"bjlqgblbuvrr"
+	"bjlwqalwvlt"
+	"bjlyvawtoksa"
+	"bjmneuu"
+	"bjmvo"
+	"bjnnv"
+	"bjnsyaohwlw"
+	"bjouwlztv"
+	"bjpcl"
+	"bjpsj"
+	"bjrpgwvmogoweb"
+	"bjui"
+	"bjupfsqvk"
+	"bjuvzhxdtnti"
+	"bjvw"
+	"bjwemmoe"
+	"bjyblgkf"
+	"bjydptvnpmixkc"
+	"bjztpomavlhpef"
+	"bk"
+	"bka"
+	"bkatjqwtsyubi"
+	"bkbmmvkjqdzzp"
+	"bkbqhnrjrf"
+	"bkbymfdxh"
+	"bkcaozeooam"
+	"bkcfh"
+	"bkdjw"
+	"bkfkbgzynp"
+	"bkfruuncovceme"
+	"bkfrzgevc"
+	"bkgy"
+	"bkhbkldlaxnb"
+	"bkhbwawf"
+	"bkhgsxoqh"
+	"bkhploh"
+	"bkhywfm"
+	"bkldofml"
+	"bklqhjnblz"
+	"bkmvcczanfo"
+	"bknymoxhz"
+	"bko"
+	"bkptozixprdqzv"
+	"bksidfnqja"
+	"bkt"
+	"bkttq"
+	"bkvrwp"
+	"bkvuqethv"
+	"bkxbatuw"
+	"bkxzvsodhvhrpj"
+	"bkyqw"
+	"bkzcu"
+	"bl"
+	"blacbniwpbec"
+	"blathzohqkfnw"
+	"blaxvvpocbww"
+	"bldciboswxjez"
+	"bldmewvggqa"
+	"bldqgafcg"
+	"ble"
+	"blfgcchmrbp"
+	"blfiutoezbuyon"
+	"blhykgcjcfhj"
+	"blijgbdkycir"
+	"bljhuqjysfsjcy"
+	"blkaifdchb"
+	"blkcnjswgc"
+	"blkrddguar"
+	"bllcswqruiw"
+	"blmxe"
+	"blqzpgwnocn"
+	"blrjnjnq"
+	"blstd"
+	"blsz"
+	"bltg"
+	"blvjeisyf"
+	"blx"
+	"blxd"
+	"blydkbgx"
+	"blywjk"
+	"blz"
+	"blzgxrxchhoxy"
+	"bmbbgumfhg"
+	"bmbc"
+	"bmbe"
+	"bmbsrkhll"
+	"bmc"
+	"bmcfywrj"
+	"bmdtcrb"
+	"bmecwmmjs"
+	"bmfvcfpke"
+	"bmfvr"
+	"bmgtfsuj"
+	"bmgxrjbk"
+	"bmmdpbguuf"
+	"bmmnkdgkem"
+	"bmnjbn"
+	"bmnrvkp"
+	"bmob"
+	"bmpgfq"
+	"bmqve"
+	"bmrinfm"
+	"bmrkx"
+	"bmstcbgj"
+	"bmtcr"
+	"bmthbgy"
+	"bmu"
+	"bmucfzasp"
+	"bmulp"
+	"bmwrfvqhqbfbal"
+	"bmwtqi"
+	"bmxaovs"
+	"bmydpgfvtglwhl"
+	"bmyr"
+	"bn"
+	"bnbmofy"
+	"bnbq"
+	"bncgas"
+	"bncmzee"
+	"bncvygl"
+	"bndesm"
+	"bneoivryzmuppu"
+	"bnidrmlvlos"
+	"bniltwvov"
+	"bnim"
+	"bniuiqrby"
+	"bnjvveidsdmjd"
+	"bnleecgutmj"
+	"bnnyruuzyi"
+	"bnoudfoprj"
+	"bnp"
+	"bnppnvvkd"
+	"bnprhihfej"
+	"bnprkgaeppi"
+	"bnrv"
+	"bntiwyeuqpri"
+	"bntqm"
+	"bnuxju"
+	"bnv"
+	"bnvjukcxbhlp"
+	"bnvooodksq"
+	"bnwmpyx"
+	"bnwtdvtvc"
+	"bnx"
+	"bnxilwdggxxbn"
+	"bnxneruekx"
+	"bnyaahtxwg"
+	"bnybhazdp"
+	"bnzdtu"
+	"bnzeafz"
+	"bnzqfijlcvpenf"
+	"bnzvqw"
+	"bo"
+	"boalqokzfwvg"
+	"bobhdqi"
+	"bocymygfiudf"
+	"bodaunvxsvxoo"
+	"bodpdbgihpbl"
+	"bodrrxxlzglhc"
+	"boedwt"
+	"boeouhid"
+	"bofzyeqk"
+	"boge"
+	"boirp"
+	"bondl"
+	"bop"
+	"bopbayniqmdv"
+	"boppn"
+	"bopriurkxmpuqs"
+	"boqylknm"
+	"borpgugei"
+	"borrfniyw"
+	"bort"
+	"boswkzi"
+	"bouilvxgcj"
+	"bovyhbyzoq"
+	"bowlrctnvq"
+	"bowoaswn"
+	"boxg"
+	"bozvgokcfw"
+	"bp"
+	"bpayshhqry"
+	"bpbklkxzuhibbe"
+	"bpbvmdp"
+	"bpbzactoazuhe"
+	"bpczgeqm"
+	"bpekn"
+	"bpetdxjzskgczu"
+	"bpgcvzoed"
+	"bphlu"
+	"bphmydk"
+	"bphuahvytcqi"
+	"bpjl"
+	"bpjypmmjhbemhm"
+	"bpkmrxmgj"
+	"bpkp"
+	"bpkpkmaa"
+	"bpkwnx"
+	"bpleiu"
+	"bpllz"
+	"bpmlmfw"
+	"bpmryoxwqfvo"
+	"bpplest"
+	"bppljhtgdfwnae"
+	"bpqcdquwmzqv"
+	"bpry"
+	"bpscjbdeausjub"
+	"bpsngdhq"
+	"bptp"
+	"bpvdbmxi"
+	"bpveqfrrb"
+	"bpvmwulmqfrxbq"
+	"bpwegk"
+	"bpzdrqwxw"
+	"bpzyeiyrqzsq"
+	"bq"
+	"bqajagvpg"
+	"bqcpfwcorm"
+	"bqerfmrla"
+	"bqevfkoggqit"
+	"bqgqaomgsuaz"
+	"bqgqvovdduz"
+	"bqidkpwattacg"
+	"bqjcohfsssgqj"
+	"bqjvext"
+	"bqk"
+	"bqklohwdpncmpw"
+	"bqn"
+	"bqoqlrdvoc"
+	"bqswkmizufbvbs"
+	"bqtyxkb"
+	"bqublwi"
+	"bqvlndo"
+	"bqwkcyms"
+	"bqx"
+	"bqybp"
+	"bqyjkobjyvkiqg"
+	"bqylqkysligxzj"
+	"bqyxaqbaivrnxd"
+	"br"
+	"braknzs"
+	"brawx"
+	"brcmflxdbx"
+	"brdix"
+	"breiixqbvgcpj"
+	"brgrcng"
+	"brgspcqgohzkqy"
+	"brijzr"
+	"briplk"
+	"brku"
+	"brlnpcajnife"
+	"brm"
+	"brnhbzacnbym"
+	"brnjfpmpzxhqu"
+	"brnqo"
+	"brnxjkxthg"
+	"brpanjsxk"
+	"brq"
+	"brqpaok"
+	"brqxni"
+	"brqy"
+	"brri"
+	"brroodiiollv"
+	"brrsujnjyw"
+	"brrzgyzg"
+	"brujuufxrazwfw"
+	"brulapmotccfa"
+	"brvjkxmuvyfat"
+	"brvk"
+	"brxllokql"
+	"brybhlh"
+	"bryk"
+	"brzkptfim"
+	"brzpf"
+	"bs"
+	"bsarmpmxnk"
+	"bscxd"
+	"bsgngrtxgbcju"
+	"bshf"
+	"bsjmseruly"
+	"bsjugvvpv"
+	"bskjdhuywwak"
+	"bsklnkqsghxa"
+	"bsldo"
+	"bsoyz"
+	"bspwptpdynveo"
+	"bsrk"
+	"bsrvftwaivbi"
+	"bss"
+	"bsuyxkmi"
+	"bswzdd"
+	"bsxpelrcehncu"
+	"bsyg"
+	"bsyllfo"
+	"bszqmktytdwxkw"
+	"bt"
+	"bta"
+	"btahnpwg"
+	"btdz"
+	"btexkfuczdglu"
+	"btflwyoi"
+	"btg"
+	"btgxclatimjn"
+	"btic"
+	"btkjjsud"
+	"btkvavke"
+	"btlsjeiepnuxtv"
+	"btnqvhu"
+	"btntlkfuik"
+	"btnvmdk"
+	"btpyoxapij"
+	"btqcgelwbsg"
+	"btqvtdpugoaulk"
+	"btqxaoty"
+	"btqzabdjbj"
+	"btt"
+	"btwkpci"
+	"btwrkhcwcjk"
+	"btxgedfg"
+	"btyi"
+	"bu"
+	"buamkjcdzqoayr"
+	"bub"
+	"bubmyj"
+	"bucsaosuoyxb"
+	"budlnnaonqopcn"
+	"budlzaiy"
+	"buexxtcoxxh"
+	"bufeyqfhtpkn"
+	"bufuhruvuohba"
+	"buhg"
+	"buiss"
+	"bujawtzosiprvd"
+	"bulsyyfj"
+	"bulyjrrx"
+	"bunsahlbdcpvk"
+	"bunsjnjuqfxfz"
+	"buqsoumtmb"
+	"buqysrjthffszn"
+	"burjcsuovkpmt"
+	"burzepjeumfx"
+	"buspbwq"
+	"buu"
+	"buubydokpgjn"
+	"buvwlareosksoz"
+	"buw"
+	"buwxcwmdmunh"
+	"buyhhgraohnh"
+	"buzi"
+	"buzknnq"
+	"buzwmop"
+	"bv"
+	"bvccao"
+	"bvciydm"
+	"bvdius"
+	"bve"
+	"bvfmnezg"
+	"bvgxgih"
+	"bvhfd"
+	"bvjalthlsf"
+	"bvjvtfvaatocfe"
+	"bvjxdcdptxa"
+	"bvkcsptfvgtkoj"
+	"bvkxorxcyjvd"
+	"bvmns"
+	"bvqiggz"
+	"bvrbrovzbstvlv"
+	"bvrgimeiaem"
+	"bvrngmigzalz"
+	"bvsnbyjwggdht"
+	"bvstyydnsiwfqp"
+	"bvtkhh"
+	"bvtthc"
+	"bvtuby"
+	"bvtwltr"
+	"bvwqkisb"
+	"bvxbvdgxbcur"
+	"bvxmbdyukium"
+	"bvxollyzau"
+	"bvymmidjcyc"
+	"bvywphfved"
+	"bw"
+	"bwaao"
+	"bwcyuhz"
+	"bwdmxeu"
+	"bwgaygrsu"
+	"bwghngvjefe"
+	"bwgkeswgvx"
+	"bwgt"
+	"bwjpnk"
+	"bwlc"
+	"bwmfxqybdceud"
+	"bwnvdlmji"
+	"bwoxzsibfrwn"
+	"bwq"
+	"bwqjwoibz"
+	"bwtcbdrabxjpi"
+	"bwtfvi"
+	"bwtm"
+	"bwtn"
+	"bwtxqht"
+	"bwuxxgzald"
+	"bwwg"
+	"bwwgzbbpsqr"
+	"bwzlfyb"
+	"bwzyrmaghsy"
+	"bx"
+	"bxafvo"
+	"bxcqus"
+	"bxfsykeevdus"
+	"bxhefmozw"
+	"bxifv"
+	"bxioxztoaz"
+	"bxirjstyziom"
+	"bxiygklloyvtm"
+	"bxjkcvwizcdua"
+	"bxmquboivvg"
+	"bxnwugmeryzdn"
+	"bxpa"
+	"bxqwgsvqrlex"
+	"bxranfwgtx"
+	"bxrgqdrmphvux"
+	"bxrjkgxqk"
+	"bxrxzjlr"
+	"bxsgrbddzepfdh"
+	"bxvuah"
+	"bxvv"
+	"bxxytn"
+	"bxyrt"
+	"bxzqnhsylsv"
+	"by"
+	"byae"
+	"byaquao"
+	"bybglejzqxj"
+	"bybs"
+	"bydbb"
+	"bydxzci"
+	"bydzlgr"
+	"byeqgylfxgpjnv"
+	"byfisdtqchqkh"
+	"byfpybjo"
+	"bygbjfwawebp"
+	"byghm"
+	"bygw"
+	"byiau"
+	"byiiou"
+	"byil"
+	"byjgw"
+	"byl"
+	"bymlkpzrll"
+	"bynilhpfmft"
+	"byoduuyho"
+	"bypfaldaunhwvz"
+	"byqfpbexx"
+	"byr"
+	"byrb"
+	"byrmyxhavxz"
+	"byrtcw"
+	"byrvbiarxspngs"
+	"byt"
+	"byuvtzysocdrl"
+	"byuysfpzfyofn"
+	"byzxp"
+	"bz"
+	"bzbyuhgmvymtp"
+	"bze"
+	"bzfizeek"
+	"bzfrhygcdxirc"
+	"bzfxxo"
+	"bzfzngv"
+	"bzgopqatxae"
+	"bzgvucmdvojvq"
+	"bziyt"
+	"bzjo"
+	"bzkgllfpr"
+	"bzlnecjadugakp"
+	"bzmxagrp"
+	"bznvzchok"
+	"bzohr"
+	"bzqpwc"
+	"bzrqbnojmsj"
+	"bzrxiuhn"
+	"bzsl"
+	"bzuirq"
+	"bzurcuuqbei"
+	"bzuxrpet"
+	"bzvxlabphi"
+	"bzxn"
+	"bzzzopegbad"
+	"ca"
+	"caac"
+	"caacl"
+	"caboub"
+	"caclgsg"
+	"caclswcnkcfuxd"
+	"cacwgzrxaheyhz"
+	"cacwtm"
+	"cad"
+	"cadswcmb"
+	"caejgfwepjmgaz"
+	"cag"
+	"caiulajm"
+	"cajjyzwzg"
+	"cajxyydyflfyj"
+	"cakphnle"
+	"camkmjwevrgy"
+	"canjm"
+	"cannmbbh"
+	"catoxoecoc"
+	"caubxs"
+	"cavklyjq"
+	"cawykengteg"
+	"caxtdlyejcqv"
+	"caxw"
+	"caygapafrr"
+	"cazdkrjdqn"
+	"cazkkj"
+	"cb"
+	"cbamxnathi"
+	"cbb"
+	"cbbdpoyou"
+	"cbbkzim"
+	"cbcimmzttw"
+	"cbd"
+	"cbdewm"
+	"cbftptpmuhn"
+	"cbieankxc"
+	"cbierpi"
+	"cbixibqnpd"
+	"cbjuiqgtjog"
+	"cbl"
+	"cblz"
+	"cbmtzepjerjvh"
+	"cbmytwarkkwl"
+	"cbnelzygcoldst"
+	"cbnosxgxw"
+	"cbpcq"
+	"cbpiieerlgd"
+	"cbsfe"
+	"cbtvknedz"
+	"cc"
+	"ccabzpecjo"
+	"ccb"
+	"cceribgnkviv"
+	"ccfax"
+	"cch"
+	"ccjrszvd"
+	"cclovuy"
+	"cclsoineiycz"
+	"ccovmtpevvbjj"
+	"ccqdlscinmanx"
+	"ccqsbogrc"
+	"ccquzjilhevrcv"
+	"ccqzhvooynh"
+	"cctyzbry"
+	"ccub"
+	"ccujdodcuaiop"
+	"ccwfincejrx"
+	"ccwp"
+	"cczbgqcmp"
+	"cczhhuzz"
+	"ccztywjmspbpo"
+	"cd"
+	"cdaaozbyjekjs"
+	"cdaxjhnrqenp"
+	"cdbxl"
+	"cddmhdclba"
+	"cdexkkeamtbt"
+	"cdfox"
+	"cdfsqvtabed"
+	"cdfwo"
+	"cdh"
+	"cdhd"
+	"cdmkac"
+	"cdoeoi"
+	"cdojdmfzeulgz"
+	"cdp"
+	"cdppvbqa"
+	"cdq"
+	"cdqtbaml"
+	"cdr"
+	"cdscfioaooygx"
+	"cdtm"
+	"cdw"
+	"cdwcurjxggijo"
+	"cdynncwnidktih"
+	"cdzjvlksya"
+	"cdzoqsw"
+	"ce"
+	"cebaf"
+	"ceccn"
+	"cecf"
+	"cecqbtbienppi"
+	"cecqdabcftpc"
+	"ceelvcgub"
+	"ceenlhjpgahn"
+	"cefaazsovudw"
+	"ceg"
+	"cegcdnmos"
+	"cehfhrdfqxo"
+	"cejhh"
+	"celvlfzcftxzl"
+	"celzb"
+	"cemfhiynhid"
+	"cenvmfqo"
+	"ceodmnsns"
+	"ceouker"
+	"ceowrcaec"
+	"ceqd"
+	"ceqzyuo"
+	"ceswfzxf"
+	"cetbyqyoyanmst"
+	"ceuk"
+	"ceurtbwesoydbg"
+	"cexj"
+	"cexwtsisteb"
+	"ceynnunxopue"
+	"ceywjntkhauw"
+	"cf"
+	"cfa"
+	"cfajkuriailsof"
+	"cfdejsewkkxn"
+	"cfdnksgml"
+	"cfdyktayxownky"
+	"cffcwj"
+	"cffgpoqihiv"
+	"cfftvqjpqge"
+	"cffysas"
+	"cfgcioz"
+	"cfhbmhxooock"
+	"cfhqais"
+	"cfijkimh"
+	"cfkoyrfwp"
+	"cfkzd"
+	"cflyyibnm"
+	"cfomp"
+	"cfornpqzqny"
+	"cfoy"
+	"cfq"
+	"cfqc"
+	"cfs"
+	"cftndkrmfyid"
+	"cftw"
+	"cfuirjvrro"
+	"cfuvqlokph"
+	"cfvkrxu"
+	"cfvvusuimd"
+	"cg"
+	"cgaiyzhxody"
+	"cgbz"
+	"cgcnsqogkrrh"
+	"cgcqytpodl"
+	"cgea"
+	"cgeddigcpksc"
+	"cgedllcpd"
+	"cgfi"
+	"cgfkg"
+	"cgfnxhbje"
+	"cgfsymxacuyg"
+	"cgftloyznyswv"
+	"cgg"
+	"cgghapkhsen"
+	"cggnwkqmvawo"
+	"cghphvawshuarz"
+	"cgjgfsifews"
+	"cgkg"
+	"cgksengsholrb"
+	"cgmwmdcixid"
+	"cgnhlyumpvq"
+	"cgqwzhfg"
+	"cgrpfki"
+	"cgrvhjoywhtnag"
+	"cgtjgjwrhcbizp"
+	"cgu"
+	"cgvqivimmeojpu"
+	"cgvsbaoy"
+	"cgwmynwsjqvob"
+	"cgwnqhbhiuvxt"
+	"cgxkwbzhvr"
+	"cgxzpczxv"
+	"cgzm"
+	"ch"
+	"charedl"
+	"chaywb"
+	"chcibnvimwpmcu"
+	"chd"
+	"chdguetdosbnq"
+	"cheoen"
+	"cheoghgdpfhmj"
+	"chfcu"
+	"chfd"
+	"chgdhgxigzwlq"
+	"chgegmucbbunzy"
+	"chhchulukdhh"
+	"chhstplthwjrcc"
+	"chigwborxrb"
+	"chkbvfan"
+	"chkiwfnc"
+	"chkmtvvklwv"
+	"chlagxzh"
+	"chnmpftnonhoyq"
+	"chphurkvqadbhp"
+	"chpndyhkg"
+	"chrho"
+	"chshuotvvzpv"
+	"chsysm"
+	"chutzpoecxlthz"
+	"chuuf"
+	"chvptwvnrnsjng"
+	"chvvtn"
+	"chvxavqarck"
+	"chws"
+	"chyffwwvhrci"
+	"chypbwg"
+	"chzds"
+	"ci"
+	"cicaelqcq"
+	"cicyocu"
+	"cidgmeyzbz"
+	"cidiyswwac"
+	"ciemueazx"
+	"ciex"
+	"cigyr"
+	"cih"
+	"cihf"
+	"cikbbauwifb"
+	"cikzouqsvfs"
+	"cilhdvuxli"
+	"cilhlideic"
+	"ciljxeh"
+	"cilkoo"
+	"cimmhft"
+	"cimnkr"
+	"cimptznygkxfh"
+	"cimvrqylou"
+	"cingaxrymqpcm"
+	"cinhht"
+	"cioksxf"
+	"cipvypgyhoy"
+	"cipxmob"
+	"ciqumjm"
+	"cirskala"
+	"cisvoizgfpblk"
+	"cisxtwbl"
+	"cityzo"
+	"civqfanzfqv"
+	"ciwxhvhz"
+	"cizespaj"
+	"cizimjhnftbbxe"
+	"cj"
+	"cjarwvhjj"
+	"cjawvjpdfcozh"
+	"cjbmbxi"
+	"cjbrjtruyszr"
+	"cjeuwnhlelr"
+	"cjfpxnutwwv"
+	"cjhjzicth"
+	"cjiipzrkjonc"
+	"cjjoi"
+	"cjjshlwhe"
+	"cjkcpcfkpt"
+	"cjlamqcnix"
+	"cjlcin"
+	"cjmjkvhsjh"
+	"cjmrnozxxkguz"
+	"cjn"
+	"cjon"
+	"cjpqo"
+	"cjptb"
+	"cjqouezuicsop"
+	"cjqp"
+	"cjqqnuviz"
+	"cjrcwjoittnyg"
+	"cjrtgsoelgs"
+	"cjryigrq"
+	"cjt"
+	"cjtblybcc"
+	"cjvag"
+	"cjvu"
+	"cjwdqvu"
+	"cjwolocpo"
+	"cjxzbuvxtdn"
+	"cjzfeiggm"
+	"ckbobtfejpbsqc"
+	"ckcjkphu"
+	"ckdaz"
+	"ckehlhihqmsba"
+	"ckeyazoj"
+	"ckg"
+	"ckgihagn"
+	"ckiupkpuckck"
+	"ckj"
+	"ckk"
+	"ckklxmafrpg"
+	"cklroc"
+	"ckndwpusb"
+	"ckoz"
+	"ckqhpj"
+	"ckugzfootcvxqj"
+	"ckuivtsqqwxx"
+	"ckv"
+	"ckvaoz"
+	"ckvuzdxiuon"
+	"ckxhxadvok"
+	"ckyl"
+	"ckyxjdocflzv"
+	"cl"
+	"clalwdr"
+	"clateohmqhjb"
+	"clcoxi"
+	"clcvwppwvsngqk"
+	"clgudcnjhm"
+	"clibumypfgctik"
+	"cljjpjm"
+	"clkpbtywcmhfc"
+	"clnvwwnx"
+	"clrfazzubs"
+	"cluyhvieiqlhg"
+	"clwziheiq"
+	"clx"
+	"clxkkfwf"
+	"cly"
+	"clywav"
+	"clzyyt"
+	"cm"
+	"cmagkzhqmdo"
+	"cmbkjwncl"
+	"cmc"
+	"cmcbkcynwodt"
+	"cmcvjg"
+	"cmdbbymka"
+	"cmdnvr"
+	"cmeshjit"
+	"cmica"
+	"cmijnj"
+	"cmjmzjziuzbaoy"
+	"cmkqkz"
+	"cmlwih"
+	"cmoiatqsn"
+	"cmpzu"
+	"cmrolcenjnapcs"
+	"cmrpbbzkr"
+	"cmrtg"
+	"cmt"
+	"cmtdq"
+	"cmu"
+	"cmxwiqzf"
+	"cmxxbmb"
+	"cmzewvsnm"
+	"cn"
+	"cnafbr"
+	"cnatk"
+	"cnauza"
+	"cnbgwomtw"
+	"cnbhqye"
+	"cnbstexpdjjln"
+	"cnbupxuxcozt"
+	"cnbztexpjt"
+	"cnctzgcs"
+	"cneswavlu"
+	"cnfcd"
+	"cnfjnxqm"
+	"cnfkoxin"
+	"cnfksvyk"
+	"cngmaxnnt"
+	"cnh"
+	"cnhljesiur"
+	"cnhwvsoreo"
+	"cnikpetbfoma"
+	"cnixauu"
+	"cnixi"
+	"cnl"
+	"cnlmnxvrshb"
+	"cnn"
+	"cnocfa"
+	"cnoxfcjqmgcgok"
+	"cnpju"
+	"cnrydzwq"
+	"cnsuhe"
+	"cnsv"
+	"cnt"
+	"cntoheaayqjfss"
+	"cnumjam"
+	"cnunupfd"
+	"cnuzqmvxcxgkcc"
+	"cnvy"
+	"cnynwikzuyp"
+	"cnzhgqhgtmff"
+	"cnzm"
+	"cnzofittmhspyh"
+	"cnzvkenfwiezsa"
+	"cnzvnkqrnyb"
+	"co"
+	"cobhdheaztfu"
+	"cobwot"
+	"coenqgzbrxfk"
+	"coesqouc"
+	"cof"
+	"cogevgnhidm"
+	"cogfteofenz"
+	"cohmznmfkoetp"
+	"coihot"
+	"collwds"
+	"colrwxxh"
+	"com"
+	"congccvuikm"
+	"cooanvkk"
+	"copqfployowscu"
+	"coqm"
+	"coraxsh"
+	"cosjtcomi"
+	"cosncqtdot"
+	"cotmfxfenxjh"
+	"covks"
+	"covohqyhjwc"
+	"coygze"
+	"cp"
+	"cpb"
+	"cpbl"
+	"cpbwlm"
+	"cpcwicbdrdyty"
+	"cpdpmqzv"
+	"cpdtmpynkj"
+	"cper"
+	"cpfmcvdaqtpr"
+	"cpfofh"
+	"cpfvepozouix"
+	"cpifdqcalblfta"
+	"cpigr"
+	"cpiwushw"
+	"cpjjupmlrjh"
+	"cpkdbdnsox"
+	"cpkngufmleq"
+	"cpksdkdydr"
+	"cplnbwvys"
+	"cpou"
+	"cppbcjmxkmtin"
+	"cpphyeqxxmvijq"
+	"cppx"
+	"cprfbolfhzye"
+	"cprtmdklzhpvn"
+	"cprtqder"
+	"cpsz"
+	"cptixrudws"
+	"cptqf"
+	"cpu"
+	"cpucrokqzra"
+	"cpvyoxzpdfr"
+	"cpwvd"
+	"cpzju"
+	"cq"
+	"cqcdshjfe"
+	"cqct"
+	"cqdednignw"
+	"cqdhnihim"
+	"cqfedrnac"
+	"cqgdfhfgtz"
+	"cqgfnnrk"
+	"cqhv"
+	"cqihipoqucgfav"
+	"cqkkzluqicr"
+	"cqkp"
+	"cqlfqtv"
+	"cqlplkvjugdbo"
+	"cqmnul"
+	"cqn"
+	"cqnfgaxy"
+	"cqnvjmdbzzx"
+	"cqpbczkgq"
+	"cqpyvskekqwsb"
+	"cqqfdgsee"
+	"cqqshdpjkxlahh"
+	"cqqzqnfys"
+	"cqrigmarili"
+	"cqrsbss"
+	"cqrxfxmycjov"
+	"cqs"
+	"cqtersab"
+	"cqts"
+	"cqv"
+	"cqvffye"
+	"cqvile"
+	"cqvoqvr"
+	"cqvpiypzgf"
+	"cqxtet"
+	"cr"
+	"craxjvtb"
+	"craygznhssjhru"
+	"crc"
+	"crce"
+	"crfqnpvg"
+	"crfrn"
+	"crgqdsrh"
+	"crgwcpbuz"
+	"crhokokxdmbx"
+	"crhuxq"
+	"crkvae"
+	"crmz"
+	"crnzcjqz"
+	"crp"
+	"crpvdgg"
+	"crqeztr"
+	"crqghvw"
+	"crqs"
+	"crroc"
+	"crsdn"
+	"crurlhfsyhnk"
+	"crwfyhmfsnhu"
+	"crwlaukxwgfzql"
+	"crx"
+	"crxf"
+	"crxxwuwpad"
+	"crymv"
+	"cryoce"
+	"crz"
+	"crzbkgvcpbk"
+	"crznlgdj"
+	"cs"
+	"csbrlyo"
+	"csegnvru"
+	"csel"
+	"csevvapey"
+	"csguy"
+	"cshdnqjaq"
+	"cshjuiiqxycgcb"
+	"cslgslcmwms"
+	"csmyyypfvu"
+	"csnlbwc"
+	"csnrqfqi"
+	"cso"
+	"csoz"
+	"csqumtffsk"
+	"csrzsb"
+	"csuid"
+	"csuvyu"
+	"csw"
+	"cswqwqiar"
+	"cswyvjsvplgpqx"
+	"csx"
+	"csxmuzhhpivxhz"
+	"ct"
+	"ctacrlaa"
+	"ctadcvlkmhoqbr"
+	"ctaqvzayvzeofb"
+	"ctawhe"
+	"ctawpozub"
+	"ctb"
+	"ctcnhavvolv"
+	"ctdlufqox"
+	"ctdyaoo"
+	"ctfekhaxnxxgqn"
+	"ctfquo"
+	"ctgchb"
+	"ctiacpyjpjfpjf"
+	"ctiba"
+	"ctihtdeku"
+	"ctkijiddcagup"
+	"ctkmg"
+	"ctkynoiizeaib"
+	"ctliwbqdbqekr"
+	"ctlv"
+	"ctovu"
+	"ctpqksvbg"
+	"ctqivjwxudyhed"
+	"ctqjg"
+	"ctqmfghocglqno"
+	"ctstmimpxbzu"
+	"ctsxq"
+	"ctt"
+	"ctte"
+	"cttgjmken"
+	"cttgurhilcxjcs"
+	"ctwboftrnovhhj"
+	"ctwdwnckcsxgru"
+	"ctx"
+	"ctyrcai"
+	"cu"
+	"cuabqjmjtc"
+	"cuafcu"
+	"cuavdrmqakwtw"
+	"cuay"
+	"cubaa"
+	"cubfmbrq"
+	"cucez"
+	"cudsy"
+	"cufais"
+	"cufpdqbrn"
+	"cufwv"
+	"cugpnayemjzoui"
+	"cuhmivia"
+	"cuhnqgvjpwbm"
+	"cuikfvaziwlhwd"
+	"cuixdpcnlbgx"
+	"cujpbjufwtpf"
+	"cukqebmuphpcvt"
+	"cum"
+	"cumfsibkh"
+	"cumwcolhnkc"
+	"cuopxmlnagf"
+	"cupaornnq"
+	"curkne"
+	"cuschcnq"
+	"cuuw"
+	"cuvmxmi"
+	"cux"
+	"cuxa"
+	"cuy"
+	"cuz"
+	"cuzkttwcjnvir"
+	"cv"
+	"cvacrjwxyd"
+	"cvdqlurb"
+	"cvdto"
+	"cveby"
+	"cvemgivupv"
+	"cvfjx"
+	"cvfrpzykygrxv"
+	"cvgy"
+	"cvhaxwnppww"
+	"cvhmfjewwbny"
+	"cvknts"
+	"cvlrccogtwdoq"
+	"cvmlaqtlg"
+	"cvmps"
+	"cvoafqw"
+	"cvpc"
+	"cvqskzqesgih"
+	"cvr"
+	"cvrxcjnlwryjq"
+	"cvs"
+	"cvsrzjdmwebnh"
+	"cvttegpijsutbq"
+	"cvvgmdjkrdaerl"
+	"cvvif"
+	"cvviwn"
+	"cvvlsjpjog"
+	"cvxwcebg"
+	"cvyqytayfd"
+	"cw"
+	"cwbeemkkzp"
+	"cwbrhihz"
+	"cwdjqqxoiy"
+	"cwdkkhe"
+	"cwenslodjjai"
+	"cwfbdhzpu"
+	"cwfs"
+	"cwgqgpydlzzyf"
+	"cwhtfukfxf"
+	"cwjadkghi"
+	"cwjbdfj"
+	"cwkzdskzfskqk"
+	"cwlagdxjri"
+	"cwlplwxato"
+	"cwlrmgxzd"
+	"cwls"
+	"cwm"
+	"cwmslj"
+	"cwnivgrwaxeg"
+	"cwof"
+	"cwope"
+	"cwrsxzq"
+	"cwsctwfgdigqak"
+	"cwsers"
+	"cwssj"
+	"cwwmo"
+	"cwymbawgl"
+	"cwzawx"
+	"cwziilas"
+	"cx"
+	"cxba"
+	"cxcxeybafmmlz"
+	"cxeeo"
+	"cxehxsbrlabu"
+	"cxflkogcs"
+	"cxg"
+	"cxge"
+	"cxh"
+	"cxhevdl"
+	"cxk"
+	"cxkggfjgqkmjmv"
+	"cxlbouscf"
+	"cxlfrev"
+	"cxlg"
+	"cxmp"
+	"cxmpxqgz"
+	"cxoh"
+	"cxokjkfeg"
+	"cxoqf"
+	"cxpgjyvo"
+	"cxqioqct"
+	"cxqmmggtebue"
+	"cxsnrui"
+	"cxtdujukjrx"
+	"cxtecqij"
+	"cxtqdqnbcocafy"
+	"cxvkazkt"
+	"cxwyg"
+	"cxy"
+	"cxyjyhyx"
+	"cxzdgxxeham"
+	"cxznioncmwpx"
+	"cy"
+	"cybabr"
+	"cyboygbo"
+	"cybsko"
+	"cydstbwzmisowu"
+	"cyet"
+	"cyfkr"
+	"cygbidpq"
+	"cyhdjf"
+	"cyhfa"
+	"cyhymd"
+	"cyjtcqap"
+	"cyktttaixf"
+	"cyluzkjxlhlnyb"
+	"cyookvjkvyqaq"
+	"cyorvktohfq"
+	"cyovrlm"
+	"cyp"
+	"cyr"
+	"cyroaqbxp"
+	"cyrviqqfigd"
+	"cys"
+	"cysnzwigsxdh"
+	"cytbcgsxrjchyv"
+	"cytpkc"
+	"cyvqhygppmyw"
+	"cyxomsnlisver"
+	"cyxpfhbvepfi"
+	"cyybfr"
+	"cyyslc"
+	"cyzqnsqv"
+	"cyzyutkujjvv"
+	"cz"
+	"czcbu"
+	"czccdnvm"
+	"czdcnqdzl"
+	"czdnvn"
+	"czdpqauksnl"
+	"czeddsakobekt"
+	"czevimjehltm"
+	"czg"
+	"czgbhubjz"
+	"czgmqrvgocwvou"
+	"czjhiywymcuax"
+	"czkjrrs"
+	"czkknlmggnfcfv"
+	"cznq"
+	"cznv"
+	"czq"
+	"czqr"
+	"czw"
+	"czxu"
+	"czz"
+	"czzfnaka"
+	"da"
+	"daalqf"
+	"dabzkrqxsqwa"
+	"dadsbagl"
+	"daeba"
+	"dafdbvaxtfn"
+	"dafpwdxqiyoxu"
+	"dafxbi"
+	"dahktuab"
+	"dahs"
+	"dai"
+	"dakagvyuwy"
+	"damfx"
+	"dammzrazzhb"
+	"danyksvhrqhgoo"
+	"daodk"
+	"dapoim"
+	"daqgoiuhxk"
+	"darwwvepgq"
+	"dat"
+	"daua"
+	"dauqa"
+	"dautvqxa"
+	"davvoom"
+	"daxam"
+	"daxuxu"
+	"daydchbwtmcdn"
+	"daydhhenkplyeu"
+	"daygsmgegybbco"
+	"dayxvlwib"
+	"db"
+	"dbacgbgv"
+	"dbaebgewz"
+	"dbaq"
+	"dbbe"
+	"dbcfsifpfaon"
+	"dbchucxuj"
+	"dbedyjzb"
+	"dbhpnyonkq"
+	"dbineldbzmzt"
+	"dbj"
+	"dbnpxwxabp"
+	"dbnuornr"
+	"dbnybkrbdm"
+	"dbodviodv"
+	"dboxsb"
+	"dbpcjblag"
+	"dbplf"
+	"dbpsjrydev"
+	"dbrhjcutjeoqfy"
+	"dbup"
+	"dbvtbysld"
+	"dbwgvdfhfnbhsv"
+	"dbwqeeywrlf"
+	"dbwsnpfgsozvdv"
+	"dbxdmhoxdubn"
+	"dbybrh"
+	"dbz"
+	"dbzcmxceae"
+	"dc"
+	"dcb"
+	"dcbl"
+	"dce"
+	"dcghm"
+	"dcgmdtmnfn"
+	"dcgstwldd"
+	"dchkyzflgshn"
+	"dcidg"
+	"dcmfym"
+	"dcmjoqlpf"
+	"dcnfugnxf"
+	"dcoi"
+	"dcpdqaacxyxcj"
+	"dcpfzaktzlubsj"
+	"dcqxyumfyeeu"
+	"dcr"
+	"dcrvxg"
+	"dcsqfqbof"
+	"dcsstcydfhl"
+	"dcuhaorcgudfu"
+	"dcvllusglmnr"
+	"dcvrakab"
+	"dcxcohmalwd"
+	"dcxgzn"
+	"dcy"
+	"dcybb"
+	"dcydawlist"
+	"dcyzxom"
+	"dd"
+	"ddaahiv"
+	"ddcpcxxlfag"
+	"ddcpv"
+	"dddikl"
+	"dddtygrhbyyaca"
+	"dddzrxmag"
+	"ddek"
+	"ddfsxofjpdey"
+	"ddfxpmy"
+	"ddgluzs"
+	"ddhkutytxpnai"
+	"ddiixeh"
+	"ddiqmpr"
+	"dditqva"
+	"ddlf"
+	"ddlvcs"
+	"ddmew"
+	"ddn"
+	"ddpfghoaecv"
+	"ddrs"
+	"ddvip"
+	"ddvwe"
+	"ddwd"
+	"ddxgvyym"
+	"ddxrtco"
+	"ddxsi"
+	"ddxvndxe"
+	"ddybuodmabs"
+	"ddyjntriiked"
+	"ddyqufzatteiow"
+	"ddyze"
+	"ddzgyqp"
+	"ddzkepuq"
+	"ddzwdfci"
+	"de"
+	"dea"
+	"deb"
+	"debajs"
+	"decqijnjxcygix"
+	"dectwsodwcn"
+	"deebuqixz"
+	"deegvb"
+	"degrjxsmzgfclo"
+	"degrxraewocaal"
+	"degyydul"
+	"dekrztgxeoqidi"
+	"dekuzsor"
+	"delh"
+	"delsc"
+	"den"
+	"denl"
+	"deoeatiqqtkqjw"
+	"deqcesnclyu"
+	"derrdh"
+	"desdlktpne"
+	"desj"
+	"detkaafiksfb"
+	"deul"
+	"deuppy"
+	"devok"
+	"devtrytlednax"
+	"dexnjd"
+	"deyaezbhdprqj"
+	"deyfofa"
+	"df"
+	"dfaddhwkdaasp"
+	"dfaegxgvi"
+	"dfaplztbogzd"
+	"dfblxgyv"
+	"dfcvsjmys"
+	"dfd"
+	"dfdkemfqddqtf"
+	"dfdlhjkxdlgseb"
+	"dffzmwybyhf"
+	"dfimqmsm"
+	"dfiy"
+	"dfj"
+	"dfjkgqxw"
+	"dfjxnqyecqpqc"
+	"dfofmhennjmq"
+	"dfplwututnm"
+	"dfqazqyjrugq"
+	"dfqdpybexfk"
+	"dfqxroxz"
+	"dfsxbz"
+	"dfuaikwpzos"
+	"dfulvndftjr"
+	"dfuxjdxkxwqn"
+	"dfvqujk"
+	"dfwnf"
+	"dfyglqamhyhnr"
+	"dg"
+	"dgaguettvvao"
+	"dgc"
+	"dgcbazapkms"
+	"dgdaxxmnisjsu"
+	"dgdg"
+	"dgdmfiivivdphg"
+	"dgdwusc"
+	"dgebmivntf"
+	"dgesprsgttlem"
+	"dgfobbpeq"
+	"dgfrs"
+	"dgfsl"
+	"dggcvrwiln"
+	"dghnetrywrli"
+	"dgicusqucczgu"
+	"dgiwvhikxaegom"
+	"dgjdul"
+	"dgjhpa"
+	"dgkbplu"
+	"dgm"
+	"dgoay"
+	"dgotz"
+	"dgq"
+	"dgqcowzrrv"
+	"dgrad"
+	"dgryjpknhv"
+	"dgsnlhy"
+	"dgsvnsg"
+	"dgtkphbbrool"
+	"dguwb"
+	"dgvyzokgtwrw"
+	"dgwwc"
+	"dgwzsqf"
+	"dgy"
+	"dgymk"
+	"dh"
+	"dha"
+	"dhafgix"
+	"dhbpshkcs"
+	"dheeqx"
+	"dhegzezntgno"
+	"dhhpxqlmmv"
+	"dhibo"
+	"dhjenqw"
+	"dhldfjum"
+	"dhmwsgtq"
+	"dhoylukozp"
+	"dhqhpmgowre"
+	"dhrlmf"
+	"dhsvopnucakxf"
+	"dhsyqspk"
+	"dhtnkkdcxtfn"
+	"dhuvc"
+	"dhwpm"
+	"dhwqgul"
+	"dhxbjvhocvxc"
+	"dhyfjprnohnw"
+	"dhzyzuir"
+	"di"
+	"diauqcfylaj"
+	"diazq"
+	"diek"
+	"diemgvklt"
+	"dieoazorppo"
+	"diflwceqd"
+	"diglctgsewdof"
+	"digskbcftuk"
+	"dihci"
+	"dihs"
+	"diijpfegi"
+	"dijsktjahafd"
+	"dikg"
+	"dilhixbuxkgy"
+	"dinlpmu"
+	"dinozrmzj"
+	"diothn"
+	"diqohly"
+	"dirxjumtkhk"
+	"dis"
+	"disjepxlhhax"
+	"dita"
+	"ditr"
+	"divhfyvldodkq"
+	"diyfkulhqdap"
+	"diynpkltl"
+	"dizcpu"
+	"dj"
+	"djb"
+	"djbv"
+	"djbyy"
+	"djc"
+	"djcmeq"
+	"djctds"
+	"djebeusawunw"
+	"djfixutqiloz"
+	"djfolnlq"
+	"djgusarfpjoa"
+	"djgxyolhzskkh"
+	"djhadrhxwhh"
+	"djhcoqtwuhr"
+	"djiqsaicbcxen"
+	"djjvjcpu"
+	"djkslibdpmjs"
+	"djkuyk"
+	"djlhcvriyqt"
+	"djmqtroqtccjw"
+	"djms"
+	"djn"
+	"djnqfcxson"
+	"djnwgfq"
+	"djpxhkxwmr"
+	"djqe"
+	"djqfbyiheg"
+	"djrcfywyqeuryu"
+	"djrwjlchidysc"
+	"djshwvsarcj"
+	"djuvanurfr"
+	"djvdpnpmuh"
+	"djygvhlvqmhea"
+	"djyxs"
+	"djyyegdh"
+	"dk"
+	"dkberbo"
+	"dke"
+	"dkewmcdsjh"
+	"dkhapivi"
+	"dkhn"
+	"dkhvuq"
+	"dkizqhvbidcxim"
+	"dkkm"
+	"dklhkk"
+	"dknsotlgkkkrdv"
+	"dknzvzzysm"
+	"dkoab"
+	"dkoby"
+	"dkqfafegxhkgf"
+	"dkrdmlpqflw"
+	"dksamzymjthkp"
+	"dksfwlxp"
+	"dksr"
+	"dksttykfmuc"
+	"dkt"
+	"dkujyjrmlf"
+	"dkvelmpyba"
+	"dkvm"
+	"dkwpusmkrg"
+	"dkxarlnuwwt"
+	"dkxkuuigmsbd"
+	"dkyf"
+	"dkyglmxzkav"
+	"dkyiogxvym"
+	"dkymdgessx"
+	"dl"
+	"dlarpsmf"
+	"dlavlgdorhm"
+	"dlbfqelphm"
+	"dlbnqllfg"
+	"dlbnuc"
+	"dlcme"
+	"dlcy"
+	"dlgkrfcsj"
+	"dlia"
+	"dlj"
+	"dljmscrt"
+	"dljyu"
+	"dlkbkanfdmew"
+	"dlmvvmvom"
+	"dlmwpqkzfo"
+	"dlpywl"
+	"dlq"
+	"dlrtrsof"
+	"dls"
+	"dlswtuhkvog"
+	"dltrkrd"
+	"dltsfu"
+	"dltzswxdtd"
+	"dlvbxk"
+	"dlwkqqsxtyvyif"
+	"dlwxkqojrtt"
+	"dlyi"
+	"dlyiehllfxyddx"
+	"dlzcs"
+	"dlzhrdbp"
+	"dm"
+	"dmanibuqk"
+	"dmbr"
+	"dmewiec"
+	"dmgl"
+	"dmguqpgx"
+	"dmidg"
+	"dmldy"
+	"dmlud"
+	"dmmhpwpkc"
+	"dmmqfespg"
+	"dmmtrwzuhvsbgf"
+	"dmnehlgojsetru"
+	"dmngxfbcxnb"
+	"dmokwfl"
+	"dmpzj"
+	"dmqya"
+	"dmrlvrpyrhcx"
+	"dmunnizly"
+	"dmvetq"
+	"dmzquzfvvminxq"
+	"dmzsfhxiunnsu"
+	"dn"
+	"dnbdfwgr"
+	"dncgduahpcgkg"
+	"dncvbfdqvcg"
+	"dndfatysflbvew"
+	"dndnibekhiavew"
+	"dnejzl"
+	"dnfsqfjjprbcaw"
+	"dnknae"
+	"dnkrvf"
+	"dnl"
+	"dnmxdsaayrtn"
+	"dnntyv"
+	"dnqpchlxxdz"
+	"dnqxqqy"
+	"dnrc"
+	"dnrkcsjbyjev"
+	"dntkfwkheolqwo"
+	"dntrn"
+	"dntwheixh"
+	"dnwqoyagjfz"
+	"dnwyakulbd"
+	"dnxnizid"
+	"dnyek"
+	"dnylmzgbcejih"
+	"dnzypc"
+	"doa"
+	"doblxkive"
+	"dobnmrna"
+	"dodpvpscfe"
+	"dodxvbgzca"
+	"doemmgkkhpom"
+	"doeuxzke"
+	"dog"
+	"dohrv"
+	"doibr"
+	"dojlqg"
+	"dojsu"
+	"dojzcthsgkjan"
+	"doktuzptkd"
+	"dolo"
+	"dophq"
+	"doq"
+	"dordymhp"
+	"dowo"
+	"dowqgsncoevo"
+	"doyj"
+	"doyovw"
+	"dp"
+	"dpcxjsrfjcy"
+	"dpdhgfhcaddww"
+	"dpgankvkmyklza"
+	"dphwhhridll"
+	"dpidbby"
+	"dpifqouie"
+	"dpjssmbeif"
+	"dpjxkwa"
+	"dplqcxfbfdurk"
+	"dpluousdkim"
+	"dpmhhwkse"
+	"dpnmqvsduisfc"
+	"dpnwcbq"
+	"dpo"
+	"dpoebix"
+	"dpptzljwpykx"
+	"dpqkllwaz"
+	"dpqwlgn"
+	"dpsh"
+	"dpstnzcnwhng"
+	"dptlkfufyxbvm"
+	"dpvpoyezgeleej"
+	"dpvxztap"
+	"dpwxxzmso"
+	"dpx"
+	"dpxat"
+	"dpxioppvadygq"
+	"dpxv"
+	"dpyj"
+	"dpyopu"
+	"dq"
+	"dqachzzvctt"
+	"dqaly"
+	"dqas"
+	"dqbxakrci"
+	"dqctc"
+	"dqctkrvrlxht"
+	"dqegwefbvca"
+	"dqgmrscmzzw"
+	"dqgxhkd"
+	"dqjoqgz"
+	"dqkebliu"
+	"dqkglqzhyimvg"
+	"dqkn"
+	"dqldnzglvqv"
+	"dqmaegub"
+	"dqmkemgdcocss"
+	"dqmmnuf"
+	"dqnd"
+	"dqpf"
+	"dqphpcyfjsv"
+	"dqqffl"
+	"dqqpd"
+	"dqqxc"
+	"dqtloijmqvkd"
+	"dqtxishdjeywtn"
+	"dqtxmxctclbfcj"
+	"dqux"
+	"dqwbnifhabcuk"
+	"dqwilegsobvjip"
+	"dqwofwfumsfbo"
+	"dqxfqy"
+	"dqxuenxq"
+	"dqymj"
+	"dr"
+	"draholqktw"
+	"drccyarxv"
+	"dreagxlhhaauge"
+	"drgzas"
+	"drkgmhszjei"
+	"drkiquqkbrghv"
+	"drkxs"
+	"drlizdpdqndqp"
+	"drlqd"
+	"drlxa"
+	"drmmtfgtpbte"
+	"drn"
+	"drnbtg"
+	"drnsmfblsqbdr"
+	"drqjycqchygtyg"
+	"drqmylwj"
+	"drqollsbustn"
+	"drr"
+	"drup"
+	"drvaggoxwxew"
+	"drw"
+	"drwxfwkkcjqvdi"
+	"drycwkffcgix"
+	"ds"
+	"dsahjmt"
+	"dsbgxa"
+	"dsbkwfasofcxdu"
+	"dsdbclgvtptf"
+	"dsgp"
+	"dshnozwezg"
+	"dshyuswe"
+	"dsi"
+	"dsj"
+	"dsjnhh"
+	"dsjxazfpt"
+	"dsk"
+	"dslec"
+	"dsnkbqadrknhwg"
+	"dsnqkcgrv"
+	"dsp"
+	"dspbdj"
+	"dsqyolmyogsy"
+	"dsrhsbgv"
+	"dsrl"
+	"dss"
+	"dst"
+	"dsvifw"
+	"dswtyqzwkndo"
+	"dsy"
+	"dsycsp"
+	"dsziqpidtyakir"
+	"dszqt"
+	"dt"
+	"dtalpunmkvl"
+	"dtarpuo"
+	"dtbfakkqrxtb"
+	"dtdizmgvo"
+	"dtedyoulyli"
+	"dtfbelbwls"
+	"dtfsy"
+	"dtguxrnibxge"
+	"dtkfcwi"
+	"dtmplozxgsnmg"
+	"dtn"
+	"dto"
+	"dtosukeonpfp"
+	"dtpuyyvx"
+	"dtrkx"
+	"dtrugasialuck"
+	"dtrypocpgim"
+	"dtszmcs"
+	"dtuvaexlbch"
+	"dtwokhuk"
+	"dtwq"
+	"dtyngztw"
+	"dtyxy"
+	"dtzkdiceafaw"
+	"du"
+	"duapcoaucad"
+	"duec"
+	"duhaeoja"
+	"duieogek"
+	"dujya"
+	"duktlxme"
+	"dulbvwvvjdtfg"
+	"dumbzxcqtup"
+	"dunfcmna"
+	"dunvtegoc"
+	"dupfawwhudtq"
+	"duqkfwq"
+	"duqzpk"
+	"duroyburah"
+	"dusehgvz"
+	"dusldo"
+	"dusplpm"
+	"dutgvikbquahcd"
+	"dutlbheg"
+	"dutmbkcty"
+	"duttpgtigdvi"
+	"duvyhzcbpbuijk"
+	"duxerbuu"
+	"duxfzaocdjbf"
+	"duy"
+	"duzvbwsmpcedph"
+	"dv"
+	"dvai"
+	"dvaiehorhwcjf"
+	"dvbtgeebtstty"
+	"dvczratuf"
+	"dvdvlzgk"
+	"dvhsg"
+	"dvikl"
+	"dviw"
+	"dvjeiun"
+	"dvjsn"
+	"dvkhhylrbomb"
+	"dvkk"
+	"dvklqa"
+	"dvkodfxsacgik"
+	"dvlzfekybkk"
+	"dvmjqpakt"
+	"dvoabhnzr"
+	"dvoctxinezgil"
+	"dvpxox"
+	"dvq"
+	"dvqex"
+	"dvqng"
+	"dvqxfvvb"
+	"dvrjzc"
+	"dvrnkeazqs"
+	"dvrqcanafayeo"
+	"dvs"
+	"dvtacgqvvlby"
+	"dvtevhwjnn"
+	"dvugzpassnxltm"
+	"dvui"
+	"dvv"
+	"dvyunivud"
+	"dvzlg"
+	"dw"
+	"dwaccshslp"
+	"dwbatksp"
+	"dwbd"
+	"dwbdwbxbtpvord"
+	"dwbpg"
+	"dwbqfdfwuo"
+	"dwd"
+	"dwdgkdiowumrga"
+	"dwdmf"
+	"dwedqrqi"
+	"dwemvj"
+	"dweovqdswlbq"
+	"dwfxxzdy"
+	"dwhok"
+	"dwhp"
+	"dwime"
+	"dwiwm"
+	"dwizjzcljvlk"
+	"dwj"
+	"dwjqroorpvori"
+	"dwjyhxujqzuokc"
+	"dwlj"
+	"dwlkuigqrdg"
+	"dwlnihkaxvop"
+	"dwlo"
+	"dwluhmwnzqtn"
+	"dwmctgx"
+	"dwmohcxx"
+	"dwnksmp"
+	"dwoobub"
+	"dwqsyiicihyohe"
+	"dwsj"
+	"dwskrbhhyzjin"
+	"dwtftsycvmjcd"
+	"dwti"
+	"dwuohdqkppso"
+	"dwxqfsbcqo"
+	"dwzt"
+	"dx"
+	"dxbwl"
+	"dxcto"
+	"dxdcchrjeiznf"
+	"dxdxgzh"
+	"dxercd"
+	"dxewsrjnf"
+	"dxf"
+	"dxfbckln"
+	"dxfpyksbcivy"
+	"dxgj"
+	"dxgwddapi"
+	"dxhxpvu"
+	"dxirldjcce"
+	"dxjebyyeueyo"
+	"dxkxznrm"
+	"dxlfhh"
+	"dxnonbwkyr"
+	"dxnspx"
+	"dxobencpq"
+	"dxpjush"
+	"dxpywlidk"
+	"dxqpccqafnqew"
+	"dxrat"
+	"dxrovhedbi"
+	"dxsxwywtvpksc"
+	"dxtesdle"
+	"dxtyehcnsps"
+	"dxuodmrv"
+	"dxw"
+	"dxwbvpw"
+	"dxxptk"
+	"dxyp"
+	"dy"
+	"dyabokviehr"
+	"dycsfhwunnthx"
+	"dycv"
+	"dyedvkaya"
+	"dyfakhrxju"
+	"dyiphjrg"
+	"dylbegy"
+	"dylwdfuiefwiqc"
+	"dymhwdmat"
+	"dymrlfsiygjhry"
+	"dynomd"
+	"dyoqhjvl"
+	"dypyvkjbbi"
+	"dyqmaqjivoac"
+	"dyty"
+	"dywwo"
+	"dyygttlfnojth"
+	"dyyypg"
+	"dyzomlapyuatx"
+	"dz"
+	"dzbjat"
+	"dzckphjotzswz"
+	"dzdcdoicrjdci"
+	"dzeqviqjo"
+	"dzerbweobtdn"
+	"dzevlrgrcrug"
+	"dzgchqyu"
+	"dzhfgevznor"
+	"dzhz"
+	"dzijaelmg"
+	"dzkeof"
+	"dzmazgmzkloqhz"
+	"dzoeeamfed"
+	"dzogfrbdb"
+	"dzqrmsttold"
+	"dzqyhni"
+	"dztmgefxxle"
+	"dzuzqaw"
+	"dzvoxnsok"
+	"dzvw"
+	"dzwc"
+	"dzwkeci"
+	"dzwpmrtjhzii"
+	"dzwybvx"
+	"dzyipujsq"
+	"dzztilwijlympk"
+	"eaa"
+	"eaaafeam"
+	"eaccfz"
+	"eacodsvf"
+	"eadgzshhapwfb"
+	"eadorv"
+	"eadzqhivjgx"
+	"eaedlprp"
+	"eaedphr"
+	"eafdcox"
+	"eafilesz"
+	"eafingashuekl"
+	"eahakkk"
+	"eaiqjezgcl"
+	"eajktolgty"
+	"eajriebnxt"
+	"eam"
+	"eammxkdo"
+	"eamygiblf"
+	"eaon"
+	"eareq"
+	"earffcuaoe"
+	"earrvoucf"
+	"earukkzzrrce"
+	"easdgxqma"
+	"eatjblybgrc"
+	"eauieizl"
+	"eawbtgjfih"
+	"eawppvwcghdt"
+	"eaxrwvmwm"
+	"eayvqla"
+	"eazj"
+	"eazmfbhfxtki"
+	"eb"
+	"eba"
+	"ebaifjhekqd"
+	"ebcmyosvkkklay"
+	"ebcxoegrf"
+	"ebdwntfkcacc"
+	"ebeuyxzdzenkws"
+	"ebfieuvtsoxfxh"
+	"ebgfjuj"
+	"ebggpsperj"
+	"ebi"
+	"ebicuc"
+	"ebijntcldj"
+	"ebjfv"
+	"eblgfq"
+	"eblp"
+	"ebnrzthwtnhvfe"
+	"ebordmnatgzxyh"
+	"ebqxmuw"
+	"ebr"
+	"ebra"
+	"ebtgki"
+	"ebv"
+	"ebvtf"
+	"ebwwifi"
+	"ebx"
+	"ebxeiy"
+	"ebxo"
+	"ebywteltsowaxi"
+	"ec"
+	"ecbde"
+	"ecedlj"
+	"eceqqjzbekf"
+	"ecfw"
+	"ech"
+	"echghjnqycqluu"
+	"echnvfhrxfyn"
+	"echom"
+	"echsv"
+	"ecigvjelqbf"
+	"ecjegggok"
+	"ecjly"
+	"ecklyflz"
+	"eckyleposrmz"
+	"ecl"
+	"eclmd"
+	"ecmmbbschtz"
+	"ecmtritsbsg"
+	"ecnryuax"
+	"ecobywpnpik"
+	"ecoehbxjlbsco"
+	"ecpqrmmtuxnruq"
+	"ecril"
+	"ectsoktkzmmsu"
+	"ecuxrjeiczrxff"
+	"ecvpkni"
+	"ecw"
+	"ecxdgkoy"
+	"ecyzy"
+	"eczqutmjc"
+	"ed"
+	"edacon"
+	"edauwzo"
+	"edbtr"
+	"edd"
+	"edesytc"
+	"edfvpyd"
+	"edg"
+	"edhgx"
+	"edhhktrrjr"
+	"edibh"
+	"edioawahf"
+	"ediyevs"
+	"edjmejzyvowyp"
+	"edjmqagxj"
+	"edloaurcv"
+	"edqutaajzrnx"
+	"edstccqguqe"
+	"edtpphpxglyxbm"
+	"edudzesduqc"
+	"edwkgtldl"
+	"edwngwfouwevmf"
+	"edwpifbdr"
+	"edwqcpjodamfk"
+	"edxnjx"
+	"edxvkhx"
+	"edyid"
+	"edz"
+	"edzdke"
+	"eeajo"
+	"eebvai"
+	"eebzd"
+	"eecxzh"
+	"eedmqgffhmqq"
+	"eedzvquv"
+	"eeeandjip"
+	"eefkgbgrweoaua"
+	"eefux"
+	"eehmfditkwuh"
+	"eeigbzrosxtf"
+	"eejelt"
+	"eelarxldh"
+	"eelpcul"
+	"eenboqxpqx"
+	"eeoaylkgsbi"
+	"eep"
+	"eescujugdoymnq"
+	"eetwd"
+	"eeuftagv"
+	"eexcnjnwunf"
+	"eexudhk"
+	"eexwqm"
+	"eeyemtowposli"
+	"eeyiotmhvjis"
+	"eeyjyigwibpohu"
+	"ef"
+	"efa"
+	"efammrljsswj"
+	"efaunn"
+	"efbalxsuzwcbde"
+	"efc"
+	"efcnhecjglgdm"
+	"efddvig"
+	"efebp"
+	"efffpnxkf"
+	"effftpusuq"
+	"effqhcdzx"
+	"efglvlrppvfx"
+	"efgtxabeqqp"
+	"efjlnk"
+	"efjxmfej"
+	"efkhridbiosgdd"
+	"efmafaily"
+	"efmilabnedt"
+	"efnkpffcc"
+	"efnobkvzmszrlt"
+	"efpknzyrnvf"
+	"efqebtiswksamw"
+	"efqemp"
+	"efqoj"
+	"efraoybpgmxr"
+	"efrdlxr"
+	"efrnole"
+	"efsih"
+	"eftfsg"
+	"efu"
+	"efvemwteisjk"
+	"efvjpjgbs"
+	"efvlzibujtphxw"
+	"efwqvuhasldchb"
+	"efwvjj"
+	"efzbpj"
+	"eg"
+	"ega"
+	"egadmoba"
+	"egaerhgqln"
+	"egafob"
+	"egbusykrlzggt"
+	"egdfodo"
+	"egedyfrbitaeb"
+	"egfvprrmdk"
+	"eggpoekbbzv"
+	"egidxq"
+	"egk"
+	"eglfn"
+	"eglvfh"
+	"egn"
+	"egnfclbml"
+	"egngenompzu"
+	"egoxvscw"
+	"egpim"
+	"egpinuw"
+	"egpjnftfh"
+	"egqhuec"
+	"egqq"
+	"egujcso"
+	"eguyakek"
+	"egxg"
+	"egym"
+	"egyxmk"
+	"egzyf"
+	"egzyzqgvt"
+	"eh"
+	"ehcglwwowb"
+	"ehcwgxpyvxtw"
+	"ehd"
+	"ehdcsmxsuyb"
+	"ehe"
+	"eherwbtmn"
+	"ehfmshadnvo"
+	"ehhgklgu"
+	"ehikovd"
+	"ehizqpqtsvjae"
+	"ehkmbnx"
+	"ehlnmq"
+	"ehlq"
+	"ehmcivnpv"
+	"ehnzvchijr"
+	"eho"
+	"ehqkdnchdhrxl"
+	"ehqyretxcj"
+	"ehsdrdoavhc"
+	"ehstjmilmwooa"
+	"ehta"
+	"ehtksfwfk"
+	"ehuvzkyzoikgq"
+	"ehvg"
+	"ehvkprhdzrl"
+	"ehvwcwtnrdcqbl"
+	"ehwg"
+	"ehwrwpk"
+	"ehykdqmiv"
+	"ehzhwrlqqasqg"
+	"ei"
+	"eiarkca"
+	"eiavypxdz"
+	"eicq"
+	"eienmxk"
+	"eigqqbuwwaipr"
+	"eihyytpinxf"
+	"eiibaauqu"
+	"eij"
+	"eijqdlxhbdocd"
+	"eiliioq"
+	"eimt"
+	"eiontjjuo"
+	"eioon"
+	"eipqgius"
+	"eiro"
+	"eisryvbxbbusp"
+	"eivbdyfxvbak"
+	"eivbqllrrelubf"
+	"eiw"
+	"eiwedbu"
+	"eiwwazqlnhlw"
+	"eixlcmpaqogxh"
+	"eiylyqxmza"
+	"eiyofmmiwdev"
+	"eiz"
+	"eizvipylu"
+	"eizvrfxqoi"
+	"ej"
+	"ejamsljniy"
+	"ejatb"
+	"ejaums"
+	"ejb"
+	"ejbqqgqxmlio"
+	"ejc"
+	"ejcy"
+	"ejdzekhrcjrjwp"
+	"ejehjmt"
+	"ejekerexdswmp"
+	"ejgczth"
+	"ejhvulqae"
+	"ejicphplxiwpn"
+	"ejjdm"
+	"ejlroujxzb"
+	"ejlwx"
+	"ejnpskgzecacx"
+	"ejo"
+	"ejomxmoxbpjm"
+	"ejpbxbtwyxuocd"
+	"ejqwqvgzfnvb"
+	"ejrdjq"
+	"ejsal"
+	"ejsmros"
+	"ejvalvf"
+	"ejyz"
+	"ek"
+	"ekazsenqnjwq"
+	"ekbtnh"
+	"ekc"
+	"ekcd"
+	"ekcrogrdplbo"
+	"ekculbbumkgenh"
+	"ekdbioxcxijyx"
+	"ekdc"
+	"ekdipll"
+	"ekegp"
+	"ekeyezxjthns"
+	"ekf"
+	"ekfdb"
+	"ekhe"
+	"ekjkddbnzw"
+	"ekjmgk"
+	"ekjrqgxsfgwlw"
+	"ekkwnvw"
+	"eklhfz"
+	"ekmksqyd"
+	"ekpjre"
+	"ekpwqqqz"
+	"ekq"
+	"ekqqpqyakyqju"
+	"ekqxxzpurl"
+	"ekrej"
+	"eksbvru"
+	"ekttfarwdu"
+	"ekuapsmxayhqqp"
+	"ekv"
+	"ekwn"
+	"ekxxrudftwuzp"
+	"ekyrhto"
+	"ekzaj"
+	"ekzgvnig"
+	"el"
+	"elatxhhhvj"
+	"elb"
+	"elbqrlnbzlxa"
+	"elc"
+	"elcfbqwlbc"
+	"elcwaipj"
+	"elczqhoyrwpld"
+	"eldtuuwchkoyi"
+	"eldxzuacqermc"
+	"eldzbubvt"
+	"eleruxxdocxrv"
+	"eley"
+	"elfere"
+	"elgomol"
+	"elifstg"
+	"eliuldbwwumwlp"
+	"eljqhuunsdk"
+	"elkalleq"
+	"elmmbtduow"
+	"elmnsvqgv"
+	"elmym"
+	"eln"
+	"elneaiibisdk"
+	"elnttazy"
+	"elobadpc"
+	"eloiusalha"
+	"elpbgdnejh"
+	"elproupvx"
+	"elrmsw"
+	"elsaovwtt"
+	"eltoojcu"
+	"eltpchglwjkq"
+	"eltvufjcv"
+	"eltxadjmknowtn"
+	"elunde"
+	"elvswpg"
+	"elvtixtmnl"
+	"elwbvyjixjky"
+	"elxu"
+	"ely"
+	"elyudqkdnp"
+	"em"
+	"emahjaqctlv"
+	"emba"
+	"embepkhxifzku"
+	"embrvakuzv"
+	"emctkieh"
+	"emfagrefaivxyv"
+	"emfawdxbb"
+	"emhjltl"
+	"emivr"
+	"emjwipnukscnh"
+	"emjwnr"
+	"emjxzceeil"
+	"emncaknf"
+	"emocuafod"
+	"empodcczesmy"
+	"emqudxkpuao"
+	"emqzhtlrn"
+	"emrv"
+	"emsbmt"
+	"emsdqgd"
+	"emsuvmnbngj"
+	"emtbsgslybuwe"
+	"emuxwpb"
+	"emwdxlcur"
+	"emwpv"
+	"emywoaxqiciz"
+	"emyzxyab"
+	"emzrotpbdnne"
+	"en"
+	"enahhkbo"
+	"enawihme"
+	"enayzhqrqdci"
+	"encxemdnxrgear"
+	"enfqw"
+	"enfure"
+	"enfxrrcv"
+	"engfrlxfx"
+	"enilbnqlwcjxl"
+	"enjty"
+	"enkdxyewku"
+	"enkkcq"
+	"enkqkgibj"
+	"enmfu"
+	"enmmmbry"
+	"enppohqqt"
+	"enppzupyi"
+	"enpuerowwdf"
+	"enqfi"
+	"enqgjcoq"
+	"enqshbqdcxgvxs"
+	"ens"
+	"ensadjrzhzrlo"
+	"entm"
+	"enugneqonhdjnn"
+	"enurhdzgegwlhc"
+	"enuypwya"
+	"env"
+	"enzcewq"
+	"enzeeuj"
+	"eo"
+	"eoasok"
+	"eobbjfyatkaeid"
+	"eobkikuigj"
+	"eobopxskrl"
+	"eobvlnpdwk"
+	"eobxmta"
+	"eodhetcejocgvu"
+	"eogjfhn"
+	"eohd"
+	"eohzhbhcd"
+	"eokav"
+	"eolqilwdifsveu"
+	"eolyim"
+	"eom"
+	"eomjqlttfuwhdy"
+	"eomkhcckb"
+	"eomwvgsoqkdojx"
+	"eonzi"
+	"eoowahw"
+	"eopobttvtomvv"
+	"eoqo"
+	"eorcdjteakhwjs"
+	"eoriczehsifcxr"
+	"eornnutaonzazv"
+	"eotctswdcyfuss"
+	"eoveiubn"
+	"eovrucewk"
+	"eowqyjeg"
+	"eoxiqgicoviy"
+	"eoxlrwvyrhhj"
+	"ep"
+	"epavsvjnpqz"
+	"epd"
+	"epeivjcpetfpy"
+	"epgmhnegk"
+	"epgzt"
+	"ephdujrmkkgxx"
+	"epkjihtae"
+	"epks"
+	"eplelo"
+	"eplx"
+	"epnkckn"
+	"epqmfdtvpum"
+	"epsp"
+	"epts"
+	"epv"
+	"epvfawer"
+	"epwlmzs"
+	"epwyvgnihvdzio"
+	"epx"
+	"epzhzuwwxutcf"
+	"epzjrqoqkfyv"
+	"eq"
+	"eqaamymmu"
+	"eqasi"
+	"eqchdnvbmij"
+	"eqd"
+	"eqe"
+	"eqeeto"
+	"eqeswgjmp"
+	"eqewjjvaqsg"
+	"eqfmhfkr"
+	"eqfxerzo"
+	"eqkceplzhq"
+	"eqkiozgkzszcxq"
+	"eqkoqdkdaouwvb"
+	"eqlktuyaefqpm"
+	"eqm"
+	"eqmaaaq"
+	"eqmnnoptht"
+	"eqo"
+	"eqqq"
+	"eqrmhhpnenpqx"
+	"eqs"
+	"eqtaiizcqcquqt"
+	"eqttgiqtae"
+	"eqw"
+	"eqwsu"
+	"eqyqcrzypdvkvb"
+	"eqz"
+	"eqzxtevgqwe"
+	"er"
+	"erbzwekvxloxg"
+	"erckdxhqtirkl"
+	"erd"
+	"erdgirz"
+	"erdnkbdpfmi"
+	"ereebl"
+	"erekiumhcal"
+	"ereon"
+	"ergijs"
+	"erhcngcphm"
+	"eribneow"
+	"erj"
+	"erlagnpujlzh"
+	"erlegph"
+	"erlodevk"
+	"erotxlxquvx"
+	"erqtxjtgx"
+	"errdyzwwv"
+	"errxloacuw"
+	"ersofphmgok"
+	"ersrgpnoefl"
+	"ersvgpbruzs"
+	"ervepytdbi"
+	"ervsk"
+	"erzldirimxefk"
+	"erzxsd"
+	"es"
+	"esazkgmf"
+	"esbkzmw"
+	"esc"
+	"esdadzctbpsj"
+	"esdmkqnlkit"
+	"eset"
+	"esfo"
+	"esfvqnzejvnbvl"
+	"esgpnovbbw"
+	"eshajsvb"
+	"eshybgz"
+	"esieijhggptofg"
+	"esjrhzr"
+	"eskrssjaxy"
+	"esl"
+	"eslgfffvsgpp"
+	"esmfqredofsbgg"
+	"esnae"
+	"esnewhl"
+	"esnnso"
+	"esohgbxa"
+	"esphv"
+	"esqnzp"
+	"esrptntrtxhks"
+	"esrvhrws"
+	"essgmj"
+	"essjbto"
+	"esulycsz"
+	"esvjmxhatu"
+	"esvqnl"
+	"esxefqcx"
+	"et"
+	"etabnu"
+	"etc"
+	"etdtgjxvyu"
+	"etfekvyhs"
+	"etg"
+	"etimcvstxqpsn"
+	"etjprjwhu"
+	"etljdhmkzff"
+	"etnojtznm"
+	"etpz"
+	"etqbrarth"
+	"etqiyqwg"
+	"etqswjdztha"
+	"etrc"
+	"etrinmxrtqgq"
+	"etru"
+	"etsai"
+	"etsrictzzylnmq"
+	"etsxzpiczaxvj"
+	"ettgiyzucirou"
+	"etuhatou"
+	"etw"
+	"etwxlepuetd"
+	"etxfhgmuu"
+	"etyzucp"
+	"etzojkts"
+	"etzpxuwzjcpztv"
+	"eu"
+	"euaiifxv"
+	"euaqdzkyljvoon"
+	"eucaduuc"
+	"eud"
+	"euex"
+	"eufj"
+	"eufrayvwo"
+	"eufsixopzhfdf"
+	"euftzajenp"
+	"eugoogd"
+	"euirjynoxwrytb"
+	"eujpv"
+	"eul"
+	"eulhcpyh"
+	"eumsxeafj"
+	"eunaxdekxleiw"
+	"eupdekbjkwqn"
+	"euphjigmw"
+	"eupyrbvd"
+	"eurdlsag"
+	"eurufaorrvbym"
+	"eus"
+	"eutzpphyxg"
+	"euurkgjnnnu"
+	"euvfrshgpyfa"
+	"euw"
+	"euwtybljpf"
+	"euxzrokzkkzbcm"
+	"euymzifycyta"
+	"euzdousgcl"
+	"euzjpywyuicdyc"
+	"euzoewehre"
+	"ev"
+	"evavtl"
+	"evcawxdpfri"
+	"evdo"
+	"evdpi"
+	"evdrswfmjvbn"
+	"evkqh"
+	"evlrl"
+	"evlrne"
+	"evndljrtb"
+	"evohjarilf"
+	"evprusklydwc"
+	"evpt"
+	"evqemz"
+	"evqlybuhomsxo"
+	"evrtabnuwsaei"
+	"evrtytmjy"
+	"evtauwm"
+	"evtuejf"
+	"evukvcpchq"
+	"evvvj"
+	"evxxr"
+	"evyqns"
+	"evyrsvvvhv"
+	"evytldrfnop"
+	"evzweomak"
+	"ew"
+	"ewcoxyzgduuwei"
+	"ewdsntga"
+	"ewegflmjru"
+	"ewg"
+	"ewgcwuzekfu"
+	"ewh"
+	"ewhhmno"
+	"ewjhxcxaxh"
+	"ewl"
+	"ewmesx"
+	"ewo"
+	"ewpoac"
+	"ewqoymi"
+	"ewqpqtdyskvxkx"
+	"ewrrq"
+	"ewsixawdzg"
+	"ewsnpinbobmcsc"
+	"ewsqkvdgc"
+	"ewtetrwwinw"
+	"ewthilyxnuqnsb"
+	"ewtt"
+	"ewumvbzymoraeh"
+	"ewuqjyims"
+	"ewwgwhtsy"
+	"ewwwq"
+	"ewxabkbvesso"
+	"ewxvlkciso"
+	"ewywxkyvkjwvv"
+	"ex"
+	"exdx"
+	"exghosjymfte"
+	"exhlz"
+	"exidtzqnkk"
+	"exn"
+	"exosrsikmu"
+	"expyikaat"
+	"exrjd"
+	"extxcrweabyic"
+	"exvempzbhc"
+	"exvwyoullior"
+	"exxphfpu"
+	"exxpliwfjpb"
+	"exxwbiylwisss"
+	"exyma"
+	"exzpk"
+	"ey"
+	"eycacfnxpft"
+	"eycehwszdxluof"
+	"eyck"
+	"eycl"
+	"eycoggnc"
+	"eyegnuo"
+	"eyfjhjogdgzzau"
+	"eyidrzcvk"
+	"eyiufyvcil"
+	"eyjxstyeba"
+	"eylqo"
+	"eyltsmn"
+	"eymgdsdn"
+	"eymxgtsydq"
+	"eynenixhvw"
+	"eynsf"
+	"eyntuqwzdgsxx"
+	"eyo"
+	"eyprnkozfnzvr"
+	"eyrym"
+	"eyugyl"
+	"eyutchrelmuz"
+	"eyuyajvdgqlmw"
+	"eyvdx"
+	"eywbgkygfqav"
+	"eywcscn"
+	"eyxi"
+	"eyxjuy"
+	"eyxxi"
+	"eyxxoyqvbdq"
+	"eyy"
+	"eyyrmpzyhqamz"
+	"eyywdleiq"
+	"eyznctm"
+	"eyzogyqhwghs"
+	"ez"
+	"ezacunodx"
+	"ezaeo"
+	"ezcnwm"
+	"ezd"
+	"ezdluyxcg"
+	"ezegbq"
+	"ezeprhuxnlcm"
+	"ezg"
+	"ezgohejvpz"
+	"ezguzmsonoekj"
+	"ezisaqllco"
+	"ezjp"
+	"ezkdssyycfmlr"
+	"ezkiuie"
+	"ezkooph"
+	"ezlai"
+	"ezlh"
+	"ezmktxabd"
+	"ezmqiix"
+	"ezoepi"
+	"ezqnmaqfc"
+	"ezqpgx"
+	"ezrlavfdo"
+	"ezsvvlfjrckkp"
+	"eztjkvorlipvu"
+	"eztyudgwfzd"
+	"ezvpkrhlbbdfp"
+	"ezwprutatutly"
+	"ezxpvxr"
+	"ezxstvrlew"
+	"ezxuwfqsmbe"
+	"ezxynhjepacbwc"
+	"ezyfmwkhh"
+	"ezzqtwmjl"
+	"ezzugcu"
+	"faaivyhakrdu"
+	"fabsxjlvga"
+	"fabwkh"
+	"faccujdqv"
+	"factyznv"
+	"fagfxuaws"
+	"fagifjjqinnc"
+	"fagtvkkoparb"
+	"fahtbdlnuzwwt"
+	"fai"
+	"faidraovh"
+	"faiqtmpkwq"
+	"fajdrxkdn"
+	"fajobemfsmtew"
+	"fajqfmkjbiel"
+	"fao"
+	"faomb"
+	"faovim"
+	"faowahdr"
+	"faowpmzhz"
+	"fapghqrjqrjvp"
+	"faqio"
+	"faqmclwkp"
+	"faquwwas"
+	"faqxvodprhuzw"
+	"faqyfzr"
+	"farhzcvjua"
+	"farmdtb"
+	"fascpfszfwm"
+	"fasngd"
+	"fatbqfde"
+	"fatglyxnw"
+	"faultmykt"
+	"fausvoet"
+	"fav"
+	"favcnqbs"
+	"fayutpqzn"
+	"fazvogulbpxjrm"
+	"fbayjpfgfc"
+	"fbazazowyhpbt"
+	"fbcfustrns"
+	"fbe"
+	"fbfj"
+	"fbgzp"
+	"fbivooax"
+	"fbkqlsvylxfdht"
+	"fbkwyyoogyw"
+	"fbl"
+	"fbmnfqvjjbxei"
+	"fbmusjuxfiunwl"
+	"fbn"
+	"fbnkd"
+	"fbogm"
+	"fboyra"
+	"fbpftoyrzuc"
+	"fbqggojhpq"
+	"fbqtmjla"
+	"fbqwmdiv"
+	"fbrf"
+	"fbruvamydl"
+	"fbtvyccxg"
+	"fbukgiaaewq"
+	"fbxjejvfoji"
+	"fbynxuw"
+	"fbzrgi"
+	"fbzsauckrzz"
+	"fc"
+	"fcaypz"
+	"fcb"
+	"fcbkzcxgr"
+	"fccknlhscyv"
+	"fcdzbo"
+	"fcfz"
+	"fchsxdhs"
+	"fcj"
+	"fcjndsl"
+	"fckcx"
+	"fckisz"
+	"fcloy"
+	"fcnjccbedefit"
+	"fcpgeayfslh"
+	"fcqjpuuiwzzx"
+	"fcquzdwdeqxay"
+	"fcsdqvsra"
+	"fcsl"
+	"fctm"
+	"fcvigowqahxri"
+	"fcvlnrn"
+	"fcxcajc"
+	"fcxn"
+	"fcycqerhykfthd"
+	"fczjkdxddvc"
+	"fcztlrtde"
+	"fczvpdawev"
+	"fd"
+	"fdahar"
+	"fdbinhpzkow"
+	"fdbu"
+	"fdcnmplzpj"
+	"fdecnzxqxizbsi"
+	"fdemvi"
+	"fdfsdaqhg"
+	"fdhv"
+	"fdibor"
+	"fdiudjcmt"
+	"fdivltusmshdo"
+	"fdiyga"
+	"fdjodoww"
+	"fdkhgqpm"
+	"fdlqt"
+	"fdmp"
+	"fdo"
+	"fdpgatkm"
+	"fdpyyzyai"
+	"fdrgocoy"
+	"fdtnsrmqkknbzb"
+	"fdugkoh"
+	"fdvg"
+	"fdwyopkqpgqe"
+	"fdxmctrhlehnjd"
+	"fdxwouncarl"
+	"fdyhto"
+	"fdyna"
+	"fdzucsmzw"
+	"fdzvucmh"
+	"feayepdwrwuap"
+	"febklm"
+	"fecmohbakmgyf"
+	"feemmni"
+	"fefdukod"
+	"fegdzwbpb"
+	"fehyc"
+	"feil"
+	"feingsxy"
+	"fej"
+	"fejbcgavbn"
+	"fejpftjkqeawui"
+	"fek"
+	"fekvzpwto"
+	"felvvrk"
+	"fem"
+	"feobl"
+	"feozkpfflvakd"
+	"feptbwzlj"
+	"fesvirtupsc"
+	"fevh"
+	"fevr"
+	"fexcyls"
+	"fexjtsfdua"
+	"ff"
+	"ffa"
+	"ffaeicxwuzu"
+	"ffambjhkbbg"
+	"ffaucyw"
+	"ffbfznr"
+	"ffbknvu"
+	"ffdsetzbvfzjvm"
+	"ffdz"
+	"ffel"
+	"fffgvfnboia"
+	"fffilhaaxqcbx"
+	"ffgukijypycfz"
+	"ffjlonn"
+	"ffkxfohjjwksn"
+	"fflfwxy"
+	"ffmwvkgdzib"
+	"ffnfgynzikyv"
+	"ffnhhbfzqz"
+	"ffnyeqvesh"
+	"ffodvqfek"
+	"ffrfe"
+	"ffrkqoflzj"
+	"ffsecirnp"
+	"fftbknm"
+	"fftiepvvvcabs"
+	"fftjau"
+	"ffuvb"
+	"ffvszorl"
+	"ffwlz"
+	"ffzbxwtzs"
+	"ffzvjgkbi"
+	"fg"
+	"fgbqslwmxoh"
+	"fgcqw"
+	"fgdqnhkdah"
+	"fgeeooezdoo"
+	"fgfmcj"
+	"fggrrr"
+	"fggvulz"
+	"fggxgzbpwqrlsf"
+	"fghfqmbihx"
+	"fgiqlkbuh"
+	"fgivoohymtsq"
+	"fgjsr"
+	"fglyjadsqmy"
+	"fgnex"
+	"fgnpxvn"
+	"fgonjvkx"
+	"fgpaacpdscu"
+	"fgpu"
+	"fgpzirfw"
+	"fgqloiyavzpaa"
+	"fgricn"
+	"fgsoexpo"
+	"fgt"
+	"fgtfha"
+	"fgtorhf"
+	"fgufp"
+	"fguuwnha"
+	"fgwb"
+	"fgwst"
+	"fgwueqvlcfj"
+	"fgxyribsoxwyd"
+	"fgxytgbpdobsq"
+	"fgynvlfsaafuoz"
+	"fgzbl"
+	"fgzjnnepp"
+	"fgzubffta"
+	"fh"
+	"fhbdphje"
+	"fhcgioepfnlja"
+	"fhdcfftbjza"
+	"fhdsbyxbhwekv"
+	"fhdvfmccmw"
+	"fhe"
+	"fhecwxi"
+	"fhfmr"
+	"fhfquowse"
+	"fhg"
+	"fhgqv"
+	"fhgvm"
+	"fhgyydczw"
+	"fhhjorsmgowikp"
+	"fhiowazjx"
+	"fhjippt"
+	"fhktcujdwzcs"
+	"fhm"
+	"fhofqjrjvuzqft"
+	"fhoysmgzsklssn"
+	"fhpiuamhzmx"
+	"fhpxguerxfupe"
+	"fhqsc"
+	"fhrytvnwddl"
+	"fhs"
+	"fhsoiqzzozuee"
+	"fhstodagsluu"
+	"fhv"
+	"fhvcxpzjp"
+	"fhxbvaft"
+	"fi"
+	"fiaal"
+	"fiabgo"
+	"fiasbxvezweyqx"
+	"fibaurolv"
+	"ficqfvvqlvs"
+	"ficrppmy"
+	"ficszthr"
+	"fidc"
+	"fidyyadi"
+	"fiehtuzxhh"
+	"fig"
+	"figxvepsjznmg"
+	"fihrnmfemsko"
+	"fik"
+	"fil"
+	"fimtplreufh"
+	"finycfimuad"
+	"finyydjxzpscgw"
+	"fioauhqwdpq"
+	"fipp"
+	"fiqxlllym"
+	"fismbxkhvla"
+	"fiulbyzjgmuuc"
+	"fivrhowneyfsz"
+	"fiwsfadagnpur"
+	"fj"
+	"fjbzoyov"
+	"fjc"
+	"fjcif"
+	"fjdmz"
+	"fjdxb"
+	"fjevwkyvaoof"
+	"fjhxyohg"
+	"fji"
+	"fjkuro"
+	"fjljkekgoc"
+	"fjlun"
+	"fjmbwpij"
+	"fjmfot"
+	"fjmgpcappowsu"
+	"fjmmstucuiff"
+	"fjmnjnniugr"
+	"fjrafjot"
+	"fjrqiahcqyypl"
+	"fjrrq"
+	"fjsd"
+	"fjtfflknvzzlu"
+	"fjthcmxkufjlki"
+	"fjudtfj"
+	"fjutduocy"
+	"fjvotlozuauj"
+	"fjxd"
+	"fjxukezgivbq"
+	"fk"
+	"fka"
+	"fkaml"
+	"fkaot"
+	"fkbhcjrdppl"
+	"fkbzvklsyp"
+	"fkcq"
+	"fkczzmieujrra"
+	"fkd"
+	"fkdxs"
+	"fkdyp"
+	"fkef"
+	"fkhog"
+	"fkhxahsdrie"
+	"fkicop"
+	"fkifmsmvkbbwjp"
+	"fkiujtr"
+	"fkj"
+	"fkjfvm"
+	"fkjjcr"
+	"fkjrxgkbcmqknk"
+	"fkkmxho"
+	"fkkplbhqxw"
+	"fklchrfdez"
+	"fkmgxdk"
+	"fkmoo"
+	"fkndh"
+	"fknhh"
+	"fknxspyx"
+	"fkoavuepzmgvi"
+	"fkofwxtei"
+	"fkokauo"
+	"fkouiwrbknqsb"
+	"fkp"
+	"fkqaholn"
+	"fksdk"
+	"fktinmsahh"
+	"fkuusq"
+	"fkveamsiiugsyj"
+	"fkvqg"
+	"fkw"
+	"fkxmxdtgt"
+	"fkydcd"
+	"fkyerhmn"
+	"fkylytkxmliga"
+	"fkz"
+	"fkzejeb"
+	"fkzgt"
+	"flcxownsfyapgb"
+	"fldqigzjl"
+	"fldsibhh"
+	"flg"
+	"flgzbls"
+	"flhrgarrr"
+	"flifbcgnfpuv"
+	"flijxmishwhf"
+	"flj"
+	"flji"
+	"fljlwh"
+	"fljx"
+	"flksgxrgpbplx"
+	"fllux"
+	"flm"
+	"flmofxf"
+	"flnyhvgaolqszb"
+	"floanrdszs"
+	"floj"
+	"flox"
+	"flq"
+	"flqou"
+	"flqutqgr"
+	"flrtq"
+	"fls"
+	"fltexh"
+	"fltmdrkbvl"
+	"fltsmoq"
+	"flvfkjpmuej"
+	"flwsr"
+	"flwsvjcrjbbakh"
+	"flxqkyjcbs"
+	"fm"
+	"fmbmxashwx"
+	"fmbsm"
+	"fmbwecjnfhmbk"
+	"fmdb"
+	"fmeen"
+	"fmetuslyjsktne"
+	"fmffq"
+	"fmfvsutghdiz"
+	"fmilnqanksf"
+	"fmirun"
+	"fmjyvxuhkcyt"
+	"fmkmuuqvhjntr"
+	"fmllyjigzldlt"
+	"fmmaag"
+	"fmmmjljcbdv"
+	"fmnfw"
+	"fmof"
+	"fmrlce"
+	"fmrmsuolfsq"
+	"fmrvdwbb"
+	"fmrxnzesqf"
+	"fmsc"
+	"fmtmofxvq"
+	"fmtu"
+	"fmvhfpfhnrm"
+	"fmwhdhkkvhzv"
+	"fmwjjjadhfkjh"
+	"fmwopknu"
+	"fmwotyiz"
+	"fmwuetndsvdu"
+	"fmyccxmmn"
+	"fnaehhtx"
+	"fnbnx"
+	"fnbtltf"
+	"fnd"
+	"fnevstsf"
+	"fnfqoc"
+	"fnfrqyqx"
+	"fngnkggmyf"
+	"fngscwrqdwt"
+	"fnhkzzjecwxxyw"
+	"fnhowncsctfe"
+	"fnidmqxoygrppx"
+	"fniflqplqrwa"
+	"fnjwvwigf"
+	"fnlgl"
+	"fnngfqqnntzjs"
+	"fnntgetnvbiqh"
+	"fnp"
+	"fnqsvlvjs"
+	"fnrgva"
+	"fnsihyxs"
+	"fnwmvzxlnqaxe"
+	"fnxrq"
+	"fnxrr"
+	"fnxwiqafstc"
+	"fnzcohmbuig"
+	"fnzdxawfpzg"
+	"fo"
+	"foagmj"
+	"foancllpwpt"
+	"foarnn"
+	"fob"
+	"foblhln"
+	"focednfsz"
+	"fociejyyewtup"
+	"focorn"
+	"fodqvcvcwgkq"
+	"foeeiqmwcqdcw"
+	"foezzqgigatk"
+	"foff"
+	"foixxwluz"
+	"fojbmytwjff"
+	"fokjbtpowmcpv"
+	"fokqbnuhhvm"
+	"fokxf"
+	"folmekydqzmf"
+	"fomluz"
+	"foozmf"
+	"foqpbjzpd"
+	"forgedkvv"
+	"fotfe"
+	"fougpubqvbjo"
+	"foyziljjcw"
+	"fozmdidzrvbyz"
+	"fp"
+	"fpabaqiaxbuqgz"
+	"fpbggtmxpkw"
+	"fpbpdvrseeocuv"
+	"fpe"
+	"fpfqi"
+	"fpfwk"
+	"fpfymkxuwzfs"
+	"fpghnd"
+	"fph"
+	"fpi"
+	"fpifmyp"
+	"fpjfag"
+	"fpjxsqaopvtcvc"
+	"fpl"
+	"fpmnyfn"
+	"fpngjubgwjg"
+	"fpoe"
+	"fpouqshifjhui"
+	"fpox"
+	"fpplpkfmm"
+	"fpqkiwadiigw"
+	"fpqwl"
+	"fprumlfwupqu"
+	"fpsklm"
+	"fpspj"
+	"fpsxosgzqjjo"
+	"fpukdfmbzouzyo"
+	"fpulczwo"
+	"fpuzpktkj"
+	"fpw"
+	"fpxmgxrkh"
+	"fpyezzgnl"
+	"fpzbyxywl"
+	"fpzitkwh"
+	"fpzxubgkzmahf"
+	"fq"
+	"fqary"
+	"fqbakdpqunooxs"
+	"fqbdcibei"
+	"fqcmlk"
+	"fqegxaeg"
+	"fqeldrmmbzor"
+	"fqgbtsq"
+	"fqgyyifyfqqzca"
+	"fqhwjgdvo"
+	"fqinx"
+	"fql"
+	"fqlkvorkvhk"
+	"fqlwd"
+	"fqmfchalw"
+	"fqqyhizlyer"
+	"fqrwpmrtmsux"
+	"fqsoknawceq"
+	"fqtwvk"
+	"fqubbrul"
+	"fqufnwrnnzrfq"
+	"fquutf"
+	"fqvvrmqaazp"
+	"fqxcrk"
+	"fqy"
+	"fr"
+	"frahiciimn"
+	"fraqq"
+	"fratfbsb"
+	"frdngj"
+	"fregomtlqwop"
+	"frevddg"
+	"frf"
+	"frg"
+	"frgi"
+	"frhgacsphdkal"
+	"fricjsjqyveftn"
+	"frimegib"
+	"friucfbry"
+	"frlidub"
+	"frlkz"
+	"frlviweznxgue"
+	"frnqnzaabjayox"
+	"frnti"
+	"frnwquunb"
+	"froujr"
+	"frrbiajcxaojtd"
+	"frrfsis"
+	"frsj"
+	"frsr"
+	"frtiitaeasupc"
+	"frtzyn"
+	"frv"
+	"frvmxxrrkmm"
+	"frxcuzwjvpynm"
+	"frxjgni"
+	"fryentxtc"
+	"frygb"
+	"frymptizyr"
+	"frzssdszjnl"
+	"frzt"
+	"fs"
+	"fsawhhush"
+	"fsblmkibw"
+	"fsbmi"
+	"fsd"
+	"fsenzj"
+	"fsfauacdq"
+	"fsfujnqhgewxi"
+	"fsgskmi"
+	"fsiaigwvdpb"
+	"fskbehk"
+	"fskcsajdibhhpf"
+	"fslget"
+	"fsmwk"
+	"fspcsrkl"
+	"fsppjmkpz"
+	"fspvfskua"
+	"fssgmaqg"
+	"fstarlmlbxcqiw"
+	"fsvbtrefb"
+	"fsvepkhhnwgk"
+	"fsvlkiqdw"
+	"fswd"
+	"fswftuhsov"
+	"fsxdz"
+	"fsyhbyohpuef"
+	"fszjfnzeibn"
+	"ft"
+	"ftahttkclo"
+	"ftaye"
+	"ftbyxafixnzap"
+	"ftc"
+	"ftdrjzolrkchyb"
+	"ftfpj"
+	"ftftbxcqespf"
+	"ftiexxvozsfzu"
+	"ftilt"
+	"ftjc"
+	"ftjiyikimssq"
+	"ftjjis"
+	"ftjxfpdhffizsl"
+	"ftkwhrspmzsqy"
+	"ftmd"
+	"ftnadi"
+	"ftnvqgrnybje"
+	"ftoc"
+	"ftpbsuhpgzcif"
+	"ftpi"
+	"ftpojgoe"
+	"ftpvmtrznslvx"
+	"ftqlalnjyxsoli"
+	"ftraodaoxhxfhc"
+	"ftsxbmjbmiadx"
+	"ftvjt"
+	"ftwg"
+	"ftwxnzdfdmgdsn"
+	"ftwzdptejybj"
+	"ftzcozrkbhv"
+	"fu"
+	"fuan"
+	"fubedkshfuhs"
+	"fucgbfwuxm"
+	"fuckbedmx"
+	"fucle"
+	"fuclyrjutsxh"
+	"fucnwggnrojl"
+	"fuejvhvxdjaqnh"
+	"fufx"
+	"fufztpcqo"
+	"fuhap"
+	"fuhjtzrbbm"
+	"fui"
+	"fuitwiaczvvm"
+	"fuk"
+	"fulqhkthhuywgj"
+	"fum"
+	"fumcpswklsb"
+	"fuogsxz"
+	"fupogq"
+	"fuqbg"
+	"furlzm"
+	"futqupclxtdmc"
+	"fuuoauumpl"
+	"fuyiycgacxqwf"
+	"fuzbat"
+	"fv"
+	"fvbobgeyyobxeu"
+	"fvcnybit"
+	"fvduqw"
+	"fveiupdspiefa"
+	"fveom"
+	"fveou"
+	"fvfeyq"
+	"fvflhqaxxt"
+	"fvguaoxu"
+	"fvmdfvhwpvs"
+	"fvmifyyds"
+	"fvoplhrcupepnq"
+	"fvpkaxkvkjvum"
+	"fvqrs"
+	"fvucyizt"
+	"fvumiub"
+	"fvvtzweqweoft"
+	"fvxv"
+	"fvxzxuyecekeau"
+	"fvya"
+	"fvysfngk"
+	"fvzh"
+	"fw"
+	"fwajh"
+	"fwamtt"
+	"fweaqk"
+	"fwetr"
+	"fwfhp"
+	"fwfvdrmzg"
+	"fwigjo"
+	"fwixf"
+	"fwkcej"
+	"fwkulwb"
+	"fwn"
+	"fwng"
+	"fwnm"
+	"fwoaeao"
+	"fwpmmxni"
+	"fwpwdphfmmgd"
+	"fwrrewcwgskksc"
+	"fwrztyqqc"
+	"fwshotrrsgriku"
+	"fwsppwuwtqy"
+	"fwsrjvfhbrux"
+	"fwstmsjpb"
+	"fwtavshqda"
+	"fwtibltbdzhp"
+	"fwtphgpuviq"
+	"fwu"
+	"fwuorfcjp"
+	"fwupstu"
+	"fww"
+	"fwwacml"
+	"fwwbvcfjjllupi"
+	"fwypcmypkpd"
+	"fwzhqrxdc"
+	"fwziixbh"
+	"fwzk"
+	"fwzwyuicdvpkb"
+	"fxazwqhiersikk"
+	"fxbiexnby"
+	"fxbly"
+	"fxd"
+	"fxdnm"
+	"fxeanhlmgqs"
+	"fxemtnjke"
+	"fxerrgqpyyrny"
+	"fxfbzdwnqdvgyt"
+	"fxfsjyaljta"
+	"fxfu"
+	"fxhizlhwfpq"
+	"fxicqwvuvvonxp"
+	"fxikkx"
+	"fxj"
+	"fxjydkymfwhqvd"
+	"fxlwmgodp"
+	"fxnop"
+	"fxnxg"
+	"fxohg"
+	"fxquofqvaotvne"
+	"fxrtmggc"
+	"fxsmhttpqiosxd"
+	"fxufqytlo"
+	"fxupkjndhraguq"
+	"fxwct"
+	"fxwtr"
+	"fxxqqrkj"
+	"fxxztzjozxp"
+	"fxygeihtwlddbr"
+	"fy"
+	"fyarbz"
+	"fyba"
+	"fybvgsvpsf"
+	"fycqzb"
+	"fycz"
+	"fydjzldjfw"
+	"fyfjqtr"
+	"fyhnavsoyydwqo"
+	"fyieggphtnscz"
+	"fyjwqkqgu"
+	"fykca"
+	"fykemnkruwqig"
+	"fykpazor"
+	"fykpkfkprkxbr"
+	"fymxxvama"
+	"fyowvekg"
+	"fypmq"
+	"fyprai"
+	"fyteqop"
+	"fyukfbarwujno"
+	"fyuzcqhex"
+	"fyvkxfbte"
+	"fyxtcx"
+	"fyylebr"
+	"fyyyqxsuljjmn"
+	"fz"
+	"fzaxco"
+	"fzaxn"
+	"fzbijbspyw"
+	"fzbs"
+	"fzclycbbejufwg"
+	"fzcwlxgsywurd"
+	"fzcyn"
+	"fzdbhe"
+	"fzeuddn"
+	"fzfce"
+	"fzfij"
+	"fzgkfgfcamczq"
+	"fzhwqmawodcteo"
+	"fzhyptddk"
+	"fzidkeuc"
+	"fzioshzymmuv"
+	"fzjalcxnw"
+	"fzjpkqd"
+	"fzjwzc"
+	"fzlkb"
+	"fzmk"
+	"fzmlyksfvbuocq"
+	"fznhoqw"
+	"fzosd"
+	"fzozwjjqntzhy"
+	"fzpdzyjwi"
+	"fzprbi"
+	"fzpvc"
+	"fzql"
+	"fzqykwdxyacb"
+	"fzrtfswxpjv"
+	"fztex"
+	"fztph"
+	"fzupscrg"
+	"fzvemvhrmt"
+	"fzxrwpppdqgtj"
+	"fzyaoherg"
+	"fzzzld"
+	"ga"
+	"gabqfvkspvfn"
+	"gacnepad"
+	"gaeqezpxmka"
+	"gafbfjmonwkd"
+	"gagcjdgdzzmz"
+	"gagtehcyrwkx"
+	"gagxk"
+	"gah"
+	"gahur"
+	"gaiphxgs"
+	"galvnp"
+	"gamv"
+	"gao"
+	"gaoqqbdrfkmjv"
+	"gaqeckt"
+	"gaqfrjqhwk"
+	"garjbzlnwxfw"
+	"garjx"
+	"gasfn"
+	"gasop"
+	"gaupzkpnftkxh"
+	"gauwibtmqa"
+	"gavy"
+	"gaxie"
+	"gaznoorayh"
+	"gazuowgtmjekl"
+	"gb"
+	"gbbe"
+	"gbc"
+	"gbcug"
+	"gbdmrpxhcvlxy"
+	"gbdukggzzp"
+	"gbfiy"
+	"gbgdotks"
+	"gbh"
+	"gbhjksmhlybhjw"
+	"gbibbhv"
+	"gbjc"
+	"gbjcrw"
+	"gbjcwvfeqsfkk"
+	"gbjtwnazdlsbhf"
+	"gbk"
+	"gblvzujvc"
+	"gbn"
+	"gbngknwhs"
+	"gbnwkyx"
+	"gbo"
+	"gbomqil"
+	"gbpgpc"
+	"gbpuyuqmoo"
+	"gbqkkccld"
+	"gbqpxqqkosnal"
+	"gbrjyealc"
+	"gbrlrhrz"
+	"gbrpjbitgwp"
+	"gbtzyn"
+	"gbucvrere"
+	"gbuefqbwb"
+	"gbxaiprcc"
+	"gbxzsdukitse"
+	"gc"
+	"gcanz"
+	"gccva"
+	"gcdr"
+	"gcejauhfy"
+	"gcfu"
+	"gcgile"
+	"gchs"
+	"gchzpa"
+	"gcjdkp"
+	"gcl"
+	"gclozmq"
+	"gcnpvsh"
+	"gcouugtkfswvw"
+	"gcpujsuscu"
+	"gcqjikodgr"
+	"gcrogagmx"
+	"gcszluxnendmf"
+	"gcveh"
+	"gcxlnjkey"
+	"gcxrfduq"
+	"gcze"
+	"gczsr"
+	"gd"
+	"gdafiwonmo"
+	"gdavqdpnao"
+	"gdaxmevsjd"
+	"gdbosuex"
+	"gdcjwchrdf"
+	"gddpejznyvxpe"
+	"gddxisqonxr"
+	"gderdvijz"
+	"gdgdutzjfaogdc"
+	"gdgfk"
+	"gdgofsklw"
+	"gdgyxpo"
+	"gdhfljoytkvs"
+	"gdhjp"
+	"gdixcz"
+	"gdjz"
+	"gdldbeqjbnqgqf"
+	"gdmlutc"
+	"gdmrshpl"
+	"gdnotaahl"
+	"gdomctvunlibgw"
+	"gdowzzrwyojtrw"
+	"gdpg"
+	"gdrwlvwffptyc"
+	"gdscazrstnvj"
+	"gdsgbh"
+	"gducqthbsa"
+	"gdudabuny"
+	"gduln"
+	"gdvfppynzfndb"
+	"gdvq"
+	"gdwezvvcqf"
+	"gdxfozrbfd"
+	"gdz"
+	"gdzzntcjweiph"
+	"ge"
+	"geauwj"
+	"geaxfansiiyax"
+	"gebixayoov"
+	"gebjaclssbsyeb"
+	"gebpnvsl"
+	"gedllpsier"
+	"gedroghiyue"
+	"geffsulqp"
+	"gefuvrjdvcccw"
+	"gegupsfvhpmi"
+	"gehx"
+	"gekdldxlepqxzr"
+	"gekrlh"
+	"gekxw"
+	"gelgrhlboyep"
+	"gendphfsijrg"
+	"geoemkiwh"
+	"geofo"
+	"gepslssrtwizig"
+	"gepwckrkpc"
+	"geq"
+	"geqhxjtbkuluti"
+	"gesxhtzzdnclgt"
+	"getmkq"
+	"getosnspfcanr"
+	"gewfjwv"
+	"gewmomt"
+	"gewwdr"
+	"gexiqn"
+	"geyjquxdodrgc"
+	"gez"
+	"gezovjw"
+	"gf"
+	"gfakhpnp"
+	"gfanbhbm"
+	"gfbgmzbkkkvoqh"
+	"gfbkpnqu"
+	"gfcvdjgixejpi"
+	"gfdbuvof"
+	"gfdkcjtgms"
+	"gffsa"
+	"gfgkwq"
+	"gfguukk"
+	"gfgzajvl"
+	"gfkdvmudbb"
+	"gfkp"
+	"gflbatgpkboqvz"
+	"gfnl"
+	"gfokudm"
+	"gfoplgbz"
+	"gfqwkgrslj"
+	"gfsfjo"
+	"gfsmfngxkqqke"
+	"gftqgqmql"
+	"gftu"
+	"gfu"
+	"gfvwixhbup"
+	"gfxal"
+	"gfxktuulutjpc"
+	"gfyjp"
+	"gg"
+	"ggbnytjniqmqm"
+	"ggcbttjm"
+	"ggclqs"
+	"ggcw"
+	"ggdphrq"
+	"ggecokdxq"
+	"ggf"
+	"ggfermtsgxatl"
+	"gghijmmxre"
+	"ggips"
+	"ggisdzomeri"
+	"ggjbbkrv"
+	"ggkpoabjeqm"
+	"ggkziajthn"
+	"ggmlyvohjxynp"
+	"ggnbzcgoh"
+	"ggnh"
+	"ggoxmqwokgvb"
+	"ggqe"
+	"ggqglghozpj"
+	"ggrx"
+	"ggsauhrrh"
+	"ggsdm"
+	"ggwomxh"
+	"ggwxtasphizr"
+	"ggylmxq"
+	"ggztifzlfck"
+	"gh"
+	"ghacgxhnafy"
+	"ghdilo"
+	"ghdjkgppinyjz"
+	"ghgzej"
+	"ghhxdufiatfo"
+	"ghiewwq"
+	"ghjhrlzdm"
+	"ghkgzavah"
+	"ghkkzugiupyfms"
+	"ghl"
+	"ghlcxpdet"
+	"ghljpkarlrjr"
+	"ghm"
+	"ghmbdzwipcbis"
+	"ghofyfer"
+	"ghqabjxinvlqp"
+	"ghsywpwaz"
+	"ght"
+	"ghtvegmwewgn"
+	"ghu"
+	"ghuw"
+	"ghwbi"
+	"ghxhvxljgeltez"
+	"ghxqelvvohpb"
+	"ghydcupbjtnvc"
+	"ghyhvcgotifbp"
+	"ghyijztuoze"
+	"ghyymb"
+	"ghzoiev"
+	"gi"
+	"gian"
+	"giao"
+	"giaoq"
+	"giat"
+	"gibpxcldn"
+	"gifeekcotk"
+	"gigu"
+	"gij"
+	"gijsks"
+	"gikjpjyeuzm"
+	"giljm"
+	"gilngwjoqjow"
+	"gimpyhnkaauk"
+	"gimqk"
+	"gimxmrawvzy"
+	"gimy"
+	"ginosqmmvdk"
+	"ginqoabafmnyg"
+	"gintclslvglh"
+	"giouz"
+	"gipfxvoterkf"
+	"gipkbddh"
+	"gipmkoxztb"
+	"giqgxn"
+	"gis"
+	"git"
+	"gitmstryxa"
+	"gitprzxbwt"
+	"gitvypslwgrmzk"
+	"gitxrn"
+	"giueoskyklpimy"
+	"giuhcnwlwlyyg"
+	"giwclpjaa"
+	"gixdyt"
+	"gixgmye"
+	"gj"
+	"gjascziqlymc"
+	"gjcpant"
+	"gjcxdvih"
+	"gjfxeumnplwybr"
+	"gjgmkjyqgskr"
+	"gjgpedibf"
+	"gjhahzgn"
+	"gjhlfvgs"
+	"gjhnacd"
+	"gjhwfqen"
+	"gjhyebqvljuyzu"
+	"gjiexwalt"
+	"gjjwjrlfwwxotc"
+	"gjkelbvzruly"
+	"gjmkjhdrdt"
+	"gjmm"
+	"gjmtmyyoaieehx"
+	"gjmztoyn"
+	"gjnfkxcrjyu"
+	"gjnpwgwth"
+	"gjozor"
+	"gjpwcc"
+	"gjqaqnzejemv"
+	"gjqzlahlujw"
+	"gjrj"
+	"gjstedtjtl"
+	"gjtoknvwkutvra"
+	"gjuvzf"
+	"gjvlltp"
+	"gjxdaze"
+	"gjyn"
+	"gjzdzads"
+	"gk"
+	"gkabcdifrjrvru"
+	"gkbjpdb"
+	"gkbyylolme"
+	"gkcuixqyvdp"
+	"gkcwjxs"
+	"gkcxq"
+	"gkhhjaipch"
+	"gkhqqvfwhpout"
+	"gki"
+	"gkjlkdawoypq"
+	"gkkgwdw"
+	"gklsytazbf"
+	"gkobeqlsyqbar"
+	"gkpgeplywmdigb"
+	"gkpgpnfd"
+	"gksbbyfqotrbv"
+	"gktbygfxuqo"
+	"gkterhtahwplue"
+	"gktppkdeewihcu"
+	"gkv"
+	"gkvjacnsusb"
+	"gkxpyu"
+	"gkycz"
+	"gkzx"
+	"gl"
+	"gladpvibxd"
+	"glaucnzg"
+	"gle"
+	"glejjdcsalzp"
+	"glfeabcveldgm"
+	"glgobwbhjgryfg"
+	"glia"
+	"gljaqr"
+	"gljj"
+	"gljoqfqnojmd"
+	"gljtnj"
+	"gljywqyfad"
+	"glkytmmkpej"
+	"gll"
+	"glloqmgboh"
+	"gllxs"
+	"glmuje"
+	"glmzvhtaxes"
+	"glpgkmwlh"
+	"glqimndjenu"
+	"glrgxeswdkf"
+	"glrs"
+	"glsqpi"
+	"glswbpifq"
+	"gltbejcyc"
+	"gltcyilcw"
+	"gluh"
+	"gluxb"
+	"gly"
+	"glyehhti"
+	"glzctuvcmu"
+	"glzpscafft"
+	"gm"
+	"gmavopdbzzwnxw"
+	"gmb"
+	"gmbh"
+	"gmefhcmbfk"
+	"gmfceiakmlokt"
+	"gmftwxtcgzzs"
+	"gmfyue"
+	"gmgxqho"
+	"gmisacwvbf"
+	"gmjvcnbsc"
+	"gmkcjg"
+	"gmlwjxi"
+	"gmndivrz"
+	"gmnrb"
+	"gmnuwslctellv"
+	"gmoq"
+	"gmpjbz"
+	"gmpvlmsaxr"
+	"gmrtxofhq"
+	"gmrxtlg"
+	"gmt"
+	"gmtdrg"
+	"gmuath"
+	"gmuqzlg"
+	"gmuruwawhbr"
+	"gmwphqdclwkp"
+	"gmxm"
+	"gmy"
+	"gmysmpb"
+	"gn"
+	"gnakntszax"
+	"gnbncehnew"
+	"gnbqkrywllvwnh"
+	"gnbxfywv"
+	"gncqzpt"
+	"gndfueoe"
+	"gndk"
+	"gneixvqipfudx"
+	"gnernsjlyqma"
+	"gnfxqzsbmupiv"
+	"gnl"
+	"gnmu"
+	"gnn"
+	"gnnwdvwenkqf"
+	"gnrxdak"
+	"gnsntvksefzon"
+	"gnssgiyoagcm"
+	"gnsvtktpy"
+	"gnuhebiccioblo"
+	"gnuodwdil"
+	"gnuuiebbh"
+	"gnveyosxhnls"
+	"gnvgdgnrxkte"
+	"gnwqthljm"
+	"gnyeqrcm"
+	"gnzerlltp"
+	"go"
+	"goalsz"
+	"goattemaitcd"
+	"gobaaxhzuqbv"
+	"gobdmc"
+	"gobpiclpcqong"
+	"gobsyrs"
+	"gobv"
+	"gocrbou"
+	"godubywary"
+	"gofbbhxiyqa"
+	"goglaosywmcx"
+	"gogqaxmlk"
+	"gohgudcmere"
+	"gohpjcqidmcsn"
+	"gohqf"
+	"gohu"
+	"gohwtndnurtzs"
+	"goi"
+	"gokyadofayc"
+	"golun"
+	"gon"
+	"gondfm"
+	"gonkvakf"
+	"gonrzzx"
+	"gonywqbg"
+	"gop"
+	"gorzigavnuhgl"
+	"gos"
+	"gouedwdnboelrk"
+	"govcozpk"
+	"govmmyrghnn"
+	"goxszfxzrqtfb"
+	"goy"
+	"gozkdvkowzbe"
+	"gozmrtfz"
+	"goztuxjqwgcokl"
+	"gp"
+	"gpbcijjqlgoxzf"
+	"gpcgtltcmcn"
+	"gpcktn"
+	"gpcvtwlenttku"
+	"gpeglpwjkurvu"
+	"gpemybufsw"
+	"gpgijsrqih"
+	"gpgqacf"
+	"gpkkywwhgffk"
+	"gpnjwfhzzwuuz"
+	"gpo"
+	"gpojenhpme"
+	"gppnwqio"
+	"gprb"
+	"gprtjl"
+	"gpswydjpdppg"
+	"gpubambzzna"
+	"gpump"
+	"gpvy"
+	"gpwhltquwf"
+	"gpwpc"
+	"gpyvqxvpnzysd"
+	"gpzenoyoitolg"
+	"gqbpb"
+	"gqbpzlfomfic"
+	"gqbqarbxwp"
+	"gqbqpj"
+	"gqg"
+	"gqhhgmnjcfobav"
+	"gqidmcpqjrc"
+	"gqivkkkricqhbc"
+	"gqjbjbknp"
+	"gqkeihvrcbbf"
+	"gqlasgyif"
+	"gqlfaagpkxzxpj"
+	"gqmdtvedzkhng"
+	"gqmhkypkrzqc"
+	"gqofmnmxyq"
+	"gqphjkhbutql"
+	"gqqey"
+	"gqreqb"
+	"gqrrjuadpwn"
+	"gqrygjkqvldb"
+	"gqsdyuyb"
+	"gqtjji"
+	"gqtlhucmm"
+	"gqwfjutj"
+	"gqwidtrftqr"
+	"gqx"
+	"gqxqbizpdi"
+	"gqxxzsw"
+	"gqy"
+	"gr"
+	"graiutxx"
+	"grcrkkjqebolzx"
+	"gre"
+	"grghmfdq"
+	"grgtdpynvlcz"
+	"grhhzhjnnrmgy"
+	"grkamd"
+	"grkwoi"
+	"grl"
+	"grlvayzeidw"
+	"grlyicgcl"
+	"grnwhseromw"
+	"grrauiyquzlr"
+	"grrscvn"
+	"grsgvy"
+	"grszqbckq"
+	"grtcutcbi"
+	"grw"
+	"grwyxncyypfyi"
+	"grxx"
+	"grymborgqqrp"
+	"grz"
+	"grzdgdyevfwd"
+	"gs"
+	"gsakvcte"
+	"gsdhox"
+	"gseenurdvkdg"
+	"gseflu"
+	"gsfnplthasgnwd"
+	"gsgxscbyqflf"
+	"gsh"
+	"gsitninfh"
+	"gsivjwhznhiohb"
+	"gsjivgo"
+	"gskpg"
+	"gsnjtheqbt"
+	"gsnkzzrz"
+	"gsnpytphl"
+	"gso"
+	"gsofywtqbmg"
+	"gsopmjlyyft"
+	"gsouhwgefju"
+	"gspyxxxey"
+	"gspzcore"
+	"gsqcddrbjf"
+	"gsqtrjrg"
+	"gsrvuthlktxwk"
+	"gsszmvav"
+	"gstrflkshnny"
+	"gsvhepdl"
+	"gswep"
+	"gsyejiwrbbiv"
+	"gszbrsaumjtjy"
+	"gszrjfqi"
+	"gt"
+	"gtaqvfdkl"
+	"gtdhafltwupyd"
+	"gte"
+	"gtfk"
+	"gtfol"
+	"gthpigueapbo"
+	"gtit"
+	"gtjxv"
+	"gtkgdmxwbvexx"
+	"gtkploly"
+	"gtlhkcoep"
+	"gtnahamebx"
+	"gtnyrttc"
+	"gtomq"
+	"gtowpnkuo"
+	"gtqtupenra"
+	"gtrkegiqqyr"
+	"gttanimnrnnr"
+	"gttoggjeurvo"
+	"gtuaenl"
+	"gtvbnbfsdk"
+	"gtvkhipjykf"
+	"gtwdhyaqr"
+	"gtxetatisaawro"
+	"gtyxhujxv"
+	"gu"
+	"guajusc"
+	"guauabwzg"
+	"gubw"
+	"gufmxkgg"
+	"gugzezgdx"
+	"guhbmdgzqiyagw"
+	"guheq"
+	"guhwbcbbgyl"
+	"gukfwkja"
+	"gulflldic"
+	"guoqyb"
+	"guoszmpftftkte"
+	"guouutdhuaoy"
+	"guowjpjjdma"
+	"guptgdwsvk"
+	"guqf"
+	"guriscyxmzseo"
+	"gurmxdjvsdxtlx"
+	"gutdhbxalaq"
+	"gutraavcvzykw"
+	"gutwcabmidvec"
+	"gutznqbvkayjo"
+	"guvfwm"
+	"guvslrkvya"
+	"guwfg"
+	"guwxpmawsoy"
+	"guwyqc"
+	"guxlo"
+	"guyvpcmrx"
+	"guyxcgcimtccn"
+	"gv"
+	"gvbibexbftrioa"
+	"gvbjdpmht"
+	"gvbxu"
+	"gvdg"
+	"gvez"
+	"gvf"
+	"gvfbxhk"
+	"gvfceebz"
+	"gvfncld"
+	"gvfphpckbp"
+	"gvhyediraa"
+	"gviashldh"
+	"gvigeqcqxvxtit"
+	"gvjhdgtp"
+	"gvju"
+	"gvlocohdm"
+	"gvlx"
+	"gvmsdxlwnqe"
+	"gvn"
+	"gvohdabtjwbiom"
+	"gvracxprr"
+	"gvsu"
+	"gvtamohqoqjk"
+	"gvv"
+	"gvvwncwd"
+	"gvyieojfgei"
+	"gvzkghf"
+	"gw"
+	"gwangghrbdlaf"
+	"gwaoyowaejavcj"
+	"gwb"
+	"gwbgn"
+	"gwblkzzaqhayws"
+	"gwbmmift"
+	"gwetgydohdcdl"
+	"gwhklyevclovof"
+	"gwkwoiwici"
+	"gwmsj"
+	"gwmt"
+	"gwo"
+	"gwq"
+	"gwqwturchmyod"
+	"gwrhezm"
+	"gwscob"
+	"gwskyrpdesjse"
+	"gwunlb"
+	"gwvwiqj"
+	"gwzleaubve"
+	"gwzmg"
+	"gwzodygb"
+	"gwzud"
+	"gx"
+	"gxaerdsd"
+	"gxaftae"
+	"gxbd"
+	"gxbhivwblppzto"
+	"gxcah"
+	"gxdcd"
+	"gxdcrhjfyddxbi"
+	"gxff"
+	"gxgnzfky"
+	"gxkfyno"
+	"gxkksayd"
+	"gxmjj"
+	"gxmxzom"
+	"gxo"
+	"gxolspmfe"
+	"gxoqybez"
+	"gxoyoichj"
+	"gxqkpro"
+	"gxqvzduj"
+	"gxqwg"
+	"gxrdurx"
+	"gxskiazxbv"
+	"gxupanfwha"
+	"gxut"
+	"gxweg"
+	"gxwtf"
+	"gxydpqf"
+	"gxytrjzzombu"
+	"gy"
+	"gyagkr"
+	"gybluzuzhv"
+	"gybmqeh"
+	"gydlcxerqard"
+	"gydlkofixrlcx"
+	"gyfognl"
+	"gygjbpgla"
+	"gygv"
+	"gyhu"
+	"gyhwruqtvk"
+	"gyiuedbrnvu"
+	"gykcniwvyhbj"
+	"gykzasuftnj"
+	"gylwfjvn"
+	"gymjpjrwtbihk"
+	"gymjxpabjjgz"
+	"gyngxnlhqicafw"
+	"gyo"
+	"gypbkrszcnus"
+	"gyprkycvuzszy"
+	"gyq"
+	"gyqejrlcccd"
+	"gyt"
+	"gyttbrmhdvxcqq"
+	"gytybu"
+	"gyveedersan"
+	"gyvpzeuzyodhit"
+	"gyw"
+	"gywxevcyhsxg"
+	"gyyeb"
+	"gyyrgyg"
+	"gyzhujvvvtmgal"
+	"gyzofxzhwy"
+	"gyzsipzwm"
+	"gz"
+	"gzakqjlcnr"
+	"gzbuo"
+	"gzbxdretly"
+	"gzeuk"
+	"gzf"
+	"gzg"
+	"gzjwfdumv"
+	"gzlzldtmij"
+	"gzmwermwlldpj"
+	"gznrynpxghdv"
+	"gznsrvbxecopk"
+	"gzphgsfod"
+	"gzpumpmkum"
+	"gzq"
+	"gzqyurd"
+	"gzrdlt"
+	"gztyrw"
+	"gzu"
+	"gzuafnqe"
+	"gzuqcssvgx"
+	"gzvdamggucgvya"
+	"gzvezhyzk"
+	"gzvnjtjuh"
+	"gzxsckv"
+	"gzydsgybpxgckc"
+	"gzyjtyrhf"
+	"gzylersqnuokm"
+	"gzyxoamsg"
+	"gzzgx"
+	"gzzichgqubsxx"
+	"gzzwjkdu"
+	"ha"
+	"hacbafjp"
+	"hacd"
+	"haeaeu"
+	"haeynlizpbmd"
+	"hafdlixtnoz"
+	"hafdyx"
+	"hafjls"
+	"haimmfau"
+	"haitpqcy"
+	"hakbgyt"
+	"hakoykilw"
+	"halzn"
+	"hamco"
+	"hamcu"
+	"hamehs"
+	"hamtacsr"
+	"hapzf"
+	"harbquiz"
+	"harvwlycqgydl"
+	"hatgoqgnlyzr"
+	"hatmxhysox"
+	"hautkhhijcctg"
+	"havrpkqxv"
+	"havxp"
+	"havz"
+	"hawxyztbagaid"
+	"haxjpx"
+	"haybmrvgzwxs"
+	"hayufqvanfdjm"
+	"hazkrhkhypu"
+	"hb"
+	"hbaixni"
+	"hbazy"
+	"hbc"
+	"hbdefvgciik"
+	"hbdoytsnwi"
+	"hbforwstgrpowk"
+	"hbgmpwwgdpcr"
+	"hbi"
+	"hbif"
+	"hbjerawvfobna"
+	"hbjfvraw"
+	"hbk"
+	"hblfz"
+	"hblrst"
+	"hbnzd"
+	"hbofqiunurcb"
+	"hbpt"
+	"hbq"
+	"hbrij"
+	"hbvnqtd"
+	"hbvtqgkrumckp"
+	"hbw"
+	"hbwqwdbvabyn"
+	"hbwrnc"
+	"hbx"
+	"hc"
+	"hcaiucxge"
+	"hcarnll"
+	"hcavnvqqhewkup"
+	"hcaysttsa"
+	"hcb"
+	"hcbkejdfebth"
+	"hcc"
+	"hcceol"
+	"hccrjof"
+	"hcdknmrarjezj"
+	"hcdrhvaeruoolw"
+	"hcefekosh"
+	"hceisjwz"
+	"hcekqppq"
+	"hcfmn"
+	"hcgsljowhjszg"
+	"hchll"
+	"hci"
+	"hcibtiq"
+	"hcivvud"
+	"hcj"
+	"hckismtnwoi"
+	"hcksbyobmllysb"
+	"hckxivfqgoy"
+	"hclovcxqor"
+	"hcmd"
+	"hcmqpameh"
+	"hcnlzdfyhu"
+	"hcnnqgsx"
+	"hcoknirag"
+	"hcouyqjr"
+	"hcowinoafz"
+	"hcpl"
+	"hcpmebphutbmv"
+	"hcrpymmxztj"
+	"hctruspm"
+	"hctxlbyi"
+	"hcuqhdoepibw"
+	"hcwrly"
+	"hcwtdokrilhr"
+	"hcyyucuuz"
+	"hcyzfiadq"
+	"hcz"
+	"hd"
+	"hdakheswxhw"
+	"hdalcwfwpdheox"
+	"hdawgarntwl"
+	"hdbttlnk"
+	"hdcvxbn"
+	"hddi"
+	"hdfoq"
+	"hdge"
+	"hdhgxqwfjuy"
+	"hdhlgsrzgug"
+	"hdisjuvrins"
+	"hdjassremkxfu"
+	"hdjljaq"
+	"hdjrpqazxw"
+	"hdkqdivwxe"
+	"hdmapseumjzh"
+	"hdmmkvyyn"
+	"hdmohg"
+	"hdneewm"
+	"hdpl"
+	"hdqbzf"
+	"hdqldkczx"
+	"hdrpojz"
+	"hdrx"
+	"hduwxsne"
+	"hdvkiaqkdlzzu"
+	"hdw"
+	"hdwex"
+	"hdwzokarkze"
+	"hdxebqtz"
+	"hdxuemq"
+	"hdxyplqooao"
+	"hdz"
+	"hdzdnepjkbo"
+	"he"
+	"heaalmmvshj"
+	"heaammuerwdj"
+	"hearnbzna"
+	"heccfotx"
+	"heclljvh"
+	"hedmnqbo"
+	"hedszxvav"
+	"hefiwhn"
+	"hegb"
+	"heicjydqdayk"
+	"hejagvnpquu"
+	"helr"
+	"hem"
+	"henbgiamfkor"
+	"heo"
+	"heomzfazets"
+	"hepovrm"
+	"heseelfng"
+	"heu"
+	"heuvhoyrfblas"
+	"hevzsvczkbxy"
+	"hewzjqolsvq"
+	"hey"
+	"heywc"
+	"hezqxcao"
+	"hf"
+	"hfagun"
+	"hfebvoqmluq"
+	"hffbf"
+	"hfhhnw"
+	"hfhjmpxj"
+	"hfj"
+	"hfk"
+	"hfleyl"
+	"hfmwpttkhpakbz"
+	"hfmzsd"
+	"hfndzdn"
+	"hfnyfemtc"
+	"hfoio"
+	"hfqjevdeaqczr"
+	"hfqjzc"
+	"hfrspfltmqz"
+	"hfs"
+	"hfuaudiga"
+	"hfuiwrjtuxp"
+	"hfvjkjbdlzjbp"
+	"hfvkiuykf"
+	"hfwgzghk"
+	"hfyzguhvkfivg"
+	"hg"
+	"hgakrbhrmoboj"
+	"hgatroecjxdrb"
+	"hgayrvfb"
+	"hgdiri"
+	"hgefklyrrnrbs"
+	"hggu"
+	"hgjfiayosfio"
+	"hgjvvscwsgcarx"
+	"hgjzpfltgq"
+	"hgknizrszyzyig"
+	"hgl"
+	"hglarmcpajro"
+	"hgluosqezycn"
+	"hgmhme"
+	"hgmnxmefddrqsc"
+	"hgnvfqdkkbdgur"
+	"hgnwoswurdwge"
+	"hgnztsvn"
+	"hgotroaa"
+	"hgpvtadzcfr"
+	"hgqedkhxu"
+	"hgqyhmsi"
+	"hgrvs"
+	"hgtuawnuhwp"
+	"hguuj"
+	"hgvoap"
+	"hgxlh"
+	"hgyejwv"
+	"hgymn"
+	"hh"
+	"hharlsjeis"
+	"hhbtpvkggda"
+	"hhd"
+	"hhdxmel"
+	"hheicr"
+	"hhgdlj"
+	"hhgzx"
+	"hhhafq"
+	"hhhzirndvncgxk"
+	"hhiijigsv"
+	"hhjlghsyd"
+	"hhkf"
+	"hhkuowqxm"
+	"hhljoiqlkfwak"
+	"hhlvlzqv"
+	"hhmik"
+	"hhmsheuc"
+	"hhn"
+	"hhocyvtjxtzzhm"
+	"hhohkxmtotpgyc"
+	"hholhytt"
+	"hhotr"
+	"hhp"
+	"hhpfqtzttckd"
+	"hhqfr"
+	"hhsswaorna"
+	"hhttj"
+	"hhununka"
+	"hhuyvzo"
+	"hhvn"
+	"hhwmmgtexjxx"
+	"hhwpey"
+	"hhxsgvsa"
+	"hhzrrhuhpuac"
+	"hi"
+	"hia"
+	"hidztf"
+	"hiegjrp"
+	"hievlsjagrsq"
+	"hifpbcbbrqu"
+	"higawxbiyiimw"
+	"higpfqvwt"
+	"hihdjzdb"
+	"hihojkw"
+	"hii"
+	"hikav"
+	"hikipb"
+	"hiknfbobmeiz"
+	"hikpykxcvebn"
+	"hilbr"
+	"himvzk"
+	"hin"
+	"hioejol"
+	"hiokjejb"
+	"hiqblac"
+	"hiqurkskdgomvc"
+	"hirxpxz"
+	"hiswpzzvdwgc"
+	"hitgmsqphhzris"
+	"hiu"
+	"hivcnmiooi"
+	"hivithvesbzgln"
+	"hivukitxqmadk"
+	"hiwn"
+	"hiwtxvtlxyl"
+	"hixcueqt"
+	"hiy"
+	"hj"
+	"hjbdn"
+	"hjbwnozcgmv"
+	"hje"
+	"hjgkumasfwe"
+	"hjgmfzga"
+	"hjgnbvvwlk"
+	"hjick"
+	"hjiouihrocarqg"
+	"hjjpg"
+	"hjjwyclydcb"
+	"hjkicjnpupvfdg"
+	"hjlhafnaxngq"
+	"hjlul"
+	"hjmlmswgexo"
+	"hjmx"
+	"hjnredbd"
+	"hjqh"
+	"hjujflfoc"
+	"hjvnjffujhf"
+	"hjxxlkixz"
+	"hjzbwbymrqtjq"
+	"hk"
+	"hkazrcoimg"
+	"hkcbnuvg"
+	"hkcyem"
+	"hkdrts"
+	"hkdwntmuyg"
+	"hkdztrkvtscmz"
+	"hkeeicfqlkdo"
+	"hkfhsgcftzmjw"
+	"hkftvpuyrm"
+	"hkgbtyo"
+	"hkhqq"
+	"hki"
+	"hkjfjazrkehp"
+	"hkjfxzco"
+	"hkkpbsuzee"
+	"hklkobygss"
+	"hkqecxjfgfggr"
+	"hkqvwpqwqim"
+	"hkrcfcdpelfyx"
+	"hktchmxtfxoa"
+	"hktjbkqzlcotsx"
+	"hkvdbcm"
+	"hkxk"
+	"hkypaplqccyeb"
+	"hl"
+	"hlahsjoan"
+	"hlaweulb"
+	"hlbjar"
+	"hlbwrhratxwiy"
+	"hlcfmbitqydbf"
+	"hlcmxajqgu"
+	"hlednttqmeuzxq"
+	"hlfqa"
+	"hlhcxastlkyopz"
+	"hlhkbfp"
+	"hlk"
+	"hllsnxwgb"
+	"hlnjuoahgq"
+	"hlpcctjh"
+	"hlqfe"
+	"hlsoz"
+	"hltyabvwfmpgk"
+	"hluqa"
+	"hlvizdm"
+	"hlvsy"
+	"hlwnncgmfpnb"
+	"hlwp"
+	"hlxgxtpodrvz"
+	"hlygsc"
+	"hlzvaiu"
+	"hm"
+	"hmb"
+	"hmd"
+	"hmdtylbbbrd"
+	"hmfjb"
+	"hmfr"
+	"hmhdphkecydjq"
+	"hmkexrqzvvkg"
+	"hmnpn"
+	"hms"
+	"hmtazsgjs"
+	"hmtigmlvfjcpv"
+	"hmtoektuofym"
+	"hmwmsxw"
+	"hmytwmhcd"
+	"hmzzjvfdaxhia"
+	"hnahnzydiozo"
+	"hnanommkmuuxf"
+	"hncpzsa"
+	"hncxhtbwin"
+	"hnevdf"
+	"hnfdxsyx"
+	"hnfrbpbqusxnt"
+	"hng"
+	"hnhovxhcoiplk"
+	"hnigtzshpjgk"
+	"hniyvnmipd"
+	"hnkdmehlodst"
+	"hnkiqubstxayga"
+	"hnkopfy"
+	"hnmua"
+	"hnnkn"
+	"hnnlxmba"
+	"hnnph"
+	"hnovlrgzp"
+	"hnpivecu"
+	"hnqjtryrktohb"
+	"hnrihfuyewsjy"
+	"hnrp"
+	"hnsldowtz"
+	"hntdmisbpuktuo"
+	"hntgfpixov"
+	"hnuhfdka"
+	"hnuwacfyp"
+	"hnvolwx"
+	"hnvqcfofudjilc"
+	"hnvyuzrsit"
+	"hnwlmvhpflpqqf"
+	"hnwzwnj"
+	"hnxlk"
+	"hnyuvqjfzcd"
+	"hnze"
+	"hnzuxdot"
+	"hnzznfgaone"
+	"ho"
+	"hocukopzscn"
+	"hodrvfaquzupb"
+	"hoexoxmddcuaa"
+	"hofavgwhts"
+	"hofc"
+	"hoffeezhlxnxx"
+	"hofgrxcdsus"
+	"hofimpk"
+	"hofkquyjp"
+	"hofxbxrxbxjz"
+	"hog"
+	"hogcdw"
+	"hoguo"
+	"hohtl"
+	"hohxv"
+	"hoipr"
+	"hojdhobp"
+	"holcblahtldxuv"
+	"homfkhjysrgz"
+	"honbh"
+	"honkitscbxpeym"
+	"honkka"
+	"hopwi"
+	"hortcsrraim"
+	"hosjwcgsxhx"
+	"hotcqibjfzbidu"
+	"hovp"
+	"hoxkeoql"
+	"hoxmjctd"
+	"hoygsfndq"
+	"hoykb"
+	"hoyqqtsw"
+	"hpbpp"
+	"hpcsmubgs"
+	"hpdstrmxfzqlm"
+	"hpf"
+	"hph"
+	"hpi"
+	"hpj"
+	"hpjdjguykjlj"
+	"hpjf"
+	"hpkgahwfsem"
+	"hpkkhdyrlfd"
+	"hplafvojie"
+	"hplhncidofwr"
+	"hplqx"
+	"hpmabxtyqnt"
+	"hppjxbmakbje"
+	"hpq"
+	"hprzvxbaqj"
+	"hpszf"
+	"hpunw"
+	"hpuq"
+	"hpvhohhb"
+	"hpvixbcec"
+	"hpw"
+	"hpwdfxosj"
+	"hpzgvrzmk"
+	"hpzkpezbcdxf"
+	"hq"
+	"hqakyaimw"
+	"hqaybcjn"
+	"hqccuiuklyhrqn"
+	"hqcgu"
+	"hqchwnkng"
+	"hqcxdybknbal"
+	"hqdmovqlkipgqu"
+	"hqfkzf"
+	"hqg"
+	"hqgsicgjswz"
+	"hqjmznt"
+	"hqjpkrinh"
+	"hqkrz"
+	"hql"
+	"hqmnwhcerkrfg"
+	"hqnizuvm"
+	"hqnridobjdt"
+	"hqq"
+	"hqqbovj"
+	"hqqvxbwcitkcj"
+	"hqqzlcgbenfs"
+	"hqrptc"
+	"hqsu"
+	"hqsugetshvjfdy"
+	"hqsvketblfsi"
+	"hqtgq"
+	"hqtzmolibmtnlb"
+	"hqurxzjtum"
+	"hqvzngeshv"
+	"hqw"
+	"hqwywnnfgkleox"
+	"hqxhmawlnz"
+	"hqy"
+	"hqysxyjffpfwy"
+	"hr"
+	"hratsrkn"
+	"hrbvtrrhlpv"
+	"hrchnw"
+	"hrcmsfe"
+	"hrdldipf"
+	"hrdulmgfkvrh"
+	"hrfrmkjzrnyt"
+	"hriedz"
+	"hrjyujz"
+	"hrk"
+	"hrmbeyp"
+	"hrmgzjnpqpb"
+	"hrnaunvda"
+	"hrnzfshlqxzn"
+	"hro"
+	"hronj"
+	"hrrrw"
+	"hrsm"
+	"hrt"
+	"hrtzuscx"
+	"hrwcddbnjbstb"
+	"hryjxf"
+	"hrz"
+	"hsaeorzvwszly"
+	"hsbqvgnlzwcx"
+	"hsciljsrdo"
+	"hscyfqlnmztq"
+	"hsdhslys"
+	"hseszigyztwads"
+	"hsi"
+	"hsjhspl"
+	"hslvgbftnacbwu"
+	"hsmyy"
+	"hsnqxxtvbz"
+	"hsnukhdciqea"
+	"hspvibfibbyl"
+	"hsrg"
+	"hsrgboka"
+	"hsufevxnutk"
+	"hsuupswbynzol"
+	"hsvnhsyg"
+	"hsvrrd"
+	"hsxqsxujo"
+	"hsyw"
+	"ht"
+	"htdvpdrugp"
+	"htdyav"
+	"htec"
+	"htexejlgbufv"
+	"htgmck"
+	"hthwufsrsazpd"
+	"htihhq"
+	"htijfzvwdalx"
+	"htmpcwffw"
+	"htnjxvnpkslchb"
+	"htqiro"
+	"htqnzhxynsau"
+	"hts"
+	"htszdtrv"
+	"htueeujem"
+	"htuwbpabln"
+	"htvln"
+	"htvlqxnal"
+	"hu"
+	"hua"
+	"huaiwm"
+	"huaxwuxprfofmn"
+	"huazxmgyi"
+	"hucvbqam"
+	"huhdmq"
+	"huhrokqdjpyqzn"
+	"huhwydfp"
+	"huj"
+	"hujafuk"
+	"hulfxunfz"
+	"hulo"
+	"humhmsttzcilhy"
+	"humlqy"
+	"humnkoea"
+	"huoaszuoodkn"
+	"hupcaef"
+	"hupprytrsor"
+	"hurbkuojrh"
+	"hurezq"
+	"hury"
+	"hutbivpnyunjuf"
+	"hutbqk"
+	"hutznhmsv"
+	"huv"
+	"huvttietfnx"
+	"huwqjojrk"
+	"huxnemfqqycsi"
+	"huxx"
+	"huzfnns"
+	"hv"
+	"hvaxluuztkysip"
+	"hvb"
+	"hvcdzdh"
+	"hvdn"
+	"hvejsyvsypkez"
+	"hvekm"
+	"hveuyx"
+	"hvfthsntsjb"
+	"hvgm"
+	"hvixf"
+	"hvjrnlblw"
+	"hvkpxp"
+	"hvn"
+	"hvo"
+	"hvpzhplrcbshel"
+	"hvqbbmtrhuq"
+	"hvqdvbpmjsf"
+	"hvqztnhejrhm"
+	"hvsdwd"
+	"hvstmkfbd"
+	"hvtvvmvd"
+	"hvufgvznk"
+	"hvuhahnukxmasa"
+	"hvupepvrnqmqa"
+	"hvzmsqzbhyjwl"
+	"hw"
+	"hwa"
+	"hwaryxgfsnych"
+	"hwco"
+	"hwex"
+	"hweyvau"
+	"hwfhsr"
+	"hwgreynbivqoe"
+	"hwguywvocspuk"
+	"hwivfnv"
+	"hwjsenhitochdx"
+	"hwkgd"
+	"hwkrvcuwwyzlpg"
+	"hwlbblwcaggclo"
+	"hwle"
+	"hwloyrav"
+	"hwnjzcztrwfjtw"
+	"hwoqfebkyyo"
+	"hwplpz"
+	"hwqemnowqhqeu"
+	"hwrkzhttzitks"
+	"hwtabj"
+	"hwuraaad"
+	"hwuziwwb"
+	"hwwrnl"
+	"hwxppnyds"
+	"hwy"
+	"hwzmfzwqpix"
+	"hwzydgsuf"
+	"hx"
+	"hxa"
+	"hxbqvzikl"
+	"hxclelokqrbnh"
+	"hxcpzefr"
+	"hxcqop"
+	"hxgagprozlp"
+	"hxhhxlqq"
+	"hxhuqux"
+	"hxiydkbnz"
+	"hxk"
+	"hxmtdu"
+	"hxntv"
+	"hxpdirjc"
+	"hxpdkkny"
+	"hxqbum"
+	"hxrtptwsw"
+	"hxsblfchbehpzq"
+	"hxtbvgai"
+	"hxupbfsqltxkb"
+	"hxvsdgw"
+	"hxwmdio"
+	"hxy"
+	"hxzjopyvntx"
+	"hxzmnvflr"
+	"hyaa"
+	"hyafjckq"
+	"hycovwchejiwno"
+	"hycrirtoqmu"
+	"hydlcfnh"
+	"hydtnxacddg"
+	"hyfqenlsfyz"
+	"hygx"
+	"hyh"
+	"hyibaodbu"
+	"hyiyxvm"
+	"hyizpiy"
+	"hyjbeda"
+	"hyjcjzwhzwd"
+	"hykgm"
+	"hykwxva"
+	"hylanpwtxeabb"
+	"hylz"
+	"hymduf"
+	"hymzmseco"
+	"hyoa"
+	"hyoafvyovbh"
+	"hyojgdbw"
+	"hyow"
+	"hyr"
+	"hyrdcyalywj"
+	"hysgwwjouerhvu"
+	"hyulejb"
+	"hyulwljtuqw"
+	"hyx"
+	"hyye"
+	"hyzei"
+	"hyzlhcl"
+	"hyznkubjujic"
+	"hz"
+	"hzakjayzrvxr"
+	"hzaptyatqa"
+	"hzgx"
+	"hziazy"
+	"hzicsg"
+	"hzkdabotmfauv"
+	"hzkgbwztswbslh"
+	"hzkxxznxf"
+	"hzlcqxm"
+	"hzltixccxgp"
+	"hznmdmxjo"
+	"hzoeoms"
+	"hzofuznsia"
+	"hzphqmd"
+	"hzqwtrnbx"
+	"hzrqsuygzdyn"
+	"hzsrvumcey"
+	"hzuanjvfe"
+	"hzuulqjvae"
+	"hzuwtsxzmjivc"
+	"hzvkgczkf"
+	"hzvmf"
+	"hzvy"
+	"hzwa"
+	"hzwb"
+	"hzwdhilhsfollw"
+	"hzxwnx"
+	"hzzvjzotgq"
+	"ia"
+	"iab"
+	"iabagrdrcm"
+	"iabpcxgiwikv"
+	"iabpuufnj"
+	"iacdnedigc"
+	"iacpbqmdunmms"
+	"iaeb"
+	"iaf"
+	"iah"
+	"iaiqfvy"
+	"iajim"
+	"iakjxlbu"
+	"ialejhtclwrn"
+	"iametkfzoeibm"
+	"iao"
+	"iaoooqnxztgtlu"
+	"iapsg"
+	"iapyqen"
+	"iaqmrvv"
+	"iaruoyjp"
+	"iascku"
+	"iasypummevq"
+	"iat"
+	"iatoktwylbj"
+	"iatwvfgwvt"
+	"iav"
+	"iavbt"
+	"iavqjjsdi"
+	"iavqkaa"
+	"iaxwhoujj"
+	"iaybpxneytfxgq"
+	"iaypliowwt"
+	"iazjeplniml"
+	"iazzkuqhgkpxlh"
+	"ibaemozuxuqu"
+	"ibaxkcmhklsfi"
+	"ibcu"
+	"ibcv"
+	"ibcyjzi"
+	"ibeibzvqhqmdkg"
+	"ibekzivof"
+	"ibfmwxvpcelgu"
+	"ibhfwmswfzwhnt"
+	"ibiuhzgxzm"
+	"ibjitzzknfnqy"
+	"ibkxyb"
+	"ibm"
+	"ibmlhpmq"
+	"ibmugubxgddx"
+	"ibmxtfwbm"
+	"ibmyyony"
+	"ibnmeyqmauejjc"
+	"ibopez"
+	"ibpywrwzwmky"
+	"ibqyvhibxmvg"
+	"ibringw"
+	"ibsb"
+	"ibshf"
+	"ibsucnhdhpd"
+	"ibty"
+	"ibvyqp"
+	"ibwazycwjr"
+	"ibx"
+	"ibyodhrhfavaj"
+	"ibyrrojkvgukv"
+	"ibzgaa"
+	"ibzhtlebhzl"
+	"ibzminxho"
+	"ic"
+	"icavpmwudcnzcj"
+	"iccbwtydyvv"
+	"icdatwrazhhpws"
+	"icddrytuwnizjg"
+	"iceshglyyqrc"
+	"icgcder"
+	"icgkthjfg"
+	"ich"
+	"ichzxoljswjwi"
+	"icifj"
+	"icirpzjs"
+	"ickh"
+	"iclpvpjjvcctn"
+	"icmlrjyxvf"
+	"icmqnzoltqdf"
+	"icntbipxeelqp"
+	"icpkusrqffdv"
+	"icpuywhqgi"
+	"icpvr"
+	"icq"
+	"icr"
+	"icrkncsmofalnk"
+	"icrlkrlxi"
+	"icswdksqmvxjn"
+	"icthcyafvc"
+	"icurayev"
+	"icvwtjqedblu"
+	"icvznxbcy"
+	"id"
+	"idalgpz"
+	"idbkcbzptgtgy"
+	"idbktvcdrylx"
+	"idc"
+	"idcj"
+	"iddloaoyyi"
+	"idehiycg"
+	"ideozptfr"
+	"idhbxntwlc"
+	"idilmkbud"
+	"idlouzjnl"
+	"idmpmol"
+	"idnpwxihq"
+	"idobfzsmxfsz"
+	"idocpoqvw"
+	"idpdpgfllin"
+	"idpfg"
+	"idqtgbrhqomxjp"
+	"idqvfpzw"
+	"idsbvtllp"
+	"idshyqwye"
+	"idsqg"
+	"idtouujp"
+	"idvmjfh"
+	"idvwslvjaknsk"
+	"idxdms"
+	"idxfhii"
+	"idxnwmzs"
+	"idzplzie"
+	"idzvbrnvisokq"
+	"ie"
+	"iebbnsmi"
+	"iebmzvxeceiaco"
+	"iebppxj"
+	"iebrilko"
+	"iec"
+	"iecb"
+	"ieedy"
+	"iefnm"
+	"iegnzpsqznys"
+	"iehi"
+	"ieipbhcezvo"
+	"ieistfwa"
+	"ieit"
+	"iekjuhyoerbf"
+	"ieknqzm"
+	"ielrn"
+	"ieltz"
+	"ieojqlxae"
+	"iepjzhdbg"
+	"ieqdiqnppuc"
+	"ieqtu"
+	"ieqxvilsr"
+	"iermusnthqffwk"
+	"ierxk"
+	"iesbjsep"
+	"ietstrgnyibs"
+	"ietwwax"
+	"ieunq"
+	"ieuoosdrsmh"
+	"iev"
+	"ievaxct"
+	"iexgxsxtlrtcnw"
+	"iexpfaywoxwh"
+	"iexyiyczkcq"
+	"iezbrcgwrdxizu"
+	"iezco"
+	"iezuinscw"
+	"iezvevdzc"
+	"if"
+	"ifa"
+	"ifaqaxn"
+	"ifarabzujyumj"
+	"ifbob"
+	"ifdouxibxwhl"
+	"ifean"
+	"iffpevnvo"
+	"ifgdszmwcuk"
+	"ifgiat"
+	"ifknidjkrzdix"
+	"iflujdazs"
+	"ifoguuuzqnchxu"
+	"ifpyytltbcgmjm"
+	"ifqmcdk"
+	"ifrxfvxjrwxqpj"
+	"ifthpq"
+	"iftmkzpmtfn"
+	"ifunlji"
+	"ifuwej"
+	"ifvfaygsmlkx"
+	"ifwcatxyra"
+	"ifxkh"
+	"ifybudr"
+	"ig"
+	"igautjqehacnw"
+	"igbkp"
+	"igcvdcpt"
+	"igdaqyubtilllw"
+	"igdhchmrnhpi"
+	"iggnmksgw"
+	"ighxaacqsv"
+	"igj"
+	"igjqb"
+	"igk"
+	"igmfnhxlm"
+	"igmkygpa"
+	"igngco"
+	"igodhznhcvmg"
+	"igoohvoanj"
+	"igp"
+	"igrbtuzpor"
+	"igrcp"
+	"igsdpipxuti"
+	"igshzyvbihc"
+	"igt"
+	"igukpcddnmozg"
+	"igvqfjxsn"
+	"igwxghgucssyb"
+	"igxo"
+	"igyxhuiszglgqi"
+	"ih"
+	"ihafrokufkd"
+	"ihagpyr"
+	"ihcmja"
+	"ihdwenhqh"
+	"ihfi"
+	"ihfj"
+	"ihg"
+	"ihgasyakc"
+	"ihgdixpbxqjz"
+	"ihgpusxydhhpf"
+	"ihgslgeuemocq"
+	"ihhcnv"
+	"ihhelw"
+	"ihljzrovkzg"
+	"ihmr"
+	"ihneyhvmtxbhgs"
+	"ihnqgpza"
+	"ihntdyei"
+	"ihp"
+	"ihphztwn"
+	"ihq"
+	"ihqazqgr"
+	"ihqtwb"
+	"ihtlswktwtqxzo"
+	"ihvcrmof"
+	"ihwlgksamdm"
+	"ihwnsisrg"
+	"ihxd"
+	"ihzpijklkgzi"
+	"ii"
+	"iib"
+	"iicwhtgdmqqd"
+	"iigckw"
+	"iiirf"
+	"iilhxc"
+	"iimmmhafmzu"
+	"iinwaohkp"
+	"iiolkszmlrf"
+	"iipwjipg"
+	"iiqzjkkcnzob"
+	"iisn"
+	"iitqip"
+	"iityy"
+	"iiujaqc"
+	"iiuvhjokwkgou"
+	"iivquuoih"
+	"iiw"
+	"iiwcbut"
+	"iizdbzzgnt"
+	"ij"
+	"ija"
+	"ijatyb"
+	"ijbaauy"
+	"ijdrvlrcaq"
+	"ijermwnicfiuvn"
+	"ijfb"
+	"ijfg"
+	"ijgrmxm"
+	"ijhksq"
+	"ijkvtxj"
+	"ijloyj"
+	"ijnanfghtkfkkd"
+	"ijnrfjdvvu"
+	"ijo"
+	"ijogcvfvgwtcxk"
+	"ijqybjppwfc"
+	"ijrjfn"
+	"ijrlshzx"
+	"ijrzawjazh"
+	"ijttyjukyclga"
+	"ijtzxlujvyu"
+	"ijvdcmvbas"
+	"ijytomdhd"
+	"ijzrjed"
+	"ik"
+	"ika"
+	"ikaebnzqu"
+	"ikazzdr"
+	"ikbcebisv"
+	"ikbkgnsoay"
+	"ikbzlxxbx"
+	"ikcoib"
+	"ikczrvyxgpon"
+	"ikfzs"
+	"ikgaerkqwrireg"
+	"ikgagct"
+	"ikgqozm"
+	"ikhcawypecnuey"
+	"ikhrdxusdm"
+	"ikidpeotmjq"
+	"ikiv"
+	"iklqdwe"
+	"ikmcajck"
+	"ikmurpkdxru"
+	"ikrqtprrje"
+	"iks"
+	"iksfoej"
+	"ikst"
+	"ikthwysy"
+	"ikujrixvt"
+	"ikuwownch"
+	"ikvsdmmqnm"
+	"ikwnhfa"
+	"ikx"
+	"ikxhyrvfqwy"
+	"ikxmowsppwv"
+	"il"
+	"ilaxywg"
+	"ilbapiiyavm"
+	"ilctnd"
+	"ilddar"
+	"ildwllfx"
+	"ileo"
+	"ilhefsyhnclqrf"
+	"iliktx"
+	"ilinqigqs"
+	"illozrkmrhqmd"
+	"ilmta"
+	"ilopheiafprgc"
+	"ilqazxklg"
+	"ilquvrumfyhy"
+	"ilrlatnkkxeon"
+	"ilstxeedfxoi"
+	"iltuatubsdz"
+	"ilujjgvnidd"
+	"ilvwegbfyjmon"
+	"ilw"
+	"ilwilrmvtf"
+	"ilza"
+	"ilzgwcsiycw"
+	"im"
+	"imaetwxxozj"
+	"imaj"
+	"imcjssmgujpjg"
+	"imcocmbluxvov"
+	"imcvod"
+	"imdbreapj"
+	"imdnn"
+	"imf"
+	"imgcnz"
+	"imgimrmorwy"
+	"imgjwxut"
+	"imgxgqoftur"
+	"imhnkoqlzphfoh"
+	"imidgbiivh"
+	"imiltsn"
+	"imk"
+	"imkn"
+	"iml"
+	"imlbsqqgqvgi"
+	"imlqwowuxfeq"
+	"immsbfu"
+	"imnh"
+	"imoasofadnhy"
+	"imopmmdmk"
+	"imoxrqnpn"
+	"impjcky"
+	"imqtkiqtbrvwue"
+	"imrdjyxj"
+	"imrrmadpb"
+	"imsjb"
+	"imvjlcztrlxykt"
+	"imvo"
+	"in"
+	"inahygubappct"
+	"infqa"
+	"inghdjtsrx"
+	"inicrmedev"
+	"inieyzbgwclyb"
+	"initdp"
+	"inkndjxghyvclz"
+	"inkpbwov"
+	"inkwxsun"
+	"inkypgwpmwncc"
+	"inlflnedesf"
+	"inlm"
+	"inlxnkdoag"
+	"inmvghe"
+	"innjo"
+	"inoewq"
+	"inokqdfmr"
+	"inpopczsvdolk"
+	"inpppsjhkmeogm"
+	"inrjhgcouulk"
+	"insaxcpjwqbny"
+	"intkbvyuzl"
+	"intkpkcstby"
+	"inu"
+	"inuxpbkjmbod"
+	"inv"
+	"invlxlzgotv"
+	"invu"
+	"io"
+	"ioati"
+	"iobftuujkz"
+	"ioeoviprsb"
+	"iofd"
+	"iofnrdo"
+	"iogeky"
+	"iohisfg"
+	"iohur"
+	"ioizzlux"
+	"ioj"
+	"iondqtrbvhhfsu"
+	"ioomoijmjsle"
+	"iopdyxpjta"
+	"iorcpjlg"
+	"iosejwylkicdq"
+	"iouyv"
+	"iovfhecijuxp"
+	"iowmfewn"
+	"ioxmaaaqxxsudi"
+	"ioxqidmhzoq"
+	"iozwiz"
+	"ip"
+	"ipasrsvh"
+	"ipbbemxhbhova"
+	"ipbkoxsqfyluk"
+	"ipcjlzbzr"
+	"ipewbt"
+	"iphmaadfb"
+	"iphu"
+	"ipivplsa"
+	"ipjvhv"
+	"ipkgrk"
+	"ipldwnbjxxdgr"
+	"iplwithtt"
+	"ipn"
+	"ipoe"
+	"ipoyxwrotb"
+	"ipqekegx"
+	"ipuirmwworm"
+	"ipvfyjmwwww"
+	"ipxzzfnj"
+	"ipyc"
+	"ipzlvdlbwwagls"
+	"iq"
+	"iqbcsz"
+	"iqbh"
+	"iqc"
+	"iqca"
+	"iqezzyrfdnex"
+	"iqfvhqpbczsx"
+	"iqfxgobqnl"
+	"iqggrhkqysmgz"
+	"iqhhugkcmv"
+	"iqisuyf"
+	"iqjuoyyja"
+	"iqjvmkgnx"
+	"iqkcojqfzbozvr"
+	"iqmyzj"
+	"iqnythaikefa"
+	"iqofgatlsnylg"
+	"iqouegvfcrohid"
+	"iqpbsanw"
+	"iqpgvuetdp"
+	"iqphx"
+	"iqpifyawfqv"
+	"iqppdfzk"
+	"iqqitetlcngkt"
+	"iqrxgswe"
+	"iqrzgfgykmmfsw"
+	"iqsgfkesbckjo"
+	"iqtgnpx"
+	"iquba"
+	"iquopsouslsbs"
+	"iquthhffqxnpdk"
+	"iqvdqgulal"
+	"iqweihzjurp"
+	"iqygmvzieabdes"
+	"iqynzosswje"
+	"iqyp"
+	"ir"
+	"ira"
+	"irairiqi"
+	"iraqcecjrqhjtr"
+	"iraqyqw"
+	"irayrsy"
+	"irbghvgwzlohbq"
+	"ircipyilx"
+	"irdnkihq"
+	"ireaxujjpeid"
+	"ireqzxk"
+	"irfatohyh"
+	"irfaxszib"
+	"irfoopakxpq"
+	"irfrtuc"
+	"irg"
+	"irgvfkvxhomc"
+	"irhh"
+	"irhputqhltmin"
+	"irjst"
+	"irl"
+	"irm"
+	"irmau"
+	"irnqqshhondl"
+	"iroeniu"
+	"irp"
+	"irqa"
+	"irqhdn"
+	"irqnnyvyy"
+	"irqoiqkhgnc"
+	"irqzluttanjf"
+	"irs"
+	"irsqzysw"
+	"irtwwwuiahygev"
+	"irtz"
+	"irull"
+	"iruoizgiccmcdy"
+	"iruurrcun"
+	"irwbu"
+	"irwpmaqec"
+	"irwsoenneprd"
+	"irxeqjma"
+	"irxnfu"
+	"irys"
+	"is"
+	"isbd"
+	"iscjoqteroxs"
+	"iscrphml"
+	"isdsrjrexfc"
+	"isdxrxrj"
+	"isgieyf"
+	"isgpdsppngdrfi"
+	"isgwach"
+	"ishkmulz"
+	"isijmzmzsfsfmz"
+	"isioigrtxfv"
+	"isklkyslztorl"
+	"isklwvhrytmdj"
+	"iskorrije"
+	"islq"
+	"islrrhhkndfe"
+	"islvfadwegkozv"
+	"ism"
+	"isopzqljkl"
+	"isphhiflonhnql"
+	"issiywzh"
+	"issletia"
+	"isswnaypgnz"
+	"isttuxjmbqa"
+	"isu"
+	"isuqqw"
+	"isyeahipytrak"
+	"isyvxtqgranc"
+	"iszexc"
+	"it"
+	"itaapwsgbvklqa"
+	"itcagdxclitj"
+	"itcuw"
+	"itdibyfnv"
+	"itdp"
+	"itdq"
+	"itejdk"
+	"itf"
+	"itfyxchf"
+	"itg"
+	"itgxade"
+	"ithkggrg"
+	"itibdrpnkrtzc"
+	"itio"
+	"itisxyuggvfa"
+	"itjgqghkiccwq"
+	"itkgm"
+	"itlruojqb"
+	"itmghtnnm"
+	"itojebijjzhdx"
+	"itq"
+	"itqlufeqlwz"
+	"itqrxlggalakqu"
+	"itr"
+	"itusk"
+	"itvskzrcex"
+	"itymqmmnrcgz"
+	"ityygjklhzzz"
+	"itzczojauixqwa"
+	"itzjzoifjonom"
+	"itznverxy"
+	"iu"
+	"iuazdnzbdbfkx"
+	"iubzq"
+	"iud"
+	"iudqev"
+	"iuemhbhevjfc"
+	"iues"
+	"iufrlxxdri"
+	"iuhostqafwgx"
+	"iujdcbwuwe"
+	"iukgvnavqo"
+	"iulak"
+	"iuldf"
+	"iulxagtx"
+	"iumegzwthczsj"
+	"iumzn"
+	"iuoixsyi"
+	"iuq"
+	"iuqj"
+	"ius"
+	"iushc"
+	"iuumqaeohwqo"
+	"iuuosaeiidd"
+	"iuupy"
+	"iuvomrfoti"
+	"iuvwkivpb"
+	"iuw"
+	"iuwbvbthb"
+	"iuwjowkppdaj"
+	"iuwlts"
+	"iuwpupr"
+	"iuxozioyp"
+	"iuzv"
+	"iv"
+	"ivbdoqrabuzm"
+	"ivc"
+	"ivdscisy"
+	"ivgnj"
+	"ivhyyzgcrkgc"
+	"iviiakmmhnddbd"
+	"ivjczrmdqvn"
+	"ivnbu"
+	"ivozzfrlpndygs"
+	"ivpqmvjl"
+	"ivq"
+	"ivqxdbvhwby"
+	"ivrsldvwlnq"
+	"ivrxaxvko"
+	"ivsy"
+	"ivtnjiocd"
+	"ivvafjfzeivzb"
+	"ivvarvxdyloiyd"
+	"ivvowmeordxgha"
+	"ivvqvid"
+	"ivwybkx"
+	"iw"
+	"iwaosftp"
+	"iwbtxligesk"
+	"iweiuwhlbr"
+	"iwfdbcbjpbduj"
+	"iwfihxhsgrzak"
+	"iwhb"
+	"iwhlzpnzgoqvq"
+	"iwimsht"
+	"iwinvnmm"
+	"iwkkgiwjxuipe"
+	"iwkqjb"
+	"iwljbp"
+	"iwlsdwmfkmbwov"
+	"iwmunp"
+	"iwnxzpeaog"
+	"iwq"
+	"iwqlapulyxzpc"
+	"iwquiwgdbbd"
+	"iwschsdpehokst"
+	"iwsdsi"
+	"iwt"
+	"iwugafnfnpq"
+	"iwusmab"
+	"iwwnmncreigt"
+	"iwxxkdmocixf"
+	"iwylusy"
+	"iwyn"
+	"iwz"
+	"ix"
+	"ixaovnyp"
+	"ixaqw"
+	"ixbekzqon"
+	"ixc"
+	"ixcekost"
+	"ixcli"
+	"ixcnqlhdmvuys"
+	"ixcrrnfzd"
+	"ixdogwpxnjolr"
+	"ixdqhruddn"
+	"ixdtz"
+	"ixduexqsaispi"
+	"ixevkops"
+	"ixewkw"
+	"ixfd"
+	"ixfnyqqo"
+	"ixhq"
+	"ixhuzwunxcj"
+	"ixl"
+	"ixljpk"
+	"ixlohjvcctaoy"
+	"ixlquyhctptzz"
+	"ixmoylf"
+	"ixnhualrlek"
+	"ixnreni"
+	"ixnuwzpzz"
+	"ixommpphafnk"
+	"ixsubyhlryls"
+	"ixtxycifdebgn"
+	"ixuhl"
+	"ixvyjfyeyhri"
+	"ixxdzqq"
+	"ixzt"
+	"iy"
+	"iyak"
+	"iyaqocmmlzos"
+	"iycvo"
+	"iyd"
+	"iydzzir"
+	"iyekn"
+	"iyevn"
+	"iyfbcty"
+	"iyfue"
+	"iygalnvg"
+	"iygbjjja"
+	"iygxegykmp"
+	"iyhkcimdehpk"
+	"iyjmwqlrwajx"
+	"iykewdhij"
+	"iyknq"
+	"iylgv"
+	"iyltcznhtpl"
+	"iyndv"
+	"iynhokshkzpkg"
+	"iynomnsokr"
+	"iypswcgg"
+	"iyqpnyobxw"
+	"iyriijvelpo"
+	"iys"
+	"iysawytahtpg"
+	"iysehyguukqzs"
+	"iytqyeepxaif"
+	"iytwod"
+	"iytzoqzchdrit"
+	"iyurnaxnv"
+	"iyvd"
+	"iyvp"
+	"iyvylplkp"
+	"iywqltvftyumul"
+	"iyx"
+	"iyxc"
+	"iyxlvp"
+	"iyzecgyf"
+	"iyzjq"
+	"iyzwjg"
+	"izaaenqovcts"
+	"izamkade"
+	"izautyd"
+	"izbfqily"
+	"izbjbpzamc"
+	"izcehuclh"
+	"izcxqbqsalwgee"
+	"izexjzvilz"
+	"izfkpawtomxenr"
+	"izfliboqeyp"
+	"izfmnnp"
+	"iziesnlkmmcnp"
+	"izitgh"
+	"izkwshgha"
+	"izlvcijyyeinpa"
+	"izmcfukhc"
+	"iznajjhxkin"
+	"izno"
+	"izobd"
+	"izpcrdowsmygdq"
+	"izq"
+	"iztuhdru"
+	"izusp"
+	"izwnvrj"
+	"izwzcd"
+	"ja"
+	"jab"
+	"jacynvzaimgn"
+	"jadfnq"
+	"jaf"
+	"jafgkzsz"
+	"jafjyc"
+	"jagipydrtimp"
+	"jahqp"
+	"jahtywcmbu"
+	"jahu"
+	"jaigywjumvrand"
+	"jalpaytzhhbrv"
+	"jamdaarznwnb"
+	"jaqjopnyknqgyc"
+	"jarx"
+	"jas"
+	"jaugeao"
+	"jauoanad"
+	"javfsgycz"
+	"javinoi"
+	"jawyt"
+	"jaxjvdj"
+	"jaycjbxrhf"
+	"jayfontwdx"
+	"jayi"
+	"jayvfd"
+	"jb"
+	"jbbzaq"
+	"jbcgkenrmrgv"
+	"jbchpksvalyg"
+	"jbczuswhlvn"
+	"jbdsb"
+	"jbdszbwsrp"
+	"jbelj"
+	"jbextqvdgjgg"
+	"jbeyob"
+	"jbgusbbjxy"
+	"jbjnsjljk"
+	"jbktniviohp"
+	"jbkwlco"
+	"jbliz"
+	"jbmftugr"
+	"jbmuneqjwdunp"
+	"jbndpic"
+	"jbnqcbg"
+	"jbqgvjkdkcvv"
+	"jbsb"
+	"jbslqamvdaas"
+	"jbt"
+	"jbthajql"
+	"jbtqkjbpcfx"
+	"jbtwodxiswfap"
+	"jbuimrnvelv"
+	"jbuj"
+	"jbuztnj"
+	"jbvgcys"
+	"jbwnyfywuuvaov"
+	"jbx"
+	"jbxlglbehbhxy"
+	"jbys"
+	"jbzvgbsbtfrmk"
+	"jc"
+	"jcawsxa"
+	"jcbiscrisj"
+	"jcdjgmabluguu"
+	"jcdmqjjxqhkab"
+	"jcdwggduqsuzqm"
+	"jceeclkpqqm"
+	"jcffiqf"
+	"jcfftyfvjjb"
+	"jcfplivfndou"
+	"jcghrh"
+	"jcgovcm"
+	"jcidqw"
+	"jcisrihrvwqdhi"
+	"jcitosuydk"
+	"jciwrca"
+	"jcjtedfutq"
+	"jckgcdpts"
+	"jclijmhgbkq"
+	"jcljnkxxuzgn"
+	"jclyyqrbksb"
+	"jcnafiusfr"
+	"jcpixxjxhqqwhr"
+	"jcqernasumkm"
+	"jcqkjzddxlsmof"
+	"jcrbnweo"
+	"jcrpdwvjrbb"
+	"jcrptlk"
+	"jcu"
+	"jcyczdiky"
+	"jcyv"
+	"jd"
+	"jdbibztppbg"
+	"jdccdvbbkvxn"
+	"jdd"
+	"jddhfxggguzo"
+	"jdfxoaupbuswek"
+	"jdg"
+	"jdhcjtphnp"
+	"jdhqmc"
+	"jdicd"
+	"jdiiufobsca"
+	"jdior"
+	"jdjanuocd"
+	"jdjgle"
+	"jdkdsspdzacna"
+	"jdkmfsiy"
+	"jdkpc"
+	"jdllhpvjgmdwr"
+	"jdm"
+	"jdnam"
+	"jdnazlcznedrz"
+	"jdnci"
+	"jdnhqrgkkqzm"
+	"jdo"
+	"jdoptcuxyym"
+	"jdoumkkmpfcyi"
+	"jdr"
+	"jdrbkmvp"
+	"jdrgrqnnvukdhb"
+	"jdtflfocjkkc"
+	"jdtplnqtmplb"
+	"jdupw"
+	"jduravftxsmiuy"
+	"jduurrotsulif"
+	"jdxjrempncxq"
+	"jdylkb"
+	"je"
+	"jeabvzsigqrq"
+	"jeadxbutkll"
+	"jeahkyqpee"
+	"jeaiwjvpe"
+	"jeavofms"
+	"jedbss"
+	"jedfvvr"
+	"jeegtgpvrn"
+	"jeeoiykddgjjf"
+	"jefeqlm"
+	"jefj"
+	"jehcvdlhatdrok"
+	"jehhtyxqntx"
+	"jehkptu"
+	"jehlofubsm"
+	"jeixodpmjdxpl"
+	"jejrleyj"
+	"jejtn"
+	"jekchmbgx"
+	"jekgr"
+	"jemktntapcumqk"
+	"jemol"
+	"jemoqke"
+	"jenh"
+	"jenjflvbh"
+	"jeqfs"
+	"jeqjxpw"
+	"jeqoseryf"
+	"jeqyltlpe"
+	"jes"
+	"jetpq"
+	"jewexjq"
+	"jewlyzfl"
+	"jexddnauztqgz"
+	"jeywqsvd"
+	"jeyzdotzwvuw"
+	"jf"
+	"jfarkjxjoayiza"
+	"jfbahoi"
+	"jfbehjhjhwn"
+	"jfbwpol"
+	"jfc"
+	"jfdapusw"
+	"jfeb"
+	"jfeqmvfg"
+	"jffjyibuihv"
+	"jffom"
+	"jfikdmdalcla"
+	"jfjiuusnji"
+	"jfkhtqtqtfunpw"
+	"jflvccrsauayh"
+	"jfndalcbvga"
+	"jfngnnemy"
+	"jfnwp"
+	"jfoddopbfyj"
+	"jfpiontqsqa"
+	"jfpjrcgdfs"
+	"jfpmykqpvny"
+	"jfrca"
+	"jfs"
+	"jfsdygoqit"
+	"jftqwhkofmz"
+	"jfuimidiadvzd"
+	"jfumba"
+	"jfxbs"
+	"jfxwkemu"
+	"jfyuh"
+	"jg"
+	"jgagslkups"
+	"jgbjpf"
+	"jgbjvve"
+	"jgbkogj"
+	"jghvzz"
+	"jgiznohann"
+	"jgklim"
+	"jgmebj"
+	"jgmnnhdgfy"
+	"jgmnosugczsxt"
+	"jgo"
+	"jgopjm"
+	"jgp"
+	"jgqopncsbdjm"
+	"jgr"
+	"jgrai"
+	"jgrc"
+	"jgrokpebvrawuh"
+	"jgskxsawpqy"
+	"jgu"
+	"jguovhoy"
+	"jgxkyepkqwfuu"
+	"jgxnmyzc"
+	"jgyxxhmavmuler"
+	"jh"
+	"jhag"
+	"jhclxkn"
+	"jhctl"
+	"jhitl"
+	"jhizekpm"
+	"jhjnmehjgrayem"
+	"jhkbiifwh"
+	"jhlqgyx"
+	"jhmxw"
+	"jhnukbgjpqu"
+	"jhoifamvo"
+	"jhoixfwmbr"
+	"jhoj"
+	"jhpvxalamursu"
+	"jhqfznk"
+	"jhrllks"
+	"jhsesktnvx"
+	"jhsigzjoivbxe"
+	"jhslipcnlxxju"
+	"jhucb"
+	"jhuyyyst"
+	"jhyjib"
+	"jhzgfjbeean"
+	"jhzhe"
+	"jhzogjmvpdde"
+	"ji"
+	"jiaj"
+	"jibnghsef"
+	"jieutelq"
+	"jifilbnenypc"
+	"jifrncyyg"
+	"jigyazvyqn"
+	"jihm"
+	"jiibvsygmohrw"
+	"jikwpmqubnz"
+	"jil"
+	"jilk"
+	"jilohswbxhugzz"
+	"jiluyhv"
+	"jimkdmyvuljwfl"
+	"jimuerhqdxny"
+	"jinai"
+	"jio"
+	"jioaickede"
+	"jiobuxzmw"
+	"jiofm"
+	"jipcfmtg"
+	"jiqwuhn"
+	"jisksmi"
+	"jisq"
+	"jiwewfw"
+	"jiynogici"
+	"jiyxgf"
+	"jjacr"
+	"jjchswgysksv"
+	"jjcmhphk"
+	"jjeurmbdg"
+	"jjfb"
+	"jjgevq"
+	"jjhwykiljncl"
+	"jjkdmmipawnzxv"
+	"jjkel"
+	"jjkfqoima"
+	"jjlchapulxuo"
+	"jjlyqadhpeyb"
+	"jjmdhd"
+	"jjmlwvaje"
+	"jjnbook"
+	"jjnrrw"
+	"jjqbslzvyerukr"
+	"jjqpflzcy"
+	"jjrdjthlubgj"
+	"jjsur"
+	"jjtgzqmi"
+	"jjukdilbpddv"
+	"jjuwadfwmzts"
+	"jjv"
+	"jjvorrxyzrva"
+	"jjvyg"
+	"jjw"
+	"jjwns"
+	"jjx"
+	"jjxmwucoduksx"
+	"jjxrnrzbnvs"
+	"jjxwuogjfx"
+	"jjyl"
+	"jjyrstufot"
+	"jk"
+	"jkavpct"
+	"jkchzzbrfzpgim"
+	"jkcmndf"
+	"jkcx"
+	"jkdfypnpvt"
+	"jkdprjqsfbc"
+	"jkeoxic"
+	"jkey"
+	"jkezxwpjvqpm"
+	"jkfoqje"
+	"jkhqhb"
+	"jkicdhxiwulg"
+	"jkjhrp"
+	"jkjjwuvctkn"
+	"jkjvnpsfgsyr"
+	"jkllmbqdkxci"
+	"jkmumpge"
+	"jkmyt"
+	"jknwommx"
+	"jkp"
+	"jkpkdftspjfyi"
+	"jkqsyescglpxv"
+	"jkuishlynvex"
+	"jkvwi"
+	"jkwrs"
+	"jkye"
+	"jkyzeaqfgmwdna"
+	"jkz"
+	"jl"
+	"jlaqyapof"
+	"jlasg"
+	"jlbobynyoo"
+	"jlcilelkno"
+	"jlcxphpmgybgv"
+	"jld"
+	"jldckaggxlqam"
+	"jldi"
+	"jldxg"
+	"jlezo"
+	"jlf"
+	"jlftzquvvkkixo"
+	"jlhbvzgd"
+	"jlhpdabx"
+	"jlhu"
+	"jllzu"
+	"jlnckwbnyqsy"
+	"jlotqa"
+	"jlpdu"
+	"jlppl"
+	"jlqqtfknnjjb"
+	"jlu"
+	"jlwmap"
+	"jlyvitiqm"
+	"jlza"
+	"jlztckfotypbo"
+	"jmanlywdztkx"
+	"jmarivkno"
+	"jmartv"
+	"jmbza"
+	"jmc"
+	"jmcjoqvreyfv"
+	"jmcmfxasq"
+	"jmcvggpjgcvsu"
+	"jmjaqwt"
+	"jmjzwz"
+	"jmkcnagke"
+	"jmkpdkzwk"
+	"jmkvbtvmb"
+	"jmnsifgbp"
+	"jmnuhakfvcz"
+	"jmphvevirhd"
+	"jmqdkmcchopx"
+	"jmsdjcnzkd"
+	"jmsminkawxnzo"
+	"jmts"
+	"jmuyaqsvfdrm"
+	"jmwekj"
+	"jmwutnv"
+	"jmwyppwe"
+	"jmxkr"
+	"jmzeru"
+	"jmzzmvmywucjf"
+	"jn"
+	"jna"
+	"jnashnilg"
+	"jnbsoutm"
+	"jncvvgxizut"
+	"jncxoiogfmtpfa"
+	"jndynqqv"
+	"jndzsnxzro"
+	"jneoicbqqdy"
+	"jnf"
+	"jngmu"
+	"jngxx"
+	"jnjp"
+	"jnjubcanf"
+	"jnn"
+	"jnnjkwzupo"
+	"jnq"
+	"jnqfr"
+	"jnsdgcd"
+	"jnuhdrjc"
+	"jnuuwvkpocohx"
+	"jnuxbvydqk"
+	"jnuzje"
+	"jnwdhrxliwad"
+	"jnwoqdmiikmhhv"
+	"jnwwnutqk"
+	"jnxmololyyswj"
+	"jnytodk"
+	"jnzbcdgteoafg"
+	"jnzcufjwuo"
+	"jnzqfcbo"
+	"jo"
+	"jocioasbybdv"
+	"jocv"
+	"joevqpley"
+	"jogxclqutrc"
+	"jolrwnghnjvexr"
+	"jonhwhbhdoygh"
+	"jonrujshvsaq"
+	"jonvawnpo"
+	"jooborn"
+	"joouo"
+	"joowrs"
+	"jooyeckixw"
+	"jophqhelijo"
+	"jopuylv"
+	"jorhmav"
+	"jotzfrrui"
+	"jovjinqohl"
+	"jovlfoke"
+	"jpbj"
+	"jpbwbknjxrs"
+	"jpccr"
+	"jpcevcdvu"
+	"jpcuhmgcxipyog"
+	"jpdckj"
+	"jpeijtebfhb"
+	"jpexqzjykpj"
+	"jpfiajh"
+	"jpgln"
+	"jpjgjvrdepp"
+	"jplfrpqalvu"
+	"jplhnxsh"
+	"jplt"
+	"jpmhhm"
+	"jpnm"
+	"jpnvlmoonczsj"
+	"jppllxpeh"
+	"jppnl"
+	"jpqrdznkxefti"
+	"jpr"
+	"jprcqeaucgtt"
+	"jpuvsqve"
+	"jpuzrgzytk"
+	"jpxjsjgmhgyd"
+	"jpxotenzo"
+	"jpyausbc"
+	"jq"
+	"jqaawlmqsouopd"
+	"jqasigrq"
+	"jqcj"
+	"jqdm"
+	"jqfepkzbkyohzn"
+	"jqfk"
+	"jqgcsidq"
+	"jqhgj"
+	"jqib"
+	"jqiektbi"
+	"jqjdusidfvotye"
+	"jqkdttgg"
+	"jqlgerujr"
+	"jqnbgsqqzcd"
+	"jqnrqntusj"
+	"jqnuzaczepxrla"
+	"jqpu"
+	"jqpvxhxxsdn"
+	"jqthqkict"
+	"jquqcdifhayde"
+	"jqvjchtwhfwrqp"
+	"jqvvmyrwvgj"
+	"jqxoxvfzts"
+	"jqyieg"
+	"jqz"
+	"jqzrpnui"
+	"jr"
+	"jra"
+	"jraudazomspu"
+	"jrdbcgdxxnaw"
+	"jrdlozgyqw"
+	"jregyzwso"
+	"jrelyhcnfyos"
+	"jrexyhodxen"
+	"jrhzijerzfyt"
+	"jrkp"
+	"jrlfbwnhokvxkb"
+	"jrlpjefxolzki"
+	"jrntgukzwfbp"
+	"jrntylxhqoq"
+	"jrp"
+	"jrpswdrljx"
+	"jrqalvdpzetzjr"
+	"jrqtersnxdkh"
+	"jrruymzt"
+	"jrs"
+	"jrsd"
+	"jrsdp"
+	"jrsja"
+	"jrtak"
+	"jrtnletza"
+	"jrtxhle"
+	"jruaxir"
+	"jruqbwhv"
+	"jruysosrkbm"
+	"jrvusqwtbqbgf"
+	"jrwtson"
+	"jry"
+	"js"
+	"jsamaukaldps"
+	"jse"
+	"jsepclosmbywhx"
+	"jsf"
+	"jshqfda"
+	"jshtyszcqimmn"
+	"jskxmogqzxjoe"
+	"jskygwqgflim"
+	"jskzfmip"
+	"jsmftdiiq"
+	"jsnn"
+	"jsnsti"
+	"jso"
+	"jsosxjoezy"
+	"jspnqq"
+	"jsq"
+	"jsqapg"
+	"jsrghrozdecm"
+	"jsrlmxzegyb"
+	"jsrnhaczipra"
+	"jstn"
+	"jstw"
+	"jsutixc"
+	"jsve"
+	"jsvisr"
+	"jswfore"
+	"jsxi"
+	"jsxpzdiuo"
+	"jt"
+	"jtauf"
+	"jtbkspu"
+	"jtbn"
+	"jtcoelcntsw"
+	"jtdyvydabh"
+	"jtf"
+	"jtfnjpjunlz"
+	"jtgpfc"
+	"jthkclvxmgsx"
+	"jtio"
+	"jtjlyatzttucyt"
+	"jtmv"
+	"jtmvokuqdolbf"
+	"jtnnovamenqi"
+	"jtodafy"
+	"jtpzaognne"
+	"jtqh"
+	"jtqoiu"
+	"jtqoxxc"
+	"jtrls"
+	"jtttaphqgs"
+	"jtutfigk"
+	"jtvf"
+	"jtwo"
+	"jtwwwiakyy"
+	"jtz"
+	"ju"
+	"judlngsbqhwhiv"
+	"judwxwzlzpvhe"
+	"juffrooshxcy"
+	"jufogifrjxma"
+	"juhslh"
+	"juinypyhxmkyut"
+	"jujjiqibvoqi"
+	"julasknlip"
+	"juloojm"
+	"junpcuatxpq"
+	"juqkqyllpn"
+	"juqkrygs"
+	"juqmmq"
+	"juqukrqxr"
+	"jurhcpzegdju"
+	"jusffpy"
+	"jusxmgobvp"
+	"juulsa"
+	"juuxr"
+	"juwfeha"
+	"juymqkfnvo"
+	"juzcc"
+	"juzhrzzbmlz"
+	"jv"
+	"jvadgzuae"
+	"jvakmge"
+	"jvbfa"
+	"jvcglmmx"
+	"jvcrwncc"
+	"jvdrufdvol"
+	"jvfjcurdu"
+	"jvfmbanbjx"
+	"jvhchqzzjqttn"
+	"jvhhxney"
+	"jvhr"
+	"jvidenirniah"
+	"jviu"
+	"jvjappjlr"
+	"jvje"
+	"jvkiwnlaaaqq"
+	"jvlpwaxnryja"
+	"jvm"
+	"jvmdfxipsdebk"
+	"jvmzarbnxqogt"
+	"jvnbjh"
+	"jvngvtmuca"
+	"jvnsht"
+	"jvpgqsji"
+	"jvqfvd"
+	"jvrudesaa"
+	"jvszj"
+	"jvtmczpvs"
+	"jvttwddont"
+	"jvvcddq"
+	"jvxfbuoporj"
+	"jvylha"
+	"jvyvacca"
+	"jvzzegewd"
+	"jw"
+	"jwadtqbftyhyro"
+	"jwbgigwincgnx"
+	"jwc"
+	"jwcfoq"
+	"jwebq"
+	"jwegcrvwnyijb"
+	"jwhbeimkfg"
+	"jwhvytk"
+	"jwithdwfivm"
+	"jwk"
+	"jwktrwxgaw"
+	"jwnrbvxvedyf"
+	"jwnyrzukhz"
+	"jwolznfi"
+	"jwovaep"
+	"jwqkgghxhm"
+	"jwrmclc"
+	"jwsvplhhvooihc"
+	"jwufmvkta"
+	"jwvgn"
+	"jwvmkotueu"
+	"jwxyfkp"
+	"jwywxl"
+	"jwzlaxsagutxaj"
+	"jx"
+	"jxatstdrq"
+	"jxautyp"
+	"jxavqnmeuwoshv"
+	"jxdmskgkwr"
+	"jxeeupryistmit"
+	"jxghrbjn"
+	"jxgnxwabimedkr"
+	"jxigeirecz"
+	"jxjwpjgneh"
+	"jxlpzbmmn"
+	"jxlxhwkj"
+	"jxmcsnevwq"
+	"jxmkmvoplsmls"
+	"jxno"
+	"jxnsp"
+	"jxoivim"
+	"jxoswwvhdz"
+	"jxphx"
+	"jxpvwxlnvef"
+	"jxqqlx"
+	"jxqxmuvb"
+	"jxsaoypvd"
+	"jxsbwepr"
+	"jxsftptbekw"
+	"jxsimd"
+	"jxsplra"
+	"jxtkomkmccktod"
+	"jxuh"
+	"jxvsahgj"
+	"jxwbwmi"
+	"jxxhivkrih"
+	"jxygltb"
+	"jxytdukc"
+	"jxzpsl"
+	"jy"
+	"jyapzzg"
+	"jybklofkmxmsr"
+	"jydcbrxbnh"
+	"jydiq"
+	"jydwqq"
+	"jyedeexwwvjq"
+	"jyf"
+	"jyfii"
+	"jygmleedy"
+	"jygqweei"
+	"jygssaibvbbzj"
+	"jyiyxzxmwvefc"
+	"jyjjo"
+	"jyjoouuhvppyc"
+	"jykfgqxwi"
+	"jykkvlqlzdg"
+	"jykwxw"
+	"jymhdwg"
+	"jyni"
+	"jynrz"
+	"jyoohgsz"
+	"jyoyptinnh"
+	"jypejbush"
+	"jyqhkv"
+	"jyshgpco"
+	"jyumm"
+	"jywduf"
+	"jywnj"
+	"jywpgvh"
+	"jywvjc"
+	"jyycnsjdlk"
+	"jyzgfrehgc"
+	"jyzk"
+	"jz"
+	"jzadlhqagk"
+	"jzcckdlx"
+	"jzdfngc"
+	"jzfblkmlg"
+	"jzgnrszghicnm"
+	"jzgufd"
+	"jzhdwoy"
+	"jzhiqfmjrtdpyf"
+	"jzifgam"
+	"jzikpqejuzbaq"
+	"jziofxwcuemg"
+	"jzkggl"
+	"jzlq"
+	"jzofrheupnbspf"
+	"jzonsfxh"
+	"jzpigefnxcdwlt"
+	"jzpnrjordc"
+	"jzqz"
+	"jzsf"
+	"jzt"
+	"jzuyguyunjcjvd"
+	"jzvxslpkldfipd"
+	"jzvxyjoozlvvb"
+	"jzvzrqr"
+	"jzwlyo"
+	"jzwwcd"
+	"jzxtionth"
+	"jzybgn"
+	"jzz"
+	"ka"
+	"kacgmhs"
+	"kacvhve"
+	"kaddtfdma"
+	"kaeuktj"
+	"kaf"
+	"kaffoan"
+	"kahgim"
+	"kaifmtqjehher"
+	"kajcwe"
+	"kakvhefyribj"
+	"kalqcwe"
+	"kaocqzy"
+	"kaoesuqefw"
+	"kaokhhlxwbao"
+	"kaopmuhztd"
+	"kaoujfdhnm"
+	"kapfgvvuvfneo"
+	"kapszhyr"
+	"kar"
+	"katyricwg"
+	"kauxexefemetqu"
+	"kavebezvur"
+	"kaw"
+	"kawlxedbgr"
+	"kaxhwelkbdape"
+	"kaybqdscf"
+	"kb"
+	"kbbgfpsihfcoki"
+	"kbceeh"
+	"kbctmwkh"
+	"kbd"
+	"kbfbdqgfsha"
+	"kbfgxvnrdwwvqf"
+	"kbhhrendrcynnq"
+	"kbibayjn"
+	"kblehuoxcfxm"
+	"kblpabuifkj"
+	"kbmvkbxe"
+	"kbnlofagnlr"
+	"kbotqlwjs"
+	"kbphz"
+	"kbrgngxeipl"
+	"kbs"
+	"kbsjqybmxel"
+	"kbsoiqxqxjqg"
+	"kbsygzyvdvueh"
+	"kbwcsnvio"
+	"kbwuarut"
+	"kbxop"
+	"kbyn"
+	"kc"
+	"kccihx"
+	"kccprfovn"
+	"kcedpvxswpb"
+	"kcegsrywyvzgv"
+	"kcepaxc"
+	"kcftdszng"
+	"kcgm"
+	"kcgulg"
+	"kcjvefa"
+	"kckmcgk"
+	"kcns"
+	"kcovyx"
+	"kcowbxgzb"
+	"kcplkdyfh"
+	"kcqr"
+	"kcrpylzfxq"
+	"kcsunijysc"
+	"kcszsyepycyyv"
+	"kcszynprpgo"
+	"kctqmhkkavvp"
+	"kcu"
+	"kcuwvvwkpasruk"
+	"kcvabb"
+	"kcwzmnu"
+	"kcz"
+	"kczdvtklcrptgn"
+	"kd"
+	"kdaxu"
+	"kdbhjvhrqgavwj"
+	"kdchttlhgjwt"
+	"kdcn"
+	"kddhau"
+	"kddrokoggd"
+	"kdeqhpqtfuesky"
+	"kdingznfoqashk"
+	"kdjsgvtfk"
+	"kdnmd"
+	"kdowsqwu"
+	"kdssv"
+	"kdtcft"
+	"kdtrzkmn"
+	"kdunfkzekh"
+	"kduusquychft"
+	"kduyeefnc"
+	"kdv"
+	"kdzlyoygxsa"
+	"ke"
+	"keadnfanoqf"
+	"keafjkp"
+	"keahqjrxfcdryx"
+	"kealhtlqnwhqc"
+	"kebdod"
+	"kecwzibyu"
+	"keddxp"
+	"kefbslwgz"
+	"kehcikxkgyn"
+	"keiiilm"
+	"kekuqlol"
+	"keldtdhqqnda"
+	"kenju"
+	"kennqb"
+	"keplinda"
+	"keppmisr"
+	"kepwaenumq"
+	"keqorqlt"
+	"keqykf"
+	"ker"
+	"kexa"
+	"kexdbco"
+	"kexvaoutgbtzb"
+	"keyaautomk"
+	"kezdl"
+	"kezrly"
+	"kf"
+	"kfcdo"
+	"kfcnapuaom"
+	"kfdnpidmyhnhv"
+	"kffnopaxixzg"
+	"kfg"
+	"kfgoibzxptien"
+	"kfhgcyqhwgde"
+	"kfhvvx"
+	"kfiflv"
+	"kfklkfi"
+	"kfldbosuwn"
+	"kflmfdlxg"
+	"kflwrprzabx"
+	"kfmjw"
+	"kfmoakhiuxvvm"
+	"kfncgyymjsx"
+	"kfnscopfdi"
+	"kfnvwz"
+	"kfnxhyv"
+	"kfovacyagmh"
+	"kfqcfbcutpfjil"
+	"kfqkxhrbcub"
+	"kfqpmp"
+	"kfscekvyov"
+	"kfvgncmwl"
+	"kfvorxfsizoztp"
+	"kfwayjhpewego"
+	"kfwgagdwuzagxf"
+	"kfwnyxz"
+	"kfximt"
+	"kfxxjmdzjnnsu"
+	"kfzaek"
+	"kfzmcbjepu"
+	"kg"
+	"kgajcgrtbftk"
+	"kgawwbhjhp"
+	"kgbjdcacpzkjxp"
+	"kgbr"
+	"kgd"
+	"kgdumkbt"
+	"kggdngiu"
+	"kggf"
+	"kgidyljzvjgw"
+	"kgionywdqkvbb"
+	"kgjfhjksvq"
+	"kgjkihj"
+	"kgjzjauvwqci"
+	"kglvynvuvdop"
+	"kgomrfhglwfvvr"
+	"kgptkissnz"
+	"kgqfbspatfpeb"
+	"kgqffifxezcy"
+	"kgquayex"
+	"kgrxkeremwjb"
+	"kgsqmgys"
+	"kgtt"
+	"kgumtg"
+	"kgvcjvgzvjqoiq"
+	"kgwbmkr"
+	"kgxdt"
+	"kgxgpkaz"
+	"kgxyd"
+	"kgzujfihlckidx"
+	"kh"
+	"khb"
+	"khci"
+	"khctdczazz"
+	"khesvhjjhz"
+	"khetyyqvqrmn"
+	"khfbzbemltsyus"
+	"khfmkkajrvtn"
+	"khfxoylq"
+	"khhdrwzrpj"
+	"khiyrq"
+	"khjvyqlda"
+	"khkpvvc"
+	"khlgekl"
+	"khpkizmqrf"
+	"khpw"
+	"khqgooekbn"
+	"khsdqbidnpe"
+	"khskxhrdlmxd"
+	"khuwqwzvj"
+	"khygmmiekh"
+	"khyskgntrlkx"
+	"khz"
+	"khzozolr"
+	"ki"
+	"kiawmmthuunve"
+	"kibgw"
+	"kid"
+	"kidr"
+	"kidrm"
+	"kifgugcqox"
+	"kiggfrlxsk"
+	"kihufdihvdg"
+	"kiijp"
+	"kiiqvunqswztl"
+	"kij"
+	"kikgwtrlhrh"
+	"kiklmuf"
+	"kilyhlwi"
+	"kimvafngtet"
+	"kioghrbnpi"
+	"kip"
+	"kippb"
+	"kiqfbskp"
+	"kiqitet"
+	"kisdoppsbdk"
+	"kissvz"
+	"kit"
+	"kiusgypreo"
+	"kiylg"
+	"kiynm"
+	"kiyqsnqkhh"
+	"kizhad"
+	"kizsjwollfea"
+	"kizx"
+	"kjcpukygtbco"
+	"kjdw"
+	"kjecdiixzzclh"
+	"kjhta"
+	"kjhxgvrl"
+	"kjibisxqj"
+	"kjknvaxvjo"
+	"kjmbwylso"
+	"kjmclgpcc"
+	"kjmwes"
+	"kjodfbhojxlnbg"
+	"kjphldtpjfpzu"
+	"kjrrabaxuywhzn"
+	"kjsjpxlwanb"
+	"kjthzjtmkchkr"
+	"kjujle"
+	"kjxabetn"
+	"kjxhx"
+	"kjxsjnj"
+	"kjzwe"
+	"kk"
+	"kkdnp"
+	"kkftjynbjjvvmu"
+	"kkgbbawftokwb"
+	"kkgkaxutay"
+	"kkgyd"
+	"kkh"
+	"kkia"
+	"kkkytpvresna"
+	"kkmmqbnq"
+	"kkmp"
+	"kkmpftmyxiq"
+	"kknuvvfm"
+	"kkop"
+	"kkphosuvi"
+	"kkpvrukxsk"
+	"kkpxcdz"
+	"kkpydymo"
+	"kkqkzpovrrxaoj"
+	"kkrpihcgziefzv"
+	"kkryz"
+	"kku"
+	"kkxvfnfjrnwnl"
+	"kl"
+	"klaoeustbcjbuu"
+	"klbdumwzn"
+	"klbo"
+	"klbxygxilhx"
+	"klc"
+	"klcbifarep"
+	"klegikkrou"
+	"klge"
+	"klgyhqtjsrdf"
+	"klizanmxb"
+	"kljdmwduuo"
+	"klmbbgfrere"
+	"klmunssjazrewn"
+	"klnilu"
+	"klompytcgkv"
+	"klqfzqnykbw"
+	"klrxdzttqerbo"
+	"kltoipcbfv"
+	"kltuwr"
+	"kltwmvauisdga"
+	"klv"
+	"klvzgkua"
+	"klwf"
+	"klxkuhwfvbha"
+	"klxmpzbb"
+	"klxokn"
+	"klyckdyrh"
+	"klzpayykitoh"
+	"km"
+	"kmaxtpkwth"
+	"kmcc"
+	"kmcpeulqhw"
+	"kmdgyri"
+	"kmdhdkrwzp"
+	"kmdhxmnomtjweg"
+	"kmdtoglkbldjx"
+	"kmgsecgukmoce"
+	"kmgviobvadtlia"
+	"kmhpcgp"
+	"kmijs"
+	"kmjvjqfhgws"
+	"kmlglnea"
+	"kmlmtqit"
+	"kmlzduwcvrma"
+	"kmmanjlwnasy"
+	"kmmefo"
+	"kmoly"
+	"kmomlwddc"
+	"kmopplxuf"
+	"kmpeq"
+	"kmpleknrwrgd"
+	"kmpx"
+	"kmpxcivve"
+	"kmqgetsv"
+	"kmrvrlohmfh"
+	"kmsfprokto"
+	"kmtpp"
+	"kmucgtf"
+	"kmuczne"
+	"kmufvtrmszmatc"
+	"kmuli"
+	"kmvlaccbb"
+	"kmw"
+	"kmwd"
+	"kmxpmkasrly"
+	"kmyecwjwjf"
+	"kmygka"
+	"kmylf"
+	"kmyz"
+	"kmzb"
+	"kn"
+	"knaidhbjos"
+	"knbqemvjoe"
+	"kncnvlwfkenmha"
+	"knenyuqf"
+	"knes"
+	"knffjapn"
+	"kngi"
+	"kngrd"
+	"kngweupgnhgf"
+	"knh"
+	"knifhomtaynymh"
+	"kninlvhcozhui"
+	"knjklikxxq"
+	"knkalzdckue"
+	"knkiap"
+	"knlkcdsxhjpin"
+	"knmjr"
+	"knnfwoincjzcyb"
+	"knrukxtdgx"
+	"knryqvixjq"
+	"knsddwsyl"
+	"kntmjrawmgd"
+	"knukecaiwtfwvh"
+	"knutg"
+	"knuvmln"
+	"knvgmg"
+	"knvsshkq"
+	"knwoyomefdx"
+	"knxciyxvrrd"
+	"knyhzigc"
+	"knzgidix"
+	"ko"
+	"koa"
+	"koafatxmk"
+	"koailmr"
+	"koamhejrtenzml"
+	"koaztrizom"
+	"kobhqdcrpph"
+	"kocpgycis"
+	"kocwsd"
+	"kodkbzw"
+	"kodrrlzaccoqx"
+	"koegwvegmrvjs"
+	"kofrbxmwgdreiz"
+	"kofrwgak"
+	"kofxwiopdpxozh"
+	"kohqz"
+	"kohrx"
+	"kohzijhqkqo"
+	"kokevcrhj"
+	"kolzkwxftqduiv"
+	"kom"
+	"komh"
+	"kommwxabqi"
+	"kondxbhteogmh"
+	"konliti"
+	"kopfllqpih"
+	"kora"
+	"korywgbxtpy"
+	"kosizbk"
+	"kotlvlljywtjw"
+	"kotrjfgq"
+	"kottsbrjtbj"
+	"kou"
+	"koupsmqxudzqa"
+	"kovlulxru"
+	"kowkqhczrxpztv"
+	"koxn"
+	"koxxyog"
+	"koy"
+	"koydpfscl"
+	"koylayfbqvdnen"
+	"kozkklxr"
+	"kozpwrqzdcrzoz"
+	"kozsyzrzvi"
+	"kpa"
+	"kpaot"
+	"kpaozdya"
+	"kpaxcajpkj"
+	"kpelru"
+	"kpjia"
+	"kpmoeehazprib"
+	"kpnlefphy"
+	"kpod"
+	"kppo"
+	"kppqrs"
+	"kpqq"
+	"kpqvpo"
+	"kprq"
+	"kprs"
+	"kprtusoibv"
+	"kpsstp"
+	"kptarh"
+	"kptdhfrw"
+	"kptefmekzfvms"
+	"kpukfsjb"
+	"kpulldfngc"
+	"kpvvjzx"
+	"kpwhgfdbf"
+	"kpxg"
+	"kpzvvwcwg"
+	"kq"
+	"kqceidqlhvkmdd"
+	"kqcj"
+	"kqctqw"
+	"kqdfhn"
+	"kqdpfzjqmo"
+	"kqenpekktng"
+	"kqfwqbp"
+	"kqgpoenldtif"
+	"kqia"
+	"kqjcm"
+	"kqjnmnnesj"
+	"kqkpyciporn"
+	"kqmshsjgzhi"
+	"kqowzhfdbe"
+	"kqpwmiiadiz"
+	"kqqmuhhub"
+	"kqrjlsenxdl"
+	"kqsxdgwbg"
+	"kqtassn"
+	"kquxsjdbovynvk"
+	"kqvhewekju"
+	"kqwima"
+	"kqwixirpwd"
+	"kqxctbznotmz"
+	"kqxehjr"
+	"krbllqokqg"
+	"krcdam"
+	"krcmij"
+	"krfunyjedwtzu"
+	"krfvkddefmdian"
+	"krglbr"
+	"krhssmuwbdkav"
+	"kricgisd"
+	"kridagvuvonzcu"
+	"krjbplhkz"
+	"krjoltptnr"
+	"krkpylwuuomqwf"
+	"krlcuwvqknr"
+	"krlwmtf"
+	"krlzz"
+	"krm"
+	"krmdtwh"
+	"krnafma"
+	"krobgqtiljpx"
+	"kroniasbdu"
+	"krpwckqm"
+	"krsgy"
+	"krsqb"
+	"krthxcd"
+	"krtlpm"
+	"krumekvu"
+	"krutomzozjalex"
+	"krxrpyw"
+	"krzmbwymmgh"
+	"ks"
+	"ksaajmdduw"
+	"ksagmashbdxks"
+	"ksakluwtwtpkx"
+	"ksakzw"
+	"kscbht"
+	"ksftwfzu"
+	"ksfwuapulmki"
+	"ksgfaziumlxiua"
+	"kshazhcqfujjp"
+	"ksjc"
+	"kskcdnaplot"
+	"kskczst"
+	"kskyg"
+	"ksllnewdd"
+	"kslxb"
+	"ksm"
+	"ksnd"
+	"ksoivblgocji"
+	"ksoovodauynr"
+	"kspiyuy"
+	"ksqloxgnbxa"
+	"ksqrnfzaxmmmin"
+	"kstobfqmjvr"
+	"ksuecr"
+	"ksuocibeuhqw"
+	"ksvkru"
+	"kswghmwapwvje"
+	"kswlriocqd"
+	"ksxbqoewqlsbld"
+	"ksxbzxtskre"
+	"kt"
+	"ktboipvdlj"
+	"ktcbyqtuvjg"
+	"ktcsm"
+	"ktcyxf"
+	"ktdoc"
+	"ktdvxibi"
+	"ktfcgx"
+	"ktiv"
+	"ktjvg"
+	"ktjzkgurmio"
+	"ktkm"
+	"ktngiwsuocf"
+	"ktoyxmrn"
+	"ktpkseexvzcjal"
+	"ktqdar"
+	"ktqilkkdjhtywp"
+	"ktqlkthm"
+	"ktqnjbpj"
+	"ktqnlkty"
+	"ktqshupgglj"
+	"ktrgqld"
+	"ktst"
+	"kttjcu"
+	"ktvonhxlopp"
+	"ktvy"
+	"ktwmhusa"
+	"ktxgmutlsms"
+	"ktybknalllttvn"
+	"ktyf"
+	"ktz"
+	"ktzeomjayy"
+	"ku"
+	"kua"
+	"kubhulslsdvik"
+	"kubj"
+	"kubtmwewmsjnb"
+	"kud"
+	"kufaajwrxt"
+	"kugcw"
+	"kuggacei"
+	"kugs"
+	"kuhfzegq"
+	"kuiec"
+	"kujfbdxd"
+	"kuoapwpea"
+	"kuoenmrm"
+	"kuosfuetcefms"
+	"kup"
+	"kuqj"
+	"kurbtfhevoa"
+	"kurmnl"
+	"kuryubuoq"
+	"kusghzx"
+	"kut"
+	"kutt"
+	"kutzxjkfti"
+	"kuugzf"
+	"kuuhnazqgd"
+	"kuvtnnebrb"
+	"kuw"
+	"kuwf"
+	"kuwfhf"
+	"kuwqqsjadcyrid"
+	"kuyaivjsapnk"
+	"kuyr"
+	"kuzyqrlcknpi"
+	"kv"
+	"kvarvposeztlz"
+	"kvb"
+	"kvbleeqnyuu"
+	"kvcxcn"
+	"kvdc"
+	"kveasbb"
+	"kvefmlywxt"
+	"kvekg"
+	"kveql"
+	"kvequarvkyqiz"
+	"kvfltsab"
+	"kvgi"
+	"kvhhsiwiunatfq"
+	"kvhsbtau"
+	"kvi"
+	"kvia"
+	"kviolaetvndy"
+	"kviqkeixf"
+	"kvja"
+	"kvka"
+	"kvnolbza"
+	"kvo"
+	"kvphigtkqm"
+	"kvpihhi"
+	"kvqmgrkana"
+	"kvqncsum"
+	"kvqpwfwv"
+	"kvqrhhzefwfpfr"
+	"kvqulkpjt"
+	"kvqwnfxcqmre"
+	"kvr"
+	"kvrblbwe"
+	"kvsjjdaq"
+	"kvsybqbrgiwoyv"
+	"kvtmvta"
+	"kvvqmmmh"
+	"kvxecuyjtzj"
+	"kvxidvlbj"
+	"kvyffvo"
+	"kvznkszwimy"
+	"kw"
+	"kwacqjfvpcn"
+	"kwalkpmafmz"
+	"kwarmuiyyex"
+	"kwbngkdqczou"
+	"kwbosck"
+	"kwbrktzcwqxmu"
+	"kwcmbratq"
+	"kwerfkaol"
+	"kwgdpghoem"
+	"kwglvbovkcvb"
+	"kwhcu"
+	"kwhtkuicyyzx"
+	"kwjpezqzk"
+	"kwjtiizztteh"
+	"kwjxinmxk"
+	"kwkzeiwg"
+	"kwoyufi"
+	"kwqasfwhozmwrv"
+	"kws"
+	"kwvdb"
+	"kwvlpubt"
+	"kwwp"
+	"kwy"
+	"kwympfckqoht"
+	"kwyxuqdjsz"
+	"kwzdechujk"
+	"kwzrluywc"
+	"kx"
+	"kxayzsze"
+	"kxcpnmcltzafdy"
+	"kxczvo"
+	"kxggsiy"
+	"kxgoczgxbuho"
+	"kxgxskwzy"
+	"kxibxafao"
+	"kxibzxvymcw"
+	"kxivdazbzz"
+	"kxjfuxwc"
+	"kxjhdr"
+	"kxjnx"
+	"kxjre"
+	"kxkfxhpam"
+	"kxlnkufwg"
+	"kxnucku"
+	"kxnxlklt"
+	"kxptlywu"
+	"kxribllfj"
+	"kxu"
+	"kxuuu"
+	"kxuwota"
+	"kxwebfe"
+	"kxwmqy"
+	"kxwsvmaauxhp"
+	"kxxnrjeuegd"
+	"kxzuffyg"
+	"ky"
+	"kyb"
+	"kybunvrlvj"
+	"kyc"
+	"kycg"
+	"kycvr"
+	"kydofovyargq"
+	"kydpy"
+	"kydxu"
+	"kyf"
+	"kyfaqxsqncuy"
+	"kyg"
+	"kyhuwgyag"
+	"kyihkkkw"
+	"kykffl"
+	"kykngsm"
+	"kylkuupgtwhi"
+	"kymupzxvxmywod"
+	"kymvyexfkm"
+	"kypvhndtobln"
+	"kyqcxraeqw"
+	"kysjbho"
+	"kytbuwgbp"
+	"kytiwed"
+	"kytzaykj"
+	"kyuo"
+	"kywdsapgm"
+	"kywhjp"
+	"kywy"
+	"kyxjstyaxb"
+	"kyyalllx"
+	"kz"
+	"kzfmuvn"
+	"kzfsppashtb"
+	"kzg"
+	"kzgmaqgoeavhp"
+	"kzht"
+	"kzibwhmss"
+	"kzjmoplbmwparp"
+	"kzkmfmiiilj"
+	"kzmwh"
+	"kznwcbbxrsxpd"
+	"kzqnchykhsjw"
+	"kzqtszxlwrlkpk"
+	"kzrkubnh"
+	"kzrro"
+	"kztjxugkww"
+	"kzujgcplqxvyer"
+	"kzv"
+	"kzwashgzpfw"
+	"kzwwcwxainwe"
+	"kzymfh"
+	"kzz"
+	"kzzc"
+	"kzzmnilcwbzuhz"
+	"laa"
+	"lad"
+	"ladtmkalzkzmaq"
+	"laewac"
+	"laf"
+	"lafftlz"
+	"lafmwwa"
+	"lah"
+	"laincnniymxq"
+	"lajsbnlpulvta"
+	"lalbspgzegonp"
+	"lamwq"
+	"lanzxooqeprx"
+	"laozl"
+	"lapwdimseibdjk"
+	"latpmogftta"
+	"latsfzcputfvse"
+	"latyetevpeq"
+	"lauaymihlflijn"
+	"lav"
+	"lavsv"
+	"laxp"
+	"laz"
+	"lb"
+	"lbckqmrule"
+	"lbe"
+	"lbegz"
+	"lbeyfmquwgznsm"
+	"lbfguk"
+	"lbgnfyawazhaf"
+	"lbifzk"
+	"lbj"
+	"lbklnv"
+	"lbkzlsiymrwc"
+	"lbob"
+	"lbqosxvo"
+	"lbsbjgb"
+	"lbsdzv"
+	"lbustdjan"
+	"lbuwmxwq"
+	"lbwbkswpgmt"
+	"lbwfjgzcdaoi"
+	"lbxz"
+	"lbycwcdkd"
+	"lbypoolbze"
+	"lbzzhvhg"
+	"lc"
+	"lcagkd"
+	"lcbrffaizejf"
+	"lcc"
+	"lcdi"
+	"lceolg"
+	"lcfvfggzutbqt"
+	"lcgmtoxgqxc"
+	"lchthkgyr"
+	"lchv"
+	"lciku"
+	"lcjkidygyr"
+	"lcjnmisggg"
+	"lckts"
+	"lcmmuzfzd"
+	"lcnhyyefid"
+	"lcnulnufqlh"
+	"lcoqznmyicoo"
+	"lcpepmwgfjs"
+	"lcszliq"
+	"lcth"
+	"lctzgydfnuwi"
+	"lcupldk"
+	"lcw"
+	"lcwylflwzvwjjx"
+	"lcxzhgd"
+	"lcz"
+	"ld"
+	"ldatxfpevlorrw"
+	"ldc"
+	"ldchvexsegc"
+	"ldctepdcqxnuqk"
+	"lddeaabvyxdbf"
+	"ldjifpxkb"
+	"ldkpiifx"
+	"ldlgwbmqfsxjdb"
+	"ldlwusoe"
+	"ldndoirq"
+	"ldoglxgauaw"
+	"ldqbdnnxagmcr"
+	"ldrdxxcmoqx"
+	"ldsceccdmqien"
+	"ldsyt"
+	"ldt"
+	"ldtfrhxamtk"
+	"ldwgxadhxwt"
+	"ldwhidpnmtlrl"
+	"ldzkxmuxfnr"
+	"le"
+	"leabrxeewx"
+	"leaqncrwveoy"
+	"lec"
+	"leeanebgmwiatt"
+	"leecbqwevbyv"
+	"leezmsxdfgq"
+	"lefla"
+	"legk"
+	"lehhpikbio"
+	"leijtlarb"
+	"lejz"
+	"lelxkscpaezce"
+	"lembcicypgo"
+	"lengl"
+	"leqncyyzbouzr"
+	"leqyscdhjya"
+	"lescbjzu"
+	"lesjdcmsjc"
+	"leus"
+	"leutjyxoktqwyc"
+	"levaqbu"
+	"leweuvyionjxem"
+	"leyfcfnngk"
+	"lf"
+	"lfar"
+	"lfbv"
+	"lfbzlcthv"
+	"lfclboamhe"
+	"lfeeswh"
+	"lfeyukfaj"
+	"lffngtwuhplmp"
+	"lfhbitxjftngl"
+	"lfhkzbtt"
+	"lfjqq"
+	"lflapsdlvwkj"
+	"lfljhihudfm"
+	"lflzoeg"
+	"lfmnfxb"
+	"lfmwigvkqlg"
+	"lfmxbezjqwtnuf"
+	"lfnlxogzuyx"
+	"lfoqzfblzlfv"
+	"lfpcexgvbbv"
+	"lfpiuqeifw"
+	"lfrysxjprfn"
+	"lfsnxoq"
+	"lfwcxp"
+	"lfzrjgfqncmiog"
+	"lfzrl"
+	"lg"
+	"lgafi"
+	"lgdeykqmqdpaco"
+	"lgdivnhibvdva"
+	"lge"
+	"lgecngxeu"
+	"lgg"
+	"lggddwnlouw"
+	"lgk"
+	"lgkmbk"
+	"lgnccditi"
+	"lgnoustuiobokb"
+	"lgnzcighye"
+	"lgodqclhvsptb"
+	"lgpsc"
+	"lgptcpu"
+	"lgrgqzyf"
+	"lgs"
+	"lgsimbunmw"
+	"lgw"
+	"lgy"
+	"lgyglqpva"
+	"lgyicppvdkwmtj"
+	"lgyw"
+	"lh"
+	"lhbdgyv"
+	"lhbsjfjbzlim"
+	"lhbtmt"
+	"lhbwcopzebhj"
+	"lhcbpdmxrxgn"
+	"lhcqg"
+	"lhcyr"
+	"lhczk"
+	"lhd"
+	"lhdwborrz"
+	"lhe"
+	"lheqdjaitzrs"
+	"lhevfudgwg"
+	"lhgwyqegsvx"
+	"lhgzreamn"
+	"lhkw"
+	"lhlhcnalpedri"
+	"lhlovothz"
+	"lhlzrceklq"
+	"lhnef"
+	"lhomrmqhef"
+	"lhoseowfepc"
+	"lhqldqzhp"
+	"lhtcdhljgkuj"
+	"lhumcu"
+	"lhwaktmj"
+	"lhwgpqjdfpy"
+	"lhwht"
+	"lhxbymxhuysshq"
+	"li"
+	"libheoypzf"
+	"licj"
+	"liclqaigggvclh"
+	"licqiqkn"
+	"lid"
+	"lidjwnoawhxtl"
+	"lidxxxcwlm"
+	"ligbfrytsqbafl"
+	"ligfvzuddfgeh"
+	"lihgdipkcy"
+	"lihko"
+	"lihqesyznkpyxd"
+	"lijfraaiurwsa"
+	"likjefcovfthms"
+	"liks"
+	"limp"
+	"limw"
+	"liogoys"
+	"lipdcicoisg"
+	"lipmv"
+	"lir"
+	"lirxehxfk"
+	"lirygzisuf"
+	"listbjuuslvm"
+	"liunfytc"
+	"livwe"
+	"liwyjpfvjqafh"
+	"liysjzile"
+	"lizrwmkbdf"
+	"lj"
+	"ljau"
+	"ljbggfycpng"
+	"ljbgoawtycp"
+	"ljcb"
+	"ljci"
+	"ljdyjpwgucej"
+	"ljelibio"
+	"ljf"
+	"ljfnnvfrwxsl"
+	"ljfoqsrbjt"
+	"ljfu"
+	"ljgaiur"
+	"ljhbofzejbw"
+	"ljiog"
+	"ljivjcjb"
+	"ljjymfidssulo"
+	"ljkfwehmtyod"
+	"ljmdsehxxami"
+	"ljmvwso"
+	"ljmxtuohydubho"
+	"ljov"
+	"ljrvrwfgl"
+	"ljtejvwandxsx"
+	"ljulznko"
+	"ljvxffmxcqilv"
+	"ljwlkjcdjxu"
+	"ljwlxzkladm"
+	"ljwvshi"
+	"lk"
+	"lkalr"
+	"lkanzstuuxchgs"
+	"lkcaklwhho"
+	"lkftmgiw"
+	"lkgmbxu"
+	"lkgxgyfu"
+	"lkhvwrbvo"
+	"lkjiuzowi"
+	"lkknmfghcvf"
+	"lkkpawflojvbr"
+	"lkkx"
+	"lklz"
+	"lkmjfpfwyxnbvt"
+	"lkoycoza"
+	"lkqjtsxcsmmk"
+	"lkrq"
+	"lkrrincmgxox"
+	"lksetjhdsz"
+	"lktupqrawzcbh"
+	"lkurbkued"
+	"lkvfncqdg"
+	"lkvrmp"
+	"lkxdb"
+	"lkysmux"
+	"lkytvvtkq"
+	"ll"
+	"llalcdpoqrtdbf"
+	"llbvkkwoccozzv"
+	"lle"
+	"lleogrprjtg"
+	"llezgsxajgkmng"
+	"llglrwg"
+	"llgs"
+	"llgxcvktprhhp"
+	"llhskwcucxcbub"
+	"llnnba"
+	"llr"
+	"llrat"
+	"llrqrj"
+	"lls"
+	"llsnloqlblj"
+	"llthijkehqrpv"
+	"lluadozymjw"
+	"llucficrnuicvy"
+	"llvpsenf"
+	"llwabaqyawchk"
+	"llx"
+	"llxazjbmd"
+	"llyubr"
+	"llzzvzdih"
+	"lm"
+	"lmalwdoenhjm"
+	"lmctgtxtyxx"
+	"lmcwfeq"
+	"lmephgnnuhdtvu"
+	"lmeyutbp"
+	"lmfwctwuauz"
+	"lmghmeduwgvqm"
+	"lmhscaras"
+	"lmhvplowxw"
+	"lmjsra"
+	"lmlnh"
+	"lmo"
+	"lmql"
+	"lmstogr"
+	"lmtaslv"
+	"lmtgczdo"
+	"lmtomti"
+	"lmuemcpiso"
+	"lmumvjeof"
+	"lmupnsdrtufwil"
+	"lmutqbzrbxok"
+	"lmvjtiagmlq"
+	"lmvvhtu"
+	"lmwe"
+	"lmwrybhmjnobz"
+	"lmx"
+	"ln"
+	"lnarxkgeoox"
+	"lnavbixdkqek"
+	"lnaykmlhoxhzct"
+	"lnbfpvimsgmihc"
+	"lnbx"
+	"lncdzf"
+	"lncngdhlw"
+	"lncnzkwgz"
+	"lndfgedyfzqezt"
+	"lnejrgbno"
+	"lnfja"
+	"lnhqaiybwbgz"
+	"lnis"
+	"lnjn"
+	"lnnodqiznathf"
+	"lnnvmsrtzknrfr"
+	"lnog"
+	"lnomncpfqvgfd"
+	"lnpuob"
+	"lnqkdvlooba"
+	"lnshoimlmzsh"
+	"lnsybtndp"
+	"lnujbshxyk"
+	"lnvqopmra"
+	"lnvuyspkdlzv"
+	"lnxcbhtzpkns"
+	"lnygsptvcnlk"
+	"lnyqnyacdomy"
+	"lo"
+	"loa"
+	"loaqy"
+	"lobw"
+	"loewdnhev"
+	"logfhgcp"
+	"loglw"
+	"loifxpyukkiw"
+	"loizzuaadffli"
+	"loj"
+	"lojcicowyrfwn"
+	"lolvj"
+	"lolyk"
+	"lomdujc"
+	"lomhnklown"
+	"lomhxdxh"
+	"lomiiqayikle"
+	"loprq"
+	"loqdalbpdtkxf"
+	"loqrxbfjuxwr"
+	"lorhucdscu"
+	"loricf"
+	"losuasaptvodxe"
+	"lotfcx"
+	"louekjkcjvf"
+	"loueubzksku"
+	"lov"
+	"loxlunwcvubk"
+	"loykblacwa"
+	"lp"
+	"lpaw"
+	"lpcwsggg"
+	"lpdfh"
+	"lpdfmj"
+	"lpefbtao"
+	"lpefigmqzve"
+	"lpeoeuwpe"
+	"lpeotc"
+	"lpgdajekwlnk"
+	"lpgxawffako"
+	"lphcugnm"
+	"lpi"
+	"lpihzqyk"
+	"lplm"
+	"lpo"
+	"lpokljzrdkmxf"
+	"lppvvxetzjudr"
+	"lpqeyfwenybcl"
+	"lprefnxjgngwns"
+	"lprri"
+	"lpryniyctl"
+	"lpsiyyhdtd"
+	"lpsrmeqxkujhu"
+	"lpsvykdy"
+	"lpthz"
+	"lpuwdfqzk"
+	"lpw"
+	"lpxyapiwbljy"
+	"lpyoq"
+	"lpyrq"
+	"lpz"
+	"lpzuocgpdlc"
+	"lq"
+	"lqccbqwywwz"
+	"lqeybrhrvgiw"
+	"lqgdnfymgonjf"
+	"lqgkdmatl"
+	"lqhr"
+	"lqihmvfdkntpv"
+	"lqikozjyjlzyp"
+	"lqiukgqcdhkpsx"
+	"lqll"
+	"lqlmtidiqdpc"
+	"lqqcfgax"
+	"lqrtskwbzxmo"
+	"lqruvedyygoivu"
+	"lqrzyywtnjdrh"
+	"lqtlnsjln"
+	"lqttqjg"
+	"lqturiid"
+	"lqtvfsqvzhao"
+	"lqxhbbtposs"
+	"lqxqksoji"
+	"lqxs"
+	"lqyicpcyghqzt"
+	"lqynlnfkzyn"
+	"lqyvscx"
+	"lqzmgzeskdhfkw"
+	"lr"
+	"lrbdoibs"
+	"lrbfxfol"
+	"lrdewjhtur"
+	"lrdfbdgysb"
+	"lrdnxarsqv"
+	"lrdsbassleylnq"
+	"lrfjghfdu"
+	"lrgzgvhxolzj"
+	"lrhhixxetcoal"
+	"lrjn"
+	"lrlqjveeooy"
+	"lrltt"
+	"lrp"
+	"lrprf"
+	"lrq"
+	"lrqoykytofshrb"
+	"lrtdar"
+	"lrtgxc"
+	"lrtuywsqhabpd"
+	"lrvmfxt"
+	"lrvmiisex"
+	"lrwrhwbfz"
+	"lrxjidacswxovv"
+	"lryceretpoxy"
+	"lryebm"
+	"lrzugksdsf"
+	"lrzv"
+	"ls"
+	"lsalwshiqdaeq"
+	"lsd"
+	"lse"
+	"lsfgrrownar"
+	"lsgnuynuqdxh"
+	"lsikgwgsjjzf"
+	"lsjfgn"
+	"lsk"
+	"lskoyptmudlm"
+	"lsl"
+	"lsladm"
+	"lsmcxe"
+	"lsmgnaigqlgs"
+	"lsnwmdm"
+	"lsqa"
+	"lsqchlkqibtie"
+	"lsqjnimyifbh"
+	"lsrqrzxbikjpq"
+	"lssfacgfu"
+	"lstemx"
+	"lsxgasxtjlsfls"
+	"lsxzpflsjst"
+	"lsyboysbdxlfp"
+	"lsyrcbckho"
+	"lsyyce"
+	"lszuenoycyxle"
+	"lt"
+	"ltafi"
+	"ltcgk"
+	"ltcwh"
+	"ltfqdvhujp"
+	"ltgfmy"
+	"ltgfzh"
+	"lthxufzrrigy"
+	"ltiddfprzp"
+	"ltjekawzzg"
+	"ltkoqmoktctcv"
+	"ltkxolpuqoyck"
+	"ltlhazrtfotejm"
+	"ltndijpt"
+	"ltnpgyrzjvs"
+	"ltoawxu"
+	"ltphkftyf"
+	"ltqslb"
+	"ltqttkecwccb"
+	"ltqxrgy"
+	"ltrmkcucqhwe"
+	"lts"
+	"ltsgfqnpzwqxq"
+	"ltvxkduazc"
+	"ltvzpaxodwu"
+	"ltxbaajcsqm"
+	"ltxhmr"
+	"ltxqfpbvxo"
+	"ltybxnf"
+	"ltycbjwyyog"
+	"ltyhommtf"
+	"ltymnme"
+	"ltyqmtex"
+	"ltzbgj"
+	"lu"
+	"luav"
+	"lubxl"
+	"lucegwt"
+	"ludgtcwbctj"
+	"lueggiqugxgos"
+	"luezomtk"
+	"lugxxdtpfronnh"
+	"luhidne"
+	"luhlof"
+	"luiiiip"
+	"luiik"
+	"luixlshljpclzd"
+	"lul"
+	"lulwediqzgmer"
+	"lun"
+	"lunkgdljearkfj"
+	"lunlswijrovca"
+	"lunurhq"
+	"luoifvlg"
+	"lurkkj"
+	"lut"
+	"luugtwxvspqx"
+	"luuq"
+	"luvqeeujtpr"
+	"luwijannfplgk"
+	"luzfdcg"
+	"lv"
+	"lva"
+	"lvbwuvyt"
+	"lvcbxfr"
+	"lvcdtxb"
+	"lvdbjrviihk"
+	"lveamqbgjc"
+	"lveiwwlaq"
+	"lvgtxgthz"
+	"lvhfyd"
+	"lvhha"
+	"lvjewjcnh"
+	"lvjnwfd"
+	"lvkbpaetylnpc"
+	"lvksmultjg"
+	"lvl"
+	"lvlkar"
+	"lvlmsd"
+	"lvm"
+	"lvmcitof"
+	"lvmybvm"
+	"lvnhry"
+	"lvnldkhjjily"
+	"lvokides"
+	"lvpqnhmy"
+	"lvrjg"
+	"lvtbrrdimbzm"
+	"lvunipbwysscc"
+	"lvvhaz"
+	"lvvzc"
+	"lvwirdpq"
+	"lvwnck"
+	"lvwnrkflbg"
+	"lvwvwiqpx"
+	"lvxa"
+	"lvxaeavg"
+	"lvxrbghzsijigq"
+	"lvycsjo"
+	"lvzkpzacghcxeh"
+	"lvzplr"
+	"lw"
+	"lwb"
+	"lwbhlztwif"
+	"lwdsadaj"
+	"lwfxijguscqlp"
+	"lwfy"
+	"lwgoggvhdmzsfh"
+	"lwhbjk"
+	"lwhlcmcfmvpccm"
+	"lwhxdpupipeiuy"
+	"lwjhwcdfr"
+	"lwjmqla"
+	"lwjzgqavambbx"
+	"lwlshkrm"
+	"lwlwavpq"
+	"lwnczku"
+	"lwnfwsrvldkcgb"
+	"lwnq"
+	"lwobsuqjwqmfa"
+	"lwpjrev"
+	"lwqguggqauc"
+	"lwshatheoydpd"
+	"lwsnitejsz"
+	"lwsqmjgihuogkm"
+	"lwvddw"
+	"lwvjgkvis"
+	"lwwe"
+	"lwwukophwg"
+	"lwxhlpl"
+	"lwz"
+	"lwze"
+	"lwzxt"
+	"lx"
+	"lxbt"
+	"lxckd"
+	"lxewkquwzhkiu"
+	"lxihgvdmgj"
+	"lxklc"
+	"lxl"
+	"lxlssprgw"
+	"lxmcszbeb"
+	"lxmvybazuxj"
+	"lxohaqyfu"
+	"lxopeakn"
+	"lxpylirodnu"
+	"lxqhvbehszj"
+	"lxqmalu"
+	"lxrfyyb"
+	"lxsyeensucsxie"
+	"lxterduzu"
+	"lxtgkhhappmkie"
+	"lxtv"
+	"lxvkqsrslpe"
+	"lxyeds"
+	"lxykybifyjn"
+	"lxypjmjda"
+	"lxywlx"
+	"lxzinl"
+	"ly"
+	"lyaiz"
+	"lycwybgofonsr"
+	"lycxgrwz"
+	"lydiomxkjeppm"
+	"lydnxlbaawaok"
+	"lyffwxvjt"
+	"lyjinz"
+	"lyjllkzobtcxe"
+	"lykvjdymz"
+	"lylfhtgthd"
+	"lyn"
+	"lyp"
+	"lypvgg"
+	"lyqjbvuthvycb"
+	"lyqoi"
+	"lyqyx"
+	"lyrsig"
+	"lyspvr"
+	"lytdgeyyxbyovb"
+	"lyto"
+	"lyuyqq"
+	"lyvjtlfcelujzq"
+	"lyw"
+	"lywo"
+	"lyxicnkqq"
+	"lyxpnvpket"
+	"lyxt"
+	"lyznfjgcbziiy"
+	"lz"
+	"lzaoikcl"
+	"lzbzdomaep"
+	"lzcdnuhzx"
+	"lzdewjgaeccmw"
+	"lzefnwjrew"
+	"lzflponekpm"
+	"lzhknt"
+	"lzjndud"
+	"lzkmfy"
+	"lzkqwb"
+	"lzkvxjqqbka"
+	"lzmmehstuzdire"
+	"lznk"
+	"lznnwswrtcd"
+	"lzpll"
+	"lzpssxooprnlzb"
+	"lzqiidmtnc"
+	"lztb"
+	"lztnqdoheoh"
+	"lzu"
+	"lzuikdwggkts"
+	"lzvqyarrsr"
+	"lzwkg"
+	"lzwmfjug"
+	"lzwxpklisc"
+	"lzyoyal"
+	"lzyxnj"
+	"lzztc"
+	"ma"
+	"maaankzlvj"
+	"maakpjmnqnd"
+	"mab"
+	"macvxdkjcy"
+	"madh"
+	"madyaoloobqr"
+	"maexr"
+	"magm"
+	"magqpotnp"
+	"magvo"
+	"mahiqehbjcbt"
+	"mahjbu"
+	"mahmbfm"
+	"majxkndr"
+	"malgcdy"
+	"malqjhmpmlb"
+	"mampwo"
+	"manppyw"
+	"manyglvtem"
+	"maobhjarb"
+	"mapchedlltc"
+	"mapjctbs"
+	"maqrtk"
+	"markqqmina"
+	"masw"
+	"matf"
+	"matw"
+	"mau"
+	"mauonb"
+	"mawa"
+	"maxlf"
+	"maybzercnxjlcp"
+	"mb"
+	"mbblzegks"
+	"mbdsvtzyhca"
+	"mbekvmrzctyojk"
+	"mbg"
+	"mbgifkikb"
+	"mbgolmkeresn"
+	"mbgqet"
+	"mbjfbksgfzs"
+	"mbkiejqz"
+	"mbkkdknatazlzf"
+	"mblbiajkcla"
+	"mblbprdkaua"
+	"mbnnc"
+	"mbovcgdrolziq"
+	"mbpcxbqohih"
+	"mbqnaqvhsop"
+	"mbrkdhzfjdjdcv"
+	"mbthitjdcvxsqe"
+	"mbubjlhx"
+	"mbuqf"
+	"mbybex"
+	"mca"
+	"mcajzk"
+	"mcbnpm"
+	"mccaixedehu"
+	"mccazquay"
+	"mcccjwoke"
+	"mcdmsequh"
+	"mcehtses"
+	"mcemh"
+	"mcenzdmb"
+	"mceyrdcaepiqqt"
+	"mcezzgps"
+	"mcfrnxe"
+	"mch"
+	"mchybhpraaqz"
+	"mcih"
+	"mcjkm"
+	"mcjrhk"
+	"mcmm"
+	"mcmwcfmht"
+	"mcmzqsujmil"
+	"mcmzqsx"
+	"mcnhpkftudhc"
+	"mcrmeqfc"
+	"mcrxcpgppaidbg"
+	"mcsrazttz"
+	"mcwcyh"
+	"md"
+	"mdakn"
+	"mdbwo"
+	"mdcudsqhgvikb"
+	"mddncs"
+	"mddvkttuwws"
+	"mdfzhdojxkgikf"
+	"mdg"
+	"mdixubzzcxmr"
+	"mdjfumvrcmgpyx"
+	"mdjzd"
+	"mdkxag"
+	"mdlnawkcuns"
+	"mdmrfzpoofyje"
+	"mdnaqttjrvai"
+	"mdojv"
+	"mdpdyzvcsnoj"
+	"mdpibroy"
+	"mdpkwjqobzpjk"
+	"mdpysfkapvpr"
+	"mdqrpdrfrbbew"
+	"mdsfrwfnbgs"
+	"mdsubhjtvo"
+	"mdtpdemtw"
+	"mdtpnmcmyxokvy"
+	"mdujzm"
+	"mdunp"
+	"mdvgnnujjuokb"
+	"mdwgoueuyian"
+	"mdwgyudutulaa"
+	"mdz"
+	"mdzpqbv"
+	"mdzttgkanox"
+	"mdzxarfuk"
+	"me"
+	"meadygnjkjud"
+	"meah"
+	"meaxt"
+	"meb"
+	"medjxrmvjbir"
+	"medlxothitffo"
+	"medzcgigvsaui"
+	"meefqpzfaqf"
+	"mefvki"
+	"mehgx"
+	"mehqsjhe"
+	"mehuhhxjvyjx"
+	"meirvdij"
+	"meizixi"
+	"mejxruilpedf"
+	"mejyalbpjgtn"
+	"mekuwwkngknj"
+	"menfoihtrg"
+	"menzugwgvcfx"
+	"meomfpoqsb"
+	"meoqpjxulhhszm"
+	"mepbgu"
+	"meqfyvv"
+	"meqslrskgtemh"
+	"mer"
+	"meredk"
+	"mew"
+	"mewn"
+	"mexb"
+	"mexeftqr"
+	"mexmaot"
+	"mexz"
+	"mey"
+	"meyojriqsms"
+	"meyxiuqychbli"
+	"mezsyujb"
+	"mfaqpplrnautv"
+	"mfb"
+	"mfbkbdr"
+	"mfctbh"
+	"mfcueuq"
+	"mfdgwejraqgjz"
+	"mfeozmb"
+	"mffhzjdbtgat"
+	"mfg"
+	"mfgtnhbbxuflfh"
+	"mfhjwn"
+	"mfjrwmgs"
+	"mfkt"
+	"mfltkg"
+	"mfokyfloo"
+	"mfqqvhfdrs"
+	"mfqqvxca"
+	"mfrfguqqmtmlss"
+	"mfrivanpfji"
+	"mfsyulcrojpxl"
+	"mftev"
+	"mfthupqe"
+	"mftljzzymtrpw"
+	"mfvsfkiqhps"
+	"mfwiltrpm"
+	"mfwjl"
+	"mfwlfqrc"
+	"mfwqhocx"
+	"mfwwyify"
+	"mfwxnuu"
+	"mfxqzwehego"
+	"mfxyrighpor"
+	"mfyb"
+	"mfyndfygc"
+	"mg"
+	"mgdeymvlg"
+	"mge"
+	"mgguu"
+	"mghxvualvpbsf"
+	"mgkksjmpn"
+	"mgmqllwyvtbt"
+	"mgmtlox"
+	"mgol"
+	"mgotcqdobdg"
+	"mgozgbojb"
+	"mgpzjcwldtt"
+	"mgq"
+	"mgqgsydhg"
+	"mgqkgj"
+	"mgruxryqfdqok"
+	"mgskeuikugtb"
+	"mgveq"
+	"mgvoa"
+	"mgxcjeggcrn"
+	"mgyzimwdsnvhj"
+	"mgzaxlsygv"
+	"mgzoianxotpf"
+	"mh"
+	"mhb"
+	"mhbvrhiitjj"
+	"mhbvwjcqyaccn"
+	"mhcg"
+	"mhdrqk"
+	"mhf"
+	"mhjbdu"
+	"mhjli"
+	"mhjswivvjldste"
+	"mhk"
+	"mhkifz"
+	"mhl"
+	"mhll"
+	"mhltzglru"
+	"mhmdkkywmdav"
+	"mhmizbxmb"
+	"mhmld"
+	"mhmnxjrqy"
+	"mhnsusfxgror"
+	"mhohzllhf"
+	"mhoqeflekr"
+	"mhpgjgql"
+	"mhpom"
+	"mhptskr"
+	"mhpurwzkd"
+	"mhpwgpbzzi"
+	"mhqarubu"
+	"mhqbtqmau"
+	"mhs"
+	"mhtnije"
+	"mhuftdxjwjkj"
+	"mhx"
+	"mhxqerydnr"
+	"mhyqrdadsoju"
+	"mhyrbmswgz"
+	"mi"
+	"mibyynov"
+	"mic"
+	"micxhfcoa"
+	"miecblqfgypss"
+	"miewagrew"
+	"mifrjxoiqwcwax"
+	"migt"
+	"migyxrxrfvnl"
+	"mihxsthccj"
+	"miigu"
+	"miimpwoun"
+	"mijliqiuo"
+	"mijmosjlpnsi"
+	"mikzdueglpuk"
+	"milge"
+	"mimkcjeiuvae"
+	"mimo"
+	"minbiicxlwikmv"
+	"minefx"
+	"minyncfpoag"
+	"miohxntzauyle"
+	"miojhtcdqxdj"
+	"miomie"
+	"miproieur"
+	"misgpppht"
+	"mismoihgezi"
+	"mitbkvphmcgr"
+	"mitib"
+	"miticfmdz"
+	"mitihiegakggt"
+	"miv"
+	"mivfgoumygfa"
+	"mivsxsslhbbiih"
+	"miw"
+	"mixbfhduzfncw"
+	"miy"
+	"mizcc"
+	"mj"
+	"mjbfu"
+	"mjbrajw"
+	"mjdqlmhwad"
+	"mjfgvzshpeqzdh"
+	"mjfwwnvlbthk"
+	"mjghfdpre"
+	"mjgjwylwpjv"
+	"mjhfphush"
+	"mjhujrebtq"
+	"mjiaxiklj"
+	"mjiy"
+	"mjjdqhxck"
+	"mjjz"
+	"mjk"
+	"mjlfgpiuh"
+	"mjmoxnxuevhu"
+	"mjn"
+	"mjnliiwabcopes"
+	"mjnqwwhn"
+	"mjnszrjczy"
+	"mjntsj"
+	"mjqcyhtiywhcv"
+	"mjrgusjgs"
+	"mjv"
+	"mjvkt"
+	"mjxcvtlvohpjq"
+	"mjymg"
+	"mjynpl"
+	"mjzr"
+	"mk"
+	"mka"
+	"mkbbdx"
+	"mkcsy"
+	"mke"
+	"mkeeoqceada"
+	"mkf"
+	"mkgawdsny"
+	"mkgbdzprbz"
+	"mkhk"
+	"mkir"
+	"mkjssl"
+	"mkjy"
+	"mkmqsjnxbhix"
+	"mkmwhxaf"
+	"mkndlngjna"
+	"mkpfprq"
+	"mkpoih"
+	"mkqzptsj"
+	"mkrjal"
+	"mktwzyelc"
+	"mkw"
+	"mkydnfsazshe"
+	"mkyqaoymc"
+	"mkzxvspdum"
+	"ml"
+	"mlayipjyqtr"
+	"mlbnu"
+	"mlchustznymbsg"
+	"mlcudlkv"
+	"mlcxucdfjj"
+	"mldssrsxbxi"
+	"mleastpqfdpjem"
+	"mlht"
+	"mliuvuaguxt"
+	"mljykozw"
+	"mlmhrgsrnyex"
+	"mlmiyrhimzeue"
+	"mlpebryhjtg"
+	"mlpzdmei"
+	"mlq"
+	"mlqcctczb"
+	"mlrxbkkpaibii"
+	"mlsm"
+	"mlstexxjt"
+	"mlu"
+	"mlv"
+	"mlvenvnvhvarle"
+	"mlwvbxgnjh"
+	"mlxpal"
+	"mlxu"
+	"mlyzise"
+	"mm"
+	"mmaefrz"
+	"mmavycbsapdue"
+	"mmbhdwcitaytx"
+	"mmbqrdoxue"
+	"mmc"
+	"mmcdwttxkhhvdd"
+	"mmcivormxgsf"
+	"mmckkeiito"
+	"mmdzafgtsh"
+	"mmehlyrpex"
+	"mmejw"
+	"mmenossnqjvpef"
+	"mmewddgvsvidm"
+	"mmfquzims"
+	"mmfsckiakj"
+	"mmgddzqkxyj"
+	"mmghvqakbftu"
+	"mmgnfjnyvcpin"
+	"mmgu"
+	"mmiu"
+	"mmjnt"
+	"mmjwjhodgss"
+	"mmk"
+	"mmlsnfkise"
+	"mmmpvcwmvo"
+	"mmmqlo"
+	"mmnyfs"
+	"mmoawvhrecpm"
+	"mmojcpbpxdkfz"
+	"mmpatljbps"
+	"mmpmmm"
+	"mmq"
+	"mmqnjabld"
+	"mmqqroicfy"
+	"mmrrdodktpz"
+	"mmsbfureuipt"
+	"mmsxvawngeoo"
+	"mmtrgn"
+	"mmuaydopppppr"
+	"mmub"
+	"mmudlmeqaosdn"
+	"mmui"
+	"mmwgzulwxcu"
+	"mmxkdyryjispho"
+	"mmxmrqzhz"
+	"mmz"
+	"mn"
+	"mnaficxod"
+	"mnayaxmmojdi"
+	"mnbcwlnwt"
+	"mnbvtqdsxyvmr"
+	"mndbzzebqqdhvm"
+	"mndwtytxrd"
+	"mnfxgmoamftw"
+	"mnghqecwwxjg"
+	"mnijx"
+	"mnj"
+	"mnkifhsqxvnehw"
+	"mnldyssjhpe"
+	"mnlomewmgob"
+	"mnltcpz"
+	"mnmyfags"
+	"mnoskzvlnanl"
+	"mnpvkvcq"
+	"mnskzwjas"
+	"mntnhlwo"
+	"mnugp"
+	"mnujzzjznnvro"
+	"mnuuqgrcvkhvr"
+	"mnvnels"
+	"mnw"
+	"mnweinnotioxt"
+	"mnwwconnqbyt"
+	"mnxbmfl"
+	"mnyowuyla"
+	"mnyt"
+	"mnznyvssclffni"
+	"mo"
+	"mob"
+	"mod"
+	"modebzgsuqnb"
+	"moep"
+	"mofllvba"
+	"mofznp"
+	"mogldiyrcaei"
+	"mok"
+	"momuhmdaxqbfy"
+	"mopyfoom"
+	"moqlayqijd"
+	"moqmtgixunw"
+	"morcrrkc"
+	"morpzhf"
+	"mortw"
+	"motuv"
+	"mou"
+	"moyhxuksljau"
+	"mozuajbfmtokyg"
+	"mpa"
+	"mpcbokltscsmb"
+	"mpcebw"
+	"mpdnzufwvpgu"
+	"mperkdkb"
+	"mpgaukdlfkqqh"
+	"mpgbebbqi"
+	"mpjwtoydd"
+	"mpkmwgawtk"
+	"mpmchzvxvywcak"
+	"mpmmm"
+	"mppkwmz"
+	"mprrgyyodvugyy"
+	"mpsokebqvbgtct"
+	"mptnwax"
+	"mpviqstqsvf"
+	"mpxdzvlwn"
+	"mpxy"
+	"mpzqhndbnth"
+	"mq"
+	"mqcjr"
+	"mqi"
+	"mqijihvipdnnoe"
+	"mqjquv"
+	"mqkwijpsrzebcv"
+	"mqljuptrfeht"
+	"mqnokbmer"
+	"mqnxxvzanhgna"
+	"mqnyannwrvks"
+	"mqo"
+	"mqoifinyxncm"
+	"mqpco"
+	"mqqonp"
+	"mqqrqmyydynknv"
+	"mqqw"
+	"mqrkfe"
+	"mqslkuzjqgwpj"
+	"mqsxahmvavaq"
+	"mqsxtdimtttr"
+	"mqvkzsozyiokmb"
+	"mqvtfjcjybsusj"
+	"mqyizamxpe"
+	"mr"
+	"mrasqjaxmkdi"
+	"mrcihgumflaior"
+	"mrcnt"
+	"mrcxbrbalxvqxi"
+	"mrdezmvigxzucn"
+	"mreemydezgapf"
+	"mreyrqekocb"
+	"mribg"
+	"mridkxvrlkzaa"
+	"mrixadgkopi"
+	"mrixorcnac"
+	"mrjpkwhgxzfoen"
+	"mrll"
+	"mrngvhvgjecba"
+	"mrpdkwpeni"
+	"mrpi"
+	"mrpkkzu"
+	"mrrswjy"
+	"mrsdoglscmm"
+	"mrtekxsn"
+	"mrtghikbnvb"
+	"mru"
+	"mruvgenfdsdxjf"
+	"mrwj"
+	"mrzdieqnv"
+	"mrzepthyprngr"
+	"mrzyyuv"
+	"ms"
+	"msabfomrne"
+	"msalnlgcuwkgcz"
+	"msaq"
+	"msbkhifnt"
+	"msbzzq"
+	"msdaozsfuz"
+	"msdxpivl"
+	"mseqeqnmdt"
+	"msggrkgqgwq"
+	"mshbxypz"
+	"msingqtjogh"
+	"msjasuhzaykww"
+	"mslcbroz"
+	"mslizumint"
+	"mslmocvswikak"
+	"msmsnmzs"
+	"msmwuo"
+	"msoljlbkd"
+	"mspmdkatgdjb"
+	"msqtcdvowrugoy"
+	"msrnlfxddwnyt"
+	"mssbwbnwtv"
+	"mswwopq"
+	"mszjsfspvhs"
+	"mszlw"
+	"mszttfgmxxdsd"
+	"mt"
+	"mtagplw"
+	"mtav"
+	"mtb"
+	"mtbrwys"
+	"mtdxasgvm"
+	"mtew"
+	"mtfcfehx"
+	"mthazuvsacprm"
+	"mthkzzla"
+	"mtjbhniqdqfoj"
+	"mtjujtpnto"
+	"mtjxoonngve"
+	"mtkb"
+	"mtllkekkrwkubk"
+	"mtlmowqmlsgoll"
+	"mtmyfkciszhww"
+	"mtnszftw"
+	"mtps"
+	"mtqioepd"
+	"mtqrc"
+	"mtrfwnhhzikrbw"
+	"mtszkb"
+	"mtvb"
+	"mtwbysxvxm"
+	"mtwmmk"
+	"mtxsbxlz"
+	"mtxshdeqsbysp"
+	"mtzbfnhtcdwc"
+	"mu"
+	"muadevlls"
+	"muaoigfb"
+	"muauuipdrdyile"
+	"muaxbmu"
+	"mub"
+	"mubleyahxg"
+	"mubsvtwmbjvvcm"
+	"mubv"
+	"mucuzhjjb"
+	"muhdjs"
+	"muhmttcdkk"
+	"muhnumwzy"
+	"muje"
+	"muktupmnvuhf"
+	"mulhrgywu"
+	"mulojnnvtbsuq"
+	"mumna"
+	"mup"
+	"muqkckn"
+	"muvxnkomhv"
+	"muwqtcinv"
+	"muxtior"
+	"muydazmpu"
+	"muyxmmryozsre"
+	"muzxzbzb"
+	"mv"
+	"mvaohtpdazf"
+	"mvb"
+	"mvdd"
+	"mvdebfaej"
+	"mvenkcv"
+	"mvgbjhuqagxf"
+	"mviplexstg"
+	"mvm"
+	"mvmddlyllmp"
+	"mvobobi"
+	"mvoxoyha"
+	"mvp"
+	"mvrnkueflul"
+	"mvsknian"
+	"mvuflpag"
+	"mvuhviacorsyuq"
+	"mvxbu"
+	"mvxjzrorn"
+	"mvxzosoulqbxd"
+	"mvyfamultzyth"
+	"mvyjgydreq"
+	"mvzqaodtn"
+	"mvzssgvr"
+	"mwakwyspb"
+	"mwamnfs"
+	"mwbxhlifwp"
+	"mwcqfiuxdm"
+	"mwd"
+	"mwepsuyxwkv"
+	"mwhk"
+	"mwhwnlucrdbeb"
+	"mwibwwi"
+	"mwkh"
+	"mwkk"
+	"mwkqafikinxwco"
+	"mwljchlxad"
+	"mwpvjo"
+	"mwqh"
+	"mwrd"
+	"mwrdijts"
+	"mwsosl"
+	"mwsqbgxzo"
+	"mwtcbfuy"
+	"mwuqxfto"
+	"mwuxtrzaynlytk"
+	"mwvewq"
+	"mwvjwxcfrld"
+	"mwvscauzuagic"
+	"mww"
+	"mwwgspeafz"
+	"mwynxzlqnwn"
+	"mx"
+	"mxacodxn"
+	"mxb"
+	"mxbdihfyvdq"
+	"mxbhbofrusqybh"
+	"mxbhcq"
+	"mxbtwh"
+	"mxcbrrlue"
+	"mxczi"
+	"mxemyyjzyyqpvc"
+	"mxetwgqm"
+	"mxglqvblzwik"
+	"mxiiknhlmahzqy"
+	"mxildqkrn"
+	"mxmm"
+	"mxoub"
+	"mxoxk"
+	"mxpmlgd"
+	"mxqqgzaecz"
+	"mxqwnurugekrb"
+	"mxrag"
+	"mxs"
+	"mxtez"
+	"mxtievtmngr"
+	"mxtjct"
+	"mxuvrdycwiatc"
+	"my"
+	"myancms"
+	"mybbr"
+	"myc"
+	"mydcfgne"
+	"mydkspakyxas"
+	"myghaztctnxdt"
+	"mygydzcdbrhd"
+	"mygylo"
+	"myimzahaqkaez"
+	"myitogvgyufryy"
+	"mylfch"
+	"myljkbfsfudhu"
+	"mymowefyptfmvf"
+	"myoanqcc"
+	"mypezosd"
+	"mypnnn"
+	"myprpemkczkrb"
+	"myqwy"
+	"mysrfvgmnww"
+	"mywm"
+	"myxa"
+	"myxiprlfletux"
+	"myxmpbhjqzh"
+	"myxuoc"
+	"myycax"
+	"myytlqopscau"
+	"myzfzyrkjcqgqg"
+	"myzjpmogwkvanq"
+	"mz"
+	"mzbgeha"
+	"mzbhmszrhshwd"
+	"mzbuurjaqz"
+	"mzcajzkzx"
+	"mzekhv"
+	"mzf"
+	"mzffxd"
+	"mzfmqeuufsy"
+	"mzgb"
+	"mzhnzpfogw"
+	"mzjhjnl"
+	"mzjhpjxyjkz"
+	"mzjpeuelxgfuc"
+	"mzjre"
+	"mzl"
+	"mzlnf"
+	"mzmbrfa"
+	"mzmztdgwukwsl"
+	"mzngjtgmhu"
+	"mzpgq"
+	"mzq"
+	"mztpxdl"
+	"mzuageuwcprq"
+	"mzvkfbs"
+	"mzvvqifuzh"
+	"mzwyeghh"
+	"mzxdnm"
+	"mzxifpvkgpxzne"
+	"mzxqd"
+	"mzxtmhstifxgf"
+	"mzxwahupkloj"
+	"mzydplmjogkrsf"
+	"na"
+	"naaox"
+	"nabmmkwgczocpp"
+	"nabwjm"
+	"nacuasraornlt"
+	"nadag"
+	"nadr"
+	"naenemfowriky"
+	"nag"
+	"nagl"
+	"nahjogtaxbr"
+	"naidin"
+	"nairliyx"
+	"najnphqz"
+	"nakt"
+	"nanpcpyb"
+	"napqxm"
+	"naqjhrntbyuts"
+	"narrwrdkbg"
+	"nasoxj"
+	"natkdcxlx"
+	"nau"
+	"navpugg"
+	"nawbfmowalvkdd"
+	"nawmhjmb"
+	"nb"
+	"nbaezeek"
+	"nbchb"
+	"nbdckoqzkwb"
+	"nbdmuqmvfmo"
+	"nbervpeobyl"
+	"nbg"
+	"nbhct"
+	"nbioc"
+	"nbjsdmkzfcxdi"
+	"nbl"
+	"nbmo"
+	"nbn"
+	"nbnrgtgjub"
+	"nborgvkwmrqc"
+	"nbot"
+	"nbpztqafkyc"
+	"nbqjvqsqcevr"
+	"nbryg"
+	"nbsmx"
+	"nbtudrshfssma"
+	"nbufbqoxziyur"
+	"nbvschxhuihrch"
+	"nbw"
+	"nbwoy"
+	"nbxk"
+	"nbxmvbuurnehm"
+	"nbyzthcsykerv"
+	"nbzme"
+	"ncanztehdhuhal"
+	"ncbt"
+	"nccpwsilwznm"
+	"ncd"
+	"ncdyc"
+	"nce"
+	"ncebhzuhxvbnd"
+	"ncevicl"
+	"ncfbhtfwrmrzyl"
+	"ncg"
+	"ncgwlfbpgccfq"
+	"ncgwxlyost"
+	"ncirymvte"
+	"ncivj"
+	"ncklsm"
+	"nclgjgj"
+	"ncmchm"
+	"ncmo"
+	"ncouj"
+	"ncqcej"
+	"ncqn"
+	"ncqxai"
+	"ncrcssqshw"
+	"ncrirtcodd"
+	"ncs"
+	"ncsmjcuafhsnmv"
+	"ncsqakvij"
+	"ncszccxgjzudcb"
+	"nctaucxlvfp"
+	"ncuxcarxnkeek"
+	"ncvoouxaquxa"
+	"ndb"
+	"ndcyosypaldxgw"
+	"nddrpcgwgh"
+	"ndepnkd"
+	"ndewkuuhvlc"
+	"ndfelxjliex"
+	"ndflvqwi"
+	"ndfqlazyfqs"
+	"ndgt"
+	"ndi"
+	"ndicx"
+	"ndilijjjfnfdo"
+	"ndjpegbmslsbec"
+	"ndjsyfym"
+	"ndnvqwsfxgi"
+	"ndnvyqwvrs"
+	"ndnws"
+	"ndryf"
+	"ndsbuyv"
+	"ndsen"
+	"ndslukpunv"
+	"ndtbouzp"
+	"ndtcwlswy"
+	"ndtjzfltub"
+	"nduijeelz"
+	"ndukpgd"
+	"ndukyhszf"
+	"ndwubp"
+	"ndwwukw"
+	"ndxv"
+	"ndy"
+	"ndygnoczkve"
+	"ne"
+	"neagsnnjyknfy"
+	"nebybjp"
+	"necyszdyh"
+	"nedjieagxmhcu"
+	"neeig"
+	"negzxaxdysgsx"
+	"nekfomsrveq"
+	"nekt"
+	"nengimvfixvsnl"
+	"nepsu"
+	"neqpjdk"
+	"nesojbqueqquiq"
+	"nesznnvmpjdlhc"
+	"neub"
+	"neulkntyhyrr"
+	"neuvul"
+	"nevrbbryqang"
+	"nevy"
+	"newksirifphi"
+	"newuefk"
+	"nexxbbpgg"
+	"nf"
+	"nfa"
+	"nfd"
+	"nfdecs"
+	"nfdqkzzjhcdl"
+	"nffkyk"
+	"nfgc"
+	"nfgobamrbxpiv"
+	"nfhlalnr"
+	"nfinashyievnp"
+	"nfiywfwq"
+	"nfjx"
+	"nfmm"
+	"nfnorexrvii"
+	"nfpbkfdcrzey"
+	"nfpbycnndzu"
+	"nfpflpbnufehd"
+	"nfpkkozr"
+	"nfqwcc"
+	"nfqx"
+	"nfsapw"
+	"nftpoygbr"
+	"nftsosba"
+	"nfukaixvbq"
+	"nfvbmlwvns"
+	"nfvuxsadgmn"
+	"nfxesli"
+	"nfxltz"
+	"nfybeoitrwnk"
+	"nfzbcvmzdafm"
+	"nfzfo"
+	"nfzhahqrbu"
+	"ng"
+	"nga"
+	"ngbeficvilfsm"
+	"ngcusbzonc"
+	"ngehxuxapke"
+	"ngg"
+	"ngge"
+	"ngggvcg"
+	"nghnohnbaohy"
+	"nghxihmhtafeek"
+	"ngiennyabffqmh"
+	"ngivtqtk"
+	"ngjldl"
+	"ngjmqd"
+	"ngjpaakib"
+	"ngl"
+	"ngmpm"
+	"ngng"
+	"ngnykzcb"
+	"ngour"
+	"ngrggtrakjo"
+	"ngthjx"
+	"ngtm"
+	"nguawwa"
+	"nguisjxilyesiz"
+	"ngvjbtcicinsg"
+	"ngyqjvf"
+	"ngyqvujph"
+	"ngyreakwb"
+	"ngyweyqpz"
+	"ngzmivzclmh"
+	"ngzmrpftczp"
+	"nh"
+	"nha"
+	"nhbgqn"
+	"nhclqikwbw"
+	"nhcregorjtlf"
+	"nhdfuqrnzzan"
+	"nhexxeegsgoz"
+	"nhgekt"
+	"nhgyucaezp"
+	"nhhgfh"
+	"nhizazam"
+	"nhkmgciuoeyp"
+	"nhmga"
+	"nhmho"
+	"nhmyhovwju"
+	"nhnmksbjgpzh"
+	"nho"
+	"nhow"
+	"nhqh"
+	"nhqwiipfbea"
+	"nhu"
+	"nhuavvephgjwcb"
+	"nhudfqb"
+	"nhuvepyurt"
+	"nhv"
+	"nhvithkkteyouq"
+	"nhvwuwia"
+	"nhwldlhwclvrvv"
+	"nhyxjnincuuo"
+	"nhzbq"
+	"nhzurkcqz"
+	"nhzwpcteshdauj"
+	"ni"
+	"niarzj"
+	"nidblplrtign"
+	"nieujyot"
+	"nigecosejle"
+	"nigjrvldtrzw"
+	"nigkldwdo"
+	"nigrkfosjfwun"
+	"nihbpg"
+	"niij"
+	"nijso"
+	"nijugktshrkozx"
+	"nik"
+	"nikaielxeypcdm"
+	"nikqj"
+	"nillsijal"
+	"nimtc"
+	"nimyentkalvfpq"
+	"nioooxuxfzsyfb"
+	"nipxdxde"
+	"niqjxn"
+	"niqydkzerwr"
+	"niqzrpfipkntnr"
+	"nireijehgmdcvx"
+	"nitywdw"
+	"niv"
+	"nivbfkurmsir"
+	"nivlmjvppfszmp"
+	"nix"
+	"nixcgzyer"
+	"nixziptnixebu"
+	"niytfwidnbkkb"
+	"nizndcr"
+	"nj"
+	"njag"
+	"njcp"
+	"njcr"
+	"njdjzbpfirgeb"
+	"njearyaxyalc"
+	"njfajnewgusm"
+	"njhaujfsbojrcq"
+	"njl"
+	"njlmyltgj"
+	"njlxpqcfujnr"
+	"njlxx"
+	"njmgtgnemsv"
+	"njmxn"
+	"njncrexke"
+	"njngaemwaspoy"
+	"njofsamsbqj"
+	"njogumsic"
+	"njojwfuzm"
+	"njonxzy"
+	"njovduijlgqif"
+	"njpwamcjesjz"
+	"njrp"
+	"njrvtubc"
+	"njvcnhnxzckh"
+	"njvfozq"
+	"njwnvvhkdaxdsl"
+	"njwyj"
+	"njxcjtnsbcgrh"
+	"njxzjg"
+	"njzwthpxz"
+	"nk"
+	"nkauil"
+	"nkaulvbplbw"
+	"nkbstopiv"
+	"nkcaddzyop"
+	"nkdomr"
+	"nkewrtni"
+	"nkf"
+	"nkgtbxaoas"
+	"nkjrgwjefh"
+	"nkkjnrmd"
+	"nkknbkn"
+	"nklfgiobunn"
+	"nklqhh"
+	"nkmuymaspb"
+	"nknnyvhohw"
+	"nkodg"
+	"nkovn"
+	"nkpmzst"
+	"nkriubvmuzzl"
+	"nkrj"
+	"nksngrewiljo"
+	"nkuympgqvqoc"
+	"nkvn"
+	"nkwdn"
+	"nkwl"
+	"nkwvkhclhxlu"
+	"nkxaixkua"
+	"nkxhwb"
+	"nkxkjdyxd"
+	"nkybrouykvn"
+	"nkynkznfkn"
+	"nl"
+	"nlbna"
+	"nleqmj"
+	"nleyqvvefalqfj"
+	"nlhuke"
+	"nllhgvigzln"
+	"nllqefzh"
+	"nlm"
+	"nlmctnhnu"
+	"nlobljmueebpht"
+	"nlozmjyzmqf"
+	"nlpmmgzdspfq"
+	"nlqczjcopfhsar"
+	"nlqezcqw"
+	"nlr"
+	"nlrggceh"
+	"nlrkqwpav"
+	"nlrlhyzcklkr"
+	"nlugtdomtyxfdz"
+	"nlvejkuspzft"
+	"nlvnl"
+	"nlwvhuloahsl"
+	"nly"
+	"nlybf"
+	"nlyvbxolfbuih"
+	"nlyxygxvof"
+	"nm"
+	"nmbx"
+	"nmcidsi"
+	"nmdcmjbtks"
+	"nmhblfh"
+	"nmhmqkd"
+	"nmic"
+	"nmipgg"
+	"nmjansmdajsgij"
+	"nmkvubkfzk"
+	"nmloevkhsqjo"
+	"nmlqotdgvdilig"
+	"nmlynekzffm"
+	"nmn"
+	"nmpzyfuet"
+	"nmr"
+	"nmtacm"
+	"nmtxkihyjafa"
+	"nmugadaojifwp"
+	"nmv"
+	"nmvbcaxoxhe"
+	"nmvek"
+	"nmwhfx"
+	"nmxsqnubv"
+	"nmxycsngnbcngr"
+	"nmywgse"
+	"nn"
+	"nnablb"
+	"nnam"
+	"nnaqu"
+	"nnb"
+	"nnchlbk"
+	"nndagelcxctt"
+	"nndbjf"
+	"nngjkipcixgy"
+	"nngsbzv"
+	"nnhcynnhnlf"
+	"nnhwkaxuzwcyer"
+	"nnixbozzk"
+	"nnjn"
+	"nnjny"
+	"nnkvbdaaimd"
+	"nnlsfitzeru"
+	"nnmuipjzv"
+	"nnocfiz"
+	"nnoffyh"
+	"nnplixdvwoto"
+	"nnpseskvkmhj"
+	"nnq"
+	"nnrccnqjs"
+	"nnsi"
+	"nnsnyn"
+	"nnsr"
+	"nnszmxqztd"
+	"nnt"
+	"nntwxax"
+	"nnusg"
+	"nnvledkp"
+	"nnvwrhdmayl"
+	"nnwqwgy"
+	"nnx"
+	"nnxmngtfzpf"
+	"nnxxsgntihkjp"
+	"no"
+	"noacndxriufmea"
+	"noakgbh"
+	"noamuqnnomzbem"
+	"nobcskfues"
+	"nobhnwpr"
+	"nocyzyyghnqbau"
+	"nognktyyf"
+	"nogze"
+	"noi"
+	"nojplnz"
+	"nojwvwcdljxy"
+	"nokj"
+	"nolcjtesjn"
+	"nolgyikqpjdek"
+	"nolxwuld"
+	"nomfrsfivtoclh"
+	"nomtrteotpmdki"
+	"nonossneu"
+	"nooaxyau"
+	"noon"
+	"nopw"
+	"noqbzxcblof"
+	"noqunohnbuv"
+	"noszmyut"
+	"novlkn"
+	"novyr"
+	"novzmyiyeaidjv"
+	"noyxpco"
+	"np"
+	"npasyqgznrxu"
+	"npavywnftbuss"
+	"npblakosp"
+	"npbmtjzrdt"
+	"npcmy"
+	"npcsx"
+	"npddqvvqmr"
+	"npdrrkbd"
+	"npgncwjjhlmaof"
+	"npgs"
+	"npgsdzc"
+	"npitss"
+	"npjt"
+	"npjwdd"
+	"npkvqlbwmeyak"
+	"npkzicujvq"
+	"npmdfftcxcgzjs"
+	"npncjo"
+	"npngpkvospm"
+	"npnytzkml"
+	"npohdgnfs"
+	"nppqhnug"
+	"nprsjnatkqy"
+	"npsmrat"
+	"npt"
+	"nptrtphzhl"
+	"npvhhynhcnb"
+	"npvs"
+	"npvzldiywzt"
+	"npxxdo"
+	"npybkhcnckf"
+	"npzglvqdmr"
+	"nq"
+	"nqa"
+	"nqadm"
+	"nqakmf"
+	"nqanhwmitayq"
+	"nqascbx"
+	"nqbpdc"
+	"nqfpthqurdmp"
+	"nqighh"
+	"nqiivuqfux"
+	"nqj"
+	"nqjjqb"
+	"nqk"
+	"nqkrgiebbcxrvq"
+	"nqlcsnhxlgueg"
+	"nqo"
+	"nqqpgegzu"
+	"nqrxeigbl"
+	"nqryy"
+	"nqsddfgtja"
+	"nqtdqmpwrlnde"
+	"nqurzy"
+	"nqvli"
+	"nqvlyq"
+	"nqvxk"
+	"nqyhvkhjx"
+	"nqyleqwmyvd"
+	"nqyn"
+	"nqzidyzkbw"
+	"nqzybpgmh"
+	"nr"
+	"nradq"
+	"nrbhx"
+	"nrbiceaafjzhy"
+	"nrcezdqsv"
+	"nrdd"
+	"nrddszkk"
+	"nrebizlxq"
+	"nrekjorwzte"
+	"nrgnlzkjxwmzuj"
+	"nrgohntsqm"
+	"nriroroamkfipa"
+	"nriuc"
+	"nrjmubvtait"
+	"nrjyqupocgycim"
+	"nrkuappvpdqy"
+	"nrlazxpu"
+	"nrlmaeldr"
+	"nrlrm"
+	"nrmdjyctofs"
+	"nrmxrzvxnwfa"
+	"nrmyflkvyfjxi"
+	"nrrxteuj"
+	"nrsq"
+	"nrsxturafl"
+	"nrv"
+	"nrvtrqzxr"
+	"nrx"
+	"nrxdeyxeifdie"
+	"nryphg"
+	"nrzgqt"
+	"ns"
+	"nsaadil"
+	"nsbgpwpea"
+	"nscbwwjenqfahp"
+	"nscylthxeoqvo"
+	"nsdgp"
+	"nsggfhezoeyolz"
+	"nsgsj"
+	"nshe"
+	"nshtzg"
+	"nshufcivtfhx"
+	"nsiaazeypwy"
+	"nsie"
+	"nsiyuftdris"
+	"nsmawxjavdk"
+	"nsnl"
+	"nsod"
+	"nspejwvz"
+	"nspojsimplqxp"
+	"nsppfrkwb"
+	"nssd"
+	"nssdrwdckv"
+	"nsu"
+	"nsufceudhw"
+	"nsvvxvwnypujy"
+	"nswijiojz"
+	"nsxdbzvqqtfu"
+	"nsydic"
+	"nsyn"
+	"nsyx"
+	"nszsdlemrjr"
+	"nszvczxu"
+	"nt"
+	"ntcbdcqsxxrm"
+	"ntcjnzjvnpndip"
+	"ntcoxubdlrbf"
+	"ntcpoydtx"
+	"ntdiqnbzyo"
+	"ntdk"
+	"nteppyfjrpgb"
+	"ntfgzkregyuop"
+	"ntfmbitioyf"
+	"ntghwzxfuatthp"
+	"nthccempqcrut"
+	"ntiqw"
+	"ntjldainwb"
+	"ntl"
+	"ntlgidbmkwk"
+	"ntlwtttlvynn"
+	"ntmxalebzndo"
+	"ntpaoqpqgdmaze"
+	"ntplpzmtbas"
+	"ntpxjlkpe"
+	"ntq"
+	"ntrvalsif"
+	"ntscfcqh"
+	"ntsuxk"
+	"ntszc"
+	"ntszrruqsyswps"
+	"ntteu"
+	"nttj"
+	"ntudvlerp"
+	"ntvptgtndin"
+	"ntxmzsctwvttgj"
+	"ntxuxbzkbblvc"
+	"ntzdgogfo"
+	"nu"
+	"nuafilh"
+	"nuamoredkewxh"
+	"nucwrlejqdsjlf"
+	"nudoqqg"
+	"nudvfhutkdg"
+	"nugkxko"
+	"nuhcxnryriep"
+	"nullablqiuzfbs"
+	"num"
+	"nunxwtozsuzbeh"
+	"nuogxdnvoho"
+	"nuoxmwtyo"
+	"nurm"
+	"nusifwpr"
+	"nuuavhkb"
+	"nuv"
+	"nuwfrgqrpsuwcu"
+	"nuwtnk"
+	"nuxktrwdujd"
+	"nuxzsnj"
+	"nuzby"
+	"nuzcrafhjynr"
+	"nuzehvuxbp"
+	"nv"
+	"nvbgd"
+	"nvds"
+	"nvdwfpx"
+	"nveagigsxvua"
+	"nvehpi"
+	"nvfkyv"
+	"nvgzh"
+	"nvhwpuapjjjbkv"
+	"nvigfgm"
+	"nvjur"
+	"nvkgkjboidh"
+	"nvklplaaegbwgb"
+	"nvmft"
+	"nvmgiyajbiyc"
+	"nvne"
+	"nvoc"
+	"nvqmmzgdeurez"
+	"nvrfh"
+	"nvsxvidiu"
+	"nvtwcexmtw"
+	"nvv"
+	"nvvgyzrkj"
+	"nvwqxzrz"
+	"nvxkfwkcjhh"
+	"nvxrlrlwcmh"
+	"nvxuftmjnbmr"
+	"nvy"
+	"nvypeperjrcf"
+	"nvz"
+	"nvzqqxxmpa"
+	"nvzvrdxdiqlma"
+	"nw"
+	"nwa"
+	"nwaq"
+	"nwcfnaxwx"
+	"nwcqr"
+	"nwctvalq"
+	"nwdruif"
+	"nwgotcy"
+	"nwi"
+	"nwiwvzz"
+	"nwkccc"
+	"nwlgxglvy"
+	"nwlmnpsppx"
+	"nwlmwmqnwhg"
+	"nwnvssudqbqn"
+	"nwobc"
+	"nwoiaqppxgbau"
+	"nwomx"
+	"nwphzhduqzutbm"
+	"nwpyqgh"
+	"nwq"
+	"nwqv"
+	"nwqyvtw"
+	"nwrhiy"
+	"nwscdfvncn"
+	"nwtccbnh"
+	"nwu"
+	"nwuhkviiciimw"
+	"nwuoklackwfr"
+	"nwvcvrfhufc"
+	"nwxxhaxvhtmehr"
+	"nwzrmzux"
+	"nx"
+	"nxan"
+	"nxbyuo"
+	"nxduitxpyc"
+	"nxe"
+	"nxebuqho"
+	"nxekfcg"
+	"nxgligcwaft"
+	"nxgpehlwen"
+	"nxhija"
+	"nxhpuibmlmon"
+	"nxjr"
+	"nxl"
+	"nxlivuy"
+	"nxltzzhf"
+	"nxmdfr"
+	"nxmuggebwr"
+	"nxmwjlg"
+	"nxnfuwfgs"
+	"nxocpu"
+	"nxorfv"
+	"nxpooigerweu"
+	"nxpr"
+	"nxrlgooh"
+	"nxsenzzsgn"
+	"nxt"
+	"nxtjezbd"
+	"nxtjfeuglg"
+	"nxvi"
+	"nxvtk"
+	"nxwqotkemcjnan"
+	"nxxf"
+	"nxxmegeknt"
+	"nxxywyguuwluq"
+	"nxyehmzq"
+	"nxznkgomiq"
+	"ny"
+	"nyaumenebj"
+	"nycqsobng"
+	"nydasdbwnvv"
+	"nyeiaezifsuukw"
+	"nyeozal"
+	"nyfenfla"
+	"nyfjmeepuh"
+	"nyj"
+	"nykqa"
+	"nymgnacivlc"
+	"nymlnz"
+	"nymqqcpe"
+	"nynihpl"
+	"nynywtiv"
+	"nyo"
+	"nyowplrxpzdpdj"
+	"nyqb"
+	"nyqzsavdcd"
+	"nyriomuz"
+	"nyrjksux"
+	"nyrkmwykfz"
+	"nys"
+	"nysocisiokeui"
+	"nytkpaa"
+	"nyvlb"
+	"nyyipdib"
+	"nyyzhdx"
+	"nz"
+	"nzcmfekg"
+	"nzeraznrk"
+	"nzf"
+	"nzg"
+	"nzhgipjere"
+	"nzhswgrrmypdp"
+	"nzibcej"
+	"nzilybwdatzzns"
+	"nzioknmtw"
+	"nzjysvah"
+	"nzlbb"
+	"nzlhfmwslwtle"
+	"nzmez"
+	"nznyxvl"
+	"nzo"
+	"nzoble"
+	"nzthuggbtabyvi"
+	"nztopfumxo"
+	"nzwnspmktmqm"
+	"nzxg"
+	"nzxxvgw"
+	"nzzwffnlydqx"
+	"oa"
+	"oaccehgsczsaer"
+	"oacfwhbqbkcw"
+	"oadaiiuukk"
+	"oadlrqjyphhnrb"
+	"oaea"
+	"oafdfzp"
+	"oafllaasvmjeuk"
+	"oafxakqojhj"
+	"oafzxizvtgzn"
+	"oaio"
+	"oaj"
+	"oajf"
+	"oajkl"
+	"oakjriesgszeex"
+	"oal"
+	"oalohq"
+	"oanbnmwbv"
+	"oaoltu"
+	"oaouwfwpuihguk"
+	"oappkrnu"
+	"oapttds"
+	"oaqzoobdu"
+	"oasoj"
+	"oastluhbjos"
+	"oasv"
+	"oatmjehtscpyze"
+	"oaufapp"
+	"oauspksuded"
+	"oavv"
+	"oawcqubsjsgml"
+	"oawdyuavtwtk"
+	"oaxuq"
+	"oaxwdv"
+	"oaycjg"
+	"oazisbbayr"
+	"ob"
+	"obcigfl"
+	"obdcmmyiguv"
+	"obdpis"
+	"obequu"
+	"obesdsendfiv"
+	"obffedf"
+	"obhidjaqwkeon"
+	"obiwmluby"
+	"objylq"
+	"obljrugixifjqk"
+	"obmgef"
+	"obnefocutffu"
+	"obnzfphub"
+	"obosce"
+	"obpcqhlfamhcuz"
+	"obpoelwxdzew"
+	"obqihilr"
+	"obrsvasblu"
+	"obshszlhgs"
+	"obtjhpi"
+	"obtmo"
+	"obuwelng"
+	"obvf"
+	"obxgyi"
+	"obxukjjvxmjz"
+	"obychitrt"
+	"obypw"
+	"obz"
+	"obzyidxvcbuucp"
+	"oc"
+	"oca"
+	"ocb"
+	"occai"
+	"occjphgwhme"
+	"occo"
+	"ocebkvt"
+	"ocegtcqn"
+	"oceykvpxhjeh"
+	"ocliuwfcykgyki"
+	"oclwjdmpxviy"
+	"ocmarihbzd"
+	"ocmtzbiv"
+	"ocmx"
+	"ocnmjmbr"
+	"ocpkzhaxsfold"
+	"ocppwczeem"
+	"ocqfddkxuepuh"
+	"ocubsrcgwho"
+	"ocupnkxz"
+	"ocvxbtp"
+	"ocw"
+	"ocwtxdmnohp"
+	"ocx"
+	"ocxmur"
+	"ocyolztx"
+	"oczhqc"
+	"oczzsfa"
+	"od"
+	"odajfhffgmyxvk"
+	"odanf"
+	"odasj"
+	"odbaratidvijfy"
+	"odbhdteppl"
+	"odbtgmzlxe"
+	"odbymmozfq"
+	"odcqhjmyzql"
+	"odd"
+	"odeft"
+	"odfzczu"
+	"odgl"
+	"odhh"
+	"odhwzkgfeuiwe"
+	"odhyehgccp"
+	"odjgn"
+	"odjrtdb"
+	"odkkmumjchx"
+	"odle"
+	"ododfuiqpxya"
+	"odosoxosgab"
+	"odpdcbshikgn"
+	"odpiekwrnrp"
+	"odrd"
+	"odslabjducv"
+	"odugpn"
+	"odvyj"
+	"odvzdq"
+	"odwjirhw"
+	"odwypeixomtr"
+	"oe"
+	"oebleiwjllolmo"
+	"oeccba"
+	"oeceq"
+	"oecft"
+	"oecuz"
+	"oecxdkb"
+	"oee"
+	"oeen"
+	"oeetmfxfask"
+	"oef"
+	"oefphd"
+	"oegdorxhxeqpeu"
+	"oeikzjsrkbjg"
+	"oejfmfhhan"
+	"oejphzugdiaxpp"
+	"oejtpns"
+	"oeknagibzqxjbq"
+	"oekrsdcy"
+	"oel"
+	"oemchmrmxgb"
+	"oemdxgrftqoik"
+	"oemjrjfw"
+	"oen"
+	"oengm"
+	"oenmpj"
+	"oeprji"
+	"oeptbllxk"
+	"oeqoq"
+	"oeqy"
+	"oesmzbduduj"
+	"oet"
+	"oetsnqhcen"
+	"oetydjn"
+	"oeu"
+	"oevtg"
+	"oewgykdlmkk"
+	"oewlbiderihtx"
+	"oex"
+	"oexfqtte"
+	"oexich"
+	"oeycggynssw"
+	"oeygc"
+	"oeypmgxgtbk"
+	"of"
+	"ofbkgceyamvumi"
+	"ofcnhdimvikf"
+	"ofcwtbue"
+	"ofegvdndnh"
+	"offsl"
+	"ofgfvobzcviunr"
+	"ofgqpautxop"
+	"ofikqohgcv"
+	"ofkfkvumjl"
+	"ofnwpnxbdgrtm"
+	"ofouzjyuetl"
+	"ofqdyhfrxjm"
+	"ofrcepqlonqe"
+	"ofsh"
+	"ofsr"
+	"oftrorfk"
+	"oftupzqn"
+	"ofugazxmwkhq"
+	"ofurxtzscuo"
+	"ofv"
+	"ofxbeyav"
+	"ofxvslxqwy"
+	"ofz"
+	"ofzozxrb"
+	"og"
+	"ogagzvsjfp"
+	"ogarshainqlj"
+	"ogcrf"
+	"ogcsrgtqspa"
+	"ogcxfzgdxcib"
+	"ogdbkhyfbldfg"
+	"ogdlxhpbu"
+	"ogdwqnuqdpx"
+	"ogehxgdakjv"
+	"ogfiurvros"
+	"ogi"
+	"ogina"
+	"ogjab"
+	"ogje"
+	"ogjsbu"
+	"ogkgfagwv"
+	"ogkutdhq"
+	"oglxguorlt"
+	"oglzzklmgunm"
+	"ogmp"
+	"ogmucgwznfob"
+	"ogosuqlgchknp"
+	"ogrlrxpjpgdc"
+	"ogrt"
+	"ogs"
+	"ogsvoe"
+	"ogt"
+	"ogtcag"
+	"ogtdrwii"
+	"ogzblo"
+	"oh"
+	"ohbiew"
+	"ohcekxmalx"
+	"ohcjxdymkgcva"
+	"ohdqfpbvv"
+	"ohffdhxlplzysw"
+	"ohfvzjmwpnvahg"
+	"ohgu"
+	"ohgv"
+	"ohheukwqf"
+	"ohikyporb"
+	"ohilzklipeaqz"
+	"ohimpwyxjx"
+	"ohivmojwmaryna"
+	"ohjyjqiuntn"
+	"ohkwadmxmg"
+	"ohlajsverqwyuq"
+	"ohmpxtonpi"
+	"ohmywtitajqp"
+	"ohnsviomhef"
+	"ohoiztlfewp"
+	"ohrtobxfth"
+	"ohu"
+	"ohwuvrj"
+	"ohxin"
+	"ohzlmrrgfz"
+	"oi"
+	"oia"
+	"oib"
+	"oibpuupofvfueo"
+	"oibzquw"
+	"oidwht"
+	"oidyncoe"
+	"oif"
+	"oiioyunrkpi"
+	"oiixwivbihzgb"
+	"oijjovvlx"
+	"oimonggudwn"
+	"oip"
+	"oipcxloj"
+	"oipf"
+	"oiqlrpgo"
+	"oissipuql"
+	"oiudjj"
+	"oiupp"
+	"oivydwhztq"
+	"oiyecxe"
+	"oiyrdzpeqtb"
+	"oiyzmjd"
+	"oizpmfhp"
+	"oj"
+	"ojaqaejj"
+	"ojbwlcunkxgt"
+	"ojekthqci"
+	"ojembyeixev"
+	"ojfnfnkl"
+	"ojfpd"
+	"ojhfqjecbr"
+	"ojl"
+	"ojnbe"
+	"ojnic"
+	"ojnrxyeau"
+	"ojnwxmmdystj"
+	"ojnywstfyjvsqv"
+	"ojpdphwfz"
+	"ojq"
+	"ojqbvvyhb"
+	"ojqly"
+	"ojqs"
+	"ojraorcjujg"
+	"ojrtrzpl"
+	"ojszxurg"
+	"ojtirsqbqgwaz"
+	"ojusilluur"
+	"ojvjhhud"
+	"ojvli"
+	"ojvyqrmctps"
+	"ojwulydaokvs"
+	"ojwzpcymlrfbzb"
+	"ojxjdft"
+	"ojygznngtotgsf"
+	"ojyjaauxbm"
+	"ojyqqwodzbj"
+	"ok"
+	"okaee"
+	"okaqbli"
+	"okauvakjpph"
+	"okeosbwlh"
+	"okfxwho"
+	"okgaslztdkltxe"
+	"okhrlzeicjfgs"
+	"okjpzyka"
+	"okkfwsejqww"
+	"okm"
+	"oknt"
+	"okoibqlgh"
+	"okplseiapb"
+	"okqdavbe"
+	"okqjvfxftmmux"
+	"okqytbsd"
+	"okrjxwqp"
+	"okrrzztyks"
+	"oksy"
+	"okwcvxscol"
+	"okysrylvat"
+	"okyuhtftmk"
+	"okyxbkjn"
+	"ol"
+	"ola"
+	"olax"
+	"oldh"
+	"olg"
+	"olga"
+	"olhuni"
+	"olktwneze"
+	"ollogfefsqlqnr"
+	"olmwncfogj"
+	"olnwaktzliw"
+	"olovlkj"
+	"olowdu"
+	"olqifhtfsuz"
+	"olqzdgo"
+	"olsdaq"
+	"olsodg"
+	"olueqi"
+	"olunqlsqpfdvw"
+	"olwlbcefjfzr"
+	"olx"
+	"olztjtubamwyqv"
+	"olzv"
+	"olzxs"
+	"om"
+	"omabyzjgjwh"
+	"omapepx"
+	"omcc"
+	"omdnstuvfpamho"
+	"omf"
+	"omfqmlfdpr"
+	"omfsxuphcxiyu"
+	"omhhjfxlfqit"
+	"omhvraqulslfan"
+	"omiglnkizlr"
+	"omiiekfhqf"
+	"omivhrumeq"
+	"omjzfw"
+	"omkuiiuuhhbs"
+	"ommkrnzmdmpnp"
+	"ommqgyccwck"
+	"omnxealjd"
+	"omqy"
+	"omrdspie"
+	"omrpv"
+	"omtq"
+	"omtsomnmq"
+	"omuxrkkrvowki"
+	"omvc"
+	"omwohhjvfn"
+	"omydtcwabrcjpy"
+	"omzk"
+	"omzkoc"
+	"on"
+	"onbrxtmzzned"
+	"onbsjwgahy"
+	"onbxwiixcyik"
+	"ondd"
+	"ondhzxal"
+	"ondi"
+	"ondugwcidv"
+	"one"
+	"oneesfulsp"
+	"onevjacjaaxxc"
+	"onhubtwodqqpwz"
+	"onjat"
+	"onjccolxalhsk"
+	"onjklfyjspfan"
+	"onk"
+	"onlfgmpcrp"
+	"onmbtrkadgmh"
+	"onmvqzphwjxoa"
+	"onmyje"
+	"onmzdatgnf"
+	"onouivp"
+	"onqsq"
+	"onsfvtbnsgxod"
+	"onsgdmvzu"
+	"onsjy"
+	"ontedpasm"
+	"ontlfadgdp"
+	"ontpdngiirnixc"
+	"onvjlxkihom"
+	"onwabohvtchh"
+	"onwndrvl"
+	"onxap"
+	"ony"
+	"onypxojagz"
+	"onyxwieloszirs"
+	"onzhxjt"
+	"onzzszkyxdy"
+	"oo"
+	"oobcrgumel"
+	"oofdrsym"
+	"oogpjrcmrt"
+	"oogrpyn"
+	"oohdmblwu"
+	"ooi"
+	"ooiktscsnsc"
+	"ooillmq"
+	"ooimzikhtz"
+	"ookhxg"
+	"ookqkgoxzim"
+	"oolhqogwpkwuem"
+	"oolo"
+	"oom"
+	"oomqszkcwz"
+	"oonjve"
+	"oonl"
+	"oooalqbk"
+	"ooocrizlkwn"
+	"oooyxic"
+	"oopwhxjqja"
+	"ooqcvadpaxcwrh"
+	"oorlmcqck"
+	"ooswc"
+	"ootkwq"
+	"oovk"
+	"oovlnmztdubb"
+	"oowcevpca"
+	"oowxuzqdieg"
+	"ooxkiylq"
+	"ooxmrowbsq"
+	"ooydnmpwl"
+	"ooz"
+	"op"
+	"opbamvwdsbxq"
+	"opd"
+	"opdqgdqxtjfsm"
+	"opeahqvfropa"
+	"opfrrxe"
+	"opgkzplhgqivq"
+	"opgqtsqlnxc"
+	"opgsrb"
+	"ophdfqto"
+	"ophngae"
+	"opicutbpmsy"
+	"opj"
+	"opmtemi"
+	"opnqzlbpimjqc"
+	"opnxv"
+	"opnzbamca"
+	"opp"
+	"oppfswrqyxka"
+	"opqnr"
+	"opt"
+	"optssqj"
+	"opttglbwhgdbjx"
+	"opukzrwbcs"
+	"opusvknuft"
+	"opvcelbprp"
+	"opvhm"
+	"opw"
+	"opxtxyvthb"
+	"opxwmtizwhgxf"
+	"opyfdktaua"
+	"opyzecwgvd"
+	"opzfmghfoosg"
+	"oq"
+	"oqarjapgyej"
+	"oqcacfrjimvmec"
+	"oqdmwz"
+	"oqepebgwmkuxip"
+	"oqkoejvn"
+	"oqleklozgwd"
+	"oqm"
+	"oqmlyxhqeffi"
+	"oqnxan"
+	"oqohtkp"
+	"oqousuycy"
+	"oqpihbeus"
+	"oqqvvuxyzburb"
+	"oqrzuoxbezd"
+	"oqs"
+	"oqskvaolllluex"
+	"oqswxpyt"
+	"oquhlxomuqfmjr"
+	"oquu"
+	"oqvcwwxwtcxr"
+	"oqwzpzkpwrs"
+	"oqxhvukgbyzuj"
+	"oqxqhy"
+	"oqzmxboxj"
+	"oqzojqlwd"
+	"or"
+	"oradxkxxzr"
+	"orbeafadlnjg"
+	"orcn"
+	"orcrupepaijasy"
+	"orcyv"
+	"ordrjabjavqcp"
+	"orecftvghqsn"
+	"orewaiv"
+	"org"
+	"orgktobe"
+	"orhh"
+	"orhkrk"
+	"orkiizczfdawz"
+	"orkpnindyqcxg"
+	"orly"
+	"ornfiwfeg"
+	"orngo"
+	"orniaolajkxe"
+	"ornmp"
+	"orppb"
+	"orq"
+	"orrafzy"
+	"oruvrba"
+	"orx"
+	"orylcnm"
+	"orz"
+	"os"
+	"osaauthigf"
+	"osbzwpylbz"
+	"osczmpjsehsxg"
+	"osdrpgs"
+	"osdxid"
+	"osegqvah"
+	"oser"
+	"oseragexkbbxp"
+	"osexjzs"
+	"osfaen"
+	"osfhfgntstvc"
+	"osgwvryzmrbk"
+	"oshoaohhri"
+	"oshonbepzl"
+	"oshseqivljhr"
+	"oslfcighw"
+	"oslry"
+	"osn"
+	"osnhjsvm"
+	"osnocmfnl"
+	"ospelevg"
+	"osphlsh"
+	"osq"
+	"osqzdvo"
+	"osshlfb"
+	"osssew"
+	"ossxfhooc"
+	"osuiaoo"
+	"osuxegqj"
+	"osuy"
+	"osx"
+	"osxsmpjg"
+	"osxtcoi"
+	"oszj"
+	"oszrwia"
+	"ot"
+	"ota"
+	"otcsufqtw"
+	"otdq"
+	"otdrzakwqruvta"
+	"otdxxjvxup"
+	"otfg"
+	"otfxyt"
+	"otgvgmkywoiif"
+	"othb"
+	"otign"
+	"otiqdrxpktpvr"
+	"otiuramkmydt"
+	"otjjlzc"
+	"otjtcdemxk"
+	"otjvwiihelmdvq"
+	"otlbzbd"
+	"otlj"
+	"otlpse"
+	"otmbiz"
+	"otmcbojlyusfej"
+	"otmj"
+	"otnd"
+	"otnkqzmtlgmtv"
+	"otokrozwpclf"
+	"otpfivqjsyzmtr"
+	"otpgulxresi"
+	"otqi"
+	"otqit"
+	"ottejlvpmwflpl"
+	"otttyoug"
+	"ottwitqwibznm"
+	"otuaorxlmkgfr"
+	"otucfyliqkkw"
+	"otuibk"
+	"otwdzebqrrbvug"
+	"otwwu"
+	"otxbdmny"
+	"otxnnvs"
+	"otyqnusfqbi"
+	"ou"
+	"ouavc"
+	"oubu"
+	"oucioy"
+	"oucrjukuun"
+	"oucuqoe"
+	"oudffdpzkubrsy"
+	"ouek"
+	"ouelhsxqvvp"
+	"oufnih"
+	"oufyjwcj"
+	"oug"
+	"ougnqjmus"
+	"ouhu"
+	"oujsnovzt"
+	"oujzit"
+	"oukfu"
+	"oulqr"
+	"oulwqsismp"
+	"ouncnncxth"
+	"ounmhpghmdw"
+	"ounws"
+	"ounzte"
+	"oupjcyzpw"
+	"oupjx"
+	"ourpjub"
+	"oustcskdj"
+	"outjgunwvy"
+	"outmguqg"
+	"outvccvepli"
+	"outzhrp"
+	"ouury"
+	"ouvupzo"
+	"ouwg"
+	"ouwj"
+	"ouyuxpc"
+	"ouywmcbw"
+	"ouyzfwxo"
+	"ouzvtuijz"
+	"ovcfqc"
+	"ovctcvsorst"
+	"ovcwziuk"
+	"ovdwvcbza"
+	"ovemzjueiypnv"
+	"ovflelq"
+	"ovgmyapoyzx"
+	"ovhofy"
+	"ovix"
+	"ovmkzfcbmymc"
+	"ovmqpexjzwc"
+	"ovnrgfzhlkxjcy"
+	"ovqzrvqwahgylz"
+	"ovrfxm"
+	"ovrmk"
+	"ovsoeoxfxydk"
+	"ovswrbetarnqf"
+	"ovudbfrknln"
+	"ovvjqhq"
+	"ovvpvummkht"
+	"ovvqskhxwymy"
+	"ovwxgkimbp"
+	"ovxztydxsjpgl"
+	"ovzesyq"
+	"ow"
+	"owcgfkxj"
+	"owdxedse"
+	"owebksw"
+	"owgrtjfmikkjdd"
+	"owi"
+	"owif"
+	"owiwr"
+	"owjprnnqxt"
+	"owkoznhzfnix"
+	"owkqnwvu"
+	"owmwsak"
+	"ownnv"
+	"ownwmjvemnylzo"
+	"owotildpxaqum"
+	"owpgvqoldkykm"
+	"owq"
+	"owqv"
+	"owroatfonr"
+	"owsblqs"
+	"owswsfnkgpthub"
+	"owu"
+	"owuggdbrbpithq"
+	"owwd"
+	"owwgyft"
+	"owx"
+	"owxnexswg"
+	"owxxdxryb"
+	"owymyhltbo"
+	"ox"
+	"oxalb"
+	"oxcd"
+	"oxck"
+	"oxdhbxkkmhzxw"
+	"oxflwwmmllwo"
+	"oxg"
+	"oxgcbzqgt"
+	"oxghpnihedatr"
+	"oxgm"
+	"oxgoypqlgbyt"
+	"oxhasztnl"
+	"oxhgnp"
+	"oxhmasmhm"
+	"oxhtlmqctrqx"
+	"oxhxa"
+	"oxi"
+	"oxjninvljjunhm"
+	"oxl"
+	"oxnudq"
+	"oxpdjlhdpenb"
+	"oxrlcamnuoe"
+	"oxsuxagb"
+	"oxszvyzrnaazoy"
+	"oxvfjogljp"
+	"oxvgqgd"
+	"oxvinhqlsts"
+	"oxwrdgbzgut"
+	"oxxmbcrd"
+	"oxzq"
+	"oy"
+	"oycmrswbt"
+	"oycqaqgdbva"
+	"oydaacbgzzyg"
+	"oyddggizviy"
+	"oydsocytk"
+	"oye"
+	"oyenicizsi"
+	"oyeoyckctrw"
+	"oygabdlgxxkou"
+	"oygjpzihpueq"
+	"oyjbgdoumcwjxx"
+	"oyl"
+	"oymfsqejnjyxy"
+	"oynlqcsmrozuwy"
+	"oynlyzfcfwt"
+	"oyomzncunsjjn"
+	"oyooze"
+	"oyoyrojnwtq"
+	"oypjzhy"
+	"oyqmjpoelgzbfm"
+	"oysei"
+	"oysfvky"
+	"oysqykeylze"
+	"oytsovkciqqd"
+	"oyujakffvb"
+	"oyumuw"
+	"oyvdhtlbc"
+	"oywrevgcvds"
+	"oyxcmlvornz"
+	"oyxmmivcvhdppj"
+	"oyxocxel"
+	"oyxxjzkvrrqlrr"
+	"oyyabvllseu"
+	"oz"
+	"ozabibqpxugl"
+	"ozbwowqtpjrmnz"
+	"ozbyrv"
+	"ozcgnhtbth"
+	"ozcmlajg"
+	"ozd"
+	"ozdkyymhoocm"
+	"ozdvbhjdjuo"
+	"ozerliithowpyx"
+	"ozfe"
+	"ozftxcnoeyiu"
+	"ozgvt"
+	"ozhnrqola"
+	"ozi"
+	"ozivppllilueyc"
+	"ozjcm"
+	"ozkcbjgkbw"
+	"ozlaiqs"
+	"ozlsywvascx"
+	"ozmdbtkookoiz"
+	"ozmhkh"
+	"ozmod"
+	"ozoavtwko"
+	"ozot"
+	"ozqxpdy"
+	"ozqyftqjew"
+	"ozt"
+	"oztfgiu"
+	"oztgyxr"
+	"ozud"
+	"ozvkymqrnt"
+	"ozvlb"
+	"ozvuc"
+	"ozxzbmcaq"
+	"ozyfmupsfb"
+	"ozyuck"
+	"ozzgemmgp"
+	"pa"
+	"pabajrdy"
+	"pacbsi"
+	"padxxpyc"
+	"paebvqy"
+	"paexx"
+	"pafio"
+	"paflavewbrqbg"
+	"pah"
+	"pahoflbr"
+	"pajbkmujawwww"
+	"palftgskujj"
+	"paljcztwiimq"
+	"pallo"
+	"palwwnkixjj"
+	"pam"
+	"pamlxwrdslce"
+	"panokfhppkc"
+	"papcev"
+	"paqdxzwz"
+	"paqmung"
+	"par"
+	"paranof"
+	"parhgtb"
+	"pasgcl"
+	"pavczo"
+	"pawrkng"
+	"paxqvsmv"
+	"payax"
+	"paygftuxzzk"
+	"paywjsipddwa"
+	"pazpdizs"
+	"pb"
+	"pbcbmipcogtlnm"
+	"pbcic"
+	"pbclnre"
+	"pbcqmc"
+	"pbdqkfaaueud"
+	"pbeebnbvucsj"
+	"pbfng"
+	"pbiccehmw"
+	"pbikmnljtn"
+	"pbisaw"
+	"pbisoiswxuigh"
+	"pbjmo"
+	"pbjmuubnukxcp"
+	"pbkhtjfuoblop"
+	"pblvfmcplzsefn"
+	"pbpmpux"
+	"pbq"
+	"pbrddfx"
+	"pbsim"
+	"pbtpeyjzovns"
+	"pbucerpsegl"
+	"pbupozklfrflav"
+	"pbvrilgsisar"
+	"pbvtzk"
+	"pbwbffmrrqgh"
+	"pbwjpch"
+	"pbwp"
+	"pbwvn"
+	"pbzqln"
+	"pbzvs"
+	"pc"
+	"pcamzlg"
+	"pcazhldqvsffn"
+	"pccr"
+	"pce"
+	"pcfeftpcwulrpr"
+	"pcgdfn"
+	"pcgjkokpqji"
+	"pcgrqj"
+	"pcjpdjdwbhyr"
+	"pckpbppcyiu"
+	"pcmafyzoepws"
+	"pcmyer"
+	"pcnnslmhvjhwbo"
+	"pcojinhhpm"
+	"pcorhk"
+	"pcpuaiccnotsey"
+	"pcqzidhdnmedvo"
+	"pcrxnwwhzfan"
+	"pcsrnefbm"
+	"pcsuxxzlv"
+	"pct"
+	"pcvp"
+	"pcvzf"
+	"pcxkciwzqjv"
+	"pcxue"
+	"pczl"
+	"pcznhbnpjs"
+	"pd"
+	"pdas"
+	"pdbkfyrfcz"
+	"pdbtmo"
+	"pdeilidi"
+	"pdeuoqrxswq"
+	"pdgcf"
+	"pdhacxffhaxqy"
+	"pdhhfjuibakca"
+	"pdhqlposdpednl"
+	"pdisr"
+	"pdkjczbbgxfho"
+	"pdkkuuwkge"
+	"pdkqqakolbkwi"
+	"pdkyx"
+	"pdlxsbfpbq"
+	"pdmnbmcqvqrsn"
+	"pdpcuxlvxfqz"
+	"pdqhtxuxinlz"
+	"pdqwguw"
+	"pdrggm"
+	"pdrvttmymjlv"
+	"pdsqlaxmlgehi"
+	"pdxcksyprudwgq"
+	"pdxlaotacr"
+	"pdxwwwmxhztqc"
+	"pdxyhf"
+	"pdzjekolhpwq"
+	"pe"
+	"peaidclwr"
+	"pebpfj"
+	"pecl"
+	"peconvslalzhtn"
+	"pedunp"
+	"pefvqrp"
+	"pefy"
+	"pegqnvdrnkbl"
+	"pegtg"
+	"pehkqqxljrtxo"
+	"pejhvtn"
+	"pelsmhncdt"
+	"penbinsusvrkml"
+	"peprbvi"
+	"peprvbs"
+	"pequrywajt"
+	"peqwcksif"
+	"pesdbi"
+	"pesfxq"
+	"pevqsjyibwgqmw"
+	"pewjigxscutuw"
+	"pexdwtn"
+	"pezj"
+	"pezx"
+	"pf"
+	"pfa"
+	"pfbjizhgdbnyof"
+	"pferaxitobtxm"
+	"pffdusls"
+	"pfhhpxcb"
+	"pfhpsnsk"
+	"pfjabsraxfus"
+	"pfjntovtjintj"
+	"pfknh"
+	"pfko"
+	"pfmlnwqqjdsq"
+	"pfpllcthkijkn"
+	"pfpmy"
+	"pfqqi"
+	"pfrjkjr"
+	"pfrreuopav"
+	"pfthsd"
+	"pftslfyzd"
+	"pfuooo"
+	"pfwmeokddzy"
+	"pfxmynjehiiig"
+	"pfysqrnxzyvz"
+	"pfzvbfwgrznswn"
+	"pg"
+	"pgaepot"
+	"pgcb"
+	"pgctnqcob"
+	"pgdshs"
+	"pgg"
+	"pggmjm"
+	"pggzvmwv"
+	"pghjtgessxjll"
+	"pgjfwjmtzsike"
+	"pgjhetz"
+	"pgjxrgxo"
+	"pgl"
+	"pgmihmapclairj"
+	"pgnaanxkxmpgr"
+	"pgnwix"
+	"pgohoixp"
+	"pgokaoayznaylw"
+	"pgomdid"
+	"pgpogcphqcnrkl"
+	"pgptlowdndnos"
+	"pgrazryqm"
+	"pgsbhlkxlymp"
+	"pgtrrieaddqb"
+	"pgtu"
+	"pgus"
+	"pgv"
+	"pgykpewcqi"
+	"pgyqkeyaaanow"
+	"pgzx"
+	"ph"
+	"phafpwphdzkb"
+	"phalafjeii"
+	"phcgidb"
+	"phfmyqgpav"
+	"phg"
+	"phizonwetiwo"
+	"phkgjks"
+	"phkl"
+	"phlxssgzjfoyxy"
+	"phnuyxpc"
+	"phpkb"
+	"phqiuvtfcovz"
+	"phr"
+	"phrq"
+	"phssrvklzwhwbi"
+	"phtuhdmefyz"
+	"phtz"
+	"phucqpnzz"
+	"phuifeok"
+	"phuvfvommh"
+	"phvpvpzpufnoye"
+	"phxdok"
+	"pi"
+	"piavf"
+	"pibilqzyoyo"
+	"pibojwdlcbo"
+	"picuttqwtkuix"
+	"pidvnqxvdyhisu"
+	"pidxtbtbdla"
+	"piesoaut"
+	"pifv"
+	"pihoxlbumjjq"
+	"piimcmwpesog"
+	"piizagzd"
+	"pijk"
+	"pikbixhyugnsj"
+	"piowvirbeezg"
+	"pipoqctaqzomwg"
+	"pirqcanzhqdlj"
+	"pitqlgogilszjt"
+	"piuusxswh"
+	"piuwinsptbjqz"
+	"pivzhehfcimg"
+	"piwsheqtfni"
+	"pixfr"
+	"pixmforb"
+	"pixrqn"
+	"pixztvq"
+	"piywlqahptaqo"
+	"pizud"
+	"pj"
+	"pjacokiz"
+	"pjblm"
+	"pjdh"
+	"pjepfiqmenkyk"
+	"pjesnaxezaj"
+	"pjintzronk"
+	"pjjhmncqyilter"
+	"pjjzhs"
+	"pjkgupegmwl"
+	"pjkvqidzqhuyf"
+	"pjky"
+	"pjmwzksafqe"
+	"pjn"
+	"pjo"
+	"pjoooggdsuntm"
+	"pjoqlfk"
+	"pjpnpaewkfhdny"
+	"pjql"
+	"pjretbqsh"
+	"pjv"
+	"pjvdsvua"
+	"pjvtyxpnlxmwcb"
+	"pjxfdtzhcrn"
+	"pjxwwvd"
+	"pjybykgswgoa"
+	"pjyfxyfgtht"
+	"pjzvvfl"
+	"pk"
+	"pkckuarmsji"
+	"pkgwat"
+	"pkhh"
+	"pki"
+	"pkij"
+	"pkjvviof"
+	"pkmirymgnlcwr"
+	"pkmllrghfufbn"
+	"pkpmwcwzfepf"
+	"pkpnoeangl"
+	"pkqeve"
+	"pkrh"
+	"pksjcx"
+	"pksmpgbjzhvaii"
+	"pktefe"
+	"pkuggaowljztb"
+	"pkwzohludsjxsv"
+	"pkxggv"
+	"pkyozuiteccmst"
+	"pkzwunfljvbvl"
+	"pkzwyzkq"
+	"pl"
+	"plalgwzec"
+	"plapadvusvt"
+	"plbihbkrv"
+	"plclndfccyzpm"
+	"plcrgarvoiyfz"
+	"pldw"
+	"plfgprgqx"
+	"plfmfxoifnizp"
+	"plgbqnhp"
+	"plhtfvuupzbd"
+	"pliwerolvijwo"
+	"plj"
+	"plkx"
+	"plnd"
+	"ploymgnkw"
+	"plqtxvgzdwzfak"
+	"plqvvdga"
+	"plskcff"
+	"pltrq"
+	"plvkoyx"
+	"plwlke"
+	"plydsxwvy"
+	"plyvnfpxv"
+	"pm"
+	"pmamrxrxofssl"
+	"pmauvbdytdm"
+	"pmcubjbmx"
+	"pmdjqmpjqrtlvz"
+	"pmet"
+	"pmfkc"
+	"pmh"
+	"pmjk"
+	"pmlfviaawikn"
+	"pmlnbc"
+	"pmmewnninspoum"
+	"pmmjbnaefam"
+	"pmpi"
+	"pmpogwptkhil"
+	"pmpyto"
+	"pmrfcwsuo"
+	"pmrfyg"
+	"pmtsvemnbqqvod"
+	"pn"
+	"pnaldbl"
+	"pncowzenit"
+	"pncwqngjs"
+	"pndblukjbj"
+	"pndr"
+	"pnev"
+	"pnfyhkdyd"
+	"pngauusn"
+	"pngauzjiaktgxr"
+	"pngcma"
+	"pnhergezycrm"
+	"pnizpepppfmey"
+	"pnjeqrjmisouh"
+	"pnjwwgz"
+	"pnmfvdrndv"
+	"pnovjpkvkoz"
+	"pnpjvhg"
+	"pnpko"
+	"pnppzgteg"
+	"pnpshkfgiozla"
+	"pnpyfpx"
+	"pnqkck"
+	"pnulm"
+	"pnvhblfuq"
+	"pnwywhys"
+	"pnxkihkjkywpmt"
+	"pnycklgcgtnz"
+	"pnyfvuqkpgb"
+	"pnyjadbbsmnw"
+	"po"
+	"poafllvuzayrp"
+	"poblhzfacfx"
+	"poblrlglouacw"
+	"pocbhldcfpfnyl"
+	"poddhutbxkw"
+	"podqs"
+	"podrbdhlz"
+	"podznbjszwd"
+	"poezkmveeadwnp"
+	"pog"
+	"poijlqj"
+	"pokejv"
+	"poktcydtystm"
+	"pollblw"
+	"polymbioabjx"
+	"pom"
+	"ponsmjyiamyhpb"
+	"pooljigrf"
+	"pop"
+	"popyknvaers"
+	"posazhkalyr"
+	"posevvnl"
+	"potdofhyrkt"
+	"potiuauqkndwr"
+	"potkglfbskl"
+	"potm"
+	"pou"
+	"poudr"
+	"poumsy"
+	"poupgwjec"
+	"pourtweq"
+	"pousidkkcos"
+	"poxdslncfzxac"
+	"poxdtd"
+	"poyv"
+	"pozboazhaiy"
+	"pozxvkwuuyby"
+	"pp"
+	"ppargdqv"
+	"ppc"
+	"ppdo"
+	"ppdztooone"
+	"ppfdbetrpfu"
+	"ppgkem"
+	"ppgyenrvw"
+	"pphnurggrtlz"
+	"ppiqbypyt"
+	"ppmtxyhxu"
+	"pppkdslmonyim"
+	"ppptwbm"
+	"pppwq"
+	"pprcilfiojrl"
+	"pprersxa"
+	"pprs"
+	"ppslejrsbc"
+	"ppud"
+	"ppulxbpdkutvlg"
+	"ppwpwbte"
+	"ppxnblseyviwo"
+	"ppyolrypie"
+	"ppyqfsi"
+	"ppzeyerd"
+	"ppzwxigmjr"
+	"pq"
+	"pqaacubzcko"
+	"pqbsnsgjnxg"
+	"pqekbofk"
+	"pqerdcilaemj"
+	"pqgpjk"
+	"pqhlo"
+	"pqhwzn"
+	"pqiew"
+	"pqjlo"
+	"pqkepxjnpt"
+	"pqkgqjlpxkbm"
+	"pqlbul"
+	"pqlnvfcaan"
+	"pqmdhwdatxkq"
+	"pqmfgwryf"
+	"pqmtsphrne"
+	"pqmzmvkwpdqb"
+	"pqnljwxjqy"
+	"pqozrhecg"
+	"pqpimofkfksn"
+	"pqqjko"
+	"pqqrizpigpunqj"
+	"pqqsceq"
+	"pqseuc"
+	"pqsjtf"
+	"pqslvyy"
+	"pqv"
+	"pqvnibaagaob"
+	"pqxjyklxyojwf"
+	"pqxlaucv"
+	"pqxzkisb"
+	"pqzczwbernr"
+	"pr"
+	"prazg"
+	"prbc"
+	"prbnduzfmul"
+	"prcbfgp"
+	"prcellhwvy"
+	"prdqhiyzgh"
+	"prekoa"
+	"prf"
+	"prfdenrjof"
+	"prgkrzvrdxkw"
+	"prgoaixxxbe"
+	"prgphxiw"
+	"prgunnsis"
+	"prhuswxju"
+	"prhxoox"
+	"pri"
+	"priohfws"
+	"prjcgs"
+	"prkrxszn"
+	"prn"
+	"prpsyzxmyg"
+	"prpttp"
+	"prqaewnwvb"
+	"prqoiuzqfprk"
+	"prsi"
+	"prud"
+	"prudmo"
+	"prupbfdhdtgegq"
+	"prvuc"
+	"prw"
+	"prwkkrxefpdrhl"
+	"prygclfzg"
+	"ps"
+	"psbviy"
+	"pscucqgwnwq"
+	"pscwxgsruo"
+	"psczhlqhxq"
+	"psdat"
+	"pse"
+	"pseall"
+	"psekewjvolgi"
+	"psfhlgraeh"
+	"psgawgwrvi"
+	"pshgrr"
+	"pshuspeovf"
+	"psizhwsxkl"
+	"psknqw"
+	"psloe"
+	"psmgw"
+	"psnlau"
+	"psok"
+	"pspddjlehsqe"
+	"pspyic"
+	"psqf"
+	"psqtiqcvlkx"
+	"pstrehbrzj"
+	"psuximccpsnbda"
+	"psw"
+	"psyoax"
+	"psyynkx"
+	"pt"
+	"ptchpkol"
+	"ptetd"
+	"ptfxkadnjtdny"
+	"ptgdqayyrjn"
+	"ptid"
+	"ptivbhvrshdrhu"
+	"ptjeqvky"
+	"ptlauthnmpsew"
+	"ptljlr"
+	"ptlrenyey"
+	"ptnpwfhazwru"
+	"ptnxhtq"
+	"ptny"
+	"ptozkwmuah"
+	"ptp"
+	"ptpunqgd"
+	"ptpwzmjdikztky"
+	"ptqzwequw"
+	"ptsxgh"
+	"pttftdnomxlg"
+	"ptu"
+	"ptwegwdk"
+	"ptwyxds"
+	"ptwza"
+	"ptxdvlwskkp"
+	"ptxyjbtb"
+	"ptyunlqfeunpwx"
+	"pu"
+	"pubdhplhwknt"
+	"puckv"
+	"puemex"
+	"puexcarw"
+	"pufoqvnxdzpb"
+	"pugjailfeqor"
+	"pugozxnezuwbyg"
+	"puhunvmfzpsfsp"
+	"puibvqrlwltk"
+	"puiijkw"
+	"pujktmp"
+	"pukcgpunick"
+	"pukclfuxxd"
+	"pulzdrpmpkela"
+	"pumfpact"
+	"pumrlblel"
+	"punaahs"
+	"puneoxixy"
+	"pup"
+	"pupeejb"
+	"puqqbfb"
+	"puqz"
+	"puribu"
+	"puuuw"
+	"puvfz"
+	"puwhtmhniv"
+	"puwhuwv"
+	"puwmvqavvmsr"
+	"puwufehzjqji"
+	"puxog"
+	"puzgughzgl"
+	"pv"
+	"pvamz"
+	"pvaqt"
+	"pvatao"
+	"pvbkzotkwr"
+	"pvbprygkwvmpbr"
+	"pvcefr"
+	"pvcmgltldqrgeu"
+	"pvcmqp"
+	"pvdgstzgluoct"
+	"pveadii"
+	"pveizpvxacf"
+	"pvgfhnow"
+	"pvgq"
+	"pvhsulj"
+	"pvi"
+	"pvioqw"
+	"pvkryodyeobhy"
+	"pvl"
+	"pvldewqvder"
+	"pvlepkj"
+	"pvls"
+	"pvntz"
+	"pvooarfhxibe"
+	"pvpogrtbmkp"
+	"pvqiktawhwlit"
+	"pvrmxm"
+	"pvshtetcmfop"
+	"pvtbziwo"
+	"pvvnjcwtpddyz"
+	"pvxmp"
+	"pvyshkrfh"
+	"pvzocvtdjgv"
+	"pvztzarijmzsxh"
+	"pw"
+	"pwaw"
+	"pwbdyydad"
+	"pwbsxru"
+	"pwcpsnbvsjnvgl"
+	"pweiwmt"
+	"pwfubwdqtrcau"
+	"pwhxqtfwsoxwoz"
+	"pwhzthdrlfdybw"
+	"pwijfuu"
+	"pwjw"
+	"pwkakqdrco"
+	"pwlfhbjuorrotj"
+	"pwln"
+	"pwloyszocgeatk"
+	"pwofit"
+	"pwognqup"
+	"pwqefaqvo"
+	"pwqi"
+	"pwrddbpmqh"
+	"pwrhz"
+	"pwtvifegj"
+	"pwurtlrc"
+	"pwv"
+	"pwwaapjkd"
+	"pwxtsnqqfbtjh"
+	"pwz"
+	"pwzjhgt"
+	"pwzjibyb"
+	"pwztxsobuwozl"
+	"pxacvmeembvjkm"
+	"pxapbjw"
+	"pxbcq"
+	"pxbqvqeiookxti"
+	"pxc"
+	"pxd"
+	"pxe"
+	"pxeosngcnttqqz"
+	"pxfmbcsgkbqx"
+	"pxgmsplaz"
+	"pxkopdprgslnnn"
+	"pxmgjhsygoay"
+	"pxnonvv"
+	"pxpishfuyejobi"
+	"pxrfvgckopyoi"
+	"pxrjfrafzf"
+	"pxrzsynvyjti"
+	"pxsbwrtofdb"
+	"pxshdtqag"
+	"pxtcvu"
+	"pxujfzyoqvsm"
+	"pxuzbxdxmse"
+	"pxvwjri"
+	"pxx"
+	"pxxxe"
+	"pxyjtft"
+	"py"
+	"pyabmuwnx"
+	"pycnsyfumuakv"
+	"pycoqty"
+	"pydm"
+	"pydmqvqgjpde"
+	"pydslwzhmoyxk"
+	"pyhdebyxeuuey"
+	"pyihvpfung"
+	"pyiveybh"
+	"pyizjd"
+	"pylwsuk"
+	"pym"
+	"pymbudjwx"
+	"pymsizhplbg"
+	"pyqynxfldiny"
+	"pyrrqunupklckx"
+	"pysftfp"
+	"pysnwg"
+	"pyta"
+	"pyugqhe"
+	"pyvedlwpgiolpb"
+	"pyvsdossl"
+	"pywceyvkcv"
+	"pywtp"
+	"pyx"
+	"pyxoprpo"
+	"pyy"
+	"pyzqcluu"
+	"pyzqlqoir"
+	"pz"
+	"pzadeyr"
+	"pzcrldhbutrvo"
+	"pzdxap"
+	"pzhledvoqlymv"
+	"pzi"
+	"pzkohqdnc"
+	"pzmedac"
+	"pznaxdel"
+	"pznnnyltxpy"
+	"pzokmgtskhl"
+	"pzowzggybno"
+	"pzp"
+	"pzperk"
+	"pzpi"
+	"pzpwqh"
+	"pzqrkxpjhtgkbc"
+	"pzrgdcgysj"
+	"pzsdqhyp"
+	"pztcqgoud"
+	"pztsh"
+	"pzum"
+	"pzyiszckgu"
+	"pzykfzabuua"
+	"pzzyxiyfp"
+	"qa"
+	"qadpkakhyfbc"
+	"qafkcvvj"
+	"qaglmkihuy"
+	"qagxdlxbuwo"
+	"qaijanprnt"
+	"qainvcgfvicnc"
+	"qajhkxdac"
+	"qajtsicehihv"
+	"qakdannoknptug"
+	"qakimksajaxp"
+	"qakltzdtei"
+	"qakwztjvj"
+	"qalejfjse"
+	"qalorb"
+	"qalwmzo"
+	"qalz"
+	"qaniyxjnemzdl"
+	"qap"
+	"qaprbshj"
+	"qaqgunkyhsfivw"
+	"qarkztjw"
+	"qaryrygdavpjt"
+	"qasmczznj"
+	"qatfyfrwvksp"
+	"qaultsx"
+	"qawzz"
+	"qazdoviwkm"
+	"qazlbcfonfy"
+	"qazwfrpgbrwsvk"
+	"qb"
+	"qba"
+	"qbcgtvn"
+	"qbchpbpwrtka"
+	"qbdh"
+	"qbdyocjvmyt"
+	"qbhrwram"
+	"qbiffesik"
+	"qbilmlymlm"
+	"qbiqdxsnc"
+	"qbkdy"
+	"qblvxed"
+	"qbntk"
+	"qbqhteauxq"
+	"qbqtzphjfreh"
+	"qbrzhhohb"
+	"qbsaudboeggy"
+	"qbso"
+	"qbux"
+	"qbvtpu"
+	"qbvtxkxvj"
+	"qbzbe"
+	"qbzvj"
+	"qc"
+	"qcaihkhr"
+	"qcciemi"
+	"qccscrdjan"
+	"qcczmper"
+	"qcezkdv"
+	"qcffvho"
+	"qcfqeiuc"
+	"qcfqulednqyb"
+	"qcfu"
+	"qcgtver"
+	"qch"
+	"qci"
+	"qcieqzvijbgam"
+	"qckvbis"
+	"qckyrztal"
+	"qcnaqutookfnf"
+	"qcomcuqiw"
+	"qcor"
+	"qcpxuno"
+	"qcrlalglgsqp"
+	"qcsfibea"
+	"qcsl"
+	"qcv"
+	"qcvnzofobdq"
+	"qcvpdtglsmuyo"
+	"qcwlfsp"
+	"qcxvqpkwzlv"
+	"qcydipugx"
+	"qcyfrk"
+	"qd"
+	"qdasrtjsc"
+	"qdauovhpvtjml"
+	"qdb"
+	"qdbscnz"
+	"qdbx"
+	"qdclliqlu"
+	"qddnyzjlapm"
+	"qddpck"
+	"qdds"
+	"qdfloiagrwsaau"
+	"qdfzvmf"
+	"qdhl"
+	"qdi"
+	"qdje"
+	"qdjjug"
+	"qdjqi"
+	"qdk"
+	"qdkzkssyqxv"
+	"qdldsqldzgjao"
+	"qdllexos"
+	"qdltxxxkh"
+	"qdmtiz"
+	"qdntphfo"
+	"qdnykynjzczlc"
+	"qdorkxgbixcl"
+	"qdq"
+	"qdr"
+	"qdsrlskli"
+	"qdswp"
+	"qdtezzjj"
+	"qduzifmxubo"
+	"qdvepsc"
+	"qdwmtxbqpmycc"
+	"qdxnqrkygunyvl"
+	"qdystwwupmknr"
+	"qdyxkikvafipd"
+	"qdzguu"
+	"qe"
+	"qeamhjru"
+	"qeatsnmlzrieki"
+	"qeaxrytsyp"
+	"qebxhnqctqtak"
+	"qecblpk"
+	"qeeepnktdqbsyo"
+	"qeeixn"
+	"qefdk"
+	"qefii"
+	"qefrwbfgu"
+	"qehejmttipdrn"
+	"qeheuugvjjkeif"
+	"qehia"
+	"qehtrcjrvcta"
+	"qeizryf"
+	"qej"
+	"qejqpgyvz"
+	"qem"
+	"qemdtmlhadg"
+	"qemnokue"
+	"qeni"
+	"qenie"
+	"qenpfsbeqdus"
+	"qensnnqkp"
+	"qeocdbcu"
+	"qeojhntcifsn"
+	"qepu"
+	"qer"
+	"qeshrgknxogas"
+	"qesipdt"
+	"qetzxzjwyp"
+	"qeurti"
+	"qewc"
+	"qewusnpi"
+	"qewxbxexiuws"
+	"qex"
+	"qexqxglxgmwi"
+	"qexsycayecmv"
+	"qeyrzrjfowacqy"
+	"qf"
+	"qfat"
+	"qfbnhivqogb"
+	"qfbxtrptb"
+	"qfccmx"
+	"qfdggixtgretw"
+	"qffhoettytyjsk"
+	"qffouomn"
+	"qfgvhxlhner"
+	"qfhbup"
+	"qfhlsgm"
+	"qfhrn"
+	"qfirqnpmxt"
+	"qfizf"
+	"qfjvbyarirprg"
+	"qfjzrygkzyv"
+	"qfkjrx"
+	"qflitgzztzwxv"
+	"qfojwncqxtgnk"
+	"qfonsutqkwhh"
+	"qfp"
+	"qfpp"
+	"qfqifem"
+	"qfqrqfofrnw"
+	"qfqzrpcyx"
+	"qfrcq"
+	"qfrdtvorgf"
+	"qfrkjt"
+	"qftok"
+	"qfu"
+	"qfuydahfnzgp"
+	"qfv"
+	"qfwotql"
+	"qfxgwnvdsxscas"
+	"qfxwoo"
+	"qfy"
+	"qfzhch"
+	"qfzhrjyyh"
+	"qfzj"
+	"qg"
+	"qgamdorp"
+	"qgbvfhlhi"
+	"qgdxollxb"
+	"qgfcogiyggsj"
+	"qgfelq"
+	"qggdgybzb"
+	"qgghts"
+	"qgievn"
+	"qgijdnoqs"
+	"qgimdnliwz"
+	"qgiwipklrco"
+	"qgjtkpbkr"
+	"qgk"
+	"qglqavmsnmkt"
+	"qglxo"
+	"qgmhzmnhsgcxgi"
+	"qgod"
+	"qgotqnxwjwfot"
+	"qgpfcowfrkahi"
+	"qgrwagyhvzn"
+	"qgspcpptm"
+	"qgtqpgv"
+	"qgwembfgn"
+	"qgwomcxacjxto"
+	"qgxxzxjzorz"
+	"qgytarrjv"
+	"qgz"
+	"qha"
+	"qhax"
+	"qhbsrzcbjoha"
+	"qhcuzwqi"
+	"qhdgrcnanasip"
+	"qhefovbz"
+	"qheyd"
+	"qhgru"
+	"qhhdov"
+	"qhhoy"
+	"qhhqlqv"
+	"qhiavphubb"
+	"qhinfob"
+	"qhj"
+	"qhjbnantco"
+	"qhjcwrfalomcl"
+	"qhjunwzs"
+	"qhjwrbcsimuil"
+	"qhklpmbhfizc"
+	"qhkmwktq"
+	"qhlm"
+	"qhlqssf"
+	"qhmuqmv"
+	"qhmwxttofqr"
+	"qhnudu"
+	"qhoexz"
+	"qhoigcw"
+	"qhperrkql"
+	"qhpr"
+	"qhqcovlhx"
+	"qhromdewiafptd"
+	"qhscl"
+	"qhshludle"
+	"qhtiyg"
+	"qhtrmzjefgqcg"
+	"qhtsrtlxq"
+	"qhtxexcmmw"
+	"qhu"
+	"qhvaxdmpoyzxw"
+	"qhvdk"
+	"qhwdnvwgf"
+	"qhxnnwdu"
+	"qia"
+	"qiafsza"
+	"qiaglsynd"
+	"qiawroweoqqls"
+	"qibajpm"
+	"qibirki"
+	"qibmqdhtatph"
+	"qicmorww"
+	"qifdhxbns"
+	"qifeberbrlb"
+	"qifvspn"
+	"qihdstoaueyl"
+	"qihi"
+	"qihq"
+	"qiih"
+	"qiivxxhnwryyge"
+	"qikbxmvhx"
+	"qimfvclel"
+	"qimhgstcrvdpez"
+	"qimwchahiev"
+	"qinxlz"
+	"qinyxw"
+	"qipwglwy"
+	"qiq"
+	"qiqhorwvbqwjui"
+	"qirz"
+	"qisaivteuluwaf"
+	"qitbbki"
+	"qiubuzwqtbhr"
+	"qiytpojiwgsk"
+	"qizl"
+	"qizowkkpfrhc"
+	"qizpwnp"
+	"qj"
+	"qjcboehyh"
+	"qje"
+	"qjeafpyjwfxbcb"
+	"qjeekwdosmrib"
+	"qjefdgct"
+	"qjfmcrlknf"
+	"qjgl"
+	"qjgmbknsw"
+	"qjgrnz"
+	"qjhkpcwhbodii"
+	"qjjtnqoxeqmk"
+	"qjjtpcnhwgpd"
+	"qjkciauev"
+	"qjmkenuzpe"
+	"qjnoyaneoqkxa"
+	"qjo"
+	"qjowuo"
+	"qjqhbu"
+	"qjqsdn"
+	"qjqtguklkgh"
+	"qjrdkbkeixgo"
+	"qjrmmvykipca"
+	"qjtgglnoied"
+	"qjuwzbg"
+	"qjvcbtvqdpc"
+	"qjvisbz"
+	"qjwkwkevaudi"
+	"qjwtbznn"
+	"qjyazetsoljwsd"
+	"qjyeqndbkumyqa"
+	"qjyohmusk"
+	"qka"
+	"qkbgcqtig"
+	"qkbvs"
+	"qkddjpdwtccx"
+	"qkdjt"
+	"qkeffkpvwcmgvz"
+	"qkfmtbopdukgc"
+	"qkfzpxbrkgdywe"
+	"qkgrof"
+	"qkgvmxm"
+	"qkhlbxyor"
+	"qkilbamgpavvmr"
+	"qkipbgfibj"
+	"qkj"
+	"qkjmitmarn"
+	"qklakh"
+	"qkmewsfdo"
+	"qkmqqrmhu"
+	"qkmrvghobgp"
+	"qkofiajomdt"
+	"qkosjkceddv"
+	"qkpubpugr"
+	"qkqnnmenpidn"
+	"qkqu"
+	"qkrmnuycqbqd"
+	"qkrqrtittz"
+	"qkv"
+	"qkvgxbxfnmwdgb"
+	"qkvl"
+	"qkxdsyiacumtm"
+	"qkxsnvjgu"
+	"qkxyjnrphg"
+	"qkzieb"
+	"ql"
+	"qlbnrsi"
+	"qlcayxiflbc"
+	"qlclvdeid"
+	"qldcaohyqtol"
+	"qldoruigypnth"
+	"qldtkgledygdf"
+	"qlewmosyxacxvn"
+	"qlgcaam"
+	"qlgupjm"
+	"qlh"
+	"qlineqwajmrvi"
+	"qlno"
+	"qlpgeerwuhqxqk"
+	"qlpiudpajt"
+	"qlqdnt"
+	"qlsbfnh"
+	"qlwcwh"
+	"qlxa"
+	"qlysuspbzhuw"
+	"qlzrkpcz"
+	"qm"
+	"qmbplulg"
+	"qmeiq"
+	"qmiyafjqyitnsc"
+	"qmjfwha"
+	"qmjwqj"
+	"qmna"
+	"qmneryjnhe"
+	"qmnynga"
+	"qmpem"
+	"qmq"
+	"qmqcbefqq"
+	"qmt"
+	"qmtbutcwieo"
+	"qmu"
+	"qmudsuxiykkh"
+	"qmuqrigt"
+	"qmux"
+	"qmvuhhg"
+	"qmxaqsdujzy"
+	"qmyfylyfcnqah"
+	"qmzdsapfxys"
+	"qn"
+	"qnas"
+	"qnda"
+	"qndkgglzoab"
+	"qndu"
+	"qnef"
+	"qnfghdsesqdx"
+	"qnhbdwknbr"
+	"qnikzlrydz"
+	"qnksrl"
+	"qnlnat"
+	"qnmj"
+	"qnmoyvbhlixpd"
+	"qnnc"
+	"qnndwp"
+	"qnnnwc"
+	"qnphkxbmsaweaa"
+	"qnplxeiph"
+	"qnrgxexgjiep"
+	"qnsdosvzt"
+	"qnuttz"
+	"qnuxeeexic"
+	"qnwljqtwh"
+	"qnxphmyjkbur"
+	"qnxscqlypmbdgt"
+	"qnzsjfdhngfc"
+	"qnztegv"
+	"qo"
+	"qoab"
+	"qoablzkhdxhlby"
+	"qoawskmc"
+	"qobcddtwnyix"
+	"qodbrzsspxncd"
+	"qofme"
+	"qoftqhvmfckln"
+	"qogcxfqt"
+	"qogmrnyyj"
+	"qohmdtbfk"
+	"qoidjpukyt"
+	"qoiyjeikqwlof"
+	"qojhdn"
+	"qojyrsws"
+	"qok"
+	"qoklcrqvxjota"
+	"qokuqrrwnow"
+	"qolyfmonbp"
+	"qomufixxo"
+	"qonwv"
+	"qooajdbhkbsee"
+	"qoqfhyy"
+	"qoqh"
+	"qoqpunhylhou"
+	"qoqtkngzsytr"
+	"qorhsxwpabuyxa"
+	"qorlkapmh"
+	"qosjg"
+	"qosy"
+	"qouppebhurrkwg"
+	"qovc"
+	"qovczkgmesf"
+	"qoyhx"
+	"qoyufeakempczz"
+	"qozaglyx"
+	"qp"
+	"qpcbosxadh"
+	"qpe"
+	"qphprcspa"
+	"qphsanvedkclu"
+	"qpiy"
+	"qpk"
+	"qplystcu"
+	"qpmhflaufut"
+	"qpmlgqc"
+	"qpprdphuc"
+	"qpq"
+	"qpspwkqzfs"
+	"qpssganftmjefo"
+	"qptirqtkio"
+	"qptwqbyt"
+	"qpubdtwnu"
+	"qpvtatqlyc"
+	"qpwwiyrru"
+	"qpx"
+	"qpyiovzxahd"
+	"qq"
+	"qqafd"
+	"qqayotyxnp"
+	"qqbitckezednru"
+	"qqcodnufascqen"
+	"qqdrzioewud"
+	"qqdtyk"
+	"qqemuqq"
+	"qqexbj"
+	"qqgljj"
+	"qqgnfdkbyuclj"
+	"qqhkauf"
+	"qqjrqkmkqbgnw"
+	"qqkhbdqixap"
+	"qqknkmh"
+	"qqlrcskpan"
+	"qqlrhfblx"
+	"qqmhqh"
+	"qqmjgx"
+	"qqodtk"
+	"qqptp"
+	"qqqdpousqqqg"
+	"qqqqiulowkddx"
+	"qqr"
+	"qqrqyv"
+	"qqrzxvravexx"
+	"qqrzzrnwflh"
+	"qqs"
+	"qqusxdkthc"
+	"qqv"
+	"qqvxlygwggzv"
+	"qqwdbxkbfz"
+	"qqxd"
+	"qqxzgergocsigp"
+	"qqyntvxs"
+	"qqyrnbhixoog"
+	"qr"
+	"qrbcoboazvveqf"
+	"qrdsagedhbpkue"
+	"qrdtr"
+	"qrenbnyzvwiq"
+	"qrfob"
+	"qrg"
+	"qrgcbgczfjiv"
+	"qrgfjaxsb"
+	"qrhmzopnaoxlk"
+	"qrijtwrfphfaw"
+	"qrikfnamwmoi"
+	"qrilhisnajuaag"
+	"qriwtage"
+	"qrjzbhc"
+	"qrkmtlxuoxym"
+	"qrlq"
+	"qrlsukjdy"
+	"qrmqn"
+	"qrmr"
+	"qrmsq"
+	"qrmsqsaf"
+	"qrntjqnehkmpr"
+	"qrpayvbh"
+	"qrq"
+	"qrquujpft"
+	"qrrrwmsn"
+	"qrryzxwf"
+	"qrs"
+	"qru"
+	"qruhuzbw"
+	"qruwjpjrqtripo"
+	"qruwtjr"
+	"qrvgcddbp"
+	"qrvo"
+	"qrwsa"
+	"qrx"
+	"qrxbwvajdbqew"
+	"qrxoujjpeawonv"
+	"qrz"
+	"qrzv"
+	"qs"
+	"qsadd"
+	"qsakjyibvgte"
+	"qsbmpforivync"
+	"qsccpiz"
+	"qsdjfsj"
+	"qsdmcvjqzrbnjq"
+	"qsdtrnijfk"
+	"qselrvanhvhmbg"
+	"qsendocksnhfca"
+	"qsenv"
+	"qsfvuxhuaxye"
+	"qsfyelq"
+	"qsgt"
+	"qshav"
+	"qsihrqdii"
+	"qsjfepyxzxv"
+	"qsjuqzhibb"
+	"qsjwyppfvnpqrs"
+	"qsm"
+	"qsmai"
+	"qsnbvbgtqokpc"
+	"qsnwza"
+	"qsqll"
+	"qsrjmjcoq"
+	"qst"
+	"qstluaqkk"
+	"qstshteja"
+	"qstvxgnjbb"
+	"qsuoxadfpibjw"
+	"qsusls"
+	"qsvksfuxiatjlg"
+	"qsvr"
+	"qswjvyuthdzkap"
+	"qsx"
+	"qsxasbwdbwbcdh"
+	"qsxzupzbfskuoh"
+	"qt"
+	"qtazlaccdw"
+	"qtdqwsyxktbcw"
+	"qtetyy"
+	"qtf"
+	"qtfo"
+	"qtfzyhcnvevb"
+	"qtfzzaaxozwbc"
+	"qtgndjiuam"
+	"qtgtidd"
+	"qtgtzcz"
+	"qtiqdajz"
+	"qtiznnqnsny"
+	"qtjeelwehxohft"
+	"qtkplynwo"
+	"qtlle"
+	"qtllfuxjrhios"
+	"qtndufbadfx"
+	"qtolfdxak"
+	"qtp"
+	"qtqwed"
+	"qtsjwvycbqw"
+	"qtspazwyipded"
+	"qtxfra"
+	"qtxjmn"
+	"qtxozqddwnd"
+	"qu"
+	"quarypykfnyzj"
+	"qubnh"
+	"qubtqiadnjnf"
+	"qucgnys"
+	"qudda"
+	"quepb"
+	"quhhgpgdyeeaa"
+	"quhmnbbxxglmky"
+	"quklywkdstqxp"
+	"quladmdwtm"
+	"qulxclkz"
+	"qumicwbviusyq"
+	"qumrhqrkiiu"
+	"qumsnvnag"
+	"qunfufh"
+	"qunhnzbhcjwdwc"
+	"qunytehbvwri"
+	"quogy"
+	"quoyegk"
+	"quqqer"
+	"qurdfymrzeigp"
+	"qutbqelgzugi"
+	"qutdbtk"
+	"qutwsbcmx"
+	"qutzvu"
+	"quzqj"
+	"quzsj"
+	"quzvlkudfmbitw"
+	"qv"
+	"qvaesil"
+	"qvaifi"
+	"qvanhohqdkt"
+	"qvaxweaf"
+	"qvbqxyinoo"
+	"qvccxum"
+	"qvdagjav"
+	"qvdemebihmvdr"
+	"qvdjpibiwfoueb"
+	"qveyfrrbqg"
+	"qvfkl"
+	"qvgvqruz"
+	"qvleelzbiiadhy"
+	"qvm"
+	"qvmlsyt"
+	"qvnwldd"
+	"qvoctk"
+	"qvolrib"
+	"qvpgmiqu"
+	"qvpvfe"
+	"qvrbjdajn"
+	"qvrfzhufnzh"
+	"qvsnkbelv"
+	"qvtdiwl"
+	"qvtmnrgiwdfxcj"
+	"qvvk"
+	"qvwfkzvor"
+	"qvwfzau"
+	"qvyln"
+	"qvymytt"
+	"qvyody"
+	"qvyovxq"
+	"qvyygzfqoi"
+	"qvzfiagsbhr"
+	"qvzujdqexqx"
+	"qvzypug"
+	"qw"
+	"qwadw"
+	"qwarctividyac"
+	"qwbgvtuo"
+	"qwccgbs"
+	"qwcfskyrlw"
+	"qwegz"
+	"qwemhxbtzuf"
+	"qweyib"
+	"qwfkjpp"
+	"qwftdokzdov"
+	"qwgc"
+	"qwiaqls"
+	"qwivncdbe"
+	"qwj"
+	"qwkaordsymsvn"
+	"qwm"
+	"qwmkkb"
+	"qwmnqhplgl"
+	"qwntglrqc"
+	"qwozsbdoj"
+	"qwpgplj"
+	"qwpxv"
+	"qwqeyli"
+	"qwrbnmddsb"
+	"qwsxqyjrawudc"
+	"qwvgbtvtxwf"
+	"qwwfcyopnt"
+	"qwy"
+	"qwytngrtfykzdd"
+	"qwzpzrudvlcrr"
+	"qx"
+	"qxaqrqdg"
+	"qxasyujgbjdy"
+	"qxbw"
+	"qxffhzma"
+	"qxfphepnhs"
+	"qxguduaiwp"
+	"qxjezosax"
+	"qxjmagp"
+	"qxlcxl"
+	"qxlr"
+	"qxofwzxcrywb"
+	"qxq"
+	"qxqnbegaj"
+	"qxrhtllbicm"
+	"qxsbucj"
+	"qxscnpsyylp"
+	"qxszcpduq"
+	"qxtd"
+	"qxvir"
+	"qxwaordetctchg"
+	"qxwnoqymjxjuar"
+	"qxysrpcfuyxpz"
+	"qy"
+	"qybjbclldvqo"
+	"qybkjfgqdeu"
+	"qydldumgppnph"
+	"qydrkwjjrlejk"
+	"qyfyrvufqb"
+	"qygepwppzz"
+	"qygovaxyjr"
+	"qygqaie"
+	"qygviqqde"
+	"qyjaoebhw"
+	"qyjen"
+	"qyjxsvtni"
+	"qykupee"
+	"qylhvdm"
+	"qymid"
+	"qyo"
+	"qyokhfgos"
+	"qypnksgwfacqpd"
+	"qypuhr"
+	"qyrzyqidxo"
+	"qysslaybyup"
+	"qysv"
+	"qyswnwyjc"
+	"qytyuzqrnoktm"
+	"qyudx"
+	"qyvknr"
+	"qyywz"
+	"qyz"
+	"qyzrhrqypeyvbf"
+	"qz"
+	"qza"
+	"qzank"
+	"qzapxk"
+	"qzbbvncn"
+	"qzbnmdaykpdnv"
+	"qzbtuujofctup"
+	"qzcnpybjxyw"
+	"qzcy"
+	"qzdvzlmndejm"
+	"qze"
+	"qzfbeiqonbnomw"
+	"qzi"
+	"qzif"
+	"qziqb"
+	"qzlhrtcgqpt"
+	"qzliyemicuzw"
+	"qzon"
+	"qzonvuoogtzkx"
+	"qzoolsffleb"
+	"qzp"
+	"qzphbmlut"
+	"qzpqcqscpkj"
+	"qzptsvrqptvxs"
+	"qzqme"
+	"qzrano"
+	"qzrblnim"
+	"qzregtervrqyrp"
+	"qzrpsxttfrpzkt"
+	"qzsdkpxqqnqzj"
+	"qzssnbloagj"
+	"qztht"
+	"qzumvskm"
+	"qzuwiffofgfveg"
+	"qzvvqjoylsw"
+	"qzwbhfjz"
+	"qzxlpetni"
+	"qzxwscguxme"
+	"qzynaea"
+	"qzyuank"
+	"qzzkgpqlxbuso"
+	"ra"
+	"raaai"
+	"rabcyrlpbvq"
+	"racrogodl"
+	"racz"
+	"radic"
+	"radmeejzayaa"
+	"raekuhdvlhaah"
+	"raet"
+	"rafhv"
+	"rafjrppamxwze"
+	"rafxd"
+	"ragljxjmtxg"
+	"rajwbnjkm"
+	"rak"
+	"ralqpqlhmtxnuo"
+	"ramdhufev"
+	"ramvgnxaqhyo"
+	"ramxbsnaje"
+	"rapwhud"
+	"rascqmf"
+	"rastrwldigddw"
+	"ratipsdd"
+	"ratjqnsigzc"
+	"raukksem"
+	"rauzigminkdqs"
+	"ravsudjphn"
+	"raw"
+	"raxiu"
+	"raxyflxaeeoof"
+	"raz"
+	"razgww"
+	"rb"
+	"rbarmi"
+	"rbblprlep"
+	"rbc"
+	"rbcoi"
+	"rbdbgttsitvkci"
+	"rbdnyvdhg"
+	"rbdxpmiue"
+	"rbfhyijiyamd"
+	"rbfnnlmhrrmvg"
+	"rbfvumbdk"
+	"rbfzgxruhu"
+	"rbgczghwz"
+	"rbguyxzmaazlh"
+	"rbieqkjgz"
+	"rbihbd"
+	"rbmaks"
+	"rbnoorrnruc"
+	"rbnstjn"
+	"rboapmsuvypk"
+	"rbofhsfvbg"
+	"rbonamlerq"
+	"rbpjlqxexzqtr"
+	"rbqdfdyijf"
+	"rbqmzm"
+	"rbqojaghkx"
+	"rbsk"
+	"rbtkzassdkwx"
+	"rbvrq"
+	"rbwrv"
+	"rbxojlpjatu"
+	"rbxsacagrxj"
+	"rbygr"
+	"rbyjbzycw"
+	"rbzevekq"
+	"rbzrpkyatwpphn"
+	"rc"
+	"rcbbprk"
+	"rccmcxjh"
+	"rcebdlxk"
+	"rceeynil"
+	"rcfucrozrmni"
+	"rcgiur"
+	"rchd"
+	"rchif"
+	"rchmejgvxm"
+	"rcizuxhy"
+	"rcjvyxhbya"
+	"rckovi"
+	"rckqq"
+	"rcmktn"
+	"rcmrqkydrhmjt"
+	"rcno"
+	"rco"
+	"rcoatre"
+	"rcpfdywav"
+	"rcphzuo"
+	"rcpw"
+	"rcqyjcblqpjc"
+	"rcrvvjxfcu"
+	"rctmwdzjdrddt"
+	"rcttsstalqeq"
+	"rcvslmis"
+	"rcvv"
+	"rcvyugpwbww"
+	"rcwmizmhwmj"
+	"rcwntezhwpgg"
+	"rcza"
+	"rczjbh"
+	"rd"
+	"rdaco"
+	"rdajvvhkpyo"
+	"rdb"
+	"rdbdoposox"
+	"rdcmjwaexcmzfn"
+	"rddigydtj"
+	"rddrcsznqx"
+	"rddsjnawe"
+	"rdevecymzaf"
+	"rdfba"
+	"rdhk"
+	"rdhtmwy"
+	"rdhzifaaxm"
+	"rdiiyofcrf"
+	"rdintjblpo"
+	"rdipxfniljki"
+	"rdkcuqbgamtfc"
+	"rdkhniv"
+	"rdmkcb"
+	"rdn"
+	"rdowzeniuchn"
+	"rdp"
+	"rdpasjuizewb"
+	"rdpfg"
+	"rdpzrpvkxm"
+	"rdqilfdvsi"
+	"rdrlavaqcwcew"
+	"rdrryhfnntyf"
+	"rdsejrjwzvp"
+	"rdsjdwzpikgvma"
+	"rdsrikjklifjtx"
+	"rdtfidgbvve"
+	"rdtxcrvicf"
+	"rdxjcr"
+	"rdybj"
+	"rdybuxpw"
+	"rdzeoahq"
+	"rdzqy"
+	"rdzsdu"
+	"re"
+	"recohfpc"
+	"redb"
+	"redqgsdrphdity"
+	"reegckzjfbptzh"
+	"reeghhlw"
+	"ref"
+	"regubqvnrezty"
+	"reh"
+	"rejl"
+	"reklpjwoofjk"
+	"relgqpdcfd"
+	"relk"
+	"rem"
+	"reowhzqiumer"
+	"repjwr"
+	"rerjfhzmdc"
+	"reryaimmtnuoyx"
+	"res"
+	"resicyvofvql"
+	"reudmhk"
+	"rewozpedrykpa"
+	"rexmqn"
+	"reye"
+	"rezpnfpzchslx"
+	"rf"
+	"rfbymkxvhltf"
+	"rfcfpnjz"
+	"rfdpfstft"
+	"rffgkiddiyj"
+	"rffuygsggr"
+	"rfgddehcu"
+	"rfgdpeyvxwt"
+	"rfgo"
+	"rfgqxfhnkuclsz"
+	"rfh"
+	"rfhcgpfbvmjae"
+	"rfi"
+	"rfitndkcxyyw"
+	"rfjedawevjjvux"
+	"rfkvqdovfilihy"
+	"rfl"
+	"rflqbw"
+	"rfoorosvebaugm"
+	"rfr"
+	"rfswuhsjmrjisv"
+	"rftzqp"
+	"rfwfrnsly"
+	"rfzipwown"
+	"rfztzshegavl"
+	"rfzuysbw"
+	"rg"
+	"rgapeotsr"
+	"rgc"
+	"rgcenueozgt"
+	"rgcwpomozs"
+	"rgdkvpg"
+	"rgdkwjnxzhwxfi"
+	"rgdnemoac"
+	"rgen"
+	"rgeubuzfdbk"
+	"rggkpp"
+	"rgh"
+	"rgingkbqt"
+	"rgjjlsjnlehg"
+	"rgmnhsgsrpr"
+	"rgnbplsrgqnpln"
+	"rgndvxtujzv"
+	"rgovvtc"
+	"rgp"
+	"rgpeqxnpolp"
+	"rgpjf"
+	"rgqmylws"
+	"rgrc"
+	"rgrdvmkrxso"
+	"rgswqmendlbtrw"
+	"rgthb"
+	"rgttogtc"
+	"rgud"
+	"rgwovkzix"
+	"rgxnzhmgdkfmv"
+	"rgzrvmdyewmntw"
+	"rh"
+	"rhaqfsa"
+	"rhbjpabfc"
+	"rhbsjezbsiig"
+	"rheuijn"
+	"rhfc"
+	"rhfp"
+	"rhhbtw"
+	"rhhktev"
+	"rhlfcomyrlu"
+	"rhlhvhyoj"
+	"rhmqlsloiv"
+	"rhnk"
+	"rhnlwlivk"
+	"rhnnqixfs"
+	"rhounoryhkqz"
+	"rhpexvapsx"
+	"rhqiyeqpsawi"
+	"rhskshxxrpmpe"
+	"rhsvkwbghxqrm"
+	"rhswdadtvmtdev"
+	"rhtxthdurvzs"
+	"rhuzwqoh"
+	"rhvuciadrgooc"
+	"rhzqya"
+	"riaxcmmqsune"
+	"ribmumc"
+	"ricakwoqcxmhqx"
+	"ridbsx"
+	"ridi"
+	"rieuezhbbh"
+	"rig"
+	"rigxvpjmqyk"
+	"rigyziezbo"
+	"rihl"
+	"rikrsqok"
+	"rilepb"
+	"rimlyjzex"
+	"rimmug"
+	"rimnccmih"
+	"rimyu"
+	"rinfhymlexaprj"
+	"ripefjnkqmqwi"
+	"riqcsmwksx"
+	"risaftdaeci"
+	"risbggjw"
+	"risnga"
+	"ritkmbzs"
+	"riugcno"
+	"riujmnm"
+	"rivjvnzrsrdzj"
+	"rivxulrakv"
+	"riyqii"
+	"riz"
+	"rjaf"
+	"rjbm"
+	"rjci"
+	"rjcqjgwoa"
+	"rjcwtolir"
+	"rjfacmgfycp"
+	"rjg"
+	"rjlebdmnqfa"
+	"rjlo"
+	"rjlygygnxuyw"
+	"rjnzzkji"
+	"rjoajhkvx"
+	"rjpcytmdyxv"
+	"rjqybeppt"
+	"rjrdwkduyytoz"
+	"rjriwpkdgukbaa"
+	"rjsmpgoerzhuno"
+	"rjsxjxzlmcai"
+	"rjtwgdbgzqfi"
+	"rju"
+	"rjuf"
+	"rjxbb"
+	"rjxefwrearajcv"
+	"rjxfntejv"
+	"rjyayjefqjv"
+	"rjygcelpf"
+	"rjyiqwfyhonwmy"
+	"rjzdxj"
+	"rjzojrjls"
+	"rjzpz"
+	"rk"
+	"rkacp"
+	"rkafdfflajwts"
+	"rkaza"
+	"rkbhylgb"
+	"rkbxmabu"
+	"rkces"
+	"rkcmfolqrxblky"
+	"rkcxbdgtm"
+	"rkdiqjv"
+	"rkfblo"
+	"rkfggpid"
+	"rkgynlbtncvx"
+	"rkidpb"
+	"rkkb"
+	"rkkl"
+	"rklirjv"
+	"rknrg"
+	"rknxf"
+	"rkokpc"
+	"rkorbjtsktc"
+	"rkow"
+	"rkr"
+	"rkrn"
+	"rkrqz"
+	"rkvhvyscrkss"
+	"rkvkryggwobe"
+	"rkvvigqtim"
+	"rkwjsa"
+	"rkx"
+	"rkxdujjaehhg"
+	"rkxzmwyxbsvovw"
+	"rkyfzr"
+	"rkzqpktd"
+	"rl"
+	"rlavioo"
+	"rlaxjlhmiatk"
+	"rlc"
+	"rldu"
+	"rleff"
+	"rlgfiyfdgmrnj"
+	"rlhjcyyfol"
+	"rljhvlrrdoba"
+	"rll"
+	"rlljomsjsfuwd"
+	"rllmufhuzgsl"
+	"rlmurnqeowpz"
+	"rlnmeww"
+	"rlnnwxxns"
+	"rlopgditqvefaa"
+	"rlpwgrvu"
+	"rlpyjs"
+	"rlqscmpemdupgb"
+	"rlrahlcds"
+	"rlrazibgdovf"
+	"rlsorzywht"
+	"rltfqmcg"
+	"rltgzfdbirchz"
+	"rltldxklfb"
+	"rlvyben"
+	"rlwgd"
+	"rlxdekxmjep"
+	"rlxtbru"
+	"rlzaogy"
+	"rm"
+	"rmapfdeet"
+	"rmbhdqr"
+	"rmcfyd"
+	"rmcxngyuh"
+	"rmczlzy"
+	"rmdladqggdptln"
+	"rmdvzqbv"
+	"rmesusfwqrshqb"
+	"rmeybalbuykgb"
+	"rmfagvq"
+	"rmgmiono"
+	"rmh"
+	"rmhbnsfc"
+	"rmhkeplq"
+	"rmhwrob"
+	"rmiewtovir"
+	"rmimfxnqe"
+	"rmjhlrrz"
+	"rmkeereqqs"
+	"rmlarunonmlrl"
+	"rmlbrbopt"
+	"rmltppkfztym"
+	"rmlunumwozsx"
+	"rmmj"
+	"rmmrsycp"
+	"rmritqtpckk"
+	"rmrmtssude"
+	"rmrnywwyupx"
+	"rmsudhf"
+	"rmtfwuvdm"
+	"rmwrwjcbltscfm"
+	"rmxbedk"
+	"rmzflbi"
+	"rn"
+	"rncvamyl"
+	"rnfilsc"
+	"rngpvf"
+	"rnjwnxpg"
+	"rnl"
+	"rnltkjyhiewhr"
+	"rnmhahiqw"
+	"rnmkledofqiwbh"
+	"rnnh"
+	"rnnjnd"
+	"rnovrcvsue"
+	"rnp"
+	"rnrcwrniv"
+	"rnrzclem"
+	"rnsrogo"
+	"rnsrrbtq"
+	"rntnwxda"
+	"rnvb"
+	"rnvke"
+	"rnxhrofszc"
+	"rnxsczgwmks"
+	"rnydeabmzcg"
+	"rnyszdpepk"
+	"ro"
+	"roahckqthj"
+	"roaijxjp"
+	"roc"
+	"rodfxwyfywr"
+	"rof"
+	"rogeiq"
+	"rohixqe"
+	"rohkexkuso"
+	"roidnxpnttpyq"
+	"rojkjosynpiew"
+	"rojqqscekyj"
+	"rokeitsbr"
+	"rokgofadnhpbn"
+	"rolgbcxdd"
+	"rolrkvdlbwtk"
+	"romnq"
+	"ron"
+	"roodmeksre"
+	"ropcaeunymedz"
+	"rorbrwszaiqd"
+	"rosxsjo"
+	"rotgtbrqpe"
+	"rougpxdtqc"
+	"rovblxcki"
+	"rowbipwycwpd"
+	"rowigw"
+	"rowkhm"
+	"rowzoasudv"
+	"roybcntagquxl"
+	"royi"
+	"rp"
+	"rpasikvsuulxha"
+	"rpbg"
+	"rpbgnvf"
+	"rpbhbop"
+	"rpdannppta"
+	"rpeli"
+	"rpfybxx"
+	"rpgtgxi"
+	"rpidjzyjzubf"
+	"rpj"
+	"rplla"
+	"rplr"
+	"rpphsxobfyj"
+	"rppp"
+	"rpqhojy"
+	"rpqlmk"
+	"rprkvtsxwyw"
+	"rprt"
+	"rprtsx"
+	"rps"
+	"rpsgqvhlizfh"
+	"rpsidvgacs"
+	"rpt"
+	"rptsmvihadi"
+	"rpuoq"
+	"rpxrjc"
+	"rpxtyhnhp"
+	"rpybyr"
+	"rpygs"
+	"rpzzicbc"
+	"rq"
+	"rqbaevkzbw"
+	"rqcuvgmgvzz"
+	"rqdedrptu"
+	"rqdindxzks"
+	"rqdzf"
+	"rqene"
+	"rqfbwgg"
+	"rqfqn"
+	"rqifxocd"
+	"rqifyipaqq"
+	"rqioo"
+	"rqjtxqlox"
+	"rqkfixmiza"
+	"rqkpgoi"
+	"rql"
+	"rqlkk"
+	"rqlzrzbon"
+	"rqmpffzvzshnm"
+	"rqnk"
+	"rqnzmvjyrpeu"
+	"rqoxhighckdnvm"
+	"rqoy"
+	"rqsal"
+	"rqssudgbku"
+	"rqsts"
+	"rqsuvoevag"
+	"rqt"
+	"rqvnkulga"
+	"rqwakbtywykk"
+	"rqwtqdl"
+	"rqwwpnygpqtxwf"
+	"rqx"
+	"rqynyesuwnhboc"
+	"rqyvdnthbjsgfp"
+	"rqyxvyr"
+	"rr"
+	"rracuavb"
+	"rrdjligxrmbzc"
+	"rrekodifnwlad"
+	"rrfdqa"
+	"rrfhygnzpev"
+	"rrfwbl"
+	"rrgnihrnv"
+	"rrgo"
+	"rrgozbhua"
+	"rrgstogebwsq"
+	"rrikpwhqma"
+	"rrir"
+	"rrixworkqjpi"
+	"rrjokzmfvmxwx"
+	"rrkolprunk"
+	"rrl"
+	"rrm"
+	"rrmgqixullt"
+	"rroanxipr"
+	"rroprnxfzbip"
+	"rrorj"
+	"rrpfberja"
+	"rrpivqysxn"
+	"rrqg"
+	"rrqypexijdyo"
+	"rrsg"
+	"rruqbjkmvc"
+	"rrwodmukldr"
+	"rryohejsgtmels"
+	"rrzxqvs"
+	"rs"
+	"rsabltmtneei"
+	"rsbmlpqlkrct"
+	"rsbydsj"
+	"rscmveib"
+	"rsexnn"
+	"rsf"
+	"rsfncue"
+	"rsgtgiq"
+	"rsgzbuida"
+	"rsh"
+	"rskirpivc"
+	"rskoqvkkfgra"
+	"rskotwfagsmmu"
+	"rskpec"
+	"rslppzsqt"
+	"rslqevdlqvyy"
+	"rslvjwfou"
+	"rsmnswpwxpzvm"
+	"rsnjqiocbdri"
+	"rsoj"
+	"rspghy"
+	"rspkhmnnlvncau"
+	"rsqjrch"
+	"rsqqoydefzt"
+	"rsrcwdmdimbcrl"
+	"rsrifk"
+	"rsscnbecxm"
+	"rssefmdejg"
+	"rsudlbphlgdmm"
+	"rsvncuvr"
+	"rswkacyewrzpf"
+	"rswpiznr"
+	"rswr"
+	"rswrhersdznxnl"
+	"rt"
+	"rtaagwkgppx"
+	"rtaeccawducy"
+	"rtakjbvmxbjf"
+	"rtbdtvmp"
+	"rtbeyudak"
+	"rtbxoschedjo"
+	"rtczirsg"
+	"rtdjzezpvy"
+	"rteyqaaqmu"
+	"rtfttdao"
+	"rtggcuoexcdx"
+	"rtgzq"
+	"rthvhgkrung"
+	"rtidentegojd"
+	"rtipzfwculhay"
+	"rtjechzvphore"
+	"rtk"
+	"rtlbhrvrea"
+	"rtleezhc"
+	"rtlzaazoxpngf"
+	"rtn"
+	"rtnpyhott"
+	"rtonxoqtpzqze"
+	"rtoqrjunkvgpb"
+	"rtorlbifg"
+	"rtpgidsh"
+	"rtq"
+	"rtqb"
+	"rtrznosqpf"
+	"rtsrjwqryqsl"
+	"rtsuioihurmkos"
+	"rttdm"
+	"rtte"
+	"rttewaoz"
+	"rttpumnkpqnflv"
+	"rtvfmcmz"
+	"rtyfil"
+	"rtyloofzfuo"
+	"ru"
+	"ruafqrmcy"
+	"rubk"
+	"rubodsprjgrx"
+	"ruedmb"
+	"ruffxncodapyul"
+	"rufk"
+	"rufxarfyg"
+	"rugzydyh"
+	"ruhenwxgwlphbh"
+	"ruhlfgebeiqq"
+	"ruhoxqce"
+	"ruhpzygaindob"
+	"ruirjvxncbc"
+	"rukalklhafxq"
+	"rukotnt"
+	"rula"
+	"runzmyjsfkthv"
+	"ruo"
+	"rurkcro"
+	"rurxqlcoz"
+	"rusmoryj"
+	"rutbrtqe"
+	"ruuf"
+	"ruvlivbl"
+	"ruvymytmpw"
+	"ruw"
+	"ruwqogqcbw"
+	"ruyakazckmbklz"
+	"ruzqwanvtmjwi"
+	"rv"
+	"rvbior"
+	"rvbiz"
+	"rvbkxcod"
+	"rvc"
+	"rvccaifixmjplv"
+	"rvdg"
+	"rvdgsviys"
+	"rvdlda"
+	"rvej"
+	"rvgzkyxri"
+	"rvmsmhmao"
+	"rvmzh"
+	"rvnvxdivifpzz"
+	"rvqvuayeeg"
+	"rvsaweztfqzig"
+	"rvtwbxbeskl"
+	"rvtwlvl"
+	"rvu"
+	"rvuwfizdl"
+	"rvxixec"
+	"rvy"
+	"rw"
+	"rwbbrnxqo"
+	"rwc"
+	"rwcyemrhdg"
+	"rwekcdw"
+	"rwflpxauxl"
+	"rwguqa"
+	"rwhkxdghjs"
+	"rwi"
+	"rwihjonikklsmv"
+	"rwixk"
+	"rwj"
+	"rwjiovx"
+	"rwkmbl"
+	"rwlgqvfzf"
+	"rwlqdgksnsy"
+	"rwlqegz"
+	"rwm"
+	"rwpapzhfjocot"
+	"rwpci"
+	"rwpg"
+	"rwroyhwykpn"
+	"rwsoteywk"
+	"rwtbguuui"
+	"rwulowuhptkwa"
+	"rwvhhp"
+	"rwxjocyfigxirw"
+	"rwyitr"
+	"rwz"
+	"rx"
+	"rxcomq"
+	"rxcunpx"
+	"rxd"
+	"rxfbl"
+	"rxfz"
+	"rxhkdzlkshl"
+	"rxidrwxo"
+	"rxkplnrccfhjl"
+	"rxlcezmklvn"
+	"rxmkitrsebcsj"
+	"rxmmouu"
+	"rxngrjglwighvx"
+	"rxpf"
+	"rxqelhmjzgkhol"
+	"rxqgjtaxihq"
+	"rxrenlqj"
+	"rxrvktqxqsez"
+	"rxs"
+	"rxswuhiyibz"
+	"rxumreahbnjyd"
+	"rxvbruwoma"
+	"rxw"
+	"rxwbusojcupge"
+	"rxwgvu"
+	"rxykeizr"
+	"rxzwtxq"
+	"ry"
+	"rya"
+	"ryakvnc"
+	"ryaptckfp"
+	"ryauywdp"
+	"rybjjz"
+	"ryblpqhasr"
+	"ryceke"
+	"ryeizabbyh"
+	"ryeyogwmk"
+	"ryeyvhyitbtpe"
+	"ryftxiybdbvzee"
+	"ryfwns"
+	"rygkmfigez"
+	"ryheehkty"
+	"ryigews"
+	"ryihhakzxrfox"
+	"ryilicoz"
+	"ryizfntjl"
+	"ryjalyvtenurbw"
+	"ryjkp"
+	"ryjxdidtgq"
+	"ryninxhqrj"
+	"rynpibwh"
+	"rypvmovcxbbc"
+	"rypxcwnyxkh"
+	"ryrl"
+	"ryssnm"
+	"rywawo"
+	"rywzff"
+	"ryxccjyh"
+	"rz"
+	"rzb"
+	"rzbeyq"
+	"rzcbcfgeode"
+	"rzddxw"
+	"rzdi"
+	"rzemhhi"
+	"rzfavffmsve"
+	"rzhbo"
+	"rzijbqqtgyuna"
+	"rzkkxm"
+	"rzksprkavlndst"
+	"rzlucqnbjeqxh"
+	"rzmcv"
+	"rznofgpzneneqy"
+	"rznw"
+	"rzogyawimg"
+	"rzoqvdra"
+	"rzpwiagfol"
+	"rzqzlkhghhhogg"
+	"rzrnibqz"
+	"rzrohsucajbzu"
+	"rztbs"
+	"rztfhkuyu"
+	"rztrsgqcra"
+	"rztuswu"
+	"rzudheukf"
+	"rzupgpyll"
+	"rzvneb"
+	"rzwbmf"
+	"rzxaqjg"
+	"sa"
+	"saacsug"
+	"sabszel"
+	"sabwxinuc"
+	"sad"
+	"saeaedklxjmfzy"
+	"safboxitw"
+	"safjjxfcei"
+	"safr"
+	"sagvsozz"
+	"sah"
+	"sahwakg"
+	"salal"
+	"sanroyaztqm"
+	"saoacmdijys"
+	"saorspgx"
+	"sapd"
+	"saqqifealm"
+	"sarftjdtuitsg"
+	"sasfkcl"
+	"satflwznqtkmdb"
+	"satqrq"
+	"satyhd"
+	"satzyjmk"
+	"sau"
+	"saugkyziakhguj"
+	"saumsfogvtaxna"
+	"savmewpq"
+	"sawhhxinipncba"
+	"sawz"
+	"saxifwbbpmcg"
+	"saxyg"
+	"sayxg"
+	"sb"
+	"sba"
+	"sbalutdt"
+	"sbavixy"
+	"sbawilczts"
+	"sbcexx"
+	"sbcivudiov"
+	"sbeiekduixw"
+	"sbeusxbrukjz"
+	"sbfwjrhs"
+	"sbhsayzbvrp"
+	"sbiqzpyzvh"
+	"sbktpbwzuahib"
+	"sblanyxgtj"
+	"sbllzxmsyqzbg"
+	"sblmszlr"
+	"sbmkdtqth"
+	"sbmqegw"
+	"sbn"
+	"sbogoqjnvymj"
+	"sbrjaw"
+	"sbrkqymioisicd"
+	"sbtc"
+	"sbttzbubdxcqf"
+	"sbvmcm"
+	"sbwsatf"
+	"sby"
+	"sbyqguxtsvbc"
+	"sbzewojsepw"
+	"sbzofctev"
+	"sc"
+	"sca"
+	"scaxvom"
+	"scb"
+	"scbpcyalce"
+	"sce"
+	"scetluzomnrbfe"
+	"scfmzcpv"
+	"schd"
+	"schhdhcxjql"
+	"schrhw"
+	"schzpa"
+	"scjdto"
+	"sclrdwzevlabxg"
+	"scltmgt"
+	"scmfeqd"
+	"scmwezjk"
+	"scnp"
+	"sco"
+	"scohrzpce"
+	"scpye"
+	"scqdtjlfihfygf"
+	"scqzpmxon"
+	"scrzbvdz"
+	"scsjbxxmnw"
+	"scuaspktojvzoy"
+	"scup"
+	"scvgelekbndr"
+	"scvjjwufyvuj"
+	"scvspudppr"
+	"scwdpdysestulu"
+	"scyotaz"
+	"scznilwiyd"
+	"sczyxymyxsb"
+	"sd"
+	"sdatowztczbgu"
+	"sdbataa"
+	"sdbbqxcpb"
+	"sdctsfsu"
+	"sddfvymunwrdf"
+	"sddtn"
+	"sde"
+	"sdgikkszhdzb"
+	"sdhsq"
+	"sdirdhx"
+	"sdjup"
+	"sdo"
+	"sdodpstcux"
+	"sdqholzzyhoxwo"
+	"sdqqwtgh"
+	"sdrgbrcoc"
+	"sdsknqsihvug"
+	"sdsynwqm"
+	"sdtjezrkvxd"
+	"sdupfqujyitt"
+	"sdvboy"
+	"sdwggblfbgplyb"
+	"sdwxyltev"
+	"sdxlxwswle"
+	"sdydul"
+	"sdzlmltlqxfti"
+	"sdzzwwe"
+	"se"
+	"sea"
+	"sebcbfpknxbodx"
+	"secihzweaamzjh"
+	"secjaaqwke"
+	"sedfy"
+	"seepfu"
+	"sehkcypjdmnh"
+	"sehunrwt"
+	"seiud"
+	"sejj"
+	"sejsicvjb"
+	"sejtnaaj"
+	"sejuetffgpnjtt"
+	"seks"
+	"sekz"
+	"semkesn"
+	"semtq"
+	"semvfylkeerwpu"
+	"semw"
+	"sennshjnamktv"
+	"senuimxntljtp"
+	"seofi"
+	"sepnkiyphezx"
+	"sepsjefduta"
+	"setbmygb"
+	"setck"
+	"seuyo"
+	"sevppnywir"
+	"sevwasangz"
+	"seycclsuzqlpoz"
+	"seyeothh"
+	"seyrptdr"
+	"sf"
+	"sfatfbolvkff"
+	"sfaxokr"
+	"sfazuk"
+	"sfbii"
+	"sfbux"
+	"sfbybltofvxo"
+	"sfcqvqiyoj"
+	"sfd"
+	"sfdetkbevtcp"
+	"sfe"
+	"sfebgcff"
+	"sfewyoffk"
+	"sfeyxud"
+	"sfg"
+	"sfgqtrmkfe"
+	"sfhhqufmdu"
+	"sfix"
+	"sfizgnovom"
+	"sflkwhzh"
+	"sflntwruqblrnr"
+	"sfmrchqjb"
+	"sfngdcekewr"
+	"sfnpkjsqeli"
+	"sfnrkoztcvk"
+	"sfpm"
+	"sfswffnvw"
+	"sfvpko"
+	"sfwekgep"
+	"sfzekzr"
+	"sg"
+	"sgai"
+	"sgayrachxdlm"
+	"sgcgbhlismcxi"
+	"sgefgu"
+	"sgeskembq"
+	"sgiko"
+	"sgil"
+	"sgip"
+	"sgjtvvio"
+	"sgk"
+	"sglzqbazy"
+	"sgmibghb"
+	"sgnf"
+	"sgnlvwouw"
+	"sgnvkfiaktk"
+	"sgojzcpgxkuvf"
+	"sgokldqew"
+	"sgqfsk"
+	"sgralrklsif"
+	"sgrkyczyugdns"
+	"sgsbdulhn"
+	"sgseouw"
+	"sgtpdird"
+	"sgvbqxnqljyar"
+	"sgvclnlxpmqgi"
+	"sgvonmjt"
+	"sgvovsmw"
+	"sgxbwbeph"
+	"sgxmqaij"
+	"sh"
+	"shablsoiyilt"
+	"shadahf"
+	"shbcdbba"
+	"shbkzizciy"
+	"shcaknye"
+	"shclsgpalqt"
+	"shegqsmi"
+	"sheknouoodv"
+	"shfqngc"
+	"shgdqkv"
+	"shhecu"
+	"shhnwioendsdo"
+	"shhyubkpt"
+	"shkhfymqcufo"
+	"shkwi"
+	"shkxjdizje"
+	"shnqflj"
+	"shqhcjsromdlg"
+	"shrrpnuguljib"
+	"shun"
+	"shupcmlvleym"
+	"shvcaklh"
+	"shxgqqmdwgmv"
+	"shxuzuuukn"
+	"shy"
+	"shybp"
+	"shydbmpi"
+	"shyojzreb"
+	"shzjjveaw"
+	"shzkvvlzxtfsr"
+	"shzquhjukxge"
+	"shzsfuh"
+	"si"
+	"siafsvi"
+	"siallojxehmd"
+	"sicsxmowhdg"
+	"siee"
+	"sifiie"
+	"sigzlnr"
+	"sihdynxl"
+	"sikgcoub"
+	"siknigxzcmlsfx"
+	"sikwayb"
+	"silbvuejoey"
+	"sily"
+	"sin"
+	"sipafpdhedmbfc"
+	"sipmrxy"
+	"siqfc"
+	"siqj"
+	"sishaptuprl"
+	"sivpzvgf"
+	"sj"
+	"sjbowqgg"
+	"sjefykkqhjlvgy"
+	"sjeroqwexhbjp"
+	"sjltrt"
+	"sjmadbk"
+	"sjnuy"
+	"sjo"
+	"sjpjifjizk"
+	"sjpnmmulugta"
+	"sjqalkcqbvsfmp"
+	"sjqyuphxgnmlb"
+	"sjtivfkel"
+	"sjtrhmmynrs"
+	"sjvkpcixldnj"
+	"sjvnxdleqlt"
+	"sjvoeqlobhrpy"
+	"sjwp"
+	"sjwqqi"
+	"sjxujrcegd"
+	"sjzjpqkqutndb"
+	"ska"
+	"skebeyw"
+	"skes"
+	"skf"
+	"skfd"
+	"skfpocemy"
+	"skfu"
+	"skfyxxmt"
+	"skhsvtxqb"
+	"skhyhvuvf"
+	"skjqzltupmjja"
+	"skjrujoeyu"
+	"skjuvk"
+	"skkpxump"
+	"sklhvbkyuzj"
+	"skmm"
+	"skmmg"
+	"sknqttu"
+	"skphogix"
+	"skpq"
+	"skr"
+	"skvyxzepl"
+	"skz"
+	"skzeomtfrzxlu"
+	"skzhmnp"
+	"skzjyavdswzu"
+	"sl"
+	"slc"
+	"slcjgrladwabq"
+	"slcwkwvyv"
+	"sletxtaytowzw"
+	"slfvrp"
+	"slfznunjiht"
+	"slgclhpvpdsran"
+	"slgwuzizxfnl"
+	"sljpbbjanugjc"
+	"slllvcnckfcjj"
+	"slmbakdvbufli"
+	"slmhlz"
+	"slmzvuoi"
+	"slnwlgyigvos"
+	"slodfg"
+	"slosskaxg"
+	"slovpdc"
+	"slpbpn"
+	"slpxlnylcsi"
+	"slrc"
+	"slrditzj"
+	"slrmacdoi"
+	"slryxsby"
+	"sls"
+	"slsnv"
+	"slu"
+	"slvyxtswg"
+	"slwiqiv"
+	"slwqxkbobs"
+	"slym"
+	"slzbneboyqyw"
+	"sm"
+	"smamxoztktjkd"
+	"smcgpnjv"
+	"smcr"
+	"smcy"
+	"smdj"
+	"smdvmbaehq"
+	"smeix"
+	"smetgqaqb"
+	"smftchpa"
+	"smjkii"
+	"smjtbn"
+	"smkaztshxskuzq"
+	"smknecqligx"
+	"smlih"
+	"smmfrewzxs"
+	"smncsxaj"
+	"smneitnnelkk"
+	"smnmxkto"
+	"smoryc"
+	"smqhmkqew"
+	"smqxrgrdbt"
+	"smrpezlsv"
+	"smsfstdcb"
+	"smsza"
+	"smufsdjd"
+	"smvjfzrmxrjr"
+	"smvmdpgiolfm"
+	"smvprthibufvvr"
+	"smwcmfvkx"
+	"smwznldtnlae"
+	"smxbbehmgiy"
+	"smxoempbv"
+	"smxtk"
+	"smzzfrlfbocfv"
+	"sn"
+	"snbh"
+	"snfevc"
+	"snghu"
+	"snic"
+	"snjgud"
+	"snkedjjiha"
+	"snlgllkde"
+	"snlswukqeyyu"
+	"snmic"
+	"snnossqgtwfv"
+	"snotsakvilk"
+	"snozg"
+	"snt"
+	"snthvrafw"
+	"sntowsottu"
+	"snvz"
+	"snwk"
+	"snwrbjpf"
+	"snwurqumcrgg"
+	"snxjfiiitfezf"
+	"sny"
+	"snyidqbkdqtzou"
+	"soaeei"
+	"sob"
+	"sodc"
+	"sodkfr"
+	"sodusfqh"
+	"soeekmoitosz"
+	"sofct"
+	"sofeacsffx"
+	"sogiqiyqog"
+	"sohbwrsywjpo"
+	"sohdy"
+	"sojfehzwb"
+	"sokqqyncd"
+	"soktxrxtwmmlha"
+	"soljnc"
+	"solm"
+	"solph"
+	"sopdz"
+	"sopgqyyckofwr"
+	"sophkghxlq"
+	"sopmlvkkqd"
+	"soqcckhxgbw"
+	"sotcqyhyvmahc"
+	"sotpbpiyfgg"
+	"sotyelqgxnjyf"
+	"soubfnmzvjq"
+	"soufh"
+	"soulyx"
+	"souv"
+	"souw"
+	"sovmnoop"
+	"soxgt"
+	"soxnvdfbcsr"
+	"soxrkwiyytlqop"
+	"soxsbpjg"
+	"soyikddlnx"
+	"soyvqo"
+	"sozlctmbn"
+	"sozuwdwm"
+	"sp"
+	"spablbew"
+	"spbp"
+	"spcseumbhf"
+	"spdtiqpyg"
+	"spdyelxxzovhx"
+	"spgcjlhgd"
+	"spi"
+	"spiirqovszun"
+	"spkcbmywr"
+	"spkuonmatxw"
+	"splvtyj"
+	"spmgzuolqshi"
+	"spnhdsnfkqk"
+	"spokvpzo"
+	"spoykg"
+	"spq"
+	"spqfldnex"
+	"sprwztjirfbk"
+	"sptgsqvckzu"
+	"sptndbkreso"
+	"sptnwpa"
+	"spusf"
+	"spuy"
+	"spv"
+	"spvprnwowgyf"
+	"spvxhegbqkzhmo"
+	"spwkoql"
+	"spwruidqxjaj"
+	"spwya"
+	"spxjsztixvbymr"
+	"spyodvwzprkbgo"
+	"spyv"
+	"sq"
+	"sqbmynsqmsq"
+	"sqdlddo"
+	"sqdytdmklcyuef"
+	"sqe"
+	"sqeno"
+	"sqftlvrbznojfa"
+	"sqgcqrxon"
+	"sqgcvgtuiamp"
+	"sqhc"
+	"sqirgetucfebxb"
+	"sqjakeevev"
+	"sqjakt"
+	"sqkckmmrwqp"
+	"sqkcy"
+	"sqlprxwzu"
+	"sqlvli"
+	"sqm"
+	"sqmbogolzu"
+	"sqmceiafdyhmwp"
+	"sqn"
+	"sqoqhsufwd"
+	"sqphrkq"
+	"sqqugei"
+	"sqqxbdhrh"
+	"sqrgbssqkjcr"
+	"sqtiuk"
+	"squdt"
+	"squmtd"
+	"squrvp"
+	"sqvdvo"
+	"sqweb"
+	"sqxjty"
+	"sqxn"
+	"sqxuodpavtzq"
+	"sqyirxwwvgcqi"
+	"sr"
+	"srbgo"
+	"srbvs"
+	"srdu"
+	"srdxkehc"
+	"srdzzhzby"
+	"sregmmj"
+	"srfaxr"
+	"srhdpdoqrfd"
+	"srktdxoxfq"
+	"srmnz"
+	"srnfnamlvkg"
+	"sro"
+	"srp"
+	"srpawnzzllsaym"
+	"srpcd"
+	"srpqu"
+	"srqhfqbmi"
+	"srqwopowlud"
+	"srreicgvywkyal"
+	"srsbruazgt"
+	"srsvolfpoljva"
+	"sryd"
+	"ss"
+	"ssajprdi"
+	"ssajrp"
+	"ssbmohjqzxvw"
+	"ssd"
+	"ssdxyedoh"
+	"sseiadfc"
+	"ssfkqv"
+	"sshasjm"
+	"ssirpwk"
+	"ssjbypov"
+	"ssjkbvdwttitji"
+	"sskhzqazpax"
+	"ssmuffqhayg"
+	"sso"
+	"ssqwmeylaoz"
+	"sssfojbetx"
+	"sstmjtnpktnzq"
+	"ssuncuwzzeh"
+	"ssvsspylls"
+	"ssvyitty"
+	"sswkxyxqbvkyr"
+	"sswuek"
+	"ssxdhemjipxktn"
+	"ssxjx"
+	"ssyaclqkxtbje"
+	"ssyvnj"
+	"st"
+	"stahaefothg"
+	"stao"
+	"stb"
+	"stcrqmgrsrw"
+	"ste"
+	"sterdk"
+	"stfm"
+	"stgbbekhkjgsp"
+	"sth"
+	"stheq"
+	"sthkwxaczyztan"
+	"stiaqd"
+	"stk"
+	"stkokghzexl"
+	"stlbnpkjfgplg"
+	"stnklezy"
+	"stnpivlbttjd"
+	"stouc"
+	"stpaj"
+	"stprfgvwg"
+	"stpwuxyqb"
+	"strh"
+	"stthcroyiq"
+	"stvhnjgvfxmb"
+	"stw"
+	"stwvtpfmcsgy"
+	"stwxujtlkt"
+	"stxdodtwjb"
+	"stxqakxjxoui"
+	"su"
+	"suark"
+	"suarwxjvufz"
+	"subdl"
+	"sudkydfejwv"
+	"suevxuydmolva"
+	"suewdupgad"
+	"suf"
+	"sufm"
+	"sugi"
+	"suiefakcxpuutp"
+	"sujzmzalqgksy"
+	"sukcdxymfrszf"
+	"suljulvxkfju"
+	"sultgp"
+	"sumxrpnfduxvb"
+	"sunno"
+	"suoghycuj"
+	"suqmzarmqtr"
+	"sursyq"
+	"surusfljlr"
+	"susmawhqmdrin"
+	"suspjvidruiffq"
+	"suurndbwpqiao"
+	"suvunjqhqnnpz"
+	"suwiiebfeqnxbr"
+	"sux"
+	"suynksaoaocons"
+	"suzzfzpi"
+	"svdlkqpiv"
+	"svdyeoujwabj"
+	"svfkqcuzybazsj"
+	"svgzki"
+	"svh"
+	"svhk"
+	"svhtwnwdplkf"
+	"svjtkzscpknci"
+	"svmfauksso"
+	"svmovh"
+	"svnt"
+	"svp"
+	"svrirblxkbm"
+	"svrtitvenzz"
+	"svu"
+	"svutyqiqkasyzg"
+	"svvltmrqz"
+	"svvyhzxa"
+	"svxammhiapo"
+	"svxjryehfhm"
+	"svyjgt"
+	"svytpjxegmd"
+	"sw"
+	"swaz"
+	"swbhvqfujrpgo"
+	"swbqgttb"
+	"swetu"
+	"swfne"
+	"swgmoepwhbxuh"
+	"swgqktkb"
+	"swgucbsgjewkc"
+	"swhpsr"
+	"swif"
+	"swil"
+	"swjkfaae"
+	"swlaqyaphxowst"
+	"swlr"
+	"swoefghykxbnlw"
+	"sworebqkqweuy"
+	"swosns"
+	"swtcxabgaw"
+	"swtqco"
+	"swvu"
+	"swwtsrmmeg"
+	"swwwyd"
+	"swxtar"
+	"swzesjbucyjcn"
+	"sx"
+	"sxabazv"
+	"sxbhxprb"
+	"sxcb"
+	"sxcduazkbyc"
+	"sxcijy"
+	"sxdkqjp"
+	"sxeukkof"
+	"sxfhvaqqoabo"
+	"sxfqsrbq"
+	"sxghyex"
+	"sxgooexobfpymm"
+	"sxgv"
+	"sxhbsxjgo"
+	"sxhkhurnvo"
+	"sxiz"
+	"sxjnjicng"
+	"sxkole"
+	"sxmelftyhqu"
+	"sxnfjyyilmmwd"
+	"sxnkwerixkp"
+	"sxoqnhrzix"
+	"sxrxjztofuzax"
+	"sxs"
+	"sxshrg"
+	"sxsiwfgtphokgd"
+	"sxtwfc"
+	"sxvlwpnqiptj"
+	"sxxk"
+	"sxxm"
+	"sxynkejksw"
+	"sxysl"
+	"sxywyzkwx"
+	"sxzmzfbinzc"
+	"sxzwgbflxadts"
+	"sy"
+	"sydragglm"
+	"syegm"
+	"syetzyobskoh"
+	"syfwqtvmu"
+	"sygdicyuujf"
+	"syhcl"
+	"syiyjwwr"
+	"syiyoqmclk"
+	"syjwpdm"
+	"sylrsfx"
+	"symhfsbo"
+	"symn"
+	"symtzurlmuzyt"
+	"synswih"
+	"sypalrmocar"
+	"syqgyukgqdq"
+	"syriufhjjhkxik"
+	"sytvifxqgcf"
+	"syveslguilskl"
+	"syvf"
+	"syvprd"
+	"sywfmltrzy"
+	"sywzebv"
+	"syybfdg"
+	"sz"
+	"szardwmqhdhx"
+	"szdwzsiuqigjx"
+	"sze"
+	"szf"
+	"szhuwkunaqidg"
+	"szke"
+	"szkfwnwub"
+	"szkujoz"
+	"szkw"
+	"sznwdrbqfwu"
+	"szoesokpw"
+	"szokpwmrgf"
+	"sztukmm"
+	"szuefwdeoafamc"
+	"szunkqtfeerms"
+	"szuv"
+	"szviya"
+	"szx"
+	"szyc"
+	"szzgx"
+	"ta"
+	"tadsnn"
+	"tae"
+	"tagasfc"
+	"taglprtt"
+	"tahnxh"
+	"taiixxub"
+	"takkqhw"
+	"taksbhuu"
+	"takvzp"
+	"taly"
+	"tanzg"
+	"taomm"
+	"tapdg"
+	"tapxs"
+	"taqdarukxbnt"
+	"tasozabaezjsgh"
+	"tatifitugobdaw"
+	"tatteocpsx"
+	"tauhfoufbtbag"
+	"tavgp"
+	"tawt"
+	"tawwctvhaotdb"
+	"taxswezt"
+	"tayapfnrwyx"
+	"tayhjvk"
+	"tayuwpimqa"
+	"tazhufrsf"
+	"tazlhaxvhhm"
+	"tazvcdvfq"
+	"tb"
+	"tbbqsdlbu"
+	"tbcacio"
+	"tbcfkjjedqf"
+	"tbcjafvdltypmc"
+	"tbckecoiiqzix"
+	"tbdmsmvzm"
+	"tbe"
+	"tbffhrl"
+	"tbgnddlpjnf"
+	"tbgr"
+	"tbihbnkpnqik"
+	"tblnvw"
+	"tblqrayyhckcc"
+	"tblrpmqksqj"
+	"tblsoeuah"
+	"tbnrnhkx"
+	"tbobl"
+	"tbpgvtlorpgis"
+	"tbpstduzymcgj"
+	"tbrqnirwxrjba"
+	"tbrwdpxxjrfaa"
+	"tbshieirbldkd"
+	"tbuioso"
+	"tbuokoz"
+	"tbvhddhupat"
+	"tbvmifoiz"
+	"tbvpd"
+	"tbxgbmkiqkgn"
+	"tbydfeqsoysbro"
+	"tbykzxnll"
+	"tbzetxdvsila"
+	"tcaa"
+	"tcajhdvco"
+	"tcdhkxf"
+	"tcdy"
+	"tcee"
+	"tcfxqritz"
+	"tcgqrophczfbyl"
+	"tcgyawmcl"
+	"tchdwphtxbzzi"
+	"tchhazhmcircxc"
+	"tchwy"
+	"tcib"
+	"tciijdvz"
+	"tcjanboamgrtpz"
+	"tcjbc"
+	"tcjnchjdvpl"
+	"tcjxeansexmjh"
+	"tclpt"
+	"tcmqnjvoet"
+	"tcncwreiyci"
+	"tcnjxyaliygfe"
+	"tcoh"
+	"tcp"
+	"tcs"
+	"tctq"
+	"tcu"
+	"tcwirhwm"
+	"tczf"
+	"tdbbhbggz"
+	"tddcukdvsrul"
+	"tddedmkooclgbp"
+	"tdehr"
+	"tdfvtuzl"
+	"tdho"
+	"tdijmryodbnrvg"
+	"tdiw"
+	"tdiwaswnw"
+	"tdje"
+	"tdjimtkdcsu"
+	"tdl"
+	"tdlid"
+	"tdmn"
+	"tdnem"
+	"tdolicadswowzv"
+	"tdot"
+	"tdpdbjwjbnaqh"
+	"tdpeazh"
+	"tdpil"
+	"tdqjpaqrherzlt"
+	"tdqpqcbcfawt"
+	"tdqwwzmblfmfw"
+	"tdtyimlzsil"
+	"tdushqqlrcu"
+	"tdvaro"
+	"tdvjekoquiulem"
+	"tdwxdibwglzut"
+	"tdwxreh"
+	"tdydatilj"
+	"tdzp"
+	"tdzqpab"
+	"te"
+	"teabmcyjzmrjw"
+	"tebotxrh"
+	"tebpopjfkud"
+	"tebwn"
+	"tecluq"
+	"tedhumsyhj"
+	"teg"
+	"tehkmchkwr"
+	"teicsmfh"
+	"tekqnga"
+	"temggrboo"
+	"temitkxhzzipe"
+	"temkqcbep"
+	"temnyrcnt"
+	"temvfxkcz"
+	"tenc"
+	"tepadj"
+	"tepscnfsadkn"
+	"tepzjzxcxiwj"
+	"teqarqbttlnt"
+	"teqefqvxrtlggu"
+	"teqzvxbperme"
+	"terddag"
+	"terrhnwiwqlp"
+	"tesiaqoor"
+	"tetrxck"
+	"tewbse"
+	"tewgwvzbdurtrl"
+	"tewwy"
+	"text"
+	"teybvu"
+	"teyiawpv"
+	"teypwrinkw"
+	"tf"
+	"tfaxsvv"
+	"tfeva"
+	"tffsr"
+	"tfh"
+	"tfhi"
+	"tfhrx"
+	"tfhuwzhtmdveh"
+	"tfhxexkfmk"
+	"tfinmni"
+	"tfinxpjlwo"
+	"tfmaimhjr"
+	"tfnplwmbl"
+	"tfnwjmmhfnfrr"
+	"tfqnrbhofukibv"
+	"tfqrtjkkf"
+	"tfromrykz"
+	"tfsouus"
+	"tfstqvs"
+	"tftmpnebq"
+	"tftsyl"
+	"tfuqgdhquydw"
+	"tfvlkkgzmzkzz"
+	"tfwh"
+	"tfwnhs"
+	"tfxzjincrtwp"
+	"tfyc"
+	"tfyn"
+	"tfzor"
+	"tg"
+	"tga"
+	"tgahcks"
+	"tgaluglqkdr"
+	"tgasnjbfmyo"
+	"tgbdgvtt"
+	"tgd"
+	"tgdbdervllm"
+	"tgdde"
+	"tgdrzuqhgkw"
+	"tgdvsxzox"
+	"tgeeqjsh"
+	"tgggymodcdi"
+	"tggmrdqpxv"
+	"tggmtcsahucn"
+	"tggywlcsqw"
+	"tghgdnp"
+	"tghz"
+	"tgilyuxs"
+	"tgliwwjwqxd"
+	"tgmcgbmwi"
+	"tgmqghr"
+	"tgnayo"
+	"tgnligrg"
+	"tgpccqyxfh"
+	"tgpgxqbfodz"
+	"tgqo"
+	"tgr"
+	"tgsnjhnwfsvn"
+	"tgsucfozdrf"
+	"tgtw"
+	"tgwogqsoaiye"
+	"tgwubqqff"
+	"tgxdjmfqaypz"
+	"tgxfiklgeupd"
+	"tgyipsrbxrl"
+	"thapeasxraym"
+	"that"
+	"thbxdluwes"
+	"thdbo"
+	"thdiwxqxhue"
+	"thdmxrqls"
+	"thdpbu"
+	"thdwrpva"
+	"thgef"
+	"thhcx"
+	"thhmhsd"
+	"thixxnvfmof"
+	"thjd"
+	"thjk"
+	"thjx"
+	"thjyqkfpuraabl"
+	"thjzftm"
+	"thktdrtvlznm"
+	"thljarmjdyszkx"
+	"thpf"
+	"thqc"
+	"thqqssrdlqf"
+	"thridzo"
+	"thrjp"
+	"thsl"
+	"thsmzmfrriqeg"
+	"thsotvhfv"
+	"thuwqcd"
+	"thv"
+	"thxmhihqde"
+	"ti"
+	"tic"
+	"tidafj"
+	"tidquq"
+	"tidsxprcor"
+	"tie"
+	"tiepyjyvyhcj"
+	"tifipgem"
+	"tih"
+	"tihwu"
+	"tihzbjlol"
+	"tihzvai"
+	"tiiwxhil"
+	"tijufycqljare"
+	"tikii"
+	"tilw"
+	"tinp"
+	"tinqtylt"
+	"tiomfuyunww"
+	"tip"
+	"tiqnwysxcnltdw"
+	"tirzgnesn"
+	"tiubdmdbpt"
+	"tivcnoinpsz"
+	"tiwfrpgpl"
+	"tixfbasggfx"
+	"tiyo"
+	"tizjzmfsi"
+	"tiznals"
+	"tj"
+	"tjat"
+	"tjbfat"
+	"tjdkhmxahz"
+	"tjdpob"
+	"tjegerxbyk"
+	"tjfciwfnaytgsu"
+	"tjhxy"
+	"tjiiyllejlafsc"
+	"tjjkeq"
+	"tjkeevikaboxeb"
+	"tjkrbsdln"
+	"tjpb"
+	"tjpnnzcf"
+	"tjpyq"
+	"tjpzadlsinnkn"
+	"tjqzfylmsmjgz"
+	"tjs"
+	"tjtxairvggoo"
+	"tjuex"
+	"tjvenms"
+	"tjwjblrfplix"
+	"tjwzzjrco"
+	"tjxflokka"
+	"tjxokwgmfdqbe"
+	"tjywwll"
+	"tk"
+	"tkcubshajcpm"
+	"tkev"
+	"tkez"
+	"tkhvbwgzleb"
+	"tkjmj"
+	"tkjmyfqaid"
+	"tkjzjs"
+	"tkk"
+	"tkkydhtoravn"
+	"tklcspoxnkzwb"
+	"tklotdyipoyxf"
+	"tklw"
+	"tkmxro"
+	"tkohazvedobql"
+	"tkpmg"
+	"tkrjvpy"
+	"tksqctkxhhc"
+	"tkstkncbjfhkaj"
+	"tkvaahmanoov"
+	"tkwngpvu"
+	"tkxch"
+	"tkyutstbghl"
+	"tkzrx"
+	"tl"
+	"tlafcsianwto"
+	"tlask"
+	"tlbuu"
+	"tlchsqdxh"
+	"tlcnjtxojis"
+	"tldesiuxkfjscj"
+	"tlegzgrk"
+	"tlfldjgviunaqc"
+	"tlhdesvaqlcdok"
+	"tlhegnjw"
+	"tlhtgpieuxsx"
+	"tliofhgey"
+	"tljxnzpx"
+	"tllbcbo"
+	"tlln"
+	"tlmo"
+	"tln"
+	"tlogknpznmjle"
+	"tlolvob"
+	"tlqoidvsmou"
+	"tlqrcqbvlsiga"
+	"tlr"
+	"tlsfaonvvnegal"
+	"tlshc"
+	"tlsoqafxk"
+	"tltmy"
+	"tlvtscfnmedul"
+	"tlvy"
+	"tlwgj"
+	"tlwllq"
+	"tlwvjegjms"
+	"tlza"
+	"tlzlhgigfkivxk"
+	"tm"
+	"tmaoqitkdrd"
+	"tmapfvpmys"
+	"tmbgdnf"
+	"tmbhpmuzrj"
+	"tmcwqmaezhw"
+	"tmeesnkot"
+	"tmegqyn"
+	"tmgvc"
+	"tmgvte"
+	"tmhkd"
+	"tmhmcece"
+	"tmhmcnloovrntd"
+	"tmibbp"
+	"tmii"
+	"tmjycfphkl"
+	"tmkdu"
+	"tmkkloqjb"
+	"tmkpmlz"
+	"tmlbzpqidrhwea"
+	"tmlcczlb"
+	"tmlecr"
+	"tmlhczevglyky"
+	"tmmswcajaakqrj"
+	"tmppxvq"
+	"tmptmpve"
+	"tmpzmdnpjhxu"
+	"tmqecpp"
+	"tmqmzietjhq"
+	"tmrkesjalap"
+	"tmrnbr"
+	"tmrwyw"
+	"tmrxweiqa"
+	"tmtb"
+	"tmux"
+	"tmvtrnybtlsiyu"
+	"tmwgzrsy"
+	"tmwvgoxurjn"
+	"tmxygzf"
+	"tmyfarx"
+	"tmzxrwbebmx"
+	"tn"
+	"tna"
+	"tnagttevsgqwkr"
+	"tnbuh"
+	"tncgkh"
+	"tncqbhoj"
+	"tndicsvvgus"
+	"tnegvuqbdl"
+	"tnfh"
+	"tngcnilorwts"
+	"tnizkhbdhasck"
+	"tnkbrjdquwlnwb"
+	"tnlgswamc"
+	"tnlveoaynwxf"
+	"tnmim"
+	"tnorc"
+	"tnosmvqgsp"
+	"tnqbhragjooot"
+	"tnsi"
+	"tnsmfoij"
+	"tntquagz"
+	"tnudgtip"
+	"tnuxq"
+	"tnwuoszdehjufr"
+	"tnyasukpjaakv"
+	"to"
+	"toaxavxss"
+	"tocvdd"
+	"tod"
+	"todzgbmg"
+	"toenovqgwyhy"
+	"tofpuqvfkhm"
+	"toghwpogaq"
+	"tohmvsase"
+	"tojh"
+	"tolmunphl"
+	"tolnyeaoos"
+	"tolqiwcvoyeais"
+	"tom"
+	"tomotuandqcn"
+	"tonppclis"
+	"tonwtkwdh"
+	"tonxtrruaog"
+	"toobceivlgnsct"
+	"toogc"
+	"toomorfcjfana"
+	"toouziwhicwyx"
+	"topfyhbsbespx"
+	"toqarpwy"
+	"toqqssczktu"
+	"toqtyqlxcjnplc"
+	"torauav"
+	"torj"
+	"torphjiuw"
+	"tosdbfqabnzine"
+	"tould"
+	"tovdzwstdmez"
+	"tovnoskzr"
+	"tovtycbryxjlw"
+	"toxjpevlosmbm"
+	"tozhschhmaax"
+	"tozuroictfft"
+	"tp"
+	"tpbh"
+	"tpbmq"
+	"tpcpaayrth"
+	"tpcxyhvuui"
+	"tpe"
+	"tphppceai"
+	"tphwltvxczajl"
+	"tphyoffeeb"
+	"tpjtsuf"
+	"tpkggsanq"
+	"tplf"
+	"tplnxpgbtvd"
+	"tplxcmlasjrutf"
+	"tppx"
+	"tpthlvhnkbyyz"
+	"tptjnwtjwxas"
+	"tpuxntevkc"
+	"tpvubnff"
+	"tpwbst"
+	"tpxhbvtwjx"
+	"tpxhhkxkyeucm"
+	"tpxvwymrtvzmqw"
+	"tpzgxxqxzmtip"
+	"tpzhadytr"
+	"tpzpeaayqtektm"
+	"tpzuuuyrw"
+	"tq"
+	"tqacecgfk"
+	"tqahkifx"
+	"tqazzyw"
+	"tqbhvhsj"
+	"tqedbuexgbfn"
+	"tqelvikes"
+	"tqepkxwmdcj"
+	"tqfucd"
+	"tqilrz"
+	"tqiqlxn"
+	"tqjlubtq"
+	"tqjszgjvev"
+	"tqkgt"
+	"tqkxgkio"
+	"tqljxcxlevqb"
+	"tqnfizac"
+	"tqoiqzkxestofd"
+	"tqowfbmqpnsx"
+	"tqpl"
+	"tqqwanhptlxb"
+	"tqqwlhjutn"
+	"tqrurovhy"
+	"tqs"
+	"tqsnizmrwhj"
+	"tqtyhjmwrd"
+	"tqvxeohvvedjtj"
+	"tqxptk"
+	"tqyhtpw"
+	"tqymcvnwlea"
+	"tqytivbtmvrr"
+	"tqzteao"
+	"tr"
+	"trbchvxwchd"
+	"trbcs"
+	"trbyaoptz"
+	"trcewpviwweu"
+	"trcphnrbtlobfm"
+	"trcq"
+	"trcuclqombtq"
+	"trdmvbsszinup"
+	"trffonncajse"
+	"trfmppqinaj"
+	"trg"
+	"trgjshdrbkjrfx"
+	"triy"
+	"trlz"
+	"trm"
+	"trnpdz"
+	"trq"
+	"trqcfwpj"
+	"trsiuyqmxy"
+	"trvep"
+	"trvofpsx"
+	"trvqlyvgjbewjv"
+	"trxcmedhywhxvn"
+	"tryzntwl"
+	"ts"
+	"tsad"
+	"tsbstcrzhxg"
+	"tsbwcalqmm"
+	"tschv"
+	"tsei"
+	"tsevctfycxream"
+	"tsfbxpnj"
+	"tsffosmxre"
+	"tsfhmipwh"
+	"tsfkcsysyilxuw"
+	"tsgmuvlhocnyl"
+	"tsguro"
+	"tsmybrtz"
+	"tsnkaixw"
+	"tsnwstf"
+	"tsnxfncmolktfr"
+	"tsodtkamzj"
+	"tspkayx"
+	"tspvirirgkgo"
+	"tsryiwl"
+	"tssaygri"
+	"tstswfalxh"
+	"tsu"
+	"tsuejj"
+	"tsx"
+	"tsyypzgaumrwc"
+	"tt"
+	"ttcup"
+	"ttduygiwo"
+	"ttheoaww"
+	"tthohocygeujx"
+	"tthxtevdvv"
+	"ttinkunrfjuo"
+	"ttmdn"
+	"ttmq"
+	"ttmwtsmlkxdsl"
+	"ttnfhknbc"
+	"ttnnv"
+	"ttnroc"
+	"ttozbixbuczw"
+	"ttppspmpc"
+	"ttpq"
+	"ttpslook"
+	"ttpy"
+	"ttqkfrgbjs"
+	"ttqygknjbx"
+	"ttsdeifewcn"
+	"ttsukrxpmhkoyp"
+	"tttbicpxbkupo"
+	"tttowo"
+	"ttukgrby"
+	"ttvekurwaizu"
+	"ttvilm"
+	"ttvpzdsqszefs"
+	"ttvvdfqiqugl"
+	"ttvxajcidy"
+	"ttvzvmu"
+	"ttwer"
+	"tu"
+	"tubaml"
+	"tudiw"
+	"tudkvdjmhoywk"
+	"tuecrgezh"
+	"tufdspnp"
+	"tufvehppindm"
+	"tugjb"
+	"tugtmqtbbowlic"
+	"tugyekamdngjqj"
+	"tugyo"
+	"tuhegvukuas"
+	"tuheyikhvhow"
+	"tuhtkgcfxg"
+	"tuhvhlieynq"
+	"tukny"
+	"tulmbj"
+	"tuokgfh"
+	"tupkscgflwxcz"
+	"tuqnaini"
+	"turdfjuhc"
+	"turmlofwayit"
+	"tus"
+	"tuuolbgvieqyx"
+	"tuvsqc"
+	"tuwbb"
+	"tuxzbqfqpjua"
+	"tuynwmmu"
+	"tv"
+	"tvaltclmv"
+	"tvaubjhctn"
+	"tvbisfbmukbz"
+	"tvbjhvb"
+	"tvbx"
+	"tvcuhupfkw"
+	"tvfssp"
+	"tvghv"
+	"tvi"
+	"tviyngjwhu"
+	"tvltdbk"
+	"tvmb"
+	"tvn"
+	"tvnilnmt"
+	"tvpfjisonykx"
+	"tvqqdo"
+	"tvrxaijcrsj"
+	"tvtilzwts"
+	"tvtqnlsagloaye"
+	"tvubxecnyppj"
+	"tvxkfbj"
+	"tvxszh"
+	"tvyfybta"
+	"tvyglqno"
+	"twackpv"
+	"twbwhwasntyjc"
+	"twcda"
+	"twcich"
+	"twcpooci"
+	"twcsdkdnfr"
+	"twd"
+	"twfks"
+	"twfnhjf"
+	"twgc"
+	"twh"
+	"twhhfnfmv"
+	"twhvat"
+	"twiqvlkfbeoo"
+	"twjrupvfehr"
+	"twkhebktdwhqe"
+	"twkugwcw"
+	"twlf"
+	"twndjd"
+	"twolch"
+	"twpginwfmh"
+	"twputx"
+	"twqttz"
+	"twribcijigtb"
+	"twsdg"
+	"twswpvlvqrwp"
+	"twtkxl"
+	"twtv"
+	"twvc"
+	"twwf"
+	"twwubwrmxql"
+	"twxcuajf"
+	"twzbwt"
+	"twzguqwoz"
+	"tx"
+	"txaauqvokv"
+	"txajsfpgjgb"
+	"txamzxqzeq"
+	"txbik"
+	"txboqykqxc"
+	"txc"
+	"txcikemtib"
+	"txdfnonkkngoqv"
+	"txdkatmexvqydl"
+	"txdonjpcfq"
+	"txdzjtwjo"
+	"txf"
+	"txgpuzefzcm"
+	"txhwcs"
+	"txilwphwpc"
+	"txlhuaa"
+	"txlkmfvr"
+	"txlpxuhiiryw"
+	"txmgltv"
+	"txpbaqwpim"
+	"txpqekel"
+	"txtpt"
+	"txuvtpabc"
+	"txwrvjftf"
+	"txxkzhslr"
+	"txyvwopqf"
+	"txzccfcz"
+	"txzxovhdaqwf"
+	"ty"
+	"tyak"
+	"tydligq"
+	"tygipvsxu"
+	"tygvxtrjlbygj"
+	"tygzo"
+	"tyheksnydxtwed"
+	"tyjapdhgluf"
+	"tyjpbgvi"
+	"tympmf"
+	"tymvgknwsqle"
+	"tynfarmkdk"
+	"tynlktyhivcqz"
+	"tyopulpddlvt"
+	"typdaunvsdeh"
+	"tyrk"
+	"tyrqrhlg"
+	"tyrx"
+	"tyt"
+	"tytddhlluo"
+	"tytkinw"
+	"tytza"
+	"tyvcej"
+	"tyxl"
+	"tyxqvfwy"
+	"tyxrnaacybzdn"
+	"tyyyj"
+	"tz"
+	"tzadiymazaa"
+	"tzcpqofcoodfrn"
+	"tze"
+	"tzermhexw"
+	"tzeufvosj"
+	"tzfdlwfwntiur"
+	"tzfocey"
+	"tzhbf"
+	"tzhitoc"
+	"tziswwt"
+	"tzitpfjaoimsfo"
+	"tzjhiucfue"
+	"tzjinehmqg"
+	"tzjthc"
+	"tzkototbkclu"
+	"tzl"
+	"tzlrfx"
+	"tzpakoe"
+	"tzptyzlh"
+	"tzqehtdo"
+	"tzqmczh"
+	"tzshoxjqu"
+	"tzsmranfulxox"
+	"tzsuoar"
+	"tztopaznmidlyi"
+	"tzuxbnyucucnqo"
+	"tzyueujaky"
+	"ua"
+	"uaa"
+	"uabdnpgm"
+	"uabslekzfbmc"
+	"uachsqblhxg"
+	"uaejya"
+	"uaflxcvoiyph"
+	"uaglejpur"
+	"uagnlduxlqf"
+	"uahjxwoqutrw"
+	"uahnivgvlhwnhb"
+	"uaipioqtpbrjyd"
+	"uajmxmiyfvrdy"
+	"uakbfmb"
+	"ualcksgp"
+	"ualfkobwajl"
+	"uamvszkvun"
+	"uanxvs"
+	"uanynfn"
+	"uapuklcvc"
+	"uaqpesaerasdzu"
+	"uaqvlpv"
+	"uatxreuso"
+	"uav"
+	"uavqkq"
+	"uaxzyzuzrskbls"
+	"uayczhkex"
+	"uayudk"
+	"ub"
+	"ubaulomhjdanpq"
+	"ubcujxiban"
+	"ubdcvxeparhl"
+	"ube"
+	"ubg"
+	"ubidvobtdandag"
+	"ubis"
+	"ubkhwmdnkbi"
+	"ubmcrdupbqh"
+	"ubncmdrjhayh"
+	"ubogxsmusrt"
+	"ubojkzdxlrhztg"
+	"ubonvpffdfwi"
+	"ubouopbb"
+	"ubp"
+	"ubq"
+	"ubsdvrkc"
+	"ubsfneq"
+	"ubsrdkesvhxx"
+	"ubtigawzao"
+	"ubtrkgwfmc"
+	"ubuof"
+	"ubvjjrwtjowp"
+	"ubxqiowltmmhr"
+	"ubyratvgeyq"
+	"ubzouyntc"
+	"uc"
+	"ucbooqrljww"
+	"ucegkihlgtipx"
+	"ucfsnenczq"
+	"uch"
+	"ucjcnghmfu"
+	"ucjwwzgebwmy"
+	"uckjvkqkgb"
+	"ucleexycljhmy"
+	"uclhc"
+	"ucljuwr"
+	"uclpdoc"
+	"uclsza"
+	"ucoub"
+	"ucpeqwdrubm"
+	"ucpghomk"
+	"ucqpvdkrqmnqkl"
+	"ucrihfwg"
+	"ucrryhxsfzne"
+	"ucrzbbiyh"
+	"ucsjmtfwcxxhfe"
+	"ucsmdpyiqexpu"
+	"uctq"
+	"ucv"
+	"ucvkez"
+	"ucvwrw"
+	"ucw"
+	"ucwgclzz"
+	"ucxt"
+	"ucyfghfjzd"
+	"ucyfwhgugzcp"
+	"ucyjglfexkkkfu"
+	"ucyynengt"
+	"uczcgmui"
+	"uczhajcvo"
+	"uczkutbvvdnp"
+	"uczpj"
+	"ud"
+	"udcdkgbwujno"
+	"udclq"
+	"udcztsy"
+	"udfgyrk"
+	"udhrnrjz"
+	"udhw"
+	"udhxydwuqwu"
+	"udjwtngqk"
+	"udkdpbgipodbx"
+	"udkoyvxfltmfun"
+	"udlmlyhvcx"
+	"udmorcbvlr"
+	"udppfbhirhz"
+	"udqhohnkhatbgg"
+	"udredlxjuwef"
+	"udsqnrlveth"
+	"udtryxsgis"
+	"udu"
+	"uduuwl"
+	"udvnmfxzlodfm"
+	"udw"
+	"udxdylenwqx"
+	"udxykfmeknojr"
+	"udzngiyrrv"
+	"ue"
+	"ueazdfycv"
+	"uebdysvq"
+	"uebnjj"
+	"uebrwwlhns"
+	"ueenravnbon"
+	"ueexkwj"
+	"ueftrpiqums"
+	"uefxmotg"
+	"uehp"
+	"uehqe"
+	"uehvl"
+	"uehvnos"
+	"uekpenhqwo"
+	"uemn"
+	"uenkhlzvswmuc"
+	"ueob"
+	"uep"
+	"uercpiux"
+	"uerucpnwhs"
+	"uesfqnwoh"
+	"ueshrugp"
+	"ueuom"
+	"ueuymwlhhuihmx"
+	"uevvuzmzkbqrm"
+	"uevyvarbn"
+	"uewwyiiftivcqn"
+	"uexsdisku"
+	"ueytwkzhuikb"
+	"ueyx"
+	"uezltsuscwar"
+	"ufbbpm"
+	"ufbdfzwdpx"
+	"ufcbprr"
+	"ufccgxe"
+	"ufchmhtxd"
+	"ufcpilt"
+	"ufcynct"
+	"ufeufnomvdv"
+	"ufezsakwy"
+	"ufgynjpcjurrmf"
+	"ufimddbsd"
+	"ufionjpv"
+	"ufiqtoyamruth"
+	"ufj"
+	"ufksguhp"
+	"uflsesq"
+	"ufltcmofgi"
+	"ufmohjarqxfj"
+	"ufnw"
+	"ufqgmodki"
+	"ufqmgltxvuexa"
+	"ufqv"
+	"uftgek"
+	"ufu"
+	"ufulgsh"
+	"ufvctxxttacg"
+	"ufvjob"
+	"ufwbhncvrj"
+	"ufxp"
+	"ufyhqpcz"
+	"ufyrshdx"
+	"ug"
+	"ugafoxp"
+	"ugawmf"
+	"ugbporm"
+	"ugdgwdcaurgkw"
+	"ugdteosr"
+	"ugetkfqm"
+	"ugexqzzckp"
+	"uggwx"
+	"ugheiy"
+	"ughuhbn"
+	"ugi"
+	"ugijfmxyv"
+	"ugjy"
+	"ugkahgihcfft"
+	"uglpnvycsnmfi"
+	"ugm"
+	"ugoflu"
+	"ugoj"
+	"ugokburqwnrla"
+	"ugozdjb"
+	"ugpoeed"
+	"ugqyongxmmf"
+	"ugrlltqkxokvib"
+	"ugsenfx"
+	"ugsg"
+	"ugssor"
+	"ugt"
+	"ugth"
+	"ugtmfeiaosn"
+	"ugudbysyph"
+	"ugugqgkcbgv"
+	"ugvnqyoxxqps"
+	"ugwpyqtnfj"
+	"ugxbeqcseiqdcy"
+	"ugxooshmxemra"
+	"ugybinw"
+	"ugyfo"
+	"ugzmuosnwdpi"
+	"uh"
+	"uhaghobocjfx"
+	"uhai"
+	"uhcdxkjswiycyv"
+	"uhcosuspzyxn"
+	"uhdlxjeqeic"
+	"uhhqk"
+	"uhhwxsjqtn"
+	"uhklkcgmw"
+	"uhkltzygy"
+	"uhkqgsuzdlb"
+	"uhljndccl"
+	"uhmtxajvoo"
+	"uhniwaidbzwhld"
+	"uhnytqtlc"
+	"uhofmangshlslr"
+	"uhpf"
+	"uhrtixaiejyzo"
+	"uhtuzz"
+	"uhvtfta"
+	"uhxlbwucx"
+	"uhytrtd"
+	"uhzwtjwiity"
+	"ui"
+	"uibvghqfaalzx"
+	"uiceqzqhlxqz"
+	"uieubghfjyaqf"
+	"uifotgmmkhp"
+	"uifsbot"
+	"uifyppchg"
+	"uigdl"
+	"uigu"
+	"uiixlqqsysl"
+	"uijxhxb"
+	"uikqikctit"
+	"uimgswgi"
+	"uimkxyaa"
+	"uimlqoijgp"
+	"uimmtvuqyfnee"
+	"uinjaxycof"
+	"uinpk"
+	"uipamf"
+	"uipdjddfsjhv"
+	"uiperkvz"
+	"uiptkhlnlbjpe"
+	"uipwipsj"
+	"uipwuevowwbwks"
+	"uiriqttzt"
+	"uiuhbcyqulfqy"
+	"uiujnftaxuedyg"
+	"uiwxvxaxmiqa"
+	"uixuqov"
+	"uixxtxm"
+	"uiyibqcd"
+	"uizbbgnihvolkn"
+	"uj"
+	"ujbnkqxsui"
+	"ujbrdfryenyvvi"
+	"ujdisptetnwgi"
+	"ujf"
+	"ujfbokjlgqoia"
+	"ujfgzxkjn"
+	"ujfosr"
+	"ujgfplyhofpnyn"
+	"ujgm"
+	"uji"
+	"ujjdesafyncqwl"
+	"ujkmguyq"
+	"ujl"
+	"ujmrnxtbtm"
+	"ujpvpyqstvsuoh"
+	"ujrzyhaiyoam"
+	"ujsj"
+	"ujslbqxbtxxwwr"
+	"ujslvaf"
+	"ujto"
+	"ujtrcumdfhz"
+	"ujuryy"
+	"ujw"
+	"ujwaujehtiqedq"
+	"ujwqauncigzzv"
+	"ujwu"
+	"ujyafuwja"
+	"ujzrvinajyc"
+	"uk"
+	"ukaxpl"
+	"ukbeo"
+	"ukbgnkzzr"
+	"ukegdxtybh"
+	"ukesfum"
+	"ukfhtszbifsd"
+	"ukfipjc"
+	"ukgqpunyzvgh"
+	"ukgwouzujoizsg"
+	"ukhmjbkfkzs"
+	"ukhqakkazwmvtb"
+	"ukhrxfjuuf"
+	"ukknzu"
+	"ukkxgyavsb"
+	"ukm"
+	"ukmqfhpzmc"
+	"ukndjuadp"
+	"ukodta"
+	"ukopdztg"
+	"ukpvsyfcusl"
+	"ukq"
+	"ukqwzmshqdzoh"
+	"uktghtmeu"
+	"uktqrc"
+	"ukurnnkbvbwfqt"
+	"ukuyvgxp"
+	"ukvbasd"
+	"ukwywado"
+	"ukwzphsupxvk"
+	"ukxdl"
+	"ukxmh"
+	"ukygnggqwsfzk"
+	"ukypitl"
+	"ukzjtbarbw"
+	"ukzjzsex"
+	"ukzn"
+	"ul"
+	"ulbacvpcbngxsz"
+	"ulcx"
+	"ulfpgtv"
+	"ulgvpgzpkq"
+	"ulhsvhgejkqa"
+	"ulkrrgg"
+	"ulkzhyyxfax"
+	"ulmjotkrqfaeiv"
+	"ulmpufpzkrxng"
+	"uln"
+	"ulowtckpv"
+	"ulsxmvkc"
+	"ultkhmufqmikxe"
+	"ululrigmnjctc"
+	"ulupra"
+	"ulveaiwkmsu"
+	"ulvixxyhc"
+	"ulvllmtpl"
+	"ulxqgsduyvdp"
+	"uly"
+	"ulyauikeekt"
+	"ulzjdxshhnbnnj"
+	"ulzyxsvuvy"
+	"um"
+	"umalhg"
+	"umarssziwcv"
+	"umbnpuusvfimfw"
+	"umbq"
+	"umcsafbcemozkh"
+	"umdjbtt"
+	"umemcitr"
+	"umfubjrmdnh"
+	"umgiehugme"
+	"umhh"
+	"umhyjy"
+	"umjbqzkkywfrb"
+	"umjqgea"
+	"umk"
+	"umkejtess"
+	"umle"
+	"umlkscwe"
+	"umlurvoepqti"
+	"umluvpwmd"
+	"umlxxrvvjexd"
+	"ummjtbjrlw"
+	"ummtrewytgcay"
+	"ummvl"
+	"ummxwrf"
+	"umnejf"
+	"umns"
+	"umquducp"
+	"umtrdyqa"
+	"umuflatrxr"
+	"umukm"
+	"umuofqujqfospl"
+	"umvcjdjxarmnll"
+	"umvjflxp"
+	"umwbxthjkk"
+	"umwdsvnvert"
+	"umxfzhjppdsk"
+	"umxsuogmkvthnm"
+	"umzeebylkrynr"
+	"un"
+	"uncwirx"
+	"undks"
+	"unfo"
+	"ungaair"
+	"ungfhcto"
+	"unhpzfraxhovwf"
+	"unirwjndnpgq"
+	"unjfksxitnpiso"
+	"unjpbxo"
+	"unjxsvcnrlloq"
+	"unkvfl"
+	"unlrwsix"
+	"unltzsocy"
+	"unmwblxlovcg"
+	"unng"
+	"unpgtjxlk"
+	"unpmxxuhqvryt"
+	"unsabwlseseeii"
+	"unsdjet"
+	"untesimiikcfaa"
+	"untfky"
+	"unvfnfmugnm"
+	"unvjpxykhjt"
+	"unwpbbfecs"
+	"unxagcdy"
+	"unxayftqhf"
+	"unxiqoula"
+	"unyelqaonq"
+	"unyoshacgtrky"
+	"unzknoirecey"
+	"unzxxrmyl"
+	"uo"
+	"uoadrfnwljp"
+	"uocaraeharbq"
+	"uocwkzilsafs"
+	"uodgjnrgmqq"
+	"uodgs"
+	"uodhgmohd"
+	"uodhstfqaqdyh"
+	"uoe"
+	"uoesqufdx"
+	"uofbrotydsrr"
+	"uofcbnqyc"
+	"uofxk"
+	"uogdezmdmyqs"
+	"uoglbmmeuq"
+	"uoguv"
+	"uogwclp"
+	"uohachrfmil"
+	"uojqfqglpz"
+	"uojydhqiiw"
+	"uolloanptg"
+	"uooudtm"
+	"uoozzhyliwry"
+	"uoq"
+	"uoqyucujjwf"
+	"uoqznrfwmw"
+	"uorqsmyaxvawso"
+	"uorytbdrzqxqy"
+	"uowilsles"
+	"uowqt"
+	"uoxbeavxpybyl"
+	"up"
+	"upa"
+	"upamzfjfpmazip"
+	"upanzejkimyu"
+	"upeolko"
+	"upfk"
+	"upfmxiihmauxni"
+	"upfrdqlmd"
+	"upfwepeog"
+	"uphgcwgnotwxl"
+	"upjcfswzx"
+	"upjpsvsy"
+	"upkaykc"
+	"upktchrxytta"
+	"upm"
+	"upmqte"
+	"upmsfzsvpgjk"
+	"upniltsegp"
+	"upnn"
+	"uppljeo"
+	"upqdbjkbbibnl"
+	"upqmr"
+	"uprttofbnnvsd"
+	"upsi"
+	"upuqzjmtf"
+	"upzzxxjkmvg"
+	"uq"
+	"uqaba"
+	"uqbwlwxvudyxea"
+	"uqclit"
+	"uqdjykvnm"
+	"uqdkwsa"
+	"uqdnorqj"
+	"uqezeldqcfeni"
+	"uqfmvzdzkdsdcr"
+	"uqhpi"
+	"uqhysozqppf"
+	"uqidfxuy"
+	"uqjaefersta"
+	"uqkhomcan"
+	"uqkrifhvhe"
+	"uqkyrxji"
+	"uqlqcisdojb"
+	"uqlu"
+	"uqn"
+	"uqndmtdvhje"
+	"uqnhb"
+	"uqohr"
+	"uqokcuv"
+	"uqozccfloehmws"
+	"uqpzfveafjfuue"
+	"uqroxmitqibcj"
+	"uqsfyoval"
+	"uqtmtx"
+	"uqu"
+	"uqwnewhle"
+	"uqwnw"
+	"uqzfbzldnpwxu"
+	"uqzp"
+	"ur"
+	"urafxj"
+	"urbgaubb"
+	"urbr"
+	"urclfahp"
+	"urcsjln"
+	"urcto"
+	"ureemetwxk"
+	"urfeq"
+	"urg"
+	"urjdbbqo"
+	"urlrldiyzczrvz"
+	"urmlpypdcjcoo"
+	"uroiq"
+	"urpziibkrnek"
+	"urrkdmeumvfe"
+	"ursvzle"
+	"urvgow"
+	"urw"
+	"urx"
+	"urxlznwkkr"
+	"uryl"
+	"urzvfb"
+	"us"
+	"usajbes"
+	"usartmqpcfnbpy"
+	"uscapzwl"
+	"uscghqo"
+	"usd"
+	"usdlbewyn"
+	"usgjgnfvu"
+	"usgmfbyqmxpqn"
+	"usgudbxc"
+	"usj"
+	"uskbdhpkyvts"
+	"uskj"
+	"uslytmzhdiodra"
+	"usmkvicc"
+	"usordsvgeb"
+	"uswsbx"
+	"uswwzpfpxperfl"
+	"usyaipqm"
+	"usz"
+	"ut"
+	"utaf"
+	"utbe"
+	"utbgwrsecskb"
+	"utbjasqvbhea"
+	"utccb"
+	"utdsho"
+	"utdxvpkd"
+	"utenjwe"
+	"utimom"
+	"utjiurhsrnrfkd"
+	"utkefrvlofqcq"
+	"utkvmaa"
+	"utkwo"
+	"utlpnkakngu"
+	"utlvaxiwof"
+	"utmvw"
+	"utnlq"
+	"uto"
+	"utqeb"
+	"utqtnvmc"
+	"utr"
+	"utrwxeg"
+	"utsiknjsrfksvg"
+	"uttyhaxtz"
+	"utv"
+	"utvhuvvgryjpk"
+	"utvsfum"
+	"utwegqjug"
+	"utwnmoxyggfgz"
+	"utxbgcyp"
+	"uu"
+	"uubryglzyqzwq"
+	"uubt"
+	"uucikrbkzvm"
+	"uucvdaacu"
+	"uud"
+	"uudne"
+	"uufenhtw"
+	"uugotx"
+	"uugzzjlknar"
+	"uuibrjgsalmgpp"
+	"uukcceon"
+	"uumpbbxpmbbjyt"
+	"uuoe"
+	"uuonjlzanrl"
+	"uuowhs"
+	"uuozcdkmxpuiw"
+	"uuqltyhgdt"
+	"uuqywofjj"
+	"uusjdbewrp"
+	"uut"
+	"uuuxxkouj"
+	"uuuybmdznu"
+	"uuwarsrkvbm"
+	"uuwxmz"
+	"uux"
+	"uuxpdcctlxpsxk"
+	"uuzohznji"
+	"uv"
+	"uvaxlkmwpgmc"
+	"uvbjctxtfub"
+	"uvbmky"
+	"uvcbrmmazjx"
+	"uvcbugmieks"
+	"uvetpogvv"
+	"uvfqkfcddevxo"
+	"uvfzq"
+	"uvimkev"
+	"uvjhezii"
+	"uvkbsahdrz"
+	"uvke"
+	"uvlhvu"
+	"uvlot"
+	"uvn"
+	"uvnd"
+	"uvoccclo"
+	"uvqagvs"
+	"uvrvxh"
+	"uvsgaudvevzx"
+	"uvssedwpudepx"
+	"uvtaow"
+	"uvtsxdempsgu"
+	"uvutzohalnz"
+	"uvvukrnmagle"
+	"uvwqnv"
+	"uvwrie"
+	"uvwzqsiodire"
+	"uvxka"
+	"uvyeqq"
+	"uvzouilicpdxt"
+	"uw"
+	"uwacfpnacxmvqt"
+	"uway"
+	"uwbjcmfeei"
+	"uwbjx"
+	"uwcgdfzqatojbr"
+	"uwcr"
+	"uwdtvoootsjkq"
+	"uwevtyg"
+	"uwhbtlk"
+	"uwidzfigm"
+	"uwjpor"
+	"uwjpzyt"
+	"uwjt"
+	"uwk"
+	"uwkdnnmcmf"
+	"uwkvymwzkaijl"
+	"uwncqruaifg"
+	"uwntrpnlf"
+	"uwohfdfjlgo"
+	"uworczlf"
+	"uwosvgisbayw"
+	"uwpjkr"
+	"uwpx"
+	"uwqayr"
+	"uwqslrwzunrbnr"
+	"uwqyte"
+	"uwrxforse"
+	"uwttwwtjom"
+	"uwuhvuvcpvemq"
+	"uwwrtyj"
+	"uwwthjcevgxbxc"
+	"uwxeyge"
+	"uwxpyyvsj"
+	"uwytcfwfstc"
+	"ux"
+	"uxbqw"
+	"uxcvbly"
+	"uxcvtmvccaa"
+	"uxe"
+	"uxehfb"
+	"uxel"
+	"uxelukidclax"
+	"uxfyxcieizxcjw"
+	"uxgji"
+	"uxgkvroitqwfl"
+	"uxhitzfdaiscu"
+	"uxhwpuqg"
+	"uxi"
+	"uxifmjghrd"
+	"uxjghcavhyy"
+	"uxkdrikuss"
+	"uxkivvpgivvwex"
+	"uxkmta"
+	"uxkvrhqozdz"
+	"uxlmgvzhzobjdb"
+	"uxlpdggkx"
+	"uxmjvccvmztjr"
+	"uxnedsd"
+	"uxpbvvknzoknlr"
+	"uxqrm"
+	"uxskhmwuycw"
+	"uxsuaf"
+	"uxtfzvtuh"
+	"uxubhnoohejk"
+	"uxwjdplc"
+	"uxylhdg"
+	"uxyyss"
+	"uxzrwiq"
+	"uy"
+	"uyanaxkr"
+	"uyanj"
+	"uybsiberzhm"
+	"uydg"
+	"uydmc"
+	"uydmmgqmwirpjr"
+	"uydplgy"
+	"uydtiisir"
+	"uydunf"
+	"uyegatvsm"
+	"uyfhyrkwn"
+	"uyfzwxqeztlsux"
+	"uygqhs"
+	"uygyddikwgphb"
+	"uyh"
+	"uyhqrehslosl"
+	"uyksvitspjtvd"
+	"uylrflkns"
+	"uymd"
+	"uymy"
+	"uyoxphpmjqupgf"
+	"uypbgfxpcohd"
+	"uyspq"
+	"uyxvjcoaltj"
+	"uyzrct"
+	"uz"
+	"uzc"
+	"uzdyczbcs"
+	"uzgt"
+	"uzhrnnxua"
+	"uzhvutn"
+	"uzi"
+	"uzibueas"
+	"uzigcqq"
+	"uzjxcngh"
+	"uzk"
+	"uzmmlfqvbfel"
+	"uznaebhvn"
+	"uznplxnlqj"
+	"uznxxyr"
+	"uzojudqxz"
+	"uzoqxnrrlfymww"
+	"uzqqkoacqhjw"
+	"uztiqmluwsjzz"
+	"uztnwzb"
+	"uzttqprw"
+	"uzugrollzu"
+	"uzuvzfmrx"
+	"uzvwfrbhrpbujc"
+	"uzwz"
+	"uzxnmnsn"
+	"uzyszjxy"
+	"va"
+	"vabwnfctcmwqj"
+	"vad"
+	"vadqd"
+	"vadv"
+	"vadygfeoa"
+	"vag"
+	"vahnyzynycqju"
+	"vaihlytbu"
+	"vajsdzaxo"
+	"vamax"
+	"vamcbvujwdaavx"
+	"vamcf"
+	"vamrctobuh"
+	"vanb"
+	"vanpdnjc"
+	"vansaqbfvzt"
+	"vaoeug"
+	"vapnopagwj"
+	"vaprgel"
+	"vasaxvlk"
+	"vaskmbl"
+	"vasnmxfkshaceh"
+	"vav"
+	"vavmrnmhhcqij"
+	"vaw"
+	"vaxy"
+	"vaxyblzrb"
+	"vayphngdmh"
+	"vaytnnlbgowkkl"
+	"vazymmtbzyi"
+	"vb"
+	"vbalyxxhrlrpxs"
+	"vbbhrhulp"
+	"vbdn"
+	"vbgsy"
+	"vbhaizbjjrs"
+	"vbhtbsywq"
+	"vbhxw"
+	"vbhzoszotqe"
+	"vbineurlibja"
+	"vbjnn"
+	"vbkyzplqaebpk"
+	"vblqoysizbkzrz"
+	"vblwhyjdybh"
+	"vbnfb"
+	"vbqnjhsxhyehws"
+	"vbsg"
+	"vbsme"
+	"vbsn"
+	"vbsxtgcr"
+	"vbt"
+	"vbtkw"
+	"vbu"
+	"vbwh"
+	"vbxijayza"
+	"vbxmeuufzpdke"
+	"vbxrrsimbwrlh"
+	"vbysqhodvst"
+	"vc"
+	"vcajapmjeg"
+	"vcd"
+	"vcdqghmxopvfk"
+	"vcecdcyqlzwv"
+	"vcetvondfyrn"
+	"vcfrmk"
+	"vcfshyiqmuhf"
+	"vcfyd"
+	"vcgbfruimec"
+	"vcgjbdkx"
+	"vcgrtrxljfh"
+	"vchz"
+	"vcjtx"
+	"vckgvclldjm"
+	"vcldfq"
+	"vclfbvp"
+	"vclwhvdc"
+	"vcnmszrohdwxt"
+	"vcnxhkgqlfb"
+	"vcodairnwp"
+	"vcplnzk"
+	"vcqspkfxd"
+	"vcr"
+	"vcruqbucmrzxza"
+	"vcsgyni"
+	"vctheliit"
+	"vcwr"
+	"vcysim"
+	"vcyttr"
+	"vcyukzphqrfk"
+	"vd"
+	"vdbducsmrb"
+	"vdflh"
+	"vdggluc"
+	"vdgxuyfiozlkz"
+	"vdid"
+	"vdijpchjvmzuic"
+	"vdixwmpgial"
+	"vdj"
+	"vdkgztrjvot"
+	"vdlbwq"
+	"vdnwjjwkfhsjf"
+	"vdovguilwsy"
+	"vdpzxsdio"
+	"vdqfruu"
+	"vdqzvhhbjcakp"
+	"vds"
+	"vdsdqzkdjafc"
+	"vdtaqejucn"
+	"vdtlpenb"
+	"vdurdnlui"
+	"vduytcmu"
+	"vdvmcz"
+	"vdvzkzsupxb"
+	"vdxamsvrklq"
+	"vdxybzrdz"
+	"vdyfwvpvl"
+	"veakt"
+	"veal"
+	"veb"
+	"vebrze"
+	"vechvf"
+	"vecjzhmcww"
+	"vedkcchtuabnew"
+	"veecsevgp"
+	"vegcflsxhxyl"
+	"vehdrxvdh"
+	"vehlevorihyz"
+	"vehmgct"
+	"veht"
+	"vejvouwe"
+	"vel"
+	"vemfjic"
+	"veonrgntrfh"
+	"veoxjnade"
+	"vepbkcu"
+	"vepotjaisjn"
+	"vepublmnfpywf"
+	"vereexv"
+	"verujbj"
+	"vesavzcg"
+	"vetdclpduw"
+	"vevcj"
+	"vewfm"
+	"vewphi"
+	"vexhxldk"
+	"vf"
+	"vfcgxx"
+	"vfczk"
+	"vfenmme"
+	"vfhjxcfolm"
+	"vfhkptt"
+	"vfhldarenevijy"
+	"vfhnfzyft"
+	"vfifwatvzmad"
+	"vfky"
+	"vflnmv"
+	"vflsrhyfif"
+	"vfmvccpv"
+	"vfnrhilyyu"
+	"vfnu"
+	"vfoismcmew"
+	"vfp"
+	"vfsebnbmvrqy"
+	"vfsf"
+	"vfsmzqcn"
+	"vfsoviuexqrp"
+	"vfspykeuvb"
+	"vfsrofjzkrqpdv"
+	"vfsvyxadoaf"
+	"vfsz"
+	"vfvqabp"
+	"vfwdypndzs"
+	"vfxplhizwhkgo"
+	"vfzba"
+	"vfzvy"
+	"vfzzhirhuz"
+	"vg"
+	"vgak"
+	"vgbxyohdexjz"
+	"vgcodqva"
+	"vggey"
+	"vghcugfwjccwg"
+	"vgioprycebhna"
+	"vgiubdpgahaxo"
+	"vgjjspqmsb"
+	"vgmef"
+	"vgng"
+	"vgnkuaivyycllq"
+	"vgojryp"
+	"vgpthp"
+	"vgqmbbykwxvtmr"
+	"vgryep"
+	"vgszscqvhyahj"
+	"vgtqxae"
+	"vgvckvibvzdg"
+	"vh"
+	"vham"
+	"vhaorb"
+	"vhcjddouvvgupw"
+	"vhcnl"
+	"vhcymxm"
+	"vhcyrrf"
+	"vhdbhcccvv"
+	"vhdrkglxbiw"
+	"vhdymdyzslfbh"
+	"vhevrkncfsqia"
+	"vhhj"
+	"vhi"
+	"vhj"
+	"vhjkbnagnt"
+	"vhjrfgfxl"
+	"vhjvzpj"
+	"vhldjzxsfyehvu"
+	"vhmyn"
+	"vhopj"
+	"vhpirdiityfgdo"
+	"vhpxpcskeercv"
+	"vhqyi"
+	"vhrn"
+	"vhuqabskktlarl"
+	"vhutjtbjguamj"
+	"vhvoljfhnqvowg"
+	"vhxld"
+	"vhxlzt"
+	"vhxwkozvhehtji"
+	"vhzoml"
+	"viacym"
+	"viasw"
+	"vicgrykhiagz"
+	"vidtwfd"
+	"vienlulym"
+	"vihfxsubnrb"
+	"viklgdcrkhj"
+	"vikn"
+	"vikpjzpx"
+	"vilwtmiqm"
+	"vimbajainf"
+	"vimkqurbvmlefv"
+	"vimm"
+	"vinufsihjy"
+	"vio"
+	"violjxkfiyd"
+	"viom"
+	"vioygn"
+	"vipngmcxkwhhs"
+	"viptozzibfxf"
+	"viscpqkhs"
+	"visjvirtqczdv"
+	"visvffeo"
+	"vitde"
+	"vitzzqxlntw"
+	"viuvpk"
+	"viyxubs"
+	"vizseheecm"
+	"vj"
+	"vjauvnyte"
+	"vjbhuabn"
+	"vjccga"
+	"vjcdhmkpdfbbz"
+	"vjcghozsspiwk"
+	"vjcp"
+	"vjdmpf"
+	"vjfibtpon"
+	"vjfmwuys"
+	"vjgo"
+	"vji"
+	"vjjwgfsrc"
+	"vjldw"
+	"vjlievhpcjne"
+	"vjlrcpmnnrp"
+	"vjn"
+	"vjnblzofh"
+	"vjnkayajthc"
+	"vjnqnv"
+	"vjptptybhdbmfx"
+	"vjqygbct"
+	"vjram"
+	"vjrsmfrsin"
+	"vjtbprvmw"
+	"vjtiw"
+	"vjuexg"
+	"vjulxlmgfuql"
+	"vjumecoaao"
+	"vjun"
+	"vjunninj"
+	"vjuxqcwr"
+	"vjvke"
+	"vjvyclbybob"
+	"vjwjoqvjfo"
+	"vjxthvfs"
+	"vjyurkostma"
+	"vjyzi"
+	"vk"
+	"vkbmqqlcrp"
+	"vkcuzaprqsuptr"
+	"vkdpfihszxkhra"
+	"vkhvph"
+	"vkjrxivq"
+	"vkkyuzwsofgy"
+	"vklokpytqi"
+	"vkltstctpbi"
+	"vkmztwoa"
+	"vkntodib"
+	"vknx"
+	"vkobzhmkgf"
+	"vkq"
+	"vkqedtvxotksic"
+	"vkrs"
+	"vksaxfzifvzlqt"
+	"vksc"
+	"vktng"
+	"vktzkxmdf"
+	"vkvlwlm"
+	"vkvyx"
+	"vkwshlcwjdke"
+	"vkxivsnk"
+	"vkyknchluria"
+	"vkz"
+	"vl"
+	"vlada"
+	"vlak"
+	"vlbxp"
+	"vleu"
+	"vlifrgjgh"
+	"vlimrbvdnhd"
+	"vlnxkh"
+	"vlolda"
+	"vlpttau"
+	"vlq"
+	"vlqvdghu"
+	"vlqzbzw"
+	"vlraaozjmxf"
+	"vlrbh"
+	"vlrjkfh"
+	"vluojsszqc"
+	"vlvnnklblq"
+	"vlwukb"
+	"vlxhtbiaoalcgm"
+	"vlyipgi"
+	"vm"
+	"vmao"
+	"vmbalpnfyzvqin"
+	"vmcliascj"
+	"vmcnuojx"
+	"vmefzfckgpwad"
+	"vmehogzv"
+	"vmezvqazdr"
+	"vmgujg"
+	"vmipkywyzzr"
+	"vmlrxezt"
+	"vmlvhc"
+	"vmlwqcqxbhnc"
+	"vmmjdjckqf"
+	"vmmpi"
+	"vmmxohhpaji"
+	"vmmziczyl"
+	"vmnntubhv"
+	"vmofvadzjgny"
+	"vmqkz"
+	"vmr"
+	"vmsc"
+	"vmtd"
+	"vmtizijldtp"
+	"vmummyfkdzhg"
+	"vmw"
+	"vmwduhj"
+	"vmwgedmocidji"
+	"vmxam"
+	"vmxqifbhvbszr"
+	"vmy"
+	"vmyeout"
+	"vmzcrsiqfnmbtr"
+	"vn"
+	"vnaemw"
+	"vncwg"
+	"vndqoyd"
+	"vnesqwnuagzj"
+	"vnfidrbmfap"
+	"vnfj"
+	"vngoixmjnxtxmz"
+	"vnjni"
+	"vnlk"
+	"vnm"
+	"vnoop"
+	"vnpipevvgmbi"
+	"vnpjcsk"
+	"vnpmzincmrbus"
+	"vnrcniwuyyrvja"
+	"vnuckaoogkyy"
+	"vnupoizgekztn"
+	"vnvfji"
+	"vnvkvngmyq"
+	"vo"
+	"voaixtzl"
+	"vod"
+	"vodfoin"
+	"vodkbkvaeclfzb"
+	"vof"
+	"voflbegxpejfrg"
+	"vogx"
+	"voidctjvhsew"
+	"vokxgfkqmomvdn"
+	"vonp"
+	"vopiyvlfn"
+	"vopnyxepyov"
+	"voqcgwzpocblo"
+	"vosbpktwnrwm"
+	"votgmrorwc"
+	"voucx"
+	"vovbdysuejm"
+	"vowce"
+	"vowgezhmju"
+	"vowphj"
+	"voxmbkzce"
+	"voyla"
+	"vozjd"
+	"vozx"
+	"vozzrxrwxoor"
+	"vp"
+	"vpb"
+	"vpcbdeerg"
+	"vpdcjkji"
+	"vpekq"
+	"vpfgmhqksbrx"
+	"vpfno"
+	"vpgnxf"
+	"vpgyddvcu"
+	"vphtjdotc"
+	"vpjmsopdqkhn"
+	"vpm"
+	"vpnoegzltxgmeq"
+	"vpnwtmai"
+	"vppwvjbqohc"
+	"vpt"
+	"vptcaihfxbzsgc"
+	"vptdxtrvfq"
+	"vptyvfic"
+	"vpvcmiadbcxt"
+	"vpvepua"
+	"vpvv"
+	"vpxhaljgb"
+	"vpy"
+	"vpzkofgyguzoi"
+	"vq"
+	"vqavdm"
+	"vqcmbsxec"
+	"vqdblixik"
+	"vqiiwrflnlgibx"
+	"vqims"
+	"vqixaxvvfgnwj"
+	"vqjhhgmgskux"
+	"vqls"
+	"vqlsceeqfyjbfo"
+	"vqm"
+	"vqoimqhioo"
+	"vqpo"
+	"vqrpbntl"
+	"vqrrjd"
+	"vqu"
+	"vqunktweh"
+	"vqvaezen"
+	"vqvu"
+	"vqwshse"
+	"vqwtt"
+	"vqx"
+	"vqxdixn"
+	"vqxoanbnzh"
+	"vqxyccuhaidjip"
+	"vqzebeuresaq"
+	"vqzviafbflzze"
+	"vr"
+	"vrbxlkutbb"
+	"vrcdvlxx"
+	"vrchxq"
+	"vrcnynhvx"
+	"vrcoosvailoc"
+	"vrdbiar"
+	"vrdufvrfmgtl"
+	"vreosr"
+	"vrfqrmqazqn"
+	"vrftvgicxhudqp"
+	"vrgxshuks"
+	"vri"
+	"vriodiqbyzz"
+	"vriwtdy"
+	"vrj"
+	"vrkmoyn"
+	"vrlcdozjzpzl"
+	"vrnmhxiiautcg"
+	"vropldbnjmgq"
+	"vrov"
+	"vrpwlzkbjc"
+	"vrromzm"
+	"vrrxbbssiwxi"
+	"vrsahlprcfw"
+	"vrsefv"
+	"vrsotjbgoyn"
+	"vrx"
+	"vrxyyatylln"
+	"vs"
+	"vsasksvix"
+	"vsbdqg"
+	"vsc"
+	"vsccctfymsurug"
+	"vscitscqxhc"
+	"vscnyrtrxlrgh"
+	"vsctpb"
+	"vseihhmwsltt"
+	"vsfhzchlykeob"
+	"vsfrtcopvl"
+	"vsgnsmbf"
+	"vsiz"
+	"vskr"
+	"vslwcd"
+	"vsnnxkmzoj"
+	"vsqsumaqdxw"
+	"vsrovbzbsfet"
+	"vsrraagp"
+	"vsryc"
+	"vstk"
+	"vstywgfoewwpsu"
+	"vsuok"
+	"vswi"
+	"vsxxqssnyqyhm"
+	"vszsrcyrdpwq"
+	"vtcphbfdn"
+	"vtd"
+	"vtefkvdt"
+	"vtexsprddmwmmo"
+	"vthleipqz"
+	"vtjsn"
+	"vtjuwudf"
+	"vtlqoafpn"
+	"vtmfar"
+	"vtmhb"
+	"vtmkerlhrovaza"
+	"vtmw"
+	"vtnfnxrokdcukt"
+	"vtpbvn"
+	"vtr"
+	"vttm"
+	"vtvd"
+	"vtvjzlsmsysc"
+	"vtwaoykl"
+	"vtwojib"
+	"vtwvhvtutlrmyh"
+	"vtxrmvvo"
+	"vtxzxyzhfzwvro"
+	"vtyl"
+	"vu"
+	"vuatbgoi"
+	"vubjlvyukwbw"
+	"vucj"
+	"vuees"
+	"vueukwem"
+	"vufmufznb"
+	"vufyyelgis"
+	"vugqoj"
+	"vugr"
+	"vuhfmdtkvswiys"
+	"vuhpncnkepixnf"
+	"vuidpmanlqbur"
+	"vuilfmxpmyj"
+	"vuj"
+	"vujsqrbnw"
+	"vuk"
+	"vukkhtlxslh"
+	"vumemviuygpz"
+	"vumtoznlfbaa"
+	"vunfpdaohtapfh"
+	"vuoiwdquyj"
+	"vuoqcwzummflsm"
+	"vuoxen"
+	"vup"
+	"vupw"
+	"vurfss"
+	"vutezcjxnto"
+	"vuuvu"
+	"vuvlcuzvlg"
+	"vuxhhkpvp"
+	"vuxnhrx"
+	"vuxqzdbrpneyj"
+	"vuynprkr"
+	"vuzebixwm"
+	"vuzfhi"
+	"vuzytgqc"
+	"vv"
+	"vvdlgfkec"
+	"vvdmjnbhkn"
+	"vvegiwqt"
+	"vvewqoshjsu"
+	"vvhlo"
+	"vvii"
+	"vvjebcmutzzz"
+	"vvknufaeebgeh"
+	"vvlmjsgooqosu"
+	"vvmituld"
+	"vvmomdstccwiy"
+	"vvoymqjdk"
+	"vvprc"
+	"vvqutgoderl"
+	"vvrvppqxdbhbf"
+	"vvs"
+	"vvsztqriinog"
+	"vvtlwmra"
+	"vvttc"
+	"vvvf"
+	"vvvhvftegyr"
+	"vvvsrlxb"
+	"vvxn"
+	"vvxrgu"
+	"vvxrvjt"
+	"vvxz"
+	"vvyxapq"
+	"vvyzchzuxl"
+	"vvzdnzrpl"
+	"vvziflx"
+	"vvzuta"
+	"vw"
+	"vwanoe"
+	"vwauvb"
+	"vwaycu"
+	"vwctysfiuxve"
+	"vwdzvrrg"
+	"vwfdz"
+	"vwferevvbesajm"
+	"vwgekeaqeq"
+	"vwgkgmftgoe"
+	"vwgvxe"
+	"vwizzmuhkgpyu"
+	"vwjtkwe"
+	"vwkxpnozqgilii"
+	"vwojdtzfnofnd"
+	"vwpxsclwyuwl"
+	"vwvdvsaingpgl"
+	"vwwpzok"
+	"vwwtrbcnxq"
+	"vwxbne"
+	"vwxmbfe"
+	"vwytiefuumrch"
+	"vx"
+	"vxayxoq"
+	"vxcabxgfhkmg"
+	"vxck"
+	"vxcm"
+	"vxfziaerwziclt"
+	"vxgssuy"
+	"vxgxgivi"
+	"vxhwxrrildvabp"
+	"vxjsetqt"
+	"vxkbtcnl"
+	"vxmtbv"
+	"vxmzysmyv"
+	"vxncngmjqdyf"
+	"vxnypapxwor"
+	"vxozzey"
+	"vxpmws"
+	"vxpwzfss"
+	"vxqzloykc"
+	"vxrhslfyvggjzn"
+	"vxrqohgdarutn"
+	"vxsyevfmmqev"
+	"vxvgfaktuyg"
+	"vxwz"
+	"vxzrkswia"
+	"vy"
+	"vyaaggjynb"
+	"vyamfzbeicx"
+	"vyayn"
+	"vybau"
+	"vybmelem"
+	"vybpkkuhnpkwag"
+	"vybqvnrsp"
+	"vybtbfgh"
+	"vybtq"
+	"vybwiwhzlthyxt"
+	"vydka"
+	"vydnveqoj"
+	"vyehp"
+	"vyfeauzq"
+	"vyfreiswwn"
+	"vyjqeprphp"
+	"vylhl"
+	"vylie"
+	"vylnwtnmgmprc"
+	"vymkqgn"
+	"vymrfsvwxa"
+	"vyndgseqyv"
+	"vyodeemwpsos"
+	"vyodidrkax"
+	"vyqgdvjpyv"
+	"vyrgt"
+	"vyrpgrggj"
+	"vytbjcig"
+	"vytrbojaijenx"
+	"vytzdaimtu"
+	"vywayegrnrm"
+	"vywlgnahyj"
+	"vyxiniw"
+	"vyxpvkfyowiaw"
+	"vz"
+	"vzad"
+	"vzayazsyf"
+	"vzazulgxyad"
+	"vzdo"
+	"vzdob"
+	"vze"
+	"vzeftvqz"
+	"vzgfgilwkl"
+	"vzhzsmnabmna"
+	"vzjumxumjn"
+	"vzk"
+	"vzkfucmaq"
+	"vzmhneqsocpinx"
+	"vzmrjkpz"
+	"vzocypejtqc"
+	"vzokb"
+	"vzrdlw"
+	"vzrftgcprvjx"
+	"vztcmznejmhg"
+	"vztwgptqexhs"
+	"vzubsaitaigukg"
+	"vzuciiixhmvsd"
+	"vzumr"
+	"vzvdm"
+	"vzvmwjmocrx"
+	"vzwafol"
+	"vzxcutitta"
+	"vzy"
+	"wa"
+	"waa"
+	"waayldidlz"
+	"wacaxtpoksn"
+	"wacbabrkkzata"
+	"wacfcvbd"
+	"wacknpkamvnq"
+	"wadegerqbmye"
+	"waeaoisfkdrfk"
+	"waeeufnzwwa"
+	"waekydif"
+	"waexalhcxwzcgw"
+	"wafpkvysslxr"
+	"wahfzufvwr"
+	"wahknrx"
+	"waiflowydtzf"
+	"waiol"
+	"wajmcvxoliman"
+	"walnl"
+	"walrprkwlf"
+	"wanjhodug"
+	"waorvuziwhwodx"
+	"wapgifvvcsob"
+	"waptkabtejv"
+	"waqi"
+	"waqqndlqnnum"
+	"waqtpoi"
+	"warg"
+	"warkebvneivo"
+	"waryxuasurbe"
+	"wasftizpm"
+	"wasgceuytublc"
+	"wasljgtos"
+	"wasspmhtcqehbr"
+	"wasu"
+	"watmloqwdf"
+	"wavesjhklz"
+	"wavlkb"
+	"wax"
+	"waxphbpnsw"
+	"wb"
+	"wbaufecgnl"
+	"wbavis"
+	"wbbb"
+	"wbbiktbarcu"
+	"wbbrik"
+	"wbcyq"
+	"wbdcpg"
+	"wbdsxjkckuayxy"
+	"wbeiornocn"
+	"wbexdpjsmc"
+	"wbgdmd"
+	"wbgkmacxlbp"
+	"wbgl"
+	"wbgtm"
+	"wbh"
+	"wbhm"
+	"wbitra"
+	"wbjyayv"
+	"wbknkiybnorsn"
+	"wbnhnrftecvd"
+	"wbp"
+	"wbqgouei"
+	"wbqiyyzk"
+	"wbrwlaysbzqne"
+	"wbsfvdhsgq"
+	"wbsfwpiclrcqeb"
+	"wbsgrekpawbjmy"
+	"wbsllfpxfpie"
+	"wbsruf"
+	"wbt"
+	"wbuepc"
+	"wbvdzip"
+	"wbvntg"
+	"wbvqbms"
+	"wbzqcziikh"
+	"wbztlsifqf"
+	"wc"
+	"wccijbqnh"
+	"wccnfqelxbzyn"
+	"wccyg"
+	"wceqthzeivce"
+	"wcflbvglqbj"
+	"wcfmqhvfam"
+	"wcfuamjq"
+	"wcfvzqgkl"
+	"wcgzrh"
+	"wchlimwmywotvr"
+	"wcifdkec"
+	"wcikwd"
+	"wcjdz"
+	"wcje"
+	"wcjhfqqnw"
+	"wcjlzjkiv"
+	"wckbpxpujyaxl"
+	"wckq"
+	"wckrtreffh"
+	"wclr"
+	"wcmu"
+	"wcn"
+	"wcnuey"
+	"wcq"
+	"wcqradklfe"
+	"wcquoalxlmnz"
+	"wcrfat"
+	"wcsmwvvdelotw"
+	"wcsnyhivz"
+	"wcsxmpw"
+	"wcsz"
+	"wcvhengkjqscxo"
+	"wcxtryzsfxln"
+	"wd"
+	"wda"
+	"wdab"
+	"wdabd"
+	"wdaoziit"
+	"wdbkecibshvkmn"
+	"wdboyjuqngwxp"
+	"wdcagpfznx"
+	"wdcefrzmlkea"
+	"wdcocmbbmxuu"
+	"wddjrw"
+	"wdhopcbzituyx"
+	"wdhpjo"
+	"wdiprcgpmrp"
+	"wdive"
+	"wdlswypkutel"
+	"wdnsklri"
+	"wdoofxkjrssw"
+	"wdowakzbb"
+	"wdozxeknrsfag"
+	"wdphezrsuog"
+	"wdpwfutq"
+	"wdqhqfnha"
+	"wdqrbmomnc"
+	"wdslltij"
+	"wdsocqyuagqy"
+	"wdtca"
+	"wdtcc"
+	"wduswqw"
+	"wdvqdwunpxr"
+	"wdwptmkzuxxuvh"
+	"wdwr"
+	"wdx"
+	"wdywd"
+	"we"
+	"weaaejsywak"
+	"wechtwkmrdc"
+	"weedwcy"
+	"weehuleb"
+	"weejjwahnuuea"
+	"wegi"
+	"weimkatcorxwx"
+	"welpnknylnark"
+	"wepujofgeobdj"
+	"wes"
+	"wesdih"
+	"wet"
+	"wev"
+	"wewnqyrk"
+	"wf"
+	"wfbewhsdrgj"
+	"wfbsziefthahuf"
+	"wfcg"
+	"wfcjoqf"
+	"wfdrtfwn"
+	"wfeioxtacosno"
+	"wfelaqdpeud"
+	"wff"
+	"wfghoahih"
+	"wfgocxpjw"
+	"wfhdfjwpfvq"
+	"wfhogbsvugu"
+	"wfiiktvnfahkce"
+	"wfjfwznof"
+	"wfkg"
+	"wfktecik"
+	"wflzlvx"
+	"wfnbilahwu"
+	"wfnzlbk"
+	"wforai"
+	"wfpqvmknsuhwvs"
+	"wfqtwyznaxqdhm"
+	"wfrztlobbhe"
+	"wfthorq"
+	"wftjhgbduqmk"
+	"wfto"
+	"wfva"
+	"wfvbcpvb"
+	"wfwgv"
+	"wfwlrkunuvd"
+	"wfxagi"
+	"wfxseifqqish"
+	"wfxz"
+	"wfyjg"
+	"wfzgofdgofyt"
+	"wgaacmpibdxs"
+	"wgfgdgclo"
+	"wggyxhufxwavqu"
+	"wghlwz"
+	"wghuo"
+	"wgi"
+	"wgilpoth"
+	"wgl"
+	"wgljqlokugss"
+	"wglopcrsanpsf"
+	"wgmjvqzb"
+	"wgnbby"
+	"wgnqxqwtqt"
+	"wgop"
+	"wgoqlokgazen"
+	"wgpimdqcdlf"
+	"wgrkpej"
+	"wgtyovfaygba"
+	"wgumlloecqzk"
+	"wguwdcjuvubnsk"
+	"wgvf"
+	"wgwahnity"
+	"wgwflxt"
+	"wgwjqyiwdetwe"
+	"wgxrnbzvjrjdi"
+	"wh"
+	"whajcbe"
+	"whfbife"
+	"whgacamornp"
+	"whhqciof"
+	"whi"
+	"whicwqkhuztr"
+	"whjs"
+	"whjv"
+	"whlitbstipd"
+	"whlmzp"
+	"whmalzydzauigd"
+	"whnvkch"
+	"whnzrlkzukeu"
+	"whoolqejczq"
+	"whpbmhsfpbymfw"
+	"whpdwgcgxd"
+	"whpmadoebr"
+	"whsiinl"
+	"whu"
+	"whwp"
+	"whxiohqsqq"
+	"wi"
+	"wiaxem"
+	"wib"
+	"widgeqybluxt"
+	"wiebuzvbejnxf"
+	"wif"
+	"wifayuwwqjm"
+	"wiff"
+	"wifs"
+	"wihwia"
+	"wiisdtx"
+	"wil"
+	"wilhyjtgmj"
+	"wilwwzt"
+	"wimrs"
+	"wimuf"
+	"win"
+	"wiovhvamdxm"
+	"wioymgjhiofjy"
+	"wiqjeni"
+	"wirtfx"
+	"wisw"
+	"witlvwlmyfm"
+	"wivkdkfktjpicv"
+	"wivwztjwez"
+	"wiwsa"
+	"wiwtdebboc"
+	"wizbtj"
+	"wj"
+	"wjabecaxbmjol"
+	"wjafmhcaoch"
+	"wjcl"
+	"wjcwuyzzwhfnaw"
+	"wjdtahicgm"
+	"wjecxmz"
+	"wjemae"
+	"wjfw"
+	"wjfyeditezf"
+	"wjghdnfdt"
+	"wjgsqd"
+	"wjihaqrd"
+	"wjipvgtyhixyey"
+	"wjiufcf"
+	"wjlfdgggqzcv"
+	"wjmbwojfvese"
+	"wjnapudjdpvd"
+	"wjnzwgccmdub"
+	"wjofecrr"
+	"wjqrybjuzms"
+	"wjrj"
+	"wjs"
+	"wjuumdldjey"
+	"wjuywk"
+	"wjvg"
+	"wjvgkfnf"
+	"wjvlprvbplqtez"
+	"wjvuajk"
+	"wjwkhaibb"
+	"wjxdxzdqc"
+	"wjyzafu"
+	"wjzcjfoyzltnq"
+	"wjzghyuc"
+	"wjzkxvbpjruwfg"
+	"wk"
+	"wkab"
+	"wkajhcviwkav"
+	"wkfqxlxyjuxpj"
+	"wkgl"
+	"wkgp"
+	"wkhujoyuqlk"
+	"wkhux"
+	"wkijx"
+	"wkjctwa"
+	"wkkssfclrbbt"
+	"wklvq"
+	"wklwmpybys"
+	"wkn"
+	"wkoyzhtz"
+	"wkq"
+	"wkqfpcb"
+	"wkrqqqxpsmvnmi"
+	"wkszgbkx"
+	"wku"
+	"wkv"
+	"wkwhlas"
+	"wkxbirklpqjc"
+	"wky"
+	"wl"
+	"wlainkqoyenpx"
+	"wlaoqtkm"
+	"wlap"
+	"wlc"
+	"wlcirgnfsneshm"
+	"wlcmnnakfp"
+	"wlcqpctn"
+	"wldktamyg"
+	"wletzl"
+	"wlfmkqxjj"
+	"wlg"
+	"wliio"
+	"wljlqtu"
+	"wlk"
+	"wlkyz"
+	"wll"
+	"wlnkoydu"
+	"wlnvqivn"
+	"wlpjrsrgdgj"
+	"wlpsw"
+	"wlpxlsf"
+	"wlrgnwqabjllmk"
+	"wlrxpmmskifmul"
+	"wltozpsb"
+	"wluksyaxujhg"
+	"wlve"
+	"wlvpfksvstt"
+	"wlxybevluwrvis"
+	"wlyyowsmclsu"
+	"wm"
+	"wmafcudses"
+	"wmasqpv"
+	"wmbd"
+	"wmfe"
+	"wmgsp"
+	"wmhkdljrptwr"
+	"wmipyl"
+	"wmiquilvbawvsx"
+	"wmjqtqdwfhqrc"
+	"wmkuujua"
+	"wmlataub"
+	"wmlx"
+	"wmmlp"
+	"wmmzi"
+	"wmndsvgfajrq"
+	"wmnmqnioksa"
+	"wmqpjfoahsk"
+	"wmqvsfpgxuei"
+	"wmrhnwqwbni"
+	"wmrhprnumbfw"
+	"wmsifpzqkioaio"
+	"wmsxhk"
+	"wmtlxnpon"
+	"wmufauf"
+	"wmugkqhxtfekb"
+	"wmurjzu"
+	"wmutrnhqmpxk"
+	"wmvmdioak"
+	"wmvugzzjnbtqz"
+	"wmvxtwbz"
+	"wmwqfhnefooxk"
+	"wmyvtsc"
+	"wn"
+	"wnb"
+	"wnbhsdy"
+	"wnc"
+	"wndtckegpnkwgq"
+	"wngot"
+	"wnhanbwshbli"
+	"wnhsxyuclcqaap"
+	"wniyjiumxtk"
+	"wnkfhgj"
+	"wnkrt"
+	"wnlbproqcjwkez"
+	"wnlqigh"
+	"wnmbpmwxei"
+	"wnnishwk"
+	"wnocztqm"
+	"wnopwnyy"
+	"wnpjhfoihfr"
+	"wnpwgn"
+	"wnrqdphi"
+	"wntcl"
+	"wnu"
+	"wnvvlvrovia"
+	"wnwlvabmdibb"
+	"wnwzktyv"
+	"wnyhhq"
+	"wnyhssfhxlbn"
+	"wnytler"
+	"wo"
+	"woawrvnbzbmvbu"
+	"wob"
+	"wobkkndasf"
+	"wod"
+	"wodgasz"
+	"wodkksqqftbvr"
+	"wodktd"
+	"wodmgsx"
+	"wodpafdqsrdu"
+	"woefxxtuvggzm"
+	"wofq"
+	"wofqipzaaw"
+	"wogt"
+	"wohhrpptdiyran"
+	"woicdwjjyzgpx"
+	"woiiqptemraky"
+	"woiuevfs"
+	"wokmmqa"
+	"womtn"
+	"woozxs"
+	"woqipzd"
+	"worlnkvnc"
+	"worwtreoorwz"
+	"woryhdgteryee"
+	"woss"
+	"wossvigqpuo"
+	"wosxmjdxylojd"
+	"wott"
+	"wouha"
+	"wowfsfgjqpg"
+	"woxcevlpko"
+	"woyrfwzz"
+	"wp"
+	"wparp"
+	"wpbeq"
+	"wpcvcuzr"
+	"wpdgwkqn"
+	"wpfxqjerox"
+	"wpgaqxfg"
+	"wpgcg"
+	"wphukjqklgnrd"
+	"wpi"
+	"wpjytzhrazqbai"
+	"wpkegczippoko"
+	"wplgf"
+	"wpm"
+	"wppijlvdfzntz"
+	"wpqfles"
+	"wprbftgpzim"
+	"wpreww"
+	"wprqtishwwgqky"
+	"wprvkdusgewwyd"
+	"wpuovrgdkuxan"
+	"wpvhe"
+	"wpvxp"
+	"wpw"
+	"wpwd"
+	"wpycb"
+	"wpzflv"
+	"wq"
+	"wqalzlwdm"
+	"wqbjecsjpk"
+	"wqbuvoxfp"
+	"wqcbgfrxnhfoi"
+	"wqfv"
+	"wqgthzkcui"
+	"wqgypoznvupaqx"
+	"wqhiavciwmfiy"
+	"wqjgjabcsij"
+	"wqjiazou"
+	"wqnlmvzl"
+	"wqoaxbibwb"
+	"wqosml"
+	"wqovvhpocxmna"
+	"wqpb"
+	"wqpbxmnomk"
+	"wqpqzglsjcu"
+	"wqqun"
+	"wqr"
+	"wqsepfqxghmom"
+	"wqskzdnqyko"
+	"wqtnmatfjtfpn"
+	"wquy"
+	"wqvm"
+	"wqzj"
+	"wr"
+	"wra"
+	"wrc"
+	"wrdcov"
+	"wrdxwhtyyddp"
+	"wrecfjutgb"
+	"wretlqsfjquvn"
+	"wrgaaptn"
+	"wrhfocvf"
+	"wrji"
+	"wrldrnfhnesvuu"
+	"wrltrgrm"
+	"wrlvefrm"
+	"wrnd"
+	"wrnvc"
+	"wrplnhtgrtgv"
+	"wrqiwvir"
+	"wrqpazl"
+	"wrqz"
+	"wrt"
+	"wrtkxghjsbk"
+	"wru"
+	"wruc"
+	"wruga"
+	"wrutruab"
+	"wrwlk"
+	"wrxjcdqq"
+	"wryhhjcsbdeohf"
+	"ws"
+	"wsdobvn"
+	"wser"
+	"wsfer"
+	"wsgmsoemw"
+	"wsgsplwzpibezo"
+	"wshrib"
+	"wsiedxxqec"
+	"wsikaenb"
+	"wsjuxsikrogkr"
+	"wsjyircbstayjb"
+	"wskcp"
+	"wskkcung"
+	"wsktqpjh"
+	"wsmkqectwaspis"
+	"wsnuidsif"
+	"wsoouzrj"
+	"wspiz"
+	"wsrqglf"
+	"wssh"
+	"wssjnoscsel"
+	"wstem"
+	"wsxnnveuo"
+	"wsym"
+	"wszmawazeyzlpc"
+	"wt"
+	"wtbacyn"
+	"wtdb"
+	"wteasyn"
+	"wteqdssdfppy"
+	"wtfqcytbtjqn"
+	"wtgcejpjkmv"
+	"wthjowfx"
+	"wthtvv"
+	"wthwiartjsctkv"
+	"wtkudewh"
+	"wtm"
+	"wtnj"
+	"wtnmqwpz"
+	"wtnvgibaj"
+	"wtod"
+	"wtrbusnveypupa"
+	"wtrskkc"
+	"wtswckhjfz"
+	"wttnf"
+	"wtudmrdu"
+	"wtupnjugyafasj"
+	"wtvpqz"
+	"wtvqlfatsqrdt"
+	"wtwdhhofrgahq"
+	"wtwrgsnrtawn"
+	"wtxj"
+	"wtzsqgg"
+	"wtzwtrraako"
+	"wu"
+	"wuardjqxkyrus"
+	"wube"
+	"wubiphv"
+	"wubuwl"
+	"wucgz"
+	"wueiov"
+	"wugshkciyjkuxt"
+	"wuh"
+	"wuidec"
+	"wuil"
+	"wuiojmfwneuglu"
+	"wuiypct"
+	"wujhif"
+	"wujjfeuul"
+	"wujph"
+	"wukfj"
+	"wukfq"
+	"wunnibgx"
+	"wuoaudchjrgxv"
+	"wup"
+	"wuq"
+	"wuqavnpyubr"
+	"wur"
+	"wuriffgrpoaazo"
+	"wuscqopavv"
+	"wusvyngwojnk"
+	"wutjqkestitb"
+	"wutmlibkx"
+	"wuutsysgau"
+	"wuwrvdmfjdv"
+	"wuxvoayxviyz"
+	"wuygc"
+	"wuyo"
+	"wuypeepxqssanl"
+	"wuznvsonklm"
+	"wv"
+	"wvayeviseq"
+	"wvbhx"
+	"wvcdrztyddr"
+	"wvdguwvvw"
+	"wvdraebojo"
+	"wvfglbqsgqsa"
+	"wvfnjf"
+	"wvfoolndonti"
+	"wvgtbtozivvoop"
+	"wvhomhlw"
+	"wvhtfwzas"
+	"wvk"
+	"wvklnlygats"
+	"wvlsylq"
+	"wvoybo"
+	"wvpluzjrjwhrzb"
+	"wvqetdjcdfqyc"
+	"wvtnsxkolqg"
+	"wvudhpzonpdkrl"
+	"wvvcgsxrtvyj"
+	"wvwtpui"
+	"wvxg"
+	"wvxgdtedrdai"
+	"wvxxnjufdmqqat"
+	"wvzmvbljeu"
+	"wvzo"
+	"wvzzshxb"
+	"ww"
+	"wwaswiyuxtuci"
+	"wwb"
+	"wwgihek"
+	"wwgswoludcawxs"
+	"wwhmz"
+	"wwi"
+	"wwifpdrqmnmfwu"
+	"wwixhlkfld"
+	"wwjcwvwhxmx"
+	"wwjfxtdahz"
+	"wwkrzf"
+	"wwlswjyxtjdin"
+	"wwnoruyvx"
+	"wwnxegxwjha"
+	"wwozivubc"
+	"wwraxudzamjdu"
+	"wwrbwrudvdrry"
+	"wwsfrxwfhq"
+	"wwtj"
+	"wwuwrkw"
+	"wwxxdwuyay"
+	"wwyyvpqsi"
+	"wx"
+	"wxbxhbjxvxlf"
+	"wxcynt"
+	"wxdy"
+	"wxe"
+	"wxeaicyognmid"
+	"wxebmrl"
+	"wxefouueef"
+	"wxenuuhig"
+	"wxexd"
+	"wxfacpuvygud"
+	"wxftwxsempt"
+	"wxjjrtjnr"
+	"wxjnrmhauqgsf"
+	"wxkn"
+	"wxmbho"
+	"wxmhlbh"
+	"wxog"
+	"wxoi"
+	"wxolzidgcziww"
+	"wxpjp"
+	"wxr"
+	"wxtekf"
+	"wxuquumqbpm"
+	"wxvstt"
+	"wxxhytuuomzqeh"
+	"wxygru"
+	"wxyroycfuxh"
+	"wy"
+	"wyazgins"
+	"wyctjkwfymuld"
+	"wyctsucdjfojr"
+	"wydfec"
+	"wye"
+	"wyfiwfkmvt"
+	"wyfohlnb"
+	"wyfzbxkddm"
+	"wygezlycmleys"
+	"wygxmuomomaq"
+	"wygyxrlu"
+	"wyihxp"
+	"wyiyip"
+	"wyiyondsqfjg"
+	"wymzc"
+	"wyoiyqx"
+	"wypgrdcgrcu"
+	"wytkh"
+	"wytypkfxm"
+	"wyujl"
+	"wyum"
+	"wyuycn"
+	"wyvln"
+	"wywcmmqbbay"
+	"wywi"
+	"wyxnsg"
+	"wyydyosbayd"
+	"wyzgi"
+	"wz"
+	"wzanlbmzjxfbko"
+	"wzaxw"
+	"wzbvrakqak"
+	"wzcatzvzbglsj"
+	"wzecikgikmww"
+	"wzedeejmbzgck"
+	"wzgwska"
+	"wzhww"
+	"wzisqyfzcicvq"
+	"wzjpz"
+	"wzjwwjxqaidtbx"
+	"wzjzgeonyxp"
+	"wzkhcdnxnuu"
+	"wzl"
+	"wzljl"
+	"wzlundlncjuz"
+	"wznfdfsdxofea"
+	"wzonwrr"
+	"wzorq"
+	"wzpfsqzyvdh"
+	"wzpv"
+	"wztzfndp"
+	"wzugyhv"
+	"wzwe"
+	"wzwjgex"
+	"wzy"
+	"wzyck"
+	"xa"
+	"xaakcv"
+	"xaalzzucyeghc"
+	"xaaplzbjfc"
+	"xacbtqvke"
+	"xafan"
+	"xafjpc"
+	"xahftwbiw"
+	"xahubwlcvkab"
+	"xaigmpjo"
+	"xaiujnwztjq"
+	"xajmmcsevxdq"
+	"xakfekhnsfwp"
+	"xalan"
+	"xanjihkow"
+	"xapshy"
+	"xapzhyoepoufb"
+	"xaq"
+	"xaqbqkcwlenpz"
+	"xaqnb"
+	"xarahgpwgxuxi"
+	"xarnmuxp"
+	"xasambocoejrt"
+	"xatfnewfhpgfae"
+	"xavcvzigbtdeou"
+	"xawluiqvixtb"
+	"xaxpzoyxiwnrwz"
+	"xaxzabw"
+	"xaz"
+	"xazqyqes"
+	"xb"
+	"xbbadjod"
+	"xbbzq"
+	"xbcldmshaejmvl"
+	"xbcsbubsla"
+	"xbdhidemkc"
+	"xbf"
+	"xbfrmzvvp"
+	"xbgiekytgvvb"
+	"xbhiauqxn"
+	"xbjmakkjsz"
+	"xbjoqwluae"
+	"xbkrnpdpyqtwh"
+	"xblil"
+	"xblpshzzxcxfh"
+	"xbmgzfl"
+	"xbnervga"
+	"xbogecpuxxvb"
+	"xbpapytbmb"
+	"xbqpiximcgyr"
+	"xbrjjcwyss"
+	"xbrofdxewafwoz"
+	"xbs"
+	"xbt"
+	"xbtdzgmtkwf"
+	"xbu"
+	"xbwcmyp"
+	"xbxqvuy"
+	"xbykkowlsoik"
+	"xbyrgxgwgjfo"
+	"xbzoaqvhjfnwzz"
+	"xc"
+	"xcapjznz"
+	"xcapxdbtz"
+	"xcb"
+	"xccbwknwssjxxb"
+	"xcdrsgsnvywbz"
+	"xcduhzygoq"
+	"xcf"
+	"xcffvljzgtjgao"
+	"xcfgg"
+	"xcfmfjyt"
+	"xcfmlcazsphcan"
+	"xcgl"
+	"xchqrtzzit"
+	"xcjjlhkbadkzeh"
+	"xck"
+	"xckwzssurnlvvv"
+	"xcnyhz"
+	"xcoy"
+	"xcpb"
+	"xcpcrysnrzwli"
+	"xcrellfjpxtmp"
+	"xctffrk"
+	"xcthulyruswrq"
+	"xcuknemlyqsp"
+	"xcv"
+	"xcvcpae"
+	"xcw"
+	"xcwtmgrushop"
+	"xcxack"
+	"xcytvoyyo"
+	"xczhz"
+	"xczvbm"
+	"xd"
+	"xdbbnzgsuid"
+	"xdbg"
+	"xdbnr"
+	"xdcb"
+	"xdcqgqbf"
+	"xdczzxhjwiqnh"
+	"xddkltyp"
+	"xde"
+	"xdetyf"
+	"xdiy"
+	"xdj"
+	"xdjymyohm"
+	"xdkpqyc"
+	"xdlal"
+	"xdllyftpf"
+	"xdlqgymm"
+	"xdmlhwfk"
+	"xdn"
+	"xdnke"
+	"xdosvth"
+	"xdowlcoxus"
+	"xdp"
+	"xdrcnuk"
+	"xdrs"
+	"xdtcwgiedo"
+	"xdustsjhbgaev"
+	"xduwgyp"
+	"xduwmvohjw"
+	"xdvapwxujdrmd"
+	"xdvzzjq"
+	"xdw"
+	"xdwmxmvlqqli"
+	"xebrrrsoysm"
+	"xecihwisfon"
+	"xedinlt"
+	"xef"
+	"xefgqquqfivymy"
+	"xehg"
+	"xehh"
+	"xehhjznbkeqd"
+	"xeiaxdcpfd"
+	"xeiqkrtsf"
+	"xeizmzd"
+	"xek"
+	"xekllwluzyxmt"
+	"xel"
+	"xelhnuiyil"
+	"xemno"
+	"xencn"
+	"xenzmguajtyr"
+	"xeorvh"
+	"xepzpbbgxopqtg"
+	"xeslethm"
+	"xeuu"
+	"xevnynnycojq"
+	"xex"
+	"xexbgfhevh"
+	"xexcbigmctnns"
+	"xezvegubzfsbt"
+	"xf"
+	"xfacntbrgrnl"
+	"xfamcepl"
+	"xfbahpydqivgk"
+	"xfbj"
+	"xfbseyyfom"
+	"xfbtf"
+	"xfcpde"
+	"xfcr"
+	"xfctssmtcjh"
+	"xfgnkre"
+	"xfhcpkxrdb"
+	"xfhjwel"
+	"xfhvdgdgxuhbn"
+	"xfiggq"
+	"xfikapas"
+	"xfilso"
+	"xfitrdz"
+	"xfkz"
+	"xflnxh"
+	"xfmd"
+	"xfnccxpcmwynnx"
+	"xfnwc"
+	"xfnyhqq"
+	"xfoha"
+	"xfon"
+	"xfp"
+	"xfpitjns"
+	"xfq"
+	"xfrbwswv"
+	"xfsosxetioqf"
+	"xftedtttqxmq"
+	"xftse"
+	"xfugdf"
+	"xfuymsvviw"
+	"xfw"
+	"xfxnbzntwjb"
+	"xfydxcbfclb"
+	"xgai"
+	"xgbncbgaqru"
+	"xgbxigdo"
+	"xgbzim"
+	"xgcnwvhugn"
+	"xgcyowyoft"
+	"xgdwxgqkwzm"
+	"xgeo"
+	"xgeuotgosx"
+	"xgiyxqak"
+	"xgjp"
+	"xgksv"
+	"xglavappo"
+	"xglqhrh"
+	"xglyubvznz"
+	"xguyl"
+	"xgvbhj"
+	"xgxjbhglbxfh"
+	"xgzxaxvqsxu"
+	"xh"
+	"xhadfauda"
+	"xhbtsejdvzxnkt"
+	"xhdnzcpji"
+	"xhdthu"
+	"xhehwvs"
+	"xhfhiyjwybmyx"
+	"xhfkntz"
+	"xhgkziry"
+	"xhgwersmeswefl"
+	"xhgyutnsvwwuue"
+	"xhioratppdmo"
+	"xhjxhnfna"
+	"xhkfrf"
+	"xhkkuzf"
+	"xhlbynzbpn"
+	"xhlgpir"
+	"xhlnrw"
+	"xhlqyiro"
+	"xhmbbcmebdevpo"
+	"xhpxmaqid"
+	"xhqamztxwkdrg"
+	"xhqxmhl"
+	"xhrkvkhahizcbe"
+	"xhsejouyqrswx"
+	"xhssma"
+	"xhstpjfldtlgt"
+	"xhszytwer"
+	"xhuehz"
+	"xhukviawjwsbi"
+	"xhvdyu"
+	"xhweizrxpmqjbk"
+	"xhxcnvczplspsz"
+	"xhxnanmn"
+	"xhyjmrt"
+	"xhzbbicxjydaxc"
+	"xhzpvofdbvjt"
+	"xiamxqmeftidn"
+	"xiaprbdhxo"
+	"xices"
+	"xicszmmia"
+	"xid"
+	"xidezqoctwxf"
+	"xidhgchgtso"
+	"xidr"
+	"xiex"
+	"xieznwozknk"
+	"xifwld"
+	"xifwwiubcjpvr"
+	"xiimov"
+	"xiivpstljwje"
+	"xijnb"
+	"xildjzo"
+	"xilfvrdqry"
+	"xilfwsznogckw"
+	"ximftmrcb"
+	"ximtquhr"
+	"ximzqznqvx"
+	"xipx"
+	"xiq"
+	"xiquhygrvad"
+	"xiqvc"
+	"xiqx"
+	"xirbcxeblv"
+	"xit"
+	"xiuzhdbj"
+	"xivfmyfdr"
+	"xivg"
+	"xivry"
+	"xiztf"
+	"xj"
+	"xjbqyzddg"
+	"xjbzscdyu"
+	"xjcsp"
+	"xjcxvjnisucvkx"
+	"xjd"
+	"xjdunrrxirw"
+	"xjebp"
+	"xjetx"
+	"xjfaeonmdy"
+	"xjfavul"
+	"xjfjjfrtiobdvb"
+	"xjhrkib"
+	"xjhxmeat"
+	"xjkffb"
+	"xjkopmotjpvii"
+	"xjltlsrq"
+	"xjme"
+	"xjmmnstgk"
+	"xjnfu"
+	"xjoguurvqkvina"
+	"xjpcusfts"
+	"xjqdysjfbsd"
+	"xjqmyfswvdv"
+	"xjqu"
+	"xjsgtb"
+	"xjt"
+	"xjtav"
+	"xjtuclkydmz"
+	"xjwfmdhlzo"
+	"xjwhpmoxdceo"
+	"xjygvnoaieykp"
+	"xjzlhkdhls"
+	"xjznu"
+	"xk"
+	"xkaygjghzprzyx"
+	"xkbipdy"
+	"xkbrpgyriefo"
+	"xkcof"
+	"xkddhgrckge"
+	"xkdkjumlxbtun"
+	"xkg"
+	"xkh"
+	"xkhbqttquxu"
+	"xkhgeesq"
+	"xkhordfdalph"
+	"xkhylrbydunuu"
+	"xkiqetn"
+	"xkiscfaromniud"
+	"xkjiflvqxxlc"
+	"xklwijjmhzrgch"
+	"xkmad"
+	"xknukerxtehov"
+	"xkomtkf"
+	"xkpn"
+	"xkprdteebkk"
+	"xkqjcvctjakzu"
+	"xkqpkmrb"
+	"xkvezxhbfbck"
+	"xkvmkavmnn"
+	"xkvnittpeo"
+	"xkxslbekkejynr"
+	"xkydodrwyqm"
+	"xkynzkrdva"
+	"xkyqxucvqiyyll"
+	"xkywmsxtslzp"
+	"xkzhswcyedcff"
+	"xl"
+	"xlazthazvwo"
+	"xlcsaznmpjsef"
+	"xlcxcmjoyba"
+	"xldnmbdtbdozb"
+	"xlftyvsfbtx"
+	"xlge"
+	"xljsrxvktta"
+	"xlnoyptqia"
+	"xlokulv"
+	"xlooun"
+	"xlqbxf"
+	"xlqsj"
+	"xlqvlidstx"
+	"xlrgbaekm"
+	"xlsjlyhmnsnpbm"
+	"xlsukyqtefd"
+	"xltgamybcptx"
+	"xluv"
+	"xlvecdir"
+	"xlwlgadumst"
+	"xlxnzqor"
+	"xlyuwjjjtzy"
+	"xlzfbhvbqqjsf"
+	"xlzpqirrekj"
+	"xm"
+	"xmayfdrqbxd"
+	"xmc"
+	"xmceztio"
+	"xmcokiubutbdrg"
+	"xmeskixmxkeaa"
+	"xmf"
+	"xmfblfkiv"
+	"xmfggqevy"
+	"xmhqfljfuwiema"
+	"xmkgtikvaafuv"
+	"xmksayqljfynl"
+	"xmkxblihwmllb"
+	"xmlvnmbci"
+	"xmmdlejxr"
+	"xmmeb"
+	"xmmywkso"
+	"xmncpm"
+	"xmnqgu"
+	"xmoruwemcqbf"
+	"xmpdcj"
+	"xmrny"
+	"xmrzocwbb"
+	"xmsx"
+	"xmvhcegke"
+	"xmwpmfqh"
+	"xmyyjubumtqo"
+	"xn"
+	"xnccxvrcbp"
+	"xnczksy"
+	"xndgsotgprj"
+	"xndxylksmetsmb"
+	"xnehoqb"
+	"xnepbnk"
+	"xnhy"
+	"xnhychuu"
+	"xnkd"
+	"xnlkbjnhixidw"
+	"xnlqcmfa"
+	"xnlwhplbcyt"
+	"xnmeudipfwzwbr"
+	"xnmjd"
+	"xnnhhamswh"
+	"xnnvhpasdybvrq"
+	"xnojuwypct"
+	"xnooovt"
+	"xnoz"
+	"xnpdmohzcgd"
+	"xnplpfyrug"
+	"xnqimcv"
+	"xnrapsilwyuae"
+	"xnrjqgdmkpecb"
+	"xns"
+	"xnsrifgm"
+	"xntxkuwe"
+	"xnudlvtxojivi"
+	"xnvzuzuvwbcl"
+	"xnwgsbstsykxb"
+	"xnwkzhw"
+	"xnwugwslvkpa"
+	"xnxkwzme"
+	"xnyiypk"
+	"xnywq"
+	"xo"
+	"xoakhd"
+	"xoapoxfgjlst"
+	"xob"
+	"xoc"
+	"xocxgfmiererr"
+	"xodvst"
+	"xoejobe"
+	"xoeykz"
+	"xohtkktkdejz"
+	"xoirnhq"
+	"xojhysjvwylpqk"
+	"xojum"
+	"xok"
+	"xokpzi"
+	"xoljbrpfijnjo"
+	"xomdfr"
+	"xopfasuoipzxsy"
+	"xopfruqhwbf"
+	"xopje"
+	"xoqddr"
+	"xoqk"
+	"xoraceaxrvba"
+	"xordbzfzjws"
+	"xorkdb"
+	"xorqamfp"
+	"xosh"
+	"xoti"
+	"xotoredmgxh"
+	"xotylgkyz"
+	"xougyg"
+	"xouuhfrsge"
+	"xowazitgy"
+	"xowbqp"
+	"xoyaut"
+	"xoybsqysmmmqo"
+	"xp"
+	"xpacsdppf"
+	"xpbtgmwxpdbmil"
+	"xpc"
+	"xpcitdvlnzs"
+	"xpczjfwoicy"
+	"xpdcwrryiivc"
+	"xpdel"
+	"xpe"
+	"xpfjw"
+	"xphkkjdzqnatag"
+	"xphubteccpnkc"
+	"xpjpwrg"
+	"xpkkno"
+	"xpl"
+	"xplnyzubqq"
+	"xplpuyvxg"
+	"xplwdokahj"
+	"xplwthn"
+	"xpocfiqaznjsrs"
+	"xppuvirxycctnv"
+	"xppwjnitlah"
+	"xpqxzusxjxx"
+	"xprgklbe"
+	"xprjslmmt"
+	"xpspoyzayeixnh"
+	"xptjewzwlw"
+	"xpvtlsgwri"
+	"xpwjtqje"
+	"xpxgizdbcdtr"
+	"xpzgedvolcmqp"
+	"xpzyoxiyt"
+	"xq"
+	"xqakxrhwvjafjw"
+	"xqdmdbxk"
+	"xqff"
+	"xqgarknthnmq"
+	"xqgsizvtjrdhnb"
+	"xqif"
+	"xqirudrnpavop"
+	"xqjqxi"
+	"xqlnurkbrz"
+	"xqmnojdvnmk"
+	"xqmylewbzfzo"
+	"xqnkwzijev"
+	"xqohhpfmkjucs"
+	"xqqaymtwaxtkol"
+	"xqsxeqdcjtl"
+	"xqtakhbambzp"
+	"xquagmnqckmckf"
+	"xqubuwebsu"
+	"xqvpiuyjl"
+	"xqvqjk"
+	"xqwgtqkxcfdnnr"
+	"xqwpvsmf"
+	"xqxhvismphthd"
+	"xqxkpkjm"
+	"xqxtxi"
+	"xqxzjijjyidta"
+	"xqzd"
+	"xr"
+	"xranckeff"
+	"xrc"
+	"xrfpi"
+	"xrgquxyfmphi"
+	"xrhoddqa"
+	"xrjjgaiu"
+	"xrkpjrz"
+	"xrkrgxyiffuro"
+	"xrl"
+	"xrlaf"
+	"xrne"
+	"xrnuwxqse"
+	"xrowz"
+	"xrpcfxkxofby"
+	"xrpmequgb"
+	"xrq"
+	"xrqiuntdek"
+	"xrqlwte"
+	"xrqmtsyyyaus"
+	"xrrvfjyuxjiqq"
+	"xrshbm"
+	"xrsx"
+	"xrtznuusckork"
+	"xruunczeoq"
+	"xrwj"
+	"xrxa"
+	"xryk"
+	"xrynuihlvhqoc"
+	"xrynwhscjeo"
+	"xrysmwzpwfw"
+	"xrzgllbl"
+	"xs"
+	"xsa"
+	"xsd"
+	"xsdtx"
+	"xsejvabpnqrte"
+	"xsems"
+	"xsfiilr"
+	"xsfmurezzd"
+	"xsg"
+	"xsgp"
+	"xsgyuuvjjynjch"
+	"xshfcbblszk"
+	"xsiis"
+	"xsjtydgz"
+	"xskfz"
+	"xskn"
+	"xsmf"
+	"xsn"
+	"xspmddvlop"
+	"xspnccb"
+	"xspqdu"
+	"xspqhbiima"
+	"xsrbtyxrrzchwr"
+	"xsvmhadn"
+	"xswlhidfgslp"
+	"xsxojlhpet"
+	"xsyd"
+	"xszidnq"
+	"xt"
+	"xtbjqpeu"
+	"xtbzdrvi"
+	"xtdyxsllpmqdj"
+	"xtekaxfvmm"
+	"xtemqh"
+	"xtemtrsyvakmr"
+	"xtepbnowaa"
+	"xtie"
+	"xtkck"
+	"xtkzf"
+	"xtmmxfziz"
+	"xtoe"
+	"xtqjhrwnooqrjf"
+	"xtqr"
+	"xtqrin"
+	"xtqv"
+	"xtsqpnkkcjxie"
+	"xtvo"
+	"xtvwjxg"
+	"xtwcpriluiqh"
+	"xtxbanjade"
+	"xtxyavgnf"
+	"xtz"
+	"xtzshpvzxxd"
+	"xtzuwpt"
+	"xu"
+	"xuab"
+	"xualidhfhh"
+	"xudoiltputo"
+	"xuefzammr"
+	"xuehldduyi"
+	"xueugjutorto"
+	"xufn"
+	"xuguerogtjnkm"
+	"xuh"
+	"xukztocaaaort"
+	"xunb"
+	"xunjxkcjtwennx"
+	"xunpcq"
+	"xunpugdgtis"
+	"xuoezhqjhl"
+	"xuoj"
+	"xur"
+	"xusgwwf"
+	"xusmwbiktdn"
+	"xuvfbe"
+	"xuvgycsvfxc"
+	"xuvpb"
+	"xuwwzekvg"
+	"xuyjvppobmlj"
+	"xuykapilqiio"
+	"xuymundivzunf"
+	"xuzwhguim"
+	"xv"
+	"xvaldnecwnhv"
+	"xvbfodxpw"
+	"xvcxoycygxgzea"
+	"xvdzjazeqap"
+	"xvewqleoow"
+	"xveyeawhacqupv"
+	"xvfaqqg"
+	"xvfzuzsv"
+	"xvgbbn"
+	"xvghqmpxspq"
+	"xvgrwndvb"
+	"xvhcqehutrufsg"
+	"xvhugyd"
+	"xvkaucrds"
+	"xvlck"
+	"xvlgmzurmpcmp"
+	"xvmqubqspxxdh"
+	"xvn"
+	"xvnyuexil"
+	"xvocucf"
+	"xvodljlmxpapbj"
+	"xvpadajfdo"
+	"xvpfudz"
+	"xvpwdmubgdqjk"
+	"xvsmrui"
+	"xvucypftjotkzq"
+	"xvukvsjl"
+	"xvut"
+	"xvuufmbim"
+	"xvwde"
+	"xvyhxer"
+	"xvyicjo"
+	"xvymurr"
+	"xw"
+	"xwadgtxtjytcpj"
+	"xwcoyhmqbikc"
+	"xwewshg"
+	"xwfk"
+	"xwfsiet"
+	"xwgbpymvcc"
+	"xwgwclpzzdgzex"
+	"xwhn"
+	"xwi"
+	"xwjsho"
+	"xwjusm"
+	"xwjw"
+	"xwkaqpvokajsn"
+	"xwlfattz"
+	"xwncc"
+	"xwoqfemmevg"
+	"xwqmo"
+	"xwrfejxjdc"
+	"xwrq"
+	"xwsg"
+	"xwsrru"
+	"xwvecmbaecx"
+	"xwvfafqtul"
+	"xwvktealyfhhwp"
+	"xwxcpxhuuju"
+	"xwxewaewykpkd"
+	"xwzjvixlljnm"
+	"xx"
+	"xxbcw"
+	"xxbmhv"
+	"xxbyx"
+	"xxcnzo"
+	"xxcvvxgjivd"
+	"xxdeb"
+	"xxdi"
+	"xxfqmo"
+	"xxgzldedlej"
+	"xxit"
+	"xxjawwpc"
+	"xxjljixy"
+	"xxjsb"
+	"xxkxblqof"
+	"xxmhvtiyckcdn"
+	"xxnbzmgitc"
+	"xxnojwyh"
+	"xxnsgbttk"
+	"xxntnzkxfo"
+	"xxnuelmhy"
+	"xxo"
+	"xxoosptbtpjke"
+	"xxpeody"
+	"xxqdun"
+	"xxsxcxzbbdwi"
+	"xxudaxxxs"
+	"xxv"
+	"xxvex"
+	"xxvihh"
+	"xxwsxnzfrz"
+	"xxxkjhugmr"
+	"xxyop"
+	"xxyrfbw"
+	"xxyrh"
+	"xy"
+	"xybbmkoxygb"
+	"xybdnglz"
+	"xyd"
+	"xyefsiyeimhkmb"
+	"xyegd"
+	"xyfj"
+	"xyizricymbsr"
+	"xyjah"
+	"xymppxb"
+	"xynbdepodvfav"
+	"xyojipyhkgvqrr"
+	"xyrxa"
+	"xytetjayqswfo"
+	"xytiztbi"
+	"xytnlmgpflbjdb"
+	"xytssr"
+	"xyvamzs"
+	"xyvki"
+	"xywfsttyfpzqp"
+	"xywqldoi"
+	"xyx"
+	"xyxecclajlu"
+	"xyymfcixmwoubu"
+	"xyyoxidrr"
+	"xyzraqjxnfmn"
+	"xzafmitufghw"
+	"xzaqktv"
+	"xzatomr"
+	"xzb"
+	"xzcqqvft"
+	"xze"
+	"xzeyrobcp"
+	"xzffsb"
+	"xzfldskocwq"
+	"xzfxogjyzp"
+	"xzghvwlztxugf"
+	"xzjdlwg"
+	"xzlczju"
+	"xznuuxdap"
+	"xznuycss"
+	"xzo"
+	"xzqy"
+	"xzs"
+	"xzsvtgu"
+	"xztvndx"
+	"xzuefjtocaiyu"
+	"xzuglocxy"
+	"xzvdak"
+	"xzxwsrngxnvl"
+	"xzzf"
+	"xzzg"
+	"ya"
+	"yaaskquyagc"
+	"yacdczqxhqy"
+	"yacxisar"
+	"yaetf"
+	"yafkitnyyak"
+	"yahcgni"
+	"yahxnmmwcqib"
+	"yalukwtcz"
+	"yanta"
+	"yaqatt"
+	"yaqmug"
+	"yaqqb"
+	"yarbmexgcp"
+	"yaritsjxu"
+	"yas"
+	"yatagnbbaj"
+	"yatoeyym"
+	"yaub"
+	"yavceiys"
+	"yawoixzhsdkaaa"
+	"yawqe"
+	"yawsuthzjaoopy"
+	"yaxmyabpij"
+	"yaxn"
+	"yaxq"
+	"yayyokm"
+	"yayyxxhfujbdh"
+	"yaz"
+	"yazmwder"
+	"yazumrsdoimq"
+	"yazylcvbnay"
+	"yb"
+	"ybazcb"
+	"ybcjg"
+	"ybcq"
+	"ybcrkj"
+	"ybdgxiscolxfbj"
+	"ybdz"
+	"ybedlipulmqesy"
+	"ybfcrptkcwjnjo"
+	"ybhdg"
+	"ybhspqsxo"
+	"ybkkh"
+	"ybnwsfncowvqhd"
+	"ybpvclg"
+	"ybqhj"
+	"ybqtpmdfmf"
+	"ybrntncfpjcrqp"
+	"ybti"
+	"ybunmzyglrmxm"
+	"ybwgqu"
+	"ybx"
+	"ybykcrd"
+	"ybykljtsvnbibn"
+	"yc"
+	"ycb"
+	"ycbfxqgyri"
+	"ycckn"
+	"ycf"
+	"yciblcghdasq"
+	"ycjjufjbminigy"
+	"ycjvcjibxccfek"
+	"yckoooru"
+	"yclerewy"
+	"yclfyzmhwcqirs"
+	"yclwzfrk"
+	"yclyoltwzzh"
+	"ycmsfg"
+	"ycmw"
+	"ycnjcpgf"
+	"ycnvy"
+	"ycp"
+	"ycrrijmjmm"
+	"yctkuyeqraul"
+	"yctnvypz"
+	"yd"
+	"ydawlrkvte"
+	"ydbdxokxfa"
+	"ydbglcmstgvkm"
+	"ydcayhukhx"
+	"ydcfpezwu"
+	"ydcnvfkls"
+	"ydeckvoveme"
+	"ydfguljrgbo"
+	"ydftpzr"
+	"ydhhjtuhids"
+	"ydhrxadqgi"
+	"ydmltollxydnez"
+	"ydmnr"
+	"ydoetejbfgv"
+	"ydoj"
+	"ydpcitxxtcmysn"
+	"ydqrch"
+	"ydqtqagwbpci"
+	"ydqwcohkboxpts"
+	"ydqzgm"
+	"ydskldhgy"
+	"yduqdanbqs"
+	"ydxemb"
+	"ydybobhqi"
+	"ydysymjgcitmn"
+	"ydzxbekag"
+	"ye"
+	"yeaplreuuceivn"
+	"yeb"
+	"yebjr"
+	"yebnesvbztcplq"
+	"yebuiqwthq"
+	"yeeohkse"
+	"yeermurzrhiwhj"
+	"yeh"
+	"yeiruxvuamz"
+	"yejcu"
+	"yekang"
+	"yeksad"
+	"yelbyczwm"
+	"yelfg"
+	"yemishw"
+	"yemjurnpkzfc"
+	"yemtuq"
+	"yepat"
+	"yeqf"
+	"yeqz"
+	"yerdkg"
+	"yesewd"
+	"yesw"
+	"yeuernaeev"
+	"yeutmayzgtaka"
+	"yevrqeelcu"
+	"yewho"
+	"yewo"
+	"yexhphxqw"
+	"yexuyjntnf"
+	"yexzcjzdhqgwfs"
+	"yeybsuxcvfevun"
+	"yeyzslc"
+	"yf"
+	"yfanoy"
+	"yfc"
+	"yffug"
+	"yfhnplh"
+	"yfho"
+	"yfirqgebjuno"
+	"yfjgmcr"
+	"yfkctohjxrn"
+	"yfkdtwqlcmdhnj"
+	"yfkfuuf"
+	"yfkgzowosey"
+	"yfn"
+	"yfqhuuff"
+	"yfqqioge"
+	"yfqudiq"
+	"yfqwgsmlgtnfwg"
+	"yfupksezjpyov"
+	"yfutejzg"
+	"yfvracqtlrh"
+	"yfx"
+	"yfxhoiakvf"
+	"yfxkfcurthv"
+	"yfxwebrwuhfafn"
+	"yfyvlcdo"
+	"yfzpbefjmxnmg"
+	"yg"
+	"ygaczzqko"
+	"ygaf"
+	"ygcoubp"
+	"ygdhaot"
+	"ygeg"
+	"yggjkdzdkyq"
+	"yggznx"
+	"ygix"
+	"yglh"
+	"ygnyzlmrycoyo"
+	"ygoaguoamca"
+	"ygodrrnjihpp"
+	"ygogq"
+	"ygphewqye"
+	"ygqefxkxw"
+	"ygqtowyan"
+	"ygsv"
+	"ygtckroopgnb"
+	"yguxrptcwwzr"
+	"yh"
+	"yha"
+	"yhaqox"
+	"yhauawcmex"
+	"yhbxpmsv"
+	"yhbxuzyss"
+	"yhenc"
+	"yhfzla"
+	"yhgmvae"
+	"yhgqs"
+	"yhimfv"
+	"yhjaxuhc"
+	"yhjdebxnc"
+	"yhjzmoibyejpvq"
+	"yhlxqbulvdfaa"
+	"yhmbkqxvfd"
+	"yhnfepidpkor"
+	"yhnrweseige"
+	"yhosjnfdc"
+	"yhpfg"
+	"yhrgp"
+	"yhsqyzn"
+	"yhssz"
+	"yhtafixclcd"
+	"yhtdokehfpdh"
+	"yhutkokxfihok"
+	"yhxop"
+	"yhztufqqpv"
+	"yi"
+	"yiaawai"
+	"yiaclbwrgnzs"
+	"yiap"
+	"yicwovxwunt"
+	"yidcojkeppxp"
+	"yidelcvdoi"
+	"yidgsgin"
+	"yidokkq"
+	"yifejiqrir"
+	"yifestrrcacfkh"
+	"yigougavjo"
+	"yijjagnzzehxk"
+	"yik"
+	"yindffb"
+	"yiohmuqwwhwp"
+	"yipfqkhtudly"
+	"yiqomfoylltutn"
+	"yirr"
+	"yirrxc"
+	"yiskj"
+	"yitdch"
+	"yiuc"
+	"yiuxtxjv"
+	"yiuzdbkketjh"
+	"yiynamyfbt"
+	"yiyogkhbifmzsc"
+	"yiywaqjnwbbk"
+	"yizqkvyciqt"
+	"yj"
+	"yjbecpvhmqe"
+	"yjezjrrqgy"
+	"yjfdpfo"
+	"yjffwoz"
+	"yjftndmicr"
+	"yjivfeujux"
+	"yjiztanl"
+	"yjjhvmx"
+	"yjjiqzxvyu"
+	"yjkf"
+	"yjkz"
+	"yjlauyh"
+	"yjluljkd"
+	"yjlvtofipztmnn"
+	"yjm"
+	"yjobuovvbfsqe"
+	"yjpbcp"
+	"yjq"
+	"yjqsssqqmgafcn"
+	"yjrqnspaxfhin"
+	"yjs"
+	"yjt"
+	"yjtrori"
+	"yjuiwdelonkzy"
+	"yjuk"
+	"yjuyqctzo"
+	"yjvcidccsvvdq"
+	"yjvouv"
+	"yjvowmssga"
+	"yjwkzbqpoaer"
+	"yjyh"
+	"yjzat"
+	"yjzcnzeqbko"
+	"yk"
+	"ykawrvuel"
+	"ykbwplfvvgkyoo"
+	"ykcyr"
+	"ykd"
+	"ykevkytdd"
+	"ykfdto"
+	"ykfgeauopbtvu"
+	"ykfhjkcrprd"
+	"ykfneanaqz"
+	"ykg"
+	"ykih"
+	"ykix"
+	"ykixagakpqg"
+	"ykljfezmomdtei"
+	"yklzpetgng"
+	"ykmksrbmoqr"
+	"ykmozdple"
+	"ykpatkpce"
+	"ykpzpp"
+	"ykrrezdpvuv"
+	"ykruxoo"
+	"ykwo"
+	"ykzfmezgxv"
+	"ykzoyfxwa"
+	"yl"
+	"ylckjqu"
+	"ylcpi"
+	"yldiwauyvbdudu"
+	"yldxgok"
+	"yldzineb"
+	"yle"
+	"ylexfbdmipj"
+	"ylfbnmexs"
+	"ylfl"
+	"ylgfxu"
+	"ylh"
+	"ylhtyaxjdz"
+	"ylhwdpfdxjscze"
+	"ylkbcrzetr"
+	"ylkkeazmypt"
+	"ylm"
+	"ylmiyarhqfgfcy"
+	"ylmpqhcpx"
+	"ylnapcxuml"
+	"ylnbvgra"
+	"ylnkwmng"
+	"ylovgfgcajf"
+	"ylpcln"
+	"ylphnhopxmxa"
+	"ylpw"
+	"yltjrfuaprfl"
+	"yltobll"
+	"yludmuvyj"
+	"yluzwsk"
+	"ylxp"
+	"ylxpzvkjzgkb"
+	"ylybhlmskjdg"
+	"ylzjqajxfdkkc"
+	"ym"
+	"ymacln"
+	"ymat"
+	"ymcasllmdetyf"
+	"ymchoel"
+	"ymdgksgjy"
+	"ymgdaezhtmmt"
+	"ymghnqlvsmmu"
+	"ymgkvtxghbk"
+	"ymgqvmrf"
+	"ymgsqf"
+	"ymhxbcim"
+	"ymjhpqx"
+	"ymju"
+	"ymk"
+	"ymkkwquavz"
+	"ymkudxia"
+	"ymlcoeci"
+	"ymmrcuiifh"
+	"ymnddg"
+	"ymohrqfqhhezfu"
+	"ymp"
+	"ymqyrtykvf"
+	"ymrjsz"
+	"ymrmljjop"
+	"ymtpqefuxsl"
+	"ymttgeyokqi"
+	"ymtuktt"
+	"ymugyno"
+	"ymurbbsff"
+	"ymxrv"
+	"ymxwf"
+	"ymycrxnjajdgpd"
+	"ymyoagazy"
+	"ymywpvsbyg"
+	"ymzmdorta"
+	"yn"
+	"ynavyibv"
+	"ynbkm"
+	"ynbrolcwtisnae"
+	"ynemoqna"
+	"ynhfhitcsy"
+	"ynhmfdhjj"
+	"ynhshhqzgtx"
+	"yni"
+	"yniipisy"
+	"ynjwleev"
+	"ynkgvkjriqxxf"
+	"ynkgxyuyqrb"
+	"ynkxlykbusfvkv"
+	"ynlwgiuxatlbif"
+	"ynmhdpoubrpp"
+	"ynmo"
+	"ynnpzgzrxumfh"
+	"ynns"
+	"ynofakn"
+	"ynpwknzuy"
+	"ynqzx"
+	"ynsfqcobglkdeh"
+	"ynumvuasw"
+	"ynuwcfzwzahf"
+	"ynuwgpqqhlz"
+	"ynvhzxpvryx"
+	"ynxx"
+	"yny"
+	"ynyfsgaa"
+	"ynympwiuiowfmw"
+	"ynzbimiyduohd"
+	"yo"
+	"yoaishrrsybmc"
+	"yoashhywny"
+	"yobp"
+	"yocdwurdfw"
+	"yocoljr"
+	"yoeab"
+	"yofpudcpd"
+	"yofyvipx"
+	"yohwd"
+	"yoitbbz"
+	"yoiv"
+	"yojnbi"
+	"yojwwij"
+	"yokwgfcwpcvpv"
+	"yolclltgb"
+	"yolzktodoegwmd"
+	"yonlfjc"
+	"yonuyoy"
+	"yoo"
+	"yoovl"
+	"yoqsqmlm"
+	"yortvdbz"
+	"yoselgeap"
+	"youbdq"
+	"yovtpsa"
+	"yow"
+	"yoxvp"
+	"yozpx"
+	"yozvpvvdspsc"
+	"yp"
+	"ypatcpqmaql"
+	"ypay"
+	"ypdwjh"
+	"ypdxfvdyi"
+	"ypgdgnn"
+	"yphbhsmx"
+	"yphxxurulxpwhr"
+	"ypkrknppweqt"
+	"ypl"
+	"ypmuihkxfyf"
+	"ypmuoxwjqfrqj"
+	"ypnsdsf"
+	"ypnxvfutb"
+	"ypogwmuyxis"
+	"yppyra"
+	"ypqal"
+	"yprgkany"
+	"ypsyakx"
+	"ypudlkvrglbl"
+	"ypvurhpxgxzzl"
+	"ypxe"
+	"ypxhvvu"
+	"ypyklnnteetf"
+	"ypysize"
+	"ypyyzvayrh"
+	"yq"
+	"yqakb"
+	"yqczfrfef"
+	"yqdrg"
+	"yqfkwtd"
+	"yqfnv"
+	"yqgfdsiofn"
+	"yqgkyzmjdqyx"
+	"yqgxjmetwa"
+	"yqhlruemg"
+	"yqin"
+	"yqkjjvorhri"
+	"yqkt"
+	"yqlhq"
+	"yqljeq"
+	"yqodsjk"
+	"yqozzr"
+	"yqphyyfwcsh"
+	"yqptghfolouy"
+	"yqqrrokmd"
+	"yqru"
+	"yqrwnxiwpr"
+	"yqsbigxl"
+	"yqv"
+	"yqvxwjtaszi"
+	"yqwecuiet"
+	"yqwtduqhnxdthn"
+	"yqyapd"
+	"yqycgladgqcrwh"
+	"yqzkwqptktuw"
+	"yr"
+	"yrb"
+	"yrchiprmvwh"
+	"yrezviwhdsy"
+	"yrgaapowenf"
+	"yrgi"
+	"yrgjghcd"
+	"yrgssgq"
+	"yrirqsktthccpq"
+	"yrjdvtxgk"
+	"yrknaue"
+	"yrljf"
+	"yrmxwohfqdbjog"
+	"yrnpxnbhjse"
+	"yroibn"
+	"yroump"
+	"yrsoou"
+	"yrvnuabwkekj"
+	"yrvvafijl"
+	"yrwpsrjnyi"
+	"yrwttk"
+	"yrx"
+	"yrxr"
+	"ys"
+	"ysacjlb"
+	"ysas"
+	"ysavamzuuc"
+	"ysbtfelfknp"
+	"yscabqzphqqjj"
+	"ysdqxtkygjije"
+	"ysf"
+	"ysfikcgpqms"
+	"ysgwgkgjpgsi"
+	"ysiqsqveag"
+	"ysjc"
+	"yskjwb"
+	"yskrgstnyayt"
+	"yslzlqdk"
+	"ysm"
+	"ysmglpjcve"
+	"ysnkjkzlhoulml"
+	"ysp"
+	"ysqpvoggpve"
+	"ysrnvrccpnrfxs"
+	"yssevsixfqo"
+	"ysswq"
+	"ystowfnfgj"
+	"ysvcrt"
+	"ysvr"
+	"yswixdayryq"
+	"yswpog"
+	"yswxdnzpekg"
+	"ysx"
+	"ysxhhseq"
+	"yt"
+	"ytaakhicsvmdks"
+	"ytbnbqdfict"
+	"ytboxyodovwj"
+	"ytf"
+	"ytfufxqpw"
+	"ytgkpxjaxedrne"
+	"ytgpyanuwtpht"
+	"ythssygbs"
+	"ythtxr"
+	"ythw"
+	"yti"
+	"ytjbbkzinidop"
+	"ytjsdzjowts"
+	"ytjyfrxsdp"
+	"ytkesfnvjw"
+	"ytkpndbwp"
+	"ytlbzthjwibu"
+	"ytnvsmb"
+	"ytqb"
+	"ytrcu"
+	"ytrlqofkj"
+	"ytrurfh"
+	"ytueyfmqmqhekl"
+	"ytvkwhptrn"
+	"ytvv"
+	"ytwggcvf"
+	"ytxjzeywywgwu"
+	"ytzgyhzh"
+	"ytznmbvbnyzxsy"
+	"ytzyfbxy"
+	"yuahbtefzd"
+	"yuculnwroyvvru"
+	"yuczoux"
+	"yuhjacepd"
+	"yujidwd"
+	"yukontktdegqls"
+	"yumt"
+	"yup"
+	"yuqmrqxl"
+	"yurefwslic"
+	"yusyvuxvox"
+	"yuszicnyrzazsi"
+	"yuuglsfs"
+	"yuuvssejjep"
+	"yuv"
+	"yuxpabp"
+	"yuyrpwtj"
+	"yuywsnnmj"
+	"yuzoxgokgt"
+	"yvaczmrz"
+	"yvbsejvvbdqyk"
+	"yvbuy"
+	"yvdbqjnkjnrdar"
+	"yvdtty"
+	"yvdvslx"
+	"yvefgrxuev"
+	"yvehszxxz"
+	"yvejb"
+	"yvf"
+	"yvfdbehiybuaa"
+	"yvgthl"
+	"yvhvjsmcmy"
+	"yvjp"
+	"yvlxzqnzzpmqb"
+	"yvnfhzsyn"
+	"yvnnr"
+	"yvo"
+	"yvoddyjrtihf"
+	"yvpagmeocjala"
+	"yvpf"
+	"yvrrgep"
+	"yvrthl"
+	"yvscmkhhjyxz"
+	"yvsfazpjyfxs"
+	"yvsgkkixbaqch"
+	"yvtsqvd"
+	"yvukfawmcks"
+	"yvuqrh"
+	"yvuvuks"
+	"yvvcddywk"
+	"yvvvsp"
+	"yvwnmugmsuede"
+	"yvwnvrtm"
+	"yvwvxgl"
+	"yvxclcbpm"
+	"yvxlcovqdyfqm"
+	"yvytmwupioza"
+	"yvzesxzulygyuj"
+	"yw"
+	"ywbdn"
+	"ywc"
+	"ywcioncd"
+	"ywcnslfftdlfvp"
+	"ywdrou"
+	"ywewfu"
+	"ywfdlzpiahiqn"
+	"ywfmt"
+	"ywgxovbglzj"
+	"ywhmkboffz"
+	"ywjrnihdhay"
+	"ywksz"
+	"ywkyy"
+	"ywljcstfr"
+	"ywlrbhkmupj"
+	"ywmgwvguqdh"
+	"ywnjcytjlp"
+	"ywolrkwganxciv"
+	"ywqhe"
+	"ywqo"
+	"ywqpsgxjgz"
+	"ywtuovt"
+	"ywvs"
+	"ywvwzp"
+	"ywwjbhqvoxlb"
+	"ywxf"
+	"ywxocopkv"
+	"ywzbmmyag"
+	"yx"
+	"yxafpc"
+	"yxbce"
+	"yxbjkjqbkxv"
+	"yxbodbcryrhp"
+	"yxd"
+	"yxdefk"
+	"yxdnucdruink"
+	"yxej"
+	"yxgyvjm"
+	"yxhjucqcti"
+	"yxhqirca"
+	"yxipdp"
+	"yxkbeonwr"
+	"yxmnghtc"
+	"yxmyc"
+	"yxncth"
+	"yxohsvrl"
+	"yxoniarqzecpr"
+	"yxoquer"
+	"yxpr"
+	"yxpvqlnsfnilrh"
+	"yxqblvthbn"
+	"yxqpt"
+	"yxqptfcwmjrd"
+	"yxrn"
+	"yxsshyf"
+	"yxupskcwfogg"
+	"yxuuuifdmp"
+	"yxvayqjeouoi"
+	"yxwam"
+	"yxwl"
+	"yxx"
+	"yxxcopr"
+	"yxycugybfyyw"
+	"yxzswy"
+	"yy"
+	"yya"
+	"yyazea"
+	"yybgys"
+	"yyccpowyvnfluq"
+	"yycoszqnay"
+	"yyfcaxapv"
+	"yyg"
+	"yygcdquzprk"
+	"yyhchnzelzgcnl"
+	"yyis"
+	"yyjkqnsbcuee"
+	"yyldr"
+	"yyll"
+	"yymvmlnvgpaiuv"
+	"yynazejnkgohpk"
+	"yynnsm"
+	"yynrcqpmb"
+	"yysqibxwqnh"
+	"yyt"
+	"yythrfnqmp"
+	"yyx"
+	"yyxjmw"
+	"yyyukcsvmemysl"
+	"yz"
+	"yzajk"
+	"yzaoryoxhecphm"
+	"yzbhfpkixaxseb"
+	"yzbjhuyzfjhqur"
+	"yzbkimrhq"
+	"yzblbzxyi"
+	"yzbsrgxfkefwm"
+	"yzdecairfhefsq"
+	"yzdgaf"
+	"yzeixxy"
+	"yzekcajy"
+	"yzfpqeyve"
+	"yzfyvdgs"
+	"yzh"
+	"yzhfz"
+	"yzjd"
+	"yzjhlrigejn"
+	"yzjqj"
+	"yzju"
+	"yzkfjihonrfoh"
+	"yzlppe"
+	"yznho"
+	"yznilcleddh"
+	"yzomsgde"
+	"yzp"
+	"yzrwnz"
+	"yzrzasjmzhmhn"
+	"yzsdadnrcqdhvf"
+	"yzstcyhncvrma"
+	"yzsycknnirsyl"
+	"yztxsnwymn"
+	"yztzvmwoormv"
+	"yzufeti"
+	"yzv"
+	"yzvhzgdars"
+	"yzwv"
+	"yzxrtwpsolvoqp"
+	"yzxuq"
+	"yzzioqd"
+	"yzzomgancvwn"
+	"za"
+	"zabwdmizc"
+	"zad"
+	"zadwjrc"
+	"zaeaa"
+	"zaeufekzxmjkl"
+	"zagapms"
+	"zaglyrantfi"
+	"zagskwnnrscq"
+	"zahbf"
+	"zahp"
+	"zaimrkjld"
+	"zaiuujtxsqh"
+	"zak"
+	"zakjmff"
+	"zalgid"
+	"zalibneothy"
+	"zamcy"
+	"zamyrcnkbycomr"
+	"zanjzhzucoq"
+	"zanqd"
+	"zao"
+	"zaocpjtbm"
+	"zaowemnnosua"
+	"zapliizsszp"
+	"zapzewzt"
+	"zaqgtzcuzbsv"
+	"zarvgqwrkzr"
+	"zatgkxtu"
+	"zatkiqvghnehdm"
+	"zauvud"
+	"zavgudrjes"
+	"zavotyjyv"
+	"zaxypq"
+	"zaxyqsjnif"
+	"zaz"
+	"zazd"
+	"zaztoyaikk"
+	"zb"
+	"zbalpnwzfzvawj"
+	"zbamjv"
+	"zbb"
+	"zbclpngpkf"
+	"zbcufpxtiafv"
+	"zbe"
+	"zbelacuo"
+	"zbesxb"
+	"zbfpftl"
+	"zbg"
+	"zbgn"
+	"zbixjz"
+	"zbjclrsdql"
+	"zblco"
+	"zbneqgayghuilz"
+	"zbor"
+	"zbovmwxp"
+	"zbozkte"
+	"zbpslkspfsteki"
+	"zbqokyyarvpzx"
+	"zbrajlvsiqj"
+	"zbrqkhvspohdi"
+	"zbsouordibkz"
+	"zbsqaa"
+	"zbtdmc"
+	"zbtqhhbyjgufu"
+	"zbvviiem"
+	"zbxfdpuhzjhhhh"
+	"zbxyum"
+	"zbyqg"
+	"zbysyhzpc"
+	"zbytkorqymefzz"
+	"zbzionufraw"
+	"zc"
+	"zcc"
+	"zccezowufszst"
+	"zccgt"
+	"zcd"
+	"zcdcfjhbjtegzg"
+	"zcdtjdwoznowfj"
+	"zcehgkqgctlbvo"
+	"zcfnswb"
+	"zcg"
+	"zchddgjlkpzlj"
+	"zcizmutzt"
+	"zcjxtohxpcqi"
+	"zck"
+	"zcnstmsaaksmxb"
+	"zcobq"
+	"zcohqqrmhdf"
+	"zcomf"
+	"zcqjbgwgonyr"
+	"zcqqrdiu"
+	"zcr"
+	"zcrhhvi"
+	"zcriwp"
+	"zctd"
+	"zcyotqn"
+	"zczlwsccejfynz"
+	"zdahwvf"
+	"zdazzizbjlz"
+	"zdbhowvki"
+	"zdbulthyro"
+	"zdbvnecx"
+	"zdefjgfvoc"
+	"zdgl"
+	"zdhfrqox"
+	"zdijqk"
+	"zdjpnt"
+	"zdjuemyurij"
+	"zdjugxaslny"
+	"zdldnqlagvqyn"
+	"zdlt"
+	"zdoecehavhintd"
+	"zdoh"
+	"zdpsozbevn"
+	"zdqnja"
+	"zdsoq"
+	"zdszwgronxys"
+	"zdtrlk"
+	"zdu"
+	"zducctlhpv"
+	"zdwrixbfdkue"
+	"zdxgkfxkhnbsp"
+	"zdxsza"
+	"zdxtmqdhdpczj"
+	"zdyh"
+	"zdyhgxyokc"
+	"zdynukfoqz"
+	"zdzohrrk"
+	"ze"
+	"zeahprg"
+	"zebhaxp"
+	"zebjsmhwfgxm"
+	"zebvpbdp"
+	"zebz"
+	"zeckzifsioy"
+	"zecmzrmhmvu"
+	"zee"
+	"zeeqand"
+	"zeevdp"
+	"zef"
+	"zefol"
+	"zeft"
+	"zefwnzuhniu"
+	"zegnhz"
+	"zegtq"
+	"zegyyiu"
+	"zeiqwottnk"
+	"zeitjr"
+	"zeixmyirv"
+	"zej"
+	"zejvfqwczuhjw"
+	"zek"
+	"zekqggcbq"
+	"zekqszvbspxysm"
+	"zekrqzjhlw"
+	"zelkoh"
+	"zelsmuteeipmi"
+	"zelucbnmnuwsty"
+	"zemoy"
+	"zemuiybbq"
+	"zeogemouvbl"
+	"zepnwhjrsrkzi"
+	"zeqszfuwtn"
+	"zer"
+	"zerchiuqs"
+	"zesshdcxcoag"
+	"zeswm"
+	"zesxazq"
+	"zetkyhteoq"
+	"zeu"
+	"zewiecnpe"
+	"zewimheyedpv"
+	"zex"
+	"zexivbharjcctj"
+	"zeyemldodx"
+	"zezibpfycri"
+	"zf"
+	"zfahmihunuvgbz"
+	"zfary"
+	"zfffweclggnvwc"
+	"zffql"
+	"zfjrg"
+	"zfjtrs"
+	"zfmbtxfpd"
+	"zfmowwejhglcd"
+	"zfnbnqdsx"
+	"zfommotogh"
+	"zfoscibdauyl"
+	"zfphdgjrvqkps"
+	"zfqa"
+	"zfreeouf"
+	"zftogelot"
+	"zfv"
+	"zfvjhafo"
+	"zfwyzwd"
+	"zfxzzbohboqinx"
+	"zfyibkmlbubva"
+	"zfzmsrgtmy"
+	"zg"
+	"zgbn"
+	"zgcdhkmiazeip"
+	"zgdpamnt"
+	"zgfialojjulep"
+	"zggjmyo"
+	"zggzrnbvad"
+	"zgilaocfxov"
+	"zgipnjgnnlhbwt"
+	"zgj"
+	"zgjkx"
+	"zgjstvnvtifmk"
+	"zgknocibaje"
+	"zglpoqbmrpn"
+	"zgnlwd"
+	"zgntttxhxe"
+	"zgnzlkylj"
+	"zgoqcfmvtyyp"
+	"zgpdzcgwq"
+	"zgpileis"
+	"zgqohkktii"
+	"zgr"
+	"zgrjbivoa"
+	"zgsiy"
+	"zgtiaposs"
+	"zgtmhboaqqa"
+	"zgtocrsywv"
+	"zgvnpth"
+	"zgx"
+	"zh"
+	"zhbvexexrrfk"
+	"zhbwa"
+	"zhbwsc"
+	"zhcbonfvig"
+	"zhdalktmhbqdpz"
+	"zhe"
+	"zhfczxxn"
+	"zhfoegpbocnsco"
+	"zhhbhpuzvddgcl"
+	"zhhk"
+	"zhhmxsc"
+	"zhicsx"
+	"zhiswkjpjylhs"
+	"zhk"
+	"zhme"
+	"zhnujq"
+	"zhqxslmaqa"
+	"zhttsi"
+	"zhudcemuhxhs"
+	"zhuq"
+	"zhurhvxkkegaf"
+	"zhvdlk"
+	"zhvfd"
+	"zhwgieaqicmn"
+	"zhxbxu"
+	"zhyb"
+	"zhzftli"
+	"zhzn"
+	"zhzsmdbo"
+	"zi"
+	"ziacxti"
+	"ziaifgrhdai"
+	"ziazri"
+	"zibjunjgwt"
+	"ziej"
+	"zige"
+	"ziirxhc"
+	"zikc"
+	"zikiq"
+	"zikk"
+	"ziollopgm"
+	"zipqwkdrcbh"
+	"ziptez"
+	"zipushmdo"
+	"ziqloa"
+	"ziranrweatm"
+	"zirggxfrg"
+	"zisfjrycvf"
+	"zitfmmpzrhhnt"
+	"ziu"
+	"ziudkhzjizqe"
+	"ziumdwxh"
+	"zivvqut"
+	"zivxmaft"
+	"zixxbmb"
+	"zj"
+	"zjacvjnql"
+	"zjb"
+	"zjc"
+	"zjckvzo"
+	"zjefcecufzx"
+	"zjehrgjlwu"
+	"zjfvdmnpygszl"
+	"zjhkm"
+	"zjisiqrphtkr"
+	"zjki"
+	"zjldfmewzgebbw"
+	"zjlmjbq"
+	"zjlsdvagljhgcl"
+	"zjmdnrd"
+	"zjpuc"
+	"zjqubunvwzbalt"
+	"zjrscpsoqomlq"
+	"zjspcei"
+	"zjstkbwklz"
+	"zjsvlebtmz"
+	"zjtoxpu"
+	"zjulkpjuijj"
+	"zjvkxyeyw"
+	"zjvmn"
+	"zjwtnotxod"
+	"zjzkihd"
+	"zk"
+	"zkepnw"
+	"zkfmwoqonjeu"
+	"zkgcpxppy"
+	"zkgfgbqkmczxuf"
+	"zkhbugkarfr"
+	"zkjcrk"
+	"zkjobhp"
+	"zkkhhc"
+	"zkkswczztleiki"
+	"zklcjofamd"
+	"zklyk"
+	"zkoqyaezw"
+	"zkpdqm"
+	"zkswxmnewct"
+	"zktnkjogwhzqz"
+	"zkvwhtvlwywz"
+	"zkwdyhlfsqonq"
+	"zkxfu"
+	"zl"
+	"zlautvslmkienm"
+	"zlbcpskq"
+	"zlccew"
+	"zleagqk"
+	"zlfxobwpezyrp"
+	"zlhbrtdicu"
+	"zlkap"
+	"zlkfnvzrhg"
+	"zlkveussee"
+	"zlliawk"
+	"zlm"
+	"zlnmmrhvnwdg"
+	"zlowhe"
+	"zlpildpricxz"
+	"zlspntic"
+	"zlv"
+	"zlxli"
+	"zlxm"
+	"zlxoecjp"
+	"zlxw"
+	"zlxxueqoexe"
+	"zlyaxaafmhe"
+	"zm"
+	"zmakizooynon"
+	"zmaq"
+	"zmatgofqufet"
+	"zmatxqiuge"
+	"zmbr"
+	"zmcm"
+	"zmd"
+	"zmdiqvf"
+	"zmdmq"
+	"zmdwzz"
+	"zme"
+	"zmevzwb"
+	"zmgtohnmsem"
+	"zml"
+	"zmltbbtekpb"
+	"zmodtafspc"
+	"zmp"
+	"zmpg"
+	"zmtahunjq"
+	"zmttdcrrbm"
+	"zmwaqicvohk"
+	"zmwuicjvqplhni"
+	"zmxqcfnyjgfd"
+	"zmyeoj"
+	"zmymgc"
+	"zmymkc"
+	"zn"
+	"znafuerrdj"
+	"znarrt"
+	"znclaixpklwkf"
+	"zncvgbbvh"
+	"znegu"
+	"znfbjieg"
+	"znfkzicrgvvdpa"
+	"zngnt"
+	"znidsguk"
+	"znirjkylnollkm"
+	"znkhcgbsvl"
+	"znl"
+	"znlcqqavig"
+	"znlukvlquea"
+	"znnkt"
+	"znrsty"
+	"znsoiexa"
+	"zntpxsiotankdx"
+	"znvi"
+	"znvqvbyjcmsfx"
+	"znvsmdn"
+	"znvy"
+	"znwkcroxyquvhx"
+	"znxzkzicleq"
+	"znyfvctb"
+	"znyhcjnql"
+	"znyiyvyy"
+	"znynkg"
+	"zo"
+	"zoacyognq"
+	"zobchm"
+	"zobiudozqad"
+	"zoenqyp"
+	"zoepzboq"
+	"zogmbjiakufyjy"
+	"zohuinhr"
+	"zohvobdunezxm"
+	"zoivjgeemzeluu"
+	"zojdiymx"
+	"zojphadjajzn"
+	"zomygmsaadikz"
+	"zonarvgpqytae"
+	"zongxik"
+	"zoomlglcitlrg"
+	"zooprrwzkic"
+	"zooz"
+	"zop"
+	"zopenxvnqqiwkn"
+	"zopngq"
+	"zoqds"
+	"zoqwrzrn"
+	"zotybkygbbpy"
+	"zoujkhknj"
+	"zovczisqdly"
+	"zovnffcsmwemap"
+	"zovpwswic"
+	"zowtxbvj"
+	"zoybjwwusijw"
+	"zoylphihuezkr"
+	"zoz"
+	"zpacq"
+	"zpaizqhq"
+	"zpbnq"
+	"zpc"
+	"zpdesmitgzrz"
+	"zpdkxic"
+	"zpejxnemszj"
+	"zpelkgfck"
+	"zpewvw"
+	"zpggoi"
+	"zpitbaaivye"
+	"zpketxbzj"
+	"zppif"
+	"zpqglahsvxfpf"
+	"zpsxhph"
+	"zpupybhtjfq"
+	"zpvclzo"
+	"zpxltlyubnmr"
+	"zpy"
+	"zpzrzeym"
+	"zpzzptv"
+	"zq"
+	"zqaipf"
+	"zqb"
+	"zqbalmdglfb"
+	"zqcegcn"
+	"zqclcezv"
+	"zqebkmlvqk"
+	"zqektmgzbugks"
+	"zqhblpip"
+	"zqhygjdysay"
+	"zqistdyjwrf"
+	"zqj"
+	"zqlhiqjzlo"
+	"zqlwyrnppln"
+	"zqm"
+	"zqmnkjjuyduz"
+	"zqmnpp"
+	"zqnmgjcbo"
+	"zqnuuo"
+	"zqo"
+	"zqp"
+	"zqqme"
+	"zqrfc"
+	"zqs"
+	"zqu"
+	"zqukbcyeifwfk"
+	"zqvamhrwcluf"
+	"zqvsdbmjlzun"
+	"zqxkoukaq"
+	"zqyaolyt"
+	"zqyfpsxy"
+	"zqyqjum"
+	"zr"
+	"zraiqsg"
+	"zraqnyawxuk"
+	"zraqxgrgumb"
+	"zrch"
+	"zrdhdtwa"
+	"zred"
+	"zrfhturwquwuyj"
+	"zrh"
+	"zrihooo"
+	"zrlp"
+	"zrmbgnngaqghgx"
+	"zrmtliakdq"
+	"zrorcisoluxu"
+	"zrow"
+	"zrsyhkpctckbuz"
+	"zrwwxpnxezx"
+	"zrxzyil"
+	"zryvszgn"
+	"zryyzg"
+	"zrz"
+	"zs"
+	"zsaahgdklr"
+	"zsb"
+	"zsbvqnvxbphdka"
+	"zscfxqvsgh"
+	"zsevvgee"
+	"zsfiufrdtgybzp"
+	"zsk"
+	"zskitcz"
+	"zslwmerkn"
+	"zsmm"
+	"zsn"
+	"zsnldtlwy"
+	"zspudbrhxqnzh"
+	"zsqicw"
+	"zsqsvakbxhpg"
+	"zssmkhuwgryjer"
+	"zstxzux"
+	"zsug"
+	"zsugdlsoe"
+	"zsujplhu"
+	"zsuoo"
+	"zsvwzbktje"
+	"zswfjhweeaqs"
+	"zswzzwfbp"
+	"zsy"
+	"zsymvpaws"
+	"zt"
+	"ztapuuob"
+	"ztavdtgpiut"
+	"ztexoxcbtctv"
+	"zthcrqvgtkt"
+	"zthhjyrnpa"
+	"zthhrygpy"
+	"ztjdhzuvvsnvc"
+	"ztjl"
+	"ztkabdlgww"
+	"ztm"
+	"ztokrovuphwrba"
+	"ztrgulgqijqxal"
+	"ztrqbyhnlok"
+	"ztrrauzv"
+	"ztryimvmlrd"
+	"ztswjqr"
+	"ztvhnovvt"
+	"ztvke"
+	"ztvpuc"
+	"ztvwlsiqnnr"
+	"ztwkdwkxteq"
+	"ztwmcq"
+	"ztwraljqoe"
+	"ztybll"
+	"ztyrabki"
+	"zu"
+	"zuamtl"
+	"zuaoepqc"
+	"zuasgenk"
+	"zucc"
+	"zuegwqporp"
+	"zufdwg"
+	"zufqln"
+	"zugxyyuqlj"
+	"zuh"
+	"zuixbwzobnxrg"
+	"zuj"
+	"zukbkw"
+	"zukojnzevat"
+	"zukp"
+	"zulecxttcru"
+	"zumdkavf"
+	"zuosekzkz"
+	"zuovparpca"
+	"zuqainrupcscuc"
+	"zuqcu"
+	"zuqqusyw"
+	"zurpf"
+	"zuruuknpbkl"
+	"zuslmamayeaq"
+	"zuts"
+	"zuu"
+	"zuvfw"
+	"zuwewtvgj"
+	"zuwxzhrw"
+	"zuybljdo"
+	"zv"
+	"zvcfxucmd"
+	"zvcqe"
+	"zvcrfrz"
+	"zvdgtkf"
+	"zvdwonxk"
+	"zvg"
+	"zvgdegkrfunm"
+	"zvhtdvslqsoq"
+	"zvhwgxolk"
+	"zvijxbon"
+	"zvjo"
+	"zvlctorpxs"
+	"zvlgovrabdbs"
+	"zvmw"
+	"zvnazcblpdblrr"
+	"zvnmmitmirswuo"
+	"zvovnaw"
+	"zvpfdwog"
+	"zvpi"
+	"zvpjtoyz"
+	"zvqo"
+	"zvrg"
+	"zvrv"
+	"zvrxwgfjnrf"
+	"zvsoislr"
+	"zvssy"
+	"zvtiarxatzegu"
+	"zvtlfay"
+	"zvwzyxn"
+	"zvxczprg"
+	"zw"
+	"zwahzegijy"
+	"zwblxbwebuntq"
+	"zwbwwtub"
+	"zwc"
+	"zwcvdisng"
+	"zwdf"
+	"zwdrulc"
+	"zwezdcxm"
+	"zwjrujyy"
+	"zwjsjnf"
+	"zwksv"
+	"zwlgk"
+	"zwmduvldnlixd"
+	"zwno"
+	"zwobvrjlav"
+	"zwqdnluutph"
+	"zwqihvrjkdmolx"
+	"zwr"
+	"zwwddlvr"
+	"zwxdnsiqxmfg"
+	"zwxf"
+	"zwys"
+	"zxalwrnbxnhsb"
+	"zxbgdbrejx"
+	"zxblz"
+	"zxcfrdfwr"
+	"zxdfditkwpuulo"
+	"zxdfkghohfqi"
+	"zxdhpucjotro"
+	"zxghciuys"
+	"zxgmwimg"
+	"zxgtujonrrxbbl"
+	"zxhpnohqdvege"
+	"zxjd"
+	"zxjgpyjdfuyz"
+	"zxjivtbd"
+	"zxjnodurnznai"
+	"zxkroyohtuqonr"
+	"zxkushamnb"
+	"zxkzhilmwkbogy"
+	"zxl"
+	"zxlw"
+	"zxlz"
+	"zxmsgnbbhhe"
+	"zxoaaxglm"
+	"zxpwqggajb"
+	"zxqgcqmrjlcwgs"
+	"zxsqbroy"
+	"zxubcffx"
+	"zxuuxkx"
+	"zxv"
+	"zxwbtr"
+	"zxxglj"
+	"zxxtevjkujtlc"
+	"zybcrhlviv"
+	"zyd"
+	"zydcp"
+	"zydte"
+	"zyfgdxkvz"
+	"zyhoyprcfyalb"
+	"zyhury"
+	"zykhced"
+	"zykphfqenklqw"
+	"zym"
+	"zymnnfscrczdh"
+	"zympp"
+	"zymtnznoze"
+	"zyn"
+	"zynjxo"
+	"zyqclpffoiu"
+	"zyqfkzw"
+	"zyqgjfhvo"
+	"zyrtccdsr"
+	"zysgpqvshhad"
+	"zysxngovemd"
+	"zyuvuozuov"
+	"zywfpgso"
+	"zywku"
+	"zywyogubeyzqlp"
+	"zyxagu"
+	"zyyl"
+	"zyzudgp"
+	"zyzwxncsv"
+	"zz"
+	"zzadua"
+	"zzaeipxncq"
+	"zzajnvxvpkrw"
+	"zzciydg"
+	"zzdpstxdanhr"
+	"zzeitbzrtnaz"
+	"zzflfciaekvy"
+	"zzfxvqdarep"
+	"zzgkdxu"
+	"zzgwfoua"
+	"zzhjtmia"
+	"zzhtstvdx"
+	"zzigxjgwapj"
+	"zzkeyr"
+	"zzlbsyjihlh"
+	"zzleprmenwp"
+	"zzngcksbqbpvi"
+	"zzopthfz"
+	"zzpncucfqff"
+	"zzrqozu"
+	"zzrvjmwzp"
+	"zzs"
+	"zztsdt"
+	"zzul"
+	"zzuxbbtuamm"
+	"zzv"
+	"zzvvt"
+	"zzvwzzpitc"
+	"zzvynaqeslspt"
+	"zzwbtdkufjgmw"
+	"zzwrh"
+	"zzwsafjjanz"
+	"zzwtvgpycwdza"
+	"zzxbsseixo"
+	"zzzlrq"
+	"zzzuvnw"
+	"zzzxfgzy";
+static const uint8_t hash_off[45011] = {
+	     0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0x40, 0x05, 0x00, 0x1f,
+	     0x00, 0xa4, 0x00, 0x10, 0x03, 0x00, 0x0f, 0x00, 0x43, 0x00,
+	     0x24, 0x01, 0x40, 0x05, 0xc0, 0x16, 0x00, 0x65, 0x00, 0xb8,
+	     0x01, 0x40, 0x07, 0x80, 0x20, 0x00, 0x88, 0x00, 0x4c, 0x02,
+	     0xe0, 0x09, 0x00, 0x2b, 0x00, 0xb2, 0x00, 0xf0, 0x02, 0xf0,
+	     0x0b, 0x40, 0x33, 0x00, 0xd4, 0x00, 0x7c, 0x03, 0x80, 0x0e,
+	     0x00, 0x3b, 0x00, 0xee, 0x00, 0xc4, 0x03, 0x40, 0x0f, 0xc0,
+	     0x3e, 0x00, 0x08, 0x01, 0x34, 0x04, 0xa0, 0x11, 0x00, 0x48,
+	     0x00, 0x2c, 0x01, 0xe8, 0x04, 0x50, 0x14, 0x40, 0x53, 0x00,
+	     0x59, 0x01, 0x84, 0x05, 0xf0, 0x16, 0xc0, 0x5c, 0x00, 0x79,
+	     0x01, 0xf4, 0x05, 0x90, 0x18, 0x40, 0x65, 0x00, 0x9f, 0x01,
+	     0x94, 0x06, 0x10, 0x1b, 0x00, 0x6f, 0x00, 0xc1, 0x01, 0x0c,
+	     0x07, 0x60, 0x1c, 0x80, 0x72, 0x00, 0xd2, 0x01, 0x64, 0x07,
+	     0x50, 0x1e, 0x00, 0x7c, 0x00, 0xf4, 0x01, 0xf4, 0x07, 0x60,
+	     0x20, 0xc0, 0x84, 0x00, 0x21, 0x02, 0xb4, 0x08, 0x20, 0x23,
+	     0x80, 0x8f, 0x00, 0x45, 0x02, 0x20, 0x09, 0xc0, 0x24, 0x80,
+	     0x96, 0x00, 0x61, 0x02, 0x9c, 0x09, 0x20, 0x27, 0xc0, 0x9f,
+	     0x00, 0x87, 0x02, 0x48, 0x0a, 0x00, 0x2a, 0x00, 0xaa, 0x00,
+	     0xaa, 0x02, 0xb8, 0x0a, 0x70, 0x2b, 0x00, 0xaf, 0x00, 0xc1,
+	     0x02, 0x2c, 0x0b, 0x00, 0x2d, 0x80, 0xb7, 0x00, 0xec, 0x02,
+	     0xc0, 0x0b, 0x90, 0x2f, 0xc0, 0xc1, 0x00, 0x13, 0x03, 0x84,
+	     0x0c, 0x90, 0x32, 0xc0, 0xcd, 0x00, 0x3f, 0x03, 0x18, 0x0d,
+	     0xf0, 0x34, 0x00, 0xd7, 0x00, 0x64, 0x03, 0x9c, 0x0d, 0x40,
+	     0x37, 0x40, 0xdf, 0x00, 0x82, 0x03, 0x18, 0x0e, 0x00, 0x39,
+	     0xc0, 0xe5, 0x00, 0x9d, 0x03, 0x88, 0x0e, 0x00, 0x3b, 0x40,
+	     0xee, 0x00, 0xc7, 0x03, 0x28, 0x0f, 0x20, 0x3d, 0x80, 0xf7,
+	     0x00, 0xe2, 0x03, 0xa8, 0x0f, 0x60, 0x3f, 0x40, 0x00, 0x01,
+	     0x07, 0x04, 0x50, 0x10, 0x20, 0x42, 0x80, 0x0b, 0x01, 0x39,
+	     0x04, 0xf4, 0x10, 0x30, 0x44, 0x40, 0x13, 0x01, 0x59, 0x04,
+	     0x78, 0x11, 0x20, 0x46, 0x40, 0x19, 0x01, 0x6e, 0x04, 0xe0,
+	     0x11, 0x60, 0x48, 0x00, 0x23, 0x01, 0x98, 0x04, 0x68, 0x12,
+	     0xd0, 0x49, 0x80, 0x29, 0x01, 0xb4, 0x04, 0xec, 0x12, 0x80,
+	     0x4c, 0xc0, 0x34, 0x01, 0xdd, 0x04, 0xa0, 0x13, 0x30, 0x4f,
+	     0x00, 0x40, 0x01, 0x04, 0x05, 0x2c, 0x14, 0x90, 0x51, 0x40,
+	     0x49, 0x01, 0x2a, 0x05, 0xdc, 0x14, 0x00, 0x54, 0xc0, 0x50,
+	     0x01, 0x4c, 0x05, 0x5c, 0x15, 0xb0, 0x55, 0x00, 0x59, 0x01,
+	     0x6a, 0x05, 0xb4, 0x15, 0x20, 0x57, 0x00, 0x5e, 0x01, 0x7e,
+	     0x05, 0x20, 0x16, 0x40, 0x59, 0x00, 0x68, 0x01, 0xa6, 0x05,
+	     0xa4, 0x16, 0x30, 0x5b, 0x00, 0x70, 0x01, 0xcd, 0x05, 0x44,
+	     0x17, 0x40, 0x5d, 0x40, 0x76, 0x01, 0xe4, 0x05, 0xb0, 0x17,
+	     0x10, 0x5f, 0x80, 0x7d, 0x01, 0x03, 0x06, 0x28, 0x18, 0xd0,
+	     0x60, 0x40, 0x86, 0x01, 0x1e, 0x06, 0xac, 0x18, 0xe0, 0x62,
+	     0xc0, 0x8e, 0x01, 0x47, 0x06, 0x4c, 0x19, 0x90, 0x65, 0x40,
+	     0x98, 0x01, 0x6a, 0x06, 0xe0, 0x19, 0xd0, 0x67, 0x00, 0xa2,
+	     0x01, 0x96, 0x06, 0x88, 0x1a, 0xd0, 0x6a, 0xc0, 0xab, 0x01,
+	     0xba, 0x06, 0xfc, 0x1a, 0xc0, 0x6c, 0xc0, 0xb5, 0x01, 0xe2,
+	     0x06, 0xa4, 0x1b, 0x60, 0x6f, 0x40, 0xbe, 0x01, 0x07, 0x07,
+	     0x34, 0x1c, 0x70, 0x71, 0x80, 0xc7, 0x01, 0x2b, 0x07, 0xdc,
+	     0x1c, 0xe0, 0x73, 0x80, 0xd0, 0x01, 0x47, 0x07, 0x4c, 0x1d,
+	     0xb0, 0x75, 0x80, 0xd7, 0x01, 0x6a, 0x07, 0xbc, 0x1d, 0x80,
+	     0x77, 0x80, 0xe0, 0x01, 0x87, 0x07, 0x44, 0x1e, 0x30, 0x79,
+	     0x40, 0xe7, 0x01, 0xa9, 0x07, 0xcc, 0x1e, 0x10, 0x7c, 0x00,
+	     0xf1, 0x01, 0xd2, 0x07, 0x64, 0x1f, 0xd0, 0x7d, 0x00, 0xf8,
+	     0x01, 0xec, 0x07, 0xc8, 0x1f, 0xe0, 0x7f, 0xc0, 0x00, 0x02,
+	     0x0d, 0x08, 0x4c, 0x20, 0xe0, 0x81, 0x00, 0x09, 0x02, 0x2a,
+	     0x08, 0xb4, 0x20, 0x70, 0x83, 0xc0, 0x0f, 0x02, 0x45, 0x08,
+	     0x34, 0x21, 0x70, 0x85, 0x40, 0x18, 0x02, 0x66, 0x08, 0xb0,
+	     0x21, 0x90, 0x87, 0xc0, 0x21, 0x02, 0x8a, 0x08, 0x38, 0x22,
+	     0x00, 0x89, 0x80, 0x25, 0x02, 0x9e, 0x08, 0x98, 0x22, 0x10,
+	     0x8b, 0x00, 0x2d, 0x02, 0xb8, 0x08, 0xf0, 0x22, 0x20, 0x8c,
+	     0xc0, 0x31, 0x02, 0xd3, 0x08, 0x6c, 0x23, 0x40, 0x8e, 0x40,
+	     0x3b, 0x02, 0xfb, 0x08, 0xfc, 0x23, 0x50, 0x90, 0xc0, 0x43,
+	     0x02, 0x1a, 0x09, 0x74, 0x24, 0x50, 0x92, 0x40, 0x4c, 0x02,
+	     0x33, 0x09, 0xec, 0x24, 0x20, 0x94, 0x40, 0x51, 0x02, 0x4c,
+	     0x09, 0x48, 0x25, 0xb0, 0x95, 0x40, 0x5a, 0x02, 0x72, 0x09,
+	     0xf0, 0x25, 0x70, 0x98, 0x40, 0x63, 0x02, 0x9b, 0x09, 0x94,
+	     0x26, 0xb0, 0x9a, 0xc0, 0x6c, 0x02, 0xbc, 0x09, 0x20, 0x27,
+	     0xd0, 0x9c, 0x00, 0x75, 0x02, 0xdd, 0x09, 0xa8, 0x27, 0x70,
+	     0x9f, 0x00, 0x7f, 0x02, 0x02, 0x0a, 0x24, 0x28, 0xe0, 0xa0,
+	     0x00, 0x87, 0x02, 0x28, 0x0a, 0xd8, 0x28, 0xc0, 0xa3, 0x80,
+	     0x92, 0x02, 0x4c, 0x0a, 0x68, 0x29, 0x80, 0xa6, 0x80, 0x9b,
+	     0x02, 0x71, 0x0a, 0xf4, 0x29, 0xa0, 0xa8, 0xc0, 0xa3, 0x02,
+	     0x93, 0x0a, 0x64, 0x2a, 0x40, 0xaa, 0x40, 0xab, 0x02, 0xb8,
+	     0x0a, 0x10, 0x2b, 0x00, 0xad, 0xc0, 0xb6, 0x02, 0xde, 0x0a,
+	     0x94, 0x2b, 0x80, 0xae, 0x40, 0xbc, 0x02, 0xfe, 0x0a, 0x30,
+	     0x2c, 0xe0, 0xb0, 0x80, 0xc6, 0x02, 0x1f, 0x0b, 0xb0, 0x2c,
+	     0x30, 0xb3, 0x80, 0xcf, 0x02, 0x42, 0x0b, 0x38, 0x2d, 0x60,
+	     0xb5, 0x00, 0xd8, 0x02, 0x66, 0x0b, 0xb8, 0x2d, 0x20, 0xb7,
+	     0xc0, 0xde, 0x02, 0x7e, 0x0b, 0x04, 0x2e, 0x70, 0xb8, 0x40,
+	     0xe4, 0x02, 0x95, 0x0b, 0x60, 0x2e, 0x40, 0xba, 0x80, 0xec,
+	     0x02, 0xb6, 0x0b, 0xf4, 0x2e, 0x30, 0xbc, 0x40, 0xf4, 0x02,
+	     0xd4, 0x0b, 0x64, 0x2f, 0x20, 0xbe, 0x80, 0xf9, 0x02, 0xeb,
+	     0x0b, 0xd8, 0x2f, 0x80, 0xbf, 0x00, 0xff, 0x02, 0x0a, 0x0c,
+	     0x58, 0x30, 0xa0, 0xc1, 0x00, 0x09, 0x03, 0x2f, 0x0c, 0xe0,
+	     0x30, 0xd0, 0xc3, 0x80, 0x12, 0x03, 0x58, 0x0c, 0x88, 0x31,
+	     0x80, 0xc6, 0xc0, 0x1c, 0x03, 0x77, 0x0c, 0x14, 0x32, 0x80,
+	     0xc8, 0xc0, 0x22, 0x03, 0x98, 0x0c, 0x84, 0x32, 0x80, 0xca,
+	     0x40, 0x2d, 0x03, 0xbd, 0x0c, 0xfc, 0x32, 0xd0, 0xcc, 0x00,
+	     0x34, 0x03, 0xd4, 0x0c, 0x68, 0x33, 0x70, 0xce, 0xc0, 0x3b,
+	     0x03, 0xfb, 0x0c, 0xfc, 0x33, 0x80, 0xd0, 0x40, 0x44, 0x03,
+	     0x1e, 0x0d, 0x88, 0x34, 0xc0, 0xd2, 0x80, 0x4c, 0x03, 0x3c,
+	     0x0d, 0x20, 0x35, 0x30, 0xd5, 0x00, 0x58, 0x03, 0x6d, 0x0d,
+	     0xc4, 0x35, 0xd0, 0xd7, 0x40, 0x62, 0x03, 0x93, 0x0d, 0x68,
+	     0x36, 0x80, 0xda, 0x40, 0x6d, 0x03, 0xc0, 0x0d, 0x24, 0x37,
+	     0xd0, 0xdc, 0x00, 0x75, 0x03, 0xdd, 0x0d, 0x88, 0x37, 0x50,
+	     0xde, 0x40, 0x7b, 0x03, 0xf5, 0x0d, 0xe8, 0x37, 0xf0, 0xdf,
+	     0x80, 0x80, 0x03, 0x08, 0x0e, 0x28, 0x38, 0x80, 0xe1, 0x00,
+	     0x87, 0x03, 0x25, 0x0e, 0xc4, 0x38, 0x60, 0xe3, 0x00, 0x91,
+	     0x03, 0x49, 0x0e, 0x34, 0x39, 0x40, 0xe5, 0x40, 0x96, 0x03,
+	     0x67, 0x0e, 0xc8, 0x39, 0xc0, 0xe7, 0x40, 0xa1, 0x03, 0x8e,
+	     0x0e, 0x58, 0x3a, 0x10, 0xea, 0xc0, 0xab, 0x03, 0xbd, 0x0e,
+	     0x2c, 0x3b, 0xf0, 0xec, 0x80, 0xb4, 0x03, 0xdc, 0x0e, 0x90,
+	     0x3b, 0xe0, 0xee, 0xc0, 0xbd, 0x03, 0xff, 0x0e, 0x04, 0x3c,
+	     0x80, 0xf0, 0x80, 0xc4, 0x03, 0x1d, 0x0f, 0x84, 0x3c, 0xb0,
+	     0xf2, 0x40, 0xcd, 0x03, 0x3a, 0x0f, 0x18, 0x3d, 0x40, 0xf5,
+	     0x80, 0xd7, 0x03, 0x61, 0x0f, 0xb4, 0x3d, 0x10, 0xf7, 0x80,
+	     0xdd, 0x03, 0x7b, 0x0f, 0xfc, 0x3d, 0x20, 0xf8, 0xc0, 0xe2,
+	     0x03, 0x95, 0x0f, 0x80, 0x3e, 0x30, 0xfa, 0xc0, 0xea, 0x03,
+	     0xb6, 0x0f, 0xf4, 0x3e, 0x00, 0xfc, 0x00, 0xf3, 0x03, 0xda,
+	     0x0f, 0x94, 0x3f, 0xb0, 0xfe, 0x00, 0xfc, 0x03, 0xf3, 0x0f,
+	     0xec, 0x3f, 0x10, 0x00, 0xc1, 0x00, 0x04, 0x06, 0x10, 0x2c,
+	     0x40, 0x20, 0x01, 0x01, 0x06, 0x04, 0x22, 0x10, 0x94, 0x40,
+	     0x30, 0x03, 0x01, 0x10, 0x04, 0x46, 0x10, 0x2c, 0x41, 0x00,
+	     0x05, 0x81, 0x16, 0x04, 0x67, 0x10, 0xa8, 0x41, 0x00, 0x07,
+	     0x81, 0x1d, 0x04, 0x80, 0x10, 0x34, 0x42, 0x10, 0x09, 0xc1,
+	     0x27, 0x04, 0xac, 0x10, 0xd4, 0x42, 0xd0, 0x0b, 0x01, 0x31,
+	     0x04, 0xca, 0x10, 0x44, 0x43, 0x40, 0x0d, 0xc1, 0x36, 0x04,
+	     0xe7, 0x10, 0xc0, 0x43, 0xc0, 0x0f, 0x01, 0x41, 0x04, 0x0d,
+	     0x11, 0x6c, 0x44, 0x80, 0x12, 0x81, 0x4b, 0x04, 0x34, 0x11,
+	     0xf4, 0x44, 0x40, 0x14, 0x41, 0x54, 0x04, 0x5d, 0x11, 0x8c,
+	     0x45, 0xf0, 0x16, 0x41, 0x5e, 0x04, 0x7d, 0x11, 0x18, 0x46,
+	     0x30, 0x19, 0xc1, 0x66, 0x04, 0x9f, 0x11, 0x90, 0x46, 0x10,
+	     0x1b, 0x01, 0x6d, 0x04, 0xb7, 0x11, 0xe8, 0x46, 0x20, 0x1c,
+	     0x01, 0x74, 0x04, 0xd4, 0x11, 0x84, 0x47, 0x60, 0x1e, 0xc1,
+	     0x7c, 0x04, 0xf7, 0x11, 0x14, 0x48, 0xd0, 0x20, 0x01, 0x85,
+	     0x04, 0x19, 0x12, 0x80, 0x48, 0x20, 0x22, 0x01, 0x8b, 0x04,
+	     0x36, 0x12, 0x0c, 0x49, 0x60, 0x24, 0xc1, 0x93, 0x04, 0x59,
+	     0x12, 0x74, 0x49, 0x00, 0x26, 0x01, 0x99, 0x04, 0x70, 0x12,
+	     0xe4, 0x49, 0xf0, 0x27, 0x81, 0xa2, 0x04, 0x8d, 0x12, 0x44,
+	     0x4a, 0x70, 0x29, 0xc1, 0xa6, 0x04, 0xa8, 0x12, 0xb8, 0x4a,
+	     0x20, 0x2b, 0xc1, 0xae, 0x04, 0xc1, 0x12, 0x1c, 0x4b, 0xc0,
+	     0x2c, 0x81, 0xb3, 0x04, 0xd8, 0x12, 0x70, 0x4b, 0xa0, 0x2e,
+	     0xc1, 0xbc, 0x04, 0xfd, 0x12, 0x14, 0x4c, 0x20, 0x31, 0x41,
+	     0xc7, 0x04, 0x27, 0x13, 0xb0, 0x4c, 0x80, 0x33, 0x41, 0xd0,
+	     0x04, 0x4e, 0x13, 0x48, 0x4d, 0xb0, 0x35, 0x01, 0xd8, 0x04,
+	     0x68, 0x13, 0xd8, 0x4d, 0xd0, 0x37, 0x41, 0xe2, 0x04, 0x93,
+	     0x13, 0x60, 0x4e, 0xe0, 0x39, 0xc1, 0xe9, 0x04, 0xad, 0x13,
+	     0xd8, 0x4e, 0xd0, 0x3b, 0xc1, 0xf2, 0x04, 0xd0, 0x13, 0x48,
+	     0x4f, 0x60, 0x3d, 0x81, 0xf7, 0x04, 0xe1, 0x13, 0xbc, 0x4f,
+	     0x60, 0x3f, 0x41, 0xff, 0x04, 0x08, 0x14, 0x54, 0x50, 0x90,
+	     0x41, 0x81, 0x07, 0x05, 0x28, 0x14, 0xc0, 0x50, 0x50, 0x43,
+	     0x01, 0x0f, 0x05, 0x48, 0x14, 0x34, 0x51, 0x90, 0x45, 0x41,
+	     0x19, 0x05, 0x6f, 0x14, 0xe0, 0x51, 0xe0, 0x47, 0x01, 0x21,
+	     0x05, 0x89, 0x14, 0x5c, 0x52, 0x40, 0x4a, 0x01, 0x2a, 0x05,
+	     0xb1, 0x14, 0xe8, 0x52, 0xd0, 0x4b, 0xc1, 0x2f, 0x05, 0xc4,
+	     0x14, 0x48, 0x53, 0xb0, 0x4d, 0x41, 0x3a, 0x05, 0xf2, 0x14,
+	     0xf4, 0x53, 0x70, 0x50, 0x01, 0x44, 0x05, 0x14, 0x15, 0x84,
+	     0x54, 0x40, 0x52, 0x01, 0x4c, 0x05, 0x35, 0x15, 0xf0, 0x54,
+	     0x30, 0x54, 0x41, 0x53, 0x05, 0x54, 0x15, 0x80, 0x55, 0x70,
+	     0x56, 0x01, 0x5d, 0x05, 0x76, 0x15, 0xec, 0x55, 0x00, 0x58,
+	     0x41, 0x63, 0x05, 0x97, 0x15, 0x8c, 0x56, 0xc0, 0x5a, 0x81,
+	     0x6e, 0x05, 0xc2, 0x15, 0x2c, 0x57, 0x20, 0x5d, 0x41, 0x77,
+	     0x05, 0xe5, 0x15, 0xc0, 0x57, 0xc0, 0x5f, 0x41, 0x81, 0x05,
+	     0x0f, 0x16, 0x54, 0x58, 0xe0, 0x61, 0x41, 0x8a, 0x05, 0x2b,
+	     0x16, 0xd0, 0x58, 0x20, 0x64, 0xc1, 0x91, 0x05, 0x4f, 0x16,
+	     0x68, 0x59, 0xd0, 0x65, 0x41, 0x98, 0x05, 0x6a, 0x16, 0xb4,
+	     0x59, 0x20, 0x67, 0xc1, 0x9e, 0x05, 0x81, 0x16, 0x1c, 0x5a,
+	     0xb0, 0x68, 0x01, 0xa4, 0x05, 0x9b, 0x16, 0x78, 0x5a, 0x70,
+	     0x6a, 0x41, 0xab, 0x05, 0xb6, 0x16, 0x04, 0x5b, 0x40, 0x6c,
+	     0x41, 0xb2, 0x05, 0xd2, 0x16, 0x58, 0x5b, 0xa0, 0x6d, 0x01,
+	     0xb8, 0x05, 0xe6, 0x16, 0xa4, 0x5b, 0xb0, 0x6e, 0x41, 0xbd,
+	     0x05, 0xfc, 0x16, 0x14, 0x5c, 0x30, 0x71, 0x41, 0xc8, 0x05,
+	     0x25, 0x17, 0xc0, 0x5c, 0x40, 0x73, 0x81, 0xcf, 0x05, 0x48,
+	     0x17, 0x58, 0x5d, 0xc0, 0x75, 0xc1, 0xd8, 0x05, 0x68, 0x17,
+	     0xcc, 0x5d, 0x10, 0x78, 0xc1, 0xe3, 0x05, 0x9b, 0x17, 0x80,
+	     0x5e, 0xe0, 0x7a, 0x01, 0xee, 0x05, 0xc0, 0x17, 0x28, 0x5f,
+	     0xc0, 0x7c, 0x01, 0xf5, 0x05, 0xd9, 0x17, 0x78, 0x5f, 0x30,
+	     0x7e, 0x01, 0xfc, 0x05, 0xf9, 0x17, 0xf8, 0x5f, 0x20, 0x80,
+	     0x81, 0x02, 0x06, 0x18, 0x18, 0x78, 0x60, 0x90, 0x82, 0x41,
+	     0x0d, 0x06, 0x41, 0x18, 0x1c, 0x61, 0x50, 0x85, 0x81, 0x18,
+	     0x06, 0x67, 0x18, 0xb0, 0x61, 0x90, 0x87, 0x41, 0x21, 0x06,
+	     0x93, 0x18, 0x5c, 0x62, 0xc0, 0x89, 0x41, 0x28, 0x06, 0xa4,
+	     0x18, 0xc4, 0x62, 0x90, 0x8b, 0x41, 0x31, 0x06, 0xcc, 0x18,
+	     0x64, 0x63, 0xb0, 0x8d, 0xc1, 0x39, 0x06, 0xf0, 0x18, 0xe0,
+	     0x63, 0x50, 0x90, 0x01, 0x43, 0x06, 0x17, 0x19, 0x88, 0x64,
+	     0xf0, 0x92, 0x81, 0x4c, 0x06, 0x38, 0x19, 0x04, 0x65, 0xe0,
+	     0x94, 0xc1, 0x54, 0x06, 0x59, 0x19, 0x84, 0x65, 0xf0, 0x96,
+	     0x81, 0x5e, 0x06, 0x85, 0x19, 0x24, 0x66, 0x30, 0x99, 0xc1,
+	     0x65, 0x06, 0xa1, 0x19, 0xa0, 0x66, 0xa0, 0x9a, 0x41, 0x6b,
+	     0x06, 0xb9, 0x19, 0xf8, 0x66, 0x90, 0x9c, 0xc1, 0x73, 0x06,
+	     0xd2, 0x19, 0x70, 0x67, 0x90, 0x9e, 0x41, 0x7d, 0x06, 0xfc,
+	     0x19, 0x08, 0x68, 0xb0, 0xa0, 0xc1, 0x85, 0x06, 0x1c, 0x1a,
+	     0x84, 0x68, 0xc0, 0xa2, 0x81, 0x8d, 0x06, 0x3b, 0x1a, 0x18,
+	     0x69, 0x10, 0xa5, 0x01, 0x96, 0x06, 0x5e, 0x1a, 0xa8, 0x69,
+	     0xd0, 0xa6, 0x01, 0x9d, 0x06, 0x78, 0x1a, 0x08, 0x6a, 0xd0,
+	     0xa8, 0x41, 0xa4, 0x06, 0x98, 0x1a, 0x88, 0x6a, 0x60, 0xaa,
+	     0x81, 0xaa, 0x06, 0xac, 0x1a, 0xe4, 0x6a, 0x60, 0xac, 0xc1,
+	     0xb3, 0x06, 0xd5, 0x1a, 0x8c, 0x6b, 0xf0, 0xae, 0x81, 0xbc,
+	     0x06, 0xfb, 0x1a, 0x14, 0x6c, 0xc0, 0xb0, 0x41, 0xc6, 0x06,
+	     0x25, 0x1b, 0xa8, 0x6c, 0x30, 0xb3, 0x01, 0xcf, 0x06, 0x43,
+	     0x1b, 0x44, 0x6d, 0xf0, 0xb5, 0x01, 0xd9, 0x06, 0x72, 0x1b,
+	     0xd8, 0x6d, 0x10, 0xb8, 0x01, 0xe1, 0x06, 0x8a, 0x1b, 0x44,
+	     0x6e, 0x30, 0xb9, 0x01, 0xe7, 0x06, 0xaa, 0x1b, 0xd8, 0x6e,
+	     0x30, 0xbc, 0x41, 0xf4, 0x06, 0xde, 0x1b, 0x94, 0x6f, 0xb0,
+	     0xbe, 0x01, 0xfc, 0x06, 0xf4, 0x1b, 0xf8, 0x6f, 0x90, 0xc0,
+	     0x41, 0x04, 0x07, 0x1f, 0x1c, 0xa0, 0x70, 0xf0, 0xc2, 0x81,
+	     0x0e, 0x07, 0x45, 0x1c, 0x4c, 0x71, 0xc0, 0xc5, 0x01, 0x18,
+	     0x07, 0x6d, 0x1c, 0xcc, 0x71, 0x80, 0xc7, 0x81, 0x1f, 0x07,
+	     0x83, 0x1c, 0x14, 0x72, 0x10, 0xc9, 0x01, 0x26, 0x07, 0xa0,
+	     0x1c, 0x90, 0x72, 0xf0, 0xca, 0x81, 0x2c, 0x07, 0xbb, 0x1c,
+	     0x14, 0x73, 0xb0, 0xcc, 0x01, 0x35, 0x07, 0xd9, 0x1c, 0x84,
+	     0x73, 0xc0, 0xce, 0xc1, 0x3c, 0x07, 0x01, 0x1d, 0x14, 0x74,
+	     0xc0, 0xd0, 0x41, 0x46, 0x07, 0x26, 0x1d, 0xa8, 0x74, 0xe0,
+	     0xd2, 0xc1, 0x4c, 0x07, 0x3b, 0x1d, 0x04, 0x75, 0xa0, 0xd4,
+	     0x01, 0x54, 0x07, 0x53, 0x1d, 0x78, 0x75, 0xa0, 0xd6, 0x41,
+	     0x5d, 0x07, 0x83, 0x1d, 0x14, 0x76, 0x90, 0xd8, 0xc1, 0x65,
+	     0x07, 0x9e, 0x1d, 0xb0, 0x76, 0xf0, 0xda, 0x01, 0x6e, 0x07,
+	     0xbd, 0x1d, 0x10, 0x77, 0x70, 0xdc, 0x41, 0x74, 0x07, 0xdd,
+	     0x1d, 0x84, 0x77, 0xb0, 0xde, 0x81, 0x7b, 0x07, 0xf3, 0x1d,
+	     0xec, 0x77, 0x00, 0xe0, 0x81, 0x82, 0x07, 0x14, 0x1e, 0x84,
+	     0x78, 0xd0, 0xe2, 0x01, 0x8c, 0x07, 0x3c, 0x1e, 0x24, 0x79,
+	     0x00, 0xe5, 0x81, 0x97, 0x07, 0x6c, 0x1e, 0xc4, 0x79, 0x30,
+	     0xe7, 0x01, 0x9f, 0x07, 0x89, 0x1e, 0x44, 0x7a, 0x90, 0xe9,
+	     0x81, 0xa9, 0x07, 0xac, 0x1e, 0xd0, 0x7a, 0x80, 0xeb, 0x01,
+	     0xb1, 0x07, 0xcf, 0x1e, 0x50, 0x7b, 0xa0, 0xed, 0x41, 0xb9,
+	     0x07, 0xf1, 0x1e, 0xd8, 0x7b, 0xc0, 0xef, 0xc1, 0xbf, 0x07,
+	     0x0d, 0x1f, 0x58, 0x7c, 0x20, 0xf2, 0x01, 0xcc, 0x07, 0x3c,
+	     0x1f, 0xf8, 0x7c, 0x90, 0xf4, 0x01, 0xd3, 0x07, 0x56, 0x1f,
+	     0x90, 0x7d, 0xa0, 0xf6, 0x01, 0xdc, 0x07, 0x74, 0x1f, 0xec,
+	     0x7d, 0xe0, 0xf7, 0x81, 0xe0, 0x07, 0x8f, 0x1f, 0x54, 0x7e,
+	     0xb0, 0xf9, 0x81, 0xe9, 0x07, 0xb4, 0x1f, 0xf0, 0x7e, 0x40,
+	     0xfc, 0x41, 0xf3, 0x07, 0xd1, 0x1f, 0x54, 0x7f, 0x00, 0xfe,
+	     0xc1, 0xfa, 0x07, 0xf4, 0x1f, 0xe0, 0x7f, 0xc0, 0xff, 0x81,
+	     0xff, 0x07, 0x01, 0x20, 0x18, 0x80, 0xe0, 0x00, 0x42, 0x06,
+	     0x08, 0x24, 0x20, 0x9c, 0x80, 0x10, 0x03, 0xc2, 0x0e, 0x08,
+	     0x44, 0x20, 0x48, 0x81, 0x70, 0x05, 0x82, 0x18, 0x08, 0x6d,
+	     0x20, 0xcc, 0x81, 0xe0, 0x07, 0x02, 0x21, 0x08, 0x8c, 0x20,
+	     0x58, 0x82, 0xf0, 0x09, 0x02, 0x2b, 0x08, 0xb8, 0x20, 0x0c,
+	     0x83, 0xf0, 0x0c, 0x82, 0x35, 0x08, 0xdb, 0x20, 0x80, 0x83,
+	     0xb0, 0x0e, 0x02, 0x3d, 0x08, 0xf9, 0x20, 0xf8, 0x83, 0xc0,
+	     0x10, 0x02, 0x44, 0x08, 0x19, 0x21, 0x94, 0x84, 0x90, 0x12,
+	     0x42, 0x4c, 0x08, 0x39, 0x21, 0x1c, 0x85, 0x50, 0x15, 0xc2,
+	     0x55, 0x08, 0x5a, 0x21, 0x9c, 0x85, 0x40, 0x17, 0x82, 0x5f,
+	     0x08, 0x87, 0x21, 0x48, 0x86, 0x70, 0x19, 0x02, 0x67, 0x08,
+	     0xa6, 0x21, 0xd0, 0x86, 0xd0, 0x1b, 0x42, 0x70, 0x08, 0xcd,
+	     0x21, 0x54, 0x87, 0xe0, 0x1d, 0x42, 0x79, 0x08, 0xec, 0x21,
+	     0xd0, 0x87, 0xe0, 0x1f, 0x42, 0x82, 0x08, 0x12, 0x22, 0x54,
+	     0x88, 0x30, 0x22, 0x42, 0x8b, 0x08, 0x30, 0x22, 0xd4, 0x88,
+	     0xb0, 0x23, 0x02, 0x91, 0x08, 0x4c, 0x22, 0x68, 0x89, 0xf0,
+	     0x25, 0x02, 0x99, 0x08, 0x66, 0x22, 0xc8, 0x89, 0xf0, 0x27,
+	     0xc2, 0xa2, 0x08, 0x98, 0x22, 0x8c, 0x8a, 0xc0, 0x2a, 0xc2,
+	     0xab, 0x08, 0xba, 0x22, 0x20, 0x8b, 0x40, 0x2d, 0x02, 0xb8,
+	     0x08, 0xee, 0x22, 0xe0, 0x8b, 0x20, 0x30, 0x02, 0xc3, 0x08,
+	     0x17, 0x23, 0x70, 0x8c, 0x70, 0x32, 0xc2, 0xcb, 0x08, 0x34,
+	     0x23, 0xe0, 0x8c, 0xc0, 0x33, 0x42, 0xd1, 0x08, 0x48, 0x23,
+	     0x30, 0x8d, 0x40, 0x35, 0x82, 0xd6, 0x08, 0x5d, 0x23, 0xa8,
+	     0x8d, 0x40, 0x37, 0x02, 0xde, 0x08, 0x7c, 0x23, 0x14, 0x8e,
+	     0x80, 0x38, 0x02, 0xe4, 0x08, 0x97, 0x23, 0x80, 0x8e, 0x90,
+	     0x3a, 0x82, 0xeb, 0x08, 0xb6, 0x23, 0xf8, 0x8e, 0x80, 0x3c,
+	     0x82, 0xf4, 0x08, 0xd8, 0x23, 0x7c, 0x8f, 0x30, 0x3e, 0x42,
+	     0xfa, 0x08, 0xee, 0x23, 0xd4, 0x8f, 0xa0, 0x3f, 0x82, 0x00,
+	     0x09, 0x07, 0x24, 0x38, 0x90, 0x10, 0x41, 0x82, 0x06, 0x09,
+	     0x1f, 0x24, 0xb4, 0x90, 0x30, 0x43, 0x82, 0x0e, 0x09, 0x48,
+	     0x24, 0x30, 0x91, 0xe0, 0x44, 0x42, 0x15, 0x09, 0x59, 0x24,
+	     0x7c, 0x91, 0x60, 0x46, 0x42, 0x1b, 0x09, 0x73, 0x24, 0x04,
+	     0x92, 0xc0, 0x48, 0x42, 0x25, 0x09, 0x99, 0x24, 0x88, 0x92,
+	     0xf0, 0x4a, 0x82, 0x2e, 0x09, 0xc4, 0x24, 0x38, 0x93, 0x10,
+	     0x4d, 0x82, 0x36, 0x09, 0xe4, 0x24, 0xbc, 0x93, 0x30, 0x4f,
+	     0xc2, 0x3f, 0x09, 0x04, 0x25, 0x28, 0x94, 0xd0, 0x50, 0x42,
+	     0x46, 0x09, 0x23, 0x25, 0xa8, 0x94, 0x30, 0x53, 0x82, 0x4d,
+	     0x09, 0x43, 0x25, 0x34, 0x95, 0x70, 0x55, 0x02, 0x58, 0x09,
+	     0x66, 0x25, 0xb4, 0x95, 0xb0, 0x57, 0x42, 0x60, 0x09, 0x83,
+	     0x25, 0x3c, 0x96, 0x60, 0x59, 0x82, 0x68, 0x09, 0xaf, 0x25,
+	     0xec, 0x96, 0x80, 0x5c, 0x82, 0x73, 0x09, 0xd6, 0x25, 0x78,
+	     0x97, 0x20, 0x5e, 0xc2, 0x79, 0x09, 0xec, 0x25, 0xbc, 0x97,
+	     0xb0, 0x5f, 0x02, 0x80, 0x09, 0x0e, 0x26, 0x58, 0x98, 0xf0,
+	     0x61, 0x02, 0x8a, 0x09, 0x2c, 0x26, 0xcc, 0x98, 0xd0, 0x63,
+	     0xc2, 0x91, 0x09, 0x51, 0x26, 0x64, 0x99, 0xd0, 0x65, 0xc2,
+	     0x99, 0x09, 0x69, 0x26, 0xcc, 0x99, 0x10, 0x68, 0x02, 0xa2,
+	     0x09, 0x95, 0x26, 0x74, 0x9a, 0x20, 0x6a, 0x02, 0xac, 0x09,
+	     0xb9, 0x26, 0xf8, 0x9a, 0x50, 0x6c, 0x42, 0xb4, 0x09, 0xd5,
+	     0x26, 0x8c, 0x9b, 0xc0, 0x6e, 0x02, 0xbc, 0x09, 0xf8, 0x26,
+	     0xf8, 0x9b, 0x40, 0x70, 0x42, 0xc2, 0x09, 0x10, 0x27, 0x70,
+	     0x9c, 0x30, 0x72, 0x42, 0xcc, 0x09, 0x3d, 0x27, 0x04, 0x9d,
+	     0xf0, 0x74, 0xc2, 0xd5, 0x09, 0x5b, 0x27, 0x8c, 0x9d, 0xc0,
+	     0x76, 0x82, 0xde, 0x09, 0x80, 0x27, 0x24, 0x9e, 0x50, 0x79,
+	     0xc2, 0xe5, 0x09, 0xa0, 0x27, 0xa8, 0x9e, 0x30, 0x7b, 0xc2,
+	     0xef, 0x09, 0xcb, 0x27, 0x58, 0x9f, 0x30, 0x7e, 0x02, 0xfc,
+	     0x09, 0xf7, 0x27, 0xe8, 0x9f, 0x80, 0x80, 0xc2, 0x02, 0x0a,
+	     0x15, 0x28, 0x8c, 0xa0, 0xa0, 0x82, 0x42, 0x0c, 0x0a, 0x38,
+	     0x28, 0x00, 0xa1, 0x30, 0x84, 0x02, 0x12, 0x0a, 0x56, 0x28,
+	     0x90, 0xa1, 0x20, 0x87, 0x02, 0x1d, 0x0a, 0x7b, 0x28, 0x00,
+	     0xa2, 0xa0, 0x88, 0xc2, 0x23, 0x0a, 0x9c, 0x28, 0x8c, 0xa2,
+	     0x10, 0x8b, 0xc2, 0x2d, 0x0a, 0xbd, 0x28, 0x04, 0xa3, 0xd0,
+	     0x8c, 0x02, 0x34, 0x0a, 0xdc, 0x28, 0xa4, 0xa3, 0xe0, 0x8e,
+	     0x02, 0x3e, 0x0a, 0x01, 0x29, 0x10, 0xa4, 0xb0, 0x90, 0x42,
+	     0x44, 0x0a, 0x15, 0x29, 0x64, 0xa4, 0x50, 0x92, 0xc2, 0x4b,
+	     0x0a, 0x37, 0x29, 0x14, 0xa5, 0x20, 0x95, 0xc2, 0x57, 0x0a,
+	     0x63, 0x29, 0xb0, 0xa5, 0x30, 0x97, 0xc2, 0x5d, 0x0a, 0x80,
+	     0x29, 0x14, 0xa6, 0x70, 0x98, 0x42, 0x64, 0x0a, 0x96, 0x29,
+	     0x8c, 0xa6, 0x70, 0x9a, 0x42, 0x6c, 0x0a, 0xba, 0x29, 0x18,
+	     0xa7, 0x20, 0x9d, 0xc2, 0x75, 0x0a, 0xdc, 0x29, 0xa4, 0xa7,
+	     0xd0, 0x9e, 0x42, 0x7e, 0x0a, 0xfc, 0x29, 0x10, 0xa8, 0xa0,
+	     0xa0, 0xc2, 0x85, 0x0a, 0x1b, 0x2a, 0x88, 0xa8, 0x00, 0xa3,
+	     0x82, 0x8c, 0x0a, 0x35, 0x2a, 0xf4, 0xa8, 0x10, 0xa4, 0x82,
+	     0x93, 0x0a, 0x56, 0x2a, 0x64, 0xa9, 0x50, 0xa6, 0x42, 0x9a,
+	     0x0a, 0x71, 0x2a, 0xe4, 0xa9, 0x70, 0xa8, 0x82, 0xa3, 0x0a,
+	     0x98, 0x2a, 0x7c, 0xaa, 0x90, 0xaa, 0x02, 0xad, 0x0a, 0xc2,
+	     0x2a, 0x28, 0xab, 0x40, 0xad, 0xc2, 0xb5, 0x0a, 0xde, 0x2a,
+	     0xa4, 0xab, 0x10, 0xaf, 0x42, 0xbd, 0x0a, 0xf7, 0x2a, 0x14,
+	     0xac, 0x80, 0xb0, 0x82, 0xc3, 0x0a, 0x1a, 0x2b, 0xa0, 0xac,
+	     0x00, 0xb3, 0xc2, 0xce, 0x0a, 0x47, 0x2b, 0x50, 0xad, 0x80,
+	     0xb5, 0x42, 0xd7, 0x0a, 0x6b, 0x2b, 0xcc, 0xad, 0xb0, 0xb7,
+	     0x02, 0xe2, 0x0a, 0x95, 0x2b, 0x7c, 0xae, 0xd0, 0xba, 0x82,
+	     0xee, 0x0a, 0xc6, 0x2b, 0x34, 0xaf, 0x00, 0xbd, 0x02, 0xf7,
+	     0x0a, 0xea, 0x2b, 0xb4, 0xaf, 0x90, 0xbf, 0x42, 0x01, 0x0b,
+	     0x09, 0x2c, 0x40, 0xb0, 0x70, 0xc1, 0x42, 0x06, 0x0b, 0x1f,
+	     0x2c, 0x98, 0xb0, 0xc0, 0xc2, 0xc2, 0x0b, 0x0b, 0x37, 0x2c,
+	     0xf8, 0xb0, 0x30, 0xc4, 0x42, 0x13, 0x0b, 0x5b, 0x2c, 0x98,
+	     0xb1, 0x40, 0xc7, 0x02, 0x20, 0x0b, 0x85, 0x2c, 0x30, 0xb2,
+	     0xa0, 0xc9, 0x42, 0x29, 0x0b, 0xb1, 0x2c, 0xf8, 0xb2, 0xc0,
+	     0xcc, 0x82, 0x34, 0x0b, 0xd8, 0x2c, 0x78, 0xb3, 0x50, 0xce,
+	     0x42, 0x3b, 0x0b, 0xf9, 0x2c, 0x14, 0xb4, 0xf0, 0xd0, 0x82,
+	     0x46, 0x0b, 0x24, 0x2d, 0x98, 0xb4, 0xb0, 0xd2, 0x82, 0x4c,
+	     0x0b, 0x39, 0x2d, 0x08, 0xb5, 0xd0, 0xd4, 0xc2, 0x55, 0x0b,
+	     0x5b, 0x2d, 0x84, 0xb5, 0x50, 0xd6, 0x82, 0x5c, 0x0b, 0x7b,
+	     0x2d, 0x1c, 0xb6, 0xa0, 0xd8, 0xc2, 0x64, 0x0b, 0xa0, 0x2d,
+	     0x98, 0xb6, 0xa0, 0xda, 0x82, 0x6b, 0x0b, 0xb5, 0x2d, 0xfc,
+	     0xb6, 0x30, 0xdc, 0x82, 0x73, 0x0b, 0xd5, 0x2d, 0x80, 0xb7,
+	     0x20, 0xde, 0x02, 0x7a, 0x0b, 0xee, 0x2d, 0xe8, 0xb7, 0x30,
+	     0xe0, 0x02, 0x82, 0x0b, 0x12, 0x2e, 0x78, 0xb8, 0xb0, 0xe2,
+	     0x02, 0x8e, 0x0b, 0x43, 0x2e, 0x40, 0xb9, 0x40, 0xe5, 0x02,
+	     0x98, 0x0b, 0x6a, 0x2e, 0xdc, 0xb9, 0x00, 0xe8, 0x02, 0xa2,
+	     0x0b, 0x96, 0x2e, 0x70, 0xba, 0x00, 0xea, 0x82, 0xa9, 0x0b,
+	     0xab, 0x2e, 0xd8, 0xba, 0x80, 0xeb, 0x02, 0xaf, 0x0b, 0xc3,
+	     0x2e, 0x38, 0xbb, 0x20, 0xed, 0xc2, 0xb5, 0x0b, 0xde, 0x2e,
+	     0x94, 0xbb, 0x30, 0xef, 0x02, 0xc0, 0x0b, 0x08, 0x2f, 0x50,
+	     0xbc, 0x90, 0xf1, 0x42, 0xc7, 0x0b, 0x22, 0x2f, 0xa0, 0xbc,
+	     0xc0, 0xf2, 0x42, 0xcc, 0x0b, 0x34, 0x2f, 0xf8, 0xbc, 0x90,
+	     0xf4, 0x82, 0xd4, 0x0b, 0x60, 0x2f, 0xa4, 0xbd, 0xc0, 0xf6,
+	     0x02, 0xdc, 0x0b, 0x7b, 0x2f, 0x04, 0xbe, 0xf0, 0xf8, 0x82,
+	     0xe4, 0x0b, 0x9f, 0x2f, 0xb0, 0xbe, 0x10, 0xfb, 0xc2, 0xec,
+	     0x0b, 0xc0, 0x2f, 0x0c, 0xbf, 0xb0, 0xfc, 0x02, 0xf6, 0x0b,
+	     0xde, 0x2f, 0x94, 0xbf, 0x00, 0xff, 0x42, 0xff, 0x0b, 0x02,
+	     0x30, 0x18, 0xc0, 0xf0, 0x00, 0x43, 0x07, 0x0c, 0x25, 0x30,
+	     0xb8, 0xc0, 0x30, 0x03, 0x43, 0x0e, 0x0c, 0x44, 0x30, 0x30,
+	     0xc1, 0x00, 0x05, 0x83, 0x15, 0x0c, 0x61, 0x30, 0xa4, 0xc1,
+	     0x30, 0x07, 0xc3, 0x1d, 0x0c, 0x82, 0x30, 0x10, 0xc2, 0x80,
+	     0x08, 0x43, 0x23, 0x0c, 0x93, 0x30, 0x68, 0xc2, 0x80, 0x0a,
+	     0x83, 0x2d, 0x0c, 0xbc, 0x30, 0xfc, 0xc2, 0x70, 0x0c, 0x43,
+	     0x35, 0x0c, 0xd8, 0x30, 0x80, 0xc3, 0x90, 0x0e, 0x83, 0x3d,
+	     0x0c, 0xfe, 0x30, 0x28, 0xc4, 0xf0, 0x10, 0xc3, 0x45, 0x0c,
+	     0x21, 0x31, 0x9c, 0xc4, 0xf0, 0x12, 0x83, 0x4e, 0x0c, 0x46,
+	     0x31, 0x28, 0xc5, 0x40, 0x15, 0x83, 0x57, 0x0c, 0x64, 0x31,
+	     0x98, 0xc5, 0x00, 0x17, 0xc3, 0x5c, 0x0c, 0x7c, 0x31, 0x0c,
+	     0xc6, 0xd0, 0x18, 0x03, 0x64, 0x0c, 0x96, 0x31, 0x84, 0xc6,
+	     0xa0, 0x1a, 0x43, 0x6c, 0x0c, 0xbb, 0x31, 0x18, 0xc7, 0x90,
+	     0x1c, 0x43, 0x73, 0x0c, 0xda, 0x31, 0x98, 0xc7, 0x40, 0x1f,
+	     0x43, 0x7f, 0x0c, 0x02, 0x32, 0x34, 0xc8, 0x20, 0x21, 0xc3,
+	     0x86, 0x0c, 0x1d, 0x32, 0x9c, 0xc8, 0xa0, 0x22, 0x83, 0x8d,
+	     0x0c, 0x3b, 0x32, 0xf8, 0xc8, 0x60, 0x24, 0x43, 0x93, 0x0c,
+	     0x59, 0x32, 0x98, 0xc9, 0x30, 0x27, 0x03, 0x9f, 0x0c, 0x8a,
+	     0x32, 0x54, 0xca, 0xd0, 0x29, 0x43, 0xa8, 0x0c, 0xae, 0x32,
+	     0xe4, 0xca, 0xd0, 0x2b, 0x83, 0xb1, 0x0c, 0xce, 0x32, 0x6c,
+	     0xcb, 0xd0, 0x2d, 0x83, 0xba, 0x0c, 0xf6, 0x32, 0xec, 0xcb,
+	     0x50, 0x30, 0x43, 0xc4, 0x0c, 0x16, 0x33, 0x84, 0xcc, 0x60,
+	     0x32, 0x43, 0xca, 0x0c, 0x2d, 0x33, 0xcc, 0xcc, 0x90, 0x33,
+	     0x83, 0xd1, 0x0c, 0x49, 0x33, 0x44, 0xcd, 0x40, 0x35, 0x03,
+	     0xd7, 0x0c, 0x5f, 0x33, 0xb0, 0xcd, 0x00, 0x37, 0xc3, 0xdc,
+	     0x0c, 0x80, 0x33, 0x38, 0xce, 0x80, 0x39, 0xc3, 0xe7, 0x0c,
+	     0xa1, 0x33, 0x98, 0xce, 0xb0, 0x3a, 0xc3, 0xeb, 0x0c, 0xbc,
+	     0x33, 0x20, 0xcf, 0x10, 0x3d, 0x43, 0xf7, 0x0c, 0xe9, 0x33,
+	     0xb0, 0xcf, 0x50, 0x3f, 0x03, 0x00, 0x0d, 0x05, 0x34, 0x48,
+	     0xd0, 0x70, 0x41, 0x83, 0x08, 0x0d, 0x2a, 0x34, 0xcc, 0xd0,
+	     0xa0, 0x43, 0xc3, 0x10, 0x0d, 0x47, 0x34, 0x38, 0xd1, 0x60,
+	     0x45, 0x03, 0x19, 0x0d, 0x68, 0x34, 0xd8, 0xd1, 0xa0, 0x47,
+	     0x43, 0x21, 0x0d, 0x91, 0x34, 0x74, 0xd2, 0xf0, 0x49, 0x83,
+	     0x28, 0x0d, 0xb0, 0x34, 0xf0, 0xd2, 0x50, 0x4c, 0xc3, 0x34,
+	     0x0d, 0xd9, 0x34, 0x90, 0xd3, 0xf0, 0x4e, 0x83, 0x3d, 0x0d,
+	     0xfd, 0x34, 0x24, 0xd4, 0x00, 0x51, 0x03, 0x46, 0x0d, 0x21,
+	     0x35, 0x98, 0xd4, 0xf0, 0x52, 0x03, 0x4d, 0x0d, 0x3f, 0x35,
+	     0x0c, 0xd5, 0x60, 0x54, 0x83, 0x52, 0x0d, 0x4d, 0x35, 0x64,
+	     0xd5, 0xd0, 0x55, 0xc3, 0x59, 0x0d, 0x71, 0x35, 0xe0, 0xd5,
+	     0x20, 0x58, 0x03, 0x61, 0x0d, 0x8f, 0x35, 0x4c, 0xd6, 0xf0,
+	     0x59, 0x43, 0x6a, 0x0d, 0xad, 0x35, 0xe4, 0xd6, 0x20, 0x5c,
+	     0x83, 0x71, 0x0d, 0xcb, 0x35, 0x50, 0xd7, 0x00, 0x5e, 0x43,
+	     0x7b, 0x0d, 0xf0, 0x35, 0xec, 0xd7, 0x70, 0x60, 0x43, 0x85,
+	     0x0d, 0x20, 0x36, 0x90, 0xd8, 0x10, 0x63, 0x03, 0x8f, 0x0d,
+	     0x47, 0x36, 0x3c, 0xd9, 0x60, 0x65, 0x03, 0x99, 0x0d, 0x72,
+	     0x36, 0xd4, 0xd9, 0x30, 0x68, 0xc3, 0xa2, 0x0d, 0x98, 0x36,
+	     0x94, 0xda, 0xf0, 0x6a, 0x03, 0xae, 0x0d, 0xbc, 0x36, 0xf8,
+	     0xda, 0x50, 0x6c, 0xc3, 0xb2, 0x0d, 0xd9, 0x36, 0x70, 0xdb,
+	     0x90, 0x6e, 0xc3, 0xbb, 0x0d, 0xfc, 0x36, 0x04, 0xdc, 0x50,
+	     0x70, 0x83, 0xc4, 0x0d, 0x20, 0x37, 0xb0, 0xdc, 0xa0, 0x73,
+	     0x43, 0xd1, 0x0d, 0x4d, 0x37, 0x54, 0xdd, 0x00, 0x76, 0x03,
+	     0xda, 0x0d, 0x76, 0x37, 0x10, 0xde, 0xd0, 0x78, 0x83, 0xe4,
+	     0x0d, 0x9e, 0x37, 0x90, 0xde, 0x20, 0x7b, 0xc3, 0xed, 0x0d,
+	     0xc5, 0x37, 0x2c, 0xdf, 0x60, 0x7d, 0x83, 0xf6, 0x0d, 0xe6,
+	     0x37, 0xb4, 0xdf, 0x20, 0x7f, 0x03, 0xfd, 0x0d, 0xfd, 0x37,
+	     0x10, 0xe0, 0xe0, 0x80, 0x03, 0x06, 0x0e, 0x21, 0x38, 0x94,
+	     0xe0, 0xa0, 0x82, 0x43, 0x0b, 0x0e, 0x31, 0x38, 0xf0, 0xe0,
+	     0x70, 0x84, 0x43, 0x14, 0x0e, 0x5b, 0x38, 0x88, 0xe1, 0x80,
+	     0x86, 0xc3, 0x1b, 0x0e, 0x75, 0x38, 0x08, 0xe2, 0xc0, 0x88,
+	     0x43, 0x26, 0x0e, 0x9f, 0x38, 0x98, 0xe2, 0x10, 0x8b, 0x03,
+	     0x2e, 0x0e, 0xbf, 0x38, 0x1c, 0xe3, 0x40, 0x8d, 0x03, 0x37,
+	     0x0e, 0xe2, 0x38, 0xb4, 0xe3, 0x50, 0x8f, 0x43, 0x3f, 0x0e,
+	     0x0b, 0x39, 0x34, 0xe4, 0x60, 0x91, 0xc3, 0x48, 0x0e, 0x2a,
+	     0x39, 0xd8, 0xe4, 0x10, 0x94, 0x03, 0x53, 0x0e, 0x55, 0x39,
+	     0x84, 0xe5, 0x60, 0x96, 0xc3, 0x5b, 0x0e, 0x79, 0x39, 0x0c,
+	     0xe6, 0x90, 0x98, 0xc3, 0x64, 0x0e, 0xa0, 0x39, 0x8c, 0xe6,
+	     0x70, 0x9a, 0x03, 0x6b, 0x0e, 0xb1, 0x39, 0xf8, 0xe6, 0x20,
+	     0x9c, 0xc3, 0x72, 0x0e, 0xd8, 0x39, 0x8c, 0xe7, 0xb0, 0x9e,
+	     0x83, 0x7b, 0x0e, 0xf7, 0x39, 0xf0, 0xe7, 0x00, 0xa0, 0xc3,
+	     0x81, 0x0e, 0x10, 0x3a, 0x6c, 0xe8, 0x40, 0xa2, 0x83, 0x8c,
+	     0x0e, 0x3a, 0x3a, 0xfc, 0xe8, 0xc0, 0xa4, 0x03, 0x95, 0x0e,
+	     0x57, 0x3a, 0x7c, 0xe9, 0xb0, 0xa6, 0x83, 0x9b, 0x0e, 0x71,
+	     0x3a, 0xf0, 0xe9, 0x20, 0xa8, 0xc3, 0xa2, 0x0e, 0x8f, 0x3a,
+	     0x54, 0xea, 0x30, 0xaa, 0xc3, 0xab, 0x0e, 0xb2, 0x3a, 0xe0,
+	     0xea, 0x30, 0xac, 0x43, 0xb3, 0x0e, 0xd1, 0x3a, 0x74, 0xeb,
+	     0xf0, 0xad, 0x83, 0xb9, 0x0e, 0xf2, 0x3a, 0xe0, 0xeb, 0x60,
+	     0xb0, 0x03, 0xc4, 0x0e, 0x1e, 0x3b, 0x94, 0xec, 0x20, 0xb3,
+	     0x83, 0xce, 0x0e, 0x44, 0x3b, 0x44, 0xed, 0xa0, 0xb5, 0x43,
+	     0xd7, 0x0e, 0x65, 0x3b, 0xa0, 0xed, 0xe0, 0xb6, 0x03, 0xdd,
+	     0x0e, 0x76, 0x3b, 0x04, 0xee, 0xa0, 0xb8, 0x43, 0xe3, 0x0e,
+	     0x99, 0x3b, 0x7c, 0xee, 0x80, 0xba, 0x83, 0xeb, 0x0e, 0xb6,
+	     0x3b, 0xec, 0xee, 0x10, 0xbc, 0xc3, 0xf3, 0x0e, 0xd5, 0x3b,
+	     0x6c, 0xef, 0x40, 0xbe, 0x43, 0xfa, 0x0e, 0xf7, 0x3b, 0x00,
+	     0xf0, 0x50, 0xc0, 0x03, 0x02, 0x0f, 0x0d, 0x3c, 0x40, 0xf0,
+	     0x80, 0xc1, 0xc3, 0x07, 0x0f, 0x28, 0x3c, 0xa8, 0xf0, 0x00,
+	     0xc3, 0x43, 0x0d, 0x0f, 0x3b, 0x3c, 0x10, 0xf1, 0xb0, 0xc4,
+	     0x03, 0x16, 0x0f, 0x64, 0x3c, 0xb8, 0xf1, 0x60, 0xc7, 0xc3,
+	     0x1f, 0x0f, 0x84, 0x3c, 0x30, 0xf2, 0x40, 0xc9, 0x03, 0x27,
+	     0x0f, 0xa5, 0x3c, 0xa0, 0xf2, 0x20, 0xcb, 0x03, 0x2f, 0x0f,
+	     0xc8, 0x3c, 0x3c, 0xf3, 0x40, 0xcd, 0xc3, 0x35, 0x0f, 0xe2,
+	     0x3c, 0x94, 0xf3, 0xb0, 0xce, 0x43, 0x3e, 0x0f, 0xfe, 0x3c,
+	     0x18, 0xf4, 0xc0, 0xd0, 0x03, 0x44, 0x0f, 0x13, 0x3d, 0x84,
+	     0xf4, 0x80, 0xd2, 0x03, 0x4c, 0x0f, 0x3e, 0x3d, 0x08, 0xf5,
+	     0xd0, 0xd4, 0x43, 0x56, 0x0f, 0x5d, 0x3d, 0xac, 0xf5, 0x90,
+	     0xd7, 0x03, 0x61, 0x0f, 0x86, 0x3d, 0x48, 0xf6, 0x80, 0xd9,
+	     0x03, 0x69, 0x0f, 0xac, 0x3d, 0xbc, 0xf6, 0xa0, 0xdb, 0x43,
+	     0x71, 0x0f, 0xd2, 0x3d, 0x60, 0xf7, 0xf0, 0xdd, 0xc3, 0x79,
+	     0x0f, 0xea, 0x3d, 0xd4, 0xf7, 0xd0, 0xdf, 0xc3, 0x82, 0x0f,
+	     0x0f, 0x3e, 0x58, 0xf8, 0xf0, 0xe1, 0x43, 0x8a, 0x0f, 0x35,
+	     0x3e, 0xe8, 0xf8, 0x50, 0xe4, 0xc3, 0x92, 0x0f, 0x4d, 0x3e,
+	     0x40, 0xf9, 0x40, 0xe5, 0x83, 0x96, 0x0f, 0x67, 0x3e, 0xbc,
+	     0xf9, 0x90, 0xe7, 0x43, 0x9f, 0x0f, 0x89, 0x3e, 0x3c, 0xfa,
+	     0xb0, 0xe9, 0x43, 0xaa, 0x0f, 0xae, 0x3e, 0xd8, 0xfa, 0x10,
+	     0xec, 0xc3, 0xb2, 0x0f, 0xd6, 0x3e, 0x80, 0xfb, 0x90, 0xee,
+	     0x43, 0xbb, 0x0f, 0xfa, 0x3e, 0x20, 0xfc, 0xc0, 0xf0, 0x03,
+	     0xc6, 0x0f, 0x25, 0x3f, 0xb4, 0xfc, 0x10, 0xf3, 0xc3, 0xce,
+	     0x0f, 0x40, 0x3f, 0x0c, 0xfd, 0xe0, 0xf4, 0x43, 0xd6, 0x0f,
+	     0x5e, 0x3f, 0x8c, 0xfd, 0x50, 0xf6, 0x83, 0xdb, 0x0f, 0x72,
+	     0x3f, 0xf0, 0xfd, 0x50, 0xf8, 0x83, 0xe3, 0x0f, 0x98, 0x3f,
+	     0x80, 0xfe, 0x40, 0xfa, 0x83, 0xec, 0x0f, 0xbd, 0x3f, 0x04,
+	     0xff, 0x80, 0xfc, 0x43, 0xf5, 0x0f, 0xdb, 0x3f, 0x78, 0xff,
+	     0x60, 0xfe, 0x43, 0xfc, 0x0f, 0xfa, 0x3f, 0x1c, 0x00, 0x01,
+	     0x01, 0x84, 0x07, 0x10, 0x27, 0x40, 0xc8, 0x00, 0x91, 0x03,
+	     0x44, 0x11, 0x10, 0x48, 0x40, 0x40, 0x01, 0x41, 0x05, 0xc4,
+	     0x15, 0x10, 0x5e, 0x40, 0x90, 0x01, 0xb1, 0x06, 0x44, 0x1d,
+	     0x10, 0x7b, 0x40, 0xf4, 0x01, 0x51, 0x08, 0xc4, 0x24, 0x10,
+	     0x96, 0x40, 0x68, 0x02, 0x21, 0x0a, 0xc4, 0x29, 0x10, 0xaf,
+	     0x40, 0xe0, 0x02, 0x41, 0x0c, 0x84, 0x32, 0x10, 0xd0, 0x40,
+	     0x50, 0x03, 0xc1, 0x0d, 0xc4, 0x37, 0x10, 0xe6, 0x40, 0xb4,
+	     0x03, 0x41, 0x0f, 0x04, 0x3e, 0x10, 0xfd, 0x40, 0x08, 0x04,
+	     0xe1, 0x10, 0x84, 0x46, 0x10, 0x28, 0x41, 0xac, 0x04, 0xf1,
+	     0x12, 0x44, 0x4e, 0x10, 0x3e, 0x41, 0x10, 0x05, 0x71, 0x14,
+	     0x84, 0x54, 0x10, 0x5a, 0x41, 0x70, 0x05, 0x31, 0x16, 0xc4,
+	     0x5a, 0x10, 0x6f, 0x41, 0xe0, 0x05, 0xd1, 0x17, 0x84, 0x61,
+	     0x10, 0x94, 0x41, 0x7c, 0x06, 0x91, 0x1a, 0x04, 0x6c, 0x10,
+	     0xb8, 0x41, 0xec, 0x06, 0xf1, 0x1b, 0x44, 0x72, 0x10, 0xcf,
+	     0x41, 0x50, 0x07, 0xa1, 0x1d, 0x44, 0x77, 0x10, 0xe6, 0x41,
+	     0xd0, 0x07, 0x71, 0x1f, 0x44, 0x81, 0x10, 0x07, 0x42, 0x3c,
+	     0x08, 0xd1, 0x21, 0xc4, 0x8a, 0x10, 0x31, 0x42, 0xe8, 0x08,
+	     0xd1, 0x23, 0x04, 0x92, 0x10, 0x51, 0x42, 0x60, 0x09, 0x61,
+	     0x26, 0x04, 0x9b, 0x10, 0x72, 0x42, 0x00, 0x0a, 0x51, 0x28,
+	     0x84, 0xa3, 0x10, 0x9b, 0x42, 0x80, 0x0a, 0xd1, 0x2a, 0x84,
+	     0xae, 0x10, 0xbe, 0x42, 0x0c, 0x0b, 0xc1, 0x2c, 0x84, 0xb6,
+	     0x10, 0xdf, 0x42, 0xb4, 0x0b, 0x91, 0x2f, 0x84, 0xbf, 0x10,
+	     0x01, 0x43, 0x14, 0x0c, 0xe1, 0x30, 0x04, 0xc7, 0x10, 0x2a,
+	     0x43, 0xe0, 0x0c, 0xb1, 0x33, 0x84, 0xd0, 0x10, 0x44, 0x43,
+	     0x38, 0x0d, 0x41, 0x35, 0x44, 0xd8, 0x10, 0x65, 0x43, 0xa8,
+	     0x0d, 0x21, 0x37, 0xc4, 0xdd, 0x10, 0x7c, 0x43, 0x08, 0x0e,
+	     0xb1, 0x38, 0x04, 0xe4, 0x10, 0x9e, 0x43, 0x98, 0x0e, 0x21,
+	     0x3b, 0x04, 0xf0, 0x10, 0xcc, 0x43, 0x60, 0x0f, 0x61, 0x3e,
+	     0x44, 0xfa, 0x10, 0xf2, 0x43, 0xf4, 0x0f, 0x81, 0x40, 0x44,
+	     0x04, 0x11, 0x17, 0x44, 0x7c, 0x10, 0x31, 0x42, 0x84, 0x0a,
+	     0x11, 0x2d, 0x44, 0xc4, 0x10, 0x41, 0x43, 0xc4, 0x0d, 0x11,
+	     0x44, 0x44, 0x18, 0x11, 0x01, 0x45, 0x04, 0x16, 0x11, 0x5d,
+	     0x44, 0x88, 0x11, 0xc1, 0x46, 0x44, 0x1c, 0x11, 0x7e, 0x44,
+	     0x08, 0x12, 0xd1, 0x48, 0x44, 0x26, 0x11, 0x9f, 0x44, 0xb0,
+	     0x12, 0x51, 0x4b, 0x84, 0x2e, 0x11, 0xc1, 0x44, 0x14, 0x13,
+	     0x11, 0x4d, 0x04, 0x35, 0x11, 0xe1, 0x44, 0x90, 0x13, 0x11,
+	     0x4f, 0xc4, 0x3f, 0x11, 0x0d, 0x45, 0x48, 0x14, 0x81, 0x51,
+	     0x84, 0x48, 0x11, 0x2a, 0x45, 0xd0, 0x14, 0x61, 0x53, 0x04,
+	     0x50, 0x11, 0x48, 0x45, 0x48, 0x15, 0x91, 0x55, 0x44, 0x59,
+	     0x11, 0x6e, 0x45, 0xc8, 0x15, 0xf1, 0x57, 0x44, 0x62, 0x11,
+	     0x92, 0x45, 0x64, 0x16, 0x61, 0x5a, 0x04, 0x6c, 0x11, 0xba,
+	     0x45, 0x0c, 0x17, 0x71, 0x5c, 0x84, 0x72, 0x11, 0xd0, 0x45,
+	     0x70, 0x17, 0x01, 0x5e, 0x44, 0x79, 0x11, 0xec, 0x45, 0xe8,
+	     0x17, 0x01, 0x60, 0x44, 0x81, 0x11, 0x0a, 0x46, 0x4c, 0x18,
+	     0x91, 0x61, 0x44, 0x88, 0x11, 0x23, 0x46, 0x9c, 0x18, 0x41,
+	     0x63, 0x44, 0x8e, 0x11, 0x45, 0x46, 0x38, 0x19, 0x11, 0x65,
+	     0x44, 0x95, 0x11, 0x58, 0x46, 0x7c, 0x19, 0x21, 0x66, 0x04,
+	     0x9c, 0x11, 0x79, 0x46, 0x00, 0x1a, 0x41, 0x68, 0x04, 0xa2,
+	     0x11, 0x90, 0x46, 0x50, 0x1a, 0xd1, 0x69, 0x84, 0xa8, 0x11,
+	     0xaa, 0x46, 0xc8, 0x1a, 0xe1, 0x6b, 0x44, 0xb1, 0x11, 0xd0,
+	     0x46, 0x60, 0x1b, 0x61, 0x6e, 0x84, 0xbb, 0x11, 0xf3, 0x46,
+	     0xd8, 0x1b, 0xe1, 0x6f, 0x44, 0xc2, 0x11, 0x15, 0x47, 0x5c,
+	     0x1c, 0xd1, 0x71, 0x44, 0xc9, 0x11, 0x2b, 0x47, 0xe4, 0x1c,
+	     0xd1, 0x73, 0x84, 0xd0, 0x11, 0x4a, 0x47, 0x40, 0x1d, 0x51,
+	     0x75, 0xc4, 0xd6, 0x11, 0x63, 0x47, 0xb4, 0x1d, 0xb1, 0x77,
+	     0x04, 0xe2, 0x11, 0x93, 0x47, 0x68, 0x1e, 0xd1, 0x79, 0x04,
+	     0xe8, 0x11, 0xa9, 0x47, 0xd0, 0x1e, 0x71, 0x7b, 0xc4, 0xf0,
+	     0x11, 0xd1, 0x47, 0x5c, 0x1f, 0x31, 0x7e, 0x04, 0xfc, 0x11,
+	     0xfc, 0x47, 0x08, 0x20, 0x81, 0x80, 0x04, 0x04, 0x12, 0x1c,
+	     0x48, 0x78, 0x20, 0x31, 0x82, 0xc4, 0x0a, 0x12, 0x34, 0x48,
+	     0xe8, 0x20, 0x51, 0x84, 0x84, 0x14, 0x12, 0x5e, 0x48, 0x84,
+	     0x21, 0xa1, 0x86, 0x04, 0x1e, 0x12, 0x85, 0x48, 0x30, 0x22,
+	     0xa1, 0x89, 0x84, 0x27, 0x12, 0xa2, 0x48, 0x94, 0x22, 0x91,
+	     0x8a, 0x04, 0x2b, 0x12, 0xb0, 0x48, 0xcc, 0x22, 0xb1, 0x8b,
+	     0x44, 0x2f, 0x12, 0xc3, 0x48, 0x3c, 0x23, 0x71, 0x8d, 0x04,
+	     0x37, 0x12, 0xe7, 0x48, 0xd0, 0x23, 0xa1, 0x8f, 0x84, 0x40,
+	     0x12, 0x06, 0x49, 0x24, 0x24, 0x31, 0x91, 0x04, 0x46, 0x12,
+	     0x23, 0x49, 0xc4, 0x24, 0x61, 0x93, 0x04, 0x4f, 0x12, 0x46,
+	     0x49, 0x40, 0x25, 0x31, 0x95, 0xc4, 0x55, 0x12, 0x5c, 0x49,
+	     0x90, 0x25, 0xb1, 0x96, 0x04, 0x5c, 0x12, 0x76, 0x49, 0x0c,
+	     0x26, 0x11, 0x99, 0xc4, 0x67, 0x12, 0xa8, 0x49, 0xa8, 0x26,
+	     0x21, 0x9b, 0xc4, 0x6e, 0x12, 0xbf, 0x49, 0x0c, 0x27, 0xf1,
+	     0x9c, 0x04, 0x76, 0x12, 0xe0, 0x49, 0xa8, 0x27, 0x61, 0x9f,
+	     0x44, 0x7e, 0x12, 0x03, 0x4a, 0x2c, 0x28, 0x51, 0xa1, 0x84,
+	     0x87, 0x12, 0x24, 0x4a, 0xb4, 0x28, 0x21, 0xa3, 0x04, 0x8f,
+	     0x12, 0x4a, 0x4a, 0x38, 0x29, 0x71, 0xa5, 0x44, 0x99, 0x12,
+	     0x70, 0x4a, 0xf8, 0x29, 0xa1, 0xa8, 0x04, 0xa4, 0x12, 0x93,
+	     0x4a, 0x74, 0x2a, 0xf1, 0xa9, 0x84, 0xa8, 0x12, 0xa6, 0x4a,
+	     0xa4, 0x2a, 0xe1, 0xaa, 0x04, 0xae, 0x12, 0xc1, 0x4a, 0x34,
+	     0x2b, 0x21, 0xad, 0x04, 0xb6, 0x12, 0xe1, 0x4a, 0xa8, 0x2b,
+	     0xe1, 0xae, 0xc4, 0xbe, 0x12, 0x09, 0x4b, 0x54, 0x2c, 0x81,
+	     0xb1, 0x84, 0xc7, 0x12, 0x27, 0x4b, 0xc8, 0x2c, 0xf1, 0xb3,
+	     0xc4, 0xd2, 0x12, 0x53, 0x4b, 0x78, 0x2d, 0x41, 0xb6, 0xc4,
+	     0xd9, 0x12, 0x6c, 0x4b, 0xd8, 0x2d, 0xd1, 0xb7, 0xc4, 0xdf,
+	     0x12, 0x86, 0x4b, 0x44, 0x2e, 0x61, 0xb9, 0x04, 0xe7, 0x12,
+	     0xaa, 0x4b, 0xcc, 0x2e, 0x71, 0xbb, 0xc4, 0xf0, 0x12, 0xca,
+	     0x4b, 0x44, 0x2f, 0xe1, 0xbd, 0x44, 0xf9, 0x12, 0xec, 0x4b,
+	     0xcc, 0x2f, 0x71, 0xbf, 0x44, 0xff, 0x12, 0x02, 0x4c, 0x14,
+	     0x30, 0x01, 0xc1, 0x04, 0x05, 0x13, 0x19, 0x4c, 0x78, 0x30,
+	     0x21, 0xc2, 0x84, 0x0a, 0x13, 0x31, 0x4c, 0xd8, 0x30, 0xe1,
+	     0xc3, 0x44, 0x12, 0x13, 0x55, 0x4c, 0x8c, 0x31, 0x81, 0xc6,
+	     0xc4, 0x1b, 0x13, 0x77, 0x4c, 0xfc, 0x31, 0x11, 0xc8, 0x04,
+	     0x21, 0x13, 0x87, 0x4c, 0x34, 0x32, 0xb1, 0xc9, 0x84, 0x29,
+	     0x13, 0xaf, 0x4c, 0xd4, 0x32, 0x31, 0xcc, 0x44, 0x34, 0x13,
+	     0xd9, 0x4c, 0x9c, 0x33, 0xf1, 0xce, 0xc4, 0x3c, 0x13, 0xf8,
+	     0x4c, 0xec, 0x33, 0xf1, 0xcf, 0x44, 0x43, 0x13, 0x18, 0x4d,
+	     0x78, 0x34, 0x81, 0xd2, 0x04, 0x4b, 0x13, 0x38, 0x4d, 0xf0,
+	     0x34, 0x21, 0xd4, 0xc4, 0x51, 0x13, 0x54, 0x4d, 0x68, 0x35,
+	     0x71, 0xd6, 0x84, 0x5b, 0x13, 0x70, 0x4d, 0xf4, 0x35, 0x61,
+	     0xd8, 0x84, 0x64, 0x13, 0x9a, 0x4d, 0x8c, 0x36, 0x61, 0xda,
+	     0xc4, 0x6c, 0x13, 0xc1, 0x4d, 0x30, 0x37, 0x41, 0xdd, 0x04,
+	     0x76, 0x13, 0xdb, 0x4d, 0x8c, 0x37, 0x01, 0xdf, 0x04, 0x7f,
+	     0x13, 0x07, 0x4e, 0x4c, 0x38, 0xe1, 0xe1, 0x84, 0x89, 0x13,
+	     0x2c, 0x4e, 0xdc, 0x38, 0x21, 0xe4, 0x84, 0x93, 0x13, 0x55,
+	     0x4e, 0x68, 0x39, 0x71, 0xe6, 0x44, 0x9a, 0x13, 0x75, 0x4e,
+	     0xe0, 0x39, 0x31, 0xe8, 0x04, 0xa4, 0x13, 0x94, 0x4e, 0x88,
+	     0x3a, 0x91, 0xea, 0xc4, 0xac, 0x13, 0xc0, 0x4e, 0x24, 0x3b,
+	     0xe1, 0xec, 0xc4, 0xb4, 0x13, 0xdd, 0x4e, 0xa4, 0x3b, 0x61,
+	     0xef, 0x04, 0xc1, 0x13, 0x0a, 0x4f, 0x40, 0x3c, 0x71, 0xf1,
+	     0x84, 0xc6, 0x13, 0x1f, 0x4f, 0x90, 0x3c, 0x71, 0xf2, 0x44,
+	     0xcc, 0x13, 0x36, 0x4f, 0x00, 0x3d, 0x71, 0xf4, 0x84, 0xd3,
+	     0x13, 0x5a, 0x4f, 0x7c, 0x3d, 0xb1, 0xf6, 0x04, 0xdc, 0x13,
+	     0x77, 0x4f, 0xe8, 0x3d, 0xf1, 0xf7, 0x44, 0xe0, 0x13, 0x84,
+	     0x4f, 0x2c, 0x3e, 0x41, 0xf9, 0x84, 0xe6, 0x13, 0xa6, 0x4f,
+	     0xc0, 0x3e, 0x51, 0xfb, 0x04, 0xef, 0x13, 0xc4, 0x4f, 0x30,
+	     0x3f, 0x61, 0xfd, 0x44, 0xf8, 0x13, 0xe7, 0x4f, 0xd0, 0x3f,
+	     0xc1, 0xff, 0x04, 0x02, 0x14, 0x0d, 0x50, 0x48, 0x40, 0x91,
+	     0x01, 0x45, 0x09, 0x14, 0x31, 0x50, 0xe4, 0x40, 0xb1, 0x03,
+	     0x85, 0x11, 0x14, 0x4b, 0x50, 0x3c, 0x41, 0x81, 0x05, 0xc5,
+	     0x18, 0x14, 0x6c, 0x50, 0xe4, 0x41, 0x41, 0x08, 0x45, 0x22,
+	     0x14, 0x8d, 0x50, 0x58, 0x42, 0x21, 0x0a, 0x85, 0x29, 0x14,
+	     0xb2, 0x50, 0xe4, 0x42, 0x21, 0x0c, 0x05, 0x32, 0x14, 0xcf,
+	     0x50, 0x68, 0x43, 0xd1, 0x0d, 0x45, 0x3a, 0x14, 0xed, 0x50,
+	     0xc4, 0x43, 0xe1, 0x0f, 0x85, 0x42, 0x14, 0x13, 0x51, 0x64,
+	     0x44, 0xb1, 0x11, 0x85, 0x47, 0x14, 0x22, 0x51, 0x9c, 0x44,
+	     0xa1, 0x12, 0x05, 0x4c, 0x14, 0x36, 0x51, 0x08, 0x45, 0xe1,
+	     0x14, 0x85, 0x55, 0x14, 0x62, 0x51, 0xbc, 0x45, 0xa1, 0x17,
+	     0x45, 0x61, 0x14, 0x92, 0x51, 0x68, 0x46, 0x61, 0x1a, 0x05,
+	     0x6b, 0x14, 0xb7, 0x51, 0x10, 0x47, 0x81, 0x1c, 0xc5, 0x72,
+	     0x14, 0xd5, 0x51, 0x70, 0x47, 0x61, 0x1e, 0x85, 0x7a, 0x14,
+	     0xf4, 0x51, 0x08, 0x48, 0xf1, 0x20, 0x85, 0x86, 0x14, 0x24,
+	     0x52, 0xb8, 0x48, 0xb1, 0x23, 0x05, 0x90, 0x14, 0x48, 0x52,
+	     0x28, 0x49, 0x11, 0x25, 0x05, 0x95, 0x14, 0x5e, 0x52, 0x98,
+	     0x49, 0xa1, 0x26, 0x05, 0x9c, 0x14, 0x7e, 0x52, 0x08, 0x4a,
+	     0x81, 0x28, 0x85, 0xa5, 0x14, 0xa0, 0x52, 0x94, 0x4a, 0xa1,
+	     0x2a, 0xc5, 0xad, 0x14, 0xc2, 0x52, 0x3c, 0x4b, 0x71, 0x2d,
+	     0xc5, 0xb6, 0x14, 0xe6, 0x52, 0xa4, 0x4b, 0x31, 0x2f, 0x45,
+	     0xbf, 0x14, 0x01, 0x53, 0x2c, 0x4c, 0x61, 0x31, 0x85, 0xc8,
+	     0x14, 0x26, 0x53, 0xc4, 0x4c, 0xb1, 0x33, 0x45, 0xd1, 0x14,
+	     0x47, 0x53, 0x3c, 0x4d, 0xa1, 0x35, 0x05, 0xd9, 0x14, 0x6d,
+	     0x53, 0xcc, 0x4d, 0x81, 0x37, 0x05, 0xdf, 0x14, 0x85, 0x53,
+	     0x24, 0x4e, 0xc1, 0x38, 0x05, 0xe5, 0x14, 0x99, 0x53, 0x94,
+	     0x4e, 0xe1, 0x3a, 0x05, 0xee, 0x14, 0xbe, 0x53, 0x04, 0x4f,
+	     0x91, 0x3c, 0x05, 0xf3, 0x14, 0xd7, 0x53, 0x78, 0x4f, 0x41,
+	     0x3e, 0x85, 0xfb, 0x14, 0xf4, 0x53, 0x08, 0x50, 0xd1, 0x40,
+	     0x45, 0x04, 0x15, 0x1f, 0x54, 0x90, 0x50, 0xc1, 0x42, 0x85,
+	     0x0b, 0x15, 0x37, 0x54, 0xec, 0x50, 0x21, 0x44, 0x85, 0x11,
+	     0x15, 0x4e, 0x54, 0x4c, 0x51, 0x81, 0x45, 0x45, 0x17, 0x15,
+	     0x66, 0x54, 0xbc, 0x51, 0xd1, 0x47, 0xc5, 0x22, 0x15, 0x96,
+	     0x54, 0x74, 0x52, 0x21, 0x4a, 0xc5, 0x29, 0x15, 0xb3, 0x54,
+	     0xf0, 0x52, 0x21, 0x4c, 0x05, 0x34, 0x15, 0xdd, 0x54, 0x7c,
+	     0x53, 0x71, 0x4e, 0x05, 0x3d, 0x15, 0xff, 0x54, 0x34, 0x54,
+	     0xb1, 0x51, 0x45, 0x48, 0x15, 0x2f, 0x55, 0xd4, 0x54, 0xb1,
+	     0x53, 0x85, 0x4f, 0x15, 0x4a, 0x55, 0x40, 0x55, 0xb1, 0x55,
+	     0x85, 0x58, 0x15, 0x66, 0x55, 0xc8, 0x55, 0x01, 0x58, 0x45,
+	     0x61, 0x15, 0x8e, 0x55, 0x64, 0x56, 0x31, 0x5a, 0xc5, 0x6a,
+	     0x15, 0xb0, 0x55, 0xf4, 0x56, 0x31, 0x5c, 0x85, 0x71, 0x15,
+	     0xcf, 0x55, 0x5c, 0x57, 0x11, 0x5e, 0xc5, 0x7a, 0x15, 0xf7,
+	     0x55, 0xfc, 0x57, 0x21, 0x60, 0xc5, 0x81, 0x15, 0x0c, 0x56,
+	     0x48, 0x58, 0x71, 0x61, 0x05, 0x89, 0x15, 0x2e, 0x56, 0xc8,
+	     0x58, 0x71, 0x63, 0x85, 0x8e, 0x15, 0x42, 0x56, 0x18, 0x59,
+	     0x21, 0x65, 0x85, 0x95, 0x15, 0x5c, 0x56, 0x78, 0x59, 0x91,
+	     0x66, 0x85, 0x9d, 0x15, 0x84, 0x56, 0x3c, 0x5a, 0x61, 0x69,
+	     0xc5, 0xa7, 0x15, 0xa9, 0x56, 0xc0, 0x5a, 0xd1, 0x6b, 0x05,
+	     0xb2, 0x15, 0xd1, 0x56, 0x78, 0x5b, 0x51, 0x6e, 0x05, 0xba,
+	     0x15, 0xef, 0x56, 0xec, 0x5b, 0x41, 0x70, 0xc5, 0xc2, 0x15,
+	     0x0f, 0x57, 0x6c, 0x5c, 0x81, 0x72, 0x85, 0xcd, 0x15, 0x3e,
+	     0x57, 0x1c, 0x5d, 0xa1, 0x74, 0xc5, 0xd3, 0x15, 0x5c, 0x57,
+	     0x80, 0x5d, 0x41, 0x76, 0x85, 0xda, 0x15, 0x6c, 0x57, 0xdc,
+	     0x5d, 0xc1, 0x77, 0x05, 0xe0, 0x15, 0x89, 0x57, 0x38, 0x5e,
+	     0xa1, 0x79, 0x45, 0xe9, 0x15, 0xb0, 0x57, 0xdc, 0x5e, 0xe1,
+	     0x7b, 0x85, 0xf1, 0x15, 0xd3, 0x57, 0x5c, 0x5f, 0x21, 0x7e,
+	     0x85, 0xfa, 0x15, 0xf7, 0x57, 0xf8, 0x5f, 0x21, 0x80, 0x85,
+	     0x01, 0x16, 0x11, 0x58, 0x5c, 0x60, 0xc1, 0x81, 0x45, 0x08,
+	     0x16, 0x2d, 0x58, 0xec, 0x60, 0x91, 0x84, 0x45, 0x13, 0x16,
+	     0x5a, 0x58, 0xa0, 0x61, 0x51, 0x87, 0xc5, 0x1e, 0x16, 0x83,
+	     0x58, 0x20, 0x62, 0xa1, 0x88, 0x05, 0x25, 0x16, 0x9d, 0x58,
+	     0xac, 0x62, 0x11, 0x8b, 0x05, 0x2f, 0x16, 0xc9, 0x58, 0x38,
+	     0x63, 0xb1, 0x8d, 0x05, 0x38, 0x16, 0xe5, 0x58, 0xc4, 0x63,
+	     0x41, 0x8f, 0x85, 0x3e, 0x16, 0x07, 0x59, 0x54, 0x64, 0xd1,
+	     0x91, 0x45, 0x4a, 0x16, 0x2c, 0x59, 0xc0, 0x64, 0xc1, 0x93,
+	     0xc5, 0x4f, 0x16, 0x4d, 0x59, 0x64, 0x65, 0xb1, 0x95, 0x85,
+	     0x58, 0x16, 0x68, 0x59, 0xd8, 0x65, 0x21, 0x98, 0x85, 0x61,
+	     0x16, 0x90, 0x59, 0x60, 0x66, 0xb1, 0x99, 0x85, 0x67, 0x16,
+	     0xa4, 0x59, 0xb4, 0x66, 0x01, 0x9b, 0x45, 0x6d, 0x16, 0xc3,
+	     0x59, 0x30, 0x67, 0xf1, 0x9c, 0x45, 0x75, 0x16, 0xe1, 0x59,
+	     0xa4, 0x67, 0xd1, 0x9e, 0x05, 0x7c, 0x16, 0xf3, 0x59, 0xe4,
+	     0x67, 0x51, 0xa0, 0x05, 0x82, 0x16, 0x0e, 0x5a, 0x70, 0x68,
+	     0x11, 0xa2, 0xc5, 0x88, 0x16, 0x2e, 0x5a, 0xd4, 0x68, 0x11,
+	     0xa4, 0x85, 0x92, 0x16, 0x55, 0x5a, 0x7c, 0x69, 0x41, 0xa6,
+	     0x05, 0x9c, 0x16, 0x77, 0x5a, 0x10, 0x6a, 0x71, 0xa8, 0x85,
+	     0xa2, 0x16, 0x96, 0x5a, 0x78, 0x6a, 0x31, 0xaa, 0x05, 0xac,
+	     0x16, 0xbb, 0x5a, 0x08, 0x6b, 0xd1, 0xac, 0x45, 0xb5, 0x16,
+	     0xd9, 0x5a, 0x84, 0x6b, 0x61, 0xae, 0x85, 0xbc, 0x16, 0xf4,
+	     0x5a, 0xfc, 0x6b, 0x31, 0xb0, 0xc5, 0xc2, 0x16, 0x13, 0x5b,
+	     0x60, 0x6c, 0x01, 0xb2, 0x45, 0xcb, 0x16, 0x38, 0x5b, 0x00,
+	     0x6d, 0x91, 0xb4, 0x45, 0xd5, 0x16, 0x5c, 0x5b, 0x88, 0x6d,
+	     0xc1, 0xb6, 0x05, 0xdd, 0x16, 0x7a, 0x5b, 0x04, 0x6e, 0xf1,
+	     0xb8, 0xc5, 0xe5, 0x16, 0xa0, 0x5b, 0xb0, 0x6e, 0xa1, 0xbb,
+	     0x85, 0xf0, 0x16, 0xce, 0x5b, 0x44, 0x6f, 0xf1, 0xbd, 0x45,
+	     0xf8, 0x16, 0xe5, 0x5b, 0xc8, 0x6f, 0xf1, 0xbf, 0x05, 0x02,
+	     0x17, 0x10, 0x5c, 0x54, 0x70, 0xa1, 0xc1, 0x85, 0x07, 0x17,
+	     0x25, 0x5c, 0xa8, 0x70, 0x61, 0xc3, 0x85, 0x0e, 0x17, 0x40,
+	     0x5c, 0x34, 0x71, 0x81, 0xc5, 0x45, 0x18, 0x17, 0x6a, 0x5c,
+	     0xdc, 0x71, 0xd1, 0xc7, 0x05, 0x20, 0x17, 0x85, 0x5c, 0x28,
+	     0x72, 0x21, 0xc9, 0x05, 0x26, 0x17, 0xa2, 0x5c, 0xbc, 0x72,
+	     0x21, 0xcb, 0x85, 0x2f, 0x17, 0xc8, 0x5c, 0x58, 0x73, 0xa1,
+	     0xcd, 0x45, 0x37, 0x17, 0xe6, 0x5c, 0xac, 0x73, 0xd1, 0xce,
+	     0xc5, 0x3d, 0x17, 0xff, 0x5c, 0x0c, 0x74, 0x11, 0xd1, 0x85,
+	     0x45, 0x17, 0x20, 0x5d, 0x8c, 0x74, 0x11, 0xd3, 0x85, 0x4d,
+	     0x17, 0x3e, 0x5d, 0x10, 0x75, 0x01, 0xd5, 0x05, 0x56, 0x17,
+	     0x5d, 0x5d, 0x84, 0x75, 0x61, 0xd6, 0xc5, 0x5a, 0x17, 0x77,
+	     0x5d, 0xe8, 0x75, 0x71, 0xd8, 0x45, 0x65, 0x17, 0x99, 0x5d,
+	     0x90, 0x76, 0x01, 0xdb, 0x05, 0x6d, 0x17, 0xc0, 0x5d, 0x1c,
+	     0x77, 0xf1, 0xdc, 0x85, 0x75, 0x17, 0xdd, 0x5d, 0xac, 0x77,
+	     0xf1, 0xde, 0x05, 0x7f, 0x17, 0x09, 0x5e, 0x34, 0x78, 0x91,
+	     0xe1, 0xc5, 0x88, 0x17, 0x27, 0x5e, 0xa4, 0x78, 0xe1, 0xe2,
+	     0xc5, 0x8c, 0x17, 0x40, 0x5e, 0x1c, 0x79, 0xd1, 0xe4, 0x85,
+	     0x95, 0x17, 0x59, 0x5e, 0x84, 0x79, 0xd1, 0xe6, 0x45, 0x9c,
+	     0x17, 0x7a, 0x5e, 0x04, 0x7a, 0xb1, 0xe8, 0xc5, 0xa5, 0x17,
+	     0x9f, 0x5e, 0x94, 0x7a, 0xf1, 0xea, 0x45, 0xad, 0x17, 0xbe,
+	     0x5e, 0x14, 0x7b, 0xe1, 0xec, 0xc5, 0xb6, 0x17, 0xe0, 0x5e,
+	     0xa8, 0x7b, 0x71, 0xef, 0xc5, 0xbf, 0x17, 0x0a, 0x5f, 0x48,
+	     0x7c, 0x51, 0xf1, 0x05, 0xc7, 0x17, 0x22, 0x5f, 0x98, 0x7c,
+	     0x81, 0xf2, 0xc5, 0xcc, 0x17, 0x40, 0x5f, 0x10, 0x7d, 0xd1,
+	     0xf4, 0xc5, 0xd5, 0x17, 0x5f, 0x5f, 0x98, 0x7d, 0x41, 0xf7,
+	     0x45, 0xdf, 0x17, 0x8b, 0x5f, 0x44, 0x7e, 0x91, 0xf9, 0xc5,
+	     0xe8, 0x17, 0xaf, 0x5f, 0xcc, 0x7e, 0x81, 0xfb, 0x45, 0xf1,
+	     0x17, 0xcb, 0x5f, 0x60, 0x7f, 0xa1, 0xfd, 0x05, 0xf8, 0x17,
+	     0xed, 0x5f, 0xe8, 0x7f, 0x31, 0x00, 0xc6, 0x03, 0x18, 0x1b,
+	     0x60, 0x8c, 0x80, 0xe1, 0x02, 0x86, 0x0c, 0x18, 0x3b, 0x60,
+	     0x04, 0x81, 0xf1, 0x04, 0x46, 0x16, 0x18, 0x62, 0x60, 0xb4,
+	     0x81, 0x41, 0x07, 0xc6, 0x1f, 0x18, 0x86, 0x60, 0x3c, 0x82,
+	     0x31, 0x09, 0xc6, 0x25, 0x18, 0x9e, 0x60, 0xa8, 0x82, 0x11,
+	     0x0b, 0x86, 0x2e, 0x18, 0xc8, 0x60, 0x2c, 0x83, 0x31, 0x0d,
+	     0x46, 0x36, 0x18, 0xe1, 0x60, 0xb8, 0x83, 0x41, 0x0f, 0xc6,
+	     0x3f, 0x18, 0x07, 0x61, 0x38, 0x84, 0x51, 0x11, 0x46, 0x47,
+	     0x18, 0x2a, 0x61, 0xc4, 0x84, 0xb1, 0x13, 0x46, 0x51, 0x18,
+	     0x4f, 0x61, 0x48, 0x85, 0xa1, 0x15, 0xc6, 0x58, 0x18, 0x67,
+	     0x61, 0xb0, 0x85, 0x61, 0x17, 0xc6, 0x5f, 0x18, 0x8b, 0x61,
+	     0x50, 0x86, 0xf1, 0x19, 0xc6, 0x69, 0x18, 0xb1, 0x61, 0xf4,
+	     0x86, 0x61, 0x1c, 0x46, 0x73, 0x18, 0xd1, 0x61, 0x74, 0x87,
+	     0xf1, 0x1d, 0x86, 0x78, 0x18, 0xed, 0x61, 0xec, 0x87, 0x41,
+	     0x20, 0x06, 0x84, 0x18, 0x1e, 0x62, 0xb0, 0x88, 0x31, 0x23,
+	     0x46, 0x8f, 0x18, 0x40, 0x62, 0x18, 0x89, 0x01, 0x25, 0x46,
+	     0x95, 0x18, 0x5b, 0x62, 0x7c, 0x89, 0xd1, 0x26, 0xc6, 0x9e,
+	     0x18, 0x82, 0x62, 0x14, 0x8a, 0x91, 0x28, 0xc6, 0xa3, 0x18,
+	     0x92, 0x62, 0x5c, 0x8a, 0xe1, 0x29, 0x46, 0xa8, 0x18, 0xa7,
+	     0x62, 0xac, 0x8a, 0x91, 0x2b, 0xc6, 0xae, 0x18, 0xc0, 0x62,
+	     0x18, 0x8b, 0x11, 0x2d, 0x46, 0xb5, 0x18, 0xd8, 0x62, 0x98,
+	     0x8b, 0x21, 0x2f, 0xc6, 0xbd, 0x18, 0xfc, 0x62, 0x1c, 0x8c,
+	     0x01, 0x31, 0x46, 0xc5, 0x18, 0x1d, 0x63, 0xa4, 0x8c, 0xc1,
+	     0x32, 0x46, 0xcc, 0x18, 0x3c, 0x63, 0x1c, 0x8d, 0xf1, 0x34,
+	     0x86, 0xd6, 0x18, 0x67, 0x63, 0xd4, 0x8d, 0xa1, 0x37, 0xc6,
+	     0xe1, 0x18, 0x95, 0x63, 0x70, 0x8e, 0xf1, 0x39, 0xc6, 0xe9,
+	     0x18, 0xac, 0x63, 0xd4, 0x8e, 0x71, 0x3b, 0x46, 0xef, 0x18,
+	     0xc4, 0x63, 0x24, 0x8f, 0xc1, 0x3c, 0xc6, 0xf4, 0x18, 0xda,
+	     0x63, 0x74, 0x8f, 0x21, 0x3e, 0x06, 0xfb, 0x18, 0xf1, 0x63,
+	     0xe8, 0x8f, 0x11, 0x40, 0x86, 0x03, 0x19, 0x17, 0x64, 0x80,
+	     0x90, 0xc1, 0x42, 0xc6, 0x0d, 0x19, 0x45, 0x64, 0x40, 0x91,
+	     0x91, 0x45, 0xc6, 0x19, 0x19, 0x70, 0x64, 0xf4, 0x91, 0x31,
+	     0x48, 0x86, 0x22, 0x19, 0x8f, 0x64, 0x48, 0x92, 0x81, 0x49,
+	     0x46, 0x27, 0x19, 0xa3, 0x64, 0xa0, 0x92, 0xe1, 0x4a, 0x86,
+	     0x2e, 0x19, 0xc2, 0x64, 0x2c, 0x93, 0x91, 0x4d, 0x86, 0x37,
+	     0x19, 0xea, 0x64, 0xd8, 0x93, 0xc1, 0x4f, 0x46, 0x41, 0x19,
+	     0x0c, 0x65, 0x58, 0x94, 0x11, 0x52, 0x06, 0x49, 0x19, 0x32,
+	     0x65, 0xdc, 0x94, 0xf1, 0x53, 0x86, 0x52, 0x19, 0x51, 0x65,
+	     0x5c, 0x95, 0x41, 0x56, 0x06, 0x5c, 0x19, 0x7e, 0x65, 0x00,
+	     0x96, 0x31, 0x58, 0xc6, 0x63, 0x19, 0x95, 0x65, 0x8c, 0x96,
+	     0x61, 0x5a, 0xc6, 0x6c, 0x19, 0xba, 0x65, 0xfc, 0x96, 0x81,
+	     0x5c, 0x86, 0x74, 0x19, 0xdb, 0x65, 0x9c, 0x97, 0x21, 0x5f,
+	     0x06, 0x7e, 0x19, 0x00, 0x66, 0x38, 0x98, 0x71, 0x61, 0x86,
+	     0x88, 0x19, 0x2b, 0x66, 0xe4, 0x98, 0x41, 0x64, 0x86, 0x94,
+	     0x19, 0x58, 0x66, 0x74, 0x99, 0x91, 0x66, 0x06, 0x9c, 0x19,
+	     0x77, 0x66, 0xf0, 0x99, 0x21, 0x68, 0x46, 0xa1, 0x19, 0x91,
+	     0x66, 0x68, 0x9a, 0x81, 0x6a, 0x86, 0xad, 0x19, 0xbc, 0x66,
+	     0x08, 0x9b, 0x41, 0x6c, 0xc6, 0xb1, 0x19, 0xcf, 0x66, 0x64,
+	     0x9b, 0xf1, 0x6d, 0x06, 0xbb, 0x19, 0xf3, 0x66, 0x00, 0x9c,
+	     0xa1, 0x70, 0x46, 0xc5, 0x19, 0x1b, 0x67, 0x78, 0x9c, 0x31,
+	     0x72, 0x46, 0xca, 0x19, 0x2c, 0x67, 0xd4, 0x9c, 0x01, 0x74,
+	     0x06, 0xd2, 0x19, 0x4d, 0x67, 0x50, 0x9d, 0xd1, 0x75, 0x06,
+	     0xd9, 0x19, 0x68, 0x67, 0xbc, 0x9d, 0x71, 0x77, 0xc6, 0xde,
+	     0x19, 0x7f, 0x67, 0x14, 0x9e, 0xa1, 0x78, 0xc6, 0xe4, 0x19,
+	     0x95, 0x67, 0x7c, 0x9e, 0xb1, 0x7a, 0x86, 0xeb, 0x19, 0xb9,
+	     0x67, 0xf0, 0x9e, 0x51, 0x7c, 0x06, 0xf4, 0x19, 0xd8, 0x67,
+	     0x7c, 0x9f, 0xc1, 0x7e, 0xc6, 0xfc, 0x19, 0xf9, 0x67, 0xf4,
+	     0x9f, 0x61, 0x80, 0x06, 0x04, 0x1a, 0x13, 0x68, 0x80, 0xa0,
+	     0xa1, 0x82, 0x46, 0x0d, 0x1a, 0x42, 0x68, 0x18, 0xa1, 0xf1,
+	     0x84, 0x06, 0x17, 0x1a, 0x60, 0x68, 0xac, 0xa1, 0x91, 0x87,
+	     0x46, 0x1f, 0x1a, 0x84, 0x68, 0x34, 0xa2, 0xa1, 0x89, 0x06,
+	     0x27, 0x1a, 0xa3, 0x68, 0xb0, 0xa2, 0x01, 0x8b, 0xc6, 0x2d,
+	     0x1a, 0xc4, 0x68, 0x3c, 0xa3, 0x81, 0x8d, 0xc6, 0x36, 0x1a,
+	     0xe8, 0x68, 0xbc, 0xa3, 0x31, 0x8f, 0x06, 0x3f, 0x1a, 0x01,
+	     0x69, 0x24, 0xa4, 0xd1, 0x90, 0x86, 0x46, 0x1a, 0x26, 0x69,
+	     0xd0, 0xa4, 0x71, 0x93, 0x86, 0x4f, 0x1a, 0x4a, 0x69, 0x5c,
+	     0xa5, 0x11, 0x96, 0x46, 0x5b, 0x1a, 0x70, 0x69, 0xe4, 0xa5,
+	     0x31, 0x98, 0x46, 0x61, 0x1a, 0x8f, 0x69, 0x50, 0xa6, 0xa1,
+	     0x99, 0x46, 0x67, 0x1a, 0xa9, 0x69, 0xb0, 0xa6, 0x01, 0x9b,
+	     0x86, 0x6f, 0x1a, 0xc5, 0x69, 0x48, 0xa7, 0x91, 0x9d, 0x86,
+	     0x78, 0x1a, 0xef, 0x69, 0xd0, 0xa7, 0xe1, 0x9f, 0xc6, 0x80,
+	     0x1a, 0x10, 0x6a, 0x4c, 0xa8, 0xf1, 0xa1, 0x46, 0x8b, 0x1a,
+	     0x39, 0x6a, 0xfc, 0xa8, 0x41, 0xa4, 0xc6, 0x92, 0x1a, 0x52,
+	     0x6a, 0x58, 0xa9, 0x81, 0xa5, 0x06, 0x99, 0x1a, 0x6a, 0x6a,
+	     0xb4, 0xa9, 0x11, 0xa7, 0x46, 0x9f, 0x1a, 0x8b, 0x6a, 0x60,
+	     0xaa, 0xc1, 0xa9, 0xc6, 0xa8, 0x1a, 0xa8, 0x6a, 0xd0, 0xaa,
+	     0x71, 0xab, 0x06, 0xaf, 0x1a, 0xc0, 0x6a, 0x28, 0xab, 0x01,
+	     0xad, 0x46, 0xb7, 0x1a, 0xe4, 0x6a, 0xa8, 0xab, 0x21, 0xaf,
+	     0x06, 0xbe, 0x1a, 0x00, 0x6b, 0x0c, 0xac, 0x01, 0xb1, 0x86,
+	     0xc6, 0x1a, 0x1f, 0x6b, 0x98, 0xac, 0x01, 0xb3, 0x86, 0xcf,
+	     0x1a, 0x41, 0x6b, 0x14, 0xad, 0x21, 0xb5, 0x46, 0xd6, 0x1a,
+	     0x5e, 0x6b, 0x98, 0xad, 0x81, 0xb6, 0x86, 0xdc, 0x1a, 0x75,
+	     0x6b, 0x04, 0xae, 0x41, 0xb8, 0x86, 0xe3, 0x1a, 0x96, 0x6b,
+	     0x8c, 0xae, 0x01, 0xbb, 0x46, 0xef, 0x1a, 0xc6, 0x6b, 0x4c,
+	     0xaf, 0x71, 0xbd, 0x46, 0xf7, 0x1a, 0xe4, 0x6b, 0xac, 0xaf,
+	     0x91, 0xbf, 0x06, 0x01, 0x1b, 0x0c, 0x6c, 0x58, 0xb0, 0xf1,
+	     0xc1, 0x06, 0x09, 0x1b, 0x27, 0x6c, 0xcc, 0xb0, 0xb1, 0xc3,
+	     0xc6, 0x10, 0x1b, 0x4d, 0x6c, 0x5c, 0xb1, 0x01, 0xc6, 0x86,
+	     0x19, 0x1b, 0x6f, 0x6c, 0xdc, 0xb1, 0x31, 0xc8, 0x06, 0x23,
+	     0x1b, 0x9a, 0x6c, 0x80, 0xb2, 0x71, 0xca, 0x46, 0x2c, 0x1b,
+	     0xbd, 0x6c, 0x04, 0xb3, 0x41, 0xcc, 0x86, 0x33, 0x1b, 0xd0,
+	     0x6c, 0x6c, 0xb3, 0xf1, 0xcd, 0x06, 0x3b, 0x1b, 0xf6, 0x6c,
+	     0xf8, 0xb3, 0xc1, 0xd0, 0x46, 0x45, 0x1b, 0x1c, 0x6d, 0x84,
+	     0xb4, 0xe1, 0xd2, 0x06, 0x4d, 0x1b, 0x3e, 0x6d, 0x18, 0xb5,
+	     0xf1, 0xd4, 0xc6, 0x56, 0x1b, 0x66, 0x6d, 0xbc, 0xb5, 0x31,
+	     0xd7, 0x46, 0x5e, 0x1b, 0x80, 0x6d, 0x2c, 0xb6, 0x81, 0xd9,
+	     0xc6, 0x67, 0x1b, 0xa8, 0x6d, 0xb4, 0xb6, 0x91, 0xdb, 0x46,
+	     0x70, 0x1b, 0xcd, 0x6d, 0x3c, 0xb7, 0x71, 0xdd, 0xc6, 0x77,
+	     0x1b, 0xeb, 0x6d, 0xe4, 0xb7, 0xe1, 0xdf, 0x06, 0x81, 0x1b,
+	     0x0c, 0x6e, 0x54, 0xb8, 0x21, 0xe2, 0xc6, 0x89, 0x1b, 0x31,
+	     0x6e, 0xdc, 0xb8, 0x01, 0xe4, 0x46, 0x91, 0x1b, 0x4d, 0x6e,
+	     0x58, 0xb9, 0xf1, 0xe5, 0x86, 0x9a, 0x1b, 0x6f, 0x6e, 0xdc,
+	     0xb9, 0x51, 0xe8, 0x06, 0xa2, 0x1b, 0x95, 0x6e, 0x64, 0xba,
+	     0x71, 0xea, 0x46, 0xad, 0x1b, 0xbd, 0x6e, 0x00, 0xbb, 0x71,
+	     0xec, 0x86, 0xb3, 0x1b, 0xd0, 0x6e, 0x58, 0xbb, 0x41, 0xee,
+	     0x86, 0xbb, 0x1b, 0xf8, 0x6e, 0x08, 0xbc, 0x91, 0xf0, 0xc6,
+	     0xc5, 0x1b, 0x1e, 0x6f, 0x88, 0xbc, 0xb1, 0xf2, 0x06, 0xcc,
+	     0x1b, 0x3e, 0x6f, 0x10, 0xbd, 0x71, 0xf4, 0x46, 0xd5, 0x1b,
+	     0x5e, 0x6f, 0xb0, 0xbd, 0x11, 0xf7, 0x06, 0xde, 0x1b, 0x85,
+	     0x6f, 0x24, 0xbe, 0x71, 0xf9, 0x46, 0xe9, 0x1b, 0xb3, 0x6f,
+	     0x04, 0xbf, 0x91, 0xfc, 0x86, 0xf4, 0x1b, 0xda, 0x6f, 0x98,
+	     0xbf, 0x21, 0xff, 0x06, 0xfd, 0x1b, 0xff, 0x6f, 0x08, 0xc0,
+	     0xf1, 0x00, 0x07, 0x06, 0x1c, 0x1d, 0x70, 0xa8, 0xc0, 0x31,
+	     0x03, 0xc7, 0x0d, 0x1c, 0x3d, 0x70, 0x04, 0xc1, 0x81, 0x04,
+	     0xc7, 0x14, 0x1c, 0x57, 0x70, 0x6c, 0xc1, 0xe1, 0x05, 0x87,
+	     0x19, 0x1c, 0x6d, 0x70, 0xec, 0xc1, 0xe1, 0x07, 0xc7, 0x22,
+	     0x1c, 0x97, 0x70, 0x64, 0xc2, 0x21, 0x0a, 0xc7, 0x29, 0x1c,
+	     0xb2, 0x70, 0xd4, 0xc2, 0x81, 0x0b, 0x87, 0x2f, 0x1c, 0xc7,
+	     0x70, 0x48, 0xc3, 0xa1, 0x0d, 0x87, 0x38, 0x1c, 0xec, 0x70,
+	     0xe8, 0xc3, 0x81, 0x10, 0x47, 0x45, 0x1c, 0x18, 0x71, 0x7c,
+	     0xc4, 0x91, 0x12, 0x07, 0x4b, 0x1c, 0x30, 0x71, 0xf4, 0xc4,
+	     0x01, 0x14, 0x87, 0x53, 0x1c, 0x58, 0x71, 0x6c, 0xc5, 0x01,
+	     0x16, 0x87, 0x5b, 0x1c, 0x71, 0x71, 0xf0, 0xc5, 0xe1, 0x17,
+	     0xc7, 0x62, 0x1c, 0x98, 0x71, 0x6c, 0xc6, 0x21, 0x1a, 0x47,
+	     0x6b, 0x1c, 0xb3, 0x71, 0xf8, 0xc6, 0x31, 0x1c, 0x47, 0x72,
+	     0x1c, 0xd3, 0x71, 0x6c, 0xc7, 0xe1, 0x1d, 0x87, 0x7a, 0x1c,
+	     0xf1, 0x71, 0xe4, 0xc7, 0x41, 0x20, 0x47, 0x83, 0x1c, 0x16,
+	     0x72, 0x80, 0xc8, 0xb1, 0x22, 0x87, 0x8d, 0x1c, 0x41, 0x72,
+	     0x2c, 0xc9, 0x01, 0x25, 0x47, 0x97, 0x1c, 0x63, 0x72, 0x94,
+	     0xc9, 0xd1, 0x26, 0x07, 0x9d, 0x1c, 0x77, 0x72, 0x0c, 0xca,
+	     0xe1, 0x28, 0x87, 0xa4, 0x1c, 0x96, 0x72, 0x90, 0xca, 0xe1,
+	     0x2a, 0x87, 0xad, 0x1c, 0xbd, 0x72, 0x2c, 0xcb, 0x21, 0x2d,
+	     0x07, 0xb7, 0x1c, 0xdf, 0x72, 0xac, 0xcb, 0x91, 0x2f, 0x87,
+	     0xbf, 0x1c, 0x05, 0x73, 0x2c, 0xcc, 0x31, 0x31, 0x07, 0xc6,
+	     0x1c, 0x1e, 0x73, 0xac, 0xcc, 0x31, 0x33, 0x47, 0xce, 0x1c,
+	     0x40, 0x73, 0x20, 0xcd, 0x21, 0x35, 0x07, 0xd6, 0x1c, 0x60,
+	     0x73, 0x88, 0xcd, 0x81, 0x36, 0xc7, 0xda, 0x1c, 0x75, 0x73,
+	     0xf8, 0xcd, 0x11, 0x38, 0x87, 0xe3, 0x1c, 0x97, 0x73, 0x88,
+	     0xce, 0xb1, 0x3a, 0xc7, 0xeb, 0x1c, 0xb8, 0x73, 0x00, 0xcf,
+	     0xb1, 0x3c, 0xc7, 0xf3, 0x1c, 0xdb, 0x73, 0x7c, 0xcf, 0x41,
+	     0x3e, 0x87, 0xfc, 0x1c, 0xff, 0x73, 0x30, 0xd0, 0x41, 0x41,
+	     0xc7, 0x05, 0x1d, 0x22, 0x74, 0xac, 0xd0, 0x21, 0x43, 0x87,
+	     0x0e, 0x1d, 0x48, 0x74, 0x28, 0xd1, 0x21, 0x45, 0x07, 0x18,
+	     0x1d, 0x68, 0x74, 0xac, 0xd1, 0xf1, 0x46, 0xc7, 0x1c, 0x1d,
+	     0x7c, 0x74, 0x24, 0xd2, 0x31, 0x49, 0x87, 0x26, 0x1d, 0xa8,
+	     0x74, 0xb4, 0xd2, 0x01, 0x4b, 0x07, 0x2e, 0x1d, 0xc1, 0x74,
+	     0x38, 0xd3, 0xa1, 0x4d, 0xc7, 0x38, 0x1d, 0xeb, 0x74, 0xcc,
+	     0xd3, 0x01, 0x50, 0xc7, 0x40, 0x1d, 0x0d, 0x75, 0x60, 0xd4,
+	     0x41, 0x52, 0xc7, 0x49, 0x1d, 0x31, 0x75, 0xfc, 0xd4, 0xb1,
+	     0x54, 0x47, 0x55, 0x1d, 0x63, 0x75, 0xb4, 0xd5, 0xf1, 0x56,
+	     0x47, 0x5d, 0x1d, 0x80, 0x75, 0x10, 0xd6, 0x91, 0x58, 0x47,
+	     0x65, 0x1d, 0x9a, 0x75, 0x7c, 0xd6, 0x51, 0x5a, 0x87, 0x6b,
+	     0x1d, 0xb8, 0x75, 0x10, 0xd7, 0x81, 0x5c, 0x87, 0x73, 0x1d,
+	     0xdb, 0x75, 0xa0, 0xd7, 0x11, 0x5f, 0x07, 0x7e, 0x1d, 0xff,
+	     0x75, 0x24, 0xd8, 0xe1, 0x60, 0xc7, 0x84, 0x1d, 0x19, 0x76,
+	     0x8c, 0xd8, 0xe1, 0x62, 0xc7, 0x8d, 0x1d, 0x39, 0x76, 0x1c,
+	     0xd9, 0xf1, 0x64, 0x47, 0x96, 0x1d, 0x5c, 0x76, 0x9c, 0xd9,
+	     0xa1, 0x66, 0x47, 0x9c, 0x1d, 0x7b, 0x76, 0xf8, 0xd9, 0x41,
+	     0x68, 0xc7, 0xa1, 0x1d, 0x8d, 0x76, 0x50, 0xda, 0x21, 0x6a,
+	     0xc7, 0xa9, 0x1d, 0xb1, 0x76, 0xfc, 0xda, 0x81, 0x6c, 0xc7,
+	     0xb4, 0x1d, 0xe1, 0x76, 0x94, 0xdb, 0x31, 0x6f, 0x07, 0xbf,
+	     0x1d, 0x05, 0x77, 0x28, 0xdc, 0x61, 0x71, 0x07, 0xc8, 0x1d,
+	     0x2d, 0x77, 0xbc, 0xdc, 0x31, 0x73, 0xc7, 0xcf, 0x1d, 0x44,
+	     0x77, 0x38, 0xdd, 0x11, 0x75, 0xc7, 0xd6, 0x1d, 0x64, 0x77,
+	     0xa4, 0xdd, 0x61, 0x77, 0x07, 0xe0, 0x1d, 0x8c, 0x77, 0x50,
+	     0xde, 0xf1, 0x79, 0x07, 0xeb, 0x1d, 0xb1, 0x77, 0xd8, 0xde,
+	     0x81, 0x7b, 0xc7, 0xf0, 0x1d, 0xd1, 0x77, 0x54, 0xdf, 0x91,
+	     0x7d, 0x47, 0xf8, 0x1d, 0xe8, 0x77, 0xd8, 0xdf, 0xf1, 0x7f,
+	     0x47, 0x02, 0x1e, 0x13, 0x78, 0x60, 0xe0, 0xf1, 0x81, 0xc7,
+	     0x09, 0x1e, 0x31, 0x78, 0xec, 0xe0, 0x01, 0x84, 0x47, 0x13,
+	     0x1e, 0x50, 0x78, 0x74, 0xe1, 0x21, 0x86, 0x07, 0x1a, 0x1e,
+	     0x74, 0x78, 0x04, 0xe2, 0x61, 0x88, 0x87, 0x24, 0x1e, 0x99,
+	     0x78, 0x74, 0xe2, 0x31, 0x8a, 0x07, 0x2a, 0x1e, 0xb3, 0x78,
+	     0xd8, 0xe2, 0x31, 0x8c, 0x07, 0x33, 0x1e, 0xd3, 0x78, 0x7c,
+	     0xe3, 0x11, 0x8e, 0x87, 0x3a, 0x1e, 0xef, 0x78, 0xd4, 0xe3,
+	     0x81, 0x8f, 0x47, 0x40, 0x1e, 0x07, 0x79, 0x4c, 0xe4, 0x61,
+	     0x91, 0x07, 0x48, 0x1e, 0x2d, 0x79, 0xdc, 0xe4, 0xb1, 0x93,
+	     0x07, 0x52, 0x1e, 0x4f, 0x79, 0x58, 0xe5, 0xb1, 0x95, 0xc7,
+	     0x57, 0x1e, 0x68, 0x79, 0xbc, 0xe5, 0x51, 0x97, 0x87, 0x5f,
+	     0x1e, 0x84, 0x79, 0x34, 0xe6, 0xa1, 0x99, 0xc7, 0x69, 0x1e,
+	     0xb2, 0x79, 0xfc, 0xe6, 0xc1, 0x9c, 0xc7, 0x74, 0x1e, 0xdd,
+	     0x79, 0xa0, 0xe7, 0x61, 0x9f, 0xc7, 0x7f, 0x1e, 0x08, 0x7a,
+	     0x3c, 0xe8, 0xb1, 0xa1, 0x47, 0x89, 0x1e, 0x2b, 0x7a, 0xd0,
+	     0xe8, 0xc1, 0xa3, 0x47, 0x91, 0x1e, 0x51, 0x7a, 0x74, 0xe9,
+	     0xa1, 0xa6, 0x47, 0x9b, 0x1e, 0x76, 0x7a, 0x00, 0xea, 0x91,
+	     0xa8, 0x87, 0xa5, 0x1e, 0xa2, 0x7a, 0x94, 0xea, 0xa1, 0xaa,
+	     0x07, 0xac, 0x1e, 0xb8, 0x7a, 0x04, 0xeb, 0xe1, 0xac, 0xc7,
+	     0xb4, 0x1e, 0xdc, 0x7a, 0x90, 0xeb, 0x11, 0xaf, 0x07, 0xbe,
+	     0x1e, 0x02, 0x7b, 0x24, 0xec, 0x41, 0xb1, 0x87, 0xc6, 0x1e,
+	     0x22, 0x7b, 0xac, 0xec, 0x41, 0xb3, 0x07, 0xcf, 0x1e, 0x3f,
+	     0x7b, 0x1c, 0xed, 0x01, 0xb5, 0x87, 0xd7, 0x1e, 0x68, 0x7b,
+	     0xd4, 0xed, 0xf1, 0xb7, 0x87, 0xe0, 0x1e, 0x86, 0x7b, 0x2c,
+	     0xee, 0x31, 0xb9, 0x47, 0xe8, 0x1e, 0xac, 0x7b, 0xbc, 0xee,
+	     0xc1, 0xbb, 0x87, 0xf2, 0x1e, 0xcd, 0x7b, 0x48, 0xef, 0x71,
+	     0xbd, 0x47, 0xf7, 0x1e, 0xe8, 0x7b, 0xc8, 0xef, 0xa1, 0xbf,
+	     0x87, 0x00, 0x1f, 0x06, 0x7c, 0x40, 0xf0, 0x91, 0xc1, 0x07,
+	     0x09, 0x1f, 0x2f, 0x7c, 0xd8, 0xf0, 0xc1, 0xc3, 0xc7, 0x11,
+	     0x1f, 0x49, 0x7c, 0x3c, 0xf1, 0x21, 0xc5, 0xc7, 0x16, 0x1f,
+	     0x66, 0x7c, 0xb0, 0xf1, 0x01, 0xc7, 0x07, 0x1e, 0x1f, 0x7b,
+	     0x7c, 0x08, 0xf2, 0x71, 0xc8, 0x47, 0x23, 0x1f, 0x92, 0x7c,
+	     0x7c, 0xf2, 0xa1, 0xca, 0x87, 0x2d, 0x1f, 0xc3, 0x7c, 0x30,
+	     0xf3, 0x01, 0xcd, 0x07, 0x35, 0x1f, 0xe1, 0x7c, 0xa0, 0xf3,
+	     0xf1, 0xce, 0xc7, 0x3c, 0x1f, 0x01, 0x7d, 0x30, 0xf4, 0x51,
+	     0xd1, 0xc7, 0x47, 0x1f, 0x21, 0x7d, 0x9c, 0xf4, 0x21, 0xd3,
+	     0x87, 0x4d, 0x1f, 0x40, 0x7d, 0x38, 0xf5, 0x41, 0xd5, 0x47,
+	     0x57, 0x1f, 0x61, 0x7d, 0x9c, 0xf5, 0x01, 0xd7, 0x47, 0x5f,
+	     0x1f, 0x83, 0x7d, 0x2c, 0xf6, 0x31, 0xd9, 0x07, 0x66, 0x1f,
+	     0x9c, 0x7d, 0x7c, 0xf6, 0x71, 0xda, 0x07, 0x6c, 0x1f, 0xb8,
+	     0x7d, 0x18, 0xf7, 0xd1, 0xdc, 0x47, 0x74, 0x1f, 0xdd, 0x7d,
+	     0xac, 0xf7, 0x61, 0xdf, 0x07, 0x7f, 0x1f, 0x01, 0x7e, 0x28,
+	     0xf8, 0x21, 0xe1, 0xc7, 0x87, 0x1f, 0x25, 0x7e, 0xc8, 0xf8,
+	     0x91, 0xe3, 0x47, 0x90, 0x1f, 0x4a, 0x7e, 0x3c, 0xf9, 0x31,
+	     0xe5, 0xc7, 0x96, 0x1f, 0x5e, 0x7e, 0xa0, 0xf9, 0x61, 0xe7,
+	     0x47, 0x9e, 0x1f, 0x82, 0x7e, 0x24, 0xfa, 0xc1, 0xe8, 0x47,
+	     0xa4, 0x1f, 0x9e, 0x7e, 0x9c, 0xfa, 0x21, 0xeb, 0x87, 0xad,
+	     0x1f, 0xba, 0x7e, 0x04, 0xfb, 0xb1, 0xec, 0x47, 0xb3, 0x1f,
+	     0xd0, 0x7e, 0x6c, 0xfb, 0x61, 0xee, 0x47, 0xbb, 0x1f, 0xf4,
+	     0x7e, 0xec, 0xfb, 0x91, 0xf0, 0x47, 0xc3, 0x1f, 0x11, 0x7f,
+	     0x70, 0xfc, 0x91, 0xf2, 0x87, 0xcd, 0x1f, 0x3d, 0x7f, 0x28,
+	     0xfd, 0x11, 0xf5, 0x07, 0xd7, 0x1f, 0x68, 0x7f, 0xc8, 0xfd,
+	     0xc1, 0xf7, 0x47, 0xe1, 0x1f, 0x8a, 0x7f, 0x50, 0xfe, 0xd1,
+	     0xf9, 0x07, 0xe9, 0x1f, 0xb1, 0x7f, 0xdc, 0xfe, 0xc1, 0xfb,
+	     0x07, 0xf1, 0x1f, 0xc9, 0x7f, 0x48, 0xff, 0xb1, 0xfd, 0x47,
+	     0xf7, 0x1f, 0xe8, 0x7f, 0xb4, 0xff, 0x71, 0xff, 0x87, 0x00,
+	     0x20, 0x08, 0x80, 0x38, 0x00, 0x52, 0x01, 0xc8, 0x08, 0x20,
+	     0x2d, 0x80, 0xd8, 0x00, 0x22, 0x04, 0xc8, 0x11, 0x20, 0x52,
+	     0x80, 0x5c, 0x01, 0xe2, 0x05, 0x88, 0x19, 0x20, 0x71, 0x80,
+	     0xd4, 0x01, 0xd2, 0x07, 0x88, 0x22, 0x20, 0x90, 0x80, 0x60,
+	     0x02, 0xb2, 0x09, 0x48, 0x28, 0x20, 0xa8, 0x80, 0xb4, 0x02,
+	     0x52, 0x0b, 0x48, 0x2e, 0x20, 0xbe, 0x80, 0x24, 0x03, 0x62,
+	     0x0d, 0xc8, 0x38, 0x20, 0xf1, 0x80, 0xd8, 0x03, 0xf2, 0x0f,
+	     0x08, 0x42, 0x20, 0x0a, 0x81, 0x48, 0x04, 0xf2, 0x11, 0x88,
+	     0x4a, 0x20, 0x37, 0x81, 0x04, 0x05, 0x42, 0x14, 0xc8, 0x52,
+	     0x20, 0x50, 0x81, 0x64, 0x05, 0xc2, 0x15, 0x48, 0x58, 0x20,
+	     0x66, 0x81, 0xbc, 0x05, 0xd2, 0x17, 0x88, 0x61, 0x20, 0x8d,
+	     0x81, 0x64, 0x06, 0xc2, 0x19, 0x88, 0x6a, 0x20, 0xb8, 0x81,
+	     0x0c, 0x07, 0x02, 0x1d, 0x48, 0x75, 0x20, 0xe0, 0x81, 0x8c,
+	     0x07, 0x02, 0x1f, 0x08, 0x7f, 0x20, 0xff, 0x81, 0x20, 0x08,
+	     0x02, 0x21, 0x88, 0x84, 0x20, 0x17, 0x82, 0x74, 0x08, 0xb2,
+	     0x22, 0x08, 0x8d, 0x20, 0x3f, 0x82, 0x1c, 0x09, 0xf2, 0x24,
+	     0xc8, 0x94, 0x20, 0x5b, 0x82, 0x94, 0x09, 0x82, 0x26, 0x48,
+	     0x9d, 0x20, 0x81, 0x82, 0x10, 0x0a, 0x72, 0x28, 0x88, 0xa4,
+	     0x20, 0x9d, 0x82, 0xac, 0x0a, 0x62, 0x2b, 0x88, 0xae, 0x20,
+	     0xc3, 0x82, 0x38, 0x0b, 0xb2, 0x2d, 0x08, 0xba, 0x20, 0xf5,
+	     0x82, 0xdc, 0x0b, 0xf2, 0x2f, 0x88, 0xc0, 0x20, 0x07, 0x83,
+	     0x30, 0x0c, 0x12, 0x31, 0x48, 0xc7, 0x20, 0x25, 0x83, 0xa0,
+	     0x0c, 0xe2, 0x32, 0x08, 0xce, 0x20, 0x3d, 0x83, 0x14, 0x0d,
+	     0xb2, 0x34, 0x08, 0xd6, 0x20, 0x64, 0x83, 0xbc, 0x0d, 0x72,
+	     0x37, 0x08, 0xe1, 0x20, 0x89, 0x83, 0x34, 0x0e, 0xa2, 0x39,
+	     0x08, 0xea, 0x20, 0xaf, 0x83, 0xe0, 0x0e, 0x42, 0x3c, 0x08,
+	     0xf2, 0x20, 0xd4, 0x83, 0x58, 0x0f, 0x92, 0x3d, 0x88, 0xf7,
+	     0x20, 0xe3, 0x83, 0xb8, 0x0f, 0x82, 0x3f, 0x08, 0xff, 0x20,
+	     0x09, 0x84, 0x30, 0x10, 0x12, 0x41, 0x88, 0x05, 0x21, 0x1a,
+	     0x84, 0x7c, 0x10, 0xa2, 0x42, 0x08, 0x0c, 0x21, 0x3e, 0x84,
+	     0x14, 0x11, 0x82, 0x44, 0x88, 0x13, 0x21, 0x54, 0x84, 0x88,
+	     0x11, 0x92, 0x46, 0xc8, 0x1c, 0x21, 0x7d, 0x84, 0x10, 0x12,
+	     0x92, 0x48, 0x88, 0x23, 0x21, 0x93, 0x84, 0x6c, 0x12, 0x82,
+	     0x4a, 0x48, 0x2c, 0x21, 0xb8, 0x84, 0x14, 0x13, 0x82, 0x4c,
+	     0x08, 0x34, 0x21, 0xd5, 0x84, 0x7c, 0x13, 0x52, 0x4e, 0xc8,
+	     0x3c, 0x21, 0xf8, 0x84, 0xec, 0x13, 0x42, 0x50, 0x88, 0x42,
+	     0x21, 0x12, 0x85, 0x7c, 0x14, 0x22, 0x52, 0x48, 0x4a, 0x21,
+	     0x2e, 0x85, 0xf0, 0x14, 0x52, 0x54, 0x48, 0x53, 0x21, 0x50,
+	     0x85, 0x5c, 0x15, 0x02, 0x56, 0x08, 0x5b, 0x21, 0x78, 0x85,
+	     0xec, 0x15, 0xf2, 0x57, 0x48, 0x61, 0x21, 0x89, 0x85, 0x58,
+	     0x16, 0xb2, 0x59, 0x88, 0x67, 0x21, 0xa5, 0x85, 0xcc, 0x16,
+	     0xd2, 0x5b, 0x48, 0x70, 0x21, 0xc5, 0x85, 0x20, 0x17, 0xd2,
+	     0x5c, 0x48, 0x75, 0x21, 0xda, 0x85, 0x74, 0x17, 0x32, 0x5e,
+	     0x48, 0x7b, 0x21, 0xf4, 0x85, 0xfc, 0x17, 0x42, 0x60, 0x88,
+	     0x84, 0x21, 0x1c, 0x86, 0x78, 0x18, 0x82, 0x62, 0x48, 0x8b,
+	     0x21, 0x3a, 0x86, 0xf8, 0x18, 0x32, 0x64, 0x48, 0x94, 0x21,
+	     0x56, 0x86, 0x88, 0x19, 0xd2, 0x66, 0xc8, 0x9c, 0x21, 0x7f,
+	     0x86, 0x30, 0x1a, 0x92, 0x69, 0xc8, 0xa7, 0x21, 0xaa, 0x86,
+	     0xbc, 0x1a, 0x32, 0x6b, 0x48, 0xae, 0x21, 0xc4, 0x86, 0x30,
+	     0x1b, 0x62, 0x6d, 0x88, 0xb6, 0x21, 0xe3, 0x86, 0x9c, 0x1b,
+	     0x22, 0x6f, 0x88, 0xbf, 0x21, 0x0b, 0x87, 0x4c, 0x1c, 0xb2,
+	     0x71, 0xc8, 0xc9, 0x21, 0x30, 0x87, 0xe0, 0x1c, 0xd2, 0x73,
+	     0x08, 0xd1, 0x21, 0x47, 0x87, 0x3c, 0x1d, 0x52, 0x75, 0x48,
+	     0xd7, 0x21, 0x67, 0x87, 0xc8, 0x1d, 0x02, 0x78, 0x08, 0xe3,
+	     0x21, 0x9a, 0x87, 0x98, 0x1e, 0xf2, 0x7a, 0x08, 0xed, 0x21,
+	     0xc1, 0x87, 0x38, 0x1f, 0x12, 0x7d, 0x88, 0xf6, 0x21, 0xe0,
+	     0x87, 0xa0, 0x1f, 0x52, 0x7f, 0x88, 0xfe, 0x21, 0xff, 0x87,
+	     0x28, 0x20, 0x52, 0x81, 0x08, 0x08, 0x22, 0x22, 0x88, 0xa0,
+	     0x20, 0x32, 0x83, 0x48, 0x0e, 0x22, 0x3c, 0x88, 0x0c, 0x21,
+	     0xc2, 0x84, 0x48, 0x16, 0x22, 0x5f, 0x88, 0xac, 0x21, 0x82,
+	     0x87, 0x08, 0x21, 0x22, 0x88, 0x88, 0x44, 0x22, 0xc2, 0x89,
+	     0x48, 0x2a, 0x22, 0xb4, 0x88, 0xe4, 0x22, 0x52, 0x8c, 0xc8,
+	     0x32, 0x22, 0xd1, 0x88, 0x68, 0x23, 0x32, 0x8e, 0x08, 0x3a,
+	     0x22, 0xf4, 0x88, 0xf8, 0x23, 0xb2, 0x90, 0x48, 0x43, 0x22,
+	     0x1b, 0x89, 0x98, 0x24, 0x42, 0x93, 0xc8, 0x4d, 0x22, 0x3c,
+	     0x89, 0x04, 0x25, 0xd2, 0x94, 0xc8, 0x54, 0x22, 0x56, 0x89,
+	     0x64, 0x25, 0x02, 0x96, 0x88, 0x59, 0x22, 0x74, 0x89, 0xdc,
+	     0x25, 0xe2, 0x97, 0x48, 0x62, 0x22, 0x8d, 0x89, 0x68, 0x26,
+	     0xe2, 0x99, 0xc8, 0x69, 0x22, 0xb3, 0x89, 0xe0, 0x26, 0x42,
+	     0x9c, 0x88, 0x72, 0x22, 0xcf, 0x89, 0x6c, 0x27, 0x92, 0x9e,
+	     0x48, 0x7c, 0x22, 0xfa, 0x89, 0xf4, 0x27, 0x62, 0xa0, 0xc8,
+	     0x83, 0x22, 0x18, 0x8a, 0x80, 0x28, 0xd2, 0xa2, 0xc8, 0x8b,
+	     0x22, 0x34, 0x8a, 0x08, 0x29, 0xb2, 0xa4, 0x48, 0x94, 0x22,
+	     0x59, 0x8a, 0x94, 0x29, 0xc2, 0xa6, 0x88, 0x9e, 0x22, 0x83,
+	     0x8a, 0x20, 0x2a, 0xb2, 0xa8, 0x88, 0xa5, 0x22, 0x9b, 0x8a,
+	     0x90, 0x2a, 0xf2, 0xaa, 0xc8, 0xae, 0x22, 0xc6, 0x8a, 0x30,
+	     0x2b, 0x42, 0xad, 0x48, 0xb8, 0x22, 0xe7, 0x8a, 0xc8, 0x2b,
+	     0x82, 0xaf, 0xc8, 0xbe, 0x22, 0xfd, 0x8a, 0x1c, 0x2c, 0xc2,
+	     0xb0, 0x08, 0xc5, 0x22, 0x1a, 0x8b, 0x98, 0x2c, 0xd2, 0xb2,
+	     0x08, 0xcc, 0x22, 0x33, 0x8b, 0xdc, 0x2c, 0x42, 0xb4, 0x88,
+	     0xd4, 0x22, 0x5a, 0x8b, 0x8c, 0x2d, 0xa2, 0xb6, 0xc8, 0xdb,
+	     0x22, 0x7c, 0x8b, 0x28, 0x2e, 0xf2, 0xb8, 0x08, 0xe6, 0x22,
+	     0x9e, 0x8b, 0xb0, 0x2e, 0x32, 0xbb, 0xc8, 0xed, 0x22, 0xbb,
+	     0x8b, 0x20, 0x2f, 0xe2, 0xbc, 0x48, 0xf4, 0x22, 0xdc, 0x8b,
+	     0xa4, 0x2f, 0x02, 0xbf, 0x48, 0xfe, 0x22, 0xfe, 0x8b, 0x20,
+	     0x30, 0x32, 0xc1, 0xc8, 0x05, 0x23, 0x19, 0x8c, 0x88, 0x30,
+	     0xb2, 0xc2, 0x08, 0x0c, 0x23, 0x33, 0x8c, 0xe4, 0x30, 0x22,
+	     0xc4, 0xc8, 0x13, 0x23, 0x56, 0x8c, 0x84, 0x31, 0x82, 0xc6,
+	     0x88, 0x1d, 0x23, 0x7c, 0x8c, 0x04, 0x32, 0x92, 0xc8, 0x88,
+	     0x24, 0x23, 0x9b, 0x8c, 0x8c, 0x32, 0x12, 0xcb, 0x88, 0x2e,
+	     0x23, 0xc6, 0x8c, 0x3c, 0x33, 0x32, 0xcd, 0x48, 0x37, 0x23,
+	     0xe2, 0x8c, 0xb8, 0x33, 0x92, 0xcf, 0xc8, 0x3e, 0x23, 0x05,
+	     0x8d, 0x28, 0x34, 0x72, 0xd1, 0x88, 0x46, 0x23, 0x28, 0x8d,
+	     0xb4, 0x34, 0x92, 0xd3, 0x88, 0x51, 0x23, 0x4b, 0x8d, 0x3c,
+	     0x35, 0xb2, 0xd5, 0x48, 0x58, 0x23, 0x6f, 0x8d, 0xf0, 0x35,
+	     0x02, 0xd8, 0x88, 0x61, 0x23, 0x92, 0x8d, 0x58, 0x36, 0x32,
+	     0xda, 0xc8, 0x69, 0x23, 0xaf, 0x8d, 0xf0, 0x36, 0xa2, 0xdc,
+	     0x08, 0x76, 0x23, 0xe5, 0x8d, 0xa8, 0x37, 0xe2, 0xde, 0x08,
+	     0x7f, 0x23, 0x08, 0x8e, 0x4c, 0x38, 0x52, 0xe1, 0x48, 0x86,
+	     0x23, 0x25, 0x8e, 0xbc, 0x38, 0x82, 0xe3, 0x48, 0x8f, 0x23,
+	     0x49, 0x8e, 0x54, 0x39, 0x32, 0xe6, 0xc8, 0x99, 0x23, 0x70,
+	     0x8e, 0xd4, 0x39, 0xf2, 0xe7, 0x88, 0xa0, 0x23, 0x8e, 0x8e,
+	     0x44, 0x3a, 0xf2, 0xe9, 0x88, 0xa8, 0x23, 0xad, 0x8e, 0xd0,
+	     0x3a, 0xa2, 0xeb, 0xc8, 0xaf, 0x23, 0xc5, 0x8e, 0x48, 0x3b,
+	     0xc2, 0xed, 0x48, 0xba, 0x23, 0xef, 0x8e, 0xc4, 0x3b, 0xf2,
+	     0xef, 0xc8, 0xc1, 0x23, 0x0d, 0x8f, 0x68, 0x3c, 0xf2, 0xf1,
+	     0x08, 0xc9, 0x23, 0x2a, 0x8f, 0xd0, 0x3c, 0xc2, 0xf3, 0xc8,
+	     0xd1, 0x23, 0x50, 0x8f, 0x78, 0x3d, 0xb2, 0xf6, 0x08, 0xdc,
+	     0x23, 0x78, 0x8f, 0xfc, 0x3d, 0xc2, 0xf8, 0x08, 0xe4, 0x23,
+	     0x9e, 0x8f, 0x88, 0x3e, 0xa2, 0xfa, 0x88, 0xeb, 0x23, 0xb0,
+	     0x8f, 0xd4, 0x3e, 0xb2, 0xfb, 0x48, 0xf0, 0x23, 0xc6, 0x8f,
+	     0x2c, 0x3f, 0x42, 0xfd, 0x88, 0xf6, 0x23, 0xdf, 0x8f, 0x94,
+	     0x3f, 0xc2, 0xfe, 0xc8, 0xfb, 0x23, 0xf3, 0x8f, 0xdc, 0x3f,
+	     0xe2, 0xff, 0x88, 0x01, 0x24, 0x12, 0x90, 0x80, 0x40, 0x92,
+	     0x02, 0xc9, 0x0d, 0x24, 0x42, 0x90, 0x38, 0x41, 0x72, 0x05,
+	     0x49, 0x18, 0x24, 0x6d, 0x90, 0xe0, 0x41, 0xb2, 0x07, 0x09,
+	     0x21, 0x24, 0x8b, 0x90, 0x38, 0x42, 0x52, 0x09, 0xc9, 0x28,
+	     0x24, 0xae, 0x90, 0xdc, 0x42, 0xf2, 0x0b, 0xc9, 0x30, 0x24,
+	     0xd0, 0x90, 0x78, 0x43, 0x72, 0x0e, 0x09, 0x3b, 0x24, 0xef,
+	     0x90, 0xd0, 0x43, 0xf2, 0x0f, 0x09, 0x42, 0x24, 0x15, 0x91,
+	     0x8c, 0x44, 0xe2, 0x12, 0x89, 0x4c, 0x24, 0x3d, 0x91, 0x2c,
+	     0x45, 0x12, 0x15, 0x09, 0x55, 0x24, 0x62, 0x91, 0xac, 0x45,
+	     0x02, 0x17, 0x49, 0x5d, 0x24, 0x7a, 0x91, 0x20, 0x46, 0x02,
+	     0x19, 0x89, 0x67, 0x24, 0xa7, 0x91, 0xd4, 0x46, 0xa2, 0x1b,
+	     0xc9, 0x6f, 0x24, 0xc7, 0x91, 0x48, 0x47, 0x02, 0x1e, 0x89,
+	     0x78, 0x24, 0xe8, 0x91, 0xb0, 0x47, 0x62, 0x1f, 0x09, 0x7f,
+	     0x24, 0x00, 0x92, 0x28, 0x48, 0x12, 0x21, 0xc9, 0x87, 0x24,
+	     0x2c, 0x92, 0xd4, 0x48, 0xa2, 0x23, 0xc9, 0x91, 0x24, 0x4f,
+	     0x92, 0x70, 0x49, 0x52, 0x26, 0x49, 0x9b, 0x24, 0x72, 0x92,
+	     0xe0, 0x49, 0xf2, 0x27, 0x09, 0xa3, 0x24, 0x95, 0x92, 0x78,
+	     0x4a, 0x42, 0x2a, 0xc9, 0xaa, 0x24, 0xb8, 0x92, 0xe8, 0x4a,
+	     0x02, 0x2c, 0x49, 0xb1, 0x24, 0xcf, 0x92, 0x4c, 0x4b, 0x12,
+	     0x2e, 0x89, 0xbb, 0x24, 0xf3, 0x92, 0xe4, 0x4b, 0x02, 0x30,
+	     0x49, 0xc1, 0x24, 0x0a, 0x93, 0x5c, 0x4c, 0x52, 0x32, 0x89,
+	     0xcb, 0x24, 0x36, 0x93, 0x08, 0x4d, 0xb2, 0x34, 0x89, 0xd4,
+	     0x24, 0x58, 0x93, 0x74, 0x4d, 0x12, 0x36, 0xc9, 0xdb, 0x24,
+	     0x76, 0x93, 0xec, 0x4d, 0x82, 0x38, 0x49, 0xe4, 0x24, 0x97,
+	     0x93, 0x70, 0x4e, 0x02, 0x3a, 0x09, 0xeb, 0x24, 0xb7, 0x93,
+	     0xf0, 0x4e, 0x12, 0x3c, 0x49, 0xf2, 0x24, 0xd3, 0x93, 0x80,
+	     0x4f, 0x92, 0x3e, 0xc9, 0xfb, 0x24, 0xf1, 0x93, 0xf4, 0x4f,
+	     0x52, 0x40, 0x09, 0x04, 0x25, 0x1c, 0x94, 0xa0, 0x50, 0x42,
+	     0x43, 0x49, 0x0e, 0x25, 0x3c, 0x94, 0x04, 0x51, 0x92, 0x44,
+	     0xc9, 0x13, 0x25, 0x53, 0x94, 0x58, 0x51, 0x32, 0x46, 0x89,
+	     0x1a, 0x25, 0x74, 0x94, 0x00, 0x52, 0x52, 0x48, 0x89, 0x22,
+	     0x25, 0x8f, 0x94, 0x70, 0x52, 0x62, 0x4a, 0x89, 0x2a, 0x25,
+	     0xaf, 0x94, 0xe4, 0x52, 0x62, 0x4c, 0x09, 0x32, 0x25, 0xcc,
+	     0x94, 0x3c, 0x53, 0x42, 0x4d, 0x49, 0x38, 0x25, 0xeb, 0x94,
+	     0xc0, 0x53, 0x82, 0x4f, 0xc9, 0x3e, 0x25, 0x09, 0x95, 0x40,
+	     0x54, 0x42, 0x51, 0x89, 0x46, 0x25, 0x27, 0x95, 0xd4, 0x54,
+	     0x82, 0x53, 0x49, 0x50, 0x25, 0x44, 0x95, 0x34, 0x55, 0x42,
+	     0x55, 0xc9, 0x55, 0x25, 0x5e, 0x95, 0x90, 0x55, 0xe2, 0x56,
+	     0xc9, 0x5d, 0x25, 0x84, 0x95, 0x34, 0x56, 0x52, 0x59, 0x09,
+	     0x68, 0x25, 0xa6, 0x95, 0xbc, 0x56, 0x82, 0x5b, 0x49, 0x70,
+	     0x25, 0xcd, 0x95, 0x3c, 0x57, 0x42, 0x5d, 0x49, 0x76, 0x25,
+	     0xdd, 0x95, 0x98, 0x57, 0xa2, 0x5e, 0x09, 0x7c, 0x25, 0xf4,
+	     0x95, 0xe8, 0x57, 0x02, 0x60, 0xc9, 0x80, 0x25, 0x0a, 0x96,
+	     0x44, 0x58, 0xe2, 0x61, 0x09, 0x8a, 0x25, 0x32, 0x96, 0xec,
+	     0x58, 0x82, 0x64, 0x49, 0x93, 0x25, 0x56, 0x96, 0x78, 0x59,
+	     0x22, 0x66, 0xc9, 0x99, 0x25, 0x69, 0x96, 0xcc, 0x59, 0xd2,
+	     0x67, 0xc9, 0xa1, 0x25, 0x8f, 0x96, 0x64, 0x5a, 0x62, 0x6a,
+	     0x49, 0xac, 0x25, 0xba, 0x96, 0x20, 0x5b, 0xd2, 0x6c, 0x89,
+	     0xb5, 0x25, 0xdd, 0x96, 0xa4, 0x5b, 0xe2, 0x6e, 0x09, 0xbd,
+	     0x25, 0xf8, 0x96, 0x18, 0x5c, 0xd2, 0x70, 0x49, 0xc5, 0x25,
+	     0x1e, 0x97, 0xb0, 0x5c, 0xa2, 0x73, 0x89, 0xcf, 0x25, 0x4b,
+	     0x97, 0x5c, 0x5d, 0xd2, 0x75, 0xc9, 0xd9, 0x25, 0x70, 0x97,
+	     0xd4, 0x5d, 0x22, 0x78, 0x89, 0xe1, 0x25, 0x90, 0x97, 0x68,
+	     0x5e, 0xd2, 0x79, 0x89, 0xea, 0x25, 0xac, 0x97, 0xc8, 0x5e,
+	     0xf2, 0x7b, 0x49, 0xf2, 0x25, 0xd7, 0x97, 0x7c, 0x5f, 0x92,
+	     0x7e, 0x09, 0xfd, 0x25, 0xfd, 0x97, 0x28, 0x60, 0x62, 0x81,
+	     0x89, 0x06, 0x26, 0x28, 0x98, 0xb8, 0x60, 0x32, 0x83, 0xc9,
+	     0x0f, 0x26, 0x4b, 0x98, 0x50, 0x61, 0x92, 0x85, 0xc9, 0x19,
+	     0x26, 0x71, 0x98, 0xd0, 0x61, 0x22, 0x88, 0x09, 0x24, 0x26,
+	     0x96, 0x98, 0x8c, 0x62, 0xa2, 0x8a, 0x49, 0x2c, 0x26, 0xb7,
+	     0x98, 0xf4, 0x62, 0xa2, 0x8c, 0x49, 0x33, 0x26, 0xd4, 0x98,
+	     0x58, 0x63, 0xe2, 0x8d, 0x89, 0x39, 0x26, 0xf4, 0x98, 0xf0,
+	     0x63, 0x92, 0x90, 0x49, 0x44, 0x26, 0x1b, 0x99, 0x80, 0x64,
+	     0x62, 0x92, 0x49, 0x4b, 0x26, 0x35, 0x99, 0xfc, 0x64, 0x32,
+	     0x94, 0x49, 0x54, 0x26, 0x55, 0x99, 0x70, 0x65, 0x42, 0x96,
+	     0x89, 0x5b, 0x26, 0x74, 0x99, 0x04, 0x66, 0xa2, 0x98, 0x89,
+	     0x63, 0x26, 0x91, 0x99, 0x6c, 0x66, 0x02, 0x9a, 0x49, 0x6b,
+	     0x26, 0xb2, 0x99, 0xd0, 0x66, 0x12, 0x9c, 0x49, 0x72, 0x26,
+	     0xcf, 0x99, 0x4c, 0x67, 0xa2, 0x9d, 0xc9, 0x78, 0x26, 0xe6,
+	     0x99, 0xcc, 0x67, 0xd2, 0x9f, 0x89, 0x80, 0x26, 0x0d, 0x9a,
+	     0x54, 0x68, 0x02, 0xa2, 0x89, 0x8a, 0x26, 0x37, 0x9a, 0x00,
+	     0x69, 0x42, 0xa4, 0x09, 0x94, 0x26, 0x54, 0x9a, 0x7c, 0x69,
+	     0x32, 0xa6, 0x09, 0x9b, 0x26, 0x71, 0x9a, 0xe0, 0x69, 0x42,
+	     0xa8, 0xc9, 0xa2, 0x26, 0x96, 0x9a, 0x60, 0x6a, 0x32, 0xaa,
+	     0x49, 0xaa, 0x26, 0xb6, 0x9a, 0xf0, 0x6a, 0x82, 0xac, 0xc9,
+	     0xb3, 0x26, 0xd8, 0x9a, 0x84, 0x6b, 0xf2, 0xae, 0x89, 0xbc,
+	     0x26, 0xfb, 0x9a, 0x1c, 0x6c, 0xa2, 0xb0, 0xc9, 0xc5, 0x26,
+	     0x1f, 0x9b, 0xb0, 0x6c, 0x52, 0xb3, 0x09, 0xce, 0x26, 0x44,
+	     0x9b, 0x1c, 0x6d, 0xb2, 0xb4, 0x09, 0xd4, 0x26, 0x5e, 0x9b,
+	     0xa8, 0x6d, 0x72, 0xb7, 0x09, 0xe1, 0x26, 0x8f, 0x9b, 0x54,
+	     0x6e, 0xc2, 0xb9, 0x89, 0xe7, 0x26, 0xa2, 0x9b, 0x98, 0x6e,
+	     0xb2, 0xba, 0xc9, 0xeb, 0x26, 0xb8, 0x9b, 0x08, 0x6f, 0x62,
+	     0xbc, 0x49, 0xf2, 0x26, 0xcf, 0x9b, 0x68, 0x6f, 0xf2, 0xbd,
+	     0xc9, 0xfa, 0x26, 0xf7, 0x9b, 0xf0, 0x6f, 0x72, 0xc0, 0xc9,
+	     0x02, 0x27, 0x16, 0x9c, 0x8c, 0x70, 0xf2, 0xc2, 0x09, 0x0d,
+	     0x27, 0x40, 0x9c, 0x20, 0x71, 0x22, 0xc5, 0x09, 0x16, 0x27,
+	     0x5b, 0x9c, 0x78, 0x71, 0x82, 0xc6, 0x89, 0x1c, 0x27, 0x80,
+	     0x9c, 0x18, 0x72, 0x42, 0xc9, 0x49, 0x28, 0x27, 0xaa, 0x9c,
+	     0xc0, 0x72, 0x72, 0xcb, 0x49, 0x2e, 0x27, 0xc5, 0x9c, 0x30,
+	     0x73, 0x42, 0xcd, 0x89, 0x38, 0x27, 0xee, 0x9c, 0xdc, 0x73,
+	     0xf2, 0xcf, 0xc9, 0x41, 0x27, 0x0e, 0x9d, 0x58, 0x74, 0x42,
+	     0xd2, 0x49, 0x4b, 0x27, 0x3b, 0x9d, 0x1c, 0x75, 0x12, 0xd5,
+	     0x49, 0x55, 0x27, 0x63, 0x9d, 0xac, 0x75, 0x62, 0xd7, 0xc9,
+	     0x5f, 0x27, 0x85, 0x9d, 0x2c, 0x76, 0x72, 0xd9, 0x89, 0x68,
+	     0x27, 0xa6, 0x9d, 0xc0, 0x76, 0xe2, 0xdb, 0x09, 0x71, 0x27,
+	     0xcb, 0x9d, 0x48, 0x77, 0x62, 0xdd, 0x89, 0x77, 0x27, 0xe0,
+	     0x9d, 0xb8, 0x77, 0x52, 0xdf, 0xc9, 0x7f, 0x27, 0x0a, 0x9e,
+	     0x44, 0x78, 0x62, 0xe1, 0x09, 0x88, 0x27, 0x2d, 0x9e, 0xc0,
+	     0x78, 0xc2, 0xe3, 0xc9, 0x90, 0x27, 0x4d, 0x9e, 0x68, 0x79,
+	     0x82, 0xe6, 0x09, 0x9c, 0x27, 0x7d, 0x9e, 0x20, 0x7a, 0x62,
+	     0xe9, 0x09, 0xa9, 0x27, 0xa7, 0x9e, 0xc8, 0x7a, 0x82, 0xeb,
+	     0x49, 0xaf, 0x27, 0xc1, 0x9e, 0x0c, 0x7b, 0xd2, 0xec, 0x49,
+	     0xb5, 0x27, 0xd8, 0x9e, 0x90, 0x7b, 0x12, 0xef, 0xc9, 0xbf,
+	     0x27, 0x03, 0x9f, 0x24, 0x7c, 0xd2, 0xf0, 0x49, 0xc6, 0x27,
+	     0x1f, 0x9f, 0xa4, 0x7c, 0x42, 0xf3, 0xc9, 0xcd, 0x27, 0x41,
+	     0x9f, 0x18, 0x7d, 0xc2, 0xf4, 0xc9, 0xd5, 0x27, 0x60, 0x9f,
+	     0xac, 0x7d, 0x62, 0xf7, 0x89, 0xde, 0x27, 0x80, 0x9f, 0x24,
+	     0x7e, 0x22, 0xf9, 0xc9, 0xe6, 0x27, 0x9f, 0x9f, 0x90, 0x7e,
+	     0x72, 0xfa, 0xc9, 0xeb, 0x27, 0xb9, 0x9f, 0x0c, 0x7f, 0x52,
+	     0xfc, 0xc9, 0xf4, 0x27, 0xd6, 0x9f, 0x68, 0x7f, 0x42, 0xfe,
+	     0x49, 0xfc, 0x27, 0xfd, 0x9f, 0x0c, 0x80, 0xa2, 0x00, 0x0a,
+	     0x05, 0x28, 0x1d, 0xa0, 0x8c, 0x80, 0xa2, 0x02, 0x8a, 0x0c,
+	     0x28, 0x37, 0xa0, 0x10, 0x81, 0x82, 0x04, 0x8a, 0x13, 0x28,
+	     0x58, 0xa0, 0x84, 0x81, 0x82, 0x06, 0xca, 0x1a, 0x28, 0x71,
+	     0xa0, 0xdc, 0x81, 0xe2, 0x07, 0x4a, 0x22, 0x28, 0x95, 0xa0,
+	     0x64, 0x82, 0xc2, 0x09, 0xca, 0x28, 0x28, 0xa5, 0xa0, 0xbc,
+	     0x82, 0x92, 0x0b, 0xca, 0x31, 0x28, 0xcf, 0xa0, 0x58, 0x83,
+	     0xe2, 0x0d, 0x8a, 0x38, 0x28, 0xef, 0xa0, 0xec, 0x83, 0x82,
+	     0x10, 0xca, 0x42, 0x28, 0x0f, 0xa1, 0x48, 0x84, 0xe2, 0x11,
+	     0x4a, 0x49, 0x28, 0x32, 0xa1, 0xf8, 0x84, 0x72, 0x14, 0x4a,
+	     0x55, 0x28, 0x5e, 0xa1, 0x9c, 0x85, 0x32, 0x17, 0xca, 0x5f,
+	     0x28, 0x88, 0xa1, 0x40, 0x86, 0x92, 0x19, 0xca, 0x66, 0x28,
+	     0xa1, 0xa1, 0xb4, 0x86, 0x92, 0x1b, 0xca, 0x6f, 0x28, 0xcc,
+	     0xa1, 0x4c, 0x87, 0x72, 0x1d, 0x8a, 0x77, 0x28, 0xe8, 0xa1,
+	     0xcc, 0x87, 0xf2, 0x1f, 0x0a, 0x82, 0x28, 0x13, 0xa2, 0x80,
+	     0x88, 0x52, 0x22, 0x4a, 0x8a, 0x28, 0x36, 0xa2, 0xe4, 0x88,
+	     0x42, 0x24, 0x4a, 0x92, 0x28, 0x4c, 0xa2, 0x48, 0x89, 0xa2,
+	     0x25, 0x4a, 0x98, 0x28, 0x69, 0xa2, 0xb0, 0x89, 0x92, 0x27,
+	     0x0a, 0x9f, 0x28, 0x8a, 0xa2, 0x48, 0x8a, 0xd2, 0x29, 0x8a,
+	     0xaa, 0x28, 0xad, 0xa2, 0xe4, 0x8a, 0x12, 0x2c, 0xca, 0xb3,
+	     0x28, 0xd1, 0xa2, 0x7c, 0x8b, 0xa2, 0x2e, 0x0a, 0xbc, 0x28,
+	     0xfd, 0xa2, 0x28, 0x8c, 0x42, 0x31, 0x8a, 0xc7, 0x28, 0x25,
+	     0xa3, 0xc4, 0x8c, 0xe2, 0x33, 0x4a, 0xd0, 0x28, 0x4b, 0xa3,
+	     0x4c, 0x8d, 0x72, 0x35, 0x4a, 0xd7, 0x28, 0x69, 0xa3, 0xd0,
+	     0x8d, 0x92, 0x37, 0x4a, 0xdf, 0x28, 0x87, 0xa3, 0x30, 0x8e,
+	     0x92, 0x39, 0x8a, 0xe9, 0x28, 0xab, 0xa3, 0xdc, 0x8e, 0x12,
+	     0x3c, 0xca, 0xf1, 0x28, 0xca, 0xa3, 0x60, 0x8f, 0x32, 0x3e,
+	     0x4a, 0xfc, 0x28, 0xfa, 0xa3, 0x18, 0x90, 0xf2, 0x40, 0x4a,
+	     0x07, 0x29, 0x2a, 0xa4, 0xd8, 0x90, 0x02, 0x44, 0x0a, 0x13,
+	     0x29, 0x51, 0xa4, 0x5c, 0x91, 0x22, 0x46, 0x8a, 0x1b, 0x29,
+	     0x76, 0xa4, 0xf0, 0x91, 0x52, 0x48, 0x4a, 0x23, 0x29, 0x98,
+	     0xa4, 0x6c, 0x92, 0x52, 0x4a, 0x0a, 0x2b, 0x29, 0xaf, 0xa4,
+	     0xc4, 0x92, 0x92, 0x4b, 0xca, 0x31, 0x29, 0xca, 0xa4, 0x48,
+	     0x93, 0xe2, 0x4d, 0xca, 0x3a, 0x29, 0xf1, 0xa4, 0xdc, 0x93,
+	     0xa2, 0x4f, 0x4a, 0x41, 0x29, 0x0e, 0xa5, 0x64, 0x94, 0x52,
+	     0x52, 0x0a, 0x4b, 0x29, 0x32, 0xa5, 0xec, 0x94, 0x42, 0x54,
+	     0xca, 0x51, 0x29, 0x54, 0xa5, 0x60, 0x95, 0x42, 0x56, 0xca,
+	     0x59, 0x29, 0x73, 0xa5, 0xd4, 0x95, 0xd2, 0x57, 0xca, 0x60,
+	     0x29, 0x8f, 0xa5, 0x54, 0x96, 0x32, 0x5a, 0xca, 0x6b, 0x29,
+	     0xb2, 0xa5, 0xec, 0x96, 0x92, 0x5c, 0x0a, 0x74, 0x29, 0xd5,
+	     0xa5, 0x7c, 0x97, 0x72, 0x5e, 0x0a, 0x7c, 0x29, 0xf3, 0xa5,
+	     0xf8, 0x97, 0x92, 0x60, 0x0a, 0x85, 0x29, 0x1d, 0xa6, 0x94,
+	     0x98, 0xf2, 0x62, 0xca, 0x8d, 0x29, 0x44, 0xa6, 0x30, 0x99,
+	     0x82, 0x65, 0x0a, 0x98, 0x29, 0x65, 0xa6, 0xc4, 0x99, 0xe2,
+	     0x67, 0x8a, 0xa1, 0x29, 0x88, 0xa6, 0x44, 0x9a, 0xe2, 0x69,
+	     0x4a, 0xa8, 0x29, 0xa5, 0xa6, 0xa8, 0x9a, 0x62, 0x6b, 0x8a,
+	     0xae, 0x29, 0xbf, 0xa6, 0x30, 0x9b, 0x42, 0x6d, 0x4a, 0xb7,
+	     0x29, 0xe7, 0xa6, 0xbc, 0x9b, 0x42, 0x6f, 0x4a, 0xbf, 0x29,
+	     0x07, 0xa7, 0x48, 0x9c, 0xe2, 0x71, 0x8a, 0xca, 0x29, 0x31,
+	     0xa7, 0xec, 0x9c, 0x62, 0x74, 0xca, 0xd3, 0x29, 0x5d, 0xa7,
+	     0x98, 0x9d, 0x82, 0x76, 0xca, 0xdb, 0x29, 0x78, 0xa7, 0xf0,
+	     0x9d, 0x42, 0x78, 0x4a, 0xe3, 0x29, 0x9b, 0xa7, 0x80, 0x9e,
+	     0xb2, 0x7a, 0xca, 0xec, 0x29, 0xbc, 0xa7, 0x08, 0x9f, 0x02,
+	     0x7d, 0x0a, 0xf7, 0x29, 0xe7, 0xa7, 0xc4, 0x9f, 0x52, 0x7f,
+	     0x8a, 0x00, 0x2a, 0x10, 0xa8, 0x6c, 0xa0, 0x82, 0x82, 0x4a,
+	     0x0d, 0x2a, 0x42, 0xa8, 0x20, 0xa1, 0x22, 0x85, 0xca, 0x15,
+	     0x2a, 0x62, 0xa8, 0xa0, 0xa1, 0xd2, 0x86, 0x8a, 0x1d, 0x2a,
+	     0x83, 0xa8, 0x14, 0xa2, 0x32, 0x89, 0x0a, 0x27, 0x2a, 0xa1,
+	     0xa8, 0x94, 0xa2, 0x92, 0x8a, 0x0a, 0x2b, 0x2a, 0xb3, 0xa8,
+	     0xec, 0xa2, 0x22, 0x8c, 0x0a, 0x33, 0x2a, 0xd6, 0xa8, 0x7c,
+	     0xa3, 0xd2, 0x8e, 0x4a, 0x3d, 0x2a, 0xf9, 0xa8, 0x08, 0xa4,
+	     0x62, 0x90, 0x4a, 0x44, 0x2a, 0x14, 0xa9, 0x88, 0xa4, 0xb2,
+	     0x92, 0xca, 0x4b, 0x2a, 0x3b, 0xa9, 0xf8, 0xa4, 0x62, 0x94,
+	     0x4a, 0x54, 0x2a, 0x58, 0xa9, 0x68, 0xa5, 0x72, 0x96, 0x4a,
+	     0x5d, 0x2a, 0x78, 0xa9, 0xf4, 0xa5, 0xb2, 0x98, 0xca, 0x64,
+	     0x2a, 0xa0, 0xa9, 0xb8, 0xa6, 0x82, 0x9b, 0x4a, 0x6f, 0x2a,
+	     0xc1, 0xa9, 0x10, 0xa7, 0x72, 0x9c, 0x0a, 0x75, 0x2a, 0xdb,
+	     0xa9, 0x84, 0xa7, 0xe2, 0x9e, 0x0a, 0x7d, 0x2a, 0xfb, 0xa9,
+	     0x14, 0xa8, 0xa2, 0xa0, 0x8a, 0x84, 0x2a, 0x17, 0xaa, 0x64,
+	     0xa8, 0x12, 0xa2, 0x0a, 0x8a, 0x2a, 0x2c, 0xaa, 0xe8, 0xa8,
+	     0xf2, 0xa3, 0x0a, 0x91, 0x2a, 0x52, 0xaa, 0x58, 0xa9, 0xe2,
+	     0xa5, 0x4a, 0x99, 0x2a, 0x6d, 0xaa, 0xc8, 0xa9, 0x92, 0xa7,
+	     0x0a, 0x9f, 0x2a, 0x85, 0xaa, 0x34, 0xaa, 0x62, 0xa9, 0x4a,
+	     0xa7, 0x2a, 0xa5, 0xaa, 0xa8, 0xaa, 0x12, 0xab, 0xca, 0xae,
+	     0x2a, 0xc5, 0xaa, 0x24, 0xab, 0xe2, 0xac, 0xca, 0xb4, 0x2a,
+	     0xda, 0xaa, 0x98, 0xab, 0x82, 0xae, 0x8a, 0xbb, 0x2a, 0xf8,
+	     0xaa, 0xfc, 0xab, 0xb2, 0xb0, 0x0a, 0xc6, 0x2a, 0x1f, 0xab,
+	     0xa0, 0xac, 0xc2, 0xb2, 0x0a, 0xcc, 0x2a, 0x3a, 0xab, 0x14,
+	     0xad, 0x12, 0xb5, 0x0a, 0xd7, 0x2a, 0x64, 0xab, 0xc4, 0xad,
+	     0xd2, 0xb7, 0xca, 0xe2, 0x2a, 0x8e, 0xab, 0x68, 0xae, 0x72,
+	     0xba, 0x8a, 0xea, 0x2a, 0xb5, 0xab, 0xe0, 0xae, 0x62, 0xbc,
+	     0x0a, 0xf3, 0x2a, 0xd7, 0xab, 0x94, 0xaf, 0x82, 0xbe, 0x0a,
+	     0xfd, 0x2a, 0xf9, 0xab, 0x00, 0xb0, 0xe2, 0xc0, 0x0a, 0x06,
+	     0x2b, 0x21, 0xac, 0x8c, 0xb0, 0xd2, 0xc2, 0x8a, 0x0c, 0x2b,
+	     0x3c, 0xac, 0x04, 0xb1, 0x42, 0xc4, 0xca, 0x11, 0x2b, 0x50,
+	     0xac, 0x68, 0xb1, 0x72, 0xc6, 0xca, 0x1c, 0x2b, 0x80, 0xac,
+	     0x24, 0xb2, 0x32, 0xc9, 0x8a, 0x25, 0x2b, 0x9d, 0xac, 0x8c,
+	     0xb2, 0x92, 0xca, 0x0a, 0x2b, 0x2b, 0xb4, 0xac, 0xf8, 0xb2,
+	     0xc2, 0xcc, 0x4a, 0x35, 0x2b, 0xde, 0xac, 0x94, 0xb3, 0x32,
+	     0xcf, 0x0a, 0x3f, 0x2b, 0x09, 0xad, 0x48, 0xb4, 0x72, 0xd1,
+	     0x0a, 0x49, 0x2b, 0x2c, 0xad, 0xb8, 0xb4, 0x62, 0xd3, 0x8a,
+	     0x4e, 0x2b, 0x40, 0xad, 0x30, 0xb5, 0x72, 0xd5, 0x4a, 0x57,
+	     0x2b, 0x63, 0xad, 0xac, 0xb5, 0x32, 0xd7, 0x8a, 0x5e, 0x2b,
+	     0x83, 0xad, 0x20, 0xb6, 0xd2, 0xd8, 0x8a, 0x64, 0x2b, 0x98,
+	     0xad, 0x80, 0xb6, 0x52, 0xda, 0x4a, 0x6b, 0x2b, 0xba, 0xad,
+	     0x18, 0xb7, 0x02, 0xdd, 0x4a, 0x77, 0x2b, 0xe6, 0xad, 0xac,
+	     0xb7, 0xf2, 0xde, 0x0a, 0x7f, 0x2b, 0x02, 0xae, 0x38, 0xb8,
+	     0xb2, 0xe1, 0x8a, 0x89, 0x2b, 0x28, 0xae, 0xbc, 0xb8, 0x42,
+	     0xe3, 0xca, 0x8d, 0x2b, 0x42, 0xae, 0x30, 0xb9, 0xa2, 0xe5,
+	     0x8a, 0x99, 0x2b, 0x69, 0xae, 0xb4, 0xb9, 0xa2, 0xe7, 0x8a,
+	     0xa0, 0x2b, 0x85, 0xae, 0x28, 0xba, 0x02, 0xe9, 0x4a, 0xa5,
+	     0x2b, 0xa1, 0xae, 0x94, 0xba, 0x82, 0xea, 0x4a, 0xab, 0x2b,
+	     0xb4, 0xae, 0x04, 0xbb, 0x42, 0xec, 0x0a, 0xb4, 0x2b, 0xd6,
+	     0xae, 0x64, 0xbb, 0xb2, 0xed, 0x0a, 0xb9, 0x2b, 0xeb, 0xae,
+	     0xe4, 0xbb, 0x22, 0xf0, 0x4a, 0xc1, 0x2b, 0x11, 0xaf, 0x50,
+	     0xbc, 0xa2, 0xf1, 0x4a, 0xc8, 0x2b, 0x2e, 0xaf, 0xf0, 0xbc,
+	     0x52, 0xf4, 0x4a, 0xd3, 0x2b, 0x55, 0xaf, 0x68, 0xbd, 0x72,
+	     0xf6, 0x0a, 0xdb, 0x2b, 0x6f, 0xaf, 0xd8, 0xbd, 0xd2, 0xf7,
+	     0x0a, 0xe0, 0x2b, 0x8b, 0xaf, 0x64, 0xbe, 0x42, 0xfa, 0x8a,
+	     0xeb, 0x2b, 0xb2, 0xaf, 0xec, 0xbe, 0x52, 0xfc, 0x4a, 0xf3,
+	     0x2b, 0xd6, 0xaf, 0x78, 0xbf, 0x82, 0xfe, 0x0a, 0xfb, 0x2b,
+	     0xf9, 0xaf, 0x10, 0xc0, 0xc2, 0x00, 0x0b, 0x05, 0x2c, 0x20,
+	     0xb0, 0x98, 0xc0, 0x22, 0x03, 0xcb, 0x0e, 0x2c, 0x44, 0xb0,
+	     0x1c, 0xc1, 0x92, 0x04, 0x0b, 0x15, 0x2c, 0x62, 0xb0, 0xb4,
+	     0xc1, 0x52, 0x07, 0x0b, 0x1f, 0x2c, 0x80, 0xb0, 0x14, 0xc2,
+	     0x92, 0x08, 0x0b, 0x25, 0x2c, 0x9f, 0xb0, 0xa8, 0xc2, 0x72,
+	     0x0b, 0x8b, 0x2f, 0x2c, 0xc8, 0xb0, 0x48, 0xc3, 0xe2, 0x0d,
+	     0xcb, 0x39, 0x2c, 0xed, 0xb0, 0xd0, 0xc3, 0x82, 0x0f, 0x8b,
+	     0x3f, 0x2c, 0x07, 0xb1, 0x38, 0xc4, 0x22, 0x11, 0x8b, 0x46,
+	     0x2c, 0x27, 0xb1, 0xa8, 0xc4, 0xf2, 0x12, 0x8b, 0x4e, 0x2c,
+	     0x42, 0xb1, 0x24, 0xc5, 0x42, 0x15, 0xcb, 0x55, 0x2c, 0x62,
+	     0xb1, 0x90, 0xc5, 0xf2, 0x16, 0xcb, 0x5e, 0x2c, 0x84, 0xb1,
+	     0x30, 0xc6, 0x42, 0x19, 0x0b, 0x67, 0x2c, 0xa5, 0xb1, 0xb0,
+	     0xc6, 0x02, 0x1b, 0x0b, 0x6f, 0x2c, 0xc7, 0xb1, 0x2c, 0xc7,
+	     0xe2, 0x1c, 0x8b, 0x76, 0x2c, 0xdd, 0xb1, 0xa0, 0xc7, 0xf2,
+	     0x1e, 0x0b, 0x7e, 0x2c, 0xfb, 0xb1, 0x20, 0xc8, 0x42, 0x21,
+	     0xcb, 0x87, 0x2c, 0x22, 0xb2, 0x9c, 0xc8, 0xf2, 0x22, 0x4b,
+	     0x8c, 0x2c, 0x37, 0xb2, 0x08, 0xc9, 0x72, 0x24, 0x4b, 0x93,
+	     0x2c, 0x55, 0xb2, 0x60, 0xc9, 0xb2, 0x25, 0x4b, 0x98, 0x2c,
+	     0x6f, 0xb2, 0xd4, 0xc9, 0xc2, 0x27, 0x4b, 0xa1, 0x2c, 0x8a,
+	     0xb2, 0x5c, 0xca, 0xd2, 0x29, 0x0b, 0xaa, 0x2c, 0xab, 0xb2,
+	     0xd0, 0xca, 0xf2, 0x2b, 0x0b, 0xb3, 0x2c, 0xd5, 0xb2, 0x74,
+	     0xcb, 0xa2, 0x2e, 0x0b, 0xbb, 0x2c, 0xf9, 0xb2, 0x18, 0xcc,
+	     0xe2, 0x30, 0x0b, 0xc5, 0x2c, 0x21, 0xb3, 0x94, 0xcc, 0x12,
+	     0x33, 0xcb, 0xcf, 0x2c, 0x49, 0xb3, 0x5c, 0xcd, 0xa2, 0x35,
+	     0x8b, 0xd9, 0x2c, 0x72, 0xb3, 0xe0, 0xcd, 0x62, 0x38, 0x0b,
+	     0xe5, 0x2c, 0xa1, 0xb3, 0xa4, 0xce, 0x12, 0x3b, 0x0b, 0xef,
+	     0x2c, 0xc5, 0xb3, 0x34, 0xcf, 0x22, 0x3d, 0x4b, 0xf7, 0x2c,
+	     0xe2, 0xb3, 0xa0, 0xcf, 0xd2, 0x3e, 0x0b, 0xfd, 0x2c, 0xf9,
+	     0xb3, 0xec, 0xcf, 0x52, 0x40, 0x0b, 0x04, 0x2d, 0x13, 0xb4,
+	     0x68, 0xd0, 0x02, 0x42, 0x8b, 0x09, 0x2d, 0x2b, 0xb4, 0xc4,
+	     0xd0, 0xf2, 0x43, 0x0b, 0x12, 0x2d, 0x51, 0xb4, 0x54, 0xd1,
+	     0xe2, 0x45, 0xcb, 0x1a, 0x2d, 0x73, 0xb4, 0xe0, 0xd1, 0x02,
+	     0x48, 0xcb, 0x20, 0x2d, 0x91, 0xb4, 0x7c, 0xd2, 0x72, 0x4a,
+	     0x0b, 0x2b, 0x2d, 0xaf, 0xb4, 0xec, 0xd2, 0x02, 0x4c, 0x8b,
+	     0x32, 0x2d, 0xcf, 0xb4, 0x5c, 0xd3, 0xe2, 0x4d, 0x8b, 0x38,
+	     0x2d, 0xee, 0xb4, 0xd0, 0xd3, 0xc2, 0x4f, 0x0b, 0x42, 0x2d,
+	     0x0a, 0xb5, 0x34, 0xd4, 0x32, 0x51, 0x8b, 0x46, 0x2d, 0x26,
+	     0xb5, 0xc4, 0xd4, 0xe2, 0x53, 0xcb, 0x51, 0x2d, 0x4f, 0xb5,
+	     0x58, 0xd5, 0x92, 0x55, 0x8b, 0x57, 0x2d, 0x64, 0xb5, 0xc0,
+	     0xd5, 0xc2, 0x57, 0x4b, 0x60, 0x2d, 0x87, 0xb5, 0x28, 0xd6,
+	     0x12, 0x59, 0x4b, 0x66, 0x2d, 0xa0, 0xb5, 0xb8, 0xd6, 0x52,
+	     0x5b, 0x4b, 0x70, 0x2d, 0xcf, 0xb5, 0x48, 0xd7, 0xc2, 0x5d,
+	     0x8b, 0x7a, 0x2d, 0xf7, 0xb5, 0xec, 0xd7, 0x62, 0x60, 0x8b,
+	     0x83, 0x2d, 0x11, 0xb6, 0x4c, 0xd8, 0x82, 0x61, 0xcb, 0x88,
+	     0x2d, 0x26, 0xb6, 0xc4, 0xd8, 0x92, 0x63, 0xcb, 0x90, 0x2d,
+	     0x48, 0xb6, 0x58, 0xd9, 0xb2, 0x65, 0x8b, 0x99, 0x2d, 0x74,
+	     0xb6, 0x00, 0xda, 0x52, 0x68, 0x0b, 0xa4, 0x2d, 0x94, 0xb6,
+	     0x70, 0xda, 0x02, 0x6a, 0x4b, 0xaa, 0x2d, 0xb4, 0xb6, 0xf4,
+	     0xda, 0xa2, 0x6c, 0x0b, 0xb3, 0x2d, 0xd6, 0xb6, 0x78, 0xdb,
+	     0x42, 0x6e, 0x8b, 0xba, 0x2d, 0xf4, 0xb6, 0x04, 0xdc, 0xd2,
+	     0x70, 0x8b, 0xc6, 0x2d, 0x24, 0xb7, 0xac, 0xdc, 0x02, 0x73,
+	     0xcb, 0xcc, 0x2d, 0x3f, 0xb7, 0x1c, 0xdd, 0x12, 0x75, 0xcb,
+	     0xd6, 0x2d, 0x68, 0xb7, 0xcc, 0xdd, 0x02, 0x78, 0x0b, 0xe3,
+	     0x2d, 0x9a, 0xb7, 0x84, 0xde, 0x52, 0x7a, 0x8b, 0xec, 0x2d,
+	     0xb4, 0xb7, 0xf4, 0xde, 0x52, 0x7c, 0xcb, 0xf2, 0x2d, 0xd8,
+	     0xb7, 0x94, 0xdf, 0xf2, 0x7e, 0x4b, 0xff, 0x2d, 0x02, 0xb8,
+	     0x40, 0xe0, 0x72, 0x81, 0x8b, 0x06, 0x2e, 0x23, 0xb8, 0xb4,
+	     0xe0, 0x52, 0x83, 0x8b, 0x0e, 0x2e, 0x3f, 0xb8, 0x30, 0xe1,
+	     0x12, 0x85, 0x0b, 0x16, 0x2e, 0x5d, 0xb8, 0xa4, 0xe1, 0xd2,
+	     0x86, 0x4b, 0x1e, 0x2e, 0x7f, 0xb8, 0x18, 0xe2, 0x82, 0x88,
+	     0xcb, 0x22, 0x2e, 0x8e, 0xb8, 0x64, 0xe2, 0xe2, 0x89, 0x8b,
+	     0x28, 0x2e, 0xaf, 0xb8, 0xec, 0xe2, 0x02, 0x8c, 0xcb, 0x30,
+	     0x2e, 0xcc, 0xb8, 0x64, 0xe3, 0x52, 0x8e, 0x0b, 0x3b, 0x2e,
+	     0xf5, 0xb8, 0x08, 0xe4, 0xe2, 0x90, 0xcb, 0x46, 0x2e, 0x22,
+	     0xb9, 0xb0, 0xe4, 0x22, 0x93, 0x8b, 0x4e, 0x2e, 0x47, 0xb9,
+	     0x28, 0xe5, 0x72, 0x95, 0xcb, 0x58, 0x2e, 0x6d, 0xb9, 0xe4,
+	     0xe5, 0x72, 0x98, 0x8b, 0x63, 0x2e, 0x93, 0xb9, 0x60, 0xe6,
+	     0x02, 0x9a, 0x4b, 0x69, 0x2e, 0xae, 0xb9, 0xd8, 0xe6, 0x32,
+	     0x9c, 0x0b, 0x74, 0x2e, 0xd4, 0xb9, 0x74, 0xe7, 0xb2, 0x9e,
+	     0x4b, 0x7d, 0x2e, 0xfd, 0xb9, 0x18, 0xe8, 0xd2, 0xa0, 0xcb,
+	     0x86, 0x2e, 0x25, 0xba, 0xcc, 0xe8, 0xa2, 0xa3, 0xcb, 0x8f,
+	     0x2e, 0x4a, 0xba, 0x38, 0xe9, 0x62, 0xa5, 0x4b, 0x98, 0x2e,
+	     0x63, 0xba, 0xb8, 0xe9, 0xb2, 0xa7, 0x0b, 0xa2, 0x2e, 0x92,
+	     0xba, 0x58, 0xea, 0x32, 0xaa, 0x8b, 0xab, 0x2e, 0xb5, 0xba,
+	     0xf8, 0xea, 0xa2, 0xac, 0x4b, 0xb3, 0x2e, 0xd3, 0xba, 0x60,
+	     0xeb, 0xd2, 0xad, 0x8b, 0xb8, 0x2e, 0xe7, 0xba, 0xbc, 0xeb,
+	     0xd2, 0xaf, 0x4b, 0xc2, 0x2e, 0x0e, 0xbb, 0x70, 0xec, 0x22,
+	     0xb2, 0xcb, 0xc9, 0x2e, 0x32, 0xbb, 0xf4, 0xec, 0xb2, 0xb4,
+	     0xcb, 0xd3, 0x2e, 0x57, 0xbb, 0x7c, 0xed, 0x82, 0xb6, 0x4b,
+	     0xdb, 0x2e, 0x75, 0xbb, 0xe8, 0xed, 0x32, 0xb8, 0x0b, 0xe4,
+	     0x2e, 0x93, 0xbb, 0x58, 0xee, 0x92, 0xb9, 0x0b, 0xe7, 0x2e,
+	     0xa8, 0xbb, 0xb0, 0xee, 0x72, 0xbb, 0x8b, 0xf0, 0x2e, 0xcc,
+	     0xbb, 0x60, 0xef, 0xd2, 0xbd, 0x0b, 0xfa, 0x2e, 0xf4, 0xbb,
+	     0xdc, 0xef, 0x12, 0xc0, 0x8b, 0x01, 0x2f, 0x0b, 0xbc, 0x3c,
+	     0xf0, 0x72, 0xc1, 0x0b, 0x08, 0x2f, 0x23, 0xbc, 0xb0, 0xf0,
+	     0x52, 0xc3, 0x4b, 0x10, 0x2f, 0x43, 0xbc, 0x30, 0xf1, 0x42,
+	     0xc5, 0x8b, 0x18, 0x2f, 0x67, 0xbc, 0xc0, 0xf1, 0xc2, 0xc7,
+	     0x8b, 0x22, 0x2f, 0x90, 0xbc, 0x4c, 0xf2, 0xe2, 0xc9, 0x4b,
+	     0x29, 0x2f, 0xae, 0xbc, 0xcc, 0xf2, 0x62, 0xcb, 0xcb, 0x30,
+	     0x2f, 0xcb, 0xbc, 0x58, 0xf3, 0x92, 0xcd, 0x0b, 0x38, 0x2f,
+	     0xed, 0xbc, 0xe4, 0xf3, 0xf2, 0xcf, 0xcb, 0x40, 0x2f, 0x11,
+	     0xbd, 0x74, 0xf4, 0x22, 0xd2, 0x0b, 0x4c, 0x2f, 0x3a, 0xbd,
+	     0x10, 0xf5, 0x72, 0xd4, 0x4b, 0x55, 0x2f, 0x5f, 0xbd, 0x88,
+	     0xf5, 0xf2, 0xd6, 0x4b, 0x5c, 0x2f, 0x79, 0xbd, 0x10, 0xf6,
+	     0xa2, 0xd8, 0x4b, 0x64, 0x2f, 0x99, 0xbd, 0x94, 0xf6, 0x12,
+	     0xdb, 0xcb, 0x6d, 0x2f, 0xbe, 0xbd, 0x04, 0xf7, 0x82, 0xdc,
+	     0xcb, 0x74, 0x2f, 0xdc, 0xbd, 0xa0, 0xf7, 0xb2, 0xde, 0x0b,
+	     0x7c, 0x2f, 0xf5, 0xbd, 0xe4, 0xf7, 0xc2, 0xdf, 0x0b, 0x81,
+	     0x2f, 0x11, 0xbe, 0x5c, 0xf8, 0xa2, 0xe1, 0xcb, 0x89, 0x2f,
+	     0x33, 0xbe, 0xf4, 0xf8, 0x92, 0xe4, 0x4b, 0x94, 0x2f, 0x5f,
+	     0xbe, 0x88, 0xf9, 0x92, 0xe6, 0xcb, 0x9d, 0x2f, 0x7c, 0xbe,
+	     0x18, 0xfa, 0x22, 0xe9, 0x8b, 0xa7, 0x2f, 0xa2, 0xbe, 0xa8,
+	     0xfa, 0x52, 0xeb, 0x8b, 0xb0, 0x2f, 0xca, 0xbe, 0x40, 0xfb,
+	     0x92, 0xed, 0x4b, 0xb7, 0x2f, 0xdf, 0xbe, 0xa4, 0xfb, 0xf2,
+	     0xee, 0xcb, 0xbc, 0x2f, 0xff, 0xbe, 0x14, 0xfc, 0x22, 0xf1,
+	     0x0b, 0xc6, 0x2f, 0x24, 0xbf, 0xb4, 0xfc, 0xb2, 0xf3, 0x4b,
+	     0xd0, 0x2f, 0x4d, 0xbf, 0x40, 0xfd, 0x82, 0xf5, 0x4b, 0xd8,
+	     0x2f, 0x6b, 0xbf, 0xc0, 0xfd, 0x92, 0xf7, 0xcb, 0xde, 0x2f,
+	     0x7e, 0xbf, 0x10, 0xfe, 0x22, 0xf9, 0xcb, 0xe6, 0x2f, 0xa3,
+	     0xbf, 0xa4, 0xfe, 0x72, 0xfb, 0xcb, 0xef, 0x2f, 0xc2, 0xbf,
+	     0x24, 0xff, 0x22, 0xfd, 0x8b, 0xf5, 0x2f, 0xe4, 0xbf, 0xa8,
+	     0xff, 0x22, 0xff, 0x8b, 0xff, 0x2f, 0x05, 0xc0, 0x40, 0x00,
+	     0xa3, 0x01, 0x0c, 0x08, 0x30, 0x24, 0xc0, 0xc8, 0x00, 0x83,
+	     0x03, 0x4c, 0x10, 0x30, 0x44, 0xc0, 0x3c, 0x01, 0x83, 0x05,
+	     0x4c, 0x19, 0x30, 0x69, 0xc0, 0xc0, 0x01, 0x23, 0x07, 0x0c,
+	     0x20, 0x30, 0x83, 0xc0, 0x28, 0x02, 0xe3, 0x08, 0xcc, 0x26,
+	     0x30, 0xa0, 0xc0, 0x98, 0x02, 0x13, 0x0b, 0x4c, 0x2d, 0x30,
+	     0xba, 0xc0, 0x0c, 0x03, 0x93, 0x0c, 0x0c, 0x33, 0x30, 0xcf,
+	     0xc0, 0x74, 0x03, 0x83, 0x0e, 0xcc, 0x3c, 0x30, 0xff, 0xc0,
+	     0x14, 0x04, 0xe3, 0x10, 0x8c, 0x45, 0x30, 0x1f, 0xc1, 0xb4,
+	     0x04, 0xa3, 0x13, 0xcc, 0x51, 0x30, 0x49, 0xc1, 0x30, 0x05,
+	     0x93, 0x15, 0x4c, 0x57, 0x30, 0x61, 0xc1, 0xa0, 0x05, 0xe3,
+	     0x16, 0xcc, 0x5e, 0x30, 0x88, 0xc1, 0x3c, 0x06, 0xd3, 0x19,
+	     0x8c, 0x68, 0x30, 0xb0, 0xc1, 0xf8, 0x06, 0x23, 0x1c, 0x8c,
+	     0x72, 0x30, 0xd8, 0xc1, 0x8c, 0x07, 0x93, 0x1e, 0x8c, 0x7d,
+	     0x30, 0x03, 0xc2, 0x24, 0x08, 0x13, 0x21, 0x4c, 0x86, 0x30,
+	     0x1f, 0xc2, 0xa0, 0x08, 0xb3, 0x22, 0x8c, 0x8d, 0x30, 0x3f,
+	     0xc2, 0x04, 0x09, 0x43, 0x24, 0x4c, 0x93, 0x30, 0x5a, 0xc2,
+	     0x88, 0x09, 0x83, 0x26, 0xcc, 0x9c, 0x30, 0x7b, 0xc2, 0x08,
+	     0x0a, 0xb3, 0x28, 0x8c, 0xa3, 0x30, 0x94, 0xc2, 0x64, 0x0a,
+	     0x13, 0x2a, 0x4c, 0xaa, 0x30, 0xaf, 0xc2, 0xe0, 0x0a, 0x63,
+	     0x2c, 0x8c, 0xb3, 0x30, 0xdb, 0xc2, 0x88, 0x0b, 0x93, 0x2e,
+	     0x0c, 0xbb, 0x30, 0xf7, 0xc2, 0x00, 0x0c, 0x43, 0x30, 0x0c,
+	     0xc3, 0x30, 0x1a, 0xc3, 0x94, 0x0c, 0xd3, 0x32, 0x0c, 0xce,
+	     0x30, 0x43, 0xc3, 0x1c, 0x0d, 0xa3, 0x34, 0xcc, 0xd4, 0x30,
+	     0x5a, 0xc3, 0x84, 0x0d, 0x83, 0x36, 0xcc, 0xdc, 0x30, 0x78,
+	     0xc3, 0xfc, 0x0d, 0xc3, 0x38, 0x0c, 0xe4, 0x30, 0x96, 0xc3,
+	     0x7c, 0x0e, 0x33, 0x3a, 0x8c, 0xeb, 0x30, 0xb6, 0xc3, 0xe8,
+	     0x0e, 0xd3, 0x3b, 0x0c, 0xf2, 0x30, 0xd6, 0xc3, 0x74, 0x0f,
+	     0x83, 0x3e, 0xcc, 0xfa, 0x30, 0xef, 0xc3, 0xd0, 0x0f, 0xb3,
+	     0x3f, 0xcc, 0x01, 0x31, 0x09, 0xc4, 0x54, 0x10, 0xf3, 0x41,
+	     0xcc, 0x08, 0x31, 0x29, 0xc4, 0xbc, 0x10, 0xc3, 0x43, 0x8c,
+	     0x12, 0x31, 0x53, 0xc4, 0x68, 0x11, 0x53, 0x46, 0x8c, 0x1b,
+	     0x31, 0x75, 0xc4, 0xfc, 0x11, 0x63, 0x48, 0xcc, 0x23, 0x31,
+	     0x9b, 0xc4, 0x94, 0x12, 0xe3, 0x4a, 0x0c, 0x2e, 0x31, 0xc5,
+	     0xc4, 0x38, 0x13, 0x33, 0x4d, 0xcc, 0x35, 0x31, 0xdb, 0xc4,
+	     0x7c, 0x13, 0xd3, 0x4e, 0xcc, 0x3c, 0x31, 0xfd, 0xc4, 0xfc,
+	     0x13, 0x23, 0x50, 0x0c, 0x43, 0x31, 0x18, 0xc5, 0x84, 0x14,
+	     0xb3, 0x52, 0x0c, 0x4e, 0x31, 0x3c, 0xc5, 0xfc, 0x14, 0x23,
+	     0x54, 0x4c, 0x52, 0x31, 0x4e, 0xc5, 0x58, 0x15, 0x23, 0x56,
+	     0xcc, 0x5b, 0x31, 0x72, 0xc5, 0x00, 0x16, 0x53, 0x58, 0x0c,
+	     0x63, 0x31, 0x93, 0xc5, 0x6c, 0x16, 0x13, 0x5a, 0x0c, 0x6b,
+	     0x31, 0xaf, 0xc5, 0xe8, 0x16, 0x43, 0x5c, 0xcc, 0x71, 0x31,
+	     0xcc, 0xc5, 0x54, 0x17, 0xc3, 0x5d, 0x4c, 0x79, 0x31, 0xf3,
+	     0xc5, 0xf4, 0x17, 0x83, 0x60, 0x8c, 0x85, 0x31, 0x22, 0xc6,
+	     0xbc, 0x18, 0x33, 0x63, 0xcc, 0x8d, 0x31, 0x3e, 0xc6, 0x30,
+	     0x19, 0x53, 0x65, 0x8c, 0x98, 0x31, 0x70, 0xc6, 0xe8, 0x19,
+	     0x73, 0x68, 0x4c, 0xa3, 0x31, 0x90, 0xc6, 0x60, 0x1a, 0x43,
+	     0x6a, 0x4c, 0xab, 0x31, 0xb5, 0xc6, 0x0c, 0x1b, 0x93, 0x6c,
+	     0x4c, 0xb5, 0x31, 0xe1, 0xc6, 0xa0, 0x1b, 0xc3, 0x6e, 0x4c,
+	     0xbc, 0x31, 0xfc, 0xc6, 0x00, 0x1c, 0x63, 0x70, 0x0c, 0xc4,
+	     0x31, 0x13, 0xc7, 0x80, 0x1c, 0xd3, 0x72, 0xcc, 0xcc, 0x31,
+	     0x3e, 0xc7, 0x1c, 0x1d, 0x93, 0x74, 0xcc, 0xd5, 0x31, 0x62,
+	     0xc7, 0xc0, 0x1d, 0xe3, 0x77, 0x8c, 0xe2, 0x31, 0x91, 0xc7,
+	     0x68, 0x1e, 0xd3, 0x79, 0x8c, 0xea, 0x31, 0xaf, 0xc7, 0xdc,
+	     0x1e, 0xb3, 0x7b, 0x0c, 0xf2, 0x31, 0xd2, 0xc7, 0x78, 0x1f,
+	     0xb3, 0x7e, 0xcc, 0xfd, 0x31, 0x01, 0xc8, 0x18, 0x20, 0x93,
+	     0x80, 0x0c, 0x03, 0x32, 0x1a, 0xc8, 0x8c, 0x20, 0x03, 0x83,
+	     0x8c, 0x0e, 0x32, 0x42, 0xc8, 0x38, 0x21, 0x73, 0x85, 0x4c,
+	     0x16, 0x32, 0x60, 0xc8, 0xb4, 0x21, 0x93, 0x87, 0x0c, 0x1f,
+	     0x32, 0x80, 0xc8, 0x28, 0x22, 0x23, 0x89, 0xcc, 0x26, 0x32,
+	     0xa5, 0xc8, 0xb8, 0x22, 0x73, 0x8b, 0x8c, 0x2f, 0x32, 0xc7,
+	     0xc8, 0x4c, 0x23, 0xc3, 0x8d, 0xcc, 0x39, 0x32, 0xec, 0xc8,
+	     0xe8, 0x23, 0x23, 0x90, 0xcc, 0x42, 0x32, 0x14, 0xc9, 0x64,
+	     0x24, 0x13, 0x92, 0x0c, 0x4a, 0x32, 0x35, 0xc9, 0xec, 0x24,
+	     0x23, 0x94, 0x8c, 0x52, 0x32, 0x52, 0xc9, 0x7c, 0x25, 0x13,
+	     0x96, 0x4c, 0x5a, 0x32, 0x77, 0xc9, 0xf8, 0x25, 0x63, 0x98,
+	     0x4c, 0x62, 0x32, 0x8d, 0xc9, 0x48, 0x26, 0x73, 0x99, 0xcc,
+	     0x68, 0x32, 0xa7, 0xc9, 0xc8, 0x26, 0xa3, 0x9b, 0x8c, 0x6f,
+	     0x32, 0xca, 0xc9, 0x44, 0x27, 0x63, 0x9d, 0xcc, 0x76, 0x32,
+	     0xe4, 0xc9, 0xb4, 0x27, 0x83, 0x9f, 0x4c, 0x7f, 0x32, 0x06,
+	     0xca, 0x50, 0x28, 0x93, 0xa1, 0x4c, 0x88, 0x32, 0x2d, 0xca,
+	     0xd0, 0x28, 0x93, 0xa3, 0x0c, 0x91, 0x32, 0x47, 0xca, 0x38,
+	     0x29, 0xc3, 0xa5, 0x0c, 0x9a, 0x32, 0x73, 0xca, 0x04, 0x2a,
+	     0x63, 0xa8, 0xcc, 0xa3, 0x32, 0x98, 0xca, 0x68, 0x2a, 0xd3,
+	     0xa9, 0x0c, 0xa9, 0x32, 0xb1, 0xca, 0xd8, 0x2a, 0x23, 0xac,
+	     0xcc, 0xb1, 0x32, 0xd0, 0xca, 0x6c, 0x2b, 0x13, 0xae, 0x8c,
+	     0xbb, 0x32, 0xf7, 0xca, 0x14, 0x2c, 0x33, 0xb1, 0x8c, 0xc6,
+	     0x32, 0x28, 0xcb, 0xb8, 0x2c, 0x93, 0xb3, 0x0c, 0xd0, 0x32,
+	     0x46, 0xcb, 0x48, 0x2d, 0xc3, 0xb5, 0x4c, 0xd8, 0x32, 0x68,
+	     0xcb, 0xa8, 0x2d, 0x73, 0xb7, 0x0c, 0xdf, 0x32, 0x84, 0xcb,
+	     0x48, 0x2e, 0xe3, 0xb9, 0xcc, 0xe9, 0x32, 0xb1, 0xcb, 0xd0,
+	     0x2e, 0x93, 0xbb, 0x0c, 0xef, 0x32, 0xc5, 0xcb, 0x34, 0x2f,
+	     0x33, 0xbd, 0xcc, 0xf7, 0x32, 0xe9, 0xcb, 0xb0, 0x2f, 0x63,
+	     0xbf, 0xcc, 0xfe, 0x32, 0x06, 0xcc, 0x44, 0x30, 0x43, 0xc1,
+	     0x4c, 0x08, 0x33, 0x2a, 0xcc, 0xdc, 0x30, 0xb3, 0xc3, 0x4c,
+	     0x12, 0x33, 0x4b, 0xcc, 0x58, 0x31, 0xd3, 0xc5, 0xcc, 0x18,
+	     0x33, 0x6c, 0xcc, 0xc0, 0x31, 0x43, 0xc7, 0xcc, 0x1d, 0x33,
+	     0x80, 0xcc, 0x30, 0x32, 0x93, 0xc9, 0x8c, 0x29, 0x33, 0xac,
+	     0xcc, 0xc8, 0x32, 0xd3, 0xcb, 0x4c, 0x30, 0x33, 0xcf, 0xcc,
+	     0x5c, 0x33, 0xf3, 0xcd, 0x8c, 0x38, 0x33, 0xea, 0xcc, 0xb4,
+	     0x33, 0x53, 0xcf, 0xcc, 0x3e, 0x33, 0x09, 0xcd, 0x44, 0x34,
+	     0xc3, 0xd1, 0x4c, 0x49, 0x33, 0x29, 0xcd, 0xd4, 0x34, 0x73,
+	     0xd3, 0x8c, 0x4e, 0x33, 0x46, 0xcd, 0x30, 0x35, 0x13, 0xd5,
+	     0xcc, 0x55, 0x33, 0x62, 0xcd, 0xac, 0x35, 0x63, 0xd7, 0x8c,
+	     0x5f, 0x33, 0x8a, 0xcd, 0x38, 0x36, 0x43, 0xd9, 0x4c, 0x66,
+	     0x33, 0xa0, 0xcd, 0xb4, 0x36, 0x63, 0xdb, 0x4c, 0x6e, 0x33,
+	     0xc0, 0xcd, 0x28, 0x37, 0xc3, 0xdc, 0xcc, 0x73, 0x33, 0xd5,
+	     0xcd, 0x70, 0x37, 0x63, 0xde, 0x0c, 0x7d, 0x33, 0xf8, 0xcd,
+	     0xf0, 0x37, 0x33, 0xe0, 0x4c, 0x82, 0x33, 0x10, 0xce, 0x58,
+	     0x38, 0x43, 0xe2, 0x8c, 0x8b, 0x33, 0x31, 0xce, 0xfc, 0x38,
+	     0xa3, 0xe4, 0x0c, 0x94, 0x33, 0x58, 0xce, 0x88, 0x39, 0xf3,
+	     0xe6, 0x8c, 0x9e, 0x33, 0x84, 0xce, 0x34, 0x3a, 0x43, 0xe9,
+	     0x8c, 0xa5, 0x33, 0x99, 0xce, 0x88, 0x3a, 0x93, 0xea, 0x8c,
+	     0xac, 0x33, 0xbc, 0xce, 0x14, 0x3b, 0xb3, 0xec, 0xcc, 0xb5,
+	     0x33, 0xdc, 0xce, 0xa8, 0x3b, 0x13, 0xef, 0x0c, 0xbe, 0x33,
+	     0x06, 0xcf, 0x40, 0x3c, 0xb3, 0xf1, 0xcc, 0xc7, 0x33, 0x26,
+	     0xcf, 0xb8, 0x3c, 0x93, 0xf3, 0xcc, 0xd0, 0x33, 0x46, 0xcf,
+	     0x34, 0x3d, 0x13, 0xf5, 0x4c, 0xd6, 0x33, 0x62, 0xcf, 0xac,
+	     0x3d, 0x53, 0xf7, 0x0c, 0xdf, 0x33, 0x7f, 0xcf, 0x28, 0x3e,
+	     0x53, 0xf9, 0xcc, 0xe5, 0x33, 0x9e, 0xcf, 0xa4, 0x3e, 0xf3,
+	     0xfa, 0x4c, 0xed, 0x33, 0xbd, 0xcf, 0x04, 0x3f, 0xf3, 0xfc,
+	     0x4c, 0xf5, 0x33, 0xde, 0xcf, 0xac, 0x3f, 0x03, 0xff, 0x4c,
+	     0xff, 0x33, 0x06, 0xd0, 0x48, 0x40, 0xf3, 0x01, 0xcd, 0x0a,
+	     0x34, 0x36, 0xd0, 0x04, 0x41, 0xe3, 0x04, 0x4d, 0x14, 0x34,
+	     0x5b, 0xd0, 0x7c, 0x41, 0xa3, 0x06, 0x0d, 0x1b, 0x34, 0x77,
+	     0xd0, 0xec, 0x41, 0x83, 0x08, 0x4d, 0x25, 0x34, 0x9b, 0xd0,
+	     0x90, 0x42, 0x93, 0x0a, 0x0d, 0x2b, 0x34, 0xb2, 0xd0, 0xf4,
+	     0x42, 0x53, 0x0c, 0x0d, 0x34, 0x34, 0xde, 0xd0, 0xa0, 0x43,
+	     0xf3, 0x0e, 0x8d, 0x3c, 0x34, 0xf6, 0xd0, 0xe4, 0x43, 0x53,
+	     0x10, 0x4d, 0x44, 0x34, 0x18, 0xd1, 0x70, 0x44, 0x83, 0x12,
+	     0x4d, 0x4c, 0x34, 0x3a, 0xd1, 0x04, 0x45, 0xf3, 0x14, 0xcd,
+	     0x55, 0x34, 0x60, 0xd1, 0x94, 0x45, 0x33, 0x17, 0xcd, 0x5d,
+	     0x34, 0x79, 0xd1, 0x18, 0x46, 0xb3, 0x18, 0x4d, 0x65, 0x34,
+	     0x9f, 0xd1, 0xb0, 0x46, 0x23, 0x1b, 0x0d, 0x70, 0x34, 0xc8,
+	     0xd1, 0x40, 0x47, 0xd3, 0x1d, 0x0d, 0x7a, 0x34, 0xec, 0xd1,
+	     0xd8, 0x47, 0xd3, 0x1f, 0x8d, 0x80, 0x34, 0x08, 0xd2, 0x44,
+	     0x48, 0xe3, 0x21, 0x0d, 0x8b, 0x34, 0x38, 0xd2, 0x14, 0x49,
+	     0xf3, 0x24, 0x8d, 0x96, 0x34, 0x5d, 0xd2, 0xa4, 0x49, 0xc3,
+	     0x26, 0xcd, 0x9d, 0x34, 0x7b, 0xd2, 0xf4, 0x49, 0x23, 0x28,
+	     0x0d, 0xa3, 0x34, 0x96, 0xd2, 0x68, 0x4a, 0x13, 0x2a, 0xcd,
+	     0xa9, 0x34, 0xae, 0xd2, 0xcc, 0x4a, 0xb3, 0x2b, 0x8d, 0xaf,
+	     0x34, 0xcc, 0xd2, 0x60, 0x4b, 0x23, 0x2e, 0x8d, 0xba, 0x34,
+	     0xf7, 0xd2, 0xf0, 0x4b, 0x83, 0x30, 0x0d, 0xc4, 0x34, 0x1e,
+	     0xd3, 0xa4, 0x4c, 0xf3, 0x32, 0x4d, 0xcc, 0x34, 0x39, 0xd3,
+	     0x18, 0x4d, 0x33, 0x35, 0x0d, 0xd7, 0x34, 0x62, 0xd3, 0xac,
+	     0x4d, 0xf3, 0x36, 0xcd, 0xdd, 0x34, 0x7d, 0xd3, 0x0c, 0x4e,
+	     0x03, 0x39, 0x4d, 0xe6, 0x34, 0x9c, 0xd3, 0x80, 0x4e, 0xa3,
+	     0x3a, 0x8d, 0xec, 0x34, 0xbd, 0xd3, 0x20, 0x4f, 0x03, 0x3d,
+	     0x0d, 0xf5, 0x34, 0xe2, 0xd3, 0x90, 0x4f, 0xa3, 0x3e, 0x8d,
+	     0xfb, 0x34, 0xf1, 0xd3, 0xd4, 0x4f, 0x13, 0x40, 0x4d, 0x03,
+	     0x35, 0x17, 0xd4, 0x90, 0x50, 0xe3, 0x42, 0x4d, 0x0d, 0x35,
+	     0x3e, 0xd4, 0x1c, 0x51, 0x53, 0x45, 0xcd, 0x16, 0x35, 0x67,
+	     0xd4, 0xd0, 0x51, 0x23, 0x48, 0x8d, 0x22, 0x35, 0x94, 0xd4,
+	     0x64, 0x52, 0x43, 0x4a, 0x0d, 0x2b, 0x35, 0xb9, 0xd4, 0x04,
+	     0x53, 0xf3, 0x4c, 0x0d, 0x37, 0x35, 0xe3, 0xd4, 0xa0, 0x53,
+	     0x53, 0x4f, 0xcd, 0x40, 0x35, 0x0d, 0xd5, 0x60, 0x54, 0x63,
+	     0x52, 0x4d, 0x4c, 0x35, 0x35, 0xd5, 0xdc, 0x54, 0xa3, 0x53,
+	     0x8d, 0x50, 0x35, 0x50, 0xd5, 0x5c, 0x55, 0xe3, 0x55, 0x0d,
+	     0x5b, 0x35, 0x75, 0xd5, 0xf4, 0x55, 0x93, 0x58, 0x0d, 0x64,
+	     0x35, 0x99, 0xd5, 0x88, 0x56, 0xd3, 0x5a, 0x0d, 0x6d, 0x35,
+	     0xb7, 0xd5, 0x0c, 0x57, 0x73, 0x5c, 0x0d, 0x75, 0x35, 0xd9,
+	     0xd5, 0x70, 0x57, 0xf3, 0x5d, 0x0d, 0x79, 0x35, 0xf0, 0xd5,
+	     0xdc, 0x57, 0xa3, 0x5f, 0x8d, 0x7f, 0x35, 0x04, 0xd6, 0x34,
+	     0x58, 0x83, 0x61, 0x0d, 0x89, 0x35, 0x27, 0xd6, 0xbc, 0x58,
+	     0xd3, 0x63, 0x4d, 0x90, 0x35, 0x46, 0xd6, 0x50, 0x59, 0xd3,
+	     0x65, 0x8d, 0x98, 0x35, 0x6b, 0xd6, 0xdc, 0x59, 0xf3, 0x67,
+	     0x4d, 0xa1, 0x35, 0x89, 0xd6, 0x2c, 0x5a, 0xf3, 0x68, 0xcd,
+	     0xa6, 0x35, 0xa3, 0xd6, 0xb8, 0x5a, 0x63, 0x6b, 0x4d, 0xaf,
+	     0x35, 0xcb, 0xd6, 0x48, 0x5b, 0xa3, 0x6d, 0x0d, 0xba, 0x35,
+	     0xf3, 0xd6, 0x00, 0x5c, 0xd3, 0x70, 0x8d, 0xc5, 0x35, 0x1a,
+	     0xd7, 0x98, 0x5c, 0x43, 0x73, 0xcd, 0xcd, 0x35, 0x41, 0xd7,
+	     0x3c, 0x5d, 0x73, 0x75, 0xcd, 0xd7, 0x35, 0x6a, 0xd7, 0xd4,
+	     0x5d, 0x83, 0x77, 0x8d, 0xdf, 0x35, 0x8b, 0xd7, 0x5c, 0x5e,
+	     0xd3, 0x79, 0xcd, 0xe7, 0x35, 0xad, 0xd7, 0xe4, 0x5e, 0xe3,
+	     0x7b, 0xcd, 0xf1, 0x35, 0xcb, 0xd7, 0x3c, 0x5f, 0x53, 0x7d,
+	     0x0d, 0xf6, 0x35, 0xe0, 0xd7, 0x8c, 0x5f, 0xa3, 0x7e, 0x8d,
+	     0xfc, 0x35, 0xff, 0xd7, 0x0c, 0x60, 0xf3, 0x80, 0x0d, 0x07,
+	     0x36, 0x21, 0xd8, 0xa8, 0x60, 0x33, 0x83, 0x0d, 0x10, 0x36,
+	     0x43, 0xd8, 0x38, 0x61, 0xc3, 0x85, 0xcd, 0x17, 0x36, 0x64,
+	     0xd8, 0xb8, 0x61, 0xa3, 0x87, 0x8d, 0x21, 0x36, 0x94, 0xd8,
+	     0x84, 0x62, 0xa3, 0x8a, 0x0d, 0x2b, 0x36, 0xb9, 0xd8, 0xf8,
+	     0x62, 0x13, 0x8c, 0xcd, 0x31, 0x36, 0xd3, 0xd8, 0x5c, 0x63,
+	     0x13, 0x8e, 0x4d, 0x3b, 0x36, 0xf7, 0xd8, 0x04, 0x64, 0x63,
+	     0x90, 0xcd, 0x42, 0x36, 0x13, 0xd9, 0x80, 0x64, 0x53, 0x92,
+	     0x4d, 0x4b, 0x36, 0x30, 0xd9, 0xd0, 0x64, 0x73, 0x93, 0x0d,
+	     0x4f, 0x36, 0x48, 0xd9, 0x4c, 0x65, 0x83, 0x95, 0x8d, 0x58,
+	     0x36, 0x6b, 0xd9, 0xb8, 0x65, 0x73, 0x97, 0xcd, 0x60, 0x36,
+	     0x89, 0xd9, 0x40, 0x66, 0x93, 0x99, 0x4d, 0x67, 0x36, 0x9f,
+	     0xd9, 0xac, 0x66, 0xe3, 0x9a, 0x8d, 0x6d, 0x36, 0xbb, 0xd9,
+	     0x1c, 0x67, 0x53, 0x9d, 0x0d, 0x78, 0x36, 0xe5, 0xd9, 0xcc,
+	     0x67, 0xb3, 0x9f, 0x8d, 0x7f, 0x36, 0x09, 0xda, 0x50, 0x68,
+	     0xd3, 0xa1, 0x4d, 0x88, 0x36, 0x2a, 0xda, 0xdc, 0x68, 0x53,
+	     0xa4, 0xcd, 0x94, 0x36, 0x5a, 0xda, 0x84, 0x69, 0x33, 0xa6,
+	     0xcd, 0x9a, 0x36, 0x76, 0xda, 0x00, 0x6a, 0xd3, 0xa8, 0x8d,
+	     0xa6, 0x36, 0x9e, 0xda, 0xac, 0x6a, 0x23, 0xab, 0x8d, 0xae,
+	     0x36, 0xc7, 0xda, 0x34, 0x6b, 0x33, 0xad, 0x4d, 0xb8, 0x36,
+	     0xe7, 0xda, 0xc4, 0x6b, 0x43, 0xaf, 0x4d, 0xc0, 0x36, 0x0c,
+	     0xdb, 0x68, 0x6c, 0x03, 0xb2, 0xcd, 0xc8, 0x36, 0x2e, 0xdb,
+	     0xd4, 0x6c, 0x13, 0xb4, 0x4d, 0xd3, 0x36, 0x54, 0xdb, 0x60,
+	     0x6d, 0xb3, 0xb5, 0x4d, 0xd7, 0x36, 0x65, 0xdb, 0xa8, 0x6d,
+	     0x33, 0xb7, 0x8d, 0xdd, 0x36, 0x7e, 0xdb, 0x0c, 0x6e, 0x03,
+	     0xb9, 0x4d, 0xe6, 0x36, 0xa6, 0xdb, 0xc0, 0x6e, 0x53, 0xbb,
+	     0x8d, 0xf0, 0x36, 0xca, 0xdb, 0x40, 0x6f, 0x43, 0xbd, 0x0d,
+	     0xf7, 0x36, 0xe0, 0xdb, 0xac, 0x6f, 0xe3, 0xbe, 0x0d, 0xfd,
+	     0x36, 0x01, 0xdc, 0x38, 0x70, 0x53, 0xc1, 0x0d, 0x08, 0x37,
+	     0x27, 0xdc, 0xc0, 0x70, 0xc3, 0xc3, 0x0d, 0x12, 0x37, 0x55,
+	     0xdc, 0x68, 0x71, 0x63, 0xc6, 0x4d, 0x1b, 0x37, 0x71, 0xdc,
+	     0xcc, 0x71, 0x73, 0xc7, 0xcd, 0x20, 0x37, 0x88, 0xdc, 0x2c,
+	     0x72, 0x23, 0xc9, 0xcd, 0x25, 0x37, 0x9c, 0xdc, 0x8c, 0x72,
+	     0x83, 0xca, 0x0d, 0x2c, 0x37, 0xb8, 0xdc, 0x08, 0x73, 0xe3,
+	     0xcc, 0x8d, 0x36, 0x37, 0xe3, 0xdc, 0xa0, 0x73, 0xd3, 0xce,
+	     0x0d, 0x3e, 0x37, 0xfd, 0xdc, 0x28, 0x74, 0x43, 0xd1, 0x0d,
+	     0x47, 0x37, 0x26, 0xdd, 0xc4, 0x74, 0x43, 0xd3, 0x0d, 0x50,
+	     0x37, 0x4d, 0xdd, 0x64, 0x75, 0xf3, 0xd5, 0x0d, 0x5b, 0x37,
+	     0x75, 0xdd, 0xe4, 0x75, 0xd3, 0xd7, 0x8d, 0x61, 0x37, 0x94,
+	     0xdd, 0x5c, 0x76, 0xb3, 0xd9, 0x4d, 0x68, 0x37, 0xa9, 0xdd,
+	     0xb8, 0x76, 0x43, 0xdb, 0x0d, 0x70, 0x37, 0xc8, 0xdd, 0x3c,
+	     0x77, 0x73, 0xdd, 0x4d, 0x78, 0x37, 0xea, 0xdd, 0xe0, 0x77,
+	     0x23, 0xe0, 0x0d, 0x84, 0x37, 0x1b, 0xde, 0x88, 0x78, 0xf3,
+	     0xe2, 0x4d, 0x8d, 0x37, 0x3e, 0xde, 0x30, 0x79, 0x53, 0xe5,
+	     0x0d, 0x98, 0x37, 0x64, 0xde, 0xa4, 0x79, 0x73, 0xe7, 0x8d,
+	     0x9e, 0x37, 0x82, 0xde, 0x1c, 0x7a, 0xe3, 0xe8, 0x0d, 0xa5,
+	     0x37, 0x96, 0xde, 0x64, 0x7a, 0x53, 0xea, 0xcd, 0xaa, 0x37,
+	     0xae, 0xde, 0xd8, 0x7a, 0xc3, 0xeb, 0x0d, 0xb2, 0x37, 0xcd,
+	     0xde, 0x5c, 0x7b, 0xb3, 0xed, 0x4d, 0xba, 0x37, 0xf6, 0xde,
+	     0x08, 0x7c, 0x03, 0xf1, 0x0d, 0xc5, 0x37, 0x17, 0xdf, 0x78,
+	     0x7c, 0x63, 0xf2, 0xcd, 0xcb, 0x37, 0x36, 0xdf, 0xec, 0x7c,
+	     0x23, 0xf4, 0x0d, 0xd3, 0x37, 0x56, 0xdf, 0x68, 0x7d, 0x03,
+	     0xf6, 0x8d, 0xd8, 0x37, 0x68, 0xdf, 0xd0, 0x7d, 0x03, 0xf8,
+	     0xcd, 0xe2, 0x37, 0x90, 0xdf, 0x68, 0x7e, 0xf3, 0xf9, 0xcd,
+	     0xea, 0x37, 0xb1, 0xdf, 0xec, 0x7e, 0x43, 0xfc, 0xcd, 0xf3,
+	     0x37, 0xd6, 0xdf, 0x6c, 0x7f, 0x33, 0xfe, 0x0d, 0xfc, 0x37,
+	     0xf7, 0xdf, 0xf8, 0x7f, 0xa3, 0x00, 0x8e, 0x03, 0x38, 0x1a,
+	     0xe0, 0x74, 0x80, 0x53, 0x02, 0x0e, 0x0c, 0x38, 0x3d, 0xe0,
+	     0x20, 0x81, 0xc3, 0x04, 0xce, 0x14, 0x38, 0x5a, 0xe0, 0xa0,
+	     0x81, 0xb3, 0x06, 0x0e, 0x1e, 0x38, 0x7c, 0xe0, 0x24, 0x82,
+	     0xb3, 0x08, 0x8e, 0x24, 0x38, 0x9c, 0xe0, 0xa4, 0x82, 0x63,
+	     0x0b, 0x0e, 0x31, 0x38, 0xcf, 0xe0, 0x58, 0x83, 0x13, 0x0e,
+	     0x4e, 0x3b, 0x38, 0xf3, 0xe0, 0xe8, 0x83, 0x03, 0x10, 0x8e,
+	     0x43, 0x38, 0x18, 0xe1, 0x7c, 0x84, 0x93, 0x12, 0x8e, 0x4c,
+	     0x38, 0x3d, 0xe1, 0x24, 0x85, 0x43, 0x15, 0x8e, 0x57, 0x38,
+	     0x6c, 0xe1, 0xe0, 0x85, 0x63, 0x18, 0x8e, 0x63, 0x38, 0x99,
+	     0xe1, 0x80, 0x86, 0x33, 0x1a, 0x0e, 0x6b, 0x38, 0xb0, 0xe1,
+	     0xc8, 0x86, 0xd3, 0x1b, 0x4e, 0x72, 0x38, 0xcc, 0xe1, 0x60,
+	     0x87, 0x63, 0x1e, 0x4e, 0x7a, 0x38, 0xf3, 0xe1, 0xe4, 0x87,
+	     0xe3, 0x1f, 0x4e, 0x82, 0x38, 0x0e, 0xe2, 0x5c, 0x88, 0xd3,
+	     0x21, 0x8e, 0x8a, 0x38, 0x32, 0xe2, 0xdc, 0x88, 0x43, 0x24,
+	     0xce, 0x91, 0x38, 0x4c, 0xe2, 0x64, 0x89, 0xe3, 0x25, 0x8e,
+	     0x9a, 0x38, 0x6d, 0xe2, 0xe0, 0x89, 0x53, 0x28, 0x0e, 0xa2,
+	     0x38, 0x90, 0xe2, 0x78, 0x8a, 0xa3, 0x2a, 0x8e, 0xad, 0x38,
+	     0xbb, 0xe2, 0x24, 0x8b, 0x63, 0x2d, 0x8e, 0xb8, 0x38, 0xe8,
+	     0xe2, 0xa8, 0x8b, 0x63, 0x2f, 0x4e, 0xc0, 0x38, 0x0b, 0xe3,
+	     0x50, 0x8c, 0xc3, 0x31, 0x8e, 0xc8, 0x38, 0x29, 0xe3, 0xcc,
+	     0x8c, 0x03, 0x34, 0xce, 0xd1, 0x38, 0x4b, 0xe3, 0x64, 0x8d,
+	     0x43, 0x36, 0xce, 0xda, 0x38, 0x75, 0xe3, 0x08, 0x8e, 0xa3,
+	     0x38, 0xce, 0xe3, 0x38, 0x98, 0xe3, 0x74, 0x8e, 0xb3, 0x3a,
+	     0x0e, 0xec, 0x38, 0xb7, 0xe3, 0xec, 0x8e, 0x43, 0x3c, 0x4e,
+	     0xf2, 0x38, 0xd0, 0xe3, 0x64, 0x8f, 0x23, 0x3e, 0x4e, 0xf9,
+	     0x38, 0xea, 0xe3, 0xc4, 0x8f, 0x93, 0x3f, 0x8e, 0x01, 0x39,
+	     0x0e, 0xe4, 0x68, 0x90, 0xc3, 0x41, 0x8e, 0x0a, 0x39, 0x31,
+	     0xe4, 0xf0, 0x90, 0x33, 0x44, 0x8e, 0x11, 0x39, 0x4e, 0xe4,
+	     0x48, 0x91, 0xa3, 0x45, 0x4e, 0x19, 0x39, 0x6a, 0xe4, 0xd8,
+	     0x91, 0x03, 0x48, 0x8e, 0x23, 0x39, 0x9b, 0xe4, 0x98, 0x92,
+	     0xf3, 0x4a, 0x0e, 0x2d, 0x39, 0xbf, 0xe4, 0x28, 0x93, 0x43,
+	     0x4d, 0xce, 0x37, 0x39, 0xe4, 0xe4, 0x9c, 0x93, 0x13, 0x4f,
+	     0x0e, 0x3f, 0x39, 0x09, 0xe5, 0x3c, 0x94, 0x43, 0x51, 0x0e,
+	     0x47, 0x39, 0x21, 0xe5, 0x8c, 0x94, 0xd3, 0x52, 0xce, 0x4c,
+	     0x39, 0x3a, 0xe5, 0x04, 0x95, 0x73, 0x54, 0x4e, 0x54, 0x39,
+	     0x57, 0xe5, 0x74, 0x95, 0x73, 0x56, 0x0e, 0x5d, 0x39, 0x77,
+	     0xe5, 0xf4, 0x95, 0x03, 0x58, 0x0e, 0x63, 0x39, 0x8f, 0xe5,
+	     0x50, 0x96, 0x83, 0x59, 0x8e, 0x69, 0x39, 0xb1, 0xe5, 0xd0,
+	     0x96, 0xc3, 0x5b, 0x4e, 0x72, 0x39, 0xd1, 0xe5, 0x7c, 0x97,
+	     0x13, 0x5e, 0x4e, 0x79, 0x39, 0xec, 0xe5, 0xc4, 0x97, 0x63,
+	     0x5f, 0x8e, 0x7f, 0x39, 0x0c, 0xe6, 0x54, 0x98, 0xc3, 0x61,
+	     0x4e, 0x88, 0x39, 0x2c, 0xe6, 0xd4, 0x98, 0xf3, 0x63, 0xce,
+	     0x90, 0x39, 0x50, 0xe6, 0x5c, 0x99, 0xe3, 0x65, 0x0e, 0x9a,
+	     0x39, 0x75, 0xe6, 0x08, 0x9a, 0x73, 0x68, 0xce, 0xa3, 0x39,
+	     0x95, 0xe6, 0x80, 0x9a, 0x53, 0x6a, 0x4e, 0xac, 0x39, 0xb3,
+	     0xe6, 0xdc, 0x9a, 0x03, 0x6c, 0x0e, 0xb2, 0x39, 0xd4, 0xe6,
+	     0x74, 0x9b, 0x73, 0x6e, 0xce, 0xba, 0x39, 0xf8, 0xe6, 0x0c,
+	     0x9c, 0x63, 0x70, 0x8e, 0xc2, 0x39, 0x18, 0xe7, 0x7c, 0x9c,
+	     0xd3, 0x72, 0x4e, 0xce, 0x39, 0x3e, 0xe7, 0x04, 0x9d, 0xb3,
+	     0x74, 0x0e, 0xd5, 0x39, 0x59, 0xe7, 0x84, 0x9d, 0x83, 0x76,
+	     0xce, 0xdb, 0x39, 0x73, 0xe7, 0xe8, 0x9d, 0x33, 0x78, 0x4e,
+	     0xe2, 0x39, 0x8e, 0xe7, 0x68, 0x9e, 0x23, 0x7a, 0xce, 0xea,
+	     0x39, 0xaf, 0xe7, 0xd4, 0x9e, 0x13, 0x7c, 0xce, 0xf3, 0x39,
+	     0xd4, 0xe7, 0x74, 0x9f, 0x93, 0x7e, 0x4e, 0xfd, 0x39, 0xfb,
+	     0xe7, 0x10, 0xa0, 0xb3, 0x80, 0x4e, 0x04, 0x3a, 0x1f, 0xe8,
+	     0xa0, 0xa0, 0x43, 0x83, 0x4e, 0x0e, 0x3a, 0x41, 0xe8, 0x34,
+	     0xa1, 0x93, 0x85, 0x0e, 0x17, 0x3a, 0x68, 0xe8, 0xb4, 0xa1,
+	     0x03, 0x87, 0x4e, 0x1d, 0x3a, 0x78, 0xe8, 0x14, 0xa2, 0x03,
+	     0x89, 0x8e, 0x26, 0x3a, 0x9e, 0xe8, 0xa0, 0xa2, 0xa3, 0x8a,
+	     0x4e, 0x2c, 0x3a, 0xbf, 0xe8, 0x18, 0xa3, 0xa3, 0x8c, 0x0e,
+	     0x35, 0x3a, 0xdf, 0xe8, 0x98, 0xa3, 0xa3, 0x8e, 0x8e, 0x3d,
+	     0x3a, 0xfd, 0xe8, 0x0c, 0xa4, 0xf3, 0x90, 0x4e, 0x45, 0x3a,
+	     0x20, 0xe9, 0xb0, 0xa4, 0x83, 0x93, 0x0e, 0x50, 0x3a, 0x45,
+	     0xe9, 0x34, 0xa5, 0x03, 0x95, 0x4e, 0x57, 0x3a, 0x6a, 0xe9,
+	     0xd8, 0xa5, 0xb3, 0x97, 0x0e, 0x60, 0x3a, 0x84, 0xe9, 0x48,
+	     0xa6, 0x53, 0x99, 0xce, 0x65, 0x3a, 0xa0, 0xe9, 0x94, 0xa6,
+	     0xf3, 0x9a, 0x4e, 0x6e, 0x3a, 0xc6, 0xe9, 0x24, 0xa7, 0x63,
+	     0x9d, 0x8e, 0x76, 0x3a, 0xdf, 0xe9, 0x90, 0xa7, 0x73, 0x9e,
+	     0x4e, 0x7d, 0x3a, 0xfd, 0xe9, 0x14, 0xa8, 0x93, 0xa0, 0x8e,
+	     0x83, 0x3a, 0x1a, 0xea, 0x80, 0xa8, 0x53, 0xa2, 0x8e, 0x8a,
+	     0x3a, 0x36, 0xea, 0xe4, 0xa8, 0xf3, 0xa3, 0x0e, 0x92, 0x3a,
+	     0x4c, 0xea, 0x64, 0xa9, 0x53, 0xa6, 0x8e, 0x9b, 0x3a, 0x74,
+	     0xea, 0xe4, 0xa9, 0xc3, 0xa7, 0x0e, 0xa2, 0x3a, 0x91, 0xea,
+	     0x78, 0xaa, 0x53, 0xaa, 0xce, 0xaa, 0x3a, 0xb4, 0xea, 0xf4,
+	     0xaa, 0x63, 0xac, 0xce, 0xb3, 0x3a, 0xda, 0xea, 0x94, 0xab,
+	     0x13, 0xaf, 0xce, 0xbe, 0x3a, 0x08, 0xeb, 0x30, 0xac, 0x83,
+	     0xb1, 0x8e, 0xc7, 0x3a, 0x25, 0xeb, 0xb4, 0xac, 0x23, 0xb3,
+	     0x0e, 0xce, 0x3a, 0x45, 0xeb, 0x1c, 0xad, 0xa3, 0xb4, 0xce,
+	     0xd4, 0x3a, 0x5b, 0xeb, 0x98, 0xad, 0x43, 0xb7, 0x0e, 0xdf,
+	     0x3a, 0x86, 0xeb, 0x44, 0xae, 0x43, 0xb9, 0x4e, 0xe6, 0x3a,
+	     0x9e, 0xeb, 0x88, 0xae, 0xb3, 0xba, 0x8e, 0xeb, 0x3a, 0xb8,
+	     0xeb, 0xec, 0xae, 0x03, 0xbc, 0xce, 0xf1, 0x3a, 0xcf, 0xeb,
+	     0x70, 0xaf, 0x63, 0xbe, 0x0e, 0xfb, 0x3a, 0xf8, 0xeb, 0x18,
+	     0xb0, 0xf3, 0xc0, 0x0e, 0x07, 0x3b, 0x23, 0xec, 0xc0, 0xb0,
+	     0xa3, 0xc3, 0x8e, 0x10, 0x3b, 0x44, 0xec, 0x40, 0xb1, 0x43,
+	     0xc5, 0x4e, 0x17, 0x3b, 0x68, 0xec, 0xd8, 0xb1, 0x33, 0xc8,
+	     0xce, 0x23, 0x3b, 0x98, 0xec, 0x7c, 0xb2, 0x43, 0xca, 0x8e,
+	     0x2a, 0x3b, 0xb4, 0xec, 0xfc, 0xb2, 0x63, 0xcc, 0x4e, 0x33,
+	     0x3b, 0xd6, 0xec, 0x80, 0xb3, 0x83, 0xce, 0x0e, 0x3b, 0x3b,
+	     0xf7, 0xec, 0xf0, 0xb3, 0x53, 0xd0, 0xce, 0x44, 0x3b, 0x19,
+	     0xed, 0x90, 0xb4, 0xf3, 0xd2, 0x8e, 0x4d, 0x3b, 0x3b, 0xed,
+	     0x18, 0xb5, 0x13, 0xd5, 0x4e, 0x56, 0x3b, 0x5d, 0xed, 0x8c,
+	     0xb5, 0x73, 0xd6, 0x0e, 0x5d, 0x3b, 0x7d, 0xed, 0x08, 0xb6,
+	     0xf3, 0xd8, 0x8e, 0x64, 0x3b, 0x9e, 0xed, 0x98, 0xb6, 0x03,
+	     0xdb, 0x0e, 0x6f, 0x3b, 0xc5, 0xed, 0x34, 0xb7, 0xf3, 0xdc,
+	     0x4e, 0x77, 0x3b, 0xe5, 0xed, 0xa4, 0xb7, 0xd3, 0xde, 0xce,
+	     0x7e, 0x3b, 0xff, 0xed, 0x1c, 0xb8, 0xc3, 0xe0, 0x0e, 0x84,
+	     0x3b, 0x18, 0xee, 0x98, 0xb8, 0xe3, 0xe2, 0xce, 0x8d, 0x3b,
+	     0x42, 0xee, 0x30, 0xb9, 0xa3, 0xe5, 0x8e, 0x97, 0x3b, 0x69,
+	     0xee, 0xc8, 0xb9, 0xf3, 0xe7, 0x4e, 0xa3, 0x3b, 0x98, 0xee,
+	     0x88, 0xba, 0x83, 0xea, 0xce, 0xaa, 0x3b, 0xb3, 0xee, 0xd4,
+	     0xba, 0x83, 0xeb, 0x0e, 0xb1, 0x3b, 0xd0, 0xee, 0x68, 0xbb,
+	     0x33, 0xee, 0xce, 0xbb, 0x3b, 0xfa, 0xee, 0x18, 0xbc, 0xa3,
+	     0xf0, 0x0e, 0xc6, 0x3b, 0x25, 0xef, 0xc4, 0xbc, 0xc3, 0xf3,
+	     0xce, 0xcf, 0x3b, 0x49, 0xef, 0x5c, 0xbd, 0x33, 0xf6, 0xce,
+	     0xda, 0x3b, 0x6e, 0xef, 0xc8, 0xbd, 0x73, 0xf7, 0x0e, 0xdf,
+	     0x3b, 0x81, 0xef, 0x28, 0xbe, 0x13, 0xf9, 0x0e, 0xe6, 0x3b,
+	     0xa0, 0xef, 0xac, 0xbe, 0x83, 0xfb, 0xce, 0xef, 0x3b, 0xc2,
+	     0xef, 0x10, 0xbf, 0x03, 0xfd, 0xce, 0xf4, 0x3b, 0xe1, 0xef,
+	     0x90, 0xbf, 0xb3, 0xfe, 0x0e, 0xfe, 0x3b, 0x05, 0xf0, 0x44,
+	     0xc0, 0x93, 0x01, 0x8f, 0x08, 0x3c, 0x26, 0xf0, 0xb0, 0xc0,
+	     0xf3, 0x02, 0x4f, 0x0e, 0x3c, 0x3f, 0xf0, 0x08, 0xc1, 0x83,
+	     0x04, 0x0f, 0x15, 0x3c, 0x5f, 0xf0, 0xac, 0xc1, 0xf3, 0x06,
+	     0xcf, 0x1c, 0x3c, 0x7a, 0xf0, 0xf8, 0xc1, 0x43, 0x08, 0xcf,
+	     0x22, 0x3c, 0x8f, 0xf0, 0x60, 0xc2, 0xa3, 0x09, 0xcf, 0x27,
+	     0x3c, 0xa6, 0xf0, 0xa8, 0xc2, 0x53, 0x0b, 0xcf, 0x2f, 0x3c,
+	     0xc2, 0xf0, 0x34, 0xc3, 0x33, 0x0d, 0xcf, 0x37, 0x3c, 0xe3,
+	     0xf0, 0xc4, 0xc3, 0x53, 0x0f, 0x8f, 0x40, 0x3c, 0x0e, 0xf1,
+	     0x54, 0xc4, 0xf3, 0x11, 0xcf, 0x48, 0x3c, 0x29, 0xf1, 0xc0,
+	     0xc4, 0x53, 0x13, 0xcf, 0x4f, 0x3c, 0x47, 0xf1, 0x2c, 0xc5,
+	     0xf3, 0x14, 0x4f, 0x56, 0x3c, 0x5c, 0xf1, 0x78, 0xc5, 0xc3,
+	     0x16, 0x4f, 0x5e, 0x3c, 0x85, 0xf1, 0x44, 0xc6, 0x73, 0x19,
+	     0x4f, 0x69, 0x3c, 0xb1, 0xf1, 0xec, 0xc6, 0x23, 0x1c, 0x4f,
+	     0x73, 0x3c, 0xd7, 0xf1, 0x7c, 0xc7, 0x53, 0x1e, 0x8f, 0x7b,
+	     0x3c, 0xfa, 0xf1, 0x04, 0xc8, 0xb3, 0x20, 0x4f, 0x84, 0x3c,
+	     0x16, 0xf2, 0x74, 0xc8, 0x73, 0x22, 0x0f, 0x8b, 0x3c, 0x37,
+	     0xf2, 0xe4, 0xc8, 0x23, 0x24, 0x4f, 0x92, 0x3c, 0x4e, 0xf2,
+	     0x58, 0xc9, 0xe3, 0x25, 0x0f, 0x9a, 0x3c, 0x71, 0xf2, 0xec,
+	     0xc9, 0x83, 0x28, 0x0f, 0xa4, 0x3c, 0x94, 0xf2, 0x80, 0xca,
+	     0x43, 0x2a, 0x4f, 0xab, 0x3c, 0xb1, 0xf2, 0xf4, 0xca, 0x93,
+	     0x2c, 0x0f, 0xb3, 0x3c, 0xd9, 0xf2, 0x98, 0xcb, 0xc3, 0x2e,
+	     0x8f, 0xbd, 0x3c, 0xfc, 0xf2, 0x10, 0xcc, 0xa3, 0x30, 0xcf,
+	     0xc4, 0x3c, 0x18, 0xf3, 0x84, 0xcc, 0xb3, 0x32, 0x8f, 0xcc,
+	     0x3c, 0x3d, 0xf3, 0x0c, 0xcd, 0xb3, 0x34, 0x0f, 0xd5, 0x3c,
+	     0x56, 0xf3, 0x90, 0xcd, 0x13, 0x37, 0x0f, 0xdd, 0x3c, 0x7a,
+	     0xf3, 0xfc, 0xcd, 0xc3, 0x38, 0x8f, 0xe5, 0x3c, 0x9d, 0xf3,
+	     0xa0, 0xce, 0xb3, 0x3a, 0x4f, 0xed, 0x3c, 0xc1, 0xf3, 0x2c,
+	     0xcf, 0x33, 0x3d, 0x8f, 0xf6, 0x3c, 0xe4, 0xf3, 0xac, 0xcf,
+	     0x93, 0x3f, 0x8f, 0x00, 0x3d, 0x07, 0xf4, 0x44, 0xd0, 0x83,
+	     0x41, 0x8f, 0x07, 0x3d, 0x2c, 0xf4, 0xb8, 0xd0, 0x73, 0x43,
+	     0x8f, 0x0f, 0x3d, 0x4c, 0xf4, 0x58, 0xd1, 0x43, 0x46, 0x0f,
+	     0x1b, 0x3d, 0x7a, 0xf4, 0x10, 0xd2, 0xe3, 0x48, 0xcf, 0x25,
+	     0x3d, 0x9f, 0xf4, 0xa4, 0xd2, 0x63, 0x4b, 0x8f, 0x2e, 0x3d,
+	     0xbf, 0xf4, 0x18, 0xd3, 0x03, 0x4d, 0x4f, 0x35, 0x3d, 0xe0,
+	     0xf4, 0x98, 0xd3, 0xe3, 0x4e, 0xcf, 0x3d, 0x3d, 0xff, 0xf4,
+	     0x28, 0xd4, 0x03, 0x51, 0xcf, 0x45, 0x3d, 0x25, 0xf5, 0xa4,
+	     0xd4, 0x13, 0x53, 0x0f, 0x4e, 0x3d, 0x42, 0xf5, 0x24, 0xd5,
+	     0x13, 0x55, 0xcf, 0x55, 0x3d, 0x59, 0xf5, 0x80, 0xd5, 0xd3,
+	     0x56, 0xcf, 0x5d, 0x3d, 0x7c, 0xf5, 0x08, 0xd6, 0xe3, 0x58,
+	     0x4f, 0x64, 0x3d, 0x96, 0xf5, 0x7c, 0xd6, 0x73, 0x5a, 0x0f,
+	     0x6d, 0x3d, 0xc1, 0xf5, 0x18, 0xd7, 0x33, 0x5d, 0x0f, 0x77,
+	     0x3d, 0xe7, 0xf5, 0xb4, 0xd7, 0x43, 0x5f, 0x0f, 0x7e, 0x3d,
+	     0xfd, 0xf5, 0x14, 0xd8, 0xf3, 0x60, 0x0f, 0x86, 0x3d, 0x1e,
+	     0xf6, 0x98, 0xd8, 0xb3, 0x62, 0x4f, 0x8c, 0x3d, 0x36, 0xf6,
+	     0xf4, 0xd8, 0x33, 0x64, 0x4f, 0x93, 0x3d, 0x57, 0xf6, 0x6c,
+	     0xd9, 0xd3, 0x65, 0xcf, 0x99, 0x3d, 0x6f, 0xf6, 0xd8, 0xd9,
+	     0xf3, 0x67, 0x0f, 0xa3, 0x3d, 0x92, 0xf6, 0x64, 0xda, 0x73,
+	     0x6a, 0x8f, 0xab, 0x3d, 0xbb, 0xf6, 0x1c, 0xdb, 0xd3, 0x6c,
+	     0x4f, 0xb4, 0x3d, 0xdf, 0xf6, 0x9c, 0xdb, 0x53, 0x6f, 0xcf,
+	     0xbf, 0x3d, 0x03, 0xf7, 0x1c, 0xdc, 0xa3, 0x70, 0x0f, 0xc6,
+	     0x3d, 0x26, 0xf7, 0xcc, 0xdc, 0xa3, 0x73, 0x0f, 0xd0, 0x3d,
+	     0x46, 0xf7, 0x3c, 0xdd, 0x53, 0x75, 0x0f, 0xd6, 0x3d, 0x5a,
+	     0xf7, 0x84, 0xdd, 0x83, 0x76, 0x4f, 0xdc, 0x3d, 0x78, 0xf7,
+	     0xec, 0xdd, 0x23, 0x78, 0x0f, 0xe2, 0x3d, 0x95, 0xf7, 0x6c,
+	     0xde, 0x73, 0x7a, 0x8f, 0xeb, 0x3d, 0xb5, 0xf7, 0xfc, 0xde,
+	     0xb3, 0x7c, 0x4f, 0xf5, 0x3d, 0xdf, 0xf7, 0xb0, 0xdf, 0x43,
+	     0x7f, 0xcf, 0xfd, 0x3d, 0x00, 0xf8, 0x38, 0xe0, 0x83, 0x81,
+	     0xcf, 0x06, 0x3e, 0x25, 0xf8, 0xc8, 0xe0, 0xb3, 0x83, 0x4f,
+	     0x0f, 0x3e, 0x4b, 0xf8, 0x44, 0xe1, 0x93, 0x85, 0x0f, 0x17,
+	     0x3e, 0x67, 0xf8, 0xd4, 0xe1, 0x33, 0x88, 0xcf, 0x22, 0x3e,
+	     0x97, 0xf8, 0x88, 0xe2, 0xa3, 0x8a, 0x4f, 0x2d, 0x3e, 0xbe,
+	     0xf8, 0x0c, 0xe3, 0xe3, 0x8c, 0x4f, 0x34, 0x3e, 0xdc, 0xf8,
+	     0xa0, 0xe3, 0x53, 0x8f, 0x8f, 0x3f, 0x3e, 0x06, 0xf9, 0x2c,
+	     0xe4, 0xf3, 0x90, 0x4f, 0x44, 0x3e, 0x17, 0xf9, 0x80, 0xe4,
+	     0xb3, 0x92, 0x0f, 0x4e, 0x3e, 0x3f, 0xf9, 0x20, 0xe5, 0xc3,
+	     0x94, 0x8f, 0x54, 0x3e, 0x59, 0xf9, 0x80, 0xe5, 0x43, 0x96,
+	     0x8f, 0x5a, 0x3e, 0x73, 0xf9, 0xf0, 0xe5, 0x03, 0x98, 0x8f,
+	     0x62, 0x3e, 0x94, 0xf9, 0x84, 0xe6, 0xc3, 0x9a, 0x0f, 0x6e,
+	     0x3e, 0xbb, 0xf9, 0x24, 0xe7, 0xf3, 0x9c, 0x8f, 0x75, 0x3e,
+	     0xd9, 0xf9, 0x9c, 0xe7, 0x93, 0x9e, 0x8f, 0x7b, 0x3e, 0xfc,
+	     0xf9, 0x20, 0xe8, 0xc3, 0xa0, 0x8f, 0x84, 0x3e, 0x1c, 0xfa,
+	     0xa8, 0xe8, 0x83, 0xa3, 0x4f, 0x90, 0x3e, 0x46, 0xfa, 0x38,
+	     0xe9, 0x33, 0xa5, 0x4f, 0x96, 0x3e, 0x61, 0xfa, 0xac, 0xe9,
+	     0x73, 0xa7, 0x0f, 0xa0, 0x3e, 0x83, 0xfa, 0x38, 0xea, 0x03,
+	     0xa9, 0xcf, 0xa6, 0x3e, 0xa2, 0xfa, 0xc0, 0xea, 0xd3, 0xab,
+	     0xcf, 0xb0, 0x3e, 0xcc, 0xfa, 0x48, 0xeb, 0xb3, 0xad, 0x8f,
+	     0xb9, 0x3e, 0xed, 0xfa, 0xd4, 0xeb, 0x13, 0xb0, 0x8f, 0xc1,
+	     0x3e, 0x0c, 0xfb, 0x50, 0xec, 0xc3, 0xb1, 0x8f, 0xc9, 0x3e,
+	     0x2e, 0xfb, 0xd0, 0xec, 0x73, 0xb3, 0xcf, 0xce, 0x3e, 0x42,
+	     0xfb, 0x3c, 0xed, 0x93, 0xb5, 0x8f, 0xd7, 0x3e, 0x64, 0xfb,
+	     0x98, 0xed, 0xb3, 0xb6, 0x4f, 0xdd, 0x3e, 0x82, 0xfb, 0x38,
+	     0xee, 0x13, 0xb9, 0x8f, 0xe7, 0x3e, 0xaa, 0xfb, 0xc0, 0xee,
+	     0x63, 0xbb, 0x4f, 0xef, 0x3e, 0xc7, 0xfb, 0x40, 0xef, 0xb3,
+	     0xbd, 0x0f, 0xf8, 0x3e, 0xed, 0xfb, 0xe0, 0xef, 0x23, 0xc0,
+	     0x0f, 0x02, 0x3f, 0x0f, 0xfc, 0x68, 0xf0, 0x83, 0xc2, 0xcf,
+	     0x0c, 0x3f, 0x39, 0xfc, 0x0c, 0xf1, 0xc3, 0xc4, 0x8f, 0x16,
+	     0x3f, 0x67, 0xfc, 0xd4, 0xf1, 0xc3, 0xc7, 0x8f, 0x20, 0x3f,
+	     0x8f, 0xfc, 0x54, 0xf2, 0xf3, 0xc9, 0x4f, 0x28, 0x3f, 0xad,
+	     0xfc, 0xdc, 0xf2, 0x53, 0xcc, 0x4f, 0x32, 0x3f, 0xcc, 0xfc,
+	     0x50, 0xf3, 0xc3, 0xcd, 0x0f, 0x38, 0x3f, 0xec, 0xfc, 0xe4,
+	     0xf3, 0x33, 0xd0, 0x8f, 0x42, 0x3f, 0x16, 0xfd, 0x88, 0xf4,
+	     0x03, 0xd3, 0x8f, 0x4e, 0x3f, 0x47, 0xfd, 0x4c, 0xf5, 0xb3,
+	     0xd5, 0xcf, 0x59, 0x3f, 0x6f, 0xfd, 0xcc, 0xf5, 0x93, 0xd7,
+	     0xcf, 0x61, 0x3f, 0x8e, 0xfd, 0x4c, 0xf6, 0xb3, 0xd9, 0x0f,
+	     0x68, 0x3f, 0xae, 0xfd, 0xc0, 0xf6, 0x33, 0xdb, 0xcf, 0x6d,
+	     0x3f, 0xc1, 0xfd, 0x2c, 0xf7, 0x73, 0xdd, 0x4f, 0x79, 0x3f,
+	     0xf1, 0xfd, 0xe4, 0xf7, 0x33, 0xe0, 0x4f, 0x82, 0x3f, 0x12,
+	     0xfe, 0x64, 0xf8, 0x03, 0xe2, 0x8f, 0x8a, 0x3f, 0x2e, 0xfe,
+	     0xe0, 0xf8, 0x33, 0xe4, 0xcf, 0x93, 0x3f, 0x58, 0xfe, 0x88,
+	     0xf9, 0xe3, 0xe6, 0x4f, 0x9c, 0x3f, 0x79, 0xfe, 0xec, 0xf9,
+	     0x83, 0xe8, 0x4f, 0xa3, 0x3f, 0x90, 0xfe, 0x50, 0xfa, 0x93,
+	     0xe9, 0xcf, 0xa8, 0x3f, 0xad, 0xfe, 0xe0, 0xfa, 0xd3, 0xeb,
+	     0x8f, 0xb2, 0x3f, 0xcd, 0xfe, 0x60, 0xfb, 0xf3, 0xed, 0xcf,
+	     0xb9, 0x3f, 0xf2, 0xfe, 0xf0, 0xfb, 0xf3, 0xef, 0x0f, 0xc1,
+	     0x3f, 0x0c, 0xff, 0x4c, 0xfc, 0xe3, 0xf1, 0x0f, 0xc9, 0x3f,
+	     0x27, 0xff, 0xc4, 0xfc, 0x63, 0xf3, 0xcf, 0xce, 0x3f, 0x45,
+	     0xff, 0x2c, 0xfd, 0x73, 0xf5, 0xcf, 0xd6, 0x3f, 0x67, 0xff,
+	     0xac, 0xfd, 0x83, 0xf7, 0x4f, 0xdf, 0x3f, 0x85, 0xff, 0x38,
+	     0xfe, 0x83, 0xf9, 0x4f, 0xe8, 0x3f, 0xaa, 0xff, 0xc0, 0xfe,
+	     0xe3, 0xfb, 0xcf, 0xf2, 0x3f, 0xd9, 0xff, 0x90, 0xff, 0x13,
+	     0xff, 0xcf, 0xfd, 0x3f, 0xff, 0xff, 0x10, 0x00, 0xb4, 0x00,
+	     0x10, 0x04, 0x40, 0x12, 0x00, 0x5d, 0x00, 0x54, 0x02, 0x90,
+	     0x0c, 0x40, 0x3c, 0x00, 0x05, 0x01, 0x44, 0x04, 0x10, 0x12,
+	     0x40, 0x54, 0x00, 0x71, 0x01, 0x04, 0x06, 0xd0, 0x1a, 0x40,
+	     0x73, 0x00, 0xdd, 0x01, 0x04, 0x08, 0x90, 0x22, 0x40, 0x91,
+	     0x00, 0x65, 0x02, 0x74, 0x0a, 0x50, 0x2d, 0x40, 0xba, 0x00,
+	     0xf5, 0x02, 0xa4, 0x0c, 0x10, 0x33, 0x40, 0xda, 0x00, 0x8d,
+	     0x03, 0x74, 0x0e, 0x90, 0x3c, 0x40, 0xf5, 0x00, 0xfd, 0x03,
+	     0x94, 0x10, 0x50, 0x43, 0x40, 0x19, 0x01, 0x89, 0x04, 0xc4,
+	     0x12, 0xd0, 0x4d, 0x40, 0x45, 0x01, 0x2d, 0x05, 0x64, 0x15,
+	     0x50, 0x58, 0x40, 0x6e, 0x01, 0xe1, 0x05, 0xe4, 0x17, 0xd0,
+	     0x62, 0x40, 0x8e, 0x01, 0x59, 0x06, 0xa4, 0x19, 0x90, 0x69,
+	     0x40, 0xae, 0x01, 0xd1, 0x06, 0xd4, 0x1b, 0x50, 0x72, 0x40,
+	     0xcb, 0x01, 0x55, 0x07, 0x94, 0x1d, 0xd0, 0x78, 0x40, 0xea,
+	     0x01, 0xd1, 0x07, 0x24, 0x20, 0xd0, 0x83, 0x40, 0x1c, 0x02,
+	     0xa9, 0x08, 0x14, 0x23, 0x90, 0x8d, 0x40, 0x41, 0x02, 0x25,
+	     0x09, 0x14, 0x25, 0x50, 0x97, 0x40, 0x69, 0x02, 0xbd, 0x09,
+	     0x44, 0x27, 0x50, 0x9f, 0x40, 0x86, 0x02, 0x2d, 0x0a, 0x74,
+	     0x29, 0xd0, 0xa6, 0x40, 0xa4, 0x02, 0xb1, 0x0a, 0x74, 0x2b,
+	     0x50, 0xb0, 0x40, 0xc6, 0x02, 0x35, 0x0b, 0x44, 0x2d, 0x90,
+	     0xb8, 0x40, 0xe7, 0x02, 0xc1, 0x0b, 0x34, 0x2f, 0xd0, 0xbd,
+	     0x40, 0x02, 0x03, 0x31, 0x0c, 0x24, 0x31, 0xd0, 0xc5, 0x40,
+	     0x1b, 0x03, 0x7d, 0x0c, 0x14, 0x32, 0xd0, 0xca, 0x40, 0x35,
+	     0x03, 0x0d, 0x0d, 0xb4, 0x34, 0xd0, 0xd3, 0x40, 0x57, 0x03,
+	     0x6d, 0x0d, 0x04, 0x36, 0x10, 0xdb, 0x40, 0x6f, 0x03, 0xf5,
+	     0x0d, 0xa4, 0x38, 0x10, 0xe5, 0x40, 0x9f, 0x03, 0x95, 0x0e,
+	     0x24, 0x3b, 0xd0, 0xed, 0x40, 0xc5, 0x03, 0x3d, 0x0f, 0x94,
+	     0x3d, 0x90, 0xf8, 0x40, 0xed, 0x03, 0xed, 0x0f, 0x04, 0x40,
+	     0xd0, 0x01, 0x41, 0x0d, 0x04, 0x55, 0x10, 0x04, 0x42, 0xd0,
+	     0x0a, 0x41, 0x33, 0x04, 0xed, 0x10, 0xd4, 0x43, 0x10, 0x10,
+	     0x41, 0x49, 0x04, 0x41, 0x11, 0xe4, 0x45, 0x10, 0x1a, 0x41,
+	     0x73, 0x04, 0xf1, 0x11, 0x24, 0x48, 0x50, 0x22, 0x41, 0x96,
+	     0x04, 0x8d, 0x12, 0x14, 0x4b, 0x50, 0x2e, 0x41, 0xc7, 0x04,
+	     0x31, 0x13, 0x14, 0x4d, 0x10, 0x37, 0x41, 0xe5, 0x04, 0xcd,
+	     0x13, 0x64, 0x4f, 0x90, 0x3e, 0x41, 0x04, 0x05, 0x45, 0x14,
+	     0x84, 0x51, 0x90, 0x48, 0x41, 0x26, 0x05, 0xc5, 0x14, 0x84,
+	     0x53, 0x50, 0x51, 0x41, 0x4d, 0x05, 0x61, 0x15, 0xb4, 0x55,
+	     0x10, 0x5a, 0x41, 0x71, 0x05, 0xfd, 0x15, 0x34, 0x58, 0x90,
+	     0x62, 0x41, 0x8d, 0x05, 0x59, 0x16, 0x44, 0x5a, 0x10, 0x6b,
+	     0x41, 0xba, 0x05, 0x11, 0x17, 0x74, 0x5c, 0x10, 0x73, 0x41,
+	     0xd4, 0x05, 0x79, 0x17, 0x44, 0x5e, 0x50, 0x7a, 0x41, 0xf6,
+	     0x05, 0xfd, 0x17, 0x34, 0x60, 0xd0, 0x81, 0x41, 0x0d, 0x06,
+	     0x45, 0x18, 0x74, 0x61, 0xd0, 0x86, 0x41, 0x1f, 0x06, 0xa5,
+	     0x18, 0xf4, 0x62, 0x50, 0x8d, 0x41, 0x3d, 0x06, 0x29, 0x19,
+	     0x24, 0x65, 0x10, 0x97, 0x41, 0x63, 0x06, 0xb1, 0x19, 0x04,
+	     0x67, 0x50, 0x9e, 0x41, 0x7b, 0x06, 0x25, 0x1a, 0xd4, 0x68,
+	     0xd0, 0xa4, 0x41, 0x99, 0x06, 0x8d, 0x1a, 0xe4, 0x6a, 0x50,
+	     0xad, 0x41, 0xc1, 0x06, 0x15, 0x1b, 0xa4, 0x6c, 0x10, 0xb5,
+	     0x41, 0xdf, 0x06, 0xa9, 0x1b, 0x44, 0x6f, 0xd0, 0xbf, 0x41,
+	     0x08, 0x07, 0x4d, 0x1c, 0xc4, 0x71, 0xd0, 0xc8, 0x41, 0x31,
+	     0x07, 0xed, 0x1c, 0x14, 0x74, 0xd0, 0xd2, 0x41, 0x57, 0x07,
+	     0x79, 0x1d, 0x84, 0x76, 0x90, 0xdb, 0x41, 0x74, 0x07, 0x05,
+	     0x1e, 0xf4, 0x78, 0x50, 0xe5, 0x41, 0xa2, 0x07, 0xa9, 0x1e,
+	     0x84, 0x7b, 0x50, 0xf0, 0x41, 0xcb, 0x07, 0x65, 0x1f, 0x44,
+	     0x7e, 0xd0, 0xfa, 0x41, 0xf0, 0x07, 0xcd, 0x1f, 0xa4, 0x7f,
+	     0x50, 0x00, 0x42, 0x0d, 0x08, 0x5d, 0x20, 0xf4, 0x81, 0x10,
+	     0x09, 0x42, 0x29, 0x08, 0xc1, 0x20, 0x64, 0x83, 0x90, 0x0f,
+	     0x42, 0x4c, 0x08, 0x4d, 0x21, 0xe4, 0x85, 0x10, 0x18, 0x42,
+	     0x6a, 0x08, 0xdd, 0x21, 0x44, 0x88, 0x90, 0x22, 0x42, 0x90,
+	     0x08, 0x61, 0x22, 0x44, 0x8a, 0x90, 0x2c, 0x42, 0xbf, 0x08,
+	     0x0d, 0x23, 0xe4, 0x8c, 0x50, 0x35, 0x42, 0xda, 0x08, 0x8d,
+	     0x23, 0x84, 0x8e, 0xd0, 0x3a, 0x42, 0xef, 0x08, 0xed, 0x23,
+	     0x74, 0x90, 0x90, 0x43, 0x42, 0x19, 0x09, 0x9d, 0x24, 0x24,
+	     0x93, 0x10, 0x4e, 0x42, 0x44, 0x09, 0x29, 0x25, 0x74, 0x95,
+	     0x50, 0x58, 0x42, 0x6f, 0x09, 0xe9, 0x25, 0xc4, 0x97, 0x90,
+	     0x61, 0x42, 0x91, 0x09, 0x59, 0x26, 0xc4, 0x99, 0x50, 0x68,
+	     0x42, 0xa9, 0x09, 0xbd, 0x26, 0x34, 0x9b, 0x10, 0x6e, 0x42,
+	     0xc3, 0x09, 0x1d, 0x27, 0x24, 0x9d, 0x90, 0x76, 0x42, 0xe8,
+	     0x09, 0xb9, 0x27, 0xc4, 0x9f, 0x10, 0x81, 0x42, 0x0c, 0x0a,
+	     0x51, 0x28, 0xf4, 0xa1, 0x90, 0x89, 0x42, 0x2a, 0x0a, 0xc1,
+	     0x28, 0xb4, 0xa3, 0xd0, 0x8f, 0x42, 0x47, 0x0a, 0x49, 0x29,
+	     0x04, 0xa6, 0x10, 0x99, 0x42, 0x67, 0x0a, 0xc5, 0x29, 0x34,
+	     0xa7, 0x90, 0x9d, 0x42, 0x83, 0x0a, 0x1d, 0x2a, 0x44, 0xa9,
+	     0xd0, 0xa5, 0x42, 0xa1, 0x0a, 0x99, 0x2a, 0xe4, 0xaa, 0x90,
+	     0xac, 0x42, 0xba, 0x0a, 0xfd, 0x2a, 0x74, 0xac, 0x10, 0xb4,
+	     0x42, 0xd8, 0x0a, 0x95, 0x2b, 0x84, 0xae, 0x10, 0xbb, 0x42,
+	     0xf7, 0x0a, 0xf5, 0x2b, 0x64, 0xb0, 0x50, 0xc3, 0x42, 0x10,
+	     0x0b, 0x51, 0x2c, 0xe4, 0xb1, 0x10, 0xc9, 0x42, 0x2e, 0x0b,
+	     0xe1, 0x2c, 0xb4, 0xb3, 0xd0, 0xcf, 0x42, 0x45, 0x0b, 0x4d,
+	     0x2d, 0xf4, 0xb5, 0xd0, 0xd8, 0x42, 0x6f, 0x0b, 0xc5, 0x2d,
+	     0xe4, 0xb7, 0x50, 0xe0, 0x42, 0x8c, 0x0b, 0x49, 0x2e, 0x64,
+	     0xb9, 0x50, 0xe7, 0x42, 0xa7, 0x0b, 0xb1, 0x2e, 0x14, 0xbb,
+	     0x90, 0xef, 0x42, 0xc6, 0x0b, 0x29, 0x2f, 0x84, 0xbd, 0x10,
+	     0xf8, 0x42, 0xe3, 0x0b, 0x9d, 0x2f, 0x34, 0xbf, 0x10, 0xff,
+	     0x42, 0x00, 0x0c, 0x11, 0x30, 0xc4, 0xc0, 0xd0, 0x03, 0x43,
+	     0x19, 0x0c, 0x81, 0x30, 0xa4, 0xc2, 0x90, 0x0c, 0x43, 0x3a,
+	     0x0c, 0x21, 0x31, 0x14, 0xc5, 0x50, 0x17, 0x43, 0x60, 0x0c,
+	     0xa1, 0x31, 0x04, 0xc7, 0x90, 0x1f, 0x43, 0x85, 0x0c, 0x35,
+	     0x32, 0x84, 0xc9, 0x50, 0x28, 0x43, 0xa8, 0x0c, 0xcd, 0x32,
+	     0x54, 0xcb, 0x10, 0x30, 0x43, 0xcb, 0x0c, 0x59, 0x33, 0x24,
+	     0xce, 0x50, 0x3a, 0x43, 0xf6, 0x0c, 0xfd, 0x33, 0x84, 0xd0,
+	     0x90, 0x44, 0x43, 0x1e, 0x0d, 0x8d, 0x34, 0xf4, 0xd2, 0x10,
+	     0x4e, 0x43, 0x44, 0x0d, 0x35, 0x35, 0x54, 0xd5, 0x10, 0x57,
+	     0x43, 0x6a, 0x0d, 0xb5, 0x35, 0x24, 0xd7, 0x90, 0x5e, 0x43,
+	     0x7e, 0x0d, 0x05, 0x36, 0xd4, 0xd8, 0xd0, 0x65, 0x43, 0xa1,
+	     0x0d, 0xa9, 0x36, 0xc4, 0xda, 0x10, 0x6d, 0x43, 0xc2, 0x0d,
+	     0x21, 0x37, 0xf4, 0xdc, 0xd0, 0x76, 0x43, 0xe4, 0x0d, 0xb5,
+	     0x37, 0x84, 0xdf, 0x90, 0x80, 0x43, 0x0a, 0x0e, 0x41, 0x38,
+	     0x54, 0xe1, 0x90, 0x86, 0x43, 0x23, 0x0e, 0xb1, 0x38, 0x34,
+	     0xe3, 0xd0, 0x8e, 0x43, 0x43, 0x0e, 0x31, 0x39, 0xf4, 0xe4,
+	     0x10, 0x95, 0x43, 0x5b, 0x0e, 0x89, 0x39, 0x84, 0xe6, 0x10,
+	     0x9d, 0x43, 0x7f, 0x0e, 0x1d, 0x3a, 0x94, 0xe8, 0x10, 0xa3,
+	     0x43, 0x96, 0x0e, 0x65, 0x3a, 0xd4, 0xe9, 0x90, 0xa8, 0x43,
+	     0xae, 0x0e, 0xcd, 0x3a, 0x84, 0xeb, 0xd0, 0xae, 0x43, 0xc7,
+	     0x0e, 0x29, 0x3b, 0x34, 0xed, 0xd0, 0xb6, 0x43, 0xe1, 0x0e,
+	     0xa1, 0x3b, 0x44, 0xef, 0x90, 0xc0, 0x43, 0x0c, 0x0f, 0x61,
+	     0x3c, 0x24, 0xf2, 0x50, 0xca, 0x43, 0x32, 0x0f, 0xe5, 0x3c,
+	     0x14, 0xf4, 0x50, 0xd1, 0x43, 0x4e, 0x0f, 0x51, 0x3d, 0x84,
+	     0xf5, 0x90, 0xd8, 0x43, 0x6a, 0x0f, 0xb1, 0x3d, 0x34, 0xf7,
+	     0x90, 0xdf, 0x43, 0x81, 0x0f, 0x39, 0x3e, 0x24, 0xf9, 0xd0,
+	     0xe6, 0x43, 0xa9, 0x0f, 0xd1, 0x3e, 0x94, 0xfb, 0x90, 0xf1,
+	     0x43, 0xd2, 0x0f, 0x81, 0x3f, 0x84, 0xfe, 0x50, 0xfb, 0x43,
+	     0xf7, 0x0f, 0x15, 0x40, 0x84, 0x00, 0xd1, 0x04, 0x44, 0x1f,
+	     0x10, 0x95, 0x40, 0x84, 0x02, 0x11, 0x0b, 0x44, 0x3a, 0x10,
+	     0xf5, 0x40, 0x04, 0x04, 0x91, 0x13, 0x44, 0x54, 0x10, 0x5d,
+	     0x41, 0xe4, 0x05, 0x51, 0x19, 0x44, 0x68, 0x10, 0xd1, 0x41,
+	     0x14, 0x08, 0x91, 0x23, 0x44, 0x93, 0x10, 0x7d, 0x42, 0x44,
+	     0x0a, 0x91, 0x2c, 0x44, 0xbd, 0x10, 0x2d, 0x43, 0x64, 0x0d,
+	     0x11, 0x39, 0x44, 0xe7, 0x10, 0xb1, 0x43, 0x04, 0x0f, 0xd1,
+	     0x3c, 0x44, 0xf5, 0x10, 0xfd, 0x43, 0x24, 0x10, 0xd1, 0x41,
+	     0x44, 0x15, 0x11, 0x6d, 0x44, 0x84, 0x12, 0x91, 0x4b, 0x44,
+	     0x31, 0x11, 0xdd, 0x44, 0x34, 0x14, 0xd1, 0x51, 0x44, 0x4f,
+	     0x11, 0x59, 0x45, 0xc4, 0x15, 0x51, 0x59, 0x44, 0x6d, 0x11,
+	     0xe1, 0x45, 0x44, 0x18, 0x11, 0x62, 0x44, 0x91, 0x11, 0x6d,
+	     0x46, 0x34, 0x1a, 0x51, 0x69, 0x44, 0xab, 0x11, 0xdd, 0x46,
+	     0xa4, 0x1b, 0x91, 0x6f, 0x44, 0xc4, 0x11, 0x45, 0x47, 0xc4,
+	     0x1d, 0x51, 0x79, 0x44, 0xe9, 0x11, 0xb9, 0x47, 0x84, 0x1f,
+	     0x91, 0x80, 0x44, 0x07, 0x12, 0x41, 0x48, 0xa4, 0x21, 0x51,
+	     0x89, 0x44, 0x31, 0x12, 0xf1, 0x48, 0x34, 0x24, 0xd1, 0x91,
+	     0x44, 0x53, 0x12, 0x69, 0x49, 0xd4, 0x25, 0xd1, 0x9a, 0x44,
+	     0x72, 0x12, 0xd5, 0x49, 0x74, 0x27, 0x51, 0xa1, 0x44, 0x88,
+	     0x12, 0x4d, 0x4a, 0x14, 0x2a, 0x91, 0xab, 0x44, 0xb7, 0x12,
+	     0xfd, 0x4a, 0xd4, 0x2c, 0x51, 0xb5, 0x44, 0xdd, 0x12, 0xa1,
+	     0x4b, 0x54, 0x2f, 0x11, 0xc0, 0x44, 0x0d, 0x13, 0x49, 0x4c,
+	     0x54, 0x31, 0x11, 0xc8, 0x44, 0x2b, 0x13, 0xe1, 0x4c, 0x34,
+	     0x34, 0x51, 0xd1, 0x44, 0x4f, 0x13, 0x6d, 0x4d, 0xe4, 0x35,
+	     0x11, 0xdb, 0x44, 0x78, 0x13, 0x0d, 0x4e, 0x84, 0x38, 0x11,
+	     0xe3, 0x44, 0x96, 0x13, 0x7d, 0x4e, 0x34, 0x3a, 0x11, 0xec,
+	     0x44, 0xbb, 0x13, 0x01, 0x4f, 0xd4, 0x3c, 0x11, 0xf6, 0x44,
+	     0xe0, 0x13, 0xa9, 0x4f, 0xe4, 0x3e, 0x11, 0xff, 0x44, 0x03,
+	     0x14, 0x45, 0x50, 0xb4, 0x41, 0x51, 0x07, 0x45, 0x21, 0x14,
+	     0x95, 0x50, 0xe4, 0x42, 0x11, 0x0e, 0x45, 0x3f, 0x14, 0x21,
+	     0x51, 0x54, 0x45, 0x91, 0x18, 0x45, 0x6a, 0x14, 0xbd, 0x51,
+	     0xb4, 0x47, 0x91, 0x21, 0x45, 0x8d, 0x14, 0x51, 0x52, 0xf4,
+	     0x49, 0x51, 0x2b, 0x45, 0xb8, 0x14, 0x11, 0x53, 0xf4, 0x4c,
+	     0x51, 0x36, 0x45, 0xe4, 0x14, 0xad, 0x53, 0x14, 0x4f, 0xd1,
+	     0x3f, 0x45, 0x04, 0x15, 0x19, 0x54, 0xb4, 0x50, 0x51, 0x46,
+	     0x45, 0x26, 0x15, 0xa5, 0x54, 0x24, 0x53, 0x51, 0x4d, 0x45,
+	     0x40, 0x15, 0x0d, 0x55, 0x94, 0x54, 0x91, 0x54, 0x45, 0x60,
+	     0x15, 0xa9, 0x55, 0x74, 0x57, 0x11, 0x5f, 0x45, 0x83, 0x15,
+	     0x2d, 0x56, 0xe4, 0x58, 0x11, 0x66, 0x45, 0x9b, 0x15, 0x79,
+	     0x56, 0x74, 0x5a, 0x51, 0x6d, 0x45, 0xb9, 0x15, 0xed, 0x56,
+	     0x24, 0x5c, 0x91, 0x73, 0x45, 0xd4, 0x15, 0x81, 0x57, 0xc4,
+	     0x5e, 0x51, 0x7c, 0x45, 0xf6, 0x15, 0xed, 0x57, 0xe4, 0x5f,
+	     0xd1, 0x81, 0x45, 0x0a, 0x16, 0x59, 0x58, 0x04, 0x62, 0xd1,
+	     0x8a, 0x45, 0x34, 0x16, 0xe1, 0x58, 0x54, 0x64, 0x91, 0x93,
+	     0x45, 0x58, 0x16, 0x75, 0x59, 0x74, 0x66, 0x91, 0x9c, 0x45,
+	     0x7b, 0x16, 0x1d, 0x5a, 0xd4, 0x68, 0x51, 0xa5, 0x45, 0xa0,
+	     0x16, 0x95, 0x5a, 0x34, 0x6b, 0x51, 0xad, 0x45, 0xbf, 0x16,
+	     0x0d, 0x5b, 0x14, 0x6d, 0x51, 0xb6, 0x45, 0xdc, 0x16, 0xa5,
+	     0x5b, 0x34, 0x6f, 0x51, 0xc0, 0x45, 0x0e, 0x17, 0x61, 0x5c,
+	     0xd4, 0x71, 0xd1, 0xca, 0x45, 0x38, 0x17, 0x19, 0x5d, 0xa4,
+	     0x74, 0x91, 0xd3, 0x45, 0x52, 0x17, 0x65, 0x5d, 0x44, 0x76,
+	     0x51, 0xda, 0x45, 0x6c, 0x17, 0xd5, 0x5d, 0xf4, 0x77, 0xd1,
+	     0xe2, 0x45, 0x93, 0x17, 0x61, 0x5e, 0x54, 0x7a, 0x91, 0xeb,
+	     0x45, 0xb8, 0x17, 0xe9, 0x5e, 0xe4, 0x7b, 0x51, 0xf2, 0x45,
+	     0xd4, 0x17, 0x61, 0x5f, 0xc4, 0x7d, 0x11, 0xfa, 0x45, 0xf0,
+	     0x17, 0xcd, 0x5f, 0xf4, 0x7f, 0x51, 0x02, 0x46, 0x0d, 0x18,
+	     0x51, 0x60, 0xf4, 0x81, 0x11, 0x09, 0x46, 0x2c, 0x18, 0xe5,
+	     0x60, 0x54, 0x84, 0x51, 0x14, 0x46, 0x58, 0x18, 0x99, 0x61,
+	     0xa4, 0x86, 0xd1, 0x1c, 0x46, 0x80, 0x18, 0x21, 0x62, 0x54,
+	     0x89, 0x11, 0x28, 0x46, 0xab, 0x18, 0xc9, 0x62, 0x44, 0x8b,
+	     0x51, 0x2e, 0x46, 0xc7, 0x18, 0x45, 0x63, 0x94, 0x8d, 0x11,
+	     0x38, 0x46, 0xe8, 0x18, 0xc5, 0x63, 0xa4, 0x8f, 0x51, 0x41,
+	     0x46, 0x12, 0x19, 0x59, 0x64, 0xa4, 0x91, 0x11, 0x4a, 0x46,
+	     0x30, 0x19, 0xf1, 0x64, 0x04, 0x94, 0x11, 0x53, 0x46, 0x56,
+	     0x19, 0x8d, 0x65, 0xc4, 0x96, 0x51, 0x5d, 0x46, 0x7b, 0x19,
+	     0x01, 0x66, 0x74, 0x98, 0x11, 0x64, 0x46, 0x92, 0x19, 0x81,
+	     0x66, 0xe4, 0x9a, 0x51, 0x6c, 0x46, 0xbc, 0x19, 0x29, 0x67,
+	     0x14, 0x9d, 0x51, 0x75, 0x46, 0xe2, 0x19, 0xc1, 0x67, 0x64,
+	     0x9f, 0x51, 0x7e, 0x46, 0xfe, 0x19, 0x11, 0x68, 0x74, 0xa0,
+	     0x91, 0x84, 0x46, 0x1f, 0x1a, 0xa9, 0x68, 0x84, 0xa3, 0x11,
+	     0x90, 0x46, 0x4d, 0x1a, 0x41, 0x69, 0x94, 0xa5, 0xd1, 0x97,
+	     0x46, 0x68, 0x1a, 0xa9, 0x69, 0x64, 0xa7, 0x51, 0xa0, 0x46,
+	     0x88, 0x1a, 0x59, 0x6a, 0xe4, 0xa9, 0x51, 0xaa, 0x46, 0xb6,
+	     0x1a, 0xfd, 0x6a, 0x94, 0xac, 0xd1, 0xb3, 0x46, 0xd4, 0x1a,
+	     0x5d, 0x6b, 0xb4, 0xad, 0x91, 0xb8, 0x46, 0xe9, 0x1a, 0xc5,
+	     0x6b, 0x84, 0xaf, 0x91, 0xc0, 0x46, 0x0b, 0x1b, 0x65, 0x6c,
+	     0x54, 0xb2, 0x11, 0xcc, 0x46, 0x37, 0x1b, 0xed, 0x6c, 0x84,
+	     0xb4, 0xd1, 0xd2, 0x46, 0x4d, 0x1b, 0x61, 0x6d, 0x44, 0xb6,
+	     0x91, 0xdc, 0x46, 0x80, 0x1b, 0x11, 0x6e, 0xa4, 0xb8, 0xd1,
+	     0xe4, 0x46, 0x9c, 0x1b, 0xa9, 0x6e, 0x34, 0xbb, 0x11, 0xee,
+	     0x46, 0xc4, 0x1b, 0x21, 0x6f, 0xc4, 0xbc, 0x51, 0xf6, 0x46,
+	     0xe7, 0x1b, 0xad, 0x6f, 0x84, 0xbf, 0x91, 0xff, 0x46, 0x09,
+	     0x1c, 0x55, 0x70, 0xe4, 0xc1, 0x11, 0x0a, 0x47, 0x31, 0x1c,
+	     0xf5, 0x70, 0x94, 0xc4, 0x51, 0x15, 0x47, 0x61, 0x1c, 0x8d,
+	     0x71, 0x64, 0xc6, 0xd1, 0x1a, 0x47, 0x6f, 0x1c, 0xe1, 0x71,
+	     0x04, 0xc8, 0x51, 0x21, 0x47, 0x91, 0x1c, 0x79, 0x72, 0x14,
+	     0xca, 0x91, 0x2b, 0x47, 0xb3, 0x1c, 0xe1, 0x72, 0xf4, 0xcb,
+	     0x51, 0x32, 0x47, 0xd1, 0x1c, 0x75, 0x73, 0x24, 0xce, 0xd1,
+	     0x3b, 0x47, 0xfb, 0x1c, 0x15, 0x74, 0xb4, 0xd0, 0x51, 0x46,
+	     0x47, 0x1f, 0x1d, 0xa9, 0x74, 0x54, 0xd3, 0x11, 0x4e, 0x47,
+	     0x44, 0x1d, 0x39, 0x75, 0x04, 0xd5, 0x11, 0x55, 0x47, 0x5c,
+	     0x1d, 0x85, 0x75, 0x74, 0xd6, 0xd1, 0x5b, 0x47, 0x7a, 0x1d,
+	     0x0d, 0x76, 0x94, 0xd8, 0x51, 0x65, 0x47, 0xa0, 0x1d, 0xa1,
+	     0x76, 0xb4, 0xda, 0xd1, 0x6c, 0x47, 0xb7, 0x1d, 0xe9, 0x76,
+	     0x74, 0xdc, 0x11, 0x75, 0x47, 0xe1, 0x1d, 0xbd, 0x77, 0x44,
+	     0xdf, 0x91, 0x7f, 0x47, 0x08, 0x1e, 0x55, 0x78, 0xd4, 0xe1,
+	     0x91, 0x88, 0x47, 0x2b, 0x1e, 0xb9, 0x78, 0xa4, 0xe3, 0xd1,
+	     0x8f, 0x47, 0x44, 0x1e, 0x1d, 0x79, 0x24, 0xe5, 0x11, 0x95,
+	     0x47, 0x5f, 0x1e, 0xad, 0x79, 0x84, 0xe7, 0x51, 0xa0, 0x47,
+	     0x85, 0x1e, 0x49, 0x7a, 0xf4, 0xe9, 0x51, 0xab, 0x47, 0xb1,
+	     0x1e, 0xf5, 0x7a, 0x54, 0xec, 0x51, 0xb4, 0x47, 0xdf, 0x1e,
+	     0xb1, 0x7b, 0x54, 0xef, 0x11, 0xbf, 0x47, 0x04, 0x1f, 0x41,
+	     0x7c, 0xb4, 0xf1, 0x11, 0xc9, 0x47, 0x28, 0x1f, 0xd5, 0x7c,
+	     0x04, 0xf4, 0xd1, 0xd1, 0x47, 0x55, 0x1f, 0x5d, 0x7d, 0xf4,
+	     0xf5, 0xd1, 0xd9, 0x47, 0x71, 0x1f, 0xed, 0x7d, 0x54, 0xf8,
+	     0xd1, 0xe4, 0x47, 0x9c, 0x1f, 0xa1, 0x7e, 0x54, 0xfb, 0x51,
+	     0xee, 0x47, 0xc4, 0x1f, 0x25, 0x7f, 0xc4, 0xfc, 0x51, 0xf4,
+	     0x47, 0xd4, 0x1f, 0x89, 0x7f, 0x84, 0xfe, 0x91, 0xfb, 0x47,
+	     0xfb, 0x1f, 0x09, 0x80, 0xb4, 0x00, 0x12, 0x05, 0x48, 0x22,
+	     0x20, 0xb9, 0x80, 0x44, 0x03, 0x92, 0x0f, 0x48, 0x42, 0x20,
+	     0x11, 0x81, 0x14, 0x05, 0x12, 0x15, 0x48, 0x57, 0x20, 0x89,
+	     0x81, 0xe4, 0x06, 0x92, 0x1e, 0x48, 0x80, 0x20, 0x0d, 0x82,
+	     0xf4, 0x08, 0x92, 0x24, 0x48, 0x98, 0x20, 0x79, 0x82, 0xa4,
+	     0x0a, 0x52, 0x2c, 0x48, 0xb5, 0x20, 0x09, 0x83, 0xe4, 0x0c,
+	     0xd2, 0x36, 0x48, 0xe4, 0x20, 0xa9, 0x83, 0x84, 0x0f, 0xd2,
+	     0x40, 0x48, 0x10, 0x21, 0x69, 0x84, 0x04, 0x12, 0x52, 0x4b,
+	     0x48, 0x2f, 0x21, 0xd1, 0x84, 0x94, 0x13, 0x92, 0x4f, 0x48,
+	     0x48, 0x21, 0x39, 0x85, 0x44, 0x15, 0x12, 0x58, 0x48, 0x6a,
+	     0x21, 0xd1, 0x85, 0x14, 0x18, 0x92, 0x63, 0x48, 0x9c, 0x21,
+	     0x91, 0x86, 0xf4, 0x1a, 0x92, 0x6d, 0x48, 0xbf, 0x21, 0x15,
+	     0x87, 0x14, 0x1d, 0x12, 0x76, 0x48, 0xe4, 0x21, 0x9d, 0x87,
+	     0x44, 0x1f, 0x92, 0x7f, 0x48, 0x09, 0x22, 0x51, 0x88, 0xa4,
+	     0x21, 0x12, 0x89, 0x48, 0x2b, 0x22, 0xd9, 0x88, 0xf4, 0x23,
+	     0x92, 0x91, 0x48, 0x4e, 0x22, 0x51, 0x89, 0x64, 0x25, 0x92,
+	     0x96, 0x48, 0x5f, 0x22, 0x99, 0x89, 0x14, 0x27, 0x92, 0x9f,
+	     0x48, 0x86, 0x22, 0x51, 0x8a, 0xb4, 0x29, 0x52, 0xa8, 0x48,
+	     0xa8, 0x22, 0xb5, 0x8a, 0xb4, 0x2b, 0x92, 0xaf, 0x48, 0xcb,
+	     0x22, 0x39, 0x8b, 0xc4, 0x2d, 0x52, 0xba, 0x48, 0xf0, 0x22,
+	     0xe1, 0x8b, 0xe4, 0x2f, 0x52, 0xc0, 0x48, 0x0d, 0x23, 0x45,
+	     0x8c, 0xc4, 0x31, 0x52, 0xca, 0x48, 0x30, 0x23, 0xc9, 0x8c,
+	     0x54, 0x33, 0x52, 0xcf, 0x48, 0x44, 0x23, 0x2d, 0x8d, 0x64,
+	     0x35, 0x12, 0xd8, 0x48, 0x69, 0x23, 0xc9, 0x8d, 0x84, 0x37,
+	     0x52, 0xdf, 0x48, 0x86, 0x23, 0x35, 0x8e, 0xa4, 0x39, 0x12,
+	     0xe9, 0x48, 0xa7, 0x23, 0xb5, 0x8e, 0x34, 0x3b, 0x92, 0xed,
+	     0x48, 0xbe, 0x23, 0x15, 0x8f, 0xb4, 0x3c, 0xd2, 0xf5, 0x48,
+	     0xdf, 0x23, 0x9d, 0x8f, 0xc4, 0x3e, 0x12, 0xfe, 0x48, 0x05,
+	     0x24, 0x2d, 0x90, 0x04, 0x41, 0x12, 0x06, 0x49, 0x1e, 0x24,
+	     0xa1, 0x90, 0x14, 0x43, 0x52, 0x0d, 0x49, 0x3d, 0x24, 0x2d,
+	     0x91, 0x24, 0x45, 0x12, 0x18, 0x49, 0x66, 0x24, 0xa1, 0x91,
+	     0xb4, 0x46, 0x52, 0x1d, 0x49, 0x7d, 0x24, 0x29, 0x92, 0xe4,
+	     0x48, 0x12, 0x27, 0x49, 0xa2, 0x24, 0xc1, 0x92, 0xe4, 0x4b,
+	     0xd2, 0x31, 0x49, 0xce, 0x24, 0x6d, 0x93, 0x34, 0x4e, 0xd2,
+	     0x3a, 0x49, 0xf2, 0x24, 0x01, 0x94, 0x44, 0x50, 0x52, 0x44,
+	     0x49, 0x18, 0x25, 0x8d, 0x94, 0x04, 0x53, 0x92, 0x4e, 0x49,
+	     0x48, 0x25, 0x39, 0x95, 0x74, 0x55, 0xd2, 0x56, 0x49, 0x65,
+	     0x25, 0xb1, 0x95, 0xf4, 0x56, 0xd2, 0x5c, 0x49, 0x78, 0x25,
+	     0xe9, 0x95, 0xe4, 0x57, 0xd2, 0x60, 0x49, 0x90, 0x25, 0x69,
+	     0x96, 0xf4, 0x59, 0x92, 0x68, 0x49, 0xab, 0x25, 0xd1, 0x96,
+	     0xf4, 0x5b, 0x12, 0x72, 0x49, 0xd0, 0x25, 0x6d, 0x97, 0x64,
+	     0x5e, 0x52, 0x7b, 0x49, 0xf4, 0x25, 0x09, 0x98, 0xb4, 0x60,
+	     0x52, 0x86, 0x49, 0x1d, 0x26, 0xa1, 0x98, 0xe4, 0x62, 0x52,
+	     0x8e, 0x49, 0x42, 0x26, 0x21, 0x99, 0xe4, 0x64, 0x12, 0x94,
+	     0x49, 0x55, 0x26, 0x89, 0x99, 0xa4, 0x66, 0xd2, 0x9d, 0x49,
+	     0x84, 0x26, 0x35, 0x9a, 0x34, 0x69, 0x12, 0xa8, 0x49, 0xa9,
+	     0x26, 0xcd, 0x9a, 0x64, 0x6b, 0x52, 0xae, 0x49, 0xbf, 0x26,
+	     0x31, 0x9b, 0x14, 0x6d, 0x92, 0xb5, 0x49, 0xdc, 0x26, 0x89,
+	     0x9b, 0x04, 0x6f, 0x12, 0xbd, 0x49, 0xfa, 0x26, 0x21, 0x9c,
+	     0xb4, 0x70, 0xd2, 0xc3, 0x49, 0x18, 0x27, 0x89, 0x9c, 0x64,
+	     0x72, 0xd2, 0xcc, 0x49, 0x35, 0x27, 0xf5, 0x9c, 0x74, 0x74,
+	     0x12, 0xd4, 0x49, 0x5d, 0x27, 0x9d, 0x9d, 0x24, 0x77, 0x12,
+	     0xde, 0x49, 0x7f, 0x27, 0x15, 0x9e, 0xb4, 0x78, 0x92, 0xe5,
+	     0x49, 0xa4, 0x27, 0xa1, 0x9e, 0x34, 0x7b, 0x12, 0xee, 0x49,
+	     0xc6, 0x27, 0x41, 0x9f, 0x44, 0x7d, 0xd2, 0xf7, 0x49, 0xe2,
+	     0x27, 0xb9, 0x9f, 0x84, 0x7f, 0x52, 0xff, 0x49, 0x05, 0x28,
+	     0x3d, 0xa0, 0x64, 0x81, 0x12, 0x07, 0x4a, 0x21, 0x28, 0x8d,
+	     0xa0, 0xd4, 0x82, 0x12, 0x0e, 0x4a, 0x3b, 0x28, 0x15, 0xa1,
+	     0x94, 0x84, 0x52, 0x15, 0x4a, 0x5a, 0x28, 0x79, 0xa1, 0x74,
+	     0x86, 0x12, 0x1b, 0x4a, 0x78, 0x28, 0xf9, 0xa1, 0x54, 0x88,
+	     0x52, 0x23, 0x4a, 0x94, 0x28, 0x7d, 0xa2, 0x54, 0x8a, 0x12,
+	     0x2b, 0x4a, 0xb6, 0x28, 0xfd, 0xa2, 0xa4, 0x8c, 0x92, 0x34,
+	     0x4a, 0xd8, 0x28, 0x89, 0xa3, 0x64, 0x8e, 0x92, 0x3a, 0x4a,
+	     0xee, 0x28, 0xc5, 0xa3, 0x74, 0x8f, 0xd2, 0x3e, 0x4a, 0x00,
+	     0x29, 0x39, 0xa4, 0x04, 0x91, 0x52, 0x46, 0x4a, 0x24, 0x29,
+	     0xc9, 0xa4, 0x54, 0x93, 0x92, 0x4f, 0x4a, 0x4a, 0x29, 0x41,
+	     0xa5, 0xb4, 0x95, 0xd2, 0x58, 0x4a, 0x71, 0x29, 0xf1, 0xa5,
+	     0x74, 0x98, 0x12, 0x63, 0x4a, 0x99, 0x29, 0x91, 0xa6, 0xf4,
+	     0x9a, 0x52, 0x6f, 0x4a, 0xcb, 0x29, 0x4d, 0xa7, 0x84, 0x9d,
+	     0x92, 0x77, 0x4a, 0xe1, 0x29, 0x9d, 0xa7, 0xd4, 0x9e, 0x12,
+	     0x7e, 0x4a, 0x01, 0x2a, 0x29, 0xa8, 0x34, 0xa1, 0xd2, 0x86,
+	     0x4a, 0x20, 0x2a, 0xa1, 0xa8, 0x64, 0xa3, 0x92, 0x8f, 0x4a,
+	     0x45, 0x2a, 0x21, 0xa9, 0x44, 0xa5, 0x12, 0x96, 0x4a, 0x5d,
+	     0x2a, 0x8d, 0xa9, 0x74, 0xa6, 0x12, 0x9c, 0x4a, 0x7b, 0x2a,
+	     0x09, 0xaa, 0xe4, 0xa8, 0x92, 0xa5, 0x4a, 0xa4, 0x2a, 0xb5,
+	     0xaa, 0x34, 0xab, 0x52, 0xad, 0x4a, 0xba, 0x2a, 0xfd, 0xaa,
+	     0xc4, 0xac, 0x92, 0xb4, 0x4a, 0xdd, 0x2a, 0xad, 0xab, 0xe4,
+	     0xae, 0x92, 0xbe, 0x4a, 0x08, 0x2b, 0x35, 0xac, 0x34, 0xb1,
+	     0x92, 0xc7, 0x4a, 0x2b, 0x2b, 0xdd, 0xac, 0xc4, 0xb3, 0x12,
+	     0xd2, 0x4a, 0x50, 0x2b, 0x75, 0xad, 0x94, 0xb6, 0x92, 0xdd,
+	     0x4a, 0x81, 0x2b, 0x2d, 0xae, 0x44, 0xb9, 0x92, 0xe8, 0x4a,
+	     0xa8, 0x2b, 0xb5, 0xae, 0xa4, 0xbb, 0x92, 0xf1, 0x4a, 0xd3,
+	     0x2b, 0x59, 0xaf, 0xd4, 0xbd, 0x12, 0xfa, 0x4a, 0xf1, 0x2b,
+	     0xcd, 0xaf, 0xf4, 0xbf, 0xd2, 0x00, 0x4b, 0x08, 0x2c, 0x2d,
+	     0xb0, 0x74, 0xc1, 0x12, 0x09, 0x4b, 0x31, 0x2c, 0xf1, 0xb0,
+	     0x24, 0xc4, 0xd2, 0x11, 0x4b, 0x4f, 0x2c, 0x6d, 0xb1, 0x34,
+	     0xc6, 0x92, 0x1a, 0x4b, 0x76, 0x2c, 0x09, 0xb2, 0xe4, 0xc8,
+	     0x12, 0x26, 0x4b, 0xa4, 0x2c, 0xb9, 0xb2, 0xc4, 0xcb, 0x92,
+	     0x30, 0x4b, 0xc9, 0x2c, 0x59, 0xb3, 0x94, 0xcd, 0xd2, 0x37,
+	     0x4b, 0xe2, 0x2c, 0x99, 0xb3, 0xa4, 0xce, 0x92, 0x3c, 0x4b,
+	     0xf9, 0x2c, 0xf5, 0xb3, 0x04, 0xd0, 0xd2, 0x42, 0x4b, 0x18,
+	     0x2d, 0x81, 0xb4, 0xd4, 0xd2, 0x12, 0x4c, 0x4b, 0x37, 0x2d,
+	     0xf5, 0xb4, 0x44, 0xd4, 0x52, 0x54, 0x4b, 0x58, 0x2d, 0x91,
+	     0xb5, 0x74, 0xd6, 0x52, 0x5d, 0x4b, 0x7b, 0x2d, 0x0d, 0xb6,
+	     0x74, 0xd8, 0x52, 0x63, 0x4b, 0x96, 0x2d, 0x81, 0xb6, 0x84,
+	     0xda, 0x92, 0x6d, 0x4b, 0xc1, 0x2d, 0x39, 0xb7, 0x34, 0xdd,
+	     0xd2, 0x76, 0x4b, 0xe8, 0x2d, 0xcd, 0xb7, 0xc4, 0xdf, 0x52,
+	     0x80, 0x4b, 0x09, 0x2e, 0x45, 0xb8, 0x94, 0xe1, 0x12, 0x88,
+	     0x4b, 0x2b, 0x2e, 0xd9, 0xb8, 0xa4, 0xe3, 0xd2, 0x90, 0x4b,
+	     0x45, 0x2e, 0x39, 0xb9, 0x14, 0xe5, 0x92, 0x95, 0x4b, 0x63,
+	     0x2e, 0xb1, 0xb9, 0x84, 0xe7, 0xd2, 0x9f, 0x4b, 0x83, 0x2e,
+	     0x39, 0xba, 0x74, 0xe9, 0x92, 0xa8, 0x4b, 0xa5, 0x2e, 0xb9,
+	     0xba, 0x44, 0xeb, 0x52, 0xb0, 0x4b, 0xcd, 0x2e, 0x49, 0xbb,
+	     0x74, 0xed, 0x92, 0xb8, 0x4b, 0xef, 0x2e, 0xe5, 0xbb, 0x54,
+	     0xf0, 0xd2, 0xc1, 0x4b, 0x0a, 0x2f, 0x55, 0xbc, 0x24, 0xf2,
+	     0x92, 0xc9, 0x4b, 0x2c, 0x2f, 0xbd, 0xbc, 0x54, 0xf3, 0x92,
+	     0xce, 0x4b, 0x48, 0x2f, 0x2d, 0xbd, 0x14, 0xf5, 0x12, 0xd5,
+	     0x4b, 0x58, 0x2f, 0x85, 0xbd, 0xd4, 0xf6, 0x92, 0xdd, 0x4b,
+	     0x7b, 0x2f, 0x11, 0xbe, 0x04, 0xf9, 0x52, 0xe6, 0x4b, 0xa3,
+	     0x2f, 0xad, 0xbe, 0x04, 0xfb, 0xd2, 0xed, 0x4b, 0xc0, 0x2f,
+	     0x29, 0xbf, 0x24, 0xfd, 0xd2, 0xf6, 0x4b, 0xde, 0x2f, 0x95,
+	     0xbf, 0x14, 0xff, 0x12, 0xfd, 0x4b, 0xfe, 0x2f, 0x29, 0xc0,
+	     0x44, 0x01, 0x93, 0x05, 0x4c, 0x1e, 0x30, 0x85, 0xc0, 0xa4,
+	     0x02, 0xd3, 0x0d, 0x4c, 0x40, 0x30, 0x39, 0xc1, 0x24, 0x05,
+	     0x93, 0x17, 0x4c, 0x68, 0x30, 0xb5, 0xc1, 0x64, 0x07, 0xd3,
+	     0x1f, 0x4c, 0x8b, 0x30, 0x5d, 0xc2, 0xc4, 0x09, 0x13, 0x2a,
+	     0x4c, 0xac, 0x30, 0xe9, 0xc2, 0x04, 0x0c, 0xd3, 0x32, 0x4c,
+	     0xd8, 0x30, 0x91, 0xc3, 0xa4, 0x0e, 0xd3, 0x3c, 0x4c, 0xfc,
+	     0x30, 0x1d, 0xc4, 0x34, 0x11, 0x13, 0x46, 0x4c, 0x21, 0x31,
+	     0xb9, 0xc4, 0x14, 0x13, 0x53, 0x4f, 0x4c, 0x4b, 0x31, 0x39,
+	     0xc5, 0xb4, 0x15, 0x93, 0x57, 0x4c, 0x63, 0x31, 0x95, 0xc5,
+	     0xa4, 0x16, 0x53, 0x5c, 0x4c, 0x7b, 0x31, 0x25, 0xc6, 0x54,
+	     0x19, 0x93, 0x67, 0x4c, 0xa9, 0x31, 0xc9, 0xc6, 0xc4, 0x1b,
+	     0x53, 0x71, 0x4c, 0xc9, 0x31, 0x49, 0xc7, 0x64, 0x1d, 0x53,
+	     0x76, 0x4c, 0xe2, 0x31, 0xb9, 0xc7, 0x14, 0x1f, 0xd3, 0x7f,
+	     0x4c, 0x07, 0x32, 0x45, 0xc8, 0x74, 0x21, 0x13, 0x89, 0x4c,
+	     0x2d, 0x32, 0xc1, 0xc8, 0x54, 0x23, 0x93, 0x90, 0x4c, 0x47,
+	     0x32, 0x35, 0xc9, 0x14, 0x25, 0xd3, 0x94, 0x4c, 0x56, 0x32,
+	     0x71, 0xc9, 0x14, 0x26, 0x13, 0x99, 0x4c, 0x6f, 0x32, 0xc9,
+	     0xc9, 0xb4, 0x27, 0x53, 0xa1, 0x4c, 0x89, 0x32, 0x35, 0xca,
+	     0x34, 0x29, 0xd3, 0xa5, 0x4c, 0xa3, 0x32, 0xad, 0xca, 0x54,
+	     0x2b, 0x13, 0xaf, 0x4c, 0xc2, 0x32, 0x29, 0xcb, 0x04, 0x2d,
+	     0x53, 0xb6, 0x4c, 0xdc, 0x32, 0xa1, 0xcb, 0x14, 0x2f, 0xd3,
+	     0xbe, 0x4c, 0xfd, 0x32, 0x21, 0xcc, 0xd4, 0x30, 0xd3, 0xc6,
+	     0x4c, 0x23, 0x33, 0xb5, 0xcc, 0x84, 0x33, 0x93, 0xd1, 0x4c,
+	     0x4a, 0x33, 0x55, 0xcd, 0xd4, 0x35, 0x53, 0xda, 0x4c, 0x76,
+	     0x33, 0x05, 0xce, 0x94, 0x38, 0x13, 0xe3, 0x4c, 0x95, 0x33,
+	     0x89, 0xce, 0x64, 0x3a, 0xd3, 0xeb, 0x4c, 0xb2, 0x33, 0xd5,
+	     0xce, 0x34, 0x3c, 0x53, 0xf3, 0x4c, 0xd3, 0x33, 0x5d, 0xcf,
+	     0xe4, 0x3d, 0x13, 0xf8, 0x4c, 0xe7, 0x33, 0xd1, 0xcf, 0x14,
+	     0x40, 0xd3, 0x02, 0x4d, 0x0e, 0x34, 0x71, 0xd0, 0x84, 0x42,
+	     0x93, 0x0c, 0x4d, 0x3c, 0x34, 0x19, 0xd1, 0xb4, 0x44, 0x53,
+	     0x16, 0x4d, 0x66, 0x34, 0xbd, 0xd1, 0x94, 0x47, 0x13, 0x21,
+	     0x4d, 0x90, 0x34, 0x75, 0xd2, 0x14, 0x4a, 0x53, 0x29, 0x4d,
+	     0xaa, 0x34, 0xd5, 0xd2, 0x84, 0x4b, 0x93, 0x30, 0x4d, 0xcc,
+	     0x34, 0x49, 0xd3, 0x84, 0x4d, 0x13, 0x39, 0x4d, 0xf1, 0x34,
+	     0xed, 0xd3, 0x14, 0x50, 0x13, 0x41, 0x4d, 0x0d, 0x35, 0x5d,
+	     0xd4, 0x24, 0x52, 0x93, 0x4b, 0x4d, 0x3a, 0x35, 0x01, 0xd5,
+	     0xd4, 0x54, 0x53, 0x54, 0x4d, 0x5e, 0x35, 0x89, 0xd5, 0xd4,
+	     0x56, 0xd3, 0x5e, 0x4d, 0x84, 0x35, 0x1d, 0xd6, 0x94, 0x58,
+	     0x93, 0x64, 0x4d, 0x9e, 0x35, 0x9d, 0xd6, 0x44, 0x5b, 0x93,
+	     0x70, 0x4d, 0xcc, 0x35, 0x61, 0xd7, 0x44, 0x5e, 0x53, 0x7a,
+	     0x4d, 0xec, 0x35, 0xe9, 0xd7, 0x54, 0x60, 0x13, 0x84, 0x4d,
+	     0x17, 0x36, 0x7d, 0xd8, 0xb4, 0x62, 0xd3, 0x8c, 0x4d, 0x3c,
+	     0x36, 0x11, 0xd9, 0x94, 0x64, 0x93, 0x95, 0x4d, 0x63, 0x36,
+	     0xa9, 0xd9, 0xd4, 0x66, 0x93, 0x9e, 0x4d, 0x86, 0x36, 0x35,
+	     0xda, 0x64, 0x69, 0x93, 0xa6, 0x4d, 0xa8, 0x36, 0xa9, 0xda,
+	     0xd4, 0x6a, 0x13, 0xac, 0x4d, 0xbc, 0x36, 0x01, 0xdb, 0x84,
+	     0x6c, 0x93, 0xb3, 0x4d, 0xda, 0x36, 0x75, 0xdb, 0xa4, 0x6e,
+	     0x93, 0xbc, 0x4d, 0xfc, 0x36, 0x1d, 0xdc, 0xf4, 0x70, 0x93,
+	     0xc5, 0x4d, 0x1b, 0x37, 0x81, 0xdc, 0x34, 0x72, 0xd3, 0xcb,
+	     0x4d, 0x3d, 0x37, 0x01, 0xdd, 0xd4, 0x74, 0xd3, 0xd4, 0x4d,
+	     0x5f, 0x37, 0x9d, 0xdd, 0x44, 0x77, 0x53, 0xdf, 0x4d, 0x86,
+	     0x37, 0x41, 0xde, 0xe4, 0x79, 0xd3, 0xe8, 0x4d, 0xaa, 0x37,
+	     0xe1, 0xde, 0x64, 0x7c, 0x53, 0xf3, 0x4d, 0xd8, 0x37, 0x85,
+	     0xdf, 0x54, 0x7e, 0x13, 0xfc, 0x4d, 0xf2, 0x37, 0xdd, 0xdf,
+	     0xa4, 0x7f, 0x13, 0x02, 0x4e, 0x0e, 0x38, 0x71, 0xe0, 0x84,
+	     0x82, 0x53, 0x0c, 0x4e, 0x3e, 0x38, 0x29, 0xe1, 0xd4, 0x84,
+	     0x53, 0x16, 0x4e, 0x5e, 0x38, 0x91, 0xe1, 0x24, 0x87, 0x93,
+	     0x1d, 0x4e, 0x7c, 0x38, 0x25, 0xe2, 0x54, 0x89, 0x53, 0x28,
+	     0x4e, 0xaf, 0x38, 0xf5, 0xe2, 0x74, 0x8c, 0x53, 0x32, 0x4e,
+	     0xd5, 0x38, 0x8d, 0xe3, 0x84, 0x8e, 0x93, 0x3d, 0x4e, 0x04,
+	     0x39, 0x45, 0xe4, 0xc4, 0x91, 0x53, 0x48, 0x4e, 0x2e, 0x39,
+	     0xe5, 0xe4, 0x34, 0x94, 0x53, 0x54, 0x4e, 0x55, 0x39, 0x89,
+	     0xe5, 0xc4, 0x96, 0x13, 0x5c, 0x4e, 0x77, 0x39, 0xf9, 0xe5,
+	     0x94, 0x98, 0x53, 0x64, 0x4e, 0x9c, 0x39, 0x7d, 0xe6, 0xd4,
+	     0x9a, 0x53, 0x6c, 0x4e, 0xba, 0x39, 0x1d, 0xe7, 0xe4, 0x9c,
+	     0x13, 0x74, 0x4e, 0xda, 0x39, 0xa1, 0xe7, 0xc4, 0x9e, 0x53,
+	     0x7d, 0x4e, 0xfb, 0x39, 0x15, 0xe8, 0xd4, 0xa0, 0xd3, 0x85,
+	     0x4e, 0x22, 0x3a, 0xa9, 0xe8, 0x54, 0xa3, 0x93, 0x90, 0x4e,
+	     0x4a, 0x3a, 0x51, 0xe9, 0x14, 0xa6, 0x53, 0x9a, 0x4e, 0x6f,
+	     0x3a, 0xe1, 0xe9, 0x44, 0xa8, 0x93, 0xa4, 0x4e, 0x9f, 0x3a,
+	     0xa5, 0xea, 0x04, 0xab, 0xd3, 0xae, 0x4e, 0xc0, 0x3a, 0x35,
+	     0xeb, 0xf4, 0xac, 0x93, 0xb5, 0x4e, 0xda, 0x3a, 0x75, 0xeb,
+	     0x44, 0xae, 0x53, 0xbb, 0x4e, 0xf1, 0x3a, 0xe5, 0xeb, 0x64,
+	     0xb0, 0x93, 0xc3, 0x4e, 0x1b, 0x3b, 0x95, 0xec, 0x04, 0xb3,
+	     0x13, 0xcd, 0x4e, 0x42, 0x3b, 0x41, 0xed, 0xd4, 0xb5, 0x53,
+	     0xd9, 0x4e, 0x69, 0x3b, 0xc5, 0xed, 0x64, 0xb7, 0x13, 0xe1,
+	     0x4e, 0x8a, 0x3b, 0x39, 0xee, 0x84, 0xb9, 0x93, 0xe7, 0x4e,
+	     0xa6, 0x3b, 0xcd, 0xee, 0xf4, 0xbb, 0x53, 0xf0, 0x4e, 0xca,
+	     0x3b, 0x49, 0xef, 0x04, 0xbe, 0xd3, 0xf9, 0x4e, 0xea, 0x3b,
+	     0xd1, 0xef, 0x24, 0xc0, 0x93, 0x01, 0x4f, 0x0f, 0x3c, 0x55,
+	     0xf0, 0xf4, 0xc1, 0x13, 0x0a, 0x4f, 0x2c, 0x3c, 0xe1, 0xf0,
+	     0x14, 0xc4, 0x93, 0x13, 0x4f, 0x53, 0x3c, 0x59, 0xf1, 0xd4,
+	     0xc5, 0xd3, 0x19, 0x4f, 0x70, 0x3c, 0xdd, 0xf1, 0x04, 0xc8,
+	     0x53, 0x23, 0x4f, 0x95, 0x3c, 0x5d, 0xf2, 0x24, 0xca, 0x53,
+	     0x29, 0x4f, 0xa9, 0x3c, 0xc9, 0xf2, 0x94, 0xcb, 0x53, 0x31,
+	     0x4f, 0xcf, 0x3c, 0x49, 0xf3, 0xd4, 0xcd, 0x13, 0x39, 0x4f,
+	     0xec, 0x3c, 0xbd, 0xf3, 0xa4, 0xcf, 0x93, 0x40, 0x4f, 0x0a,
+	     0x3d, 0x61, 0xf4, 0xd4, 0xd1, 0x93, 0x49, 0x4f, 0x33, 0x3d,
+	     0x01, 0xf5, 0xa4, 0xd4, 0xd3, 0x54, 0x4f, 0x5b, 0x3d, 0x91,
+	     0xf5, 0xb4, 0xd6, 0x53, 0x5d, 0x4f, 0x7f, 0x3d, 0x09, 0xf6,
+	     0xd4, 0xd8, 0x53, 0x64, 0x4f, 0x9e, 0x3d, 0x95, 0xf6, 0x94,
+	     0xda, 0x53, 0x6b, 0x4f, 0xbb, 0x3d, 0x15, 0xf7, 0xb4, 0xdc,
+	     0xd3, 0x73, 0x4f, 0xd3, 0x3d, 0x6d, 0xf7, 0x14, 0xde, 0x93,
+	     0x7a, 0x4f, 0xf2, 0x3d, 0xe9, 0xf7, 0x84, 0xe0, 0x93, 0x83,
+	     0x4f, 0x19, 0x3e, 0x99, 0xf8, 0x94, 0xe2, 0xd3, 0x8c, 0x4f,
+	     0x3e, 0x3e, 0x01, 0xf9, 0x84, 0xe4, 0xd3, 0x92, 0x4f, 0x56,
+	     0x3e, 0x91, 0xf9, 0xa4, 0xe6, 0x13, 0x9c, 0x4f, 0x79, 0x3e,
+	     0xf9, 0xf9, 0xc4, 0xe8, 0x13, 0xa5, 0x4f, 0xa0, 0x3e, 0xb9,
+	     0xfa, 0x74, 0xeb, 0xd3, 0xae, 0x4f, 0xc0, 0x3e, 0x15, 0xfb,
+	     0xc4, 0xec, 0x93, 0xb5, 0x4f, 0xe3, 0x3e, 0xa1, 0xfb, 0xb4,
+	     0xee, 0x13, 0xbc, 0x4f, 0xfb, 0x3e, 0x05, 0xfc, 0xe4, 0xf0,
+	     0x13, 0xc4, 0x4f, 0x17, 0x3f, 0x71, 0xfc, 0xf4, 0xf1, 0xd3,
+	     0xc9, 0x4f, 0x33, 0x3f, 0x01, 0xfd, 0xc4, 0xf4, 0x93, 0xd4,
+	     0x4f, 0x5f, 0x3f, 0xb5, 0xfd, 0x34, 0xf7, 0x13, 0xe0, 0x4f,
+	     0x8e, 0x3f, 0x59, 0xfe, 0xe4, 0xf9, 0x13, 0xe9, 0x4f, 0xb1,
+	     0x3f, 0xd9, 0xfe, 0x14, 0xfc, 0x53, 0xf1, 0x4f, 0xc9, 0x3f,
+	     0x59, 0xff, 0x14, 0xfe, 0xd3, 0xf9, 0x4f, 0xed, 0x3f, 0xe5,
+	     0xff, 0x74, 0x00, 0x54, 0x05, 0x50, 0x17, 0x40, 0x79, 0x00,
+	     0xb5, 0x02, 0x54, 0x0d, 0x50, 0x3e, 0x40, 0x11, 0x01, 0x75,
+	     0x04, 0x54, 0x13, 0x50, 0x58, 0x40, 0x71, 0x01, 0x65, 0x06,
+	     0x54, 0x1b, 0x50, 0x78, 0x40, 0x15, 0x02, 0xa5, 0x08, 0x54,
+	     0x23, 0x50, 0x92, 0x40, 0x65, 0x02, 0x65, 0x0a, 0x14, 0x2c,
+	     0x50, 0xb5, 0x40, 0xe1, 0x02, 0xf5, 0x0b, 0xd4, 0x32, 0x50,
+	     0xd2, 0x40, 0x71, 0x03, 0x45, 0x0e, 0x94, 0x3a, 0x50, 0xf8,
+	     0x40, 0xf5, 0x03, 0xa5, 0x10, 0x94, 0x45, 0x50, 0x24, 0x41,
+	     0x99, 0x04, 0xb5, 0x12, 0x54, 0x4e, 0x50, 0x3f, 0x41, 0x31,
+	     0x05, 0x15, 0x15, 0x54, 0x55, 0x50, 0x62, 0x41, 0x95, 0x05,
+	     0x95, 0x16, 0x14, 0x5d, 0x50, 0x7a, 0x41, 0x09, 0x06, 0xa5,
+	     0x18, 0x94, 0x63, 0x50, 0x96, 0x41, 0x71, 0x06, 0x95, 0x1a,
+	     0xd4, 0x6c, 0x50, 0xb9, 0x41, 0x09, 0x07, 0x55, 0x1c, 0x14,
+	     0x73, 0x50, 0xda, 0x41, 0x89, 0x07, 0x45, 0x1e, 0x14, 0x7b,
+	     0x50, 0xf1, 0x41, 0xf1, 0x07, 0x75, 0x20, 0x94, 0x84, 0x50,
+	     0x15, 0x42, 0x69, 0x08, 0xf5, 0x21, 0x14, 0x8b, 0x50, 0x2f,
+	     0x42, 0xcd, 0x08, 0x65, 0x23, 0x14, 0x90, 0x50, 0x4c, 0x42,
+	     0x41, 0x09, 0xb5, 0x25, 0xd4, 0x99, 0x50, 0x6c, 0x42, 0xc5,
+	     0x09, 0xe5, 0x27, 0xd4, 0xa2, 0x50, 0x99, 0x42, 0x71, 0x0a,
+	     0x15, 0x2a, 0x54, 0xa9, 0x50, 0xb2, 0x42, 0xfd, 0x0a, 0x45,
+	     0x2c, 0x94, 0xb4, 0x50, 0xd6, 0x42, 0x89, 0x0b, 0x55, 0x2e,
+	     0x94, 0xba, 0x50, 0xed, 0x42, 0xe9, 0x0b, 0x15, 0x30, 0xd4,
+	     0xc3, 0x50, 0x12, 0x43, 0x7d, 0x0c, 0x95, 0x32, 0x94, 0xcc,
+	     0x50, 0x37, 0x43, 0xf5, 0x0c, 0x45, 0x34, 0x94, 0xd2, 0x50,
+	     0x4e, 0x43, 0x4d, 0x0d, 0x95, 0x35, 0x54, 0xd7, 0x50, 0x63,
+	     0x43, 0xb5, 0x0d, 0x75, 0x37, 0x94, 0xde, 0x50, 0x88, 0x43,
+	     0x45, 0x0e, 0xf5, 0x39, 0x94, 0xea, 0x50, 0xb7, 0x43, 0x0d,
+	     0x0f, 0x65, 0x3c, 0x14, 0xf5, 0x50, 0xde, 0x43, 0x95, 0x0f,
+	     0x05, 0x3f, 0xd4, 0xfe, 0x50, 0x03, 0x44, 0x39, 0x10, 0x25,
+	     0x41, 0x54, 0x05, 0x51, 0x1a, 0x44, 0x9d, 0x10, 0x55, 0x43,
+	     0x54, 0x0f, 0x51, 0x48, 0x44, 0x49, 0x11, 0x75, 0x45, 0x14,
+	     0x17, 0x51, 0x63, 0x44, 0xa1, 0x11, 0x25, 0x47, 0x94, 0x1e,
+	     0x51, 0x83, 0x44, 0x35, 0x12, 0x65, 0x49, 0x54, 0x27, 0x51,
+	     0xa6, 0x44, 0xb1, 0x12, 0x35, 0x4b, 0xd4, 0x2d, 0x51, 0xba,
+	     0x44, 0x15, 0x13, 0x75, 0x4c, 0x14, 0x35, 0x51, 0xdb, 0x44,
+	     0x91, 0x13, 0x15, 0x4f, 0x94, 0x3d, 0x51, 0x03, 0x45, 0x39,
+	     0x14, 0x25, 0x51, 0x14, 0x48, 0x51, 0x25, 0x45, 0xb1, 0x14,
+	     0xa5, 0x53, 0x14, 0x52, 0x51, 0x4c, 0x45, 0x61, 0x15, 0xe5,
+	     0x55, 0x94, 0x5a, 0x51, 0x6e, 0x45, 0xe9, 0x15, 0x15, 0x58,
+	     0x94, 0x62, 0x51, 0x8c, 0x45, 0x3d, 0x16, 0x25, 0x59, 0x14,
+	     0x66, 0x51, 0xa4, 0x45, 0xa9, 0x16, 0xe5, 0x5a, 0xd4, 0x6e,
+	     0x51, 0xc3, 0x45, 0x41, 0x17, 0x85, 0x5d, 0x14, 0x77, 0x51,
+	     0xe0, 0x45, 0xad, 0x17, 0x75, 0x5f, 0x94, 0x80, 0x51, 0x0f,
+	     0x46, 0x5d, 0x18, 0xd5, 0x61, 0x54, 0x88, 0x51, 0x27, 0x46,
+	     0xc1, 0x18, 0x85, 0x63, 0x94, 0x90, 0x51, 0x4c, 0x46, 0x5d,
+	     0x19, 0xe5, 0x65, 0x14, 0x99, 0x51, 0x70, 0x46, 0xf1, 0x19,
+	     0x15, 0x68, 0xd4, 0xa2, 0x51, 0x8d, 0x46, 0x41, 0x1a, 0xd5,
+	     0x69, 0xd4, 0xa9, 0x51, 0xb2, 0x46, 0xd5, 0x1a, 0x95, 0x6b,
+	     0x14, 0xb0, 0x51, 0xcc, 0x46, 0x69, 0x1b, 0x85, 0x6e, 0x14,
+	     0xbc, 0x51, 0xf6, 0x46, 0xf1, 0x1b, 0x55, 0x70, 0x14, 0xc2,
+	     0x51, 0x0d, 0x47, 0x45, 0x1c, 0x95, 0x71, 0x94, 0xc7, 0x51,
+	     0x29, 0x47, 0xbd, 0x1c, 0x35, 0x73, 0x94, 0xce, 0x51, 0x48,
+	     0x47, 0x55, 0x1d, 0xc5, 0x75, 0x54, 0xd9, 0x51, 0x6e, 0x47,
+	     0xdd, 0x1d, 0x25, 0x78, 0x54, 0xe3, 0x51, 0x8f, 0x47, 0x49,
+	     0x1e, 0x85, 0x79, 0x94, 0xe8, 0x51, 0xae, 0x47, 0xe9, 0x1e,
+	     0x65, 0x7c, 0x14, 0xf3, 0x51, 0xd6, 0x47, 0x71, 0x1f, 0x45,
+	     0x7e, 0x14, 0xfc, 0x51, 0xf5, 0x47, 0xe9, 0x1f, 0x45, 0x80,
+	     0x14, 0x04, 0x52, 0x13, 0x48, 0x5d, 0x20, 0xb5, 0x81, 0x94,
+	     0x09, 0x52, 0x29, 0x48, 0xdd, 0x20, 0xe5, 0x83, 0x14, 0x12,
+	     0x52, 0x4b, 0x48, 0x65, 0x21, 0x15, 0x86, 0xd4, 0x1b, 0x52,
+	     0x7b, 0x48, 0x01, 0x22, 0x95, 0x88, 0xd4, 0x25, 0x52, 0x99,
+	     0x48, 0x7d, 0x22, 0xb5, 0x8a, 0xd4, 0x2c, 0x52, 0xbe, 0x48,
+	     0x29, 0x23, 0x35, 0x8d, 0x14, 0x38, 0x52, 0xe6, 0x48, 0xa9,
+	     0x23, 0xf5, 0x8e, 0x54, 0x3f, 0x52, 0x00, 0x49, 0x39, 0x24,
+	     0x35, 0x91, 0x14, 0x47, 0x52, 0x21, 0x49, 0xbd, 0x24, 0xd5,
+	     0x93, 0x54, 0x51, 0x52, 0x4b, 0x49, 0x59, 0x25, 0x45, 0x96,
+	     0x94, 0x5c, 0x52, 0x79, 0x49, 0xf1, 0x25, 0x85, 0x98, 0x94,
+	     0x65, 0x52, 0x99, 0x49, 0x89, 0x26, 0xf5, 0x9a, 0x14, 0x6f,
+	     0x52, 0xc3, 0x49, 0x15, 0x27, 0x95, 0x9c, 0x54, 0x73, 0x52,
+	     0xd1, 0x49, 0x79, 0x27, 0xa5, 0x9e, 0x94, 0x7d, 0x52, 0x04,
+	     0x4a, 0x1d, 0x28, 0x05, 0xa1, 0x14, 0x87, 0x52, 0x21, 0x4a,
+	     0xb1, 0x28, 0x15, 0xa3, 0x94, 0x8e, 0x52, 0x47, 0x4a, 0x49,
+	     0x29, 0xb5, 0xa5, 0x14, 0x99, 0x52, 0x6b, 0x4a, 0xe1, 0x29,
+	     0x45, 0xa8, 0x14, 0xa2, 0x52, 0x90, 0x4a, 0x71, 0x2a, 0x35,
+	     0xaa, 0x54, 0xac, 0x52, 0xb6, 0x4a, 0x0d, 0x2b, 0x95, 0xac,
+	     0x94, 0xb4, 0x52, 0xd4, 0x4a, 0x69, 0x2b, 0x55, 0xae, 0x94,
+	     0xbb, 0x52, 0xf8, 0x4a, 0xf9, 0x2b, 0x65, 0xb0, 0x54, 0xc2,
+	     0x52, 0x13, 0x4b, 0x75, 0x2c, 0x55, 0xb2, 0x14, 0xcb, 0x52,
+	     0x37, 0x4b, 0xf5, 0x2c, 0x75, 0xb4, 0x54, 0xd4, 0x52, 0x56,
+	     0x4b, 0x6d, 0x2d, 0x25, 0xb6, 0x94, 0xdb, 0x52, 0x72, 0x4b,
+	     0xf9, 0x2d, 0xa5, 0xb8, 0x94, 0xe3, 0x52, 0x93, 0x4b, 0x5d,
+	     0x2e, 0x35, 0xba, 0x14, 0xeb, 0x52, 0xb2, 0x4b, 0xed, 0x2e,
+	     0x65, 0xbc, 0x14, 0xf4, 0x52, 0xd2, 0x4b, 0x5d, 0x2f, 0xd5,
+	     0xbd, 0xd4, 0xfa, 0x52, 0xf1, 0x4b, 0xf1, 0x2f, 0x45, 0xc0,
+	     0xd4, 0x01, 0x53, 0x10, 0x4c, 0x79, 0x30, 0x95, 0xc2, 0x54,
+	     0x0d, 0x53, 0x43, 0x4c, 0x2d, 0x31, 0xe5, 0xc4, 0x94, 0x15,
+	     0x53, 0x5f, 0x4c, 0xad, 0x31, 0x95, 0xc7, 0x54, 0x21, 0x53,
+	     0x8a, 0x4c, 0x59, 0x32, 0x95, 0xc9, 0x94, 0x27, 0x53, 0xab,
+	     0x4c, 0xd5, 0x32, 0x75, 0xcb, 0xd4, 0x2e, 0x53, 0xc2, 0x4c,
+	     0x31, 0x33, 0x35, 0xcd, 0x94, 0x36, 0x53, 0xde, 0x4c, 0x91,
+	     0x33, 0x25, 0xcf, 0x14, 0x3f, 0x53, 0x08, 0x4d, 0x59, 0x34,
+	     0x15, 0xd2, 0x14, 0x49, 0x53, 0x2d, 0x4d, 0xc1, 0x34, 0x65,
+	     0xd3, 0x94, 0x50, 0x53, 0x4f, 0x4d, 0x49, 0x35, 0xd5, 0xd5,
+	     0x94, 0x58, 0x53, 0x68, 0x4d, 0xc5, 0x35, 0xf5, 0xd7, 0x94,
+	     0x61, 0x53, 0x88, 0x4d, 0x39, 0x36, 0x25, 0xd9, 0xd4, 0x65,
+	     0x53, 0x9a, 0x4d, 0x85, 0x36, 0xd5, 0xda, 0xd4, 0x6c, 0x53,
+	     0xbf, 0x4d, 0x19, 0x37, 0x15, 0xdd, 0xd4, 0x77, 0x53, 0xe8,
+	     0x4d, 0xb1, 0x37, 0x15, 0xdf, 0x14, 0x7f, 0x53, 0x07, 0x4e,
+	     0x41, 0x38, 0x75, 0xe1, 0x94, 0x87, 0x53, 0x2a, 0x4e, 0xd9,
+	     0x38, 0x95, 0xe3, 0x94, 0x90, 0x53, 0x46, 0x4e, 0x31, 0x39,
+	     0x05, 0xe5, 0x94, 0x96, 0x53, 0x5d, 0x4e, 0x91, 0x39, 0x95,
+	     0xe6, 0x54, 0x9c, 0x53, 0x7c, 0x4e, 0x0d, 0x3a, 0x65, 0xe8,
+	     0x54, 0xa4, 0x53, 0x9e, 0x4e, 0x81, 0x3a, 0xe5, 0xea, 0x54,
+	     0xad, 0x53, 0xc3, 0x4e, 0x35, 0x3b, 0x55, 0xed, 0xd4, 0xb8,
+	     0x53, 0xec, 0x4e, 0xc5, 0x3b, 0x45, 0xef, 0xd4, 0xbe, 0x53,
+	     0x07, 0x4f, 0x2d, 0x3c, 0x55, 0xf1, 0x94, 0xc8, 0x53, 0x2a,
+	     0x4f, 0xe1, 0x3c, 0x65, 0xf4, 0xd4, 0xd3, 0x53, 0x57, 0x4f,
+	     0x6d, 0x3d, 0xf5, 0xf5, 0x94, 0xda, 0x53, 0x75, 0x4f, 0xf5,
+	     0x3d, 0x35, 0xf8, 0x14, 0xe2, 0x53, 0x96, 0x4f, 0x75, 0x3e,
+	     0xf5, 0xf9, 0xd4, 0xea, 0x53, 0xb8, 0x4f, 0x05, 0x3f, 0xb5,
+	     0xfc, 0x14, 0xf4, 0x53, 0xd5, 0x4f, 0x7d, 0x3f, 0x75, 0xfe,
+	     0x54, 0xfd, 0x53, 0xf9, 0x4f, 0x01, 0x40, 0x65, 0x00, 0x95,
+	     0x02, 0x54, 0x10, 0x50, 0x75, 0x40, 0x75, 0x02, 0x55, 0x0d,
+	     0x54, 0x3b, 0x50, 0x19, 0x41, 0xf5, 0x04, 0x15, 0x16, 0x54,
+	     0x60, 0x50, 0xad, 0x41, 0x25, 0x07, 0x55, 0x1d, 0x54, 0x7f,
+	     0x50, 0x29, 0x42, 0xe5, 0x08, 0x55, 0x26, 0x54, 0x9f, 0x50,
+	     0xa9, 0x42, 0x45, 0x0b, 0x95, 0x2d, 0x54, 0xb9, 0x50, 0xf9,
+	     0x42, 0x45, 0x0c, 0x15, 0x34, 0x54, 0xd7, 0x50, 0x75, 0x43,
+	     0x95, 0x0e, 0xd5, 0x3b, 0x54, 0xf9, 0x50, 0xf1, 0x43, 0x25,
+	     0x10, 0x55, 0x41, 0x54, 0x13, 0x51, 0x81, 0x44, 0x35, 0x12,
+	     0x15, 0x4b, 0x54, 0x35, 0x51, 0xe9, 0x44, 0x45, 0x14, 0x55,
+	     0x54, 0x54, 0x57, 0x51, 0x71, 0x45, 0x25, 0x16, 0xd5, 0x59,
+	     0x54, 0x70, 0x51, 0xed, 0x45, 0xf5, 0x17, 0x55, 0x62, 0x54,
+	     0x92, 0x51, 0x51, 0x46, 0x95, 0x19, 0x95, 0x67, 0x54, 0xab,
+	     0x51, 0xd1, 0x46, 0x85, 0x1b, 0x15, 0x70, 0x54, 0xc9, 0x51,
+	     0x51, 0x47, 0x25, 0x1e, 0x15, 0x7b, 0x54, 0xfa, 0x51, 0xfd,
+	     0x47, 0xa5, 0x20, 0x15, 0x86, 0x54, 0x24, 0x52, 0xb1, 0x48,
+	     0x55, 0x23, 0x95, 0x8e, 0x54, 0x45, 0x52, 0x45, 0x49, 0xe5,
+	     0x25, 0x95, 0x99, 0x54, 0x6a, 0x52, 0xd1, 0x49, 0x75, 0x27,
+	     0x15, 0xa0, 0x54, 0x83, 0x52, 0x41, 0x4a, 0x65, 0x29, 0x15,
+	     0xa7, 0x54, 0x9e, 0x52, 0x95, 0x4a, 0xe5, 0x2a, 0x15, 0xaf,
+	     0x54, 0xc9, 0x52, 0x39, 0x4b, 0xc5, 0x2d, 0x55, 0xb8, 0x54,
+	     0xe5, 0x52, 0xad, 0x4b, 0x75, 0x2f, 0x95, 0xc0, 0x54, 0x06,
+	     0x53, 0x45, 0x4c, 0xc5, 0x31, 0x15, 0xc8, 0x54, 0x24, 0x53,
+	     0xb1, 0x4c, 0x95, 0x33, 0x95, 0xd0, 0x54, 0x46, 0x53, 0x41,
+	     0x4d, 0x35, 0x35, 0x55, 0xd7, 0x54, 0x6a, 0x53, 0xcd, 0x4d,
+	     0xf5, 0x37, 0x55, 0xe1, 0x54, 0x89, 0x53, 0x35, 0x4e, 0x85,
+	     0x39, 0x15, 0xe8, 0x54, 0xa2, 0x53, 0xb9, 0x4e, 0xc5, 0x3b,
+	     0x15, 0xf2, 0x54, 0xd1, 0x53, 0x6d, 0x4f, 0xf5, 0x3d, 0xd5,
+	     0xfa, 0x54, 0xf8, 0x53, 0x0d, 0x50, 0x15, 0x41, 0x95, 0x07,
+	     0x55, 0x23, 0x54, 0xb5, 0x50, 0x05, 0x43, 0xd5, 0x0e, 0x55,
+	     0x47, 0x54, 0x4d, 0x51, 0x15, 0x46, 0x15, 0x1b, 0x55, 0x75,
+	     0x54, 0xe1, 0x51, 0x15, 0x48, 0x55, 0x22, 0x55, 0x8f, 0x54,
+	     0x51, 0x52, 0x25, 0x4a, 0xd5, 0x29, 0x55, 0xab, 0x54, 0xd1,
+	     0x52, 0xf5, 0x4b, 0x55, 0x33, 0x55, 0xda, 0x54, 0x8d, 0x53,
+	     0x55, 0x4e, 0x15, 0x3b, 0x55, 0xf9, 0x54, 0x1d, 0x54, 0xe5,
+	     0x50, 0x55, 0x46, 0x55, 0x20, 0x55, 0xb1, 0x54, 0xa5, 0x53,
+	     0x55, 0x4f, 0x55, 0x4b, 0x55, 0x59, 0x55, 0xf5, 0x55, 0xd5,
+	     0x58, 0x55, 0x6b, 0x55, 0xcd, 0x55, 0x65, 0x57, 0x15, 0x61,
+	     0x55, 0x8a, 0x55, 0x55, 0x56, 0xc5, 0x59, 0x55, 0x68, 0x55,
+	     0xad, 0x55, 0xdd, 0x56, 0x95, 0x5b, 0x95, 0x6f, 0x55, 0xc2,
+	     0x55, 0x25, 0x57, 0x55, 0x5d, 0xd5, 0x76, 0x55, 0xe1, 0x55,
+	     0x99, 0x57, 0x45, 0x5f, 0xd5, 0x7e, 0x55, 0x00, 0x56, 0x2d,
+	     0x58, 0x95, 0x61, 0x95, 0x87, 0x55, 0x2a, 0x56, 0xb9, 0x58,
+	     0x25, 0x63, 0xd5, 0x8f, 0x55, 0x44, 0x56, 0x35, 0x59, 0x75,
+	     0x65, 0x95, 0x96, 0x55, 0x63, 0x56, 0xad, 0x59, 0x65, 0x67,
+	     0x55, 0xa0, 0x55, 0x8d, 0x56, 0x41, 0x5a, 0xc5, 0x69, 0xd5,
+	     0xa7, 0x55, 0xa9, 0x56, 0xd9, 0x5a, 0x85, 0x6b, 0xd5, 0xae,
+	     0x55, 0xbf, 0x56, 0x21, 0x5b, 0xd5, 0x6c, 0x55, 0xb5, 0x55,
+	     0xdc, 0x56, 0x8d, 0x5b, 0x65, 0x6e, 0x55, 0xbb, 0x55, 0xf3,
+	     0x56, 0xf1, 0x5b, 0x65, 0x70, 0x55, 0xc4, 0x55, 0x1d, 0x57,
+	     0x89, 0x5c, 0xf5, 0x72, 0x15, 0xcd, 0x55, 0x42, 0x57, 0x25,
+	     0x5d, 0xc5, 0x74, 0x15, 0xd4, 0x55, 0x57, 0x57, 0x75, 0x5d,
+	     0x75, 0x76, 0xd5, 0xdb, 0x55, 0x72, 0x57, 0xfd, 0x5d, 0xb5,
+	     0x78, 0x95, 0xe5, 0x55, 0xa4, 0x57, 0xb1, 0x5e, 0xe5, 0x7a,
+	     0x95, 0xec, 0x55, 0xb8, 0x57, 0x09, 0x5f, 0x55, 0x7c, 0x55,
+	     0xf3, 0x55, 0xd4, 0x57, 0x7d, 0x5f, 0x95, 0x7e, 0xd5, 0xfb,
+	     0x55, 0xfb, 0x57, 0xfd, 0x5f, 0x25, 0x80, 0x55, 0x02, 0x56,
+	     0x11, 0x58, 0x5d, 0x60, 0x15, 0x82, 0x15, 0x0a, 0x56, 0x31,
+	     0x58, 0xdd, 0x60, 0xd5, 0x83, 0x55, 0x12, 0x56, 0x4d, 0x58,
+	     0x55, 0x61, 0xf5, 0x85, 0x95, 0x18, 0x56, 0x6a, 0x58, 0xd1,
+	     0x61, 0x85, 0x87, 0x55, 0x1f, 0x56, 0x8b, 0x58, 0x3d, 0x62,
+	     0x95, 0x89, 0x95, 0x29, 0x56, 0xae, 0x58, 0xe1, 0x62, 0xa5,
+	     0x8b, 0x15, 0x31, 0x56, 0xcd, 0x58, 0x61, 0x63, 0x65, 0x8e,
+	     0x55, 0x3b, 0x56, 0xf5, 0x58, 0xfd, 0x63, 0x25, 0x90, 0xd5,
+	     0x41, 0x56, 0x12, 0x59, 0x61, 0x64, 0x05, 0x92, 0xd5, 0x49,
+	     0x56, 0x2f, 0x59, 0xc9, 0x64, 0x05, 0x94, 0x15, 0x51, 0x56,
+	     0x4e, 0x59, 0x59, 0x65, 0xe5, 0x95, 0x15, 0x5a, 0x56, 0x6b,
+	     0x59, 0xe1, 0x65, 0xf5, 0x97, 0x15, 0x61, 0x56, 0x8c, 0x59,
+	     0x4d, 0x66, 0x55, 0x99, 0x55, 0x67, 0x56, 0xa6, 0x59, 0xa5,
+	     0x66, 0xc5, 0x9a, 0x95, 0x6d, 0x56, 0xc3, 0x59, 0x29, 0x67,
+	     0x85, 0x9d, 0x55, 0x78, 0x56, 0xe9, 0x59, 0xb9, 0x67, 0xb5,
+	     0x9f, 0x15, 0x80, 0x56, 0x07, 0x5a, 0x29, 0x68, 0x05, 0xa1,
+	     0x95, 0x87, 0x56, 0x28, 0x5a, 0xd1, 0x68, 0x85, 0xa3, 0xd5,
+	     0x8f, 0x56, 0x4b, 0x5a, 0x35, 0x69, 0xb5, 0xa5, 0xd5, 0x99,
+	     0x56, 0x71, 0x5a, 0xfd, 0x69, 0x35, 0xa8, 0x95, 0xa2, 0x56,
+	     0x98, 0x5a, 0x8d, 0x6a, 0xf5, 0xaa, 0xd5, 0xac, 0x56, 0xb6,
+	     0x5a, 0xe9, 0x6a, 0xf5, 0xab, 0x55, 0xb3, 0x56, 0xd0, 0x5a,
+	     0x59, 0x6b, 0xf5, 0xad, 0x55, 0xb9, 0x56, 0xf3, 0x5a, 0xed,
+	     0x6b, 0x25, 0xb0, 0xd5, 0xc2, 0x56, 0x10, 0x5b, 0x6d, 0x6c,
+	     0xf5, 0xb1, 0x55, 0xcb, 0x56, 0x34, 0x5b, 0xfd, 0x6c, 0x35,
+	     0xb4, 0x15, 0xd4, 0x56, 0x5c, 0x5b, 0x85, 0x6d, 0x75, 0xb6,
+	     0x55, 0xdb, 0x56, 0x77, 0x5b, 0xe5, 0x6d, 0x05, 0xb8, 0xd5,
+	     0xe2, 0x56, 0x91, 0x5b, 0x5d, 0x6e, 0x35, 0xba, 0x95, 0xea,
+	     0x56, 0xb7, 0x5b, 0x01, 0x6f, 0x65, 0xbc, 0x15, 0xf5, 0x56,
+	     0xda, 0x5b, 0x99, 0x6f, 0xf5, 0xbe, 0x55, 0xfd, 0x56, 0x03,
+	     0x5c, 0x3d, 0x70, 0x75, 0xc1, 0x55, 0x08, 0x57, 0x2b, 0x5c,
+	     0xc9, 0x70, 0x75, 0xc3, 0xd5, 0x0f, 0x57, 0x43, 0x5c, 0x25,
+	     0x71, 0x55, 0xc5, 0x95, 0x17, 0x57, 0x63, 0x5c, 0x99, 0x71,
+	     0x45, 0xc7, 0x95, 0x1d, 0x57, 0x79, 0x5c, 0xf1, 0x71, 0x15,
+	     0xc8, 0x15, 0x23, 0x57, 0x90, 0x5c, 0x5d, 0x72, 0xf5, 0xc9,
+	     0xd5, 0x2a, 0x57, 0xb9, 0x5c, 0x15, 0x73, 0xf5, 0xcc, 0xd5,
+	     0x35, 0x57, 0xdb, 0x5c, 0x8d, 0x73, 0x05, 0xcf, 0x95, 0x3e,
+	     0x57, 0x07, 0x5d, 0x49, 0x74, 0xa5, 0xd1, 0x55, 0x48, 0x57,
+	     0x24, 0x5d, 0xbd, 0x74, 0x25, 0xd3, 0x15, 0x4e, 0x57, 0x40,
+	     0x5d, 0x19, 0x75, 0xd5, 0xd4, 0xd5, 0x53, 0x57, 0x5d, 0x5d,
+	     0x89, 0x75, 0x75, 0xd6, 0x55, 0x5d, 0x57, 0x7f, 0x5d, 0x25,
+	     0x76, 0x35, 0xd9, 0x95, 0x67, 0x57, 0xa1, 0x5d, 0x99, 0x76,
+	     0xd5, 0xda, 0x55, 0x6c, 0x57, 0xb5, 0x5d, 0x09, 0x77, 0xc5,
+	     0xdc, 0x55, 0x74, 0x57, 0xd8, 0x5d, 0x8d, 0x77, 0x75, 0xde,
+	     0xd5, 0x7c, 0x57, 0xfe, 0x5d, 0x29, 0x78, 0x55, 0xe1, 0x55,
+	     0x86, 0x57, 0x24, 0x5e, 0xa9, 0x78, 0xf5, 0xe2, 0x55, 0x8d,
+	     0x57, 0x3d, 0x5e, 0x25, 0x79, 0xb5, 0xe4, 0x55, 0x96, 0x57,
+	     0x5f, 0x5e, 0x91, 0x79, 0x95, 0xe6, 0x95, 0x9b, 0x57, 0x75,
+	     0x5e, 0xe1, 0x79, 0xc5, 0xe7, 0xd5, 0xa1, 0x57, 0x8a, 0x5e,
+	     0x41, 0x7a, 0xe5, 0xe9, 0x95, 0xaa, 0x57, 0xb4, 0x5e, 0x09,
+	     0x7b, 0x95, 0xec, 0xd5, 0xb5, 0x57, 0xdf, 0x5e, 0x89, 0x7b,
+	     0xd5, 0xee, 0x95, 0xbe, 0x57, 0x02, 0x5f, 0x15, 0x7c, 0xa5,
+	     0xf0, 0x15, 0xc4, 0x57, 0x16, 0x5f, 0x7d, 0x7c, 0x45, 0xf2,
+	     0x15, 0xca, 0x57, 0x33, 0x5f, 0xd9, 0x7c, 0x05, 0xf4, 0xd5,
+	     0xd1, 0x57, 0x4a, 0x5f, 0x3d, 0x7d, 0xa5, 0xf5, 0xd5, 0xd9,
+	     0x57, 0x6a, 0x5f, 0xc9, 0x7d, 0x85, 0xf7, 0xd5, 0xe0, 0x57,
+	     0x88, 0x5f, 0x4d, 0x7e, 0x55, 0xf9, 0xd5, 0xe8, 0x57, 0xaf,
+	     0x5f, 0xdd, 0x7e, 0x15, 0xfc, 0x95, 0xf1, 0x57, 0xd4, 0x5f,
+	     0x7d, 0x7f, 0x95, 0xfe, 0xd5, 0xfc, 0x57, 0x00, 0x60, 0x2d,
+	     0x80, 0x65, 0x01, 0x96, 0x08, 0x58, 0x26, 0x60, 0xa9, 0x80,
+	     0x25, 0x03, 0x96, 0x0e, 0x58, 0x46, 0x60, 0x45, 0x81, 0x45,
+	     0x05, 0x16, 0x17, 0x58, 0x66, 0x60, 0xa5, 0x81, 0x15, 0x07,
+	     0xd6, 0x1c, 0x58, 0x7d, 0x60, 0x25, 0x82, 0xe5, 0x08, 0x56,
+	     0x26, 0x58, 0xa5, 0x60, 0xc9, 0x82, 0xb5, 0x0b, 0x96, 0x31,
+	     0x58, 0xd1, 0x60, 0x6d, 0x83, 0xe5, 0x0d, 0xd6, 0x38, 0x58,
+	     0xe8, 0x60, 0xb1, 0x83, 0x25, 0x0f, 0xd6, 0x3e, 0x58, 0x03,
+	     0x61, 0x35, 0x84, 0x95, 0x11, 0x56, 0x47, 0x58, 0x29, 0x61,
+	     0xd9, 0x84, 0x25, 0x14, 0x96, 0x51, 0x58, 0x49, 0x61, 0x3d,
+	     0x85, 0x25, 0x15, 0x16, 0x56, 0x58, 0x60, 0x61, 0x99, 0x85,
+	     0x85, 0x16, 0x96, 0x5b, 0x58, 0x78, 0x61, 0x15, 0x86, 0xe5,
+	     0x18, 0x16, 0x67, 0x58, 0xaa, 0x61, 0xb9, 0x86, 0x25, 0x1b,
+	     0xd6, 0x6e, 0x58, 0xc4, 0x61, 0x45, 0x87, 0xb5, 0x1d, 0x56,
+	     0x7a, 0x58, 0xf4, 0x61, 0xf9, 0x87, 0xc5, 0x20, 0x96, 0x85,
+	     0x58, 0x22, 0x62, 0xb5, 0x88, 0x85, 0x23, 0x96, 0x90, 0x58,
+	     0x45, 0x62, 0x31, 0x89, 0x15, 0x25, 0xd6, 0x96, 0x58, 0x5d,
+	     0x62, 0x81, 0x89, 0x35, 0x26, 0x56, 0x9c, 0x58, 0x78, 0x62,
+	     0xf9, 0x89, 0x65, 0x28, 0x56, 0xa2, 0x58, 0x94, 0x62, 0x85,
+	     0x8a, 0xa5, 0x2a, 0x56, 0xad, 0x58, 0xb8, 0x62, 0x01, 0x8b,
+	     0x45, 0x2c, 0x16, 0xb3, 0x58, 0xd5, 0x62, 0x6d, 0x8b, 0x05,
+	     0x2e, 0x96, 0xba, 0x58, 0xf1, 0x62, 0xf1, 0x8b, 0x35, 0x30,
+	     0xd6, 0xc2, 0x58, 0x0d, 0x63, 0x55, 0x8c, 0x15, 0x32, 0x96,
+	     0xca, 0x58, 0x35, 0x63, 0xf5, 0x8c, 0x25, 0x34, 0x16, 0xd3,
+	     0x58, 0x4f, 0x63, 0x51, 0x8d, 0x95, 0x35, 0x96, 0xd8, 0x58,
+	     0x6e, 0x63, 0xf1, 0x8d, 0x55, 0x38, 0x16, 0xe2, 0x58, 0x91,
+	     0x63, 0x59, 0x8e, 0xa5, 0x39, 0x56, 0xe9, 0x58, 0xad, 0x63,
+	     0xd5, 0x8e, 0x25, 0x3c, 0x16, 0xf3, 0x58, 0xd4, 0x63, 0x65,
+	     0x8f, 0x45, 0x3e, 0x16, 0xfc, 0x58, 0xfe, 0x63, 0x15, 0x90,
+	     0x35, 0x41, 0x56, 0x07, 0x59, 0x28, 0x64, 0xa9, 0x90, 0xf5,
+	     0x42, 0x96, 0x0d, 0x59, 0x41, 0x64, 0x29, 0x91, 0x15, 0x45,
+	     0xd6, 0x17, 0x59, 0x6c, 0x64, 0xd1, 0x91, 0xf5, 0x47, 0x96,
+	     0x20, 0x59, 0x86, 0x64, 0x3d, 0x92, 0x95, 0x49, 0x56, 0x28,
+	     0x59, 0xae, 0x64, 0xd9, 0x92, 0xe5, 0x4b, 0x16, 0x32, 0x59,
+	     0xcc, 0x64, 0x59, 0x93, 0x05, 0x4e, 0x96, 0x3a, 0x59, 0xf2,
+	     0x64, 0xd1, 0x93, 0x75, 0x4f, 0xd6, 0x3e, 0x59, 0xff, 0x64,
+	     0x09, 0x94, 0x65, 0x50, 0x16, 0x43, 0x59, 0x15, 0x65, 0x8d,
+	     0x94, 0xd5, 0x52, 0x16, 0x4e, 0x59, 0x3f, 0x65, 0x15, 0x95,
+	     0x05, 0x55, 0xd6, 0x55, 0x59, 0x5d, 0x65, 0x8d, 0x95, 0x95,
+	     0x56, 0x96, 0x5d, 0x59, 0x82, 0x65, 0x15, 0x96, 0x35, 0x59,
+	     0xd6, 0x65, 0x59, 0x9c, 0x65, 0x79, 0x96, 0x95, 0x5a, 0x16,
+	     0x6c, 0x59, 0xb4, 0x65, 0x09, 0x97, 0x55, 0x5c, 0xd6, 0x73,
+	     0x59, 0xdc, 0x65, 0xa1, 0x97, 0x65, 0x5f, 0x56, 0x80, 0x59,
+	     0x0b, 0x66, 0x55, 0x98, 0xb5, 0x61, 0xd6, 0x89, 0x59, 0x34,
+	     0x66, 0xfd, 0x98, 0x85, 0x64, 0x16, 0x93, 0x59, 0x54, 0x66,
+	     0x65, 0x99, 0xd5, 0x65, 0x96, 0x99, 0x59, 0x73, 0x66, 0xdd,
+	     0x99, 0x15, 0x68, 0xd6, 0xa3, 0x59, 0x93, 0x66, 0x65, 0x9a,
+	     0xb5, 0x69, 0xd6, 0xa9, 0x59, 0xb1, 0x66, 0xf5, 0x9a, 0x15,
+	     0x6c, 0x56, 0xb2, 0x59, 0xcd, 0x66, 0x5d, 0x9b, 0xa5, 0x6d,
+	     0x16, 0xb9, 0x59, 0xf1, 0x66, 0xfd, 0x9b, 0x45, 0x70, 0x56,
+	     0xc4, 0x59, 0x1e, 0x67, 0x85, 0x9c, 0xb5, 0x72, 0xd6, 0xcd,
+	     0x59, 0x44, 0x67, 0x29, 0x9d, 0x45, 0x75, 0xd6, 0xd6, 0x59,
+	     0x60, 0x67, 0xb5, 0x9d, 0x65, 0x77, 0xd6, 0xde, 0x59, 0x84,
+	     0x67, 0x39, 0x9e, 0xc5, 0x79, 0xd6, 0xe9, 0x59, 0xb3, 0x67,
+	     0xed, 0x9e, 0x05, 0x7c, 0xd6, 0xf0, 0x59, 0xcd, 0x67, 0x6d,
+	     0x9f, 0x25, 0x7e, 0x56, 0xfb, 0x59, 0xef, 0x67, 0xe5, 0x9f,
+	     0x15, 0x80, 0xd6, 0x02, 0x5a, 0x12, 0x68, 0x6d, 0xa0, 0xe5,
+	     0x81, 0x56, 0x0a, 0x5a, 0x30, 0x68, 0xe9, 0xa0, 0x05, 0x84,
+	     0xd6, 0x12, 0x5a, 0x59, 0x68, 0x75, 0xa1, 0x05, 0x86, 0x96,
+	     0x1a, 0x5a, 0x70, 0x68, 0xd1, 0xa1, 0xc5, 0x87, 0xd6, 0x21,
+	     0x5a, 0x8e, 0x68, 0x61, 0xa2, 0x65, 0x8a, 0xd6, 0x2b, 0x5a,
+	     0xb4, 0x68, 0xe9, 0xa2, 0xe5, 0x8b, 0x96, 0x32, 0x5a, 0xd3,
+	     0x68, 0x79, 0xa3, 0x65, 0x8e, 0x16, 0x3c, 0x5a, 0xf9, 0x68,
+	     0xf1, 0xa3, 0xe5, 0x8f, 0x96, 0x42, 0x5a, 0x0d, 0x69, 0x69,
+	     0xa4, 0x65, 0x92, 0x56, 0x4b, 0x5a, 0x3a, 0x69, 0x15, 0xa5,
+	     0xb5, 0x94, 0xd6, 0x54, 0x5a, 0x5a, 0x69, 0x95, 0xa5, 0x85,
+	     0x96, 0xd6, 0x5b, 0x5a, 0x7c, 0x69, 0x05, 0xa6, 0xa5, 0x98,
+	     0x56, 0x63, 0x5a, 0x99, 0x69, 0x79, 0xa6, 0x15, 0x9a, 0x16,
+	     0x6a, 0x5a, 0xb6, 0x69, 0x01, 0xa7, 0xa5, 0x9c, 0x16, 0x75,
+	     0x5a, 0xd9, 0x69, 0x71, 0xa7, 0x65, 0x9e, 0xd6, 0x7c, 0x5a,
+	     0xfd, 0x69, 0x1d, 0xa8, 0x35, 0xa1, 0x56, 0x85, 0x5a, 0x20,
+	     0x6a, 0xb9, 0xa8, 0x45, 0xa3, 0x96, 0x90, 0x5a, 0x4a, 0x6a,
+	     0x55, 0xa9, 0x85, 0xa5, 0x16, 0x99, 0x5a, 0x6a, 0x6a, 0xc5,
+	     0xa9, 0xa5, 0xa7, 0xd6, 0xa0, 0x5a, 0x90, 0x6a, 0x6d, 0xaa,
+	     0xe5, 0xa9, 0x16, 0xab, 0x5a, 0xb4, 0x6a, 0x09, 0xab, 0x65,
+	     0xac, 0x96, 0xb4, 0x5a, 0xdd, 0x6a, 0xa9, 0xab, 0x05, 0xaf,
+	     0x56, 0xbe, 0x5a, 0x02, 0x6b, 0x11, 0xac, 0xe5, 0xb0, 0x96,
+	     0xc6, 0x5a, 0x1e, 0x6b, 0xb1, 0xac, 0x15, 0xb3, 0x96, 0xcf,
+	     0x5a, 0x4a, 0x6b, 0x45, 0xad, 0x45, 0xb5, 0x16, 0xd7, 0x5a,
+	     0x60, 0x6b, 0x99, 0xad, 0x35, 0xb7, 0x16, 0xe0, 0x5a, 0x84,
+	     0x6b, 0x35, 0xae, 0x25, 0xb9, 0x96, 0xe7, 0x5a, 0xa3, 0x6b,
+	     0xa1, 0xae, 0xb5, 0xba, 0x96, 0xec, 0x5a, 0xb9, 0x6b, 0xf1,
+	     0xae, 0x35, 0xbc, 0x96, 0xf1, 0x5a, 0xc8, 0x6b, 0x49, 0xaf,
+	     0xc5, 0xbd, 0x56, 0xfa, 0x5a, 0xf0, 0x6b, 0xd9, 0xaf, 0xe5,
+	     0xbf, 0x96, 0x00, 0x5b, 0x0f, 0x6c, 0x59, 0xb0, 0xc5, 0xc1,
+	     0x16, 0x0a, 0x5b, 0x34, 0x6c, 0xf9, 0xb0, 0x85, 0xc4, 0x16,
+	     0x15, 0x5b, 0x5d, 0x6c, 0x89, 0xb1, 0x55, 0xc6, 0x56, 0x1b,
+	     0x5b, 0x76, 0x6c, 0xf9, 0xb1, 0x55, 0xc8, 0x16, 0x22, 0x5b,
+	     0x8f, 0x6c, 0x59, 0xb2, 0xc5, 0xc9, 0x56, 0x29, 0x5b, 0xac,
+	     0x6c, 0xd1, 0xb2, 0x85, 0xcb, 0xd6, 0x2e, 0x5b, 0xc3, 0x6c,
+	     0x29, 0xb3, 0xe5, 0xcc, 0x56, 0x35, 0x5b, 0xd7, 0x6c, 0x69,
+	     0xb3, 0x35, 0xce, 0xd6, 0x39, 0x5b, 0xf5, 0x6c, 0xfd, 0xb3,
+	     0x35, 0xd0, 0x56, 0x42, 0x5b, 0x16, 0x6d, 0x69, 0xb4, 0xf5,
+	     0xd1, 0x16, 0x4b, 0x5b, 0x38, 0x6d, 0xfd, 0xb4, 0x95, 0xd4,
+	     0xd6, 0x55, 0x5b, 0x5e, 0x6d, 0x89, 0xb5, 0x85, 0xd6, 0x96,
+	     0x5b, 0x5b, 0x7c, 0x6d, 0x01, 0xb6, 0x45, 0xd8, 0x56, 0x64,
+	     0x5b, 0x9d, 0x6d, 0xad, 0xb6, 0x65, 0xdb, 0x96, 0x6e, 0x5b,
+	     0xbf, 0x6d, 0x35, 0xb7, 0x55, 0xdd, 0x96, 0x78, 0x5b, 0xef,
+	     0x6d, 0xed, 0xb7, 0x15, 0xe0, 0xd6, 0x83, 0x5b, 0x14, 0x6e,
+	     0x71, 0xb8, 0x35, 0xe2, 0x96, 0x8b, 0x5b, 0x30, 0x6e, 0xd5,
+	     0xb8, 0x95, 0xe3, 0xd6, 0x8f, 0x5b, 0x49, 0x6e, 0x41, 0xb9,
+	     0xe5, 0xe5, 0x96, 0x98, 0x5b, 0x6d, 0x6e, 0xcd, 0xb9, 0xb5,
+	     0xe7, 0x96, 0x9f, 0x5b, 0x87, 0x6e, 0x2d, 0xba, 0x45, 0xe9,
+	     0x96, 0xa6, 0x5b, 0x9f, 0x6e, 0x91, 0xba, 0xe5, 0xea, 0x16,
+	     0xae, 0x5b, 0xc3, 0x6e, 0x21, 0xbb, 0xe5, 0xec, 0xd6, 0xb5,
+	     0x5b, 0xdc, 0x6e, 0x8d, 0xbb, 0xc5, 0xee, 0x96, 0xbd, 0x5b,
+	     0xfe, 0x6e, 0x25, 0xbc, 0x05, 0xf1, 0x56, 0xc5, 0x5b, 0x1c,
+	     0x6f, 0x81, 0xbc, 0x45, 0xf2, 0xd6, 0xca, 0x5b, 0x33, 0x6f,
+	     0xed, 0xbc, 0x45, 0xf4, 0x96, 0xd2, 0x5b, 0x55, 0x6f, 0x75,
+	     0xbd, 0x65, 0xf6, 0xd6, 0xdc, 0x5b, 0x7a, 0x6f, 0x15, 0xbe,
+	     0xb5, 0xf8, 0xd6, 0xe3, 0x5b, 0x9b, 0x6f, 0x99, 0xbe, 0x45,
+	     0xfb, 0x96, 0xf0, 0x5b, 0xc8, 0x6f, 0x35, 0xbf, 0x95, 0xfd,
+	     0x96, 0xf9, 0x5b, 0xf1, 0x6f, 0xe1, 0xbf, 0x35, 0x00, 0xd7,
+	     0x03, 0x5c, 0x19, 0x70, 0x99, 0xc0, 0xd5, 0x02, 0xd7, 0x0b,
+	     0x5c, 0x37, 0x70, 0xfd, 0xc0, 0x65, 0x04, 0x17, 0x15, 0x5c,
+	     0x57, 0x70, 0x6d, 0xc1, 0x05, 0x06, 0x97, 0x1a, 0x5c, 0x76,
+	     0x70, 0xf9, 0xc1, 0x55, 0x08, 0x97, 0x22, 0x5c, 0x98, 0x70,
+	     0x95, 0xc2, 0x25, 0x0b, 0x57, 0x2d, 0x5c, 0xb9, 0x70, 0x0d,
+	     0xc3, 0xa5, 0x0c, 0x17, 0x36, 0x5c, 0xdb, 0x70, 0xa5, 0xc3,
+	     0xd5, 0x0e, 0x17, 0x3d, 0x5c, 0xf7, 0x70, 0x01, 0xc4, 0x95,
+	     0x10, 0xd7, 0x44, 0x5c, 0x15, 0x71, 0x69, 0xc4, 0xe5, 0x11,
+	     0x97, 0x48, 0x5c, 0x2f, 0x71, 0xed, 0xc4, 0xe5, 0x13, 0xd7,
+	     0x51, 0x5c, 0x54, 0x71, 0x61, 0xc5, 0x45, 0x16, 0x57, 0x5b,
+	     0x5c, 0x73, 0x71, 0xf1, 0xc5, 0x85, 0x18, 0x57, 0x63, 0x5c,
+	     0x90, 0x71, 0x79, 0xc6, 0x15, 0x1a, 0xd7, 0x69, 0x5c, 0xb3,
+	     0x71, 0xf9, 0xc6, 0x65, 0x1c, 0x17, 0x75, 0x5c, 0xde, 0x71,
+	     0x95, 0xc7, 0x05, 0x1f, 0xd7, 0x7e, 0x5c, 0x03, 0x72, 0x1d,
+	     0xc8, 0x95, 0x20, 0x97, 0x84, 0x5c, 0x1d, 0x72, 0xa5, 0xc8,
+	     0x45, 0x23, 0x57, 0x8f, 0x5c, 0x40, 0x72, 0x29, 0xc9, 0x55,
+	     0x25, 0x97, 0x98, 0x5c, 0x6e, 0x72, 0xf1, 0xc9, 0xf5, 0x27,
+	     0x17, 0xa3, 0x5c, 0x9a, 0x72, 0x95, 0xca, 0x25, 0x2b, 0x17,
+	     0xae, 0x5c, 0xc3, 0x72, 0x29, 0xcb, 0x85, 0x2d, 0x57, 0xb7,
+	     0x5c, 0xe4, 0x72, 0xbd, 0xcb, 0xb5, 0x2f, 0x57, 0xc1, 0x5c,
+	     0x0b, 0x73, 0x51, 0xcc, 0xf5, 0x31, 0x97, 0xca, 0x5c, 0x38,
+	     0x73, 0x01, 0xcd, 0xe5, 0x34, 0x57, 0xd6, 0x5c, 0x5b, 0x73,
+	     0x9d, 0xcd, 0x55, 0x37, 0xd7, 0xde, 0x5c, 0x85, 0x73, 0x35,
+	     0xce, 0x05, 0x39, 0x17, 0xe7, 0x5c, 0xa7, 0x73, 0xd5, 0xce,
+	     0x95, 0x3b, 0x57, 0xf1, 0x5c, 0xca, 0x73, 0x4d, 0xcf, 0x65,
+	     0x3d, 0x17, 0xf9, 0x5c, 0xe9, 0x73, 0xcd, 0xcf, 0xa5, 0x3f,
+	     0x57, 0x01, 0x5d, 0x12, 0x74, 0x61, 0xd0, 0xd5, 0x41, 0x97,
+	     0x09, 0x5d, 0x2a, 0x74, 0xc5, 0xd0, 0xb5, 0x43, 0x97, 0x0f,
+	     0x5d, 0x45, 0x74, 0x31, 0xd1, 0x05, 0x45, 0x97, 0x16, 0x5d,
+	     0x5f, 0x74, 0x91, 0xd1, 0xd5, 0x46, 0xd7, 0x1d, 0x5d, 0x7d,
+	     0x74, 0x19, 0xd2, 0x85, 0x48, 0x17, 0x24, 0x5d, 0x96, 0x74,
+	     0x79, 0xd2, 0x55, 0x4a, 0x97, 0x2a, 0x5d, 0xaf, 0x74, 0xf1,
+	     0xd2, 0xf5, 0x4b, 0xd7, 0x31, 0x5d, 0xd4, 0x74, 0x7d, 0xd3,
+	     0xb5, 0x4e, 0x17, 0x3c, 0x5d, 0xfb, 0x74, 0xf9, 0xd3, 0xa5,
+	     0x50, 0x57, 0x45, 0x5d, 0x1b, 0x75, 0x8d, 0xd4, 0xa5, 0x52,
+	     0x57, 0x4b, 0x5d, 0x34, 0x75, 0xed, 0xd4, 0x15, 0x54, 0xd7,
+	     0x51, 0x5d, 0x4e, 0x75, 0x59, 0xd5, 0xb5, 0x55, 0x97, 0x59,
+	     0x5d, 0x72, 0x75, 0xe9, 0xd5, 0xc5, 0x57, 0x97, 0x62, 0x5d,
+	     0x8f, 0x75, 0x59, 0xd6, 0xc5, 0x59, 0x17, 0x6a, 0x5d, 0xb4,
+	     0x75, 0xe5, 0xd6, 0x25, 0x5c, 0x17, 0x73, 0x5d, 0xd2, 0x75,
+	     0x7d, 0xd7, 0x45, 0x5e, 0x57, 0x7c, 0x5d, 0xfe, 0x75, 0x31,
+	     0xd8, 0x35, 0x61, 0x97, 0x85, 0x5d, 0x1d, 0x76, 0x89, 0xd8,
+	     0xe5, 0x62, 0x57, 0x8e, 0x5d, 0x47, 0x76, 0x4d, 0xd9, 0x95,
+	     0x65, 0x57, 0x99, 0x5d, 0x6c, 0x76, 0xc1, 0xd9, 0x55, 0x67,
+	     0xd7, 0x9e, 0x5d, 0x80, 0x76, 0x09, 0xda, 0x95, 0x68, 0x97,
+	     0xa5, 0x5d, 0x9a, 0x76, 0x75, 0xda, 0xb5, 0x6a, 0x57, 0xac,
+	     0x5d, 0xbc, 0x76, 0x09, 0xdb, 0xe5, 0x6c, 0x57, 0xb6, 0x5d,
+	     0xe5, 0x76, 0xad, 0xdb, 0x95, 0x6f, 0xd7, 0xc0, 0x5d, 0x09,
+	     0x77, 0x5d, 0xdc, 0x55, 0x72, 0x57, 0xcc, 0x5d, 0x3a, 0x77,
+	     0x0d, 0xdd, 0x65, 0x74, 0x97, 0xd2, 0x5d, 0x4f, 0x77, 0x69,
+	     0xdd, 0xf5, 0x75, 0xd7, 0xd8, 0x5d, 0x6d, 0x77, 0xbd, 0xdd,
+	     0x35, 0x77, 0x57, 0xdf, 0x5d, 0x83, 0x77, 0x2d, 0xde, 0x65,
+	     0x79, 0xd7, 0xe6, 0x5d, 0xa8, 0x77, 0xd5, 0xde, 0x35, 0x7c,
+	     0x17, 0xf2, 0x5d, 0xd5, 0x77, 0x7d, 0xdf, 0xc5, 0x7e, 0x57,
+	     0xfc, 0x5d, 0xfb, 0x77, 0x21, 0xe0, 0x45, 0x81, 0x17, 0x08,
+	     0x5e, 0x27, 0x78, 0xb5, 0xe0, 0x95, 0x83, 0x97, 0x11, 0x5e,
+	     0x54, 0x78, 0x79, 0xe1, 0xb5, 0x86, 0x57, 0x1c, 0x5e, 0x7d,
+	     0x78, 0xfd, 0xe1, 0x85, 0x88, 0x97, 0x23, 0x5e, 0x92, 0x78,
+	     0x81, 0xe2, 0x65, 0x8a, 0x57, 0x2b, 0x5e, 0xb1, 0x78, 0xf5,
+	     0xe2, 0x25, 0x8c, 0xd7, 0x33, 0x5e, 0xd6, 0x78, 0x81, 0xe3,
+	     0xe5, 0x8e, 0x57, 0x3d, 0x5e, 0xfc, 0x78, 0x19, 0xe4, 0xf5,
+	     0x90, 0x57, 0x45, 0x5e, 0x1b, 0x79, 0xa5, 0xe4, 0x65, 0x93,
+	     0x57, 0x4f, 0x5e, 0x41, 0x79, 0x15, 0xe5, 0x75, 0x94, 0x97,
+	     0x52, 0x5e, 0x58, 0x79, 0x95, 0xe5, 0xd5, 0x96, 0x57, 0x5d,
+	     0x5e, 0x7d, 0x79, 0x25, 0xe6, 0x65, 0x99, 0xd7, 0x66, 0x5e,
+	     0x9f, 0x79, 0xad, 0xe6, 0x85, 0x9b, 0x57, 0x6f, 0x5e, 0xc2,
+	     0x79, 0x25, 0xe7, 0x35, 0x9d, 0x57, 0x76, 0x5e, 0xe2, 0x79,
+	     0xa1, 0xe7, 0x35, 0x9f, 0x17, 0x80, 0x5e, 0x0c, 0x7a, 0x69,
+	     0xe8, 0xc5, 0xa1, 0xd7, 0x88, 0x5e, 0x27, 0x7a, 0xc1, 0xe8,
+	     0x65, 0xa3, 0x57, 0x8e, 0x5e, 0x3f, 0x7a, 0x1d, 0xe9, 0x45,
+	     0xa5, 0x57, 0x98, 0x5e, 0x68, 0x7a, 0xc1, 0xe9, 0x35, 0xa7,
+	     0x57, 0xa0, 0x5e, 0x8e, 0x7a, 0x51, 0xea, 0xc5, 0xa9, 0x97,
+	     0xaa, 0x5e, 0xb1, 0x7a, 0xfd, 0xea, 0xc5, 0xac, 0x57, 0xb5,
+	     0x5e, 0xe1, 0x7a, 0xb5, 0xeb, 0x15, 0xaf, 0x57, 0xbd, 0x5e,
+	     0xf8, 0x7a, 0x09, 0xec, 0xf5, 0xb0, 0xd7, 0xc4, 0x5e, 0x15,
+	     0x7b, 0x85, 0xec, 0xb5, 0xb2, 0x97, 0xcc, 0x5e, 0x3c, 0x7b,
+	     0xfd, 0xec, 0xb5, 0xb4, 0x97, 0xd4, 0x5e, 0x56, 0x7b, 0x91,
+	     0xed, 0xc5, 0xb6, 0x57, 0xdc, 0x5e, 0x7d, 0x7b, 0x01, 0xee,
+	     0x45, 0xb8, 0x97, 0xe4, 0x5e, 0x9d, 0x7b, 0x85, 0xee, 0xa5,
+	     0xba, 0x97, 0xec, 0x5e, 0xbc, 0x7b, 0x29, 0xef, 0x05, 0xbd,
+	     0x97, 0xf4, 0x5e, 0xd7, 0x7b, 0x89, 0xef, 0xd5, 0xbe, 0x97,
+	     0xfe, 0x5e, 0x08, 0x7c, 0x4d, 0xf0, 0xb5, 0xc1, 0xd7, 0x07,
+	     0x5f, 0x2b, 0x7c, 0xdd, 0xf0, 0xf5, 0xc3, 0xd7, 0x10, 0x5f,
+	     0x50, 0x7c, 0x71, 0xf1, 0xa5, 0xc6, 0xd7, 0x1d, 0x5f, 0x85,
+	     0x7c, 0x39, 0xf2, 0xb5, 0xc9, 0xd7, 0x29, 0x5f, 0xb2, 0x7c,
+	     0xdd, 0xf2, 0xf5, 0xcb, 0x57, 0x31, 0x5f, 0xcc, 0x7c, 0x65,
+	     0xf3, 0xe5, 0xcd, 0x17, 0x38, 0x5f, 0xe8, 0x7c, 0xb5, 0xf3,
+	     0x15, 0xcf, 0x97, 0x3f, 0x5f, 0x09, 0x7d, 0x4d, 0xf4, 0x15,
+	     0xd2, 0xd7, 0x49, 0x5f, 0x32, 0x7d, 0xfd, 0xf4, 0x35, 0xd4,
+	     0x97, 0x53, 0x5f, 0x51, 0x7d, 0x51, 0xf5, 0x15, 0xd6, 0x17,
+	     0x5a, 0x5f, 0x76, 0x7d, 0xe9, 0xf5, 0x35, 0xd8, 0x97, 0x61,
+	     0x5f, 0x8e, 0x7d, 0x71, 0xf6, 0x75, 0xda, 0x97, 0x6b, 0x5f,
+	     0xba, 0x7d, 0x15, 0xf7, 0xc5, 0xdc, 0x97, 0x73, 0x5f, 0xd9,
+	     0x7d, 0x7d, 0xf7, 0x35, 0xde, 0x97, 0x79, 0x5f, 0xea, 0x7d,
+	     0xc9, 0xf7, 0xf5, 0xdf, 0x17, 0x83, 0x5f, 0x18, 0x7e, 0x89,
+	     0xf8, 0x85, 0xe2, 0x17, 0x8b, 0x5f, 0x32, 0x7e, 0x01, 0xf9,
+	     0x65, 0xe4, 0xd7, 0x94, 0x5f, 0x61, 0x7e, 0x9d, 0xf9, 0x55,
+	     0xe7, 0x97, 0xa0, 0x5f, 0x8a, 0x7e, 0x31, 0xfa, 0x55, 0xe9,
+	     0x17, 0xa8, 0x5f, 0xa9, 0x7e, 0xd9, 0xfa, 0x35, 0xec, 0xd7,
+	     0xb1, 0x5f, 0xd0, 0x7e, 0x75, 0xfb, 0x55, 0xee, 0x57, 0xbc,
+	     0x5f, 0xfe, 0x7e, 0x05, 0xfc, 0x55, 0xf0, 0x57, 0xc2, 0x5f,
+	     0x12, 0x7f, 0x81, 0xfc, 0x85, 0xf2, 0xd7, 0xcb, 0x5f, 0x34,
+	     0x7f, 0xed, 0xfc, 0x15, 0xf4, 0x97, 0xd2, 0x5f, 0x53, 0x7f,
+	     0x55, 0xfd, 0x25, 0xf6, 0x57, 0xdb, 0x5f, 0x76, 0x7f, 0x11,
+	     0xfe, 0x85, 0xf8, 0x57, 0xe3, 0x5f, 0x90, 0x7f, 0x51, 0xfe,
+	     0x05, 0xfa, 0x97, 0xe9, 0x5f, 0xb4, 0x7f, 0xfd, 0xfe, 0x35,
+	     0xfc, 0xd7, 0xf3, 0x5f, 0xd5, 0x7f, 0x79, 0xff, 0x45, 0xfe,
+	     0x97, 0xfc, 0x5f, 0xf4, 0x7f, 0xed, 0xff, 0x55, 0x00, 0x98,
+	     0x03, 0x60, 0x18, 0x80, 0x71, 0x00, 0x06, 0x02, 0x58, 0x0a,
+	     0x60, 0x31, 0x80, 0xfd, 0x00, 0x56, 0x04, 0x58, 0x14, 0x60,
+	     0x5e, 0x80, 0xad, 0x01, 0x26, 0x07, 0x18, 0x1f, 0x60, 0x87,
+	     0x80, 0x39, 0x02, 0x36, 0x09, 0x18, 0x27, 0x60, 0xa9, 0x80,
+	     0xc1, 0x02, 0x66, 0x0b, 0xd8, 0x2e, 0x60, 0xc4, 0x80, 0x31,
+	     0x03, 0xa6, 0x0d, 0x98, 0x39, 0x60, 0xf1, 0x80, 0xf5, 0x03,
+	     0xf6, 0x0f, 0x18, 0x43, 0x60, 0x17, 0x81, 0x91, 0x04, 0x26,
+	     0x13, 0x58, 0x4f, 0x60, 0x42, 0x81, 0x2d, 0x05, 0x66, 0x15,
+	     0x18, 0x59, 0x60, 0x67, 0x81, 0xb9, 0x05, 0x46, 0x17, 0x18,
+	     0x60, 0x60, 0x87, 0x81, 0x4d, 0x06, 0x66, 0x19, 0x18, 0x69,
+	     0x60, 0xad, 0x81, 0xc1, 0x06, 0xb6, 0x1b, 0x98, 0x71, 0x60,
+	     0xce, 0x81, 0x65, 0x07, 0x66, 0x1e, 0x58, 0x7c, 0x60, 0xf5,
+	     0x81, 0xe1, 0x07, 0xd6, 0x1f, 0xd8, 0x80, 0x60, 0x0c, 0x82,
+	     0x51, 0x08, 0xf6, 0x21, 0x18, 0x8b, 0x60, 0x32, 0x82, 0xd9,
+	     0x08, 0x16, 0x24, 0x58, 0x93, 0x60, 0x4f, 0x82, 0x5d, 0x09,
+	     0xa6, 0x25, 0x98, 0x97, 0x60, 0x68, 0x82, 0xcd, 0x09, 0x96,
+	     0x27, 0x98, 0xa0, 0x60, 0x8e, 0x82, 0x5d, 0x0a, 0x06, 0x2a,
+	     0x58, 0xab, 0x60, 0xb4, 0x82, 0xe5, 0x0a, 0x56, 0x2c, 0x58,
+	     0xb3, 0x60, 0xd1, 0x82, 0x6d, 0x0b, 0xf6, 0x2d, 0x58, 0xbb,
+	     0x60, 0xf5, 0x82, 0x09, 0x0c, 0xc6, 0x30, 0xd8, 0xc4, 0x60,
+	     0x1b, 0x83, 0x95, 0x0c, 0x76, 0x32, 0x98, 0xcc, 0x60, 0x3d,
+	     0x83, 0x15, 0x0d, 0x16, 0x35, 0xd8, 0xd5, 0x60, 0x5c, 0x83,
+	     0x89, 0x0d, 0x76, 0x36, 0x18, 0xdb, 0x60, 0x76, 0x83, 0x09,
+	     0x0e, 0x86, 0x38, 0x98, 0xe4, 0x60, 0x9e, 0x83, 0x9d, 0x0e,
+	     0x16, 0x3b, 0x58, 0xef, 0x60, 0xc7, 0x83, 0x41, 0x0f, 0xc6,
+	     0x3d, 0x98, 0xf8, 0x60, 0xf0, 0x83, 0xdd, 0x0f, 0xd6, 0x3f,
+	     0xd8, 0x00, 0x61, 0x0a, 0x84, 0x35, 0x10, 0x96, 0x41, 0x98,
+	     0x09, 0x61, 0x2e, 0x84, 0xd9, 0x10, 0x16, 0x44, 0xd8, 0x10,
+	     0x61, 0x48, 0x84, 0x31, 0x11, 0x76, 0x45, 0x98, 0x17, 0x61,
+	     0x68, 0x84, 0xc9, 0x11, 0x86, 0x47, 0xd8, 0x1e, 0x61, 0x85,
+	     0x84, 0x45, 0x12, 0xc6, 0x49, 0x18, 0x29, 0x61, 0xad, 0x84,
+	     0xd9, 0x12, 0xd6, 0x4b, 0x18, 0x30, 0x61, 0xc8, 0x84, 0x39,
+	     0x13, 0x66, 0x4d, 0x58, 0x36, 0x61, 0xe3, 0x84, 0xa5, 0x13,
+	     0x36, 0x4f, 0xd8, 0x3f, 0x61, 0x03, 0x85, 0x1d, 0x14, 0xd6,
+	     0x50, 0xd8, 0x46, 0x61, 0x20, 0x85, 0x8d, 0x14, 0x16, 0x53,
+	     0x98, 0x4e, 0x61, 0x3c, 0x85, 0x09, 0x15, 0xd6, 0x54, 0xd8,
+	     0x55, 0x61, 0x61, 0x85, 0x99, 0x15, 0x96, 0x56, 0xd8, 0x5b,
+	     0x61, 0x7b, 0x85, 0x15, 0x16, 0xf6, 0x58, 0x58, 0x65, 0x61,
+	     0x9f, 0x85, 0xa5, 0x16, 0xf6, 0x5a, 0x18, 0x6d, 0x61, 0xb9,
+	     0x85, 0xfd, 0x16, 0x36, 0x5c, 0xd8, 0x73, 0x61, 0xd5, 0x85,
+	     0x65, 0x17, 0x46, 0x5e, 0x98, 0x7b, 0x61, 0xfc, 0x85, 0xfd,
+	     0x17, 0x56, 0x60, 0x18, 0x83, 0x61, 0x0e, 0x86, 0x59, 0x18,
+	     0xb6, 0x61, 0x18, 0x8a, 0x61, 0x33, 0x86, 0xdd, 0x18, 0x56,
+	     0x64, 0x58, 0x93, 0x61, 0x5a, 0x86, 0x81, 0x19, 0x96, 0x66,
+	     0x58, 0x9d, 0x61, 0x7c, 0x86, 0x01, 0x1a, 0xa6, 0x68, 0x58,
+	     0xa3, 0x61, 0x95, 0x86, 0x8d, 0x1a, 0xc6, 0x6a, 0x98, 0xac,
+	     0x61, 0xbe, 0x86, 0x05, 0x1b, 0x96, 0x6c, 0x18, 0xb4, 0x61,
+	     0xd5, 0x86, 0x81, 0x1b, 0x86, 0x6e, 0x98, 0xbd, 0x61, 0xf8,
+	     0x86, 0x11, 0x1c, 0x96, 0x70, 0xd8, 0xc3, 0x61, 0x17, 0x87,
+	     0x8d, 0x1c, 0xf6, 0x72, 0x58, 0xcf, 0x61, 0x4b, 0x87, 0x5d,
+	     0x1d, 0xe6, 0x75, 0x58, 0xd9, 0x61, 0x70, 0x87, 0xe9, 0x1d,
+	     0x76, 0x78, 0xd8, 0xe3, 0x61, 0x98, 0x87, 0x7d, 0x1e, 0x86,
+	     0x7a, 0xd8, 0xea, 0x61, 0xb2, 0x87, 0xe5, 0x1e, 0xd6, 0x7b,
+	     0xd8, 0xf0, 0x61, 0xc8, 0x87, 0x35, 0x1f, 0x76, 0x7d, 0x98,
+	     0xf7, 0x61, 0xea, 0x87, 0xd9, 0x1f, 0xb6, 0x7f, 0x58, 0x01,
+	     0x62, 0x07, 0x88, 0x31, 0x20, 0x16, 0x81, 0xd8, 0x05, 0x62,
+	     0x21, 0x88, 0xbd, 0x20, 0x56, 0x83, 0xd8, 0x10, 0x62, 0x49,
+	     0x88, 0x59, 0x21, 0xd6, 0x85, 0x18, 0x1a, 0x62, 0x70, 0x88,
+	     0xd1, 0x21, 0xb6, 0x87, 0x98, 0x1f, 0x62, 0x84, 0x88, 0x45,
+	     0x22, 0x46, 0x89, 0xd8, 0x27, 0x62, 0xa6, 0x88, 0xa9, 0x22,
+	     0xf6, 0x8a, 0xd8, 0x2e, 0x62, 0xc6, 0x88, 0x4d, 0x23, 0x96,
+	     0x8d, 0x58, 0x39, 0x62, 0xed, 0x88, 0xe9, 0x23, 0xf6, 0x8f,
+	     0x18, 0x42, 0x62, 0x13, 0x89, 0x85, 0x24, 0x36, 0x92, 0xd8,
+	     0x49, 0x62, 0x30, 0x89, 0xdd, 0x24, 0x56, 0x94, 0x18, 0x53,
+	     0x62, 0x59, 0x89, 0x9d, 0x25, 0x56, 0x97, 0x18, 0x5f, 0x62,
+	     0x80, 0x89, 0x29, 0x26, 0x86, 0x99, 0x18, 0x67, 0x62, 0xaa,
+	     0x89, 0xc1, 0x26, 0x86, 0x9b, 0x58, 0x70, 0x62, 0xc5, 0x89,
+	     0x3d, 0x27, 0x46, 0x9d, 0x58, 0x77, 0x62, 0xe5, 0x89, 0xa1,
+	     0x27, 0x16, 0x9f, 0x98, 0x7f, 0x62, 0x01, 0x8a, 0x21, 0x28,
+	     0x06, 0xa1, 0x58, 0x87, 0x62, 0x2b, 0x8a, 0xc9, 0x28, 0x76,
+	     0xa3, 0x58, 0x91, 0x62, 0x48, 0x8a, 0x2d, 0x29, 0xe6, 0xa4,
+	     0x18, 0x97, 0x62, 0x68, 0x8a, 0xc5, 0x29, 0xf6, 0xa7, 0xd8,
+	     0xa2, 0x62, 0x92, 0x8a, 0x81, 0x2a, 0xd6, 0xaa, 0xd8, 0xad,
+	     0x62, 0xc3, 0x8a, 0x39, 0x2b, 0x76, 0xad, 0x58, 0xb7, 0x62,
+	     0xe9, 0x8a, 0xd1, 0x2b, 0xb6, 0xaf, 0x98, 0xbf, 0x62, 0x03,
+	     0x8b, 0x29, 0x2c, 0xc6, 0xb0, 0x58, 0xc5, 0x62, 0x22, 0x8b,
+	     0xa5, 0x2c, 0xd6, 0xb2, 0x58, 0xce, 0x62, 0x46, 0x8b, 0x4d,
+	     0x2d, 0xd6, 0xb5, 0x58, 0xd9, 0x62, 0x6b, 0x8b, 0xc9, 0x2d,
+	     0x56, 0xb7, 0x98, 0xdf, 0x62, 0x89, 0x8b, 0x55, 0x2e, 0x36,
+	     0xba, 0x98, 0xea, 0x62, 0xb0, 0x8b, 0xd1, 0x2e, 0xb6, 0xbb,
+	     0x58, 0xf2, 0x62, 0xd2, 0x8b, 0x71, 0x2f, 0x16, 0xbe, 0x18,
+	     0xf9, 0x62, 0xec, 0x8b, 0xbd, 0x2f, 0x76, 0xbf, 0x18, 0x00,
+	     0x63, 0x02, 0x8c, 0x25, 0x30, 0x66, 0xc1, 0x18, 0x07, 0x63,
+	     0x29, 0x8c, 0xb1, 0x30, 0x56, 0xc3, 0x18, 0x0f, 0x63, 0x44,
+	     0x8c, 0x3d, 0x31, 0xa6, 0xc5, 0x58, 0x19, 0x63, 0x68, 0x8c,
+	     0xb9, 0x31, 0x26, 0xc7, 0x18, 0x1e, 0x63, 0x86, 0x8c, 0x41,
+	     0x32, 0x86, 0xc9, 0x58, 0x28, 0x63, 0xa6, 0x8c, 0xa9, 0x32,
+	     0x46, 0xcb, 0xd8, 0x2f, 0x63, 0xc8, 0x8c, 0x29, 0x33, 0x66,
+	     0xcd, 0x98, 0x37, 0x63, 0xe8, 0x8c, 0xcd, 0x33, 0xd6, 0xcf,
+	     0x98, 0x42, 0x63, 0x13, 0x8d, 0x7d, 0x34, 0xd6, 0xd2, 0x58,
+	     0x4e, 0x63, 0x43, 0x8d, 0x31, 0x35, 0x56, 0xd5, 0xd8, 0x56,
+	     0x63, 0x62, 0x8d, 0x99, 0x35, 0x36, 0xd7, 0x98, 0x5d, 0x63,
+	     0x7e, 0x8d, 0x31, 0x36, 0x46, 0xd9, 0x58, 0x68, 0x63, 0xaa,
+	     0x8d, 0xd9, 0x36, 0xd6, 0xdb, 0x98, 0x70, 0x63, 0xcc, 0x8d,
+	     0x5d, 0x37, 0x56, 0xde, 0xd8, 0x79, 0x63, 0xea, 0x8d, 0xc5,
+	     0x37, 0xd6, 0xdf, 0x58, 0x80, 0x63, 0x0c, 0x8e, 0x51, 0x38,
+	     0xd6, 0xe1, 0xd8, 0x89, 0x63, 0x30, 0x8e, 0xd5, 0x38, 0xc6,
+	     0xe3, 0x58, 0x90, 0x63, 0x4b, 0x8e, 0x5d, 0x39, 0x06, 0xe6,
+	     0x18, 0x9b, 0x63, 0x70, 0x8e, 0xd1, 0x39, 0xa6, 0xe7, 0xd8,
+	     0xa0, 0x63, 0x88, 0x8e, 0x35, 0x3a, 0xf6, 0xe8, 0xd8, 0xa5,
+	     0x63, 0x9e, 0x8e, 0xa1, 0x3a, 0x06, 0xeb, 0xd8, 0xad, 0x63,
+	     0xbe, 0x8e, 0x19, 0x3b, 0x26, 0xed, 0x98, 0xb5, 0x63, 0xdd,
+	     0x8e, 0x81, 0x3b, 0x36, 0xee, 0x18, 0xbc, 0x63, 0xf7, 0x8e,
+	     0x01, 0x3c, 0xd6, 0xf0, 0x98, 0xc5, 0x63, 0x1a, 0x8f, 0x85,
+	     0x3c, 0xd6, 0xf2, 0x58, 0xcd, 0x63, 0x39, 0x8f, 0xf1, 0x3c,
+	     0x76, 0xf4, 0x18, 0xd5, 0x63, 0x5b, 0x8f, 0x99, 0x3d, 0xf6,
+	     0xf6, 0x58, 0xdd, 0x63, 0x77, 0x8f, 0x01, 0x3e, 0xd6, 0xf8,
+	     0x18, 0xe4, 0x63, 0x97, 0x8f, 0x6d, 0x3e, 0x46, 0xfa, 0xd8,
+	     0xeb, 0x63, 0xb5, 0x8f, 0xe5, 0x3e, 0x76, 0xfc, 0x98, 0xf3,
+	     0x63, 0xd2, 0x8f, 0x55, 0x3f, 0x96, 0xfd, 0xd8, 0xf7, 0x63,
+	     0xe4, 0x8f, 0x9d, 0x3f, 0x26, 0xff, 0xd8, 0xff, 0x63, 0x07,
+	     0x90, 0x41, 0x40, 0x66, 0x01, 0x99, 0x07, 0x64, 0x2b, 0x90,
+	     0xdd, 0x40, 0xa6, 0x03, 0x59, 0x0f, 0x64, 0x46, 0x90, 0x2d,
+	     0x41, 0x36, 0x05, 0x99, 0x17, 0x64, 0x65, 0x90, 0xc9, 0x41,
+	     0x06, 0x08, 0x59, 0x23, 0x64, 0x9a, 0x90, 0x81, 0x42, 0x26,
+	     0x0a, 0x99, 0x2a, 0x64, 0xb8, 0x90, 0x09, 0x43, 0xf6, 0x0c,
+	     0x99, 0x35, 0x64, 0xe4, 0x90, 0xa9, 0x43, 0xf6, 0x0e, 0x19,
+	     0x3d, 0x64, 0xfd, 0x90, 0x29, 0x44, 0x86, 0x11, 0x59, 0x47,
+	     0x64, 0x29, 0x91, 0xc1, 0x44, 0x36, 0x13, 0x19, 0x4f, 0x64,
+	     0x3f, 0x91, 0x29, 0x45, 0x26, 0x15, 0x99, 0x55, 0x64, 0x5b,
+	     0x91, 0x9d, 0x45, 0x06, 0x17, 0x19, 0x5e, 0x64, 0x84, 0x91,
+	     0x21, 0x46, 0xb6, 0x18, 0x19, 0x66, 0x64, 0x9f, 0x91, 0xa5,
+	     0x46, 0xf6, 0x1a, 0xd9, 0x6c, 0x64, 0xbb, 0x91, 0x1d, 0x47,
+	     0xa6, 0x1c, 0x99, 0x75, 0x64, 0xe2, 0x91, 0xc1, 0x47, 0x26,
+	     0x1f, 0x99, 0x7d, 0x64, 0x01, 0x92, 0x29, 0x48, 0x06, 0x21,
+	     0x59, 0x87, 0x64, 0x2b, 0x92, 0xcd, 0x48, 0xe6, 0x23, 0x19,
+	     0x91, 0x64, 0x4b, 0x92, 0x41, 0x49, 0xa6, 0x25, 0xd9, 0x97,
+	     0x64, 0x6c, 0x92, 0xdd, 0x49, 0xd6, 0x27, 0x99, 0xa2, 0x64,
+	     0x97, 0x92, 0x8d, 0x4a, 0x66, 0x2a, 0x99, 0xaa, 0x64, 0xb1,
+	     0x92, 0xf1, 0x4a, 0x56, 0x2c, 0x99, 0xb2, 0x64, 0xd4, 0x92,
+	     0x69, 0x4b, 0xf6, 0x2d, 0x99, 0xb8, 0x64, 0xee, 0x92, 0xc5,
+	     0x4b, 0x86, 0x2f, 0x99, 0xc1, 0x64, 0x0c, 0x93, 0x3d, 0x4c,
+	     0x56, 0x31, 0x99, 0xc7, 0x64, 0x22, 0x93, 0x91, 0x4c, 0xc6,
+	     0x32, 0x59, 0xcd, 0x64, 0x3e, 0x93, 0x29, 0x4d, 0x06, 0x35,
+	     0x59, 0xd6, 0x64, 0x5f, 0x93, 0x95, 0x4d, 0xe6, 0x36, 0x19,
+	     0xde, 0x64, 0x83, 0x93, 0x31, 0x4e, 0xf6, 0x38, 0xd9, 0xe6,
+	     0x64, 0xa0, 0x93, 0xb9, 0x4e, 0x26, 0x3b, 0xd9, 0xef, 0x64,
+	     0xcc, 0x93, 0x5d, 0x4f, 0x06, 0x3e, 0xd9, 0xf9, 0x64, 0xf0,
+	     0x93, 0xf5, 0x4f, 0x86, 0x40, 0x59, 0x04, 0x65, 0x14, 0x94,
+	     0x5d, 0x50, 0xb6, 0x41, 0xd9, 0x09, 0x65, 0x2f, 0x94, 0xf1,
+	     0x50, 0x46, 0x44, 0x59, 0x12, 0x65, 0x4e, 0x94, 0x51, 0x51,
+	     0x96, 0x45, 0x19, 0x18, 0x65, 0x6a, 0x94, 0xc5, 0x51, 0x46,
+	     0x47, 0x99, 0x1f, 0x65, 0x8b, 0x94, 0x4d, 0x52, 0x06, 0x4a,
+	     0x19, 0x2b, 0x65, 0xb4, 0x94, 0xe1, 0x52, 0xf6, 0x4b, 0x99,
+	     0x31, 0x65, 0xd1, 0x94, 0x5d, 0x53, 0xd6, 0x4d, 0x19, 0x39,
+	     0x65, 0xed, 0x94, 0xc5, 0x53, 0xa6, 0x4f, 0x19, 0x42, 0x65,
+	     0x0d, 0x95, 0x59, 0x54, 0xc6, 0x51, 0x59, 0x4a, 0x65, 0x32,
+	     0x95, 0xf1, 0x54, 0xf6, 0x53, 0x19, 0x53, 0x65, 0x51, 0x95,
+	     0x69, 0x55, 0x26, 0x56, 0x59, 0x59, 0x65, 0x6c, 0x95, 0xd5,
+	     0x55, 0x26, 0x58, 0x59, 0x62, 0x65, 0x90, 0x95, 0x71, 0x56,
+	     0x46, 0x5a, 0x59, 0x6b, 0x65, 0xb8, 0x95, 0xfd, 0x56, 0xb6,
+	     0x5c, 0xd9, 0x73, 0x65, 0xd3, 0x95, 0x5d, 0x57, 0x56, 0x5e,
+	     0x99, 0x7b, 0x65, 0xf7, 0x95, 0x15, 0x58, 0x06, 0x61, 0x99,
+	     0x85, 0x65, 0x1c, 0x96, 0x91, 0x58, 0x76, 0x62, 0x59, 0x8d,
+	     0x65, 0x39, 0x96, 0x1d, 0x59, 0xe6, 0x64, 0x99, 0x96, 0x65,
+	     0x66, 0x96, 0xa9, 0x59, 0x66, 0x67, 0x59, 0x9f, 0x65, 0x7f,
+	     0x96, 0x21, 0x5a, 0xb6, 0x68, 0x59, 0xa6, 0x65, 0xa6, 0x96,
+	     0xb9, 0x5a, 0x86, 0x6b, 0x19, 0xaf, 0x65, 0xc5, 0x96, 0x2d,
+	     0x5b, 0x86, 0x6d, 0x19, 0xb9, 0x65, 0xf0, 0x96, 0xe5, 0x5b,
+	     0x36, 0x70, 0x19, 0xc4, 0x65, 0x13, 0x97, 0x65, 0x5c, 0xf6,
+	     0x71, 0x59, 0xc9, 0x65, 0x30, 0x97, 0xf1, 0x5c, 0x86, 0x74,
+	     0xd9, 0xd4, 0x65, 0x5a, 0x97, 0x95, 0x5d, 0xc6, 0x76, 0x19,
+	     0xde, 0x65, 0x80, 0x97, 0x39, 0x5e, 0xc6, 0x79, 0x59, 0xe9,
+	     0x65, 0xa8, 0x97, 0xc5, 0x5e, 0x66, 0x7b, 0x99, 0xf0, 0x65,
+	     0xc7, 0x97, 0x55, 0x5f, 0x26, 0x7e, 0x19, 0xfc, 0x65, 0xf6,
+	     0x97, 0xf5, 0x5f, 0x66, 0x80, 0x19, 0x05, 0x66, 0x1e, 0x98,
+	     0x85, 0x60, 0xb6, 0x82, 0x59, 0x0c, 0x66, 0x3a, 0x98, 0x0d,
+	     0x61, 0xe6, 0x84, 0x59, 0x16, 0x66, 0x64, 0x98, 0xb5, 0x61,
+	     0x96, 0x87, 0x59, 0x1f, 0x66, 0x89, 0x98, 0x4d, 0x62, 0x66,
+	     0x89, 0x19, 0x29, 0x66, 0xa8, 0x98, 0xd5, 0x62, 0xe6, 0x8b,
+	     0x19, 0x32, 0x66, 0xce, 0x98, 0x41, 0x63, 0x76, 0x8d, 0x99,
+	     0x38, 0x66, 0xeb, 0x98, 0xdd, 0x63, 0x46, 0x90, 0x59, 0x44,
+	     0x66, 0x1f, 0x99, 0x99, 0x64, 0xd6, 0x92, 0x19, 0x4c, 0x66,
+	     0x3d, 0x99, 0x05, 0x65, 0xf6, 0x94, 0x59, 0x56, 0x66, 0x5f,
+	     0x99, 0x99, 0x65, 0xc6, 0x96, 0x19, 0x5c, 0x66, 0x7c, 0x99,
+	     0x11, 0x66, 0x66, 0x98, 0x99, 0x63, 0x66, 0x93, 0x99, 0x85,
+	     0x66, 0x86, 0x9a, 0x99, 0x6b, 0x66, 0xb2, 0x99, 0xf1, 0x66,
+	     0x36, 0x9c, 0x19, 0x72, 0x66, 0xcb, 0x99, 0x51, 0x67, 0x76,
+	     0x9d, 0x99, 0x78, 0x66, 0xe5, 0x99, 0xc5, 0x67, 0x96, 0x9f,
+	     0x59, 0x7f, 0x66, 0x04, 0x9a, 0x3d, 0x68, 0xc6, 0xa1, 0xd9,
+	     0x89, 0x66, 0x29, 0x9a, 0xb5, 0x68, 0x16, 0xa3, 0x19, 0x8f,
+	     0x66, 0x40, 0x9a, 0x11, 0x69, 0x06, 0xa5, 0x99, 0x96, 0x66,
+	     0x64, 0x9a, 0xa9, 0x69, 0x06, 0xa7, 0x19, 0x9d, 0x66, 0x81,
+	     0x9a, 0x15, 0x6a, 0xb6, 0xa8, 0x59, 0xa4, 0x66, 0x9f, 0x9a,
+	     0xa1, 0x6a, 0x46, 0xab, 0x59, 0xaf, 0x66, 0xc3, 0x9a, 0x35,
+	     0x6b, 0x66, 0xad, 0x99, 0xb8, 0x66, 0xf0, 0x9a, 0xf1, 0x6b,
+	     0x36, 0xb0, 0x59, 0xc1, 0x66, 0x09, 0x9b, 0x5d, 0x6c, 0xf6,
+	     0xb1, 0xd9, 0xca, 0x66, 0x38, 0x9b, 0xf5, 0x6c, 0xa6, 0xb4,
+	     0x99, 0xd4, 0x66, 0x5b, 0x9b, 0x91, 0x6d, 0xe6, 0xb6, 0xd9,
+	     0xde, 0x66, 0x81, 0x9b, 0x25, 0x6e, 0xc6, 0xb8, 0x59, 0xe6,
+	     0x66, 0xa4, 0x9b, 0xb9, 0x6e, 0x76, 0xbb, 0x19, 0xef, 0x66,
+	     0xc9, 0x9b, 0x41, 0x6f, 0x46, 0xbd, 0x19, 0xf8, 0x66, 0xec,
+	     0x9b, 0xe9, 0x6f, 0x36, 0xc0, 0x19, 0x02, 0x67, 0x0c, 0x9c,
+	     0x69, 0x70, 0xe6, 0xc1, 0x59, 0x0a, 0x67, 0x2e, 0x9c, 0xf1,
+	     0x70, 0x46, 0xc4, 0x99, 0x11, 0x67, 0x50, 0x9c, 0x4d, 0x71,
+	     0xc6, 0xc5, 0x59, 0x1a, 0x67, 0x6d, 0x9c, 0xc1, 0x71, 0x86,
+	     0xc7, 0xd9, 0x20, 0x67, 0x8a, 0x9c, 0x4d, 0x72, 0x66, 0xc9,
+	     0x19, 0x28, 0x67, 0xae, 0x9c, 0xe1, 0x72, 0x06, 0xcc, 0x59,
+	     0x32, 0x67, 0xd3, 0x9c, 0x71, 0x73, 0xf6, 0xcd, 0x99, 0x3a,
+	     0x67, 0xec, 0x9c, 0xc5, 0x73, 0xb6, 0xcf, 0x59, 0x42, 0x67,
+	     0x17, 0x9d, 0x89, 0x74, 0x86, 0xd2, 0xd9, 0x4b, 0x67, 0x35,
+	     0x9d, 0xed, 0x74, 0x86, 0xd4, 0xd9, 0x53, 0x67, 0x5c, 0x9d,
+	     0x9d, 0x75, 0xe6, 0xd6, 0x19, 0x5e, 0x67, 0x81, 0x9d, 0x1d,
+	     0x76, 0xd6, 0xd8, 0xd9, 0x64, 0x67, 0x98, 0x9d, 0x91, 0x76,
+	     0x16, 0xdb, 0x19, 0x6d, 0x67, 0xba, 0x9d, 0x19, 0x77, 0x16,
+	     0xdd, 0x19, 0x75, 0x67, 0xde, 0x9d, 0x85, 0x77, 0xd6, 0xde,
+	     0xd9, 0x7d, 0x67, 0xfb, 0x9d, 0x25, 0x78, 0x16, 0xe1, 0x59,
+	     0x87, 0x67, 0x1f, 0x9e, 0xb5, 0x78, 0xb6, 0xe3, 0x19, 0x90,
+	     0x67, 0x4c, 0x9e, 0x45, 0x79, 0x46, 0xe5, 0x19, 0x98, 0x67,
+	     0x69, 0x9e, 0xd9, 0x79, 0x36, 0xe8, 0xd9, 0xa3, 0x67, 0x9d,
+	     0x9e, 0x95, 0x7a, 0xc6, 0xea, 0x19, 0xae, 0x67, 0xbc, 0x9e,
+	     0x15, 0x7b, 0xa6, 0xec, 0x99, 0xb3, 0x67, 0xd3, 0x9e, 0x6d,
+	     0x7b, 0x86, 0xee, 0x19, 0xbc, 0x67, 0xf3, 0x9e, 0xf1, 0x7b,
+	     0x46, 0xf0, 0x19, 0xc3, 0x67, 0x0f, 0x9f, 0x49, 0x7c, 0xa6,
+	     0xf1, 0x19, 0xca, 0x67, 0x2f, 0x9f, 0xe1, 0x7c, 0xc6, 0xf3,
+	     0x59, 0xd0, 0x67, 0x44, 0x9f, 0x45, 0x7d, 0xf6, 0xf5, 0x99,
+	     0xd8, 0x67, 0x66, 0x9f, 0xa1, 0x7d, 0xd6, 0xf6, 0x59, 0xde,
+	     0x67, 0x86, 0x9f, 0x35, 0x7e, 0x46, 0xf9, 0x99, 0xe8, 0x67,
+	     0xac, 0x9f, 0xe9, 0x7e, 0x86, 0xfc, 0x59, 0xf3, 0x67, 0xd9,
+	     0x9f, 0x81, 0x7f, 0x46, 0xfe, 0x59, 0xfa, 0x67, 0xf2, 0x9f,
+	     0xf5, 0x7f, 0x76, 0x00, 0x5a, 0x05, 0x68, 0x18, 0xa0, 0x75,
+	     0x80, 0xa6, 0x02, 0x1a, 0x0c, 0x68, 0x35, 0xa0, 0xf9, 0x80,
+	     0x16, 0x04, 0x9a, 0x12, 0x68, 0x53, 0xa0, 0x75, 0x81, 0xa6,
+	     0x06, 0x1a, 0x1c, 0x68, 0x7e, 0xa0, 0x09, 0x82, 0x06, 0x09,
+	     0xda, 0x24, 0x68, 0xa1, 0xa0, 0xbd, 0x82, 0x16, 0x0b, 0xda,
+	     0x2e, 0x68, 0xc8, 0xa0, 0x39, 0x83, 0x16, 0x0d, 0x5a, 0x35,
+	     0x68, 0xe1, 0xa0, 0xb9, 0x83, 0x86, 0x0f, 0xda, 0x3f, 0x68,
+	     0x06, 0xa1, 0x39, 0x84, 0x96, 0x11, 0xda, 0x49, 0x68, 0x30,
+	     0xa1, 0xd5, 0x84, 0x26, 0x14, 0x5a, 0x53, 0x68, 0x56, 0xa1,
+	     0x65, 0x85, 0xf6, 0x15, 0x9a, 0x5a, 0x68, 0x77, 0xa1, 0xf5,
+	     0x85, 0x36, 0x18, 0x9a, 0x63, 0x68, 0x90, 0xa1, 0x75, 0x86,
+	     0x26, 0x1a, 0x9a, 0x6b, 0x68, 0xb5, 0xa1, 0xe9, 0x86, 0xf6,
+	     0x1b, 0x1a, 0x73, 0x68, 0xda, 0xa1, 0x9d, 0x87, 0x16, 0x1f,
+	     0x5a, 0x7e, 0x68, 0x06, 0xa2, 0x45, 0x88, 0xa6, 0x21, 0x5a,
+	     0x88, 0x68, 0x2f, 0xa2, 0xed, 0x88, 0x06, 0x24, 0xda, 0x91,
+	     0x68, 0x4d, 0xa2, 0x69, 0x89, 0x66, 0x26, 0x5a, 0x9b, 0x68,
+	     0x76, 0xa2, 0xf1, 0x89, 0x16, 0x28, 0x9a, 0xa1, 0x68, 0x94,
+	     0xa2, 0x59, 0x8a, 0xd6, 0x29, 0xda, 0xa8, 0x68, 0xae, 0xa2,
+	     0xd9, 0x8a, 0x06, 0x2c, 0xda, 0xb1, 0x68, 0xcf, 0xa2, 0x71,
+	     0x8b, 0xa6, 0x2e, 0x1a, 0xbd, 0x68, 0xf9, 0xa2, 0x05, 0x8c,
+	     0xf6, 0x30, 0x9a, 0xc4, 0x68, 0x19, 0xa3, 0x81, 0x8c, 0x66,
+	     0x32, 0x5a, 0xcb, 0x68, 0x35, 0xa3, 0xed, 0x8c, 0x46, 0x34,
+	     0xda, 0xd3, 0x68, 0x58, 0xa3, 0x7d, 0x8d, 0xd6, 0x36, 0x5a,
+	     0xdc, 0x68, 0x7a, 0xa3, 0x05, 0x8e, 0x66, 0x38, 0x5a, 0xe3,
+	     0x68, 0x93, 0xa3, 0x69, 0x8e, 0x46, 0x3a, 0xda, 0xeb, 0x68,
+	     0xba, 0xa3, 0x05, 0x8f, 0x36, 0x3c, 0x1a, 0xf2, 0x68, 0xd5,
+	     0xa3, 0x75, 0x8f, 0x46, 0x3e, 0x9a, 0xfb, 0x68, 0xf3, 0xa3,
+	     0xf9, 0x8f, 0x46, 0x40, 0xda, 0x02, 0x69, 0x16, 0xa4, 0x69,
+	     0x90, 0x16, 0x42, 0x9a, 0x0a, 0x69, 0x2d, 0xa4, 0xe9, 0x90,
+	     0xd6, 0x43, 0xda, 0x10, 0x69, 0x4d, 0xa4, 0x59, 0x91, 0xf6,
+	     0x45, 0x9a, 0x19, 0x69, 0x6b, 0xa4, 0xc9, 0x91, 0xc6, 0x47,
+	     0x5a, 0x22, 0x69, 0x94, 0xa4, 0x79, 0x92, 0x16, 0x4a, 0xda,
+	     0x2b, 0x69, 0xbc, 0xa4, 0xf9, 0x92, 0x66, 0x4c, 0x9a, 0x34,
+	     0x69, 0xd6, 0xa4, 0x79, 0x93, 0x86, 0x4e, 0x9a, 0x3c, 0x69,
+	     0xfb, 0xa4, 0x09, 0x94, 0x86, 0x50, 0x1a, 0x43, 0x69, 0x18,
+	     0xa5, 0x6d, 0x94, 0x46, 0x52, 0xda, 0x4b, 0x69, 0x36, 0xa5,
+	     0x05, 0x95, 0xa6, 0x54, 0x9a, 0x53, 0x69, 0x53, 0xa5, 0x85,
+	     0x95, 0xf6, 0x56, 0x1a, 0x5f, 0x69, 0x7e, 0xa5, 0x29, 0x96,
+	     0x56, 0x59, 0x9a, 0x68, 0x69, 0xaf, 0xa5, 0xe5, 0x96, 0x36,
+	     0x5c, 0x5a, 0x73, 0x69, 0xd4, 0xa5, 0x75, 0x97, 0x66, 0x5e,
+	     0xda, 0x7a, 0x69, 0xf4, 0xa5, 0xed, 0x97, 0x26, 0x60, 0xda,
+	     0x81, 0x69, 0x0a, 0xa6, 0x4d, 0x98, 0x16, 0x62, 0xda, 0x89,
+	     0x69, 0x31, 0xa6, 0xf1, 0x98, 0x06, 0x64, 0x5a, 0x92, 0x69,
+	     0x56, 0xa6, 0x6d, 0x99, 0x16, 0x66, 0x9a, 0x99, 0x69, 0x69,
+	     0xa6, 0xdd, 0x99, 0x96, 0x67, 0x1a, 0x9f, 0x69, 0x81, 0xa6,
+	     0x1d, 0x9a, 0xf6, 0x68, 0x1a, 0xa7, 0x69, 0xa9, 0xa6, 0xd1,
+	     0x9a, 0x86, 0x6b, 0x1a, 0xb1, 0x69, 0xc7, 0xa6, 0x55, 0x9b,
+	     0x86, 0x6d, 0x1a, 0xb7, 0x69, 0xe1, 0xa6, 0xb1, 0x9b, 0x86,
+	     0x6f, 0x1a, 0xbf, 0x69, 0x09, 0xa7, 0x51, 0x9c, 0x76, 0x71,
+	     0x1a, 0xc8, 0x69, 0x2b, 0xa7, 0xe1, 0x9c, 0xd6, 0x73, 0xda,
+	     0xd0, 0x69, 0x4b, 0xa7, 0x65, 0x9d, 0x76, 0x76, 0x1a, 0xdd,
+	     0x69, 0x7f, 0xa7, 0x11, 0x9e, 0xc6, 0x78, 0x9a, 0xe6, 0x69,
+	     0xa5, 0xa7, 0xb5, 0x9e, 0x66, 0x7b, 0x5a, 0xf0, 0x69, 0xc8,
+	     0xa7, 0x3d, 0x9f, 0xc6, 0x7d, 0x9a, 0xf7, 0x69, 0xe3, 0xa7,
+	     0xb9, 0x9f, 0x76, 0x7f, 0xda, 0xfe, 0x69, 0x00, 0xa8, 0x31,
+	     0xa0, 0x96, 0x81, 0x5a, 0x07, 0x6a, 0x22, 0xa8, 0xbd, 0xa0,
+	     0x46, 0x83, 0xda, 0x0f, 0x6a, 0x48, 0xa8, 0x2d, 0xa1, 0x96,
+	     0x85, 0x9a, 0x18, 0x6a, 0x6e, 0xa8, 0xe1, 0xa1, 0xf6, 0x87,
+	     0x9a, 0x21, 0x6a, 0x93, 0xa8, 0x6d, 0xa2, 0x66, 0x8a, 0x9a,
+	     0x2b, 0x6a, 0xbb, 0xa8, 0x15, 0xa3, 0x86, 0x8c, 0x5a, 0x33,
+	     0x6a, 0xda, 0xa8, 0x75, 0xa3, 0x36, 0x8e, 0x5a, 0x39, 0x6a,
+	     0xeb, 0xa8, 0xd1, 0xa3, 0x76, 0x8f, 0x1a, 0x3f, 0x6a, 0x0a,
+	     0xa9, 0x4d, 0xa4, 0xc6, 0x91, 0x1a, 0x4a, 0x6a, 0x35, 0xa9,
+	     0xf9, 0xa4, 0x86, 0x94, 0x5a, 0x54, 0x6a, 0x5e, 0xa9, 0x9d,
+	     0xa5, 0xd6, 0x96, 0xda, 0x5c, 0x6a, 0x7e, 0xa9, 0x15, 0xa6,
+	     0x16, 0x99, 0xda, 0x66, 0x6a, 0xa5, 0xa9, 0xc9, 0xa6, 0xc6,
+	     0x9b, 0x9a, 0x70, 0x6a, 0xcc, 0xa9, 0x41, 0xa7, 0xc6, 0x9d,
+	     0x5a, 0x78, 0x6a, 0xe6, 0xa9, 0xc5, 0xa7, 0xc6, 0x9f, 0x5a,
+	     0x80, 0x6a, 0x0a, 0xaa, 0x49, 0xa8, 0x06, 0xa2, 0x9a, 0x88,
+	     0x6a, 0x29, 0xaa, 0xc5, 0xa8, 0x96, 0xa3, 0x5a, 0x90, 0x6a,
+	     0x4d, 0xaa, 0x4d, 0xa9, 0x76, 0xa5, 0x1a, 0x97, 0x6a, 0x66,
+	     0xaa, 0xb9, 0xa9, 0x86, 0xa7, 0x9a, 0x9f, 0x6a, 0x83, 0xaa,
+	     0x25, 0xaa, 0x66, 0xa9, 0x9a, 0xa6, 0x6a, 0x9d, 0xaa, 0x91,
+	     0xaa, 0xd6, 0xaa, 0x1a, 0xad, 0x6a, 0xb8, 0xaa, 0x11, 0xab,
+	     0xe6, 0xac, 0xda, 0xb6, 0x6a, 0xe7, 0xaa, 0xbd, 0xab, 0x36,
+	     0xaf, 0x9a, 0xbf, 0x6a, 0x09, 0xab, 0x55, 0xac, 0x96, 0xb1,
+	     0xda, 0xc7, 0x6a, 0x21, 0xab, 0x99, 0xac, 0x16, 0xb3, 0x1a,
+	     0xcd, 0x6a, 0x3e, 0xab, 0x31, 0xad, 0x56, 0xb5, 0xda, 0xd7,
+	     0x6a, 0x68, 0xab, 0xcd, 0xad, 0x86, 0xb7, 0x1a, 0xdf, 0x6a,
+	     0x83, 0xab, 0x35, 0xae, 0x76, 0xb9, 0x5a, 0xe8, 0x6a, 0xad,
+	     0xab, 0xe9, 0xae, 0x16, 0xbc, 0xda, 0xf1, 0x6a, 0xca, 0xab,
+	     0x59, 0xaf, 0x96, 0xbd, 0x5a, 0xf9, 0x6a, 0xea, 0xab, 0xd1,
+	     0xaf, 0xe6, 0xbf, 0xda, 0x02, 0x6b, 0x17, 0xac, 0x89, 0xb0,
+	     0x06, 0xc3, 0x9a, 0x0f, 0x6b, 0x49, 0xac, 0x4d, 0xb1, 0x96,
+	     0xc5, 0x9a, 0x17, 0x6b, 0x66, 0xac, 0xb9, 0xb1, 0x36, 0xc7,
+	     0x5a, 0x1e, 0x6b, 0x7b, 0xac, 0x0d, 0xb2, 0x76, 0xc8, 0x5a,
+	     0x25, 0x6b, 0xa3, 0xac, 0xad, 0xb2, 0xe6, 0xca, 0xda, 0x2e,
+	     0x6b, 0xbe, 0xac, 0x09, 0xb3, 0xe6, 0xcc, 0x1a, 0x36, 0x6b,
+	     0xdc, 0xac, 0x7d, 0xb3, 0xb6, 0xce, 0x5a, 0x3c, 0x6b, 0xfb,
+	     0xac, 0x25, 0xb4, 0xc6, 0xd0, 0x1a, 0x46, 0x6b, 0x1f, 0xad,
+	     0xb1, 0xb4, 0x26, 0xd3, 0x9a, 0x4d, 0x6b, 0x43, 0xad, 0x15,
+	     0xb5, 0x16, 0xd5, 0x5a, 0x56, 0x6b, 0x62, 0xad, 0xb5, 0xb5,
+	     0x76, 0xd7, 0x1a, 0x60, 0x6b, 0x8b, 0xad, 0x3d, 0xb6, 0xd6,
+	     0xd9, 0x1a, 0x68, 0x6b, 0xad, 0xad, 0xc1, 0xb6, 0xc6, 0xdb,
+	     0x9a, 0x72, 0x6b, 0xd8, 0xad, 0x6d, 0xb7, 0x16, 0xde, 0xda,
+	     0x7b, 0x6b, 0xf2, 0xad, 0x01, 0xb8, 0x66, 0xe0, 0xda, 0x83,
+	     0x6b, 0x18, 0xae, 0x91, 0xb8, 0xc6, 0xe2, 0x9a, 0x8b, 0x6b,
+	     0x37, 0xae, 0xe9, 0xb8, 0x56, 0xe4, 0xda, 0x93, 0x6b, 0x56,
+	     0xae, 0x91, 0xb9, 0xd6, 0xe6, 0x5a, 0x9c, 0x6b, 0x7c, 0xae,
+	     0x09, 0xba, 0x56, 0xe8, 0x9a, 0xa3, 0x6b, 0x9a, 0xae, 0x95,
+	     0xba, 0x36, 0xeb, 0x9a, 0xaf, 0x6b, 0xc5, 0xae, 0x21, 0xbb,
+	     0x36, 0xed, 0x1a, 0xb6, 0x6b, 0xe0, 0xae, 0x91, 0xbb, 0xf6,
+	     0xee, 0x5a, 0xbf, 0x6b, 0x02, 0xaf, 0x29, 0xbc, 0xe6, 0xf0,
+	     0xda, 0xc5, 0x6b, 0x24, 0xaf, 0xc9, 0xbc, 0x46, 0xf3, 0xda,
+	     0xce, 0x6b, 0x44, 0xaf, 0x41, 0xbd, 0x76, 0xf5, 0xda, 0xd6,
+	     0x6b, 0x5f, 0xaf, 0x95, 0xbd, 0xc6, 0xf6, 0xda, 0xdd, 0x6b,
+	     0x80, 0xaf, 0x29, 0xbe, 0xe6, 0xf8, 0xda, 0xe5, 0x6b, 0xa0,
+	     0xaf, 0xb1, 0xbe, 0x66, 0xfb, 0x9a, 0xf0, 0x6b, 0xcf, 0xaf,
+	     0x71, 0xbf, 0xa6, 0xfe, 0x9a, 0xfd, 0x6b, 0xfe, 0xaf, 0x2d,
+	     0xc0, 0x16, 0x01, 0x5b, 0x07, 0x6c, 0x24, 0xb0, 0xc9, 0xc0,
+	     0x86, 0x03, 0x1b, 0x0f, 0x6c, 0x46, 0xb0, 0x25, 0xc1, 0x46,
+	     0x05, 0x9b, 0x17, 0x6c, 0x62, 0xb0, 0xa9, 0xc1, 0x06, 0x07,
+	     0x5b, 0x1e, 0x6c, 0x7f, 0xb0, 0x21, 0xc2, 0xd6, 0x08, 0xdb,
+	     0x26, 0x6c, 0xa8, 0xb0, 0xc9, 0xc2, 0xd6, 0x0b, 0x5b, 0x31,
+	     0x6c, 0xcb, 0xb0, 0x4d, 0xc3, 0xa6, 0x0d, 0x5b, 0x38, 0x6c,
+	     0xee, 0xb0, 0xe1, 0xc3, 0xe6, 0x0f, 0x5b, 0x40, 0x6c, 0x05,
+	     0xb1, 0x25, 0xc4, 0xd6, 0x10, 0x9b, 0x45, 0x6c, 0x1f, 0xb1,
+	     0xa9, 0xc4, 0xd6, 0x12, 0x1b, 0x4e, 0x6c, 0x3c, 0xb1, 0x21,
+	     0xc5, 0x06, 0x15, 0x5b, 0x56, 0x6c, 0x64, 0xb1, 0xb5, 0xc5,
+	     0xa6, 0x17, 0x1b, 0x62, 0x6c, 0x96, 0xb1, 0x89, 0xc6, 0xe6,
+	     0x1a, 0x5b, 0x6c, 0x6c, 0xb5, 0xb1, 0xe9, 0xc6, 0x86, 0x1c,
+	     0x5b, 0x74, 0x6c, 0xdc, 0xb1, 0x95, 0xc7, 0x36, 0x1f, 0x5b,
+	     0x7e, 0x6c, 0x02, 0xb2, 0x1d, 0xc8, 0x96, 0x20, 0x9b, 0x83,
+	     0x6c, 0x1b, 0xb2, 0x81, 0xc8, 0x86, 0x22, 0x1b, 0x8c, 0x6c,
+	     0x35, 0xb2, 0x0d, 0xc9, 0xc6, 0x24, 0xdb, 0x94, 0x6c, 0x59,
+	     0xb2, 0x85, 0xc9, 0xd6, 0x26, 0xdb, 0x9c, 0x6c, 0x77, 0xb2,
+	     0xed, 0xc9, 0x26, 0x28, 0xdb, 0xa1, 0x6c, 0x8c, 0xb2, 0x49,
+	     0xca, 0xd6, 0x29, 0x5b, 0xa8, 0x6c, 0xa4, 0xb2, 0xa1, 0xca,
+	     0xd6, 0x2a, 0x5b, 0xae, 0x6c, 0xc5, 0xb2, 0x3d, 0xcb, 0x56,
+	     0x2d, 0x1b, 0xb6, 0x6c, 0xe4, 0xb2, 0xc9, 0xcb, 0x86, 0x2f,
+	     0x1b, 0xc0, 0x6c, 0x02, 0xb3, 0x25, 0xcc, 0x56, 0x31, 0x1b,
+	     0xc6, 0x6c, 0x1c, 0xb3, 0x85, 0xcc, 0xe6, 0x32, 0x1b, 0xce,
+	     0x6c, 0x44, 0xb3, 0x1d, 0xcd, 0x46, 0x35, 0x1b, 0xd8, 0x6c,
+	     0x6c, 0xb3, 0xcd, 0xcd, 0xc6, 0x37, 0x9b, 0xe2, 0x6c, 0x92,
+	     0xb3, 0x61, 0xce, 0x66, 0x3a, 0xdb, 0xeb, 0x6c, 0xbb, 0xb3,
+	     0x15, 0xcf, 0xd6, 0x3c, 0x9b, 0xf6, 0x6c, 0xe4, 0xb3, 0xad,
+	     0xcf, 0x06, 0x3f, 0xdb, 0xfe, 0x6c, 0x02, 0xb4, 0x25, 0xd0,
+	     0xb6, 0x40, 0x1b, 0x05, 0x6d, 0x1b, 0xb4, 0x85, 0xd0, 0xa6,
+	     0x42, 0x5b, 0x0c, 0x6d, 0x3f, 0xb4, 0x1d, 0xd1, 0x56, 0x45,
+	     0x9b, 0x18, 0x6d, 0x69, 0xb4, 0xc5, 0xd1, 0x46, 0x47, 0x1b,
+	     0x1f, 0x6d, 0x84, 0xb4, 0x2d, 0xd2, 0x56, 0x49, 0x9b, 0x27,
+	     0x6d, 0xa6, 0xb4, 0xc1, 0xd2, 0xd6, 0x4b, 0x9b, 0x31, 0x6d,
+	     0xd2, 0xb4, 0x79, 0xd3, 0x26, 0x4e, 0x9b, 0x3a, 0x6d, 0xf5,
+	     0xb4, 0xfd, 0xd3, 0xa6, 0x50, 0x5b, 0x44, 0x6d, 0x1a, 0xb5,
+	     0xa1, 0xd4, 0xf6, 0x52, 0x9b, 0x4d, 0x6d, 0x38, 0xb5, 0x01,
+	     0xd5, 0x76, 0x54, 0x5b, 0x53, 0x6d, 0x55, 0xb5, 0x61, 0xd5,
+	     0x56, 0x56, 0x9b, 0x5b, 0x6d, 0x7c, 0xb5, 0x01, 0xd6, 0x66,
+	     0x58, 0x1b, 0x64, 0x6d, 0x93, 0xb5, 0x71, 0xd6, 0x46, 0x5a,
+	     0xdb, 0x6a, 0x6d, 0xb3, 0xb5, 0xed, 0xd6, 0xf6, 0x5b, 0x1b,
+	     0x71, 0x6d, 0xce, 0xb5, 0x65, 0xd7, 0x46, 0x5e, 0x9b, 0x7b,
+	     0x6d, 0xf0, 0xb5, 0xe9, 0xd7, 0x26, 0x60, 0x5b, 0x81, 0x6d,
+	     0x10, 0xb6, 0x4d, 0xd8, 0x96, 0x61, 0x1b, 0x88, 0x6d, 0x2a,
+	     0xb6, 0xdd, 0xd8, 0x46, 0x64, 0xdb, 0x93, 0x6d, 0x58, 0xb6,
+	     0x95, 0xd9, 0xe6, 0x66, 0x9b, 0x9e, 0x6d, 0x7f, 0xb6, 0x09,
+	     0xda, 0xc6, 0x68, 0x5b, 0xa6, 0x6d, 0xa5, 0xb6, 0xb1, 0xda,
+	     0x66, 0x6b, 0x1b, 0xb0, 0x6d, 0xc9, 0xb6, 0x55, 0xdb, 0xb6,
+	     0x6d, 0x5b, 0xb8, 0x6d, 0xeb, 0xb6, 0xe1, 0xdb, 0xc6, 0x6f,
+	     0x9b, 0xbf, 0x6d, 0x0c, 0xb7, 0x41, 0xdc, 0x76, 0x71, 0x9b,
+	     0xc7, 0x6d, 0x28, 0xb7, 0xb5, 0xdc, 0x46, 0x73, 0xdb, 0xce,
+	     0x6d, 0x47, 0xb7, 0x29, 0xdd, 0xf6, 0x74, 0xdb, 0xd4, 0x6d,
+	     0x5e, 0xb7, 0x89, 0xdd, 0x96, 0x76, 0xdb, 0xdb, 0x6d, 0x7a,
+	     0xb7, 0xf9, 0xdd, 0x46, 0x78, 0xdb, 0xe1, 0x6d, 0x93, 0xb7,
+	     0x75, 0xde, 0x06, 0x7a, 0xdb, 0xea, 0x6d, 0xb0, 0xb7, 0xd9,
+	     0xde, 0xf6, 0x7b, 0x5b, 0xf1, 0x6d, 0xca, 0xb7, 0x49, 0xdf,
+	     0x46, 0x7d, 0x9b, 0xf7, 0x6d, 0xe9, 0xb7, 0xc9, 0xdf, 0xc6,
+	     0x7f, 0x5b, 0x00, 0x6e, 0x06, 0xb8, 0x35, 0xe0, 0x26, 0x81,
+	     0x9b, 0x06, 0x6e, 0x24, 0xb8, 0xa5, 0xe0, 0x26, 0x83, 0x1b,
+	     0x0f, 0x6e, 0x43, 0xb8, 0x19, 0xe1, 0xb6, 0x84, 0x1b, 0x15,
+	     0x6e, 0x61, 0xb8, 0x95, 0xe1, 0x16, 0x87, 0xdb, 0x1f, 0x6e,
+	     0x83, 0xb8, 0x21, 0xe2, 0x26, 0x89, 0xdb, 0x25, 0x6e, 0xa1,
+	     0xb8, 0x91, 0xe2, 0xd6, 0x8a, 0x5b, 0x2e, 0x6e, 0xc0, 0xb8,
+	     0x39, 0xe3, 0x16, 0x8d, 0xdb, 0x37, 0x6e, 0xed, 0xb8, 0xd1,
+	     0xe3, 0x66, 0x8f, 0x9b, 0x3f, 0x6e, 0x0b, 0xb9, 0x61, 0xe4,
+	     0xe6, 0x91, 0x5b, 0x4a, 0x6e, 0x2f, 0xb9, 0xe1, 0xe4, 0xc6,
+	     0x93, 0x5b, 0x51, 0x6e, 0x51, 0xb9, 0x6d, 0xe5, 0xf6, 0x95,
+	     0xdb, 0x5a, 0x6e, 0x78, 0xb9, 0x09, 0xe6, 0x56, 0x98, 0x1b,
+	     0x62, 0x6e, 0x93, 0xb9, 0x71, 0xe6, 0x86, 0x9a, 0x5b, 0x6b,
+	     0x6e, 0xb6, 0xb9, 0x01, 0xe7, 0x46, 0x9c, 0x1b, 0x74, 0x6e,
+	     0xd4, 0xb9, 0x79, 0xe7, 0x96, 0x9e, 0xdb, 0x7d, 0x6e, 0xfe,
+	     0xb9, 0x01, 0xe8, 0xc6, 0xa0, 0x1b, 0x86, 0x6e, 0x1f, 0xba,
+	     0x9d, 0xe8, 0xd6, 0xa2, 0x1b, 0x8c, 0x6e, 0x37, 0xba, 0xf9,
+	     0xe8, 0x76, 0xa4, 0x9b, 0x92, 0x6e, 0x53, 0xba, 0x7d, 0xe9,
+	     0xc6, 0xa6, 0x9b, 0x9c, 0x6e, 0x7b, 0xba, 0x1d, 0xea, 0x06,
+	     0xa9, 0x5b, 0xa7, 0x6e, 0xa9, 0xba, 0xb5, 0xea, 0x36, 0xab,
+	     0x5b, 0xb0, 0x6e, 0xc8, 0xba, 0x4d, 0xeb, 0x16, 0xae, 0xdb,
+	     0xb9, 0x6e, 0xf1, 0xba, 0xed, 0xeb, 0x86, 0xb0, 0x1b, 0xc4,
+	     0x6e, 0x1d, 0xbb, 0x95, 0xec, 0x96, 0xb2, 0xdb, 0xcd, 0x6e,
+	     0x39, 0xbb, 0x11, 0xed, 0x06, 0xb5, 0x1b, 0xd7, 0x6e, 0x64,
+	     0xbb, 0xb5, 0xed, 0x96, 0xb7, 0x5b, 0xe0, 0x6e, 0x8b, 0xbb,
+	     0x55, 0xee, 0xd6, 0xb9, 0x5b, 0xea, 0x6e, 0xae, 0xbb, 0xe5,
+	     0xee, 0x56, 0xbc, 0x9b, 0xf4, 0x6e, 0xdf, 0xbb, 0x89, 0xef,
+	     0xc6, 0xbe, 0x1b, 0xfd, 0x6e, 0x01, 0xbc, 0x11, 0xf0, 0xd6,
+	     0xc0, 0x9b, 0x06, 0x6f, 0x27, 0xbc, 0xc1, 0xf0, 0x86, 0xc3,
+	     0xdb, 0x0e, 0x6f, 0x3f, 0xbc, 0x25, 0xf1, 0x56, 0xc5, 0xdb,
+	     0x18, 0x6f, 0x68, 0xbc, 0xb1, 0xf1, 0x46, 0xc7, 0x9b, 0x20,
+	     0x6f, 0x8a, 0xbc, 0x41, 0xf2, 0xb6, 0xc9, 0x5b, 0x27, 0x6f,
+	     0xa6, 0xbc, 0xa9, 0xf2, 0x66, 0xcb, 0x1b, 0x2f, 0x6f, 0xca,
+	     0xbc, 0x39, 0xf3, 0x76, 0xcd, 0xdb, 0x37, 0x6f, 0xed, 0xbc,
+	     0xe5, 0xf3, 0x16, 0xd0, 0x9b, 0x43, 0x6f, 0x19, 0xbd, 0x95,
+	     0xf4, 0xc6, 0xd2, 0x1b, 0x4c, 0x6f, 0x3d, 0xbd, 0x01, 0xf5,
+	     0x76, 0xd4, 0x1b, 0x54, 0x6f, 0x58, 0xbd, 0x81, 0xf5, 0x46,
+	     0xd6, 0x1b, 0x5b, 0x6f, 0x76, 0xbd, 0xe5, 0xf5, 0x36, 0xd8,
+	     0x5b, 0x64, 0x6f, 0x9e, 0xbd, 0x81, 0xf6, 0x66, 0xda, 0xdb,
+	     0x6a, 0x6f, 0xb3, 0xbd, 0xd9, 0xf6, 0x46, 0xdc, 0x1b, 0x72,
+	     0x6f, 0xd1, 0xbd, 0x5d, 0xf7, 0xb6, 0xdd, 0x1b, 0x79, 0x6f,
+	     0xed, 0xbd, 0xc9, 0xf7, 0xf6, 0xdf, 0x5b, 0x82, 0x6f, 0x16,
+	     0xbe, 0x85, 0xf8, 0x86, 0xe2, 0xdb, 0x8a, 0x6f, 0x34, 0xbe,
+	     0xed, 0xf8, 0xe6, 0xe3, 0x1b, 0x90, 0x6f, 0x49, 0xbe, 0x31,
+	     0xf9, 0x66, 0xe5, 0x5b, 0x97, 0x6f, 0x67, 0xbe, 0xb5, 0xf9,
+	     0x76, 0xe7, 0x9b, 0x9e, 0x6f, 0x88, 0xbe, 0x35, 0xfa, 0x06,
+	     0xe9, 0xdb, 0xa5, 0x6f, 0x9d, 0xbe, 0x99, 0xfa, 0x16, 0xeb,
+	     0x1b, 0xae, 0x6f, 0xbb, 0xbe, 0x21, 0xfb, 0xd6, 0xec, 0x5b,
+	     0xb4, 0x6f, 0xdc, 0xbe, 0x95, 0xfb, 0xe6, 0xee, 0xdb, 0xbe,
+	     0x6f, 0x01, 0xbf, 0x3d, 0xfc, 0x56, 0xf1, 0x1b, 0xc6, 0x6f,
+	     0x1a, 0xbf, 0x81, 0xfc, 0x76, 0xf2, 0x9b, 0xca, 0x6f, 0x2f,
+	     0xbf, 0xcd, 0xfc, 0xe6, 0xf3, 0x9b, 0xd1, 0x6f, 0x53, 0xbf,
+	     0x79, 0xfd, 0xb6, 0xf6, 0x9b, 0xdc, 0x6f, 0x80, 0xbf, 0x11,
+	     0xfe, 0x26, 0xf9, 0x5b, 0xe7, 0x6f, 0xa5, 0xbf, 0xc5, 0xfe,
+	     0x46, 0xfb, 0xdb, 0xef, 0x6f, 0xcc, 0xbf, 0x59, 0xff, 0x96,
+	     0xfd, 0x9b, 0xf9, 0x6f, 0xec, 0xbf, 0xd1, 0xff, 0xb6, 0xff,
+	     0x5b, 0xff, 0x6f, 0x00, 0xc0, 0x1d, 0x00, 0x07, 0x01, 0x1c,
+	     0x06, 0x70, 0x1e, 0xc0, 0xa1, 0x00, 0xe7, 0x02, 0x1c, 0x0e,
+	     0x70, 0x41, 0xc0, 0x39, 0x01, 0xc7, 0x05, 0x9c, 0x18, 0x70,
+	     0x6c, 0xc0, 0xd5, 0x01, 0xc7, 0x07, 0x5c, 0x22, 0x70, 0x91,
+	     0xc0, 0x69, 0x02, 0x87, 0x0a, 0x5c, 0x2b, 0x70, 0xb7, 0xc0,
+	     0x05, 0x03, 0x97, 0x0c, 0x5c, 0x35, 0x70, 0xe0, 0xc0, 0x91,
+	     0x03, 0xa7, 0x0e, 0x1c, 0x3c, 0x70, 0xf6, 0xc0, 0xf9, 0x03,
+	     0x07, 0x10, 0xdc, 0x40, 0x70, 0x09, 0xc1, 0x51, 0x04, 0xa7,
+	     0x11, 0x9c, 0x47, 0x70, 0x25, 0xc1, 0xc1, 0x04, 0x57, 0x13,
+	     0x9c, 0x50, 0x70, 0x48, 0xc1, 0x59, 0x05, 0x37, 0x16, 0x1c,
+	     0x5a, 0x70, 0x76, 0xc1, 0xe9, 0x05, 0x47, 0x18, 0x1c, 0x63,
+	     0x70, 0x96, 0xc1, 0x91, 0x06, 0xc7, 0x1a, 0x5c, 0x6e, 0x70,
+	     0xbe, 0xc1, 0x1d, 0x07, 0x17, 0x1d, 0x1c, 0x76, 0x70, 0xe1,
+	     0xc1, 0xa9, 0x07, 0x07, 0x1f, 0x9c, 0x7d, 0x70, 0xfd, 0xc1,
+	     0xfd, 0x07, 0x67, 0x20, 0x5c, 0x83, 0x70, 0x16, 0xc2, 0x65,
+	     0x08, 0x77, 0x22, 0x1c, 0x8c, 0x70, 0x3a, 0xc2, 0xf9, 0x08,
+	     0x67, 0x24, 0x5c, 0x92, 0x70, 0x50, 0xc2, 0x55, 0x09, 0x07,
+	     0x26, 0xdc, 0x9a, 0x70, 0x73, 0xc2, 0xdd, 0x09, 0x17, 0x28,
+	     0x9c, 0xa3, 0x70, 0x95, 0xc2, 0x8d, 0x0a, 0x97, 0x2a, 0xdc,
+	     0xab, 0x70, 0xb7, 0xc2, 0xe9, 0x0a, 0x87, 0x2c, 0x9c, 0xb5,
+	     0x70, 0xde, 0xc2, 0xb1, 0x0b, 0x07, 0x2f, 0x1c, 0xbf, 0x70,
+	     0x01, 0xc3, 0x19, 0x0c, 0x87, 0x30, 0xdc, 0xc2, 0x70, 0x13,
+	     0xc3, 0x69, 0x0c, 0x47, 0x32, 0x9c, 0xca, 0x70, 0x34, 0xc3,
+	     0xfd, 0x0c, 0xb7, 0x34, 0xdc, 0xd4, 0x70, 0x5e, 0xc3, 0xa1,
+	     0x0d, 0x57, 0x37, 0xdc, 0xdf, 0x70, 0x8c, 0xc3, 0x51, 0x0e,
+	     0xd7, 0x39, 0x1c, 0xe9, 0x70, 0xa7, 0xc3, 0xcd, 0x0e, 0x97,
+	     0x3b, 0xdc, 0xf1, 0x70, 0xcb, 0xc3, 0x61, 0x0f, 0xe7, 0x3d,
+	     0x5c, 0xf9, 0x70, 0xe8, 0xc3, 0xd1, 0x0f, 0xf7, 0x3f, 0x1c,
+	     0x02, 0x71, 0x0a, 0xc4, 0x35, 0x10, 0x47, 0x41, 0xdc, 0x05,
+	     0x71, 0x21, 0xc4, 0x91, 0x10, 0x27, 0x43, 0x9c, 0x0e, 0x71,
+	     0x3e, 0xc4, 0x25, 0x11, 0xf7, 0x44, 0x5c, 0x15, 0x71, 0x5b,
+	     0xc4, 0xa5, 0x11, 0x07, 0x47, 0xdc, 0x1d, 0x71, 0x7f, 0xc4,
+	     0x0d, 0x12, 0x67, 0x48, 0xdc, 0x23, 0x71, 0x94, 0xc4, 0x89,
+	     0x12, 0xb7, 0x4a, 0xdc, 0x2c, 0x71, 0xbd, 0xc4, 0x2d, 0x13,
+	     0xf7, 0x4c, 0xdc, 0x36, 0x71, 0xe7, 0xc4, 0xc5, 0x13, 0xf7,
+	     0x4f, 0x9c, 0x41, 0x71, 0x10, 0xc5, 0x6d, 0x14, 0xd7, 0x51,
+	     0x9c, 0x4a, 0x71, 0x31, 0xc5, 0xe9, 0x14, 0x27, 0x54, 0xdc,
+	     0x53, 0x71, 0x54, 0xc5, 0x5d, 0x15, 0x37, 0x56, 0x1c, 0x5a,
+	     0x71, 0x6f, 0xc5, 0xd1, 0x15, 0x77, 0x57, 0x5c, 0x60, 0x71,
+	     0x8f, 0xc5, 0x5d, 0x16, 0x07, 0x5a, 0x1c, 0x6b, 0x71, 0xb4,
+	     0xc5, 0xfd, 0x16, 0xb7, 0x5c, 0x5c, 0x74, 0x71, 0xdf, 0xc5,
+	     0xa1, 0x17, 0x27, 0x5f, 0x1c, 0x7e, 0x71, 0x05, 0xc6, 0x31,
+	     0x18, 0xe7, 0x60, 0x5c, 0x84, 0x71, 0x1f, 0xc6, 0xb5, 0x18,
+	     0x77, 0x63, 0x1c, 0x8f, 0x71, 0x42, 0xc6, 0x39, 0x19, 0x67,
+	     0x65, 0xdc, 0x96, 0x71, 0x5f, 0xc6, 0xa1, 0x19, 0x07, 0x67,
+	     0x9c, 0x9f, 0x71, 0x82, 0xc6, 0x19, 0x1a, 0xd7, 0x68, 0x9c,
+	     0xa4, 0x71, 0xa0, 0xc6, 0x91, 0x1a, 0x17, 0x6b, 0x9c, 0xaf,
+	     0x71, 0xc3, 0xc6, 0x3d, 0x1b, 0xa7, 0x6d, 0x9c, 0xb8, 0x71,
+	     0xe7, 0xc6, 0xb1, 0x1b, 0x67, 0x6f, 0x1c, 0xc0, 0x71, 0x0e,
+	     0xc7, 0x59, 0x1c, 0xe7, 0x71, 0x1c, 0xc8, 0x71, 0x2c, 0xc7,
+	     0xcd, 0x1c, 0x97, 0x73, 0x9c, 0xcf, 0x71, 0x43, 0xc7, 0x3d,
+	     0x1d, 0x97, 0x75, 0x1c, 0xd7, 0x71, 0x68, 0xc7, 0xad, 0x1d,
+	     0x37, 0x77, 0x1c, 0xdf, 0x71, 0x83, 0xc7, 0x19, 0x1e, 0x07,
+	     0x79, 0x9c, 0xe6, 0x71, 0x9e, 0xc7, 0xa1, 0x1e, 0x07, 0x7b,
+	     0x9c, 0xef, 0x71, 0xc7, 0xc7, 0x49, 0x1f, 0xd7, 0x7d, 0x1c,
+	     0xfa, 0x71, 0xec, 0xc7, 0xd5, 0x1f, 0xb7, 0x7f, 0xdc, 0x00,
+	     0x72, 0x0a, 0xc8, 0x31, 0x20, 0x07, 0x81, 0x1c, 0x07, 0x72,
+	     0x29, 0xc8, 0xbd, 0x20, 0x87, 0x83, 0x5c, 0x0f, 0x72, 0x41,
+	     0xc8, 0x15, 0x21, 0xd7, 0x84, 0x1c, 0x14, 0x72, 0x59, 0xc8,
+	     0x85, 0x21, 0x57, 0x86, 0x9c, 0x1b, 0x72, 0x79, 0xc8, 0x19,
+	     0x22, 0xf7, 0x88, 0x5c, 0x25, 0x72, 0xa0, 0xc8, 0xb5, 0x22,
+	     0x67, 0x8b, 0x5c, 0x2f, 0x72, 0xc5, 0xc8, 0x49, 0x23, 0xf7,
+	     0x8d, 0xdc, 0x39, 0x72, 0xef, 0xc8, 0xe1, 0x23, 0x07, 0x90,
+	     0x9c, 0x40, 0x72, 0x0e, 0xc9, 0x55, 0x24, 0xd7, 0x91, 0xdc,
+	     0x49, 0x72, 0x2f, 0xc9, 0xe9, 0x24, 0x27, 0x94, 0x5c, 0x53,
+	     0x72, 0x54, 0xc9, 0x6d, 0x25, 0x17, 0x96, 0x9c, 0x5b, 0x72,
+	     0x77, 0xc9, 0x0d, 0x26, 0x87, 0x98, 0x9c, 0x64, 0x72, 0x99,
+	     0xc9, 0x99, 0x26, 0x37, 0x9b, 0xdc, 0x6d, 0x72, 0xc3, 0xc9,
+	     0x2d, 0x27, 0x77, 0x9d, 0x5c, 0x78, 0x72, 0xe4, 0xc9, 0xa5,
+	     0x27, 0x17, 0x9f, 0x9c, 0x7e, 0x72, 0x03, 0xca, 0x41, 0x28,
+	     0xc7, 0xa1, 0xdc, 0x88, 0x72, 0x25, 0xca, 0xb1, 0x28, 0x87,
+	     0xa3, 0xdc, 0x90, 0x72, 0x47, 0xca, 0x35, 0x29, 0x47, 0xa5,
+	     0x1c, 0x97, 0x72, 0x64, 0xca, 0xc9, 0x29, 0x97, 0xa7, 0x1c,
+	     0xa1, 0x72, 0x88, 0xca, 0x2d, 0x2a, 0x97, 0xa9, 0x1c, 0xa8,
+	     0x72, 0xa5, 0xca, 0xa5, 0x2a, 0x47, 0xab, 0x1c, 0xaf, 0x72,
+	     0xbe, 0xca, 0x19, 0x2b, 0x47, 0xad, 0x5c, 0xb8, 0x72, 0xe7,
+	     0xca, 0xb9, 0x2b, 0x37, 0xaf, 0x9c, 0xbd, 0x72, 0x00, 0xcb,
+	     0x31, 0x2c, 0xa7, 0xb1, 0xdc, 0xc9, 0x72, 0x30, 0xcb, 0xed,
+	     0x2c, 0x77, 0xb4, 0x9c, 0xd4, 0x72, 0x5f, 0xcb, 0x8d, 0x2d,
+	     0x97, 0xb6, 0xdc, 0xdc, 0x72, 0x80, 0xcb, 0x0d, 0x2e, 0xa7,
+	     0xb8, 0x9c, 0xe3, 0x72, 0x91, 0xcb, 0x55, 0x2e, 0xe7, 0xb9,
+	     0x9c, 0xe8, 0x72, 0xaa, 0xcb, 0xcd, 0x2e, 0xc7, 0xbb, 0x5c,
+	     0xf2, 0x72, 0xd3, 0xcb, 0x65, 0x2f, 0x17, 0xbe, 0x1c, 0xfb,
+	     0x72, 0xf0, 0xcb, 0xd5, 0x2f, 0xc7, 0xbf, 0x1c, 0x01, 0x73,
+	     0x08, 0xcc, 0x2d, 0x30, 0x47, 0xc1, 0xdc, 0x05, 0x73, 0x24,
+	     0xcc, 0xad, 0x30, 0x77, 0xc3, 0x5c, 0x0e, 0x73, 0x3c, 0xcc,
+	     0x25, 0x31, 0x27, 0xc5, 0xdc, 0x17, 0x73, 0x65, 0xcc, 0xc1,
+	     0x31, 0xe7, 0xc7, 0x9c, 0x22, 0x73, 0x97, 0xcc, 0x91, 0x32,
+	     0x17, 0xcb, 0xdc, 0x2d, 0x73, 0xbf, 0xcc, 0x2d, 0x33, 0x17,
+	     0xcd, 0x9c, 0x36, 0x73, 0xe1, 0xcc, 0x9d, 0x33, 0x27, 0xcf,
+	     0x9c, 0x3d, 0x73, 0xfe, 0xcc, 0x1d, 0x34, 0xf7, 0xd0, 0x9c,
+	     0x44, 0x73, 0x17, 0xcd, 0x69, 0x34, 0x37, 0xd2, 0x9c, 0x4a,
+	     0x73, 0x34, 0xcd, 0xe1, 0x34, 0x47, 0xd4, 0x9c, 0x51, 0x73,
+	     0x53, 0xcd, 0x6d, 0x35, 0xf7, 0xd5, 0xdc, 0x58, 0x73, 0x67,
+	     0xcd, 0xc5, 0x35, 0x67, 0xd7, 0xdc, 0x5f, 0x73, 0x87, 0xcd,
+	     0x35, 0x36, 0x37, 0xd9, 0x5c, 0x68, 0x73, 0xac, 0xcd, 0xc5,
+	     0x36, 0xb7, 0xdb, 0xdc, 0x70, 0x73, 0xcf, 0xcd, 0x5d, 0x37,
+	     0xd7, 0xdd, 0x9c, 0x79, 0x73, 0xf0, 0xcd, 0xe5, 0x37, 0x27,
+	     0xe0, 0xdc, 0x81, 0x73, 0x0f, 0xce, 0x6d, 0x38, 0x77, 0xe2,
+	     0x5c, 0x8d, 0x73, 0x3e, 0xce, 0x29, 0x39, 0x57, 0xe5, 0x9c,
+	     0x97, 0x73, 0x63, 0xce, 0xc1, 0x39, 0x27, 0xe7, 0x9c, 0x9d,
+	     0x73, 0x7c, 0xce, 0x05, 0x3a, 0x57, 0xe8, 0xdc, 0xa2, 0x73,
+	     0x95, 0xce, 0x79, 0x3a, 0xa7, 0xea, 0xdc, 0xab, 0x73, 0xbb,
+	     0xce, 0x19, 0x3b, 0xb7, 0xec, 0x9c, 0xb3, 0x73, 0xd7, 0xce,
+	     0x85, 0x3b, 0x57, 0xee, 0x5c, 0xba, 0x73, 0xf1, 0xce, 0xf5,
+	     0x3b, 0xa7, 0xf0, 0x5c, 0xc3, 0x73, 0x1b, 0xcf, 0x85, 0x3c,
+	     0x47, 0xf2, 0x1c, 0xca, 0x73, 0x2e, 0xcf, 0xd9, 0x3c, 0x27,
+	     0xf4, 0xdc, 0xd1, 0x73, 0x51, 0xcf, 0x6d, 0x3d, 0x77, 0xf6,
+	     0x1c, 0xdb, 0x73, 0x75, 0xcf, 0xf9, 0x3d, 0xc7, 0xf8, 0x9c,
+	     0xe4, 0x73, 0x96, 0xcf, 0x6d, 0x3e, 0x07, 0xfa, 0x5c, 0xeb,
+	     0x73, 0xb7, 0xcf, 0x05, 0x3f, 0xc7, 0xfc, 0x5c, 0xf6, 0x73,
+	     0xe4, 0xcf, 0xc5, 0x3f, 0xc7, 0xff, 0x5c, 0x00, 0x74, 0x07,
+	     0xd0, 0x2d, 0x40, 0xf7, 0x00, 0xdd, 0x05, 0x74, 0x1c, 0xd0,
+	     0x9d, 0x40, 0x57, 0x03, 0x5d, 0x0f, 0x74, 0x47, 0xd0, 0x35,
+	     0x41, 0x67, 0x05, 0x9d, 0x17, 0x74, 0x60, 0xd0, 0xa1, 0x41,
+	     0xc7, 0x06, 0x9d, 0x1d, 0x74, 0x7f, 0xd0, 0x31, 0x42, 0x57,
+	     0x09, 0x1d, 0x26, 0x74, 0xa4, 0xd0, 0xb5, 0x42, 0x87, 0x0b,
+	     0xdd, 0x2f, 0x74, 0xcb, 0xd0, 0x59, 0x43, 0xe7, 0x0d, 0x1d,
+	     0x39, 0x74, 0xe7, 0xd0, 0xc1, 0x43, 0xc7, 0x0f, 0xdd, 0x41,
+	     0x74, 0x12, 0xd1, 0x65, 0x44, 0xe7, 0x11, 0x9d, 0x48, 0x74,
+	     0x25, 0xd1, 0xc5, 0x44, 0xf7, 0x13, 0x9d, 0x51, 0x74, 0x52,
+	     0xd1, 0x5d, 0x45, 0x57, 0x16, 0xdd, 0x5c, 0x74, 0x77, 0xd1,
+	     0xe5, 0x45, 0x47, 0x18, 0xdd, 0x62, 0x74, 0x99, 0xd1, 0x71,
+	     0x46, 0x17, 0x1a, 0xdd, 0x6b, 0x74, 0xb8, 0xd1, 0x11, 0x47,
+	     0x87, 0x1c, 0x9d, 0x75, 0x74, 0xe0, 0xd1, 0x99, 0x47, 0x17,
+	     0x1f, 0x9d, 0x7d, 0x74, 0xff, 0xd1, 0x15, 0x48, 0x87, 0x20,
+	     0x9d, 0x84, 0x74, 0x20, 0xd2, 0x8d, 0x48, 0xd7, 0x22, 0x1d,
+	     0x8d, 0x74, 0x3b, 0xd2, 0x11, 0x49, 0x07, 0x25, 0x9d, 0x95,
+	     0x74, 0x5b, 0xd2, 0x85, 0x49, 0x77, 0x26, 0x5d, 0x9b, 0x74,
+	     0x72, 0xd2, 0xe1, 0x49, 0xc7, 0x27, 0x1d, 0xa2, 0x74, 0x95,
+	     0xd2, 0x5d, 0x4a, 0xc7, 0x29, 0x5d, 0xa8, 0x74, 0xa5, 0xd2,
+	     0xb5, 0x4a, 0x67, 0x2b, 0x5d, 0xaf, 0x74, 0xc3, 0xd2, 0x39,
+	     0x4b, 0x87, 0x2d, 0x5d, 0xb7, 0x74, 0xe8, 0xd2, 0xad, 0x4b,
+	     0xe7, 0x2e, 0x1d, 0xbf, 0x74, 0x01, 0xd3, 0x19, 0x4c, 0xf7,
+	     0x30, 0x9d, 0xc6, 0x74, 0x28, 0xd3, 0xc9, 0x4c, 0xf7, 0x33,
+	     0xdd, 0xd0, 0x74, 0x45, 0xd3, 0x35, 0x4d, 0x37, 0x35, 0xdd,
+	     0xd7, 0x74, 0x62, 0xd3, 0xad, 0x4d, 0x37, 0x37, 0x5d, 0xde,
+	     0x74, 0x80, 0xd3, 0x1d, 0x4e, 0xf7, 0x38, 0x5d, 0xe7, 0x74,
+	     0xa8, 0xd3, 0xcd, 0x4e, 0x67, 0x3b, 0x5d, 0xf0, 0x74, 0xcb,
+	     0xd3, 0x61, 0x4f, 0x37, 0x3e, 0x5d, 0xfb, 0x74, 0xf5, 0xd3,
+	     0x09, 0x50, 0x87, 0x40, 0x9d, 0x05, 0x75, 0x1b, 0xd4, 0xa1,
+	     0x50, 0xe7, 0x42, 0x1d, 0x0c, 0x75, 0x3b, 0xd4, 0xfd, 0x50,
+	     0x27, 0x44, 0x5d, 0x13, 0x75, 0x50, 0xd4, 0x59, 0x51, 0xa7,
+	     0x45, 0xdd, 0x19, 0x75, 0x6a, 0xd4, 0xbd, 0x51, 0xd7, 0x47,
+	     0xdd, 0x20, 0x75, 0x86, 0xd4, 0x45, 0x52, 0xe7, 0x49, 0x9d,
+	     0x29, 0x75, 0xb2, 0xd4, 0xdd, 0x52, 0xc7, 0x4b, 0x5d, 0x31,
+	     0x75, 0xce, 0xd4, 0x49, 0x53, 0xc7, 0x4d, 0x1d, 0x3a, 0x75,
+	     0xeb, 0xd4, 0xdd, 0x53, 0x17, 0x50, 0xdd, 0x42, 0x75, 0x17,
+	     0xd5, 0x65, 0x54, 0xe7, 0x51, 0x5d, 0x4a, 0x75, 0x2e, 0xd5,
+	     0xe5, 0x54, 0x67, 0x54, 0x1d, 0x54, 0x75, 0x53, 0xd5, 0x5d,
+	     0x55, 0xb7, 0x55, 0x5d, 0x5a, 0x75, 0x76, 0xd5, 0x0d, 0x56,
+	     0xf7, 0x58, 0x5d, 0x65, 0x75, 0xa2, 0xd5, 0x9d, 0x56, 0x07,
+	     0x5b, 0xdd, 0x6e, 0x75, 0xc1, 0xd5, 0x2d, 0x57, 0x87, 0x5d,
+	     0x9d, 0x79, 0x75, 0xf3, 0xd5, 0x01, 0x58, 0xe7, 0x60, 0x5d,
+	     0x84, 0x75, 0x1f, 0xd6, 0x9d, 0x58, 0x07, 0x63, 0x1d, 0x8f,
+	     0x75, 0x4a, 0xd6, 0x41, 0x59, 0x37, 0x65, 0xdd, 0x95, 0x75,
+	     0x63, 0xd6, 0xc1, 0x59, 0xa7, 0x67, 0x1d, 0xa0, 0x75, 0x84,
+	     0xd6, 0x1d, 0x5a, 0x27, 0x69, 0x5d, 0xa7, 0x75, 0xa0, 0xd6,
+	     0xb9, 0x5a, 0x77, 0x6b, 0xdd, 0xaf, 0x75, 0xca, 0xd6, 0x55,
+	     0x5b, 0xb7, 0x6d, 0x9d, 0xb9, 0x75, 0xe8, 0xd6, 0xb1, 0x5b,
+	     0x97, 0x6f, 0x5d, 0xc0, 0x75, 0x06, 0xd7, 0x2d, 0x5c, 0x87,
+	     0x71, 0x1d, 0xc8, 0x75, 0x2d, 0xd7, 0xcd, 0x5c, 0x77, 0x73,
+	     0xdd, 0xce, 0x75, 0x43, 0xd7, 0x45, 0x5d, 0x57, 0x75, 0xdd,
+	     0xd8, 0x75, 0x70, 0xd7, 0xd9, 0x5d, 0x07, 0x78, 0x9d, 0xe1,
+	     0x75, 0x8a, 0xd7, 0x51, 0x5e, 0xa7, 0x79, 0x1d, 0xe8, 0x75,
+	     0xad, 0xd7, 0xbd, 0x5e, 0x67, 0x7b, 0x9d, 0xef, 0x75, 0xc2,
+	     0xd7, 0x35, 0x5f, 0x37, 0x7d, 0x9d, 0xf6, 0x75, 0xe2, 0xd7,
+	     0xb9, 0x5f, 0x67, 0x7f, 0x5d, 0xff, 0x75, 0x0b, 0xd8, 0x3d,
+	     0x60, 0x87, 0x81, 0x9d, 0x08, 0x76, 0x26, 0xd8, 0xbd, 0x60,
+	     0x57, 0x83, 0x1d, 0x10, 0x76, 0x4d, 0xd8, 0x61, 0x61, 0x27,
+	     0x86, 0xdd, 0x1b, 0x76, 0x72, 0xd8, 0xe1, 0x61, 0x67, 0x88,
+	     0x1d, 0x23, 0x76, 0x98, 0xd8, 0x71, 0x62, 0x07, 0x8a, 0x9d,
+	     0x2a, 0x76, 0xaf, 0xd8, 0xe1, 0x62, 0x37, 0x8c, 0x1d, 0x34,
+	     0x76, 0xd2, 0xd8, 0x6d, 0x63, 0x07, 0x8e, 0x1d, 0x3b, 0x76,
+	     0xf5, 0xd8, 0x01, 0x64, 0x57, 0x90, 0x5d, 0x43, 0x76, 0x17,
+	     0xd9, 0x79, 0x64, 0x57, 0x92, 0x5d, 0x4b, 0x76, 0x31, 0xd9,
+	     0xf9, 0x64, 0x57, 0x94, 0x1d, 0x54, 0x76, 0x5b, 0xd9, 0xa5,
+	     0x65, 0x47, 0x97, 0x5d, 0x60, 0x76, 0x85, 0xd9, 0x2d, 0x66,
+	     0x57, 0x99, 0x1d, 0x67, 0x76, 0xa3, 0xd9, 0x95, 0x66, 0x17,
+	     0x9b, 0x9d, 0x6f, 0x76, 0xc1, 0xd9, 0x11, 0x67, 0x17, 0x9d,
+	     0x5d, 0x75, 0x76, 0xde, 0xd9, 0x95, 0x67, 0x97, 0x9e, 0x1d,
+	     0x7d, 0x76, 0xfd, 0xd9, 0x1d, 0x68, 0xe7, 0xa0, 0x1d, 0x87,
+	     0x76, 0x29, 0xda, 0xb5, 0x68, 0x37, 0xa3, 0x9d, 0x8d, 0x76,
+	     0x3a, 0xda, 0xfd, 0x68, 0x17, 0xa4, 0xdd, 0x91, 0x76, 0x4a,
+	     0xda, 0x45, 0x69, 0x97, 0xa5, 0xdd, 0x97, 0x76, 0x67, 0xda,
+	     0xb9, 0x69, 0x67, 0xa7, 0x1d, 0x9f, 0x76, 0x80, 0xda, 0x15,
+	     0x6a, 0xa7, 0xa8, 0xdd, 0xa3, 0x76, 0x94, 0xda, 0x81, 0x6a,
+	     0xe7, 0xaa, 0x1d, 0xaf, 0x76, 0xc6, 0xda, 0x4d, 0x6b, 0x87,
+	     0xad, 0x1d, 0xb7, 0x76, 0xe9, 0xda, 0xc5, 0x6b, 0xc7, 0xaf,
+	     0xdd, 0xc0, 0x76, 0x0d, 0xdb, 0x59, 0x6c, 0x17, 0xb2, 0x9d,
+	     0xca, 0x76, 0x2c, 0xdb, 0xd5, 0x6c, 0xc7, 0xb3, 0xdd, 0xd1,
+	     0x76, 0x55, 0xdb, 0x89, 0x6d, 0xb7, 0xb6, 0x9d, 0xdb, 0x76,
+	     0x75, 0xdb, 0x01, 0x6e, 0x47, 0xb8, 0x1d, 0xe4, 0x76, 0x96,
+	     0xdb, 0x8d, 0x6e, 0xe7, 0xba, 0xdd, 0xed, 0x76, 0xbf, 0xdb,
+	     0x11, 0x6f, 0x17, 0xbd, 0x9d, 0xf7, 0x76, 0xeb, 0xdb, 0xe1,
+	     0x6f, 0x57, 0xc0, 0x1d, 0x03, 0x77, 0x13, 0xdc, 0x79, 0x70,
+	     0x77, 0xc2, 0x1d, 0x0b, 0x77, 0x38, 0xdc, 0x19, 0x71, 0xf7,
+	     0xc4, 0xdd, 0x16, 0x77, 0x5f, 0xdc, 0xa1, 0x71, 0xf7, 0xc6,
+	     0xdd, 0x1c, 0x77, 0x77, 0xdc, 0x01, 0x72, 0xe7, 0xc8, 0xdd,
+	     0x25, 0x77, 0xa4, 0xdc, 0xc9, 0x72, 0x77, 0xcb, 0xdd, 0x2e,
+	     0x77, 0xc3, 0xdc, 0x45, 0x73, 0x67, 0xcd, 0x5d, 0x38, 0x77,
+	     0xee, 0xdc, 0xcd, 0x73, 0xd7, 0xcf, 0x1d, 0x42, 0x77, 0x15,
+	     0xdd, 0x65, 0x74, 0xc7, 0xd1, 0xdd, 0x47, 0x77, 0x23, 0xdd,
+	     0x99, 0x74, 0xe7, 0xd2, 0x9d, 0x4c, 0x77, 0x3b, 0xdd, 0x1d,
+	     0x75, 0x57, 0xd5, 0x9d, 0x56, 0x77, 0x62, 0xdd, 0x99, 0x75,
+	     0x47, 0xd7, 0x1d, 0x5e, 0x77, 0x81, 0xdd, 0x15, 0x76, 0x07,
+	     0xd9, 0xdd, 0x64, 0x77, 0x98, 0xdd, 0x71, 0x76, 0x17, 0xda,
+	     0xdd, 0x6b, 0x77, 0xb3, 0xdd, 0x01, 0x77, 0x77, 0xdc, 0x1d,
+	     0x73, 0x77, 0xda, 0xdd, 0x99, 0x77, 0x37, 0xdf, 0x9d, 0x7f,
+	     0x77, 0x09, 0xde, 0x3d, 0x78, 0xd7, 0xe1, 0x9d, 0x8a, 0x77,
+	     0x31, 0xde, 0xe9, 0x78, 0xe7, 0xe3, 0x5d, 0x91, 0x77, 0x47,
+	     0xde, 0x51, 0x79, 0xc7, 0xe5, 0xdd, 0x99, 0x77, 0x6c, 0xde,
+	     0xc9, 0x79, 0xc7, 0xe7, 0xdd, 0x9f, 0x77, 0x89, 0xde, 0x45,
+	     0x7a, 0x87, 0xe9, 0x5d, 0xa8, 0x77, 0xae, 0xde, 0xdd, 0x7a,
+	     0x07, 0xec, 0x5d, 0xb2, 0x77, 0xcd, 0xde, 0x4d, 0x7b, 0xf7,
+	     0xed, 0xdd, 0xba, 0x77, 0xf7, 0xde, 0x15, 0x7c, 0x17, 0xf1,
+	     0x1d, 0xc6, 0x77, 0x24, 0xdf, 0xb5, 0x7c, 0x47, 0xf3, 0x9d,
+	     0xce, 0x77, 0x48, 0xdf, 0x35, 0x7d, 0x17, 0xf5, 0xdd, 0xd5,
+	     0x77, 0x5f, 0xdf, 0xa5, 0x7d, 0xb7, 0xf6, 0x9d, 0xdc, 0x77,
+	     0x77, 0xdf, 0xf1, 0x7d, 0xf7, 0xf7, 0xdd, 0xe0, 0x77, 0x88,
+	     0xdf, 0x55, 0x7e, 0xf7, 0xf9, 0x9d, 0xe9, 0x77, 0xb0, 0xdf,
+	     0xe5, 0x7e, 0x27, 0xfc, 0xdd, 0xf3, 0x77, 0xdd, 0xdf, 0x99,
+	     0x7f, 0xf7, 0xfe, 0x9d, 0xfd, 0x77, 0xfd, 0xdf, 0x19, 0x80,
+	     0xc7, 0x00, 0x1e, 0x06, 0x78, 0x25, 0xe0, 0xa5, 0x80, 0xf7,
+	     0x02, 0xde, 0x0e, 0x78, 0x3f, 0xe0, 0x0d, 0x81, 0x87, 0x04,
+	     0x9e, 0x12, 0x78, 0x4d, 0xe0, 0x51, 0x81, 0xf7, 0x05, 0x9e,
+	     0x1a, 0x78, 0x72, 0xe0, 0xd5, 0x81, 0x07, 0x08, 0x5e, 0x21,
+	     0x78, 0x90, 0xe0, 0x65, 0x82, 0x17, 0x0a, 0x1e, 0x2b, 0x78,
+	     0xb6, 0xe0, 0x09, 0x83, 0xc7, 0x0c, 0xde, 0x34, 0x78, 0xd7,
+	     0xe0, 0x7d, 0x83, 0xa7, 0x0e, 0xde, 0x3c, 0x78, 0xfa, 0xe0,
+	     0x01, 0x84, 0x87, 0x10, 0x9e, 0x44, 0x78, 0x1d, 0xe1, 0x85,
+	     0x84, 0x47, 0x12, 0x1e, 0x4c, 0x78, 0x3b, 0xe1, 0xfd, 0x84,
+	     0xb7, 0x14, 0x1e, 0x55, 0x78, 0x60, 0xe1, 0xb1, 0x85, 0x77,
+	     0x17, 0xde, 0x60, 0x78, 0x87, 0xe1, 0x45, 0x86, 0x67, 0x19,
+	     0x5e, 0x68, 0x78, 0xaa, 0xe1, 0xc1, 0x86, 0x87, 0x1b, 0x5e,
+	     0x6f, 0x78, 0xc2, 0xe1, 0x25, 0x87, 0x47, 0x1d, 0x1e, 0x76,
+	     0x78, 0xdc, 0xe1, 0x81, 0x87, 0xe7, 0x1e, 0x5e, 0x7d, 0x78,
+	     0x01, 0xe2, 0x3d, 0x88, 0x37, 0x21, 0xde, 0x85, 0x78, 0x22,
+	     0xe2, 0xa5, 0x88, 0xe7, 0x22, 0x9e, 0x8c, 0x78, 0x3f, 0xe2,
+	     0x21, 0x89, 0xf7, 0x24, 0x9e, 0x94, 0x78, 0x5c, 0xe2, 0x79,
+	     0x89, 0x17, 0x26, 0xde, 0x99, 0x78, 0x6d, 0xe2, 0xdd, 0x89,
+	     0xa7, 0x27, 0x9e, 0xa1, 0x78, 0x8e, 0xe2, 0x45, 0x8a, 0x67,
+	     0x29, 0xde, 0xa7, 0x78, 0xa6, 0xe2, 0xb9, 0x8a, 0xb7, 0x2b,
+	     0x1e, 0xb0, 0x78, 0xc4, 0xe2, 0x21, 0x8b, 0x07, 0x2d, 0xde,
+	     0xb6, 0x78, 0xde, 0xe2, 0xb1, 0x8b, 0x57, 0x2f, 0xde, 0xbf,
+	     0x78, 0x0a, 0xe3, 0x4d, 0x8c, 0xe7, 0x31, 0x9e, 0xc8, 0x78,
+	     0x2b, 0xe3, 0xc9, 0x8c, 0x47, 0x33, 0x1e, 0xce, 0x78, 0x3e,
+	     0xe3, 0x21, 0x8d, 0xe7, 0x34, 0x1e, 0xd6, 0x78, 0x66, 0xe3,
+	     0xad, 0x8d, 0x97, 0x37, 0xde, 0xdf, 0x78, 0x8d, 0xe3, 0x59,
+	     0x8e, 0xa7, 0x39, 0x9e, 0xe8, 0x78, 0xa7, 0xe3, 0xd1, 0x8e,
+	     0x17, 0x3c, 0x1e, 0xf1, 0x78, 0xd0, 0xe3, 0x55, 0x8f, 0xc7,
+	     0x3d, 0x1e, 0xfa, 0x78, 0xf1, 0xe3, 0xe9, 0x8f, 0x77, 0x40,
+	     0x9e, 0x03, 0x79, 0x10, 0xe4, 0x71, 0x90, 0x07, 0x42, 0x1e,
+	     0x09, 0x79, 0x2f, 0xe4, 0xd1, 0x90, 0xe7, 0x43, 0x1e, 0x11,
+	     0x79, 0x47, 0xe4, 0x4d, 0x91, 0x07, 0x46, 0x5e, 0x1b, 0x79,
+	     0x71, 0xe4, 0xdd, 0x91, 0x47, 0x48, 0x5e, 0x22, 0x79, 0x90,
+	     0xe4, 0x6d, 0x92, 0x97, 0x4a, 0x5e, 0x2d, 0x79, 0xbd, 0xe4,
+	     0x09, 0x93, 0xd7, 0x4c, 0x9e, 0x34, 0x79, 0xd4, 0xe4, 0x81,
+	     0x93, 0x57, 0x4e, 0x9e, 0x3a, 0x79, 0xf3, 0xe4, 0xf9, 0x93,
+	     0xc7, 0x50, 0x1e, 0x45, 0x79, 0x22, 0xe5, 0xc1, 0x94, 0x87,
+	     0x53, 0x1e, 0x51, 0x79, 0x4d, 0xe5, 0x55, 0x95, 0xc7, 0x55,
+	     0x1e, 0x58, 0x79, 0x64, 0xe5, 0x9d, 0x95, 0x47, 0x57, 0xde,
+	     0x5e, 0x79, 0x86, 0xe5, 0x4d, 0x96, 0x67, 0x59, 0x1e, 0x69,
+	     0x79, 0xa9, 0xe5, 0xc9, 0x96, 0x77, 0x5b, 0x1e, 0x71, 0x79,
+	     0xc8, 0xe5, 0x35, 0x97, 0x37, 0x5d, 0x5e, 0x77, 0x79, 0xe1,
+	     0xe5, 0xbd, 0x97, 0x17, 0x5f, 0x1e, 0x7f, 0x79, 0x06, 0xe6,
+	     0x35, 0x98, 0x77, 0x61, 0x9e, 0x88, 0x79, 0x2b, 0xe6, 0xc9,
+	     0x98, 0x77, 0x63, 0x5e, 0x8f, 0x79, 0x42, 0xe6, 0x29, 0x99,
+	     0x87, 0x65, 0x9e, 0x97, 0x79, 0x62, 0xe6, 0xb1, 0x99, 0x17,
+	     0x67, 0x9e, 0x9e, 0x79, 0x81, 0xe6, 0x3d, 0x9a, 0x77, 0x69,
+	     0x5e, 0xa7, 0x79, 0xaa, 0xe6, 0xe1, 0x9a, 0xf7, 0x6b, 0xde,
+	     0xb1, 0x79, 0xd3, 0xe6, 0x69, 0x9b, 0x57, 0x6e, 0x1e, 0xbc,
+	     0x79, 0xf6, 0xe6, 0xf1, 0x9b, 0x57, 0x70, 0x5e, 0xc2, 0x79,
+	     0x0d, 0xe7, 0x6d, 0x9c, 0x37, 0x72, 0x9e, 0xcb, 0x79, 0x35,
+	     0xe7, 0xf1, 0x9c, 0x77, 0x74, 0x5e, 0xd2, 0x79, 0x4c, 0xe7,
+	     0x69, 0x9d, 0xf7, 0x75, 0x5e, 0xd9, 0x79, 0x6d, 0xe7, 0xe1,
+	     0x9d, 0x27, 0x78, 0x9e, 0xe1, 0x79, 0x92, 0xe7, 0x7d, 0x9e,
+	     0xd7, 0x7a, 0x9e, 0xed, 0x79, 0xc2, 0xe7, 0x1d, 0x9f, 0xc7,
+	     0x7c, 0x9e, 0xf5, 0x79, 0xe3, 0xe7, 0x9d, 0x9f, 0xf7, 0x7e,
+	     0xde, 0xfd, 0x79, 0xff, 0xe7, 0x11, 0xa0, 0x27, 0x81, 0xde,
+	     0x07, 0x7a, 0x21, 0xe8, 0xa9, 0xa0, 0x07, 0x83, 0xde, 0x0c,
+	     0x7a, 0x3b, 0xe8, 0x1d, 0xa1, 0x27, 0x85, 0x1e, 0x17, 0x7a,
+	     0x65, 0xe8, 0xa5, 0xa1, 0x27, 0x87, 0x1e, 0x1f, 0x7a, 0x8a,
+	     0xe8, 0x35, 0xa2, 0x97, 0x89, 0x9e, 0x28, 0x7a, 0xab, 0xe8,
+	     0xd9, 0xa2, 0x47, 0x8c, 0x5e, 0x32, 0x7a, 0xd6, 0xe8, 0x8d,
+	     0xa3, 0x07, 0x8f, 0x1e, 0x3e, 0x7a, 0x03, 0xe9, 0x45, 0xa4,
+	     0x87, 0x91, 0x1e, 0x47, 0x7a, 0x25, 0xe9, 0xcd, 0xa4, 0x87,
+	     0x93, 0x1e, 0x51, 0x7a, 0x4d, 0xe9, 0x69, 0xa5, 0x77, 0x96,
+	     0xde, 0x5c, 0x7a, 0x7f, 0xe9, 0x05, 0xa6, 0x57, 0x98, 0x9e,
+	     0x62, 0x7a, 0x94, 0xe9, 0x79, 0xa6, 0x17, 0x9a, 0x9e, 0x6a,
+	     0x7a, 0xb7, 0xe9, 0x05, 0xa7, 0x87, 0x9c, 0x5e, 0x74, 0x7a,
+	     0xd5, 0xe9, 0x81, 0xa7, 0xe7, 0x9e, 0x9e, 0x7c, 0x7a, 0xff,
+	     0xe9, 0x2d, 0xa8, 0x57, 0xa1, 0x5e, 0x87, 0x7a, 0x23, 0xea,
+	     0xb5, 0xa8, 0xa7, 0xa3, 0x1e, 0x92, 0x7a, 0x55, 0xea, 0x79,
+	     0xa9, 0xc7, 0xa6, 0x5e, 0x9d, 0x7a, 0x77, 0xea, 0x01, 0xaa,
+	     0x87, 0xa8, 0xde, 0xa3, 0x7a, 0x97, 0xea, 0x8d, 0xaa, 0xc7,
+	     0xaa, 0xde, 0xad, 0x7a, 0xbd, 0xea, 0x0d, 0xab, 0xa7, 0xac,
+	     0x9e, 0xb4, 0x7a, 0xdc, 0xea, 0x85, 0xab, 0x97, 0xae, 0x5e,
+	     0xbd, 0x7a, 0xfd, 0xea, 0x2d, 0xac, 0x77, 0xb1, 0xde, 0xc6,
+	     0x7a, 0x27, 0xeb, 0xc5, 0xac, 0xa7, 0xb3, 0x5e, 0xcf, 0x7a,
+	     0x48, 0xeb, 0x49, 0xad, 0x07, 0xb6, 0x9e, 0xd9, 0x7a, 0x6d,
+	     0xeb, 0xe1, 0xad, 0x47, 0xb8, 0xde, 0xe2, 0x7a, 0x8d, 0xeb,
+	     0x61, 0xae, 0xd7, 0xb9, 0x9e, 0xe9, 0x7a, 0xb2, 0xeb, 0x01,
+	     0xaf, 0x47, 0xbc, 0x1e, 0xf4, 0x7a, 0xdd, 0xeb, 0xa5, 0xaf,
+	     0x47, 0xbf, 0xde, 0xfd, 0x7a, 0x05, 0xec, 0x25, 0xb0, 0xd7,
+	     0xc0, 0x1e, 0x04, 0x7b, 0x16, 0xec, 0x65, 0xb0, 0x17, 0xc2,
+	     0xde, 0x0a, 0x7b, 0x30, 0xec, 0xe1, 0xb0, 0x67, 0xc4, 0x1e,
+	     0x15, 0x7b, 0x5c, 0xec, 0x79, 0xb1, 0x27, 0xc6, 0x5e, 0x1b,
+	     0x7b, 0x77, 0xec, 0xf1, 0xb1, 0x07, 0xc8, 0x9e, 0x23, 0x7b,
+	     0x96, 0xec, 0x81, 0xb2, 0x97, 0xca, 0xde, 0x2d, 0x7b, 0xc4,
+	     0xec, 0x29, 0xb3, 0x27, 0xcd, 0x9e, 0x36, 0x7b, 0xe1, 0xec,
+	     0xbd, 0xb3, 0x97, 0xcf, 0x1e, 0x40, 0x7b, 0x0c, 0xed, 0x4d,
+	     0xb4, 0xb7, 0xd1, 0x5e, 0x49, 0x7b, 0x28, 0xed, 0xb9, 0xb4,
+	     0x17, 0xd3, 0x9e, 0x4f, 0x7b, 0x40, 0xed, 0x15, 0xb5, 0xe7,
+	     0xd4, 0x9e, 0x55, 0x7b, 0x63, 0xed, 0xb5, 0xb5, 0x97, 0xd7,
+	     0x9e, 0x5f, 0x7b, 0x82, 0xed, 0x3d, 0xb6, 0x87, 0xd9, 0x5e,
+	     0x67, 0x7b, 0xa3, 0xed, 0xbd, 0xb6, 0x87, 0xdb, 0x1e, 0x6f,
+	     0x7b, 0xc4, 0xed, 0x21, 0xb7, 0x27, 0xdd, 0x1e, 0x77, 0x7b,
+	     0xe7, 0xed, 0xd5, 0xb7, 0x27, 0xe0, 0x1e, 0x82, 0x7b, 0x10,
+	     0xee, 0x71, 0xb8, 0x27, 0xe2, 0xde, 0x8b, 0x7b, 0x3b, 0xee,
+	     0x15, 0xb9, 0xc7, 0xe4, 0x5e, 0x94, 0x7b, 0x53, 0xee, 0x65,
+	     0xb9, 0xe7, 0xe5, 0xde, 0x9a, 0x7b, 0x74, 0xee, 0xf1, 0xb9,
+	     0x87, 0xe8, 0x5e, 0xa3, 0x7b, 0x9b, 0xee, 0xa5, 0xba, 0xe7,
+	     0xea, 0x5e, 0xae, 0x7b, 0xc5, 0xee, 0x3d, 0xbb, 0xa7, 0xed,
+	     0xde, 0xb7, 0x7b, 0xe5, 0xee, 0xb1, 0xbb, 0x97, 0xef, 0x5e,
+	     0xc0, 0x7b, 0x0a, 0xef, 0x59, 0xbc, 0x97, 0xf1, 0x9e, 0xc9,
+	     0x7b, 0x2c, 0xef, 0xc5, 0xbc, 0xd7, 0xf3, 0x5e, 0xd1, 0x7b,
+	     0x47, 0xef, 0x41, 0xbd, 0xa7, 0xf5, 0x9e, 0xd9, 0x7b, 0x6d,
+	     0xef, 0xc5, 0xbd, 0xb7, 0xf7, 0x5e, 0xe0, 0x7b, 0x86, 0xef,
+	     0x25, 0xbe, 0x37, 0xf9, 0x9e, 0xe6, 0x7b, 0x9e, 0xef, 0x85,
+	     0xbe, 0x97, 0xfa, 0x5e, 0xed, 0x7b, 0xbb, 0xef, 0x19, 0xbf,
+	     0xf7, 0xfc, 0x5e, 0xf7, 0x7b, 0xe9, 0xef, 0xc1, 0xbf, 0x67,
+	     0xff, 0x9e, 0xff, 0x7b, 0x06, 0xf0, 0x35, 0xc0, 0xa7, 0x01,
+	     0xdf, 0x07, 0x7c, 0x25, 0xf0, 0xb5, 0xc0, 0x77, 0x03, 0x9f,
+	     0x0e, 0x7c, 0x3f, 0xf0, 0x19, 0xc1, 0xa7, 0x04, 0x5f, 0x13,
+	     0x7c, 0x56, 0xf0, 0x71, 0xc1, 0x87, 0x06, 0xdf, 0x1c, 0x7c,
+	     0x80, 0xf0, 0x21, 0xc2, 0xc7, 0x08, 0x9f, 0x24, 0x7c, 0x98,
+	     0xf0, 0x89, 0xc2, 0x87, 0x0a, 0x9f, 0x2b, 0x7c, 0xba, 0xf0,
+	     0xfd, 0xc2, 0xb7, 0x0c, 0x5f, 0x34, 0x7c, 0xd5, 0xf0, 0x65,
+	     0xc3, 0xd7, 0x0d, 0x1f, 0x3a, 0x7c, 0xf0, 0xf0, 0xd9, 0xc3,
+	     0xf7, 0x0f, 0x5f, 0x40, 0x7c, 0x0b, 0xf1, 0x59, 0xc4, 0x07,
+	     0x12, 0x5f, 0x49, 0x7c, 0x2f, 0xf1, 0xc9, 0xc4, 0xc7, 0x13,
+	     0x9f, 0x52, 0x7c, 0x58, 0xf1, 0x89, 0xc5, 0xb7, 0x16, 0x9f,
+	     0x5b, 0x7c, 0x79, 0xf1, 0xfd, 0xc5, 0x97, 0x18, 0x1f, 0x64,
+	     0x7c, 0x98, 0xf1, 0x91, 0xc6, 0xb7, 0x1a, 0x5f, 0x6d, 0x7c,
+	     0xbd, 0xf1, 0x09, 0xc7, 0xb7, 0x1c, 0x1f, 0x75, 0x7c, 0xdd,
+	     0xf1, 0x99, 0xc7, 0xe7, 0x1e, 0x9f, 0x7e, 0x7c, 0xfc, 0xf1,
+	     0x01, 0xc8, 0x77, 0x20, 0x1f, 0x84, 0x7c, 0x1d, 0xf2, 0x89,
+	     0xc8, 0x07, 0x23, 0xdf, 0x8e, 0x7c, 0x43, 0xf2, 0x25, 0xc9,
+	     0x57, 0x25, 0xdf, 0x97, 0x7c, 0x6c, 0xf2, 0xe1, 0xc9, 0x47,
+	     0x28, 0x1f, 0xa2, 0x7c, 0x90, 0xf2, 0x51, 0xca, 0x77, 0x29,
+	     0x5f, 0xa8, 0x7c, 0xa8, 0xf2, 0xb5, 0xca, 0x37, 0x2b, 0xdf,
+	     0xad, 0x7c, 0xbf, 0xf2, 0x31, 0xcb, 0x17, 0x2d, 0xdf, 0xb4,
+	     0x7c, 0xde, 0xf2, 0xb1, 0xcb, 0xf7, 0x2e, 0x1f, 0xbe, 0x7c,
+	     0x01, 0xf3, 0x39, 0xcc, 0x57, 0x31, 0x9f, 0xc6, 0x7c, 0x21,
+	     0xf3, 0xa1, 0xcc, 0x67, 0x33, 0x1f, 0xd0, 0x7c, 0x4a, 0xf3,
+	     0x41, 0xcd, 0xc7, 0x35, 0xdf, 0xd7, 0x7c, 0x65, 0xf3, 0xb1,
+	     0xcd, 0x47, 0x37, 0x1f, 0xdf, 0x7c, 0x83, 0xf3, 0x31, 0xce,
+	     0x97, 0x39, 0x1f, 0xe8, 0x7c, 0xae, 0xf3, 0xf1, 0xce, 0x67,
+	     0x3c, 0x1f, 0xf2, 0x7c, 0xcb, 0xf3, 0x4d, 0xcf, 0xf7, 0x3d,
+	     0x9f, 0xfa, 0x7c, 0xf0, 0xf3, 0xf1, 0xcf, 0x57, 0x40, 0x1f,
+	     0x04, 0x7d, 0x1c, 0xf4, 0xa9, 0xd0, 0x87, 0x43, 0x5f, 0x11,
+	     0x7d, 0x4c, 0xf4, 0x51, 0xd1, 0xf7, 0x45, 0x5f, 0x1a, 0x7d,
+	     0x6f, 0xf4, 0xd9, 0xd1, 0xf7, 0x47, 0x5f, 0x23, 0x7d, 0x94,
+	     0xf4, 0x75, 0xd2, 0x07, 0x4a, 0x9f, 0x29, 0x7d, 0xb4, 0xf4,
+	     0xf5, 0xd2, 0x37, 0x4c, 0x5f, 0x31, 0x7d, 0xd3, 0xf4, 0x75,
+	     0xd3, 0x97, 0x4e, 0x1f, 0x3b, 0x7d, 0xef, 0xf4, 0xf5, 0xd3,
+	     0x17, 0x50, 0x1f, 0x43, 0x7d, 0x17, 0xf5, 0x8d, 0xd4, 0xe7,
+	     0x52, 0x1f, 0x4f, 0x7d, 0x48, 0xf5, 0x41, 0xd5, 0x37, 0x55,
+	     0x9f, 0x55, 0x7d, 0x5e, 0xf5, 0x95, 0xd5, 0x17, 0x57, 0xdf,
+	     0x5e, 0x7d, 0x85, 0xf5, 0x29, 0xd6, 0x67, 0x59, 0xdf, 0x68,
+	     0x7d, 0xae, 0xf5, 0xdd, 0xd6, 0x97, 0x5b, 0x1f, 0x71, 0x7d,
+	     0xd1, 0xf5, 0x6d, 0xd7, 0xe7, 0x5d, 0x1f, 0x7a, 0x7d, 0xf4,
+	     0xf5, 0xf9, 0xd7, 0xb7, 0x60, 0x1f, 0x84, 0x7d, 0x17, 0xf6,
+	     0x79, 0xd8, 0x47, 0x62, 0x5f, 0x8a, 0x7d, 0x34, 0xf6, 0xf1,
+	     0xd8, 0xa7, 0x64, 0x9f, 0x94, 0x7d, 0x5e, 0xf6, 0x9d, 0xd9,
+	     0x57, 0x67, 0x9f, 0xa0, 0x7d, 0x86, 0xf6, 0x25, 0xda, 0xf7,
+	     0x68, 0x5f, 0xa5, 0x7d, 0x98, 0xf6, 0x81, 0xda, 0x47, 0x6a,
+	     0x9f, 0xab, 0x7d, 0xba, 0xf6, 0x21, 0xdb, 0x17, 0x6d, 0x5f,
+	     0xb6, 0x7d, 0xe2, 0xf6, 0xb9, 0xdb, 0x37, 0x6f, 0x5f, 0xbd,
+	     0x7d, 0x01, 0xf7, 0x19, 0xdc, 0xd7, 0x70, 0x1f, 0xc5, 0x7d,
+	     0x1c, 0xf7, 0x81, 0xdc, 0xb7, 0x72, 0x1f, 0xcd, 0x7d, 0x41,
+	     0xf7, 0x3d, 0xdd, 0x97, 0x75, 0xdf, 0xd8, 0x7d, 0x6e, 0xf7,
+	     0xf1, 0xdd, 0x87, 0x78, 0xdf, 0xe4, 0x7d, 0x9d, 0xf7, 0x81,
+	     0xde, 0x67, 0x7a, 0xdf, 0xec, 0x7d, 0xb6, 0xf7, 0x05, 0xdf,
+	     0xe7, 0x7c, 0x1f, 0xf6, 0x7d, 0xda, 0xf7, 0x8d, 0xdf, 0xb7,
+	     0x7e, 0x5f, 0xfc, 0x7d, 0xfb, 0xf7, 0x19, 0xe0, 0xd7, 0x80,
+	     0x1f, 0x06, 0x7e, 0x20, 0xf8, 0x91, 0xe0, 0x97, 0x82, 0x9f,
+	     0x0b, 0x7e, 0x35, 0xf8, 0xfd, 0xe0, 0x37, 0x84, 0x1f, 0x14,
+	     0x7e, 0x54, 0xf8, 0x5d, 0xe1, 0xf7, 0x85, 0x5f, 0x1a, 0x7e,
+	     0x72, 0xf8, 0xe9, 0xe1, 0xf7, 0x87, 0x5f, 0x23, 0x7e, 0x9a,
+	     0xf8, 0x8d, 0xe2, 0x17, 0x8b, 0x9f, 0x2e, 0x7e, 0xc6, 0xf8,
+	     0x29, 0xe3, 0x67, 0x8d, 0x1f, 0x37, 0x7e, 0xe6, 0xf8, 0xb5,
+	     0xe3, 0x47, 0x8f, 0x5f, 0x3f, 0x7e, 0x04, 0xf9, 0x2d, 0xe4,
+	     0x67, 0x91, 0xdf, 0x47, 0x7e, 0x2d, 0xf9, 0xd9, 0xe4, 0xe7,
+	     0x93, 0xdf, 0x52, 0x7e, 0x4e, 0xf9, 0x59, 0xe5, 0xd7, 0x95,
+	     0xdf, 0x59, 0x7e, 0x73, 0xf9, 0xdd, 0xe5, 0x07, 0x98, 0x5f,
+	     0x63, 0x7e, 0x91, 0xf9, 0x5d, 0xe6, 0xa7, 0x99, 0x5f, 0x68,
+	     0x7e, 0xad, 0xf9, 0xcd, 0xe6, 0xd7, 0x9b, 0x5f, 0x70, 0x7e,
+	     0xc9, 0xf9, 0x45, 0xe7, 0x37, 0x9d, 0x9f, 0x76, 0x7e, 0xe0,
+	     0xf9, 0x9d, 0xe7, 0x47, 0x9f, 0x1f, 0x7f, 0x7e, 0x04, 0xfa,
+	     0x39, 0xe8, 0x37, 0xa1, 0x5f, 0x86, 0x7e, 0x20, 0xfa, 0x8d,
+	     0xe8, 0xc7, 0xa2, 0x1f, 0x8c, 0x7e, 0x3c, 0xfa, 0x25, 0xe9,
+	     0xc7, 0xa4, 0x9f, 0x94, 0x7e, 0x56, 0xfa, 0x8d, 0xe9, 0xa7,
+	     0xa6, 0x5f, 0x9c, 0x7e, 0x7c, 0xfa, 0x29, 0xea, 0x17, 0xa9,
+	     0x5f, 0xa5, 0x7e, 0x9b, 0xfa, 0x79, 0xea, 0x27, 0xaa, 0x5f,
+	     0xab, 0x7e, 0xb7, 0xfa, 0x09, 0xeb, 0xe7, 0xac, 0x1f, 0xb6,
+	     0x7e, 0xe6, 0xfa, 0xcd, 0xeb, 0xa7, 0xaf, 0xdf, 0xbf, 0x7e,
+	     0x0b, 0xfb, 0x35, 0xec, 0x97, 0xb1, 0x5f, 0xc7, 0x7e, 0x2b,
+	     0xfb, 0xdd, 0xec, 0x27, 0xb4, 0xdf, 0xd1, 0x7e, 0x51, 0xfb,
+	     0x69, 0xed, 0x37, 0xb6, 0x9f, 0xdb, 0x7e, 0x77, 0xfb, 0x05,
+	     0xee, 0xf7, 0xb8, 0x1f, 0xe6, 0x7e, 0xa6, 0xfb, 0xa9, 0xee,
+	     0x77, 0xbb, 0x5f, 0xef, 0x7e, 0xc4, 0xfb, 0x35, 0xef, 0x47,
+	     0xbd, 0xdf, 0xf7, 0x7e, 0xe1, 0xfb, 0xb9, 0xef, 0xa7, 0xbf,
+	     0xdf, 0x01, 0x7f, 0x12, 0xfc, 0x65, 0xf0, 0x27, 0xc2, 0xdf,
+	     0x09, 0x7f, 0x2b, 0xfc, 0xd9, 0xf0, 0xd7, 0xc3, 0xdf, 0x11,
+	     0x7f, 0x4f, 0xfc, 0x5d, 0xf1, 0x17, 0xc6, 0x9f, 0x1b, 0x7f,
+	     0x78, 0xfc, 0xf5, 0xf1, 0x37, 0xc8, 0xdf, 0x23, 0x7f, 0x97,
+	     0xfc, 0x91, 0xf2, 0xc7, 0xca, 0x9f, 0x2e, 0x7f, 0xc3, 0xfc,
+	     0x41, 0xf3, 0xe7, 0xcd, 0x9f, 0x3a, 0x7f, 0xf1, 0xfc, 0xe1,
+	     0xf3, 0x07, 0xd0, 0x9f, 0x43, 0x7f, 0x10, 0xfd, 0x69, 0xf4,
+	     0x87, 0xd2, 0x5f, 0x4d, 0x7f, 0x38, 0xfd, 0x15, 0xf5, 0xe7,
+	     0xd4, 0x1f, 0x55, 0x7f, 0x62, 0xfd, 0x99, 0xf5, 0x97, 0xd6,
+	     0xdf, 0x5d, 0x7f, 0x7f, 0xfd, 0x09, 0xf6, 0xc7, 0xd8, 0x9f,
+	     0x66, 0x7f, 0xa6, 0xfd, 0xa9, 0xf6, 0x87, 0xdb, 0xdf, 0x6f,
+	     0x7f, 0xc3, 0xfd, 0x39, 0xf7, 0x47, 0xdd, 0xdf, 0x75, 0x7f,
+	     0xe5, 0xfd, 0xc9, 0xf7, 0x67, 0xdf, 0xdf, 0x7f, 0x7f, 0x0a,
+	     0xfe, 0x31, 0xf8, 0x27, 0xe1, 0xdf, 0x85, 0x7f, 0x20, 0xfe,
+	     0xa9, 0xf8, 0x17, 0xe3, 0x5f, 0x8f, 0x7f, 0x44, 0xfe, 0x41,
+	     0xf9, 0xe7, 0xe5, 0x5f, 0x9a, 0x7f, 0x77, 0xfe, 0x05, 0xfa,
+	     0x77, 0xe8, 0x5f, 0xa4, 0x7f, 0x94, 0xfe, 0x79, 0xfa, 0x77,
+	     0xea, 0x5f, 0xab, 0x7f, 0xb5, 0xfe, 0x01, 0xfb, 0x37, 0xec,
+	     0x1f, 0xb4, 0x7f, 0xd9, 0xfe, 0x7d, 0xfb, 0xd7, 0xee, 0x5f,
+	     0xbd, 0x7f, 0xfc, 0xfe, 0x11, 0xfc, 0x07, 0xf1, 0x5f, 0xc5,
+	     0x7f, 0x1a, 0xff, 0x9d, 0xfc, 0xe7, 0xf2, 0x1f, 0xce, 0x7f,
+	     0x40, 0xff, 0x11, 0xfd, 0x67, 0xf4, 0x1f, 0xd5, 0x7f, 0x58,
+	     0xff, 0x7d, 0xfd, 0x97, 0xf6, 0x5f, 0xdd, 0x7f, 0x7c, 0xff,
+	     0x1d, 0xfe, 0x57, 0xf9, 0x9f, 0xe8, 0x7f, 0xa5, 0xff, 0xb9,
+	     0xfe, 0x67, 0xfb, 0x1f, 0xf1, 0x7f, 0xd1, 0xff, 0x5d, 0xff,
+	     0x27, 0xfe, 0xdf, 0xfa, 0x7f, 0xf4, 0xff, 0x01, 0x00, 0x38,
+	     0x00, 0xa0, 0x03, 0x80, 0x1c, 0x00, 0x9a, 0x00, 0x88, 0x02,
+	     0xa0, 0x0b, 0x80, 0x39, 0x00, 0x1e, 0x01, 0xb8, 0x04, 0x60,
+	     0x16, 0x80, 0x60, 0x00, 0xa2, 0x01, 0x38, 0x07, 0x60, 0x1f,
+	     0x80, 0x81, 0x00, 0x1e, 0x02, 0x48, 0x09, 0xe0, 0x26, 0x80,
+	     0x9e, 0x00, 0x9e, 0x02, 0xb8, 0x0a, 0xe0, 0x2c, 0x80, 0xbf,
+	     0x00, 0x22, 0x03, 0x48, 0x0d, 0xa0, 0x37, 0x80, 0xeb, 0x00,
+	     0xc2, 0x03, 0x78, 0x0f, 0x60, 0x3f, 0x80, 0x01, 0x01, 0x26,
+	     0x04, 0x18, 0x11, 0xe0, 0x46, 0x80, 0x20, 0x01, 0xba, 0x04,
+	     0xc8, 0x13, 0x20, 0x51, 0x80, 0x4e, 0x01, 0x66, 0x05, 0x58,
+	     0x16, 0xe0, 0x5c, 0x80, 0x80, 0x01, 0x0a, 0x06, 0x98, 0x18,
+	     0xa0, 0x63, 0x80, 0x92, 0x01, 0x66, 0x06, 0x18, 0x1a, 0xe0,
+	     0x6b, 0x80, 0xbb, 0x01, 0x26, 0x07, 0x08, 0x1d, 0x60, 0x77,
+	     0x80, 0xe3, 0x01, 0xae, 0x07, 0x48, 0x1f, 0x20, 0x80, 0x80,
+	     0x04, 0x02, 0x36, 0x08, 0xa8, 0x21, 0x20, 0x8a, 0x80, 0x2f,
+	     0x02, 0xf6, 0x08, 0x38, 0x24, 0xa0, 0x93, 0x80, 0x59, 0x02,
+	     0x8e, 0x09, 0xb8, 0x26, 0x60, 0x9d, 0x80, 0x7e, 0x02, 0x22,
+	     0x0a, 0x58, 0x29, 0x60, 0xa8, 0x80, 0xaa, 0x02, 0xb2, 0x0a,
+	     0x78, 0x2b, 0xe0, 0xb0, 0x80, 0xcf, 0x02, 0x6a, 0x0b, 0xf8,
+	     0x2d, 0x20, 0xba, 0x80, 0xf5, 0x02, 0xe2, 0x0b, 0x18, 0x30,
+	     0x60, 0xc3, 0x80, 0x16, 0x03, 0x6e, 0x0c, 0x78, 0x32, 0x60,
+	     0xcc, 0x80, 0x36, 0x03, 0xf6, 0x0c, 0x88, 0x34, 0xa0, 0xd4,
+	     0x80, 0x5c, 0x03, 0x9a, 0x0d, 0xd8, 0x36, 0x60, 0xde, 0x80,
+	     0x7c, 0x03, 0x1e, 0x0e, 0x18, 0x39, 0xe0, 0xe7, 0x80, 0xac,
+	     0x03, 0xd6, 0x0e, 0xa8, 0x3b, 0xe0, 0xf1, 0x80, 0xc9, 0x03,
+	     0x32, 0x0f, 0xa8, 0x3d, 0xa0, 0xf9, 0x80, 0xed, 0x03, 0xc6,
+	     0x0f, 0xf8, 0x3f, 0x20, 0x02, 0x81, 0x11, 0x04, 0x7a, 0x10,
+	     0x78, 0x42, 0xe0, 0x0b, 0x81, 0x36, 0x04, 0x0a, 0x11, 0x58,
+	     0x44, 0xe0, 0x12, 0x81, 0x57, 0x04, 0x86, 0x11, 0x58, 0x46,
+	     0x20, 0x1b, 0x81, 0x79, 0x04, 0xfa, 0x11, 0xb8, 0x48, 0xe0,
+	     0x23, 0x81, 0x98, 0x04, 0x8e, 0x12, 0x58, 0x4a, 0xa0, 0x2a,
+	     0x81, 0xb8, 0x04, 0xfa, 0x12, 0x78, 0x4c, 0xa0, 0x33, 0x81,
+	     0xd6, 0x04, 0x8e, 0x13, 0x18, 0x4f, 0xa0, 0x3d, 0x81, 0x01,
+	     0x05, 0x26, 0x14, 0x48, 0x51, 0x60, 0x47, 0x81, 0x27, 0x05,
+	     0xbe, 0x14, 0xa8, 0x53, 0xa0, 0x4f, 0x81, 0x41, 0x05, 0x32,
+	     0x15, 0x18, 0x55, 0xa0, 0x55, 0x81, 0x5d, 0x05, 0xae, 0x15,
+	     0x98, 0x57, 0xa0, 0x61, 0x81, 0x8f, 0x05, 0x56, 0x16, 0x88,
+	     0x59, 0x60, 0x68, 0x81, 0xa6, 0x05, 0xce, 0x16, 0x78, 0x5b,
+	     0x60, 0x6e, 0x81, 0xbf, 0x05, 0x1e, 0x17, 0xb8, 0x5c, 0xe0,
+	     0x74, 0x81, 0xda, 0x05, 0x7e, 0x17, 0x98, 0x5e, 0xa0, 0x7b,
+	     0x81, 0xf1, 0x05, 0xe6, 0x17, 0x78, 0x60, 0x20, 0x85, 0x81,
+	     0x19, 0x06, 0x96, 0x18, 0x18, 0x63, 0x20, 0x8e, 0x81, 0x3e,
+	     0x06, 0x06, 0x19, 0x48, 0x64, 0xa0, 0x93, 0x81, 0x52, 0x06,
+	     0x62, 0x19, 0xa8, 0x65, 0x60, 0x98, 0x81, 0x6f, 0x06, 0xde,
+	     0x19, 0xe8, 0x67, 0x60, 0xa0, 0x81, 0x8a, 0x06, 0x4e, 0x1a,
+	     0x08, 0x6a, 0x20, 0xaa, 0x81, 0xab, 0x06, 0xde, 0x1a, 0xb8,
+	     0x6b, 0x60, 0xb2, 0x81, 0xd1, 0x06, 0x6e, 0x1b, 0x18, 0x6e,
+	     0xe0, 0xbb, 0x81, 0xf7, 0x06, 0xea, 0x1b, 0xc8, 0x6f, 0x20,
+	     0xc0, 0x81, 0x04, 0x07, 0x42, 0x1c, 0xc8, 0x71, 0x60, 0xc8,
+	     0x81, 0x27, 0x07, 0xbe, 0x1c, 0x68, 0x73, 0x20, 0xcf, 0x81,
+	     0x4a, 0x07, 0x5e, 0x1d, 0xe8, 0x75, 0xe0, 0xd8, 0x81, 0x6e,
+	     0x07, 0xe2, 0x1d, 0xd8, 0x77, 0xa0, 0xe0, 0x81, 0x85, 0x07,
+	     0x2a, 0x1e, 0x28, 0x79, 0x60, 0xe5, 0x81, 0x9c, 0x07, 0xaa,
+	     0x1e, 0x38, 0x7b, 0xa0, 0xed, 0x81, 0xc3, 0x07, 0x2a, 0x1f,
+	     0x38, 0x7d, 0x20, 0xf8, 0x81, 0xe8, 0x07, 0xaa, 0x1f, 0x78,
+	     0x7f, 0xe0, 0xfe, 0x81, 0x06, 0x08, 0x3e, 0x20, 0x28, 0x81,
+	     0xe0, 0x05, 0x82, 0x1f, 0x08, 0x96, 0x20, 0x08, 0x83, 0xa0,
+	     0x0f, 0x82, 0x46, 0x08, 0x52, 0x21, 0x88, 0x85, 0xe0, 0x18,
+	     0x82, 0x69, 0x08, 0xda, 0x21, 0x08, 0x88, 0x60, 0x22, 0x82,
+	     0x93, 0x08, 0x5a, 0x22, 0xf8, 0x89, 0x60, 0x2a, 0x82, 0xb4,
+	     0x08, 0xea, 0x22, 0xd8, 0x8b, 0xe0, 0x32, 0x82, 0xd4, 0x08,
+	     0x5a, 0x23, 0x28, 0x8e, 0x60, 0x3b, 0x82, 0xf3, 0x08, 0xfa,
+	     0x23, 0x98, 0x90, 0xa0, 0x44, 0x82, 0x1f, 0x09, 0x92, 0x24,
+	     0xb8, 0x92, 0xe0, 0x4c, 0x82, 0x3d, 0x09, 0x06, 0x25, 0x78,
+	     0x94, 0x20, 0x53, 0x82, 0x4f, 0x09, 0x4e, 0x25, 0xb8, 0x95,
+	     0xa0, 0x58, 0x82, 0x68, 0x09, 0xd2, 0x25, 0x18, 0x98, 0xe0,
+	     0x61, 0x82, 0x93, 0x09, 0x7a, 0x26, 0xa8, 0x9a, 0x20, 0x6c,
+	     0x82, 0xb6, 0x09, 0x0a, 0x27, 0x78, 0x9c, 0x60, 0x73, 0x82,
+	     0xda, 0x09, 0x72, 0x27, 0xa8, 0x9e, 0xa0, 0x7b, 0x82, 0xf8,
+	     0x09, 0xf6, 0x27, 0xb8, 0xa0, 0xe0, 0x83, 0x82, 0x1c, 0x0a,
+	     0x8e, 0x28, 0xa8, 0xa2, 0xe0, 0x8c, 0x82, 0x39, 0x0a, 0x02,
+	     0x29, 0x48, 0xa4, 0xe0, 0x91, 0x82, 0x51, 0x0a, 0x7a, 0x29,
+	     0x98, 0xa6, 0xa0, 0x9c, 0x82, 0x7d, 0x0a, 0x16, 0x2a, 0x18,
+	     0xa9, 0xe0, 0xa5, 0x82, 0x9b, 0x0a, 0x86, 0x2a, 0xf8, 0xaa,
+	     0x60, 0xad, 0x82, 0xbe, 0x0a, 0x22, 0x2b, 0x58, 0xad, 0x20,
+	     0xb7, 0x82, 0xea, 0x0a, 0xc6, 0x2b, 0xa8, 0xaf, 0x60, 0xc1,
+	     0x82, 0x07, 0x0b, 0x32, 0x2c, 0x38, 0xb1, 0xa0, 0xc7, 0x82,
+	     0x21, 0x0b, 0x9e, 0x2c, 0xb8, 0xb2, 0xe0, 0xcd, 0x82, 0x45,
+	     0x0b, 0x2a, 0x2d, 0x78, 0xb5, 0x20, 0xd9, 0x82, 0x6c, 0x0b,
+	     0xbe, 0x2d, 0x98, 0xb7, 0x20, 0xe1, 0x82, 0x8e, 0x0b, 0x72,
+	     0x2e, 0x28, 0xba, 0x60, 0xeb, 0x82, 0xbb, 0x0b, 0x12, 0x2f,
+	     0x18, 0xbd, 0x20, 0xf6, 0x82, 0xe6, 0x0b, 0xae, 0x2f, 0x68,
+	     0xbf, 0x20, 0xff, 0x82, 0x05, 0x0c, 0x46, 0x30, 0x98, 0xc1,
+	     0x20, 0x08, 0x83, 0x26, 0x0c, 0xb6, 0x30, 0xf8, 0xc2, 0xe0,
+	     0x0d, 0x83, 0x3c, 0x0c, 0x1e, 0x31, 0xb8, 0xc4, 0x20, 0x14,
+	     0x83, 0x5e, 0x0c, 0x96, 0x31, 0xe8, 0xc6, 0x20, 0x1d, 0x83,
+	     0x7d, 0x0c, 0x1a, 0x32, 0x48, 0xc9, 0xa0, 0x26, 0x83, 0xa7,
+	     0x0c, 0xaa, 0x32, 0x68, 0xcb, 0xe0, 0x30, 0x83, 0xcc, 0x0c,
+	     0x42, 0x33, 0x48, 0xcd, 0xa0, 0x38, 0x83, 0xee, 0x0c, 0xce,
+	     0x33, 0xe8, 0xcf, 0x20, 0x41, 0x83, 0x06, 0x0d, 0x26, 0x34,
+	     0x28, 0xd1, 0xa0, 0x45, 0x83, 0x1f, 0x0d, 0x9a, 0x34, 0x98,
+	     0xd2, 0x60, 0x4c, 0x83, 0x38, 0x0d, 0x02, 0x35, 0x38, 0xd4,
+	     0xe0, 0x53, 0x83, 0x58, 0x0d, 0x8a, 0x35, 0x98, 0xd6, 0xa0,
+	     0x5c, 0x83, 0x80, 0x0d, 0x32, 0x36, 0x98, 0xd9, 0x20, 0x68,
+	     0x83, 0xa8, 0x0d, 0xca, 0x36, 0xb8, 0xdb, 0x60, 0x72, 0x83,
+	     0xcd, 0x0d, 0x56, 0x37, 0xd8, 0xdd, 0xe0, 0x77, 0x83, 0xec,
+	     0x0d, 0xbe, 0x37, 0x48, 0xdf, 0x20, 0x7e, 0x83, 0x01, 0x0e,
+	     0x12, 0x38, 0x18, 0xe1, 0xa0, 0x86, 0x83, 0x23, 0x0e, 0xa2,
+	     0x38, 0x68, 0xe3, 0xe0, 0x8e, 0x83, 0x45, 0x0e, 0x26, 0x39,
+	     0x18, 0xe5, 0x20, 0x97, 0x83, 0x62, 0x0e, 0xb2, 0x39, 0x38,
+	     0xe7, 0xe0, 0x9e, 0x83, 0x82, 0x0e, 0x42, 0x3a, 0x38, 0xe9,
+	     0x20, 0xa8, 0x83, 0xa3, 0x0e, 0x9e, 0x3a, 0x08, 0xeb, 0xa0,
+	     0xae, 0x83, 0xc8, 0x0e, 0x4e, 0x3b, 0x58, 0xed, 0xe0, 0xb8,
+	     0x83, 0xec, 0x0e, 0xc2, 0x3b, 0x58, 0xef, 0x20, 0xc0, 0x83,
+	     0x09, 0x0f, 0x3a, 0x3c, 0x98, 0xf1, 0x60, 0xc9, 0x83, 0x2a,
+	     0x0f, 0xde, 0x3c, 0x58, 0xf4, 0x20, 0xd4, 0x83, 0x55, 0x0f,
+	     0x8e, 0x3d, 0x78, 0xf6, 0x20, 0xdb, 0x83, 0x70, 0x0f, 0xe2,
+	     0x3d, 0xb8, 0xf7, 0x20, 0xe0, 0x83, 0x83, 0x0f, 0x1e, 0x3e,
+	     0x08, 0xf9, 0x60, 0xe7, 0x83, 0xaa, 0x0f, 0xd6, 0x3e, 0x78,
+	     0xfb, 0x60, 0xf0, 0x83, 0xc4, 0x0f, 0x46, 0x3f, 0xd8, 0xfd,
+	     0x60, 0xfa, 0x83, 0xef, 0x0f, 0xee, 0x3f, 0x08, 0x00, 0xe1,
+	     0x02, 0x84, 0x13, 0x10, 0x7a, 0x40, 0x28, 0x02, 0xe1, 0x09,
+	     0x84, 0x32, 0x10, 0xe2, 0x40, 0xf8, 0x03, 0xe1, 0x11, 0x84,
+	     0x54, 0x10, 0x7e, 0x41, 0x98, 0x06, 0x21, 0x1c, 0x84, 0x79,
+	     0x10, 0xf2, 0x41, 0xa8, 0x08, 0x61, 0x24, 0x84, 0x9a, 0x10,
+	     0x7a, 0x42, 0x48, 0x0a, 0xa1, 0x2a, 0x84, 0xb6, 0x10, 0xe2,
+	     0x42, 0x28, 0x0c, 0xe1, 0x31, 0x84, 0xce, 0x10, 0x6e, 0x43,
+	     0xf8, 0x0d, 0x61, 0x3b, 0x84, 0xf8, 0x10, 0xee, 0x43, 0x68,
+	     0x10, 0x21, 0x43, 0x84, 0x19, 0x11, 0x92, 0x44, 0xd8, 0x12,
+	     0x21, 0x4d, 0x84, 0x41, 0x11, 0x12, 0x45, 0x08, 0x15, 0xa1,
+	     0x56, 0x84, 0x62, 0x11, 0xae, 0x45, 0x38, 0x17, 0x61, 0x5e,
+	     0x84, 0x84, 0x11, 0x3e, 0x46, 0x88, 0x19, 0x61, 0x68, 0x84,
+	     0xa6, 0x11, 0xaa, 0x46, 0xd8, 0x1a, 0xe1, 0x6c, 0x84, 0xb9,
+	     0x11, 0x0e, 0x47, 0x18, 0x1d, 0xa1, 0x76, 0x84, 0xe6, 0x11,
+	     0xbe, 0x47, 0xb8, 0x1f, 0xa1, 0x80, 0x84, 0x06, 0x12, 0x3a,
+	     0x48, 0x18, 0x21, 0x21, 0x86, 0x84, 0x23, 0x12, 0xb2, 0x48,
+	     0x38, 0x23, 0xa1, 0x8f, 0x84, 0x4b, 0x12, 0x4a, 0x49, 0x98,
+	     0x25, 0x61, 0x98, 0x84, 0x6b, 0x12, 0xc2, 0x49, 0x58, 0x27,
+	     0xe1, 0x9e, 0x84, 0x83, 0x12, 0x16, 0x4a, 0xb8, 0x28, 0x21,
+	     0xa4, 0x84, 0x97, 0x12, 0x86, 0x4a, 0x88, 0x2a, 0xa1, 0xad,
+	     0x84, 0xbf, 0x12, 0x2e, 0x4b, 0xf8, 0x2c, 0x61, 0xb5, 0x84,
+	     0xdf, 0x12, 0x9e, 0x4b, 0x18, 0x2f, 0x61, 0xbd, 0x84, 0xff,
+	     0x12, 0x0a, 0x4c, 0xe8, 0x30, 0xa1, 0xc4, 0x84, 0x1a, 0x13,
+	     0x9a, 0x4c, 0x08, 0x33, 0xa1, 0xcf, 0x84, 0x49, 0x13, 0x36,
+	     0x4d, 0x48, 0x35, 0xa1, 0xd7, 0x84, 0x6b, 0x13, 0xc2, 0x4d,
+	     0x58, 0x37, 0xe1, 0xdf, 0x84, 0x81, 0x13, 0x16, 0x4e, 0x18,
+	     0x39, 0x61, 0xe6, 0x84, 0x9e, 0x13, 0xae, 0x4e, 0x88, 0x3b,
+	     0x61, 0xf1, 0x84, 0xcf, 0x13, 0x52, 0x4f, 0x88, 0x3d, 0xa1,
+	     0xf9, 0x84, 0xed, 0x13, 0xce, 0x4f, 0x18, 0x40, 0xe1, 0x01,
+	     0x85, 0x14, 0x14, 0x6e, 0x50, 0x78, 0x42, 0x61, 0x0a, 0x85,
+	     0x2d, 0x14, 0xce, 0x50, 0x18, 0x44, 0xa1, 0x11, 0x85, 0x4d,
+	     0x14, 0x52, 0x51, 0xe8, 0x45, 0x61, 0x1a, 0x85, 0x76, 0x14,
+	     0x0e, 0x52, 0x78, 0x48, 0xa1, 0x22, 0x85, 0x8d, 0x14, 0x5e,
+	     0x52, 0x08, 0x4a, 0xe1, 0x29, 0x85, 0xb5, 0x14, 0xea, 0x52,
+	     0xf8, 0x4b, 0x61, 0x33, 0x85, 0xda, 0x14, 0x7e, 0x53, 0x38,
+	     0x4e, 0x61, 0x3c, 0x85, 0xfe, 0x14, 0x32, 0x54, 0x18, 0x51,
+	     0xe1, 0x45, 0x85, 0x25, 0x15, 0xae, 0x54, 0x18, 0x53, 0xa1,
+	     0x4d, 0x85, 0x42, 0x15, 0x26, 0x55, 0x28, 0x55, 0x61, 0x57,
+	     0x85, 0x68, 0x15, 0xb2, 0x55, 0x48, 0x57, 0x61, 0x5f, 0x85,
+	     0x87, 0x15, 0x56, 0x56, 0x98, 0x59, 0xe1, 0x68, 0x85, 0xa6,
+	     0x15, 0xc6, 0x56, 0x58, 0x5b, 0xe1, 0x6e, 0x85, 0xc8, 0x15,
+	     0x52, 0x57, 0xd8, 0x5d, 0xa1, 0x7a, 0x85, 0xf2, 0x15, 0xde,
+	     0x57, 0x28, 0x60, 0x21, 0x82, 0x85, 0x0f, 0x16, 0x66, 0x58,
+	     0xb8, 0x61, 0x21, 0x89, 0x85, 0x2c, 0x16, 0xca, 0x58, 0xf8,
+	     0x63, 0x21, 0x93, 0x85, 0x50, 0x16, 0x5a, 0x59, 0xf8, 0x65,
+	     0xe1, 0x99, 0x85, 0x6b, 0x16, 0xba, 0x59, 0x78, 0x67, 0x21,
+	     0x9f, 0x85, 0x88, 0x16, 0x4e, 0x5a, 0x68, 0x69, 0xe1, 0xa7,
+	     0x85, 0xaa, 0x16, 0xc2, 0x5a, 0xe8, 0x6b, 0xa1, 0xb1, 0x85,
+	     0xcb, 0x16, 0x56, 0x5b, 0xe8, 0x6d, 0xe1, 0xb8, 0x85, 0xe9,
+	     0x16, 0xd6, 0x5b, 0xf8, 0x6f, 0xe1, 0xc0, 0x85, 0x0b, 0x17,
+	     0x4e, 0x5c, 0x88, 0x71, 0xe1, 0xc8, 0x85, 0x2d, 0x17, 0xd6,
+	     0x5c, 0x08, 0x74, 0x61, 0xd1, 0x85, 0x47, 0x17, 0x46, 0x5d,
+	     0xf8, 0x75, 0x61, 0xdb, 0x85, 0x73, 0x17, 0xee, 0x5d, 0x78,
+	     0x78, 0x61, 0xe4, 0x85, 0x9c, 0x17, 0x92, 0x5e, 0xc8, 0x7a,
+	     0x21, 0xec, 0x85, 0xba, 0x17, 0xf6, 0x5e, 0xb8, 0x7c, 0xe1,
+	     0xf3, 0x85, 0xdd, 0x17, 0x86, 0x5f, 0x68, 0x7e, 0xe1, 0xfb,
+	     0x85, 0xf6, 0x17, 0xee, 0x5f, 0x78, 0x80, 0xe1, 0x03, 0x86,
+	     0x1b, 0x18, 0x7a, 0x60, 0x08, 0x82, 0x61, 0x09, 0x86, 0x29,
+	     0x18, 0xba, 0x60, 0x28, 0x83, 0xe1, 0x0e, 0x86, 0x46, 0x18,
+	     0x32, 0x61, 0x28, 0x85, 0x61, 0x16, 0x86, 0x5c, 0x18, 0x92,
+	     0x61, 0xb8, 0x86, 0xa1, 0x1d, 0x86, 0x7b, 0x18, 0x0a, 0x62,
+	     0xc8, 0x88, 0xa1, 0x25, 0x86, 0x9c, 0x18, 0xaa, 0x62, 0x18,
+	     0x8b, 0xe1, 0x2c, 0x86, 0xb7, 0x18, 0x16, 0x63, 0xe8, 0x8c,
+	     0xa1, 0x35, 0x86, 0xe3, 0x18, 0xae, 0x63, 0x58, 0x8f, 0xe1,
+	     0x3e, 0x86, 0x06, 0x19, 0x3a, 0x64, 0x48, 0x91, 0x21, 0x48,
+	     0x86, 0x2a, 0x19, 0xbe, 0x64, 0xa8, 0x93, 0xe1, 0x50, 0x86,
+	     0x4c, 0x19, 0x62, 0x65, 0xd8, 0x95, 0x21, 0x58, 0x86, 0x64,
+	     0x19, 0xa2, 0x65, 0x38, 0x97, 0xe1, 0x5f, 0x86, 0x82, 0x19,
+	     0x26, 0x66, 0x68, 0x99, 0xe1, 0x66, 0x86, 0xa8, 0x19, 0xae,
+	     0x66, 0x28, 0x9b, 0x21, 0x70, 0x86, 0xc2, 0x19, 0x22, 0x67,
+	     0xd8, 0x9c, 0x21, 0x75, 0x86, 0xe0, 0x19, 0xae, 0x67, 0xf8,
+	     0x9e, 0x61, 0x7f, 0x86, 0x02, 0x1a, 0x1a, 0x68, 0x98, 0xa0,
+	     0xa1, 0x83, 0x86, 0x1a, 0x1a, 0x86, 0x68, 0xe8, 0xa2, 0x21,
+	     0x8f, 0x86, 0x48, 0x1a, 0x56, 0x69, 0xb8, 0xa5, 0x61, 0x99,
+	     0x86, 0x67, 0x1a, 0xbe, 0x69, 0x28, 0xa7, 0x61, 0x9e, 0x86,
+	     0x87, 0x1a, 0x2a, 0x6a, 0x88, 0xa9, 0x21, 0xa7, 0x86, 0xa8,
+	     0x1a, 0xda, 0x6a, 0xa8, 0xab, 0xe1, 0xb0, 0x86, 0xce, 0x1a,
+	     0x6e, 0x6b, 0x78, 0xae, 0x61, 0xbc, 0x86, 0xf6, 0x1a, 0x06,
+	     0x6c, 0x68, 0xb0, 0x21, 0xc4, 0x86, 0x16, 0x1b, 0x7e, 0x6c,
+	     0x48, 0xb2, 0x61, 0xca, 0x86, 0x2d, 0x1b, 0xe6, 0x6c, 0xb8,
+	     0xb3, 0xa1, 0xcf, 0x86, 0x47, 0x1b, 0x3e, 0x6d, 0x48, 0xb5,
+	     0x21, 0xd8, 0x86, 0x65, 0x1b, 0xae, 0x6d, 0x48, 0xb7, 0x61,
+	     0xdf, 0x86, 0x89, 0x1b, 0x32, 0x6e, 0xa8, 0xb9, 0xa1, 0xe8,
+	     0x86, 0xad, 0x1b, 0xc2, 0x6e, 0xe8, 0xbb, 0x21, 0xf2, 0x86,
+	     0xd0, 0x1b, 0x72, 0x6f, 0x38, 0xbe, 0xe1, 0xf9, 0x86, 0xf0,
+	     0x1b, 0xce, 0x6f, 0x08, 0xc0, 0xa1, 0x00, 0x87, 0x08, 0x1c,
+	     0x46, 0x70, 0xa8, 0xc1, 0x21, 0x0a, 0x87, 0x2d, 0x1c, 0xea,
+	     0x70, 0x68, 0xc4, 0xa1, 0x12, 0x87, 0x58, 0x1c, 0x6e, 0x71,
+	     0x58, 0xc6, 0x61, 0x1a, 0x87, 0x71, 0x1c, 0xde, 0x71, 0xa8,
+	     0xc7, 0xe1, 0x20, 0x87, 0x8b, 0x1c, 0x3e, 0x72, 0x68, 0xc9,
+	     0xe1, 0x26, 0x87, 0x9e, 0x1c, 0x96, 0x72, 0xf8, 0xca, 0x61,
+	     0x2f, 0x87, 0xc9, 0x1c, 0x5a, 0x73, 0x88, 0xcd, 0xa1, 0x38,
+	     0x87, 0xea, 0x1c, 0xc2, 0x73, 0x98, 0xcf, 0x61, 0x41, 0x87,
+	     0x0c, 0x1d, 0x62, 0x74, 0xe8, 0xd1, 0x61, 0x4a, 0x87, 0x37,
+	     0x1d, 0x02, 0x75, 0x38, 0xd4, 0xa1, 0x53, 0x87, 0x55, 0x1d,
+	     0x62, 0x75, 0xf8, 0xd5, 0xe1, 0x5a, 0x87, 0x78, 0x1d, 0x12,
+	     0x76, 0x88, 0xd8, 0xa1, 0x64, 0x87, 0x99, 0x1d, 0x96, 0x76,
+	     0x08, 0xdb, 0xa1, 0x6d, 0x87, 0xc1, 0x1d, 0x12, 0x77, 0xf8,
+	     0xdc, 0x61, 0x74, 0x87, 0xda, 0x1d, 0x82, 0x77, 0x38, 0xde,
+	     0x61, 0x7c, 0x87, 0xfc, 0x1d, 0x26, 0x78, 0xf8, 0xe0, 0xe1,
+	     0x86, 0x87, 0x28, 0x1e, 0xca, 0x78, 0xa8, 0xe3, 0xa1, 0x8f,
+	     0x87, 0x42, 0x1e, 0x22, 0x79, 0x28, 0xe5, 0x61, 0x97, 0x87,
+	     0x69, 0x1e, 0xc6, 0x79, 0x68, 0xe7, 0xa1, 0x9e, 0x87, 0x88,
+	     0x1e, 0x36, 0x7a, 0x18, 0xe9, 0xa1, 0xa7, 0x87, 0xaa, 0x1e,
+	     0xce, 0x7a, 0x68, 0xeb, 0xa1, 0xaf, 0x87, 0xcc, 0x1e, 0x56,
+	     0x7b, 0xa8, 0xed, 0xa1, 0xb8, 0x87, 0xeb, 0x1e, 0xc6, 0x7b,
+	     0x68, 0xef, 0x21, 0xc1, 0x87, 0x08, 0x1f, 0x5a, 0x7c, 0xc8,
+	     0xf1, 0xe1, 0xc7, 0x87, 0x23, 0x1f, 0x9e, 0x7c, 0x38, 0xf3,
+	     0xe1, 0xce, 0x87, 0x42, 0x1f, 0x42, 0x7d, 0x88, 0xf5, 0xa1,
+	     0xd9, 0x87, 0x6a, 0x1f, 0xb2, 0x7d, 0x48, 0xf7, 0x21, 0xe0,
+	     0x87, 0x84, 0x1f, 0x26, 0x7e, 0x18, 0xf9, 0xa1, 0xe6, 0x87,
+	     0xa4, 0x1f, 0xaa, 0x7e, 0xe8, 0xfa, 0x21, 0xef, 0x87, 0xca,
+	     0x1f, 0x5e, 0x7f, 0x28, 0xfe, 0x61, 0xf9, 0x87, 0xee, 0x1f,
+	     0xc6, 0x7f, 0xc8, 0xff, 0x21, 0x02, 0x88, 0x14, 0x20, 0x8a,
+	     0x80, 0xc8, 0x02, 0xa2, 0x0e, 0x88, 0x40, 0x20, 0x0e, 0x81,
+	     0x78, 0x04, 0x62, 0x13, 0x88, 0x58, 0x20, 0x76, 0x81, 0x78,
+	     0x06, 0x22, 0x1c, 0x88, 0x77, 0x20, 0x12, 0x82, 0xc8, 0x08,
+	     0x62, 0x25, 0x88, 0x9b, 0x20, 0x8e, 0x82, 0x58, 0x0a, 0xa2,
+	     0x2b, 0x88, 0xb8, 0x20, 0x02, 0x83, 0xb8, 0x0c, 0x22, 0x34,
+	     0x88, 0xd4, 0x20, 0x82, 0x83, 0xd8, 0x0e, 0xa2, 0x3e, 0x88,
+	     0x02, 0x21, 0x3e, 0x84, 0x88, 0x11, 0x62, 0x47, 0x88, 0x28,
+	     0x21, 0xd6, 0x84, 0x88, 0x13, 0x22, 0x51, 0x88, 0x4c, 0x21,
+	     0x46, 0x85, 0x58, 0x15, 0x22, 0x58, 0x88, 0x68, 0x21, 0xb2,
+	     0x85, 0x28, 0x17, 0x62, 0x5e, 0x88, 0x7d, 0x21, 0x12, 0x86,
+	     0xe8, 0x18, 0xe2, 0x65, 0x88, 0x9e, 0x21, 0x92, 0x86, 0x68,
+	     0x1a, 0x22, 0x6b, 0x88, 0xb2, 0x21, 0xe2, 0x86, 0x48, 0x1c,
+	     0x22, 0x73, 0x88, 0xd1, 0x21, 0x7e, 0x87, 0x98, 0x1e, 0x22,
+	     0x7d, 0x88, 0xfa, 0x21, 0x1e, 0x88, 0xe8, 0x20, 0x22, 0x87,
+	     0x88, 0x29, 0x22, 0xd6, 0x88, 0x28, 0x24, 0x62, 0x92, 0x88,
+	     0x53, 0x22, 0x66, 0x89, 0x08, 0x26, 0x62, 0x9b, 0x88, 0x6f,
+	     0x22, 0xda, 0x89, 0x28, 0x28, 0xa2, 0xa1, 0x88, 0x8a, 0x22,
+	     0x62, 0x8a, 0xf8, 0x29, 0xe2, 0xa9, 0x88, 0xb5, 0x22, 0xf6,
+	     0x8a, 0x58, 0x2c, 0xe2, 0xb2, 0x88, 0xd4, 0x22, 0x82, 0x8b,
+	     0xb8, 0x2e, 0xa2, 0xbc, 0x88, 0xf8, 0x22, 0x02, 0x8c, 0x98,
+	     0x30, 0xe2, 0xc5, 0x88, 0x24, 0x23, 0xc2, 0x8c, 0xb8, 0x33,
+	     0xe2, 0xcf, 0x88, 0x48, 0x23, 0x2a, 0x8d, 0x48, 0x35, 0xe2,
+	     0xd7, 0x88, 0x64, 0x23, 0xa6, 0x8d, 0x18, 0x37, 0xe2, 0xdf,
+	     0x88, 0x88, 0x23, 0x42, 0x8e, 0x58, 0x39, 0xe2, 0xe8, 0x88,
+	     0xa8, 0x23, 0xc6, 0x8e, 0x68, 0x3b, 0xa2, 0xef, 0x88, 0xc8,
+	     0x23, 0x4a, 0x8f, 0x78, 0x3d, 0x22, 0xf7, 0x88, 0xe9, 0x23,
+	     0xc2, 0x8f, 0xa8, 0x3f, 0x22, 0x01, 0x89, 0x10, 0x24, 0x6a,
+	     0x90, 0x48, 0x42, 0x62, 0x0a, 0x89, 0x32, 0x24, 0xea, 0x90,
+	     0x78, 0x44, 0x62, 0x14, 0x89, 0x5c, 0x24, 0x9a, 0x91, 0xd8,
+	     0x46, 0xa2, 0x1e, 0x89, 0x7c, 0x24, 0x02, 0x92, 0x98, 0x48,
+	     0x22, 0x25, 0x89, 0x98, 0x24, 0x76, 0x92, 0x08, 0x4a, 0x22,
+	     0x2a, 0x89, 0xb2, 0x24, 0xfa, 0x92, 0x88, 0x4c, 0xe2, 0x32,
+	     0x89, 0xd4, 0x24, 0x8a, 0x93, 0xa8, 0x4e, 0x62, 0x3d, 0x89,
+	     0xfa, 0x24, 0x02, 0x94, 0xc8, 0x50, 0x22, 0x46, 0x89, 0x24,
+	     0x25, 0xca, 0x94, 0xf8, 0x53, 0x22, 0x51, 0x89, 0x49, 0x25,
+	     0x52, 0x95, 0xb8, 0x55, 0x62, 0x59, 0x89, 0x68, 0x25, 0xaa,
+	     0x95, 0xd8, 0x56, 0xe2, 0x5d, 0x89, 0x82, 0x25, 0x3e, 0x96,
+	     0x78, 0x59, 0xe2, 0x68, 0x89, 0xaf, 0x25, 0xf2, 0x96, 0x78,
+	     0x5c, 0xe2, 0x73, 0x89, 0xdd, 0x25, 0xa6, 0x97, 0x38, 0x5f,
+	     0xa2, 0x7e, 0x89, 0x06, 0x26, 0x2e, 0x98, 0x88, 0x61, 0x62,
+	     0x87, 0x89, 0x27, 0x26, 0xc2, 0x98, 0xe8, 0x63, 0xa2, 0x92,
+	     0x89, 0x55, 0x26, 0x66, 0x99, 0x58, 0x66, 0x22, 0x9b, 0x89,
+	     0x70, 0x26, 0xf2, 0x99, 0x88, 0x68, 0x62, 0xa4, 0x89, 0x9e,
+	     0x26, 0x9e, 0x9a, 0x58, 0x6b, 0x62, 0xae, 0x89, 0xc3, 0x26,
+	     0x36, 0x9b, 0x38, 0x6d, 0xa2, 0xb5, 0x89, 0xe0, 0x26, 0x8a,
+	     0x9b, 0xc8, 0x6e, 0xa2, 0xbc, 0x89, 0xf6, 0x26, 0x06, 0x9c,
+	     0x78, 0x70, 0x22, 0xc3, 0x89, 0x12, 0x27, 0x82, 0x9c, 0xa8,
+	     0x72, 0x22, 0xcd, 0x89, 0x3a, 0x27, 0x16, 0x9d, 0x98, 0x74,
+	     0xa2, 0xd3, 0x89, 0x51, 0x27, 0x56, 0x9d, 0xb8, 0x75, 0xa2,
+	     0xd8, 0x89, 0x6f, 0x27, 0xee, 0x9d, 0xe8, 0x77, 0xa2, 0xe1,
+	     0x89, 0x8e, 0x27, 0x6e, 0x9e, 0x58, 0x7a, 0xe2, 0xec, 0x89,
+	     0xc1, 0x27, 0x36, 0x9f, 0x38, 0x7d, 0xa2, 0xf5, 0x89, 0xdc,
+	     0x27, 0x8e, 0x9f, 0x98, 0x7e, 0x22, 0xfc, 0x89, 0xfa, 0x27,
+	     0x12, 0xa0, 0x68, 0x80, 0xe2, 0x03, 0x8a, 0x1c, 0x28, 0x86,
+	     0xa0, 0xd8, 0x82, 0x22, 0x0e, 0x8a, 0x42, 0x28, 0x2a, 0xa1,
+	     0x38, 0x85, 0x62, 0x16, 0x8a, 0x67, 0x28, 0xbe, 0xa1, 0x58,
+	     0x87, 0xa2, 0x1e, 0x8a, 0x7e, 0x28, 0x1e, 0xa2, 0x08, 0x89,
+	     0x62, 0x27, 0x8a, 0xa1, 0x28, 0xae, 0xa2, 0xf8, 0x8a, 0xe2,
+	     0x2c, 0x8a, 0xb6, 0x28, 0xf2, 0xa2, 0xf8, 0x8b, 0x62, 0x32,
+	     0x8a, 0xd5, 0x28, 0x6e, 0xa3, 0x88, 0x8e, 0x62, 0x3c, 0x8a,
+	     0xf8, 0x28, 0xf2, 0xa3, 0xa8, 0x90, 0xa2, 0x45, 0x8a, 0x18,
+	     0x29, 0x6e, 0xa4, 0xf8, 0x91, 0x22, 0x49, 0x8a, 0x2c, 0x29,
+	     0xea, 0xa4, 0x78, 0x94, 0x62, 0x54, 0x8a, 0x5d, 0x29, 0xa6,
+	     0xa5, 0xf8, 0x96, 0x22, 0x5f, 0x8a, 0x82, 0x29, 0x36, 0xa6,
+	     0x28, 0x99, 0xa2, 0x67, 0x8a, 0xa6, 0x29, 0xca, 0xa6, 0xb8,
+	     0x9b, 0x22, 0x72, 0x8a, 0xd3, 0x29, 0x6e, 0xa7, 0x48, 0x9e,
+	     0xa2, 0x7b, 0x8a, 0xf6, 0x29, 0x0a, 0xa8, 0x78, 0xa0, 0x22,
+	     0x83, 0x8a, 0x13, 0x2a, 0x7a, 0xa8, 0xc8, 0xa2, 0x22, 0x8c,
+	     0x8a, 0x33, 0x2a, 0xe2, 0xa8, 0xa8, 0xa3, 0x62, 0x91, 0x8a,
+	     0x50, 0x2a, 0x5e, 0xa9, 0xf8, 0xa5, 0x22, 0x9b, 0x8a, 0x70,
+	     0x2a, 0xf6, 0xa9, 0xa8, 0xa8, 0xe2, 0xa5, 0x8a, 0x9a, 0x2a,
+	     0x82, 0xaa, 0x38, 0xaa, 0xa2, 0xa9, 0x8a, 0xae, 0x2a, 0xc2,
+	     0xaa, 0xb8, 0xab, 0x62, 0xb2, 0x8a, 0xcd, 0x2a, 0x52, 0xab,
+	     0xc8, 0xad, 0x62, 0xba, 0x8a, 0xf4, 0x2a, 0xde, 0xab, 0x08,
+	     0xb0, 0x62, 0xc2, 0x8a, 0x14, 0x2b, 0x7e, 0xac, 0xd8, 0xb2,
+	     0xa2, 0xcd, 0x8a, 0x3a, 0x2b, 0x0a, 0xad, 0x98, 0xb4, 0xe2,
+	     0xd4, 0x8a, 0x5a, 0x2b, 0x82, 0xad, 0xe8, 0xb6, 0x22, 0xdf,
+	     0x8a, 0x87, 0x2b, 0x3a, 0xae, 0xa8, 0xb9, 0xa2, 0xe7, 0x8a,
+	     0xa2, 0x2b, 0xaa, 0xae, 0xf8, 0xba, 0xa2, 0xee, 0x8a, 0xc0,
+	     0x2b, 0x32, 0xaf, 0x08, 0xbd, 0x62, 0xf5, 0x8a, 0xe1, 0x2b,
+	     0xb6, 0xaf, 0x68, 0xbf, 0x22, 0x01, 0x8b, 0x0a, 0x2c, 0x3e,
+	     0xb0, 0x28, 0xc1, 0xa2, 0x06, 0x8b, 0x1d, 0x2c, 0xa6, 0xb0,
+	     0x68, 0xc3, 0xa2, 0x0f, 0x8b, 0x44, 0x2c, 0x3a, 0xb1, 0x28,
+	     0xc5, 0xa2, 0x17, 0x8b, 0x69, 0x2c, 0xc2, 0xb1, 0xc8, 0xc7,
+	     0x22, 0x22, 0x8b, 0x96, 0x2c, 0x6a, 0xb2, 0x38, 0xca, 0xa2,
+	     0x2a, 0x8b, 0xb7, 0x2c, 0x12, 0xb3, 0x68, 0xcc, 0x62, 0x33,
+	     0x8b, 0xd4, 0x2c, 0x7e, 0xb3, 0x78, 0xce, 0xa2, 0x3a, 0x8b,
+	     0xf6, 0x2c, 0xea, 0xb3, 0xe8, 0xcf, 0x62, 0x42, 0x8b, 0x0f,
+	     0x2d, 0x76, 0xb4, 0x48, 0xd2, 0x22, 0x4c, 0x8b, 0x3b, 0x2d,
+	     0x26, 0xb5, 0x38, 0xd5, 0x62, 0x57, 0x8b, 0x64, 0x2d, 0x9e,
+	     0xb5, 0xb8, 0xd6, 0x62, 0x5d, 0x8b, 0x77, 0x2d, 0xf6, 0xb5,
+	     0x08, 0xd8, 0x22, 0x63, 0x8b, 0x99, 0x2d, 0x72, 0xb6, 0x78,
+	     0xda, 0xe2, 0x6a, 0x8b, 0xaf, 0x2d, 0xd6, 0xb6, 0xc8, 0xdb,
+	     0xe2, 0x6f, 0x8b, 0xc9, 0x2d, 0x42, 0xb7, 0x58, 0xdd, 0xa2,
+	     0x76, 0x8b, 0xdd, 0x2d, 0xa2, 0xb7, 0x58, 0xdf, 0x22, 0x7f,
+	     0x8b, 0x02, 0x2e, 0x1a, 0xb8, 0x18, 0xe1, 0xe2, 0x87, 0x8b,
+	     0x29, 0x2e, 0xba, 0xb8, 0x88, 0xe3, 0xa2, 0x8f, 0x8b, 0x40,
+	     0x2e, 0x36, 0xb9, 0x88, 0xe5, 0x22, 0x97, 0x8b, 0x6a, 0x2e,
+	     0xd2, 0xb9, 0xb8, 0xe7, 0x62, 0xa0, 0x8b, 0x85, 0x2e, 0x42,
+	     0xba, 0x98, 0xe9, 0xe2, 0xa7, 0x8b, 0xa7, 0x2e, 0xd6, 0xba,
+	     0xc8, 0xeb, 0x22, 0xb2, 0x8b, 0xd4, 0x2e, 0x82, 0xbb, 0xc8,
+	     0xee, 0x22, 0xbd, 0x8b, 0xff, 0x2e, 0x0e, 0xbc, 0x68, 0xf0,
+	     0x62, 0xc4, 0x8b, 0x17, 0x2f, 0x6e, 0xbc, 0x38, 0xf2, 0x62,
+	     0xcc, 0x8b, 0x38, 0x2f, 0x06, 0xbd, 0xa8, 0xf4, 0x62, 0xd4,
+	     0x8b, 0x5e, 0x2f, 0x9a, 0xbd, 0x48, 0xf7, 0xa2, 0xdd, 0x8b,
+	     0x7a, 0x2f, 0x1a, 0xbe, 0x38, 0xf9, 0xe2, 0xe5, 0x8b, 0x9b,
+	     0x2f, 0x9a, 0xbe, 0xb8, 0xfa, 0x22, 0xec, 0x8b, 0xb7, 0x2f,
+	     0x0e, 0xbf, 0x88, 0xfc, 0xa2, 0xf4, 0x8b, 0xd5, 0x2f, 0x76,
+	     0xbf, 0x08, 0xfe, 0xe2, 0xf9, 0x8b, 0xf5, 0x2f, 0xf6, 0xbf,
+	     0x08, 0x00, 0xe3, 0x00, 0x8c, 0x0a, 0x30, 0x5a, 0xc0, 0x98,
+	     0x01, 0xe3, 0x06, 0x8c, 0x28, 0x30, 0xc2, 0xc0, 0x48, 0x03,
+	     0xe3, 0x0d, 0x8c, 0x45, 0x30, 0x3e, 0xc1, 0x78, 0x05, 0x23,
+	     0x18, 0x8c, 0x66, 0x30, 0xbe, 0xc1, 0x28, 0x07, 0xe3, 0x1d,
+	     0x8c, 0x7e, 0x30, 0x06, 0xc2, 0x68, 0x08, 0x63, 0x22, 0x8c,
+	     0x91, 0x30, 0x66, 0xc2, 0x48, 0x0a, 0x63, 0x2a, 0x8c, 0xb0,
+	     0x30, 0xfa, 0xc2, 0xc8, 0x0c, 0x23, 0x35, 0x8c, 0xe0, 0x30,
+	     0x92, 0xc3, 0xf8, 0x0e, 0x63, 0x3f, 0x8c, 0x09, 0x31, 0x2e,
+	     0xc4, 0x58, 0x11, 0x23, 0x47, 0x8c, 0x20, 0x31, 0x92, 0xc4,
+	     0x98, 0x12, 0x63, 0x4d, 0x8c, 0x3b, 0x31, 0x26, 0xc5, 0x68,
+	     0x15, 0xa3, 0x57, 0x8c, 0x66, 0x31, 0xaa, 0xc5, 0xf8, 0x16,
+	     0x23, 0x5d, 0x8c, 0x80, 0x31, 0x2e, 0xc6, 0x68, 0x19, 0xa3,
+	     0x68, 0x8c, 0xad, 0x31, 0xe6, 0xc6, 0x78, 0x1c, 0x63, 0x73,
+	     0x8c, 0xd6, 0x31, 0x76, 0xc7, 0xa8, 0x1e, 0x63, 0x7c, 0x8c,
+	     0xfd, 0x31, 0x1a, 0xc8, 0x38, 0x21, 0xe3, 0x86, 0x8c, 0x28,
+	     0x32, 0xbe, 0xc8, 0x18, 0x23, 0x23, 0x8d, 0x8c, 0x3b, 0x32,
+	     0xfa, 0xc8, 0xc8, 0x24, 0x63, 0x94, 0x8c, 0x5d, 0x32, 0xae,
+	     0xc9, 0x68, 0x27, 0x63, 0x9f, 0x8c, 0x82, 0x32, 0x42, 0xca,
+	     0x78, 0x29, 0x63, 0xa8, 0x8c, 0xa9, 0x32, 0xc6, 0xca, 0x98,
+	     0x2b, 0x23, 0xb1, 0x8c, 0xca, 0x32, 0x4a, 0xcb, 0x78, 0x2d,
+	     0xa3, 0xb6, 0x8c, 0xe5, 0x32, 0xc6, 0xcb, 0x98, 0x2f, 0xe3,
+	     0xbf, 0x8c, 0x0b, 0x33, 0x4a, 0xcc, 0x48, 0x31, 0xa3, 0xc8,
+	     0x8c, 0x25, 0x33, 0xbe, 0xcc, 0x28, 0x33, 0x63, 0xce, 0x8c,
+	     0x46, 0x33, 0x32, 0xcd, 0x38, 0x35, 0xe3, 0xd7, 0x8c, 0x6c,
+	     0x33, 0xc2, 0xcd, 0xa8, 0x37, 0xa3, 0xdf, 0x8c, 0x8c, 0x33,
+	     0x66, 0xce, 0x68, 0x3a, 0xa3, 0xeb, 0x8c, 0xb5, 0x33, 0xea,
+	     0xce, 0x08, 0x3c, 0xe3, 0xf1, 0x8c, 0xd0, 0x33, 0x72, 0xcf,
+	     0x98, 0x3e, 0x63, 0xfb, 0x8c, 0xf8, 0x33, 0x16, 0xd0, 0x98,
+	     0x40, 0xa3, 0x03, 0x8d, 0x19, 0x34, 0x8e, 0xd0, 0xb8, 0x42,
+	     0x63, 0x0b, 0x8d, 0x32, 0x34, 0xde, 0xd0, 0xf8, 0x43, 0xe3,
+	     0x11, 0x8d, 0x51, 0x34, 0x66, 0xd1, 0xe8, 0x45, 0xe3, 0x1a,
+	     0x8d, 0x6e, 0x34, 0xf2, 0xd1, 0x98, 0x48, 0xa3, 0x23, 0x8d,
+	     0x91, 0x34, 0x7a, 0xd2, 0x58, 0x4a, 0x23, 0x2c, 0x8d, 0xb6,
+	     0x34, 0x12, 0xd3, 0x28, 0x4d, 0xe3, 0x37, 0x8d, 0xe4, 0x34,
+	     0xa6, 0xd3, 0xc8, 0x4e, 0x23, 0x3c, 0x8d, 0xf5, 0x34, 0xee,
+	     0xd3, 0xd8, 0x4f, 0xa3, 0x41, 0x8d, 0x10, 0x35, 0x66, 0xd4,
+	     0x68, 0x52, 0xa3, 0x4a, 0x8d, 0x34, 0x35, 0x0a, 0xd5, 0xf8,
+	     0x54, 0xa3, 0x56, 0x8d, 0x62, 0x35, 0xaa, 0xd5, 0x48, 0x57,
+	     0xa3, 0x5e, 0x8d, 0x87, 0x35, 0x2e, 0xd6, 0x58, 0x59, 0x23,
+	     0x68, 0x8d, 0xa5, 0x35, 0xa2, 0xd6, 0x58, 0x5b, 0x23, 0x70,
+	     0x8d, 0xcd, 0x35, 0x46, 0xd7, 0x58, 0x5d, 0x63, 0x76, 0x8d,
+	     0xdb, 0x35, 0x7a, 0xd7, 0x18, 0x5e, 0xe3, 0x79, 0x8d, 0xf3,
+	     0x35, 0xf6, 0xd7, 0xa8, 0x60, 0xa3, 0x84, 0x8d, 0x1a, 0x36,
+	     0x7a, 0xd8, 0xc8, 0x62, 0x23, 0x8d, 0x8d, 0x3c, 0x36, 0x02,
+	     0xd9, 0x58, 0x64, 0x63, 0x94, 0x8d, 0x59, 0x36, 0x82, 0xd9,
+	     0x48, 0x66, 0xe3, 0x99, 0x8d, 0x72, 0x36, 0xd6, 0xd9, 0x98,
+	     0x67, 0xa3, 0x9f, 0x8d, 0x86, 0x36, 0x2e, 0xda, 0x38, 0x69,
+	     0x63, 0xa8, 0x8d, 0xa3, 0x36, 0xaa, 0xda, 0xe8, 0x6a, 0xe3,
+	     0xac, 0x8d, 0xbc, 0x36, 0x2a, 0xdb, 0x08, 0x6d, 0xa3, 0xb6,
+	     0x8d, 0xe2, 0x36, 0xbe, 0xdb, 0xd8, 0x6f, 0xa3, 0xc0, 0x8d,
+	     0x0a, 0x37, 0x4a, 0xdc, 0x08, 0x72, 0x63, 0xca, 0x8d, 0x31,
+	     0x37, 0xda, 0xdc, 0xd8, 0x73, 0x63, 0xd0, 0x8d, 0x4c, 0x37,
+	     0x46, 0xdd, 0xa8, 0x75, 0xa3, 0xd7, 0x8d, 0x6c, 0x37, 0xba,
+	     0xdd, 0x58, 0x77, 0x63, 0xde, 0x8d, 0x80, 0x37, 0x32, 0xde,
+	     0x88, 0x79, 0xe3, 0xe8, 0x8d, 0xab, 0x37, 0xc6, 0xde, 0xf8,
+	     0x7b, 0xe3, 0xf1, 0x8d, 0xca, 0x37, 0x3a, 0xdf, 0x68, 0x7d,
+	     0xe3, 0xf7, 0x8d, 0xe3, 0x37, 0xc6, 0xdf, 0x88, 0x7f, 0xa3,
+	     0x00, 0x8e, 0x07, 0x38, 0x3e, 0xe0, 0xd8, 0x81, 0xe3, 0x08,
+	     0x8e, 0x30, 0x38, 0xf6, 0xe0, 0x98, 0x84, 0x63, 0x13, 0x8e,
+	     0x54, 0x38, 0x7e, 0xe1, 0x18, 0x86, 0xa3, 0x1b, 0x8e, 0x72,
+	     0x38, 0xe6, 0xe1, 0xf8, 0x87, 0x23, 0x21, 0x8e, 0x8a, 0x38,
+	     0x62, 0xe2, 0xb8, 0x89, 0x63, 0x28, 0x8e, 0xa5, 0x38, 0xce,
+	     0xe2, 0xa8, 0x8b, 0x23, 0x30, 0x8e, 0xc9, 0x38, 0x3a, 0xe3,
+	     0x38, 0x8d, 0x23, 0x36, 0x8e, 0xe0, 0x38, 0xb6, 0xe3, 0x08,
+	     0x8f, 0xe3, 0x3c, 0x8e, 0xfe, 0x38, 0x06, 0xe4, 0xf8, 0x90,
+	     0x63, 0x46, 0x8e, 0x25, 0x39, 0xc6, 0xe4, 0xa8, 0x93, 0x23,
+	     0x51, 0x8e, 0x4f, 0x39, 0x6e, 0xe5, 0x08, 0x96, 0x23, 0x59,
+	     0x8e, 0x72, 0x39, 0xf6, 0xe5, 0xf8, 0x97, 0x63, 0x62, 0x8e,
+	     0x8e, 0x39, 0x66, 0xe6, 0x28, 0x9a, 0x23, 0x6b, 0x8e, 0xb8,
+	     0x39, 0xfa, 0xe6, 0xa8, 0x9c, 0x23, 0x76, 0x8e, 0xe0, 0x39,
+	     0xa6, 0xe7, 0xc8, 0x9e, 0xe3, 0x7d, 0x8e, 0xfe, 0x39, 0x12,
+	     0xe8, 0x28, 0xa1, 0xe3, 0x87, 0x8e, 0x2a, 0x3a, 0xe2, 0xe8,
+	     0x48, 0xa4, 0xe3, 0x92, 0x8e, 0x4f, 0x3a, 0x6e, 0xe9, 0x98,
+	     0xa6, 0xe3, 0x9c, 0x8e, 0x77, 0x3a, 0xfe, 0xe9, 0x18, 0xa8,
+	     0xa3, 0xa3, 0x8e, 0x91, 0x3a, 0x62, 0xea, 0x68, 0xaa, 0xe3,
+	     0xaa, 0x8e, 0xae, 0x3a, 0xf2, 0xea, 0x68, 0xac, 0x63, 0xb4,
+	     0x8e, 0xdb, 0x3a, 0x86, 0xeb, 0xe8, 0xae, 0xe3, 0xbd, 0x8e,
+	     0x02, 0x3b, 0x2e, 0xec, 0x88, 0xb1, 0x63, 0xc9, 0x8e, 0x2f,
+	     0x3b, 0xce, 0xec, 0xa8, 0xb3, 0x23, 0xd1, 0x8e, 0x4d, 0x3b,
+	     0x3e, 0xed, 0xb8, 0xb5, 0x63, 0xd8, 0x8e, 0x65, 0x3b, 0xa2,
+	     0xed, 0x58, 0xb7, 0x23, 0xdf, 0x8e, 0x86, 0x3b, 0x3e, 0xee,
+	     0x48, 0xb9, 0x23, 0xe8, 0x8e, 0xab, 0x3b, 0xd2, 0xee, 0x18,
+	     0xbc, 0x63, 0xf1, 0x8e, 0xcb, 0x3b, 0x4a, 0xef, 0x68, 0xbd,
+	     0xa3, 0xf6, 0x8e, 0xe7, 0x3b, 0xb2, 0xef, 0xf8, 0xbe, 0x63,
+	     0xfd, 0x8e, 0x00, 0x3c, 0x1a, 0xf0, 0x48, 0xc1, 0xa3, 0x06,
+	     0x8f, 0x25, 0x3c, 0x9e, 0xf0, 0xf8, 0xc2, 0x23, 0x0f, 0x8f,
+	     0x49, 0x3c, 0x3e, 0xf1, 0x28, 0xc5, 0x23, 0x17, 0x8f, 0x64,
+	     0x3c, 0xba, 0xf1, 0xb8, 0xc7, 0xe3, 0x21, 0x8f, 0x8f, 0x3c,
+	     0x56, 0xf2, 0xb8, 0xc9, 0xe3, 0x29, 0x8f, 0xac, 0x3c, 0xce,
+	     0xf2, 0xe8, 0xcb, 0xe3, 0x30, 0x8f, 0xcc, 0x3c, 0x46, 0xf3,
+	     0x58, 0xcd, 0xe3, 0x36, 0x8f, 0xe0, 0x3c, 0xae, 0xf3, 0xf8,
+	     0xce, 0x63, 0x3d, 0x8f, 0x00, 0x3d, 0x16, 0xf4, 0x78, 0xd0,
+	     0x63, 0x45, 0x8f, 0x1a, 0x3d, 0x92, 0xf4, 0x18, 0xd3, 0x63,
+	     0x4f, 0x8f, 0x4a, 0x3d, 0x46, 0xf5, 0x68, 0xd5, 0xe3, 0x58,
+	     0x8f, 0x68, 0x3d, 0xda, 0xf5, 0x18, 0xd8, 0x23, 0x63, 0x8f,
+	     0x8f, 0x3d, 0x52, 0xf6, 0x08, 0xda, 0x63, 0x6b, 0x8f, 0xb4,
+	     0x3d, 0xe6, 0xf6, 0x48, 0xdc, 0x23, 0x72, 0x8f, 0xd0, 0x3d,
+	     0x5e, 0xf7, 0xb8, 0xdd, 0xa3, 0x78, 0x8f, 0xe5, 0x3d, 0xaa,
+	     0xf7, 0xc8, 0xde, 0xa3, 0x7c, 0x8f, 0xff, 0x3d, 0x26, 0xf8,
+	     0x28, 0xe1, 0xe3, 0x85, 0x8f, 0x1d, 0x3e, 0x9a, 0xf8, 0x28,
+	     0xe3, 0xa3, 0x8e, 0x8f, 0x45, 0x3e, 0x46, 0xf9, 0xd8, 0xe5,
+	     0xa3, 0x98, 0x8f, 0x6b, 0x3e, 0xc6, 0xf9, 0xe8, 0xe7, 0x63,
+	     0xa0, 0x8f, 0x8e, 0x3e, 0x4e, 0xfa, 0x08, 0xea, 0x23, 0xaa,
+	     0x8f, 0xb5, 0x3e, 0x0e, 0xfb, 0x18, 0xed, 0x63, 0xb7, 0x8f,
+	     0xeb, 0x3e, 0xca, 0xfb, 0x58, 0xef, 0x63, 0xbf, 0x8f, 0xff,
+	     0x3e, 0x1e, 0xfc, 0xc8, 0xf0, 0xa3, 0xc6, 0x8f, 0x24, 0x3f,
+	     0xba, 0xfc, 0x18, 0xf3, 0xa3, 0xce, 0x8f, 0x46, 0x3f, 0x3e,
+	     0xfd, 0x98, 0xf5, 0xe3, 0xd8, 0x8f, 0x70, 0x3f, 0xd6, 0xfd,
+	     0x28, 0xf8, 0x63, 0xe2, 0x8f, 0x91, 0x3f, 0x76, 0xfe, 0x78,
+	     0xfa, 0xe3, 0xec, 0x8f, 0xbd, 0x3f, 0x2e, 0xff, 0xe8, 0xfc,
+	     0x63, 0xf4, 0x8f, 0xdc, 0x3f, 0x7e, 0xff, 0x68, 0xfe, 0x63,
+	     0xfb, 0x8f, 0xf9, 0x3f, 0x16, 0x00, 0x39, 0x01, 0x64, 0x05,
+	     0x90, 0x1d, 0x40, 0x9a, 0x00, 0x99, 0x02, 0xe4, 0x0d, 0x90,
+	     0x44, 0x40, 0x3a, 0x01, 0x19, 0x05, 0xe4, 0x17, 0x90, 0x64,
+	     0x40, 0xb2, 0x01, 0xa9, 0x07, 0xa4, 0x1f, 0x90, 0x88, 0x40,
+	     0x5a, 0x02, 0x99, 0x09, 0xe4, 0x29, 0x90, 0xad, 0x40, 0xc6,
+	     0x02, 0x59, 0x0b, 0xa4, 0x30, 0x90, 0xcf, 0x40, 0x5a, 0x03,
+	     0x39, 0x0e, 0xe4, 0x3b, 0x90, 0xf2, 0x40, 0xe6, 0x03, 0xc9,
+	     0x0f, 0x24, 0x42, 0x90, 0x0e, 0x41, 0x5e, 0x04, 0xc9, 0x11,
+	     0xa4, 0x48, 0x90, 0x24, 0x41, 0xbe, 0x04, 0x39, 0x13, 0x24,
+	     0x4e, 0x90, 0x3c, 0x41, 0x12, 0x05, 0x19, 0x15, 0x64, 0x56,
+	     0x90, 0x5c, 0x41, 0x8a, 0x05, 0x69, 0x16, 0x64, 0x5a, 0x90,
+	     0x72, 0x41, 0xe6, 0x05, 0xe9, 0x17, 0xe4, 0x61, 0x90, 0x8f,
+	     0x41, 0x5e, 0x06, 0xa9, 0x19, 0xe4, 0x67, 0x90, 0xa6, 0x41,
+	     0xc2, 0x06, 0x39, 0x1b, 0xa4, 0x6e, 0x90, 0xbe, 0x41, 0x22,
+	     0x07, 0x59, 0x1d, 0x24, 0x77, 0x90, 0xe6, 0x41, 0xce, 0x07,
+	     0xa9, 0x1f, 0x64, 0x7f, 0x90, 0x09, 0x42, 0x52, 0x08, 0xf9,
+	     0x21, 0xa4, 0x89, 0x90, 0x29, 0x42, 0xde, 0x08, 0xb9, 0x23,
+	     0xe4, 0x8f, 0x90, 0x4b, 0x42, 0x56, 0x09, 0xe9, 0x25, 0x64,
+	     0x99, 0x90, 0x68, 0x42, 0xd6, 0x09, 0x89, 0x27, 0xa4, 0xa0,
+	     0x90, 0x87, 0x42, 0x32, 0x0a, 0x89, 0x29, 0xa4, 0xa7, 0x90,
+	     0xac, 0x42, 0xd2, 0x0a, 0x89, 0x2b, 0x24, 0xb1, 0x90, 0xc7,
+	     0x42, 0x46, 0x0b, 0xe9, 0x2d, 0xe4, 0xba, 0x90, 0xed, 0x42,
+	     0xe6, 0x0b, 0x19, 0x30, 0xa4, 0xc3, 0x90, 0x12, 0x43, 0x72,
+	     0x0c, 0x19, 0x32, 0xe4, 0xc9, 0x90, 0x2b, 0x43, 0xda, 0x0c,
+	     0xd9, 0x33, 0xe4, 0xd1, 0x90, 0x4e, 0x43, 0x6e, 0x0d, 0x19,
+	     0x36, 0x64, 0xda, 0x90, 0x6f, 0x43, 0xda, 0x0d, 0xa9, 0x37,
+	     0x24, 0xe0, 0x90, 0x84, 0x43, 0x4a, 0x0e, 0x79, 0x39, 0xa4,
+	     0xe7, 0x90, 0xa3, 0x43, 0x9e, 0x0e, 0xa9, 0x3a, 0xa4, 0xec,
+	     0x90, 0xb5, 0x43, 0xf6, 0x0e, 0x99, 0x3c, 0x64, 0xf5, 0x90,
+	     0xda, 0x43, 0x82, 0x0f, 0xa9, 0x3e, 0x64, 0xfb, 0x90, 0xf8,
+	     0x43, 0x0e, 0x10, 0x79, 0x40, 0xa4, 0x04, 0x91, 0x1a, 0x44,
+	     0x82, 0x10, 0xa9, 0x42, 0x24, 0x0d, 0x91, 0x3f, 0x44, 0x0e,
+	     0x11, 0xd9, 0x44, 0x64, 0x15, 0x91, 0x59, 0x44, 0x7a, 0x11,
+	     0x79, 0x46, 0xa4, 0x1b, 0x91, 0x78, 0x44, 0xf6, 0x11, 0x39,
+	     0x48, 0xe4, 0x23, 0x91, 0x9a, 0x44, 0x72, 0x12, 0x59, 0x4a,
+	     0xe4, 0x2c, 0x91, 0xbc, 0x44, 0x0a, 0x13, 0x99, 0x4c, 0xa4,
+	     0x35, 0x91, 0xdd, 0x44, 0x96, 0x13, 0x39, 0x4f, 0x64, 0x40,
+	     0x91, 0x0d, 0x45, 0x5a, 0x14, 0xc9, 0x51, 0xe4, 0x48, 0x91,
+	     0x2d, 0x45, 0xd2, 0x14, 0xa9, 0x53, 0xa4, 0x50, 0x91, 0x50,
+	     0x45, 0x66, 0x15, 0x69, 0x56, 0x64, 0x5b, 0x91, 0x7b, 0x45,
+	     0x22, 0x16, 0xe9, 0x58, 0xe4, 0x66, 0x91, 0xa4, 0x45, 0xaa,
+	     0x16, 0x79, 0x5b, 0x64, 0x6f, 0x91, 0xcb, 0x45, 0x66, 0x17,
+	     0x19, 0x5e, 0x24, 0x7a, 0x91, 0xf6, 0x45, 0x0a, 0x18, 0xf9,
+	     0x60, 0x64, 0x86, 0x91, 0x1e, 0x46, 0x9e, 0x18, 0xa9, 0x62,
+	     0xa4, 0x8d, 0x91, 0x41, 0x46, 0x16, 0x19, 0x99, 0x64, 0x24,
+	     0x95, 0x91, 0x5a, 0x46, 0x9e, 0x19, 0xd9, 0x66, 0x64, 0x9e,
+	     0x91, 0x7e, 0x46, 0x16, 0x1a, 0xf9, 0x68, 0x24, 0xa7, 0x91,
+	     0xa5, 0x46, 0xb6, 0x1a, 0x79, 0x6b, 0xe4, 0xae, 0x91, 0xbe,
+	     0x46, 0x26, 0x1b, 0xe9, 0x6c, 0xa4, 0xb4, 0x91, 0xdc, 0x46,
+	     0x7e, 0x1b, 0x79, 0x6e, 0x24, 0xbc, 0x91, 0xf4, 0x46, 0xe6,
+	     0x1b, 0xe9, 0x6f, 0x24, 0xc0, 0x91, 0x09, 0x47, 0x4a, 0x1c,
+	     0x79, 0x71, 0x64, 0xc9, 0x91, 0x28, 0x47, 0xce, 0x1c, 0x89,
+	     0x73, 0x64, 0xcf, 0x91, 0x47, 0x47, 0x3a, 0x1d, 0xc9, 0x75,
+	     0xe4, 0xd8, 0x91, 0x6b, 0x47, 0xc6, 0x1d, 0xe9, 0x77, 0xa4,
+	     0xe1, 0x91, 0x8a, 0x47, 0x4e, 0x1e, 0x89, 0x79, 0xa4, 0xe9,
+	     0x91, 0xaf, 0x47, 0xea, 0x1e, 0x59, 0x7c, 0x64, 0xf2, 0x91,
+	     0xcf, 0x47, 0x4a, 0x1f, 0x79, 0x7d, 0xa4, 0xf8, 0x91, 0xec,
+	     0x47, 0xe2, 0x1f, 0x59, 0x80, 0xe4, 0x03, 0x92, 0x14, 0x48,
+	     0x5a, 0x20, 0x49, 0x82, 0xe4, 0x0a, 0x92, 0x37, 0x48, 0xf2,
+	     0x20, 0x79, 0x84, 0x24, 0x15, 0x92, 0x57, 0x48, 0x6a, 0x21,
+	     0x59, 0x86, 0x64, 0x1b, 0x92, 0x79, 0x48, 0x1a, 0x22, 0xd9,
+	     0x88, 0xe4, 0x26, 0x92, 0xa7, 0x48, 0xd6, 0x22, 0xa9, 0x8b,
+	     0xe4, 0x31, 0x92, 0xce, 0x48, 0x4a, 0x23, 0xd9, 0x8d, 0xa4,
+	     0x3a, 0x92, 0xf2, 0x48, 0xfa, 0x23, 0x89, 0x90, 0xa4, 0x44,
+	     0x92, 0x20, 0x49, 0xae, 0x24, 0x59, 0x93, 0xe4, 0x50, 0x92,
+	     0x4f, 0x49, 0x72, 0x25, 0xe9, 0x95, 0x64, 0x5a, 0x92, 0x76,
+	     0x49, 0x06, 0x26, 0xe9, 0x98, 0x64, 0x66, 0x92, 0x9d, 0x49,
+	     0xa2, 0x26, 0x29, 0x9b, 0x64, 0x6e, 0x92, 0xbf, 0x49, 0x16,
+	     0x27, 0xa9, 0x9c, 0x24, 0x75, 0x92, 0xdd, 0x49, 0xae, 0x27,
+	     0x69, 0x9f, 0xa4, 0x80, 0x92, 0x06, 0x4a, 0x3a, 0x28, 0x99,
+	     0xa1, 0x64, 0x88, 0x92, 0x2c, 0x4a, 0xe6, 0x28, 0x49, 0xa4,
+	     0xa4, 0x91, 0x92, 0x51, 0x4a, 0x52, 0x29, 0xc9, 0xa5, 0xa4,
+	     0x9a, 0x92, 0x77, 0x4a, 0xea, 0x29, 0x39, 0xa8, 0x24, 0xa3,
+	     0x92, 0x9a, 0x4a, 0x9e, 0x2a, 0x49, 0xab, 0x64, 0xb0, 0x92,
+	     0xca, 0x4a, 0x4e, 0x2b, 0x89, 0xad, 0x24, 0xb8, 0x92, 0xe6,
+	     0x4a, 0xb2, 0x2b, 0x89, 0xaf, 0xa4, 0xbf, 0x92, 0x03, 0x4b,
+	     0x32, 0x2c, 0x09, 0xb1, 0x64, 0xc6, 0x92, 0x21, 0x4b, 0xb6,
+	     0x2c, 0xf9, 0xb2, 0x64, 0xce, 0x92, 0x40, 0x4b, 0x2e, 0x2d,
+	     0x99, 0xb5, 0x24, 0xd8, 0x92, 0x67, 0x4b, 0xae, 0x2d, 0x39,
+	     0xb7, 0xe4, 0xdd, 0x92, 0x84, 0x4b, 0x32, 0x2e, 0x79, 0xb9,
+	     0x64, 0xe9, 0x92, 0xaa, 0x4b, 0xd2, 0x2e, 0x29, 0xbc, 0x24,
+	     0xf3, 0x92, 0xd3, 0x4b, 0x5e, 0x2f, 0x29, 0xbe, 0x24, 0xfb,
+	     0x92, 0xf3, 0x4b, 0x02, 0x30, 0xd9, 0xc0, 0x24, 0x04, 0x93,
+	     0x18, 0x4c, 0x82, 0x30, 0xd9, 0xc2, 0x64, 0x0e, 0x93, 0x46,
+	     0x4c, 0x36, 0x31, 0x99, 0xc5, 0x64, 0x18, 0x93, 0x68, 0x4c,
+	     0xb6, 0x31, 0xf9, 0xc6, 0x64, 0x1d, 0x93, 0x81, 0x4c, 0x12,
+	     0x32, 0x79, 0xc8, 0x24, 0x25, 0x93, 0x9a, 0x4c, 0x86, 0x32,
+	     0x79, 0xca, 0xe4, 0x2c, 0x93, 0xba, 0x4c, 0x22, 0x33, 0xd9,
+	     0xcc, 0x24, 0x34, 0x93, 0xd6, 0x4c, 0x8e, 0x33, 0x99, 0xce,
+	     0xe4, 0x3d, 0x93, 0x02, 0x4d, 0x1e, 0x34, 0xd9, 0xd0, 0x64,
+	     0x44, 0x93, 0x1d, 0x4d, 0xa2, 0x34, 0xe9, 0xd2, 0xa4, 0x4d,
+	     0x93, 0x3a, 0x4d, 0xfa, 0x34, 0x99, 0xd4, 0xa4, 0x54, 0x93,
+	     0x58, 0x4d, 0x8a, 0x35, 0xb9, 0xd6, 0x64, 0x5c, 0x93, 0x77,
+	     0x4d, 0x12, 0x36, 0x69, 0xd8, 0xe4, 0x63, 0x93, 0x9d, 0x4d,
+	     0x82, 0x36, 0xb9, 0xda, 0xa4, 0x6d, 0x93, 0xc2, 0x4d, 0x1e,
+	     0x37, 0xa9, 0xdc, 0xe4, 0x73, 0x93, 0xdd, 0x4d, 0xaa, 0x37,
+	     0x19, 0xdf, 0xe4, 0x7d, 0x93, 0xfa, 0x4d, 0x12, 0x38, 0xd9,
+	     0xe0, 0xe4, 0x85, 0x93, 0x1e, 0x4e, 0xb2, 0x38, 0xa9, 0xe3,
+	     0x64, 0x91, 0x93, 0x50, 0x4e, 0x62, 0x39, 0x19, 0xe6, 0xe4,
+	     0x9b, 0x93, 0x79, 0x4e, 0x0e, 0x3a, 0xb9, 0xe8, 0xe4, 0xa5,
+	     0x93, 0xa4, 0x4e, 0xb6, 0x3a, 0xf9, 0xea, 0x64, 0xaf, 0x93,
+	     0xc5, 0x4e, 0x26, 0x3b, 0x59, 0xed, 0xe4, 0xb8, 0x93, 0xe7,
+	     0x4e, 0xd2, 0x3b, 0xa9, 0xef, 0x24, 0xc1, 0x93, 0x0f, 0x4f,
+	     0x6e, 0x3c, 0x59, 0xf2, 0xa4, 0xcc, 0x93, 0x40, 0x4f, 0x2e,
+	     0x3d, 0x79, 0xf5, 0x64, 0xd9, 0x93, 0x6f, 0x4f, 0xe2, 0x3d,
+	     0xe9, 0xf7, 0x24, 0xe3, 0x93, 0x94, 0x4f, 0x86, 0x3e, 0x99,
+	     0xfa, 0xe4, 0xeb, 0x93, 0xbc, 0x4f, 0x02, 0x3f, 0x29, 0xfc,
+	     0xe4, 0xf2, 0x93, 0xce, 0x4f, 0x4e, 0x3f, 0xf9, 0xfd, 0xe4,
+	     0xf9, 0x93, 0xef, 0x4f, 0xda, 0x3f, 0x39, 0x00, 0xa5, 0x01,
+	     0x94, 0x0b, 0x50, 0x3e, 0x40, 0x89, 0x01, 0x65, 0x07, 0x94,
+	     0x29, 0x50, 0xca, 0x40, 0x59, 0x03, 0xe5, 0x0f, 0x94, 0x46,
+	     0x50, 0x4a, 0x41, 0xf9, 0x05, 0x65, 0x19, 0x94, 0x69, 0x50,
+	     0xda, 0x41, 0x09, 0x08, 0x25, 0x21, 0x94, 0x88, 0x50, 0x32,
+	     0x42, 0x99, 0x09, 0x25, 0x29, 0x94, 0xaf, 0x50, 0xde, 0x42,
+	     0x99, 0x0b, 0x25, 0x2f, 0x94, 0xbf, 0x50, 0x12, 0x43, 0x19,
+	     0x0d, 0xa5, 0x35, 0x94, 0xdd, 0x50, 0x9e, 0x43, 0xa9, 0x0e,
+	     0xa5, 0x3b, 0x94, 0xfc, 0x50, 0x1e, 0x44, 0xc9, 0x10, 0x25,
+	     0x45, 0x94, 0x19, 0x51, 0x76, 0x44, 0x19, 0x12, 0x25, 0x49,
+	     0x94, 0x2e, 0x51, 0xd6, 0x44, 0xb9, 0x13, 0x65, 0x51, 0x94,
+	     0x53, 0x51, 0x6e, 0x45, 0x79, 0x16, 0x65, 0x5c, 0x94, 0x75,
+	     0x51, 0xf2, 0x45, 0xe9, 0x17, 0xa5, 0x61, 0x94, 0x8e, 0x51,
+	     0x6e, 0x46, 0x59, 0x1a, 0xe5, 0x6a, 0x94, 0xb8, 0x51, 0x0a,
+	     0x47, 0x69, 0x1c, 0xe5, 0x72, 0x94, 0xd0, 0x51, 0x66, 0x47,
+	     0xd9, 0x1d, 0xe5, 0x7a, 0x94, 0xef, 0x51, 0xd6, 0x47, 0x99,
+	     0x1f, 0xa5, 0x81, 0x94, 0x0a, 0x52, 0x46, 0x48, 0xd9, 0x21,
+	     0xe5, 0x89, 0x94, 0x30, 0x52, 0xce, 0x48, 0xe9, 0x23, 0x65,
+	     0x91, 0x94, 0x47, 0x52, 0x2e, 0x49, 0x59, 0x25, 0x25, 0x98,
+	     0x94, 0x69, 0x52, 0xce, 0x49, 0xf9, 0x27, 0xe5, 0xa0, 0x94,
+	     0x90, 0x52, 0x4e, 0x4a, 0x09, 0x2a, 0x25, 0xa9, 0x94, 0xb2,
+	     0x52, 0xe2, 0x4a, 0x39, 0x2c, 0x65, 0xb3, 0x94, 0xd1, 0x52,
+	     0x52, 0x4b, 0xb9, 0x2d, 0xa5, 0xb9, 0x94, 0xec, 0x52, 0xde,
+	     0x4b, 0xc9, 0x2f, 0x65, 0xc1, 0x94, 0x11, 0x53, 0x76, 0x4c,
+	     0xa9, 0x32, 0xe5, 0xcc, 0x94, 0x35, 0x53, 0x06, 0x4d, 0xa9,
+	     0x34, 0x25, 0xd6, 0x94, 0x63, 0x53, 0xb6, 0x4d, 0xb9, 0x37,
+	     0xa5, 0xe0, 0x94, 0x8a, 0x53, 0x42, 0x4e, 0xb9, 0x39, 0x25,
+	     0xe9, 0x94, 0xb2, 0x53, 0xe6, 0x4e, 0x29, 0x3c, 0xe5, 0xf1,
+	     0x94, 0xd4, 0x53, 0x86, 0x4f, 0x49, 0x3e, 0x65, 0xfb, 0x94,
+	     0xf4, 0x53, 0x0a, 0x50, 0xc9, 0x40, 0xe5, 0x04, 0x95, 0x20,
+	     0x54, 0x9e, 0x50, 0x59, 0x43, 0x65, 0x0f, 0x95, 0x41, 0x54,
+	     0x2a, 0x51, 0xf9, 0x44, 0xa5, 0x15, 0x95, 0x5d, 0x54, 0x92,
+	     0x51, 0x69, 0x46, 0x25, 0x1d, 0x95, 0x80, 0x54, 0x1e, 0x52,
+	     0xb9, 0x48, 0xa5, 0x24, 0x95, 0x9c, 0x54, 0xaa, 0x52, 0xe9,
+	     0x4a, 0x65, 0x2c, 0x95, 0xb7, 0x54, 0xf6, 0x52, 0x19, 0x4c,
+	     0xa5, 0x33, 0x95, 0xd6, 0x54, 0x6e, 0x53, 0x69, 0x4e, 0xe5,
+	     0x3a, 0x95, 0xf5, 0x54, 0xe6, 0x53, 0xd9, 0x4f, 0xe5, 0x40,
+	     0x95, 0x0e, 0x55, 0x62, 0x54, 0x69, 0x52, 0x65, 0x4c, 0x95,
+	     0x3e, 0x55, 0x2a, 0x55, 0xc9, 0x54, 0x65, 0x54, 0x95, 0x57,
+	     0x55, 0x72, 0x55, 0x29, 0x56, 0x65, 0x5b, 0x95, 0x72, 0x55,
+	     0xda, 0x55, 0xc9, 0x57, 0xe5, 0x61, 0x95, 0x8b, 0x55, 0x4e,
+	     0x56, 0xb9, 0x59, 0x25, 0x68, 0x95, 0xa9, 0x55, 0xda, 0x56,
+	     0x09, 0x5c, 0x25, 0x72, 0x95, 0xd1, 0x55, 0x6e, 0x57, 0x49,
+	     0x5e, 0xe5, 0x79, 0x95, 0xf4, 0x55, 0xee, 0x57, 0x19, 0x60,
+	     0x65, 0x83, 0x95, 0x16, 0x56, 0x66, 0x58, 0xe9, 0x61, 0x25,
+	     0x89, 0x95, 0x2e, 0x56, 0xe2, 0x58, 0xd9, 0x63, 0x25, 0x91,
+	     0x95, 0x49, 0x56, 0x2e, 0x59, 0x69, 0x65, 0xa5, 0x97, 0x95,
+	     0x61, 0x56, 0xbe, 0x59, 0x49, 0x67, 0x25, 0x9e, 0x95, 0x84,
+	     0x56, 0x26, 0x5a, 0x09, 0x69, 0x65, 0xa7, 0x95, 0xab, 0x56,
+	     0xc2, 0x5a, 0xd9, 0x6b, 0x65, 0xb1, 0x95, 0xd3, 0x56, 0x66,
+	     0x5b, 0x09, 0x6e, 0x65, 0xb9, 0x95, 0xf2, 0x56, 0xea, 0x5b,
+	     0xd9, 0x6f, 0x25, 0xc2, 0x95, 0x16, 0x57, 0x7e, 0x5c, 0xb9,
+	     0x72, 0xe5, 0xcd, 0x95, 0x3e, 0x57, 0x16, 0x5d, 0x89, 0x74,
+	     0x25, 0xd4, 0x95, 0x53, 0x57, 0x72, 0x5d, 0x29, 0x76, 0x65,
+	     0xdb, 0x95, 0x77, 0x57, 0x12, 0x5e, 0xb9, 0x78, 0xa5, 0xe4,
+	     0x95, 0x9b, 0x57, 0x8e, 0x5e, 0x69, 0x7a, 0xa5, 0xea, 0x95,
+	     0xad, 0x57, 0xd2, 0x5e, 0xb9, 0x7b, 0x25, 0xf2, 0x95, 0xd1,
+	     0x57, 0x5e, 0x5f, 0x39, 0x7e, 0xe5, 0xf9, 0x95, 0xeb, 0x57,
+	     0xb6, 0x5f, 0x89, 0x7f, 0xe5, 0x00, 0x96, 0x0b, 0x58, 0x42,
+	     0x60, 0xb9, 0x81, 0xa5, 0x08, 0x96, 0x2e, 0x58, 0xde, 0x60,
+	     0xc9, 0x83, 0xa5, 0x10, 0x96, 0x48, 0x58, 0x36, 0x61, 0x79,
+	     0x85, 0x25, 0x18, 0x96, 0x63, 0x58, 0xb6, 0x61, 0x59, 0x87,
+	     0x65, 0x1e, 0x96, 0x81, 0x58, 0x3e, 0x62, 0x49, 0x89, 0xa5,
+	     0x28, 0x96, 0xac, 0x58, 0xc2, 0x62, 0x49, 0x8b, 0xe5, 0x2e,
+	     0x96, 0xc8, 0x58, 0x2e, 0x63, 0x39, 0x8d, 0xe5, 0x37, 0x96,
+	     0xea, 0x58, 0xb2, 0x63, 0x29, 0x8f, 0xe5, 0x3d, 0x96, 0xfb,
+	     0x58, 0x06, 0x64, 0xf9, 0x90, 0xe5, 0x44, 0x96, 0x21, 0x59,
+	     0xbe, 0x64, 0x49, 0x93, 0x65, 0x4f, 0x96, 0x42, 0x59, 0x42,
+	     0x65, 0x79, 0x95, 0x25, 0x57, 0x96, 0x66, 0x59, 0xd2, 0x65,
+	     0x89, 0x97, 0x65, 0x61, 0x96, 0x8b, 0x59, 0x3a, 0x66, 0x59,
+	     0x99, 0xe5, 0x68, 0x96, 0xa5, 0x59, 0xa2, 0x66, 0x29, 0x9b,
+	     0xe5, 0x6d, 0x96, 0xba, 0x59, 0x1a, 0x67, 0x49, 0x9d, 0xa5,
+	     0x78, 0x96, 0xea, 0x59, 0xca, 0x67, 0x09, 0xa0, 0x25, 0x82,
+	     0x96, 0x13, 0x5a, 0x66, 0x68, 0xd9, 0xa1, 0x65, 0x89, 0x96,
+	     0x2a, 0x5a, 0xb6, 0x68, 0x79, 0xa3, 0xe5, 0x90, 0x96, 0x4b,
+	     0x5a, 0x36, 0x69, 0x79, 0xa5, 0x65, 0x98, 0x96, 0x6e, 0x5a,
+	     0xe2, 0x69, 0x19, 0xa8, 0xa5, 0xa2, 0x96, 0x95, 0x5a, 0x82,
+	     0x6a, 0x79, 0xaa, 0xa5, 0xac, 0x96, 0xbc, 0x5a, 0x2a, 0x6b,
+	     0xf9, 0xac, 0xa5, 0xb6, 0x96, 0xde, 0x5a, 0xb2, 0x6b, 0x29,
+	     0xaf, 0xa5, 0xbf, 0x96, 0x0c, 0x5b, 0x4a, 0x6c, 0xb9, 0xb1,
+	     0x65, 0xc9, 0x96, 0x2b, 0x5b, 0xd2, 0x6c, 0x19, 0xb4, 0xa5,
+	     0xd2, 0x96, 0x4c, 0x5b, 0x6a, 0x6d, 0xd9, 0xb5, 0xa5, 0xd8,
+	     0x96, 0x70, 0x5b, 0xea, 0x6d, 0x29, 0xb8, 0x25, 0xe4, 0x96,
+	     0x93, 0x5b, 0x7a, 0x6e, 0x39, 0xba, 0x65, 0xea, 0x96, 0xaf,
+	     0x5b, 0xe2, 0x6e, 0xd9, 0xbb, 0x25, 0xf1, 0x96, 0xd0, 0x5b,
+	     0x5a, 0x6f, 0xb9, 0xbd, 0xe5, 0xf7, 0x96, 0xe3, 0x5b, 0xa6,
+	     0x6f, 0xf9, 0xbe, 0xe5, 0xfc, 0x96, 0xfd, 0x5b, 0x2a, 0x70,
+	     0x49, 0xc1, 0x65, 0x06, 0x97, 0x1d, 0x5c, 0x9a, 0x70, 0x09,
+	     0xc3, 0xa5, 0x0f, 0x97, 0x4c, 0x5c, 0x4e, 0x71, 0x59, 0xc5,
+	     0xe5, 0x16, 0x97, 0x5e, 0x5c, 0x8e, 0x71, 0xa9, 0xc6, 0xa5,
+	     0x1b, 0x97, 0x7a, 0x5c, 0x06, 0x72, 0xc9, 0xc8, 0xa5, 0x26,
+	     0x97, 0xa1, 0x5c, 0xb2, 0x72, 0xf9, 0xca, 0xe5, 0x2d, 0x97,
+	     0xbf, 0x5c, 0x1a, 0x73, 0x49, 0xcd, 0x65, 0x38, 0x97, 0xe9,
+	     0x5c, 0xd2, 0x73, 0x79, 0xcf, 0x65, 0x40, 0x97, 0x0c, 0x5d,
+	     0x6a, 0x74, 0x29, 0xd2, 0xe5, 0x4b, 0x97, 0x31, 0x5d, 0xea,
+	     0x74, 0xe9, 0xd3, 0x65, 0x51, 0x97, 0x4c, 0x5d, 0x42, 0x75,
+	     0xb9, 0xd5, 0x65, 0x58, 0x97, 0x65, 0x5d, 0xa6, 0x75, 0x69,
+	     0xd7, 0x65, 0x60, 0x97, 0x8d, 0x5d, 0x4a, 0x76, 0xb9, 0xd9,
+	     0x25, 0x69, 0x97, 0xad, 0x5d, 0xc6, 0x76, 0xd9, 0xdb, 0x65,
+	     0x72, 0x97, 0xcb, 0x5d, 0x3a, 0x77, 0x49, 0xdd, 0xa5, 0x77,
+	     0x97, 0xe6, 0x5d, 0xbe, 0x77, 0x49, 0xdf, 0xa5, 0x7e, 0x97,
+	     0x01, 0x5e, 0x1a, 0x78, 0xc9, 0xe0, 0x25, 0x85, 0x97, 0x1d,
+	     0x5e, 0xae, 0x78, 0x89, 0xe3, 0xa5, 0x90, 0x97, 0x4e, 0x5e,
+	     0x66, 0x79, 0x29, 0xe6, 0xe5, 0x99, 0x97, 0x6c, 0x5e, 0xce,
+	     0x79, 0x89, 0xe7, 0xe5, 0xa0, 0x97, 0x8f, 0x5e, 0x72, 0x7a,
+	     0x19, 0xea, 0xe5, 0xaa, 0x97, 0xad, 0x5e, 0xd2, 0x7a, 0x09,
+	     0xec, 0x25, 0xb1, 0x97, 0xcf, 0x5e, 0x6e, 0x7b, 0x59, 0xee,
+	     0x65, 0xbb, 0x97, 0xf4, 0x5e, 0xfa, 0x7b, 0xc9, 0xf0, 0xa5,
+	     0xc5, 0x97, 0x23, 0x5f, 0x9a, 0x7c, 0xd9, 0xf2, 0x65, 0xce,
+	     0x97, 0x45, 0x5f, 0x4e, 0x7d, 0x79, 0xf5, 0x65, 0xd7, 0x97,
+	     0x62, 0x5f, 0xa2, 0x7d, 0xc9, 0xf6, 0x25, 0xdd, 0x97, 0x80,
+	     0x5f, 0x2a, 0x7e, 0x89, 0xf9, 0x25, 0xe9, 0x97, 0xaf, 0x5f,
+	     0xc6, 0x7e, 0xc9, 0xfb, 0xa5, 0xf1, 0x97, 0xcd, 0x5f, 0x52,
+	     0x7f, 0xe9, 0xfd, 0x25, 0xfa, 0x97, 0xf0, 0x5f, 0xde, 0x7f,
+	     0x19, 0x00, 0x66, 0x01, 0x98, 0x09, 0x60, 0x42, 0x80, 0x89,
+	     0x01, 0xa6, 0x09, 0x98, 0x29, 0x60, 0xda, 0x80, 0xc9, 0x03,
+	     0xe6, 0x0f, 0x98, 0x4d, 0x60, 0x6a, 0x81, 0xd9, 0x05, 0x26,
+	     0x18, 0x98, 0x67, 0x60, 0xd2, 0x81, 0x89, 0x07, 0x66, 0x20,
+	     0x98, 0x8e, 0x60, 0x52, 0x82, 0xe9, 0x09, 0xa6, 0x2a, 0x98,
+	     0xae, 0x60, 0xce, 0x82, 0xe9, 0x0b, 0x26, 0x30, 0x98, 0xc9,
+	     0x60, 0x5e, 0x83, 0xc9, 0x0d, 0xe6, 0x37, 0x98, 0xe8, 0x60,
+	     0xba, 0x83, 0xb9, 0x0f, 0xa6, 0x41, 0x98, 0x10, 0x61, 0x4e,
+	     0x84, 0x79, 0x11, 0xe6, 0x46, 0x98, 0x26, 0x61, 0xd2, 0x84,
+	     0xe9, 0x13, 0x66, 0x52, 0x98, 0x52, 0x61, 0x6e, 0x85, 0x19,
+	     0x16, 0x26, 0x5b, 0x98, 0x73, 0x61, 0xde, 0x85, 0x19, 0x18,
+	     0xa6, 0x62, 0x98, 0x8c, 0x61, 0x4e, 0x86, 0x89, 0x19, 0xa6,
+	     0x69, 0x98, 0xad, 0x61, 0xd6, 0x86, 0x89, 0x1b, 0xe6, 0x70,
+	     0x98, 0xcc, 0x61, 0x42, 0x87, 0x69, 0x1d, 0x66, 0x76, 0x98,
+	     0xe3, 0x61, 0xc6, 0x87, 0xb9, 0x1f, 0xa6, 0x81, 0x98, 0x09,
+	     0x62, 0x5e, 0x88, 0x09, 0x22, 0xa6, 0x8a, 0x98, 0x32, 0x62,
+	     0xea, 0x88, 0x59, 0x24, 0xe6, 0x92, 0x98, 0x57, 0x62, 0x6e,
+	     0x89, 0x79, 0x26, 0xa6, 0x9b, 0x98, 0x77, 0x62, 0xfa, 0x89,
+	     0x29, 0x28, 0xa6, 0xa3, 0x98, 0x9a, 0x62, 0x9e, 0x8a, 0x99,
+	     0x2a, 0xe6, 0xab, 0x98, 0xb3, 0x62, 0x02, 0x8b, 0x79, 0x2c,
+	     0x26, 0xb4, 0x98, 0xdc, 0x62, 0xa2, 0x8b, 0x39, 0x2f, 0xe6,
+	     0xbe, 0x98, 0x01, 0x63, 0x26, 0x8c, 0x09, 0x31, 0x26, 0xc5,
+	     0x98, 0x17, 0x63, 0x86, 0x8c, 0x99, 0x32, 0x66, 0xcc, 0x98,
+	     0x3b, 0x63, 0x06, 0x8d, 0xf9, 0x34, 0xa6, 0xd4, 0x98, 0x5c,
+	     0x63, 0x8a, 0x8d, 0xb9, 0x36, 0xa6, 0xdd, 0x98, 0x81, 0x63,
+	     0x22, 0x8e, 0xf9, 0x38, 0x26, 0xe6, 0x98, 0x9d, 0x63, 0x8a,
+	     0x8e, 0x09, 0x3b, 0x66, 0xee, 0x98, 0xc3, 0x63, 0x32, 0x8f,
+	     0xe9, 0x3c, 0xa6, 0xf5, 0x98, 0xdb, 0x63, 0xa6, 0x8f, 0x19,
+	     0x3f, 0xe6, 0xfe, 0x98, 0x04, 0x64, 0x3e, 0x90, 0x29, 0x41,
+	     0xa6, 0x06, 0x99, 0x22, 0x64, 0xbe, 0x90, 0xa9, 0x43, 0x26,
+	     0x12, 0x99, 0x56, 0x64, 0x8a, 0x91, 0x69, 0x46, 0xe6, 0x1c,
+	     0x99, 0x77, 0x64, 0xfa, 0x91, 0x79, 0x48, 0x26, 0x23, 0x99,
+	     0x9a, 0x64, 0x8e, 0x92, 0xf9, 0x4a, 0xa6, 0x2e, 0x99, 0xc5,
+	     0x64, 0x26, 0x93, 0xc9, 0x4c, 0x26, 0x35, 0x99, 0xe2, 0x64,
+	     0xbe, 0x93, 0x19, 0x4f, 0xa6, 0x3f, 0x99, 0x08, 0x65, 0x32,
+	     0x94, 0x69, 0x51, 0x66, 0x47, 0x99, 0x22, 0x65, 0xae, 0x94,
+	     0x39, 0x53, 0x26, 0x4e, 0x99, 0x3f, 0x65, 0x0e, 0x95, 0x99,
+	     0x54, 0x26, 0x54, 0x99, 0x5d, 0x65, 0x9a, 0x95, 0x49, 0x57,
+	     0xe6, 0x5e, 0x99, 0x82, 0x65, 0x16, 0x96, 0xa9, 0x58, 0xa6,
+	     0x64, 0x99, 0x9a, 0x65, 0x8e, 0x96, 0x99, 0x5a, 0x26, 0x6c,
+	     0x99, 0xb3, 0x65, 0xe2, 0x96, 0xd9, 0x5b, 0x66, 0x72, 0x99,
+	     0xcb, 0x65, 0x5a, 0x97, 0xa9, 0x5d, 0x26, 0x78, 0x99, 0xe9,
+	     0x65, 0xc2, 0x97, 0x89, 0x5f, 0xa6, 0x81, 0x99, 0x12, 0x66,
+	     0x56, 0x98, 0x09, 0x62, 0x66, 0x8b, 0x99, 0x34, 0x66, 0xf6,
+	     0x98, 0x89, 0x64, 0xa6, 0x93, 0x99, 0x53, 0x66, 0x6e, 0x99,
+	     0x29, 0x66, 0xa6, 0x9b, 0x99, 0x7b, 0x66, 0xfe, 0x99, 0x69,
+	     0x68, 0xa6, 0xa4, 0x99, 0x99, 0x66, 0x8e, 0x9a, 0x59, 0x6a,
+	     0xa6, 0xaa, 0x99, 0xb3, 0x66, 0xe2, 0x9a, 0xf9, 0x6b, 0x26,
+	     0xb1, 0x99, 0xce, 0x66, 0x6a, 0x9b, 0x49, 0x6e, 0x66, 0xbb,
+	     0x99, 0xf1, 0x66, 0xf2, 0x9b, 0x09, 0x70, 0x66, 0xc1, 0x99,
+	     0x0b, 0x67, 0x4a, 0x9c, 0x89, 0x71, 0xe6, 0xc8, 0x99, 0x2f,
+	     0x67, 0xe2, 0x9c, 0xc9, 0x73, 0xa6, 0xd1, 0x99, 0x4e, 0x67,
+	     0x46, 0x9d, 0xc9, 0x75, 0x66, 0xd9, 0x99, 0x73, 0x67, 0xe6,
+	     0x9d, 0x79, 0x78, 0xe6, 0xe4, 0x99, 0x95, 0x67, 0x62, 0x9e,
+	     0x39, 0x7a, 0xa6, 0xeb, 0x99, 0xb9, 0x67, 0xf6, 0x9e, 0x59,
+	     0x7c, 0x26, 0xf3, 0x99, 0xda, 0x67, 0x8e, 0x9f, 0xa9, 0x7e,
+	     0xe6, 0xfb, 0x99, 0xfd, 0x67, 0x22, 0xa0, 0xe9, 0x80, 0x26,
+	     0x05, 0x9a, 0x1a, 0x68, 0x9a, 0xa0, 0xf9, 0x82, 0x66, 0x0e,
+	     0x9a, 0x3f, 0x68, 0x0a, 0xa1, 0x69, 0x84, 0x26, 0x12, 0x9a,
+	     0x4f, 0x68, 0x4e, 0xa1, 0xd9, 0x85, 0x26, 0x1a, 0x9a, 0x75,
+	     0x68, 0x0a, 0xa2, 0x59, 0x88, 0x26, 0x24, 0x9a, 0x9c, 0x68,
+	     0x9a, 0xa2, 0xa9, 0x8a, 0x26, 0x2c, 0x9a, 0xbc, 0x68, 0x12,
+	     0xa3, 0x79, 0x8c, 0x66, 0x34, 0x9a, 0xdf, 0x68, 0x8a, 0xa3,
+	     0xd9, 0x8e, 0xe6, 0x3e, 0x9a, 0x06, 0x69, 0x2e, 0xa4, 0x59,
+	     0x91, 0xe6, 0x46, 0x9a, 0x1f, 0x69, 0xaa, 0xa4, 0x09, 0x93,
+	     0xe6, 0x4e, 0x9a, 0x3e, 0x69, 0x1a, 0xa5, 0x89, 0x94, 0xa6,
+	     0x55, 0x9a, 0x61, 0x69, 0xb6, 0xa5, 0x09, 0x97, 0x66, 0x5e,
+	     0x9a, 0x87, 0x69, 0x52, 0xa6, 0xd9, 0x99, 0xe6, 0x68, 0x9a,
+	     0xa7, 0x69, 0xaa, 0xa6, 0x79, 0x9b, 0xa6, 0x70, 0x9a, 0xcc,
+	     0x69, 0x5a, 0xa7, 0xf9, 0x9d, 0xe6, 0x7a, 0x9a, 0xf2, 0x69,
+	     0xda, 0xa7, 0xb9, 0x9f, 0x26, 0x81, 0x9a, 0x0b, 0x6a, 0x66,
+	     0xa8, 0x39, 0xa2, 0xe6, 0x89, 0x9a, 0x2f, 0x6a, 0xf2, 0xa8,
+	     0x49, 0xa4, 0xa6, 0x94, 0x9a, 0x5a, 0x6a, 0x92, 0xa9, 0x29,
+	     0xa7, 0x66, 0x9e, 0x9a, 0x82, 0x6a, 0x26, 0xaa, 0x79, 0xa9,
+	     0xe6, 0xa6, 0x9a, 0x9e, 0x6a, 0x9a, 0xaa, 0x09, 0xab, 0xa6,
+	     0xae, 0x9a, 0xc8, 0x6a, 0x42, 0xab, 0xb9, 0xad, 0xa6, 0xb7,
+	     0x9a, 0xe5, 0x6a, 0xb6, 0xab, 0x69, 0xaf, 0x26, 0xc0, 0x9a,
+	     0x08, 0x6b, 0x56, 0xac, 0xa9, 0xb1, 0x26, 0xca, 0x9a, 0x2e,
+	     0x6b, 0xd6, 0xac, 0xf9, 0xb3, 0x26, 0xd2, 0x9a, 0x4d, 0x6b,
+	     0x42, 0xad, 0xd9, 0xb5, 0xe6, 0xd8, 0x9a, 0x6d, 0x6b, 0xc6,
+	     0xad, 0xe9, 0xb7, 0xe6, 0xe1, 0x9a, 0x8c, 0x6b, 0x3e, 0xae,
+	     0xb9, 0xb9, 0x26, 0xea, 0x9a, 0xac, 0x6b, 0xce, 0xae, 0x99,
+	     0xbb, 0x66, 0xf1, 0x9a, 0xd1, 0x6b, 0x7a, 0xaf, 0x59, 0xbe,
+	     0x26, 0xfc, 0x9a, 0xf6, 0x6b, 0xf6, 0xaf, 0x69, 0xc0, 0x26,
+	     0x03, 0x9b, 0x19, 0x6c, 0x86, 0xb0, 0x89, 0xc2, 0x66, 0x0c,
+	     0x9b, 0x3e, 0x6c, 0x2a, 0xb1, 0x89, 0xc5, 0xa6, 0x16, 0x9b,
+	     0x5f, 0x6c, 0x8a, 0xb1, 0xa9, 0xc6, 0x26, 0x1e, 0x9b, 0x7e,
+	     0x6c, 0x12, 0xb2, 0x19, 0xc9, 0xa6, 0x25, 0x9b, 0xa1, 0x6c,
+	     0xae, 0xb2, 0x69, 0xcb, 0xe6, 0x2e, 0x9b, 0xc0, 0x6c, 0x26,
+	     0xb3, 0x49, 0xcd, 0xe6, 0x37, 0x9b, 0xe9, 0x6c, 0xde, 0xb3,
+	     0xc9, 0xcf, 0x26, 0x40, 0x9b, 0x0a, 0x6d, 0x46, 0xb4, 0x59,
+	     0xd1, 0xe6, 0x46, 0x9b, 0x27, 0x6d, 0xae, 0xb4, 0x49, 0xd3,
+	     0x66, 0x4f, 0x9b, 0x3f, 0x6d, 0x16, 0xb5, 0xa9, 0xd4, 0x66,
+	     0x55, 0x9b, 0x61, 0x6d, 0x92, 0xb5, 0xa9, 0xd6, 0xa6, 0x5d,
+	     0x9b, 0x7a, 0x6d, 0x06, 0xb6, 0xb9, 0xd8, 0xe6, 0x64, 0x9b,
+	     0x99, 0x6d, 0x8a, 0xb6, 0xa9, 0xda, 0xe6, 0x6b, 0x9b, 0xb5,
+	     0x6d, 0xf6, 0xb6, 0xa9, 0xdc, 0x66, 0x74, 0x9b, 0xd5, 0x6d,
+	     0x8e, 0xb7, 0xd9, 0xde, 0xa6, 0x7c, 0x9b, 0xfe, 0x6d, 0x0a,
+	     0xb8, 0x99, 0xe0, 0x66, 0x85, 0x9b, 0x1f, 0x6e, 0xae, 0xb8,
+	     0x09, 0xe3, 0x26, 0x8d, 0x9b, 0x37, 0x6e, 0xfa, 0xb8, 0xa9,
+	     0xe4, 0x26, 0x94, 0x9b, 0x52, 0x6e, 0x56, 0xb9, 0xb9, 0xe5,
+	     0x66, 0x98, 0x9b, 0x6f, 0x6e, 0xe6, 0xb9, 0x29, 0xe8, 0x66,
+	     0xa1, 0x9b, 0x90, 0x6e, 0x7a, 0xba, 0x29, 0xea, 0xa6, 0xab,
+	     0x9b, 0xb3, 0x6e, 0xde, 0xba, 0x59, 0xec, 0xe6, 0xb4, 0x9b,
+	     0xd9, 0x6e, 0x8a, 0xbb, 0xd9, 0xee, 0x26, 0xbc, 0x9b, 0xfa,
+	     0x6e, 0xf6, 0xbb, 0x39, 0xf0, 0x66, 0xc4, 0x9b, 0x13, 0x6f,
+	     0x62, 0xbc, 0x69, 0xf2, 0x26, 0xcd, 0x9b, 0x42, 0x6f, 0x2e,
+	     0xbd, 0x49, 0xf5, 0x66, 0xd8, 0x9b, 0x6f, 0x6f, 0xd6, 0xbd,
+	     0xc9, 0xf7, 0x26, 0xe1, 0x9b, 0x8d, 0x6f, 0x56, 0xbe, 0x89,
+	     0xf9, 0x66, 0xe7, 0x9b, 0xa1, 0x6f, 0xb2, 0xbe, 0x19, 0xfb,
+	     0x66, 0xed, 0x9b, 0xc2, 0x6f, 0x22, 0xbf, 0xd9, 0xfc, 0x26,
+	     0xf6, 0x9b, 0xe0, 0x6f, 0x8e, 0xbf, 0x99, 0xfe, 0xa6, 0xfd,
+	     0x9b, 0x04, 0x70, 0x46, 0xc0, 0xe9, 0x01, 0x27, 0x0a, 0x9c,
+	     0x34, 0x70, 0xee, 0xc0, 0xe9, 0x03, 0x27, 0x12, 0x9c, 0x4c,
+	     0x70, 0x6a, 0xc1, 0xf9, 0x05, 0xa7, 0x19, 0x9c, 0x72, 0x70,
+	     0xd2, 0xc1, 0xd9, 0x07, 0x27, 0x20, 0x9c, 0x87, 0x70, 0x32,
+	     0xc2, 0x99, 0x09, 0x27, 0x28, 0x9c, 0xab, 0x70, 0xde, 0xc2,
+	     0xc9, 0x0b, 0x27, 0x30, 0x9c, 0xc9, 0x70, 0x52, 0xc3, 0x79,
+	     0x0d, 0xa7, 0x37, 0x9c, 0xe4, 0x70, 0xbe, 0xc3, 0x49, 0x0f,
+	     0xa7, 0x40, 0x9c, 0x0d, 0x71, 0x4a, 0xc4, 0x59, 0x11, 0xa7,
+	     0x47, 0x9c, 0x2a, 0x71, 0xd6, 0xc4, 0xd9, 0x13, 0x67, 0x52,
+	     0x9c, 0x54, 0x71, 0x72, 0xc5, 0xa9, 0x16, 0x27, 0x5c, 0x9c,
+	     0x7a, 0x71, 0x0e, 0xc6, 0x99, 0x18, 0xe7, 0x64, 0x9c, 0x96,
+	     0x71, 0x6a, 0xc6, 0x49, 0x1a, 0xa7, 0x69, 0x9c, 0xb4, 0x71,
+	     0xea, 0xc6, 0xd9, 0x1b, 0xe7, 0x71, 0x9c, 0xd3, 0x71, 0x5a,
+	     0xc7, 0xe9, 0x1d, 0x27, 0x79, 0x9c, 0xeb, 0x71, 0xba, 0xc7,
+	     0x29, 0x1f, 0x27, 0x7e, 0x9c, 0x02, 0x72, 0x1e, 0xc8, 0x59,
+	     0x21, 0x67, 0x86, 0x9c, 0x21, 0x72, 0xa2, 0xc8, 0x69, 0x23,
+	     0xe7, 0x90, 0x9c, 0x4e, 0x72, 0x6e, 0xc9, 0x79, 0x26, 0x67,
+	     0x9b, 0x9c, 0x73, 0x72, 0x02, 0xca, 0x89, 0x28, 0xa7, 0xa5,
+	     0x9c, 0x9c, 0x72, 0x86, 0xca, 0xa9, 0x2a, 0x27, 0xae, 0x9c,
+	     0xc3, 0x72, 0x16, 0xcb, 0x89, 0x2c, 0x67, 0xb5, 0x9c, 0xda,
+	     0x72, 0x76, 0xcb, 0xb9, 0x2e, 0x67, 0xbe, 0x9c, 0x07, 0x73,
+	     0x3a, 0xcc, 0x19, 0x31, 0xa7, 0xc7, 0x9c, 0x27, 0x73, 0xce,
+	     0xcc, 0x69, 0x33, 0x27, 0xd1, 0x9c, 0x49, 0x73, 0x52, 0xcd,
+	     0x99, 0x35, 0x67, 0xd9, 0x9c, 0x6d, 0x73, 0xc2, 0xcd, 0x79,
+	     0x37, 0x67, 0xdf, 0x9c, 0x81, 0x73, 0x22, 0xce, 0x69, 0x39,
+	     0x67, 0xe7, 0x9c, 0xa8, 0x73, 0xc6, 0xce, 0xb9, 0x3b, 0xe7,
+	     0xf0, 0x9c, 0xcd, 0x73, 0x46, 0xcf, 0x99, 0x3d, 0xe7, 0xf7,
+	     0x9c, 0xe5, 0x73, 0xc2, 0xcf, 0xb9, 0x3f, 0x27, 0x02, 0x9d,
+	     0x0c, 0x74, 0x6a, 0xd0, 0xe9, 0x41, 0x27, 0x0a, 0x9d, 0x2e,
+	     0x74, 0xce, 0xd0, 0xf9, 0x43, 0x67, 0x11, 0x9d, 0x48, 0x74,
+	     0x4a, 0xd1, 0xe9, 0x45, 0xe7, 0x1a, 0x9d, 0x71, 0x74, 0xfa,
+	     0xd1, 0x29, 0x48, 0x27, 0x23, 0x9d, 0x96, 0x74, 0x7a, 0xd2,
+	     0x09, 0x4a, 0xe7, 0x29, 0x9d, 0xae, 0x74, 0xea, 0xd2, 0x29,
+	     0x4c, 0xa7, 0x31, 0x9d, 0xd1, 0x74, 0x72, 0xd3, 0xf9, 0x4d,
+	     0xa7, 0x39, 0x9d, 0xec, 0x74, 0xbe, 0xd3, 0x49, 0x4f, 0x27,
+	     0x3e, 0x9d, 0x03, 0x75, 0x26, 0xd4, 0xe9, 0x50, 0x67, 0x45,
+	     0x9d, 0x1f, 0x75, 0x96, 0xd4, 0xe9, 0x52, 0x67, 0x4c, 0x9d,
+	     0x3e, 0x75, 0x06, 0xd5, 0xa9, 0x54, 0x27, 0x56, 0x9d, 0x62,
+	     0x75, 0xa2, 0xd5, 0x59, 0x57, 0xe7, 0x60, 0x9d, 0x88, 0x75,
+	     0x46, 0xd6, 0xc9, 0x59, 0x67, 0x6a, 0x9d, 0xb3, 0x75, 0xda,
+	     0xd6, 0xf9, 0x5b, 0xe7, 0x72, 0x9d, 0xd0, 0x75, 0x5e, 0xd7,
+	     0x19, 0x5e, 0x27, 0x79, 0x9d, 0xed, 0x75, 0xe6, 0xd7, 0xc9,
+	     0x5f, 0xa7, 0x82, 0x9d, 0x14, 0x76, 0x7e, 0xd8, 0x19, 0x62,
+	     0xe7, 0x8b, 0x9d, 0x34, 0x76, 0x0a, 0xd9, 0x79, 0x64, 0x27,
+	     0x93, 0x9d, 0x52, 0x76, 0x6e, 0xd9, 0x89, 0x66, 0x67, 0x9c,
+	     0x9d, 0x7b, 0x76, 0x1e, 0xda, 0x49, 0x69, 0x27, 0xa6, 0x9d,
+	     0xa0, 0x76, 0xa6, 0xda, 0xc9, 0x6a, 0x27, 0xad, 0x9d, 0xbb,
+	     0x76, 0x26, 0xdb, 0x69, 0x6d, 0x27, 0xb8, 0x9d, 0xe2, 0x76,
+	     0x9a, 0xdb, 0x39, 0x6f, 0xe7, 0xbe, 0x9d, 0x08, 0x77, 0x3e,
+	     0xdc, 0x99, 0x71, 0x27, 0xc9, 0x9d, 0x32, 0x77, 0xd6, 0xdc,
+	     0xa9, 0x73, 0xe7, 0xd1, 0x9d, 0x52, 0x77, 0x76, 0xdd, 0x39,
+	     0x76, 0x67, 0xdb, 0x9d, 0x76, 0x77, 0x0a, 0xde, 0xb9, 0x78,
+	     0xe7, 0xe4, 0x9d, 0x9d, 0x77, 0x82, 0xde, 0x99, 0x7a, 0xa7,
+	     0xeb, 0x9d, 0xb7, 0x77, 0x0a, 0xdf, 0xc9, 0x7c, 0xe7, 0xf4,
+	     0x9d, 0xd6, 0x77, 0x62, 0xdf, 0x49, 0x7e, 0x67, 0xfa, 0x9d,
+	     0xef, 0x77, 0xe6, 0xdf, 0x79, 0x80, 0xa7, 0x02, 0x9e, 0x12,
+	     0x78, 0x82, 0xe0, 0xe9, 0x82, 0xa7, 0x0c, 0x9e, 0x39, 0x78,
+	     0xfe, 0xe0, 0xc9, 0x84, 0xe7, 0x13, 0x9e, 0x53, 0x78, 0x66,
+	     0xe1, 0x39, 0x86, 0x67, 0x1a, 0x9e, 0x75, 0x78, 0xe6, 0xe1,
+	     0x69, 0x88, 0x27, 0x23, 0x9e, 0x91, 0x78, 0x76, 0xe2, 0x39,
+	     0x8a, 0xe7, 0x29, 0x9e, 0xae, 0x78, 0xca, 0xe2, 0xa9, 0x8b,
+	     0x27, 0x2f, 0x9e, 0xc3, 0x78, 0x3a, 0xe3, 0x49, 0x8d, 0xa7,
+	     0x37, 0x9e, 0xe2, 0x78, 0x9a, 0xe3, 0xd9, 0x8e, 0x67, 0x3c,
+	     0x9e, 0xf6, 0x78, 0xea, 0xe3, 0x39, 0x90, 0xa7, 0x43, 0x9e,
+	     0x14, 0x79, 0x76, 0xe4, 0x39, 0x92, 0xa7, 0x4b, 0x9e, 0x37,
+	     0x79, 0x06, 0xe5, 0xe9, 0x94, 0x67, 0x54, 0x9e, 0x5d, 0x79,
+	     0x96, 0xe5, 0xc9, 0x96, 0x27, 0x5d, 0x9e, 0x7b, 0x79, 0xf6,
+	     0xe5, 0x69, 0x98, 0x67, 0x62, 0x9e, 0x8c, 0x79, 0x4e, 0xe6,
+	     0xe9, 0x99, 0x27, 0x6a, 0x9e, 0xb5, 0x79, 0xea, 0xe6, 0x69,
+	     0x9c, 0xa7, 0x72, 0x9e, 0xd8, 0x79, 0x7e, 0xe7, 0xd9, 0x9e,
+	     0x27, 0x7d, 0x9e, 0xf9, 0x79, 0x1e, 0xe8, 0x49, 0xa1, 0xe7,
+	     0x86, 0x9e, 0x25, 0x7a, 0xbe, 0xe8, 0x69, 0xa3, 0x67, 0x90,
+	     0x9e, 0x4a, 0x7a, 0x3e, 0xe9, 0x99, 0xa5, 0x27, 0x98, 0x9e,
+	     0x62, 0x7a, 0xa2, 0xe9, 0x49, 0xa7, 0x67, 0x9f, 0x9e, 0x8b,
+	     0x7a, 0x5a, 0xea, 0xc9, 0xa9, 0xe7, 0xa8, 0x9e, 0xa9, 0x7a,
+	     0xde, 0xea, 0x19, 0xac, 0xa7, 0xb1, 0x9e, 0xcf, 0x7a, 0x56,
+	     0xeb, 0x09, 0xae, 0x67, 0xbb, 0x9e, 0xf9, 0x7a, 0x1a, 0xec,
+	     0xb9, 0xb0, 0x67, 0xc3, 0x9e, 0x1b, 0x7b, 0x8e, 0xec, 0x99,
+	     0xb2, 0x27, 0xcc, 0x9e, 0x3d, 0x7b, 0x1e, 0xed, 0xc9, 0xb4,
+	     0xa7, 0xd5, 0x9e, 0x60, 0x7b, 0x9e, 0xed, 0xa9, 0xb6, 0xa7,
+	     0xdd, 0x9e, 0x7c, 0x7b, 0x22, 0xee, 0x09, 0xb9, 0xe7, 0xe4,
+	     0x9e, 0x98, 0x7b, 0x72, 0xee, 0x49, 0xba, 0x27, 0xea, 0x9e,
+	     0xb3, 0x7b, 0xfa, 0xee, 0x09, 0xbc, 0x27, 0xf3, 0x9e, 0xd0,
+	     0x7b, 0x72, 0xef, 0x69, 0xbe, 0xa7, 0xfa, 0x9e, 0xee, 0x7b,
+	     0xc6, 0xef, 0x89, 0xbf, 0x67, 0xff, 0x9e, 0x03, 0x7c, 0x1a,
+	     0xf0, 0xd9, 0xc0, 0x27, 0x06, 0x9f, 0x1b, 0x7c, 0x9a, 0xf0,
+	     0x09, 0xc3, 0xe7, 0x0c, 0x9f, 0x37, 0x7c, 0x02, 0xf1, 0xa9,
+	     0xc4, 0x67, 0x15, 0x9f, 0x63, 0x7c, 0xbe, 0xf1, 0x59, 0xc7,
+	     0xe7, 0x1e, 0x9f, 0x81, 0x7c, 0x0e, 0xf2, 0xd9, 0xc8, 0xe7,
+	     0x24, 0x9f, 0xa0, 0x7c, 0xa6, 0xf2, 0xe9, 0xca, 0xa7, 0x2d,
+	     0x9f, 0xc4, 0x7c, 0x26, 0xf3, 0x19, 0xcd, 0xe7, 0x37, 0x9f,
+	     0xe9, 0x7c, 0xb2, 0xf3, 0x69, 0xcf, 0x67, 0x40, 0x9f, 0x06,
+	     0x7d, 0x32, 0xf4, 0x49, 0xd1, 0xa7, 0x48, 0x9f, 0x26, 0x7d,
+	     0xce, 0xf4, 0xa9, 0xd3, 0xa7, 0x4f, 0x9f, 0x4c, 0x7d, 0x5e,
+	     0xf5, 0xf9, 0xd5, 0x27, 0x5a, 0x9f, 0x70, 0x7d, 0xda, 0xf5,
+	     0x89, 0xd7, 0x67, 0x60, 0x9f, 0x87, 0x7d, 0x4a, 0xf6, 0x99,
+	     0xd9, 0x67, 0x68, 0x9f, 0xaf, 0x7d, 0xde, 0xf6, 0x49, 0xdc,
+	     0xa7, 0x74, 0x9f, 0xda, 0x7d, 0x9a, 0xf7, 0x39, 0xdf, 0x27,
+	     0x80, 0x9f, 0x07, 0x7e, 0x52, 0xf8, 0xf9, 0xe1, 0xe7, 0x88,
+	     0x9f, 0x26, 0x7e, 0xd2, 0xf8, 0xa9, 0xe3, 0xe7, 0x8f, 0x9f,
+	     0x47, 0x7e, 0x4e, 0xf9, 0xc9, 0xe5, 0xe7, 0x99, 0x9f, 0x75,
+	     0x7e, 0xfa, 0xf9, 0x69, 0xe8, 0xa7, 0xa4, 0x9f, 0x9f, 0x7e,
+	     0x8a, 0xfa, 0x79, 0xea, 0xe7, 0xab, 0x9f, 0xb4, 0x7e, 0xde,
+	     0xfa, 0x39, 0xec, 0xa7, 0xb2, 0x9f, 0xd5, 0x7e, 0x7a, 0xfb,
+	     0x49, 0xee, 0xa7, 0xba, 0x9f, 0xf5, 0x7e, 0xfa, 0xfb, 0x39,
+	     0xf0, 0x27, 0xc4, 0x9f, 0x17, 0x7f, 0x8a, 0xfc, 0x99, 0xf2,
+	     0x67, 0xcd, 0x9f, 0x38, 0x7f, 0x02, 0xfd, 0x79, 0xf4, 0x67,
+	     0xd2, 0x9f, 0x4f, 0x7f, 0x4a, 0xfd, 0xd9, 0xf5, 0x27, 0xd9,
+	     0x9f, 0x6c, 0x7f, 0xda, 0xfd, 0x39, 0xf8, 0xe7, 0xe2, 0x9f,
+	     0x96, 0x7f, 0x86, 0xfe, 0x49, 0xfa, 0xa7, 0xeb, 0x9f, 0xb9,
+	     0x7f, 0xf2, 0xfe, 0x89, 0xfc, 0xa7, 0xf3, 0x9f, 0xd7, 0x7f,
+	     0x76, 0xff, 0x09, 0xfe, 0xe7, 0xf8, 0x9f, 0xe8, 0x7f, 0xb6,
+	     0xff, 0x09, 0xff, 0xe7, 0xfc, 0x9f, 0x00, 0x80, 0x32, 0x00,
+	     0x8a, 0x01, 0x68, 0x08, 0xa0, 0x29, 0x80, 0xc6, 0x00, 0x8a,
+	     0x03, 0xa8, 0x0e, 0xa0, 0x41, 0x80, 0x32, 0x01, 0x7a, 0x05,
+	     0xe8, 0x16, 0xa0, 0x63, 0x80, 0x9e, 0x01, 0x5a, 0x07, 0x28,
+	     0x1e, 0xa0, 0x7f, 0x80, 0x0e, 0x02, 0x1a, 0x09, 0xe8, 0x26,
+	     0xa0, 0xa7, 0x80, 0xae, 0x02, 0x9a, 0x0b, 0x28, 0x31, 0xa0,
+	     0xcb, 0x80, 0x4e, 0x03, 0x9a, 0x0d, 0x28, 0x37, 0xa0, 0xde,
+	     0x80, 0xa2, 0x03, 0xba, 0x0e, 0x68, 0x3e, 0xa0, 0x03, 0x81,
+	     0x2e, 0x04, 0x9a, 0x11, 0x28, 0x47, 0xa0, 0x23, 0x81, 0xb2,
+	     0x04, 0x0a, 0x13, 0xe8, 0x4c, 0xa0, 0x3c, 0x81, 0x26, 0x05,
+	     0xfa, 0x14, 0xe8, 0x56, 0xa0, 0x69, 0x81, 0xc2, 0x05, 0x4a,
+	     0x17, 0x68, 0x5f, 0xa0, 0x85, 0x81, 0x2a, 0x06, 0x4a, 0x19,
+	     0x28, 0x68, 0xa0, 0xa9, 0x81, 0xb2, 0x06, 0x5a, 0x1b, 0xe8,
+	     0x6d, 0xa0, 0xbf, 0x81, 0x2a, 0x07, 0x6a, 0x1d, 0x68, 0x78,
+	     0xa0, 0xeb, 0x81, 0xd2, 0x07, 0x1a, 0x20, 0x68, 0x81, 0xa0,
+	     0x0f, 0x82, 0x4a, 0x08, 0x0a, 0x22, 0xa8, 0x8b, 0xa0, 0x39,
+	     0x82, 0x06, 0x09, 0xca, 0x24, 0xe8, 0x94, 0xa0, 0x5c, 0x82,
+	     0x86, 0x09, 0x7a, 0x26, 0xa8, 0x9c, 0xa0, 0x7d, 0x82, 0x0e,
+	     0x0a, 0xda, 0x28, 0xe8, 0xa4, 0xa0, 0x9b, 0x82, 0x76, 0x0a,
+	     0x3a, 0x2a, 0xe8, 0xaa, 0xa0, 0xb3, 0x82, 0xde, 0x0a, 0x1a,
+	     0x2c, 0xe8, 0xb1, 0xa0, 0xcd, 0x82, 0x5e, 0x0b, 0xaa, 0x2d,
+	     0xe8, 0xb9, 0xa0, 0xea, 0x82, 0xc2, 0x0b, 0xba, 0x2f, 0xe8,
+	     0xbf, 0xa0, 0x0a, 0x83, 0x4a, 0x0c, 0xba, 0x31, 0x68, 0xc9,
+	     0xa0, 0x33, 0x83, 0xe2, 0x0c, 0x0a, 0x34, 0x68, 0xd1, 0xa0,
+	     0x50, 0x83, 0x72, 0x0d, 0x0a, 0x36, 0xe8, 0xd8, 0xa0, 0x68,
+	     0x83, 0xc6, 0x0d, 0x9a, 0x37, 0x68, 0xe0, 0xa0, 0x83, 0x83,
+	     0x32, 0x0e, 0x1a, 0x39, 0x28, 0xe6, 0xa0, 0x9f, 0x83, 0x9e,
+	     0x0e, 0xaa, 0x3a, 0xa8, 0xed, 0xa0, 0xc2, 0x83, 0x2e, 0x0f,
+	     0x3a, 0x3d, 0xe8, 0xf5, 0xa0, 0xe1, 0x83, 0xb6, 0x0f, 0x1a,
+	     0x3f, 0xe8, 0xff, 0xa0, 0x0d, 0x84, 0x52, 0x10, 0xca, 0x41,
+	     0x28, 0x08, 0xa1, 0x28, 0x84, 0xb2, 0x10, 0x0a, 0x43, 0x28,
+	     0x0d, 0xa1, 0x3f, 0x84, 0x1e, 0x11, 0xca, 0x44, 0x68, 0x16,
+	     0xa1, 0x60, 0x84, 0x9e, 0x11, 0xfa, 0x46, 0x68, 0x1c, 0xa1,
+	     0x7b, 0x84, 0x22, 0x12, 0x0a, 0x49, 0xe8, 0x24, 0xa1, 0x9c,
+	     0x84, 0x82, 0x12, 0x7a, 0x4a, 0xe8, 0x2b, 0xa1, 0xb7, 0x84,
+	     0xfa, 0x12, 0x3a, 0x4c, 0x28, 0x32, 0xa1, 0xd5, 0x84, 0x66,
+	     0x13, 0x3a, 0x4e, 0xa8, 0x3b, 0xa1, 0xfc, 0x84, 0xfe, 0x13,
+	     0x7a, 0x50, 0xe8, 0x44, 0xa1, 0x17, 0x85, 0x6e, 0x14, 0x8a,
+	     0x52, 0xa8, 0x4c, 0xa1, 0x37, 0x85, 0x02, 0x15, 0xea, 0x54,
+	     0xa8, 0x56, 0xa1, 0x66, 0x85, 0xbe, 0x15, 0x7a, 0x57, 0x68,
+	     0x61, 0xa1, 0x92, 0x85, 0x5a, 0x16, 0x2a, 0x5a, 0xa8, 0x6a,
+	     0xa1, 0xb7, 0x85, 0x16, 0x17, 0xfa, 0x5c, 0x68, 0x77, 0xa1,
+	     0xe0, 0x85, 0x92, 0x17, 0x8a, 0x5e, 0xe8, 0x7c, 0xa1, 0xfc,
+	     0x85, 0x1a, 0x18, 0x4a, 0x61, 0x28, 0x87, 0xa1, 0x24, 0x86,
+	     0xae, 0x18, 0xea, 0x62, 0x28, 0x8d, 0xa1, 0x3a, 0x86, 0x1e,
+	     0x19, 0x1a, 0x65, 0x28, 0x95, 0xa1, 0x59, 0x86, 0x7a, 0x19,
+	     0x7a, 0x66, 0x28, 0x9d, 0xa1, 0x7a, 0x86, 0x06, 0x1a, 0xea,
+	     0x68, 0x68, 0xa4, 0xa1, 0x9e, 0x86, 0x8e, 0x1a, 0xda, 0x6a,
+	     0x28, 0xac, 0xa1, 0xb6, 0x86, 0x06, 0x1b, 0x8a, 0x6c, 0x68,
+	     0xb4, 0xa1, 0xda, 0x86, 0x9a, 0x1b, 0x1a, 0x6f, 0xe8, 0xbe,
+	     0xa1, 0x03, 0x87, 0x22, 0x1c, 0x6a, 0x71, 0x28, 0xc7, 0xa1,
+	     0x20, 0x87, 0x9e, 0x1c, 0x0a, 0x73, 0xa8, 0xcc, 0xa1, 0x38,
+	     0x87, 0x0a, 0x1d, 0xea, 0x74, 0x68, 0xd5, 0xa1, 0x61, 0x87,
+	     0xb6, 0x1d, 0x9a, 0x77, 0x28, 0xe1, 0xa1, 0x8b, 0x87, 0x4e,
+	     0x1e, 0xba, 0x79, 0x28, 0xe9, 0xa1, 0xaf, 0x87, 0xd6, 0x1e,
+	     0x0a, 0x7c, 0xe8, 0xf2, 0xa1, 0xd8, 0x87, 0x82, 0x1f, 0xba,
+	     0x7e, 0xa8, 0xfc, 0xa1, 0xfb, 0x87, 0xfa, 0x1f, 0x4a, 0x80,
+	     0x28, 0x02, 0xa2, 0x13, 0x88, 0x5a, 0x20, 0xba, 0x81, 0x68,
+	     0x09, 0xa2, 0x32, 0x88, 0xfe, 0x20, 0x4a, 0x84, 0xe8, 0x13,
+	     0xa2, 0x5c, 0x88, 0x9a, 0x21, 0xca, 0x86, 0xe8, 0x1c, 0xa2,
+	     0x7b, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00,
+};
+
+static inline int
+hash_keycmp(uint32_t i, const void *key, size_t keylen)
+{
+	const uint32_t o = _getbits(hash_off, i, 18);
+
+	return _getbits(hash_off, i + 1, 18) - o == keylen &&
+	    memcmp(hash_pool + o, key, keylen) == 0;
+}
+
+static const uint16_t hash_g[40001] = {
+	    0x0000, 0x29c7, 0x0000, 0x42a0, 0x393d, 0x0000, 0x2945, 0x0000,
+	    0x0000, 0x0783, 0x0000, 0x374f, 0x02e7, 0x4529, 0x1202, 0x0000,
+	    0x0000, 0x0900, 0x3986, 0x0000, 0x0f6c, 0x0000, 0x0000, 0x201f,
+	    0x0000, 0x1e53, 0x2e30, 0x0000, 0x27b9, 0x0000, 0x0000, 0x4322,
+	    0x0000, 0x0000, 0x032e, 0x0000, 0x1c9d, 0x0000, 0x22ae, 0x1180,
+	    0x048a, 0x4dc7, 0x0000, 0x0000, 0x0000, 0x0000, 0x13f6, 0x0000,
+	    0x08eb, 0x132e, 0x0ad6, 0x0b9f, 0x0000, 0x0000, 0x0cd9, 0x134a,
+	    0x0000, 0x3184, 0x2bc7, 0x37cf, 0x0c71, 0x1756, 0x2be8, 0x0000,
+	    0x4513, 0x0000, 0x450d, 0x2d89, 0x3dee, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3fd5, 0x16e6, 0x2a01, 0x4e08, 0x4720,
+	    0x0000, 0x0000, 0x0a33, 0x0000, 0x3600, 0x1123, 0x0178, 0x0000,
+	    0x0000, 0x0b94, 0x0418, 0x4b58, 0x0000, 0x021e, 0x0126, 0x0000,
+	    0x113f, 0x0000, 0x298d, 0x0000, 0x2b49, 0x0000, 0x371a, 0x0000,
+	    0x0000, 0x3ed8, 0x0000, 0x0000, 0x0000, 0x4d5f, 0x03e8, 0x4618,
+	    0x2a75, 0x495f, 0x0000, 0x0000, 0x0000, 0x49c3, 0x0000, 0x0000,
+	    0x12bc, 0x4922, 0x2fa2, 0x0000, 0x0000, 0x4bc3, 0x0000, 0x0000,
+	    0x148a, 0x0000, 0x0000, 0x47d8, 0x0000, 0x425a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0dc6, 0x0000, 0x0000, 0x2540, 0x0000, 0x4bf5,
+	    0x0000, 0x4d23, 0x0000, 0x2853, 0x0000, 0x1ab7, 0x359f, 0x35d9,
+	    0x318c, 0x0000, 0x0000, 0x2506, 0x315c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1227, 0x2f3a, 0x013f, 0x0703, 0x2781, 0x0000, 0x40f8,
+	    0x0000, 0x3ab7, 0x2c6c, 0x0000, 0x0000, 0x0000, 0x2576, 0x0000,
+	    0x0000, 0x374f, 0x34b8, 0x0000, 0x0000, 0x1f5a, 0x253b, 0x0000,
+	    0x13ef, 0x07d5, 0x4a56, 0x0000, 0x3e5d, 0x0000, 0x1313, 0x4bda,
+	    0x0000, 0x0c75, 0x3407, 0x472c, 0x1673, 0x4051, 0x0d06, 0x2670,
+	    0x36ef, 0x0651, 0x35a9, 0x2c2b, 0x0000, 0x133a, 0x17eb, 0x0dbb,
+	    0x0000, 0x4c59, 0x0000, 0x1e5c, 0x0fb0, 0x4453, 0x4c3b, 0x0000,
+	    0x0000, 0x1b94, 0x278f, 0x075c, 0x0000, 0x102c, 0x35b2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1eb2, 0x4606, 0x1492, 0x33fd, 0x1f8d,
+	    0x0596, 0x0000, 0x0d7f, 0x0000, 0x0ec4, 0x0000, 0x0fda, 0x0000,
+	    0x2552, 0x4670, 0x29df, 0x0000, 0x00bf, 0x0000, 0x0000, 0x4101,
+	    0x2196, 0x12db, 0x4a31, 0x0000, 0x0712, 0x0000, 0x17b1, 0x077d,
+	    0x1e7f, 0x16e1, 0x4207, 0x41bf, 0x0000, 0x0000, 0x0000, 0x4693,
+	    0x4167, 0x3cea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x48ab, 0x0000, 0x1f1e, 0x185a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4bd8, 0x0000, 0x0000, 0x3bb1, 0x2fa9, 0x17eb, 0x0000, 0x0000,
+	    0x0eb9, 0x07ba, 0x0000, 0x0000, 0x478b, 0x4542, 0x31a6, 0x0000,
+	    0x1288, 0x4e0d, 0x0000, 0x221f, 0x0000, 0x44ea, 0x0000, 0x400a,
+	    0x067d, 0x1205, 0x0000, 0x0000, 0x0000, 0x11cc, 0x199f, 0x0000,
+	    0x1aab, 0x0021, 0x0000, 0x4954, 0x0000, 0x2165, 0x0000, 0x0000,
+	    0x0210, 0x0000, 0x1fe8, 0x3b78, 0x17be, 0x0784, 0x0000, 0x0000,
+	    0x0000, 0x09ca, 0x0000, 0x029b, 0x26b9, 0x071b, 0x4c45, 0x47ae,
+	    0x202e, 0x42dd, 0x0000, 0x24cb, 0x0000, 0x0000, 0x0000, 0x3770,
+	    0x2d98, 0x3271, 0x0000, 0x0000, 0x0000, 0x0000, 0x4976, 0x0000,
+	    0x0000, 0x0185, 0x4831, 0x0000, 0x4b50, 0x17fc, 0x169c, 0x0000,
+	    0x0000, 0x0000, 0x0405, 0x0000, 0x0dc3, 0x0000, 0x3410, 0x1d80,
+	    0x0000, 0x0000, 0x1805, 0x0000, 0x4bec, 0x08c5, 0x10a9, 0x3081,
+	    0x3ba0, 0x0000, 0x0000, 0x4375, 0x0000, 0x2cee, 0x0000, 0x16df,
+	    0x0000, 0x0000, 0x4d69, 0x38f5, 0x006f, 0x06a0, 0x0000, 0x263f,
+	    0x0000, 0x0000, 0x0c46, 0x0f40, 0x0000, 0x21af, 0x2c60, 0x40e8,
+	    0x0000, 0x0000, 0x1187, 0x0000, 0x0481, 0x0000, 0x0d9a, 0x49ca,
+	    0x427d, 0x0000, 0x3b83, 0x19f7, 0x0000, 0x0000, 0x3d7b, 0x0000,
+	    0x2314, 0x256a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4651,
+	    0x01e5, 0x3c6f, 0x0000, 0x25c0, 0x1ff3, 0x3a3a, 0x3e60, 0x0000,
+	    0x18bf, 0x0422, 0x3c33, 0x1aac, 0x0000, 0x0000, 0x0000, 0x182a,
+	    0x0593, 0x10f4, 0x0000, 0x0000, 0x06b7, 0x2a3d, 0x43de, 0x43e3,
+	    0x1884, 0x0000, 0x0000, 0x2911, 0x41ac, 0x0000, 0x024b, 0x0000,
+	    0x4ad2, 0x0a7c, 0x3ae2, 0x0000, 0x00ac, 0x1eec, 0x0f9f, 0x47cf,
+	    0x3775, 0x0000, 0x0000, 0x3fab, 0x0000, 0x0000, 0x09f6, 0x45da,
+	    0x0000, 0x0e6e, 0x1847, 0x0000, 0x0000, 0x0000, 0x0149, 0x047e,
+	    0x0000, 0x0000, 0x1a18, 0x0000, 0x255a, 0x0000, 0x0a58, 0x0dca,
+	    0x2000, 0x12bb, 0x3e79, 0x43c4, 0x2221, 0x0000, 0x0000, 0x0000,
+	    0x4127, 0x0000, 0x165c, 0x0d2a, 0x0000, 0x0000, 0x4226, 0x0000,
+	    0x0000, 0x2dd4, 0x4a78, 0x0000, 0x0000, 0x3824, 0x45b7, 0x3db9,
+	    0x0fdf, 0x0000, 0x0000, 0x0000, 0x47aa, 0x0000, 0x0000, 0x0000,
+	    0x41cb, 0x0348, 0x291b, 0x0d34, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2df1, 0x155f, 0x0a77, 0x0000, 0x08dd, 0x3fb4, 0x2a2d,
+	    0x0000, 0x4c2d, 0x3b2b, 0x0600, 0x0000, 0x0000, 0x210e, 0x3a38,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4c0c, 0x0000, 0x0000, 0x0000,
+	    0x2434, 0x2c7a, 0x0381, 0x0000, 0x4b48, 0x0000, 0x0000, 0x0dda,
+	    0x3b44, 0x1aa8, 0x0000, 0x3575, 0x40e0, 0x0000, 0x0000, 0x32a0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0826, 0x0000, 0x0000, 0x3dbc,
+	    0x2a33, 0x0000, 0x4026, 0x0000, 0x0000, 0x49f2, 0x4a70, 0x0000,
+	    0x0000, 0x0000, 0x1c01, 0x0000, 0x0000, 0x4c71, 0x1eda, 0x231a,
+	    0x0000, 0x0190, 0x0000, 0x21aa, 0x36c1, 0x0000, 0x3fc4, 0x26db,
+	    0x1347, 0x3556, 0x388e, 0x2cd6, 0x00c7, 0x0000, 0x15d1, 0x4a86,
+	    0x06c9, 0x4760, 0x1d14, 0x4b05, 0x43f0, 0x0000, 0x1ba1, 0x31ff,
+	    0x063f, 0x24d5, 0x00fa, 0x133d, 0x0000, 0x338b, 0x0000, 0x0000,
+	    0x0937, 0x1150, 0x0000, 0x1dae, 0x0000, 0x37a2, 0x0000, 0x0000,
+	    0x0000, 0x2b67, 0x4537, 0x2953, 0x0000, 0x0000, 0x3fe8, 0x474e,
+	    0x3974, 0x0000, 0x084b, 0x10cc, 0x0ffb, 0x0000, 0x0000, 0x09f5,
+	    0x0205, 0x0000, 0x0000, 0x2d1b, 0x1f29, 0x3019, 0x454a, 0x0000,
+	    0x417c, 0x1d3d, 0x0000, 0x0000, 0x0000, 0x0212, 0x0000, 0x342e,
+	    0x0000, 0x0011, 0x3e0c, 0x196d, 0x2840, 0x45bb, 0x0be2, 0x23d8,
+	    0x47dc, 0x1bad, 0x4711, 0x0000, 0x003a, 0x26e5, 0x3504, 0x202a,
+	    0x0000, 0x2ff6, 0x3573, 0x0000, 0x0000, 0x1eee, 0x0162, 0x0000,
+	    0x0d9e, 0x0000, 0x1270, 0x0000, 0x3767, 0x4a47, 0x0441, 0x02be,
+	    0x0000, 0x3fb4, 0x1e39, 0x4310, 0x0e16, 0x0000, 0x0c7e, 0x3b13,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x222b, 0x407a, 0x0000, 0x225a,
+	    0x40d2, 0x0000, 0x4abe, 0x0000, 0x0bd6, 0x1fd9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x443d, 0x441c, 0x27be, 0x0000, 0x0000,
+	    0x0000, 0x2ffa, 0x470c, 0x3661, 0x0000, 0x0fc6, 0x0000, 0x0f0a,
+	    0x2539, 0x0a16, 0x1f4e, 0x0000, 0x0000, 0x44e4, 0x0000, 0x47bb,
+	    0x39f9, 0x3cef, 0x079d, 0x23c3, 0x0000, 0x0000, 0x0000, 0x4b29,
+	    0x0000, 0x1a80, 0x2f6c, 0x194d, 0x1193, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2c5c, 0x31e1, 0x1d72, 0x0000, 0x3c0d, 0x19a5, 0x2ae4,
+	    0x0080, 0x0737, 0x0000, 0x2296, 0x0000, 0x0000, 0x3657, 0x0ce0,
+	    0x10ac, 0x2b4d, 0x0000, 0x2994, 0x0000, 0x01a7, 0x20db, 0x2564,
+	    0x0000, 0x232f, 0x2952, 0x1815, 0x19e4, 0x2481, 0x13b1, 0x1382,
+	    0x4cbd, 0x00db, 0x0000, 0x0000, 0x0000, 0x0f60, 0x1ee8, 0x270b,
+	    0x0000, 0x0000, 0x1f2c, 0x3d08, 0x0000, 0x0000, 0x0b7d, 0x0000,
+	    0x12d5, 0x4848, 0x0000, 0x458d, 0x385d, 0x4650, 0x3385, 0x0000,
+	    0x453f, 0x288a, 0x04b6, 0x481d, 0x0000, 0x0000, 0x0000, 0x443c,
+	    0x3b92, 0x0e3e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ffc, 0x0000,
+	    0x0711, 0x3970, 0x0413, 0x0000, 0x0000, 0x0000, 0x0a44, 0x05ff,
+	    0x0000, 0x0000, 0x0000, 0x0f0e, 0x0000, 0x0000, 0x0000, 0x45bc,
+	    0x49bd, 0x4602, 0x284f, 0x1bff, 0x2d92, 0x3884, 0x07fe, 0x0a54,
+	    0x4398, 0x0000, 0x446a, 0x1497, 0x2552, 0x0000, 0x18e9, 0x0000,
+	    0x4bfb, 0x0000, 0x01c5, 0x1ae7, 0x1ccc, 0x1371, 0x11ea, 0x0000,
+	    0x0000, 0x3d12, 0x3ae5, 0x0275, 0x0000, 0x49f8, 0x3bc4, 0x0000,
+	    0x22fb, 0x0000, 0x0000, 0x458f, 0x3ad7, 0x492b, 0x10dd, 0x104f,
+	    0x4bf8, 0x28b2, 0x3577, 0x3176, 0x0fcf, 0x2597, 0x496e, 0x055e,
+	    0x2b03, 0x46f0, 0x0000, 0x1fa2, 0x3243, 0x06bd, 0x0000, 0x0000,
+	    0x177c, 0x0000, 0x45a1, 0x0000, 0x163b, 0x4120, 0x4765, 0x16f7,
+	    0x3521, 0x265c, 0x0f52, 0x14f9, 0x0000, 0x2045, 0x0000, 0x1811,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x456f, 0x0000, 0x01ba, 0x0d5f,
+	    0x28ae, 0x1e77, 0x07fe, 0x2a7f, 0x0000, 0x0000, 0x2c49, 0x0030,
+	    0x1e92, 0x0000, 0x3421, 0x031b, 0x1994, 0x0000, 0x0000, 0x472c,
+	    0x3bdb, 0x0000, 0x1c16, 0x33f9, 0x3528, 0x4d13, 0x0000, 0x108d,
+	    0x0000, 0x0d97, 0x1582, 0x0000, 0x0000, 0x0000, 0x0864, 0x1ca0,
+	    0x0000, 0x0000, 0x0b97, 0x0000, 0x49a8, 0x1a48, 0x445a, 0x492b,
+	    0x0000, 0x0000, 0x1b70, 0x0000, 0x4b11, 0x3615, 0x3965, 0x07af,
+	    0x461d, 0x0000, 0x4cc1, 0x0000, 0x34ed, 0x2baa, 0x3e3b, 0x22e7,
+	    0x0000, 0x303a, 0x18b2, 0x3839, 0x0000, 0x3707, 0x07d7, 0x0000,
+	    0x456d, 0x0000, 0x0000, 0x4b00, 0x4ad6, 0x2f67, 0x0000, 0x13ab,
+	    0x429e, 0x3ae9, 0x0000, 0x2274, 0x2779, 0x2a3f, 0x0000, 0x1016,
+	    0x4029, 0x1d7b, 0x141d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1e8a, 0x0000, 0x36d2, 0x0000, 0x0000, 0x0000, 0x3414, 0x4007,
+	    0x0000, 0x0000, 0x0000, 0x28b5, 0x0000, 0x0000, 0x1509, 0x1ffe,
+	    0x0000, 0x0000, 0x0000, 0x2810, 0x23d4, 0x0000, 0x26b8, 0x0000,
+	    0x1dca, 0x0000, 0x0bf1, 0x2d20, 0x0000, 0x0000, 0x27f4, 0x0000,
+	    0x2a93, 0x04e1, 0x43db, 0x20a8, 0x1e8b, 0x3d16, 0x35f1, 0x0038,
+	    0x49be, 0x0236, 0x0000, 0x0000, 0x3cb3, 0x0000, 0x0000, 0x296b,
+	    0x18f6, 0x1229, 0x27c4, 0x0000, 0x0000, 0x0000, 0x0d7a, 0x1128,
+	    0x0000, 0x0000, 0x0000, 0x243d, 0x49a4, 0x0000, 0x4c95, 0x0ae3,
+	    0x440d, 0x4188, 0x486b, 0x4113, 0x13bd, 0x2499, 0x0000, 0x1e5a,
+	    0x0000, 0x33d1, 0x2849, 0x489f, 0x136d, 0x1587, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1a83, 0x0000, 0x15b3, 0x2307, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x22fb, 0x0ad4, 0x0000, 0x00d2, 0x05b3,
+	    0x0000, 0x0000, 0x0000, 0x3b32, 0x0000, 0x0000, 0x0000, 0x1dc4,
+	    0x18f8, 0x2f21, 0x0000, 0x0000, 0x0000, 0x0000, 0x25d4, 0x1412,
+	    0x42b9, 0x0000, 0x0000, 0x3a48, 0x123c, 0x1e91, 0x0000, 0x0000,
+	    0x48b1, 0x353f, 0x0000, 0x0000, 0x0000, 0x462b, 0x0000, 0x134e,
+	    0x0000, 0x0000, 0x0000, 0x12c4, 0x17ef, 0x0000, 0x0000, 0x1134,
+	    0x0000, 0x1ef3, 0x30ab, 0x1cce, 0x0ada, 0x0000, 0x0000, 0x03e7,
+	    0x4b5a, 0x49e4, 0x2805, 0x0000, 0x4dab, 0x0000, 0x23dd, 0x1e80,
+	    0x3f3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4c63, 0x407b, 0x0000, 0x0000, 0x0cad, 0x0000, 0x0000, 0x02f4,
+	    0x2d28, 0x4d73, 0x2760, 0x2dd1, 0x4b8d, 0x4944, 0x0000, 0x27ed,
+	    0x0000, 0x2258, 0x0000, 0x0d02, 0x0000, 0x1b54, 0x0f71, 0x0000,
+	    0x0000, 0x0000, 0x1cf6, 0x0000, 0x0000, 0x14e8, 0x479b, 0x0000,
+	    0x0000, 0x27e3, 0x0000, 0x0000, 0x3fb4, 0x0000, 0x1b5b, 0x2e36,
+	    0x0000, 0x1d93, 0x0000, 0x0000, 0x2d34, 0x0bab, 0x0000, 0x0000,
+	    0x0000, 0x2ef4, 0x0000, 0x0000, 0x0000, 0x201a, 0x3754, 0x0000,
+	    0x3852, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d6b, 0x0157, 0x0000,
+	    0x0000, 0x3dc5, 0x0000, 0x0000, 0x0a8d, 0x202c, 0x0000, 0x35ff,
+	    0x0000, 0x061c, 0x343b, 0x45be, 0x0000, 0x26f5, 0x1b14, 0x0000,
+	    0x1621, 0x3f58, 0x22fb, 0x0000, 0x1d85, 0x0000, 0x1636, 0x3a69,
+	    0x0000, 0x0d38, 0x079a, 0x0000, 0x0c26, 0x1531, 0x0000, 0x0000,
+	    0x09e3, 0x4bf4, 0x3a20, 0x4b61, 0x311a, 0x19d1, 0x430a, 0x0b0b,
+	    0x0000, 0x450a, 0x421c, 0x37b6, 0x0000, 0x4446, 0x0000, 0x0000,
+	    0x3d53, 0x0000, 0x0000, 0x0000, 0x0000, 0x1dff, 0x494a, 0x0000,
+	    0x0000, 0x25b4, 0x0000, 0x0000, 0x0000, 0x079c, 0x0255, 0x0000,
+	    0x0000, 0x2c25, 0x0c96, 0x39e4, 0x171c, 0x0000, 0x442e, 0x0f00,
+	    0x0000, 0x13c7, 0x0000, 0x0000, 0x0ce3, 0x28e0, 0x2419, 0x34b3,
+	    0x26ff, 0x0000, 0x2b0b, 0x0000, 0x3ecd, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x21d3, 0x0000, 0x10fc, 0x0000, 0x1c9e, 0x0000,
+	    0x073f, 0x0000, 0x3d0f, 0x4328, 0x2c81, 0x265e, 0x4506, 0x077c,
+	    0x0000, 0x41d3, 0x0000, 0x0000, 0x0eef, 0x0000, 0x48c6, 0x0000,
+	    0x3579, 0x2739, 0x0000, 0x0f7c, 0x2ac5, 0x1c2f, 0x032a, 0x0000,
+	    0x4354, 0x346f, 0x0000, 0x0000, 0x4573, 0x0000, 0x0000, 0x02a6,
+	    0x0000, 0x2c09, 0x0bb9, 0x0a93, 0x1b62, 0x07a6, 0x1042, 0x3125,
+	    0x0000, 0x0000, 0x1ade, 0x46df, 0x0000, 0x2e95, 0x0000, 0x0000,
+	    0x39c9, 0x45c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d28,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x453a, 0x196b, 0x1a77,
+	    0x00c2, 0x1773, 0x0ca8, 0x1b1f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2d76, 0x0d9f, 0x0000, 0x0000, 0x0dcb, 0x0000, 0x0000,
+	    0x3838, 0x1bc6, 0x31e7, 0x0000, 0x0000, 0x4641, 0x0000, 0x19e9,
+	    0x1453, 0x06e1, 0x01ca, 0x02eb, 0x170c, 0x0000, 0x0085, 0x1397,
+	    0x0000, 0x0000, 0x3501, 0x0000, 0x235f, 0x0000, 0x0000, 0x1c0c,
+	    0x2bb3, 0x0000, 0x3df0, 0x2c33, 0x25cb, 0x290c, 0x45d3, 0x36ef,
+	    0x0000, 0x1b5d, 0x0000, 0x262f, 0x0000, 0x17af, 0x20e9, 0x14bf,
+	    0x1b73, 0x0000, 0x0000, 0x0a43, 0x0000, 0x0420, 0x0000, 0x2bff,
+	    0x09da, 0x2430, 0x2845, 0x14f2, 0x19b7, 0x195d, 0x4be7, 0x0000,
+	    0x3e14, 0x46a1, 0x454a, 0x2610, 0x30e4, 0x1e8a, 0x1526, 0x1c09,
+	    0x0ce1, 0x1a4c, 0x3198, 0x161f, 0x2e7f, 0x1fbf, 0x17c0, 0x39b8,
+	    0x0000, 0x0000, 0x0000, 0x3860, 0x2953, 0x1d29, 0x3fad, 0x1a5b,
+	    0x0000, 0x0000, 0x0000, 0x288f, 0x0000, 0x31f6, 0x0000, 0x0000,
+	    0x0000, 0x3875, 0x0000, 0x0000, 0x05d1, 0x0181, 0x42e9, 0x3401,
+	    0x0000, 0x14ce, 0x1f21, 0x0000, 0x2098, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x481e, 0x0000, 0x1f5e, 0x2b0e, 0x39da,
+	    0x49c8, 0x0802, 0x0000, 0x0000, 0x0000, 0x0000, 0x4cee, 0x0000,
+	    0x3a78, 0x0000, 0x150b, 0x1128, 0x0d80, 0x0000, 0x0000, 0x1695,
+	    0x0000, 0x0000, 0x0000, 0x0c1c, 0x0000, 0x0000, 0x0000, 0x19e7,
+	    0x0739, 0x3830, 0x08c8, 0x490e, 0x3b1b, 0x0000, 0x3379, 0x409b,
+	    0x3fac, 0x2d2f, 0x1f27, 0x4936, 0x0000, 0x0056, 0x0000, 0x0000,
+	    0x22ae, 0x34de, 0x0000, 0x233b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x47b0, 0x0000, 0x0000, 0x34fb, 0x0000, 0x26a5, 0x3aa9, 0x2ceb,
+	    0x0000, 0x0000, 0x0000, 0x2be3, 0x0646, 0x0000, 0x316b, 0x0000,
+	    0x4b62, 0x3b69, 0x481d, 0x0000, 0x47e9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3254, 0x0000, 0x20ae, 0x0000, 0x0000, 0x0000, 0x3999,
+	    0x246b, 0x0000, 0x29f3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ae5, 0x0000, 0x389e, 0x386a, 0x2005, 0x009f,
+	    0x0300, 0x1939, 0x28fe, 0x409f, 0x0000, 0x1655, 0x0000, 0x236e,
+	    0x0000, 0x0000, 0x0b96, 0x0d6c, 0x4dbc, 0x2034, 0x29e0, 0x060c,
+	    0x0000, 0x1e42, 0x46d7, 0x0000, 0x1a54, 0x0000, 0x0000, 0x0d6b,
+	    0x2140, 0x4504, 0x3ea5, 0x0000, 0x4312, 0x3c8e, 0x0000, 0x0000,
+	    0x45c8, 0x03e9, 0x0000, 0x1e35, 0x0000, 0x0000, 0x04ac, 0x0000,
+	    0x2332, 0x0b3a, 0x0000, 0x0000, 0x1237, 0x37e3, 0x0000, 0x02e8,
+	    0x12a8, 0x3116, 0x4676, 0x3515, 0x0000, 0x19a2, 0x1b8a, 0x4d71,
+	    0x41e5, 0x2e99, 0x460a, 0x27c0, 0x3f1f, 0x0000, 0x0000, 0x1f80,
+	    0x0000, 0x0000, 0x1f37, 0x0795, 0x0000, 0x366d, 0x1408, 0x0000,
+	    0x0000, 0x3b1c, 0x4651, 0x0000, 0x0000, 0x0000, 0x1857, 0x4b94,
+	    0x0000, 0x1309, 0x0000, 0x0000, 0x0000, 0x2824, 0x1cf4, 0x0000,
+	    0x4c58, 0x38a3, 0x029f, 0x0000, 0x2f02, 0x0000, 0x476a, 0x3c28,
+	    0x3468, 0x0cd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3f75, 0x2072, 0x24ad, 0x0000, 0x4b35, 0x3db8,
+	    0x0187, 0x4171, 0x0000, 0x1242, 0x4cc7, 0x0000, 0x2d40, 0x39cb,
+	    0x06b3, 0x0000, 0x0000, 0x286d, 0x0888, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x32c1, 0x1db7, 0x0000, 0x3040, 0x488b, 0x3186, 0x0000,
+	    0x2e66, 0x49a0, 0x0000, 0x2ef0, 0x4d36, 0x48d5, 0x0000, 0x10e3,
+	    0x48cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x3594, 0x4611, 0x0000,
+	    0x0916, 0x2d74, 0x390b, 0x45bf, 0x24be, 0x089a, 0x0000, 0x0000,
+	    0x0000, 0x0012, 0x0268, 0x1d8a, 0x1fb9, 0x1435, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x151f, 0x4ac6, 0x0000, 0x2689,
+	    0x240f, 0x0000, 0x48e2, 0x1ca1, 0x3bba, 0x4168, 0x1c8c, 0x45c4,
+	    0x2811, 0x0000, 0x40c9, 0x3833, 0x30c3, 0x0000, 0x0000, 0x0000,
+	    0x384c, 0x2db3, 0x0000, 0x0feb, 0x3e90, 0x2723, 0x45c7, 0x2e64,
+	    0x0000, 0x026f, 0x34f1, 0x1ee4, 0x0000, 0x168c, 0x0000, 0x0000,
+	    0x287a, 0x0000, 0x29b9, 0x0000, 0x203e, 0x0000, 0x0fc9, 0x38a4,
+	    0x2fb0, 0x4dd9, 0x0ea0, 0x0000, 0x1f86, 0x0000, 0x0000, 0x3d93,
+	    0x3909, 0x0000, 0x440f, 0x0000, 0x2d39, 0x0cb4, 0x0000, 0x06ae,
+	    0x04ce, 0x141d, 0x0000, 0x0000, 0x0bc3, 0x3fc3, 0x0000, 0x0000,
+	    0x0000, 0x35c6, 0x0000, 0x0000, 0x0000, 0x4cc3, 0x0000, 0x0f9b,
+	    0x1135, 0x41e8, 0x23a1, 0x2f44, 0x2d61, 0x03e4, 0x2da0, 0x14cc,
+	    0x2717, 0x0000, 0x0000, 0x3b77, 0x24ca, 0x4657, 0x0000, 0x4acd,
+	    0x34b9, 0x3849, 0x1195, 0x0000, 0x37a0, 0x1042, 0x4b58, 0x0000,
+	    0x0000, 0x0000, 0x1cc9, 0x36cf, 0x0000, 0x0000, 0x0433, 0x4d6c,
+	    0x0000, 0x0000, 0x0f49, 0x0000, 0x2e94, 0x0987, 0x4088, 0x1042,
+	    0x3704, 0x2de1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0760, 0x3232,
+	    0x4b06, 0x0000, 0x1ba6, 0x0000, 0x314b, 0x17f2, 0x1c81, 0x0000,
+	    0x47a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x114e,
+	    0x0000, 0x323b, 0x368d, 0x0000, 0x0e20, 0x0000, 0x286d, 0x11c9,
+	    0x0000, 0x0000, 0x227d, 0x0000, 0x2b0e, 0x3467, 0x459b, 0x0000,
+	    0x0000, 0x0000, 0x2c80, 0x14de, 0x082d, 0x0000, 0x0000, 0x4d54,
+	    0x1b53, 0x0000, 0x0000, 0x0b19, 0x233f, 0x12b1, 0x1796, 0x2463,
+	    0x0000, 0x0000, 0x2eda, 0x197b, 0x0000, 0x1724, 0x0000, 0x396d,
+	    0x0000, 0x38fd, 0x0031, 0x0000, 0x0000, 0x0000, 0x02f9, 0x0000,
+	    0x3bfa, 0x0000, 0x0000, 0x2fad, 0x4d1c, 0x0000, 0x3f89, 0x38f1,
+	    0x48c7, 0x0000, 0x0000, 0x44c0, 0x0639, 0x0000, 0x0000, 0x1fb1,
+	    0x4d23, 0x3539, 0x0000, 0x47c1, 0x0406, 0x0000, 0x0d38, 0x1b4e,
+	    0x2034, 0x0000, 0x0000, 0x224a, 0x1760, 0x0000, 0x2a16, 0x237a,
+	    0x2cd8, 0x0000, 0x0000, 0x0000, 0x4640, 0x02bc, 0x0000, 0x0000,
+	    0x11ef, 0x0000, 0x0000, 0x35bb, 0x0000, 0x0000, 0x11ac, 0x4062,
+	    0x2778, 0x48fe, 0x3c1e, 0x0000, 0x0378, 0x0000, 0x03f0, 0x07da,
+	    0x29a9, 0x0572, 0x2010, 0x0000, 0x0000, 0x0000, 0x19df, 0x0000,
+	    0x0000, 0x42cb, 0x0000, 0x02ed, 0x145b, 0x3362, 0x0000, 0x0000,
+	    0x0000, 0x181d, 0x2d97, 0x0e9f, 0x0000, 0x300b, 0x360f, 0x0000,
+	    0x02be, 0x0000, 0x307a, 0x0f1c, 0x0000, 0x0000, 0x0000, 0x144b,
+	    0x112d, 0x14e5, 0x0000, 0x4572, 0x1899, 0x2daf, 0x05ad, 0x0000,
+	    0x010a, 0x0000, 0x0000, 0x1df5, 0x456e, 0x0000, 0x0000, 0x0239,
+	    0x0000, 0x3598, 0x4662, 0x0000, 0x17dd, 0x1b04, 0x1d90, 0x0000,
+	    0x23f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d28, 0x0000,
+	    0x01c9, 0x08b5, 0x1305, 0x1814, 0x0000, 0x31af, 0x0544, 0x397a,
+	    0x0000, 0x0000, 0x3f19, 0x0000, 0x3e21, 0x0a71, 0x3bf4, 0x40cf,
+	    0x0000, 0x0000, 0x0000, 0x11b2, 0x4dce, 0x0000, 0x10ae, 0x0000,
+	    0x0000, 0x0aa5, 0x3a41, 0x2014, 0x0daf, 0x22a2, 0x3c70, 0x4837,
+	    0x0000, 0x10e6, 0x1c73, 0x2468, 0x0d4e, 0x1a51, 0x0000, 0x2d5a,
+	    0x363f, 0x2029, 0x0000, 0x0000, 0x0000, 0x0000, 0x23fb, 0x45a7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1ac5, 0x0000, 0x1481, 0x0936,
+	    0x0000, 0x28a7, 0x0000, 0x3c07, 0x4051, 0x0000, 0x0000, 0x05d6,
+	    0x0000, 0x35bc, 0x44ba, 0x1d13, 0x4aa1, 0x3fa2, 0x06eb, 0x0123,
+	    0x0000, 0x0000, 0x447e, 0x3bce, 0x396b, 0x0000, 0x29e6, 0x0281,
+	    0x0000, 0x0000, 0x0000, 0x35ea, 0x0000, 0x2d55, 0x1133, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4580, 0x1b7e, 0x151c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0290, 0x2b25, 0x0000, 0x0000, 0x0e4c, 0x4168,
+	    0x06bc, 0x0000, 0x0000, 0x43a8, 0x30a8, 0x1118, 0x16ff, 0x0000,
+	    0x38b1, 0x2019, 0x0000, 0x3b26, 0x0000, 0x0000, 0x2056, 0x0000,
+	    0x0000, 0x0000, 0x1be1, 0x3e09, 0x3819, 0x0461, 0x0000, 0x1dcc,
+	    0x0000, 0x0000, 0x1be4, 0x316b, 0x0cfa, 0x0000, 0x4a78, 0x0000,
+	    0x38eb, 0x0000, 0x4a88, 0x3a4c, 0x0b85, 0x1359, 0x160e, 0x19b8,
+	    0x07c6, 0x08a8, 0x3e4e, 0x0000, 0x0000, 0x0000, 0x32c4, 0x0000,
+	    0x12d8, 0x35e6, 0x4692, 0x4dc3, 0x0000, 0x0769, 0x2675, 0x1a0c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x051d,
+	    0x0722, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c63, 0x31fc,
+	    0x28c7, 0x0000, 0x4501, 0x0000, 0x1484, 0x0000, 0x1333, 0x398f,
+	    0x0000, 0x0442, 0x0000, 0x06b3, 0x0000, 0x0000, 0x0000, 0x40c3,
+	    0x41ef, 0x4245, 0x1668, 0x0c73, 0x0000, 0x0000, 0x20c8, 0x3802,
+	    0x245a, 0x0000, 0x48f2, 0x0000, 0x0000, 0x281e, 0x0000, 0x0000,
+	    0x279e, 0x150c, 0x0000, 0x1a52, 0x0000, 0x0943, 0x4d78, 0x0000,
+	    0x2b64, 0x3fe0, 0x0000, 0x31c4, 0x26b8, 0x0aa4, 0x0000, 0x0000,
+	    0x0d7e, 0x0000, 0x0000, 0x0000, 0x318b, 0x42a0, 0x0000, 0x350a,
+	    0x1bae, 0x1bcf, 0x0000, 0x0000, 0x0bb4, 0x1e7e, 0x0000, 0x0000,
+	    0x1cc6, 0x37b8, 0x2358, 0x476e, 0x1145, 0x00f6, 0x4da9, 0x0000,
+	    0x0000, 0x02c1, 0x0000, 0x0000, 0x116b, 0x0000, 0x1ca6, 0x191a,
+	    0x44a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x473a, 0x400d, 0x2b3f,
+	    0x0000, 0x3e9b, 0x4b95, 0x0000, 0x0000, 0x0000, 0x1936, 0x0dd8,
+	    0x2048, 0x3ad0, 0x2320, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x225e, 0x0000, 0x0000, 0x197f, 0x1cce, 0x43e6, 0x0000, 0x1bee,
+	    0x0000, 0x0000, 0x34e4, 0x15e6, 0x0000, 0x415e, 0x0000, 0x0000,
+	    0x30bd, 0x0464, 0x0b02, 0x42f3, 0x3056, 0x0e1a, 0x0693, 0x0000,
+	    0x08b2, 0x0000, 0x052c, 0x4350, 0x0000, 0x2d11, 0x0000, 0x0000,
+	    0x2eef, 0x1a6d, 0x021f, 0x0000, 0x0000, 0x46ea, 0x0000, 0x0000,
+	    0x477d, 0x4ce5, 0x4ca2, 0x0000, 0x02b3, 0x0000, 0x44cf, 0x417a,
+	    0x0000, 0x0000, 0x494e, 0x3453, 0x4d1f, 0x0000, 0x3827, 0x34e7,
+	    0x08bd, 0x0000, 0x19f1, 0x3f01, 0x08ff, 0x0000, 0x0000, 0x31db,
+	    0x3d85, 0x114d, 0x0eee, 0x46bf, 0x0000, 0x28d0, 0x1087, 0x32b3,
+	    0x0000, 0x1b77, 0x2e55, 0x0000, 0x169f, 0x0000, 0x15d1, 0x1b80,
+	    0x0bf9, 0x01c2, 0x201c, 0x0000, 0x1c47, 0x0000, 0x23e1, 0x0000,
+	    0x2a8a, 0x0000, 0x21ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0313,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d2c,
+	    0x2ee2, 0x0000, 0x0000, 0x0000, 0x0000, 0x33b5, 0x36b7, 0x1340,
+	    0x4bbb, 0x32d0, 0x14c4, 0x01e2, 0x0000, 0x2e07, 0x0e38, 0x2fa4,
+	    0x0000, 0x0000, 0x0000, 0x491a, 0x02b6, 0x36ee, 0x1ed6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04bd, 0x21c9, 0x0000, 0x0000, 0x46f7,
+	    0x0000, 0x226a, 0x2425, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x300a, 0x16e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x021c, 0x0000,
+	    0x0000, 0x0c7e, 0x0000, 0x0000, 0x0000, 0x1ac4, 0x0000, 0x0000,
+	    0x29aa, 0x0000, 0x2298, 0x3311, 0x0c90, 0x0000, 0x1af4, 0x0000,
+	    0x0000, 0x3e76, 0x1cde, 0x0000, 0x3ab3, 0x4c1c, 0x448b, 0x0000,
+	    0x0000, 0x1f44, 0x0000, 0x0000, 0x0000, 0x0000, 0x418e, 0x0000,
+	    0x0000, 0x4b08, 0x4d1a, 0x2e8b, 0x0000, 0x0000, 0x372e, 0x4994,
+	    0x207b, 0x0000, 0x1d97, 0x259b, 0x3afa, 0x0000, 0x263e, 0x4441,
+	    0x45f0, 0x0000, 0x0000, 0x0000, 0x1eb7, 0x48ea, 0x1de4, 0x0000,
+	    0x1583, 0x0000, 0x0000, 0x0000, 0x0000, 0x4592, 0x0000, 0x1142,
+	    0x0000, 0x3bbf, 0x4575, 0x0000, 0x14a7, 0x0c2e, 0x13e9, 0x0000,
+	    0x2071, 0x0555, 0x0000, 0x289d, 0x1cf1, 0x2f49, 0x0000, 0x0000,
+	    0x0000, 0x428a, 0x2496, 0x0000, 0x4896, 0x1c7b, 0x2e2f, 0x0000,
+	    0x3c9e, 0x34eb, 0x2536, 0x0765, 0x0000, 0x4b3b, 0x0676, 0x1c63,
+	    0x21fe, 0x02e9, 0x3a33, 0x0000, 0x2793, 0x173d, 0x0000, 0x0000,
+	    0x205d, 0x12b1, 0x0000, 0x0000, 0x0000, 0x2c4a, 0x0000, 0x1d4e,
+	    0x1ade, 0x0000, 0x0000, 0x0000, 0x3bf7, 0x4ae2, 0x24d7, 0x1a2b,
+	    0x37f9, 0x0000, 0x05ff, 0x0000, 0x2c04, 0x0000, 0x409b, 0x0000,
+	    0x0fbb, 0x0a25, 0x0000, 0x0e1e, 0x18ce, 0x3954, 0x3910, 0x0000,
+	    0x0c8d, 0x3282, 0x2ce9, 0x054f, 0x0000, 0x4b4a, 0x39d7, 0x2828,
+	    0x0000, 0x0000, 0x29e3, 0x1bfb, 0x28bf, 0x28af, 0x0000, 0x1028,
+	    0x0000, 0x0000, 0x0000, 0x1a21, 0x0000, 0x3bda, 0x3b0d, 0x3531,
+	    0x41e9, 0x3ca0, 0x0000, 0x0000, 0x443e, 0x3cb6, 0x0583, 0x142a,
+	    0x16fc, 0x49a4, 0x4120, 0x1f8d, 0x093e, 0x0000, 0x0000, 0x48e9,
+	    0x2d9e, 0x1cb2, 0x0000, 0x0000, 0x1cc5, 0x0000, 0x3b8d, 0x30b2,
+	    0x0000, 0x16d7, 0x02da, 0x0000, 0x4c67, 0x0000, 0x2965, 0x0000,
+	    0x2fa4, 0x0000, 0x37fe, 0x0000, 0x0809, 0x1475, 0x1e76, 0x0000,
+	    0x137c, 0x0000, 0x30ab, 0x0fa2, 0x0000, 0x0000, 0x16d2, 0x22fa,
+	    0x4b3c, 0x0000, 0x026f, 0x0000, 0x2280, 0x0000, 0x0000, 0x0000,
+	    0x240d, 0x0215, 0x0000, 0x0000, 0x244f, 0x00e1, 0x14af, 0x325a,
+	    0x48f5, 0x1e26, 0x0000, 0x3633, 0x4a77, 0x46f6, 0x4ced, 0x3583,
+	    0x3557, 0x0000, 0x0000, 0x0000, 0x0000, 0x4559, 0x0000, 0x3c6e,
+	    0x0000, 0x4a3e, 0x173b, 0x1db8, 0x0000, 0x3fb1, 0x0000, 0x485b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2fd7, 0x3c9a, 0x2f33, 0x0000,
+	    0x32b5, 0x0000, 0x0000, 0x0f45, 0x0415, 0x0000, 0x0000, 0x0000,
+	    0x0851, 0x0000, 0x1d96, 0x2fd1, 0x09d8, 0x0000, 0x0000, 0x0be5,
+	    0x0d25, 0x0000, 0x0000, 0x0000, 0x10f0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3d32, 0x2174, 0x37e3, 0x0000, 0x0000, 0x0000, 0x01cd,
+	    0x0000, 0x3c81, 0x478e, 0x06d1, 0x0aec, 0x0000, 0x2e79, 0x31eb,
+	    0x0000, 0x4839, 0x09a2, 0x3950, 0x0a2a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0794, 0x2b99, 0x0000, 0x3ba8, 0x47c8, 0x1e9c,
+	    0x18a3, 0x2ff0, 0x00de, 0x21d4, 0x0000, 0x3e3d, 0x0000, 0x2ebe,
+	    0x13d4, 0x386a, 0x0000, 0x0000, 0x3d92, 0x0000, 0x046f, 0x0000,
+	    0x1ed7, 0x0be6, 0x0894, 0x0000, 0x0000, 0x0000, 0x0000, 0x38ee,
+	    0x0000, 0x0da4, 0x0000, 0x0000, 0x32cd, 0x0000, 0x024f, 0x2d59,
+	    0x413d, 0x2742, 0x0000, 0x0000, 0x0000, 0x4b7a, 0x0d98, 0x0000,
+	    0x0000, 0x353d, 0x0000, 0x0000, 0x21f4, 0x0000, 0x2452, 0x0000,
+	    0x0000, 0x15f3, 0x0000, 0x2998, 0x0000, 0x3c68, 0x3de9, 0x462a,
+	    0x3905, 0x0000, 0x317a, 0x436b, 0x1f8e, 0x0000, 0x2e9d, 0x0000,
+	    0x0000, 0x0000, 0x3a70, 0x33b0, 0x458b, 0x4136, 0x299d, 0x439b,
+	    0x475b, 0x4d6d, 0x3c9b, 0x0000, 0x4c61, 0x3afa, 0x23e6, 0x150a,
+	    0x0000, 0x0000, 0x0000, 0x210a, 0x4bd8, 0x1e97, 0x3fd4, 0x2c14,
+	    0x0000, 0x0f2e, 0x1c29, 0x1cf9, 0x0423, 0x0000, 0x3a22, 0x0000,
+	    0x1853, 0x0326, 0x2405, 0x3390, 0x0000, 0x4222, 0x0000, 0x0000,
+	    0x2864, 0x1c12, 0x0a7a, 0x4c92, 0x0000, 0x0000, 0x0eaf, 0x4c5a,
+	    0x0000, 0x043b, 0x0000, 0x032e, 0x1aa2, 0x1463, 0x3026, 0x397c,
+	    0x29da, 0x32c3, 0x2f34, 0x4303, 0x0000, 0x3ff4, 0x0000, 0x0000,
+	    0x143b, 0x2619, 0x0000, 0x1af7, 0x0000, 0x0000, 0x4b12, 0x06c7,
+	    0x0000, 0x033c, 0x1d50, 0x46cf, 0x0000, 0x453c, 0x0000, 0x3277,
+	    0x15aa, 0x2ea0, 0x0000, 0x0e3d, 0x486d, 0x0000, 0x05ba, 0x2659,
+	    0x0000, 0x3178, 0x029c, 0x2f8b, 0x1269, 0x13f7, 0x4bfe, 0x3a9c,
+	    0x3bbd, 0x4745, 0x0000, 0x0000, 0x0000, 0x2112, 0x18da, 0x07c7,
+	    0x4c50, 0x449d, 0x0000, 0x3f13, 0x4ce0, 0x0000, 0x0def, 0x3260,
+	    0x0000, 0x0000, 0x4a1a, 0x0000, 0x4563, 0x2aeb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2ae6, 0x0000, 0x2312, 0x0000, 0x4d0e, 0x45a0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x382b, 0x2a4d, 0x17ba, 0x0000,
+	    0x0000, 0x2561, 0x0000, 0x0b7a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2c7c, 0x0ed7, 0x03a2, 0x0000, 0x274c, 0x4470, 0x42c6, 0x0000,
+	    0x1236, 0x0533, 0x3b31, 0x2eb8, 0x0000, 0x0274, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16b7, 0x2711, 0x4b27,
+	    0x0000, 0x2343, 0x466d, 0x0000, 0x0000, 0x22b1, 0x122e, 0x0860,
+	    0x393c, 0x3614, 0x0000, 0x08a6, 0x1db6, 0x0000, 0x41cd, 0x0efd,
+	    0x1c94, 0x22f1, 0x0000, 0x3966, 0x0000, 0x0000, 0x08b5, 0x0000,
+	    0x2bd9, 0x0000, 0x16db, 0x0000, 0x2b99, 0x0000, 0x0000, 0x056c,
+	    0x2944, 0x0000, 0x1eb9, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f2e,
+	    0x42b9, 0x2386, 0x2511, 0x3c60, 0x0000, 0x0038, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x21ba, 0x1436, 0x0000, 0x16e8, 0x0000, 0x4539,
+	    0x21a4, 0x18dd, 0x0000, 0x0000, 0x0000, 0x02fc, 0x0000, 0x408c,
+	    0x0000, 0x0000, 0x36d4, 0x0000, 0x0000, 0x0fd2, 0x2954, 0x0000,
+	    0x0c73, 0x0000, 0x0000, 0x014a, 0x0000, 0x3da6, 0x4dc1, 0x333f,
+	    0x0dc0, 0x0000, 0x3539, 0x0000, 0x0000, 0x0c4e, 0x063f, 0x0000,
+	    0x0000, 0x2314, 0x48ce, 0x083e, 0x0000, 0x002c, 0x1b95, 0x0000,
+	    0x2f4e, 0x06b6, 0x1cfa, 0x1440, 0x0000, 0x1e06, 0x0000, 0x0000,
+	    0x06dd, 0x46c1, 0x29dd, 0x4111, 0x0000, 0x4247, 0x14a2, 0x0000,
+	    0x0000, 0x2b9b, 0x2877, 0x1438, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x402b, 0x01a1, 0x0000, 0x0000, 0x0000, 0x12f3, 0x0000, 0x4ae0,
+	    0x2d7d, 0x4cf3, 0x2a85, 0x2f5f, 0x222d, 0x0000, 0x2ba0, 0x10f9,
+	    0x0000, 0x0652, 0x0000, 0x0000, 0x4a76, 0x0000, 0x0000, 0x18c8,
+	    0x10fb, 0x0000, 0x062f, 0x0000, 0x2a6c, 0x3527, 0x0000, 0x2d0b,
+	    0x0000, 0x0000, 0x16be, 0x14fc, 0x0000, 0x0000, 0x0000, 0x1f2e,
+	    0x0000, 0x4a79, 0x4673, 0x2a7a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1330, 0x0000, 0x0000, 0x067e, 0x068b, 0x3fae, 0x12d0,
+	    0x2953, 0x2aad, 0x1290, 0x4054, 0x0000, 0x4602, 0x32b0, 0x0000,
+	    0x2d83, 0x0156, 0x2c46, 0x1ceb, 0x0000, 0x0000, 0x2593, 0x0180,
+	    0x0000, 0x39ac, 0x46e9, 0x0000, 0x0000, 0x32ca, 0x0000, 0x0000,
+	    0x43d5, 0x0000, 0x2f06, 0x2000, 0x3f59, 0x0000, 0x239c, 0x439f,
+	    0x0793, 0x0000, 0x0278, 0x07e9, 0x0000, 0x0000, 0x0c14, 0x26e1,
+	    0x0000, 0x410a, 0x31d5, 0x0000, 0x0fd2, 0x0000, 0x23b8, 0x3864,
+	    0x0b97, 0x3dd6, 0x0000, 0x0000, 0x14d1, 0x271f, 0x0000, 0x1c42,
+	    0x239d, 0x4433, 0x3ede, 0x2231, 0x0000, 0x37c4, 0x0000, 0x0000,
+	    0x22be, 0x0000, 0x2f0a, 0x172b, 0x0612, 0x116b, 0x0000, 0x29d8,
+	    0x42a0, 0x0000, 0x0eff, 0x18ca, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4438, 0x0000, 0x0000, 0x0000, 0x3fa9, 0x0000, 0x0000, 0x21c4,
+	    0x0000, 0x3608, 0x0ed1, 0x31f7, 0x105a, 0x0000, 0x1a34, 0x022f,
+	    0x0000, 0x0000, 0x370b, 0x4e13, 0x3542, 0x0f61, 0x0000, 0x0000,
+	    0x0000, 0x4ca8, 0x1e0b, 0x0000, 0x0c8e, 0x0b7b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x10c8, 0x0a67, 0x1a0b, 0x0000, 0x0000, 0x1b26,
+	    0x0d12, 0x30b6, 0x18ea, 0x0000, 0x0000, 0x2ea7, 0x4c6d, 0x4443,
+	    0x1393, 0x0000, 0x0f07, 0x25bd, 0x054d, 0x2f30, 0x43b6, 0x1740,
+	    0x376b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e00, 0x2999, 0x2643,
+	    0x2482, 0x4026, 0x0000, 0x0000, 0x19c0, 0x19a9, 0x0000, 0x378f,
+	    0x2958, 0x48fb, 0x332d, 0x3797, 0x0000, 0x4273, 0x1536, 0x4a5b,
+	    0x4425, 0x0000, 0x062d, 0x262c, 0x38ad, 0x0000, 0x12f5, 0x1097,
+	    0x17ad, 0x004f, 0x0000, 0x032e, 0x0a88, 0x0000, 0x0000, 0x0000,
+	    0x27e7, 0x0000, 0x4479, 0x0000, 0x0000, 0x0ffa, 0x38df, 0x3416,
+	    0x0bf0, 0x1fd6, 0x2e62, 0x0000, 0x44d0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4384, 0x405e, 0x0000, 0x1899, 0x0ffc, 0x0000, 0x19a4,
+	    0x2da3, 0x0c65, 0x24e2, 0x4117, 0x0000, 0x1a28, 0x0438, 0x0000,
+	    0x10f6, 0x21c3, 0x21c5, 0x2aad, 0x36ac, 0x0000, 0x09de, 0x0000,
+	    0x223a, 0x0000, 0x0794, 0x0000, 0x0000, 0x0000, 0x0bfb, 0x0000,
+	    0x0000, 0x0000, 0x11c2, 0x47f1, 0x0000, 0x29b7, 0x0e35, 0x1f6e,
+	    0x0000, 0x0000, 0x2414, 0x0000, 0x4983, 0x0000, 0x0000, 0x0000,
+	    0x1791, 0x38c9, 0x4c65, 0x0b48, 0x472b, 0x3a96, 0x31c2, 0x2c21,
+	    0x0000, 0x0000, 0x2cda, 0x192d, 0x1f53, 0x070a, 0x0000, 0x0e4d,
+	    0x0000, 0x137f, 0x1254, 0x16c0, 0x38c7, 0x0000, 0x06eb, 0x1279,
+	    0x0ede, 0x0000, 0x0000, 0x0000, 0x1fe7, 0x0000, 0x13a1, 0x0000,
+	    0x0000, 0x112a, 0x0000, 0x33ff, 0x0000, 0x22de, 0x0000, 0x0000,
+	    0x3c91, 0x0000, 0x2946, 0x0000, 0x2d75, 0x0000, 0x0000, 0x4843,
+	    0x0000, 0x0817, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1e50, 0x0017, 0x47c3, 0x280b, 0x0107, 0x36b7, 0x0000, 0x0843,
+	    0x0000, 0x0000, 0x0000, 0x3569, 0x0000, 0x3048, 0x0000, 0x12a4,
+	    0x0000, 0x0f8a, 0x0000, 0x30b3, 0x0000, 0x44b1, 0x0000, 0x0000,
+	    0x0000, 0x06a1, 0x0c7e, 0x0000, 0x3889, 0x42fd, 0x0910, 0x0000,
+	    0x1249, 0x0000, 0x0000, 0x440a, 0x27c1, 0x4175, 0x03d5, 0x0000,
+	    0x0000, 0x0000, 0x3191, 0x0000, 0x214e, 0x1935, 0x0000, 0x4291,
+	    0x125c, 0x2cdd, 0x0000, 0x2f57, 0x0000, 0x2018, 0x3045, 0x3646,
+	    0x0d48, 0x48c0, 0x1232, 0x2f6d, 0x40de, 0x406f, 0x1a90, 0x0000,
+	    0x1d75, 0x3fa7, 0x04e0, 0x0000, 0x42f3, 0x3b30, 0x4bbe, 0x0000,
+	    0x49d9, 0x461a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c6d,
+	    0x0000, 0x355b, 0x3218, 0x3eb8, 0x0000, 0x388d, 0x0000, 0x1eec,
+	    0x3acc, 0x0000, 0x3c61, 0x0000, 0x3b84, 0x0000, 0x11b2, 0x0000,
+	    0x0000, 0x1ae2, 0x0000, 0x3b12, 0x17c5, 0x4dff, 0x0000, 0x0a67,
+	    0x3b42, 0x227a, 0x0000, 0x2d43, 0x0000, 0x07e3, 0x2552, 0x332e,
+	    0x0000, 0x0555, 0x1d48, 0x01fc, 0x0000, 0x41d6, 0x3d7e, 0x0000,
+	    0x0000, 0x0000, 0x3c77, 0x0000, 0x0000, 0x4639, 0x0000, 0x0000,
+	    0x4734, 0x3095, 0x2972, 0x4754, 0x0000, 0x0000, 0x0000, 0x17d6,
+	    0x114c, 0x0000, 0x1588, 0x1dc2, 0x17d4, 0x0000, 0x4a8c, 0x39ed,
+	    0x0000, 0x19d5, 0x0246, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3e5a, 0x0aa4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x233c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080,
+	    0x0000, 0x1762, 0x270c, 0x071e, 0x15e2, 0x0000, 0x0000, 0x0000,
+	    0x131d, 0x0000, 0x4351, 0x0000, 0x0000, 0x0000, 0x0000, 0x07d1,
+	    0x0000, 0x0000, 0x2d9b, 0x03a4, 0x0000, 0x0000, 0x0000, 0x0f2b,
+	    0x0000, 0x0265, 0x287c, 0x0000, 0x0000, 0x0000, 0x0000, 0x420d,
+	    0x33e8, 0x3478, 0x0bfa, 0x0000, 0x3325, 0x3eb4, 0x0000, 0x0000,
+	    0x3104, 0x0000, 0x0000, 0x0000, 0x4a29, 0x0000, 0x325b, 0x0000,
+	    0x4c58, 0x09a9, 0x01dc, 0x3ad0, 0x0000, 0x1154, 0x29b1, 0x0000,
+	    0x0ce3, 0x0000, 0x2356, 0x3449, 0x0000, 0x0000, 0x0000, 0x3ed5,
+	    0x0000, 0x2657, 0x351a, 0x1790, 0x1549, 0x0000, 0x0000, 0x2ac7,
+	    0x3987, 0x3827, 0x4677, 0x24cf, 0x0488, 0x3084, 0x49d9, 0x22c0,
+	    0x0000, 0x4970, 0x0000, 0x45f9, 0x0000, 0x0000, 0x0458, 0x3f4d,
+	    0x446d, 0x0000, 0x060f, 0x0000, 0x0000, 0x2a10, 0x16dd, 0x38b4,
+	    0x0000, 0x0000, 0x1f49, 0x2e3a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x49d8, 0x0000, 0x0d97, 0x18f4, 0x0000, 0x3f95, 0x0000, 0x1c94,
+	    0x0000, 0x46e1, 0x2f3b, 0x3a80, 0x43c6, 0x4b1b, 0x12fa, 0x0000,
+	    0x4cb1, 0x0000, 0x1499, 0x0000, 0x2d6f, 0x0000, 0x0000, 0x0000,
+	    0x37d8, 0x1136, 0x221c, 0x4396, 0x4189, 0x0000, 0x0000, 0x0b2f,
+	    0x0000, 0x4624, 0x2ead, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x302f, 0x0000, 0x3769, 0x0000, 0x4c4f, 0x0000, 0x034c,
+	    0x0000, 0x0000, 0x0847, 0x309c, 0x0000, 0x49e1, 0x0f9b, 0x238e,
+	    0x0000, 0x4a4c, 0x189b, 0x3651, 0x0000, 0x0000, 0x2be0, 0x1543,
+	    0x46d2, 0x10fd, 0x0000, 0x00cc, 0x0000, 0x0000, 0x0000, 0x0b02,
+	    0x2a92, 0x0000, 0x220a, 0x3632, 0x19af, 0x0000, 0x0b27, 0x4257,
+	    0x0e79, 0x27fc, 0x0000, 0x0f2d, 0x4d57, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x237a, 0x0000, 0x0049, 0x0c9b, 0x1198, 0x2b4c,
+	    0x0934, 0x0461, 0x24d5, 0x3317, 0x3c20, 0x391e, 0x1840, 0x0000,
+	    0x3289, 0x087d, 0x2c0c, 0x0000, 0x4a2b, 0x2eee, 0x0000, 0x33cd,
+	    0x0000, 0x0000, 0x0000, 0x4a78, 0x41c7, 0x0000, 0x0070, 0x0000,
+	    0x4393, 0x19f3, 0x3bb1, 0x39fb, 0x25e3, 0x0000, 0x0000, 0x0e89,
+	    0x4298, 0x0949, 0x0000, 0x3186, 0x401f, 0x0000, 0x1ccc, 0x47e2,
+	    0x07d3, 0x49a4, 0x0000, 0x1620, 0x0000, 0x4988, 0x0000, 0x0000,
+	    0x3538, 0x1ead, 0x0000, 0x33a1, 0x2efc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1433, 0x0000, 0x3e69, 0x0000, 0x0000,
+	    0x4010, 0x0000, 0x0000, 0x0000, 0x2dd6, 0x0e7e, 0x0000, 0x08e5,
+	    0x0000, 0x0cad, 0x0000, 0x0bde, 0x31a4, 0x4949, 0x2aa9, 0x0000,
+	    0x0e32, 0x0000, 0x0000, 0x3a9e, 0x0000, 0x18b3, 0x0528, 0x0000,
+	    0x0000, 0x10a2, 0x0000, 0x0000, 0x2f45, 0x290b, 0x0000, 0x0000,
+	    0x37d6, 0x0000, 0x36ef, 0x405a, 0x0000, 0x3084, 0x0aa3, 0x0ae0,
+	    0x21f5, 0x3925, 0x45df, 0x0000, 0x2aec, 0x3c4d, 0x0000, 0x45b4,
+	    0x2403, 0x0000, 0x4985, 0x3ab0, 0x0000, 0x4c71, 0x01dd, 0x0000,
+	    0x0000, 0x307d, 0x0000, 0x1945, 0x0000, 0x02ca, 0x0000, 0x0000,
+	    0x3e10, 0x47e3, 0x1d31, 0x4466, 0x0000, 0x0230, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2b61, 0x498d, 0x4a90, 0x2e37, 0x0847, 0x1a6b,
+	    0x370b, 0x1d1a, 0x2a71, 0x12dc, 0x23db, 0x0000, 0x301d, 0x1a49,
+	    0x1bf3, 0x0000, 0x2a1a, 0x0000, 0x3303, 0x34bc, 0x322c, 0x2472,
+	    0x1c5d, 0x0000, 0x16fc, 0x0000, 0x0000, 0x3e39, 0x0000, 0x3353,
+	    0x23e7, 0x0000, 0x4db1, 0x0000, 0x240e, 0x0395, 0x0000, 0x0000,
+	    0x0000, 0x33a8, 0x0000, 0x48e4, 0x204b, 0x43d2, 0x405b, 0x214d,
+	    0x0000, 0x053d, 0x0000, 0x0000, 0x425c, 0x0000, 0x4504, 0x0000,
+	    0x0529, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b36, 0x0000, 0x4a00,
+	    0x0705, 0x0000, 0x0cf4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x257a, 0x0aef, 0x0000, 0x4c16, 0x035a, 0x2bad, 0x3a89, 0x06f8,
+	    0x0000, 0x0000, 0x18e5, 0x0000, 0x0000, 0x2be1, 0x0000, 0x0000,
+	    0x461f, 0x0000, 0x0000, 0x43bf, 0x4cf6, 0x13fe, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x08a4, 0x41eb, 0x0000, 0x3ce9,
+	    0x0000, 0x47ec, 0x0000, 0x0000, 0x0000, 0x1acd, 0x20fd, 0x0000,
+	    0x2f75, 0x1bd3, 0x0b81, 0x0000, 0x0000, 0x3253, 0x0f73, 0x4d9a,
+	    0x0000, 0x0000, 0x0000, 0x420f, 0x0000, 0x04ae, 0x0814, 0x03bc,
+	    0x0564, 0x389a, 0x0000, 0x1ba0, 0x26b2, 0x2cea, 0x43fd, 0x0000,
+	    0x0000, 0x20e4, 0x0000, 0x0000, 0x4174, 0x3841, 0x4805, 0x0000,
+	    0x0285, 0x0000, 0x01c8, 0x0795, 0x0ce0, 0x1fd0, 0x279a, 0x1cca,
+	    0x0000, 0x0000, 0x42bd, 0x02c8, 0x14b2, 0x0000, 0x3c5e, 0x0000,
+	    0x0000, 0x0000, 0x1a60, 0x0ddb, 0x3c37, 0x0d87, 0x0000, 0x0000,
+	    0x0000, 0x3ffa, 0x0000, 0x1377, 0x0127, 0x2d93, 0x0000, 0x4991,
+	    0x17d2, 0x0000, 0x3832, 0x2710, 0x0000, 0x188a, 0x0000, 0x0aad,
+	    0x11cb, 0x0000, 0x2aa7, 0x0000, 0x00f6, 0x02cd, 0x23f1, 0x48f8,
+	    0x0000, 0x2125, 0x3db4, 0x0000, 0x2052, 0x4d4a, 0x0000, 0x49f9,
+	    0x0000, 0x389c, 0x1d72, 0x0000, 0x4293, 0x4bfd, 0x3d86, 0x0000,
+	    0x0000, 0x0000, 0x057f, 0x0000, 0x2f7d, 0x0000, 0x0000, 0x0000,
+	    0x1700, 0x2479, 0x0000, 0x3ac6, 0x0000, 0x1846, 0x4c3a, 0x085f,
+	    0x0a78, 0x3050, 0x0000, 0x3fa2, 0x0000, 0x136b, 0x25d5, 0x2aa4,
+	    0x0000, 0x0786, 0x4583, 0x3f94, 0x0000, 0x0000, 0x09c8, 0x222e,
+	    0x3105, 0x2aaa, 0x163e, 0x0000, 0x0000, 0x0000, 0x0000, 0x009b,
+	    0x0000, 0x0ad5, 0x0000, 0x0000, 0x165a, 0x0000, 0x38b0, 0x0000,
+	    0x0000, 0x35ce, 0x0110, 0x297a, 0x0000, 0x40ee, 0x3a18, 0x0000,
+	    0x38e1, 0x0000, 0x3cb2, 0x43d7, 0x3441, 0x0000, 0x0000, 0x08eb,
+	    0x4c01, 0x27bc, 0x0000, 0x4c93, 0x0000, 0x1b9f, 0x2e90, 0x2c58,
+	    0x0246, 0x0000, 0x0b97, 0x2faf, 0x0000, 0x1273, 0x1d5c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0cb5, 0x2f26, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3d9e, 0x0000, 0x0000, 0x0000,
+	    0x4a02, 0x0000, 0x0000, 0x0000, 0x24e4, 0x0000, 0x0000, 0x33ba,
+	    0x0000, 0x0000, 0x0000, 0x266f, 0x0000, 0x0000, 0x0000, 0x1800,
+	    0x3e62, 0x0000, 0x32c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b0c,
+	    0x0000, 0x374e, 0x0000, 0x455f, 0x14e6, 0x2826, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02fe, 0x45b2, 0x0000, 0x0901, 0x0000, 0x0000,
+	    0x3389, 0x112e, 0x0000, 0x0193, 0x1b4a, 0x0180, 0x0000, 0x2065,
+	    0x0000, 0x1a36, 0x0353, 0x3942, 0x0081, 0x0000, 0x0340, 0x0000,
+	    0x0000, 0x3525, 0x4138, 0x0000, 0x2a25, 0x080d, 0x3db0, 0x31b5,
+	    0x0000, 0x0000, 0x3584, 0x0000, 0x204a, 0x0000, 0x0000, 0x4704,
+	    0x0000, 0x468d, 0x2bcc, 0x1045, 0x0000, 0x239e, 0x4531, 0x0000,
+	    0x34b6, 0x0e8b, 0x0000, 0x40e0, 0x0e5e, 0x11a4, 0x480a, 0x39ce,
+	    0x17ad, 0x0000, 0x0671, 0x0150, 0x05fb, 0x0000, 0x1b93, 0x1440,
+	    0x0000, 0x098b, 0x4591, 0x0000, 0x344d, 0x1d67, 0x2130, 0x0000,
+	    0x122c, 0x0000, 0x0000, 0x1e71, 0x0000, 0x3dc8, 0x1a6d, 0x155f,
+	    0x0000, 0x0000, 0x1f3d, 0x2196, 0x3374, 0x0000, 0x0000, 0x06fe,
+	    0x0000, 0x0492, 0x0000, 0x0000, 0x0000, 0x0000, 0x3dce, 0x1545,
+	    0x0000, 0x178f, 0x0000, 0x06ef, 0x0000, 0x30c9, 0x0000, 0x0000,
+	    0x1b5c, 0x09ca, 0x413d, 0x420c, 0x0000, 0x0000, 0x2617, 0x42b8,
+	    0x0000, 0x1a53, 0x3745, 0x0000, 0x0932, 0x0000, 0x3355, 0x145f,
+	    0x3484, 0x0000, 0x0000, 0x24a0, 0x0000, 0x0000, 0x321c, 0x0000,
+	    0x0b5e, 0x0000, 0x0000, 0x0000, 0x27c1, 0x2e0e, 0x0000, 0x0000,
+	    0x2725, 0x0000, 0x1382, 0x0000, 0x41f0, 0x0000, 0x3bcf, 0x48ca,
+	    0x2861, 0x0000, 0x0000, 0x0e68, 0x0000, 0x0000, 0x0000, 0x1fc0,
+	    0x206f, 0x0bd3, 0x0000, 0x1191, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x135f, 0x2a85, 0x24e4, 0x4d97, 0x027b, 0x0000, 0x429e, 0x3000,
+	    0x168e, 0x134f, 0x0000, 0x44d7, 0x2722, 0x4190, 0x41b4, 0x0000,
+	    0x2ef5, 0x434a, 0x0000, 0x1fbb, 0x0000, 0x0326, 0x1fae, 0x0000,
+	    0x0000, 0x0000, 0x363a, 0x31e2, 0x0000, 0x1df8, 0x0000, 0x0000,
+	    0x4957, 0x0000, 0x1a05, 0x39ef, 0x3b15, 0x0000, 0x0000, 0x4ae1,
+	    0x2add, 0x0489, 0x0000, 0x1ff7, 0x34f8, 0x42bc, 0x0000, 0x2ec5,
+	    0x0000, 0x0000, 0x0000, 0x2dd4, 0x2ae3, 0x2a9f, 0x0b16, 0x3d46,
+	    0x02a9, 0x0000, 0x2763, 0x2800, 0x2b57, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x23c8, 0x160c, 0x0701, 0x4392,
+	    0x0000, 0x2637, 0x0cee, 0x0544, 0x2fd0, 0x4835, 0x00d6, 0x1f2d,
+	    0x291b, 0x0000, 0x1bf0, 0x0000, 0x0018, 0x0ff2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x06ba, 0x0000, 0x04a5, 0x21f9, 0x0000,
+	    0x0000, 0x0000, 0x12f4, 0x4dce, 0x3764, 0x0000, 0x47b4, 0x3b2e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x090a, 0x0000, 0x0000,
+	    0x0000, 0x1833, 0x434d, 0x3d3e, 0x1b73, 0x1649, 0x2352, 0x0467,
+	    0x2d7c, 0x00a7, 0x33c5, 0x266b, 0x25ab, 0x0000, 0x1d1a, 0x0000,
+	    0x0d8c, 0x0000, 0x0000, 0x097f, 0x2e3c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x31e5, 0x03a5, 0x0000, 0x0000, 0x177a, 0x4986, 0x0000,
+	    0x0000, 0x4b2d, 0x0000, 0x0000, 0x3fbb, 0x1d4f, 0x3f7f, 0x150a,
+	    0x303a, 0x0000, 0x0000, 0x0000, 0x3d19, 0x0000, 0x4645, 0x3219,
+	    0x48a0, 0x0000, 0x0000, 0x0e07, 0x0000, 0x0c02, 0x02b6, 0x0000,
+	    0x0000, 0x2d66, 0x3b02, 0x0000, 0x4c2a, 0x2308, 0x0000, 0x0000,
+	    0x2f92, 0x0000, 0x0000, 0x0000, 0x46e0, 0x110d, 0x0bd3, 0x0bce,
+	    0x0000, 0x005c, 0x0807, 0x2694, 0x0000, 0x1bdf, 0x1e3f, 0x0000,
+	    0x019b, 0x1cc0, 0x0119, 0x3245, 0x0000, 0x43d6, 0x2c96, 0x2b46,
+	    0x0000, 0x4213, 0x39e1, 0x0000, 0x0000, 0x0000, 0x0b94, 0x0000,
+	    0x0a11, 0x1f33, 0x01e2, 0x35c3, 0x0000, 0x3dfd, 0x3dbb, 0x04b4,
+	    0x0000, 0x0a4b, 0x0000, 0x2fb8, 0x13f9, 0x4e03, 0x0000, 0x0000,
+	    0x0000, 0x3f9a, 0x2e77, 0x0000, 0x4a1d, 0x0b80, 0x2f7c, 0x4281,
+	    0x3ace, 0x2785, 0x4c55, 0x2658, 0x38d9, 0x0000, 0x1289, 0x2207,
+	    0x0000, 0x0000, 0x0000, 0x3a46, 0x2146, 0x3913, 0x0000, 0x0000,
+	    0x0000, 0x4726, 0x3f9d, 0x3119, 0x3cc5, 0x4c5d, 0x0000, 0x20f4,
+	    0x1cc1, 0x29fd, 0x0000, 0x0d00, 0x1682, 0x094f, 0x0000, 0x4993,
+	    0x082e, 0x0000, 0x0000, 0x44e2, 0x0000, 0x0f5a, 0x0000, 0x4c32,
+	    0x0000, 0x0000, 0x2dc9, 0x0000, 0x0000, 0x2185, 0x0000, 0x1aca,
+	    0x4ae0, 0x3f5c, 0x0000, 0x0000, 0x1f0b, 0x0000, 0x1bc0, 0x43fe,
+	    0x439b, 0x31fa, 0x0000, 0x2108, 0x0daa, 0x01bc, 0x010c, 0x0000,
+	    0x0000, 0x37c1, 0x3268, 0x0000, 0x0000, 0x0000, 0x393b, 0x2a3e,
+	    0x209d, 0x02a2, 0x0000, 0x0000, 0x24bf, 0x0000, 0x0000, 0x342f,
+	    0x3ea3, 0x0000, 0x00cc, 0x31e7, 0x0000, 0x47bd, 0x0000, 0x3496,
+	    0x440b, 0x0000, 0x0000, 0x0000, 0x1dc5, 0x30ef, 0x0000, 0x003c,
+	    0x126f, 0x1bd0, 0x0000, 0x34ad, 0x0000, 0x0000, 0x3f9a, 0x224c,
+	    0x3130, 0x401f, 0x0000, 0x0000, 0x0000, 0x0f19, 0x38b0, 0x474c,
+	    0x378b, 0x349e, 0x0000, 0x16e3, 0x0000, 0x3ad3, 0x2338, 0x00e5,
+	    0x0000, 0x305a, 0x3dfb, 0x0000, 0x0000, 0x48d3, 0x05db, 0x0000,
+	    0x0000, 0x4032, 0x3510, 0x2f74, 0x0000, 0x0000, 0x0000, 0x4c39,
+	    0x0000, 0x0000, 0x2d4f, 0x432c, 0x0000, 0x2069, 0x21a4, 0x4d6f,
+	    0x27af, 0x0000, 0x0000, 0x3365, 0x0000, 0x0000, 0x0000, 0x4357,
+	    0x3b80, 0x244a, 0x0000, 0x0000, 0x34a4, 0x2f52, 0x1533, 0x0000,
+	    0x0000, 0x1f08, 0x2e57, 0x388d, 0x0000, 0x3d78, 0x2ab8, 0x1cfc,
+	    0x0000, 0x0cd8, 0x0000, 0x156b, 0x0458, 0x0000, 0x035e, 0x2bdf,
+	    0x1bed, 0x00d8, 0x0000, 0x3388, 0x110f, 0x0000, 0x0000, 0x0000,
+	    0x3e0f, 0x1bbf, 0x0ce3, 0x0193, 0x0000, 0x0000, 0x3a30, 0x0000,
+	    0x0d12, 0x2a6d, 0x0000, 0x1d48, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x30bf, 0x0000, 0x3b2c, 0x0000, 0x0000, 0x0000,
+	    0x4a2a, 0x1a2b, 0x0000, 0x31aa, 0x0000, 0x4b63, 0x32ee, 0x2324,
+	    0x43e2, 0x0000, 0x0000, 0x0000, 0x38c2, 0x342e, 0x0000, 0x0006,
+	    0x0000, 0x0000, 0x397d, 0x0000, 0x35c6, 0x2fcb, 0x3be0, 0x0000,
+	    0x1393, 0x387e, 0x20b3, 0x0000, 0x05fb, 0x27b8, 0x0000, 0x0000,
+	    0x3c48, 0x0000, 0x411e, 0x0000, 0x0000, 0x29df, 0x4514, 0x0000,
+	    0x014b, 0x3124, 0x0000, 0x2659, 0x03a4, 0x0110, 0x16c6, 0x0000,
+	    0x37cd, 0x0000, 0x0000, 0x35af, 0x0e7f, 0x4d84, 0x2ab8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2ef8, 0x01f8, 0x04f6, 0x27c6, 0x1c43,
+	    0x1ed4, 0x0000, 0x1bb8, 0x0000, 0x2377, 0x0000, 0x08e2, 0x0000,
+	    0x0000, 0x4bf8, 0x0000, 0x496d, 0x0000, 0x0000, 0x4015, 0x0000,
+	    0x3c8e, 0x25eb, 0x0ea2, 0x3f6c, 0x0000, 0x0000, 0x3cbc, 0x25fb,
+	    0x3d11, 0x09dc, 0x0000, 0x0000, 0x1b31, 0x28ac, 0x0000, 0x3a93,
+	    0x1fb7, 0x017f, 0x0000, 0x0000, 0x0d71, 0x428d, 0x0000, 0x0000,
+	    0x36ba, 0x0000, 0x4983, 0x2c29, 0x0000, 0x1370, 0x0156, 0x0000,
+	    0x3a50, 0x26cf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x25e8, 0x456c, 0x0000, 0x36f6, 0x0f98, 0x3869, 0x4495, 0x0000,
+	    0x17ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x056c, 0x0000,
+	    0x0000, 0x48f4, 0x0000, 0x3380, 0x228d, 0x1e35, 0x0000, 0x483e,
+	    0x00fe, 0x0000, 0x0842, 0x0000, 0x06c6, 0x0000, 0x0000, 0x289b,
+	    0x1475, 0x4a57, 0x1c40, 0x051a, 0x2196, 0x0000, 0x1ad6, 0x4283,
+	    0x42c8, 0x0000, 0x04db, 0x0000, 0x0000, 0x04bb, 0x1c4c, 0x0000,
+	    0x1a60, 0x0000, 0x3266, 0x1a3d, 0x410a, 0x1091, 0x0000, 0x08f0,
+	    0x0000, 0x4681, 0x2539, 0x36f0, 0x0ccb, 0x46e1, 0x34d9, 0x0000,
+	    0x2c36, 0x001f, 0x46e7, 0x1933, 0x0fa8, 0x2b40, 0x0000, 0x051a,
+	    0x1957, 0x4789, 0x05e4, 0x0000, 0x0000, 0x2189, 0x0000, 0x142b,
+	    0x44ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x3753, 0x13fd, 0x0000,
+	    0x1a38, 0x0000, 0x0000, 0x3aad, 0x0000, 0x2652, 0x2ac7, 0x0000,
+	    0x1066, 0x0000, 0x0000, 0x0000, 0x18de, 0x4870, 0x4286, 0x0000,
+	    0x1075, 0x0000, 0x0000, 0x0000, 0x07fa, 0x1335, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4386, 0x2a89, 0x0000, 0x0000, 0x3f72, 0x0000,
+	    0x316a, 0x1945, 0x2a12, 0x3983, 0x3e58, 0x0000, 0x0000, 0x48b2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2489, 0x22b1, 0x34e2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bc3, 0x0000,
+	    0x324d, 0x1930, 0x0000, 0x0000, 0x462e, 0x1226, 0x059c, 0x0000,
+	    0x386c, 0x0000, 0x0000, 0x47c8, 0x0000, 0x3b82, 0x0000, 0x22e5,
+	    0x4de8, 0x3bfa, 0x0000, 0x0000, 0x31f8, 0x0000, 0x3a39, 0x24ee,
+	    0x0000, 0x45c8, 0x0000, 0x1351, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2ed1, 0x0f44, 0x0000, 0x0000, 0x0000, 0x4c78, 0x0000, 0x2a0f,
+	    0x1a1a, 0x4341, 0x0000, 0x1c16, 0x1779, 0x039e, 0x37bf, 0x0000,
+	    0x04db, 0x4a0d, 0x0000, 0x0304, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1932, 0x2145, 0x354a, 0x197f, 0x1d4a, 0x46c0, 0x4d60, 0x0000,
+	    0x2e3f, 0x0000, 0x0928, 0x07a6, 0x05b3, 0x31ad, 0x0000, 0x0000,
+	    0x13ef, 0x0000, 0x206f, 0x0000, 0x0000, 0x0000, 0x37dd, 0x0000,
+	    0x0000, 0x1eb1, 0x0000, 0x0000, 0x0000, 0x0f4b, 0x0000, 0x36ed,
+	    0x0000, 0x11f5, 0x219f, 0x175a, 0x0000, 0x0000, 0x235e, 0x0000,
+	    0x0000, 0x3c6f, 0x002b, 0x3f3d, 0x0000, 0x0000, 0x03a0, 0x0000,
+	    0x0000, 0x22e2, 0x0000, 0x1e6e, 0x4205, 0x0000, 0x2d78, 0x0000,
+	    0x051d, 0x0000, 0x0000, 0x0051, 0x0000, 0x0000, 0x028f, 0x03a8,
+	    0x380f, 0x4d79, 0x0bfe, 0x0000, 0x0000, 0x0000, 0x09be, 0x0000,
+	    0x278e, 0x34a1, 0x1dcf, 0x0000, 0x349b, 0x088f, 0x015f, 0x0000,
+	    0x0000, 0x0000, 0x124c, 0x0c25, 0x2239, 0x1b00, 0x0000, 0x0000,
+	    0x0000, 0x053b, 0x0000, 0x0000, 0x3a5d, 0x27c8, 0x4d3d, 0x0000,
+	    0x0000, 0x159c, 0x4a61, 0x14ec, 0x0000, 0x0000, 0x0000, 0x460b,
+	    0x0000, 0x3eea, 0x0000, 0x275e, 0x0000, 0x17f6, 0x3270, 0x0000,
+	    0x0000, 0x0000, 0x3e65, 0x0000, 0x106e, 0x195a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x441d, 0x2758, 0x2482, 0x3aed, 0x378e,
+	    0x48ca, 0x456d, 0x4650, 0x205a, 0x361f, 0x0417, 0x1f32, 0x0000,
+	    0x0925, 0x30f6, 0x2fc1, 0x130c, 0x0000, 0x3caa, 0x34e9, 0x150b,
+	    0x3698, 0x1c3d, 0x0000, 0x0000, 0x37aa, 0x3768, 0x22af, 0x4b8b,
+	    0x1360, 0x0000, 0x0290, 0x4ded, 0x0000, 0x0000, 0x2e42, 0x0000,
+	    0x089e, 0x0000, 0x0000, 0x0000, 0x2b73, 0x3495, 0x32bf, 0x1faf,
+	    0x17eb, 0x0000, 0x4c47, 0x0000, 0x0000, 0x0000, 0x19e0, 0x0000,
+	    0x48c6, 0x12e8, 0x0000, 0x46c8, 0x0000, 0x0016, 0x0069, 0x320f,
+	    0x3e75, 0x0000, 0x4c6d, 0x37e6, 0x2e95, 0x39d1, 0x0000, 0x0626,
+	    0x2541, 0x0000, 0x22b6, 0x12ec, 0x203a, 0x1d4b, 0x4804, 0x20f3,
+	    0x46dc, 0x3f9b, 0x15d0, 0x3c18, 0x069a, 0x0000, 0x0000, 0x49a6,
+	    0x0000, 0x48db, 0x40cf, 0x0000, 0x07ca, 0x0000, 0x0000, 0x22ff,
+	    0x4ad6, 0x3345, 0x33c9, 0x4603, 0x0000, 0x3ee8, 0x0000, 0x315e,
+	    0x0000, 0x0000, 0x17c8, 0x0000, 0x129c, 0x01f9, 0x0000, 0x2871,
+	    0x324d, 0x0000, 0x3586, 0x1535, 0x44b8, 0x39bc, 0x0000, 0x3fe2,
+	    0x4639, 0x0000, 0x0539, 0x0000, 0x1cc2, 0x0000, 0x236e, 0x2640,
+	    0x0000, 0x1129, 0x43fc, 0x0000, 0x0768, 0x2b9f, 0x0000, 0x0000,
+	    0x0000, 0x2caf, 0x0000, 0x209b, 0x0000, 0x0652, 0x0f08, 0x0000,
+	    0x0000, 0x2a6f, 0x38d9, 0x2103, 0x337b, 0x0000, 0x12f7, 0x321f,
+	    0x0000, 0x0c50, 0x225c, 0x3248, 0x2714, 0x0000, 0x3f1b, 0x22cc,
+	    0x0000, 0x17bb, 0x0000, 0x2ef4, 0x2dec, 0x0000, 0x0000, 0x38d6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x458c, 0x0000, 0x1bc1,
+	    0x0000, 0x444d, 0x3cc3, 0x2ed7, 0x0000, 0x4194, 0x0000, 0x0685,
+	    0x2238, 0x4c14, 0x0000, 0x0000, 0x2a2d, 0x2a4e, 0x047f, 0x15e2,
+	    0x0000, 0x0000, 0x2c31, 0x0000, 0x1146, 0x0000, 0x0000, 0x0000,
+	    0x3f6c, 0x0ef3, 0x1cd7, 0x4a39, 0x3624, 0x3214, 0x0000, 0x0629,
+	    0x3983, 0x0000, 0x1007, 0x273a, 0x0000, 0x0000, 0x0000, 0x3854,
+	    0x0000, 0x2574, 0x315f, 0x4bb4, 0x4cee, 0x487b, 0x215a, 0x0000,
+	    0x0552, 0x1056, 0x0000, 0x0000, 0x29a3, 0x0000, 0x0000, 0x37c3,
+	    0x10f0, 0x0000, 0x0000, 0x3668, 0x41f9, 0x2e64, 0x1cfb, 0x0000,
+	    0x1a19, 0x3f79, 0x0000, 0x3935, 0x0000, 0x0000, 0x03e9, 0x0000,
+	    0x0000, 0x0899, 0x0000, 0x38e2, 0x3321, 0x3bb0, 0x0003, 0x0af2,
+	    0x4050, 0x3978, 0x4be1, 0x1e0f, 0x2209, 0x16b6, 0x0000, 0x0000,
+	    0x0000, 0x44b2, 0x0000, 0x0ca6, 0x0000, 0x0049, 0x4109, 0x0000,
+	    0x4bc2, 0x0000, 0x218f, 0x0000, 0x097a, 0x257e, 0x4cc8, 0x13f3,
+	    0x1712, 0x2d23, 0x34bb, 0x3538, 0x0849, 0x44a7, 0x1595, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x45dc, 0x19d7, 0x0000, 0x1804, 0x0000,
+	    0x0000, 0x0000, 0x45e9, 0x342f, 0x190f, 0x4095, 0x0000, 0x38d1,
+	    0x1bcc, 0x00a3, 0x44ef, 0x0064, 0x2c75, 0x0000, 0x058b, 0x45b9,
+	    0x4190, 0x0266, 0x3776, 0x0000, 0x2c55, 0x01de, 0x3e03, 0x1f18,
+	    0x0000, 0x43e4, 0x0000, 0x4da5, 0x22c5, 0x09f2, 0x0000, 0x3a89,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x027a, 0x2741, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4c0c, 0x4144, 0x2c4f, 0x0000, 0x40dd,
+	    0x1059, 0x21f5, 0x0000, 0x0000, 0x418a, 0x0000, 0x0000, 0x0000,
+	    0x2fcf, 0x0000, 0x177f, 0x01eb, 0x18bb, 0x3511, 0x3944, 0x1234,
+	    0x1818, 0x0000, 0x3068, 0x2842, 0x1a7f, 0x4579, 0x1d6f, 0x0000,
+	    0x2532, 0x105e, 0x0000, 0x0000, 0x4167, 0x0000, 0x394f, 0x0000,
+	    0x0000, 0x0f06, 0x0000, 0x0000, 0x0000, 0x05cc, 0x0000, 0x0062,
+	    0x0000, 0x1dd6, 0x3b46, 0x3255, 0x216b, 0x28da, 0x0e39, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x339e, 0x0000, 0x2257, 0x2c0e, 0x0000,
+	    0x0000, 0x0000, 0x289d, 0x0000, 0x0000, 0x01ad, 0x1464, 0x4580,
+	    0x40a5, 0x148f, 0x495c, 0x3c12, 0x11b7, 0x0000, 0x4d48, 0x1dad,
+	    0x34cf, 0x4ba0, 0x0000, 0x0000, 0x286a, 0x2491, 0x0009, 0x0000,
+	    0x0000, 0x4b0e, 0x0000, 0x2484, 0x32c2, 0x33a4, 0x0000, 0x0000,
+	    0x0d45, 0x0000, 0x3bcb, 0x2616, 0x354e, 0x2802, 0x2de4, 0x4958,
+	    0x0275, 0x3813, 0x0089, 0x0000, 0x0c05, 0x39a2, 0x32f8, 0x42e7,
+	    0x0000, 0x0000, 0x3566, 0x0000, 0x0602, 0x3670, 0x0000, 0x41f4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x40a0, 0x19f3, 0x0000, 0x0000,
+	    0x1128, 0x0000, 0x0000, 0x3fe7, 0x3d43, 0x0000, 0x0bd3, 0x0000,
+	    0x3e61, 0x0cfb, 0x0000, 0x03b2, 0x1c60, 0x2199, 0x0000, 0x0000,
+	    0x0000, 0x488a, 0x0000, 0x2762, 0x09ff, 0x0000, 0x0000, 0x0000,
+	    0x464e, 0x3d17, 0x2149, 0x0000, 0x0e9a, 0x0000, 0x1d56, 0x2c49,
+	    0x2bf6, 0x059d, 0x0000, 0x3021, 0x2c7e, 0x4ca0, 0x0000, 0x0bf3,
+	    0x0000, 0x4a35, 0x0000, 0x0000, 0x0000, 0x0000, 0x45ef, 0x0000,
+	    0x1642, 0x0000, 0x0000, 0x4bbf, 0x1d8d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0deb, 0x2e5e, 0x1fc2, 0x0000, 0x221e, 0x0000, 0x2fe7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x31b1, 0x0000, 0x1c76, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2470, 0x0000, 0x1c99, 0x0000, 0x0000,
+	    0x040e, 0x0000, 0x4ca6, 0x1be6, 0x11cd, 0x0f4c, 0x0000, 0x0000,
+	    0x034a, 0x0000, 0x0000, 0x4a00, 0x0445, 0x2c7b, 0x4268, 0x0000,
+	    0x1698, 0x0000, 0x0000, 0x3ed0, 0x0000, 0x0000, 0x21b6, 0x0000,
+	    0x0000, 0x2ea7, 0x1f4d, 0x49d1, 0x0000, 0x0bbe, 0x0128, 0x1dc0,
+	    0x167d, 0x09c7, 0x14ac, 0x37fd, 0x2d47, 0x43ef, 0x2e6a, 0x39a6,
+	    0x2ff0, 0x0000, 0x0000, 0x4406, 0x0a9a, 0x345e, 0x49f4, 0x0000,
+	    0x0000, 0x1c58, 0x1bbf, 0x02f5, 0x3616, 0x0553, 0x31a0, 0x0000,
+	    0x0000, 0x0502, 0x393e, 0x25b3, 0x0211, 0x2218, 0x13a8, 0x43a1,
+	    0x0000, 0x1cda, 0x204b, 0x21c9, 0x0000, 0x07e6, 0x022a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4adf, 0x4349, 0x1b53, 0x0000, 0x14ee,
+	    0x1f28, 0x044e, 0x0000, 0x0000, 0x4ab8, 0x0000, 0x36aa, 0x0000,
+	    0x3ecd, 0x0000, 0x1032, 0x2495, 0x4114, 0x0f51, 0x33ab, 0x1fea,
+	    0x2cc0, 0x27c7, 0x238f, 0x3666, 0x22c8, 0x0000, 0x20ac, 0x098c,
+	    0x48d1, 0x0000, 0x0000, 0x4c49, 0x0000, 0x30d7, 0x0000, 0x0657,
+	    0x0000, 0x0a89, 0x0000, 0x06c6, 0x0000, 0x013c, 0x0000, 0x0000,
+	    0x0000, 0x1505, 0x0ef9, 0x1ac9, 0x0000, 0x0586, 0x0000, 0x28ca,
+	    0x0000, 0x0000, 0x3279, 0x2c9c, 0x163c, 0x0000, 0x45c3, 0x0000,
+	    0x0000, 0x4c45, 0x3e9c, 0x4548, 0x1477, 0x0e75, 0x0000, 0x0000,
+	    0x0000, 0x154e, 0x3a2b, 0x0000, 0x0000, 0x1024, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ef3, 0x0000, 0x2fc3, 0x09d4, 0x14f7, 0x3ee2,
+	    0x2528, 0x346b, 0x0000, 0x16e7, 0x3bbd, 0x412b, 0x0000, 0x0000,
+	    0x4454, 0x0000, 0x0377, 0x0e21, 0x1b8c, 0x0000, 0x2366, 0x0000,
+	    0x3cb4, 0x33c6, 0x0000, 0x0000, 0x303a, 0x2933, 0x4c88, 0x3b0d,
+	    0x3e93, 0x2ec8, 0x1595, 0x352d, 0x387b, 0x0000, 0x0000, 0x3564,
+	    0x0000, 0x0000, 0x4242, 0x02cc, 0x3503, 0x0c77, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4d8d, 0x2f8f, 0x0000, 0x4be8, 0x29c2,
+	    0x0000, 0x4233, 0x3dc7, 0x038e, 0x1330, 0x345b, 0x0000, 0x47b0,
+	    0x2a08, 0x2ac3, 0x0000, 0x0000, 0x1860, 0x32cf, 0x1bbc, 0x4979,
+	    0x0000, 0x1229, 0x0000, 0x3999, 0x2708, 0x2b40, 0x40fd, 0x2431,
+	    0x2916, 0x0000, 0x0000, 0x4a4a, 0x4d8c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1166, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f39, 0x2163,
+	    0x21f8, 0x0000, 0x0f90, 0x2f9f, 0x03b0, 0x46ad, 0x045b, 0x07b6,
+	    0x0a4e, 0x2e2c, 0x3546, 0x0000, 0x0000, 0x1a73, 0x0000, 0x0000,
+	    0x2443, 0x0000, 0x28d2, 0x0000, 0x0000, 0x0043, 0x0000, 0x410c,
+	    0x4dd9, 0x0000, 0x2e4a, 0x04d6, 0x0000, 0x21cc, 0x0000, 0x448a,
+	    0x122f, 0x2e45, 0x26c6, 0x1e06, 0x1563, 0x2afe, 0x0000, 0x0000,
+	    0x24f3, 0x0000, 0x0000, 0x0000, 0x1188, 0x1951, 0x0000, 0x0000,
+	    0x31f8, 0x0000, 0x03bf, 0x0000, 0x0000, 0x0000, 0x0abd, 0x0000,
+	    0x0149, 0x4bb7, 0x0000, 0x08b8, 0x0000, 0x29ca, 0x16e9, 0x41ef,
+	    0x0000, 0x0000, 0x0000, 0x4a7c, 0x12d0, 0x233b, 0x1d64, 0x17df,
+	    0x0000, 0x4a40, 0x0000, 0x26a6, 0x0000, 0x0000, 0x44e6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3d52, 0x0000, 0x3bf3, 0x3516,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x40ce, 0x1121, 0x136f, 0x0000,
+	    0x1c05, 0x0000, 0x0000, 0x342a, 0x2d29, 0x2306, 0x0b8e, 0x0000,
+	    0x438a, 0x0000, 0x1256, 0x04c8, 0x0000, 0x0000, 0x0000, 0x2b0b,
+	    0x364c, 0x0000, 0x0bcb, 0x0533, 0x0000, 0x2efe, 0x200e, 0x0000,
+	    0x0000, 0x2fc7, 0x49fe, 0x1b11, 0x3a3a, 0x41c8, 0x0000, 0x22f6,
+	    0x0000, 0x0000, 0x1dfc, 0x09d5, 0x0000, 0x3b40, 0x4be2, 0x26ac,
+	    0x0000, 0x11e0, 0x199a, 0x00d3, 0x08cb, 0x2df2, 0x0000, 0x326e,
+	    0x230d, 0x0000, 0x3235, 0x0f1c, 0x369e, 0x134f, 0x0000, 0x0000,
+	    0x3b6e, 0x03ea, 0x3dd1, 0x0000, 0x343d, 0x1ce4, 0x37cb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24da, 0x0000, 0x318e, 0x0000, 0x3958,
+	    0x0000, 0x0f14, 0x3d08, 0x0bd4, 0x0000, 0x1a1f, 0x0000, 0x2823,
+	    0x14ce, 0x44e7, 0x0000, 0x3f2d, 0x0000, 0x4cac, 0x0000, 0x1625,
+	    0x0000, 0x0000, 0x35c1, 0x1e0f, 0x26eb, 0x2481, 0x01bd, 0x0000,
+	    0x0000, 0x13c2, 0x0000, 0x2648, 0x1dc1, 0x0000, 0x0000, 0x49d7,
+	    0x1ae7, 0x2a81, 0x0000, 0x2c3c, 0x3ff3, 0x46e4, 0x0000, 0x0000,
+	    0x0cd8, 0x179e, 0x27f6, 0x08e9, 0x0000, 0x22fc, 0x0ef6, 0x3592,
+	    0x0000, 0x00f0, 0x0c61, 0x3264, 0x0a73, 0x4318, 0x0000, 0x0000,
+	    0x2b7b, 0x0000, 0x45b5, 0x0000, 0x0000, 0x0000, 0x46fa, 0x1fa8,
+	    0x0000, 0x0000, 0x3e0d, 0x0000, 0x0000, 0x0000, 0x0000, 0x4100,
+	    0x2a20, 0x3d01, 0x0000, 0x0000, 0x0000, 0x1e69, 0x0000, 0x086c,
+	    0x0000, 0x0000, 0x1a4b, 0x3a8f, 0x4d3b, 0x3075, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1845, 0x0000, 0x0000, 0x3711, 0x0000,
+	    0x0000, 0x4412, 0x0a21, 0x26c8, 0x014d, 0x0000, 0x0578, 0x462d,
+	    0x0000, 0x0000, 0x14c8, 0x3441, 0x0000, 0x33e3, 0x17fc, 0x2311,
+	    0x0000, 0x0000, 0x0000, 0x05d7, 0x327f, 0x2a1b, 0x23bb, 0x0000,
+	    0x0d86, 0x0000, 0x3aa5, 0x4cf6, 0x1319, 0x230a, 0x0000, 0x02ae,
+	    0x00f6, 0x247c, 0x0000, 0x4bc9, 0x3b28, 0x0000, 0x0546, 0x0000,
+	    0x0470, 0x2816, 0x20fa, 0x0000, 0x0982, 0x3719, 0x192d, 0x1637,
+	    0x0000, 0x0000, 0x00d1, 0x0000, 0x11be, 0x0000, 0x0000, 0x0980,
+	    0x179f, 0x417e, 0x1f0a, 0x06af, 0x0000, 0x38c0, 0x0000, 0x0ebb,
+	    0x1042, 0x2a73, 0x1b5d, 0x0814, 0x0000, 0x0000, 0x4444, 0x3372,
+	    0x1f9f, 0x22b8, 0x3768, 0x1b4f, 0x230f, 0x2b59, 0x3840, 0x0ddb,
+	    0x228b, 0x4d2c, 0x3223, 0x0000, 0x0000, 0x0000, 0x4d5d, 0x44dc,
+	    0x1642, 0x3b3c, 0x0337, 0x0000, 0x0a20, 0x4098, 0x0000, 0x4818,
+	    0x072c, 0x0000, 0x0000, 0x12c8, 0x0000, 0x2a88, 0x4b5c, 0x0000,
+	    0x0931, 0x36cc, 0x3be7, 0x1c65, 0x0000, 0x0000, 0x19bd, 0x4102,
+	    0x0000, 0x4d60, 0x3914, 0x0e8c, 0x1b99, 0x2ec1, 0x150e, 0x0000,
+	    0x0000, 0x224b, 0x3200, 0x0c01, 0x49ee, 0x2191, 0x0000, 0x2baa,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3835, 0x0000, 0x0000, 0x0000,
+	    0x1a51, 0x0000, 0x36ce, 0x2b52, 0x0000, 0x1be9, 0x34b8, 0x4618,
+	    0x0000, 0x0000, 0x24bd, 0x0a46, 0x3351, 0x2e5c, 0x17f6, 0x0000,
+	    0x1052, 0x3363, 0x0000, 0x24b7, 0x0000, 0x0c20, 0x0000, 0x16cb,
+	    0x45ea, 0x0000, 0x09c2, 0x2d4b, 0x353a, 0x16bd, 0x4af9, 0x0000,
+	    0x1253, 0x0000, 0x14a8, 0x3733, 0x033e, 0x0000, 0x0000, 0x04be,
+	    0x00cf, 0x19ca, 0x12ea, 0x09d1, 0x438e, 0x20ea, 0x0000, 0x0000,
+	    0x28b2, 0x04aa, 0x0000, 0x0391, 0x2387, 0x2f46, 0x1874, 0x26f3,
+	    0x3471, 0x4787, 0x0000, 0x0000, 0x0000, 0x4601, 0x39ee, 0x0434,
+	    0x0000, 0x0000, 0x442c, 0x0062, 0x26d3, 0x0000, 0x0000, 0x0561,
+	    0x450e, 0x23f7, 0x10e0, 0x1584, 0x0000, 0x2847, 0x0000, 0x0dfd,
+	    0x0000, 0x0000, 0x464b, 0x46b7, 0x0000, 0x0000, 0x0000, 0x00ac,
+	    0x0000, 0x410c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x227a, 0x2383, 0x413c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2dfb, 0x0000, 0x11ce, 0x0000, 0x0000, 0x204f,
+	    0x187e, 0x2852, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a11, 0x0000,
+	    0x0000, 0x2c64, 0x423d, 0x0c89, 0x2b09, 0x2651, 0x2989, 0x2179,
+	    0x02fc, 0x30b6, 0x272b, 0x0000, 0x0000, 0x2e9d, 0x485a, 0x16f2,
+	    0x1693, 0x420f, 0x32ef, 0x159d, 0x1bb2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4845, 0x1b25, 0x187d, 0x0000, 0x0000,
+	    0x1854, 0x0cad, 0x26fa, 0x0000, 0x1537, 0x0dde, 0x2ec4, 0x0d5b,
+	    0x3545, 0x0000, 0x0341, 0x3cfd, 0x0000, 0x20f4, 0x3f36, 0x3e8f,
+	    0x0000, 0x0000, 0x1930, 0x0000, 0x4418, 0x00d7, 0x2348, 0x0000,
+	    0x2a10, 0x0000, 0x0000, 0x2c14, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0c67, 0x0000, 0x4d0c, 0x0000, 0x2d5d, 0x078a, 0x0000,
+	    0x064c, 0x0000, 0x1a90, 0x2f3a, 0x0000, 0x2973, 0x0000, 0x2460,
+	    0x3b6e, 0x0000, 0x1425, 0x0b22, 0x1f3f, 0x31c8, 0x0000, 0x3c57,
+	    0x0000, 0x0000, 0x0000, 0x2c27, 0x3d1e, 0x0000, 0x0000, 0x0000,
+	    0x26de, 0x217b, 0x0000, 0x1e88, 0x0000, 0x4ab5, 0x4680, 0x0000,
+	    0x07e0, 0x1303, 0x0000, 0x0000, 0x3c9f, 0x480a, 0x37f4, 0x1c88,
+	    0x3be2, 0x03fb, 0x30c7, 0x0000, 0x005c, 0x0dc0, 0x17b2, 0x29bc,
+	    0x2bca, 0x0000, 0x0000, 0x0000, 0x0000, 0x22dd, 0x01c6, 0x447a,
+	    0x0000, 0x0989, 0x0000, 0x0000, 0x0000, 0x0000, 0x4bae, 0x26dd,
+	    0x0075, 0x311c, 0x10e3, 0x4c19, 0x1101, 0x0000, 0x347f, 0x0000,
+	    0x4a46, 0x4174, 0x0000, 0x09da, 0x0000, 0x0000, 0x2e80, 0x1d71,
+	    0x133d, 0x1637, 0x37f4, 0x0000, 0x30bc, 0x1aeb, 0x32a8, 0x3717,
+	    0x4082, 0x0000, 0x0669, 0x0000, 0x281f, 0x1532, 0x4ab8, 0x0000,
+	    0x0000, 0x0000, 0x3884, 0x37a4, 0x27fd, 0x284e, 0x0000, 0x0f3c,
+	    0x3207, 0x3d78, 0x1f01, 0x38e5, 0x0000, 0x295f, 0x0000, 0x0746,
+	    0x1f69, 0x0000, 0x1d7c, 0x0000, 0x0000, 0x041c, 0x11d5, 0x0000,
+	    0x372d, 0x4c7a, 0x1d22, 0x461f, 0x2e14, 0x2406, 0x1a72, 0x0000,
+	    0x046f, 0x0000, 0x0000, 0x34e5, 0x0000, 0x0000, 0x4ca9, 0x1048,
+	    0x1318, 0x323f, 0x0000, 0x1714, 0x045f, 0x0000, 0x3e7f, 0x31a2,
+	    0x2e85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x109d, 0x0000,
+	    0x40eb, 0x2e02, 0x0000, 0x260e, 0x0000, 0x30b1, 0x0000, 0x44b7,
+	    0x4bea, 0x028e, 0x3166, 0x0000, 0x0f7e, 0x3b22, 0x26d2, 0x0000,
+	    0x0000, 0x0000, 0x2e9d, 0x0000, 0x3956, 0x0000, 0x20a8, 0x2a40,
+	    0x1896, 0x2ef5, 0x2315, 0x2506, 0x2a51, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2169, 0x0000, 0x0000, 0x4132, 0x144c, 0x0000, 0x1d28,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08b5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x099c, 0x061f, 0x0000, 0x3e5c, 0x192b,
+	    0x48cc, 0x396a, 0x0000, 0x0000, 0x2316, 0x0000, 0x2636, 0x2c12,
+	    0x0000, 0x2102, 0x12e4, 0x0000, 0x1f44, 0x2e4e, 0x2ef7, 0x1413,
+	    0x4cda, 0x08b8, 0x0000, 0x0121, 0x0000, 0x0000, 0x0264, 0x0000,
+	    0x32be, 0x0000, 0x489d, 0x11d6, 0x0221, 0x0000, 0x0000, 0x0000,
+	    0x48fc, 0x3c89, 0x4a64, 0x462e, 0x33a2, 0x0000, 0x3b2b, 0x10aa,
+	    0x0c77, 0x0000, 0x2206, 0x297d, 0x0000, 0x27bd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x099b, 0x105c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0670, 0x0000, 0x277d, 0x26dd, 0x0000, 0x2a5c, 0x0000, 0x0000,
+	    0x2ab9, 0x3897, 0x0000, 0x0000, 0x43f9, 0x09cd, 0x0053, 0x0000,
+	    0x1b72, 0x3694, 0x0000, 0x2c99, 0x0000, 0x245e, 0x0000, 0x40f1,
+	    0x4c8b, 0x4c65, 0x0000, 0x4102, 0x1e2b, 0x3173, 0x0000, 0x0000,
+	    0x0000, 0x1f1c, 0x4d7a, 0x0000, 0x0000, 0x0703, 0x0000, 0x0000,
+	    0x1684, 0x0000, 0x2eaa, 0x0000, 0x0356, 0x4cf8, 0x4169, 0x3bf3,
+	    0x29b7, 0x0000, 0x412f, 0x0b40, 0x4416, 0x3050, 0x11d8, 0x1d66,
+	    0x4248, 0x0000, 0x06ee, 0x0000, 0x39f5, 0x0000, 0x0000, 0x184a,
+	    0x0000, 0x0b67, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cef, 0x0000,
+	    0x0000, 0x11b8, 0x0a8a, 0x2e10, 0x0000, 0x4b93, 0x0000, 0x0f1d,
+	    0x25b1, 0x0000, 0x2051, 0x0000, 0x0000, 0x3de8, 0x0000, 0x2f99,
+	    0x36f5, 0x0000, 0x0000, 0x346d, 0x0000, 0x4e11, 0x0000, 0x0000,
+	    0x3b01, 0x0000, 0x0cf1, 0x0000, 0x4b3e, 0x33b4, 0x0000, 0x0000,
+	    0x0000, 0x3c1c, 0x0000, 0x0000, 0x2934, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2ccf, 0x493a, 0x32ef, 0x2ceb, 0x4308, 0x335e, 0x0000,
+	    0x0000, 0x0f33, 0x0000, 0x1729, 0x0000, 0x0000, 0x0d4c, 0x35d7,
+	    0x2388, 0x1a27, 0x13dc, 0x4a9f, 0x0413, 0x0000, 0x40ac, 0x0000,
+	    0x29a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x06b6, 0x0000, 0x1213,
+	    0x0000, 0x0000, 0x4b09, 0x0000, 0x0000, 0x0000, 0x2d17, 0x0000,
+	    0x27f1, 0x3a82, 0x39d8, 0x0000, 0x37d6, 0x4060, 0x0000, 0x01fd,
+	    0x0000, 0x0000, 0x3ffa, 0x0000, 0x0000, 0x0000, 0x137c, 0x0000,
+	    0x06ae, 0x0000, 0x2c72, 0x439a, 0x0000, 0x2c8d, 0x0000, 0x3951,
+	    0x2ab8, 0x1544, 0x0000, 0x42b0, 0x393d, 0x0da7, 0x1039, 0x0000,
+	    0x0590, 0x0000, 0x3c0d, 0x0000, 0x0a5c, 0x46c0, 0x1c81, 0x0000,
+	    0x0938, 0x0000, 0x0000, 0x29ca, 0x2bb8, 0x0000, 0x0000, 0x1ce2,
+	    0x02ea, 0x0000, 0x0000, 0x0000, 0x0b41, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x29dd, 0x0000, 0x1f7f, 0x003d, 0x4a8f, 0x0d4e, 0x3780,
+	    0x3c5c, 0x165e, 0x0614, 0x0000, 0x0000, 0x2fd1, 0x0000, 0x0000,
+	    0x4095, 0x3412, 0x0000, 0x302d, 0x207b, 0x0000, 0x0000, 0x2eaa,
+	    0x0000, 0x0000, 0x0000, 0x3568, 0x384a, 0x4d40, 0x1382, 0x1c62,
+	    0x0251, 0x30c8, 0x0000, 0x4b18, 0x0000, 0x00d7, 0x0000, 0x0000,
+	    0x0952, 0x0bfc, 0x0000, 0x2b9f, 0x0000, 0x1527, 0x0000, 0x33b2,
+	    0x0000, 0x28c2, 0x424e, 0x0000, 0x4159, 0x0000, 0x1bdb, 0x0000,
+	    0x09a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x132d,
+	    0x0000, 0x0000, 0x0798, 0x0ae8, 0x0000, 0x3efe, 0x0000, 0x21fc,
+	    0x0000, 0x4ae7, 0x032a, 0x0000, 0x42e3, 0x42dd, 0x0000, 0x412d,
+	    0x1706, 0x0000, 0x4739, 0x3b02, 0x0000, 0x0000, 0x22d8, 0x2677,
+	    0x3e99, 0x18b8, 0x0000, 0x28be, 0x0000, 0x0000, 0x04b6, 0x0284,
+	    0x2af4, 0x0350, 0x0000, 0x0000, 0x2ac5, 0x0000, 0x0000, 0x0000,
+	    0x0e98, 0x23bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x38a5, 0x155d,
+	    0x0000, 0x2345, 0x111c, 0x0000, 0x4078, 0x01a9, 0x1231, 0x0000,
+	    0x1db9, 0x47ad, 0x359d, 0x0000, 0x0000, 0x4445, 0x0000, 0x13da,
+	    0x49ff, 0x1e0b, 0x2c2e, 0x44a4, 0x0000, 0x238d, 0x059a, 0x15ff,
+	    0x20d5, 0x0000, 0x1095, 0x331b, 0x19fb, 0x4148, 0x0c9f, 0x0000,
+	    0x3caf, 0x131f, 0x4bec, 0x0000, 0x00cb, 0x0000, 0x181a, 0x146c,
+	    0x0000, 0x0000, 0x0000, 0x1b50, 0x3e48, 0x40e3, 0x2be9, 0x0f74,
+	    0x0010, 0x0000, 0x3ceb, 0x0000, 0x4df2, 0x0000, 0x12d9, 0x13e7,
+	    0x0000, 0x4a96, 0x0000, 0x0d6c, 0x14ae, 0x195d, 0x2c31, 0x0000,
+	    0x0000, 0x49ca, 0x3281, 0x0000, 0x1b7d, 0x0000, 0x0000, 0x0000,
+	    0x0e96, 0x246d, 0x0000, 0x4b12, 0x0000, 0x1943, 0x0000, 0x2597,
+	    0x3ab1, 0x0000, 0x3674, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ee7,
+	    0x0f97, 0x18b0, 0x269e, 0x0e18, 0x0000, 0x0000, 0x0000, 0x04cd,
+	    0x1bd4, 0x25a5, 0x1eb8, 0x0eb1, 0x131c, 0x19d0, 0x0000, 0x1df3,
+	    0x353c, 0x1d2f, 0x0000, 0x0000, 0x0000, 0x0000, 0x21cb, 0x1cd1,
+	    0x47eb, 0x4945, 0x4d02, 0x0000, 0x103e, 0x328f, 0x0fcd, 0x0000,
+	    0x3ebe, 0x1911, 0x2873, 0x0000, 0x2b91, 0x0000, 0x11fe, 0x0000,
+	    0x17f3, 0x0000, 0x19aa, 0x2642, 0x3bca, 0x44f2, 0x1564, 0x0000,
+	    0x2f75, 0x3e37, 0x4694, 0x0000, 0x0000, 0x44d3, 0x0000, 0x04ba,
+	    0x2264, 0x387e, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a44, 0x0000,
+	    0x4172, 0x3c57, 0x11b9, 0x0000, 0x4a19, 0x0dbb, 0x0000, 0x0000,
+	    0x3b3e, 0x4187, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ac7,
+	    0x0000, 0x36ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b50, 0x26f9,
+	    0x0000, 0x0000, 0x251c, 0x0000, 0x0000, 0x1b9d, 0x4a54, 0x35e7,
+	    0x0000, 0x0cd7, 0x0000, 0x0f69, 0x0000, 0x2bd5, 0x4b72, 0x0000,
+	    0x0d5c, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f4d, 0x3ba9, 0x022c,
+	    0x25e9, 0x26fa, 0x1378, 0x1968, 0x4b9f, 0x0000, 0x2045, 0x0000,
+	    0x0000, 0x0000, 0x174a, 0x0000, 0x0000, 0x0000, 0x0a66, 0x0000,
+	    0x0000, 0x4ce8, 0x0000, 0x0000, 0x0000, 0x10c3, 0x4384, 0x35a5,
+	    0x0000, 0x0d82, 0x0000, 0x2355, 0x1e39, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0cc4, 0x369d, 0x0ae6, 0x3e15, 0x0000, 0x2cff, 0x1bb9,
+	    0x0000, 0x0000, 0x36d6, 0x1769, 0x3321, 0x3c49, 0x1ee1, 0x0000,
+	    0x0000, 0x0000, 0x18e2, 0x0d96, 0x2175, 0x4290, 0x4ce9, 0x1cf9,
+	    0x0000, 0x26b3, 0x00ad, 0x4ac1, 0x0c0f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x415e, 0x3e4c, 0x0000, 0x06fc, 0x0000, 0x0000, 0x289d,
+	    0x0000, 0x0000, 0x1823, 0x07da, 0x0f61, 0x0000, 0x4db9, 0x354f,
+	    0x1425, 0x2174, 0x1dfc, 0x0000, 0x0000, 0x07bc, 0x0000, 0x2b23,
+	    0x2dd6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2811, 0x0000,
+	    0x4dd6, 0x154c, 0x2629, 0x0000, 0x0000, 0x2e54, 0x0000, 0x469f,
+	    0x0000, 0x04c7, 0x17fd, 0x3015, 0x4dc8, 0x0812, 0x0e25, 0x33de,
+	    0x15e8, 0x3da2, 0x08a9, 0x1b38, 0x0000, 0x0000, 0x096e, 0x0120,
+	    0x062b, 0x0f71, 0x0000, 0x1516, 0x496c, 0x18c2, 0x30a0, 0x31d4,
+	    0x0000, 0x40bc, 0x0000, 0x0000, 0x4840, 0x1ffa, 0x0000, 0x3afd,
+	    0x47e7, 0x358a, 0x0000, 0x0000, 0x0000, 0x45a0, 0x2e81, 0x0000,
+	    0x0000, 0x0000, 0x30d8, 0x0000, 0x1fd1, 0x05e6, 0x4a1f, 0x0000,
+	    0x0000, 0x3ab8, 0x0000, 0x4749, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x042e, 0x0870, 0x1111, 0x0000, 0x0000, 0x2ec9, 0x1e51,
+	    0x1ab5, 0x0000, 0x0000, 0x0393, 0x38ca, 0x43e4, 0x3e93, 0x0000,
+	    0x0000, 0x380d, 0x2839, 0x11d9, 0x4852, 0x0000, 0x4b60, 0x2b63,
+	    0x4740, 0x0000, 0x0000, 0x2334, 0x0000, 0x0000, 0x1239, 0x0000,
+	    0x0627, 0x2c9a, 0x0000, 0x0000, 0x0000, 0x32f4, 0x0000, 0x0000,
+	    0x1b95, 0x0000, 0x0d93, 0x295e, 0x2b7f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x392e, 0x1154, 0x1938, 0x0000, 0x3375, 0x0000, 0x1d50,
+	    0x2dc4, 0x1668, 0x0000, 0x0000, 0x0000, 0x1bf1, 0x4953, 0x4ba4,
+	    0x17fa, 0x0000, 0x44e3, 0x41a7, 0x0583, 0x397f, 0x0000, 0x42f5,
+	    0x0000, 0x0000, 0x0000, 0x0cb7, 0x3930, 0x0000, 0x0000, 0x1464,
+	    0x3168, 0x163e, 0x49a7, 0x0000, 0x28cc, 0x0816, 0x0000, 0x2fc0,
+	    0x0000, 0x4250, 0x082c, 0x0000, 0x1d95, 0x0000, 0x3683, 0x0000,
+	    0x0dea, 0x4721, 0x0000, 0x1fce, 0x04d6, 0x0000, 0x0000, 0x4b29,
+	    0x0000, 0x036a, 0x3755, 0x0000, 0x02ad, 0x48b6, 0x43a4, 0x0a45,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x35b0, 0x4c68, 0x0724,
+	    0x07b5, 0x330c, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d7d, 0x0000,
+	    0x325b, 0x1691, 0x0000, 0x37e5, 0x136f, 0x0000, 0x1c40, 0x0000,
+	    0x2001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1395, 0x0000,
+	    0x0000, 0x2eb8, 0x4ca7, 0x0000, 0x1500, 0x2983, 0x01fb, 0x00af,
+	    0x0058, 0x029e, 0x481c, 0x0000, 0x0000, 0x49d9, 0x29a2, 0x2ded,
+	    0x0000, 0x0a61, 0x0000, 0x3ec8, 0x2113, 0x0000, 0x0000, 0x0e70,
+	    0x2c5f, 0x2560, 0x0000, 0x3644, 0x0000, 0x28b5, 0x0000, 0x121a,
+	    0x1e0e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c94, 0x25b9,
+	    0x07e4, 0x4b36, 0x22f1, 0x3e24, 0x1761, 0x01fa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x279b, 0x4994, 0x0111, 0x0000, 0x0000, 0x0000,
+	    0x02df, 0x0000, 0x0e5d, 0x0000, 0x0251, 0x4c8b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4ced, 0x07c6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2873, 0x0000, 0x0f06,
+	    0x072a, 0x4d90, 0x0000, 0x35b8, 0x0a34, 0x0000, 0x251b, 0x0000,
+	    0x42e0, 0x388a, 0x0ff8, 0x0000, 0x1603, 0x15ae, 0x408d, 0x0914,
+	    0x0000, 0x0000, 0x398b, 0x366b, 0x4cd3, 0x0000, 0x00a0, 0x0000,
+	    0x0000, 0x34bf, 0x0000, 0x0ffa, 0x06af, 0x1e3d, 0x1b11, 0x19d2,
+	    0x0000, 0x46f9, 0x0000, 0x11ce, 0x0000, 0x3ce8, 0x275d, 0x4216,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x396f, 0x4cb2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bd8, 0x4857, 0x0000,
+	    0x0000, 0x0000, 0x12e2, 0x1278, 0x3864, 0x0000, 0x0000, 0x0000,
+	    0x2f45, 0x10c9, 0x2088, 0x0ca0, 0x47bb, 0x19f9, 0x0000, 0x37ea,
+	    0x0000, 0x41b2, 0x0a2b, 0x0655, 0x0000, 0x0000, 0x1ef6, 0x0817,
+	    0x08f6, 0x0000, 0x0000, 0x336d, 0x4374, 0x0000, 0x0000, 0x0000,
+	    0x1cbd, 0x1bda, 0x4dd4, 0x0000, 0x421a, 0x0000, 0x3942, 0x1caa,
+	    0x0681, 0x32e7, 0x0000, 0x144b, 0x403a, 0x0000, 0x042e, 0x0037,
+	    0x1c32, 0x2764, 0x0000, 0x0000, 0x17ca, 0x334e, 0x4ba7, 0x0f37,
+	    0x0082, 0x0000, 0x3e0c, 0x38d6, 0x0000, 0x0000, 0x1c03, 0x4a95,
+	    0x194e, 0x41b5, 0x0000, 0x0000, 0x47dd, 0x0000, 0x30a2, 0x4315,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x43e4, 0x0000, 0x0d28,
+	    0x3ca9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3eeb, 0x3da1,
+	    0x0000, 0x0000, 0x4908, 0x2be2, 0x0000, 0x00cd, 0x169d, 0x352a,
+	    0x1450, 0x1fd4, 0x4b7e, 0x41fc, 0x4d89, 0x0000, 0x0000, 0x0000,
+	    0x2304, 0x1989, 0x0000, 0x496d, 0x4717, 0x4859, 0x26b9, 0x0000,
+	    0x277a, 0x0000, 0x3528, 0x2a4c, 0x0000, 0x3f40, 0x0000, 0x01de,
+	    0x14f5, 0x0000, 0x0000, 0x0000, 0x0e29, 0x0000, 0x3660, 0x00a9,
+	    0x0000, 0x36db, 0x0000, 0x2920, 0x1e1e, 0x0000, 0x1a9f, 0x0000,
+	    0x1d87, 0x0000, 0x0000, 0x0000, 0x1fd5, 0x3f17, 0x4141, 0x2f02,
+	    0x0000, 0x0000, 0x0000, 0x3956, 0x0000, 0x2989, 0x3a60, 0x06aa,
+	    0x0000, 0x0000, 0x1c0b, 0x0000, 0x488f, 0x0000, 0x0000, 0x15cb,
+	    0x0b68, 0x0000, 0x0000, 0x4185, 0x3bb3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4c42, 0x2328, 0x443f, 0x0000, 0x0b59, 0x0000, 0x0000,
+	    0x0000, 0x3f38, 0x1a4b, 0x0000, 0x0000, 0x0000, 0x2540, 0x40b5,
+	    0x01ee, 0x0000, 0x0b41, 0x4998, 0x0000, 0x0000, 0x2f9a, 0x418f,
+	    0x0000, 0x479c, 0x0000, 0x10be, 0x0000, 0x0000, 0x0000, 0x32ea,
+	    0x0000, 0x3d07, 0x127f, 0x0000, 0x0000, 0x2f95, 0x0000, 0x0000,
+	    0x0000, 0x1677, 0x30bc, 0x0000, 0x117a, 0x2543, 0x3aaa, 0x034f,
+	    0x0000, 0x0000, 0x378d, 0x0000, 0x0000, 0x4d10, 0x027b, 0x2ec0,
+	    0x2b51, 0x0c7d, 0x0000, 0x1b86, 0x0000, 0x0428, 0x412d, 0x03f4,
+	    0x0000, 0x4593, 0x1615, 0x0000, 0x0000, 0x0f12, 0x179d, 0x1e01,
+	    0x0000, 0x0000, 0x0000, 0x1f09, 0x0000, 0x0000, 0x29b8, 0x0226,
+	    0x0000, 0x0000, 0x0000, 0x495b, 0x095e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x00c3, 0x0b12, 0x21dd, 0x0d33, 0x1792, 0x0000, 0x495c,
+	    0x00ae, 0x0000, 0x0567, 0x0000, 0x0000, 0x3f34, 0x3d14, 0x1776,
+	    0x1ecb, 0x2873, 0x36f3, 0x06fb, 0x0834, 0x390b, 0x0000, 0x0000,
+	    0x3911, 0x0327, 0x340f, 0x0000, 0x0000, 0x4a8c, 0x0292, 0x2af8,
+	    0x2a39, 0x0000, 0x0000, 0x2f3e, 0x2dd2, 0x0b47, 0x30bc, 0x444e,
+	    0x0f6f, 0x36f3, 0x38f0, 0x4d82, 0x0000, 0x3a1a, 0x0000, 0x1f03,
+	    0x0000, 0x4ddb, 0x2978, 0x3e2d, 0x3bd1, 0x3524, 0x0000, 0x34cb,
+	    0x4516, 0x4be7, 0x1c62, 0x292a, 0x43df, 0x0000, 0x0574, 0x3cf2,
+	    0x4db2, 0x3ef6, 0x0000, 0x15cf, 0x2dab, 0x0000, 0x0000, 0x09e4,
+	    0x3bdc, 0x0000, 0x0000, 0x40ba, 0x0000, 0x0000, 0x210e, 0x0000,
+	    0x19fa, 0x0000, 0x0000, 0x2b1d, 0x220f, 0x0cff, 0x25f9, 0x0000,
+	    0x2944, 0x2464, 0x05aa, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x368f, 0x0000, 0x00b2, 0x0000, 0x0000, 0x2f54, 0x0000, 0x0000,
+	    0x0c9e, 0x0000, 0x0000, 0x08b4, 0x0000, 0x0000, 0x0000, 0x0b81,
+	    0x0000, 0x452f, 0x0000, 0x15c4, 0x28c5, 0x2fcb, 0x0000, 0x0000,
+	    0x1d9a, 0x49cf, 0x0000, 0x0000, 0x2e22, 0x49bd, 0x211e, 0x0000,
+	    0x0463, 0x4808, 0x0000, 0x0000, 0x3d44, 0x0000, 0x4cbd, 0x00ed,
+	    0x1d10, 0x29b6, 0x0000, 0x0000, 0x0000, 0x2067, 0x3638, 0x0000,
+	    0x325f, 0x4330, 0x0000, 0x1b73, 0x1ee9, 0x0000, 0x0744, 0x0913,
+	    0x1d93, 0x0000, 0x496a, 0x3df1, 0x0000, 0x21ea, 0x37a6, 0x0000,
+	    0x0000, 0x333f, 0x34d8, 0x28e8, 0x0000, 0x4bf0, 0x1135, 0x33a8,
+	    0x24d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x04c5, 0x16f9, 0x0795,
+	    0x40fa, 0x1e15, 0x0000, 0x0000, 0x0000, 0x4c88, 0x1598, 0x2b30,
+	    0x0000, 0x25ce, 0x4ce5, 0x48c5, 0x16d1, 0x0000, 0x0d17, 0x41aa,
+	    0x4e10, 0x0000, 0x0503, 0x0000, 0x1dd3, 0x4dd6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2a53, 0x4aea, 0x0a8d, 0x3247, 0x0000, 0x0000,
+	    0x21cd, 0x0000, 0x0000, 0x33f5, 0x1f3a, 0x0000, 0x0bff, 0x30e0,
+	    0x29fe, 0x419d, 0x4c33, 0x0e72, 0x2852, 0x223d, 0x0000, 0x1399,
+	    0x3089, 0x2c5c, 0x0000, 0x10a3, 0x0000, 0x2517, 0x02cf, 0x0000,
+	    0x0000, 0x0d8c, 0x27f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x06c1,
+	    0x33ec, 0x2874, 0x1e43, 0x37e5, 0x01d4, 0x0000, 0x1711, 0x1e72,
+	    0x0000, 0x4cf3, 0x0000, 0x0000, 0x354c, 0x3bf6, 0x4c90, 0x0000,
+	    0x1ffb, 0x47df, 0x0000, 0x3d3c, 0x0000, 0x294d, 0x363a, 0x186f,
+	    0x254e, 0x3225, 0x3c29, 0x3821, 0x28ff, 0x1087, 0x1369, 0x17e6,
+	    0x2845, 0x0000, 0x3418, 0x0000, 0x0000, 0x4523, 0x2cba, 0x0000,
+	    0x40c6, 0x0000, 0x0000, 0x0000, 0x31dc, 0x0000, 0x4ae5, 0x204e,
+	    0x385c, 0x0198, 0x05b8, 0x4d9d, 0x3e29, 0x0000, 0x1f94, 0x0000,
+	    0x341e, 0x1deb, 0x0000, 0x0000, 0x3218, 0x0000, 0x3f6a, 0x1930,
+	    0x31d4, 0x4c0d, 0x437a, 0x0721, 0x1ba9, 0x24f7, 0x3df5, 0x3e20,
+	    0x07a6, 0x1e0a, 0x0000, 0x42f7, 0x0000, 0x0e11, 0x4cd8, 0x10d3,
+	    0x0000, 0x1869, 0x3a93, 0x0000, 0x0000, 0x06d5, 0x17a7, 0x26c0,
+	    0x2f55, 0x3753, 0x0000, 0x1e93, 0x13ae, 0x1f80, 0x44e6, 0x350b,
+	    0x0000, 0x0000, 0x0000, 0x31fe, 0x0000, 0x40d4, 0x0000, 0x0000,
+	    0x2153, 0x0000, 0x0450, 0x20de, 0x1af1, 0x0000, 0x0000, 0x1768,
+	    0x40f1, 0x21d5, 0x05eb, 0x19c9, 0x38f9, 0x2fd6, 0x0000, 0x2fcc,
+	    0x26c9, 0x1758, 0x0fff, 0x4c90, 0x2519, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x029b, 0x194f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2ce1, 0x3c29, 0x0000, 0x49bf, 0x0000, 0x2ad4, 0x0000, 0x0000,
+	    0x0000, 0x14fe, 0x0000, 0x0000, 0x05e8, 0x0000, 0x0000, 0x4303,
+	    0x06c6, 0x0000, 0x0000, 0x0000, 0x455e, 0x4de3, 0x23cf, 0x00cf,
+	    0x23c4, 0x0000, 0x0000, 0x0000, 0x1f87, 0x0000, 0x2a89, 0x0000,
+	    0x07dc, 0x1e59, 0x292d, 0x0000, 0x0000, 0x0000, 0x0b55, 0x0000,
+	    0x0000, 0x0000, 0x0118, 0x0000, 0x0000, 0x2802, 0x1662, 0x3574,
+	    0x3157, 0x16f3, 0x3b03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4b2b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4ca1, 0x33a9, 0x09ae, 0x0000, 0x3acc, 0x3f50, 0x0000, 0x2ed2,
+	    0x0242, 0x1adc, 0x0000, 0x12b1, 0x0000, 0x49b2, 0x0000, 0x0000,
+	    0x3926, 0x0000, 0x4b27, 0x0000, 0x3f7d, 0x0000, 0x0000, 0x10a6,
+	    0x4741, 0x0000, 0x4bfa, 0x0000, 0x0000, 0x0000, 0x2009, 0x0000,
+	    0x206b, 0x0000, 0x248c, 0x1f12, 0x16e5, 0x0000, 0x20d3, 0x1d11,
+	    0x232a, 0x016a, 0x0000, 0x4458, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x229e, 0x3f0e, 0x4d33, 0x3aae, 0x2867, 0x4cc0, 0x0000,
+	    0x2f34, 0x3dcd, 0x2901, 0x3285, 0x0000, 0x2694, 0x0000, 0x07f9,
+	    0x0e94, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4cb0,
+	    0x0000, 0x34e4, 0x0000, 0x2c9d, 0x084c, 0x0000, 0x2580, 0x0000,
+	    0x1b5a, 0x0000, 0x1114, 0x2400, 0x14d2, 0x0000, 0x1af2, 0x0000,
+	    0x0000, 0x3e08, 0x0000, 0x164c, 0x26ff, 0x0000, 0x111c, 0x3c0f,
+	    0x1dfc, 0x02c9, 0x03e8, 0x0000, 0x0d04, 0x0000, 0x09dc, 0x0a93,
+	    0x24a8, 0x0000, 0x07a8, 0x0000, 0x2881, 0x1f76, 0x0000, 0x0000,
+	    0x2406, 0x33d8, 0x4960, 0x1820, 0x4428, 0x10db, 0x26a2, 0x21b7,
+	    0x0000, 0x0000, 0x2e9d, 0x0000, 0x0000, 0x0000, 0x3140, 0x0000,
+	    0x1877, 0x146f, 0x0000, 0x0000, 0x460a, 0x084e, 0x0b10, 0x341c,
+	    0x0000, 0x0000, 0x0000, 0x1ab1, 0x099d, 0x1e7e, 0x47a6, 0x1d78,
+	    0x3f9f, 0x286f, 0x0000, 0x1f60, 0x0000, 0x1092, 0x1c9d, 0x2b5f,
+	    0x16e9, 0x0000, 0x16b3, 0x0000, 0x149e, 0x4992, 0x4382, 0x0000,
+	    0x0000, 0x05ec, 0x2f5f, 0x0c29, 0x2dc8, 0x0000, 0x0fb2, 0x31fc,
+	    0x0000, 0x2bb3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2410,
+	    0x43b4, 0x165c, 0x1900, 0x0000, 0x0000, 0x2199, 0x2e1f, 0x00af,
+	    0x0000, 0x0000, 0x086f, 0x194b, 0x393b, 0x0000, 0x0000, 0x0000,
+	    0x4983, 0x06bd, 0x1c51, 0x109d, 0x2108, 0x0000, 0x067d, 0x1540,
+	    0x0000, 0x1479, 0x3200, 0x0000, 0x0256, 0x1efc, 0x0000, 0x0000,
+	    0x389e, 0x2364, 0x0000, 0x0000, 0x39cf, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3d5d, 0x329a, 0x4235, 0x0000, 0x0000, 0x3d02,
+	    0x375b, 0x2940, 0x33d9, 0x0000, 0x0000, 0x0000, 0x3d96, 0x29a0,
+	    0x37ef, 0x303d, 0x33dc, 0x05e6, 0x14bc, 0x0000, 0x0000, 0x3107,
+	    0x386e, 0x0c6e, 0x0133, 0x42fc, 0x4276, 0x0000, 0x0000, 0x1913,
+	    0x2a76, 0x0000, 0x0c52, 0x2e12, 0x4aba, 0x4cbf, 0x0000, 0x2faa,
+	    0x13cf, 0x0f0f, 0x4a73, 0x0000, 0x0000, 0x11b1, 0x1221, 0x2475,
+	    0x0000, 0x0000, 0x3ae7, 0x0724, 0x2c24, 0x0000, 0x4bf0, 0x25a3,
+	    0x0000, 0x33e2, 0x0dd2, 0x0000, 0x1ed2, 0x07aa, 0x0fff, 0x414f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0bf7, 0x3e63, 0x0000, 0x1ae6,
+	    0x4b9d, 0x1542, 0x2438, 0x2abe, 0x0000, 0x113b, 0x1b97, 0x1b45,
+	    0x18d1, 0x0000, 0x28d3, 0x4ad4, 0x0e8b, 0x0b88, 0x0000, 0x0000,
+	    0x0000, 0x2d1d, 0x341e, 0x0000, 0x049e, 0x073b, 0x0000, 0x0000,
+	    0x0000, 0x2733, 0x4c22, 0x0000, 0x0000, 0x0379, 0x0000, 0x0000,
+	    0x2f67, 0x0000, 0x33e4, 0x0000, 0x0000, 0x40de, 0x0000, 0x0ec1,
+	    0x3472, 0x0000, 0x25e7, 0x0000, 0x0000, 0x0000, 0x0e9d, 0x1447,
+	    0x4c64, 0x0a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2853,
+	    0x4807, 0x0000, 0x0000, 0x0f92, 0x1271, 0x21ab, 0x0709, 0x0000,
+	    0x0a1b, 0x0000, 0x0000, 0x4adb, 0x0000, 0x07e5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4cbd, 0x0000, 0x2892, 0x2ed0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x176c, 0x4426, 0x0000, 0x4845, 0x102a, 0x4200,
+	    0x1c13, 0x4235, 0x0c8e, 0x0324, 0x27c2, 0x0000, 0x1793, 0x0000,
+	    0x04da, 0x0000, 0x0000, 0x26d4, 0x0000, 0x15ee, 0x0377, 0x370e,
+	    0x1424, 0x0000, 0x3b10, 0x3283, 0x376d, 0x0000, 0x0000, 0x0000,
+	    0x235b, 0x4185, 0x3af3, 0x0000, 0x1ee8, 0x0000, 0x0000, 0x082a,
+	    0x0000, 0x33e6, 0x4cee, 0x0000, 0x0000, 0x1bb0, 0x23ef, 0x280f,
+	    0x1f54, 0x0000, 0x1edb, 0x0000, 0x0000, 0x0701, 0x1ed3, 0x4924,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x449a, 0x0000,
+	    0x425c, 0x38c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x2292, 0x29d1,
+	    0x4d7e, 0x052b, 0x0000, 0x0000, 0x4589, 0x0b4a, 0x0000, 0x1c68,
+	    0x4c9d, 0x1169, 0x0095, 0x4762, 0x1d30, 0x33d7, 0x3312, 0x0000,
+	    0x0000, 0x3278, 0x0000, 0x1ac1, 0x210f, 0x0000, 0x3a91, 0x41a8,
+	    0x4cee, 0x0000, 0x2e17, 0x0000, 0x0000, 0x0000, 0x4567, 0x3cc5,
+	    0x0000, 0x1998, 0x0000, 0x03e4, 0x0000, 0x0000, 0x33f4, 0x3a4f,
+	    0x0f53, 0x0000, 0x453e, 0x1b08, 0x11bc, 0x218d, 0x48f2, 0x0000,
+	    0x1816, 0x182d, 0x4793, 0x0000, 0x1e4f, 0x23f5, 0x47ae, 0x1381,
+	    0x0000, 0x2e8c, 0x0000, 0x0000, 0x0000, 0x46b5, 0x1b4a, 0x2745,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2ca6, 0x2aaf, 0x1e64, 0x190e,
+	    0x25ea, 0x4bc9, 0x0000, 0x03b2, 0x3f20, 0x3477, 0x1cbf, 0x2f37,
+	    0x0a7c, 0x0000, 0x4336, 0x0000, 0x0000, 0x0000, 0x4aa3, 0x2043,
+	    0x0000, 0x4a42, 0x0000, 0x2bca, 0x2456, 0x12aa, 0x0c80, 0x0000,
+	    0x4378, 0x0000, 0x4203, 0x04c4, 0x177d, 0x0563, 0x0000, 0x207f,
+	    0x0000, 0x310c, 0x2a30, 0x08c0, 0x0000, 0x1f66, 0x44c7, 0x3a4c,
+	    0x34a5, 0x3b2b, 0x0000, 0x0000, 0x182c, 0x2ac3, 0x0000, 0x2866,
+	    0x1dcc, 0x0000, 0x155d, 0x414d, 0x2f83, 0x41b8, 0x0000, 0x0000,
+	    0x3cad, 0x0000, 0x28c2, 0x0000, 0x0000, 0x4de5, 0x1b07, 0x0000,
+	    0x0000, 0x0000, 0x12a2, 0x0000, 0x12e1, 0x158e, 0x0000, 0x0000,
+	    0x0000, 0x3ee8, 0x0612, 0x0001, 0x0000, 0x3042, 0x0000, 0x3c9e,
+	    0x1e81, 0x2cf9, 0x0f09, 0x28cb, 0x2519, 0x0000, 0x0000, 0x0000,
+	    0x3d40, 0x4042, 0x368b, 0x1beb, 0x0000, 0x0000, 0x0000, 0x2bd9,
+	    0x02e1, 0x1267, 0x441d, 0x0000, 0x2459, 0x09f9, 0x108a, 0x0000,
+	    0x0a6e, 0x35ea, 0x280d, 0x468f, 0x0000, 0x3ca7, 0x4bac, 0x0b4b,
+	    0x0716, 0x17f7, 0x0000, 0x1443, 0x258f, 0x0000, 0x0000, 0x2c92,
+	    0x1896, 0x3df3, 0x2de5, 0x38f9, 0x2c6e, 0x0000, 0x2cbb, 0x027c,
+	    0x2bda, 0x0000, 0x0855, 0x2afd, 0x4af8, 0x43ec, 0x0000, 0x0000,
+	    0x0000, 0x035a, 0x0000, 0x0000, 0x45d5, 0x1db6, 0x0000, 0x0000,
+	    0x0c1a, 0x0000, 0x0000, 0x37f3, 0x1840, 0x0000, 0x0000, 0x473f,
+	    0x0000, 0x129a, 0x0b22, 0x1656, 0x0386, 0x03bf, 0x3cc2, 0x0000,
+	    0x1994, 0x0c8b, 0x3544, 0x0000, 0x217c, 0x0000, 0x00ce, 0x0000,
+	    0x0f0d, 0x4bdf, 0x236d, 0x0000, 0x4a2f, 0x0c62, 0x0000, 0x30a6,
+	    0x2b8f, 0x0000, 0x0379, 0x21b4, 0x483f, 0x4360, 0x2bf2, 0x1a2c,
+	    0x2878, 0x0000, 0x1c5d, 0x2b10, 0x0793, 0x39c1, 0x23dd, 0x4767,
+	    0x0000, 0x15c3, 0x0000, 0x39e6, 0x0000, 0x0000, 0x0000, 0x3d6b,
+	    0x0bf1, 0x02e7, 0x0000, 0x0145, 0x0000, 0x35fa, 0x26d7, 0x42b4,
+	    0x175c, 0x38bf, 0x1971, 0x2e65, 0x0e76, 0x160d, 0x2a44, 0x0000,
+	    0x3c08, 0x3564, 0x0000, 0x4a7b, 0x0000, 0x427e, 0x0000, 0x30a4,
+	    0x0000, 0x0000, 0x0690, 0x0000, 0x33b1, 0x0000, 0x2fc6, 0x0000,
+	    0x0000, 0x0790, 0x1809, 0x0000, 0x2cd0, 0x0000, 0x3e45, 0x3536,
+	    0x0000, 0x16df, 0x0000, 0x09b4, 0x0603, 0x4479, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4df9, 0x03e6, 0x3697, 0x0000, 0x4616, 0x0000,
+	    0x4bd7, 0x395b, 0x0000, 0x0000, 0x108e, 0x24b1, 0x1245, 0x0000,
+	    0x0000, 0x0000, 0x09fd, 0x19a9, 0x3d65, 0x0000, 0x1387, 0x1bca,
+	    0x0000, 0x0000, 0x0da0, 0x0988, 0x0000, 0x0000, 0x3c81, 0x0000,
+	    0x0000, 0x0e0c, 0x3d3d, 0x1f49, 0x2f0e, 0x0000, 0x0000, 0x0000,
+	    0x3596, 0x3220, 0x1e43, 0x0000, 0x0000, 0x4acc, 0x1433, 0x3c46,
+	    0x0000, 0x2857, 0x0000, 0x490f, 0x0000, 0x0afc, 0x3100, 0x0000,
+	    0x1fa6, 0x4847, 0x1f38, 0x0000, 0x095c, 0x35f4, 0x2bf3, 0x0000,
+	    0x1e42, 0x0000, 0x0000, 0x0000, 0x3f55, 0x0a35, 0x0000, 0x1455,
+	    0x2ea3, 0x0000, 0x3b3f, 0x019a, 0x1b5b, 0x0000, 0x0000, 0x286d,
+	    0x21c5, 0x0000, 0x0000, 0x4364, 0x1a7b, 0x285a, 0x1680, 0x0b1e,
+	    0x0f30, 0x3744, 0x0000, 0x29e1, 0x0000, 0x0000, 0x198c, 0x0fb7,
+	    0x0a6a, 0x0000, 0x2392, 0x0000, 0x33b7, 0x0000, 0x21f1, 0x49ba,
+	    0x398b, 0x0000, 0x1aa4, 0x0000, 0x45be, 0x39f0, 0x0000, 0x1c79,
+	    0x0b55, 0x0701, 0x4a24, 0x4b7c, 0x3ce3, 0x0f8b, 0x3364, 0x0000,
+	    0x4b0e, 0x461f, 0x0669, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d77,
+	    0x0000, 0x0000, 0x3d15, 0x2475, 0x0b93, 0x36da, 0x48d2, 0x14b8,
+	    0x0000, 0x29e4, 0x1132, 0x4b13, 0x0ebc, 0x47c5, 0x057a, 0x2dd4,
+	    0x4412, 0x0000, 0x254d, 0x0000, 0x3851, 0x0000, 0x0000, 0x3fd4,
+	    0x13ee, 0x0000, 0x3af1, 0x18d3, 0x0055, 0x0000, 0x4993, 0x0000,
+	    0x0000, 0x029e, 0x0000, 0x33d3, 0x3c25, 0x0000, 0x046a, 0x0000,
+	    0x4908, 0x0000, 0x0000, 0x0000, 0x2091, 0x104b, 0x0000, 0x49f9,
+	    0x0000, 0x0000, 0x0000, 0x178e, 0x0a43, 0x1036, 0x0000, 0x1222,
+	    0x07c9, 0x228e, 0x2dfe, 0x02e3, 0x33e1, 0x13c6, 0x1aaf, 0x446f,
+	    0x0000, 0x0917, 0x0880, 0x0000, 0x3e96, 0x2a74, 0x0000, 0x02a9,
+	    0x0000, 0x0000, 0x18f6, 0x32f6, 0x095c, 0x417e, 0x0000, 0x0850,
+	    0x0d55, 0x387d, 0x4887, 0x11a7, 0x0ab6, 0x2825, 0x0000, 0x0000,
+	    0x04f5, 0x0c2f, 0x1051, 0x1196, 0x016a, 0x42a5, 0x0000, 0x33f2,
+	    0x2ff4, 0x0000, 0x148b, 0x0bd6, 0x4df0, 0x0000, 0x3474, 0x483b,
+	    0x11f7, 0x4743, 0x0000, 0x12bb, 0x0657, 0x0000, 0x0c3f, 0x42ed,
+	    0x00d8, 0x1ebb, 0x32eb, 0x2cc7, 0x0000, 0x0000, 0x0000, 0x0a41,
+	    0x0000, 0x0000, 0x13d8, 0x0000, 0x0000, 0x3551, 0x0000, 0x1abf,
+	    0x0000, 0x0000, 0x0000, 0x1254, 0x36ad, 0x3a0c, 0x3c4c, 0x19fe,
+	    0x496f, 0x0000, 0x0000, 0x0000, 0x3404, 0x4c0a, 0x1b7c, 0x0fbf,
+	    0x0000, 0x466c, 0x46f9, 0x2d6d, 0x0000, 0x3e04, 0x1c3d, 0x0000,
+	    0x170a, 0x3937, 0x0000, 0x2705, 0x0000, 0x369d, 0x0000, 0x3bed,
+	    0x0881, 0x11c2, 0x24ab, 0x0000, 0x0000, 0x3712, 0x0000, 0x1ea7,
+	    0x327d, 0x1e6e, 0x0000, 0x0000, 0x0f3d, 0x0000, 0x19d8, 0x1f92,
+	    0x03fd, 0x37a2, 0x4712, 0x1764, 0x0000, 0x34cf, 0x1417, 0x30f5,
+	    0x0000, 0x1e5a, 0x4405, 0x0000, 0x38f7, 0x0000, 0x3854, 0x0000,
+	    0x31ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x2906, 0x1c50, 0x0000,
+	    0x0000, 0x24f9, 0x0000, 0x00f1, 0x0000, 0x0481, 0x02bf, 0x3bed,
+	    0x33bc, 0x0000, 0x0000, 0x4b75, 0x4d85, 0x0000, 0x0dfe, 0x0000,
+	    0x0000, 0x0000, 0x35c3, 0x0000, 0x259e, 0x2bbd, 0x0000, 0x0000,
+	    0x0000, 0x116f, 0x4d1a, 0x4a1a, 0x4a47, 0x3423, 0x0000, 0x0000,
+	    0x255c, 0x24a6, 0x4a36, 0x1609, 0x0764, 0x09f9, 0x08b9, 0x0000,
+	    0x0000, 0x0000, 0x1358, 0x0000, 0x0000, 0x3927, 0x0000, 0x13d7,
+	    0x0000, 0x473b, 0x0000, 0x1d7e, 0x21c5, 0x0000, 0x0b15, 0x0000,
+	    0x45ee, 0x0000, 0x0000, 0x2d15, 0x0000, 0x0000, 0x06f0, 0x1c75,
+	    0x2590, 0x0000, 0x46f2, 0x0000, 0x394b, 0x3796, 0x0000, 0x0000,
+	    0x0000, 0x30d6, 0x0000, 0x0000, 0x0000, 0x42c6, 0x0000, 0x12a2,
+	    0x4976, 0x0000, 0x2c71, 0x1fe1, 0x1091, 0x26eb, 0x0c2f, 0x371d,
+	    0x2611, 0x46d0, 0x0fb5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ebe,
+	    0x48de, 0x0000, 0x4d0b, 0x3a87, 0x1db5, 0x0000, 0x3f35, 0x0000,
+	    0x235a, 0x377a, 0x142f, 0x0000, 0x3fd3, 0x0000, 0x01ca, 0x0000,
+	    0x33b7, 0x3fc2, 0x49a3, 0x3e41, 0x0000, 0x1d95, 0x0d9b, 0x27fa,
+	    0x0000, 0x3a23, 0x0000, 0x2082, 0x18a9, 0x02e7, 0x0000, 0x0000,
+	    0x253c, 0x03a3, 0x16a8, 0x0000, 0x0a24, 0x0000, 0x0000, 0x2c3f,
+	    0x435d, 0x0000, 0x02e8, 0x0000, 0x0000, 0x1b32, 0x0000, 0x0000,
+	    0x352a, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f8b, 0x4032, 0x0000,
+	    0x26d4, 0x4d8f, 0x365d, 0x0000, 0x0000, 0x3082, 0x0000, 0x2663,
+	    0x417b, 0x3193, 0x000f, 0x3302, 0x0000, 0x00f1, 0x0266, 0x0000,
+	    0x0adf, 0x0000, 0x0000, 0x0000, 0x18fb, 0x0000, 0x1629, 0x1e30,
+	    0x4c2f, 0x3cc1, 0x0000, 0x0000, 0x4dfd, 0x0000, 0x0000, 0x389b,
+	    0x0000, 0x30aa, 0x0000, 0x14ab, 0x0000, 0x0000, 0x1567, 0x16c5,
+	    0x47f9, 0x0000, 0x3aa4, 0x1055, 0x0000, 0x0144, 0x0000, 0x11a2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1f79, 0x0000, 0x1221, 0x2795,
+	    0x38ed, 0x0000, 0x4a48, 0x0000, 0x0000, 0x0dfe, 0x379d, 0x3992,
+	    0x4698, 0x4995, 0x45ee, 0x0000, 0x0000, 0x1bb6, 0x0391, 0x0000,
+	    0x0000, 0x0000, 0x1df9, 0x0000, 0x0000, 0x0000, 0x146e, 0x48bf,
+	    0x40c5, 0x0000, 0x22f1, 0x0000, 0x38ca, 0x0b68, 0x0000, 0x0000,
+	    0x03de, 0x0b0a, 0x49eb, 0x1447, 0x2566, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x36ee, 0x0000, 0x1865, 0x0121, 0x0deb, 0x0000,
+	    0x445d, 0x29fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x2129, 0x0000,
+	    0x0000, 0x0000, 0x4b60, 0x1ed0, 0x04a7, 0x0000, 0x4648, 0x17b6,
+	    0x2576, 0x399d, 0x4741, 0x0000, 0x2d1f, 0x0000, 0x30ff, 0x4b9c,
+	    0x04bf, 0x01a7, 0x1831, 0x3f7c, 0x271a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2731, 0x4bff, 0x0000, 0x06ca, 0x0000, 0x0000, 0x0000,
+	    0x099a, 0x0000, 0x0000, 0x28e9, 0x0000, 0x0000, 0x0b62, 0x2dda,
+	    0x444e, 0x0000, 0x0dc5, 0x3bb8, 0x20bd, 0x0000, 0x16d3, 0x35c1,
+	    0x134c, 0x2e19, 0x0627, 0x41c2, 0x0000, 0x2738, 0x3b96, 0x43ef,
+	    0x0000, 0x0c79, 0x0000, 0x05a5, 0x0000, 0x1ea8, 0x0fe0, 0x339a,
+	    0x0000, 0x311d, 0x20f5, 0x1959, 0x0000, 0x129f, 0x0000, 0x3279,
+	    0x0000, 0x227b, 0x4627, 0x2cb6, 0x4252, 0x08dd, 0x2c96, 0x0000,
+	    0x0000, 0x378a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0000,
+	    0x0000, 0x0000, 0x2d79, 0x0000, 0x3c76, 0x0d48, 0x0000, 0x2009,
+	    0x45c3, 0x0000, 0x0000, 0x3472, 0x0000, 0x3c05, 0x0000, 0x09d8,
+	    0x1b9a, 0x0000, 0x393f, 0x0000, 0x0000, 0x23be, 0x0000, 0x0000,
+	    0x47eb, 0x0000, 0x43af, 0x3616, 0x0000, 0x3091, 0x0000, 0x0000,
+	    0x3626, 0x0000, 0x3699, 0x0129, 0x0000, 0x0000, 0x4a17, 0x0000,
+	    0x0000, 0x166f, 0x0000, 0x0000, 0x13b3, 0x4683, 0x23cb, 0x0ca1,
+	    0x0000, 0x0000, 0x0000, 0x12dc, 0x0000, 0x0000, 0x02fd, 0x4c60,
+	    0x0000, 0x3144, 0x45f3, 0x122b, 0x0000, 0x34ee, 0x0000, 0x0663,
+	    0x0000, 0x3a5b, 0x452e, 0x0000, 0x476b, 0x0000, 0x2943, 0x0000,
+	    0x0000, 0x3b6f, 0x0000, 0x2a48, 0x30cb, 0x4c84, 0x4143, 0x1cab,
+	    0x4a22, 0x0000, 0x451c, 0x4298, 0x2042, 0x0000, 0x36dd, 0x0000,
+	    0x1315, 0x2d97, 0x256b, 0x23d9, 0x0000, 0x0000, 0x1e30, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4a13, 0x10df, 0x0000, 0x2a4b,
+	    0x3004, 0x1033, 0x0000, 0x4b3f, 0x33bb, 0x0000, 0x05be, 0x3e3d,
+	    0x167f, 0x3fc2, 0x0000, 0x1e73, 0x0000, 0x1128, 0x237a, 0x3cb8,
+	    0x0fab, 0x0000, 0x1b8b, 0x0000, 0x0000, 0x1db1, 0x0ace, 0x15da,
+	    0x4648, 0x0bf5, 0x0681, 0x4cd2, 0x0000, 0x20c4, 0x1efa, 0x19f2,
+	    0x3e93, 0x0000, 0x3b61, 0x177d, 0x4695, 0x234d, 0x4b27, 0x20e7,
+	    0x07f5, 0x2b24, 0x364a, 0x455d, 0x300e, 0x1e16, 0x0000, 0x0000,
+	    0x459c, 0x0000, 0x0000, 0x3cc4, 0x0e5e, 0x0508, 0x0000, 0x14d5,
+	    0x03a2, 0x0000, 0x0000, 0x0000, 0x4c1a, 0x0000, 0x0000, 0x189d,
+	    0x0000, 0x3d3c, 0x41ae, 0x3753, 0x0000, 0x0000, 0x0000, 0x08d8,
+	    0x0f25, 0x0000, 0x317b, 0x450d, 0x0000, 0x4429, 0x03fa, 0x1863,
+	    0x0000, 0x2536, 0x2f70, 0x0000, 0x0000, 0x115b, 0x3f70, 0x0ce0,
+	    0x20bb, 0x2540, 0x49d8, 0x34d3, 0x0000, 0x4569, 0x0000, 0x2254,
+	    0x0000, 0x0000, 0x0000, 0x4c33, 0x1c26, 0x47c7, 0x3ba0, 0x0000,
+	    0x0000, 0x210b, 0x0000, 0x09c7, 0x32ab, 0x0000, 0x277e, 0x0000,
+	    0x2cd9, 0x0e8e, 0x194f, 0x0000, 0x1974, 0x0000, 0x3101, 0x2c3b,
+	    0x0500, 0x0000, 0x47fd, 0x30b8, 0x0000, 0x1bae, 0x0f62, 0x1bb7,
+	    0x2487, 0x0031, 0x4186, 0x0000, 0x0000, 0x05ce, 0x2d95, 0x2255,
+	    0x0000, 0x0aad, 0x1a29, 0x2801, 0x14a1, 0x2130, 0x0000, 0x1bb2,
+	    0x0c81, 0x28ee, 0x0000, 0x0480, 0x335f, 0x444d, 0x3f99, 0x3d74,
+	    0x0000, 0x0000, 0x3132, 0x1cba, 0x0000, 0x039c, 0x3d15, 0x0000,
+	    0x2b48, 0x0000, 0x0000, 0x2ccb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0abd, 0x4289, 0x1eee, 0x0000, 0x0000, 0x0000, 0x0acf, 0x1b0d,
+	    0x052f, 0x4abd, 0x1ebb, 0x0000, 0x0000, 0x10c9, 0x092f, 0x3534,
+	    0x0000, 0x0000, 0x29fb, 0x0000, 0x0000, 0x0000, 0x158b, 0x23fd,
+	    0x436f, 0x0000, 0x4a9b, 0x0000, 0x0d29, 0x0e2f, 0x0243, 0x0915,
+	    0x0000, 0x0000, 0x2b46, 0x3192, 0x2fd2, 0x3108, 0x0000, 0x037d,
+	    0x09a2, 0x1954, 0x0000, 0x0000, 0x0000, 0x0000, 0x27db, 0x1b6b,
+	    0x0000, 0x32fc, 0x2ebb, 0x1a78, 0x289d, 0x2b25, 0x18de, 0x04a2,
+	    0x3523, 0x0000, 0x1830, 0x0000, 0x3ff6, 0x3bdd, 0x0baa, 0x45bf,
+	    0x3098, 0x0404, 0x1403, 0x23b0, 0x0000, 0x0000, 0x0000, 0x235a,
+	    0x113c, 0x431c, 0x1b22, 0x1b68, 0x2c97, 0x413f, 0x0b91, 0x2d9a,
+	    0x07b3, 0x4501, 0x2fa1, 0x420d, 0x2299, 0x3dff, 0x1e6c, 0x0000,
+	    0x3788, 0x35e6, 0x1680, 0x4055, 0x3f58, 0x0000, 0x22a6, 0x341b,
+	    0x4d73, 0x0e07, 0x0000, 0x0000, 0x1bd8, 0x3a3c, 0x0000, 0x1c1f,
+	    0x0a07, 0x228d, 0x0000, 0x0000, 0x323f, 0x39c9, 0x35c5, 0x0000,
+	    0x1b2e, 0x4057, 0x3e56, 0x38d4, 0x0000, 0x2ef5, 0x3811, 0x0000,
+	    0x02c0, 0x18e4, 0x0528, 0x4468, 0x0000, 0x3363, 0x0000, 0x34b5,
+	    0x0b7f, 0x0000, 0x2e01, 0x240a, 0x3f03, 0x4ac3, 0x4dbb, 0x067a,
+	    0x0000, 0x0a60, 0x1701, 0x0000, 0x0000, 0x0000, 0x47e2, 0x47c7,
+	    0x0000, 0x0000, 0x0000, 0x3502, 0x48cf, 0x2f08, 0x06e2, 0x0000,
+	    0x3764, 0x0000, 0x3653, 0x2440, 0x0000, 0x07d0, 0x19b2, 0x2785,
+	    0x0000, 0x1566, 0x0e2f, 0x0000, 0x4878, 0x1c06, 0x3bb9, 0x0000,
+	    0x361f, 0x156a, 0x0cc0, 0x2806, 0x0000, 0x0000, 0x02fa, 0x0000,
+	    0x0000, 0x0000, 0x4067, 0x35e8, 0x10c1, 0x0000, 0x29f2, 0x0000,
+	    0x4aad, 0x0510, 0x0000, 0x1cc1, 0x0000, 0x196c, 0x3ebb, 0x0000,
+	    0x0000, 0x10a7, 0x1140, 0x0000, 0x27fb, 0x2a38, 0x1652, 0x369d,
+	    0x2ac7, 0x0e84, 0x1188, 0x244d, 0x1b77, 0x0000, 0x0000, 0x0000,
+	    0x2e34, 0x0000, 0x399b, 0x378c, 0x435d, 0x311f, 0x0000, 0x187b,
+	    0x2781, 0x286c, 0x0770, 0x2955, 0x0000, 0x0000, 0x4a78, 0x0000,
+	    0x0000, 0x2b33, 0x0000, 0x0000, 0x3f6b, 0x4dd8, 0x0000, 0x3bea,
+	    0x1f97, 0x1b61, 0x24f8, 0x0699, 0x3519, 0x05e3, 0x2111, 0x4c87,
+	    0x0000, 0x163f, 0x2e9d, 0x0618, 0x27ba, 0x14e3, 0x4971, 0x08e4,
+	    0x48bf, 0x48bc, 0x0000, 0x2465, 0x0000, 0x29b5, 0x0000, 0x42cc,
+	    0x0000, 0x0000, 0x0206, 0x0000, 0x004a, 0x3b81, 0x418e, 0x0000,
+	    0x2b76, 0x2ecb, 0x3c2b, 0x02c2, 0x0d1a, 0x0000, 0x4b08, 0x0000,
+	    0x0000, 0x33d3, 0x0000, 0x0000, 0x4361, 0x0099, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x344c, 0x0449, 0x0000, 0x41d2,
+	    0x0000, 0x05d6, 0x4625, 0x0000, 0x2803, 0x0000, 0x0000, 0x0000,
+	    0x22f3, 0x0000, 0x0000, 0x041a, 0x0000, 0x0000, 0x1795, 0x0000,
+	    0x0000, 0x1348, 0x2b0c, 0x40df, 0x1513, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x39d1, 0x235f, 0x0000, 0x0fe7, 0x2865, 0x0000, 0x4744,
+	    0x0000, 0x0000, 0x04cf, 0x0000, 0x0000, 0x0000, 0x46cc, 0x2fed,
+	    0x3676, 0x333f, 0x0000, 0x0000, 0x3fad, 0x0cf8, 0x0000, 0x0000,
+	    0x4de4, 0x0000, 0x0000, 0x0000, 0x1fa5, 0x3123, 0x0000, 0x1370,
+	    0x0000, 0x340a, 0x0000, 0x0000, 0x0464, 0x3022, 0x058f, 0x0000,
+	    0x0f98, 0x0000, 0x0000, 0x0000, 0x2d8b, 0x42a0, 0x4519, 0x41dc,
+	    0x0000, 0x0000, 0x2676, 0x027e, 0x331f, 0x0000, 0x3dcb, 0x05cb,
+	    0x0000, 0x2f76, 0x48ef, 0x0000, 0x0b1f, 0x48a4, 0x1ba3, 0x0000,
+	    0x019a, 0x333d, 0x44a1, 0x0000, 0x0000, 0x0000, 0x2b0d, 0x15a6,
+	    0x3f67, 0x4649, 0x07ff, 0x0000, 0x2e91, 0x4845, 0x169f, 0x46b4,
+	    0x0000, 0x32a1, 0x017c, 0x3f33, 0x11b1, 0x1034, 0x47f3, 0x2bd2,
+	    0x28e3, 0x1f17, 0x3ead, 0x13ee, 0x4776, 0x0000, 0x3f62, 0x0000,
+	    0x0000, 0x18c6, 0x2a72, 0x0000, 0x0000, 0x0000, 0x0421, 0x14ff,
+	    0x1f53, 0x22b2, 0x0000, 0x2adb, 0x0000, 0x0000, 0x31ea, 0x4543,
+	    0x0000, 0x2113, 0x0d56, 0x12e4, 0x1db7, 0x0000, 0x479f, 0x0000,
+	    0x010b, 0x0e92, 0x0000, 0x08c9, 0x3fca, 0x0555, 0x0000, 0x1e8b,
+	    0x21c8, 0x0dde, 0x2ba4, 0x0000, 0x27e8, 0x080e, 0x4722, 0x3179,
+	    0x3240, 0x0da1, 0x0000, 0x0000, 0x0000, 0x39d5, 0x4179, 0x266e,
+	    0x49f5, 0x0000, 0x2d13, 0x090d, 0x031f, 0x0000, 0x0000, 0x361e,
+	    0x0760, 0x226f, 0x2790, 0x0000, 0x4cc6, 0x0000, 0x0000, 0x0000,
+	    0x3b26, 0x0000, 0x3686, 0x0a5a, 0x0000, 0x0000, 0x0caf, 0x1038,
+	    0x0000, 0x0000, 0x4cf1, 0x0000, 0x1e94, 0x3ac0, 0x28ba, 0x160f,
+	    0x4083, 0x03aa, 0x10c6, 0x091a, 0x24bf, 0x0000, 0x172f, 0x1d42,
+	    0x0000, 0x038c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01d2,
+	    0x46b3, 0x18cb, 0x4066, 0x0000, 0x49ca, 0x4035, 0x0b63, 0x0fb3,
+	    0x0000, 0x1c31, 0x0000, 0x0000, 0x4c24, 0x3f2b, 0x0000, 0x02b7,
+	    0x3c36, 0x2e0d, 0x1872, 0x0000, 0x0000, 0x1ca4, 0x0000, 0x0000,
+	    0x073e, 0x0000, 0x3fa4, 0x1f36, 0x01e2, 0x0b58, 0x331e, 0x0000,
+	    0x3ab1, 0x0000, 0x1591, 0x0000, 0x3ed5, 0x4080, 0x0d7a, 0x3ea4,
+	    0x0000, 0x0000, 0x3841, 0x2e0c, 0x0063, 0x0000, 0x0000, 0x0000,
+	    0x4162, 0x0000, 0x0000, 0x0000, 0x224f, 0x0000, 0x0000, 0x02ec,
+	    0x0931, 0x0000, 0x0a0b, 0x17fd, 0x19c2, 0x28b4, 0x028f, 0x0000,
+	    0x1e1c, 0x0766, 0x2ac4, 0x0a3f, 0x44d0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x307b, 0x3f7b, 0x162f, 0x3611, 0x4bec, 0x2dd0,
+	    0x0000, 0x10ad, 0x0000, 0x0000, 0x0000, 0x1a23, 0x2a46, 0x34e1,
+	    0x016f, 0x0000, 0x39f8, 0x0000, 0x02be, 0x11ec, 0x05c7, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0e18, 0x0000, 0x2748, 0x2886, 0x1919,
+	    0x0000, 0x2255, 0x0000, 0x32bb, 0x356c, 0x416f, 0x3a00, 0x0000,
+	    0x4110, 0x0518, 0x4ab8, 0x30f6, 0x29b0, 0x2b9e, 0x0000, 0x0000,
+	    0x0000, 0x07bc, 0x0000, 0x456b, 0x3aff, 0x0000, 0x0000, 0x0000,
+	    0x301b, 0x0000, 0x3f9c, 0x0000, 0x34f8, 0x0000, 0x0000, 0x36c4,
+	    0x40cc, 0x3737, 0x4977, 0x38fd, 0x0000, 0x0000, 0x0000, 0x0d4d,
+	    0x281d, 0x0000, 0x01a1, 0x35b9, 0x116e, 0x15cc, 0x343f, 0x0000,
+	    0x1ddf, 0x0000, 0x1f10, 0x0000, 0x34d6, 0x341c, 0x33ae, 0x0000,
+	    0x075d, 0x2bef, 0x0000, 0x0000, 0x21f8, 0x092b, 0x351c, 0x0000,
+	    0x44f8, 0x0a1d, 0x28ed, 0x0208, 0x0000, 0x0000, 0x3f76, 0x0000,
+	    0x0749, 0x0000, 0x2e69, 0x0000, 0x0000, 0x1065, 0x2984, 0x21d2,
+	    0x33dc, 0x0000, 0x17bc, 0x0928, 0x182f, 0x0000, 0x0000, 0x0000,
+	    0x02a5, 0x0000, 0x0000, 0x181b, 0x13d3, 0x0000, 0x0e43, 0x41e5,
+	    0x2f85, 0x215b, 0x0f52, 0x0000, 0x0000, 0x0000, 0x0475, 0x426b,
+	    0x0000, 0x0432, 0x4e19, 0x0000, 0x018e, 0x1926, 0x2771, 0x15cb,
+	    0x0000, 0x0000, 0x15dd, 0x286c, 0x3668, 0x185b, 0x39dc, 0x46ea,
+	    0x0000, 0x0a92, 0x2c25, 0x36ec, 0x48e9, 0x0000, 0x0227, 0x0000,
+	    0x04f8, 0x0000, 0x28e7, 0x2d0e, 0x2957, 0x0000, 0x0000, 0x3f40,
+	    0x276b, 0x0000, 0x0000, 0x0000, 0x3235, 0x021b, 0x0000, 0x1ab5,
+	    0x2e9c, 0x21e4, 0x1441, 0x3fb0, 0x0820, 0x01e6, 0x0000, 0x0000,
+	    0x1b8b, 0x0000, 0x0000, 0x4162, 0x2c7d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x30eb, 0x3e3e, 0x1c22, 0x0e86, 0x34bd, 0x137b, 0x0552,
+	    0x0000, 0x10d6, 0x0000, 0x0000, 0x4a43, 0x0000, 0x0000, 0x3a95,
+	    0x2897, 0x0000, 0x4aec, 0x0000, 0x0000, 0x3402, 0x148c, 0x01e0,
+	    0x0000, 0x24dc, 0x4d10, 0x3904, 0x38be, 0x2c9f, 0x27e3, 0x1593,
+	    0x0000, 0x2047, 0x3c11, 0x2ba0, 0x351c, 0x0000, 0x3a86, 0x0000,
+	    0x0000, 0x08ec, 0x0000, 0x0000, 0x4287, 0x13aa, 0x4b45, 0x162c,
+	    0x222b, 0x0000, 0x3c11, 0x1d12, 0x33f0, 0x2bd6, 0x0000, 0x42b1,
+	    0x0000, 0x461e, 0x3284, 0x0661, 0x0000, 0x14dc, 0x0000, 0x4031,
+	    0x2496, 0x0000, 0x0952, 0x0000, 0x0000, 0x48f3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a75, 0x0000, 0x0c78,
+	    0x0cda, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ca9, 0x0c10, 0x0000,
+	    0x0000, 0x4878, 0x22de, 0x0000, 0x4d02, 0x0582, 0x0000, 0x48bf,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0eee, 0x0000, 0x1682, 0x0000,
+	    0x4835, 0x0000, 0x133f, 0x303f, 0x0000, 0x0583, 0x31fa, 0x0000,
+	    0x0000, 0x01f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3434, 0x0a74, 0x0000, 0x0b1d, 0x0000, 0x0000, 0x0e5b, 0x2cc2,
+	    0x0000, 0x2d84, 0x0000, 0x0000, 0x40db, 0x4779, 0x0a62, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3a38, 0x269e, 0x0d0b, 0x3c4c, 0x258f,
+	    0x20b4, 0x0000, 0x1629, 0x3613, 0x45ec, 0x0000, 0x4daa, 0x08cc,
+	    0x0000, 0x3287, 0x4a51, 0x1209, 0x0000, 0x0fb3, 0x0e86, 0x27dd,
+	    0x00d6, 0x0000, 0x0c66, 0x0000, 0x28fa, 0x0000, 0x0000, 0x0000,
+	    0x0873, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x44db, 0x02ba,
+	    0x2466, 0x1ac2, 0x0000, 0x3429, 0x389d, 0x120e, 0x262b, 0x1d42,
+	    0x3960, 0x3009, 0x1118, 0x3e11, 0x34ad, 0x0000, 0x113b, 0x0000,
+	    0x1ec3, 0x1231, 0x1cb2, 0x0000, 0x3666, 0x0000, 0x2783, 0x0565,
+	    0x0000, 0x2220, 0x0eed, 0x255d, 0x124f, 0x0000, 0x331e, 0x0000,
+	    0x418d, 0x0000, 0x2eef, 0x20e9, 0x26c2, 0x0000, 0x17a3, 0x4673,
+	    0x1914, 0x0000, 0x3936, 0x3631, 0x3d38, 0x158a, 0x0000, 0x133e,
+	    0x330a, 0x4c83, 0x058c, 0x2352, 0x125a, 0x3ec3, 0x0000, 0x0000,
+	    0x2f94, 0x0000, 0x1748, 0x0000, 0x059f, 0x20bf, 0x0000, 0x14c9,
+	    0x0000, 0x3605, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c27, 0x388c,
+	    0x17b5, 0x0000, 0x49d9, 0x2435, 0x0000, 0x4a6d, 0x365c, 0x05c7,
+	    0x0b57, 0x0000, 0x14f1, 0x3c5d, 0x3355, 0x0000, 0x0000, 0x1b68,
+	    0x0000, 0x01dd, 0x33eb, 0x4692, 0x2c55, 0x0000, 0x1648, 0x2b9f,
+	    0x2eea, 0x0000, 0x1b8a, 0x2702, 0x0229, 0x1916, 0x1b74, 0x4b65,
+	    0x3f00, 0x3600, 0x0000, 0x1b30, 0x16c4, 0x0000, 0x23e1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4a98, 0x0000, 0x4135, 0x0c59, 0x2b12,
+	    0x0000, 0x0000, 0x3b97, 0x0c61, 0x4223, 0x0000, 0x0000, 0x0000,
+	    0x2533, 0x3fb8, 0x0524, 0x0000, 0x18e9, 0x0000, 0x2304, 0x0000,
+	    0x0000, 0x0000, 0x435d, 0x0000, 0x4dca, 0x4da6, 0x1fd5, 0x476f,
+	    0x0000, 0x17a3, 0x4c66, 0x0000, 0x0000, 0x0000, 0x035e, 0x264a,
+	    0x1f95, 0x0000, 0x24d8, 0x0000, 0x0e3b, 0x3445, 0x0000, 0x0000,
+	    0x15d4, 0x4372, 0x0000, 0x21ad, 0x26c5, 0x354c, 0x0000, 0x4c38,
+	    0x2763, 0x3836, 0x3386, 0x41b4, 0x0238, 0x1e1b, 0x0000, 0x430c,
+	    0x0000, 0x21e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f77,
+	    0x181c, 0x0000, 0x0e8b, 0x2f69, 0x0000, 0x0000, 0x2598, 0x326f,
+	    0x18b5, 0x0e64, 0x2a20, 0x0000, 0x2c02, 0x38ce, 0x0e21, 0x3ac8,
+	    0x49ad, 0x0000, 0x0000, 0x1720, 0x3803, 0x1556, 0x0000, 0x0000,
+	    0x01d6, 0x2934, 0x0000, 0x0000, 0x28b9, 0x0000, 0x066f, 0x0000,
+	    0x0000, 0x4c0a, 0x0e64, 0x0000, 0x0000, 0x0000, 0x0371, 0x467e,
+	    0x3094, 0x01e6, 0x3e95, 0x0000, 0x0000, 0x2466, 0x1630, 0x344d,
+	    0x0000, 0x20a9, 0x0000, 0x0000, 0x2003, 0x1b00, 0x4288, 0x20a9,
+	    0x1114, 0x074b, 0x1d0f, 0x380b, 0x4772, 0x2d7c, 0x0fb2, 0x23c1,
+	    0x0000, 0x0b6f, 0x18a4, 0x02d1, 0x0000, 0x3956, 0x0000, 0x11eb,
+	    0x0000, 0x3a5d, 0x0000, 0x0000, 0x0000, 0x31b2, 0x0000, 0x1884,
+	    0x0000, 0x0000, 0x4612, 0x0000, 0x0000, 0x0000, 0x1027, 0x37e2,
+	    0x218e, 0x3295, 0x0c49, 0x103b, 0x4b2d, 0x1a22, 0x2eac, 0x0000,
+	    0x059f, 0x2132, 0x2890, 0x0000, 0x0000, 0x0000, 0x2123, 0x0000,
+	    0x0000, 0x215c, 0x0000, 0x0000, 0x0000, 0x0000, 0x43b7, 0x3000,
+	    0x2398, 0x1162, 0x0000, 0x0000, 0x4a67, 0x3367, 0x2ac4, 0x1140,
+	    0x16f0, 0x2bbf, 0x13e5, 0x0a34, 0x4be3, 0x1b5e, 0x2106, 0x22e8,
+	    0x0e65, 0x2955, 0x0000, 0x0000, 0x3df5, 0x4052, 0x394a, 0x0000,
+	    0x0cb6, 0x0a5e, 0x02e8, 0x0873, 0x0000, 0x0000, 0x3ee6, 0x0000,
+	    0x20cc, 0x4508, 0x4048, 0x0000, 0x404d, 0x0000, 0x0000, 0x28ab,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b28, 0x06b4, 0x1b8b,
+	    0x384b, 0x36ee, 0x3e1a, 0x1d65, 0x2c13, 0x239c, 0x0000, 0x21ac,
+	    0x0000, 0x0000, 0x3ef8, 0x39f9, 0x443f, 0x4bd0, 0x4a8e, 0x0c8a,
+	    0x2434, 0x0000, 0x0000, 0x445b, 0x16f3, 0x4501, 0x3c1c, 0x2d81,
+	    0x0000, 0x1838, 0x3a92, 0x0000, 0x0000, 0x42f9, 0x0000, 0x2361,
+	    0x3ac8, 0x0000, 0x0000, 0x0165, 0x0000, 0x0000, 0x4996, 0x0d82,
+	    0x3ee9, 0x28e5, 0x42bf, 0x1574, 0x0000, 0x0000, 0x2356, 0x0000,
+	    0x0000, 0x0000, 0x37e7, 0x0000, 0x172f, 0x0000, 0x06d7, 0x4576,
+	    0x0000, 0x383b, 0x22da, 0x0000, 0x0000, 0x0000, 0x43d4, 0x3080,
+	    0x277b, 0x0000, 0x0000, 0x0000, 0x391c, 0x0000, 0x2013, 0x1912,
+	    0x0000, 0x12c1, 0x10fb, 0x3a6d, 0x487b, 0x114d, 0x3223, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x39b9, 0x068e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0acc, 0x306f, 0x13d1, 0x0000, 0x0000, 0x0000, 0x2a11,
+	    0x37b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x098f, 0x2d0b, 0x1843,
+	    0x1a7d, 0x0000, 0x0361, 0x3ba2, 0x2ee1, 0x23a8, 0x21e6, 0x2bc6,
+	    0x0000, 0x0000, 0x0968, 0x0000, 0x3d30, 0x0000, 0x3376, 0x0000,
+	    0x4b01, 0x3cf4, 0x28da, 0x0000, 0x0000, 0x0000, 0x0000, 0x3266,
+	    0x2101, 0x0000, 0x07ae, 0x139e, 0x0000, 0x4b51, 0x0a92, 0x0000,
+	    0x0000, 0x0000, 0x1839, 0x0000, 0x00cf, 0x0000, 0x3816, 0x4a1c,
+	    0x0595, 0x0000, 0x30d2, 0x3b47, 0x0000, 0x21ca, 0x0000, 0x34b9,
+	    0x36d5, 0x1dc0, 0x0000, 0x0000, 0x09a4, 0x2b4d, 0x0277, 0x0000,
+	    0x0000, 0x0000, 0x2823, 0x0366, 0x0000, 0x0000, 0x0000, 0x0629,
+	    0x2e51, 0x1946, 0x0000, 0x0000, 0x09a2, 0x378f, 0x31be, 0x0000,
+	    0x0000, 0x04a0, 0x0000, 0x0000, 0x2360, 0x3f30, 0x0000, 0x0000,
+	    0x3029, 0x474e, 0x0000, 0x3332, 0x0000, 0x2069, 0x472e, 0x2998,
+	    0x45df, 0x0000, 0x2d45, 0x17ab, 0x486d, 0x0000, 0x1af6, 0x0464,
+	    0x0000, 0x0000, 0x0000, 0x4021, 0x3354, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3561, 0x4a04, 0x0000, 0x0000, 0x0f6a, 0x0000, 0x0000,
+	    0x19c6, 0x4076, 0x274e, 0x1274, 0x1aa8, 0x0656, 0x0942, 0x01c1,
+	    0x0000, 0x45e0, 0x0000, 0x3cdd, 0x0000, 0x40d1, 0x0000, 0x0000,
+	    0x0000, 0x2ac0, 0x26a5, 0x4120, 0x0000, 0x22c1, 0x11b2, 0x0000,
+	    0x0000, 0x09cd, 0x0000, 0x41d0, 0x0932, 0x0078, 0x0b8c, 0x0000,
+	    0x0000, 0x0e5a, 0x1dbd, 0x16a6, 0x0000, 0x0000, 0x0000, 0x1e07,
+	    0x0ef1, 0x0000, 0x4693, 0x29ad, 0x3698, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4ce4, 0x2e76, 0x387a, 0x1d3b, 0x2b8e,
+	    0x0000, 0x3fff, 0x0000, 0x0000, 0x0000, 0x321c, 0x2e30, 0x0000,
+	    0x384a, 0x0000, 0x0000, 0x0eec, 0x0000, 0x0000, 0x0000, 0x35cd,
+	    0x2df7, 0x0b48, 0x15bd, 0x4cce, 0x0000, 0x171c, 0x0000, 0x0000,
+	    0x3362, 0x0177, 0x49c9, 0x3032, 0x2a3b, 0x0000, 0x021f, 0x48b6,
+	    0x0000, 0x0000, 0x2205, 0x1444, 0x0000, 0x0000, 0x3945, 0x0000,
+	    0x2db1, 0x0000, 0x123f, 0x3569, 0x1d14, 0x210e, 0x1017, 0x3680,
+	    0x0000, 0x20ff, 0x0000, 0x40bf, 0x0fdb, 0x3d8e, 0x4671, 0x3f31,
+	    0x3ea9, 0x0000, 0x0000, 0x0000, 0x00f1, 0x4680, 0x0430, 0x01f8,
+	    0x03d1, 0x441e, 0x2028, 0x4541, 0x1ac8, 0x342c, 0x0000, 0x0000,
+	    0x3965, 0x0000, 0x0000, 0x0000, 0x0bf9, 0x4632, 0x2d35, 0x32fd,
+	    0x0036, 0x0000, 0x0000, 0x3abf, 0x0000, 0x244e, 0x0000, 0x0000,
+	    0x0000, 0x2244, 0x18e1, 0x0000, 0x1f61, 0x492b, 0x0000, 0x1caa,
+	    0x0000, 0x10e5, 0x0000, 0x3e97, 0x127a, 0x0000, 0x45c9, 0x1643,
+	    0x0000, 0x0000, 0x0000, 0x4a9c, 0x2fb8, 0x2117, 0x0000, 0x43d1,
+	    0x0000, 0x0000, 0x3c85, 0x0000, 0x0000, 0x4696, 0x205d, 0x1681,
+	    0x0000, 0x0000, 0x0000, 0x324f, 0x026f, 0x0000, 0x2822, 0x285d,
+	    0x1a32, 0x1308, 0x4508, 0x0479, 0x0000, 0x4be2, 0x4963, 0x0000,
+	    0x483f, 0x0000, 0x3186, 0x302c, 0x0000, 0x0000, 0x47f3, 0x2990,
+	    0x0000, 0x3475, 0x408a, 0x0000, 0x11ba, 0x031c, 0x0000, 0x0000,
+	    0x093f, 0x0000, 0x0000, 0x4786, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x18a6, 0x137c, 0x2c7c, 0x166d, 0x21e1, 0x2114, 0x0000,
+	    0x0000, 0x4321, 0x0000, 0x0000, 0x0000, 0x0000, 0x4112, 0x1153,
+	    0x0000, 0x3353, 0x0000, 0x2a8f, 0x0000, 0x0000, 0x1df8, 0x0000,
+	    0x307f, 0x2c05, 0x3d06, 0x272b, 0x0000, 0x1588, 0x0000, 0x0000,
+	    0x1157, 0x082e, 0x4604, 0x467c, 0x2a30, 0x39ac, 0x0000, 0x0000,
+	    0x229f, 0x10f6, 0x3e20, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3a5b, 0x0000, 0x0000, 0x0000, 0x44f9, 0x0000,
+	    0x41d9, 0x398f, 0x3aab, 0x0000, 0x0000, 0x0000, 0x148e, 0x2740,
+	    0x1e4e, 0x490d, 0x076b, 0x2fed, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3185, 0x0cab, 0x35d9, 0x4d5a, 0x03bf, 0x1213, 0x0000, 0x0000,
+	    0x2df2, 0x164a, 0x43ed, 0x4c7c, 0x22f6, 0x30ed, 0x0000, 0x0000,
+	    0x29b9, 0x3f53, 0x0000, 0x0ecf, 0x306d, 0x0000, 0x0000, 0x0000,
+	    0x0154, 0x0000, 0x0000, 0x178e, 0x348d, 0x0000, 0x0883, 0x4310,
+	    0x0d48, 0x0000, 0x458f, 0x3435, 0x0000, 0x37c8, 0x0000, 0x0000,
+	    0x0000, 0x1202, 0x0000, 0x0000, 0x0000, 0x0000, 0x1244, 0x043f,
+	    0x45b2, 0x0000, 0x4ba2, 0x218e, 0x0000, 0x2ae2, 0x0e0d, 0x4706,
+	    0x0000, 0x2fc1, 0x4c51, 0x0000, 0x4d6c, 0x0000, 0x3096, 0x2d72,
+	    0x0000, 0x0000, 0x20ba, 0x0000, 0x0000, 0x0000, 0x4c4d, 0x0000,
+	    0x3f68, 0x0ed6, 0x42f7, 0x193e, 0x494d, 0x0000, 0x26f5, 0x0000,
+	    0x2493, 0x395a, 0x0770, 0x45b7, 0x10d7, 0x0000, 0x0000, 0x28d3,
+	    0x0000, 0x0000, 0x33ef, 0x4913, 0x0000, 0x0000, 0x2dc8, 0x2ecd,
+	    0x0000, 0x1c75, 0x0000, 0x0000, 0x03ab, 0x297f, 0x1c1b, 0x1a93,
+	    0x0000, 0x2f18, 0x47a7, 0x0000, 0x16a0, 0x0234, 0x1b80, 0x42ff,
+	    0x0a6b, 0x0000, 0x0000, 0x1a31, 0x0000, 0x24f3, 0x0000, 0x0000,
+	    0x0000, 0x3a08, 0x17f2, 0x0000, 0x3e67, 0x0113, 0x1658, 0x41da,
+	    0x05fe, 0x0139, 0x09fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f75,
+	    0x0000, 0x2c71, 0x2c75, 0x0c24, 0x4432, 0x3cf2, 0x0000, 0x2791,
+	    0x1ae3, 0x268f, 0x446b, 0x231b, 0x0000, 0x0000, 0x0000, 0x22e1,
+	    0x3574, 0x0000, 0x1bac, 0x0000, 0x1b39, 0x0a7a, 0x0000, 0x18dd,
+	    0x0000, 0x0000, 0x1085, 0x2b92, 0x0000, 0x25c2, 0x0000, 0x0bad,
+	    0x0000, 0x154c, 0x469c, 0x333a, 0x47cc, 0x3223, 0x2863, 0x0000,
+	    0x391e, 0x3e13, 0x0000, 0x0000, 0x0000, 0x0199, 0x4ce8, 0x141b,
+	    0x2d46, 0x0946, 0x0000, 0x3d5c, 0x0000, 0x0000, 0x0000, 0x3eb2,
+	    0x0cd3, 0x320e, 0x3909, 0x0850, 0x4305, 0x44f6, 0x3c52, 0x0000,
+	    0x0000, 0x4940, 0x372d, 0x0637, 0x0000, 0x31ba, 0x1050, 0x0000,
+	    0x185b, 0x0000, 0x0000, 0x0000, 0x09fd, 0x0000, 0x0ec9, 0x0000,
+	    0x0000, 0x0000, 0x42cd, 0x40c6, 0x0000, 0x0000, 0x023d, 0x0de4,
+	    0x275b, 0x09ac, 0x0000, 0x0000, 0x3dfa, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0d52, 0x3013, 0x0000, 0x369c,
+	    0x0000, 0x4c69, 0x3797, 0x43cc, 0x0608, 0x2ffb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2487, 0x0000, 0x39c0, 0x028d,
+	    0x0000, 0x10b5, 0x09ea, 0x385e, 0x0703, 0x0000, 0x13b7, 0x3b77,
+	    0x0000, 0x4c6f, 0x0000, 0x102d, 0x3a04, 0x2643, 0x0000, 0x0000,
+	    0x23f2, 0x2605, 0x21ba, 0x0000, 0x1547, 0x45d7, 0x0f37, 0x028d,
+	    0x2eb0, 0x0000, 0x0000, 0x0000, 0x076b, 0x0000, 0x39f4, 0x0000,
+	    0x4aa5, 0x4065, 0x2094, 0x0000, 0x1fc0, 0x4895, 0x0000, 0x34ba,
+	    0x0000, 0x30b4, 0x0000, 0x1adf, 0x0000, 0x2ea1, 0x0000, 0x2732,
+	    0x0000, 0x0000, 0x168a, 0x0000, 0x42f5, 0x180c, 0x10b8, 0x0000,
+	    0x0000, 0x384d, 0x0000, 0x0000, 0x1182, 0x0000, 0x46de, 0x20b1,
+	    0x0000, 0x0241, 0x0000, 0x4007, 0x0000, 0x0000, 0x3f9a, 0x37c3,
+	    0x0000, 0x0000, 0x1018, 0x0f77, 0x20bd, 0x459d, 0x3a2c, 0x2291,
+	    0x0000, 0x0000, 0x0000, 0x0fe3, 0x1c14, 0x0000, 0x1d9e, 0x0000,
+	    0x0000, 0x329a, 0x0000, 0x0000, 0x0000, 0x1c46, 0x2a0f, 0x3d53,
+	    0x0000, 0x0000, 0x45c5, 0x308f, 0x3fe8, 0x1304, 0x0000, 0x0000,
+	    0x0000, 0x41c5, 0x3636, 0x1ebe, 0x479c, 0x14d2, 0x0000, 0x1287,
+	    0x0000, 0x0000, 0x2587, 0x48c9, 0x0000, 0x0b03, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x12d6, 0x1309, 0x22cd, 0x017e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4aca, 0x4384, 0x1fcf, 0x0c48, 0x2024,
+	    0x0000, 0x3b9a, 0x0000, 0x1f54, 0x311a, 0x4362, 0x2c86, 0x0000,
+	    0x2151, 0x34a7, 0x009e, 0x0000, 0x0000, 0x0000, 0x0000, 0x4370,
+	    0x3715, 0x12e4, 0x0a6f, 0x0000, 0x0000, 0x0000, 0x1140, 0x0000,
+	    0x3349, 0x3ecd, 0x0000, 0x0ee2, 0x07fb, 0x4416, 0x0000, 0x445d,
+	    0x2c83, 0x0000, 0x45d5, 0x10af, 0x3c1b, 0x3b0b, 0x3038, 0x0000,
+	    0x0000, 0x0000, 0x4a8d, 0x2dec, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x175d, 0x038c, 0x23cf, 0x3d7f, 0x4121, 0x1923, 0x1e58,
+	    0x0000, 0x4a0c, 0x0000, 0x3d0c, 0x0f95, 0x0000, 0x0000, 0x00b8,
+	    0x195c, 0x0000, 0x186b, 0x0000, 0x3cb6, 0x0359, 0x2986, 0x452e,
+	    0x480a, 0x4010, 0x035b, 0x0000, 0x0000, 0x17ea, 0x0000, 0x0c56,
+	    0x0000, 0x0000, 0x1b5c, 0x08db, 0x1bff, 0x4280, 0x31d7, 0x2e77,
+	    0x0000, 0x2815, 0x28ea, 0x0000, 0x0000, 0x3374, 0x0b9f, 0x2d32,
+	    0x3cf8, 0x1384, 0x13e4, 0x0e2e, 0x0000, 0x472c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4505, 0x4769, 0x0000, 0x36d3, 0x0d4f, 0x0000,
+	    0x0000, 0x3293, 0x0000, 0x3848, 0x4a4d, 0x0000, 0x2349, 0x4189,
+	    0x0def, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e12, 0x0000, 0x0000,
+	    0x0000, 0x133c, 0x0000, 0x0000, 0x3ed1, 0x0000, 0x0000, 0x0000,
+	    0x0859, 0x13c1, 0x3629, 0x0000, 0x325d, 0x3a18, 0x4aae, 0x22e3,
+	    0x0000, 0x3c5e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x43ec,
+	    0x15ff, 0x0000, 0x0000, 0x20b7, 0x1786, 0x2d85, 0x2bda, 0x0000,
+	    0x4436, 0x3280, 0x3cbb, 0x0000, 0x32a9, 0x360b, 0x3e9d, 0x0000,
+	    0x4491, 0x0804, 0x0000, 0x2932, 0x0000, 0x27e5, 0x0000, 0x2b8d,
+	    0x0000, 0x370b, 0x0000, 0x4844, 0x17bd, 0x0000, 0x4619, 0x0000,
+	    0x0000, 0x350b, 0x0000, 0x0b9c, 0x24a9, 0x2ef3, 0x0000, 0x0df5,
+	    0x0000, 0x2450, 0x272a, 0x24a3, 0x0000, 0x0000, 0x3225, 0x0fd2,
+	    0x174f, 0x0000, 0x226c, 0x2315, 0x3d82, 0x0000, 0x0c7a, 0x0000,
+	    0x3ab0, 0x0000, 0x3d66, 0x1480, 0x0000, 0x1f43, 0x0000, 0x0000,
+	    0x0000, 0x4660, 0x15a8, 0x3711, 0x2225, 0x03bd, 0x00c7, 0x0000,
+	    0x3d90, 0x0000, 0x38ea, 0x46a0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x33da, 0x0d99, 0x3dd7, 0x0e1d, 0x214d, 0x3c47, 0x0821, 0x0000,
+	    0x222a, 0x0000, 0x0000, 0x0a4d, 0x32d9, 0x0134, 0x0000, 0x0000,
+	    0x0000, 0x410a, 0x0000, 0x3277, 0x0000, 0x30fd, 0x2100, 0x0000,
+	    0x4b16, 0x1713, 0x264c, 0x2eac, 0x1381, 0x0000, 0x1eb5, 0x0000,
+	    0x1a80, 0x0000, 0x0000, 0x2857, 0x30bc, 0x10fa, 0x0000, 0x20ae,
+	    0x0037, 0x3845, 0x2791, 0x2fa7, 0x3ddd, 0x0000, 0x0c69, 0x0000,
+	    0x2764, 0x0000, 0x2101, 0x4a09, 0x05ab, 0x0000, 0x1e42, 0x31ec,
+	    0x0000, 0x0000, 0x0b69, 0x4a66, 0x0d5b, 0x24f6, 0x2309, 0x1868,
+	    0x0000, 0x225f, 0x0459, 0x0000, 0x12a1, 0x1688, 0x08c8, 0x2fe2,
+	    0x0000, 0x0000, 0x4423, 0x0000, 0x033c, 0x0000, 0x0000, 0x1fbc,
+	    0x0000, 0x29ff, 0x0000, 0x0000, 0x3d26, 0x40c1, 0x0000, 0x3588,
+	    0x3921, 0x0000, 0x246a, 0x0000, 0x00fd, 0x0000, 0x4337, 0x078d,
+	    0x1330, 0x390e, 0x31a6, 0x1207, 0x4324, 0x4271, 0x0000, 0x415d,
+	    0x0000, 0x0000, 0x0000, 0x01a5, 0x0000, 0x26fa, 0x446a, 0x0000,
+	    0x0000, 0x4d3a, 0x1408, 0x0000, 0x0000, 0x24c1, 0x0000, 0x1733,
+	    0x00bc, 0x0e93, 0x00de, 0x0000, 0x2cc1, 0x2f55, 0x05c2, 0x0000,
+	    0x1667, 0x4603, 0x321e, 0x2d5d, 0x1827, 0x0000, 0x3ec3, 0x0000,
+	    0x0ed5, 0x0000, 0x2037, 0x0000, 0x0000, 0x08d7, 0x0000, 0x0000,
+	    0x0f17, 0x2604, 0x0000, 0x0000, 0x0000, 0x1d85, 0x45ef, 0x306a,
+	    0x0000, 0x0000, 0x1a97, 0x0000, 0x4864, 0x0000, 0x3b4f, 0x1d2a,
+	    0x0000, 0x0000, 0x4289, 0x30a6, 0x0000, 0x032c, 0x44c7, 0x0000,
+	    0x0000, 0x0000, 0x4405, 0x0e31, 0x28a5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1646, 0x0846, 0x15d6, 0x1a27, 0x2c3e, 0x1e0f,
+	    0x0000, 0x0000, 0x0000, 0x2dd2, 0x0000, 0x3e0e, 0x3660, 0x0000,
+	    0x1d22, 0x3b96, 0x4abf, 0x0000, 0x48ff, 0x0000, 0x27b6, 0x0000,
+	    0x0000, 0x0000, 0x49e9, 0x27fe, 0x0000, 0x0000, 0x079f, 0x0583,
+	    0x0000, 0x0000, 0x0000, 0x1cf7, 0x12d7, 0x4d96, 0x15d4, 0x31b5,
+	    0x2477, 0x0000, 0x2d89, 0x0000, 0x3442, 0x3588, 0x1ddc, 0x0000,
+	    0x2839, 0x15fc, 0x0000, 0x2c1f, 0x0862, 0x009b, 0x147c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0397, 0x01fc,
+	    0x0000, 0x0000, 0x0000, 0x3a4d, 0x0000, 0x4b7c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x01ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x115c, 0x4c97, 0x24fa, 0x0000, 0x0000, 0x0000, 0x473d,
+	    0x0000, 0x34ab, 0x21fd, 0x2be0, 0x323e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x049a, 0x0000, 0x1698, 0x3140,
+	    0x1217, 0x0000, 0x251c, 0x4df4, 0x0000, 0x19fb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3ded, 0x2029, 0x271f, 0x2846, 0x420a, 0x4345,
+	    0x0eb0, 0x0000, 0x1fc5, 0x0000, 0x0000, 0x22ee, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2cff, 0x0000, 0x0000, 0x1b80, 0x4515, 0x00c0,
+	    0x0000, 0x0a08, 0x1abc, 0x0000, 0x0000, 0x1edc, 0x0000, 0x0000,
+	    0x0000, 0x20df, 0x0000, 0x3310, 0x2ed1, 0x0099, 0x2ddf, 0x4c8b,
+	    0x1c21, 0x1390, 0x0000, 0x13bd, 0x38b4, 0x3581, 0x2ae4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x44b6, 0x41d3, 0x48e7, 0x0000, 0x2625,
+	    0x3308, 0x46e6, 0x43e6, 0x0000, 0x0ff3, 0x0000, 0x0000, 0x070c,
+	    0x0000, 0x27dd, 0x180c, 0x0000, 0x0000, 0x20c7, 0x1081, 0x0000,
+	    0x1c4f, 0x2193, 0x0000, 0x325b, 0x4b48, 0x2e7f, 0x2730, 0x0000,
+	    0x3ae2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7c, 0x24d6,
+	    0x44e9, 0x38b0, 0x0863, 0x0000, 0x0000, 0x0000, 0x18b1, 0x425b,
+	    0x0000, 0x0000, 0x3d0d, 0x447e, 0x0000, 0x2276, 0x0889, 0x2d58,
+	    0x0000, 0x4b7c, 0x1a26, 0x0000, 0x0000, 0x3f99, 0x31f5, 0x314d,
+	    0x0f19, 0x0000, 0x0000, 0x1fd2, 0x0000, 0x07b5, 0x39c8, 0x3ea4,
+	    0x4e1e, 0x221a, 0x0000, 0x20ef, 0x4c69, 0x0507, 0x0f13, 0x0000,
+	    0x299e, 0x252a, 0x0000, 0x0f93, 0x1bec, 0x4880, 0x42d2, 0x06bf,
+	    0x1949, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1822,
+	    0x0000, 0x09b9, 0x0000, 0x0000, 0x0000, 0x3bbf, 0x0000, 0x2192,
+	    0x1650, 0x0985, 0x0000, 0x1718, 0x0000, 0x0000, 0x46e0, 0x3f23,
+	    0x0000, 0x0000, 0x3f29, 0x0000, 0x476f, 0x03af, 0x283f, 0x4bf3,
+	    0x0761, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c58, 0x0000, 0x1777,
+	    0x0f38, 0x0000, 0x0000, 0x372b, 0x0342, 0x0000, 0x0000, 0x0000,
+	    0x4dfe, 0x0000, 0x0374, 0x3268, 0x0000, 0x0000, 0x0000, 0x45eb,
+	    0x0000, 0x262a, 0x0000, 0x2d0d, 0x0000, 0x42d9, 0x0000, 0x35ca,
+	    0x0000, 0x102f, 0x0570, 0x26e5, 0x0000, 0x2fe6, 0x439b, 0x0f2c,
+	    0x1226, 0x2369, 0x0000, 0x0000, 0x0000, 0x1de1, 0x0000, 0x469a,
+	    0x0000, 0x2382, 0x0000, 0x0000, 0x082b, 0x2ecf, 0x04bf, 0x3bf0,
+	    0x4c55, 0x0000, 0x0000, 0x040a, 0x0000, 0x0000, 0x279e, 0x24a8,
+	    0x2400, 0x0000, 0x0000, 0x1719, 0x0484, 0x0000, 0x4055, 0x4ce1,
+	    0x487c, 0x0000, 0x46a8, 0x0000, 0x03b5, 0x074c, 0x2f59, 0x4711,
+	    0x4de4, 0x0000, 0x0fa1, 0x4957, 0x0000, 0x4122, 0x3565, 0x14ab,
+	    0x2059, 0x0000, 0x0000, 0x1d96, 0x4070, 0x0000, 0x0000, 0x432c,
+	    0x0000, 0x0000, 0x0000, 0x4487, 0x199b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0b0f, 0x0000, 0x0000, 0x25ae, 0x0504, 0x4804, 0x0000,
+	    0x25e8, 0x3442, 0x0da2, 0x1c19, 0x1e6c, 0x3b09, 0x2891, 0x30c8,
+	    0x0000, 0x0000, 0x2af0, 0x0255, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3f90, 0x3757, 0x142c, 0x0000, 0x15e4, 0x0000,
+	    0x0de4, 0x0000, 0x0000, 0x444b, 0x0000, 0x26e6, 0x0000, 0x491b,
+	    0x0000, 0x0e99, 0x1050, 0x3f52, 0x1cf0, 0x3925, 0x27d6, 0x15ce,
+	    0x0d47, 0x230b, 0x0000, 0x3b4c, 0x1b25, 0x0000, 0x4b87, 0x3009,
+	    0x071a, 0x159d, 0x4262, 0x0d5d, 0x0000, 0x3f30, 0x2103, 0x18f2,
+	    0x217b, 0x4244, 0x1997, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1892, 0x0000, 0x0000, 0x1da8, 0x1d20,
+	    0x0000, 0x127e, 0x0000, 0x10d0, 0x0000, 0x3454, 0x1c11, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2675, 0x0000, 0x19ed, 0x0000,
+	    0x0671, 0x39ac, 0x0000, 0x28a3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4cb1, 0x0dc8, 0x0000, 0x0000, 0x0000, 0x0000, 0x4da5,
+	    0x14c8, 0x396e, 0x0136, 0x0000, 0x1f17, 0x2ae6, 0x4a84, 0x0000,
+	    0x0c69, 0x3ce3, 0x4d7c, 0x0140, 0x3e5e, 0x0bf7, 0x0b4d, 0x0000,
+	    0x0000, 0x0000, 0x37d6, 0x2491, 0x0000, 0x040c, 0x41c8, 0x1a5c,
+	    0x0000, 0x0000, 0x0c82, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ff4,
+	    0x1b81, 0x0000, 0x237e, 0x000a, 0x42b3, 0x0000, 0x0000, 0x444f,
+	    0x0000, 0x3148, 0x1548, 0x3c57, 0x3062, 0x0000, 0x0000, 0x0000,
+	    0x23f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f69, 0x0000, 0x0000,
+	    0x3c8a, 0x0000, 0x19ba, 0x0000, 0x0000, 0x020a, 0x0000, 0x4b45,
+	    0x01ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x3dd8, 0x27b7, 0x0000,
+	    0x4802, 0x0891, 0x213c, 0x20d7, 0x1416, 0x04ff, 0x24ad, 0x1255,
+	    0x37ad, 0x36ab, 0x0000, 0x0000, 0x00b9, 0x38b7, 0x3307, 0x0000,
+	    0x14bf, 0x4801, 0x0d61, 0x48b6, 0x32c4, 0x0000, 0x1cf6, 0x2455,
+	    0x0000, 0x3b47, 0x0000, 0x0000, 0x1971, 0x4bf1, 0x0000, 0x0000,
+	    0x0000, 0x0bd1, 0x43a6, 0x0000, 0x0000, 0x425d, 0x0000, 0x0000,
+	    0x24bb, 0x0878, 0x0000, 0x4333, 0x4b8e, 0x0000, 0x3ded, 0x38be,
+	    0x311a, 0x03d9, 0x12cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x3850,
+	    0x3174, 0x0000, 0x000d, 0x13e6, 0x1093, 0x3a0f, 0x0000, 0x3869,
+	    0x0390, 0x1811, 0x0000, 0x0000, 0x1464, 0x45b8, 0x4c79, 0x3244,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x093e, 0x40ca, 0x0000, 0x0000,
+	    0x0000, 0x23d5, 0x4061, 0x0000, 0x0000, 0x039f, 0x103d, 0x0000,
+	    0x0000, 0x49e7, 0x2d0b, 0x1db7, 0x38a2, 0x2469, 0x0000, 0x0000,
+	    0x4937, 0x0000, 0x0728, 0x0000, 0x1110, 0x0512, 0x0000, 0x258f,
+	    0x0000, 0x0000, 0x2b70, 0x4995, 0x2a8f, 0x1f9b, 0x0000, 0x0000,
+	    0x0000, 0x3827, 0x0000, 0x0000, 0x2bba, 0x0000, 0x2e01, 0x0000,
+	    0x0000, 0x1f54, 0x4003, 0x0000, 0x1de5, 0x0000, 0x1681, 0x0000,
+	    0x0000, 0x0000, 0x1545, 0x0000, 0x3e89, 0x0000, 0x3272, 0x455a,
+	    0x0000, 0x0000, 0x4be6, 0x0000, 0x13ce, 0x0000, 0x381b, 0x0000,
+	    0x0cce, 0x1f8b, 0x352c, 0x0e49, 0x0000, 0x0000, 0x0000, 0x1be8,
+	    0x25b6, 0x3eb9, 0x0000, 0x1f51, 0x0000, 0x0000, 0x130e, 0x2ec0,
+	    0x0000, 0x1bc4, 0x0000, 0x0000, 0x2bee, 0x2da5, 0x1d76, 0x4291,
+	    0x0000, 0x0000, 0x0000, 0x0cb9, 0x0000, 0x2d20, 0x42ff, 0x3894,
+	    0x054c, 0x0000, 0x2309, 0x0000, 0x0000, 0x0000, 0x48f7, 0x0000,
+	    0x0000, 0x0a07, 0x0e57, 0x42c9, 0x4b6e, 0x275a, 0x0ed8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x10c7, 0x0c51, 0x1540, 0x0000, 0x0000,
+	    0x3431, 0x29a3, 0x0000, 0x0000, 0x0000, 0x0979, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0ed9, 0x389b, 0x4bb9, 0x0fa0, 0x0000, 0x1566,
+	    0x1e92, 0x1638, 0x0000, 0x0000, 0x0000, 0x0031, 0x0000, 0x1d8f,
+	    0x14f2, 0x1255, 0x0000, 0x2949, 0x1e7d, 0x0000, 0x1c40, 0x0d86,
+	    0x0fd1, 0x1261, 0x0000, 0x444e, 0x3d6e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0e6f, 0x0000, 0x0000, 0x0000, 0x0a91, 0x44b8, 0x4b14,
+	    0x3539, 0x4ded, 0x468b, 0x474d, 0x0000, 0x0000, 0x3cbe, 0x1933,
+	    0x4586, 0x238e, 0x0000, 0x1440, 0x0000, 0x3fd9, 0x4a52, 0x0000,
+	    0x19a5, 0x2775, 0x2983, 0x0000, 0x4cf0, 0x123f, 0x1a97, 0x2052,
+	    0x13f5, 0x330e, 0x0000, 0x3ccc, 0x04d4, 0x0000, 0x3bac, 0x0000,
+	    0x0000, 0x0296, 0x4d7b, 0x24c7, 0x0000, 0x055d, 0x0000, 0x49d2,
+	    0x0000, 0x2169, 0x4555, 0x0000, 0x076c, 0x0000, 0x1cee, 0x0000,
+	    0x33dc, 0x0c10, 0x34a7, 0x41f5, 0x0000, 0x1ffa, 0x36f8, 0x0000,
+	    0x4c10, 0x0000, 0x38e3, 0x0000, 0x351f, 0x0000, 0x1f4c, 0x0213,
+	    0x0000, 0x4b5e, 0x0608, 0x1025, 0x476b, 0x0000, 0x3530, 0x0000,
+	    0x3d2e, 0x0000, 0x4d8c, 0x18dc, 0x0000, 0x0853, 0x0e6a, 0x3e4b,
+	    0x4774, 0x1ed5, 0x0000, 0x38e1, 0x0000, 0x0000, 0x3711, 0x255f,
+	    0x2c56, 0x0000, 0x184a, 0x0000, 0x3444, 0x31b5, 0x2128, 0x12b0,
+	    0x460b, 0x434f, 0x10a0, 0x0000, 0x335d, 0x28b7, 0x0c97, 0x45aa,
+	    0x0000, 0x2d84, 0x244e, 0x2b34, 0x4b21, 0x41d4, 0x0000, 0x4c55,
+	    0x0000, 0x0035, 0x0000, 0x0000, 0x0000, 0x13c5, 0x0000, 0x39dc,
+	    0x1fab, 0x0000, 0x28e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x2082,
+	    0x0b64, 0x0329, 0x0000, 0x2fdc, 0x0000, 0x0000, 0x279f, 0x2e24,
+	    0x15c9, 0x3343, 0x17c4, 0x4901, 0x368c, 0x40d9, 0x1c52, 0x0067,
+	    0x1bda, 0x1677, 0x0000, 0x267f, 0x0cf6, 0x26bd, 0x1e5a, 0x0000,
+	    0x4045, 0x0000, 0x2d3d, 0x3b11, 0x0000, 0x3b33, 0x239e, 0x04e8,
+	    0x2265, 0x0000, 0x1433, 0x01bd, 0x3fad, 0x122f, 0x0000, 0x0000,
+	    0x0000, 0x48d5, 0x4c18, 0x0000, 0x213a, 0x0000, 0x3787, 0x0000,
+	    0x10c2, 0x1b57, 0x006e, 0x0000, 0x305b, 0x18c9, 0x4600, 0x0000,
+	    0x464e, 0x18e7, 0x203a, 0x0000, 0x0000, 0x4629, 0x2e4b, 0x0000,
+	    0x0000, 0x1a06, 0x03ce, 0x0000, 0x0000, 0x35ab, 0x4444, 0x0000,
+	    0x1121, 0x0c58, 0x0000, 0x0d4d, 0x0a2f, 0x1739, 0x2e88, 0x2a14,
+	    0x0000, 0x0cd8, 0x0000, 0x0000, 0x21eb, 0x0000, 0x20cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4c16, 0x1abc, 0x0000, 0x46ee, 0x0000,
+	    0x3ce4, 0x009d, 0x1df2, 0x1744, 0x3a24, 0x14d0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0634, 0x04a6, 0x4617, 0x468e, 0x0b83, 0x0000,
+	    0x3515, 0x0000, 0x4ddc, 0x0000, 0x44b8, 0x0000, 0x0000, 0x0000,
+	    0x1ec2, 0x4bc0, 0x4ac3, 0x1577, 0x0000, 0x0000, 0x0000, 0x139e,
+	    0x0000, 0x1d6b, 0x1056, 0x1bfc, 0x0000, 0x0000, 0x3803, 0x494c,
+	    0x32c3, 0x1aaa, 0x3295, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x159b, 0x0a96, 0x1292, 0x262a, 0x4419, 0x234c, 0x0789,
+	    0x46f1, 0x0000, 0x1737, 0x0000, 0x3941, 0x10b6, 0x300b, 0x0000,
+	    0x1af0, 0x0000, 0x317b, 0x40cd, 0x21f4, 0x0000, 0x1824, 0x0000,
+	    0x0036, 0x0000, 0x4560, 0x0000, 0x3b19, 0x04d6, 0x32c2, 0x37bb,
+	    0x0637, 0x0000, 0x0000, 0x1711, 0x0ae6, 0x0000, 0x0864, 0x0000,
+	    0x4cf9, 0x2216, 0x0000, 0x0000, 0x089a, 0x0000, 0x0000, 0x1715,
+	    0x0000, 0x0000, 0x1517, 0x2609, 0x18ad, 0x2082, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x27ab, 0x07de, 0x0cdd, 0x1519, 0x35de, 0x3ca4, 0x0000, 0x0000,
+	    0x0000, 0x2706, 0x0000, 0x3e73, 0x0000, 0x0000, 0x3f87, 0x3532,
+	    0x2775, 0x0000, 0x0000, 0x189e, 0x2ec4, 0x0000, 0x0000, 0x0000,
+	    0x35e7, 0x3c30, 0x0000, 0x2996, 0x0000, 0x3243, 0x0000, 0x0000,
+	    0x0b7d, 0x0f85, 0x11ed, 0x0aad, 0x0000, 0x0b08, 0x3eb1, 0x0000,
+	    0x0000, 0x0000, 0x3de5, 0x4c46, 0x349e, 0x0000, 0x0000, 0x2a95,
+	    0x215b, 0x121c, 0x0bfe, 0x0b7e, 0x33cd, 0x2396, 0x0000, 0x4971,
+	    0x0000, 0x12a4, 0x20bc, 0x364a, 0x28dc, 0x0000, 0x12bb, 0x0000,
+	    0x33e5, 0x0000, 0x1fdd, 0x0925, 0x17c0, 0x0000, 0x0000, 0x20cf,
+	    0x31f8, 0x4129, 0x0000, 0x3336, 0x01f7, 0x3a41, 0x0000, 0x49a0,
+	    0x4239, 0x339d, 0x0f25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1a82, 0x0add, 0x4932, 0x0000, 0x0000, 0x0046, 0x11f5, 0x0000,
+	    0x2f26, 0x108b, 0x0000, 0x4256, 0x0000, 0x29c8, 0x0df9, 0x2946,
+	    0x24c7, 0x0000, 0x0000, 0x0000, 0x3b5c, 0x0000, 0x2599, 0x0000,
+	    0x1ded, 0x0000, 0x0000, 0x044b, 0x1f29, 0x0000, 0x1f3e, 0x0000,
+	    0x0000, 0x100b, 0x0000, 0x0000, 0x1994, 0x0a3d, 0x0000, 0x0000,
+	    0x0cbe, 0x0000, 0x4b2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x298f,
+	    0x0000, 0x263c, 0x3927, 0x1b29, 0x2fd4, 0x21e4, 0x0000, 0x0000,
+	    0x38ff, 0x0387, 0x0000, 0x31cf, 0x0000, 0x0000, 0x0000, 0x405d,
+	    0x0000, 0x08ae, 0x2556, 0x0000, 0x0000, 0x3ed4, 0x0000, 0x29e7,
+	    0x4573, 0x460f, 0x0000, 0x2c0f, 0x31b8, 0x0fa2, 0x0000, 0x0000,
+	    0x008a, 0x48bc, 0x3b21, 0x35f5, 0x0000, 0x02bc, 0x274e, 0x0000,
+	    0x0000, 0x1565, 0x0000, 0x2279, 0x1850, 0x0000, 0x4ce1, 0x3ed7,
+	    0x0000, 0x40c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x20a2, 0x1bf9,
+	    0x1cfe, 0x0000, 0x047d, 0x0000, 0x0000, 0x4bcb, 0x021f, 0x0000,
+	    0x27b3, 0x0000, 0x0000, 0x3add, 0x4aaa, 0x0000, 0x0000, 0x0000,
+	    0x4512, 0x28ed, 0x0000, 0x37e4, 0x0000, 0x145a, 0x3e2a, 0x0000,
+	    0x308d, 0x465d, 0x29d1, 0x0000, 0x0000, 0x0498, 0x0000, 0x0000,
+	    0x1484, 0x0000, 0x0938, 0x0000, 0x0000, 0x35db, 0x4145, 0x0000,
+	    0x2907, 0x0000, 0x0000, 0x28ff, 0x0000, 0x2d99, 0x1972, 0x0444,
+	    0x0000, 0x0000, 0x189a, 0x0000, 0x21de, 0x4ad0, 0x4925, 0x12d8,
+	    0x22c7, 0x4493, 0x1195, 0x0000, 0x019e, 0x0000, 0x071f, 0x0000,
+	    0x2776, 0x34a4, 0x079e, 0x3987, 0x09f0, 0x0000, 0x0000, 0x2be0,
+	    0x0000, 0x0000, 0x0000, 0x0b2c, 0x344e, 0x0000, 0x0049, 0x0000,
+	    0x0000, 0x0883, 0x0000, 0x13c9, 0x0000, 0x35da, 0x3357, 0x0000,
+	    0x4591, 0x0000, 0x2766, 0x34b5, 0x0846, 0x0000, 0x0000, 0x0000,
+	    0x46c3, 0x095d, 0x0000, 0x22e9, 0x4039, 0x1018, 0x233f, 0x3fc4,
+	    0x0000, 0x2155, 0x0000, 0x1fa5, 0x05ef, 0x0000, 0x0000, 0x0000,
+	    0x1ac3, 0x3829, 0x1e1a, 0x0000, 0x0000, 0x3759, 0x0000, 0x0000,
+	    0x3326, 0x2be8, 0x06d9, 0x4da4, 0x0759, 0x3291, 0x09a6, 0x0690,
+	    0x3ebc, 0x4cdb, 0x0e16, 0x3075, 0x0000, 0x0000, 0x0000, 0x4c0f,
+	    0x22fa, 0x0000, 0x3c44, 0x1086, 0x2898, 0x0000, 0x0000, 0x0000,
+	    0x0c3b, 0x32c1, 0x251b, 0x0000, 0x0000, 0x0000, 0x2fa1, 0x0000,
+	    0x2286, 0x0000, 0x0000, 0x0000, 0x358d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4490, 0x0000, 0x0000, 0x3756, 0x0000,
+	    0x0000, 0x0000, 0x3bc6, 0x04df, 0x3da5, 0x01ab, 0x15cc, 0x2dd7,
+	    0x0000, 0x27d1, 0x0000, 0x0000, 0x0000, 0x3e27, 0x0487, 0x0000,
+	    0x20fe, 0x4180, 0x0000, 0x0000, 0x28b8, 0x0000, 0x2715, 0x430e,
+	    0x35a8, 0x0000, 0x3d82, 0x050a, 0x0000, 0x3048, 0x0000, 0x28f5,
+	    0x0000, 0x15e3, 0x227a, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e53,
+	    0x0000, 0x3912, 0x3d65, 0x26e2, 0x0000, 0x019a, 0x0938, 0x20de,
+	    0x45e6, 0x08fd, 0x0000, 0x0000, 0x0000, 0x4a56, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x218b, 0x2eee, 0x07cf, 0x40f1, 0x0000,
+	    0x0000, 0x1d6f, 0x3e9c, 0x4636, 0x04a2, 0x1003, 0x131a, 0x34fc,
+	    0x1c46, 0x103d, 0x0000, 0x4a98, 0x0000, 0x1eaf, 0x0000, 0x164f,
+	    0x0000, 0x3be9, 0x10e3, 0x3335, 0x0000, 0x46f6, 0x39c1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4b31, 0x0000, 0x3b28, 0x3373,
+	    0x0000, 0x49e9, 0x048d, 0x2cfb, 0x24e7, 0x40e2, 0x2926, 0x0000,
+	    0x0000, 0x361f, 0x473e, 0x3f9b, 0x0000, 0x1671, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04aa, 0x49cc, 0x0000, 0x0000, 0x0000,
+	    0x3a6f, 0x224a, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f70, 0x3420,
+	    0x34d9, 0x0000, 0x3716, 0x2a8d, 0x4a82, 0x4d7b, 0x0afb, 0x4120,
+	    0x0000, 0x254f, 0x0000, 0x2725, 0x3664, 0x0000, 0x09a7, 0x0000,
+	    0x2531, 0x3b0c, 0x0000, 0x237e, 0x2e25, 0x3473, 0x0da3, 0x4313,
+	    0x0000, 0x077b, 0x1121, 0x40d9, 0x0000, 0x0000, 0x456e, 0x1a6a,
+	    0x2838, 0x0000, 0x1c27, 0x3dff, 0x1f59, 0x1b52, 0x0000, 0x3d67,
+	    0x0000, 0x2554, 0x0d40, 0x0000, 0x0000, 0x140f, 0x0d44, 0x0000,
+	    0x308f, 0x0000, 0x29b5, 0x0000, 0x286d, 0x3a39, 0x0000, 0x481f,
+	    0x0000, 0x2be0, 0x11e7, 0x1477, 0x0000, 0x12f6, 0x0000, 0x22a9,
+	    0x3c8f, 0x1ca3, 0x3ae4, 0x0000, 0x22c3, 0x43c0, 0x4dfe, 0x0000,
+	    0x2e92, 0x1544, 0x17f0, 0x47f5, 0x2204, 0x1db8, 0x0420, 0x235f,
+	    0x0000, 0x2f4e, 0x0000, 0x0000, 0x2542, 0x0000, 0x43ea, 0x39f4,
+	    0x0000, 0x4867, 0x4d9d, 0x0000, 0x1324, 0x0c11, 0x0000, 0x2305,
+	    0x49ad, 0x331d, 0x0000, 0x2782, 0x40d0, 0x05bf, 0x0000, 0x3a1c,
+	    0x0000, 0x0000, 0x28ce, 0x0000, 0x30eb, 0x2b15, 0x0000, 0x1d75,
+	    0x0000, 0x0000, 0x0000, 0x15c4, 0x0000, 0x4cf7, 0x1fe7, 0x2ad9,
+	    0x0000, 0x11aa, 0x0000, 0x1aaa, 0x0000, 0x2b9c, 0x0676, 0x0000,
+	    0x1a69, 0x0000, 0x1c35, 0x0000, 0x0000, 0x34ef, 0x12a4, 0x4d4a,
+	    0x367d, 0x48c4, 0x204c, 0x0000, 0x38ac, 0x1f5e, 0x4981, 0x0000,
+	    0x2e59, 0x1912, 0x0000, 0x3abc, 0x0000, 0x4c1d, 0x0ce8, 0x0000,
+	    0x39f0, 0x0000, 0x4b87, 0x26a8, 0x0000, 0x0000, 0x0a0c, 0x1aaa,
+	    0x0000, 0x0a11, 0x0000, 0x0000, 0x2a19, 0x0000, 0x3481, 0x1cc7,
+	    0x0000, 0x0000, 0x0000, 0x01ee, 0x4361, 0x0000, 0x0000, 0x3a34,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4151, 0x0000, 0x40f2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x115e, 0x0000, 0x0000, 0x0000, 0x3bf7,
+	    0x3d75, 0x17a2, 0x1628, 0x0000, 0x0000, 0x4db9, 0x1fdf, 0x0000,
+	    0x0000, 0x3996, 0x069b, 0x3020, 0x0000, 0x0227, 0x0000, 0x4ccc,
+	    0x2dac, 0x39e3, 0x2f18, 0x1acf, 0x0000, 0x35cb, 0x32d4, 0x0000,
+	    0x0000, 0x09c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x390c, 0x18bf,
+	    0x3b7e, 0x28fa, 0x3fbf, 0x0000, 0x36fb, 0x1915, 0x0000, 0x2963,
+	    0x2063, 0x2af5, 0x4669, 0x0000, 0x145e, 0x0000, 0x145f, 0x0000,
+	    0x1add, 0x203b, 0x3de8, 0x2546, 0x4730, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2190, 0x0000, 0x43aa, 0x0000, 0x0000, 0x0000,
+	    0x2498, 0x4625, 0x0000, 0x07a4, 0x45b0, 0x17c7, 0x4cf3, 0x0000,
+	    0x22dc, 0x1e4b, 0x0000, 0x1ed5, 0x477c, 0x0000, 0x0000, 0x449d,
+	    0x0000, 0x0000, 0x339d, 0x0000, 0x0000, 0x051c, 0x0000, 0x4aa6,
+	    0x0000, 0x0000, 0x1dbe, 0x25ed, 0x4995, 0x4be7, 0x2cdb, 0x18b7,
+	    0x1c63, 0x3eaf, 0x33e0, 0x0000, 0x3dc9, 0x37a7, 0x0cfc, 0x4408,
+	    0x0000, 0x14e8, 0x4406, 0x0000, 0x0c1e, 0x35cb, 0x306d, 0x3059,
+	    0x43e5, 0x3ebf, 0x0000, 0x0000, 0x03f7, 0x10d1, 0x0000, 0x0000,
+	    0x0000, 0x09e6, 0x0000, 0x47c4, 0x0000, 0x41c4, 0x094f, 0x0000,
+	    0x358b, 0x1cad, 0x24d4, 0x0000, 0x16e2, 0x2440, 0x11d6, 0x1470,
+	    0x244c, 0x3509, 0x3f32, 0x3c13, 0x0000, 0x456d, 0x3112, 0x3608,
+	    0x06be, 0x0000, 0x0000, 0x2caa, 0x0000, 0x0000, 0x4088, 0x4a89,
+	    0x3fa2, 0x0000, 0x0000, 0x0000, 0x0000, 0x440f, 0x0000, 0x0b2d,
+	    0x1958, 0x0000, 0x0000, 0x0000, 0x0000, 0x4577, 0x4c73, 0x2535,
+	    0x337b, 0x0000, 0x01ff, 0x3d76, 0x2b3d, 0x0000, 0x0000, 0x0000,
+	    0x4bd4, 0x0000, 0x0000, 0x4d22, 0x0000, 0x41e1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x05c2, 0x0000, 0x007b, 0x2a14, 0x0000, 0x0000,
+	    0x454b, 0x13b9, 0x0026, 0x0860, 0x0000, 0x0000, 0x1fc2, 0x1a25,
+	    0x1183, 0x0e03, 0x3393, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1735, 0x0000, 0x401e, 0x24a1, 0x4968, 0x0000, 0x0e98,
+	    0x0000, 0x1b13, 0x0000, 0x0000, 0x1f1b, 0x0753, 0x4b9b, 0x432c,
+	    0x315c, 0x3fb8, 0x076f, 0x42f2, 0x0000, 0x0000, 0x4db8, 0x1e2b,
+	    0x0000, 0x1d7c, 0x0ebf, 0x2f21, 0x2d0e, 0x3f37, 0x020f, 0x08ea,
+	    0x4ab3, 0x0000, 0x4812, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x15ea, 0x0000, 0x007c, 0x44ce, 0x0000, 0x334c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2988, 0x0332, 0x0b48, 0x0000, 0x1e48, 0x0e56,
+	    0x256a, 0x0000, 0x0000, 0x24e7, 0x1050, 0x1207, 0x3fed, 0x0000,
+	    0x0000, 0x0000, 0x1ddc, 0x3981, 0x3ade, 0x26ed, 0x4399, 0x0000,
+	    0x0000, 0x277b, 0x0000, 0x0000, 0x30b0, 0x0000, 0x223c, 0x0000,
+	    0x4921, 0x0000, 0x0000, 0x30db, 0x13e0, 0x183d, 0x1923, 0x0000,
+	    0x0000, 0x3511, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b22, 0x2efc,
+	    0x0000, 0x10bb, 0x0adb, 0x4c61, 0x3b06, 0x37fe, 0x1321, 0x4486,
+	    0x0000, 0x1b13, 0x42a3, 0x2c23, 0x0000, 0x0000, 0x30d3, 0x0000,
+	    0x07e6, 0x250f, 0x03b6, 0x0000, 0x040f, 0x1eaf, 0x0d34, 0x0000,
+	    0x2278, 0x0000, 0x1379, 0x0e4d, 0x0e52, 0x23c2, 0x0000, 0x403d,
+	    0x0187, 0x1a71, 0x0000, 0x0d95, 0x4ab2, 0x3a5e, 0x0000, 0x0000,
+	    0x4917, 0x384d, 0x1bbe, 0x0000, 0x4210, 0x0000, 0x3b2c, 0x3dea,
+	    0x0000, 0x4190, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0e0d, 0x12c2, 0x22fb, 0x4304, 0x0000, 0x3fa3, 0x377d,
+	    0x2509, 0x0000, 0x0000, 0x17d5, 0x2bb9, 0x469c, 0x0000, 0x1b9f,
+	    0x0000, 0x0000, 0x490b, 0x3e3b, 0x388d, 0x43d8, 0x25eb, 0x0000,
+	    0x09b8, 0x4cb1, 0x0000, 0x3574, 0x4ade, 0x0000, 0x0000, 0x0000,
+	    0x0e4b, 0x3bd9, 0x34df, 0x09cc, 0x366d, 0x1591, 0x0000, 0x253c,
+	    0x056f, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c65, 0x0000, 0x0000,
+	    0x05ad, 0x3d3f, 0x3984, 0x0000, 0x08d5, 0x0000, 0x0859, 0x0000,
+	    0x042c, 0x0000, 0x04af, 0x192a, 0x0000, 0x0000, 0x0954, 0x0000,
+	    0x0000, 0x27c1, 0x0c36, 0x006f, 0x374a, 0x07f0, 0x1d94, 0x3df3,
+	    0x0000, 0x224f, 0x0000, 0x30ae, 0x3c07, 0x0000, 0x042c, 0x0000,
+	    0x1af0, 0x0000, 0x0000, 0x2f32, 0x15bd, 0x2d32, 0x3f67, 0x3fa8,
+	    0x1430, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c69, 0x0000, 0x0000,
+	    0x34ac, 0x0000, 0x0000, 0x15d8, 0x0000, 0x0000, 0x0000, 0x2d2e,
+	    0x4925, 0x0000, 0x0000, 0x0000, 0x40dd, 0x423b, 0x0000, 0x0000,
+	    0x1528, 0x0000, 0x0000, 0x2901, 0x1435, 0x0000, 0x47a2, 0x2662,
+	    0x3f39, 0x0000, 0x1fcc, 0x1c24, 0x3160, 0x4d03, 0x0e83, 0x0000,
+	    0x0000, 0x2f0b, 0x0000, 0x1a57, 0x0000, 0x0000, 0x109a, 0x1cfb,
+	    0x4401, 0x0000, 0x0000, 0x1831, 0x12f2, 0x0000, 0x3266, 0x3fd3,
+	    0x2df0, 0x0b66, 0x0000, 0x1053, 0x16a3, 0x0cce, 0x2fc7, 0x1bd1,
+	    0x3b75, 0x0000, 0x4745, 0x0000, 0x0000, 0x1647, 0x2215, 0x219f,
+	    0x06f6, 0x4886, 0x0000, 0x1525, 0x0000, 0x0000, 0x0000, 0x2642,
+	    0x1cc7, 0x0000, 0x3c43, 0x0000, 0x0000, 0x0000, 0x0000, 0x46bf,
+	    0x1046, 0x023b, 0x0000, 0x20b5, 0x3be1, 0x0000, 0x11f9, 0x0000,
+	    0x0000, 0x0249, 0x2b05, 0x0000, 0x0000, 0x0000, 0x2733, 0x0000,
+	    0x1c80, 0x4e19, 0x1d67, 0x1ce6, 0x052f, 0x4c75, 0x060b, 0x21b6,
+	    0x404a, 0x3a14, 0x0000, 0x3e6d, 0x1c26, 0x3ab5, 0x2ede, 0x1a35,
+	    0x2fae, 0x0000, 0x48e7, 0x04cb, 0x3d19, 0x0000, 0x0000, 0x0000,
+	    0x49c3, 0x07b3, 0x0000, 0x18a9, 0x0000, 0x29f9, 0x0000, 0x2f25,
+	    0x2e50, 0x2234, 0x3d86, 0x0000, 0x0000, 0x0000, 0x3638, 0x37a9,
+	    0x0000, 0x45be, 0x0000, 0x4bdf, 0x1ee4, 0x0000, 0x291e, 0x22f4,
+	    0x0000, 0x0000, 0x1f0e, 0x318a, 0x2f5d, 0x3163, 0x0000, 0x0000,
+	    0x1e34, 0x3287, 0x35ce, 0x082f, 0x4147, 0x07a4, 0x2e23, 0x0000,
+	    0x2254, 0x0000, 0x03a2, 0x34f8, 0x2ccf, 0x4b67, 0x1fd9, 0x0000,
+	    0x3d91, 0x0000, 0x0000, 0x2bea, 0x437b, 0x116e, 0x0000, 0x0000,
+	    0x0f18, 0x0000, 0x2ae7, 0x4923, 0x0000, 0x4740, 0x0000, 0x0000,
+	    0x0114, 0x152f, 0x37a9, 0x3c94, 0x319b, 0x1d3a, 0x278a, 0x45bf,
+	    0x3284, 0x004a, 0x0000, 0x19cd, 0x2d24, 0x4091, 0x3a60, 0x47b1,
+	    0x12ea, 0x4dfc, 0x0000, 0x12ba, 0x3faa, 0x3273, 0x0893, 0x0000,
+	    0x0000, 0x08e1, 0x0e7a, 0x3613, 0x0000, 0x228d, 0x0000, 0x2900,
+	    0x0000, 0x31b8, 0x23d8, 0x0000, 0x0000, 0x0000, 0x103a, 0x0c92,
+	    0x49d9, 0x1146, 0x0000, 0x22a7, 0x06f4, 0x075c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0dca, 0x10fc, 0x0000, 0x0000, 0x27bb,
+	    0x3e44, 0x0bf5, 0x4416, 0x0000, 0x0115, 0x4744, 0x0000, 0x483d,
+	    0x2555, 0x0000, 0x4dd8, 0x0000, 0x0000, 0x0e73, 0x0000, 0x0000,
+	    0x164b, 0x1a5b, 0x1dcc, 0x0000, 0x1cf3, 0x1c62, 0x1783, 0x3380,
+	    0x3655, 0x0000, 0x0000, 0x1854, 0x0000, 0x3c6d, 0x0000, 0x1db2,
+	    0x0000, 0x0000, 0x1dea, 0x0000, 0x1a69, 0x34dd, 0x0591, 0x3ef9,
+	    0x0000, 0x140a, 0x2d21, 0x3b65, 0x0000, 0x0c17, 0x3671, 0x0000,
+	    0x26e2, 0x14b7, 0x16ca, 0x17a1, 0x00e2, 0x4722, 0x1b28, 0x0000,
+	    0x0000, 0x0000, 0x2cb1, 0x0000, 0x308a, 0x118f, 0x096f, 0x0000,
+	    0x4548, 0x0000, 0x3a31, 0x0000, 0x2f98, 0x18a2, 0x2d48, 0x4934,
+	    0x488f, 0x19a8, 0x0000, 0x2a12, 0x0000, 0x0000, 0x0000, 0x0514,
+	    0x0000, 0x18e5, 0x0000, 0x15f8, 0x0261, 0x3fc7, 0x4cb0, 0x0000,
+	    0x0000, 0x33c6, 0x0000, 0x12cb, 0x3308, 0x42d8, 0x0000, 0x32f8,
+	    0x0000, 0x0ce2, 0x354a, 0x0000, 0x1054, 0x0149, 0x2672, 0x0000,
+	    0x34d4, 0x0582, 0x2618, 0x1476, 0x041e, 0x0175, 0x26cc, 0x15f1,
+	    0x32b0, 0x335e, 0x0000, 0x0000, 0x0000, 0x0000, 0x01df, 0x0000,
+	    0x0000, 0x39a1, 0x1299, 0x0000, 0x20e4, 0x2d3e, 0x0000, 0x0000,
+	    0x22c1, 0x2096, 0x0000, 0x2e1b, 0x1b02, 0x0000, 0x0000, 0x4bd1,
+	    0x3d80, 0x0000, 0x1fbf, 0x4bad, 0x0000, 0x1643, 0x4956, 0x162a,
+	    0x081d, 0x0000, 0x1c8c, 0x060c, 0x2ff6, 0x0000, 0x0000, 0x2fd3,
+	    0x48c1, 0x3256, 0x0282, 0x3fdd, 0x0000, 0x00d2, 0x41da, 0x4076,
+	    0x068c, 0x1f5a, 0x224e, 0x4dc3, 0x0000, 0x0000, 0x0000, 0x43cd,
+	    0x1472, 0x10fc, 0x0000, 0x4878, 0x087b, 0x24fa, 0x0000, 0x150d,
+	    0x2c7e, 0x0000, 0x0a6a, 0x0000, 0x3273, 0x12ff, 0x41c8, 0x0ad2,
+	    0x452a, 0x223c, 0x0000, 0x2549, 0x0000, 0x0000, 0x0000, 0x0528,
+	    0x0c0a, 0x2cf8, 0x0000, 0x1a3e, 0x0000, 0x2d60, 0x2577, 0x436b,
+	    0x2675, 0x3293, 0x3f37, 0x0000, 0x0000, 0x0000, 0x40ef, 0x0000,
+	    0x4d58, 0x0000, 0x0fbd, 0x0000, 0x0000, 0x30dc, 0x2703, 0x43e1,
+	    0x4c70, 0x0000, 0x1a83, 0x0f2f, 0x0000, 0x1bbc, 0x10fe, 0x0000,
+	    0x05f3, 0x4dc8, 0x19b5, 0x414f, 0x0000, 0x3ca3, 0x0b1f, 0x20a2,
+	    0x0000, 0x4981, 0x2360, 0x171e, 0x2041, 0x1c8d, 0x4343, 0x0b6b,
+	    0x0000, 0x2e2b, 0x0000, 0x2d42, 0x3916, 0x0000, 0x4bac, 0x0000,
+	    0x08d4, 0x41a4, 0x0000, 0x4497, 0x0000, 0x279b, 0x1542, 0x2d1a,
+	    0x0000, 0x3322, 0x4d06, 0x0000, 0x0000, 0x395c, 0x0000, 0x12ae,
+	    0x344b, 0x25f4, 0x0000, 0x115b, 0x0740, 0x292f, 0x4a0b, 0x00da,
+	    0x20de, 0x45f2, 0x2cef, 0x4295, 0x4d2c, 0x1357, 0x35cc, 0x0000,
+	    0x402b, 0x242c, 0x0000, 0x0a38, 0x2e0c, 0x18e3, 0x0000, 0x407c,
+	    0x1910, 0x0000, 0x4a14, 0x0000, 0x2c4d, 0x4649, 0x0000, 0x0840,
+	    0x274b, 0x354a, 0x062c, 0x01f1, 0x331c, 0x047c, 0x179b, 0x0000,
+	    0x0000, 0x0000, 0x1b78, 0x1419, 0x0000, 0x0000, 0x0000, 0x3f5d,
+	    0x0f5a, 0x0000, 0x4362, 0x08d0, 0x24c7, 0x3963, 0x373c, 0x48fe,
+	    0x3603, 0x03d9, 0x12b3, 0x0000, 0x4d5f, 0x1c98, 0x3a52, 0x2ecf,
+	    0x36bf, 0x0000, 0x0000, 0x348f, 0x0000, 0x3224, 0x4d21, 0x0000,
+	    0x0459, 0x4b8d, 0x0000, 0x1041, 0x0000, 0x47d0, 0x3706, 0x214a,
+	    0x0c7c, 0x0edf, 0x24b9, 0x3c7a, 0x0000, 0x2f9c, 0x0000, 0x0ce5,
+	    0x3840, 0x1d93, 0x433e, 0x1e9c, 0x475a, 0x1a89, 0x0000, 0x0000,
+	    0x3ba3, 0x21a4, 0x2181, 0x1ba9, 0x18ba, 0x0000, 0x0000, 0x0000,
+	    0x4c9f, 0x335e, 0x3425, 0x2561, 0x3c3d, 0x2e48, 0x0e6d, 0x2796,
+	    0x0986, 0x0000, 0x1d77, 0x0000, 0x0f0e, 0x0000, 0x1903, 0x0000,
+	    0x0000, 0x43c4, 0x0000, 0x39aa, 0x0000, 0x0000, 0x0211, 0x2ca5,
+	    0x25da, 0x31e4, 0x399d, 0x151f, 0x0000, 0x0000, 0x0000, 0x4cf3,
+	    0x0e73, 0x0000, 0x36e2, 0x24d0, 0x11d8, 0x388e, 0x0395, 0x0694,
+	    0x2511, 0x0000, 0x2432, 0x4ac6, 0x0000, 0x0000, 0x0000, 0x1b0f,
+	    0x0000, 0x3100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c00,
+	    0x0000, 0x0000, 0x0776, 0x0000, 0x0821, 0x21ce, 0x07d0, 0x0d86,
+	    0x2441, 0x0000, 0x1b10, 0x2791, 0x32b6, 0x30fa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4781, 0x35a2, 0x0a69, 0x37f1, 0x0000, 0x0000,
+	    0x4904, 0x0000, 0x0dbd, 0x3837, 0x448e, 0x49bd, 0x00c1, 0x208b,
+	    0x0000, 0x3a99, 0x4824, 0x0000, 0x4b77, 0x0000, 0x09df, 0x3d55,
+	    0x0000, 0x24ee, 0x0000, 0x07c5, 0x3c39, 0x177e, 0x0000, 0x0ecf,
+	    0x0000, 0x0000, 0x0000, 0x437c, 0x16be, 0x0579, 0x4b97, 0x106e,
+	    0x2e72, 0x4a52, 0x23e7, 0x29c1, 0x17bd, 0x2aae, 0x0000, 0x4018,
+	    0x3673, 0x0000, 0x0000, 0x04f8, 0x4dca, 0x0000, 0x18f1, 0x4c85,
+	    0x4293, 0x0d9b, 0x0000, 0x1430, 0x0000, 0x0000, 0x0000, 0x403f,
+	    0x1f78, 0x412b, 0x4931, 0x0000, 0x0000, 0x0000, 0x0bc1, 0x02f7,
+	    0x3117, 0x296e, 0x3a9a, 0x1bcf, 0x0dba, 0x0000, 0x42ad, 0x0939,
+	    0x4a49, 0x4938, 0x1f05, 0x350a, 0x3d6e, 0x0000, 0x0000, 0x06cf,
+	    0x316e, 0x11e1, 0x0000, 0x037b, 0x0000, 0x0000, 0x0c3a, 0x0000,
+	    0x102b, 0x3e4f, 0x33bf, 0x0000, 0x2edd, 0x1396, 0x0352, 0x0000,
+	    0x0000, 0x20ce, 0x45d1, 0x0000, 0x2494, 0x0000, 0x33a7, 0x3045,
+	    0x431c, 0x0000, 0x4d88, 0x0000, 0x0fb4, 0x0000, 0x130e, 0x2be5,
+	    0x2b05, 0x2c8c, 0x2767, 0x0000, 0x0804, 0x0000, 0x3bbb, 0x4dcb,
+	    0x0000, 0x24d2, 0x0000, 0x1320, 0x0000, 0x0000, 0x41f2, 0x0000,
+	    0x0566, 0x2112, 0x3ebd, 0x06b0, 0x0000, 0x0000, 0x48c5, 0x4523,
+	    0x1623, 0x0244, 0x0000, 0x072f, 0x0000, 0x2088, 0x0000, 0x0000,
+	    0x33e7, 0x0000, 0x0000, 0x4dfc, 0x1ed7, 0x3a4e, 0x0039, 0x10fd,
+	    0x0000, 0x0000, 0x35a8, 0x0243, 0x0000, 0x33dc, 0x0f9f, 0x0000,
+	    0x4a2f, 0x1056, 0x4382, 0x0000, 0x3a3e, 0x255b, 0x0000, 0x2463,
+	    0x38e9, 0x2693, 0x376c, 0x1b3d, 0x0000, 0x4627, 0x0000, 0x3a61,
+	    0x0000, 0x0000, 0x0000, 0x380b, 0x41e4, 0x0000, 0x1e79, 0x26ab,
+	    0x0000, 0x34a3, 0x0000, 0x1772, 0x0000, 0x3650, 0x3bed, 0x0000,
+	    0x3044, 0x0000, 0x43bc, 0x0f95, 0x2a18, 0x47be, 0x1925, 0x3dd5,
+	    0x2dd8, 0x184e, 0x1e9c, 0x0000, 0x4d64, 0x0000, 0x1bb9, 0x0000,
+	    0x0000, 0x48fd, 0x2792, 0x0000, 0x3fe4, 0x0d53, 0x1fdf, 0x0000,
+	    0x0000, 0x1567, 0x0921, 0x0000, 0x076a, 0x2feb, 0x46c2, 0x0000,
+	    0x0000, 0x0588, 0x0000, 0x2304, 0x1dca, 0x3615, 0x0b89, 0x3d34,
+	    0x0000, 0x3220, 0x34d0, 0x3373, 0x3b36, 0x4de4, 0x398e, 0x47df,
+	    0x0000, 0x3de5, 0x444e, 0x34aa, 0x452e, 0x1bab, 0x0000, 0x0000,
+	    0x0000, 0x3775, 0x0000, 0x0000, 0x0d24, 0x0000, 0x0000, 0x4d09,
+	    0x194a, 0x28ed, 0x4089, 0x09b5, 0x1c59, 0x0000, 0x0000, 0x39b2,
+	    0x0d96, 0x3985, 0x1740, 0x0000, 0x43be, 0x298f, 0x0000, 0x19b2,
+	    0x48a3, 0x2395, 0x0000, 0x2121, 0x3128, 0x0000, 0x0000, 0x4dc2,
+	    0x3996, 0x06fb, 0x2246, 0x0000, 0x0000, 0x0f56, 0x3a10, 0x0000,
+	    0x1d33, 0x0000, 0x3bce, 0x2924, 0x4880, 0x0000, 0x0000, 0x46a2,
+	    0x1131, 0x2dfb, 0x270d, 0x0000, 0x2089, 0x0000, 0x38a6, 0x0000,
+	    0x0000, 0x2b1d, 0x0000, 0x1e46, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02c6, 0x3d45, 0x0000, 0x4b49, 0x3d0f, 0x23db, 0x0f3f, 0x0000,
+	    0x0000, 0x0000, 0x427d, 0x0000, 0x0000, 0x1e5b, 0x0000, 0x217a,
+	    0x2ceb, 0x280b, 0x3f23, 0x28ae, 0x0000, 0x164b, 0x3742, 0x2abc,
+	    0x0000, 0x3d20, 0x2a32, 0x4d4b, 0x0726, 0x0373, 0x1a0b, 0x34bc,
+	    0x1b15, 0x2328, 0x0f48, 0x0000, 0x0000, 0x249b, 0x2cff, 0x0000,
+	    0x0000, 0x0b14, 0x4058, 0x0000, 0x2b69, 0x4415, 0x0000, 0x14bb,
+	    0x0000, 0x12ec, 0x265e, 0x4717, 0x1b8a, 0x1e6f, 0x1eb1, 0x106f,
+	    0x2482, 0x3e97, 0x3cf6, 0x0000, 0x0000, 0x0679, 0x0000, 0x0000,
+	    0x3e5c, 0x0000, 0x193d, 0x38e5, 0x452c, 0x0000, 0x3eb2, 0x0000,
+	    0x356a, 0x05c4, 0x496e, 0x0000, 0x0000, 0x44b1, 0x0000, 0x0000,
+	    0x3be1, 0x2ab0, 0x1a20, 0x0000, 0x0000, 0x0000, 0x023b, 0x0000,
+	    0x2e20, 0x3a1a, 0x1192, 0x17e9, 0x18b5, 0x0000, 0x187d, 0x2c65,
+	    0x0000, 0x0000, 0x2fd0, 0x13ea, 0x2878, 0x0000, 0x17e3, 0x47a5,
+	    0x0000, 0x0000, 0x03c6, 0x2c96, 0x1700, 0x19d5, 0x0000, 0x2b4b,
+	    0x0000, 0x3d52, 0x4230, 0x0000, 0x0000, 0x3993, 0x24df, 0x00ed,
+	    0x20a5, 0x22d1, 0x0fe8, 0x0000, 0x0000, 0x2a1e, 0x4a48, 0x0000,
+	    0x2d09, 0x0000, 0x0d94, 0x0000, 0x09e0, 0x0000, 0x0000, 0x058a,
+	    0x1c84, 0x342f, 0x1781, 0x0000, 0x0000, 0x0000, 0x1a7f, 0x0ce4,
+	    0x0000, 0x43c8, 0x139f, 0x0000, 0x0000, 0x4dcb, 0x0000, 0x0000,
+	    0x0fd9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c7f, 0x0000,
+	    0x3ca5, 0x045a, 0x21bf, 0x393a, 0x160c, 0x23d3, 0x31a7, 0x309d,
+	    0x0000, 0x0000, 0x0efe, 0x01af, 0x0000, 0x2a2d, 0x0711, 0x002c,
+	    0x0000, 0x4035, 0x4c28, 0x0000, 0x3d53, 0x0000, 0x01fa, 0x12a0,
+	    0x1a50, 0x02a7, 0x3752, 0x28ec, 0x0000, 0x185c, 0x0000, 0x0000,
+	    0x2209, 0x0000, 0x406b, 0x0000, 0x0000, 0x0000, 0x0308, 0x1539,
+	    0x0a3e, 0x44d1, 0x0000, 0x4a60, 0x3002, 0x400b, 0x24d9, 0x3b5e,
+	    0x36d2, 0x440c, 0x0000, 0x2b5a, 0x3c90, 0x2a5a, 0x2d8a, 0x3cc9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42bf, 0x45f8, 0x48f3,
+	    0x0000, 0x0e91, 0x43dc, 0x059e, 0x21c9, 0x225f, 0x0000, 0x2505,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4b66, 0x3ff3, 0x1a8d, 0x2d83,
+	    0x023e, 0x1343, 0x4475, 0x0000, 0x3f59, 0x11d6, 0x0000, 0x0000,
+	    0x1f58, 0x3816, 0x16c1, 0x0000, 0x1688, 0x318b, 0x0a6c, 0x0000,
+	    0x0000, 0x131c, 0x0adc, 0x0000, 0x0000, 0x33aa, 0x3482, 0x1c07,
+	    0x00f9, 0x05cf, 0x0000, 0x0000, 0x0000, 0x16d8, 0x22d7, 0x3039,
+	    0x13d4, 0x305e, 0x3d8a, 0x1f38, 0x0000, 0x0000, 0x0000, 0x2928,
+	    0x0000, 0x013c, 0x1ffd, 0x31e2, 0x0000, 0x0000, 0x31b3, 0x0000,
+	    0x0000, 0x3fb7, 0x48a5, 0x3f0c, 0x0000, 0x1a11, 0x04c4, 0x0000,
+	    0x405a, 0x0000, 0x483d, 0x1672, 0x0000, 0x0000, 0x0000, 0x444f,
+	    0x1a3a, 0x3489, 0x4a70, 0x0000, 0x072e, 0x05c1, 0x0000, 0x1859,
+	    0x0000, 0x406f, 0x0000, 0x0fd8, 0x150c, 0x3376, 0x1356, 0x061a,
+	    0x0000, 0x0000, 0x0000, 0x1426, 0x0000, 0x0000, 0x4551, 0x0000,
+	    0x0eb0, 0x0000, 0x2676, 0x3de8, 0x0000, 0x0000, 0x493f, 0x28e7,
+	    0x2553, 0x0000, 0x3cfc, 0x35fa, 0x25fe, 0x153d, 0x3efe, 0x3983,
+	    0x285f, 0x0000, 0x0000, 0x03be, 0x2686, 0x4822, 0x33f7, 0x40a1,
+	    0x190c, 0x07d6, 0x0ad7, 0x0000, 0x07c2, 0x0000, 0x3d14, 0x3799,
+	    0x2d87, 0x076e, 0x0415, 0x16a6, 0x4023, 0x4195, 0x0000, 0x1e9a,
+	    0x0000, 0x2ae7, 0x0000, 0x0307, 0x2e57, 0x4adc, 0x0878, 0x4b85,
+	    0x3731, 0x0000, 0x0000, 0x0000, 0x4a67, 0x22f6, 0x0000, 0x4612,
+	    0x1c25, 0x0000, 0x0000, 0x0c79, 0x0000, 0x0000, 0x1631, 0x0af5,
+	    0x0000, 0x0000, 0x249a, 0x0000, 0x4b2f, 0x17d0, 0x2b94, 0x0279,
+	    0x3f2e, 0x3e00, 0x2b6f, 0x0787, 0x37e5, 0x130b, 0x11b3, 0x1723,
+	    0x47d8, 0x0d00, 0x0000, 0x4635, 0x128a, 0x3f2d, 0x4a6a, 0x14d4,
+	    0x49f0, 0x4a45, 0x0000, 0x0000, 0x4dda, 0x0000, 0x0314, 0x32d1,
+	    0x2fdb, 0x4397, 0x0000, 0x0000, 0x47ea, 0x1579, 0x0000, 0x19a1,
+	    0x0000, 0x0b45, 0x27d9, 0x25ed, 0x0000, 0x2ba8, 0x1ee5, 0x0000,
+	    0x1c6e, 0x2441, 0x0000, 0x3e58, 0x0000, 0x142c, 0x098b, 0x08ca,
+	    0x1cf2, 0x0000, 0x3acf, 0x3643, 0x0000, 0x303e, 0x0000, 0x0000,
+	    0x09ce, 0x0f6c, 0x0aab, 0x042d, 0x4319, 0x468c, 0x3d24, 0x182d,
+	    0x4a43, 0x2e27, 0x2eef, 0x43c9, 0x27c4, 0x1985, 0x0000, 0x0000,
+	    0x0a25, 0x3726, 0x2566, 0x0000, 0x140c, 0x0000, 0x4c71, 0x038d,
+	    0x3076, 0x2a62, 0x2c86, 0x4bf6, 0x4565, 0x0000, 0x08f2, 0x39f0,
+	    0x24d0, 0x4c01, 0x0000, 0x4db8, 0x29eb, 0x0000, 0x0843, 0x475f,
+	    0x07b7, 0x32a9, 0x0000, 0x0224, 0x0000, 0x0000, 0x1c7a, 0x3507,
+	    0x1936, 0x1163, 0x0000, 0x3a0e, 0x0000, 0x0000, 0x1766, 0x0000,
+	    0x0000, 0x0000, 0x4241, 0x4645, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x446f, 0x0000, 0x07f6, 0x0000, 0x4b2c, 0x0000, 0x4bf3, 0x0000,
+	    0x2e2e, 0x2847, 0x0000, 0x0000, 0x0ada, 0x3185, 0x0f00, 0x0000,
+	    0x425a, 0x1546, 0x1c0d, 0x39ee, 0x3c00, 0x0000, 0x0fcb, 0x357d,
+	    0x2ba1, 0x0000, 0x2343, 0x0000, 0x0b14, 0x1e95, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2a1b, 0x0000, 0x0000, 0x148c, 0x33ca, 0x0000,
+	    0x0000, 0x0000, 0x322d, 0x340d, 0x0000, 0x07b1, 0x02b1, 0x0000,
+	    0x0000, 0x1aed, 0x4a7a, 0x0000, 0x35e9, 0x3a3c, 0x0000, 0x0000,
+	    0x49dd, 0x12d2, 0x0000, 0x0000, 0x121c, 0x0000, 0x0000, 0x0000,
+	    0x2102, 0x0000, 0x4ccd, 0x380c, 0x0000, 0x0000, 0x0000, 0x46e8,
+	    0x0000, 0x01f6, 0x27aa, 0x256f, 0x0a38, 0x463f, 0x0c62, 0x4641,
+	    0x35f9, 0x4a8a, 0x0000, 0x0000, 0x425f, 0x0000, 0x42de, 0x0000,
+	    0x0ae5, 0x2a39, 0x12bb, 0x0000, 0x2ce2, 0x0000, 0x1455, 0x2038,
+	    0x0000, 0x0000, 0x0000, 0x3bb4, 0x0000, 0x0de0, 0x0000, 0x130b,
+	    0x0930, 0x38f0, 0x3d29, 0x0000, 0x0000, 0x4071, 0x0ff6, 0x4da3,
+	    0x0000, 0x4c16, 0x4002, 0x4493, 0x1fd1, 0x0000, 0x0000, 0x180e,
+	    0x4bd8, 0x4005, 0x3694, 0x3334, 0x0000, 0x0000, 0x4cad, 0x1848,
+	    0x042b, 0x15c3, 0x0000, 0x0000, 0x1521, 0x4562, 0x0000, 0x0000,
+	    0x01cf, 0x0000, 0x0000, 0x2af8, 0x39d5, 0x44c3, 0x0000, 0x0000,
+	    0x4782, 0x0000, 0x34f3, 0x1658, 0x0000, 0x24b4, 0x1867, 0x24b4,
+	    0x02e6, 0x3445, 0x0000, 0x270b, 0x2578, 0x0000, 0x0df7, 0x3302,
+	    0x1eb1, 0x305e, 0x0000, 0x2980, 0x47b7, 0x0000, 0x0000, 0x0000,
+	    0x41cd, 0x083e, 0x2fee, 0x0053, 0x40c6, 0x37bd, 0x0000, 0x0000,
+	    0x4caa, 0x0000, 0x3eda, 0x3980, 0x2068, 0x0000, 0x386d, 0x3b32,
+	    0x0000, 0x4ac3, 0x4391, 0x0000, 0x40f1, 0x0000, 0x26b2, 0x306b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0ef5, 0x0000, 0x13bc, 0x49d4,
+	    0x1b5f, 0x491a, 0x3ee1, 0x3a5a, 0x44bb, 0x33aa, 0x0000, 0x0dac,
+	    0x1a1a, 0x0000, 0x0000, 0x2ecc, 0x475e, 0x0000, 0x0000, 0x2b26,
+	    0x0000, 0x0000, 0x1853, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a1d,
+	    0x28b7, 0x14a5, 0x0278, 0x37ee, 0x33f1, 0x0000, 0x1f62, 0x367e,
+	    0x0000, 0x4dc6, 0x3524, 0x48d4, 0x0000, 0x137d, 0x09f9, 0x126d,
+	    0x2d1e, 0x05a2, 0x0000, 0x43c2, 0x080a, 0x0124, 0x0000, 0x3525,
+	    0x1c6d, 0x0000, 0x0609, 0x0064, 0x36d9, 0x0000, 0x414e, 0x3bb9,
+	    0x4daa, 0x397f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0de3,
+	    0x0000, 0x0000, 0x1efa, 0x0835, 0x2223, 0x2d46, 0x0000, 0x1d29,
+	    0x0000, 0x0000, 0x0000, 0x0531, 0x0000, 0x0000, 0x38cb, 0x2be3,
+	    0x0000, 0x2b74, 0x03bc, 0x31ff, 0x0439, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x15ed, 0x4d50, 0x0000, 0x0b28, 0x0000, 0x0000,
+	    0x0000, 0x2678, 0x0000, 0x0000, 0x1f30, 0x3a33, 0x3392, 0x0000,
+	    0x0df9, 0x0000, 0x37c1, 0x0000, 0x1d9d, 0x0000, 0x0000, 0x125b,
+	    0x0000, 0x2430, 0x0000, 0x0000, 0x456e, 0x245b, 0x0000, 0x0000,
+	    0x21cc, 0x0000, 0x3bae, 0x0000, 0x0000, 0x17dc, 0x0000, 0x0000,
+	    0x0987, 0x0000, 0x153a, 0x30cd, 0x3e40, 0x0ddd, 0x0000, 0x0000,
+	    0x1260, 0x093a, 0x48d0, 0x0000, 0x2779, 0x24fd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1539, 0x0000, 0x1fb9, 0x0000, 0x33ad, 0x0000,
+	    0x0000, 0x3977, 0x0405, 0x4741, 0x39a3, 0x0000, 0x0000, 0x0000,
+	    0x1e32, 0x0000, 0x4742, 0x2599, 0x0253, 0x01d7, 0x0a7c, 0x0000,
+	    0x0d72, 0x0000, 0x0500, 0x0000, 0x0000, 0x0000, 0x0000, 0x2293,
+	    0x4bed, 0x34f0, 0x0000, 0x0000, 0x0000, 0x2cca, 0x0000, 0x49be,
+	    0x0000, 0x0000, 0x0000, 0x18d5, 0x3320, 0x48ff, 0x00c9, 0x0000,
+	    0x0000, 0x0000, 0x2ab0, 0x38dc, 0x0000, 0x1a87, 0x0fea, 0x0000,
+	    0x0000, 0x0000, 0x2e4d, 0x0000, 0x265e, 0x2c46, 0x2ba0, 0x0020,
+	    0x1eb8, 0x0b3e, 0x0000, 0x4381, 0x0000, 0x493b, 0x08ed, 0x4d44,
+	    0x0000, 0x3942, 0x1412, 0x0000, 0x1355, 0x087a, 0x49c5, 0x4b55,
+	    0x3b11, 0x0314, 0x37e1, 0x06ea, 0x0000, 0x1b69, 0x0000, 0x2fc5,
+	    0x0000, 0x4a58, 0x1dbf, 0x0000, 0x0587, 0x4952, 0x184d, 0x32d6,
+	    0x0491, 0x3f0c, 0x0000, 0x3d17, 0x4851, 0x0000, 0x38b2, 0x391f,
+	    0x3c3c, 0x1ac4, 0x0000, 0x21db, 0x153c, 0x1a54, 0x2cde, 0x16fe,
+	    0x253a, 0x2004, 0x0000, 0x3e65, 0x3da4, 0x0000, 0x0000, 0x447f,
+	    0x0000, 0x25d8, 0x3513, 0x0000, 0x0000, 0x48c0, 0x04d6, 0x26a3,
+	    0x0000, 0x0000, 0x4201, 0x0000, 0x416d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1c59, 0x29df, 0x4561, 0x28ee, 0x0000, 0x3c26,
+	    0x0000, 0x222d, 0x1b77, 0x0000, 0x2e8c, 0x0000, 0x0000, 0x2399,
+	    0x0000, 0x3ede, 0x0084, 0x0000, 0x14da, 0x21bf, 0x0d78, 0x4c3e,
+	    0x1ce1, 0x414a, 0x0000, 0x0000, 0x0aec, 0x0000, 0x3fa1, 0x13a4,
+	    0x3797, 0x0000, 0x0000, 0x0000, 0x0ce3, 0x4a7b, 0x16cf, 0x0000,
+	    0x0ef1, 0x1b45, 0x0000, 0x123e, 0x1b70, 0x4dd2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1cfb, 0x35b2, 0x2261, 0x0000, 0x012e,
+	    0x0000, 0x2580, 0x4018, 0x307a, 0x0000, 0x3adb, 0x4d29, 0x09fc,
+	    0x0000, 0x09bf, 0x0000, 0x2402, 0x0000, 0x0000, 0x0000, 0x0a30,
+	    0x1ff7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e89, 0x051f, 0x303e,
+	    0x042b, 0x0000, 0x14a1, 0x1a36, 0x34b1, 0x0000, 0x3eea, 0x0000,
+	    0x09dd, 0x0000, 0x0000, 0x13d0, 0x3d91, 0x0000, 0x3b4d, 0x2ac1,
+	    0x0000, 0x02a5, 0x1c3f, 0x44a6, 0x1211, 0x3750, 0x475e, 0x0a0d,
+	    0x1b51, 0x06ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x3772, 0x0000,
+	    0x4b23, 0x0000, 0x48aa, 0x0000, 0x0000, 0x36fb, 0x2b5a, 0x0000,
+	    0x23e1, 0x0000, 0x38aa, 0x268b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1ee0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1661, 0x1dc1, 0x194a, 0x33ad, 0x0000, 0x48c0, 0x0000, 0x0000,
+	    0x4165, 0x13cf, 0x0797, 0x0000, 0x0000, 0x0000, 0x0000, 0x2594,
+	    0x0000, 0x18ef, 0x01bf, 0x0cae, 0x0000, 0x4052, 0x0000, 0x0000,
+	    0x301e, 0x2e0e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x130c,
+	    0x0000, 0x0000, 0x3c62, 0x2ea3, 0x258d, 0x48db, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3746, 0x0000, 0x0538, 0x007f,
+	    0x15ca, 0x05da, 0x404f, 0x0000, 0x2f55, 0x3593, 0x1535, 0x4bfd,
+	    0x3da4, 0x32e3, 0x0000, 0x0ce4, 0x171d, 0x2ecc, 0x2644, 0x151f,
+	    0x3a3c, 0x13fe, 0x1fa0, 0x1f91, 0x0000, 0x498f, 0x4043, 0x4d1c,
+	    0x3e1e, 0x3c1c, 0x22e6, 0x209f, 0x0000, 0x0252, 0x1c0e, 0x495d,
+	    0x349f, 0x0000, 0x045a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x15d5, 0x35b4, 0x03be, 0x36af, 0x0000, 0x1ee6, 0x082b, 0x0000,
+	    0x07d6, 0x01f1, 0x1dc4, 0x0000, 0x4c97, 0x47ed, 0x240a, 0x0000,
+	    0x15d5, 0x0000, 0x429c, 0x0000, 0x132a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0f21, 0x0000, 0x0000, 0x09ee,
+	    0x474e, 0x0000, 0x4a91, 0x4bdc, 0x019f, 0x0ed4, 0x0000, 0x0000,
+	    0x2336, 0x1e9c, 0x01aa, 0x0000, 0x0000, 0x0000, 0x39ab, 0x40a4,
+	    0x30c7, 0x2eb4, 0x0000, 0x0000, 0x0000, 0x19d9, 0x0385, 0x0000,
+	    0x472c, 0x0e1f, 0x473a, 0x4add, 0x0000, 0x0000, 0x45fa, 0x0000,
+	    0x114e, 0x0000, 0x43df, 0x0000, 0x24b3, 0x37d9, 0x0000, 0x3344,
+	    0x0000, 0x01d6, 0x398c, 0x322b, 0x49ed, 0x4501, 0x0000, 0x08c5,
+	    0x398c, 0x0000, 0x492b, 0x0000, 0x0000, 0x2373, 0x0000, 0x19de,
+	    0x0000, 0x2fa8, 0x3688, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3b54, 0x3045, 0x0194, 0x0108, 0x0000, 0x40e4, 0x36d3, 0x0000,
+	    0x1311, 0x0000, 0x0d5f, 0x0000, 0x183a, 0x0000, 0x0000, 0x0cf0,
+	    0x0000, 0x0000, 0x1755, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x43bb, 0x0000, 0x0000, 0x05e8, 0x0000, 0x04a3, 0x3d39, 0x1c52,
+	    0x0d38, 0x0000, 0x0000, 0x423c, 0x0000, 0x1026, 0x2e4c, 0x0000,
+	    0x0000, 0x0000, 0x3526, 0x0000, 0x0000, 0x2ce2, 0x0000, 0x0000,
+	    0x4c8a, 0x03e6, 0x0000, 0x0df2, 0x2471, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4a4d, 0x29ee, 0x0000, 0x4892, 0x34d2, 0x3f1e,
+	    0x0000, 0x0000, 0x18a7, 0x3bff, 0x0000, 0x0000, 0x0000, 0x15de,
+	    0x057b, 0x0000, 0x0000, 0x0000, 0x197a, 0x2ff1, 0x02a5, 0x3b45,
+	    0x37f1, 0x0000, 0x2dd1, 0x12f5, 0x3060, 0x06c3, 0x26e8, 0x193b,
+	    0x1005, 0x0000, 0x0b68, 0x4cc7, 0x0000, 0x0000, 0x1e8f, 0x0000,
+	    0x13e8, 0x0000, 0x0000, 0x0407, 0x0000, 0x0000, 0x0000, 0x428e,
+	    0x0000, 0x4446, 0x10b6, 0x25d3, 0x0000, 0x0000, 0x0e86, 0x0269,
+	    0x0000, 0x27bd, 0x1be3, 0x0000, 0x0fb8, 0x0000, 0x0000, 0x2dc4,
+	    0x0000, 0x1a31, 0x0000, 0x27c1, 0x2081, 0x0000, 0x0000, 0x30e8,
+	    0x0000, 0x0168, 0x0000, 0x1832, 0x3501, 0x34d3, 0x452e, 0x0000,
+	    0x282f, 0x2e8c, 0x0000, 0x0000, 0x43b8, 0x0000, 0x49e4, 0x0000,
+	    0x4654, 0x42fc, 0x1b29, 0x30cc, 0x0000, 0x155d, 0x0000, 0x324f,
+	    0x3db4, 0x0000, 0x354b, 0x0000, 0x4c94, 0x210c, 0x0000, 0x0000,
+	    0x3a6c, 0x0000, 0x1a46, 0x1ae2, 0x0000, 0x4073, 0x2a1f, 0x1da1,
+	    0x0000, 0x2d4a, 0x3049, 0x0000, 0x45b2, 0x0000, 0x1c4f, 0x102b,
+	    0x0000, 0x3c55, 0x4cc5, 0x0881, 0x0000, 0x0000, 0x0000, 0x1c6d,
+	    0x0000, 0x3b75, 0x0000, 0x0000, 0x4ac7, 0x4146, 0x0000, 0x0000,
+	    0x0000, 0x44a7, 0x3f8e, 0x46e0, 0x0240, 0x487f, 0x0000, 0x0000,
+	    0x0000, 0x2cb2, 0x2aba, 0x0000, 0x30a5, 0x0000, 0x0000, 0x0000,
+	    0x10d4, 0x1ee4, 0x3329, 0x15fc, 0x0000, 0x0000, 0x17d3, 0x0000,
+	    0x422d, 0x0000, 0x44ee, 0x0000, 0x04b9, 0x055c, 0x0000, 0x0000,
+	    0x0000, 0x2a53, 0x1edd, 0x0000, 0x2b07, 0x2322, 0x0000, 0x0000,
+	    0x17cd, 0x0000, 0x0000, 0x2798, 0x21fe, 0x2941, 0x0000, 0x2134,
+	    0x0000, 0x0000, 0x0df8, 0x3954, 0x0000, 0x2359, 0x0000, 0x0000,
+	    0x466d, 0x2b97, 0x0000, 0x3842, 0x2676, 0x0691, 0x0000, 0x0000,
+	    0x4287, 0x452c, 0x0000, 0x1f8f, 0x0000, 0x0000, 0x3048, 0x03a6,
+	    0x0000, 0x21d9, 0x26c7, 0x0000, 0x2404, 0x3854, 0x0ef0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1a3c, 0x0000, 0x0000, 0x072a,
+	    0x0000, 0x0000, 0x32d6, 0x0000, 0x0000, 0x0fd9, 0x04b9, 0x1c27,
+	    0x0000, 0x117b, 0x0000, 0x0000, 0x0000, 0x0000, 0x39f4, 0x1140,
+	    0x3d16, 0x0000, 0x28d7, 0x1f9e, 0x216f, 0x0000, 0x2d9e, 0x0000,
+	    0x0000, 0x0000, 0x03f4, 0x3fb6, 0x0000, 0x4bad, 0x1b7a, 0x3489,
+	    0x3ed7, 0x016f, 0x1323, 0x3941, 0x0000, 0x3148, 0x0802, 0x1529,
+	    0x0000, 0x031a, 0x30ea, 0x12a3, 0x0197, 0x0000, 0x20d7, 0x0000,
+	    0x0000, 0x0009, 0x3c97, 0x103d, 0x2794, 0x0000, 0x4885, 0x0000,
+	    0x0000, 0x04ca, 0x1cf5, 0x0000, 0x3f5a, 0x36f5, 0x0000, 0x3e04,
+	    0x2aec, 0x2670, 0x0000, 0x0000, 0x46ab, 0x2851, 0x16a3, 0x4cd9,
+	    0x0000, 0x0000, 0x2dc7, 0x2832, 0x4c77, 0x1152, 0x4083, 0x4c32,
+	    0x0000, 0x0d31, 0x0000, 0x0000, 0x0000, 0x0962, 0x3a53, 0x15d9,
+	    0x0000, 0x3fe5, 0x0000, 0x4c08, 0x0000, 0x4b9e, 0x0000, 0x0000,
+	    0x224b, 0x0000, 0x0000, 0x0000, 0x0000, 0x136a, 0x0000, 0x3830,
+	    0x0000, 0x2891, 0x1418, 0x0000, 0x0000, 0x0000, 0x42c2, 0x3d2a,
+	    0x0000, 0x0000, 0x2c22, 0x0000, 0x0000, 0x4c6e, 0x0921, 0x0000,
+	    0x00a1, 0x3ab2, 0x0000, 0x051a, 0x0c1d, 0x1fbd, 0x0000, 0x36db,
+	    0x1e02, 0x0000, 0x2c18, 0x4c41, 0x1985, 0x0000, 0x3a23, 0x474b,
+	    0x355f, 0x36dd, 0x0000, 0x0000, 0x0c33, 0x08e8, 0x0727, 0x0000,
+	    0x0000, 0x0000, 0x0471, 0x0000, 0x3809, 0x1c49, 0x3631, 0x2ee3,
+	    0x389f, 0x110e, 0x24b2, 0x4515, 0x0000, 0x341b, 0x0000, 0x0000,
+	    0x2d49, 0x1078, 0x2f94, 0x4290, 0x3857, 0x1f01, 0x0a72, 0x0551,
+	    0x08c6, 0x464e, 0x0000, 0x2540, 0x0000, 0x06c6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24c4, 0x4b0b, 0x0000, 0x1a33, 0x4068,
+	    0x0000, 0x40ce, 0x1137, 0x0000, 0x0000, 0x271d, 0x0b5d, 0x0000,
+	    0x3f42, 0x1404, 0x1248, 0x3f4c, 0x2797, 0x3cf4, 0x05f3, 0x096f,
+	    0x0000, 0x0000, 0x19d4, 0x0000, 0x0000, 0x0000, 0x2656, 0x2b1a,
+	    0x21d0, 0x2334, 0x0000, 0x0000, 0x0000, 0x0000, 0x3462, 0x2eff,
+	    0x0000, 0x30a4, 0x1d9f, 0x0000, 0x4d92, 0x3ab3, 0x169c, 0x0000,
+	    0x0000, 0x0000, 0x2dba, 0x0000, 0x0000, 0x01b8, 0x4095, 0x0000,
+	    0x2145, 0x31dd, 0x3d1b, 0x0000, 0x3cf3, 0x074c, 0x0000, 0x3b4d,
+	    0x044c, 0x0000, 0x0000, 0x0000, 0x1740, 0x0000, 0x3a5c, 0x0000,
+	    0x239a, 0x44aa, 0x30c1, 0x48cf, 0x0000, 0x2d0b, 0x3dfc, 0x3ef7,
+	    0x0000, 0x342f, 0x0f0a, 0x0000, 0x0000, 0x056f, 0x0000, 0x2404,
+	    0x43a9, 0x0000, 0x3bbb, 0x18ae, 0x09cc, 0x0000, 0x0835, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2631, 0x0000, 0x422e, 0x1e70, 0x26bc,
+	    0x32c9, 0x0000, 0x0000, 0x3c56, 0x0000, 0x3b6e, 0x0000, 0x0000,
+	    0x0dc9, 0x0000, 0x0000, 0x020c, 0x45d2, 0x0000, 0x0000, 0x0000,
+	    0x073f, 0x0000, 0x0000, 0x0000, 0x19be, 0x0000, 0x0000, 0x367a,
+	    0x0000, 0x0000, 0x0000, 0x2d43, 0x4c17, 0x3957, 0x0d1a, 0x421f,
+	    0x3475, 0x1f95, 0x2486, 0x3afc, 0x067b, 0x3e7d, 0x0000, 0x0000,
+	    0x0000, 0x2c5a, 0x3363, 0x090d, 0x158b, 0x0000, 0x0000, 0x22e3,
+	    0x0000, 0x0000, 0x0000, 0x3f43, 0x0000, 0x0000, 0x0eb4, 0x0000,
+	    0x0000, 0x3e1f, 0x406a, 0x0000, 0x1979, 0x0000, 0x4dd4, 0x0000,
+	    0x1ff6, 0x0000, 0x4cd0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x06ab, 0x1fb9, 0x1412, 0x172c, 0x0f49, 0x0000, 0x0000, 0x3168,
+	    0x0fad, 0x2799, 0x2379, 0x0000, 0x00c2, 0x07f7, 0x0000, 0x4c26,
+	    0x0000, 0x2bfd, 0x0000, 0x0d58, 0x14b5, 0x1831, 0x0000, 0x4098,
+	    0x4b0d, 0x0000, 0x0000, 0x4a88, 0x13c5, 0x1d9c, 0x37db, 0x3ae9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0d90, 0x3ac0, 0x0000, 0x3c74,
+	    0x0000, 0x4a2d, 0x229d, 0x0000, 0x0000, 0x3748, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x27fa, 0x2c25, 0x0000, 0x0000, 0x3b95, 0x0000,
+	    0x0000, 0x0000, 0x37d8, 0x4496, 0x0577, 0x2edf, 0x350e, 0x0dde,
+	    0x0000, 0x3474, 0x0000, 0x0000, 0x0000, 0x10cc, 0x0000, 0x0000,
+	    0x1dd3, 0x0000, 0x1aa0, 0x0000, 0x1df0, 0x2d32, 0x0000, 0x0ff7,
+	    0x4d34, 0x4c81, 0x0000, 0x115c, 0x12f1, 0x0000, 0x0000, 0x0000,
+	    0x3b3c, 0x3a77, 0x0000, 0x30c9, 0x0000, 0x3b33, 0x0000, 0x0000,
+	    0x0000, 0x0ac3, 0x0129, 0x0000, 0x0000, 0x1a95, 0x0000, 0x3219,
+	    0x3b4f, 0x0000, 0x0000, 0x0000, 0x47c5, 0x0000, 0x0000, 0x0000,
+	    0x368b, 0x3115, 0x0000, 0x0a8d, 0x3b28, 0x2008, 0x4499, 0x09be,
+	    0x40c8, 0x3bb8, 0x1384, 0x4690, 0x0000, 0x3cf0, 0x44bf, 0x3dcf,
+	    0x0000, 0x0aee, 0x3147, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bba,
+	    0x2421, 0x0000, 0x0000, 0x3ef5, 0x30ae, 0x0085, 0x0000, 0x0a49,
+	    0x181c, 0x4371, 0x300f, 0x0000, 0x0000, 0x0000, 0x0000, 0x12f3,
+	    0x437e, 0x3083, 0x4dc4, 0x0000, 0x2eed, 0x0000, 0x0000, 0x0000,
+	    0x0aad, 0x2704, 0x312a, 0x1d59, 0x0000, 0x4646, 0x0b39, 0x363e,
+	    0x2275, 0x227a, 0x3916, 0x0000, 0x0ee2, 0x0000, 0x13b5, 0x2559,
+	    0x1c3a, 0x0000, 0x1f2e, 0x42d5, 0x4194, 0x0000, 0x022b, 0x2bfb,
+	    0x0000, 0x0000, 0x0000, 0x0184, 0x0000, 0x0000, 0x0000, 0x2bd0,
+	    0x0000, 0x36ec, 0x055f, 0x0000, 0x25cd, 0x0000, 0x0000, 0x2d82,
+	    0x1619, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e86, 0x4156, 0x0000,
+	    0x0000, 0x4218, 0x1a1d, 0x0000, 0x0000, 0x3ed2, 0x0000, 0x055a,
+	    0x4706, 0x0000, 0x4384, 0x2043, 0x3aab, 0x0000, 0x0000, 0x3751,
+	    0x0000, 0x0000, 0x3f29, 0x40ed, 0x2b30, 0x0000, 0x2a1e, 0x2346,
+	    0x0000, 0x3d21, 0x03dc, 0x458c, 0x0000, 0x498b, 0x192c, 0x2327,
+	    0x11ca, 0x4b67, 0x06ac, 0x0000, 0x4374, 0x0000, 0x0000, 0x2d24,
+	    0x3b63, 0x2a31, 0x0000, 0x0000, 0x3d29, 0x3fcf, 0x3fab, 0x3ea9,
+	    0x0000, 0x0000, 0x1ee4, 0x0000, 0x4ba5, 0x10b3, 0x0cb0, 0x0000,
+	    0x010c, 0x0000, 0x0000, 0x0000, 0x016e, 0x132f, 0x16d8, 0x1873,
+	    0x0000, 0x3d97, 0x1ca9, 0x0000, 0x0000, 0x3707, 0x0000, 0x0000,
+	    0x0000, 0x2f58, 0x0000, 0x0000, 0x2528, 0x0000, 0x3080, 0x0000,
+	    0x0000, 0x2ce3, 0x35a7, 0x0000, 0x0000, 0x1cc7, 0x406a, 0x0000,
+	    0x0448, 0x322a, 0x1069, 0x1156, 0x04a7, 0x0000, 0x0000, 0x0d97,
+	    0x0000, 0x4197, 0x4132, 0x0aec, 0x3884, 0x0b6c, 0x0000, 0x0000,
+	    0x0000, 0x10f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x35ab, 0x0000, 0x3b14,
+	    0x2e01, 0x0000, 0x458f, 0x3a8b, 0x11c4, 0x0000, 0x3808, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03d6, 0x12e1, 0x0000,
+	    0x0000, 0x0000, 0x1942, 0x47ab, 0x0000, 0x21d4, 0x0000, 0x2ac9,
+	    0x4795, 0x4a34, 0x0000, 0x0cdb, 0x3af5, 0x0000, 0x0000, 0x2779,
+	    0x0000, 0x0000, 0x0000, 0x3539, 0x0000, 0x05fc, 0x0000, 0x1d77,
+	    0x4ac4, 0x0000, 0x4a92, 0x0000, 0x0000, 0x0000, 0x0b3a, 0x0000,
+	    0x39b3, 0x4b66, 0x28a4, 0x0000, 0x0000, 0x2246, 0x4761, 0x0000,
+	    0x0000, 0x1b8d, 0x0000, 0x0000, 0x2da1, 0x3ecc, 0x0000, 0x0000,
+	    0x0000, 0x03ed, 0x0a79, 0x1eb5, 0x0000, 0x1dd0, 0x2c66, 0x12f2,
+	    0x4948, 0x3882, 0x2a7d, 0x0000, 0x0000, 0x0df9, 0x19c2, 0x2110,
+	    0x4be6, 0x15a2, 0x1c54, 0x0000, 0x4389, 0x0000, 0x3dc0, 0x0000,
+	    0x0ed6, 0x136b, 0x0ef4, 0x2f3c, 0x0000, 0x0000, 0x0000, 0x0948,
+	    0x257b, 0x0000, 0x165e, 0x0000, 0x0000, 0x29ac, 0x0000, 0x0000,
+	    0x4d8e, 0x2752, 0x073d, 0x279c, 0x2138, 0x0000, 0x29c3, 0x2669,
+	    0x0000, 0x0119, 0x25fb, 0x348c, 0x0000, 0x0000, 0x0000, 0x0e98,
+	    0x0000, 0x0000, 0x0f78, 0x1880, 0x0000, 0x15b7, 0x4965, 0x0000,
+	    0x0000, 0x00f8, 0x0000, 0x3895, 0x0000, 0x05d2, 0x056f, 0x0831,
+	    0x28cc, 0x05e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x35d1, 0x34c2, 0x4c4b, 0x0973, 0x0534, 0x0000, 0x371d, 0x0000,
+	    0x0000, 0x237a, 0x0000, 0x0000, 0x0000, 0x3990, 0x4b3a, 0x3a61,
+	    0x2a66, 0x0000, 0x0000, 0x0000, 0x4900, 0x0000, 0x1efe, 0x0000,
+	    0x21bc, 0x3647, 0x3a68, 0x412e, 0x0000, 0x0000, 0x29db, 0x0790,
+	    0x0000, 0x0000, 0x0000, 0x4c8d, 0x166b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1f03, 0x2073, 0x0000, 0x310a, 0x0000, 0x37c0, 0x0000,
+	    0x13a2, 0x4830, 0x0612, 0x0000, 0x0000, 0x3416, 0x40b3, 0x480b,
+	    0x0000, 0x0000, 0x3902, 0x4083, 0x0d34, 0x0000, 0x24ef, 0x43b6,
+	    0x0000, 0x053a, 0x0000, 0x0000, 0x0000, 0x33c9, 0x487d, 0x0002,
+	    0x1621, 0x2bd0, 0x1f71, 0x0000, 0x1d6d, 0x2f34, 0x05d9, 0x42b6,
+	    0x3551, 0x11ac, 0x0000, 0x35d3, 0x00df, 0x1719, 0x3edf, 0x0000,
+	    0x0000, 0x3972, 0x0000, 0x128a, 0x0000, 0x0000, 0x3516, 0x370d,
+	    0x0000, 0x373a, 0x2505, 0x0000, 0x0000, 0x2ba9, 0x0000, 0x01e2,
+	    0x14b7, 0x0000, 0x1918, 0x0000, 0x0000, 0x2c20, 0x0000, 0x3e09,
+	    0x304c, 0x0489, 0x0000, 0x0000, 0x29dc, 0x0000, 0x0000, 0x0000,
+	    0x262b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b1d, 0x1139, 0x0000,
+	    0x0000, 0x0000, 0x1983, 0x0ffd, 0x3803, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x459a, 0x0000, 0x0000, 0x0000, 0x4bba,
+	    0x0000, 0x269b, 0x0000, 0x0882, 0x0000, 0x0000, 0x32da, 0x454a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3592, 0x0000, 0x101e, 0x2b18,
+	    0x4615, 0x2283, 0x3f23, 0x0000, 0x0000, 0x0017, 0x38db, 0x254b,
+	    0x0000, 0x2a3f, 0x0000, 0x49cd, 0x0000, 0x056c, 0x0000, 0x0000,
+	    0x433a, 0x24fd, 0x0000, 0x0000, 0x0968, 0x0000, 0x3569, 0x2e49,
+	    0x4a9d, 0x400a, 0x0000, 0x1974, 0x042f, 0x19e7, 0x0000, 0x01eb,
+	    0x0000, 0x0f1a, 0x3f50, 0x0000, 0x0eee, 0x0000, 0x3c1f, 0x2b1b,
+	    0x04c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22f1, 0x157f,
+	    0x0000, 0x0000, 0x0000, 0x3d78, 0x274b, 0x47a3, 0x0000, 0x1b95,
+	    0x0000, 0x2a89, 0x4cfd, 0x0000, 0x2e99, 0x0000, 0x1e76, 0x0000,
+	    0x30b0, 0x09d3, 0x227f, 0x0000, 0x0000, 0x0000, 0x0235, 0x0000,
+	    0x39f7, 0x4273, 0x0000, 0x1407, 0x0000, 0x34ff, 0x3124, 0x0000,
+	    0x0000, 0x3c14, 0x2427, 0x2ee4, 0x0000, 0x2133, 0x0000, 0x25b0,
+	    0x2294, 0x2f63, 0x135d, 0x0000, 0x0000, 0x334e, 0x0000, 0x2bb6,
+	    0x01f7, 0x0faa, 0x0000, 0x4b98, 0x2da6, 0x0000, 0x0000, 0x17cd,
+	    0x0000, 0x0000, 0x24cb, 0x0000, 0x0d4f, 0x1783, 0x0000, 0x0000,
+	    0x1a65, 0x0e5f, 0x0000, 0x0000, 0x3b59, 0x3afc, 0x0000, 0x372d,
+	    0x326e, 0x0a04, 0x0000, 0x1029, 0x1ffa, 0x0000, 0x0000, 0x3fe1,
+	    0x0000, 0x4005, 0x123d, 0x3c63, 0x0000, 0x2257, 0x0000, 0x0000,
+	    0x0000, 0x30de, 0x3bc6, 0x37c8, 0x0000, 0x2360, 0x02f1, 0x0000,
+	    0x24b7, 0x0000, 0x0d86, 0x0000, 0x0b52, 0x21d1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x385c, 0x2c74, 0x3856, 0x484b,
+	    0x0000, 0x1f19, 0x0000, 0x3159, 0x2f13, 0x0cde, 0x0000, 0x0000,
+	    0x0000, 0x487a, 0x0000, 0x1049, 0x228d, 0x3c15, 0x0000, 0x1428,
+	    0x0e9c, 0x3544, 0x0000, 0x4ab0, 0x4d0a, 0x0000, 0x44d0, 0x492b,
+	    0x3c65, 0x071d, 0x1ec9, 0x200b, 0x0000, 0x23e5, 0x0000, 0x3376,
+	    0x122b, 0x3269, 0x41c9, 0x2caa, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x48d0, 0x0000, 0x0000, 0x0000, 0x1212, 0x0000, 0x43df, 0x0561,
+	    0x482e, 0x0000, 0x0000, 0x029e, 0x4c6a, 0x0000, 0x38d6, 0x05b4,
+	    0x30fb, 0x0000, 0x0000, 0x0000, 0x3832, 0x1be8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4622, 0x0000, 0x229a, 0x0000, 0x0000, 0x0059,
+	    0x0173, 0x12ad, 0x0f1f, 0x0000, 0x2fd5, 0x14d7, 0x0000, 0x0000,
+	    0x1957, 0x0000, 0x0000, 0x0787, 0x0000, 0x0000, 0x1d91, 0x043b,
+	    0x0000, 0x0000, 0x3c71, 0x2d45, 0x0fcd, 0x1899, 0x0000, 0x0000,
+	    0x20df, 0x2c7d, 0x0270, 0x4b4f, 0x40e2, 0x0000, 0x2a94, 0x0aae,
+	    0x0c16, 0x0000, 0x12cb, 0x0000, 0x0000, 0x0000, 0x3127, 0x4ada,
+	    0x45cf, 0x2def, 0x0000, 0x0000, 0x0e37, 0x374d, 0x06c1, 0x395c,
+	    0x326a, 0x0755, 0x0000, 0x0000, 0x0000, 0x41b6, 0x4de0, 0x39f2,
+	    0x18e8, 0x4c8e, 0x0000, 0x1ea9, 0x0000, 0x0000, 0x11c5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26da, 0x0000, 0x24ac,
+	    0x14de, 0x359a, 0x0000, 0x0000, 0x0000, 0x1675, 0x0000, 0x0000,
+	    0x0000, 0x0e37, 0x0000, 0x1065, 0x0f9f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1e34, 0x2132, 0x4d27, 0x4bc1, 0x0000,
+	    0x0000, 0x251a, 0x0000, 0x08fe, 0x0644, 0x1b04, 0x2073, 0x210e,
+	    0x0000, 0x0000, 0x232c, 0x289d, 0x0000, 0x0b22, 0x348a, 0x0000,
+	    0x0000, 0x0000, 0x26a3, 0x0000, 0x4e12, 0x0000, 0x0d9f, 0x40e5,
+	    0x4176, 0x1e0c, 0x0a1c, 0x35d7, 0x0000, 0x0000, 0x0000, 0x0407,
+	    0x0a3e, 0x03c0, 0x0000, 0x0000, 0x1fd8, 0x0000, 0x0000, 0x0000,
+	    0x058a, 0x198b, 0x014c, 0x0000, 0x2f1c, 0x37ca, 0x0000, 0x010b,
+	    0x0000, 0x0000, 0x3fc2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3e83, 0x0000, 0x41e7, 0x31d0, 0x1295, 0x251b, 0x4411, 0x0000,
+	    0x1554, 0x0000, 0x1b47, 0x3d4b, 0x0603, 0x0000, 0x4d51, 0x0b9f,
+	    0x29c7, 0x2c0b, 0x19a6, 0x0000, 0x0374, 0x0000, 0x0b8d, 0x0000,
+	    0x0000, 0x4484, 0x2e81, 0x414a, 0x143a, 0x3404, 0x06bb, 0x0000,
+	    0x0000, 0x274a, 0x0000, 0x2240, 0x0000, 0x04fa, 0x2abd, 0x0000,
+	    0x3e70, 0x0000, 0x0000, 0x3fd1, 0x0000, 0x33a6, 0x45af, 0x4598,
+	    0x0000, 0x0000, 0x0000, 0x39d1, 0x0000, 0x0000, 0x2564, 0x0000,
+	    0x1c3d, 0x4787, 0x210a, 0x0865, 0x1a71, 0x1e1f, 0x0000, 0x0000,
+	    0x0000, 0x0196, 0x0aea, 0x4501, 0x48ff, 0x0000, 0x0000, 0x0000,
+	    0x38d1, 0x0000, 0x3094, 0x3006, 0x2335, 0x2b4e, 0x0000, 0x0000,
+	    0x1e02, 0x2b21, 0x369d, 0x0000, 0x1e9e, 0x0000, 0x0000, 0x4a14,
+	    0x0494, 0x15bc, 0x0000, 0x27c1, 0x0000, 0x0000, 0x2a70, 0x0000,
+	    0x3dc6, 0x0000, 0x21b4, 0x0000, 0x4265, 0x199d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3bbf, 0x2c50, 0x0000, 0x2d1a, 0x3de1, 0x0000,
+	    0x0000, 0x1dfe, 0x0548, 0x12cf, 0x25e1, 0x1f8a, 0x0000, 0x1fae,
+	    0x0000, 0x0000, 0x25b4, 0x21a0, 0x0000, 0x0000, 0x0000, 0x10ff,
+	    0x0000, 0x0000, 0x0000, 0x4e16, 0x3abc, 0x0000, 0x30ba, 0x3540,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x14d1, 0x2118, 0x2cd7,
+	    0x3475, 0x31f0, 0x06ab, 0x0dac, 0x0000, 0x0000, 0x0000, 0x3e34,
+	    0x1ef3, 0x2462, 0x2d16, 0x0000, 0x0000, 0x0000, 0x2f4f, 0x0000,
+	    0x2fdd, 0x0000, 0x1c45, 0x28db, 0x0000, 0x2d2d, 0x0000, 0x2767,
+	    0x377b, 0x1093, 0x45a9, 0x0000, 0x20f2, 0x0000, 0x1833, 0x46bc,
+	    0x0e08, 0x1da8, 0x0000, 0x2516, 0x0000, 0x3af9, 0x131a, 0x2ea3,
+	    0x4d65, 0x0000, 0x238c, 0x18ba, 0x0000, 0x0000, 0x4bc2, 0x1a96,
+	    0x31e2, 0x2748, 0x0f1b, 0x1f81, 0x48c6, 0x186d, 0x4894, 0x0fbf,
+	    0x0000, 0x0000, 0x4835, 0x0b0b, 0x2f58, 0x0500, 0x0ca8, 0x1ce8,
+	    0x4622, 0x0000, 0x0000, 0x1e32, 0x0000, 0x17cc, 0x2405, 0x2499,
+	    0x0000, 0x468a, 0x3f9e, 0x4c8a, 0x1533, 0x110f, 0x0000, 0x446c,
+	    0x07a9, 0x0000, 0x3c7d, 0x4636, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0394, 0x0000, 0x31b8, 0x0000, 0x3de1, 0x0000, 0x0000, 0x3a51,
+	    0x01b5, 0x0000, 0x2e4c, 0x0000, 0x44b6, 0x2690, 0x1bfb, 0x0000,
+	    0x409f, 0x382a, 0x0000, 0x2dc2, 0x0000, 0x0000, 0x356c, 0x0000,
+	    0x30f0, 0x4078, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e4f, 0x0000, 0x0000, 0x4d97, 0x2759, 0x0ed1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1554, 0x0000, 0x15e6, 0x425a,
+	    0x29e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05c0, 0x0e34,
+	    0x0000, 0x0000, 0x2aa2, 0x259c, 0x2e24, 0x0000, 0x1677, 0x0000,
+	    0x0098, 0x131e, 0x231c, 0x4b8e, 0x399d, 0x4341, 0x0000, 0x2fca,
+	    0x1bb0, 0x1c43, 0x3a58, 0x1dbb, 0x4216, 0x0000, 0x0000, 0x0223,
+	    0x0000, 0x0000, 0x0000, 0x2011, 0x0000, 0x3682, 0x0ce0, 0x0000,
+	    0x2669, 0x3ac0, 0x27b6, 0x0000, 0x0be4, 0x0000, 0x481f, 0x0000,
+	    0x0000, 0x2de5, 0x0000, 0x0000, 0x0000, 0x2970, 0x06c7, 0x1e4c,
+	    0x0000, 0x18bf, 0x0280, 0x0000, 0x0000, 0x451b, 0x0901, 0x0924,
+	    0x29be, 0x0000, 0x1f25, 0x0000, 0x4503, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x33a5,
+	    0x4bcc, 0x20b0, 0x232e, 0x1cff, 0x4c9c, 0x0000, 0x3abf, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0f42, 0x343c, 0x13ba, 0x0000, 0x2328,
+	    0x0000, 0x2bdd, 0x0000, 0x0000, 0x1d61, 0x1685, 0x2edd, 0x2acf,
+	    0x0000, 0x0d9e, 0x0000, 0x1559, 0x0000, 0x0018, 0x21a2, 0x0000,
+	    0x0000, 0x4412, 0x1661, 0x33c1, 0x0000, 0x0000, 0x42aa, 0x0316,
+	    0x3da5, 0x172d, 0x400a, 0x0000, 0x0000, 0x0000, 0x0000, 0x25fc,
+	    0x396c, 0x0000, 0x0000, 0x301a, 0x041f, 0x42d5, 0x45a5, 0x0000,
+	    0x0000, 0x4df8, 0x0000, 0x116e, 0x4867, 0x10db, 0x0000, 0x33bf,
+	    0x1f76, 0x4c96, 0x0000, 0x0000, 0x020a, 0x0000, 0x18d6, 0x4446,
+	    0x2abf, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f74, 0x2dee, 0x478b,
+	    0x0cdf, 0x0000, 0x2012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x209b, 0x0000, 0x0000, 0x0000, 0x0000, 0x17d2, 0x311b,
+	    0x0000, 0x4589, 0x0000, 0x1745, 0x4c73, 0x3d99, 0x0000, 0x2468,
+	    0x30b5, 0x0000, 0x48a9, 0x49df, 0x0000, 0x3b87, 0x26f7, 0x0000,
+	    0x1e75, 0x2b66, 0x1d13, 0x0000, 0x3187, 0x4497, 0x0000, 0x1d0e,
+	    0x0000, 0x3678, 0x1031, 0x1325, 0x3806, 0x00e1, 0x1d87, 0x0000,
+	    0x2407, 0x2b43, 0x2058, 0x1672, 0x33e7, 0x0000, 0x0000, 0x0da9,
+	    0x0000, 0x4e0c, 0x4787, 0x4032, 0x04d2, 0x2a1c, 0x3610, 0x0000,
+	    0x1958, 0x34fd, 0x0796, 0x0000, 0x0000, 0x0cc3, 0x0000, 0x0965,
+	    0x2ea8, 0x0000, 0x0000, 0x3017, 0x4db2, 0x0000, 0x0a67, 0x0000,
+	    0x0b77, 0x0000, 0x0000, 0x443e, 0x208a, 0x0000, 0x0000, 0x2e49,
+	    0x0000, 0x0661, 0x0000, 0x0000, 0x0fe7, 0x0000, 0x0000, 0x39fa,
+	    0x3a4d, 0x20a2, 0x4893, 0x0000, 0x3085, 0x3f56, 0x0000, 0x08c8,
+	    0x3294, 0x350e, 0x3b95, 0x0000, 0x1ea6, 0x397a, 0x0000, 0x2604,
+	    0x0000, 0x1664, 0x0000, 0x2ca4, 0x28e9, 0x3add, 0x0000, 0x0000,
+	    0x0ea1, 0x0000, 0x19be, 0x1af5, 0x2ffc, 0x20ae, 0x079a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4385, 0x0000, 0x0360, 0x2633,
+	    0x2d21, 0x3cd4, 0x19db, 0x3112, 0x09de, 0x265d, 0x0000, 0x4b48,
+	    0x20d9, 0x0000, 0x0000, 0x0000, 0x1cea, 0x0000, 0x0000, 0x0000,
+	    0x1d79, 0x4b49, 0x0000, 0x0000, 0x0f6b, 0x0000, 0x49c5, 0x2721,
+	    0x0000, 0x20f4, 0x0c33, 0x0000, 0x36ea, 0x04fe, 0x4a42, 0x03ba,
+	    0x2114, 0x0000, 0x0000, 0x1c7e, 0x0000, 0x2ca7, 0x1119, 0x0000,
+	    0x247d, 0x0000, 0x0000, 0x0000, 0x458d, 0x4109, 0x0000, 0x1409,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0c35, 0x480b, 0x0000, 0x3a60,
+	    0x0000, 0x20c8, 0x0000, 0x2887, 0x0000, 0x2c29, 0x025f, 0x393f,
+	    0x0000, 0x0000, 0x48ea, 0x111f, 0x033f, 0x1b81, 0x0000, 0x00ce,
+	    0x0000, 0x0000, 0x074e, 0x3cf9, 0x0000, 0x3cfd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x043b, 0x121a, 0x0000, 0x302a, 0x0000, 0x32aa,
+	    0x0000, 0x1aba, 0x2914, 0x1f3a, 0x0000, 0x0000, 0x0000, 0x008b,
+	    0x059d, 0x0000, 0x0000, 0x0c4e, 0x0000, 0x0000, 0x1bb1, 0x2c8a,
+	    0x0000, 0x3825, 0x0000, 0x3726, 0x4090, 0x1b18, 0x3c8a, 0x0000,
+	    0x3ebb, 0x0000, 0x0000, 0x0000, 0x1caa, 0x0000, 0x0000, 0x350a,
+	    0x212c, 0x2297, 0x0000, 0x0000, 0x0000, 0x0000, 0x427c, 0x385a,
+	    0x0000, 0x0250, 0x0000, 0x0000, 0x0000, 0x0000, 0x28e4, 0x0000,
+	    0x0000, 0x300c, 0x3055, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x11d2, 0x360d, 0x0000, 0x10e6, 0x0000, 0x089e, 0x0000, 0x0000,
+	    0x41f6, 0x3050, 0x04c7, 0x36a9, 0x0d14, 0x319c, 0x4d30, 0x04f4,
+	    0x0000, 0x0000, 0x0000, 0x39d5, 0x0000, 0x0b1b, 0x0000, 0x1c10,
+	    0x2c91, 0x0000, 0x0000, 0x0000, 0x3646, 0x3b42, 0x36c4, 0x4cfa,
+	    0x0000, 0x366f, 0x308c, 0x4b26, 0x0000, 0x0000, 0x129c, 0x2e3e,
+	    0x0000, 0x2b07, 0x0dca, 0x0000, 0x3225, 0x0000, 0x1519, 0x0000,
+	    0x09e5, 0x0000, 0x0000, 0x1ece, 0x0000, 0x0f46, 0x0000, 0x2850,
+	    0x012c, 0x0c01, 0x0000, 0x0000, 0x1c5a, 0x3afe, 0x33e5, 0x0000,
+	    0x0000, 0x0000, 0x1580, 0x4cc0, 0x2ac4, 0x258c, 0x3e80, 0x0d81,
+	    0x0000, 0x191b, 0x3998, 0x0000, 0x499f, 0x2cda, 0x10e7, 0x1ac9,
+	    0x0000, 0x0000, 0x0000, 0x3fd4, 0x4683, 0x1b64, 0x2f37, 0x150c,
+	    0x0bb6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4003, 0x0000, 0x0000, 0x0000, 0x21a9, 0x312a, 0x04c5, 0x0000,
+	    0x110d, 0x0000, 0x0000, 0x4b00, 0x44c3, 0x0000, 0x0000, 0x2424,
+	    0x3cb9, 0x0000, 0x0000, 0x3d33, 0x0000, 0x1e5b, 0x0f27, 0x4284,
+	    0x1f3b, 0x3179, 0x0000, 0x2773, 0x0000, 0x1d1a, 0x0000, 0x0000,
+	    0x0b03, 0x0000, 0x287c, 0x3d34, 0x0000, 0x1d92, 0x449f, 0x0000,
+	    0x4473, 0x01f8, 0x149c, 0x1174, 0x3de5, 0x1204, 0x0000, 0x0000,
+	    0x1413, 0x0f8a, 0x2ed0, 0x0000, 0x0000, 0x11d2, 0x3767, 0x0000,
+	    0x0000, 0x0997, 0x0000, 0x0000, 0x1e44, 0x0000, 0x0000, 0x3f52,
+	    0x0000, 0x0000, 0x3c31, 0x1975, 0x1d02, 0x0000, 0x0000, 0x0000,
+	    0x336c, 0x29cc, 0x0000, 0x0000, 0x3d5f, 0x0000, 0x0000, 0x2394,
+	    0x29d6, 0x444c, 0x2ef1, 0x1e68, 0x3a84, 0x45e4, 0x0000, 0x20d2,
+	    0x3d20, 0x0000, 0x49a8, 0x0000, 0x4a53, 0x0000, 0x29f9, 0x3206,
+	    0x0000, 0x3242, 0x0000, 0x0000, 0x444a, 0x0000, 0x4cb6, 0x057c,
+	    0x0000, 0x067a, 0x15ec, 0x0000, 0x0917, 0x0000, 0x4d99, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x019a, 0x0000, 0x28a9, 0x0000,
+	    0x03b8, 0x1af6, 0x0000, 0x0000, 0x48e6, 0x252a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x48f0, 0x0000, 0x377a, 0x0000,
+	    0x0000, 0x4437, 0x1a2d, 0x4298, 0x4e03, 0x0000, 0x15b9, 0x0000,
+	    0x0000, 0x3e32, 0x0000, 0x1de2, 0x0000, 0x1a85, 0x446a, 0x0000,
+	    0x14a3, 0x1b39, 0x2d8d, 0x018f, 0x0000, 0x4d57, 0x0000, 0x0000,
+	    0x06a9, 0x0000, 0x0000, 0x4aed, 0x0000, 0x405e, 0x0000, 0x0000,
+	    0x456b, 0x0000, 0x4278, 0x0000, 0x0000, 0x401f, 0x0000, 0x0000,
+	    0x0000, 0x4364, 0x0000, 0x2d8f, 0x0000, 0x0000, 0x11a8, 0x0000,
+	    0x097b, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e44, 0x0e61, 0x0000,
+	    0x0000, 0x4aec, 0x04c3, 0x0000, 0x1448, 0x0000, 0x0000, 0x0000,
+	    0x09a3, 0x4a3a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1448, 0x0000, 0x1c38, 0x1464, 0x057e, 0x0000, 0x35a3, 0x0000,
+	    0x490b, 0x2188, 0x34cc, 0x0000, 0x0000, 0x15e6, 0x2785, 0x0000,
+	    0x0000, 0x0000, 0x0d6d, 0x35aa, 0x2077, 0x0000, 0x3edb, 0x3916,
+	    0x0000, 0x2588, 0x0000, 0x0000, 0x2674, 0x1084, 0x20c2, 0x0000,
+	    0x2085, 0x0000, 0x0000, 0x0000, 0x0605, 0x0000, 0x0ef8, 0x0000,
+	    0x4267, 0x0000, 0x1c83, 0x0000, 0x2484, 0x1fd3, 0x3eb4, 0x16ca,
+	    0x29d5, 0x1787, 0x2391, 0x0000, 0x2409, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4861, 0x141c, 0x035a, 0x1c4c, 0x32b6,
+	    0x0783, 0x0000, 0x0000, 0x0000, 0x0000, 0x295c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4b56, 0x2e2a, 0x0000, 0x0000, 0x1861, 0x0000,
+	    0x0000, 0x0000, 0x25d7, 0x0000, 0x4cdf, 0x223a, 0x0000, 0x0000,
+	    0x0000, 0x4af1, 0x0000, 0x0d1a, 0x0000, 0x0000, 0x3fcd, 0x0000,
+	    0x0000, 0x0000, 0x4557, 0x4b12, 0x2c3c, 0x3513, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x214a, 0x0000, 0x2665, 0x0000,
+	    0x4153, 0x0000, 0x0000, 0x2ad4, 0x4882, 0x0000, 0x0000, 0x0000,
+	    0x48e2, 0x0000, 0x31f1, 0x0000, 0x0000, 0x47a8, 0x1dba, 0x0000,
+	    0x050c, 0x0000, 0x0000, 0x15dc, 0x0000, 0x38e6, 0x0415, 0x0000,
+	    0x0000, 0x0000, 0x47a6, 0x428f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0b07, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0182, 0x19c9, 0x0000, 0x0000, 0x0000, 0x0000, 0x1709,
+	    0x1b61, 0x1ef2, 0x2fcb, 0x1782, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02b4, 0x1604, 0x4c55, 0x42ce, 0x0000, 0x260a, 0x0000,
+	    0x0000, 0x41ed, 0x0000, 0x1e2a, 0x0000, 0x409e, 0x47ee, 0x4b19,
+	    0x2edd, 0x17ad, 0x2853, 0x0000, 0x0000, 0x4585, 0x2ed4, 0x2b55,
+	    0x1000, 0x07fc, 0x0000, 0x2d41, 0x42af, 0x010f, 0x400e, 0x2b69,
+	    0x1257, 0x0b5c, 0x0000, 0x0000, 0x4da4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4a27, 0x0000, 0x0000, 0x0000, 0x43e8,
+	    0x1f60, 0x0000, 0x0000, 0x1da0, 0x0000, 0x308b, 0x15f3, 0x0000,
+	    0x0000, 0x3c11, 0x0000, 0x12c8, 0x2ba1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x180d, 0x0000, 0x0000, 0x1df3, 0x0000, 0x0000, 0x0000,
+	    0x31fe, 0x17d3, 0x0cf0, 0x335c, 0x0000, 0x0000, 0x3ea4, 0x0000,
+	    0x1cc4, 0x2248, 0x3cfa, 0x0000, 0x351e, 0x0000, 0x3410, 0x37ae,
+	    0x0000, 0x28c9, 0x0000, 0x0000, 0x0000, 0x1f3e, 0x0000, 0x0000,
+	    0x0000, 0x1a7f, 0x2214, 0x0000, 0x0000, 0x2035, 0x4a01, 0x0000,
+	    0x0000, 0x026a, 0x09d0, 0x07bf, 0x0000, 0x0827, 0x37b6, 0x30a1,
+	    0x00fa, 0x0000, 0x0000, 0x3817, 0x4729, 0x0000, 0x0000, 0x1db0,
+	    0x0944, 0x0ed6, 0x0000, 0x12ef, 0x29c6, 0x42d9, 0x1ebd, 0x04fd,
+	    0x14d5, 0x4b6c, 0x3ddc, 0x0000, 0x4591, 0x41e2, 0x0000, 0x4e01,
+	    0x0512, 0x0000, 0x1b1e, 0x180c, 0x0000, 0x4d11, 0x0eb2, 0x32b5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x29f7, 0x30a1, 0x3015,
+	    0x2651, 0x0000, 0x3546, 0x1f39, 0x23e8, 0x2480, 0x06ec, 0x0000,
+	    0x1c1c, 0x25a5, 0x219a, 0x0000, 0x0488, 0x302a, 0x0000, 0x0e05,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1868, 0x36bf, 0x012d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2a98, 0x3b15, 0x0000, 0x2edb,
+	    0x0000, 0x4ab7, 0x4653, 0x2364, 0x1a22, 0x3eda, 0x2017, 0x4766,
+	    0x4c3f, 0x0000, 0x412b, 0x1527, 0x0000, 0x4ab0, 0x1db2, 0x0000,
+	    0x4db4, 0x0000, 0x0000, 0x0350, 0x0000, 0x0000, 0x002e, 0x33bd,
+	    0x107d, 0x0000, 0x0000, 0x0000, 0x02ab, 0x233a, 0x006a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4687, 0x2b08, 0x1981, 0x0bf6,
+	    0x389e, 0x0000, 0x3a11, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0ae2, 0x0000, 0x0000, 0x0000, 0x29ab, 0x0000,
+	    0x0000, 0x109a, 0x185a, 0x46a1, 0x4bc8, 0x0000, 0x09e9, 0x2f90,
+	    0x066e, 0x29c6, 0x0000, 0x1e04, 0x0b5e, 0x32fa, 0x2f8e, 0x0000,
+	    0x0000, 0x0000, 0x1498, 0x3007, 0x0000, 0x0000, 0x494b, 0x0000,
+	    0x30b6, 0x01fe, 0x0aa1, 0x0000, 0x2007, 0x0000, 0x1a54, 0x0769,
+	    0x2ca2, 0x07f2, 0x145c, 0x0000, 0x3a1a, 0x3df7, 0x4a04, 0x112b,
+	    0x0000, 0x043a, 0x32c1, 0x077a, 0x0f05, 0x0f23, 0x0000, 0x0000,
+	    0x41e1, 0x2de3, 0x43e1, 0x33d0, 0x1f30, 0x1db7, 0x0000, 0x0000,
+	    0x1546, 0x1641, 0x1db4, 0x3e3e, 0x0ccc, 0x22b5, 0x020e, 0x0000,
+	    0x0000, 0x0137, 0x1bf1, 0x2465, 0x0000, 0x345d, 0x37d9, 0x0000,
+	    0x4218, 0x0000, 0x0000, 0x0000, 0x2416, 0x026f, 0x0000, 0x4b3c,
+	    0x0000, 0x0000, 0x2d02, 0x1600, 0x0000, 0x11fd, 0x0000, 0x0000,
+	    0x3c16, 0x28b4, 0x181c, 0x0000, 0x28b3, 0x076b, 0x057f, 0x0d7e,
+	    0x0000, 0x4783, 0x0000, 0x4b9f, 0x1fb5, 0x2c15, 0x3fec, 0x0000,
+	    0x0000, 0x34e1, 0x0218, 0x3ca8, 0x2718, 0x0c53, 0x039e, 0x05c8,
+	    0x0000, 0x1071, 0x3e6b, 0x0000, 0x0000, 0x44d8, 0x0000, 0x0000,
+	    0x07d1, 0x0000, 0x4339, 0x1c0a, 0x013e, 0x0000, 0x12f7, 0x0000,
+	    0x43c0, 0x0000, 0x3d98, 0x0000, 0x2268, 0x0000, 0x2a64, 0x0000,
+	    0x0000, 0x3d37, 0x2e38, 0x3e93, 0x0000, 0x1a9d, 0x3714, 0x27cb,
+	    0x0000, 0x4499, 0x49a0, 0x408d, 0x1e99, 0x3296, 0x3126, 0x09ff,
+	    0x0000, 0x1b03, 0x3b28, 0x18d3, 0x020e, 0x200f, 0x0a98, 0x20f0,
+	    0x4e15, 0x0000, 0x04ec, 0x0000, 0x011d, 0x0000, 0x2b71, 0x11a8,
+	    0x2006, 0x2d63, 0x3c76, 0x12ba, 0x22e2, 0x2ed8, 0x2857, 0x06fa,
+	    0x3902, 0x1b1c, 0x2c58, 0x0000, 0x0000, 0x3f45, 0x067d, 0x0000,
+	    0x3654, 0x4c9a, 0x00a1, 0x23d6, 0x0892, 0x3e0b, 0x1305, 0x0000,
+	    0x1262, 0x12f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x12c2, 0x38b8,
+	    0x3c6f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x244e, 0x162a,
+	    0x2c74, 0x1af5, 0x32f0, 0x3cc2, 0x39af, 0x0000, 0x0000, 0x0beb,
+	    0x1cb5, 0x0000, 0x1ceb, 0x21fa, 0x194d, 0x0000, 0x0000, 0x0556,
+	    0x0000, 0x1ddf, 0x0000, 0x0000, 0x0000, 0x0000, 0x4309, 0x4755,
+	    0x01a0, 0x0000, 0x2c46, 0x0000, 0x0662, 0x050f, 0x0372, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x18db, 0x2c54, 0x4b29, 0x4a49, 0x22bd,
+	    0x14ca, 0x0000, 0x0000, 0x1c09, 0x1ee0, 0x362d, 0x37e4, 0x1b0d,
+	    0x0000, 0x4bb6, 0x2dbf, 0x0000, 0x2e4d, 0x0f28, 0x0000, 0x19dd,
+	    0x0d84, 0x04f5, 0x4d9a, 0x3f57, 0x037b, 0x48d2, 0x0000, 0x43dc,
+	    0x0000, 0x2fcc, 0x0000, 0x0000, 0x0000, 0x0000, 0x2955, 0x0128,
+	    0x1b44, 0x26cc, 0x0000, 0x0f6d, 0x0794, 0x0000, 0x0000, 0x458c,
+	    0x0000, 0x1674, 0x31c1, 0x4bbb, 0x0000, 0x26d2, 0x0000, 0x0000,
+	    0x27d4, 0x0000, 0x0000, 0x4248, 0x0000, 0x0000, 0x0000, 0x3ce1,
+	    0x0000, 0x3942, 0x495c, 0x24c0, 0x4a32, 0x0000, 0x0000, 0x2c71,
+	    0x4134, 0x18cf, 0x2cfb, 0x0cc3, 0x0000, 0x0000, 0x2174, 0x1fc4,
+	    0x27c8, 0x0000, 0x0000, 0x2db4, 0x0000, 0x0000, 0x064c, 0x185c,
+	    0x3cfb, 0x0da5, 0x212b, 0x0000, 0x0000, 0x3c6b, 0x39fe, 0x1d6f,
+	    0x1fb3, 0x4b67, 0x0000, 0x0372, 0x1bb1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3468, 0x061d, 0x1ec4, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3c58, 0x008f, 0x1de5, 0x1c53, 0x21ec,
+	    0x332e, 0x0000, 0x0000, 0x0000, 0x20a3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1b1d, 0x0000, 0x15d3, 0x1c0a, 0x0000, 0x0000, 0x08f0,
+	    0x1e87, 0x167a, 0x0000, 0x0b95, 0x33b6, 0x1c83, 0x3ba7, 0x29f5,
+	    0x0000, 0x44b4, 0x4b92, 0x0000, 0x0fb0, 0x098a, 0x46f7, 0x12c6,
+	    0x0000, 0x3dfe, 0x0000, 0x3ebc, 0x2927, 0x1aa6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x29fa, 0x3c78, 0x3789, 0x3f97, 0x0cf4, 0x1028,
+	    0x3fb9, 0x0000, 0x0000, 0x3d34, 0x1b79, 0x2575, 0x3547, 0x0000,
+	    0x1cf7, 0x0000, 0x0000, 0x0000, 0x2815, 0x0000, 0x0ac0, 0x0c84,
+	    0x0551, 0x27dd, 0x0000, 0x0000, 0x0000, 0x18b1, 0x0000, 0x0d36,
+	    0x0000, 0x47de, 0x0e83, 0x0000, 0x0ebe, 0x006f, 0x03e8, 0x3122,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2779,
+	    0x2c4f, 0x1f6b, 0x169d, 0x0000, 0x0000, 0x455f, 0x0000, 0x0000,
+	    0x1832, 0x1ac3, 0x0000, 0x0000, 0x0000, 0x2d02, 0x1424, 0x2621,
+	    0x0000, 0x41eb, 0x2a23, 0x3e67, 0x0000, 0x28dd, 0x0000, 0x1cf7,
+	    0x0000, 0x20ad, 0x2b16, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3220, 0x0a7c, 0x3309, 0x2146, 0x0000, 0x0000, 0x10c8, 0x0000,
+	    0x0000, 0x249a, 0x2226, 0x0000, 0x0000, 0x0cb3, 0x1774, 0x0000,
+	    0x18c0, 0x3fc4, 0x42d1, 0x1403, 0x0000, 0x0000, 0x0e86, 0x0aed,
+	    0x0000, 0x2e57, 0x0000, 0x0000, 0x0000, 0x0000, 0x48f8, 0x09b8,
+	    0x0000, 0x3d1b, 0x35cb, 0x0000, 0x0000, 0x369a, 0x11fd, 0x42e6,
+	    0x232c, 0x11b1, 0x0000, 0x414a, 0x424a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4008, 0x0000, 0x11ca, 0x0000,
+	    0x2610, 0x0000, 0x0000, 0x0000, 0x37c5, 0x1b70, 0x0000, 0x0000,
+	    0x0849, 0x3b1f, 0x25d7, 0x23f1, 0x2cf4, 0x44ed, 0x0fbc, 0x0000,
+	    0x3cad, 0x3c95, 0x49d6, 0x0a14, 0x0000, 0x0000, 0x0000, 0x054d,
+	    0x2623, 0x0000, 0x0292, 0x1ad0, 0x3831, 0x3441, 0x20e5, 0x0000,
+	    0x4019, 0x2576, 0x3582, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b25,
+	    0x2263, 0x0000, 0x30f2, 0x03da, 0x0000, 0x0000, 0x34ae, 0x15bf,
+	    0x0000, 0x0000, 0x0000, 0x3879, 0x121e, 0x0000, 0x0000, 0x1bb0,
+	    0x0000, 0x4079, 0x0000, 0x024f, 0x0000, 0x0000, 0x23e9, 0x3209,
+	    0x3c20, 0x0000, 0x31c7, 0x3c1d, 0x223f, 0x149e, 0x2d39, 0x2c9b,
+	    0x2d9a, 0x05a7, 0x0000, 0x0000, 0x2a3b, 0x0000, 0x13bd, 0x0000,
+	    0x4cd4, 0x31a8, 0x49c3, 0x0000, 0x0000, 0x060c, 0x2639, 0x3ef4,
+	    0x0d32, 0x3b4f, 0x49f7, 0x3c54, 0x0000, 0x10d9, 0x044a, 0x0000,
+	    0x3892, 0x12b2, 0x3d3d, 0x0000, 0x2b26, 0x0000, 0x0000, 0x0000,
+	    0x0a84, 0x0f72, 0x0000, 0x0000, 0x35aa, 0x0000, 0x0000, 0x21f7,
+	    0x2e4e, 0x352b, 0x235b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3c06, 0x4060, 0x2031, 0x12d5, 0x113b, 0x194c,
+	    0x3823, 0x2b58, 0x0f4c, 0x0e5a, 0x0000, 0x2976, 0x35f3, 0x0000,
+	    0x3ce6, 0x0000, 0x34dc, 0x484f, 0x0000, 0x05ca, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2eaf, 0x22d3, 0x1b8d, 0x0000, 0x0000, 0x1cf0,
+	    0x0000, 0x0855, 0x0000, 0x3c3b, 0x0e77, 0x0d5f, 0x2a35, 0x14a0,
+	    0x0000, 0x0000, 0x2849, 0x0550, 0x1209, 0x3846, 0x00c8, 0x0000,
+	    0x33a7, 0x4051, 0x0000, 0x19f5, 0x0000, 0x37b2, 0x0000, 0x13c4,
+	    0x0000, 0x0000, 0x0000, 0x4a0d, 0x22f5, 0x0000, 0x197f, 0x1bda,
+	    0x34f7, 0x0000, 0x0000, 0x4595, 0x0323, 0x0000, 0x2dab, 0x2fd0,
+	    0x2607, 0x33ea, 0x36e7, 0x42f4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0af4, 0x0000, 0x0000, 0x0000, 0x2182, 0x20bd, 0x4c31, 0x29df,
+	    0x24cb, 0x197b, 0x2df3, 0x0000, 0x0fe9, 0x494a, 0x0000, 0x314b,
+	    0x217d, 0x0000, 0x441f, 0x0000, 0x0000, 0x0000, 0x047b, 0x0000,
+	    0x0000, 0x0000, 0x4b95, 0x3d4b, 0x0086, 0x0000, 0x117d, 0x304a,
+	    0x0000, 0x0000, 0x3dc1, 0x0000, 0x039d, 0x0000, 0x30cb, 0x0000,
+	    0x3e77, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a03, 0x1921, 0x2c08,
+	    0x4d1a, 0x14e8, 0x04b2, 0x3c4d, 0x166f, 0x36a7, 0x19f6, 0x0000,
+	    0x0000, 0x2897, 0x0000, 0x3b03, 0x0000, 0x0000, 0x0000, 0x01f7,
+	    0x0000, 0x2c72, 0x0000, 0x2f1e, 0x1414, 0x0000, 0x1687, 0x0000,
+	    0x338f, 0x1af4, 0x0000, 0x191f, 0x459b, 0x0000, 0x30b1, 0x0275,
+	    0x423c, 0x1de7, 0x4a47, 0x2bb7, 0x0000, 0x138e, 0x2b3d, 0x0000,
+	    0x3306, 0x0000, 0x0000, 0x41e7, 0x4076, 0x072a, 0x1633, 0x26b3,
+	    0x4832, 0x10a9, 0x3904, 0x0000, 0x3b7b, 0x3636, 0x2ecd, 0x0000,
+	    0x0000, 0x0df4, 0x238a, 0x3b93, 0x0000, 0x0000, 0x0000, 0x4190,
+	    0x49f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x173e, 0x336b, 0x21eb,
+	    0x0000, 0x21ac, 0x0000, 0x1919, 0x31d3, 0x0f3b, 0x4693, 0x250a,
+	    0x30b6, 0x4209, 0x30e7, 0x0000, 0x4718, 0x4247, 0x3863, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x336a, 0x3a74, 0x0000, 0x4891, 0x0000,
+	    0x0000, 0x0000, 0x0d80, 0x22bd, 0x1979, 0x0000, 0x1b79, 0x0000,
+	    0x2dd3, 0x39c3, 0x0bcf, 0x4941, 0x23f5, 0x0000, 0x0000, 0x4606,
+	    0x0000, 0x3156, 0x00c5, 0x0000, 0x0000, 0x0000, 0x3e05, 0x13c6,
+	    0x0000, 0x1d7e, 0x0000, 0x0000, 0x0eef, 0x00ae, 0x40b6, 0x0000,
+	    0x0000, 0x0fe9, 0x0000, 0x0000, 0x140a, 0x0000, 0x0000, 0x2db2,
+	    0x30a7, 0x3754, 0x0bb9, 0x33f2, 0x064a, 0x0a61, 0x0000, 0x0000,
+	    0x3782, 0x0dab, 0x0000, 0x0721, 0x0000, 0x0000, 0x37ab, 0x0000,
+	    0x0000, 0x0f8d, 0x0000, 0x2d0c, 0x0000, 0x0000, 0x284d, 0x4e1f,
+	    0x0000, 0x3434, 0x2d49, 0x2a33, 0x0000, 0x3435, 0x0000, 0x4b30,
+	    0x0aaf, 0x3cf4, 0x41b5, 0x0000, 0x2ca7, 0x4de6, 0x0000, 0x05c0,
+	    0x0000, 0x19d8, 0x1b67, 0x4756, 0x2b8c, 0x2943, 0x0000, 0x0000,
+	    0x4475, 0x1d45, 0x24ed, 0x356f, 0x2542, 0x2250, 0x2b67, 0x3bf5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e58, 0x0000, 0x0000, 0x0000,
+	    0x2dc4, 0x4926, 0x0220, 0x15a4, 0x14d1, 0x1d6d, 0x44a2, 0x134e,
+	    0x3fe5, 0x0000, 0x30e5, 0x0000, 0x37ad, 0x0000, 0x0dce, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x379d, 0x294e, 0x1544, 0x1f03,
+	    0x0000, 0x0000, 0x42de, 0x0000, 0x1311, 0x0c29, 0x2974, 0x203c,
+	    0x4079, 0x0000, 0x18b3, 0x1fa2, 0x0000, 0x298e, 0x0000, 0x0000,
+	    0x1c73, 0x4152, 0x0000, 0x0580, 0x14d9, 0x152a, 0x47fd, 0x0000,
+	    0x39a0, 0x0b85, 0x26a8, 0x0000, 0x14d3, 0x36fd, 0x0000, 0x1509,
+	    0x46af, 0x18e7, 0x0000, 0x4b70, 0x3891, 0x4c8f, 0x0000, 0x0000,
+	    0x1564, 0x0000, 0x2353, 0x3f5d, 0x05ec, 0x13fe, 0x1192, 0x3c62,
+	    0x0000, 0x0cbc, 0x0000, 0x12f3, 0x36fe, 0x0000, 0x0ea5, 0x2c2c,
+	    0x0000, 0x2b05, 0x0000, 0x2216, 0x1073, 0x3542, 0x0000, 0x4757,
+	    0x0000, 0x0000, 0x0000, 0x38aa, 0x0000, 0x0000, 0x0000, 0x2eef,
+	    0x34db, 0x3dbe, 0x3771, 0x0000, 0x0000, 0x2124, 0x0000, 0x42cf,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x486e, 0x0000, 0x2597,
+	    0x0000, 0x45b5, 0x2a6e, 0x443e, 0x0000, 0x1345, 0x0000, 0x269d,
+	    0x2020, 0x3b41, 0x0000, 0x2df6, 0x1ed5, 0x4b2b, 0x0000, 0x2fd3,
+	    0x0285, 0x0000, 0x2777, 0x1cea, 0x43b7, 0x0bee, 0x3014, 0x0000,
+	    0x4dce, 0x0000, 0x0b5d, 0x1a12, 0x0000, 0x0000, 0x19f0, 0x4754,
+	    0x253f, 0x137b, 0x0000, 0x0000, 0x4a5d, 0x0000, 0x27ec, 0x3cdb,
+	    0x0000, 0x0000, 0x0000, 0x4238, 0x0000, 0x335c, 0x16b2, 0x0000,
+	    0x2a95, 0x3069, 0x0000, 0x4a32, 0x4bcf, 0x0000, 0x2b11, 0x0000,
+	    0x1ad3, 0x0000, 0x0000, 0x1d01, 0x41a1, 0x1f18, 0x2d16, 0x31a9,
+	    0x00c0, 0x0000, 0x1978, 0x0a08, 0x2111, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1cd6, 0x0000, 0x0000, 0x44eb, 0x3fec, 0x460b,
+	    0x3312, 0x0000, 0x0000, 0x0000, 0x2154, 0x0000, 0x043b, 0x42a7,
+	    0x4124, 0x482c, 0x0a55, 0x0000, 0x464a, 0x11c6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x403f, 0x0000, 0x3014, 0x28c7,
+	    0x08b3, 0x31bb, 0x0000, 0x1882, 0x0000, 0x1817, 0x0000, 0x488e,
+	    0x0000, 0x3f0a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0664,
+	    0x3903, 0x3ddb, 0x2bb1, 0x008f, 0x2758, 0x28f1, 0x4059, 0x0000,
+	    0x0000, 0x37b9, 0x35cd, 0x0000, 0x0000, 0x0fda, 0x1a47, 0x07e1,
+	    0x0000, 0x0000, 0x061c, 0x0000, 0x0000, 0x400b, 0x0000, 0x0000,
+	    0x2c32, 0x397b, 0x2c6c, 0x3579, 0x46cf, 0x03ac, 0x0000, 0x17d5,
+	    0x0000, 0x3eef, 0x0000, 0x33b8, 0x0000, 0x33eb, 0x0000, 0x0000,
+	    0x0000, 0x2173, 0x4ae3, 0x3b78, 0x0000, 0x02cf, 0x0e30, 0x3f5c,
+	    0x47a5, 0x0000, 0x3272, 0x0000, 0x42c3, 0x010d, 0x3d4e, 0x29a3,
+	    0x1eca, 0x0000, 0x0000, 0x0000, 0x18ce, 0x0000, 0x37dc, 0x4685,
+	    0x4549, 0x0000, 0x3f68, 0x040b, 0x121c, 0x0000, 0x2835, 0x0cda,
+	    0x0000, 0x010f, 0x3182, 0x0d53, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x365d, 0x0d4a, 0x4b97, 0x1468, 0x3459, 0x0000,
+	    0x150a, 0x289e, 0x40b7, 0x11c1, 0x1302, 0x1ea8, 0x0000, 0x1dae,
+	    0x033c, 0x0000, 0x0000, 0x0000, 0x0000, 0x1714, 0x0000, 0x0000,
+	    0x03f8, 0x0c7b, 0x0000, 0x0000, 0x0000, 0x0000, 0x3111, 0x10fe,
+	    0x1934, 0x1c0a, 0x1b4c, 0x0000, 0x4228, 0x1948, 0x0000, 0x1103,
+	    0x0000, 0x1dd6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1e50, 0x411d, 0x2448, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bd3,
+	    0x1d58, 0x0000, 0x27e5, 0x12d0, 0x0000, 0x0000, 0x48d3, 0x28ad,
+	    0x41d9, 0x0000, 0x0000, 0x28f5, 0x11a5, 0x0d63, 0x2695, 0x32f8,
+	    0x0000, 0x047d, 0x0000, 0x345a, 0x0000, 0x083d, 0x401d, 0x20aa,
+	    0x1728, 0x0000, 0x0c45, 0x134c, 0x1a86, 0x0000, 0x31ab, 0x1614,
+	    0x17b4, 0x1a39, 0x0149, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1afe, 0x0000, 0x1be7, 0x3d35, 0x39ab, 0x0000, 0x2596,
+	    0x0000, 0x3682, 0x0262, 0x2e0a, 0x0de0, 0x0000, 0x3870, 0x1949,
+	    0x0792, 0x3255, 0x3f74, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c02,
+	    0x0000, 0x0000, 0x0caf, 0x0000, 0x37d0, 0x0fc9, 0x0000, 0x2f73,
+	    0x1d43, 0x1fff, 0x1371, 0x0000, 0x0000, 0x0000, 0x4a7d, 0x0000,
+	    0x0000, 0x394e, 0x23f0, 0x0dd8, 0x4185, 0x030a, 0x0000, 0x1b15,
+	    0x11d7, 0x252d, 0x1781, 0x0000, 0x0000, 0x0000, 0x3f17, 0x2964,
+	    0x0000, 0x1186, 0x0000, 0x46f9, 0x4155, 0x0000, 0x0000, 0x1613,
+	    0x1bd6, 0x0000, 0x0000, 0x3e25, 0x47db, 0x42ae, 0x42d3, 0x0000,
+	    0x0000, 0x1d55, 0x0000, 0x0000, 0x230e, 0x337f, 0x0000, 0x2a07,
+	    0x0000, 0x0a9d, 0x0000, 0x0000, 0x17db, 0x184e, 0x4da8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1590, 0x0000, 0x0000, 0x0000, 0x1382,
+	    0x0000, 0x0000, 0x4797, 0x0000, 0x4312, 0x0000, 0x30ca, 0x0000,
+	    0x494b, 0x4550, 0x44c0, 0x0e21, 0x0b2f, 0x1196, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x283e, 0x1ebc, 0x2ea9, 0x0000, 0x04ef, 0x0000,
+	    0x2fa5, 0x0bf9, 0x0e4e, 0x0000, 0x354b, 0x1012, 0x191d, 0x2b19,
+	    0x0000, 0x0000, 0x49b0, 0x0000, 0x3e4c, 0x4752, 0x0000, 0x0000,
+	    0x0b51, 0x0000, 0x0000, 0x2746, 0x0000, 0x47d6, 0x0000, 0x1f56,
+	    0x0000, 0x0000, 0x0000, 0x4cb9, 0x2a8f, 0x23b2, 0x0000, 0x065d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4105, 0x458c, 0x115f, 0x0000,
+	    0x2176, 0x0766, 0x0000, 0x0000, 0x0000, 0x3cb7, 0x0000, 0x0d28,
+	    0x47eb, 0x27f0, 0x0000, 0x0000, 0x2111, 0x0000, 0x1b4e, 0x0000,
+	    0x0000, 0x0000, 0x31ff, 0x0000, 0x4473, 0x486c, 0x0000, 0x198d,
+	    0x4144, 0x4092, 0x42b4, 0x0000, 0x21c1, 0x0000, 0x0000, 0x3780,
+	    0x1aaf, 0x0000, 0x1a52, 0x0000, 0x0000, 0x0000, 0x0000, 0x103b,
+	    0x0000, 0x4666, 0x1525, 0x09a2, 0x0000, 0x292e, 0x0882, 0x3c0f,
+	    0x0000, 0x412b, 0x3f04, 0x4bf2, 0x0000, 0x3380, 0x0000, 0x035c,
+	    0x0000, 0x0819, 0x095f, 0x453d, 0x0000, 0x3827, 0x3c8a, 0x0000,
+	    0x3637, 0x41a1, 0x0000, 0x3fa0, 0x020d, 0x48b2, 0x0000, 0x33cb,
+	    0x0000, 0x0aa7, 0x2dc0, 0x13de, 0x03e2, 0x25a1, 0x0b57, 0x0000,
+	    0x0000, 0x437e, 0x257e, 0x0000, 0x037c, 0x2c3c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2f19, 0x02cf, 0x0000, 0x15ab, 0x0262,
+	    0x4a4a, 0x08c8, 0x26eb, 0x0000, 0x0000, 0x195e, 0x0000, 0x06ce,
+	    0x1331, 0x0000, 0x0000, 0x3ec1, 0x0000, 0x0000, 0x26d2, 0x0000,
+	    0x0d2e, 0x0000, 0x0000, 0x26e7, 0x1dd1, 0x0000, 0x1fac, 0x28d1,
+	    0x154f, 0x0000, 0x0000, 0x3bb2, 0x0000, 0x264d, 0x402a, 0x05a7,
+	    0x0000, 0x0000, 0x17cc, 0x0000, 0x0000, 0x1d16, 0x0000, 0x0000,
+	    0x0ee2, 0x2367, 0x0000, 0x23d5, 0x49e8, 0x2f5c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2780, 0x1cc7, 0x0000, 0x0000, 0x2ecb,
+	    0x0000, 0x372e, 0x0ba8, 0x0000, 0x0000, 0x0000, 0x0000, 0x36bb,
+	    0x3c1f, 0x296d, 0x4b8b, 0x40ca, 0x4002, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2621, 0x0000, 0x1467, 0x02c5, 0x0000, 0x038b, 0x0000,
+	    0x0000, 0x0ff7, 0x25e6, 0x3e1d, 0x26fb, 0x0000, 0x0000, 0x0000,
+	    0x0382, 0x0000, 0x0000, 0x0000, 0x30c6, 0x0000, 0x13f6, 0x244a,
+	    0x0999, 0x2955, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2371,
+	    0x0000, 0x3981, 0x25f5, 0x4061, 0x062c, 0x0ef9, 0x3ea0, 0x0000,
+	    0x0000, 0x08ea, 0x0000, 0x4dfb, 0x30a8, 0x0000, 0x0000, 0x44dd,
+	    0x3886, 0x38cd, 0x0085, 0x0000, 0x0000, 0x2c44, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04b8, 0x0000, 0x0000, 0x28d3, 0x057b, 0x0d66,
+	    0x0000, 0x0000, 0x2d70, 0x4047, 0x1dec, 0x0df6, 0x4b62, 0x0000,
+	    0x06d8, 0x1816, 0x0000, 0x0000, 0x4a28, 0x0742, 0x1800, 0x28d6,
+	    0x0000, 0x077a, 0x0000, 0x305c, 0x236f, 0x0000, 0x0000, 0x4450,
+	    0x35db, 0x2637, 0x0000, 0x1910, 0x0000, 0x0cce, 0x0000, 0x3a08,
+	    0x0710, 0x16f1, 0x39e9, 0x092f, 0x381f, 0x0000, 0x0d52, 0x41d5,
+	    0x0983, 0x2df9, 0x0000, 0x1ea7, 0x0000, 0x4166, 0x0000, 0x4832,
+	    0x1711, 0x279e, 0x4672, 0x49fc, 0x0000, 0x0000, 0x48ca, 0x2d35,
+	    0x0000, 0x2c9c, 0x347e, 0x0000, 0x0000, 0x01d9, 0x2e20, 0x1afb,
+	    0x4828, 0x0000, 0x0000, 0x2e46, 0x0000, 0x25eb, 0x422d, 0x0b54,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1216, 0x093e, 0x0000,
+	    0x0000, 0x4889, 0x216c, 0x299b, 0x2d0c, 0x0000, 0x0000, 0x0000,
+	    0x467c, 0x0000, 0x0000, 0x26be, 0x0000, 0x0000, 0x2ca6, 0x1dad,
+	    0x4077, 0x24d0, 0x40a0, 0x0000, 0x0000, 0x371a, 0x4231, 0x0182,
+	    0x29e5, 0x0000, 0x064b, 0x0000, 0x0000, 0x0000, 0x0000, 0x3320,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f13, 0x0000, 0x2161,
+	    0x0aa8, 0x49e3, 0x4bc6, 0x278d, 0x0000, 0x41d4, 0x0000, 0x1021,
+	    0x0000, 0x1bdb, 0x0e5b, 0x0000, 0x0000, 0x2e63, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x36e9, 0x0e91, 0x0000, 0x0000, 0x4292, 0x0000,
+	    0x19e6, 0x36c9, 0x0000, 0x0000, 0x213b, 0x4d5a, 0x0000, 0x0000,
+	    0x0000, 0x0e55, 0x408a, 0x3aa0, 0x0000, 0x1ae8, 0x0000, 0x23be,
+	    0x37ba, 0x0000, 0x0e50, 0x3d58, 0x0000, 0x048c, 0x3750, 0x0666,
+	    0x3587, 0x0000, 0x0000, 0x34d6, 0x0000, 0x3c2b, 0x0000, 0x0000,
+	    0x119c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0add, 0x0e04,
+	    0x3a1b, 0x0000, 0x4cb3, 0x0000, 0x0000, 0x2326, 0x3b47, 0x0000,
+	    0x0000, 0x294e, 0x0000, 0x238c, 0x0000, 0x0000, 0x38c1, 0x0000,
+	    0x3b66, 0x0000, 0x2b99, 0x0000, 0x0000, 0x0c0c, 0x0000, 0x0000,
+	    0x2fdf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4ce6, 0x0000, 0x0000, 0x0adb, 0x0000, 0x0be0, 0x2525, 0x0000,
+	    0x332a, 0x12ca, 0x0000, 0x35c9, 0x2156, 0x0000, 0x0000, 0x495c,
+	    0x4375, 0x28be, 0x4d12, 0x2034, 0x07a3, 0x0000, 0x4386, 0x0000,
+	    0x051a, 0x0000, 0x08e2, 0x0000, 0x0000, 0x060f, 0x46ec, 0x01e1,
+	    0x473c, 0x40ff, 0x4301, 0x0000, 0x0000, 0x0000, 0x0000, 0x387a,
+	    0x07a4, 0x1734, 0x48b8, 0x483f, 0x0000, 0x34ec, 0x32d1, 0x3177,
+	    0x0000, 0x0000, 0x0589, 0x0000, 0x17ea, 0x4aa3, 0x0000, 0x4065,
+	    0x04ab, 0x0839, 0x0000, 0x225f, 0x0000, 0x0000, 0x13a2, 0x438e,
+	    0x0000, 0x0000, 0x0000, 0x20b2, 0x07c6, 0x2509, 0x45c8, 0x0000,
+	    0x0000, 0x22ef, 0x0000, 0x3ef4, 0x131c, 0x0000, 0x2972, 0x0000,
+	    0x4839, 0x3547, 0x4b57, 0x4dfc, 0x379a, 0x0000, 0x0000, 0x1807,
+	    0x13ae, 0x0000, 0x295e, 0x232f, 0x0d6b, 0x034a, 0x3ac5, 0x0000,
+	    0x0000, 0x4237, 0x0000, 0x0000, 0x3f65, 0x059a, 0x0590, 0x07c2,
+	    0x0d79, 0x13e4, 0x0000, 0x4694, 0x20d6, 0x4b78, 0x3cf4, 0x0f92,
+	    0x0000, 0x413e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02e1,
+	    0x2ce6, 0x03ed, 0x0000, 0x0843, 0x32a1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x34fa, 0x0403, 0x0000, 0x0e0b, 0x4223, 0x1a58, 0x0000,
+	    0x0c3c, 0x0000, 0x1c8e, 0x0000, 0x462c, 0x29aa, 0x0b78, 0x0000,
+	    0x1e36, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801,
+	    0x0000, 0x0483, 0x3fb6, 0x231c, 0x0000, 0x085d, 0x0000, 0x3239,
+	    0x2900, 0x3248, 0x0000, 0x376d, 0x2d44, 0x0fed, 0x3bcf, 0x359e,
+	    0x0ab6, 0x2523, 0x48cc, 0x0c2a, 0x2b6c, 0x012a, 0x096d, 0x38f2,
+	    0x00e7, 0x0000, 0x44c3, 0x0000, 0x0000, 0x3f07, 0x3688, 0x0285,
+	    0x2f06, 0x2a47, 0x1763, 0x0bc8, 0x4954, 0x0000, 0x0000, 0x0000,
+	    0x484f, 0x1862, 0x06a7, 0x0000, 0x33ae, 0x3454, 0x10ec, 0x0000,
+	    0x2cab, 0x0000, 0x40ad, 0x0000, 0x3104, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x126f, 0x2983, 0x0000, 0x3803, 0x0000, 0x302f,
+	    0x0000, 0x15fe, 0x02b0, 0x4541, 0x0000, 0x0000, 0x0000, 0x0767,
+	    0x399a, 0x32ed, 0x0000, 0x13ad, 0x0000, 0x09eb, 0x14b2, 0x37dd,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1035, 0x068c, 0x0f3c, 0x2bd8,
+	    0x1fdc, 0x0000, 0x2e6e, 0x0000, 0x29dc, 0x182c, 0x3253, 0x42e6,
+	    0x0000, 0x2040, 0x0000, 0x113e, 0x0000, 0x33c0, 0x2ed0, 0x0000,
+	    0x0392, 0x0000, 0x3a20, 0x0000, 0x0000, 0x3127, 0x0000, 0x0000,
+	    0x0807, 0x0000, 0x0000, 0x3727, 0x0000, 0x0000, 0x0000, 0x009b,
+	    0x1889, 0x0193, 0x0000, 0x0000, 0x0000, 0x2507, 0x247d, 0x2580,
+	    0x45f6, 0x01c2, 0x0000, 0x0000, 0x1913, 0x0000, 0x37e9, 0x0e44,
+	    0x0000, 0x2ecb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3644,
+	    0x0000, 0x46c4, 0x3c50, 0x1f9c, 0x4aff, 0x0ddd, 0x1397, 0x1730,
+	    0x0000, 0x07e7, 0x05c3, 0x0000, 0x0000, 0x30c7, 0x3bfd, 0x3ba9,
+	    0x0000, 0x1b5c, 0x4570, 0x1395, 0x0000, 0x0000, 0x0000, 0x41ff,
+	    0x0000, 0x1bef, 0x4c7b, 0x0000, 0x0000, 0x0000, 0x3cd3, 0x3236,
+	    0x228f, 0x0000, 0x01dc, 0x30ce, 0x0000, 0x4619, 0x423a, 0x2912,
+	    0x44a3, 0x3810, 0x0000, 0x0000, 0x1fad, 0x2e6b, 0x0000, 0x0000,
+	    0x0c05, 0x3264, 0x1fda, 0x0000, 0x0000, 0x0000, 0x0000, 0x09bd,
+	    0x3c0c, 0x0000, 0x0000, 0x0000, 0x364f, 0x4864, 0x0e50, 0x0000,
+	    0x0000, 0x0000, 0x4c27, 0x0000, 0x0577, 0x37b3, 0x0000, 0x0000,
+	    0x0000, 0x1a4e, 0x37df, 0x1767, 0x2f74, 0x434e, 0x0000, 0x0000,
+	    0x3100, 0x0000, 0x178b, 0x36aa, 0x0000, 0x0000, 0x43e1, 0x00f9,
+	    0x0000, 0x2d67, 0x0000, 0x0000, 0x0000, 0x0000, 0x0cd8, 0x0000,
+	    0x04cb, 0x0000, 0x0000, 0x23a0, 0x148d, 0x3863, 0x0000, 0x10b0,
+	    0x2532, 0x34b0, 0x2428, 0x0000, 0x1625, 0x0000, 0x0000, 0x0000,
+	    0x070f, 0x35f3, 0x4b2a, 0x0000, 0x1d66, 0x0000, 0x0000, 0x2da7,
+	    0x3774, 0x0000, 0x0000, 0x321d, 0x3c54, 0x0f2d, 0x0000, 0x10fb,
+	    0x0000, 0x0000, 0x13a7, 0x0000, 0x47fe, 0x0849, 0x1faf, 0x007e,
+	    0x0000, 0x0163, 0x1eab, 0x1e9a, 0x40fe, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0812, 0x094f, 0x0000, 0x1e6e, 0x1508, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0b24, 0x19e3, 0x1e51, 0x0000,
+	    0x0000, 0x0000, 0x1864, 0x0000, 0x0000, 0x0ac1, 0x4373, 0x251d,
+	    0x0000, 0x2918, 0x1765, 0x0cf9, 0x3bb5, 0x308a, 0x1cfa, 0x32c7,
+	    0x398b, 0x0000, 0x0a40, 0x31f5, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0542, 0x0000, 0x0000, 0x0000, 0x0000, 0x2817,
+	    0x2126, 0x3719, 0x0242, 0x4538, 0x3479, 0x0000, 0x0000, 0x0fca,
+	    0x4abe, 0x4b53, 0x01d5, 0x0000, 0x49a2, 0x1730, 0x219d, 0x0000,
+	    0x0000, 0x36d6, 0x2b5c, 0x2e5a, 0x0000, 0x0000, 0x123d, 0x0000,
+	    0x0000, 0x0000, 0x42fc, 0x0000, 0x22aa, 0x1116, 0x0000, 0x0000,
+	    0x3af0, 0x0000, 0x3f75, 0x1ddd, 0x41a5, 0x005d, 0x2781, 0x2e78,
+	    0x490c, 0x1c7a, 0x13b2, 0x280d, 0x0000, 0x1637, 0x2234, 0x02f3,
+	    0x457e, 0x05ad, 0x2f43, 0x1ee4, 0x280b, 0x1257, 0x16d1, 0x4265,
+	    0x0000, 0x2405, 0x04d7, 0x0000, 0x0000, 0x0000, 0x0785, 0x20c2,
+	    0x0000, 0x3fee, 0x0000, 0x0000, 0x0000, 0x146c, 0x0000, 0x10d8,
+	    0x0000, 0x4702, 0x30fa, 0x0000, 0x241e, 0x1e90, 0x3bf4, 0x0000,
+	    0x3738, 0x0000, 0x1016, 0x3e6f, 0x0000, 0x0000, 0x3f64, 0x0000,
+	    0x2e94, 0x0000, 0x0000, 0x0000, 0x0000, 0x08a8, 0x28d8, 0x0000,
+	    0x0000, 0x39a7, 0x0246, 0x0000, 0x2bcd, 0x259b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x29c5, 0x0000, 0x049a, 0x0000, 0x4d51, 0x0000,
+	    0x0444, 0x0a3d, 0x39b7, 0x0000, 0x0000, 0x05f2, 0x3717, 0x4320,
+	    0x3f7b, 0x3a6e, 0x0000, 0x0000, 0x49ff, 0x0000, 0x0000, 0x0206,
+	    0x0000, 0x0000, 0x0000, 0x2e90, 0x4d27, 0x3e4c, 0x0000, 0x0000,
+	    0x23ad, 0x1efb, 0x0cf0, 0x1488, 0x11fa, 0x0000, 0x0000, 0x499b,
+	    0x332e, 0x4904, 0x45de, 0x4407, 0x1998, 0x0000, 0x0000, 0x04ea,
+	    0x2ad2, 0x0000, 0x3ed8, 0x0000, 0x4dc9, 0x1131, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x14bc, 0x0000, 0x0179, 0x0000, 0x0000, 0x1db5,
+	    0x4d1e, 0x0000, 0x3146, 0x2de6, 0x1757, 0x27e4, 0x0ba0, 0x3036,
+	    0x3920, 0x13a3, 0x028e, 0x448a, 0x14d0, 0x0000, 0x4d34, 0x349a,
+	    0x0000, 0x2146, 0x1572, 0x0000, 0x096f, 0x4afd, 0x30b4, 0x0cea,
+	    0x0c4d, 0x4547, 0x0000, 0x0bde, 0x3bfc, 0x0000, 0x3704, 0x0000,
+	    0x4ad0, 0x0bdd, 0x0ac3, 0x0000, 0x4621, 0x2b5e, 0x4173, 0x0c3b,
+	    0x08c1, 0x0000, 0x14a6, 0x1b62, 0x14e9, 0x4d60, 0x3fbe, 0x35fe,
+	    0x0000, 0x0000, 0x0000, 0x1fef, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x014f, 0x1791, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bd6,
+	    0x4ab6, 0x0675, 0x0000, 0x0000, 0x104a, 0x0e08, 0x39fd, 0x1416,
+	    0x0000, 0x2c9b, 0x2fdd, 0x48fa, 0x248e, 0x0000, 0x1f6d, 0x38ce,
+	    0x46bd, 0x1007, 0x3c9e, 0x0000, 0x0000, 0x23e3, 0x0000, 0x33dd,
+	    0x4187, 0x3777, 0x1557, 0x331d, 0x0000, 0x0000, 0x0000, 0x1ac5,
+	    0x4185, 0x0000, 0x0000, 0x0000, 0x1a67, 0x0000, 0x0000, 0x3bfd,
+	    0x0000, 0x1b1c, 0x1a83, 0x2dee, 0x0000, 0x0000, 0x2950, 0x0000,
+	    0x2194, 0x43fd, 0x0000, 0x0000, 0x4cea, 0x160a, 0x0000, 0x0000,
+	    0x1653, 0x3bdb, 0x4759, 0x49e4, 0x0000, 0x3783, 0x0000, 0x0000,
+	    0x0000, 0x4462, 0x0000, 0x149d, 0x0000, 0x0000, 0x0000, 0x1d15,
+	    0x0000, 0x2c1d, 0x0000, 0x0000, 0x2c10, 0x165f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x38d7, 0x0000, 0x2533, 0x1403, 0x1afe,
+	    0x3bbe, 0x3326, 0x3ae4, 0x205b, 0x0000, 0x0730, 0x0e7b, 0x0000,
+	    0x2e72, 0x0000, 0x0000, 0x3837, 0x19b1, 0x31aa, 0x211d, 0x0692,
+	    0x3f3d, 0x0000, 0x3c76, 0x0000, 0x30f8, 0x0000, 0x0000, 0x2fef,
+	    0x0000, 0x0000, 0x0000, 0x1625, 0x2d04, 0x2ad9, 0x0000, 0x3f9e,
+	    0x0000, 0x31fe, 0x0000, 0x34c2, 0x0000, 0x3da2, 0x4330, 0x0a6c,
+	    0x0510, 0x0000, 0x0000, 0x428a, 0x44cd, 0x0000, 0x35b8, 0x2d9c,
+	    0x006c, 0x496d, 0x0000, 0x30b4, 0x0000, 0x0000, 0x4d5d, 0x2326,
+	    0x12bf, 0x0000, 0x30e4, 0x1bae, 0x16d6, 0x28db, 0x0000, 0x2ac7,
+	    0x082f, 0x3575, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b0e,
+	    0x49dc, 0x0000, 0x04e6, 0x0b45, 0x398a, 0x4067, 0x4110, 0x4153,
+	    0x13a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09b3, 0x33b4,
+	    0x0000, 0x0121, 0x0000, 0x0000, 0x22e3, 0x014e, 0x4419, 0x1be4,
+	    0x46aa, 0x0000, 0x17b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4b9d, 0x3813, 0x2f32, 0x0000, 0x1c10, 0x2df0, 0x3e5c, 0x2a34,
+	    0x2b34, 0x0000, 0x098d, 0x0000, 0x1616, 0x0000, 0x118d, 0x4908,
+	    0x2bd1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a3e, 0x47db,
+	    0x0ae3, 0x0000, 0x3b07, 0x0000, 0x0000, 0x41bd, 0x45c9, 0x3d6d,
+	    0x14c5, 0x2e0a, 0x0000, 0x0000, 0x0000, 0x1fdc, 0x30fe, 0x0000,
+	    0x0000, 0x4853, 0x31c5, 0x0000, 0x1ffe, 0x1283, 0x0000, 0x0000,
+	    0x0bcf, 0x1fb0, 0x0000, 0x19dc, 0x1746, 0x0000, 0x2df8, 0x0000,
+	    0x0000, 0x1d24, 0x3c75, 0x0000, 0x2dda, 0x0000, 0x30b0, 0x0000,
+	    0x0000, 0x17f8, 0x148e, 0x0000, 0x0e95, 0x433d, 0x0000, 0x1900,
+	    0x3e7d, 0x36f3, 0x0000, 0x1391, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4b8b, 0x2373, 0x026a, 0x02ec,
+	    0x2231, 0x0000, 0x488c, 0x0000, 0x4314, 0x0000, 0x0000, 0x0000,
+	    0x4030, 0x14d7, 0x35f9, 0x2be0, 0x4d24, 0x3876, 0x25e9, 0x0000,
+	    0x19e2, 0x343d, 0x0000, 0x320a, 0x0000, 0x0000, 0x266d, 0x0387,
+	    0x4c83, 0x2ebd, 0x0000, 0x3aba, 0x13ab, 0x0000, 0x2c00, 0x0000,
+	    0x0000, 0x0000, 0x2fcd, 0x27ab, 0x0000, 0x431a, 0x0000, 0x1975,
+	    0x3020, 0x0104, 0x4c28, 0x36a3, 0x2af3, 0x335a, 0x0b76, 0x26ea,
+	    0x4830, 0x173b, 0x0000, 0x0000, 0x2db6, 0x0000, 0x0000, 0x0f50,
+	    0x1acc, 0x2fc5, 0x0000, 0x0000, 0x0000, 0x33e6, 0x4143, 0x1271,
+	    0x0000, 0x2dc1, 0x4380, 0x0c90, 0x0000, 0x3f2c, 0x4863, 0x1156,
+	    0x0000, 0x0000, 0x45d9, 0x16f6, 0x2aa6, 0x34c5, 0x0000, 0x3afa,
+	    0x1121, 0x33a2, 0x2ab6, 0x2048, 0x0000, 0x364c, 0x0000, 0x0000,
+	    0x0000, 0x1c2c, 0x1e26, 0x0000, 0x0000, 0x0000, 0x2b64, 0x29c3,
+	    0x0000, 0x3c5c, 0x0000, 0x0000, 0x1e4e, 0x2f51, 0x0000, 0x0410,
+	    0x18b2, 0x47fb, 0x20a4, 0x22d4, 0x0000, 0x2eac, 0x325f, 0x0000,
+	    0x24cf, 0x3ac5, 0x32fd, 0x0000, 0x466a, 0x35be, 0x0000, 0x0000,
+	    0x0cd0, 0x1519, 0x0000, 0x1dd5, 0x0000, 0x44a3, 0x1282, 0x1e59,
+	    0x0000, 0x0000, 0x0007, 0x3480, 0x0000, 0x0000, 0x0000, 0x287d,
+	    0x1e94, 0x0000, 0x0000, 0x0000, 0x38a9, 0x0000, 0x0065, 0x31c9,
+	    0x0000, 0x128f, 0x4789, 0x4d50, 0x0000, 0x3a59, 0x0000, 0x0000,
+	    0x2443, 0x0000, 0x2e31, 0x1bc2, 0x23d4, 0x0000, 0x0000, 0x0000,
+	    0x3abe, 0x05fe, 0x17ca, 0x0000, 0x0000, 0x0000, 0x2912, 0x2295,
+	    0x457b, 0x0000, 0x0000, 0x363c, 0x19c5, 0x0e46, 0x0000, 0x049a,
+	    0x1374, 0x1ba1, 0x0000, 0x0000, 0x25bd, 0x26eb, 0x06bf, 0x0000,
+	    0x18f4, 0x46a4, 0x0000, 0x0000, 0x0000, 0x48d9, 0x33c0, 0x0fac,
+	    0x3c14, 0x128a, 0x4e1d, 0x0000, 0x1e35, 0x0000, 0x0b2a, 0x4137,
+	    0x0000, 0x0000, 0x0000, 0x1bfe, 0x1ce3, 0x2b78, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x127d, 0x0000, 0x1ed8, 0x3c84, 0x0000, 0x0000,
+	    0x0000, 0x1899, 0x0ef4, 0x3e1f, 0x32bb, 0x02ec, 0x44b7, 0x15eb,
+	    0x4d2f, 0x4b24, 0x0000, 0x0940, 0x0c33, 0x3661, 0x0000, 0x0000,
+	    0x17b0, 0x302c, 0x38e0, 0x0000, 0x4b1c, 0x343a, 0x490a, 0x001a,
+	    0x0000, 0x0000, 0x0000, 0x1b23, 0x1fb4, 0x0127, 0x0855, 0x0000,
+	    0x21fb, 0x0000, 0x2068, 0x4360, 0x0000, 0x22c8, 0x0000, 0x32b4,
+	    0x0000, 0x004b, 0x33fa, 0x1c3b, 0x0000, 0x0000, 0x2450, 0x1463,
+	    0x1e51, 0x12b1, 0x3c7b, 0x0916, 0x0000, 0x0000, 0x24cc, 0x4155,
+	    0x0000, 0x3cf2, 0x0000, 0x12b1, 0x0000, 0x0000, 0x2d7a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1327, 0x0000, 0x4cb5, 0x0fc6, 0x16bb,
+	    0x0000, 0x0ea8, 0x48ae, 0x1ed7, 0x04c2, 0x393a, 0x0000, 0x0000,
+	    0x0000, 0x1259, 0x26e5, 0x0000, 0x1346, 0x4a4f, 0x25cf, 0x2131,
+	    0x083a, 0x2f3c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3b85, 0x0000, 0x3617, 0x0000, 0x0000, 0x314b, 0x46a5, 0x35ec,
+	    0x07d8, 0x0000, 0x4d71, 0x0c7e, 0x307a, 0x0000, 0x0000, 0x1a58,
+	    0x0000, 0x0000, 0x4910, 0x084e, 0x1933, 0x38a1, 0x0566, 0x34f6,
+	    0x0000, 0x0000, 0x1cce, 0x03ff, 0x01ce, 0x0000, 0x01e5, 0x0000,
+	    0x2f8f, 0x0000, 0x4e1a, 0x34bb, 0x0000, 0x0000, 0x2ede, 0x0740,
+	    0x0000, 0x0000, 0x0000, 0x3bcf, 0x08ee, 0x0000, 0x0000, 0x2571,
+	    0x1584, 0x0000, 0x424f, 0x0dc9, 0x1f94, 0x0000, 0x11ec, 0x0000,
+	    0x43c7, 0x0000, 0x4bb5, 0x3305, 0x2f82, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x18c7, 0x3321, 0x100d, 0x0000, 0x3f1b, 0x0000, 0x2dcc,
+	    0x454e, 0x0000, 0x1eff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3056, 0x2cf3, 0x0000, 0x0000, 0x0000, 0x3bb2,
+	    0x35e9, 0x0000, 0x1df7, 0x0000, 0x3afb, 0x0000, 0x3d23, 0x15fe,
+	    0x0000, 0x0000, 0x0000, 0x4790, 0x0000, 0x0000, 0x2556, 0x333c,
+	    0x27ad, 0x0696, 0x0000, 0x0000, 0x0000, 0x1217, 0x0000, 0x0000,
+	    0x0000, 0x362b, 0x0ace, 0x0000, 0x4938, 0x3a50, 0x0000, 0x0000,
+	    0x0000, 0x01cc, 0x0000, 0x102c, 0x2b6d, 0x3588, 0x15a7, 0x2d14,
+	    0x0000, 0x36f7, 0x0000, 0x0000, 0x184b, 0x08f0, 0x1ac1, 0x0a48,
+	    0x3659, 0x0000, 0x01b4, 0x0000, 0x0000, 0x37e3, 0x4af4, 0x2970,
+	    0x0491, 0x0000, 0x0000, 0x289c, 0x0000, 0x0000, 0x0000, 0x21fc,
+	    0x0000, 0x273b, 0x0000, 0x2867, 0x0ccc, 0x36eb, 0x0000, 0x0000,
+	    0x3051, 0x11aa, 0x3ac6, 0x3832, 0x0000, 0x01a3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x108c, 0x4c9a, 0x1a00, 0x0b4d, 0x3b9f, 0x3c57,
+	    0x0000, 0x0000, 0x3125, 0x3453, 0x3f2c, 0x0000, 0x4d4b, 0x17a7,
+	    0x0000, 0x06b4, 0x3459, 0x3f16, 0x1c4e, 0x086a, 0x4340, 0x3ed7,
+	    0x2c7d, 0x3241, 0x0000, 0x0d89, 0x476a, 0x0000, 0x0000, 0x0000,
+	    0x31f4, 0x13b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x46d9, 0x0000,
+	    0x0000, 0x2bc2, 0x20c2, 0x23d5, 0x0000, 0x0000, 0x3f0b, 0x0000,
+	    0x0000, 0x470e, 0x2599, 0x0a72, 0x2e15, 0x44cf, 0x0000, 0x3773,
+	    0x0000, 0x019a, 0x0b50, 0x4bc4, 0x1206, 0x0000, 0x4da2, 0x0000,
+	    0x0b8e, 0x0000, 0x4992, 0x444c, 0x199f, 0x0000, 0x0000, 0x0000,
+	    0x1dfd, 0x2c73, 0x16f5, 0x0000, 0x4a06, 0x0000, 0x0000, 0x0000,
+	    0x2552, 0x0000, 0x0000, 0x0aad, 0x4635, 0x0000, 0x432f, 0x0000,
+	    0x1cf8, 0x4401, 0x0000, 0x0000, 0x4b90, 0x3294, 0x0000, 0x061c,
+	    0x10ec, 0x0000, 0x0000, 0x0000, 0x1ab2, 0x45fc, 0x35ae, 0x0a95,
+	    0x0000, 0x0c6d, 0x0000, 0x0000, 0x4263, 0x0000, 0x434b, 0x0000,
+	    0x0000, 0x3d85, 0x2633, 0x0000, 0x0000, 0x3175, 0x305f, 0x0000,
+	    0x42a7, 0x0000, 0x2a43, 0x401d, 0x0000, 0x0000, 0x304e, 0x06cb,
+	    0x2bea, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cfa, 0x3f05, 0x0000,
+	    0x060e, 0x20f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffd, 0x3055,
+	    0x1ba0, 0x0000, 0x157d, 0x4705, 0x02a8, 0x0000, 0x0000, 0x35f2,
+	    0x2358, 0x245c, 0x0000, 0x0be5, 0x3965, 0x0000, 0x19b1, 0x0000,
+	    0x0000, 0x0000, 0x4558, 0x0000, 0x1998, 0x0000, 0x0aba, 0x0000,
+	    0x0000, 0x0000, 0x1cb4, 0x2b27, 0x1d61, 0x0000, 0x26b1, 0x0bfa,
+	    0x0447, 0x4d09, 0x0000, 0x3597, 0x0000, 0x4892, 0x0000, 0x423b,
+	    0x1ea8, 0x4184, 0x0000, 0x1947, 0x0000, 0x0000, 0x0000, 0x453a,
+	    0x0000, 0x3b5e, 0x0000, 0x156c, 0x386d, 0x0000, 0x4c06, 0x1cdb,
+	    0x3f11, 0x0d8d, 0x0000, 0x2430, 0x0000, 0x0000, 0x0000, 0x0322,
+	    0x0000, 0x09aa, 0x3d26, 0x0000, 0x318e, 0x0353, 0x2d74, 0x0312,
+	    0x4adb, 0x0b77, 0x2950, 0x0000, 0x484c, 0x3290, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1211, 0x0dfa, 0x0000, 0x1525, 0x2f79, 0x0405,
+	    0x0000, 0x1d96, 0x08f3, 0x0245, 0x0000, 0x0000, 0x0000, 0x3abf,
+	    0x0f0f, 0x47b9, 0x0000, 0x2d29, 0x0d68, 0x07fb, 0x0450, 0x3942,
+	    0x0000, 0x3b34, 0x0000, 0x0000, 0x136c, 0x31a1, 0x31d9, 0x0000,
+	    0x0d53, 0x08fb, 0x0000, 0x0000, 0x35b3, 0x342f, 0x2213, 0x0000,
+	    0x0000, 0x0df3, 0x0d44, 0x0000, 0x0000, 0x4236, 0x0000, 0x0c6e,
+	    0x0000, 0x0000, 0x2318, 0x0000, 0x2216, 0x0000, 0x0000, 0x4734,
+	    0x0000, 0x03f9, 0x1792, 0x4cb7, 0x0000, 0x0000, 0x3d4a, 0x0000,
+	    0x2bf8, 0x06e3, 0x0000, 0x282c, 0x2a5d, 0x0000, 0x3e0b, 0x08ef,
+	    0x34e8, 0x0000, 0x18da, 0x0000, 0x0000, 0x0000, 0x0000, 0x21d4,
+	    0x39bc, 0x10f0, 0x35a5, 0x0000, 0x0000, 0x1a01, 0x0000, 0x02f6,
+	    0x0000, 0x1b97, 0x42b8, 0x414e, 0x0000, 0x36c2, 0x3555, 0x0000,
+	    0x0000, 0x0000, 0x209c, 0x0000, 0x0000, 0x2e78, 0x331b, 0x4a25,
+	    0x0000, 0x1e66, 0x1a40, 0x2e41, 0x0000, 0x36f2, 0x241e, 0x3157,
+	    0x0000, 0x09ef, 0x4244, 0x45f0, 0x2179, 0x48a6, 0x0000, 0x2075,
+	    0x0e4a, 0x0b6d, 0x4443, 0x0000, 0x1c5f, 0x0000, 0x05dd, 0x0000,
+	    0x0000, 0x159b, 0x0000, 0x0000, 0x16ef, 0x4b9c, 0x41d5, 0x0499,
+	    0x0cf6, 0x2b00, 0x2f16, 0x106d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x06f0, 0x0000, 0x09a2, 0x35ca, 0x0000, 0x0000, 0x267e,
+	    0x4750, 0x0000, 0x44af, 0x1f55, 0x460b, 0x273c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x12ce, 0x3971, 0x0aca, 0x0000, 0x2776, 0x0000,
+	    0x0000, 0x45bc, 0x0a96, 0x02bd, 0x0000, 0x0000, 0x0b00, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31ae,
+	    0x0299, 0x2936, 0x43ad, 0x4738, 0x0000, 0x2a59, 0x1762, 0x1713,
+	    0x0000, 0x0000, 0x1759, 0x0000, 0x1490, 0x33d1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24bc, 0x0f6f, 0x0000, 0x4180, 0x146c,
+	    0x0a89, 0x46dc, 0x0000, 0x219e, 0x0000, 0x37b2, 0x4afd, 0x0000,
+	    0x0956, 0x0230, 0x0000, 0x0000, 0x355f, 0x0000, 0x0000, 0x0000,
+	    0x3d64, 0x0000, 0x3ec5, 0x2562, 0x0000, 0x0000, 0x3af7, 0x0000,
+	    0x3f86, 0x1a81, 0x1a44, 0x2a85, 0x07c9, 0x2a26, 0x3b1c, 0x0000,
+	    0x428f, 0x01cf, 0x1dc4, 0x14d5, 0x2897, 0x0c35, 0x3c1f, 0x2f1d,
+	    0x3da3, 0x0000, 0x0000, 0x44f1, 0x390b, 0x336f, 0x2a25, 0x2c10,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0466, 0x3c5a, 0x0000, 0x0000,
+	    0x0000, 0x4008, 0x0000, 0x0b20, 0x0000, 0x0000, 0x0000, 0x31f6,
+	    0x4a15, 0x0000, 0x4a50, 0x0806, 0x3bc5, 0x0000, 0x0000, 0x4412,
+	    0x074c, 0x4187, 0x06f8, 0x0000, 0x36b0, 0x3633, 0x1d16, 0x19a8,
+	    0x0000, 0x39e5, 0x0000, 0x1502, 0x375a, 0x1c56, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0238, 0x02e7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0e76, 0x2e6c, 0x3ea9, 0x0000, 0x0000, 0x20be, 0x02b9,
+	    0x2db2, 0x0000, 0x23b4, 0x0e14, 0x2fb4, 0x0000, 0x0000, 0x396c,
+	    0x1b63, 0x2a78, 0x1302, 0x4a93, 0x0000, 0x0662, 0x2a5c, 0x3f8b,
+	    0x32e7, 0x0000, 0x0000, 0x1d72, 0x0c58, 0x0000, 0x0000, 0x0000,
+	    0x486a, 0x0000, 0x0000, 0x0000, 0x045c, 0x3d54, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2c9b, 0x0000, 0x4860, 0x1b0a, 0x128c, 0x0000,
+	    0x18f2, 0x31aa, 0x23b2, 0x0000, 0x0000, 0x0b13, 0x1dc8, 0x1d71,
+	    0x0000, 0x0000, 0x318f, 0x0000, 0x3a85, 0x1429, 0x0000, 0x0000,
+	    0x241b, 0x0000, 0x0000, 0x2e09, 0x2976, 0x0000, 0x3a32, 0x30eb,
+	    0x0000, 0x0000, 0x0000, 0x403c, 0x1821, 0x0000, 0x29de, 0x460c,
+	    0x3080, 0x03cf, 0x0000, 0x17ad, 0x0000, 0x0000, 0x2610, 0x190b,
+	    0x243e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4582,
+	    0x0c6c, 0x4d4b, 0x0000, 0x1785, 0x3abb, 0x2886, 0x0000, 0x1f0d,
+	    0x0000, 0x19ad, 0x4482, 0x173a, 0x4256, 0x0000, 0x31d7, 0x26fb,
+	    0x0000, 0x3637, 0x3975, 0x0000, 0x0000, 0x08ee, 0x1dc3, 0x0000,
+	    0x1add, 0x0000, 0x0000, 0x4b90, 0x2dab, 0x0000, 0x3e44, 0x2c3c,
+	    0x0000, 0x3b25, 0x0d23, 0x0000, 0x0000, 0x3426, 0x0000, 0x104a,
+	    0x2906, 0x0000, 0x416e, 0x4254, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1fe7, 0x28e6, 0x1c19, 0x0000, 0x18f3, 0x089c, 0x0000, 0x064a,
+	    0x189e, 0x491d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x09cb, 0x2fc2, 0x3c5a, 0x48c3, 0x3068, 0x0000, 0x025e, 0x34d5,
+	    0x40df, 0x461e, 0x3d4b, 0x1961, 0x0000, 0x4e0b, 0x28ad, 0x3cb6,
+	    0x0000, 0x4b5e, 0x0000, 0x2d15, 0x1220, 0x3390, 0x0000, 0x0000,
+	    0x1daa, 0x0000, 0x0000, 0x45be, 0x0000, 0x0000, 0x0000, 0x0da5,
+	    0x0000, 0x4cc2, 0x4830, 0x41d1, 0x0000, 0x0000, 0x0000, 0x4452,
+	    0x1f62, 0x0000, 0x4c43, 0x1e57, 0x41fd, 0x0000, 0x0000, 0x0000,
+	    0x08ba, 0x2dab, 0x0000, 0x0000, 0x21d5, 0x0000, 0x0000, 0x0000,
+	    0x0fa8, 0x2509, 0x0000, 0x0000, 0x46c4, 0x0000, 0x0000, 0x07a0,
+	    0x0000, 0x4a23, 0x0000, 0x157f, 0x0000, 0x288f, 0x0000, 0x12e3,
+	    0x34d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d9f, 0x1d21, 0x0a59,
+	    0x1cd3, 0x0000, 0x12a2, 0x0000, 0x0000, 0x0000, 0x1abe, 0x0000,
+	    0x05cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x3975, 0x0000, 0x126b,
+	    0x0000, 0x0637, 0x17f0, 0x0000, 0x0000, 0x0a77, 0x0967, 0x4242,
+	    0x0000, 0x4d85, 0x4724, 0x0000, 0x0000, 0x0000, 0x084f, 0x175d,
+	    0x1220, 0x0000, 0x15eb, 0x2668, 0x4445, 0x4bc9, 0x4184, 0x1581,
+	    0x069e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x247f, 0x0ff7,
+	    0x0000, 0x4d9f, 0x0000, 0x0000, 0x3385, 0x11f0, 0x0000, 0x0bc9,
+	    0x0000, 0x16d8, 0x0000, 0x29ac, 0x0000, 0x3d4e, 0x0000, 0x1d3b,
+	    0x0000, 0x0000, 0x0000, 0x159f, 0x4460, 0x0000, 0x32fc, 0x0000,
+	    0x0000, 0x1c2f, 0x316f, 0x0000, 0x0000, 0x3301, 0x0000, 0x02f7,
+	    0x0a59, 0x0063, 0x12b8, 0x4d1d, 0x0000, 0x3c1f, 0x4d04, 0x0000,
+	    0x2d2d, 0x0000, 0x2e14, 0x0000, 0x21b2, 0x0000, 0x0000, 0x164e,
+	    0x0000, 0x0000, 0x3469, 0x14d8, 0x47af, 0x0000, 0x0079, 0x0567,
+	    0x0000, 0x44c1, 0x443c, 0x4594, 0x16f4, 0x0000, 0x4518, 0x0000,
+	    0x49aa, 0x10c3, 0x1a43, 0x0000, 0x27d7, 0x0000, 0x2eec, 0x2d74,
+	    0x0000, 0x4dd3, 0x4c3b, 0x0000, 0x0000, 0x40ae, 0x3650, 0x1c6a,
+	    0x1275, 0x2d1a, 0x0000, 0x0000, 0x2e54, 0x0000, 0x4825, 0x0000,
+	    0x0000, 0x08d3, 0x21d7, 0x377d, 0x0000, 0x0000, 0x4581, 0x46a6,
+	    0x0000, 0x0000, 0x1dd6, 0x2157, 0x0000, 0x0000, 0x1773, 0x0000,
+	    0x1330, 0x4336, 0x20b1, 0x0000, 0x0000, 0x0000, 0x1bab, 0x0d88,
+	    0x2efc, 0x02df, 0x3bd4, 0x4522, 0x0000, 0x36db, 0x229b, 0x0000,
+	    0x438b, 0x3e36, 0x01ad, 0x0000, 0x0847, 0x21e3, 0x0000, 0x3136,
+	    0x0000, 0x0000, 0x359c, 0x0000, 0x0000, 0x0000, 0x4519, 0x2cdf,
+	    0x0000, 0x33d4, 0x0000, 0x24cf, 0x2856, 0x0000, 0x011f, 0x0000,
+	    0x13ee, 0x314f, 0x3fc2, 0x45a0, 0x0000, 0x1f4d, 0x393e, 0x0000,
+	    0x0000, 0x3d35, 0x0099, 0x0000, 0x1d8a, 0x2aac, 0x0000, 0x0000,
+	    0x41bc, 0x1798, 0x0000, 0x2d69, 0x0000, 0x2849, 0x0000, 0x0cce,
+	    0x4e04, 0x0000, 0x4afc, 0x0000, 0x0000, 0x0000, 0x0000, 0x42b7,
+	    0x24e1, 0x0000, 0x0f72, 0x0000, 0x4459, 0x31e4, 0x01a4, 0x0000,
+	    0x0c2c, 0x0000, 0x2ed0, 0x3169, 0x0000, 0x0000, 0x0000, 0x000e,
+	    0x0000, 0x4355, 0x0000, 0x0000, 0x30b4, 0x0000, 0x0000, 0x2133,
+	    0x22bf, 0x2ea6, 0x40c8, 0x0000, 0x3eb5, 0x349c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0a50, 0x4103, 0x0000, 0x2844, 0x05e0, 0x0000,
+	    0x17f1, 0x1d64, 0x1f2d, 0x3ba7, 0x0000, 0x0000, 0x15f0, 0x0000,
+	    0x0000, 0x46b5, 0x1ee3, 0x0000, 0x2b90, 0x2dde, 0x0000, 0x079f,
+	    0x0000, 0x2cfe, 0x0d1e, 0x0000, 0x0000, 0x331c, 0x0000, 0x0000,
+	    0x452f, 0x3d41, 0x4b2e, 0x2c80, 0x0000, 0x0000, 0x361e, 0x0000,
+	    0x2bae, 0x33bc, 0x0000, 0x0000, 0x0000, 0x0276, 0x2f68, 0x0000,
+	    0x3904, 0x0000, 0x2ebd, 0x0f1c, 0x0000, 0x0e2d, 0x40ab, 0x4426,
+	    0x0000, 0x0000, 0x10ee, 0x2770, 0x27cd, 0x3b04, 0x0000, 0x0000,
+	    0x0ae4, 0x0000, 0x3eb3, 0x03ae, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x28de, 0x0000, 0x0000, 0x15c0, 0x3dc7, 0x304a, 0x0000,
+	    0x1669, 0x0000, 0x0000, 0x075b, 0x06c2, 0x0000, 0x0000, 0x0000,
+	    0x44a6, 0x3e2f, 0x413e, 0x3b85, 0x1d62, 0x0000, 0x447b, 0x1e41,
+	    0x0000, 0x10e5, 0x270f, 0x47b9, 0x3942, 0x0000, 0x0000, 0x3b6d,
+	    0x4b04, 0x285b, 0x0515, 0x014e, 0x0000, 0x0000, 0x0000, 0x336a,
+	    0x0000, 0x40ad, 0x0000, 0x0000, 0x11d8, 0x32ed, 0x0000, 0x128e,
+	    0x3949, 0x0000, 0x0e4e, 0x0000, 0x0000, 0x0de4, 0x3431, 0x07d2,
+	    0x36f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x118f, 0x3be2, 0x39d4, 0x049a, 0x43fc, 0x0000, 0x167f,
+	    0x0000, 0x0000, 0x1cd4, 0x466d, 0x0000, 0x0000, 0x322f, 0x1f01,
+	    0x08ca, 0x48d0, 0x2421, 0x2a38, 0x0000, 0x0ea0, 0x27cb, 0x0469,
+	    0x252f, 0x0000, 0x0a6e, 0x24cc, 0x2e23, 0x0df7, 0x0000, 0x2995,
+	    0x2bf7, 0x0000, 0x0000, 0x4a1a, 0x0000, 0x0000, 0x0914, 0x1bc4,
+	    0x1c25, 0x3ece, 0x3367, 0x0000, 0x02cc, 0x2db9, 0x0000, 0x3502,
+	    0x0711, 0x324c, 0x0000, 0x0000, 0x0000, 0x4410, 0x4882, 0x0000,
+	    0x0000, 0x0000, 0x1060, 0x1f2a, 0x4419, 0x3a6a, 0x4cf8, 0x0000,
+	    0x165c, 0x0000, 0x1b70, 0x0000, 0x0000, 0x4901, 0x0000, 0x077f,
+	    0x0000, 0x0000, 0x2449, 0x3b2f, 0x0000, 0x00ea, 0x38ed, 0x3cc2,
+	    0x0000, 0x1d4b, 0x2536, 0x0000, 0x46e0, 0x10b4, 0x0000, 0x0000,
+	    0x3609, 0x0a08, 0x228f, 0x0000, 0x1e6b, 0x11df, 0x0000, 0x366a,
+	    0x26cb, 0x2d7c, 0x0000, 0x0000, 0x0a4b, 0x0a5e, 0x11d0, 0x0000,
+	    0x2595, 0x2b42, 0x0000, 0x381f, 0x41f2, 0x1e09, 0x0000, 0x0000,
+	    0x2bf4, 0x0000, 0x0f50, 0x493d, 0x0000, 0x3a11, 0x0000, 0x0000,
+	    0x0000, 0x2df0, 0x0000, 0x0d56, 0x3b2e, 0x0000, 0x0ae9, 0x0000,
+	    0x0000, 0x315d, 0x3968, 0x0000, 0x0000, 0x30c4, 0x0000, 0x21dc,
+	    0x0000, 0x0000, 0x3264, 0x0000, 0x0bcd, 0x3e70, 0x0000, 0x0d4a,
+	    0x0000, 0x060f, 0x0000, 0x3e1d, 0x2335, 0x0000, 0x0000, 0x1a22,
+	    0x0304, 0x0000, 0x0eab, 0x34bd, 0x390d, 0x0000, 0x0000, 0x4665,
+	    0x363c, 0x3d59, 0x0000, 0x115a, 0x3a03, 0x477c, 0x4aff, 0x0000,
+	    0x0000, 0x0000, 0x219e, 0x2c07, 0x0000, 0x0489, 0x0000, 0x0000,
+	    0x0000, 0x0962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x361c,
+	    0x0000, 0x0000, 0x0000, 0x47f0, 0x0000, 0x0000, 0x15bf, 0x0000,
+	    0x0000, 0x0000, 0x41a5, 0x0000, 0x3cce, 0x389c, 0x0000, 0x27a5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x46c2, 0x0000, 0x0000, 0x0000,
+	    0x3f88, 0x23a5, 0x0115, 0x174e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3246, 0x0000, 0x0000, 0x0000, 0x46cb, 0x2d27, 0x0000,
+	    0x0b06, 0x0000, 0x3e33, 0x0000, 0x0000, 0x31f3, 0x34ea, 0x0000,
+	    0x0000, 0x0000, 0x1b5a, 0x1d34, 0x3c81, 0x0000, 0x29cd, 0x0000,
+	    0x3d84, 0x24b5, 0x1e1d, 0x0894, 0x0000, 0x3039, 0x2098, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3982, 0x0000, 0x0000, 0x3989,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2a04, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1341, 0x0000, 0x0000, 0x240f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x47ac, 0x0000, 0x0000, 0x1aa2,
+	    0x3a01, 0x0000, 0x0000, 0x0000, 0x0000, 0x005b, 0x0000, 0x0000,
+	    0x2e2a, 0x3648, 0x0000, 0x0000, 0x0000, 0x048d, 0x42b3, 0x0000,
+	    0x0000, 0x0000, 0x3ea5, 0x3a91, 0x0000, 0x3bc7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x14b5, 0x391a, 0x291f, 0x0000, 0x0000,
+	    0x0000, 0x0d08, 0x4cc9, 0x17c4, 0x0000, 0x0000, 0x440c, 0x02bf,
+	    0x0000, 0x224d, 0x49ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x46c8, 0x1076, 0x0000, 0x0000, 0x0000, 0x1aae, 0x0000, 0x0000,
+	    0x0000, 0x4c17, 0x0000, 0x4581, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x242c, 0x0334, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c54,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4dd6, 0x1e96,
+	    0x3f43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a11, 0x484d,
+	    0x06c5, 0x090a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2b98, 0x21b4, 0x22e8, 0x0000, 0x0000, 0x0000, 0x2195,
+	    0x2bef, 0x0000, 0x0000, 0x0acb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x22a0, 0x0000, 0x362c, 0x0000, 0x0000, 0x0000, 0x164c,
+	    0x0000, 0x0000, 0x0000, 0x4c1f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x203f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1cb8, 0x33d7, 0x38f1, 0x1af8, 0x0000, 0x0000, 0x2211, 0x0000,
+	    0x0000, 0x2a42, 0x0000, 0x0000, 0x0000, 0x0000, 0x1986, 0x0000,
+	    0x1096, 0x4b44, 0x0819, 0x0000, 0x0000, 0x0000, 0x3fa6, 0x0000,
+	    0x45f8, 0x4c60, 0x3465, 0x0000, 0x005d, 0x0000, 0x1864, 0x2fdd,
+	    0x0000, 0x1e25, 0x0000, 0x0000, 0x178f, 0x07ed, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3c1d, 0x0000, 0x130e, 0x152d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3b25, 0x0000, 0x0000, 0x2173, 0x1c4c, 0x0000,
+	    0x0000, 0x2861, 0x0000, 0x0000, 0x0000, 0x390e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4819,
+	    0x0000, 0x0000, 0x3a63, 0x0000, 0x0000, 0x0000, 0x45ca, 0x0000,
+	    0x451e, 0x0208, 0x0000, 0x0000, 0x0000, 0x2a5d, 0x0000, 0x3d04,
+	    0x0000, 0x30db, 0x16b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1632, 0x0000, 0x0000, 0x3f7b, 0x0000, 0x17df, 0x441a, 0x0000,
+	    0x0000, 0x0000, 0x149b, 0x0000, 0x0000, 0x2898, 0x0000, 0x3d20,
+	    0x2563, 0x0000, 0x0000, 0x0000, 0x4bd2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0c99, 0x0000, 0x0000, 0x43b3, 0x0000,
+	    0x0000, 0x0ace, 0x03b3, 0x0000, 0x08ac, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x19ed, 0x0000, 0x36c6, 0x3858, 0x0000, 0x1ca4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x36b4, 0x1eb1, 0x0000, 0x0000,
+	    0x4294, 0x0000, 0x392c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4d02, 0x4b6a, 0x0332, 0x0000, 0x3bf4, 0x0000, 0x2700, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2e2c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1794, 0x49e0, 0x0000, 0x0000, 0x0930, 0x4d2d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3212, 0x0000, 0x0000, 0x0000, 0x2573,
+	    0x0000, 0x0000, 0x0000, 0x0ad0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19ee, 0x0000,
+	    0x0000, 0x192f, 0x0000, 0x2573, 0x0000, 0x440e, 0x0000, 0x0000,
+	    0x3a2f, 0x0bd0, 0x428a, 0x0267, 0x14d0, 0x0000, 0x0000, 0x220a,
+	    0x0000, 0x0bae, 0x237f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1fc9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3651, 0x0000, 0x0000, 0x0000,
+	    0x4a82, 0x0000, 0x0000, 0x168c, 0x027e, 0x3f95, 0x3059, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b81, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24d9, 0x0000, 0x4cf3, 0x0000, 0x2d7f,
+	    0x0000, 0x0000, 0x4105, 0x0000, 0x2e0d, 0x017c, 0x0000, 0x0ca3,
+	    0x0000, 0x0000, 0x0000, 0x4c3a, 0x3b9a, 0x0000, 0x0000, 0x315f,
+	    0x0000, 0x2a67, 0x0000, 0x49b1, 0x0000, 0x2b86, 0x4d31, 0x0000,
+	    0x0000, 0x0000, 0x0904, 0x0000, 0x0000, 0x2664, 0x1047, 0x0000,
+	    0x403d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1f60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x167d, 0x0000, 0x0000, 0x0000, 0x1719, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3f11, 0x0000, 0x0000, 0x0000, 0x0000, 0x37ca, 0x0000,
+	    0x3201, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4328,
+	    0x0000, 0x0000, 0x3c1b, 0x3bf6, 0x1bfa, 0x0000, 0x234e, 0x0000,
+	    0x13fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x451d, 0x0000,
+	    0x0000, 0x09bd, 0x4b2d, 0x0000, 0x16a7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1ece, 0x2bb7, 0x1061, 0x0000, 0x1220, 0x2d3a, 0x31e7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4b46, 0x0000, 0x0000, 0x218a, 0x1230, 0x0566, 0x341c, 0x3d3f,
+	    0x4002, 0x0000, 0x0000, 0x3962, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1924, 0x34de, 0x0677, 0x447f, 0x3168, 0x0000, 0x449e,
+	    0x0000, 0x2cc7, 0x0000, 0x1658, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x259b, 0x0000, 0x0000, 0x1fbb, 0x388e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x038c, 0x49c0, 0x0000, 0x437d, 0x0000, 0x3b1b, 0x07df,
+	    0x4ce0, 0x0000, 0x25bd, 0x0000, 0x47ec, 0x1156, 0x0000, 0x0000,
+	    0x44c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c03,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4997, 0x0000,
+	    0x0000, 0x0000, 0x1d18, 0x0000, 0x1b7f, 0x0000, 0x0000, 0x0000,
+	    0x3104, 0x4a03, 0x0000, 0x0000, 0x0000, 0x4860, 0x4401, 0x0000,
+	    0x0000, 0x0000, 0x2bb5, 0x0000, 0x0000, 0x17da, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0e55, 0x0000, 0x2417, 0x0000, 0x0000, 0x0916,
+	    0x0000, 0x0000, 0x461a, 0x44fc, 0x0000, 0x0000, 0x0000, 0x4666,
+	    0x0c6e, 0x4757, 0x3342, 0x0000, 0x0000, 0x1e09, 0x08bd, 0x1678,
+	    0x0000, 0x0000, 0x04c6, 0x0000, 0x30f5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1077, 0x0000, 0x05a0, 0x0000, 0x2d38, 0x0000, 0x0000,
+	    0x0000, 0x0150, 0x0000, 0x37c4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3e30, 0x0000, 0x0000, 0x0c7e, 0x3b85,
+	    0x0000, 0x439e, 0x0000, 0x361e, 0x0000, 0x0000, 0x1816, 0x0000,
+	    0x0b84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x497b, 0x0000, 0x0000, 0x0000, 0x3692,
+	    0x0000, 0x0f3c, 0x0000, 0x0f2b, 0x0000, 0x0000, 0x0b61, 0x0000,
+	    0x2829, 0x1e3e, 0x0000, 0x23da, 0x100a, 0x0000, 0x20d7, 0x4342,
+	    0x0000, 0x3fb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0da7, 0x0000, 0x0000, 0x243d, 0x0000, 0x0000, 0x14be,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4451, 0x0000,
+	    0x0a57, 0x168b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2142, 0x12df, 0x0000, 0x4912, 0x2759, 0x4bed, 0x0000, 0x0db7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31c5, 0x2040,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23ce, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x175c, 0x0000, 0x0000, 0x3f8e, 0x0000,
+	    0x1b31, 0x0000, 0x0000, 0x0000, 0x0000, 0x4561, 0x0000, 0x0000,
+	    0x0000, 0x1ce2, 0x0000, 0x0000, 0x2c29, 0x0000, 0x0000, 0x211e,
+	    0x0000, 0x421f, 0x0000, 0x1e67, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x28fd, 0x3b2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3db7,
+	    0x0000, 0x0d2f, 0x3cde, 0x308f, 0x1a8b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4ab3, 0x0000, 0x0000, 0x0000,
+	    0x105c, 0x0000, 0x3296, 0x02d6, 0x2ebe, 0x0000, 0x1037, 0x2664,
+	    0x16aa, 0x2f6d, 0x0fff, 0x3608, 0x0000, 0x08d7, 0x41c0, 0x0000,
+	    0x0000, 0x0000, 0x387c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x273c, 0x0000, 0x3ad4, 0x29bd, 0x0000,
+	    0x4514, 0x0000, 0x0000, 0x043e, 0x0610, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f34, 0x0000, 0x37e1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1001, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x370b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2eb0, 0x0000, 0x2f23, 0x0000, 0x0000, 0x0159, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x049e, 0x0000, 0x4396, 0x1fdd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0454, 0x081f, 0x0000,
+	    0x0000, 0x0000, 0x3df4, 0x0000, 0x0000, 0x0000, 0x313f, 0x0000,
+	    0x0000, 0x42ab, 0x0000, 0x0000, 0x0000, 0x3c15, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4455, 0x0000, 0x1acc, 0x0000, 0x36f0,
+	    0x0000, 0x48b0, 0x0000, 0x1357, 0x0000, 0x17ee, 0x0000, 0x0000,
+	    0x0000, 0x00e5, 0x0000, 0x0000, 0x1e92, 0x15f6, 0x0000, 0x0000,
+	    0x09d7, 0x0000, 0x0000, 0x2897, 0x2ad8, 0x0000, 0x1778, 0x02f9,
+	    0x0000, 0x1293, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bd1,
+	    0x0000, 0x0000, 0x0000, 0x42ec, 0x0000, 0x0000, 0x0000, 0x1213,
+	    0x3051, 0x0000, 0x1d6b, 0x0000, 0x0000, 0x0000, 0x4359, 0x0000,
+	    0x0000, 0x2915, 0x0000, 0x0000, 0x0000, 0x1701, 0x0000, 0x0000,
+	    0x05d8, 0x26d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2e5b, 0x139e, 0x1fad, 0x0000,
+	    0x0000, 0x2278, 0x15d1, 0x0000, 0x2279, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a62, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3d67, 0x4976, 0x0000, 0x0000,
+	    0x0533, 0x0000, 0x0000, 0x47f5, 0x0000, 0x3e71, 0x3ff8, 0x0000,
+	    0x0000, 0x0818, 0x0000, 0x0000, 0x0000, 0x0000, 0x0460, 0x1924,
+	    0x4497, 0x0000, 0x3b80, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3597, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0a30, 0x0000, 0x0000, 0x02fb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3cdc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a4d, 0x0000, 0x0000,
+	    0x08d6, 0x0000, 0x0c35, 0x0273, 0x0000, 0x3416, 0x0000, 0x0000,
+	    0x0000, 0x11fd, 0x0000, 0x0000, 0x050c, 0x0000, 0x0000, 0x342d,
+	    0x0000, 0x0000, 0x0000, 0x34df, 0x0000, 0x0000, 0x1812, 0x0000,
+	    0x0000, 0x0404, 0x0000, 0x0000, 0x0000, 0x1a4e, 0x0000, 0x0000,
+	    0x1221, 0x0000, 0x0000, 0x3b99, 0x13c7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bfa, 0x0000,
+	    0x0000, 0x0000, 0x2cf7, 0x0000, 0x0000, 0x2062, 0x0333, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x40ec, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2166, 0x25a9, 0x0000, 0x2f78, 0x0000,
+	    0x0000, 0x0000, 0x02e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4b8d, 0x359d, 0x4056, 0x0000, 0x0000, 0x0000, 0x3097, 0x0000,
+	    0x0426, 0x0000, 0x379f, 0x0000, 0x0000, 0x0000, 0x0000, 0x1653,
+	    0x4431, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26ea, 0x0000,
+	    0x0000, 0x0000, 0x1d56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3f73, 0x0000, 0x0000, 0x4dac, 0x0000, 0x421b, 0x45f5, 0x16a1,
+	    0x0000, 0x48df, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2b87, 0x0000, 0x47ce, 0x0000, 0x3d32, 0x0000, 0x2f5d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4534, 0x0000, 0x0000, 0x3906,
+	    0x0000, 0x0000, 0x336c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1c30, 0x470d, 0x0000, 0x0000, 0x0000, 0x28e8, 0x0000,
+	    0x1a95, 0x305f, 0x0000, 0x0ebc, 0x494f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1f82, 0x0000, 0x0000, 0x461e, 0x0000, 0x40de, 0x0000,
+	    0x1cac, 0x0000, 0x23c3, 0x0228, 0x0000, 0x1132, 0x0000, 0x0000,
+	    0x0eb2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x204c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x435c,
+	    0x0000, 0x0000, 0x0000, 0x1f0f, 0x0000, 0x36ce, 0x0000, 0x3ca3,
+	    0x0000, 0x0000, 0x0000, 0x3382, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0693, 0x0000, 0x0000, 0x1805, 0x2af2, 0x0000, 0x19aa, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x07c1, 0x1b27, 0x0000, 0x2a00, 0x0000,
+	    0x0000, 0x0000, 0x0a87, 0x2628, 0x2536, 0x0000, 0x0000, 0x0000,
+	    0x1c15, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e2a, 0x0000, 0x0000,
+	    0x47f4, 0x0000, 0x0ebb, 0x0000, 0x2980, 0x0000, 0x3298, 0x4bb7,
+	    0x0000, 0x0000, 0x0000, 0x230c, 0x4c06, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3361, 0x3604, 0x0000, 0x4b61, 0x4abc, 0x0000, 0x0000,
+	    0x0000, 0x00a3, 0x0000, 0x3bb2, 0x0000, 0x0000, 0x3faf, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3c9d, 0x0000, 0x0000, 0x0000,
+	    0x0109, 0x0000, 0x3efb, 0x0c96, 0x0000, 0x3e21, 0x0000, 0x0000,
+	    0x3433, 0x0000, 0x0e0f, 0x0000, 0x0000, 0x0000, 0x3774, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21eb,
+	    0x0000, 0x4285, 0x0000, 0x30e2, 0x3a8b, 0x0000, 0x0000, 0x315a,
+	    0x0000, 0x0000, 0x2614, 0x0000, 0x0000, 0x0000, 0x0000, 0x0036,
+	    0x0000, 0x0000, 0x03c9, 0x0000, 0x0015, 0x0000, 0x47e6, 0x0000,
+	    0x0000, 0x19aa, 0x4637, 0x0000, 0x1a34, 0x0000, 0x0000, 0x0000,
+	    0x3c58, 0x0000, 0x468f, 0x0000, 0x0000, 0x0000, 0x27fc, 0x08d8,
+	    0x009a, 0x0000, 0x36e4, 0x0000, 0x0000, 0x0000, 0x2c3d, 0x0000,
+	    0x0000, 0x0000, 0x49d7, 0x0000, 0x0000, 0x4839, 0x3b16, 0x0000,
+	    0x0000, 0x14c9, 0x45a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1cd5, 0x0e28, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x27ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3257, 0x48b0, 0x0fb1, 0x0000, 0x0000, 0x0000, 0x2682, 0x0000,
+	    0x0000, 0x0000, 0x2657, 0x0000, 0x0000, 0x4abe, 0x11c2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3721, 0x0c72, 0x0000,
+	    0x0000, 0x0000, 0x43eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x49ee,
+	    0x22ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f11,
+	    0x0000, 0x0000, 0x0000, 0x384d, 0x0000, 0x0000, 0x0000, 0x11a5,
+	    0x0000, 0x0dd1, 0x0000, 0x4954, 0x0000, 0x0000, 0x0000, 0x2b20,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4b9c, 0x0000, 0x0000, 0x0000,
+	    0x11fe, 0x25de, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0511, 0x0000, 0x0d58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1654, 0x0000, 0x0000, 0x1c74, 0x3b63, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1820, 0x0000, 0x0000, 0x0000, 0x0499, 0x2b6f,
+	    0x0000, 0x0000, 0x0ef6, 0x0000, 0x1b2a, 0x15ce, 0x1299, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x025e, 0x0000, 0x1600, 0x0000,
+	    0x4293, 0x0000, 0x0000, 0x38a7, 0x2b52, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24b1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d4f, 0x0000,
+	    0x0000, 0x0000, 0x0e45, 0x2e10, 0x4499, 0x0000, 0x4473, 0x0000,
+	    0x0000, 0x247a, 0x04e3, 0x0000, 0x104c, 0x0000, 0x0000, 0x0000,
+	    0x0f47, 0x0000, 0x246a, 0x0000, 0x0000, 0x0fd8, 0x28bf, 0x0000,
+	    0x0000, 0x0b61, 0x3def, 0x0000, 0x0000, 0x1fd9, 0x25cd, 0x2363,
+	    0x0000, 0x0000, 0x0000, 0x20ac, 0x188b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1ab5, 0x0000, 0x2eb8, 0x0000, 0x4c20, 0x0000, 0x0000,
+	    0x3902, 0x0000, 0x2fae, 0x1f6a, 0x220d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x20d2, 0x4648, 0x362c, 0x0000, 0x0000, 0x442a,
+	    0x0000, 0x1f01, 0x0000, 0x0000, 0x0000, 0x3a05, 0x0000, 0x0000,
+	    0x47f2, 0x1e7c, 0x0000, 0x0000, 0x1e01, 0x3bec, 0x023a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x196c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x146f,
+	    0x0000, 0x1ff2, 0x0000, 0x298e, 0x0f88, 0x0000, 0x0000, 0x19d2,
+	    0x0000, 0x2662, 0x49a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e3c,
+	    0x0000, 0x0923, 0x0774, 0x0000, 0x30c7, 0x19b7, 0x3686, 0x4333,
+	    0x0000, 0x0000, 0x0000, 0x2022, 0x0000, 0x0000, 0x2e19, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1fed, 0x0000, 0x3e45, 0x0000, 0x0be6,
+	    0x0000, 0x3285, 0x0000, 0x1017, 0x2000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3542, 0x1da0, 0x0074, 0x48f2, 0x1f05, 0x2870, 0x0000,
+	    0x08f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06f6,
+	    0x3485, 0x0000, 0x4771, 0x0000, 0x31e0, 0x0000, 0x1e8d, 0x4403,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x0000, 0x4c13, 0x0000,
+	    0x4ca6, 0x0000, 0x3738, 0x0000, 0x0000, 0x0000, 0x2415, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2dd2, 0x0000, 0x0000, 0x0000, 0x4422,
+	    0x0000, 0x0000, 0x490c, 0x0000, 0x4517, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3d7a, 0x0000, 0x0000, 0x0000, 0x1434, 0x0000, 0x4af2,
+	    0x3975, 0x0000, 0x0000, 0x20a8, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2d1f, 0x3a4d, 0x0000, 0x07c5, 0x44c5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b1d, 0x0000,
+	    0x3eff, 0x0000, 0x0000, 0x210d, 0x0000, 0x35ba, 0x0000, 0x0000,
+	    0x2086, 0x0000, 0x0000, 0x0000, 0x0000, 0x4501, 0x0000, 0x0000,
+	    0x0000, 0x0e53, 0x2b5f, 0x0000, 0x0000, 0x0000, 0x0000, 0x48c4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x189a,
+	    0x4daf, 0x0000, 0x31ff, 0x292c, 0x0ce0, 0x0000, 0x0000, 0x1d09,
+	    0x0000, 0x0000, 0x305c, 0x47b2, 0x0000, 0x0000, 0x0000, 0x10d8,
+	    0x0000, 0x00b1, 0x3749, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1f23, 0x0000, 0x22d0, 0x0000, 0x0000, 0x0f79,
+	    0x0000, 0x0000, 0x0000, 0x2a8d, 0x0000, 0x0bba, 0x2f19, 0x0000,
+	    0x0000, 0x0000, 0x02d8, 0x0000, 0x0053, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4dd1, 0x27bf, 0x0000, 0x0000, 0x3ed3, 0x330d, 0x09c9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x440d,
+	    0x4640, 0x0000, 0x0000, 0x0000, 0x0000, 0x13be, 0x22d2, 0x3e2a,
+	    0x40d0, 0x2fed, 0x176d, 0x1b7f, 0x0000, 0x0000, 0x0000, 0x20ba,
+	    0x2eb5, 0x113f, 0x0000, 0x0000, 0x0000, 0x0000, 0x2457, 0x2a47,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e7d, 0x0000, 0x4772, 0x0000,
+	    0x0f5a, 0x0e31, 0x0c98, 0x3f47, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x20fd, 0x0000, 0x09e7, 0x0000, 0x0689, 0x0ade, 0x368e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x474a, 0x3162, 0x0000, 0x0000, 0x04e8,
+	    0x0000, 0x0000, 0x1cc4, 0x0000, 0x0000, 0x0000, 0x4c55, 0x0000,
+	    0x29ac, 0x4111, 0x371b, 0x0000, 0x0fbe, 0x0000, 0x0000, 0x360b,
+	    0x0000, 0x0000, 0x39f1, 0x0000, 0x0000, 0x295a, 0x3d53, 0x0000,
+	    0x0000, 0x0000, 0x0a7d, 0x0000, 0x0334, 0x0000, 0x0000, 0x0000,
+	    0x0db1, 0x119a, 0x0000, 0x0000, 0x0320, 0x404e, 0x0000, 0x23f1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a34, 0x42a1, 0x0000,
+	    0x0000, 0x1433, 0x0000, 0x0000, 0x0000, 0x4227, 0x0544, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2681, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1626, 0x0000, 0x0000, 0x36e0, 0x35b3,
+	    0x0000, 0x156a, 0x0000, 0x0000, 0x0ac1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0006, 0x0000, 0x0000, 0x0000, 0x0d3d,
+	    0x0000, 0x0000, 0x0000, 0x2890, 0x2f63, 0x05e3, 0x0000, 0x3a4a,
+	    0x2a8b, 0x0000, 0x0000, 0x0000, 0x0000, 0x19cd, 0x0000, 0x0991,
+	    0x0000, 0x0000, 0x216a, 0x128c, 0x0000, 0x4d24, 0x0000, 0x0000,
+	    0x0000, 0x34e3, 0x0000, 0x0000, 0x17c7, 0x0000, 0x0000, 0x0000,
+	    0x44d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1c96, 0x3688, 0x0000, 0x0000, 0x0000, 0x2649,
+	    0x0000, 0x1aa8, 0x1eec, 0x0000, 0x3182, 0x0000, 0x0000, 0x0000,
+	    0x0b31, 0x28df, 0x0000, 0x241c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4315,
+	    0x49dc, 0x0000, 0x3b2d, 0x0000, 0x223b, 0x2f36, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x445c,
+	    0x0000, 0x10e1, 0x0000, 0x37a4, 0x0000, 0x0000, 0x1c44, 0x396c,
+	    0x0000, 0x4bed, 0x1f38, 0x0000, 0x0000, 0x0000, 0x0000, 0x300d,
+	    0x0000, 0x0000, 0x0c7e, 0x0a3e, 0x2cd1, 0x0000, 0x2399, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x254e, 0x0000, 0x2ee1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1eea, 0x0000,
+	    0x0000, 0x1484, 0x0000, 0x0000, 0x0000, 0x0000, 0x21f2, 0x0344,
+	    0x3393, 0x4b7a, 0x0000, 0x0cad, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3134,
+	    0x1b7e, 0x0000, 0x1839, 0x15c6, 0x0000, 0x0000, 0x1c71, 0x3e79,
+	    0x0000, 0x0000, 0x0000, 0x1066, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x229a, 0x0000, 0x4626, 0x0000, 0x0000, 0x46da,
+	    0x0000, 0x072e, 0x0000, 0x0000, 0x2f5f, 0x0794, 0x0000, 0x0000,
+	    0x0000, 0x2fb9, 0x1392, 0x0000, 0x0000, 0x2bdc, 0x0000, 0x0000,
+	    0x05da, 0x2c76, 0x0000, 0x0000, 0x0000, 0x46aa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4966, 0x0000, 0x0000, 0x04a8, 0x0000,
+	    0x0000, 0x3067, 0x34dc, 0x0000, 0x0df2, 0x1b09, 0x234a, 0x3c4b,
+	    0x14e7, 0x0000, 0x0000, 0x029e, 0x0902, 0x0000, 0x0000, 0x1d25,
+	    0x36e7, 0x0000, 0x0000, 0x2591, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2f6c, 0x4527, 0x1fee, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x11cc, 0x3be0, 0x4db1, 0x0000, 0x0f42, 0x0000, 0x0000, 0x3b75,
+	    0x0000, 0x1f73, 0x0000, 0x373d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0462, 0x06f5, 0x0000, 0x07dc, 0x07f1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4a47, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0210, 0x4d9a, 0x0000, 0x3e24,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x36fb, 0x0000, 0x0000, 0x0000, 0x064a, 0x0000, 0x0000, 0x2593,
+	    0x0000, 0x0000, 0x0000, 0x3518, 0x1838, 0x0000, 0x070d, 0x0000,
+	    0x0000, 0x0000, 0x0b72, 0x029c, 0x0000, 0x0000, 0x2fd0, 0x0977,
+	    0x0000, 0x0000, 0x2a86, 0x0000, 0x0000, 0x0000, 0x1410, 0x0000,
+	    0x0000, 0x0000, 0x0aba, 0x2434, 0x0000, 0x16b1, 0x42a6, 0x0000,
+	    0x34f3, 0x0000, 0x4b91, 0x0000, 0x1210, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x48bd, 0x31b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x285e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2be7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4754, 0x0000, 0x0000, 0x0000, 0x1707, 0x0000, 0x350b,
+	    0x1bc7, 0x0000, 0x4510, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1642, 0x2eb2, 0x0000, 0x0000, 0x3be3, 0x1ce7, 0x00a2, 0x1905,
+	    0x36c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d90, 0x4625, 0x0000,
+	    0x430d, 0x3940, 0x0000, 0x0000, 0x0000, 0x4011, 0x0000, 0x10d4,
+	    0x0000, 0x0000, 0x4654, 0x0000, 0x0000, 0x3f55, 0x152b, 0x34e0,
+	    0x0000, 0x28e6, 0x2b7b, 0x0000, 0x0000, 0x06e9, 0x1da0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x326b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0867, 0x0000, 0x3428, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1e2a, 0x0000, 0x0000, 0x2b87, 0x172a,
+	    0x0000, 0x0000, 0x2cdb, 0x2cc6, 0x0b14, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x48f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4892, 0x0000, 0x0000, 0x2a9d, 0x0000, 0x0000, 0x0000, 0x307d,
+	    0x14cb, 0x0000, 0x08bc, 0x04ae, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x199d, 0x48dc, 0x0000, 0x0000, 0x3003, 0x1264, 0x0000,
+	    0x0000, 0x4270, 0x44ac, 0x21b7, 0x0000, 0x0000, 0x3570, 0x47d4,
+	    0x0000, 0x0000, 0x4ab2, 0x4d9c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4872, 0x4df9, 0x0000, 0x0000, 0x0000, 0x416d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1436, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4146, 0x0000, 0x46d8, 0x0000, 0x0000, 0x0000, 0x1aa8,
+	    0x0000, 0x0000, 0x3cfb, 0x0000, 0x1f5c, 0x0000, 0x0000, 0x0000,
+	    0x2a15, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x118e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2dbb, 0x434b, 0x07da, 0x0000,
+	    0x0000, 0x0000, 0x3020, 0x0000, 0x0000, 0x0000, 0x1cb3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4237, 0x06ed, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2c37, 0x3437, 0x311f, 0x0000, 0x0000, 0x49bb,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1404, 0x0000, 0x17b5, 0x045e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4185, 0x2c2c, 0x28ff, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3cd8, 0x2864, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cc9,
+	    0x0000, 0x0b1f, 0x0933, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x05d9, 0x44bd, 0x0000, 0x0000, 0x1bb3, 0x0000, 0x0000, 0x0000,
+	    0x4b5b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x367b,
+	    0x0000, 0x0ac2, 0x0000, 0x206d, 0x0000, 0x0000, 0x0000, 0x05d8,
+	    0x0000, 0x0875, 0x0000, 0x0000, 0x0000, 0x0000, 0x11c1, 0x28bc,
+	    0x0000, 0x0000, 0x3a2b, 0x0000, 0x0b75, 0x0000, 0x0000, 0x2368,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x10ce, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3cdc, 0x2dfe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3928, 0x39a7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0356, 0x2f53, 0x42ef, 0x4396, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3ec2, 0x0000, 0x0000, 0x473f, 0x0000, 0x0000, 0x24ff,
+	    0x0000, 0x0000, 0x0612, 0x1433, 0x3abf, 0x0f25, 0x0000, 0x0000,
+	    0x3585, 0x0000, 0x0000, 0x220e, 0x340f, 0x2004, 0x0000, 0x0e6e,
+	    0x0000, 0x295c, 0x0000, 0x3b46, 0x0000, 0x1a04, 0x0000, 0x0000,
+	    0x0000, 0x2d80, 0x0000, 0x07bc, 0x0000, 0x0000, 0x0000, 0x1fad,
+	    0x2116, 0x0000, 0x24e1, 0x2ad7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0996, 0x0000, 0x3aac, 0x2ea7, 0x0000, 0x1a8e, 0x0000,
+	    0x1304, 0x0000, 0x38ee, 0x0000, 0x0000, 0x381c, 0x0000, 0x0bc0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x144d, 0x0000, 0x4003,
+	    0x0000, 0x1a26, 0x0000, 0x24d3, 0x0000, 0x0000, 0x032c, 0x0000,
+	    0x3cc9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2193, 0x0000, 0x0b58, 0x01d7,
+	    0x0000, 0x0c02, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3ad9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2a0c, 0x0f4f, 0x40d8, 0x35eb, 0x0000, 0x216e, 0x0a99, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x302a, 0x0000, 0x0000, 0x09ec,
+	    0x0000, 0x2ebf, 0x0000, 0x3587, 0x3dba, 0x0000, 0x144a, 0x0000,
+	    0x0000, 0x30bc, 0x413d, 0x3543, 0x2272, 0x0000, 0x129d, 0x4b4a,
+	    0x0000, 0x31f0, 0x0000, 0x0000, 0x0000, 0x1bc5, 0x443b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x37f9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1cd9, 0x0000, 0x294b, 0x09b6, 0x0000,
+	    0x0000, 0x3d9d, 0x043a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x131e, 0x0000, 0x4ca2, 0x24af, 0x3398, 0x360c, 0x178f,
+	    0x0000, 0x0000, 0x390f, 0x0000, 0x0aca, 0x0000, 0x0000, 0x0000,
+	    0x47c7, 0x0000, 0x0e8c, 0x00aa, 0x0000, 0x0000, 0x04a0, 0x0000,
+	    0x0000, 0x0000, 0x1d03, 0x0000, 0x0c94, 0x0000, 0x1cd5, 0x2f2e,
+	    0x0000, 0x13c1, 0x16d0, 0x0000, 0x0000, 0x488d, 0x0000, 0x328c,
+	    0x0000, 0x0520, 0x0000, 0x0000, 0x17d8, 0x2fce, 0x0000, 0x0000,
+	    0x0000, 0x2e28, 0x378a, 0x4861, 0x15b5, 0x0000, 0x0000, 0x0be9,
+	    0x1275, 0x04e3, 0x10d4, 0x0747, 0x4657, 0x3eca, 0x0000, 0x0609,
+	    0x157a, 0x0eab, 0x0000, 0x3bb7, 0x0231, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x471a, 0x0000, 0x3477, 0x0000, 0x1ed8,
+	    0x29a5, 0x2424, 0x0000, 0x0000, 0x0000, 0x389c, 0x0000, 0x0000,
+	    0x0166, 0x0000, 0x0000, 0x0000, 0x46ae, 0x12e1, 0x0000, 0x0000,
+	    0x0000, 0x2eeb, 0x0f80, 0x0000, 0x0000, 0x0000, 0x1ee2, 0x0000,
+	    0x0000, 0x307c, 0x0000, 0x0000, 0x0000, 0x418c, 0x0000, 0x0000,
+	    0x3bb4, 0x3a5e, 0x49e3, 0x4bb1, 0x0000, 0x42e2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3fed, 0x0000, 0x0000, 0x0000, 0x0450,
+	    0x2cf2, 0x0000, 0x4881, 0x0000, 0x0000, 0x0000, 0x0000, 0x229b,
+	    0x0509, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x092f,
+	    0x0000, 0x01b0, 0x0000, 0x0000, 0x0000, 0x1e11, 0x2c6e, 0x0000,
+	    0x2b43, 0x0000, 0x08aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0529,
+	    0x33bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3053, 0x2283,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4887, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4273, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2831, 0x298d, 0x0000, 0x0000, 0x3de4, 0x3025, 0x0000, 0x33dc,
+	    0x435f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1924,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0fc7,
+	    0x0000, 0x0000, 0x3d99, 0x1286, 0x00ee, 0x0000, 0x366e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0014, 0x26a6, 0x0000, 0x1042, 0x18a9,
+	    0x0000, 0x0000, 0x4917, 0x0000, 0x176e, 0x0000, 0x2bb8, 0x0000,
+	    0x3b08, 0x0000, 0x30fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x2037,
+	    0x0000, 0x0000, 0x1582, 0x4e06, 0x218b, 0x0000, 0x4ad2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1d22, 0x31c1, 0x27d6, 0x0000,
+	    0x31ca, 0x1486, 0x42a7, 0x0000, 0x0000, 0x40af, 0x0000, 0x064c,
+	    0x0000, 0x22d7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0148, 0x4660, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3bec, 0x116c, 0x0000, 0x0000,
+	    0x0000, 0x2693, 0x1274, 0x0000, 0x467d, 0x0000, 0x0000, 0x0ffc,
+	    0x0000, 0x0000, 0x26ad, 0x0373, 0x0000, 0x2863, 0x1512, 0x0000,
+	    0x134d, 0x0000, 0x31c6, 0x3139, 0x24c2, 0x47fa, 0x3fc5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1099, 0x483d,
+	    0x0000, 0x2601, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1388,
+	    0x2384, 0x0000, 0x38cb, 0x0000, 0x0000, 0x0000, 0x4999, 0x0000,
+	    0x0000, 0x0000, 0x3beb, 0x21ad, 0x0000, 0x0000, 0x3309, 0x0ded,
+	    0x0000, 0x0000, 0x1a33, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x178d, 0x0000, 0x414c, 0x2062, 0x0000, 0x2f86, 0x3a4b, 0x0000,
+	    0x0000, 0x29d3, 0x3835, 0x0000, 0x0000, 0x4983, 0x183c, 0x0a39,
+	    0x09ce, 0x0000, 0x2c85, 0x3807, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3be2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4059, 0x1fd2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x201d, 0x0000, 0x0000,
+	    0x0000, 0x4ba5, 0x177b, 0x1722, 0x360e, 0x0000, 0x0000, 0x2d41,
+	    0x0000, 0x07e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3392, 0x0000, 0x0000, 0x0755, 0x48cb, 0x3153, 0x0000,
+	    0x0000, 0x335c, 0x0000, 0x0eb8, 0x0000, 0x4c23, 0x1ce9, 0x2163,
+	    0x0000, 0x0000, 0x0000, 0x378e, 0x277e, 0x49a2, 0x3024, 0x0000,
+	    0x0000, 0x35a6, 0x250a, 0x2c9f, 0x0000, 0x0000, 0x0000, 0x12e2,
+	    0x483d, 0x0000, 0x0000, 0x301f, 0x0000, 0x3f63, 0x0000, 0x16b3,
+	    0x280e, 0x0000, 0x4553, 0x0000, 0x1496, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2ae9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3441,
+	    0x083a, 0x0000, 0x4598, 0x0000, 0x232f, 0x0000, 0x0000, 0x2ef7,
+	    0x3cae, 0x0000, 0x0000, 0x0000, 0x1135, 0x0000, 0x0481, 0x0000,
+	    0x04c8, 0x1b71, 0x0000, 0x0000, 0x0000, 0x0000, 0x32e6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x052f, 0x0000, 0x16b2,
+	    0x0000, 0x0000, 0x1bbf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3d8a, 0x3fb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061,
+	    0x0000, 0x47fb, 0x0000, 0x34d0, 0x4216, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x27ba, 0x3b2e, 0x2c97, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1469, 0x0000, 0x2dea, 0x3265, 0x0000, 0x0000, 0x0074, 0x0383,
+	    0x0000, 0x3049, 0x0000, 0x3d07, 0x1f23, 0x4a74, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01cc, 0x0000, 0x13dd, 0x2380, 0x04d9,
+	    0x0000, 0x0000, 0x0000, 0x3b82, 0x0000, 0x0000, 0x0000, 0x16f9,
+	    0x25d1, 0x0000, 0x0192, 0x0000, 0x0000, 0x1ef7, 0x0000, 0x3aa9,
+	    0x0000, 0x11af, 0x24bf, 0x0000, 0x43c9, 0x4cc2, 0x0000, 0x15e4,
+	    0x0000, 0x0de2, 0x2d8a, 0x0000, 0x04e8, 0x23f7, 0x1725, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x479e, 0x1e0a, 0x0000, 0x2b24, 0x0000,
+	    0x2456, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2b07, 0x1ea1, 0x0000, 0x2923, 0x0000, 0x1789, 0x0000, 0x0000,
+	    0x0000, 0x2fa5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1564, 0x133b, 0x0000, 0x0000, 0x0000, 0x0000, 0x22c7,
+	    0x0000, 0x15d9, 0x112a, 0x2fb9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x06d3, 0x0000, 0x0000, 0x0000, 0x26ee, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x18b0, 0x0000, 0x36f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x30dd, 0x3e85, 0x0000, 0x1cc0, 0x3fd0, 0x0000, 0x0000, 0x0000,
+	    0x3537, 0x05c6, 0x0000, 0x3eb0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b4d, 0x0000, 0x0000,
+	    0x26c4, 0x0000, 0x0000, 0x1ba8, 0x0000, 0x0000, 0x3bd7, 0x308d,
+	    0x0000, 0x40ee, 0x0000, 0x0000, 0x23e3, 0x0000, 0x188c, 0x3bef,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07df, 0x0000, 0x0000,
+	    0x4af6, 0x4aaf, 0x0000, 0x0000, 0x003b, 0x0000, 0x0000, 0x0000,
+	    0x3593, 0x3b9f, 0x2d4e, 0x0000, 0x0000, 0x0000, 0x399b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1925, 0x0000, 0x0000, 0x22c7,
+	    0x17c7, 0x0000, 0x2c0f, 0x0000, 0x0000, 0x0418, 0x3c64, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0a40, 0x0000, 0x02cf, 0x0000, 0x0000,
+	    0x1f35, 0x4333, 0x0000, 0x4147, 0x1a88, 0x26d9, 0x0000, 0x0000,
+	    0x2f73, 0x3fae, 0x3a9c, 0x0000, 0x1b4d, 0x0000, 0x0000, 0x39db,
+	    0x04de, 0x0000, 0x4dd9, 0x1601, 0x298f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x458d, 0x0b8d, 0x0000, 0x0000, 0x0000, 0x10d3,
+	    0x0000, 0x3fe8, 0x3661, 0x0000, 0x0000, 0x4926, 0x1ae7, 0x0000,
+	    0x3ecf, 0x11b3, 0x0000, 0x0000, 0x0000, 0x23a8, 0x0000, 0x48b0,
+	    0x4638, 0x35d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3913, 0x3b80, 0x3b91,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x020b, 0x17cd, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x129c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x15b2, 0x0000, 0x0000, 0x452c, 0x0000, 0x0ad9,
+	    0x11f8, 0x0000, 0x4a1f, 0x0000, 0x0000, 0x0000, 0x0000, 0x12fa,
+	    0x0000, 0x45ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x45f7, 0x0000, 0x0000, 0x0000, 0x31a7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x41be, 0x0000, 0x0000, 0x0000,
+	    0x30d8, 0x0000, 0x0000, 0x22a9, 0x0d91, 0x0000, 0x055e, 0x25d2,
+	    0x0000, 0x30da, 0x0000, 0x0000, 0x0000, 0x39cf, 0x0000, 0x45d2,
+	    0x2b10, 0x0000, 0x0000, 0x3ea9, 0x0919, 0x0195, 0x0000, 0x0000,
+	    0x0000, 0x1c71, 0x0000, 0x2aa8, 0x43c8, 0x0000, 0x1f38, 0x0000,
+	    0x0000, 0x3a43, 0x2245, 0x0000, 0x3472, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0dc2, 0x0000, 0x0000, 0x0000,
+	    0x2eb3, 0x1b70, 0x0000, 0x0000, 0x0000, 0x0000, 0x3150, 0x132c,
+	    0x3b18, 0x0000, 0x0000, 0x0000, 0x3e52, 0x0000, 0x2c2f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x324a, 0x1044, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4b0a, 0x0d9c, 0x481a, 0x0000, 0x1d5b,
+	    0x15b0, 0x0000, 0x0000, 0x172b, 0x0000, 0x4b3b, 0x0000, 0x0000,
+	    0x0000, 0x4b7f, 0x0edc, 0x4ad5, 0x0000, 0x23df, 0x19f5, 0x1b1a,
+	    0x498d, 0x0000, 0x0000, 0x23ac, 0x276a, 0x0568, 0x0000, 0x0000,
+	    0x0000, 0x1493, 0x04e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x21be,
+	    0x0000, 0x0000, 0x0000, 0x4787, 0x1abc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x012f, 0x0000, 0x0000, 0x47e5, 0x4392,
+	    0x0000, 0x07bf, 0x0000, 0x2764, 0x0000, 0x0000, 0x3813, 0x1921,
+	    0x0000, 0x0000, 0x0000, 0x0a26, 0x0000, 0x0000, 0x0000, 0x0908,
+	    0x3cc9, 0x2f25, 0x0000, 0x1818, 0x1b29, 0x3362, 0x16a4, 0x0000,
+	    0x0000, 0x2f31, 0x0000, 0x0000, 0x2ffe, 0x34ac, 0x0d3c, 0x0a0d,
+	    0x0000, 0x0000, 0x0f8d, 0x0000, 0x3598, 0x0000, 0x0000, 0x2501,
+	    0x4130, 0x0000, 0x0000, 0x12dd, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4b6b, 0x0000, 0x47a5, 0x0000, 0x0000, 0x3bbe, 0x0000,
+	    0x1178, 0x0000, 0x4deb, 0x0000, 0x4c7d, 0x0000, 0x0000, 0x3293,
+	    0x4b1a, 0x0000, 0x0000, 0x0000, 0x452b, 0x0000, 0x0000, 0x0000,
+	    0x0a82, 0x0000, 0x01de, 0x3b17, 0x3f86, 0x04a9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0b6c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3dc8, 0x0000, 0x18c2, 0x0000, 0x0000, 0x0000, 0x094b, 0x0000,
+	    0x0000, 0x0000, 0x3890, 0x0b92, 0x1717, 0x1cca, 0x0000, 0x0000,
+	    0x0000, 0x2e6d, 0x0000, 0x0000, 0x4715, 0x47ba, 0x0000, 0x32f3,
+	    0x3545, 0x0000, 0x0393, 0x38d2, 0x3c8c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0406, 0x0000, 0x0f61, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x13d9, 0x4af7, 0x0000, 0x239a, 0x1858, 0x4924, 0x0000,
+	    0x0000, 0x13f0, 0x0000, 0x494f, 0x1a2a, 0x0000, 0x0000, 0x0fb1,
+	    0x0000, 0x477c, 0x0000, 0x1caa, 0x0000, 0x0000, 0x043d, 0x0000,
+	    0x3150, 0x0000, 0x2b72, 0x05d2, 0x1a5d, 0x0000, 0x0000, 0x0c16,
+	    0x206a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38f2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19fc, 0x0000, 0x0000,
+	    0x43fc, 0x0000, 0x0add, 0x2667, 0x11dd, 0x0000, 0x0000, 0x18ea,
+	    0x0000, 0x0000, 0x36f9, 0x25f7, 0x40fb, 0x0000, 0x4886, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x337f, 0x0000, 0x0000, 0x4a57, 0x0000,
+	    0x3415, 0x0000, 0x49f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2358, 0x25fa, 0x0000, 0x0a1a, 0x38d7, 0x0000,
+	    0x0b7b, 0x09cf, 0x1e64, 0x0000, 0x0000, 0x2bd8, 0x082a, 0x2c85,
+	    0x497d, 0x41be, 0x066a, 0x0000, 0x3403, 0x3be1, 0x22c2, 0x2a5c,
+	    0x0000, 0x0000, 0x1716, 0x3bf1, 0x0000, 0x0000, 0x0000, 0x0de4,
+	    0x3e06, 0x03ba, 0x0000, 0x3793, 0x396d, 0x3b13, 0x0000, 0x0000,
+	    0x1134, 0x0000, 0x067f, 0x0000, 0x086b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0681, 0x09aa, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x357b, 0x0000, 0x0085, 0x0000,
+	    0x0000, 0x3feb, 0x0000, 0x2efb, 0x0000, 0x009b, 0x0000, 0x0346,
+	    0x0000, 0x0fb6, 0x0000, 0x0b6f, 0x190a, 0x0000, 0x0000, 0x1494,
+	    0x35b0, 0x0000, 0x0000, 0x27e1, 0x318e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1a64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bba,
+	    0x0000, 0x0000, 0x3d9d, 0x0000, 0x3c09, 0x2cd1, 0x1913, 0x4662,
+	    0x0000, 0x0000, 0x0000, 0x0b07, 0x0000, 0x2fff, 0x00cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3c81, 0x0000, 0x2050, 0x0000, 0x0055, 0x38a5,
+	    0x3b89, 0x4724, 0x0000, 0x0178, 0x103f, 0x0000, 0x0000, 0x441e,
+	    0x0eee, 0x0066, 0x3f72, 0x0000, 0x0000, 0x415c, 0x0000, 0x0000,
+	    0x1d2f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1d78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x31ae, 0x4121, 0x0000, 0x0000, 0x0000, 0x1ec0,
+	    0x0000, 0x0000, 0x2951, 0x3961, 0x0000, 0x1126, 0x0000, 0x0000,
+	    0x0f81, 0x0000, 0x0000, 0x253e, 0x420a, 0x4d02, 0x0000, 0x31c7,
+	    0x2c12, 0x0000, 0x0000, 0x46fb, 0x0000, 0x0524, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0efc, 0x1e24, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3982, 0x0000, 0x0000, 0x0000, 0x3765, 0x20c9,
+	    0x1d8f, 0x0000, 0x0000, 0x0000, 0x16cb, 0x2305, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4dd7, 0x0000, 0x0000, 0x11bd, 0x0000,
+	    0x0000, 0x2090, 0x0000, 0x0000, 0x0000, 0x1952, 0x41c8, 0x47e2,
+	    0x0000, 0x0000, 0x0000, 0x1b6d, 0x173a, 0x38ec, 0x3473, 0x0000,
+	    0x0000, 0x0000, 0x4108, 0x0000, 0x0000, 0x2eff, 0x477b, 0x18b4,
+	    0x0000, 0x0000, 0x0000, 0x30e7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1390, 0x49e7, 0x0000, 0x1b29, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x28c4, 0x0000, 0x0000, 0x36ca,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f77, 0x0000,
+	    0x464c, 0x0000, 0x0000, 0x08c2, 0x0000, 0x0000, 0x4632, 0x0000,
+	    0x1963, 0x0000, 0x179b, 0x0000, 0x0000, 0x0000, 0x0000, 0x2886,
+	    0x0000, 0x00a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c85, 0x0000,
+	    0x0f80, 0x1787, 0x2fb1, 0x0156, 0x1f69, 0x10b2, 0x44b0, 0x0000,
+	    0x0000, 0x1917, 0x0000, 0x139b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x17cf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x30b8, 0x0000, 0x0000, 0x0104, 0x0000, 0x41e1, 0x0000,
+	    0x40b4, 0x34a4, 0x0000, 0x0000, 0x3576, 0x4bd1, 0x0000, 0x3222,
+	    0x0000, 0x0e31, 0x0000, 0x4393, 0x0000, 0x4026, 0x0000, 0x0000,
+	    0x42c8, 0x43e3, 0x0000, 0x34c7, 0x3f06, 0x4d92, 0x41ad, 0x0000,
+	    0x2d67, 0x2f91, 0x02d4, 0x0000, 0x45ed, 0x1687, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0a1b, 0x0000, 0x49e1, 0x341a,
+	    0x0000, 0x0000, 0x0000, 0x1a25, 0x26fb, 0x4456, 0x06cc, 0x14b7,
+	    0x2733, 0x0482, 0x0000, 0x0f50, 0x24de, 0x4a08, 0x30d6, 0x0000,
+	    0x02f8, 0x3185, 0x0486, 0x3263, 0x2b0f, 0x0000, 0x373c, 0x230d,
+	    0x0000, 0x0000, 0x0000, 0x229f, 0x1cfd, 0x0881, 0x0000, 0x0000,
+	    0x0000, 0x14f2, 0x17a7, 0x4815, 0x0000, 0x032d, 0x0000, 0x03fe,
+	    0x49fd, 0x0000, 0x0000, 0x2d8f, 0x0000, 0x0000, 0x0000, 0x05e3,
+	    0x0000, 0x0000, 0x23d4, 0x1a2f, 0x0000, 0x075a, 0x0000, 0x0000,
+	    0x0000, 0x1ce4, 0x0000, 0x1862, 0x1a3c, 0x0000, 0x317f, 0x0bb5,
+	    0x0000, 0x0000, 0x3384, 0x0000, 0x1707, 0x0000, 0x0000, 0x1fc2,
+	    0x152d, 0x0000, 0x3b27, 0x3433, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x214d, 0x3209, 0x0000, 0x0d3b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0041, 0x0000, 0x0000, 0x37c0, 0x3e84, 0x0000,
+	    0x0000, 0x0000, 0x267d, 0x0000, 0x0000, 0x0ad5, 0x26e8, 0x0000,
+	    0x0000, 0x0000, 0x3f1d, 0x0000, 0x0000, 0x0000, 0x0c5e, 0x0000,
+	    0x24d7, 0x0000, 0x46ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3a2a, 0x0000, 0x0000, 0x2277, 0x41b1, 0x0000, 0x2f6f, 0x1803,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e46, 0x2966,
+	    0x3ad5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21e2, 0x1bd9,
+	    0x1585, 0x0000, 0x09bf, 0x0000, 0x0000, 0x0000, 0x0f3b, 0x0000,
+	    0x1bae, 0x0000, 0x0e5f, 0x16b1, 0x0000, 0x0d4b, 0x0000, 0x478e,
+	    0x0000, 0x238d, 0x491f, 0x0000, 0x0000, 0x17de, 0x0000, 0x0000,
+	    0x07f4, 0x4b58, 0x0000, 0x0000, 0x45d8, 0x0000, 0x0000, 0x1272,
+	    0x0000, 0x0000, 0x4dde, 0x2fb0, 0x0821, 0x32b3, 0x001f, 0x432f,
+	    0x1469, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3ade, 0x0000, 0x0000, 0x0000, 0x0000, 0x3491,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x47b5, 0x0000, 0x0000, 0x0000,
+	    0x22ba, 0x01d0, 0x22ea, 0x0000, 0x0000, 0x3a26, 0x149c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0b2f, 0x0000, 0x1fc0, 0x1876, 0x0000,
+	    0x0000, 0x0000, 0x36e8, 0x2d21, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4247, 0x0000, 0x3132, 0x19e8, 0x3913, 0x0000,
+	    0x0000, 0x0000, 0x3446, 0x2dfc, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2702, 0x335c, 0x0000, 0x3811, 0x36c6, 0x2389,
+	    0x3c22, 0x0000, 0x208c, 0x0000, 0x0000, 0x1860, 0x33f2, 0x3864,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a84, 0x0000, 0x02dd,
+	    0x0000, 0x0000, 0x347a, 0x0000, 0x1538, 0x25a8, 0x0000, 0x04a7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ff1,
+	    0x0000, 0x026e, 0x40d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x07db, 0x057e, 0x0000, 0x4b98, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1ca2, 0x0c09, 0x0000, 0x0000,
+	    0x1138, 0x26d7, 0x27e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ab7,
+	    0x4356, 0x0000, 0x0000, 0x2c66, 0x31ec, 0x2316, 0x4dec, 0x0045,
+	    0x0000, 0x3c3a, 0x0000, 0x0000, 0x3926, 0x0000, 0x14fa, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3036, 0x3287, 0x0ae5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3811, 0x0000, 0x38d7,
+	    0x0000, 0x3f15, 0x0000, 0x1a89, 0x314b, 0x0000, 0x3f57, 0x0000,
+	    0x0000, 0x0a07, 0x0000, 0x0000, 0x2cd0, 0x0c34, 0x46ac, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2e69, 0x4bff, 0x0000, 0x1ee5, 0x0000,
+	    0x0000, 0x0000, 0x3002, 0x0000, 0x345e, 0x0000, 0x0aea, 0x0000,
+	    0x4d87, 0x3bc0, 0x0000, 0x3238, 0x4322, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2e84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0e83, 0x0000, 0x0000, 0x1484, 0x0000, 0x07c1, 0x0000,
+	    0x0000, 0x1848, 0x0dde, 0x0000, 0x179c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0761, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3992,
+	    0x0000, 0x0000, 0x1be8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1d0d, 0x22e0, 0x2095, 0x2860,
+	    0x32b6, 0x316d, 0x0000, 0x0000, 0x3f77, 0x4833, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x32b4, 0x0000, 0x0000, 0x409d, 0x0844, 0x0000,
+	    0x0000, 0x0000, 0x2a36, 0x1d2e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x12b6, 0x3ef6, 0x0000, 0x0000, 0x0000, 0x0000, 0x438c, 0x32f4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4988, 0x24b2, 0x3a62, 0x1644,
+	    0x0000, 0x0000, 0x0000, 0x1e8a, 0x0000, 0x2822, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x141a, 0x0000, 0x0000, 0x16ad, 0x0000, 0x0000,
+	    0x0000, 0x34f3, 0x4495, 0x0000, 0x0000, 0x1ed5, 0x0000, 0x3aec,
+	    0x1b23, 0x0000, 0x319c, 0x25b2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x40a2, 0x03ef, 0x0000, 0x2113, 0x0000, 0x2c34, 0x0b39,
+	    0x41c1, 0x0000, 0x0000, 0x0000, 0x14b3, 0x0000, 0x148b, 0x0000,
+	    0x0000, 0x0000, 0x3835, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2509, 0x0000, 0x234e, 0x0000, 0x0000,
+	    0x0000, 0x2b12, 0x0000, 0x2ec6, 0x3ba5, 0x0000, 0x0000, 0x0dea,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0cc7, 0x0000, 0x27e9,
+	    0x1559, 0x0000, 0x0000, 0x472f, 0x0000, 0x0000, 0x49c5, 0x0000,
+	    0x0000, 0x0000, 0x4c82, 0x0000, 0x0000, 0x0000, 0x0000, 0x1230,
+	    0x0330, 0x3820, 0x3793, 0x39d6, 0x2289, 0x42fe, 0x43e8, 0x3179,
+	    0x0000, 0x2a90, 0x0000, 0x0000, 0x2f7f, 0x2ed4, 0x397b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x42a3, 0x473f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4356, 0x3d84, 0x2d53, 0x0000, 0x0000, 0x00ad,
+	    0x4953, 0x1e32, 0x0000, 0x0000, 0x4d80, 0x1860, 0x0000, 0x38f5,
+	    0x27c2, 0x2b9b, 0x027d, 0x0fb7, 0x3620, 0x37d5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3412, 0x0000, 0x126e, 0x3e0d, 0x0000, 0x30a3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4120, 0x0000, 0x406a,
+	    0x0000, 0x2d2f, 0x0000, 0x0000, 0x29dc, 0x1375, 0x0000, 0x47e0,
+	    0x1136, 0x4054, 0x03a2, 0x4af6, 0x0000, 0x01d8, 0x346b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c3d, 0x0b2b, 0x0f34,
+	    0x46bc, 0x3d68, 0x0000, 0x12cc, 0x0000, 0x0000, 0x02f4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2b28, 0x1943, 0x0301, 0x106e, 0x384b,
+	    0x06f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f06, 0x04c0, 0x0813,
+	    0x07c0, 0x0000, 0x0e8c, 0x3b1b, 0x2b5a, 0x08ec, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fbb, 0x0000, 0x359d,
+	    0x0000, 0x2b0e, 0x0000, 0x1064, 0x0000, 0x27d4, 0x0df1, 0x09af,
+	    0x2e57, 0x3ef1, 0x149f, 0x0000, 0x0000, 0x4b3b, 0x0000, 0x0000,
+	    0x14ac, 0x0000, 0x23e7, 0x0000, 0x4c99, 0x0000, 0x0000, 0x0000,
+	    0x0b41, 0x0000, 0x0000, 0x2989, 0x0000, 0x0000, 0x4d07, 0x0000,
+	    0x1e5b, 0x0f7a, 0x0000, 0x0a47, 0x0000, 0x4be8, 0x0000, 0x0000,
+	    0x007f, 0x47ff, 0x1632, 0x0000, 0x0000, 0x0000, 0x0000, 0x16ce,
+	    0x0000, 0x0000, 0x0000, 0x418e, 0x4377, 0x0000, 0x3f8c, 0x0000,
+	    0x19ab, 0x221b, 0x0000, 0x0000, 0x0000, 0x0000, 0x3490, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2c87, 0x0000, 0x0000, 0x0000, 0x24f4,
+	    0x0000, 0x0000, 0x114d, 0x04ac, 0x3362, 0x0000, 0x2020, 0x0000,
+	    0x0000, 0x0000, 0x1b21, 0x0000, 0x0000, 0x0000, 0x0000, 0x1112,
+	    0x2d2a, 0x0000, 0x0fa7, 0x0bd2, 0x0bcd, 0x0000, 0x3b7b, 0x0000,
+	    0x2976, 0x0000, 0x0000, 0x3f96, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1df4, 0x4985, 0x0000, 0x3bdc, 0x0000, 0x0000, 0x1f20, 0x1390,
+	    0x0000, 0x3049, 0x3ab6, 0x0000, 0x0000, 0x0b42, 0x0000, 0x0000,
+	    0x076e, 0x33c4, 0x0000, 0x0000, 0x0000, 0x18ad, 0x0000, 0x0000,
+	    0x0000, 0x2c0e, 0x45cc, 0x264c, 0x3e58, 0x0000, 0x0000, 0x0000,
+	    0x26ea, 0x091e, 0x0000, 0x0bfe, 0x0000, 0x0000, 0x0000, 0x0fe7,
+	    0x36fd, 0x0000, 0x0000, 0x0000, 0x0000, 0x15db, 0x0000, 0x3ff5,
+	    0x0000, 0x1340, 0x0000, 0x0000, 0x381b, 0x0000, 0x0000, 0x2a4f,
+	    0x0000, 0x0000, 0x457a, 0x1764, 0x0000, 0x2bdb, 0x0000, 0x4771,
+	    0x0000, 0x24dc, 0x0000, 0x0000, 0x2cd9, 0x0000, 0x2b96, 0x0000,
+	    0x3b94, 0x0000, 0x0000, 0x193f, 0x0000, 0x0000, 0x1f12, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4ab8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4ddc, 0x0000, 0x0000, 0x4a7a,
+	    0x053b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f4a, 0x12f4, 0x070a,
+	    0x437e, 0x4120, 0x493c, 0x41aa, 0x0957, 0x0000, 0x0000, 0x0000,
+	    0x36fc, 0x0000, 0x3c81, 0x0000, 0x0000, 0x1e3a, 0x0000, 0x34a8,
+	    0x1337, 0x4789, 0x1d8d, 0x2d52, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0f5e, 0x0000, 0x0000, 0x0000,
+	    0x1011, 0x0000, 0x0000, 0x0000, 0x0ee6, 0x0000, 0x0000, 0x334f,
+	    0x0000, 0x0000, 0x0000, 0x0c2e, 0x1133, 0x054c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x31cc, 0x0000, 0x2afc, 0x08f5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x493a, 0x0000, 0x0000, 0x4546,
+	    0x2c36, 0x0000, 0x1459, 0x0000, 0x3863, 0x0000, 0x014c, 0x0000,
+	    0x4305, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2833,
+	    0x0dcc, 0x0000, 0x1207, 0x4512, 0x1be2, 0x48e4, 0x1ea2, 0x3d3a,
+	    0x0000, 0x02b1, 0x438e, 0x0000, 0x0000, 0x0000, 0x49e9, 0x0000,
+	    0x0000, 0x1680, 0x0000, 0x0000, 0x3959, 0x0000, 0x42e8, 0x109f,
+	    0x0000, 0x0812, 0x4389, 0x4ca4, 0x2101, 0x3cd2, 0x0000, 0x0000,
+	    0x482e, 0x08e7, 0x0e86, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b98,
+	    0x0d10, 0x0000, 0x187e, 0x4b5d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2055, 0x4a99, 0x46c5, 0x0000, 0x12c6, 0x0000, 0x4273,
+	    0x0065, 0x16c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0389, 0x0000, 0x0000, 0x1954, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2d94, 0x4193, 0x36bd, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2bb4, 0x0000, 0x0000, 0x0000, 0x2d2e, 0x0000, 0x0000,
+	    0x4951, 0x0000, 0x0000, 0x490f, 0x0000, 0x4da1, 0x0000, 0x0000,
+	    0x2ed6, 0x0000, 0x48ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x42a1,
+	    0x4874, 0x0000, 0x0000, 0x0000, 0x1354, 0x0000, 0x0000, 0x2e9f,
+	    0x0000, 0x0000, 0x2e5a, 0x0000, 0x1571, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2b95, 0x0000, 0x0bf8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1e2e, 0x0000, 0x0000, 0x41b0, 0x0000,
+	    0x0000, 0x0000, 0x26ac, 0x4897, 0x339f, 0x0000, 0x409d, 0x0000,
+	    0x0000, 0x0000, 0x015e, 0x474a, 0x1a28, 0x0000, 0x0000, 0x0000,
+	    0x0dd4, 0x3be6, 0x4bde, 0x0000, 0x09d0, 0x36b3, 0x0000, 0x1af0,
+	    0x0000, 0x0abb, 0x0000, 0x0000, 0x492d, 0x0000, 0x475f, 0x0653,
+	    0x0000, 0x0000, 0x0190, 0x0000, 0x0000, 0x019e, 0x4755, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23b5, 0x0000,
+	    0x0000, 0x0000, 0x1b4e, 0x480f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x29d0, 0x0000, 0x0000, 0x36a2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0173, 0x3318, 0x0000, 0x0000, 0x00c1, 0x0000,
+	    0x18cf, 0x0000, 0x0000, 0x0000, 0x1c28, 0x0000, 0x0000, 0x0000,
+	    0x22a5, 0x1c0c, 0x0000, 0x0000, 0x367e, 0x4ddc, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1977, 0x0000, 0x0000, 0x3032, 0x0000,
+	    0x0000, 0x0000, 0x193a, 0x0000, 0x0000, 0x290a, 0x1607, 0x265d,
+	    0x0000, 0x0000, 0x0885, 0x1e9f, 0x2cb5, 0x2866, 0x0000, 0x4c05,
+	    0x37f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19a3, 0x158b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x07fc, 0x0000, 0x0000, 0x0399,
+	    0x0732, 0x488a, 0x0000, 0x0450, 0x1a25, 0x4650, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x26bc, 0x0000, 0x0000, 0x279e, 0x12f6,
+	    0x0000, 0x231d, 0x0000, 0x3330, 0x4d75, 0x3148, 0x4ce4, 0x0000,
+	    0x0000, 0x24ab, 0x34e1, 0x11e2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x35ad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23ce, 0x1b7a,
+	    0x0000, 0x0000, 0x0000, 0x12ad, 0x0000, 0x01aa, 0x0000, 0x0000,
+	    0x0000, 0x1de7, 0x3ddc, 0x0000, 0x1651, 0x0000, 0x0a18, 0x0000,
+	    0x0000, 0x46ec, 0x0000, 0x0000, 0x07ad, 0x46af, 0x0000, 0x0000,
+	    0x2a11, 0x0a23, 0x149a, 0x081d, 0x445c, 0x0000, 0x3207, 0x0000,
+	    0x1b5b, 0x087f, 0x0525, 0x0000, 0x0000, 0x4945, 0x24fb, 0x11e1,
+	    0x2216, 0x0000, 0x0000, 0x0000, 0x0000, 0x0731, 0x0000, 0x1cf8,
+	    0x0000, 0x3985, 0x0000, 0x0000, 0x2dcb, 0x0000, 0x0000, 0x0c23,
+	    0x4bb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4086, 0x0000, 0x0000, 0x464d, 0x0645, 0x0000, 0x0000, 0x2ae3,
+	    0x2eca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3afc,
+	    0x0000, 0x09f4, 0x0000, 0x3423, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3a11, 0x0000, 0x140a, 0x0000, 0x4897, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x062e, 0x3942, 0x090f,
+	    0x0000, 0x0000, 0x16bf, 0x36ef, 0x0000, 0x16ea, 0x0000, 0x3d3e,
+	    0x0000, 0x0000, 0x24e2, 0x0000, 0x377e, 0x0000, 0x0000, 0x19c7,
+	    0x0000, 0x0777, 0x0000, 0x0b76, 0x090d, 0x0000, 0x34bd, 0x0000,
+	    0x0971, 0x0000, 0x0000, 0x0000, 0x0000, 0x4848, 0x0000, 0x0000,
+	    0x01bc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c28, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1c68, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3b24, 0x07b6, 0x2753, 0x0000, 0x0000, 0x232d, 0x3d77, 0x455d,
+	    0x0000, 0x0000, 0x0000, 0x33c8, 0x0000, 0x4d22, 0x0000, 0x0000,
+	    0x0000, 0x1cd7, 0x48be, 0x423e, 0x0000, 0x0000, 0x402a, 0x347a,
+	    0x0000, 0x4096, 0x0bce, 0x0000, 0x01e2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x062b, 0x3521, 0x0548, 0x01e9, 0x0000, 0x0000, 0x18ab,
+	    0x42d4, 0x0000, 0x0000, 0x2779, 0x0000, 0x0000, 0x0527, 0x0000,
+	    0x0ed0, 0x0000, 0x0000, 0x0000, 0x3004, 0x0000, 0x0b5e, 0x0000,
+	    0x0000, 0x015e, 0x0000, 0x0000, 0x2a8e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3473, 0x0000, 0x0000, 0x1029,
+	    0x0000, 0x0000, 0x0000, 0x3590, 0x0000, 0x0000, 0x0000, 0x38cf,
+	    0x3eaa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4e1d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e9f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e9e, 0x0000, 0x0000, 0x2ce2, 0x0000, 0x0000,
+	    0x00b3, 0x33cc, 0x0000, 0x0000, 0x09db, 0x0000, 0x0000, 0x0000,
+	    0x0e20, 0x2f66, 0x0000, 0x0000, 0x46b1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3fc6, 0x00f4, 0x0000, 0x0000, 0x37c1, 0x0000, 0x0000,
+	    0x0a2e, 0x0000, 0x0000, 0x2c39, 0x4136, 0x0000, 0x0000, 0x2314,
+	    0x27f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x36df, 0x3db2, 0x0000, 0x0000, 0x44c1, 0x3bb5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e48, 0x0000, 0x1e47, 0x0000, 0x4881, 0x0000,
+	    0x48b7, 0x48ca, 0x0000, 0x0000, 0x0000, 0x2cbf, 0x0000, 0x4931,
+	    0x0000, 0x0000, 0x0000, 0x431e, 0x0000, 0x0000, 0x1702, 0x0000,
+	    0x0000, 0x1c74, 0x0347, 0x0000, 0x3743, 0x0000, 0x39d4, 0x0000,
+	    0x0000, 0x0000, 0x2a0e, 0x0000, 0x2574, 0x0000, 0x0000, 0x06f6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e34, 0x0000, 0x0000, 0x1ce0,
+	    0x212d, 0x0000, 0x0000, 0x0000, 0x3708, 0x1d3d, 0x1051, 0x3e38,
+	    0x0000, 0x3939, 0x405d, 0x0000, 0x0000, 0x3e70, 0x0075, 0x2c8a,
+	    0x40ca, 0x0000, 0x0000, 0x1bc0, 0x27ae, 0x0000, 0x088d, 0x0000,
+	    0x305b, 0x0000, 0x0000, 0x0be6, 0x0000, 0x1439, 0x0000, 0x0000,
+	    0x0000, 0x1589, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0f3e, 0x0000, 0x0000, 0x0000, 0x47e0, 0x49bc, 0x206c, 0x0000,
+	    0x133e, 0x16de, 0x0000, 0x0000, 0x1134, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01be, 0x3a94, 0x0000, 0x0000, 0x3e73,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2ca3, 0x49b7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x07d8, 0x0000, 0x0000, 0x2aa1, 0x0e83, 0x0000,
+	    0x157c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3558,
+	    0x0000, 0x0000, 0x27d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x23fe, 0x0000, 0x2986, 0x0bed, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2533, 0x1da4, 0x115f,
+	    0x0000, 0x0000, 0x15ff, 0x4108, 0x11cc, 0x2ed4, 0x0000, 0x0000,
+	    0x05e5, 0x2dcc, 0x0000, 0x145f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4b12, 0x0000, 0x1cec, 0x0000, 0x0000,
+	    0x3054, 0x3c08, 0x0000, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0e13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f39, 0x0cbc,
+	    0x424d, 0x0000, 0x0b2e, 0x0000, 0x0000, 0x0000, 0x0000, 0x353c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0f05, 0x0000, 0x0000, 0x3dfb,
+	    0x0000, 0x0000, 0x482e, 0x0000, 0x4582, 0x0222, 0x172a, 0x2ccd,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3a29, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4ab2, 0x00d6, 0x0000, 0x0000, 0x0000, 0x4438,
+	    0x2f94, 0x0000, 0x0000, 0x0000, 0x0000, 0x11c8, 0x0000, 0x259d,
+	    0x0b0b, 0x408e, 0x0000, 0x0000, 0x06a2, 0x0000, 0x2f23, 0x2162,
+	    0x22eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d79, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x450c, 0x0000, 0x236a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4182, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2095, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1b62, 0x3428, 0x0000, 0x0851, 0x1294, 0x0000,
+	    0x2fd3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2320, 0x0000, 0x0000, 0x255c, 0x0000, 0x0000, 0x0eb1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1691, 0x0000, 0x0000, 0x0000,
+	    0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x13cb, 0x0000, 0x2d30, 0x4c4d,
+	    0x0000, 0x2ae4, 0x4603, 0x0000, 0x0000, 0x159c, 0x259a, 0x0000,
+	    0x394c, 0x4dd3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x30fa, 0x2000, 0x4446, 0x2c63, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0724, 0x0000, 0x0000, 0x0000, 0x0000, 0x47cf, 0x0000,
+	    0x0000, 0x0000, 0x1292, 0x0000, 0x0000, 0x1aa9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1471, 0x0000, 0x1013, 0x0000, 0x0000, 0x0000,
+	    0x4168, 0x1e03, 0x0000, 0x0000, 0x0000, 0x0a29, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12ef, 0x0000, 0x26f2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3927, 0x4d90, 0x0000,
+	    0x3d2f, 0x0000, 0x0000, 0x0d28, 0x18b1, 0x0000, 0x0000, 0x0000,
+	    0x29e4, 0x0000, 0x1323, 0x3973, 0x0000, 0x1cfc, 0x3a4a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x28d6, 0x0000, 0x286d, 0x0000, 0x0000,
+	    0x09ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x45fb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2950, 0x0000, 0x4ddf, 0x30ce, 0x02e4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1c41, 0x0000, 0x2294, 0x03da, 0x0000, 0x0000,
+	    0x23a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f7d, 0x31c8, 0x0543,
+	    0x45ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x261c, 0x2c8f, 0x0000,
+	    0x06d4, 0x025c, 0x0000, 0x0000, 0x0000, 0x3266, 0x0000, 0x0000,
+	    0x1730, 0x0000, 0x3940, 0x0c59, 0x0000, 0x2f0f, 0x0000, 0x1d97,
+	    0x01bc, 0x416f, 0x0000, 0x21e9, 0x0796, 0x0000, 0x0000, 0x07ef,
+	    0x163a, 0x34d4, 0x47a9, 0x42b0, 0x0000, 0x0000, 0x0000, 0x1432,
+	    0x2fa5, 0x146a, 0x0b75, 0x10f1, 0x0000, 0x0000, 0x0000, 0x476a,
+	    0x0083, 0x0e4d, 0x0000, 0x09b8, 0x2ccc, 0x0000, 0x0000, 0x2a86,
+	    0x49ed, 0x0000, 0x157c, 0x480f, 0x0000, 0x0000, 0x48d6, 0x0000,
+	    0x0000, 0x2c99, 0x2d6e, 0x0000, 0x33bb, 0x0000, 0x0000, 0x10ee,
+	    0x0000, 0x0000, 0x0eb5, 0x0000, 0x0000, 0x0000, 0x1f13, 0x3d7f,
+	    0x3729, 0x36a1, 0x0000, 0x2218, 0x48f0, 0x0000, 0x0f42, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1e2a, 0x0000, 0x1f33, 0x0000,
+	    0x1b05, 0x0000, 0x0000, 0x0000, 0x2096, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f0a, 0x392d, 0x0000,
+	    0x15ff, 0x48fb, 0x0000, 0x0000, 0x1987, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x266d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3d3f, 0x0000, 0x0000, 0x0000, 0x12fe, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x328c, 0x0000, 0x0000,
+	    0x0c7f, 0x20f9, 0x0000, 0x0000, 0x0000, 0x4033, 0x0000, 0x2a53,
+	    0x0000, 0x0000, 0x3a17, 0x0000, 0x0000, 0x0000, 0x38d8, 0x3be0,
+	    0x46c1, 0x0000, 0x0000, 0x2e7f, 0x3e8e, 0x1f17, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x34c1, 0x0000, 0x0000, 0x0000, 0x0446,
+	    0x2e45, 0x0000, 0x3fd7, 0x0000, 0x0000, 0x2efe, 0x0000, 0x47a9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0773, 0x00ba,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a01, 0x3141,
+	    0x0000, 0x0000, 0x0182, 0x0000, 0x3e2e, 0x0000, 0x0000, 0x3fbb,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fda,
+	    0x0000, 0x2401, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3836, 0x0000, 0x3883, 0x1869, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x313b, 0x32a0, 0x395c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4d4e, 0x10d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4974, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0c38, 0x0000, 0x4c74, 0x0000, 0x12a7, 0x0000, 0x0000, 0x1ba6,
+	    0x0000, 0x0000, 0x0000, 0x2c3f, 0x0000, 0x0000, 0x0000, 0x499b,
+	    0x0000, 0x0000, 0x45d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0eba,
+	    0x2f9d, 0x4de8, 0x0000, 0x0000, 0x0000, 0x0000, 0x2bd4, 0x0000,
+	    0x0000, 0x1e0a, 0x0000, 0x17ed, 0x309d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fc3, 0x2102,
+	    0x1022, 0x4364, 0x0d2c, 0x0000, 0x0000, 0x0000, 0x0437, 0x0000,
+	    0x1e58, 0x176f, 0x019c, 0x0000, 0x2db9, 0x34f0, 0x1803, 0x403d,
+	    0x0000, 0x1829, 0x2984, 0x0000, 0x0000, 0x0ce5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x15e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x237e, 0x0000, 0x20e1, 0x4df2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3c3a, 0x0d9a, 0x0000, 0x0000, 0x0000, 0x491a, 0x0000, 0x0000,
+	    0x211e, 0x0434, 0x0000, 0x0000, 0x0000, 0x297c, 0x06e0, 0x0000,
+	    0x1119, 0x43b2, 0x3b4d, 0x0000, 0x0fa0, 0x3c39, 0x0000, 0x0000,
+	    0x0000, 0x4d40, 0x0000, 0x2901, 0x0000, 0x0000, 0x0000, 0x2701,
+	    0x0000, 0x1b9c, 0x0000, 0x4671, 0x3b86, 0x4483, 0x0000, 0x3b8f,
+	    0x12ed, 0x0000, 0x0000, 0x074a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0fbe, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1597, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0196, 0x0000, 0x0000, 0x4b9f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2916, 0x0000, 0x4085, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4a1d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3dc4,
+	    0x0000, 0x4800, 0x0000, 0x117a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0536, 0x2af8, 0x0000, 0x0000, 0x26a4, 0x02c0,
+	    0x0528, 0x4202, 0x0000, 0x0000, 0x0000, 0x348c, 0x04e2, 0x150e,
+	    0x0000, 0x4b9b, 0x0000, 0x1627, 0x09c4, 0x00e0, 0x0000, 0x0000,
+	    0x385d, 0x4325, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe,
+	    0x120b, 0x0000, 0x46e9, 0x0547, 0x3b4b, 0x1180, 0x0000, 0x2097,
+	    0x0000, 0x0000, 0x4020, 0x0000, 0x22b3, 0x1f2d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x33eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c93, 0x496b, 0x3c2b,
+	    0x0000, 0x0000, 0x4c53, 0x32ad, 0x4272, 0x0ad2, 0x0000, 0x0000,
+	    0x0000, 0x48f4, 0x2a4b, 0x4dca, 0x4df6, 0x0000, 0x0000, 0x4317,
+	    0x0000, 0x0000, 0x0000, 0x40dd, 0x3973, 0x020e, 0x0000, 0x0000,
+	    0x0000, 0x21ef, 0x249a, 0x0000, 0x0000, 0x1072, 0x0000, 0x0000,
+	    0x4416, 0x2e2d, 0x0000, 0x138c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x084d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dcd,
+	    0x0000, 0x0108, 0x4d26, 0x2f89, 0x35d7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ef9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4bb6, 0x0dec, 0x0000, 0x0000, 0x222e,
+	    0x273e, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1802, 0x2df4, 0x0000, 0x077e, 0x0000, 0x0000,
+	    0x4636, 0x0168, 0x0000, 0x0000, 0x0d3e, 0x22bd, 0x0000, 0x0000,
+	    0x2cd1, 0x0000, 0x1cc3, 0x0000, 0x0000, 0x1a9e, 0x31e4, 0x0000,
+	    0x0000, 0x0000, 0x42be, 0x4191, 0x0000, 0x16db, 0x326b, 0x0000,
+	    0x4e1d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x309a, 0x0000,
+	    0x0000, 0x2d4b, 0x1ce7, 0x0000, 0x3b6e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x13e0, 0x3a9b, 0x0000, 0x3b82, 0x0000, 0x40d1,
+	    0x3e40, 0x0000, 0x0000, 0x0000, 0x13cc, 0x0000, 0x3598, 0x3946,
+	    0x0c92, 0x39e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1b42, 0x0000, 0x0000, 0x0000, 0x0ba0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x334b, 0x0000, 0x0000, 0x3213, 0x0000, 0x304e, 0x0000,
+	    0x1dc7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x346b,
+	    0x0000, 0x0000, 0x148b, 0x4a92, 0x0000, 0x0000, 0x0000, 0x0009,
+	    0x0000, 0x298c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1bf8, 0x4d75, 0x47b6, 0x1a15, 0x0000, 0x0000, 0x0000, 0x43c3,
+	    0x2b3e, 0x0000, 0x24f7, 0x4c59, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x49e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0da6, 0x0000, 0x320d, 0x2bd2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x018b, 0x0000,
+	    0x0000, 0x04c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d9c, 0x0000,
+	    0x021b, 0x24b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34f3,
+	    0x0000, 0x1633, 0x0000, 0x0000, 0x0000, 0x125f, 0x1787, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0da9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0a2d, 0x43bc, 0x0000, 0x198f,
+	    0x0000, 0x3ba0, 0x0000, 0x3380, 0x2080, 0x0000, 0x36f3, 0x0000,
+	    0x0cdc, 0x15c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0911,
+	    0x0000, 0x07ae, 0x10bd, 0x0000, 0x0000, 0x0000, 0x2580, 0x0000,
+	    0x4679, 0x0000, 0x0000, 0x2fd4, 0x0000, 0x0000, 0x0000, 0x29ed,
+	    0x012e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1454, 0x2ce3,
+	    0x0a2d, 0x190b, 0x1ab2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b86,
+	    0x0a44, 0x0000, 0x15fd, 0x0000, 0x2b10, 0x2ab2, 0x409b, 0x0000,
+	    0x0000, 0x3e50, 0x0000, 0x0000, 0x0fb2, 0x0000, 0x2729, 0x0000,
+	    0x0000, 0x1d2b, 0x37a8, 0x0000, 0x0000, 0x0000, 0x3113, 0x08dc,
+	    0x0000, 0x0000, 0x4db0, 0x3c11, 0x0729, 0x2854, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0c94, 0x42ef, 0x0fe0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x332c, 0x0000, 0x0000, 0x0000,
+	    0x42ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e6a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b08, 0x0000,
+	    0x0000, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c8a, 0x2e10,
+	    0x18c1, 0x481a, 0x0000, 0x0000, 0x0000, 0x35fe, 0x1139, 0x0910,
+	    0x33fc, 0x0468, 0x1ecf, 0x2837, 0x327b, 0x0000, 0x2bd0, 0x1568,
+	    0x0000, 0x0000, 0x4760, 0x00d9, 0x3878, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x33d2, 0x16ad, 0x058d, 0x0000, 0x0000,
+	    0x0d52, 0x1d4e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0454, 0x0000,
+	    0x0462, 0x433d, 0x0000, 0x0000, 0x2dd6, 0x0000, 0x0000, 0x092a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2856, 0x0000, 0x0000, 0x0951, 0x0000, 0x0000, 0x4418, 0x39da,
+	    0x0000, 0x1ef8, 0x0000, 0x3a90, 0x1e3f, 0x0000, 0x489e, 0x3b90,
+	    0x4431, 0x1890, 0x1db6, 0x3863, 0x0000, 0x4128, 0x4625, 0x0def,
+	    0x0000, 0x0000, 0x2789, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x12b0, 0x0000, 0x01d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3936, 0x0000, 0x4262, 0x2d81, 0x40a7, 0x0000, 0x0000,
+	    0x0000, 0x32c3, 0x0000, 0x38a5, 0x30f3, 0x0000, 0x48e9, 0x0000,
+	    0x0a33, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01bb,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0622, 0x0000, 0x0000,
+	    0x47c1, 0x0000, 0x3995, 0x0573, 0x3348, 0x0000, 0x0000, 0x0000,
+	    0x08eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x14ba, 0x0000, 0x4014, 0x13c9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x47a2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x39d5, 0x32de, 0x0000, 0x3a88, 0x4400,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1803, 0x0000,
+	    0x0000, 0x0000, 0x2832, 0x0000, 0x1e44, 0x42bc, 0x0000, 0x0000,
+	    0x369f, 0x0000, 0x4808, 0x0000, 0x0000, 0x0000, 0x0000, 0x04ef,
+	    0x0000, 0x0000, 0x2149, 0x3073, 0x0000, 0x3f7a, 0x0000, 0x002c,
+	    0x0000, 0x3f3e, 0x3624, 0x1afa, 0x04ab, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2e98, 0x4319, 0x421f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x24c0, 0x0000, 0x0000, 0x0000, 0x374f, 0x0000, 0x0000, 0x0000,
+	    0x3660, 0x0000, 0x00a3, 0x266b, 0x477f, 0x0000, 0x440b, 0x0000,
+	    0x32de, 0x1205, 0x0000, 0x2197, 0x48aa, 0x3f79, 0x0000, 0x0000,
+	    0x0000, 0x2841, 0x0468, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x22f4, 0x0000, 0x18d2, 0x0000, 0x0000, 0x0d95, 0x0000, 0x0000,
+	    0x0000, 0x4c29, 0x0000, 0x0000, 0x1713, 0x0000, 0x0000, 0x1212,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c4f,
+	    0x3be8, 0x092d, 0x0000, 0x0000, 0x4de2, 0x0b6e, 0x29ff, 0x1425,
+	    0x41fe, 0x1008, 0x2aba, 0x0000, 0x0000, 0x487a, 0x0000, 0x0000,
+	    0x09a2, 0x0000, 0x28c0, 0x2207, 0x0000, 0x2ec1, 0x0000, 0x42eb,
+	    0x2603, 0x13ca, 0x03e5, 0x0000, 0x07c7, 0x4c18, 0x0000, 0x0000,
+	    0x0000, 0x357c, 0x0000, 0x4148, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x06c7, 0x0000, 0x0000, 0x0000, 0x1d6d, 0x0000, 0x0b2f, 0x0000,
+	    0x0000, 0x0ec5, 0x260c, 0x03eb, 0x061a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3976, 0x2f5c, 0x39ef, 0x0000, 0x402e,
+	    0x0000, 0x2f9c, 0x1ff5, 0x0000, 0x1490, 0x21ce, 0x0000, 0x0000,
+	    0x0000, 0x0bbe, 0x0000, 0x0000, 0x23d6, 0x22c3, 0x1356, 0x0040,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4c2b, 0x1333, 0x0000, 0x4bcd,
+	    0x0000, 0x214e, 0x228b, 0x0000, 0x0000, 0x0000, 0x0000, 0x14b9,
+	    0x0000, 0x0000, 0x2c57, 0x2ff0, 0x0000, 0x0000, 0x4716, 0x0000,
+	    0x26df, 0x0000, 0x0000, 0x2429, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x29f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x464c,
+	    0x0000, 0x0000, 0x0000, 0x1632, 0x0000, 0x0000, 0x0000, 0x3b01,
+	    0x03fc, 0x424b, 0x15d1, 0x3f6e, 0x2df6, 0x0000, 0x0000, 0x4c25,
+	    0x0000, 0x0552, 0x0000, 0x3882, 0x0000, 0x2ad2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x0000, 0x14c2, 0x0000,
+	    0x0000, 0x1df0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3778, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fe2,
+	    0x0000, 0x0000, 0x3931, 0x112c, 0x0000, 0x30f7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2f7f, 0x0000, 0x0000, 0x4a79, 0x0000, 0x0000,
+	    0x1d76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f4c,
+	    0x0000, 0x314e, 0x0000, 0x0000, 0x3c2b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0f68, 0x225c, 0x0000, 0x0000, 0x0000, 0x0000, 0x12e2,
+	    0x0000, 0x034d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2dcc, 0x0000, 0x1727, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3b8b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4575, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0556,
+	    0x2ea3, 0x0000, 0x3e1e, 0x0000, 0x2a18, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3d5d, 0x155f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0cdb, 0x39e1, 0x0000, 0x3061, 0x0000, 0x0567, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f22,
+	    0x1f00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x28d1, 0x0000, 0x443f, 0x0000, 0x00c5, 0x0b44, 0x0000, 0x2e68,
+	    0x0000, 0x0000, 0x0000, 0x09da, 0x0000, 0x0000, 0x0443, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1bf1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0ec8, 0x0000, 0x0010, 0x0000, 0x34c2, 0x0000, 0x0000,
+	    0x3b2b, 0x4643, 0x33e0, 0x0000, 0x0000, 0x0000, 0x24ed, 0x2d18,
+	    0x0000, 0x0000, 0x36d0, 0x0000, 0x21ca, 0x0000, 0x0000, 0x1228,
+	    0x0000, 0x0000, 0x3d95, 0x0000, 0x058f, 0x0000, 0x32e4, 0x0000,
+	    0x0000, 0x14c5, 0x099e, 0x0000, 0x0000, 0x0000, 0x436b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2ecf, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x39ac, 0x0000, 0x1013, 0x13fc,
+	    0x3a7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0cc1, 0x05f7, 0x0000, 0x0477, 0x19d1,
+	    0x0000, 0x3633, 0x0000, 0x2b51, 0x0000, 0x0f0e, 0x1bf7, 0x0000,
+	    0x17f2, 0x0b6a, 0x0000, 0x0c22, 0x0000, 0x3dc0, 0x1f1b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x206d, 0x0000, 0x0000, 0x1f31, 0x0000,
+	    0x435a, 0x0000, 0x0000, 0x0000, 0x0000, 0x1170, 0x4bb2, 0x0000,
+	    0x2a73, 0x1612, 0x0792, 0x0a56, 0x0000, 0x0000, 0x0000, 0x1219,
+	    0x44fa, 0x2f01, 0x0000, 0x0000, 0x4474, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3c4a, 0x0000, 0x0000, 0x3609, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x12fd, 0x0000, 0x04a5, 0x0000, 0x3d7a,
+	    0x0000, 0x382c, 0x0000, 0x0000, 0x0000, 0x0000, 0x034c, 0x0860,
+	    0x0000, 0x0000, 0x0b25, 0x4afb, 0x155c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x228b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3eaf, 0x2c56, 0x1a3c, 0x0000, 0x068f, 0x2c93, 0x0000, 0x1c9d,
+	    0x3776, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01d9, 0x0000, 0x4aa3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3e4f, 0x3190, 0x0000, 0x0000, 0x3231, 0x0000, 0x0000,
+	    0x0000, 0x1433, 0x0000, 0x10eb, 0x0000, 0x0000, 0x0000, 0x0593,
+	    0x0000, 0x0906, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d19, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b05, 0x4201, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x136a, 0x0000, 0x0000, 0x0000, 0x4e18,
+	    0x0000, 0x3aa8, 0x34fa, 0x09fc, 0x0000, 0x0fc5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4bfd, 0x449f, 0x4668, 0x0000,
+	    0x3d05, 0x0000, 0x0000, 0x3b4a, 0x3cf0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4de9, 0x0000, 0x0000, 0x25b4, 0x2668,
+	    0x3ee7, 0x0000, 0x06e1, 0x0000, 0x4ce6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2614, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x12be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x43ff,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2915, 0x0000,
+	    0x00fd, 0x4785, 0x0000, 0x0000, 0x0000, 0x46a9, 0x3eac, 0x0000,
+	    0x1433, 0x0000, 0x0000, 0x0000, 0x3879, 0x281a, 0x38ba, 0x0000,
+	    0x028b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f7a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x181f, 0x0000, 0x0000, 0x0000,
+	    0x2a07, 0x35d4, 0x0000, 0x41b7, 0x0000, 0x3f34, 0x0000, 0x38de,
+	    0x0000, 0x03bf, 0x47f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4baa, 0x0000, 0x0000, 0x0f2e, 0x3d15, 0x21ca,
+	    0x11bb, 0x40f6, 0x0000, 0x0000, 0x2512, 0x290e, 0x1623, 0x4943,
+	    0x0000, 0x1ddb, 0x0ef5, 0x0d4e, 0x0000, 0x0d81, 0x2471, 0x0000,
+	    0x252b, 0x0000, 0x0000, 0x0000, 0x1b99, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0c2f, 0x0000, 0x0000, 0x1edc, 0x0000, 0x056d, 0x0000, 0x0000,
+	    0x2d0f, 0x0000, 0x3db1, 0x1104, 0x0000, 0x0c91, 0x0000, 0x1469,
+	    0x0000, 0x1019, 0x0000, 0x0000, 0x0000, 0x0000, 0x405a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2ea5, 0x0000, 0x0000, 0x213e, 0x0be6,
+	    0x0000, 0x076f, 0x3c1e, 0x4c7e, 0x28ef, 0x0000, 0x3b53, 0x4d45,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2adb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2f3b, 0x0000, 0x31f7, 0x0000, 0x05d5,
+	    0x0000, 0x04a5, 0x0000, 0x4b4f, 0x0000, 0x0000, 0x0000, 0x078c,
+	    0x0000, 0x299c, 0x0000, 0x0000, 0x3fc7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x29d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2ae0, 0x0da8, 0x2b32, 0x0000, 0x25e3, 0x0000, 0x4ab8,
+	    0x2f80, 0x177b, 0x0000, 0x0595, 0x1a70, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2d09, 0x0000, 0x297c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2d30, 0x07ca, 0x0000, 0x0000, 0x03ab, 0x0000,
+	    0x14db, 0x0000, 0x0e9c, 0x469b, 0x2517, 0x1766, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x154c, 0x2252, 0x0000, 0x37ec, 0x0000, 0x0000,
+	    0x2d24, 0x34db, 0x0000, 0x30c7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x36b6, 0x3129, 0x0a66, 0x0000, 0x0000, 0x0000, 0x2b24, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3fde, 0x0000, 0x1f40, 0x0000,
+	    0x0000, 0x0000, 0x2553, 0x2025, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x226e, 0x2135, 0x2440, 0x3eb2, 0x0000,
+	    0x36ed, 0x0000, 0x0000, 0x0794, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3abf, 0x0faa, 0x0c68, 0x0000, 0x13d8,
+	    0x2664, 0x0000, 0x0000, 0x3663, 0x0000, 0x1cd8, 0x0000, 0x0000,
+	    0x1ea2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28e6,
+	    0x4409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2917,
+	    0x0000, 0x0000, 0x0557, 0x0000, 0x0000, 0x4ade, 0x2184, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24de, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0b4b, 0x0000, 0x0000, 0x0000, 0x343e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4db6, 0x21f8, 0x0000, 0x3e7a, 0x0000, 0x25c9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0446, 0x00f3, 0x0000,
+	    0x0000, 0x43ac, 0x0000, 0x3f14, 0x0000, 0x302f, 0x3400, 0x0000,
+	    0x485e, 0x0000, 0x0a6d, 0x0000, 0x3c07, 0x0000, 0x0019, 0x0000,
+	    0x0000, 0x4223, 0x0000, 0x3896, 0x1376, 0x0000, 0x1c48, 0x35e6,
+	    0x0000, 0x0000, 0x019b, 0x0000, 0x0000, 0x0000, 0x35ff, 0x0000,
+	    0x357d, 0x0000, 0x0000, 0x3a6b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x49ce, 0x0000, 0x3da2, 0x0000, 0x0054,
+	    0x0000, 0x0000, 0x0000, 0x31d8, 0x12b9, 0x42dd, 0x0000, 0x371c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25a4, 0x0000,
+	    0x0000, 0x1100, 0x43ff, 0x3eff, 0x363c, 0x0000, 0x13d1, 0x0000,
+	    0x4bbf, 0x0000, 0x06cb, 0x0000, 0x4d51, 0x4be5, 0x0300, 0x3d71,
+	    0x3d60, 0x3a30, 0x0000, 0x0000, 0x463e, 0x435f, 0x0000, 0x0d75,
+	    0x0000, 0x0000, 0x42ac, 0x0000, 0x07c4, 0x0000, 0x0000, 0x3efd,
+	    0x0000, 0x0000, 0x0000, 0x07bb, 0x0000, 0x0000, 0x2c9d, 0x13c3,
+	    0x32dd, 0x38b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3f37, 0x0000, 0x0000, 0x0000, 0x39a0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x44ec, 0x0000, 0x3a75, 0x0000,
+	    0x0000, 0x0000, 0x4417, 0x3ff3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1c70, 0x0000, 0x056a, 0x18f0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3393, 0x0000, 0x0000, 0x0000, 0x2775, 0x4a5d, 0x30e6,
+	    0x0000, 0x0000, 0x340b, 0x0031, 0x0000, 0x2606, 0x0000, 0x0000,
+	    0x474a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f6c, 0x0000, 0x0000,
+	    0x0000, 0x10f7, 0x0f31, 0x00a8, 0x4536, 0x284d, 0x0000, 0x0000,
+	    0x0ed6, 0x0000, 0x0000, 0x1f78, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x452c, 0x0000, 0x0000, 0x0f05, 0x0000, 0x0b92,
+	    0x2e0b, 0x36d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b1c, 0x258c,
+	    0x0000, 0x29ce, 0x0000, 0x0000, 0x3cf8, 0x0000, 0x4dac, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x40fa, 0x0000, 0x0000, 0x19e3,
+	    0x4b05, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1c0c, 0x2f1e, 0x0000, 0x0000, 0x3c83, 0x0000, 0x0000, 0x0000,
+	    0x1894, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000, 0x4036, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0629, 0x16d6, 0x0664, 0x0000, 0x0000,
+	    0x03c7, 0x0a2b, 0x0000, 0x102f, 0x0000, 0x21dd, 0x0888, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26c6, 0x1e9c, 0x0000,
+	    0x0000, 0x0072, 0x0000, 0x46a0, 0x0000, 0x0000, 0x30a3, 0x2be2,
+	    0x0000, 0x0000, 0x4ab1, 0x0000, 0x0000, 0x094a, 0x20ef, 0x0000,
+	    0x0000, 0x0000, 0x11a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x215a,
+	    0x0000, 0x0000, 0x3a06, 0x0435, 0x0825, 0x28d7, 0x0000, 0x0000,
+	    0x0000, 0x0f56, 0x0fc4, 0x2a6b, 0x20ce, 0x0000, 0x0000, 0x0000,
+	    0x4ccc, 0x001c, 0x0000, 0x4d83, 0x45d1, 0x0000, 0x0a38, 0x0215,
+	    0x0000, 0x3178, 0x0000, 0x1b7b, 0x0000, 0x10e0, 0x0000, 0x4081,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x196d, 0x394d, 0x0000, 0x1fbf,
+	    0x25d1, 0x0000, 0x0000, 0x0000, 0x4cf6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x32ae, 0x0000, 0x0000, 0x0000, 0x0354, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x49d6, 0x2314, 0x1b7c, 0x0000, 0x0000, 0x0000,
+	    0x4851, 0x0000, 0x0000, 0x0c0e, 0x21b3, 0x2379, 0x0000, 0x0000,
+	    0x0000, 0x3c79, 0x0816, 0x0000, 0x0000, 0x0000, 0x0000, 0x0142,
+	    0x1bf5, 0x0000, 0x184c, 0x0000, 0x342a, 0x0000, 0x3d11, 0x0000,
+	    0x0000, 0x0000, 0x0b93, 0x4bae, 0x0000, 0x0667, 0x0000, 0x2482,
+	    0x3885, 0x0000, 0x0000, 0x0000, 0x0000, 0x2ac2, 0x07ad, 0x0000,
+	    0x4865, 0x0000, 0x0000, 0x1841, 0x0000, 0x3fa6, 0x3a42, 0x0000,
+	    0x1576, 0x035a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x150f, 0x3ae3, 0x0000, 0x0000, 0x0000, 0x0000, 0x151a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1450,
+	    0x0000, 0x06a2, 0x47e4, 0x1d24, 0x0000, 0x0000, 0x4c08, 0x2bbc,
+	    0x0000, 0x0000, 0x0ff2, 0x118d, 0x4287, 0x0000, 0x0f65, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0392, 0x0000,
+	    0x27df, 0x4554, 0x0000, 0x2f2d, 0x0000, 0x0000, 0x22e0, 0x22a6,
+	    0x45ed, 0x21f3, 0x0000, 0x19e9, 0x047a, 0x0000, 0x0000, 0x44e2,
+	    0x363c, 0x14e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x12f8, 0x2ec7,
+	    0x1e6a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2097, 0x24aa,
+	    0x0000, 0x0000, 0x06f7, 0x0000, 0x0000, 0x455e, 0x0000, 0x0000,
+	    0x3bbc, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b65, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0a85, 0x4024, 0x0000, 0x0000, 0x125a, 0x0000,
+	    0x0000, 0x0000, 0x3cbf, 0x0000, 0x0000, 0x1d4e, 0x0000, 0x18b8,
+	    0x442a, 0x0000, 0x36b0, 0x0000, 0x46b0, 0x0000, 0x0000, 0x2365,
+	    0x0000, 0x0000, 0x36b9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2e9b, 0x4d92, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34a2, 0x31a1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0d5c, 0x0000, 0x34d4, 0x0000,
+	    0x0000, 0x0000, 0x3efa, 0x0000, 0x0000, 0x110b, 0x0000, 0x0000,
+	    0x0000, 0x40d6, 0x34ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3eca, 0x2218, 0x0000, 0x0000, 0x0bbb,
+	    0x4c54, 0x11ff, 0x0000, 0x0000, 0x0000, 0x2f01, 0x0000, 0x0000,
+	    0x0e58, 0x0a5f, 0x0000, 0x0000, 0x0000, 0x1634, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04e7, 0x435d, 0x0df5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4c5b, 0x0000, 0x0000, 0x3d02, 0x0000, 0x0000,
+	    0x0206, 0x0000, 0x0000, 0x2520, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0f8d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4c3e, 0x0000, 0x0498, 0x3f78, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x03cd, 0x0000, 0x24b3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x27e3, 0x135e, 0x0000, 0x0000, 0x2c81, 0x0000, 0x0000, 0x0e35,
+	    0x0000, 0x132c, 0x41da, 0x0c06, 0x0000, 0x3136, 0x0000, 0x3004,
+	    0x0000, 0x0000, 0x0412, 0x0000, 0x0000, 0x0b89, 0x0000, 0x0000,
+	    0x137e, 0x0000, 0x0000, 0x0000, 0x108b, 0x0000, 0x0000, 0x3c98,
+	    0x42d6, 0x0000, 0x4018, 0x0000, 0x0000, 0x0000, 0x3cba, 0x0000,
+	    0x1749, 0x0000, 0x4323, 0x0000, 0x43f6, 0x0000, 0x0e4b, 0x0000,
+	    0x40a6, 0x0000, 0x2009, 0x1f84, 0x0000, 0x0000, 0x0000, 0x21d5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2d5a, 0x1cbd, 0x0000, 0x0000,
+	    0x0000, 0x0258, 0x2bb2, 0x0000, 0x0000, 0x0000, 0x2149, 0x0000,
+	    0x0123, 0x0000, 0x3d2e, 0x0000, 0x0000, 0x0000, 0x0000, 0x45da,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2d51, 0x1b8f, 0x26fb, 0x0000,
+	    0x14f4, 0x0a66, 0x0000, 0x0000, 0x062b, 0x0000, 0x0000, 0x119c,
+	    0x2c58, 0x13d3, 0x02f8, 0x0000, 0x064e, 0x44c8, 0x0000, 0x26af,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2c26, 0x3653, 0x0000, 0x0000,
+	    0x0000, 0x24b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x08f1, 0x0929,
+	    0x0000, 0x1d46, 0x0000, 0x0000, 0x0000, 0x49c8, 0x2bc6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2eae, 0x4b2d, 0x1bc7, 0x0000, 0x1927,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1e64, 0x0080, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0d60, 0x0000, 0x0000, 0x0000, 0x0000, 0x2462,
+	    0x1f71, 0x0000, 0x0000, 0x0000, 0x252f, 0x0c26, 0x0000, 0x005d,
+	    0x0000, 0x0000, 0x0000, 0x2934, 0x2c4d, 0x0000, 0x0000, 0x3e54,
+	    0x0000, 0x4864, 0x0000, 0x0000, 0x4ad1, 0x0422, 0x0515, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x174b, 0x0000, 0x3f1f, 0x0000, 0x0000,
+	    0x0000, 0x2062, 0x3e72, 0x0000, 0x0f25, 0x04b3, 0x0000, 0x0000,
+	    0x32df, 0x3f3e, 0x3ad6, 0x0000, 0x0d1d, 0x047c, 0x0000, 0x1eff,
+	    0x0000, 0x0000, 0x24ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2bd3, 0x0c02, 0x0000, 0x2eec, 0x0000, 0x4426, 0x077a, 0x0000,
+	    0x0000, 0x184b, 0x295b, 0x0000, 0x0000, 0x0000, 0x1422, 0x0000,
+	    0x0000, 0x3a2c, 0x0000, 0x435f, 0x0000, 0x0000, 0x4353, 0x0000,
+	    0x3df4, 0x0000, 0x3077, 0x0000, 0x2ba8, 0x48ee, 0x4134, 0x3b84,
+	    0x0000, 0x482e, 0x0000, 0x0000, 0x0000, 0x29af, 0x0000, 0x0c86,
+	    0x3318, 0x0000, 0x0000, 0x2f43, 0x0000, 0x477e, 0x0000, 0x0000,
+	    0x01ee, 0x4a65, 0x0000, 0x0000, 0x0000, 0x06a9, 0x0000, 0x0000,
+	    0x0000, 0x0755, 0x1185, 0x3b81, 0x3b00, 0x0000, 0x3a15, 0x0000,
+	    0x0000, 0x0000, 0x31ef, 0x0000, 0x0000, 0x0000, 0x3ceb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x176b, 0x1863, 0x19f6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x14cb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x383f, 0x2e77, 0x0000, 0x0000,
+	    0x29e1, 0x0000, 0x0000, 0x0000, 0x0689, 0x1b19, 0x0000, 0x0000,
+	    0x1c93, 0x1663, 0x0000, 0x012e, 0x0000, 0x0db7, 0x0000, 0x49d5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0276, 0x31fd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x49f8, 0x0000,
+	    0x21ef, 0x0000, 0x23a6, 0x0000, 0x0000, 0x1613, 0x0000, 0x0000,
+	    0x4202, 0x0000, 0x0000, 0x0000, 0x0000, 0x4385, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22ad,
+	    0x0000, 0x0000, 0x49fa, 0x0000, 0x23d3, 0x0ac5, 0x0000, 0x0ac5,
+	    0x4b7c, 0x43a2, 0x14a9, 0x0000, 0x1db1, 0x0000, 0x23a7, 0x0000,
+	    0x0000, 0x014a, 0x0000, 0x2b7e, 0x0000, 0x0550, 0x0000, 0x0000,
+	    0x0000, 0x3254, 0x0000, 0x3cfa, 0x45c3, 0x3814, 0x421b, 0x0000,
+	    0x0000, 0x39a7, 0x0000, 0x0000, 0x1bd3, 0x0000, 0x0000, 0x0000,
+	    0x3b67, 0x42ba, 0x0b59, 0x3065, 0x0000, 0x3f66, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x125d, 0x0000, 0x23ce, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3cca, 0x0000, 0x068e, 0x4390, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x08e6, 0x0000, 0x4669, 0x21c6, 0x0000, 0x0000, 0x34e8,
+	    0x0000, 0x1722, 0x1b54, 0x1436, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x34c4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x209f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34ec,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x17aa,
+	    0x26f7, 0x32b7, 0x0000, 0x0000, 0x3e70, 0x0000, 0x0000, 0x0000,
+	    0x01bf, 0x0000, 0x0000, 0x0189, 0x0000, 0x0000, 0x1199, 0x0000,
+	    0x0000, 0x0000, 0x2765, 0x15b3, 0x0000, 0x0000, 0x0d47, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2bc9, 0x0000,
+	    0x0000, 0x342d, 0x0000, 0x0000, 0x0000, 0x1c79, 0x0000, 0x0000,
+	    0x0000, 0x42d4, 0x0000, 0x0469, 0x0000, 0x20a0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a45, 0x0000,
+	    0x0000, 0x0000, 0x3aee, 0x0000, 0x0b95, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0acf, 0x0000, 0x0fe4, 0x0000, 0x4953, 0x0000, 0x108e,
+	    0x45ed, 0x2d7a, 0x0a64, 0x145d, 0x0000, 0x0000, 0x45a2, 0x0000,
+	    0x46db, 0x0000, 0x0000, 0x0000, 0x0000, 0x09fe, 0x0000, 0x1aa5,
+	    0x28d3, 0x0000, 0x2fc2, 0x0000, 0x0000, 0x2d72, 0x0992, 0x099e,
+	    0x21c7, 0x0000, 0x0000, 0x2d8d, 0x0000, 0x0000, 0x3970, 0x2270,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38e9, 0x0000,
+	    0x0000, 0x0000, 0x045e, 0x0000, 0x0000, 0x2c69, 0x33ed, 0x0000,
+	    0x0000, 0x3686, 0x4c23, 0x0000, 0x0d80, 0x07f8, 0x0000, 0x0000,
+	    0x0000, 0x0fb7, 0x0000, 0x0000, 0x0000, 0x39c8, 0x0997, 0x0000,
+	    0x0000, 0x0000, 0x3f32, 0x24a0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1d0e, 0x0000, 0x20e2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0a0b, 0x15ff, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x28b8, 0x0000, 0x0000, 0x0000, 0x0bbb, 0x0000, 0x0000,
+	    0x21d5, 0x0000, 0x008b, 0x15c3, 0x0000, 0x0000, 0x011b, 0x25dc,
+	    0x0000, 0x0000, 0x4952, 0x01c8, 0x1b88, 0x0000, 0x0000, 0x0000,
+	    0x2ffd, 0x0000, 0x0000, 0x0693, 0x385a, 0x0000, 0x2377, 0x0bb7,
+	    0x4d50, 0x0000, 0x0000, 0x0000, 0x3bea, 0x0000, 0x0000, 0x0000,
+	    0x0646, 0x03c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x337e,
+	    0x0000, 0x1f12, 0x0000, 0x2969, 0x0000, 0x2c5a, 0x3731, 0x0000,
+	    0x0000, 0x0000, 0x14c7, 0x0000, 0x0000, 0x1f52, 0x0ccb, 0x0000,
+	    0x0000, 0x3123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1a7c, 0x0000, 0x0000, 0x360e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0b4c, 0x0000, 0x463a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2428, 0x4115, 0x0739, 0x0000, 0x0000, 0x0155, 0x423c,
+	    0x0000, 0x0000, 0x3e8c, 0x4972, 0x0000, 0x3071, 0x2b2e, 0x0000,
+	    0x070b, 0x0000, 0x0a7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x34aa,
+	    0x0000, 0x2c9f, 0x0000, 0x0000, 0x0000, 0x2fce, 0x0000, 0x025e,
+	    0x0000, 0x0000, 0x1fd2, 0x0000, 0x0000, 0x0000, 0x0e73, 0x0000,
+	    0x01aa, 0x0000, 0x0000, 0x2ccc, 0x2a66, 0x4395, 0x0e23, 0x0cb1,
+	    0x0000, 0x0000, 0x0000, 0x3103, 0x0000, 0x0000, 0x4198, 0x0000,
+	    0x3a79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1960,
+	    0x2266, 0x1d8b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c2b,
+	    0x30e9, 0x43b5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1772, 0x21b0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0da7, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x35e4, 0x0000, 0x19a9, 0x03af, 0x2233,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2772, 0x0000, 0x0000, 0x0000,
+	    0x36aa, 0x458b, 0x4d02, 0x2852, 0x0000, 0x0000, 0x0000, 0x2992,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x273f, 0x0000, 0x0000,
+	    0x0000, 0x2bd0, 0x0000, 0x0000, 0x0775, 0x0000, 0x0000, 0x25a7,
+	    0x0000, 0x0000, 0x0000, 0x46a9, 0x0000, 0x0000, 0x0000, 0x27e3,
+	    0x2d24, 0x07a6, 0x0000, 0x2aad, 0x0000, 0x1000, 0x129e, 0x1009,
+	    0x2d2a, 0x36da, 0x0000, 0x0000, 0x0074, 0x49d0, 0x0000, 0x0000,
+	    0x3c74, 0x160b, 0x0000, 0x0000, 0x2cd2, 0x3c1d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x274c, 0x464d, 0x0000,
+	    0x2773, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e89, 0x0000,
+	    0x0000, 0x1361, 0x0000, 0x0000, 0x079a, 0x0000, 0x0000, 0x11f6,
+	    0x1e54, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0544, 0x0000, 0x38c0, 0x0000, 0x3e4b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2ec8, 0x29cb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x117a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1c3f, 0x0000, 0x0000, 0x0000,
+	    0x098d, 0x0f00, 0x0d06, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22e9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4969, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3e45, 0x0000, 0x0000, 0x3acb, 0x18a3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0da9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1c5b, 0x0000, 0x0000, 0x0789, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0905, 0x0000, 0x241d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0707, 0x0000, 0x4bf5, 0x0000,
+	    0x0000, 0x0000, 0x43ad, 0x0000, 0x0000, 0x0000, 0x25d6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1fa4, 0x0000, 0x24f8, 0x0000,
+	    0x3ba1, 0x0000, 0x0b9b, 0x3daa, 0x0000, 0x24bb, 0x0000, 0x375f,
+	    0x0847, 0x074e, 0x0bf5, 0x0e6b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0fd2, 0x0000, 0x4da9, 0x0000, 0x0000, 0x0000, 0x2913, 0x13f8,
+	    0x0000, 0x0000, 0x3e3d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3055, 0x3b24, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0d3d, 0x2dcb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x09f7, 0x40e9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f0c,
+	    0x0000, 0x1399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25ff,
+	    0x0865, 0x0ab4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x37ec,
+	    0x0000, 0x0000, 0x0000, 0x1d72, 0x4c1f, 0x0000, 0x0000, 0x32a9,
+	    0x0000, 0x3067, 0x15d6, 0x0000, 0x0000, 0x1bf2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x34d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ab4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30f7,
+	    0x0000, 0x0000, 0x3b66, 0x0000, 0x0000, 0x0000, 0x0974, 0x057d,
+	    0x25f9, 0x0000, 0x09b9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2daa, 0x0966, 0x3533, 0x42d2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x13eb, 0x0744, 0x2d9f,
+	    0x2b2c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02b5, 0x2555,
+	    0x18d1, 0x0000, 0x0000, 0x27db, 0x0000, 0x0000, 0x0000, 0x048f,
+	    0x08fc, 0x206f, 0x0000, 0x0000, 0x00e5, 0x0a22, 0x0000, 0x0000,
+	    0x0000, 0x24cd, 0x0000, 0x27a3, 0x0000, 0x4547, 0x0e75, 0x0000,
+	    0x0000, 0x0000, 0x118a, 0x0000, 0x3cd8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04b6, 0x0000, 0x0000, 0x3837, 0x0000, 0x2a49,
+	    0x074f, 0x0000, 0x1f1b, 0x0000, 0x0000, 0x3413, 0x0000, 0x0000,
+	    0x2b26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a6f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1872,
+	    0x0000, 0x35f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f35, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1bf2, 0x0c53, 0x3a45, 0x0000, 0x0000,
+	    0x0bd2, 0x0000, 0x0000, 0x36b6, 0x1702, 0x0000, 0x4803, 0x0000,
+	    0x013e, 0x0000, 0x0000, 0x0000, 0x0000, 0x3955, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2d22, 0x0000, 0x0000, 0x452e, 0x0000, 0x0ea3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x06a5, 0x0000, 0x3694, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x116a, 0x0000, 0x0000, 0x0000, 0x09e3,
+	    0x0000, 0x0000, 0x4549, 0x2c25, 0x2b50, 0x0000, 0x26d5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4226, 0x16d2, 0x26f6, 0x0000,
+	    0x0000, 0x25a9, 0x0000, 0x23a7, 0x0000, 0x188d, 0x35a3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x32f5,
+	    0x0000, 0x368b, 0x0000, 0x0000, 0x21af, 0x0000, 0x0000, 0x0000,
+	    0x4329, 0x0000, 0x10eb, 0x4af4, 0x0000, 0x1575, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1111, 0x1d28, 0x4315, 0x0000, 0x120b, 0x37f2,
+	    0x0000, 0x0000, 0x3307, 0x0000, 0x0000, 0x1fc1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2a3f, 0x0000, 0x01e8, 0x36b4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4cf5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4a27, 0x3e98, 0x0000, 0x0000, 0x0000, 0x0000, 0x06c6,
+	    0x2108, 0x35b9, 0x0000, 0x0000, 0x0000, 0x4cd8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3355, 0x4017, 0x36aa,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c37, 0x0000, 0x4df0,
+	    0x0000, 0x39b7, 0x0000, 0x0000, 0x0000, 0x4045, 0x0000, 0x43b1,
+	    0x44d3, 0x0000, 0x4360, 0x0000, 0x0110, 0x0000, 0x0000, 0x2cb7,
+	    0x0000, 0x2a33, 0x0000, 0x0000, 0x335e, 0x04ad, 0x0000, 0x0000,
+	    0x0ad9, 0x3280, 0x41ff, 0x4663, 0x0000, 0x0000, 0x1c63, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x16ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4d59, 0x0000, 0x350b, 0x0000, 0x1ac5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e39, 0x2fc8, 0x22e4,
+	    0x0000, 0x242f, 0x0000, 0x0000, 0x0000, 0x1d6e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4c6b, 0x0000, 0x0000, 0x066f, 0x0000, 0x0000,
+	    0x2c03, 0x30f6, 0x3491, 0x0000, 0x0000, 0x19c3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x22a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x11e1, 0x09cf, 0x0000, 0x0000, 0x3d89, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x16fb, 0x0000, 0x0000, 0x0427, 0x3aaf, 0x0000,
+	    0x0000, 0x2cea, 0x0000, 0x0000, 0x13f0, 0x0000, 0x4c7d, 0x0000,
+	    0x0000, 0x3cfc, 0x0c81, 0x0000, 0x0000, 0x41f9, 0x136e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1b90, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x03bd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0fdf, 0x0000, 0x0000, 0x0000, 0x4325, 0x0869, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e80,
+	    0x0000, 0x0000, 0x0000, 0x37de, 0x0000, 0x24fc, 0x0000, 0x1027,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1aad, 0x0000, 0x0000, 0x0000,
+	    0x11f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2fa0, 0x0000,
+	    0x0000, 0x3b6e, 0x0000, 0x4067, 0x0000, 0x0000, 0x1458, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x415e, 0x0000, 0x207c,
+	    0x429d, 0x0000, 0x0000, 0x0000, 0x3941, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x11d5, 0x124b, 0x0000, 0x08c3, 0x0000, 0x0b77, 0x4c71,
+	    0x0000, 0x0000, 0x0aae, 0x40da, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x37a8, 0x0000, 0x0000, 0x0000, 0x281a, 0x0000, 0x0000,
+	    0x0000, 0x0421, 0x0000, 0x0000, 0x2295, 0x442d, 0x0000, 0x0e62,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x23e9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0cfe, 0x0000, 0x0000, 0x1962, 0x4c6f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1961, 0x3ba7, 0x0e7c,
+	    0x0000, 0x01d5, 0x0000, 0x2dcf, 0x0f10, 0x0000, 0x0000, 0x1ff5,
+	    0x0000, 0x4749, 0x1c62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x192e,
+	    0x0000, 0x0000, 0x4408, 0x0720, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4be3, 0x0000, 0x4219, 0x0000, 0x4199, 0x421f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0d77, 0x0cd4, 0x0000, 0x1d34,
+	    0x0000, 0x0000, 0x3e5b, 0x1bdb, 0x02d6, 0x3c87, 0x271c, 0x1819,
+	    0x0000, 0x0000, 0x0000, 0x1cdd, 0x32cd, 0x0bb5, 0x4db3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0a9c, 0x18de, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0a25, 0x0000, 0x0000, 0x0000, 0x0000, 0x40bf, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0071, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x19db, 0x2539, 0x0000, 0x0000, 0x2a06, 0x0fa6, 0x0000, 0x0000,
+	    0x2f39, 0x0000, 0x2119, 0x08f4, 0x2dde, 0x31db, 0x0000, 0x0000,
+	    0x1f6f, 0x170e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x357f, 0x0000, 0x2b93, 0x0000, 0x2a9b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0f9b, 0x0000, 0x209b, 0x190c, 0x1446, 0x0000, 0x0000,
+	    0x0000, 0x2d99, 0x08d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1215,
+	    0x0000, 0x0000, 0x0000, 0x3641, 0x0000, 0x2cbc, 0x0000, 0x0000,
+	    0x0000, 0x07d9, 0x3f44, 0x0000, 0x04c4, 0x4432, 0x0000, 0x4b35,
+	    0x1ce7, 0x0000, 0x0000, 0x0000, 0x0000, 0x09e8, 0x0000, 0x043d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4390, 0x0000, 0x3adf, 0x33d1, 0x4c69, 0x4ccf, 0x0000, 0x2e1c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1485, 0x0c81, 0x0000,
+	    0x0000, 0x0000, 0x4abf, 0x120c, 0x0000, 0x1318, 0x3d3b, 0x0000,
+	    0x0000, 0x30e8, 0x0000, 0x4916, 0x0000, 0x0000, 0x0000, 0x3dc7,
+	    0x0000, 0x0000, 0x2d9d, 0x0000, 0x0000, 0x2d08, 0x0000, 0x33ec,
+	    0x0000, 0x0000, 0x0000, 0x18d7, 0x1485, 0x0000, 0x0000, 0x17fa,
+	    0x2702, 0x0000, 0x22ac, 0x2231, 0x0000, 0x3e7b, 0x0000, 0x0000,
+	    0x0000, 0x4608, 0x4643, 0x4708, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x43af, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x067c, 0x0000, 0x481b, 0x0000, 0x4be8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2d48, 0x37e5, 0x3bfd, 0x3acb, 0x0eef, 0x0000,
+	    0x0000, 0x403c, 0x0000, 0x0000, 0x32e8, 0x0000, 0x12e8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x37f0, 0x0000,
+	    0x0000, 0x242c, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ec2, 0x13af,
+	    0x0000, 0x1a21, 0x0000, 0x28a5, 0x0000, 0x0000, 0x1f32, 0x02c7,
+	    0x0000, 0x0000, 0x2dd1, 0x0000, 0x0000, 0x0000, 0x0134, 0x0000,
+	    0x0bdf, 0x1d54, 0x0000, 0x08e8, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x40fc, 0x0000, 0x0000, 0x30a5, 0x0000, 0x0000, 0x1c17,
+	    0x0000, 0x4b03, 0x2fdd, 0x0000, 0x08d3, 0x0000, 0x27c5, 0x0000,
+	    0x23eb, 0x4848, 0x0000, 0x0079, 0x0000, 0x1ae9, 0x0000, 0x1f10,
+	    0x2a0d, 0x49a6, 0x0000, 0x3646, 0x0597, 0x0000, 0x3c8d, 0x0ebd,
+	    0x2865, 0x4a8d, 0x0000, 0x4856, 0x0000, 0x2e00, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2b72, 0x0293, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24d7, 0x0000, 0x1ff8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x410f, 0x0cc6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x402b,
+	    0x0000, 0x3842, 0x0000, 0x0000, 0x3f65, 0x3db0, 0x2319, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2dae, 0x339e, 0x1c19, 0x0acc,
+	    0x0000, 0x2d7c, 0x4d8e, 0x005b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x299a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31d9, 0x0000,
+	    0x0000, 0x0636, 0x31c2, 0x0000, 0x1eb3, 0x0000, 0x0000, 0x119b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x13a8, 0x13f9,
+	    0x2d5f, 0x0000, 0x2f51, 0x0000, 0x28e2, 0x0000, 0x2909, 0x1b41,
+	    0x0000, 0x0000, 0x3685, 0x0000, 0x0000, 0x0000, 0x0517, 0x0000,
+	    0x03ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x04ff, 0x301b, 0x1b63,
+	    0x0000, 0x2b1a, 0x3c8a, 0x0000, 0x0000, 0x0000, 0x0607, 0x0000,
+	    0x0000, 0x0aaa, 0x0000, 0x3de1, 0x0000, 0x0000, 0x3179, 0x0000,
+	    0x0000, 0x0a3a, 0x0000, 0x0000, 0x34f4, 0x0000, 0x0854, 0x0000,
+	    0x0000, 0x0000, 0x37e6, 0x07f6, 0x0306, 0x3118, 0x4728, 0x1e31,
+	    0x0000, 0x0000, 0x0000, 0x2562, 0x33b2, 0x0000, 0x0000, 0x1dd4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2cd4, 0x0000, 0x0000,
+	    0x0c9b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2267, 0x0000,
+	    0x0000, 0x40ac, 0x0000, 0x0000, 0x0000, 0x44a9, 0x0000, 0x0000,
+	    0x0000, 0x10cc, 0x319e, 0x0000, 0x0000, 0x29ee, 0x0000, 0x0000,
+	    0x1929, 0x41bf, 0x0000, 0x18d0, 0x1fee, 0x0000, 0x0000, 0x0000,
+	    0x0c42, 0x0000, 0x436b, 0x0000, 0x0000, 0x0000, 0x1a09, 0x2ae3,
+	    0x0000, 0x319f, 0x0000, 0x0000, 0x0000, 0x28cd, 0x1317, 0x0000,
+	    0x2de2, 0x2878, 0x0000, 0x1f97, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2aa8, 0x469e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x21ac, 0x0000, 0x0000, 0x0679, 0x0000, 0x0000, 0x4b9b, 0x189c,
+	    0x438a, 0x47cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e05, 0x0000,
+	    0x0000, 0x0000, 0x0575, 0x0000, 0x0000, 0x0000, 0x2759, 0x1665,
+	    0x0000, 0x0000, 0x0000, 0x293e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c79, 0x3783,
+	    0x0000, 0x0000, 0x10ae, 0x3ad1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x16c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4e10,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1461, 0x0000,
+	    0x4710, 0x0000, 0x0000, 0x0000, 0x0000, 0x46ab, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x18df, 0x0000, 0x4d1c, 0x0000, 0x4389, 0x0000,
+	    0x081e, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f3f, 0x0000, 0x2e06,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d18, 0x290f, 0x0000,
+	    0x0000, 0x42e7, 0x46d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0125, 0x0000, 0x47ae, 0x0000, 0x23a4, 0x39f0, 0x0000, 0x00d7,
+	    0x4d7c, 0x0000, 0x0000, 0x0000, 0x09f2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4309, 0x1b71, 0x0000, 0x0000,
+	    0x0000, 0x31d5, 0x1c57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x37de, 0x0000, 0x0758, 0x1159, 0x1882, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1813,
+	    0x0000, 0x3902, 0x0a83, 0x0000, 0x0000, 0x0000, 0x0000, 0x411c,
+	    0x0000, 0x071b, 0x4433, 0x0000, 0x0000, 0x0000, 0x0000, 0x0cc9,
+	    0x0000, 0x0000, 0x364c, 0x2e56, 0x040a, 0x0000, 0x0000, 0x1515,
+	    0x21a0, 0x0000, 0x1615, 0x0000, 0x0000, 0x0000, 0x0461, 0x0264,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x21ee, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1666, 0x0000, 0x2394,
+	    0x0000, 0x0000, 0x0000, 0x49c7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0103, 0x1918, 0x0000, 0x0000, 0x0000, 0x3f45, 0x2d99, 0x0000,
+	    0x0000, 0x0000, 0x308f, 0x0000, 0x0000, 0x0c69, 0x0000, 0x0000,
+	    0x0000, 0x43cd, 0x0000, 0x2f67, 0x0000, 0x16e4, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02b5, 0x0000, 0x35e2, 0x23e2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x34d0, 0x23f3, 0x21d2, 0x0000, 0x28fb,
+	    0x17c7, 0x0000, 0x0000, 0x0000, 0x3949, 0x0000, 0x39e3, 0x0000,
+	    0x4865, 0x4a53, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x342b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45e0,
+	    0x3325, 0x43be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ed3,
+	    0x0000, 0x2395, 0x0000, 0x0eb0, 0x3a50, 0x1876, 0x0000, 0x1966,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42f2, 0x0000, 0x12fa,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1602, 0x4b85, 0x0000, 0x4a87,
+	    0x0000, 0x10c7, 0x0000, 0x44fc, 0x4be6, 0x0000, 0x2c9f, 0x0000,
+	    0x0000, 0x0000, 0x4524, 0x2939, 0x18b9, 0x0000, 0x0000, 0x239b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4677,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b0f, 0x3eac, 0x0000,
+	    0x0000, 0x1b0d, 0x0000, 0x1e75, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4765, 0x0000, 0x0000, 0x36ae, 0x19be, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3f41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2bf7,
+	    0x0000, 0x0000, 0x0000, 0x2bc7, 0x0000, 0x4118, 0x0000, 0x34f2,
+	    0x2aea, 0x0000, 0x4392, 0x0000, 0x188a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0a4b, 0x0000, 0x0000, 0x225d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0b2a, 0x0000, 0x445a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x104b, 0x0000, 0x1d96, 0x0460, 0x1efc, 0x0000,
+	    0x16c1, 0x0000, 0x0000, 0x0000, 0x2049, 0x0000, 0x0000, 0x4214,
+	    0x0000, 0x2008, 0x13be, 0x0000, 0x0bc6, 0x4723, 0x3e2e, 0x0000,
+	    0x0000, 0x08f9, 0x0000, 0x0000, 0x0000, 0x377f, 0x0000, 0x0000,
+	    0x399c, 0x234f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0cb8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1325, 0x228b, 0x0000, 0x0000,
+	    0x39b5, 0x0000, 0x0000, 0x0000, 0x1d46, 0x38e8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x26d9, 0x0000, 0x106d, 0x419e, 0x0000,
+	    0x0000, 0x0000, 0x0c1d, 0x4469, 0x13b1, 0x0000, 0x0000, 0x0c1b,
+	    0x29c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a37, 0x0000,
+	    0x0000, 0x4823, 0x2621, 0x0000, 0x0000, 0x0000, 0x4a53, 0x0000,
+	    0x0000, 0x2a82, 0x0000, 0x0000, 0x0000, 0x2290, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x05e8, 0x4ae4, 0x2cbe, 0x3521, 0x4747,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0524, 0x0000, 0x05a0,
+	    0x0000, 0x0000, 0x0000, 0x1900, 0x0000, 0x0000, 0x0000, 0x0751,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4af8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4bdd, 0x127c, 0x0000, 0x0000, 0x18f5, 0x0424, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1592, 0x4784, 0x0000, 0x0000, 0x4afc,
+	    0x23e3, 0x0000, 0x3bee, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x28b5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0cd2, 0x0000, 0x1b7f, 0x21c6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x08db, 0x0286, 0x3693, 0x1bab, 0x281c,
+	    0x0000, 0x0000, 0x0000, 0x0f13, 0x0000, 0x1dd9, 0x1aa1, 0x0000,
+	    0x3544, 0x0000, 0x03b3, 0x0431, 0x0000, 0x4d7e, 0x3514, 0x0000,
+	    0x061e, 0x0000, 0x0000, 0x0000, 0x0057, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3f69, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c35,
+	    0x0000, 0x0183, 0x1030, 0x2c33, 0x0000, 0x0000, 0x177a, 0x0000,
+	    0x0000, 0x1244, 0x0000, 0x2f5e, 0x1886, 0x0048, 0x0466, 0x2370,
+	    0x0000, 0x08c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x449a, 0x0000,
+	    0x4ba8, 0x0723, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4a4a, 0x0000, 0x0000, 0x0000, 0x18a4, 0x04e1, 0x3ef5, 0x42b6,
+	    0x0000, 0x0000, 0x066c, 0x05e5, 0x4b19, 0x0000, 0x3f91, 0x1ac2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3399, 0x0000, 0x2995, 0x0000,
+	    0x0000, 0x0000, 0x3610, 0x0000, 0x0000, 0x1405, 0x2c4d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x414a, 0x0000,
+	    0x2532, 0x0000, 0x22dc, 0x2a08, 0x152e, 0x4177, 0x0000, 0x0000,
+	    0x25d4, 0x0000, 0x0000, 0x1894, 0x0ddf, 0x4848, 0x0000, 0x0000,
+	    0x0000, 0x0f51, 0x0000, 0x0000, 0x3cdf, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4c70, 0x0000, 0x2b48, 0x0000, 0x3f47, 0x0000, 0x0000,
+	    0x0000, 0x4dc9, 0x0000, 0x4369, 0x0000, 0x337d, 0x14ad, 0x0000,
+	    0x0000, 0x2626, 0x1ed4, 0x140d, 0x0a5a, 0x2d56, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x27e4, 0x0000, 0x0000, 0x2f28,
+	    0x0000, 0x412a, 0x35c2, 0x0000, 0x2da2, 0x0000, 0x0282, 0x0000,
+	    0x0000, 0x095a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x392a, 0x0f20, 0x3421, 0x0000, 0x2ec4, 0x0000,
+	    0x3599, 0x2ee6, 0x2d05, 0x0000, 0x0000, 0x0000, 0x05d6, 0x00f0,
+	    0x1a74, 0x0000, 0x0000, 0x0000, 0x0000, 0x1850, 0x0000, 0x0000,
+	    0x0000, 0x4106, 0x0000, 0x0000, 0x0000, 0x0000, 0x385d, 0x2c4f,
+	    0x0000, 0x0000, 0x0506, 0x28f1, 0x0000, 0x4b4a, 0x31cd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1bd6, 0x0000, 0x0000, 0x0b1b, 0x0000,
+	    0x0000, 0x08f8, 0x0ce5, 0x0000, 0x0000, 0x0000, 0x37eb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0306, 0x0000, 0x0000, 0x0850, 0x0000,
+	    0x0000, 0x0e1b, 0x0000, 0x0000, 0x0712, 0x0000, 0x343b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4114, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e57, 0x0000, 0x0000, 0x2b22, 0x0000, 0x0000,
+	    0x161b, 0x0000, 0x066d, 0x0000, 0x0000, 0x0000, 0x3618, 0x4a2e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e5c,
+	    0x1a68, 0x0000, 0x0000, 0x1d91, 0x0000, 0x3bbc, 0x34b8, 0x1358,
+	    0x0000, 0x0000, 0x0000, 0x2307, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3a8f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0772,
+	    0x3457, 0x0000, 0x0000, 0x0065, 0x0000, 0x0000, 0x21f6, 0x45f1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3381, 0x0000, 0x09c7,
+	    0x0000, 0x0000, 0x0bc6, 0x3a9a, 0x0000, 0x0000, 0x13ca, 0x0000,
+	    0x0000, 0x2391, 0x0000, 0x0000, 0x0000, 0x0000, 0x47c8, 0x0000,
+	    0x0000, 0x416e, 0x0000, 0x0000, 0x0000, 0x2ca6, 0x42c1, 0x0f03,
+	    0x23e8, 0x0000, 0x3297, 0x0000, 0x0000, 0x3d48, 0x25e5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x39be, 0x0000, 0x2991, 0x0000, 0x0000,
+	    0x0640, 0x1181, 0x0000, 0x0000, 0x2656, 0x0000, 0x3668, 0x0000,
+	    0x0000, 0x33a0, 0x0ca9, 0x0000, 0x4907, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3ae7, 0x0000, 0x0000, 0x23a9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3fcb, 0x4182, 0x25e7,
+	    0x49e4, 0x0000, 0x0000, 0x1841, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x24fa, 0x0cf2, 0x1e2d, 0x0247, 0x2262, 0x0000, 0x0000,
+	    0x150b, 0x17fc, 0x0000, 0x0000, 0x0000, 0x44f1, 0x0000, 0x0000,
+	    0x3280, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x14ff, 0x0000, 0x0000, 0x0000, 0x0964, 0x118f, 0x3f1e, 0x0000,
+	    0x338e, 0x0185, 0x47e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x211c, 0x0f78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0224, 0x0000,
+	    0x0000, 0x0000, 0x207f, 0x0000, 0x0000, 0x32af, 0x0000, 0x0e09,
+	    0x0000, 0x33e5, 0x0000, 0x0000, 0x4358, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2447, 0x0000, 0x0000, 0x0929, 0x0000, 0x0000, 0x0000,
+	    0x423b, 0x0000, 0x4a4c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x28c4, 0x0000, 0x0000, 0x157b, 0x0000, 0x4492,
+	    0x0000, 0x3df7, 0x1462, 0x2e84, 0x2b4a, 0x2e73, 0x0000, 0x2233,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3655, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x37a3,
+	    0x0000, 0x0000, 0x1cc6, 0x0000, 0x0000, 0x0000, 0x208d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2f6e, 0x0000, 0x0000, 0x0a70, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x30d1, 0x0000, 0x0500, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x34d3, 0x0000, 0x0000, 0x0000, 0x1742,
+	    0x0000, 0x0000, 0x0000, 0x4df0, 0x0aff, 0x0000, 0x353d, 0x0000,
+	    0x0000, 0x01b9, 0x0000, 0x0000, 0x1d02, 0x0000, 0x0000, 0x0d62,
+	    0x0000, 0x3249, 0x2868, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2f71, 0x0000, 0x0000, 0x0000, 0x0000, 0x4595, 0x0000,
+	    0x3a86, 0x26f5, 0x0000, 0x14d7, 0x120e, 0x0000, 0x37da, 0x0000,
+	    0x3d1a, 0x0308, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3db5, 0x39cc,
+	    0x0000, 0x3df1, 0x4716, 0x0000, 0x3c27, 0x2a71, 0x0000, 0x0000,
+	    0x0000, 0x304a, 0x0000, 0x148f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e5d, 0x0000, 0x47aa, 0x0c39,
+	    0x0000, 0x1ed4, 0x0e9b, 0x4486, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x149e, 0x0000, 0x0000, 0x0000, 0x0000, 0x37be, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1483, 0x0000, 0x0000, 0x0000, 0x07ac, 0x0000,
+	    0x0000, 0x0000, 0x4969, 0x0000, 0x0dd2, 0x301e, 0x1384, 0x0000,
+	    0x2b3c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0ac6, 0x3df2, 0x0000, 0x38d4, 0x04b2, 0x0000, 0x0000,
+	    0x0580, 0x0aba, 0x0000, 0x0000, 0x488f, 0x1a75, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2db3, 0x0000, 0x0000,
+	    0x3370, 0x0000, 0x2997, 0x0000, 0x25ac, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cc9, 0x4c49,
+	    0x0e96, 0x0000, 0x2e26, 0x0870, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2364, 0x30aa, 0x0000, 0x3dfa, 0x1649,
+	    0x2184, 0x0b11, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4495,
+	    0x0000, 0x3cb6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b49, 0x3113,
+	    0x3f2b, 0x0000, 0x0000, 0x4065, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3944, 0x2c91, 0x0000, 0x0000, 0x11ff, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0929, 0x0000, 0x0000,
+	    0x0000, 0x4b06, 0x43d3, 0x2130, 0x0000, 0x0000, 0x0000, 0x474a,
+	    0x0000, 0x368e, 0x0000, 0x0000, 0x19e9, 0x0000, 0x1b56, 0x4812,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4df9, 0x336b, 0x0000, 0x0000, 0x0000,
+	    0x0c04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a09, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3757, 0x0000, 0x3e43, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2901, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x23a5, 0x4cdb, 0x0000, 0x0000, 0x0000, 0x1328, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2453, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0ffe, 0x0000, 0x4b51, 0x3cff, 0x2f61, 0x0000,
+	    0x0000, 0x432a, 0x0d83, 0x0000, 0x1269, 0x0000, 0x0000, 0x0000,
+	    0x4415, 0x0000, 0x0000, 0x0000, 0x0000, 0x38e4, 0x2e0f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4030, 0x0000, 0x3b80, 0x2e2f, 0x4320,
+	    0x1bc0, 0x3df5, 0x0000, 0x0000, 0x21ca, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x49ca, 0x0000, 0x0000,
+	    0x0000, 0x32ca, 0x3735, 0x0cf2, 0x0f69, 0x2467, 0x0000, 0x361b,
+	    0x2dcc, 0x0000, 0x0000, 0x0000, 0x0000, 0x44dc, 0x3f92, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x420b, 0x0000, 0x0000, 0x0000, 0x3a14,
+	    0x0000, 0x2180, 0x0000, 0x127f, 0x1d62, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3b4a, 0x3d0a, 0x201a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x24a2, 0x0217, 0x356c, 0x0000, 0x3463, 0x0000,
+	    0x1fca, 0x0000, 0x0000, 0x0163, 0x4b44, 0x0000, 0x0000, 0x0000,
+	    0x1367, 0x4308, 0x0000, 0x0000, 0x2046, 0x0000, 0x0000, 0x0000,
+	    0x300b, 0x3ee4, 0x16a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x32a9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4ae5, 0x0000, 0x0000, 0x0000, 0x1fb6, 0x3c2d, 0x2010,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x421a,
+	    0x0000, 0x1a68, 0x0606, 0x44cd, 0x1da3, 0x1431, 0x0000, 0x2773,
+	    0x1bf5, 0x3b57, 0x0000, 0x04c7, 0x292e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0844, 0x0000, 0x0000, 0x0000, 0x2e8c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3484, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1dd4, 0x0000, 0x2146, 0x351a, 0x0000, 0x2fd2, 0x0000,
+	    0x0000, 0x0000, 0x4674, 0x0000, 0x0c75, 0x0000, 0x0000, 0x3023,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x47db, 0x0000,
+	    0x1bc3, 0x0ad7, 0x3cc1, 0x122c, 0x1e95, 0x3d02, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x344d, 0x0000, 0x3eb3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2185, 0x0000,
+	    0x4cd3, 0x313a, 0x0000, 0x4a55, 0x0000, 0x07f2, 0x0845, 0x0000,
+	    0x0000, 0x4966, 0x0000, 0x0000, 0x0000, 0x367a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2231, 0x0000, 0x2ace, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2859, 0x0000, 0x392a, 0x077f, 0x0000, 0x0d76, 0x0000,
+	    0x305f, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c0d, 0x103b, 0x0000,
+	    0x20c6, 0x44ad, 0x0000, 0x41b8, 0x0000, 0x0000, 0x0000, 0x169e,
+	    0x0000, 0x0000, 0x2c83, 0x0000, 0x0000, 0x0000, 0x1207, 0x0000,
+	    0x0000, 0x0512, 0x0000, 0x0000, 0x292c, 0x0000, 0x1c4d, 0x225f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e6b, 0x1887, 0x0000,
+	    0x019b, 0x0000, 0x3224, 0x0000, 0x0000, 0x0000, 0x4ae7, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x33c1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4045, 0x4bc4, 0x0a81, 0x0000,
+	    0x0000, 0x227e, 0x0000, 0x1dd1, 0x0000, 0x0000, 0x4a1e, 0x0000,
+	    0x0000, 0x357c, 0x0000, 0x3dac, 0x0000, 0x0000, 0x0000, 0x3db4,
+	    0x0000, 0x30a4, 0x0000, 0x0000, 0x0000, 0x0389, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0a9d, 0x0425, 0x0000, 0x181a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ea6, 0x024e, 0x0000, 0x471f, 0x0000, 0x1ccb,
+	    0x0000, 0x0898, 0x0df3, 0x4398, 0x134c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4a16, 0x0000, 0x09a0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3cf1, 0x0000, 0x0000, 0x2155, 0x310a, 0x0000, 0x0000,
+	    0x0f8f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c88, 0x0000,
+	    0x0000, 0x0000, 0x0224, 0x0000, 0x4d1b, 0x0000, 0x0000, 0x42f4,
+	    0x00df, 0x1fbc, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c50, 0x0000,
+	    0x0000, 0x1d8b, 0x0000, 0x0000, 0x3e37, 0x2472, 0x0000, 0x1cef,
+	    0x0000, 0x1ed0, 0x1e5e, 0x2bcc, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x41aa, 0x0000, 0x0000, 0x0000, 0x43ae, 0x0000, 0x1e9f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23f4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x267c, 0x4b84, 0x0000, 0x0000, 0x1995,
+	    0x0000, 0x0000, 0x0000, 0x0bdc, 0x2bc0, 0x0000, 0x0000, 0x3b2d,
+	    0x0000, 0x0000, 0x4553, 0x05a4, 0x1147, 0x0bea, 0x0000, 0x0000,
+	    0x103a, 0x1bfe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b5b,
+	    0x0000, 0x0000, 0x4404, 0x16a1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x099d, 0x2f27, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x307f, 0x2068, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e4d, 0x47de,
+	    0x0000, 0x4d50, 0x0000, 0x1b64, 0x0000, 0x0639, 0x0000, 0x46d7,
+	    0x37fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x17a4, 0x0000,
+	    0x0000, 0x2a9c, 0x0000, 0x0000, 0x0000, 0x2678, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1159, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x33af, 0x3c17, 0x0000, 0x44a1,
+	    0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x099d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e64, 0x1de9, 0x096c, 0x0000,
+	    0x0000, 0x0000, 0x1bc4, 0x0000, 0x0000, 0x0000, 0x2e3a, 0x0eca,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2ce0, 0x0000,
+	    0x0000, 0x1216, 0x03e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3a59, 0x0000, 0x08d0, 0x3e16, 0x0000, 0x3e56,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3be4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1ab1, 0x0000, 0x3883, 0x0b03, 0x3739,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e57, 0x0000,
+	    0x0673, 0x0000, 0x0000, 0x2517, 0x0000, 0x0000, 0x3c48, 0x2526,
+	    0x0e96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1aee,
+	    0x3814, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3700, 0x279d, 0x3efd, 0x42ad, 0x19b9,
+	    0x0000, 0x0000, 0x0000, 0x2c77, 0x0000, 0x0000, 0x19c2, 0x0000,
+	    0x0000, 0x191a, 0x0000, 0x483c, 0x0000, 0x0000, 0x0000, 0x3ae5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x447c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f5c,
+	    0x0000, 0x0000, 0x36f5, 0x1b53, 0x0000, 0x0000, 0x1313, 0x4d0b,
+	    0x10a9, 0x3b7d, 0x0000, 0x12aa, 0x0000, 0x0000, 0x0000, 0x2877,
+	    0x0000, 0x0000, 0x0000, 0x1b5f, 0x2bf6, 0x3b9f, 0x0000, 0x0ee5,
+	    0x3408, 0x0000, 0x0397, 0x0dff, 0x0000, 0x0000, 0x4b4c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2586, 0x1b01, 0x0397, 0x0000,
+	    0x0e52, 0x0000, 0x0000, 0x23fc, 0x0000, 0x0000, 0x2f4d, 0x3867,
+	    0x0000, 0x0432, 0x1f7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x4527,
+	    0x0000, 0x46d1, 0x0b7e, 0x0000, 0x3c08, 0x0000, 0x0000, 0x0000,
+	    0x1a81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x208f, 0x2420,
+	    0x2f5f, 0x0000, 0x0000, 0x0d2e, 0x0000, 0x473d, 0x0000, 0x1b54,
+	    0x0000, 0x0000, 0x22ff, 0x207e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x34ac, 0x0000, 0x0000, 0x0000, 0x4d9e, 0x0000, 0x0000,
+	    0x42e7, 0x23ff, 0x0000, 0x355c, 0x38b4, 0x0000, 0x0000, 0x42cb,
+	    0x0000, 0x1797, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c0,
+	    0x1eef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x083f, 0x0000, 0x1bc1, 0x0000, 0x0000, 0x04ca,
+	    0x4723, 0x0000, 0x0000, 0x0000, 0x2703, 0x0000, 0x3b87, 0x4c32,
+	    0x0000, 0x0000, 0x0000, 0x13f5, 0x0023, 0x0000, 0x0000, 0x14d6,
+	    0x12e2, 0x20b9, 0x372a, 0x0000, 0x2869, 0x0000, 0x0000, 0x381b,
+	    0x1e05, 0x0000, 0x3cd5, 0x0338, 0x010d, 0x0000, 0x0000, 0x0945,
+	    0x46d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0228, 0x155a, 0x1795, 0x0000, 0x0f08, 0x3ea3, 0x0000, 0x24ce,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1930, 0x0000, 0x0000, 0x0000,
+	    0x4858, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ce2, 0x0000, 0x0000,
+	    0x2d06, 0x1252, 0x3591, 0x0000, 0x0000, 0x0000, 0x46ef, 0x4a8f,
+	    0x11ae, 0x0000, 0x0000, 0x1c27, 0x0be4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x28aa, 0x0000, 0x2163, 0x49af, 0x3a4a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x03a9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01d1, 0x0ab2, 0x0000, 0x0000, 0x4540, 0x0000, 0x0000, 0x0000,
+	    0x1622, 0x3abd, 0x0000, 0x0000, 0x0000, 0x16ae, 0x0000, 0x10d5,
+	    0x0f7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x32ea, 0x0000, 0x0000, 0x0000, 0x0408, 0x1cd3, 0x3013, 0x0000,
+	    0x2c38, 0x0000, 0x0000, 0x4579, 0x3466, 0x0a07, 0x0000, 0x0000,
+	    0x4ace, 0x0000, 0x0000, 0x2e16, 0x0000, 0x0000, 0x0000, 0x14aa,
+	    0x0000, 0x0000, 0x0915, 0x4443, 0x0000, 0x46f5, 0x0000, 0x0000,
+	    0x124c, 0x0000, 0x0000, 0x0000, 0x1c22, 0x0000, 0x0000, 0x3c6b,
+	    0x0000, 0x3347, 0x0000, 0x0000, 0x13b6, 0x0000, 0x1888, 0x0000,
+	    0x0000, 0x0000, 0x07d3, 0x0000, 0x0000, 0x0000, 0x0000, 0x296f,
+	    0x0000, 0x4875, 0x0000, 0x4adf, 0x2f4b, 0x0000, 0x45cf, 0x0000,
+	    0x0000, 0x0000, 0x3664, 0x0000, 0x0eff, 0x0000, 0x0000, 0x0000,
+	    0x1b09, 0x0000, 0x0000, 0x0000, 0x480c, 0x0000, 0x2874, 0x0000,
+	    0x39dd, 0x0000, 0x0000, 0x1d68, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2801, 0x1a1f, 0x0000, 0x0000, 0x0000, 0x0000, 0x292d, 0x0000,
+	    0x25dc, 0x21d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x3988, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0738, 0x0000,
+	    0x027e, 0x0000, 0x0000, 0x4c62, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1b97, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0607, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22c1, 0x43e1,
+	    0x48cd, 0x0a70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x105a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1bc4, 0x0000, 0x0000,
+	    0x484a, 0x49a9, 0x3242, 0x0000, 0x17e7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1653, 0x3e0f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1b00, 0x0000, 0x2ffd, 0x3f84, 0x3211, 0x0000,
+	    0x0afe,
+};
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	uint16_t result;
+	const uint16_t *g = hash_g;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x63f37e85), (uint32_t *)h);
+
+	h[0] = h[0] % 40001;
+	h[1] = h[1] % 40001;
+	result = (g[h[0]] + g[h[1]]) % 20000;
+	return hash_keycmp(result, key, keylen) ? result : (uint16_t)-1;
+}
+
+void
+hash_prefetch(const void * __restrict key, size_t keylen)
+{
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x63f37e85), (uint32_t *)h);
+
+	h[0] = h[0] % 40001;
+	h[1] = h[1] % 40001;
+	__builtin_prefetch(&hash_g[h[0]]);
+	__builtin_prefetch(&hash_g[h[1]]);
+}
+
+void
+hash_batch(const void * __restrict const *keys, const size_t *keylens,
+	uint32_t *out, size_t n)
+{
+	const uint16_t *g = hash_g;
+	uint16_t hb[8][2];
+
+	for (size_t s = 0; s < n; s += 8) {
+		const size_t nb = n - s < 8 ? n - s : 8;
+		for (size_t j = 0; j < nb; j++) {
+			const void *key = keys[s + j];
+			const size_t keylen = keylens[s + j];
+			uint16_t h[6];
+
+			mi_vector_hash(key, keylen, UINT32_C(0x63f37e85), (uint32_t *)h);
+
+			h[0] = h[0] % 40001;
+			h[1] = h[1] % 40001;
+			hb[j][0] = h[0];
+			__builtin_prefetch(&g[h[0]]);
+			hb[j][1] = h[1];
+			__builtin_prefetch(&g[h[1]]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint16_t *h = hb[j];
+			uint16_t result = (g[h[0]] + g[h[1]]) % 20000;
+			out[s + j] = hash_keycmp(result, keys[s + j], keylens[s + j])
+			    ? result : (uint32_t)-1;
+		}
+	}
+}
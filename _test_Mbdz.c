@@ -0,0 +1,360 @@
+/* generated with rurban/nbperf 08a5797  _words */
+/* seed[0]: 1726956429, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint64_t g[888] NBPERF_ALIGN64 = {
+		UINT64_C(0x9f6d350000000000), UINT64_C(0x1d4b103492ea82b8), UINT64_C(0x2b8666a282b97d2f),
+		UINT64_C(0x6429698105b934d2), UINT64_C(0x131da41bf964a019), UINT64_C(0x65018e94e54d225a),
+		UINT64_C(0x4bb3d7ed187c4723), UINT64_C(0xd86ef4acbdaca015), UINT64_C(0xa06b3400000000b7),
+		UINT64_C(0x4353f865c88b10d3), UINT64_C(0x550b2801b05e6507), UINT64_C(0xac0152428c742d1c),
+		UINT64_C(0x6774985f4511a141), UINT64_C(0x61b85b6738011d41), UINT64_C(0x34630949af8e8963),
+		UINT64_C(0x04a08b4489d7256a), UINT64_C(0x9f6f360000000174), UINT64_C(0x208d94d39ea38766),
+		UINT64_C(0x5734e60a9c081955), UINT64_C(0xe2664802151af5a4), UINT64_C(0x3806ab70b6850924),
+		UINT64_C(0xfdaa301b9a4b1c95), UINT64_C(0x1f0a7a1fab3988ee), UINT64_C(0x2a3398c76c931104),
+		UINT64_C(0xa46833000000022d), UINT64_C(0x34992bc288c786b5), UINT64_C(0xd9f32979c16a961e),
+		UINT64_C(0xe4cb29101149d801), UINT64_C(0xc67301615ccec050), UINT64_C(0x2611686245652990),
+		UINT64_C(0x228a867ee28a69e0), UINT64_C(0x332aa4a82010acc8), UINT64_C(0x97643400000002ed),
+		UINT64_C(0xc0437a3259bbd452), UINT64_C(0x17a6303e884d4096), UINT64_C(0xfba26fb54f9299ff),
+		UINT64_C(0x51802ce9d3952059), UINT64_C(0x56ddba47a8f1a617), UINT64_C(0x456ae7367500e796),
+		UINT64_C(0x66c6928144ae268b), UINT64_C(0xa9703800000003a1), UINT64_C(0x6a0400da236492e9),
+		UINT64_C(0x74e4b68a519b8e41), UINT64_C(0x0a2ad4b0ce8ee290), UINT64_C(0x9029515542de9409),
+		UINT64_C(0x0290525840a955ab), UINT64_C(0xc747029da34e4a08), UINT64_C(0x000a3edde4eb2167),
+		UINT64_C(0xa46f390000000462), UINT64_C(0x46ac1418fd5806aa), UINT64_C(0x40861481fa108031),
+		UINT64_C(0x0b5ef84432604201), UINT64_C(0x2e0630a57d100c50), UINT64_C(0xbd9f8d96ba3948d5),
+		UINT64_C(0x8a28a5818a0a5f9c), UINT64_C(0xec737ae36f96520c), UINT64_C(0xa37035000000051c),
+		UINT64_C(0xe4a7f6e292808e59), UINT64_C(0x061c34224855cb72), UINT64_C(0x46a7604ab1a05d20),
+		UINT64_C(0x14268a114966ace2), UINT64_C(0xcc34f406c8b9c250), UINT64_C(0x8bc358194d871959),
+		UINT64_C(0x43186422300977c2), UINT64_C(0x9f673500000005da), UINT64_C(0x7a681a9639150d6e),
+		UINT64_C(0x9b83e4c70e908831), UINT64_C(0xa6c477fc42bea15b), UINT64_C(0x3a6c7ea54568088d),
+		UINT64_C(0x312941aa10c85966), UINT64_C(0x595a778daea1d8e1), UINT64_C(0xfad23738d49e033a),
+		UINT64_C(0xa26633000000068f), UINT64_C(0x02b6cbde2004ee8e), UINT64_C(0x62346d6c6db51121),
+		UINT64_C(0x320b4528100485dc), UINT64_C(0x86a035ecb9d6ee3b), UINT64_C(0x8024981a9ea69644),
+		UINT64_C(0x0091d5894009d22c), UINT64_C(0x1705730d6a2a3099), UINT64_C(0x9d6936000000074c),
+		UINT64_C(0xaf30c19ba10bd119), UINT64_C(0x1f016a2630298666), UINT64_C(0x043fe5c2a58c4d98),
+		UINT64_C(0xd857724af1c64911), UINT64_C(0x3471053938149abd), UINT64_C(0xa7664978900c7cd8),
+		UINT64_C(0x066a639c22260994), UINT64_C(0xa36c340000000807), UINT64_C(0x0a81e3124c6e8898),
+		UINT64_C(0x8fae1004911dcbbb), UINT64_C(0x65396aa9aea52d95), UINT64_C(0x0f2a405416120f67),
+		UINT64_C(0x4497bba508d46821), UINT64_C(0x60d2a31aace01187), UINT64_C(0xc9f44b2804095cbc),
+		UINT64_C(0xa1683300000008c3), UINT64_C(0xd69af2884aad3d06), UINT64_C(0xdb1311c99ba6c11c),
+		UINT64_C(0x760ed19b198bc719), UINT64_C(0x85cd514090e6951e), UINT64_C(0x850550c98827a355),
+		UINT64_C(0x308a9893b85534a5), UINT64_C(0xa5543e549db8ba39), UINT64_C(0x9c6a32000000097e),
+		UINT64_C(0xcbe60c483387d98f), UINT64_C(0xf204d92852862c92), UINT64_C(0x0d99a9ba7605290c),
+		UINT64_C(0x01660a5d59b4eb44), UINT64_C(0xefe0d8630b04d116), UINT64_C(0xa9c3005b912e670b),
+		UINT64_C(0x192a98a5a64f432a), UINT64_C(0x9f672f0000000a37), UINT64_C(0x2a5d84d7cd715ab5),
+		UINT64_C(0x420cea252eecc2ff), UINT64_C(0x00db620064c6324a), UINT64_C(0x90db617622656398),
+		UINT64_C(0x185c9a70f6928512), UINT64_C(0x836918309f58a294), UINT64_C(0x4471299d07aeaf3d),
+		UINT64_C(0x9f6c380000000aee), UINT64_C(0x45da83a9414c9082), UINT64_C(0x25f13686e10246e9),
+		UINT64_C(0x26a635c78f448882), UINT64_C(0xcebb94e8aa39828c), UINT64_C(0xd4430bb28dea0eec),
+		UINT64_C(0x928e3291629b95ca), UINT64_C(0x6e9f64292ec285d7), UINT64_C(0xa56a370000000ba6),
+		UINT64_C(0xa41da0524de0a560), UINT64_C(0x3b91aa30ba064797), UINT64_C(0x46338f84f5256f18),
+		UINT64_C(0x8b9ee664938969c5), UINT64_C(0x18a2517696293a84), UINT64_C(0x0295afa02086a8b1),
+		UINT64_C(0x201845d94a9e8752), UINT64_C(0x9d6a340000000c68), UINT64_C(0x6422275128d81c78),
+		UINT64_C(0xbd365f0f18242b12), UINT64_C(0x3e642b25a9247763), UINT64_C(0x482286c2349c80e9),
+		UINT64_C(0x48a92b11a4cce3a0), UINT64_C(0xe05196f4f30c124d), UINT64_C(0xcc856cacec14e92e),
+		UINT64_C(0xa06b380000000d1d), UINT64_C(0x62064964c3119613), UINT64_C(0xdaa32a78196921dd),
+		UINT64_C(0x995cc18bc609d499), UINT64_C(0xa3168f365c74d2e6), UINT64_C(0xa83b5485faac972d),
+		UINT64_C(0xa80106934640caed), UINT64_C(0xa512626739b6022c), UINT64_C(0xa36b340000000dd9),
+		UINT64_C(0x2553254c5b5e4215), UINT64_C(0x96f15ccc683e82e2), UINT64_C(0x1179b212d48ad1fa),
+		UINT64_C(0x97990264e929d941), UINT64_C(0xd812201c6968a06f), UINT64_C(0x320445a22e1d0d46),
+		UINT64_C(0x659da2819314a652), UINT64_C(0xa36c360000000e9a), UINT64_C(0x8952fc2839fa5891),
+		UINT64_C(0x844c4362b822a2c4), UINT64_C(0x8227a4856658b88c), UINT64_C(0xd508c6a50cf75867),
+		UINT64_C(0x0ad8808e69f64d69), UINT64_C(0xec70a2171891501a), UINT64_C(0x38fcb7514284ea68),
+		UINT64_C(0xa471370000000f56), UINT64_C(0xd4a1ed8a4b112970), UINT64_C(0x429416ac48766d17),
+		UINT64_C(0x6a4540a6535a2b5d), UINT64_C(0x7d2a6e6208410011), UINT64_C(0x75144b6350a1193c),
+		UINT64_C(0xcd6ba4f0b6228d78), UINT64_C(0x818260726d94e850), UINT64_C(0xa56f340000001017),
+		UINT64_C(0x4c2e068d88cb1940), UINT64_C(0xb84f1e04453a0b07), UINT64_C(0xa905e06484285b34),
+		UINT64_C(0x1118361199c95202), UINT64_C(0x4352e912c4c82084), UINT64_C(0x26614c06337da64b),
+		UINT64_C(0x54616e2197a85076), UINT64_C(0x96602d00000010d9), UINT64_C(0x389f7c6067c2fd9e),
+		UINT64_C(0x6a26f64e8dfb62ab), UINT64_C(0x45b7173841d1a962), UINT64_C(0x80a8d6cc5dbbf528),
+		UINT64_C(0x15aa8bc821f10175), UINT64_C(0x0b872292f8e48180), UINT64_C(0xa210895e1e06dc6d),
+		UINT64_C(0x91642f000000118a), UINT64_C(0xb0cd566e273d1280), UINT64_C(0x1de9fc974fa5b8c5),
+		UINT64_C(0x598c6e0621681e40), UINT64_C(0x3d00ddcd2a5c2439), UINT64_C(0xdb4403c37938ea2f),
+		UINT64_C(0xf35531e1e6b124be), UINT64_C(0x251259087f154b95), UINT64_C(0xa46e370000001237),
+		UINT64_C(0x8381015314530853), UINT64_C(0xba1894402057313e), UINT64_C(0x424ad04881455923),
+		UINT64_C(0x43e7a345692a3c47), UINT64_C(0x5f185c8b91245131), UINT64_C(0x7b4d0969b150b180),
+		UINT64_C(0x2f5f1caae45c5981), UINT64_C(0xa16a3400000012f4), UINT64_C(0xf749548fa6843880),
+		UINT64_C(0x62e7bc0c78154850), UINT64_C(0xd1115a11fc0d8674), UINT64_C(0x6247366908491bc2),
+		UINT64_C(0x02e8781889da8651), UINT64_C(0x96a87cbd9e174680), UINT64_C(0x1a41d2366310833e),
+		UINT64_C(0x9e683200000013af), UINT64_C(0x125306ed1c27711e), UINT64_C(0x09c893b39a0e8e4c),
+		UINT64_C(0xea280681be220fad), UINT64_C(0x1414145502a6cddd), UINT64_C(0xeb908647716e10ec),
+		UINT64_C(0x7292629c5160957a), UINT64_C(0x7c180c1ca89da84a), UINT64_C(0xa8733c0000001468),
+		UINT64_C(0x641092a31e808ca3), UINT64_C(0xa6811a1515482162), UINT64_C(0xb1d52aba21a22aca),
+		UINT64_C(0x9b06b54617b44557), UINT64_C(0x8220a21ca162d75a), UINT64_C(0xd10750780ac7f8da),
+		UINT64_C(0x079f7b38d2ae4368), UINT64_C(0x905f2f0000001527), UINT64_C(0xb05f31bc43a5606e),
+		UINT64_C(0x6742fddb0db9c295), UINT64_C(0xcd09f91d36f65de4), UINT64_C(0x8db0948c5a5b2e31),
+		UINT64_C(0x05e192d2a2f353f3), UINT64_C(0x3c66e4ba51c09355), UINT64_C(0x3543b0000131705e),
+		UINT64_C(0x96623500000015d1), UINT64_C(0x166d644915e91b6e), UINT64_C(0xc28c467acdc0559c),
+		UINT64_C(0xa3979c37de8bef2c), UINT64_C(0x9bb571a432bae175), UINT64_C(0x69e1225f298f5763),
+		UINT64_C(0x202c303a14a53c61), UINT64_C(0x6536fdb47842ce56), UINT64_C(0xa7743c000000167f),
+		UINT64_C(0xa6586495a000a274), UINT64_C(0x002927961483c615), UINT64_C(0x72ea464d1aae12b9),
+		UINT64_C(0x10b5293968415321), UINT64_C(0x2db9466d22242ead), UINT64_C(0xc7b610ee445ebab4),
+		UINT64_C(0x2e184a1f729332d5), UINT64_C(0xa86e37000000173f), UINT64_C(0x78553c72d32c6660),
+		UINT64_C(0x1a006315184104d1), UINT64_C(0x68b699b187a099af), UINT64_C(0xc89293a15a0ed095),
+		UINT64_C(0x6d998105001ab582), UINT64_C(0xa91b1909c828acc8), UINT64_C(0x22f33d3a62968114),
+		UINT64_C(0x9864300000001801), UINT64_C(0x5e9218b43c7ff71d), UINT64_C(0x2e65f3214ba68469),
+		UINT64_C(0x55c89fe0716a908c), UINT64_C(0x527131ed57ad511a), UINT64_C(0xba43769ba5579543),
+		UINT64_C(0x1b212f5a01f66a70), UINT64_C(0xc31e961e4905a249), UINT64_C(0xa06b3300000018b5),
+		UINT64_C(0xa8f19854372da670), UINT64_C(0xed02268c2e07f611), UINT64_C(0x340196a9a4ccea78),
+		UINT64_C(0x9e8aa108c4823965), UINT64_C(0x1f5c2c104456d007), UINT64_C(0x520c50327326a467),
+		UINT64_C(0x2667443709012ac5), UINT64_C(0x9e6b340000001971), UINT64_C(0x6867c8270bc146b1),
+		UINT64_C(0x5d434381a2c91b0d), UINT64_C(0xe849f155a9a9b08b), UINT64_C(0xe9f280285160a172),
+		UINT64_C(0xd2166a92f715191b), UINT64_C(0x8fe8e2dca67e1204), UINT64_C(0x98f004031455a184),
+		UINT64_C(0x996a330000001a2c), UINT64_C(0x03b6a828161fe747), UINT64_C(0x3293148c423de91a),
+		UINT64_C(0x35213101dbb858e3), UINT64_C(0x16a861a41a43ca20), UINT64_C(0xb15cc89c143ab037),
+		UINT64_C(0x6e838ef55fa6dc14), UINT64_C(0x62810ca468524b09), UINT64_C(0x9a61320000001ae3),
+		UINT64_C(0x6702e2b460443f35), UINT64_C(0x32fed79568558979), UINT64_C(0x76e2b712c1c4c453),
+		UINT64_C(0x1b15801f8cfc3927), UINT64_C(0x85c836d945dde288), UINT64_C(0xa95600956504d594),
+		UINT64_C(0x44250aea1b987241), UINT64_C(0xa66f370000001b9a), UINT64_C(0x69484519d5dc4c19),
+		UINT64_C(0x6b1c91939c159676), UINT64_C(0xf022221e6618a1f6), UINT64_C(0x2ade81662534a206),
+		UINT64_C(0x51e546b251003d5b), UINT64_C(0x488de58c121a446b), UINT64_C(0x1e650a6d2b21511c),
+		UINT64_C(0x9d64340000001c5c), UINT64_C(0x64b28ba60d4840bc), UINT64_C(0xee9c69a03389c447),
+		UINT64_C(0x6942517d2931f12f), UINT64_C(0x19c2fdf02d5840c3), UINT64_C(0x510045d608730ae9),
+		UINT64_C(0x19d11c00d6299954), UINT64_C(0x366a4d34f0a06c29), UINT64_C(0xad74370000001d13),
+		UINT64_C(0x6d099f54f8ab8116), UINT64_C(0x9824ed0a40466174), UINT64_C(0x0415d4aaa8a88224),
+		UINT64_C(0x96281a4203aa0714), UINT64_C(0xaaa2a64c0d808c6c), UINT64_C(0x2a507459d5654d69),
+		UINT64_C(0xae9400c0dd63c380), UINT64_C(0xa16c350000001dd9), UINT64_C(0x979c12ae9aabc80c),
+		UINT64_C(0x3f250d219b52a628), UINT64_C(0xcc17a888c4325392), UINT64_C(0x9f9061667a245660),
+		UINT64_C(0x2b6c059633f28e92), UINT64_C(0x915656439805de6e), UINT64_C(0x3d09e5ae61217c06),
+		UINT64_C(0xa16d360000001e94), UINT64_C(0x5998b6632872d3a9), UINT64_C(0x44941db084af6b14),
+		UINT64_C(0x99a83e32527b1b7a), UINT64_C(0x92a8150b1a067014), UINT64_C(0x413caa8163a73301),
+		UINT64_C(0x6b0b0b928f257869), UINT64_C(0x8769129a081d884a), UINT64_C(0x9d67380000001f53),
+		UINT64_C(0x1402741321107010), UINT64_C(0x0b33b885e4862a1a), UINT64_C(0x073f831e72ea430d),
+		UINT64_C(0x494b3da2fe301688), UINT64_C(0x160bd02278daa6cd), UINT64_C(0x410082ca8c69d760),
+		UINT64_C(0x9528a49ec04cc9b9), UINT64_C(0xa87234000000200b), UINT64_C(0x131ef659c0ab04b2),
+		UINT64_C(0xa892714a71d3966b), UINT64_C(0x4604882002114123), UINT64_C(0x84a8502c426aa602),
+		UINT64_C(0x7d59d845a78a24c6), UINT64_C(0xe9e2a5264ee1860c), UINT64_C(0x2390351ba692e302),
+		UINT64_C(0xa36c3600000020ce), UINT64_C(0x1355a5da9553429a), UINT64_C(0x7007e6ca8b448ca3),
+		UINT64_C(0x4d982588f57ba042), UINT64_C(0x4596122f082ea39c), UINT64_C(0x618aa06c26ed0801),
+		UINT64_C(0xee9048802e64e8cd), UINT64_C(0x9af4bd7a0458c29b), UINT64_C(0xa86f36000000218a),
+		UINT64_C(0xb42bb06565e2762b), UINT64_C(0x7490caa00985c710), UINT64_C(0x558f52b964ead480),
+		UINT64_C(0x1c26149695402031), UINT64_C(0x79118758a1289e66), UINT64_C(0x2dd9b541d22256a2),
+		UINT64_C(0xac216b67280809a3), UINT64_C(0xa57339000000224e), UINT64_C(0x1758eb242458e944),
+		UINT64_C(0x4caeaab885aa5061), UINT64_C(0xc049055a58455879), UINT64_C(0x0411861ba028ae0f),
+		UINT64_C(0x70358d44c124cae6), UINT64_C(0xb8f73180ca2d9517), UINT64_C(0x422eae8585854097),
+		UINT64_C(0x9e68320000002310), UINT64_C(0x390de62ed2e7b416), UINT64_C(0x1ed46bb44c3a8506),
+		UINT64_C(0x5d6a54652f390b2e), UINT64_C(0x65a3a8e1496bc501), UINT64_C(0x47489aa18aae291c),
+		UINT64_C(0x7520dbc6554332e2), UINT64_C(0x781b8a950ba864ae), UINT64_C(0x99643100000023ca),
+		UINT64_C(0x58f05158245ecead), UINT64_C(0x9c75674663581ffe), UINT64_C(0x2d8741b59ac94516),
+		UINT64_C(0x00665e7c8fef49c6), UINT64_C(0x993991a1a0590c2b), UINT64_C(0xd99b9a755fb348c9),
+		UINT64_C(0x5e53888537a5089c), UINT64_C(0x9c6935000000247e), UINT64_C(0xe9ce7744b56d6942),
+		UINT64_C(0x282066a03612076f), UINT64_C(0x05e57273625cac00), UINT64_C(0xb1e614d7ab5815b8),
+		UINT64_C(0x463ac190481ffc28), UINT64_C(0x9c11c88af6d621d9), UINT64_C(0xb01e20126b048810),
+		UINT64_C(0xa16d370000002537), UINT64_C(0x9ea64825c6027446), UINT64_C(0xc961a3549e4ee95d),
+		UINT64_C(0x873c3a28be914a5c), UINT64_C(0x81a000045cf92911), UINT64_C(0xf27eaac4813562b8),
+		UINT64_C(0x961981680dd6139f), UINT64_C(0x855279648cb40262), UINT64_C(0xaa733800000025f5),
+		UINT64_C(0xc62674a200a00b28), UINT64_C(0x63db5991aa8561cc), UINT64_C(0x1516b6a542a628e4),
+		UINT64_C(0x67560230b4229080), UINT64_C(0xda3aa1950411b899), UINT64_C(0xc6298d0be399452d),
+		UINT64_C(0x6770213de2d00162), UINT64_C(0x9e6b3500000026b9), UINT64_C(0x52100a489e60e6bd),
+		UINT64_C(0x210c29eeef816e96), UINT64_C(0x3507c0a5c2415b66), UINT64_C(0x42c464bb984149e3),
+		UINT64_C(0xdc4fe93044dec829), UINT64_C(0x8523aad8469813ca), UINT64_C(0x29119d7137848279),
+		UINT64_C(0xa36e390000002772), UINT64_C(0x96491668994691f7), UINT64_C(0x5c944022f9453024),
+		UINT64_C(0xb85e864850b0d4b1), UINT64_C(0x0a309bf9da275a89), UINT64_C(0x2ed6300142239d38),
+		UINT64_C(0x6c84a31f0b481842), UINT64_C(0xd91a9dab1fe7959b), UINT64_C(0x9f6b38000000282d),
+		UINT64_C(0x2a02cda6718b1022), UINT64_C(0x43926aea8e685031), UINT64_C(0x282441df9c1edc7a),
+		UINT64_C(0x1e09cc19893411d6), UINT64_C(0x35926518b5d443b5), UINT64_C(0xa7cb0d139474985b),
+		UINT64_C(0xa9a750bec8393cd5), UINT64_C(0x9a643500000028e4), UINT64_C(0x148182e7f4a60b2d),
+		UINT64_C(0x2d4c59852c06ac76), UINT64_C(0x04baeca152b8dab6), UINT64_C(0x2b8a03ad5cc3d3ef),
+		UINT64_C(0x68228db45929a83d), UINT64_C(0x0458d0f6087ec808), UINT64_C(0xe1887ad796069978),
+		UINT64_C(0xa56c370000002999), UINT64_C(0x26a02aec519ad116), UINT64_C(0x28979aab27586773),
+		UINT64_C(0x5a8525707a595843), UINT64_C(0x47cd9819525377db), UINT64_C(0x2585ca8d872ad891),
+		UINT64_C(0x1a6517a0a11a348e), UINT64_C(0x1a718ae2c9864ea2), UINT64_C(0x9f6a360000002a5a),
+		UINT64_C(0x91a5a2416974fdaa), UINT64_C(0xa38477407f418561), UINT64_C(0xeeb06c03cf58b42b),
+		UINT64_C(0x1a741e521528992a), UINT64_C(0x4494b7864a6b1756), UINT64_C(0xd07ead10c2b5560c),
+		UINT64_C(0x04998848a8840087), UINT64_C(0xa46e380000002b18), UINT64_C(0xa489548605412fa8),
+		UINT64_C(0x70e93941d4b06c69), UINT64_C(0xc836ea0250dc2931), UINT64_C(0x4472126352dd55a4),
+		UINT64_C(0xd28a3d907c094904), UINT64_C(0x0ed5d02ca2248d46), UINT64_C(0x695c7e7a146a4813),
+		UINT64_C(0x9c6a360000002bd7), UINT64_C(0x2955c7020c849de9), UINT64_C(0x882ad3f5e2956592),
+		UINT64_C(0x94884c9500af32a7), UINT64_C(0x160cf2264bacba74), UINT64_C(0x4c55abb023191d63),
+		UINT64_C(0xcc8893a4700dcf41), UINT64_C(0x4d61799672b02251), UINT64_C(0xa46d380000002c8f),
+		UINT64_C(0xaba6ea9702f20265), UINT64_C(0xa9126360e18c2a65), UINT64_C(0xa4409cc0bca378c3),
+		UINT64_C(0x8156d2b601e90659), UINT64_C(0x24d7a8c979a70684), UINT64_C(0x55560469cc27661e),
+		UINT64_C(0x1cc9a10e2401599a), UINT64_C(0xa36c350000002d50), UINT64_C(0x224ad58b1f20f2da),
+		UINT64_C(0xa484401e93cab195), UINT64_C(0x386a3282536149a4), UINT64_C(0x521094557cee270e),
+		UINT64_C(0x046a269c5631ea9a), UINT64_C(0xb26064737e200c10), UINT64_C(0xcac5ba001ab7ca47),
+		UINT64_C(0x9e67330000002e0c), UINT64_C(0xa3c0a40bd971bd0d), UINT64_C(0xe501ada1a528c47b),
+		UINT64_C(0x70044c4aba0a5f22), UINT64_C(0x7355e6d61e96da0e), UINT64_C(0x0155a500c440a411),
+		UINT64_C(0xff10316445083c74), UINT64_C(0xa240c4c88c7cf402), UINT64_C(0xad73350000002ec3),
+		UINT64_C(0x096781d02892174b), UINT64_C(0x92f3f0092b61b102), UINT64_C(0x64018296405609a2),
+		UINT64_C(0x21214ec810195161), UINT64_C(0x8044600421221015), UINT64_C(0xb4c5b2c2a5814cd6),
+		UINT64_C(0x6f05701a66ac0851), UINT64_C(0x955e310000002f8c), UINT64_C(0x041caf7740bc0d9e),
+		UINT64_C(0xe81e03434ec2a610), UINT64_C(0x022f8621d38c30cb), UINT64_C(0x7138e0eccec79abd),
+		UINT64_C(0x84a06ed81429f84f), UINT64_C(0x161479896a42ba67), UINT64_C(0x02f1e28fa3a90541),
+		UINT64_C(0x945f31000000303b), UINT64_C(0xdeed5aea9f5b611e), UINT64_C(0x612c91da32f165d1),
+		UINT64_C(0x30366b47366dd6b6), UINT64_C(0xd2dd09375ec6d70c), UINT64_C(0x72722749ad8b460e),
+		UINT64_C(0x653574f286b090a1), UINT64_C(0x63f76928b7885750), UINT64_C(0x96653800000030e8),
+		UINT64_C(0x60a7c9ec6b4681a9), UINT64_C(0x290229ca13324aa8), UINT64_C(0xd28caf79bcc57aa9),
+		UINT64_C(0x176421ddede3ee3a), UINT64_C(0xc2300a0d35187ddb), UINT64_C(0xee258ec1d8adb408),
+		UINT64_C(0x25b3888a71a92a51), UINT64_C(0x9d652b000000319b), UINT64_C(0x37eab7633b06f6ff),
+		UINT64_C(0x031097cf30910d24), UINT64_C(0x9488e40da814af0a), UINT64_C(0x90794257a40885aa),
+		UINT64_C(0xd555600849024105), UINT64_C(0x169bad3e1c8af619), UINT64_C(0x331ea22224e6b859),
+		UINT64_C(0xa76f350000003253), UINT64_C(0x43e02a512280d0a1), UINT64_C(0x8b02bc16ac86eb4f),
+		UINT64_C(0xb35c5fa524625218), UINT64_C(0x28e6114162920945), UINT64_C(0x42b12ba1156c643b),
+		UINT64_C(0x559860ad925531a3), UINT64_C(0xb12800408294a9e6), UINT64_C(0x9c67310000003318),
+		UINT64_C(0x176721d9e71cee52), UINT64_C(0x69b91676301f765c), UINT64_C(0x75606f48059f3e57),
+		UINT64_C(0xb8c180020a602204), UINT64_C(0x1064424c4497723f), UINT64_C(0xa6a164831413ab2f),
+		UINT64_C(0x492201b2eaeca7f3), UINT64_C(0x96633500000033cc), UINT64_C(0x232d6c49571da528),
+		UINT64_C(0x29b40bd1254b3163), UINT64_C(0xe3cb5d9af59282df), UINT64_C(0x97cacb2abc2d36aa),
+		UINT64_C(0xa36e556917c15e53), UINT64_C(0x763d5af386910670), UINT64_C(0x4238e80126ca067f),
+		UINT64_C(0x925e2d000000347c), UINT64_C(0x3eb63ef1f492fefd), UINT64_C(0xdb88163a474511a6),
+		UINT64_C(0xe07131270577d293), UINT64_C(0x3aae6177ade89474), UINT64_C(0xb00030b84b7398c4),
+		UINT64_C(0xba86aa0f891189be), UINT64_C(0x7066ae11b47685fd), UINT64_C(0x8a582e0000003527),
+		UINT64_C(0x2679a4f694f0d1d4), UINT64_C(0x082cf975fee95fc1), UINT64_C(0x7e233795c99a0354),
+		UINT64_C(0xd1dcd7d4f9ff383e), UINT64_C(0x69fa964285a002ab), UINT64_C(0xd8ef13acd4cd43c8),
+		UINT64_C(0x06a8243a46aa8c61), UINT64_C(0x945f3400000035cf), UINT64_C(0x2b2096e60e51ba8f),
+		UINT64_C(0x9610c5e4ab66530f), UINT64_C(0x3ff104736afc912d), UINT64_C(0x38cc0ac3db0989df),
+		UINT64_C(0x221374ca96493522), UINT64_C(0x8550ad326cf43a2b), UINT64_C(0x33877d55159c7c53),
+		UINT64_C(0x935f32000000367a), UINT64_C(0x84fa56346b5a963e), UINT64_C(0xf1699374473e8e01),
+		UINT64_C(0x126cdcc735d33024), UINT64_C(0xeafab7b6910d3da7), UINT64_C(0x6a639eb942a7c393),
+		UINT64_C(0x56510087e35ba963), UINT64_C(0xb62beca446286344), UINT64_C(0x8f5b2c0000003728),
+		UINT64_C(0x70cfcf3fa6518579), UINT64_C(0x8637932020dabfcb), UINT64_C(0xd8fca1c96b01c571),
+		UINT64_C(0xb887707a8be2af83), UINT64_C(0xb1797a9780064a39), UINT64_C(0x6e8129b410fd9e32),
+		UINT64_C(0x6a03ebf2d3550eb3), UINT64_C(0x8f612a00000037cd), UINT64_C(0xf88cf7cc9f863f33),
+		UINT64_C(0x088b47bd50e1f84a), UINT64_C(0xd59c1bd046448b42), UINT64_C(0x69392d49aaf616a0),
+		UINT64_C(0xd23acba86a8fd24f), UINT64_C(0x19025e271f4f703e), UINT64_C(0x44640ece7c97bb0f),
+		UINT64_C(0x9466340000003872), UINT64_C(0x7e93de25a805baa6), UINT64_C(0x11c7a302b286193c),
+		UINT64_C(0xcc6755ce792acd76), UINT64_C(0x244260cf68656837), UINT64_C(0x51efadd09ed6a3cb),
+		UINT64_C(0xf43d8f593989630a), UINT64_C(0x7e0258ee62086608), UINT64_C(0x905a310000003922),
+		UINT64_C(0x46fbc9014fb132fc), UINT64_C(0x111675acd5104780), UINT64_C(0xd8fd079d7f17b7ca),
+		UINT64_C(0x2eb934dc4b7c94f4), UINT64_C(0xc58837c0aa2727a6), UINT64_C(0x660045c9509f03a9),
+		UINT64_C(0x25f50adc46b55120), UINT64_C(0x8a5d3000000039cd), UINT64_C(0xc57fd15fdd9c3291),
+		UINT64_C(0x69136cdc4280ad2a), UINT64_C(0x65cfa1acd31bc57d), UINT64_C(0xc31cae4ee6b9ed54),
+		UINT64_C(0x34f7dc679563dce1), UINT64_C(0x024c87379913b05f), UINT64_C(0x886b3d27f31123da),
+		UINT64_C(0x935f310000003a6e), UINT64_C(0x099600676acd91e6), UINT64_C(0xd966d8f5a33bf20f),
+		UINT64_C(0x03d3b434ec345084), UINT64_C(0x4713d567f3f2ae04), UINT64_C(0xf52843f8428d25c8),
+		UINT64_C(0xf01f91429a385a46), UINT64_C(0x6ca7dd7e0ad984fa), UINT64_C(0x9262330000003b18),
+		UINT64_C(0x043c5854d6308ad7), UINT64_C(0xa7e922419e733c80), UINT64_C(0x3cf948d1a0e67a31),
+		UINT64_C(0x1c4b2c2e935bdd6e), UINT64_C(0xcd96831d6c15c479), UINT64_C(0x979f8c579db63c9a),
+		UINT64_C(0x4c9b4862c646310e), UINT64_C(0x93632f0000003bc5), UINT64_C(0x3dd87850c84eafd2),
+		UINT64_C(0x1648eaa323d7d1dc), UINT64_C(0xcb2f426820c831aa), UINT64_C(0x711f614d63136a8a),
+		UINT64_C(0x01a8f6a0c2eba536), UINT64_C(0x8ac3d1c97379d67d), UINT64_C(0x34dc154204154619),
+		UINT64_C(0x8e60330000003c75), UINT64_C(0x5f92b3455926a60e), UINT64_C(0x7250d568cd1c8edc),
+		UINT64_C(0xc12f796e37a2f665), UINT64_C(0x65c1b3e1b75c2c5f), UINT64_C(0x49492d6fed04fd34),
+		UINT64_C(0x8aa1c8d2fddb43e0), UINT64_C(0x9b47c0fb60279252), UINT64_C(0x8d5f310000003d1c),
+		UINT64_C(0x7131f1b3b9d0570b), UINT64_C(0x02808117221adbdd), UINT64_C(0xb69fea44c0bd0f02),
+		UINT64_C(0x3f8a26de45c29fd0), UINT64_C(0x3aef5f0fc813c68c), UINT64_C(0x376e78d965366120),
+		UINT64_C(0x6e31d6d6b830614b), UINT64_C(0x915e310000003dc2), UINT64_C(0xfea17399dde87593),
+		UINT64_C(0x13410785c600d9a3), UINT64_C(0xe474f3d5cc26f63d), UINT64_C(0xea65c60f15fd8250),
+		UINT64_C(0xeded0194a6a959ba), UINT64_C(0xec68db865e04cdc8), UINT64_C(0xb6260d6d360e7c08),
+		UINT64_C(0x9868350000003e6c), UINT64_C(0x503414b422228149), UINT64_C(0x12334f3e02b94707),
+		UINT64_C(0x2c744e977c4ffc51), UINT64_C(0x1e25660863984619), UINT64_C(0xe2d4a52e095bbf5b),
+		UINT64_C(0x3cd8e002c523b2ca), UINT64_C(0xcff2014894e8895b), UINT64_C(0x93652d0000003f1d),
+		UINT64_C(0xde0d792ef06fa683), UINT64_C(0xde4bc300d5ba1d0d), UINT64_C(0x0135150b48556383),
+		UINT64_C(0x4a05263987b03692), UINT64_C(0xf5776586c1e1db80), UINT64_C(0x35e8795f2f236ab7),
+		UINT64_C(0x0d04442e014fddad), UINT64_C(0x8c5a310000003fc9), UINT64_C(0x372001dc58cb58ab),
+		UINT64_C(0x05ce9a840dfc0b0b), UINT64_C(0xb1b1710e53fc4cb0), UINT64_C(0xddf57f04fceaed12),
+		UINT64_C(0x12d42015d6a99dd3), UINT64_C(0xad8c0fee35382871), UINT64_C(0x32015a2fe0907459),
+		UINT64_C(0x915e2d0000004070), UINT64_C(0xd660d7d3db1a5952), UINT64_C(0x7db35ddb5f28a3af),
+		UINT64_C(0x3407f5800f01a75d), UINT64_C(0x4bf5d463a5493796), UINT64_C(0xe475086f2f0079c8),
+		UINT64_C(0xbb60a39565f08421), UINT64_C(0xf904856dea9546c5), UINT64_C(0x8d5f2d000000411c),
+		UINT64_C(0x4239bcf7242dbf85), UINT64_C(0xbd831cd503d57ba1), UINT64_C(0xac884b757478e232),
+		UINT64_C(0x521709ea1b807c37), UINT64_C(0x5b6f45c7ce7b868d), UINT64_C(0x97b54bee9bcb9652),
+		UINT64_C(0x1c0d041953277e47), UINT64_C(0x8f5d2e00000041c2), UINT64_C(0xc678590c8d7f74f2),
+		UINT64_C(0x8b2be112e90bb3ba), UINT64_C(0xbece28cdd6c9b8f1), UINT64_C(0x90fadd46e98565a7),
+		UINT64_C(0xe2ca8a7c9179da4f), UINT64_C(0x80e42278a850e3cc), UINT64_C(0x64132fcaf858d0f4),
+		UINT64_C(0x9c66320000004268), UINT64_C(0xa858b755506f8f8d), UINT64_C(0x3731265c638b01c0),
+		UINT64_C(0xe7eabe0588410380), UINT64_C(0x1650dd8560bab13c), UINT64_C(0x9c8a2012e055198d),
+		UINT64_C(0x0ad7240e31a3ac87), UINT64_C(0x159a9e4f00b46618), UINT64_C(0x905f300000004320),
+		UINT64_C(0x9181cfeda90c8230), UINT64_C(0xe2325960e3fabb32), UINT64_C(0x443ade26867d97d1),
+		UINT64_C(0xdfa1de674df288d0), UINT64_C(0xccc65895252908db), UINT64_C(0xbf6da83659d32d0f),
+		UINT64_C(0x7a7fb11ae6fc6324), UINT64_C(0x94613000000043c6), UINT64_C(0x8b1698af3c86cce7),
+		UINT64_C(0xf2739ca321a42da9), UINT64_C(0xae83186e4c5d06b4), UINT64_C(0xcee8a79d550c6dcd),
+		UINT64_C(0x877679373482a01a), UINT64_C(0x098bdcb2418672f5), UINT64_C(0xf9a0074f695d4413),
+		UINT64_C(0x8d62300000004473), UINT64_C(0xde1c5436c1021369), UINT64_C(0x02dc64b023f0f04f),
+		UINT64_C(0x73181a14ddd216ef), UINT64_C(0xa207105acb0f3244), UINT64_C(0x97de237369ea8d35),
+		UINT64_C(0xf55b9cd7e2e6e3db), UINT64_C(0x58272d8096c4b861), UINT64_C(0x926130000000451c),
+		UINT64_C(0x550592178f939f5f), UINT64_C(0x9d91a0bc9c60fb76), UINT64_C(0x097cc30b46393bad),
+		UINT64_C(0x39db9af94e4482a4), UINT64_C(0xb4f00bb09e60c585), UINT64_C(0x49dd7513c47d126b),
+		UINT64_C(0x2d888a24d7228563), UINT64_C(0x99643100000045ca), UINT64_C(0x2e6c854f0e3031b2),
+		UINT64_C(0xe893a2538e0277e6), UINT64_C(0xc52d71a81288b5ec), UINT64_C(0xb16d8c4296792e7d),
+		UINT64_C(0x81c2ce4461a5b706), UINT64_C(0x8665768317f3a228), UINT64_C(0xfb6b7c801b66aafd),
+		UINT64_C(0x8d5e2e0000004679), UINT64_C(0xfdf833615500839e), UINT64_C(0xb77c28d1afe200ac),
+		UINT64_C(0x51dc5778a41210c3), UINT64_C(0xe2cdee6ecd92bca8), UINT64_C(0xc577b56dae59b3d8),
+		UINT64_C(0x9797a0acecc0ab2e), UINT64_C(0x8a3591706b052cc4), UINT64_C(0x8b5c310000004721),
+		UINT64_C(0x9401d3d53f85472a), UINT64_C(0xda8d2b130ecd08e4), UINT64_C(0x9fb7d32b22395b87),
+		UINT64_C(0xc55710fc1c2fbd53), UINT64_C(0xb8357434c62035fa), UINT64_C(0xff9346c96c406f19),
+		UINT64_C(0x9f063460be7e9f27), UINT64_C(0x9d633200000047c2), UINT64_C(0xcbd9112f1878c1a3),
+		UINT64_C(0xb03839119a53fa82), UINT64_C(0x0b38043c670ec108), UINT64_C(0x7f941391d9fd690a),
+		UINT64_C(0x4508a7214678ae79), UINT64_C(0x120955485ae69740), UINT64_C(0x70ac166031bf7420),
+		UINT64_C(0x9260350000004878), UINT64_C(0x445ac7bfd1339517), UINT64_C(0x97905504b5549619),
+		UINT64_C(0x6f0fc9818d48fed3), UINT64_C(0xbf4fc4938e92e329), UINT64_C(0xc90c72a9034f5308),
+		UINT64_C(0x83d2c2c697c915c0), UINT64_C(0x1767beec58e3b156), UINT64_C(0x8859310000004921),
+		UINT64_C(0x0ecfd29f5d231408), UINT64_C(0x329efe50aa5e2646), UINT64_C(0xe9fbf0e47f413ff8),
+		UINT64_C(0x39341cc4967c2f6e), UINT64_C(0x5c73c5a08f2ce9e1), UINT64_C(0xa33d0997eb853759),
+		UINT64_C(0x1607e05b243462d2), UINT64_C(0x8b5c2900000049c4), UINT64_C(0xad5ebfdc57b5fdb4),
+		UINT64_C(0xdf8ca525c1435fed), UINT64_C(0xf51027bb6e3a987b), UINT64_C(0xa9c1d02011a59323),
+		UINT64_C(0xe1ccaeadf33134bf), UINT64_C(0x922e05763086a6ac), UINT64_C(0xdea2ba0e724813ff),
+		UINT64_C(0x925e320000004a65), UINT64_C(0x638fdd8a4707c4a6), UINT64_C(0xbd85563066d37812),
+		UINT64_C(0x6c1e723367d5c021), UINT64_C(0x8bb89443efbb9edf), UINT64_C(0x3410846bd572497a),
+		UINT64_C(0x2f96766809c252f7), UINT64_C(0xfee3cfdbd9d239f2), UINT64_C(0x9161310000004b08),
+		UINT64_C(0x000bb42137fd9176), UINT64_C(0xac11979efd06286d), UINT64_C(0x09d903e6c79c4b4d),
+		UINT64_C(0xe0be544052e80f4f), UINT64_C(0xbea48b63f63f6036), UINT64_C(0x001b1244bc2e4f06),
+		UINT64_C(0x8f1e02c60511b2ec), UINT64_C(0x88592d0000004bb2), UINT64_C(0x15dc50e9fdb48eee),
+		UINT64_C(0xfc23ced92a67481b), UINT64_C(0xd8c1fb564c331dd3), UINT64_C(0xdf934eadd8c6029e),
+		UINT64_C(0x88abeea8561faecd), UINT64_C(0x3d75f614b1524cbc), UINT64_C(0x4fea05632ba4480d),
+		UINT64_C(0x9465350000004c54), UINT64_C(0x994be58d2f57a7c2), UINT64_C(0xeca575108a95988a),
+		UINT64_C(0x38c1ae2c1d326376), UINT64_C(0x13f52830e3301d25), UINT64_C(0x5c8a745666988158),
+		UINT64_C(0x18cff0f5bbe75cfe), UINT64_C(0xa0a70da608fedaea), UINT64_C(0x9266340000004d01),
+		UINT64_C(0x5953370226bf44b2), UINT64_C(0xc1288941ab67d45d), UINT64_C(0x1587fe94cc4363b6),
+		UINT64_C(0x0b7aa0d00352a81b), UINT64_C(0x01764d0e56f5387b), UINT64_C(0x7f5630e2f3f43d11),
+		UINT64_C(0x3c8688d6c98429d6), UINT64_C(0x7659270000004dae), UINT64_C(0x5ac1efff1e93fd51),
+		UINT64_C(0xdf828d70ffe26335), UINT64_C(0x77840272e12b09dd), UINT64_C(0x7199bc72e83549c2),
+		UINT64_C(0x8f15a17f212d82d0), UINT64_C(0xffffffffffffff00), UINT64_C(0xffffffffffffffff),
+	};
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+	const uint32_t m = UINT32_C(0xFFFFFFFF) / 24800 + 1;
+	const uint32_t low0 = m * h[0];
+	const uint32_t low1 = m * h[1];
+	const uint32_t low2 = m * h[2];
+	h[0] = (uint16_t)((((uint64_t)low0) * 24800) >> 32);
+	h[1] = (uint16_t)((((uint64_t)low1) * 24800) >> 32);
+	h[2] = (uint16_t)((((uint64_t)low2) * 24800) >> 32);
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 24800;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return base_rank;
+}
@@ -0,0 +1,5022 @@
+/* generated with rurban/nbperf 08a5797  /tmp/words */
+/* seed[0]: 1676902021, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[40001] = {
+	    0x0000, 0x29c7, 0x0000, 0x42a0, 0x393d, 0x0000, 0x2945, 0x0000,
+	    0x0000, 0x0783, 0x0000, 0x374f, 0x02e7, 0x4529, 0x1202, 0x0000,
+	    0x0000, 0x0900, 0x3986, 0x0000, 0x0f6c, 0x0000, 0x0000, 0x201f,
+	    0x0000, 0x1e53, 0x2e30, 0x0000, 0x27b9, 0x0000, 0x0000, 0x4322,
+	    0x0000, 0x0000, 0x032e, 0x0000, 0x1c9d, 0x0000, 0x22ae, 0x1180,
+	    0x048a, 0x4dc7, 0x0000, 0x0000, 0x0000, 0x0000, 0x13f6, 0x0000,
+	    0x08eb, 0x132e, 0x0ad6, 0x0b9f, 0x0000, 0x0000, 0x0cd9, 0x134a,
+	    0x0000, 0x3184, 0x2bc7, 0x37cf, 0x0c71, 0x1756, 0x2be8, 0x0000,
+	    0x4513, 0x0000, 0x450d, 0x2d89, 0x3dee, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3fd5, 0x16e6, 0x2a01, 0x4e08, 0x4720,
+	    0x0000, 0x0000, 0x0a33, 0x0000, 0x3600, 0x1123, 0x0178, 0x0000,
+	    0x0000, 0x0b94, 0x0418, 0x4b58, 0x0000, 0x021e, 0x0126, 0x0000,
+	    0x113f, 0x0000, 0x298d, 0x0000, 0x2b49, 0x0000, 0x371a, 0x0000,
+	    0x0000, 0x3ed8, 0x0000, 0x0000, 0x0000, 0x4d5f, 0x03e8, 0x4618,
+	    0x2a75, 0x495f, 0x0000, 0x0000, 0x0000, 0x49c3, 0x0000, 0x0000,
+	    0x12bc, 0x4922, 0x2fa2, 0x0000, 0x0000, 0x4bc3, 0x0000, 0x0000,
+	    0x148a, 0x0000, 0x0000, 0x47d8, 0x0000, 0x425a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0dc6, 0x0000, 0x0000, 0x2540, 0x0000, 0x4bf5,
+	    0x0000, 0x4d23, 0x0000, 0x2853, 0x0000, 0x1ab7, 0x359f, 0x35d9,
+	    0x318c, 0x0000, 0x0000, 0x2506, 0x315c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1227, 0x2f3a, 0x013f, 0x0703, 0x2781, 0x0000, 0x40f8,
+	    0x0000, 0x3ab7, 0x2c6c, 0x0000, 0x0000, 0x0000, 0x2576, 0x0000,
+	    0x0000, 0x374f, 0x34b8, 0x0000, 0x0000, 0x1f5a, 0x253b, 0x0000,
+	    0x13ef, 0x07d5, 0x4a56, 0x0000, 0x3e5d, 0x0000, 0x1313, 0x4bda,
+	    0x0000, 0x0c75, 0x3407, 0x472c, 0x1673, 0x4051, 0x0d06, 0x2670,
+	    0x36ef, 0x0651, 0x35a9, 0x2c2b, 0x0000, 0x133a, 0x17eb, 0x0dbb,
+	    0x0000, 0x4c59, 0x0000, 0x1e5c, 0x0fb0, 0x4453, 0x4c3b, 0x0000,
+	    0x0000, 0x1b94, 0x278f, 0x075c, 0x0000, 0x102c, 0x35b2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1eb2, 0x4606, 0x1492, 0x33fd, 0x1f8d,
+	    0x0596, 0x0000, 0x0d7f, 0x0000, 0x0ec4, 0x0000, 0x0fda, 0x0000,
+	    0x2552, 0x4670, 0x29df, 0x0000, 0x00bf, 0x0000, 0x0000, 0x4101,
+	    0x2196, 0x12db, 0x4a31, 0x0000, 0x0712, 0x0000, 0x17b1, 0x077d,
+	    0x1e7f, 0x16e1, 0x4207, 0x41bf, 0x0000, 0x0000, 0x0000, 0x4693,
+	    0x4167, 0x3cea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x48ab, 0x0000, 0x1f1e, 0x185a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4bd8, 0x0000, 0x0000, 0x3bb1, 0x2fa9, 0x17eb, 0x0000, 0x0000,
+	    0x0eb9, 0x07ba, 0x0000, 0x0000, 0x478b, 0x4542, 0x31a6, 0x0000,
+	    0x1288, 0x4e0d, 0x0000, 0x221f, 0x0000, 0x44ea, 0x0000, 0x400a,
+	    0x067d, 0x1205, 0x0000, 0x0000, 0x0000, 0x11cc, 0x199f, 0x0000,
+	    0x1aab, 0x0021, 0x0000, 0x4954, 0x0000, 0x2165, 0x0000, 0x0000,
+	    0x0210, 0x0000, 0x1fe8, 0x3b78, 0x17be, 0x0784, 0x0000, 0x0000,
+	    0x0000, 0x09ca, 0x0000, 0x029b, 0x26b9, 0x071b, 0x4c45, 0x47ae,
+	    0x202e, 0x42dd, 0x0000, 0x24cb, 0x0000, 0x0000, 0x0000, 0x3770,
+	    0x2d98, 0x3271, 0x0000, 0x0000, 0x0000, 0x0000, 0x4976, 0x0000,
+	    0x0000, 0x0185, 0x4831, 0x0000, 0x4b50, 0x17fc, 0x169c, 0x0000,
+	    0x0000, 0x0000, 0x0405, 0x0000, 0x0dc3, 0x0000, 0x3410, 0x1d80,
+	    0x0000, 0x0000, 0x1805, 0x0000, 0x4bec, 0x08c5, 0x10a9, 0x3081,
+	    0x3ba0, 0x0000, 0x0000, 0x4375, 0x0000, 0x2cee, 0x0000, 0x16df,
+	    0x0000, 0x0000, 0x4d69, 0x38f5, 0x006f, 0x06a0, 0x0000, 0x263f,
+	    0x0000, 0x0000, 0x0c46, 0x0f40, 0x0000, 0x21af, 0x2c60, 0x40e8,
+	    0x0000, 0x0000, 0x1187, 0x0000, 0x0481, 0x0000, 0x0d9a, 0x49ca,
+	    0x427d, 0x0000, 0x3b83, 0x19f7, 0x0000, 0x0000, 0x3d7b, 0x0000,
+	    0x2314, 0x256a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4651,
+	    0x01e5, 0x3c6f, 0x0000, 0x25c0, 0x1ff3, 0x3a3a, 0x3e60, 0x0000,
+	    0x18bf, 0x0422, 0x3c33, 0x1aac, 0x0000, 0x0000, 0x0000, 0x182a,
+	    0x0593, 0x10f4, 0x0000, 0x0000, 0x06b7, 0x2a3d, 0x43de, 0x43e3,
+	    0x1884, 0x0000, 0x0000, 0x2911, 0x41ac, 0x0000, 0x024b, 0x0000,
+	    0x4ad2, 0x0a7c, 0x3ae2, 0x0000, 0x00ac, 0x1eec, 0x0f9f, 0x47cf,
+	    0x3775, 0x0000, 0x0000, 0x3fab, 0x0000, 0x0000, 0x09f6, 0x45da,
+	    0x0000, 0x0e6e, 0x1847, 0x0000, 0x0000, 0x0000, 0x0149, 0x047e,
+	    0x0000, 0x0000, 0x1a18, 0x0000, 0x255a, 0x0000, 0x0a58, 0x0dca,
+	    0x2000, 0x12bb, 0x3e79, 0x43c4, 0x2221, 0x0000, 0x0000, 0x0000,
+	    0x4127, 0x0000, 0x165c, 0x0d2a, 0x0000, 0x0000, 0x4226, 0x0000,
+	    0x0000, 0x2dd4, 0x4a78, 0x0000, 0x0000, 0x3824, 0x45b7, 0x3db9,
+	    0x0fdf, 0x0000, 0x0000, 0x0000, 0x47aa, 0x0000, 0x0000, 0x0000,
+	    0x41cb, 0x0348, 0x291b, 0x0d34, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2df1, 0x155f, 0x0a77, 0x0000, 0x08dd, 0x3fb4, 0x2a2d,
+	    0x0000, 0x4c2d, 0x3b2b, 0x0600, 0x0000, 0x0000, 0x210e, 0x3a38,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4c0c, 0x0000, 0x0000, 0x0000,
+	    0x2434, 0x2c7a, 0x0381, 0x0000, 0x4b48, 0x0000, 0x0000, 0x0dda,
+	    0x3b44, 0x1aa8, 0x0000, 0x3575, 0x40e0, 0x0000, 0x0000, 0x32a0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0826, 0x0000, 0x0000, 0x3dbc,
+	    0x2a33, 0x0000, 0x4026, 0x0000, 0x0000, 0x49f2, 0x4a70, 0x0000,
+	    0x0000, 0x0000, 0x1c01, 0x0000, 0x0000, 0x4c71, 0x1eda, 0x231a,
+	    0x0000, 0x0190, 0x0000, 0x21aa, 0x36c1, 0x0000, 0x3fc4, 0x26db,
+	    0x1347, 0x3556, 0x388e, 0x2cd6, 0x00c7, 0x0000, 0x15d1, 0x4a86,
+	    0x06c9, 0x4760, 0x1d14, 0x4b05, 0x43f0, 0x0000, 0x1ba1, 0x31ff,
+	    0x063f, 0x24d5, 0x00fa, 0x133d, 0x0000, 0x338b, 0x0000, 0x0000,
+	    0x0937, 0x1150, 0x0000, 0x1dae, 0x0000, 0x37a2, 0x0000, 0x0000,
+	    0x0000, 0x2b67, 0x4537, 0x2953, 0x0000, 0x0000, 0x3fe8, 0x474e,
+	    0x3974, 0x0000, 0x084b, 0x10cc, 0x0ffb, 0x0000, 0x0000, 0x09f5,
+	    0x0205, 0x0000, 0x0000, 0x2d1b, 0x1f29, 0x3019, 0x454a, 0x0000,
+	    0x417c, 0x1d3d, 0x0000, 0x0000, 0x0000, 0x0212, 0x0000, 0x342e,
+	    0x0000, 0x0011, 0x3e0c, 0x196d, 0x2840, 0x45bb, 0x0be2, 0x23d8,
+	    0x47dc, 0x1bad, 0x4711, 0x0000, 0x003a, 0x26e5, 0x3504, 0x202a,
+	    0x0000, 0x2ff6, 0x3573, 0x0000, 0x0000, 0x1eee, 0x0162, 0x0000,
+	    0x0d9e, 0x0000, 0x1270, 0x0000, 0x3767, 0x4a47, 0x0441, 0x02be,
+	    0x0000, 0x3fb4, 0x1e39, 0x4310, 0x0e16, 0x0000, 0x0c7e, 0x3b13,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x222b, 0x407a, 0x0000, 0x225a,
+	    0x40d2, 0x0000, 0x4abe, 0x0000, 0x0bd6, 0x1fd9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x443d, 0x441c, 0x27be, 0x0000, 0x0000,
+	    0x0000, 0x2ffa, 0x470c, 0x3661, 0x0000, 0x0fc6, 0x0000, 0x0f0a,
+	    0x2539, 0x0a16, 0x1f4e, 0x0000, 0x0000, 0x44e4, 0x0000, 0x47bb,
+	    0x39f9, 0x3cef, 0x079d, 0x23c3, 0x0000, 0x0000, 0x0000, 0x4b29,
+	    0x0000, 0x1a80, 0x2f6c, 0x194d, 0x1193, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2c5c, 0x31e1, 0x1d72, 0x0000, 0x3c0d, 0x19a5, 0x2ae4,
+	    0x0080, 0x0737, 0x0000, 0x2296, 0x0000, 0x0000, 0x3657, 0x0ce0,
+	    0x10ac, 0x2b4d, 0x0000, 0x2994, 0x0000, 0x01a7, 0x20db, 0x2564,
+	    0x0000, 0x232f, 0x2952, 0x1815, 0x19e4, 0x2481, 0x13b1, 0x1382,
+	    0x4cbd, 0x00db, 0x0000, 0x0000, 0x0000, 0x0f60, 0x1ee8, 0x270b,
+	    0x0000, 0x0000, 0x1f2c, 0x3d08, 0x0000, 0x0000, 0x0b7d, 0x0000,
+	    0x12d5, 0x4848, 0x0000, 0x458d, 0x385d, 0x4650, 0x3385, 0x0000,
+	    0x453f, 0x288a, 0x04b6, 0x481d, 0x0000, 0x0000, 0x0000, 0x443c,
+	    0x3b92, 0x0e3e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ffc, 0x0000,
+	    0x0711, 0x3970, 0x0413, 0x0000, 0x0000, 0x0000, 0x0a44, 0x05ff,
+	    0x0000, 0x0000, 0x0000, 0x0f0e, 0x0000, 0x0000, 0x0000, 0x45bc,
+	    0x49bd, 0x4602, 0x284f, 0x1bff, 0x2d92, 0x3884, 0x07fe, 0x0a54,
+	    0x4398, 0x0000, 0x446a, 0x1497, 0x2552, 0x0000, 0x18e9, 0x0000,
+	    0x4bfb, 0x0000, 0x01c5, 0x1ae7, 0x1ccc, 0x1371, 0x11ea, 0x0000,
+	    0x0000, 0x3d12, 0x3ae5, 0x0275, 0x0000, 0x49f8, 0x3bc4, 0x0000,
+	    0x22fb, 0x0000, 0x0000, 0x458f, 0x3ad7, 0x492b, 0x10dd, 0x104f,
+	    0x4bf8, 0x28b2, 0x3577, 0x3176, 0x0fcf, 0x2597, 0x496e, 0x055e,
+	    0x2b03, 0x46f0, 0x0000, 0x1fa2, 0x3243, 0x06bd, 0x0000, 0x0000,
+	    0x177c, 0x0000, 0x45a1, 0x0000, 0x163b, 0x4120, 0x4765, 0x16f7,
+	    0x3521, 0x265c, 0x0f52, 0x14f9, 0x0000, 0x2045, 0x0000, 0x1811,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x456f, 0x0000, 0x01ba, 0x0d5f,
+	    0x28ae, 0x1e77, 0x07fe, 0x2a7f, 0x0000, 0x0000, 0x2c49, 0x0030,
+	    0x1e92, 0x0000, 0x3421, 0x031b, 0x1994, 0x0000, 0x0000, 0x472c,
+	    0x3bdb, 0x0000, 0x1c16, 0x33f9, 0x3528, 0x4d13, 0x0000, 0x108d,
+	    0x0000, 0x0d97, 0x1582, 0x0000, 0x0000, 0x0000, 0x0864, 0x1ca0,
+	    0x0000, 0x0000, 0x0b97, 0x0000, 0x49a8, 0x1a48, 0x445a, 0x492b,
+	    0x0000, 0x0000, 0x1b70, 0x0000, 0x4b11, 0x3615, 0x3965, 0x07af,
+	    0x461d, 0x0000, 0x4cc1, 0x0000, 0x34ed, 0x2baa, 0x3e3b, 0x22e7,
+	    0x0000, 0x303a, 0x18b2, 0x3839, 0x0000, 0x3707, 0x07d7, 0x0000,
+	    0x456d, 0x0000, 0x0000, 0x4b00, 0x4ad6, 0x2f67, 0x0000, 0x13ab,
+	    0x429e, 0x3ae9, 0x0000, 0x2274, 0x2779, 0x2a3f, 0x0000, 0x1016,
+	    0x4029, 0x1d7b, 0x141d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1e8a, 0x0000, 0x36d2, 0x0000, 0x0000, 0x0000, 0x3414, 0x4007,
+	    0x0000, 0x0000, 0x0000, 0x28b5, 0x0000, 0x0000, 0x1509, 0x1ffe,
+	    0x0000, 0x0000, 0x0000, 0x2810, 0x23d4, 0x0000, 0x26b8, 0x0000,
+	    0x1dca, 0x0000, 0x0bf1, 0x2d20, 0x0000, 0x0000, 0x27f4, 0x0000,
+	    0x2a93, 0x04e1, 0x43db, 0x20a8, 0x1e8b, 0x3d16, 0x35f1, 0x0038,
+	    0x49be, 0x0236, 0x0000, 0x0000, 0x3cb3, 0x0000, 0x0000, 0x296b,
+	    0x18f6, 0x1229, 0x27c4, 0x0000, 0x0000, 0x0000, 0x0d7a, 0x1128,
+	    0x0000, 0x0000, 0x0000, 0x243d, 0x49a4, 0x0000, 0x4c95, 0x0ae3,
+	    0x440d, 0x4188, 0x486b, 0x4113, 0x13bd, 0x2499, 0x0000, 0x1e5a,
+	    0x0000, 0x33d1, 0x2849, 0x489f, 0x136d, 0x1587, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1a83, 0x0000, 0x15b3, 0x2307, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x22fb, 0x0ad4, 0x0000, 0x00d2, 0x05b3,
+	    0x0000, 0x0000, 0x0000, 0x3b32, 0x0000, 0x0000, 0x0000, 0x1dc4,
+	    0x18f8, 0x2f21, 0x0000, 0x0000, 0x0000, 0x0000, 0x25d4, 0x1412,
+	    0x42b9, 0x0000, 0x0000, 0x3a48, 0x123c, 0x1e91, 0x0000, 0x0000,
+	    0x48b1, 0x353f, 0x0000, 0x0000, 0x0000, 0x462b, 0x0000, 0x134e,
+	    0x0000, 0x0000, 0x0000, 0x12c4, 0x17ef, 0x0000, 0x0000, 0x1134,
+	    0x0000, 0x1ef3, 0x30ab, 0x1cce, 0x0ada, 0x0000, 0x0000, 0x03e7,
+	    0x4b5a, 0x49e4, 0x2805, 0x0000, 0x4dab, 0x0000, 0x23dd, 0x1e80,
+	    0x3f3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4c63, 0x407b, 0x0000, 0x0000, 0x0cad, 0x0000, 0x0000, 0x02f4,
+	    0x2d28, 0x4d73, 0x2760, 0x2dd1, 0x4b8d, 0x4944, 0x0000, 0x27ed,
+	    0x0000, 0x2258, 0x0000, 0x0d02, 0x0000, 0x1b54, 0x0f71, 0x0000,
+	    0x0000, 0x0000, 0x1cf6, 0x0000, 0x0000, 0x14e8, 0x479b, 0x0000,
+	    0x0000, 0x27e3, 0x0000, 0x0000, 0x3fb4, 0x0000, 0x1b5b, 0x2e36,
+	    0x0000, 0x1d93, 0x0000, 0x0000, 0x2d34, 0x0bab, 0x0000, 0x0000,
+	    0x0000, 0x2ef4, 0x0000, 0x0000, 0x0000, 0x201a, 0x3754, 0x0000,
+	    0x3852, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d6b, 0x0157, 0x0000,
+	    0x0000, 0x3dc5, 0x0000, 0x0000, 0x0a8d, 0x202c, 0x0000, 0x35ff,
+	    0x0000, 0x061c, 0x343b, 0x45be, 0x0000, 0x26f5, 0x1b14, 0x0000,
+	    0x1621, 0x3f58, 0x22fb, 0x0000, 0x1d85, 0x0000, 0x1636, 0x3a69,
+	    0x0000, 0x0d38, 0x079a, 0x0000, 0x0c26, 0x1531, 0x0000, 0x0000,
+	    0x09e3, 0x4bf4, 0x3a20, 0x4b61, 0x311a, 0x19d1, 0x430a, 0x0b0b,
+	    0x0000, 0x450a, 0x421c, 0x37b6, 0x0000, 0x4446, 0x0000, 0x0000,
+	    0x3d53, 0x0000, 0x0000, 0x0000, 0x0000, 0x1dff, 0x494a, 0x0000,
+	    0x0000, 0x25b4, 0x0000, 0x0000, 0x0000, 0x079c, 0x0255, 0x0000,
+	    0x0000, 0x2c25, 0x0c96, 0x39e4, 0x171c, 0x0000, 0x442e, 0x0f00,
+	    0x0000, 0x13c7, 0x0000, 0x0000, 0x0ce3, 0x28e0, 0x2419, 0x34b3,
+	    0x26ff, 0x0000, 0x2b0b, 0x0000, 0x3ecd, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x21d3, 0x0000, 0x10fc, 0x0000, 0x1c9e, 0x0000,
+	    0x073f, 0x0000, 0x3d0f, 0x4328, 0x2c81, 0x265e, 0x4506, 0x077c,
+	    0x0000, 0x41d3, 0x0000, 0x0000, 0x0eef, 0x0000, 0x48c6, 0x0000,
+	    0x3579, 0x2739, 0x0000, 0x0f7c, 0x2ac5, 0x1c2f, 0x032a, 0x0000,
+	    0x4354, 0x346f, 0x0000, 0x0000, 0x4573, 0x0000, 0x0000, 0x02a6,
+	    0x0000, 0x2c09, 0x0bb9, 0x0a93, 0x1b62, 0x07a6, 0x1042, 0x3125,
+	    0x0000, 0x0000, 0x1ade, 0x46df, 0x0000, 0x2e95, 0x0000, 0x0000,
+	    0x39c9, 0x45c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d28,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x453a, 0x196b, 0x1a77,
+	    0x00c2, 0x1773, 0x0ca8, 0x1b1f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2d76, 0x0d9f, 0x0000, 0x0000, 0x0dcb, 0x0000, 0x0000,
+	    0x3838, 0x1bc6, 0x31e7, 0x0000, 0x0000, 0x4641, 0x0000, 0x19e9,
+	    0x1453, 0x06e1, 0x01ca, 0x02eb, 0x170c, 0x0000, 0x0085, 0x1397,
+	    0x0000, 0x0000, 0x3501, 0x0000, 0x235f, 0x0000, 0x0000, 0x1c0c,
+	    0x2bb3, 0x0000, 0x3df0, 0x2c33, 0x25cb, 0x290c, 0x45d3, 0x36ef,
+	    0x0000, 0x1b5d, 0x0000, 0x262f, 0x0000, 0x17af, 0x20e9, 0x14bf,
+	    0x1b73, 0x0000, 0x0000, 0x0a43, 0x0000, 0x0420, 0x0000, 0x2bff,
+	    0x09da, 0x2430, 0x2845, 0x14f2, 0x19b7, 0x195d, 0x4be7, 0x0000,
+	    0x3e14, 0x46a1, 0x454a, 0x2610, 0x30e4, 0x1e8a, 0x1526, 0x1c09,
+	    0x0ce1, 0x1a4c, 0x3198, 0x161f, 0x2e7f, 0x1fbf, 0x17c0, 0x39b8,
+	    0x0000, 0x0000, 0x0000, 0x3860, 0x2953, 0x1d29, 0x3fad, 0x1a5b,
+	    0x0000, 0x0000, 0x0000, 0x288f, 0x0000, 0x31f6, 0x0000, 0x0000,
+	    0x0000, 0x3875, 0x0000, 0x0000, 0x05d1, 0x0181, 0x42e9, 0x3401,
+	    0x0000, 0x14ce, 0x1f21, 0x0000, 0x2098, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x481e, 0x0000, 0x1f5e, 0x2b0e, 0x39da,
+	    0x49c8, 0x0802, 0x0000, 0x0000, 0x0000, 0x0000, 0x4cee, 0x0000,
+	    0x3a78, 0x0000, 0x150b, 0x1128, 0x0d80, 0x0000, 0x0000, 0x1695,
+	    0x0000, 0x0000, 0x0000, 0x0c1c, 0x0000, 0x0000, 0x0000, 0x19e7,
+	    0x0739, 0x3830, 0x08c8, 0x490e, 0x3b1b, 0x0000, 0x3379, 0x409b,
+	    0x3fac, 0x2d2f, 0x1f27, 0x4936, 0x0000, 0x0056, 0x0000, 0x0000,
+	    0x22ae, 0x34de, 0x0000, 0x233b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x47b0, 0x0000, 0x0000, 0x34fb, 0x0000, 0x26a5, 0x3aa9, 0x2ceb,
+	    0x0000, 0x0000, 0x0000, 0x2be3, 0x0646, 0x0000, 0x316b, 0x0000,
+	    0x4b62, 0x3b69, 0x481d, 0x0000, 0x47e9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3254, 0x0000, 0x20ae, 0x0000, 0x0000, 0x0000, 0x3999,
+	    0x246b, 0x0000, 0x29f3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ae5, 0x0000, 0x389e, 0x386a, 0x2005, 0x009f,
+	    0x0300, 0x1939, 0x28fe, 0x409f, 0x0000, 0x1655, 0x0000, 0x236e,
+	    0x0000, 0x0000, 0x0b96, 0x0d6c, 0x4dbc, 0x2034, 0x29e0, 0x060c,
+	    0x0000, 0x1e42, 0x46d7, 0x0000, 0x1a54, 0x0000, 0x0000, 0x0d6b,
+	    0x2140, 0x4504, 0x3ea5, 0x0000, 0x4312, 0x3c8e, 0x0000, 0x0000,
+	    0x45c8, 0x03e9, 0x0000, 0x1e35, 0x0000, 0x0000, 0x04ac, 0x0000,
+	    0x2332, 0x0b3a, 0x0000, 0x0000, 0x1237, 0x37e3, 0x0000, 0x02e8,
+	    0x12a8, 0x3116, 0x4676, 0x3515, 0x0000, 0x19a2, 0x1b8a, 0x4d71,
+	    0x41e5, 0x2e99, 0x460a, 0x27c0, 0x3f1f, 0x0000, 0x0000, 0x1f80,
+	    0x0000, 0x0000, 0x1f37, 0x0795, 0x0000, 0x366d, 0x1408, 0x0000,
+	    0x0000, 0x3b1c, 0x4651, 0x0000, 0x0000, 0x0000, 0x1857, 0x4b94,
+	    0x0000, 0x1309, 0x0000, 0x0000, 0x0000, 0x2824, 0x1cf4, 0x0000,
+	    0x4c58, 0x38a3, 0x029f, 0x0000, 0x2f02, 0x0000, 0x476a, 0x3c28,
+	    0x3468, 0x0cd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3f75, 0x2072, 0x24ad, 0x0000, 0x4b35, 0x3db8,
+	    0x0187, 0x4171, 0x0000, 0x1242, 0x4cc7, 0x0000, 0x2d40, 0x39cb,
+	    0x06b3, 0x0000, 0x0000, 0x286d, 0x0888, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x32c1, 0x1db7, 0x0000, 0x3040, 0x488b, 0x3186, 0x0000,
+	    0x2e66, 0x49a0, 0x0000, 0x2ef0, 0x4d36, 0x48d5, 0x0000, 0x10e3,
+	    0x48cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x3594, 0x4611, 0x0000,
+	    0x0916, 0x2d74, 0x390b, 0x45bf, 0x24be, 0x089a, 0x0000, 0x0000,
+	    0x0000, 0x0012, 0x0268, 0x1d8a, 0x1fb9, 0x1435, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x151f, 0x4ac6, 0x0000, 0x2689,
+	    0x240f, 0x0000, 0x48e2, 0x1ca1, 0x3bba, 0x4168, 0x1c8c, 0x45c4,
+	    0x2811, 0x0000, 0x40c9, 0x3833, 0x30c3, 0x0000, 0x0000, 0x0000,
+	    0x384c, 0x2db3, 0x0000, 0x0feb, 0x3e90, 0x2723, 0x45c7, 0x2e64,
+	    0x0000, 0x026f, 0x34f1, 0x1ee4, 0x0000, 0x168c, 0x0000, 0x0000,
+	    0x287a, 0x0000, 0x29b9, 0x0000, 0x203e, 0x0000, 0x0fc9, 0x38a4,
+	    0x2fb0, 0x4dd9, 0x0ea0, 0x0000, 0x1f86, 0x0000, 0x0000, 0x3d93,
+	    0x3909, 0x0000, 0x440f, 0x0000, 0x2d39, 0x0cb4, 0x0000, 0x06ae,
+	    0x04ce, 0x141d, 0x0000, 0x0000, 0x0bc3, 0x3fc3, 0x0000, 0x0000,
+	    0x0000, 0x35c6, 0x0000, 0x0000, 0x0000, 0x4cc3, 0x0000, 0x0f9b,
+	    0x1135, 0x41e8, 0x23a1, 0x2f44, 0x2d61, 0x03e4, 0x2da0, 0x14cc,
+	    0x2717, 0x0000, 0x0000, 0x3b77, 0x24ca, 0x4657, 0x0000, 0x4acd,
+	    0x34b9, 0x3849, 0x1195, 0x0000, 0x37a0, 0x1042, 0x4b58, 0x0000,
+	    0x0000, 0x0000, 0x1cc9, 0x36cf, 0x0000, 0x0000, 0x0433, 0x4d6c,
+	    0x0000, 0x0000, 0x0f49, 0x0000, 0x2e94, 0x0987, 0x4088, 0x1042,
+	    0x3704, 0x2de1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0760, 0x3232,
+	    0x4b06, 0x0000, 0x1ba6, 0x0000, 0x314b, 0x17f2, 0x1c81, 0x0000,
+	    0x47a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x114e,
+	    0x0000, 0x323b, 0x368d, 0x0000, 0x0e20, 0x0000, 0x286d, 0x11c9,
+	    0x0000, 0x0000, 0x227d, 0x0000, 0x2b0e, 0x3467, 0x459b, 0x0000,
+	    0x0000, 0x0000, 0x2c80, 0x14de, 0x082d, 0x0000, 0x0000, 0x4d54,
+	    0x1b53, 0x0000, 0x0000, 0x0b19, 0x233f, 0x12b1, 0x1796, 0x2463,
+	    0x0000, 0x0000, 0x2eda, 0x197b, 0x0000, 0x1724, 0x0000, 0x396d,
+	    0x0000, 0x38fd, 0x0031, 0x0000, 0x0000, 0x0000, 0x02f9, 0x0000,
+	    0x3bfa, 0x0000, 0x0000, 0x2fad, 0x4d1c, 0x0000, 0x3f89, 0x38f1,
+	    0x48c7, 0x0000, 0x0000, 0x44c0, 0x0639, 0x0000, 0x0000, 0x1fb1,
+	    0x4d23, 0x3539, 0x0000, 0x47c1, 0x0406, 0x0000, 0x0d38, 0x1b4e,
+	    0x2034, 0x0000, 0x0000, 0x224a, 0x1760, 0x0000, 0x2a16, 0x237a,
+	    0x2cd8, 0x0000, 0x0000, 0x0000, 0x4640, 0x02bc, 0x0000, 0x0000,
+	    0x11ef, 0x0000, 0x0000, 0x35bb, 0x0000, 0x0000, 0x11ac, 0x4062,
+	    0x2778, 0x48fe, 0x3c1e, 0x0000, 0x0378, 0x0000, 0x03f0, 0x07da,
+	    0x29a9, 0x0572, 0x2010, 0x0000, 0x0000, 0x0000, 0x19df, 0x0000,
+	    0x0000, 0x42cb, 0x0000, 0x02ed, 0x145b, 0x3362, 0x0000, 0x0000,
+	    0x0000, 0x181d, 0x2d97, 0x0e9f, 0x0000, 0x300b, 0x360f, 0x0000,
+	    0x02be, 0x0000, 0x307a, 0x0f1c, 0x0000, 0x0000, 0x0000, 0x144b,
+	    0x112d, 0x14e5, 0x0000, 0x4572, 0x1899, 0x2daf, 0x05ad, 0x0000,
+	    0x010a, 0x0000, 0x0000, 0x1df5, 0x456e, 0x0000, 0x0000, 0x0239,
+	    0x0000, 0x3598, 0x4662, 0x0000, 0x17dd, 0x1b04, 0x1d90, 0x0000,
+	    0x23f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d28, 0x0000,
+	    0x01c9, 0x08b5, 0x1305, 0x1814, 0x0000, 0x31af, 0x0544, 0x397a,
+	    0x0000, 0x0000, 0x3f19, 0x0000, 0x3e21, 0x0a71, 0x3bf4, 0x40cf,
+	    0x0000, 0x0000, 0x0000, 0x11b2, 0x4dce, 0x0000, 0x10ae, 0x0000,
+	    0x0000, 0x0aa5, 0x3a41, 0x2014, 0x0daf, 0x22a2, 0x3c70, 0x4837,
+	    0x0000, 0x10e6, 0x1c73, 0x2468, 0x0d4e, 0x1a51, 0x0000, 0x2d5a,
+	    0x363f, 0x2029, 0x0000, 0x0000, 0x0000, 0x0000, 0x23fb, 0x45a7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1ac5, 0x0000, 0x1481, 0x0936,
+	    0x0000, 0x28a7, 0x0000, 0x3c07, 0x4051, 0x0000, 0x0000, 0x05d6,
+	    0x0000, 0x35bc, 0x44ba, 0x1d13, 0x4aa1, 0x3fa2, 0x06eb, 0x0123,
+	    0x0000, 0x0000, 0x447e, 0x3bce, 0x396b, 0x0000, 0x29e6, 0x0281,
+	    0x0000, 0x0000, 0x0000, 0x35ea, 0x0000, 0x2d55, 0x1133, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4580, 0x1b7e, 0x151c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0290, 0x2b25, 0x0000, 0x0000, 0x0e4c, 0x4168,
+	    0x06bc, 0x0000, 0x0000, 0x43a8, 0x30a8, 0x1118, 0x16ff, 0x0000,
+	    0x38b1, 0x2019, 0x0000, 0x3b26, 0x0000, 0x0000, 0x2056, 0x0000,
+	    0x0000, 0x0000, 0x1be1, 0x3e09, 0x3819, 0x0461, 0x0000, 0x1dcc,
+	    0x0000, 0x0000, 0x1be4, 0x316b, 0x0cfa, 0x0000, 0x4a78, 0x0000,
+	    0x38eb, 0x0000, 0x4a88, 0x3a4c, 0x0b85, 0x1359, 0x160e, 0x19b8,
+	    0x07c6, 0x08a8, 0x3e4e, 0x0000, 0x0000, 0x0000, 0x32c4, 0x0000,
+	    0x12d8, 0x35e6, 0x4692, 0x4dc3, 0x0000, 0x0769, 0x2675, 0x1a0c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x051d,
+	    0x0722, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c63, 0x31fc,
+	    0x28c7, 0x0000, 0x4501, 0x0000, 0x1484, 0x0000, 0x1333, 0x398f,
+	    0x0000, 0x0442, 0x0000, 0x06b3, 0x0000, 0x0000, 0x0000, 0x40c3,
+	    0x41ef, 0x4245, 0x1668, 0x0c73, 0x0000, 0x0000, 0x20c8, 0x3802,
+	    0x245a, 0x0000, 0x48f2, 0x0000, 0x0000, 0x281e, 0x0000, 0x0000,
+	    0x279e, 0x150c, 0x0000, 0x1a52, 0x0000, 0x0943, 0x4d78, 0x0000,
+	    0x2b64, 0x3fe0, 0x0000, 0x31c4, 0x26b8, 0x0aa4, 0x0000, 0x0000,
+	    0x0d7e, 0x0000, 0x0000, 0x0000, 0x318b, 0x42a0, 0x0000, 0x350a,
+	    0x1bae, 0x1bcf, 0x0000, 0x0000, 0x0bb4, 0x1e7e, 0x0000, 0x0000,
+	    0x1cc6, 0x37b8, 0x2358, 0x476e, 0x1145, 0x00f6, 0x4da9, 0x0000,
+	    0x0000, 0x02c1, 0x0000, 0x0000, 0x116b, 0x0000, 0x1ca6, 0x191a,
+	    0x44a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x473a, 0x400d, 0x2b3f,
+	    0x0000, 0x3e9b, 0x4b95, 0x0000, 0x0000, 0x0000, 0x1936, 0x0dd8,
+	    0x2048, 0x3ad0, 0x2320, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x225e, 0x0000, 0x0000, 0x197f, 0x1cce, 0x43e6, 0x0000, 0x1bee,
+	    0x0000, 0x0000, 0x34e4, 0x15e6, 0x0000, 0x415e, 0x0000, 0x0000,
+	    0x30bd, 0x0464, 0x0b02, 0x42f3, 0x3056, 0x0e1a, 0x0693, 0x0000,
+	    0x08b2, 0x0000, 0x052c, 0x4350, 0x0000, 0x2d11, 0x0000, 0x0000,
+	    0x2eef, 0x1a6d, 0x021f, 0x0000, 0x0000, 0x46ea, 0x0000, 0x0000,
+	    0x477d, 0x4ce5, 0x4ca2, 0x0000, 0x02b3, 0x0000, 0x44cf, 0x417a,
+	    0x0000, 0x0000, 0x494e, 0x3453, 0x4d1f, 0x0000, 0x3827, 0x34e7,
+	    0x08bd, 0x0000, 0x19f1, 0x3f01, 0x08ff, 0x0000, 0x0000, 0x31db,
+	    0x3d85, 0x114d, 0x0eee, 0x46bf, 0x0000, 0x28d0, 0x1087, 0x32b3,
+	    0x0000, 0x1b77, 0x2e55, 0x0000, 0x169f, 0x0000, 0x15d1, 0x1b80,
+	    0x0bf9, 0x01c2, 0x201c, 0x0000, 0x1c47, 0x0000, 0x23e1, 0x0000,
+	    0x2a8a, 0x0000, 0x21ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0313,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d2c,
+	    0x2ee2, 0x0000, 0x0000, 0x0000, 0x0000, 0x33b5, 0x36b7, 0x1340,
+	    0x4bbb, 0x32d0, 0x14c4, 0x01e2, 0x0000, 0x2e07, 0x0e38, 0x2fa4,
+	    0x0000, 0x0000, 0x0000, 0x491a, 0x02b6, 0x36ee, 0x1ed6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04bd, 0x21c9, 0x0000, 0x0000, 0x46f7,
+	    0x0000, 0x226a, 0x2425, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x300a, 0x16e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x021c, 0x0000,
+	    0x0000, 0x0c7e, 0x0000, 0x0000, 0x0000, 0x1ac4, 0x0000, 0x0000,
+	    0x29aa, 0x0000, 0x2298, 0x3311, 0x0c90, 0x0000, 0x1af4, 0x0000,
+	    0x0000, 0x3e76, 0x1cde, 0x0000, 0x3ab3, 0x4c1c, 0x448b, 0x0000,
+	    0x0000, 0x1f44, 0x0000, 0x0000, 0x0000, 0x0000, 0x418e, 0x0000,
+	    0x0000, 0x4b08, 0x4d1a, 0x2e8b, 0x0000, 0x0000, 0x372e, 0x4994,
+	    0x207b, 0x0000, 0x1d97, 0x259b, 0x3afa, 0x0000, 0x263e, 0x4441,
+	    0x45f0, 0x0000, 0x0000, 0x0000, 0x1eb7, 0x48ea, 0x1de4, 0x0000,
+	    0x1583, 0x0000, 0x0000, 0x0000, 0x0000, 0x4592, 0x0000, 0x1142,
+	    0x0000, 0x3bbf, 0x4575, 0x0000, 0x14a7, 0x0c2e, 0x13e9, 0x0000,
+	    0x2071, 0x0555, 0x0000, 0x289d, 0x1cf1, 0x2f49, 0x0000, 0x0000,
+	    0x0000, 0x428a, 0x2496, 0x0000, 0x4896, 0x1c7b, 0x2e2f, 0x0000,
+	    0x3c9e, 0x34eb, 0x2536, 0x0765, 0x0000, 0x4b3b, 0x0676, 0x1c63,
+	    0x21fe, 0x02e9, 0x3a33, 0x0000, 0x2793, 0x173d, 0x0000, 0x0000,
+	    0x205d, 0x12b1, 0x0000, 0x0000, 0x0000, 0x2c4a, 0x0000, 0x1d4e,
+	    0x1ade, 0x0000, 0x0000, 0x0000, 0x3bf7, 0x4ae2, 0x24d7, 0x1a2b,
+	    0x37f9, 0x0000, 0x05ff, 0x0000, 0x2c04, 0x0000, 0x409b, 0x0000,
+	    0x0fbb, 0x0a25, 0x0000, 0x0e1e, 0x18ce, 0x3954, 0x3910, 0x0000,
+	    0x0c8d, 0x3282, 0x2ce9, 0x054f, 0x0000, 0x4b4a, 0x39d7, 0x2828,
+	    0x0000, 0x0000, 0x29e3, 0x1bfb, 0x28bf, 0x28af, 0x0000, 0x1028,
+	    0x0000, 0x0000, 0x0000, 0x1a21, 0x0000, 0x3bda, 0x3b0d, 0x3531,
+	    0x41e9, 0x3ca0, 0x0000, 0x0000, 0x443e, 0x3cb6, 0x0583, 0x142a,
+	    0x16fc, 0x49a4, 0x4120, 0x1f8d, 0x093e, 0x0000, 0x0000, 0x48e9,
+	    0x2d9e, 0x1cb2, 0x0000, 0x0000, 0x1cc5, 0x0000, 0x3b8d, 0x30b2,
+	    0x0000, 0x16d7, 0x02da, 0x0000, 0x4c67, 0x0000, 0x2965, 0x0000,
+	    0x2fa4, 0x0000, 0x37fe, 0x0000, 0x0809, 0x1475, 0x1e76, 0x0000,
+	    0x137c, 0x0000, 0x30ab, 0x0fa2, 0x0000, 0x0000, 0x16d2, 0x22fa,
+	    0x4b3c, 0x0000, 0x026f, 0x0000, 0x2280, 0x0000, 0x0000, 0x0000,
+	    0x240d, 0x0215, 0x0000, 0x0000, 0x244f, 0x00e1, 0x14af, 0x325a,
+	    0x48f5, 0x1e26, 0x0000, 0x3633, 0x4a77, 0x46f6, 0x4ced, 0x3583,
+	    0x3557, 0x0000, 0x0000, 0x0000, 0x0000, 0x4559, 0x0000, 0x3c6e,
+	    0x0000, 0x4a3e, 0x173b, 0x1db8, 0x0000, 0x3fb1, 0x0000, 0x485b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2fd7, 0x3c9a, 0x2f33, 0x0000,
+	    0x32b5, 0x0000, 0x0000, 0x0f45, 0x0415, 0x0000, 0x0000, 0x0000,
+	    0x0851, 0x0000, 0x1d96, 0x2fd1, 0x09d8, 0x0000, 0x0000, 0x0be5,
+	    0x0d25, 0x0000, 0x0000, 0x0000, 0x10f0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3d32, 0x2174, 0x37e3, 0x0000, 0x0000, 0x0000, 0x01cd,
+	    0x0000, 0x3c81, 0x478e, 0x06d1, 0x0aec, 0x0000, 0x2e79, 0x31eb,
+	    0x0000, 0x4839, 0x09a2, 0x3950, 0x0a2a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0794, 0x2b99, 0x0000, 0x3ba8, 0x47c8, 0x1e9c,
+	    0x18a3, 0x2ff0, 0x00de, 0x21d4, 0x0000, 0x3e3d, 0x0000, 0x2ebe,
+	    0x13d4, 0x386a, 0x0000, 0x0000, 0x3d92, 0x0000, 0x046f, 0x0000,
+	    0x1ed7, 0x0be6, 0x0894, 0x0000, 0x0000, 0x0000, 0x0000, 0x38ee,
+	    0x0000, 0x0da4, 0x0000, 0x0000, 0x32cd, 0x0000, 0x024f, 0x2d59,
+	    0x413d, 0x2742, 0x0000, 0x0000, 0x0000, 0x4b7a, 0x0d98, 0x0000,
+	    0x0000, 0x353d, 0x0000, 0x0000, 0x21f4, 0x0000, 0x2452, 0x0000,
+	    0x0000, 0x15f3, 0x0000, 0x2998, 0x0000, 0x3c68, 0x3de9, 0x462a,
+	    0x3905, 0x0000, 0x317a, 0x436b, 0x1f8e, 0x0000, 0x2e9d, 0x0000,
+	    0x0000, 0x0000, 0x3a70, 0x33b0, 0x458b, 0x4136, 0x299d, 0x439b,
+	    0x475b, 0x4d6d, 0x3c9b, 0x0000, 0x4c61, 0x3afa, 0x23e6, 0x150a,
+	    0x0000, 0x0000, 0x0000, 0x210a, 0x4bd8, 0x1e97, 0x3fd4, 0x2c14,
+	    0x0000, 0x0f2e, 0x1c29, 0x1cf9, 0x0423, 0x0000, 0x3a22, 0x0000,
+	    0x1853, 0x0326, 0x2405, 0x3390, 0x0000, 0x4222, 0x0000, 0x0000,
+	    0x2864, 0x1c12, 0x0a7a, 0x4c92, 0x0000, 0x0000, 0x0eaf, 0x4c5a,
+	    0x0000, 0x043b, 0x0000, 0x032e, 0x1aa2, 0x1463, 0x3026, 0x397c,
+	    0x29da, 0x32c3, 0x2f34, 0x4303, 0x0000, 0x3ff4, 0x0000, 0x0000,
+	    0x143b, 0x2619, 0x0000, 0x1af7, 0x0000, 0x0000, 0x4b12, 0x06c7,
+	    0x0000, 0x033c, 0x1d50, 0x46cf, 0x0000, 0x453c, 0x0000, 0x3277,
+	    0x15aa, 0x2ea0, 0x0000, 0x0e3d, 0x486d, 0x0000, 0x05ba, 0x2659,
+	    0x0000, 0x3178, 0x029c, 0x2f8b, 0x1269, 0x13f7, 0x4bfe, 0x3a9c,
+	    0x3bbd, 0x4745, 0x0000, 0x0000, 0x0000, 0x2112, 0x18da, 0x07c7,
+	    0x4c50, 0x449d, 0x0000, 0x3f13, 0x4ce0, 0x0000, 0x0def, 0x3260,
+	    0x0000, 0x0000, 0x4a1a, 0x0000, 0x4563, 0x2aeb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2ae6, 0x0000, 0x2312, 0x0000, 0x4d0e, 0x45a0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x382b, 0x2a4d, 0x17ba, 0x0000,
+	    0x0000, 0x2561, 0x0000, 0x0b7a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2c7c, 0x0ed7, 0x03a2, 0x0000, 0x274c, 0x4470, 0x42c6, 0x0000,
+	    0x1236, 0x0533, 0x3b31, 0x2eb8, 0x0000, 0x0274, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16b7, 0x2711, 0x4b27,
+	    0x0000, 0x2343, 0x466d, 0x0000, 0x0000, 0x22b1, 0x122e, 0x0860,
+	    0x393c, 0x3614, 0x0000, 0x08a6, 0x1db6, 0x0000, 0x41cd, 0x0efd,
+	    0x1c94, 0x22f1, 0x0000, 0x3966, 0x0000, 0x0000, 0x08b5, 0x0000,
+	    0x2bd9, 0x0000, 0x16db, 0x0000, 0x2b99, 0x0000, 0x0000, 0x056c,
+	    0x2944, 0x0000, 0x1eb9, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f2e,
+	    0x42b9, 0x2386, 0x2511, 0x3c60, 0x0000, 0x0038, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x21ba, 0x1436, 0x0000, 0x16e8, 0x0000, 0x4539,
+	    0x21a4, 0x18dd, 0x0000, 0x0000, 0x0000, 0x02fc, 0x0000, 0x408c,
+	    0x0000, 0x0000, 0x36d4, 0x0000, 0x0000, 0x0fd2, 0x2954, 0x0000,
+	    0x0c73, 0x0000, 0x0000, 0x014a, 0x0000, 0x3da6, 0x4dc1, 0x333f,
+	    0x0dc0, 0x0000, 0x3539, 0x0000, 0x0000, 0x0c4e, 0x063f, 0x0000,
+	    0x0000, 0x2314, 0x48ce, 0x083e, 0x0000, 0x002c, 0x1b95, 0x0000,
+	    0x2f4e, 0x06b6, 0x1cfa, 0x1440, 0x0000, 0x1e06, 0x0000, 0x0000,
+	    0x06dd, 0x46c1, 0x29dd, 0x4111, 0x0000, 0x4247, 0x14a2, 0x0000,
+	    0x0000, 0x2b9b, 0x2877, 0x1438, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x402b, 0x01a1, 0x0000, 0x0000, 0x0000, 0x12f3, 0x0000, 0x4ae0,
+	    0x2d7d, 0x4cf3, 0x2a85, 0x2f5f, 0x222d, 0x0000, 0x2ba0, 0x10f9,
+	    0x0000, 0x0652, 0x0000, 0x0000, 0x4a76, 0x0000, 0x0000, 0x18c8,
+	    0x10fb, 0x0000, 0x062f, 0x0000, 0x2a6c, 0x3527, 0x0000, 0x2d0b,
+	    0x0000, 0x0000, 0x16be, 0x14fc, 0x0000, 0x0000, 0x0000, 0x1f2e,
+	    0x0000, 0x4a79, 0x4673, 0x2a7a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1330, 0x0000, 0x0000, 0x067e, 0x068b, 0x3fae, 0x12d0,
+	    0x2953, 0x2aad, 0x1290, 0x4054, 0x0000, 0x4602, 0x32b0, 0x0000,
+	    0x2d83, 0x0156, 0x2c46, 0x1ceb, 0x0000, 0x0000, 0x2593, 0x0180,
+	    0x0000, 0x39ac, 0x46e9, 0x0000, 0x0000, 0x32ca, 0x0000, 0x0000,
+	    0x43d5, 0x0000, 0x2f06, 0x2000, 0x3f59, 0x0000, 0x239c, 0x439f,
+	    0x0793, 0x0000, 0x0278, 0x07e9, 0x0000, 0x0000, 0x0c14, 0x26e1,
+	    0x0000, 0x410a, 0x31d5, 0x0000, 0x0fd2, 0x0000, 0x23b8, 0x3864,
+	    0x0b97, 0x3dd6, 0x0000, 0x0000, 0x14d1, 0x271f, 0x0000, 0x1c42,
+	    0x239d, 0x4433, 0x3ede, 0x2231, 0x0000, 0x37c4, 0x0000, 0x0000,
+	    0x22be, 0x0000, 0x2f0a, 0x172b, 0x0612, 0x116b, 0x0000, 0x29d8,
+	    0x42a0, 0x0000, 0x0eff, 0x18ca, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4438, 0x0000, 0x0000, 0x0000, 0x3fa9, 0x0000, 0x0000, 0x21c4,
+	    0x0000, 0x3608, 0x0ed1, 0x31f7, 0x105a, 0x0000, 0x1a34, 0x022f,
+	    0x0000, 0x0000, 0x370b, 0x4e13, 0x3542, 0x0f61, 0x0000, 0x0000,
+	    0x0000, 0x4ca8, 0x1e0b, 0x0000, 0x0c8e, 0x0b7b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x10c8, 0x0a67, 0x1a0b, 0x0000, 0x0000, 0x1b26,
+	    0x0d12, 0x30b6, 0x18ea, 0x0000, 0x0000, 0x2ea7, 0x4c6d, 0x4443,
+	    0x1393, 0x0000, 0x0f07, 0x25bd, 0x054d, 0x2f30, 0x43b6, 0x1740,
+	    0x376b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e00, 0x2999, 0x2643,
+	    0x2482, 0x4026, 0x0000, 0x0000, 0x19c0, 0x19a9, 0x0000, 0x378f,
+	    0x2958, 0x48fb, 0x332d, 0x3797, 0x0000, 0x4273, 0x1536, 0x4a5b,
+	    0x4425, 0x0000, 0x062d, 0x262c, 0x38ad, 0x0000, 0x12f5, 0x1097,
+	    0x17ad, 0x004f, 0x0000, 0x032e, 0x0a88, 0x0000, 0x0000, 0x0000,
+	    0x27e7, 0x0000, 0x4479, 0x0000, 0x0000, 0x0ffa, 0x38df, 0x3416,
+	    0x0bf0, 0x1fd6, 0x2e62, 0x0000, 0x44d0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4384, 0x405e, 0x0000, 0x1899, 0x0ffc, 0x0000, 0x19a4,
+	    0x2da3, 0x0c65, 0x24e2, 0x4117, 0x0000, 0x1a28, 0x0438, 0x0000,
+	    0x10f6, 0x21c3, 0x21c5, 0x2aad, 0x36ac, 0x0000, 0x09de, 0x0000,
+	    0x223a, 0x0000, 0x0794, 0x0000, 0x0000, 0x0000, 0x0bfb, 0x0000,
+	    0x0000, 0x0000, 0x11c2, 0x47f1, 0x0000, 0x29b7, 0x0e35, 0x1f6e,
+	    0x0000, 0x0000, 0x2414, 0x0000, 0x4983, 0x0000, 0x0000, 0x0000,
+	    0x1791, 0x38c9, 0x4c65, 0x0b48, 0x472b, 0x3a96, 0x31c2, 0x2c21,
+	    0x0000, 0x0000, 0x2cda, 0x192d, 0x1f53, 0x070a, 0x0000, 0x0e4d,
+	    0x0000, 0x137f, 0x1254, 0x16c0, 0x38c7, 0x0000, 0x06eb, 0x1279,
+	    0x0ede, 0x0000, 0x0000, 0x0000, 0x1fe7, 0x0000, 0x13a1, 0x0000,
+	    0x0000, 0x112a, 0x0000, 0x33ff, 0x0000, 0x22de, 0x0000, 0x0000,
+	    0x3c91, 0x0000, 0x2946, 0x0000, 0x2d75, 0x0000, 0x0000, 0x4843,
+	    0x0000, 0x0817, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1e50, 0x0017, 0x47c3, 0x280b, 0x0107, 0x36b7, 0x0000, 0x0843,
+	    0x0000, 0x0000, 0x0000, 0x3569, 0x0000, 0x3048, 0x0000, 0x12a4,
+	    0x0000, 0x0f8a, 0x0000, 0x30b3, 0x0000, 0x44b1, 0x0000, 0x0000,
+	    0x0000, 0x06a1, 0x0c7e, 0x0000, 0x3889, 0x42fd, 0x0910, 0x0000,
+	    0x1249, 0x0000, 0x0000, 0x440a, 0x27c1, 0x4175, 0x03d5, 0x0000,
+	    0x0000, 0x0000, 0x3191, 0x0000, 0x214e, 0x1935, 0x0000, 0x4291,
+	    0x125c, 0x2cdd, 0x0000, 0x2f57, 0x0000, 0x2018, 0x3045, 0x3646,
+	    0x0d48, 0x48c0, 0x1232, 0x2f6d, 0x40de, 0x406f, 0x1a90, 0x0000,
+	    0x1d75, 0x3fa7, 0x04e0, 0x0000, 0x42f3, 0x3b30, 0x4bbe, 0x0000,
+	    0x49d9, 0x461a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c6d,
+	    0x0000, 0x355b, 0x3218, 0x3eb8, 0x0000, 0x388d, 0x0000, 0x1eec,
+	    0x3acc, 0x0000, 0x3c61, 0x0000, 0x3b84, 0x0000, 0x11b2, 0x0000,
+	    0x0000, 0x1ae2, 0x0000, 0x3b12, 0x17c5, 0x4dff, 0x0000, 0x0a67,
+	    0x3b42, 0x227a, 0x0000, 0x2d43, 0x0000, 0x07e3, 0x2552, 0x332e,
+	    0x0000, 0x0555, 0x1d48, 0x01fc, 0x0000, 0x41d6, 0x3d7e, 0x0000,
+	    0x0000, 0x0000, 0x3c77, 0x0000, 0x0000, 0x4639, 0x0000, 0x0000,
+	    0x4734, 0x3095, 0x2972, 0x4754, 0x0000, 0x0000, 0x0000, 0x17d6,
+	    0x114c, 0x0000, 0x1588, 0x1dc2, 0x17d4, 0x0000, 0x4a8c, 0x39ed,
+	    0x0000, 0x19d5, 0x0246, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3e5a, 0x0aa4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x233c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080,
+	    0x0000, 0x1762, 0x270c, 0x071e, 0x15e2, 0x0000, 0x0000, 0x0000,
+	    0x131d, 0x0000, 0x4351, 0x0000, 0x0000, 0x0000, 0x0000, 0x07d1,
+	    0x0000, 0x0000, 0x2d9b, 0x03a4, 0x0000, 0x0000, 0x0000, 0x0f2b,
+	    0x0000, 0x0265, 0x287c, 0x0000, 0x0000, 0x0000, 0x0000, 0x420d,
+	    0x33e8, 0x3478, 0x0bfa, 0x0000, 0x3325, 0x3eb4, 0x0000, 0x0000,
+	    0x3104, 0x0000, 0x0000, 0x0000, 0x4a29, 0x0000, 0x325b, 0x0000,
+	    0x4c58, 0x09a9, 0x01dc, 0x3ad0, 0x0000, 0x1154, 0x29b1, 0x0000,
+	    0x0ce3, 0x0000, 0x2356, 0x3449, 0x0000, 0x0000, 0x0000, 0x3ed5,
+	    0x0000, 0x2657, 0x351a, 0x1790, 0x1549, 0x0000, 0x0000, 0x2ac7,
+	    0x3987, 0x3827, 0x4677, 0x24cf, 0x0488, 0x3084, 0x49d9, 0x22c0,
+	    0x0000, 0x4970, 0x0000, 0x45f9, 0x0000, 0x0000, 0x0458, 0x3f4d,
+	    0x446d, 0x0000, 0x060f, 0x0000, 0x0000, 0x2a10, 0x16dd, 0x38b4,
+	    0x0000, 0x0000, 0x1f49, 0x2e3a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x49d8, 0x0000, 0x0d97, 0x18f4, 0x0000, 0x3f95, 0x0000, 0x1c94,
+	    0x0000, 0x46e1, 0x2f3b, 0x3a80, 0x43c6, 0x4b1b, 0x12fa, 0x0000,
+	    0x4cb1, 0x0000, 0x1499, 0x0000, 0x2d6f, 0x0000, 0x0000, 0x0000,
+	    0x37d8, 0x1136, 0x221c, 0x4396, 0x4189, 0x0000, 0x0000, 0x0b2f,
+	    0x0000, 0x4624, 0x2ead, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x302f, 0x0000, 0x3769, 0x0000, 0x4c4f, 0x0000, 0x034c,
+	    0x0000, 0x0000, 0x0847, 0x309c, 0x0000, 0x49e1, 0x0f9b, 0x238e,
+	    0x0000, 0x4a4c, 0x189b, 0x3651, 0x0000, 0x0000, 0x2be0, 0x1543,
+	    0x46d2, 0x10fd, 0x0000, 0x00cc, 0x0000, 0x0000, 0x0000, 0x0b02,
+	    0x2a92, 0x0000, 0x220a, 0x3632, 0x19af, 0x0000, 0x0b27, 0x4257,
+	    0x0e79, 0x27fc, 0x0000, 0x0f2d, 0x4d57, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x237a, 0x0000, 0x0049, 0x0c9b, 0x1198, 0x2b4c,
+	    0x0934, 0x0461, 0x24d5, 0x3317, 0x3c20, 0x391e, 0x1840, 0x0000,
+	    0x3289, 0x087d, 0x2c0c, 0x0000, 0x4a2b, 0x2eee, 0x0000, 0x33cd,
+	    0x0000, 0x0000, 0x0000, 0x4a78, 0x41c7, 0x0000, 0x0070, 0x0000,
+	    0x4393, 0x19f3, 0x3bb1, 0x39fb, 0x25e3, 0x0000, 0x0000, 0x0e89,
+	    0x4298, 0x0949, 0x0000, 0x3186, 0x401f, 0x0000, 0x1ccc, 0x47e2,
+	    0x07d3, 0x49a4, 0x0000, 0x1620, 0x0000, 0x4988, 0x0000, 0x0000,
+	    0x3538, 0x1ead, 0x0000, 0x33a1, 0x2efc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1433, 0x0000, 0x3e69, 0x0000, 0x0000,
+	    0x4010, 0x0000, 0x0000, 0x0000, 0x2dd6, 0x0e7e, 0x0000, 0x08e5,
+	    0x0000, 0x0cad, 0x0000, 0x0bde, 0x31a4, 0x4949, 0x2aa9, 0x0000,
+	    0x0e32, 0x0000, 0x0000, 0x3a9e, 0x0000, 0x18b3, 0x0528, 0x0000,
+	    0x0000, 0x10a2, 0x0000, 0x0000, 0x2f45, 0x290b, 0x0000, 0x0000,
+	    0x37d6, 0x0000, 0x36ef, 0x405a, 0x0000, 0x3084, 0x0aa3, 0x0ae0,
+	    0x21f5, 0x3925, 0x45df, 0x0000, 0x2aec, 0x3c4d, 0x0000, 0x45b4,
+	    0x2403, 0x0000, 0x4985, 0x3ab0, 0x0000, 0x4c71, 0x01dd, 0x0000,
+	    0x0000, 0x307d, 0x0000, 0x1945, 0x0000, 0x02ca, 0x0000, 0x0000,
+	    0x3e10, 0x47e3, 0x1d31, 0x4466, 0x0000, 0x0230, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2b61, 0x498d, 0x4a90, 0x2e37, 0x0847, 0x1a6b,
+	    0x370b, 0x1d1a, 0x2a71, 0x12dc, 0x23db, 0x0000, 0x301d, 0x1a49,
+	    0x1bf3, 0x0000, 0x2a1a, 0x0000, 0x3303, 0x34bc, 0x322c, 0x2472,
+	    0x1c5d, 0x0000, 0x16fc, 0x0000, 0x0000, 0x3e39, 0x0000, 0x3353,
+	    0x23e7, 0x0000, 0x4db1, 0x0000, 0x240e, 0x0395, 0x0000, 0x0000,
+	    0x0000, 0x33a8, 0x0000, 0x48e4, 0x204b, 0x43d2, 0x405b, 0x214d,
+	    0x0000, 0x053d, 0x0000, 0x0000, 0x425c, 0x0000, 0x4504, 0x0000,
+	    0x0529, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b36, 0x0000, 0x4a00,
+	    0x0705, 0x0000, 0x0cf4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x257a, 0x0aef, 0x0000, 0x4c16, 0x035a, 0x2bad, 0x3a89, 0x06f8,
+	    0x0000, 0x0000, 0x18e5, 0x0000, 0x0000, 0x2be1, 0x0000, 0x0000,
+	    0x461f, 0x0000, 0x0000, 0x43bf, 0x4cf6, 0x13fe, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x08a4, 0x41eb, 0x0000, 0x3ce9,
+	    0x0000, 0x47ec, 0x0000, 0x0000, 0x0000, 0x1acd, 0x20fd, 0x0000,
+	    0x2f75, 0x1bd3, 0x0b81, 0x0000, 0x0000, 0x3253, 0x0f73, 0x4d9a,
+	    0x0000, 0x0000, 0x0000, 0x420f, 0x0000, 0x04ae, 0x0814, 0x03bc,
+	    0x0564, 0x389a, 0x0000, 0x1ba0, 0x26b2, 0x2cea, 0x43fd, 0x0000,
+	    0x0000, 0x20e4, 0x0000, 0x0000, 0x4174, 0x3841, 0x4805, 0x0000,
+	    0x0285, 0x0000, 0x01c8, 0x0795, 0x0ce0, 0x1fd0, 0x279a, 0x1cca,
+	    0x0000, 0x0000, 0x42bd, 0x02c8, 0x14b2, 0x0000, 0x3c5e, 0x0000,
+	    0x0000, 0x0000, 0x1a60, 0x0ddb, 0x3c37, 0x0d87, 0x0000, 0x0000,
+	    0x0000, 0x3ffa, 0x0000, 0x1377, 0x0127, 0x2d93, 0x0000, 0x4991,
+	    0x17d2, 0x0000, 0x3832, 0x2710, 0x0000, 0x188a, 0x0000, 0x0aad,
+	    0x11cb, 0x0000, 0x2aa7, 0x0000, 0x00f6, 0x02cd, 0x23f1, 0x48f8,
+	    0x0000, 0x2125, 0x3db4, 0x0000, 0x2052, 0x4d4a, 0x0000, 0x49f9,
+	    0x0000, 0x389c, 0x1d72, 0x0000, 0x4293, 0x4bfd, 0x3d86, 0x0000,
+	    0x0000, 0x0000, 0x057f, 0x0000, 0x2f7d, 0x0000, 0x0000, 0x0000,
+	    0x1700, 0x2479, 0x0000, 0x3ac6, 0x0000, 0x1846, 0x4c3a, 0x085f,
+	    0x0a78, 0x3050, 0x0000, 0x3fa2, 0x0000, 0x136b, 0x25d5, 0x2aa4,
+	    0x0000, 0x0786, 0x4583, 0x3f94, 0x0000, 0x0000, 0x09c8, 0x222e,
+	    0x3105, 0x2aaa, 0x163e, 0x0000, 0x0000, 0x0000, 0x0000, 0x009b,
+	    0x0000, 0x0ad5, 0x0000, 0x0000, 0x165a, 0x0000, 0x38b0, 0x0000,
+	    0x0000, 0x35ce, 0x0110, 0x297a, 0x0000, 0x40ee, 0x3a18, 0x0000,
+	    0x38e1, 0x0000, 0x3cb2, 0x43d7, 0x3441, 0x0000, 0x0000, 0x08eb,
+	    0x4c01, 0x27bc, 0x0000, 0x4c93, 0x0000, 0x1b9f, 0x2e90, 0x2c58,
+	    0x0246, 0x0000, 0x0b97, 0x2faf, 0x0000, 0x1273, 0x1d5c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0cb5, 0x2f26, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3d9e, 0x0000, 0x0000, 0x0000,
+	    0x4a02, 0x0000, 0x0000, 0x0000, 0x24e4, 0x0000, 0x0000, 0x33ba,
+	    0x0000, 0x0000, 0x0000, 0x266f, 0x0000, 0x0000, 0x0000, 0x1800,
+	    0x3e62, 0x0000, 0x32c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b0c,
+	    0x0000, 0x374e, 0x0000, 0x455f, 0x14e6, 0x2826, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02fe, 0x45b2, 0x0000, 0x0901, 0x0000, 0x0000,
+	    0x3389, 0x112e, 0x0000, 0x0193, 0x1b4a, 0x0180, 0x0000, 0x2065,
+	    0x0000, 0x1a36, 0x0353, 0x3942, 0x0081, 0x0000, 0x0340, 0x0000,
+	    0x0000, 0x3525, 0x4138, 0x0000, 0x2a25, 0x080d, 0x3db0, 0x31b5,
+	    0x0000, 0x0000, 0x3584, 0x0000, 0x204a, 0x0000, 0x0000, 0x4704,
+	    0x0000, 0x468d, 0x2bcc, 0x1045, 0x0000, 0x239e, 0x4531, 0x0000,
+	    0x34b6, 0x0e8b, 0x0000, 0x40e0, 0x0e5e, 0x11a4, 0x480a, 0x39ce,
+	    0x17ad, 0x0000, 0x0671, 0x0150, 0x05fb, 0x0000, 0x1b93, 0x1440,
+	    0x0000, 0x098b, 0x4591, 0x0000, 0x344d, 0x1d67, 0x2130, 0x0000,
+	    0x122c, 0x0000, 0x0000, 0x1e71, 0x0000, 0x3dc8, 0x1a6d, 0x155f,
+	    0x0000, 0x0000, 0x1f3d, 0x2196, 0x3374, 0x0000, 0x0000, 0x06fe,
+	    0x0000, 0x0492, 0x0000, 0x0000, 0x0000, 0x0000, 0x3dce, 0x1545,
+	    0x0000, 0x178f, 0x0000, 0x06ef, 0x0000, 0x30c9, 0x0000, 0x0000,
+	    0x1b5c, 0x09ca, 0x413d, 0x420c, 0x0000, 0x0000, 0x2617, 0x42b8,
+	    0x0000, 0x1a53, 0x3745, 0x0000, 0x0932, 0x0000, 0x3355, 0x145f,
+	    0x3484, 0x0000, 0x0000, 0x24a0, 0x0000, 0x0000, 0x321c, 0x0000,
+	    0x0b5e, 0x0000, 0x0000, 0x0000, 0x27c1, 0x2e0e, 0x0000, 0x0000,
+	    0x2725, 0x0000, 0x1382, 0x0000, 0x41f0, 0x0000, 0x3bcf, 0x48ca,
+	    0x2861, 0x0000, 0x0000, 0x0e68, 0x0000, 0x0000, 0x0000, 0x1fc0,
+	    0x206f, 0x0bd3, 0x0000, 0x1191, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x135f, 0x2a85, 0x24e4, 0x4d97, 0x027b, 0x0000, 0x429e, 0x3000,
+	    0x168e, 0x134f, 0x0000, 0x44d7, 0x2722, 0x4190, 0x41b4, 0x0000,
+	    0x2ef5, 0x434a, 0x0000, 0x1fbb, 0x0000, 0x0326, 0x1fae, 0x0000,
+	    0x0000, 0x0000, 0x363a, 0x31e2, 0x0000, 0x1df8, 0x0000, 0x0000,
+	    0x4957, 0x0000, 0x1a05, 0x39ef, 0x3b15, 0x0000, 0x0000, 0x4ae1,
+	    0x2add, 0x0489, 0x0000, 0x1ff7, 0x34f8, 0x42bc, 0x0000, 0x2ec5,
+	    0x0000, 0x0000, 0x0000, 0x2dd4, 0x2ae3, 0x2a9f, 0x0b16, 0x3d46,
+	    0x02a9, 0x0000, 0x2763, 0x2800, 0x2b57, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x23c8, 0x160c, 0x0701, 0x4392,
+	    0x0000, 0x2637, 0x0cee, 0x0544, 0x2fd0, 0x4835, 0x00d6, 0x1f2d,
+	    0x291b, 0x0000, 0x1bf0, 0x0000, 0x0018, 0x0ff2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x06ba, 0x0000, 0x04a5, 0x21f9, 0x0000,
+	    0x0000, 0x0000, 0x12f4, 0x4dce, 0x3764, 0x0000, 0x47b4, 0x3b2e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x090a, 0x0000, 0x0000,
+	    0x0000, 0x1833, 0x434d, 0x3d3e, 0x1b73, 0x1649, 0x2352, 0x0467,
+	    0x2d7c, 0x00a7, 0x33c5, 0x266b, 0x25ab, 0x0000, 0x1d1a, 0x0000,
+	    0x0d8c, 0x0000, 0x0000, 0x097f, 0x2e3c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x31e5, 0x03a5, 0x0000, 0x0000, 0x177a, 0x4986, 0x0000,
+	    0x0000, 0x4b2d, 0x0000, 0x0000, 0x3fbb, 0x1d4f, 0x3f7f, 0x150a,
+	    0x303a, 0x0000, 0x0000, 0x0000, 0x3d19, 0x0000, 0x4645, 0x3219,
+	    0x48a0, 0x0000, 0x0000, 0x0e07, 0x0000, 0x0c02, 0x02b6, 0x0000,
+	    0x0000, 0x2d66, 0x3b02, 0x0000, 0x4c2a, 0x2308, 0x0000, 0x0000,
+	    0x2f92, 0x0000, 0x0000, 0x0000, 0x46e0, 0x110d, 0x0bd3, 0x0bce,
+	    0x0000, 0x005c, 0x0807, 0x2694, 0x0000, 0x1bdf, 0x1e3f, 0x0000,
+	    0x019b, 0x1cc0, 0x0119, 0x3245, 0x0000, 0x43d6, 0x2c96, 0x2b46,
+	    0x0000, 0x4213, 0x39e1, 0x0000, 0x0000, 0x0000, 0x0b94, 0x0000,
+	    0x0a11, 0x1f33, 0x01e2, 0x35c3, 0x0000, 0x3dfd, 0x3dbb, 0x04b4,
+	    0x0000, 0x0a4b, 0x0000, 0x2fb8, 0x13f9, 0x4e03, 0x0000, 0x0000,
+	    0x0000, 0x3f9a, 0x2e77, 0x0000, 0x4a1d, 0x0b80, 0x2f7c, 0x4281,
+	    0x3ace, 0x2785, 0x4c55, 0x2658, 0x38d9, 0x0000, 0x1289, 0x2207,
+	    0x0000, 0x0000, 0x0000, 0x3a46, 0x2146, 0x3913, 0x0000, 0x0000,
+	    0x0000, 0x4726, 0x3f9d, 0x3119, 0x3cc5, 0x4c5d, 0x0000, 0x20f4,
+	    0x1cc1, 0x29fd, 0x0000, 0x0d00, 0x1682, 0x094f, 0x0000, 0x4993,
+	    0x082e, 0x0000, 0x0000, 0x44e2, 0x0000, 0x0f5a, 0x0000, 0x4c32,
+	    0x0000, 0x0000, 0x2dc9, 0x0000, 0x0000, 0x2185, 0x0000, 0x1aca,
+	    0x4ae0, 0x3f5c, 0x0000, 0x0000, 0x1f0b, 0x0000, 0x1bc0, 0x43fe,
+	    0x439b, 0x31fa, 0x0000, 0x2108, 0x0daa, 0x01bc, 0x010c, 0x0000,
+	    0x0000, 0x37c1, 0x3268, 0x0000, 0x0000, 0x0000, 0x393b, 0x2a3e,
+	    0x209d, 0x02a2, 0x0000, 0x0000, 0x24bf, 0x0000, 0x0000, 0x342f,
+	    0x3ea3, 0x0000, 0x00cc, 0x31e7, 0x0000, 0x47bd, 0x0000, 0x3496,
+	    0x440b, 0x0000, 0x0000, 0x0000, 0x1dc5, 0x30ef, 0x0000, 0x003c,
+	    0x126f, 0x1bd0, 0x0000, 0x34ad, 0x0000, 0x0000, 0x3f9a, 0x224c,
+	    0x3130, 0x401f, 0x0000, 0x0000, 0x0000, 0x0f19, 0x38b0, 0x474c,
+	    0x378b, 0x349e, 0x0000, 0x16e3, 0x0000, 0x3ad3, 0x2338, 0x00e5,
+	    0x0000, 0x305a, 0x3dfb, 0x0000, 0x0000, 0x48d3, 0x05db, 0x0000,
+	    0x0000, 0x4032, 0x3510, 0x2f74, 0x0000, 0x0000, 0x0000, 0x4c39,
+	    0x0000, 0x0000, 0x2d4f, 0x432c, 0x0000, 0x2069, 0x21a4, 0x4d6f,
+	    0x27af, 0x0000, 0x0000, 0x3365, 0x0000, 0x0000, 0x0000, 0x4357,
+	    0x3b80, 0x244a, 0x0000, 0x0000, 0x34a4, 0x2f52, 0x1533, 0x0000,
+	    0x0000, 0x1f08, 0x2e57, 0x388d, 0x0000, 0x3d78, 0x2ab8, 0x1cfc,
+	    0x0000, 0x0cd8, 0x0000, 0x156b, 0x0458, 0x0000, 0x035e, 0x2bdf,
+	    0x1bed, 0x00d8, 0x0000, 0x3388, 0x110f, 0x0000, 0x0000, 0x0000,
+	    0x3e0f, 0x1bbf, 0x0ce3, 0x0193, 0x0000, 0x0000, 0x3a30, 0x0000,
+	    0x0d12, 0x2a6d, 0x0000, 0x1d48, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x30bf, 0x0000, 0x3b2c, 0x0000, 0x0000, 0x0000,
+	    0x4a2a, 0x1a2b, 0x0000, 0x31aa, 0x0000, 0x4b63, 0x32ee, 0x2324,
+	    0x43e2, 0x0000, 0x0000, 0x0000, 0x38c2, 0x342e, 0x0000, 0x0006,
+	    0x0000, 0x0000, 0x397d, 0x0000, 0x35c6, 0x2fcb, 0x3be0, 0x0000,
+	    0x1393, 0x387e, 0x20b3, 0x0000, 0x05fb, 0x27b8, 0x0000, 0x0000,
+	    0x3c48, 0x0000, 0x411e, 0x0000, 0x0000, 0x29df, 0x4514, 0x0000,
+	    0x014b, 0x3124, 0x0000, 0x2659, 0x03a4, 0x0110, 0x16c6, 0x0000,
+	    0x37cd, 0x0000, 0x0000, 0x35af, 0x0e7f, 0x4d84, 0x2ab8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2ef8, 0x01f8, 0x04f6, 0x27c6, 0x1c43,
+	    0x1ed4, 0x0000, 0x1bb8, 0x0000, 0x2377, 0x0000, 0x08e2, 0x0000,
+	    0x0000, 0x4bf8, 0x0000, 0x496d, 0x0000, 0x0000, 0x4015, 0x0000,
+	    0x3c8e, 0x25eb, 0x0ea2, 0x3f6c, 0x0000, 0x0000, 0x3cbc, 0x25fb,
+	    0x3d11, 0x09dc, 0x0000, 0x0000, 0x1b31, 0x28ac, 0x0000, 0x3a93,
+	    0x1fb7, 0x017f, 0x0000, 0x0000, 0x0d71, 0x428d, 0x0000, 0x0000,
+	    0x36ba, 0x0000, 0x4983, 0x2c29, 0x0000, 0x1370, 0x0156, 0x0000,
+	    0x3a50, 0x26cf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x25e8, 0x456c, 0x0000, 0x36f6, 0x0f98, 0x3869, 0x4495, 0x0000,
+	    0x17ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x056c, 0x0000,
+	    0x0000, 0x48f4, 0x0000, 0x3380, 0x228d, 0x1e35, 0x0000, 0x483e,
+	    0x00fe, 0x0000, 0x0842, 0x0000, 0x06c6, 0x0000, 0x0000, 0x289b,
+	    0x1475, 0x4a57, 0x1c40, 0x051a, 0x2196, 0x0000, 0x1ad6, 0x4283,
+	    0x42c8, 0x0000, 0x04db, 0x0000, 0x0000, 0x04bb, 0x1c4c, 0x0000,
+	    0x1a60, 0x0000, 0x3266, 0x1a3d, 0x410a, 0x1091, 0x0000, 0x08f0,
+	    0x0000, 0x4681, 0x2539, 0x36f0, 0x0ccb, 0x46e1, 0x34d9, 0x0000,
+	    0x2c36, 0x001f, 0x46e7, 0x1933, 0x0fa8, 0x2b40, 0x0000, 0x051a,
+	    0x1957, 0x4789, 0x05e4, 0x0000, 0x0000, 0x2189, 0x0000, 0x142b,
+	    0x44ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x3753, 0x13fd, 0x0000,
+	    0x1a38, 0x0000, 0x0000, 0x3aad, 0x0000, 0x2652, 0x2ac7, 0x0000,
+	    0x1066, 0x0000, 0x0000, 0x0000, 0x18de, 0x4870, 0x4286, 0x0000,
+	    0x1075, 0x0000, 0x0000, 0x0000, 0x07fa, 0x1335, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4386, 0x2a89, 0x0000, 0x0000, 0x3f72, 0x0000,
+	    0x316a, 0x1945, 0x2a12, 0x3983, 0x3e58, 0x0000, 0x0000, 0x48b2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2489, 0x22b1, 0x34e2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bc3, 0x0000,
+	    0x324d, 0x1930, 0x0000, 0x0000, 0x462e, 0x1226, 0x059c, 0x0000,
+	    0x386c, 0x0000, 0x0000, 0x47c8, 0x0000, 0x3b82, 0x0000, 0x22e5,
+	    0x4de8, 0x3bfa, 0x0000, 0x0000, 0x31f8, 0x0000, 0x3a39, 0x24ee,
+	    0x0000, 0x45c8, 0x0000, 0x1351, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2ed1, 0x0f44, 0x0000, 0x0000, 0x0000, 0x4c78, 0x0000, 0x2a0f,
+	    0x1a1a, 0x4341, 0x0000, 0x1c16, 0x1779, 0x039e, 0x37bf, 0x0000,
+	    0x04db, 0x4a0d, 0x0000, 0x0304, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1932, 0x2145, 0x354a, 0x197f, 0x1d4a, 0x46c0, 0x4d60, 0x0000,
+	    0x2e3f, 0x0000, 0x0928, 0x07a6, 0x05b3, 0x31ad, 0x0000, 0x0000,
+	    0x13ef, 0x0000, 0x206f, 0x0000, 0x0000, 0x0000, 0x37dd, 0x0000,
+	    0x0000, 0x1eb1, 0x0000, 0x0000, 0x0000, 0x0f4b, 0x0000, 0x36ed,
+	    0x0000, 0x11f5, 0x219f, 0x175a, 0x0000, 0x0000, 0x235e, 0x0000,
+	    0x0000, 0x3c6f, 0x002b, 0x3f3d, 0x0000, 0x0000, 0x03a0, 0x0000,
+	    0x0000, 0x22e2, 0x0000, 0x1e6e, 0x4205, 0x0000, 0x2d78, 0x0000,
+	    0x051d, 0x0000, 0x0000, 0x0051, 0x0000, 0x0000, 0x028f, 0x03a8,
+	    0x380f, 0x4d79, 0x0bfe, 0x0000, 0x0000, 0x0000, 0x09be, 0x0000,
+	    0x278e, 0x34a1, 0x1dcf, 0x0000, 0x349b, 0x088f, 0x015f, 0x0000,
+	    0x0000, 0x0000, 0x124c, 0x0c25, 0x2239, 0x1b00, 0x0000, 0x0000,
+	    0x0000, 0x053b, 0x0000, 0x0000, 0x3a5d, 0x27c8, 0x4d3d, 0x0000,
+	    0x0000, 0x159c, 0x4a61, 0x14ec, 0x0000, 0x0000, 0x0000, 0x460b,
+	    0x0000, 0x3eea, 0x0000, 0x275e, 0x0000, 0x17f6, 0x3270, 0x0000,
+	    0x0000, 0x0000, 0x3e65, 0x0000, 0x106e, 0x195a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x441d, 0x2758, 0x2482, 0x3aed, 0x378e,
+	    0x48ca, 0x456d, 0x4650, 0x205a, 0x361f, 0x0417, 0x1f32, 0x0000,
+	    0x0925, 0x30f6, 0x2fc1, 0x130c, 0x0000, 0x3caa, 0x34e9, 0x150b,
+	    0x3698, 0x1c3d, 0x0000, 0x0000, 0x37aa, 0x3768, 0x22af, 0x4b8b,
+	    0x1360, 0x0000, 0x0290, 0x4ded, 0x0000, 0x0000, 0x2e42, 0x0000,
+	    0x089e, 0x0000, 0x0000, 0x0000, 0x2b73, 0x3495, 0x32bf, 0x1faf,
+	    0x17eb, 0x0000, 0x4c47, 0x0000, 0x0000, 0x0000, 0x19e0, 0x0000,
+	    0x48c6, 0x12e8, 0x0000, 0x46c8, 0x0000, 0x0016, 0x0069, 0x320f,
+	    0x3e75, 0x0000, 0x4c6d, 0x37e6, 0x2e95, 0x39d1, 0x0000, 0x0626,
+	    0x2541, 0x0000, 0x22b6, 0x12ec, 0x203a, 0x1d4b, 0x4804, 0x20f3,
+	    0x46dc, 0x3f9b, 0x15d0, 0x3c18, 0x069a, 0x0000, 0x0000, 0x49a6,
+	    0x0000, 0x48db, 0x40cf, 0x0000, 0x07ca, 0x0000, 0x0000, 0x22ff,
+	    0x4ad6, 0x3345, 0x33c9, 0x4603, 0x0000, 0x3ee8, 0x0000, 0x315e,
+	    0x0000, 0x0000, 0x17c8, 0x0000, 0x129c, 0x01f9, 0x0000, 0x2871,
+	    0x324d, 0x0000, 0x3586, 0x1535, 0x44b8, 0x39bc, 0x0000, 0x3fe2,
+	    0x4639, 0x0000, 0x0539, 0x0000, 0x1cc2, 0x0000, 0x236e, 0x2640,
+	    0x0000, 0x1129, 0x43fc, 0x0000, 0x0768, 0x2b9f, 0x0000, 0x0000,
+	    0x0000, 0x2caf, 0x0000, 0x209b, 0x0000, 0x0652, 0x0f08, 0x0000,
+	    0x0000, 0x2a6f, 0x38d9, 0x2103, 0x337b, 0x0000, 0x12f7, 0x321f,
+	    0x0000, 0x0c50, 0x225c, 0x3248, 0x2714, 0x0000, 0x3f1b, 0x22cc,
+	    0x0000, 0x17bb, 0x0000, 0x2ef4, 0x2dec, 0x0000, 0x0000, 0x38d6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x458c, 0x0000, 0x1bc1,
+	    0x0000, 0x444d, 0x3cc3, 0x2ed7, 0x0000, 0x4194, 0x0000, 0x0685,
+	    0x2238, 0x4c14, 0x0000, 0x0000, 0x2a2d, 0x2a4e, 0x047f, 0x15e2,
+	    0x0000, 0x0000, 0x2c31, 0x0000, 0x1146, 0x0000, 0x0000, 0x0000,
+	    0x3f6c, 0x0ef3, 0x1cd7, 0x4a39, 0x3624, 0x3214, 0x0000, 0x0629,
+	    0x3983, 0x0000, 0x1007, 0x273a, 0x0000, 0x0000, 0x0000, 0x3854,
+	    0x0000, 0x2574, 0x315f, 0x4bb4, 0x4cee, 0x487b, 0x215a, 0x0000,
+	    0x0552, 0x1056, 0x0000, 0x0000, 0x29a3, 0x0000, 0x0000, 0x37c3,
+	    0x10f0, 0x0000, 0x0000, 0x3668, 0x41f9, 0x2e64, 0x1cfb, 0x0000,
+	    0x1a19, 0x3f79, 0x0000, 0x3935, 0x0000, 0x0000, 0x03e9, 0x0000,
+	    0x0000, 0x0899, 0x0000, 0x38e2, 0x3321, 0x3bb0, 0x0003, 0x0af2,
+	    0x4050, 0x3978, 0x4be1, 0x1e0f, 0x2209, 0x16b6, 0x0000, 0x0000,
+	    0x0000, 0x44b2, 0x0000, 0x0ca6, 0x0000, 0x0049, 0x4109, 0x0000,
+	    0x4bc2, 0x0000, 0x218f, 0x0000, 0x097a, 0x257e, 0x4cc8, 0x13f3,
+	    0x1712, 0x2d23, 0x34bb, 0x3538, 0x0849, 0x44a7, 0x1595, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x45dc, 0x19d7, 0x0000, 0x1804, 0x0000,
+	    0x0000, 0x0000, 0x45e9, 0x342f, 0x190f, 0x4095, 0x0000, 0x38d1,
+	    0x1bcc, 0x00a3, 0x44ef, 0x0064, 0x2c75, 0x0000, 0x058b, 0x45b9,
+	    0x4190, 0x0266, 0x3776, 0x0000, 0x2c55, 0x01de, 0x3e03, 0x1f18,
+	    0x0000, 0x43e4, 0x0000, 0x4da5, 0x22c5, 0x09f2, 0x0000, 0x3a89,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x027a, 0x2741, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4c0c, 0x4144, 0x2c4f, 0x0000, 0x40dd,
+	    0x1059, 0x21f5, 0x0000, 0x0000, 0x418a, 0x0000, 0x0000, 0x0000,
+	    0x2fcf, 0x0000, 0x177f, 0x01eb, 0x18bb, 0x3511, 0x3944, 0x1234,
+	    0x1818, 0x0000, 0x3068, 0x2842, 0x1a7f, 0x4579, 0x1d6f, 0x0000,
+	    0x2532, 0x105e, 0x0000, 0x0000, 0x4167, 0x0000, 0x394f, 0x0000,
+	    0x0000, 0x0f06, 0x0000, 0x0000, 0x0000, 0x05cc, 0x0000, 0x0062,
+	    0x0000, 0x1dd6, 0x3b46, 0x3255, 0x216b, 0x28da, 0x0e39, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x339e, 0x0000, 0x2257, 0x2c0e, 0x0000,
+	    0x0000, 0x0000, 0x289d, 0x0000, 0x0000, 0x01ad, 0x1464, 0x4580,
+	    0x40a5, 0x148f, 0x495c, 0x3c12, 0x11b7, 0x0000, 0x4d48, 0x1dad,
+	    0x34cf, 0x4ba0, 0x0000, 0x0000, 0x286a, 0x2491, 0x0009, 0x0000,
+	    0x0000, 0x4b0e, 0x0000, 0x2484, 0x32c2, 0x33a4, 0x0000, 0x0000,
+	    0x0d45, 0x0000, 0x3bcb, 0x2616, 0x354e, 0x2802, 0x2de4, 0x4958,
+	    0x0275, 0x3813, 0x0089, 0x0000, 0x0c05, 0x39a2, 0x32f8, 0x42e7,
+	    0x0000, 0x0000, 0x3566, 0x0000, 0x0602, 0x3670, 0x0000, 0x41f4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x40a0, 0x19f3, 0x0000, 0x0000,
+	    0x1128, 0x0000, 0x0000, 0x3fe7, 0x3d43, 0x0000, 0x0bd3, 0x0000,
+	    0x3e61, 0x0cfb, 0x0000, 0x03b2, 0x1c60, 0x2199, 0x0000, 0x0000,
+	    0x0000, 0x488a, 0x0000, 0x2762, 0x09ff, 0x0000, 0x0000, 0x0000,
+	    0x464e, 0x3d17, 0x2149, 0x0000, 0x0e9a, 0x0000, 0x1d56, 0x2c49,
+	    0x2bf6, 0x059d, 0x0000, 0x3021, 0x2c7e, 0x4ca0, 0x0000, 0x0bf3,
+	    0x0000, 0x4a35, 0x0000, 0x0000, 0x0000, 0x0000, 0x45ef, 0x0000,
+	    0x1642, 0x0000, 0x0000, 0x4bbf, 0x1d8d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0deb, 0x2e5e, 0x1fc2, 0x0000, 0x221e, 0x0000, 0x2fe7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x31b1, 0x0000, 0x1c76, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2470, 0x0000, 0x1c99, 0x0000, 0x0000,
+	    0x040e, 0x0000, 0x4ca6, 0x1be6, 0x11cd, 0x0f4c, 0x0000, 0x0000,
+	    0x034a, 0x0000, 0x0000, 0x4a00, 0x0445, 0x2c7b, 0x4268, 0x0000,
+	    0x1698, 0x0000, 0x0000, 0x3ed0, 0x0000, 0x0000, 0x21b6, 0x0000,
+	    0x0000, 0x2ea7, 0x1f4d, 0x49d1, 0x0000, 0x0bbe, 0x0128, 0x1dc0,
+	    0x167d, 0x09c7, 0x14ac, 0x37fd, 0x2d47, 0x43ef, 0x2e6a, 0x39a6,
+	    0x2ff0, 0x0000, 0x0000, 0x4406, 0x0a9a, 0x345e, 0x49f4, 0x0000,
+	    0x0000, 0x1c58, 0x1bbf, 0x02f5, 0x3616, 0x0553, 0x31a0, 0x0000,
+	    0x0000, 0x0502, 0x393e, 0x25b3, 0x0211, 0x2218, 0x13a8, 0x43a1,
+	    0x0000, 0x1cda, 0x204b, 0x21c9, 0x0000, 0x07e6, 0x022a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4adf, 0x4349, 0x1b53, 0x0000, 0x14ee,
+	    0x1f28, 0x044e, 0x0000, 0x0000, 0x4ab8, 0x0000, 0x36aa, 0x0000,
+	    0x3ecd, 0x0000, 0x1032, 0x2495, 0x4114, 0x0f51, 0x33ab, 0x1fea,
+	    0x2cc0, 0x27c7, 0x238f, 0x3666, 0x22c8, 0x0000, 0x20ac, 0x098c,
+	    0x48d1, 0x0000, 0x0000, 0x4c49, 0x0000, 0x30d7, 0x0000, 0x0657,
+	    0x0000, 0x0a89, 0x0000, 0x06c6, 0x0000, 0x013c, 0x0000, 0x0000,
+	    0x0000, 0x1505, 0x0ef9, 0x1ac9, 0x0000, 0x0586, 0x0000, 0x28ca,
+	    0x0000, 0x0000, 0x3279, 0x2c9c, 0x163c, 0x0000, 0x45c3, 0x0000,
+	    0x0000, 0x4c45, 0x3e9c, 0x4548, 0x1477, 0x0e75, 0x0000, 0x0000,
+	    0x0000, 0x154e, 0x3a2b, 0x0000, 0x0000, 0x1024, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ef3, 0x0000, 0x2fc3, 0x09d4, 0x14f7, 0x3ee2,
+	    0x2528, 0x346b, 0x0000, 0x16e7, 0x3bbd, 0x412b, 0x0000, 0x0000,
+	    0x4454, 0x0000, 0x0377, 0x0e21, 0x1b8c, 0x0000, 0x2366, 0x0000,
+	    0x3cb4, 0x33c6, 0x0000, 0x0000, 0x303a, 0x2933, 0x4c88, 0x3b0d,
+	    0x3e93, 0x2ec8, 0x1595, 0x352d, 0x387b, 0x0000, 0x0000, 0x3564,
+	    0x0000, 0x0000, 0x4242, 0x02cc, 0x3503, 0x0c77, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4d8d, 0x2f8f, 0x0000, 0x4be8, 0x29c2,
+	    0x0000, 0x4233, 0x3dc7, 0x038e, 0x1330, 0x345b, 0x0000, 0x47b0,
+	    0x2a08, 0x2ac3, 0x0000, 0x0000, 0x1860, 0x32cf, 0x1bbc, 0x4979,
+	    0x0000, 0x1229, 0x0000, 0x3999, 0x2708, 0x2b40, 0x40fd, 0x2431,
+	    0x2916, 0x0000, 0x0000, 0x4a4a, 0x4d8c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1166, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f39, 0x2163,
+	    0x21f8, 0x0000, 0x0f90, 0x2f9f, 0x03b0, 0x46ad, 0x045b, 0x07b6,
+	    0x0a4e, 0x2e2c, 0x3546, 0x0000, 0x0000, 0x1a73, 0x0000, 0x0000,
+	    0x2443, 0x0000, 0x28d2, 0x0000, 0x0000, 0x0043, 0x0000, 0x410c,
+	    0x4dd9, 0x0000, 0x2e4a, 0x04d6, 0x0000, 0x21cc, 0x0000, 0x448a,
+	    0x122f, 0x2e45, 0x26c6, 0x1e06, 0x1563, 0x2afe, 0x0000, 0x0000,
+	    0x24f3, 0x0000, 0x0000, 0x0000, 0x1188, 0x1951, 0x0000, 0x0000,
+	    0x31f8, 0x0000, 0x03bf, 0x0000, 0x0000, 0x0000, 0x0abd, 0x0000,
+	    0x0149, 0x4bb7, 0x0000, 0x08b8, 0x0000, 0x29ca, 0x16e9, 0x41ef,
+	    0x0000, 0x0000, 0x0000, 0x4a7c, 0x12d0, 0x233b, 0x1d64, 0x17df,
+	    0x0000, 0x4a40, 0x0000, 0x26a6, 0x0000, 0x0000, 0x44e6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3d52, 0x0000, 0x3bf3, 0x3516,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x40ce, 0x1121, 0x136f, 0x0000,
+	    0x1c05, 0x0000, 0x0000, 0x342a, 0x2d29, 0x2306, 0x0b8e, 0x0000,
+	    0x438a, 0x0000, 0x1256, 0x04c8, 0x0000, 0x0000, 0x0000, 0x2b0b,
+	    0x364c, 0x0000, 0x0bcb, 0x0533, 0x0000, 0x2efe, 0x200e, 0x0000,
+	    0x0000, 0x2fc7, 0x49fe, 0x1b11, 0x3a3a, 0x41c8, 0x0000, 0x22f6,
+	    0x0000, 0x0000, 0x1dfc, 0x09d5, 0x0000, 0x3b40, 0x4be2, 0x26ac,
+	    0x0000, 0x11e0, 0x199a, 0x00d3, 0x08cb, 0x2df2, 0x0000, 0x326e,
+	    0x230d, 0x0000, 0x3235, 0x0f1c, 0x369e, 0x134f, 0x0000, 0x0000,
+	    0x3b6e, 0x03ea, 0x3dd1, 0x0000, 0x343d, 0x1ce4, 0x37cb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24da, 0x0000, 0x318e, 0x0000, 0x3958,
+	    0x0000, 0x0f14, 0x3d08, 0x0bd4, 0x0000, 0x1a1f, 0x0000, 0x2823,
+	    0x14ce, 0x44e7, 0x0000, 0x3f2d, 0x0000, 0x4cac, 0x0000, 0x1625,
+	    0x0000, 0x0000, 0x35c1, 0x1e0f, 0x26eb, 0x2481, 0x01bd, 0x0000,
+	    0x0000, 0x13c2, 0x0000, 0x2648, 0x1dc1, 0x0000, 0x0000, 0x49d7,
+	    0x1ae7, 0x2a81, 0x0000, 0x2c3c, 0x3ff3, 0x46e4, 0x0000, 0x0000,
+	    0x0cd8, 0x179e, 0x27f6, 0x08e9, 0x0000, 0x22fc, 0x0ef6, 0x3592,
+	    0x0000, 0x00f0, 0x0c61, 0x3264, 0x0a73, 0x4318, 0x0000, 0x0000,
+	    0x2b7b, 0x0000, 0x45b5, 0x0000, 0x0000, 0x0000, 0x46fa, 0x1fa8,
+	    0x0000, 0x0000, 0x3e0d, 0x0000, 0x0000, 0x0000, 0x0000, 0x4100,
+	    0x2a20, 0x3d01, 0x0000, 0x0000, 0x0000, 0x1e69, 0x0000, 0x086c,
+	    0x0000, 0x0000, 0x1a4b, 0x3a8f, 0x4d3b, 0x3075, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1845, 0x0000, 0x0000, 0x3711, 0x0000,
+	    0x0000, 0x4412, 0x0a21, 0x26c8, 0x014d, 0x0000, 0x0578, 0x462d,
+	    0x0000, 0x0000, 0x14c8, 0x3441, 0x0000, 0x33e3, 0x17fc, 0x2311,
+	    0x0000, 0x0000, 0x0000, 0x05d7, 0x327f, 0x2a1b, 0x23bb, 0x0000,
+	    0x0d86, 0x0000, 0x3aa5, 0x4cf6, 0x1319, 0x230a, 0x0000, 0x02ae,
+	    0x00f6, 0x247c, 0x0000, 0x4bc9, 0x3b28, 0x0000, 0x0546, 0x0000,
+	    0x0470, 0x2816, 0x20fa, 0x0000, 0x0982, 0x3719, 0x192d, 0x1637,
+	    0x0000, 0x0000, 0x00d1, 0x0000, 0x11be, 0x0000, 0x0000, 0x0980,
+	    0x179f, 0x417e, 0x1f0a, 0x06af, 0x0000, 0x38c0, 0x0000, 0x0ebb,
+	    0x1042, 0x2a73, 0x1b5d, 0x0814, 0x0000, 0x0000, 0x4444, 0x3372,
+	    0x1f9f, 0x22b8, 0x3768, 0x1b4f, 0x230f, 0x2b59, 0x3840, 0x0ddb,
+	    0x228b, 0x4d2c, 0x3223, 0x0000, 0x0000, 0x0000, 0x4d5d, 0x44dc,
+	    0x1642, 0x3b3c, 0x0337, 0x0000, 0x0a20, 0x4098, 0x0000, 0x4818,
+	    0x072c, 0x0000, 0x0000, 0x12c8, 0x0000, 0x2a88, 0x4b5c, 0x0000,
+	    0x0931, 0x36cc, 0x3be7, 0x1c65, 0x0000, 0x0000, 0x19bd, 0x4102,
+	    0x0000, 0x4d60, 0x3914, 0x0e8c, 0x1b99, 0x2ec1, 0x150e, 0x0000,
+	    0x0000, 0x224b, 0x3200, 0x0c01, 0x49ee, 0x2191, 0x0000, 0x2baa,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3835, 0x0000, 0x0000, 0x0000,
+	    0x1a51, 0x0000, 0x36ce, 0x2b52, 0x0000, 0x1be9, 0x34b8, 0x4618,
+	    0x0000, 0x0000, 0x24bd, 0x0a46, 0x3351, 0x2e5c, 0x17f6, 0x0000,
+	    0x1052, 0x3363, 0x0000, 0x24b7, 0x0000, 0x0c20, 0x0000, 0x16cb,
+	    0x45ea, 0x0000, 0x09c2, 0x2d4b, 0x353a, 0x16bd, 0x4af9, 0x0000,
+	    0x1253, 0x0000, 0x14a8, 0x3733, 0x033e, 0x0000, 0x0000, 0x04be,
+	    0x00cf, 0x19ca, 0x12ea, 0x09d1, 0x438e, 0x20ea, 0x0000, 0x0000,
+	    0x28b2, 0x04aa, 0x0000, 0x0391, 0x2387, 0x2f46, 0x1874, 0x26f3,
+	    0x3471, 0x4787, 0x0000, 0x0000, 0x0000, 0x4601, 0x39ee, 0x0434,
+	    0x0000, 0x0000, 0x442c, 0x0062, 0x26d3, 0x0000, 0x0000, 0x0561,
+	    0x450e, 0x23f7, 0x10e0, 0x1584, 0x0000, 0x2847, 0x0000, 0x0dfd,
+	    0x0000, 0x0000, 0x464b, 0x46b7, 0x0000, 0x0000, 0x0000, 0x00ac,
+	    0x0000, 0x410c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x227a, 0x2383, 0x413c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2dfb, 0x0000, 0x11ce, 0x0000, 0x0000, 0x204f,
+	    0x187e, 0x2852, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a11, 0x0000,
+	    0x0000, 0x2c64, 0x423d, 0x0c89, 0x2b09, 0x2651, 0x2989, 0x2179,
+	    0x02fc, 0x30b6, 0x272b, 0x0000, 0x0000, 0x2e9d, 0x485a, 0x16f2,
+	    0x1693, 0x420f, 0x32ef, 0x159d, 0x1bb2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4845, 0x1b25, 0x187d, 0x0000, 0x0000,
+	    0x1854, 0x0cad, 0x26fa, 0x0000, 0x1537, 0x0dde, 0x2ec4, 0x0d5b,
+	    0x3545, 0x0000, 0x0341, 0x3cfd, 0x0000, 0x20f4, 0x3f36, 0x3e8f,
+	    0x0000, 0x0000, 0x1930, 0x0000, 0x4418, 0x00d7, 0x2348, 0x0000,
+	    0x2a10, 0x0000, 0x0000, 0x2c14, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0c67, 0x0000, 0x4d0c, 0x0000, 0x2d5d, 0x078a, 0x0000,
+	    0x064c, 0x0000, 0x1a90, 0x2f3a, 0x0000, 0x2973, 0x0000, 0x2460,
+	    0x3b6e, 0x0000, 0x1425, 0x0b22, 0x1f3f, 0x31c8, 0x0000, 0x3c57,
+	    0x0000, 0x0000, 0x0000, 0x2c27, 0x3d1e, 0x0000, 0x0000, 0x0000,
+	    0x26de, 0x217b, 0x0000, 0x1e88, 0x0000, 0x4ab5, 0x4680, 0x0000,
+	    0x07e0, 0x1303, 0x0000, 0x0000, 0x3c9f, 0x480a, 0x37f4, 0x1c88,
+	    0x3be2, 0x03fb, 0x30c7, 0x0000, 0x005c, 0x0dc0, 0x17b2, 0x29bc,
+	    0x2bca, 0x0000, 0x0000, 0x0000, 0x0000, 0x22dd, 0x01c6, 0x447a,
+	    0x0000, 0x0989, 0x0000, 0x0000, 0x0000, 0x0000, 0x4bae, 0x26dd,
+	    0x0075, 0x311c, 0x10e3, 0x4c19, 0x1101, 0x0000, 0x347f, 0x0000,
+	    0x4a46, 0x4174, 0x0000, 0x09da, 0x0000, 0x0000, 0x2e80, 0x1d71,
+	    0x133d, 0x1637, 0x37f4, 0x0000, 0x30bc, 0x1aeb, 0x32a8, 0x3717,
+	    0x4082, 0x0000, 0x0669, 0x0000, 0x281f, 0x1532, 0x4ab8, 0x0000,
+	    0x0000, 0x0000, 0x3884, 0x37a4, 0x27fd, 0x284e, 0x0000, 0x0f3c,
+	    0x3207, 0x3d78, 0x1f01, 0x38e5, 0x0000, 0x295f, 0x0000, 0x0746,
+	    0x1f69, 0x0000, 0x1d7c, 0x0000, 0x0000, 0x041c, 0x11d5, 0x0000,
+	    0x372d, 0x4c7a, 0x1d22, 0x461f, 0x2e14, 0x2406, 0x1a72, 0x0000,
+	    0x046f, 0x0000, 0x0000, 0x34e5, 0x0000, 0x0000, 0x4ca9, 0x1048,
+	    0x1318, 0x323f, 0x0000, 0x1714, 0x045f, 0x0000, 0x3e7f, 0x31a2,
+	    0x2e85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x109d, 0x0000,
+	    0x40eb, 0x2e02, 0x0000, 0x260e, 0x0000, 0x30b1, 0x0000, 0x44b7,
+	    0x4bea, 0x028e, 0x3166, 0x0000, 0x0f7e, 0x3b22, 0x26d2, 0x0000,
+	    0x0000, 0x0000, 0x2e9d, 0x0000, 0x3956, 0x0000, 0x20a8, 0x2a40,
+	    0x1896, 0x2ef5, 0x2315, 0x2506, 0x2a51, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2169, 0x0000, 0x0000, 0x4132, 0x144c, 0x0000, 0x1d28,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08b5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x099c, 0x061f, 0x0000, 0x3e5c, 0x192b,
+	    0x48cc, 0x396a, 0x0000, 0x0000, 0x2316, 0x0000, 0x2636, 0x2c12,
+	    0x0000, 0x2102, 0x12e4, 0x0000, 0x1f44, 0x2e4e, 0x2ef7, 0x1413,
+	    0x4cda, 0x08b8, 0x0000, 0x0121, 0x0000, 0x0000, 0x0264, 0x0000,
+	    0x32be, 0x0000, 0x489d, 0x11d6, 0x0221, 0x0000, 0x0000, 0x0000,
+	    0x48fc, 0x3c89, 0x4a64, 0x462e, 0x33a2, 0x0000, 0x3b2b, 0x10aa,
+	    0x0c77, 0x0000, 0x2206, 0x297d, 0x0000, 0x27bd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x099b, 0x105c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0670, 0x0000, 0x277d, 0x26dd, 0x0000, 0x2a5c, 0x0000, 0x0000,
+	    0x2ab9, 0x3897, 0x0000, 0x0000, 0x43f9, 0x09cd, 0x0053, 0x0000,
+	    0x1b72, 0x3694, 0x0000, 0x2c99, 0x0000, 0x245e, 0x0000, 0x40f1,
+	    0x4c8b, 0x4c65, 0x0000, 0x4102, 0x1e2b, 0x3173, 0x0000, 0x0000,
+	    0x0000, 0x1f1c, 0x4d7a, 0x0000, 0x0000, 0x0703, 0x0000, 0x0000,
+	    0x1684, 0x0000, 0x2eaa, 0x0000, 0x0356, 0x4cf8, 0x4169, 0x3bf3,
+	    0x29b7, 0x0000, 0x412f, 0x0b40, 0x4416, 0x3050, 0x11d8, 0x1d66,
+	    0x4248, 0x0000, 0x06ee, 0x0000, 0x39f5, 0x0000, 0x0000, 0x184a,
+	    0x0000, 0x0b67, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cef, 0x0000,
+	    0x0000, 0x11b8, 0x0a8a, 0x2e10, 0x0000, 0x4b93, 0x0000, 0x0f1d,
+	    0x25b1, 0x0000, 0x2051, 0x0000, 0x0000, 0x3de8, 0x0000, 0x2f99,
+	    0x36f5, 0x0000, 0x0000, 0x346d, 0x0000, 0x4e11, 0x0000, 0x0000,
+	    0x3b01, 0x0000, 0x0cf1, 0x0000, 0x4b3e, 0x33b4, 0x0000, 0x0000,
+	    0x0000, 0x3c1c, 0x0000, 0x0000, 0x2934, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2ccf, 0x493a, 0x32ef, 0x2ceb, 0x4308, 0x335e, 0x0000,
+	    0x0000, 0x0f33, 0x0000, 0x1729, 0x0000, 0x0000, 0x0d4c, 0x35d7,
+	    0x2388, 0x1a27, 0x13dc, 0x4a9f, 0x0413, 0x0000, 0x40ac, 0x0000,
+	    0x29a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x06b6, 0x0000, 0x1213,
+	    0x0000, 0x0000, 0x4b09, 0x0000, 0x0000, 0x0000, 0x2d17, 0x0000,
+	    0x27f1, 0x3a82, 0x39d8, 0x0000, 0x37d6, 0x4060, 0x0000, 0x01fd,
+	    0x0000, 0x0000, 0x3ffa, 0x0000, 0x0000, 0x0000, 0x137c, 0x0000,
+	    0x06ae, 0x0000, 0x2c72, 0x439a, 0x0000, 0x2c8d, 0x0000, 0x3951,
+	    0x2ab8, 0x1544, 0x0000, 0x42b0, 0x393d, 0x0da7, 0x1039, 0x0000,
+	    0x0590, 0x0000, 0x3c0d, 0x0000, 0x0a5c, 0x46c0, 0x1c81, 0x0000,
+	    0x0938, 0x0000, 0x0000, 0x29ca, 0x2bb8, 0x0000, 0x0000, 0x1ce2,
+	    0x02ea, 0x0000, 0x0000, 0x0000, 0x0b41, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x29dd, 0x0000, 0x1f7f, 0x003d, 0x4a8f, 0x0d4e, 0x3780,
+	    0x3c5c, 0x165e, 0x0614, 0x0000, 0x0000, 0x2fd1, 0x0000, 0x0000,
+	    0x4095, 0x3412, 0x0000, 0x302d, 0x207b, 0x0000, 0x0000, 0x2eaa,
+	    0x0000, 0x0000, 0x0000, 0x3568, 0x384a, 0x4d40, 0x1382, 0x1c62,
+	    0x0251, 0x30c8, 0x0000, 0x4b18, 0x0000, 0x00d7, 0x0000, 0x0000,
+	    0x0952, 0x0bfc, 0x0000, 0x2b9f, 0x0000, 0x1527, 0x0000, 0x33b2,
+	    0x0000, 0x28c2, 0x424e, 0x0000, 0x4159, 0x0000, 0x1bdb, 0x0000,
+	    0x09a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x132d,
+	    0x0000, 0x0000, 0x0798, 0x0ae8, 0x0000, 0x3efe, 0x0000, 0x21fc,
+	    0x0000, 0x4ae7, 0x032a, 0x0000, 0x42e3, 0x42dd, 0x0000, 0x412d,
+	    0x1706, 0x0000, 0x4739, 0x3b02, 0x0000, 0x0000, 0x22d8, 0x2677,
+	    0x3e99, 0x18b8, 0x0000, 0x28be, 0x0000, 0x0000, 0x04b6, 0x0284,
+	    0x2af4, 0x0350, 0x0000, 0x0000, 0x2ac5, 0x0000, 0x0000, 0x0000,
+	    0x0e98, 0x23bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x38a5, 0x155d,
+	    0x0000, 0x2345, 0x111c, 0x0000, 0x4078, 0x01a9, 0x1231, 0x0000,
+	    0x1db9, 0x47ad, 0x359d, 0x0000, 0x0000, 0x4445, 0x0000, 0x13da,
+	    0x49ff, 0x1e0b, 0x2c2e, 0x44a4, 0x0000, 0x238d, 0x059a, 0x15ff,
+	    0x20d5, 0x0000, 0x1095, 0x331b, 0x19fb, 0x4148, 0x0c9f, 0x0000,
+	    0x3caf, 0x131f, 0x4bec, 0x0000, 0x00cb, 0x0000, 0x181a, 0x146c,
+	    0x0000, 0x0000, 0x0000, 0x1b50, 0x3e48, 0x40e3, 0x2be9, 0x0f74,
+	    0x0010, 0x0000, 0x3ceb, 0x0000, 0x4df2, 0x0000, 0x12d9, 0x13e7,
+	    0x0000, 0x4a96, 0x0000, 0x0d6c, 0x14ae, 0x195d, 0x2c31, 0x0000,
+	    0x0000, 0x49ca, 0x3281, 0x0000, 0x1b7d, 0x0000, 0x0000, 0x0000,
+	    0x0e96, 0x246d, 0x0000, 0x4b12, 0x0000, 0x1943, 0x0000, 0x2597,
+	    0x3ab1, 0x0000, 0x3674, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ee7,
+	    0x0f97, 0x18b0, 0x269e, 0x0e18, 0x0000, 0x0000, 0x0000, 0x04cd,
+	    0x1bd4, 0x25a5, 0x1eb8, 0x0eb1, 0x131c, 0x19d0, 0x0000, 0x1df3,
+	    0x353c, 0x1d2f, 0x0000, 0x0000, 0x0000, 0x0000, 0x21cb, 0x1cd1,
+	    0x47eb, 0x4945, 0x4d02, 0x0000, 0x103e, 0x328f, 0x0fcd, 0x0000,
+	    0x3ebe, 0x1911, 0x2873, 0x0000, 0x2b91, 0x0000, 0x11fe, 0x0000,
+	    0x17f3, 0x0000, 0x19aa, 0x2642, 0x3bca, 0x44f2, 0x1564, 0x0000,
+	    0x2f75, 0x3e37, 0x4694, 0x0000, 0x0000, 0x44d3, 0x0000, 0x04ba,
+	    0x2264, 0x387e, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a44, 0x0000,
+	    0x4172, 0x3c57, 0x11b9, 0x0000, 0x4a19, 0x0dbb, 0x0000, 0x0000,
+	    0x3b3e, 0x4187, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ac7,
+	    0x0000, 0x36ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b50, 0x26f9,
+	    0x0000, 0x0000, 0x251c, 0x0000, 0x0000, 0x1b9d, 0x4a54, 0x35e7,
+	    0x0000, 0x0cd7, 0x0000, 0x0f69, 0x0000, 0x2bd5, 0x4b72, 0x0000,
+	    0x0d5c, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f4d, 0x3ba9, 0x022c,
+	    0x25e9, 0x26fa, 0x1378, 0x1968, 0x4b9f, 0x0000, 0x2045, 0x0000,
+	    0x0000, 0x0000, 0x174a, 0x0000, 0x0000, 0x0000, 0x0a66, 0x0000,
+	    0x0000, 0x4ce8, 0x0000, 0x0000, 0x0000, 0x10c3, 0x4384, 0x35a5,
+	    0x0000, 0x0d82, 0x0000, 0x2355, 0x1e39, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0cc4, 0x369d, 0x0ae6, 0x3e15, 0x0000, 0x2cff, 0x1bb9,
+	    0x0000, 0x0000, 0x36d6, 0x1769, 0x3321, 0x3c49, 0x1ee1, 0x0000,
+	    0x0000, 0x0000, 0x18e2, 0x0d96, 0x2175, 0x4290, 0x4ce9, 0x1cf9,
+	    0x0000, 0x26b3, 0x00ad, 0x4ac1, 0x0c0f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x415e, 0x3e4c, 0x0000, 0x06fc, 0x0000, 0x0000, 0x289d,
+	    0x0000, 0x0000, 0x1823, 0x07da, 0x0f61, 0x0000, 0x4db9, 0x354f,
+	    0x1425, 0x2174, 0x1dfc, 0x0000, 0x0000, 0x07bc, 0x0000, 0x2b23,
+	    0x2dd6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2811, 0x0000,
+	    0x4dd6, 0x154c, 0x2629, 0x0000, 0x0000, 0x2e54, 0x0000, 0x469f,
+	    0x0000, 0x04c7, 0x17fd, 0x3015, 0x4dc8, 0x0812, 0x0e25, 0x33de,
+	    0x15e8, 0x3da2, 0x08a9, 0x1b38, 0x0000, 0x0000, 0x096e, 0x0120,
+	    0x062b, 0x0f71, 0x0000, 0x1516, 0x496c, 0x18c2, 0x30a0, 0x31d4,
+	    0x0000, 0x40bc, 0x0000, 0x0000, 0x4840, 0x1ffa, 0x0000, 0x3afd,
+	    0x47e7, 0x358a, 0x0000, 0x0000, 0x0000, 0x45a0, 0x2e81, 0x0000,
+	    0x0000, 0x0000, 0x30d8, 0x0000, 0x1fd1, 0x05e6, 0x4a1f, 0x0000,
+	    0x0000, 0x3ab8, 0x0000, 0x4749, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x042e, 0x0870, 0x1111, 0x0000, 0x0000, 0x2ec9, 0x1e51,
+	    0x1ab5, 0x0000, 0x0000, 0x0393, 0x38ca, 0x43e4, 0x3e93, 0x0000,
+	    0x0000, 0x380d, 0x2839, 0x11d9, 0x4852, 0x0000, 0x4b60, 0x2b63,
+	    0x4740, 0x0000, 0x0000, 0x2334, 0x0000, 0x0000, 0x1239, 0x0000,
+	    0x0627, 0x2c9a, 0x0000, 0x0000, 0x0000, 0x32f4, 0x0000, 0x0000,
+	    0x1b95, 0x0000, 0x0d93, 0x295e, 0x2b7f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x392e, 0x1154, 0x1938, 0x0000, 0x3375, 0x0000, 0x1d50,
+	    0x2dc4, 0x1668, 0x0000, 0x0000, 0x0000, 0x1bf1, 0x4953, 0x4ba4,
+	    0x17fa, 0x0000, 0x44e3, 0x41a7, 0x0583, 0x397f, 0x0000, 0x42f5,
+	    0x0000, 0x0000, 0x0000, 0x0cb7, 0x3930, 0x0000, 0x0000, 0x1464,
+	    0x3168, 0x163e, 0x49a7, 0x0000, 0x28cc, 0x0816, 0x0000, 0x2fc0,
+	    0x0000, 0x4250, 0x082c, 0x0000, 0x1d95, 0x0000, 0x3683, 0x0000,
+	    0x0dea, 0x4721, 0x0000, 0x1fce, 0x04d6, 0x0000, 0x0000, 0x4b29,
+	    0x0000, 0x036a, 0x3755, 0x0000, 0x02ad, 0x48b6, 0x43a4, 0x0a45,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x35b0, 0x4c68, 0x0724,
+	    0x07b5, 0x330c, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d7d, 0x0000,
+	    0x325b, 0x1691, 0x0000, 0x37e5, 0x136f, 0x0000, 0x1c40, 0x0000,
+	    0x2001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1395, 0x0000,
+	    0x0000, 0x2eb8, 0x4ca7, 0x0000, 0x1500, 0x2983, 0x01fb, 0x00af,
+	    0x0058, 0x029e, 0x481c, 0x0000, 0x0000, 0x49d9, 0x29a2, 0x2ded,
+	    0x0000, 0x0a61, 0x0000, 0x3ec8, 0x2113, 0x0000, 0x0000, 0x0e70,
+	    0x2c5f, 0x2560, 0x0000, 0x3644, 0x0000, 0x28b5, 0x0000, 0x121a,
+	    0x1e0e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c94, 0x25b9,
+	    0x07e4, 0x4b36, 0x22f1, 0x3e24, 0x1761, 0x01fa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x279b, 0x4994, 0x0111, 0x0000, 0x0000, 0x0000,
+	    0x02df, 0x0000, 0x0e5d, 0x0000, 0x0251, 0x4c8b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4ced, 0x07c6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2873, 0x0000, 0x0f06,
+	    0x072a, 0x4d90, 0x0000, 0x35b8, 0x0a34, 0x0000, 0x251b, 0x0000,
+	    0x42e0, 0x388a, 0x0ff8, 0x0000, 0x1603, 0x15ae, 0x408d, 0x0914,
+	    0x0000, 0x0000, 0x398b, 0x366b, 0x4cd3, 0x0000, 0x00a0, 0x0000,
+	    0x0000, 0x34bf, 0x0000, 0x0ffa, 0x06af, 0x1e3d, 0x1b11, 0x19d2,
+	    0x0000, 0x46f9, 0x0000, 0x11ce, 0x0000, 0x3ce8, 0x275d, 0x4216,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x396f, 0x4cb2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bd8, 0x4857, 0x0000,
+	    0x0000, 0x0000, 0x12e2, 0x1278, 0x3864, 0x0000, 0x0000, 0x0000,
+	    0x2f45, 0x10c9, 0x2088, 0x0ca0, 0x47bb, 0x19f9, 0x0000, 0x37ea,
+	    0x0000, 0x41b2, 0x0a2b, 0x0655, 0x0000, 0x0000, 0x1ef6, 0x0817,
+	    0x08f6, 0x0000, 0x0000, 0x336d, 0x4374, 0x0000, 0x0000, 0x0000,
+	    0x1cbd, 0x1bda, 0x4dd4, 0x0000, 0x421a, 0x0000, 0x3942, 0x1caa,
+	    0x0681, 0x32e7, 0x0000, 0x144b, 0x403a, 0x0000, 0x042e, 0x0037,
+	    0x1c32, 0x2764, 0x0000, 0x0000, 0x17ca, 0x334e, 0x4ba7, 0x0f37,
+	    0x0082, 0x0000, 0x3e0c, 0x38d6, 0x0000, 0x0000, 0x1c03, 0x4a95,
+	    0x194e, 0x41b5, 0x0000, 0x0000, 0x47dd, 0x0000, 0x30a2, 0x4315,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x43e4, 0x0000, 0x0d28,
+	    0x3ca9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3eeb, 0x3da1,
+	    0x0000, 0x0000, 0x4908, 0x2be2, 0x0000, 0x00cd, 0x169d, 0x352a,
+	    0x1450, 0x1fd4, 0x4b7e, 0x41fc, 0x4d89, 0x0000, 0x0000, 0x0000,
+	    0x2304, 0x1989, 0x0000, 0x496d, 0x4717, 0x4859, 0x26b9, 0x0000,
+	    0x277a, 0x0000, 0x3528, 0x2a4c, 0x0000, 0x3f40, 0x0000, 0x01de,
+	    0x14f5, 0x0000, 0x0000, 0x0000, 0x0e29, 0x0000, 0x3660, 0x00a9,
+	    0x0000, 0x36db, 0x0000, 0x2920, 0x1e1e, 0x0000, 0x1a9f, 0x0000,
+	    0x1d87, 0x0000, 0x0000, 0x0000, 0x1fd5, 0x3f17, 0x4141, 0x2f02,
+	    0x0000, 0x0000, 0x0000, 0x3956, 0x0000, 0x2989, 0x3a60, 0x06aa,
+	    0x0000, 0x0000, 0x1c0b, 0x0000, 0x488f, 0x0000, 0x0000, 0x15cb,
+	    0x0b68, 0x0000, 0x0000, 0x4185, 0x3bb3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4c42, 0x2328, 0x443f, 0x0000, 0x0b59, 0x0000, 0x0000,
+	    0x0000, 0x3f38, 0x1a4b, 0x0000, 0x0000, 0x0000, 0x2540, 0x40b5,
+	    0x01ee, 0x0000, 0x0b41, 0x4998, 0x0000, 0x0000, 0x2f9a, 0x418f,
+	    0x0000, 0x479c, 0x0000, 0x10be, 0x0000, 0x0000, 0x0000, 0x32ea,
+	    0x0000, 0x3d07, 0x127f, 0x0000, 0x0000, 0x2f95, 0x0000, 0x0000,
+	    0x0000, 0x1677, 0x30bc, 0x0000, 0x117a, 0x2543, 0x3aaa, 0x034f,
+	    0x0000, 0x0000, 0x378d, 0x0000, 0x0000, 0x4d10, 0x027b, 0x2ec0,
+	    0x2b51, 0x0c7d, 0x0000, 0x1b86, 0x0000, 0x0428, 0x412d, 0x03f4,
+	    0x0000, 0x4593, 0x1615, 0x0000, 0x0000, 0x0f12, 0x179d, 0x1e01,
+	    0x0000, 0x0000, 0x0000, 0x1f09, 0x0000, 0x0000, 0x29b8, 0x0226,
+	    0x0000, 0x0000, 0x0000, 0x495b, 0x095e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x00c3, 0x0b12, 0x21dd, 0x0d33, 0x1792, 0x0000, 0x495c,
+	    0x00ae, 0x0000, 0x0567, 0x0000, 0x0000, 0x3f34, 0x3d14, 0x1776,
+	    0x1ecb, 0x2873, 0x36f3, 0x06fb, 0x0834, 0x390b, 0x0000, 0x0000,
+	    0x3911, 0x0327, 0x340f, 0x0000, 0x0000, 0x4a8c, 0x0292, 0x2af8,
+	    0x2a39, 0x0000, 0x0000, 0x2f3e, 0x2dd2, 0x0b47, 0x30bc, 0x444e,
+	    0x0f6f, 0x36f3, 0x38f0, 0x4d82, 0x0000, 0x3a1a, 0x0000, 0x1f03,
+	    0x0000, 0x4ddb, 0x2978, 0x3e2d, 0x3bd1, 0x3524, 0x0000, 0x34cb,
+	    0x4516, 0x4be7, 0x1c62, 0x292a, 0x43df, 0x0000, 0x0574, 0x3cf2,
+	    0x4db2, 0x3ef6, 0x0000, 0x15cf, 0x2dab, 0x0000, 0x0000, 0x09e4,
+	    0x3bdc, 0x0000, 0x0000, 0x40ba, 0x0000, 0x0000, 0x210e, 0x0000,
+	    0x19fa, 0x0000, 0x0000, 0x2b1d, 0x220f, 0x0cff, 0x25f9, 0x0000,
+	    0x2944, 0x2464, 0x05aa, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x368f, 0x0000, 0x00b2, 0x0000, 0x0000, 0x2f54, 0x0000, 0x0000,
+	    0x0c9e, 0x0000, 0x0000, 0x08b4, 0x0000, 0x0000, 0x0000, 0x0b81,
+	    0x0000, 0x452f, 0x0000, 0x15c4, 0x28c5, 0x2fcb, 0x0000, 0x0000,
+	    0x1d9a, 0x49cf, 0x0000, 0x0000, 0x2e22, 0x49bd, 0x211e, 0x0000,
+	    0x0463, 0x4808, 0x0000, 0x0000, 0x3d44, 0x0000, 0x4cbd, 0x00ed,
+	    0x1d10, 0x29b6, 0x0000, 0x0000, 0x0000, 0x2067, 0x3638, 0x0000,
+	    0x325f, 0x4330, 0x0000, 0x1b73, 0x1ee9, 0x0000, 0x0744, 0x0913,
+	    0x1d93, 0x0000, 0x496a, 0x3df1, 0x0000, 0x21ea, 0x37a6, 0x0000,
+	    0x0000, 0x333f, 0x34d8, 0x28e8, 0x0000, 0x4bf0, 0x1135, 0x33a8,
+	    0x24d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x04c5, 0x16f9, 0x0795,
+	    0x40fa, 0x1e15, 0x0000, 0x0000, 0x0000, 0x4c88, 0x1598, 0x2b30,
+	    0x0000, 0x25ce, 0x4ce5, 0x48c5, 0x16d1, 0x0000, 0x0d17, 0x41aa,
+	    0x4e10, 0x0000, 0x0503, 0x0000, 0x1dd3, 0x4dd6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2a53, 0x4aea, 0x0a8d, 0x3247, 0x0000, 0x0000,
+	    0x21cd, 0x0000, 0x0000, 0x33f5, 0x1f3a, 0x0000, 0x0bff, 0x30e0,
+	    0x29fe, 0x419d, 0x4c33, 0x0e72, 0x2852, 0x223d, 0x0000, 0x1399,
+	    0x3089, 0x2c5c, 0x0000, 0x10a3, 0x0000, 0x2517, 0x02cf, 0x0000,
+	    0x0000, 0x0d8c, 0x27f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x06c1,
+	    0x33ec, 0x2874, 0x1e43, 0x37e5, 0x01d4, 0x0000, 0x1711, 0x1e72,
+	    0x0000, 0x4cf3, 0x0000, 0x0000, 0x354c, 0x3bf6, 0x4c90, 0x0000,
+	    0x1ffb, 0x47df, 0x0000, 0x3d3c, 0x0000, 0x294d, 0x363a, 0x186f,
+	    0x254e, 0x3225, 0x3c29, 0x3821, 0x28ff, 0x1087, 0x1369, 0x17e6,
+	    0x2845, 0x0000, 0x3418, 0x0000, 0x0000, 0x4523, 0x2cba, 0x0000,
+	    0x40c6, 0x0000, 0x0000, 0x0000, 0x31dc, 0x0000, 0x4ae5, 0x204e,
+	    0x385c, 0x0198, 0x05b8, 0x4d9d, 0x3e29, 0x0000, 0x1f94, 0x0000,
+	    0x341e, 0x1deb, 0x0000, 0x0000, 0x3218, 0x0000, 0x3f6a, 0x1930,
+	    0x31d4, 0x4c0d, 0x437a, 0x0721, 0x1ba9, 0x24f7, 0x3df5, 0x3e20,
+	    0x07a6, 0x1e0a, 0x0000, 0x42f7, 0x0000, 0x0e11, 0x4cd8, 0x10d3,
+	    0x0000, 0x1869, 0x3a93, 0x0000, 0x0000, 0x06d5, 0x17a7, 0x26c0,
+	    0x2f55, 0x3753, 0x0000, 0x1e93, 0x13ae, 0x1f80, 0x44e6, 0x350b,
+	    0x0000, 0x0000, 0x0000, 0x31fe, 0x0000, 0x40d4, 0x0000, 0x0000,
+	    0x2153, 0x0000, 0x0450, 0x20de, 0x1af1, 0x0000, 0x0000, 0x1768,
+	    0x40f1, 0x21d5, 0x05eb, 0x19c9, 0x38f9, 0x2fd6, 0x0000, 0x2fcc,
+	    0x26c9, 0x1758, 0x0fff, 0x4c90, 0x2519, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x029b, 0x194f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2ce1, 0x3c29, 0x0000, 0x49bf, 0x0000, 0x2ad4, 0x0000, 0x0000,
+	    0x0000, 0x14fe, 0x0000, 0x0000, 0x05e8, 0x0000, 0x0000, 0x4303,
+	    0x06c6, 0x0000, 0x0000, 0x0000, 0x455e, 0x4de3, 0x23cf, 0x00cf,
+	    0x23c4, 0x0000, 0x0000, 0x0000, 0x1f87, 0x0000, 0x2a89, 0x0000,
+	    0x07dc, 0x1e59, 0x292d, 0x0000, 0x0000, 0x0000, 0x0b55, 0x0000,
+	    0x0000, 0x0000, 0x0118, 0x0000, 0x0000, 0x2802, 0x1662, 0x3574,
+	    0x3157, 0x16f3, 0x3b03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4b2b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4ca1, 0x33a9, 0x09ae, 0x0000, 0x3acc, 0x3f50, 0x0000, 0x2ed2,
+	    0x0242, 0x1adc, 0x0000, 0x12b1, 0x0000, 0x49b2, 0x0000, 0x0000,
+	    0x3926, 0x0000, 0x4b27, 0x0000, 0x3f7d, 0x0000, 0x0000, 0x10a6,
+	    0x4741, 0x0000, 0x4bfa, 0x0000, 0x0000, 0x0000, 0x2009, 0x0000,
+	    0x206b, 0x0000, 0x248c, 0x1f12, 0x16e5, 0x0000, 0x20d3, 0x1d11,
+	    0x232a, 0x016a, 0x0000, 0x4458, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x229e, 0x3f0e, 0x4d33, 0x3aae, 0x2867, 0x4cc0, 0x0000,
+	    0x2f34, 0x3dcd, 0x2901, 0x3285, 0x0000, 0x2694, 0x0000, 0x07f9,
+	    0x0e94, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4cb0,
+	    0x0000, 0x34e4, 0x0000, 0x2c9d, 0x084c, 0x0000, 0x2580, 0x0000,
+	    0x1b5a, 0x0000, 0x1114, 0x2400, 0x14d2, 0x0000, 0x1af2, 0x0000,
+	    0x0000, 0x3e08, 0x0000, 0x164c, 0x26ff, 0x0000, 0x111c, 0x3c0f,
+	    0x1dfc, 0x02c9, 0x03e8, 0x0000, 0x0d04, 0x0000, 0x09dc, 0x0a93,
+	    0x24a8, 0x0000, 0x07a8, 0x0000, 0x2881, 0x1f76, 0x0000, 0x0000,
+	    0x2406, 0x33d8, 0x4960, 0x1820, 0x4428, 0x10db, 0x26a2, 0x21b7,
+	    0x0000, 0x0000, 0x2e9d, 0x0000, 0x0000, 0x0000, 0x3140, 0x0000,
+	    0x1877, 0x146f, 0x0000, 0x0000, 0x460a, 0x084e, 0x0b10, 0x341c,
+	    0x0000, 0x0000, 0x0000, 0x1ab1, 0x099d, 0x1e7e, 0x47a6, 0x1d78,
+	    0x3f9f, 0x286f, 0x0000, 0x1f60, 0x0000, 0x1092, 0x1c9d, 0x2b5f,
+	    0x16e9, 0x0000, 0x16b3, 0x0000, 0x149e, 0x4992, 0x4382, 0x0000,
+	    0x0000, 0x05ec, 0x2f5f, 0x0c29, 0x2dc8, 0x0000, 0x0fb2, 0x31fc,
+	    0x0000, 0x2bb3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2410,
+	    0x43b4, 0x165c, 0x1900, 0x0000, 0x0000, 0x2199, 0x2e1f, 0x00af,
+	    0x0000, 0x0000, 0x086f, 0x194b, 0x393b, 0x0000, 0x0000, 0x0000,
+	    0x4983, 0x06bd, 0x1c51, 0x109d, 0x2108, 0x0000, 0x067d, 0x1540,
+	    0x0000, 0x1479, 0x3200, 0x0000, 0x0256, 0x1efc, 0x0000, 0x0000,
+	    0x389e, 0x2364, 0x0000, 0x0000, 0x39cf, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3d5d, 0x329a, 0x4235, 0x0000, 0x0000, 0x3d02,
+	    0x375b, 0x2940, 0x33d9, 0x0000, 0x0000, 0x0000, 0x3d96, 0x29a0,
+	    0x37ef, 0x303d, 0x33dc, 0x05e6, 0x14bc, 0x0000, 0x0000, 0x3107,
+	    0x386e, 0x0c6e, 0x0133, 0x42fc, 0x4276, 0x0000, 0x0000, 0x1913,
+	    0x2a76, 0x0000, 0x0c52, 0x2e12, 0x4aba, 0x4cbf, 0x0000, 0x2faa,
+	    0x13cf, 0x0f0f, 0x4a73, 0x0000, 0x0000, 0x11b1, 0x1221, 0x2475,
+	    0x0000, 0x0000, 0x3ae7, 0x0724, 0x2c24, 0x0000, 0x4bf0, 0x25a3,
+	    0x0000, 0x33e2, 0x0dd2, 0x0000, 0x1ed2, 0x07aa, 0x0fff, 0x414f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0bf7, 0x3e63, 0x0000, 0x1ae6,
+	    0x4b9d, 0x1542, 0x2438, 0x2abe, 0x0000, 0x113b, 0x1b97, 0x1b45,
+	    0x18d1, 0x0000, 0x28d3, 0x4ad4, 0x0e8b, 0x0b88, 0x0000, 0x0000,
+	    0x0000, 0x2d1d, 0x341e, 0x0000, 0x049e, 0x073b, 0x0000, 0x0000,
+	    0x0000, 0x2733, 0x4c22, 0x0000, 0x0000, 0x0379, 0x0000, 0x0000,
+	    0x2f67, 0x0000, 0x33e4, 0x0000, 0x0000, 0x40de, 0x0000, 0x0ec1,
+	    0x3472, 0x0000, 0x25e7, 0x0000, 0x0000, 0x0000, 0x0e9d, 0x1447,
+	    0x4c64, 0x0a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2853,
+	    0x4807, 0x0000, 0x0000, 0x0f92, 0x1271, 0x21ab, 0x0709, 0x0000,
+	    0x0a1b, 0x0000, 0x0000, 0x4adb, 0x0000, 0x07e5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4cbd, 0x0000, 0x2892, 0x2ed0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x176c, 0x4426, 0x0000, 0x4845, 0x102a, 0x4200,
+	    0x1c13, 0x4235, 0x0c8e, 0x0324, 0x27c2, 0x0000, 0x1793, 0x0000,
+	    0x04da, 0x0000, 0x0000, 0x26d4, 0x0000, 0x15ee, 0x0377, 0x370e,
+	    0x1424, 0x0000, 0x3b10, 0x3283, 0x376d, 0x0000, 0x0000, 0x0000,
+	    0x235b, 0x4185, 0x3af3, 0x0000, 0x1ee8, 0x0000, 0x0000, 0x082a,
+	    0x0000, 0x33e6, 0x4cee, 0x0000, 0x0000, 0x1bb0, 0x23ef, 0x280f,
+	    0x1f54, 0x0000, 0x1edb, 0x0000, 0x0000, 0x0701, 0x1ed3, 0x4924,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x449a, 0x0000,
+	    0x425c, 0x38c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x2292, 0x29d1,
+	    0x4d7e, 0x052b, 0x0000, 0x0000, 0x4589, 0x0b4a, 0x0000, 0x1c68,
+	    0x4c9d, 0x1169, 0x0095, 0x4762, 0x1d30, 0x33d7, 0x3312, 0x0000,
+	    0x0000, 0x3278, 0x0000, 0x1ac1, 0x210f, 0x0000, 0x3a91, 0x41a8,
+	    0x4cee, 0x0000, 0x2e17, 0x0000, 0x0000, 0x0000, 0x4567, 0x3cc5,
+	    0x0000, 0x1998, 0x0000, 0x03e4, 0x0000, 0x0000, 0x33f4, 0x3a4f,
+	    0x0f53, 0x0000, 0x453e, 0x1b08, 0x11bc, 0x218d, 0x48f2, 0x0000,
+	    0x1816, 0x182d, 0x4793, 0x0000, 0x1e4f, 0x23f5, 0x47ae, 0x1381,
+	    0x0000, 0x2e8c, 0x0000, 0x0000, 0x0000, 0x46b5, 0x1b4a, 0x2745,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2ca6, 0x2aaf, 0x1e64, 0x190e,
+	    0x25ea, 0x4bc9, 0x0000, 0x03b2, 0x3f20, 0x3477, 0x1cbf, 0x2f37,
+	    0x0a7c, 0x0000, 0x4336, 0x0000, 0x0000, 0x0000, 0x4aa3, 0x2043,
+	    0x0000, 0x4a42, 0x0000, 0x2bca, 0x2456, 0x12aa, 0x0c80, 0x0000,
+	    0x4378, 0x0000, 0x4203, 0x04c4, 0x177d, 0x0563, 0x0000, 0x207f,
+	    0x0000, 0x310c, 0x2a30, 0x08c0, 0x0000, 0x1f66, 0x44c7, 0x3a4c,
+	    0x34a5, 0x3b2b, 0x0000, 0x0000, 0x182c, 0x2ac3, 0x0000, 0x2866,
+	    0x1dcc, 0x0000, 0x155d, 0x414d, 0x2f83, 0x41b8, 0x0000, 0x0000,
+	    0x3cad, 0x0000, 0x28c2, 0x0000, 0x0000, 0x4de5, 0x1b07, 0x0000,
+	    0x0000, 0x0000, 0x12a2, 0x0000, 0x12e1, 0x158e, 0x0000, 0x0000,
+	    0x0000, 0x3ee8, 0x0612, 0x0001, 0x0000, 0x3042, 0x0000, 0x3c9e,
+	    0x1e81, 0x2cf9, 0x0f09, 0x28cb, 0x2519, 0x0000, 0x0000, 0x0000,
+	    0x3d40, 0x4042, 0x368b, 0x1beb, 0x0000, 0x0000, 0x0000, 0x2bd9,
+	    0x02e1, 0x1267, 0x441d, 0x0000, 0x2459, 0x09f9, 0x108a, 0x0000,
+	    0x0a6e, 0x35ea, 0x280d, 0x468f, 0x0000, 0x3ca7, 0x4bac, 0x0b4b,
+	    0x0716, 0x17f7, 0x0000, 0x1443, 0x258f, 0x0000, 0x0000, 0x2c92,
+	    0x1896, 0x3df3, 0x2de5, 0x38f9, 0x2c6e, 0x0000, 0x2cbb, 0x027c,
+	    0x2bda, 0x0000, 0x0855, 0x2afd, 0x4af8, 0x43ec, 0x0000, 0x0000,
+	    0x0000, 0x035a, 0x0000, 0x0000, 0x45d5, 0x1db6, 0x0000, 0x0000,
+	    0x0c1a, 0x0000, 0x0000, 0x37f3, 0x1840, 0x0000, 0x0000, 0x473f,
+	    0x0000, 0x129a, 0x0b22, 0x1656, 0x0386, 0x03bf, 0x3cc2, 0x0000,
+	    0x1994, 0x0c8b, 0x3544, 0x0000, 0x217c, 0x0000, 0x00ce, 0x0000,
+	    0x0f0d, 0x4bdf, 0x236d, 0x0000, 0x4a2f, 0x0c62, 0x0000, 0x30a6,
+	    0x2b8f, 0x0000, 0x0379, 0x21b4, 0x483f, 0x4360, 0x2bf2, 0x1a2c,
+	    0x2878, 0x0000, 0x1c5d, 0x2b10, 0x0793, 0x39c1, 0x23dd, 0x4767,
+	    0x0000, 0x15c3, 0x0000, 0x39e6, 0x0000, 0x0000, 0x0000, 0x3d6b,
+	    0x0bf1, 0x02e7, 0x0000, 0x0145, 0x0000, 0x35fa, 0x26d7, 0x42b4,
+	    0x175c, 0x38bf, 0x1971, 0x2e65, 0x0e76, 0x160d, 0x2a44, 0x0000,
+	    0x3c08, 0x3564, 0x0000, 0x4a7b, 0x0000, 0x427e, 0x0000, 0x30a4,
+	    0x0000, 0x0000, 0x0690, 0x0000, 0x33b1, 0x0000, 0x2fc6, 0x0000,
+	    0x0000, 0x0790, 0x1809, 0x0000, 0x2cd0, 0x0000, 0x3e45, 0x3536,
+	    0x0000, 0x16df, 0x0000, 0x09b4, 0x0603, 0x4479, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4df9, 0x03e6, 0x3697, 0x0000, 0x4616, 0x0000,
+	    0x4bd7, 0x395b, 0x0000, 0x0000, 0x108e, 0x24b1, 0x1245, 0x0000,
+	    0x0000, 0x0000, 0x09fd, 0x19a9, 0x3d65, 0x0000, 0x1387, 0x1bca,
+	    0x0000, 0x0000, 0x0da0, 0x0988, 0x0000, 0x0000, 0x3c81, 0x0000,
+	    0x0000, 0x0e0c, 0x3d3d, 0x1f49, 0x2f0e, 0x0000, 0x0000, 0x0000,
+	    0x3596, 0x3220, 0x1e43, 0x0000, 0x0000, 0x4acc, 0x1433, 0x3c46,
+	    0x0000, 0x2857, 0x0000, 0x490f, 0x0000, 0x0afc, 0x3100, 0x0000,
+	    0x1fa6, 0x4847, 0x1f38, 0x0000, 0x095c, 0x35f4, 0x2bf3, 0x0000,
+	    0x1e42, 0x0000, 0x0000, 0x0000, 0x3f55, 0x0a35, 0x0000, 0x1455,
+	    0x2ea3, 0x0000, 0x3b3f, 0x019a, 0x1b5b, 0x0000, 0x0000, 0x286d,
+	    0x21c5, 0x0000, 0x0000, 0x4364, 0x1a7b, 0x285a, 0x1680, 0x0b1e,
+	    0x0f30, 0x3744, 0x0000, 0x29e1, 0x0000, 0x0000, 0x198c, 0x0fb7,
+	    0x0a6a, 0x0000, 0x2392, 0x0000, 0x33b7, 0x0000, 0x21f1, 0x49ba,
+	    0x398b, 0x0000, 0x1aa4, 0x0000, 0x45be, 0x39f0, 0x0000, 0x1c79,
+	    0x0b55, 0x0701, 0x4a24, 0x4b7c, 0x3ce3, 0x0f8b, 0x3364, 0x0000,
+	    0x4b0e, 0x461f, 0x0669, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d77,
+	    0x0000, 0x0000, 0x3d15, 0x2475, 0x0b93, 0x36da, 0x48d2, 0x14b8,
+	    0x0000, 0x29e4, 0x1132, 0x4b13, 0x0ebc, 0x47c5, 0x057a, 0x2dd4,
+	    0x4412, 0x0000, 0x254d, 0x0000, 0x3851, 0x0000, 0x0000, 0x3fd4,
+	    0x13ee, 0x0000, 0x3af1, 0x18d3, 0x0055, 0x0000, 0x4993, 0x0000,
+	    0x0000, 0x029e, 0x0000, 0x33d3, 0x3c25, 0x0000, 0x046a, 0x0000,
+	    0x4908, 0x0000, 0x0000, 0x0000, 0x2091, 0x104b, 0x0000, 0x49f9,
+	    0x0000, 0x0000, 0x0000, 0x178e, 0x0a43, 0x1036, 0x0000, 0x1222,
+	    0x07c9, 0x228e, 0x2dfe, 0x02e3, 0x33e1, 0x13c6, 0x1aaf, 0x446f,
+	    0x0000, 0x0917, 0x0880, 0x0000, 0x3e96, 0x2a74, 0x0000, 0x02a9,
+	    0x0000, 0x0000, 0x18f6, 0x32f6, 0x095c, 0x417e, 0x0000, 0x0850,
+	    0x0d55, 0x387d, 0x4887, 0x11a7, 0x0ab6, 0x2825, 0x0000, 0x0000,
+	    0x04f5, 0x0c2f, 0x1051, 0x1196, 0x016a, 0x42a5, 0x0000, 0x33f2,
+	    0x2ff4, 0x0000, 0x148b, 0x0bd6, 0x4df0, 0x0000, 0x3474, 0x483b,
+	    0x11f7, 0x4743, 0x0000, 0x12bb, 0x0657, 0x0000, 0x0c3f, 0x42ed,
+	    0x00d8, 0x1ebb, 0x32eb, 0x2cc7, 0x0000, 0x0000, 0x0000, 0x0a41,
+	    0x0000, 0x0000, 0x13d8, 0x0000, 0x0000, 0x3551, 0x0000, 0x1abf,
+	    0x0000, 0x0000, 0x0000, 0x1254, 0x36ad, 0x3a0c, 0x3c4c, 0x19fe,
+	    0x496f, 0x0000, 0x0000, 0x0000, 0x3404, 0x4c0a, 0x1b7c, 0x0fbf,
+	    0x0000, 0x466c, 0x46f9, 0x2d6d, 0x0000, 0x3e04, 0x1c3d, 0x0000,
+	    0x170a, 0x3937, 0x0000, 0x2705, 0x0000, 0x369d, 0x0000, 0x3bed,
+	    0x0881, 0x11c2, 0x24ab, 0x0000, 0x0000, 0x3712, 0x0000, 0x1ea7,
+	    0x327d, 0x1e6e, 0x0000, 0x0000, 0x0f3d, 0x0000, 0x19d8, 0x1f92,
+	    0x03fd, 0x37a2, 0x4712, 0x1764, 0x0000, 0x34cf, 0x1417, 0x30f5,
+	    0x0000, 0x1e5a, 0x4405, 0x0000, 0x38f7, 0x0000, 0x3854, 0x0000,
+	    0x31ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x2906, 0x1c50, 0x0000,
+	    0x0000, 0x24f9, 0x0000, 0x00f1, 0x0000, 0x0481, 0x02bf, 0x3bed,
+	    0x33bc, 0x0000, 0x0000, 0x4b75, 0x4d85, 0x0000, 0x0dfe, 0x0000,
+	    0x0000, 0x0000, 0x35c3, 0x0000, 0x259e, 0x2bbd, 0x0000, 0x0000,
+	    0x0000, 0x116f, 0x4d1a, 0x4a1a, 0x4a47, 0x3423, 0x0000, 0x0000,
+	    0x255c, 0x24a6, 0x4a36, 0x1609, 0x0764, 0x09f9, 0x08b9, 0x0000,
+	    0x0000, 0x0000, 0x1358, 0x0000, 0x0000, 0x3927, 0x0000, 0x13d7,
+	    0x0000, 0x473b, 0x0000, 0x1d7e, 0x21c5, 0x0000, 0x0b15, 0x0000,
+	    0x45ee, 0x0000, 0x0000, 0x2d15, 0x0000, 0x0000, 0x06f0, 0x1c75,
+	    0x2590, 0x0000, 0x46f2, 0x0000, 0x394b, 0x3796, 0x0000, 0x0000,
+	    0x0000, 0x30d6, 0x0000, 0x0000, 0x0000, 0x42c6, 0x0000, 0x12a2,
+	    0x4976, 0x0000, 0x2c71, 0x1fe1, 0x1091, 0x26eb, 0x0c2f, 0x371d,
+	    0x2611, 0x46d0, 0x0fb5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ebe,
+	    0x48de, 0x0000, 0x4d0b, 0x3a87, 0x1db5, 0x0000, 0x3f35, 0x0000,
+	    0x235a, 0x377a, 0x142f, 0x0000, 0x3fd3, 0x0000, 0x01ca, 0x0000,
+	    0x33b7, 0x3fc2, 0x49a3, 0x3e41, 0x0000, 0x1d95, 0x0d9b, 0x27fa,
+	    0x0000, 0x3a23, 0x0000, 0x2082, 0x18a9, 0x02e7, 0x0000, 0x0000,
+	    0x253c, 0x03a3, 0x16a8, 0x0000, 0x0a24, 0x0000, 0x0000, 0x2c3f,
+	    0x435d, 0x0000, 0x02e8, 0x0000, 0x0000, 0x1b32, 0x0000, 0x0000,
+	    0x352a, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f8b, 0x4032, 0x0000,
+	    0x26d4, 0x4d8f, 0x365d, 0x0000, 0x0000, 0x3082, 0x0000, 0x2663,
+	    0x417b, 0x3193, 0x000f, 0x3302, 0x0000, 0x00f1, 0x0266, 0x0000,
+	    0x0adf, 0x0000, 0x0000, 0x0000, 0x18fb, 0x0000, 0x1629, 0x1e30,
+	    0x4c2f, 0x3cc1, 0x0000, 0x0000, 0x4dfd, 0x0000, 0x0000, 0x389b,
+	    0x0000, 0x30aa, 0x0000, 0x14ab, 0x0000, 0x0000, 0x1567, 0x16c5,
+	    0x47f9, 0x0000, 0x3aa4, 0x1055, 0x0000, 0x0144, 0x0000, 0x11a2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1f79, 0x0000, 0x1221, 0x2795,
+	    0x38ed, 0x0000, 0x4a48, 0x0000, 0x0000, 0x0dfe, 0x379d, 0x3992,
+	    0x4698, 0x4995, 0x45ee, 0x0000, 0x0000, 0x1bb6, 0x0391, 0x0000,
+	    0x0000, 0x0000, 0x1df9, 0x0000, 0x0000, 0x0000, 0x146e, 0x48bf,
+	    0x40c5, 0x0000, 0x22f1, 0x0000, 0x38ca, 0x0b68, 0x0000, 0x0000,
+	    0x03de, 0x0b0a, 0x49eb, 0x1447, 0x2566, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x36ee, 0x0000, 0x1865, 0x0121, 0x0deb, 0x0000,
+	    0x445d, 0x29fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x2129, 0x0000,
+	    0x0000, 0x0000, 0x4b60, 0x1ed0, 0x04a7, 0x0000, 0x4648, 0x17b6,
+	    0x2576, 0x399d, 0x4741, 0x0000, 0x2d1f, 0x0000, 0x30ff, 0x4b9c,
+	    0x04bf, 0x01a7, 0x1831, 0x3f7c, 0x271a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2731, 0x4bff, 0x0000, 0x06ca, 0x0000, 0x0000, 0x0000,
+	    0x099a, 0x0000, 0x0000, 0x28e9, 0x0000, 0x0000, 0x0b62, 0x2dda,
+	    0x444e, 0x0000, 0x0dc5, 0x3bb8, 0x20bd, 0x0000, 0x16d3, 0x35c1,
+	    0x134c, 0x2e19, 0x0627, 0x41c2, 0x0000, 0x2738, 0x3b96, 0x43ef,
+	    0x0000, 0x0c79, 0x0000, 0x05a5, 0x0000, 0x1ea8, 0x0fe0, 0x339a,
+	    0x0000, 0x311d, 0x20f5, 0x1959, 0x0000, 0x129f, 0x0000, 0x3279,
+	    0x0000, 0x227b, 0x4627, 0x2cb6, 0x4252, 0x08dd, 0x2c96, 0x0000,
+	    0x0000, 0x378a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0000,
+	    0x0000, 0x0000, 0x2d79, 0x0000, 0x3c76, 0x0d48, 0x0000, 0x2009,
+	    0x45c3, 0x0000, 0x0000, 0x3472, 0x0000, 0x3c05, 0x0000, 0x09d8,
+	    0x1b9a, 0x0000, 0x393f, 0x0000, 0x0000, 0x23be, 0x0000, 0x0000,
+	    0x47eb, 0x0000, 0x43af, 0x3616, 0x0000, 0x3091, 0x0000, 0x0000,
+	    0x3626, 0x0000, 0x3699, 0x0129, 0x0000, 0x0000, 0x4a17, 0x0000,
+	    0x0000, 0x166f, 0x0000, 0x0000, 0x13b3, 0x4683, 0x23cb, 0x0ca1,
+	    0x0000, 0x0000, 0x0000, 0x12dc, 0x0000, 0x0000, 0x02fd, 0x4c60,
+	    0x0000, 0x3144, 0x45f3, 0x122b, 0x0000, 0x34ee, 0x0000, 0x0663,
+	    0x0000, 0x3a5b, 0x452e, 0x0000, 0x476b, 0x0000, 0x2943, 0x0000,
+	    0x0000, 0x3b6f, 0x0000, 0x2a48, 0x30cb, 0x4c84, 0x4143, 0x1cab,
+	    0x4a22, 0x0000, 0x451c, 0x4298, 0x2042, 0x0000, 0x36dd, 0x0000,
+	    0x1315, 0x2d97, 0x256b, 0x23d9, 0x0000, 0x0000, 0x1e30, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4a13, 0x10df, 0x0000, 0x2a4b,
+	    0x3004, 0x1033, 0x0000, 0x4b3f, 0x33bb, 0x0000, 0x05be, 0x3e3d,
+	    0x167f, 0x3fc2, 0x0000, 0x1e73, 0x0000, 0x1128, 0x237a, 0x3cb8,
+	    0x0fab, 0x0000, 0x1b8b, 0x0000, 0x0000, 0x1db1, 0x0ace, 0x15da,
+	    0x4648, 0x0bf5, 0x0681, 0x4cd2, 0x0000, 0x20c4, 0x1efa, 0x19f2,
+	    0x3e93, 0x0000, 0x3b61, 0x177d, 0x4695, 0x234d, 0x4b27, 0x20e7,
+	    0x07f5, 0x2b24, 0x364a, 0x455d, 0x300e, 0x1e16, 0x0000, 0x0000,
+	    0x459c, 0x0000, 0x0000, 0x3cc4, 0x0e5e, 0x0508, 0x0000, 0x14d5,
+	    0x03a2, 0x0000, 0x0000, 0x0000, 0x4c1a, 0x0000, 0x0000, 0x189d,
+	    0x0000, 0x3d3c, 0x41ae, 0x3753, 0x0000, 0x0000, 0x0000, 0x08d8,
+	    0x0f25, 0x0000, 0x317b, 0x450d, 0x0000, 0x4429, 0x03fa, 0x1863,
+	    0x0000, 0x2536, 0x2f70, 0x0000, 0x0000, 0x115b, 0x3f70, 0x0ce0,
+	    0x20bb, 0x2540, 0x49d8, 0x34d3, 0x0000, 0x4569, 0x0000, 0x2254,
+	    0x0000, 0x0000, 0x0000, 0x4c33, 0x1c26, 0x47c7, 0x3ba0, 0x0000,
+	    0x0000, 0x210b, 0x0000, 0x09c7, 0x32ab, 0x0000, 0x277e, 0x0000,
+	    0x2cd9, 0x0e8e, 0x194f, 0x0000, 0x1974, 0x0000, 0x3101, 0x2c3b,
+	    0x0500, 0x0000, 0x47fd, 0x30b8, 0x0000, 0x1bae, 0x0f62, 0x1bb7,
+	    0x2487, 0x0031, 0x4186, 0x0000, 0x0000, 0x05ce, 0x2d95, 0x2255,
+	    0x0000, 0x0aad, 0x1a29, 0x2801, 0x14a1, 0x2130, 0x0000, 0x1bb2,
+	    0x0c81, 0x28ee, 0x0000, 0x0480, 0x335f, 0x444d, 0x3f99, 0x3d74,
+	    0x0000, 0x0000, 0x3132, 0x1cba, 0x0000, 0x039c, 0x3d15, 0x0000,
+	    0x2b48, 0x0000, 0x0000, 0x2ccb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0abd, 0x4289, 0x1eee, 0x0000, 0x0000, 0x0000, 0x0acf, 0x1b0d,
+	    0x052f, 0x4abd, 0x1ebb, 0x0000, 0x0000, 0x10c9, 0x092f, 0x3534,
+	    0x0000, 0x0000, 0x29fb, 0x0000, 0x0000, 0x0000, 0x158b, 0x23fd,
+	    0x436f, 0x0000, 0x4a9b, 0x0000, 0x0d29, 0x0e2f, 0x0243, 0x0915,
+	    0x0000, 0x0000, 0x2b46, 0x3192, 0x2fd2, 0x3108, 0x0000, 0x037d,
+	    0x09a2, 0x1954, 0x0000, 0x0000, 0x0000, 0x0000, 0x27db, 0x1b6b,
+	    0x0000, 0x32fc, 0x2ebb, 0x1a78, 0x289d, 0x2b25, 0x18de, 0x04a2,
+	    0x3523, 0x0000, 0x1830, 0x0000, 0x3ff6, 0x3bdd, 0x0baa, 0x45bf,
+	    0x3098, 0x0404, 0x1403, 0x23b0, 0x0000, 0x0000, 0x0000, 0x235a,
+	    0x113c, 0x431c, 0x1b22, 0x1b68, 0x2c97, 0x413f, 0x0b91, 0x2d9a,
+	    0x07b3, 0x4501, 0x2fa1, 0x420d, 0x2299, 0x3dff, 0x1e6c, 0x0000,
+	    0x3788, 0x35e6, 0x1680, 0x4055, 0x3f58, 0x0000, 0x22a6, 0x341b,
+	    0x4d73, 0x0e07, 0x0000, 0x0000, 0x1bd8, 0x3a3c, 0x0000, 0x1c1f,
+	    0x0a07, 0x228d, 0x0000, 0x0000, 0x323f, 0x39c9, 0x35c5, 0x0000,
+	    0x1b2e, 0x4057, 0x3e56, 0x38d4, 0x0000, 0x2ef5, 0x3811, 0x0000,
+	    0x02c0, 0x18e4, 0x0528, 0x4468, 0x0000, 0x3363, 0x0000, 0x34b5,
+	    0x0b7f, 0x0000, 0x2e01, 0x240a, 0x3f03, 0x4ac3, 0x4dbb, 0x067a,
+	    0x0000, 0x0a60, 0x1701, 0x0000, 0x0000, 0x0000, 0x47e2, 0x47c7,
+	    0x0000, 0x0000, 0x0000, 0x3502, 0x48cf, 0x2f08, 0x06e2, 0x0000,
+	    0x3764, 0x0000, 0x3653, 0x2440, 0x0000, 0x07d0, 0x19b2, 0x2785,
+	    0x0000, 0x1566, 0x0e2f, 0x0000, 0x4878, 0x1c06, 0x3bb9, 0x0000,
+	    0x361f, 0x156a, 0x0cc0, 0x2806, 0x0000, 0x0000, 0x02fa, 0x0000,
+	    0x0000, 0x0000, 0x4067, 0x35e8, 0x10c1, 0x0000, 0x29f2, 0x0000,
+	    0x4aad, 0x0510, 0x0000, 0x1cc1, 0x0000, 0x196c, 0x3ebb, 0x0000,
+	    0x0000, 0x10a7, 0x1140, 0x0000, 0x27fb, 0x2a38, 0x1652, 0x369d,
+	    0x2ac7, 0x0e84, 0x1188, 0x244d, 0x1b77, 0x0000, 0x0000, 0x0000,
+	    0x2e34, 0x0000, 0x399b, 0x378c, 0x435d, 0x311f, 0x0000, 0x187b,
+	    0x2781, 0x286c, 0x0770, 0x2955, 0x0000, 0x0000, 0x4a78, 0x0000,
+	    0x0000, 0x2b33, 0x0000, 0x0000, 0x3f6b, 0x4dd8, 0x0000, 0x3bea,
+	    0x1f97, 0x1b61, 0x24f8, 0x0699, 0x3519, 0x05e3, 0x2111, 0x4c87,
+	    0x0000, 0x163f, 0x2e9d, 0x0618, 0x27ba, 0x14e3, 0x4971, 0x08e4,
+	    0x48bf, 0x48bc, 0x0000, 0x2465, 0x0000, 0x29b5, 0x0000, 0x42cc,
+	    0x0000, 0x0000, 0x0206, 0x0000, 0x004a, 0x3b81, 0x418e, 0x0000,
+	    0x2b76, 0x2ecb, 0x3c2b, 0x02c2, 0x0d1a, 0x0000, 0x4b08, 0x0000,
+	    0x0000, 0x33d3, 0x0000, 0x0000, 0x4361, 0x0099, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x344c, 0x0449, 0x0000, 0x41d2,
+	    0x0000, 0x05d6, 0x4625, 0x0000, 0x2803, 0x0000, 0x0000, 0x0000,
+	    0x22f3, 0x0000, 0x0000, 0x041a, 0x0000, 0x0000, 0x1795, 0x0000,
+	    0x0000, 0x1348, 0x2b0c, 0x40df, 0x1513, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x39d1, 0x235f, 0x0000, 0x0fe7, 0x2865, 0x0000, 0x4744,
+	    0x0000, 0x0000, 0x04cf, 0x0000, 0x0000, 0x0000, 0x46cc, 0x2fed,
+	    0x3676, 0x333f, 0x0000, 0x0000, 0x3fad, 0x0cf8, 0x0000, 0x0000,
+	    0x4de4, 0x0000, 0x0000, 0x0000, 0x1fa5, 0x3123, 0x0000, 0x1370,
+	    0x0000, 0x340a, 0x0000, 0x0000, 0x0464, 0x3022, 0x058f, 0x0000,
+	    0x0f98, 0x0000, 0x0000, 0x0000, 0x2d8b, 0x42a0, 0x4519, 0x41dc,
+	    0x0000, 0x0000, 0x2676, 0x027e, 0x331f, 0x0000, 0x3dcb, 0x05cb,
+	    0x0000, 0x2f76, 0x48ef, 0x0000, 0x0b1f, 0x48a4, 0x1ba3, 0x0000,
+	    0x019a, 0x333d, 0x44a1, 0x0000, 0x0000, 0x0000, 0x2b0d, 0x15a6,
+	    0x3f67, 0x4649, 0x07ff, 0x0000, 0x2e91, 0x4845, 0x169f, 0x46b4,
+	    0x0000, 0x32a1, 0x017c, 0x3f33, 0x11b1, 0x1034, 0x47f3, 0x2bd2,
+	    0x28e3, 0x1f17, 0x3ead, 0x13ee, 0x4776, 0x0000, 0x3f62, 0x0000,
+	    0x0000, 0x18c6, 0x2a72, 0x0000, 0x0000, 0x0000, 0x0421, 0x14ff,
+	    0x1f53, 0x22b2, 0x0000, 0x2adb, 0x0000, 0x0000, 0x31ea, 0x4543,
+	    0x0000, 0x2113, 0x0d56, 0x12e4, 0x1db7, 0x0000, 0x479f, 0x0000,
+	    0x010b, 0x0e92, 0x0000, 0x08c9, 0x3fca, 0x0555, 0x0000, 0x1e8b,
+	    0x21c8, 0x0dde, 0x2ba4, 0x0000, 0x27e8, 0x080e, 0x4722, 0x3179,
+	    0x3240, 0x0da1, 0x0000, 0x0000, 0x0000, 0x39d5, 0x4179, 0x266e,
+	    0x49f5, 0x0000, 0x2d13, 0x090d, 0x031f, 0x0000, 0x0000, 0x361e,
+	    0x0760, 0x226f, 0x2790, 0x0000, 0x4cc6, 0x0000, 0x0000, 0x0000,
+	    0x3b26, 0x0000, 0x3686, 0x0a5a, 0x0000, 0x0000, 0x0caf, 0x1038,
+	    0x0000, 0x0000, 0x4cf1, 0x0000, 0x1e94, 0x3ac0, 0x28ba, 0x160f,
+	    0x4083, 0x03aa, 0x10c6, 0x091a, 0x24bf, 0x0000, 0x172f, 0x1d42,
+	    0x0000, 0x038c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01d2,
+	    0x46b3, 0x18cb, 0x4066, 0x0000, 0x49ca, 0x4035, 0x0b63, 0x0fb3,
+	    0x0000, 0x1c31, 0x0000, 0x0000, 0x4c24, 0x3f2b, 0x0000, 0x02b7,
+	    0x3c36, 0x2e0d, 0x1872, 0x0000, 0x0000, 0x1ca4, 0x0000, 0x0000,
+	    0x073e, 0x0000, 0x3fa4, 0x1f36, 0x01e2, 0x0b58, 0x331e, 0x0000,
+	    0x3ab1, 0x0000, 0x1591, 0x0000, 0x3ed5, 0x4080, 0x0d7a, 0x3ea4,
+	    0x0000, 0x0000, 0x3841, 0x2e0c, 0x0063, 0x0000, 0x0000, 0x0000,
+	    0x4162, 0x0000, 0x0000, 0x0000, 0x224f, 0x0000, 0x0000, 0x02ec,
+	    0x0931, 0x0000, 0x0a0b, 0x17fd, 0x19c2, 0x28b4, 0x028f, 0x0000,
+	    0x1e1c, 0x0766, 0x2ac4, 0x0a3f, 0x44d0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x307b, 0x3f7b, 0x162f, 0x3611, 0x4bec, 0x2dd0,
+	    0x0000, 0x10ad, 0x0000, 0x0000, 0x0000, 0x1a23, 0x2a46, 0x34e1,
+	    0x016f, 0x0000, 0x39f8, 0x0000, 0x02be, 0x11ec, 0x05c7, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0e18, 0x0000, 0x2748, 0x2886, 0x1919,
+	    0x0000, 0x2255, 0x0000, 0x32bb, 0x356c, 0x416f, 0x3a00, 0x0000,
+	    0x4110, 0x0518, 0x4ab8, 0x30f6, 0x29b0, 0x2b9e, 0x0000, 0x0000,
+	    0x0000, 0x07bc, 0x0000, 0x456b, 0x3aff, 0x0000, 0x0000, 0x0000,
+	    0x301b, 0x0000, 0x3f9c, 0x0000, 0x34f8, 0x0000, 0x0000, 0x36c4,
+	    0x40cc, 0x3737, 0x4977, 0x38fd, 0x0000, 0x0000, 0x0000, 0x0d4d,
+	    0x281d, 0x0000, 0x01a1, 0x35b9, 0x116e, 0x15cc, 0x343f, 0x0000,
+	    0x1ddf, 0x0000, 0x1f10, 0x0000, 0x34d6, 0x341c, 0x33ae, 0x0000,
+	    0x075d, 0x2bef, 0x0000, 0x0000, 0x21f8, 0x092b, 0x351c, 0x0000,
+	    0x44f8, 0x0a1d, 0x28ed, 0x0208, 0x0000, 0x0000, 0x3f76, 0x0000,
+	    0x0749, 0x0000, 0x2e69, 0x0000, 0x0000, 0x1065, 0x2984, 0x21d2,
+	    0x33dc, 0x0000, 0x17bc, 0x0928, 0x182f, 0x0000, 0x0000, 0x0000,
+	    0x02a5, 0x0000, 0x0000, 0x181b, 0x13d3, 0x0000, 0x0e43, 0x41e5,
+	    0x2f85, 0x215b, 0x0f52, 0x0000, 0x0000, 0x0000, 0x0475, 0x426b,
+	    0x0000, 0x0432, 0x4e19, 0x0000, 0x018e, 0x1926, 0x2771, 0x15cb,
+	    0x0000, 0x0000, 0x15dd, 0x286c, 0x3668, 0x185b, 0x39dc, 0x46ea,
+	    0x0000, 0x0a92, 0x2c25, 0x36ec, 0x48e9, 0x0000, 0x0227, 0x0000,
+	    0x04f8, 0x0000, 0x28e7, 0x2d0e, 0x2957, 0x0000, 0x0000, 0x3f40,
+	    0x276b, 0x0000, 0x0000, 0x0000, 0x3235, 0x021b, 0x0000, 0x1ab5,
+	    0x2e9c, 0x21e4, 0x1441, 0x3fb0, 0x0820, 0x01e6, 0x0000, 0x0000,
+	    0x1b8b, 0x0000, 0x0000, 0x4162, 0x2c7d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x30eb, 0x3e3e, 0x1c22, 0x0e86, 0x34bd, 0x137b, 0x0552,
+	    0x0000, 0x10d6, 0x0000, 0x0000, 0x4a43, 0x0000, 0x0000, 0x3a95,
+	    0x2897, 0x0000, 0x4aec, 0x0000, 0x0000, 0x3402, 0x148c, 0x01e0,
+	    0x0000, 0x24dc, 0x4d10, 0x3904, 0x38be, 0x2c9f, 0x27e3, 0x1593,
+	    0x0000, 0x2047, 0x3c11, 0x2ba0, 0x351c, 0x0000, 0x3a86, 0x0000,
+	    0x0000, 0x08ec, 0x0000, 0x0000, 0x4287, 0x13aa, 0x4b45, 0x162c,
+	    0x222b, 0x0000, 0x3c11, 0x1d12, 0x33f0, 0x2bd6, 0x0000, 0x42b1,
+	    0x0000, 0x461e, 0x3284, 0x0661, 0x0000, 0x14dc, 0x0000, 0x4031,
+	    0x2496, 0x0000, 0x0952, 0x0000, 0x0000, 0x48f3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a75, 0x0000, 0x0c78,
+	    0x0cda, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ca9, 0x0c10, 0x0000,
+	    0x0000, 0x4878, 0x22de, 0x0000, 0x4d02, 0x0582, 0x0000, 0x48bf,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0eee, 0x0000, 0x1682, 0x0000,
+	    0x4835, 0x0000, 0x133f, 0x303f, 0x0000, 0x0583, 0x31fa, 0x0000,
+	    0x0000, 0x01f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3434, 0x0a74, 0x0000, 0x0b1d, 0x0000, 0x0000, 0x0e5b, 0x2cc2,
+	    0x0000, 0x2d84, 0x0000, 0x0000, 0x40db, 0x4779, 0x0a62, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3a38, 0x269e, 0x0d0b, 0x3c4c, 0x258f,
+	    0x20b4, 0x0000, 0x1629, 0x3613, 0x45ec, 0x0000, 0x4daa, 0x08cc,
+	    0x0000, 0x3287, 0x4a51, 0x1209, 0x0000, 0x0fb3, 0x0e86, 0x27dd,
+	    0x00d6, 0x0000, 0x0c66, 0x0000, 0x28fa, 0x0000, 0x0000, 0x0000,
+	    0x0873, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x44db, 0x02ba,
+	    0x2466, 0x1ac2, 0x0000, 0x3429, 0x389d, 0x120e, 0x262b, 0x1d42,
+	    0x3960, 0x3009, 0x1118, 0x3e11, 0x34ad, 0x0000, 0x113b, 0x0000,
+	    0x1ec3, 0x1231, 0x1cb2, 0x0000, 0x3666, 0x0000, 0x2783, 0x0565,
+	    0x0000, 0x2220, 0x0eed, 0x255d, 0x124f, 0x0000, 0x331e, 0x0000,
+	    0x418d, 0x0000, 0x2eef, 0x20e9, 0x26c2, 0x0000, 0x17a3, 0x4673,
+	    0x1914, 0x0000, 0x3936, 0x3631, 0x3d38, 0x158a, 0x0000, 0x133e,
+	    0x330a, 0x4c83, 0x058c, 0x2352, 0x125a, 0x3ec3, 0x0000, 0x0000,
+	    0x2f94, 0x0000, 0x1748, 0x0000, 0x059f, 0x20bf, 0x0000, 0x14c9,
+	    0x0000, 0x3605, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c27, 0x388c,
+	    0x17b5, 0x0000, 0x49d9, 0x2435, 0x0000, 0x4a6d, 0x365c, 0x05c7,
+	    0x0b57, 0x0000, 0x14f1, 0x3c5d, 0x3355, 0x0000, 0x0000, 0x1b68,
+	    0x0000, 0x01dd, 0x33eb, 0x4692, 0x2c55, 0x0000, 0x1648, 0x2b9f,
+	    0x2eea, 0x0000, 0x1b8a, 0x2702, 0x0229, 0x1916, 0x1b74, 0x4b65,
+	    0x3f00, 0x3600, 0x0000, 0x1b30, 0x16c4, 0x0000, 0x23e1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4a98, 0x0000, 0x4135, 0x0c59, 0x2b12,
+	    0x0000, 0x0000, 0x3b97, 0x0c61, 0x4223, 0x0000, 0x0000, 0x0000,
+	    0x2533, 0x3fb8, 0x0524, 0x0000, 0x18e9, 0x0000, 0x2304, 0x0000,
+	    0x0000, 0x0000, 0x435d, 0x0000, 0x4dca, 0x4da6, 0x1fd5, 0x476f,
+	    0x0000, 0x17a3, 0x4c66, 0x0000, 0x0000, 0x0000, 0x035e, 0x264a,
+	    0x1f95, 0x0000, 0x24d8, 0x0000, 0x0e3b, 0x3445, 0x0000, 0x0000,
+	    0x15d4, 0x4372, 0x0000, 0x21ad, 0x26c5, 0x354c, 0x0000, 0x4c38,
+	    0x2763, 0x3836, 0x3386, 0x41b4, 0x0238, 0x1e1b, 0x0000, 0x430c,
+	    0x0000, 0x21e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f77,
+	    0x181c, 0x0000, 0x0e8b, 0x2f69, 0x0000, 0x0000, 0x2598, 0x326f,
+	    0x18b5, 0x0e64, 0x2a20, 0x0000, 0x2c02, 0x38ce, 0x0e21, 0x3ac8,
+	    0x49ad, 0x0000, 0x0000, 0x1720, 0x3803, 0x1556, 0x0000, 0x0000,
+	    0x01d6, 0x2934, 0x0000, 0x0000, 0x28b9, 0x0000, 0x066f, 0x0000,
+	    0x0000, 0x4c0a, 0x0e64, 0x0000, 0x0000, 0x0000, 0x0371, 0x467e,
+	    0x3094, 0x01e6, 0x3e95, 0x0000, 0x0000, 0x2466, 0x1630, 0x344d,
+	    0x0000, 0x20a9, 0x0000, 0x0000, 0x2003, 0x1b00, 0x4288, 0x20a9,
+	    0x1114, 0x074b, 0x1d0f, 0x380b, 0x4772, 0x2d7c, 0x0fb2, 0x23c1,
+	    0x0000, 0x0b6f, 0x18a4, 0x02d1, 0x0000, 0x3956, 0x0000, 0x11eb,
+	    0x0000, 0x3a5d, 0x0000, 0x0000, 0x0000, 0x31b2, 0x0000, 0x1884,
+	    0x0000, 0x0000, 0x4612, 0x0000, 0x0000, 0x0000, 0x1027, 0x37e2,
+	    0x218e, 0x3295, 0x0c49, 0x103b, 0x4b2d, 0x1a22, 0x2eac, 0x0000,
+	    0x059f, 0x2132, 0x2890, 0x0000, 0x0000, 0x0000, 0x2123, 0x0000,
+	    0x0000, 0x215c, 0x0000, 0x0000, 0x0000, 0x0000, 0x43b7, 0x3000,
+	    0x2398, 0x1162, 0x0000, 0x0000, 0x4a67, 0x3367, 0x2ac4, 0x1140,
+	    0x16f0, 0x2bbf, 0x13e5, 0x0a34, 0x4be3, 0x1b5e, 0x2106, 0x22e8,
+	    0x0e65, 0x2955, 0x0000, 0x0000, 0x3df5, 0x4052, 0x394a, 0x0000,
+	    0x0cb6, 0x0a5e, 0x02e8, 0x0873, 0x0000, 0x0000, 0x3ee6, 0x0000,
+	    0x20cc, 0x4508, 0x4048, 0x0000, 0x404d, 0x0000, 0x0000, 0x28ab,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b28, 0x06b4, 0x1b8b,
+	    0x384b, 0x36ee, 0x3e1a, 0x1d65, 0x2c13, 0x239c, 0x0000, 0x21ac,
+	    0x0000, 0x0000, 0x3ef8, 0x39f9, 0x443f, 0x4bd0, 0x4a8e, 0x0c8a,
+	    0x2434, 0x0000, 0x0000, 0x445b, 0x16f3, 0x4501, 0x3c1c, 0x2d81,
+	    0x0000, 0x1838, 0x3a92, 0x0000, 0x0000, 0x42f9, 0x0000, 0x2361,
+	    0x3ac8, 0x0000, 0x0000, 0x0165, 0x0000, 0x0000, 0x4996, 0x0d82,
+	    0x3ee9, 0x28e5, 0x42bf, 0x1574, 0x0000, 0x0000, 0x2356, 0x0000,
+	    0x0000, 0x0000, 0x37e7, 0x0000, 0x172f, 0x0000, 0x06d7, 0x4576,
+	    0x0000, 0x383b, 0x22da, 0x0000, 0x0000, 0x0000, 0x43d4, 0x3080,
+	    0x277b, 0x0000, 0x0000, 0x0000, 0x391c, 0x0000, 0x2013, 0x1912,
+	    0x0000, 0x12c1, 0x10fb, 0x3a6d, 0x487b, 0x114d, 0x3223, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x39b9, 0x068e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0acc, 0x306f, 0x13d1, 0x0000, 0x0000, 0x0000, 0x2a11,
+	    0x37b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x098f, 0x2d0b, 0x1843,
+	    0x1a7d, 0x0000, 0x0361, 0x3ba2, 0x2ee1, 0x23a8, 0x21e6, 0x2bc6,
+	    0x0000, 0x0000, 0x0968, 0x0000, 0x3d30, 0x0000, 0x3376, 0x0000,
+	    0x4b01, 0x3cf4, 0x28da, 0x0000, 0x0000, 0x0000, 0x0000, 0x3266,
+	    0x2101, 0x0000, 0x07ae, 0x139e, 0x0000, 0x4b51, 0x0a92, 0x0000,
+	    0x0000, 0x0000, 0x1839, 0x0000, 0x00cf, 0x0000, 0x3816, 0x4a1c,
+	    0x0595, 0x0000, 0x30d2, 0x3b47, 0x0000, 0x21ca, 0x0000, 0x34b9,
+	    0x36d5, 0x1dc0, 0x0000, 0x0000, 0x09a4, 0x2b4d, 0x0277, 0x0000,
+	    0x0000, 0x0000, 0x2823, 0x0366, 0x0000, 0x0000, 0x0000, 0x0629,
+	    0x2e51, 0x1946, 0x0000, 0x0000, 0x09a2, 0x378f, 0x31be, 0x0000,
+	    0x0000, 0x04a0, 0x0000, 0x0000, 0x2360, 0x3f30, 0x0000, 0x0000,
+	    0x3029, 0x474e, 0x0000, 0x3332, 0x0000, 0x2069, 0x472e, 0x2998,
+	    0x45df, 0x0000, 0x2d45, 0x17ab, 0x486d, 0x0000, 0x1af6, 0x0464,
+	    0x0000, 0x0000, 0x0000, 0x4021, 0x3354, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3561, 0x4a04, 0x0000, 0x0000, 0x0f6a, 0x0000, 0x0000,
+	    0x19c6, 0x4076, 0x274e, 0x1274, 0x1aa8, 0x0656, 0x0942, 0x01c1,
+	    0x0000, 0x45e0, 0x0000, 0x3cdd, 0x0000, 0x40d1, 0x0000, 0x0000,
+	    0x0000, 0x2ac0, 0x26a5, 0x4120, 0x0000, 0x22c1, 0x11b2, 0x0000,
+	    0x0000, 0x09cd, 0x0000, 0x41d0, 0x0932, 0x0078, 0x0b8c, 0x0000,
+	    0x0000, 0x0e5a, 0x1dbd, 0x16a6, 0x0000, 0x0000, 0x0000, 0x1e07,
+	    0x0ef1, 0x0000, 0x4693, 0x29ad, 0x3698, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4ce4, 0x2e76, 0x387a, 0x1d3b, 0x2b8e,
+	    0x0000, 0x3fff, 0x0000, 0x0000, 0x0000, 0x321c, 0x2e30, 0x0000,
+	    0x384a, 0x0000, 0x0000, 0x0eec, 0x0000, 0x0000, 0x0000, 0x35cd,
+	    0x2df7, 0x0b48, 0x15bd, 0x4cce, 0x0000, 0x171c, 0x0000, 0x0000,
+	    0x3362, 0x0177, 0x49c9, 0x3032, 0x2a3b, 0x0000, 0x021f, 0x48b6,
+	    0x0000, 0x0000, 0x2205, 0x1444, 0x0000, 0x0000, 0x3945, 0x0000,
+	    0x2db1, 0x0000, 0x123f, 0x3569, 0x1d14, 0x210e, 0x1017, 0x3680,
+	    0x0000, 0x20ff, 0x0000, 0x40bf, 0x0fdb, 0x3d8e, 0x4671, 0x3f31,
+	    0x3ea9, 0x0000, 0x0000, 0x0000, 0x00f1, 0x4680, 0x0430, 0x01f8,
+	    0x03d1, 0x441e, 0x2028, 0x4541, 0x1ac8, 0x342c, 0x0000, 0x0000,
+	    0x3965, 0x0000, 0x0000, 0x0000, 0x0bf9, 0x4632, 0x2d35, 0x32fd,
+	    0x0036, 0x0000, 0x0000, 0x3abf, 0x0000, 0x244e, 0x0000, 0x0000,
+	    0x0000, 0x2244, 0x18e1, 0x0000, 0x1f61, 0x492b, 0x0000, 0x1caa,
+	    0x0000, 0x10e5, 0x0000, 0x3e97, 0x127a, 0x0000, 0x45c9, 0x1643,
+	    0x0000, 0x0000, 0x0000, 0x4a9c, 0x2fb8, 0x2117, 0x0000, 0x43d1,
+	    0x0000, 0x0000, 0x3c85, 0x0000, 0x0000, 0x4696, 0x205d, 0x1681,
+	    0x0000, 0x0000, 0x0000, 0x324f, 0x026f, 0x0000, 0x2822, 0x285d,
+	    0x1a32, 0x1308, 0x4508, 0x0479, 0x0000, 0x4be2, 0x4963, 0x0000,
+	    0x483f, 0x0000, 0x3186, 0x302c, 0x0000, 0x0000, 0x47f3, 0x2990,
+	    0x0000, 0x3475, 0x408a, 0x0000, 0x11ba, 0x031c, 0x0000, 0x0000,
+	    0x093f, 0x0000, 0x0000, 0x4786, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x18a6, 0x137c, 0x2c7c, 0x166d, 0x21e1, 0x2114, 0x0000,
+	    0x0000, 0x4321, 0x0000, 0x0000, 0x0000, 0x0000, 0x4112, 0x1153,
+	    0x0000, 0x3353, 0x0000, 0x2a8f, 0x0000, 0x0000, 0x1df8, 0x0000,
+	    0x307f, 0x2c05, 0x3d06, 0x272b, 0x0000, 0x1588, 0x0000, 0x0000,
+	    0x1157, 0x082e, 0x4604, 0x467c, 0x2a30, 0x39ac, 0x0000, 0x0000,
+	    0x229f, 0x10f6, 0x3e20, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3a5b, 0x0000, 0x0000, 0x0000, 0x44f9, 0x0000,
+	    0x41d9, 0x398f, 0x3aab, 0x0000, 0x0000, 0x0000, 0x148e, 0x2740,
+	    0x1e4e, 0x490d, 0x076b, 0x2fed, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3185, 0x0cab, 0x35d9, 0x4d5a, 0x03bf, 0x1213, 0x0000, 0x0000,
+	    0x2df2, 0x164a, 0x43ed, 0x4c7c, 0x22f6, 0x30ed, 0x0000, 0x0000,
+	    0x29b9, 0x3f53, 0x0000, 0x0ecf, 0x306d, 0x0000, 0x0000, 0x0000,
+	    0x0154, 0x0000, 0x0000, 0x178e, 0x348d, 0x0000, 0x0883, 0x4310,
+	    0x0d48, 0x0000, 0x458f, 0x3435, 0x0000, 0x37c8, 0x0000, 0x0000,
+	    0x0000, 0x1202, 0x0000, 0x0000, 0x0000, 0x0000, 0x1244, 0x043f,
+	    0x45b2, 0x0000, 0x4ba2, 0x218e, 0x0000, 0x2ae2, 0x0e0d, 0x4706,
+	    0x0000, 0x2fc1, 0x4c51, 0x0000, 0x4d6c, 0x0000, 0x3096, 0x2d72,
+	    0x0000, 0x0000, 0x20ba, 0x0000, 0x0000, 0x0000, 0x4c4d, 0x0000,
+	    0x3f68, 0x0ed6, 0x42f7, 0x193e, 0x494d, 0x0000, 0x26f5, 0x0000,
+	    0x2493, 0x395a, 0x0770, 0x45b7, 0x10d7, 0x0000, 0x0000, 0x28d3,
+	    0x0000, 0x0000, 0x33ef, 0x4913, 0x0000, 0x0000, 0x2dc8, 0x2ecd,
+	    0x0000, 0x1c75, 0x0000, 0x0000, 0x03ab, 0x297f, 0x1c1b, 0x1a93,
+	    0x0000, 0x2f18, 0x47a7, 0x0000, 0x16a0, 0x0234, 0x1b80, 0x42ff,
+	    0x0a6b, 0x0000, 0x0000, 0x1a31, 0x0000, 0x24f3, 0x0000, 0x0000,
+	    0x0000, 0x3a08, 0x17f2, 0x0000, 0x3e67, 0x0113, 0x1658, 0x41da,
+	    0x05fe, 0x0139, 0x09fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f75,
+	    0x0000, 0x2c71, 0x2c75, 0x0c24, 0x4432, 0x3cf2, 0x0000, 0x2791,
+	    0x1ae3, 0x268f, 0x446b, 0x231b, 0x0000, 0x0000, 0x0000, 0x22e1,
+	    0x3574, 0x0000, 0x1bac, 0x0000, 0x1b39, 0x0a7a, 0x0000, 0x18dd,
+	    0x0000, 0x0000, 0x1085, 0x2b92, 0x0000, 0x25c2, 0x0000, 0x0bad,
+	    0x0000, 0x154c, 0x469c, 0x333a, 0x47cc, 0x3223, 0x2863, 0x0000,
+	    0x391e, 0x3e13, 0x0000, 0x0000, 0x0000, 0x0199, 0x4ce8, 0x141b,
+	    0x2d46, 0x0946, 0x0000, 0x3d5c, 0x0000, 0x0000, 0x0000, 0x3eb2,
+	    0x0cd3, 0x320e, 0x3909, 0x0850, 0x4305, 0x44f6, 0x3c52, 0x0000,
+	    0x0000, 0x4940, 0x372d, 0x0637, 0x0000, 0x31ba, 0x1050, 0x0000,
+	    0x185b, 0x0000, 0x0000, 0x0000, 0x09fd, 0x0000, 0x0ec9, 0x0000,
+	    0x0000, 0x0000, 0x42cd, 0x40c6, 0x0000, 0x0000, 0x023d, 0x0de4,
+	    0x275b, 0x09ac, 0x0000, 0x0000, 0x3dfa, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0d52, 0x3013, 0x0000, 0x369c,
+	    0x0000, 0x4c69, 0x3797, 0x43cc, 0x0608, 0x2ffb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2487, 0x0000, 0x39c0, 0x028d,
+	    0x0000, 0x10b5, 0x09ea, 0x385e, 0x0703, 0x0000, 0x13b7, 0x3b77,
+	    0x0000, 0x4c6f, 0x0000, 0x102d, 0x3a04, 0x2643, 0x0000, 0x0000,
+	    0x23f2, 0x2605, 0x21ba, 0x0000, 0x1547, 0x45d7, 0x0f37, 0x028d,
+	    0x2eb0, 0x0000, 0x0000, 0x0000, 0x076b, 0x0000, 0x39f4, 0x0000,
+	    0x4aa5, 0x4065, 0x2094, 0x0000, 0x1fc0, 0x4895, 0x0000, 0x34ba,
+	    0x0000, 0x30b4, 0x0000, 0x1adf, 0x0000, 0x2ea1, 0x0000, 0x2732,
+	    0x0000, 0x0000, 0x168a, 0x0000, 0x42f5, 0x180c, 0x10b8, 0x0000,
+	    0x0000, 0x384d, 0x0000, 0x0000, 0x1182, 0x0000, 0x46de, 0x20b1,
+	    0x0000, 0x0241, 0x0000, 0x4007, 0x0000, 0x0000, 0x3f9a, 0x37c3,
+	    0x0000, 0x0000, 0x1018, 0x0f77, 0x20bd, 0x459d, 0x3a2c, 0x2291,
+	    0x0000, 0x0000, 0x0000, 0x0fe3, 0x1c14, 0x0000, 0x1d9e, 0x0000,
+	    0x0000, 0x329a, 0x0000, 0x0000, 0x0000, 0x1c46, 0x2a0f, 0x3d53,
+	    0x0000, 0x0000, 0x45c5, 0x308f, 0x3fe8, 0x1304, 0x0000, 0x0000,
+	    0x0000, 0x41c5, 0x3636, 0x1ebe, 0x479c, 0x14d2, 0x0000, 0x1287,
+	    0x0000, 0x0000, 0x2587, 0x48c9, 0x0000, 0x0b03, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x12d6, 0x1309, 0x22cd, 0x017e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4aca, 0x4384, 0x1fcf, 0x0c48, 0x2024,
+	    0x0000, 0x3b9a, 0x0000, 0x1f54, 0x311a, 0x4362, 0x2c86, 0x0000,
+	    0x2151, 0x34a7, 0x009e, 0x0000, 0x0000, 0x0000, 0x0000, 0x4370,
+	    0x3715, 0x12e4, 0x0a6f, 0x0000, 0x0000, 0x0000, 0x1140, 0x0000,
+	    0x3349, 0x3ecd, 0x0000, 0x0ee2, 0x07fb, 0x4416, 0x0000, 0x445d,
+	    0x2c83, 0x0000, 0x45d5, 0x10af, 0x3c1b, 0x3b0b, 0x3038, 0x0000,
+	    0x0000, 0x0000, 0x4a8d, 0x2dec, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x175d, 0x038c, 0x23cf, 0x3d7f, 0x4121, 0x1923, 0x1e58,
+	    0x0000, 0x4a0c, 0x0000, 0x3d0c, 0x0f95, 0x0000, 0x0000, 0x00b8,
+	    0x195c, 0x0000, 0x186b, 0x0000, 0x3cb6, 0x0359, 0x2986, 0x452e,
+	    0x480a, 0x4010, 0x035b, 0x0000, 0x0000, 0x17ea, 0x0000, 0x0c56,
+	    0x0000, 0x0000, 0x1b5c, 0x08db, 0x1bff, 0x4280, 0x31d7, 0x2e77,
+	    0x0000, 0x2815, 0x28ea, 0x0000, 0x0000, 0x3374, 0x0b9f, 0x2d32,
+	    0x3cf8, 0x1384, 0x13e4, 0x0e2e, 0x0000, 0x472c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4505, 0x4769, 0x0000, 0x36d3, 0x0d4f, 0x0000,
+	    0x0000, 0x3293, 0x0000, 0x3848, 0x4a4d, 0x0000, 0x2349, 0x4189,
+	    0x0def, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e12, 0x0000, 0x0000,
+	    0x0000, 0x133c, 0x0000, 0x0000, 0x3ed1, 0x0000, 0x0000, 0x0000,
+	    0x0859, 0x13c1, 0x3629, 0x0000, 0x325d, 0x3a18, 0x4aae, 0x22e3,
+	    0x0000, 0x3c5e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x43ec,
+	    0x15ff, 0x0000, 0x0000, 0x20b7, 0x1786, 0x2d85, 0x2bda, 0x0000,
+	    0x4436, 0x3280, 0x3cbb, 0x0000, 0x32a9, 0x360b, 0x3e9d, 0x0000,
+	    0x4491, 0x0804, 0x0000, 0x2932, 0x0000, 0x27e5, 0x0000, 0x2b8d,
+	    0x0000, 0x370b, 0x0000, 0x4844, 0x17bd, 0x0000, 0x4619, 0x0000,
+	    0x0000, 0x350b, 0x0000, 0x0b9c, 0x24a9, 0x2ef3, 0x0000, 0x0df5,
+	    0x0000, 0x2450, 0x272a, 0x24a3, 0x0000, 0x0000, 0x3225, 0x0fd2,
+	    0x174f, 0x0000, 0x226c, 0x2315, 0x3d82, 0x0000, 0x0c7a, 0x0000,
+	    0x3ab0, 0x0000, 0x3d66, 0x1480, 0x0000, 0x1f43, 0x0000, 0x0000,
+	    0x0000, 0x4660, 0x15a8, 0x3711, 0x2225, 0x03bd, 0x00c7, 0x0000,
+	    0x3d90, 0x0000, 0x38ea, 0x46a0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x33da, 0x0d99, 0x3dd7, 0x0e1d, 0x214d, 0x3c47, 0x0821, 0x0000,
+	    0x222a, 0x0000, 0x0000, 0x0a4d, 0x32d9, 0x0134, 0x0000, 0x0000,
+	    0x0000, 0x410a, 0x0000, 0x3277, 0x0000, 0x30fd, 0x2100, 0x0000,
+	    0x4b16, 0x1713, 0x264c, 0x2eac, 0x1381, 0x0000, 0x1eb5, 0x0000,
+	    0x1a80, 0x0000, 0x0000, 0x2857, 0x30bc, 0x10fa, 0x0000, 0x20ae,
+	    0x0037, 0x3845, 0x2791, 0x2fa7, 0x3ddd, 0x0000, 0x0c69, 0x0000,
+	    0x2764, 0x0000, 0x2101, 0x4a09, 0x05ab, 0x0000, 0x1e42, 0x31ec,
+	    0x0000, 0x0000, 0x0b69, 0x4a66, 0x0d5b, 0x24f6, 0x2309, 0x1868,
+	    0x0000, 0x225f, 0x0459, 0x0000, 0x12a1, 0x1688, 0x08c8, 0x2fe2,
+	    0x0000, 0x0000, 0x4423, 0x0000, 0x033c, 0x0000, 0x0000, 0x1fbc,
+	    0x0000, 0x29ff, 0x0000, 0x0000, 0x3d26, 0x40c1, 0x0000, 0x3588,
+	    0x3921, 0x0000, 0x246a, 0x0000, 0x00fd, 0x0000, 0x4337, 0x078d,
+	    0x1330, 0x390e, 0x31a6, 0x1207, 0x4324, 0x4271, 0x0000, 0x415d,
+	    0x0000, 0x0000, 0x0000, 0x01a5, 0x0000, 0x26fa, 0x446a, 0x0000,
+	    0x0000, 0x4d3a, 0x1408, 0x0000, 0x0000, 0x24c1, 0x0000, 0x1733,
+	    0x00bc, 0x0e93, 0x00de, 0x0000, 0x2cc1, 0x2f55, 0x05c2, 0x0000,
+	    0x1667, 0x4603, 0x321e, 0x2d5d, 0x1827, 0x0000, 0x3ec3, 0x0000,
+	    0x0ed5, 0x0000, 0x2037, 0x0000, 0x0000, 0x08d7, 0x0000, 0x0000,
+	    0x0f17, 0x2604, 0x0000, 0x0000, 0x0000, 0x1d85, 0x45ef, 0x306a,
+	    0x0000, 0x0000, 0x1a97, 0x0000, 0x4864, 0x0000, 0x3b4f, 0x1d2a,
+	    0x0000, 0x0000, 0x4289, 0x30a6, 0x0000, 0x032c, 0x44c7, 0x0000,
+	    0x0000, 0x0000, 0x4405, 0x0e31, 0x28a5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1646, 0x0846, 0x15d6, 0x1a27, 0x2c3e, 0x1e0f,
+	    0x0000, 0x0000, 0x0000, 0x2dd2, 0x0000, 0x3e0e, 0x3660, 0x0000,
+	    0x1d22, 0x3b96, 0x4abf, 0x0000, 0x48ff, 0x0000, 0x27b6, 0x0000,
+	    0x0000, 0x0000, 0x49e9, 0x27fe, 0x0000, 0x0000, 0x079f, 0x0583,
+	    0x0000, 0x0000, 0x0000, 0x1cf7, 0x12d7, 0x4d96, 0x15d4, 0x31b5,
+	    0x2477, 0x0000, 0x2d89, 0x0000, 0x3442, 0x3588, 0x1ddc, 0x0000,
+	    0x2839, 0x15fc, 0x0000, 0x2c1f, 0x0862, 0x009b, 0x147c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0397, 0x01fc,
+	    0x0000, 0x0000, 0x0000, 0x3a4d, 0x0000, 0x4b7c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x01ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x115c, 0x4c97, 0x24fa, 0x0000, 0x0000, 0x0000, 0x473d,
+	    0x0000, 0x34ab, 0x21fd, 0x2be0, 0x323e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x049a, 0x0000, 0x1698, 0x3140,
+	    0x1217, 0x0000, 0x251c, 0x4df4, 0x0000, 0x19fb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3ded, 0x2029, 0x271f, 0x2846, 0x420a, 0x4345,
+	    0x0eb0, 0x0000, 0x1fc5, 0x0000, 0x0000, 0x22ee, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2cff, 0x0000, 0x0000, 0x1b80, 0x4515, 0x00c0,
+	    0x0000, 0x0a08, 0x1abc, 0x0000, 0x0000, 0x1edc, 0x0000, 0x0000,
+	    0x0000, 0x20df, 0x0000, 0x3310, 0x2ed1, 0x0099, 0x2ddf, 0x4c8b,
+	    0x1c21, 0x1390, 0x0000, 0x13bd, 0x38b4, 0x3581, 0x2ae4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x44b6, 0x41d3, 0x48e7, 0x0000, 0x2625,
+	    0x3308, 0x46e6, 0x43e6, 0x0000, 0x0ff3, 0x0000, 0x0000, 0x070c,
+	    0x0000, 0x27dd, 0x180c, 0x0000, 0x0000, 0x20c7, 0x1081, 0x0000,
+	    0x1c4f, 0x2193, 0x0000, 0x325b, 0x4b48, 0x2e7f, 0x2730, 0x0000,
+	    0x3ae2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7c, 0x24d6,
+	    0x44e9, 0x38b0, 0x0863, 0x0000, 0x0000, 0x0000, 0x18b1, 0x425b,
+	    0x0000, 0x0000, 0x3d0d, 0x447e, 0x0000, 0x2276, 0x0889, 0x2d58,
+	    0x0000, 0x4b7c, 0x1a26, 0x0000, 0x0000, 0x3f99, 0x31f5, 0x314d,
+	    0x0f19, 0x0000, 0x0000, 0x1fd2, 0x0000, 0x07b5, 0x39c8, 0x3ea4,
+	    0x4e1e, 0x221a, 0x0000, 0x20ef, 0x4c69, 0x0507, 0x0f13, 0x0000,
+	    0x299e, 0x252a, 0x0000, 0x0f93, 0x1bec, 0x4880, 0x42d2, 0x06bf,
+	    0x1949, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1822,
+	    0x0000, 0x09b9, 0x0000, 0x0000, 0x0000, 0x3bbf, 0x0000, 0x2192,
+	    0x1650, 0x0985, 0x0000, 0x1718, 0x0000, 0x0000, 0x46e0, 0x3f23,
+	    0x0000, 0x0000, 0x3f29, 0x0000, 0x476f, 0x03af, 0x283f, 0x4bf3,
+	    0x0761, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c58, 0x0000, 0x1777,
+	    0x0f38, 0x0000, 0x0000, 0x372b, 0x0342, 0x0000, 0x0000, 0x0000,
+	    0x4dfe, 0x0000, 0x0374, 0x3268, 0x0000, 0x0000, 0x0000, 0x45eb,
+	    0x0000, 0x262a, 0x0000, 0x2d0d, 0x0000, 0x42d9, 0x0000, 0x35ca,
+	    0x0000, 0x102f, 0x0570, 0x26e5, 0x0000, 0x2fe6, 0x439b, 0x0f2c,
+	    0x1226, 0x2369, 0x0000, 0x0000, 0x0000, 0x1de1, 0x0000, 0x469a,
+	    0x0000, 0x2382, 0x0000, 0x0000, 0x082b, 0x2ecf, 0x04bf, 0x3bf0,
+	    0x4c55, 0x0000, 0x0000, 0x040a, 0x0000, 0x0000, 0x279e, 0x24a8,
+	    0x2400, 0x0000, 0x0000, 0x1719, 0x0484, 0x0000, 0x4055, 0x4ce1,
+	    0x487c, 0x0000, 0x46a8, 0x0000, 0x03b5, 0x074c, 0x2f59, 0x4711,
+	    0x4de4, 0x0000, 0x0fa1, 0x4957, 0x0000, 0x4122, 0x3565, 0x14ab,
+	    0x2059, 0x0000, 0x0000, 0x1d96, 0x4070, 0x0000, 0x0000, 0x432c,
+	    0x0000, 0x0000, 0x0000, 0x4487, 0x199b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0b0f, 0x0000, 0x0000, 0x25ae, 0x0504, 0x4804, 0x0000,
+	    0x25e8, 0x3442, 0x0da2, 0x1c19, 0x1e6c, 0x3b09, 0x2891, 0x30c8,
+	    0x0000, 0x0000, 0x2af0, 0x0255, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3f90, 0x3757, 0x142c, 0x0000, 0x15e4, 0x0000,
+	    0x0de4, 0x0000, 0x0000, 0x444b, 0x0000, 0x26e6, 0x0000, 0x491b,
+	    0x0000, 0x0e99, 0x1050, 0x3f52, 0x1cf0, 0x3925, 0x27d6, 0x15ce,
+	    0x0d47, 0x230b, 0x0000, 0x3b4c, 0x1b25, 0x0000, 0x4b87, 0x3009,
+	    0x071a, 0x159d, 0x4262, 0x0d5d, 0x0000, 0x3f30, 0x2103, 0x18f2,
+	    0x217b, 0x4244, 0x1997, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1892, 0x0000, 0x0000, 0x1da8, 0x1d20,
+	    0x0000, 0x127e, 0x0000, 0x10d0, 0x0000, 0x3454, 0x1c11, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2675, 0x0000, 0x19ed, 0x0000,
+	    0x0671, 0x39ac, 0x0000, 0x28a3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4cb1, 0x0dc8, 0x0000, 0x0000, 0x0000, 0x0000, 0x4da5,
+	    0x14c8, 0x396e, 0x0136, 0x0000, 0x1f17, 0x2ae6, 0x4a84, 0x0000,
+	    0x0c69, 0x3ce3, 0x4d7c, 0x0140, 0x3e5e, 0x0bf7, 0x0b4d, 0x0000,
+	    0x0000, 0x0000, 0x37d6, 0x2491, 0x0000, 0x040c, 0x41c8, 0x1a5c,
+	    0x0000, 0x0000, 0x0c82, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ff4,
+	    0x1b81, 0x0000, 0x237e, 0x000a, 0x42b3, 0x0000, 0x0000, 0x444f,
+	    0x0000, 0x3148, 0x1548, 0x3c57, 0x3062, 0x0000, 0x0000, 0x0000,
+	    0x23f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f69, 0x0000, 0x0000,
+	    0x3c8a, 0x0000, 0x19ba, 0x0000, 0x0000, 0x020a, 0x0000, 0x4b45,
+	    0x01ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x3dd8, 0x27b7, 0x0000,
+	    0x4802, 0x0891, 0x213c, 0x20d7, 0x1416, 0x04ff, 0x24ad, 0x1255,
+	    0x37ad, 0x36ab, 0x0000, 0x0000, 0x00b9, 0x38b7, 0x3307, 0x0000,
+	    0x14bf, 0x4801, 0x0d61, 0x48b6, 0x32c4, 0x0000, 0x1cf6, 0x2455,
+	    0x0000, 0x3b47, 0x0000, 0x0000, 0x1971, 0x4bf1, 0x0000, 0x0000,
+	    0x0000, 0x0bd1, 0x43a6, 0x0000, 0x0000, 0x425d, 0x0000, 0x0000,
+	    0x24bb, 0x0878, 0x0000, 0x4333, 0x4b8e, 0x0000, 0x3ded, 0x38be,
+	    0x311a, 0x03d9, 0x12cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x3850,
+	    0x3174, 0x0000, 0x000d, 0x13e6, 0x1093, 0x3a0f, 0x0000, 0x3869,
+	    0x0390, 0x1811, 0x0000, 0x0000, 0x1464, 0x45b8, 0x4c79, 0x3244,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x093e, 0x40ca, 0x0000, 0x0000,
+	    0x0000, 0x23d5, 0x4061, 0x0000, 0x0000, 0x039f, 0x103d, 0x0000,
+	    0x0000, 0x49e7, 0x2d0b, 0x1db7, 0x38a2, 0x2469, 0x0000, 0x0000,
+	    0x4937, 0x0000, 0x0728, 0x0000, 0x1110, 0x0512, 0x0000, 0x258f,
+	    0x0000, 0x0000, 0x2b70, 0x4995, 0x2a8f, 0x1f9b, 0x0000, 0x0000,
+	    0x0000, 0x3827, 0x0000, 0x0000, 0x2bba, 0x0000, 0x2e01, 0x0000,
+	    0x0000, 0x1f54, 0x4003, 0x0000, 0x1de5, 0x0000, 0x1681, 0x0000,
+	    0x0000, 0x0000, 0x1545, 0x0000, 0x3e89, 0x0000, 0x3272, 0x455a,
+	    0x0000, 0x0000, 0x4be6, 0x0000, 0x13ce, 0x0000, 0x381b, 0x0000,
+	    0x0cce, 0x1f8b, 0x352c, 0x0e49, 0x0000, 0x0000, 0x0000, 0x1be8,
+	    0x25b6, 0x3eb9, 0x0000, 0x1f51, 0x0000, 0x0000, 0x130e, 0x2ec0,
+	    0x0000, 0x1bc4, 0x0000, 0x0000, 0x2bee, 0x2da5, 0x1d76, 0x4291,
+	    0x0000, 0x0000, 0x0000, 0x0cb9, 0x0000, 0x2d20, 0x42ff, 0x3894,
+	    0x054c, 0x0000, 0x2309, 0x0000, 0x0000, 0x0000, 0x48f7, 0x0000,
+	    0x0000, 0x0a07, 0x0e57, 0x42c9, 0x4b6e, 0x275a, 0x0ed8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x10c7, 0x0c51, 0x1540, 0x0000, 0x0000,
+	    0x3431, 0x29a3, 0x0000, 0x0000, 0x0000, 0x0979, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0ed9, 0x389b, 0x4bb9, 0x0fa0, 0x0000, 0x1566,
+	    0x1e92, 0x1638, 0x0000, 0x0000, 0x0000, 0x0031, 0x0000, 0x1d8f,
+	    0x14f2, 0x1255, 0x0000, 0x2949, 0x1e7d, 0x0000, 0x1c40, 0x0d86,
+	    0x0fd1, 0x1261, 0x0000, 0x444e, 0x3d6e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0e6f, 0x0000, 0x0000, 0x0000, 0x0a91, 0x44b8, 0x4b14,
+	    0x3539, 0x4ded, 0x468b, 0x474d, 0x0000, 0x0000, 0x3cbe, 0x1933,
+	    0x4586, 0x238e, 0x0000, 0x1440, 0x0000, 0x3fd9, 0x4a52, 0x0000,
+	    0x19a5, 0x2775, 0x2983, 0x0000, 0x4cf0, 0x123f, 0x1a97, 0x2052,
+	    0x13f5, 0x330e, 0x0000, 0x3ccc, 0x04d4, 0x0000, 0x3bac, 0x0000,
+	    0x0000, 0x0296, 0x4d7b, 0x24c7, 0x0000, 0x055d, 0x0000, 0x49d2,
+	    0x0000, 0x2169, 0x4555, 0x0000, 0x076c, 0x0000, 0x1cee, 0x0000,
+	    0x33dc, 0x0c10, 0x34a7, 0x41f5, 0x0000, 0x1ffa, 0x36f8, 0x0000,
+	    0x4c10, 0x0000, 0x38e3, 0x0000, 0x351f, 0x0000, 0x1f4c, 0x0213,
+	    0x0000, 0x4b5e, 0x0608, 0x1025, 0x476b, 0x0000, 0x3530, 0x0000,
+	    0x3d2e, 0x0000, 0x4d8c, 0x18dc, 0x0000, 0x0853, 0x0e6a, 0x3e4b,
+	    0x4774, 0x1ed5, 0x0000, 0x38e1, 0x0000, 0x0000, 0x3711, 0x255f,
+	    0x2c56, 0x0000, 0x184a, 0x0000, 0x3444, 0x31b5, 0x2128, 0x12b0,
+	    0x460b, 0x434f, 0x10a0, 0x0000, 0x335d, 0x28b7, 0x0c97, 0x45aa,
+	    0x0000, 0x2d84, 0x244e, 0x2b34, 0x4b21, 0x41d4, 0x0000, 0x4c55,
+	    0x0000, 0x0035, 0x0000, 0x0000, 0x0000, 0x13c5, 0x0000, 0x39dc,
+	    0x1fab, 0x0000, 0x28e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x2082,
+	    0x0b64, 0x0329, 0x0000, 0x2fdc, 0x0000, 0x0000, 0x279f, 0x2e24,
+	    0x15c9, 0x3343, 0x17c4, 0x4901, 0x368c, 0x40d9, 0x1c52, 0x0067,
+	    0x1bda, 0x1677, 0x0000, 0x267f, 0x0cf6, 0x26bd, 0x1e5a, 0x0000,
+	    0x4045, 0x0000, 0x2d3d, 0x3b11, 0x0000, 0x3b33, 0x239e, 0x04e8,
+	    0x2265, 0x0000, 0x1433, 0x01bd, 0x3fad, 0x122f, 0x0000, 0x0000,
+	    0x0000, 0x48d5, 0x4c18, 0x0000, 0x213a, 0x0000, 0x3787, 0x0000,
+	    0x10c2, 0x1b57, 0x006e, 0x0000, 0x305b, 0x18c9, 0x4600, 0x0000,
+	    0x464e, 0x18e7, 0x203a, 0x0000, 0x0000, 0x4629, 0x2e4b, 0x0000,
+	    0x0000, 0x1a06, 0x03ce, 0x0000, 0x0000, 0x35ab, 0x4444, 0x0000,
+	    0x1121, 0x0c58, 0x0000, 0x0d4d, 0x0a2f, 0x1739, 0x2e88, 0x2a14,
+	    0x0000, 0x0cd8, 0x0000, 0x0000, 0x21eb, 0x0000, 0x20cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4c16, 0x1abc, 0x0000, 0x46ee, 0x0000,
+	    0x3ce4, 0x009d, 0x1df2, 0x1744, 0x3a24, 0x14d0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0634, 0x04a6, 0x4617, 0x468e, 0x0b83, 0x0000,
+	    0x3515, 0x0000, 0x4ddc, 0x0000, 0x44b8, 0x0000, 0x0000, 0x0000,
+	    0x1ec2, 0x4bc0, 0x4ac3, 0x1577, 0x0000, 0x0000, 0x0000, 0x139e,
+	    0x0000, 0x1d6b, 0x1056, 0x1bfc, 0x0000, 0x0000, 0x3803, 0x494c,
+	    0x32c3, 0x1aaa, 0x3295, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x159b, 0x0a96, 0x1292, 0x262a, 0x4419, 0x234c, 0x0789,
+	    0x46f1, 0x0000, 0x1737, 0x0000, 0x3941, 0x10b6, 0x300b, 0x0000,
+	    0x1af0, 0x0000, 0x317b, 0x40cd, 0x21f4, 0x0000, 0x1824, 0x0000,
+	    0x0036, 0x0000, 0x4560, 0x0000, 0x3b19, 0x04d6, 0x32c2, 0x37bb,
+	    0x0637, 0x0000, 0x0000, 0x1711, 0x0ae6, 0x0000, 0x0864, 0x0000,
+	    0x4cf9, 0x2216, 0x0000, 0x0000, 0x089a, 0x0000, 0x0000, 0x1715,
+	    0x0000, 0x0000, 0x1517, 0x2609, 0x18ad, 0x2082, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x27ab, 0x07de, 0x0cdd, 0x1519, 0x35de, 0x3ca4, 0x0000, 0x0000,
+	    0x0000, 0x2706, 0x0000, 0x3e73, 0x0000, 0x0000, 0x3f87, 0x3532,
+	    0x2775, 0x0000, 0x0000, 0x189e, 0x2ec4, 0x0000, 0x0000, 0x0000,
+	    0x35e7, 0x3c30, 0x0000, 0x2996, 0x0000, 0x3243, 0x0000, 0x0000,
+	    0x0b7d, 0x0f85, 0x11ed, 0x0aad, 0x0000, 0x0b08, 0x3eb1, 0x0000,
+	    0x0000, 0x0000, 0x3de5, 0x4c46, 0x349e, 0x0000, 0x0000, 0x2a95,
+	    0x215b, 0x121c, 0x0bfe, 0x0b7e, 0x33cd, 0x2396, 0x0000, 0x4971,
+	    0x0000, 0x12a4, 0x20bc, 0x364a, 0x28dc, 0x0000, 0x12bb, 0x0000,
+	    0x33e5, 0x0000, 0x1fdd, 0x0925, 0x17c0, 0x0000, 0x0000, 0x20cf,
+	    0x31f8, 0x4129, 0x0000, 0x3336, 0x01f7, 0x3a41, 0x0000, 0x49a0,
+	    0x4239, 0x339d, 0x0f25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1a82, 0x0add, 0x4932, 0x0000, 0x0000, 0x0046, 0x11f5, 0x0000,
+	    0x2f26, 0x108b, 0x0000, 0x4256, 0x0000, 0x29c8, 0x0df9, 0x2946,
+	    0x24c7, 0x0000, 0x0000, 0x0000, 0x3b5c, 0x0000, 0x2599, 0x0000,
+	    0x1ded, 0x0000, 0x0000, 0x044b, 0x1f29, 0x0000, 0x1f3e, 0x0000,
+	    0x0000, 0x100b, 0x0000, 0x0000, 0x1994, 0x0a3d, 0x0000, 0x0000,
+	    0x0cbe, 0x0000, 0x4b2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x298f,
+	    0x0000, 0x263c, 0x3927, 0x1b29, 0x2fd4, 0x21e4, 0x0000, 0x0000,
+	    0x38ff, 0x0387, 0x0000, 0x31cf, 0x0000, 0x0000, 0x0000, 0x405d,
+	    0x0000, 0x08ae, 0x2556, 0x0000, 0x0000, 0x3ed4, 0x0000, 0x29e7,
+	    0x4573, 0x460f, 0x0000, 0x2c0f, 0x31b8, 0x0fa2, 0x0000, 0x0000,
+	    0x008a, 0x48bc, 0x3b21, 0x35f5, 0x0000, 0x02bc, 0x274e, 0x0000,
+	    0x0000, 0x1565, 0x0000, 0x2279, 0x1850, 0x0000, 0x4ce1, 0x3ed7,
+	    0x0000, 0x40c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x20a2, 0x1bf9,
+	    0x1cfe, 0x0000, 0x047d, 0x0000, 0x0000, 0x4bcb, 0x021f, 0x0000,
+	    0x27b3, 0x0000, 0x0000, 0x3add, 0x4aaa, 0x0000, 0x0000, 0x0000,
+	    0x4512, 0x28ed, 0x0000, 0x37e4, 0x0000, 0x145a, 0x3e2a, 0x0000,
+	    0x308d, 0x465d, 0x29d1, 0x0000, 0x0000, 0x0498, 0x0000, 0x0000,
+	    0x1484, 0x0000, 0x0938, 0x0000, 0x0000, 0x35db, 0x4145, 0x0000,
+	    0x2907, 0x0000, 0x0000, 0x28ff, 0x0000, 0x2d99, 0x1972, 0x0444,
+	    0x0000, 0x0000, 0x189a, 0x0000, 0x21de, 0x4ad0, 0x4925, 0x12d8,
+	    0x22c7, 0x4493, 0x1195, 0x0000, 0x019e, 0x0000, 0x071f, 0x0000,
+	    0x2776, 0x34a4, 0x079e, 0x3987, 0x09f0, 0x0000, 0x0000, 0x2be0,
+	    0x0000, 0x0000, 0x0000, 0x0b2c, 0x344e, 0x0000, 0x0049, 0x0000,
+	    0x0000, 0x0883, 0x0000, 0x13c9, 0x0000, 0x35da, 0x3357, 0x0000,
+	    0x4591, 0x0000, 0x2766, 0x34b5, 0x0846, 0x0000, 0x0000, 0x0000,
+	    0x46c3, 0x095d, 0x0000, 0x22e9, 0x4039, 0x1018, 0x233f, 0x3fc4,
+	    0x0000, 0x2155, 0x0000, 0x1fa5, 0x05ef, 0x0000, 0x0000, 0x0000,
+	    0x1ac3, 0x3829, 0x1e1a, 0x0000, 0x0000, 0x3759, 0x0000, 0x0000,
+	    0x3326, 0x2be8, 0x06d9, 0x4da4, 0x0759, 0x3291, 0x09a6, 0x0690,
+	    0x3ebc, 0x4cdb, 0x0e16, 0x3075, 0x0000, 0x0000, 0x0000, 0x4c0f,
+	    0x22fa, 0x0000, 0x3c44, 0x1086, 0x2898, 0x0000, 0x0000, 0x0000,
+	    0x0c3b, 0x32c1, 0x251b, 0x0000, 0x0000, 0x0000, 0x2fa1, 0x0000,
+	    0x2286, 0x0000, 0x0000, 0x0000, 0x358d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4490, 0x0000, 0x0000, 0x3756, 0x0000,
+	    0x0000, 0x0000, 0x3bc6, 0x04df, 0x3da5, 0x01ab, 0x15cc, 0x2dd7,
+	    0x0000, 0x27d1, 0x0000, 0x0000, 0x0000, 0x3e27, 0x0487, 0x0000,
+	    0x20fe, 0x4180, 0x0000, 0x0000, 0x28b8, 0x0000, 0x2715, 0x430e,
+	    0x35a8, 0x0000, 0x3d82, 0x050a, 0x0000, 0x3048, 0x0000, 0x28f5,
+	    0x0000, 0x15e3, 0x227a, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e53,
+	    0x0000, 0x3912, 0x3d65, 0x26e2, 0x0000, 0x019a, 0x0938, 0x20de,
+	    0x45e6, 0x08fd, 0x0000, 0x0000, 0x0000, 0x4a56, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x218b, 0x2eee, 0x07cf, 0x40f1, 0x0000,
+	    0x0000, 0x1d6f, 0x3e9c, 0x4636, 0x04a2, 0x1003, 0x131a, 0x34fc,
+	    0x1c46, 0x103d, 0x0000, 0x4a98, 0x0000, 0x1eaf, 0x0000, 0x164f,
+	    0x0000, 0x3be9, 0x10e3, 0x3335, 0x0000, 0x46f6, 0x39c1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4b31, 0x0000, 0x3b28, 0x3373,
+	    0x0000, 0x49e9, 0x048d, 0x2cfb, 0x24e7, 0x40e2, 0x2926, 0x0000,
+	    0x0000, 0x361f, 0x473e, 0x3f9b, 0x0000, 0x1671, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04aa, 0x49cc, 0x0000, 0x0000, 0x0000,
+	    0x3a6f, 0x224a, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f70, 0x3420,
+	    0x34d9, 0x0000, 0x3716, 0x2a8d, 0x4a82, 0x4d7b, 0x0afb, 0x4120,
+	    0x0000, 0x254f, 0x0000, 0x2725, 0x3664, 0x0000, 0x09a7, 0x0000,
+	    0x2531, 0x3b0c, 0x0000, 0x237e, 0x2e25, 0x3473, 0x0da3, 0x4313,
+	    0x0000, 0x077b, 0x1121, 0x40d9, 0x0000, 0x0000, 0x456e, 0x1a6a,
+	    0x2838, 0x0000, 0x1c27, 0x3dff, 0x1f59, 0x1b52, 0x0000, 0x3d67,
+	    0x0000, 0x2554, 0x0d40, 0x0000, 0x0000, 0x140f, 0x0d44, 0x0000,
+	    0x308f, 0x0000, 0x29b5, 0x0000, 0x286d, 0x3a39, 0x0000, 0x481f,
+	    0x0000, 0x2be0, 0x11e7, 0x1477, 0x0000, 0x12f6, 0x0000, 0x22a9,
+	    0x3c8f, 0x1ca3, 0x3ae4, 0x0000, 0x22c3, 0x43c0, 0x4dfe, 0x0000,
+	    0x2e92, 0x1544, 0x17f0, 0x47f5, 0x2204, 0x1db8, 0x0420, 0x235f,
+	    0x0000, 0x2f4e, 0x0000, 0x0000, 0x2542, 0x0000, 0x43ea, 0x39f4,
+	    0x0000, 0x4867, 0x4d9d, 0x0000, 0x1324, 0x0c11, 0x0000, 0x2305,
+	    0x49ad, 0x331d, 0x0000, 0x2782, 0x40d0, 0x05bf, 0x0000, 0x3a1c,
+	    0x0000, 0x0000, 0x28ce, 0x0000, 0x30eb, 0x2b15, 0x0000, 0x1d75,
+	    0x0000, 0x0000, 0x0000, 0x15c4, 0x0000, 0x4cf7, 0x1fe7, 0x2ad9,
+	    0x0000, 0x11aa, 0x0000, 0x1aaa, 0x0000, 0x2b9c, 0x0676, 0x0000,
+	    0x1a69, 0x0000, 0x1c35, 0x0000, 0x0000, 0x34ef, 0x12a4, 0x4d4a,
+	    0x367d, 0x48c4, 0x204c, 0x0000, 0x38ac, 0x1f5e, 0x4981, 0x0000,
+	    0x2e59, 0x1912, 0x0000, 0x3abc, 0x0000, 0x4c1d, 0x0ce8, 0x0000,
+	    0x39f0, 0x0000, 0x4b87, 0x26a8, 0x0000, 0x0000, 0x0a0c, 0x1aaa,
+	    0x0000, 0x0a11, 0x0000, 0x0000, 0x2a19, 0x0000, 0x3481, 0x1cc7,
+	    0x0000, 0x0000, 0x0000, 0x01ee, 0x4361, 0x0000, 0x0000, 0x3a34,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4151, 0x0000, 0x40f2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x115e, 0x0000, 0x0000, 0x0000, 0x3bf7,
+	    0x3d75, 0x17a2, 0x1628, 0x0000, 0x0000, 0x4db9, 0x1fdf, 0x0000,
+	    0x0000, 0x3996, 0x069b, 0x3020, 0x0000, 0x0227, 0x0000, 0x4ccc,
+	    0x2dac, 0x39e3, 0x2f18, 0x1acf, 0x0000, 0x35cb, 0x32d4, 0x0000,
+	    0x0000, 0x09c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x390c, 0x18bf,
+	    0x3b7e, 0x28fa, 0x3fbf, 0x0000, 0x36fb, 0x1915, 0x0000, 0x2963,
+	    0x2063, 0x2af5, 0x4669, 0x0000, 0x145e, 0x0000, 0x145f, 0x0000,
+	    0x1add, 0x203b, 0x3de8, 0x2546, 0x4730, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2190, 0x0000, 0x43aa, 0x0000, 0x0000, 0x0000,
+	    0x2498, 0x4625, 0x0000, 0x07a4, 0x45b0, 0x17c7, 0x4cf3, 0x0000,
+	    0x22dc, 0x1e4b, 0x0000, 0x1ed5, 0x477c, 0x0000, 0x0000, 0x449d,
+	    0x0000, 0x0000, 0x339d, 0x0000, 0x0000, 0x051c, 0x0000, 0x4aa6,
+	    0x0000, 0x0000, 0x1dbe, 0x25ed, 0x4995, 0x4be7, 0x2cdb, 0x18b7,
+	    0x1c63, 0x3eaf, 0x33e0, 0x0000, 0x3dc9, 0x37a7, 0x0cfc, 0x4408,
+	    0x0000, 0x14e8, 0x4406, 0x0000, 0x0c1e, 0x35cb, 0x306d, 0x3059,
+	    0x43e5, 0x3ebf, 0x0000, 0x0000, 0x03f7, 0x10d1, 0x0000, 0x0000,
+	    0x0000, 0x09e6, 0x0000, 0x47c4, 0x0000, 0x41c4, 0x094f, 0x0000,
+	    0x358b, 0x1cad, 0x24d4, 0x0000, 0x16e2, 0x2440, 0x11d6, 0x1470,
+	    0x244c, 0x3509, 0x3f32, 0x3c13, 0x0000, 0x456d, 0x3112, 0x3608,
+	    0x06be, 0x0000, 0x0000, 0x2caa, 0x0000, 0x0000, 0x4088, 0x4a89,
+	    0x3fa2, 0x0000, 0x0000, 0x0000, 0x0000, 0x440f, 0x0000, 0x0b2d,
+	    0x1958, 0x0000, 0x0000, 0x0000, 0x0000, 0x4577, 0x4c73, 0x2535,
+	    0x337b, 0x0000, 0x01ff, 0x3d76, 0x2b3d, 0x0000, 0x0000, 0x0000,
+	    0x4bd4, 0x0000, 0x0000, 0x4d22, 0x0000, 0x41e1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x05c2, 0x0000, 0x007b, 0x2a14, 0x0000, 0x0000,
+	    0x454b, 0x13b9, 0x0026, 0x0860, 0x0000, 0x0000, 0x1fc2, 0x1a25,
+	    0x1183, 0x0e03, 0x3393, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1735, 0x0000, 0x401e, 0x24a1, 0x4968, 0x0000, 0x0e98,
+	    0x0000, 0x1b13, 0x0000, 0x0000, 0x1f1b, 0x0753, 0x4b9b, 0x432c,
+	    0x315c, 0x3fb8, 0x076f, 0x42f2, 0x0000, 0x0000, 0x4db8, 0x1e2b,
+	    0x0000, 0x1d7c, 0x0ebf, 0x2f21, 0x2d0e, 0x3f37, 0x020f, 0x08ea,
+	    0x4ab3, 0x0000, 0x4812, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x15ea, 0x0000, 0x007c, 0x44ce, 0x0000, 0x334c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2988, 0x0332, 0x0b48, 0x0000, 0x1e48, 0x0e56,
+	    0x256a, 0x0000, 0x0000, 0x24e7, 0x1050, 0x1207, 0x3fed, 0x0000,
+	    0x0000, 0x0000, 0x1ddc, 0x3981, 0x3ade, 0x26ed, 0x4399, 0x0000,
+	    0x0000, 0x277b, 0x0000, 0x0000, 0x30b0, 0x0000, 0x223c, 0x0000,
+	    0x4921, 0x0000, 0x0000, 0x30db, 0x13e0, 0x183d, 0x1923, 0x0000,
+	    0x0000, 0x3511, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b22, 0x2efc,
+	    0x0000, 0x10bb, 0x0adb, 0x4c61, 0x3b06, 0x37fe, 0x1321, 0x4486,
+	    0x0000, 0x1b13, 0x42a3, 0x2c23, 0x0000, 0x0000, 0x30d3, 0x0000,
+	    0x07e6, 0x250f, 0x03b6, 0x0000, 0x040f, 0x1eaf, 0x0d34, 0x0000,
+	    0x2278, 0x0000, 0x1379, 0x0e4d, 0x0e52, 0x23c2, 0x0000, 0x403d,
+	    0x0187, 0x1a71, 0x0000, 0x0d95, 0x4ab2, 0x3a5e, 0x0000, 0x0000,
+	    0x4917, 0x384d, 0x1bbe, 0x0000, 0x4210, 0x0000, 0x3b2c, 0x3dea,
+	    0x0000, 0x4190, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0e0d, 0x12c2, 0x22fb, 0x4304, 0x0000, 0x3fa3, 0x377d,
+	    0x2509, 0x0000, 0x0000, 0x17d5, 0x2bb9, 0x469c, 0x0000, 0x1b9f,
+	    0x0000, 0x0000, 0x490b, 0x3e3b, 0x388d, 0x43d8, 0x25eb, 0x0000,
+	    0x09b8, 0x4cb1, 0x0000, 0x3574, 0x4ade, 0x0000, 0x0000, 0x0000,
+	    0x0e4b, 0x3bd9, 0x34df, 0x09cc, 0x366d, 0x1591, 0x0000, 0x253c,
+	    0x056f, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c65, 0x0000, 0x0000,
+	    0x05ad, 0x3d3f, 0x3984, 0x0000, 0x08d5, 0x0000, 0x0859, 0x0000,
+	    0x042c, 0x0000, 0x04af, 0x192a, 0x0000, 0x0000, 0x0954, 0x0000,
+	    0x0000, 0x27c1, 0x0c36, 0x006f, 0x374a, 0x07f0, 0x1d94, 0x3df3,
+	    0x0000, 0x224f, 0x0000, 0x30ae, 0x3c07, 0x0000, 0x042c, 0x0000,
+	    0x1af0, 0x0000, 0x0000, 0x2f32, 0x15bd, 0x2d32, 0x3f67, 0x3fa8,
+	    0x1430, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c69, 0x0000, 0x0000,
+	    0x34ac, 0x0000, 0x0000, 0x15d8, 0x0000, 0x0000, 0x0000, 0x2d2e,
+	    0x4925, 0x0000, 0x0000, 0x0000, 0x40dd, 0x423b, 0x0000, 0x0000,
+	    0x1528, 0x0000, 0x0000, 0x2901, 0x1435, 0x0000, 0x47a2, 0x2662,
+	    0x3f39, 0x0000, 0x1fcc, 0x1c24, 0x3160, 0x4d03, 0x0e83, 0x0000,
+	    0x0000, 0x2f0b, 0x0000, 0x1a57, 0x0000, 0x0000, 0x109a, 0x1cfb,
+	    0x4401, 0x0000, 0x0000, 0x1831, 0x12f2, 0x0000, 0x3266, 0x3fd3,
+	    0x2df0, 0x0b66, 0x0000, 0x1053, 0x16a3, 0x0cce, 0x2fc7, 0x1bd1,
+	    0x3b75, 0x0000, 0x4745, 0x0000, 0x0000, 0x1647, 0x2215, 0x219f,
+	    0x06f6, 0x4886, 0x0000, 0x1525, 0x0000, 0x0000, 0x0000, 0x2642,
+	    0x1cc7, 0x0000, 0x3c43, 0x0000, 0x0000, 0x0000, 0x0000, 0x46bf,
+	    0x1046, 0x023b, 0x0000, 0x20b5, 0x3be1, 0x0000, 0x11f9, 0x0000,
+	    0x0000, 0x0249, 0x2b05, 0x0000, 0x0000, 0x0000, 0x2733, 0x0000,
+	    0x1c80, 0x4e19, 0x1d67, 0x1ce6, 0x052f, 0x4c75, 0x060b, 0x21b6,
+	    0x404a, 0x3a14, 0x0000, 0x3e6d, 0x1c26, 0x3ab5, 0x2ede, 0x1a35,
+	    0x2fae, 0x0000, 0x48e7, 0x04cb, 0x3d19, 0x0000, 0x0000, 0x0000,
+	    0x49c3, 0x07b3, 0x0000, 0x18a9, 0x0000, 0x29f9, 0x0000, 0x2f25,
+	    0x2e50, 0x2234, 0x3d86, 0x0000, 0x0000, 0x0000, 0x3638, 0x37a9,
+	    0x0000, 0x45be, 0x0000, 0x4bdf, 0x1ee4, 0x0000, 0x291e, 0x22f4,
+	    0x0000, 0x0000, 0x1f0e, 0x318a, 0x2f5d, 0x3163, 0x0000, 0x0000,
+	    0x1e34, 0x3287, 0x35ce, 0x082f, 0x4147, 0x07a4, 0x2e23, 0x0000,
+	    0x2254, 0x0000, 0x03a2, 0x34f8, 0x2ccf, 0x4b67, 0x1fd9, 0x0000,
+	    0x3d91, 0x0000, 0x0000, 0x2bea, 0x437b, 0x116e, 0x0000, 0x0000,
+	    0x0f18, 0x0000, 0x2ae7, 0x4923, 0x0000, 0x4740, 0x0000, 0x0000,
+	    0x0114, 0x152f, 0x37a9, 0x3c94, 0x319b, 0x1d3a, 0x278a, 0x45bf,
+	    0x3284, 0x004a, 0x0000, 0x19cd, 0x2d24, 0x4091, 0x3a60, 0x47b1,
+	    0x12ea, 0x4dfc, 0x0000, 0x12ba, 0x3faa, 0x3273, 0x0893, 0x0000,
+	    0x0000, 0x08e1, 0x0e7a, 0x3613, 0x0000, 0x228d, 0x0000, 0x2900,
+	    0x0000, 0x31b8, 0x23d8, 0x0000, 0x0000, 0x0000, 0x103a, 0x0c92,
+	    0x49d9, 0x1146, 0x0000, 0x22a7, 0x06f4, 0x075c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0dca, 0x10fc, 0x0000, 0x0000, 0x27bb,
+	    0x3e44, 0x0bf5, 0x4416, 0x0000, 0x0115, 0x4744, 0x0000, 0x483d,
+	    0x2555, 0x0000, 0x4dd8, 0x0000, 0x0000, 0x0e73, 0x0000, 0x0000,
+	    0x164b, 0x1a5b, 0x1dcc, 0x0000, 0x1cf3, 0x1c62, 0x1783, 0x3380,
+	    0x3655, 0x0000, 0x0000, 0x1854, 0x0000, 0x3c6d, 0x0000, 0x1db2,
+	    0x0000, 0x0000, 0x1dea, 0x0000, 0x1a69, 0x34dd, 0x0591, 0x3ef9,
+	    0x0000, 0x140a, 0x2d21, 0x3b65, 0x0000, 0x0c17, 0x3671, 0x0000,
+	    0x26e2, 0x14b7, 0x16ca, 0x17a1, 0x00e2, 0x4722, 0x1b28, 0x0000,
+	    0x0000, 0x0000, 0x2cb1, 0x0000, 0x308a, 0x118f, 0x096f, 0x0000,
+	    0x4548, 0x0000, 0x3a31, 0x0000, 0x2f98, 0x18a2, 0x2d48, 0x4934,
+	    0x488f, 0x19a8, 0x0000, 0x2a12, 0x0000, 0x0000, 0x0000, 0x0514,
+	    0x0000, 0x18e5, 0x0000, 0x15f8, 0x0261, 0x3fc7, 0x4cb0, 0x0000,
+	    0x0000, 0x33c6, 0x0000, 0x12cb, 0x3308, 0x42d8, 0x0000, 0x32f8,
+	    0x0000, 0x0ce2, 0x354a, 0x0000, 0x1054, 0x0149, 0x2672, 0x0000,
+	    0x34d4, 0x0582, 0x2618, 0x1476, 0x041e, 0x0175, 0x26cc, 0x15f1,
+	    0x32b0, 0x335e, 0x0000, 0x0000, 0x0000, 0x0000, 0x01df, 0x0000,
+	    0x0000, 0x39a1, 0x1299, 0x0000, 0x20e4, 0x2d3e, 0x0000, 0x0000,
+	    0x22c1, 0x2096, 0x0000, 0x2e1b, 0x1b02, 0x0000, 0x0000, 0x4bd1,
+	    0x3d80, 0x0000, 0x1fbf, 0x4bad, 0x0000, 0x1643, 0x4956, 0x162a,
+	    0x081d, 0x0000, 0x1c8c, 0x060c, 0x2ff6, 0x0000, 0x0000, 0x2fd3,
+	    0x48c1, 0x3256, 0x0282, 0x3fdd, 0x0000, 0x00d2, 0x41da, 0x4076,
+	    0x068c, 0x1f5a, 0x224e, 0x4dc3, 0x0000, 0x0000, 0x0000, 0x43cd,
+	    0x1472, 0x10fc, 0x0000, 0x4878, 0x087b, 0x24fa, 0x0000, 0x150d,
+	    0x2c7e, 0x0000, 0x0a6a, 0x0000, 0x3273, 0x12ff, 0x41c8, 0x0ad2,
+	    0x452a, 0x223c, 0x0000, 0x2549, 0x0000, 0x0000, 0x0000, 0x0528,
+	    0x0c0a, 0x2cf8, 0x0000, 0x1a3e, 0x0000, 0x2d60, 0x2577, 0x436b,
+	    0x2675, 0x3293, 0x3f37, 0x0000, 0x0000, 0x0000, 0x40ef, 0x0000,
+	    0x4d58, 0x0000, 0x0fbd, 0x0000, 0x0000, 0x30dc, 0x2703, 0x43e1,
+	    0x4c70, 0x0000, 0x1a83, 0x0f2f, 0x0000, 0x1bbc, 0x10fe, 0x0000,
+	    0x05f3, 0x4dc8, 0x19b5, 0x414f, 0x0000, 0x3ca3, 0x0b1f, 0x20a2,
+	    0x0000, 0x4981, 0x2360, 0x171e, 0x2041, 0x1c8d, 0x4343, 0x0b6b,
+	    0x0000, 0x2e2b, 0x0000, 0x2d42, 0x3916, 0x0000, 0x4bac, 0x0000,
+	    0x08d4, 0x41a4, 0x0000, 0x4497, 0x0000, 0x279b, 0x1542, 0x2d1a,
+	    0x0000, 0x3322, 0x4d06, 0x0000, 0x0000, 0x395c, 0x0000, 0x12ae,
+	    0x344b, 0x25f4, 0x0000, 0x115b, 0x0740, 0x292f, 0x4a0b, 0x00da,
+	    0x20de, 0x45f2, 0x2cef, 0x4295, 0x4d2c, 0x1357, 0x35cc, 0x0000,
+	    0x402b, 0x242c, 0x0000, 0x0a38, 0x2e0c, 0x18e3, 0x0000, 0x407c,
+	    0x1910, 0x0000, 0x4a14, 0x0000, 0x2c4d, 0x4649, 0x0000, 0x0840,
+	    0x274b, 0x354a, 0x062c, 0x01f1, 0x331c, 0x047c, 0x179b, 0x0000,
+	    0x0000, 0x0000, 0x1b78, 0x1419, 0x0000, 0x0000, 0x0000, 0x3f5d,
+	    0x0f5a, 0x0000, 0x4362, 0x08d0, 0x24c7, 0x3963, 0x373c, 0x48fe,
+	    0x3603, 0x03d9, 0x12b3, 0x0000, 0x4d5f, 0x1c98, 0x3a52, 0x2ecf,
+	    0x36bf, 0x0000, 0x0000, 0x348f, 0x0000, 0x3224, 0x4d21, 0x0000,
+	    0x0459, 0x4b8d, 0x0000, 0x1041, 0x0000, 0x47d0, 0x3706, 0x214a,
+	    0x0c7c, 0x0edf, 0x24b9, 0x3c7a, 0x0000, 0x2f9c, 0x0000, 0x0ce5,
+	    0x3840, 0x1d93, 0x433e, 0x1e9c, 0x475a, 0x1a89, 0x0000, 0x0000,
+	    0x3ba3, 0x21a4, 0x2181, 0x1ba9, 0x18ba, 0x0000, 0x0000, 0x0000,
+	    0x4c9f, 0x335e, 0x3425, 0x2561, 0x3c3d, 0x2e48, 0x0e6d, 0x2796,
+	    0x0986, 0x0000, 0x1d77, 0x0000, 0x0f0e, 0x0000, 0x1903, 0x0000,
+	    0x0000, 0x43c4, 0x0000, 0x39aa, 0x0000, 0x0000, 0x0211, 0x2ca5,
+	    0x25da, 0x31e4, 0x399d, 0x151f, 0x0000, 0x0000, 0x0000, 0x4cf3,
+	    0x0e73, 0x0000, 0x36e2, 0x24d0, 0x11d8, 0x388e, 0x0395, 0x0694,
+	    0x2511, 0x0000, 0x2432, 0x4ac6, 0x0000, 0x0000, 0x0000, 0x1b0f,
+	    0x0000, 0x3100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c00,
+	    0x0000, 0x0000, 0x0776, 0x0000, 0x0821, 0x21ce, 0x07d0, 0x0d86,
+	    0x2441, 0x0000, 0x1b10, 0x2791, 0x32b6, 0x30fa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4781, 0x35a2, 0x0a69, 0x37f1, 0x0000, 0x0000,
+	    0x4904, 0x0000, 0x0dbd, 0x3837, 0x448e, 0x49bd, 0x00c1, 0x208b,
+	    0x0000, 0x3a99, 0x4824, 0x0000, 0x4b77, 0x0000, 0x09df, 0x3d55,
+	    0x0000, 0x24ee, 0x0000, 0x07c5, 0x3c39, 0x177e, 0x0000, 0x0ecf,
+	    0x0000, 0x0000, 0x0000, 0x437c, 0x16be, 0x0579, 0x4b97, 0x106e,
+	    0x2e72, 0x4a52, 0x23e7, 0x29c1, 0x17bd, 0x2aae, 0x0000, 0x4018,
+	    0x3673, 0x0000, 0x0000, 0x04f8, 0x4dca, 0x0000, 0x18f1, 0x4c85,
+	    0x4293, 0x0d9b, 0x0000, 0x1430, 0x0000, 0x0000, 0x0000, 0x403f,
+	    0x1f78, 0x412b, 0x4931, 0x0000, 0x0000, 0x0000, 0x0bc1, 0x02f7,
+	    0x3117, 0x296e, 0x3a9a, 0x1bcf, 0x0dba, 0x0000, 0x42ad, 0x0939,
+	    0x4a49, 0x4938, 0x1f05, 0x350a, 0x3d6e, 0x0000, 0x0000, 0x06cf,
+	    0x316e, 0x11e1, 0x0000, 0x037b, 0x0000, 0x0000, 0x0c3a, 0x0000,
+	    0x102b, 0x3e4f, 0x33bf, 0x0000, 0x2edd, 0x1396, 0x0352, 0x0000,
+	    0x0000, 0x20ce, 0x45d1, 0x0000, 0x2494, 0x0000, 0x33a7, 0x3045,
+	    0x431c, 0x0000, 0x4d88, 0x0000, 0x0fb4, 0x0000, 0x130e, 0x2be5,
+	    0x2b05, 0x2c8c, 0x2767, 0x0000, 0x0804, 0x0000, 0x3bbb, 0x4dcb,
+	    0x0000, 0x24d2, 0x0000, 0x1320, 0x0000, 0x0000, 0x41f2, 0x0000,
+	    0x0566, 0x2112, 0x3ebd, 0x06b0, 0x0000, 0x0000, 0x48c5, 0x4523,
+	    0x1623, 0x0244, 0x0000, 0x072f, 0x0000, 0x2088, 0x0000, 0x0000,
+	    0x33e7, 0x0000, 0x0000, 0x4dfc, 0x1ed7, 0x3a4e, 0x0039, 0x10fd,
+	    0x0000, 0x0000, 0x35a8, 0x0243, 0x0000, 0x33dc, 0x0f9f, 0x0000,
+	    0x4a2f, 0x1056, 0x4382, 0x0000, 0x3a3e, 0x255b, 0x0000, 0x2463,
+	    0x38e9, 0x2693, 0x376c, 0x1b3d, 0x0000, 0x4627, 0x0000, 0x3a61,
+	    0x0000, 0x0000, 0x0000, 0x380b, 0x41e4, 0x0000, 0x1e79, 0x26ab,
+	    0x0000, 0x34a3, 0x0000, 0x1772, 0x0000, 0x3650, 0x3bed, 0x0000,
+	    0x3044, 0x0000, 0x43bc, 0x0f95, 0x2a18, 0x47be, 0x1925, 0x3dd5,
+	    0x2dd8, 0x184e, 0x1e9c, 0x0000, 0x4d64, 0x0000, 0x1bb9, 0x0000,
+	    0x0000, 0x48fd, 0x2792, 0x0000, 0x3fe4, 0x0d53, 0x1fdf, 0x0000,
+	    0x0000, 0x1567, 0x0921, 0x0000, 0x076a, 0x2feb, 0x46c2, 0x0000,
+	    0x0000, 0x0588, 0x0000, 0x2304, 0x1dca, 0x3615, 0x0b89, 0x3d34,
+	    0x0000, 0x3220, 0x34d0, 0x3373, 0x3b36, 0x4de4, 0x398e, 0x47df,
+	    0x0000, 0x3de5, 0x444e, 0x34aa, 0x452e, 0x1bab, 0x0000, 0x0000,
+	    0x0000, 0x3775, 0x0000, 0x0000, 0x0d24, 0x0000, 0x0000, 0x4d09,
+	    0x194a, 0x28ed, 0x4089, 0x09b5, 0x1c59, 0x0000, 0x0000, 0x39b2,
+	    0x0d96, 0x3985, 0x1740, 0x0000, 0x43be, 0x298f, 0x0000, 0x19b2,
+	    0x48a3, 0x2395, 0x0000, 0x2121, 0x3128, 0x0000, 0x0000, 0x4dc2,
+	    0x3996, 0x06fb, 0x2246, 0x0000, 0x0000, 0x0f56, 0x3a10, 0x0000,
+	    0x1d33, 0x0000, 0x3bce, 0x2924, 0x4880, 0x0000, 0x0000, 0x46a2,
+	    0x1131, 0x2dfb, 0x270d, 0x0000, 0x2089, 0x0000, 0x38a6, 0x0000,
+	    0x0000, 0x2b1d, 0x0000, 0x1e46, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02c6, 0x3d45, 0x0000, 0x4b49, 0x3d0f, 0x23db, 0x0f3f, 0x0000,
+	    0x0000, 0x0000, 0x427d, 0x0000, 0x0000, 0x1e5b, 0x0000, 0x217a,
+	    0x2ceb, 0x280b, 0x3f23, 0x28ae, 0x0000, 0x164b, 0x3742, 0x2abc,
+	    0x0000, 0x3d20, 0x2a32, 0x4d4b, 0x0726, 0x0373, 0x1a0b, 0x34bc,
+	    0x1b15, 0x2328, 0x0f48, 0x0000, 0x0000, 0x249b, 0x2cff, 0x0000,
+	    0x0000, 0x0b14, 0x4058, 0x0000, 0x2b69, 0x4415, 0x0000, 0x14bb,
+	    0x0000, 0x12ec, 0x265e, 0x4717, 0x1b8a, 0x1e6f, 0x1eb1, 0x106f,
+	    0x2482, 0x3e97, 0x3cf6, 0x0000, 0x0000, 0x0679, 0x0000, 0x0000,
+	    0x3e5c, 0x0000, 0x193d, 0x38e5, 0x452c, 0x0000, 0x3eb2, 0x0000,
+	    0x356a, 0x05c4, 0x496e, 0x0000, 0x0000, 0x44b1, 0x0000, 0x0000,
+	    0x3be1, 0x2ab0, 0x1a20, 0x0000, 0x0000, 0x0000, 0x023b, 0x0000,
+	    0x2e20, 0x3a1a, 0x1192, 0x17e9, 0x18b5, 0x0000, 0x187d, 0x2c65,
+	    0x0000, 0x0000, 0x2fd0, 0x13ea, 0x2878, 0x0000, 0x17e3, 0x47a5,
+	    0x0000, 0x0000, 0x03c6, 0x2c96, 0x1700, 0x19d5, 0x0000, 0x2b4b,
+	    0x0000, 0x3d52, 0x4230, 0x0000, 0x0000, 0x3993, 0x24df, 0x00ed,
+	    0x20a5, 0x22d1, 0x0fe8, 0x0000, 0x0000, 0x2a1e, 0x4a48, 0x0000,
+	    0x2d09, 0x0000, 0x0d94, 0x0000, 0x09e0, 0x0000, 0x0000, 0x058a,
+	    0x1c84, 0x342f, 0x1781, 0x0000, 0x0000, 0x0000, 0x1a7f, 0x0ce4,
+	    0x0000, 0x43c8, 0x139f, 0x0000, 0x0000, 0x4dcb, 0x0000, 0x0000,
+	    0x0fd9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c7f, 0x0000,
+	    0x3ca5, 0x045a, 0x21bf, 0x393a, 0x160c, 0x23d3, 0x31a7, 0x309d,
+	    0x0000, 0x0000, 0x0efe, 0x01af, 0x0000, 0x2a2d, 0x0711, 0x002c,
+	    0x0000, 0x4035, 0x4c28, 0x0000, 0x3d53, 0x0000, 0x01fa, 0x12a0,
+	    0x1a50, 0x02a7, 0x3752, 0x28ec, 0x0000, 0x185c, 0x0000, 0x0000,
+	    0x2209, 0x0000, 0x406b, 0x0000, 0x0000, 0x0000, 0x0308, 0x1539,
+	    0x0a3e, 0x44d1, 0x0000, 0x4a60, 0x3002, 0x400b, 0x24d9, 0x3b5e,
+	    0x36d2, 0x440c, 0x0000, 0x2b5a, 0x3c90, 0x2a5a, 0x2d8a, 0x3cc9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42bf, 0x45f8, 0x48f3,
+	    0x0000, 0x0e91, 0x43dc, 0x059e, 0x21c9, 0x225f, 0x0000, 0x2505,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4b66, 0x3ff3, 0x1a8d, 0x2d83,
+	    0x023e, 0x1343, 0x4475, 0x0000, 0x3f59, 0x11d6, 0x0000, 0x0000,
+	    0x1f58, 0x3816, 0x16c1, 0x0000, 0x1688, 0x318b, 0x0a6c, 0x0000,
+	    0x0000, 0x131c, 0x0adc, 0x0000, 0x0000, 0x33aa, 0x3482, 0x1c07,
+	    0x00f9, 0x05cf, 0x0000, 0x0000, 0x0000, 0x16d8, 0x22d7, 0x3039,
+	    0x13d4, 0x305e, 0x3d8a, 0x1f38, 0x0000, 0x0000, 0x0000, 0x2928,
+	    0x0000, 0x013c, 0x1ffd, 0x31e2, 0x0000, 0x0000, 0x31b3, 0x0000,
+	    0x0000, 0x3fb7, 0x48a5, 0x3f0c, 0x0000, 0x1a11, 0x04c4, 0x0000,
+	    0x405a, 0x0000, 0x483d, 0x1672, 0x0000, 0x0000, 0x0000, 0x444f,
+	    0x1a3a, 0x3489, 0x4a70, 0x0000, 0x072e, 0x05c1, 0x0000, 0x1859,
+	    0x0000, 0x406f, 0x0000, 0x0fd8, 0x150c, 0x3376, 0x1356, 0x061a,
+	    0x0000, 0x0000, 0x0000, 0x1426, 0x0000, 0x0000, 0x4551, 0x0000,
+	    0x0eb0, 0x0000, 0x2676, 0x3de8, 0x0000, 0x0000, 0x493f, 0x28e7,
+	    0x2553, 0x0000, 0x3cfc, 0x35fa, 0x25fe, 0x153d, 0x3efe, 0x3983,
+	    0x285f, 0x0000, 0x0000, 0x03be, 0x2686, 0x4822, 0x33f7, 0x40a1,
+	    0x190c, 0x07d6, 0x0ad7, 0x0000, 0x07c2, 0x0000, 0x3d14, 0x3799,
+	    0x2d87, 0x076e, 0x0415, 0x16a6, 0x4023, 0x4195, 0x0000, 0x1e9a,
+	    0x0000, 0x2ae7, 0x0000, 0x0307, 0x2e57, 0x4adc, 0x0878, 0x4b85,
+	    0x3731, 0x0000, 0x0000, 0x0000, 0x4a67, 0x22f6, 0x0000, 0x4612,
+	    0x1c25, 0x0000, 0x0000, 0x0c79, 0x0000, 0x0000, 0x1631, 0x0af5,
+	    0x0000, 0x0000, 0x249a, 0x0000, 0x4b2f, 0x17d0, 0x2b94, 0x0279,
+	    0x3f2e, 0x3e00, 0x2b6f, 0x0787, 0x37e5, 0x130b, 0x11b3, 0x1723,
+	    0x47d8, 0x0d00, 0x0000, 0x4635, 0x128a, 0x3f2d, 0x4a6a, 0x14d4,
+	    0x49f0, 0x4a45, 0x0000, 0x0000, 0x4dda, 0x0000, 0x0314, 0x32d1,
+	    0x2fdb, 0x4397, 0x0000, 0x0000, 0x47ea, 0x1579, 0x0000, 0x19a1,
+	    0x0000, 0x0b45, 0x27d9, 0x25ed, 0x0000, 0x2ba8, 0x1ee5, 0x0000,
+	    0x1c6e, 0x2441, 0x0000, 0x3e58, 0x0000, 0x142c, 0x098b, 0x08ca,
+	    0x1cf2, 0x0000, 0x3acf, 0x3643, 0x0000, 0x303e, 0x0000, 0x0000,
+	    0x09ce, 0x0f6c, 0x0aab, 0x042d, 0x4319, 0x468c, 0x3d24, 0x182d,
+	    0x4a43, 0x2e27, 0x2eef, 0x43c9, 0x27c4, 0x1985, 0x0000, 0x0000,
+	    0x0a25, 0x3726, 0x2566, 0x0000, 0x140c, 0x0000, 0x4c71, 0x038d,
+	    0x3076, 0x2a62, 0x2c86, 0x4bf6, 0x4565, 0x0000, 0x08f2, 0x39f0,
+	    0x24d0, 0x4c01, 0x0000, 0x4db8, 0x29eb, 0x0000, 0x0843, 0x475f,
+	    0x07b7, 0x32a9, 0x0000, 0x0224, 0x0000, 0x0000, 0x1c7a, 0x3507,
+	    0x1936, 0x1163, 0x0000, 0x3a0e, 0x0000, 0x0000, 0x1766, 0x0000,
+	    0x0000, 0x0000, 0x4241, 0x4645, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x446f, 0x0000, 0x07f6, 0x0000, 0x4b2c, 0x0000, 0x4bf3, 0x0000,
+	    0x2e2e, 0x2847, 0x0000, 0x0000, 0x0ada, 0x3185, 0x0f00, 0x0000,
+	    0x425a, 0x1546, 0x1c0d, 0x39ee, 0x3c00, 0x0000, 0x0fcb, 0x357d,
+	    0x2ba1, 0x0000, 0x2343, 0x0000, 0x0b14, 0x1e95, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2a1b, 0x0000, 0x0000, 0x148c, 0x33ca, 0x0000,
+	    0x0000, 0x0000, 0x322d, 0x340d, 0x0000, 0x07b1, 0x02b1, 0x0000,
+	    0x0000, 0x1aed, 0x4a7a, 0x0000, 0x35e9, 0x3a3c, 0x0000, 0x0000,
+	    0x49dd, 0x12d2, 0x0000, 0x0000, 0x121c, 0x0000, 0x0000, 0x0000,
+	    0x2102, 0x0000, 0x4ccd, 0x380c, 0x0000, 0x0000, 0x0000, 0x46e8,
+	    0x0000, 0x01f6, 0x27aa, 0x256f, 0x0a38, 0x463f, 0x0c62, 0x4641,
+	    0x35f9, 0x4a8a, 0x0000, 0x0000, 0x425f, 0x0000, 0x42de, 0x0000,
+	    0x0ae5, 0x2a39, 0x12bb, 0x0000, 0x2ce2, 0x0000, 0x1455, 0x2038,
+	    0x0000, 0x0000, 0x0000, 0x3bb4, 0x0000, 0x0de0, 0x0000, 0x130b,
+	    0x0930, 0x38f0, 0x3d29, 0x0000, 0x0000, 0x4071, 0x0ff6, 0x4da3,
+	    0x0000, 0x4c16, 0x4002, 0x4493, 0x1fd1, 0x0000, 0x0000, 0x180e,
+	    0x4bd8, 0x4005, 0x3694, 0x3334, 0x0000, 0x0000, 0x4cad, 0x1848,
+	    0x042b, 0x15c3, 0x0000, 0x0000, 0x1521, 0x4562, 0x0000, 0x0000,
+	    0x01cf, 0x0000, 0x0000, 0x2af8, 0x39d5, 0x44c3, 0x0000, 0x0000,
+	    0x4782, 0x0000, 0x34f3, 0x1658, 0x0000, 0x24b4, 0x1867, 0x24b4,
+	    0x02e6, 0x3445, 0x0000, 0x270b, 0x2578, 0x0000, 0x0df7, 0x3302,
+	    0x1eb1, 0x305e, 0x0000, 0x2980, 0x47b7, 0x0000, 0x0000, 0x0000,
+	    0x41cd, 0x083e, 0x2fee, 0x0053, 0x40c6, 0x37bd, 0x0000, 0x0000,
+	    0x4caa, 0x0000, 0x3eda, 0x3980, 0x2068, 0x0000, 0x386d, 0x3b32,
+	    0x0000, 0x4ac3, 0x4391, 0x0000, 0x40f1, 0x0000, 0x26b2, 0x306b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0ef5, 0x0000, 0x13bc, 0x49d4,
+	    0x1b5f, 0x491a, 0x3ee1, 0x3a5a, 0x44bb, 0x33aa, 0x0000, 0x0dac,
+	    0x1a1a, 0x0000, 0x0000, 0x2ecc, 0x475e, 0x0000, 0x0000, 0x2b26,
+	    0x0000, 0x0000, 0x1853, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a1d,
+	    0x28b7, 0x14a5, 0x0278, 0x37ee, 0x33f1, 0x0000, 0x1f62, 0x367e,
+	    0x0000, 0x4dc6, 0x3524, 0x48d4, 0x0000, 0x137d, 0x09f9, 0x126d,
+	    0x2d1e, 0x05a2, 0x0000, 0x43c2, 0x080a, 0x0124, 0x0000, 0x3525,
+	    0x1c6d, 0x0000, 0x0609, 0x0064, 0x36d9, 0x0000, 0x414e, 0x3bb9,
+	    0x4daa, 0x397f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0de3,
+	    0x0000, 0x0000, 0x1efa, 0x0835, 0x2223, 0x2d46, 0x0000, 0x1d29,
+	    0x0000, 0x0000, 0x0000, 0x0531, 0x0000, 0x0000, 0x38cb, 0x2be3,
+	    0x0000, 0x2b74, 0x03bc, 0x31ff, 0x0439, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x15ed, 0x4d50, 0x0000, 0x0b28, 0x0000, 0x0000,
+	    0x0000, 0x2678, 0x0000, 0x0000, 0x1f30, 0x3a33, 0x3392, 0x0000,
+	    0x0df9, 0x0000, 0x37c1, 0x0000, 0x1d9d, 0x0000, 0x0000, 0x125b,
+	    0x0000, 0x2430, 0x0000, 0x0000, 0x456e, 0x245b, 0x0000, 0x0000,
+	    0x21cc, 0x0000, 0x3bae, 0x0000, 0x0000, 0x17dc, 0x0000, 0x0000,
+	    0x0987, 0x0000, 0x153a, 0x30cd, 0x3e40, 0x0ddd, 0x0000, 0x0000,
+	    0x1260, 0x093a, 0x48d0, 0x0000, 0x2779, 0x24fd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1539, 0x0000, 0x1fb9, 0x0000, 0x33ad, 0x0000,
+	    0x0000, 0x3977, 0x0405, 0x4741, 0x39a3, 0x0000, 0x0000, 0x0000,
+	    0x1e32, 0x0000, 0x4742, 0x2599, 0x0253, 0x01d7, 0x0a7c, 0x0000,
+	    0x0d72, 0x0000, 0x0500, 0x0000, 0x0000, 0x0000, 0x0000, 0x2293,
+	    0x4bed, 0x34f0, 0x0000, 0x0000, 0x0000, 0x2cca, 0x0000, 0x49be,
+	    0x0000, 0x0000, 0x0000, 0x18d5, 0x3320, 0x48ff, 0x00c9, 0x0000,
+	    0x0000, 0x0000, 0x2ab0, 0x38dc, 0x0000, 0x1a87, 0x0fea, 0x0000,
+	    0x0000, 0x0000, 0x2e4d, 0x0000, 0x265e, 0x2c46, 0x2ba0, 0x0020,
+	    0x1eb8, 0x0b3e, 0x0000, 0x4381, 0x0000, 0x493b, 0x08ed, 0x4d44,
+	    0x0000, 0x3942, 0x1412, 0x0000, 0x1355, 0x087a, 0x49c5, 0x4b55,
+	    0x3b11, 0x0314, 0x37e1, 0x06ea, 0x0000, 0x1b69, 0x0000, 0x2fc5,
+	    0x0000, 0x4a58, 0x1dbf, 0x0000, 0x0587, 0x4952, 0x184d, 0x32d6,
+	    0x0491, 0x3f0c, 0x0000, 0x3d17, 0x4851, 0x0000, 0x38b2, 0x391f,
+	    0x3c3c, 0x1ac4, 0x0000, 0x21db, 0x153c, 0x1a54, 0x2cde, 0x16fe,
+	    0x253a, 0x2004, 0x0000, 0x3e65, 0x3da4, 0x0000, 0x0000, 0x447f,
+	    0x0000, 0x25d8, 0x3513, 0x0000, 0x0000, 0x48c0, 0x04d6, 0x26a3,
+	    0x0000, 0x0000, 0x4201, 0x0000, 0x416d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1c59, 0x29df, 0x4561, 0x28ee, 0x0000, 0x3c26,
+	    0x0000, 0x222d, 0x1b77, 0x0000, 0x2e8c, 0x0000, 0x0000, 0x2399,
+	    0x0000, 0x3ede, 0x0084, 0x0000, 0x14da, 0x21bf, 0x0d78, 0x4c3e,
+	    0x1ce1, 0x414a, 0x0000, 0x0000, 0x0aec, 0x0000, 0x3fa1, 0x13a4,
+	    0x3797, 0x0000, 0x0000, 0x0000, 0x0ce3, 0x4a7b, 0x16cf, 0x0000,
+	    0x0ef1, 0x1b45, 0x0000, 0x123e, 0x1b70, 0x4dd2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1cfb, 0x35b2, 0x2261, 0x0000, 0x012e,
+	    0x0000, 0x2580, 0x4018, 0x307a, 0x0000, 0x3adb, 0x4d29, 0x09fc,
+	    0x0000, 0x09bf, 0x0000, 0x2402, 0x0000, 0x0000, 0x0000, 0x0a30,
+	    0x1ff7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e89, 0x051f, 0x303e,
+	    0x042b, 0x0000, 0x14a1, 0x1a36, 0x34b1, 0x0000, 0x3eea, 0x0000,
+	    0x09dd, 0x0000, 0x0000, 0x13d0, 0x3d91, 0x0000, 0x3b4d, 0x2ac1,
+	    0x0000, 0x02a5, 0x1c3f, 0x44a6, 0x1211, 0x3750, 0x475e, 0x0a0d,
+	    0x1b51, 0x06ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x3772, 0x0000,
+	    0x4b23, 0x0000, 0x48aa, 0x0000, 0x0000, 0x36fb, 0x2b5a, 0x0000,
+	    0x23e1, 0x0000, 0x38aa, 0x268b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1ee0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1661, 0x1dc1, 0x194a, 0x33ad, 0x0000, 0x48c0, 0x0000, 0x0000,
+	    0x4165, 0x13cf, 0x0797, 0x0000, 0x0000, 0x0000, 0x0000, 0x2594,
+	    0x0000, 0x18ef, 0x01bf, 0x0cae, 0x0000, 0x4052, 0x0000, 0x0000,
+	    0x301e, 0x2e0e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x130c,
+	    0x0000, 0x0000, 0x3c62, 0x2ea3, 0x258d, 0x48db, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3746, 0x0000, 0x0538, 0x007f,
+	    0x15ca, 0x05da, 0x404f, 0x0000, 0x2f55, 0x3593, 0x1535, 0x4bfd,
+	    0x3da4, 0x32e3, 0x0000, 0x0ce4, 0x171d, 0x2ecc, 0x2644, 0x151f,
+	    0x3a3c, 0x13fe, 0x1fa0, 0x1f91, 0x0000, 0x498f, 0x4043, 0x4d1c,
+	    0x3e1e, 0x3c1c, 0x22e6, 0x209f, 0x0000, 0x0252, 0x1c0e, 0x495d,
+	    0x349f, 0x0000, 0x045a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x15d5, 0x35b4, 0x03be, 0x36af, 0x0000, 0x1ee6, 0x082b, 0x0000,
+	    0x07d6, 0x01f1, 0x1dc4, 0x0000, 0x4c97, 0x47ed, 0x240a, 0x0000,
+	    0x15d5, 0x0000, 0x429c, 0x0000, 0x132a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0f21, 0x0000, 0x0000, 0x09ee,
+	    0x474e, 0x0000, 0x4a91, 0x4bdc, 0x019f, 0x0ed4, 0x0000, 0x0000,
+	    0x2336, 0x1e9c, 0x01aa, 0x0000, 0x0000, 0x0000, 0x39ab, 0x40a4,
+	    0x30c7, 0x2eb4, 0x0000, 0x0000, 0x0000, 0x19d9, 0x0385, 0x0000,
+	    0x472c, 0x0e1f, 0x473a, 0x4add, 0x0000, 0x0000, 0x45fa, 0x0000,
+	    0x114e, 0x0000, 0x43df, 0x0000, 0x24b3, 0x37d9, 0x0000, 0x3344,
+	    0x0000, 0x01d6, 0x398c, 0x322b, 0x49ed, 0x4501, 0x0000, 0x08c5,
+	    0x398c, 0x0000, 0x492b, 0x0000, 0x0000, 0x2373, 0x0000, 0x19de,
+	    0x0000, 0x2fa8, 0x3688, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3b54, 0x3045, 0x0194, 0x0108, 0x0000, 0x40e4, 0x36d3, 0x0000,
+	    0x1311, 0x0000, 0x0d5f, 0x0000, 0x183a, 0x0000, 0x0000, 0x0cf0,
+	    0x0000, 0x0000, 0x1755, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x43bb, 0x0000, 0x0000, 0x05e8, 0x0000, 0x04a3, 0x3d39, 0x1c52,
+	    0x0d38, 0x0000, 0x0000, 0x423c, 0x0000, 0x1026, 0x2e4c, 0x0000,
+	    0x0000, 0x0000, 0x3526, 0x0000, 0x0000, 0x2ce2, 0x0000, 0x0000,
+	    0x4c8a, 0x03e6, 0x0000, 0x0df2, 0x2471, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4a4d, 0x29ee, 0x0000, 0x4892, 0x34d2, 0x3f1e,
+	    0x0000, 0x0000, 0x18a7, 0x3bff, 0x0000, 0x0000, 0x0000, 0x15de,
+	    0x057b, 0x0000, 0x0000, 0x0000, 0x197a, 0x2ff1, 0x02a5, 0x3b45,
+	    0x37f1, 0x0000, 0x2dd1, 0x12f5, 0x3060, 0x06c3, 0x26e8, 0x193b,
+	    0x1005, 0x0000, 0x0b68, 0x4cc7, 0x0000, 0x0000, 0x1e8f, 0x0000,
+	    0x13e8, 0x0000, 0x0000, 0x0407, 0x0000, 0x0000, 0x0000, 0x428e,
+	    0x0000, 0x4446, 0x10b6, 0x25d3, 0x0000, 0x0000, 0x0e86, 0x0269,
+	    0x0000, 0x27bd, 0x1be3, 0x0000, 0x0fb8, 0x0000, 0x0000, 0x2dc4,
+	    0x0000, 0x1a31, 0x0000, 0x27c1, 0x2081, 0x0000, 0x0000, 0x30e8,
+	    0x0000, 0x0168, 0x0000, 0x1832, 0x3501, 0x34d3, 0x452e, 0x0000,
+	    0x282f, 0x2e8c, 0x0000, 0x0000, 0x43b8, 0x0000, 0x49e4, 0x0000,
+	    0x4654, 0x42fc, 0x1b29, 0x30cc, 0x0000, 0x155d, 0x0000, 0x324f,
+	    0x3db4, 0x0000, 0x354b, 0x0000, 0x4c94, 0x210c, 0x0000, 0x0000,
+	    0x3a6c, 0x0000, 0x1a46, 0x1ae2, 0x0000, 0x4073, 0x2a1f, 0x1da1,
+	    0x0000, 0x2d4a, 0x3049, 0x0000, 0x45b2, 0x0000, 0x1c4f, 0x102b,
+	    0x0000, 0x3c55, 0x4cc5, 0x0881, 0x0000, 0x0000, 0x0000, 0x1c6d,
+	    0x0000, 0x3b75, 0x0000, 0x0000, 0x4ac7, 0x4146, 0x0000, 0x0000,
+	    0x0000, 0x44a7, 0x3f8e, 0x46e0, 0x0240, 0x487f, 0x0000, 0x0000,
+	    0x0000, 0x2cb2, 0x2aba, 0x0000, 0x30a5, 0x0000, 0x0000, 0x0000,
+	    0x10d4, 0x1ee4, 0x3329, 0x15fc, 0x0000, 0x0000, 0x17d3, 0x0000,
+	    0x422d, 0x0000, 0x44ee, 0x0000, 0x04b9, 0x055c, 0x0000, 0x0000,
+	    0x0000, 0x2a53, 0x1edd, 0x0000, 0x2b07, 0x2322, 0x0000, 0x0000,
+	    0x17cd, 0x0000, 0x0000, 0x2798, 0x21fe, 0x2941, 0x0000, 0x2134,
+	    0x0000, 0x0000, 0x0df8, 0x3954, 0x0000, 0x2359, 0x0000, 0x0000,
+	    0x466d, 0x2b97, 0x0000, 0x3842, 0x2676, 0x0691, 0x0000, 0x0000,
+	    0x4287, 0x452c, 0x0000, 0x1f8f, 0x0000, 0x0000, 0x3048, 0x03a6,
+	    0x0000, 0x21d9, 0x26c7, 0x0000, 0x2404, 0x3854, 0x0ef0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1a3c, 0x0000, 0x0000, 0x072a,
+	    0x0000, 0x0000, 0x32d6, 0x0000, 0x0000, 0x0fd9, 0x04b9, 0x1c27,
+	    0x0000, 0x117b, 0x0000, 0x0000, 0x0000, 0x0000, 0x39f4, 0x1140,
+	    0x3d16, 0x0000, 0x28d7, 0x1f9e, 0x216f, 0x0000, 0x2d9e, 0x0000,
+	    0x0000, 0x0000, 0x03f4, 0x3fb6, 0x0000, 0x4bad, 0x1b7a, 0x3489,
+	    0x3ed7, 0x016f, 0x1323, 0x3941, 0x0000, 0x3148, 0x0802, 0x1529,
+	    0x0000, 0x031a, 0x30ea, 0x12a3, 0x0197, 0x0000, 0x20d7, 0x0000,
+	    0x0000, 0x0009, 0x3c97, 0x103d, 0x2794, 0x0000, 0x4885, 0x0000,
+	    0x0000, 0x04ca, 0x1cf5, 0x0000, 0x3f5a, 0x36f5, 0x0000, 0x3e04,
+	    0x2aec, 0x2670, 0x0000, 0x0000, 0x46ab, 0x2851, 0x16a3, 0x4cd9,
+	    0x0000, 0x0000, 0x2dc7, 0x2832, 0x4c77, 0x1152, 0x4083, 0x4c32,
+	    0x0000, 0x0d31, 0x0000, 0x0000, 0x0000, 0x0962, 0x3a53, 0x15d9,
+	    0x0000, 0x3fe5, 0x0000, 0x4c08, 0x0000, 0x4b9e, 0x0000, 0x0000,
+	    0x224b, 0x0000, 0x0000, 0x0000, 0x0000, 0x136a, 0x0000, 0x3830,
+	    0x0000, 0x2891, 0x1418, 0x0000, 0x0000, 0x0000, 0x42c2, 0x3d2a,
+	    0x0000, 0x0000, 0x2c22, 0x0000, 0x0000, 0x4c6e, 0x0921, 0x0000,
+	    0x00a1, 0x3ab2, 0x0000, 0x051a, 0x0c1d, 0x1fbd, 0x0000, 0x36db,
+	    0x1e02, 0x0000, 0x2c18, 0x4c41, 0x1985, 0x0000, 0x3a23, 0x474b,
+	    0x355f, 0x36dd, 0x0000, 0x0000, 0x0c33, 0x08e8, 0x0727, 0x0000,
+	    0x0000, 0x0000, 0x0471, 0x0000, 0x3809, 0x1c49, 0x3631, 0x2ee3,
+	    0x389f, 0x110e, 0x24b2, 0x4515, 0x0000, 0x341b, 0x0000, 0x0000,
+	    0x2d49, 0x1078, 0x2f94, 0x4290, 0x3857, 0x1f01, 0x0a72, 0x0551,
+	    0x08c6, 0x464e, 0x0000, 0x2540, 0x0000, 0x06c6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24c4, 0x4b0b, 0x0000, 0x1a33, 0x4068,
+	    0x0000, 0x40ce, 0x1137, 0x0000, 0x0000, 0x271d, 0x0b5d, 0x0000,
+	    0x3f42, 0x1404, 0x1248, 0x3f4c, 0x2797, 0x3cf4, 0x05f3, 0x096f,
+	    0x0000, 0x0000, 0x19d4, 0x0000, 0x0000, 0x0000, 0x2656, 0x2b1a,
+	    0x21d0, 0x2334, 0x0000, 0x0000, 0x0000, 0x0000, 0x3462, 0x2eff,
+	    0x0000, 0x30a4, 0x1d9f, 0x0000, 0x4d92, 0x3ab3, 0x169c, 0x0000,
+	    0x0000, 0x0000, 0x2dba, 0x0000, 0x0000, 0x01b8, 0x4095, 0x0000,
+	    0x2145, 0x31dd, 0x3d1b, 0x0000, 0x3cf3, 0x074c, 0x0000, 0x3b4d,
+	    0x044c, 0x0000, 0x0000, 0x0000, 0x1740, 0x0000, 0x3a5c, 0x0000,
+	    0x239a, 0x44aa, 0x30c1, 0x48cf, 0x0000, 0x2d0b, 0x3dfc, 0x3ef7,
+	    0x0000, 0x342f, 0x0f0a, 0x0000, 0x0000, 0x056f, 0x0000, 0x2404,
+	    0x43a9, 0x0000, 0x3bbb, 0x18ae, 0x09cc, 0x0000, 0x0835, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2631, 0x0000, 0x422e, 0x1e70, 0x26bc,
+	    0x32c9, 0x0000, 0x0000, 0x3c56, 0x0000, 0x3b6e, 0x0000, 0x0000,
+	    0x0dc9, 0x0000, 0x0000, 0x020c, 0x45d2, 0x0000, 0x0000, 0x0000,
+	    0x073f, 0x0000, 0x0000, 0x0000, 0x19be, 0x0000, 0x0000, 0x367a,
+	    0x0000, 0x0000, 0x0000, 0x2d43, 0x4c17, 0x3957, 0x0d1a, 0x421f,
+	    0x3475, 0x1f95, 0x2486, 0x3afc, 0x067b, 0x3e7d, 0x0000, 0x0000,
+	    0x0000, 0x2c5a, 0x3363, 0x090d, 0x158b, 0x0000, 0x0000, 0x22e3,
+	    0x0000, 0x0000, 0x0000, 0x3f43, 0x0000, 0x0000, 0x0eb4, 0x0000,
+	    0x0000, 0x3e1f, 0x406a, 0x0000, 0x1979, 0x0000, 0x4dd4, 0x0000,
+	    0x1ff6, 0x0000, 0x4cd0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x06ab, 0x1fb9, 0x1412, 0x172c, 0x0f49, 0x0000, 0x0000, 0x3168,
+	    0x0fad, 0x2799, 0x2379, 0x0000, 0x00c2, 0x07f7, 0x0000, 0x4c26,
+	    0x0000, 0x2bfd, 0x0000, 0x0d58, 0x14b5, 0x1831, 0x0000, 0x4098,
+	    0x4b0d, 0x0000, 0x0000, 0x4a88, 0x13c5, 0x1d9c, 0x37db, 0x3ae9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0d90, 0x3ac0, 0x0000, 0x3c74,
+	    0x0000, 0x4a2d, 0x229d, 0x0000, 0x0000, 0x3748, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x27fa, 0x2c25, 0x0000, 0x0000, 0x3b95, 0x0000,
+	    0x0000, 0x0000, 0x37d8, 0x4496, 0x0577, 0x2edf, 0x350e, 0x0dde,
+	    0x0000, 0x3474, 0x0000, 0x0000, 0x0000, 0x10cc, 0x0000, 0x0000,
+	    0x1dd3, 0x0000, 0x1aa0, 0x0000, 0x1df0, 0x2d32, 0x0000, 0x0ff7,
+	    0x4d34, 0x4c81, 0x0000, 0x115c, 0x12f1, 0x0000, 0x0000, 0x0000,
+	    0x3b3c, 0x3a77, 0x0000, 0x30c9, 0x0000, 0x3b33, 0x0000, 0x0000,
+	    0x0000, 0x0ac3, 0x0129, 0x0000, 0x0000, 0x1a95, 0x0000, 0x3219,
+	    0x3b4f, 0x0000, 0x0000, 0x0000, 0x47c5, 0x0000, 0x0000, 0x0000,
+	    0x368b, 0x3115, 0x0000, 0x0a8d, 0x3b28, 0x2008, 0x4499, 0x09be,
+	    0x40c8, 0x3bb8, 0x1384, 0x4690, 0x0000, 0x3cf0, 0x44bf, 0x3dcf,
+	    0x0000, 0x0aee, 0x3147, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bba,
+	    0x2421, 0x0000, 0x0000, 0x3ef5, 0x30ae, 0x0085, 0x0000, 0x0a49,
+	    0x181c, 0x4371, 0x300f, 0x0000, 0x0000, 0x0000, 0x0000, 0x12f3,
+	    0x437e, 0x3083, 0x4dc4, 0x0000, 0x2eed, 0x0000, 0x0000, 0x0000,
+	    0x0aad, 0x2704, 0x312a, 0x1d59, 0x0000, 0x4646, 0x0b39, 0x363e,
+	    0x2275, 0x227a, 0x3916, 0x0000, 0x0ee2, 0x0000, 0x13b5, 0x2559,
+	    0x1c3a, 0x0000, 0x1f2e, 0x42d5, 0x4194, 0x0000, 0x022b, 0x2bfb,
+	    0x0000, 0x0000, 0x0000, 0x0184, 0x0000, 0x0000, 0x0000, 0x2bd0,
+	    0x0000, 0x36ec, 0x055f, 0x0000, 0x25cd, 0x0000, 0x0000, 0x2d82,
+	    0x1619, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e86, 0x4156, 0x0000,
+	    0x0000, 0x4218, 0x1a1d, 0x0000, 0x0000, 0x3ed2, 0x0000, 0x055a,
+	    0x4706, 0x0000, 0x4384, 0x2043, 0x3aab, 0x0000, 0x0000, 0x3751,
+	    0x0000, 0x0000, 0x3f29, 0x40ed, 0x2b30, 0x0000, 0x2a1e, 0x2346,
+	    0x0000, 0x3d21, 0x03dc, 0x458c, 0x0000, 0x498b, 0x192c, 0x2327,
+	    0x11ca, 0x4b67, 0x06ac, 0x0000, 0x4374, 0x0000, 0x0000, 0x2d24,
+	    0x3b63, 0x2a31, 0x0000, 0x0000, 0x3d29, 0x3fcf, 0x3fab, 0x3ea9,
+	    0x0000, 0x0000, 0x1ee4, 0x0000, 0x4ba5, 0x10b3, 0x0cb0, 0x0000,
+	    0x010c, 0x0000, 0x0000, 0x0000, 0x016e, 0x132f, 0x16d8, 0x1873,
+	    0x0000, 0x3d97, 0x1ca9, 0x0000, 0x0000, 0x3707, 0x0000, 0x0000,
+	    0x0000, 0x2f58, 0x0000, 0x0000, 0x2528, 0x0000, 0x3080, 0x0000,
+	    0x0000, 0x2ce3, 0x35a7, 0x0000, 0x0000, 0x1cc7, 0x406a, 0x0000,
+	    0x0448, 0x322a, 0x1069, 0x1156, 0x04a7, 0x0000, 0x0000, 0x0d97,
+	    0x0000, 0x4197, 0x4132, 0x0aec, 0x3884, 0x0b6c, 0x0000, 0x0000,
+	    0x0000, 0x10f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x35ab, 0x0000, 0x3b14,
+	    0x2e01, 0x0000, 0x458f, 0x3a8b, 0x11c4, 0x0000, 0x3808, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03d6, 0x12e1, 0x0000,
+	    0x0000, 0x0000, 0x1942, 0x47ab, 0x0000, 0x21d4, 0x0000, 0x2ac9,
+	    0x4795, 0x4a34, 0x0000, 0x0cdb, 0x3af5, 0x0000, 0x0000, 0x2779,
+	    0x0000, 0x0000, 0x0000, 0x3539, 0x0000, 0x05fc, 0x0000, 0x1d77,
+	    0x4ac4, 0x0000, 0x4a92, 0x0000, 0x0000, 0x0000, 0x0b3a, 0x0000,
+	    0x39b3, 0x4b66, 0x28a4, 0x0000, 0x0000, 0x2246, 0x4761, 0x0000,
+	    0x0000, 0x1b8d, 0x0000, 0x0000, 0x2da1, 0x3ecc, 0x0000, 0x0000,
+	    0x0000, 0x03ed, 0x0a79, 0x1eb5, 0x0000, 0x1dd0, 0x2c66, 0x12f2,
+	    0x4948, 0x3882, 0x2a7d, 0x0000, 0x0000, 0x0df9, 0x19c2, 0x2110,
+	    0x4be6, 0x15a2, 0x1c54, 0x0000, 0x4389, 0x0000, 0x3dc0, 0x0000,
+	    0x0ed6, 0x136b, 0x0ef4, 0x2f3c, 0x0000, 0x0000, 0x0000, 0x0948,
+	    0x257b, 0x0000, 0x165e, 0x0000, 0x0000, 0x29ac, 0x0000, 0x0000,
+	    0x4d8e, 0x2752, 0x073d, 0x279c, 0x2138, 0x0000, 0x29c3, 0x2669,
+	    0x0000, 0x0119, 0x25fb, 0x348c, 0x0000, 0x0000, 0x0000, 0x0e98,
+	    0x0000, 0x0000, 0x0f78, 0x1880, 0x0000, 0x15b7, 0x4965, 0x0000,
+	    0x0000, 0x00f8, 0x0000, 0x3895, 0x0000, 0x05d2, 0x056f, 0x0831,
+	    0x28cc, 0x05e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x35d1, 0x34c2, 0x4c4b, 0x0973, 0x0534, 0x0000, 0x371d, 0x0000,
+	    0x0000, 0x237a, 0x0000, 0x0000, 0x0000, 0x3990, 0x4b3a, 0x3a61,
+	    0x2a66, 0x0000, 0x0000, 0x0000, 0x4900, 0x0000, 0x1efe, 0x0000,
+	    0x21bc, 0x3647, 0x3a68, 0x412e, 0x0000, 0x0000, 0x29db, 0x0790,
+	    0x0000, 0x0000, 0x0000, 0x4c8d, 0x166b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1f03, 0x2073, 0x0000, 0x310a, 0x0000, 0x37c0, 0x0000,
+	    0x13a2, 0x4830, 0x0612, 0x0000, 0x0000, 0x3416, 0x40b3, 0x480b,
+	    0x0000, 0x0000, 0x3902, 0x4083, 0x0d34, 0x0000, 0x24ef, 0x43b6,
+	    0x0000, 0x053a, 0x0000, 0x0000, 0x0000, 0x33c9, 0x487d, 0x0002,
+	    0x1621, 0x2bd0, 0x1f71, 0x0000, 0x1d6d, 0x2f34, 0x05d9, 0x42b6,
+	    0x3551, 0x11ac, 0x0000, 0x35d3, 0x00df, 0x1719, 0x3edf, 0x0000,
+	    0x0000, 0x3972, 0x0000, 0x128a, 0x0000, 0x0000, 0x3516, 0x370d,
+	    0x0000, 0x373a, 0x2505, 0x0000, 0x0000, 0x2ba9, 0x0000, 0x01e2,
+	    0x14b7, 0x0000, 0x1918, 0x0000, 0x0000, 0x2c20, 0x0000, 0x3e09,
+	    0x304c, 0x0489, 0x0000, 0x0000, 0x29dc, 0x0000, 0x0000, 0x0000,
+	    0x262b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b1d, 0x1139, 0x0000,
+	    0x0000, 0x0000, 0x1983, 0x0ffd, 0x3803, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x459a, 0x0000, 0x0000, 0x0000, 0x4bba,
+	    0x0000, 0x269b, 0x0000, 0x0882, 0x0000, 0x0000, 0x32da, 0x454a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3592, 0x0000, 0x101e, 0x2b18,
+	    0x4615, 0x2283, 0x3f23, 0x0000, 0x0000, 0x0017, 0x38db, 0x254b,
+	    0x0000, 0x2a3f, 0x0000, 0x49cd, 0x0000, 0x056c, 0x0000, 0x0000,
+	    0x433a, 0x24fd, 0x0000, 0x0000, 0x0968, 0x0000, 0x3569, 0x2e49,
+	    0x4a9d, 0x400a, 0x0000, 0x1974, 0x042f, 0x19e7, 0x0000, 0x01eb,
+	    0x0000, 0x0f1a, 0x3f50, 0x0000, 0x0eee, 0x0000, 0x3c1f, 0x2b1b,
+	    0x04c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22f1, 0x157f,
+	    0x0000, 0x0000, 0x0000, 0x3d78, 0x274b, 0x47a3, 0x0000, 0x1b95,
+	    0x0000, 0x2a89, 0x4cfd, 0x0000, 0x2e99, 0x0000, 0x1e76, 0x0000,
+	    0x30b0, 0x09d3, 0x227f, 0x0000, 0x0000, 0x0000, 0x0235, 0x0000,
+	    0x39f7, 0x4273, 0x0000, 0x1407, 0x0000, 0x34ff, 0x3124, 0x0000,
+	    0x0000, 0x3c14, 0x2427, 0x2ee4, 0x0000, 0x2133, 0x0000, 0x25b0,
+	    0x2294, 0x2f63, 0x135d, 0x0000, 0x0000, 0x334e, 0x0000, 0x2bb6,
+	    0x01f7, 0x0faa, 0x0000, 0x4b98, 0x2da6, 0x0000, 0x0000, 0x17cd,
+	    0x0000, 0x0000, 0x24cb, 0x0000, 0x0d4f, 0x1783, 0x0000, 0x0000,
+	    0x1a65, 0x0e5f, 0x0000, 0x0000, 0x3b59, 0x3afc, 0x0000, 0x372d,
+	    0x326e, 0x0a04, 0x0000, 0x1029, 0x1ffa, 0x0000, 0x0000, 0x3fe1,
+	    0x0000, 0x4005, 0x123d, 0x3c63, 0x0000, 0x2257, 0x0000, 0x0000,
+	    0x0000, 0x30de, 0x3bc6, 0x37c8, 0x0000, 0x2360, 0x02f1, 0x0000,
+	    0x24b7, 0x0000, 0x0d86, 0x0000, 0x0b52, 0x21d1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x385c, 0x2c74, 0x3856, 0x484b,
+	    0x0000, 0x1f19, 0x0000, 0x3159, 0x2f13, 0x0cde, 0x0000, 0x0000,
+	    0x0000, 0x487a, 0x0000, 0x1049, 0x228d, 0x3c15, 0x0000, 0x1428,
+	    0x0e9c, 0x3544, 0x0000, 0x4ab0, 0x4d0a, 0x0000, 0x44d0, 0x492b,
+	    0x3c65, 0x071d, 0x1ec9, 0x200b, 0x0000, 0x23e5, 0x0000, 0x3376,
+	    0x122b, 0x3269, 0x41c9, 0x2caa, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x48d0, 0x0000, 0x0000, 0x0000, 0x1212, 0x0000, 0x43df, 0x0561,
+	    0x482e, 0x0000, 0x0000, 0x029e, 0x4c6a, 0x0000, 0x38d6, 0x05b4,
+	    0x30fb, 0x0000, 0x0000, 0x0000, 0x3832, 0x1be8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4622, 0x0000, 0x229a, 0x0000, 0x0000, 0x0059,
+	    0x0173, 0x12ad, 0x0f1f, 0x0000, 0x2fd5, 0x14d7, 0x0000, 0x0000,
+	    0x1957, 0x0000, 0x0000, 0x0787, 0x0000, 0x0000, 0x1d91, 0x043b,
+	    0x0000, 0x0000, 0x3c71, 0x2d45, 0x0fcd, 0x1899, 0x0000, 0x0000,
+	    0x20df, 0x2c7d, 0x0270, 0x4b4f, 0x40e2, 0x0000, 0x2a94, 0x0aae,
+	    0x0c16, 0x0000, 0x12cb, 0x0000, 0x0000, 0x0000, 0x3127, 0x4ada,
+	    0x45cf, 0x2def, 0x0000, 0x0000, 0x0e37, 0x374d, 0x06c1, 0x395c,
+	    0x326a, 0x0755, 0x0000, 0x0000, 0x0000, 0x41b6, 0x4de0, 0x39f2,
+	    0x18e8, 0x4c8e, 0x0000, 0x1ea9, 0x0000, 0x0000, 0x11c5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26da, 0x0000, 0x24ac,
+	    0x14de, 0x359a, 0x0000, 0x0000, 0x0000, 0x1675, 0x0000, 0x0000,
+	    0x0000, 0x0e37, 0x0000, 0x1065, 0x0f9f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1e34, 0x2132, 0x4d27, 0x4bc1, 0x0000,
+	    0x0000, 0x251a, 0x0000, 0x08fe, 0x0644, 0x1b04, 0x2073, 0x210e,
+	    0x0000, 0x0000, 0x232c, 0x289d, 0x0000, 0x0b22, 0x348a, 0x0000,
+	    0x0000, 0x0000, 0x26a3, 0x0000, 0x4e12, 0x0000, 0x0d9f, 0x40e5,
+	    0x4176, 0x1e0c, 0x0a1c, 0x35d7, 0x0000, 0x0000, 0x0000, 0x0407,
+	    0x0a3e, 0x03c0, 0x0000, 0x0000, 0x1fd8, 0x0000, 0x0000, 0x0000,
+	    0x058a, 0x198b, 0x014c, 0x0000, 0x2f1c, 0x37ca, 0x0000, 0x010b,
+	    0x0000, 0x0000, 0x3fc2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3e83, 0x0000, 0x41e7, 0x31d0, 0x1295, 0x251b, 0x4411, 0x0000,
+	    0x1554, 0x0000, 0x1b47, 0x3d4b, 0x0603, 0x0000, 0x4d51, 0x0b9f,
+	    0x29c7, 0x2c0b, 0x19a6, 0x0000, 0x0374, 0x0000, 0x0b8d, 0x0000,
+	    0x0000, 0x4484, 0x2e81, 0x414a, 0x143a, 0x3404, 0x06bb, 0x0000,
+	    0x0000, 0x274a, 0x0000, 0x2240, 0x0000, 0x04fa, 0x2abd, 0x0000,
+	    0x3e70, 0x0000, 0x0000, 0x3fd1, 0x0000, 0x33a6, 0x45af, 0x4598,
+	    0x0000, 0x0000, 0x0000, 0x39d1, 0x0000, 0x0000, 0x2564, 0x0000,
+	    0x1c3d, 0x4787, 0x210a, 0x0865, 0x1a71, 0x1e1f, 0x0000, 0x0000,
+	    0x0000, 0x0196, 0x0aea, 0x4501, 0x48ff, 0x0000, 0x0000, 0x0000,
+	    0x38d1, 0x0000, 0x3094, 0x3006, 0x2335, 0x2b4e, 0x0000, 0x0000,
+	    0x1e02, 0x2b21, 0x369d, 0x0000, 0x1e9e, 0x0000, 0x0000, 0x4a14,
+	    0x0494, 0x15bc, 0x0000, 0x27c1, 0x0000, 0x0000, 0x2a70, 0x0000,
+	    0x3dc6, 0x0000, 0x21b4, 0x0000, 0x4265, 0x199d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3bbf, 0x2c50, 0x0000, 0x2d1a, 0x3de1, 0x0000,
+	    0x0000, 0x1dfe, 0x0548, 0x12cf, 0x25e1, 0x1f8a, 0x0000, 0x1fae,
+	    0x0000, 0x0000, 0x25b4, 0x21a0, 0x0000, 0x0000, 0x0000, 0x10ff,
+	    0x0000, 0x0000, 0x0000, 0x4e16, 0x3abc, 0x0000, 0x30ba, 0x3540,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x14d1, 0x2118, 0x2cd7,
+	    0x3475, 0x31f0, 0x06ab, 0x0dac, 0x0000, 0x0000, 0x0000, 0x3e34,
+	    0x1ef3, 0x2462, 0x2d16, 0x0000, 0x0000, 0x0000, 0x2f4f, 0x0000,
+	    0x2fdd, 0x0000, 0x1c45, 0x28db, 0x0000, 0x2d2d, 0x0000, 0x2767,
+	    0x377b, 0x1093, 0x45a9, 0x0000, 0x20f2, 0x0000, 0x1833, 0x46bc,
+	    0x0e08, 0x1da8, 0x0000, 0x2516, 0x0000, 0x3af9, 0x131a, 0x2ea3,
+	    0x4d65, 0x0000, 0x238c, 0x18ba, 0x0000, 0x0000, 0x4bc2, 0x1a96,
+	    0x31e2, 0x2748, 0x0f1b, 0x1f81, 0x48c6, 0x186d, 0x4894, 0x0fbf,
+	    0x0000, 0x0000, 0x4835, 0x0b0b, 0x2f58, 0x0500, 0x0ca8, 0x1ce8,
+	    0x4622, 0x0000, 0x0000, 0x1e32, 0x0000, 0x17cc, 0x2405, 0x2499,
+	    0x0000, 0x468a, 0x3f9e, 0x4c8a, 0x1533, 0x110f, 0x0000, 0x446c,
+	    0x07a9, 0x0000, 0x3c7d, 0x4636, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0394, 0x0000, 0x31b8, 0x0000, 0x3de1, 0x0000, 0x0000, 0x3a51,
+	    0x01b5, 0x0000, 0x2e4c, 0x0000, 0x44b6, 0x2690, 0x1bfb, 0x0000,
+	    0x409f, 0x382a, 0x0000, 0x2dc2, 0x0000, 0x0000, 0x356c, 0x0000,
+	    0x30f0, 0x4078, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e4f, 0x0000, 0x0000, 0x4d97, 0x2759, 0x0ed1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1554, 0x0000, 0x15e6, 0x425a,
+	    0x29e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05c0, 0x0e34,
+	    0x0000, 0x0000, 0x2aa2, 0x259c, 0x2e24, 0x0000, 0x1677, 0x0000,
+	    0x0098, 0x131e, 0x231c, 0x4b8e, 0x399d, 0x4341, 0x0000, 0x2fca,
+	    0x1bb0, 0x1c43, 0x3a58, 0x1dbb, 0x4216, 0x0000, 0x0000, 0x0223,
+	    0x0000, 0x0000, 0x0000, 0x2011, 0x0000, 0x3682, 0x0ce0, 0x0000,
+	    0x2669, 0x3ac0, 0x27b6, 0x0000, 0x0be4, 0x0000, 0x481f, 0x0000,
+	    0x0000, 0x2de5, 0x0000, 0x0000, 0x0000, 0x2970, 0x06c7, 0x1e4c,
+	    0x0000, 0x18bf, 0x0280, 0x0000, 0x0000, 0x451b, 0x0901, 0x0924,
+	    0x29be, 0x0000, 0x1f25, 0x0000, 0x4503, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x33a5,
+	    0x4bcc, 0x20b0, 0x232e, 0x1cff, 0x4c9c, 0x0000, 0x3abf, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0f42, 0x343c, 0x13ba, 0x0000, 0x2328,
+	    0x0000, 0x2bdd, 0x0000, 0x0000, 0x1d61, 0x1685, 0x2edd, 0x2acf,
+	    0x0000, 0x0d9e, 0x0000, 0x1559, 0x0000, 0x0018, 0x21a2, 0x0000,
+	    0x0000, 0x4412, 0x1661, 0x33c1, 0x0000, 0x0000, 0x42aa, 0x0316,
+	    0x3da5, 0x172d, 0x400a, 0x0000, 0x0000, 0x0000, 0x0000, 0x25fc,
+	    0x396c, 0x0000, 0x0000, 0x301a, 0x041f, 0x42d5, 0x45a5, 0x0000,
+	    0x0000, 0x4df8, 0x0000, 0x116e, 0x4867, 0x10db, 0x0000, 0x33bf,
+	    0x1f76, 0x4c96, 0x0000, 0x0000, 0x020a, 0x0000, 0x18d6, 0x4446,
+	    0x2abf, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f74, 0x2dee, 0x478b,
+	    0x0cdf, 0x0000, 0x2012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x209b, 0x0000, 0x0000, 0x0000, 0x0000, 0x17d2, 0x311b,
+	    0x0000, 0x4589, 0x0000, 0x1745, 0x4c73, 0x3d99, 0x0000, 0x2468,
+	    0x30b5, 0x0000, 0x48a9, 0x49df, 0x0000, 0x3b87, 0x26f7, 0x0000,
+	    0x1e75, 0x2b66, 0x1d13, 0x0000, 0x3187, 0x4497, 0x0000, 0x1d0e,
+	    0x0000, 0x3678, 0x1031, 0x1325, 0x3806, 0x00e1, 0x1d87, 0x0000,
+	    0x2407, 0x2b43, 0x2058, 0x1672, 0x33e7, 0x0000, 0x0000, 0x0da9,
+	    0x0000, 0x4e0c, 0x4787, 0x4032, 0x04d2, 0x2a1c, 0x3610, 0x0000,
+	    0x1958, 0x34fd, 0x0796, 0x0000, 0x0000, 0x0cc3, 0x0000, 0x0965,
+	    0x2ea8, 0x0000, 0x0000, 0x3017, 0x4db2, 0x0000, 0x0a67, 0x0000,
+	    0x0b77, 0x0000, 0x0000, 0x443e, 0x208a, 0x0000, 0x0000, 0x2e49,
+	    0x0000, 0x0661, 0x0000, 0x0000, 0x0fe7, 0x0000, 0x0000, 0x39fa,
+	    0x3a4d, 0x20a2, 0x4893, 0x0000, 0x3085, 0x3f56, 0x0000, 0x08c8,
+	    0x3294, 0x350e, 0x3b95, 0x0000, 0x1ea6, 0x397a, 0x0000, 0x2604,
+	    0x0000, 0x1664, 0x0000, 0x2ca4, 0x28e9, 0x3add, 0x0000, 0x0000,
+	    0x0ea1, 0x0000, 0x19be, 0x1af5, 0x2ffc, 0x20ae, 0x079a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4385, 0x0000, 0x0360, 0x2633,
+	    0x2d21, 0x3cd4, 0x19db, 0x3112, 0x09de, 0x265d, 0x0000, 0x4b48,
+	    0x20d9, 0x0000, 0x0000, 0x0000, 0x1cea, 0x0000, 0x0000, 0x0000,
+	    0x1d79, 0x4b49, 0x0000, 0x0000, 0x0f6b, 0x0000, 0x49c5, 0x2721,
+	    0x0000, 0x20f4, 0x0c33, 0x0000, 0x36ea, 0x04fe, 0x4a42, 0x03ba,
+	    0x2114, 0x0000, 0x0000, 0x1c7e, 0x0000, 0x2ca7, 0x1119, 0x0000,
+	    0x247d, 0x0000, 0x0000, 0x0000, 0x458d, 0x4109, 0x0000, 0x1409,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0c35, 0x480b, 0x0000, 0x3a60,
+	    0x0000, 0x20c8, 0x0000, 0x2887, 0x0000, 0x2c29, 0x025f, 0x393f,
+	    0x0000, 0x0000, 0x48ea, 0x111f, 0x033f, 0x1b81, 0x0000, 0x00ce,
+	    0x0000, 0x0000, 0x074e, 0x3cf9, 0x0000, 0x3cfd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x043b, 0x121a, 0x0000, 0x302a, 0x0000, 0x32aa,
+	    0x0000, 0x1aba, 0x2914, 0x1f3a, 0x0000, 0x0000, 0x0000, 0x008b,
+	    0x059d, 0x0000, 0x0000, 0x0c4e, 0x0000, 0x0000, 0x1bb1, 0x2c8a,
+	    0x0000, 0x3825, 0x0000, 0x3726, 0x4090, 0x1b18, 0x3c8a, 0x0000,
+	    0x3ebb, 0x0000, 0x0000, 0x0000, 0x1caa, 0x0000, 0x0000, 0x350a,
+	    0x212c, 0x2297, 0x0000, 0x0000, 0x0000, 0x0000, 0x427c, 0x385a,
+	    0x0000, 0x0250, 0x0000, 0x0000, 0x0000, 0x0000, 0x28e4, 0x0000,
+	    0x0000, 0x300c, 0x3055, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x11d2, 0x360d, 0x0000, 0x10e6, 0x0000, 0x089e, 0x0000, 0x0000,
+	    0x41f6, 0x3050, 0x04c7, 0x36a9, 0x0d14, 0x319c, 0x4d30, 0x04f4,
+	    0x0000, 0x0000, 0x0000, 0x39d5, 0x0000, 0x0b1b, 0x0000, 0x1c10,
+	    0x2c91, 0x0000, 0x0000, 0x0000, 0x3646, 0x3b42, 0x36c4, 0x4cfa,
+	    0x0000, 0x366f, 0x308c, 0x4b26, 0x0000, 0x0000, 0x129c, 0x2e3e,
+	    0x0000, 0x2b07, 0x0dca, 0x0000, 0x3225, 0x0000, 0x1519, 0x0000,
+	    0x09e5, 0x0000, 0x0000, 0x1ece, 0x0000, 0x0f46, 0x0000, 0x2850,
+	    0x012c, 0x0c01, 0x0000, 0x0000, 0x1c5a, 0x3afe, 0x33e5, 0x0000,
+	    0x0000, 0x0000, 0x1580, 0x4cc0, 0x2ac4, 0x258c, 0x3e80, 0x0d81,
+	    0x0000, 0x191b, 0x3998, 0x0000, 0x499f, 0x2cda, 0x10e7, 0x1ac9,
+	    0x0000, 0x0000, 0x0000, 0x3fd4, 0x4683, 0x1b64, 0x2f37, 0x150c,
+	    0x0bb6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4003, 0x0000, 0x0000, 0x0000, 0x21a9, 0x312a, 0x04c5, 0x0000,
+	    0x110d, 0x0000, 0x0000, 0x4b00, 0x44c3, 0x0000, 0x0000, 0x2424,
+	    0x3cb9, 0x0000, 0x0000, 0x3d33, 0x0000, 0x1e5b, 0x0f27, 0x4284,
+	    0x1f3b, 0x3179, 0x0000, 0x2773, 0x0000, 0x1d1a, 0x0000, 0x0000,
+	    0x0b03, 0x0000, 0x287c, 0x3d34, 0x0000, 0x1d92, 0x449f, 0x0000,
+	    0x4473, 0x01f8, 0x149c, 0x1174, 0x3de5, 0x1204, 0x0000, 0x0000,
+	    0x1413, 0x0f8a, 0x2ed0, 0x0000, 0x0000, 0x11d2, 0x3767, 0x0000,
+	    0x0000, 0x0997, 0x0000, 0x0000, 0x1e44, 0x0000, 0x0000, 0x3f52,
+	    0x0000, 0x0000, 0x3c31, 0x1975, 0x1d02, 0x0000, 0x0000, 0x0000,
+	    0x336c, 0x29cc, 0x0000, 0x0000, 0x3d5f, 0x0000, 0x0000, 0x2394,
+	    0x29d6, 0x444c, 0x2ef1, 0x1e68, 0x3a84, 0x45e4, 0x0000, 0x20d2,
+	    0x3d20, 0x0000, 0x49a8, 0x0000, 0x4a53, 0x0000, 0x29f9, 0x3206,
+	    0x0000, 0x3242, 0x0000, 0x0000, 0x444a, 0x0000, 0x4cb6, 0x057c,
+	    0x0000, 0x067a, 0x15ec, 0x0000, 0x0917, 0x0000, 0x4d99, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x019a, 0x0000, 0x28a9, 0x0000,
+	    0x03b8, 0x1af6, 0x0000, 0x0000, 0x48e6, 0x252a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x48f0, 0x0000, 0x377a, 0x0000,
+	    0x0000, 0x4437, 0x1a2d, 0x4298, 0x4e03, 0x0000, 0x15b9, 0x0000,
+	    0x0000, 0x3e32, 0x0000, 0x1de2, 0x0000, 0x1a85, 0x446a, 0x0000,
+	    0x14a3, 0x1b39, 0x2d8d, 0x018f, 0x0000, 0x4d57, 0x0000, 0x0000,
+	    0x06a9, 0x0000, 0x0000, 0x4aed, 0x0000, 0x405e, 0x0000, 0x0000,
+	    0x456b, 0x0000, 0x4278, 0x0000, 0x0000, 0x401f, 0x0000, 0x0000,
+	    0x0000, 0x4364, 0x0000, 0x2d8f, 0x0000, 0x0000, 0x11a8, 0x0000,
+	    0x097b, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e44, 0x0e61, 0x0000,
+	    0x0000, 0x4aec, 0x04c3, 0x0000, 0x1448, 0x0000, 0x0000, 0x0000,
+	    0x09a3, 0x4a3a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1448, 0x0000, 0x1c38, 0x1464, 0x057e, 0x0000, 0x35a3, 0x0000,
+	    0x490b, 0x2188, 0x34cc, 0x0000, 0x0000, 0x15e6, 0x2785, 0x0000,
+	    0x0000, 0x0000, 0x0d6d, 0x35aa, 0x2077, 0x0000, 0x3edb, 0x3916,
+	    0x0000, 0x2588, 0x0000, 0x0000, 0x2674, 0x1084, 0x20c2, 0x0000,
+	    0x2085, 0x0000, 0x0000, 0x0000, 0x0605, 0x0000, 0x0ef8, 0x0000,
+	    0x4267, 0x0000, 0x1c83, 0x0000, 0x2484, 0x1fd3, 0x3eb4, 0x16ca,
+	    0x29d5, 0x1787, 0x2391, 0x0000, 0x2409, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4861, 0x141c, 0x035a, 0x1c4c, 0x32b6,
+	    0x0783, 0x0000, 0x0000, 0x0000, 0x0000, 0x295c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4b56, 0x2e2a, 0x0000, 0x0000, 0x1861, 0x0000,
+	    0x0000, 0x0000, 0x25d7, 0x0000, 0x4cdf, 0x223a, 0x0000, 0x0000,
+	    0x0000, 0x4af1, 0x0000, 0x0d1a, 0x0000, 0x0000, 0x3fcd, 0x0000,
+	    0x0000, 0x0000, 0x4557, 0x4b12, 0x2c3c, 0x3513, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x214a, 0x0000, 0x2665, 0x0000,
+	    0x4153, 0x0000, 0x0000, 0x2ad4, 0x4882, 0x0000, 0x0000, 0x0000,
+	    0x48e2, 0x0000, 0x31f1, 0x0000, 0x0000, 0x47a8, 0x1dba, 0x0000,
+	    0x050c, 0x0000, 0x0000, 0x15dc, 0x0000, 0x38e6, 0x0415, 0x0000,
+	    0x0000, 0x0000, 0x47a6, 0x428f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0b07, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0182, 0x19c9, 0x0000, 0x0000, 0x0000, 0x0000, 0x1709,
+	    0x1b61, 0x1ef2, 0x2fcb, 0x1782, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02b4, 0x1604, 0x4c55, 0x42ce, 0x0000, 0x260a, 0x0000,
+	    0x0000, 0x41ed, 0x0000, 0x1e2a, 0x0000, 0x409e, 0x47ee, 0x4b19,
+	    0x2edd, 0x17ad, 0x2853, 0x0000, 0x0000, 0x4585, 0x2ed4, 0x2b55,
+	    0x1000, 0x07fc, 0x0000, 0x2d41, 0x42af, 0x010f, 0x400e, 0x2b69,
+	    0x1257, 0x0b5c, 0x0000, 0x0000, 0x4da4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4a27, 0x0000, 0x0000, 0x0000, 0x43e8,
+	    0x1f60, 0x0000, 0x0000, 0x1da0, 0x0000, 0x308b, 0x15f3, 0x0000,
+	    0x0000, 0x3c11, 0x0000, 0x12c8, 0x2ba1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x180d, 0x0000, 0x0000, 0x1df3, 0x0000, 0x0000, 0x0000,
+	    0x31fe, 0x17d3, 0x0cf0, 0x335c, 0x0000, 0x0000, 0x3ea4, 0x0000,
+	    0x1cc4, 0x2248, 0x3cfa, 0x0000, 0x351e, 0x0000, 0x3410, 0x37ae,
+	    0x0000, 0x28c9, 0x0000, 0x0000, 0x0000, 0x1f3e, 0x0000, 0x0000,
+	    0x0000, 0x1a7f, 0x2214, 0x0000, 0x0000, 0x2035, 0x4a01, 0x0000,
+	    0x0000, 0x026a, 0x09d0, 0x07bf, 0x0000, 0x0827, 0x37b6, 0x30a1,
+	    0x00fa, 0x0000, 0x0000, 0x3817, 0x4729, 0x0000, 0x0000, 0x1db0,
+	    0x0944, 0x0ed6, 0x0000, 0x12ef, 0x29c6, 0x42d9, 0x1ebd, 0x04fd,
+	    0x14d5, 0x4b6c, 0x3ddc, 0x0000, 0x4591, 0x41e2, 0x0000, 0x4e01,
+	    0x0512, 0x0000, 0x1b1e, 0x180c, 0x0000, 0x4d11, 0x0eb2, 0x32b5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x29f7, 0x30a1, 0x3015,
+	    0x2651, 0x0000, 0x3546, 0x1f39, 0x23e8, 0x2480, 0x06ec, 0x0000,
+	    0x1c1c, 0x25a5, 0x219a, 0x0000, 0x0488, 0x302a, 0x0000, 0x0e05,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1868, 0x36bf, 0x012d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2a98, 0x3b15, 0x0000, 0x2edb,
+	    0x0000, 0x4ab7, 0x4653, 0x2364, 0x1a22, 0x3eda, 0x2017, 0x4766,
+	    0x4c3f, 0x0000, 0x412b, 0x1527, 0x0000, 0x4ab0, 0x1db2, 0x0000,
+	    0x4db4, 0x0000, 0x0000, 0x0350, 0x0000, 0x0000, 0x002e, 0x33bd,
+	    0x107d, 0x0000, 0x0000, 0x0000, 0x02ab, 0x233a, 0x006a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4687, 0x2b08, 0x1981, 0x0bf6,
+	    0x389e, 0x0000, 0x3a11, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0ae2, 0x0000, 0x0000, 0x0000, 0x29ab, 0x0000,
+	    0x0000, 0x109a, 0x185a, 0x46a1, 0x4bc8, 0x0000, 0x09e9, 0x2f90,
+	    0x066e, 0x29c6, 0x0000, 0x1e04, 0x0b5e, 0x32fa, 0x2f8e, 0x0000,
+	    0x0000, 0x0000, 0x1498, 0x3007, 0x0000, 0x0000, 0x494b, 0x0000,
+	    0x30b6, 0x01fe, 0x0aa1, 0x0000, 0x2007, 0x0000, 0x1a54, 0x0769,
+	    0x2ca2, 0x07f2, 0x145c, 0x0000, 0x3a1a, 0x3df7, 0x4a04, 0x112b,
+	    0x0000, 0x043a, 0x32c1, 0x077a, 0x0f05, 0x0f23, 0x0000, 0x0000,
+	    0x41e1, 0x2de3, 0x43e1, 0x33d0, 0x1f30, 0x1db7, 0x0000, 0x0000,
+	    0x1546, 0x1641, 0x1db4, 0x3e3e, 0x0ccc, 0x22b5, 0x020e, 0x0000,
+	    0x0000, 0x0137, 0x1bf1, 0x2465, 0x0000, 0x345d, 0x37d9, 0x0000,
+	    0x4218, 0x0000, 0x0000, 0x0000, 0x2416, 0x026f, 0x0000, 0x4b3c,
+	    0x0000, 0x0000, 0x2d02, 0x1600, 0x0000, 0x11fd, 0x0000, 0x0000,
+	    0x3c16, 0x28b4, 0x181c, 0x0000, 0x28b3, 0x076b, 0x057f, 0x0d7e,
+	    0x0000, 0x4783, 0x0000, 0x4b9f, 0x1fb5, 0x2c15, 0x3fec, 0x0000,
+	    0x0000, 0x34e1, 0x0218, 0x3ca8, 0x2718, 0x0c53, 0x039e, 0x05c8,
+	    0x0000, 0x1071, 0x3e6b, 0x0000, 0x0000, 0x44d8, 0x0000, 0x0000,
+	    0x07d1, 0x0000, 0x4339, 0x1c0a, 0x013e, 0x0000, 0x12f7, 0x0000,
+	    0x43c0, 0x0000, 0x3d98, 0x0000, 0x2268, 0x0000, 0x2a64, 0x0000,
+	    0x0000, 0x3d37, 0x2e38, 0x3e93, 0x0000, 0x1a9d, 0x3714, 0x27cb,
+	    0x0000, 0x4499, 0x49a0, 0x408d, 0x1e99, 0x3296, 0x3126, 0x09ff,
+	    0x0000, 0x1b03, 0x3b28, 0x18d3, 0x020e, 0x200f, 0x0a98, 0x20f0,
+	    0x4e15, 0x0000, 0x04ec, 0x0000, 0x011d, 0x0000, 0x2b71, 0x11a8,
+	    0x2006, 0x2d63, 0x3c76, 0x12ba, 0x22e2, 0x2ed8, 0x2857, 0x06fa,
+	    0x3902, 0x1b1c, 0x2c58, 0x0000, 0x0000, 0x3f45, 0x067d, 0x0000,
+	    0x3654, 0x4c9a, 0x00a1, 0x23d6, 0x0892, 0x3e0b, 0x1305, 0x0000,
+	    0x1262, 0x12f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x12c2, 0x38b8,
+	    0x3c6f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x244e, 0x162a,
+	    0x2c74, 0x1af5, 0x32f0, 0x3cc2, 0x39af, 0x0000, 0x0000, 0x0beb,
+	    0x1cb5, 0x0000, 0x1ceb, 0x21fa, 0x194d, 0x0000, 0x0000, 0x0556,
+	    0x0000, 0x1ddf, 0x0000, 0x0000, 0x0000, 0x0000, 0x4309, 0x4755,
+	    0x01a0, 0x0000, 0x2c46, 0x0000, 0x0662, 0x050f, 0x0372, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x18db, 0x2c54, 0x4b29, 0x4a49, 0x22bd,
+	    0x14ca, 0x0000, 0x0000, 0x1c09, 0x1ee0, 0x362d, 0x37e4, 0x1b0d,
+	    0x0000, 0x4bb6, 0x2dbf, 0x0000, 0x2e4d, 0x0f28, 0x0000, 0x19dd,
+	    0x0d84, 0x04f5, 0x4d9a, 0x3f57, 0x037b, 0x48d2, 0x0000, 0x43dc,
+	    0x0000, 0x2fcc, 0x0000, 0x0000, 0x0000, 0x0000, 0x2955, 0x0128,
+	    0x1b44, 0x26cc, 0x0000, 0x0f6d, 0x0794, 0x0000, 0x0000, 0x458c,
+	    0x0000, 0x1674, 0x31c1, 0x4bbb, 0x0000, 0x26d2, 0x0000, 0x0000,
+	    0x27d4, 0x0000, 0x0000, 0x4248, 0x0000, 0x0000, 0x0000, 0x3ce1,
+	    0x0000, 0x3942, 0x495c, 0x24c0, 0x4a32, 0x0000, 0x0000, 0x2c71,
+	    0x4134, 0x18cf, 0x2cfb, 0x0cc3, 0x0000, 0x0000, 0x2174, 0x1fc4,
+	    0x27c8, 0x0000, 0x0000, 0x2db4, 0x0000, 0x0000, 0x064c, 0x185c,
+	    0x3cfb, 0x0da5, 0x212b, 0x0000, 0x0000, 0x3c6b, 0x39fe, 0x1d6f,
+	    0x1fb3, 0x4b67, 0x0000, 0x0372, 0x1bb1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3468, 0x061d, 0x1ec4, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3c58, 0x008f, 0x1de5, 0x1c53, 0x21ec,
+	    0x332e, 0x0000, 0x0000, 0x0000, 0x20a3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1b1d, 0x0000, 0x15d3, 0x1c0a, 0x0000, 0x0000, 0x08f0,
+	    0x1e87, 0x167a, 0x0000, 0x0b95, 0x33b6, 0x1c83, 0x3ba7, 0x29f5,
+	    0x0000, 0x44b4, 0x4b92, 0x0000, 0x0fb0, 0x098a, 0x46f7, 0x12c6,
+	    0x0000, 0x3dfe, 0x0000, 0x3ebc, 0x2927, 0x1aa6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x29fa, 0x3c78, 0x3789, 0x3f97, 0x0cf4, 0x1028,
+	    0x3fb9, 0x0000, 0x0000, 0x3d34, 0x1b79, 0x2575, 0x3547, 0x0000,
+	    0x1cf7, 0x0000, 0x0000, 0x0000, 0x2815, 0x0000, 0x0ac0, 0x0c84,
+	    0x0551, 0x27dd, 0x0000, 0x0000, 0x0000, 0x18b1, 0x0000, 0x0d36,
+	    0x0000, 0x47de, 0x0e83, 0x0000, 0x0ebe, 0x006f, 0x03e8, 0x3122,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2779,
+	    0x2c4f, 0x1f6b, 0x169d, 0x0000, 0x0000, 0x455f, 0x0000, 0x0000,
+	    0x1832, 0x1ac3, 0x0000, 0x0000, 0x0000, 0x2d02, 0x1424, 0x2621,
+	    0x0000, 0x41eb, 0x2a23, 0x3e67, 0x0000, 0x28dd, 0x0000, 0x1cf7,
+	    0x0000, 0x20ad, 0x2b16, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3220, 0x0a7c, 0x3309, 0x2146, 0x0000, 0x0000, 0x10c8, 0x0000,
+	    0x0000, 0x249a, 0x2226, 0x0000, 0x0000, 0x0cb3, 0x1774, 0x0000,
+	    0x18c0, 0x3fc4, 0x42d1, 0x1403, 0x0000, 0x0000, 0x0e86, 0x0aed,
+	    0x0000, 0x2e57, 0x0000, 0x0000, 0x0000, 0x0000, 0x48f8, 0x09b8,
+	    0x0000, 0x3d1b, 0x35cb, 0x0000, 0x0000, 0x369a, 0x11fd, 0x42e6,
+	    0x232c, 0x11b1, 0x0000, 0x414a, 0x424a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4008, 0x0000, 0x11ca, 0x0000,
+	    0x2610, 0x0000, 0x0000, 0x0000, 0x37c5, 0x1b70, 0x0000, 0x0000,
+	    0x0849, 0x3b1f, 0x25d7, 0x23f1, 0x2cf4, 0x44ed, 0x0fbc, 0x0000,
+	    0x3cad, 0x3c95, 0x49d6, 0x0a14, 0x0000, 0x0000, 0x0000, 0x054d,
+	    0x2623, 0x0000, 0x0292, 0x1ad0, 0x3831, 0x3441, 0x20e5, 0x0000,
+	    0x4019, 0x2576, 0x3582, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b25,
+	    0x2263, 0x0000, 0x30f2, 0x03da, 0x0000, 0x0000, 0x34ae, 0x15bf,
+	    0x0000, 0x0000, 0x0000, 0x3879, 0x121e, 0x0000, 0x0000, 0x1bb0,
+	    0x0000, 0x4079, 0x0000, 0x024f, 0x0000, 0x0000, 0x23e9, 0x3209,
+	    0x3c20, 0x0000, 0x31c7, 0x3c1d, 0x223f, 0x149e, 0x2d39, 0x2c9b,
+	    0x2d9a, 0x05a7, 0x0000, 0x0000, 0x2a3b, 0x0000, 0x13bd, 0x0000,
+	    0x4cd4, 0x31a8, 0x49c3, 0x0000, 0x0000, 0x060c, 0x2639, 0x3ef4,
+	    0x0d32, 0x3b4f, 0x49f7, 0x3c54, 0x0000, 0x10d9, 0x044a, 0x0000,
+	    0x3892, 0x12b2, 0x3d3d, 0x0000, 0x2b26, 0x0000, 0x0000, 0x0000,
+	    0x0a84, 0x0f72, 0x0000, 0x0000, 0x35aa, 0x0000, 0x0000, 0x21f7,
+	    0x2e4e, 0x352b, 0x235b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3c06, 0x4060, 0x2031, 0x12d5, 0x113b, 0x194c,
+	    0x3823, 0x2b58, 0x0f4c, 0x0e5a, 0x0000, 0x2976, 0x35f3, 0x0000,
+	    0x3ce6, 0x0000, 0x34dc, 0x484f, 0x0000, 0x05ca, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2eaf, 0x22d3, 0x1b8d, 0x0000, 0x0000, 0x1cf0,
+	    0x0000, 0x0855, 0x0000, 0x3c3b, 0x0e77, 0x0d5f, 0x2a35, 0x14a0,
+	    0x0000, 0x0000, 0x2849, 0x0550, 0x1209, 0x3846, 0x00c8, 0x0000,
+	    0x33a7, 0x4051, 0x0000, 0x19f5, 0x0000, 0x37b2, 0x0000, 0x13c4,
+	    0x0000, 0x0000, 0x0000, 0x4a0d, 0x22f5, 0x0000, 0x197f, 0x1bda,
+	    0x34f7, 0x0000, 0x0000, 0x4595, 0x0323, 0x0000, 0x2dab, 0x2fd0,
+	    0x2607, 0x33ea, 0x36e7, 0x42f4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0af4, 0x0000, 0x0000, 0x0000, 0x2182, 0x20bd, 0x4c31, 0x29df,
+	    0x24cb, 0x197b, 0x2df3, 0x0000, 0x0fe9, 0x494a, 0x0000, 0x314b,
+	    0x217d, 0x0000, 0x441f, 0x0000, 0x0000, 0x0000, 0x047b, 0x0000,
+	    0x0000, 0x0000, 0x4b95, 0x3d4b, 0x0086, 0x0000, 0x117d, 0x304a,
+	    0x0000, 0x0000, 0x3dc1, 0x0000, 0x039d, 0x0000, 0x30cb, 0x0000,
+	    0x3e77, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a03, 0x1921, 0x2c08,
+	    0x4d1a, 0x14e8, 0x04b2, 0x3c4d, 0x166f, 0x36a7, 0x19f6, 0x0000,
+	    0x0000, 0x2897, 0x0000, 0x3b03, 0x0000, 0x0000, 0x0000, 0x01f7,
+	    0x0000, 0x2c72, 0x0000, 0x2f1e, 0x1414, 0x0000, 0x1687, 0x0000,
+	    0x338f, 0x1af4, 0x0000, 0x191f, 0x459b, 0x0000, 0x30b1, 0x0275,
+	    0x423c, 0x1de7, 0x4a47, 0x2bb7, 0x0000, 0x138e, 0x2b3d, 0x0000,
+	    0x3306, 0x0000, 0x0000, 0x41e7, 0x4076, 0x072a, 0x1633, 0x26b3,
+	    0x4832, 0x10a9, 0x3904, 0x0000, 0x3b7b, 0x3636, 0x2ecd, 0x0000,
+	    0x0000, 0x0df4, 0x238a, 0x3b93, 0x0000, 0x0000, 0x0000, 0x4190,
+	    0x49f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x173e, 0x336b, 0x21eb,
+	    0x0000, 0x21ac, 0x0000, 0x1919, 0x31d3, 0x0f3b, 0x4693, 0x250a,
+	    0x30b6, 0x4209, 0x30e7, 0x0000, 0x4718, 0x4247, 0x3863, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x336a, 0x3a74, 0x0000, 0x4891, 0x0000,
+	    0x0000, 0x0000, 0x0d80, 0x22bd, 0x1979, 0x0000, 0x1b79, 0x0000,
+	    0x2dd3, 0x39c3, 0x0bcf, 0x4941, 0x23f5, 0x0000, 0x0000, 0x4606,
+	    0x0000, 0x3156, 0x00c5, 0x0000, 0x0000, 0x0000, 0x3e05, 0x13c6,
+	    0x0000, 0x1d7e, 0x0000, 0x0000, 0x0eef, 0x00ae, 0x40b6, 0x0000,
+	    0x0000, 0x0fe9, 0x0000, 0x0000, 0x140a, 0x0000, 0x0000, 0x2db2,
+	    0x30a7, 0x3754, 0x0bb9, 0x33f2, 0x064a, 0x0a61, 0x0000, 0x0000,
+	    0x3782, 0x0dab, 0x0000, 0x0721, 0x0000, 0x0000, 0x37ab, 0x0000,
+	    0x0000, 0x0f8d, 0x0000, 0x2d0c, 0x0000, 0x0000, 0x284d, 0x4e1f,
+	    0x0000, 0x3434, 0x2d49, 0x2a33, 0x0000, 0x3435, 0x0000, 0x4b30,
+	    0x0aaf, 0x3cf4, 0x41b5, 0x0000, 0x2ca7, 0x4de6, 0x0000, 0x05c0,
+	    0x0000, 0x19d8, 0x1b67, 0x4756, 0x2b8c, 0x2943, 0x0000, 0x0000,
+	    0x4475, 0x1d45, 0x24ed, 0x356f, 0x2542, 0x2250, 0x2b67, 0x3bf5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e58, 0x0000, 0x0000, 0x0000,
+	    0x2dc4, 0x4926, 0x0220, 0x15a4, 0x14d1, 0x1d6d, 0x44a2, 0x134e,
+	    0x3fe5, 0x0000, 0x30e5, 0x0000, 0x37ad, 0x0000, 0x0dce, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x379d, 0x294e, 0x1544, 0x1f03,
+	    0x0000, 0x0000, 0x42de, 0x0000, 0x1311, 0x0c29, 0x2974, 0x203c,
+	    0x4079, 0x0000, 0x18b3, 0x1fa2, 0x0000, 0x298e, 0x0000, 0x0000,
+	    0x1c73, 0x4152, 0x0000, 0x0580, 0x14d9, 0x152a, 0x47fd, 0x0000,
+	    0x39a0, 0x0b85, 0x26a8, 0x0000, 0x14d3, 0x36fd, 0x0000, 0x1509,
+	    0x46af, 0x18e7, 0x0000, 0x4b70, 0x3891, 0x4c8f, 0x0000, 0x0000,
+	    0x1564, 0x0000, 0x2353, 0x3f5d, 0x05ec, 0x13fe, 0x1192, 0x3c62,
+	    0x0000, 0x0cbc, 0x0000, 0x12f3, 0x36fe, 0x0000, 0x0ea5, 0x2c2c,
+	    0x0000, 0x2b05, 0x0000, 0x2216, 0x1073, 0x3542, 0x0000, 0x4757,
+	    0x0000, 0x0000, 0x0000, 0x38aa, 0x0000, 0x0000, 0x0000, 0x2eef,
+	    0x34db, 0x3dbe, 0x3771, 0x0000, 0x0000, 0x2124, 0x0000, 0x42cf,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x486e, 0x0000, 0x2597,
+	    0x0000, 0x45b5, 0x2a6e, 0x443e, 0x0000, 0x1345, 0x0000, 0x269d,
+	    0x2020, 0x3b41, 0x0000, 0x2df6, 0x1ed5, 0x4b2b, 0x0000, 0x2fd3,
+	    0x0285, 0x0000, 0x2777, 0x1cea, 0x43b7, 0x0bee, 0x3014, 0x0000,
+	    0x4dce, 0x0000, 0x0b5d, 0x1a12, 0x0000, 0x0000, 0x19f0, 0x4754,
+	    0x253f, 0x137b, 0x0000, 0x0000, 0x4a5d, 0x0000, 0x27ec, 0x3cdb,
+	    0x0000, 0x0000, 0x0000, 0x4238, 0x0000, 0x335c, 0x16b2, 0x0000,
+	    0x2a95, 0x3069, 0x0000, 0x4a32, 0x4bcf, 0x0000, 0x2b11, 0x0000,
+	    0x1ad3, 0x0000, 0x0000, 0x1d01, 0x41a1, 0x1f18, 0x2d16, 0x31a9,
+	    0x00c0, 0x0000, 0x1978, 0x0a08, 0x2111, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1cd6, 0x0000, 0x0000, 0x44eb, 0x3fec, 0x460b,
+	    0x3312, 0x0000, 0x0000, 0x0000, 0x2154, 0x0000, 0x043b, 0x42a7,
+	    0x4124, 0x482c, 0x0a55, 0x0000, 0x464a, 0x11c6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x403f, 0x0000, 0x3014, 0x28c7,
+	    0x08b3, 0x31bb, 0x0000, 0x1882, 0x0000, 0x1817, 0x0000, 0x488e,
+	    0x0000, 0x3f0a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0664,
+	    0x3903, 0x3ddb, 0x2bb1, 0x008f, 0x2758, 0x28f1, 0x4059, 0x0000,
+	    0x0000, 0x37b9, 0x35cd, 0x0000, 0x0000, 0x0fda, 0x1a47, 0x07e1,
+	    0x0000, 0x0000, 0x061c, 0x0000, 0x0000, 0x400b, 0x0000, 0x0000,
+	    0x2c32, 0x397b, 0x2c6c, 0x3579, 0x46cf, 0x03ac, 0x0000, 0x17d5,
+	    0x0000, 0x3eef, 0x0000, 0x33b8, 0x0000, 0x33eb, 0x0000, 0x0000,
+	    0x0000, 0x2173, 0x4ae3, 0x3b78, 0x0000, 0x02cf, 0x0e30, 0x3f5c,
+	    0x47a5, 0x0000, 0x3272, 0x0000, 0x42c3, 0x010d, 0x3d4e, 0x29a3,
+	    0x1eca, 0x0000, 0x0000, 0x0000, 0x18ce, 0x0000, 0x37dc, 0x4685,
+	    0x4549, 0x0000, 0x3f68, 0x040b, 0x121c, 0x0000, 0x2835, 0x0cda,
+	    0x0000, 0x010f, 0x3182, 0x0d53, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x365d, 0x0d4a, 0x4b97, 0x1468, 0x3459, 0x0000,
+	    0x150a, 0x289e, 0x40b7, 0x11c1, 0x1302, 0x1ea8, 0x0000, 0x1dae,
+	    0x033c, 0x0000, 0x0000, 0x0000, 0x0000, 0x1714, 0x0000, 0x0000,
+	    0x03f8, 0x0c7b, 0x0000, 0x0000, 0x0000, 0x0000, 0x3111, 0x10fe,
+	    0x1934, 0x1c0a, 0x1b4c, 0x0000, 0x4228, 0x1948, 0x0000, 0x1103,
+	    0x0000, 0x1dd6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1e50, 0x411d, 0x2448, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bd3,
+	    0x1d58, 0x0000, 0x27e5, 0x12d0, 0x0000, 0x0000, 0x48d3, 0x28ad,
+	    0x41d9, 0x0000, 0x0000, 0x28f5, 0x11a5, 0x0d63, 0x2695, 0x32f8,
+	    0x0000, 0x047d, 0x0000, 0x345a, 0x0000, 0x083d, 0x401d, 0x20aa,
+	    0x1728, 0x0000, 0x0c45, 0x134c, 0x1a86, 0x0000, 0x31ab, 0x1614,
+	    0x17b4, 0x1a39, 0x0149, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1afe, 0x0000, 0x1be7, 0x3d35, 0x39ab, 0x0000, 0x2596,
+	    0x0000, 0x3682, 0x0262, 0x2e0a, 0x0de0, 0x0000, 0x3870, 0x1949,
+	    0x0792, 0x3255, 0x3f74, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c02,
+	    0x0000, 0x0000, 0x0caf, 0x0000, 0x37d0, 0x0fc9, 0x0000, 0x2f73,
+	    0x1d43, 0x1fff, 0x1371, 0x0000, 0x0000, 0x0000, 0x4a7d, 0x0000,
+	    0x0000, 0x394e, 0x23f0, 0x0dd8, 0x4185, 0x030a, 0x0000, 0x1b15,
+	    0x11d7, 0x252d, 0x1781, 0x0000, 0x0000, 0x0000, 0x3f17, 0x2964,
+	    0x0000, 0x1186, 0x0000, 0x46f9, 0x4155, 0x0000, 0x0000, 0x1613,
+	    0x1bd6, 0x0000, 0x0000, 0x3e25, 0x47db, 0x42ae, 0x42d3, 0x0000,
+	    0x0000, 0x1d55, 0x0000, 0x0000, 0x230e, 0x337f, 0x0000, 0x2a07,
+	    0x0000, 0x0a9d, 0x0000, 0x0000, 0x17db, 0x184e, 0x4da8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1590, 0x0000, 0x0000, 0x0000, 0x1382,
+	    0x0000, 0x0000, 0x4797, 0x0000, 0x4312, 0x0000, 0x30ca, 0x0000,
+	    0x494b, 0x4550, 0x44c0, 0x0e21, 0x0b2f, 0x1196, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x283e, 0x1ebc, 0x2ea9, 0x0000, 0x04ef, 0x0000,
+	    0x2fa5, 0x0bf9, 0x0e4e, 0x0000, 0x354b, 0x1012, 0x191d, 0x2b19,
+	    0x0000, 0x0000, 0x49b0, 0x0000, 0x3e4c, 0x4752, 0x0000, 0x0000,
+	    0x0b51, 0x0000, 0x0000, 0x2746, 0x0000, 0x47d6, 0x0000, 0x1f56,
+	    0x0000, 0x0000, 0x0000, 0x4cb9, 0x2a8f, 0x23b2, 0x0000, 0x065d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4105, 0x458c, 0x115f, 0x0000,
+	    0x2176, 0x0766, 0x0000, 0x0000, 0x0000, 0x3cb7, 0x0000, 0x0d28,
+	    0x47eb, 0x27f0, 0x0000, 0x0000, 0x2111, 0x0000, 0x1b4e, 0x0000,
+	    0x0000, 0x0000, 0x31ff, 0x0000, 0x4473, 0x486c, 0x0000, 0x198d,
+	    0x4144, 0x4092, 0x42b4, 0x0000, 0x21c1, 0x0000, 0x0000, 0x3780,
+	    0x1aaf, 0x0000, 0x1a52, 0x0000, 0x0000, 0x0000, 0x0000, 0x103b,
+	    0x0000, 0x4666, 0x1525, 0x09a2, 0x0000, 0x292e, 0x0882, 0x3c0f,
+	    0x0000, 0x412b, 0x3f04, 0x4bf2, 0x0000, 0x3380, 0x0000, 0x035c,
+	    0x0000, 0x0819, 0x095f, 0x453d, 0x0000, 0x3827, 0x3c8a, 0x0000,
+	    0x3637, 0x41a1, 0x0000, 0x3fa0, 0x020d, 0x48b2, 0x0000, 0x33cb,
+	    0x0000, 0x0aa7, 0x2dc0, 0x13de, 0x03e2, 0x25a1, 0x0b57, 0x0000,
+	    0x0000, 0x437e, 0x257e, 0x0000, 0x037c, 0x2c3c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2f19, 0x02cf, 0x0000, 0x15ab, 0x0262,
+	    0x4a4a, 0x08c8, 0x26eb, 0x0000, 0x0000, 0x195e, 0x0000, 0x06ce,
+	    0x1331, 0x0000, 0x0000, 0x3ec1, 0x0000, 0x0000, 0x26d2, 0x0000,
+	    0x0d2e, 0x0000, 0x0000, 0x26e7, 0x1dd1, 0x0000, 0x1fac, 0x28d1,
+	    0x154f, 0x0000, 0x0000, 0x3bb2, 0x0000, 0x264d, 0x402a, 0x05a7,
+	    0x0000, 0x0000, 0x17cc, 0x0000, 0x0000, 0x1d16, 0x0000, 0x0000,
+	    0x0ee2, 0x2367, 0x0000, 0x23d5, 0x49e8, 0x2f5c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2780, 0x1cc7, 0x0000, 0x0000, 0x2ecb,
+	    0x0000, 0x372e, 0x0ba8, 0x0000, 0x0000, 0x0000, 0x0000, 0x36bb,
+	    0x3c1f, 0x296d, 0x4b8b, 0x40ca, 0x4002, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2621, 0x0000, 0x1467, 0x02c5, 0x0000, 0x038b, 0x0000,
+	    0x0000, 0x0ff7, 0x25e6, 0x3e1d, 0x26fb, 0x0000, 0x0000, 0x0000,
+	    0x0382, 0x0000, 0x0000, 0x0000, 0x30c6, 0x0000, 0x13f6, 0x244a,
+	    0x0999, 0x2955, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2371,
+	    0x0000, 0x3981, 0x25f5, 0x4061, 0x062c, 0x0ef9, 0x3ea0, 0x0000,
+	    0x0000, 0x08ea, 0x0000, 0x4dfb, 0x30a8, 0x0000, 0x0000, 0x44dd,
+	    0x3886, 0x38cd, 0x0085, 0x0000, 0x0000, 0x2c44, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04b8, 0x0000, 0x0000, 0x28d3, 0x057b, 0x0d66,
+	    0x0000, 0x0000, 0x2d70, 0x4047, 0x1dec, 0x0df6, 0x4b62, 0x0000,
+	    0x06d8, 0x1816, 0x0000, 0x0000, 0x4a28, 0x0742, 0x1800, 0x28d6,
+	    0x0000, 0x077a, 0x0000, 0x305c, 0x236f, 0x0000, 0x0000, 0x4450,
+	    0x35db, 0x2637, 0x0000, 0x1910, 0x0000, 0x0cce, 0x0000, 0x3a08,
+	    0x0710, 0x16f1, 0x39e9, 0x092f, 0x381f, 0x0000, 0x0d52, 0x41d5,
+	    0x0983, 0x2df9, 0x0000, 0x1ea7, 0x0000, 0x4166, 0x0000, 0x4832,
+	    0x1711, 0x279e, 0x4672, 0x49fc, 0x0000, 0x0000, 0x48ca, 0x2d35,
+	    0x0000, 0x2c9c, 0x347e, 0x0000, 0x0000, 0x01d9, 0x2e20, 0x1afb,
+	    0x4828, 0x0000, 0x0000, 0x2e46, 0x0000, 0x25eb, 0x422d, 0x0b54,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1216, 0x093e, 0x0000,
+	    0x0000, 0x4889, 0x216c, 0x299b, 0x2d0c, 0x0000, 0x0000, 0x0000,
+	    0x467c, 0x0000, 0x0000, 0x26be, 0x0000, 0x0000, 0x2ca6, 0x1dad,
+	    0x4077, 0x24d0, 0x40a0, 0x0000, 0x0000, 0x371a, 0x4231, 0x0182,
+	    0x29e5, 0x0000, 0x064b, 0x0000, 0x0000, 0x0000, 0x0000, 0x3320,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f13, 0x0000, 0x2161,
+	    0x0aa8, 0x49e3, 0x4bc6, 0x278d, 0x0000, 0x41d4, 0x0000, 0x1021,
+	    0x0000, 0x1bdb, 0x0e5b, 0x0000, 0x0000, 0x2e63, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x36e9, 0x0e91, 0x0000, 0x0000, 0x4292, 0x0000,
+	    0x19e6, 0x36c9, 0x0000, 0x0000, 0x213b, 0x4d5a, 0x0000, 0x0000,
+	    0x0000, 0x0e55, 0x408a, 0x3aa0, 0x0000, 0x1ae8, 0x0000, 0x23be,
+	    0x37ba, 0x0000, 0x0e50, 0x3d58, 0x0000, 0x048c, 0x3750, 0x0666,
+	    0x3587, 0x0000, 0x0000, 0x34d6, 0x0000, 0x3c2b, 0x0000, 0x0000,
+	    0x119c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0add, 0x0e04,
+	    0x3a1b, 0x0000, 0x4cb3, 0x0000, 0x0000, 0x2326, 0x3b47, 0x0000,
+	    0x0000, 0x294e, 0x0000, 0x238c, 0x0000, 0x0000, 0x38c1, 0x0000,
+	    0x3b66, 0x0000, 0x2b99, 0x0000, 0x0000, 0x0c0c, 0x0000, 0x0000,
+	    0x2fdf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4ce6, 0x0000, 0x0000, 0x0adb, 0x0000, 0x0be0, 0x2525, 0x0000,
+	    0x332a, 0x12ca, 0x0000, 0x35c9, 0x2156, 0x0000, 0x0000, 0x495c,
+	    0x4375, 0x28be, 0x4d12, 0x2034, 0x07a3, 0x0000, 0x4386, 0x0000,
+	    0x051a, 0x0000, 0x08e2, 0x0000, 0x0000, 0x060f, 0x46ec, 0x01e1,
+	    0x473c, 0x40ff, 0x4301, 0x0000, 0x0000, 0x0000, 0x0000, 0x387a,
+	    0x07a4, 0x1734, 0x48b8, 0x483f, 0x0000, 0x34ec, 0x32d1, 0x3177,
+	    0x0000, 0x0000, 0x0589, 0x0000, 0x17ea, 0x4aa3, 0x0000, 0x4065,
+	    0x04ab, 0x0839, 0x0000, 0x225f, 0x0000, 0x0000, 0x13a2, 0x438e,
+	    0x0000, 0x0000, 0x0000, 0x20b2, 0x07c6, 0x2509, 0x45c8, 0x0000,
+	    0x0000, 0x22ef, 0x0000, 0x3ef4, 0x131c, 0x0000, 0x2972, 0x0000,
+	    0x4839, 0x3547, 0x4b57, 0x4dfc, 0x379a, 0x0000, 0x0000, 0x1807,
+	    0x13ae, 0x0000, 0x295e, 0x232f, 0x0d6b, 0x034a, 0x3ac5, 0x0000,
+	    0x0000, 0x4237, 0x0000, 0x0000, 0x3f65, 0x059a, 0x0590, 0x07c2,
+	    0x0d79, 0x13e4, 0x0000, 0x4694, 0x20d6, 0x4b78, 0x3cf4, 0x0f92,
+	    0x0000, 0x413e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02e1,
+	    0x2ce6, 0x03ed, 0x0000, 0x0843, 0x32a1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x34fa, 0x0403, 0x0000, 0x0e0b, 0x4223, 0x1a58, 0x0000,
+	    0x0c3c, 0x0000, 0x1c8e, 0x0000, 0x462c, 0x29aa, 0x0b78, 0x0000,
+	    0x1e36, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801,
+	    0x0000, 0x0483, 0x3fb6, 0x231c, 0x0000, 0x085d, 0x0000, 0x3239,
+	    0x2900, 0x3248, 0x0000, 0x376d, 0x2d44, 0x0fed, 0x3bcf, 0x359e,
+	    0x0ab6, 0x2523, 0x48cc, 0x0c2a, 0x2b6c, 0x012a, 0x096d, 0x38f2,
+	    0x00e7, 0x0000, 0x44c3, 0x0000, 0x0000, 0x3f07, 0x3688, 0x0285,
+	    0x2f06, 0x2a47, 0x1763, 0x0bc8, 0x4954, 0x0000, 0x0000, 0x0000,
+	    0x484f, 0x1862, 0x06a7, 0x0000, 0x33ae, 0x3454, 0x10ec, 0x0000,
+	    0x2cab, 0x0000, 0x40ad, 0x0000, 0x3104, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x126f, 0x2983, 0x0000, 0x3803, 0x0000, 0x302f,
+	    0x0000, 0x15fe, 0x02b0, 0x4541, 0x0000, 0x0000, 0x0000, 0x0767,
+	    0x399a, 0x32ed, 0x0000, 0x13ad, 0x0000, 0x09eb, 0x14b2, 0x37dd,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1035, 0x068c, 0x0f3c, 0x2bd8,
+	    0x1fdc, 0x0000, 0x2e6e, 0x0000, 0x29dc, 0x182c, 0x3253, 0x42e6,
+	    0x0000, 0x2040, 0x0000, 0x113e, 0x0000, 0x33c0, 0x2ed0, 0x0000,
+	    0x0392, 0x0000, 0x3a20, 0x0000, 0x0000, 0x3127, 0x0000, 0x0000,
+	    0x0807, 0x0000, 0x0000, 0x3727, 0x0000, 0x0000, 0x0000, 0x009b,
+	    0x1889, 0x0193, 0x0000, 0x0000, 0x0000, 0x2507, 0x247d, 0x2580,
+	    0x45f6, 0x01c2, 0x0000, 0x0000, 0x1913, 0x0000, 0x37e9, 0x0e44,
+	    0x0000, 0x2ecb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3644,
+	    0x0000, 0x46c4, 0x3c50, 0x1f9c, 0x4aff, 0x0ddd, 0x1397, 0x1730,
+	    0x0000, 0x07e7, 0x05c3, 0x0000, 0x0000, 0x30c7, 0x3bfd, 0x3ba9,
+	    0x0000, 0x1b5c, 0x4570, 0x1395, 0x0000, 0x0000, 0x0000, 0x41ff,
+	    0x0000, 0x1bef, 0x4c7b, 0x0000, 0x0000, 0x0000, 0x3cd3, 0x3236,
+	    0x228f, 0x0000, 0x01dc, 0x30ce, 0x0000, 0x4619, 0x423a, 0x2912,
+	    0x44a3, 0x3810, 0x0000, 0x0000, 0x1fad, 0x2e6b, 0x0000, 0x0000,
+	    0x0c05, 0x3264, 0x1fda, 0x0000, 0x0000, 0x0000, 0x0000, 0x09bd,
+	    0x3c0c, 0x0000, 0x0000, 0x0000, 0x364f, 0x4864, 0x0e50, 0x0000,
+	    0x0000, 0x0000, 0x4c27, 0x0000, 0x0577, 0x37b3, 0x0000, 0x0000,
+	    0x0000, 0x1a4e, 0x37df, 0x1767, 0x2f74, 0x434e, 0x0000, 0x0000,
+	    0x3100, 0x0000, 0x178b, 0x36aa, 0x0000, 0x0000, 0x43e1, 0x00f9,
+	    0x0000, 0x2d67, 0x0000, 0x0000, 0x0000, 0x0000, 0x0cd8, 0x0000,
+	    0x04cb, 0x0000, 0x0000, 0x23a0, 0x148d, 0x3863, 0x0000, 0x10b0,
+	    0x2532, 0x34b0, 0x2428, 0x0000, 0x1625, 0x0000, 0x0000, 0x0000,
+	    0x070f, 0x35f3, 0x4b2a, 0x0000, 0x1d66, 0x0000, 0x0000, 0x2da7,
+	    0x3774, 0x0000, 0x0000, 0x321d, 0x3c54, 0x0f2d, 0x0000, 0x10fb,
+	    0x0000, 0x0000, 0x13a7, 0x0000, 0x47fe, 0x0849, 0x1faf, 0x007e,
+	    0x0000, 0x0163, 0x1eab, 0x1e9a, 0x40fe, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0812, 0x094f, 0x0000, 0x1e6e, 0x1508, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0b24, 0x19e3, 0x1e51, 0x0000,
+	    0x0000, 0x0000, 0x1864, 0x0000, 0x0000, 0x0ac1, 0x4373, 0x251d,
+	    0x0000, 0x2918, 0x1765, 0x0cf9, 0x3bb5, 0x308a, 0x1cfa, 0x32c7,
+	    0x398b, 0x0000, 0x0a40, 0x31f5, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0542, 0x0000, 0x0000, 0x0000, 0x0000, 0x2817,
+	    0x2126, 0x3719, 0x0242, 0x4538, 0x3479, 0x0000, 0x0000, 0x0fca,
+	    0x4abe, 0x4b53, 0x01d5, 0x0000, 0x49a2, 0x1730, 0x219d, 0x0000,
+	    0x0000, 0x36d6, 0x2b5c, 0x2e5a, 0x0000, 0x0000, 0x123d, 0x0000,
+	    0x0000, 0x0000, 0x42fc, 0x0000, 0x22aa, 0x1116, 0x0000, 0x0000,
+	    0x3af0, 0x0000, 0x3f75, 0x1ddd, 0x41a5, 0x005d, 0x2781, 0x2e78,
+	    0x490c, 0x1c7a, 0x13b2, 0x280d, 0x0000, 0x1637, 0x2234, 0x02f3,
+	    0x457e, 0x05ad, 0x2f43, 0x1ee4, 0x280b, 0x1257, 0x16d1, 0x4265,
+	    0x0000, 0x2405, 0x04d7, 0x0000, 0x0000, 0x0000, 0x0785, 0x20c2,
+	    0x0000, 0x3fee, 0x0000, 0x0000, 0x0000, 0x146c, 0x0000, 0x10d8,
+	    0x0000, 0x4702, 0x30fa, 0x0000, 0x241e, 0x1e90, 0x3bf4, 0x0000,
+	    0x3738, 0x0000, 0x1016, 0x3e6f, 0x0000, 0x0000, 0x3f64, 0x0000,
+	    0x2e94, 0x0000, 0x0000, 0x0000, 0x0000, 0x08a8, 0x28d8, 0x0000,
+	    0x0000, 0x39a7, 0x0246, 0x0000, 0x2bcd, 0x259b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x29c5, 0x0000, 0x049a, 0x0000, 0x4d51, 0x0000,
+	    0x0444, 0x0a3d, 0x39b7, 0x0000, 0x0000, 0x05f2, 0x3717, 0x4320,
+	    0x3f7b, 0x3a6e, 0x0000, 0x0000, 0x49ff, 0x0000, 0x0000, 0x0206,
+	    0x0000, 0x0000, 0x0000, 0x2e90, 0x4d27, 0x3e4c, 0x0000, 0x0000,
+	    0x23ad, 0x1efb, 0x0cf0, 0x1488, 0x11fa, 0x0000, 0x0000, 0x499b,
+	    0x332e, 0x4904, 0x45de, 0x4407, 0x1998, 0x0000, 0x0000, 0x04ea,
+	    0x2ad2, 0x0000, 0x3ed8, 0x0000, 0x4dc9, 0x1131, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x14bc, 0x0000, 0x0179, 0x0000, 0x0000, 0x1db5,
+	    0x4d1e, 0x0000, 0x3146, 0x2de6, 0x1757, 0x27e4, 0x0ba0, 0x3036,
+	    0x3920, 0x13a3, 0x028e, 0x448a, 0x14d0, 0x0000, 0x4d34, 0x349a,
+	    0x0000, 0x2146, 0x1572, 0x0000, 0x096f, 0x4afd, 0x30b4, 0x0cea,
+	    0x0c4d, 0x4547, 0x0000, 0x0bde, 0x3bfc, 0x0000, 0x3704, 0x0000,
+	    0x4ad0, 0x0bdd, 0x0ac3, 0x0000, 0x4621, 0x2b5e, 0x4173, 0x0c3b,
+	    0x08c1, 0x0000, 0x14a6, 0x1b62, 0x14e9, 0x4d60, 0x3fbe, 0x35fe,
+	    0x0000, 0x0000, 0x0000, 0x1fef, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x014f, 0x1791, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bd6,
+	    0x4ab6, 0x0675, 0x0000, 0x0000, 0x104a, 0x0e08, 0x39fd, 0x1416,
+	    0x0000, 0x2c9b, 0x2fdd, 0x48fa, 0x248e, 0x0000, 0x1f6d, 0x38ce,
+	    0x46bd, 0x1007, 0x3c9e, 0x0000, 0x0000, 0x23e3, 0x0000, 0x33dd,
+	    0x4187, 0x3777, 0x1557, 0x331d, 0x0000, 0x0000, 0x0000, 0x1ac5,
+	    0x4185, 0x0000, 0x0000, 0x0000, 0x1a67, 0x0000, 0x0000, 0x3bfd,
+	    0x0000, 0x1b1c, 0x1a83, 0x2dee, 0x0000, 0x0000, 0x2950, 0x0000,
+	    0x2194, 0x43fd, 0x0000, 0x0000, 0x4cea, 0x160a, 0x0000, 0x0000,
+	    0x1653, 0x3bdb, 0x4759, 0x49e4, 0x0000, 0x3783, 0x0000, 0x0000,
+	    0x0000, 0x4462, 0x0000, 0x149d, 0x0000, 0x0000, 0x0000, 0x1d15,
+	    0x0000, 0x2c1d, 0x0000, 0x0000, 0x2c10, 0x165f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x38d7, 0x0000, 0x2533, 0x1403, 0x1afe,
+	    0x3bbe, 0x3326, 0x3ae4, 0x205b, 0x0000, 0x0730, 0x0e7b, 0x0000,
+	    0x2e72, 0x0000, 0x0000, 0x3837, 0x19b1, 0x31aa, 0x211d, 0x0692,
+	    0x3f3d, 0x0000, 0x3c76, 0x0000, 0x30f8, 0x0000, 0x0000, 0x2fef,
+	    0x0000, 0x0000, 0x0000, 0x1625, 0x2d04, 0x2ad9, 0x0000, 0x3f9e,
+	    0x0000, 0x31fe, 0x0000, 0x34c2, 0x0000, 0x3da2, 0x4330, 0x0a6c,
+	    0x0510, 0x0000, 0x0000, 0x428a, 0x44cd, 0x0000, 0x35b8, 0x2d9c,
+	    0x006c, 0x496d, 0x0000, 0x30b4, 0x0000, 0x0000, 0x4d5d, 0x2326,
+	    0x12bf, 0x0000, 0x30e4, 0x1bae, 0x16d6, 0x28db, 0x0000, 0x2ac7,
+	    0x082f, 0x3575, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b0e,
+	    0x49dc, 0x0000, 0x04e6, 0x0b45, 0x398a, 0x4067, 0x4110, 0x4153,
+	    0x13a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09b3, 0x33b4,
+	    0x0000, 0x0121, 0x0000, 0x0000, 0x22e3, 0x014e, 0x4419, 0x1be4,
+	    0x46aa, 0x0000, 0x17b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4b9d, 0x3813, 0x2f32, 0x0000, 0x1c10, 0x2df0, 0x3e5c, 0x2a34,
+	    0x2b34, 0x0000, 0x098d, 0x0000, 0x1616, 0x0000, 0x118d, 0x4908,
+	    0x2bd1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a3e, 0x47db,
+	    0x0ae3, 0x0000, 0x3b07, 0x0000, 0x0000, 0x41bd, 0x45c9, 0x3d6d,
+	    0x14c5, 0x2e0a, 0x0000, 0x0000, 0x0000, 0x1fdc, 0x30fe, 0x0000,
+	    0x0000, 0x4853, 0x31c5, 0x0000, 0x1ffe, 0x1283, 0x0000, 0x0000,
+	    0x0bcf, 0x1fb0, 0x0000, 0x19dc, 0x1746, 0x0000, 0x2df8, 0x0000,
+	    0x0000, 0x1d24, 0x3c75, 0x0000, 0x2dda, 0x0000, 0x30b0, 0x0000,
+	    0x0000, 0x17f8, 0x148e, 0x0000, 0x0e95, 0x433d, 0x0000, 0x1900,
+	    0x3e7d, 0x36f3, 0x0000, 0x1391, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4b8b, 0x2373, 0x026a, 0x02ec,
+	    0x2231, 0x0000, 0x488c, 0x0000, 0x4314, 0x0000, 0x0000, 0x0000,
+	    0x4030, 0x14d7, 0x35f9, 0x2be0, 0x4d24, 0x3876, 0x25e9, 0x0000,
+	    0x19e2, 0x343d, 0x0000, 0x320a, 0x0000, 0x0000, 0x266d, 0x0387,
+	    0x4c83, 0x2ebd, 0x0000, 0x3aba, 0x13ab, 0x0000, 0x2c00, 0x0000,
+	    0x0000, 0x0000, 0x2fcd, 0x27ab, 0x0000, 0x431a, 0x0000, 0x1975,
+	    0x3020, 0x0104, 0x4c28, 0x36a3, 0x2af3, 0x335a, 0x0b76, 0x26ea,
+	    0x4830, 0x173b, 0x0000, 0x0000, 0x2db6, 0x0000, 0x0000, 0x0f50,
+	    0x1acc, 0x2fc5, 0x0000, 0x0000, 0x0000, 0x33e6, 0x4143, 0x1271,
+	    0x0000, 0x2dc1, 0x4380, 0x0c90, 0x0000, 0x3f2c, 0x4863, 0x1156,
+	    0x0000, 0x0000, 0x45d9, 0x16f6, 0x2aa6, 0x34c5, 0x0000, 0x3afa,
+	    0x1121, 0x33a2, 0x2ab6, 0x2048, 0x0000, 0x364c, 0x0000, 0x0000,
+	    0x0000, 0x1c2c, 0x1e26, 0x0000, 0x0000, 0x0000, 0x2b64, 0x29c3,
+	    0x0000, 0x3c5c, 0x0000, 0x0000, 0x1e4e, 0x2f51, 0x0000, 0x0410,
+	    0x18b2, 0x47fb, 0x20a4, 0x22d4, 0x0000, 0x2eac, 0x325f, 0x0000,
+	    0x24cf, 0x3ac5, 0x32fd, 0x0000, 0x466a, 0x35be, 0x0000, 0x0000,
+	    0x0cd0, 0x1519, 0x0000, 0x1dd5, 0x0000, 0x44a3, 0x1282, 0x1e59,
+	    0x0000, 0x0000, 0x0007, 0x3480, 0x0000, 0x0000, 0x0000, 0x287d,
+	    0x1e94, 0x0000, 0x0000, 0x0000, 0x38a9, 0x0000, 0x0065, 0x31c9,
+	    0x0000, 0x128f, 0x4789, 0x4d50, 0x0000, 0x3a59, 0x0000, 0x0000,
+	    0x2443, 0x0000, 0x2e31, 0x1bc2, 0x23d4, 0x0000, 0x0000, 0x0000,
+	    0x3abe, 0x05fe, 0x17ca, 0x0000, 0x0000, 0x0000, 0x2912, 0x2295,
+	    0x457b, 0x0000, 0x0000, 0x363c, 0x19c5, 0x0e46, 0x0000, 0x049a,
+	    0x1374, 0x1ba1, 0x0000, 0x0000, 0x25bd, 0x26eb, 0x06bf, 0x0000,
+	    0x18f4, 0x46a4, 0x0000, 0x0000, 0x0000, 0x48d9, 0x33c0, 0x0fac,
+	    0x3c14, 0x128a, 0x4e1d, 0x0000, 0x1e35, 0x0000, 0x0b2a, 0x4137,
+	    0x0000, 0x0000, 0x0000, 0x1bfe, 0x1ce3, 0x2b78, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x127d, 0x0000, 0x1ed8, 0x3c84, 0x0000, 0x0000,
+	    0x0000, 0x1899, 0x0ef4, 0x3e1f, 0x32bb, 0x02ec, 0x44b7, 0x15eb,
+	    0x4d2f, 0x4b24, 0x0000, 0x0940, 0x0c33, 0x3661, 0x0000, 0x0000,
+	    0x17b0, 0x302c, 0x38e0, 0x0000, 0x4b1c, 0x343a, 0x490a, 0x001a,
+	    0x0000, 0x0000, 0x0000, 0x1b23, 0x1fb4, 0x0127, 0x0855, 0x0000,
+	    0x21fb, 0x0000, 0x2068, 0x4360, 0x0000, 0x22c8, 0x0000, 0x32b4,
+	    0x0000, 0x004b, 0x33fa, 0x1c3b, 0x0000, 0x0000, 0x2450, 0x1463,
+	    0x1e51, 0x12b1, 0x3c7b, 0x0916, 0x0000, 0x0000, 0x24cc, 0x4155,
+	    0x0000, 0x3cf2, 0x0000, 0x12b1, 0x0000, 0x0000, 0x2d7a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1327, 0x0000, 0x4cb5, 0x0fc6, 0x16bb,
+	    0x0000, 0x0ea8, 0x48ae, 0x1ed7, 0x04c2, 0x393a, 0x0000, 0x0000,
+	    0x0000, 0x1259, 0x26e5, 0x0000, 0x1346, 0x4a4f, 0x25cf, 0x2131,
+	    0x083a, 0x2f3c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3b85, 0x0000, 0x3617, 0x0000, 0x0000, 0x314b, 0x46a5, 0x35ec,
+	    0x07d8, 0x0000, 0x4d71, 0x0c7e, 0x307a, 0x0000, 0x0000, 0x1a58,
+	    0x0000, 0x0000, 0x4910, 0x084e, 0x1933, 0x38a1, 0x0566, 0x34f6,
+	    0x0000, 0x0000, 0x1cce, 0x03ff, 0x01ce, 0x0000, 0x01e5, 0x0000,
+	    0x2f8f, 0x0000, 0x4e1a, 0x34bb, 0x0000, 0x0000, 0x2ede, 0x0740,
+	    0x0000, 0x0000, 0x0000, 0x3bcf, 0x08ee, 0x0000, 0x0000, 0x2571,
+	    0x1584, 0x0000, 0x424f, 0x0dc9, 0x1f94, 0x0000, 0x11ec, 0x0000,
+	    0x43c7, 0x0000, 0x4bb5, 0x3305, 0x2f82, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x18c7, 0x3321, 0x100d, 0x0000, 0x3f1b, 0x0000, 0x2dcc,
+	    0x454e, 0x0000, 0x1eff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3056, 0x2cf3, 0x0000, 0x0000, 0x0000, 0x3bb2,
+	    0x35e9, 0x0000, 0x1df7, 0x0000, 0x3afb, 0x0000, 0x3d23, 0x15fe,
+	    0x0000, 0x0000, 0x0000, 0x4790, 0x0000, 0x0000, 0x2556, 0x333c,
+	    0x27ad, 0x0696, 0x0000, 0x0000, 0x0000, 0x1217, 0x0000, 0x0000,
+	    0x0000, 0x362b, 0x0ace, 0x0000, 0x4938, 0x3a50, 0x0000, 0x0000,
+	    0x0000, 0x01cc, 0x0000, 0x102c, 0x2b6d, 0x3588, 0x15a7, 0x2d14,
+	    0x0000, 0x36f7, 0x0000, 0x0000, 0x184b, 0x08f0, 0x1ac1, 0x0a48,
+	    0x3659, 0x0000, 0x01b4, 0x0000, 0x0000, 0x37e3, 0x4af4, 0x2970,
+	    0x0491, 0x0000, 0x0000, 0x289c, 0x0000, 0x0000, 0x0000, 0x21fc,
+	    0x0000, 0x273b, 0x0000, 0x2867, 0x0ccc, 0x36eb, 0x0000, 0x0000,
+	    0x3051, 0x11aa, 0x3ac6, 0x3832, 0x0000, 0x01a3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x108c, 0x4c9a, 0x1a00, 0x0b4d, 0x3b9f, 0x3c57,
+	    0x0000, 0x0000, 0x3125, 0x3453, 0x3f2c, 0x0000, 0x4d4b, 0x17a7,
+	    0x0000, 0x06b4, 0x3459, 0x3f16, 0x1c4e, 0x086a, 0x4340, 0x3ed7,
+	    0x2c7d, 0x3241, 0x0000, 0x0d89, 0x476a, 0x0000, 0x0000, 0x0000,
+	    0x31f4, 0x13b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x46d9, 0x0000,
+	    0x0000, 0x2bc2, 0x20c2, 0x23d5, 0x0000, 0x0000, 0x3f0b, 0x0000,
+	    0x0000, 0x470e, 0x2599, 0x0a72, 0x2e15, 0x44cf, 0x0000, 0x3773,
+	    0x0000, 0x019a, 0x0b50, 0x4bc4, 0x1206, 0x0000, 0x4da2, 0x0000,
+	    0x0b8e, 0x0000, 0x4992, 0x444c, 0x199f, 0x0000, 0x0000, 0x0000,
+	    0x1dfd, 0x2c73, 0x16f5, 0x0000, 0x4a06, 0x0000, 0x0000, 0x0000,
+	    0x2552, 0x0000, 0x0000, 0x0aad, 0x4635, 0x0000, 0x432f, 0x0000,
+	    0x1cf8, 0x4401, 0x0000, 0x0000, 0x4b90, 0x3294, 0x0000, 0x061c,
+	    0x10ec, 0x0000, 0x0000, 0x0000, 0x1ab2, 0x45fc, 0x35ae, 0x0a95,
+	    0x0000, 0x0c6d, 0x0000, 0x0000, 0x4263, 0x0000, 0x434b, 0x0000,
+	    0x0000, 0x3d85, 0x2633, 0x0000, 0x0000, 0x3175, 0x305f, 0x0000,
+	    0x42a7, 0x0000, 0x2a43, 0x401d, 0x0000, 0x0000, 0x304e, 0x06cb,
+	    0x2bea, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cfa, 0x3f05, 0x0000,
+	    0x060e, 0x20f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ffd, 0x3055,
+	    0x1ba0, 0x0000, 0x157d, 0x4705, 0x02a8, 0x0000, 0x0000, 0x35f2,
+	    0x2358, 0x245c, 0x0000, 0x0be5, 0x3965, 0x0000, 0x19b1, 0x0000,
+	    0x0000, 0x0000, 0x4558, 0x0000, 0x1998, 0x0000, 0x0aba, 0x0000,
+	    0x0000, 0x0000, 0x1cb4, 0x2b27, 0x1d61, 0x0000, 0x26b1, 0x0bfa,
+	    0x0447, 0x4d09, 0x0000, 0x3597, 0x0000, 0x4892, 0x0000, 0x423b,
+	    0x1ea8, 0x4184, 0x0000, 0x1947, 0x0000, 0x0000, 0x0000, 0x453a,
+	    0x0000, 0x3b5e, 0x0000, 0x156c, 0x386d, 0x0000, 0x4c06, 0x1cdb,
+	    0x3f11, 0x0d8d, 0x0000, 0x2430, 0x0000, 0x0000, 0x0000, 0x0322,
+	    0x0000, 0x09aa, 0x3d26, 0x0000, 0x318e, 0x0353, 0x2d74, 0x0312,
+	    0x4adb, 0x0b77, 0x2950, 0x0000, 0x484c, 0x3290, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1211, 0x0dfa, 0x0000, 0x1525, 0x2f79, 0x0405,
+	    0x0000, 0x1d96, 0x08f3, 0x0245, 0x0000, 0x0000, 0x0000, 0x3abf,
+	    0x0f0f, 0x47b9, 0x0000, 0x2d29, 0x0d68, 0x07fb, 0x0450, 0x3942,
+	    0x0000, 0x3b34, 0x0000, 0x0000, 0x136c, 0x31a1, 0x31d9, 0x0000,
+	    0x0d53, 0x08fb, 0x0000, 0x0000, 0x35b3, 0x342f, 0x2213, 0x0000,
+	    0x0000, 0x0df3, 0x0d44, 0x0000, 0x0000, 0x4236, 0x0000, 0x0c6e,
+	    0x0000, 0x0000, 0x2318, 0x0000, 0x2216, 0x0000, 0x0000, 0x4734,
+	    0x0000, 0x03f9, 0x1792, 0x4cb7, 0x0000, 0x0000, 0x3d4a, 0x0000,
+	    0x2bf8, 0x06e3, 0x0000, 0x282c, 0x2a5d, 0x0000, 0x3e0b, 0x08ef,
+	    0x34e8, 0x0000, 0x18da, 0x0000, 0x0000, 0x0000, 0x0000, 0x21d4,
+	    0x39bc, 0x10f0, 0x35a5, 0x0000, 0x0000, 0x1a01, 0x0000, 0x02f6,
+	    0x0000, 0x1b97, 0x42b8, 0x414e, 0x0000, 0x36c2, 0x3555, 0x0000,
+	    0x0000, 0x0000, 0x209c, 0x0000, 0x0000, 0x2e78, 0x331b, 0x4a25,
+	    0x0000, 0x1e66, 0x1a40, 0x2e41, 0x0000, 0x36f2, 0x241e, 0x3157,
+	    0x0000, 0x09ef, 0x4244, 0x45f0, 0x2179, 0x48a6, 0x0000, 0x2075,
+	    0x0e4a, 0x0b6d, 0x4443, 0x0000, 0x1c5f, 0x0000, 0x05dd, 0x0000,
+	    0x0000, 0x159b, 0x0000, 0x0000, 0x16ef, 0x4b9c, 0x41d5, 0x0499,
+	    0x0cf6, 0x2b00, 0x2f16, 0x106d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x06f0, 0x0000, 0x09a2, 0x35ca, 0x0000, 0x0000, 0x267e,
+	    0x4750, 0x0000, 0x44af, 0x1f55, 0x460b, 0x273c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x12ce, 0x3971, 0x0aca, 0x0000, 0x2776, 0x0000,
+	    0x0000, 0x45bc, 0x0a96, 0x02bd, 0x0000, 0x0000, 0x0b00, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31ae,
+	    0x0299, 0x2936, 0x43ad, 0x4738, 0x0000, 0x2a59, 0x1762, 0x1713,
+	    0x0000, 0x0000, 0x1759, 0x0000, 0x1490, 0x33d1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24bc, 0x0f6f, 0x0000, 0x4180, 0x146c,
+	    0x0a89, 0x46dc, 0x0000, 0x219e, 0x0000, 0x37b2, 0x4afd, 0x0000,
+	    0x0956, 0x0230, 0x0000, 0x0000, 0x355f, 0x0000, 0x0000, 0x0000,
+	    0x3d64, 0x0000, 0x3ec5, 0x2562, 0x0000, 0x0000, 0x3af7, 0x0000,
+	    0x3f86, 0x1a81, 0x1a44, 0x2a85, 0x07c9, 0x2a26, 0x3b1c, 0x0000,
+	    0x428f, 0x01cf, 0x1dc4, 0x14d5, 0x2897, 0x0c35, 0x3c1f, 0x2f1d,
+	    0x3da3, 0x0000, 0x0000, 0x44f1, 0x390b, 0x336f, 0x2a25, 0x2c10,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0466, 0x3c5a, 0x0000, 0x0000,
+	    0x0000, 0x4008, 0x0000, 0x0b20, 0x0000, 0x0000, 0x0000, 0x31f6,
+	    0x4a15, 0x0000, 0x4a50, 0x0806, 0x3bc5, 0x0000, 0x0000, 0x4412,
+	    0x074c, 0x4187, 0x06f8, 0x0000, 0x36b0, 0x3633, 0x1d16, 0x19a8,
+	    0x0000, 0x39e5, 0x0000, 0x1502, 0x375a, 0x1c56, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0238, 0x02e7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0e76, 0x2e6c, 0x3ea9, 0x0000, 0x0000, 0x20be, 0x02b9,
+	    0x2db2, 0x0000, 0x23b4, 0x0e14, 0x2fb4, 0x0000, 0x0000, 0x396c,
+	    0x1b63, 0x2a78, 0x1302, 0x4a93, 0x0000, 0x0662, 0x2a5c, 0x3f8b,
+	    0x32e7, 0x0000, 0x0000, 0x1d72, 0x0c58, 0x0000, 0x0000, 0x0000,
+	    0x486a, 0x0000, 0x0000, 0x0000, 0x045c, 0x3d54, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2c9b, 0x0000, 0x4860, 0x1b0a, 0x128c, 0x0000,
+	    0x18f2, 0x31aa, 0x23b2, 0x0000, 0x0000, 0x0b13, 0x1dc8, 0x1d71,
+	    0x0000, 0x0000, 0x318f, 0x0000, 0x3a85, 0x1429, 0x0000, 0x0000,
+	    0x241b, 0x0000, 0x0000, 0x2e09, 0x2976, 0x0000, 0x3a32, 0x30eb,
+	    0x0000, 0x0000, 0x0000, 0x403c, 0x1821, 0x0000, 0x29de, 0x460c,
+	    0x3080, 0x03cf, 0x0000, 0x17ad, 0x0000, 0x0000, 0x2610, 0x190b,
+	    0x243e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4582,
+	    0x0c6c, 0x4d4b, 0x0000, 0x1785, 0x3abb, 0x2886, 0x0000, 0x1f0d,
+	    0x0000, 0x19ad, 0x4482, 0x173a, 0x4256, 0x0000, 0x31d7, 0x26fb,
+	    0x0000, 0x3637, 0x3975, 0x0000, 0x0000, 0x08ee, 0x1dc3, 0x0000,
+	    0x1add, 0x0000, 0x0000, 0x4b90, 0x2dab, 0x0000, 0x3e44, 0x2c3c,
+	    0x0000, 0x3b25, 0x0d23, 0x0000, 0x0000, 0x3426, 0x0000, 0x104a,
+	    0x2906, 0x0000, 0x416e, 0x4254, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1fe7, 0x28e6, 0x1c19, 0x0000, 0x18f3, 0x089c, 0x0000, 0x064a,
+	    0x189e, 0x491d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x09cb, 0x2fc2, 0x3c5a, 0x48c3, 0x3068, 0x0000, 0x025e, 0x34d5,
+	    0x40df, 0x461e, 0x3d4b, 0x1961, 0x0000, 0x4e0b, 0x28ad, 0x3cb6,
+	    0x0000, 0x4b5e, 0x0000, 0x2d15, 0x1220, 0x3390, 0x0000, 0x0000,
+	    0x1daa, 0x0000, 0x0000, 0x45be, 0x0000, 0x0000, 0x0000, 0x0da5,
+	    0x0000, 0x4cc2, 0x4830, 0x41d1, 0x0000, 0x0000, 0x0000, 0x4452,
+	    0x1f62, 0x0000, 0x4c43, 0x1e57, 0x41fd, 0x0000, 0x0000, 0x0000,
+	    0x08ba, 0x2dab, 0x0000, 0x0000, 0x21d5, 0x0000, 0x0000, 0x0000,
+	    0x0fa8, 0x2509, 0x0000, 0x0000, 0x46c4, 0x0000, 0x0000, 0x07a0,
+	    0x0000, 0x4a23, 0x0000, 0x157f, 0x0000, 0x288f, 0x0000, 0x12e3,
+	    0x34d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d9f, 0x1d21, 0x0a59,
+	    0x1cd3, 0x0000, 0x12a2, 0x0000, 0x0000, 0x0000, 0x1abe, 0x0000,
+	    0x05cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x3975, 0x0000, 0x126b,
+	    0x0000, 0x0637, 0x17f0, 0x0000, 0x0000, 0x0a77, 0x0967, 0x4242,
+	    0x0000, 0x4d85, 0x4724, 0x0000, 0x0000, 0x0000, 0x084f, 0x175d,
+	    0x1220, 0x0000, 0x15eb, 0x2668, 0x4445, 0x4bc9, 0x4184, 0x1581,
+	    0x069e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x247f, 0x0ff7,
+	    0x0000, 0x4d9f, 0x0000, 0x0000, 0x3385, 0x11f0, 0x0000, 0x0bc9,
+	    0x0000, 0x16d8, 0x0000, 0x29ac, 0x0000, 0x3d4e, 0x0000, 0x1d3b,
+	    0x0000, 0x0000, 0x0000, 0x159f, 0x4460, 0x0000, 0x32fc, 0x0000,
+	    0x0000, 0x1c2f, 0x316f, 0x0000, 0x0000, 0x3301, 0x0000, 0x02f7,
+	    0x0a59, 0x0063, 0x12b8, 0x4d1d, 0x0000, 0x3c1f, 0x4d04, 0x0000,
+	    0x2d2d, 0x0000, 0x2e14, 0x0000, 0x21b2, 0x0000, 0x0000, 0x164e,
+	    0x0000, 0x0000, 0x3469, 0x14d8, 0x47af, 0x0000, 0x0079, 0x0567,
+	    0x0000, 0x44c1, 0x443c, 0x4594, 0x16f4, 0x0000, 0x4518, 0x0000,
+	    0x49aa, 0x10c3, 0x1a43, 0x0000, 0x27d7, 0x0000, 0x2eec, 0x2d74,
+	    0x0000, 0x4dd3, 0x4c3b, 0x0000, 0x0000, 0x40ae, 0x3650, 0x1c6a,
+	    0x1275, 0x2d1a, 0x0000, 0x0000, 0x2e54, 0x0000, 0x4825, 0x0000,
+	    0x0000, 0x08d3, 0x21d7, 0x377d, 0x0000, 0x0000, 0x4581, 0x46a6,
+	    0x0000, 0x0000, 0x1dd6, 0x2157, 0x0000, 0x0000, 0x1773, 0x0000,
+	    0x1330, 0x4336, 0x20b1, 0x0000, 0x0000, 0x0000, 0x1bab, 0x0d88,
+	    0x2efc, 0x02df, 0x3bd4, 0x4522, 0x0000, 0x36db, 0x229b, 0x0000,
+	    0x438b, 0x3e36, 0x01ad, 0x0000, 0x0847, 0x21e3, 0x0000, 0x3136,
+	    0x0000, 0x0000, 0x359c, 0x0000, 0x0000, 0x0000, 0x4519, 0x2cdf,
+	    0x0000, 0x33d4, 0x0000, 0x24cf, 0x2856, 0x0000, 0x011f, 0x0000,
+	    0x13ee, 0x314f, 0x3fc2, 0x45a0, 0x0000, 0x1f4d, 0x393e, 0x0000,
+	    0x0000, 0x3d35, 0x0099, 0x0000, 0x1d8a, 0x2aac, 0x0000, 0x0000,
+	    0x41bc, 0x1798, 0x0000, 0x2d69, 0x0000, 0x2849, 0x0000, 0x0cce,
+	    0x4e04, 0x0000, 0x4afc, 0x0000, 0x0000, 0x0000, 0x0000, 0x42b7,
+	    0x24e1, 0x0000, 0x0f72, 0x0000, 0x4459, 0x31e4, 0x01a4, 0x0000,
+	    0x0c2c, 0x0000, 0x2ed0, 0x3169, 0x0000, 0x0000, 0x0000, 0x000e,
+	    0x0000, 0x4355, 0x0000, 0x0000, 0x30b4, 0x0000, 0x0000, 0x2133,
+	    0x22bf, 0x2ea6, 0x40c8, 0x0000, 0x3eb5, 0x349c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0a50, 0x4103, 0x0000, 0x2844, 0x05e0, 0x0000,
+	    0x17f1, 0x1d64, 0x1f2d, 0x3ba7, 0x0000, 0x0000, 0x15f0, 0x0000,
+	    0x0000, 0x46b5, 0x1ee3, 0x0000, 0x2b90, 0x2dde, 0x0000, 0x079f,
+	    0x0000, 0x2cfe, 0x0d1e, 0x0000, 0x0000, 0x331c, 0x0000, 0x0000,
+	    0x452f, 0x3d41, 0x4b2e, 0x2c80, 0x0000, 0x0000, 0x361e, 0x0000,
+	    0x2bae, 0x33bc, 0x0000, 0x0000, 0x0000, 0x0276, 0x2f68, 0x0000,
+	    0x3904, 0x0000, 0x2ebd, 0x0f1c, 0x0000, 0x0e2d, 0x40ab, 0x4426,
+	    0x0000, 0x0000, 0x10ee, 0x2770, 0x27cd, 0x3b04, 0x0000, 0x0000,
+	    0x0ae4, 0x0000, 0x3eb3, 0x03ae, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x28de, 0x0000, 0x0000, 0x15c0, 0x3dc7, 0x304a, 0x0000,
+	    0x1669, 0x0000, 0x0000, 0x075b, 0x06c2, 0x0000, 0x0000, 0x0000,
+	    0x44a6, 0x3e2f, 0x413e, 0x3b85, 0x1d62, 0x0000, 0x447b, 0x1e41,
+	    0x0000, 0x10e5, 0x270f, 0x47b9, 0x3942, 0x0000, 0x0000, 0x3b6d,
+	    0x4b04, 0x285b, 0x0515, 0x014e, 0x0000, 0x0000, 0x0000, 0x336a,
+	    0x0000, 0x40ad, 0x0000, 0x0000, 0x11d8, 0x32ed, 0x0000, 0x128e,
+	    0x3949, 0x0000, 0x0e4e, 0x0000, 0x0000, 0x0de4, 0x3431, 0x07d2,
+	    0x36f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x118f, 0x3be2, 0x39d4, 0x049a, 0x43fc, 0x0000, 0x167f,
+	    0x0000, 0x0000, 0x1cd4, 0x466d, 0x0000, 0x0000, 0x322f, 0x1f01,
+	    0x08ca, 0x48d0, 0x2421, 0x2a38, 0x0000, 0x0ea0, 0x27cb, 0x0469,
+	    0x252f, 0x0000, 0x0a6e, 0x24cc, 0x2e23, 0x0df7, 0x0000, 0x2995,
+	    0x2bf7, 0x0000, 0x0000, 0x4a1a, 0x0000, 0x0000, 0x0914, 0x1bc4,
+	    0x1c25, 0x3ece, 0x3367, 0x0000, 0x02cc, 0x2db9, 0x0000, 0x3502,
+	    0x0711, 0x324c, 0x0000, 0x0000, 0x0000, 0x4410, 0x4882, 0x0000,
+	    0x0000, 0x0000, 0x1060, 0x1f2a, 0x4419, 0x3a6a, 0x4cf8, 0x0000,
+	    0x165c, 0x0000, 0x1b70, 0x0000, 0x0000, 0x4901, 0x0000, 0x077f,
+	    0x0000, 0x0000, 0x2449, 0x3b2f, 0x0000, 0x00ea, 0x38ed, 0x3cc2,
+	    0x0000, 0x1d4b, 0x2536, 0x0000, 0x46e0, 0x10b4, 0x0000, 0x0000,
+	    0x3609, 0x0a08, 0x228f, 0x0000, 0x1e6b, 0x11df, 0x0000, 0x366a,
+	    0x26cb, 0x2d7c, 0x0000, 0x0000, 0x0a4b, 0x0a5e, 0x11d0, 0x0000,
+	    0x2595, 0x2b42, 0x0000, 0x381f, 0x41f2, 0x1e09, 0x0000, 0x0000,
+	    0x2bf4, 0x0000, 0x0f50, 0x493d, 0x0000, 0x3a11, 0x0000, 0x0000,
+	    0x0000, 0x2df0, 0x0000, 0x0d56, 0x3b2e, 0x0000, 0x0ae9, 0x0000,
+	    0x0000, 0x315d, 0x3968, 0x0000, 0x0000, 0x30c4, 0x0000, 0x21dc,
+	    0x0000, 0x0000, 0x3264, 0x0000, 0x0bcd, 0x3e70, 0x0000, 0x0d4a,
+	    0x0000, 0x060f, 0x0000, 0x3e1d, 0x2335, 0x0000, 0x0000, 0x1a22,
+	    0x0304, 0x0000, 0x0eab, 0x34bd, 0x390d, 0x0000, 0x0000, 0x4665,
+	    0x363c, 0x3d59, 0x0000, 0x115a, 0x3a03, 0x477c, 0x4aff, 0x0000,
+	    0x0000, 0x0000, 0x219e, 0x2c07, 0x0000, 0x0489, 0x0000, 0x0000,
+	    0x0000, 0x0962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x361c,
+	    0x0000, 0x0000, 0x0000, 0x47f0, 0x0000, 0x0000, 0x15bf, 0x0000,
+	    0x0000, 0x0000, 0x41a5, 0x0000, 0x3cce, 0x389c, 0x0000, 0x27a5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x46c2, 0x0000, 0x0000, 0x0000,
+	    0x3f88, 0x23a5, 0x0115, 0x174e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3246, 0x0000, 0x0000, 0x0000, 0x46cb, 0x2d27, 0x0000,
+	    0x0b06, 0x0000, 0x3e33, 0x0000, 0x0000, 0x31f3, 0x34ea, 0x0000,
+	    0x0000, 0x0000, 0x1b5a, 0x1d34, 0x3c81, 0x0000, 0x29cd, 0x0000,
+	    0x3d84, 0x24b5, 0x1e1d, 0x0894, 0x0000, 0x3039, 0x2098, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3982, 0x0000, 0x0000, 0x3989,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2a04, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1341, 0x0000, 0x0000, 0x240f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x47ac, 0x0000, 0x0000, 0x1aa2,
+	    0x3a01, 0x0000, 0x0000, 0x0000, 0x0000, 0x005b, 0x0000, 0x0000,
+	    0x2e2a, 0x3648, 0x0000, 0x0000, 0x0000, 0x048d, 0x42b3, 0x0000,
+	    0x0000, 0x0000, 0x3ea5, 0x3a91, 0x0000, 0x3bc7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x14b5, 0x391a, 0x291f, 0x0000, 0x0000,
+	    0x0000, 0x0d08, 0x4cc9, 0x17c4, 0x0000, 0x0000, 0x440c, 0x02bf,
+	    0x0000, 0x224d, 0x49ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x46c8, 0x1076, 0x0000, 0x0000, 0x0000, 0x1aae, 0x0000, 0x0000,
+	    0x0000, 0x4c17, 0x0000, 0x4581, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x242c, 0x0334, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c54,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4dd6, 0x1e96,
+	    0x3f43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a11, 0x484d,
+	    0x06c5, 0x090a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2b98, 0x21b4, 0x22e8, 0x0000, 0x0000, 0x0000, 0x2195,
+	    0x2bef, 0x0000, 0x0000, 0x0acb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x22a0, 0x0000, 0x362c, 0x0000, 0x0000, 0x0000, 0x164c,
+	    0x0000, 0x0000, 0x0000, 0x4c1f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x203f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1cb8, 0x33d7, 0x38f1, 0x1af8, 0x0000, 0x0000, 0x2211, 0x0000,
+	    0x0000, 0x2a42, 0x0000, 0x0000, 0x0000, 0x0000, 0x1986, 0x0000,
+	    0x1096, 0x4b44, 0x0819, 0x0000, 0x0000, 0x0000, 0x3fa6, 0x0000,
+	    0x45f8, 0x4c60, 0x3465, 0x0000, 0x005d, 0x0000, 0x1864, 0x2fdd,
+	    0x0000, 0x1e25, 0x0000, 0x0000, 0x178f, 0x07ed, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3c1d, 0x0000, 0x130e, 0x152d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3b25, 0x0000, 0x0000, 0x2173, 0x1c4c, 0x0000,
+	    0x0000, 0x2861, 0x0000, 0x0000, 0x0000, 0x390e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4819,
+	    0x0000, 0x0000, 0x3a63, 0x0000, 0x0000, 0x0000, 0x45ca, 0x0000,
+	    0x451e, 0x0208, 0x0000, 0x0000, 0x0000, 0x2a5d, 0x0000, 0x3d04,
+	    0x0000, 0x30db, 0x16b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1632, 0x0000, 0x0000, 0x3f7b, 0x0000, 0x17df, 0x441a, 0x0000,
+	    0x0000, 0x0000, 0x149b, 0x0000, 0x0000, 0x2898, 0x0000, 0x3d20,
+	    0x2563, 0x0000, 0x0000, 0x0000, 0x4bd2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0c99, 0x0000, 0x0000, 0x43b3, 0x0000,
+	    0x0000, 0x0ace, 0x03b3, 0x0000, 0x08ac, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x19ed, 0x0000, 0x36c6, 0x3858, 0x0000, 0x1ca4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x36b4, 0x1eb1, 0x0000, 0x0000,
+	    0x4294, 0x0000, 0x392c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4d02, 0x4b6a, 0x0332, 0x0000, 0x3bf4, 0x0000, 0x2700, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2e2c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1794, 0x49e0, 0x0000, 0x0000, 0x0930, 0x4d2d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3212, 0x0000, 0x0000, 0x0000, 0x2573,
+	    0x0000, 0x0000, 0x0000, 0x0ad0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19ee, 0x0000,
+	    0x0000, 0x192f, 0x0000, 0x2573, 0x0000, 0x440e, 0x0000, 0x0000,
+	    0x3a2f, 0x0bd0, 0x428a, 0x0267, 0x14d0, 0x0000, 0x0000, 0x220a,
+	    0x0000, 0x0bae, 0x237f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1fc9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3651, 0x0000, 0x0000, 0x0000,
+	    0x4a82, 0x0000, 0x0000, 0x168c, 0x027e, 0x3f95, 0x3059, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b81, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24d9, 0x0000, 0x4cf3, 0x0000, 0x2d7f,
+	    0x0000, 0x0000, 0x4105, 0x0000, 0x2e0d, 0x017c, 0x0000, 0x0ca3,
+	    0x0000, 0x0000, 0x0000, 0x4c3a, 0x3b9a, 0x0000, 0x0000, 0x315f,
+	    0x0000, 0x2a67, 0x0000, 0x49b1, 0x0000, 0x2b86, 0x4d31, 0x0000,
+	    0x0000, 0x0000, 0x0904, 0x0000, 0x0000, 0x2664, 0x1047, 0x0000,
+	    0x403d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1f60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x167d, 0x0000, 0x0000, 0x0000, 0x1719, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3f11, 0x0000, 0x0000, 0x0000, 0x0000, 0x37ca, 0x0000,
+	    0x3201, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4328,
+	    0x0000, 0x0000, 0x3c1b, 0x3bf6, 0x1bfa, 0x0000, 0x234e, 0x0000,
+	    0x13fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x451d, 0x0000,
+	    0x0000, 0x09bd, 0x4b2d, 0x0000, 0x16a7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1ece, 0x2bb7, 0x1061, 0x0000, 0x1220, 0x2d3a, 0x31e7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4b46, 0x0000, 0x0000, 0x218a, 0x1230, 0x0566, 0x341c, 0x3d3f,
+	    0x4002, 0x0000, 0x0000, 0x3962, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1924, 0x34de, 0x0677, 0x447f, 0x3168, 0x0000, 0x449e,
+	    0x0000, 0x2cc7, 0x0000, 0x1658, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x259b, 0x0000, 0x0000, 0x1fbb, 0x388e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x038c, 0x49c0, 0x0000, 0x437d, 0x0000, 0x3b1b, 0x07df,
+	    0x4ce0, 0x0000, 0x25bd, 0x0000, 0x47ec, 0x1156, 0x0000, 0x0000,
+	    0x44c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c03,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4997, 0x0000,
+	    0x0000, 0x0000, 0x1d18, 0x0000, 0x1b7f, 0x0000, 0x0000, 0x0000,
+	    0x3104, 0x4a03, 0x0000, 0x0000, 0x0000, 0x4860, 0x4401, 0x0000,
+	    0x0000, 0x0000, 0x2bb5, 0x0000, 0x0000, 0x17da, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0e55, 0x0000, 0x2417, 0x0000, 0x0000, 0x0916,
+	    0x0000, 0x0000, 0x461a, 0x44fc, 0x0000, 0x0000, 0x0000, 0x4666,
+	    0x0c6e, 0x4757, 0x3342, 0x0000, 0x0000, 0x1e09, 0x08bd, 0x1678,
+	    0x0000, 0x0000, 0x04c6, 0x0000, 0x30f5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1077, 0x0000, 0x05a0, 0x0000, 0x2d38, 0x0000, 0x0000,
+	    0x0000, 0x0150, 0x0000, 0x37c4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3e30, 0x0000, 0x0000, 0x0c7e, 0x3b85,
+	    0x0000, 0x439e, 0x0000, 0x361e, 0x0000, 0x0000, 0x1816, 0x0000,
+	    0x0b84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x497b, 0x0000, 0x0000, 0x0000, 0x3692,
+	    0x0000, 0x0f3c, 0x0000, 0x0f2b, 0x0000, 0x0000, 0x0b61, 0x0000,
+	    0x2829, 0x1e3e, 0x0000, 0x23da, 0x100a, 0x0000, 0x20d7, 0x4342,
+	    0x0000, 0x3fb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0da7, 0x0000, 0x0000, 0x243d, 0x0000, 0x0000, 0x14be,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4451, 0x0000,
+	    0x0a57, 0x168b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2142, 0x12df, 0x0000, 0x4912, 0x2759, 0x4bed, 0x0000, 0x0db7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31c5, 0x2040,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23ce, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x175c, 0x0000, 0x0000, 0x3f8e, 0x0000,
+	    0x1b31, 0x0000, 0x0000, 0x0000, 0x0000, 0x4561, 0x0000, 0x0000,
+	    0x0000, 0x1ce2, 0x0000, 0x0000, 0x2c29, 0x0000, 0x0000, 0x211e,
+	    0x0000, 0x421f, 0x0000, 0x1e67, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x28fd, 0x3b2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3db7,
+	    0x0000, 0x0d2f, 0x3cde, 0x308f, 0x1a8b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4ab3, 0x0000, 0x0000, 0x0000,
+	    0x105c, 0x0000, 0x3296, 0x02d6, 0x2ebe, 0x0000, 0x1037, 0x2664,
+	    0x16aa, 0x2f6d, 0x0fff, 0x3608, 0x0000, 0x08d7, 0x41c0, 0x0000,
+	    0x0000, 0x0000, 0x387c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x273c, 0x0000, 0x3ad4, 0x29bd, 0x0000,
+	    0x4514, 0x0000, 0x0000, 0x043e, 0x0610, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f34, 0x0000, 0x37e1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1001, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x370b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2eb0, 0x0000, 0x2f23, 0x0000, 0x0000, 0x0159, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x049e, 0x0000, 0x4396, 0x1fdd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0454, 0x081f, 0x0000,
+	    0x0000, 0x0000, 0x3df4, 0x0000, 0x0000, 0x0000, 0x313f, 0x0000,
+	    0x0000, 0x42ab, 0x0000, 0x0000, 0x0000, 0x3c15, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4455, 0x0000, 0x1acc, 0x0000, 0x36f0,
+	    0x0000, 0x48b0, 0x0000, 0x1357, 0x0000, 0x17ee, 0x0000, 0x0000,
+	    0x0000, 0x00e5, 0x0000, 0x0000, 0x1e92, 0x15f6, 0x0000, 0x0000,
+	    0x09d7, 0x0000, 0x0000, 0x2897, 0x2ad8, 0x0000, 0x1778, 0x02f9,
+	    0x0000, 0x1293, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bd1,
+	    0x0000, 0x0000, 0x0000, 0x42ec, 0x0000, 0x0000, 0x0000, 0x1213,
+	    0x3051, 0x0000, 0x1d6b, 0x0000, 0x0000, 0x0000, 0x4359, 0x0000,
+	    0x0000, 0x2915, 0x0000, 0x0000, 0x0000, 0x1701, 0x0000, 0x0000,
+	    0x05d8, 0x26d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2e5b, 0x139e, 0x1fad, 0x0000,
+	    0x0000, 0x2278, 0x15d1, 0x0000, 0x2279, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a62, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3d67, 0x4976, 0x0000, 0x0000,
+	    0x0533, 0x0000, 0x0000, 0x47f5, 0x0000, 0x3e71, 0x3ff8, 0x0000,
+	    0x0000, 0x0818, 0x0000, 0x0000, 0x0000, 0x0000, 0x0460, 0x1924,
+	    0x4497, 0x0000, 0x3b80, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3597, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0a30, 0x0000, 0x0000, 0x02fb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3cdc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a4d, 0x0000, 0x0000,
+	    0x08d6, 0x0000, 0x0c35, 0x0273, 0x0000, 0x3416, 0x0000, 0x0000,
+	    0x0000, 0x11fd, 0x0000, 0x0000, 0x050c, 0x0000, 0x0000, 0x342d,
+	    0x0000, 0x0000, 0x0000, 0x34df, 0x0000, 0x0000, 0x1812, 0x0000,
+	    0x0000, 0x0404, 0x0000, 0x0000, 0x0000, 0x1a4e, 0x0000, 0x0000,
+	    0x1221, 0x0000, 0x0000, 0x3b99, 0x13c7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bfa, 0x0000,
+	    0x0000, 0x0000, 0x2cf7, 0x0000, 0x0000, 0x2062, 0x0333, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x40ec, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2166, 0x25a9, 0x0000, 0x2f78, 0x0000,
+	    0x0000, 0x0000, 0x02e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4b8d, 0x359d, 0x4056, 0x0000, 0x0000, 0x0000, 0x3097, 0x0000,
+	    0x0426, 0x0000, 0x379f, 0x0000, 0x0000, 0x0000, 0x0000, 0x1653,
+	    0x4431, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26ea, 0x0000,
+	    0x0000, 0x0000, 0x1d56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3f73, 0x0000, 0x0000, 0x4dac, 0x0000, 0x421b, 0x45f5, 0x16a1,
+	    0x0000, 0x48df, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2b87, 0x0000, 0x47ce, 0x0000, 0x3d32, 0x0000, 0x2f5d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4534, 0x0000, 0x0000, 0x3906,
+	    0x0000, 0x0000, 0x336c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1c30, 0x470d, 0x0000, 0x0000, 0x0000, 0x28e8, 0x0000,
+	    0x1a95, 0x305f, 0x0000, 0x0ebc, 0x494f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1f82, 0x0000, 0x0000, 0x461e, 0x0000, 0x40de, 0x0000,
+	    0x1cac, 0x0000, 0x23c3, 0x0228, 0x0000, 0x1132, 0x0000, 0x0000,
+	    0x0eb2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x204c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x435c,
+	    0x0000, 0x0000, 0x0000, 0x1f0f, 0x0000, 0x36ce, 0x0000, 0x3ca3,
+	    0x0000, 0x0000, 0x0000, 0x3382, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0693, 0x0000, 0x0000, 0x1805, 0x2af2, 0x0000, 0x19aa, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x07c1, 0x1b27, 0x0000, 0x2a00, 0x0000,
+	    0x0000, 0x0000, 0x0a87, 0x2628, 0x2536, 0x0000, 0x0000, 0x0000,
+	    0x1c15, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e2a, 0x0000, 0x0000,
+	    0x47f4, 0x0000, 0x0ebb, 0x0000, 0x2980, 0x0000, 0x3298, 0x4bb7,
+	    0x0000, 0x0000, 0x0000, 0x230c, 0x4c06, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3361, 0x3604, 0x0000, 0x4b61, 0x4abc, 0x0000, 0x0000,
+	    0x0000, 0x00a3, 0x0000, 0x3bb2, 0x0000, 0x0000, 0x3faf, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3c9d, 0x0000, 0x0000, 0x0000,
+	    0x0109, 0x0000, 0x3efb, 0x0c96, 0x0000, 0x3e21, 0x0000, 0x0000,
+	    0x3433, 0x0000, 0x0e0f, 0x0000, 0x0000, 0x0000, 0x3774, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21eb,
+	    0x0000, 0x4285, 0x0000, 0x30e2, 0x3a8b, 0x0000, 0x0000, 0x315a,
+	    0x0000, 0x0000, 0x2614, 0x0000, 0x0000, 0x0000, 0x0000, 0x0036,
+	    0x0000, 0x0000, 0x03c9, 0x0000, 0x0015, 0x0000, 0x47e6, 0x0000,
+	    0x0000, 0x19aa, 0x4637, 0x0000, 0x1a34, 0x0000, 0x0000, 0x0000,
+	    0x3c58, 0x0000, 0x468f, 0x0000, 0x0000, 0x0000, 0x27fc, 0x08d8,
+	    0x009a, 0x0000, 0x36e4, 0x0000, 0x0000, 0x0000, 0x2c3d, 0x0000,
+	    0x0000, 0x0000, 0x49d7, 0x0000, 0x0000, 0x4839, 0x3b16, 0x0000,
+	    0x0000, 0x14c9, 0x45a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1cd5, 0x0e28, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x27ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3257, 0x48b0, 0x0fb1, 0x0000, 0x0000, 0x0000, 0x2682, 0x0000,
+	    0x0000, 0x0000, 0x2657, 0x0000, 0x0000, 0x4abe, 0x11c2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3721, 0x0c72, 0x0000,
+	    0x0000, 0x0000, 0x43eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x49ee,
+	    0x22ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f11,
+	    0x0000, 0x0000, 0x0000, 0x384d, 0x0000, 0x0000, 0x0000, 0x11a5,
+	    0x0000, 0x0dd1, 0x0000, 0x4954, 0x0000, 0x0000, 0x0000, 0x2b20,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4b9c, 0x0000, 0x0000, 0x0000,
+	    0x11fe, 0x25de, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0511, 0x0000, 0x0d58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1654, 0x0000, 0x0000, 0x1c74, 0x3b63, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1820, 0x0000, 0x0000, 0x0000, 0x0499, 0x2b6f,
+	    0x0000, 0x0000, 0x0ef6, 0x0000, 0x1b2a, 0x15ce, 0x1299, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x025e, 0x0000, 0x1600, 0x0000,
+	    0x4293, 0x0000, 0x0000, 0x38a7, 0x2b52, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24b1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d4f, 0x0000,
+	    0x0000, 0x0000, 0x0e45, 0x2e10, 0x4499, 0x0000, 0x4473, 0x0000,
+	    0x0000, 0x247a, 0x04e3, 0x0000, 0x104c, 0x0000, 0x0000, 0x0000,
+	    0x0f47, 0x0000, 0x246a, 0x0000, 0x0000, 0x0fd8, 0x28bf, 0x0000,
+	    0x0000, 0x0b61, 0x3def, 0x0000, 0x0000, 0x1fd9, 0x25cd, 0x2363,
+	    0x0000, 0x0000, 0x0000, 0x20ac, 0x188b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1ab5, 0x0000, 0x2eb8, 0x0000, 0x4c20, 0x0000, 0x0000,
+	    0x3902, 0x0000, 0x2fae, 0x1f6a, 0x220d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x20d2, 0x4648, 0x362c, 0x0000, 0x0000, 0x442a,
+	    0x0000, 0x1f01, 0x0000, 0x0000, 0x0000, 0x3a05, 0x0000, 0x0000,
+	    0x47f2, 0x1e7c, 0x0000, 0x0000, 0x1e01, 0x3bec, 0x023a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x196c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x146f,
+	    0x0000, 0x1ff2, 0x0000, 0x298e, 0x0f88, 0x0000, 0x0000, 0x19d2,
+	    0x0000, 0x2662, 0x49a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e3c,
+	    0x0000, 0x0923, 0x0774, 0x0000, 0x30c7, 0x19b7, 0x3686, 0x4333,
+	    0x0000, 0x0000, 0x0000, 0x2022, 0x0000, 0x0000, 0x2e19, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1fed, 0x0000, 0x3e45, 0x0000, 0x0be6,
+	    0x0000, 0x3285, 0x0000, 0x1017, 0x2000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3542, 0x1da0, 0x0074, 0x48f2, 0x1f05, 0x2870, 0x0000,
+	    0x08f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06f6,
+	    0x3485, 0x0000, 0x4771, 0x0000, 0x31e0, 0x0000, 0x1e8d, 0x4403,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x0000, 0x4c13, 0x0000,
+	    0x4ca6, 0x0000, 0x3738, 0x0000, 0x0000, 0x0000, 0x2415, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2dd2, 0x0000, 0x0000, 0x0000, 0x4422,
+	    0x0000, 0x0000, 0x490c, 0x0000, 0x4517, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3d7a, 0x0000, 0x0000, 0x0000, 0x1434, 0x0000, 0x4af2,
+	    0x3975, 0x0000, 0x0000, 0x20a8, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2d1f, 0x3a4d, 0x0000, 0x07c5, 0x44c5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b1d, 0x0000,
+	    0x3eff, 0x0000, 0x0000, 0x210d, 0x0000, 0x35ba, 0x0000, 0x0000,
+	    0x2086, 0x0000, 0x0000, 0x0000, 0x0000, 0x4501, 0x0000, 0x0000,
+	    0x0000, 0x0e53, 0x2b5f, 0x0000, 0x0000, 0x0000, 0x0000, 0x48c4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x189a,
+	    0x4daf, 0x0000, 0x31ff, 0x292c, 0x0ce0, 0x0000, 0x0000, 0x1d09,
+	    0x0000, 0x0000, 0x305c, 0x47b2, 0x0000, 0x0000, 0x0000, 0x10d8,
+	    0x0000, 0x00b1, 0x3749, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1f23, 0x0000, 0x22d0, 0x0000, 0x0000, 0x0f79,
+	    0x0000, 0x0000, 0x0000, 0x2a8d, 0x0000, 0x0bba, 0x2f19, 0x0000,
+	    0x0000, 0x0000, 0x02d8, 0x0000, 0x0053, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4dd1, 0x27bf, 0x0000, 0x0000, 0x3ed3, 0x330d, 0x09c9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x440d,
+	    0x4640, 0x0000, 0x0000, 0x0000, 0x0000, 0x13be, 0x22d2, 0x3e2a,
+	    0x40d0, 0x2fed, 0x176d, 0x1b7f, 0x0000, 0x0000, 0x0000, 0x20ba,
+	    0x2eb5, 0x113f, 0x0000, 0x0000, 0x0000, 0x0000, 0x2457, 0x2a47,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e7d, 0x0000, 0x4772, 0x0000,
+	    0x0f5a, 0x0e31, 0x0c98, 0x3f47, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x20fd, 0x0000, 0x09e7, 0x0000, 0x0689, 0x0ade, 0x368e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x474a, 0x3162, 0x0000, 0x0000, 0x04e8,
+	    0x0000, 0x0000, 0x1cc4, 0x0000, 0x0000, 0x0000, 0x4c55, 0x0000,
+	    0x29ac, 0x4111, 0x371b, 0x0000, 0x0fbe, 0x0000, 0x0000, 0x360b,
+	    0x0000, 0x0000, 0x39f1, 0x0000, 0x0000, 0x295a, 0x3d53, 0x0000,
+	    0x0000, 0x0000, 0x0a7d, 0x0000, 0x0334, 0x0000, 0x0000, 0x0000,
+	    0x0db1, 0x119a, 0x0000, 0x0000, 0x0320, 0x404e, 0x0000, 0x23f1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a34, 0x42a1, 0x0000,
+	    0x0000, 0x1433, 0x0000, 0x0000, 0x0000, 0x4227, 0x0544, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2681, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1626, 0x0000, 0x0000, 0x36e0, 0x35b3,
+	    0x0000, 0x156a, 0x0000, 0x0000, 0x0ac1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0006, 0x0000, 0x0000, 0x0000, 0x0d3d,
+	    0x0000, 0x0000, 0x0000, 0x2890, 0x2f63, 0x05e3, 0x0000, 0x3a4a,
+	    0x2a8b, 0x0000, 0x0000, 0x0000, 0x0000, 0x19cd, 0x0000, 0x0991,
+	    0x0000, 0x0000, 0x216a, 0x128c, 0x0000, 0x4d24, 0x0000, 0x0000,
+	    0x0000, 0x34e3, 0x0000, 0x0000, 0x17c7, 0x0000, 0x0000, 0x0000,
+	    0x44d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1c96, 0x3688, 0x0000, 0x0000, 0x0000, 0x2649,
+	    0x0000, 0x1aa8, 0x1eec, 0x0000, 0x3182, 0x0000, 0x0000, 0x0000,
+	    0x0b31, 0x28df, 0x0000, 0x241c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4315,
+	    0x49dc, 0x0000, 0x3b2d, 0x0000, 0x223b, 0x2f36, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x445c,
+	    0x0000, 0x10e1, 0x0000, 0x37a4, 0x0000, 0x0000, 0x1c44, 0x396c,
+	    0x0000, 0x4bed, 0x1f38, 0x0000, 0x0000, 0x0000, 0x0000, 0x300d,
+	    0x0000, 0x0000, 0x0c7e, 0x0a3e, 0x2cd1, 0x0000, 0x2399, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x254e, 0x0000, 0x2ee1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1eea, 0x0000,
+	    0x0000, 0x1484, 0x0000, 0x0000, 0x0000, 0x0000, 0x21f2, 0x0344,
+	    0x3393, 0x4b7a, 0x0000, 0x0cad, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3134,
+	    0x1b7e, 0x0000, 0x1839, 0x15c6, 0x0000, 0x0000, 0x1c71, 0x3e79,
+	    0x0000, 0x0000, 0x0000, 0x1066, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x229a, 0x0000, 0x4626, 0x0000, 0x0000, 0x46da,
+	    0x0000, 0x072e, 0x0000, 0x0000, 0x2f5f, 0x0794, 0x0000, 0x0000,
+	    0x0000, 0x2fb9, 0x1392, 0x0000, 0x0000, 0x2bdc, 0x0000, 0x0000,
+	    0x05da, 0x2c76, 0x0000, 0x0000, 0x0000, 0x46aa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4966, 0x0000, 0x0000, 0x04a8, 0x0000,
+	    0x0000, 0x3067, 0x34dc, 0x0000, 0x0df2, 0x1b09, 0x234a, 0x3c4b,
+	    0x14e7, 0x0000, 0x0000, 0x029e, 0x0902, 0x0000, 0x0000, 0x1d25,
+	    0x36e7, 0x0000, 0x0000, 0x2591, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2f6c, 0x4527, 0x1fee, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x11cc, 0x3be0, 0x4db1, 0x0000, 0x0f42, 0x0000, 0x0000, 0x3b75,
+	    0x0000, 0x1f73, 0x0000, 0x373d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0462, 0x06f5, 0x0000, 0x07dc, 0x07f1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4a47, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0210, 0x4d9a, 0x0000, 0x3e24,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x36fb, 0x0000, 0x0000, 0x0000, 0x064a, 0x0000, 0x0000, 0x2593,
+	    0x0000, 0x0000, 0x0000, 0x3518, 0x1838, 0x0000, 0x070d, 0x0000,
+	    0x0000, 0x0000, 0x0b72, 0x029c, 0x0000, 0x0000, 0x2fd0, 0x0977,
+	    0x0000, 0x0000, 0x2a86, 0x0000, 0x0000, 0x0000, 0x1410, 0x0000,
+	    0x0000, 0x0000, 0x0aba, 0x2434, 0x0000, 0x16b1, 0x42a6, 0x0000,
+	    0x34f3, 0x0000, 0x4b91, 0x0000, 0x1210, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x48bd, 0x31b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x285e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2be7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4754, 0x0000, 0x0000, 0x0000, 0x1707, 0x0000, 0x350b,
+	    0x1bc7, 0x0000, 0x4510, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1642, 0x2eb2, 0x0000, 0x0000, 0x3be3, 0x1ce7, 0x00a2, 0x1905,
+	    0x36c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d90, 0x4625, 0x0000,
+	    0x430d, 0x3940, 0x0000, 0x0000, 0x0000, 0x4011, 0x0000, 0x10d4,
+	    0x0000, 0x0000, 0x4654, 0x0000, 0x0000, 0x3f55, 0x152b, 0x34e0,
+	    0x0000, 0x28e6, 0x2b7b, 0x0000, 0x0000, 0x06e9, 0x1da0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x326b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0867, 0x0000, 0x3428, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1e2a, 0x0000, 0x0000, 0x2b87, 0x172a,
+	    0x0000, 0x0000, 0x2cdb, 0x2cc6, 0x0b14, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x48f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4892, 0x0000, 0x0000, 0x2a9d, 0x0000, 0x0000, 0x0000, 0x307d,
+	    0x14cb, 0x0000, 0x08bc, 0x04ae, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x199d, 0x48dc, 0x0000, 0x0000, 0x3003, 0x1264, 0x0000,
+	    0x0000, 0x4270, 0x44ac, 0x21b7, 0x0000, 0x0000, 0x3570, 0x47d4,
+	    0x0000, 0x0000, 0x4ab2, 0x4d9c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4872, 0x4df9, 0x0000, 0x0000, 0x0000, 0x416d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1436, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4146, 0x0000, 0x46d8, 0x0000, 0x0000, 0x0000, 0x1aa8,
+	    0x0000, 0x0000, 0x3cfb, 0x0000, 0x1f5c, 0x0000, 0x0000, 0x0000,
+	    0x2a15, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x118e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2dbb, 0x434b, 0x07da, 0x0000,
+	    0x0000, 0x0000, 0x3020, 0x0000, 0x0000, 0x0000, 0x1cb3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4237, 0x06ed, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2c37, 0x3437, 0x311f, 0x0000, 0x0000, 0x49bb,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1404, 0x0000, 0x17b5, 0x045e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4185, 0x2c2c, 0x28ff, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3cd8, 0x2864, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cc9,
+	    0x0000, 0x0b1f, 0x0933, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x05d9, 0x44bd, 0x0000, 0x0000, 0x1bb3, 0x0000, 0x0000, 0x0000,
+	    0x4b5b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x367b,
+	    0x0000, 0x0ac2, 0x0000, 0x206d, 0x0000, 0x0000, 0x0000, 0x05d8,
+	    0x0000, 0x0875, 0x0000, 0x0000, 0x0000, 0x0000, 0x11c1, 0x28bc,
+	    0x0000, 0x0000, 0x3a2b, 0x0000, 0x0b75, 0x0000, 0x0000, 0x2368,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x10ce, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3cdc, 0x2dfe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3928, 0x39a7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0356, 0x2f53, 0x42ef, 0x4396, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3ec2, 0x0000, 0x0000, 0x473f, 0x0000, 0x0000, 0x24ff,
+	    0x0000, 0x0000, 0x0612, 0x1433, 0x3abf, 0x0f25, 0x0000, 0x0000,
+	    0x3585, 0x0000, 0x0000, 0x220e, 0x340f, 0x2004, 0x0000, 0x0e6e,
+	    0x0000, 0x295c, 0x0000, 0x3b46, 0x0000, 0x1a04, 0x0000, 0x0000,
+	    0x0000, 0x2d80, 0x0000, 0x07bc, 0x0000, 0x0000, 0x0000, 0x1fad,
+	    0x2116, 0x0000, 0x24e1, 0x2ad7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0996, 0x0000, 0x3aac, 0x2ea7, 0x0000, 0x1a8e, 0x0000,
+	    0x1304, 0x0000, 0x38ee, 0x0000, 0x0000, 0x381c, 0x0000, 0x0bc0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x144d, 0x0000, 0x4003,
+	    0x0000, 0x1a26, 0x0000, 0x24d3, 0x0000, 0x0000, 0x032c, 0x0000,
+	    0x3cc9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2193, 0x0000, 0x0b58, 0x01d7,
+	    0x0000, 0x0c02, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3ad9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2a0c, 0x0f4f, 0x40d8, 0x35eb, 0x0000, 0x216e, 0x0a99, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x302a, 0x0000, 0x0000, 0x09ec,
+	    0x0000, 0x2ebf, 0x0000, 0x3587, 0x3dba, 0x0000, 0x144a, 0x0000,
+	    0x0000, 0x30bc, 0x413d, 0x3543, 0x2272, 0x0000, 0x129d, 0x4b4a,
+	    0x0000, 0x31f0, 0x0000, 0x0000, 0x0000, 0x1bc5, 0x443b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x37f9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1cd9, 0x0000, 0x294b, 0x09b6, 0x0000,
+	    0x0000, 0x3d9d, 0x043a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x131e, 0x0000, 0x4ca2, 0x24af, 0x3398, 0x360c, 0x178f,
+	    0x0000, 0x0000, 0x390f, 0x0000, 0x0aca, 0x0000, 0x0000, 0x0000,
+	    0x47c7, 0x0000, 0x0e8c, 0x00aa, 0x0000, 0x0000, 0x04a0, 0x0000,
+	    0x0000, 0x0000, 0x1d03, 0x0000, 0x0c94, 0x0000, 0x1cd5, 0x2f2e,
+	    0x0000, 0x13c1, 0x16d0, 0x0000, 0x0000, 0x488d, 0x0000, 0x328c,
+	    0x0000, 0x0520, 0x0000, 0x0000, 0x17d8, 0x2fce, 0x0000, 0x0000,
+	    0x0000, 0x2e28, 0x378a, 0x4861, 0x15b5, 0x0000, 0x0000, 0x0be9,
+	    0x1275, 0x04e3, 0x10d4, 0x0747, 0x4657, 0x3eca, 0x0000, 0x0609,
+	    0x157a, 0x0eab, 0x0000, 0x3bb7, 0x0231, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x471a, 0x0000, 0x3477, 0x0000, 0x1ed8,
+	    0x29a5, 0x2424, 0x0000, 0x0000, 0x0000, 0x389c, 0x0000, 0x0000,
+	    0x0166, 0x0000, 0x0000, 0x0000, 0x46ae, 0x12e1, 0x0000, 0x0000,
+	    0x0000, 0x2eeb, 0x0f80, 0x0000, 0x0000, 0x0000, 0x1ee2, 0x0000,
+	    0x0000, 0x307c, 0x0000, 0x0000, 0x0000, 0x418c, 0x0000, 0x0000,
+	    0x3bb4, 0x3a5e, 0x49e3, 0x4bb1, 0x0000, 0x42e2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3fed, 0x0000, 0x0000, 0x0000, 0x0450,
+	    0x2cf2, 0x0000, 0x4881, 0x0000, 0x0000, 0x0000, 0x0000, 0x229b,
+	    0x0509, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x092f,
+	    0x0000, 0x01b0, 0x0000, 0x0000, 0x0000, 0x1e11, 0x2c6e, 0x0000,
+	    0x2b43, 0x0000, 0x08aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0529,
+	    0x33bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3053, 0x2283,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4887, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4273, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2831, 0x298d, 0x0000, 0x0000, 0x3de4, 0x3025, 0x0000, 0x33dc,
+	    0x435f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1924,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0fc7,
+	    0x0000, 0x0000, 0x3d99, 0x1286, 0x00ee, 0x0000, 0x366e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0014, 0x26a6, 0x0000, 0x1042, 0x18a9,
+	    0x0000, 0x0000, 0x4917, 0x0000, 0x176e, 0x0000, 0x2bb8, 0x0000,
+	    0x3b08, 0x0000, 0x30fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x2037,
+	    0x0000, 0x0000, 0x1582, 0x4e06, 0x218b, 0x0000, 0x4ad2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1d22, 0x31c1, 0x27d6, 0x0000,
+	    0x31ca, 0x1486, 0x42a7, 0x0000, 0x0000, 0x40af, 0x0000, 0x064c,
+	    0x0000, 0x22d7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0148, 0x4660, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3bec, 0x116c, 0x0000, 0x0000,
+	    0x0000, 0x2693, 0x1274, 0x0000, 0x467d, 0x0000, 0x0000, 0x0ffc,
+	    0x0000, 0x0000, 0x26ad, 0x0373, 0x0000, 0x2863, 0x1512, 0x0000,
+	    0x134d, 0x0000, 0x31c6, 0x3139, 0x24c2, 0x47fa, 0x3fc5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1099, 0x483d,
+	    0x0000, 0x2601, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1388,
+	    0x2384, 0x0000, 0x38cb, 0x0000, 0x0000, 0x0000, 0x4999, 0x0000,
+	    0x0000, 0x0000, 0x3beb, 0x21ad, 0x0000, 0x0000, 0x3309, 0x0ded,
+	    0x0000, 0x0000, 0x1a33, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x178d, 0x0000, 0x414c, 0x2062, 0x0000, 0x2f86, 0x3a4b, 0x0000,
+	    0x0000, 0x29d3, 0x3835, 0x0000, 0x0000, 0x4983, 0x183c, 0x0a39,
+	    0x09ce, 0x0000, 0x2c85, 0x3807, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3be2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4059, 0x1fd2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x201d, 0x0000, 0x0000,
+	    0x0000, 0x4ba5, 0x177b, 0x1722, 0x360e, 0x0000, 0x0000, 0x2d41,
+	    0x0000, 0x07e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3392, 0x0000, 0x0000, 0x0755, 0x48cb, 0x3153, 0x0000,
+	    0x0000, 0x335c, 0x0000, 0x0eb8, 0x0000, 0x4c23, 0x1ce9, 0x2163,
+	    0x0000, 0x0000, 0x0000, 0x378e, 0x277e, 0x49a2, 0x3024, 0x0000,
+	    0x0000, 0x35a6, 0x250a, 0x2c9f, 0x0000, 0x0000, 0x0000, 0x12e2,
+	    0x483d, 0x0000, 0x0000, 0x301f, 0x0000, 0x3f63, 0x0000, 0x16b3,
+	    0x280e, 0x0000, 0x4553, 0x0000, 0x1496, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2ae9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3441,
+	    0x083a, 0x0000, 0x4598, 0x0000, 0x232f, 0x0000, 0x0000, 0x2ef7,
+	    0x3cae, 0x0000, 0x0000, 0x0000, 0x1135, 0x0000, 0x0481, 0x0000,
+	    0x04c8, 0x1b71, 0x0000, 0x0000, 0x0000, 0x0000, 0x32e6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x052f, 0x0000, 0x16b2,
+	    0x0000, 0x0000, 0x1bbf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3d8a, 0x3fb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061,
+	    0x0000, 0x47fb, 0x0000, 0x34d0, 0x4216, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x27ba, 0x3b2e, 0x2c97, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1469, 0x0000, 0x2dea, 0x3265, 0x0000, 0x0000, 0x0074, 0x0383,
+	    0x0000, 0x3049, 0x0000, 0x3d07, 0x1f23, 0x4a74, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01cc, 0x0000, 0x13dd, 0x2380, 0x04d9,
+	    0x0000, 0x0000, 0x0000, 0x3b82, 0x0000, 0x0000, 0x0000, 0x16f9,
+	    0x25d1, 0x0000, 0x0192, 0x0000, 0x0000, 0x1ef7, 0x0000, 0x3aa9,
+	    0x0000, 0x11af, 0x24bf, 0x0000, 0x43c9, 0x4cc2, 0x0000, 0x15e4,
+	    0x0000, 0x0de2, 0x2d8a, 0x0000, 0x04e8, 0x23f7, 0x1725, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x479e, 0x1e0a, 0x0000, 0x2b24, 0x0000,
+	    0x2456, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2b07, 0x1ea1, 0x0000, 0x2923, 0x0000, 0x1789, 0x0000, 0x0000,
+	    0x0000, 0x2fa5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1564, 0x133b, 0x0000, 0x0000, 0x0000, 0x0000, 0x22c7,
+	    0x0000, 0x15d9, 0x112a, 0x2fb9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x06d3, 0x0000, 0x0000, 0x0000, 0x26ee, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x18b0, 0x0000, 0x36f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x30dd, 0x3e85, 0x0000, 0x1cc0, 0x3fd0, 0x0000, 0x0000, 0x0000,
+	    0x3537, 0x05c6, 0x0000, 0x3eb0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b4d, 0x0000, 0x0000,
+	    0x26c4, 0x0000, 0x0000, 0x1ba8, 0x0000, 0x0000, 0x3bd7, 0x308d,
+	    0x0000, 0x40ee, 0x0000, 0x0000, 0x23e3, 0x0000, 0x188c, 0x3bef,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07df, 0x0000, 0x0000,
+	    0x4af6, 0x4aaf, 0x0000, 0x0000, 0x003b, 0x0000, 0x0000, 0x0000,
+	    0x3593, 0x3b9f, 0x2d4e, 0x0000, 0x0000, 0x0000, 0x399b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1925, 0x0000, 0x0000, 0x22c7,
+	    0x17c7, 0x0000, 0x2c0f, 0x0000, 0x0000, 0x0418, 0x3c64, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0a40, 0x0000, 0x02cf, 0x0000, 0x0000,
+	    0x1f35, 0x4333, 0x0000, 0x4147, 0x1a88, 0x26d9, 0x0000, 0x0000,
+	    0x2f73, 0x3fae, 0x3a9c, 0x0000, 0x1b4d, 0x0000, 0x0000, 0x39db,
+	    0x04de, 0x0000, 0x4dd9, 0x1601, 0x298f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x458d, 0x0b8d, 0x0000, 0x0000, 0x0000, 0x10d3,
+	    0x0000, 0x3fe8, 0x3661, 0x0000, 0x0000, 0x4926, 0x1ae7, 0x0000,
+	    0x3ecf, 0x11b3, 0x0000, 0x0000, 0x0000, 0x23a8, 0x0000, 0x48b0,
+	    0x4638, 0x35d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3913, 0x3b80, 0x3b91,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x020b, 0x17cd, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x129c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x15b2, 0x0000, 0x0000, 0x452c, 0x0000, 0x0ad9,
+	    0x11f8, 0x0000, 0x4a1f, 0x0000, 0x0000, 0x0000, 0x0000, 0x12fa,
+	    0x0000, 0x45ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x45f7, 0x0000, 0x0000, 0x0000, 0x31a7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x41be, 0x0000, 0x0000, 0x0000,
+	    0x30d8, 0x0000, 0x0000, 0x22a9, 0x0d91, 0x0000, 0x055e, 0x25d2,
+	    0x0000, 0x30da, 0x0000, 0x0000, 0x0000, 0x39cf, 0x0000, 0x45d2,
+	    0x2b10, 0x0000, 0x0000, 0x3ea9, 0x0919, 0x0195, 0x0000, 0x0000,
+	    0x0000, 0x1c71, 0x0000, 0x2aa8, 0x43c8, 0x0000, 0x1f38, 0x0000,
+	    0x0000, 0x3a43, 0x2245, 0x0000, 0x3472, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0dc2, 0x0000, 0x0000, 0x0000,
+	    0x2eb3, 0x1b70, 0x0000, 0x0000, 0x0000, 0x0000, 0x3150, 0x132c,
+	    0x3b18, 0x0000, 0x0000, 0x0000, 0x3e52, 0x0000, 0x2c2f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x324a, 0x1044, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4b0a, 0x0d9c, 0x481a, 0x0000, 0x1d5b,
+	    0x15b0, 0x0000, 0x0000, 0x172b, 0x0000, 0x4b3b, 0x0000, 0x0000,
+	    0x0000, 0x4b7f, 0x0edc, 0x4ad5, 0x0000, 0x23df, 0x19f5, 0x1b1a,
+	    0x498d, 0x0000, 0x0000, 0x23ac, 0x276a, 0x0568, 0x0000, 0x0000,
+	    0x0000, 0x1493, 0x04e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x21be,
+	    0x0000, 0x0000, 0x0000, 0x4787, 0x1abc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x012f, 0x0000, 0x0000, 0x47e5, 0x4392,
+	    0x0000, 0x07bf, 0x0000, 0x2764, 0x0000, 0x0000, 0x3813, 0x1921,
+	    0x0000, 0x0000, 0x0000, 0x0a26, 0x0000, 0x0000, 0x0000, 0x0908,
+	    0x3cc9, 0x2f25, 0x0000, 0x1818, 0x1b29, 0x3362, 0x16a4, 0x0000,
+	    0x0000, 0x2f31, 0x0000, 0x0000, 0x2ffe, 0x34ac, 0x0d3c, 0x0a0d,
+	    0x0000, 0x0000, 0x0f8d, 0x0000, 0x3598, 0x0000, 0x0000, 0x2501,
+	    0x4130, 0x0000, 0x0000, 0x12dd, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4b6b, 0x0000, 0x47a5, 0x0000, 0x0000, 0x3bbe, 0x0000,
+	    0x1178, 0x0000, 0x4deb, 0x0000, 0x4c7d, 0x0000, 0x0000, 0x3293,
+	    0x4b1a, 0x0000, 0x0000, 0x0000, 0x452b, 0x0000, 0x0000, 0x0000,
+	    0x0a82, 0x0000, 0x01de, 0x3b17, 0x3f86, 0x04a9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0b6c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3dc8, 0x0000, 0x18c2, 0x0000, 0x0000, 0x0000, 0x094b, 0x0000,
+	    0x0000, 0x0000, 0x3890, 0x0b92, 0x1717, 0x1cca, 0x0000, 0x0000,
+	    0x0000, 0x2e6d, 0x0000, 0x0000, 0x4715, 0x47ba, 0x0000, 0x32f3,
+	    0x3545, 0x0000, 0x0393, 0x38d2, 0x3c8c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0406, 0x0000, 0x0f61, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x13d9, 0x4af7, 0x0000, 0x239a, 0x1858, 0x4924, 0x0000,
+	    0x0000, 0x13f0, 0x0000, 0x494f, 0x1a2a, 0x0000, 0x0000, 0x0fb1,
+	    0x0000, 0x477c, 0x0000, 0x1caa, 0x0000, 0x0000, 0x043d, 0x0000,
+	    0x3150, 0x0000, 0x2b72, 0x05d2, 0x1a5d, 0x0000, 0x0000, 0x0c16,
+	    0x206a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38f2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19fc, 0x0000, 0x0000,
+	    0x43fc, 0x0000, 0x0add, 0x2667, 0x11dd, 0x0000, 0x0000, 0x18ea,
+	    0x0000, 0x0000, 0x36f9, 0x25f7, 0x40fb, 0x0000, 0x4886, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x337f, 0x0000, 0x0000, 0x4a57, 0x0000,
+	    0x3415, 0x0000, 0x49f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2358, 0x25fa, 0x0000, 0x0a1a, 0x38d7, 0x0000,
+	    0x0b7b, 0x09cf, 0x1e64, 0x0000, 0x0000, 0x2bd8, 0x082a, 0x2c85,
+	    0x497d, 0x41be, 0x066a, 0x0000, 0x3403, 0x3be1, 0x22c2, 0x2a5c,
+	    0x0000, 0x0000, 0x1716, 0x3bf1, 0x0000, 0x0000, 0x0000, 0x0de4,
+	    0x3e06, 0x03ba, 0x0000, 0x3793, 0x396d, 0x3b13, 0x0000, 0x0000,
+	    0x1134, 0x0000, 0x067f, 0x0000, 0x086b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0681, 0x09aa, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x357b, 0x0000, 0x0085, 0x0000,
+	    0x0000, 0x3feb, 0x0000, 0x2efb, 0x0000, 0x009b, 0x0000, 0x0346,
+	    0x0000, 0x0fb6, 0x0000, 0x0b6f, 0x190a, 0x0000, 0x0000, 0x1494,
+	    0x35b0, 0x0000, 0x0000, 0x27e1, 0x318e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1a64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bba,
+	    0x0000, 0x0000, 0x3d9d, 0x0000, 0x3c09, 0x2cd1, 0x1913, 0x4662,
+	    0x0000, 0x0000, 0x0000, 0x0b07, 0x0000, 0x2fff, 0x00cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3c81, 0x0000, 0x2050, 0x0000, 0x0055, 0x38a5,
+	    0x3b89, 0x4724, 0x0000, 0x0178, 0x103f, 0x0000, 0x0000, 0x441e,
+	    0x0eee, 0x0066, 0x3f72, 0x0000, 0x0000, 0x415c, 0x0000, 0x0000,
+	    0x1d2f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1d78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x31ae, 0x4121, 0x0000, 0x0000, 0x0000, 0x1ec0,
+	    0x0000, 0x0000, 0x2951, 0x3961, 0x0000, 0x1126, 0x0000, 0x0000,
+	    0x0f81, 0x0000, 0x0000, 0x253e, 0x420a, 0x4d02, 0x0000, 0x31c7,
+	    0x2c12, 0x0000, 0x0000, 0x46fb, 0x0000, 0x0524, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0efc, 0x1e24, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3982, 0x0000, 0x0000, 0x0000, 0x3765, 0x20c9,
+	    0x1d8f, 0x0000, 0x0000, 0x0000, 0x16cb, 0x2305, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4dd7, 0x0000, 0x0000, 0x11bd, 0x0000,
+	    0x0000, 0x2090, 0x0000, 0x0000, 0x0000, 0x1952, 0x41c8, 0x47e2,
+	    0x0000, 0x0000, 0x0000, 0x1b6d, 0x173a, 0x38ec, 0x3473, 0x0000,
+	    0x0000, 0x0000, 0x4108, 0x0000, 0x0000, 0x2eff, 0x477b, 0x18b4,
+	    0x0000, 0x0000, 0x0000, 0x30e7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1390, 0x49e7, 0x0000, 0x1b29, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x28c4, 0x0000, 0x0000, 0x36ca,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f77, 0x0000,
+	    0x464c, 0x0000, 0x0000, 0x08c2, 0x0000, 0x0000, 0x4632, 0x0000,
+	    0x1963, 0x0000, 0x179b, 0x0000, 0x0000, 0x0000, 0x0000, 0x2886,
+	    0x0000, 0x00a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c85, 0x0000,
+	    0x0f80, 0x1787, 0x2fb1, 0x0156, 0x1f69, 0x10b2, 0x44b0, 0x0000,
+	    0x0000, 0x1917, 0x0000, 0x139b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x17cf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x30b8, 0x0000, 0x0000, 0x0104, 0x0000, 0x41e1, 0x0000,
+	    0x40b4, 0x34a4, 0x0000, 0x0000, 0x3576, 0x4bd1, 0x0000, 0x3222,
+	    0x0000, 0x0e31, 0x0000, 0x4393, 0x0000, 0x4026, 0x0000, 0x0000,
+	    0x42c8, 0x43e3, 0x0000, 0x34c7, 0x3f06, 0x4d92, 0x41ad, 0x0000,
+	    0x2d67, 0x2f91, 0x02d4, 0x0000, 0x45ed, 0x1687, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0a1b, 0x0000, 0x49e1, 0x341a,
+	    0x0000, 0x0000, 0x0000, 0x1a25, 0x26fb, 0x4456, 0x06cc, 0x14b7,
+	    0x2733, 0x0482, 0x0000, 0x0f50, 0x24de, 0x4a08, 0x30d6, 0x0000,
+	    0x02f8, 0x3185, 0x0486, 0x3263, 0x2b0f, 0x0000, 0x373c, 0x230d,
+	    0x0000, 0x0000, 0x0000, 0x229f, 0x1cfd, 0x0881, 0x0000, 0x0000,
+	    0x0000, 0x14f2, 0x17a7, 0x4815, 0x0000, 0x032d, 0x0000, 0x03fe,
+	    0x49fd, 0x0000, 0x0000, 0x2d8f, 0x0000, 0x0000, 0x0000, 0x05e3,
+	    0x0000, 0x0000, 0x23d4, 0x1a2f, 0x0000, 0x075a, 0x0000, 0x0000,
+	    0x0000, 0x1ce4, 0x0000, 0x1862, 0x1a3c, 0x0000, 0x317f, 0x0bb5,
+	    0x0000, 0x0000, 0x3384, 0x0000, 0x1707, 0x0000, 0x0000, 0x1fc2,
+	    0x152d, 0x0000, 0x3b27, 0x3433, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x214d, 0x3209, 0x0000, 0x0d3b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0041, 0x0000, 0x0000, 0x37c0, 0x3e84, 0x0000,
+	    0x0000, 0x0000, 0x267d, 0x0000, 0x0000, 0x0ad5, 0x26e8, 0x0000,
+	    0x0000, 0x0000, 0x3f1d, 0x0000, 0x0000, 0x0000, 0x0c5e, 0x0000,
+	    0x24d7, 0x0000, 0x46ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3a2a, 0x0000, 0x0000, 0x2277, 0x41b1, 0x0000, 0x2f6f, 0x1803,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e46, 0x2966,
+	    0x3ad5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21e2, 0x1bd9,
+	    0x1585, 0x0000, 0x09bf, 0x0000, 0x0000, 0x0000, 0x0f3b, 0x0000,
+	    0x1bae, 0x0000, 0x0e5f, 0x16b1, 0x0000, 0x0d4b, 0x0000, 0x478e,
+	    0x0000, 0x238d, 0x491f, 0x0000, 0x0000, 0x17de, 0x0000, 0x0000,
+	    0x07f4, 0x4b58, 0x0000, 0x0000, 0x45d8, 0x0000, 0x0000, 0x1272,
+	    0x0000, 0x0000, 0x4dde, 0x2fb0, 0x0821, 0x32b3, 0x001f, 0x432f,
+	    0x1469, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3ade, 0x0000, 0x0000, 0x0000, 0x0000, 0x3491,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x47b5, 0x0000, 0x0000, 0x0000,
+	    0x22ba, 0x01d0, 0x22ea, 0x0000, 0x0000, 0x3a26, 0x149c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0b2f, 0x0000, 0x1fc0, 0x1876, 0x0000,
+	    0x0000, 0x0000, 0x36e8, 0x2d21, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4247, 0x0000, 0x3132, 0x19e8, 0x3913, 0x0000,
+	    0x0000, 0x0000, 0x3446, 0x2dfc, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2702, 0x335c, 0x0000, 0x3811, 0x36c6, 0x2389,
+	    0x3c22, 0x0000, 0x208c, 0x0000, 0x0000, 0x1860, 0x33f2, 0x3864,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a84, 0x0000, 0x02dd,
+	    0x0000, 0x0000, 0x347a, 0x0000, 0x1538, 0x25a8, 0x0000, 0x04a7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ff1,
+	    0x0000, 0x026e, 0x40d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x07db, 0x057e, 0x0000, 0x4b98, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1ca2, 0x0c09, 0x0000, 0x0000,
+	    0x1138, 0x26d7, 0x27e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ab7,
+	    0x4356, 0x0000, 0x0000, 0x2c66, 0x31ec, 0x2316, 0x4dec, 0x0045,
+	    0x0000, 0x3c3a, 0x0000, 0x0000, 0x3926, 0x0000, 0x14fa, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3036, 0x3287, 0x0ae5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3811, 0x0000, 0x38d7,
+	    0x0000, 0x3f15, 0x0000, 0x1a89, 0x314b, 0x0000, 0x3f57, 0x0000,
+	    0x0000, 0x0a07, 0x0000, 0x0000, 0x2cd0, 0x0c34, 0x46ac, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2e69, 0x4bff, 0x0000, 0x1ee5, 0x0000,
+	    0x0000, 0x0000, 0x3002, 0x0000, 0x345e, 0x0000, 0x0aea, 0x0000,
+	    0x4d87, 0x3bc0, 0x0000, 0x3238, 0x4322, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2e84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0e83, 0x0000, 0x0000, 0x1484, 0x0000, 0x07c1, 0x0000,
+	    0x0000, 0x1848, 0x0dde, 0x0000, 0x179c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0761, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3992,
+	    0x0000, 0x0000, 0x1be8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1d0d, 0x22e0, 0x2095, 0x2860,
+	    0x32b6, 0x316d, 0x0000, 0x0000, 0x3f77, 0x4833, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x32b4, 0x0000, 0x0000, 0x409d, 0x0844, 0x0000,
+	    0x0000, 0x0000, 0x2a36, 0x1d2e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x12b6, 0x3ef6, 0x0000, 0x0000, 0x0000, 0x0000, 0x438c, 0x32f4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4988, 0x24b2, 0x3a62, 0x1644,
+	    0x0000, 0x0000, 0x0000, 0x1e8a, 0x0000, 0x2822, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x141a, 0x0000, 0x0000, 0x16ad, 0x0000, 0x0000,
+	    0x0000, 0x34f3, 0x4495, 0x0000, 0x0000, 0x1ed5, 0x0000, 0x3aec,
+	    0x1b23, 0x0000, 0x319c, 0x25b2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x40a2, 0x03ef, 0x0000, 0x2113, 0x0000, 0x2c34, 0x0b39,
+	    0x41c1, 0x0000, 0x0000, 0x0000, 0x14b3, 0x0000, 0x148b, 0x0000,
+	    0x0000, 0x0000, 0x3835, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2509, 0x0000, 0x234e, 0x0000, 0x0000,
+	    0x0000, 0x2b12, 0x0000, 0x2ec6, 0x3ba5, 0x0000, 0x0000, 0x0dea,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0cc7, 0x0000, 0x27e9,
+	    0x1559, 0x0000, 0x0000, 0x472f, 0x0000, 0x0000, 0x49c5, 0x0000,
+	    0x0000, 0x0000, 0x4c82, 0x0000, 0x0000, 0x0000, 0x0000, 0x1230,
+	    0x0330, 0x3820, 0x3793, 0x39d6, 0x2289, 0x42fe, 0x43e8, 0x3179,
+	    0x0000, 0x2a90, 0x0000, 0x0000, 0x2f7f, 0x2ed4, 0x397b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x42a3, 0x473f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4356, 0x3d84, 0x2d53, 0x0000, 0x0000, 0x00ad,
+	    0x4953, 0x1e32, 0x0000, 0x0000, 0x4d80, 0x1860, 0x0000, 0x38f5,
+	    0x27c2, 0x2b9b, 0x027d, 0x0fb7, 0x3620, 0x37d5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3412, 0x0000, 0x126e, 0x3e0d, 0x0000, 0x30a3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4120, 0x0000, 0x406a,
+	    0x0000, 0x2d2f, 0x0000, 0x0000, 0x29dc, 0x1375, 0x0000, 0x47e0,
+	    0x1136, 0x4054, 0x03a2, 0x4af6, 0x0000, 0x01d8, 0x346b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c3d, 0x0b2b, 0x0f34,
+	    0x46bc, 0x3d68, 0x0000, 0x12cc, 0x0000, 0x0000, 0x02f4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2b28, 0x1943, 0x0301, 0x106e, 0x384b,
+	    0x06f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f06, 0x04c0, 0x0813,
+	    0x07c0, 0x0000, 0x0e8c, 0x3b1b, 0x2b5a, 0x08ec, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fbb, 0x0000, 0x359d,
+	    0x0000, 0x2b0e, 0x0000, 0x1064, 0x0000, 0x27d4, 0x0df1, 0x09af,
+	    0x2e57, 0x3ef1, 0x149f, 0x0000, 0x0000, 0x4b3b, 0x0000, 0x0000,
+	    0x14ac, 0x0000, 0x23e7, 0x0000, 0x4c99, 0x0000, 0x0000, 0x0000,
+	    0x0b41, 0x0000, 0x0000, 0x2989, 0x0000, 0x0000, 0x4d07, 0x0000,
+	    0x1e5b, 0x0f7a, 0x0000, 0x0a47, 0x0000, 0x4be8, 0x0000, 0x0000,
+	    0x007f, 0x47ff, 0x1632, 0x0000, 0x0000, 0x0000, 0x0000, 0x16ce,
+	    0x0000, 0x0000, 0x0000, 0x418e, 0x4377, 0x0000, 0x3f8c, 0x0000,
+	    0x19ab, 0x221b, 0x0000, 0x0000, 0x0000, 0x0000, 0x3490, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2c87, 0x0000, 0x0000, 0x0000, 0x24f4,
+	    0x0000, 0x0000, 0x114d, 0x04ac, 0x3362, 0x0000, 0x2020, 0x0000,
+	    0x0000, 0x0000, 0x1b21, 0x0000, 0x0000, 0x0000, 0x0000, 0x1112,
+	    0x2d2a, 0x0000, 0x0fa7, 0x0bd2, 0x0bcd, 0x0000, 0x3b7b, 0x0000,
+	    0x2976, 0x0000, 0x0000, 0x3f96, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1df4, 0x4985, 0x0000, 0x3bdc, 0x0000, 0x0000, 0x1f20, 0x1390,
+	    0x0000, 0x3049, 0x3ab6, 0x0000, 0x0000, 0x0b42, 0x0000, 0x0000,
+	    0x076e, 0x33c4, 0x0000, 0x0000, 0x0000, 0x18ad, 0x0000, 0x0000,
+	    0x0000, 0x2c0e, 0x45cc, 0x264c, 0x3e58, 0x0000, 0x0000, 0x0000,
+	    0x26ea, 0x091e, 0x0000, 0x0bfe, 0x0000, 0x0000, 0x0000, 0x0fe7,
+	    0x36fd, 0x0000, 0x0000, 0x0000, 0x0000, 0x15db, 0x0000, 0x3ff5,
+	    0x0000, 0x1340, 0x0000, 0x0000, 0x381b, 0x0000, 0x0000, 0x2a4f,
+	    0x0000, 0x0000, 0x457a, 0x1764, 0x0000, 0x2bdb, 0x0000, 0x4771,
+	    0x0000, 0x24dc, 0x0000, 0x0000, 0x2cd9, 0x0000, 0x2b96, 0x0000,
+	    0x3b94, 0x0000, 0x0000, 0x193f, 0x0000, 0x0000, 0x1f12, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4ab8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4ddc, 0x0000, 0x0000, 0x4a7a,
+	    0x053b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f4a, 0x12f4, 0x070a,
+	    0x437e, 0x4120, 0x493c, 0x41aa, 0x0957, 0x0000, 0x0000, 0x0000,
+	    0x36fc, 0x0000, 0x3c81, 0x0000, 0x0000, 0x1e3a, 0x0000, 0x34a8,
+	    0x1337, 0x4789, 0x1d8d, 0x2d52, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0f5e, 0x0000, 0x0000, 0x0000,
+	    0x1011, 0x0000, 0x0000, 0x0000, 0x0ee6, 0x0000, 0x0000, 0x334f,
+	    0x0000, 0x0000, 0x0000, 0x0c2e, 0x1133, 0x054c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x31cc, 0x0000, 0x2afc, 0x08f5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x493a, 0x0000, 0x0000, 0x4546,
+	    0x2c36, 0x0000, 0x1459, 0x0000, 0x3863, 0x0000, 0x014c, 0x0000,
+	    0x4305, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2833,
+	    0x0dcc, 0x0000, 0x1207, 0x4512, 0x1be2, 0x48e4, 0x1ea2, 0x3d3a,
+	    0x0000, 0x02b1, 0x438e, 0x0000, 0x0000, 0x0000, 0x49e9, 0x0000,
+	    0x0000, 0x1680, 0x0000, 0x0000, 0x3959, 0x0000, 0x42e8, 0x109f,
+	    0x0000, 0x0812, 0x4389, 0x4ca4, 0x2101, 0x3cd2, 0x0000, 0x0000,
+	    0x482e, 0x08e7, 0x0e86, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b98,
+	    0x0d10, 0x0000, 0x187e, 0x4b5d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2055, 0x4a99, 0x46c5, 0x0000, 0x12c6, 0x0000, 0x4273,
+	    0x0065, 0x16c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0389, 0x0000, 0x0000, 0x1954, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2d94, 0x4193, 0x36bd, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2bb4, 0x0000, 0x0000, 0x0000, 0x2d2e, 0x0000, 0x0000,
+	    0x4951, 0x0000, 0x0000, 0x490f, 0x0000, 0x4da1, 0x0000, 0x0000,
+	    0x2ed6, 0x0000, 0x48ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x42a1,
+	    0x4874, 0x0000, 0x0000, 0x0000, 0x1354, 0x0000, 0x0000, 0x2e9f,
+	    0x0000, 0x0000, 0x2e5a, 0x0000, 0x1571, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2b95, 0x0000, 0x0bf8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1e2e, 0x0000, 0x0000, 0x41b0, 0x0000,
+	    0x0000, 0x0000, 0x26ac, 0x4897, 0x339f, 0x0000, 0x409d, 0x0000,
+	    0x0000, 0x0000, 0x015e, 0x474a, 0x1a28, 0x0000, 0x0000, 0x0000,
+	    0x0dd4, 0x3be6, 0x4bde, 0x0000, 0x09d0, 0x36b3, 0x0000, 0x1af0,
+	    0x0000, 0x0abb, 0x0000, 0x0000, 0x492d, 0x0000, 0x475f, 0x0653,
+	    0x0000, 0x0000, 0x0190, 0x0000, 0x0000, 0x019e, 0x4755, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23b5, 0x0000,
+	    0x0000, 0x0000, 0x1b4e, 0x480f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x29d0, 0x0000, 0x0000, 0x36a2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0173, 0x3318, 0x0000, 0x0000, 0x00c1, 0x0000,
+	    0x18cf, 0x0000, 0x0000, 0x0000, 0x1c28, 0x0000, 0x0000, 0x0000,
+	    0x22a5, 0x1c0c, 0x0000, 0x0000, 0x367e, 0x4ddc, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1977, 0x0000, 0x0000, 0x3032, 0x0000,
+	    0x0000, 0x0000, 0x193a, 0x0000, 0x0000, 0x290a, 0x1607, 0x265d,
+	    0x0000, 0x0000, 0x0885, 0x1e9f, 0x2cb5, 0x2866, 0x0000, 0x4c05,
+	    0x37f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19a3, 0x158b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x07fc, 0x0000, 0x0000, 0x0399,
+	    0x0732, 0x488a, 0x0000, 0x0450, 0x1a25, 0x4650, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x26bc, 0x0000, 0x0000, 0x279e, 0x12f6,
+	    0x0000, 0x231d, 0x0000, 0x3330, 0x4d75, 0x3148, 0x4ce4, 0x0000,
+	    0x0000, 0x24ab, 0x34e1, 0x11e2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x35ad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23ce, 0x1b7a,
+	    0x0000, 0x0000, 0x0000, 0x12ad, 0x0000, 0x01aa, 0x0000, 0x0000,
+	    0x0000, 0x1de7, 0x3ddc, 0x0000, 0x1651, 0x0000, 0x0a18, 0x0000,
+	    0x0000, 0x46ec, 0x0000, 0x0000, 0x07ad, 0x46af, 0x0000, 0x0000,
+	    0x2a11, 0x0a23, 0x149a, 0x081d, 0x445c, 0x0000, 0x3207, 0x0000,
+	    0x1b5b, 0x087f, 0x0525, 0x0000, 0x0000, 0x4945, 0x24fb, 0x11e1,
+	    0x2216, 0x0000, 0x0000, 0x0000, 0x0000, 0x0731, 0x0000, 0x1cf8,
+	    0x0000, 0x3985, 0x0000, 0x0000, 0x2dcb, 0x0000, 0x0000, 0x0c23,
+	    0x4bb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4086, 0x0000, 0x0000, 0x464d, 0x0645, 0x0000, 0x0000, 0x2ae3,
+	    0x2eca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3afc,
+	    0x0000, 0x09f4, 0x0000, 0x3423, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3a11, 0x0000, 0x140a, 0x0000, 0x4897, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x062e, 0x3942, 0x090f,
+	    0x0000, 0x0000, 0x16bf, 0x36ef, 0x0000, 0x16ea, 0x0000, 0x3d3e,
+	    0x0000, 0x0000, 0x24e2, 0x0000, 0x377e, 0x0000, 0x0000, 0x19c7,
+	    0x0000, 0x0777, 0x0000, 0x0b76, 0x090d, 0x0000, 0x34bd, 0x0000,
+	    0x0971, 0x0000, 0x0000, 0x0000, 0x0000, 0x4848, 0x0000, 0x0000,
+	    0x01bc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c28, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1c68, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3b24, 0x07b6, 0x2753, 0x0000, 0x0000, 0x232d, 0x3d77, 0x455d,
+	    0x0000, 0x0000, 0x0000, 0x33c8, 0x0000, 0x4d22, 0x0000, 0x0000,
+	    0x0000, 0x1cd7, 0x48be, 0x423e, 0x0000, 0x0000, 0x402a, 0x347a,
+	    0x0000, 0x4096, 0x0bce, 0x0000, 0x01e2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x062b, 0x3521, 0x0548, 0x01e9, 0x0000, 0x0000, 0x18ab,
+	    0x42d4, 0x0000, 0x0000, 0x2779, 0x0000, 0x0000, 0x0527, 0x0000,
+	    0x0ed0, 0x0000, 0x0000, 0x0000, 0x3004, 0x0000, 0x0b5e, 0x0000,
+	    0x0000, 0x015e, 0x0000, 0x0000, 0x2a8e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3473, 0x0000, 0x0000, 0x1029,
+	    0x0000, 0x0000, 0x0000, 0x3590, 0x0000, 0x0000, 0x0000, 0x38cf,
+	    0x3eaa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4e1d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e9f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e9e, 0x0000, 0x0000, 0x2ce2, 0x0000, 0x0000,
+	    0x00b3, 0x33cc, 0x0000, 0x0000, 0x09db, 0x0000, 0x0000, 0x0000,
+	    0x0e20, 0x2f66, 0x0000, 0x0000, 0x46b1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3fc6, 0x00f4, 0x0000, 0x0000, 0x37c1, 0x0000, 0x0000,
+	    0x0a2e, 0x0000, 0x0000, 0x2c39, 0x4136, 0x0000, 0x0000, 0x2314,
+	    0x27f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x36df, 0x3db2, 0x0000, 0x0000, 0x44c1, 0x3bb5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e48, 0x0000, 0x1e47, 0x0000, 0x4881, 0x0000,
+	    0x48b7, 0x48ca, 0x0000, 0x0000, 0x0000, 0x2cbf, 0x0000, 0x4931,
+	    0x0000, 0x0000, 0x0000, 0x431e, 0x0000, 0x0000, 0x1702, 0x0000,
+	    0x0000, 0x1c74, 0x0347, 0x0000, 0x3743, 0x0000, 0x39d4, 0x0000,
+	    0x0000, 0x0000, 0x2a0e, 0x0000, 0x2574, 0x0000, 0x0000, 0x06f6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e34, 0x0000, 0x0000, 0x1ce0,
+	    0x212d, 0x0000, 0x0000, 0x0000, 0x3708, 0x1d3d, 0x1051, 0x3e38,
+	    0x0000, 0x3939, 0x405d, 0x0000, 0x0000, 0x3e70, 0x0075, 0x2c8a,
+	    0x40ca, 0x0000, 0x0000, 0x1bc0, 0x27ae, 0x0000, 0x088d, 0x0000,
+	    0x305b, 0x0000, 0x0000, 0x0be6, 0x0000, 0x1439, 0x0000, 0x0000,
+	    0x0000, 0x1589, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0f3e, 0x0000, 0x0000, 0x0000, 0x47e0, 0x49bc, 0x206c, 0x0000,
+	    0x133e, 0x16de, 0x0000, 0x0000, 0x1134, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01be, 0x3a94, 0x0000, 0x0000, 0x3e73,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2ca3, 0x49b7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x07d8, 0x0000, 0x0000, 0x2aa1, 0x0e83, 0x0000,
+	    0x157c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3558,
+	    0x0000, 0x0000, 0x27d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x23fe, 0x0000, 0x2986, 0x0bed, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2533, 0x1da4, 0x115f,
+	    0x0000, 0x0000, 0x15ff, 0x4108, 0x11cc, 0x2ed4, 0x0000, 0x0000,
+	    0x05e5, 0x2dcc, 0x0000, 0x145f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4b12, 0x0000, 0x1cec, 0x0000, 0x0000,
+	    0x3054, 0x3c08, 0x0000, 0x1948, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0e13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f39, 0x0cbc,
+	    0x424d, 0x0000, 0x0b2e, 0x0000, 0x0000, 0x0000, 0x0000, 0x353c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0f05, 0x0000, 0x0000, 0x3dfb,
+	    0x0000, 0x0000, 0x482e, 0x0000, 0x4582, 0x0222, 0x172a, 0x2ccd,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3a29, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4ab2, 0x00d6, 0x0000, 0x0000, 0x0000, 0x4438,
+	    0x2f94, 0x0000, 0x0000, 0x0000, 0x0000, 0x11c8, 0x0000, 0x259d,
+	    0x0b0b, 0x408e, 0x0000, 0x0000, 0x06a2, 0x0000, 0x2f23, 0x2162,
+	    0x22eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d79, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x450c, 0x0000, 0x236a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4182, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2095, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1b62, 0x3428, 0x0000, 0x0851, 0x1294, 0x0000,
+	    0x2fd3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2320, 0x0000, 0x0000, 0x255c, 0x0000, 0x0000, 0x0eb1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1691, 0x0000, 0x0000, 0x0000,
+	    0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x13cb, 0x0000, 0x2d30, 0x4c4d,
+	    0x0000, 0x2ae4, 0x4603, 0x0000, 0x0000, 0x159c, 0x259a, 0x0000,
+	    0x394c, 0x4dd3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x30fa, 0x2000, 0x4446, 0x2c63, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0724, 0x0000, 0x0000, 0x0000, 0x0000, 0x47cf, 0x0000,
+	    0x0000, 0x0000, 0x1292, 0x0000, 0x0000, 0x1aa9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1471, 0x0000, 0x1013, 0x0000, 0x0000, 0x0000,
+	    0x4168, 0x1e03, 0x0000, 0x0000, 0x0000, 0x0a29, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12ef, 0x0000, 0x26f2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3927, 0x4d90, 0x0000,
+	    0x3d2f, 0x0000, 0x0000, 0x0d28, 0x18b1, 0x0000, 0x0000, 0x0000,
+	    0x29e4, 0x0000, 0x1323, 0x3973, 0x0000, 0x1cfc, 0x3a4a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x28d6, 0x0000, 0x286d, 0x0000, 0x0000,
+	    0x09ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x45fb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2950, 0x0000, 0x4ddf, 0x30ce, 0x02e4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1c41, 0x0000, 0x2294, 0x03da, 0x0000, 0x0000,
+	    0x23a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f7d, 0x31c8, 0x0543,
+	    0x45ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x261c, 0x2c8f, 0x0000,
+	    0x06d4, 0x025c, 0x0000, 0x0000, 0x0000, 0x3266, 0x0000, 0x0000,
+	    0x1730, 0x0000, 0x3940, 0x0c59, 0x0000, 0x2f0f, 0x0000, 0x1d97,
+	    0x01bc, 0x416f, 0x0000, 0x21e9, 0x0796, 0x0000, 0x0000, 0x07ef,
+	    0x163a, 0x34d4, 0x47a9, 0x42b0, 0x0000, 0x0000, 0x0000, 0x1432,
+	    0x2fa5, 0x146a, 0x0b75, 0x10f1, 0x0000, 0x0000, 0x0000, 0x476a,
+	    0x0083, 0x0e4d, 0x0000, 0x09b8, 0x2ccc, 0x0000, 0x0000, 0x2a86,
+	    0x49ed, 0x0000, 0x157c, 0x480f, 0x0000, 0x0000, 0x48d6, 0x0000,
+	    0x0000, 0x2c99, 0x2d6e, 0x0000, 0x33bb, 0x0000, 0x0000, 0x10ee,
+	    0x0000, 0x0000, 0x0eb5, 0x0000, 0x0000, 0x0000, 0x1f13, 0x3d7f,
+	    0x3729, 0x36a1, 0x0000, 0x2218, 0x48f0, 0x0000, 0x0f42, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1e2a, 0x0000, 0x1f33, 0x0000,
+	    0x1b05, 0x0000, 0x0000, 0x0000, 0x2096, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f0a, 0x392d, 0x0000,
+	    0x15ff, 0x48fb, 0x0000, 0x0000, 0x1987, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x266d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3d3f, 0x0000, 0x0000, 0x0000, 0x12fe, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x328c, 0x0000, 0x0000,
+	    0x0c7f, 0x20f9, 0x0000, 0x0000, 0x0000, 0x4033, 0x0000, 0x2a53,
+	    0x0000, 0x0000, 0x3a17, 0x0000, 0x0000, 0x0000, 0x38d8, 0x3be0,
+	    0x46c1, 0x0000, 0x0000, 0x2e7f, 0x3e8e, 0x1f17, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x34c1, 0x0000, 0x0000, 0x0000, 0x0446,
+	    0x2e45, 0x0000, 0x3fd7, 0x0000, 0x0000, 0x2efe, 0x0000, 0x47a9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0773, 0x00ba,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a01, 0x3141,
+	    0x0000, 0x0000, 0x0182, 0x0000, 0x3e2e, 0x0000, 0x0000, 0x3fbb,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fda,
+	    0x0000, 0x2401, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3836, 0x0000, 0x3883, 0x1869, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x313b, 0x32a0, 0x395c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4d4e, 0x10d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4974, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0c38, 0x0000, 0x4c74, 0x0000, 0x12a7, 0x0000, 0x0000, 0x1ba6,
+	    0x0000, 0x0000, 0x0000, 0x2c3f, 0x0000, 0x0000, 0x0000, 0x499b,
+	    0x0000, 0x0000, 0x45d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0eba,
+	    0x2f9d, 0x4de8, 0x0000, 0x0000, 0x0000, 0x0000, 0x2bd4, 0x0000,
+	    0x0000, 0x1e0a, 0x0000, 0x17ed, 0x309d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fc3, 0x2102,
+	    0x1022, 0x4364, 0x0d2c, 0x0000, 0x0000, 0x0000, 0x0437, 0x0000,
+	    0x1e58, 0x176f, 0x019c, 0x0000, 0x2db9, 0x34f0, 0x1803, 0x403d,
+	    0x0000, 0x1829, 0x2984, 0x0000, 0x0000, 0x0ce5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x15e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x237e, 0x0000, 0x20e1, 0x4df2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3c3a, 0x0d9a, 0x0000, 0x0000, 0x0000, 0x491a, 0x0000, 0x0000,
+	    0x211e, 0x0434, 0x0000, 0x0000, 0x0000, 0x297c, 0x06e0, 0x0000,
+	    0x1119, 0x43b2, 0x3b4d, 0x0000, 0x0fa0, 0x3c39, 0x0000, 0x0000,
+	    0x0000, 0x4d40, 0x0000, 0x2901, 0x0000, 0x0000, 0x0000, 0x2701,
+	    0x0000, 0x1b9c, 0x0000, 0x4671, 0x3b86, 0x4483, 0x0000, 0x3b8f,
+	    0x12ed, 0x0000, 0x0000, 0x074a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0fbe, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1597, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0196, 0x0000, 0x0000, 0x4b9f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2916, 0x0000, 0x4085, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4a1d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3dc4,
+	    0x0000, 0x4800, 0x0000, 0x117a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0536, 0x2af8, 0x0000, 0x0000, 0x26a4, 0x02c0,
+	    0x0528, 0x4202, 0x0000, 0x0000, 0x0000, 0x348c, 0x04e2, 0x150e,
+	    0x0000, 0x4b9b, 0x0000, 0x1627, 0x09c4, 0x00e0, 0x0000, 0x0000,
+	    0x385d, 0x4325, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe,
+	    0x120b, 0x0000, 0x46e9, 0x0547, 0x3b4b, 0x1180, 0x0000, 0x2097,
+	    0x0000, 0x0000, 0x4020, 0x0000, 0x22b3, 0x1f2d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x33eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c93, 0x496b, 0x3c2b,
+	    0x0000, 0x0000, 0x4c53, 0x32ad, 0x4272, 0x0ad2, 0x0000, 0x0000,
+	    0x0000, 0x48f4, 0x2a4b, 0x4dca, 0x4df6, 0x0000, 0x0000, 0x4317,
+	    0x0000, 0x0000, 0x0000, 0x40dd, 0x3973, 0x020e, 0x0000, 0x0000,
+	    0x0000, 0x21ef, 0x249a, 0x0000, 0x0000, 0x1072, 0x0000, 0x0000,
+	    0x4416, 0x2e2d, 0x0000, 0x138c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x084d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dcd,
+	    0x0000, 0x0108, 0x4d26, 0x2f89, 0x35d7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ef9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4bb6, 0x0dec, 0x0000, 0x0000, 0x222e,
+	    0x273e, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1802, 0x2df4, 0x0000, 0x077e, 0x0000, 0x0000,
+	    0x4636, 0x0168, 0x0000, 0x0000, 0x0d3e, 0x22bd, 0x0000, 0x0000,
+	    0x2cd1, 0x0000, 0x1cc3, 0x0000, 0x0000, 0x1a9e, 0x31e4, 0x0000,
+	    0x0000, 0x0000, 0x42be, 0x4191, 0x0000, 0x16db, 0x326b, 0x0000,
+	    0x4e1d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x309a, 0x0000,
+	    0x0000, 0x2d4b, 0x1ce7, 0x0000, 0x3b6e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x13e0, 0x3a9b, 0x0000, 0x3b82, 0x0000, 0x40d1,
+	    0x3e40, 0x0000, 0x0000, 0x0000, 0x13cc, 0x0000, 0x3598, 0x3946,
+	    0x0c92, 0x39e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1b42, 0x0000, 0x0000, 0x0000, 0x0ba0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x334b, 0x0000, 0x0000, 0x3213, 0x0000, 0x304e, 0x0000,
+	    0x1dc7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x346b,
+	    0x0000, 0x0000, 0x148b, 0x4a92, 0x0000, 0x0000, 0x0000, 0x0009,
+	    0x0000, 0x298c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1bf8, 0x4d75, 0x47b6, 0x1a15, 0x0000, 0x0000, 0x0000, 0x43c3,
+	    0x2b3e, 0x0000, 0x24f7, 0x4c59, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x49e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0da6, 0x0000, 0x320d, 0x2bd2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x018b, 0x0000,
+	    0x0000, 0x04c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d9c, 0x0000,
+	    0x021b, 0x24b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34f3,
+	    0x0000, 0x1633, 0x0000, 0x0000, 0x0000, 0x125f, 0x1787, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0da9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0a2d, 0x43bc, 0x0000, 0x198f,
+	    0x0000, 0x3ba0, 0x0000, 0x3380, 0x2080, 0x0000, 0x36f3, 0x0000,
+	    0x0cdc, 0x15c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0911,
+	    0x0000, 0x07ae, 0x10bd, 0x0000, 0x0000, 0x0000, 0x2580, 0x0000,
+	    0x4679, 0x0000, 0x0000, 0x2fd4, 0x0000, 0x0000, 0x0000, 0x29ed,
+	    0x012e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1454, 0x2ce3,
+	    0x0a2d, 0x190b, 0x1ab2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b86,
+	    0x0a44, 0x0000, 0x15fd, 0x0000, 0x2b10, 0x2ab2, 0x409b, 0x0000,
+	    0x0000, 0x3e50, 0x0000, 0x0000, 0x0fb2, 0x0000, 0x2729, 0x0000,
+	    0x0000, 0x1d2b, 0x37a8, 0x0000, 0x0000, 0x0000, 0x3113, 0x08dc,
+	    0x0000, 0x0000, 0x4db0, 0x3c11, 0x0729, 0x2854, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0c94, 0x42ef, 0x0fe0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x332c, 0x0000, 0x0000, 0x0000,
+	    0x42ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e6a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b08, 0x0000,
+	    0x0000, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c8a, 0x2e10,
+	    0x18c1, 0x481a, 0x0000, 0x0000, 0x0000, 0x35fe, 0x1139, 0x0910,
+	    0x33fc, 0x0468, 0x1ecf, 0x2837, 0x327b, 0x0000, 0x2bd0, 0x1568,
+	    0x0000, 0x0000, 0x4760, 0x00d9, 0x3878, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x33d2, 0x16ad, 0x058d, 0x0000, 0x0000,
+	    0x0d52, 0x1d4e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0454, 0x0000,
+	    0x0462, 0x433d, 0x0000, 0x0000, 0x2dd6, 0x0000, 0x0000, 0x092a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2856, 0x0000, 0x0000, 0x0951, 0x0000, 0x0000, 0x4418, 0x39da,
+	    0x0000, 0x1ef8, 0x0000, 0x3a90, 0x1e3f, 0x0000, 0x489e, 0x3b90,
+	    0x4431, 0x1890, 0x1db6, 0x3863, 0x0000, 0x4128, 0x4625, 0x0def,
+	    0x0000, 0x0000, 0x2789, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x12b0, 0x0000, 0x01d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3936, 0x0000, 0x4262, 0x2d81, 0x40a7, 0x0000, 0x0000,
+	    0x0000, 0x32c3, 0x0000, 0x38a5, 0x30f3, 0x0000, 0x48e9, 0x0000,
+	    0x0a33, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01bb,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0622, 0x0000, 0x0000,
+	    0x47c1, 0x0000, 0x3995, 0x0573, 0x3348, 0x0000, 0x0000, 0x0000,
+	    0x08eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x14ba, 0x0000, 0x4014, 0x13c9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x47a2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x39d5, 0x32de, 0x0000, 0x3a88, 0x4400,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1803, 0x0000,
+	    0x0000, 0x0000, 0x2832, 0x0000, 0x1e44, 0x42bc, 0x0000, 0x0000,
+	    0x369f, 0x0000, 0x4808, 0x0000, 0x0000, 0x0000, 0x0000, 0x04ef,
+	    0x0000, 0x0000, 0x2149, 0x3073, 0x0000, 0x3f7a, 0x0000, 0x002c,
+	    0x0000, 0x3f3e, 0x3624, 0x1afa, 0x04ab, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2e98, 0x4319, 0x421f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x24c0, 0x0000, 0x0000, 0x0000, 0x374f, 0x0000, 0x0000, 0x0000,
+	    0x3660, 0x0000, 0x00a3, 0x266b, 0x477f, 0x0000, 0x440b, 0x0000,
+	    0x32de, 0x1205, 0x0000, 0x2197, 0x48aa, 0x3f79, 0x0000, 0x0000,
+	    0x0000, 0x2841, 0x0468, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x22f4, 0x0000, 0x18d2, 0x0000, 0x0000, 0x0d95, 0x0000, 0x0000,
+	    0x0000, 0x4c29, 0x0000, 0x0000, 0x1713, 0x0000, 0x0000, 0x1212,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c4f,
+	    0x3be8, 0x092d, 0x0000, 0x0000, 0x4de2, 0x0b6e, 0x29ff, 0x1425,
+	    0x41fe, 0x1008, 0x2aba, 0x0000, 0x0000, 0x487a, 0x0000, 0x0000,
+	    0x09a2, 0x0000, 0x28c0, 0x2207, 0x0000, 0x2ec1, 0x0000, 0x42eb,
+	    0x2603, 0x13ca, 0x03e5, 0x0000, 0x07c7, 0x4c18, 0x0000, 0x0000,
+	    0x0000, 0x357c, 0x0000, 0x4148, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x06c7, 0x0000, 0x0000, 0x0000, 0x1d6d, 0x0000, 0x0b2f, 0x0000,
+	    0x0000, 0x0ec5, 0x260c, 0x03eb, 0x061a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3976, 0x2f5c, 0x39ef, 0x0000, 0x402e,
+	    0x0000, 0x2f9c, 0x1ff5, 0x0000, 0x1490, 0x21ce, 0x0000, 0x0000,
+	    0x0000, 0x0bbe, 0x0000, 0x0000, 0x23d6, 0x22c3, 0x1356, 0x0040,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4c2b, 0x1333, 0x0000, 0x4bcd,
+	    0x0000, 0x214e, 0x228b, 0x0000, 0x0000, 0x0000, 0x0000, 0x14b9,
+	    0x0000, 0x0000, 0x2c57, 0x2ff0, 0x0000, 0x0000, 0x4716, 0x0000,
+	    0x26df, 0x0000, 0x0000, 0x2429, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x29f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x464c,
+	    0x0000, 0x0000, 0x0000, 0x1632, 0x0000, 0x0000, 0x0000, 0x3b01,
+	    0x03fc, 0x424b, 0x15d1, 0x3f6e, 0x2df6, 0x0000, 0x0000, 0x4c25,
+	    0x0000, 0x0552, 0x0000, 0x3882, 0x0000, 0x2ad2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x0000, 0x14c2, 0x0000,
+	    0x0000, 0x1df0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3778, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fe2,
+	    0x0000, 0x0000, 0x3931, 0x112c, 0x0000, 0x30f7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2f7f, 0x0000, 0x0000, 0x4a79, 0x0000, 0x0000,
+	    0x1d76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f4c,
+	    0x0000, 0x314e, 0x0000, 0x0000, 0x3c2b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0f68, 0x225c, 0x0000, 0x0000, 0x0000, 0x0000, 0x12e2,
+	    0x0000, 0x034d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2dcc, 0x0000, 0x1727, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3b8b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4575, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0556,
+	    0x2ea3, 0x0000, 0x3e1e, 0x0000, 0x2a18, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3d5d, 0x155f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0cdb, 0x39e1, 0x0000, 0x3061, 0x0000, 0x0567, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f22,
+	    0x1f00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x28d1, 0x0000, 0x443f, 0x0000, 0x00c5, 0x0b44, 0x0000, 0x2e68,
+	    0x0000, 0x0000, 0x0000, 0x09da, 0x0000, 0x0000, 0x0443, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1bf1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0ec8, 0x0000, 0x0010, 0x0000, 0x34c2, 0x0000, 0x0000,
+	    0x3b2b, 0x4643, 0x33e0, 0x0000, 0x0000, 0x0000, 0x24ed, 0x2d18,
+	    0x0000, 0x0000, 0x36d0, 0x0000, 0x21ca, 0x0000, 0x0000, 0x1228,
+	    0x0000, 0x0000, 0x3d95, 0x0000, 0x058f, 0x0000, 0x32e4, 0x0000,
+	    0x0000, 0x14c5, 0x099e, 0x0000, 0x0000, 0x0000, 0x436b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2ecf, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x39ac, 0x0000, 0x1013, 0x13fc,
+	    0x3a7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0cc1, 0x05f7, 0x0000, 0x0477, 0x19d1,
+	    0x0000, 0x3633, 0x0000, 0x2b51, 0x0000, 0x0f0e, 0x1bf7, 0x0000,
+	    0x17f2, 0x0b6a, 0x0000, 0x0c22, 0x0000, 0x3dc0, 0x1f1b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x206d, 0x0000, 0x0000, 0x1f31, 0x0000,
+	    0x435a, 0x0000, 0x0000, 0x0000, 0x0000, 0x1170, 0x4bb2, 0x0000,
+	    0x2a73, 0x1612, 0x0792, 0x0a56, 0x0000, 0x0000, 0x0000, 0x1219,
+	    0x44fa, 0x2f01, 0x0000, 0x0000, 0x4474, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3c4a, 0x0000, 0x0000, 0x3609, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x12fd, 0x0000, 0x04a5, 0x0000, 0x3d7a,
+	    0x0000, 0x382c, 0x0000, 0x0000, 0x0000, 0x0000, 0x034c, 0x0860,
+	    0x0000, 0x0000, 0x0b25, 0x4afb, 0x155c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x228b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3eaf, 0x2c56, 0x1a3c, 0x0000, 0x068f, 0x2c93, 0x0000, 0x1c9d,
+	    0x3776, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01d9, 0x0000, 0x4aa3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3e4f, 0x3190, 0x0000, 0x0000, 0x3231, 0x0000, 0x0000,
+	    0x0000, 0x1433, 0x0000, 0x10eb, 0x0000, 0x0000, 0x0000, 0x0593,
+	    0x0000, 0x0906, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d19, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b05, 0x4201, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x136a, 0x0000, 0x0000, 0x0000, 0x4e18,
+	    0x0000, 0x3aa8, 0x34fa, 0x09fc, 0x0000, 0x0fc5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4bfd, 0x449f, 0x4668, 0x0000,
+	    0x3d05, 0x0000, 0x0000, 0x3b4a, 0x3cf0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4de9, 0x0000, 0x0000, 0x25b4, 0x2668,
+	    0x3ee7, 0x0000, 0x06e1, 0x0000, 0x4ce6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2614, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x12be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x43ff,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2915, 0x0000,
+	    0x00fd, 0x4785, 0x0000, 0x0000, 0x0000, 0x46a9, 0x3eac, 0x0000,
+	    0x1433, 0x0000, 0x0000, 0x0000, 0x3879, 0x281a, 0x38ba, 0x0000,
+	    0x028b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f7a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x181f, 0x0000, 0x0000, 0x0000,
+	    0x2a07, 0x35d4, 0x0000, 0x41b7, 0x0000, 0x3f34, 0x0000, 0x38de,
+	    0x0000, 0x03bf, 0x47f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4baa, 0x0000, 0x0000, 0x0f2e, 0x3d15, 0x21ca,
+	    0x11bb, 0x40f6, 0x0000, 0x0000, 0x2512, 0x290e, 0x1623, 0x4943,
+	    0x0000, 0x1ddb, 0x0ef5, 0x0d4e, 0x0000, 0x0d81, 0x2471, 0x0000,
+	    0x252b, 0x0000, 0x0000, 0x0000, 0x1b99, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0c2f, 0x0000, 0x0000, 0x1edc, 0x0000, 0x056d, 0x0000, 0x0000,
+	    0x2d0f, 0x0000, 0x3db1, 0x1104, 0x0000, 0x0c91, 0x0000, 0x1469,
+	    0x0000, 0x1019, 0x0000, 0x0000, 0x0000, 0x0000, 0x405a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2ea5, 0x0000, 0x0000, 0x213e, 0x0be6,
+	    0x0000, 0x076f, 0x3c1e, 0x4c7e, 0x28ef, 0x0000, 0x3b53, 0x4d45,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2adb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2f3b, 0x0000, 0x31f7, 0x0000, 0x05d5,
+	    0x0000, 0x04a5, 0x0000, 0x4b4f, 0x0000, 0x0000, 0x0000, 0x078c,
+	    0x0000, 0x299c, 0x0000, 0x0000, 0x3fc7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x29d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2ae0, 0x0da8, 0x2b32, 0x0000, 0x25e3, 0x0000, 0x4ab8,
+	    0x2f80, 0x177b, 0x0000, 0x0595, 0x1a70, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2d09, 0x0000, 0x297c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2d30, 0x07ca, 0x0000, 0x0000, 0x03ab, 0x0000,
+	    0x14db, 0x0000, 0x0e9c, 0x469b, 0x2517, 0x1766, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x154c, 0x2252, 0x0000, 0x37ec, 0x0000, 0x0000,
+	    0x2d24, 0x34db, 0x0000, 0x30c7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x36b6, 0x3129, 0x0a66, 0x0000, 0x0000, 0x0000, 0x2b24, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3fde, 0x0000, 0x1f40, 0x0000,
+	    0x0000, 0x0000, 0x2553, 0x2025, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x226e, 0x2135, 0x2440, 0x3eb2, 0x0000,
+	    0x36ed, 0x0000, 0x0000, 0x0794, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3abf, 0x0faa, 0x0c68, 0x0000, 0x13d8,
+	    0x2664, 0x0000, 0x0000, 0x3663, 0x0000, 0x1cd8, 0x0000, 0x0000,
+	    0x1ea2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28e6,
+	    0x4409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2917,
+	    0x0000, 0x0000, 0x0557, 0x0000, 0x0000, 0x4ade, 0x2184, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24de, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0b4b, 0x0000, 0x0000, 0x0000, 0x343e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4db6, 0x21f8, 0x0000, 0x3e7a, 0x0000, 0x25c9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0446, 0x00f3, 0x0000,
+	    0x0000, 0x43ac, 0x0000, 0x3f14, 0x0000, 0x302f, 0x3400, 0x0000,
+	    0x485e, 0x0000, 0x0a6d, 0x0000, 0x3c07, 0x0000, 0x0019, 0x0000,
+	    0x0000, 0x4223, 0x0000, 0x3896, 0x1376, 0x0000, 0x1c48, 0x35e6,
+	    0x0000, 0x0000, 0x019b, 0x0000, 0x0000, 0x0000, 0x35ff, 0x0000,
+	    0x357d, 0x0000, 0x0000, 0x3a6b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x49ce, 0x0000, 0x3da2, 0x0000, 0x0054,
+	    0x0000, 0x0000, 0x0000, 0x31d8, 0x12b9, 0x42dd, 0x0000, 0x371c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25a4, 0x0000,
+	    0x0000, 0x1100, 0x43ff, 0x3eff, 0x363c, 0x0000, 0x13d1, 0x0000,
+	    0x4bbf, 0x0000, 0x06cb, 0x0000, 0x4d51, 0x4be5, 0x0300, 0x3d71,
+	    0x3d60, 0x3a30, 0x0000, 0x0000, 0x463e, 0x435f, 0x0000, 0x0d75,
+	    0x0000, 0x0000, 0x42ac, 0x0000, 0x07c4, 0x0000, 0x0000, 0x3efd,
+	    0x0000, 0x0000, 0x0000, 0x07bb, 0x0000, 0x0000, 0x2c9d, 0x13c3,
+	    0x32dd, 0x38b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3f37, 0x0000, 0x0000, 0x0000, 0x39a0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x44ec, 0x0000, 0x3a75, 0x0000,
+	    0x0000, 0x0000, 0x4417, 0x3ff3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1c70, 0x0000, 0x056a, 0x18f0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3393, 0x0000, 0x0000, 0x0000, 0x2775, 0x4a5d, 0x30e6,
+	    0x0000, 0x0000, 0x340b, 0x0031, 0x0000, 0x2606, 0x0000, 0x0000,
+	    0x474a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f6c, 0x0000, 0x0000,
+	    0x0000, 0x10f7, 0x0f31, 0x00a8, 0x4536, 0x284d, 0x0000, 0x0000,
+	    0x0ed6, 0x0000, 0x0000, 0x1f78, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x452c, 0x0000, 0x0000, 0x0f05, 0x0000, 0x0b92,
+	    0x2e0b, 0x36d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b1c, 0x258c,
+	    0x0000, 0x29ce, 0x0000, 0x0000, 0x3cf8, 0x0000, 0x4dac, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x40fa, 0x0000, 0x0000, 0x19e3,
+	    0x4b05, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1c0c, 0x2f1e, 0x0000, 0x0000, 0x3c83, 0x0000, 0x0000, 0x0000,
+	    0x1894, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000, 0x4036, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0629, 0x16d6, 0x0664, 0x0000, 0x0000,
+	    0x03c7, 0x0a2b, 0x0000, 0x102f, 0x0000, 0x21dd, 0x0888, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26c6, 0x1e9c, 0x0000,
+	    0x0000, 0x0072, 0x0000, 0x46a0, 0x0000, 0x0000, 0x30a3, 0x2be2,
+	    0x0000, 0x0000, 0x4ab1, 0x0000, 0x0000, 0x094a, 0x20ef, 0x0000,
+	    0x0000, 0x0000, 0x11a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x215a,
+	    0x0000, 0x0000, 0x3a06, 0x0435, 0x0825, 0x28d7, 0x0000, 0x0000,
+	    0x0000, 0x0f56, 0x0fc4, 0x2a6b, 0x20ce, 0x0000, 0x0000, 0x0000,
+	    0x4ccc, 0x001c, 0x0000, 0x4d83, 0x45d1, 0x0000, 0x0a38, 0x0215,
+	    0x0000, 0x3178, 0x0000, 0x1b7b, 0x0000, 0x10e0, 0x0000, 0x4081,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x196d, 0x394d, 0x0000, 0x1fbf,
+	    0x25d1, 0x0000, 0x0000, 0x0000, 0x4cf6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x32ae, 0x0000, 0x0000, 0x0000, 0x0354, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x49d6, 0x2314, 0x1b7c, 0x0000, 0x0000, 0x0000,
+	    0x4851, 0x0000, 0x0000, 0x0c0e, 0x21b3, 0x2379, 0x0000, 0x0000,
+	    0x0000, 0x3c79, 0x0816, 0x0000, 0x0000, 0x0000, 0x0000, 0x0142,
+	    0x1bf5, 0x0000, 0x184c, 0x0000, 0x342a, 0x0000, 0x3d11, 0x0000,
+	    0x0000, 0x0000, 0x0b93, 0x4bae, 0x0000, 0x0667, 0x0000, 0x2482,
+	    0x3885, 0x0000, 0x0000, 0x0000, 0x0000, 0x2ac2, 0x07ad, 0x0000,
+	    0x4865, 0x0000, 0x0000, 0x1841, 0x0000, 0x3fa6, 0x3a42, 0x0000,
+	    0x1576, 0x035a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x150f, 0x3ae3, 0x0000, 0x0000, 0x0000, 0x0000, 0x151a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1450,
+	    0x0000, 0x06a2, 0x47e4, 0x1d24, 0x0000, 0x0000, 0x4c08, 0x2bbc,
+	    0x0000, 0x0000, 0x0ff2, 0x118d, 0x4287, 0x0000, 0x0f65, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0392, 0x0000,
+	    0x27df, 0x4554, 0x0000, 0x2f2d, 0x0000, 0x0000, 0x22e0, 0x22a6,
+	    0x45ed, 0x21f3, 0x0000, 0x19e9, 0x047a, 0x0000, 0x0000, 0x44e2,
+	    0x363c, 0x14e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x12f8, 0x2ec7,
+	    0x1e6a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2097, 0x24aa,
+	    0x0000, 0x0000, 0x06f7, 0x0000, 0x0000, 0x455e, 0x0000, 0x0000,
+	    0x3bbc, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b65, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0a85, 0x4024, 0x0000, 0x0000, 0x125a, 0x0000,
+	    0x0000, 0x0000, 0x3cbf, 0x0000, 0x0000, 0x1d4e, 0x0000, 0x18b8,
+	    0x442a, 0x0000, 0x36b0, 0x0000, 0x46b0, 0x0000, 0x0000, 0x2365,
+	    0x0000, 0x0000, 0x36b9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2e9b, 0x4d92, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34a2, 0x31a1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0d5c, 0x0000, 0x34d4, 0x0000,
+	    0x0000, 0x0000, 0x3efa, 0x0000, 0x0000, 0x110b, 0x0000, 0x0000,
+	    0x0000, 0x40d6, 0x34ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3eca, 0x2218, 0x0000, 0x0000, 0x0bbb,
+	    0x4c54, 0x11ff, 0x0000, 0x0000, 0x0000, 0x2f01, 0x0000, 0x0000,
+	    0x0e58, 0x0a5f, 0x0000, 0x0000, 0x0000, 0x1634, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04e7, 0x435d, 0x0df5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4c5b, 0x0000, 0x0000, 0x3d02, 0x0000, 0x0000,
+	    0x0206, 0x0000, 0x0000, 0x2520, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0f8d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4c3e, 0x0000, 0x0498, 0x3f78, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x03cd, 0x0000, 0x24b3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x27e3, 0x135e, 0x0000, 0x0000, 0x2c81, 0x0000, 0x0000, 0x0e35,
+	    0x0000, 0x132c, 0x41da, 0x0c06, 0x0000, 0x3136, 0x0000, 0x3004,
+	    0x0000, 0x0000, 0x0412, 0x0000, 0x0000, 0x0b89, 0x0000, 0x0000,
+	    0x137e, 0x0000, 0x0000, 0x0000, 0x108b, 0x0000, 0x0000, 0x3c98,
+	    0x42d6, 0x0000, 0x4018, 0x0000, 0x0000, 0x0000, 0x3cba, 0x0000,
+	    0x1749, 0x0000, 0x4323, 0x0000, 0x43f6, 0x0000, 0x0e4b, 0x0000,
+	    0x40a6, 0x0000, 0x2009, 0x1f84, 0x0000, 0x0000, 0x0000, 0x21d5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2d5a, 0x1cbd, 0x0000, 0x0000,
+	    0x0000, 0x0258, 0x2bb2, 0x0000, 0x0000, 0x0000, 0x2149, 0x0000,
+	    0x0123, 0x0000, 0x3d2e, 0x0000, 0x0000, 0x0000, 0x0000, 0x45da,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2d51, 0x1b8f, 0x26fb, 0x0000,
+	    0x14f4, 0x0a66, 0x0000, 0x0000, 0x062b, 0x0000, 0x0000, 0x119c,
+	    0x2c58, 0x13d3, 0x02f8, 0x0000, 0x064e, 0x44c8, 0x0000, 0x26af,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2c26, 0x3653, 0x0000, 0x0000,
+	    0x0000, 0x24b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x08f1, 0x0929,
+	    0x0000, 0x1d46, 0x0000, 0x0000, 0x0000, 0x49c8, 0x2bc6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2eae, 0x4b2d, 0x1bc7, 0x0000, 0x1927,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1e64, 0x0080, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0d60, 0x0000, 0x0000, 0x0000, 0x0000, 0x2462,
+	    0x1f71, 0x0000, 0x0000, 0x0000, 0x252f, 0x0c26, 0x0000, 0x005d,
+	    0x0000, 0x0000, 0x0000, 0x2934, 0x2c4d, 0x0000, 0x0000, 0x3e54,
+	    0x0000, 0x4864, 0x0000, 0x0000, 0x4ad1, 0x0422, 0x0515, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x174b, 0x0000, 0x3f1f, 0x0000, 0x0000,
+	    0x0000, 0x2062, 0x3e72, 0x0000, 0x0f25, 0x04b3, 0x0000, 0x0000,
+	    0x32df, 0x3f3e, 0x3ad6, 0x0000, 0x0d1d, 0x047c, 0x0000, 0x1eff,
+	    0x0000, 0x0000, 0x24ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2bd3, 0x0c02, 0x0000, 0x2eec, 0x0000, 0x4426, 0x077a, 0x0000,
+	    0x0000, 0x184b, 0x295b, 0x0000, 0x0000, 0x0000, 0x1422, 0x0000,
+	    0x0000, 0x3a2c, 0x0000, 0x435f, 0x0000, 0x0000, 0x4353, 0x0000,
+	    0x3df4, 0x0000, 0x3077, 0x0000, 0x2ba8, 0x48ee, 0x4134, 0x3b84,
+	    0x0000, 0x482e, 0x0000, 0x0000, 0x0000, 0x29af, 0x0000, 0x0c86,
+	    0x3318, 0x0000, 0x0000, 0x2f43, 0x0000, 0x477e, 0x0000, 0x0000,
+	    0x01ee, 0x4a65, 0x0000, 0x0000, 0x0000, 0x06a9, 0x0000, 0x0000,
+	    0x0000, 0x0755, 0x1185, 0x3b81, 0x3b00, 0x0000, 0x3a15, 0x0000,
+	    0x0000, 0x0000, 0x31ef, 0x0000, 0x0000, 0x0000, 0x3ceb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x176b, 0x1863, 0x19f6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x14cb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x383f, 0x2e77, 0x0000, 0x0000,
+	    0x29e1, 0x0000, 0x0000, 0x0000, 0x0689, 0x1b19, 0x0000, 0x0000,
+	    0x1c93, 0x1663, 0x0000, 0x012e, 0x0000, 0x0db7, 0x0000, 0x49d5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0276, 0x31fd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x49f8, 0x0000,
+	    0x21ef, 0x0000, 0x23a6, 0x0000, 0x0000, 0x1613, 0x0000, 0x0000,
+	    0x4202, 0x0000, 0x0000, 0x0000, 0x0000, 0x4385, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22ad,
+	    0x0000, 0x0000, 0x49fa, 0x0000, 0x23d3, 0x0ac5, 0x0000, 0x0ac5,
+	    0x4b7c, 0x43a2, 0x14a9, 0x0000, 0x1db1, 0x0000, 0x23a7, 0x0000,
+	    0x0000, 0x014a, 0x0000, 0x2b7e, 0x0000, 0x0550, 0x0000, 0x0000,
+	    0x0000, 0x3254, 0x0000, 0x3cfa, 0x45c3, 0x3814, 0x421b, 0x0000,
+	    0x0000, 0x39a7, 0x0000, 0x0000, 0x1bd3, 0x0000, 0x0000, 0x0000,
+	    0x3b67, 0x42ba, 0x0b59, 0x3065, 0x0000, 0x3f66, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x125d, 0x0000, 0x23ce, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3cca, 0x0000, 0x068e, 0x4390, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x08e6, 0x0000, 0x4669, 0x21c6, 0x0000, 0x0000, 0x34e8,
+	    0x0000, 0x1722, 0x1b54, 0x1436, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x34c4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x209f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34ec,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x17aa,
+	    0x26f7, 0x32b7, 0x0000, 0x0000, 0x3e70, 0x0000, 0x0000, 0x0000,
+	    0x01bf, 0x0000, 0x0000, 0x0189, 0x0000, 0x0000, 0x1199, 0x0000,
+	    0x0000, 0x0000, 0x2765, 0x15b3, 0x0000, 0x0000, 0x0d47, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2bc9, 0x0000,
+	    0x0000, 0x342d, 0x0000, 0x0000, 0x0000, 0x1c79, 0x0000, 0x0000,
+	    0x0000, 0x42d4, 0x0000, 0x0469, 0x0000, 0x20a0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a45, 0x0000,
+	    0x0000, 0x0000, 0x3aee, 0x0000, 0x0b95, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0acf, 0x0000, 0x0fe4, 0x0000, 0x4953, 0x0000, 0x108e,
+	    0x45ed, 0x2d7a, 0x0a64, 0x145d, 0x0000, 0x0000, 0x45a2, 0x0000,
+	    0x46db, 0x0000, 0x0000, 0x0000, 0x0000, 0x09fe, 0x0000, 0x1aa5,
+	    0x28d3, 0x0000, 0x2fc2, 0x0000, 0x0000, 0x2d72, 0x0992, 0x099e,
+	    0x21c7, 0x0000, 0x0000, 0x2d8d, 0x0000, 0x0000, 0x3970, 0x2270,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38e9, 0x0000,
+	    0x0000, 0x0000, 0x045e, 0x0000, 0x0000, 0x2c69, 0x33ed, 0x0000,
+	    0x0000, 0x3686, 0x4c23, 0x0000, 0x0d80, 0x07f8, 0x0000, 0x0000,
+	    0x0000, 0x0fb7, 0x0000, 0x0000, 0x0000, 0x39c8, 0x0997, 0x0000,
+	    0x0000, 0x0000, 0x3f32, 0x24a0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1d0e, 0x0000, 0x20e2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0a0b, 0x15ff, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x28b8, 0x0000, 0x0000, 0x0000, 0x0bbb, 0x0000, 0x0000,
+	    0x21d5, 0x0000, 0x008b, 0x15c3, 0x0000, 0x0000, 0x011b, 0x25dc,
+	    0x0000, 0x0000, 0x4952, 0x01c8, 0x1b88, 0x0000, 0x0000, 0x0000,
+	    0x2ffd, 0x0000, 0x0000, 0x0693, 0x385a, 0x0000, 0x2377, 0x0bb7,
+	    0x4d50, 0x0000, 0x0000, 0x0000, 0x3bea, 0x0000, 0x0000, 0x0000,
+	    0x0646, 0x03c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x337e,
+	    0x0000, 0x1f12, 0x0000, 0x2969, 0x0000, 0x2c5a, 0x3731, 0x0000,
+	    0x0000, 0x0000, 0x14c7, 0x0000, 0x0000, 0x1f52, 0x0ccb, 0x0000,
+	    0x0000, 0x3123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1a7c, 0x0000, 0x0000, 0x360e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0b4c, 0x0000, 0x463a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2428, 0x4115, 0x0739, 0x0000, 0x0000, 0x0155, 0x423c,
+	    0x0000, 0x0000, 0x3e8c, 0x4972, 0x0000, 0x3071, 0x2b2e, 0x0000,
+	    0x070b, 0x0000, 0x0a7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x34aa,
+	    0x0000, 0x2c9f, 0x0000, 0x0000, 0x0000, 0x2fce, 0x0000, 0x025e,
+	    0x0000, 0x0000, 0x1fd2, 0x0000, 0x0000, 0x0000, 0x0e73, 0x0000,
+	    0x01aa, 0x0000, 0x0000, 0x2ccc, 0x2a66, 0x4395, 0x0e23, 0x0cb1,
+	    0x0000, 0x0000, 0x0000, 0x3103, 0x0000, 0x0000, 0x4198, 0x0000,
+	    0x3a79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1960,
+	    0x2266, 0x1d8b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c2b,
+	    0x30e9, 0x43b5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1772, 0x21b0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0da7, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x35e4, 0x0000, 0x19a9, 0x03af, 0x2233,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2772, 0x0000, 0x0000, 0x0000,
+	    0x36aa, 0x458b, 0x4d02, 0x2852, 0x0000, 0x0000, 0x0000, 0x2992,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x273f, 0x0000, 0x0000,
+	    0x0000, 0x2bd0, 0x0000, 0x0000, 0x0775, 0x0000, 0x0000, 0x25a7,
+	    0x0000, 0x0000, 0x0000, 0x46a9, 0x0000, 0x0000, 0x0000, 0x27e3,
+	    0x2d24, 0x07a6, 0x0000, 0x2aad, 0x0000, 0x1000, 0x129e, 0x1009,
+	    0x2d2a, 0x36da, 0x0000, 0x0000, 0x0074, 0x49d0, 0x0000, 0x0000,
+	    0x3c74, 0x160b, 0x0000, 0x0000, 0x2cd2, 0x3c1d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x274c, 0x464d, 0x0000,
+	    0x2773, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e89, 0x0000,
+	    0x0000, 0x1361, 0x0000, 0x0000, 0x079a, 0x0000, 0x0000, 0x11f6,
+	    0x1e54, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0544, 0x0000, 0x38c0, 0x0000, 0x3e4b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2ec8, 0x29cb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x117a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1c3f, 0x0000, 0x0000, 0x0000,
+	    0x098d, 0x0f00, 0x0d06, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22e9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4969, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3e45, 0x0000, 0x0000, 0x3acb, 0x18a3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0da9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1c5b, 0x0000, 0x0000, 0x0789, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0905, 0x0000, 0x241d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0707, 0x0000, 0x4bf5, 0x0000,
+	    0x0000, 0x0000, 0x43ad, 0x0000, 0x0000, 0x0000, 0x25d6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1fa4, 0x0000, 0x24f8, 0x0000,
+	    0x3ba1, 0x0000, 0x0b9b, 0x3daa, 0x0000, 0x24bb, 0x0000, 0x375f,
+	    0x0847, 0x074e, 0x0bf5, 0x0e6b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0fd2, 0x0000, 0x4da9, 0x0000, 0x0000, 0x0000, 0x2913, 0x13f8,
+	    0x0000, 0x0000, 0x3e3d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3055, 0x3b24, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0d3d, 0x2dcb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x09f7, 0x40e9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f0c,
+	    0x0000, 0x1399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25ff,
+	    0x0865, 0x0ab4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x37ec,
+	    0x0000, 0x0000, 0x0000, 0x1d72, 0x4c1f, 0x0000, 0x0000, 0x32a9,
+	    0x0000, 0x3067, 0x15d6, 0x0000, 0x0000, 0x1bf2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x34d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ab4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30f7,
+	    0x0000, 0x0000, 0x3b66, 0x0000, 0x0000, 0x0000, 0x0974, 0x057d,
+	    0x25f9, 0x0000, 0x09b9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2daa, 0x0966, 0x3533, 0x42d2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x13eb, 0x0744, 0x2d9f,
+	    0x2b2c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02b5, 0x2555,
+	    0x18d1, 0x0000, 0x0000, 0x27db, 0x0000, 0x0000, 0x0000, 0x048f,
+	    0x08fc, 0x206f, 0x0000, 0x0000, 0x00e5, 0x0a22, 0x0000, 0x0000,
+	    0x0000, 0x24cd, 0x0000, 0x27a3, 0x0000, 0x4547, 0x0e75, 0x0000,
+	    0x0000, 0x0000, 0x118a, 0x0000, 0x3cd8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04b6, 0x0000, 0x0000, 0x3837, 0x0000, 0x2a49,
+	    0x074f, 0x0000, 0x1f1b, 0x0000, 0x0000, 0x3413, 0x0000, 0x0000,
+	    0x2b26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a6f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1872,
+	    0x0000, 0x35f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f35, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1bf2, 0x0c53, 0x3a45, 0x0000, 0x0000,
+	    0x0bd2, 0x0000, 0x0000, 0x36b6, 0x1702, 0x0000, 0x4803, 0x0000,
+	    0x013e, 0x0000, 0x0000, 0x0000, 0x0000, 0x3955, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2d22, 0x0000, 0x0000, 0x452e, 0x0000, 0x0ea3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x06a5, 0x0000, 0x3694, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x116a, 0x0000, 0x0000, 0x0000, 0x09e3,
+	    0x0000, 0x0000, 0x4549, 0x2c25, 0x2b50, 0x0000, 0x26d5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4226, 0x16d2, 0x26f6, 0x0000,
+	    0x0000, 0x25a9, 0x0000, 0x23a7, 0x0000, 0x188d, 0x35a3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x32f5,
+	    0x0000, 0x368b, 0x0000, 0x0000, 0x21af, 0x0000, 0x0000, 0x0000,
+	    0x4329, 0x0000, 0x10eb, 0x4af4, 0x0000, 0x1575, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1111, 0x1d28, 0x4315, 0x0000, 0x120b, 0x37f2,
+	    0x0000, 0x0000, 0x3307, 0x0000, 0x0000, 0x1fc1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2a3f, 0x0000, 0x01e8, 0x36b4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4cf5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4a27, 0x3e98, 0x0000, 0x0000, 0x0000, 0x0000, 0x06c6,
+	    0x2108, 0x35b9, 0x0000, 0x0000, 0x0000, 0x4cd8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3355, 0x4017, 0x36aa,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c37, 0x0000, 0x4df0,
+	    0x0000, 0x39b7, 0x0000, 0x0000, 0x0000, 0x4045, 0x0000, 0x43b1,
+	    0x44d3, 0x0000, 0x4360, 0x0000, 0x0110, 0x0000, 0x0000, 0x2cb7,
+	    0x0000, 0x2a33, 0x0000, 0x0000, 0x335e, 0x04ad, 0x0000, 0x0000,
+	    0x0ad9, 0x3280, 0x41ff, 0x4663, 0x0000, 0x0000, 0x1c63, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x16ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4d59, 0x0000, 0x350b, 0x0000, 0x1ac5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e39, 0x2fc8, 0x22e4,
+	    0x0000, 0x242f, 0x0000, 0x0000, 0x0000, 0x1d6e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4c6b, 0x0000, 0x0000, 0x066f, 0x0000, 0x0000,
+	    0x2c03, 0x30f6, 0x3491, 0x0000, 0x0000, 0x19c3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x22a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x11e1, 0x09cf, 0x0000, 0x0000, 0x3d89, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x16fb, 0x0000, 0x0000, 0x0427, 0x3aaf, 0x0000,
+	    0x0000, 0x2cea, 0x0000, 0x0000, 0x13f0, 0x0000, 0x4c7d, 0x0000,
+	    0x0000, 0x3cfc, 0x0c81, 0x0000, 0x0000, 0x41f9, 0x136e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1b90, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x03bd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0fdf, 0x0000, 0x0000, 0x0000, 0x4325, 0x0869, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e80,
+	    0x0000, 0x0000, 0x0000, 0x37de, 0x0000, 0x24fc, 0x0000, 0x1027,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1aad, 0x0000, 0x0000, 0x0000,
+	    0x11f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2fa0, 0x0000,
+	    0x0000, 0x3b6e, 0x0000, 0x4067, 0x0000, 0x0000, 0x1458, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x415e, 0x0000, 0x207c,
+	    0x429d, 0x0000, 0x0000, 0x0000, 0x3941, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x11d5, 0x124b, 0x0000, 0x08c3, 0x0000, 0x0b77, 0x4c71,
+	    0x0000, 0x0000, 0x0aae, 0x40da, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x37a8, 0x0000, 0x0000, 0x0000, 0x281a, 0x0000, 0x0000,
+	    0x0000, 0x0421, 0x0000, 0x0000, 0x2295, 0x442d, 0x0000, 0x0e62,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x23e9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0cfe, 0x0000, 0x0000, 0x1962, 0x4c6f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1961, 0x3ba7, 0x0e7c,
+	    0x0000, 0x01d5, 0x0000, 0x2dcf, 0x0f10, 0x0000, 0x0000, 0x1ff5,
+	    0x0000, 0x4749, 0x1c62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x192e,
+	    0x0000, 0x0000, 0x4408, 0x0720, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4be3, 0x0000, 0x4219, 0x0000, 0x4199, 0x421f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0d77, 0x0cd4, 0x0000, 0x1d34,
+	    0x0000, 0x0000, 0x3e5b, 0x1bdb, 0x02d6, 0x3c87, 0x271c, 0x1819,
+	    0x0000, 0x0000, 0x0000, 0x1cdd, 0x32cd, 0x0bb5, 0x4db3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0a9c, 0x18de, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0a25, 0x0000, 0x0000, 0x0000, 0x0000, 0x40bf, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0071, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x19db, 0x2539, 0x0000, 0x0000, 0x2a06, 0x0fa6, 0x0000, 0x0000,
+	    0x2f39, 0x0000, 0x2119, 0x08f4, 0x2dde, 0x31db, 0x0000, 0x0000,
+	    0x1f6f, 0x170e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x357f, 0x0000, 0x2b93, 0x0000, 0x2a9b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0f9b, 0x0000, 0x209b, 0x190c, 0x1446, 0x0000, 0x0000,
+	    0x0000, 0x2d99, 0x08d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1215,
+	    0x0000, 0x0000, 0x0000, 0x3641, 0x0000, 0x2cbc, 0x0000, 0x0000,
+	    0x0000, 0x07d9, 0x3f44, 0x0000, 0x04c4, 0x4432, 0x0000, 0x4b35,
+	    0x1ce7, 0x0000, 0x0000, 0x0000, 0x0000, 0x09e8, 0x0000, 0x043d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4390, 0x0000, 0x3adf, 0x33d1, 0x4c69, 0x4ccf, 0x0000, 0x2e1c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1485, 0x0c81, 0x0000,
+	    0x0000, 0x0000, 0x4abf, 0x120c, 0x0000, 0x1318, 0x3d3b, 0x0000,
+	    0x0000, 0x30e8, 0x0000, 0x4916, 0x0000, 0x0000, 0x0000, 0x3dc7,
+	    0x0000, 0x0000, 0x2d9d, 0x0000, 0x0000, 0x2d08, 0x0000, 0x33ec,
+	    0x0000, 0x0000, 0x0000, 0x18d7, 0x1485, 0x0000, 0x0000, 0x17fa,
+	    0x2702, 0x0000, 0x22ac, 0x2231, 0x0000, 0x3e7b, 0x0000, 0x0000,
+	    0x0000, 0x4608, 0x4643, 0x4708, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x43af, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x067c, 0x0000, 0x481b, 0x0000, 0x4be8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2d48, 0x37e5, 0x3bfd, 0x3acb, 0x0eef, 0x0000,
+	    0x0000, 0x403c, 0x0000, 0x0000, 0x32e8, 0x0000, 0x12e8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x37f0, 0x0000,
+	    0x0000, 0x242c, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ec2, 0x13af,
+	    0x0000, 0x1a21, 0x0000, 0x28a5, 0x0000, 0x0000, 0x1f32, 0x02c7,
+	    0x0000, 0x0000, 0x2dd1, 0x0000, 0x0000, 0x0000, 0x0134, 0x0000,
+	    0x0bdf, 0x1d54, 0x0000, 0x08e8, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x40fc, 0x0000, 0x0000, 0x30a5, 0x0000, 0x0000, 0x1c17,
+	    0x0000, 0x4b03, 0x2fdd, 0x0000, 0x08d3, 0x0000, 0x27c5, 0x0000,
+	    0x23eb, 0x4848, 0x0000, 0x0079, 0x0000, 0x1ae9, 0x0000, 0x1f10,
+	    0x2a0d, 0x49a6, 0x0000, 0x3646, 0x0597, 0x0000, 0x3c8d, 0x0ebd,
+	    0x2865, 0x4a8d, 0x0000, 0x4856, 0x0000, 0x2e00, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2b72, 0x0293, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x24d7, 0x0000, 0x1ff8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x410f, 0x0cc6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x402b,
+	    0x0000, 0x3842, 0x0000, 0x0000, 0x3f65, 0x3db0, 0x2319, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2dae, 0x339e, 0x1c19, 0x0acc,
+	    0x0000, 0x2d7c, 0x4d8e, 0x005b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x299a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31d9, 0x0000,
+	    0x0000, 0x0636, 0x31c2, 0x0000, 0x1eb3, 0x0000, 0x0000, 0x119b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x13a8, 0x13f9,
+	    0x2d5f, 0x0000, 0x2f51, 0x0000, 0x28e2, 0x0000, 0x2909, 0x1b41,
+	    0x0000, 0x0000, 0x3685, 0x0000, 0x0000, 0x0000, 0x0517, 0x0000,
+	    0x03ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x04ff, 0x301b, 0x1b63,
+	    0x0000, 0x2b1a, 0x3c8a, 0x0000, 0x0000, 0x0000, 0x0607, 0x0000,
+	    0x0000, 0x0aaa, 0x0000, 0x3de1, 0x0000, 0x0000, 0x3179, 0x0000,
+	    0x0000, 0x0a3a, 0x0000, 0x0000, 0x34f4, 0x0000, 0x0854, 0x0000,
+	    0x0000, 0x0000, 0x37e6, 0x07f6, 0x0306, 0x3118, 0x4728, 0x1e31,
+	    0x0000, 0x0000, 0x0000, 0x2562, 0x33b2, 0x0000, 0x0000, 0x1dd4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2cd4, 0x0000, 0x0000,
+	    0x0c9b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2267, 0x0000,
+	    0x0000, 0x40ac, 0x0000, 0x0000, 0x0000, 0x44a9, 0x0000, 0x0000,
+	    0x0000, 0x10cc, 0x319e, 0x0000, 0x0000, 0x29ee, 0x0000, 0x0000,
+	    0x1929, 0x41bf, 0x0000, 0x18d0, 0x1fee, 0x0000, 0x0000, 0x0000,
+	    0x0c42, 0x0000, 0x436b, 0x0000, 0x0000, 0x0000, 0x1a09, 0x2ae3,
+	    0x0000, 0x319f, 0x0000, 0x0000, 0x0000, 0x28cd, 0x1317, 0x0000,
+	    0x2de2, 0x2878, 0x0000, 0x1f97, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2aa8, 0x469e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x21ac, 0x0000, 0x0000, 0x0679, 0x0000, 0x0000, 0x4b9b, 0x189c,
+	    0x438a, 0x47cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e05, 0x0000,
+	    0x0000, 0x0000, 0x0575, 0x0000, 0x0000, 0x0000, 0x2759, 0x1665,
+	    0x0000, 0x0000, 0x0000, 0x293e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c79, 0x3783,
+	    0x0000, 0x0000, 0x10ae, 0x3ad1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x16c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4e10,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1461, 0x0000,
+	    0x4710, 0x0000, 0x0000, 0x0000, 0x0000, 0x46ab, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x18df, 0x0000, 0x4d1c, 0x0000, 0x4389, 0x0000,
+	    0x081e, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f3f, 0x0000, 0x2e06,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d18, 0x290f, 0x0000,
+	    0x0000, 0x42e7, 0x46d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0125, 0x0000, 0x47ae, 0x0000, 0x23a4, 0x39f0, 0x0000, 0x00d7,
+	    0x4d7c, 0x0000, 0x0000, 0x0000, 0x09f2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4309, 0x1b71, 0x0000, 0x0000,
+	    0x0000, 0x31d5, 0x1c57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x37de, 0x0000, 0x0758, 0x1159, 0x1882, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1813,
+	    0x0000, 0x3902, 0x0a83, 0x0000, 0x0000, 0x0000, 0x0000, 0x411c,
+	    0x0000, 0x071b, 0x4433, 0x0000, 0x0000, 0x0000, 0x0000, 0x0cc9,
+	    0x0000, 0x0000, 0x364c, 0x2e56, 0x040a, 0x0000, 0x0000, 0x1515,
+	    0x21a0, 0x0000, 0x1615, 0x0000, 0x0000, 0x0000, 0x0461, 0x0264,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x21ee, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1666, 0x0000, 0x2394,
+	    0x0000, 0x0000, 0x0000, 0x49c7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0103, 0x1918, 0x0000, 0x0000, 0x0000, 0x3f45, 0x2d99, 0x0000,
+	    0x0000, 0x0000, 0x308f, 0x0000, 0x0000, 0x0c69, 0x0000, 0x0000,
+	    0x0000, 0x43cd, 0x0000, 0x2f67, 0x0000, 0x16e4, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02b5, 0x0000, 0x35e2, 0x23e2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x34d0, 0x23f3, 0x21d2, 0x0000, 0x28fb,
+	    0x17c7, 0x0000, 0x0000, 0x0000, 0x3949, 0x0000, 0x39e3, 0x0000,
+	    0x4865, 0x4a53, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x342b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45e0,
+	    0x3325, 0x43be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ed3,
+	    0x0000, 0x2395, 0x0000, 0x0eb0, 0x3a50, 0x1876, 0x0000, 0x1966,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42f2, 0x0000, 0x12fa,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1602, 0x4b85, 0x0000, 0x4a87,
+	    0x0000, 0x10c7, 0x0000, 0x44fc, 0x4be6, 0x0000, 0x2c9f, 0x0000,
+	    0x0000, 0x0000, 0x4524, 0x2939, 0x18b9, 0x0000, 0x0000, 0x239b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4677,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b0f, 0x3eac, 0x0000,
+	    0x0000, 0x1b0d, 0x0000, 0x1e75, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4765, 0x0000, 0x0000, 0x36ae, 0x19be, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3f41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2bf7,
+	    0x0000, 0x0000, 0x0000, 0x2bc7, 0x0000, 0x4118, 0x0000, 0x34f2,
+	    0x2aea, 0x0000, 0x4392, 0x0000, 0x188a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0a4b, 0x0000, 0x0000, 0x225d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0b2a, 0x0000, 0x445a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x104b, 0x0000, 0x1d96, 0x0460, 0x1efc, 0x0000,
+	    0x16c1, 0x0000, 0x0000, 0x0000, 0x2049, 0x0000, 0x0000, 0x4214,
+	    0x0000, 0x2008, 0x13be, 0x0000, 0x0bc6, 0x4723, 0x3e2e, 0x0000,
+	    0x0000, 0x08f9, 0x0000, 0x0000, 0x0000, 0x377f, 0x0000, 0x0000,
+	    0x399c, 0x234f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0cb8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1325, 0x228b, 0x0000, 0x0000,
+	    0x39b5, 0x0000, 0x0000, 0x0000, 0x1d46, 0x38e8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x26d9, 0x0000, 0x106d, 0x419e, 0x0000,
+	    0x0000, 0x0000, 0x0c1d, 0x4469, 0x13b1, 0x0000, 0x0000, 0x0c1b,
+	    0x29c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a37, 0x0000,
+	    0x0000, 0x4823, 0x2621, 0x0000, 0x0000, 0x0000, 0x4a53, 0x0000,
+	    0x0000, 0x2a82, 0x0000, 0x0000, 0x0000, 0x2290, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x05e8, 0x4ae4, 0x2cbe, 0x3521, 0x4747,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0524, 0x0000, 0x05a0,
+	    0x0000, 0x0000, 0x0000, 0x1900, 0x0000, 0x0000, 0x0000, 0x0751,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4af8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4bdd, 0x127c, 0x0000, 0x0000, 0x18f5, 0x0424, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1592, 0x4784, 0x0000, 0x0000, 0x4afc,
+	    0x23e3, 0x0000, 0x3bee, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x28b5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0cd2, 0x0000, 0x1b7f, 0x21c6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x08db, 0x0286, 0x3693, 0x1bab, 0x281c,
+	    0x0000, 0x0000, 0x0000, 0x0f13, 0x0000, 0x1dd9, 0x1aa1, 0x0000,
+	    0x3544, 0x0000, 0x03b3, 0x0431, 0x0000, 0x4d7e, 0x3514, 0x0000,
+	    0x061e, 0x0000, 0x0000, 0x0000, 0x0057, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3f69, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c35,
+	    0x0000, 0x0183, 0x1030, 0x2c33, 0x0000, 0x0000, 0x177a, 0x0000,
+	    0x0000, 0x1244, 0x0000, 0x2f5e, 0x1886, 0x0048, 0x0466, 0x2370,
+	    0x0000, 0x08c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x449a, 0x0000,
+	    0x4ba8, 0x0723, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4a4a, 0x0000, 0x0000, 0x0000, 0x18a4, 0x04e1, 0x3ef5, 0x42b6,
+	    0x0000, 0x0000, 0x066c, 0x05e5, 0x4b19, 0x0000, 0x3f91, 0x1ac2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3399, 0x0000, 0x2995, 0x0000,
+	    0x0000, 0x0000, 0x3610, 0x0000, 0x0000, 0x1405, 0x2c4d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x414a, 0x0000,
+	    0x2532, 0x0000, 0x22dc, 0x2a08, 0x152e, 0x4177, 0x0000, 0x0000,
+	    0x25d4, 0x0000, 0x0000, 0x1894, 0x0ddf, 0x4848, 0x0000, 0x0000,
+	    0x0000, 0x0f51, 0x0000, 0x0000, 0x3cdf, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4c70, 0x0000, 0x2b48, 0x0000, 0x3f47, 0x0000, 0x0000,
+	    0x0000, 0x4dc9, 0x0000, 0x4369, 0x0000, 0x337d, 0x14ad, 0x0000,
+	    0x0000, 0x2626, 0x1ed4, 0x140d, 0x0a5a, 0x2d56, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x27e4, 0x0000, 0x0000, 0x2f28,
+	    0x0000, 0x412a, 0x35c2, 0x0000, 0x2da2, 0x0000, 0x0282, 0x0000,
+	    0x0000, 0x095a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x392a, 0x0f20, 0x3421, 0x0000, 0x2ec4, 0x0000,
+	    0x3599, 0x2ee6, 0x2d05, 0x0000, 0x0000, 0x0000, 0x05d6, 0x00f0,
+	    0x1a74, 0x0000, 0x0000, 0x0000, 0x0000, 0x1850, 0x0000, 0x0000,
+	    0x0000, 0x4106, 0x0000, 0x0000, 0x0000, 0x0000, 0x385d, 0x2c4f,
+	    0x0000, 0x0000, 0x0506, 0x28f1, 0x0000, 0x4b4a, 0x31cd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1bd6, 0x0000, 0x0000, 0x0b1b, 0x0000,
+	    0x0000, 0x08f8, 0x0ce5, 0x0000, 0x0000, 0x0000, 0x37eb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0306, 0x0000, 0x0000, 0x0850, 0x0000,
+	    0x0000, 0x0e1b, 0x0000, 0x0000, 0x0712, 0x0000, 0x343b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4114, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e57, 0x0000, 0x0000, 0x2b22, 0x0000, 0x0000,
+	    0x161b, 0x0000, 0x066d, 0x0000, 0x0000, 0x0000, 0x3618, 0x4a2e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e5c,
+	    0x1a68, 0x0000, 0x0000, 0x1d91, 0x0000, 0x3bbc, 0x34b8, 0x1358,
+	    0x0000, 0x0000, 0x0000, 0x2307, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3a8f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0772,
+	    0x3457, 0x0000, 0x0000, 0x0065, 0x0000, 0x0000, 0x21f6, 0x45f1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3381, 0x0000, 0x09c7,
+	    0x0000, 0x0000, 0x0bc6, 0x3a9a, 0x0000, 0x0000, 0x13ca, 0x0000,
+	    0x0000, 0x2391, 0x0000, 0x0000, 0x0000, 0x0000, 0x47c8, 0x0000,
+	    0x0000, 0x416e, 0x0000, 0x0000, 0x0000, 0x2ca6, 0x42c1, 0x0f03,
+	    0x23e8, 0x0000, 0x3297, 0x0000, 0x0000, 0x3d48, 0x25e5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x39be, 0x0000, 0x2991, 0x0000, 0x0000,
+	    0x0640, 0x1181, 0x0000, 0x0000, 0x2656, 0x0000, 0x3668, 0x0000,
+	    0x0000, 0x33a0, 0x0ca9, 0x0000, 0x4907, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3ae7, 0x0000, 0x0000, 0x23a9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3fcb, 0x4182, 0x25e7,
+	    0x49e4, 0x0000, 0x0000, 0x1841, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x24fa, 0x0cf2, 0x1e2d, 0x0247, 0x2262, 0x0000, 0x0000,
+	    0x150b, 0x17fc, 0x0000, 0x0000, 0x0000, 0x44f1, 0x0000, 0x0000,
+	    0x3280, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x14ff, 0x0000, 0x0000, 0x0000, 0x0964, 0x118f, 0x3f1e, 0x0000,
+	    0x338e, 0x0185, 0x47e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x211c, 0x0f78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0224, 0x0000,
+	    0x0000, 0x0000, 0x207f, 0x0000, 0x0000, 0x32af, 0x0000, 0x0e09,
+	    0x0000, 0x33e5, 0x0000, 0x0000, 0x4358, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2447, 0x0000, 0x0000, 0x0929, 0x0000, 0x0000, 0x0000,
+	    0x423b, 0x0000, 0x4a4c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x28c4, 0x0000, 0x0000, 0x157b, 0x0000, 0x4492,
+	    0x0000, 0x3df7, 0x1462, 0x2e84, 0x2b4a, 0x2e73, 0x0000, 0x2233,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3655, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x37a3,
+	    0x0000, 0x0000, 0x1cc6, 0x0000, 0x0000, 0x0000, 0x208d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2f6e, 0x0000, 0x0000, 0x0a70, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x30d1, 0x0000, 0x0500, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x34d3, 0x0000, 0x0000, 0x0000, 0x1742,
+	    0x0000, 0x0000, 0x0000, 0x4df0, 0x0aff, 0x0000, 0x353d, 0x0000,
+	    0x0000, 0x01b9, 0x0000, 0x0000, 0x1d02, 0x0000, 0x0000, 0x0d62,
+	    0x0000, 0x3249, 0x2868, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2f71, 0x0000, 0x0000, 0x0000, 0x0000, 0x4595, 0x0000,
+	    0x3a86, 0x26f5, 0x0000, 0x14d7, 0x120e, 0x0000, 0x37da, 0x0000,
+	    0x3d1a, 0x0308, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3db5, 0x39cc,
+	    0x0000, 0x3df1, 0x4716, 0x0000, 0x3c27, 0x2a71, 0x0000, 0x0000,
+	    0x0000, 0x304a, 0x0000, 0x148f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e5d, 0x0000, 0x47aa, 0x0c39,
+	    0x0000, 0x1ed4, 0x0e9b, 0x4486, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x149e, 0x0000, 0x0000, 0x0000, 0x0000, 0x37be, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1483, 0x0000, 0x0000, 0x0000, 0x07ac, 0x0000,
+	    0x0000, 0x0000, 0x4969, 0x0000, 0x0dd2, 0x301e, 0x1384, 0x0000,
+	    0x2b3c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0ac6, 0x3df2, 0x0000, 0x38d4, 0x04b2, 0x0000, 0x0000,
+	    0x0580, 0x0aba, 0x0000, 0x0000, 0x488f, 0x1a75, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2db3, 0x0000, 0x0000,
+	    0x3370, 0x0000, 0x2997, 0x0000, 0x25ac, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cc9, 0x4c49,
+	    0x0e96, 0x0000, 0x2e26, 0x0870, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2364, 0x30aa, 0x0000, 0x3dfa, 0x1649,
+	    0x2184, 0x0b11, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4495,
+	    0x0000, 0x3cb6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b49, 0x3113,
+	    0x3f2b, 0x0000, 0x0000, 0x4065, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3944, 0x2c91, 0x0000, 0x0000, 0x11ff, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0929, 0x0000, 0x0000,
+	    0x0000, 0x4b06, 0x43d3, 0x2130, 0x0000, 0x0000, 0x0000, 0x474a,
+	    0x0000, 0x368e, 0x0000, 0x0000, 0x19e9, 0x0000, 0x1b56, 0x4812,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4df9, 0x336b, 0x0000, 0x0000, 0x0000,
+	    0x0c04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a09, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3757, 0x0000, 0x3e43, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2901, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x23a5, 0x4cdb, 0x0000, 0x0000, 0x0000, 0x1328, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2453, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0ffe, 0x0000, 0x4b51, 0x3cff, 0x2f61, 0x0000,
+	    0x0000, 0x432a, 0x0d83, 0x0000, 0x1269, 0x0000, 0x0000, 0x0000,
+	    0x4415, 0x0000, 0x0000, 0x0000, 0x0000, 0x38e4, 0x2e0f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4030, 0x0000, 0x3b80, 0x2e2f, 0x4320,
+	    0x1bc0, 0x3df5, 0x0000, 0x0000, 0x21ca, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x49ca, 0x0000, 0x0000,
+	    0x0000, 0x32ca, 0x3735, 0x0cf2, 0x0f69, 0x2467, 0x0000, 0x361b,
+	    0x2dcc, 0x0000, 0x0000, 0x0000, 0x0000, 0x44dc, 0x3f92, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x420b, 0x0000, 0x0000, 0x0000, 0x3a14,
+	    0x0000, 0x2180, 0x0000, 0x127f, 0x1d62, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3b4a, 0x3d0a, 0x201a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x24a2, 0x0217, 0x356c, 0x0000, 0x3463, 0x0000,
+	    0x1fca, 0x0000, 0x0000, 0x0163, 0x4b44, 0x0000, 0x0000, 0x0000,
+	    0x1367, 0x4308, 0x0000, 0x0000, 0x2046, 0x0000, 0x0000, 0x0000,
+	    0x300b, 0x3ee4, 0x16a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x32a9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4ae5, 0x0000, 0x0000, 0x0000, 0x1fb6, 0x3c2d, 0x2010,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x421a,
+	    0x0000, 0x1a68, 0x0606, 0x44cd, 0x1da3, 0x1431, 0x0000, 0x2773,
+	    0x1bf5, 0x3b57, 0x0000, 0x04c7, 0x292e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0844, 0x0000, 0x0000, 0x0000, 0x2e8c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3484, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1dd4, 0x0000, 0x2146, 0x351a, 0x0000, 0x2fd2, 0x0000,
+	    0x0000, 0x0000, 0x4674, 0x0000, 0x0c75, 0x0000, 0x0000, 0x3023,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x47db, 0x0000,
+	    0x1bc3, 0x0ad7, 0x3cc1, 0x122c, 0x1e95, 0x3d02, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x344d, 0x0000, 0x3eb3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2185, 0x0000,
+	    0x4cd3, 0x313a, 0x0000, 0x4a55, 0x0000, 0x07f2, 0x0845, 0x0000,
+	    0x0000, 0x4966, 0x0000, 0x0000, 0x0000, 0x367a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2231, 0x0000, 0x2ace, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2859, 0x0000, 0x392a, 0x077f, 0x0000, 0x0d76, 0x0000,
+	    0x305f, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c0d, 0x103b, 0x0000,
+	    0x20c6, 0x44ad, 0x0000, 0x41b8, 0x0000, 0x0000, 0x0000, 0x169e,
+	    0x0000, 0x0000, 0x2c83, 0x0000, 0x0000, 0x0000, 0x1207, 0x0000,
+	    0x0000, 0x0512, 0x0000, 0x0000, 0x292c, 0x0000, 0x1c4d, 0x225f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e6b, 0x1887, 0x0000,
+	    0x019b, 0x0000, 0x3224, 0x0000, 0x0000, 0x0000, 0x4ae7, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x33c1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4045, 0x4bc4, 0x0a81, 0x0000,
+	    0x0000, 0x227e, 0x0000, 0x1dd1, 0x0000, 0x0000, 0x4a1e, 0x0000,
+	    0x0000, 0x357c, 0x0000, 0x3dac, 0x0000, 0x0000, 0x0000, 0x3db4,
+	    0x0000, 0x30a4, 0x0000, 0x0000, 0x0000, 0x0389, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0a9d, 0x0425, 0x0000, 0x181a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ea6, 0x024e, 0x0000, 0x471f, 0x0000, 0x1ccb,
+	    0x0000, 0x0898, 0x0df3, 0x4398, 0x134c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4a16, 0x0000, 0x09a0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3cf1, 0x0000, 0x0000, 0x2155, 0x310a, 0x0000, 0x0000,
+	    0x0f8f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c88, 0x0000,
+	    0x0000, 0x0000, 0x0224, 0x0000, 0x4d1b, 0x0000, 0x0000, 0x42f4,
+	    0x00df, 0x1fbc, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c50, 0x0000,
+	    0x0000, 0x1d8b, 0x0000, 0x0000, 0x3e37, 0x2472, 0x0000, 0x1cef,
+	    0x0000, 0x1ed0, 0x1e5e, 0x2bcc, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x41aa, 0x0000, 0x0000, 0x0000, 0x43ae, 0x0000, 0x1e9f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23f4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x267c, 0x4b84, 0x0000, 0x0000, 0x1995,
+	    0x0000, 0x0000, 0x0000, 0x0bdc, 0x2bc0, 0x0000, 0x0000, 0x3b2d,
+	    0x0000, 0x0000, 0x4553, 0x05a4, 0x1147, 0x0bea, 0x0000, 0x0000,
+	    0x103a, 0x1bfe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b5b,
+	    0x0000, 0x0000, 0x4404, 0x16a1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x099d, 0x2f27, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x307f, 0x2068, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e4d, 0x47de,
+	    0x0000, 0x4d50, 0x0000, 0x1b64, 0x0000, 0x0639, 0x0000, 0x46d7,
+	    0x37fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x17a4, 0x0000,
+	    0x0000, 0x2a9c, 0x0000, 0x0000, 0x0000, 0x2678, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1159, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x33af, 0x3c17, 0x0000, 0x44a1,
+	    0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x099d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e64, 0x1de9, 0x096c, 0x0000,
+	    0x0000, 0x0000, 0x1bc4, 0x0000, 0x0000, 0x0000, 0x2e3a, 0x0eca,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2ce0, 0x0000,
+	    0x0000, 0x1216, 0x03e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3a59, 0x0000, 0x08d0, 0x3e16, 0x0000, 0x3e56,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3be4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1ab1, 0x0000, 0x3883, 0x0b03, 0x3739,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e57, 0x0000,
+	    0x0673, 0x0000, 0x0000, 0x2517, 0x0000, 0x0000, 0x3c48, 0x2526,
+	    0x0e96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1aee,
+	    0x3814, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3700, 0x279d, 0x3efd, 0x42ad, 0x19b9,
+	    0x0000, 0x0000, 0x0000, 0x2c77, 0x0000, 0x0000, 0x19c2, 0x0000,
+	    0x0000, 0x191a, 0x0000, 0x483c, 0x0000, 0x0000, 0x0000, 0x3ae5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x447c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f5c,
+	    0x0000, 0x0000, 0x36f5, 0x1b53, 0x0000, 0x0000, 0x1313, 0x4d0b,
+	    0x10a9, 0x3b7d, 0x0000, 0x12aa, 0x0000, 0x0000, 0x0000, 0x2877,
+	    0x0000, 0x0000, 0x0000, 0x1b5f, 0x2bf6, 0x3b9f, 0x0000, 0x0ee5,
+	    0x3408, 0x0000, 0x0397, 0x0dff, 0x0000, 0x0000, 0x4b4c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2586, 0x1b01, 0x0397, 0x0000,
+	    0x0e52, 0x0000, 0x0000, 0x23fc, 0x0000, 0x0000, 0x2f4d, 0x3867,
+	    0x0000, 0x0432, 0x1f7c, 0x0000, 0x0000, 0x0000, 0x0000, 0x4527,
+	    0x0000, 0x46d1, 0x0b7e, 0x0000, 0x3c08, 0x0000, 0x0000, 0x0000,
+	    0x1a81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x208f, 0x2420,
+	    0x2f5f, 0x0000, 0x0000, 0x0d2e, 0x0000, 0x473d, 0x0000, 0x1b54,
+	    0x0000, 0x0000, 0x22ff, 0x207e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x34ac, 0x0000, 0x0000, 0x0000, 0x4d9e, 0x0000, 0x0000,
+	    0x42e7, 0x23ff, 0x0000, 0x355c, 0x38b4, 0x0000, 0x0000, 0x42cb,
+	    0x0000, 0x1797, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c0,
+	    0x1eef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x083f, 0x0000, 0x1bc1, 0x0000, 0x0000, 0x04ca,
+	    0x4723, 0x0000, 0x0000, 0x0000, 0x2703, 0x0000, 0x3b87, 0x4c32,
+	    0x0000, 0x0000, 0x0000, 0x13f5, 0x0023, 0x0000, 0x0000, 0x14d6,
+	    0x12e2, 0x20b9, 0x372a, 0x0000, 0x2869, 0x0000, 0x0000, 0x381b,
+	    0x1e05, 0x0000, 0x3cd5, 0x0338, 0x010d, 0x0000, 0x0000, 0x0945,
+	    0x46d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0228, 0x155a, 0x1795, 0x0000, 0x0f08, 0x3ea3, 0x0000, 0x24ce,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1930, 0x0000, 0x0000, 0x0000,
+	    0x4858, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ce2, 0x0000, 0x0000,
+	    0x2d06, 0x1252, 0x3591, 0x0000, 0x0000, 0x0000, 0x46ef, 0x4a8f,
+	    0x11ae, 0x0000, 0x0000, 0x1c27, 0x0be4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x28aa, 0x0000, 0x2163, 0x49af, 0x3a4a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x03a9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01d1, 0x0ab2, 0x0000, 0x0000, 0x4540, 0x0000, 0x0000, 0x0000,
+	    0x1622, 0x3abd, 0x0000, 0x0000, 0x0000, 0x16ae, 0x0000, 0x10d5,
+	    0x0f7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x32ea, 0x0000, 0x0000, 0x0000, 0x0408, 0x1cd3, 0x3013, 0x0000,
+	    0x2c38, 0x0000, 0x0000, 0x4579, 0x3466, 0x0a07, 0x0000, 0x0000,
+	    0x4ace, 0x0000, 0x0000, 0x2e16, 0x0000, 0x0000, 0x0000, 0x14aa,
+	    0x0000, 0x0000, 0x0915, 0x4443, 0x0000, 0x46f5, 0x0000, 0x0000,
+	    0x124c, 0x0000, 0x0000, 0x0000, 0x1c22, 0x0000, 0x0000, 0x3c6b,
+	    0x0000, 0x3347, 0x0000, 0x0000, 0x13b6, 0x0000, 0x1888, 0x0000,
+	    0x0000, 0x0000, 0x07d3, 0x0000, 0x0000, 0x0000, 0x0000, 0x296f,
+	    0x0000, 0x4875, 0x0000, 0x4adf, 0x2f4b, 0x0000, 0x45cf, 0x0000,
+	    0x0000, 0x0000, 0x3664, 0x0000, 0x0eff, 0x0000, 0x0000, 0x0000,
+	    0x1b09, 0x0000, 0x0000, 0x0000, 0x480c, 0x0000, 0x2874, 0x0000,
+	    0x39dd, 0x0000, 0x0000, 0x1d68, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2801, 0x1a1f, 0x0000, 0x0000, 0x0000, 0x0000, 0x292d, 0x0000,
+	    0x25dc, 0x21d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x3988, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0738, 0x0000,
+	    0x027e, 0x0000, 0x0000, 0x4c62, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1b97, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0607, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22c1, 0x43e1,
+	    0x48cd, 0x0a70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x105a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1bc4, 0x0000, 0x0000,
+	    0x484a, 0x49a9, 0x3242, 0x0000, 0x17e7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1653, 0x3e0f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1b00, 0x0000, 0x2ffd, 0x3f84, 0x3211, 0x0000,
+	    0x0afe,
+	};
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x63f37e85), (uint32_t *)h);
+
+	const uint32_t m = UINT32_C(0xFFFFFFFF) / 40001 + 1;
+	const uint32_t low0 = m * h[0];
+	const uint32_t low1 = m * h[1];
+	h[0] = (uint16_t)((((uint64_t)low0) * 40001) >> 32);
+	h[1] = (uint16_t)((((uint64_t)low1) * 40001) >> 32);
+	return (g[h[0]] + g[h[1]]) % 20000;
+}
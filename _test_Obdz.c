@@ -0,0 +1,5413 @@
+/* generated with rurban/nbperf 08a5797   -O 8-s _words */
+/* seed[0]: 1726956429, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_static_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_static_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+static const char * const hash_static_keys[20000] = {
+	"aa", "aaamvo", "aaaoepsaxqker", "aaawkatdsy",	/* 4 */
+	"aaazaiwmzo", "aabozllo", "aacwukjxnef", "aafjjxv",	/* 8 */
+	"aafkxt", "aafyjfdobuf", "aagbaqo", "aagwgqbdhc",	/* 12 */
+	"aahpgumys", "aahqwu", "aajoixnfterwky", "aakgie",	/* 16 */
+	"aalazfxybys", "aalqbxuarll", "aamevrbsmiecou", "aanimh",	/* 20 */
+	"aarfotdcsb", "aau", "aauljgrerearvd", "aaupkdl",	/* 24 */
+	"aavgjlqyprl", "aawplxnsl", "aaxw", "ab",	/* 28 */
+	"aba", "abb", "abcroqn", "abcyoudhuyoxv",	/* 32 */
+	"abded", "abdpauwxnyjjw", "abdvzz", "abemcsgtsaqf",	/* 36 */
+	"abgcyzzmsfaohz", "abgfzpabokt", "abghylkt", "abmtelekzgph",	/* 40 */
+	"abnnfppd", "abnznvhmvnpdsm", "abqg", "abrbqe",	/* 44 */
+	"abri", "abrsthrindrt", "abrvngkjcvst", "abttuirixp",	/* 48 */
+	"abucje", "abvlrapgztar", "abxrbvbhskm", "abzjq",	/* 52 */
+	"ac", "aca", "acat", "accdawrk",	/* 56 */
+	"acdumcj", "acfctctvvuqq", "acgeshhyiqp", "acgq",	/* 60 */
+	"acgsyaenn", "achaergtd", "acjqckgbahcww", "acklttjonmfsqw",	/* 64 */
+	"ackosnzmlndp", "aclya", "acndzbghzsnf", "acnjhah",	/* 68 */
+	"acq", "acqg", "acqzgdmgrudfev", "acrupnq",	/* 72 */
+	"actluu", "actnmsaqlxj", "acurtnbcgiuxz", "acvikspj",	/* 76 */
+	"acwmemtmnml", "acwuopbsjrdasc", "acyvmwnl", "ad",	/* 80 */
+	"adbb", "adcncxngm", "adcxr", "adfwg",	/* 84 */
+	"adgcouasqg", "adgnv", "adgorwmlnymtjv", "adgxbuovjvzrjs",	/* 88 */
+	"adhh", "adjgncgej", "adjzjjfcahdzbu", "adkrmjcofnbo",	/* 92 */
+	"adkvocwahadyny", "adnldbde", "adoalbcaylnjdp", "adoinuly",	/* 96 */
+	"adowolj", "adptyuhmk", "adsetbfuyqmlq", "adsyjfsp",	/* 100 */
+	"adu", "aduidlcplhjlw", "advxvdrmq", "advzb",	/* 104 */
+	"adwf", "adwfkizxbp", "adzplry", "adzrfo",	/* 108 */
+	"aeabb", "aeahcthpdbaspv", "aeahwehgc", "aebqchhcmwqshj",	/* 112 */
+	"aec", "aecdpkro", "aeckwcuomuwt", "aedk",	/* 116 */
+	"aedygfpc", "aeejqumjzwwp", "aegnwaegqii", "aegttb",	/* 120 */
+	"aegxoejdtmmrv", "aejhlhfpfwbweh", "aejijtnvnjlf", "aejzdahwbtl",	/* 124 */
+	"aeku", "aeooeu", "aepqhpwunt", "aernwcvnqoqe",	/* 128 */
+	"aerwh", "aesv", "aet", "aetazxsti",	/* 132 */
+	"aeuemhbrat", "aewcxnpkqffcsc", "aeyida", "aezbgcagmrrp",	/* 136 */
+	"af", "afa", "afabswrbr", "afapfsisywdfnf",	/* 140 */
+	"afcapeu", "afdajpdgtnfvw", "afdakepdzxw", "afddxironm",	/* 144 */
+	"affqgbqdmbu", "afftzswhrkc", "afkomgzyzuuwi", "afli",	/* 148 */
+	"afmnbtd", "afngooxtxdncoa", "afnnyjqxaxrb", "afnup",	/* 152 */
+	"afoeyyvxslene", "afovbwhaw", "afp", "afpbwckga",	/* 156 */
+	"afpnnyablos", "afqo", "afrhifomx", "afryjz",	/* 160 */
+	"afu", "afuza", "afwmxu", "afyiwr",	/* 164 */
+	"afypvnadao", "afystviiojvx", "afzaozrqjxnd", "agagun",	/* 168 */
+	"agb", "agbbgucvne", "agbeeflmdidbw", "agbsnfsithwad",	/* 172 */
+	"agbv", "agc", "agcsd", "agdehlqiefh",	/* 176 */
+	"agdpcsrr", "ageqe", "aggii", "agillaghnklvt",	/* 180 */
+	"agimtxt", "agl", "aglwcuiueqio", "agmgy",	/* 184 */
+	"agnqlevdskdkq", "ago", "agplhuovfvrna", "agqmjnishvnq",	/* 188 */
+	"agqynkpfvjit", "agsjix", "agtmromi", "agtybphmu",	/* 192 */
+	"aguaogtcduseei", "aguic", "aguytjckmbl", "agvqdjegqjuqsr",	/* 196 */
+	"agwprdfxkote", "agybygrpdnd", "ah", "ahbhifaktmf",	/* 200 */
+	"ahcct", "ahcsdwuzxmetm", "ahduwpxnwat", "ahefdmovzsj",	/* 204 */
+	"aheoqxi", "ahewgvpsiufqx", "ahf", "ahfqkurbpmnkzk",	/* 208 */
+	"ahhryg", "ahhsabofye", "ahhtnic", "ahlgnmozmmnkn",	/* 212 */
+	"ahlykcsbfezz", "ahmadaj", "ahor", "ahpib",	/* 216 */
+	"ahrkhwhlmdzr", "ahrycyyg", "ahs", "ahtjsnkbpuhw",	/* 220 */
+	"ahvmo", "ahwbwarqo", "ahylzbulai", "ahzhm",	/* 224 */
+	"ahzvwxaxic", "ai", "aiabbdwlhf", "aialwmtykvoz",	/* 228 */
+	"aiamjyqonb", "aicawrwtslqawy", "aig", "aihaiukqsvfylo",	/* 232 */
+	"aihejtm", "aihs", "aij", "aijbmhwsoasy",	/* 236 */
+	"aijebj", "aijjdynfcxgv", "aijsj", "aijxwzfpmr",	/* 240 */
+	"aikdmo", "ailhkdpxhle", "aingte", "aintnw",	/* 244 */
+	"air", "airrvbjwdb", "aitazbtn", "aiuvbj",	/* 248 */
+	"aivfpzdv", "aivraamggx", "aivrmjybsv", "aiwco",	/* 252 */
+	"aiwtcn", "aixlmqiyyutkb", "aiyzuochuktjgr", "aiz",	/* 256 */
+	"aizx", "aj", "ajcebz", "ajexeuma",	/* 260 */
+	"ajfujbdn", "ajirnfcltff", "ajj", "ajlw",	/* 264 */
+	"ajni", "ajogop", "ajpeg", "ajpkohinytla",	/* 268 */
+	"ajpnyfjl", "ajufbpaxc", "ajukmqlxl", "ajusjcrruqqrss",	/* 272 */
+	"ajvn", "ajwnad", "ajxfglmqkd", "ajxxmhjpbst",	/* 276 */
+	"ajy", "ajykjjue", "ajzkohlbnpfn", "ak",	/* 280 */
+	"akbzrbdp", "akcxbwl", "akd", "akdlazy",	/* 284 */
+	"akdwgr", "akdxmrlmj", "akefpqxsrzirma", "akfzpgvbi",	/* 288 */
+	"akgezjlnha", "akhowmxjnmg", "akjqay", "akkadpkznbkjrm",	/* 292 */
+	"aklkzzrtgi", "aklqzw", "aklyfeuf", "akmpovgxd",	/* 296 */
+	"akowhnzwlmbv", "akpca", "akpgjhg", "akpwxtipo",	/* 300 */
+	"akqwfhfoctaka", "akrjrqaqqwqed", "akroj", "akrupa",	/* 304 */
+	"akssyan", "aktpm", "akufanjkxmoxet", "akyaeacuxejm",	/* 308 */
+	"akywfelhvsbwzx", "akzcid", "akztebpoapmapf", "al",	/* 312 */
+	"aleejapuapcyzs", "alfzrlptvhdikn", "algykc", "alh",	/* 316 */
+	"alhwkvvhxdwq", "alipupnolwtat", "alirx", "aliu",	/* 320 */
+	"alkndu", "alllruhtbki", "alnncrnou", "alpgzprsmya",	/* 324 */
+	"alqlsmfpewpo", "alrokxhurell", "alrpbhdkfvd", "als",	/* 328 */
+	"aluqswv", "alv", "alwbqvrib", "alwodnzveidli",	/* 332 */
+	"alybopztfvkmwl", "am", "amafiexdione", "amagl",	/* 336 */
+	"amdtrjkowurky", "amdxqzu", "amepbcmqers", "amgl",	/* 340 */
+	"amglwwmvafic", "amhocvas", "amianjuvwy", "amiwnd",	/* 344 */
+	"amjfbefm", "amjr", "amjyxnjsu", "amk",	/* 348 */
+	"aml", "amlajk", "amlkgaoelk", "amnd",	/* 352 */
+	"amp", "amqumqgepywx", "amtespnycxhrna", "amua",	/* 356 */
+	"amuaclj", "amvjbh", "amvuhhqkzczohh", "amw",	/* 360 */
+	"amxjh", "amxqtdhni", "amyg", "amyic",	/* 364 */
+	"amypheipnls", "an", "anai", "anbvfjavrwpyin",	/* 368 */
+	"anemeaieosxx", "anff", "angdqpdmft", "anguwxzlilk",	/* 372 */
+	"aninljfxl", "anlfb", "anlvcbtkbgqhf", "anptornqlqtpis",	/* 376 */
+	"anpzxxcntx", "anqeya", "anqgigorvtg", "anqw",	/* 380 */
+	"anrkwivghygoiv", "ans", "ant", "anuuwxgudkzdw",	/* 384 */
+	"anwklkxyn", "anxwedh", "anzigluouypzo", "anzrgxko",	/* 388 */
+	"ao", "aoaqfafxmywmkf", "aob", "aobm",	/* 392 */
+	"aocbjq", "aocgprkwsyelk", "aofdiebh", "aofeeilsphqi",	/* 396 */
+	"aogr", "aohfxjunb", "aohshtvbl", "aoipkjqnskqxv",	/* 400 */
+	"aojp", "aojpzddjar", "aokjjy", "aokszgzzmb",	/* 404 */
+	"aolgzpjcanya", "aolismvrqhw", "aoluupkbomvtw", "aongrogeaitfe",	/* 408 */
+	"aonm", "aoobzdhtvvwy", "aooidxlqowtb", "aopphpcemi",	/* 412 */
+	"aoqclsk", "aoqvpwifudrraw", "aordmjaccjfra", "aoreagatoud",	/* 416 */
+	"aovjcrmiu", "aovk", "aovoufl", "aovvtczrc",	/* 420 */
+	"aovxq", "aox", "aoxkxeye", "aoxxzsgg",	/* 424 */
+	"aoyla", "aoymp", "aoz", "aozchu",	/* 428 */
+	"ap", "apdbribsdymcir", "apdq", "apdumidzy",	/* 432 */
+	"apfpjgsiztsi", "apght", "apijmcafchdgjq", "apjqh",	/* 436 */
+	"apmb", "apnbsvx", "apnsa", "apnxqbhntoevwz",	/* 440 */
+	"apoagwnopnc", "apoksoahdk", "apoxufrps", "appxvypap",	/* 444 */
+	"aprkejwd", "aprrxamsubs", "apszjdhexvgrhi", "aptmbojveltgbm",	/* 448 */
+	"aptnbhdxmvrqas", "apuw", "apv", "apvecnkopt",	/* 452 */
+	"apwilmyz", "apxvrkgnsi", "apyotdpei", "apzvkshb",	/* 456 */
+	"aq", "aqaeyen", "aqaxxjbxfl", "aqbacwwhqor",	/* 460 */
+	"aqbj", "aqdayjchue", "aqdekxkzks", "aqdhf",	/* 464 */
+	"aqfhlnmxzcdi", "aqftiwbsvmutcd", "aqfuykqjfa", "aqg",	/* 468 */
+	"aqgqyaujeajf", "aqiy", "aqjlr", "aqjra",	/* 472 */
+	"aqkr", "aql", "aqlduhjid", "aqlhyotznj",	/* 476 */
+	"aqlxubdylgq", "aqm", "aqnwqkbt", "aqozrrayhcz",	/* 480 */
+	"aqspytz", "aqt", "aqtkglsvjlwg", "aqvpvvskgmdzda",	/* 484 */
+	"aqxydxmjjdl", "aqynpq", "aqyom", "aqz",	/* 488 */
+	"aqzfqhxs", "aqzite", "ar", "ara",	/* 492 */
+	"arcpe", "arcuckn", "ardxeq", "ardzqqnzee",	/* 496 */
+	"are", "arghlqfwhnodip", "arhpfrahecaek", "aribks",	/* 500 */
+	"arict", "arikk", "arivnzklsg", "arjvyxuecqlsz",	/* 504 */
+	"ark", "arkhlu", "arlxkk", "armorcdpej",	/* 508 */
+	"armqdlybyplyn", "arms", "arnrjwcdzkwzqo", "arnzzukeimkcc",	/* 512 */
+	"arohoeaiy", "arqeqfnk", "arrbknk", "arrdni",	/* 516 */
+	"arrtztk", "aru", "arucxbw", "arxcppjvzzmw",	/* 520 */
+	"aryswrjcv", "arzbdrgcmfau", "arzhnfvf", "arzuljwsk",	/* 524 */
+	"asalrmfafppxfd", "asbeorwhpaatq", "ascmpo", "asdgbs",	/* 528 */
+	"asfxudbxe", "asgecyh", "asglzmhxtvfdk", "asgshnvjawpg",	/* 532 */
+	"ashlpq", "ashulbmpklnf", "asiozyxlcb", "asiq",	/* 536 */
+	"asitgqqvz", "asizstlxnmldg", "asjizgsn", "aslx",	/* 540 */
+	"asnhn", "asnjeueyiibnr", "aso", "asp",	/* 544 */
+	"asr", "asroqqyd", "assdbsqadkklyr", "asss",	/* 548 */
+	"assujmboblyla", "assvf", "asukvsmwgtztm", "asun",	/* 552 */
+	"asupfarknyyqhu", "asxbiaro", "asxtnyw", "aszjj",	/* 556 */
+	"aszqjyz", "at", "atasxvjfdd", "atbgsbxekj",	/* 560 */
+	"atdxmowgxodbg", "atg", "atgflcfwh", "atghmtgzeb",	/* 564 */
+	"atgs", "ath", "atij", "atkramwifnwq",	/* 568 */
+	"atkwncxsx", "atlzvm", "atmuiszpjkp", "ato",	/* 572 */
+	"atrb", "attdvy", "attt", "atuavewemtrsm",	/* 576 */
+	"atumme", "atur", "atvaeladu", "atvruu",	/* 580 */
+	"atwxgh", "atzyt", "au", "auarghyogn",	/* 584 */
+	"auby", "aucfoymvqzjeeq", "auehjyeax", "auemxrdoay",	/* 588 */
+	"auepbxwj", "aufjgmihgiwou", "augdbjermtl", "augkpkwxbi",	/* 592 */
+	"augpp", "augqmrgdnuuq", "augyhqves", "augyyboevwfgt",	/* 596 */
+	"auhr", "aujwepnim", "aulld", "aumywooz",	/* 600 */
+	"auomaojqsownim", "auoypcs", "auqrwvdyryab", "aurghovsqy",	/* 604 */
+	"aurwo", "ausybq", "autcnzpgn", "autoht",	/* 608 */
+	"auvbuykmd", "auvnrkb", "auvwrpfygwjgen", "auyxu",	/* 612 */
+	"av", "avap", "avbcyego", "avc",	/* 616 */
+	"avcmlnhmcmvwph", "avctrko", "avejfof", "avelskvcusw",	/* 620 */
+	"avfgogievupuf", "avhd", "avhks", "avhnhwgots",	/* 624 */
+	"avhrnkcn", "aviqn", "avknwpc", "avlbkhyycggr",	/* 628 */
+	"avlez", "avlijhsccnty", "avoewxrvewnk", "avpxgzavyb",	/* 632 */
+	"avrtcuwxd", "avsmcb", "avsnfa", "avsoi",	/* 636 */
+	"avstzwuxnyukeb", "avucflgumvboz", "avvm", "avvrcjnpw",	/* 640 */
+	"avytejzij", "avz", "aw", "awadf",	/* 644 */
+	"awaenhasdvibam", "awbxrtjoa", "awckekjgfbhfoz", "awdwwfpce",	/* 648 */
+	"awelebpxvyz", "awfzwgoeyh", "awktgwbrh", "awmr",	/* 652 */
+	"awpceoqjuewew", "awq", "awrlebnfhidt", "awrpp",	/* 656 */
+	"awwaipm", "awwbunk", "awwdaxmozk", "awwvjop",	/* 660 */
+	"awxjflfkvzcf", "awyyehm", "awzpvraboqxrh", "ax",	/* 664 */
+	"axbub", "axcus", "axfpbzmiscjwe", "axgvfbwvwn",	/* 668 */
+	"axifhymfsrre", "axirzlmia", "axjovnoynhxcgp", "axjqcyho",	/* 672 */
+	"axkyzbvmj", "axmatqc", "axpaljfblns", "axpjimge",	/* 676 */
+	"axqclcoujeu", "axqfflmwagnb", "axvbmjcmu", "axxhcrfysw",	/* 680 */
+	"axxwaq", "axzhnlgyw", "axznsdejodm", "ay",	/* 684 */
+	"ayaguqcyf", "ayardvhgchqlwt", "aybkz", "aybsbwif",	/* 688 */
+	"aycixdathok", "ayd", "aydt", "aydvrvlia",	/* 692 */
+	"aye", "ayfle", "ayfpvmjju", "ayfyqo",	/* 696 */
+	"aygjtv", "aygl", "aygse", "aygvbpwqxto",	/* 700 */
+	"ayk", "ayndurltg", "ayqroi", "ayrtxzkgx",	/* 704 */
+	"ayurhakpbgm", "ayv", "ayvhf", "ayvidfhrm",	/* 708 */
+	"ayvs", "ayvz", "ayxdzd", "ayxkgs",	/* 712 */
+	"ayy", "az", "azaeznmkwi", "azbibra",	/* 716 */
+	"azdcmxfes", "azdkvwfwudtabt", "azdrbjhmwqmlxq", "azeu",	/* 720 */
+	"azgiwdgycss", "azhq", "azhxsnqtjp", "azkewersoh",	/* 724 */
+	"azkgkokspcsxyy", "azlldh", "azmbiqx", "aznft",	/* 728 */
+	"azojzmhmvgw", "azqzqvhelmnekn", "azsjaleohobshu", "azunqkleaevv",	/* 732 */
+	"azuvj", "azuvtvfjghuvki", "azvkpvmmqv", "azzcerqz",	/* 736 */
+	"azzeqljhdz", "ba", "baazajzi", "babof",	/* 740 */
+	"badoc", "badrq", "baeaifbpywwns", "baediyfxp",	/* 744 */
+	"baefi", "baeq", "bagqafqf", "bagufnamedqhln",	/* 748 */
+	"bahpxm", "bahqzidllfa", "bahvobkwdidd", "baicsilotqif",	/* 752 */
+	"baixrb", "bajgfdbgxfkrlv", "bakpwahrebmdh", "bakvd",	/* 756 */
+	"bakxb", "balrxviengxws", "bammvjyqvjhx", "bamudyxdpugduv",	/* 760 */
+	"banv", "baotq", "bappr", "bav",	/* 764 */
+	"bawvglqhodxlv", "bawzbmwv", "baxmmnvestev", "baymotz",	/* 768 */
+	"baziywgorpwxn", "bb", "bbaibijfrptw", "bbaqrzywu",	/* 772 */
+	"bbayrlie", "bbbzxvaokcjjn", "bbdkzao", "bbdtbwrrzyp",	/* 776 */
+	"bbetmejicwr", "bbglsgkhhpjgy", "bbh", "bbjmzj",	/* 780 */
+	"bbrciffax", "bbtbfnuuhcind", "bbtjg", "bbtrkn",	/* 784 */
+	"bbuwoojy", "bbvatgkvdogzxw", "bbvkeedqgsf", "bbwoeopqygz",	/* 788 */
+	"bbww", "bbxgulxlql", "bbxy", "bbynjbzndb",	/* 792 */
+	"bbytzrg", "bc", "bca", "bcbogjbvqrza",	/* 796 */
+	"bcbue", "bccuohhjalg", "bcemhv", "bcf",	/* 800 */
+	"bcfqaunfrb", "bcfxvjqoqaccu", "bcgejmayphgj", "bcgfmuo",	/* 804 */
+	"bckeht", "bckldqjbp", "bclavkpvnjmu", "bcleg",	/* 808 */
+	"bclpx", "bcmtpljsczw", "bcnkqlrhjq", "bcnqq",	/* 812 */
+	"bcnzjtwyiyy", "bcosnlgqblp", "bcpkhby", "bcpkng",	/* 816 */
+	"bcqvvjzlegnf", "bcr", "bcrzqzn", "bcsm",	/* 820 */
+	"bcsykbyrcb", "bctpqwmsnvh", "bcuh", "bcvljjb",	/* 824 */
+	"bcvqnowfeg", "bcxd", "bczt", "bd",	/* 828 */
+	"bdacsmnculmcq", "bdcprnlpdkrvl", "bdfnevzpq", "bdhccb",	/* 832 */
+	"bdjilotpkildck", "bdkndvylxuxo", "bdl", "bdlyrtxes",	/* 836 */
+	"bdmfyqwxuf", "bdnbkoe", "bdnejntcdrqve", "bdnufpoxdxux",	/* 840 */
+	"bdpnc", "bdpybuwwa", "bdrapgoaq", "bdrkkeq",	/* 844 */
+	"bdrrborticaxib", "bdseqqylrizsul", "bdtqq", "bdudzrtalhwcap",	/* 848 */
+	"bdui", "bdvuvhboykx", "bdw", "bdycki",	/* 852 */
+	"bdyzmnp", "be", "beagrthtp", "becmmblivgijmo",	/* 856 */
+	"bedwfiaesztb", "beedabmibnzzb", "behahrymnzmlgc", "beilkaiubdvku",	/* 860 */
+	"beivnwe", "bekxbx", "belpl", "belw",	/* 864 */
+	"bemcinpjdq", "beolqvpzfxf", "beoxxqgo", "bepewpnpjatiru",	/* 868 */
+	"bepiorywl", "bepmsur", "beqzxtqbfdr", "berwgeebepz",	/* 872 */
+	"besmlmrphhawpr", "bevbeeofe", "bevz", "bewamoowipmcb",	/* 876 */
+	"bewwuq", "bexgr", "beyxvt", "bezoe",	/* 880 */
+	"bf", "bfasppnandsz", "bfcfvan", "bfdixpxt",	/* 884 */
+	"bfex", "bfezpbufygz", "bff", "bffuecdod",	/* 888 */
+	"bfgndmggnr", "bfgwpr", "bfirbahyc", "bfkjw",	/* 892 */
+	"bfleejld", "bfmoevqtgxr", "bfnotan", "bfocrratxrcfqm",	/* 896 */
+	"bfor", "bfqdcut", "bfqgtpjkndqch", "bfqhuvfmvzyji",	/* 900 */
+	"bfry", "bfud", "bfudo", "bfuelxdm",	/* 904 */
+	"bfulzk", "bfvkfarob", "bfvqoc", "bfx",	/* 908 */
+	"bfxojuzxhqu", "bfyavwepuqps", "bfyeovbyiuw", "bfzsfvxobwhfok",	/* 912 */
+	"bg", "bgaj", "bgakdggioxxtsd", "bganhvs",	/* 916 */
+	"bgaxooeiqvbmtz", "bgc", "bgckovjdh", "bgdfc",	/* 920 */
+	"bgdrlzv", "bgh", "bgiuabechv", "bgjingfapqbe",	/* 924 */
+	"bgld", "bgmlldvucq", "bgn", "bgnhp",	/* 928 */
+	"bgnkeruy", "bgonv", "bgqigoxdfl", "bgqkccdufr",	/* 932 */
+	"bgsdzqeklmuyn", "bgtfqtqzskrp", "bgu", "bgvwfdzhllnt",	/* 936 */
+	"bgwpygmkjptqi", "bgwzmhj", "bgyojmkonvnszc", "bgzyhxcsvstjpq",	/* 940 */
+	"bgzzd", "bh", "bhbidhdvx", "bhcklnltpaetl",	/* 944 */
+	"bhcqzspz", "bhdrcxio", "bhezkqganmkla", "bhftwm",	/* 948 */
+	"bhfukaju", "bhha", "bhjnmrmwuufq", "bhkdpkcplsk",	/* 952 */
+	"bhkmw", "bhmsap", "bhqjgtptbak", "bhrcwalapbux",	/* 956 */
+	"bhsfq", "bhswgx", "bhw", "bhwbjuoghpyphf",	/* 960 */
+	"bhwdvywdg", "bhwtetktboou", "bhyvanlexudizp", "bhyzesomeviv",	/* 964 */
+	"bi", "biamytpegbp", "bic", "bidznmilgb",	/* 968 */
+	"bigmtmnhlhcadk", "bikawv", "bimnkx", "bink",	/* 972 */
+	"biopdqt", "bip", "biph", "biqakmpoxsdtg",	/* 976 */
+	"biqgcz", "biqnbx", "birtinutrik", "bisahszesqkyfq",	/* 980 */
+	"biszstem", "bitbidpy", "biteikqwq", "bivh",	/* 984 */
+	"bivy", "biycafsmilc", "biygzzsmxiy", "biziirfyc",	/* 988 */
+	"bizj", "bizk", "bj", "bja",	/* 992 */
+	"bjbfr", "bjbiknmw", "bjceinmzedt", "bjcopoptplk",	/* 996 */
+	"bjd", "bjdiiqxrit", "bjeapaqyqb", "bjehuqnch",	/* 1000 */
+	"bjemyledserxxr", "bjhee", "bjhzcbtyddg", "bjibzwckdwu",	/* 1004 */
+	"bjidvw", "bjikqaerbgk", "bjjgfr", "bjjljfls",	/* 1008 */
+	"bjjnikgfcr", "bjkcpopbl", "bjkwytxbasocj", "bjlqgblbuvrr",	/* 1012 */
+	"bjlwqalwvlt", "bjlyvawtoksa", "bjmneuu", "bjmvo",	/* 1016 */
+	"bjnnv", "bjnsyaohwlw", "bjouwlztv", "bjpcl",	/* 1020 */
+	"bjpsj", "bjrpgwvmogoweb", "bjui", "bjupfsqvk",	/* 1024 */
+	"bjuvzhxdtnti", "bjvw", "bjwemmoe", "bjyblgkf",	/* 1028 */
+	"bjydptvnpmixkc", "bjztpomavlhpef", "bk", "bka",	/* 1032 */
+	"bkatjqwtsyubi", "bkbmmvkjqdzzp", "bkbqhnrjrf", "bkbymfdxh",	/* 1036 */
+	"bkcaozeooam", "bkcfh", "bkdjw", "bkfkbgzynp",	/* 1040 */
+	"bkfruuncovceme", "bkfrzgevc", "bkgy", "bkhbkldlaxnb",	/* 1044 */
+	"bkhbwawf", "bkhgsxoqh", "bkhploh", "bkhywfm",	/* 1048 */
+	"bkldofml", "bklqhjnblz", "bkmvcczanfo", "bknymoxhz",	/* 1052 */
+	"bko", "bkptozixprdqzv", "bksidfnqja", "bkt",	/* 1056 */
+	"bkttq", "bkvrwp", "bkvuqethv", "bkxbatuw",	/* 1060 */
+	"bkxzvsodhvhrpj", "bkyqw", "bkzcu", "bl",	/* 1064 */
+	"blacbniwpbec", "blathzohqkfnw", "blaxvvpocbww", "bldciboswxjez",	/* 1068 */
+	"bldmewvggqa", "bldqgafcg", "ble", "blfgcchmrbp",	/* 1072 */
+	"blfiutoezbuyon", "blhykgcjcfhj", "blijgbdkycir", "bljhuqjysfsjcy",	/* 1076 */
+	"blkaifdchb", "blkcnjswgc", "blkrddguar", "bllcswqruiw",	/* 1080 */
+	"blmxe", "blqzpgwnocn", "blrjnjnq", "blstd",	/* 1084 */
+	"blsz", "bltg", "blvjeisyf", "blx",	/* 1088 */
+	"blxd", "blydkbgx", "blywjk", "blz",	/* 1092 */
+	"blzgxrxchhoxy", "bmbbgumfhg", "bmbc", "bmbe",	/* 1096 */
+	"bmbsrkhll", "bmc", "bmcfywrj", "bmdtcrb",	/* 1100 */
+	"bmecwmmjs", "bmfvcfpke", "bmfvr", "bmgtfsuj",	/* 1104 */
+	"bmgxrjbk", "bmmdpbguuf", "bmmnkdgkem", "bmnjbn",	/* 1108 */
+	"bmnrvkp", "bmob", "bmpgfq", "bmqve",	/* 1112 */
+	"bmrinfm", "bmrkx", "bmstcbgj", "bmtcr",	/* 1116 */
+	"bmthbgy", "bmu", "bmucfzasp", "bmulp",	/* 1120 */
+	"bmwrfvqhqbfbal", "bmwtqi", "bmxaovs", "bmydpgfvtglwhl",	/* 1124 */
+	"bmyr", "bn", "bnbmofy", "bnbq",	/* 1128 */
+	"bncgas", "bncmzee", "bncvygl", "bndesm",	/* 1132 */
+	"bneoivryzmuppu", "bnidrmlvlos", "bniltwvov", "bnim",	/* 1136 */
+	"bniuiqrby", "bnjvveidsdmjd", "bnleecgutmj", "bnnyruuzyi",	/* 1140 */
+	"bnoudfoprj", "bnp", "bnppnvvkd", "bnprhihfej",	/* 1144 */
+	"bnprkgaeppi", "bnrv", "bntiwyeuqpri", "bntqm",	/* 1148 */
+	"bnuxju", "bnv", "bnvjukcxbhlp", "bnvooodksq",	/* 1152 */
+	"bnwmpyx", "bnwtdvtvc", "bnx", "bnxilwdggxxbn",	/* 1156 */
+	"bnxneruekx", "bnyaahtxwg", "bnybhazdp", "bnzdtu",	/* 1160 */
+	"bnzeafz", "bnzqfijlcvpenf", "bnzvqw", "bo",	/* 1164 */
+	"boalqokzfwvg", "bobhdqi", "bocymygfiudf", "bodaunvxsvxoo",	/* 1168 */
+	"bodpdbgihpbl", "bodrrxxlzglhc", "boedwt", "boeouhid",	/* 1172 */
+	"bofzyeqk", "boge", "boirp", "bondl",	/* 1176 */
+	"bop", "bopbayniqmdv", "boppn", "bopriurkxmpuqs",	/* 1180 */
+	"boqylknm", "borpgugei", "borrfniyw", "bort",	/* 1184 */
+	"boswkzi", "bouilvxgcj", "bovyhbyzoq", "bowlrctnvq",	/* 1188 */
+	"bowoaswn", "boxg", "bozvgokcfw", "bp",	/* 1192 */
+	"bpayshhqry", "bpbklkxzuhibbe", "bpbvmdp", "bpbzactoazuhe",	/* 1196 */
+	"bpczgeqm", "bpekn", "bpetdxjzskgczu", "bpgcvzoed",	/* 1200 */
+	"bphlu", "bphmydk", "bphuahvytcqi", "bpjl",	/* 1204 */
+	"bpjypmmjhbemhm", "bpkmrxmgj", "bpkp", "bpkpkmaa",	/* 1208 */
+	"bpkwnx", "bpleiu", "bpllz", "bpmlmfw",	/* 1212 */
+	"bpmryoxwqfvo", "bpplest", "bppljhtgdfwnae", "bpqcdquwmzqv",	/* 1216 */
+	"bpry", "bpscjbdeausjub", "bpsngdhq", "bptp",	/* 1220 */
+	"bpvdbmxi", "bpveqfrrb", "bpvmwulmqfrxbq", "bpwegk",	/* 1224 */
+	"bpzdrqwxw", "bpzyeiyrqzsq", "bq", "bqajagvpg",	/* 1228 */
+	"bqcpfwcorm", "bqerfmrla", "bqevfkoggqit", "bqgqaomgsuaz",	/* 1232 */
+	"bqgqvovdduz", "bqidkpwattacg", "bqjcohfsssgqj", "bqjvext",	/* 1236 */
+	"bqk", "bqklohwdpncmpw", "bqn", "bqoqlrdvoc",	/* 1240 */
+	"bqswkmizufbvbs", "bqtyxkb", "bqublwi", "bqvlndo",	/* 1244 */
+	"bqwkcyms", "bqx", "bqybp", "bqyjkobjyvkiqg",	/* 1248 */
+	"bqylqkysligxzj", "bqyxaqbaivrnxd", "br", "braknzs",	/* 1252 */
+	"brawx", "brcmflxdbx", "brdix", "breiixqbvgcpj",	/* 1256 */
+	"brgrcng", "brgspcqgohzkqy", "brijzr", "briplk",	/* 1260 */
+	"brku", "brlnpcajnife", "brm", "brnhbzacnbym",	/* 1264 */
+	"brnjfpmpzxhqu", "brnqo", "brnxjkxthg", "brpanjsxk",	/* 1268 */
+	"brq", "brqpaok", "brqxni", "brqy",	/* 1272 */
+	"brri", "brroodiiollv", "brrsujnjyw", "brrzgyzg",	/* 1276 */
+	"brujuufxrazwfw", "brulapmotccfa", "brvjkxmuvyfat", "brvk",	/* 1280 */
+	"brxllokql", "brybhlh", "bryk", "brzkptfim",	/* 1284 */
+	"brzpf", "bs", "bsarmpmxnk", "bscxd",	/* 1288 */
+	"bsgngrtxgbcju", "bshf", "bsjmseruly", "bsjugvvpv",	/* 1292 */
+	"bskjdhuywwak", "bsklnkqsghxa", "bsldo", "bsoyz",	/* 1296 */
+	"bspwptpdynveo", "bsrk", "bsrvftwaivbi", "bss",	/* 1300 */
+	"bsuyxkmi", "bswzdd", "bsxpelrcehncu", "bsyg",	/* 1304 */
+	"bsyllfo", "bszqmktytdwxkw", "bt", "bta",	/* 1308 */
+	"btahnpwg", "btdz", "btexkfuczdglu", "btflwyoi",	/* 1312 */
+	"btg", "btgxclatimjn", "btic", "btkjjsud",	/* 1316 */
+	"btkvavke", "btlsjeiepnuxtv", "btnqvhu", "btntlkfuik",	/* 1320 */
+	"btnvmdk", "btpyoxapij", "btqcgelwbsg", "btqvtdpugoaulk",	/* 1324 */
+	"btqxaoty", "btqzabdjbj", "btt", "btwkpci",	/* 1328 */
+	"btwrkhcwcjk", "btxgedfg", "btyi", "bu",	/* 1332 */
+	"buamkjcdzqoayr", "bub", "bubmyj", "bucsaosuoyxb",	/* 1336 */
+	"budlnnaonqopcn", "budlzaiy", "buexxtcoxxh", "bufeyqfhtpkn",	/* 1340 */
+	"bufuhruvuohba", "buhg", "buiss", "bujawtzosiprvd",	/* 1344 */
+	"bulsyyfj", "bulyjrrx", "bunsahlbdcpvk", "bunsjnjuqfxfz",	/* 1348 */
+	"buqsoumtmb", "buqysrjthffszn", "burjcsuovkpmt", "burzepjeumfx",	/* 1352 */
+	"buspbwq", "buu", "buubydokpgjn", "buvwlareosksoz",	/* 1356 */
+	"buw", "buwxcwmdmunh", "buyhhgraohnh", "buzi",	/* 1360 */
+	"buzknnq", "buzwmop", "bv", "bvccao",	/* 1364 */
+	"bvciydm", "bvdius", "bve", "bvfmnezg",	/* 1368 */
+	"bvgxgih", "bvhfd", "bvjalthlsf", "bvjvtfvaatocfe",	/* 1372 */
+	"bvjxdcdptxa", "bvkcsptfvgtkoj", "bvkxorxcyjvd", "bvmns",	/* 1376 */
+	"bvqiggz", "bvrbrovzbstvlv", "bvrgimeiaem", "bvrngmigzalz",	/* 1380 */
+	"bvsnbyjwggdht", "bvstyydnsiwfqp", "bvtkhh", "bvtthc",	/* 1384 */
+	"bvtuby", "bvtwltr", "bvwqkisb", "bvxbvdgxbcur",	/* 1388 */
+	"bvxmbdyukium", "bvxollyzau", "bvymmidjcyc", "bvywphfved",	/* 1392 */
+	"bw", "bwaao", "bwcyuhz", "bwdmxeu",	/* 1396 */
+	"bwgaygrsu", "bwghngvjefe", "bwgkeswgvx", "bwgt",	/* 1400 */
+	"bwjpnk", "bwlc", "bwmfxqybdceud", "bwnvdlmji",	/* 1404 */
+	"bwoxzsibfrwn", "bwq", "bwqjwoibz", "bwtcbdrabxjpi",	/* 1408 */
+	"bwtfvi", "bwtm", "bwtn", "bwtxqht",	/* 1412 */
+	"bwuxxgzald", "bwwg", "bwwgzbbpsqr", "bwzlfyb",	/* 1416 */
+	"bwzyrmaghsy", "bx", "bxafvo", "bxcqus",	/* 1420 */
+	"bxfsykeevdus", "bxhefmozw", "bxifv", "bxioxztoaz",	/* 1424 */
+	"bxirjstyziom", "bxiygklloyvtm", "bxjkcvwizcdua", "bxmquboivvg",	/* 1428 */
+	"bxnwugmeryzdn", "bxpa", "bxqwgsvqrlex", "bxranfwgtx",	/* 1432 */
+	"bxrgqdrmphvux", "bxrjkgxqk", "bxrxzjlr", "bxsgrbddzepfdh",	/* 1436 */
+	"bxvuah", "bxvv", "bxxytn", "bxyrt",	/* 1440 */
+	"bxzqnhsylsv", "by", "byae", "byaquao",	/* 1444 */
+	"bybglejzqxj", "bybs", "bydbb", "bydxzci",	/* 1448 */
+	"bydzlgr", "byeqgylfxgpjnv", "byfisdtqchqkh", "byfpybjo",	/* 1452 */
+	"bygbjfwawebp", "byghm", "bygw", "byiau",	/* 1456 */
+	"byiiou", "byil", "byjgw", "byl",	/* 1460 */
+	"bymlkpzrll", "bynilhpfmft", "byoduuyho", "bypfaldaunhwvz",	/* 1464 */
+	"byqfpbexx", "byr", "byrb", "byrmyxhavxz",	/* 1468 */
+	"byrtcw", "byrvbiarxspngs", "byt", "byuvtzysocdrl",	/* 1472 */
+	"byuysfpzfyofn", "byzxp", "bz", "bzbyuhgmvymtp",	/* 1476 */
+	"bze", "bzfizeek", "bzfrhygcdxirc", "bzfxxo",	/* 1480 */
+	"bzfzngv", "bzgopqatxae", "bzgvucmdvojvq", "bziyt",	/* 1484 */
+	"bzjo", "bzkgllfpr", "bzlnecjadugakp", "bzmxagrp",	/* 1488 */
+	"bznvzchok", "bzohr", "bzqpwc", "bzrqbnojmsj",	/* 1492 */
+	"bzrxiuhn", "bzsl", "bzuirq", "bzurcuuqbei",	/* 1496 */
+	"bzuxrpet", "bzvxlabphi", "bzxn", "bzzzopegbad",	/* 1500 */
+	"ca", "caac", "caacl", "caboub",	/* 1504 */
+	"caclgsg", "caclswcnkcfuxd", "cacwgzrxaheyhz", "cacwtm",	/* 1508 */
+	"cad", "cadswcmb", "caejgfwepjmgaz", "cag",	/* 1512 */
+	"caiulajm", "cajjyzwzg", "cajxyydyflfyj", "cakphnle",	/* 1516 */
+	"camkmjwevrgy", "canjm", "cannmbbh", "catoxoecoc",	/* 1520 */
+	"caubxs", "cavklyjq", "cawykengteg", "caxtdlyejcqv",	/* 1524 */
+	"caxw", "caygapafrr", "cazdkrjdqn", "cazkkj",	/* 1528 */
+	"cb", "cbamxnathi", "cbb", "cbbdpoyou",	/* 1532 */
+	"cbbkzim", "cbcimmzttw", "cbd", "cbdewm",	/* 1536 */
+	"cbftptpmuhn", "cbieankxc", "cbierpi", "cbixibqnpd",	/* 1540 */
+	"cbjuiqgtjog", "cbl", "cblz", "cbmtzepjerjvh",	/* 1544 */
+	"cbmytwarkkwl", "cbnelzygcoldst", "cbnosxgxw", "cbpcq",	/* 1548 */
+	"cbpiieerlgd", "cbsfe", "cbtvknedz", "cc",	/* 1552 */
+	"ccabzpecjo", "ccb", "cceribgnkviv", "ccfax",	/* 1556 */
+	"cch", "ccjrszvd", "cclovuy", "cclsoineiycz",	/* 1560 */
+	"ccovmtpevvbjj", "ccqdlscinmanx", "ccqsbogrc", "ccquzjilhevrcv",	/* 1564 */
+	"ccqzhvooynh", "cctyzbry", "ccub", "ccujdodcuaiop",	/* 1568 */
+	"ccwfincejrx", "ccwp", "cczbgqcmp", "cczhhuzz",	/* 1572 */
+	"ccztywjmspbpo", "cd", "cdaaozbyjekjs", "cdaxjhnrqenp",	/* 1576 */
+	"cdbxl", "cddmhdclba", "cdexkkeamtbt", "cdfox",	/* 1580 */
+	"cdfsqvtabed", "cdfwo", "cdh", "cdhd",	/* 1584 */
+	"cdmkac", "cdoeoi", "cdojdmfzeulgz", "cdp",	/* 1588 */
+	"cdppvbqa", "cdq", "cdqtbaml", "cdr",	/* 1592 */
+	"cdscfioaooygx", "cdtm", "cdw", "cdwcurjxggijo",	/* 1596 */
+	"cdynncwnidktih", "cdzjvlksya", "cdzoqsw", "ce",	/* 1600 */
+	"cebaf", "ceccn", "cecf", "cecqbtbienppi",	/* 1604 */
+	"cecqdabcftpc", "ceelvcgub", "ceenlhjpgahn", "cefaazsovudw",	/* 1608 */
+	"ceg", "cegcdnmos", "cehfhrdfqxo", "cejhh",	/* 1612 */
+	"celvlfzcftxzl", "celzb", "cemfhiynhid", "cenvmfqo",	/* 1616 */
+	"ceodmnsns", "ceouker", "ceowrcaec", "ceqd",	/* 1620 */
+	"ceqzyuo", "ceswfzxf", "cetbyqyoyanmst", "ceuk",	/* 1624 */
+	"ceurtbwesoydbg", "cexj", "cexwtsisteb", "ceynnunxopue",	/* 1628 */
+	"ceywjntkhauw", "cf", "cfa", "cfajkuriailsof",	/* 1632 */
+	"cfdejsewkkxn", "cfdnksgml", "cfdyktayxownky", "cffcwj",	/* 1636 */
+	"cffgpoqihiv", "cfftvqjpqge", "cffysas", "cfgcioz",	/* 1640 */
+	"cfhbmhxooock", "cfhqais", "cfijkimh", "cfkoyrfwp",	/* 1644 */
+	"cfkzd", "cflyyibnm", "cfomp", "cfornpqzqny",	/* 1648 */
+	"cfoy", "cfq", "cfqc", "cfs",	/* 1652 */
+	"cftndkrmfyid", "cftw", "cfuirjvrro", "cfuvqlokph",	/* 1656 */
+	"cfvkrxu", "cfvvusuimd", "cg", "cgaiyzhxody",	/* 1660 */
+	"cgbz", "cgcnsqogkrrh", "cgcqytpodl", "cgea",	/* 1664 */
+	"cgeddigcpksc", "cgedllcpd", "cgfi", "cgfkg",	/* 1668 */
+	"cgfnxhbje", "cgfsymxacuyg", "cgftloyznyswv", "cgg",	/* 1672 */
+	"cgghapkhsen", "cggnwkqmvawo", "cghphvawshuarz", "cgjgfsifews",	/* 1676 */
+	"cgkg", "cgksengsholrb", "cgmwmdcixid", "cgnhlyumpvq",	/* 1680 */
+	"cgqwzhfg", "cgrpfki", "cgrvhjoywhtnag", "cgtjgjwrhcbizp",	/* 1684 */
+	"cgu", "cgvqivimmeojpu", "cgvsbaoy", "cgwmynwsjqvob",	/* 1688 */
+	"cgwnqhbhiuvxt", "cgxkwbzhvr", "cgxzpczxv", "cgzm",	/* 1692 */
+	"ch", "charedl", "chaywb", "chcibnvimwpmcu",	/* 1696 */
+	"chd", "chdguetdosbnq", "cheoen", "cheoghgdpfhmj",	/* 1700 */
+	"chfcu", "chfd", "chgdhgxigzwlq", "chgegmucbbunzy",	/* 1704 */
+	"chhchulukdhh", "chhstplthwjrcc", "chigwborxrb", "chkbvfan",	/* 1708 */
+	"chkiwfnc", "chkmtvvklwv", "chlagxzh", "chnmpftnonhoyq",	/* 1712 */
+	"chphurkvqadbhp", "chpndyhkg", "chrho", "chshuotvvzpv",	/* 1716 */
+	"chsysm", "chutzpoecxlthz", "chuuf", "chvptwvnrnsjng",	/* 1720 */
+	"chvvtn", "chvxavqarck", "chws", "chyffwwvhrci",	/* 1724 */
+	"chypbwg", "chzds", "ci", "cicaelqcq",	/* 1728 */
+	"cicyocu", "cidgmeyzbz", "cidiyswwac", "ciemueazx",	/* 1732 */
+	"ciex", "cigyr", "cih", "cihf",	/* 1736 */
+	"cikbbauwifb", "cikzouqsvfs", "cilhdvuxli", "cilhlideic",	/* 1740 */
+	"ciljxeh", "cilkoo", "cimmhft", "cimnkr",	/* 1744 */
+	"cimptznygkxfh", "cimvrqylou", "cingaxrymqpcm", "cinhht",	/* 1748 */
+	"cioksxf", "cipvypgyhoy", "cipxmob", "ciqumjm",	/* 1752 */
+	"cirskala", "cisvoizgfpblk", "cisxtwbl", "cityzo",	/* 1756 */
+	"civqfanzfqv", "ciwxhvhz", "cizespaj", "cizimjhnftbbxe",	/* 1760 */
+	"cj", "cjarwvhjj", "cjawvjpdfcozh", "cjbmbxi",	/* 1764 */
+	"cjbrjtruyszr", "cjeuwnhlelr", "cjfpxnutwwv", "cjhjzicth",	/* 1768 */
+	"cjiipzrkjonc", "cjjoi", "cjjshlwhe", "cjkcpcfkpt",	/* 1772 */
+	"cjlamqcnix", "cjlcin", "cjmjkvhsjh", "cjmrnozxxkguz",	/* 1776 */
+	"cjn", "cjon", "cjpqo", "cjptb",	/* 1780 */
+	"cjqouezuicsop", "cjqp", "cjqqnuviz", "cjrcwjoittnyg",	/* 1784 */
+	"cjrtgsoelgs", "cjryigrq", "cjt", "cjtblybcc",	/* 1788 */
+	"cjvag", "cjvu", "cjwdqvu", "cjwolocpo",	/* 1792 */
+	"cjxzbuvxtdn", "cjzfeiggm", "ckbobtfejpbsqc", "ckcjkphu",	/* 1796 */
+	"ckdaz", "ckehlhihqmsba", "ckeyazoj", "ckg",	/* 1800 */
+	"ckgihagn", "ckiupkpuckck", "ckj", "ckk",	/* 1804 */
+	"ckklxmafrpg", "cklroc", "ckndwpusb", "ckoz",	/* 1808 */
+	"ckqhpj", "ckugzfootcvxqj", "ckuivtsqqwxx", "ckv",	/* 1812 */
+	"ckvaoz", "ckvuzdxiuon", "ckxhxadvok", "ckyl",	/* 1816 */
+	"ckyxjdocflzv", "cl", "clalwdr", "clateohmqhjb",	/* 1820 */
+	"clcoxi", "clcvwppwvsngqk", "clgudcnjhm", "clibumypfgctik",	/* 1824 */
+	"cljjpjm", "clkpbtywcmhfc", "clnvwwnx", "clrfazzubs",	/* 1828 */
+	"cluyhvieiqlhg", "clwziheiq", "clx", "clxkkfwf",	/* 1832 */
+	"cly", "clywav", "clzyyt", "cm",	/* 1836 */
+	"cmagkzhqmdo", "cmbkjwncl", "cmc", "cmcbkcynwodt",	/* 1840 */
+	"cmcvjg", "cmdbbymka", "cmdnvr", "cmeshjit",	/* 1844 */
+	"cmica", "cmijnj", "cmjmzjziuzbaoy", "cmkqkz",	/* 1848 */
+	"cmlwih", "cmoiatqsn", "cmpzu", "cmrolcenjnapcs",	/* 1852 */
+	"cmrpbbzkr", "cmrtg", "cmt", "cmtdq",	/* 1856 */
+	"cmu", "cmxwiqzf", "cmxxbmb", "cmzewvsnm",	/* 1860 */
+	"cn", "cnafbr", "cnatk", "cnauza",	/* 1864 */
+	"cnbgwomtw", "cnbhqye", "cnbstexpdjjln", "cnbupxuxcozt",	/* 1868 */
+	"cnbztexpjt", "cnctzgcs", "cneswavlu", "cnfcd",	/* 1872 */
+	"cnfjnxqm", "cnfkoxin", "cnfksvyk", "cngmaxnnt",	/* 1876 */
+	"cnh", "cnhljesiur", "cnhwvsoreo", "cnikpetbfoma",	/* 1880 */
+	"cnixauu", "cnixi", "cnl", "cnlmnxvrshb",	/* 1884 */
+	"cnn", "cnocfa", "cnoxfcjqmgcgok", "cnpju",	/* 1888 */
+	"cnrydzwq", "cnsuhe", "cnsv", "cnt",	/* 1892 */
+	"cntoheaayqjfss", "cnumjam", "cnunupfd", "cnuzqmvxcxgkcc",	/* 1896 */
+	"cnvy", "cnynwikzuyp", "cnzhgqhgtmff", "cnzm",	/* 1900 */
+	"cnzofittmhspyh", "cnzvkenfwiezsa", "cnzvnkqrnyb", "co",	/* 1904 */
+	"cobhdheaztfu", "cobwot", "coenqgzbrxfk", "coesqouc",	/* 1908 */
+	"cof", "cogevgnhidm", "cogfteofenz", "cohmznmfkoetp",	/* 1912 */
+	"coihot", "collwds", "colrwxxh", "com",	/* 1916 */
+	"congccvuikm", "cooanvkk", "copqfployowscu", "coqm",	/* 1920 */
+	"coraxsh", "cosjtcomi", "cosncqtdot", "cotmfxfenxjh",	/* 1924 */
+	"covks", "covohqyhjwc", "coygze", "cp",	/* 1928 */
+	"cpb", "cpbl", "cpbwlm", "cpcwicbdrdyty",	/* 1932 */
+	"cpdpmqzv", "cpdtmpynkj", "cper", "cpfmcvdaqtpr",	/* 1936 */
+	"cpfofh", "cpfvepozouix", "cpifdqcalblfta", "cpigr",	/* 1940 */
+	"cpiwushw", "cpjjupmlrjh", "cpkdbdnsox", "cpkngufmleq",	/* 1944 */
+	"cpksdkdydr", "cplnbwvys", "cpou", "cppbcjmxkmtin",	/* 1948 */
+	"cpphyeqxxmvijq", "cppx", "cprfbolfhzye", "cprtmdklzhpvn",	/* 1952 */
+	"cprtqder", "cpsz", "cptixrudws", "cptqf",	/* 1956 */
+	"cpu", "cpucrokqzra", "cpvyoxzpdfr", "cpwvd",	/* 1960 */
+	"cpzju", "cq", "cqcdshjfe", "cqct",	/* 1964 */
+	"cqdednignw", "cqdhnihim", "cqfedrnac", "cqgdfhfgtz",	/* 1968 */
+	"cqgfnnrk", "cqhv", "cqihipoqucgfav", "cqkkzluqicr",	/* 1972 */
+	"cqkp", "cqlfqtv", "cqlplkvjugdbo", "cqmnul",	/* 1976 */
+	"cqn", "cqnfgaxy", "cqnvjmdbzzx", "cqpbczkgq",	/* 1980 */
+	"cqpyvskekqwsb", "cqqfdgsee", "cqqshdpjkxlahh", "cqqzqnfys",	/* 1984 */
+	"cqrigmarili", "cqrsbss", "cqrxfxmycjov", "cqs",	/* 1988 */
+	"cqtersab", "cqts", "cqv", "cqvffye",	/* 1992 */
+	"cqvile", "cqvoqvr", "cqvpiypzgf", "cqxtet",	/* 1996 */
+	"cr", "craxjvtb", "craygznhssjhru", "crc",	/* 2000 */
+	"crce", "crfqnpvg", "crfrn", "crgqdsrh",	/* 2004 */
+	"crgwcpbuz", "crhokokxdmbx", "crhuxq", "crkvae",	/* 2008 */
+	"crmz", "crnzcjqz", "crp", "crpvdgg",	/* 2012 */
+	"crqeztr", "crqghvw", "crqs", "crroc",	/* 2016 */
+	"crsdn", "crurlhfsyhnk", "crwfyhmfsnhu", "crwlaukxwgfzql",	/* 2020 */
+	"crx", "crxf", "crxxwuwpad", "crymv",	/* 2024 */
+	"cryoce", "crz", "crzbkgvcpbk", "crznlgdj",	/* 2028 */
+	"cs", "csbrlyo", "csegnvru", "csel",	/* 2032 */
+	"csevvapey", "csguy", "cshdnqjaq", "cshjuiiqxycgcb",	/* 2036 */
+	"cslgslcmwms", "csmyyypfvu", "csnlbwc", "csnrqfqi",	/* 2040 */
+	"cso", "csoz", "csqumtffsk", "csrzsb",	/* 2044 */
+	"csuid", "csuvyu", "csw", "cswqwqiar",	/* 2048 */
+	"cswyvjsvplgpqx", "csx", "csxmuzhhpivxhz", "ct",	/* 2052 */
+	"ctacrlaa", "ctadcvlkmhoqbr", "ctaqvzayvzeofb", "ctawhe",	/* 2056 */
+	"ctawpozub", "ctb", "ctcnhavvolv", "ctdlufqox",	/* 2060 */
+	"ctdyaoo", "ctfekhaxnxxgqn", "ctfquo", "ctgchb",	/* 2064 */
+	"ctiacpyjpjfpjf", "ctiba", "ctihtdeku", "ctkijiddcagup",	/* 2068 */
+	"ctkmg", "ctkynoiizeaib", "ctliwbqdbqekr", "ctlv",	/* 2072 */
+	"ctovu", "ctpqksvbg", "ctqivjwxudyhed", "ctqjg",	/* 2076 */
+	"ctqmfghocglqno", "ctstmimpxbzu", "ctsxq", "ctt",	/* 2080 */
+	"ctte", "cttgjmken", "cttgurhilcxjcs", "ctwboftrnovhhj",	/* 2084 */
+	"ctwdwnckcsxgru", "ctx", "ctyrcai", "cu",	/* 2088 */
+	"cuabqjmjtc", "cuafcu", "cuavdrmqakwtw", "cuay",	/* 2092 */
+	"cubaa", "cubfmbrq", "cucez", "cudsy",	/* 2096 */
+	"cufais", "cufpdqbrn", "cufwv", "cugpnayemjzoui",	/* 2100 */
+	"cuhmivia", "cuhnqgvjpwbm", "cuikfvaziwlhwd", "cuixdpcnlbgx",	/* 2104 */
+	"cujpbjufwtpf", "cukqebmuphpcvt", "cum", "cumfsibkh",	/* 2108 */
+	"cumwcolhnkc", "cuopxmlnagf", "cupaornnq", "curkne",	/* 2112 */
+	"cuschcnq", "cuuw", "cuvmxmi", "cux",	/* 2116 */
+	"cuxa", "cuy", "cuz", "cuzkttwcjnvir",	/* 2120 */
+	"cv", "cvacrjwxyd", "cvdqlurb", "cvdto",	/* 2124 */
+	"cveby", "cvemgivupv", "cvfjx", "cvfrpzykygrxv",	/* 2128 */
+	"cvgy", "cvhaxwnppww", "cvhmfjewwbny", "cvknts",	/* 2132 */
+	"cvlrccogtwdoq", "cvmlaqtlg", "cvmps", "cvoafqw",	/* 2136 */
+	"cvpc", "cvqskzqesgih", "cvr", "cvrxcjnlwryjq",	/* 2140 */
+	"cvs", "cvsrzjdmwebnh", "cvttegpijsutbq", "cvvgmdjkrdaerl",	/* 2144 */
+	"cvvif", "cvviwn", "cvvlsjpjog", "cvxwcebg",	/* 2148 */
+	"cvyqytayfd", "cw", "cwbeemkkzp", "cwbrhihz",	/* 2152 */
+	"cwdjqqxoiy", "cwdkkhe", "cwenslodjjai", "cwfbdhzpu",	/* 2156 */
+	"cwfs", "cwgqgpydlzzyf", "cwhtfukfxf", "cwjadkghi",	/* 2160 */
+	"cwjbdfj", "cwkzdskzfskqk", "cwlagdxjri", "cwlplwxato",	/* 2164 */
+	"cwlrmgxzd", "cwls", "cwm", "cwmslj",	/* 2168 */
+	"cwnivgrwaxeg", "cwof", "cwope", "cwrsxzq",	/* 2172 */
+	"cwsctwfgdigqak", "cwsers", "cwssj", "cwwmo",	/* 2176 */
+	"cwymbawgl", "cwzawx", "cwziilas", "cx",	/* 2180 */
+	"cxba", "cxcxeybafmmlz", "cxeeo", "cxehxsbrlabu",	/* 2184 */
+	"cxflkogcs", "cxg", "cxge", "cxh",	/* 2188 */
+	"cxhevdl", "cxk", "cxkggfjgqkmjmv", "cxlbouscf",	/* 2192 */
+	"cxlfrev", "cxlg", "cxmp", "cxmpxqgz",	/* 2196 */
+	"cxoh", "cxokjkfeg", "cxoqf", "cxpgjyvo",	/* 2200 */
+	"cxqioqct", "cxqmmggtebue", "cxsnrui", "cxtdujukjrx",	/* 2204 */
+	"cxtecqij", "cxtqdqnbcocafy", "cxvkazkt", "cxwyg",	/* 2208 */
+	"cxy", "cxyjyhyx", "cxzdgxxeham", "cxznioncmwpx",	/* 2212 */
+	"cy", "cybabr", "cyboygbo", "cybsko",	/* 2216 */
+	"cydstbwzmisowu", "cyet", "cyfkr", "cygbidpq",	/* 2220 */
+	"cyhdjf", "cyhfa", "cyhymd", "cyjtcqap",	/* 2224 */
+	"cyktttaixf", "cyluzkjxlhlnyb", "cyookvjkvyqaq", "cyorvktohfq",	/* 2228 */
+	"cyovrlm", "cyp", "cyr", "cyroaqbxp",	/* 2232 */
+	"cyrviqqfigd", "cys", "cysnzwigsxdh", "cytbcgsxrjchyv",	/* 2236 */
+	"cytpkc", "cyvqhygppmyw", "cyxomsnlisver", "cyxpfhbvepfi",	/* 2240 */
+	"cyybfr", "cyyslc", "cyzqnsqv", "cyzyutkujjvv",	/* 2244 */
+	"cz", "czcbu", "czccdnvm", "czdcnqdzl",	/* 2248 */
+	"czdnvn", "czdpqauksnl", "czeddsakobekt", "czevimjehltm",	/* 2252 */
+	"czg", "czgbhubjz", "czgmqrvgocwvou", "czjhiywymcuax",	/* 2256 */
+	"czkjrrs", "czkknlmggnfcfv", "cznq", "cznv",	/* 2260 */
+	"czq", "czqr", "czw", "czxu",	/* 2264 */
+	"czz", "czzfnaka", "da", "daalqf",	/* 2268 */
+	"dabzkrqxsqwa", "dadsbagl", "daeba", "dafdbvaxtfn",	/* 2272 */
+	"dafpwdxqiyoxu", "dafxbi", "dahktuab", "dahs",	/* 2276 */
+	"dai", "dakagvyuwy", "damfx", "dammzrazzhb",	/* 2280 */
+	"danyksvhrqhgoo", "daodk", "dapoim", "daqgoiuhxk",	/* 2284 */
+	"darwwvepgq", "dat", "daua", "dauqa",	/* 2288 */
+	"dautvqxa", "davvoom", "daxam", "daxuxu",	/* 2292 */
+	"daydchbwtmcdn", "daydhhenkplyeu", "daygsmgegybbco", "dayxvlwib",	/* 2296 */
+	"db", "dbacgbgv", "dbaebgewz", "dbaq",	/* 2300 */
+	"dbbe", "dbcfsifpfaon", "dbchucxuj", "dbedyjzb",	/* 2304 */
+	"dbhpnyonkq", "dbineldbzmzt", "dbj", "dbnpxwxabp",	/* 2308 */
+	"dbnuornr", "dbnybkrbdm", "dbodviodv", "dboxsb",	/* 2312 */
+	"dbpcjblag", "dbplf", "dbpsjrydev", "dbrhjcutjeoqfy",	/* 2316 */
+	"dbup", "dbvtbysld", "dbwgvdfhfnbhsv", "dbwqeeywrlf",	/* 2320 */
+	"dbwsnpfgsozvdv", "dbxdmhoxdubn", "dbybrh", "dbz",	/* 2324 */
+	"dbzcmxceae", "dc", "dcb", "dcbl",	/* 2328 */
+	"dce", "dcghm", "dcgmdtmnfn", "dcgstwldd",	/* 2332 */
+	"dchkyzflgshn", "dcidg", "dcmfym", "dcmjoqlpf",	/* 2336 */
+	"dcnfugnxf", "dcoi", "dcpdqaacxyxcj", "dcpfzaktzlubsj",	/* 2340 */
+	"dcqxyumfyeeu", "dcr", "dcrvxg", "dcsqfqbof",	/* 2344 */
+	"dcsstcydfhl", "dcuhaorcgudfu", "dcvllusglmnr", "dcvrakab",	/* 2348 */
+	"dcxcohmalwd", "dcxgzn", "dcy", "dcybb",	/* 2352 */
+	"dcydawlist", "dcyzxom", "dd", "ddaahiv",	/* 2356 */
+	"ddcpcxxlfag", "ddcpv", "dddikl", "dddtygrhbyyaca",	/* 2360 */
+	"dddzrxmag", "ddek", "ddfsxofjpdey", "ddfxpmy",	/* 2364 */
+	"ddgluzs", "ddhkutytxpnai", "ddiixeh", "ddiqmpr",	/* 2368 */
+	"dditqva", "ddlf", "ddlvcs", "ddmew",	/* 2372 */
+	"ddn", "ddpfghoaecv", "ddrs", "ddvip",	/* 2376 */
+	"ddvwe", "ddwd", "ddxgvyym", "ddxrtco",	/* 2380 */
+	"ddxsi", "ddxvndxe", "ddybuodmabs", "ddyjntriiked",	/* 2384 */
+	"ddyqufzatteiow", "ddyze", "ddzgyqp", "ddzkepuq",	/* 2388 */
+	"ddzwdfci", "de", "dea", "deb",	/* 2392 */
+	"debajs", "decqijnjxcygix", "dectwsodwcn", "deebuqixz",	/* 2396 */
+	"deegvb", "degrjxsmzgfclo", "degrxraewocaal", "degyydul",	/* 2400 */
+	"dekrztgxeoqidi", "dekuzsor", "delh", "delsc",	/* 2404 */
+	"den", "denl", "deoeatiqqtkqjw", "deqcesnclyu",	/* 2408 */
+	"derrdh", "desdlktpne", "desj", "detkaafiksfb",	/* 2412 */
+	"deul", "deuppy", "devok", "devtrytlednax",	/* 2416 */
+	"dexnjd", "deyaezbhdprqj", "deyfofa", "df",	/* 2420 */
+	"dfaddhwkdaasp", "dfaegxgvi", "dfaplztbogzd", "dfblxgyv",	/* 2424 */
+	"dfcvsjmys", "dfd", "dfdkemfqddqtf", "dfdlhjkxdlgseb",	/* 2428 */
+	"dffzmwybyhf", "dfimqmsm", "dfiy", "dfj",	/* 2432 */
+	"dfjkgqxw", "dfjxnqyecqpqc", "dfofmhennjmq", "dfplwututnm",	/* 2436 */
+	"dfqazqyjrugq", "dfqdpybexfk", "dfqxroxz", "dfsxbz",	/* 2440 */
+	"dfuaikwpzos", "dfulvndftjr", "dfuxjdxkxwqn", "dfvqujk",	/* 2444 */
+	"dfwnf", "dfyglqamhyhnr", "dg", "dgaguettvvao",	/* 2448 */
+	"dgc", "dgcbazapkms", "dgdaxxmnisjsu", "dgdg",	/* 2452 */
+	"dgdmfiivivdphg", "dgdwusc", "dgebmivntf", "dgesprsgttlem",	/* 2456 */
+	"dgfobbpeq", "dgfrs", "dgfsl", "dggcvrwiln",	/* 2460 */
+	"dghnetrywrli", "dgicusqucczgu", "dgiwvhikxaegom", "dgjdul",	/* 2464 */
+	"dgjhpa", "dgkbplu", "dgm", "dgoay",	/* 2468 */
+	"dgotz", "dgq", "dgqcowzrrv", "dgrad",	/* 2472 */
+	"dgryjpknhv", "dgsnlhy", "dgsvnsg", "dgtkphbbrool",	/* 2476 */
+	"dguwb", "dgvyzokgtwrw", "dgwwc", "dgwzsqf",	/* 2480 */
+	"dgy", "dgymk", "dh", "dha",	/* 2484 */
+	"dhafgix", "dhbpshkcs", "dheeqx", "dhegzezntgno",	/* 2488 */
+	"dhhpxqlmmv", "dhibo", "dhjenqw", "dhldfjum",	/* 2492 */
+	"dhmwsgtq", "dhoylukozp", "dhqhpmgowre", "dhrlmf",	/* 2496 */
+	"dhsvopnucakxf", "dhsyqspk", "dhtnkkdcxtfn", "dhuvc",	/* 2500 */
+	"dhwpm", "dhwqgul", "dhxbjvhocvxc", "dhyfjprnohnw",	/* 2504 */
+	"dhzyzuir", "di", "diauqcfylaj", "diazq",	/* 2508 */
+	"diek", "diemgvklt", "dieoazorppo", "diflwceqd",	/* 2512 */
+	"diglctgsewdof", "digskbcftuk", "dihci", "dihs",	/* 2516 */
+	"diijpfegi", "dijsktjahafd", "dikg", "dilhixbuxkgy",	/* 2520 */
+	"dinlpmu", "dinozrmzj", "diothn", "diqohly",	/* 2524 */
+	"dirxjumtkhk", "dis", "disjepxlhhax", "dita",	/* 2528 */
+	"ditr", "divhfyvldodkq", "diyfkulhqdap", "diynpkltl",	/* 2532 */
+	"dizcpu", "dj", "djb", "djbv",	/* 2536 */
+	"djbyy", "djc", "djcmeq", "djctds",	/* 2540 */
+	"djebeusawunw", "djfixutqiloz", "djfolnlq", "djgusarfpjoa",	/* 2544 */
+	"djgxyolhzskkh", "djhadrhxwhh", "djhcoqtwuhr", "djiqsaicbcxen",	/* 2548 */
+	"djjvjcpu", "djkslibdpmjs", "djkuyk", "djlhcvriyqt",	/* 2552 */
+	"djmqtroqtccjw", "djms", "djn", "djnqfcxson",	/* 2556 */
+	"djnwgfq", "djpxhkxwmr", "djqe", "djqfbyiheg",	/* 2560 */
+	"djrcfywyqeuryu", "djrwjlchidysc", "djshwvsarcj", "djuvanurfr",	/* 2564 */
+	"djvdpnpmuh", "djygvhlvqmhea", "djyxs", "djyyegdh",	/* 2568 */
+	"dk", "dkberbo", "dke", "dkewmcdsjh",	/* 2572 */
+	"dkhapivi", "dkhn", "dkhvuq", "dkizqhvbidcxim",	/* 2576 */
+	"dkkm", "dklhkk", "dknsotlgkkkrdv", "dknzvzzysm",	/* 2580 */
+	"dkoab", "dkoby", "dkqfafegxhkgf", "dkrdmlpqflw",	/* 2584 */
+	"dksamzymjthkp", "dksfwlxp", "dksr", "dksttykfmuc",	/* 2588 */
+	"dkt", "dkujyjrmlf", "dkvelmpyba", "dkvm",	/* 2592 */
+	"dkwpusmkrg", "dkxarlnuwwt", "dkxkuuigmsbd", "dkyf",	/* 2596 */
+	"dkyglmxzkav", "dkyiogxvym", "dkymdgessx", "dl",	/* 2600 */
+	"dlarpsmf", "dlavlgdorhm", "dlbfqelphm", "dlbnqllfg",	/* 2604 */
+	"dlbnuc", "dlcme", "dlcy", "dlgkrfcsj",	/* 2608 */
+	"dlia", "dlj", "dljmscrt", "dljyu",	/* 2612 */
+	"dlkbkanfdmew", "dlmvvmvom", "dlmwpqkzfo", "dlpywl",	/* 2616 */
+	"dlq", "dlrtrsof", "dls", "dlswtuhkvog",	/* 2620 */
+	"dltrkrd", "dltsfu", "dltzswxdtd", "dlvbxk",	/* 2624 */
+	"dlwkqqsxtyvyif", "dlwxkqojrtt", "dlyi", "dlyiehllfxyddx",	/* 2628 */
+	"dlzcs", "dlzhrdbp", "dm", "dmanibuqk",	/* 2632 */
+	"dmbr", "dmewiec", "dmgl", "dmguqpgx",	/* 2636 */
+	"dmidg", "dmldy", "dmlud", "dmmhpwpkc",	/* 2640 */
+	"dmmqfespg", "dmmtrwzuhvsbgf", "dmnehlgojsetru", "dmngxfbcxnb",	/* 2644 */
+	"dmokwfl", "dmpzj", "dmqya", "dmrlvrpyrhcx",	/* 2648 */
+	"dmunnizly", "dmvetq", "dmzquzfvvminxq", "dmzsfhxiunnsu",	/* 2652 */
+	"dn", "dnbdfwgr", "dncgduahpcgkg", "dncvbfdqvcg",	/* 2656 */
+	"dndfatysflbvew", "dndnibekhiavew", "dnejzl", "dnfsqfjjprbcaw",	/* 2660 */
+	"dnknae", "dnkrvf", "dnl", "dnmxdsaayrtn",	/* 2664 */
+	"dnntyv", "dnqpchlxxdz", "dnqxqqy", "dnrc",	/* 2668 */
+	"dnrkcsjbyjev", "dntkfwkheolqwo", "dntrn", "dntwheixh",	/* 2672 */
+	"dnwqoyagjfz", "dnwyakulbd", "dnxnizid", "dnyek",	/* 2676 */
+	"dnylmzgbcejih", "dnzypc", "doa", "doblxkive",	/* 2680 */
+	"dobnmrna", "dodpvpscfe", "dodxvbgzca", "doemmgkkhpom",	/* 2684 */
+	"doeuxzke", "dog", "dohrv", "doibr",	/* 2688 */
+	"dojlqg", "dojsu", "dojzcthsgkjan", "doktuzptkd",	/* 2692 */
+	"dolo", "dophq", "doq", "dordymhp",	/* 2696 */
+	"dowo", "dowqgsncoevo", "doyj", "doyovw",	/* 2700 */
+	"dp", "dpcxjsrfjcy", "dpdhgfhcaddww", "dpgankvkmyklza",	/* 2704 */
+	"dphwhhridll", "dpidbby", "dpifqouie", "dpjssmbeif",	/* 2708 */
+	"dpjxkwa", "dplqcxfbfdurk", "dpluousdkim", "dpmhhwkse",	/* 2712 */
+	"dpnmqvsduisfc", "dpnwcbq", "dpo", "dpoebix",	/* 2716 */
+	"dpptzljwpykx", "dpqkllwaz", "dpqwlgn", "dpsh",	/* 2720 */
+	"dpstnzcnwhng", "dptlkfufyxbvm", "dpvpoyezgeleej", "dpvxztap",	/* 2724 */
+	"dpwxxzmso", "dpx", "dpxat", "dpxioppvadygq",	/* 2728 */
+	"dpxv", "dpyj", "dpyopu", "dq",	/* 2732 */
+	"dqachzzvctt", "dqaly", "dqas", "dqbxakrci",	/* 2736 */
+	"dqctc", "dqctkrvrlxht", "dqegwefbvca", "dqgmrscmzzw",	/* 2740 */
+	"dqgxhkd", "dqjoqgz", "dqkebliu", "dqkglqzhyimvg",	/* 2744 */
+	"dqkn", "dqldnzglvqv", "dqmaegub", "dqmkemgdcocss",	/* 2748 */
+	"dqmmnuf", "dqnd", "dqpf", "dqphpcyfjsv",	/* 2752 */
+	"dqqffl", "dqqpd", "dqqxc", "dqtloijmqvkd",	/* 2756 */
+	"dqtxishdjeywtn", "dqtxmxctclbfcj", "dqux", "dqwbnifhabcuk",	/* 2760 */
+	"dqwilegsobvjip", "dqwofwfumsfbo", "dqxfqy", "dqxuenxq",	/* 2764 */
+	"dqymj", "dr", "draholqktw", "drccyarxv",	/* 2768 */
+	"dreagxlhhaauge", "drgzas", "drkgmhszjei", "drkiquqkbrghv",	/* 2772 */
+	"drkxs", "drlizdpdqndqp", "drlqd", "drlxa",	/* 2776 */
+	"drmmtfgtpbte", "drn", "drnbtg", "drnsmfblsqbdr",	/* 2780 */
+	"drqjycqchygtyg", "drqmylwj", "drqollsbustn", "drr",	/* 2784 */
+	"drup", "drvaggoxwxew", "drw", "drwxfwkkcjqvdi",	/* 2788 */
+	"drycwkffcgix", "ds", "dsahjmt", "dsbgxa",	/* 2792 */
+	"dsbkwfasofcxdu", "dsdbclgvtptf", "dsgp", "dshnozwezg",	/* 2796 */
+	"dshyuswe", "dsi", "dsj", "dsjnhh",	/* 2800 */
+	"dsjxazfpt", "dsk", "dslec", "dsnkbqadrknhwg",	/* 2804 */
+	"dsnqkcgrv", "dsp", "dspbdj", "dsqyolmyogsy",	/* 2808 */
+	"dsrhsbgv", "dsrl", "dss", "dst",	/* 2812 */
+	"dsvifw", "dswtyqzwkndo", "dsy", "dsycsp",	/* 2816 */
+	"dsziqpidtyakir", "dszqt", "dt", "dtalpunmkvl",	/* 2820 */
+	"dtarpuo", "dtbfakkqrxtb", "dtdizmgvo", "dtedyoulyli",	/* 2824 */
+	"dtfbelbwls", "dtfsy", "dtguxrnibxge", "dtkfcwi",	/* 2828 */
+	"dtmplozxgsnmg", "dtn", "dto", "dtosukeonpfp",	/* 2832 */
+	"dtpuyyvx", "dtrkx", "dtrugasialuck", "dtrypocpgim",	/* 2836 */
+	"dtszmcs", "dtuvaexlbch", "dtwokhuk", "dtwq",	/* 2840 */
+	"dtyngztw", "dtyxy", "dtzkdiceafaw", "du",	/* 2844 */
+	"duapcoaucad", "duec", "duhaeoja", "duieogek",	/* 2848 */
+	"dujya", "duktlxme", "dulbvwvvjdtfg", "dumbzxcqtup",	/* 2852 */
+	"dunfcmna", "dunvtegoc", "dupfawwhudtq", "duqkfwq",	/* 2856 */
+	"duqzpk", "duroyburah", "dusehgvz", "dusldo",	/* 2860 */
+	"dusplpm", "dutgvikbquahcd", "dutlbheg", "dutmbkcty",	/* 2864 */
+	"duttpgtigdvi", "duvyhzcbpbuijk", "duxerbuu", "duxfzaocdjbf",	/* 2868 */
+	"duy", "duzvbwsmpcedph", "dv", "dvai",	/* 2872 */
+	"dvaiehorhwcjf", "dvbtgeebtstty", "dvczratuf", "dvdvlzgk",	/* 2876 */
+	"dvhsg", "dvikl", "dviw", "dvjeiun",	/* 2880 */
+	"dvjsn", "dvkhhylrbomb", "dvkk", "dvklqa",	/* 2884 */
+	"dvkodfxsacgik", "dvlzfekybkk", "dvmjqpakt", "dvoabhnzr",	/* 2888 */
+	"dvoctxinezgil", "dvpxox", "dvq", "dvqex",	/* 2892 */
+	"dvqng", "dvqxfvvb", "dvrjzc", "dvrnkeazqs",	/* 2896 */
+	"dvrqcanafayeo", "dvs", "dvtacgqvvlby", "dvtevhwjnn",	/* 2900 */
+	"dvugzpassnxltm", "dvui", "dvv", "dvyunivud",	/* 2904 */
+	"dvzlg", "dw", "dwaccshslp", "dwbatksp",	/* 2908 */
+	"dwbd", "dwbdwbxbtpvord", "dwbpg", "dwbqfdfwuo",	/* 2912 */
+	"dwd", "dwdgkdiowumrga", "dwdmf", "dwedqrqi",	/* 2916 */
+	"dwemvj", "dweovqdswlbq", "dwfxxzdy", "dwhok",	/* 2920 */
+	"dwhp", "dwime", "dwiwm", "dwizjzcljvlk",	/* 2924 */
+	"dwj", "dwjqroorpvori", "dwjyhxujqzuokc", "dwlj",	/* 2928 */
+	"dwlkuigqrdg", "dwlnihkaxvop", "dwlo", "dwluhmwnzqtn",	/* 2932 */
+	"dwmctgx", "dwmohcxx", "dwnksmp", "dwoobub",	/* 2936 */
+	"dwqsyiicihyohe", "dwsj", "dwskrbhhyzjin", "dwtftsycvmjcd",	/* 2940 */
+	"dwti", "dwuohdqkppso", "dwxqfsbcqo", "dwzt",	/* 2944 */
+	"dx", "dxbwl", "dxcto", "dxdcchrjeiznf",	/* 2948 */
+	"dxdxgzh", "dxercd", "dxewsrjnf", "dxf",	/* 2952 */
+	"dxfbckln", "dxfpyksbcivy", "dxgj", "dxgwddapi",	/* 2956 */
+	"dxhxpvu", "dxirldjcce", "dxjebyyeueyo", "dxkxznrm",	/* 2960 */
+	"dxlfhh", "dxnonbwkyr", "dxnspx", "dxobencpq",	/* 2964 */
+	"dxpjush", "dxpywlidk", "dxqpccqafnqew", "dxrat",	/* 2968 */
+	"dxrovhedbi", "dxsxwywtvpksc", "dxtesdle", "dxtyehcnsps",	/* 2972 */
+	"dxuodmrv", "dxw", "dxwbvpw", "dxxptk",	/* 2976 */
+	"dxyp", "dy", "dyabokviehr", "dycsfhwunnthx",	/* 2980 */
+	"dycv", "dyedvkaya", "dyfakhrxju", "dyiphjrg",	/* 2984 */
+	"dylbegy", "dylwdfuiefwiqc", "dymhwdmat", "dymrlfsiygjhry",	/* 2988 */
+	"dynomd", "dyoqhjvl", "dypyvkjbbi", "dyqmaqjivoac",	/* 2992 */
+	"dyty", "dywwo", "dyygttlfnojth", "dyyypg",	/* 2996 */
+	"dyzomlapyuatx", "dz", "dzbjat", "dzckphjotzswz",	/* 3000 */
+	"dzdcdoicrjdci", "dzeqviqjo", "dzerbweobtdn", "dzevlrgrcrug",	/* 3004 */
+	"dzgchqyu", "dzhfgevznor", "dzhz", "dzijaelmg",	/* 3008 */
+	"dzkeof", "dzmazgmzkloqhz", "dzoeeamfed", "dzogfrbdb",	/* 3012 */
+	"dzqrmsttold", "dzqyhni", "dztmgefxxle", "dzuzqaw",	/* 3016 */
+	"dzvoxnsok", "dzvw", "dzwc", "dzwkeci",	/* 3020 */
+	"dzwpmrtjhzii", "dzwybvx", "dzyipujsq", "dzztilwijlympk",	/* 3024 */
+	"eaa", "eaaafeam", "eaccfz", "eacodsvf",	/* 3028 */
+	"eadgzshhapwfb", "eadorv", "eadzqhivjgx", "eaedlprp",	/* 3032 */
+	"eaedphr", "eafdcox", "eafilesz", "eafingashuekl",	/* 3036 */
+	"eahakkk", "eaiqjezgcl", "eajktolgty", "eajriebnxt",	/* 3040 */
+	"eam", "eammxkdo", "eamygiblf", "eaon",	/* 3044 */
+	"eareq", "earffcuaoe", "earrvoucf", "earukkzzrrce",	/* 3048 */
+	"easdgxqma", "eatjblybgrc", "eauieizl", "eawbtgjfih",	/* 3052 */
+	"eawppvwcghdt", "eaxrwvmwm", "eayvqla", "eazj",	/* 3056 */
+	"eazmfbhfxtki", "eb", "eba", "ebaifjhekqd",	/* 3060 */
+	"ebcmyosvkkklay", "ebcxoegrf", "ebdwntfkcacc", "ebeuyxzdzenkws",	/* 3064 */
+	"ebfieuvtsoxfxh", "ebgfjuj", "ebggpsperj", "ebi",	/* 3068 */
+	"ebicuc", "ebijntcldj", "ebjfv", "eblgfq",	/* 3072 */
+	"eblp", "ebnrzthwtnhvfe", "ebordmnatgzxyh", "ebqxmuw",	/* 3076 */
+	"ebr", "ebra", "ebtgki", "ebv",	/* 3080 */
+	"ebvtf", "ebwwifi", "ebx", "ebxeiy",	/* 3084 */
+	"ebxo", "ebywteltsowaxi", "ec", "ecbde",	/* 3088 */
+	"ecedlj", "eceqqjzbekf", "ecfw", "ech",	/* 3092 */
+	"echghjnqycqluu", "echnvfhrxfyn", "echom", "echsv",	/* 3096 */
+	"ecigvjelqbf", "ecjegggok", "ecjly", "ecklyflz",	/* 3100 */
+	"eckyleposrmz", "ecl", "eclmd", "ecmmbbschtz",	/* 3104 */
+	"ecmtritsbsg", "ecnryuax", "ecobywpnpik", "ecoehbxjlbsco",	/* 3108 */
+	"ecpqrmmtuxnruq", "ecril", "ectsoktkzmmsu", "ecuxrjeiczrxff",	/* 3112 */
+	"ecvpkni", "ecw", "ecxdgkoy", "ecyzy",	/* 3116 */
+	"eczqutmjc", "ed", "edacon", "edauwzo",	/* 3120 */
+	"edbtr", "edd", "edesytc", "edfvpyd",	/* 3124 */
+	"edg", "edhgx", "edhhktrrjr", "edibh",	/* 3128 */
+	"edioawahf", "ediyevs", "edjmejzyvowyp", "edjmqagxj",	/* 3132 */
+	"edloaurcv", "edqutaajzrnx", "edstccqguqe", "edtpphpxglyxbm",	/* 3136 */
+	"edudzesduqc", "edwkgtldl", "edwngwfouwevmf", "edwpifbdr",	/* 3140 */
+	"edwqcpjodamfk", "edxnjx", "edxvkhx", "edyid",	/* 3144 */
+	"edz", "edzdke", "eeajo", "eebvai",	/* 3148 */
+	"eebzd", "eecxzh", "eedmqgffhmqq", "eedzvquv",	/* 3152 */
+	"eeeandjip", "eefkgbgrweoaua", "eefux", "eehmfditkwuh",	/* 3156 */
+	"eeigbzrosxtf", "eejelt", "eelarxldh", "eelpcul",	/* 3160 */
+	"eenboqxpqx", "eeoaylkgsbi", "eep", "eescujugdoymnq",	/* 3164 */
+	"eetwd", "eeuftagv", "eexcnjnwunf", "eexudhk",	/* 3168 */
+	"eexwqm", "eeyemtowposli", "eeyiotmhvjis", "eeyjyigwibpohu",	/* 3172 */
+	"ef", "efa", "efammrljsswj", "efaunn",	/* 3176 */
+	"efbalxsuzwcbde", "efc", "efcnhecjglgdm", "efddvig",	/* 3180 */
+	"efebp", "efffpnxkf", "effftpusuq", "effqhcdzx",	/* 3184 */
+	"efglvlrppvfx", "efgtxabeqqp", "efjlnk", "efjxmfej",	/* 3188 */
+	"efkhridbiosgdd", "efmafaily", "efmilabnedt", "efnkpffcc",	/* 3192 */
+	"efnobkvzmszrlt", "efpknzyrnvf", "efqebtiswksamw", "efqemp",	/* 3196 */
+	"efqoj", "efraoybpgmxr", "efrdlxr", "efrnole",	/* 3200 */
+	"efsih", "eftfsg", "efu", "efvemwteisjk",	/* 3204 */
+	"efvjpjgbs", "efvlzibujtphxw", "efwqvuhasldchb", "efwvjj",	/* 3208 */
+	"efzbpj", "eg", "ega", "egadmoba",	/* 3212 */
+	"egaerhgqln", "egafob", "egbusykrlzggt", "egdfodo",	/* 3216 */
+	"egedyfrbitaeb", "egfvprrmdk", "eggpoekbbzv", "egidxq",	/* 3220 */
+	"egk", "eglfn", "eglvfh", "egn",	/* 3224 */
+	"egnfclbml", "egngenompzu", "egoxvscw", "egpim",	/* 3228 */
+	"egpinuw", "egpjnftfh", "egqhuec", "egqq",	/* 3232 */
+	"egujcso", "eguyakek", "egxg", "egym",	/* 3236 */
+	"egyxmk", "egzyf", "egzyzqgvt", "eh",	/* 3240 */
+	"ehcglwwowb", "ehcwgxpyvxtw", "ehd", "ehdcsmxsuyb",	/* 3244 */
+	"ehe", "eherwbtmn", "ehfmshadnvo", "ehhgklgu",	/* 3248 */
+	"ehikovd", "ehizqpqtsvjae", "ehkmbnx", "ehlnmq",	/* 3252 */
+	"ehlq", "ehmcivnpv", "ehnzvchijr", "eho",	/* 3256 */
+	"ehqkdnchdhrxl", "ehqyretxcj", "ehsdrdoavhc", "ehstjmilmwooa",	/* 3260 */
+	"ehta", "ehtksfwfk", "ehuvzkyzoikgq", "ehvg",	/* 3264 */
+	"ehvkprhdzrl", "ehvwcwtnrdcqbl", "ehwg", "ehwrwpk",	/* 3268 */
+	"ehykdqmiv", "ehzhwrlqqasqg", "ei", "eiarkca",	/* 3272 */
+	"eiavypxdz", "eicq", "eienmxk", "eigqqbuwwaipr",	/* 3276 */
+	"eihyytpinxf", "eiibaauqu", "eij", "eijqdlxhbdocd",	/* 3280 */
+	"eiliioq", "eimt", "eiontjjuo", "eioon",	/* 3284 */
+	"eipqgius", "eiro", "eisryvbxbbusp", "eivbdyfxvbak",	/* 3288 */
+	"eivbqllrrelubf", "eiw", "eiwedbu", "eiwwazqlnhlw",	/* 3292 */
+	"eixlcmpaqogxh", "eiylyqxmza", "eiyofmmiwdev", "eiz",	/* 3296 */
+	"eizvipylu", "eizvrfxqoi", "ej", "ejamsljniy",	/* 3300 */
+	"ejatb", "ejaums", "ejb", "ejbqqgqxmlio",	/* 3304 */
+	"ejc", "ejcy", "ejdzekhrcjrjwp", "ejehjmt",	/* 3308 */
+	"ejekerexdswmp", "ejgczth", "ejhvulqae", "ejicphplxiwpn",	/* 3312 */
+	"ejjdm", "ejlroujxzb", "ejlwx", "ejnpskgzecacx",	/* 3316 */
+	"ejo", "ejomxmoxbpjm", "ejpbxbtwyxuocd", "ejqwqvgzfnvb",	/* 3320 */
+	"ejrdjq", "ejsal", "ejsmros", "ejvalvf",	/* 3324 */
+	"ejyz", "ek", "ekazsenqnjwq", "ekbtnh",	/* 3328 */
+	"ekc", "ekcd", "ekcrogrdplbo", "ekculbbumkgenh",	/* 3332 */
+	"ekdbioxcxijyx", "ekdc", "ekdipll", "ekegp",	/* 3336 */
+	"ekeyezxjthns", "ekf", "ekfdb", "ekhe",	/* 3340 */
+	"ekjkddbnzw", "ekjmgk", "ekjrqgxsfgwlw", "ekkwnvw",	/* 3344 */
+	"eklhfz", "ekmksqyd", "ekpjre", "ekpwqqqz",	/* 3348 */
+	"ekq", "ekqqpqyakyqju", "ekqxxzpurl", "ekrej",	/* 3352 */
+	"eksbvru", "ekttfarwdu", "ekuapsmxayhqqp", "ekv",	/* 3356 */
+	"ekwn", "ekxxrudftwuzp", "ekyrhto", "ekzaj",	/* 3360 */
+	"ekzgvnig", "el", "elatxhhhvj", "elb",	/* 3364 */
+	"elbqrlnbzlxa", "elc", "elcfbqwlbc", "elcwaipj",	/* 3368 */
+	"elczqhoyrwpld", "eldtuuwchkoyi", "eldxzuacqermc", "eldzbubvt",	/* 3372 */
+	"eleruxxdocxrv", "eley", "elfere", "elgomol",	/* 3376 */
+	"elifstg", "eliuldbwwumwlp", "eljqhuunsdk", "elkalleq",	/* 3380 */
+	"elmmbtduow", "elmnsvqgv", "elmym", "eln",	/* 3384 */
+	"elneaiibisdk", "elnttazy", "elobadpc", "eloiusalha",	/* 3388 */
+	"elpbgdnejh", "elproupvx", "elrmsw", "elsaovwtt",	/* 3392 */
+	"eltoojcu", "eltpchglwjkq", "eltvufjcv", "eltxadjmknowtn",	/* 3396 */
+	"elunde", "elvswpg", "elvtixtmnl", "elwbvyjixjky",	/* 3400 */
+	"elxu", "ely", "elyudqkdnp", "em",	/* 3404 */
+	"emahjaqctlv", "emba", "embepkhxifzku", "embrvakuzv",	/* 3408 */
+	"emctkieh", "emfagrefaivxyv", "emfawdxbb", "emhjltl",	/* 3412 */
+	"emivr", "emjwipnukscnh", "emjwnr", "emjxzceeil",	/* 3416 */
+	"emncaknf", "emocuafod", "empodcczesmy", "emqudxkpuao",	/* 3420 */
+	"emqzhtlrn", "emrv", "emsbmt", "emsdqgd",	/* 3424 */
+	"emsuvmnbngj", "emtbsgslybuwe", "emuxwpb", "emwdxlcur",	/* 3428 */
+	"emwpv", "emywoaxqiciz", "emyzxyab", "emzrotpbdnne",	/* 3432 */
+	"en", "enahhkbo", "enawihme", "enayzhqrqdci",	/* 3436 */
+	"encxemdnxrgear", "enfqw", "enfure", "enfxrrcv",	/* 3440 */
+	"engfrlxfx", "enilbnqlwcjxl", "enjty", "enkdxyewku",	/* 3444 */
+	"enkkcq", "enkqkgibj", "enmfu", "enmmmbry",	/* 3448 */
+	"enppohqqt", "enppzupyi", "enpuerowwdf", "enqfi",	/* 3452 */
+	"enqgjcoq", "enqshbqdcxgvxs", "ens", "ensadjrzhzrlo",	/* 3456 */
+	"entm", "enugneqonhdjnn", "enurhdzgegwlhc", "enuypwya",	/* 3460 */
+	"env", "enzcewq", "enzeeuj", "eo",	/* 3464 */
+	"eoasok", "eobbjfyatkaeid", "eobkikuigj", "eobopxskrl",	/* 3468 */
+	"eobvlnpdwk", "eobxmta", "eodhetcejocgvu", "eogjfhn",	/* 3472 */
+	"eohd", "eohzhbhcd", "eokav", "eolqilwdifsveu",	/* 3476 */
+	"eolyim", "eom", "eomjqlttfuwhdy", "eomkhcckb",	/* 3480 */
+	"eomwvgsoqkdojx", "eonzi", "eoowahw", "eopobttvtomvv",	/* 3484 */
+	"eoqo", "eorcdjteakhwjs", "eoriczehsifcxr", "eornnutaonzazv",	/* 3488 */
+	"eotctswdcyfuss", "eoveiubn", "eovrucewk", "eowqyjeg",	/* 3492 */
+	"eoxiqgicoviy", "eoxlrwvyrhhj", "ep", "epavsvjnpqz",	/* 3496 */
+	"epd", "epeivjcpetfpy", "epgmhnegk", "epgzt",	/* 3500 */
+	"ephdujrmkkgxx", "epkjihtae", "epks", "eplelo",	/* 3504 */
+	"eplx", "epnkckn", "epqmfdtvpum", "epsp",	/* 3508 */
+	"epts", "epv", "epvfawer", "epwlmzs",	/* 3512 */
+	"epwyvgnihvdzio", "epx", "epzhzuwwxutcf", "epzjrqoqkfyv",	/* 3516 */
+	"eq", "eqaamymmu", "eqasi", "eqchdnvbmij",	/* 3520 */
+	"eqd", "eqe", "eqeeto", "eqeswgjmp",	/* 3524 */
+	"eqewjjvaqsg", "eqfmhfkr", "eqfxerzo", "eqkceplzhq",	/* 3528 */
+	"eqkiozgkzszcxq", "eqkoqdkdaouwvb", "eqlktuyaefqpm", "eqm",	/* 3532 */
+	"eqmaaaq", "eqmnnoptht", "eqo", "eqqq",	/* 3536 */
+	"eqrmhhpnenpqx", "eqs", "eqtaiizcqcquqt", "eqttgiqtae",	/* 3540 */
+	"eqw", "eqwsu", "eqyqcrzypdvkvb", "eqz",	/* 3544 */
+	"eqzxtevgqwe", "er", "erbzwekvxloxg", "erckdxhqtirkl",	/* 3548 */
+	"erd", "erdgirz", "erdnkbdpfmi", "ereebl",	/* 3552 */
+	"erekiumhcal", "ereon", "ergijs", "erhcngcphm",	/* 3556 */
+	"eribneow", "erj", "erlagnpujlzh", "erlegph",	/* 3560 */
+	"erlodevk", "erotxlxquvx", "erqtxjtgx", "errdyzwwv",	/* 3564 */
+	"errxloacuw", "ersofphmgok", "ersrgpnoefl", "ersvgpbruzs",	/* 3568 */
+	"ervepytdbi", "ervsk", "erzldirimxefk", "erzxsd",	/* 3572 */
+	"es", "esazkgmf", "esbkzmw", "esc",	/* 3576 */
+	"esdadzctbpsj", "esdmkqnlkit", "eset", "esfo",	/* 3580 */
+	"esfvqnzejvnbvl", "esgpnovbbw", "eshajsvb", "eshybgz",	/* 3584 */
+	"esieijhggptofg", "esjrhzr", "eskrssjaxy", "esl",	/* 3588 */
+	"eslgfffvsgpp", "esmfqredofsbgg", "esnae", "esnewhl",	/* 3592 */
+	"esnnso", "esohgbxa", "esphv", "esqnzp",	/* 3596 */
+	"esrptntrtxhks", "esrvhrws", "essgmj", "essjbto",	/* 3600 */
+	"esulycsz", "esvjmxhatu", "esvqnl", "esxefqcx",	/* 3604 */
+	"et", "etabnu", "etc", "etdtgjxvyu",	/* 3608 */
+	"etfekvyhs", "etg", "etimcvstxqpsn", "etjprjwhu",	/* 3612 */
+	"etljdhmkzff", "etnojtznm", "etpz", "etqbrarth",	/* 3616 */
+	"etqiyqwg", "etqswjdztha", "etrc", "etrinmxrtqgq",	/* 3620 */
+	"etru", "etsai", "etsrictzzylnmq", "etsxzpiczaxvj",	/* 3624 */
+	"ettgiyzucirou", "etuhatou", "etw", "etwxlepuetd",	/* 3628 */
+	"etxfhgmuu", "etyzucp", "etzojkts", "etzpxuwzjcpztv",	/* 3632 */
+	"eu", "euaiifxv", "euaqdzkyljvoon", "eucaduuc",	/* 3636 */
+	"eud", "euex", "eufj", "eufrayvwo",	/* 3640 */
+	"eufsixopzhfdf", "euftzajenp", "eugoogd", "euirjynoxwrytb",	/* 3644 */
+	"eujpv", "eul", "eulhcpyh", "eumsxeafj",	/* 3648 */
+	"eunaxdekxleiw", "eupdekbjkwqn", "euphjigmw", "eupyrbvd",	/* 3652 */
+	"eurdlsag", "eurufaorrvbym", "eus", "eutzpphyxg",	/* 3656 */
+	"euurkgjnnnu", "euvfrshgpyfa", "euw", "euwtybljpf",	/* 3660 */
+	"euxzrokzkkzbcm", "euymzifycyta", "euzdousgcl", "euzjpywyuicdyc",	/* 3664 */
+	"euzoewehre", "ev", "evavtl", "evcawxdpfri",	/* 3668 */
+	"evdo", "evdpi", "evdrswfmjvbn", "evkqh",	/* 3672 */
+	"evlrl", "evlrne", "evndljrtb", "evohjarilf",	/* 3676 */
+	"evprusklydwc", "evpt", "evqemz", "evqlybuhomsxo",	/* 3680 */
+	"evrtabnuwsaei", "evrtytmjy", "evtauwm", "evtuejf",	/* 3684 */
+	"evukvcpchq", "evvvj", "evxxr", "evyqns",	/* 3688 */
+	"evyrsvvvhv", "evytldrfnop", "evzweomak", "ew",	/* 3692 */
+	"ewcoxyzgduuwei", "ewdsntga", "ewegflmjru", "ewg",	/* 3696 */
+	"ewgcwuzekfu", "ewh", "ewhhmno", "ewjhxcxaxh",	/* 3700 */
+	"ewl", "ewmesx", "ewo", "ewpoac",	/* 3704 */
+	"ewqoymi", "ewqpqtdyskvxkx", "ewrrq", "ewsixawdzg",	/* 3708 */
+	"ewsnpinbobmcsc", "ewsqkvdgc", "ewtetrwwinw", "ewthilyxnuqnsb",	/* 3712 */
+	"ewtt", "ewumvbzymoraeh", "ewuqjyims", "ewwgwhtsy",	/* 3716 */
+	"ewwwq", "ewxabkbvesso", "ewxvlkciso", "ewywxkyvkjwvv",	/* 3720 */
+	"ex", "exdx", "exghosjymfte", "exhlz",	/* 3724 */
+	"exidtzqnkk", "exn", "exosrsikmu", "expyikaat",	/* 3728 */
+	"exrjd", "extxcrweabyic", "exvempzbhc", "exvwyoullior",	/* 3732 */
+	"exxphfpu", "exxpliwfjpb", "exxwbiylwisss", "exyma",	/* 3736 */
+	"exzpk", "ey", "eycacfnxpft", "eycehwszdxluof",	/* 3740 */
+	"eyck", "eycl", "eycoggnc", "eyegnuo",	/* 3744 */
+	"eyfjhjogdgzzau", "eyidrzcvk", "eyiufyvcil", "eyjxstyeba",	/* 3748 */
+	"eylqo", "eyltsmn", "eymgdsdn", "eymxgtsydq",	/* 3752 */
+	"eynenixhvw", "eynsf", "eyntuqwzdgsxx", "eyo",	/* 3756 */
+	"eyprnkozfnzvr", "eyrym", "eyugyl", "eyutchrelmuz",	/* 3760 */
+	"eyuyajvdgqlmw", "eyvdx", "eywbgkygfqav", "eywcscn",	/* 3764 */
+	"eyxi", "eyxjuy", "eyxxi", "eyxxoyqvbdq",	/* 3768 */
+	"eyy", "eyyrmpzyhqamz", "eyywdleiq", "eyznctm",	/* 3772 */
+	"eyzogyqhwghs", "ez", "ezacunodx", "ezaeo",	/* 3776 */
+	"ezcnwm", "ezd", "ezdluyxcg", "ezegbq",	/* 3780 */
+	"ezeprhuxnlcm", "ezg", "ezgohejvpz", "ezguzmsonoekj",	/* 3784 */
+	"ezisaqllco", "ezjp", "ezkdssyycfmlr", "ezkiuie",	/* 3788 */
+	"ezkooph", "ezlai", "ezlh", "ezmktxabd",	/* 3792 */
+	"ezmqiix", "ezoepi", "ezqnmaqfc", "ezqpgx",	/* 3796 */
+	"ezrlavfdo", "ezsvvlfjrckkp", "eztjkvorlipvu", "eztyudgwfzd",	/* 3800 */
+	"ezvpkrhlbbdfp", "ezwprutatutly", "ezxpvxr", "ezxstvrlew",	/* 3804 */
+	"ezxuwfqsmbe", "ezxynhjepacbwc", "ezyfmwkhh", "ezzqtwmjl",	/* 3808 */
+	"ezzugcu", "faaivyhakrdu", "fabsxjlvga", "fabwkh",	/* 3812 */
+	"faccujdqv", "factyznv", "fagfxuaws", "fagifjjqinnc",	/* 3816 */
+	"fagtvkkoparb", "fahtbdlnuzwwt", "fai", "faidraovh",	/* 3820 */
+	"faiqtmpkwq", "fajdrxkdn", "fajobemfsmtew", "fajqfmkjbiel",	/* 3824 */
+	"fao", "faomb", "faovim", "faowahdr",	/* 3828 */
+	"faowpmzhz", "fapghqrjqrjvp", "faqio", "faqmclwkp",	/* 3832 */
+	"faquwwas", "faqxvodprhuzw", "faqyfzr", "farhzcvjua",	/* 3836 */
+	"farmdtb", "fascpfszfwm", "fasngd", "fatbqfde",	/* 3840 */
+	"fatglyxnw", "faultmykt", "fausvoet", "fav",	/* 3844 */
+	"favcnqbs", "fayutpqzn", "fazvogulbpxjrm", "fbayjpfgfc",	/* 3848 */
+	"fbazazowyhpbt", "fbcfustrns", "fbe", "fbfj",	/* 3852 */
+	"fbgzp", "fbivooax", "fbkqlsvylxfdht", "fbkwyyoogyw",	/* 3856 */
+	"fbl", "fbmnfqvjjbxei", "fbmusjuxfiunwl", "fbn",	/* 3860 */
+	"fbnkd", "fbogm", "fboyra", "fbpftoyrzuc",	/* 3864 */
+	"fbqggojhpq", "fbqtmjla", "fbqwmdiv", "fbrf",	/* 3868 */
+	"fbruvamydl", "fbtvyccxg", "fbukgiaaewq", "fbxjejvfoji",	/* 3872 */
+	"fbynxuw", "fbzrgi", "fbzsauckrzz", "fc",	/* 3876 */
+	"fcaypz", "fcb", "fcbkzcxgr", "fccknlhscyv",	/* 3880 */
+	"fcdzbo", "fcfz", "fchsxdhs", "fcj",	/* 3884 */
+	"fcjndsl", "fckcx", "fckisz", "fcloy",	/* 3888 */
+	"fcnjccbedefit", "fcpgeayfslh", "fcqjpuuiwzzx", "fcquzdwdeqxay",	/* 3892 */
+	"fcsdqvsra", "fcsl", "fctm", "fcvigowqahxri",	/* 3896 */
+	"fcvlnrn", "fcxcajc", "fcxn", "fcycqerhykfthd",	/* 3900 */
+	"fczjkdxddvc", "fcztlrtde", "fczvpdawev", "fd",	/* 3904 */
+	"fdahar", "fdbinhpzkow", "fdbu", "fdcnmplzpj",	/* 3908 */
+	"fdecnzxqxizbsi", "fdemvi", "fdfsdaqhg", "fdhv",	/* 3912 */
+	"fdibor", "fdiudjcmt", "fdivltusmshdo", "fdiyga",	/* 3916 */
+	"fdjodoww", "fdkhgqpm", "fdlqt", "fdmp",	/* 3920 */
+	"fdo", "fdpgatkm", "fdpyyzyai", "fdrgocoy",	/* 3924 */
+	"fdtnsrmqkknbzb", "fdugkoh", "fdvg", "fdwyopkqpgqe",	/* 3928 */
+	"fdxmctrhlehnjd", "fdxwouncarl", "fdyhto", "fdyna",	/* 3932 */
+	"fdzucsmzw", "fdzvucmh", "feayepdwrwuap", "febklm",	/* 3936 */
+	"fecmohbakmgyf", "feemmni", "fefdukod", "fegdzwbpb",	/* 3940 */
+	"fehyc", "feil", "feingsxy", "fej",	/* 3944 */
+	"fejbcgavbn", "fejpftjkqeawui", "fek", "fekvzpwto",	/* 3948 */
+	"felvvrk", "fem", "feobl", "feozkpfflvakd",	/* 3952 */
+	"feptbwzlj", "fesvirtupsc", "fevh", "fevr",	/* 3956 */
+	"fexcyls", "fexjtsfdua", "ff", "ffa",	/* 3960 */
+	"ffaeicxwuzu", "ffambjhkbbg", "ffaucyw", "ffbfznr",	/* 3964 */
+	"ffbknvu", "ffdsetzbvfzjvm", "ffdz", "ffel",	/* 3968 */
+	"fffgvfnboia", "fffilhaaxqcbx", "ffgukijypycfz", "ffjlonn",	/* 3972 */
+	"ffkxfohjjwksn", "fflfwxy", "ffmwvkgdzib", "ffnfgynzikyv",	/* 3976 */
+	"ffnhhbfzqz", "ffnyeqvesh", "ffodvqfek", "ffrfe",	/* 3980 */
+	"ffrkqoflzj", "ffsecirnp", "fftbknm", "fftiepvvvcabs",	/* 3984 */
+	"fftjau", "ffuvb", "ffvszorl", "ffwlz",	/* 3988 */
+	"ffzbxwtzs", "ffzvjgkbi", "fg", "fgbqslwmxoh",	/* 3992 */
+	"fgcqw", "fgdqnhkdah", "fgeeooezdoo", "fgfmcj",	/* 3996 */
+	"fggrrr", "fggvulz", "fggxgzbpwqrlsf", "fghfqmbihx",	/* 4000 */
+	"fgiqlkbuh", "fgivoohymtsq", "fgjsr", "fglyjadsqmy",	/* 4004 */
+	"fgnex", "fgnpxvn", "fgonjvkx", "fgpaacpdscu",	/* 4008 */
+	"fgpu", "fgpzirfw", "fgqloiyavzpaa", "fgricn",	/* 4012 */
+	"fgsoexpo", "fgt", "fgtfha", "fgtorhf",	/* 4016 */
+	"fgufp", "fguuwnha", "fgwb", "fgwst",	/* 4020 */
+	"fgwueqvlcfj", "fgxyribsoxwyd", "fgxytgbpdobsq", "fgynvlfsaafuoz",	/* 4024 */
+	"fgzbl", "fgzjnnepp", "fgzubffta", "fh",	/* 4028 */
+	"fhbdphje", "fhcgioepfnlja", "fhdcfftbjza", "fhdsbyxbhwekv",	/* 4032 */
+	"fhdvfmccmw", "fhe", "fhecwxi", "fhfmr",	/* 4036 */
+	"fhfquowse", "fhg", "fhgqv", "fhgvm",	/* 4040 */
+	"fhgyydczw", "fhhjorsmgowikp", "fhiowazjx", "fhjippt",	/* 4044 */
+	"fhktcujdwzcs", "fhm", "fhofqjrjvuzqft", "fhoysmgzsklssn",	/* 4048 */
+	"fhpiuamhzmx", "fhpxguerxfupe", "fhqsc", "fhrytvnwddl",	/* 4052 */
+	"fhs", "fhsoiqzzozuee", "fhstodagsluu", "fhv",	/* 4056 */
+	"fhvcxpzjp", "fhxbvaft", "fi", "fiaal",	/* 4060 */
+	"fiabgo", "fiasbxvezweyqx", "fibaurolv", "ficqfvvqlvs",	/* 4064 */
+	"ficrppmy", "ficszthr", "fidc", "fidyyadi",	/* 4068 */
+	"fiehtuzxhh", "fig", "figxvepsjznmg", "fihrnmfemsko",	/* 4072 */
+	"fik", "fil", "fimtplreufh", "finycfimuad",	/* 4076 */
+	"finyydjxzpscgw", "fioauhqwdpq", "fipp", "fiqxlllym",	/* 4080 */
+	"fismbxkhvla", "fiulbyzjgmuuc", "fivrhowneyfsz", "fiwsfadagnpur",	/* 4084 */
+	"fj", "fjbzoyov", "fjc", "fjcif",	/* 4088 */
+	"fjdmz", "fjdxb", "fjevwkyvaoof", "fjhxyohg",	/* 4092 */
+	"fji", "fjkuro", "fjljkekgoc", "fjlun",	/* 4096 */
+	"fjmbwpij", "fjmfot", "fjmgpcappowsu", "fjmmstucuiff",	/* 4100 */
+	"fjmnjnniugr", "fjrafjot", "fjrqiahcqyypl", "fjrrq",	/* 4104 */
+	"fjsd", "fjtfflknvzzlu", "fjthcmxkufjlki", "fjudtfj",	/* 4108 */
+	"fjutduocy", "fjvotlozuauj", "fjxd", "fjxukezgivbq",	/* 4112 */
+	"fk", "fka", "fkaml", "fkaot",	/* 4116 */
+	"fkbhcjrdppl", "fkbzvklsyp", "fkcq", "fkczzmieujrra",	/* 4120 */
+	"fkd", "fkdxs", "fkdyp", "fkef",	/* 4124 */
+	"fkhog", "fkhxahsdrie", "fkicop", "fkifmsmvkbbwjp",	/* 4128 */
+	"fkiujtr", "fkj", "fkjfvm", "fkjjcr",	/* 4132 */
+	"fkjrxgkbcmqknk", "fkkmxho", "fkkplbhqxw", "fklchrfdez",	/* 4136 */
+	"fkmgxdk", "fkmoo", "fkndh", "fknhh",	/* 4140 */
+	"fknxspyx", "fkoavuepzmgvi", "fkofwxtei", "fkokauo",	/* 4144 */
+	"fkouiwrbknqsb", "fkp", "fkqaholn", "fksdk",	/* 4148 */
+	"fktinmsahh", "fkuusq", "fkveamsiiugsyj", "fkvqg",	/* 4152 */
+	"fkw", "fkxmxdtgt", "fkydcd", "fkyerhmn",	/* 4156 */
+	"fkylytkxmliga", "fkz", "fkzejeb", "fkzgt",	/* 4160 */
+	"flcxownsfyapgb", "fldqigzjl", "fldsibhh", "flg",	/* 4164 */
+	"flgzbls", "flhrgarrr", "flifbcgnfpuv", "flijxmishwhf",	/* 4168 */
+	"flj", "flji", "fljlwh", "fljx",	/* 4172 */
+	"flksgxrgpbplx", "fllux", "flm", "flmofxf",	/* 4176 */
+	"flnyhvgaolqszb", "floanrdszs", "floj", "flox",	/* 4180 */
+	"flq", "flqou", "flqutqgr", "flrtq",	/* 4184 */
+	"fls", "fltexh", "fltmdrkbvl", "fltsmoq",	/* 4188 */
+	"flvfkjpmuej", "flwsr", "flwsvjcrjbbakh", "flxqkyjcbs",	/* 4192 */
+	"fm", "fmbmxashwx", "fmbsm", "fmbwecjnfhmbk",	/* 4196 */
+	"fmdb", "fmeen", "fmetuslyjsktne", "fmffq",	/* 4200 */
+	"fmfvsutghdiz", "fmilnqanksf", "fmirun", "fmjyvxuhkcyt",	/* 4204 */
+	"fmkmuuqvhjntr", "fmllyjigzldlt", "fmmaag", "fmmmjljcbdv",	/* 4208 */
+	"fmnfw", "fmof", "fmrlce", "fmrmsuolfsq",	/* 4212 */
+	"fmrvdwbb", "fmrxnzesqf", "fmsc", "fmtmofxvq",	/* 4216 */
+	"fmtu", "fmvhfpfhnrm", "fmwhdhkkvhzv", "fmwjjjadhfkjh",	/* 4220 */
+	"fmwopknu", "fmwotyiz", "fmwuetndsvdu", "fmyccxmmn",	/* 4224 */
+	"fnaehhtx", "fnbnx", "fnbtltf", "fnd",	/* 4228 */
+	"fnevstsf", "fnfqoc", "fnfrqyqx", "fngnkggmyf",	/* 4232 */
+	"fngscwrqdwt", "fnhkzzjecwxxyw", "fnhowncsctfe", "fnidmqxoygrppx",	/* 4236 */
+	"fniflqplqrwa", "fnjwvwigf", "fnlgl", "fnngfqqnntzjs",	/* 4240 */
+	"fnntgetnvbiqh", "fnp", "fnqsvlvjs", "fnrgva",	/* 4244 */
+	"fnsihyxs", "fnwmvzxlnqaxe", "fnxrq", "fnxrr",	/* 4248 */
+	"fnxwiqafstc", "fnzcohmbuig", "fnzdxawfpzg", "fo",	/* 4252 */
+	"foagmj", "foancllpwpt", "foarnn", "fob",	/* 4256 */
+	"foblhln", "focednfsz", "fociejyyewtup", "focorn",	/* 4260 */
+	"fodqvcvcwgkq", "foeeiqmwcqdcw", "foezzqgigatk", "foff",	/* 4264 */
+	"foixxwluz", "fojbmytwjff", "fokjbtpowmcpv", "fokqbnuhhvm",	/* 4268 */
+	"fokxf", "folmekydqzmf", "fomluz", "foozmf",	/* 4272 */
+	"foqpbjzpd", "forgedkvv", "fotfe", "fougpubqvbjo",	/* 4276 */
+	"foyziljjcw", "fozmdidzrvbyz", "fp", "fpabaqiaxbuqgz",	/* 4280 */
+	"fpbggtmxpkw", "fpbpdvrseeocuv", "fpe", "fpfqi",	/* 4284 */
+	"fpfwk", "fpfymkxuwzfs", "fpghnd", "fph",	/* 4288 */
+	"fpi", "fpifmyp", "fpjfag", "fpjxsqaopvtcvc",	/* 4292 */
+	"fpl", "fpmnyfn", "fpngjubgwjg", "fpoe",	/* 4296 */
+	"fpouqshifjhui", "fpox", "fpplpkfmm", "fpqkiwadiigw",	/* 4300 */
+	"fpqwl", "fprumlfwupqu", "fpsklm", "fpspj",	/* 4304 */
+	"fpsxosgzqjjo", "fpukdfmbzouzyo", "fpulczwo", "fpuzpktkj",	/* 4308 */
+	"fpw", "fpxmgxrkh", "fpyezzgnl", "fpzbyxywl",	/* 4312 */
+	"fpzitkwh", "fpzxubgkzmahf", "fq", "fqary",	/* 4316 */
+	"fqbakdpqunooxs", "fqbdcibei", "fqcmlk", "fqegxaeg",	/* 4320 */
+	"fqeldrmmbzor", "fqgbtsq", "fqgyyifyfqqzca", "fqhwjgdvo",	/* 4324 */
+	"fqinx", "fql", "fqlkvorkvhk", "fqlwd",	/* 4328 */
+	"fqmfchalw", "fqqyhizlyer", "fqrwpmrtmsux", "fqsoknawceq",	/* 4332 */
+	"fqtwvk", "fqubbrul", "fqufnwrnnzrfq", "fquutf",	/* 4336 */
+	"fqvvrmqaazp", "fqxcrk", "fqy", "fr",	/* 4340 */
+	"frahiciimn", "fraqq", "fratfbsb", "frdngj",	/* 4344 */
+	"fregomtlqwop", "frevddg", "frf", "frg",	/* 4348 */
+	"frgi", "frhgacsphdkal", "fricjsjqyveftn", "frimegib",	/* 4352 */
+	"friucfbry", "frlidub", "frlkz", "frlviweznxgue",	/* 4356 */
+	"frnqnzaabjayox", "frnti", "frnwquunb", "froujr",	/* 4360 */
+	"frrbiajcxaojtd", "frrfsis", "frsj", "frsr",	/* 4364 */
+	"frtiitaeasupc", "frtzyn", "frv", "frvmxxrrkmm",	/* 4368 */
+	"frxcuzwjvpynm", "frxjgni", "fryentxtc", "frygb",	/* 4372 */
+	"frymptizyr", "frzssdszjnl", "frzt", "fs",	/* 4376 */
+	"fsawhhush", "fsblmkibw", "fsbmi", "fsd",	/* 4380 */
+	"fsenzj", "fsfauacdq", "fsfujnqhgewxi", "fsgskmi",	/* 4384 */
+	"fsiaigwvdpb", "fskbehk", "fskcsajdibhhpf", "fslget",	/* 4388 */
+	"fsmwk", "fspcsrkl", "fsppjmkpz", "fspvfskua",	/* 4392 */
+	"fssgmaqg", "fstarlmlbxcqiw", "fsvbtrefb", "fsvepkhhnwgk",	/* 4396 */
+	"fsvlkiqdw", "fswd", "fswftuhsov", "fsxdz",	/* 4400 */
+	"fsyhbyohpuef", "fszjfnzeibn", "ft", "ftahttkclo",	/* 4404 */
+	"ftaye", "ftbyxafixnzap", "ftc", "ftdrjzolrkchyb",	/* 4408 */
+	"ftfpj", "ftftbxcqespf", "ftiexxvozsfzu", "ftilt",	/* 4412 */
+	"ftjc", "ftjiyikimssq", "ftjjis", "ftjxfpdhffizsl",	/* 4416 */
+	"ftkwhrspmzsqy", "ftmd", "ftnadi", "ftnvqgrnybje",	/* 4420 */
+	"ftoc", "ftpbsuhpgzcif", "ftpi", "ftpojgoe",	/* 4424 */
+	"ftpvmtrznslvx", "ftqlalnjyxsoli", "ftraodaoxhxfhc", "ftsxbmjbmiadx",	/* 4428 */
+	"ftvjt", "ftwg", "ftwxnzdfdmgdsn", "ftwzdptejybj",	/* 4432 */
+	"ftzcozrkbhv", "fu", "fuan", "fubedkshfuhs",	/* 4436 */
+	"fucgbfwuxm", "fuckbedmx", "fucle", "fuclyrjutsxh",	/* 4440 */
+	"fucnwggnrojl", "fuejvhvxdjaqnh", "fufx", "fufztpcqo",	/* 4444 */
+	"fuhap", "fuhjtzrbbm", "fui", "fuitwiaczvvm",	/* 4448 */
+	"fuk", "fulqhkthhuywgj", "fum", "fumcpswklsb",	/* 4452 */
+	"fuogsxz", "fupogq", "fuqbg", "furlzm",	/* 4456 */
+	"futqupclxtdmc", "fuuoauumpl", "fuyiycgacxqwf", "fuzbat",	/* 4460 */
+	"fv", "fvbobgeyyobxeu", "fvcnybit", "fvduqw",	/* 4464 */
+	"fveiupdspiefa", "fveom", "fveou", "fvfeyq",	/* 4468 */
+	"fvflhqaxxt", "fvguaoxu", "fvmdfvhwpvs", "fvmifyyds",	/* 4472 */
+	"fvoplhrcupepnq", "fvpkaxkvkjvum", "fvqrs", "fvucyizt",	/* 4476 */
+	"fvumiub", "fvvtzweqweoft", "fvxv", "fvxzxuyecekeau",	/* 4480 */
+	"fvya", "fvysfngk", "fvzh", "fw",	/* 4484 */
+	"fwajh", "fwamtt", "fweaqk", "fwetr",	/* 4488 */
+	"fwfhp", "fwfvdrmzg", "fwigjo", "fwixf",	/* 4492 */
+	"fwkcej", "fwkulwb", "fwn", "fwng",	/* 4496 */
+	"fwnm", "fwoaeao", "fwpmmxni", "fwpwdphfmmgd",	/* 4500 */
+	"fwrrewcwgskksc", "fwrztyqqc", "fwshotrrsgriku", "fwsppwuwtqy",	/* 4504 */
+	"fwsrjvfhbrux", "fwstmsjpb", "fwtavshqda", "fwtibltbdzhp",	/* 4508 */
+	"fwtphgpuviq", "fwu", "fwuorfcjp", "fwupstu",	/* 4512 */
+	"fww", "fwwacml", "fwwbvcfjjllupi", "fwypcmypkpd",	/* 4516 */
+	"fwzhqrxdc", "fwziixbh", "fwzk", "fwzwyuicdvpkb",	/* 4520 */
+	"fxazwqhiersikk", "fxbiexnby", "fxbly", "fxd",	/* 4524 */
+	"fxdnm", "fxeanhlmgqs", "fxemtnjke", "fxerrgqpyyrny",	/* 4528 */
+	"fxfbzdwnqdvgyt", "fxfsjyaljta", "fxfu", "fxhizlhwfpq",	/* 4532 */
+	"fxicqwvuvvonxp", "fxikkx", "fxj", "fxjydkymfwhqvd",	/* 4536 */
+	"fxlwmgodp", "fxnop", "fxnxg", "fxohg",	/* 4540 */
+	"fxquofqvaotvne", "fxrtmggc", "fxsmhttpqiosxd", "fxufqytlo",	/* 4544 */
+	"fxupkjndhraguq", "fxwct", "fxwtr", "fxxqqrkj",	/* 4548 */
+	"fxxztzjozxp", "fxygeihtwlddbr", "fy", "fyarbz",	/* 4552 */
+	"fyba", "fybvgsvpsf", "fycqzb", "fycz",	/* 4556 */
+	"fydjzldjfw", "fyfjqtr", "fyhnavsoyydwqo", "fyieggphtnscz",	/* 4560 */
+	"fyjwqkqgu", "fykca", "fykemnkruwqig", "fykpazor",	/* 4564 */
+	"fykpkfkprkxbr", "fymxxvama", "fyowvekg", "fypmq",	/* 4568 */
+	"fyprai", "fyteqop", "fyukfbarwujno", "fyuzcqhex",	/* 4572 */
+	"fyvkxfbte", "fyxtcx", "fyylebr", "fyyyqxsuljjmn",	/* 4576 */
+	"fz", "fzaxco", "fzaxn", "fzbijbspyw",	/* 4580 */
+	"fzbs", "fzclycbbejufwg", "fzcwlxgsywurd", "fzcyn",	/* 4584 */
+	"fzdbhe", "fzeuddn", "fzfce", "fzfij",	/* 4588 */
+	"fzgkfgfcamczq", "fzhwqmawodcteo", "fzhyptddk", "fzidkeuc",	/* 4592 */
+	"fzioshzymmuv", "fzjalcxnw", "fzjpkqd", "fzjwzc",	/* 4596 */
+	"fzlkb", "fzmk", "fzmlyksfvbuocq", "fznhoqw",	/* 4600 */
+	"fzosd", "fzozwjjqntzhy", "fzpdzyjwi", "fzprbi",	/* 4604 */
+	"fzpvc", "fzql", "fzqykwdxyacb", "fzrtfswxpjv",	/* 4608 */
+	"fztex", "fztph", "fzupscrg", "fzvemvhrmt",	/* 4612 */
+	"fzxrwpppdqgtj", "fzyaoherg", "fzzzld", "ga",	/* 4616 */
+	"gabqfvkspvfn", "gacnepad", "gaeqezpxmka", "gafbfjmonwkd",	/* 4620 */
+	"gagcjdgdzzmz", "gagtehcyrwkx", "gagxk", "gah",	/* 4624 */
+	"gahur", "gaiphxgs", "galvnp", "gamv",	/* 4628 */
+	"gao", "gaoqqbdrfkmjv", "gaqeckt", "gaqfrjqhwk",	/* 4632 */
+	"garjbzlnwxfw", "garjx", "gasfn", "gasop",	/* 4636 */
+	"gaupzkpnftkxh", "gauwibtmqa", "gavy", "gaxie",	/* 4640 */
+	"gaznoorayh", "gazuowgtmjekl", "gb", "gbbe",	/* 4644 */
+	"gbc", "gbcug", "gbdmrpxhcvlxy", "gbdukggzzp",	/* 4648 */
+	"gbfiy", "gbgdotks", "gbh", "gbhjksmhlybhjw",	/* 4652 */
+	"gbibbhv", "gbjc", "gbjcrw", "gbjcwvfeqsfkk",	/* 4656 */
+	"gbjtwnazdlsbhf", "gbk", "gblvzujvc", "gbn",	/* 4660 */
+	"gbngknwhs", "gbnwkyx", "gbo", "gbomqil",	/* 4664 */
+	"gbpgpc", "gbpuyuqmoo", "gbqkkccld", "gbqpxqqkosnal",	/* 4668 */
+	"gbrjyealc", "gbrlrhrz", "gbrpjbitgwp", "gbtzyn",	/* 4672 */
+	"gbucvrere", "gbuefqbwb", "gbxaiprcc", "gbxzsdukitse",	/* 4676 */
+	"gc", "gcanz", "gccva", "gcdr",	/* 4680 */
+	"gcejauhfy", "gcfu", "gcgile", "gchs",	/* 4684 */
+	"gchzpa", "gcjdkp", "gcl", "gclozmq",	/* 4688 */
+	"gcnpvsh", "gcouugtkfswvw", "gcpujsuscu", "gcqjikodgr",	/* 4692 */
+	"gcrogagmx", "gcszluxnendmf", "gcveh", "gcxlnjkey",	/* 4696 */
+	"gcxrfduq", "gcze", "gczsr", "gd",	/* 4700 */
+	"gdafiwonmo", "gdavqdpnao", "gdaxmevsjd", "gdbosuex",	/* 4704 */
+	"gdcjwchrdf", "gddpejznyvxpe", "gddxisqonxr", "gderdvijz",	/* 4708 */
+	"gdgdutzjfaogdc", "gdgfk", "gdgofsklw", "gdgyxpo",	/* 4712 */
+	"gdhfljoytkvs", "gdhjp", "gdixcz", "gdjz",	/* 4716 */
+	"gdldbeqjbnqgqf", "gdmlutc", "gdmrshpl", "gdnotaahl",	/* 4720 */
+	"gdomctvunlibgw", "gdowzzrwyojtrw", "gdpg", "gdrwlvwffptyc",	/* 4724 */
+	"gdscazrstnvj", "gdsgbh", "gducqthbsa", "gdudabuny",	/* 4728 */
+	"gduln", "gdvfppynzfndb", "gdvq", "gdwezvvcqf",	/* 4732 */
+	"gdxfozrbfd", "gdz", "gdzzntcjweiph", "ge",	/* 4736 */
+	"geauwj", "geaxfansiiyax", "gebixayoov", "gebjaclssbsyeb",	/* 4740 */
+	"gebpnvsl", "gedllpsier", "gedroghiyue", "geffsulqp",	/* 4744 */
+	"gefuvrjdvcccw", "gegupsfvhpmi", "gehx", "gekdldxlepqxzr",	/* 4748 */
+	"gekrlh", "gekxw", "gelgrhlboyep", "gendphfsijrg",	/* 4752 */
+	"geoemkiwh", "geofo", "gepslssrtwizig", "gepwckrkpc",	/* 4756 */
+	"geq", "geqhxjtbkuluti", "gesxhtzzdnclgt", "getmkq",	/* 4760 */
+	"getosnspfcanr", "gewfjwv", "gewmomt", "gewwdr",	/* 4764 */
+	"gexiqn", "geyjquxdodrgc", "gez", "gezovjw",	/* 4768 */
+	"gf", "gfakhpnp", "gfanbhbm", "gfbgmzbkkkvoqh",	/* 4772 */
+	"gfbkpnqu", "gfcvdjgixejpi", "gfdbuvof", "gfdkcjtgms",	/* 4776 */
+	"gffsa", "gfgkwq", "gfguukk", "gfgzajvl",	/* 4780 */
+	"gfkdvmudbb", "gfkp", "gflbatgpkboqvz", "gfnl",	/* 4784 */
+	"gfokudm", "gfoplgbz", "gfqwkgrslj", "gfsfjo",	/* 4788 */
+	"gfsmfngxkqqke", "gftqgqmql", "gftu", "gfu",	/* 4792 */
+	"gfvwixhbup", "gfxal", "gfxktuulutjpc", "gfyjp",	/* 4796 */
+	"gg", "ggbnytjniqmqm", "ggcbttjm", "ggclqs",	/* 4800 */
+	"ggcw", "ggdphrq", "ggecokdxq", "ggf",	/* 4804 */
+	"ggfermtsgxatl", "gghijmmxre", "ggips", "ggisdzomeri",	/* 4808 */
+	"ggjbbkrv", "ggkpoabjeqm", "ggkziajthn", "ggmlyvohjxynp",	/* 4812 */
+	"ggnbzcgoh", "ggnh", "ggoxmqwokgvb", "ggqe",	/* 4816 */
+	"ggqglghozpj", "ggrx", "ggsauhrrh", "ggsdm",	/* 4820 */
+	"ggwomxh", "ggwxtasphizr", "ggylmxq", "ggztifzlfck",	/* 4824 */
+	"gh", "ghacgxhnafy", "ghdilo", "ghdjkgppinyjz",	/* 4828 */
+	"ghgzej", "ghhxdufiatfo", "ghiewwq", "ghjhrlzdm",	/* 4832 */
+	"ghkgzavah", "ghkkzugiupyfms", "ghl", "ghlcxpdet",	/* 4836 */
+	"ghljpkarlrjr", "ghm", "ghmbdzwipcbis", "ghofyfer",	/* 4840 */
+	"ghqabjxinvlqp", "ghsywpwaz", "ght", "ghtvegmwewgn",	/* 4844 */
+	"ghu", "ghuw", "ghwbi", "ghxhvxljgeltez",	/* 4848 */
+	"ghxqelvvohpb", "ghydcupbjtnvc", "ghyhvcgotifbp", "ghyijztuoze",	/* 4852 */
+	"ghyymb", "ghzoiev", "gi", "gian",	/* 4856 */
+	"giao", "giaoq", "giat", "gibpxcldn",	/* 4860 */
+	"gifeekcotk", "gigu", "gij", "gijsks",	/* 4864 */
+	"gikjpjyeuzm", "giljm", "gilngwjoqjow", "gimpyhnkaauk",	/* 4868 */
+	"gimqk", "gimxmrawvzy", "gimy", "ginosqmmvdk",	/* 4872 */
+	"ginqoabafmnyg", "gintclslvglh", "giouz", "gipfxvoterkf",	/* 4876 */
+	"gipkbddh", "gipmkoxztb", "giqgxn", "gis",	/* 4880 */
+	"git", "gitmstryxa", "gitprzxbwt", "gitvypslwgrmzk",	/* 4884 */
+	"gitxrn", "giueoskyklpimy", "giuhcnwlwlyyg", "giwclpjaa",	/* 4888 */
+	"gixdyt", "gixgmye", "gj", "gjascziqlymc",	/* 4892 */
+	"gjcpant", "gjcxdvih", "gjfxeumnplwybr", "gjgmkjyqgskr",	/* 4896 */
+	"gjgpedibf", "gjhahzgn", "gjhlfvgs", "gjhnacd",	/* 4900 */
+	"gjhwfqen", "gjhyebqvljuyzu", "gjiexwalt", "gjjwjrlfwwxotc",	/* 4904 */
+	"gjkelbvzruly", "gjmkjhdrdt", "gjmm", "gjmtmyyoaieehx",	/* 4908 */
+	"gjmztoyn", "gjnfkxcrjyu", "gjnpwgwth", "gjozor",	/* 4912 */
+	"gjpwcc", "gjqaqnzejemv", "gjqzlahlujw", "gjrj",	/* 4916 */
+	"gjstedtjtl", "gjtoknvwkutvra", "gjuvzf", "gjvlltp",	/* 4920 */
+	"gjxdaze", "gjyn", "gjzdzads", "gk",	/* 4924 */
+	"gkabcdifrjrvru", "gkbjpdb", "gkbyylolme", "gkcuixqyvdp",	/* 4928 */
+	"gkcwjxs", "gkcxq", "gkhhjaipch", "gkhqqvfwhpout",	/* 4932 */
+	"gki", "gkjlkdawoypq", "gkkgwdw", "gklsytazbf",	/* 4936 */
+	"gkobeqlsyqbar", "gkpgeplywmdigb", "gkpgpnfd", "gksbbyfqotrbv",	/* 4940 */
+	"gktbygfxuqo", "gkterhtahwplue", "gktppkdeewihcu", "gkv",	/* 4944 */
+	"gkvjacnsusb", "gkxpyu", "gkycz", "gkzx",	/* 4948 */
+	"gl", "gladpvibxd", "glaucnzg", "gle",	/* 4952 */
+	"glejjdcsalzp", "glfeabcveldgm", "glgobwbhjgryfg", "glia",	/* 4956 */
+	"gljaqr", "gljj", "gljoqfqnojmd", "gljtnj",	/* 4960 */
+	"gljywqyfad", "glkytmmkpej", "gll", "glloqmgboh",	/* 4964 */
+	"gllxs", "glmuje", "glmzvhtaxes", "glpgkmwlh",	/* 4968 */
+	"glqimndjenu", "glrgxeswdkf", "glrs", "glsqpi",	/* 4972 */
+	"glswbpifq", "gltbejcyc", "gltcyilcw", "gluh",	/* 4976 */
+	"gluxb", "gly", "glyehhti", "glzctuvcmu",	/* 4980 */
+	"glzpscafft", "gm", "gmavopdbzzwnxw", "gmb",	/* 4984 */
+	"gmbh", "gmefhcmbfk", "gmfceiakmlokt", "gmftwxtcgzzs",	/* 4988 */
+	"gmfyue", "gmgxqho", "gmisacwvbf", "gmjvcnbsc",	/* 4992 */
+	"gmkcjg", "gmlwjxi", "gmndivrz", "gmnrb",	/* 4996 */
+	"gmnuwslctellv", "gmoq", "gmpjbz", "gmpvlmsaxr",	/* 5000 */
+	"gmrtxofhq", "gmrxtlg", "gmt", "gmtdrg",	/* 5004 */
+	"gmuath", "gmuqzlg", "gmuruwawhbr", "gmwphqdclwkp",	/* 5008 */
+	"gmxm", "gmy", "gmysmpb", "gn",	/* 5012 */
+	"gnakntszax", "gnbncehnew", "gnbqkrywllvwnh", "gnbxfywv",	/* 5016 */
+	"gncqzpt", "gndfueoe", "gndk", "gneixvqipfudx",	/* 5020 */
+	"gnernsjlyqma", "gnfxqzsbmupiv", "gnl", "gnmu",	/* 5024 */
+	"gnn", "gnnwdvwenkqf", "gnrxdak", "gnsntvksefzon",	/* 5028 */
+	"gnssgiyoagcm", "gnsvtktpy", "gnuhebiccioblo", "gnuodwdil",	/* 5032 */
+	"gnuuiebbh", "gnveyosxhnls", "gnvgdgnrxkte", "gnwqthljm",	/* 5036 */
+	"gnyeqrcm", "gnzerlltp", "go", "goalsz",	/* 5040 */
+	"goattemaitcd", "gobaaxhzuqbv", "gobdmc", "gobpiclpcqong",	/* 5044 */
+	"gobsyrs", "gobv", "gocrbou", "godubywary",	/* 5048 */
+	"gofbbhxiyqa", "goglaosywmcx", "gogqaxmlk", "gohgudcmere",	/* 5052 */
+	"gohpjcqidmcsn", "gohqf", "gohu", "gohwtndnurtzs",	/* 5056 */
+	"goi", "gokyadofayc", "golun", "gon",	/* 5060 */
+	"gondfm", "gonkvakf", "gonrzzx", "gonywqbg",	/* 5064 */
+	"gop", "gorzigavnuhgl", "gos", "gouedwdnboelrk",	/* 5068 */
+	"govcozpk", "govmmyrghnn", "goxszfxzrqtfb", "goy",	/* 5072 */
+	"gozkdvkowzbe", "gozmrtfz", "goztuxjqwgcokl", "gp",	/* 5076 */
+	"gpbcijjqlgoxzf", "gpcgtltcmcn", "gpcktn", "gpcvtwlenttku",	/* 5080 */
+	"gpeglpwjkurvu", "gpemybufsw", "gpgijsrqih", "gpgqacf",	/* 5084 */
+	"gpkkywwhgffk", "gpnjwfhzzwuuz", "gpo", "gpojenhpme",	/* 5088 */
+	"gppnwqio", "gprb", "gprtjl", "gpswydjpdppg",	/* 5092 */
+	"gpubambzzna", "gpump", "gpvy", "gpwhltquwf",	/* 5096 */
+	"gpwpc", "gpyvqxvpnzysd", "gpzenoyoitolg", "gqbpb",	/* 5100 */
+	"gqbpzlfomfic", "gqbqarbxwp", "gqbqpj", "gqg",	/* 5104 */
+	"gqhhgmnjcfobav", "gqidmcpqjrc", "gqivkkkricqhbc", "gqjbjbknp",	/* 5108 */
+	"gqkeihvrcbbf", "gqlasgyif", "gqlfaagpkxzxpj", "gqmdtvedzkhng",	/* 5112 */
+	"gqmhkypkrzqc", "gqofmnmxyq", "gqphjkhbutql", "gqqey",	/* 5116 */
+	"gqreqb", "gqrrjuadpwn", "gqrygjkqvldb", "gqsdyuyb",	/* 5120 */
+	"gqtjji", "gqtlhucmm", "gqwfjutj", "gqwidtrftqr",	/* 5124 */
+	"gqx", "gqxqbizpdi", "gqxxzsw", "gqy",	/* 5128 */
+	"gr", "graiutxx", "grcrkkjqebolzx", "gre",	/* 5132 */
+	"grghmfdq", "grgtdpynvlcz", "grhhzhjnnrmgy", "grkamd",	/* 5136 */
+	"grkwoi", "grl", "grlvayzeidw", "grlyicgcl",	/* 5140 */
+	"grnwhseromw", "grrauiyquzlr", "grrscvn", "grsgvy",	/* 5144 */
+	"grszqbckq", "grtcutcbi", "grw", "grwyxncyypfyi",	/* 5148 */
+	"grxx", "grymborgqqrp", "grz", "grzdgdyevfwd",	/* 5152 */
+	"gs", "gsakvcte", "gsdhox", "gseenurdvkdg",	/* 5156 */
+	"gseflu", "gsfnplthasgnwd", "gsgxscbyqflf", "gsh",	/* 5160 */
+	"gsitninfh", "gsivjwhznhiohb", "gsjivgo", "gskpg",	/* 5164 */
+	"gsnjtheqbt", "gsnkzzrz", "gsnpytphl", "gso",	/* 5168 */
+	"gsofywtqbmg", "gsopmjlyyft", "gsouhwgefju", "gspyxxxey",	/* 5172 */
+	"gspzcore", "gsqcddrbjf", "gsqtrjrg", "gsrvuthlktxwk",	/* 5176 */
+	"gsszmvav", "gstrflkshnny", "gsvhepdl", "gswep",	/* 5180 */
+	"gsyejiwrbbiv", "gszbrsaumjtjy", "gszrjfqi", "gt",	/* 5184 */
+	"gtaqvfdkl", "gtdhafltwupyd", "gte", "gtfk",	/* 5188 */
+	"gtfol", "gthpigueapbo", "gtit", "gtjxv",	/* 5192 */
+	"gtkgdmxwbvexx", "gtkploly", "gtlhkcoep", "gtnahamebx",	/* 5196 */
+	"gtnyrttc", "gtomq", "gtowpnkuo", "gtqtupenra",	/* 5200 */
+	"gtrkegiqqyr", "gttanimnrnnr", "gttoggjeurvo", "gtuaenl",	/* 5204 */
+	"gtvbnbfsdk", "gtvkhipjykf", "gtwdhyaqr", "gtxetatisaawro",	/* 5208 */
+	"gtyxhujxv", "gu", "guajusc", "guauabwzg",	/* 5212 */
+	"gubw", "gufmxkgg", "gugzezgdx", "guhbmdgzqiyagw",	/* 5216 */
+	"guheq", "guhwbcbbgyl", "gukfwkja", "gulflldic",	/* 5220 */
+	"guoqyb", "guoszmpftftkte", "guouutdhuaoy", "guowjpjjdma",	/* 5224 */
+	"guptgdwsvk", "guqf", "guriscyxmzseo", "gurmxdjvsdxtlx",	/* 5228 */
+	"gutdhbxalaq", "gutraavcvzykw", "gutwcabmidvec", "gutznqbvkayjo",	/* 5232 */
+	"guvfwm", "guvslrkvya", "guwfg", "guwxpmawsoy",	/* 5236 */
+	"guwyqc", "guxlo", "guyvpcmrx", "guyxcgcimtccn",	/* 5240 */
+	"gv", "gvbibexbftrioa", "gvbjdpmht", "gvbxu",	/* 5244 */
+	"gvdg", "gvez", "gvf", "gvfbxhk",	/* 5248 */
+	"gvfceebz", "gvfncld", "gvfphpckbp", "gvhyediraa",	/* 5252 */
+	"gviashldh", "gvigeqcqxvxtit", "gvjhdgtp", "gvju",	/* 5256 */
+	"gvlocohdm", "gvlx", "gvmsdxlwnqe", "gvn",	/* 5260 */
+	"gvohdabtjwbiom", "gvracxprr", "gvsu", "gvtamohqoqjk",	/* 5264 */
+	"gvv", "gvvwncwd", "gvyieojfgei", "gvzkghf",	/* 5268 */
+	"gw", "gwangghrbdlaf", "gwaoyowaejavcj", "gwb",	/* 5272 */
+	"gwbgn", "gwblkzzaqhayws", "gwbmmift", "gwetgydohdcdl",	/* 5276 */
+	"gwhklyevclovof", "gwkwoiwici", "gwmsj", "gwmt",	/* 5280 */
+	"gwo", "gwq", "gwqwturchmyod", "gwrhezm",	/* 5284 */
+	"gwscob", "gwskyrpdesjse", "gwunlb", "gwvwiqj",	/* 5288 */
+	"gwzleaubve", "gwzmg", "gwzodygb", "gwzud",	/* 5292 */
+	"gx", "gxaerdsd", "gxaftae", "gxbd",	/* 5296 */
+	"gxbhivwblppzto", "gxcah", "gxdcd", "gxdcrhjfyddxbi",	/* 5300 */
+	"gxff", "gxgnzfky", "gxkfyno", "gxkksayd",	/* 5304 */
+	"gxmjj", "gxmxzom", "gxo", "gxolspmfe",	/* 5308 */
+	"gxoqybez", "gxoyoichj", "gxqkpro", "gxqvzduj",	/* 5312 */
+	"gxqwg", "gxrdurx", "gxskiazxbv", "gxupanfwha",	/* 5316 */
+	"gxut", "gxweg", "gxwtf", "gxydpqf",	/* 5320 */
+	"gxytrjzzombu", "gy", "gyagkr", "gybluzuzhv",	/* 5324 */
+	"gybmqeh", "gydlcxerqard", "gydlkofixrlcx", "gyfognl",	/* 5328 */
+	"gygjbpgla", "gygv", "gyhu", "gyhwruqtvk",	/* 5332 */
+	"gyiuedbrnvu", "gykcniwvyhbj", "gykzasuftnj", "gylwfjvn",	/* 5336 */
+	"gymjpjrwtbihk", "gymjxpabjjgz", "gyngxnlhqicafw", "gyo",	/* 5340 */
+	"gypbkrszcnus", "gyprkycvuzszy", "gyq", "gyqejrlcccd",	/* 5344 */
+	"gyt", "gyttbrmhdvxcqq", "gytybu", "gyveedersan",	/* 5348 */
+	"gyvpzeuzyodhit", "gyw", "gywxevcyhsxg", "gyyeb",	/* 5352 */
+	"gyyrgyg", "gyzhujvvvtmgal", "gyzofxzhwy", "gyzsipzwm",	/* 5356 */
+	"gz", "gzakqjlcnr", "gzbuo", "gzbxdretly",	/* 5360 */
+	"gzeuk", "gzf", "gzg", "gzjwfdumv",	/* 5364 */
+	"gzlzldtmij", "gzmwermwlldpj", "gznrynpxghdv", "gznsrvbxecopk",	/* 5368 */
+	"gzphgsfod", "gzpumpmkum", "gzq", "gzqyurd",	/* 5372 */
+	"gzrdlt", "gztyrw", "gzu", "gzuafnqe",	/* 5376 */
+	"gzuqcssvgx", "gzvdamggucgvya", "gzvezhyzk", "gzvnjtjuh",	/* 5380 */
+	"gzxsckv", "gzydsgybpxgckc", "gzyjtyrhf", "gzylersqnuokm",	/* 5384 */
+	"gzyxoamsg", "gzzgx", "gzzichgqubsxx", "gzzwjkdu",	/* 5388 */
+	"ha", "hacbafjp", "hacd", "haeaeu",	/* 5392 */
+	"haeynlizpbmd", "hafdlixtnoz", "hafdyx", "hafjls",	/* 5396 */
+	"haimmfau", "haitpqcy", "hakbgyt", "hakoykilw",	/* 5400 */
+	"halzn", "hamco", "hamcu", "hamehs",	/* 5404 */
+	"hamtacsr", "hapzf", "harbquiz", "harvwlycqgydl",	/* 5408 */
+	"hatgoqgnlyzr", "hatmxhysox", "hautkhhijcctg", "havrpkqxv",	/* 5412 */
+	"havxp", "havz", "hawxyztbagaid", "haxjpx",	/* 5416 */
+	"haybmrvgzwxs", "hayufqvanfdjm", "hazkrhkhypu", "hb",	/* 5420 */
+	"hbaixni", "hbazy", "hbc", "hbdefvgciik",	/* 5424 */
+	"hbdoytsnwi", "hbforwstgrpowk", "hbgmpwwgdpcr", "hbi",	/* 5428 */
+	"hbif", "hbjerawvfobna", "hbjfvraw", "hbk",	/* 5432 */
+	"hblfz", "hblrst", "hbnzd", "hbofqiunurcb",	/* 5436 */
+	"hbpt", "hbq", "hbrij", "hbvnqtd",	/* 5440 */
+	"hbvtqgkrumckp", "hbw", "hbwqwdbvabyn", "hbwrnc",	/* 5444 */
+	"hbx", "hc", "hcaiucxge", "hcarnll",	/* 5448 */
+	"hcavnvqqhewkup", "hcaysttsa", "hcb", "hcbkejdfebth",	/* 5452 */
+	"hcc", "hcceol", "hccrjof", "hcdknmrarjezj",	/* 5456 */
+	"hcdrhvaeruoolw", "hcefekosh", "hceisjwz", "hcekqppq",	/* 5460 */
+	"hcfmn", "hcgsljowhjszg", "hchll", "hci",	/* 5464 */
+	"hcibtiq", "hcivvud", "hcj", "hckismtnwoi",	/* 5468 */
+	"hcksbyobmllysb", "hckxivfqgoy", "hclovcxqor", "hcmd",	/* 5472 */
+	"hcmqpameh", "hcnlzdfyhu", "hcnnqgsx", "hcoknirag",	/* 5476 */
+	"hcouyqjr", "hcowinoafz", "hcpl", "hcpmebphutbmv",	/* 5480 */
+	"hcrpymmxztj", "hctruspm", "hctxlbyi", "hcuqhdoepibw",	/* 5484 */
+	"hcwrly", "hcwtdokrilhr", "hcyyucuuz", "hcyzfiadq",	/* 5488 */
+	"hcz", "hd", "hdakheswxhw", "hdalcwfwpdheox",	/* 5492 */
+	"hdawgarntwl", "hdbttlnk", "hdcvxbn", "hddi",	/* 5496 */
+	"hdfoq", "hdge", "hdhgxqwfjuy", "hdhlgsrzgug",	/* 5500 */
+	"hdisjuvrins", "hdjassremkxfu", "hdjljaq", "hdjrpqazxw",	/* 5504 */
+	"hdkqdivwxe", "hdmapseumjzh", "hdmmkvyyn", "hdmohg",	/* 5508 */
+	"hdneewm", "hdpl", "hdqbzf", "hdqldkczx",	/* 5512 */
+	"hdrpojz", "hdrx", "hduwxsne", "hdvkiaqkdlzzu",	/* 5516 */
+	"hdw", "hdwex", "hdwzokarkze", "hdxebqtz",	/* 5520 */
+	"hdxuemq", "hdxyplqooao", "hdz", "hdzdnepjkbo",	/* 5524 */
+	"he", "heaalmmvshj", "heaammuerwdj", "hearnbzna",	/* 5528 */
+	"heccfotx", "heclljvh", "hedmnqbo", "hedszxvav",	/* 5532 */
+	"hefiwhn", "hegb", "heicjydqdayk", "hejagvnpquu",	/* 5536 */
+	"helr", "hem", "henbgiamfkor", "heo",	/* 5540 */
+	"heomzfazets", "hepovrm", "heseelfng", "heu",	/* 5544 */
+	"heuvhoyrfblas", "hevzsvczkbxy", "hewzjqolsvq", "hey",	/* 5548 */
+	"heywc", "hezqxcao", "hf", "hfagun",	/* 5552 */
+	"hfebvoqmluq", "hffbf", "hfhhnw", "hfhjmpxj",	/* 5556 */
+	"hfj", "hfk", "hfleyl", "hfmwpttkhpakbz",	/* 5560 */
+	"hfmzsd", "hfndzdn", "hfnyfemtc", "hfoio",	/* 5564 */
+	"hfqjevdeaqczr", "hfqjzc", "hfrspfltmqz", "hfs",	/* 5568 */
+	"hfuaudiga", "hfuiwrjtuxp", "hfvjkjbdlzjbp", "hfvkiuykf",	/* 5572 */
+	"hfwgzghk", "hfyzguhvkfivg", "hg", "hgakrbhrmoboj",	/* 5576 */
+	"hgatroecjxdrb", "hgayrvfb", "hgdiri", "hgefklyrrnrbs",	/* 5580 */
+	"hggu", "hgjfiayosfio", "hgjvvscwsgcarx", "hgjzpfltgq",	/* 5584 */
+	"hgknizrszyzyig", "hgl", "hglarmcpajro", "hgluosqezycn",	/* 5588 */
+	"hgmhme", "hgmnxmefddrqsc", "hgnvfqdkkbdgur", "hgnwoswurdwge",	/* 5592 */
+	"hgnztsvn", "hgotroaa", "hgpvtadzcfr", "hgqedkhxu",	/* 5596 */
+	"hgqyhmsi", "hgrvs", "hgtuawnuhwp", "hguuj",	/* 5600 */
+	"hgvoap", "hgxlh", "hgyejwv", "hgymn",	/* 5604 */
+	"hh", "hharlsjeis", "hhbtpvkggda", "hhd",	/* 5608 */
+	"hhdxmel", "hheicr", "hhgdlj", "hhgzx",	/* 5612 */
+	"hhhafq", "hhhzirndvncgxk", "hhiijigsv", "hhjlghsyd",	/* 5616 */
+	"hhkf", "hhkuowqxm", "hhljoiqlkfwak", "hhlvlzqv",	/* 5620 */
+	"hhmik", "hhmsheuc", "hhn", "hhocyvtjxtzzhm",	/* 5624 */
+	"hhohkxmtotpgyc", "hholhytt", "hhotr", "hhp",	/* 5628 */
+	"hhpfqtzttckd", "hhqfr", "hhsswaorna", "hhttj",	/* 5632 */
+	"hhununka", "hhuyvzo", "hhvn", "hhwmmgtexjxx",	/* 5636 */
+	"hhwpey", "hhxsgvsa", "hhzrrhuhpuac", "hi",	/* 5640 */
+	"hia", "hidztf", "hiegjrp", "hievlsjagrsq",	/* 5644 */
+	"hifpbcbbrqu", "higawxbiyiimw", "higpfqvwt", "hihdjzdb",	/* 5648 */
+	"hihojkw", "hii", "hikav", "hikipb",	/* 5652 */
+	"hiknfbobmeiz", "hikpykxcvebn", "hilbr", "himvzk",	/* 5656 */
+	"hin", "hioejol", "hiokjejb", "hiqblac",	/* 5660 */
+	"hiqurkskdgomvc", "hirxpxz", "hiswpzzvdwgc", "hitgmsqphhzris",	/* 5664 */
+	"hiu", "hivcnmiooi", "hivithvesbzgln", "hivukitxqmadk",	/* 5668 */
+	"hiwn", "hiwtxvtlxyl", "hixcueqt", "hiy",	/* 5672 */
+	"hj", "hjbdn", "hjbwnozcgmv", "hje",	/* 5676 */
+	"hjgkumasfwe", "hjgmfzga", "hjgnbvvwlk", "hjick",	/* 5680 */
+	"hjiouihrocarqg", "hjjpg", "hjjwyclydcb", "hjkicjnpupvfdg",	/* 5684 */
+	"hjlhafnaxngq", "hjlul", "hjmlmswgexo", "hjmx",	/* 5688 */
+	"hjnredbd", "hjqh", "hjujflfoc", "hjvnjffujhf",	/* 5692 */
+	"hjxxlkixz", "hjzbwbymrqtjq", "hk", "hkazrcoimg",	/* 5696 */
+	"hkcbnuvg", "hkcyem", "hkdrts", "hkdwntmuyg",	/* 5700 */
+	"hkdztrkvtscmz", "hkeeicfqlkdo", "hkfhsgcftzmjw", "hkftvpuyrm",	/* 5704 */
+	"hkgbtyo", "hkhqq", "hki", "hkjfjazrkehp",	/* 5708 */
+	"hkjfxzco", "hkkpbsuzee", "hklkobygss", "hkqecxjfgfggr",	/* 5712 */
+	"hkqvwpqwqim", "hkrcfcdpelfyx", "hktchmxtfxoa", "hktjbkqzlcotsx",	/* 5716 */
+	"hkvdbcm", "hkxk", "hkypaplqccyeb", "hl",	/* 5720 */
+	"hlahsjoan", "hlaweulb", "hlbjar", "hlbwrhratxwiy",	/* 5724 */
+	"hlcfmbitqydbf", "hlcmxajqgu", "hlednttqmeuzxq", "hlfqa",	/* 5728 */
+	"hlhcxastlkyopz", "hlhkbfp", "hlk", "hllsnxwgb",	/* 5732 */
+	"hlnjuoahgq", "hlpcctjh", "hlqfe", "hlsoz",	/* 5736 */
+	"hltyabvwfmpgk", "hluqa", "hlvizdm", "hlvsy",	/* 5740 */
+	"hlwnncgmfpnb", "hlwp", "hlxgxtpodrvz", "hlygsc",	/* 5744 */
+	"hlzvaiu", "hm", "hmb", "hmd",	/* 5748 */
+	"hmdtylbbbrd", "hmfjb", "hmfr", "hmhdphkecydjq",	/* 5752 */
+	"hmkexrqzvvkg", "hmnpn", "hms", "hmtazsgjs",	/* 5756 */
+	"hmtigmlvfjcpv", "hmtoektuofym", "hmwmsxw", "hmytwmhcd",	/* 5760 */
+	"hmzzjvfdaxhia", "hnahnzydiozo", "hnanommkmuuxf", "hncpzsa",	/* 5764 */
+	"hncxhtbwin", "hnevdf", "hnfdxsyx", "hnfrbpbqusxnt",	/* 5768 */
+	"hng", "hnhovxhcoiplk", "hnigtzshpjgk", "hniyvnmipd",	/* 5772 */
+	"hnkdmehlodst", "hnkiqubstxayga", "hnkopfy", "hnmua",	/* 5776 */
+	"hnnkn", "hnnlxmba", "hnnph", "hnovlrgzp",	/* 5780 */
+	"hnpivecu", "hnqjtryrktohb", "hnrihfuyewsjy", "hnrp",	/* 5784 */
+	"hnsldowtz", "hntdmisbpuktuo", "hntgfpixov", "hnuhfdka",	/* 5788 */
+	"hnuwacfyp", "hnvolwx", "hnvqcfofudjilc", "hnvyuzrsit",	/* 5792 */
+	"hnwlmvhpflpqqf", "hnwzwnj", "hnxlk", "hnyuvqjfzcd",	/* 5796 */
+	"hnze", "hnzuxdot", "hnzznfgaone", "ho",	/* 5800 */
+	"hocukopzscn", "hodrvfaquzupb", "hoexoxmddcuaa", "hofavgwhts",	/* 5804 */
+	"hofc", "hoffeezhlxnxx", "hofgrxcdsus", "hofimpk",	/* 5808 */
+	"hofkquyjp", "hofxbxrxbxjz", "hog", "hogcdw",	/* 5812 */
+	"hoguo", "hohtl", "hohxv", "hoipr",	/* 5816 */
+	"hojdhobp", "holcblahtldxuv", "homfkhjysrgz", "honbh",	/* 5820 */
+	"honkitscbxpeym", "honkka", "hopwi", "hortcsrraim",	/* 5824 */
+	"hosjwcgsxhx", "hotcqibjfzbidu", "hovp", "hoxkeoql",	/* 5828 */
+	"hoxmjctd", "hoygsfndq", "hoykb", "hoyqqtsw",	/* 5832 */
+	"hpbpp", "hpcsmubgs", "hpdstrmxfzqlm", "hpf",	/* 5836 */
+	"hph", "hpi", "hpj", "hpjdjguykjlj",	/* 5840 */
+	"hpjf", "hpkgahwfsem", "hpkkhdyrlfd", "hplafvojie",	/* 5844 */
+	"hplhncidofwr", "hplqx", "hpmabxtyqnt", "hppjxbmakbje",	/* 5848 */
+	"hpq", "hprzvxbaqj", "hpszf", "hpunw",	/* 5852 */
+	"hpuq", "hpvhohhb", "hpvixbcec", "hpw",	/* 5856 */
+	"hpwdfxosj", "hpzgvrzmk", "hpzkpezbcdxf", "hq",	/* 5860 */
+	"hqakyaimw", "hqaybcjn", "hqccuiuklyhrqn", "hqcgu",	/* 5864 */
+	"hqchwnkng", "hqcxdybknbal", "hqdmovqlkipgqu", "hqfkzf",	/* 5868 */
+	"hqg", "hqgsicgjswz", "hqjmznt", "hqjpkrinh",	/* 5872 */
+	"hqkrz", "hql", "hqmnwhcerkrfg", "hqnizuvm",	/* 5876 */
+	"hqnridobjdt", "hqq", "hqqbovj", "hqqvxbwcitkcj",	/* 5880 */
+	"hqqzlcgbenfs", "hqrptc", "hqsu", "hqsugetshvjfdy",	/* 5884 */
+	"hqsvketblfsi", "hqtgq", "hqtzmolibmtnlb", "hqurxzjtum",	/* 5888 */
+	"hqvzngeshv", "hqw", "hqwywnnfgkleox", "hqxhmawlnz",	/* 5892 */
+	"hqy", "hqysxyjffpfwy", "hr", "hratsrkn",	/* 5896 */
+	"hrbvtrrhlpv", "hrchnw", "hrcmsfe", "hrdldipf",	/* 5900 */
+	"hrdulmgfkvrh", "hrfrmkjzrnyt", "hriedz", "hrjyujz",	/* 5904 */
+	"hrk", "hrmbeyp", "hrmgzjnpqpb", "hrnaunvda",	/* 5908 */
+	"hrnzfshlqxzn", "hro", "hronj", "hrrrw",	/* 5912 */
+	"hrsm", "hrt", "hrtzuscx", "hrwcddbnjbstb",	/* 5916 */
+	"hryjxf", "hrz", "hsaeorzvwszly", "hsbqvgnlzwcx",	/* 5920 */
+	"hsciljsrdo", "hscyfqlnmztq", "hsdhslys", "hseszigyztwads",	/* 5924 */
+	"hsi", "hsjhspl", "hslvgbftnacbwu", "hsmyy",	/* 5928 */
+	"hsnqxxtvbz", "hsnukhdciqea", "hspvibfibbyl", "hsrg",	/* 5932 */
+	"hsrgboka", "hsufevxnutk", "hsuupswbynzol", "hsvnhsyg",	/* 5936 */
+	"hsvrrd", "hsxqsxujo", "hsyw", "ht",	/* 5940 */
+	"htdvpdrugp", "htdyav", "htec", "htexejlgbufv",	/* 5944 */
+	"htgmck", "hthwufsrsazpd", "htihhq", "htijfzvwdalx",	/* 5948 */
+	"htmpcwffw", "htnjxvnpkslchb", "htqiro", "htqnzhxynsau",	/* 5952 */
+	"hts", "htszdtrv", "htueeujem", "htuwbpabln",	/* 5956 */
+	"htvln", "htvlqxnal", "hu", "hua",	/* 5960 */
+	"huaiwm", "huaxwuxprfofmn", "huazxmgyi", "hucvbqam",	/* 5964 */
+	"huhdmq", "huhrokqdjpyqzn", "huhwydfp", "huj",	/* 5968 */
+	"hujafuk", "hulfxunfz", "hulo", "humhmsttzcilhy",	/* 5972 */
+	"humlqy", "humnkoea", "huoaszuoodkn", "hupcaef",	/* 5976 */
+	"hupprytrsor", "hurbkuojrh", "hurezq", "hury",	/* 5980 */
+	"hutbivpnyunjuf", "hutbqk", "hutznhmsv", "huv",	/* 5984 */
+	"huvttietfnx", "huwqjojrk", "huxnemfqqycsi", "huxx",	/* 5988 */
+	"huzfnns", "hv", "hvaxluuztkysip", "hvb",	/* 5992 */
+	"hvcdzdh", "hvdn", "hvejsyvsypkez", "hvekm",	/* 5996 */
+	"hveuyx", "hvfthsntsjb", "hvgm", "hvixf",	/* 6000 */
+	"hvjrnlblw", "hvkpxp", "hvn", "hvo",	/* 6004 */
+	"hvpzhplrcbshel", "hvqbbmtrhuq", "hvqdvbpmjsf", "hvqztnhejrhm",	/* 6008 */
+	"hvsdwd", "hvstmkfbd", "hvtvvmvd", "hvufgvznk",	/* 6012 */
+	"hvuhahnukxmasa", "hvupepvrnqmqa", "hvzmsqzbhyjwl", "hw",	/* 6016 */
+	"hwa", "hwaryxgfsnych", "hwco", "hwex",	/* 6020 */
+	"hweyvau", "hwfhsr", "hwgreynbivqoe", "hwguywvocspuk",	/* 6024 */
+	"hwivfnv", "hwjsenhitochdx", "hwkgd", "hwkrvcuwwyzlpg",	/* 6028 */
+	"hwlbblwcaggclo", "hwle", "hwloyrav", "hwnjzcztrwfjtw",	/* 6032 */
+	"hwoqfebkyyo", "hwplpz", "hwqemnowqhqeu", "hwrkzhttzitks",	/* 6036 */
+	"hwtabj", "hwuraaad", "hwuziwwb", "hwwrnl",	/* 6040 */
+	"hwxppnyds", "hwy", "hwzmfzwqpix", "hwzydgsuf",	/* 6044 */
+	"hx", "hxa", "hxbqvzikl", "hxclelokqrbnh",	/* 6048 */
+	"hxcpzefr", "hxcqop", "hxgagprozlp", "hxhhxlqq",	/* 6052 */
+	"hxhuqux", "hxiydkbnz", "hxk", "hxmtdu",	/* 6056 */
+	"hxntv", "hxpdirjc", "hxpdkkny", "hxqbum",	/* 6060 */
+	"hxrtptwsw", "hxsblfchbehpzq", "hxtbvgai", "hxupbfsqltxkb",	/* 6064 */
+	"hxvsdgw", "hxwmdio", "hxy", "hxzjopyvntx",	/* 6068 */
+	"hxzmnvflr", "hyaa", "hyafjckq", "hycovwchejiwno",	/* 6072 */
+	"hycrirtoqmu", "hydlcfnh", "hydtnxacddg", "hyfqenlsfyz",	/* 6076 */
+	"hygx", "hyh", "hyibaodbu", "hyiyxvm",	/* 6080 */
+	"hyizpiy", "hyjbeda", "hyjcjzwhzwd", "hykgm",	/* 6084 */
+	"hykwxva", "hylanpwtxeabb", "hylz", "hymduf",	/* 6088 */
+	"hymzmseco", "hyoa", "hyoafvyovbh", "hyojgdbw",	/* 6092 */
+	"hyow", "hyr", "hyrdcyalywj", "hysgwwjouerhvu",	/* 6096 */
+	"hyulejb", "hyulwljtuqw", "hyx", "hyye",	/* 6100 */
+	"hyzei", "hyzlhcl", "hyznkubjujic", "hz",	/* 6104 */
+	"hzakjayzrvxr", "hzaptyatqa", "hzgx", "hziazy",	/* 6108 */
+	"hzicsg", "hzkdabotmfauv", "hzkgbwztswbslh", "hzkxxznxf",	/* 6112 */
+	"hzlcqxm", "hzltixccxgp", "hznmdmxjo", "hzoeoms",	/* 6116 */
+	"hzofuznsia", "hzphqmd", "hzqwtrnbx", "hzrqsuygzdyn",	/* 6120 */
+	"hzsrvumcey", "hzuanjvfe", "hzuulqjvae", "hzuwtsxzmjivc",	/* 6124 */
+	"hzvkgczkf", "hzvmf", "hzvy", "hzwa",	/* 6128 */
+	"hzwb", "hzwdhilhsfollw", "hzxwnx", "hzzvjzotgq",	/* 6132 */
+	"ia", "iab", "iabagrdrcm", "iabpcxgiwikv",	/* 6136 */
+	"iabpuufnj", "iacdnedigc", "iacpbqmdunmms", "iaeb",	/* 6140 */
+	"iaf", "iah", "iaiqfvy", "iajim",	/* 6144 */
+	"iakjxlbu", "ialejhtclwrn", "iametkfzoeibm", "iao",	/* 6148 */
+	"iaoooqnxztgtlu", "iapsg", "iapyqen", "iaqmrvv",	/* 6152 */
+	"iaruoyjp", "iascku", "iasypummevq", "iat",	/* 6156 */
+	"iatoktwylbj", "iatwvfgwvt", "iav", "iavbt",	/* 6160 */
+	"iavqjjsdi", "iavqkaa", "iaxwhoujj", "iaybpxneytfxgq",	/* 6164 */
+	"iaypliowwt", "iazjeplniml", "iazzkuqhgkpxlh", "ibaemozuxuqu",	/* 6168 */
+	"ibaxkcmhklsfi", "ibcu", "ibcv", "ibcyjzi",	/* 6172 */
+	"ibeibzvqhqmdkg", "ibekzivof", "ibfmwxvpcelgu", "ibhfwmswfzwhnt",	/* 6176 */
+	"ibiuhzgxzm", "ibjitzzknfnqy", "ibkxyb", "ibm",	/* 6180 */
+	"ibmlhpmq", "ibmugubxgddx", "ibmxtfwbm", "ibmyyony",	/* 6184 */
+	"ibnmeyqmauejjc", "ibopez", "ibpywrwzwmky", "ibqyvhibxmvg",	/* 6188 */
+	"ibringw", "ibsb", "ibshf", "ibsucnhdhpd",	/* 6192 */
+	"ibty", "ibvyqp", "ibwazycwjr", "ibx",	/* 6196 */
+	"ibyodhrhfavaj", "ibyrrojkvgukv", "ibzgaa", "ibzhtlebhzl",	/* 6200 */
+	"ibzminxho", "ic", "icavpmwudcnzcj", "iccbwtydyvv",	/* 6204 */
+	"icdatwrazhhpws", "icddrytuwnizjg", "iceshglyyqrc", "icgcder",	/* 6208 */
+	"icgkthjfg", "ich", "ichzxoljswjwi", "icifj",	/* 6212 */
+	"icirpzjs", "ickh", "iclpvpjjvcctn", "icmlrjyxvf",	/* 6216 */
+	"icmqnzoltqdf", "icntbipxeelqp", "icpkusrqffdv", "icpuywhqgi",	/* 6220 */
+	"icpvr", "icq", "icr", "icrkncsmofalnk",	/* 6224 */
+	"icrlkrlxi", "icswdksqmvxjn", "icthcyafvc", "icurayev",	/* 6228 */
+	"icvwtjqedblu", "icvznxbcy", "id", "idalgpz",	/* 6232 */
+	"idbkcbzptgtgy", "idbktvcdrylx", "idc", "idcj",	/* 6236 */
+	"iddloaoyyi", "idehiycg", "ideozptfr", "idhbxntwlc",	/* 6240 */
+	"idilmkbud", "idlouzjnl", "idmpmol", "idnpwxihq",	/* 6244 */
+	"idobfzsmxfsz", "idocpoqvw", "idpdpgfllin", "idpfg",	/* 6248 */
+	"idqtgbrhqomxjp", "idqvfpzw", "idsbvtllp", "idshyqwye",	/* 6252 */
+	"idsqg", "idtouujp", "idvmjfh", "idvwslvjaknsk",	/* 6256 */
+	"idxdms", "idxfhii", "idxnwmzs", "idzplzie",	/* 6260 */
+	"idzvbrnvisokq", "ie", "iebbnsmi", "iebmzvxeceiaco",	/* 6264 */
+	"iebppxj", "iebrilko", "iec", "iecb",	/* 6268 */
+	"ieedy", "iefnm", "iegnzpsqznys", "iehi",	/* 6272 */
+	"ieipbhcezvo", "ieistfwa", "ieit", "iekjuhyoerbf",	/* 6276 */
+	"ieknqzm", "ielrn", "ieltz", "ieojqlxae",	/* 6280 */
+	"iepjzhdbg", "ieqdiqnppuc", "ieqtu", "ieqxvilsr",	/* 6284 */
+	"iermusnthqffwk", "ierxk", "iesbjsep", "ietstrgnyibs",	/* 6288 */
+	"ietwwax", "ieunq", "ieuoosdrsmh", "iev",	/* 6292 */
+	"ievaxct", "iexgxsxtlrtcnw", "iexpfaywoxwh", "iexyiyczkcq",	/* 6296 */
+	"iezbrcgwrdxizu", "iezco", "iezuinscw", "iezvevdzc",	/* 6300 */
+	"if", "ifa", "ifaqaxn", "ifarabzujyumj",	/* 6304 */
+	"ifbob", "ifdouxibxwhl", "ifean", "iffpevnvo",	/* 6308 */
+	"ifgdszmwcuk", "ifgiat", "ifknidjkrzdix", "iflujdazs",	/* 6312 */
+	"ifoguuuzqnchxu", "ifpyytltbcgmjm", "ifqmcdk", "ifrxfvxjrwxqpj",	/* 6316 */
+	"ifthpq", "iftmkzpmtfn", "ifunlji", "ifuwej",	/* 6320 */
+	"ifvfaygsmlkx", "ifwcatxyra", "ifxkh", "ifybudr",	/* 6324 */
+	"ig", "igautjqehacnw", "igbkp", "igcvdcpt",	/* 6328 */
+	"igdaqyubtilllw", "igdhchmrnhpi", "iggnmksgw", "ighxaacqsv",	/* 6332 */
+	"igj", "igjqb", "igk", "igmfnhxlm",	/* 6336 */
+	"igmkygpa", "igngco", "igodhznhcvmg", "igoohvoanj",	/* 6340 */
+	"igp", "igrbtuzpor", "igrcp", "igsdpipxuti",	/* 6344 */
+	"igshzyvbihc", "igt", "igukpcddnmozg", "igvqfjxsn",	/* 6348 */
+	"igwxghgucssyb", "igxo", "igyxhuiszglgqi", "ih",	/* 6352 */
+	"ihafrokufkd", "ihagpyr", "ihcmja", "ihdwenhqh",	/* 6356 */
+	"ihfi", "ihfj", "ihg", "ihgasyakc",	/* 6360 */
+	"ihgdixpbxqjz", "ihgpusxydhhpf", "ihgslgeuemocq", "ihhcnv",	/* 6364 */
+	"ihhelw", "ihljzrovkzg", "ihmr", "ihneyhvmtxbhgs",	/* 6368 */
+	"ihnqgpza", "ihntdyei", "ihp", "ihphztwn",	/* 6372 */
+	"ihq", "ihqazqgr", "ihqtwb", "ihtlswktwtqxzo",	/* 6376 */
+	"ihvcrmof", "ihwlgksamdm", "ihwnsisrg", "ihxd",	/* 6380 */
+	"ihzpijklkgzi", "ii", "iib", "iicwhtgdmqqd",	/* 6384 */
+	"iigckw", "iiirf", "iilhxc", "iimmmhafmzu",	/* 6388 */
+	"iinwaohkp", "iiolkszmlrf", "iipwjipg", "iiqzjkkcnzob",	/* 6392 */
+	"iisn", "iitqip", "iityy", "iiujaqc",	/* 6396 */
+	"iiuvhjokwkgou", "iivquuoih", "iiw", "iiwcbut",	/* 6400 */
+	"iizdbzzgnt", "ij", "ija", "ijatyb",	/* 6404 */
+	"ijbaauy", "ijdrvlrcaq", "ijermwnicfiuvn", "ijfb",	/* 6408 */
+	"ijfg", "ijgrmxm", "ijhksq", "ijkvtxj",	/* 6412 */
+	"ijloyj", "ijnanfghtkfkkd", "ijnrfjdvvu", "ijo",	/* 6416 */
+	"ijogcvfvgwtcxk", "ijqybjppwfc", "ijrjfn", "ijrlshzx",	/* 6420 */
+	"ijrzawjazh", "ijttyjukyclga", "ijtzxlujvyu", "ijvdcmvbas",	/* 6424 */
+	"ijytomdhd", "ijzrjed", "ik", "ika",	/* 6428 */
+	"ikaebnzqu", "ikazzdr", "ikbcebisv", "ikbkgnsoay",	/* 6432 */
+	"ikbzlxxbx", "ikcoib", "ikczrvyxgpon", "ikfzs",	/* 6436 */
+	"ikgaerkqwrireg", "ikgagct", "ikgqozm", "ikhcawypecnuey",	/* 6440 */
+	"ikhrdxusdm", "ikidpeotmjq", "ikiv", "iklqdwe",	/* 6444 */
+	"ikmcajck", "ikmurpkdxru", "ikrqtprrje", "iks",	/* 6448 */
+	"iksfoej", "ikst", "ikthwysy", "ikujrixvt",	/* 6452 */
+	"ikuwownch", "ikvsdmmqnm", "ikwnhfa", "ikx",	/* 6456 */
+	"ikxhyrvfqwy", "ikxmowsppwv", "il", "ilaxywg",	/* 6460 */
+	"ilbapiiyavm", "ilctnd", "ilddar", "ildwllfx",	/* 6464 */
+	"ileo", "ilhefsyhnclqrf", "iliktx", "ilinqigqs",	/* 6468 */
+	"illozrkmrhqmd", "ilmta", "ilopheiafprgc", "ilqazxklg",	/* 6472 */
+	"ilquvrumfyhy", "ilrlatnkkxeon", "ilstxeedfxoi", "iltuatubsdz",	/* 6476 */
+	"ilujjgvnidd", "ilvwegbfyjmon", "ilw", "ilwilrmvtf",	/* 6480 */
+	"ilza", "ilzgwcsiycw", "im", "imaetwxxozj",	/* 6484 */
+	"imaj", "imcjssmgujpjg", "imcocmbluxvov", "imcvod",	/* 6488 */
+	"imdbreapj", "imdnn", "imf", "imgcnz",	/* 6492 */
+	"imgimrmorwy", "imgjwxut", "imgxgqoftur", "imhnkoqlzphfoh",	/* 6496 */
+	"imidgbiivh", "imiltsn", "imk", "imkn",	/* 6500 */
+	"iml", "imlbsqqgqvgi", "imlqwowuxfeq", "immsbfu",	/* 6504 */
+	"imnh", "imoasofadnhy", "imopmmdmk", "imoxrqnpn",	/* 6508 */
+	"impjcky", "imqtkiqtbrvwue", "imrdjyxj", "imrrmadpb",	/* 6512 */
+	"imsjb", "imvjlcztrlxykt", "imvo", "in",	/* 6516 */
+	"inahygubappct", "infqa", "inghdjtsrx", "inicrmedev",	/* 6520 */
+	"inieyzbgwclyb", "initdp", "inkndjxghyvclz", "inkpbwov",	/* 6524 */
+	"inkwxsun", "inkypgwpmwncc", "inlflnedesf", "inlm",	/* 6528 */
+	"inlxnkdoag", "inmvghe", "innjo", "inoewq",	/* 6532 */
+	"inokqdfmr", "inpopczsvdolk", "inpppsjhkmeogm", "inrjhgcouulk",	/* 6536 */
+	"insaxcpjwqbny", "intkbvyuzl", "intkpkcstby", "inu",	/* 6540 */
+	"inuxpbkjmbod", "inv", "invlxlzgotv", "invu",	/* 6544 */
+	"io", "ioati", "iobftuujkz", "ioeoviprsb",	/* 6548 */
+	"iofd", "iofnrdo", "iogeky", "iohisfg",	/* 6552 */
+	"iohur", "ioizzlux", "ioj", "iondqtrbvhhfsu",	/* 6556 */
+	"ioomoijmjsle", "iopdyxpjta", "iorcpjlg", "iosejwylkicdq",	/* 6560 */
+	"iouyv", "iovfhecijuxp", "iowmfewn", "ioxmaaaqxxsudi",	/* 6564 */
+	"ioxqidmhzoq", "iozwiz", "ip", "ipasrsvh",	/* 6568 */
+	"ipbbemxhbhova", "ipbkoxsqfyluk", "ipcjlzbzr", "ipewbt",	/* 6572 */
+	"iphmaadfb", "iphu", "ipivplsa", "ipjvhv",	/* 6576 */
+	"ipkgrk", "ipldwnbjxxdgr", "iplwithtt", "ipn",	/* 6580 */
+	"ipoe", "ipoyxwrotb", "ipqekegx", "ipuirmwworm",	/* 6584 */
+	"ipvfyjmwwww", "ipxzzfnj", "ipyc", "ipzlvdlbwwagls",	/* 6588 */
+	"iq", "iqbcsz", "iqbh", "iqc",	/* 6592 */
+	"iqca", "iqezzyrfdnex", "iqfvhqpbczsx", "iqfxgobqnl",	/* 6596 */
+	"iqggrhkqysmgz", "iqhhugkcmv", "iqisuyf", "iqjuoyyja",	/* 6600 */
+	"iqjvmkgnx", "iqkcojqfzbozvr", "iqmyzj", "iqnythaikefa",	/* 6604 */
+	"iqofgatlsnylg", "iqouegvfcrohid", "iqpbsanw", "iqpgvuetdp",	/* 6608 */
+	"iqphx", "iqpifyawfqv", "iqppdfzk", "iqqitetlcngkt",	/* 6612 */
+	"iqrxgswe", "iqrzgfgykmmfsw", "iqsgfkesbckjo", "iqtgnpx",	/* 6616 */
+	"iquba", "iquopsouslsbs", "iquthhffqxnpdk", "iqvdqgulal",	/* 6620 */
+	"iqweihzjurp", "iqygmvzieabdes", "iqynzosswje", "iqyp",	/* 6624 */
+	"ir", "ira", "irairiqi", "iraqcecjrqhjtr",	/* 6628 */
+	"iraqyqw", "irayrsy", "irbghvgwzlohbq", "ircipyilx",	/* 6632 */
+	"irdnkihq", "ireaxujjpeid", "ireqzxk", "irfatohyh",	/* 6636 */
+	"irfaxszib", "irfoopakxpq", "irfrtuc", "irg",	/* 6640 */
+	"irgvfkvxhomc", "irhh", "irhputqhltmin", "irjst",	/* 6644 */
+	"irl", "irm", "irmau", "irnqqshhondl",	/* 6648 */
+	"iroeniu", "irp", "irqa", "irqhdn",	/* 6652 */
+	"irqnnyvyy", "irqoiqkhgnc", "irqzluttanjf", "irs",	/* 6656 */
+	"irsqzysw", "irtwwwuiahygev", "irtz", "irull",	/* 6660 */
+	"iruoizgiccmcdy", "iruurrcun", "irwbu", "irwpmaqec",	/* 6664 */
+	"irwsoenneprd", "irxeqjma", "irxnfu", "irys",	/* 6668 */
+	"is", "isbd", "iscjoqteroxs", "iscrphml",	/* 6672 */
+	"isdsrjrexfc", "isdxrxrj", "isgieyf", "isgpdsppngdrfi",	/* 6676 */
+	"isgwach", "ishkmulz", "isijmzmzsfsfmz", "isioigrtxfv",	/* 6680 */
+	"isklkyslztorl", "isklwvhrytmdj", "iskorrije", "islq",	/* 6684 */
+	"islrrhhkndfe", "islvfadwegkozv", "ism", "isopzqljkl",	/* 6688 */
+	"isphhiflonhnql", "issiywzh", "issletia", "isswnaypgnz",	/* 6692 */
+	"isttuxjmbqa", "isu", "isuqqw", "isyeahipytrak",	/* 6696 */
+	"isyvxtqgranc", "iszexc", "it", "itaapwsgbvklqa",	/* 6700 */
+	"itcagdxclitj", "itcuw", "itdibyfnv", "itdp",	/* 6704 */
+	"itdq", "itejdk", "itf", "itfyxchf",	/* 6708 */
+	"itg", "itgxade", "ithkggrg", "itibdrpnkrtzc",	/* 6712 */
+	"itio", "itisxyuggvfa", "itjgqghkiccwq", "itkgm",	/* 6716 */
+	"itlruojqb", "itmghtnnm", "itojebijjzhdx", "itq",	/* 6720 */
+	"itqlufeqlwz", "itqrxlggalakqu", "itr", "itusk",	/* 6724 */
+	"itvskzrcex", "itymqmmnrcgz", "ityygjklhzzz", "itzczojauixqwa",	/* 6728 */
+	"itzjzoifjonom", "itznverxy", "iu", "iuazdnzbdbfkx",	/* 6732 */
+	"iubzq", "iud", "iudqev", "iuemhbhevjfc",	/* 6736 */
+	"iues", "iufrlxxdri", "iuhostqafwgx", "iujdcbwuwe",	/* 6740 */
+	"iukgvnavqo", "iulak", "iuldf", "iulxagtx",	/* 6744 */
+	"iumegzwthczsj", "iumzn", "iuoixsyi", "iuq",	/* 6748 */
+	"iuqj", "ius", "iushc", "iuumqaeohwqo",	/* 6752 */
+	"iuuosaeiidd", "iuupy", "iuvomrfoti", "iuvwkivpb",	/* 6756 */
+	"iuw", "iuwbvbthb", "iuwjowkppdaj", "iuwlts",	/* 6760 */
+	"iuwpupr", "iuxozioyp", "iuzv", "iv",	/* 6764 */
+	"ivbdoqrabuzm", "ivc", "ivdscisy", "ivgnj",	/* 6768 */
+	"ivhyyzgcrkgc", "iviiakmmhnddbd", "ivjczrmdqvn", "ivnbu",	/* 6772 */
+	"ivozzfrlpndygs", "ivpqmvjl", "ivq", "ivqxdbvhwby",	/* 6776 */
+	"ivrsldvwlnq", "ivrxaxvko", "ivsy", "ivtnjiocd",	/* 6780 */
+	"ivvafjfzeivzb", "ivvarvxdyloiyd", "ivvowmeordxgha", "ivvqvid",	/* 6784 */
+	"ivwybkx", "iw", "iwaosftp", "iwbtxligesk",	/* 6788 */
+	"iweiuwhlbr", "iwfdbcbjpbduj", "iwfihxhsgrzak", "iwhb",	/* 6792 */
+	"iwhlzpnzgoqvq", "iwimsht", "iwinvnmm", "iwkkgiwjxuipe",	/* 6796 */
+	"iwkqjb", "iwljbp", "iwlsdwmfkmbwov", "iwmunp",	/* 6800 */
+	"iwnxzpeaog", "iwq", "iwqlapulyxzpc", "iwquiwgdbbd",	/* 6804 */
+	"iwschsdpehokst", "iwsdsi", "iwt", "iwugafnfnpq",	/* 6808 */
+	"iwusmab", "iwwnmncreigt", "iwxxkdmocixf", "iwylusy",	/* 6812 */
+	"iwyn", "iwz", "ix", "ixaovnyp",	/* 6816 */
+	"ixaqw", "ixbekzqon", "ixc", "ixcekost",	/* 6820 */
+	"ixcli", "ixcnqlhdmvuys", "ixcrrnfzd", "ixdogwpxnjolr",	/* 6824 */
+	"ixdqhruddn", "ixdtz", "ixduexqsaispi", "ixevkops",	/* 6828 */
+	"ixewkw", "ixfd", "ixfnyqqo", "ixhq",	/* 6832 */
+	"ixhuzwunxcj", "ixl", "ixljpk", "ixlohjvcctaoy",	/* 6836 */
+	"ixlquyhctptzz", "ixmoylf", "ixnhualrlek", "ixnreni",	/* 6840 */
+	"ixnuwzpzz", "ixommpphafnk", "ixsubyhlryls", "ixtxycifdebgn",	/* 6844 */
+	"ixuhl", "ixvyjfyeyhri", "ixxdzqq", "ixzt",	/* 6848 */
+	"iy", "iyak", "iyaqocmmlzos", "iycvo",	/* 6852 */
+	"iyd", "iydzzir", "iyekn", "iyevn",	/* 6856 */
+	"iyfbcty", "iyfue", "iygalnvg", "iygbjjja",	/* 6860 */
+	"iygxegykmp", "iyhkcimdehpk", "iyjmwqlrwajx", "iykewdhij",	/* 6864 */
+	"iyknq", "iylgv", "iyltcznhtpl", "iyndv",	/* 6868 */
+	"iynhokshkzpkg", "iynomnsokr", "iypswcgg", "iyqpnyobxw",	/* 6872 */
+	"iyriijvelpo", "iys", "iysawytahtpg", "iysehyguukqzs",	/* 6876 */
+	"iytqyeepxaif", "iytwod", "iytzoqzchdrit", "iyurnaxnv",	/* 6880 */
+	"iyvd", "iyvp", "iyvylplkp", "iywqltvftyumul",	/* 6884 */
+	"iyx", "iyxc", "iyxlvp", "iyzecgyf",	/* 6888 */
+	"iyzjq", "iyzwjg", "izaaenqovcts", "izamkade",	/* 6892 */
+	"izautyd", "izbfqily", "izbjbpzamc", "izcehuclh",	/* 6896 */
+	"izcxqbqsalwgee", "izexjzvilz", "izfkpawtomxenr", "izfliboqeyp",	/* 6900 */
+	"izfmnnp", "iziesnlkmmcnp", "izitgh", "izkwshgha",	/* 6904 */
+	"izlvcijyyeinpa", "izmcfukhc", "iznajjhxkin", "izno",	/* 6908 */
+	"izobd", "izpcrdowsmygdq", "izq", "iztuhdru",	/* 6912 */
+	"izusp", "izwnvrj", "izwzcd", "ja",	/* 6916 */
+	"jab", "jacynvzaimgn", "jadfnq", "jaf",	/* 6920 */
+	"jafgkzsz", "jafjyc", "jagipydrtimp", "jahqp",	/* 6924 */
+	"jahtywcmbu", "jahu", "jaigywjumvrand", "jalpaytzhhbrv",	/* 6928 */
+	"jamdaarznwnb", "jaqjopnyknqgyc", "jarx", "jas",	/* 6932 */
+	"jaugeao", "jauoanad", "javfsgycz", "javinoi",	/* 6936 */
+	"jawyt", "jaxjvdj", "jaycjbxrhf", "jayfontwdx",	/* 6940 */
+	"jayi", "jayvfd", "jb", "jbbzaq",	/* 6944 */
+	"jbcgkenrmrgv", "jbchpksvalyg", "jbczuswhlvn", "jbdsb",	/* 6948 */
+	"jbdszbwsrp", "jbelj", "jbextqvdgjgg", "jbeyob",	/* 6952 */
+	"jbgusbbjxy", "jbjnsjljk", "jbktniviohp", "jbkwlco",	/* 6956 */
+	"jbliz", "jbmftugr", "jbmuneqjwdunp", "jbndpic",	/* 6960 */
+	"jbnqcbg", "jbqgvjkdkcvv", "jbsb", "jbslqamvdaas",	/* 6964 */
+	"jbt", "jbthajql", "jbtqkjbpcfx", "jbtwodxiswfap",	/* 6968 */
+	"jbuimrnvelv", "jbuj", "jbuztnj", "jbvgcys",	/* 6972 */
+	"jbwnyfywuuvaov", "jbx", "jbxlglbehbhxy", "jbys",	/* 6976 */
+	"jbzvgbsbtfrmk", "jc", "jcawsxa", "jcbiscrisj",	/* 6980 */
+	"jcdjgmabluguu", "jcdmqjjxqhkab", "jcdwggduqsuzqm", "jceeclkpqqm",	/* 6984 */
+	"jcffiqf", "jcfftyfvjjb", "jcfplivfndou", "jcghrh",	/* 6988 */
+	"jcgovcm", "jcidqw", "jcisrihrvwqdhi", "jcitosuydk",	/* 6992 */
+	"jciwrca", "jcjtedfutq", "jckgcdpts", "jclijmhgbkq",	/* 6996 */
+	"jcljnkxxuzgn", "jclyyqrbksb", "jcnafiusfr", "jcpixxjxhqqwhr",	/* 7000 */
+	"jcqernasumkm", "jcqkjzddxlsmof", "jcrbnweo", "jcrpdwvjrbb",	/* 7004 */
+	"jcrptlk", "jcu", "jcyczdiky", "jcyv",	/* 7008 */
+	"jd", "jdbibztppbg", "jdccdvbbkvxn", "jdd",	/* 7012 */
+	"jddhfxggguzo", "jdfxoaupbuswek", "jdg", "jdhcjtphnp",	/* 7016 */
+	"jdhqmc", "jdicd", "jdiiufobsca", "jdior",	/* 7020 */
+	"jdjanuocd", "jdjgle", "jdkdsspdzacna", "jdkmfsiy",	/* 7024 */
+	"jdkpc", "jdllhpvjgmdwr", "jdm", "jdnam",	/* 7028 */
+	"jdnazlcznedrz", "jdnci", "jdnhqrgkkqzm", "jdo",	/* 7032 */
+	"jdoptcuxyym", "jdoumkkmpfcyi", "jdr", "jdrbkmvp",	/* 7036 */
+	"jdrgrqnnvukdhb", "jdtflfocjkkc", "jdtplnqtmplb", "jdupw",	/* 7040 */
+	"jduravftxsmiuy", "jduurrotsulif", "jdxjrempncxq", "jdylkb",	/* 7044 */
+	"je", "jeabvzsigqrq", "jeadxbutkll", "jeahkyqpee",	/* 7048 */
+	"jeaiwjvpe", "jeavofms", "jedbss", "jedfvvr",	/* 7052 */
+	"jeegtgpvrn", "jeeoiykddgjjf", "jefeqlm", "jefj",	/* 7056 */
+	"jehcvdlhatdrok", "jehhtyxqntx", "jehkptu", "jehlofubsm",	/* 7060 */
+	"jeixodpmjdxpl", "jejrleyj", "jejtn", "jekchmbgx",	/* 7064 */
+	"jekgr", "jemktntapcumqk", "jemol", "jemoqke",	/* 7068 */
+	"jenh", "jenjflvbh", "jeqfs", "jeqjxpw",	/* 7072 */
+	"jeqoseryf", "jeqyltlpe", "jes", "jetpq",	/* 7076 */
+	"jewexjq", "jewlyzfl", "jexddnauztqgz", "jeywqsvd",	/* 7080 */
+	"jeyzdotzwvuw", "jf", "jfarkjxjoayiza", "jfbahoi",	/* 7084 */
+	"jfbehjhjhwn", "jfbwpol", "jfc", "jfdapusw",	/* 7088 */
+	"jfeb", "jfeqmvfg", "jffjyibuihv", "jffom",	/* 7092 */
+	"jfikdmdalcla", "jfjiuusnji", "jfkhtqtqtfunpw", "jflvccrsauayh",	/* 7096 */
+	"jfndalcbvga", "jfngnnemy", "jfnwp", "jfoddopbfyj",	/* 7100 */
+	"jfpiontqsqa", "jfpjrcgdfs", "jfpmykqpvny", "jfrca",	/* 7104 */
+	"jfs", "jfsdygoqit", "jftqwhkofmz", "jfuimidiadvzd",	/* 7108 */
+	"jfumba", "jfxbs", "jfxwkemu", "jfyuh",	/* 7112 */
+	"jg", "jgagslkups", "jgbjpf", "jgbjvve",	/* 7116 */
+	"jgbkogj", "jghvzz", "jgiznohann", "jgklim",	/* 7120 */
+	"jgmebj", "jgmnnhdgfy", "jgmnosugczsxt", "jgo",	/* 7124 */
+	"jgopjm", "jgp", "jgqopncsbdjm", "jgr",	/* 7128 */
+	"jgrai", "jgrc", "jgrokpebvrawuh", "jgskxsawpqy",	/* 7132 */
+	"jgu", "jguovhoy", "jgxkyepkqwfuu", "jgxnmyzc",	/* 7136 */
+	"jgyxxhmavmuler", "jh", "jhag", "jhclxkn",	/* 7140 */
+	"jhctl", "jhitl", "jhizekpm", "jhjnmehjgrayem",	/* 7144 */
+	"jhkbiifwh", "jhlqgyx", "jhmxw", "jhnukbgjpqu",	/* 7148 */
+	"jhoifamvo", "jhoixfwmbr", "jhoj", "jhpvxalamursu",	/* 7152 */
+	"jhqfznk", "jhrllks", "jhsesktnvx", "jhsigzjoivbxe",	/* 7156 */
+	"jhslipcnlxxju", "jhucb", "jhuyyyst", "jhyjib",	/* 7160 */
+	"jhzgfjbeean", "jhzhe", "jhzogjmvpdde", "ji",	/* 7164 */
+	"jiaj", "jibnghsef", "jieutelq", "jifilbnenypc",	/* 7168 */
+	"jifrncyyg", "jigyazvyqn", "jihm", "jiibvsygmohrw",	/* 7172 */
+	"jikwpmqubnz", "jil", "jilk", "jilohswbxhugzz",	/* 7176 */
+	"jiluyhv", "jimkdmyvuljwfl", "jimuerhqdxny", "jinai",	/* 7180 */
+	"jio", "jioaickede", "jiobuxzmw", "jiofm",	/* 7184 */
+	"jipcfmtg", "jiqwuhn", "jisksmi", "jisq",	/* 7188 */
+	"jiwewfw", "jiynogici", "jiyxgf", "jjacr",	/* 7192 */
+	"jjchswgysksv", "jjcmhphk", "jjeurmbdg", "jjfb",	/* 7196 */
+	"jjgevq", "jjhwykiljncl", "jjkdmmipawnzxv", "jjkel",	/* 7200 */
+	"jjkfqoima", "jjlchapulxuo", "jjlyqadhpeyb", "jjmdhd",	/* 7204 */
+	"jjmlwvaje", "jjnbook", "jjnrrw", "jjqbslzvyerukr",	/* 7208 */
+	"jjqpflzcy", "jjrdjthlubgj", "jjsur", "jjtgzqmi",	/* 7212 */
+	"jjukdilbpddv", "jjuwadfwmzts", "jjv", "jjvorrxyzrva",	/* 7216 */
+	"jjvyg", "jjw", "jjwns", "jjx",	/* 7220 */
+	"jjxmwucoduksx", "jjxrnrzbnvs", "jjxwuogjfx", "jjyl",	/* 7224 */
+	"jjyrstufot", "jk", "jkavpct", "jkchzzbrfzpgim",	/* 7228 */
+	"jkcmndf", "jkcx", "jkdfypnpvt", "jkdprjqsfbc",	/* 7232 */
+	"jkeoxic", "jkey", "jkezxwpjvqpm", "jkfoqje",	/* 7236 */
+	"jkhqhb", "jkicdhxiwulg", "jkjhrp", "jkjjwuvctkn",	/* 7240 */
+	"jkjvnpsfgsyr", "jkllmbqdkxci", "jkmumpge", "jkmyt",	/* 7244 */
+	"jknwommx", "jkp", "jkpkdftspjfyi", "jkqsyescglpxv",	/* 7248 */
+	"jkuishlynvex", "jkvwi", "jkwrs", "jkye",	/* 7252 */
+	"jkyzeaqfgmwdna", "jkz", "jl", "jlaqyapof",	/* 7256 */
+	"jlasg", "jlbobynyoo", "jlcilelkno", "jlcxphpmgybgv",	/* 7260 */
+	"jld", "jldckaggxlqam", "jldi", "jldxg",	/* 7264 */
+	"jlezo", "jlf", "jlftzquvvkkixo", "jlhbvzgd",	/* 7268 */
+	"jlhpdabx", "jlhu", "jllzu", "jlnckwbnyqsy",	/* 7272 */
+	"jlotqa", "jlpdu", "jlppl", "jlqqtfknnjjb",	/* 7276 */
+	"jlu", "jlwmap", "jlyvitiqm", "jlza",	/* 7280 */
+	"jlztckfotypbo", "jmanlywdztkx", "jmarivkno", "jmartv",	/* 7284 */
+	"jmbza", "jmc", "jmcjoqvreyfv", "jmcmfxasq",	/* 7288 */
+	"jmcvggpjgcvsu", "jmjaqwt", "jmjzwz", "jmkcnagke",	/* 7292 */
+	"jmkpdkzwk", "jmkvbtvmb", "jmnsifgbp", "jmnuhakfvcz",	/* 7296 */
+	"jmphvevirhd", "jmqdkmcchopx", "jmsdjcnzkd", "jmsminkawxnzo",	/* 7300 */
+	"jmts", "jmuyaqsvfdrm", "jmwekj", "jmwutnv",	/* 7304 */
+	"jmwyppwe", "jmxkr", "jmzeru", "jmzzmvmywucjf",	/* 7308 */
+	"jn", "jna", "jnashnilg", "jnbsoutm",	/* 7312 */
+	"jncvvgxizut", "jncxoiogfmtpfa", "jndynqqv", "jndzsnxzro",	/* 7316 */
+	"jneoicbqqdy", "jnf", "jngmu", "jngxx",	/* 7320 */
+	"jnjp", "jnjubcanf", "jnn", "jnnjkwzupo",	/* 7324 */
+	"jnq", "jnqfr", "jnsdgcd", "jnuhdrjc",	/* 7328 */
+	"jnuuwvkpocohx", "jnuxbvydqk", "jnuzje", "jnwdhrxliwad",	/* 7332 */
+	"jnwoqdmiikmhhv", "jnwwnutqk", "jnxmololyyswj", "jnytodk",	/* 7336 */
+	"jnzbcdgteoafg", "jnzcufjwuo", "jnzqfcbo", "jo",	/* 7340 */
+	"jocioasbybdv", "jocv", "joevqpley", "jogxclqutrc",	/* 7344 */
+	"jolrwnghnjvexr", "jonhwhbhdoygh", "jonrujshvsaq", "jonvawnpo",	/* 7348 */
+	"jooborn", "joouo", "joowrs", "jooyeckixw",	/* 7352 */
+	"jophqhelijo", "jopuylv", "jorhmav", "jotzfrrui",	/* 7356 */
+	"jovjinqohl", "jovlfoke", "jpbj", "jpbwbknjxrs",	/* 7360 */
+	"jpccr", "jpcevcdvu", "jpcuhmgcxipyog", "jpdckj",	/* 7364 */
+	"jpeijtebfhb", "jpexqzjykpj", "jpfiajh", "jpgln",	/* 7368 */
+	"jpjgjvrdepp", "jplfrpqalvu", "jplhnxsh", "jplt",	/* 7372 */
+	"jpmhhm", "jpnm", "jpnvlmoonczsj", "jppllxpeh",	/* 7376 */
+	"jppnl", "jpqrdznkxefti", "jpr", "jprcqeaucgtt",	/* 7380 */
+	"jpuvsqve", "jpuzrgzytk", "jpxjsjgmhgyd", "jpxotenzo",	/* 7384 */
+	"jpyausbc", "jq", "jqaawlmqsouopd", "jqasigrq",	/* 7388 */
+	"jqcj", "jqdm", "jqfepkzbkyohzn", "jqfk",	/* 7392 */
+	"jqgcsidq", "jqhgj", "jqib", "jqiektbi",	/* 7396 */
+	"jqjdusidfvotye", "jqkdttgg", "jqlgerujr", "jqnbgsqqzcd",	/* 7400 */
+	"jqnrqntusj", "jqnuzaczepxrla", "jqpu", "jqpvxhxxsdn",	/* 7404 */
+	"jqthqkict", "jquqcdifhayde", "jqvjchtwhfwrqp", "jqvvmyrwvgj",	/* 7408 */
+	"jqxoxvfzts", "jqyieg", "jqz", "jqzrpnui",	/* 7412 */
+	"jr", "jra", "jraudazomspu", "jrdbcgdxxnaw",	/* 7416 */
+	"jrdlozgyqw", "jregyzwso", "jrelyhcnfyos", "jrexyhodxen",	/* 7420 */
+	"jrhzijerzfyt", "jrkp", "jrlfbwnhokvxkb", "jrlpjefxolzki",	/* 7424 */
+	"jrntgukzwfbp", "jrntylxhqoq", "jrp", "jrpswdrljx",	/* 7428 */
+	"jrqalvdpzetzjr", "jrqtersnxdkh", "jrruymzt", "jrs",	/* 7432 */
+	"jrsd", "jrsdp", "jrsja", "jrtak",	/* 7436 */
+	"jrtnletza", "jrtxhle", "jruaxir", "jruqbwhv",	/* 7440 */
+	"jruysosrkbm", "jrvusqwtbqbgf", "jrwtson", "jry",	/* 7444 */
+	"js", "jsamaukaldps", "jse", "jsepclosmbywhx",	/* 7448 */
+	"jsf", "jshqfda", "jshtyszcqimmn", "jskxmogqzxjoe",	/* 7452 */
+	"jskygwqgflim", "jskzfmip", "jsmftdiiq", "jsnn",	/* 7456 */
+	"jsnsti", "jso", "jsosxjoezy", "jspnqq",	/* 7460 */
+	"jsq", "jsqapg", "jsrghrozdecm", "jsrlmxzegyb",	/* 7464 */
+	"jsrnhaczipra", "jstn", "jstw", "jsutixc",	/* 7468 */
+	"jsve", "jsvisr", "jswfore", "jsxi",	/* 7472 */
+	"jsxpzdiuo", "jt", "jtauf", "jtbkspu",	/* 7476 */
+	"jtbn", "jtcoelcntsw", "jtdyvydabh", "jtf",	/* 7480 */
+	"jtfnjpjunlz", "jtgpfc", "jthkclvxmgsx", "jtio",	/* 7484 */
+	"jtjlyatzttucyt", "jtmv", "jtmvokuqdolbf", "jtnnovamenqi",	/* 7488 */
+	"jtodafy", "jtpzaognne", "jtqh", "jtqoiu",	/* 7492 */
+	"jtqoxxc", "jtrls", "jtttaphqgs", "jtutfigk",	/* 7496 */
+	"jtvf", "jtwo", "jtwwwiakyy", "jtz",	/* 7500 */
+	"ju", "judlngsbqhwhiv", "judwxwzlzpvhe", "juffrooshxcy",	/* 7504 */
+	"jufogifrjxma", "juhslh", "juinypyhxmkyut", "jujjiqibvoqi",	/* 7508 */
+	"julasknlip", "juloojm", "junpcuatxpq", "juqkqyllpn",	/* 7512 */
+	"juqkrygs", "juqmmq", "juqukrqxr", "jurhcpzegdju",	/* 7516 */
+	"jusffpy", "jusxmgobvp", "juulsa", "juuxr",	/* 7520 */
+	"juwfeha", "juymqkfnvo", "juzcc", "juzhrzzbmlz",	/* 7524 */
+	"jv", "jvadgzuae", "jvakmge", "jvbfa",	/* 7528 */
+	"jvcglmmx", "jvcrwncc", "jvdrufdvol", "jvfjcurdu",	/* 7532 */
+	"jvfmbanbjx", "jvhchqzzjqttn", "jvhhxney", "jvhr",	/* 7536 */
+	"jvidenirniah", "jviu", "jvjappjlr", "jvje",	/* 7540 */
+	"jvkiwnlaaaqq", "jvlpwaxnryja", "jvm", "jvmdfxipsdebk",	/* 7544 */
+	"jvmzarbnxqogt", "jvnbjh", "jvngvtmuca", "jvnsht",	/* 7548 */
+	"jvpgqsji", "jvqfvd", "jvrudesaa", "jvszj",	/* 7552 */
+	"jvtmczpvs", "jvttwddont", "jvvcddq", "jvxfbuoporj",	/* 7556 */
+	"jvylha", "jvyvacca", "jvzzegewd", "jw",	/* 7560 */
+	"jwadtqbftyhyro", "jwbgigwincgnx", "jwc", "jwcfoq",	/* 7564 */
+	"jwebq", "jwegcrvwnyijb", "jwhbeimkfg", "jwhvytk",	/* 7568 */
+	"jwithdwfivm", "jwk", "jwktrwxgaw", "jwnrbvxvedyf",	/* 7572 */
+	"jwnyrzukhz", "jwolznfi", "jwovaep", "jwqkgghxhm",	/* 7576 */
+	"jwrmclc", "jwsvplhhvooihc", "jwufmvkta", "jwvgn",	/* 7580 */
+	"jwvmkotueu", "jwxyfkp", "jwywxl", "jwzlaxsagutxaj",	/* 7584 */
+	"jx", "jxatstdrq", "jxautyp", "jxavqnmeuwoshv",	/* 7588 */
+	"jxdmskgkwr", "jxeeupryistmit", "jxghrbjn", "jxgnxwabimedkr",	/* 7592 */
+	"jxigeirecz", "jxjwpjgneh", "jxlpzbmmn", "jxlxhwkj",	/* 7596 */
+	"jxmcsnevwq", "jxmkmvoplsmls", "jxno", "jxnsp",	/* 7600 */
+	"jxoivim", "jxoswwvhdz", "jxphx", "jxpvwxlnvef",	/* 7604 */
+	"jxqqlx", "jxqxmuvb", "jxsaoypvd", "jxsbwepr",	/* 7608 */
+	"jxsftptbekw", "jxsimd", "jxsplra", "jxtkomkmccktod",	/* 7612 */
+	"jxuh", "jxvsahgj", "jxwbwmi", "jxxhivkrih",	/* 7616 */
+	"jxygltb", "jxytdukc", "jxzpsl", "jy",	/* 7620 */
+	"jyapzzg", "jybklofkmxmsr", "jydcbrxbnh", "jydiq",	/* 7624 */
+	"jydwqq", "jyedeexwwvjq", "jyf", "jyfii",	/* 7628 */
+	"jygmleedy", "jygqweei", "jygssaibvbbzj", "jyiyxzxmwvefc",	/* 7632 */
+	"jyjjo", "jyjoouuhvppyc", "jykfgqxwi", "jykkvlqlzdg",	/* 7636 */
+	"jykwxw", "jymhdwg", "jyni", "jynrz",	/* 7640 */
+	"jyoohgsz", "jyoyptinnh", "jypejbush", "jyqhkv",	/* 7644 */
+	"jyshgpco", "jyumm", "jywduf", "jywnj",	/* 7648 */
+	"jywpgvh", "jywvjc", "jyycnsjdlk", "jyzgfrehgc",	/* 7652 */
+	"jyzk", "jz", "jzadlhqagk", "jzcckdlx",	/* 7656 */
+	"jzdfngc", "jzfblkmlg", "jzgnrszghicnm", "jzgufd",	/* 7660 */
+	"jzhdwoy", "jzhiqfmjrtdpyf", "jzifgam", "jzikpqejuzbaq",	/* 7664 */
+	"jziofxwcuemg", "jzkggl", "jzlq", "jzofrheupnbspf",	/* 7668 */
+	"jzonsfxh", "jzpigefnxcdwlt", "jzpnrjordc", "jzqz",	/* 7672 */
+	"jzsf", "jzt", "jzuyguyunjcjvd", "jzvxslpkldfipd",	/* 7676 */
+	"jzvxyjoozlvvb", "jzvzrqr", "jzwlyo", "jzwwcd",	/* 7680 */
+	"jzxtionth", "jzybgn", "jzz", "ka",	/* 7684 */
+	"kacgmhs", "kacvhve", "kaddtfdma", "kaeuktj",	/* 7688 */
+	"kaf", "kaffoan", "kahgim", "kaifmtqjehher",	/* 7692 */
+	"kajcwe", "kakvhefyribj", "kalqcwe", "kaocqzy",	/* 7696 */
+	"kaoesuqefw", "kaokhhlxwbao", "kaopmuhztd", "kaoujfdhnm",	/* 7700 */
+	"kapfgvvuvfneo", "kapszhyr", "kar", "katyricwg",	/* 7704 */
+	"kauxexefemetqu", "kavebezvur", "kaw", "kawlxedbgr",	/* 7708 */
+	"kaxhwelkbdape", "kaybqdscf", "kb", "kbbgfpsihfcoki",	/* 7712 */
+	"kbceeh", "kbctmwkh", "kbd", "kbfbdqgfsha",	/* 7716 */
+	"kbfgxvnrdwwvqf", "kbhhrendrcynnq", "kbibayjn", "kblehuoxcfxm",	/* 7720 */
+	"kblpabuifkj", "kbmvkbxe", "kbnlofagnlr", "kbotqlwjs",	/* 7724 */
+	"kbphz", "kbrgngxeipl", "kbs", "kbsjqybmxel",	/* 7728 */
+	"kbsoiqxqxjqg", "kbsygzyvdvueh", "kbwcsnvio", "kbwuarut",	/* 7732 */
+	"kbxop", "kbyn", "kc", "kccihx",	/* 7736 */
+	"kccprfovn", "kcedpvxswpb", "kcegsrywyvzgv", "kcepaxc",	/* 7740 */
+	"kcftdszng", "kcgm", "kcgulg", "kcjvefa",	/* 7744 */
+	"kckmcgk", "kcns", "kcovyx", "kcowbxgzb",	/* 7748 */
+	"kcplkdyfh", "kcqr", "kcrpylzfxq", "kcsunijysc",	/* 7752 */
+	"kcszsyepycyyv", "kcszynprpgo", "kctqmhkkavvp", "kcu",	/* 7756 */
+	"kcuwvvwkpasruk", "kcvabb", "kcwzmnu", "kcz",	/* 7760 */
+	"kczdvtklcrptgn", "kd", "kdaxu", "kdbhjvhrqgavwj",	/* 7764 */
+	"kdchttlhgjwt", "kdcn", "kddhau", "kddrokoggd",	/* 7768 */
+	"kdeqhpqtfuesky", "kdingznfoqashk", "kdjsgvtfk", "kdnmd",	/* 7772 */
+	"kdowsqwu", "kdssv", "kdtcft", "kdtrzkmn",	/* 7776 */
+	"kdunfkzekh", "kduusquychft", "kduyeefnc", "kdv",	/* 7780 */
+	"kdzlyoygxsa", "ke", "keadnfanoqf", "keafjkp",	/* 7784 */
+	"keahqjrxfcdryx", "kealhtlqnwhqc", "kebdod", "kecwzibyu",	/* 7788 */
+	"keddxp", "kefbslwgz", "kehcikxkgyn", "keiiilm",	/* 7792 */
+	"kekuqlol", "keldtdhqqnda", "kenju", "kennqb",	/* 7796 */
+	"keplinda", "keppmisr", "kepwaenumq", "keqorqlt",	/* 7800 */
+	"keqykf", "ker", "kexa", "kexdbco",	/* 7804 */
+	"kexvaoutgbtzb", "keyaautomk", "kezdl", "kezrly",	/* 7808 */
+	"kf", "kfcdo", "kfcnapuaom", "kfdnpidmyhnhv",	/* 7812 */
+	"kffnopaxixzg", "kfg", "kfgoibzxptien", "kfhgcyqhwgde",	/* 7816 */
+	"kfhvvx", "kfiflv", "kfklkfi", "kfldbosuwn",	/* 7820 */
+	"kflmfdlxg", "kflwrprzabx", "kfmjw", "kfmoakhiuxvvm",	/* 7824 */
+	"kfncgyymjsx", "kfnscopfdi", "kfnvwz", "kfnxhyv",	/* 7828 */
+	"kfovacyagmh", "kfqcfbcutpfjil", "kfqkxhrbcub", "kfqpmp",	/* 7832 */
+	"kfscekvyov", "kfvgncmwl", "kfvorxfsizoztp", "kfwayjhpewego",	/* 7836 */
+	"kfwgagdwuzagxf", "kfwnyxz", "kfximt", "kfxxjmdzjnnsu",	/* 7840 */
+	"kfzaek", "kfzmcbjepu", "kg", "kgajcgrtbftk",	/* 7844 */
+	"kgawwbhjhp", "kgbjdcacpzkjxp", "kgbr", "kgd",	/* 7848 */
+	"kgdumkbt", "kggdngiu", "kggf", "kgidyljzvjgw",	/* 7852 */
+	"kgionywdqkvbb", "kgjfhjksvq", "kgjkihj", "kgjzjauvwqci",	/* 7856 */
+	"kglvynvuvdop", "kgomrfhglwfvvr", "kgptkissnz", "kgqfbspatfpeb",	/* 7860 */
+	"kgqffifxezcy", "kgquayex", "kgrxkeremwjb", "kgsqmgys",	/* 7864 */
+	"kgtt", "kgumtg", "kgvcjvgzvjqoiq", "kgwbmkr",	/* 7868 */
+	"kgxdt", "kgxgpkaz", "kgxyd", "kgzujfihlckidx",	/* 7872 */
+	"kh", "khb", "khci", "khctdczazz",	/* 7876 */
+	"khesvhjjhz", "khetyyqvqrmn", "khfbzbemltsyus", "khfmkkajrvtn",	/* 7880 */
+	"khfxoylq", "khhdrwzrpj", "khiyrq", "khjvyqlda",	/* 7884 */
+	"khkpvvc", "khlgekl", "khpkizmqrf", "khpw",	/* 7888 */
+	"khqgooekbn", "khsdqbidnpe", "khskxhrdlmxd", "khuwqwzvj",	/* 7892 */
+	"khygmmiekh", "khyskgntrlkx", "khz", "khzozolr",	/* 7896 */
+	"ki", "kiawmmthuunve", "kibgw", "kid",	/* 7900 */
+	"kidr", "kidrm", "kifgugcqox", "kiggfrlxsk",	/* 7904 */
+	"kihufdihvdg", "kiijp", "kiiqvunqswztl", "kij",	/* 7908 */
+	"kikgwtrlhrh", "kiklmuf", "kilyhlwi", "kimvafngtet",	/* 7912 */
+	"kioghrbnpi", "kip", "kippb", "kiqfbskp",	/* 7916 */
+	"kiqitet", "kisdoppsbdk", "kissvz", "kit",	/* 7920 */
+	"kiusgypreo", "kiylg", "kiynm", "kiyqsnqkhh",	/* 7924 */
+	"kizhad", "kizsjwollfea", "kizx", "kjcpukygtbco",	/* 7928 */
+	"kjdw", "kjecdiixzzclh", "kjhta", "kjhxgvrl",	/* 7932 */
+	"kjibisxqj", "kjknvaxvjo", "kjmbwylso", "kjmclgpcc",	/* 7936 */
+	"kjmwes", "kjodfbhojxlnbg", "kjphldtpjfpzu", "kjrrabaxuywhzn",	/* 7940 */
+	"kjsjpxlwanb", "kjthzjtmkchkr", "kjujle", "kjxabetn",	/* 7944 */
+	"kjxhx", "kjxsjnj", "kjzwe", "kk",	/* 7948 */
+	"kkdnp", "kkftjynbjjvvmu", "kkgbbawftokwb", "kkgkaxutay",	/* 7952 */
+	"kkgyd", "kkh", "kkia", "kkkytpvresna",	/* 7956 */
+	"kkmmqbnq", "kkmp", "kkmpftmyxiq", "kknuvvfm",	/* 7960 */
+	"kkop", "kkphosuvi", "kkpvrukxsk", "kkpxcdz",	/* 7964 */
+	"kkpydymo", "kkqkzpovrrxaoj", "kkrpihcgziefzv", "kkryz",	/* 7968 */
+	"kku", "kkxvfnfjrnwnl", "kl", "klaoeustbcjbuu",	/* 7972 */
+	"klbdumwzn", "klbo", "klbxygxilhx", "klc",	/* 7976 */
+	"klcbifarep", "klegikkrou", "klge", "klgyhqtjsrdf",	/* 7980 */
+	"klizanmxb", "kljdmwduuo", "klmbbgfrere", "klmunssjazrewn",	/* 7984 */
+	"klnilu", "klompytcgkv", "klqfzqnykbw", "klrxdzttqerbo",	/* 7988 */
+	"kltoipcbfv", "kltuwr", "kltwmvauisdga", "klv",	/* 7992 */
+	"klvzgkua", "klwf", "klxkuhwfvbha", "klxmpzbb",	/* 7996 */
+	"klxokn", "klyckdyrh", "klzpayykitoh", "km",	/* 8000 */
+	"kmaxtpkwth", "kmcc", "kmcpeulqhw", "kmdgyri",	/* 8004 */
+	"kmdhdkrwzp", "kmdhxmnomtjweg", "kmdtoglkbldjx", "kmgsecgukmoce",	/* 8008 */
+	"kmgviobvadtlia", "kmhpcgp", "kmijs", "kmjvjqfhgws",	/* 8012 */
+	"kmlglnea", "kmlmtqit", "kmlzduwcvrma", "kmmanjlwnasy",	/* 8016 */
+	"kmmefo", "kmoly", "kmomlwddc", "kmopplxuf",	/* 8020 */
+	"kmpeq", "kmpleknrwrgd", "kmpx", "kmpxcivve",	/* 8024 */
+	"kmqgetsv", "kmrvrlohmfh", "kmsfprokto", "kmtpp",	/* 8028 */
+	"kmucgtf", "kmuczne", "kmufvtrmszmatc", "kmuli",	/* 8032 */
+	"kmvlaccbb", "kmw", "kmwd", "kmxpmkasrly",	/* 8036 */
+	"kmyecwjwjf", "kmygka", "kmylf", "kmyz",	/* 8040 */
+	"kmzb", "kn", "knaidhbjos", "knbqemvjoe",	/* 8044 */
+	"kncnvlwfkenmha", "knenyuqf", "knes", "knffjapn",	/* 8048 */
+	"kngi", "kngrd", "kngweupgnhgf", "knh",	/* 8052 */
+	"knifhomtaynymh", "kninlvhcozhui", "knjklikxxq", "knkalzdckue",	/* 8056 */
+	"knkiap", "knlkcdsxhjpin", "knmjr", "knnfwoincjzcyb",	/* 8060 */
+	"knrukxtdgx", "knryqvixjq", "knsddwsyl", "kntmjrawmgd",	/* 8064 */
+	"knukecaiwtfwvh", "knutg", "knuvmln", "knvgmg",	/* 8068 */
+	"knvsshkq", "knwoyomefdx", "knxciyxvrrd", "knyhzigc",	/* 8072 */
+	"knzgidix", "ko", "koa", "koafatxmk",	/* 8076 */
+	"koailmr", "koamhejrtenzml", "koaztrizom", "kobhqdcrpph",	/* 8080 */
+	"kocpgycis", "kocwsd", "kodkbzw", "kodrrlzaccoqx",	/* 8084 */
+	"koegwvegmrvjs", "kofrbxmwgdreiz", "kofrwgak", "kofxwiopdpxozh",	/* 8088 */
+	"kohqz", "kohrx", "kohzijhqkqo", "kokevcrhj",	/* 8092 */
+	"kolzkwxftqduiv", "kom", "komh", "kommwxabqi",	/* 8096 */
+	"kondxbhteogmh", "konliti", "kopfllqpih", "kora",	/* 8100 */
+	"korywgbxtpy", "kosizbk", "kotlvlljywtjw", "kotrjfgq",	/* 8104 */
+	"kottsbrjtbj", "kou", "koupsmqxudzqa", "kovlulxru",	/* 8108 */
+	"kowkqhczrxpztv", "koxn", "koxxyog", "koy",	/* 8112 */
+	"koydpfscl", "koylayfbqvdnen", "kozkklxr", "kozpwrqzdcrzoz",	/* 8116 */
+	"kozsyzrzvi", "kpa", "kpaot", "kpaozdya",	/* 8120 */
+	"kpaxcajpkj", "kpelru", "kpjia", "kpmoeehazprib",	/* 8124 */
+	"kpnlefphy", "kpod", "kppo", "kppqrs",	/* 8128 */
+	"kpqq", "kpqvpo", "kprq", "kprs",	/* 8132 */
+	"kprtusoibv", "kpsstp", "kptarh", "kptdhfrw",	/* 8136 */
+	"kptefmekzfvms", "kpukfsjb", "kpulldfngc", "kpvvjzx",	/* 8140 */
+	"kpwhgfdbf", "kpxg", "kpzvvwcwg", "kq",	/* 8144 */
+	"kqceidqlhvkmdd", "kqcj", "kqctqw", "kqdfhn",	/* 8148 */
+	"kqdpfzjqmo", "kqenpekktng", "kqfwqbp", "kqgpoenldtif",	/* 8152 */
+	"kqia", "kqjcm", "kqjnmnnesj", "kqkpyciporn",	/* 8156 */
+	"kqmshsjgzhi", "kqowzhfdbe", "kqpwmiiadiz", "kqqmuhhub",	/* 8160 */
+	"kqrjlsenxdl", "kqsxdgwbg", "kqtassn", "kquxsjdbovynvk",	/* 8164 */
+	"kqvhewekju", "kqwima", "kqwixirpwd", "kqxctbznotmz",	/* 8168 */
+	"kqxehjr", "krbllqokqg", "krcdam", "krcmij",	/* 8172 */
+	"krfunyjedwtzu", "krfvkddefmdian", "krglbr", "krhssmuwbdkav",	/* 8176 */
+	"kricgisd", "kridagvuvonzcu", "krjbplhkz", "krjoltptnr",	/* 8180 */
+	"krkpylwuuomqwf", "krlcuwvqknr", "krlwmtf", "krlzz",	/* 8184 */
+	"krm", "krmdtwh", "krnafma", "krobgqtiljpx",	/* 8188 */
+	"kroniasbdu", "krpwckqm", "krsgy", "krsqb",	/* 8192 */
+	"krthxcd", "krtlpm", "krumekvu", "krutomzozjalex",	/* 8196 */
+	"krxrpyw", "krzmbwymmgh", "ks", "ksaajmdduw",	/* 8200 */
+	"ksagmashbdxks", "ksakluwtwtpkx", "ksakzw", "kscbht",	/* 8204 */
+	"ksftwfzu", "ksfwuapulmki", "ksgfaziumlxiua", "kshazhcqfujjp",	/* 8208 */
+	"ksjc", "kskcdnaplot", "kskczst", "kskyg",	/* 8212 */
+	"ksllnewdd", "kslxb", "ksm", "ksnd",	/* 8216 */
+	"ksoivblgocji", "ksoovodauynr", "kspiyuy", "ksqloxgnbxa",	/* 8220 */
+	"ksqrnfzaxmmmin", "kstobfqmjvr", "ksuecr", "ksuocibeuhqw",	/* 8224 */
+	"ksvkru", "kswghmwapwvje", "kswlriocqd", "ksxbqoewqlsbld",	/* 8228 */
+	"ksxbzxtskre", "kt", "ktboipvdlj", "ktcbyqtuvjg",	/* 8232 */
+	"ktcsm", "ktcyxf", "ktdoc", "ktdvxibi",	/* 8236 */
+	"ktfcgx", "ktiv", "ktjvg", "ktjzkgurmio",	/* 8240 */
+	"ktkm", "ktngiwsuocf", "ktoyxmrn", "ktpkseexvzcjal",	/* 8244 */
+	"ktqdar", "ktqilkkdjhtywp", "ktqlkthm", "ktqnjbpj",	/* 8248 */
+	"ktqnlkty", "ktqshupgglj", "ktrgqld", "ktst",	/* 8252 */
+	"kttjcu", "ktvonhxlopp", "ktvy", "ktwmhusa",	/* 8256 */
+	"ktxgmutlsms", "ktybknalllttvn", "ktyf", "ktz",	/* 8260 */
+	"ktzeomjayy", "ku", "kua", "kubhulslsdvik",	/* 8264 */
+	"kubj", "kubtmwewmsjnb", "kud", "kufaajwrxt",	/* 8268 */
+	"kugcw", "kuggacei", "kugs", "kuhfzegq",	/* 8272 */
+	"kuiec", "kujfbdxd", "kuoapwpea", "kuoenmrm",	/* 8276 */
+	"kuosfuetcefms", "kup", "kuqj", "kurbtfhevoa",	/* 8280 */
+	"kurmnl", "kuryubuoq", "kusghzx", "kut",	/* 8284 */
+	"kutt", "kutzxjkfti", "kuugzf", "kuuhnazqgd",	/* 8288 */
+	"kuvtnnebrb", "kuw", "kuwf", "kuwfhf",	/* 8292 */
+	"kuwqqsjadcyrid", "kuyaivjsapnk", "kuyr", "kuzyqrlcknpi",	/* 8296 */
+	"kv", "kvarvposeztlz", "kvb", "kvbleeqnyuu",	/* 8300 */
+	"kvcxcn", "kvdc", "kveasbb", "kvefmlywxt",	/* 8304 */
+	"kvekg", "kveql", "kvequarvkyqiz", "kvfltsab",	/* 8308 */
+	"kvgi", "kvhhsiwiunatfq", "kvhsbtau", "kvi",	/* 8312 */
+	"kvia", "kviolaetvndy", "kviqkeixf", "kvja",	/* 8316 */
+	"kvka", "kvnolbza", "kvo", "kvphigtkqm",	/* 8320 */
+	"kvpihhi", "kvqmgrkana", "kvqncsum", "kvqpwfwv",	/* 8324 */
+	"kvqrhhzefwfpfr", "kvqulkpjt", "kvqwnfxcqmre", "kvr",	/* 8328 */
+	"kvrblbwe", "kvsjjdaq", "kvsybqbrgiwoyv", "kvtmvta",	/* 8332 */
+	"kvvqmmmh", "kvxecuyjtzj", "kvxidvlbj", "kvyffvo",	/* 8336 */
+	"kvznkszwimy", "kw", "kwacqjfvpcn", "kwalkpmafmz",	/* 8340 */
+	"kwarmuiyyex", "kwbngkdqczou", "kwbosck", "kwbrktzcwqxmu",	/* 8344 */
+	"kwcmbratq", "kwerfkaol", "kwgdpghoem", "kwglvbovkcvb",	/* 8348 */
+	"kwhcu", "kwhtkuicyyzx", "kwjpezqzk", "kwjtiizztteh",	/* 8352 */
+	"kwjxinmxk", "kwkzeiwg", "kwoyufi", "kwqasfwhozmwrv",	/* 8356 */
+	"kws", "kwvdb", "kwvlpubt", "kwwp",	/* 8360 */
+	"kwy", "kwympfckqoht", "kwyxuqdjsz", "kwzdechujk",	/* 8364 */
+	"kwzrluywc", "kx", "kxayzsze", "kxcpnmcltzafdy",	/* 8368 */
+	"kxczvo", "kxggsiy", "kxgoczgxbuho", "kxgxskwzy",	/* 8372 */
+	"kxibxafao", "kxibzxvymcw", "kxivdazbzz", "kxjfuxwc",	/* 8376 */
+	"kxjhdr", "kxjnx", "kxjre", "kxkfxhpam",	/* 8380 */
+	"kxlnkufwg", "kxnucku", "kxnxlklt", "kxptlywu",	/* 8384 */
+	"kxribllfj", "kxu", "kxuuu", "kxuwota",	/* 8388 */
+	"kxwebfe", "kxwmqy", "kxwsvmaauxhp", "kxxnrjeuegd",	/* 8392 */
+	"kxzuffyg", "ky", "kyb", "kybunvrlvj",	/* 8396 */
+	"kyc", "kycg", "kycvr", "kydofovyargq",	/* 8400 */
+	"kydpy", "kydxu", "kyf", "kyfaqxsqncuy",	/* 8404 */
+	"kyg", "kyhuwgyag", "kyihkkkw", "kykffl",	/* 8408 */
+	"kykngsm", "kylkuupgtwhi", "kymupzxvxmywod", "kymvyexfkm",	/* 8412 */
+	"kypvhndtobln", "kyqcxraeqw", "kysjbho", "kytbuwgbp",	/* 8416 */
+	"kytiwed", "kytzaykj", "kyuo", "kywdsapgm",	/* 8420 */
+	"kywhjp", "kywy", "kyxjstyaxb", "kyyalllx",	/* 8424 */
+	"kz", "kzfmuvn", "kzfsppashtb", "kzg",	/* 8428 */
+	"kzgmaqgoeavhp", "kzht", "kzibwhmss", "kzjmoplbmwparp",	/* 8432 */
+	"kzkmfmiiilj", "kzmwh", "kznwcbbxrsxpd", "kzqnchykhsjw",	/* 8436 */
+	"kzqtszxlwrlkpk", "kzrkubnh", "kzrro", "kztjxugkww",	/* 8440 */
+	"kzujgcplqxvyer", "kzv", "kzwashgzpfw", "kzwwcwxainwe",	/* 8444 */
+	"kzymfh", "kzz", "kzzc", "kzzmnilcwbzuhz",	/* 8448 */
+	"laa", "lad", "ladtmkalzkzmaq", "laewac",	/* 8452 */
+	"laf", "lafftlz", "lafmwwa", "lah",	/* 8456 */
+	"laincnniymxq", "lajsbnlpulvta", "lalbspgzegonp", "lamwq",	/* 8460 */
+	"lanzxooqeprx", "laozl", "lapwdimseibdjk", "latpmogftta",	/* 8464 */
+	"latsfzcputfvse", "latyetevpeq", "lauaymihlflijn", "lav",	/* 8468 */
+	"lavsv", "laxp", "laz", "lb",	/* 8472 */
+	"lbckqmrule", "lbe", "lbegz", "lbeyfmquwgznsm",	/* 8476 */
+	"lbfguk", "lbgnfyawazhaf", "lbifzk", "lbj",	/* 8480 */
+	"lbklnv", "lbkzlsiymrwc", "lbob", "lbqosxvo",	/* 8484 */
+	"lbsbjgb", "lbsdzv", "lbustdjan", "lbuwmxwq",	/* 8488 */
+	"lbwbkswpgmt", "lbwfjgzcdaoi", "lbxz", "lbycwcdkd",	/* 8492 */
+	"lbypoolbze", "lbzzhvhg", "lc", "lcagkd",	/* 8496 */
+	"lcbrffaizejf", "lcc", "lcdi", "lceolg",	/* 8500 */
+	"lcfvfggzutbqt", "lcgmtoxgqxc", "lchthkgyr", "lchv",	/* 8504 */
+	"lciku", "lcjkidygyr", "lcjnmisggg", "lckts",	/* 8508 */
+	"lcmmuzfzd", "lcnhyyefid", "lcnulnufqlh", "lcoqznmyicoo",	/* 8512 */
+	"lcpepmwgfjs", "lcszliq", "lcth", "lctzgydfnuwi",	/* 8516 */
+	"lcupldk", "lcw", "lcwylflwzvwjjx", "lcxzhgd",	/* 8520 */
+	"lcz", "ld", "ldatxfpevlorrw", "ldc",	/* 8524 */
+	"ldchvexsegc", "ldctepdcqxnuqk", "lddeaabvyxdbf", "ldjifpxkb",	/* 8528 */
+	"ldkpiifx", "ldlgwbmqfsxjdb", "ldlwusoe", "ldndoirq",	/* 8532 */
+	"ldoglxgauaw", "ldqbdnnxagmcr", "ldrdxxcmoqx", "ldsceccdmqien",	/* 8536 */
+	"ldsyt", "ldt", "ldtfrhxamtk", "ldwgxadhxwt",	/* 8540 */
+	"ldwhidpnmtlrl", "ldzkxmuxfnr", "le", "leabrxeewx",	/* 8544 */
+	"leaqncrwveoy", "lec", "leeanebgmwiatt", "leecbqwevbyv",	/* 8548 */
+	"leezmsxdfgq", "lefla", "legk", "lehhpikbio",	/* 8552 */
+	"leijtlarb", "lejz", "lelxkscpaezce", "lembcicypgo",	/* 8556 */
+	"lengl", "leqncyyzbouzr", "leqyscdhjya", "lescbjzu",	/* 8560 */
+	"lesjdcmsjc", "leus", "leutjyxoktqwyc", "levaqbu",	/* 8564 */
+	"leweuvyionjxem", "leyfcfnngk", "lf", "lfar",	/* 8568 */
+	"lfbv", "lfbzlcthv", "lfclboamhe", "lfeeswh",	/* 8572 */
+	"lfeyukfaj", "lffngtwuhplmp", "lfhbitxjftngl", "lfhkzbtt",	/* 8576 */
+	"lfjqq", "lflapsdlvwkj", "lfljhihudfm", "lflzoeg",	/* 8580 */
+	"lfmnfxb", "lfmwigvkqlg", "lfmxbezjqwtnuf", "lfnlxogzuyx",	/* 8584 */
+	"lfoqzfblzlfv", "lfpcexgvbbv", "lfpiuqeifw", "lfrysxjprfn",	/* 8588 */
+	"lfsnxoq", "lfwcxp", "lfzrjgfqncmiog", "lfzrl",	/* 8592 */
+	"lg", "lgafi", "lgdeykqmqdpaco", "lgdivnhibvdva",	/* 8596 */
+	"lge", "lgecngxeu", "lgg", "lggddwnlouw",	/* 8600 */
+	"lgk", "lgkmbk", "lgnccditi", "lgnoustuiobokb",	/* 8604 */
+	"lgnzcighye", "lgodqclhvsptb", "lgpsc", "lgptcpu",	/* 8608 */
+	"lgrgqzyf", "lgs", "lgsimbunmw", "lgw",	/* 8612 */
+	"lgy", "lgyglqpva", "lgyicppvdkwmtj", "lgyw",	/* 8616 */
+	"lh", "lhbdgyv", "lhbsjfjbzlim", "lhbtmt",	/* 8620 */
+	"lhbwcopzebhj", "lhcbpdmxrxgn", "lhcqg", "lhcyr",	/* 8624 */
+	"lhczk", "lhd", "lhdwborrz", "lhe",	/* 8628 */
+	"lheqdjaitzrs", "lhevfudgwg", "lhgwyqegsvx", "lhgzreamn",	/* 8632 */
+	"lhkw", "lhlhcnalpedri", "lhlovothz", "lhlzrceklq",	/* 8636 */
+	"lhnef", "lhomrmqhef", "lhoseowfepc", "lhqldqzhp",	/* 8640 */
+	"lhtcdhljgkuj", "lhumcu", "lhwaktmj", "lhwgpqjdfpy",	/* 8644 */
+	"lhwht", "lhxbymxhuysshq", "li", "libheoypzf",	/* 8648 */
+	"licj", "liclqaigggvclh", "licqiqkn", "lid",	/* 8652 */
+	"lidjwnoawhxtl", "lidxxxcwlm", "ligbfrytsqbafl", "ligfvzuddfgeh",	/* 8656 */
+	"lihgdipkcy", "lihko", "lihqesyznkpyxd", "lijfraaiurwsa",	/* 8660 */
+	"likjefcovfthms", "liks", "limp", "limw",	/* 8664 */
+	"liogoys", "lipdcicoisg", "lipmv", "lir",	/* 8668 */
+	"lirxehxfk", "lirygzisuf", "listbjuuslvm", "liunfytc",	/* 8672 */
+	"livwe", "liwyjpfvjqafh", "liysjzile", "lizrwmkbdf",	/* 8676 */
+	"lj", "ljau", "ljbggfycpng", "ljbgoawtycp",	/* 8680 */
+	"ljcb", "ljci", "ljdyjpwgucej", "ljelibio",	/* 8684 */
+	"ljf", "ljfnnvfrwxsl", "ljfoqsrbjt", "ljfu",	/* 8688 */
+	"ljgaiur", "ljhbofzejbw", "ljiog", "ljivjcjb",	/* 8692 */
+	"ljjymfidssulo", "ljkfwehmtyod", "ljmdsehxxami", "ljmvwso",	/* 8696 */
+	"ljmxtuohydubho", "ljov", "ljrvrwfgl", "ljtejvwandxsx",	/* 8700 */
+	"ljulznko", "ljvxffmxcqilv", "ljwlkjcdjxu", "ljwlxzkladm",	/* 8704 */
+	"ljwvshi", "lk", "lkalr", "lkanzstuuxchgs",	/* 8708 */
+	"lkcaklwhho", "lkftmgiw", "lkgmbxu", "lkgxgyfu",	/* 8712 */
+	"lkhvwrbvo", "lkjiuzowi", "lkknmfghcvf", "lkkpawflojvbr",	/* 8716 */
+	"lkkx", "lklz", "lkmjfpfwyxnbvt", "lkoycoza",	/* 8720 */
+	"lkqjtsxcsmmk", "lkrq", "lkrrincmgxox", "lksetjhdsz",	/* 8724 */
+	"lktupqrawzcbh", "lkurbkued", "lkvfncqdg", "lkvrmp",	/* 8728 */
+	"lkxdb", "lkysmux", "lkytvvtkq", "ll",	/* 8732 */
+	"llalcdpoqrtdbf", "llbvkkwoccozzv", "lle", "lleogrprjtg",	/* 8736 */
+	"llezgsxajgkmng", "llglrwg", "llgs", "llgxcvktprhhp",	/* 8740 */
+	"llhskwcucxcbub", "llnnba", "llr", "llrat",	/* 8744 */
+	"llrqrj", "lls", "llsnloqlblj", "llthijkehqrpv",	/* 8748 */
+	"lluadozymjw", "llucficrnuicvy", "llvpsenf", "llwabaqyawchk",	/* 8752 */
+	"llx", "llxazjbmd", "llyubr", "llzzvzdih",	/* 8756 */
+	"lm", "lmalwdoenhjm", "lmctgtxtyxx", "lmcwfeq",	/* 8760 */
+	"lmephgnnuhdtvu", "lmeyutbp", "lmfwctwuauz", "lmghmeduwgvqm",	/* 8764 */
+	"lmhscaras", "lmhvplowxw", "lmjsra", "lmlnh",	/* 8768 */
+	"lmo", "lmql", "lmstogr", "lmtaslv",	/* 8772 */
+	"lmtgczdo", "lmtomti", "lmuemcpiso", "lmumvjeof",	/* 8776 */
+	"lmupnsdrtufwil", "lmutqbzrbxok", "lmvjtiagmlq", "lmvvhtu",	/* 8780 */
+	"lmwe", "lmwrybhmjnobz", "lmx", "ln",	/* 8784 */
+	"lnarxkgeoox", "lnavbixdkqek", "lnaykmlhoxhzct", "lnbfpvimsgmihc",	/* 8788 */
+	"lnbx", "lncdzf", "lncngdhlw", "lncnzkwgz",	/* 8792 */
+	"lndfgedyfzqezt", "lnejrgbno", "lnfja", "lnhqaiybwbgz",	/* 8796 */
+	"lnis", "lnjn", "lnnodqiznathf", "lnnvmsrtzknrfr",	/* 8800 */
+	"lnog", "lnomncpfqvgfd", "lnpuob", "lnqkdvlooba",	/* 8804 */
+	"lnshoimlmzsh", "lnsybtndp", "lnujbshxyk", "lnvqopmra",	/* 8808 */
+	"lnvuyspkdlzv", "lnxcbhtzpkns", "lnygsptvcnlk", "lnyqnyacdomy",	/* 8812 */
+	"lo", "loa", "loaqy", "lobw",	/* 8816 */
+	"loewdnhev", "logfhgcp", "loglw", "loifxpyukkiw",	/* 8820 */
+	"loizzuaadffli", "loj", "lojcicowyrfwn", "lolvj",	/* 8824 */
+	"lolyk", "lomdujc", "lomhnklown", "lomhxdxh",	/* 8828 */
+	"lomiiqayikle", "loprq", "loqdalbpdtkxf", "loqrxbfjuxwr",	/* 8832 */
+	"lorhucdscu", "loricf", "losuasaptvodxe", "lotfcx",	/* 8836 */
+	"louekjkcjvf", "loueubzksku", "lov", "loxlunwcvubk",	/* 8840 */
+	"loykblacwa", "lp", "lpaw", "lpcwsggg",	/* 8844 */
+	"lpdfh", "lpdfmj", "lpefbtao", "lpefigmqzve",	/* 8848 */
+	"lpeoeuwpe", "lpeotc", "lpgdajekwlnk", "lpgxawffako",	/* 8852 */
+	"lphcugnm", "lpi", "lpihzqyk", "lplm",	/* 8856 */
+	"lpo", "lpokljzrdkmxf", "lppvvxetzjudr", "lpqeyfwenybcl",	/* 8860 */
+	"lprefnxjgngwns", "lprri", "lpryniyctl", "lpsiyyhdtd",	/* 8864 */
+	"lpsrmeqxkujhu", "lpsvykdy", "lpthz", "lpuwdfqzk",	/* 8868 */
+	"lpw", "lpxyapiwbljy", "lpyoq", "lpyrq",	/* 8872 */
+	"lpz", "lpzuocgpdlc", "lq", "lqccbqwywwz",	/* 8876 */
+	"lqeybrhrvgiw", "lqgdnfymgonjf", "lqgkdmatl", "lqhr",	/* 8880 */
+	"lqihmvfdkntpv", "lqikozjyjlzyp", "lqiukgqcdhkpsx", "lqll",	/* 8884 */
+	"lqlmtidiqdpc", "lqqcfgax", "lqrtskwbzxmo", "lqruvedyygoivu",	/* 8888 */
+	"lqrzyywtnjdrh", "lqtlnsjln", "lqttqjg", "lqturiid",	/* 8892 */
+	"lqtvfsqvzhao", "lqxhbbtposs", "lqxqksoji", "lqxs",	/* 8896 */
+	"lqyicpcyghqzt", "lqynlnfkzyn", "lqyvscx", "lqzmgzeskdhfkw",	/* 8900 */
+	"lr", "lrbdoibs", "lrbfxfol", "lrdewjhtur",	/* 8904 */
+	"lrdfbdgysb", "lrdnxarsqv", "lrdsbassleylnq", "lrfjghfdu",	/* 8908 */
+	"lrgzgvhxolzj", "lrhhixxetcoal", "lrjn", "lrlqjveeooy",	/* 8912 */
+	"lrltt", "lrp", "lrprf", "lrq",	/* 8916 */
+	"lrqoykytofshrb", "lrtdar", "lrtgxc", "lrtuywsqhabpd",	/* 8920 */
+	"lrvmfxt", "lrvmiisex", "lrwrhwbfz", "lrxjidacswxovv",	/* 8924 */
+	"lryceretpoxy", "lryebm", "lrzugksdsf", "lrzv",	/* 8928 */
+	"ls", "lsalwshiqdaeq", "lsd", "lse",	/* 8932 */
+	"lsfgrrownar", "lsgnuynuqdxh", "lsikgwgsjjzf", "lsjfgn",	/* 8936 */
+	"lsk", "lskoyptmudlm", "lsl", "lsladm",	/* 8940 */
+	"lsmcxe", "lsmgnaigqlgs", "lsnwmdm", "lsqa",	/* 8944 */
+	"lsqchlkqibtie", "lsqjnimyifbh", "lsrqrzxbikjpq", "lssfacgfu",	/* 8948 */
+	"lstemx", "lsxgasxtjlsfls", "lsxzpflsjst", "lsyboysbdxlfp",	/* 8952 */
+	"lsyrcbckho", "lsyyce", "lszuenoycyxle", "lt",	/* 8956 */
+	"ltafi", "ltcgk", "ltcwh", "ltfqdvhujp",	/* 8960 */
+	"ltgfmy", "ltgfzh", "lthxufzrrigy", "ltiddfprzp",	/* 8964 */
+	"ltjekawzzg", "ltkoqmoktctcv", "ltkxolpuqoyck", "ltlhazrtfotejm",	/* 8968 */
+	"ltndijpt", "ltnpgyrzjvs", "ltoawxu", "ltphkftyf",	/* 8972 */
+	"ltqslb", "ltqttkecwccb", "ltqxrgy", "ltrmkcucqhwe",	/* 8976 */
+	"lts", "ltsgfqnpzwqxq", "ltvxkduazc", "ltvzpaxodwu",	/* 8980 */
+	"ltxbaajcsqm", "ltxhmr", "ltxqfpbvxo", "ltybxnf",	/* 8984 */
+	"ltycbjwyyog", "ltyhommtf", "ltymnme", "ltyqmtex",	/* 8988 */
+	"ltzbgj", "lu", "luav", "lubxl",	/* 8992 */
+	"lucegwt", "ludgtcwbctj", "lueggiqugxgos", "luezomtk",	/* 8996 */
+	"lugxxdtpfronnh", "luhidne", "luhlof", "luiiiip",	/* 9000 */
+	"luiik", "luixlshljpclzd", "lul", "lulwediqzgmer",	/* 9004 */
+	"lun", "lunkgdljearkfj", "lunlswijrovca", "lunurhq",	/* 9008 */
+	"luoifvlg", "lurkkj", "lut", "luugtwxvspqx",	/* 9012 */
+	"luuq", "luvqeeujtpr", "luwijannfplgk", "luzfdcg",	/* 9016 */
+	"lv", "lva", "lvbwuvyt", "lvcbxfr",	/* 9020 */
+	"lvcdtxb", "lvdbjrviihk", "lveamqbgjc", "lveiwwlaq",	/* 9024 */
+	"lvgtxgthz", "lvhfyd", "lvhha", "lvjewjcnh",	/* 9028 */
+	"lvjnwfd", "lvkbpaetylnpc", "lvksmultjg", "lvl",	/* 9032 */
+	"lvlkar", "lvlmsd", "lvm", "lvmcitof",	/* 9036 */
+	"lvmybvm", "lvnhry", "lvnldkhjjily", "lvokides",	/* 9040 */
+	"lvpqnhmy", "lvrjg", "lvtbrrdimbzm", "lvunipbwysscc",	/* 9044 */
+	"lvvhaz", "lvvzc", "lvwirdpq", "lvwnck",	/* 9048 */
+	"lvwnrkflbg", "lvwvwiqpx", "lvxa", "lvxaeavg",	/* 9052 */
+	"lvxrbghzsijigq", "lvycsjo", "lvzkpzacghcxeh", "lvzplr",	/* 9056 */
+	"lw", "lwb", "lwbhlztwif", "lwdsadaj",	/* 9060 */
+	"lwfxijguscqlp", "lwfy", "lwgoggvhdmzsfh", "lwhbjk",	/* 9064 */
+	"lwhlcmcfmvpccm", "lwhxdpupipeiuy", "lwjhwcdfr", "lwjmqla",	/* 9068 */
+	"lwjzgqavambbx", "lwlshkrm", "lwlwavpq", "lwnczku",	/* 9072 */
+	"lwnfwsrvldkcgb", "lwnq", "lwobsuqjwqmfa", "lwpjrev",	/* 9076 */
+	"lwqguggqauc", "lwshatheoydpd", "lwsnitejsz", "lwsqmjgihuogkm",	/* 9080 */
+	"lwvddw", "lwvjgkvis", "lwwe", "lwwukophwg",	/* 9084 */
+	"lwxhlpl", "lwz", "lwze", "lwzxt",	/* 9088 */
+	"lx", "lxbt", "lxckd", "lxewkquwzhkiu",	/* 9092 */
+	"lxihgvdmgj", "lxklc", "lxl", "lxlssprgw",	/* 9096 */
+	"lxmcszbeb", "lxmvybazuxj", "lxohaqyfu", "lxopeakn",	/* 9100 */
+	"lxpylirodnu", "lxqhvbehszj", "lxqmalu", "lxrfyyb",	/* 9104 */
+	"lxsyeensucsxie", "lxterduzu", "lxtgkhhappmkie", "lxtv",	/* 9108 */
+	"lxvkqsrslpe", "lxyeds", "lxykybifyjn", "lxypjmjda",	/* 9112 */
+	"lxywlx", "lxzinl", "ly", "lyaiz",	/* 9116 */
+	"lycwybgofonsr", "lycxgrwz", "lydiomxkjeppm", "lydnxlbaawaok",	/* 9120 */
+	"lyffwxvjt", "lyjinz", "lyjllkzobtcxe", "lykvjdymz",	/* 9124 */
+	"lylfhtgthd", "lyn", "lyp", "lypvgg",	/* 9128 */
+	"lyqjbvuthvycb", "lyqoi", "lyqyx", "lyrsig",	/* 9132 */
+	"lyspvr", "lytdgeyyxbyovb", "lyto", "lyuyqq",	/* 9136 */
+	"lyvjtlfcelujzq", "lyw", "lywo", "lyxicnkqq",	/* 9140 */
+	"lyxpnvpket", "lyxt", "lyznfjgcbziiy", "lz",	/* 9144 */
+	"lzaoikcl", "lzbzdomaep", "lzcdnuhzx", "lzdewjgaeccmw",	/* 9148 */
+	"lzefnwjrew", "lzflponekpm", "lzhknt", "lzjndud",	/* 9152 */
+	"lzkmfy", "lzkqwb", "lzkvxjqqbka", "lzmmehstuzdire",	/* 9156 */
+	"lznk", "lznnwswrtcd", "lzpll", "lzpssxooprnlzb",	/* 9160 */
+	"lzqiidmtnc", "lztb", "lztnqdoheoh", "lzu",	/* 9164 */
+	"lzuikdwggkts", "lzvqyarrsr", "lzwkg", "lzwmfjug",	/* 9168 */
+	"lzwxpklisc", "lzyoyal", "lzyxnj", "lzztc",	/* 9172 */
+	"ma", "maaankzlvj", "maakpjmnqnd", "mab",	/* 9176 */
+	"macvxdkjcy", "madh", "madyaoloobqr", "maexr",	/* 9180 */
+	"magm", "magqpotnp", "magvo", "mahiqehbjcbt",	/* 9184 */
+	"mahjbu", "mahmbfm", "majxkndr", "malgcdy",	/* 9188 */
+	"malqjhmpmlb", "mampwo", "manppyw", "manyglvtem",	/* 9192 */
+	"maobhjarb", "mapchedlltc", "mapjctbs", "maqrtk",	/* 9196 */
+	"markqqmina", "masw", "matf", "matw",	/* 9200 */
+	"mau", "mauonb", "mawa", "maxlf",	/* 9204 */
+	"maybzercnxjlcp", "mb", "mbblzegks", "mbdsvtzyhca",	/* 9208 */
+	"mbekvmrzctyojk", "mbg", "mbgifkikb", "mbgolmkeresn",	/* 9212 */
+	"mbgqet", "mbjfbksgfzs", "mbkiejqz", "mbkkdknatazlzf",	/* 9216 */
+	"mblbiajkcla", "mblbprdkaua", "mbnnc", "mbovcgdrolziq",	/* 9220 */
+	"mbpcxbqohih", "mbqnaqvhsop", "mbrkdhzfjdjdcv", "mbthitjdcvxsqe",	/* 9224 */
+	"mbubjlhx", "mbuqf", "mbybex", "mca",	/* 9228 */
+	"mcajzk", "mcbnpm", "mccaixedehu", "mccazquay",	/* 9232 */
+	"mcccjwoke", "mcdmsequh", "mcehtses", "mcemh",	/* 9236 */
+	"mcenzdmb", "mceyrdcaepiqqt", "mcezzgps", "mcfrnxe",	/* 9240 */
+	"mch", "mchybhpraaqz", "mcih", "mcjkm",	/* 9244 */
+	"mcjrhk", "mcmm", "mcmwcfmht", "mcmzqsujmil",	/* 9248 */
+	"mcmzqsx", "mcnhpkftudhc", "mcrmeqfc", "mcrxcpgppaidbg",	/* 9252 */
+	"mcsrazttz", "mcwcyh", "md", "mdakn",	/* 9256 */
+	"mdbwo", "mdcudsqhgvikb", "mddncs", "mddvkttuwws",	/* 9260 */
+	"mdfzhdojxkgikf", "mdg", "mdixubzzcxmr", "mdjfumvrcmgpyx",	/* 9264 */
+	"mdjzd", "mdkxag", "mdlnawkcuns", "mdmrfzpoofyje",	/* 9268 */
+	"mdnaqttjrvai", "mdojv", "mdpdyzvcsnoj", "mdpibroy",	/* 9272 */
+	"mdpkwjqobzpjk", "mdpysfkapvpr", "mdqrpdrfrbbew", "mdsfrwfnbgs",	/* 9276 */
+	"mdsubhjtvo", "mdtpdemtw", "mdtpnmcmyxokvy", "mdujzm",	/* 9280 */
+	"mdunp", "mdvgnnujjuokb", "mdwgoueuyian", "mdwgyudutulaa",	/* 9284 */
+	"mdz", "mdzpqbv", "mdzttgkanox", "mdzxarfuk",	/* 9288 */
+	"me", "meadygnjkjud", "meah", "meaxt",	/* 9292 */
+	"meb", "medjxrmvjbir", "medlxothitffo", "medzcgigvsaui",	/* 9296 */
+	"meefqpzfaqf", "mefvki", "mehgx", "mehqsjhe",	/* 9300 */
+	"mehuhhxjvyjx", "meirvdij", "meizixi", "mejxruilpedf",	/* 9304 */
+	"mejyalbpjgtn", "mekuwwkngknj", "menfoihtrg", "menzugwgvcfx",	/* 9308 */
+	"meomfpoqsb", "meoqpjxulhhszm", "mepbgu", "meqfyvv",	/* 9312 */
+	"meqslrskgtemh", "mer", "meredk", "mew",	/* 9316 */
+	"mewn", "mexb", "mexeftqr", "mexmaot",	/* 9320 */
+	"mexz", "mey", "meyojriqsms", "meyxiuqychbli",	/* 9324 */
+	"mezsyujb", "mfaqpplrnautv", "mfb", "mfbkbdr",	/* 9328 */
+	"mfctbh", "mfcueuq", "mfdgwejraqgjz", "mfeozmb",	/* 9332 */
+	"mffhzjdbtgat", "mfg", "mfgtnhbbxuflfh", "mfhjwn",	/* 9336 */
+	"mfjrwmgs", "mfkt", "mfltkg", "mfokyfloo",	/* 9340 */
+	"mfqqvhfdrs", "mfqqvxca", "mfrfguqqmtmlss", "mfrivanpfji",	/* 9344 */
+	"mfsyulcrojpxl", "mftev", "mfthupqe", "mftljzzymtrpw",	/* 9348 */
+	"mfvsfkiqhps", "mfwiltrpm", "mfwjl", "mfwlfqrc",	/* 9352 */
+	"mfwqhocx", "mfwwyify", "mfwxnuu", "mfxqzwehego",	/* 9356 */
+	"mfxyrighpor", "mfyb", "mfyndfygc", "mg",	/* 9360 */
+	"mgdeymvlg", "mge", "mgguu", "mghxvualvpbsf",	/* 9364 */
+	"mgkksjmpn", "mgmqllwyvtbt", "mgmtlox", "mgol",	/* 9368 */
+	"mgotcqdobdg", "mgozgbojb", "mgpzjcwldtt", "mgq",	/* 9372 */
+	"mgqgsydhg", "mgqkgj", "mgruxryqfdqok", "mgskeuikugtb",	/* 9376 */
+	"mgveq", "mgvoa", "mgxcjeggcrn", "mgyzimwdsnvhj",	/* 9380 */
+	"mgzaxlsygv", "mgzoianxotpf", "mh", "mhb",	/* 9384 */
+	"mhbvrhiitjj", "mhbvwjcqyaccn", "mhcg", "mhdrqk",	/* 9388 */
+	"mhf", "mhjbdu", "mhjli", "mhjswivvjldste",	/* 9392 */
+	"mhk", "mhkifz", "mhl", "mhll",	/* 9396 */
+	"mhltzglru", "mhmdkkywmdav", "mhmizbxmb", "mhmld",	/* 9400 */
+	"mhmnxjrqy", "mhnsusfxgror", "mhohzllhf", "mhoqeflekr",	/* 9404 */
+	"mhpgjgql", "mhpom", "mhptskr", "mhpurwzkd",	/* 9408 */
+	"mhpwgpbzzi", "mhqarubu", "mhqbtqmau", "mhs",	/* 9412 */
+	"mhtnije", "mhuftdxjwjkj", "mhx", "mhxqerydnr",	/* 9416 */
+	"mhyqrdadsoju", "mhyrbmswgz", "mi", "mibyynov",	/* 9420 */
+	"mic", "micxhfcoa", "miecblqfgypss", "miewagrew",	/* 9424 */
+	"mifrjxoiqwcwax", "migt", "migyxrxrfvnl", "mihxsthccj",	/* 9428 */
+	"miigu", "miimpwoun", "mijliqiuo", "mijmosjlpnsi",	/* 9432 */
+	"mikzdueglpuk", "milge", "mimkcjeiuvae", "mimo",	/* 9436 */
+	"minbiicxlwikmv", "minefx", "minyncfpoag", "miohxntzauyle",	/* 9440 */
+	"miojhtcdqxdj", "miomie", "miproieur", "misgpppht",	/* 9444 */
+	"mismoihgezi", "mitbkvphmcgr", "mitib", "miticfmdz",	/* 9448 */
+	"mitihiegakggt", "miv", "mivfgoumygfa", "mivsxsslhbbiih",	/* 9452 */
+	"miw", "mixbfhduzfncw", "miy", "mizcc",	/* 9456 */
+	"mj", "mjbfu", "mjbrajw", "mjdqlmhwad",	/* 9460 */
+	"mjfgvzshpeqzdh", "mjfwwnvlbthk", "mjghfdpre", "mjgjwylwpjv",	/* 9464 */
+	"mjhfphush", "mjhujrebtq", "mjiaxiklj", "mjiy",	/* 9468 */
+	"mjjdqhxck", "mjjz", "mjk", "mjlfgpiuh",	/* 9472 */
+	"mjmoxnxuevhu", "mjn", "mjnliiwabcopes", "mjnqwwhn",	/* 9476 */
+	"mjnszrjczy", "mjntsj", "mjqcyhtiywhcv", "mjrgusjgs",	/* 9480 */
+	"mjv", "mjvkt", "mjxcvtlvohpjq", "mjymg",	/* 9484 */
+	"mjynpl", "mjzr", "mk", "mka",	/* 9488 */
+	"mkbbdx", "mkcsy", "mke", "mkeeoqceada",	/* 9492 */
+	"mkf", "mkgawdsny", "mkgbdzprbz", "mkhk",	/* 9496 */
+	"mkir", "mkjssl", "mkjy", "mkmqsjnxbhix",	/* 9500 */
+	"mkmwhxaf", "mkndlngjna", "mkpfprq", "mkpoih",	/* 9504 */
+	"mkqzptsj", "mkrjal", "mktwzyelc", "mkw",	/* 9508 */
+	"mkydnfsazshe", "mkyqaoymc", "mkzxvspdum", "ml",	/* 9512 */
+	"mlayipjyqtr", "mlbnu", "mlchustznymbsg", "mlcudlkv",	/* 9516 */
+	"mlcxucdfjj", "mldssrsxbxi", "mleastpqfdpjem", "mlht",	/* 9520 */
+	"mliuvuaguxt", "mljykozw", "mlmhrgsrnyex", "mlmiyrhimzeue",	/* 9524 */
+	"mlpebryhjtg", "mlpzdmei", "mlq", "mlqcctczb",	/* 9528 */
+	"mlrxbkkpaibii", "mlsm", "mlstexxjt", "mlu",	/* 9532 */
+	"mlv", "mlvenvnvhvarle", "mlwvbxgnjh", "mlxpal",	/* 9536 */
+	"mlxu", "mlyzise", "mm", "mmaefrz",	/* 9540 */
+	"mmavycbsapdue", "mmbhdwcitaytx", "mmbqrdoxue", "mmc",	/* 9544 */
+	"mmcdwttxkhhvdd", "mmcivormxgsf", "mmckkeiito", "mmdzafgtsh",	/* 9548 */
+	"mmehlyrpex", "mmejw", "mmenossnqjvpef", "mmewddgvsvidm",	/* 9552 */
+	"mmfquzims", "mmfsckiakj", "mmgddzqkxyj", "mmghvqakbftu",	/* 9556 */
+	"mmgnfjnyvcpin", "mmgu", "mmiu", "mmjnt",	/* 9560 */
+	"mmjwjhodgss", "mmk", "mmlsnfkise", "mmmpvcwmvo",	/* 9564 */
+	"mmmqlo", "mmnyfs", "mmoawvhrecpm", "mmojcpbpxdkfz",	/* 9568 */
+	"mmpatljbps", "mmpmmm", "mmq", "mmqnjabld",	/* 9572 */
+	"mmqqroicfy", "mmrrdodktpz", "mmsbfureuipt", "mmsxvawngeoo",	/* 9576 */
+	"mmtrgn", "mmuaydopppppr", "mmub", "mmudlmeqaosdn",	/* 9580 */
+	"mmui", "mmwgzulwxcu", "mmxkdyryjispho", "mmxmrqzhz",	/* 9584 */
+	"mmz", "mn", "mnaficxod", "mnayaxmmojdi",	/* 9588 */
+	"mnbcwlnwt", "mnbvtqdsxyvmr", "mndbzzebqqdhvm", "mndwtytxrd",	/* 9592 */
+	"mnfxgmoamftw", "mnghqecwwxjg", "mnijx", "mnj",	/* 9596 */
+	"mnkifhsqxvnehw", "mnldyssjhpe", "mnlomewmgob", "mnltcpz",	/* 9600 */
+	"mnmyfags", "mnoskzvlnanl", "mnpvkvcq", "mnskzwjas",	/* 9604 */
+	"mntnhlwo", "mnugp", "mnujzzjznnvro", "mnuuqgrcvkhvr",	/* 9608 */
+	"mnvnels", "mnw", "mnweinnotioxt", "mnwwconnqbyt",	/* 9612 */
+	"mnxbmfl", "mnyowuyla", "mnyt", "mnznyvssclffni",	/* 9616 */
+	"mo", "mob", "mod", "modebzgsuqnb",	/* 9620 */
+	"moep", "mofllvba", "mofznp", "mogldiyrcaei",	/* 9624 */
+	"mok", "momuhmdaxqbfy", "mopyfoom", "moqlayqijd",	/* 9628 */
+	"moqmtgixunw", "morcrrkc", "morpzhf", "mortw",	/* 9632 */
+	"motuv", "mou", "moyhxuksljau", "mozuajbfmtokyg",	/* 9636 */
+	"mpa", "mpcbokltscsmb", "mpcebw", "mpdnzufwvpgu",	/* 9640 */
+	"mperkdkb", "mpgaukdlfkqqh", "mpgbebbqi", "mpjwtoydd",	/* 9644 */
+	"mpkmwgawtk", "mpmchzvxvywcak", "mpmmm", "mppkwmz",	/* 9648 */
+	"mprrgyyodvugyy", "mpsokebqvbgtct", "mptnwax", "mpviqstqsvf",	/* 9652 */
+	"mpxdzvlwn", "mpxy", "mpzqhndbnth", "mq",	/* 9656 */
+	"mqcjr", "mqi", "mqijihvipdnnoe", "mqjquv",	/* 9660 */
+	"mqkwijpsrzebcv", "mqljuptrfeht", "mqnokbmer", "mqnxxvzanhgna",	/* 9664 */
+	"mqnyannwrvks", "mqo", "mqoifinyxncm", "mqpco",	/* 9668 */
+	"mqqonp", "mqqrqmyydynknv", "mqqw", "mqrkfe",	/* 9672 */
+	"mqslkuzjqgwpj", "mqsxahmvavaq", "mqsxtdimtttr", "mqvkzsozyiokmb",	/* 9676 */
+	"mqvtfjcjybsusj", "mqyizamxpe", "mr", "mrasqjaxmkdi",	/* 9680 */
+	"mrcihgumflaior", "mrcnt", "mrcxbrbalxvqxi", "mrdezmvigxzucn",	/* 9684 */
+	"mreemydezgapf", "mreyrqekocb", "mribg", "mridkxvrlkzaa",	/* 9688 */
+	"mrixadgkopi", "mrixorcnac", "mrjpkwhgxzfoen", "mrll",	/* 9692 */
+	"mrngvhvgjecba", "mrpdkwpeni", "mrpi", "mrpkkzu",	/* 9696 */
+	"mrrswjy", "mrsdoglscmm", "mrtekxsn", "mrtghikbnvb",	/* 9700 */
+	"mru", "mruvgenfdsdxjf", "mrwj", "mrzdieqnv",	/* 9704 */
+	"mrzepthyprngr", "mrzyyuv", "ms", "msabfomrne",	/* 9708 */
+	"msalnlgcuwkgcz", "msaq", "msbkhifnt", "msbzzq",	/* 9712 */
+	"msdaozsfuz", "msdxpivl", "mseqeqnmdt", "msggrkgqgwq",	/* 9716 */
+	"mshbxypz", "msingqtjogh", "msjasuhzaykww", "mslcbroz",	/* 9720 */
+	"mslizumint", "mslmocvswikak", "msmsnmzs", "msmwuo",	/* 9724 */
+	"msoljlbkd", "mspmdkatgdjb", "msqtcdvowrugoy", "msrnlfxddwnyt",	/* 9728 */
+	"mssbwbnwtv", "mswwopq", "mszjsfspvhs", "mszlw",	/* 9732 */
+	"mszttfgmxxdsd", "mt", "mtagplw", "mtav",	/* 9736 */
+	"mtb", "mtbrwys", "mtdxasgvm", "mtew",	/* 9740 */
+	"mtfcfehx", "mthazuvsacprm", "mthkzzla", "mtjbhniqdqfoj",	/* 9744 */
+	"mtjujtpnto", "mtjxoonngve", "mtkb", "mtllkekkrwkubk",	/* 9748 */
+	"mtlmowqmlsgoll", "mtmyfkciszhww", "mtnszftw", "mtps",	/* 9752 */
+	"mtqioepd", "mtqrc", "mtrfwnhhzikrbw", "mtszkb",	/* 9756 */
+	"mtvb", "mtwbysxvxm", "mtwmmk", "mtxsbxlz",	/* 9760 */
+	"mtxshdeqsbysp", "mtzbfnhtcdwc", "mu", "muadevlls",	/* 9764 */
+	"muaoigfb", "muauuipdrdyile", "muaxbmu", "mub",	/* 9768 */
+	"mubleyahxg", "mubsvtwmbjvvcm", "mubv", "mucuzhjjb",	/* 9772 */
+	"muhdjs", "muhmttcdkk", "muhnumwzy", "muje",	/* 9776 */
+	"muktupmnvuhf", "mulhrgywu", "mulojnnvtbsuq", "mumna",	/* 9780 */
+	"mup", "muqkckn", "muvxnkomhv", "muwqtcinv",	/* 9784 */
+	"muxtior", "muydazmpu", "muyxmmryozsre", "muzxzbzb",	/* 9788 */
+	"mv", "mvaohtpdazf", "mvb", "mvdd",	/* 9792 */
+	"mvdebfaej", "mvenkcv", "mvgbjhuqagxf", "mviplexstg",	/* 9796 */
+	"mvm", "mvmddlyllmp", "mvobobi", "mvoxoyha",	/* 9800 */
+	"mvp", "mvrnkueflul", "mvsknian", "mvuflpag",	/* 9804 */
+	"mvuhviacorsyuq", "mvxbu", "mvxjzrorn", "mvxzosoulqbxd",	/* 9808 */
+	"mvyfamultzyth", "mvyjgydreq", "mvzqaodtn", "mvzssgvr",	/* 9812 */
+	"mwakwyspb", "mwamnfs", "mwbxhlifwp", "mwcqfiuxdm",	/* 9816 */
+	"mwd", "mwepsuyxwkv", "mwhk", "mwhwnlucrdbeb",	/* 9820 */
+	"mwibwwi", "mwkh", "mwkk", "mwkqafikinxwco",	/* 9824 */
+	"mwljchlxad", "mwpvjo", "mwqh", "mwrd",	/* 9828 */
+	"mwrdijts", "mwsosl", "mwsqbgxzo", "mwtcbfuy",	/* 9832 */
+	"mwuqxfto", "mwuxtrzaynlytk", "mwvewq", "mwvjwxcfrld",	/* 9836 */
+	"mwvscauzuagic", "mww", "mwwgspeafz", "mwynxzlqnwn",	/* 9840 */
+	"mx", "mxacodxn", "mxb", "mxbdihfyvdq",	/* 9844 */
+	"mxbhbofrusqybh", "mxbhcq", "mxbtwh", "mxcbrrlue",	/* 9848 */
+	"mxczi", "mxemyyjzyyqpvc", "mxetwgqm", "mxglqvblzwik",	/* 9852 */
+	"mxiiknhlmahzqy", "mxildqkrn", "mxmm", "mxoub",	/* 9856 */
+	"mxoxk", "mxpmlgd", "mxqqgzaecz", "mxqwnurugekrb",	/* 9860 */
+	"mxrag", "mxs", "mxtez", "mxtievtmngr",	/* 9864 */
+	"mxtjct", "mxuvrdycwiatc", "my", "myancms",	/* 9868 */
+	"mybbr", "myc", "mydcfgne", "mydkspakyxas",	/* 9872 */
+	"myghaztctnxdt", "mygydzcdbrhd", "mygylo", "myimzahaqkaez",	/* 9876 */
+	"myitogvgyufryy", "mylfch", "myljkbfsfudhu", "mymowefyptfmvf",	/* 9880 */
+	"myoanqcc", "mypezosd", "mypnnn", "myprpemkczkrb",	/* 9884 */
+	"myqwy", "mysrfvgmnww", "mywm", "myxa",	/* 9888 */
+	"myxiprlfletux", "myxmpbhjqzh", "myxuoc", "myycax",	/* 9892 */
+	"myytlqopscau", "myzfzyrkjcqgqg", "myzjpmogwkvanq", "mz",	/* 9896 */
+	"mzbgeha", "mzbhmszrhshwd", "mzbuurjaqz", "mzcajzkzx",	/* 9900 */
+	"mzekhv", "mzf", "mzffxd", "mzfmqeuufsy",	/* 9904 */
+	"mzgb", "mzhnzpfogw", "mzjhjnl", "mzjhpjxyjkz",	/* 9908 */
+	"mzjpeuelxgfuc", "mzjre", "mzl", "mzlnf",	/* 9912 */
+	"mzmbrfa", "mzmztdgwukwsl", "mzngjtgmhu", "mzpgq",	/* 9916 */
+	"mzq", "mztpxdl", "mzuageuwcprq", "mzvkfbs",	/* 9920 */
+	"mzvvqifuzh", "mzwyeghh", "mzxdnm", "mzxifpvkgpxzne",	/* 9924 */
+	"mzxqd", "mzxtmhstifxgf", "mzxwahupkloj", "mzydplmjogkrsf",	/* 9928 */
+	"na", "naaox", "nabmmkwgczocpp", "nabwjm",	/* 9932 */
+	"nacuasraornlt", "nadag", "nadr", "naenemfowriky",	/* 9936 */
+	"nag", "nagl", "nahjogtaxbr", "naidin",	/* 9940 */
+	"nairliyx", "najnphqz", "nakt", "nanpcpyb",	/* 9944 */
+	"napqxm", "naqjhrntbyuts", "narrwrdkbg", "nasoxj",	/* 9948 */
+	"natkdcxlx", "nau", "navpugg", "nawbfmowalvkdd",	/* 9952 */
+	"nawmhjmb", "nb", "nbaezeek", "nbchb",	/* 9956 */
+	"nbdckoqzkwb", "nbdmuqmvfmo", "nbervpeobyl", "nbg",	/* 9960 */
+	"nbhct", "nbioc", "nbjsdmkzfcxdi", "nbl",	/* 9964 */
+	"nbmo", "nbn", "nbnrgtgjub", "nborgvkwmrqc",	/* 9968 */
+	"nbot", "nbpztqafkyc", "nbqjvqsqcevr", "nbryg",	/* 9972 */
+	"nbsmx", "nbtudrshfssma", "nbufbqoxziyur", "nbvschxhuihrch",	/* 9976 */
+	"nbw", "nbwoy", "nbxk", "nbxmvbuurnehm",	/* 9980 */
+	"nbyzthcsykerv", "nbzme", "ncanztehdhuhal", "ncbt",	/* 9984 */
+	"nccpwsilwznm", "ncd", "ncdyc", "nce",	/* 9988 */
+	"ncebhzuhxvbnd", "ncevicl", "ncfbhtfwrmrzyl", "ncg",	/* 9992 */
+	"ncgwlfbpgccfq", "ncgwxlyost", "ncirymvte", "ncivj",	/* 9996 */
+	"ncklsm", "nclgjgj", "ncmchm", "ncmo",	/* 10000 */
+	"ncouj", "ncqcej", "ncqn", "ncqxai",	/* 10004 */
+	"ncrcssqshw", "ncrirtcodd", "ncs", "ncsmjcuafhsnmv",	/* 10008 */
+	"ncsqakvij", "ncszccxgjzudcb", "nctaucxlvfp", "ncuxcarxnkeek",	/* 10012 */
+	"ncvoouxaquxa", "ndb", "ndcyosypaldxgw", "nddrpcgwgh",	/* 10016 */
+	"ndepnkd", "ndewkuuhvlc", "ndfelxjliex", "ndflvqwi",	/* 10020 */
+	"ndfqlazyfqs", "ndgt", "ndi", "ndicx",	/* 10024 */
+	"ndilijjjfnfdo", "ndjpegbmslsbec", "ndjsyfym", "ndnvqwsfxgi",	/* 10028 */
+	"ndnvyqwvrs", "ndnws", "ndryf", "ndsbuyv",	/* 10032 */
+	"ndsen", "ndslukpunv", "ndtbouzp", "ndtcwlswy",	/* 10036 */
+	"ndtjzfltub", "nduijeelz", "ndukpgd", "ndukyhszf",	/* 10040 */
+	"ndwubp", "ndwwukw", "ndxv", "ndy",	/* 10044 */
+	"ndygnoczkve", "ne", "neagsnnjyknfy", "nebybjp",	/* 10048 */
+	"necyszdyh", "nedjieagxmhcu", "neeig", "negzxaxdysgsx",	/* 10052 */
+	"nekfomsrveq", "nekt", "nengimvfixvsnl", "nepsu",	/* 10056 */
+	"neqpjdk", "nesojbqueqquiq", "nesznnvmpjdlhc", "neub",	/* 10060 */
+	"neulkntyhyrr", "neuvul", "nevrbbryqang", "nevy",	/* 10064 */
+	"newksirifphi", "newuefk", "nexxbbpgg", "nf",	/* 10068 */
+	"nfa", "nfd", "nfdecs", "nfdqkzzjhcdl",	/* 10072 */
+	"nffkyk", "nfgc", "nfgobamrbxpiv", "nfhlalnr",	/* 10076 */
+	"nfinashyievnp", "nfiywfwq", "nfjx", "nfmm",	/* 10080 */
+	"nfnorexrvii", "nfpbkfdcrzey", "nfpbycnndzu", "nfpflpbnufehd",	/* 10084 */
+	"nfpkkozr", "nfqwcc", "nfqx", "nfsapw",	/* 10088 */
+	"nftpoygbr", "nftsosba", "nfukaixvbq", "nfvbmlwvns",	/* 10092 */
+	"nfvuxsadgmn", "nfxesli", "nfxltz", "nfybeoitrwnk",	/* 10096 */
+	"nfzbcvmzdafm", "nfzfo", "nfzhahqrbu", "ng",	/* 10100 */
+	"nga", "ngbeficvilfsm", "ngcusbzonc", "ngehxuxapke",	/* 10104 */
+	"ngg", "ngge", "ngggvcg", "nghnohnbaohy",	/* 10108 */
+	"nghxihmhtafeek", "ngiennyabffqmh", "ngivtqtk", "ngjldl",	/* 10112 */
+	"ngjmqd", "ngjpaakib", "ngl", "ngmpm",	/* 10116 */
+	"ngng", "ngnykzcb", "ngour", "ngrggtrakjo",	/* 10120 */
+	"ngthjx", "ngtm", "nguawwa", "nguisjxilyesiz",	/* 10124 */
+	"ngvjbtcicinsg", "ngyqjvf", "ngyqvujph", "ngyreakwb",	/* 10128 */
+	"ngyweyqpz", "ngzmivzclmh", "ngzmrpftczp", "nh",	/* 10132 */
+	"nha", "nhbgqn", "nhclqikwbw", "nhcregorjtlf",	/* 10136 */
+	"nhdfuqrnzzan", "nhexxeegsgoz", "nhgekt", "nhgyucaezp",	/* 10140 */
+	"nhhgfh", "nhizazam", "nhkmgciuoeyp", "nhmga",	/* 10144 */
+	"nhmho", "nhmyhovwju", "nhnmksbjgpzh", "nho",	/* 10148 */
+	"nhow", "nhqh", "nhqwiipfbea", "nhu",	/* 10152 */
+	"nhuavvephgjwcb", "nhudfqb", "nhuvepyurt", "nhv",	/* 10156 */
+	"nhvithkkteyouq", "nhvwuwia", "nhwldlhwclvrvv", "nhyxjnincuuo",	/* 10160 */
+	"nhzbq", "nhzurkcqz", "nhzwpcteshdauj", "ni",	/* 10164 */
+	"niarzj", "nidblplrtign", "nieujyot", "nigecosejle",	/* 10168 */
+	"nigjrvldtrzw", "nigkldwdo", "nigrkfosjfwun", "nihbpg",	/* 10172 */
+	"niij", "nijso", "nijugktshrkozx", "nik",	/* 10176 */
+	"nikaielxeypcdm", "nikqj", "nillsijal", "nimtc",	/* 10180 */
+	"nimyentkalvfpq", "nioooxuxfzsyfb", "nipxdxde", "niqjxn",	/* 10184 */
+	"niqydkzerwr", "niqzrpfipkntnr", "nireijehgmdcvx", "nitywdw",	/* 10188 */
+	"niv", "nivbfkurmsir", "nivlmjvppfszmp", "nix",	/* 10192 */
+	"nixcgzyer", "nixziptnixebu", "niytfwidnbkkb", "nizndcr",	/* 10196 */
+	"nj", "njag", "njcp", "njcr",	/* 10200 */
+	"njdjzbpfirgeb", "njearyaxyalc", "njfajnewgusm", "njhaujfsbojrcq",	/* 10204 */
+	"njl", "njlmyltgj", "njlxpqcfujnr", "njlxx",	/* 10208 */
+	"njmgtgnemsv", "njmxn", "njncrexke", "njngaemwaspoy",	/* 10212 */
+	"njofsamsbqj", "njogumsic", "njojwfuzm", "njonxzy",	/* 10216 */
+	"njovduijlgqif", "njpwamcjesjz", "njrp", "njrvtubc",	/* 10220 */
+	"njvcnhnxzckh", "njvfozq", "njwnvvhkdaxdsl", "njwyj",	/* 10224 */
+	"njxcjtnsbcgrh", "njxzjg", "njzwthpxz", "nk",	/* 10228 */
+	"nkauil", "nkaulvbplbw", "nkbstopiv", "nkcaddzyop",	/* 10232 */
+	"nkdomr", "nkewrtni", "nkf", "nkgtbxaoas",	/* 10236 */
+	"nkjrgwjefh", "nkkjnrmd", "nkknbkn", "nklfgiobunn",	/* 10240 */
+	"nklqhh", "nkmuymaspb", "nknnyvhohw", "nkodg",	/* 10244 */
+	"nkovn", "nkpmzst", "nkriubvmuzzl", "nkrj",	/* 10248 */
+	"nksngrewiljo", "nkuympgqvqoc", "nkvn", "nkwdn",	/* 10252 */
+	"nkwl", "nkwvkhclhxlu", "nkxaixkua", "nkxhwb",	/* 10256 */
+	"nkxkjdyxd", "nkybrouykvn", "nkynkznfkn", "nl",	/* 10260 */
+	"nlbna", "nleqmj", "nleyqvvefalqfj", "nlhuke",	/* 10264 */
+	"nllhgvigzln", "nllqefzh", "nlm", "nlmctnhnu",	/* 10268 */
+	"nlobljmueebpht", "nlozmjyzmqf", "nlpmmgzdspfq", "nlqczjcopfhsar",	/* 10272 */
+	"nlqezcqw", "nlr", "nlrggceh", "nlrkqwpav",	/* 10276 */
+	"nlrlhyzcklkr", "nlugtdomtyxfdz", "nlvejkuspzft", "nlvnl",	/* 10280 */
+	"nlwvhuloahsl", "nly", "nlybf", "nlyvbxolfbuih",	/* 10284 */
+	"nlyxygxvof", "nm", "nmbx", "nmcidsi",	/* 10288 */
+	"nmdcmjbtks", "nmhblfh", "nmhmqkd", "nmic",	/* 10292 */
+	"nmipgg", "nmjansmdajsgij", "nmkvubkfzk", "nmloevkhsqjo",	/* 10296 */
+	"nmlqotdgvdilig", "nmlynekzffm", "nmn", "nmpzyfuet",	/* 10300 */
+	"nmr", "nmtacm", "nmtxkihyjafa", "nmugadaojifwp",	/* 10304 */
+	"nmv", "nmvbcaxoxhe", "nmvek", "nmwhfx",	/* 10308 */
+	"nmxsqnubv", "nmxycsngnbcngr", "nmywgse", "nn",	/* 10312 */
+	"nnablb", "nnam", "nnaqu", "nnb",	/* 10316 */
+	"nnchlbk", "nndagelcxctt", "nndbjf", "nngjkipcixgy",	/* 10320 */
+	"nngsbzv", "nnhcynnhnlf", "nnhwkaxuzwcyer", "nnixbozzk",	/* 10324 */
+	"nnjn", "nnjny", "nnkvbdaaimd", "nnlsfitzeru",	/* 10328 */
+	"nnmuipjzv", "nnocfiz", "nnoffyh", "nnplixdvwoto",	/* 10332 */
+	"nnpseskvkmhj", "nnq", "nnrccnqjs", "nnsi",	/* 10336 */
+	"nnsnyn", "nnsr", "nnszmxqztd", "nnt",	/* 10340 */
+	"nntwxax", "nnusg", "nnvledkp", "nnvwrhdmayl",	/* 10344 */
+	"nnwqwgy", "nnx", "nnxmngtfzpf", "nnxxsgntihkjp",	/* 10348 */
+	"no", "noacndxriufmea", "noakgbh", "noamuqnnomzbem",	/* 10352 */
+	"nobcskfues", "nobhnwpr", "nocyzyyghnqbau", "nognktyyf",	/* 10356 */
+	"nogze", "noi", "nojplnz", "nojwvwcdljxy",	/* 10360 */
+	"nokj", "nolcjtesjn", "nolgyikqpjdek", "nolxwuld",	/* 10364 */
+	"nomfrsfivtoclh", "nomtrteotpmdki", "nonossneu", "nooaxyau",	/* 10368 */
+	"noon", "nopw", "noqbzxcblof", "noqunohnbuv",	/* 10372 */
+	"noszmyut", "novlkn", "novyr", "novzmyiyeaidjv",	/* 10376 */
+	"noyxpco", "np", "npasyqgznrxu", "npavywnftbuss",	/* 10380 */
+	"npblakosp", "npbmtjzrdt", "npcmy", "npcsx",	/* 10384 */
+	"npddqvvqmr", "npdrrkbd", "npgncwjjhlmaof", "npgs",	/* 10388 */
+	"npgsdzc", "npitss", "npjt", "npjwdd",	/* 10392 */
+	"npkvqlbwmeyak", "npkzicujvq", "npmdfftcxcgzjs", "npncjo",	/* 10396 */
+	"npngpkvospm", "npnytzkml", "npohdgnfs", "nppqhnug",	/* 10400 */
+	"nprsjnatkqy", "npsmrat", "npt", "nptrtphzhl",	/* 10404 */
+	"npvhhynhcnb", "npvs", "npvzldiywzt", "npxxdo",	/* 10408 */
+	"npybkhcnckf", "npzglvqdmr", "nq", "nqa",	/* 10412 */
+	"nqadm", "nqakmf", "nqanhwmitayq", "nqascbx",	/* 10416 */
+	"nqbpdc", "nqfpthqurdmp", "nqighh", "nqiivuqfux",	/* 10420 */
+	"nqj", "nqjjqb", "nqk", "nqkrgiebbcxrvq",	/* 10424 */
+	"nqlcsnhxlgueg", "nqo", "nqqpgegzu", "nqrxeigbl",	/* 10428 */
+	"nqryy", "nqsddfgtja", "nqtdqmpwrlnde", "nqurzy",	/* 10432 */
+	"nqvli", "nqvlyq", "nqvxk", "nqyhvkhjx",	/* 10436 */
+	"nqyleqwmyvd", "nqyn", "nqzidyzkbw", "nqzybpgmh",	/* 10440 */
+	"nr", "nradq", "nrbhx", "nrbiceaafjzhy",	/* 10444 */
+	"nrcezdqsv", "nrdd", "nrddszkk", "nrebizlxq",	/* 10448 */
+	"nrekjorwzte", "nrgnlzkjxwmzuj", "nrgohntsqm", "nriroroamkfipa",	/* 10452 */
+	"nriuc", "nrjmubvtait", "nrjyqupocgycim", "nrkuappvpdqy",	/* 10456 */
+	"nrlazxpu", "nrlmaeldr", "nrlrm", "nrmdjyctofs",	/* 10460 */
+	"nrmxrzvxnwfa", "nrmyflkvyfjxi", "nrrxteuj", "nrsq",	/* 10464 */
+	"nrsxturafl", "nrv", "nrvtrqzxr", "nrx",	/* 10468 */
+	"nrxdeyxeifdie", "nryphg", "nrzgqt", "ns",	/* 10472 */
+	"nsaadil", "nsbgpwpea", "nscbwwjenqfahp", "nscylthxeoqvo",	/* 10476 */
+	"nsdgp", "nsggfhezoeyolz", "nsgsj", "nshe",	/* 10480 */
+	"nshtzg", "nshufcivtfhx", "nsiaazeypwy", "nsie",	/* 10484 */
+	"nsiyuftdris", "nsmawxjavdk", "nsnl", "nsod",	/* 10488 */
+	"nspejwvz", "nspojsimplqxp", "nsppfrkwb", "nssd",	/* 10492 */
+	"nssdrwdckv", "nsu", "nsufceudhw", "nsvvxvwnypujy",	/* 10496 */
+	"nswijiojz", "nsxdbzvqqtfu", "nsydic", "nsyn",	/* 10500 */
+	"nsyx", "nszsdlemrjr", "nszvczxu", "nt",	/* 10504 */
+	"ntcbdcqsxxrm", "ntcjnzjvnpndip", "ntcoxubdlrbf", "ntcpoydtx",	/* 10508 */
+	"ntdiqnbzyo", "ntdk", "nteppyfjrpgb", "ntfgzkregyuop",	/* 10512 */
+	"ntfmbitioyf", "ntghwzxfuatthp", "nthccempqcrut", "ntiqw",	/* 10516 */
+	"ntjldainwb", "ntl", "ntlgidbmkwk", "ntlwtttlvynn",	/* 10520 */
+	"ntmxalebzndo", "ntpaoqpqgdmaze", "ntplpzmtbas", "ntpxjlkpe",	/* 10524 */
+	"ntq", "ntrvalsif", "ntscfcqh", "ntsuxk",	/* 10528 */
+	"ntszc", "ntszrruqsyswps", "ntteu", "nttj",	/* 10532 */
+	"ntudvlerp", "ntvptgtndin", "ntxmzsctwvttgj", "ntxuxbzkbblvc",	/* 10536 */
+	"ntzdgogfo", "nu", "nuafilh", "nuamoredkewxh",	/* 10540 */
+	"nucwrlejqdsjlf", "nudoqqg", "nudvfhutkdg", "nugkxko",	/* 10544 */
+	"nuhcxnryriep", "nullablqiuzfbs", "num", "nunxwtozsuzbeh",	/* 10548 */
+	"nuogxdnvoho", "nuoxmwtyo", "nurm", "nusifwpr",	/* 10552 */
+	"nuuavhkb", "nuv", "nuwfrgqrpsuwcu", "nuwtnk",	/* 10556 */
+	"nuxktrwdujd", "nuxzsnj", "nuzby", "nuzcrafhjynr",	/* 10560 */
+	"nuzehvuxbp", "nv", "nvbgd", "nvds",	/* 10564 */
+	"nvdwfpx", "nveagigsxvua", "nvehpi", "nvfkyv",	/* 10568 */
+	"nvgzh", "nvhwpuapjjjbkv", "nvigfgm", "nvjur",	/* 10572 */
+	"nvkgkjboidh", "nvklplaaegbwgb", "nvmft", "nvmgiyajbiyc",	/* 10576 */
+	"nvne", "nvoc", "nvqmmzgdeurez", "nvrfh",	/* 10580 */
+	"nvsxvidiu", "nvtwcexmtw", "nvv", "nvvgyzrkj",	/* 10584 */
+	"nvwqxzrz", "nvxkfwkcjhh", "nvxrlrlwcmh", "nvxuftmjnbmr",	/* 10588 */
+	"nvy", "nvypeperjrcf", "nvz", "nvzqqxxmpa",	/* 10592 */
+	"nvzvrdxdiqlma", "nw", "nwa", "nwaq",	/* 10596 */
+	"nwcfnaxwx", "nwcqr", "nwctvalq", "nwdruif",	/* 10600 */
+	"nwgotcy", "nwi", "nwiwvzz", "nwkccc",	/* 10604 */
+	"nwlgxglvy", "nwlmnpsppx", "nwlmwmqnwhg", "nwnvssudqbqn",	/* 10608 */
+	"nwobc", "nwoiaqppxgbau", "nwomx", "nwphzhduqzutbm",	/* 10612 */
+	"nwpyqgh", "nwq", "nwqv", "nwqyvtw",	/* 10616 */
+	"nwrhiy", "nwscdfvncn", "nwtccbnh", "nwu",	/* 10620 */
+	"nwuhkviiciimw", "nwuoklackwfr", "nwvcvrfhufc", "nwxxhaxvhtmehr",	/* 10624 */
+	"nwzrmzux", "nx", "nxan", "nxbyuo",	/* 10628 */
+	"nxduitxpyc", "nxe", "nxebuqho", "nxekfcg",	/* 10632 */
+	"nxgligcwaft", "nxgpehlwen", "nxhija", "nxhpuibmlmon",	/* 10636 */
+	"nxjr", "nxl", "nxlivuy", "nxltzzhf",	/* 10640 */
+	"nxmdfr", "nxmuggebwr", "nxmwjlg", "nxnfuwfgs",	/* 10644 */
+	"nxocpu", "nxorfv", "nxpooigerweu", "nxpr",	/* 10648 */
+	"nxrlgooh", "nxsenzzsgn", "nxt", "nxtjezbd",	/* 10652 */
+	"nxtjfeuglg", "nxvi", "nxvtk", "nxwqotkemcjnan",	/* 10656 */
+	"nxxf", "nxxmegeknt", "nxxywyguuwluq", "nxyehmzq",	/* 10660 */
+	"nxznkgomiq", "ny", "nyaumenebj", "nycqsobng",	/* 10664 */
+	"nydasdbwnvv", "nyeiaezifsuukw", "nyeozal", "nyfenfla",	/* 10668 */
+	"nyfjmeepuh", "nyj", "nykqa", "nymgnacivlc",	/* 10672 */
+	"nymlnz", "nymqqcpe", "nynihpl", "nynywtiv",	/* 10676 */
+	"nyo", "nyowplrxpzdpdj", "nyqb", "nyqzsavdcd",	/* 10680 */
+	"nyriomuz", "nyrjksux", "nyrkmwykfz", "nys",	/* 10684 */
+	"nysocisiokeui", "nytkpaa", "nyvlb", "nyyipdib",	/* 10688 */
+	"nyyzhdx", "nz", "nzcmfekg", "nzeraznrk",	/* 10692 */
+	"nzf", "nzg", "nzhgipjere", "nzhswgrrmypdp",	/* 10696 */
+	"nzibcej", "nzilybwdatzzns", "nzioknmtw", "nzjysvah",	/* 10700 */
+	"nzlbb", "nzlhfmwslwtle", "nzmez", "nznyxvl",	/* 10704 */
+	"nzo", "nzoble", "nzthuggbtabyvi", "nztopfumxo",	/* 10708 */
+	"nzwnspmktmqm", "nzxg", "nzxxvgw", "nzzwffnlydqx",	/* 10712 */
+	"oa", "oaccehgsczsaer", "oacfwhbqbkcw", "oadaiiuukk",	/* 10716 */
+	"oadlrqjyphhnrb", "oaea", "oafdfzp", "oafllaasvmjeuk",	/* 10720 */
+	"oafxakqojhj", "oafzxizvtgzn", "oaio", "oaj",	/* 10724 */
+	"oajf", "oajkl", "oakjriesgszeex", "oal",	/* 10728 */
+	"oalohq", "oanbnmwbv", "oaoltu", "oaouwfwpuihguk",	/* 10732 */
+	"oappkrnu", "oapttds", "oaqzoobdu", "oasoj",	/* 10736 */
+	"oastluhbjos", "oasv", "oatmjehtscpyze", "oaufapp",	/* 10740 */
+	"oauspksuded", "oavv", "oawcqubsjsgml", "oawdyuavtwtk",	/* 10744 */
+	"oaxuq", "oaxwdv", "oaycjg", "oazisbbayr",	/* 10748 */
+	"ob", "obcigfl", "obdcmmyiguv", "obdpis",	/* 10752 */
+	"obequu", "obesdsendfiv", "obffedf", "obhidjaqwkeon",	/* 10756 */
+	"obiwmluby", "objylq", "obljrugixifjqk", "obmgef",	/* 10760 */
+	"obnefocutffu", "obnzfphub", "obosce", "obpcqhlfamhcuz",	/* 10764 */
+	"obpoelwxdzew", "obqihilr", "obrsvasblu", "obshszlhgs",	/* 10768 */
+	"obtjhpi", "obtmo", "obuwelng", "obvf",	/* 10772 */
+	"obxgyi", "obxukjjvxmjz", "obychitrt", "obypw",	/* 10776 */
+	"obz", "obzyidxvcbuucp", "oc", "oca",	/* 10780 */
+	"ocb", "occai", "occjphgwhme", "occo",	/* 10784 */
+	"ocebkvt", "ocegtcqn", "oceykvpxhjeh", "ocliuwfcykgyki",	/* 10788 */
+	"oclwjdmpxviy", "ocmarihbzd", "ocmtzbiv", "ocmx",	/* 10792 */
+	"ocnmjmbr", "ocpkzhaxsfold", "ocppwczeem", "ocqfddkxuepuh",	/* 10796 */
+	"ocubsrcgwho", "ocupnkxz", "ocvxbtp", "ocw",	/* 10800 */
+	"ocwtxdmnohp", "ocx", "ocxmur", "ocyolztx",	/* 10804 */
+	"oczhqc", "oczzsfa", "od", "odajfhffgmyxvk",	/* 10808 */
+	"odanf", "odasj", "odbaratidvijfy", "odbhdteppl",	/* 10812 */
+	"odbtgmzlxe", "odbymmozfq", "odcqhjmyzql", "odd",	/* 10816 */
+	"odeft", "odfzczu", "odgl", "odhh",	/* 10820 */
+	"odhwzkgfeuiwe", "odhyehgccp", "odjgn", "odjrtdb",	/* 10824 */
+	"odkkmumjchx", "odle", "ododfuiqpxya", "odosoxosgab",	/* 10828 */
+	"odpdcbshikgn", "odpiekwrnrp", "odrd", "odslabjducv",	/* 10832 */
+	"odugpn", "odvyj", "odvzdq", "odwjirhw",	/* 10836 */
+	"odwypeixomtr", "oe", "oebleiwjllolmo", "oeccba",	/* 10840 */
+	"oeceq", "oecft", "oecuz", "oecxdkb",	/* 10844 */
+	"oee", "oeen", "oeetmfxfask", "oef",	/* 10848 */
+	"oefphd", "oegdorxhxeqpeu", "oeikzjsrkbjg", "oejfmfhhan",	/* 10852 */
+	"oejphzugdiaxpp", "oejtpns", "oeknagibzqxjbq", "oekrsdcy",	/* 10856 */
+	"oel", "oemchmrmxgb", "oemdxgrftqoik", "oemjrjfw",	/* 10860 */
+	"oen", "oengm", "oenmpj", "oeprji",	/* 10864 */
+	"oeptbllxk", "oeqoq", "oeqy", "oesmzbduduj",	/* 10868 */
+	"oet", "oetsnqhcen", "oetydjn", "oeu",	/* 10872 */
+	"oevtg", "oewgykdlmkk", "oewlbiderihtx", "oex",	/* 10876 */
+	"oexfqtte", "oexich", "oeycggynssw", "oeygc",	/* 10880 */
+	"oeypmgxgtbk", "of", "ofbkgceyamvumi", "ofcnhdimvikf",	/* 10884 */
+	"ofcwtbue", "ofegvdndnh", "offsl", "ofgfvobzcviunr",	/* 10888 */
+	"ofgqpautxop", "ofikqohgcv", "ofkfkvumjl", "ofnwpnxbdgrtm",	/* 10892 */
+	"ofouzjyuetl", "ofqdyhfrxjm", "ofrcepqlonqe", "ofsh",	/* 10896 */
+	"ofsr", "oftrorfk", "oftupzqn", "ofugazxmwkhq",	/* 10900 */
+	"ofurxtzscuo", "ofv", "ofxbeyav", "ofxvslxqwy",	/* 10904 */
+	"ofz", "ofzozxrb", "og", "ogagzvsjfp",	/* 10908 */
+	"ogarshainqlj", "ogcrf", "ogcsrgtqspa", "ogcxfzgdxcib",	/* 10912 */
+	"ogdbkhyfbldfg", "ogdlxhpbu", "ogdwqnuqdpx", "ogehxgdakjv",	/* 10916 */
+	"ogfiurvros", "ogi", "ogina", "ogjab",	/* 10920 */
+	"ogje", "ogjsbu", "ogkgfagwv", "ogkutdhq",	/* 10924 */
+	"oglxguorlt", "oglzzklmgunm", "ogmp", "ogmucgwznfob",	/* 10928 */
+	"ogosuqlgchknp", "ogrlrxpjpgdc", "ogrt", "ogs",	/* 10932 */
+	"ogsvoe", "ogt", "ogtcag", "ogtdrwii",	/* 10936 */
+	"ogzblo", "oh", "ohbiew", "ohcekxmalx",	/* 10940 */
+	"ohcjxdymkgcva", "ohdqfpbvv", "ohffdhxlplzysw", "ohfvzjmwpnvahg",	/* 10944 */
+	"ohgu", "ohgv", "ohheukwqf", "ohikyporb",	/* 10948 */
+	"ohilzklipeaqz", "ohimpwyxjx", "ohivmojwmaryna", "ohjyjqiuntn",	/* 10952 */
+	"ohkwadmxmg", "ohlajsverqwyuq", "ohmpxtonpi", "ohmywtitajqp",	/* 10956 */
+	"ohnsviomhef", "ohoiztlfewp", "ohrtobxfth", "ohu",	/* 10960 */
+	"ohwuvrj", "ohxin", "ohzlmrrgfz", "oi",	/* 10964 */
+	"oia", "oib", "oibpuupofvfueo", "oibzquw",	/* 10968 */
+	"oidwht", "oidyncoe", "oif", "oiioyunrkpi",	/* 10972 */
+	"oiixwivbihzgb", "oijjovvlx", "oimonggudwn", "oip",	/* 10976 */
+	"oipcxloj", "oipf", "oiqlrpgo", "oissipuql",	/* 10980 */
+	"oiudjj", "oiupp", "oivydwhztq", "oiyecxe",	/* 10984 */
+	"oiyrdzpeqtb", "oiyzmjd", "oizpmfhp", "oj",	/* 10988 */
+	"ojaqaejj", "ojbwlcunkxgt", "ojekthqci", "ojembyeixev",	/* 10992 */
+	"ojfnfnkl", "ojfpd", "ojhfqjecbr", "ojl",	/* 10996 */
+	"ojnbe", "ojnic", "ojnrxyeau", "ojnwxmmdystj",	/* 11000 */
+	"ojnywstfyjvsqv", "ojpdphwfz", "ojq", "ojqbvvyhb",	/* 11004 */
+	"ojqly", "ojqs", "ojraorcjujg", "ojrtrzpl",	/* 11008 */
+	"ojszxurg", "ojtirsqbqgwaz", "ojusilluur", "ojvjhhud",	/* 11012 */
+	"ojvli", "ojvyqrmctps", "ojwulydaokvs", "ojwzpcymlrfbzb",	/* 11016 */
+	"ojxjdft", "ojygznngtotgsf", "ojyjaauxbm", "ojyqqwodzbj",	/* 11020 */
+	"ok", "okaee", "okaqbli", "okauvakjpph",	/* 11024 */
+	"okeosbwlh", "okfxwho", "okgaslztdkltxe", "okhrlzeicjfgs",	/* 11028 */
+	"okjpzyka", "okkfwsejqww", "okm", "oknt",	/* 11032 */
+	"okoibqlgh", "okplseiapb", "okqdavbe", "okqjvfxftmmux",	/* 11036 */
+	"okqytbsd", "okrjxwqp", "okrrzztyks", "oksy",	/* 11040 */
+	"okwcvxscol", "okysrylvat", "okyuhtftmk", "okyxbkjn",	/* 11044 */
+	"ol", "ola", "olax", "oldh",	/* 11048 */
+	"olg", "olga", "olhuni", "olktwneze",	/* 11052 */
+	"ollogfefsqlqnr", "olmwncfogj", "olnwaktzliw", "olovlkj",	/* 11056 */
+	"olowdu", "olqifhtfsuz", "olqzdgo", "olsdaq",	/* 11060 */
+	"olsodg", "olueqi", "olunqlsqpfdvw", "olwlbcefjfzr",	/* 11064 */
+	"olx", "olztjtubamwyqv", "olzv", "olzxs",	/* 11068 */
+	"om", "omabyzjgjwh", "omapepx", "omcc",	/* 11072 */
+	"omdnstuvfpamho", "omf", "omfqmlfdpr", "omfsxuphcxiyu",	/* 11076 */
+	"omhhjfxlfqit", "omhvraqulslfan", "omiglnkizlr", "omiiekfhqf",	/* 11080 */
+	"omivhrumeq", "omjzfw", "omkuiiuuhhbs", "ommkrnzmdmpnp",	/* 11084 */
+	"ommqgyccwck", "omnxealjd", "omqy", "omrdspie",	/* 11088 */
+	"omrpv", "omtq", "omtsomnmq", "omuxrkkrvowki",	/* 11092 */
+	"omvc", "omwohhjvfn", "omydtcwabrcjpy", "omzk",	/* 11096 */
+	"omzkoc", "on", "onbrxtmzzned", "onbsjwgahy",	/* 11100 */
+	"onbxwiixcyik", "ondd", "ondhzxal", "ondi",	/* 11104 */
+	"ondugwcidv", "one", "oneesfulsp", "onevjacjaaxxc",	/* 11108 */
+	"onhubtwodqqpwz", "onjat", "onjccolxalhsk", "onjklfyjspfan",	/* 11112 */
+	"onk", "onlfgmpcrp", "onmbtrkadgmh", "onmvqzphwjxoa",	/* 11116 */
+	"onmyje", "onmzdatgnf", "onouivp", "onqsq",	/* 11120 */
+	"onsfvtbnsgxod", "onsgdmvzu", "onsjy", "ontedpasm",	/* 11124 */
+	"ontlfadgdp", "ontpdngiirnixc", "onvjlxkihom", "onwabohvtchh",	/* 11128 */
+	"onwndrvl", "onxap", "ony", "onypxojagz",	/* 11132 */
+	"onyxwieloszirs", "onzhxjt", "onzzszkyxdy", "oo",	/* 11136 */
+	"oobcrgumel", "oofdrsym", "oogpjrcmrt", "oogrpyn",	/* 11140 */
+	"oohdmblwu", "ooi", "ooiktscsnsc", "ooillmq",	/* 11144 */
+	"ooimzikhtz", "ookhxg", "ookqkgoxzim", "oolhqogwpkwuem",	/* 11148 */
+	"oolo", "oom", "oomqszkcwz", "oonjve",	/* 11152 */
+	"oonl", "oooalqbk", "ooocrizlkwn", "oooyxic",	/* 11156 */
+	"oopwhxjqja", "ooqcvadpaxcwrh", "oorlmcqck", "ooswc",	/* 11160 */
+	"ootkwq", "oovk", "oovlnmztdubb", "oowcevpca",	/* 11164 */
+	"oowxuzqdieg", "ooxkiylq", "ooxmrowbsq", "ooydnmpwl",	/* 11168 */
+	"ooz", "op", "opbamvwdsbxq", "opd",	/* 11172 */
+	"opdqgdqxtjfsm", "opeahqvfropa", "opfrrxe", "opgkzplhgqivq",	/* 11176 */
+	"opgqtsqlnxc", "opgsrb", "ophdfqto", "ophngae",	/* 11180 */
+	"opicutbpmsy", "opj", "opmtemi", "opnqzlbpimjqc",	/* 11184 */
+	"opnxv", "opnzbamca", "opp", "oppfswrqyxka",	/* 11188 */
+	"opqnr", "opt", "optssqj", "opttglbwhgdbjx",	/* 11192 */
+	"opukzrwbcs", "opusvknuft", "opvcelbprp", "opvhm",	/* 11196 */
+	"opw", "opxtxyvthb", "opxwmtizwhgxf", "opyfdktaua",	/* 11200 */
+	"opyzecwgvd", "opzfmghfoosg", "oq", "oqarjapgyej",	/* 11204 */
+	"oqcacfrjimvmec", "oqdmwz", "oqepebgwmkuxip", "oqkoejvn",	/* 11208 */
+	"oqleklozgwd", "oqm", "oqmlyxhqeffi", "oqnxan",	/* 11212 */
+	"oqohtkp", "oqousuycy", "oqpihbeus", "oqqvvuxyzburb",	/* 11216 */
+	"oqrzuoxbezd", "oqs", "oqskvaolllluex", "oqswxpyt",	/* 11220 */
+	"oquhlxomuqfmjr", "oquu", "oqvcwwxwtcxr", "oqwzpzkpwrs",	/* 11224 */
+	"oqxhvukgbyzuj", "oqxqhy", "oqzmxboxj", "oqzojqlwd",	/* 11228 */
+	"or", "oradxkxxzr", "orbeafadlnjg", "orcn",	/* 11232 */
+	"orcrupepaijasy", "orcyv", "ordrjabjavqcp", "orecftvghqsn",	/* 11236 */
+	"orewaiv", "org", "orgktobe", "orhh",	/* 11240 */
+	"orhkrk", "orkiizczfdawz", "orkpnindyqcxg", "orly",	/* 11244 */
+	"ornfiwfeg", "orngo", "orniaolajkxe", "ornmp",	/* 11248 */
+	"orppb", "orq", "orrafzy", "oruvrba",	/* 11252 */
+	"orx", "orylcnm", "orz", "os",	/* 11256 */
+	"osaauthigf", "osbzwpylbz", "osczmpjsehsxg", "osdrpgs",	/* 11260 */
+	"osdxid", "osegqvah", "oser", "oseragexkbbxp",	/* 11264 */
+	"osexjzs", "osfaen", "osfhfgntstvc", "osgwvryzmrbk",	/* 11268 */
+	"oshoaohhri", "oshonbepzl", "oshseqivljhr", "oslfcighw",	/* 11272 */
+	"oslry", "osn", "osnhjsvm", "osnocmfnl",	/* 11276 */
+	"ospelevg", "osphlsh", "osq", "osqzdvo",	/* 11280 */
+	"osshlfb", "osssew", "ossxfhooc", "osuiaoo",	/* 11284 */
+	"osuxegqj", "osuy", "osx", "osxsmpjg",	/* 11288 */
+	"osxtcoi", "oszj", "oszrwia", "ot",	/* 11292 */
+	"ota", "otcsufqtw", "otdq", "otdrzakwqruvta",	/* 11296 */
+	"otdxxjvxup", "otfg", "otfxyt", "otgvgmkywoiif",	/* 11300 */
+	"othb", "otign", "otiqdrxpktpvr", "otiuramkmydt",	/* 11304 */
+	"otjjlzc", "otjtcdemxk", "otjvwiihelmdvq", "otlbzbd",	/* 11308 */
+	"otlj", "otlpse", "otmbiz", "otmcbojlyusfej",	/* 11312 */
+	"otmj", "otnd", "otnkqzmtlgmtv", "otokrozwpclf",	/* 11316 */
+	"otpfivqjsyzmtr", "otpgulxresi", "otqi", "otqit",	/* 11320 */
+	"ottejlvpmwflpl", "otttyoug", "ottwitqwibznm", "otuaorxlmkgfr",	/* 11324 */
+	"otucfyliqkkw", "otuibk", "otwdzebqrrbvug", "otwwu",	/* 11328 */
+	"otxbdmny", "otxnnvs", "otyqnusfqbi", "ou",	/* 11332 */
+	"ouavc", "oubu", "oucioy", "oucrjukuun",	/* 11336 */
+	"oucuqoe", "oudffdpzkubrsy", "ouek", "ouelhsxqvvp",	/* 11340 */
+	"oufnih", "oufyjwcj", "oug", "ougnqjmus",	/* 11344 */
+	"ouhu", "oujsnovzt", "oujzit", "oukfu",	/* 11348 */
+	"oulqr", "oulwqsismp", "ouncnncxth", "ounmhpghmdw",	/* 11352 */
+	"ounws", "ounzte", "oupjcyzpw", "oupjx",	/* 11356 */
+	"ourpjub", "oustcskdj", "outjgunwvy", "outmguqg",	/* 11360 */
+	"outvccvepli", "outzhrp", "ouury", "ouvupzo",	/* 11364 */
+	"ouwg", "ouwj", "ouyuxpc", "ouywmcbw",	/* 11368 */
+	"ouyzfwxo", "ouzvtuijz", "ovcfqc", "ovctcvsorst",	/* 11372 */
+	"ovcwziuk", "ovdwvcbza", "ovemzjueiypnv", "ovflelq",	/* 11376 */
+	"ovgmyapoyzx", "ovhofy", "ovix", "ovmkzfcbmymc",	/* 11380 */
+	"ovmqpexjzwc", "ovnrgfzhlkxjcy", "ovqzrvqwahgylz", "ovrfxm",	/* 11384 */
+	"ovrmk", "ovsoeoxfxydk", "ovswrbetarnqf", "ovudbfrknln",	/* 11388 */
+	"ovvjqhq", "ovvpvummkht", "ovvqskhxwymy", "ovwxgkimbp",	/* 11392 */
+	"ovxztydxsjpgl", "ovzesyq", "ow", "owcgfkxj",	/* 11396 */
+	"owdxedse", "owebksw", "owgrtjfmikkjdd", "owi",	/* 11400 */
+	"owif", "owiwr", "owjprnnqxt", "owkoznhzfnix",	/* 11404 */
+	"owkqnwvu", "owmwsak", "ownnv", "ownwmjvemnylzo",	/* 11408 */
+	"owotildpxaqum", "owpgvqoldkykm", "owq", "owqv",	/* 11412 */
+	"owroatfonr", "owsblqs", "owswsfnkgpthub", "owu",	/* 11416 */
+	"owuggdbrbpithq", "owwd", "owwgyft", "owx",	/* 11420 */
+	"owxnexswg", "owxxdxryb", "owymyhltbo", "ox",	/* 11424 */
+	"oxalb", "oxcd", "oxck", "oxdhbxkkmhzxw",	/* 11428 */
+	"oxflwwmmllwo", "oxg", "oxgcbzqgt", "oxghpnihedatr",	/* 11432 */
+	"oxgm", "oxgoypqlgbyt", "oxhasztnl", "oxhgnp",	/* 11436 */
+	"oxhmasmhm", "oxhtlmqctrqx", "oxhxa", "oxi",	/* 11440 */
+	"oxjninvljjunhm", "oxl", "oxnudq", "oxpdjlhdpenb",	/* 11444 */
+	"oxrlcamnuoe", "oxsuxagb", "oxszvyzrnaazoy", "oxvfjogljp",	/* 11448 */
+	"oxvgqgd", "oxvinhqlsts", "oxwrdgbzgut", "oxxmbcrd",	/* 11452 */
+	"oxzq", "oy", "oycmrswbt", "oycqaqgdbva",	/* 11456 */
+	"oydaacbgzzyg", "oyddggizviy", "oydsocytk", "oye",	/* 11460 */
+	"oyenicizsi", "oyeoyckctrw", "oygabdlgxxkou", "oygjpzihpueq",	/* 11464 */
+	"oyjbgdoumcwjxx", "oyl", "oymfsqejnjyxy", "oynlqcsmrozuwy",	/* 11468 */
+	"oynlyzfcfwt", "oyomzncunsjjn", "oyooze", "oyoyrojnwtq",	/* 11472 */
+	"oypjzhy", "oyqmjpoelgzbfm", "oysei", "oysfvky",	/* 11476 */
+	"oysqykeylze", "oytsovkciqqd", "oyujakffvb", "oyumuw",	/* 11480 */
+	"oyvdhtlbc", "oywrevgcvds", "oyxcmlvornz", "oyxmmivcvhdppj",	/* 11484 */
+	"oyxocxel", "oyxxjzkvrrqlrr", "oyyabvllseu", "oz",	/* 11488 */
+	"ozabibqpxugl", "ozbwowqtpjrmnz", "ozbyrv", "ozcgnhtbth",	/* 11492 */
+	"ozcmlajg", "ozd", "ozdkyymhoocm", "ozdvbhjdjuo",	/* 11496 */
+	"ozerliithowpyx", "ozfe", "ozftxcnoeyiu", "ozgvt",	/* 11500 */
+	"ozhnrqola", "ozi", "ozivppllilueyc", "ozjcm",	/* 11504 */
+	"ozkcbjgkbw", "ozlaiqs", "ozlsywvascx", "ozmdbtkookoiz",	/* 11508 */
+	"ozmhkh", "ozmod", "ozoavtwko", "ozot",	/* 11512 */
+	"ozqxpdy", "ozqyftqjew", "ozt", "oztfgiu",	/* 11516 */
+	"oztgyxr", "ozud", "ozvkymqrnt", "ozvlb",	/* 11520 */
+	"ozvuc", "ozxzbmcaq", "ozyfmupsfb", "ozyuck",	/* 11524 */
+	"ozzgemmgp", "pa", "pabajrdy", "pacbsi",	/* 11528 */
+	"padxxpyc", "paebvqy", "paexx", "pafio",	/* 11532 */
+	"paflavewbrqbg", "pah", "pahoflbr", "pajbkmujawwww",	/* 11536 */
+	"palftgskujj", "paljcztwiimq", "pallo", "palwwnkixjj",	/* 11540 */
+	"pam", "pamlxwrdslce", "panokfhppkc", "papcev",	/* 11544 */
+	"paqdxzwz", "paqmung", "par", "paranof",	/* 11548 */
+	"parhgtb", "pasgcl", "pavczo", "pawrkng",	/* 11552 */
+	"paxqvsmv", "payax", "paygftuxzzk", "paywjsipddwa",	/* 11556 */
+	"pazpdizs", "pb", "pbcbmipcogtlnm", "pbcic",	/* 11560 */
+	"pbclnre", "pbcqmc", "pbdqkfaaueud", "pbeebnbvucsj",	/* 11564 */
+	"pbfng", "pbiccehmw", "pbikmnljtn", "pbisaw",	/* 11568 */
+	"pbisoiswxuigh", "pbjmo", "pbjmuubnukxcp", "pbkhtjfuoblop",	/* 11572 */
+	"pblvfmcplzsefn", "pbpmpux", "pbq", "pbrddfx",	/* 11576 */
+	"pbsim", "pbtpeyjzovns", "pbucerpsegl", "pbupozklfrflav",	/* 11580 */
+	"pbvrilgsisar", "pbvtzk", "pbwbffmrrqgh", "pbwjpch",	/* 11584 */
+	"pbwp", "pbwvn", "pbzqln", "pbzvs",	/* 11588 */
+	"pc", "pcamzlg", "pcazhldqvsffn", "pccr",	/* 11592 */
+	"pce", "pcfeftpcwulrpr", "pcgdfn", "pcgjkokpqji",	/* 11596 */
+	"pcgrqj", "pcjpdjdwbhyr", "pckpbppcyiu", "pcmafyzoepws",	/* 11600 */
+	"pcmyer", "pcnnslmhvjhwbo", "pcojinhhpm", "pcorhk",	/* 11604 */
+	"pcpuaiccnotsey", "pcqzidhdnmedvo", "pcrxnwwhzfan", "pcsrnefbm",	/* 11608 */
+	"pcsuxxzlv", "pct", "pcvp", "pcvzf",	/* 11612 */
+	"pcxkciwzqjv", "pcxue", "pczl", "pcznhbnpjs",	/* 11616 */
+	"pd", "pdas", "pdbkfyrfcz", "pdbtmo",	/* 11620 */
+	"pdeilidi", "pdeuoqrxswq", "pdgcf", "pdhacxffhaxqy",	/* 11624 */
+	"pdhhfjuibakca", "pdhqlposdpednl", "pdisr", "pdkjczbbgxfho",	/* 11628 */
+	"pdkkuuwkge", "pdkqqakolbkwi", "pdkyx", "pdlxsbfpbq",	/* 11632 */
+	"pdmnbmcqvqrsn", "pdpcuxlvxfqz", "pdqhtxuxinlz", "pdqwguw",	/* 11636 */
+	"pdrggm", "pdrvttmymjlv", "pdsqlaxmlgehi", "pdxcksyprudwgq",	/* 11640 */
+	"pdxlaotacr", "pdxwwwmxhztqc", "pdxyhf", "pdzjekolhpwq",	/* 11644 */
+	"pe", "peaidclwr", "pebpfj", "pecl",	/* 11648 */
+	"peconvslalzhtn", "pedunp", "pefvqrp", "pefy",	/* 11652 */
+	"pegqnvdrnkbl", "pegtg", "pehkqqxljrtxo", "pejhvtn",	/* 11656 */
+	"pelsmhncdt", "penbinsusvrkml", "peprbvi", "peprvbs",	/* 11660 */
+	"pequrywajt", "peqwcksif", "pesdbi", "pesfxq",	/* 11664 */
+	"pevqsjyibwgqmw", "pewjigxscutuw", "pexdwtn", "pezj",	/* 11668 */
+	"pezx", "pf", "pfa", "pfbjizhgdbnyof",	/* 11672 */
+	"pferaxitobtxm", "pffdusls", "pfhhpxcb", "pfhpsnsk",	/* 11676 */
+	"pfjabsraxfus", "pfjntovtjintj", "pfknh", "pfko",	/* 11680 */
+	"pfmlnwqqjdsq", "pfpllcthkijkn", "pfpmy", "pfqqi",	/* 11684 */
+	"pfrjkjr", "pfrreuopav", "pfthsd", "pftslfyzd",	/* 11688 */
+	"pfuooo", "pfwmeokddzy", "pfxmynjehiiig", "pfysqrnxzyvz",	/* 11692 */
+	"pfzvbfwgrznswn", "pg", "pgaepot", "pgcb",	/* 11696 */
+	"pgctnqcob", "pgdshs", "pgg", "pggmjm",	/* 11700 */
+	"pggzvmwv", "pghjtgessxjll", "pgjfwjmtzsike", "pgjhetz",	/* 11704 */
+	"pgjxrgxo", "pgl", "pgmihmapclairj", "pgnaanxkxmpgr",	/* 11708 */
+	"pgnwix", "pgohoixp", "pgokaoayznaylw", "pgomdid",	/* 11712 */
+	"pgpogcphqcnrkl", "pgptlowdndnos", "pgrazryqm", "pgsbhlkxlymp",	/* 11716 */
+	"pgtrrieaddqb", "pgtu", "pgus", "pgv",	/* 11720 */
+	"pgykpewcqi", "pgyqkeyaaanow", "pgzx", "ph",	/* 11724 */
+	"phafpwphdzkb", "phalafjeii", "phcgidb", "phfmyqgpav",	/* 11728 */
+	"phg", "phizonwetiwo", "phkgjks", "phkl",	/* 11732 */
+	"phlxssgzjfoyxy", "phnuyxpc", "phpkb", "phqiuvtfcovz",	/* 11736 */
+	"phr", "phrq", "phssrvklzwhwbi", "phtuhdmefyz",	/* 11740 */
+	"phtz", "phucqpnzz", "phuifeok", "phuvfvommh",	/* 11744 */
+	"phvpvpzpufnoye", "phxdok", "pi", "piavf",	/* 11748 */
+	"pibilqzyoyo", "pibojwdlcbo", "picuttqwtkuix", "pidvnqxvdyhisu",	/* 11752 */
+	"pidxtbtbdla", "piesoaut", "pifv", "pihoxlbumjjq",	/* 11756 */
+	"piimcmwpesog", "piizagzd", "pijk", "pikbixhyugnsj",	/* 11760 */
+	"piowvirbeezg", "pipoqctaqzomwg", "pirqcanzhqdlj", "pitqlgogilszjt",	/* 11764 */
+	"piuusxswh", "piuwinsptbjqz", "pivzhehfcimg", "piwsheqtfni",	/* 11768 */
+	"pixfr", "pixmforb", "pixrqn", "pixztvq",	/* 11772 */
+	"piywlqahptaqo", "pizud", "pj", "pjacokiz",	/* 11776 */
+	"pjblm", "pjdh", "pjepfiqmenkyk", "pjesnaxezaj",	/* 11780 */
+	"pjintzronk", "pjjhmncqyilter", "pjjzhs", "pjkgupegmwl",	/* 11784 */
+	"pjkvqidzqhuyf", "pjky", "pjmwzksafqe", "pjn",	/* 11788 */
+	"pjo", "pjoooggdsuntm", "pjoqlfk", "pjpnpaewkfhdny",	/* 11792 */
+	"pjql", "pjretbqsh", "pjv", "pjvdsvua",	/* 11796 */
+	"pjvtyxpnlxmwcb", "pjxfdtzhcrn", "pjxwwvd", "pjybykgswgoa",	/* 11800 */
+	"pjyfxyfgtht", "pjzvvfl", "pk", "pkckuarmsji",	/* 11804 */
+	"pkgwat", "pkhh", "pki", "pkij",	/* 11808 */
+	"pkjvviof", "pkmirymgnlcwr", "pkmllrghfufbn", "pkpmwcwzfepf",	/* 11812 */
+	"pkpnoeangl", "pkqeve", "pkrh", "pksjcx",	/* 11816 */
+	"pksmpgbjzhvaii", "pktefe", "pkuggaowljztb", "pkwzohludsjxsv",	/* 11820 */
+	"pkxggv", "pkyozuiteccmst", "pkzwunfljvbvl", "pkzwyzkq",	/* 11824 */
+	"pl", "plalgwzec", "plapadvusvt", "plbihbkrv",	/* 11828 */
+	"plclndfccyzpm", "plcrgarvoiyfz", "pldw", "plfgprgqx",	/* 11832 */
+	"plfmfxoifnizp", "plgbqnhp", "plhtfvuupzbd", "pliwerolvijwo",	/* 11836 */
+	"plj", "plkx", "plnd", "ploymgnkw",	/* 11840 */
+	"plqtxvgzdwzfak", "plqvvdga", "plskcff", "pltrq",	/* 11844 */
+	"plvkoyx", "plwlke", "plydsxwvy", "plyvnfpxv",	/* 11848 */
+	"pm", "pmamrxrxofssl", "pmauvbdytdm", "pmcubjbmx",	/* 11852 */
+	"pmdjqmpjqrtlvz", "pmet", "pmfkc", "pmh",	/* 11856 */
+	"pmjk", "pmlfviaawikn", "pmlnbc", "pmmewnninspoum",	/* 11860 */
+	"pmmjbnaefam", "pmpi", "pmpogwptkhil", "pmpyto",	/* 11864 */
+	"pmrfcwsuo", "pmrfyg", "pmtsvemnbqqvod", "pn",	/* 11868 */
+	"pnaldbl", "pncowzenit", "pncwqngjs", "pndblukjbj",	/* 11872 */
+	"pndr", "pnev", "pnfyhkdyd", "pngauusn",	/* 11876 */
+	"pngauzjiaktgxr", "pngcma", "pnhergezycrm", "pnizpepppfmey",	/* 11880 */
+	"pnjeqrjmisouh", "pnjwwgz", "pnmfvdrndv", "pnovjpkvkoz",	/* 11884 */
+	"pnpjvhg", "pnpko", "pnppzgteg", "pnpshkfgiozla",	/* 11888 */
+	"pnpyfpx", "pnqkck", "pnulm", "pnvhblfuq",	/* 11892 */
+	"pnwywhys", "pnxkihkjkywpmt", "pnycklgcgtnz", "pnyfvuqkpgb",	/* 11896 */
+	"pnyjadbbsmnw", "po", "poafllvuzayrp", "poblhzfacfx",	/* 11900 */
+	"poblrlglouacw", "pocbhldcfpfnyl", "poddhutbxkw", "podqs",	/* 11904 */
+	"podrbdhlz", "podznbjszwd", "poezkmveeadwnp", "pog",	/* 11908 */
+	"poijlqj", "pokejv", "poktcydtystm", "pollblw",	/* 11912 */
+	"polymbioabjx", "pom", "ponsmjyiamyhpb", "pooljigrf",	/* 11916 */
+	"pop", "popyknvaers", "posazhkalyr", "posevvnl",	/* 11920 */
+	"potdofhyrkt", "potiuauqkndwr", "potkglfbskl", "potm",	/* 11924 */
+	"pou", "poudr", "poumsy", "poupgwjec",	/* 11928 */
+	"pourtweq", "pousidkkcos", "poxdslncfzxac", "poxdtd",	/* 11932 */
+	"poyv", "pozboazhaiy", "pozxvkwuuyby", "pp",	/* 11936 */
+	"ppargdqv", "ppc", "ppdo", "ppdztooone",	/* 11940 */
+	"ppfdbetrpfu", "ppgkem", "ppgyenrvw", "pphnurggrtlz",	/* 11944 */
+	"ppiqbypyt", "ppmtxyhxu", "pppkdslmonyim", "ppptwbm",	/* 11948 */
+	"pppwq", "pprcilfiojrl", "pprersxa", "pprs",	/* 11952 */
+	"ppslejrsbc", "ppud", "ppulxbpdkutvlg", "ppwpwbte",	/* 11956 */
+	"ppxnblseyviwo", "ppyolrypie", "ppyqfsi", "ppzeyerd",	/* 11960 */
+	"ppzwxigmjr", "pq", "pqaacubzcko", "pqbsnsgjnxg",	/* 11964 */
+	"pqekbofk", "pqerdcilaemj", "pqgpjk", "pqhlo",	/* 11968 */
+	"pqhwzn", "pqiew", "pqjlo", "pqkepxjnpt",	/* 11972 */
+	"pqkgqjlpxkbm", "pqlbul", "pqlnvfcaan", "pqmdhwdatxkq",	/* 11976 */
+	"pqmfgwryf", "pqmtsphrne", "pqmzmvkwpdqb", "pqnljwxjqy",	/* 11980 */
+	"pqozrhecg", "pqpimofkfksn", "pqqjko", "pqqrizpigpunqj",	/* 11984 */
+	"pqqsceq", "pqseuc", "pqsjtf", "pqslvyy",	/* 11988 */
+	"pqv", "pqvnibaagaob", "pqxjyklxyojwf", "pqxlaucv",	/* 11992 */
+	"pqxzkisb", "pqzczwbernr", "pr", "prazg",	/* 11996 */
+	"prbc", "prbnduzfmul", "prcbfgp", "prcellhwvy",	/* 12000 */
+	"prdqhiyzgh", "prekoa", "prf", "prfdenrjof",	/* 12004 */
+	"prgkrzvrdxkw", "prgoaixxxbe", "prgphxiw", "prgunnsis",	/* 12008 */
+	"prhuswxju", "prhxoox", "pri", "priohfws",	/* 12012 */
+	"prjcgs", "prkrxszn", "prn", "prpsyzxmyg",	/* 12016 */
+	"prpttp", "prqaewnwvb", "prqoiuzqfprk", "prsi",	/* 12020 */
+	"prud", "prudmo", "prupbfdhdtgegq", "prvuc",	/* 12024 */
+	"prw", "prwkkrxefpdrhl", "prygclfzg", "ps",	/* 12028 */
+	"psbviy", "pscucqgwnwq", "pscwxgsruo", "psczhlqhxq",	/* 12032 */
+	"psdat", "pse", "pseall", "psekewjvolgi",	/* 12036 */
+	"psfhlgraeh", "psgawgwrvi", "pshgrr", "pshuspeovf",	/* 12040 */
+	"psizhwsxkl", "psknqw", "psloe", "psmgw",	/* 12044 */
+	"psnlau", "psok", "pspddjlehsqe", "pspyic",	/* 12048 */
+	"psqf", "psqtiqcvlkx", "pstrehbrzj", "psuximccpsnbda",	/* 12052 */
+	"psw", "psyoax", "psyynkx", "pt",	/* 12056 */
+	"ptchpkol", "ptetd", "ptfxkadnjtdny", "ptgdqayyrjn",	/* 12060 */
+	"ptid", "ptivbhvrshdrhu", "ptjeqvky", "ptlauthnmpsew",	/* 12064 */
+	"ptljlr", "ptlrenyey", "ptnpwfhazwru", "ptnxhtq",	/* 12068 */
+	"ptny", "ptozkwmuah", "ptp", "ptpunqgd",	/* 12072 */
+	"ptpwzmjdikztky", "ptqzwequw", "ptsxgh", "pttftdnomxlg",	/* 12076 */
+	"ptu", "ptwegwdk", "ptwyxds", "ptwza",	/* 12080 */
+	"ptxdvlwskkp", "ptxyjbtb", "ptyunlqfeunpwx", "pu",	/* 12084 */
+	"pubdhplhwknt", "puckv", "puemex", "puexcarw",	/* 12088 */
+	"pufoqvnxdzpb", "pugjailfeqor", "pugozxnezuwbyg", "puhunvmfzpsfsp",	/* 12092 */
+	"puibvqrlwltk", "puiijkw", "pujktmp", "pukcgpunick",	/* 12096 */
+	"pukclfuxxd", "pulzdrpmpkela", "pumfpact", "pumrlblel",	/* 12100 */
+	"punaahs", "puneoxixy", "pup", "pupeejb",	/* 12104 */
+	"puqqbfb", "puqz", "puribu", "puuuw",	/* 12108 */
+	"puvfz", "puwhtmhniv", "puwhuwv", "puwmvqavvmsr",	/* 12112 */
+	"puwufehzjqji", "puxog", "puzgughzgl", "pv",	/* 12116 */
+	"pvamz", "pvaqt", "pvatao", "pvbkzotkwr",	/* 12120 */
+	"pvbprygkwvmpbr", "pvcefr", "pvcmgltldqrgeu", "pvcmqp",	/* 12124 */
+	"pvdgstzgluoct", "pveadii", "pveizpvxacf", "pvgfhnow",	/* 12128 */
+	"pvgq", "pvhsulj", "pvi", "pvioqw",	/* 12132 */
+	"pvkryodyeobhy", "pvl", "pvldewqvder", "pvlepkj",	/* 12136 */
+	"pvls", "pvntz", "pvooarfhxibe", "pvpogrtbmkp",	/* 12140 */
+	"pvqiktawhwlit", "pvrmxm", "pvshtetcmfop", "pvtbziwo",	/* 12144 */
+	"pvvnjcwtpddyz", "pvxmp", "pvyshkrfh", "pvzocvtdjgv",	/* 12148 */
+	"pvztzarijmzsxh", "pw", "pwaw", "pwbdyydad",	/* 12152 */
+	"pwbsxru", "pwcpsnbvsjnvgl", "pweiwmt", "pwfubwdqtrcau",	/* 12156 */
+	"pwhxqtfwsoxwoz", "pwhzthdrlfdybw", "pwijfuu", "pwjw",	/* 12160 */
+	"pwkakqdrco", "pwlfhbjuorrotj", "pwln", "pwloyszocgeatk",	/* 12164 */
+	"pwofit", "pwognqup", "pwqefaqvo", "pwqi",	/* 12168 */
+	"pwrddbpmqh", "pwrhz", "pwtvifegj", "pwurtlrc",	/* 12172 */
+	"pwv", "pwwaapjkd", "pwxtsnqqfbtjh", "pwz",	/* 12176 */
+	"pwzjhgt", "pwzjibyb", "pwztxsobuwozl", "pxacvmeembvjkm",	/* 12180 */
+	"pxapbjw", "pxbcq", "pxbqvqeiookxti", "pxc",	/* 12184 */
+	"pxd", "pxe", "pxeosngcnttqqz", "pxfmbcsgkbqx",	/* 12188 */
+	"pxgmsplaz", "pxkopdprgslnnn", "pxmgjhsygoay", "pxnonvv",	/* 12192 */
+	"pxpishfuyejobi", "pxrfvgckopyoi", "pxrjfrafzf", "pxrzsynvyjti",	/* 12196 */
+	"pxsbwrtofdb", "pxshdtqag", "pxtcvu", "pxujfzyoqvsm",	/* 12200 */
+	"pxuzbxdxmse", "pxvwjri", "pxx", "pxxxe",	/* 12204 */
+	"pxyjtft", "py", "pyabmuwnx", "pycnsyfumuakv",	/* 12208 */
+	"pycoqty", "pydm", "pydmqvqgjpde", "pydslwzhmoyxk",	/* 12212 */
+	"pyhdebyxeuuey", "pyihvpfung", "pyiveybh", "pyizjd",	/* 12216 */
+	"pylwsuk", "pym", "pymbudjwx", "pymsizhplbg",	/* 12220 */
+	"pyqynxfldiny", "pyrrqunupklckx", "pysftfp", "pysnwg",	/* 12224 */
+	"pyta", "pyugqhe", "pyvedlwpgiolpb", "pyvsdossl",	/* 12228 */
+	"pywceyvkcv", "pywtp", "pyx", "pyxoprpo",	/* 12232 */
+	"pyy", "pyzqcluu", "pyzqlqoir", "pz",	/* 12236 */
+	"pzadeyr", "pzcrldhbutrvo", "pzdxap", "pzhledvoqlymv",	/* 12240 */
+	"pzi", "pzkohqdnc", "pzmedac", "pznaxdel",	/* 12244 */
+	"pznnnyltxpy", "pzokmgtskhl", "pzowzggybno", "pzp",	/* 12248 */
+	"pzperk", "pzpi", "pzpwqh", "pzqrkxpjhtgkbc",	/* 12252 */
+	"pzrgdcgysj", "pzsdqhyp", "pztcqgoud", "pztsh",	/* 12256 */
+	"pzum", "pzyiszckgu", "pzykfzabuua", "pzzyxiyfp",	/* 12260 */
+	"qa", "qadpkakhyfbc", "qafkcvvj", "qaglmkihuy",	/* 12264 */
+	"qagxdlxbuwo", "qaijanprnt", "qainvcgfvicnc", "qajhkxdac",	/* 12268 */
+	"qajtsicehihv", "qakdannoknptug", "qakimksajaxp", "qakltzdtei",	/* 12272 */
+	"qakwztjvj", "qalejfjse", "qalorb", "qalwmzo",	/* 12276 */
+	"qalz", "qaniyxjnemzdl", "qap", "qaprbshj",	/* 12280 */
+	"qaqgunkyhsfivw", "qarkztjw", "qaryrygdavpjt", "qasmczznj",	/* 12284 */
+	"qatfyfrwvksp", "qaultsx", "qawzz", "qazdoviwkm",	/* 12288 */
+	"qazlbcfonfy", "qazwfrpgbrwsvk", "qb", "qba",	/* 12292 */
+	"qbcgtvn", "qbchpbpwrtka", "qbdh", "qbdyocjvmyt",	/* 12296 */
+	"qbhrwram", "qbiffesik", "qbilmlymlm", "qbiqdxsnc",	/* 12300 */
+	"qbkdy", "qblvxed", "qbntk", "qbqhteauxq",	/* 12304 */
+	"qbqtzphjfreh", "qbrzhhohb", "qbsaudboeggy", "qbso",	/* 12308 */
+	"qbux", "qbvtpu", "qbvtxkxvj", "qbzbe",	/* 12312 */
+	"qbzvj", "qc", "qcaihkhr", "qcciemi",	/* 12316 */
+	"qccscrdjan", "qcczmper", "qcezkdv", "qcffvho",	/* 12320 */
+	"qcfqeiuc", "qcfqulednqyb", "qcfu", "qcgtver",	/* 12324 */
+	"qch", "qci", "qcieqzvijbgam", "qckvbis",	/* 12328 */
+	"qckyrztal", "qcnaqutookfnf", "qcomcuqiw", "qcor",	/* 12332 */
+	"qcpxuno", "qcrlalglgsqp", "qcsfibea", "qcsl",	/* 12336 */
+	"qcv", "qcvnzofobdq", "qcvpdtglsmuyo", "qcwlfsp",	/* 12340 */
+	"qcxvqpkwzlv", "qcydipugx", "qcyfrk", "qd",	/* 12344 */
+	"qdasrtjsc", "qdauovhpvtjml", "qdb", "qdbscnz",	/* 12348 */
+	"qdbx", "qdclliqlu", "qddnyzjlapm", "qddpck",	/* 12352 */
+	"qdds", "qdfloiagrwsaau", "qdfzvmf", "qdhl",	/* 12356 */
+	"qdi", "qdje", "qdjjug", "qdjqi",	/* 12360 */
+	"qdk", "qdkzkssyqxv", "qdldsqldzgjao", "qdllexos",	/* 12364 */
+	"qdltxxxkh", "qdmtiz", "qdntphfo", "qdnykynjzczlc",	/* 12368 */
+	"qdorkxgbixcl", "qdq", "qdr", "qdsrlskli",	/* 12372 */
+	"qdswp", "qdtezzjj", "qduzifmxubo", "qdvepsc",	/* 12376 */
+	"qdwmtxbqpmycc", "qdxnqrkygunyvl", "qdystwwupmknr", "qdyxkikvafipd",	/* 12380 */
+	"qdzguu", "qe", "qeamhjru", "qeatsnmlzrieki",	/* 12384 */
+	"qeaxrytsyp", "qebxhnqctqtak", "qecblpk", "qeeepnktdqbsyo",	/* 12388 */
+	"qeeixn", "qefdk", "qefii", "qefrwbfgu",	/* 12392 */
+	"qehejmttipdrn", "qeheuugvjjkeif", "qehia", "qehtrcjrvcta",	/* 12396 */
+	"qeizryf", "qej", "qejqpgyvz", "qem",	/* 12400 */
+	"qemdtmlhadg", "qemnokue", "qeni", "qenie",	/* 12404 */
+	"qenpfsbeqdus", "qensnnqkp", "qeocdbcu", "qeojhntcifsn",	/* 12408 */
+	"qepu", "qer", "qeshrgknxogas", "qesipdt",	/* 12412 */
+	"qetzxzjwyp", "qeurti", "qewc", "qewusnpi",	/* 12416 */
+	"qewxbxexiuws", "qex", "qexqxglxgmwi", "qexsycayecmv",	/* 12420 */
+	"qeyrzrjfowacqy", "qf", "qfat", "qfbnhivqogb",	/* 12424 */
+	"qfbxtrptb", "qfccmx", "qfdggixtgretw", "qffhoettytyjsk",	/* 12428 */
+	"qffouomn", "qfgvhxlhner", "qfhbup", "qfhlsgm",	/* 12432 */
+	"qfhrn", "qfirqnpmxt", "qfizf", "qfjvbyarirprg",	/* 12436 */
+	"qfjzrygkzyv", "qfkjrx", "qflitgzztzwxv", "qfojwncqxtgnk",	/* 12440 */
+	"qfonsutqkwhh", "qfp", "qfpp", "qfqifem",	/* 12444 */
+	"qfqrqfofrnw", "qfqzrpcyx", "qfrcq", "qfrdtvorgf",	/* 12448 */
+	"qfrkjt", "qftok", "qfu", "qfuydahfnzgp",	/* 12452 */
+	"qfv", "qfwotql", "qfxgwnvdsxscas", "qfxwoo",	/* 12456 */
+	"qfy", "qfzhch", "qfzhrjyyh", "qfzj",	/* 12460 */
+	"qg", "qgamdorp", "qgbvfhlhi", "qgdxollxb",	/* 12464 */
+	"qgfcogiyggsj", "qgfelq", "qggdgybzb", "qgghts",	/* 12468 */
+	"qgievn", "qgijdnoqs", "qgimdnliwz", "qgiwipklrco",	/* 12472 */
+	"qgjtkpbkr", "qgk", "qglqavmsnmkt", "qglxo",	/* 12476 */
+	"qgmhzmnhsgcxgi", "qgod", "qgotqnxwjwfot", "qgpfcowfrkahi",	/* 12480 */
+	"qgrwagyhvzn", "qgspcpptm", "qgtqpgv", "qgwembfgn",	/* 12484 */
+	"qgwomcxacjxto", "qgxxzxjzorz", "qgytarrjv", "qgz",	/* 12488 */
+	"qha", "qhax", "qhbsrzcbjoha", "qhcuzwqi",	/* 12492 */
+	"qhdgrcnanasip", "qhefovbz", "qheyd", "qhgru",	/* 12496 */
+	"qhhdov", "qhhoy", "qhhqlqv", "qhiavphubb",	/* 12500 */
+	"qhinfob", "qhj", "qhjbnantco", "qhjcwrfalomcl",	/* 12504 */
+	"qhjunwzs", "qhjwrbcsimuil", "qhklpmbhfizc", "qhkmwktq",	/* 12508 */
+	"qhlm", "qhlqssf", "qhmuqmv", "qhmwxttofqr",	/* 12512 */
+	"qhnudu", "qhoexz", "qhoigcw", "qhperrkql",	/* 12516 */
+	"qhpr", "qhqcovlhx", "qhromdewiafptd", "qhscl",	/* 12520 */
+	"qhshludle", "qhtiyg", "qhtrmzjefgqcg", "qhtsrtlxq",	/* 12524 */
+	"qhtxexcmmw", "qhu", "qhvaxdmpoyzxw", "qhvdk",	/* 12528 */
+	"qhwdnvwgf", "qhxnnwdu", "qia", "qiafsza",	/* 12532 */
+	"qiaglsynd", "qiawroweoqqls", "qibajpm", "qibirki",	/* 12536 */
+	"qibmqdhtatph", "qicmorww", "qifdhxbns", "qifeberbrlb",	/* 12540 */
+	"qifvspn", "qihdstoaueyl", "qihi", "qihq",	/* 12544 */
+	"qiih", "qiivxxhnwryyge", "qikbxmvhx", "qimfvclel",	/* 12548 */
+	"qimhgstcrvdpez", "qimwchahiev", "qinxlz", "qinyxw",	/* 12552 */
+	"qipwglwy", "qiq", "qiqhorwvbqwjui", "qirz",	/* 12556 */
+	"qisaivteuluwaf", "qitbbki", "qiubuzwqtbhr", "qiytpojiwgsk",	/* 12560 */
+	"qizl", "qizowkkpfrhc", "qizpwnp", "qj",	/* 12564 */
+	"qjcboehyh", "qje", "qjeafpyjwfxbcb", "qjeekwdosmrib",	/* 12568 */
+	"qjefdgct", "qjfmcrlknf", "qjgl", "qjgmbknsw",	/* 12572 */
+	"qjgrnz", "qjhkpcwhbodii", "qjjtnqoxeqmk", "qjjtpcnhwgpd",	/* 12576 */
+	"qjkciauev", "qjmkenuzpe", "qjnoyaneoqkxa", "qjo",	/* 12580 */
+	"qjowuo", "qjqhbu", "qjqsdn", "qjqtguklkgh",	/* 12584 */
+	"qjrdkbkeixgo", "qjrmmvykipca", "qjtgglnoied", "qjuwzbg",	/* 12588 */
+	"qjvcbtvqdpc", "qjvisbz", "qjwkwkevaudi", "qjwtbznn",	/* 12592 */
+	"qjyazetsoljwsd", "qjyeqndbkumyqa", "qjyohmusk", "qka",	/* 12596 */
+	"qkbgcqtig", "qkbvs", "qkddjpdwtccx", "qkdjt",	/* 12600 */
+	"qkeffkpvwcmgvz", "qkfmtbopdukgc", "qkfzpxbrkgdywe", "qkgrof",	/* 12604 */
+	"qkgvmxm", "qkhlbxyor", "qkilbamgpavvmr", "qkipbgfibj",	/* 12608 */
+	"qkj", "qkjmitmarn", "qklakh", "qkmewsfdo",	/* 12612 */
+	"qkmqqrmhu", "qkmrvghobgp", "qkofiajomdt", "qkosjkceddv",	/* 12616 */
+	"qkpubpugr", "qkqnnmenpidn", "qkqu", "qkrmnuycqbqd",	/* 12620 */
+	"qkrqrtittz", "qkv", "qkvgxbxfnmwdgb", "qkvl",	/* 12624 */
+	"qkxdsyiacumtm", "qkxsnvjgu", "qkxyjnrphg", "qkzieb",	/* 12628 */
+	"ql", "qlbnrsi", "qlcayxiflbc", "qlclvdeid",	/* 12632 */
+	"qldcaohyqtol", "qldoruigypnth", "qldtkgledygdf", "qlewmosyxacxvn",	/* 12636 */
+	"qlgcaam", "qlgupjm", "qlh", "qlineqwajmrvi",	/* 12640 */
+	"qlno", "qlpgeerwuhqxqk", "qlpiudpajt", "qlqdnt",	/* 12644 */
+	"qlsbfnh", "qlwcwh", "qlxa", "qlysuspbzhuw",	/* 12648 */
+	"qlzrkpcz", "qm", "qmbplulg", "qmeiq",	/* 12652 */
+	"qmiyafjqyitnsc", "qmjfwha", "qmjwqj", "qmna",	/* 12656 */
+	"qmneryjnhe", "qmnynga", "qmpem", "qmq",	/* 12660 */
+	"qmqcbefqq", "qmt", "qmtbutcwieo", "qmu",	/* 12664 */
+	"qmudsuxiykkh", "qmuqrigt", "qmux", "qmvuhhg",	/* 12668 */
+	"qmxaqsdujzy", "qmyfylyfcnqah", "qmzdsapfxys", "qn",	/* 12672 */
+	"qnas", "qnda", "qndkgglzoab", "qndu",	/* 12676 */
+	"qnef", "qnfghdsesqdx", "qnhbdwknbr", "qnikzlrydz",	/* 12680 */
+	"qnksrl", "qnlnat", "qnmj", "qnmoyvbhlixpd",	/* 12684 */
+	"qnnc", "qnndwp", "qnnnwc", "qnphkxbmsaweaa",	/* 12688 */
+	"qnplxeiph", "qnrgxexgjiep", "qnsdosvzt", "qnuttz",	/* 12692 */
+	"qnuxeeexic", "qnwljqtwh", "qnxphmyjkbur", "qnxscqlypmbdgt",	/* 12696 */
+	"qnzsjfdhngfc", "qnztegv", "qo", "qoab",	/* 12700 */
+	"qoablzkhdxhlby", "qoawskmc", "qobcddtwnyix", "qodbrzsspxncd",	/* 12704 */
+	"qofme", "qoftqhvmfckln", "qogcxfqt", "qogmrnyyj",	/* 12708 */
+	"qohmdtbfk", "qoidjpukyt", "qoiyjeikqwlof", "qojhdn",	/* 12712 */
+	"qojyrsws", "qok", "qoklcrqvxjota", "qokuqrrwnow",	/* 12716 */
+	"qolyfmonbp", "qomufixxo", "qonwv", "qooajdbhkbsee",	/* 12720 */
+	"qoqfhyy", "qoqh", "qoqpunhylhou", "qoqtkngzsytr",	/* 12724 */
+	"qorhsxwpabuyxa", "qorlkapmh", "qosjg", "qosy",	/* 12728 */
+	"qouppebhurrkwg", "qovc", "qovczkgmesf", "qoyhx",	/* 12732 */
+	"qoyufeakempczz", "qozaglyx", "qp", "qpcbosxadh",	/* 12736 */
+	"qpe", "qphprcspa", "qphsanvedkclu", "qpiy",	/* 12740 */
+	"qpk", "qplystcu", "qpmhflaufut", "qpmlgqc",	/* 12744 */
+	"qpprdphuc", "qpq", "qpspwkqzfs", "qpssganftmjefo",	/* 12748 */
+	"qptirqtkio", "qptwqbyt", "qpubdtwnu", "qpvtatqlyc",	/* 12752 */
+	"qpwwiyrru", "qpx", "qpyiovzxahd", "qq",	/* 12756 */
+	"qqafd", "qqayotyxnp", "qqbitckezednru", "qqcodnufascqen",	/* 12760 */
+	"qqdrzioewud", "qqdtyk", "qqemuqq", "qqexbj",	/* 12764 */
+	"qqgljj", "qqgnfdkbyuclj", "qqhkauf", "qqjrqkmkqbgnw",	/* 12768 */
+	"qqkhbdqixap", "qqknkmh", "qqlrcskpan", "qqlrhfblx",	/* 12772 */
+	"qqmhqh", "qqmjgx", "qqodtk", "qqptp",	/* 12776 */
+	"qqqdpousqqqg", "qqqqiulowkddx", "qqr", "qqrqyv",	/* 12780 */
+	"qqrzxvravexx", "qqrzzrnwflh", "qqs", "qqusxdkthc",	/* 12784 */
+	"qqv", "qqvxlygwggzv", "qqwdbxkbfz", "qqxd",	/* 12788 */
+	"qqxzgergocsigp", "qqyntvxs", "qqyrnbhixoog", "qr",	/* 12792 */
+	"qrbcoboazvveqf", "qrdsagedhbpkue", "qrdtr", "qrenbnyzvwiq",	/* 12796 */
+	"qrfob", "qrg", "qrgcbgczfjiv", "qrgfjaxsb",	/* 12800 */
+	"qrhmzopnaoxlk", "qrijtwrfphfaw", "qrikfnamwmoi", "qrilhisnajuaag",	/* 12804 */
+	"qriwtage", "qrjzbhc", "qrkmtlxuoxym", "qrlq",	/* 12808 */
+	"qrlsukjdy", "qrmqn", "qrmr", "qrmsq",	/* 12812 */
+	"qrmsqsaf", "qrntjqnehkmpr", "qrpayvbh", "qrq",	/* 12816 */
+	"qrquujpft", "qrrrwmsn", "qrryzxwf", "qrs",	/* 12820 */
+	"qru", "qruhuzbw", "qruwjpjrqtripo", "qruwtjr",	/* 12824 */
+	"qrvgcddbp", "qrvo", "qrwsa", "qrx",	/* 12828 */
+	"qrxbwvajdbqew", "qrxoujjpeawonv", "qrz", "qrzv",	/* 12832 */
+	"qs", "qsadd", "qsakjyibvgte", "qsbmpforivync",	/* 12836 */
+	"qsccpiz", "qsdjfsj", "qsdmcvjqzrbnjq", "qsdtrnijfk",	/* 12840 */
+	"qselrvanhvhmbg", "qsendocksnhfca", "qsenv", "qsfvuxhuaxye",	/* 12844 */
+	"qsfyelq", "qsgt", "qshav", "qsihrqdii",	/* 12848 */
+	"qsjfepyxzxv", "qsjuqzhibb", "qsjwyppfvnpqrs", "qsm",	/* 12852 */
+	"qsmai", "qsnbvbgtqokpc", "qsnwza", "qsqll",	/* 12856 */
+	"qsrjmjcoq", "qst", "qstluaqkk", "qstshteja",	/* 12860 */
+	"qstvxgnjbb", "qsuoxadfpibjw", "qsusls", "qsvksfuxiatjlg",	/* 12864 */
+	"qsvr", "qswjvyuthdzkap", "qsx", "qsxasbwdbwbcdh",	/* 12868 */
+	"qsxzupzbfskuoh", "qt", "qtazlaccdw", "qtdqwsyxktbcw",	/* 12872 */
+	"qtetyy", "qtf", "qtfo", "qtfzyhcnvevb",	/* 12876 */
+	"qtfzzaaxozwbc", "qtgndjiuam", "qtgtidd", "qtgtzcz",	/* 12880 */
+	"qtiqdajz", "qtiznnqnsny", "qtjeelwehxohft", "qtkplynwo",	/* 12884 */
+	"qtlle", "qtllfuxjrhios", "qtndufbadfx", "qtolfdxak",	/* 12888 */
+	"qtp", "qtqwed", "qtsjwvycbqw", "qtspazwyipded",	/* 12892 */
+	"qtxfra", "qtxjmn", "qtxozqddwnd", "qu",	/* 12896 */
+	"quarypykfnyzj", "qubnh", "qubtqiadnjnf", "qucgnys",	/* 12900 */
+	"qudda", "quepb", "quhhgpgdyeeaa", "quhmnbbxxglmky",	/* 12904 */
+	"quklywkdstqxp", "quladmdwtm", "qulxclkz", "qumicwbviusyq",	/* 12908 */
+	"qumrhqrkiiu", "qumsnvnag", "qunfufh", "qunhnzbhcjwdwc",	/* 12912 */
+	"qunytehbvwri", "quogy", "quoyegk", "quqqer",	/* 12916 */
+	"qurdfymrzeigp", "qutbqelgzugi", "qutdbtk", "qutwsbcmx",	/* 12920 */
+	"qutzvu", "quzqj", "quzsj", "quzvlkudfmbitw",	/* 12924 */
+	"qv", "qvaesil", "qvaifi", "qvanhohqdkt",	/* 12928 */
+	"qvaxweaf", "qvbqxyinoo", "qvccxum", "qvdagjav",	/* 12932 */
+	"qvdemebihmvdr", "qvdjpibiwfoueb", "qveyfrrbqg", "qvfkl",	/* 12936 */
+	"qvgvqruz", "qvleelzbiiadhy", "qvm", "qvmlsyt",	/* 12940 */
+	"qvnwldd", "qvoctk", "qvolrib", "qvpgmiqu",	/* 12944 */
+	"qvpvfe", "qvrbjdajn", "qvrfzhufnzh", "qvsnkbelv",	/* 12948 */
+	"qvtdiwl", "qvtmnrgiwdfxcj", "qvvk", "qvwfkzvor",	/* 12952 */
+	"qvwfzau", "qvyln", "qvymytt", "qvyody",	/* 12956 */
+	"qvyovxq", "qvyygzfqoi", "qvzfiagsbhr", "qvzujdqexqx",	/* 12960 */
+	"qvzypug", "qw", "qwadw", "qwarctividyac",	/* 12964 */
+	"qwbgvtuo", "qwccgbs", "qwcfskyrlw", "qwegz",	/* 12968 */
+	"qwemhxbtzuf", "qweyib", "qwfkjpp", "qwftdokzdov",	/* 12972 */
+	"qwgc", "qwiaqls", "qwivncdbe", "qwj",	/* 12976 */
+	"qwkaordsymsvn", "qwm", "qwmkkb", "qwmnqhplgl",	/* 12980 */
+	"qwntglrqc", "qwozsbdoj", "qwpgplj", "qwpxv",	/* 12984 */
+	"qwqeyli", "qwrbnmddsb", "qwsxqyjrawudc", "qwvgbtvtxwf",	/* 12988 */
+	"qwwfcyopnt", "qwy", "qwytngrtfykzdd", "qwzpzrudvlcrr",	/* 12992 */
+	"qx", "qxaqrqdg", "qxasyujgbjdy", "qxbw",	/* 12996 */
+	"qxffhzma", "qxfphepnhs", "qxguduaiwp", "qxjezosax",	/* 13000 */
+	"qxjmagp", "qxlcxl", "qxlr", "qxofwzxcrywb",	/* 13004 */
+	"qxq", "qxqnbegaj", "qxrhtllbicm", "qxsbucj",	/* 13008 */
+	"qxscnpsyylp", "qxszcpduq", "qxtd", "qxvir",	/* 13012 */
+	"qxwaordetctchg", "qxwnoqymjxjuar", "qxysrpcfuyxpz", "qy",	/* 13016 */
+	"qybjbclldvqo", "qybkjfgqdeu", "qydldumgppnph", "qydrkwjjrlejk",	/* 13020 */
+	"qyfyrvufqb", "qygepwppzz", "qygovaxyjr", "qygqaie",	/* 13024 */
+	"qygviqqde", "qyjaoebhw", "qyjen", "qyjxsvtni",	/* 13028 */
+	"qykupee", "qylhvdm", "qymid", "qyo",	/* 13032 */
+	"qyokhfgos", "qypnksgwfacqpd", "qypuhr", "qyrzyqidxo",	/* 13036 */
+	"qysslaybyup", "qysv", "qyswnwyjc", "qytyuzqrnoktm",	/* 13040 */
+	"qyudx", "qyvknr", "qyywz", "qyz",	/* 13044 */
+	"qyzrhrqypeyvbf", "qz", "qza", "qzank",	/* 13048 */
+	"qzapxk", "qzbbvncn", "qzbnmdaykpdnv", "qzbtuujofctup",	/* 13052 */
+	"qzcnpybjxyw", "qzcy", "qzdvzlmndejm", "qze",	/* 13056 */
+	"qzfbeiqonbnomw", "qzi", "qzif", "qziqb",	/* 13060 */
+	"qzlhrtcgqpt", "qzliyemicuzw", "qzon", "qzonvuoogtzkx",	/* 13064 */
+	"qzoolsffleb", "qzp", "qzphbmlut", "qzpqcqscpkj",	/* 13068 */
+	"qzptsvrqptvxs", "qzqme", "qzrano", "qzrblnim",	/* 13072 */
+	"qzregtervrqyrp", "qzrpsxttfrpzkt", "qzsdkpxqqnqzj", "qzssnbloagj",	/* 13076 */
+	"qztht", "qzumvskm", "qzuwiffofgfveg", "qzvvqjoylsw",	/* 13080 */
+	"qzwbhfjz", "qzxlpetni", "qzxwscguxme", "qzynaea",	/* 13084 */
+	"qzyuank", "qzzkgpqlxbuso", "ra", "raaai",	/* 13088 */
+	"rabcyrlpbvq", "racrogodl", "racz", "radic",	/* 13092 */
+	"radmeejzayaa", "raekuhdvlhaah", "raet", "rafhv",	/* 13096 */
+	"rafjrppamxwze", "rafxd", "ragljxjmtxg", "rajwbnjkm",	/* 13100 */
+	"rak", "ralqpqlhmtxnuo", "ramdhufev", "ramvgnxaqhyo",	/* 13104 */
+	"ramxbsnaje", "rapwhud", "rascqmf", "rastrwldigddw",	/* 13108 */
+	"ratipsdd", "ratjqnsigzc", "raukksem", "rauzigminkdqs",	/* 13112 */
+	"ravsudjphn", "raw", "raxiu", "raxyflxaeeoof",	/* 13116 */
+	"raz", "razgww", "rb", "rbarmi",	/* 13120 */
+	"rbblprlep", "rbc", "rbcoi", "rbdbgttsitvkci",	/* 13124 */
+	"rbdnyvdhg", "rbdxpmiue", "rbfhyijiyamd", "rbfnnlmhrrmvg",	/* 13128 */
+	"rbfvumbdk", "rbfzgxruhu", "rbgczghwz", "rbguyxzmaazlh",	/* 13132 */
+	"rbieqkjgz", "rbihbd", "rbmaks", "rbnoorrnruc",	/* 13136 */
+	"rbnstjn", "rboapmsuvypk", "rbofhsfvbg", "rbonamlerq",	/* 13140 */
+	"rbpjlqxexzqtr", "rbqdfdyijf", "rbqmzm", "rbqojaghkx",	/* 13144 */
+	"rbsk", "rbtkzassdkwx", "rbvrq", "rbwrv",	/* 13148 */
+	"rbxojlpjatu", "rbxsacagrxj", "rbygr", "rbyjbzycw",	/* 13152 */
+	"rbzevekq", "rbzrpkyatwpphn", "rc", "rcbbprk",	/* 13156 */
+	"rccmcxjh", "rcebdlxk", "rceeynil", "rcfucrozrmni",	/* 13160 */
+	"rcgiur", "rchd", "rchif", "rchmejgvxm",	/* 13164 */
+	"rcizuxhy", "rcjvyxhbya", "rckovi", "rckqq",	/* 13168 */
+	"rcmktn", "rcmrqkydrhmjt", "rcno", "rco",	/* 13172 */
+	"rcoatre", "rcpfdywav", "rcphzuo", "rcpw",	/* 13176 */
+	"rcqyjcblqpjc", "rcrvvjxfcu", "rctmwdzjdrddt", "rcttsstalqeq",	/* 13180 */
+	"rcvslmis", "rcvv", "rcvyugpwbww", "rcwmizmhwmj",	/* 13184 */
+	"rcwntezhwpgg", "rcza", "rczjbh", "rd",	/* 13188 */
+	"rdaco", "rdajvvhkpyo", "rdb", "rdbdoposox",	/* 13192 */
+	"rdcmjwaexcmzfn", "rddigydtj", "rddrcsznqx", "rddsjnawe",	/* 13196 */
+	"rdevecymzaf", "rdfba", "rdhk", "rdhtmwy",	/* 13200 */
+	"rdhzifaaxm", "rdiiyofcrf", "rdintjblpo", "rdipxfniljki",	/* 13204 */
+	"rdkcuqbgamtfc", "rdkhniv", "rdmkcb", "rdn",	/* 13208 */
+	"rdowzeniuchn", "rdp", "rdpasjuizewb", "rdpfg",	/* 13212 */
+	"rdpzrpvkxm", "rdqilfdvsi", "rdrlavaqcwcew", "rdrryhfnntyf",	/* 13216 */
+	"rdsejrjwzvp", "rdsjdwzpikgvma", "rdsrikjklifjtx", "rdtfidgbvve",	/* 13220 */
+	"rdtxcrvicf", "rdxjcr", "rdybj", "rdybuxpw",	/* 13224 */
+	"rdzeoahq", "rdzqy", "rdzsdu", "re",	/* 13228 */
+	"recohfpc", "redb", "redqgsdrphdity", "reegckzjfbptzh",	/* 13232 */
+	"reeghhlw", "ref", "regubqvnrezty", "reh",	/* 13236 */
+	"rejl", "reklpjwoofjk", "relgqpdcfd", "relk",	/* 13240 */
+	"rem", "reowhzqiumer", "repjwr", "rerjfhzmdc",	/* 13244 */
+	"reryaimmtnuoyx", "res", "resicyvofvql", "reudmhk",	/* 13248 */
+	"rewozpedrykpa", "rexmqn", "reye", "rezpnfpzchslx",	/* 13252 */
+	"rf", "rfbymkxvhltf", "rfcfpnjz", "rfdpfstft",	/* 13256 */
+	"rffgkiddiyj", "rffuygsggr", "rfgddehcu", "rfgdpeyvxwt",	/* 13260 */
+	"rfgo", "rfgqxfhnkuclsz", "rfh", "rfhcgpfbvmjae",	/* 13264 */
+	"rfi", "rfitndkcxyyw", "rfjedawevjjvux", "rfkvqdovfilihy",	/* 13268 */
+	"rfl", "rflqbw", "rfoorosvebaugm", "rfr",	/* 13272 */
+	"rfswuhsjmrjisv", "rftzqp", "rfwfrnsly", "rfzipwown",	/* 13276 */
+	"rfztzshegavl", "rfzuysbw", "rg", "rgapeotsr",	/* 13280 */
+	"rgc", "rgcenueozgt", "rgcwpomozs", "rgdkvpg",	/* 13284 */
+	"rgdkwjnxzhwxfi", "rgdnemoac", "rgen", "rgeubuzfdbk",	/* 13288 */
+	"rggkpp", "rgh", "rgingkbqt", "rgjjlsjnlehg",	/* 13292 */
+	"rgmnhsgsrpr", "rgnbplsrgqnpln", "rgndvxtujzv", "rgovvtc",	/* 13296 */
+	"rgp", "rgpeqxnpolp", "rgpjf", "rgqmylws",	/* 13300 */
+	"rgrc", "rgrdvmkrxso", "rgswqmendlbtrw", "rgthb",	/* 13304 */
+	"rgttogtc", "rgud", "rgwovkzix", "rgxnzhmgdkfmv",	/* 13308 */
+	"rgzrvmdyewmntw", "rh", "rhaqfsa", "rhbjpabfc",	/* 13312 */
+	"rhbsjezbsiig", "rheuijn", "rhfc", "rhfp",	/* 13316 */
+	"rhhbtw", "rhhktev", "rhlfcomyrlu", "rhlhvhyoj",	/* 13320 */
+	"rhmqlsloiv", "rhnk", "rhnlwlivk", "rhnnqixfs",	/* 13324 */
+	"rhounoryhkqz", "rhpexvapsx", "rhqiyeqpsawi", "rhskshxxrpmpe",	/* 13328 */
+	"rhsvkwbghxqrm", "rhswdadtvmtdev", "rhtxthdurvzs", "rhuzwqoh",	/* 13332 */
+	"rhvuciadrgooc", "rhzqya", "riaxcmmqsune", "ribmumc",	/* 13336 */
+	"ricakwoqcxmhqx", "ridbsx", "ridi", "rieuezhbbh",	/* 13340 */
+	"rig", "rigxvpjmqyk", "rigyziezbo", "rihl",	/* 13344 */
+	"rikrsqok", "rilepb", "rimlyjzex", "rimmug",	/* 13348 */
+	"rimnccmih", "rimyu", "rinfhymlexaprj", "ripefjnkqmqwi",	/* 13352 */
+	"riqcsmwksx", "risaftdaeci", "risbggjw", "risnga",	/* 13356 */
+	"ritkmbzs", "riugcno", "riujmnm", "rivjvnzrsrdzj",	/* 13360 */
+	"rivxulrakv", "riyqii", "riz", "rjaf",	/* 13364 */
+	"rjbm", "rjci", "rjcqjgwoa", "rjcwtolir",	/* 13368 */
+	"rjfacmgfycp", "rjg", "rjlebdmnqfa", "rjlo",	/* 13372 */
+	"rjlygygnxuyw", "rjnzzkji", "rjoajhkvx", "rjpcytmdyxv",	/* 13376 */
+	"rjqybeppt", "rjrdwkduyytoz", "rjriwpkdgukbaa", "rjsmpgoerzhuno",	/* 13380 */
+	"rjsxjxzlmcai", "rjtwgdbgzqfi", "rju", "rjuf",	/* 13384 */
+	"rjxbb", "rjxefwrearajcv", "rjxfntejv", "rjyayjefqjv",	/* 13388 */
+	"rjygcelpf", "rjyiqwfyhonwmy", "rjzdxj", "rjzojrjls",	/* 13392 */
+	"rjzpz", "rk", "rkacp", "rkafdfflajwts",	/* 13396 */
+	"rkaza", "rkbhylgb", "rkbxmabu", "rkces",	/* 13400 */
+	"rkcmfolqrxblky", "rkcxbdgtm", "rkdiqjv", "rkfblo",	/* 13404 */
+	"rkfggpid", "rkgynlbtncvx", "rkidpb", "rkkb",	/* 13408 */
+	"rkkl", "rklirjv", "rknrg", "rknxf",	/* 13412 */
+	"rkokpc", "rkorbjtsktc", "rkow", "rkr",	/* 13416 */
+	"rkrn", "rkrqz", "rkvhvyscrkss", "rkvkryggwobe",	/* 13420 */
+	"rkvvigqtim", "rkwjsa", "rkx", "rkxdujjaehhg",	/* 13424 */
+	"rkxzmwyxbsvovw", "rkyfzr", "rkzqpktd", "rl",	/* 13428 */
+	"rlavioo", "rlaxjlhmiatk", "rlc", "rldu",	/* 13432 */
+	"rleff", "rlgfiyfdgmrnj", "rlhjcyyfol", "rljhvlrrdoba",	/* 13436 */
+	"rll", "rlljomsjsfuwd", "rllmufhuzgsl", "rlmurnqeowpz",	/* 13440 */
+	"rlnmeww", "rlnnwxxns", "rlopgditqvefaa", "rlpwgrvu",	/* 13444 */
+	"rlpyjs", "rlqscmpemdupgb", "rlrahlcds", "rlrazibgdovf",	/* 13448 */
+	"rlsorzywht", "rltfqmcg", "rltgzfdbirchz", "rltldxklfb",	/* 13452 */
+	"rlvyben", "rlwgd", "rlxdekxmjep", "rlxtbru",	/* 13456 */
+	"rlzaogy", "rm", "rmapfdeet", "rmbhdqr",	/* 13460 */
+	"rmcfyd", "rmcxngyuh", "rmczlzy", "rmdladqggdptln",	/* 13464 */
+	"rmdvzqbv", "rmesusfwqrshqb", "rmeybalbuykgb", "rmfagvq",	/* 13468 */
+	"rmgmiono", "rmh", "rmhbnsfc", "rmhkeplq",	/* 13472 */
+	"rmhwrob", "rmiewtovir", "rmimfxnqe", "rmjhlrrz",	/* 13476 */
+	"rmkeereqqs", "rmlarunonmlrl", "rmlbrbopt", "rmltppkfztym",	/* 13480 */
+	"rmlunumwozsx", "rmmj", "rmmrsycp", "rmritqtpckk",	/* 13484 */
+	"rmrmtssude", "rmrnywwyupx", "rmsudhf", "rmtfwuvdm",	/* 13488 */
+	"rmwrwjcbltscfm", "rmxbedk", "rmzflbi", "rn",	/* 13492 */
+	"rncvamyl", "rnfilsc", "rngpvf", "rnjwnxpg",	/* 13496 */
+	"rnl", "rnltkjyhiewhr", "rnmhahiqw", "rnmkledofqiwbh",	/* 13500 */
+	"rnnh", "rnnjnd", "rnovrcvsue", "rnp",	/* 13504 */
+	"rnrcwrniv", "rnrzclem", "rnsrogo", "rnsrrbtq",	/* 13508 */
+	"rntnwxda", "rnvb", "rnvke", "rnxhrofszc",	/* 13512 */
+	"rnxsczgwmks", "rnydeabmzcg", "rnyszdpepk", "ro",	/* 13516 */
+	"roahckqthj", "roaijxjp", "roc", "rodfxwyfywr",	/* 13520 */
+	"rof", "rogeiq", "rohixqe", "rohkexkuso",	/* 13524 */
+	"roidnxpnttpyq", "rojkjosynpiew", "rojqqscekyj", "rokeitsbr",	/* 13528 */
+	"rokgofadnhpbn", "rolgbcxdd", "rolrkvdlbwtk", "romnq",	/* 13532 */
+	"ron", "roodmeksre", "ropcaeunymedz", "rorbrwszaiqd",	/* 13536 */
+	"rosxsjo", "rotgtbrqpe", "rougpxdtqc", "rovblxcki",	/* 13540 */
+	"rowbipwycwpd", "rowigw", "rowkhm", "rowzoasudv",	/* 13544 */
+	"roybcntagquxl", "royi", "rp", "rpasikvsuulxha",	/* 13548 */
+	"rpbg", "rpbgnvf", "rpbhbop", "rpdannppta",	/* 13552 */
+	"rpeli", "rpfybxx", "rpgtgxi", "rpidjzyjzubf",	/* 13556 */
+	"rpj", "rplla", "rplr", "rpphsxobfyj",	/* 13560 */
+	"rppp", "rpqhojy", "rpqlmk", "rprkvtsxwyw",	/* 13564 */
+	"rprt", "rprtsx", "rps", "rpsgqvhlizfh",	/* 13568 */
+	"rpsidvgacs", "rpt", "rptsmvihadi", "rpuoq",	/* 13572 */
+	"rpxrjc", "rpxtyhnhp", "rpybyr", "rpygs",	/* 13576 */
+	"rpzzicbc", "rq", "rqbaevkzbw", "rqcuvgmgvzz",	/* 13580 */
+	"rqdedrptu", "rqdindxzks", "rqdzf", "rqene",	/* 13584 */
+	"rqfbwgg", "rqfqn", "rqifxocd", "rqifyipaqq",	/* 13588 */
+	"rqioo", "rqjtxqlox", "rqkfixmiza", "rqkpgoi",	/* 13592 */
+	"rql", "rqlkk", "rqlzrzbon", "rqmpffzvzshnm",	/* 13596 */
+	"rqnk", "rqnzmvjyrpeu", "rqoxhighckdnvm", "rqoy",	/* 13600 */
+	"rqsal", "rqssudgbku", "rqsts", "rqsuvoevag",	/* 13604 */
+	"rqt", "rqvnkulga", "rqwakbtywykk", "rqwtqdl",	/* 13608 */
+	"rqwwpnygpqtxwf", "rqx", "rqynyesuwnhboc", "rqyvdnthbjsgfp",	/* 13612 */
+	"rqyxvyr", "rr", "rracuavb", "rrdjligxrmbzc",	/* 13616 */
+	"rrekodifnwlad", "rrfdqa", "rrfhygnzpev", "rrfwbl",	/* 13620 */
+	"rrgnihrnv", "rrgo", "rrgozbhua", "rrgstogebwsq",	/* 13624 */
+	"rrikpwhqma", "rrir", "rrixworkqjpi", "rrjokzmfvmxwx",	/* 13628 */
+	"rrkolprunk", "rrl", "rrm", "rrmgqixullt",	/* 13632 */
+	"rroanxipr", "rroprnxfzbip", "rrorj", "rrpfberja",	/* 13636 */
+	"rrpivqysxn", "rrqg", "rrqypexijdyo", "rrsg",	/* 13640 */
+	"rruqbjkmvc", "rrwodmukldr", "rryohejsgtmels", "rrzxqvs",	/* 13644 */
+	"rs", "rsabltmtneei", "rsbmlpqlkrct", "rsbydsj",	/* 13648 */
+	"rscmveib", "rsexnn", "rsf", "rsfncue",	/* 13652 */
+	"rsgtgiq", "rsgzbuida", "rsh", "rskirpivc",	/* 13656 */
+	"rskoqvkkfgra", "rskotwfagsmmu", "rskpec", "rslppzsqt",	/* 13660 */
+	"rslqevdlqvyy", "rslvjwfou", "rsmnswpwxpzvm", "rsnjqiocbdri",	/* 13664 */
+	"rsoj", "rspghy", "rspkhmnnlvncau", "rsqjrch",	/* 13668 */
+	"rsqqoydefzt", "rsrcwdmdimbcrl", "rsrifk", "rsscnbecxm",	/* 13672 */
+	"rssefmdejg", "rsudlbphlgdmm", "rsvncuvr", "rswkacyewrzpf",	/* 13676 */
+	"rswpiznr", "rswr", "rswrhersdznxnl", "rt",	/* 13680 */
+	"rtaagwkgppx", "rtaeccawducy", "rtakjbvmxbjf", "rtbdtvmp",	/* 13684 */
+	"rtbeyudak", "rtbxoschedjo", "rtczirsg", "rtdjzezpvy",	/* 13688 */
+	"rteyqaaqmu", "rtfttdao", "rtggcuoexcdx", "rtgzq",	/* 13692 */
+	"rthvhgkrung", "rtidentegojd", "rtipzfwculhay", "rtjechzvphore",	/* 13696 */
+	"rtk", "rtlbhrvrea", "rtleezhc", "rtlzaazoxpngf",	/* 13700 */
+	"rtn", "rtnpyhott", "rtonxoqtpzqze", "rtoqrjunkvgpb",	/* 13704 */
+	"rtorlbifg", "rtpgidsh", "rtq", "rtqb",	/* 13708 */
+	"rtrznosqpf", "rtsrjwqryqsl", "rtsuioihurmkos", "rttdm",	/* 13712 */
+	"rtte", "rttewaoz", "rttpumnkpqnflv", "rtvfmcmz",	/* 13716 */
+	"rtyfil", "rtyloofzfuo", "ru", "ruafqrmcy",	/* 13720 */
+	"rubk", "rubodsprjgrx", "ruedmb", "ruffxncodapyul",	/* 13724 */
+	"rufk", "rufxarfyg", "rugzydyh", "ruhenwxgwlphbh",	/* 13728 */
+	"ruhlfgebeiqq", "ruhoxqce", "ruhpzygaindob", "ruirjvxncbc",	/* 13732 */
+	"rukalklhafxq", "rukotnt", "rula", "runzmyjsfkthv",	/* 13736 */
+	"ruo", "rurkcro", "rurxqlcoz", "rusmoryj",	/* 13740 */
+	"rutbrtqe", "ruuf", "ruvlivbl", "ruvymytmpw",	/* 13744 */
+	"ruw", "ruwqogqcbw", "ruyakazckmbklz", "ruzqwanvtmjwi",	/* 13748 */
+	"rv", "rvbior", "rvbiz", "rvbkxcod",	/* 13752 */
+	"rvc", "rvccaifixmjplv", "rvdg", "rvdgsviys",	/* 13756 */
+	"rvdlda", "rvej", "rvgzkyxri", "rvmsmhmao",	/* 13760 */
+	"rvmzh", "rvnvxdivifpzz", "rvqvuayeeg", "rvsaweztfqzig",	/* 13764 */
+	"rvtwbxbeskl", "rvtwlvl", "rvu", "rvuwfizdl",	/* 13768 */
+	"rvxixec", "rvy", "rw", "rwbbrnxqo",	/* 13772 */
+	"rwc", "rwcyemrhdg", "rwekcdw", "rwflpxauxl",	/* 13776 */
+	"rwguqa", "rwhkxdghjs", "rwi", "rwihjonikklsmv",	/* 13780 */
+	"rwixk", "rwj", "rwjiovx", "rwkmbl",	/* 13784 */
+	"rwlgqvfzf", "rwlqdgksnsy", "rwlqegz", "rwm",	/* 13788 */
+	"rwpapzhfjocot", "rwpci", "rwpg", "rwroyhwykpn",	/* 13792 */
+	"rwsoteywk", "rwtbguuui", "rwulowuhptkwa", "rwvhhp",	/* 13796 */
+	"rwxjocyfigxirw", "rwyitr", "rwz", "rx",	/* 13800 */
+	"rxcomq", "rxcunpx", "rxd", "rxfbl",	/* 13804 */
+	"rxfz", "rxhkdzlkshl", "rxidrwxo", "rxkplnrccfhjl",	/* 13808 */
+	"rxlcezmklvn", "rxmkitrsebcsj", "rxmmouu", "rxngrjglwighvx",	/* 13812 */
+	"rxpf", "rxqelhmjzgkhol", "rxqgjtaxihq", "rxrenlqj",	/* 13816 */
+	"rxrvktqxqsez", "rxs", "rxswuhiyibz", "rxumreahbnjyd",	/* 13820 */
+	"rxvbruwoma", "rxw", "rxwbusojcupge", "rxwgvu",	/* 13824 */
+	"rxykeizr", "rxzwtxq", "ry", "rya",	/* 13828 */
+	"ryakvnc", "ryaptckfp", "ryauywdp", "rybjjz",	/* 13832 */
+	"ryblpqhasr", "ryceke", "ryeizabbyh", "ryeyogwmk",	/* 13836 */
+	"ryeyvhyitbtpe", "ryftxiybdbvzee", "ryfwns", "rygkmfigez",	/* 13840 */
+	"ryheehkty", "ryigews", "ryihhakzxrfox", "ryilicoz",	/* 13844 */
+	"ryizfntjl", "ryjalyvtenurbw", "ryjkp", "ryjxdidtgq",	/* 13848 */
+	"ryninxhqrj", "rynpibwh", "rypvmovcxbbc", "rypxcwnyxkh",	/* 13852 */
+	"ryrl", "ryssnm", "rywawo", "rywzff",	/* 13856 */
+	"ryxccjyh", "rz", "rzb", "rzbeyq",	/* 13860 */
+	"rzcbcfgeode", "rzddxw", "rzdi", "rzemhhi",	/* 13864 */
+	"rzfavffmsve", "rzhbo", "rzijbqqtgyuna", "rzkkxm",	/* 13868 */
+	"rzksprkavlndst", "rzlucqnbjeqxh", "rzmcv", "rznofgpzneneqy",	/* 13872 */
+	"rznw", "rzogyawimg", "rzoqvdra", "rzpwiagfol",	/* 13876 */
+	"rzqzlkhghhhogg", "rzrnibqz", "rzrohsucajbzu", "rztbs",	/* 13880 */
+	"rztfhkuyu", "rztrsgqcra", "rztuswu", "rzudheukf",	/* 13884 */
+	"rzupgpyll", "rzvneb", "rzwbmf", "rzxaqjg",	/* 13888 */
+	"sa", "saacsug", "sabszel", "sabwxinuc",	/* 13892 */
+	"sad", "saeaedklxjmfzy", "safboxitw", "safjjxfcei",	/* 13896 */
+	"safr", "sagvsozz", "sah", "sahwakg",	/* 13900 */
+	"salal", "sanroyaztqm", "saoacmdijys", "saorspgx",	/* 13904 */
+	"sapd", "saqqifealm", "sarftjdtuitsg", "sasfkcl",	/* 13908 */
+	"satflwznqtkmdb", "satqrq", "satyhd", "satzyjmk",	/* 13912 */
+	"sau", "saugkyziakhguj", "saumsfogvtaxna", "savmewpq",	/* 13916 */
+	"sawhhxinipncba", "sawz", "saxifwbbpmcg", "saxyg",	/* 13920 */
+	"sayxg", "sb", "sba", "sbalutdt",	/* 13924 */
+	"sbavixy", "sbawilczts", "sbcexx", "sbcivudiov",	/* 13928 */
+	"sbeiekduixw", "sbeusxbrukjz", "sbfwjrhs", "sbhsayzbvrp",	/* 13932 */
+	"sbiqzpyzvh", "sbktpbwzuahib", "sblanyxgtj", "sbllzxmsyqzbg",	/* 13936 */
+	"sblmszlr", "sbmkdtqth", "sbmqegw", "sbn",	/* 13940 */
+	"sbogoqjnvymj", "sbrjaw", "sbrkqymioisicd", "sbtc",	/* 13944 */
+	"sbttzbubdxcqf", "sbvmcm", "sbwsatf", "sby",	/* 13948 */
+	"sbyqguxtsvbc", "sbzewojsepw", "sbzofctev", "sc",	/* 13952 */
+	"sca", "scaxvom", "scb", "scbpcyalce",	/* 13956 */
+	"sce", "scetluzomnrbfe", "scfmzcpv", "schd",	/* 13960 */
+	"schhdhcxjql", "schrhw", "schzpa", "scjdto",	/* 13964 */
+	"sclrdwzevlabxg", "scltmgt", "scmfeqd", "scmwezjk",	/* 13968 */
+	"scnp", "sco", "scohrzpce", "scpye",	/* 13972 */
+	"scqdtjlfihfygf", "scqzpmxon", "scrzbvdz", "scsjbxxmnw",	/* 13976 */
+	"scuaspktojvzoy", "scup", "scvgelekbndr", "scvjjwufyvuj",	/* 13980 */
+	"scvspudppr", "scwdpdysestulu", "scyotaz", "scznilwiyd",	/* 13984 */
+	"sczyxymyxsb", "sd", "sdatowztczbgu", "sdbataa",	/* 13988 */
+	"sdbbqxcpb", "sdctsfsu", "sddfvymunwrdf", "sddtn",	/* 13992 */
+	"sde", "sdgikkszhdzb", "sdhsq", "sdirdhx",	/* 13996 */
+	"sdjup", "sdo", "sdodpstcux", "sdqholzzyhoxwo",	/* 14000 */
+	"sdqqwtgh", "sdrgbrcoc", "sdsknqsihvug", "sdsynwqm",	/* 14004 */
+	"sdtjezrkvxd", "sdupfqujyitt", "sdvboy", "sdwggblfbgplyb",	/* 14008 */
+	"sdwxyltev", "sdxlxwswle", "sdydul", "sdzlmltlqxfti",	/* 14012 */
+	"sdzzwwe", "se", "sea", "sebcbfpknxbodx",	/* 14016 */
+	"secihzweaamzjh", "secjaaqwke", "sedfy", "seepfu",	/* 14020 */
+	"sehkcypjdmnh", "sehunrwt", "seiud", "sejj",	/* 14024 */
+	"sejsicvjb", "sejtnaaj", "sejuetffgpnjtt", "seks",	/* 14028 */
+	"sekz", "semkesn", "semtq", "semvfylkeerwpu",	/* 14032 */
+	"semw", "sennshjnamktv", "senuimxntljtp", "seofi",	/* 14036 */
+	"sepnkiyphezx", "sepsjefduta", "setbmygb", "setck",	/* 14040 */
+	"seuyo", "sevppnywir", "sevwasangz", "seycclsuzqlpoz",	/* 14044 */
+	"seyeothh", "seyrptdr", "sf", "sfatfbolvkff",	/* 14048 */
+	"sfaxokr", "sfazuk", "sfbii", "sfbux",	/* 14052 */
+	"sfbybltofvxo", "sfcqvqiyoj", "sfd", "sfdetkbevtcp",	/* 14056 */
+	"sfe", "sfebgcff", "sfewyoffk", "sfeyxud",	/* 14060 */
+	"sfg", "sfgqtrmkfe", "sfhhqufmdu", "sfix",	/* 14064 */
+	"sfizgnovom", "sflkwhzh", "sflntwruqblrnr", "sfmrchqjb",	/* 14068 */
+	"sfngdcekewr", "sfnpkjsqeli", "sfnrkoztcvk", "sfpm",	/* 14072 */
+	"sfswffnvw", "sfvpko", "sfwekgep", "sfzekzr",	/* 14076 */
+	"sg", "sgai", "sgayrachxdlm", "sgcgbhlismcxi",	/* 14080 */
+	"sgefgu", "sgeskembq", "sgiko", "sgil",	/* 14084 */
+	"sgip", "sgjtvvio", "sgk", "sglzqbazy",	/* 14088 */
+	"sgmibghb", "sgnf", "sgnlvwouw", "sgnvkfiaktk",	/* 14092 */
+	"sgojzcpgxkuvf", "sgokldqew", "sgqfsk", "sgralrklsif",	/* 14096 */
+	"sgrkyczyugdns", "sgsbdulhn", "sgseouw", "sgtpdird",	/* 14100 */
+	"sgvbqxnqljyar", "sgvclnlxpmqgi", "sgvonmjt", "sgvovsmw",	/* 14104 */
+	"sgxbwbeph", "sgxmqaij", "sh", "shablsoiyilt",	/* 14108 */
+	"shadahf", "shbcdbba", "shbkzizciy", "shcaknye",	/* 14112 */
+	"shclsgpalqt", "shegqsmi", "sheknouoodv", "shfqngc",	/* 14116 */
+	"shgdqkv", "shhecu", "shhnwioendsdo", "shhyubkpt",	/* 14120 */
+	"shkhfymqcufo", "shkwi", "shkxjdizje", "shnqflj",	/* 14124 */
+	"shqhcjsromdlg", "shrrpnuguljib", "shun", "shupcmlvleym",	/* 14128 */
+	"shvcaklh", "shxgqqmdwgmv", "shxuzuuukn", "shy",	/* 14132 */
+	"shybp", "shydbmpi", "shyojzreb", "shzjjveaw",	/* 14136 */
+	"shzkvvlzxtfsr", "shzquhjukxge", "shzsfuh", "si",	/* 14140 */
+	"siafsvi", "siallojxehmd", "sicsxmowhdg", "siee",	/* 14144 */
+	"sifiie", "sigzlnr", "sihdynxl", "sikgcoub",	/* 14148 */
+	"siknigxzcmlsfx", "sikwayb", "silbvuejoey", "sily",	/* 14152 */
+	"sin", "sipafpdhedmbfc", "sipmrxy", "siqfc",	/* 14156 */
+	"siqj", "sishaptuprl", "sivpzvgf", "sj",	/* 14160 */
+	"sjbowqgg", "sjefykkqhjlvgy", "sjeroqwexhbjp", "sjltrt",	/* 14164 */
+	"sjmadbk", "sjnuy", "sjo", "sjpjifjizk",	/* 14168 */
+	"sjpnmmulugta", "sjqalkcqbvsfmp", "sjqyuphxgnmlb", "sjtivfkel",	/* 14172 */
+	"sjtrhmmynrs", "sjvkpcixldnj", "sjvnxdleqlt", "sjvoeqlobhrpy",	/* 14176 */
+	"sjwp", "sjwqqi", "sjxujrcegd", "sjzjpqkqutndb",	/* 14180 */
+	"ska", "skebeyw", "skes", "skf",	/* 14184 */
+	"skfd", "skfpocemy", "skfu", "skfyxxmt",	/* 14188 */
+	"skhsvtxqb", "skhyhvuvf", "skjqzltupmjja", "skjrujoeyu",	/* 14192 */
+	"skjuvk", "skkpxump", "sklhvbkyuzj", "skmm",	/* 14196 */
+	"skmmg", "sknqttu", "skphogix", "skpq",	/* 14200 */
+	"skr", "skvyxzepl", "skz", "skzeomtfrzxlu",	/* 14204 */
+	"skzhmnp", "skzjyavdswzu", "sl", "slc",	/* 14208 */
+	"slcjgrladwabq", "slcwkwvyv", "sletxtaytowzw", "slfvrp",	/* 14212 */
+	"slfznunjiht", "slgclhpvpdsran", "slgwuzizxfnl", "sljpbbjanugjc",	/* 14216 */
+	"slllvcnckfcjj", "slmbakdvbufli", "slmhlz", "slmzvuoi",	/* 14220 */
+	"slnwlgyigvos", "slodfg", "slosskaxg", "slovpdc",	/* 14224 */
+	"slpbpn", "slpxlnylcsi", "slrc", "slrditzj",	/* 14228 */
+	"slrmacdoi", "slryxsby", "sls", "slsnv",	/* 14232 */
+	"slu", "slvyxtswg", "slwiqiv", "slwqxkbobs",	/* 14236 */
+	"slym", "slzbneboyqyw", "sm", "smamxoztktjkd",	/* 14240 */
+	"smcgpnjv", "smcr", "smcy", "smdj",	/* 14244 */
+	"smdvmbaehq", "smeix", "smetgqaqb", "smftchpa",	/* 14248 */
+	"smjkii", "smjtbn", "smkaztshxskuzq", "smknecqligx",	/* 14252 */
+	"smlih", "smmfrewzxs", "smncsxaj", "smneitnnelkk",	/* 14256 */
+	"smnmxkto", "smoryc", "smqhmkqew", "smqxrgrdbt",	/* 14260 */
+	"smrpezlsv", "smsfstdcb", "smsza", "smufsdjd",	/* 14264 */
+	"smvjfzrmxrjr", "smvmdpgiolfm", "smvprthibufvvr", "smwcmfvkx",	/* 14268 */
+	"smwznldtnlae", "smxbbehmgiy", "smxoempbv", "smxtk",	/* 14272 */
+	"smzzfrlfbocfv", "sn", "snbh", "snfevc",	/* 14276 */
+	"snghu", "snic", "snjgud", "snkedjjiha",	/* 14280 */
+	"snlgllkde", "snlswukqeyyu", "snmic", "snnossqgtwfv",	/* 14284 */
+	"snotsakvilk", "snozg", "snt", "snthvrafw",	/* 14288 */
+	"sntowsottu", "snvz", "snwk", "snwrbjpf",	/* 14292 */
+	"snwurqumcrgg", "snxjfiiitfezf", "sny", "snyidqbkdqtzou",	/* 14296 */
+	"soaeei", "sob", "sodc", "sodkfr",	/* 14300 */
+	"sodusfqh", "soeekmoitosz", "sofct", "sofeacsffx",	/* 14304 */
+	"sogiqiyqog", "sohbwrsywjpo", "sohdy", "sojfehzwb",	/* 14308 */
+	"sokqqyncd", "soktxrxtwmmlha", "soljnc", "solm",	/* 14312 */
+	"solph", "sopdz", "sopgqyyckofwr", "sophkghxlq",	/* 14316 */
+	"sopmlvkkqd", "soqcckhxgbw", "sotcqyhyvmahc", "sotpbpiyfgg",	/* 14320 */
+	"sotyelqgxnjyf", "soubfnmzvjq", "soufh", "soulyx",	/* 14324 */
+	"souv", "souw", "sovmnoop", "soxgt",	/* 14328 */
+	"soxnvdfbcsr", "soxrkwiyytlqop", "soxsbpjg", "soyikddlnx",	/* 14332 */
+	"soyvqo", "sozlctmbn", "sozuwdwm", "sp",	/* 14336 */
+	"spablbew", "spbp", "spcseumbhf", "spdtiqpyg",	/* 14340 */
+	"spdyelxxzovhx", "spgcjlhgd", "spi", "spiirqovszun",	/* 14344 */
+	"spkcbmywr", "spkuonmatxw", "splvtyj", "spmgzuolqshi",	/* 14348 */
+	"spnhdsnfkqk", "spokvpzo", "spoykg", "spq",	/* 14352 */
+	"spqfldnex", "sprwztjirfbk", "sptgsqvckzu", "sptndbkreso",	/* 14356 */
+	"sptnwpa", "spusf", "spuy", "spv",	/* 14360 */
+	"spvprnwowgyf", "spvxhegbqkzhmo", "spwkoql", "spwruidqxjaj",	/* 14364 */
+	"spwya", "spxjsztixvbymr", "spyodvwzprkbgo", "spyv",	/* 14368 */
+	"sq", "sqbmynsqmsq", "sqdlddo", "sqdytdmklcyuef",	/* 14372 */
+	"sqe", "sqeno", "sqftlvrbznojfa", "sqgcqrxon",	/* 14376 */
+	"sqgcvgtuiamp", "sqhc", "sqirgetucfebxb", "sqjakeevev",	/* 14380 */
+	"sqjakt", "sqkckmmrwqp", "sqkcy", "sqlprxwzu",	/* 14384 */
+	"sqlvli", "sqm", "sqmbogolzu", "sqmceiafdyhmwp",	/* 14388 */
+	"sqn", "sqoqhsufwd", "sqphrkq", "sqqugei",	/* 14392 */
+	"sqqxbdhrh", "sqrgbssqkjcr", "sqtiuk", "squdt",	/* 14396 */
+	"squmtd", "squrvp", "sqvdvo", "sqweb",	/* 14400 */
+	"sqxjty", "sqxn", "sqxuodpavtzq", "sqyirxwwvgcqi",	/* 14404 */
+	"sr", "srbgo", "srbvs", "srdu",	/* 14408 */
+	"srdxkehc", "srdzzhzby", "sregmmj", "srfaxr",	/* 14412 */
+	"srhdpdoqrfd", "srktdxoxfq", "srmnz", "srnfnamlvkg",	/* 14416 */
+	"sro", "srp", "srpawnzzllsaym", "srpcd",	/* 14420 */
+	"srpqu", "srqhfqbmi", "srqwopowlud", "srreicgvywkyal",	/* 14424 */
+	"srsbruazgt", "srsvolfpoljva", "sryd", "ss",	/* 14428 */
+	"ssajprdi", "ssajrp", "ssbmohjqzxvw", "ssd",	/* 14432 */
+	"ssdxyedoh", "sseiadfc", "ssfkqv", "sshasjm",	/* 14436 */
+	"ssirpwk", "ssjbypov", "ssjkbvdwttitji", "sskhzqazpax",	/* 14440 */
+	"ssmuffqhayg", "sso", "ssqwmeylaoz", "sssfojbetx",	/* 14444 */
+	"sstmjtnpktnzq", "ssuncuwzzeh", "ssvsspylls", "ssvyitty",	/* 14448 */
+	"sswkxyxqbvkyr", "sswuek", "ssxdhemjipxktn", "ssxjx",	/* 14452 */
+	"ssyaclqkxtbje", "ssyvnj", "st", "stahaefothg",	/* 14456 */
+	"stao", "stb", "stcrqmgrsrw", "ste",	/* 14460 */
+	"sterdk", "stfm", "stgbbekhkjgsp", "sth",	/* 14464 */
+	"stheq", "sthkwxaczyztan", "stiaqd", "stk",	/* 14468 */
+	"stkokghzexl", "stlbnpkjfgplg", "stnklezy", "stnpivlbttjd",	/* 14472 */
+	"stouc", "stpaj", "stprfgvwg", "stpwuxyqb",	/* 14476 */
+	"strh", "stthcroyiq", "stvhnjgvfxmb", "stw",	/* 14480 */
+	"stwvtpfmcsgy", "stwxujtlkt", "stxdodtwjb", "stxqakxjxoui",	/* 14484 */
+	"su", "suark", "suarwxjvufz", "subdl",	/* 14488 */
+	"sudkydfejwv", "suevxuydmolva", "suewdupgad", "suf",	/* 14492 */
+	"sufm", "sugi", "suiefakcxpuutp", "sujzmzalqgksy",	/* 14496 */
+	"sukcdxymfrszf", "suljulvxkfju", "sultgp", "sumxrpnfduxvb",	/* 14500 */
+	"sunno", "suoghycuj", "suqmzarmqtr", "sursyq",	/* 14504 */
+	"surusfljlr", "susmawhqmdrin", "suspjvidruiffq", "suurndbwpqiao",	/* 14508 */
+	"suvunjqhqnnpz", "suwiiebfeqnxbr", "sux", "suynksaoaocons",	/* 14512 */
+	"suzzfzpi", "svdlkqpiv", "svdyeoujwabj", "svfkqcuzybazsj",	/* 14516 */
+	"svgzki", "svh", "svhk", "svhtwnwdplkf",	/* 14520 */
+	"svjtkzscpknci", "svmfauksso", "svmovh", "svnt",	/* 14524 */
+	"svp", "svrirblxkbm", "svrtitvenzz", "svu",	/* 14528 */
+	"svutyqiqkasyzg", "svvltmrqz", "svvyhzxa", "svxammhiapo",	/* 14532 */
+	"svxjryehfhm", "svyjgt", "svytpjxegmd", "sw",	/* 14536 */
+	"swaz", "swbhvqfujrpgo", "swbqgttb", "swetu",	/* 14540 */
+	"swfne", "swgmoepwhbxuh", "swgqktkb", "swgucbsgjewkc",	/* 14544 */
+	"swhpsr", "swif", "swil", "swjkfaae",	/* 14548 */
+	"swlaqyaphxowst", "swlr", "swoefghykxbnlw", "sworebqkqweuy",	/* 14552 */
+	"swosns", "swtcxabgaw", "swtqco", "swvu",	/* 14556 */
+	"swwtsrmmeg", "swwwyd", "swxtar", "swzesjbucyjcn",	/* 14560 */
+	"sx", "sxabazv", "sxbhxprb", "sxcb",	/* 14564 */
+	"sxcduazkbyc", "sxcijy", "sxdkqjp", "sxeukkof",	/* 14568 */
+	"sxfhvaqqoabo", "sxfqsrbq", "sxghyex", "sxgooexobfpymm",	/* 14572 */
+	"sxgv", "sxhbsxjgo", "sxhkhurnvo", "sxiz",	/* 14576 */
+	"sxjnjicng", "sxkole", "sxmelftyhqu", "sxnfjyyilmmwd",	/* 14580 */
+	"sxnkwerixkp", "sxoqnhrzix", "sxrxjztofuzax", "sxs",	/* 14584 */
+	"sxshrg", "sxsiwfgtphokgd", "sxtwfc", "sxvlwpnqiptj",	/* 14588 */
+	"sxxk", "sxxm", "sxynkejksw", "sxysl",	/* 14592 */
+	"sxywyzkwx", "sxzmzfbinzc", "sxzwgbflxadts", "sy",	/* 14596 */
+	"sydragglm", "syegm", "syetzyobskoh", "syfwqtvmu",	/* 14600 */
+	"sygdicyuujf", "syhcl", "syiyjwwr", "syiyoqmclk",	/* 14604 */
+	"syjwpdm", "sylrsfx", "symhfsbo", "symn",	/* 14608 */
+	"symtzurlmuzyt", "synswih", "sypalrmocar", "syqgyukgqdq",	/* 14612 */
+	"syriufhjjhkxik", "sytvifxqgcf", "syveslguilskl", "syvf",	/* 14616 */
+	"syvprd", "sywfmltrzy", "sywzebv", "syybfdg",	/* 14620 */
+	"sz", "szardwmqhdhx", "szdwzsiuqigjx", "sze",	/* 14624 */
+	"szf", "szhuwkunaqidg", "szke", "szkfwnwub",	/* 14628 */
+	"szkujoz", "szkw", "sznwdrbqfwu", "szoesokpw",	/* 14632 */
+	"szokpwmrgf", "sztukmm", "szuefwdeoafamc", "szunkqtfeerms",	/* 14636 */
+	"szuv", "szviya", "szx", "szyc",	/* 14640 */
+	"szzgx", "ta", "tadsnn", "tae",	/* 14644 */
+	"tagasfc", "taglprtt", "tahnxh", "taiixxub",	/* 14648 */
+	"takkqhw", "taksbhuu", "takvzp", "taly",	/* 14652 */
+	"tanzg", "taomm", "tapdg", "tapxs",	/* 14656 */
+	"taqdarukxbnt", "tasozabaezjsgh", "tatifitugobdaw", "tatteocpsx",	/* 14660 */
+	"tauhfoufbtbag", "tavgp", "tawt", "tawwctvhaotdb",	/* 14664 */
+	"taxswezt", "tayapfnrwyx", "tayhjvk", "tayuwpimqa",	/* 14668 */
+	"tazhufrsf", "tazlhaxvhhm", "tazvcdvfq", "tb",	/* 14672 */
+	"tbbqsdlbu", "tbcacio", "tbcfkjjedqf", "tbcjafvdltypmc",	/* 14676 */
+	"tbckecoiiqzix", "tbdmsmvzm", "tbe", "tbffhrl",	/* 14680 */
+	"tbgnddlpjnf", "tbgr", "tbihbnkpnqik", "tblnvw",	/* 14684 */
+	"tblqrayyhckcc", "tblrpmqksqj", "tblsoeuah", "tbnrnhkx",	/* 14688 */
+	"tbobl", "tbpgvtlorpgis", "tbpstduzymcgj", "tbrqnirwxrjba",	/* 14692 */
+	"tbrwdpxxjrfaa", "tbshieirbldkd", "tbuioso", "tbuokoz",	/* 14696 */
+	"tbvhddhupat", "tbvmifoiz", "tbvpd", "tbxgbmkiqkgn",	/* 14700 */
+	"tbydfeqsoysbro", "tbykzxnll", "tbzetxdvsila", "tcaa",	/* 14704 */
+	"tcajhdvco", "tcdhkxf", "tcdy", "tcee",	/* 14708 */
+	"tcfxqritz", "tcgqrophczfbyl", "tcgyawmcl", "tchdwphtxbzzi",	/* 14712 */
+	"tchhazhmcircxc", "tchwy", "tcib", "tciijdvz",	/* 14716 */
+	"tcjanboamgrtpz", "tcjbc", "tcjnchjdvpl", "tcjxeansexmjh",	/* 14720 */
+	"tclpt", "tcmqnjvoet", "tcncwreiyci", "tcnjxyaliygfe",	/* 14724 */
+	"tcoh", "tcp", "tcs", "tctq",	/* 14728 */
+	"tcu", "tcwirhwm", "tczf", "tdbbhbggz",	/* 14732 */
+	"tddcukdvsrul", "tddedmkooclgbp", "tdehr", "tdfvtuzl",	/* 14736 */
+	"tdho", "tdijmryodbnrvg", "tdiw", "tdiwaswnw",	/* 14740 */
+	"tdje", "tdjimtkdcsu", "tdl", "tdlid",	/* 14744 */
+	"tdmn", "tdnem", "tdolicadswowzv", "tdot",	/* 14748 */
+	"tdpdbjwjbnaqh", "tdpeazh", "tdpil", "tdqjpaqrherzlt",	/* 14752 */
+	"tdqpqcbcfawt", "tdqwwzmblfmfw", "tdtyimlzsil", "tdushqqlrcu",	/* 14756 */
+	"tdvaro", "tdvjekoquiulem", "tdwxdibwglzut", "tdwxreh",	/* 14760 */
+	"tdydatilj", "tdzp", "tdzqpab", "te",	/* 14764 */
+	"teabmcyjzmrjw", "tebotxrh", "tebpopjfkud", "tebwn",	/* 14768 */
+	"tecluq", "tedhumsyhj", "teg", "tehkmchkwr",	/* 14772 */
+	"teicsmfh", "tekqnga", "temggrboo", "temitkxhzzipe",	/* 14776 */
+	"temkqcbep", "temnyrcnt", "temvfxkcz", "tenc",	/* 14780 */
+	"tepadj", "tepscnfsadkn", "tepzjzxcxiwj", "teqarqbttlnt",	/* 14784 */
+	"teqefqvxrtlggu", "teqzvxbperme", "terddag", "terrhnwiwqlp",	/* 14788 */
+	"tesiaqoor", "tetrxck", "tewbse", "tewgwvzbdurtrl",	/* 14792 */
+	"tewwy", "text", "teybvu", "teyiawpv",	/* 14796 */
+	"teypwrinkw", "tf", "tfaxsvv", "tfeva",	/* 14800 */
+	"tffsr", "tfh", "tfhi", "tfhrx",	/* 14804 */
+	"tfhuwzhtmdveh", "tfhxexkfmk", "tfinmni", "tfinxpjlwo",	/* 14808 */
+	"tfmaimhjr", "tfnplwmbl", "tfnwjmmhfnfrr", "tfqnrbhofukibv",	/* 14812 */
+	"tfqrtjkkf", "tfromrykz", "tfsouus", "tfstqvs",	/* 14816 */
+	"tftmpnebq", "tftsyl", "tfuqgdhquydw", "tfvlkkgzmzkzz",	/* 14820 */
+	"tfwh", "tfwnhs", "tfxzjincrtwp", "tfyc",	/* 14824 */
+	"tfyn", "tfzor", "tg", "tga",	/* 14828 */
+	"tgahcks", "tgaluglqkdr", "tgasnjbfmyo", "tgbdgvtt",	/* 14832 */
+	"tgd", "tgdbdervllm", "tgdde", "tgdrzuqhgkw",	/* 14836 */
+	"tgdvsxzox", "tgeeqjsh", "tgggymodcdi", "tggmrdqpxv",	/* 14840 */
+	"tggmtcsahucn", "tggywlcsqw", "tghgdnp", "tghz",	/* 14844 */
+	"tgilyuxs", "tgliwwjwqxd", "tgmcgbmwi", "tgmqghr",	/* 14848 */
+	"tgnayo", "tgnligrg", "tgpccqyxfh", "tgpgxqbfodz",	/* 14852 */
+	"tgqo", "tgr", "tgsnjhnwfsvn", "tgsucfozdrf",	/* 14856 */
+	"tgtw", "tgwogqsoaiye", "tgwubqqff", "tgxdjmfqaypz",	/* 14860 */
+	"tgxfiklgeupd", "tgyipsrbxrl", "thapeasxraym", "that",	/* 14864 */
+	"thbxdluwes", "thdbo", "thdiwxqxhue", "thdmxrqls",	/* 14868 */
+	"thdpbu", "thdwrpva", "thgef", "thhcx",	/* 14872 */
+	"thhmhsd", "thixxnvfmof", "thjd", "thjk",	/* 14876 */
+	"thjx", "thjyqkfpuraabl", "thjzftm", "thktdrtvlznm",	/* 14880 */
+	"thljarmjdyszkx", "thpf", "thqc", "thqqssrdlqf",	/* 14884 */
+	"thridzo", "thrjp", "thsl", "thsmzmfrriqeg",	/* 14888 */
+	"thsotvhfv", "thuwqcd", "thv", "thxmhihqde",	/* 14892 */
+	"ti", "tic", "tidafj", "tidquq",	/* 14896 */
+	"tidsxprcor", "tie", "tiepyjyvyhcj", "tifipgem",	/* 14900 */
+	"tih", "tihwu", "tihzbjlol", "tihzvai",	/* 14904 */
+	"tiiwxhil", "tijufycqljare", "tikii", "tilw",	/* 14908 */
+	"tinp", "tinqtylt", "tiomfuyunww", "tip",	/* 14912 */
+	"tiqnwysxcnltdw", "tirzgnesn", "tiubdmdbpt", "tivcnoinpsz",	/* 14916 */
+	"tiwfrpgpl", "tixfbasggfx", "tiyo", "tizjzmfsi",	/* 14920 */
+	"tiznals", "tj", "tjat", "tjbfat",	/* 14924 */
+	"tjdkhmxahz", "tjdpob", "tjegerxbyk", "tjfciwfnaytgsu",	/* 14928 */
+	"tjhxy", "tjiiyllejlafsc", "tjjkeq", "tjkeevikaboxeb",	/* 14932 */
+	"tjkrbsdln", "tjpb", "tjpnnzcf", "tjpyq",	/* 14936 */
+	"tjpzadlsinnkn", "tjqzfylmsmjgz", "tjs", "tjtxairvggoo",	/* 14940 */
+	"tjuex", "tjvenms", "tjwjblrfplix", "tjwzzjrco",	/* 14944 */
+	"tjxflokka", "tjxokwgmfdqbe", "tjywwll", "tk",	/* 14948 */
+	"tkcubshajcpm", "tkev", "tkez", "tkhvbwgzleb",	/* 14952 */
+	"tkjmj", "tkjmyfqaid", "tkjzjs", "tkk",	/* 14956 */
+	"tkkydhtoravn", "tklcspoxnkzwb", "tklotdyipoyxf", "tklw",	/* 14960 */
+	"tkmxro", "tkohazvedobql", "tkpmg", "tkrjvpy",	/* 14964 */
+	"tksqctkxhhc", "tkstkncbjfhkaj", "tkvaahmanoov", "tkwngpvu",	/* 14968 */
+	"tkxch", "tkyutstbghl", "tkzrx", "tl",	/* 14972 */
+	"tlafcsianwto", "tlask", "tlbuu", "tlchsqdxh",	/* 14976 */
+	"tlcnjtxojis", "tldesiuxkfjscj", "tlegzgrk", "tlfldjgviunaqc",	/* 14980 */
+	"tlhdesvaqlcdok", "tlhegnjw", "tlhtgpieuxsx", "tliofhgey",	/* 14984 */
+	"tljxnzpx", "tllbcbo", "tlln", "tlmo",	/* 14988 */
+	"tln", "tlogknpznmjle", "tlolvob", "tlqoidvsmou",	/* 14992 */
+	"tlqrcqbvlsiga", "tlr", "tlsfaonvvnegal", "tlshc",	/* 14996 */
+	"tlsoqafxk", "tltmy", "tlvtscfnmedul", "tlvy",	/* 15000 */
+	"tlwgj", "tlwllq", "tlwvjegjms", "tlza",	/* 15004 */
+	"tlzlhgigfkivxk", "tm", "tmaoqitkdrd", "tmapfvpmys",	/* 15008 */
+	"tmbgdnf", "tmbhpmuzrj", "tmcwqmaezhw", "tmeesnkot",	/* 15012 */
+	"tmegqyn", "tmgvc", "tmgvte", "tmhkd",	/* 15016 */
+	"tmhmcece", "tmhmcnloovrntd", "tmibbp", "tmii",	/* 15020 */
+	"tmjycfphkl", "tmkdu", "tmkkloqjb", "tmkpmlz",	/* 15024 */
+	"tmlbzpqidrhwea", "tmlcczlb", "tmlecr", "tmlhczevglyky",	/* 15028 */
+	"tmmswcajaakqrj", "tmppxvq", "tmptmpve", "tmpzmdnpjhxu",	/* 15032 */
+	"tmqecpp", "tmqmzietjhq", "tmrkesjalap", "tmrnbr",	/* 15036 */
+	"tmrwyw", "tmrxweiqa", "tmtb", "tmux",	/* 15040 */
+	"tmvtrnybtlsiyu", "tmwgzrsy", "tmwvgoxurjn", "tmxygzf",	/* 15044 */
+	"tmyfarx", "tmzxrwbebmx", "tn", "tna",	/* 15048 */
+	"tnagttevsgqwkr", "tnbuh", "tncgkh", "tncqbhoj",	/* 15052 */
+	"tndicsvvgus", "tnegvuqbdl", "tnfh", "tngcnilorwts",	/* 15056 */
+	"tnizkhbdhasck", "tnkbrjdquwlnwb", "tnlgswamc", "tnlveoaynwxf",	/* 15060 */
+	"tnmim", "tnorc", "tnosmvqgsp", "tnqbhragjooot",	/* 15064 */
+	"tnsi", "tnsmfoij", "tntquagz", "tnudgtip",	/* 15068 */
+	"tnuxq", "tnwuoszdehjufr", "tnyasukpjaakv", "to",	/* 15072 */
+	"toaxavxss", "tocvdd", "tod", "todzgbmg",	/* 15076 */
+	"toenovqgwyhy", "tofpuqvfkhm", "toghwpogaq", "tohmvsase",	/* 15080 */
+	"tojh", "tolmunphl", "tolnyeaoos", "tolqiwcvoyeais",	/* 15084 */
+	"tom", "tomotuandqcn", "tonppclis", "tonwtkwdh",	/* 15088 */
+	"tonxtrruaog", "toobceivlgnsct", "toogc", "toomorfcjfana",	/* 15092 */
+	"toouziwhicwyx", "topfyhbsbespx", "toqarpwy", "toqqssczktu",	/* 15096 */
+	"toqtyqlxcjnplc", "torauav", "torj", "torphjiuw",	/* 15100 */
+	"tosdbfqabnzine", "tould", "tovdzwstdmez", "tovnoskzr",	/* 15104 */
+	"tovtycbryxjlw", "toxjpevlosmbm", "tozhschhmaax", "tozuroictfft",	/* 15108 */
+	"tp", "tpbh", "tpbmq", "tpcpaayrth",	/* 15112 */
+	"tpcxyhvuui", "tpe", "tphppceai", "tphwltvxczajl",	/* 15116 */
+	"tphyoffeeb", "tpjtsuf", "tpkggsanq", "tplf",	/* 15120 */
+	"tplnxpgbtvd", "tplxcmlasjrutf", "tppx", "tpthlvhnkbyyz",	/* 15124 */
+	"tptjnwtjwxas", "tpuxntevkc", "tpvubnff", "tpwbst",	/* 15128 */
+	"tpxhbvtwjx", "tpxhhkxkyeucm", "tpxvwymrtvzmqw", "tpzgxxqxzmtip",	/* 15132 */
+	"tpzhadytr", "tpzpeaayqtektm", "tpzuuuyrw", "tq",	/* 15136 */
+	"tqacecgfk", "tqahkifx", "tqazzyw", "tqbhvhsj",	/* 15140 */
+	"tqedbuexgbfn", "tqelvikes", "tqepkxwmdcj", "tqfucd",	/* 15144 */
+	"tqilrz", "tqiqlxn", "tqjlubtq", "tqjszgjvev",	/* 15148 */
+	"tqkgt", "tqkxgkio", "tqljxcxlevqb", "tqnfizac",	/* 15152 */
+	"tqoiqzkxestofd", "tqowfbmqpnsx", "tqpl", "tqqwanhptlxb",	/* 15156 */
+	"tqqwlhjutn", "tqrurovhy", "tqs", "tqsnizmrwhj",	/* 15160 */
+	"tqtyhjmwrd", "tqvxeohvvedjtj", "tqxptk", "tqyhtpw",	/* 15164 */
+	"tqymcvnwlea", "tqytivbtmvrr", "tqzteao", "tr",	/* 15168 */
+	"trbchvxwchd", "trbcs", "trbyaoptz", "trcewpviwweu",	/* 15172 */
+	"trcphnrbtlobfm", "trcq", "trcuclqombtq", "trdmvbsszinup",	/* 15176 */
+	"trffonncajse", "trfmppqinaj", "trg", "trgjshdrbkjrfx",	/* 15180 */
+	"triy", "trlz", "trm", "trnpdz",	/* 15184 */
+	"trq", "trqcfwpj", "trsiuyqmxy", "trvep",	/* 15188 */
+	"trvofpsx", "trvqlyvgjbewjv", "trxcmedhywhxvn", "tryzntwl",	/* 15192 */
+	"ts", "tsad", "tsbstcrzhxg", "tsbwcalqmm",	/* 15196 */
+	"tschv", "tsei", "tsevctfycxream", "tsfbxpnj",	/* 15200 */
+	"tsffosmxre", "tsfhmipwh", "tsfkcsysyilxuw", "tsgmuvlhocnyl",	/* 15204 */
+	"tsguro", "tsmybrtz", "tsnkaixw", "tsnwstf",	/* 15208 */
+	"tsnxfncmolktfr", "tsodtkamzj", "tspkayx", "tspvirirgkgo",	/* 15212 */
+	"tsryiwl", "tssaygri", "tstswfalxh", "tsu",	/* 15216 */
+	"tsuejj", "tsx", "tsyypzgaumrwc", "tt",	/* 15220 */
+	"ttcup", "ttduygiwo", "ttheoaww", "tthohocygeujx",	/* 15224 */
+	"tthxtevdvv", "ttinkunrfjuo", "ttmdn", "ttmq",	/* 15228 */
+	"ttmwtsmlkxdsl", "ttnfhknbc", "ttnnv", "ttnroc",	/* 15232 */
+	"ttozbixbuczw", "ttppspmpc", "ttpq", "ttpslook",	/* 15236 */
+	"ttpy", "ttqkfrgbjs", "ttqygknjbx", "ttsdeifewcn",	/* 15240 */
+	"ttsukrxpmhkoyp", "tttbicpxbkupo", "tttowo", "ttukgrby",	/* 15244 */
+	"ttvekurwaizu", "ttvilm", "ttvpzdsqszefs", "ttvvdfqiqugl",	/* 15248 */
+	"ttvxajcidy", "ttvzvmu", "ttwer", "tu",	/* 15252 */
+	"tubaml", "tudiw", "tudkvdjmhoywk", "tuecrgezh",	/* 15256 */
+	"tufdspnp", "tufvehppindm", "tugjb", "tugtmqtbbowlic",	/* 15260 */
+	"tugyekamdngjqj", "tugyo", "tuhegvukuas", "tuheyikhvhow",	/* 15264 */
+	"tuhtkgcfxg", "tuhvhlieynq", "tukny", "tulmbj",	/* 15268 */
+	"tuokgfh", "tupkscgflwxcz", "tuqnaini", "turdfjuhc",	/* 15272 */
+	"turmlofwayit", "tus", "tuuolbgvieqyx", "tuvsqc",	/* 15276 */
+	"tuwbb", "tuxzbqfqpjua", "tuynwmmu", "tv",	/* 15280 */
+	"tvaltclmv", "tvaubjhctn", "tvbisfbmukbz", "tvbjhvb",	/* 15284 */
+	"tvbx", "tvcuhupfkw", "tvfssp", "tvghv",	/* 15288 */
+	"tvi", "tviyngjwhu", "tvltdbk", "tvmb",	/* 15292 */
+	"tvn", "tvnilnmt", "tvpfjisonykx", "tvqqdo",	/* 15296 */
+	"tvrxaijcrsj", "tvtilzwts", "tvtqnlsagloaye", "tvubxecnyppj",	/* 15300 */
+	"tvxkfbj", "tvxszh", "tvyfybta", "tvyglqno",	/* 15304 */
+	"twackpv", "twbwhwasntyjc", "twcda", "twcich",	/* 15308 */
+	"twcpooci", "twcsdkdnfr", "twd", "twfks",	/* 15312 */
+	"twfnhjf", "twgc", "twh", "twhhfnfmv",	/* 15316 */
+	"twhvat", "twiqvlkfbeoo", "twjrupvfehr", "twkhebktdwhqe",	/* 15320 */
+	"twkugwcw", "twlf", "twndjd", "twolch",	/* 15324 */
+	"twpginwfmh", "twputx", "twqttz", "twribcijigtb",	/* 15328 */
+	"twsdg", "twswpvlvqrwp", "twtkxl", "twtv",	/* 15332 */
+	"twvc", "twwf", "twwubwrmxql", "twxcuajf",	/* 15336 */
+	"twzbwt", "twzguqwoz", "tx", "txaauqvokv",	/* 15340 */
+	"txajsfpgjgb", "txamzxqzeq", "txbik", "txboqykqxc",	/* 15344 */
+	"txc", "txcikemtib", "txdfnonkkngoqv", "txdkatmexvqydl",	/* 15348 */
+	"txdonjpcfq", "txdzjtwjo", "txf", "txgpuzefzcm",	/* 15352 */
+	"txhwcs", "txilwphwpc", "txlhuaa", "txlkmfvr",	/* 15356 */
+	"txlpxuhiiryw", "txmgltv", "txpbaqwpim", "txpqekel",	/* 15360 */
+	"txtpt", "txuvtpabc", "txwrvjftf", "txxkzhslr",	/* 15364 */
+	"txyvwopqf", "txzccfcz", "txzxovhdaqwf", "ty",	/* 15368 */
+	"tyak", "tydligq", "tygipvsxu", "tygvxtrjlbygj",	/* 15372 */
+	"tygzo", "tyheksnydxtwed", "tyjapdhgluf", "tyjpbgvi",	/* 15376 */
+	"tympmf", "tymvgknwsqle", "tynfarmkdk", "tynlktyhivcqz",	/* 15380 */
+	"tyopulpddlvt", "typdaunvsdeh", "tyrk", "tyrqrhlg",	/* 15384 */
+	"tyrx", "tyt", "tytddhlluo", "tytkinw",	/* 15388 */
+	"tytza", "tyvcej", "tyxl", "tyxqvfwy",	/* 15392 */
+	"tyxrnaacybzdn", "tyyyj", "tz", "tzadiymazaa",	/* 15396 */
+	"tzcpqofcoodfrn", "tze", "tzermhexw", "tzeufvosj",	/* 15400 */
+	"tzfdlwfwntiur", "tzfocey", "tzhbf", "tzhitoc",	/* 15404 */
+	"tziswwt", "tzitpfjaoimsfo", "tzjhiucfue", "tzjinehmqg",	/* 15408 */
+	"tzjthc", "tzkototbkclu", "tzl", "tzlrfx",	/* 15412 */
+	"tzpakoe", "tzptyzlh", "tzqehtdo", "tzqmczh",	/* 15416 */
+	"tzshoxjqu", "tzsmranfulxox", "tzsuoar", "tztopaznmidlyi",	/* 15420 */
+	"tzuxbnyucucnqo", "tzyueujaky", "ua", "uaa",	/* 15424 */
+	"uabdnpgm", "uabslekzfbmc", "uachsqblhxg", "uaejya",	/* 15428 */
+	"uaflxcvoiyph", "uaglejpur", "uagnlduxlqf", "uahjxwoqutrw",	/* 15432 */
+	"uahnivgvlhwnhb", "uaipioqtpbrjyd", "uajmxmiyfvrdy", "uakbfmb",	/* 15436 */
+	"ualcksgp", "ualfkobwajl", "uamvszkvun", "uanxvs",	/* 15440 */
+	"uanynfn", "uapuklcvc", "uaqpesaerasdzu", "uaqvlpv",	/* 15444 */
+	"uatxreuso", "uav", "uavqkq", "uaxzyzuzrskbls",	/* 15448 */
+	"uayczhkex", "uayudk", "ub", "ubaulomhjdanpq",	/* 15452 */
+	"ubcujxiban", "ubdcvxeparhl", "ube", "ubg",	/* 15456 */
+	"ubidvobtdandag", "ubis", "ubkhwmdnkbi", "ubmcrdupbqh",	/* 15460 */
+	"ubncmdrjhayh", "ubogxsmusrt", "ubojkzdxlrhztg", "ubonvpffdfwi",	/* 15464 */
+	"ubouopbb", "ubp", "ubq", "ubsdvrkc",	/* 15468 */
+	"ubsfneq", "ubsrdkesvhxx", "ubtigawzao", "ubtrkgwfmc",	/* 15472 */
+	"ubuof", "ubvjjrwtjowp", "ubxqiowltmmhr", "ubyratvgeyq",	/* 15476 */
+	"ubzouyntc", "uc", "ucbooqrljww", "ucegkihlgtipx",	/* 15480 */
+	"ucfsnenczq", "uch", "ucjcnghmfu", "ucjwwzgebwmy",	/* 15484 */
+	"uckjvkqkgb", "ucleexycljhmy", "uclhc", "ucljuwr",	/* 15488 */
+	"uclpdoc", "uclsza", "ucoub", "ucpeqwdrubm",	/* 15492 */
+	"ucpghomk", "ucqpvdkrqmnqkl", "ucrihfwg", "ucrryhxsfzne",	/* 15496 */
+	"ucrzbbiyh", "ucsjmtfwcxxhfe", "ucsmdpyiqexpu", "uctq",	/* 15500 */
+	"ucv", "ucvkez", "ucvwrw", "ucw",	/* 15504 */
+	"ucwgclzz", "ucxt", "ucyfghfjzd", "ucyfwhgugzcp",	/* 15508 */
+	"ucyjglfexkkkfu", "ucyynengt", "uczcgmui", "uczhajcvo",	/* 15512 */
+	"uczkutbvvdnp", "uczpj", "ud", "udcdkgbwujno",	/* 15516 */
+	"udclq", "udcztsy", "udfgyrk", "udhrnrjz",	/* 15520 */
+	"udhw", "udhxydwuqwu", "udjwtngqk", "udkdpbgipodbx",	/* 15524 */
+	"udkoyvxfltmfun", "udlmlyhvcx", "udmorcbvlr", "udppfbhirhz",	/* 15528 */
+	"udqhohnkhatbgg", "udredlxjuwef", "udsqnrlveth", "udtryxsgis",	/* 15532 */
+	"udu", "uduuwl", "udvnmfxzlodfm", "udw",	/* 15536 */
+	"udxdylenwqx", "udxykfmeknojr", "udzngiyrrv", "ue",	/* 15540 */
+	"ueazdfycv", "uebdysvq", "uebnjj", "uebrwwlhns",	/* 15544 */
+	"ueenravnbon", "ueexkwj", "ueftrpiqums", "uefxmotg",	/* 15548 */
+	"uehp", "uehqe", "uehvl", "uehvnos",	/* 15552 */
+	"uekpenhqwo", "uemn", "uenkhlzvswmuc", "ueob",	/* 15556 */
+	"uep", "uercpiux", "uerucpnwhs", "uesfqnwoh",	/* 15560 */
+	"ueshrugp", "ueuom", "ueuymwlhhuihmx", "uevvuzmzkbqrm",	/* 15564 */
+	"uevyvarbn", "uewwyiiftivcqn", "uexsdisku", "ueytwkzhuikb",	/* 15568 */
+	"ueyx", "uezltsuscwar", "ufbbpm", "ufbdfzwdpx",	/* 15572 */
+	"ufcbprr", "ufccgxe", "ufchmhtxd", "ufcpilt",	/* 15576 */
+	"ufcynct", "ufeufnomvdv", "ufezsakwy", "ufgynjpcjurrmf",	/* 15580 */
+	"ufimddbsd", "ufionjpv", "ufiqtoyamruth", "ufj",	/* 15584 */
+	"ufksguhp", "uflsesq", "ufltcmofgi", "ufmohjarqxfj",	/* 15588 */
+	"ufnw", "ufqgmodki", "ufqmgltxvuexa", "ufqv",	/* 15592 */
+	"uftgek", "ufu", "ufulgsh", "ufvctxxttacg",	/* 15596 */
+	"ufvjob", "ufwbhncvrj", "ufxp", "ufyhqpcz",	/* 15600 */
+	"ufyrshdx", "ug", "ugafoxp", "ugawmf",	/* 15604 */
+	"ugbporm", "ugdgwdcaurgkw", "ugdteosr", "ugetkfqm",	/* 15608 */
+	"ugexqzzckp", "uggwx", "ugheiy", "ughuhbn",	/* 15612 */
+	"ugi", "ugijfmxyv", "ugjy", "ugkahgihcfft",	/* 15616 */
+	"uglpnvycsnmfi", "ugm", "ugoflu", "ugoj",	/* 15620 */
+	"ugokburqwnrla", "ugozdjb", "ugpoeed", "ugqyongxmmf",	/* 15624 */
+	"ugrlltqkxokvib", "ugsenfx", "ugsg", "ugssor",	/* 15628 */
+	"ugt", "ugth", "ugtmfeiaosn", "ugudbysyph",	/* 15632 */
+	"ugugqgkcbgv", "ugvnqyoxxqps", "ugwpyqtnfj", "ugxbeqcseiqdcy",	/* 15636 */
+	"ugxooshmxemra", "ugybinw", "ugyfo", "ugzmuosnwdpi",	/* 15640 */
+	"uh", "uhaghobocjfx", "uhai", "uhcdxkjswiycyv",	/* 15644 */
+	"uhcosuspzyxn", "uhdlxjeqeic", "uhhqk", "uhhwxsjqtn",	/* 15648 */
+	"uhklkcgmw", "uhkltzygy", "uhkqgsuzdlb", "uhljndccl",	/* 15652 */
+	"uhmtxajvoo", "uhniwaidbzwhld", "uhnytqtlc", "uhofmangshlslr",	/* 15656 */
+	"uhpf", "uhrtixaiejyzo", "uhtuzz", "uhvtfta",	/* 15660 */
+	"uhxlbwucx", "uhytrtd", "uhzwtjwiity", "ui",	/* 15664 */
+	"uibvghqfaalzx", "uiceqzqhlxqz", "uieubghfjyaqf", "uifotgmmkhp",	/* 15668 */
+	"uifsbot", "uifyppchg", "uigdl", "uigu",	/* 15672 */
+	"uiixlqqsysl", "uijxhxb", "uikqikctit", "uimgswgi",	/* 15676 */
+	"uimkxyaa", "uimlqoijgp", "uimmtvuqyfnee", "uinjaxycof",	/* 15680 */
+	"uinpk", "uipamf", "uipdjddfsjhv", "uiperkvz",	/* 15684 */
+	"uiptkhlnlbjpe", "uipwipsj", "uipwuevowwbwks", "uiriqttzt",	/* 15688 */
+	"uiuhbcyqulfqy", "uiujnftaxuedyg", "uiwxvxaxmiqa", "uixuqov",	/* 15692 */
+	"uixxtxm", "uiyibqcd", "uizbbgnihvolkn", "uj",	/* 15696 */
+	"ujbnkqxsui", "ujbrdfryenyvvi", "ujdisptetnwgi", "ujf",	/* 15700 */
+	"ujfbokjlgqoia", "ujfgzxkjn", "ujfosr", "ujgfplyhofpnyn",	/* 15704 */
+	"ujgm", "uji", "ujjdesafyncqwl", "ujkmguyq",	/* 15708 */
+	"ujl", "ujmrnxtbtm", "ujpvpyqstvsuoh", "ujrzyhaiyoam",	/* 15712 */
+	"ujsj", "ujslbqxbtxxwwr", "ujslvaf", "ujto",	/* 15716 */
+	"ujtrcumdfhz", "ujuryy", "ujw", "ujwaujehtiqedq",	/* 15720 */
+	"ujwqauncigzzv", "ujwu", "ujyafuwja", "ujzrvinajyc",	/* 15724 */
+	"uk", "ukaxpl", "ukbeo", "ukbgnkzzr",	/* 15728 */
+	"ukegdxtybh", "ukesfum", "ukfhtszbifsd", "ukfipjc",	/* 15732 */
+	"ukgqpunyzvgh", "ukgwouzujoizsg", "ukhmjbkfkzs", "ukhqakkazwmvtb",	/* 15736 */
+	"ukhrxfjuuf", "ukknzu", "ukkxgyavsb", "ukm",	/* 15740 */
+	"ukmqfhpzmc", "ukndjuadp", "ukodta", "ukopdztg",	/* 15744 */
+	"ukpvsyfcusl", "ukq", "ukqwzmshqdzoh", "uktghtmeu",	/* 15748 */
+	"uktqrc", "ukurnnkbvbwfqt", "ukuyvgxp", "ukvbasd",	/* 15752 */
+	"ukwywado", "ukwzphsupxvk", "ukxdl", "ukxmh",	/* 15756 */
+	"ukygnggqwsfzk", "ukypitl", "ukzjtbarbw", "ukzjzsex",	/* 15760 */
+	"ukzn", "ul", "ulbacvpcbngxsz", "ulcx",	/* 15764 */
+	"ulfpgtv", "ulgvpgzpkq", "ulhsvhgejkqa", "ulkrrgg",	/* 15768 */
+	"ulkzhyyxfax", "ulmjotkrqfaeiv", "ulmpufpzkrxng", "uln",	/* 15772 */
+	"ulowtckpv", "ulsxmvkc", "ultkhmufqmikxe", "ululrigmnjctc",	/* 15776 */
+	"ulupra", "ulveaiwkmsu", "ulvixxyhc", "ulvllmtpl",	/* 15780 */
+	"ulxqgsduyvdp", "uly", "ulyauikeekt", "ulzjdxshhnbnnj",	/* 15784 */
+	"ulzyxsvuvy", "um", "umalhg", "umarssziwcv",	/* 15788 */
+	"umbnpuusvfimfw", "umbq", "umcsafbcemozkh", "umdjbtt",	/* 15792 */
+	"umemcitr", "umfubjrmdnh", "umgiehugme", "umhh",	/* 15796 */
+	"umhyjy", "umjbqzkkywfrb", "umjqgea", "umk",	/* 15800 */
+	"umkejtess", "umle", "umlkscwe", "umlurvoepqti",	/* 15804 */
+	"umluvpwmd", "umlxxrvvjexd", "ummjtbjrlw", "ummtrewytgcay",	/* 15808 */
+	"ummvl", "ummxwrf", "umnejf", "umns",	/* 15812 */
+	"umquducp", "umtrdyqa", "umuflatrxr", "umukm",	/* 15816 */
+	"umuofqujqfospl", "umvcjdjxarmnll", "umvjflxp", "umwbxthjkk",	/* 15820 */
+	"umwdsvnvert", "umxfzhjppdsk", "umxsuogmkvthnm", "umzeebylkrynr",	/* 15824 */
+	"un", "uncwirx", "undks", "unfo",	/* 15828 */
+	"ungaair", "ungfhcto", "unhpzfraxhovwf", "unirwjndnpgq",	/* 15832 */
+	"unjfksxitnpiso", "unjpbxo", "unjxsvcnrlloq", "unkvfl",	/* 15836 */
+	"unlrwsix", "unltzsocy", "unmwblxlovcg", "unng",	/* 15840 */
+	"unpgtjxlk", "unpmxxuhqvryt", "unsabwlseseeii", "unsdjet",	/* 15844 */
+	"untesimiikcfaa", "untfky", "unvfnfmugnm", "unvjpxykhjt",	/* 15848 */
+	"unwpbbfecs", "unxagcdy", "unxayftqhf", "unxiqoula",	/* 15852 */
+	"unyelqaonq", "unyoshacgtrky", "unzknoirecey", "unzxxrmyl",	/* 15856 */
+	"uo", "uoadrfnwljp", "uocaraeharbq", "uocwkzilsafs",	/* 15860 */
+	"uodgjnrgmqq", "uodgs", "uodhgmohd", "uodhstfqaqdyh",	/* 15864 */
+	"uoe", "uoesqufdx", "uofbrotydsrr", "uofcbnqyc",	/* 15868 */
+	"uofxk", "uogdezmdmyqs", "uoglbmmeuq", "uoguv",	/* 15872 */
+	"uogwclp", "uohachrfmil", "uojqfqglpz", "uojydhqiiw",	/* 15876 */
+	"uolloanptg", "uooudtm", "uoozzhyliwry", "uoq",	/* 15880 */
+	"uoqyucujjwf", "uoqznrfwmw", "uorqsmyaxvawso", "uorytbdrzqxqy",	/* 15884 */
+	"uowilsles", "uowqt", "uoxbeavxpybyl", "up",	/* 15888 */
+	"upa", "upamzfjfpmazip", "upanzejkimyu", "upeolko",	/* 15892 */
+	"upfk", "upfmxiihmauxni", "upfrdqlmd", "upfwepeog",	/* 15896 */
+	"uphgcwgnotwxl", "upjcfswzx", "upjpsvsy", "upkaykc",	/* 15900 */
+	"upktchrxytta", "upm", "upmqte", "upmsfzsvpgjk",	/* 15904 */
+	"upniltsegp", "upnn", "uppljeo", "upqdbjkbbibnl",	/* 15908 */
+	"upqmr", "uprttofbnnvsd", "upsi", "upuqzjmtf",	/* 15912 */
+	"upzzxxjkmvg", "uq", "uqaba", "uqbwlwxvudyxea",	/* 15916 */
+	"uqclit", "uqdjykvnm", "uqdkwsa", "uqdnorqj",	/* 15920 */
+	"uqezeldqcfeni", "uqfmvzdzkdsdcr", "uqhpi", "uqhysozqppf",	/* 15924 */
+	"uqidfxuy", "uqjaefersta", "uqkhomcan", "uqkrifhvhe",	/* 15928 */
+	"uqkyrxji", "uqlqcisdojb", "uqlu", "uqn",	/* 15932 */
+	"uqndmtdvhje", "uqnhb", "uqohr", "uqokcuv",	/* 15936 */
+	"uqozccfloehmws", "uqpzfveafjfuue", "uqroxmitqibcj", "uqsfyoval",	/* 15940 */
+	"uqtmtx", "uqu", "uqwnewhle", "uqwnw",	/* 15944 */
+	"uqzfbzldnpwxu", "uqzp", "ur", "urafxj",	/* 15948 */
+	"urbgaubb", "urbr", "urclfahp", "urcsjln",	/* 15952 */
+	"urcto", "ureemetwxk", "urfeq", "urg",	/* 15956 */
+	"urjdbbqo", "urlrldiyzczrvz", "urmlpypdcjcoo", "uroiq",	/* 15960 */
+	"urpziibkrnek", "urrkdmeumvfe", "ursvzle", "urvgow",	/* 15964 */
+	"urw", "urx", "urxlznwkkr", "uryl",	/* 15968 */
+	"urzvfb", "us", "usajbes", "usartmqpcfnbpy",	/* 15972 */
+	"uscapzwl", "uscghqo", "usd", "usdlbewyn",	/* 15976 */
+	"usgjgnfvu", "usgmfbyqmxpqn", "usgudbxc", "usj",	/* 15980 */
+	"uskbdhpkyvts", "uskj", "uslytmzhdiodra", "usmkvicc",	/* 15984 */
+	"usordsvgeb", "uswsbx", "uswwzpfpxperfl", "usyaipqm",	/* 15988 */
+	"usz", "ut", "utaf", "utbe",	/* 15992 */
+	"utbgwrsecskb", "utbjasqvbhea", "utccb", "utdsho",	/* 15996 */
+	"utdxvpkd", "utenjwe", "utimom", "utjiurhsrnrfkd",	/* 16000 */
+	"utkefrvlofqcq", "utkvmaa", "utkwo", "utlpnkakngu",	/* 16004 */
+	"utlvaxiwof", "utmvw", "utnlq", "uto",	/* 16008 */
+	"utqeb", "utqtnvmc", "utr", "utrwxeg",	/* 16012 */
+	"utsiknjsrfksvg", "uttyhaxtz", "utv", "utvhuvvgryjpk",	/* 16016 */
+	"utvsfum", "utwegqjug", "utwnmoxyggfgz", "utxbgcyp",	/* 16020 */
+	"uu", "uubryglzyqzwq", "uubt", "uucikrbkzvm",	/* 16024 */
+	"uucvdaacu", "uud", "uudne", "uufenhtw",	/* 16028 */
+	"uugotx", "uugzzjlknar", "uuibrjgsalmgpp", "uukcceon",	/* 16032 */
+	"uumpbbxpmbbjyt", "uuoe", "uuonjlzanrl", "uuowhs",	/* 16036 */
+	"uuozcdkmxpuiw", "uuqltyhgdt", "uuqywofjj", "uusjdbewrp",	/* 16040 */
+	"uut", "uuuxxkouj", "uuuybmdznu", "uuwarsrkvbm",	/* 16044 */
+	"uuwxmz", "uux", "uuxpdcctlxpsxk", "uuzohznji",	/* 16048 */
+	"uv", "uvaxlkmwpgmc", "uvbjctxtfub", "uvbmky",	/* 16052 */
+	"uvcbrmmazjx", "uvcbugmieks", "uvetpogvv", "uvfqkfcddevxo",	/* 16056 */
+	"uvfzq", "uvimkev", "uvjhezii", "uvkbsahdrz",	/* 16060 */
+	"uvke", "uvlhvu", "uvlot", "uvn",	/* 16064 */
+	"uvnd", "uvoccclo", "uvqagvs", "uvrvxh",	/* 16068 */
+	"uvsgaudvevzx", "uvssedwpudepx", "uvtaow", "uvtsxdempsgu",	/* 16072 */
+	"uvutzohalnz", "uvvukrnmagle", "uvwqnv", "uvwrie",	/* 16076 */
+	"uvwzqsiodire", "uvxka", "uvyeqq", "uvzouilicpdxt",	/* 16080 */
+	"uw", "uwacfpnacxmvqt", "uway", "uwbjcmfeei",	/* 16084 */
+	"uwbjx", "uwcgdfzqatojbr", "uwcr", "uwdtvoootsjkq",	/* 16088 */
+	"uwevtyg", "uwhbtlk", "uwidzfigm", "uwjpor",	/* 16092 */
+	"uwjpzyt", "uwjt", "uwk", "uwkdnnmcmf",	/* 16096 */
+	"uwkvymwzkaijl", "uwncqruaifg", "uwntrpnlf", "uwohfdfjlgo",	/* 16100 */
+	"uworczlf", "uwosvgisbayw", "uwpjkr", "uwpx",	/* 16104 */
+	"uwqayr", "uwqslrwzunrbnr", "uwqyte", "uwrxforse",	/* 16108 */
+	"uwttwwtjom", "uwuhvuvcpvemq", "uwwrtyj", "uwwthjcevgxbxc",	/* 16112 */
+	"uwxeyge", "uwxpyyvsj", "uwytcfwfstc", "ux",	/* 16116 */
+	"uxbqw", "uxcvbly", "uxcvtmvccaa", "uxe",	/* 16120 */
+	"uxehfb", "uxel", "uxelukidclax", "uxfyxcieizxcjw",	/* 16124 */
+	"uxgji", "uxgkvroitqwfl", "uxhitzfdaiscu", "uxhwpuqg",	/* 16128 */
+	"uxi", "uxifmjghrd", "uxjghcavhyy", "uxkdrikuss",	/* 16132 */
+	"uxkivvpgivvwex", "uxkmta", "uxkvrhqozdz", "uxlmgvzhzobjdb",	/* 16136 */
+	"uxlpdggkx", "uxmjvccvmztjr", "uxnedsd", "uxpbvvknzoknlr",	/* 16140 */
+	"uxqrm", "uxskhmwuycw", "uxsuaf", "uxtfzvtuh",	/* 16144 */
+	"uxubhnoohejk", "uxwjdplc", "uxylhdg", "uxyyss",	/* 16148 */
+	"uxzrwiq", "uy", "uyanaxkr", "uyanj",	/* 16152 */
+	"uybsiberzhm", "uydg", "uydmc", "uydmmgqmwirpjr",	/* 16156 */
+	"uydplgy", "uydtiisir", "uydunf", "uyegatvsm",	/* 16160 */
+	"uyfhyrkwn", "uyfzwxqeztlsux", "uygqhs", "uygyddikwgphb",	/* 16164 */
+	"uyh", "uyhqrehslosl", "uyksvitspjtvd", "uylrflkns",	/* 16168 */
+	"uymd", "uymy", "uyoxphpmjqupgf", "uypbgfxpcohd",	/* 16172 */
+	"uyspq", "uyxvjcoaltj", "uyzrct", "uz",	/* 16176 */
+	"uzc", "uzdyczbcs", "uzgt", "uzhrnnxua",	/* 16180 */
+	"uzhvutn", "uzi", "uzibueas", "uzigcqq",	/* 16184 */
+	"uzjxcngh", "uzk", "uzmmlfqvbfel", "uznaebhvn",	/* 16188 */
+	"uznplxnlqj", "uznxxyr", "uzojudqxz", "uzoqxnrrlfymww",	/* 16192 */
+	"uzqqkoacqhjw", "uztiqmluwsjzz", "uztnwzb", "uzttqprw",	/* 16196 */
+	"uzugrollzu", "uzuvzfmrx", "uzvwfrbhrpbujc", "uzwz",	/* 16200 */
+	"uzxnmnsn", "uzyszjxy", "va", "vabwnfctcmwqj",	/* 16204 */
+	"vad", "vadqd", "vadv", "vadygfeoa",	/* 16208 */
+	"vag", "vahnyzynycqju", "vaihlytbu", "vajsdzaxo",	/* 16212 */
+	"vamax", "vamcbvujwdaavx", "vamcf", "vamrctobuh",	/* 16216 */
+	"vanb", "vanpdnjc", "vansaqbfvzt", "vaoeug",	/* 16220 */
+	"vapnopagwj", "vaprgel", "vasaxvlk", "vaskmbl",	/* 16224 */
+	"vasnmxfkshaceh", "vav", "vavmrnmhhcqij", "vaw",	/* 16228 */
+	"vaxy", "vaxyblzrb", "vayphngdmh", "vaytnnlbgowkkl",	/* 16232 */
+	"vazymmtbzyi", "vb", "vbalyxxhrlrpxs", "vbbhrhulp",	/* 16236 */
+	"vbdn", "vbgsy", "vbhaizbjjrs", "vbhtbsywq",	/* 16240 */
+	"vbhxw", "vbhzoszotqe", "vbineurlibja", "vbjnn",	/* 16244 */
+	"vbkyzplqaebpk", "vblqoysizbkzrz", "vblwhyjdybh", "vbnfb",	/* 16248 */
+	"vbqnjhsxhyehws", "vbsg", "vbsme", "vbsn",	/* 16252 */
+	"vbsxtgcr", "vbt", "vbtkw", "vbu",	/* 16256 */
+	"vbwh", "vbxijayza", "vbxmeuufzpdke", "vbxrrsimbwrlh",	/* 16260 */
+	"vbysqhodvst", "vc", "vcajapmjeg", "vcd",	/* 16264 */
+	"vcdqghmxopvfk", "vcecdcyqlzwv", "vcetvondfyrn", "vcfrmk",	/* 16268 */
+	"vcfshyiqmuhf", "vcfyd", "vcgbfruimec", "vcgjbdkx",	/* 16272 */
+	"vcgrtrxljfh", "vchz", "vcjtx", "vckgvclldjm",	/* 16276 */
+	"vcldfq", "vclfbvp", "vclwhvdc", "vcnmszrohdwxt",	/* 16280 */
+	"vcnxhkgqlfb", "vcodairnwp", "vcplnzk", "vcqspkfxd",	/* 16284 */
+	"vcr", "vcruqbucmrzxza", "vcsgyni", "vctheliit",	/* 16288 */
+	"vcwr", "vcysim", "vcyttr", "vcyukzphqrfk",	/* 16292 */
+	"vd", "vdbducsmrb", "vdflh", "vdggluc",	/* 16296 */
+	"vdgxuyfiozlkz", "vdid", "vdijpchjvmzuic", "vdixwmpgial",	/* 16300 */
+	"vdj", "vdkgztrjvot", "vdlbwq", "vdnwjjwkfhsjf",	/* 16304 */
+	"vdovguilwsy", "vdpzxsdio", "vdqfruu", "vdqzvhhbjcakp",	/* 16308 */
+	"vds", "vdsdqzkdjafc", "vdtaqejucn", "vdtlpenb",	/* 16312 */
+	"vdurdnlui", "vduytcmu", "vdvmcz", "vdvzkzsupxb",	/* 16316 */
+	"vdxamsvrklq", "vdxybzrdz", "vdyfwvpvl", "veakt",	/* 16320 */
+	"veal", "veb", "vebrze", "vechvf",	/* 16324 */
+	"vecjzhmcww", "vedkcchtuabnew", "veecsevgp", "vegcflsxhxyl",	/* 16328 */
+	"vehdrxvdh", "vehlevorihyz", "vehmgct", "veht",	/* 16332 */
+	"vejvouwe", "vel", "vemfjic", "veonrgntrfh",	/* 16336 */
+	"veoxjnade", "vepbkcu", "vepotjaisjn", "vepublmnfpywf",	/* 16340 */
+	"vereexv", "verujbj", "vesavzcg", "vetdclpduw",	/* 16344 */
+	"vevcj", "vewfm", "vewphi", "vexhxldk",	/* 16348 */
+	"vf", "vfcgxx", "vfczk", "vfenmme",	/* 16352 */
+	"vfhjxcfolm", "vfhkptt", "vfhldarenevijy", "vfhnfzyft",	/* 16356 */
+	"vfifwatvzmad", "vfky", "vflnmv", "vflsrhyfif",	/* 16360 */
+	"vfmvccpv", "vfnrhilyyu", "vfnu", "vfoismcmew",	/* 16364 */
+	"vfp", "vfsebnbmvrqy", "vfsf", "vfsmzqcn",	/* 16368 */
+	"vfsoviuexqrp", "vfspykeuvb", "vfsrofjzkrqpdv", "vfsvyxadoaf",	/* 16372 */
+	"vfsz", "vfvqabp", "vfwdypndzs", "vfxplhizwhkgo",	/* 16376 */
+	"vfzba", "vfzvy", "vfzzhirhuz", "vg",	/* 16380 */
+	"vgak", "vgbxyohdexjz", "vgcodqva", "vggey",	/* 16384 */
+	"vghcugfwjccwg", "vgioprycebhna", "vgiubdpgahaxo", "vgjjspqmsb",	/* 16388 */
+	"vgmef", "vgng", "vgnkuaivyycllq", "vgojryp",	/* 16392 */
+	"vgpthp", "vgqmbbykwxvtmr", "vgryep", "vgszscqvhyahj",	/* 16396 */
+	"vgtqxae", "vgvckvibvzdg", "vh", "vham",	/* 16400 */
+	"vhaorb", "vhcjddouvvgupw", "vhcnl", "vhcymxm",	/* 16404 */
+	"vhcyrrf", "vhdbhcccvv", "vhdrkglxbiw", "vhdymdyzslfbh",	/* 16408 */
+	"vhevrkncfsqia", "vhhj", "vhi", "vhj",	/* 16412 */
+	"vhjkbnagnt", "vhjrfgfxl", "vhjvzpj", "vhldjzxsfyehvu",	/* 16416 */
+	"vhmyn", "vhopj", "vhpirdiityfgdo", "vhpxpcskeercv",	/* 16420 */
+	"vhqyi", "vhrn", "vhuqabskktlarl", "vhutjtbjguamj",	/* 16424 */
+	"vhvoljfhnqvowg", "vhxld", "vhxlzt", "vhxwkozvhehtji",	/* 16428 */
+	"vhzoml", "viacym", "viasw", "vicgrykhiagz",	/* 16432 */
+	"vidtwfd", "vienlulym", "vihfxsubnrb", "viklgdcrkhj",	/* 16436 */
+	"vikn", "vikpjzpx", "vilwtmiqm", "vimbajainf",	/* 16440 */
+	"vimkqurbvmlefv", "vimm", "vinufsihjy", "vio",	/* 16444 */
+	"violjxkfiyd", "viom", "vioygn", "vipngmcxkwhhs",	/* 16448 */
+	"viptozzibfxf", "viscpqkhs", "visjvirtqczdv", "visvffeo",	/* 16452 */
+	"vitde", "vitzzqxlntw", "viuvpk", "viyxubs",	/* 16456 */
+	"vizseheecm", "vj", "vjauvnyte", "vjbhuabn",	/* 16460 */
+	"vjccga", "vjcdhmkpdfbbz", "vjcghozsspiwk", "vjcp",	/* 16464 */
+	"vjdmpf", "vjfibtpon", "vjfmwuys", "vjgo",	/* 16468 */
+	"vji", "vjjwgfsrc", "vjldw", "vjlievhpcjne",	/* 16472 */
+	"vjlrcpmnnrp", "vjn", "vjnblzofh", "vjnkayajthc",	/* 16476 */
+	"vjnqnv", "vjptptybhdbmfx", "vjqygbct", "vjram",	/* 16480 */
+	"vjrsmfrsin", "vjtbprvmw", "vjtiw", "vjuexg",	/* 16484 */
+	"vjulxlmgfuql", "vjumecoaao", "vjun", "vjunninj",	/* 16488 */
+	"vjuxqcwr", "vjvke", "vjvyclbybob", "vjwjoqvjfo",	/* 16492 */
+	"vjxthvfs", "vjyurkostma", "vjyzi", "vk",	/* 16496 */
+	"vkbmqqlcrp", "vkcuzaprqsuptr", "vkdpfihszxkhra", "vkhvph",	/* 16500 */
+	"vkjrxivq", "vkkyuzwsofgy", "vklokpytqi", "vkltstctpbi",	/* 16504 */
+	"vkmztwoa", "vkntodib", "vknx", "vkobzhmkgf",	/* 16508 */
+	"vkq", "vkqedtvxotksic", "vkrs", "vksaxfzifvzlqt",	/* 16512 */
+	"vksc", "vktng", "vktzkxmdf", "vkvlwlm",	/* 16516 */
+	"vkvyx", "vkwshlcwjdke", "vkxivsnk", "vkyknchluria",	/* 16520 */
+	"vkz", "vl", "vlada", "vlak",	/* 16524 */
+	"vlbxp", "vleu", "vlifrgjgh", "vlimrbvdnhd",	/* 16528 */
+	"vlnxkh", "vlolda", "vlpttau", "vlq",	/* 16532 */
+	"vlqvdghu", "vlqzbzw", "vlraaozjmxf", "vlrbh",	/* 16536 */
+	"vlrjkfh", "vluojsszqc", "vlvnnklblq", "vlwukb",	/* 16540 */
+	"vlxhtbiaoalcgm", "vlyipgi", "vm", "vmao",	/* 16544 */
+	"vmbalpnfyzvqin", "vmcliascj", "vmcnuojx", "vmefzfckgpwad",	/* 16548 */
+	"vmehogzv", "vmezvqazdr", "vmgujg", "vmipkywyzzr",	/* 16552 */
+	"vmlrxezt", "vmlvhc", "vmlwqcqxbhnc", "vmmjdjckqf",	/* 16556 */
+	"vmmpi", "vmmxohhpaji", "vmmziczyl", "vmnntubhv",	/* 16560 */
+	"vmofvadzjgny", "vmqkz", "vmr", "vmsc",	/* 16564 */
+	"vmtd", "vmtizijldtp", "vmummyfkdzhg", "vmw",	/* 16568 */
+	"vmwduhj", "vmwgedmocidji", "vmxam", "vmxqifbhvbszr",	/* 16572 */
+	"vmy", "vmyeout", "vmzcrsiqfnmbtr", "vn",	/* 16576 */
+	"vnaemw", "vncwg", "vndqoyd", "vnesqwnuagzj",	/* 16580 */
+	"vnfidrbmfap", "vnfj", "vngoixmjnxtxmz", "vnjni",	/* 16584 */
+	"vnlk", "vnm", "vnoop", "vnpipevvgmbi",	/* 16588 */
+	"vnpjcsk", "vnpmzincmrbus", "vnrcniwuyyrvja", "vnuckaoogkyy",	/* 16592 */
+	"vnupoizgekztn", "vnvfji", "vnvkvngmyq", "vo",	/* 16596 */
+	"voaixtzl", "vod", "vodfoin", "vodkbkvaeclfzb",	/* 16600 */
+	"vof", "voflbegxpejfrg", "vogx", "voidctjvhsew",	/* 16604 */
+	"vokxgfkqmomvdn", "vonp", "vopiyvlfn", "vopnyxepyov",	/* 16608 */
+	"voqcgwzpocblo", "vosbpktwnrwm", "votgmrorwc", "voucx",	/* 16612 */
+	"vovbdysuejm", "vowce", "vowgezhmju", "vowphj",	/* 16616 */
+	"voxmbkzce", "voyla", "vozjd", "vozx",	/* 16620 */
+	"vozzrxrwxoor", "vp", "vpb", "vpcbdeerg",	/* 16624 */
+	"vpdcjkji", "vpekq", "vpfgmhqksbrx", "vpfno",	/* 16628 */
+	"vpgnxf", "vpgyddvcu", "vphtjdotc", "vpjmsopdqkhn",	/* 16632 */
+	"vpm", "vpnoegzltxgmeq", "vpnwtmai", "vppwvjbqohc",	/* 16636 */
+	"vpt", "vptcaihfxbzsgc", "vptdxtrvfq", "vptyvfic",	/* 16640 */
+	"vpvcmiadbcxt", "vpvepua", "vpvv", "vpxhaljgb",	/* 16644 */
+	"vpy", "vpzkofgyguzoi", "vq", "vqavdm",	/* 16648 */
+	"vqcmbsxec", "vqdblixik", "vqiiwrflnlgibx", "vqims",	/* 16652 */
+	"vqixaxvvfgnwj", "vqjhhgmgskux", "vqls", "vqlsceeqfyjbfo",	/* 16656 */
+	"vqm", "vqoimqhioo", "vqpo", "vqrpbntl",	/* 16660 */
+	"vqrrjd", "vqu", "vqunktweh", "vqvaezen",	/* 16664 */
+	"vqvu", "vqwshse", "vqwtt", "vqx",	/* 16668 */
+	"vqxdixn", "vqxoanbnzh", "vqxyccuhaidjip", "vqzebeuresaq",	/* 16672 */
+	"vqzviafbflzze", "vr", "vrbxlkutbb", "vrcdvlxx",	/* 16676 */
+	"vrchxq", "vrcnynhvx", "vrcoosvailoc", "vrdbiar",	/* 16680 */
+	"vrdufvrfmgtl", "vreosr", "vrfqrmqazqn", "vrftvgicxhudqp",	/* 16684 */
+	"vrgxshuks", "vri", "vriodiqbyzz", "vriwtdy",	/* 16688 */
+	"vrj", "vrkmoyn", "vrlcdozjzpzl", "vrnmhxiiautcg",	/* 16692 */
+	"vropldbnjmgq", "vrov", "vrpwlzkbjc", "vrromzm",	/* 16696 */
+	"vrrxbbssiwxi", "vrsahlprcfw", "vrsefv", "vrsotjbgoyn",	/* 16700 */
+	"vrx", "vrxyyatylln", "vs", "vsasksvix",	/* 16704 */
+	"vsbdqg", "vsc", "vsccctfymsurug", "vscitscqxhc",	/* 16708 */
+	"vscnyrtrxlrgh", "vsctpb", "vseihhmwsltt", "vsfhzchlykeob",	/* 16712 */
+	"vsfrtcopvl", "vsgnsmbf", "vsiz", "vskr",	/* 16716 */
+	"vslwcd", "vsnnxkmzoj", "vsqsumaqdxw", "vsrovbzbsfet",	/* 16720 */
+	"vsrraagp", "vsryc", "vstk", "vstywgfoewwpsu",	/* 16724 */
+	"vsuok", "vswi", "vsxxqssnyqyhm", "vszsrcyrdpwq",	/* 16728 */
+	"vtcphbfdn", "vtd", "vtefkvdt", "vtexsprddmwmmo",	/* 16732 */
+	"vthleipqz", "vtjsn", "vtjuwudf", "vtlqoafpn",	/* 16736 */
+	"vtmfar", "vtmhb", "vtmkerlhrovaza", "vtmw",	/* 16740 */
+	"vtnfnxrokdcukt", "vtpbvn", "vtr", "vttm",	/* 16744 */
+	"vtvd", "vtvjzlsmsysc", "vtwaoykl", "vtwojib",	/* 16748 */
+	"vtwvhvtutlrmyh", "vtxrmvvo", "vtxzxyzhfzwvro", "vtyl",	/* 16752 */
+	"vu", "vuatbgoi", "vubjlvyukwbw", "vucj",	/* 16756 */
+	"vuees", "vueukwem", "vufmufznb", "vufyyelgis",	/* 16760 */
+	"vugqoj", "vugr", "vuhfmdtkvswiys", "vuhpncnkepixnf",	/* 16764 */
+	"vuidpmanlqbur", "vuilfmxpmyj", "vuj", "vujsqrbnw",	/* 16768 */
+	"vuk", "vukkhtlxslh", "vumemviuygpz", "vumtoznlfbaa",	/* 16772 */
+	"vunfpdaohtapfh", "vuoiwdquyj", "vuoqcwzummflsm", "vuoxen",	/* 16776 */
+	"vup", "vupw", "vurfss", "vutezcjxnto",	/* 16780 */
+	"vuuvu", "vuvlcuzvlg", "vuxhhkpvp", "vuxnhrx",	/* 16784 */
+	"vuxqzdbrpneyj", "vuynprkr", "vuzebixwm", "vuzfhi",	/* 16788 */
+	"vuzytgqc", "vv", "vvdlgfkec", "vvdmjnbhkn",	/* 16792 */
+	"vvegiwqt", "vvewqoshjsu", "vvhlo", "vvii",	/* 16796 */
+	"vvjebcmutzzz", "vvknufaeebgeh", "vvlmjsgooqosu", "vvmituld",	/* 16800 */
+	"vvmomdstccwiy", "vvoymqjdk", "vvprc", "vvqutgoderl",	/* 16804 */
+	"vvrvppqxdbhbf", "vvs", "vvsztqriinog", "vvtlwmra",	/* 16808 */
+	"vvttc", "vvvf", "vvvhvftegyr", "vvvsrlxb",	/* 16812 */
+	"vvxn", "vvxrgu", "vvxrvjt", "vvxz",	/* 16816 */
+	"vvyxapq", "vvyzchzuxl", "vvzdnzrpl", "vvziflx",	/* 16820 */
+	"vvzuta", "vw", "vwanoe", "vwauvb",	/* 16824 */
+	"vwaycu", "vwctysfiuxve", "vwdzvrrg", "vwfdz",	/* 16828 */
+	"vwferevvbesajm", "vwgekeaqeq", "vwgkgmftgoe", "vwgvxe",	/* 16832 */
+	"vwizzmuhkgpyu", "vwjtkwe", "vwkxpnozqgilii", "vwojdtzfnofnd",	/* 16836 */
+	"vwpxsclwyuwl", "vwvdvsaingpgl", "vwwpzok", "vwwtrbcnxq",	/* 16840 */
+	"vwxbne", "vwxmbfe", "vwytiefuumrch", "vx",	/* 16844 */
+	"vxayxoq", "vxcabxgfhkmg", "vxck", "vxcm",	/* 16848 */
+	"vxfziaerwziclt", "vxgssuy", "vxgxgivi", "vxhwxrrildvabp",	/* 16852 */
+	"vxjsetqt", "vxkbtcnl", "vxmtbv", "vxmzysmyv",	/* 16856 */
+	"vxncngmjqdyf", "vxnypapxwor", "vxozzey", "vxpmws",	/* 16860 */
+	"vxpwzfss", "vxqzloykc", "vxrhslfyvggjzn", "vxrqohgdarutn",	/* 16864 */
+	"vxsyevfmmqev", "vxvgfaktuyg", "vxwz", "vxzrkswia",	/* 16868 */
+	"vy", "vyaaggjynb", "vyamfzbeicx", "vyayn",	/* 16872 */
+	"vybau", "vybmelem", "vybpkkuhnpkwag", "vybqvnrsp",	/* 16876 */
+	"vybtbfgh", "vybtq", "vybwiwhzlthyxt", "vydka",	/* 16880 */
+	"vydnveqoj", "vyehp", "vyfeauzq", "vyfreiswwn",	/* 16884 */
+	"vyjqeprphp", "vylhl", "vylie", "vylnwtnmgmprc",	/* 16888 */
+	"vymkqgn", "vymrfsvwxa", "vyndgseqyv", "vyodeemwpsos",	/* 16892 */
+	"vyodidrkax", "vyqgdvjpyv", "vyrgt", "vyrpgrggj",	/* 16896 */
+	"vytbjcig", "vytrbojaijenx", "vytzdaimtu", "vywayegrnrm",	/* 16900 */
+	"vywlgnahyj", "vyxiniw", "vyxpvkfyowiaw", "vz",	/* 16904 */
+	"vzad", "vzayazsyf", "vzazulgxyad", "vzdo",	/* 16908 */
+	"vzdob", "vze", "vzeftvqz", "vzgfgilwkl",	/* 16912 */
+	"vzhzsmnabmna", "vzjumxumjn", "vzk", "vzkfucmaq",	/* 16916 */
+	"vzmhneqsocpinx", "vzmrjkpz", "vzocypejtqc", "vzokb",	/* 16920 */
+	"vzrdlw", "vzrftgcprvjx", "vztcmznejmhg", "vztwgptqexhs",	/* 16924 */
+	"vzubsaitaigukg", "vzuciiixhmvsd", "vzumr", "vzvdm",	/* 16928 */
+	"vzvmwjmocrx", "vzwafol", "vzxcutitta", "vzy",	/* 16932 */
+	"wa", "waa", "waayldidlz", "wacaxtpoksn",	/* 16936 */
+	"wacbabrkkzata", "wacfcvbd", "wacknpkamvnq", "wadegerqbmye",	/* 16940 */
+	"waeaoisfkdrfk", "waeeufnzwwa", "waekydif", "waexalhcxwzcgw",	/* 16944 */
+	"wafpkvysslxr", "wahfzufvwr", "wahknrx", "waiflowydtzf",	/* 16948 */
+	"waiol", "wajmcvxoliman", "walnl", "walrprkwlf",	/* 16952 */
+	"wanjhodug", "waorvuziwhwodx", "wapgifvvcsob", "waptkabtejv",	/* 16956 */
+	"waqi", "waqqndlqnnum", "waqtpoi", "warg",	/* 16960 */
+	"warkebvneivo", "waryxuasurbe", "wasftizpm", "wasgceuytublc",	/* 16964 */
+	"wasljgtos", "wasspmhtcqehbr", "wasu", "watmloqwdf",	/* 16968 */
+	"wavesjhklz", "wavlkb", "wax", "waxphbpnsw",	/* 16972 */
+	"wb", "wbaufecgnl", "wbavis", "wbbb",	/* 16976 */
+	"wbbiktbarcu", "wbbrik", "wbcyq", "wbdcpg",	/* 16980 */
+	"wbdsxjkckuayxy", "wbeiornocn", "wbexdpjsmc", "wbgdmd",	/* 16984 */
+	"wbgkmacxlbp", "wbgl", "wbgtm", "wbh",	/* 16988 */
+	"wbhm", "wbitra", "wbjyayv", "wbknkiybnorsn",	/* 16992 */
+	"wbnhnrftecvd", "wbp", "wbqgouei", "wbqiyyzk",	/* 16996 */
+	"wbrwlaysbzqne", "wbsfvdhsgq", "wbsfwpiclrcqeb", "wbsgrekpawbjmy",	/* 17000 */
+	"wbsllfpxfpie", "wbsruf", "wbt", "wbuepc",	/* 17004 */
+	"wbvdzip", "wbvntg", "wbvqbms", "wbzqcziikh",	/* 17008 */
+	"wbztlsifqf", "wc", "wccijbqnh", "wccnfqelxbzyn",	/* 17012 */
+	"wccyg", "wceqthzeivce", "wcflbvglqbj", "wcfmqhvfam",	/* 17016 */
+	"wcfuamjq", "wcfvzqgkl", "wcgzrh", "wchlimwmywotvr",	/* 17020 */
+	"wcifdkec", "wcikwd", "wcjdz", "wcje",	/* 17024 */
+	"wcjhfqqnw", "wcjlzjkiv", "wckbpxpujyaxl", "wckq",	/* 17028 */
+	"wckrtreffh", "wclr", "wcmu", "wcn",	/* 17032 */
+	"wcnuey", "wcq", "wcqradklfe", "wcquoalxlmnz",	/* 17036 */
+	"wcrfat", "wcsmwvvdelotw", "wcsnyhivz", "wcsxmpw",	/* 17040 */
+	"wcsz", "wcvhengkjqscxo", "wcxtryzsfxln", "wd",	/* 17044 */
+	"wda", "wdab", "wdabd", "wdaoziit",	/* 17048 */
+	"wdbkecibshvkmn", "wdboyjuqngwxp", "wdcagpfznx", "wdcefrzmlkea",	/* 17052 */
+	"wdcocmbbmxuu", "wddjrw", "wdhopcbzituyx", "wdhpjo",	/* 17056 */
+	"wdiprcgpmrp", "wdive", "wdlswypkutel", "wdnsklri",	/* 17060 */
+	"wdoofxkjrssw", "wdowakzbb", "wdozxeknrsfag", "wdphezrsuog",	/* 17064 */
+	"wdpwfutq", "wdqhqfnha", "wdqrbmomnc", "wdslltij",	/* 17068 */
+	"wdsocqyuagqy", "wdtca", "wdtcc", "wduswqw",	/* 17072 */
+	"wdvqdwunpxr", "wdwptmkzuxxuvh", "wdwr", "wdx",	/* 17076 */
+	"wdywd", "we", "weaaejsywak", "wechtwkmrdc",	/* 17080 */
+	"weedwcy", "weehuleb", "weejjwahnuuea", "wegi",	/* 17084 */
+	"weimkatcorxwx", "welpnknylnark", "wepujofgeobdj", "wes",	/* 17088 */
+	"wesdih", "wet", "wev", "wewnqyrk",	/* 17092 */
+	"wf", "wfbewhsdrgj", "wfbsziefthahuf", "wfcg",	/* 17096 */
+	"wfcjoqf", "wfdrtfwn", "wfeioxtacosno", "wfelaqdpeud",	/* 17100 */
+	"wff", "wfghoahih", "wfgocxpjw", "wfhdfjwpfvq",	/* 17104 */
+	"wfhogbsvugu", "wfiiktvnfahkce", "wfjfwznof", "wfkg",	/* 17108 */
+	"wfktecik", "wflzlvx", "wfnbilahwu", "wfnzlbk",	/* 17112 */
+	"wforai", "wfpqvmknsuhwvs", "wfqtwyznaxqdhm", "wfrztlobbhe",	/* 17116 */
+	"wfthorq", "wftjhgbduqmk", "wfto", "wfva",	/* 17120 */
+	"wfvbcpvb", "wfwgv", "wfwlrkunuvd", "wfxagi",	/* 17124 */
+	"wfxseifqqish", "wfxz", "wfyjg", "wfzgofdgofyt",	/* 17128 */
+	"wgaacmpibdxs", "wgfgdgclo", "wggyxhufxwavqu", "wghlwz",	/* 17132 */
+	"wghuo", "wgi", "wgilpoth", "wgl",	/* 17136 */
+	"wgljqlokugss", "wglopcrsanpsf", "wgmjvqzb", "wgnbby",	/* 17140 */
+	"wgnqxqwtqt", "wgop", "wgoqlokgazen", "wgpimdqcdlf",	/* 17144 */
+	"wgrkpej", "wgtyovfaygba", "wgumlloecqzk", "wguwdcjuvubnsk",	/* 17148 */
+	"wgvf", "wgwahnity", "wgwflxt", "wgwjqyiwdetwe",	/* 17152 */
+	"wgxrnbzvjrjdi", "wh", "whajcbe", "whfbife",	/* 17156 */
+	"whgacamornp", "whhqciof", "whi", "whicwqkhuztr",	/* 17160 */
+	"whjs", "whjv", "whlitbstipd", "whlmzp",	/* 17164 */
+	"whmalzydzauigd", "whnvkch", "whnzrlkzukeu", "whoolqejczq",	/* 17168 */
+	"whpbmhsfpbymfw", "whpdwgcgxd", "whpmadoebr", "whsiinl",	/* 17172 */
+	"whu", "whwp", "whxiohqsqq", "wi",	/* 17176 */
+	"wiaxem", "wib", "widgeqybluxt", "wiebuzvbejnxf",	/* 17180 */
+	"wif", "wifayuwwqjm", "wiff", "wifs",	/* 17184 */
+	"wihwia", "wiisdtx", "wil", "wilhyjtgmj",	/* 17188 */
+	"wilwwzt", "wimrs", "wimuf", "win",	/* 17192 */
+	"wiovhvamdxm", "wioymgjhiofjy", "wiqjeni", "wirtfx",	/* 17196 */
+	"wisw", "witlvwlmyfm", "wivkdkfktjpicv", "wivwztjwez",	/* 17200 */
+	"wiwsa", "wiwtdebboc", "wizbtj", "wj",	/* 17204 */
+	"wjabecaxbmjol", "wjafmhcaoch", "wjcl", "wjcwuyzzwhfnaw",	/* 17208 */
+	"wjdtahicgm", "wjecxmz", "wjemae", "wjfw",	/* 17212 */
+	"wjfyeditezf", "wjghdnfdt", "wjgsqd", "wjihaqrd",	/* 17216 */
+	"wjipvgtyhixyey", "wjiufcf", "wjlfdgggqzcv", "wjmbwojfvese",	/* 17220 */
+	"wjnapudjdpvd", "wjnzwgccmdub", "wjofecrr", "wjqrybjuzms",	/* 17224 */
+	"wjrj", "wjs", "wjuumdldjey", "wjuywk",	/* 17228 */
+	"wjvg", "wjvgkfnf", "wjvlprvbplqtez", "wjvuajk",	/* 17232 */
+	"wjwkhaibb", "wjxdxzdqc", "wjyzafu", "wjzcjfoyzltnq",	/* 17236 */
+	"wjzghyuc", "wjzkxvbpjruwfg", "wk", "wkab",	/* 17240 */
+	"wkajhcviwkav", "wkfqxlxyjuxpj", "wkgl", "wkgp",	/* 17244 */
+	"wkhujoyuqlk", "wkhux", "wkijx", "wkjctwa",	/* 17248 */
+	"wkkssfclrbbt", "wklvq", "wklwmpybys", "wkn",	/* 17252 */
+	"wkoyzhtz", "wkq", "wkqfpcb", "wkrqqqxpsmvnmi",	/* 17256 */
+	"wkszgbkx", "wku", "wkv", "wkwhlas",	/* 17260 */
+	"wkxbirklpqjc", "wky", "wl", "wlainkqoyenpx",	/* 17264 */
+	"wlaoqtkm", "wlap", "wlc", "wlcirgnfsneshm",	/* 17268 */
+	"wlcmnnakfp", "wlcqpctn", "wldktamyg", "wletzl",	/* 17272 */
+	"wlfmkqxjj", "wlg", "wliio", "wljlqtu",	/* 17276 */
+	"wlk", "wlkyz", "wll", "wlnkoydu",	/* 17280 */
+	"wlnvqivn", "wlpjrsrgdgj", "wlpsw", "wlpxlsf",	/* 17284 */
+	"wlrgnwqabjllmk", "wlrxpmmskifmul", "wltozpsb", "wluksyaxujhg",	/* 17288 */
+	"wlve", "wlvpfksvstt", "wlxybevluwrvis", "wlyyowsmclsu",	/* 17292 */
+	"wm", "wmafcudses", "wmasqpv", "wmbd",	/* 17296 */
+	"wmfe", "wmgsp", "wmhkdljrptwr", "wmipyl",	/* 17300 */
+	"wmiquilvbawvsx", "wmjqtqdwfhqrc", "wmkuujua", "wmlataub",	/* 17304 */
+	"wmlx", "wmmlp", "wmmzi", "wmndsvgfajrq",	/* 17308 */
+	"wmnmqnioksa", "wmqpjfoahsk", "wmqvsfpgxuei", "wmrhnwqwbni",	/* 17312 */
+	"wmrhprnumbfw", "wmsifpzqkioaio", "wmsxhk", "wmtlxnpon",	/* 17316 */
+	"wmufauf", "wmugkqhxtfekb", "wmurjzu", "wmutrnhqmpxk",	/* 17320 */
+	"wmvmdioak", "wmvugzzjnbtqz", "wmvxtwbz", "wmwqfhnefooxk",	/* 17324 */
+	"wmyvtsc", "wn", "wnb", "wnbhsdy",	/* 17328 */
+	"wnc", "wndtckegpnkwgq", "wngot", "wnhanbwshbli",	/* 17332 */
+	"wnhsxyuclcqaap", "wniyjiumxtk", "wnkfhgj", "wnkrt",	/* 17336 */
+	"wnlbproqcjwkez", "wnlqigh", "wnmbpmwxei", "wnnishwk",	/* 17340 */
+	"wnocztqm", "wnopwnyy", "wnpjhfoihfr", "wnpwgn",	/* 17344 */
+	"wnrqdphi", "wntcl", "wnu", "wnvvlvrovia",	/* 17348 */
+	"wnwlvabmdibb", "wnwzktyv", "wnyhhq", "wnyhssfhxlbn",	/* 17352 */
+	"wnytler", "wo", "woawrvnbzbmvbu", "wob",	/* 17356 */
+	"wobkkndasf", "wod", "wodgasz", "wodkksqqftbvr",	/* 17360 */
+	"wodktd", "wodmgsx", "wodpafdqsrdu", "woefxxtuvggzm",	/* 17364 */
+	"wofq", "wofqipzaaw", "wogt", "wohhrpptdiyran",	/* 17368 */
+	"woicdwjjyzgpx", "woiiqptemraky", "woiuevfs", "wokmmqa",	/* 17372 */
+	"womtn", "woozxs", "woqipzd", "worlnkvnc",	/* 17376 */
+	"worwtreoorwz", "woryhdgteryee", "woss", "wossvigqpuo",	/* 17380 */
+	"wosxmjdxylojd", "wott", "wouha", "wowfsfgjqpg",	/* 17384 */
+	"woxcevlpko", "woyrfwzz", "wp", "wparp",	/* 17388 */
+	"wpbeq", "wpcvcuzr", "wpdgwkqn", "wpfxqjerox",	/* 17392 */
+	"wpgaqxfg", "wpgcg", "wphukjqklgnrd", "wpi",	/* 17396 */
+	"wpjytzhrazqbai", "wpkegczippoko", "wplgf", "wpm",	/* 17400 */
+	"wppijlvdfzntz", "wpqfles", "wprbftgpzim", "wpreww",	/* 17404 */
+	"wprqtishwwgqky", "wprvkdusgewwyd", "wpuovrgdkuxan", "wpvhe",	/* 17408 */
+	"wpvxp", "wpw", "wpwd", "wpycb",	/* 17412 */
+	"wpzflv", "wq", "wqalzlwdm", "wqbjecsjpk",	/* 17416 */
+	"wqbuvoxfp", "wqcbgfrxnhfoi", "wqfv", "wqgthzkcui",	/* 17420 */
+	"wqgypoznvupaqx", "wqhiavciwmfiy", "wqjgjabcsij", "wqjiazou",	/* 17424 */
+	"wqnlmvzl", "wqoaxbibwb", "wqosml", "wqovvhpocxmna",	/* 17428 */
+	"wqpb", "wqpbxmnomk", "wqpqzglsjcu", "wqqun",	/* 17432 */
+	"wqr", "wqsepfqxghmom", "wqskzdnqyko", "wqtnmatfjtfpn",	/* 17436 */
+	"wquy", "wqvm", "wqzj", "wr",	/* 17440 */
+	"wra", "wrc", "wrdcov", "wrdxwhtyyddp",	/* 17444 */
+	"wrecfjutgb", "wretlqsfjquvn", "wrgaaptn", "wrhfocvf",	/* 17448 */
+	"wrji", "wrldrnfhnesvuu", "wrltrgrm", "wrlvefrm",	/* 17452 */
+	"wrnd", "wrnvc", "wrplnhtgrtgv", "wrqiwvir",	/* 17456 */
+	"wrqpazl", "wrqz", "wrt", "wrtkxghjsbk",	/* 17460 */
+	"wru", "wruc", "wruga", "wrutruab",	/* 17464 */
+	"wrwlk", "wrxjcdqq", "wryhhjcsbdeohf", "ws",	/* 17468 */
+	"wsdobvn", "wser", "wsfer", "wsgmsoemw",	/* 17472 */
+	"wsgsplwzpibezo", "wshrib", "wsiedxxqec", "wsikaenb",	/* 17476 */
+	"wsjuxsikrogkr", "wsjyircbstayjb", "wskcp", "wskkcung",	/* 17480 */
+	"wsktqpjh", "wsmkqectwaspis", "wsnuidsif", "wsoouzrj",	/* 17484 */
+	"wspiz", "wsrqglf", "wssh", "wssjnoscsel",	/* 17488 */
+	"wstem", "wsxnnveuo", "wsym", "wszmawazeyzlpc",	/* 17492 */
+	"wt", "wtbacyn", "wtdb", "wteasyn",	/* 17496 */
+	"wteqdssdfppy", "wtfqcytbtjqn", "wtgcejpjkmv", "wthjowfx",	/* 17500 */
+	"wthtvv", "wthwiartjsctkv", "wtkudewh", "wtm",	/* 17504 */
+	"wtnj", "wtnmqwpz", "wtnvgibaj", "wtod",	/* 17508 */
+	"wtrbusnveypupa", "wtrskkc", "wtswckhjfz", "wttnf",	/* 17512 */
+	"wtudmrdu", "wtupnjugyafasj", "wtvpqz", "wtvqlfatsqrdt",	/* 17516 */
+	"wtwdhhofrgahq", "wtwrgsnrtawn", "wtxj", "wtzsqgg",	/* 17520 */
+	"wtzwtrraako", "wu", "wuardjqxkyrus", "wube",	/* 17524 */
+	"wubiphv", "wubuwl", "wucgz", "wueiov",	/* 17528 */
+	"wugshkciyjkuxt", "wuh", "wuidec", "wuil",	/* 17532 */
+	"wuiojmfwneuglu", "wuiypct", "wujhif", "wujjfeuul",	/* 17536 */
+	"wujph", "wukfj", "wukfq", "wunnibgx",	/* 17540 */
+	"wuoaudchjrgxv", "wup", "wuq", "wuqavnpyubr",	/* 17544 */
+	"wur", "wuriffgrpoaazo", "wuscqopavv", "wusvyngwojnk",	/* 17548 */
+	"wutjqkestitb", "wutmlibkx", "wuutsysgau", "wuwrvdmfjdv",	/* 17552 */
+	"wuxvoayxviyz", "wuygc", "wuyo", "wuypeepxqssanl",	/* 17556 */
+	"wuznvsonklm", "wv", "wvayeviseq", "wvbhx",	/* 17560 */
+	"wvcdrztyddr", "wvdguwvvw", "wvdraebojo", "wvfglbqsgqsa",	/* 17564 */
+	"wvfnjf", "wvfoolndonti", "wvgtbtozivvoop", "wvhomhlw",	/* 17568 */
+	"wvhtfwzas", "wvk", "wvklnlygats", "wvlsylq",	/* 17572 */
+	"wvoybo", "wvpluzjrjwhrzb", "wvqetdjcdfqyc", "wvtnsxkolqg",	/* 17576 */
+	"wvudhpzonpdkrl", "wvvcgsxrtvyj", "wvwtpui", "wvxg",	/* 17580 */
+	"wvxgdtedrdai", "wvxxnjufdmqqat", "wvzmvbljeu", "wvzo",	/* 17584 */
+	"wvzzshxb", "ww", "wwaswiyuxtuci", "wwb",	/* 17588 */
+	"wwgihek", "wwgswoludcawxs", "wwhmz", "wwi",	/* 17592 */
+	"wwifpdrqmnmfwu", "wwixhlkfld", "wwjcwvwhxmx", "wwjfxtdahz",	/* 17596 */
+	"wwkrzf", "wwlswjyxtjdin", "wwnoruyvx", "wwnxegxwjha",	/* 17600 */
+	"wwozivubc", "wwraxudzamjdu", "wwrbwrudvdrry", "wwsfrxwfhq",	/* 17604 */
+	"wwtj", "wwuwrkw", "wwxxdwuyay", "wwyyvpqsi",	/* 17608 */
+	"wx", "wxbxhbjxvxlf", "wxcynt", "wxdy",	/* 17612 */
+	"wxe", "wxeaicyognmid", "wxebmrl", "wxefouueef",	/* 17616 */
+	"wxenuuhig", "wxexd", "wxfacpuvygud", "wxftwxsempt",	/* 17620 */
+	"wxjjrtjnr", "wxjnrmhauqgsf", "wxkn", "wxmbho",	/* 17624 */
+	"wxmhlbh", "wxog", "wxoi", "wxolzidgcziww",	/* 17628 */
+	"wxpjp", "wxr", "wxtekf", "wxuquumqbpm",	/* 17632 */
+	"wxvstt", "wxxhytuuomzqeh", "wxygru", "wxyroycfuxh",	/* 17636 */
+	"wy", "wyazgins", "wyctjkwfymuld", "wyctsucdjfojr",	/* 17640 */
+	"wydfec", "wye", "wyfiwfkmvt", "wyfohlnb",	/* 17644 */
+	"wyfzbxkddm", "wygezlycmleys", "wygxmuomomaq", "wygyxrlu",	/* 17648 */
+	"wyihxp", "wyiyip", "wyiyondsqfjg", "wymzc",	/* 17652 */
+	"wyoiyqx", "wypgrdcgrcu", "wytkh", "wytypkfxm",	/* 17656 */
+	"wyujl", "wyum", "wyuycn", "wyvln",	/* 17660 */
+	"wywcmmqbbay", "wywi", "wyxnsg", "wyydyosbayd",	/* 17664 */
+	"wyzgi", "wz", "wzanlbmzjxfbko", "wzaxw",	/* 17668 */
+	"wzbvrakqak", "wzcatzvzbglsj", "wzecikgikmww", "wzedeejmbzgck",	/* 17672 */
+	"wzgwska", "wzhww", "wzisqyfzcicvq", "wzjpz",	/* 17676 */
+	"wzjwwjxqaidtbx", "wzjzgeonyxp", "wzkhcdnxnuu", "wzl",	/* 17680 */
+	"wzljl", "wzlundlncjuz", "wznfdfsdxofea", "wzonwrr",	/* 17684 */
+	"wzorq", "wzpfsqzyvdh", "wzpv", "wztzfndp",	/* 17688 */
+	"wzugyhv", "wzwe", "wzwjgex", "wzy",	/* 17692 */
+	"wzyck", "xa", "xaakcv", "xaalzzucyeghc",	/* 17696 */
+	"xaaplzbjfc", "xacbtqvke", "xafan", "xafjpc",	/* 17700 */
+	"xahftwbiw", "xahubwlcvkab", "xaigmpjo", "xaiujnwztjq",	/* 17704 */
+	"xajmmcsevxdq", "xakfekhnsfwp", "xalan", "xanjihkow",	/* 17708 */
+	"xapshy", "xapzhyoepoufb", "xaq", "xaqbqkcwlenpz",	/* 17712 */
+	"xaqnb", "xarahgpwgxuxi", "xarnmuxp", "xasambocoejrt",	/* 17716 */
+	"xatfnewfhpgfae", "xavcvzigbtdeou", "xawluiqvixtb", "xaxpzoyxiwnrwz",	/* 17720 */
+	"xaxzabw", "xaz", "xazqyqes", "xb",	/* 17724 */
+	"xbbadjod", "xbbzq", "xbcldmshaejmvl", "xbcsbubsla",	/* 17728 */
+	"xbdhidemkc", "xbf", "xbfrmzvvp", "xbgiekytgvvb",	/* 17732 */
+	"xbhiauqxn", "xbjmakkjsz", "xbjoqwluae", "xbkrnpdpyqtwh",	/* 17736 */
+	"xblil", "xblpshzzxcxfh", "xbmgzfl", "xbnervga",	/* 17740 */
+	"xbogecpuxxvb", "xbpapytbmb", "xbqpiximcgyr", "xbrjjcwyss",	/* 17744 */
+	"xbrofdxewafwoz", "xbs", "xbt", "xbtdzgmtkwf",	/* 17748 */
+	"xbu", "xbwcmyp", "xbxqvuy", "xbykkowlsoik",	/* 17752 */
+	"xbyrgxgwgjfo", "xbzoaqvhjfnwzz", "xc", "xcapjznz",	/* 17756 */
+	"xcapxdbtz", "xcb", "xccbwknwssjxxb", "xcdrsgsnvywbz",	/* 17760 */
+	"xcduhzygoq", "xcf", "xcffvljzgtjgao", "xcfgg",	/* 17764 */
+	"xcfmfjyt", "xcfmlcazsphcan", "xcgl", "xchqrtzzit",	/* 17768 */
+	"xcjjlhkbadkzeh", "xck", "xckwzssurnlvvv", "xcnyhz",	/* 17772 */
+	"xcoy", "xcpb", "xcpcrysnrzwli", "xcrellfjpxtmp",	/* 17776 */
+	"xctffrk", "xcthulyruswrq", "xcuknemlyqsp", "xcv",	/* 17780 */
+	"xcvcpae", "xcw", "xcwtmgrushop", "xcxack",	/* 17784 */
+	"xcytvoyyo", "xczhz", "xczvbm", "xd",	/* 17788 */
+	"xdbbnzgsuid", "xdbg", "xdbnr", "xdcb",	/* 17792 */
+	"xdcqgqbf", "xdczzxhjwiqnh", "xddkltyp", "xde",	/* 17796 */
+	"xdetyf", "xdiy", "xdj", "xdjymyohm",	/* 17800 */
+	"xdkpqyc", "xdlal", "xdllyftpf", "xdlqgymm",	/* 17804 */
+	"xdmlhwfk", "xdn", "xdnke", "xdosvth",	/* 17808 */
+	"xdowlcoxus", "xdp", "xdrcnuk", "xdrs",	/* 17812 */
+	"xdtcwgiedo", "xdustsjhbgaev", "xduwgyp", "xduwmvohjw",	/* 17816 */
+	"xdvapwxujdrmd", "xdvzzjq", "xdw", "xdwmxmvlqqli",	/* 17820 */
+	"xebrrrsoysm", "xecihwisfon", "xedinlt", "xef",	/* 17824 */
+	"xefgqquqfivymy", "xehg", "xehh", "xehhjznbkeqd",	/* 17828 */
+	"xeiaxdcpfd", "xeiqkrtsf", "xeizmzd", "xek",	/* 17832 */
+	"xekllwluzyxmt", "xel", "xelhnuiyil", "xemno",	/* 17836 */
+	"xencn", "xenzmguajtyr", "xeorvh", "xepzpbbgxopqtg",	/* 17840 */
+	"xeslethm", "xeuu", "xevnynnycojq", "xex",	/* 17844 */
+	"xexbgfhevh", "xexcbigmctnns", "xezvegubzfsbt", "xf",	/* 17848 */
+	"xfacntbrgrnl", "xfamcepl", "xfbahpydqivgk", "xfbj",	/* 17852 */
+	"xfbseyyfom", "xfbtf", "xfcpde", "xfcr",	/* 17856 */
+	"xfctssmtcjh", "xfgnkre", "xfhcpkxrdb", "xfhjwel",	/* 17860 */
+	"xfhvdgdgxuhbn", "xfiggq", "xfikapas", "xfilso",	/* 17864 */
+	"xfitrdz", "xfkz", "xflnxh", "xfmd",	/* 17868 */
+	"xfnccxpcmwynnx", "xfnwc", "xfnyhqq", "xfoha",	/* 17872 */
+	"xfon", "xfp", "xfpitjns", "xfq",	/* 17876 */
+	"xfrbwswv", "xfsosxetioqf", "xftedtttqxmq", "xftse",	/* 17880 */
+	"xfugdf", "xfuymsvviw", "xfw", "xfxnbzntwjb",	/* 17884 */
+	"xfydxcbfclb", "xgai", "xgbncbgaqru", "xgbxigdo",	/* 17888 */
+	"xgbzim", "xgcnwvhugn", "xgcyowyoft", "xgdwxgqkwzm",	/* 17892 */
+	"xgeo", "xgeuotgosx", "xgiyxqak", "xgjp",	/* 17896 */
+	"xgksv", "xglavappo", "xglqhrh", "xglyubvznz",	/* 17900 */
+	"xguyl", "xgvbhj", "xgxjbhglbxfh", "xgzxaxvqsxu",	/* 17904 */
+	"xh", "xhadfauda", "xhbtsejdvzxnkt", "xhdnzcpji",	/* 17908 */
+	"xhdthu", "xhehwvs", "xhfhiyjwybmyx", "xhfkntz",	/* 17912 */
+	"xhgkziry", "xhgwersmeswefl", "xhgyutnsvwwuue", "xhioratppdmo",	/* 17916 */
+	"xhjxhnfna", "xhkfrf", "xhkkuzf", "xhlbynzbpn",	/* 17920 */
+	"xhlgpir", "xhlnrw", "xhlqyiro", "xhmbbcmebdevpo",	/* 17924 */
+	"xhpxmaqid", "xhqamztxwkdrg", "xhqxmhl", "xhrkvkhahizcbe",	/* 17928 */
+	"xhsejouyqrswx", "xhssma", "xhstpjfldtlgt", "xhszytwer",	/* 17932 */
+	"xhuehz", "xhukviawjwsbi", "xhvdyu", "xhweizrxpmqjbk",	/* 17936 */
+	"xhxcnvczplspsz", "xhxnanmn", "xhyjmrt", "xhzbbicxjydaxc",	/* 17940 */
+	"xhzpvofdbvjt", "xiamxqmeftidn", "xiaprbdhxo", "xices",	/* 17944 */
+	"xicszmmia", "xid", "xidezqoctwxf", "xidhgchgtso",	/* 17948 */
+	"xidr", "xiex", "xieznwozknk", "xifwld",	/* 17952 */
+	"xifwwiubcjpvr", "xiimov", "xiivpstljwje", "xijnb",	/* 17956 */
+	"xildjzo", "xilfvrdqry", "xilfwsznogckw", "ximftmrcb",	/* 17960 */
+	"ximtquhr", "ximzqznqvx", "xipx", "xiq",	/* 17964 */
+	"xiquhygrvad", "xiqvc", "xiqx", "xirbcxeblv",	/* 17968 */
+	"xit", "xiuzhdbj", "xivfmyfdr", "xivg",	/* 17972 */
+	"xivry", "xiztf", "xj", "xjbqyzddg",	/* 17976 */
+	"xjbzscdyu", "xjcsp", "xjcxvjnisucvkx", "xjd",	/* 17980 */
+	"xjdunrrxirw", "xjebp", "xjetx", "xjfaeonmdy",	/* 17984 */
+	"xjfavul", "xjfjjfrtiobdvb", "xjhrkib", "xjhxmeat",	/* 17988 */
+	"xjkffb", "xjkopmotjpvii", "xjltlsrq", "xjme",	/* 17992 */
+	"xjmmnstgk", "xjnfu", "xjoguurvqkvina", "xjpcusfts",	/* 17996 */
+	"xjqdysjfbsd", "xjqmyfswvdv", "xjqu", "xjsgtb",	/* 18000 */
+	"xjt", "xjtav", "xjtuclkydmz", "xjwfmdhlzo",	/* 18004 */
+	"xjwhpmoxdceo", "xjygvnoaieykp", "xjzlhkdhls", "xjznu",	/* 18008 */
+	"xk", "xkaygjghzprzyx", "xkbipdy", "xkbrpgyriefo",	/* 18012 */
+	"xkcof", "xkddhgrckge", "xkdkjumlxbtun", "xkg",	/* 18016 */
+	"xkh", "xkhbqttquxu", "xkhgeesq", "xkhordfdalph",	/* 18020 */
+	"xkhylrbydunuu", "xkiqetn", "xkiscfaromniud", "xkjiflvqxxlc",	/* 18024 */
+	"xklwijjmhzrgch", "xkmad", "xknukerxtehov", "xkomtkf",	/* 18028 */
+	"xkpn", "xkprdteebkk", "xkqjcvctjakzu", "xkqpkmrb",	/* 18032 */
+	"xkvezxhbfbck", "xkvmkavmnn", "xkvnittpeo", "xkxslbekkejynr",	/* 18036 */
+	"xkydodrwyqm", "xkynzkrdva", "xkyqxucvqiyyll", "xkywmsxtslzp",	/* 18040 */
+	"xkzhswcyedcff", "xl", "xlazthazvwo", "xlcsaznmpjsef",	/* 18044 */
+	"xlcxcmjoyba", "xldnmbdtbdozb", "xlftyvsfbtx", "xlge",	/* 18048 */
+	"xljsrxvktta", "xlnoyptqia", "xlokulv", "xlooun",	/* 18052 */
+	"xlqbxf", "xlqsj", "xlqvlidstx", "xlrgbaekm",	/* 18056 */
+	"xlsjlyhmnsnpbm", "xlsukyqtefd", "xltgamybcptx", "xluv",	/* 18060 */
+	"xlvecdir", "xlwlgadumst", "xlxnzqor", "xlyuwjjjtzy",	/* 18064 */
+	"xlzfbhvbqqjsf", "xlzpqirrekj", "xm", "xmayfdrqbxd",	/* 18068 */
+	"xmc", "xmceztio", "xmcokiubutbdrg", "xmeskixmxkeaa",	/* 18072 */
+	"xmf", "xmfblfkiv", "xmfggqevy", "xmhqfljfuwiema",	/* 18076 */
+	"xmkgtikvaafuv", "xmksayqljfynl", "xmkxblihwmllb", "xmlvnmbci",	/* 18080 */
+	"xmmdlejxr", "xmmeb", "xmmywkso", "xmncpm",	/* 18084 */
+	"xmnqgu", "xmoruwemcqbf", "xmpdcj", "xmrny",	/* 18088 */
+	"xmrzocwbb", "xmsx", "xmvhcegke", "xmwpmfqh",	/* 18092 */
+	"xmyyjubumtqo", "xn", "xnccxvrcbp", "xnczksy",	/* 18096 */
+	"xndgsotgprj", "xndxylksmetsmb", "xnehoqb", "xnepbnk",	/* 18100 */
+	"xnhy", "xnhychuu", "xnkd", "xnlkbjnhixidw",	/* 18104 */
+	"xnlqcmfa", "xnlwhplbcyt", "xnmeudipfwzwbr", "xnmjd",	/* 18108 */
+	"xnnhhamswh", "xnnvhpasdybvrq", "xnojuwypct", "xnooovt",	/* 18112 */
+	"xnoz", "xnpdmohzcgd", "xnplpfyrug", "xnqimcv",	/* 18116 */
+	"xnrapsilwyuae", "xnrjqgdmkpecb", "xns", "xnsrifgm",	/* 18120 */
+	"xntxkuwe", "xnudlvtxojivi", "xnvzuzuvwbcl", "xnwgsbstsykxb",	/* 18124 */
+	"xnwkzhw", "xnwugwslvkpa", "xnxkwzme", "xnyiypk",	/* 18128 */
+	"xnywq", "xo", "xoakhd", "xoapoxfgjlst",	/* 18132 */
+	"xob", "xoc", "xocxgfmiererr", "xodvst",	/* 18136 */
+	"xoejobe", "xoeykz", "xohtkktkdejz", "xoirnhq",	/* 18140 */
+	"xojhysjvwylpqk", "xojum", "xok", "xokpzi",	/* 18144 */
+	"xoljbrpfijnjo", "xomdfr", "xopfasuoipzxsy", "xopfruqhwbf",	/* 18148 */
+	"xopje", "xoqddr", "xoqk", "xoraceaxrvba",	/* 18152 */
+	"xordbzfzjws", "xorkdb", "xorqamfp", "xosh",	/* 18156 */
+	"xoti", "xotoredmgxh", "xotylgkyz", "xougyg",	/* 18160 */
+	"xouuhfrsge", "xowazitgy", "xowbqp", "xoyaut",	/* 18164 */
+	"xoybsqysmmmqo", "xp", "xpacsdppf", "xpbtgmwxpdbmil",	/* 18168 */
+	"xpc", "xpcitdvlnzs", "xpczjfwoicy", "xpdcwrryiivc",	/* 18172 */
+	"xpdel", "xpe", "xpfjw", "xphkkjdzqnatag",	/* 18176 */
+	"xphubteccpnkc", "xpjpwrg", "xpkkno", "xpl",	/* 18180 */
+	"xplnyzubqq", "xplpuyvxg", "xplwdokahj", "xplwthn",	/* 18184 */
+	"xpocfiqaznjsrs", "xppuvirxycctnv", "xppwjnitlah", "xpqxzusxjxx",	/* 18188 */
+	"xprgklbe", "xprjslmmt", "xpspoyzayeixnh", "xptjewzwlw",	/* 18192 */
+	"xpvtlsgwri", "xpwjtqje", "xpxgizdbcdtr", "xpzgedvolcmqp",	/* 18196 */
+	"xpzyoxiyt", "xq", "xqakxrhwvjafjw", "xqdmdbxk",	/* 18200 */
+	"xqff", "xqgarknthnmq", "xqgsizvtjrdhnb", "xqif",	/* 18204 */
+	"xqirudrnpavop", "xqjqxi", "xqlnurkbrz", "xqmnojdvnmk",	/* 18208 */
+	"xqmylewbzfzo", "xqnkwzijev", "xqohhpfmkjucs", "xqqaymtwaxtkol",	/* 18212 */
+	"xqsxeqdcjtl", "xqtakhbambzp", "xquagmnqckmckf", "xqubuwebsu",	/* 18216 */
+	"xqvpiuyjl", "xqvqjk", "xqwgtqkxcfdnnr", "xqwpvsmf",	/* 18220 */
+	"xqxhvismphthd", "xqxkpkjm", "xqxtxi", "xqxzjijjyidta",	/* 18224 */
+	"xqzd", "xr", "xranckeff", "xrc",	/* 18228 */
+	"xrfpi", "xrgquxyfmphi", "xrhoddqa", "xrjjgaiu",	/* 18232 */
+	"xrkpjrz", "xrkrgxyiffuro", "xrl", "xrlaf",	/* 18236 */
+	"xrne", "xrnuwxqse", "xrowz", "xrpcfxkxofby",	/* 18240 */
+	"xrpmequgb", "xrq", "xrqiuntdek", "xrqlwte",	/* 18244 */
+	"xrqmtsyyyaus", "xrrvfjyuxjiqq", "xrshbm", "xrsx",	/* 18248 */
+	"xrtznuusckork", "xruunczeoq", "xrwj", "xrxa",	/* 18252 */
+	"xryk", "xrynuihlvhqoc", "xrynwhscjeo", "xrysmwzpwfw",	/* 18256 */
+	"xrzgllbl", "xs", "xsa", "xsd",	/* 18260 */
+	"xsdtx", "xsejvabpnqrte", "xsems", "xsfiilr",	/* 18264 */
+	"xsfmurezzd", "xsg", "xsgp", "xsgyuuvjjynjch",	/* 18268 */
+	"xshfcbblszk", "xsiis", "xsjtydgz", "xskfz",	/* 18272 */
+	"xskn", "xsmf", "xsn", "xspmddvlop",	/* 18276 */
+	"xspnccb", "xspqdu", "xspqhbiima", "xsrbtyxrrzchwr",	/* 18280 */
+	"xsvmhadn", "xswlhidfgslp", "xsxojlhpet", "xsyd",	/* 18284 */
+	"xszidnq", "xt", "xtbjqpeu", "xtbzdrvi",	/* 18288 */
+	"xtdyxsllpmqdj", "xtekaxfvmm", "xtemqh", "xtemtrsyvakmr",	/* 18292 */
+	"xtepbnowaa", "xtie", "xtkck", "xtkzf",	/* 18296 */
+	"xtmmxfziz", "xtoe", "xtqjhrwnooqrjf", "xtqr",	/* 18300 */
+	"xtqrin", "xtqv", "xtsqpnkkcjxie", "xtvo",	/* 18304 */
+	"xtvwjxg", "xtwcpriluiqh", "xtxbanjade", "xtxyavgnf",	/* 18308 */
+	"xtz", "xtzshpvzxxd", "xtzuwpt", "xu",	/* 18312 */
+	"xuab", "xualidhfhh", "xudoiltputo", "xuefzammr",	/* 18316 */
+	"xuehldduyi", "xueugjutorto", "xufn", "xuguerogtjnkm",	/* 18320 */
+	"xuh", "xukztocaaaort", "xunb", "xunjxkcjtwennx",	/* 18324 */
+	"xunpcq", "xunpugdgtis", "xuoezhqjhl", "xuoj",	/* 18328 */
+	"xur", "xusgwwf", "xusmwbiktdn", "xuvfbe",	/* 18332 */
+	"xuvgycsvfxc", "xuvpb", "xuwwzekvg", "xuyjvppobmlj",	/* 18336 */
+	"xuykapilqiio", "xuymundivzunf", "xuzwhguim", "xv",	/* 18340 */
+	"xvaldnecwnhv", "xvbfodxpw", "xvcxoycygxgzea", "xvdzjazeqap",	/* 18344 */
+	"xvewqleoow", "xveyeawhacqupv", "xvfaqqg", "xvfzuzsv",	/* 18348 */
+	"xvgbbn", "xvghqmpxspq", "xvgrwndvb", "xvhcqehutrufsg",	/* 18352 */
+	"xvhugyd", "xvkaucrds", "xvlck", "xvlgmzurmpcmp",	/* 18356 */
+	"xvmqubqspxxdh", "xvn", "xvnyuexil", "xvocucf",	/* 18360 */
+	"xvodljlmxpapbj", "xvpadajfdo", "xvpfudz", "xvpwdmubgdqjk",	/* 18364 */
+	"xvsmrui", "xvucypftjotkzq", "xvukvsjl", "xvut",	/* 18368 */
+	"xvuufmbim", "xvwde", "xvyhxer", "xvyicjo",	/* 18372 */
+	"xvymurr", "xw", "xwadgtxtjytcpj", "xwcoyhmqbikc",	/* 18376 */
+	"xwewshg", "xwfk", "xwfsiet", "xwgbpymvcc",	/* 18380 */
+	"xwgwclpzzdgzex", "xwhn", "xwi", "xwjsho",	/* 18384 */
+	"xwjusm", "xwjw", "xwkaqpvokajsn", "xwlfattz",	/* 18388 */
+	"xwncc", "xwoqfemmevg", "xwqmo", "xwrfejxjdc",	/* 18392 */
+	"xwrq", "xwsg", "xwsrru", "xwvecmbaecx",	/* 18396 */
+	"xwvfafqtul", "xwvktealyfhhwp", "xwxcpxhuuju", "xwxewaewykpkd",	/* 18400 */
+	"xwzjvixlljnm", "xx", "xxbcw", "xxbmhv",	/* 18404 */
+	"xxbyx", "xxcnzo", "xxcvvxgjivd", "xxdeb",	/* 18408 */
+	"xxdi", "xxfqmo", "xxgzldedlej", "xxit",	/* 18412 */
+	"xxjawwpc", "xxjljixy", "xxjsb", "xxkxblqof",	/* 18416 */
+	"xxmhvtiyckcdn", "xxnbzmgitc", "xxnojwyh", "xxnsgbttk",	/* 18420 */
+	"xxntnzkxfo", "xxnuelmhy", "xxo", "xxoosptbtpjke",	/* 18424 */
+	"xxpeody", "xxqdun", "xxsxcxzbbdwi", "xxudaxxxs",	/* 18428 */
+	"xxv", "xxvex", "xxvihh", "xxwsxnzfrz",	/* 18432 */
+	"xxxkjhugmr", "xxyop", "xxyrfbw", "xxyrh",	/* 18436 */
+	"xy", "xybbmkoxygb", "xybdnglz", "xyd",	/* 18440 */
+	"xyefsiyeimhkmb", "xyegd", "xyfj", "xyizricymbsr",	/* 18444 */
+	"xyjah", "xymppxb", "xynbdepodvfav", "xyojipyhkgvqrr",	/* 18448 */
+	"xyrxa", "xytetjayqswfo", "xytiztbi", "xytnlmgpflbjdb",	/* 18452 */
+	"xytssr", "xyvamzs", "xyvki", "xywfsttyfpzqp",	/* 18456 */
+	"xywqldoi", "xyx", "xyxecclajlu", "xyymfcixmwoubu",	/* 18460 */
+	"xyyoxidrr", "xyzraqjxnfmn", "xzafmitufghw", "xzaqktv",	/* 18464 */
+	"xzatomr", "xzb", "xzcqqvft", "xze",	/* 18468 */
+	"xzeyrobcp", "xzffsb", "xzfldskocwq", "xzfxogjyzp",	/* 18472 */
+	"xzghvwlztxugf", "xzjdlwg", "xzlczju", "xznuuxdap",	/* 18476 */
+	"xznuycss", "xzo", "xzqy", "xzs",	/* 18480 */
+	"xzsvtgu", "xztvndx", "xzuefjtocaiyu", "xzuglocxy",	/* 18484 */
+	"xzvdak", "xzxwsrngxnvl", "xzzf", "xzzg",	/* 18488 */
+	"ya", "yaaskquyagc", "yacdczqxhqy", "yacxisar",	/* 18492 */
+	"yaetf", "yafkitnyyak", "yahcgni", "yahxnmmwcqib",	/* 18496 */
+	"yalukwtcz", "yanta", "yaqatt", "yaqmug",	/* 18500 */
+	"yaqqb", "yarbmexgcp", "yaritsjxu", "yas",	/* 18504 */
+	"yatagnbbaj", "yatoeyym", "yaub", "yavceiys",	/* 18508 */
+	"yawoixzhsdkaaa", "yawqe", "yawsuthzjaoopy", "yaxmyabpij",	/* 18512 */
+	"yaxn", "yaxq", "yayyokm", "yayyxxhfujbdh",	/* 18516 */
+	"yaz", "yazmwder", "yazumrsdoimq", "yazylcvbnay",	/* 18520 */
+	"yb", "ybazcb", "ybcjg", "ybcq",	/* 18524 */
+	"ybcrkj", "ybdgxiscolxfbj", "ybdz", "ybedlipulmqesy",	/* 18528 */
+	"ybfcrptkcwjnjo", "ybhdg", "ybhspqsxo", "ybkkh",	/* 18532 */
+	"ybnwsfncowvqhd", "ybpvclg", "ybqhj", "ybqtpmdfmf",	/* 18536 */
+	"ybrntncfpjcrqp", "ybti", "ybunmzyglrmxm", "ybwgqu",	/* 18540 */
+	"ybx", "ybykcrd", "ybykljtsvnbibn", "yc",	/* 18544 */
+	"ycb", "ycbfxqgyri", "ycckn", "ycf",	/* 18548 */
+	"yciblcghdasq", "ycjjufjbminigy", "ycjvcjibxccfek", "yckoooru",	/* 18552 */
+	"yclerewy", "yclfyzmhwcqirs", "yclwzfrk", "yclyoltwzzh",	/* 18556 */
+	"ycmsfg", "ycmw", "ycnjcpgf", "ycnvy",	/* 18560 */
+	"ycp", "ycrrijmjmm", "yctkuyeqraul", "yctnvypz",	/* 18564 */
+	"yd", "ydawlrkvte", "ydbdxokxfa", "ydbglcmstgvkm",	/* 18568 */
+	"ydcayhukhx", "ydcfpezwu", "ydcnvfkls", "ydeckvoveme",	/* 18572 */
+	"ydfguljrgbo", "ydftpzr", "ydhhjtuhids", "ydhrxadqgi",	/* 18576 */
+	"ydmltollxydnez", "ydmnr", "ydoetejbfgv", "ydoj",	/* 18580 */
+	"ydpcitxxtcmysn", "ydqrch", "ydqtqagwbpci", "ydqwcohkboxpts",	/* 18584 */
+	"ydqzgm", "ydskldhgy", "yduqdanbqs", "ydxemb",	/* 18588 */
+	"ydybobhqi", "ydysymjgcitmn", "ydzxbekag", "ye",	/* 18592 */
+	"yeaplreuuceivn", "yeb", "yebjr", "yebnesvbztcplq",	/* 18596 */
+	"yebuiqwthq", "yeeohkse", "yeermurzrhiwhj", "yeh",	/* 18600 */
+	"yeiruxvuamz", "yejcu", "yekang", "yeksad",	/* 18604 */
+	"yelbyczwm", "yelfg", "yemishw", "yemjurnpkzfc",	/* 18608 */
+	"yemtuq", "yepat", "yeqf", "yeqz",	/* 18612 */
+	"yerdkg", "yesewd", "yesw", "yeuernaeev",	/* 18616 */
+	"yeutmayzgtaka", "yevrqeelcu", "yewho", "yewo",	/* 18620 */
+	"yexhphxqw", "yexuyjntnf", "yexzcjzdhqgwfs", "yeybsuxcvfevun",	/* 18624 */
+	"yeyzslc", "yf", "yfanoy", "yfc",	/* 18628 */
+	"yffug", "yfhnplh", "yfho", "yfirqgebjuno",	/* 18632 */
+	"yfjgmcr", "yfkctohjxrn", "yfkdtwqlcmdhnj", "yfkfuuf",	/* 18636 */
+	"yfkgzowosey", "yfn", "yfqhuuff", "yfqqioge",	/* 18640 */
+	"yfqudiq", "yfqwgsmlgtnfwg", "yfupksezjpyov", "yfutejzg",	/* 18644 */
+	"yfvracqtlrh", "yfx", "yfxhoiakvf", "yfxkfcurthv",	/* 18648 */
+	"yfxwebrwuhfafn", "yfyvlcdo", "yfzpbefjmxnmg", "yg",	/* 18652 */
+	"ygaczzqko", "ygaf", "ygcoubp", "ygdhaot",	/* 18656 */
+	"ygeg", "yggjkdzdkyq", "yggznx", "ygix",	/* 18660 */
+	"yglh", "ygnyzlmrycoyo", "ygoaguoamca", "ygodrrnjihpp",	/* 18664 */
+	"ygogq", "ygphewqye", "ygqefxkxw", "ygqtowyan",	/* 18668 */
+	"ygsv", "ygtckroopgnb", "yguxrptcwwzr", "yh",	/* 18672 */
+	"yha", "yhaqox", "yhauawcmex", "yhbxpmsv",	/* 18676 */
+	"yhbxuzyss", "yhenc", "yhfzla", "yhgmvae",	/* 18680 */
+	"yhgqs", "yhimfv", "yhjaxuhc", "yhjdebxnc",	/* 18684 */
+	"yhjzmoibyejpvq", "yhlxqbulvdfaa", "yhmbkqxvfd", "yhnfepidpkor",	/* 18688 */
+	"yhnrweseige", "yhosjnfdc", "yhpfg", "yhrgp",	/* 18692 */
+	"yhsqyzn", "yhssz", "yhtafixclcd", "yhtdokehfpdh",	/* 18696 */
+	"yhutkokxfihok", "yhxop", "yhztufqqpv", "yi",	/* 18700 */
+	"yiaawai", "yiaclbwrgnzs", "yiap", "yicwovxwunt",	/* 18704 */
+	"yidcojkeppxp", "yidelcvdoi", "yidgsgin", "yidokkq",	/* 18708 */
+	"yifejiqrir", "yifestrrcacfkh", "yigougavjo", "yijjagnzzehxk",	/* 18712 */
+	"yik", "yindffb", "yiohmuqwwhwp", "yipfqkhtudly",	/* 18716 */
+	"yiqomfoylltutn", "yirr", "yirrxc", "yiskj",	/* 18720 */
+	"yitdch", "yiuc", "yiuxtxjv", "yiuzdbkketjh",	/* 18724 */
+	"yiynamyfbt", "yiyogkhbifmzsc", "yiywaqjnwbbk", "yizqkvyciqt",	/* 18728 */
+	"yj", "yjbecpvhmqe", "yjezjrrqgy", "yjfdpfo",	/* 18732 */
+	"yjffwoz", "yjftndmicr", "yjivfeujux", "yjiztanl",	/* 18736 */
+	"yjjhvmx", "yjjiqzxvyu", "yjkf", "yjkz",	/* 18740 */
+	"yjlauyh", "yjluljkd", "yjlvtofipztmnn", "yjm",	/* 18744 */
+	"yjobuovvbfsqe", "yjpbcp", "yjq", "yjqsssqqmgafcn",	/* 18748 */
+	"yjrqnspaxfhin", "yjs", "yjt", "yjtrori",	/* 18752 */
+	"yjuiwdelonkzy", "yjuk", "yjuyqctzo", "yjvcidccsvvdq",	/* 18756 */
+	"yjvouv", "yjvowmssga", "yjwkzbqpoaer", "yjyh",	/* 18760 */
+	"yjzat", "yjzcnzeqbko", "yk", "ykawrvuel",	/* 18764 */
+	"ykbwplfvvgkyoo", "ykcyr", "ykd", "ykevkytdd",	/* 18768 */
+	"ykfdto", "ykfgeauopbtvu", "ykfhjkcrprd", "ykfneanaqz",	/* 18772 */
+	"ykg", "ykih", "ykix", "ykixagakpqg",	/* 18776 */
+	"ykljfezmomdtei", "yklzpetgng", "ykmksrbmoqr", "ykmozdple",	/* 18780 */
+	"ykpatkpce", "ykpzpp", "ykrrezdpvuv", "ykruxoo",	/* 18784 */
+	"ykwo", "ykzfmezgxv", "ykzoyfxwa", "yl",	/* 18788 */
+	"ylckjqu", "ylcpi", "yldiwauyvbdudu", "yldxgok",	/* 18792 */
+	"yldzineb", "yle", "ylexfbdmipj", "ylfbnmexs",	/* 18796 */
+	"ylfl", "ylgfxu", "ylh", "ylhtyaxjdz",	/* 18800 */
+	"ylhwdpfdxjscze", "ylkbcrzetr", "ylkkeazmypt", "ylm",	/* 18804 */
+	"ylmiyarhqfgfcy", "ylmpqhcpx", "ylnapcxuml", "ylnbvgra",	/* 18808 */
+	"ylnkwmng", "ylovgfgcajf", "ylpcln", "ylphnhopxmxa",	/* 18812 */
+	"ylpw", "yltjrfuaprfl", "yltobll", "yludmuvyj",	/* 18816 */
+	"yluzwsk", "ylxp", "ylxpzvkjzgkb", "ylybhlmskjdg",	/* 18820 */
+	"ylzjqajxfdkkc", "ym", "ymacln", "ymat",	/* 18824 */
+	"ymcasllmdetyf", "ymchoel", "ymdgksgjy", "ymgdaezhtmmt",	/* 18828 */
+	"ymghnqlvsmmu", "ymgkvtxghbk", "ymgqvmrf", "ymgsqf",	/* 18832 */
+	"ymhxbcim", "ymjhpqx", "ymju", "ymk",	/* 18836 */
+	"ymkkwquavz", "ymkudxia", "ymlcoeci", "ymmrcuiifh",	/* 18840 */
+	"ymnddg", "ymohrqfqhhezfu", "ymp", "ymqyrtykvf",	/* 18844 */
+	"ymrjsz", "ymrmljjop", "ymtpqefuxsl", "ymttgeyokqi",	/* 18848 */
+	"ymtuktt", "ymugyno", "ymurbbsff", "ymxrv",	/* 18852 */
+	"ymxwf", "ymycrxnjajdgpd", "ymyoagazy", "ymywpvsbyg",	/* 18856 */
+	"ymzmdorta", "yn", "ynavyibv", "ynbkm",	/* 18860 */
+	"ynbrolcwtisnae", "ynemoqna", "ynhfhitcsy", "ynhmfdhjj",	/* 18864 */
+	"ynhshhqzgtx", "yni", "yniipisy", "ynjwleev",	/* 18868 */
+	"ynkgvkjriqxxf", "ynkgxyuyqrb", "ynkxlykbusfvkv", "ynlwgiuxatlbif",	/* 18872 */
+	"ynmhdpoubrpp", "ynmo", "ynnpzgzrxumfh", "ynns",	/* 18876 */
+	"ynofakn", "ynpwknzuy", "ynqzx", "ynsfqcobglkdeh",	/* 18880 */
+	"ynumvuasw", "ynuwcfzwzahf", "ynuwgpqqhlz", "ynvhzxpvryx",	/* 18884 */
+	"ynxx", "yny", "ynyfsgaa", "ynympwiuiowfmw",	/* 18888 */
+	"ynzbimiyduohd", "yo", "yoaishrrsybmc", "yoashhywny",	/* 18892 */
+	"yobp", "yocdwurdfw", "yocoljr", "yoeab",	/* 18896 */
+	"yofpudcpd", "yofyvipx", "yohwd", "yoitbbz",	/* 18900 */
+	"yoiv", "yojnbi", "yojwwij", "yokwgfcwpcvpv",	/* 18904 */
+	"yolclltgb", "yolzktodoegwmd", "yonlfjc", "yonuyoy",	/* 18908 */
+	"yoo", "yoovl", "yoqsqmlm", "yortvdbz",	/* 18912 */
+	"yoselgeap", "youbdq", "yovtpsa", "yow",	/* 18916 */
+	"yoxvp", "yozpx", "yozvpvvdspsc", "yp",	/* 18920 */
+	"ypatcpqmaql", "ypay", "ypdwjh", "ypdxfvdyi",	/* 18924 */
+	"ypgdgnn", "yphbhsmx", "yphxxurulxpwhr", "ypkrknppweqt",	/* 18928 */
+	"ypl", "ypmuihkxfyf", "ypmuoxwjqfrqj", "ypnsdsf",	/* 18932 */
+	"ypnxvfutb", "ypogwmuyxis", "yppyra", "ypqal",	/* 18936 */
+	"yprgkany", "ypsyakx", "ypudlkvrglbl", "ypvurhpxgxzzl",	/* 18940 */
+	"ypxe", "ypxhvvu", "ypyklnnteetf", "ypysize",	/* 18944 */
+	"ypyyzvayrh", "yq", "yqakb", "yqczfrfef",	/* 18948 */
+	"yqdrg", "yqfkwtd", "yqfnv", "yqgfdsiofn",	/* 18952 */
+	"yqgkyzmjdqyx", "yqgxjmetwa", "yqhlruemg", "yqin",	/* 18956 */
+	"yqkjjvorhri", "yqkt", "yqlhq", "yqljeq",	/* 18960 */
+	"yqodsjk", "yqozzr", "yqphyyfwcsh", "yqptghfolouy",	/* 18964 */
+	"yqqrrokmd", "yqru", "yqrwnxiwpr", "yqsbigxl",	/* 18968 */
+	"yqv", "yqvxwjtaszi", "yqwecuiet", "yqwtduqhnxdthn",	/* 18972 */
+	"yqyapd", "yqycgladgqcrwh", "yqzkwqptktuw", "yr",	/* 18976 */
+	"yrb", "yrchiprmvwh", "yrezviwhdsy", "yrgaapowenf",	/* 18980 */
+	"yrgi", "yrgjghcd", "yrgssgq", "yrirqsktthccpq",	/* 18984 */
+	"yrjdvtxgk", "yrknaue", "yrljf", "yrmxwohfqdbjog",	/* 18988 */
+	"yrnpxnbhjse", "yroibn", "yroump", "yrsoou",	/* 18992 */
+	"yrvnuabwkekj", "yrvvafijl", "yrwpsrjnyi", "yrwttk",	/* 18996 */
+	"yrx", "yrxr", "ys", "ysacjlb",	/* 19000 */
+	"ysas", "ysavamzuuc", "ysbtfelfknp", "yscabqzphqqjj",	/* 19004 */
+	"ysdqxtkygjije", "ysf", "ysfikcgpqms", "ysgwgkgjpgsi",	/* 19008 */
+	"ysiqsqveag", "ysjc", "yskjwb", "yskrgstnyayt",	/* 19012 */
+	"yslzlqdk", "ysm", "ysmglpjcve", "ysnkjkzlhoulml",	/* 19016 */
+	"ysp", "ysqpvoggpve", "ysrnvrccpnrfxs", "yssevsixfqo",	/* 19020 */
+	"ysswq", "ystowfnfgj", "ysvcrt", "ysvr",	/* 19024 */
+	"yswixdayryq", "yswpog", "yswxdnzpekg", "ysx",	/* 19028 */
+	"ysxhhseq", "yt", "ytaakhicsvmdks", "ytbnbqdfict",	/* 19032 */
+	"ytboxyodovwj", "ytf", "ytfufxqpw", "ytgkpxjaxedrne",	/* 19036 */
+	"ytgpyanuwtpht", "ythssygbs", "ythtxr", "ythw",	/* 19040 */
+	"yti", "ytjbbkzinidop", "ytjsdzjowts", "ytjyfrxsdp",	/* 19044 */
+	"ytkesfnvjw", "ytkpndbwp", "ytlbzthjwibu", "ytnvsmb",	/* 19048 */
+	"ytqb", "ytrcu", "ytrlqofkj", "ytrurfh",	/* 19052 */
+	"ytueyfmqmqhekl", "ytvkwhptrn", "ytvv", "ytwggcvf",	/* 19056 */
+	"ytxjzeywywgwu", "ytzgyhzh", "ytznmbvbnyzxsy", "ytzyfbxy",	/* 19060 */
+	"yuahbtefzd", "yuculnwroyvvru", "yuczoux", "yuhjacepd",	/* 19064 */
+	"yujidwd", "yukontktdegqls", "yumt", "yup",	/* 19068 */
+	"yuqmrqxl", "yurefwslic", "yusyvuxvox", "yuszicnyrzazsi",	/* 19072 */
+	"yuuglsfs", "yuuvssejjep", "yuv", "yuxpabp",	/* 19076 */
+	"yuyrpwtj", "yuywsnnmj", "yuzoxgokgt", "yvaczmrz",	/* 19080 */
+	"yvbsejvvbdqyk", "yvbuy", "yvdbqjnkjnrdar", "yvdtty",	/* 19084 */
+	"yvdvslx", "yvefgrxuev", "yvehszxxz", "yvejb",	/* 19088 */
+	"yvf", "yvfdbehiybuaa", "yvgthl", "yvhvjsmcmy",	/* 19092 */
+	"yvjp", "yvlxzqnzzpmqb", "yvnfhzsyn", "yvnnr",	/* 19096 */
+	"yvo", "yvoddyjrtihf", "yvpagmeocjala", "yvpf",	/* 19100 */
+	"yvrrgep", "yvrthl", "yvscmkhhjyxz", "yvsfazpjyfxs",	/* 19104 */
+	"yvsgkkixbaqch", "yvtsqvd", "yvukfawmcks", "yvuqrh",	/* 19108 */
+	"yvuvuks", "yvvcddywk", "yvvvsp", "yvwnmugmsuede",	/* 19112 */
+	"yvwnvrtm", "yvwvxgl", "yvxclcbpm", "yvxlcovqdyfqm",	/* 19116 */
+	"yvytmwupioza", "yvzesxzulygyuj", "yw", "ywbdn",	/* 19120 */
+	"ywc", "ywcioncd", "ywcnslfftdlfvp", "ywdrou",	/* 19124 */
+	"ywewfu", "ywfdlzpiahiqn", "ywfmt", "ywgxovbglzj",	/* 19128 */
+	"ywhmkboffz", "ywjrnihdhay", "ywksz", "ywkyy",	/* 19132 */
+	"ywljcstfr", "ywlrbhkmupj", "ywmgwvguqdh", "ywnjcytjlp",	/* 19136 */
+	"ywolrkwganxciv", "ywqhe", "ywqo", "ywqpsgxjgz",	/* 19140 */
+	"ywtuovt", "ywvs", "ywvwzp", "ywwjbhqvoxlb",	/* 19144 */
+	"ywxf", "ywxocopkv", "ywzbmmyag", "yx",	/* 19148 */
+	"yxafpc", "yxbce", "yxbjkjqbkxv", "yxbodbcryrhp",	/* 19152 */
+	"yxd", "yxdefk", "yxdnucdruink", "yxej",	/* 19156 */
+	"yxgyvjm", "yxhjucqcti", "yxhqirca", "yxipdp",	/* 19160 */
+	"yxkbeonwr", "yxmnghtc", "yxmyc", "yxncth",	/* 19164 */
+	"yxohsvrl", "yxoniarqzecpr", "yxoquer", "yxpr",	/* 19168 */
+	"yxpvqlnsfnilrh", "yxqblvthbn", "yxqpt", "yxqptfcwmjrd",	/* 19172 */
+	"yxrn", "yxsshyf", "yxupskcwfogg", "yxuuuifdmp",	/* 19176 */
+	"yxvayqjeouoi", "yxwam", "yxwl", "yxx",	/* 19180 */
+	"yxxcopr", "yxycugybfyyw", "yxzswy", "yy",	/* 19184 */
+	"yya", "yyazea", "yybgys", "yyccpowyvnfluq",	/* 19188 */
+	"yycoszqnay", "yyfcaxapv", "yyg", "yygcdquzprk",	/* 19192 */
+	"yyhchnzelzgcnl", "yyis", "yyjkqnsbcuee", "yyldr",	/* 19196 */
+	"yyll", "yymvmlnvgpaiuv", "yynazejnkgohpk", "yynnsm",	/* 19200 */
+	"yynrcqpmb", "yysqibxwqnh", "yyt", "yythrfnqmp",	/* 19204 */
+	"yyx", "yyxjmw", "yyyukcsvmemysl", "yz",	/* 19208 */
+	"yzajk", "yzaoryoxhecphm", "yzbhfpkixaxseb", "yzbjhuyzfjhqur",	/* 19212 */
+	"yzbkimrhq", "yzblbzxyi", "yzbsrgxfkefwm", "yzdecairfhefsq",	/* 19216 */
+	"yzdgaf", "yzeixxy", "yzekcajy", "yzfpqeyve",	/* 19220 */
+	"yzfyvdgs", "yzh", "yzhfz", "yzjd",	/* 19224 */
+	"yzjhlrigejn", "yzjqj", "yzju", "yzkfjihonrfoh",	/* 19228 */
+	"yzlppe", "yznho", "yznilcleddh", "yzomsgde",	/* 19232 */
+	"yzp", "yzrwnz", "yzrzasjmzhmhn", "yzsdadnrcqdhvf",	/* 19236 */
+	"yzstcyhncvrma", "yzsycknnirsyl", "yztxsnwymn", "yztzvmwoormv",	/* 19240 */
+	"yzufeti", "yzv", "yzvhzgdars", "yzwv",	/* 19244 */
+	"yzxrtwpsolvoqp", "yzxuq", "yzzioqd", "yzzomgancvwn",	/* 19248 */
+	"za", "zabwdmizc", "zad", "zadwjrc",	/* 19252 */
+	"zaeaa", "zaeufekzxmjkl", "zagapms", "zaglyrantfi",	/* 19256 */
+	"zagskwnnrscq", "zahbf", "zahp", "zaimrkjld",	/* 19260 */
+	"zaiuujtxsqh", "zak", "zakjmff", "zalgid",	/* 19264 */
+	"zalibneothy", "zamcy", "zamyrcnkbycomr", "zanjzhzucoq",	/* 19268 */
+	"zanqd", "zao", "zaocpjtbm", "zaowemnnosua",	/* 19272 */
+	"zapliizsszp", "zapzewzt", "zaqgtzcuzbsv", "zarvgqwrkzr",	/* 19276 */
+	"zatgkxtu", "zatkiqvghnehdm", "zauvud", "zavgudrjes",	/* 19280 */
+	"zavotyjyv", "zaxypq", "zaxyqsjnif", "zaz",	/* 19284 */
+	"zazd", "zaztoyaikk", "zb", "zbalpnwzfzvawj",	/* 19288 */
+	"zbamjv", "zbb", "zbclpngpkf", "zbcufpxtiafv",	/* 19292 */
+	"zbe", "zbelacuo", "zbesxb", "zbfpftl",	/* 19296 */
+	"zbg", "zbgn", "zbixjz", "zbjclrsdql",	/* 19300 */
+	"zblco", "zbneqgayghuilz", "zbor", "zbovmwxp",	/* 19304 */
+	"zbozkte", "zbpslkspfsteki", "zbqokyyarvpzx", "zbrajlvsiqj",	/* 19308 */
+	"zbrqkhvspohdi", "zbsouordibkz", "zbsqaa", "zbtdmc",	/* 19312 */
+	"zbtqhhbyjgufu", "zbvviiem", "zbxfdpuhzjhhhh", "zbxyum",	/* 19316 */
+	"zbyqg", "zbysyhzpc", "zbytkorqymefzz", "zbzionufraw",	/* 19320 */
+	"zc", "zcc", "zccezowufszst", "zccgt",	/* 19324 */
+	"zcd", "zcdcfjhbjtegzg", "zcdtjdwoznowfj", "zcehgkqgctlbvo",	/* 19328 */
+	"zcfnswb", "zcg", "zchddgjlkpzlj", "zcizmutzt",	/* 19332 */
+	"zcjxtohxpcqi", "zck", "zcnstmsaaksmxb", "zcobq",	/* 19336 */
+	"zcohqqrmhdf", "zcomf", "zcqjbgwgonyr", "zcqqrdiu",	/* 19340 */
+	"zcr", "zcrhhvi", "zcriwp", "zctd",	/* 19344 */
+	"zcyotqn", "zczlwsccejfynz", "zdahwvf", "zdazzizbjlz",	/* 19348 */
+	"zdbhowvki", "zdbulthyro", "zdbvnecx", "zdefjgfvoc",	/* 19352 */
+	"zdgl", "zdhfrqox", "zdijqk", "zdjpnt",	/* 19356 */
+	"zdjuemyurij", "zdjugxaslny", "zdldnqlagvqyn", "zdlt",	/* 19360 */
+	"zdoecehavhintd", "zdoh", "zdpsozbevn", "zdqnja",	/* 19364 */
+	"zdsoq", "zdszwgronxys", "zdtrlk", "zdu",	/* 19368 */
+	"zducctlhpv", "zdwrixbfdkue", "zdxgkfxkhnbsp", "zdxsza",	/* 19372 */
+	"zdxtmqdhdpczj", "zdyh", "zdyhgxyokc", "zdynukfoqz",	/* 19376 */
+	"zdzohrrk", "ze", "zeahprg", "zebhaxp",	/* 19380 */
+	"zebjsmhwfgxm", "zebvpbdp", "zebz", "zeckzifsioy",	/* 19384 */
+	"zecmzrmhmvu", "zee", "zeeqand", "zeevdp",	/* 19388 */
+	"zef", "zefol", "zeft", "zefwnzuhniu",	/* 19392 */
+	"zegnhz", "zegtq", "zegyyiu", "zeiqwottnk",	/* 19396 */
+	"zeitjr", "zeixmyirv", "zej", "zejvfqwczuhjw",	/* 19400 */
+	"zek", "zekqggcbq", "zekqszvbspxysm", "zekrqzjhlw",	/* 19404 */
+	"zelkoh", "zelsmuteeipmi", "zelucbnmnuwsty", "zemoy",	/* 19408 */
+	"zemuiybbq", "zeogemouvbl", "zepnwhjrsrkzi", "zeqszfuwtn",	/* 19412 */
+	"zer", "zerchiuqs", "zesshdcxcoag", "zeswm",	/* 19416 */
+	"zesxazq", "zetkyhteoq", "zeu", "zewiecnpe",	/* 19420 */
+	"zewimheyedpv", "zex", "zexivbharjcctj", "zeyemldodx",	/* 19424 */
+	"zezibpfycri", "zf", "zfahmihunuvgbz", "zfary",	/* 19428 */
+	"zfffweclggnvwc", "zffql", "zfjrg", "zfjtrs",	/* 19432 */
+	"zfmbtxfpd", "zfmowwejhglcd", "zfnbnqdsx", "zfommotogh",	/* 19436 */
+	"zfoscibdauyl", "zfphdgjrvqkps", "zfqa", "zfreeouf",	/* 19440 */
+	"zftogelot", "zfv", "zfvjhafo", "zfwyzwd",	/* 19444 */
+	"zfxzzbohboqinx", "zfyibkmlbubva", "zfzmsrgtmy", "zg",	/* 19448 */
+	"zgbn", "zgcdhkmiazeip", "zgdpamnt", "zgfialojjulep",	/* 19452 */
+	"zggjmyo", "zggzrnbvad", "zgilaocfxov", "zgipnjgnnlhbwt",	/* 19456 */
+	"zgj", "zgjkx", "zgjstvnvtifmk", "zgknocibaje",	/* 19460 */
+	"zglpoqbmrpn", "zgnlwd", "zgntttxhxe", "zgnzlkylj",	/* 19464 */
+	"zgoqcfmvtyyp", "zgpdzcgwq", "zgpileis", "zgqohkktii",	/* 19468 */
+	"zgr", "zgrjbivoa", "zgsiy", "zgtiaposs",	/* 19472 */
+	"zgtmhboaqqa", "zgtocrsywv", "zgvnpth", "zgx",	/* 19476 */
+	"zh", "zhbvexexrrfk", "zhbwa", "zhbwsc",	/* 19480 */
+	"zhcbonfvig", "zhdalktmhbqdpz", "zhe", "zhfczxxn",	/* 19484 */
+	"zhfoegpbocnsco", "zhhbhpuzvddgcl", "zhhk", "zhhmxsc",	/* 19488 */
+	"zhicsx", "zhiswkjpjylhs", "zhk", "zhme",	/* 19492 */
+	"zhnujq", "zhqxslmaqa", "zhttsi", "zhudcemuhxhs",	/* 19496 */
+	"zhuq", "zhurhvxkkegaf", "zhvdlk", "zhvfd",	/* 19500 */
+	"zhwgieaqicmn", "zhxbxu", "zhyb", "zhzftli",	/* 19504 */
+	"zhzn", "zhzsmdbo", "zi", "ziacxti",	/* 19508 */
+	"ziaifgrhdai", "ziazri", "zibjunjgwt", "ziej",	/* 19512 */
+	"zige", "ziirxhc", "zikc", "zikiq",	/* 19516 */
+	"zikk", "ziollopgm", "zipqwkdrcbh", "ziptez",	/* 19520 */
+	"zipushmdo", "ziqloa", "ziranrweatm", "zirggxfrg",	/* 19524 */
+	"zisfjrycvf", "zitfmmpzrhhnt", "ziu", "ziudkhzjizqe",	/* 19528 */
+	"ziumdwxh", "zivvqut", "zivxmaft", "zixxbmb",	/* 19532 */
+	"zj", "zjacvjnql", "zjb", "zjc",	/* 19536 */
+	"zjckvzo", "zjefcecufzx", "zjehrgjlwu", "zjfvdmnpygszl",	/* 19540 */
+	"zjhkm", "zjisiqrphtkr", "zjki", "zjldfmewzgebbw",	/* 19544 */
+	"zjlmjbq", "zjlsdvagljhgcl", "zjmdnrd", "zjpuc",	/* 19548 */
+	"zjqubunvwzbalt", "zjrscpsoqomlq", "zjspcei", "zjstkbwklz",	/* 19552 */
+	"zjsvlebtmz", "zjtoxpu", "zjulkpjuijj", "zjvkxyeyw",	/* 19556 */
+	"zjvmn", "zjwtnotxod", "zjzkihd", "zk",	/* 19560 */
+	"zkepnw", "zkfmwoqonjeu", "zkgcpxppy", "zkgfgbqkmczxuf",	/* 19564 */
+	"zkhbugkarfr", "zkjcrk", "zkjobhp", "zkkhhc",	/* 19568 */
+	"zkkswczztleiki", "zklcjofamd", "zklyk", "zkoqyaezw",	/* 19572 */
+	"zkpdqm", "zkswxmnewct", "zktnkjogwhzqz", "zkvwhtvlwywz",	/* 19576 */
+	"zkwdyhlfsqonq", "zkxfu", "zl", "zlautvslmkienm",	/* 19580 */
+	"zlbcpskq", "zlccew", "zleagqk", "zlfxobwpezyrp",	/* 19584 */
+	"zlhbrtdicu", "zlkap", "zlkfnvzrhg", "zlkveussee",	/* 19588 */
+	"zlliawk", "zlm", "zlnmmrhvnwdg", "zlowhe",	/* 19592 */
+	"zlpildpricxz", "zlspntic", "zlv", "zlxli",	/* 19596 */
+	"zlxm", "zlxoecjp", "zlxw", "zlxxueqoexe",	/* 19600 */
+	"zlyaxaafmhe", "zm", "zmakizooynon", "zmaq",	/* 19604 */
+	"zmatgofqufet", "zmatxqiuge", "zmbr", "zmcm",	/* 19608 */
+	"zmd", "zmdiqvf", "zmdmq", "zmdwzz",	/* 19612 */
+	"zme", "zmevzwb", "zmgtohnmsem", "zml",	/* 19616 */
+	"zmltbbtekpb", "zmodtafspc", "zmp", "zmpg",	/* 19620 */
+	"zmtahunjq", "zmttdcrrbm", "zmwaqicvohk", "zmwuicjvqplhni",	/* 19624 */
+	"zmxqcfnyjgfd", "zmyeoj", "zmymgc", "zmymkc",	/* 19628 */
+	"zn", "znafuerrdj", "znarrt", "znclaixpklwkf",	/* 19632 */
+	"zncvgbbvh", "znegu", "znfbjieg", "znfkzicrgvvdpa",	/* 19636 */
+	"zngnt", "znidsguk", "znirjkylnollkm", "znkhcgbsvl",	/* 19640 */
+	"znl", "znlcqqavig", "znlukvlquea", "znnkt",	/* 19644 */
+	"znrsty", "znsoiexa", "zntpxsiotankdx", "znvi",	/* 19648 */
+	"znvqvbyjcmsfx", "znvsmdn", "znvy", "znwkcroxyquvhx",	/* 19652 */
+	"znxzkzicleq", "znyfvctb", "znyhcjnql", "znyiyvyy",	/* 19656 */
+	"znynkg", "zo", "zoacyognq", "zobchm",	/* 19660 */
+	"zobiudozqad", "zoenqyp", "zoepzboq", "zogmbjiakufyjy",	/* 19664 */
+	"zohuinhr", "zohvobdunezxm", "zoivjgeemzeluu", "zojdiymx",	/* 19668 */
+	"zojphadjajzn", "zomygmsaadikz", "zonarvgpqytae", "zongxik",	/* 19672 */
+	"zoomlglcitlrg", "zooprrwzkic", "zooz", "zop",	/* 19676 */
+	"zopenxvnqqiwkn", "zopngq", "zoqds", "zoqwrzrn",	/* 19680 */
+	"zotybkygbbpy", "zoujkhknj", "zovczisqdly", "zovnffcsmwemap",	/* 19684 */
+	"zovpwswic", "zowtxbvj", "zoybjwwusijw", "zoylphihuezkr",	/* 19688 */
+	"zoz", "zpacq", "zpaizqhq", "zpbnq",	/* 19692 */
+	"zpc", "zpdesmitgzrz", "zpdkxic", "zpejxnemszj",	/* 19696 */
+	"zpelkgfck", "zpewvw", "zpggoi", "zpitbaaivye",	/* 19700 */
+	"zpketxbzj", "zppif", "zpqglahsvxfpf", "zpsxhph",	/* 19704 */
+	"zpupybhtjfq", "zpvclzo", "zpxltlyubnmr", "zpy",	/* 19708 */
+	"zpzrzeym", "zpzzptv", "zq", "zqaipf",	/* 19712 */
+	"zqb", "zqbalmdglfb", "zqcegcn", "zqclcezv",	/* 19716 */
+	"zqebkmlvqk", "zqektmgzbugks", "zqhblpip", "zqhygjdysay",	/* 19720 */
+	"zqistdyjwrf", "zqj", "zqlhiqjzlo", "zqlwyrnppln",	/* 19724 */
+	"zqm", "zqmnkjjuyduz", "zqmnpp", "zqnmgjcbo",	/* 19728 */
+	"zqnuuo", "zqo", "zqp", "zqqme",	/* 19732 */
+	"zqrfc", "zqs", "zqu", "zqukbcyeifwfk",	/* 19736 */
+	"zqvamhrwcluf", "zqvsdbmjlzun", "zqxkoukaq", "zqyaolyt",	/* 19740 */
+	"zqyfpsxy", "zqyqjum", "zr", "zraiqsg",	/* 19744 */
+	"zraqnyawxuk", "zraqxgrgumb", "zrch", "zrdhdtwa",	/* 19748 */
+	"zred", "zrfhturwquwuyj", "zrh", "zrihooo",	/* 19752 */
+	"zrlp", "zrmbgnngaqghgx", "zrmtliakdq", "zrorcisoluxu",	/* 19756 */
+	"zrow", "zrsyhkpctckbuz", "zrwwxpnxezx", "zrxzyil",	/* 19760 */
+	"zryvszgn", "zryyzg", "zrz", "zs",	/* 19764 */
+	"zsaahgdklr", "zsb", "zsbvqnvxbphdka", "zscfxqvsgh",	/* 19768 */
+	"zsevvgee", "zsfiufrdtgybzp", "zsk", "zskitcz",	/* 19772 */
+	"zslwmerkn", "zsmm", "zsn", "zsnldtlwy",	/* 19776 */
+	"zspudbrhxqnzh", "zsqicw", "zsqsvakbxhpg", "zssmkhuwgryjer",	/* 19780 */
+	"zstxzux", "zsug", "zsugdlsoe", "zsujplhu",	/* 19784 */
+	"zsuoo", "zsvwzbktje", "zswfjhweeaqs", "zswzzwfbp",	/* 19788 */
+	"zsy", "zsymvpaws", "zt", "ztapuuob",	/* 19792 */
+	"ztavdtgpiut", "ztexoxcbtctv", "zthcrqvgtkt", "zthhjyrnpa",	/* 19796 */
+	"zthhrygpy", "ztjdhzuvvsnvc", "ztjl", "ztkabdlgww",	/* 19800 */
+	"ztm", "ztokrovuphwrba", "ztrgulgqijqxal", "ztrqbyhnlok",	/* 19804 */
+	"ztrrauzv", "ztryimvmlrd", "ztswjqr", "ztvhnovvt",	/* 19808 */
+	"ztvke", "ztvpuc", "ztvwlsiqnnr", "ztwkdwkxteq",	/* 19812 */
+	"ztwmcq", "ztwraljqoe", "ztybll", "ztyrabki",	/* 19816 */
+	"zu", "zuamtl", "zuaoepqc", "zuasgenk",	/* 19820 */
+	"zucc", "zuegwqporp", "zufdwg", "zufqln",	/* 19824 */
+	"zugxyyuqlj", "zuh", "zuixbwzobnxrg", "zuj",	/* 19828 */
+	"zukbkw", "zukojnzevat", "zukp", "zulecxttcru",	/* 19832 */
+	"zumdkavf", "zuosekzkz", "zuovparpca", "zuqainrupcscuc",	/* 19836 */
+	"zuqcu", "zuqqusyw", "zurpf", "zuruuknpbkl",	/* 19840 */
+	"zuslmamayeaq", "zuts", "zuu", "zuvfw",	/* 19844 */
+	"zuwewtvgj", "zuwxzhrw", "zuybljdo", "zv",	/* 19848 */
+	"zvcfxucmd", "zvcqe", "zvcrfrz", "zvdgtkf",	/* 19852 */
+	"zvdwonxk", "zvg", "zvgdegkrfunm", "zvhtdvslqsoq",	/* 19856 */
+	"zvhwgxolk", "zvijxbon", "zvjo", "zvlctorpxs",	/* 19860 */
+	"zvlgovrabdbs", "zvmw", "zvnazcblpdblrr", "zvnmmitmirswuo",	/* 19864 */
+	"zvovnaw", "zvpfdwog", "zvpi", "zvpjtoyz",	/* 19868 */
+	"zvqo", "zvrg", "zvrv", "zvrxwgfjnrf",	/* 19872 */
+	"zvsoislr", "zvssy", "zvtiarxatzegu", "zvtlfay",	/* 19876 */
+	"zvwzyxn", "zvxczprg", "zw", "zwahzegijy",	/* 19880 */
+	"zwblxbwebuntq", "zwbwwtub", "zwc", "zwcvdisng",	/* 19884 */
+	"zwdf", "zwdrulc", "zwezdcxm", "zwjrujyy",	/* 19888 */
+	"zwjsjnf", "zwksv", "zwlgk", "zwmduvldnlixd",	/* 19892 */
+	"zwno", "zwobvrjlav", "zwqdnluutph", "zwqihvrjkdmolx",	/* 19896 */
+	"zwr", "zwwddlvr", "zwxdnsiqxmfg", "zwxf",	/* 19900 */
+	"zwys", "zxalwrnbxnhsb", "zxbgdbrejx", "zxblz",	/* 19904 */
+	"zxcfrdfwr", "zxdfditkwpuulo", "zxdfkghohfqi", "zxdhpucjotro",	/* 19908 */
+	"zxghciuys", "zxgmwimg", "zxgtujonrrxbbl", "zxhpnohqdvege",	/* 19912 */
+	"zxjd", "zxjgpyjdfuyz", "zxjivtbd", "zxjnodurnznai",	/* 19916 */
+	"zxkroyohtuqonr", "zxkushamnb", "zxkzhilmwkbogy", "zxl",	/* 19920 */
+	"zxlw", "zxlz", "zxmsgnbbhhe", "zxoaaxglm",	/* 19924 */
+	"zxpwqggajb", "zxqgcqmrjlcwgs", "zxsqbroy", "zxubcffx",	/* 19928 */
+	"zxuuxkx", "zxv", "zxwbtr", "zxxglj",	/* 19932 */
+	"zxxtevjkujtlc", "zybcrhlviv", "zyd", "zydcp",	/* 19936 */
+	"zydte", "zyfgdxkvz", "zyhoyprcfyalb", "zyhury",	/* 19940 */
+	"zykhced", "zykphfqenklqw", "zym", "zymnnfscrczdh",	/* 19944 */
+	"zympp", "zymtnznoze", "zyn", "zynjxo",	/* 19948 */
+	"zyqclpffoiu", "zyqfkzw", "zyqgjfhvo", "zyrtccdsr",	/* 19952 */
+	"zysgpqvshhad", "zysxngovemd", "zyuvuozuov", "zywfpgso",	/* 19956 */
+	"zywku", "zywyogubeyzqlp", "zyxagu", "zyyl",	/* 19960 */
+	"zyzudgp", "zyzwxncsv", "zz", "zzadua",	/* 19964 */
+	"zzaeipxncq", "zzajnvxvpkrw", "zzciydg", "zzdpstxdanhr",	/* 19968 */
+	"zzeitbzrtnaz", "zzflfciaekvy", "zzfxvqdarep", "zzgkdxu",	/* 19972 */
+	"zzgwfoua", "zzhjtmia", "zzhtstvdx", "zzigxjgwapj",	/* 19976 */
+	"zzkeyr", "zzlbsyjihlh", "zzleprmenwp", "zzngcksbqbpvi",	/* 19980 */
+	"zzopthfz", "zzpncucfqff", "zzrqozu", "zzrvjmwzp",	/* 19984 */
+	"zzs", "zztsdt", "zzul", "zzuxbbtuamm",	/* 19988 */
+	"zzv", "zzvvt", "zzvwzzpitc", "zzvynaqeslspt",	/* 19992 */
+	"zzwbtdkufjgmw", "zzwrh", "zzwsafjjanz", "zzwtvgpycwdza",	/* 19996 */
+	"zzxbsseixo", "zzzlrq", "zzzuvnw", "zzzxfgzy",	/* 20000 */
+	};
+
+static uint32_t
+hash_static(const void * __restrict key, size_t keylen)
+{
+	static const uint64_t g[888] NBPERF_ALIGN64 = {
+		UINT64_C(0x9f6d350000000000), UINT64_C(0x1d4b103492ea82b8), UINT64_C(0x2b8666a282b97d2f),
+		UINT64_C(0x6429698105b934d2), UINT64_C(0x131da41bf964a019), UINT64_C(0x65018e94e54d225a),
+		UINT64_C(0x4bb3d7ed187c4723), UINT64_C(0xd86ef4acbdaca015), UINT64_C(0xa06b3400000000b7),
+		UINT64_C(0x4353f865c88b10d3), UINT64_C(0x550b2801b05e6507), UINT64_C(0xac0152428c742d1c),
+		UINT64_C(0x6774985f4511a141), UINT64_C(0x61b85b6738011d41), UINT64_C(0x34630949af8e8963),
+		UINT64_C(0x04a08b4489d7256a), UINT64_C(0x9f6f360000000174), UINT64_C(0x208d94d39ea38766),
+		UINT64_C(0x5734e60a9c081955), UINT64_C(0xe2664802151af5a4), UINT64_C(0x3806ab70b6850924),
+		UINT64_C(0xfdaa301b9a4b1c95), UINT64_C(0x1f0a7a1fab3988ee), UINT64_C(0x2a3398c76c931104),
+		UINT64_C(0xa46833000000022d), UINT64_C(0x34992bc288c786b5), UINT64_C(0xd9f32979c16a961e),
+		UINT64_C(0xe4cb29101149d801), UINT64_C(0xc67301615ccec050), UINT64_C(0x2611686245652990),
+		UINT64_C(0x228a867ee28a69e0), UINT64_C(0x332aa4a82010acc8), UINT64_C(0x97643400000002ed),
+		UINT64_C(0xc0437a3259bbd452), UINT64_C(0x17a6303e884d4096), UINT64_C(0xfba26fb54f9299ff),
+		UINT64_C(0x51802ce9d3952059), UINT64_C(0x56ddba47a8f1a617), UINT64_C(0x456ae7367500e796),
+		UINT64_C(0x66c6928144ae268b), UINT64_C(0xa9703800000003a1), UINT64_C(0x6a0400da236492e9),
+		UINT64_C(0x74e4b68a519b8e41), UINT64_C(0x0a2ad4b0ce8ee290), UINT64_C(0x9029515542de9409),
+		UINT64_C(0x0290525840a955ab), UINT64_C(0xc747029da34e4a08), UINT64_C(0x000a3edde4eb2167),
+		UINT64_C(0xa46f390000000462), UINT64_C(0x46ac1418fd5806aa), UINT64_C(0x40861481fa108031),
+		UINT64_C(0x0b5ef84432604201), UINT64_C(0x2e0630a57d100c50), UINT64_C(0xbd9f8d96ba3948d5),
+		UINT64_C(0x8a28a5818a0a5f9c), UINT64_C(0xec737ae36f96520c), UINT64_C(0xa37035000000051c),
+		UINT64_C(0xe4a7f6e292808e59), UINT64_C(0x061c34224855cb72), UINT64_C(0x46a7604ab1a05d20),
+		UINT64_C(0x14268a114966ace2), UINT64_C(0xcc34f406c8b9c250), UINT64_C(0x8bc358194d871959),
+		UINT64_C(0x43186422300977c2), UINT64_C(0x9f673500000005da), UINT64_C(0x7a681a9639150d6e),
+		UINT64_C(0x9b83e4c70e908831), UINT64_C(0xa6c477fc42bea15b), UINT64_C(0x3a6c7ea54568088d),
+		UINT64_C(0x312941aa10c85966), UINT64_C(0x595a778daea1d8e1), UINT64_C(0xfad23738d49e033a),
+		UINT64_C(0xa26633000000068f), UINT64_C(0x02b6cbde2004ee8e), UINT64_C(0x62346d6c6db51121),
+		UINT64_C(0x320b4528100485dc), UINT64_C(0x86a035ecb9d6ee3b), UINT64_C(0x8024981a9ea69644),
+		UINT64_C(0x0091d5894009d22c), UINT64_C(0x1705730d6a2a3099), UINT64_C(0x9d6936000000074c),
+		UINT64_C(0xaf30c19ba10bd119), UINT64_C(0x1f016a2630298666), UINT64_C(0x043fe5c2a58c4d98),
+		UINT64_C(0xd857724af1c64911), UINT64_C(0x3471053938149abd), UINT64_C(0xa7664978900c7cd8),
+		UINT64_C(0x066a639c22260994), UINT64_C(0xa36c340000000807), UINT64_C(0x0a81e3124c6e8898),
+		UINT64_C(0x8fae1004911dcbbb), UINT64_C(0x65396aa9aea52d95), UINT64_C(0x0f2a405416120f67),
+		UINT64_C(0x4497bba508d46821), UINT64_C(0x60d2a31aace01187), UINT64_C(0xc9f44b2804095cbc),
+		UINT64_C(0xa1683300000008c3), UINT64_C(0xd69af2884aad3d06), UINT64_C(0xdb1311c99ba6c11c),
+		UINT64_C(0x760ed19b198bc719), UINT64_C(0x85cd514090e6951e), UINT64_C(0x850550c98827a355),
+		UINT64_C(0x308a9893b85534a5), UINT64_C(0xa5543e549db8ba39), UINT64_C(0x9c6a32000000097e),
+		UINT64_C(0xcbe60c483387d98f), UINT64_C(0xf204d92852862c92), UINT64_C(0x0d99a9ba7605290c),
+		UINT64_C(0x01660a5d59b4eb44), UINT64_C(0xefe0d8630b04d116), UINT64_C(0xa9c3005b912e670b),
+		UINT64_C(0x192a98a5a64f432a), UINT64_C(0x9f672f0000000a37), UINT64_C(0x2a5d84d7cd715ab5),
+		UINT64_C(0x420cea252eecc2ff), UINT64_C(0x00db620064c6324a), UINT64_C(0x90db617622656398),
+		UINT64_C(0x185c9a70f6928512), UINT64_C(0x836918309f58a294), UINT64_C(0x4471299d07aeaf3d),
+		UINT64_C(0x9f6c380000000aee), UINT64_C(0x45da83a9414c9082), UINT64_C(0x25f13686e10246e9),
+		UINT64_C(0x26a635c78f448882), UINT64_C(0xcebb94e8aa39828c), UINT64_C(0xd4430bb28dea0eec),
+		UINT64_C(0x928e3291629b95ca), UINT64_C(0x6e9f64292ec285d7), UINT64_C(0xa56a370000000ba6),
+		UINT64_C(0xa41da0524de0a560), UINT64_C(0x3b91aa30ba064797), UINT64_C(0x46338f84f5256f18),
+		UINT64_C(0x8b9ee664938969c5), UINT64_C(0x18a2517696293a84), UINT64_C(0x0295afa02086a8b1),
+		UINT64_C(0x201845d94a9e8752), UINT64_C(0x9d6a340000000c68), UINT64_C(0x6422275128d81c78),
+		UINT64_C(0xbd365f0f18242b12), UINT64_C(0x3e642b25a9247763), UINT64_C(0x482286c2349c80e9),
+		UINT64_C(0x48a92b11a4cce3a0), UINT64_C(0xe05196f4f30c124d), UINT64_C(0xcc856cacec14e92e),
+		UINT64_C(0xa06b380000000d1d), UINT64_C(0x62064964c3119613), UINT64_C(0xdaa32a78196921dd),
+		UINT64_C(0x995cc18bc609d499), UINT64_C(0xa3168f365c74d2e6), UINT64_C(0xa83b5485faac972d),
+		UINT64_C(0xa80106934640caed), UINT64_C(0xa512626739b6022c), UINT64_C(0xa36b340000000dd9),
+		UINT64_C(0x2553254c5b5e4215), UINT64_C(0x96f15ccc683e82e2), UINT64_C(0x1179b212d48ad1fa),
+		UINT64_C(0x97990264e929d941), UINT64_C(0xd812201c6968a06f), UINT64_C(0x320445a22e1d0d46),
+		UINT64_C(0x659da2819314a652), UINT64_C(0xa36c360000000e9a), UINT64_C(0x8952fc2839fa5891),
+		UINT64_C(0x844c4362b822a2c4), UINT64_C(0x8227a4856658b88c), UINT64_C(0xd508c6a50cf75867),
+		UINT64_C(0x0ad8808e69f64d69), UINT64_C(0xec70a2171891501a), UINT64_C(0x38fcb7514284ea68),
+		UINT64_C(0xa471370000000f56), UINT64_C(0xd4a1ed8a4b112970), UINT64_C(0x429416ac48766d17),
+		UINT64_C(0x6a4540a6535a2b5d), UINT64_C(0x7d2a6e6208410011), UINT64_C(0x75144b6350a1193c),
+		UINT64_C(0xcd6ba4f0b6228d78), UINT64_C(0x818260726d94e850), UINT64_C(0xa56f340000001017),
+		UINT64_C(0x4c2e068d88cb1940), UINT64_C(0xb84f1e04453a0b07), UINT64_C(0xa905e06484285b34),
+		UINT64_C(0x1118361199c95202), UINT64_C(0x4352e912c4c82084), UINT64_C(0x26614c06337da64b),
+		UINT64_C(0x54616e2197a85076), UINT64_C(0x96602d00000010d9), UINT64_C(0x389f7c6067c2fd9e),
+		UINT64_C(0x6a26f64e8dfb62ab), UINT64_C(0x45b7173841d1a962), UINT64_C(0x80a8d6cc5dbbf528),
+		UINT64_C(0x15aa8bc821f10175), UINT64_C(0x0b872292f8e48180), UINT64_C(0xa210895e1e06dc6d),
+		UINT64_C(0x91642f000000118a), UINT64_C(0xb0cd566e273d1280), UINT64_C(0x1de9fc974fa5b8c5),
+		UINT64_C(0x598c6e0621681e40), UINT64_C(0x3d00ddcd2a5c2439), UINT64_C(0xdb4403c37938ea2f),
+		UINT64_C(0xf35531e1e6b124be), UINT64_C(0x251259087f154b95), UINT64_C(0xa46e370000001237),
+		UINT64_C(0x8381015314530853), UINT64_C(0xba1894402057313e), UINT64_C(0x424ad04881455923),
+		UINT64_C(0x43e7a345692a3c47), UINT64_C(0x5f185c8b91245131), UINT64_C(0x7b4d0969b150b180),
+		UINT64_C(0x2f5f1caae45c5981), UINT64_C(0xa16a3400000012f4), UINT64_C(0xf749548fa6843880),
+		UINT64_C(0x62e7bc0c78154850), UINT64_C(0xd1115a11fc0d8674), UINT64_C(0x6247366908491bc2),
+		UINT64_C(0x02e8781889da8651), UINT64_C(0x96a87cbd9e174680), UINT64_C(0x1a41d2366310833e),
+		UINT64_C(0x9e683200000013af), UINT64_C(0x125306ed1c27711e), UINT64_C(0x09c893b39a0e8e4c),
+		UINT64_C(0xea280681be220fad), UINT64_C(0x1414145502a6cddd), UINT64_C(0xeb908647716e10ec),
+		UINT64_C(0x7292629c5160957a), UINT64_C(0x7c180c1ca89da84a), UINT64_C(0xa8733c0000001468),
+		UINT64_C(0x641092a31e808ca3), UINT64_C(0xa6811a1515482162), UINT64_C(0xb1d52aba21a22aca),
+		UINT64_C(0x9b06b54617b44557), UINT64_C(0x8220a21ca162d75a), UINT64_C(0xd10750780ac7f8da),
+		UINT64_C(0x079f7b38d2ae4368), UINT64_C(0x905f2f0000001527), UINT64_C(0xb05f31bc43a5606e),
+		UINT64_C(0x6742fddb0db9c295), UINT64_C(0xcd09f91d36f65de4), UINT64_C(0x8db0948c5a5b2e31),
+		UINT64_C(0x05e192d2a2f353f3), UINT64_C(0x3c66e4ba51c09355), UINT64_C(0x3543b0000131705e),
+		UINT64_C(0x96623500000015d1), UINT64_C(0x166d644915e91b6e), UINT64_C(0xc28c467acdc0559c),
+		UINT64_C(0xa3979c37de8bef2c), UINT64_C(0x9bb571a432bae175), UINT64_C(0x69e1225f298f5763),
+		UINT64_C(0x202c303a14a53c61), UINT64_C(0x6536fdb47842ce56), UINT64_C(0xa7743c000000167f),
+		UINT64_C(0xa6586495a000a274), UINT64_C(0x002927961483c615), UINT64_C(0x72ea464d1aae12b9),
+		UINT64_C(0x10b5293968415321), UINT64_C(0x2db9466d22242ead), UINT64_C(0xc7b610ee445ebab4),
+		UINT64_C(0x2e184a1f729332d5), UINT64_C(0xa86e37000000173f), UINT64_C(0x78553c72d32c6660),
+		UINT64_C(0x1a006315184104d1), UINT64_C(0x68b699b187a099af), UINT64_C(0xc89293a15a0ed095),
+		UINT64_C(0x6d998105001ab582), UINT64_C(0xa91b1909c828acc8), UINT64_C(0x22f33d3a62968114),
+		UINT64_C(0x9864300000001801), UINT64_C(0x5e9218b43c7ff71d), UINT64_C(0x2e65f3214ba68469),
+		UINT64_C(0x55c89fe0716a908c), UINT64_C(0x527131ed57ad511a), UINT64_C(0xba43769ba5579543),
+		UINT64_C(0x1b212f5a01f66a70), UINT64_C(0xc31e961e4905a249), UINT64_C(0xa06b3300000018b5),
+		UINT64_C(0xa8f19854372da670), UINT64_C(0xed02268c2e07f611), UINT64_C(0x340196a9a4ccea78),
+		UINT64_C(0x9e8aa108c4823965), UINT64_C(0x1f5c2c104456d007), UINT64_C(0x520c50327326a467),
+		UINT64_C(0x2667443709012ac5), UINT64_C(0x9e6b340000001971), UINT64_C(0x6867c8270bc146b1),
+		UINT64_C(0x5d434381a2c91b0d), UINT64_C(0xe849f155a9a9b08b), UINT64_C(0xe9f280285160a172),
+		UINT64_C(0xd2166a92f715191b), UINT64_C(0x8fe8e2dca67e1204), UINT64_C(0x98f004031455a184),
+		UINT64_C(0x996a330000001a2c), UINT64_C(0x03b6a828161fe747), UINT64_C(0x3293148c423de91a),
+		UINT64_C(0x35213101dbb858e3), UINT64_C(0x16a861a41a43ca20), UINT64_C(0xb15cc89c143ab037),
+		UINT64_C(0x6e838ef55fa6dc14), UINT64_C(0x62810ca468524b09), UINT64_C(0x9a61320000001ae3),
+		UINT64_C(0x6702e2b460443f35), UINT64_C(0x32fed79568558979), UINT64_C(0x76e2b712c1c4c453),
+		UINT64_C(0x1b15801f8cfc3927), UINT64_C(0x85c836d945dde288), UINT64_C(0xa95600956504d594),
+		UINT64_C(0x44250aea1b987241), UINT64_C(0xa66f370000001b9a), UINT64_C(0x69484519d5dc4c19),
+		UINT64_C(0x6b1c91939c159676), UINT64_C(0xf022221e6618a1f6), UINT64_C(0x2ade81662534a206),
+		UINT64_C(0x51e546b251003d5b), UINT64_C(0x488de58c121a446b), UINT64_C(0x1e650a6d2b21511c),
+		UINT64_C(0x9d64340000001c5c), UINT64_C(0x64b28ba60d4840bc), UINT64_C(0xee9c69a03389c447),
+		UINT64_C(0x6942517d2931f12f), UINT64_C(0x19c2fdf02d5840c3), UINT64_C(0x510045d608730ae9),
+		UINT64_C(0x19d11c00d6299954), UINT64_C(0x366a4d34f0a06c29), UINT64_C(0xad74370000001d13),
+		UINT64_C(0x6d099f54f8ab8116), UINT64_C(0x9824ed0a40466174), UINT64_C(0x0415d4aaa8a88224),
+		UINT64_C(0x96281a4203aa0714), UINT64_C(0xaaa2a64c0d808c6c), UINT64_C(0x2a507459d5654d69),
+		UINT64_C(0xae9400c0dd63c380), UINT64_C(0xa16c350000001dd9), UINT64_C(0x979c12ae9aabc80c),
+		UINT64_C(0x3f250d219b52a628), UINT64_C(0xcc17a888c4325392), UINT64_C(0x9f9061667a245660),
+		UINT64_C(0x2b6c059633f28e92), UINT64_C(0x915656439805de6e), UINT64_C(0x3d09e5ae61217c06),
+		UINT64_C(0xa16d360000001e94), UINT64_C(0x5998b6632872d3a9), UINT64_C(0x44941db084af6b14),
+		UINT64_C(0x99a83e32527b1b7a), UINT64_C(0x92a8150b1a067014), UINT64_C(0x413caa8163a73301),
+		UINT64_C(0x6b0b0b928f257869), UINT64_C(0x8769129a081d884a), UINT64_C(0x9d67380000001f53),
+		UINT64_C(0x1402741321107010), UINT64_C(0x0b33b885e4862a1a), UINT64_C(0x073f831e72ea430d),
+		UINT64_C(0x494b3da2fe301688), UINT64_C(0x160bd02278daa6cd), UINT64_C(0x410082ca8c69d760),
+		UINT64_C(0x9528a49ec04cc9b9), UINT64_C(0xa87234000000200b), UINT64_C(0x131ef659c0ab04b2),
+		UINT64_C(0xa892714a71d3966b), UINT64_C(0x4604882002114123), UINT64_C(0x84a8502c426aa602),
+		UINT64_C(0x7d59d845a78a24c6), UINT64_C(0xe9e2a5264ee1860c), UINT64_C(0x2390351ba692e302),
+		UINT64_C(0xa36c3600000020ce), UINT64_C(0x1355a5da9553429a), UINT64_C(0x7007e6ca8b448ca3),
+		UINT64_C(0x4d982588f57ba042), UINT64_C(0x4596122f082ea39c), UINT64_C(0x618aa06c26ed0801),
+		UINT64_C(0xee9048802e64e8cd), UINT64_C(0x9af4bd7a0458c29b), UINT64_C(0xa86f36000000218a),
+		UINT64_C(0xb42bb06565e2762b), UINT64_C(0x7490caa00985c710), UINT64_C(0x558f52b964ead480),
+		UINT64_C(0x1c26149695402031), UINT64_C(0x79118758a1289e66), UINT64_C(0x2dd9b541d22256a2),
+		UINT64_C(0xac216b67280809a3), UINT64_C(0xa57339000000224e), UINT64_C(0x1758eb242458e944),
+		UINT64_C(0x4caeaab885aa5061), UINT64_C(0xc049055a58455879), UINT64_C(0x0411861ba028ae0f),
+		UINT64_C(0x70358d44c124cae6), UINT64_C(0xb8f73180ca2d9517), UINT64_C(0x422eae8585854097),
+		UINT64_C(0x9e68320000002310), UINT64_C(0x390de62ed2e7b416), UINT64_C(0x1ed46bb44c3a8506),
+		UINT64_C(0x5d6a54652f390b2e), UINT64_C(0x65a3a8e1496bc501), UINT64_C(0x47489aa18aae291c),
+		UINT64_C(0x7520dbc6554332e2), UINT64_C(0x781b8a950ba864ae), UINT64_C(0x99643100000023ca),
+		UINT64_C(0x58f05158245ecead), UINT64_C(0x9c75674663581ffe), UINT64_C(0x2d8741b59ac94516),
+		UINT64_C(0x00665e7c8fef49c6), UINT64_C(0x993991a1a0590c2b), UINT64_C(0xd99b9a755fb348c9),
+		UINT64_C(0x5e53888537a5089c), UINT64_C(0x9c6935000000247e), UINT64_C(0xe9ce7744b56d6942),
+		UINT64_C(0x282066a03612076f), UINT64_C(0x05e57273625cac00), UINT64_C(0xb1e614d7ab5815b8),
+		UINT64_C(0x463ac190481ffc28), UINT64_C(0x9c11c88af6d621d9), UINT64_C(0xb01e20126b048810),
+		UINT64_C(0xa16d370000002537), UINT64_C(0x9ea64825c6027446), UINT64_C(0xc961a3549e4ee95d),
+		UINT64_C(0x873c3a28be914a5c), UINT64_C(0x81a000045cf92911), UINT64_C(0xf27eaac4813562b8),
+		UINT64_C(0x961981680dd6139f), UINT64_C(0x855279648cb40262), UINT64_C(0xaa733800000025f5),
+		UINT64_C(0xc62674a200a00b28), UINT64_C(0x63db5991aa8561cc), UINT64_C(0x1516b6a542a628e4),
+		UINT64_C(0x67560230b4229080), UINT64_C(0xda3aa1950411b899), UINT64_C(0xc6298d0be399452d),
+		UINT64_C(0x6770213de2d00162), UINT64_C(0x9e6b3500000026b9), UINT64_C(0x52100a489e60e6bd),
+		UINT64_C(0x210c29eeef816e96), UINT64_C(0x3507c0a5c2415b66), UINT64_C(0x42c464bb984149e3),
+		UINT64_C(0xdc4fe93044dec829), UINT64_C(0x8523aad8469813ca), UINT64_C(0x29119d7137848279),
+		UINT64_C(0xa36e390000002772), UINT64_C(0x96491668994691f7), UINT64_C(0x5c944022f9453024),
+		UINT64_C(0xb85e864850b0d4b1), UINT64_C(0x0a309bf9da275a89), UINT64_C(0x2ed6300142239d38),
+		UINT64_C(0x6c84a31f0b481842), UINT64_C(0xd91a9dab1fe7959b), UINT64_C(0x9f6b38000000282d),
+		UINT64_C(0x2a02cda6718b1022), UINT64_C(0x43926aea8e685031), UINT64_C(0x282441df9c1edc7a),
+		UINT64_C(0x1e09cc19893411d6), UINT64_C(0x35926518b5d443b5), UINT64_C(0xa7cb0d139474985b),
+		UINT64_C(0xa9a750bec8393cd5), UINT64_C(0x9a643500000028e4), UINT64_C(0x148182e7f4a60b2d),
+		UINT64_C(0x2d4c59852c06ac76), UINT64_C(0x04baeca152b8dab6), UINT64_C(0x2b8a03ad5cc3d3ef),
+		UINT64_C(0x68228db45929a83d), UINT64_C(0x0458d0f6087ec808), UINT64_C(0xe1887ad796069978),
+		UINT64_C(0xa56c370000002999), UINT64_C(0x26a02aec519ad116), UINT64_C(0x28979aab27586773),
+		UINT64_C(0x5a8525707a595843), UINT64_C(0x47cd9819525377db), UINT64_C(0x2585ca8d872ad891),
+		UINT64_C(0x1a6517a0a11a348e), UINT64_C(0x1a718ae2c9864ea2), UINT64_C(0x9f6a360000002a5a),
+		UINT64_C(0x91a5a2416974fdaa), UINT64_C(0xa38477407f418561), UINT64_C(0xeeb06c03cf58b42b),
+		UINT64_C(0x1a741e521528992a), UINT64_C(0x4494b7864a6b1756), UINT64_C(0xd07ead10c2b5560c),
+		UINT64_C(0x04998848a8840087), UINT64_C(0xa46e380000002b18), UINT64_C(0xa489548605412fa8),
+		UINT64_C(0x70e93941d4b06c69), UINT64_C(0xc836ea0250dc2931), UINT64_C(0x4472126352dd55a4),
+		UINT64_C(0xd28a3d907c094904), UINT64_C(0x0ed5d02ca2248d46), UINT64_C(0x695c7e7a146a4813),
+		UINT64_C(0x9c6a360000002bd7), UINT64_C(0x2955c7020c849de9), UINT64_C(0x882ad3f5e2956592),
+		UINT64_C(0x94884c9500af32a7), UINT64_C(0x160cf2264bacba74), UINT64_C(0x4c55abb023191d63),
+		UINT64_C(0xcc8893a4700dcf41), UINT64_C(0x4d61799672b02251), UINT64_C(0xa46d380000002c8f),
+		UINT64_C(0xaba6ea9702f20265), UINT64_C(0xa9126360e18c2a65), UINT64_C(0xa4409cc0bca378c3),
+		UINT64_C(0x8156d2b601e90659), UINT64_C(0x24d7a8c979a70684), UINT64_C(0x55560469cc27661e),
+		UINT64_C(0x1cc9a10e2401599a), UINT64_C(0xa36c350000002d50), UINT64_C(0x224ad58b1f20f2da),
+		UINT64_C(0xa484401e93cab195), UINT64_C(0x386a3282536149a4), UINT64_C(0x521094557cee270e),
+		UINT64_C(0x046a269c5631ea9a), UINT64_C(0xb26064737e200c10), UINT64_C(0xcac5ba001ab7ca47),
+		UINT64_C(0x9e67330000002e0c), UINT64_C(0xa3c0a40bd971bd0d), UINT64_C(0xe501ada1a528c47b),
+		UINT64_C(0x70044c4aba0a5f22), UINT64_C(0x7355e6d61e96da0e), UINT64_C(0x0155a500c440a411),
+		UINT64_C(0xff10316445083c74), UINT64_C(0xa240c4c88c7cf402), UINT64_C(0xad73350000002ec3),
+		UINT64_C(0x096781d02892174b), UINT64_C(0x92f3f0092b61b102), UINT64_C(0x64018296405609a2),
+		UINT64_C(0x21214ec810195161), UINT64_C(0x8044600421221015), UINT64_C(0xb4c5b2c2a5814cd6),
+		UINT64_C(0x6f05701a66ac0851), UINT64_C(0x955e310000002f8c), UINT64_C(0x041caf7740bc0d9e),
+		UINT64_C(0xe81e03434ec2a610), UINT64_C(0x022f8621d38c30cb), UINT64_C(0x7138e0eccec79abd),
+		UINT64_C(0x84a06ed81429f84f), UINT64_C(0x161479896a42ba67), UINT64_C(0x02f1e28fa3a90541),
+		UINT64_C(0x945f31000000303b), UINT64_C(0xdeed5aea9f5b611e), UINT64_C(0x612c91da32f165d1),
+		UINT64_C(0x30366b47366dd6b6), UINT64_C(0xd2dd09375ec6d70c), UINT64_C(0x72722749ad8b460e),
+		UINT64_C(0x653574f286b090a1), UINT64_C(0x63f76928b7885750), UINT64_C(0x96653800000030e8),
+		UINT64_C(0x60a7c9ec6b4681a9), UINT64_C(0x290229ca13324aa8), UINT64_C(0xd28caf79bcc57aa9),
+		UINT64_C(0x176421ddede3ee3a), UINT64_C(0xc2300a0d35187ddb), UINT64_C(0xee258ec1d8adb408),
+		UINT64_C(0x25b3888a71a92a51), UINT64_C(0x9d652b000000319b), UINT64_C(0x37eab7633b06f6ff),
+		UINT64_C(0x031097cf30910d24), UINT64_C(0x9488e40da814af0a), UINT64_C(0x90794257a40885aa),
+		UINT64_C(0xd555600849024105), UINT64_C(0x169bad3e1c8af619), UINT64_C(0x331ea22224e6b859),
+		UINT64_C(0xa76f350000003253), UINT64_C(0x43e02a512280d0a1), UINT64_C(0x8b02bc16ac86eb4f),
+		UINT64_C(0xb35c5fa524625218), UINT64_C(0x28e6114162920945), UINT64_C(0x42b12ba1156c643b),
+		UINT64_C(0x559860ad925531a3), UINT64_C(0xb12800408294a9e6), UINT64_C(0x9c67310000003318),
+		UINT64_C(0x176721d9e71cee52), UINT64_C(0x69b91676301f765c), UINT64_C(0x75606f48059f3e57),
+		UINT64_C(0xb8c180020a602204), UINT64_C(0x1064424c4497723f), UINT64_C(0xa6a164831413ab2f),
+		UINT64_C(0x492201b2eaeca7f3), UINT64_C(0x96633500000033cc), UINT64_C(0x232d6c49571da528),
+		UINT64_C(0x29b40bd1254b3163), UINT64_C(0xe3cb5d9af59282df), UINT64_C(0x97cacb2abc2d36aa),
+		UINT64_C(0xa36e556917c15e53), UINT64_C(0x763d5af386910670), UINT64_C(0x4238e80126ca067f),
+		UINT64_C(0x925e2d000000347c), UINT64_C(0x3eb63ef1f492fefd), UINT64_C(0xdb88163a474511a6),
+		UINT64_C(0xe07131270577d293), UINT64_C(0x3aae6177ade89474), UINT64_C(0xb00030b84b7398c4),
+		UINT64_C(0xba86aa0f891189be), UINT64_C(0x7066ae11b47685fd), UINT64_C(0x8a582e0000003527),
+		UINT64_C(0x2679a4f694f0d1d4), UINT64_C(0x082cf975fee95fc1), UINT64_C(0x7e233795c99a0354),
+		UINT64_C(0xd1dcd7d4f9ff383e), UINT64_C(0x69fa964285a002ab), UINT64_C(0xd8ef13acd4cd43c8),
+		UINT64_C(0x06a8243a46aa8c61), UINT64_C(0x945f3400000035cf), UINT64_C(0x2b2096e60e51ba8f),
+		UINT64_C(0x9610c5e4ab66530f), UINT64_C(0x3ff104736afc912d), UINT64_C(0x38cc0ac3db0989df),
+		UINT64_C(0x221374ca96493522), UINT64_C(0x8550ad326cf43a2b), UINT64_C(0x33877d55159c7c53),
+		UINT64_C(0x935f32000000367a), UINT64_C(0x84fa56346b5a963e), UINT64_C(0xf1699374473e8e01),
+		UINT64_C(0x126cdcc735d33024), UINT64_C(0xeafab7b6910d3da7), UINT64_C(0x6a639eb942a7c393),
+		UINT64_C(0x56510087e35ba963), UINT64_C(0xb62beca446286344), UINT64_C(0x8f5b2c0000003728),
+		UINT64_C(0x70cfcf3fa6518579), UINT64_C(0x8637932020dabfcb), UINT64_C(0xd8fca1c96b01c571),
+		UINT64_C(0xb887707a8be2af83), UINT64_C(0xb1797a9780064a39), UINT64_C(0x6e8129b410fd9e32),
+		UINT64_C(0x6a03ebf2d3550eb3), UINT64_C(0x8f612a00000037cd), UINT64_C(0xf88cf7cc9f863f33),
+		UINT64_C(0x088b47bd50e1f84a), UINT64_C(0xd59c1bd046448b42), UINT64_C(0x69392d49aaf616a0),
+		UINT64_C(0xd23acba86a8fd24f), UINT64_C(0x19025e271f4f703e), UINT64_C(0x44640ece7c97bb0f),
+		UINT64_C(0x9466340000003872), UINT64_C(0x7e93de25a805baa6), UINT64_C(0x11c7a302b286193c),
+		UINT64_C(0xcc6755ce792acd76), UINT64_C(0x244260cf68656837), UINT64_C(0x51efadd09ed6a3cb),
+		UINT64_C(0xf43d8f593989630a), UINT64_C(0x7e0258ee62086608), UINT64_C(0x905a310000003922),
+		UINT64_C(0x46fbc9014fb132fc), UINT64_C(0x111675acd5104780), UINT64_C(0xd8fd079d7f17b7ca),
+		UINT64_C(0x2eb934dc4b7c94f4), UINT64_C(0xc58837c0aa2727a6), UINT64_C(0x660045c9509f03a9),
+		UINT64_C(0x25f50adc46b55120), UINT64_C(0x8a5d3000000039cd), UINT64_C(0xc57fd15fdd9c3291),
+		UINT64_C(0x69136cdc4280ad2a), UINT64_C(0x65cfa1acd31bc57d), UINT64_C(0xc31cae4ee6b9ed54),
+		UINT64_C(0x34f7dc679563dce1), UINT64_C(0x024c87379913b05f), UINT64_C(0x886b3d27f31123da),
+		UINT64_C(0x935f310000003a6e), UINT64_C(0x099600676acd91e6), UINT64_C(0xd966d8f5a33bf20f),
+		UINT64_C(0x03d3b434ec345084), UINT64_C(0x4713d567f3f2ae04), UINT64_C(0xf52843f8428d25c8),
+		UINT64_C(0xf01f91429a385a46), UINT64_C(0x6ca7dd7e0ad984fa), UINT64_C(0x9262330000003b18),
+		UINT64_C(0x043c5854d6308ad7), UINT64_C(0xa7e922419e733c80), UINT64_C(0x3cf948d1a0e67a31),
+		UINT64_C(0x1c4b2c2e935bdd6e), UINT64_C(0xcd96831d6c15c479), UINT64_C(0x979f8c579db63c9a),
+		UINT64_C(0x4c9b4862c646310e), UINT64_C(0x93632f0000003bc5), UINT64_C(0x3dd87850c84eafd2),
+		UINT64_C(0x1648eaa323d7d1dc), UINT64_C(0xcb2f426820c831aa), UINT64_C(0x711f614d63136a8a),
+		UINT64_C(0x01a8f6a0c2eba536), UINT64_C(0x8ac3d1c97379d67d), UINT64_C(0x34dc154204154619),
+		UINT64_C(0x8e60330000003c75), UINT64_C(0x5f92b3455926a60e), UINT64_C(0x7250d568cd1c8edc),
+		UINT64_C(0xc12f796e37a2f665), UINT64_C(0x65c1b3e1b75c2c5f), UINT64_C(0x49492d6fed04fd34),
+		UINT64_C(0x8aa1c8d2fddb43e0), UINT64_C(0x9b47c0fb60279252), UINT64_C(0x8d5f310000003d1c),
+		UINT64_C(0x7131f1b3b9d0570b), UINT64_C(0x02808117221adbdd), UINT64_C(0xb69fea44c0bd0f02),
+		UINT64_C(0x3f8a26de45c29fd0), UINT64_C(0x3aef5f0fc813c68c), UINT64_C(0x376e78d965366120),
+		UINT64_C(0x6e31d6d6b830614b), UINT64_C(0x915e310000003dc2), UINT64_C(0xfea17399dde87593),
+		UINT64_C(0x13410785c600d9a3), UINT64_C(0xe474f3d5cc26f63d), UINT64_C(0xea65c60f15fd8250),
+		UINT64_C(0xeded0194a6a959ba), UINT64_C(0xec68db865e04cdc8), UINT64_C(0xb6260d6d360e7c08),
+		UINT64_C(0x9868350000003e6c), UINT64_C(0x503414b422228149), UINT64_C(0x12334f3e02b94707),
+		UINT64_C(0x2c744e977c4ffc51), UINT64_C(0x1e25660863984619), UINT64_C(0xe2d4a52e095bbf5b),
+		UINT64_C(0x3cd8e002c523b2ca), UINT64_C(0xcff2014894e8895b), UINT64_C(0x93652d0000003f1d),
+		UINT64_C(0xde0d792ef06fa683), UINT64_C(0xde4bc300d5ba1d0d), UINT64_C(0x0135150b48556383),
+		UINT64_C(0x4a05263987b03692), UINT64_C(0xf5776586c1e1db80), UINT64_C(0x35e8795f2f236ab7),
+		UINT64_C(0x0d04442e014fddad), UINT64_C(0x8c5a310000003fc9), UINT64_C(0x372001dc58cb58ab),
+		UINT64_C(0x05ce9a840dfc0b0b), UINT64_C(0xb1b1710e53fc4cb0), UINT64_C(0xddf57f04fceaed12),
+		UINT64_C(0x12d42015d6a99dd3), UINT64_C(0xad8c0fee35382871), UINT64_C(0x32015a2fe0907459),
+		UINT64_C(0x915e2d0000004070), UINT64_C(0xd660d7d3db1a5952), UINT64_C(0x7db35ddb5f28a3af),
+		UINT64_C(0x3407f5800f01a75d), UINT64_C(0x4bf5d463a5493796), UINT64_C(0xe475086f2f0079c8),
+		UINT64_C(0xbb60a39565f08421), UINT64_C(0xf904856dea9546c5), UINT64_C(0x8d5f2d000000411c),
+		UINT64_C(0x4239bcf7242dbf85), UINT64_C(0xbd831cd503d57ba1), UINT64_C(0xac884b757478e232),
+		UINT64_C(0x521709ea1b807c37), UINT64_C(0x5b6f45c7ce7b868d), UINT64_C(0x97b54bee9bcb9652),
+		UINT64_C(0x1c0d041953277e47), UINT64_C(0x8f5d2e00000041c2), UINT64_C(0xc678590c8d7f74f2),
+		UINT64_C(0x8b2be112e90bb3ba), UINT64_C(0xbece28cdd6c9b8f1), UINT64_C(0x90fadd46e98565a7),
+		UINT64_C(0xe2ca8a7c9179da4f), UINT64_C(0x80e42278a850e3cc), UINT64_C(0x64132fcaf858d0f4),
+		UINT64_C(0x9c66320000004268), UINT64_C(0xa858b755506f8f8d), UINT64_C(0x3731265c638b01c0),
+		UINT64_C(0xe7eabe0588410380), UINT64_C(0x1650dd8560bab13c), UINT64_C(0x9c8a2012e055198d),
+		UINT64_C(0x0ad7240e31a3ac87), UINT64_C(0x159a9e4f00b46618), UINT64_C(0x905f300000004320),
+		UINT64_C(0x9181cfeda90c8230), UINT64_C(0xe2325960e3fabb32), UINT64_C(0x443ade26867d97d1),
+		UINT64_C(0xdfa1de674df288d0), UINT64_C(0xccc65895252908db), UINT64_C(0xbf6da83659d32d0f),
+		UINT64_C(0x7a7fb11ae6fc6324), UINT64_C(0x94613000000043c6), UINT64_C(0x8b1698af3c86cce7),
+		UINT64_C(0xf2739ca321a42da9), UINT64_C(0xae83186e4c5d06b4), UINT64_C(0xcee8a79d550c6dcd),
+		UINT64_C(0x877679373482a01a), UINT64_C(0x098bdcb2418672f5), UINT64_C(0xf9a0074f695d4413),
+		UINT64_C(0x8d62300000004473), UINT64_C(0xde1c5436c1021369), UINT64_C(0x02dc64b023f0f04f),
+		UINT64_C(0x73181a14ddd216ef), UINT64_C(0xa207105acb0f3244), UINT64_C(0x97de237369ea8d35),
+		UINT64_C(0xf55b9cd7e2e6e3db), UINT64_C(0x58272d8096c4b861), UINT64_C(0x926130000000451c),
+		UINT64_C(0x550592178f939f5f), UINT64_C(0x9d91a0bc9c60fb76), UINT64_C(0x097cc30b46393bad),
+		UINT64_C(0x39db9af94e4482a4), UINT64_C(0xb4f00bb09e60c585), UINT64_C(0x49dd7513c47d126b),
+		UINT64_C(0x2d888a24d7228563), UINT64_C(0x99643100000045ca), UINT64_C(0x2e6c854f0e3031b2),
+		UINT64_C(0xe893a2538e0277e6), UINT64_C(0xc52d71a81288b5ec), UINT64_C(0xb16d8c4296792e7d),
+		UINT64_C(0x81c2ce4461a5b706), UINT64_C(0x8665768317f3a228), UINT64_C(0xfb6b7c801b66aafd),
+		UINT64_C(0x8d5e2e0000004679), UINT64_C(0xfdf833615500839e), UINT64_C(0xb77c28d1afe200ac),
+		UINT64_C(0x51dc5778a41210c3), UINT64_C(0xe2cdee6ecd92bca8), UINT64_C(0xc577b56dae59b3d8),
+		UINT64_C(0x9797a0acecc0ab2e), UINT64_C(0x8a3591706b052cc4), UINT64_C(0x8b5c310000004721),
+		UINT64_C(0x9401d3d53f85472a), UINT64_C(0xda8d2b130ecd08e4), UINT64_C(0x9fb7d32b22395b87),
+		UINT64_C(0xc55710fc1c2fbd53), UINT64_C(0xb8357434c62035fa), UINT64_C(0xff9346c96c406f19),
+		UINT64_C(0x9f063460be7e9f27), UINT64_C(0x9d633200000047c2), UINT64_C(0xcbd9112f1878c1a3),
+		UINT64_C(0xb03839119a53fa82), UINT64_C(0x0b38043c670ec108), UINT64_C(0x7f941391d9fd690a),
+		UINT64_C(0x4508a7214678ae79), UINT64_C(0x120955485ae69740), UINT64_C(0x70ac166031bf7420),
+		UINT64_C(0x9260350000004878), UINT64_C(0x445ac7bfd1339517), UINT64_C(0x97905504b5549619),
+		UINT64_C(0x6f0fc9818d48fed3), UINT64_C(0xbf4fc4938e92e329), UINT64_C(0xc90c72a9034f5308),
+		UINT64_C(0x83d2c2c697c915c0), UINT64_C(0x1767beec58e3b156), UINT64_C(0x8859310000004921),
+		UINT64_C(0x0ecfd29f5d231408), UINT64_C(0x329efe50aa5e2646), UINT64_C(0xe9fbf0e47f413ff8),
+		UINT64_C(0x39341cc4967c2f6e), UINT64_C(0x5c73c5a08f2ce9e1), UINT64_C(0xa33d0997eb853759),
+		UINT64_C(0x1607e05b243462d2), UINT64_C(0x8b5c2900000049c4), UINT64_C(0xad5ebfdc57b5fdb4),
+		UINT64_C(0xdf8ca525c1435fed), UINT64_C(0xf51027bb6e3a987b), UINT64_C(0xa9c1d02011a59323),
+		UINT64_C(0xe1ccaeadf33134bf), UINT64_C(0x922e05763086a6ac), UINT64_C(0xdea2ba0e724813ff),
+		UINT64_C(0x925e320000004a65), UINT64_C(0x638fdd8a4707c4a6), UINT64_C(0xbd85563066d37812),
+		UINT64_C(0x6c1e723367d5c021), UINT64_C(0x8bb89443efbb9edf), UINT64_C(0x3410846bd572497a),
+		UINT64_C(0x2f96766809c252f7), UINT64_C(0xfee3cfdbd9d239f2), UINT64_C(0x9161310000004b08),
+		UINT64_C(0x000bb42137fd9176), UINT64_C(0xac11979efd06286d), UINT64_C(0x09d903e6c79c4b4d),
+		UINT64_C(0xe0be544052e80f4f), UINT64_C(0xbea48b63f63f6036), UINT64_C(0x001b1244bc2e4f06),
+		UINT64_C(0x8f1e02c60511b2ec), UINT64_C(0x88592d0000004bb2), UINT64_C(0x15dc50e9fdb48eee),
+		UINT64_C(0xfc23ced92a67481b), UINT64_C(0xd8c1fb564c331dd3), UINT64_C(0xdf934eadd8c6029e),
+		UINT64_C(0x88abeea8561faecd), UINT64_C(0x3d75f614b1524cbc), UINT64_C(0x4fea05632ba4480d),
+		UINT64_C(0x9465350000004c54), UINT64_C(0x994be58d2f57a7c2), UINT64_C(0xeca575108a95988a),
+		UINT64_C(0x38c1ae2c1d326376), UINT64_C(0x13f52830e3301d25), UINT64_C(0x5c8a745666988158),
+		UINT64_C(0x18cff0f5bbe75cfe), UINT64_C(0xa0a70da608fedaea), UINT64_C(0x9266340000004d01),
+		UINT64_C(0x5953370226bf44b2), UINT64_C(0xc1288941ab67d45d), UINT64_C(0x1587fe94cc4363b6),
+		UINT64_C(0x0b7aa0d00352a81b), UINT64_C(0x01764d0e56f5387b), UINT64_C(0x7f5630e2f3f43d11),
+		UINT64_C(0x3c8688d6c98429d6), UINT64_C(0x7659270000004dae), UINT64_C(0x5ac1efff1e93fd51),
+		UINT64_C(0xdf828d70ffe26335), UINT64_C(0x77840272e12b09dd), UINT64_C(0x7199bc72e83549c2),
+		UINT64_C(0x8f15a17f212d82d0), UINT64_C(0xffffffffffffff00), UINT64_C(0xffffffffffffffff),
+	};
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t result;
+	uint32_t vertex;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+	h[0] = h[0] % 24800;
+	h[1] = h[1] % 24800;
+	h[2] = h[2] % 24800;
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 24800;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	result = base_rank;
+	return (strcmp(hash_static_keys[result], key) == 0) ? result : (uint32_t)-1;
+}
+
+/* run-time overflow table for keys added after generation */
+static const char *hash_overflow_keys[8];
+static size_t hash_overflow_lens[8];
+static uint32_t hash_overflow_count;
+void (*hash_rebuild_hook)(uint32_t count);
+
+static inline uint32_t
+hash_overflow_slot(const void * __restrict key, size_t keylen)
+{
+	const unsigned char *p = (const unsigned char *)key;
+	uint32_t h = UINT32_C(0x811c9dc5);
+	while (keylen--)
+		h = (h ^ *p++) * UINT32_C(0x01000193);
+	return h & 7;
+}
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	uint32_t result = hash_static(key, keylen);
+	if (result < 20000)
+		return result;
+	if (!hash_overflow_count)
+		return (uint32_t)-1;
+	result = hash_overflow_slot(key, keylen);
+	for (uint32_t i = 0; i < 8; i++) {
+		if (!hash_overflow_keys[result])
+			break;
+		if (hash_overflow_lens[result] == keylen &&
+		    memcmp(hash_overflow_keys[result], key, keylen) == 0)
+			return 20000 + result;
+		result = (result + 1) & 7;
+	}
+	return (uint32_t)-1;
+}
+
+uint32_t
+hash_insert(const void * __restrict key, size_t keylen)
+{
+	uint32_t result = hash(key, keylen);
+	if (result != (uint32_t)-1 || hash_overflow_count == 8)
+		return result;
+	result = hash_overflow_slot(key, keylen);
+	while (hash_overflow_keys[result])
+		result = (result + 1) & 7;
+	hash_overflow_keys[result] = (const char *)key;
+	hash_overflow_lens[result] = keylen;
+	if (++hash_overflow_count == 6 && hash_rebuild_hook)
+		hash_rebuild_hook(hash_overflow_count);
+	return 20000 + result;
+}
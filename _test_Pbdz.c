@@ -0,0 +1,645 @@
+/* generated with rurban/nbperf 08a5797 -P _words */
+/* seed[0]: 1726956429, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+#define GWORD(i) ((i) >> 2)
+#define GETI2(g, i) ((uint8_t)((g[i >> 2] >> ((i & 3) << 1U)) & 3))
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	/* non-minimal: returns 0 .. 24799 */
+	static const uint8_t g[6201] = {
+	     0xb8, 0x82, 0xea, 0x92, 0x34, 0x10, 0x4b, 0x1d, 0x2f, 0x7d,
+	     0xb9, 0x82, 0xa2, 0x66, 0x86, 0x2b, 0xd2, 0x34, 0xb9, 0x5,
+	     0x81, 0x69, 0x29, 0x64, 0x19, 0xa0, 0x64, 0xf9, 0x1b, 0xa4,
+	     0x1d, 0x13, 0x5a, 0x22, 0x4d, 0xe5, 0x94, 0x8e, 0x1, 0x65,
+	     0x23, 0x47, 0x7c, 0x18, 0xed, 0xd7, 0xb3, 0x4b, 0x15, 0xa0,
+	     0xac, 0xbd, 0xac, 0xf4, 0x6e, 0xd8, 0xd3, 0x10, 0x8b, 0xc8,
+	     0x65, 0xf8, 0x53, 0x43, 0x7, 0x65, 0x5e, 0xb0, 0x1, 0x28,
+	     0xb, 0x55, 0x1c, 0x2d, 0x74, 0x8c, 0x42, 0x52, 0x1, 0xac,
+	     0x41, 0xa1, 0x11, 0x45, 0x5f, 0x98, 0x74, 0x67, 0x41, 0x1d,
+	     0x1, 0x38, 0x67, 0x5b, 0xb8, 0x61, 0x63, 0x89, 0x8e, 0xaf,
+	     0x49, 0x9, 0x63, 0x34, 0x6a, 0x25, 0xd7, 0x89, 0x44, 0x8b,
+	     0xa0, 0x4, 0x66, 0x87, 0xa3, 0x9e, 0xd3, 0x94, 0x8d, 0x20,
+	     0x55, 0x19, 0x8, 0x9c, 0xa, 0xe6, 0x34, 0x57, 0xa4, 0xf5,
+	     0x1a, 0x15, 0x2, 0x48, 0x66, 0xe2, 0x24, 0x9, 0x85, 0xb6,
+	     0x70, 0xab, 0x6, 0x38, 0x95, 0x1c, 0x4b, 0x9a, 0x1b, 0x30,
+	     0xaa, 0xfd, 0xee, 0x88, 0x39, 0xab, 0x1f, 0x7a, 0xa, 0x1f,
+	     0x4, 0x11, 0x93, 0x6c, 0xc7, 0x98, 0x33, 0x2a, 0xb5, 0x86,
+	     0xc7, 0x88, 0xc2, 0x2b, 0x99, 0x34, 0x1e, 0x96, 0x6a, 0xc1,
+	     0x79, 0x29, 0xf3, 0xd9, 0x1, 0xd8, 0x49, 0x11, 0x10, 0x29,
+	     0xcb, 0xe4, 0x50, 0xc0, 0xce, 0x5c, 0x61, 0x1, 0x73, 0xc6,
+	     0x90, 0x29, 0x65, 0x45, 0x62, 0x68, 0x11, 0x26, 0xe0, 0x69,
+	     0x8a, 0xe2, 0x7e, 0x86, 0x8a, 0x22, 0xc8, 0xac, 0x10, 0x20,
+	     0xa8, 0xa4, 0x2a, 0x33, 0x52, 0xd4, 0xbb, 0x59, 0x32, 0x7a,
+	     0x43, 0xc0, 0x96, 0x40, 0x4d, 0x88, 0x3e, 0x30, 0xa6, 0x17,
+	     0xff, 0x99, 0x92, 0x4f, 0xb5, 0x6f, 0xa2, 0xfb, 0x59, 0x20,
+	     0x95, 0xd3, 0xe9, 0x2c, 0x80, 0x51, 0x17, 0xa6, 0xf1, 0xa8,
+	     0x47, 0xba, 0xdd, 0x56, 0x96, 0xe7, 0x0, 0x75, 0x36, 0xe7,
+	     0x6a, 0x45, 0x8b, 0x26, 0xae, 0x44, 0x81, 0x92, 0xc6, 0x66,
+	     0xe9, 0x92, 0x64, 0x23, 0xda, 0x0, 0x4, 0x6a, 0x41, 0x8e,
+	     0x9b, 0x51, 0x8a, 0xb6, 0xe4, 0x74, 0x90, 0xe2, 0x8e, 0xce,
+	     0xb0, 0xd4, 0x2a, 0xa, 0x9, 0x94, 0xde, 0x42, 0x55, 0x51,
+	     0x29, 0x90, 0xab, 0x55, 0xa9, 0x40, 0x58, 0x52, 0x90, 0x2,
+	     0x8, 0x4a, 0x4e, 0xa3, 0x9d, 0x2, 0x47, 0xc7, 0x67, 0x21,
+	     0xeb, 0xe4, 0xdd, 0x3e, 0xa, 0x0, 0xaa, 0x6, 0x58, 0xfd,
+	     0x18, 0x14, 0xac, 0x46, 0x31, 0x80, 0x10, 0xfa, 0x81, 0x14,
+	     0x86, 0x40, 0x1, 0x42, 0x60, 0x32, 0x44, 0xf8, 0x5e, 0xb,
+	     0x50, 0xc, 0x10, 0x7d, 0xa5, 0x30, 0x6, 0x2e, 0xd5, 0x48,
+	     0x39, 0xba, 0x96, 0x8d, 0x9f, 0xbd, 0x9c, 0x5f, 0xa, 0x8a,
+	     0x81, 0xa5, 0x28, 0x8a, 0xc, 0x52, 0x96, 0x6f, 0xe3, 0x7a,
+	     0x73, 0xec, 0x59, 0x8e, 0x80, 0x92, 0xe2, 0xf6, 0xa7, 0xe4,
+	     0x72, 0xcb, 0x55, 0x48, 0x22, 0x34, 0x1c, 0x6, 0x20, 0x5d,
+	     0xa0, 0xb1, 0x4a, 0x60, 0xa7, 0x46, 0xe2, 0xac, 0x66, 0x49,
+	     0x11, 0x8a, 0x26, 0x14, 0x50, 0xc2, 0xb9, 0xc8, 0x6, 0xf4,
+	     0x34, 0xcc, 0x59, 0x19, 0x87, 0x4d, 0x19, 0x58, 0xc3, 0x8b,
+	     0xc2, 0x77, 0x9, 0x30, 0x22, 0x64, 0x18, 0x43, 0x6e, 0xd,
+	     0x15, 0x39, 0x96, 0x1a, 0x68, 0x7a, 0x31, 0x88, 0x90, 0xe,
+	     0xc7, 0xe4, 0x83, 0x9b, 0x5b, 0xa1, 0xbe, 0x42, 0xfc, 0x77,
+	     0xc4, 0xa6, 0x8d, 0x8, 0x68, 0x45, 0xa5, 0x7e, 0x6c, 0x3a,
+	     0x66, 0x59, 0xc8, 0x10, 0xaa, 0x41, 0x29, 0x31, 0xe1, 0xd8,
+	     0xa1, 0xae, 0x8d, 0x77, 0x5a, 0x59, 0x3a, 0x3, 0x9e, 0xd4,
+	     0x38, 0x37, 0xd2, 0xfa, 0x8e, 0xee, 0x4, 0x20, 0xde, 0xcb,
+	     0xb6, 0x2, 0x21, 0x11, 0xb5, 0x6d, 0x6c, 0x6d, 0x34, 0x62,
+	     0xdc, 0x85, 0x4, 0x10, 0x28, 0x45, 0xb, 0x32, 0x3b, 0xee,
+	     0xd6, 0xb9, 0xec, 0x35, 0xa0, 0x86, 0x44, 0x96, 0xa6, 0x9e,
+	     0x1a, 0x98, 0x24, 0x80, 0x2c, 0xd2, 0x9, 0x40, 0x89, 0xd5,
+	     0x91, 0x0, 0x99, 0x30, 0x2a, 0x6a, 0xd, 0x73, 0x5, 0x17,
+	     0x19, 0xd1, 0xb, 0xa1, 0x9b, 0xc1, 0x30, 0xaf, 0x66, 0x86,
+	     0x29, 0x30, 0x26, 0x6a, 0x1, 0x1f, 0x98, 0x4d, 0x8c, 0xa5,
+	     0xc2, 0xe5, 0x3f, 0x4, 0x11, 0x49, 0xc6, 0xf1, 0x4a, 0x72,
+	     0x57, 0xd8, 0xbd, 0x9a, 0x14, 0x38, 0x39, 0x5, 0x71, 0x34,
+	     0xd8, 0x7c, 0xc, 0x90, 0x78, 0x49, 0x66, 0xa7, 0x94, 0x9,
+	     0x26, 0x22, 0x9c, 0x63, 0x6a, 0x6, 0x98, 0x88, 0x6e, 0x4c,
+	     0x12, 0xe3, 0x81, 0xa, 0xbb, 0xcb, 0x1d, 0x91, 0x4, 0x10,
+	     0xae, 0x8f, 0x95, 0x2d, 0xa5, 0xae, 0xa9, 0x6a, 0x39, 0x65,
+	     0x67, 0xf, 0x12, 0x16, 0x54, 0x40, 0x2a, 0xf, 0x21, 0x68,
+	     0xd4, 0x8, 0xa5, 0xbb, 0x97, 0x44, 0x87, 0x11, 0xe0, 0xac,
+	     0x1a, 0xa3, 0xd2, 0x60, 0xbc, 0x5c, 0x9, 0x4, 0x28, 0x4b,
+	     0xf4, 0xc9, 0x6, 0x3d, 0xad, 0x4a, 0x88, 0xf2, 0x9a, 0xd6,
+	     0x1c, 0xc1, 0xa6, 0x9b, 0xc9, 0x11, 0x13, 0xdb, 0x19, 0xc7,
+	     0x8b, 0x19, 0x9b, 0xd1, 0xe, 0x76, 0x1e, 0x95, 0xe6, 0x90,
+	     0x40, 0x51, 0xcd, 0x85, 0x55, 0xa3, 0x27, 0x88, 0xc9, 0x50,
+	     0x5, 0x85, 0xa5, 0x34, 0x55, 0xb8, 0x93, 0x98, 0x8a, 0x30,
+	     0x39, 0xba, 0xb8, 0x9d, 0x54, 0x3e, 0x54, 0xa5, 0x8f, 0xd9,
+	     0x87, 0x33, 0x48, 0xc, 0xe6, 0xcb, 0x92, 0x2c, 0x86, 0x52,
+	     0x28, 0xd9, 0x4, 0xf2, 0xc, 0x29, 0x5, 0x76, 0xba, 0xa9,
+	     0x99, 0xd, 0x44, 0xeb, 0xb4, 0x59, 0x5d, 0xa, 0x66, 0x1,
+	     0x16, 0xd1, 0x4, 0xb, 0x63, 0xd8, 0xe0, 0xef, 0xb, 0x67,
+	     0x2e, 0x91, 0x5b, 0x0, 0xc3, 0xa9, 0x2a, 0x43, 0x4f, 0xa6,
+	     0xa5, 0x98, 0x2a, 0x19, 0xb5, 0x5a, 0x71, 0xcd, 0xd7, 0x84,
+	     0x5d, 0x2a, 0xff, 0xc2, 0xec, 0x2e, 0x25, 0xea, 0xc, 0x42,
+	     0x4a, 0x32, 0xc6, 0x64, 0x0, 0x62, 0xdb, 0x0, 0x98, 0x63,
+	     0x65, 0x22, 0x76, 0x61, 0xdb, 0x90, 0x12, 0x85, 0x92, 0xf6,
+	     0x70, 0x9a, 0x5c, 0x18, 0x94, 0xa2, 0x58, 0x9f, 0x30, 0x18,
+	     0x69, 0x83, 0x3d, 0xaf, 0xae, 0x7, 0x9d, 0x29, 0x71, 0x44,
+	     0x82, 0x90, 0x4c, 0x41, 0xa9, 0x83, 0xda, 0x45, 0xe9, 0x46,
+	     0x2, 0xe1, 0x86, 0x36, 0xf1, 0x25, 0x82, 0x88, 0x44, 0x8f,
+	     0xc7, 0x35, 0xa6, 0x26, 0x8c, 0x82, 0x39, 0xaa, 0xe8, 0x94,
+	     0xbb, 0xce, 0xec, 0xe, 0xea, 0x8d, 0xb2, 0xb, 0x43, 0xd4,
+	     0xca, 0x95, 0x9b, 0x62, 0x91, 0x32, 0x8e, 0x92, 0xd7, 0x85,
+	     0xc2, 0x2e, 0x29, 0x64, 0x9f, 0x6e, 0x60, 0xa5, 0xe0, 0x4d,
+	     0x52, 0xa0, 0x1d, 0xa4, 0x97, 0x47, 0x6, 0xba, 0x30, 0xaa,
+	     0x91, 0x3b, 0x18, 0x6f, 0x25, 0xf5, 0x84, 0x8f, 0x33, 0x46,
+	     0xc5, 0x69, 0x89, 0x93, 0x64, 0xe6, 0x9e, 0x8b, 0x84, 0x3a,
+	     0x29, 0x96, 0x76, 0x51, 0xa2, 0x18, 0xb1, 0xa8, 0x86, 0x20,
+	     0xa0, 0xaf, 0x95, 0x2, 0x52, 0x87, 0x9e, 0x4a, 0xd9, 0x45,
+	     0x18, 0x20, 0x78, 0x1c, 0xd8, 0x28, 0x51, 0x27, 0x22, 0x64,
+	     0x12, 0x2b, 0x24, 0x18, 0xf, 0x5f, 0x36, 0xbd, 0x63, 0x77,
+	     0x24, 0xa9, 0x25, 0x2b, 0x64, 0x3e, 0xe9, 0x80, 0x9c, 0x34,
+	     0xc2, 0x86, 0x22, 0x48, 0xa0, 0xe3, 0xcc, 0xa4, 0x11, 0x2b,
+	     0xa9, 0x48, 0x4d, 0x12, 0xc, 0xf3, 0xf4, 0x96, 0x51, 0xe0,
+	     0x2e, 0xe9, 0x14, 0xec, 0xac, 0x6c, 0x85, 0xcc, 0x13, 0x96,
+	     0x11, 0xc3, 0x64, 0x49, 0x6, 0x62, 0xdd, 0x21, 0x69, 0x19,
+	     0x78, 0x2a, 0xa3, 0xda, 0x99, 0xd4, 0x9, 0xc6, 0x8b, 0xc1,
+	     0x5c, 0x99, 0xe6, 0xd2, 0x74, 0x5c, 0x36, 0x8f, 0x16, 0xa3,
+	     0x2d, 0x97, 0xac, 0xfa, 0x85, 0x54, 0x3b, 0xa8, 0xed, 0xca,
+	     0x40, 0x46, 0x93, 0x6, 0x1, 0xa8, 0x2c, 0x2, 0xb6, 0x39,
+	     0x67, 0x62, 0x12, 0xa5, 0x15, 0x42, 0x5e, 0x5b, 0x4c, 0x25,
+	     0x53, 0x25, 0xe2, 0x82, 0x3e, 0x68, 0xcc, 0x5c, 0xf1, 0x96,
+	     0xfa, 0xd1, 0x8a, 0xd4, 0x12, 0xb2, 0x79, 0x11, 0x41, 0xd9,
+	     0x29, 0xe9, 0x64, 0x2, 0x99, 0x97, 0x6f, 0xa0, 0x68, 0x69,
+	     0x1c, 0x20, 0x12, 0xd8, 0x46, 0xd, 0x1d, 0x2e, 0xa2, 0x45,
+	     0x4, 0x32, 0x52, 0xa6, 0x14, 0x93, 0x81, 0xa2, 0x9d, 0x65,
+	     0x91, 0x58, 0xfa, 0x39, 0x28, 0xfc, 0x52, 0x89, 0xc4, 0xa2,
+	     0x22, 0xb8, 0x62, 0x43, 0x4c, 0x84, 0x8c, 0xb8, 0x58, 0x66,
+	     0x85, 0xa4, 0x27, 0x82, 0x67, 0x58, 0xf7, 0xc, 0xa5, 0xc6,
+	     0x8, 0xd5, 0x69, 0x4d, 0xf6, 0x69, 0x8e, 0x80, 0xd8, 0xa,
+	     0x1a, 0x50, 0x91, 0x18, 0x17, 0xa2, 0x70, 0xec, 0x68, 0xea,
+	     0x84, 0x42, 0x51, 0xb7, 0xfc, 0x38, 0x70, 0x29, 0x11, 0x4b,
+	     0x8a, 0xed, 0xa1, 0xd4, 0x17, 0x6d, 0x76, 0x48, 0xac, 0x16,
+	     0x94, 0x42, 0x5d, 0x2b, 0x5a, 0x53, 0xa6, 0x40, 0x45, 0x6a,
+	     0x11, 0x0, 0x41, 0x8, 0x62, 0x6e, 0x2a, 0x7d, 0x3c, 0x19,
+	     0xa1, 0x50, 0x63, 0x4b, 0x14, 0x75, 0x78, 0x8d, 0x22, 0xb6,
+	     0xf0, 0xa4, 0x6b, 0xcd, 0x50, 0xe8, 0x94, 0x6d, 0x72, 0x60,
+	     0x82, 0x81, 0x40, 0x19, 0xcb, 0x88, 0x8d, 0x6, 0x2e, 0x4c,
+	     0x7, 0xb, 0x3a, 0x45, 0x4, 0x1e, 0x4f, 0xb8, 0x34, 0x5b,
+	     0x28, 0x84, 0x64, 0xe0, 0x5, 0xa9, 0x2, 0x52, 0xc9, 0x99,
+	     0x11, 0x36, 0x18, 0x11, 0x84, 0x20, 0xc8, 0xc4, 0x12, 0xe9,
+	     0x52, 0x43, 0x4b, 0xa6, 0x7d, 0x33, 0x6, 0x4c, 0x61, 0x26,
+	     0x76, 0x50, 0xa8, 0x97, 0x21, 0x6e, 0x61, 0x54, 0x9e, 0xfd,
+	     0xc2, 0x67, 0x60, 0x7c, 0x9f, 0x38, 0xab, 0x62, 0xfb, 0x8d,
+	     0x4e, 0xf6, 0x26, 0x6a, 0x62, 0xa9, 0xd1, 0x41, 0x38, 0x17,
+	     0xb7, 0x45, 0x28, 0xf5, 0xbb, 0x5d, 0xcc, 0xd6, 0xa8, 0x80,
+	     0x75, 0x1, 0xf1, 0x21, 0xc8, 0x8b, 0xaa, 0x15, 0x80, 0x81,
+	     0xe4, 0xf8, 0x92, 0x22, 0x87, 0xb, 0x6d, 0xdc, 0x6, 0x1e,
+	     0x5e, 0x89, 0x10, 0xa2, 0x80, 0x12, 0x3d, 0x27, 0x6e, 0x56,
+	     0xcd, 0xb0, 0xc5, 0xb8, 0xa5, 0x4f, 0x97, 0xfc, 0xe9, 0x1d,
+	     0x40, 0x1e, 0x68, 0x21, 0x6, 0x6e, 0x8c, 0x59, 0x39, 0x24,
+	     0x5c, 0x2a, 0xcd, 0xdd, 0x0, 0x3d, 0x2f, 0xea, 0x38, 0x79,
+	     0xc3, 0x3, 0x44, 0xdb, 0xbe, 0x24, 0xb1, 0xe6, 0xe1, 0x31,
+	     0x55, 0xf3, 0x95, 0x4b, 0x15, 0x7f, 0x8, 0x59, 0x12, 0x25,
+	     0x53, 0x8, 0x53, 0x14, 0x53, 0x1, 0x81, 0x83, 0x3e, 0x31,
+	     0x57, 0x20, 0x40, 0x94, 0x18, 0xba, 0x23, 0x59, 0x45, 0x81,
+	     0x48, 0xd0, 0x4a, 0x42, 0x47, 0x3c, 0x2a, 0x69, 0x45, 0xa3,
+	     0xe7, 0x43, 0x31, 0x51, 0x24, 0x91, 0x8b, 0x5c, 0x18, 0x5f,
+	     0x80, 0xb1, 0x50, 0xb1, 0x69, 0x9, 0x4d, 0x7b, 0x81, 0x59,
+	     0x5c, 0xe4, 0xaa, 0x1c, 0x5f, 0x2f, 0x80, 0x38, 0x84, 0xa6,
+	     0x8f, 0x54, 0x49, 0xf7, 0x50, 0x48, 0x15, 0x78, 0xc, 0xbc,
+	     0xe7, 0x62, 0x74, 0x86, 0xd, 0xfc, 0x11, 0x5a, 0x11, 0xd1,
+	     0xc2, 0x1b, 0x49, 0x8, 0x69, 0x36, 0x47, 0x62, 0x51, 0x86,
+	     0xda, 0x89, 0x18, 0x78, 0xe8, 0x2, 0x80, 0x46, 0x17, 0x9e,
+	     0xbd, 0x7c, 0xa8, 0x96, 0x3e, 0x83, 0x10, 0x63, 0x36, 0xd2,
+	     0x41, 0x1a, 0x1e, 0x71, 0x27, 0x1c, 0xed, 0x6, 0x53, 0x12,
+	     0x4c, 0x8e, 0xe, 0x9a, 0xb3, 0x93, 0xc8, 0x9, 0xad, 0xf,
+	     0x22, 0xbe, 0x81, 0x6, 0x28, 0xea, 0xdd, 0xcd, 0xa6, 0x2,
+	     0x55, 0x14, 0x14, 0x14, 0xec, 0x10, 0x6e, 0x71, 0x47, 0x86,
+	     0x90, 0xeb, 0x7a, 0x95, 0x60, 0x51, 0x9c, 0x62, 0x92, 0x72,
+	     0x4a, 0xa8, 0x9d, 0xa8, 0x1c, 0xc, 0x18, 0x7c, 0xa3, 0x8c,
+	     0x80, 0x1e, 0xa3, 0x92, 0x10, 0x64, 0x62, 0x21, 0x48, 0x15,
+	     0x15, 0x1a, 0x81, 0xa6, 0xca, 0x2a, 0xa2, 0x21, 0xba, 0x2a,
+	     0xd5, 0xb1, 0x57, 0x45, 0xb4, 0x17, 0x46, 0xb5, 0x6, 0x9b,
+	     0x5a, 0xd7, 0x62, 0xa1, 0x1c, 0xa2, 0x20, 0x82, 0xda, 0xf8,
+	     0xc7, 0xa, 0x78, 0x50, 0x7, 0xd1, 0x68, 0x43, 0xae, 0xd2,
+	     0x38, 0x7b, 0x9f, 0x7, 0x6e, 0x60, 0xa5, 0x43, 0xbc, 0x31,
+	     0x5f, 0xb0, 0x95, 0xc2, 0xb9, 0xd, 0xdb, 0xfd, 0x42, 0x67,
+	     0xe4, 0x5d, 0xf6, 0x36, 0x1d, 0xf9, 0x9, 0xcd, 0x31, 0x2e,
+	     0x5b, 0x5a, 0x8c, 0x94, 0xb0, 0x8d, 0xf3, 0x53, 0xf3, 0xa2,
+	     0xd2, 0x92, 0xe1, 0x5, 0x55, 0x93, 0xc0, 0x51, 0xba, 0xe4,
+	     0x66, 0x3c, 0x5e, 0x70, 0x31, 0x1, 0x0, 0xb0, 0x43, 0x35,
+	     0x6e, 0x1b, 0xe9, 0x15, 0x49, 0x64, 0x6d, 0x16, 0x9c, 0x55,
+	     0xc0, 0xcd, 0x7a, 0x46, 0x8c, 0xc2, 0x2c, 0xef, 0x8b, 0xde,
+	     0x37, 0x9c, 0x97, 0xa3, 0x75, 0xe1, 0xba, 0x32, 0xa4, 0x71,
+	     0xb5, 0x9b, 0x63, 0x57, 0x8f, 0x29, 0x5f, 0x22, 0xe1, 0x69,
+	     0x61, 0x3c, 0xa5, 0x14, 0x3a, 0x30, 0x2c, 0x20, 0x56, 0xce,
+	     0x42, 0x78, 0xb4, 0xfd, 0x36, 0x65, 0x74, 0xa2, 0x0, 0xa0,
+	     0x95, 0x64, 0x58, 0xa6, 0x15, 0xc6, 0x83, 0x14, 0x96, 0x27,
+	     0x29, 0x0, 0xb9, 0x12, 0xae, 0x1a, 0x4d, 0x46, 0xea, 0x72,
+	     0x21, 0x53, 0x41, 0x68, 0x39, 0x29, 0xb5, 0x10, 0xad, 0x2e,
+	     0x24, 0x22, 0x6d, 0x46, 0xb9, 0x2d, 0xb4, 0xba, 0x5e, 0x44,
+	     0xee, 0x10, 0xb6, 0xc7, 0xd5, 0x32, 0x93, 0x72, 0x1f, 0x4a,
+	     0x18, 0x2e, 0x60, 0x66, 0x2c, 0xd3, 0x72, 0x3c, 0x55, 0x78,
+	     0xd1, 0x4, 0x41, 0x18, 0x15, 0x63, 0x0, 0x1a, 0xaf, 0x99,
+	     0xa0, 0x87, 0xb1, 0x99, 0xb6, 0x68, 0x95, 0xd0, 0xe, 0x5a,
+	     0xa1, 0x93, 0x92, 0xc8, 0x82, 0xb5, 0x1a, 0x0, 0x5, 0x81,
+	     0x99, 0x6d, 0xc8, 0xac, 0x28, 0xc8, 0x9, 0x19, 0x1b, 0xa9,
+	     0x14, 0x81, 0x96, 0x62, 0x3a, 0x3d, 0xf3, 0x22, 0x1d, 0xf7,
+	     0x7f, 0x3c, 0xb4, 0x18, 0x92, 0x5e, 0x69, 0x84, 0xa6, 0x4b,
+	     0x21, 0xf3, 0x65, 0x2e, 0x8c, 0x90, 0x6a, 0x71, 0xe0, 0x9f,
+	     0xc8, 0x55, 0x1a, 0x51, 0xad, 0x57, 0xed, 0x31, 0x71, 0x52,
+	     0x43, 0x95, 0x57, 0xa5, 0x9b, 0x76, 0x43, 0xba, 0x70, 0x6a,
+	     0xf6, 0x1, 0x5a, 0x2f, 0x21, 0x1b, 0x49, 0xa2, 0x5, 0x49,
+	     0x1e, 0x96, 0x1e, 0xc3, 0x70, 0xa6, 0x2d, 0x37, 0x54, 0x98,
+	     0xf1, 0xa8, 0x11, 0xf6, 0x7, 0x2e, 0x8c, 0x26, 0x2, 0xed,
+	     0x78, 0xea, 0xcc, 0xa4, 0xa9, 0x96, 0x1, 0x34, 0x65, 0x39,
+	     0x82, 0xc4, 0x8, 0xa1, 0x8a, 0x9e, 0x7, 0xd0, 0x56, 0x44,
+	     0x10, 0x2c, 0x5c, 0x1f, 0x67, 0xa4, 0x26, 0x73, 0x32, 0x50,
+	     0xc, 0x52, 0xc5, 0x2a, 0x1, 0x9, 0x37, 0x44, 0x67, 0x26,
+	     0xb1, 0x46, 0xc1, 0xb, 0x27, 0xc8, 0x67, 0x68, 0xd, 0x1b,
+	     0xc9, 0xa2, 0x81, 0x43, 0x43, 0x5d, 0x8b, 0xb0, 0xa9, 0xa9,
+	     0x55, 0xf1, 0x49, 0xe8, 0x72, 0xa1, 0x60, 0x51, 0x28, 0x80,
+	     0xf2, 0xe9, 0x1b, 0x19, 0x15, 0xf7, 0x92, 0x6a, 0x16, 0xd2,
+	     0x4, 0x12, 0x7e, 0xa6, 0xdc, 0xe2, 0xe8, 0x8f, 0x84, 0xa1,
+	     0x55, 0x14, 0x3, 0x4, 0xf0, 0x98, 0x47, 0xe7, 0x1f, 0x16,
+	     0x28, 0xa8, 0xb6, 0x3, 0x1a, 0xe9, 0x3d, 0x42, 0x8c, 0x14,
+	     0x93, 0x32, 0xe3, 0x58, 0xb8, 0xdb, 0x1, 0x31, 0x21, 0x35,
+	     0x20, 0xca, 0x43, 0x1a, 0xa4, 0x61, 0xa8, 0x16, 0x37, 0xb0,
+	     0x3a, 0x14, 0x9c, 0xc8, 0x5c, 0xb1, 0x14, 0xdc, 0xa6, 0x5f,
+	     0xf5, 0x8e, 0x83, 0x6e, 0x9, 0x4b, 0x52, 0x68, 0xa4, 0xc,
+	     0x81, 0x62, 0x35, 0x3f, 0x44, 0x60, 0xb4, 0xe2, 0x2, 0x67,
+	     0x79, 0x89, 0x55, 0x68, 0x95, 0xd7, 0xfe, 0x32, 0x53, 0xc4,
+	     0xc4, 0xc1, 0x12, 0xb7, 0xe2, 0x76, 0x27, 0x39, 0xfc, 0x8c,
+	     0x1f, 0x80, 0x15, 0x1b, 0x88, 0xe2, 0xdd, 0x45, 0xd9, 0x36,
+	     0xc8, 0x85, 0x94, 0xd5, 0x4, 0x65, 0x95, 0x0, 0x56, 0xa9,
+	     0x41, 0x72, 0x98, 0x1b, 0xea, 0xa, 0x25, 0x44, 0x19, 0x4c,
+	     0xdc, 0xd5, 0x19, 0x45, 0x48, 0x69, 0x76, 0x96, 0x15, 0x9c,
+	     0x93, 0x91, 0x1c, 0x6b, 0xf6, 0xa1, 0x18, 0x66, 0x1e, 0x22,
+	     0x22, 0xf0, 0x6, 0xa2, 0x34, 0x25, 0x66, 0x81, 0xde, 0x2a,
+	     0x5b, 0x3d, 0x0, 0x51, 0xb2, 0x46, 0xe5, 0x51, 0x6b, 0x44,
+	     0x1a, 0x12, 0x8c, 0xe5, 0x8d, 0x48, 0x1c, 0x51, 0x21, 0x2b,
+	     0x6d, 0xa, 0x65, 0x1e, 0xbc, 0x40, 0x48, 0xd, 0xa6, 0x8b,
+	     0xb2, 0x64, 0x47, 0xc4, 0x89, 0x33, 0xa0, 0x69, 0x9c, 0xee,
+	     0x2f, 0xf1, 0x31, 0x29, 0x7d, 0x51, 0x42, 0x69, 0xc3, 0x40,
+	     0x58, 0x2d, 0xf0, 0xfd, 0xc2, 0x19, 0xe9, 0xa, 0x73, 0x8,
+	     0xd6, 0x45, 0x0, 0x51, 0x54, 0x99, 0x29, 0xd6, 0x0, 0x1c,
+	     0xd1, 0x19, 0x29, 0x6c, 0xa0, 0xf0, 0x34, 0x4d, 0x6a, 0x36,
+	     0x16, 0x81, 0xab, 0xf8, 0x54, 0x9f, 0x9, 0x6d, 0x74, 0x61,
+	     0x46, 0x40, 0xa, 0xed, 0x24, 0x98, 0x24, 0x82, 0xa8, 0xa8,
+	     0xaa, 0xd4, 0x15, 0x4, 0x14, 0x7, 0xaa, 0x3, 0x42, 0x1a,
+	     0x28, 0x96, 0x6c, 0x8c, 0x80, 0xd, 0x4c, 0xa6, 0xa2, 0xaa,
+	     0x69, 0x4d, 0x65, 0xd5, 0x59, 0x74, 0x50, 0x2a, 0x80, 0xc3,
+	     0x63, 0xdd, 0xc0, 0x0, 0x94, 0xae, 0xc, 0xc8, 0xab, 0x9a,
+	     0xae, 0x12, 0x9c, 0x97, 0x28, 0xa6, 0x52, 0x9b, 0x21, 0xd,
+	     0x25, 0x3f, 0x92, 0x53, 0x32, 0xc4, 0x88, 0xa8, 0x17, 0xcc,
+	     0x60, 0x56, 0x24, 0x7a, 0x66, 0x61, 0x90, 0x9f, 0x92, 0x8e,
+	     0xf2, 0x33, 0x96, 0x5, 0x6c, 0x2b, 0x6e, 0xde, 0x5, 0x98,
+	     0x43, 0x56, 0x56, 0x91, 0x6, 0x7c, 0x21, 0x61, 0xae, 0xe5,
+	     0x9, 0x3d, 0xa9, 0xd3, 0x72, 0x28, 0x63, 0xb6, 0x98, 0x59,
+	     0x14, 0x6b, 0xaf, 0x84, 0xb0, 0x1d, 0x94, 0x44, 0x7a, 0x1b,
+	     0x7b, 0x52, 0x32, 0x3e, 0xa8, 0x99, 0x14, 0x70, 0x6, 0x1a,
+	     0xb, 0x15, 0xa8, 0x92, 0x1, 0x33, 0xa7, 0x63, 0x81, 0xaa,
+	     0x3c, 0x41, 0x69, 0x78, 0x25, 0x8f, 0x92, 0xb, 0xb, 0x6b,
+	     0x4a, 0x88, 0x1d, 0x8, 0x9a, 0x12, 0x69, 0x87, 0x10, 0x70,
+	     0x10, 0x21, 0x13, 0x74, 0x2, 0x14, 0x1a, 0x2a, 0x86, 0xe4,
+	     0x85, 0xb8, 0x33, 0xb, 0xd, 0x43, 0xea, 0x72, 0x1e, 0x83,
+	     0x3f, 0x7, 0x88, 0x16, 0x30, 0xfe, 0xa2, 0x3d, 0x4b, 0x49,
+	     0xcd, 0xa6, 0xda, 0x78, 0x22, 0xd0, 0xb, 0x16, 0x60, 0xd7,
+	     0x69, 0x8c, 0xca, 0x82, 0x0, 0x41, 0xb9, 0xc9, 0x4c, 0xc0,
+	     0x9e, 0xa4, 0x28, 0x95, 0xb2, 0x4, 0xab, 0xc0, 0x59, 0xf6,
+	     0x1e, 0x13, 0x6b, 0x96, 0xd3, 0x71, 0x4a, 0x71, 0x92, 0xa8,
+	     0x23, 0x41, 0x11, 0x2, 0x20, 0x88, 0x4, 0x46, 0x2, 0xa6,
+	     0x6a, 0x42, 0x2c, 0x50, 0xa8, 0x84, 0xc6, 0x24, 0x8a, 0xa7,
+	     0x45, 0xd8, 0x59, 0x7d, 0xc, 0x86, 0xe1, 0x4e, 0x26, 0xa5,
+	     0xe2, 0xe9, 0x2, 0xe3, 0x92, 0xa6, 0x1b, 0x35, 0x90, 0x23,
+	     0x9a, 0x42, 0x53, 0x95, 0xda, 0xa5, 0x55, 0x13, 0xa3, 0x8c,
+	     0x44, 0x8b, 0xca, 0xe6, 0x7, 0x70, 0x42, 0xa0, 0x7b, 0xf5,
+	     0x88, 0x25, 0x98, 0x4d, 0x9c, 0xa3, 0x2e, 0x8, 0x2f, 0x12,
+	     0x96, 0x45, 0x1, 0x8, 0xed, 0x26, 0x6c, 0xa0, 0x8a, 0x61,
+	     0xcd, 0xe8, 0x64, 0x2e, 0x80, 0x48, 0x90, 0xee, 0x9b, 0xc2,
+	     0x58, 0x4, 0x7a, 0xbd, 0xf4, 0x9a, 0x2b, 0x76, 0xe2, 0x65,
+	     0x65, 0xb0, 0x2b, 0xb4, 0x10, 0xc7, 0x85, 0x9, 0xa0, 0xca,
+	     0x90, 0x74, 0x80, 0xd4, 0xea, 0x64, 0xb9, 0x52, 0x8f, 0x55,
+	     0x31, 0x20, 0x40, 0x95, 0x96, 0x14, 0x26, 0x1c, 0x66, 0x9e,
+	     0x28, 0xa1, 0x58, 0x87, 0x11, 0x79, 0xa2, 0x56, 0x22, 0xd2,
+	     0x41, 0xb5, 0xd9, 0x2d, 0xa3, 0x9, 0x8, 0x28, 0x67, 0x6b,
+	     0x21, 0xac, 0x44, 0xe9, 0x58, 0x24, 0x24, 0xeb, 0x58, 0x17,
+	     0x61, 0x50, 0xaa, 0x85, 0xb8, 0xaa, 0xae, 0x4c, 0x79, 0x58,
+	     0x45, 0x58, 0x5a, 0x5, 0x49, 0xc0, 0xf, 0xae, 0x28, 0xa0,
+	     0x1b, 0x86, 0x11, 0x4, 0xe6, 0xca, 0x24, 0xc1, 0x44, 0x8d,
+	     0x35, 0x70, 0x17, 0x95, 0x2d, 0xca, 0x80, 0x31, 0xf7, 0xb8,
+	     0x97, 0x40, 0x85, 0x85, 0x85, 0xae, 0x2e, 0x42, 0x16, 0xb4,
+	     0xe7, 0xd2, 0x2e, 0xe6, 0xd, 0x39, 0x6, 0x85, 0x3a, 0x4c,
+	     0xb4, 0x6b, 0xd4, 0x1e, 0x2e, 0xb, 0x39, 0x2f, 0x65, 0x54,
+	     0x6a, 0x5d, 0x1, 0xc5, 0x6b, 0x49, 0xe1, 0xa8, 0xa3, 0x65,
+	     0x1c, 0x29, 0xae, 0x8a, 0xa1, 0x9a, 0x48, 0x47, 0xe2, 0x32,
+	     0x43, 0x55, 0xc6, 0xdb, 0x20, 0x75, 0xae, 0x64, 0xa8, 0xb,
+	     0x95, 0x8a, 0x1b, 0x78, 0xad, 0xce, 0x5e, 0x24, 0x58, 0x51,
+	     0xf0, 0x58, 0xfe, 0x1f, 0x58, 0x63, 0x46, 0x67, 0x75, 0x9c,
+	     0x16, 0x45, 0xc9, 0x9a, 0xb5, 0x41, 0x87, 0x2d, 0xc6, 0x49,
+	     0xef, 0x8f, 0x7c, 0x5e, 0x66, 0x0, 0x2b, 0xc, 0x59, 0xa0,
+	     0xa1, 0x91, 0x39, 0x99, 0xc9, 0x48, 0xb3, 0x5f, 0x75, 0x9a,
+	     0x9b, 0xd9, 0x9c, 0x8, 0xa5, 0x37, 0x85, 0x88, 0x53, 0x5e,
+	     0x42, 0x69, 0x6d, 0xb5, 0x44, 0x77, 0xce, 0xe9, 0x6f, 0x7,
+	     0x12, 0x36, 0xa0, 0x66, 0x20, 0x28, 0x0, 0xac, 0x5c, 0x62,
+	     0x73, 0x72, 0xe5, 0x5, 0xb8, 0x15, 0x58, 0xab, 0xd7, 0x14,
+	     0xe6, 0xb1, 0x28, 0xfc, 0x1f, 0x48, 0x90, 0xc1, 0x3a, 0x46,
+	     0xd9, 0x21, 0xd6, 0xf6, 0x8a, 0xc8, 0x11, 0x9c, 0x10, 0x88,
+	     0x4, 0x6b, 0x12, 0x20, 0x1e, 0xb0, 0x46, 0x74, 0x2, 0xc6,
+	     0x25, 0x48, 0xa6, 0x9e, 0x5d, 0xe9, 0x4e, 0x9e, 0x54, 0xa3,
+	     0x61, 0xc9, 0x5c, 0x4a, 0x91, 0xbe, 0x28, 0x3a, 0x3c, 0x87,
+	     0x11, 0x29, 0xf9, 0x5c, 0x4, 0x0, 0xa0, 0x81, 0xb8, 0x62,
+	     0x35, 0x81, 0xc4, 0xaa, 0x7e, 0xf2, 0x9f, 0x13, 0xd6, 0xd,
+	     0x68, 0x81, 0x19, 0x96, 0x62, 0x2, 0xb4, 0x8c, 0x64, 0x79,
+	     0x52, 0x85, 0x28, 0xb, 0xa0, 0x0, 0xa2, 0x74, 0x26, 0xc6,
+	     0xcc, 0x61, 0x85, 0xaa, 0x91, 0x59, 0xdb, 0x63, 0xe4, 0x28,
+	     0xa6, 0x42, 0xa5, 0xb6, 0x16, 0x15, 0x80, 0x90, 0x22, 0xb4,
+	     0x30, 0x2, 0x56, 0x67, 0x99, 0xb8, 0x11, 0x4, 0x95, 0xa1,
+	     0x3a, 0xda, 0x2d, 0x45, 0x99, 0xe3, 0xb, 0x8d, 0x29, 0xc6,
+	     0x62, 0x1, 0xd0, 0xe2, 0x3d, 0x21, 0x70, 0x67, 0xbd, 0xe6,
+	     0x60, 0x9e, 0x48, 0xa, 0x10, 0x52, 0x96, 0x6e, 0x81, 0xef,
+	     0xee, 0x29, 0xc, 0x21, 0x66, 0x5b, 0x41, 0xc2, 0xa5, 0xc0,
+	     0x7, 0x35, 0xe3, 0x49, 0x41, 0x98, 0xbb, 0x64, 0xc4, 0x42,
+	     0x29, 0xc8, 0xde, 0x44, 0x30, 0xe9, 0x4f, 0xdc, 0xca, 0x13,
+	     0x98, 0x46, 0xd8, 0xaa, 0x23, 0x85, 0x79, 0x82, 0x84, 0x37,
+	     0x71, 0x9d, 0x11, 0x29, 0xf7, 0x91, 0x46, 0x99, 0x68, 0x16,
+	     0x49, 0x96, 0x24, 0x30, 0x45, 0xf9, 0x22, 0x40, 0x94, 0x5c,
+	     0xb1, 0xd4, 0xb0, 0x50, 0x48, 0x86, 0x5e, 0xb8, 0x89, 0x5a,
+	     0x27, 0xda, 0xf9, 0x9b, 0x30, 0xa, 0x38, 0x9d, 0x23, 0x42,
+	     0x1, 0x30, 0xd6, 0x2e, 0x42, 0x18, 0x48, 0xb, 0x1f, 0xa3,
+	     0x84, 0x6c, 0x9b, 0x95, 0xe7, 0x1f, 0xab, 0x9d, 0x1a, 0xd9,
+	     0x22, 0x10, 0x8b, 0x71, 0xa6, 0xcd, 0x2, 0x2a, 0x31, 0x50,
+	     0x68, 0x8e, 0xea, 0x6a, 0x92, 0x43, 0x7a, 0xdc, 0x1e, 0x9c,
+	     0xdf, 0x41, 0x24, 0x28, 0xd6, 0x11, 0x34, 0x89, 0x19, 0xcc,
+	     0x9, 0x1e, 0xb5, 0x43, 0xd4, 0xb5, 0x18, 0x65, 0x92, 0x35,
+	     0x5b, 0x98, 0x74, 0x94, 0x13, 0xd, 0xcb, 0xa7, 0xd5, 0x3c,
+	     0x39, 0xc8, 0xbe, 0x50, 0xa7, 0xa9, 0x2d, 0xb, 0xa6, 0xf4,
+	     0xe7, 0x82, 0x81, 0x14, 0x76, 0xac, 0x6, 0x2c, 0x85, 0x59,
+	     0x4c, 0x2d, 0xb6, 0xda, 0xb8, 0x52, 0xa1, 0xec, 0xba, 0x4,
+	     0xef, 0xd3, 0xc3, 0x5c, 0xad, 0x3, 0x8a, 0x2b, 0x3d, 0xa8,
+	     0x29, 0x59, 0xb4, 0x8d, 0x22, 0x68, 0x8, 0xc8, 0x7e, 0x8,
+	     0xf6, 0xd0, 0x58, 0x4, 0x78, 0x99, 0x6, 0x96, 0xd7, 0x7a,
+	     0x88, 0xe1, 0x16, 0xd1, 0x9a, 0x51, 0xec, 0x2a, 0xa0, 0x26,
+	     0x73, 0x67, 0x58, 0x27, 0xab, 0x9a, 0x97, 0x28, 0x43, 0x58,
+	     0x59, 0x7a, 0x70, 0x25, 0x85, 0x5a, 0xdb, 0x77, 0x53, 0x52,
+	     0x19, 0x98, 0xcd, 0x47, 0x91, 0xd8, 0x2a, 0x87, 0x8d, 0xca,
+	     0x85, 0x25, 0x8e, 0x34, 0x1a, 0xa1, 0xa0, 0x17, 0x65, 0x1a,
+	     0xa2, 0x4e, 0x86, 0xc9, 0xe2, 0x8a, 0x71, 0x1a, 0xaa, 0xfd,
+	     0x74, 0x69, 0x41, 0xa2, 0xa5, 0x91, 0x61, 0x85, 0x41, 0x7f,
+	     0x40, 0x77, 0x84, 0xa3, 0x2b, 0xb4, 0x58, 0xcf, 0x3, 0x6c,
+	     0xb0, 0xee, 0x2a, 0x99, 0x28, 0x15, 0x52, 0x1e, 0x74, 0x1a,
+	     0x56, 0x17, 0x6b, 0x4a, 0x86, 0xb7, 0x94, 0x44, 0xc, 0x56,
+	     0xb5, 0xc2, 0x10, 0xad, 0x7e, 0xd0, 0x87, 0x0, 0x84, 0xa8,
+	     0x48, 0x88, 0x99, 0x4, 0xa8, 0x2f, 0x41, 0x5, 0x86, 0x54,
+	     0x89, 0xa4, 0x69, 0x6c, 0xb0, 0xd4, 0x41, 0x39, 0xe9, 0x70,
+	     0x31, 0x29, 0xdc, 0x50, 0x2, 0xea, 0x36, 0xc8, 0xa4, 0x55,
+	     0xdd, 0x52, 0x63, 0x12, 0x72, 0x44, 0x4, 0x49, 0x9, 0x7c,
+	     0x90, 0x3d, 0x8a, 0xd2, 0x46, 0x8d, 0x24, 0xa2, 0x2c, 0xd0,
+	     0xd5, 0xe, 0x13, 0x48, 0x6a, 0x14, 0x7a, 0x7e, 0x5c, 0x69,
+	     0xe9, 0x9d, 0x84, 0xc, 0x2, 0xc7, 0x55, 0x29, 0x92, 0x65,
+	     0x95, 0xe2, 0xf5, 0xd3, 0x2a, 0x88, 0xa7, 0x32, 0xaf, 0x0,
+	     0x95, 0x4c, 0x88, 0x94, 0x74, 0xba, 0xac, 0x4b, 0x26, 0xf2,
+	     0xc, 0x16, 0x63, 0x1d, 0x19, 0x23, 0xb0, 0xab, 0x55, 0x4c,
+	     0x41, 0xcf, 0xd, 0x70, 0xa4, 0x93, 0x88, 0xcc, 0x51, 0x22,
+	     0xb0, 0x72, 0x96, 0x79, 0x61, 0x4d, 0x65, 0x2, 0xf2, 0x2,
+	     0x97, 0xea, 0xa6, 0xab, 0x65, 0x2a, 0x8c, 0xe1, 0x60, 0x63,
+	     0x12, 0xa9, 0xc3, 0x78, 0xa3, 0xbc, 0xc0, 0x9c, 0x40, 0xa4,
+	     0x59, 0x6, 0xe9, 0x1, 0xb6, 0xd2, 0x56, 0x81, 0x84, 0x6,
+	     0xa7, 0x79, 0xc9, 0xa8, 0xd7, 0x24, 0x1e, 0x66, 0x27, 0xcc,
+	     0x69, 0x4, 0x56, 0x55, 0x9a, 0x59, 0x1, 0x24, 0xe, 0xa1,
+	     0xc9, 0x1c, 0xda, 0xf2, 0x20, 0x1f, 0x8b, 0xd5, 0x4a, 0x22,
+	     0x95, 0xb1, 0xca, 0x93, 0x1e, 0x40, 0x84, 0xa4, 0xa4, 0x49,
+	     0x61, 0x53, 0x82, 0x32, 0x6a, 0x38, 0xe, 0x27, 0xee, 0x7c,
+	     0x55, 0x94, 0x10, 0x52, 0x9a, 0xea, 0x31, 0x56, 0x9c, 0x26,
+	     0x6a, 0x4, 0x10, 0xc, 0x20, 0x7e, 0x73, 0x64, 0x60, 0xb2,
+	     0x47, 0xca, 0xb7, 0x1a, 0x0, 0xba, 0xc5, 0xca, 0xd, 0xbd,
+	     0x71, 0xd9, 0xb, 0xa4, 0xc0, 0xa3, 0x7b, 0xc4, 0x28, 0xa5,
+	     0xa1, 0xad, 0x1, 0xe5, 0x22, 0x5f, 0xa, 0xba, 0x4a, 0x4c,
+	     0x4, 0x70, 0xe, 0xda, 0x96, 0x1e, 0xd6, 0xe6, 0x55, 0x73,
+	     0x11, 0xa4, 0x40, 0xc4, 0x0, 0xa5, 0x55, 0x1, 0x74, 0x3c,
+	     0x8, 0x45, 0x64, 0x31, 0x10, 0xff, 0x2, 0xf4, 0x7c, 0x8c,
+	     0xc8, 0xc4, 0x40, 0xa2, 0x4b, 0x17, 0x92, 0x28, 0xd0, 0x81,
+	     0x67, 0x9, 0x2, 0xb1, 0x61, 0x2b, 0x9, 0xf0, 0xf3, 0x92,
+	     0xa2, 0x9, 0x56, 0x40, 0x96, 0x82, 0x1, 0x64, 0x61, 0x51,
+	     0x19, 0x10, 0xc8, 0x4e, 0x21, 0x21, 0x15, 0x10, 0x22, 0x21,
+	     0x4, 0x60, 0x44, 0x80, 0xd6, 0x4c, 0x81, 0xa5, 0xc2, 0xb2,
+	     0xc5, 0xb4, 0x51, 0x8, 0xac, 0x66, 0x1a, 0x70, 0x5, 0x6f,
+	     0x9e, 0xd, 0xbc, 0x40, 0x77, 0xaf, 0x1c, 0x4, 0x10, 0xa6,
+	     0xc2, 0x4e, 0x43, 0x3, 0x1e, 0xe8, 0xcb, 0x30, 0x8c, 0xd3,
+	     0x21, 0x86, 0x2f, 0x2, 0xbd, 0x9a, 0xc7, 0xce, 0xec, 0xe0,
+	     0x38, 0x71, 0x4f, 0xf8, 0x29, 0x14, 0xd8, 0x6e, 0xa0, 0x84,
+	     0x67, 0xba, 0x42, 0x6a, 0x89, 0x79, 0x14, 0x16, 0x41, 0x5,
+	     0xa9, 0xa3, 0x8f, 0xe2, 0xf1, 0x2, 0x1e, 0x61, 0x5b, 0x9f,
+	     0xea, 0x5a, 0xed, 0xde, 0xd1, 0x65, 0xf1, 0x32, 0xda, 0x91,
+	     0x2c, 0x61, 0xb6, 0xd6, 0x6d, 0x36, 0x47, 0x6b, 0x36, 0x30,
+	     0xc, 0xd7, 0xc6, 0x5e, 0x37, 0x9, 0xdd, 0xd2, 0xe, 0x46,
+	     0x8b, 0xad, 0x49, 0x27, 0x72, 0x72, 0xa1, 0x90, 0xb0, 0x86,
+	     0xf2, 0x74, 0x35, 0x65, 0x50, 0x57, 0x88, 0xb7, 0x28, 0x69,
+	     0xf7, 0x63, 0xa9, 0x81, 0x46, 0x6b, 0xec, 0xc9, 0xa7, 0x60,
+	     0xa8, 0x4a, 0x32, 0x13, 0xca, 0x29, 0x2, 0x29, 0xa9, 0x7a,
+	     0xc5, 0xbc, 0x79, 0xaf, 0x8c, 0xd2, 0x3a, 0xee, 0xe3, 0xed,
+	     0xdd, 0x21, 0x64, 0x17, 0xdb, 0x7d, 0x18, 0x35, 0xd, 0xa,
+	     0x30, 0xc2, 0x8, 0xb4, 0xad, 0xd8, 0xc1, 0x8e, 0x25, 0xee,
+	     0x51, 0x2a, 0xa9, 0x71, 0x8a, 0x88, 0xb3, 0x25, 0xff, 0xf6,
+	     0x6, 0x3b, 0x63, 0xb7, 0xea, 0x37, 0x24, 0xd, 0x91, 0x30,
+	     0xcf, 0x97, 0x10, 0x3, 0xa, 0xaf, 0x14, 0xa8, 0xd, 0xe4,
+	     0x88, 0x94, 0xaa, 0x85, 0x8, 0xa4, 0x57, 0x42, 0x79, 0x90,
+	     0x5, 0x41, 0x2, 0x49, 0x8, 0x60, 0x55, 0xd5, 0x19, 0xf6,
+	     0x8a, 0x1c, 0x3e, 0xad, 0x9b, 0x16, 0x59, 0xb8, 0xe6, 0x24,
+	     0x22, 0xa2, 0x1e, 0x33, 0xa1, 0xd0, 0x80, 0x22, 0x51, 0x2a,
+	     0xe0, 0x43, 0x4f, 0xeb, 0x86, 0xac, 0x16, 0xbc, 0x2, 0x8b,
+	     0x18, 0x52, 0x62, 0x24, 0xa5, 0x5f, 0x5c, 0xb3, 0x45, 0x9,
+	     0x92, 0x62, 0x41, 0x11, 0xe6, 0x28, 0x3b, 0x64, 0x6c, 0x15,
+	     0xa1, 0x2b, 0xb1, 0x42, 0xa3, 0x31, 0x55, 0x92, 0xad, 0x60,
+	     0x98, 0x55, 0xe6, 0xa9, 0x94, 0x82, 0x40, 0x0, 0x28, 0xb1,
+	     0x52, 0xee, 0x1c, 0xe7, 0xd9, 0x21, 0x67, 0x17, 0x5c, 0x76,
+	     0x1f, 0x30, 0x76, 0x16, 0xb9, 0x69, 0x57, 0x3e, 0x9f, 0x5,
+	     0x48, 0x6f, 0x60, 0x75, 0x4, 0x22, 0x60, 0xa, 0x2, 0x80,
+	     0xc1, 0xb8, 0x3f, 0x72, 0x97, 0x44, 0x4c, 0x42, 0x64, 0x10,
+	     0x2f, 0xab, 0x13, 0x14, 0x83, 0x64, 0xa1, 0xa6, 0xf3, 0xa7,
+	     0xec, 0xea, 0xb2, 0x1, 0x22, 0x49, 0x28, 0xa5, 0x1d, 0x57,
+	     0x49, 0x6c, 0x2d, 0x23, 0x63, 0x31, 0x4b, 0x25, 0xd1, 0xb,
+	     0xb4, 0x29, 0xdf, 0x82, 0x92, 0xf5, 0x9a, 0x5d, 0xcb, 0xe3,
+	     0xaa, 0x36, 0x2d, 0xbc, 0x2a, 0xcb, 0xca, 0x97, 0x53, 0x5e,
+	     0xc1, 0x17, 0x69, 0x55, 0x6e, 0xa3, 0x70, 0x6, 0x91, 0x86,
+	     0xf3, 0x5a, 0x3d, 0x76, 0x7f, 0x6, 0xca, 0x26, 0x1, 0xe8,
+	     0x38, 0x42, 0xfd, 0xfe, 0x92, 0xf4, 0xf1, 0x3e, 0xb6, 0x3e,
+	     0xa6, 0x11, 0x45, 0x47, 0x3a, 0x16, 0x88, 0xdb, 0x93, 0xd2,
+	     0x77, 0x5, 0x27, 0x31, 0x71, 0xe0, 0x74, 0x94, 0xe8, 0xad,
+	     0x77, 0x61, 0xae, 0x3a, 0xc4, 0x98, 0x73, 0x4b, 0xb8, 0x30,
+	     0x0, 0xb0, 0xbe, 0x89, 0x11, 0x89, 0xf, 0xaa, 0x86, 0xba,
+	     0xfd, 0x85, 0x76, 0xb4, 0x11, 0xae, 0x66, 0x70, 0xd4, 0xd1,
+	     0xf0, 0x94, 0xf6, 0xa4, 0x79, 0x26, 0xc1, 0x5f, 0xe9, 0xfe,
+	     0x75, 0xf9, 0x2c, 0x8, 0x54, 0x3, 0x9a, 0xc9, 0x95, 0x37,
+	     0x23, 0x7e, 0x3e, 0x38, 0xff, 0xf9, 0xd4, 0xd7, 0xdc, 0xd1,
+	     0xab, 0x2, 0xa0, 0x85, 0x42, 0x96, 0xfa, 0x69, 0xc8, 0x43,
+	     0xcd, 0xd4, 0xac, 0x13, 0xef, 0xd8, 0x61, 0x8c, 0xaa, 0x46,
+	     0x3a, 0x24, 0xa8, 0x6, 0x8f, 0xba, 0x51, 0xe, 0xe6, 0x96,
+	     0x20, 0x2b, 0xf, 0x53, 0x66, 0xab, 0xe4, 0xc5, 0x10, 0x96,
+	     0x2d, 0x91, 0xfc, 0x6a, 0x73, 0x4, 0xf1, 0x3f, 0xdf, 0x89,
+	     0x9, 0xdb, 0xc3, 0xa, 0xcc, 0x38, 0x22, 0x35, 0x49, 0x96,
+	     0xca, 0x74, 0x13, 0x22, 0x2b, 0x3a, 0xf4, 0x6c, 0x32, 0xad,
+	     0x50, 0x85, 0x53, 0x7c, 0x9c, 0x15, 0x55, 0x7d, 0x87, 0x33,
+	     0x3e, 0x96, 0x5a, 0x6b, 0x34, 0x56, 0xfa, 0x84, 0x1, 0x8e,
+	     0x3e, 0x47, 0x74, 0x93, 0x69, 0xf1, 0x24, 0x30, 0xd3, 0x35,
+	     0xc7, 0xdc, 0x6c, 0x12, 0xa7, 0x3d, 0xd, 0x91, 0xb6, 0xb7,
+	     0xfa, 0xea, 0x93, 0xc3, 0xa7, 0x42, 0xb9, 0x9e, 0x63, 0x6a,
+	     0x63, 0xa9, 0x5b, 0xe3, 0x87, 0x0, 0x51, 0x56, 0x44, 0x63,
+	     0x28, 0x46, 0xa4, 0xec, 0x2b, 0xb6, 0x79, 0x85, 0x51, 0xa6,
+	     0x3f, 0xcf, 0xcf, 0x70, 0xcb, 0xbf, 0xda, 0x20, 0x20, 0x93,
+	     0x37, 0x86, 0x71, 0xc5, 0x1, 0x6b, 0xc9, 0xa1, 0xfc, 0xd8,
+	     0x83, 0xaf, 0xe2, 0x8b, 0x7a, 0x70, 0x87, 0xb8, 0x39, 0x4a,
+	     0x6, 0x80, 0x97, 0x7a, 0x79, 0xb1, 0x32, 0x9e, 0xfd, 0x10,
+	     0xb4, 0x29, 0x81, 0x6e, 0xb3, 0xe, 0x55, 0xd3, 0xf2, 0xeb,
+	     0x3, 0x6a, 0x33, 0x3f, 0x86, 0x9f, 0xcc, 0xf7, 0x8c, 0xf8,
+	     0x4a, 0xf8, 0xe1, 0x50, 0xbd, 0x47, 0x8b, 0x8, 0x42, 0x8b,
+	     0x44, 0x46, 0xd0, 0x1b, 0x9c, 0xd5, 0xa0, 0x16, 0xf6, 0xaa,
+	     0x49, 0x2d, 0x39, 0x69, 0x4f, 0xd2, 0x8f, 0x6a, 0xa8, 0xcb,
+	     0x3a, 0xd2, 0x3e, 0x70, 0x4f, 0x1f, 0x27, 0x5e, 0x2, 0x19,
+	     0xf, 0xbb, 0x97, 0x7c, 0xce, 0xe, 0x64, 0x44, 0xa6, 0xba,
+	     0x5, 0xa8, 0x25, 0xde, 0x93, 0x7e, 0x3c, 0x19, 0x86, 0xb2,
+	     0x2, 0xa3, 0xc7, 0x11, 0x76, 0xcd, 0x2a, 0x79, 0xce, 0x55,
+	     0x67, 0xcc, 0x37, 0x68, 0x65, 0x68, 0xcf, 0x60, 0x42, 0x24,
+	     0xcb, 0xa3, 0xd6, 0x9e, 0xd0, 0xad, 0xef, 0x51, 0xa, 0x63,
+	     0x89, 0x39, 0x59, 0x8f, 0x3d, 0xf4, 0x8, 0x66, 0x8, 0x62,
+	     0xee, 0x58, 0x2, 0x7e, 0xfc, 0x32, 0xb1, 0x4f, 0x1, 0xc9,
+	     0xfb, 0x46, 0x80, 0x47, 0x10, 0xd5, 0xac, 0x75, 0x16, 0x11,
+	     0xca, 0xb7, 0x17, 0x7f, 0x9d, 0x7, 0xfd, 0xd8, 0xf4, 0x94,
+	     0x7c, 0x4b, 0xdc, 0x34, 0xb9, 0x2e, 0xa6, 0x27, 0x27, 0xaa,
+	     0xc0, 0x37, 0x88, 0xc5, 0xa9, 0x3, 0x9f, 0x50, 0xc9, 0x45,
+	     0x0, 0x66, 0x20, 0x51, 0xb5, 0x46, 0xdc, 0xa, 0xf5, 0x25,
+	     0x91, 0x32, 0x9c, 0xdd, 0x5f, 0xd1, 0x7f, 0xc5, 0x2a, 0xad,
+	     0x80, 0x42, 0xdc, 0x6c, 0x13, 0x69, 0x7d, 0xc5, 0x1b, 0xd3,
+	     0xac, 0xa1, 0xcf, 0x65, 0x54, 0xed, 0xb9, 0xe6, 0x4e, 0xae,
+	     0x1c, 0xc3, 0xe1, 0xdc, 0x63, 0x95, 0x67, 0xdc, 0xf7, 0x34,
+	     0x5f, 0xb0, 0x13, 0x99, 0x37, 0x87, 0x4c, 0x2, 0xda, 0x23,
+	     0x11, 0xf3, 0x27, 0x3d, 0x6b, 0x88, 0xe6, 0x91, 0xcd, 0x6a,
+	     0x67, 0x0, 0x96, 0x9, 0xf, 0xf2, 0x3b, 0xa3, 0xf5, 0xd8,
+	     0x66, 0xd9, 0x84, 0x50, 0x34, 0xec, 0x34, 0xb4, 0xd3, 0x3,
+	     0x4, 0xae, 0xf2, 0xf3, 0x67, 0xd5, 0x13, 0x47, 0xc8, 0x25,
+	     0x8d, 0x42, 0xf8, 0x43, 0x28, 0xf5, 0x46, 0x5a, 0x38, 0x9a,
+	     0x42, 0x91, 0x1f, 0xf0, 0xfa, 0x84, 0xd9, 0xa, 0x7e, 0xdd,
+	     0xa7, 0x6c, 0xd7, 0x8a, 0x30, 0xd6, 0x54, 0x58, 0x3c, 0x4,
+	     0x80, 0x3c, 0x73, 0x9e, 0x41, 0x22, 0xe9, 0xa7, 0x31, 0x7a,
+	     0xe6, 0xa0, 0xd1, 0x48, 0xf9, 0x3c, 0x6e, 0xdd, 0x5b, 0x93,
+	     0x2e, 0x2c, 0x4b, 0x1c, 0x79, 0xc4, 0x15, 0x6c, 0x1d, 0x83,
+	     0x96, 0xcd, 0x9a, 0x3c, 0xb6, 0x9d, 0x57, 0x8c, 0x9f, 0x97,
+	     0xe, 0x31, 0x46, 0xc6, 0x62, 0x48, 0x9b, 0x4c, 0xd2, 0xaf,
+	     0x4e, 0xc8, 0x50, 0x78, 0xd8, 0x3d, 0xdc, 0xd1, 0xd7, 0x23,
+	     0xa3, 0xea, 0x48, 0x16, 0xaa, 0x31, 0xc8, 0x20, 0x68, 0x42,
+	     0x2f, 0xcb, 0x8a, 0x6a, 0x13, 0x63, 0x4d, 0x61, 0x1f, 0x71,
+	     0x36, 0xa5, 0xeb, 0xc2, 0xa0, 0xf6, 0xa8, 0x1, 0x7d, 0xd6,
+	     0x79, 0x73, 0xc9, 0xd1, 0xc3, 0x8a, 0x19, 0x46, 0x15, 0x4,
+	     0x42, 0x15, 0xdc, 0x34, 0xe, 0xa6, 0x26, 0x59, 0x45, 0xb3,
+	     0x92, 0x5f, 0xdc, 0x8e, 0x1c, 0xcd, 0x68, 0xd5, 0x50, 0x72,
+	     0x65, 0xf6, 0xa2, 0x37, 0x6e, 0x79, 0x2f, 0xc1, 0x5f, 0x2c,
+	     0x5c, 0xb7, 0xe1, 0xb3, 0xc1, 0x65, 0x34, 0xfd, 0x4, 0xed,
+	     0x6f, 0x2d, 0x49, 0x49, 0xe0, 0x43, 0xdb, 0xfd, 0xd2, 0xc8,
+	     0xa1, 0x8a, 0x52, 0x92, 0x27, 0x60, 0xfb, 0xc0, 0x47, 0x9b,
+	     0xb, 0x57, 0xd0, 0xb9, 0xb3, 0xf1, 0x31, 0x71, 0xdd, 0xdb,
+	     0x1a, 0x22, 0x17, 0x81, 0x80, 0x2, 0x2, 0xf, 0xbd, 0xc0,
+	     0x44, 0xea, 0x9f, 0xb6, 0xd0, 0x9f, 0xc2, 0x45, 0xde, 0x26,
+	     0x8a, 0x3f, 0x8c, 0xc6, 0x13, 0xc8, 0xf, 0x5f, 0xef, 0x3a,
+	     0x20, 0x61, 0x36, 0x65, 0xd9, 0x78, 0x6e, 0x37, 0x4b, 0x61,
+	     0x30, 0xb8, 0xd6, 0xd6, 0x31, 0x6e, 0x93, 0x75, 0xe8, 0xdd,
+	     0x99, 0x73, 0xa1, 0xfe, 0xa3, 0xd9, 0x0, 0xc6, 0x85, 0x7,
+	     0x41, 0x13, 0x3d, 0xf6, 0x26, 0xcc, 0xd5, 0xf3, 0x74, 0xe4,
+	     0x50, 0x82, 0xfd, 0x15, 0xf, 0xc6, 0x65, 0xea, 0xba, 0x59,
+	     0xa9, 0xa6, 0x94, 0x1, 0xed, 0xed, 0xc8, 0xcd, 0x4, 0x5e,
+	     0x86, 0xdb, 0x68, 0xec, 0x8, 0x7c, 0xe, 0x36, 0x6d, 0xd,
+	     0x26, 0xb6, 0x49, 0x81, 0x22, 0x22, 0xb4, 0x14, 0x34, 0x50,
+	     0x7, 0x47, 0xb9, 0x2, 0x3e, 0x4f, 0x33, 0x12, 0x51, 0xfc,
+	     0x4f, 0x7c, 0x97, 0x4e, 0x74, 0x2c, 0x19, 0x46, 0x98, 0x63,
+	     0x8, 0x66, 0x25, 0x1e, 0x5b, 0xbf, 0x5b, 0x9, 0x2e, 0xa5,
+	     0xd4, 0xe2, 0xca, 0xb2, 0x23, 0xc5, 0x2, 0xe0, 0xd8, 0x3c,
+	     0x5b, 0x89, 0xe8, 0x94, 0x48, 0x1, 0xf2, 0xcf, 0x83, 0xa6,
+	     0x6f, 0xf0, 0x2e, 0x79, 0xd, 0xde, 0xd, 0x1d, 0xba, 0xd5,
+	     0x0, 0xc3, 0x4b, 0xde, 0x83, 0x63, 0x55, 0x48, 0xb, 0x15,
+	     0x35, 0x1, 0x92, 0x36, 0xb0, 0x87, 0x39, 0x26, 0x5, 0x4a,
+	     0x80, 0xdb, 0xe1, 0xc1, 0x86, 0x65, 0x77, 0xf5, 0xb7, 0x6a,
+	     0x23, 0x2f, 0x5f, 0x79, 0xe8, 0x35, 0xad, 0xdd, 0x4f, 0x1,
+	     0x2e, 0x44, 0x4, 0xd, 0xab, 0x58, 0xcb, 0x58, 0xdc, 0x1,
+	     0x20, 0x37, 0xb, 0xb, 0xfc, 0xd, 0x84, 0x9a, 0xce, 0x5,
+	     0xb0, 0x4c, 0xfc, 0x53, 0xe, 0x71, 0xb1, 0xb1, 0x12, 0xed,
+	     0xea, 0xfc, 0x4, 0x7f, 0xf5, 0xdd, 0xd3, 0x9d, 0xa9, 0xd6,
+	     0x15, 0x20, 0xd4, 0x12, 0x71, 0x28, 0x38, 0x35, 0xee, 0xf,
+	     0x8c, 0xad, 0x59, 0x74, 0x90, 0xe0, 0x2f, 0x5a, 0x1, 0x32,
+	     0x52, 0x59, 0x1a, 0xdb, 0xd3, 0xd7, 0x60, 0xd6, 0xaf, 0xa3,
+	     0x28, 0x5f, 0xdb, 0x5d, 0xb3, 0x7d, 0x5d, 0xa7, 0x1, 0xf,
+	     0x80, 0xf5, 0x7, 0x34, 0x96, 0x37, 0x49, 0xa5, 0x63, 0xd4,
+	     0xf5, 0x4b, 0xc8, 0x79, 0x0, 0x2f, 0x6f, 0x8, 0x75, 0xe4,
+	     0x21, 0x84, 0xf0, 0x65, 0x95, 0xa3, 0x60, 0xbb, 0xc5, 0x46,
+	     0x95, 0xea, 0x6d, 0x85, 0x4, 0xf9, 0x85, 0xbf, 0x2d, 0x24,
+	     0xf7, 0xbc, 0x39, 0x42, 0xa1, 0x7b, 0xd5, 0x3, 0xd5, 0x1c,
+	     0x83, 0xbd, 0x32, 0xe2, 0x78, 0x74, 0x75, 0x4b, 0x88, 0xac,
+	     0x37, 0x7c, 0x80, 0x1b, 0xea, 0x9, 0x17, 0x52, 0x8d, 0x86,
+	     0x7b, 0xce, 0xc7, 0x45, 0x6f, 0x5b, 0x52, 0x96, 0xcb, 0x9b,
+	     0xee, 0x4b, 0xb5, 0x97, 0x47, 0x7e, 0x27, 0x53, 0x19, 0x4,
+	     0xd, 0x1c, 0xf2, 0x74, 0x7f, 0x8d, 0xc, 0x59, 0x78, 0xc6,
+	     0xba, 0xb3, 0xb, 0xe9, 0x12, 0xe1, 0x2b, 0x8b, 0xf1, 0xb8,
+	     0xc9, 0xd6, 0xcd, 0x28, 0xce, 0xbe, 0xa7, 0x65, 0x85, 0xe9,
+	     0x46, 0xdd, 0xfa, 0x90, 0x4f, 0xda, 0x79, 0x91, 0x7c, 0x8a,
+	     0xca, 0xe2, 0xcc, 0xe3, 0x50, 0xa8, 0x78, 0x22, 0xe4, 0x80,
+	     0xf4, 0xd0, 0x58, 0xf8, 0xca, 0x2f, 0x13, 0x64, 0x8d, 0x8f,
+	     0x6f, 0x50, 0x55, 0xb7, 0x58, 0xa8, 0xc0, 0x1, 0x8b, 0x63,
+	     0x5c, 0x26, 0x31, 0x37, 0x80, 0x3, 0x41, 0x88, 0x5, 0xbe,
+	     0xea, 0xe7, 0x3c, 0xb1, 0xba, 0x60, 0x85, 0xdd, 0x50, 0x16,
+	     0x8d, 0x19, 0x55, 0xe0, 0x12, 0x20, 0x8a, 0x9c, 0x87, 0xac,
+	     0xa3, 0x31, 0xe, 0x24, 0xd7, 0xa, 0x18, 0x66, 0xb4, 0x0,
+	     0x4f, 0x9e, 0x9a, 0x15, 0x30, 0x82, 0xc, 0xa9, 0xed, 0xcf,
+	     0x81, 0x91, 0x32, 0xbb, 0xfa, 0xe3, 0x60, 0x59, 0x32, 0xe2,
+	     0xd1, 0x97, 0x7d, 0x86, 0x26, 0xde, 0x3a, 0x44, 0xd0, 0x88,
+	     0xf2, 0x4d, 0x67, 0xde, 0xa1, 0xdf, 0xdb, 0x8, 0x29, 0x25,
+	     0x95, 0x58, 0xc6, 0xcc, 0xf, 0x2d, 0xd3, 0x59, 0x36, 0xa8,
+	     0x6d, 0xbf, 0x24, 0x63, 0xfc, 0xe6, 0x1a, 0xb1, 0x7f, 0x7a,
+	     0xe7, 0xcc, 0x86, 0x3c, 0xaf, 0x98, 0x16, 0x8b, 0xa9, 0x2d,
+	     0xa4, 0x21, 0xa3, 0x9c, 0x73, 0xf2, 0xb4, 0x6, 0x5d, 0x4c,
+	     0x6e, 0x18, 0x83, 0xae, 0xcd, 0x6d, 0xc, 0x55, 0x9d, 0xa7,
+	     0xe8, 0xce, 0x1a, 0xa0, 0x82, 0x34, 0x37, 0x79, 0x76, 0x87,
+	     0xf5, 0x72, 0x86, 0x41, 0xb2, 0xdc, 0x8b, 0x9, 0x13, 0x44,
+	     0x5d, 0x69, 0x4f, 0x7, 0xa0, 0xf9, 0x69, 0x13, 0x2, 0xc1,
+	     0x36, 0x54, 0x1c, 0xde, 0x4f, 0xf0, 0xf0, 0x23, 0xb0, 0x64,
+	     0xdc, 0x2, 0xef, 0x16, 0xd2, 0xdd, 0x14, 0x1a, 0x18, 0x73,
+	     0x44, 0x32, 0xf, 0xcb, 0x5a, 0x10, 0x7, 0xa2, 0x35, 0x8d,
+	     0xea, 0x69, 0x73, 0x23, 0xde, 0x97, 0xdb, 0xe3, 0xe6, 0xe2,
+	     0xd7, 0x9c, 0x5b, 0xf5, 0x61, 0xb8, 0xc4, 0x96, 0x80, 0x2d,
+	     0x27, 0x58, 0x5f, 0x9f, 0x93, 0x8f, 0x17, 0x92, 0x5, 0x55,
+	     0x76, 0xfb, 0x60, 0x9c, 0xbc, 0xa0, 0x91, 0x9d, 0xad, 0x3b,
+	     0x39, 0x46, 0xb, 0xc3, 0x7c, 0x9, 0xa4, 0x82, 0x44, 0x4e,
+	     0xf9, 0x9a, 0xdb, 0x39, 0x85, 0xc5, 0x60, 0x9e, 0xb0, 0xb,
+	     0xf0, 0xb4, 0x6b, 0x12, 0x7d, 0xc4, 0x13, 0x75, 0xdd, 0x49,
+	     0x63, 0x85, 0x22, 0xd7, 0x24, 0x8a, 0x88, 0x2d, 0xb2, 0x31,
+	     0x30, 0xe, 0x4f, 0x85, 0x6c, 0x2e, 0xe6, 0x77, 0x2, 0x8e,
+	     0x53, 0xa2, 0x93, 0xe8, 0xec, 0xb5, 0x88, 0x12, 0xa8, 0x71,
+	     0x2d, 0xc5, 0x7d, 0x2e, 0x79, 0x96, 0x42, 0x8c, 0x6d, 0xb1,
+	     0x6, 0xb7, 0xa5, 0x61, 0x44, 0xce, 0xc2, 0x81, 0x28, 0xa2,
+	     0xf3, 0x17, 0x83, 0x76, 0x65, 0x86, 0xfd, 0xaa, 0x66, 0x1b,
+	     0x80, 0x7c, 0x6b, 0xfb, 0x9e, 0x83, 0x0, 0x55, 0x61, 0x33,
+	     0xf8, 0xfd, 0xac, 0x0, 0xe2, 0xaf, 0xd1, 0x28, 0x7c, 0xb7,
+	     0xc3, 0x10, 0x12, 0xa4, 0x78, 0x57, 0xdc, 0x51, 0xa8, 0xbc,
+	     0x92, 0xcd, 0x6e, 0xee, 0xcd, 0xe2, 0xd8, 0xb3, 0x59, 0xae,
+	     0x6d, 0xb5, 0x77, 0xc5, 0x2e, 0xab, 0xc0, 0xec, 0xac, 0xa0,
+	     0x97, 0x97, 0xc4, 0x2c, 0x5, 0x6b, 0x70, 0x91, 0x35, 0x8a,
+	     0x2a, 0x47, 0x85, 0x3f, 0xd5, 0xd3, 0x1, 0x94, 0xe4, 0x8,
+	     0xcd, 0xe, 0x13, 0x2b, 0x8d, 0xda, 0x87, 0x5b, 0x39, 0x22,
+	     0x2b, 0xd3, 0xb7, 0x9f, 0x53, 0xbd, 0x2f, 0x1c, 0xfc, 0x10,
+	     0x57, 0xc5, 0xfa, 0x35, 0x20, 0xc6, 0x34, 0x74, 0x35, 0xb8,
+	     0x19, 0x6f, 0x40, 0x6c, 0xc9, 0x46, 0x93, 0xff, 0x27, 0x9f,
+	     0x7e, 0xbe, 0x60, 0x34, 0x6, 0x9f, 0xa3, 0xc1, 0x78, 0x18,
+	     0x2f, 0x11, 0xd9, 0xcb, 0x82, 0xfa, 0x53, 0x9a, 0x11, 0x39,
+	     0x38, 0xb0, 0x8, 0xc1, 0xe, 0x67, 0x3c, 0x4, 0x38, 0xb,
+	     0xa, 0x69, 0xfd, 0xd9, 0x91, 0x13, 0x94, 0x7f, 0x79, 0xae,
+	     0x78, 0x46, 0x21, 0xa7, 0x8, 0x45, 0x40, 0x97, 0xe6, 0x5a,
+	     0x48, 0x55, 0x9, 0x12, 0x20, 0x74, 0xbf, 0x31, 0x60, 0x16,
+	     0xac, 0x70, 0x17, 0x95, 0x33, 0xd1, 0xbf, 0xc7, 0x5a, 0x44,
+	     0x19, 0x96, 0x54, 0xb5, 0x4, 0x55, 0x90, 0x97, 0xd3, 0xfe,
+	     0x48, 0x8d, 0x81, 0xc9, 0xf, 0x6f, 0x29, 0xe3, 0x92, 0x8e,
+	     0x93, 0xc4, 0x4f, 0xbf, 0x8, 0x53, 0x4f, 0x3, 0xa9, 0x72,
+	     0xc, 0xc9, 0xc0, 0x15, 0xc9, 0x97, 0xc6, 0xc2, 0xd2, 0x83,
+	     0x56, 0xb1, 0xe3, 0x58, 0xec, 0xbe, 0x67, 0x17, 0x8, 0x14,
+	     0x23, 0x5d, 0x9f, 0xd2, 0xcf, 0xe, 0x46, 0x26, 0x5e, 0xaa,
+	     0x50, 0xfe, 0x9e, 0x32, 0xf8, 0x3f, 0x41, 0x7f, 0xe4, 0xf0,
+	     0xfb, 0xe9, 0x6e, 0x2f, 0x7c, 0x96, 0xc4, 0x1c, 0x34, 0x39,
+	     0xe1, 0xe9, 0x2c, 0x8f, 0xa0, 0xc5, 0x73, 0x5c, 0x59, 0x37,
+	     0x85, 0xeb, 0x97, 0x9, 0x3d, 0xa3, 0xd2, 0x62, 0x34, 0x24,
+	     0x5b, 0xe0, 0x7, 0x16, 0xb4, 0xfd, 0xb5, 0x57, 0xdc, 0xbf,
+	     0x5e, 0xad, 0xed, 0x5f, 0x43, 0xc1, 0x25, 0xa5, 0x8c, 0xdf,
+	     0x7b, 0x98, 0x3a, 0x6e, 0xbb, 0x27, 0x10, 0xf5, 0x23, 0x93,
+	     0xa5, 0x11, 0x20, 0xd0, 0xc1, 0xa9, 0xbf, 0x34, 0x31, 0xf3,
+	     0xad, 0xae, 0xcc, 0xe1, 0xac, 0xa6, 0x86, 0x30, 0x76, 0x5,
+	     0x2e, 0x92, 0xff, 0x13, 0x48, 0x72, 0xe, 0xba, 0xa2, 0xde,
+	     0xa6, 0xc4, 0x7, 0x47, 0x8a, 0xdd, 0x8f, 0x63, 0x12, 0x78,
+	     0xd3, 0x66, 0x30, 0x56, 0x85, 0xbd, 0x21, 0xc0, 0xd5, 0x67,
+	     0x33, 0x72, 0x1e, 0x6c, 0xdf, 0x9e, 0xbb, 0xef, 0x43, 0x94,
+	     0xb8, 0x8b, 0x7a, 0x49, 0x72, 0xd5, 0x6b, 0x84, 0x10, 0x34,
+	     0xf7, 0x52, 0xc2, 0x9, 0x68, 0x76, 0x96, 0x2f, 0xf2, 0x39,
+	     0xd2, 0xd9, 0xdb, 0xcf, 0xe3, 0xfe, 0x76, 0x91, 0xfd, 0x37,
+	     0x21, 0xb4, 0xb, 0x0, 0x6d, 0x28, 0x6, 0xfd, 0x9e, 0x97,
+	     0x11, 0xac, 0x4d, 0x4b, 0x9c, 0xc7, 0xe6, 0x3, 0xd9, 0x9,
+	     0x4f, 0xf, 0xe8, 0x52, 0x40, 0x54, 0xbe, 0xe0, 0x36, 0x60,
+	     0x3f, 0xf6, 0x63, 0x8b, 0xa4, 0xbe, 0x6, 0x4f, 0x2e, 0xbc,
+	     0x44, 0x12, 0x1b, 0x0, 0xec, 0xb2, 0x11, 0x5, 0xc6, 0x2,
+	     0x1e, 0x8f, 0xee, 0x8e, 0xb4, 0xfd, 0xe9, 0x50, 0xdc, 0x15,
+	     0x1b, 0x48, 0x67, 0x2a, 0xd9, 0xce, 0x23, 0xfc, 0xd3, 0x1d,
+	     0x33, 0x4c, 0x56, 0xfb, 0xc1, 0xd8, 0x9e, 0x2, 0xc6, 0xd8,
+	     0xad, 0x4e, 0x93, 0xdf, 0xcd, 0xae, 0x1f, 0x56, 0xa8, 0xee,
+	     0xab, 0x88, 0xbc, 0x4c, 0x52, 0xb1, 0x14, 0xf6, 0x75, 0x3d,
+	     0xd, 0x48, 0xa4, 0x2b, 0x63, 0x5, 0xea, 0x4f, 0xc2, 0xa7,
+	     0x57, 0x2f, 0x8d, 0xe5, 0x4b, 0x99, 0x8a, 0x98, 0x95, 0x8a,
+	     0x10, 0x75, 0xa5, 0xec, 0x76, 0x63, 0x32, 0x1d, 0x2c, 0xae,
+	     0xc1, 0x38, 0x25, 0x1d, 0x30, 0xe3, 0x30, 0x28, 0xf5, 0x13,
+	     0x58, 0x81, 0x98, 0x66, 0x56, 0x74, 0x8a, 0x5c, 0xfe, 0x5c,
+	     0xe7, 0xbb, 0xf5, 0xf0, 0xcf, 0x18, 0xea, 0xda, 0xfe, 0x8,
+	     0xa6, 0xd, 0xa7, 0xa0, 0xb2, 0x44, 0xbf, 0x26, 0x2, 0x37,
+	     0x53, 0x59, 0x5d, 0xd4, 0x67, 0xab, 0x41, 0x89, 0x28, 0xc1,
+	     0xb6, 0x63, 0x43, 0xcc, 0x94, 0xfe, 0x87, 0x15, 0x1b, 0xa8,
+	     0x52, 0x3, 0xd0, 0xa0, 0x7a, 0xb, 0x7b, 0x38, 0xf5, 0x56,
+	     0xe, 0x4d, 0x76, 0x1, 0x11, 0x3d, 0xf4, 0xf3, 0xe2, 0x30,
+	     0x56, 0x7f, 0xd6, 0x29, 0x84, 0xc9, 0xd6, 0x88, 0x86, 0x3c,
+	     0x51, 0xfd, 0x93, 0x1e, 0xff, 0xef, 0xc1, 0x5a, 0x35, 0x63,
+	     0xe2, 0xff, 0x70, 0x8d, 0x82, 0xdf, 0xdd, 0x9, 0x2b, 0xe1,
+	     0x72, 0x2, 0x84, 0x77, 0xc2, 0x49, 0x35, 0xe8, 0x72, 0xbc,
+	     0x99, 0x71, 0xd0, 0x82, 0x2d, 0x21, 0x7f, 0xa1, 0x15, 0x8f,
+	    	 0x00 };
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+	h[0] = h[0] % 24800;
+	h[1] = h[1] % 24800;
+	h[2] = h[2] % 24800;
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	return (uint32_t)h[i % 3];
+}
@@ -0,0 +1,10051 @@
+/* generated with rurban/nbperf 08a5797 -S _words */
+/* seed[0]: 493173797, seed[1]: 593441089 */
+#include <stdint.h>
+#include "mi_wyhash.h"
+
+/* keys of 2 to 14 bytes */
+static inline void
+_wyhash_shape(const void *key, size_t len, uint32_t *h)
+{
+	const uint8_t *p = (const uint8_t *)key;
+	const uint64_t seed = UINT64_C(0x235f31411d653c25) ^ _wyp[0];
+	uint64_t a, b;
+
+	if (len - 4 <= 10) {
+		const size_t o = (len >> 3) << 2;
+
+		a = _wyr4(p) << 32 | _wyr4(p + o);
+		b = _wyr4(p + len - 4) << 32 | _wyr4(p + len - 4 - o);
+	} else if (len - 2 <= 1) {
+		a = _wyr3(p, len);
+		b = 0;
+	} else {
+		mi_wyhash2(key, len, UINT64_C(0x235f31411d653c25), h);
+		return;
+	}
+	a = _wymix(_wyp[1] ^ len, _wymix(a ^ _wyp[1], b ^ seed));
+	h[0] = (uint32_t)a;
+	h[1] = (uint32_t)(a >> 32);
+}
+
+#include <string.h>
+const char * const hash_keys[20000] = {
+	"aa", "aaamvo", "aaaoepsaxqker", "aaawkatdsy",	/* 4 */
+	"aaazaiwmzo", "aabozllo", "aacwukjxnef", "aafjjxv",	/* 8 */
+	"aafkxt", "aafyjfdobuf", "aagbaqo", "aagwgqbdhc",	/* 12 */
+	"aahpgumys", "aahqwu", "aajoixnfterwky", "aakgie",	/* 16 */
+	"aalazfxybys", "aalqbxuarll", "aamevrbsmiecou", "aanimh",	/* 20 */
+	"aarfotdcsb", "aau", "aauljgrerearvd", "aaupkdl",	/* 24 */
+	"aavgjlqyprl", "aawplxnsl", "aaxw", "ab",	/* 28 */
+	"aba", "abb", "abcroqn", "abcyoudhuyoxv",	/* 32 */
+	"abded", "abdpauwxnyjjw", "abdvzz", "abemcsgtsaqf",	/* 36 */
+	"abgcyzzmsfaohz", "abgfzpabokt", "abghylkt", "abmtelekzgph",	/* 40 */
+	"abnnfppd", "abnznvhmvnpdsm", "abqg", "abrbqe",	/* 44 */
+	"abri", "abrsthrindrt", "abrvngkjcvst", "abttuirixp",	/* 48 */
+	"abucje", "abvlrapgztar", "abxrbvbhskm", "abzjq",	/* 52 */
+	"ac", "aca", "acat", "accdawrk",	/* 56 */
+	"acdumcj", "acfctctvvuqq", "acgeshhyiqp", "acgq",	/* 60 */
+	"acgsyaenn", "achaergtd", "acjqckgbahcww", "acklttjonmfsqw",	/* 64 */
+	"ackosnzmlndp", "aclya", "acndzbghzsnf", "acnjhah",	/* 68 */
+	"acq", "acqg", "acqzgdmgrudfev", "acrupnq",	/* 72 */
+	"actluu", "actnmsaqlxj", "acurtnbcgiuxz", "acvikspj",	/* 76 */
+	"acwmemtmnml", "acwuopbsjrdasc", "acyvmwnl", "ad",	/* 80 */
+	"adbb", "adcncxngm", "adcxr", "adfwg",	/* 84 */
+	"adgcouasqg", "adgnv", "adgorwmlnymtjv", "adgxbuovjvzrjs",	/* 88 */
+	"adhh", "adjgncgej", "adjzjjfcahdzbu", "adkrmjcofnbo",	/* 92 */
+	"adkvocwahadyny", "adnldbde", "adoalbcaylnjdp", "adoinuly",	/* 96 */
+	"adowolj", "adptyuhmk", "adsetbfuyqmlq", "adsyjfsp",	/* 100 */
+	"adu", "aduidlcplhjlw", "advxvdrmq", "advzb",	/* 104 */
+	"adwf", "adwfkizxbp", "adzplry", "adzrfo",	/* 108 */
+	"aeabb", "aeahcthpdbaspv", "aeahwehgc", "aebqchhcmwqshj",	/* 112 */
+	"aec", "aecdpkro", "aeckwcuomuwt", "aedk",	/* 116 */
+	"aedygfpc", "aeejqumjzwwp", "aegnwaegqii", "aegttb",	/* 120 */
+	"aegxoejdtmmrv", "aejhlhfpfwbweh", "aejijtnvnjlf", "aejzdahwbtl",	/* 124 */
+	"aeku", "aeooeu", "aepqhpwunt", "aernwcvnqoqe",	/* 128 */
+	"aerwh", "aesv", "aet", "aetazxsti",	/* 132 */
+	"aeuemhbrat", "aewcxnpkqffcsc", "aeyida", "aezbgcagmrrp",	/* 136 */
+	"af", "afa", "afabswrbr", "afapfsisywdfnf",	/* 140 */
+	"afcapeu", "afdajpdgtnfvw", "afdakepdzxw", "afddxironm",	/* 144 */
+	"affqgbqdmbu", "afftzswhrkc", "afkomgzyzuuwi", "afli",	/* 148 */
+	"afmnbtd", "afngooxtxdncoa", "afnnyjqxaxrb", "afnup",	/* 152 */
+	"afoeyyvxslene", "afovbwhaw", "afp", "afpbwckga",	/* 156 */
+	"afpnnyablos", "afqo", "afrhifomx", "afryjz",	/* 160 */
+	"afu", "afuza", "afwmxu", "afyiwr",	/* 164 */
+	"afypvnadao", "afystviiojvx", "afzaozrqjxnd", "agagun",	/* 168 */
+	"agb", "agbbgucvne", "agbeeflmdidbw", "agbsnfsithwad",	/* 172 */
+	"agbv", "agc", "agcsd", "agdehlqiefh",	/* 176 */
+	"agdpcsrr", "ageqe", "aggii", "agillaghnklvt",	/* 180 */
+	"agimtxt", "agl", "aglwcuiueqio", "agmgy",	/* 184 */
+	"agnqlevdskdkq", "ago", "agplhuovfvrna", "agqmjnishvnq",	/* 188 */
+	"agqynkpfvjit", "agsjix", "agtmromi", "agtybphmu",	/* 192 */
+	"aguaogtcduseei", "aguic", "aguytjckmbl", "agvqdjegqjuqsr",	/* 196 */
+	"agwprdfxkote", "agybygrpdnd", "ah", "ahbhifaktmf",	/* 200 */
+	"ahcct", "ahcsdwuzxmetm", "ahduwpxnwat", "ahefdmovzsj",	/* 204 */
+	"aheoqxi", "ahewgvpsiufqx", "ahf", "ahfqkurbpmnkzk",	/* 208 */
+	"ahhryg", "ahhsabofye", "ahhtnic", "ahlgnmozmmnkn",	/* 212 */
+	"ahlykcsbfezz", "ahmadaj", "ahor", "ahpib",	/* 216 */
+	"ahrkhwhlmdzr", "ahrycyyg", "ahs", "ahtjsnkbpuhw",	/* 220 */
+	"ahvmo", "ahwbwarqo", "ahylzbulai", "ahzhm",	/* 224 */
+	"ahzvwxaxic", "ai", "aiabbdwlhf", "aialwmtykvoz",	/* 228 */
+	"aiamjyqonb", "aicawrwtslqawy", "aig", "aihaiukqsvfylo",	/* 232 */
+	"aihejtm", "aihs", "aij", "aijbmhwsoasy",	/* 236 */
+	"aijebj", "aijjdynfcxgv", "aijsj", "aijxwzfpmr",	/* 240 */
+	"aikdmo", "ailhkdpxhle", "aingte", "aintnw",	/* 244 */
+	"air", "airrvbjwdb", "aitazbtn", "aiuvbj",	/* 248 */
+	"aivfpzdv", "aivraamggx", "aivrmjybsv", "aiwco",	/* 252 */
+	"aiwtcn", "aixlmqiyyutkb", "aiyzuochuktjgr", "aiz",	/* 256 */
+	"aizx", "aj", "ajcebz", "ajexeuma",	/* 260 */
+	"ajfujbdn", "ajirnfcltff", "ajj", "ajlw",	/* 264 */
+	"ajni", "ajogop", "ajpeg", "ajpkohinytla",	/* 268 */
+	"ajpnyfjl", "ajufbpaxc", "ajukmqlxl", "ajusjcrruqqrss",	/* 272 */
+	"ajvn", "ajwnad", "ajxfglmqkd", "ajxxmhjpbst",	/* 276 */
+	"ajy", "ajykjjue", "ajzkohlbnpfn", "ak",	/* 280 */
+	"akbzrbdp", "akcxbwl", "akd", "akdlazy",	/* 284 */
+	"akdwgr", "akdxmrlmj", "akefpqxsrzirma", "akfzpgvbi",	/* 288 */
+	"akgezjlnha", "akhowmxjnmg", "akjqay", "akkadpkznbkjrm",	/* 292 */
+	"aklkzzrtgi", "aklqzw", "aklyfeuf", "akmpovgxd",	/* 296 */
+	"akowhnzwlmbv", "akpca", "akpgjhg", "akpwxtipo",	/* 300 */
+	"akqwfhfoctaka", "akrjrqaqqwqed", "akroj", "akrupa",	/* 304 */
+	"akssyan", "aktpm", "akufanjkxmoxet", "akyaeacuxejm",	/* 308 */
+	"akywfelhvsbwzx", "akzcid", "akztebpoapmapf", "al",	/* 312 */
+	"aleejapuapcyzs", "alfzrlptvhdikn", "algykc", "alh",	/* 316 */
+	"alhwkvvhxdwq", "alipupnolwtat", "alirx", "aliu",	/* 320 */
+	"alkndu", "alllruhtbki", "alnncrnou", "alpgzprsmya",	/* 324 */
+	"alqlsmfpewpo", "alrokxhurell", "alrpbhdkfvd", "als",	/* 328 */
+	"aluqswv", "alv", "alwbqvrib", "alwodnzveidli",	/* 332 */
+	"alybopztfvkmwl", "am", "amafiexdione", "amagl",	/* 336 */
+	"amdtrjkowurky", "amdxqzu", "amepbcmqers", "amgl",	/* 340 */
+	"amglwwmvafic", "amhocvas", "amianjuvwy", "amiwnd",	/* 344 */
+	"amjfbefm", "amjr", "amjyxnjsu", "amk",	/* 348 */
+	"aml", "amlajk", "amlkgaoelk", "amnd",	/* 352 */
+	"amp", "amqumqgepywx", "amtespnycxhrna", "amua",	/* 356 */
+	"amuaclj", "amvjbh", "amvuhhqkzczohh", "amw",	/* 360 */
+	"amxjh", "amxqtdhni", "amyg", "amyic",	/* 364 */
+	"amypheipnls", "an", "anai", "anbvfjavrwpyin",	/* 368 */
+	"anemeaieosxx", "anff", "angdqpdmft", "anguwxzlilk",	/* 372 */
+	"aninljfxl", "anlfb", "anlvcbtkbgqhf", "anptornqlqtpis",	/* 376 */
+	"anpzxxcntx", "anqeya", "anqgigorvtg", "anqw",	/* 380 */
+	"anrkwivghygoiv", "ans", "ant", "anuuwxgudkzdw",	/* 384 */
+	"anwklkxyn", "anxwedh", "anzigluouypzo", "anzrgxko",	/* 388 */
+	"ao", "aoaqfafxmywmkf", "aob", "aobm",	/* 392 */
+	"aocbjq", "aocgprkwsyelk", "aofdiebh", "aofeeilsphqi",	/* 396 */
+	"aogr", "aohfxjunb", "aohshtvbl", "aoipkjqnskqxv",	/* 400 */
+	"aojp", "aojpzddjar", "aokjjy", "aokszgzzmb",	/* 404 */
+	"aolgzpjcanya", "aolismvrqhw", "aoluupkbomvtw", "aongrogeaitfe",	/* 408 */
+	"aonm", "aoobzdhtvvwy", "aooidxlqowtb", "aopphpcemi",	/* 412 */
+	"aoqclsk", "aoqvpwifudrraw", "aordmjaccjfra", "aoreagatoud",	/* 416 */
+	"aovjcrmiu", "aovk", "aovoufl", "aovvtczrc",	/* 420 */
+	"aovxq", "aox", "aoxkxeye", "aoxxzsgg",	/* 424 */
+	"aoyla", "aoymp", "aoz", "aozchu",	/* 428 */
+	"ap", "apdbribsdymcir", "apdq", "apdumidzy",	/* 432 */
+	"apfpjgsiztsi", "apght", "apijmcafchdgjq", "apjqh",	/* 436 */
+	"apmb", "apnbsvx", "apnsa", "apnxqbhntoevwz",	/* 440 */
+	"apoagwnopnc", "apoksoahdk", "apoxufrps", "appxvypap",	/* 444 */
+	"aprkejwd", "aprrxamsubs", "apszjdhexvgrhi", "aptmbojveltgbm",	/* 448 */
+	"aptnbhdxmvrqas", "apuw", "apv", "apvecnkopt",	/* 452 */
+	"apwilmyz", "apxvrkgnsi", "apyotdpei", "apzvkshb",	/* 456 */
+	"aq", "aqaeyen", "aqaxxjbxfl", "aqbacwwhqor",	/* 460 */
+	"aqbj", "aqdayjchue", "aqdekxkzks", "aqdhf",	/* 464 */
+	"aqfhlnmxzcdi", "aqftiwbsvmutcd", "aqfuykqjfa", "aqg",	/* 468 */
+	"aqgqyaujeajf", "aqiy", "aqjlr", "aqjra",	/* 472 */
+	"aqkr", "aql", "aqlduhjid", "aqlhyotznj",	/* 476 */
+	"aqlxubdylgq", "aqm", "aqnwqkbt", "aqozrrayhcz",	/* 480 */
+	"aqspytz", "aqt", "aqtkglsvjlwg", "aqvpvvskgmdzda",	/* 484 */
+	"aqxydxmjjdl", "aqynpq", "aqyom", "aqz",	/* 488 */
+	"aqzfqhxs", "aqzite", "ar", "ara",	/* 492 */
+	"arcpe", "arcuckn", "ardxeq", "ardzqqnzee",	/* 496 */
+	"are", "arghlqfwhnodip", "arhpfrahecaek", "aribks",	/* 500 */
+	"arict", "arikk", "arivnzklsg", "arjvyxuecqlsz",	/* 504 */
+	"ark", "arkhlu", "arlxkk", "armorcdpej",	/* 508 */
+	"armqdlybyplyn", "arms", "arnrjwcdzkwzqo", "arnzzukeimkcc",	/* 512 */
+	"arohoeaiy", "arqeqfnk", "arrbknk", "arrdni",	/* 516 */
+	"arrtztk", "aru", "arucxbw", "arxcppjvzzmw",	/* 520 */
+	"aryswrjcv", "arzbdrgcmfau", "arzhnfvf", "arzuljwsk",	/* 524 */
+	"asalrmfafppxfd", "asbeorwhpaatq", "ascmpo", "asdgbs",	/* 528 */
+	"asfxudbxe", "asgecyh", "asglzmhxtvfdk", "asgshnvjawpg",	/* 532 */
+	"ashlpq", "ashulbmpklnf", "asiozyxlcb", "asiq",	/* 536 */
+	"asitgqqvz", "asizstlxnmldg", "asjizgsn", "aslx",	/* 540 */
+	"asnhn", "asnjeueyiibnr", "aso", "asp",	/* 544 */
+	"asr", "asroqqyd", "assdbsqadkklyr", "asss",	/* 548 */
+	"assujmboblyla", "assvf", "asukvsmwgtztm", "asun",	/* 552 */
+	"asupfarknyyqhu", "asxbiaro", "asxtnyw", "aszjj",	/* 556 */
+	"aszqjyz", "at", "atasxvjfdd", "atbgsbxekj",	/* 560 */
+	"atdxmowgxodbg", "atg", "atgflcfwh", "atghmtgzeb",	/* 564 */
+	"atgs", "ath", "atij", "atkramwifnwq",	/* 568 */
+	"atkwncxsx", "atlzvm", "atmuiszpjkp", "ato",	/* 572 */
+	"atrb", "attdvy", "attt", "atuavewemtrsm",	/* 576 */
+	"atumme", "atur", "atvaeladu", "atvruu",	/* 580 */
+	"atwxgh", "atzyt", "au", "auarghyogn",	/* 584 */
+	"auby", "aucfoymvqzjeeq", "auehjyeax", "auemxrdoay",	/* 588 */
+	"auepbxwj", "aufjgmihgiwou", "augdbjermtl", "augkpkwxbi",	/* 592 */
+	"augpp", "augqmrgdnuuq", "augyhqves", "augyyboevwfgt",	/* 596 */
+	"auhr", "aujwepnim", "aulld", "aumywooz",	/* 600 */
+	"auomaojqsownim", "auoypcs", "auqrwvdyryab", "aurghovsqy",	/* 604 */
+	"aurwo", "ausybq", "autcnzpgn", "autoht",	/* 608 */
+	"auvbuykmd", "auvnrkb", "auvwrpfygwjgen", "auyxu",	/* 612 */
+	"av", "avap", "avbcyego", "avc",	/* 616 */
+	"avcmlnhmcmvwph", "avctrko", "avejfof", "avelskvcusw",	/* 620 */
+	"avfgogievupuf", "avhd", "avhks", "avhnhwgots",	/* 624 */
+	"avhrnkcn", "aviqn", "avknwpc", "avlbkhyycggr",	/* 628 */
+	"avlez", "avlijhsccnty", "avoewxrvewnk", "avpxgzavyb",	/* 632 */
+	"avrtcuwxd", "avsmcb", "avsnfa", "avsoi",	/* 636 */
+	"avstzwuxnyukeb", "avucflgumvboz", "avvm", "avvrcjnpw",	/* 640 */
+	"avytejzij", "avz", "aw", "awadf",	/* 644 */
+	"awaenhasdvibam", "awbxrtjoa", "awckekjgfbhfoz", "awdwwfpce",	/* 648 */
+	"awelebpxvyz", "awfzwgoeyh", "awktgwbrh", "awmr",	/* 652 */
+	"awpceoqjuewew", "awq", "awrlebnfhidt", "awrpp",	/* 656 */
+	"awwaipm", "awwbunk", "awwdaxmozk", "awwvjop",	/* 660 */
+	"awxjflfkvzcf", "awyyehm", "awzpvraboqxrh", "ax",	/* 664 */
+	"axbub", "axcus", "axfpbzmiscjwe", "axgvfbwvwn",	/* 668 */
+	"axifhymfsrre", "axirzlmia", "axjovnoynhxcgp", "axjqcyho",	/* 672 */
+	"axkyzbvmj", "axmatqc", "axpaljfblns", "axpjimge",	/* 676 */
+	"axqclcoujeu", "axqfflmwagnb", "axvbmjcmu", "axxhcrfysw",	/* 680 */
+	"axxwaq", "axzhnlgyw", "axznsdejodm", "ay",	/* 684 */
+	"ayaguqcyf", "ayardvhgchqlwt", "aybkz", "aybsbwif",	/* 688 */
+	"aycixdathok", "ayd", "aydt", "aydvrvlia",	/* 692 */
+	"aye", "ayfle", "ayfpvmjju", "ayfyqo",	/* 696 */
+	"aygjtv", "aygl", "aygse", "aygvbpwqxto",	/* 700 */
+	"ayk", "ayndurltg", "ayqroi", "ayrtxzkgx",	/* 704 */
+	"ayurhakpbgm", "ayv", "ayvhf", "ayvidfhrm",	/* 708 */
+	"ayvs", "ayvz", "ayxdzd", "ayxkgs",	/* 712 */
+	"ayy", "az", "azaeznmkwi", "azbibra",	/* 716 */
+	"azdcmxfes", "azdkvwfwudtabt", "azdrbjhmwqmlxq", "azeu",	/* 720 */
+	"azgiwdgycss", "azhq", "azhxsnqtjp", "azkewersoh",	/* 724 */
+	"azkgkokspcsxyy", "azlldh", "azmbiqx", "aznft",	/* 728 */
+	"azojzmhmvgw", "azqzqvhelmnekn", "azsjaleohobshu", "azunqkleaevv",	/* 732 */
+	"azuvj", "azuvtvfjghuvki", "azvkpvmmqv", "azzcerqz",	/* 736 */
+	"azzeqljhdz", "ba", "baazajzi", "babof",	/* 740 */
+	"badoc", "badrq", "baeaifbpywwns", "baediyfxp",	/* 744 */
+	"baefi", "baeq", "bagqafqf", "bagufnamedqhln",	/* 748 */
+	"bahpxm", "bahqzidllfa", "bahvobkwdidd", "baicsilotqif",	/* 752 */
+	"baixrb", "bajgfdbgxfkrlv", "bakpwahrebmdh", "bakvd",	/* 756 */
+	"bakxb", "balrxviengxws", "bammvjyqvjhx", "bamudyxdpugduv",	/* 760 */
+	"banv", "baotq", "bappr", "bav",	/* 764 */
+	"bawvglqhodxlv", "bawzbmwv", "baxmmnvestev", "baymotz",	/* 768 */
+	"baziywgorpwxn", "bb", "bbaibijfrptw", "bbaqrzywu",	/* 772 */
+	"bbayrlie", "bbbzxvaokcjjn", "bbdkzao", "bbdtbwrrzyp",	/* 776 */
+	"bbetmejicwr", "bbglsgkhhpjgy", "bbh", "bbjmzj",	/* 780 */
+	"bbrciffax", "bbtbfnuuhcind", "bbtjg", "bbtrkn",	/* 784 */
+	"bbuwoojy", "bbvatgkvdogzxw", "bbvkeedqgsf", "bbwoeopqygz",	/* 788 */
+	"bbww", "bbxgulxlql", "bbxy", "bbynjbzndb",	/* 792 */
+	"bbytzrg", "bc", "bca", "bcbogjbvqrza",	/* 796 */
+	"bcbue", "bccuohhjalg", "bcemhv", "bcf",	/* 800 */
+	"bcfqaunfrb", "bcfxvjqoqaccu", "bcgejmayphgj", "bcgfmuo",	/* 804 */
+	"bckeht", "bckldqjbp", "bclavkpvnjmu", "bcleg",	/* 808 */
+	"bclpx", "bcmtpljsczw", "bcnkqlrhjq", "bcnqq",	/* 812 */
+	"bcnzjtwyiyy", "bcosnlgqblp", "bcpkhby", "bcpkng",	/* 816 */
+	"bcqvvjzlegnf", "bcr", "bcrzqzn", "bcsm",	/* 820 */
+	"bcsykbyrcb", "bctpqwmsnvh", "bcuh", "bcvljjb",	/* 824 */
+	"bcvqnowfeg", "bcxd", "bczt", "bd",	/* 828 */
+	"bdacsmnculmcq", "bdcprnlpdkrvl", "bdfnevzpq", "bdhccb",	/* 832 */
+	"bdjilotpkildck", "bdkndvylxuxo", "bdl", "bdlyrtxes",	/* 836 */
+	"bdmfyqwxuf", "bdnbkoe", "bdnejntcdrqve", "bdnufpoxdxux",	/* 840 */
+	"bdpnc", "bdpybuwwa", "bdrapgoaq", "bdrkkeq",	/* 844 */
+	"bdrrborticaxib", "bdseqqylrizsul", "bdtqq", "bdudzrtalhwcap",	/* 848 */
+	"bdui", "bdvuvhboykx", "bdw", "bdycki",	/* 852 */
+	"bdyzmnp", "be", "beagrthtp", "becmmblivgijmo",	/* 856 */
+	"bedwfiaesztb", "beedabmibnzzb", "behahrymnzmlgc", "beilkaiubdvku",	/* 860 */
+	"beivnwe", "bekxbx", "belpl", "belw",	/* 864 */
+	"bemcinpjdq", "beolqvpzfxf", "beoxxqgo", "bepewpnpjatiru",	/* 868 */
+	"bepiorywl", "bepmsur", "beqzxtqbfdr", "berwgeebepz",	/* 872 */
+	"besmlmrphhawpr", "bevbeeofe", "bevz", "bewamoowipmcb",	/* 876 */
+	"bewwuq", "bexgr", "beyxvt", "bezoe",	/* 880 */
+	"bf", "bfasppnandsz", "bfcfvan", "bfdixpxt",	/* 884 */
+	"bfex", "bfezpbufygz", "bff", "bffuecdod",	/* 888 */
+	"bfgndmggnr", "bfgwpr", "bfirbahyc", "bfkjw",	/* 892 */
+	"bfleejld", "bfmoevqtgxr", "bfnotan", "bfocrratxrcfqm",	/* 896 */
+	"bfor", "bfqdcut", "bfqgtpjkndqch", "bfqhuvfmvzyji",	/* 900 */
+	"bfry", "bfud", "bfudo", "bfuelxdm",	/* 904 */
+	"bfulzk", "bfvkfarob", "bfvqoc", "bfx",	/* 908 */
+	"bfxojuzxhqu", "bfyavwepuqps", "bfyeovbyiuw", "bfzsfvxobwhfok",	/* 912 */
+	"bg", "bgaj", "bgakdggioxxtsd", "bganhvs",	/* 916 */
+	"bgaxooeiqvbmtz", "bgc", "bgckovjdh", "bgdfc",	/* 920 */
+	"bgdrlzv", "bgh", "bgiuabechv", "bgjingfapqbe",	/* 924 */
+	"bgld", "bgmlldvucq", "bgn", "bgnhp",	/* 928 */
+	"bgnkeruy", "bgonv", "bgqigoxdfl", "bgqkccdufr",	/* 932 */
+	"bgsdzqeklmuyn", "bgtfqtqzskrp", "bgu", "bgvwfdzhllnt",	/* 936 */
+	"bgwpygmkjptqi", "bgwzmhj", "bgyojmkonvnszc", "bgzyhxcsvstjpq",	/* 940 */
+	"bgzzd", "bh", "bhbidhdvx", "bhcklnltpaetl",	/* 944 */
+	"bhcqzspz", "bhdrcxio", "bhezkqganmkla", "bhftwm",	/* 948 */
+	"bhfukaju", "bhha", "bhjnmrmwuufq", "bhkdpkcplsk",	/* 952 */
+	"bhkmw", "bhmsap", "bhqjgtptbak", "bhrcwalapbux",	/* 956 */
+	"bhsfq", "bhswgx", "bhw", "bhwbjuoghpyphf",	/* 960 */
+	"bhwdvywdg", "bhwtetktboou", "bhyvanlexudizp", "bhyzesomeviv",	/* 964 */
+	"bi", "biamytpegbp", "bic", "bidznmilgb",	/* 968 */
+	"bigmtmnhlhcadk", "bikawv", "bimnkx", "bink",	/* 972 */
+	"biopdqt", "bip", "biph", "biqakmpoxsdtg",	/* 976 */
+	"biqgcz", "biqnbx", "birtinutrik", "bisahszesqkyfq",	/* 980 */
+	"biszstem", "bitbidpy", "biteikqwq", "bivh",	/* 984 */
+	"bivy", "biycafsmilc", "biygzzsmxiy", "biziirfyc",	/* 988 */
+	"bizj", "bizk", "bj", "bja",	/* 992 */
+	"bjbfr", "bjbiknmw", "bjceinmzedt", "bjcopoptplk",	/* 996 */
+	"bjd", "bjdiiqxrit", "bjeapaqyqb", "bjehuqnch",	/* 1000 */
+	"bjemyledserxxr", "bjhee", "bjhzcbtyddg", "bjibzwckdwu",	/* 1004 */
+	"bjidvw", "bjikqaerbgk", "bjjgfr", "bjjljfls",	/* 1008 */
+	"bjjnikgfcr", "bjkcpopbl", "bjkwytxbasocj", "bjlqgblbuvrr",	/* 1012 */
+	"bjlwqalwvlt", "bjlyvawtoksa", "bjmneuu", "bjmvo",	/* 1016 */
+	"bjnnv", "bjnsyaohwlw", "bjouwlztv", "bjpcl",	/* 1020 */
+	"bjpsj", "bjrpgwvmogoweb", "bjui", "bjupfsqvk",	/* 1024 */
+	"bjuvzhxdtnti", "bjvw", "bjwemmoe", "bjyblgkf",	/* 1028 */
+	"bjydptvnpmixkc", "bjztpomavlhpef", "bk", "bka",	/* 1032 */
+	"bkatjqwtsyubi", "bkbmmvkjqdzzp", "bkbqhnrjrf", "bkbymfdxh",	/* 1036 */
+	"bkcaozeooam", "bkcfh", "bkdjw", "bkfkbgzynp",	/* 1040 */
+	"bkfruuncovceme", "bkfrzgevc", "bkgy", "bkhbkldlaxnb",	/* 1044 */
+	"bkhbwawf", "bkhgsxoqh", "bkhploh", "bkhywfm",	/* 1048 */
+	"bkldofml", "bklqhjnblz", "bkmvcczanfo", "bknymoxhz",	/* 1052 */
+	"bko", "bkptozixprdqzv", "bksidfnqja", "bkt",	/* 1056 */
+	"bkttq", "bkvrwp", "bkvuqethv", "bkxbatuw",	/* 1060 */
+	"bkxzvsodhvhrpj", "bkyqw", "bkzcu", "bl",	/* 1064 */
+	"blacbniwpbec", "blathzohqkfnw", "blaxvvpocbww", "bldciboswxjez",	/* 1068 */
+	"bldmewvggqa", "bldqgafcg", "ble", "blfgcchmrbp",	/* 1072 */
+	"blfiutoezbuyon", "blhykgcjcfhj", "blijgbdkycir", "bljhuqjysfsjcy",	/* 1076 */
+	"blkaifdchb", "blkcnjswgc", "blkrddguar", "bllcswqruiw",	/* 1080 */
+	"blmxe", "blqzpgwnocn", "blrjnjnq", "blstd",	/* 1084 */
+	"blsz", "bltg", "blvjeisyf", "blx",	/* 1088 */
+	"blxd", "blydkbgx", "blywjk", "blz",	/* 1092 */
+	"blzgxrxchhoxy", "bmbbgumfhg", "bmbc", "bmbe",	/* 1096 */
+	"bmbsrkhll", "bmc", "bmcfywrj", "bmdtcrb",	/* 1100 */
+	"bmecwmmjs", "bmfvcfpke", "bmfvr", "bmgtfsuj",	/* 1104 */
+	"bmgxrjbk", "bmmdpbguuf", "bmmnkdgkem", "bmnjbn",	/* 1108 */
+	"bmnrvkp", "bmob", "bmpgfq", "bmqve",	/* 1112 */
+	"bmrinfm", "bmrkx", "bmstcbgj", "bmtcr",	/* 1116 */
+	"bmthbgy", "bmu", "bmucfzasp", "bmulp",	/* 1120 */
+	"bmwrfvqhqbfbal", "bmwtqi", "bmxaovs", "bmydpgfvtglwhl",	/* 1124 */
+	"bmyr", "bn", "bnbmofy", "bnbq",	/* 1128 */
+	"bncgas", "bncmzee", "bncvygl", "bndesm",	/* 1132 */
+	"bneoivryzmuppu", "bnidrmlvlos", "bniltwvov", "bnim",	/* 1136 */
+	"bniuiqrby", "bnjvveidsdmjd", "bnleecgutmj", "bnnyruuzyi",	/* 1140 */
+	"bnoudfoprj", "bnp", "bnppnvvkd", "bnprhihfej",	/* 1144 */
+	"bnprkgaeppi", "bnrv", "bntiwyeuqpri", "bntqm",	/* 1148 */
+	"bnuxju", "bnv", "bnvjukcxbhlp", "bnvooodksq",	/* 1152 */
+	"bnwmpyx", "bnwtdvtvc", "bnx", "bnxilwdggxxbn",	/* 1156 */
+	"bnxneruekx", "bnyaahtxwg", "bnybhazdp", "bnzdtu",	/* 1160 */
+	"bnzeafz", "bnzqfijlcvpenf", "bnzvqw", "bo",	/* 1164 */
+	"boalqokzfwvg", "bobhdqi", "bocymygfiudf", "bodaunvxsvxoo",	/* 1168 */
+	"bodpdbgihpbl", "bodrrxxlzglhc", "boedwt", "boeouhid",	/* 1172 */
+	"bofzyeqk", "boge", "boirp", "bondl",	/* 1176 */
+	"bop", "bopbayniqmdv", "boppn", "bopriurkxmpuqs",	/* 1180 */
+	"boqylknm", "borpgugei", "borrfniyw", "bort",	/* 1184 */
+	"boswkzi", "bouilvxgcj", "bovyhbyzoq", "bowlrctnvq",	/* 1188 */
+	"bowoaswn", "boxg", "bozvgokcfw", "bp",	/* 1192 */
+	"bpayshhqry", "bpbklkxzuhibbe", "bpbvmdp", "bpbzactoazuhe",	/* 1196 */
+	"bpczgeqm", "bpekn", "bpetdxjzskgczu", "bpgcvzoed",	/* 1200 */
+	"bphlu", "bphmydk", "bphuahvytcqi", "bpjl",	/* 1204 */
+	"bpjypmmjhbemhm", "bpkmrxmgj", "bpkp", "bpkpkmaa",	/* 1208 */
+	"bpkwnx", "bpleiu", "bpllz", "bpmlmfw",	/* 1212 */
+	"bpmryoxwqfvo", "bpplest", "bppljhtgdfwnae", "bpqcdquwmzqv",	/* 1216 */
+	"bpry", "bpscjbdeausjub", "bpsngdhq", "bptp",	/* 1220 */
+	"bpvdbmxi", "bpveqfrrb", "bpvmwulmqfrxbq", "bpwegk",	/* 1224 */
+	"bpzdrqwxw", "bpzyeiyrqzsq", "bq", "bqajagvpg",	/* 1228 */
+	"bqcpfwcorm", "bqerfmrla", "bqevfkoggqit", "bqgqaomgsuaz",	/* 1232 */
+	"bqgqvovdduz", "bqidkpwattacg", "bqjcohfsssgqj", "bqjvext",	/* 1236 */
+	"bqk", "bqklohwdpncmpw", "bqn", "bqoqlrdvoc",	/* 1240 */
+	"bqswkmizufbvbs", "bqtyxkb", "bqublwi", "bqvlndo",	/* 1244 */
+	"bqwkcyms", "bqx", "bqybp", "bqyjkobjyvkiqg",	/* 1248 */
+	"bqylqkysligxzj", "bqyxaqbaivrnxd", "br", "braknzs",	/* 1252 */
+	"brawx", "brcmflxdbx", "brdix", "breiixqbvgcpj",	/* 1256 */
+	"brgrcng", "brgspcqgohzkqy", "brijzr", "briplk",	/* 1260 */
+	"brku", "brlnpcajnife", "brm", "brnhbzacnbym",	/* 1264 */
+	"brnjfpmpzxhqu", "brnqo", "brnxjkxthg", "brpanjsxk",	/* 1268 */
+	"brq", "brqpaok", "brqxni", "brqy",	/* 1272 */
+	"brri", "brroodiiollv", "brrsujnjyw", "brrzgyzg",	/* 1276 */
+	"brujuufxrazwfw", "brulapmotccfa", "brvjkxmuvyfat", "brvk",	/* 1280 */
+	"brxllokql", "brybhlh", "bryk", "brzkptfim",	/* 1284 */
+	"brzpf", "bs", "bsarmpmxnk", "bscxd",	/* 1288 */
+	"bsgngrtxgbcju", "bshf", "bsjmseruly", "bsjugvvpv",	/* 1292 */
+	"bskjdhuywwak", "bsklnkqsghxa", "bsldo", "bsoyz",	/* 1296 */
+	"bspwptpdynveo", "bsrk", "bsrvftwaivbi", "bss",	/* 1300 */
+	"bsuyxkmi", "bswzdd", "bsxpelrcehncu", "bsyg",	/* 1304 */
+	"bsyllfo", "bszqmktytdwxkw", "bt", "bta",	/* 1308 */
+	"btahnpwg", "btdz", "btexkfuczdglu", "btflwyoi",	/* 1312 */
+	"btg", "btgxclatimjn", "btic", "btkjjsud",	/* 1316 */
+	"btkvavke", "btlsjeiepnuxtv", "btnqvhu", "btntlkfuik",	/* 1320 */
+	"btnvmdk", "btpyoxapij", "btqcgelwbsg", "btqvtdpugoaulk",	/* 1324 */
+	"btqxaoty", "btqzabdjbj", "btt", "btwkpci",	/* 1328 */
+	"btwrkhcwcjk", "btxgedfg", "btyi", "bu",	/* 1332 */
+	"buamkjcdzqoayr", "bub", "bubmyj", "bucsaosuoyxb",	/* 1336 */
+	"budlnnaonqopcn", "budlzaiy", "buexxtcoxxh", "bufeyqfhtpkn",	/* 1340 */
+	"bufuhruvuohba", "buhg", "buiss", "bujawtzosiprvd",	/* 1344 */
+	"bulsyyfj", "bulyjrrx", "bunsahlbdcpvk", "bunsjnjuqfxfz",	/* 1348 */
+	"buqsoumtmb", "buqysrjthffszn", "burjcsuovkpmt", "burzepjeumfx",	/* 1352 */
+	"buspbwq", "buu", "buubydokpgjn", "buvwlareosksoz",	/* 1356 */
+	"buw", "buwxcwmdmunh", "buyhhgraohnh", "buzi",	/* 1360 */
+	"buzknnq", "buzwmop", "bv", "bvccao",	/* 1364 */
+	"bvciydm", "bvdius", "bve", "bvfmnezg",	/* 1368 */
+	"bvgxgih", "bvhfd", "bvjalthlsf", "bvjvtfvaatocfe",	/* 1372 */
+	"bvjxdcdptxa", "bvkcsptfvgtkoj", "bvkxorxcyjvd", "bvmns",	/* 1376 */
+	"bvqiggz", "bvrbrovzbstvlv", "bvrgimeiaem", "bvrngmigzalz",	/* 1380 */
+	"bvsnbyjwggdht", "bvstyydnsiwfqp", "bvtkhh", "bvtthc",	/* 1384 */
+	"bvtuby", "bvtwltr", "bvwqkisb", "bvxbvdgxbcur",	/* 1388 */
+	"bvxmbdyukium", "bvxollyzau", "bvymmidjcyc", "bvywphfved",	/* 1392 */
+	"bw", "bwaao", "bwcyuhz", "bwdmxeu",	/* 1396 */
+	"bwgaygrsu", "bwghngvjefe", "bwgkeswgvx", "bwgt",	/* 1400 */
+	"bwjpnk", "bwlc", "bwmfxqybdceud", "bwnvdlmji",	/* 1404 */
+	"bwoxzsibfrwn", "bwq", "bwqjwoibz", "bwtcbdrabxjpi",	/* 1408 */
+	"bwtfvi", "bwtm", "bwtn", "bwtxqht",	/* 1412 */
+	"bwuxxgzald", "bwwg", "bwwgzbbpsqr", "bwzlfyb",	/* 1416 */
+	"bwzyrmaghsy", "bx", "bxafvo", "bxcqus",	/* 1420 */
+	"bxfsykeevdus", "bxhefmozw", "bxifv", "bxioxztoaz",	/* 1424 */
+	"bxirjstyziom", "bxiygklloyvtm", "bxjkcvwizcdua", "bxmquboivvg",	/* 1428 */
+	"bxnwugmeryzdn", "bxpa", "bxqwgsvqrlex", "bxranfwgtx",	/* 1432 */
+	"bxrgqdrmphvux", "bxrjkgxqk", "bxrxzjlr", "bxsgrbddzepfdh",	/* 1436 */
+	"bxvuah", "bxvv", "bxxytn", "bxyrt",	/* 1440 */
+	"bxzqnhsylsv", "by", "byae", "byaquao",	/* 1444 */
+	"bybglejzqxj", "bybs", "bydbb", "bydxzci",	/* 1448 */
+	"bydzlgr", "byeqgylfxgpjnv", "byfisdtqchqkh", "byfpybjo",	/* 1452 */
+	"bygbjfwawebp", "byghm", "bygw", "byiau",	/* 1456 */
+	"byiiou", "byil", "byjgw", "byl",	/* 1460 */
+	"bymlkpzrll", "bynilhpfmft", "byoduuyho", "bypfaldaunhwvz",	/* 1464 */
+	"byqfpbexx", "byr", "byrb", "byrmyxhavxz",	/* 1468 */
+	"byrtcw", "byrvbiarxspngs", "byt", "byuvtzysocdrl",	/* 1472 */
+	"byuysfpzfyofn", "byzxp", "bz", "bzbyuhgmvymtp",	/* 1476 */
+	"bze", "bzfizeek", "bzfrhygcdxirc", "bzfxxo",	/* 1480 */
+	"bzfzngv", "bzgopqatxae", "bzgvucmdvojvq", "bziyt",	/* 1484 */
+	"bzjo", "bzkgllfpr", "bzlnecjadugakp", "bzmxagrp",	/* 1488 */
+	"bznvzchok", "bzohr", "bzqpwc", "bzrqbnojmsj",	/* 1492 */
+	"bzrxiuhn", "bzsl", "bzuirq", "bzurcuuqbei",	/* 1496 */
+	"bzuxrpet", "bzvxlabphi", "bzxn", "bzzzopegbad",	/* 1500 */
+	"ca", "caac", "caacl", "caboub",	/* 1504 */
+	"caclgsg", "caclswcnkcfuxd", "cacwgzrxaheyhz", "cacwtm",	/* 1508 */
+	"cad", "cadswcmb", "caejgfwepjmgaz", "cag",	/* 1512 */
+	"caiulajm", "cajjyzwzg", "cajxyydyflfyj", "cakphnle",	/* 1516 */
+	"camkmjwevrgy", "canjm", "cannmbbh", "catoxoecoc",	/* 1520 */
+	"caubxs", "cavklyjq", "cawykengteg", "caxtdlyejcqv",	/* 1524 */
+	"caxw", "caygapafrr", "cazdkrjdqn", "cazkkj",	/* 1528 */
+	"cb", "cbamxnathi", "cbb", "cbbdpoyou",	/* 1532 */
+	"cbbkzim", "cbcimmzttw", "cbd", "cbdewm",	/* 1536 */
+	"cbftptpmuhn", "cbieankxc", "cbierpi", "cbixibqnpd",	/* 1540 */
+	"cbjuiqgtjog", "cbl", "cblz", "cbmtzepjerjvh",	/* 1544 */
+	"cbmytwarkkwl", "cbnelzygcoldst", "cbnosxgxw", "cbpcq",	/* 1548 */
+	"cbpiieerlgd", "cbsfe", "cbtvknedz", "cc",	/* 1552 */
+	"ccabzpecjo", "ccb", "cceribgnkviv", "ccfax",	/* 1556 */
+	"cch", "ccjrszvd", "cclovuy", "cclsoineiycz",	/* 1560 */
+	"ccovmtpevvbjj", "ccqdlscinmanx", "ccqsbogrc", "ccquzjilhevrcv",	/* 1564 */
+	"ccqzhvooynh", "cctyzbry", "ccub", "ccujdodcuaiop",	/* 1568 */
+	"ccwfincejrx", "ccwp", "cczbgqcmp", "cczhhuzz",	/* 1572 */
+	"ccztywjmspbpo", "cd", "cdaaozbyjekjs", "cdaxjhnrqenp",	/* 1576 */
+	"cdbxl", "cddmhdclba", "cdexkkeamtbt", "cdfox",	/* 1580 */
+	"cdfsqvtabed", "cdfwo", "cdh", "cdhd",	/* 1584 */
+	"cdmkac", "cdoeoi", "cdojdmfzeulgz", "cdp",	/* 1588 */
+	"cdppvbqa", "cdq", "cdqtbaml", "cdr",	/* 1592 */
+	"cdscfioaooygx", "cdtm", "cdw", "cdwcurjxggijo",	/* 1596 */
+	"cdynncwnidktih", "cdzjvlksya", "cdzoqsw", "ce",	/* 1600 */
+	"cebaf", "ceccn", "cecf", "cecqbtbienppi",	/* 1604 */
+	"cecqdabcftpc", "ceelvcgub", "ceenlhjpgahn", "cefaazsovudw",	/* 1608 */
+	"ceg", "cegcdnmos", "cehfhrdfqxo", "cejhh",	/* 1612 */
+	"celvlfzcftxzl", "celzb", "cemfhiynhid", "cenvmfqo",	/* 1616 */
+	"ceodmnsns", "ceouker", "ceowrcaec", "ceqd",	/* 1620 */
+	"ceqzyuo", "ceswfzxf", "cetbyqyoyanmst", "ceuk",	/* 1624 */
+	"ceurtbwesoydbg", "cexj", "cexwtsisteb", "ceynnunxopue",	/* 1628 */
+	"ceywjntkhauw", "cf", "cfa", "cfajkuriailsof",	/* 1632 */
+	"cfdejsewkkxn", "cfdnksgml", "cfdyktayxownky", "cffcwj",	/* 1636 */
+	"cffgpoqihiv", "cfftvqjpqge", "cffysas", "cfgcioz",	/* 1640 */
+	"cfhbmhxooock", "cfhqais", "cfijkimh", "cfkoyrfwp",	/* 1644 */
+	"cfkzd", "cflyyibnm", "cfomp", "cfornpqzqny",	/* 1648 */
+	"cfoy", "cfq", "cfqc", "cfs",	/* 1652 */
+	"cftndkrmfyid", "cftw", "cfuirjvrro", "cfuvqlokph",	/* 1656 */
+	"cfvkrxu", "cfvvusuimd", "cg", "cgaiyzhxody",	/* 1660 */
+	"cgbz", "cgcnsqogkrrh", "cgcqytpodl", "cgea",	/* 1664 */
+	"cgeddigcpksc", "cgedllcpd", "cgfi", "cgfkg",	/* 1668 */
+	"cgfnxhbje", "cgfsymxacuyg", "cgftloyznyswv", "cgg",	/* 1672 */
+	"cgghapkhsen", "cggnwkqmvawo", "cghphvawshuarz", "cgjgfsifews",	/* 1676 */
+	"cgkg", "cgksengsholrb", "cgmwmdcixid", "cgnhlyumpvq",	/* 1680 */
+	"cgqwzhfg", "cgrpfki", "cgrvhjoywhtnag", "cgtjgjwrhcbizp",	/* 1684 */
+	"cgu", "cgvqivimmeojpu", "cgvsbaoy", "cgwmynwsjqvob",	/* 1688 */
+	"cgwnqhbhiuvxt", "cgxkwbzhvr", "cgxzpczxv", "cgzm",	/* 1692 */
+	"ch", "charedl", "chaywb", "chcibnvimwpmcu",	/* 1696 */
+	"chd", "chdguetdosbnq", "cheoen", "cheoghgdpfhmj",	/* 1700 */
+	"chfcu", "chfd", "chgdhgxigzwlq", "chgegmucbbunzy",	/* 1704 */
+	"chhchulukdhh", "chhstplthwjrcc", "chigwborxrb", "chkbvfan",	/* 1708 */
+	"chkiwfnc", "chkmtvvklwv", "chlagxzh", "chnmpftnonhoyq",	/* 1712 */
+	"chphurkvqadbhp", "chpndyhkg", "chrho", "chshuotvvzpv",	/* 1716 */
+	"chsysm", "chutzpoecxlthz", "chuuf", "chvptwvnrnsjng",	/* 1720 */
+	"chvvtn", "chvxavqarck", "chws", "chyffwwvhrci",	/* 1724 */
+	"chypbwg", "chzds", "ci", "cicaelqcq",	/* 1728 */
+	"cicyocu", "cidgmeyzbz", "cidiyswwac", "ciemueazx",	/* 1732 */
+	"ciex", "cigyr", "cih", "cihf",	/* 1736 */
+	"cikbbauwifb", "cikzouqsvfs", "cilhdvuxli", "cilhlideic",	/* 1740 */
+	"ciljxeh", "cilkoo", "cimmhft", "cimnkr",	/* 1744 */
+	"cimptznygkxfh", "cimvrqylou", "cingaxrymqpcm", "cinhht",	/* 1748 */
+	"cioksxf", "cipvypgyhoy", "cipxmob", "ciqumjm",	/* 1752 */
+	"cirskala", "cisvoizgfpblk", "cisxtwbl", "cityzo",	/* 1756 */
+	"civqfanzfqv", "ciwxhvhz", "cizespaj", "cizimjhnftbbxe",	/* 1760 */
+	"cj", "cjarwvhjj", "cjawvjpdfcozh", "cjbmbxi",	/* 1764 */
+	"cjbrjtruyszr", "cjeuwnhlelr", "cjfpxnutwwv", "cjhjzicth",	/* 1768 */
+	"cjiipzrkjonc", "cjjoi", "cjjshlwhe", "cjkcpcfkpt",	/* 1772 */
+	"cjlamqcnix", "cjlcin", "cjmjkvhsjh", "cjmrnozxxkguz",	/* 1776 */
+	"cjn", "cjon", "cjpqo", "cjptb",	/* 1780 */
+	"cjqouezuicsop", "cjqp", "cjqqnuviz", "cjrcwjoittnyg",	/* 1784 */
+	"cjrtgsoelgs", "cjryigrq", "cjt", "cjtblybcc",	/* 1788 */
+	"cjvag", "cjvu", "cjwdqvu", "cjwolocpo",	/* 1792 */
+	"cjxzbuvxtdn", "cjzfeiggm", "ckbobtfejpbsqc", "ckcjkphu",	/* 1796 */
+	"ckdaz", "ckehlhihqmsba", "ckeyazoj", "ckg",	/* 1800 */
+	"ckgihagn", "ckiupkpuckck", "ckj", "ckk",	/* 1804 */
+	"ckklxmafrpg", "cklroc", "ckndwpusb", "ckoz",	/* 1808 */
+	"ckqhpj", "ckugzfootcvxqj", "ckuivtsqqwxx", "ckv",	/* 1812 */
+	"ckvaoz", "ckvuzdxiuon", "ckxhxadvok", "ckyl",	/* 1816 */
+	"ckyxjdocflzv", "cl", "clalwdr", "clateohmqhjb",	/* 1820 */
+	"clcoxi", "clcvwppwvsngqk", "clgudcnjhm", "clibumypfgctik",	/* 1824 */
+	"cljjpjm", "clkpbtywcmhfc", "clnvwwnx", "clrfazzubs",	/* 1828 */
+	"cluyhvieiqlhg", "clwziheiq", "clx", "clxkkfwf",	/* 1832 */
+	"cly", "clywav", "clzyyt", "cm",	/* 1836 */
+	"cmagkzhqmdo", "cmbkjwncl", "cmc", "cmcbkcynwodt",	/* 1840 */
+	"cmcvjg", "cmdbbymka", "cmdnvr", "cmeshjit",	/* 1844 */
+	"cmica", "cmijnj", "cmjmzjziuzbaoy", "cmkqkz",	/* 1848 */
+	"cmlwih", "cmoiatqsn", "cmpzu", "cmrolcenjnapcs",	/* 1852 */
+	"cmrpbbzkr", "cmrtg", "cmt", "cmtdq",	/* 1856 */
+	"cmu", "cmxwiqzf", "cmxxbmb", "cmzewvsnm",	/* 1860 */
+	"cn", "cnafbr", "cnatk", "cnauza",	/* 1864 */
+	"cnbgwomtw", "cnbhqye", "cnbstexpdjjln", "cnbupxuxcozt",	/* 1868 */
+	"cnbztexpjt", "cnctzgcs", "cneswavlu", "cnfcd",	/* 1872 */
+	"cnfjnxqm", "cnfkoxin", "cnfksvyk", "cngmaxnnt",	/* 1876 */
+	"cnh", "cnhljesiur", "cnhwvsoreo", "cnikpetbfoma",	/* 1880 */
+	"cnixauu", "cnixi", "cnl", "cnlmnxvrshb",	/* 1884 */
+	"cnn", "cnocfa", "cnoxfcjqmgcgok", "cnpju",	/* 1888 */
+	"cnrydzwq", "cnsuhe", "cnsv", "cnt",	/* 1892 */
+	"cntoheaayqjfss", "cnumjam", "cnunupfd", "cnuzqmvxcxgkcc",	/* 1896 */
+	"cnvy", "cnynwikzuyp", "cnzhgqhgtmff", "cnzm",	/* 1900 */
+	"cnzofittmhspyh", "cnzvkenfwiezsa", "cnzvnkqrnyb", "co",	/* 1904 */
+	"cobhdheaztfu", "cobwot", "coenqgzbrxfk", "coesqouc",	/* 1908 */
+	"cof", "cogevgnhidm", "cogfteofenz", "cohmznmfkoetp",	/* 1912 */
+	"coihot", "collwds", "colrwxxh", "com",	/* 1916 */
+	"congccvuikm", "cooanvkk", "copqfployowscu", "coqm",	/* 1920 */
+	"coraxsh", "cosjtcomi", "cosncqtdot", "cotmfxfenxjh",	/* 1924 */
+	"covks", "covohqyhjwc", "coygze", "cp",	/* 1928 */
+	"cpb", "cpbl", "cpbwlm", "cpcwicbdrdyty",	/* 1932 */
+	"cpdpmqzv", "cpdtmpynkj", "cper", "cpfmcvdaqtpr",	/* 1936 */
+	"cpfofh", "cpfvepozouix", "cpifdqcalblfta", "cpigr",	/* 1940 */
+	"cpiwushw", "cpjjupmlrjh", "cpkdbdnsox", "cpkngufmleq",	/* 1944 */
+	"cpksdkdydr", "cplnbwvys", "cpou", "cppbcjmxkmtin",	/* 1948 */
+	"cpphyeqxxmvijq", "cppx", "cprfbolfhzye", "cprtmdklzhpvn",	/* 1952 */
+	"cprtqder", "cpsz", "cptixrudws", "cptqf",	/* 1956 */
+	"cpu", "cpucrokqzra", "cpvyoxzpdfr", "cpwvd",	/* 1960 */
+	"cpzju", "cq", "cqcdshjfe", "cqct",	/* 1964 */
+	"cqdednignw", "cqdhnihim", "cqfedrnac", "cqgdfhfgtz",	/* 1968 */
+	"cqgfnnrk", "cqhv", "cqihipoqucgfav", "cqkkzluqicr",	/* 1972 */
+	"cqkp", "cqlfqtv", "cqlplkvjugdbo", "cqmnul",	/* 1976 */
+	"cqn", "cqnfgaxy", "cqnvjmdbzzx", "cqpbczkgq",	/* 1980 */
+	"cqpyvskekqwsb", "cqqfdgsee", "cqqshdpjkxlahh", "cqqzqnfys",	/* 1984 */
+	"cqrigmarili", "cqrsbss", "cqrxfxmycjov", "cqs",	/* 1988 */
+	"cqtersab", "cqts", "cqv", "cqvffye",	/* 1992 */
+	"cqvile", "cqvoqvr", "cqvpiypzgf", "cqxtet",	/* 1996 */
+	"cr", "craxjvtb", "craygznhssjhru", "crc",	/* 2000 */
+	"crce", "crfqnpvg", "crfrn", "crgqdsrh",	/* 2004 */
+	"crgwcpbuz", "crhokokxdmbx", "crhuxq", "crkvae",	/* 2008 */
+	"crmz", "crnzcjqz", "crp", "crpvdgg",	/* 2012 */
+	"crqeztr", "crqghvw", "crqs", "crroc",	/* 2016 */
+	"crsdn", "crurlhfsyhnk", "crwfyhmfsnhu", "crwlaukxwgfzql",	/* 2020 */
+	"crx", "crxf", "crxxwuwpad", "crymv",	/* 2024 */
+	"cryoce", "crz", "crzbkgvcpbk", "crznlgdj",	/* 2028 */
+	"cs", "csbrlyo", "csegnvru", "csel",	/* 2032 */
+	"csevvapey", "csguy", "cshdnqjaq", "cshjuiiqxycgcb",	/* 2036 */
+	"cslgslcmwms", "csmyyypfvu", "csnlbwc", "csnrqfqi",	/* 2040 */
+	"cso", "csoz", "csqumtffsk", "csrzsb",	/* 2044 */
+	"csuid", "csuvyu", "csw", "cswqwqiar",	/* 2048 */
+	"cswyvjsvplgpqx", "csx", "csxmuzhhpivxhz", "ct",	/* 2052 */
+	"ctacrlaa", "ctadcvlkmhoqbr", "ctaqvzayvzeofb", "ctawhe",	/* 2056 */
+	"ctawpozub", "ctb", "ctcnhavvolv", "ctdlufqox",	/* 2060 */
+	"ctdyaoo", "ctfekhaxnxxgqn", "ctfquo", "ctgchb",	/* 2064 */
+	"ctiacpyjpjfpjf", "ctiba", "ctihtdeku", "ctkijiddcagup",	/* 2068 */
+	"ctkmg", "ctkynoiizeaib", "ctliwbqdbqekr", "ctlv",	/* 2072 */
+	"ctovu", "ctpqksvbg", "ctqivjwxudyhed", "ctqjg",	/* 2076 */
+	"ctqmfghocglqno", "ctstmimpxbzu", "ctsxq", "ctt",	/* 2080 */
+	"ctte", "cttgjmken", "cttgurhilcxjcs", "ctwboftrnovhhj",	/* 2084 */
+	"ctwdwnckcsxgru", "ctx", "ctyrcai", "cu",	/* 2088 */
+	"cuabqjmjtc", "cuafcu", "cuavdrmqakwtw", "cuay",	/* 2092 */
+	"cubaa", "cubfmbrq", "cucez", "cudsy",	/* 2096 */
+	"cufais", "cufpdqbrn", "cufwv", "cugpnayemjzoui",	/* 2100 */
+	"cuhmivia", "cuhnqgvjpwbm", "cuikfvaziwlhwd", "cuixdpcnlbgx",	/* 2104 */
+	"cujpbjufwtpf", "cukqebmuphpcvt", "cum", "cumfsibkh",	/* 2108 */
+	"cumwcolhnkc", "cuopxmlnagf", "cupaornnq", "curkne",	/* 2112 */
+	"cuschcnq", "cuuw", "cuvmxmi", "cux",	/* 2116 */
+	"cuxa", "cuy", "cuz", "cuzkttwcjnvir",	/* 2120 */
+	"cv", "cvacrjwxyd", "cvdqlurb", "cvdto",	/* 2124 */
+	"cveby", "cvemgivupv", "cvfjx", "cvfrpzykygrxv",	/* 2128 */
+	"cvgy", "cvhaxwnppww", "cvhmfjewwbny", "cvknts",	/* 2132 */
+	"cvlrccogtwdoq", "cvmlaqtlg", "cvmps", "cvoafqw",	/* 2136 */
+	"cvpc", "cvqskzqesgih", "cvr", "cvrxcjnlwryjq",	/* 2140 */
+	"cvs", "cvsrzjdmwebnh", "cvttegpijsutbq", "cvvgmdjkrdaerl",	/* 2144 */
+	"cvvif", "cvviwn", "cvvlsjpjog", "cvxwcebg",	/* 2148 */
+	"cvyqytayfd", "cw", "cwbeemkkzp", "cwbrhihz",	/* 2152 */
+	"cwdjqqxoiy", "cwdkkhe", "cwenslodjjai", "cwfbdhzpu",	/* 2156 */
+	"cwfs", "cwgqgpydlzzyf", "cwhtfukfxf", "cwjadkghi",	/* 2160 */
+	"cwjbdfj", "cwkzdskzfskqk", "cwlagdxjri", "cwlplwxato",	/* 2164 */
+	"cwlrmgxzd", "cwls", "cwm", "cwmslj",	/* 2168 */
+	"cwnivgrwaxeg", "cwof", "cwope", "cwrsxzq",	/* 2172 */
+	"cwsctwfgdigqak", "cwsers", "cwssj", "cwwmo",	/* 2176 */
+	"cwymbawgl", "cwzawx", "cwziilas", "cx",	/* 2180 */
+	"cxba", "cxcxeybafmmlz", "cxeeo", "cxehxsbrlabu",	/* 2184 */
+	"cxflkogcs", "cxg", "cxge", "cxh",	/* 2188 */
+	"cxhevdl", "cxk", "cxkggfjgqkmjmv", "cxlbouscf",	/* 2192 */
+	"cxlfrev", "cxlg", "cxmp", "cxmpxqgz",	/* 2196 */
+	"cxoh", "cxokjkfeg", "cxoqf", "cxpgjyvo",	/* 2200 */
+	"cxqioqct", "cxqmmggtebue", "cxsnrui", "cxtdujukjrx",	/* 2204 */
+	"cxtecqij", "cxtqdqnbcocafy", "cxvkazkt", "cxwyg",	/* 2208 */
+	"cxy", "cxyjyhyx", "cxzdgxxeham", "cxznioncmwpx",	/* 2212 */
+	"cy", "cybabr", "cyboygbo", "cybsko",	/* 2216 */
+	"cydstbwzmisowu", "cyet", "cyfkr", "cygbidpq",	/* 2220 */
+	"cyhdjf", "cyhfa", "cyhymd", "cyjtcqap",	/* 2224 */
+	"cyktttaixf", "cyluzkjxlhlnyb", "cyookvjkvyqaq", "cyorvktohfq",	/* 2228 */
+	"cyovrlm", "cyp", "cyr", "cyroaqbxp",	/* 2232 */
+	"cyrviqqfigd", "cys", "cysnzwigsxdh", "cytbcgsxrjchyv",	/* 2236 */
+	"cytpkc", "cyvqhygppmyw", "cyxomsnlisver", "cyxpfhbvepfi",	/* 2240 */
+	"cyybfr", "cyyslc", "cyzqnsqv", "cyzyutkujjvv",	/* 2244 */
+	"cz", "czcbu", "czccdnvm", "czdcnqdzl",	/* 2248 */
+	"czdnvn", "czdpqauksnl", "czeddsakobekt", "czevimjehltm",	/* 2252 */
+	"czg", "czgbhubjz", "czgmqrvgocwvou", "czjhiywymcuax",	/* 2256 */
+	"czkjrrs", "czkknlmggnfcfv", "cznq", "cznv",	/* 2260 */
+	"czq", "czqr", "czw", "czxu",	/* 2264 */
+	"czz", "czzfnaka", "da", "daalqf",	/* 2268 */
+	"dabzkrqxsqwa", "dadsbagl", "daeba", "dafdbvaxtfn",	/* 2272 */
+	"dafpwdxqiyoxu", "dafxbi", "dahktuab", "dahs",	/* 2276 */
+	"dai", "dakagvyuwy", "damfx", "dammzrazzhb",	/* 2280 */
+	"danyksvhrqhgoo", "daodk", "dapoim", "daqgoiuhxk",	/* 2284 */
+	"darwwvepgq", "dat", "daua", "dauqa",	/* 2288 */
+	"dautvqxa", "davvoom", "daxam", "daxuxu",	/* 2292 */
+	"daydchbwtmcdn", "daydhhenkplyeu", "daygsmgegybbco", "dayxvlwib",	/* 2296 */
+	"db", "dbacgbgv", "dbaebgewz", "dbaq",	/* 2300 */
+	"dbbe", "dbcfsifpfaon", "dbchucxuj", "dbedyjzb",	/* 2304 */
+	"dbhpnyonkq", "dbineldbzmzt", "dbj", "dbnpxwxabp",	/* 2308 */
+	"dbnuornr", "dbnybkrbdm", "dbodviodv", "dboxsb",	/* 2312 */
+	"dbpcjblag", "dbplf", "dbpsjrydev", "dbrhjcutjeoqfy",	/* 2316 */
+	"dbup", "dbvtbysld", "dbwgvdfhfnbhsv", "dbwqeeywrlf",	/* 2320 */
+	"dbwsnpfgsozvdv", "dbxdmhoxdubn", "dbybrh", "dbz",	/* 2324 */
+	"dbzcmxceae", "dc", "dcb", "dcbl",	/* 2328 */
+	"dce", "dcghm", "dcgmdtmnfn", "dcgstwldd",	/* 2332 */
+	"dchkyzflgshn", "dcidg", "dcmfym", "dcmjoqlpf",	/* 2336 */
+	"dcnfugnxf", "dcoi", "dcpdqaacxyxcj", "dcpfzaktzlubsj",	/* 2340 */
+	"dcqxyumfyeeu", "dcr", "dcrvxg", "dcsqfqbof",	/* 2344 */
+	"dcsstcydfhl", "dcuhaorcgudfu", "dcvllusglmnr", "dcvrakab",	/* 2348 */
+	"dcxcohmalwd", "dcxgzn", "dcy", "dcybb",	/* 2352 */
+	"dcydawlist", "dcyzxom", "dd", "ddaahiv",	/* 2356 */
+	"ddcpcxxlfag", "ddcpv", "dddikl", "dddtygrhbyyaca",	/* 2360 */
+	"dddzrxmag", "ddek", "ddfsxofjpdey", "ddfxpmy",	/* 2364 */
+	"ddgluzs", "ddhkutytxpnai", "ddiixeh", "ddiqmpr",	/* 2368 */
+	"dditqva", "ddlf", "ddlvcs", "ddmew",	/* 2372 */
+	"ddn", "ddpfghoaecv", "ddrs", "ddvip",	/* 2376 */
+	"ddvwe", "ddwd", "ddxgvyym", "ddxrtco",	/* 2380 */
+	"ddxsi", "ddxvndxe", "ddybuodmabs", "ddyjntriiked",	/* 2384 */
+	"ddyqufzatteiow", "ddyze", "ddzgyqp", "ddzkepuq",	/* 2388 */
+	"ddzwdfci", "de", "dea", "deb",	/* 2392 */
+	"debajs", "decqijnjxcygix", "dectwsodwcn", "deebuqixz",	/* 2396 */
+	"deegvb", "degrjxsmzgfclo", "degrxraewocaal", "degyydul",	/* 2400 */
+	"dekrztgxeoqidi", "dekuzsor", "delh", "delsc",	/* 2404 */
+	"den", "denl", "deoeatiqqtkqjw", "deqcesnclyu",	/* 2408 */
+	"derrdh", "desdlktpne", "desj", "detkaafiksfb",	/* 2412 */
+	"deul", "deuppy", "devok", "devtrytlednax",	/* 2416 */
+	"dexnjd", "deyaezbhdprqj", "deyfofa", "df",	/* 2420 */
+	"dfaddhwkdaasp", "dfaegxgvi", "dfaplztbogzd", "dfblxgyv",	/* 2424 */
+	"dfcvsjmys", "dfd", "dfdkemfqddqtf", "dfdlhjkxdlgseb",	/* 2428 */
+	"dffzmwybyhf", "dfimqmsm", "dfiy", "dfj",	/* 2432 */
+	"dfjkgqxw", "dfjxnqyecqpqc", "dfofmhennjmq", "dfplwututnm",	/* 2436 */
+	"dfqazqyjrugq", "dfqdpybexfk", "dfqxroxz", "dfsxbz",	/* 2440 */
+	"dfuaikwpzos", "dfulvndftjr", "dfuxjdxkxwqn", "dfvqujk",	/* 2444 */
+	"dfwnf", "dfyglqamhyhnr", "dg", "dgaguettvvao",	/* 2448 */
+	"dgc", "dgcbazapkms", "dgdaxxmnisjsu", "dgdg",	/* 2452 */
+	"dgdmfiivivdphg", "dgdwusc", "dgebmivntf", "dgesprsgttlem",	/* 2456 */
+	"dgfobbpeq", "dgfrs", "dgfsl", "dggcvrwiln",	/* 2460 */
+	"dghnetrywrli", "dgicusqucczgu", "dgiwvhikxaegom", "dgjdul",	/* 2464 */
+	"dgjhpa", "dgkbplu", "dgm", "dgoay",	/* 2468 */
+	"dgotz", "dgq", "dgqcowzrrv", "dgrad",	/* 2472 */
+	"dgryjpknhv", "dgsnlhy", "dgsvnsg", "dgtkphbbrool",	/* 2476 */
+	"dguwb", "dgvyzokgtwrw", "dgwwc", "dgwzsqf",	/* 2480 */
+	"dgy", "dgymk", "dh", "dha",	/* 2484 */
+	"dhafgix", "dhbpshkcs", "dheeqx", "dhegzezntgno",	/* 2488 */
+	"dhhpxqlmmv", "dhibo", "dhjenqw", "dhldfjum",	/* 2492 */
+	"dhmwsgtq", "dhoylukozp", "dhqhpmgowre", "dhrlmf",	/* 2496 */
+	"dhsvopnucakxf", "dhsyqspk", "dhtnkkdcxtfn", "dhuvc",	/* 2500 */
+	"dhwpm", "dhwqgul", "dhxbjvhocvxc", "dhyfjprnohnw",	/* 2504 */
+	"dhzyzuir", "di", "diauqcfylaj", "diazq",	/* 2508 */
+	"diek", "diemgvklt", "dieoazorppo", "diflwceqd",	/* 2512 */
+	"diglctgsewdof", "digskbcftuk", "dihci", "dihs",	/* 2516 */
+	"diijpfegi", "dijsktjahafd", "dikg", "dilhixbuxkgy",	/* 2520 */
+	"dinlpmu", "dinozrmzj", "diothn", "diqohly",	/* 2524 */
+	"dirxjumtkhk", "dis", "disjepxlhhax", "dita",	/* 2528 */
+	"ditr", "divhfyvldodkq", "diyfkulhqdap", "diynpkltl",	/* 2532 */
+	"dizcpu", "dj", "djb", "djbv",	/* 2536 */
+	"djbyy", "djc", "djcmeq", "djctds",	/* 2540 */
+	"djebeusawunw", "djfixutqiloz", "djfolnlq", "djgusarfpjoa",	/* 2544 */
+	"djgxyolhzskkh", "djhadrhxwhh", "djhcoqtwuhr", "djiqsaicbcxen",	/* 2548 */
+	"djjvjcpu", "djkslibdpmjs", "djkuyk", "djlhcvriyqt",	/* 2552 */
+	"djmqtroqtccjw", "djms", "djn", "djnqfcxson",	/* 2556 */
+	"djnwgfq", "djpxhkxwmr", "djqe", "djqfbyiheg",	/* 2560 */
+	"djrcfywyqeuryu", "djrwjlchidysc", "djshwvsarcj", "djuvanurfr",	/* 2564 */
+	"djvdpnpmuh", "djygvhlvqmhea", "djyxs", "djyyegdh",	/* 2568 */
+	"dk", "dkberbo", "dke", "dkewmcdsjh",	/* 2572 */
+	"dkhapivi", "dkhn", "dkhvuq", "dkizqhvbidcxim",	/* 2576 */
+	"dkkm", "dklhkk", "dknsotlgkkkrdv", "dknzvzzysm",	/* 2580 */
+	"dkoab", "dkoby", "dkqfafegxhkgf", "dkrdmlpqflw",	/* 2584 */
+	"dksamzymjthkp", "dksfwlxp", "dksr", "dksttykfmuc",	/* 2588 */
+	"dkt", "dkujyjrmlf", "dkvelmpyba", "dkvm",	/* 2592 */
+	"dkwpusmkrg", "dkxarlnuwwt", "dkxkuuigmsbd", "dkyf",	/* 2596 */
+	"dkyglmxzkav", "dkyiogxvym", "dkymdgessx", "dl",	/* 2600 */
+	"dlarpsmf", "dlavlgdorhm", "dlbfqelphm", "dlbnqllfg",	/* 2604 */
+	"dlbnuc", "dlcme", "dlcy", "dlgkrfcsj",	/* 2608 */
+	"dlia", "dlj", "dljmscrt", "dljyu",	/* 2612 */
+	"dlkbkanfdmew", "dlmvvmvom", "dlmwpqkzfo", "dlpywl",	/* 2616 */
+	"dlq", "dlrtrsof", "dls", "dlswtuhkvog",	/* 2620 */
+	"dltrkrd", "dltsfu", "dltzswxdtd", "dlvbxk",	/* 2624 */
+	"dlwkqqsxtyvyif", "dlwxkqojrtt", "dlyi", "dlyiehllfxyddx",	/* 2628 */
+	"dlzcs", "dlzhrdbp", "dm", "dmanibuqk",	/* 2632 */
+	"dmbr", "dmewiec", "dmgl", "dmguqpgx",	/* 2636 */
+	"dmidg", "dmldy", "dmlud", "dmmhpwpkc",	/* 2640 */
+	"dmmqfespg", "dmmtrwzuhvsbgf", "dmnehlgojsetru", "dmngxfbcxnb",	/* 2644 */
+	"dmokwfl", "dmpzj", "dmqya", "dmrlvrpyrhcx",	/* 2648 */
+	"dmunnizly", "dmvetq", "dmzquzfvvminxq", "dmzsfhxiunnsu",	/* 2652 */
+	"dn", "dnbdfwgr", "dncgduahpcgkg", "dncvbfdqvcg",	/* 2656 */
+	"dndfatysflbvew", "dndnibekhiavew", "dnejzl", "dnfsqfjjprbcaw",	/* 2660 */
+	"dnknae", "dnkrvf", "dnl", "dnmxdsaayrtn",	/* 2664 */
+	"dnntyv", "dnqpchlxxdz", "dnqxqqy", "dnrc",	/* 2668 */
+	"dnrkcsjbyjev", "dntkfwkheolqwo", "dntrn", "dntwheixh",	/* 2672 */
+	"dnwqoyagjfz", "dnwyakulbd", "dnxnizid", "dnyek",	/* 2676 */
+	"dnylmzgbcejih", "dnzypc", "doa", "doblxkive",	/* 2680 */
+	"dobnmrna", "dodpvpscfe", "dodxvbgzca", "doemmgkkhpom",	/* 2684 */
+	"doeuxzke", "dog", "dohrv", "doibr",	/* 2688 */
+	"dojlqg", "dojsu", "dojzcthsgkjan", "doktuzptkd",	/* 2692 */
+	"dolo", "dophq", "doq", "dordymhp",	/* 2696 */
+	"dowo", "dowqgsncoevo", "doyj", "doyovw",	/* 2700 */
+	"dp", "dpcxjsrfjcy", "dpdhgfhcaddww", "dpgankvkmyklza",	/* 2704 */
+	"dphwhhridll", "dpidbby", "dpifqouie", "dpjssmbeif",	/* 2708 */
+	"dpjxkwa", "dplqcxfbfdurk", "dpluousdkim", "dpmhhwkse",	/* 2712 */
+	"dpnmqvsduisfc", "dpnwcbq", "dpo", "dpoebix",	/* 2716 */
+	"dpptzljwpykx", "dpqkllwaz", "dpqwlgn", "dpsh",	/* 2720 */
+	"dpstnzcnwhng", "dptlkfufyxbvm", "dpvpoyezgeleej", "dpvxztap",	/* 2724 */
+	"dpwxxzmso", "dpx", "dpxat", "dpxioppvadygq",	/* 2728 */
+	"dpxv", "dpyj", "dpyopu", "dq",	/* 2732 */
+	"dqachzzvctt", "dqaly", "dqas", "dqbxakrci",	/* 2736 */
+	"dqctc", "dqctkrvrlxht", "dqegwefbvca", "dqgmrscmzzw",	/* 2740 */
+	"dqgxhkd", "dqjoqgz", "dqkebliu", "dqkglqzhyimvg",	/* 2744 */
+	"dqkn", "dqldnzglvqv", "dqmaegub", "dqmkemgdcocss",	/* 2748 */
+	"dqmmnuf", "dqnd", "dqpf", "dqphpcyfjsv",	/* 2752 */
+	"dqqffl", "dqqpd", "dqqxc", "dqtloijmqvkd",	/* 2756 */
+	"dqtxishdjeywtn", "dqtxmxctclbfcj", "dqux", "dqwbnifhabcuk",	/* 2760 */
+	"dqwilegsobvjip", "dqwofwfumsfbo", "dqxfqy", "dqxuenxq",	/* 2764 */
+	"dqymj", "dr", "draholqktw", "drccyarxv",	/* 2768 */
+	"dreagxlhhaauge", "drgzas", "drkgmhszjei", "drkiquqkbrghv",	/* 2772 */
+	"drkxs", "drlizdpdqndqp", "drlqd", "drlxa",	/* 2776 */
+	"drmmtfgtpbte", "drn", "drnbtg", "drnsmfblsqbdr",	/* 2780 */
+	"drqjycqchygtyg", "drqmylwj", "drqollsbustn", "drr",	/* 2784 */
+	"drup", "drvaggoxwxew", "drw", "drwxfwkkcjqvdi",	/* 2788 */
+	"drycwkffcgix", "ds", "dsahjmt", "dsbgxa",	/* 2792 */
+	"dsbkwfasofcxdu", "dsdbclgvtptf", "dsgp", "dshnozwezg",	/* 2796 */
+	"dshyuswe", "dsi", "dsj", "dsjnhh",	/* 2800 */
+	"dsjxazfpt", "dsk", "dslec", "dsnkbqadrknhwg",	/* 2804 */
+	"dsnqkcgrv", "dsp", "dspbdj", "dsqyolmyogsy",	/* 2808 */
+	"dsrhsbgv", "dsrl", "dss", "dst",	/* 2812 */
+	"dsvifw", "dswtyqzwkndo", "dsy", "dsycsp",	/* 2816 */
+	"dsziqpidtyakir", "dszqt", "dt", "dtalpunmkvl",	/* 2820 */
+	"dtarpuo", "dtbfakkqrxtb", "dtdizmgvo", "dtedyoulyli",	/* 2824 */
+	"dtfbelbwls", "dtfsy", "dtguxrnibxge", "dtkfcwi",	/* 2828 */
+	"dtmplozxgsnmg", "dtn", "dto", "dtosukeonpfp",	/* 2832 */
+	"dtpuyyvx", "dtrkx", "dtrugasialuck", "dtrypocpgim",	/* 2836 */
+	"dtszmcs", "dtuvaexlbch", "dtwokhuk", "dtwq",	/* 2840 */
+	"dtyngztw", "dtyxy", "dtzkdiceafaw", "du",	/* 2844 */
+	"duapcoaucad", "duec", "duhaeoja", "duieogek",	/* 2848 */
+	"dujya", "duktlxme", "dulbvwvvjdtfg", "dumbzxcqtup",	/* 2852 */
+	"dunfcmna", "dunvtegoc", "dupfawwhudtq", "duqkfwq",	/* 2856 */
+	"duqzpk", "duroyburah", "dusehgvz", "dusldo",	/* 2860 */
+	"dusplpm", "dutgvikbquahcd", "dutlbheg", "dutmbkcty",	/* 2864 */
+	"duttpgtigdvi", "duvyhzcbpbuijk", "duxerbuu", "duxfzaocdjbf",	/* 2868 */
+	"duy", "duzvbwsmpcedph", "dv", "dvai",	/* 2872 */
+	"dvaiehorhwcjf", "dvbtgeebtstty", "dvczratuf", "dvdvlzgk",	/* 2876 */
+	"dvhsg", "dvikl", "dviw", "dvjeiun",	/* 2880 */
+	"dvjsn", "dvkhhylrbomb", "dvkk", "dvklqa",	/* 2884 */
+	"dvkodfxsacgik", "dvlzfekybkk", "dvmjqpakt", "dvoabhnzr",	/* 2888 */
+	"dvoctxinezgil", "dvpxox", "dvq", "dvqex",	/* 2892 */
+	"dvqng", "dvqxfvvb", "dvrjzc", "dvrnkeazqs",	/* 2896 */
+	"dvrqcanafayeo", "dvs", "dvtacgqvvlby", "dvtevhwjnn",	/* 2900 */
+	"dvugzpassnxltm", "dvui", "dvv", "dvyunivud",	/* 2904 */
+	"dvzlg", "dw", "dwaccshslp", "dwbatksp",	/* 2908 */
+	"dwbd", "dwbdwbxbtpvord", "dwbpg", "dwbqfdfwuo",	/* 2912 */
+	"dwd", "dwdgkdiowumrga", "dwdmf", "dwedqrqi",	/* 2916 */
+	"dwemvj", "dweovqdswlbq", "dwfxxzdy", "dwhok",	/* 2920 */
+	"dwhp", "dwime", "dwiwm", "dwizjzcljvlk",	/* 2924 */
+	"dwj", "dwjqroorpvori", "dwjyhxujqzuokc", "dwlj",	/* 2928 */
+	"dwlkuigqrdg", "dwlnihkaxvop", "dwlo", "dwluhmwnzqtn",	/* 2932 */
+	"dwmctgx", "dwmohcxx", "dwnksmp", "dwoobub",	/* 2936 */
+	"dwqsyiicihyohe", "dwsj", "dwskrbhhyzjin", "dwtftsycvmjcd",	/* 2940 */
+	"dwti", "dwuohdqkppso", "dwxqfsbcqo", "dwzt",	/* 2944 */
+	"dx", "dxbwl", "dxcto", "dxdcchrjeiznf",	/* 2948 */
+	"dxdxgzh", "dxercd", "dxewsrjnf", "dxf",	/* 2952 */
+	"dxfbckln", "dxfpyksbcivy", "dxgj", "dxgwddapi",	/* 2956 */
+	"dxhxpvu", "dxirldjcce", "dxjebyyeueyo", "dxkxznrm",	/* 2960 */
+	"dxlfhh", "dxnonbwkyr", "dxnspx", "dxobencpq",	/* 2964 */
+	"dxpjush", "dxpywlidk", "dxqpccqafnqew", "dxrat",	/* 2968 */
+	"dxrovhedbi", "dxsxwywtvpksc", "dxtesdle", "dxtyehcnsps",	/* 2972 */
+	"dxuodmrv", "dxw", "dxwbvpw", "dxxptk",	/* 2976 */
+	"dxyp", "dy", "dyabokviehr", "dycsfhwunnthx",	/* 2980 */
+	"dycv", "dyedvkaya", "dyfakhrxju", "dyiphjrg",	/* 2984 */
+	"dylbegy", "dylwdfuiefwiqc", "dymhwdmat", "dymrlfsiygjhry",	/* 2988 */
+	"dynomd", "dyoqhjvl", "dypyvkjbbi", "dyqmaqjivoac",	/* 2992 */
+	"dyty", "dywwo", "dyygttlfnojth", "dyyypg",	/* 2996 */
+	"dyzomlapyuatx", "dz", "dzbjat", "dzckphjotzswz",	/* 3000 */
+	"dzdcdoicrjdci", "dzeqviqjo", "dzerbweobtdn", "dzevlrgrcrug",	/* 3004 */
+	"dzgchqyu", "dzhfgevznor", "dzhz", "dzijaelmg",	/* 3008 */
+	"dzkeof", "dzmazgmzkloqhz", "dzoeeamfed", "dzogfrbdb",	/* 3012 */
+	"dzqrmsttold", "dzqyhni", "dztmgefxxle", "dzuzqaw",	/* 3016 */
+	"dzvoxnsok", "dzvw", "dzwc", "dzwkeci",	/* 3020 */
+	"dzwpmrtjhzii", "dzwybvx", "dzyipujsq", "dzztilwijlympk",	/* 3024 */
+	"eaa", "eaaafeam", "eaccfz", "eacodsvf",	/* 3028 */
+	"eadgzshhapwfb", "eadorv", "eadzqhivjgx", "eaedlprp",	/* 3032 */
+	"eaedphr", "eafdcox", "eafilesz", "eafingashuekl",	/* 3036 */
+	"eahakkk", "eaiqjezgcl", "eajktolgty", "eajriebnxt",	/* 3040 */
+	"eam", "eammxkdo", "eamygiblf", "eaon",	/* 3044 */
+	"eareq", "earffcuaoe", "earrvoucf", "earukkzzrrce",	/* 3048 */
+	"easdgxqma", "eatjblybgrc", "eauieizl", "eawbtgjfih",	/* 3052 */
+	"eawppvwcghdt", "eaxrwvmwm", "eayvqla", "eazj",	/* 3056 */
+	"eazmfbhfxtki", "eb", "eba", "ebaifjhekqd",	/* 3060 */
+	"ebcmyosvkkklay", "ebcxoegrf", "ebdwntfkcacc", "ebeuyxzdzenkws",	/* 3064 */
+	"ebfieuvtsoxfxh", "ebgfjuj", "ebggpsperj", "ebi",	/* 3068 */
+	"ebicuc", "ebijntcldj", "ebjfv", "eblgfq",	/* 3072 */
+	"eblp", "ebnrzthwtnhvfe", "ebordmnatgzxyh", "ebqxmuw",	/* 3076 */
+	"ebr", "ebra", "ebtgki", "ebv",	/* 3080 */
+	"ebvtf", "ebwwifi", "ebx", "ebxeiy",	/* 3084 */
+	"ebxo", "ebywteltsowaxi", "ec", "ecbde",	/* 3088 */
+	"ecedlj", "eceqqjzbekf", "ecfw", "ech",	/* 3092 */
+	"echghjnqycqluu", "echnvfhrxfyn", "echom", "echsv",	/* 3096 */
+	"ecigvjelqbf", "ecjegggok", "ecjly", "ecklyflz",	/* 3100 */
+	"eckyleposrmz", "ecl", "eclmd", "ecmmbbschtz",	/* 3104 */
+	"ecmtritsbsg", "ecnryuax", "ecobywpnpik", "ecoehbxjlbsco",	/* 3108 */
+	"ecpqrmmtuxnruq", "ecril", "ectsoktkzmmsu", "ecuxrjeiczrxff",	/* 3112 */
+	"ecvpkni", "ecw", "ecxdgkoy", "ecyzy",	/* 3116 */
+	"eczqutmjc", "ed", "edacon", "edauwzo",	/* 3120 */
+	"edbtr", "edd", "edesytc", "edfvpyd",	/* 3124 */
+	"edg", "edhgx", "edhhktrrjr", "edibh",	/* 3128 */
+	"edioawahf", "ediyevs", "edjmejzyvowyp", "edjmqagxj",	/* 3132 */
+	"edloaurcv", "edqutaajzrnx", "edstccqguqe", "edtpphpxglyxbm",	/* 3136 */
+	"edudzesduqc", "edwkgtldl", "edwngwfouwevmf", "edwpifbdr",	/* 3140 */
+	"edwqcpjodamfk", "edxnjx", "edxvkhx", "edyid",	/* 3144 */
+	"edz", "edzdke", "eeajo", "eebvai",	/* 3148 */
+	"eebzd", "eecxzh", "eedmqgffhmqq", "eedzvquv",	/* 3152 */
+	"eeeandjip", "eefkgbgrweoaua", "eefux", "eehmfditkwuh",	/* 3156 */
+	"eeigbzrosxtf", "eejelt", "eelarxldh", "eelpcul",	/* 3160 */
+	"eenboqxpqx", "eeoaylkgsbi", "eep", "eescujugdoymnq",	/* 3164 */
+	"eetwd", "eeuftagv", "eexcnjnwunf", "eexudhk",	/* 3168 */
+	"eexwqm", "eeyemtowposli", "eeyiotmhvjis", "eeyjyigwibpohu",	/* 3172 */
+	"ef", "efa", "efammrljsswj", "efaunn",	/* 3176 */
+	"efbalxsuzwcbde", "efc", "efcnhecjglgdm", "efddvig",	/* 3180 */
+	"efebp", "efffpnxkf", "effftpusuq", "effqhcdzx",	/* 3184 */
+	"efglvlrppvfx", "efgtxabeqqp", "efjlnk", "efjxmfej",	/* 3188 */
+	"efkhridbiosgdd", "efmafaily", "efmilabnedt", "efnkpffcc",	/* 3192 */
+	"efnobkvzmszrlt", "efpknzyrnvf", "efqebtiswksamw", "efqemp",	/* 3196 */
+	"efqoj", "efraoybpgmxr", "efrdlxr", "efrnole",	/* 3200 */
+	"efsih", "eftfsg", "efu", "efvemwteisjk",	/* 3204 */
+	"efvjpjgbs", "efvlzibujtphxw", "efwqvuhasldchb", "efwvjj",	/* 3208 */
+	"efzbpj", "eg", "ega", "egadmoba",	/* 3212 */
+	"egaerhgqln", "egafob", "egbusykrlzggt", "egdfodo",	/* 3216 */
+	"egedyfrbitaeb", "egfvprrmdk", "eggpoekbbzv", "egidxq",	/* 3220 */
+	"egk", "eglfn", "eglvfh", "egn",	/* 3224 */
+	"egnfclbml", "egngenompzu", "egoxvscw", "egpim",	/* 3228 */
+	"egpinuw", "egpjnftfh", "egqhuec", "egqq",	/* 3232 */
+	"egujcso", "eguyakek", "egxg", "egym",	/* 3236 */
+	"egyxmk", "egzyf", "egzyzqgvt", "eh",	/* 3240 */
+	"ehcglwwowb", "ehcwgxpyvxtw", "ehd", "ehdcsmxsuyb",	/* 3244 */
+	"ehe", "eherwbtmn", "ehfmshadnvo", "ehhgklgu",	/* 3248 */
+	"ehikovd", "ehizqpqtsvjae", "ehkmbnx", "ehlnmq",	/* 3252 */
+	"ehlq", "ehmcivnpv", "ehnzvchijr", "eho",	/* 3256 */
+	"ehqkdnchdhrxl", "ehqyretxcj", "ehsdrdoavhc", "ehstjmilmwooa",	/* 3260 */
+	"ehta", "ehtksfwfk", "ehuvzkyzoikgq", "ehvg",	/* 3264 */
+	"ehvkprhdzrl", "ehvwcwtnrdcqbl", "ehwg", "ehwrwpk",	/* 3268 */
+	"ehykdqmiv", "ehzhwrlqqasqg", "ei", "eiarkca",	/* 3272 */
+	"eiavypxdz", "eicq", "eienmxk", "eigqqbuwwaipr",	/* 3276 */
+	"eihyytpinxf", "eiibaauqu", "eij", "eijqdlxhbdocd",	/* 3280 */
+	"eiliioq", "eimt", "eiontjjuo", "eioon",	/* 3284 */
+	"eipqgius", "eiro", "eisryvbxbbusp", "eivbdyfxvbak",	/* 3288 */
+	"eivbqllrrelubf", "eiw", "eiwedbu", "eiwwazqlnhlw",	/* 3292 */
+	"eixlcmpaqogxh", "eiylyqxmza", "eiyofmmiwdev", "eiz",	/* 3296 */
+	"eizvipylu", "eizvrfxqoi", "ej", "ejamsljniy",	/* 3300 */
+	"ejatb", "ejaums", "ejb", "ejbqqgqxmlio",	/* 3304 */
+	"ejc", "ejcy", "ejdzekhrcjrjwp", "ejehjmt",	/* 3308 */
+	"ejekerexdswmp", "ejgczth", "ejhvulqae", "ejicphplxiwpn",	/* 3312 */
+	"ejjdm", "ejlroujxzb", "ejlwx", "ejnpskgzecacx",	/* 3316 */
+	"ejo", "ejomxmoxbpjm", "ejpbxbtwyxuocd", "ejqwqvgzfnvb",	/* 3320 */
+	"ejrdjq", "ejsal", "ejsmros", "ejvalvf",	/* 3324 */
+	"ejyz", "ek", "ekazsenqnjwq", "ekbtnh",	/* 3328 */
+	"ekc", "ekcd", "ekcrogrdplbo", "ekculbbumkgenh",	/* 3332 */
+	"ekdbioxcxijyx", "ekdc", "ekdipll", "ekegp",	/* 3336 */
+	"ekeyezxjthns", "ekf", "ekfdb", "ekhe",	/* 3340 */
+	"ekjkddbnzw", "ekjmgk", "ekjrqgxsfgwlw", "ekkwnvw",	/* 3344 */
+	"eklhfz", "ekmksqyd", "ekpjre", "ekpwqqqz",	/* 3348 */
+	"ekq", "ekqqpqyakyqju", "ekqxxzpurl", "ekrej",	/* 3352 */
+	"eksbvru", "ekttfarwdu", "ekuapsmxayhqqp", "ekv",	/* 3356 */
+	"ekwn", "ekxxrudftwuzp", "ekyrhto", "ekzaj",	/* 3360 */
+	"ekzgvnig", "el", "elatxhhhvj", "elb",	/* 3364 */
+	"elbqrlnbzlxa", "elc", "elcfbqwlbc", "elcwaipj",	/* 3368 */
+	"elczqhoyrwpld", "eldtuuwchkoyi", "eldxzuacqermc", "eldzbubvt",	/* 3372 */
+	"eleruxxdocxrv", "eley", "elfere", "elgomol",	/* 3376 */
+	"elifstg", "eliuldbwwumwlp", "eljqhuunsdk", "elkalleq",	/* 3380 */
+	"elmmbtduow", "elmnsvqgv", "elmym", "eln",	/* 3384 */
+	"elneaiibisdk", "elnttazy", "elobadpc", "eloiusalha",	/* 3388 */
+	"elpbgdnejh", "elproupvx", "elrmsw", "elsaovwtt",	/* 3392 */
+	"eltoojcu", "eltpchglwjkq", "eltvufjcv", "eltxadjmknowtn",	/* 3396 */
+	"elunde", "elvswpg", "elvtixtmnl", "elwbvyjixjky",	/* 3400 */
+	"elxu", "ely", "elyudqkdnp", "em",	/* 3404 */
+	"emahjaqctlv", "emba", "embepkhxifzku", "embrvakuzv",	/* 3408 */
+	"emctkieh", "emfagrefaivxyv", "emfawdxbb", "emhjltl",	/* 3412 */
+	"emivr", "emjwipnukscnh", "emjwnr", "emjxzceeil",	/* 3416 */
+	"emncaknf", "emocuafod", "empodcczesmy", "emqudxkpuao",	/* 3420 */
+	"emqzhtlrn", "emrv", "emsbmt", "emsdqgd",	/* 3424 */
+	"emsuvmnbngj", "emtbsgslybuwe", "emuxwpb", "emwdxlcur",	/* 3428 */
+	"emwpv", "emywoaxqiciz", "emyzxyab", "emzrotpbdnne",	/* 3432 */
+	"en", "enahhkbo", "enawihme", "enayzhqrqdci",	/* 3436 */
+	"encxemdnxrgear", "enfqw", "enfure", "enfxrrcv",	/* 3440 */
+	"engfrlxfx", "enilbnqlwcjxl", "enjty", "enkdxyewku",	/* 3444 */
+	"enkkcq", "enkqkgibj", "enmfu", "enmmmbry",	/* 3448 */
+	"enppohqqt", "enppzupyi", "enpuerowwdf", "enqfi",	/* 3452 */
+	"enqgjcoq", "enqshbqdcxgvxs", "ens", "ensadjrzhzrlo",	/* 3456 */
+	"entm", "enugneqonhdjnn", "enurhdzgegwlhc", "enuypwya",	/* 3460 */
+	"env", "enzcewq", "enzeeuj", "eo",	/* 3464 */
+	"eoasok", "eobbjfyatkaeid", "eobkikuigj", "eobopxskrl",	/* 3468 */
+	"eobvlnpdwk", "eobxmta", "eodhetcejocgvu", "eogjfhn",	/* 3472 */
+	"eohd", "eohzhbhcd", "eokav", "eolqilwdifsveu",	/* 3476 */
+	"eolyim", "eom", "eomjqlttfuwhdy", "eomkhcckb",	/* 3480 */
+	"eomwvgsoqkdojx", "eonzi", "eoowahw", "eopobttvtomvv",	/* 3484 */
+	"eoqo", "eorcdjteakhwjs", "eoriczehsifcxr", "eornnutaonzazv",	/* 3488 */
+	"eotctswdcyfuss", "eoveiubn", "eovrucewk", "eowqyjeg",	/* 3492 */
+	"eoxiqgicoviy", "eoxlrwvyrhhj", "ep", "epavsvjnpqz",	/* 3496 */
+	"epd", "epeivjcpetfpy", "epgmhnegk", "epgzt",	/* 3500 */
+	"ephdujrmkkgxx", "epkjihtae", "epks", "eplelo",	/* 3504 */
+	"eplx", "epnkckn", "epqmfdtvpum", "epsp",	/* 3508 */
+	"epts", "epv", "epvfawer", "epwlmzs",	/* 3512 */
+	"epwyvgnihvdzio", "epx", "epzhzuwwxutcf", "epzjrqoqkfyv",	/* 3516 */
+	"eq", "eqaamymmu", "eqasi", "eqchdnvbmij",	/* 3520 */
+	"eqd", "eqe", "eqeeto", "eqeswgjmp",	/* 3524 */
+	"eqewjjvaqsg", "eqfmhfkr", "eqfxerzo", "eqkceplzhq",	/* 3528 */
+	"eqkiozgkzszcxq", "eqkoqdkdaouwvb", "eqlktuyaefqpm", "eqm",	/* 3532 */
+	"eqmaaaq", "eqmnnoptht", "eqo", "eqqq",	/* 3536 */
+	"eqrmhhpnenpqx", "eqs", "eqtaiizcqcquqt", "eqttgiqtae",	/* 3540 */
+	"eqw", "eqwsu", "eqyqcrzypdvkvb", "eqz",	/* 3544 */
+	"eqzxtevgqwe", "er", "erbzwekvxloxg", "erckdxhqtirkl",	/* 3548 */
+	"erd", "erdgirz", "erdnkbdpfmi", "ereebl",	/* 3552 */
+	"erekiumhcal", "ereon", "ergijs", "erhcngcphm",	/* 3556 */
+	"eribneow", "erj", "erlagnpujlzh", "erlegph",	/* 3560 */
+	"erlodevk", "erotxlxquvx", "erqtxjtgx", "errdyzwwv",	/* 3564 */
+	"errxloacuw", "ersofphmgok", "ersrgpnoefl", "ersvgpbruzs",	/* 3568 */
+	"ervepytdbi", "ervsk", "erzldirimxefk", "erzxsd",	/* 3572 */
+	"es", "esazkgmf", "esbkzmw", "esc",	/* 3576 */
+	"esdadzctbpsj", "esdmkqnlkit", "eset", "esfo",	/* 3580 */
+	"esfvqnzejvnbvl", "esgpnovbbw", "eshajsvb", "eshybgz",	/* 3584 */
+	"esieijhggptofg", "esjrhzr", "eskrssjaxy", "esl",	/* 3588 */
+	"eslgfffvsgpp", "esmfqredofsbgg", "esnae", "esnewhl",	/* 3592 */
+	"esnnso", "esohgbxa", "esphv", "esqnzp",	/* 3596 */
+	"esrptntrtxhks", "esrvhrws", "essgmj", "essjbto",	/* 3600 */
+	"esulycsz", "esvjmxhatu", "esvqnl", "esxefqcx",	/* 3604 */
+	"et", "etabnu", "etc", "etdtgjxvyu",	/* 3608 */
+	"etfekvyhs", "etg", "etimcvstxqpsn", "etjprjwhu",	/* 3612 */
+	"etljdhmkzff", "etnojtznm", "etpz", "etqbrarth",	/* 3616 */
+	"etqiyqwg", "etqswjdztha", "etrc", "etrinmxrtqgq",	/* 3620 */
+	"etru", "etsai", "etsrictzzylnmq", "etsxzpiczaxvj",	/* 3624 */
+	"ettgiyzucirou", "etuhatou", "etw", "etwxlepuetd",	/* 3628 */
+	"etxfhgmuu", "etyzucp", "etzojkts", "etzpxuwzjcpztv",	/* 3632 */
+	"eu", "euaiifxv", "euaqdzkyljvoon", "eucaduuc",	/* 3636 */
+	"eud", "euex", "eufj", "eufrayvwo",	/* 3640 */
+	"eufsixopzhfdf", "euftzajenp", "eugoogd", "euirjynoxwrytb",	/* 3644 */
+	"eujpv", "eul", "eulhcpyh", "eumsxeafj",	/* 3648 */
+	"eunaxdekxleiw", "eupdekbjkwqn", "euphjigmw", "eupyrbvd",	/* 3652 */
+	"eurdlsag", "eurufaorrvbym", "eus", "eutzpphyxg",	/* 3656 */
+	"euurkgjnnnu", "euvfrshgpyfa", "euw", "euwtybljpf",	/* 3660 */
+	"euxzrokzkkzbcm", "euymzifycyta", "euzdousgcl", "euzjpywyuicdyc",	/* 3664 */
+	"euzoewehre", "ev", "evavtl", "evcawxdpfri",	/* 3668 */
+	"evdo", "evdpi", "evdrswfmjvbn", "evkqh",	/* 3672 */
+	"evlrl", "evlrne", "evndljrtb", "evohjarilf",	/* 3676 */
+	"evprusklydwc", "evpt", "evqemz", "evqlybuhomsxo",	/* 3680 */
+	"evrtabnuwsaei", "evrtytmjy", "evtauwm", "evtuejf",	/* 3684 */
+	"evukvcpchq", "evvvj", "evxxr", "evyqns",	/* 3688 */
+	"evyrsvvvhv", "evytldrfnop", "evzweomak", "ew",	/* 3692 */
+	"ewcoxyzgduuwei", "ewdsntga", "ewegflmjru", "ewg",	/* 3696 */
+	"ewgcwuzekfu", "ewh", "ewhhmno", "ewjhxcxaxh",	/* 3700 */
+	"ewl", "ewmesx", "ewo", "ewpoac",	/* 3704 */
+	"ewqoymi", "ewqpqtdyskvxkx", "ewrrq", "ewsixawdzg",	/* 3708 */
+	"ewsnpinbobmcsc", "ewsqkvdgc", "ewtetrwwinw", "ewthilyxnuqnsb",	/* 3712 */
+	"ewtt", "ewumvbzymoraeh", "ewuqjyims", "ewwgwhtsy",	/* 3716 */
+	"ewwwq", "ewxabkbvesso", "ewxvlkciso", "ewywxkyvkjwvv",	/* 3720 */
+	"ex", "exdx", "exghosjymfte", "exhlz",	/* 3724 */
+	"exidtzqnkk", "exn", "exosrsikmu", "expyikaat",	/* 3728 */
+	"exrjd", "extxcrweabyic", "exvempzbhc", "exvwyoullior",	/* 3732 */
+	"exxphfpu", "exxpliwfjpb", "exxwbiylwisss", "exyma",	/* 3736 */
+	"exzpk", "ey", "eycacfnxpft", "eycehwszdxluof",	/* 3740 */
+	"eyck", "eycl", "eycoggnc", "eyegnuo",	/* 3744 */
+	"eyfjhjogdgzzau", "eyidrzcvk", "eyiufyvcil", "eyjxstyeba",	/* 3748 */
+	"eylqo", "eyltsmn", "eymgdsdn", "eymxgtsydq",	/* 3752 */
+	"eynenixhvw", "eynsf", "eyntuqwzdgsxx", "eyo",	/* 3756 */
+	"eyprnkozfnzvr", "eyrym", "eyugyl", "eyutchrelmuz",	/* 3760 */
+	"eyuyajvdgqlmw", "eyvdx", "eywbgkygfqav", "eywcscn",	/* 3764 */
+	"eyxi", "eyxjuy", "eyxxi", "eyxxoyqvbdq",	/* 3768 */
+	"eyy", "eyyrmpzyhqamz", "eyywdleiq", "eyznctm",	/* 3772 */
+	"eyzogyqhwghs", "ez", "ezacunodx", "ezaeo",	/* 3776 */
+	"ezcnwm", "ezd", "ezdluyxcg", "ezegbq",	/* 3780 */
+	"ezeprhuxnlcm", "ezg", "ezgohejvpz", "ezguzmsonoekj",	/* 3784 */
+	"ezisaqllco", "ezjp", "ezkdssyycfmlr", "ezkiuie",	/* 3788 */
+	"ezkooph", "ezlai", "ezlh", "ezmktxabd",	/* 3792 */
+	"ezmqiix", "ezoepi", "ezqnmaqfc", "ezqpgx",	/* 3796 */
+	"ezrlavfdo", "ezsvvlfjrckkp", "eztjkvorlipvu", "eztyudgwfzd",	/* 3800 */
+	"ezvpkrhlbbdfp", "ezwprutatutly", "ezxpvxr", "ezxstvrlew",	/* 3804 */
+	"ezxuwfqsmbe", "ezxynhjepacbwc", "ezyfmwkhh", "ezzqtwmjl",	/* 3808 */
+	"ezzugcu", "faaivyhakrdu", "fabsxjlvga", "fabwkh",	/* 3812 */
+	"faccujdqv", "factyznv", "fagfxuaws", "fagifjjqinnc",	/* 3816 */
+	"fagtvkkoparb", "fahtbdlnuzwwt", "fai", "faidraovh",	/* 3820 */
+	"faiqtmpkwq", "fajdrxkdn", "fajobemfsmtew", "fajqfmkjbiel",	/* 3824 */
+	"fao", "faomb", "faovim", "faowahdr",	/* 3828 */
+	"faowpmzhz", "fapghqrjqrjvp", "faqio", "faqmclwkp",	/* 3832 */
+	"faquwwas", "faqxvodprhuzw", "faqyfzr", "farhzcvjua",	/* 3836 */
+	"farmdtb", "fascpfszfwm", "fasngd", "fatbqfde",	/* 3840 */
+	"fatglyxnw", "faultmykt", "fausvoet", "fav",	/* 3844 */
+	"favcnqbs", "fayutpqzn", "fazvogulbpxjrm", "fbayjpfgfc",	/* 3848 */
+	"fbazazowyhpbt", "fbcfustrns", "fbe", "fbfj",	/* 3852 */
+	"fbgzp", "fbivooax", "fbkqlsvylxfdht", "fbkwyyoogyw",	/* 3856 */
+	"fbl", "fbmnfqvjjbxei", "fbmusjuxfiunwl", "fbn",	/* 3860 */
+	"fbnkd", "fbogm", "fboyra", "fbpftoyrzuc",	/* 3864 */
+	"fbqggojhpq", "fbqtmjla", "fbqwmdiv", "fbrf",	/* 3868 */
+	"fbruvamydl", "fbtvyccxg", "fbukgiaaewq", "fbxjejvfoji",	/* 3872 */
+	"fbynxuw", "fbzrgi", "fbzsauckrzz", "fc",	/* 3876 */
+	"fcaypz", "fcb", "fcbkzcxgr", "fccknlhscyv",	/* 3880 */
+	"fcdzbo", "fcfz", "fchsxdhs", "fcj",	/* 3884 */
+	"fcjndsl", "fckcx", "fckisz", "fcloy",	/* 3888 */
+	"fcnjccbedefit", "fcpgeayfslh", "fcqjpuuiwzzx", "fcquzdwdeqxay",	/* 3892 */
+	"fcsdqvsra", "fcsl", "fctm", "fcvigowqahxri",	/* 3896 */
+	"fcvlnrn", "fcxcajc", "fcxn", "fcycqerhykfthd",	/* 3900 */
+	"fczjkdxddvc", "fcztlrtde", "fczvpdawev", "fd",	/* 3904 */
+	"fdahar", "fdbinhpzkow", "fdbu", "fdcnmplzpj",	/* 3908 */
+	"fdecnzxqxizbsi", "fdemvi", "fdfsdaqhg", "fdhv",	/* 3912 */
+	"fdibor", "fdiudjcmt", "fdivltusmshdo", "fdiyga",	/* 3916 */
+	"fdjodoww", "fdkhgqpm", "fdlqt", "fdmp",	/* 3920 */
+	"fdo", "fdpgatkm", "fdpyyzyai", "fdrgocoy",	/* 3924 */
+	"fdtnsrmqkknbzb", "fdugkoh", "fdvg", "fdwyopkqpgqe",	/* 3928 */
+	"fdxmctrhlehnjd", "fdxwouncarl", "fdyhto", "fdyna",	/* 3932 */
+	"fdzucsmzw", "fdzvucmh", "feayepdwrwuap", "febklm",	/* 3936 */
+	"fecmohbakmgyf", "feemmni", "fefdukod", "fegdzwbpb",	/* 3940 */
+	"fehyc", "feil", "feingsxy", "fej",	/* 3944 */
+	"fejbcgavbn", "fejpftjkqeawui", "fek", "fekvzpwto",	/* 3948 */
+	"felvvrk", "fem", "feobl", "feozkpfflvakd",	/* 3952 */
+	"feptbwzlj", "fesvirtupsc", "fevh", "fevr",	/* 3956 */
+	"fexcyls", "fexjtsfdua", "ff", "ffa",	/* 3960 */
+	"ffaeicxwuzu", "ffambjhkbbg", "ffaucyw", "ffbfznr",	/* 3964 */
+	"ffbknvu", "ffdsetzbvfzjvm", "ffdz", "ffel",	/* 3968 */
+	"fffgvfnboia", "fffilhaaxqcbx", "ffgukijypycfz", "ffjlonn",	/* 3972 */
+	"ffkxfohjjwksn", "fflfwxy", "ffmwvkgdzib", "ffnfgynzikyv",	/* 3976 */
+	"ffnhhbfzqz", "ffnyeqvesh", "ffodvqfek", "ffrfe",	/* 3980 */
+	"ffrkqoflzj", "ffsecirnp", "fftbknm", "fftiepvvvcabs",	/* 3984 */
+	"fftjau", "ffuvb", "ffvszorl", "ffwlz",	/* 3988 */
+	"ffzbxwtzs", "ffzvjgkbi", "fg", "fgbqslwmxoh",	/* 3992 */
+	"fgcqw", "fgdqnhkdah", "fgeeooezdoo", "fgfmcj",	/* 3996 */
+	"fggrrr", "fggvulz", "fggxgzbpwqrlsf", "fghfqmbihx",	/* 4000 */
+	"fgiqlkbuh", "fgivoohymtsq", "fgjsr", "fglyjadsqmy",	/* 4004 */
+	"fgnex", "fgnpxvn", "fgonjvkx", "fgpaacpdscu",	/* 4008 */
+	"fgpu", "fgpzirfw", "fgqloiyavzpaa", "fgricn",	/* 4012 */
+	"fgsoexpo", "fgt", "fgtfha", "fgtorhf",	/* 4016 */
+	"fgufp", "fguuwnha", "fgwb", "fgwst",	/* 4020 */
+	"fgwueqvlcfj", "fgxyribsoxwyd", "fgxytgbpdobsq", "fgynvlfsaafuoz",	/* 4024 */
+	"fgzbl", "fgzjnnepp", "fgzubffta", "fh",	/* 4028 */
+	"fhbdphje", "fhcgioepfnlja", "fhdcfftbjza", "fhdsbyxbhwekv",	/* 4032 */
+	"fhdvfmccmw", "fhe", "fhecwxi", "fhfmr",	/* 4036 */
+	"fhfquowse", "fhg", "fhgqv", "fhgvm",	/* 4040 */
+	"fhgyydczw", "fhhjorsmgowikp", "fhiowazjx", "fhjippt",	/* 4044 */
+	"fhktcujdwzcs", "fhm", "fhofqjrjvuzqft", "fhoysmgzsklssn",	/* 4048 */
+	"fhpiuamhzmx", "fhpxguerxfupe", "fhqsc", "fhrytvnwddl",	/* 4052 */
+	"fhs", "fhsoiqzzozuee", "fhstodagsluu", "fhv",	/* 4056 */
+	"fhvcxpzjp", "fhxbvaft", "fi", "fiaal",	/* 4060 */
+	"fiabgo", "fiasbxvezweyqx", "fibaurolv", "ficqfvvqlvs",	/* 4064 */
+	"ficrppmy", "ficszthr", "fidc", "fidyyadi",	/* 4068 */
+	"fiehtuzxhh", "fig", "figxvepsjznmg", "fihrnmfemsko",	/* 4072 */
+	"fik", "fil", "fimtplreufh", "finycfimuad",	/* 4076 */
+	"finyydjxzpscgw", "fioauhqwdpq", "fipp", "fiqxlllym",	/* 4080 */
+	"fismbxkhvla", "fiulbyzjgmuuc", "fivrhowneyfsz", "fiwsfadagnpur",	/* 4084 */
+	"fj", "fjbzoyov", "fjc", "fjcif",	/* 4088 */
+	"fjdmz", "fjdxb", "fjevwkyvaoof", "fjhxyohg",	/* 4092 */
+	"fji", "fjkuro", "fjljkekgoc", "fjlun",	/* 4096 */
+	"fjmbwpij", "fjmfot", "fjmgpcappowsu", "fjmmstucuiff",	/* 4100 */
+	"fjmnjnniugr", "fjrafjot", "fjrqiahcqyypl", "fjrrq",	/* 4104 */
+	"fjsd", "fjtfflknvzzlu", "fjthcmxkufjlki", "fjudtfj",	/* 4108 */
+	"fjutduocy", "fjvotlozuauj", "fjxd", "fjxukezgivbq",	/* 4112 */
+	"fk", "fka", "fkaml", "fkaot",	/* 4116 */
+	"fkbhcjrdppl", "fkbzvklsyp", "fkcq", "fkczzmieujrra",	/* 4120 */
+	"fkd", "fkdxs", "fkdyp", "fkef",	/* 4124 */
+	"fkhog", "fkhxahsdrie", "fkicop", "fkifmsmvkbbwjp",	/* 4128 */
+	"fkiujtr", "fkj", "fkjfvm", "fkjjcr",	/* 4132 */
+	"fkjrxgkbcmqknk", "fkkmxho", "fkkplbhqxw", "fklchrfdez",	/* 4136 */
+	"fkmgxdk", "fkmoo", "fkndh", "fknhh",	/* 4140 */
+	"fknxspyx", "fkoavuepzmgvi", "fkofwxtei", "fkokauo",	/* 4144 */
+	"fkouiwrbknqsb", "fkp", "fkqaholn", "fksdk",	/* 4148 */
+	"fktinmsahh", "fkuusq", "fkveamsiiugsyj", "fkvqg",	/* 4152 */
+	"fkw", "fkxmxdtgt", "fkydcd", "fkyerhmn",	/* 4156 */
+	"fkylytkxmliga", "fkz", "fkzejeb", "fkzgt",	/* 4160 */
+	"flcxownsfyapgb", "fldqigzjl", "fldsibhh", "flg",	/* 4164 */
+	"flgzbls", "flhrgarrr", "flifbcgnfpuv", "flijxmishwhf",	/* 4168 */
+	"flj", "flji", "fljlwh", "fljx",	/* 4172 */
+	"flksgxrgpbplx", "fllux", "flm", "flmofxf",	/* 4176 */
+	"flnyhvgaolqszb", "floanrdszs", "floj", "flox",	/* 4180 */
+	"flq", "flqou", "flqutqgr", "flrtq",	/* 4184 */
+	"fls", "fltexh", "fltmdrkbvl", "fltsmoq",	/* 4188 */
+	"flvfkjpmuej", "flwsr", "flwsvjcrjbbakh", "flxqkyjcbs",	/* 4192 */
+	"fm", "fmbmxashwx", "fmbsm", "fmbwecjnfhmbk",	/* 4196 */
+	"fmdb", "fmeen", "fmetuslyjsktne", "fmffq",	/* 4200 */
+	"fmfvsutghdiz", "fmilnqanksf", "fmirun", "fmjyvxuhkcyt",	/* 4204 */
+	"fmkmuuqvhjntr", "fmllyjigzldlt", "fmmaag", "fmmmjljcbdv",	/* 4208 */
+	"fmnfw", "fmof", "fmrlce", "fmrmsuolfsq",	/* 4212 */
+	"fmrvdwbb", "fmrxnzesqf", "fmsc", "fmtmofxvq",	/* 4216 */
+	"fmtu", "fmvhfpfhnrm", "fmwhdhkkvhzv", "fmwjjjadhfkjh",	/* 4220 */
+	"fmwopknu", "fmwotyiz", "fmwuetndsvdu", "fmyccxmmn",	/* 4224 */
+	"fnaehhtx", "fnbnx", "fnbtltf", "fnd",	/* 4228 */
+	"fnevstsf", "fnfqoc", "fnfrqyqx", "fngnkggmyf",	/* 4232 */
+	"fngscwrqdwt", "fnhkzzjecwxxyw", "fnhowncsctfe", "fnidmqxoygrppx",	/* 4236 */
+	"fniflqplqrwa", "fnjwvwigf", "fnlgl", "fnngfqqnntzjs",	/* 4240 */
+	"fnntgetnvbiqh", "fnp", "fnqsvlvjs", "fnrgva",	/* 4244 */
+	"fnsihyxs", "fnwmvzxlnqaxe", "fnxrq", "fnxrr",	/* 4248 */
+	"fnxwiqafstc", "fnzcohmbuig", "fnzdxawfpzg", "fo",	/* 4252 */
+	"foagmj", "foancllpwpt", "foarnn", "fob",	/* 4256 */
+	"foblhln", "focednfsz", "fociejyyewtup", "focorn",	/* 4260 */
+	"fodqvcvcwgkq", "foeeiqmwcqdcw", "foezzqgigatk", "foff",	/* 4264 */
+	"foixxwluz", "fojbmytwjff", "fokjbtpowmcpv", "fokqbnuhhvm",	/* 4268 */
+	"fokxf", "folmekydqzmf", "fomluz", "foozmf",	/* 4272 */
+	"foqpbjzpd", "forgedkvv", "fotfe", "fougpubqvbjo",	/* 4276 */
+	"foyziljjcw", "fozmdidzrvbyz", "fp", "fpabaqiaxbuqgz",	/* 4280 */
+	"fpbggtmxpkw", "fpbpdvrseeocuv", "fpe", "fpfqi",	/* 4284 */
+	"fpfwk", "fpfymkxuwzfs", "fpghnd", "fph",	/* 4288 */
+	"fpi", "fpifmyp", "fpjfag", "fpjxsqaopvtcvc",	/* 4292 */
+	"fpl", "fpmnyfn", "fpngjubgwjg", "fpoe",	/* 4296 */
+	"fpouqshifjhui", "fpox", "fpplpkfmm", "fpqkiwadiigw",	/* 4300 */
+	"fpqwl", "fprumlfwupqu", "fpsklm", "fpspj",	/* 4304 */
+	"fpsxosgzqjjo", "fpukdfmbzouzyo", "fpulczwo", "fpuzpktkj",	/* 4308 */
+	"fpw", "fpxmgxrkh", "fpyezzgnl", "fpzbyxywl",	/* 4312 */
+	"fpzitkwh", "fpzxubgkzmahf", "fq", "fqary",	/* 4316 */
+	"fqbakdpqunooxs", "fqbdcibei", "fqcmlk", "fqegxaeg",	/* 4320 */
+	"fqeldrmmbzor", "fqgbtsq", "fqgyyifyfqqzca", "fqhwjgdvo",	/* 4324 */
+	"fqinx", "fql", "fqlkvorkvhk", "fqlwd",	/* 4328 */
+	"fqmfchalw", "fqqyhizlyer", "fqrwpmrtmsux", "fqsoknawceq",	/* 4332 */
+	"fqtwvk", "fqubbrul", "fqufnwrnnzrfq", "fquutf",	/* 4336 */
+	"fqvvrmqaazp", "fqxcrk", "fqy", "fr",	/* 4340 */
+	"frahiciimn", "fraqq", "fratfbsb", "frdngj",	/* 4344 */
+	"fregomtlqwop", "frevddg", "frf", "frg",	/* 4348 */
+	"frgi", "frhgacsphdkal", "fricjsjqyveftn", "frimegib",	/* 4352 */
+	"friucfbry", "frlidub", "frlkz", "frlviweznxgue",	/* 4356 */
+	"frnqnzaabjayox", "frnti", "frnwquunb", "froujr",	/* 4360 */
+	"frrbiajcxaojtd", "frrfsis", "frsj", "frsr",	/* 4364 */
+	"frtiitaeasupc", "frtzyn", "frv", "frvmxxrrkmm",	/* 4368 */
+	"frxcuzwjvpynm", "frxjgni", "fryentxtc", "frygb",	/* 4372 */
+	"frymptizyr", "frzssdszjnl", "frzt", "fs",	/* 4376 */
+	"fsawhhush", "fsblmkibw", "fsbmi", "fsd",	/* 4380 */
+	"fsenzj", "fsfauacdq", "fsfujnqhgewxi", "fsgskmi",	/* 4384 */
+	"fsiaigwvdpb", "fskbehk", "fskcsajdibhhpf", "fslget",	/* 4388 */
+	"fsmwk", "fspcsrkl", "fsppjmkpz", "fspvfskua",	/* 4392 */
+	"fssgmaqg", "fstarlmlbxcqiw", "fsvbtrefb", "fsvepkhhnwgk",	/* 4396 */
+	"fsvlkiqdw", "fswd", "fswftuhsov", "fsxdz",	/* 4400 */
+	"fsyhbyohpuef", "fszjfnzeibn", "ft", "ftahttkclo",	/* 4404 */
+	"ftaye", "ftbyxafixnzap", "ftc", "ftdrjzolrkchyb",	/* 4408 */
+	"ftfpj", "ftftbxcqespf", "ftiexxvozsfzu", "ftilt",	/* 4412 */
+	"ftjc", "ftjiyikimssq", "ftjjis", "ftjxfpdhffizsl",	/* 4416 */
+	"ftkwhrspmzsqy", "ftmd", "ftnadi", "ftnvqgrnybje",	/* 4420 */
+	"ftoc", "ftpbsuhpgzcif", "ftpi", "ftpojgoe",	/* 4424 */
+	"ftpvmtrznslvx", "ftqlalnjyxsoli", "ftraodaoxhxfhc", "ftsxbmjbmiadx",	/* 4428 */
+	"ftvjt", "ftwg", "ftwxnzdfdmgdsn", "ftwzdptejybj",	/* 4432 */
+	"ftzcozrkbhv", "fu", "fuan", "fubedkshfuhs",	/* 4436 */
+	"fucgbfwuxm", "fuckbedmx", "fucle", "fuclyrjutsxh",	/* 4440 */
+	"fucnwggnrojl", "fuejvhvxdjaqnh", "fufx", "fufztpcqo",	/* 4444 */
+	"fuhap", "fuhjtzrbbm", "fui", "fuitwiaczvvm",	/* 4448 */
+	"fuk", "fulqhkthhuywgj", "fum", "fumcpswklsb",	/* 4452 */
+	"fuogsxz", "fupogq", "fuqbg", "furlzm",	/* 4456 */
+	"futqupclxtdmc", "fuuoauumpl", "fuyiycgacxqwf", "fuzbat",	/* 4460 */
+	"fv", "fvbobgeyyobxeu", "fvcnybit", "fvduqw",	/* 4464 */
+	"fveiupdspiefa", "fveom", "fveou", "fvfeyq",	/* 4468 */
+	"fvflhqaxxt", "fvguaoxu", "fvmdfvhwpvs", "fvmifyyds",	/* 4472 */
+	"fvoplhrcupepnq", "fvpkaxkvkjvum", "fvqrs", "fvucyizt",	/* 4476 */
+	"fvumiub", "fvvtzweqweoft", "fvxv", "fvxzxuyecekeau",	/* 4480 */
+	"fvya", "fvysfngk", "fvzh", "fw",	/* 4484 */
+	"fwajh", "fwamtt", "fweaqk", "fwetr",	/* 4488 */
+	"fwfhp", "fwfvdrmzg", "fwigjo", "fwixf",	/* 4492 */
+	"fwkcej", "fwkulwb", "fwn", "fwng",	/* 4496 */
+	"fwnm", "fwoaeao", "fwpmmxni", "fwpwdphfmmgd",	/* 4500 */
+	"fwrrewcwgskksc", "fwrztyqqc", "fwshotrrsgriku", "fwsppwuwtqy",	/* 4504 */
+	"fwsrjvfhbrux", "fwstmsjpb", "fwtavshqda", "fwtibltbdzhp",	/* 4508 */
+	"fwtphgpuviq", "fwu", "fwuorfcjp", "fwupstu",	/* 4512 */
+	"fww", "fwwacml", "fwwbvcfjjllupi", "fwypcmypkpd",	/* 4516 */
+	"fwzhqrxdc", "fwziixbh", "fwzk", "fwzwyuicdvpkb",	/* 4520 */
+	"fxazwqhiersikk", "fxbiexnby", "fxbly", "fxd",	/* 4524 */
+	"fxdnm", "fxeanhlmgqs", "fxemtnjke", "fxerrgqpyyrny",	/* 4528 */
+	"fxfbzdwnqdvgyt", "fxfsjyaljta", "fxfu", "fxhizlhwfpq",	/* 4532 */
+	"fxicqwvuvvonxp", "fxikkx", "fxj", "fxjydkymfwhqvd",	/* 4536 */
+	"fxlwmgodp", "fxnop", "fxnxg", "fxohg",	/* 4540 */
+	"fxquofqvaotvne", "fxrtmggc", "fxsmhttpqiosxd", "fxufqytlo",	/* 4544 */
+	"fxupkjndhraguq", "fxwct", "fxwtr", "fxxqqrkj",	/* 4548 */
+	"fxxztzjozxp", "fxygeihtwlddbr", "fy", "fyarbz",	/* 4552 */
+	"fyba", "fybvgsvpsf", "fycqzb", "fycz",	/* 4556 */
+	"fydjzldjfw", "fyfjqtr", "fyhnavsoyydwqo", "fyieggphtnscz",	/* 4560 */
+	"fyjwqkqgu", "fykca", "fykemnkruwqig", "fykpazor",	/* 4564 */
+	"fykpkfkprkxbr", "fymxxvama", "fyowvekg", "fypmq",	/* 4568 */
+	"fyprai", "fyteqop", "fyukfbarwujno", "fyuzcqhex",	/* 4572 */
+	"fyvkxfbte", "fyxtcx", "fyylebr", "fyyyqxsuljjmn",	/* 4576 */
+	"fz", "fzaxco", "fzaxn", "fzbijbspyw",	/* 4580 */
+	"fzbs", "fzclycbbejufwg", "fzcwlxgsywurd", "fzcyn",	/* 4584 */
+	"fzdbhe", "fzeuddn", "fzfce", "fzfij",	/* 4588 */
+	"fzgkfgfcamczq", "fzhwqmawodcteo", "fzhyptddk", "fzidkeuc",	/* 4592 */
+	"fzioshzymmuv", "fzjalcxnw", "fzjpkqd", "fzjwzc",	/* 4596 */
+	"fzlkb", "fzmk", "fzmlyksfvbuocq", "fznhoqw",	/* 4600 */
+	"fzosd", "fzozwjjqntzhy", "fzpdzyjwi", "fzprbi",	/* 4604 */
+	"fzpvc", "fzql", "fzqykwdxyacb", "fzrtfswxpjv",	/* 4608 */
+	"fztex", "fztph", "fzupscrg", "fzvemvhrmt",	/* 4612 */
+	"fzxrwpppdqgtj", "fzyaoherg", "fzzzld", "ga",	/* 4616 */
+	"gabqfvkspvfn", "gacnepad", "gaeqezpxmka", "gafbfjmonwkd",	/* 4620 */
+	"gagcjdgdzzmz", "gagtehcyrwkx", "gagxk", "gah",	/* 4624 */
+	"gahur", "gaiphxgs", "galvnp", "gamv",	/* 4628 */
+	"gao", "gaoqqbdrfkmjv", "gaqeckt", "gaqfrjqhwk",	/* 4632 */
+	"garjbzlnwxfw", "garjx", "gasfn", "gasop",	/* 4636 */
+	"gaupzkpnftkxh", "gauwibtmqa", "gavy", "gaxie",	/* 4640 */
+	"gaznoorayh", "gazuowgtmjekl", "gb", "gbbe",	/* 4644 */
+	"gbc", "gbcug", "gbdmrpxhcvlxy", "gbdukggzzp",	/* 4648 */
+	"gbfiy", "gbgdotks", "gbh", "gbhjksmhlybhjw",	/* 4652 */
+	"gbibbhv", "gbjc", "gbjcrw", "gbjcwvfeqsfkk",	/* 4656 */
+	"gbjtwnazdlsbhf", "gbk", "gblvzujvc", "gbn",	/* 4660 */
+	"gbngknwhs", "gbnwkyx", "gbo", "gbomqil",	/* 4664 */
+	"gbpgpc", "gbpuyuqmoo", "gbqkkccld", "gbqpxqqkosnal",	/* 4668 */
+	"gbrjyealc", "gbrlrhrz", "gbrpjbitgwp", "gbtzyn",	/* 4672 */
+	"gbucvrere", "gbuefqbwb", "gbxaiprcc", "gbxzsdukitse",	/* 4676 */
+	"gc", "gcanz", "gccva", "gcdr",	/* 4680 */
+	"gcejauhfy", "gcfu", "gcgile", "gchs",	/* 4684 */
+	"gchzpa", "gcjdkp", "gcl", "gclozmq",	/* 4688 */
+	"gcnpvsh", "gcouugtkfswvw", "gcpujsuscu", "gcqjikodgr",	/* 4692 */
+	"gcrogagmx", "gcszluxnendmf", "gcveh", "gcxlnjkey",	/* 4696 */
+	"gcxrfduq", "gcze", "gczsr", "gd",	/* 4700 */
+	"gdafiwonmo", "gdavqdpnao", "gdaxmevsjd", "gdbosuex",	/* 4704 */
+	"gdcjwchrdf", "gddpejznyvxpe", "gddxisqonxr", "gderdvijz",	/* 4708 */
+	"gdgdutzjfaogdc", "gdgfk", "gdgofsklw", "gdgyxpo",	/* 4712 */
+	"gdhfljoytkvs", "gdhjp", "gdixcz", "gdjz",	/* 4716 */
+	"gdldbeqjbnqgqf", "gdmlutc", "gdmrshpl", "gdnotaahl",	/* 4720 */
+	"gdomctvunlibgw", "gdowzzrwyojtrw", "gdpg", "gdrwlvwffptyc",	/* 4724 */
+	"gdscazrstnvj", "gdsgbh", "gducqthbsa", "gdudabuny",	/* 4728 */
+	"gduln", "gdvfppynzfndb", "gdvq", "gdwezvvcqf",	/* 4732 */
+	"gdxfozrbfd", "gdz", "gdzzntcjweiph", "ge",	/* 4736 */
+	"geauwj", "geaxfansiiyax", "gebixayoov", "gebjaclssbsyeb",	/* 4740 */
+	"gebpnvsl", "gedllpsier", "gedroghiyue", "geffsulqp",	/* 4744 */
+	"gefuvrjdvcccw", "gegupsfvhpmi", "gehx", "gekdldxlepqxzr",	/* 4748 */
+	"gekrlh", "gekxw", "gelgrhlboyep", "gendphfsijrg",	/* 4752 */
+	"geoemkiwh", "geofo", "gepslssrtwizig", "gepwckrkpc",	/* 4756 */
+	"geq", "geqhxjtbkuluti", "gesxhtzzdnclgt", "getmkq",	/* 4760 */
+	"getosnspfcanr", "gewfjwv", "gewmomt", "gewwdr",	/* 4764 */
+	"gexiqn", "geyjquxdodrgc", "gez", "gezovjw",	/* 4768 */
+	"gf", "gfakhpnp", "gfanbhbm", "gfbgmzbkkkvoqh",	/* 4772 */
+	"gfbkpnqu", "gfcvdjgixejpi", "gfdbuvof", "gfdkcjtgms",	/* 4776 */
+	"gffsa", "gfgkwq", "gfguukk", "gfgzajvl",	/* 4780 */
+	"gfkdvmudbb", "gfkp", "gflbatgpkboqvz", "gfnl",	/* 4784 */
+	"gfokudm", "gfoplgbz", "gfqwkgrslj", "gfsfjo",	/* 4788 */
+	"gfsmfngxkqqke", "gftqgqmql", "gftu", "gfu",	/* 4792 */
+	"gfvwixhbup", "gfxal", "gfxktuulutjpc", "gfyjp",	/* 4796 */
+	"gg", "ggbnytjniqmqm", "ggcbttjm", "ggclqs",	/* 4800 */
+	"ggcw", "ggdphrq", "ggecokdxq", "ggf",	/* 4804 */
+	"ggfermtsgxatl", "gghijmmxre", "ggips", "ggisdzomeri",	/* 4808 */
+	"ggjbbkrv", "ggkpoabjeqm", "ggkziajthn", "ggmlyvohjxynp",	/* 4812 */
+	"ggnbzcgoh", "ggnh", "ggoxmqwokgvb", "ggqe",	/* 4816 */
+	"ggqglghozpj", "ggrx", "ggsauhrrh", "ggsdm",	/* 4820 */
+	"ggwomxh", "ggwxtasphizr", "ggylmxq", "ggztifzlfck",	/* 4824 */
+	"gh", "ghacgxhnafy", "ghdilo", "ghdjkgppinyjz",	/* 4828 */
+	"ghgzej", "ghhxdufiatfo", "ghiewwq", "ghjhrlzdm",	/* 4832 */
+	"ghkgzavah", "ghkkzugiupyfms", "ghl", "ghlcxpdet",	/* 4836 */
+	"ghljpkarlrjr", "ghm", "ghmbdzwipcbis", "ghofyfer",	/* 4840 */
+	"ghqabjxinvlqp", "ghsywpwaz", "ght", "ghtvegmwewgn",	/* 4844 */
+	"ghu", "ghuw", "ghwbi", "ghxhvxljgeltez",	/* 4848 */
+	"ghxqelvvohpb", "ghydcupbjtnvc", "ghyhvcgotifbp", "ghyijztuoze",	/* 4852 */
+	"ghyymb", "ghzoiev", "gi", "gian",	/* 4856 */
+	"giao", "giaoq", "giat", "gibpxcldn",	/* 4860 */
+	"gifeekcotk", "gigu", "gij", "gijsks",	/* 4864 */
+	"gikjpjyeuzm", "giljm", "gilngwjoqjow", "gimpyhnkaauk",	/* 4868 */
+	"gimqk", "gimxmrawvzy", "gimy", "ginosqmmvdk",	/* 4872 */
+	"ginqoabafmnyg", "gintclslvglh", "giouz", "gipfxvoterkf",	/* 4876 */
+	"gipkbddh", "gipmkoxztb", "giqgxn", "gis",	/* 4880 */
+	"git", "gitmstryxa", "gitprzxbwt", "gitvypslwgrmzk",	/* 4884 */
+	"gitxrn", "giueoskyklpimy", "giuhcnwlwlyyg", "giwclpjaa",	/* 4888 */
+	"gixdyt", "gixgmye", "gj", "gjascziqlymc",	/* 4892 */
+	"gjcpant", "gjcxdvih", "gjfxeumnplwybr", "gjgmkjyqgskr",	/* 4896 */
+	"gjgpedibf", "gjhahzgn", "gjhlfvgs", "gjhnacd",	/* 4900 */
+	"gjhwfqen", "gjhyebqvljuyzu", "gjiexwalt", "gjjwjrlfwwxotc",	/* 4904 */
+	"gjkelbvzruly", "gjmkjhdrdt", "gjmm", "gjmtmyyoaieehx",	/* 4908 */
+	"gjmztoyn", "gjnfkxcrjyu", "gjnpwgwth", "gjozor",	/* 4912 */
+	"gjpwcc", "gjqaqnzejemv", "gjqzlahlujw", "gjrj",	/* 4916 */
+	"gjstedtjtl", "gjtoknvwkutvra", "gjuvzf", "gjvlltp",	/* 4920 */
+	"gjxdaze", "gjyn", "gjzdzads", "gk",	/* 4924 */
+	"gkabcdifrjrvru", "gkbjpdb", "gkbyylolme", "gkcuixqyvdp",	/* 4928 */
+	"gkcwjxs", "gkcxq", "gkhhjaipch", "gkhqqvfwhpout",	/* 4932 */
+	"gki", "gkjlkdawoypq", "gkkgwdw", "gklsytazbf",	/* 4936 */
+	"gkobeqlsyqbar", "gkpgeplywmdigb", "gkpgpnfd", "gksbbyfqotrbv",	/* 4940 */
+	"gktbygfxuqo", "gkterhtahwplue", "gktppkdeewihcu", "gkv",	/* 4944 */
+	"gkvjacnsusb", "gkxpyu", "gkycz", "gkzx",	/* 4948 */
+	"gl", "gladpvibxd", "glaucnzg", "gle",	/* 4952 */
+	"glejjdcsalzp", "glfeabcveldgm", "glgobwbhjgryfg", "glia",	/* 4956 */
+	"gljaqr", "gljj", "gljoqfqnojmd", "gljtnj",	/* 4960 */
+	"gljywqyfad", "glkytmmkpej", "gll", "glloqmgboh",	/* 4964 */
+	"gllxs", "glmuje", "glmzvhtaxes", "glpgkmwlh",	/* 4968 */
+	"glqimndjenu", "glrgxeswdkf", "glrs", "glsqpi",	/* 4972 */
+	"glswbpifq", "gltbejcyc", "gltcyilcw", "gluh",	/* 4976 */
+	"gluxb", "gly", "glyehhti", "glzctuvcmu",	/* 4980 */
+	"glzpscafft", "gm", "gmavopdbzzwnxw", "gmb",	/* 4984 */
+	"gmbh", "gmefhcmbfk", "gmfceiakmlokt", "gmftwxtcgzzs",	/* 4988 */
+	"gmfyue", "gmgxqho", "gmisacwvbf", "gmjvcnbsc",	/* 4992 */
+	"gmkcjg", "gmlwjxi", "gmndivrz", "gmnrb",	/* 4996 */
+	"gmnuwslctellv", "gmoq", "gmpjbz", "gmpvlmsaxr",	/* 5000 */
+	"gmrtxofhq", "gmrxtlg", "gmt", "gmtdrg",	/* 5004 */
+	"gmuath", "gmuqzlg", "gmuruwawhbr", "gmwphqdclwkp",	/* 5008 */
+	"gmxm", "gmy", "gmysmpb", "gn",	/* 5012 */
+	"gnakntszax", "gnbncehnew", "gnbqkrywllvwnh", "gnbxfywv",	/* 5016 */
+	"gncqzpt", "gndfueoe", "gndk", "gneixvqipfudx",	/* 5020 */
+	"gnernsjlyqma", "gnfxqzsbmupiv", "gnl", "gnmu",	/* 5024 */
+	"gnn", "gnnwdvwenkqf", "gnrxdak", "gnsntvksefzon",	/* 5028 */
+	"gnssgiyoagcm", "gnsvtktpy", "gnuhebiccioblo", "gnuodwdil",	/* 5032 */
+	"gnuuiebbh", "gnveyosxhnls", "gnvgdgnrxkte", "gnwqthljm",	/* 5036 */
+	"gnyeqrcm", "gnzerlltp", "go", "goalsz",	/* 5040 */
+	"goattemaitcd", "gobaaxhzuqbv", "gobdmc", "gobpiclpcqong",	/* 5044 */
+	"gobsyrs", "gobv", "gocrbou", "godubywary",	/* 5048 */
+	"gofbbhxiyqa", "goglaosywmcx", "gogqaxmlk", "gohgudcmere",	/* 5052 */
+	"gohpjcqidmcsn", "gohqf", "gohu", "gohwtndnurtzs",	/* 5056 */
+	"goi", "gokyadofayc", "golun", "gon",	/* 5060 */
+	"gondfm", "gonkvakf", "gonrzzx", "gonywqbg",	/* 5064 */
+	"gop", "gorzigavnuhgl", "gos", "gouedwdnboelrk",	/* 5068 */
+	"govcozpk", "govmmyrghnn", "goxszfxzrqtfb", "goy",	/* 5072 */
+	"gozkdvkowzbe", "gozmrtfz", "goztuxjqwgcokl", "gp",	/* 5076 */
+	"gpbcijjqlgoxzf", "gpcgtltcmcn", "gpcktn", "gpcvtwlenttku",	/* 5080 */
+	"gpeglpwjkurvu", "gpemybufsw", "gpgijsrqih", "gpgqacf",	/* 5084 */
+	"gpkkywwhgffk", "gpnjwfhzzwuuz", "gpo", "gpojenhpme",	/* 5088 */
+	"gppnwqio", "gprb", "gprtjl", "gpswydjpdppg",	/* 5092 */
+	"gpubambzzna", "gpump", "gpvy", "gpwhltquwf",	/* 5096 */
+	"gpwpc", "gpyvqxvpnzysd", "gpzenoyoitolg", "gqbpb",	/* 5100 */
+	"gqbpzlfomfic", "gqbqarbxwp", "gqbqpj", "gqg",	/* 5104 */
+	"gqhhgmnjcfobav", "gqidmcpqjrc", "gqivkkkricqhbc", "gqjbjbknp",	/* 5108 */
+	"gqkeihvrcbbf", "gqlasgyif", "gqlfaagpkxzxpj", "gqmdtvedzkhng",	/* 5112 */
+	"gqmhkypkrzqc", "gqofmnmxyq", "gqphjkhbutql", "gqqey",	/* 5116 */
+	"gqreqb", "gqrrjuadpwn", "gqrygjkqvldb", "gqsdyuyb",	/* 5120 */
+	"gqtjji", "gqtlhucmm", "gqwfjutj", "gqwidtrftqr",	/* 5124 */
+	"gqx", "gqxqbizpdi", "gqxxzsw", "gqy",	/* 5128 */
+	"gr", "graiutxx", "grcrkkjqebolzx", "gre",	/* 5132 */
+	"grghmfdq", "grgtdpynvlcz", "grhhzhjnnrmgy", "grkamd",	/* 5136 */
+	"grkwoi", "grl", "grlvayzeidw", "grlyicgcl",	/* 5140 */
+	"grnwhseromw", "grrauiyquzlr", "grrscvn", "grsgvy",	/* 5144 */
+	"grszqbckq", "grtcutcbi", "grw", "grwyxncyypfyi",	/* 5148 */
+	"grxx", "grymborgqqrp", "grz", "grzdgdyevfwd",	/* 5152 */
+	"gs", "gsakvcte", "gsdhox", "gseenurdvkdg",	/* 5156 */
+	"gseflu", "gsfnplthasgnwd", "gsgxscbyqflf", "gsh",	/* 5160 */
+	"gsitninfh", "gsivjwhznhiohb", "gsjivgo", "gskpg",	/* 5164 */
+	"gsnjtheqbt", "gsnkzzrz", "gsnpytphl", "gso",	/* 5168 */
+	"gsofywtqbmg", "gsopmjlyyft", "gsouhwgefju", "gspyxxxey",	/* 5172 */
+	"gspzcore", "gsqcddrbjf", "gsqtrjrg", "gsrvuthlktxwk",	/* 5176 */
+	"gsszmvav", "gstrflkshnny", "gsvhepdl", "gswep",	/* 5180 */
+	"gsyejiwrbbiv", "gszbrsaumjtjy", "gszrjfqi", "gt",	/* 5184 */
+	"gtaqvfdkl", "gtdhafltwupyd", "gte", "gtfk",	/* 5188 */
+	"gtfol", "gthpigueapbo", "gtit", "gtjxv",	/* 5192 */
+	"gtkgdmxwbvexx", "gtkploly", "gtlhkcoep", "gtnahamebx",	/* 5196 */
+	"gtnyrttc", "gtomq", "gtowpnkuo", "gtqtupenra",	/* 5200 */
+	"gtrkegiqqyr", "gttanimnrnnr", "gttoggjeurvo", "gtuaenl",	/* 5204 */
+	"gtvbnbfsdk", "gtvkhipjykf", "gtwdhyaqr", "gtxetatisaawro",	/* 5208 */
+	"gtyxhujxv", "gu", "guajusc", "guauabwzg",	/* 5212 */
+	"gubw", "gufmxkgg", "gugzezgdx", "guhbmdgzqiyagw",	/* 5216 */
+	"guheq", "guhwbcbbgyl", "gukfwkja", "gulflldic",	/* 5220 */
+	"guoqyb", "guoszmpftftkte", "guouutdhuaoy", "guowjpjjdma",	/* 5224 */
+	"guptgdwsvk", "guqf", "guriscyxmzseo", "gurmxdjvsdxtlx",	/* 5228 */
+	"gutdhbxalaq", "gutraavcvzykw", "gutwcabmidvec", "gutznqbvkayjo",	/* 5232 */
+	"guvfwm", "guvslrkvya", "guwfg", "guwxpmawsoy",	/* 5236 */
+	"guwyqc", "guxlo", "guyvpcmrx", "guyxcgcimtccn",	/* 5240 */
+	"gv", "gvbibexbftrioa", "gvbjdpmht", "gvbxu",	/* 5244 */
+	"gvdg", "gvez", "gvf", "gvfbxhk",	/* 5248 */
+	"gvfceebz", "gvfncld", "gvfphpckbp", "gvhyediraa",	/* 5252 */
+	"gviashldh", "gvigeqcqxvxtit", "gvjhdgtp", "gvju",	/* 5256 */
+	"gvlocohdm", "gvlx", "gvmsdxlwnqe", "gvn",	/* 5260 */
+	"gvohdabtjwbiom", "gvracxprr", "gvsu", "gvtamohqoqjk",	/* 5264 */
+	"gvv", "gvvwncwd", "gvyieojfgei", "gvzkghf",	/* 5268 */
+	"gw", "gwangghrbdlaf", "gwaoyowaejavcj", "gwb",	/* 5272 */
+	"gwbgn", "gwblkzzaqhayws", "gwbmmift", "gwetgydohdcdl",	/* 5276 */
+	"gwhklyevclovof", "gwkwoiwici", "gwmsj", "gwmt",	/* 5280 */
+	"gwo", "gwq", "gwqwturchmyod", "gwrhezm",	/* 5284 */
+	"gwscob", "gwskyrpdesjse", "gwunlb", "gwvwiqj",	/* 5288 */
+	"gwzleaubve", "gwzmg", "gwzodygb", "gwzud",	/* 5292 */
+	"gx", "gxaerdsd", "gxaftae", "gxbd",	/* 5296 */
+	"gxbhivwblppzto", "gxcah", "gxdcd", "gxdcrhjfyddxbi",	/* 5300 */
+	"gxff", "gxgnzfky", "gxkfyno", "gxkksayd",	/* 5304 */
+	"gxmjj", "gxmxzom", "gxo", "gxolspmfe",	/* 5308 */
+	"gxoqybez", "gxoyoichj", "gxqkpro", "gxqvzduj",	/* 5312 */
+	"gxqwg", "gxrdurx", "gxskiazxbv", "gxupanfwha",	/* 5316 */
+	"gxut", "gxweg", "gxwtf", "gxydpqf",	/* 5320 */
+	"gxytrjzzombu", "gy", "gyagkr", "gybluzuzhv",	/* 5324 */
+	"gybmqeh", "gydlcxerqard", "gydlkofixrlcx", "gyfognl",	/* 5328 */
+	"gygjbpgla", "gygv", "gyhu", "gyhwruqtvk",	/* 5332 */
+	"gyiuedbrnvu", "gykcniwvyhbj", "gykzasuftnj", "gylwfjvn",	/* 5336 */
+	"gymjpjrwtbihk", "gymjxpabjjgz", "gyngxnlhqicafw", "gyo",	/* 5340 */
+	"gypbkrszcnus", "gyprkycvuzszy", "gyq", "gyqejrlcccd",	/* 5344 */
+	"gyt", "gyttbrmhdvxcqq", "gytybu", "gyveedersan",	/* 5348 */
+	"gyvpzeuzyodhit", "gyw", "gywxevcyhsxg", "gyyeb",	/* 5352 */
+	"gyyrgyg", "gyzhujvvvtmgal", "gyzofxzhwy", "gyzsipzwm",	/* 5356 */
+	"gz", "gzakqjlcnr", "gzbuo", "gzbxdretly",	/* 5360 */
+	"gzeuk", "gzf", "gzg", "gzjwfdumv",	/* 5364 */
+	"gzlzldtmij", "gzmwermwlldpj", "gznrynpxghdv", "gznsrvbxecopk",	/* 5368 */
+	"gzphgsfod", "gzpumpmkum", "gzq", "gzqyurd",	/* 5372 */
+	"gzrdlt", "gztyrw", "gzu", "gzuafnqe",	/* 5376 */
+	"gzuqcssvgx", "gzvdamggucgvya", "gzvezhyzk", "gzvnjtjuh",	/* 5380 */
+	"gzxsckv", "gzydsgybpxgckc", "gzyjtyrhf", "gzylersqnuokm",	/* 5384 */
+	"gzyxoamsg", "gzzgx", "gzzichgqubsxx", "gzzwjkdu",	/* 5388 */
+	"ha", "hacbafjp", "hacd", "haeaeu",	/* 5392 */
+	"haeynlizpbmd", "hafdlixtnoz", "hafdyx", "hafjls",	/* 5396 */
+	"haimmfau", "haitpqcy", "hakbgyt", "hakoykilw",	/* 5400 */
+	"halzn", "hamco", "hamcu", "hamehs",	/* 5404 */
+	"hamtacsr", "hapzf", "harbquiz", "harvwlycqgydl",	/* 5408 */
+	"hatgoqgnlyzr", "hatmxhysox", "hautkhhijcctg", "havrpkqxv",	/* 5412 */
+	"havxp", "havz", "hawxyztbagaid", "haxjpx",	/* 5416 */
+	"haybmrvgzwxs", "hayufqvanfdjm", "hazkrhkhypu", "hb",	/* 5420 */
+	"hbaixni", "hbazy", "hbc", "hbdefvgciik",	/* 5424 */
+	"hbdoytsnwi", "hbforwstgrpowk", "hbgmpwwgdpcr", "hbi",	/* 5428 */
+	"hbif", "hbjerawvfobna", "hbjfvraw", "hbk",	/* 5432 */
+	"hblfz", "hblrst", "hbnzd", "hbofqiunurcb",	/* 5436 */
+	"hbpt", "hbq", "hbrij", "hbvnqtd",	/* 5440 */
+	"hbvtqgkrumckp", "hbw", "hbwqwdbvabyn", "hbwrnc",	/* 5444 */
+	"hbx", "hc", "hcaiucxge", "hcarnll",	/* 5448 */
+	"hcavnvqqhewkup", "hcaysttsa", "hcb", "hcbkejdfebth",	/* 5452 */
+	"hcc", "hcceol", "hccrjof", "hcdknmrarjezj",	/* 5456 */
+	"hcdrhvaeruoolw", "hcefekosh", "hceisjwz", "hcekqppq",	/* 5460 */
+	"hcfmn", "hcgsljowhjszg", "hchll", "hci",	/* 5464 */
+	"hcibtiq", "hcivvud", "hcj", "hckismtnwoi",	/* 5468 */
+	"hcksbyobmllysb", "hckxivfqgoy", "hclovcxqor", "hcmd",	/* 5472 */
+	"hcmqpameh", "hcnlzdfyhu", "hcnnqgsx", "hcoknirag",	/* 5476 */
+	"hcouyqjr", "hcowinoafz", "hcpl", "hcpmebphutbmv",	/* 5480 */
+	"hcrpymmxztj", "hctruspm", "hctxlbyi", "hcuqhdoepibw",	/* 5484 */
+	"hcwrly", "hcwtdokrilhr", "hcyyucuuz", "hcyzfiadq",	/* 5488 */
+	"hcz", "hd", "hdakheswxhw", "hdalcwfwpdheox",	/* 5492 */
+	"hdawgarntwl", "hdbttlnk", "hdcvxbn", "hddi",	/* 5496 */
+	"hdfoq", "hdge", "hdhgxqwfjuy", "hdhlgsrzgug",	/* 5500 */
+	"hdisjuvrins", "hdjassremkxfu", "hdjljaq", "hdjrpqazxw",	/* 5504 */
+	"hdkqdivwxe", "hdmapseumjzh", "hdmmkvyyn", "hdmohg",	/* 5508 */
+	"hdneewm", "hdpl", "hdqbzf", "hdqldkczx",	/* 5512 */
+	"hdrpojz", "hdrx", "hduwxsne", "hdvkiaqkdlzzu",	/* 5516 */
+	"hdw", "hdwex", "hdwzokarkze", "hdxebqtz",	/* 5520 */
+	"hdxuemq", "hdxyplqooao", "hdz", "hdzdnepjkbo",	/* 5524 */
+	"he", "heaalmmvshj", "heaammuerwdj", "hearnbzna",	/* 5528 */
+	"heccfotx", "heclljvh", "hedmnqbo", "hedszxvav",	/* 5532 */
+	"hefiwhn", "hegb", "heicjydqdayk", "hejagvnpquu",	/* 5536 */
+	"helr", "hem", "henbgiamfkor", "heo",	/* 5540 */
+	"heomzfazets", "hepovrm", "heseelfng", "heu",	/* 5544 */
+	"heuvhoyrfblas", "hevzsvczkbxy", "hewzjqolsvq", "hey",	/* 5548 */
+	"heywc", "hezqxcao", "hf", "hfagun",	/* 5552 */
+	"hfebvoqmluq", "hffbf", "hfhhnw", "hfhjmpxj",	/* 5556 */
+	"hfj", "hfk", "hfleyl", "hfmwpttkhpakbz",	/* 5560 */
+	"hfmzsd", "hfndzdn", "hfnyfemtc", "hfoio",	/* 5564 */
+	"hfqjevdeaqczr", "hfqjzc", "hfrspfltmqz", "hfs",	/* 5568 */
+	"hfuaudiga", "hfuiwrjtuxp", "hfvjkjbdlzjbp", "hfvkiuykf",	/* 5572 */
+	"hfwgzghk", "hfyzguhvkfivg", "hg", "hgakrbhrmoboj",	/* 5576 */
+	"hgatroecjxdrb", "hgayrvfb", "hgdiri", "hgefklyrrnrbs",	/* 5580 */
+	"hggu", "hgjfiayosfio", "hgjvvscwsgcarx", "hgjzpfltgq",	/* 5584 */
+	"hgknizrszyzyig", "hgl", "hglarmcpajro", "hgluosqezycn",	/* 5588 */
+	"hgmhme", "hgmnxmefddrqsc", "hgnvfqdkkbdgur", "hgnwoswurdwge",	/* 5592 */
+	"hgnztsvn", "hgotroaa", "hgpvtadzcfr", "hgqedkhxu",	/* 5596 */
+	"hgqyhmsi", "hgrvs", "hgtuawnuhwp", "hguuj",	/* 5600 */
+	"hgvoap", "hgxlh", "hgyejwv", "hgymn",	/* 5604 */
+	"hh", "hharlsjeis", "hhbtpvkggda", "hhd",	/* 5608 */
+	"hhdxmel", "hheicr", "hhgdlj", "hhgzx",	/* 5612 */
+	"hhhafq", "hhhzirndvncgxk", "hhiijigsv", "hhjlghsyd",	/* 5616 */
+	"hhkf", "hhkuowqxm", "hhljoiqlkfwak", "hhlvlzqv",	/* 5620 */
+	"hhmik", "hhmsheuc", "hhn", "hhocyvtjxtzzhm",	/* 5624 */
+	"hhohkxmtotpgyc", "hholhytt", "hhotr", "hhp",	/* 5628 */
+	"hhpfqtzttckd", "hhqfr", "hhsswaorna", "hhttj",	/* 5632 */
+	"hhununka", "hhuyvzo", "hhvn", "hhwmmgtexjxx",	/* 5636 */
+	"hhwpey", "hhxsgvsa", "hhzrrhuhpuac", "hi",	/* 5640 */
+	"hia", "hidztf", "hiegjrp", "hievlsjagrsq",	/* 5644 */
+	"hifpbcbbrqu", "higawxbiyiimw", "higpfqvwt", "hihdjzdb",	/* 5648 */
+	"hihojkw", "hii", "hikav", "hikipb",	/* 5652 */
+	"hiknfbobmeiz", "hikpykxcvebn", "hilbr", "himvzk",	/* 5656 */
+	"hin", "hioejol", "hiokjejb", "hiqblac",	/* 5660 */
+	"hiqurkskdgomvc", "hirxpxz", "hiswpzzvdwgc", "hitgmsqphhzris",	/* 5664 */
+	"hiu", "hivcnmiooi", "hivithvesbzgln", "hivukitxqmadk",	/* 5668 */
+	"hiwn", "hiwtxvtlxyl", "hixcueqt", "hiy",	/* 5672 */
+	"hj", "hjbdn", "hjbwnozcgmv", "hje",	/* 5676 */
+	"hjgkumasfwe", "hjgmfzga", "hjgnbvvwlk", "hjick",	/* 5680 */
+	"hjiouihrocarqg", "hjjpg", "hjjwyclydcb", "hjkicjnpupvfdg",	/* 5684 */
+	"hjlhafnaxngq", "hjlul", "hjmlmswgexo", "hjmx",	/* 5688 */
+	"hjnredbd", "hjqh", "hjujflfoc", "hjvnjffujhf",	/* 5692 */
+	"hjxxlkixz", "hjzbwbymrqtjq", "hk", "hkazrcoimg",	/* 5696 */
+	"hkcbnuvg", "hkcyem", "hkdrts", "hkdwntmuyg",	/* 5700 */
+	"hkdztrkvtscmz", "hkeeicfqlkdo", "hkfhsgcftzmjw", "hkftvpuyrm",	/* 5704 */
+	"hkgbtyo", "hkhqq", "hki", "hkjfjazrkehp",	/* 5708 */
+	"hkjfxzco", "hkkpbsuzee", "hklkobygss", "hkqecxjfgfggr",	/* 5712 */
+	"hkqvwpqwqim", "hkrcfcdpelfyx", "hktchmxtfxoa", "hktjbkqzlcotsx",	/* 5716 */
+	"hkvdbcm", "hkxk", "hkypaplqccyeb", "hl",	/* 5720 */
+	"hlahsjoan", "hlaweulb", "hlbjar", "hlbwrhratxwiy",	/* 5724 */
+	"hlcfmbitqydbf", "hlcmxajqgu", "hlednttqmeuzxq", "hlfqa",	/* 5728 */
+	"hlhcxastlkyopz", "hlhkbfp", "hlk", "hllsnxwgb",	/* 5732 */
+	"hlnjuoahgq", "hlpcctjh", "hlqfe", "hlsoz",	/* 5736 */
+	"hltyabvwfmpgk", "hluqa", "hlvizdm", "hlvsy",	/* 5740 */
+	"hlwnncgmfpnb", "hlwp", "hlxgxtpodrvz", "hlygsc",	/* 5744 */
+	"hlzvaiu", "hm", "hmb", "hmd",	/* 5748 */
+	"hmdtylbbbrd", "hmfjb", "hmfr", "hmhdphkecydjq",	/* 5752 */
+	"hmkexrqzvvkg", "hmnpn", "hms", "hmtazsgjs",	/* 5756 */
+	"hmtigmlvfjcpv", "hmtoektuofym", "hmwmsxw", "hmytwmhcd",	/* 5760 */
+	"hmzzjvfdaxhia", "hnahnzydiozo", "hnanommkmuuxf", "hncpzsa",	/* 5764 */
+	"hncxhtbwin", "hnevdf", "hnfdxsyx", "hnfrbpbqusxnt",	/* 5768 */
+	"hng", "hnhovxhcoiplk", "hnigtzshpjgk", "hniyvnmipd",	/* 5772 */
+	"hnkdmehlodst", "hnkiqubstxayga", "hnkopfy", "hnmua",	/* 5776 */
+	"hnnkn", "hnnlxmba", "hnnph", "hnovlrgzp",	/* 5780 */
+	"hnpivecu", "hnqjtryrktohb", "hnrihfuyewsjy", "hnrp",	/* 5784 */
+	"hnsldowtz", "hntdmisbpuktuo", "hntgfpixov", "hnuhfdka",	/* 5788 */
+	"hnuwacfyp", "hnvolwx", "hnvqcfofudjilc", "hnvyuzrsit",	/* 5792 */
+	"hnwlmvhpflpqqf", "hnwzwnj", "hnxlk", "hnyuvqjfzcd",	/* 5796 */
+	"hnze", "hnzuxdot", "hnzznfgaone", "ho",	/* 5800 */
+	"hocukopzscn", "hodrvfaquzupb", "hoexoxmddcuaa", "hofavgwhts",	/* 5804 */
+	"hofc", "hoffeezhlxnxx", "hofgrxcdsus", "hofimpk",	/* 5808 */
+	"hofkquyjp", "hofxbxrxbxjz", "hog", "hogcdw",	/* 5812 */
+	"hoguo", "hohtl", "hohxv", "hoipr",	/* 5816 */
+	"hojdhobp", "holcblahtldxuv", "homfkhjysrgz", "honbh",	/* 5820 */
+	"honkitscbxpeym", "honkka", "hopwi", "hortcsrraim",	/* 5824 */
+	"hosjwcgsxhx", "hotcqibjfzbidu", "hovp", "hoxkeoql",	/* 5828 */
+	"hoxmjctd", "hoygsfndq", "hoykb", "hoyqqtsw",	/* 5832 */
+	"hpbpp", "hpcsmubgs", "hpdstrmxfzqlm", "hpf",	/* 5836 */
+	"hph", "hpi", "hpj", "hpjdjguykjlj",	/* 5840 */
+	"hpjf", "hpkgahwfsem", "hpkkhdyrlfd", "hplafvojie",	/* 5844 */
+	"hplhncidofwr", "hplqx", "hpmabxtyqnt", "hppjxbmakbje",	/* 5848 */
+	"hpq", "hprzvxbaqj", "hpszf", "hpunw",	/* 5852 */
+	"hpuq", "hpvhohhb", "hpvixbcec", "hpw",	/* 5856 */
+	"hpwdfxosj", "hpzgvrzmk", "hpzkpezbcdxf", "hq",	/* 5860 */
+	"hqakyaimw", "hqaybcjn", "hqccuiuklyhrqn", "hqcgu",	/* 5864 */
+	"hqchwnkng", "hqcxdybknbal", "hqdmovqlkipgqu", "hqfkzf",	/* 5868 */
+	"hqg", "hqgsicgjswz", "hqjmznt", "hqjpkrinh",	/* 5872 */
+	"hqkrz", "hql", "hqmnwhcerkrfg", "hqnizuvm",	/* 5876 */
+	"hqnridobjdt", "hqq", "hqqbovj", "hqqvxbwcitkcj",	/* 5880 */
+	"hqqzlcgbenfs", "hqrptc", "hqsu", "hqsugetshvjfdy",	/* 5884 */
+	"hqsvketblfsi", "hqtgq", "hqtzmolibmtnlb", "hqurxzjtum",	/* 5888 */
+	"hqvzngeshv", "hqw", "hqwywnnfgkleox", "hqxhmawlnz",	/* 5892 */
+	"hqy", "hqysxyjffpfwy", "hr", "hratsrkn",	/* 5896 */
+	"hrbvtrrhlpv", "hrchnw", "hrcmsfe", "hrdldipf",	/* 5900 */
+	"hrdulmgfkvrh", "hrfrmkjzrnyt", "hriedz", "hrjyujz",	/* 5904 */
+	"hrk", "hrmbeyp", "hrmgzjnpqpb", "hrnaunvda",	/* 5908 */
+	"hrnzfshlqxzn", "hro", "hronj", "hrrrw",	/* 5912 */
+	"hrsm", "hrt", "hrtzuscx", "hrwcddbnjbstb",	/* 5916 */
+	"hryjxf", "hrz", "hsaeorzvwszly", "hsbqvgnlzwcx",	/* 5920 */
+	"hsciljsrdo", "hscyfqlnmztq", "hsdhslys", "hseszigyztwads",	/* 5924 */
+	"hsi", "hsjhspl", "hslvgbftnacbwu", "hsmyy",	/* 5928 */
+	"hsnqxxtvbz", "hsnukhdciqea", "hspvibfibbyl", "hsrg",	/* 5932 */
+	"hsrgboka", "hsufevxnutk", "hsuupswbynzol", "hsvnhsyg",	/* 5936 */
+	"hsvrrd", "hsxqsxujo", "hsyw", "ht",	/* 5940 */
+	"htdvpdrugp", "htdyav", "htec", "htexejlgbufv",	/* 5944 */
+	"htgmck", "hthwufsrsazpd", "htihhq", "htijfzvwdalx",	/* 5948 */
+	"htmpcwffw", "htnjxvnpkslchb", "htqiro", "htqnzhxynsau",	/* 5952 */
+	"hts", "htszdtrv", "htueeujem", "htuwbpabln",	/* 5956 */
+	"htvln", "htvlqxnal", "hu", "hua",	/* 5960 */
+	"huaiwm", "huaxwuxprfofmn", "huazxmgyi", "hucvbqam",	/* 5964 */
+	"huhdmq", "huhrokqdjpyqzn", "huhwydfp", "huj",	/* 5968 */
+	"hujafuk", "hulfxunfz", "hulo", "humhmsttzcilhy",	/* 5972 */
+	"humlqy", "humnkoea", "huoaszuoodkn", "hupcaef",	/* 5976 */
+	"hupprytrsor", "hurbkuojrh", "hurezq", "hury",	/* 5980 */
+	"hutbivpnyunjuf", "hutbqk", "hutznhmsv", "huv",	/* 5984 */
+	"huvttietfnx", "huwqjojrk", "huxnemfqqycsi", "huxx",	/* 5988 */
+	"huzfnns", "hv", "hvaxluuztkysip", "hvb",	/* 5992 */
+	"hvcdzdh", "hvdn", "hvejsyvsypkez", "hvekm",	/* 5996 */
+	"hveuyx", "hvfthsntsjb", "hvgm", "hvixf",	/* 6000 */
+	"hvjrnlblw", "hvkpxp", "hvn", "hvo",	/* 6004 */
+	"hvpzhplrcbshel", "hvqbbmtrhuq", "hvqdvbpmjsf", "hvqztnhejrhm",	/* 6008 */
+	"hvsdwd", "hvstmkfbd", "hvtvvmvd", "hvufgvznk",	/* 6012 */
+	"hvuhahnukxmasa", "hvupepvrnqmqa", "hvzmsqzbhyjwl", "hw",	/* 6016 */
+	"hwa", "hwaryxgfsnych", "hwco", "hwex",	/* 6020 */
+	"hweyvau", "hwfhsr", "hwgreynbivqoe", "hwguywvocspuk",	/* 6024 */
+	"hwivfnv", "hwjsenhitochdx", "hwkgd", "hwkrvcuwwyzlpg",	/* 6028 */
+	"hwlbblwcaggclo", "hwle", "hwloyrav", "hwnjzcztrwfjtw",	/* 6032 */
+	"hwoqfebkyyo", "hwplpz", "hwqemnowqhqeu", "hwrkzhttzitks",	/* 6036 */
+	"hwtabj", "hwuraaad", "hwuziwwb", "hwwrnl",	/* 6040 */
+	"hwxppnyds", "hwy", "hwzmfzwqpix", "hwzydgsuf",	/* 6044 */
+	"hx", "hxa", "hxbqvzikl", "hxclelokqrbnh",	/* 6048 */
+	"hxcpzefr", "hxcqop", "hxgagprozlp", "hxhhxlqq",	/* 6052 */
+	"hxhuqux", "hxiydkbnz", "hxk", "hxmtdu",	/* 6056 */
+	"hxntv", "hxpdirjc", "hxpdkkny", "hxqbum",	/* 6060 */
+	"hxrtptwsw", "hxsblfchbehpzq", "hxtbvgai", "hxupbfsqltxkb",	/* 6064 */
+	"hxvsdgw", "hxwmdio", "hxy", "hxzjopyvntx",	/* 6068 */
+	"hxzmnvflr", "hyaa", "hyafjckq", "hycovwchejiwno",	/* 6072 */
+	"hycrirtoqmu", "hydlcfnh", "hydtnxacddg", "hyfqenlsfyz",	/* 6076 */
+	"hygx", "hyh", "hyibaodbu", "hyiyxvm",	/* 6080 */
+	"hyizpiy", "hyjbeda", "hyjcjzwhzwd", "hykgm",	/* 6084 */
+	"hykwxva", "hylanpwtxeabb", "hylz", "hymduf",	/* 6088 */
+	"hymzmseco", "hyoa", "hyoafvyovbh", "hyojgdbw",	/* 6092 */
+	"hyow", "hyr", "hyrdcyalywj", "hysgwwjouerhvu",	/* 6096 */
+	"hyulejb", "hyulwljtuqw", "hyx", "hyye",	/* 6100 */
+	"hyzei", "hyzlhcl", "hyznkubjujic", "hz",	/* 6104 */
+	"hzakjayzrvxr", "hzaptyatqa", "hzgx", "hziazy",	/* 6108 */
+	"hzicsg", "hzkdabotmfauv", "hzkgbwztswbslh", "hzkxxznxf",	/* 6112 */
+	"hzlcqxm", "hzltixccxgp", "hznmdmxjo", "hzoeoms",	/* 6116 */
+	"hzofuznsia", "hzphqmd", "hzqwtrnbx", "hzrqsuygzdyn",	/* 6120 */
+	"hzsrvumcey", "hzuanjvfe", "hzuulqjvae", "hzuwtsxzmjivc",	/* 6124 */
+	"hzvkgczkf", "hzvmf", "hzvy", "hzwa",	/* 6128 */
+	"hzwb", "hzwdhilhsfollw", "hzxwnx", "hzzvjzotgq",	/* 6132 */
+	"ia", "iab", "iabagrdrcm", "iabpcxgiwikv",	/* 6136 */
+	"iabpuufnj", "iacdnedigc", "iacpbqmdunmms", "iaeb",	/* 6140 */
+	"iaf", "iah", "iaiqfvy", "iajim",	/* 6144 */
+	"iakjxlbu", "ialejhtclwrn", "iametkfzoeibm", "iao",	/* 6148 */
+	"iaoooqnxztgtlu", "iapsg", "iapyqen", "iaqmrvv",	/* 6152 */
+	"iaruoyjp", "iascku", "iasypummevq", "iat",	/* 6156 */
+	"iatoktwylbj", "iatwvfgwvt", "iav", "iavbt",	/* 6160 */
+	"iavqjjsdi", "iavqkaa", "iaxwhoujj", "iaybpxneytfxgq",	/* 6164 */
+	"iaypliowwt", "iazjeplniml", "iazzkuqhgkpxlh", "ibaemozuxuqu",	/* 6168 */
+	"ibaxkcmhklsfi", "ibcu", "ibcv", "ibcyjzi",	/* 6172 */
+	"ibeibzvqhqmdkg", "ibekzivof", "ibfmwxvpcelgu", "ibhfwmswfzwhnt",	/* 6176 */
+	"ibiuhzgxzm", "ibjitzzknfnqy", "ibkxyb", "ibm",	/* 6180 */
+	"ibmlhpmq", "ibmugubxgddx", "ibmxtfwbm", "ibmyyony",	/* 6184 */
+	"ibnmeyqmauejjc", "ibopez", "ibpywrwzwmky", "ibqyvhibxmvg",	/* 6188 */
+	"ibringw", "ibsb", "ibshf", "ibsucnhdhpd",	/* 6192 */
+	"ibty", "ibvyqp", "ibwazycwjr", "ibx",	/* 6196 */
+	"ibyodhrhfavaj", "ibyrrojkvgukv", "ibzgaa", "ibzhtlebhzl",	/* 6200 */
+	"ibzminxho", "ic", "icavpmwudcnzcj", "iccbwtydyvv",	/* 6204 */
+	"icdatwrazhhpws", "icddrytuwnizjg", "iceshglyyqrc", "icgcder",	/* 6208 */
+	"icgkthjfg", "ich", "ichzxoljswjwi", "icifj",	/* 6212 */
+	"icirpzjs", "ickh", "iclpvpjjvcctn", "icmlrjyxvf",	/* 6216 */
+	"icmqnzoltqdf", "icntbipxeelqp", "icpkusrqffdv", "icpuywhqgi",	/* 6220 */
+	"icpvr", "icq", "icr", "icrkncsmofalnk",	/* 6224 */
+	"icrlkrlxi", "icswdksqmvxjn", "icthcyafvc", "icurayev",	/* 6228 */
+	"icvwtjqedblu", "icvznxbcy", "id", "idalgpz",	/* 6232 */
+	"idbkcbzptgtgy", "idbktvcdrylx", "idc", "idcj",	/* 6236 */
+	"iddloaoyyi", "idehiycg", "ideozptfr", "idhbxntwlc",	/* 6240 */
+	"idilmkbud", "idlouzjnl", "idmpmol", "idnpwxihq",	/* 6244 */
+	"idobfzsmxfsz", "idocpoqvw", "idpdpgfllin", "idpfg",	/* 6248 */
+	"idqtgbrhqomxjp", "idqvfpzw", "idsbvtllp", "idshyqwye",	/* 6252 */
+	"idsqg", "idtouujp", "idvmjfh", "idvwslvjaknsk",	/* 6256 */
+	"idxdms", "idxfhii", "idxnwmzs", "idzplzie",	/* 6260 */
+	"idzvbrnvisokq", "ie", "iebbnsmi", "iebmzvxeceiaco",	/* 6264 */
+	"iebppxj", "iebrilko", "iec", "iecb",	/* 6268 */
+	"ieedy", "iefnm", "iegnzpsqznys", "iehi",	/* 6272 */
+	"ieipbhcezvo", "ieistfwa", "ieit", "iekjuhyoerbf",	/* 6276 */
+	"ieknqzm", "ielrn", "ieltz", "ieojqlxae",	/* 6280 */
+	"iepjzhdbg", "ieqdiqnppuc", "ieqtu", "ieqxvilsr",	/* 6284 */
+	"iermusnthqffwk", "ierxk", "iesbjsep", "ietstrgnyibs",	/* 6288 */
+	"ietwwax", "ieunq", "ieuoosdrsmh", "iev",	/* 6292 */
+	"ievaxct", "iexgxsxtlrtcnw", "iexpfaywoxwh", "iexyiyczkcq",	/* 6296 */
+	"iezbrcgwrdxizu", "iezco", "iezuinscw", "iezvevdzc",	/* 6300 */
+	"if", "ifa", "ifaqaxn", "ifarabzujyumj",	/* 6304 */
+	"ifbob", "ifdouxibxwhl", "ifean", "iffpevnvo",	/* 6308 */
+	"ifgdszmwcuk", "ifgiat", "ifknidjkrzdix", "iflujdazs",	/* 6312 */
+	"ifoguuuzqnchxu", "ifpyytltbcgmjm", "ifqmcdk", "ifrxfvxjrwxqpj",	/* 6316 */
+	"ifthpq", "iftmkzpmtfn", "ifunlji", "ifuwej",	/* 6320 */
+	"ifvfaygsmlkx", "ifwcatxyra", "ifxkh", "ifybudr",	/* 6324 */
+	"ig", "igautjqehacnw", "igbkp", "igcvdcpt",	/* 6328 */
+	"igdaqyubtilllw", "igdhchmrnhpi", "iggnmksgw", "ighxaacqsv",	/* 6332 */
+	"igj", "igjqb", "igk", "igmfnhxlm",	/* 6336 */
+	"igmkygpa", "igngco", "igodhznhcvmg", "igoohvoanj",	/* 6340 */
+	"igp", "igrbtuzpor", "igrcp", "igsdpipxuti",	/* 6344 */
+	"igshzyvbihc", "igt", "igukpcddnmozg", "igvqfjxsn",	/* 6348 */
+	"igwxghgucssyb", "igxo", "igyxhuiszglgqi", "ih",	/* 6352 */
+	"ihafrokufkd", "ihagpyr", "ihcmja", "ihdwenhqh",	/* 6356 */
+	"ihfi", "ihfj", "ihg", "ihgasyakc",	/* 6360 */
+	"ihgdixpbxqjz", "ihgpusxydhhpf", "ihgslgeuemocq", "ihhcnv",	/* 6364 */
+	"ihhelw", "ihljzrovkzg", "ihmr", "ihneyhvmtxbhgs",	/* 6368 */
+	"ihnqgpza", "ihntdyei", "ihp", "ihphztwn",	/* 6372 */
+	"ihq", "ihqazqgr", "ihqtwb", "ihtlswktwtqxzo",	/* 6376 */
+	"ihvcrmof", "ihwlgksamdm", "ihwnsisrg", "ihxd",	/* 6380 */
+	"ihzpijklkgzi", "ii", "iib", "iicwhtgdmqqd",	/* 6384 */
+	"iigckw", "iiirf", "iilhxc", "iimmmhafmzu",	/* 6388 */
+	"iinwaohkp", "iiolkszmlrf", "iipwjipg", "iiqzjkkcnzob",	/* 6392 */
+	"iisn", "iitqip", "iityy", "iiujaqc",	/* 6396 */
+	"iiuvhjokwkgou", "iivquuoih", "iiw", "iiwcbut",	/* 6400 */
+	"iizdbzzgnt", "ij", "ija", "ijatyb",	/* 6404 */
+	"ijbaauy", "ijdrvlrcaq", "ijermwnicfiuvn", "ijfb",	/* 6408 */
+	"ijfg", "ijgrmxm", "ijhksq", "ijkvtxj",	/* 6412 */
+	"ijloyj", "ijnanfghtkfkkd", "ijnrfjdvvu", "ijo",	/* 6416 */
+	"ijogcvfvgwtcxk", "ijqybjppwfc", "ijrjfn", "ijrlshzx",	/* 6420 */
+	"ijrzawjazh", "ijttyjukyclga", "ijtzxlujvyu", "ijvdcmvbas",	/* 6424 */
+	"ijytomdhd", "ijzrjed", "ik", "ika",	/* 6428 */
+	"ikaebnzqu", "ikazzdr", "ikbcebisv", "ikbkgnsoay",	/* 6432 */
+	"ikbzlxxbx", "ikcoib", "ikczrvyxgpon", "ikfzs",	/* 6436 */
+	"ikgaerkqwrireg", "ikgagct", "ikgqozm", "ikhcawypecnuey",	/* 6440 */
+	"ikhrdxusdm", "ikidpeotmjq", "ikiv", "iklqdwe",	/* 6444 */
+	"ikmcajck", "ikmurpkdxru", "ikrqtprrje", "iks",	/* 6448 */
+	"iksfoej", "ikst", "ikthwysy", "ikujrixvt",	/* 6452 */
+	"ikuwownch", "ikvsdmmqnm", "ikwnhfa", "ikx",	/* 6456 */
+	"ikxhyrvfqwy", "ikxmowsppwv", "il", "ilaxywg",	/* 6460 */
+	"ilbapiiyavm", "ilctnd", "ilddar", "ildwllfx",	/* 6464 */
+	"ileo", "ilhefsyhnclqrf", "iliktx", "ilinqigqs",	/* 6468 */
+	"illozrkmrhqmd", "ilmta", "ilopheiafprgc", "ilqazxklg",	/* 6472 */
+	"ilquvrumfyhy", "ilrlatnkkxeon", "ilstxeedfxoi", "iltuatubsdz",	/* 6476 */
+	"ilujjgvnidd", "ilvwegbfyjmon", "ilw", "ilwilrmvtf",	/* 6480 */
+	"ilza", "ilzgwcsiycw", "im", "imaetwxxozj",	/* 6484 */
+	"imaj", "imcjssmgujpjg", "imcocmbluxvov", "imcvod",	/* 6488 */
+	"imdbreapj", "imdnn", "imf", "imgcnz",	/* 6492 */
+	"imgimrmorwy", "imgjwxut", "imgxgqoftur", "imhnkoqlzphfoh",	/* 6496 */
+	"imidgbiivh", "imiltsn", "imk", "imkn",	/* 6500 */
+	"iml", "imlbsqqgqvgi", "imlqwowuxfeq", "immsbfu",	/* 6504 */
+	"imnh", "imoasofadnhy", "imopmmdmk", "imoxrqnpn",	/* 6508 */
+	"impjcky", "imqtkiqtbrvwue", "imrdjyxj", "imrrmadpb",	/* 6512 */
+	"imsjb", "imvjlcztrlxykt", "imvo", "in",	/* 6516 */
+	"inahygubappct", "infqa", "inghdjtsrx", "inicrmedev",	/* 6520 */
+	"inieyzbgwclyb", "initdp", "inkndjxghyvclz", "inkpbwov",	/* 6524 */
+	"inkwxsun", "inkypgwpmwncc", "inlflnedesf", "inlm",	/* 6528 */
+	"inlxnkdoag", "inmvghe", "innjo", "inoewq",	/* 6532 */
+	"inokqdfmr", "inpopczsvdolk", "inpppsjhkmeogm", "inrjhgcouulk",	/* 6536 */
+	"insaxcpjwqbny", "intkbvyuzl", "intkpkcstby", "inu",	/* 6540 */
+	"inuxpbkjmbod", "inv", "invlxlzgotv", "invu",	/* 6544 */
+	"io", "ioati", "iobftuujkz", "ioeoviprsb",	/* 6548 */
+	"iofd", "iofnrdo", "iogeky", "iohisfg",	/* 6552 */
+	"iohur", "ioizzlux", "ioj", "iondqtrbvhhfsu",	/* 6556 */
+	"ioomoijmjsle", "iopdyxpjta", "iorcpjlg", "iosejwylkicdq",	/* 6560 */
+	"iouyv", "iovfhecijuxp", "iowmfewn", "ioxmaaaqxxsudi",	/* 6564 */
+	"ioxqidmhzoq", "iozwiz", "ip", "ipasrsvh",	/* 6568 */
+	"ipbbemxhbhova", "ipbkoxsqfyluk", "ipcjlzbzr", "ipewbt",	/* 6572 */
+	"iphmaadfb", "iphu", "ipivplsa", "ipjvhv",	/* 6576 */
+	"ipkgrk", "ipldwnbjxxdgr", "iplwithtt", "ipn",	/* 6580 */
+	"ipoe", "ipoyxwrotb", "ipqekegx", "ipuirmwworm",	/* 6584 */
+	"ipvfyjmwwww", "ipxzzfnj", "ipyc", "ipzlvdlbwwagls",	/* 6588 */
+	"iq", "iqbcsz", "iqbh", "iqc",	/* 6592 */
+	"iqca", "iqezzyrfdnex", "iqfvhqpbczsx", "iqfxgobqnl",	/* 6596 */
+	"iqggrhkqysmgz", "iqhhugkcmv", "iqisuyf", "iqjuoyyja",	/* 6600 */
+	"iqjvmkgnx", "iqkcojqfzbozvr", "iqmyzj", "iqnythaikefa",	/* 6604 */
+	"iqofgatlsnylg", "iqouegvfcrohid", "iqpbsanw", "iqpgvuetdp",	/* 6608 */
+	"iqphx", "iqpifyawfqv", "iqppdfzk", "iqqitetlcngkt",	/* 6612 */
+	"iqrxgswe", "iqrzgfgykmmfsw", "iqsgfkesbckjo", "iqtgnpx",	/* 6616 */
+	"iquba", "iquopsouslsbs", "iquthhffqxnpdk", "iqvdqgulal",	/* 6620 */
+	"iqweihzjurp", "iqygmvzieabdes", "iqynzosswje", "iqyp",	/* 6624 */
+	"ir", "ira", "irairiqi", "iraqcecjrqhjtr",	/* 6628 */
+	"iraqyqw", "irayrsy", "irbghvgwzlohbq", "ircipyilx",	/* 6632 */
+	"irdnkihq", "ireaxujjpeid", "ireqzxk", "irfatohyh",	/* 6636 */
+	"irfaxszib", "irfoopakxpq", "irfrtuc", "irg",	/* 6640 */
+	"irgvfkvxhomc", "irhh", "irhputqhltmin", "irjst",	/* 6644 */
+	"irl", "irm", "irmau", "irnqqshhondl",	/* 6648 */
+	"iroeniu", "irp", "irqa", "irqhdn",	/* 6652 */
+	"irqnnyvyy", "irqoiqkhgnc", "irqzluttanjf", "irs",	/* 6656 */
+	"irsqzysw", "irtwwwuiahygev", "irtz", "irull",	/* 6660 */
+	"iruoizgiccmcdy", "iruurrcun", "irwbu", "irwpmaqec",	/* 6664 */
+	"irwsoenneprd", "irxeqjma", "irxnfu", "irys",	/* 6668 */
+	"is", "isbd", "iscjoqteroxs", "iscrphml",	/* 6672 */
+	"isdsrjrexfc", "isdxrxrj", "isgieyf", "isgpdsppngdrfi",	/* 6676 */
+	"isgwach", "ishkmulz", "isijmzmzsfsfmz", "isioigrtxfv",	/* 6680 */
+	"isklkyslztorl", "isklwvhrytmdj", "iskorrije", "islq",	/* 6684 */
+	"islrrhhkndfe", "islvfadwegkozv", "ism", "isopzqljkl",	/* 6688 */
+	"isphhiflonhnql", "issiywzh", "issletia", "isswnaypgnz",	/* 6692 */
+	"isttuxjmbqa", "isu", "isuqqw", "isyeahipytrak",	/* 6696 */
+	"isyvxtqgranc", "iszexc", "it", "itaapwsgbvklqa",	/* 6700 */
+	"itcagdxclitj", "itcuw", "itdibyfnv", "itdp",	/* 6704 */
+	"itdq", "itejdk", "itf", "itfyxchf",	/* 6708 */
+	"itg", "itgxade", "ithkggrg", "itibdrpnkrtzc",	/* 6712 */
+	"itio", "itisxyuggvfa", "itjgqghkiccwq", "itkgm",	/* 6716 */
+	"itlruojqb", "itmghtnnm", "itojebijjzhdx", "itq",	/* 6720 */
+	"itqlufeqlwz", "itqrxlggalakqu", "itr", "itusk",	/* 6724 */
+	"itvskzrcex", "itymqmmnrcgz", "ityygjklhzzz", "itzczojauixqwa",	/* 6728 */
+	"itzjzoifjonom", "itznverxy", "iu", "iuazdnzbdbfkx",	/* 6732 */
+	"iubzq", "iud", "iudqev", "iuemhbhevjfc",	/* 6736 */
+	"iues", "iufrlxxdri", "iuhostqafwgx", "iujdcbwuwe",	/* 6740 */
+	"iukgvnavqo", "iulak", "iuldf", "iulxagtx",	/* 6744 */
+	"iumegzwthczsj", "iumzn", "iuoixsyi", "iuq",	/* 6748 */
+	"iuqj", "ius", "iushc", "iuumqaeohwqo",	/* 6752 */
+	"iuuosaeiidd", "iuupy", "iuvomrfoti", "iuvwkivpb",	/* 6756 */
+	"iuw", "iuwbvbthb", "iuwjowkppdaj", "iuwlts",	/* 6760 */
+	"iuwpupr", "iuxozioyp", "iuzv", "iv",	/* 6764 */
+	"ivbdoqrabuzm", "ivc", "ivdscisy", "ivgnj",	/* 6768 */
+	"ivhyyzgcrkgc", "iviiakmmhnddbd", "ivjczrmdqvn", "ivnbu",	/* 6772 */
+	"ivozzfrlpndygs", "ivpqmvjl", "ivq", "ivqxdbvhwby",	/* 6776 */
+	"ivrsldvwlnq", "ivrxaxvko", "ivsy", "ivtnjiocd",	/* 6780 */
+	"ivvafjfzeivzb", "ivvarvxdyloiyd", "ivvowmeordxgha", "ivvqvid",	/* 6784 */
+	"ivwybkx", "iw", "iwaosftp", "iwbtxligesk",	/* 6788 */
+	"iweiuwhlbr", "iwfdbcbjpbduj", "iwfihxhsgrzak", "iwhb",	/* 6792 */
+	"iwhlzpnzgoqvq", "iwimsht", "iwinvnmm", "iwkkgiwjxuipe",	/* 6796 */
+	"iwkqjb", "iwljbp", "iwlsdwmfkmbwov", "iwmunp",	/* 6800 */
+	"iwnxzpeaog", "iwq", "iwqlapulyxzpc", "iwquiwgdbbd",	/* 6804 */
+	"iwschsdpehokst", "iwsdsi", "iwt", "iwugafnfnpq",	/* 6808 */
+	"iwusmab", "iwwnmncreigt", "iwxxkdmocixf", "iwylusy",	/* 6812 */
+	"iwyn", "iwz", "ix", "ixaovnyp",	/* 6816 */
+	"ixaqw", "ixbekzqon", "ixc", "ixcekost",	/* 6820 */
+	"ixcli", "ixcnqlhdmvuys", "ixcrrnfzd", "ixdogwpxnjolr",	/* 6824 */
+	"ixdqhruddn", "ixdtz", "ixduexqsaispi", "ixevkops",	/* 6828 */
+	"ixewkw", "ixfd", "ixfnyqqo", "ixhq",	/* 6832 */
+	"ixhuzwunxcj", "ixl", "ixljpk", "ixlohjvcctaoy",	/* 6836 */
+	"ixlquyhctptzz", "ixmoylf", "ixnhualrlek", "ixnreni",	/* 6840 */
+	"ixnuwzpzz", "ixommpphafnk", "ixsubyhlryls", "ixtxycifdebgn",	/* 6844 */
+	"ixuhl", "ixvyjfyeyhri", "ixxdzqq", "ixzt",	/* 6848 */
+	"iy", "iyak", "iyaqocmmlzos", "iycvo",	/* 6852 */
+	"iyd", "iydzzir", "iyekn", "iyevn",	/* 6856 */
+	"iyfbcty", "iyfue", "iygalnvg", "iygbjjja",	/* 6860 */
+	"iygxegykmp", "iyhkcimdehpk", "iyjmwqlrwajx", "iykewdhij",	/* 6864 */
+	"iyknq", "iylgv", "iyltcznhtpl", "iyndv",	/* 6868 */
+	"iynhokshkzpkg", "iynomnsokr", "iypswcgg", "iyqpnyobxw",	/* 6872 */
+	"iyriijvelpo", "iys", "iysawytahtpg", "iysehyguukqzs",	/* 6876 */
+	"iytqyeepxaif", "iytwod", "iytzoqzchdrit", "iyurnaxnv",	/* 6880 */
+	"iyvd", "iyvp", "iyvylplkp", "iywqltvftyumul",	/* 6884 */
+	"iyx", "iyxc", "iyxlvp", "iyzecgyf",	/* 6888 */
+	"iyzjq", "iyzwjg", "izaaenqovcts", "izamkade",	/* 6892 */
+	"izautyd", "izbfqily", "izbjbpzamc", "izcehuclh",	/* 6896 */
+	"izcxqbqsalwgee", "izexjzvilz", "izfkpawtomxenr", "izfliboqeyp",	/* 6900 */
+	"izfmnnp", "iziesnlkmmcnp", "izitgh", "izkwshgha",	/* 6904 */
+	"izlvcijyyeinpa", "izmcfukhc", "iznajjhxkin", "izno",	/* 6908 */
+	"izobd", "izpcrdowsmygdq", "izq", "iztuhdru",	/* 6912 */
+	"izusp", "izwnvrj", "izwzcd", "ja",	/* 6916 */
+	"jab", "jacynvzaimgn", "jadfnq", "jaf",	/* 6920 */
+	"jafgkzsz", "jafjyc", "jagipydrtimp", "jahqp",	/* 6924 */
+	"jahtywcmbu", "jahu", "jaigywjumvrand", "jalpaytzhhbrv",	/* 6928 */
+	"jamdaarznwnb", "jaqjopnyknqgyc", "jarx", "jas",	/* 6932 */
+	"jaugeao", "jauoanad", "javfsgycz", "javinoi",	/* 6936 */
+	"jawyt", "jaxjvdj", "jaycjbxrhf", "jayfontwdx",	/* 6940 */
+	"jayi", "jayvfd", "jb", "jbbzaq",	/* 6944 */
+	"jbcgkenrmrgv", "jbchpksvalyg", "jbczuswhlvn", "jbdsb",	/* 6948 */
+	"jbdszbwsrp", "jbelj", "jbextqvdgjgg", "jbeyob",	/* 6952 */
+	"jbgusbbjxy", "jbjnsjljk", "jbktniviohp", "jbkwlco",	/* 6956 */
+	"jbliz", "jbmftugr", "jbmuneqjwdunp", "jbndpic",	/* 6960 */
+	"jbnqcbg", "jbqgvjkdkcvv", "jbsb", "jbslqamvdaas",	/* 6964 */
+	"jbt", "jbthajql", "jbtqkjbpcfx", "jbtwodxiswfap",	/* 6968 */
+	"jbuimrnvelv", "jbuj", "jbuztnj", "jbvgcys",	/* 6972 */
+	"jbwnyfywuuvaov", "jbx", "jbxlglbehbhxy", "jbys",	/* 6976 */
+	"jbzvgbsbtfrmk", "jc", "jcawsxa", "jcbiscrisj",	/* 6980 */
+	"jcdjgmabluguu", "jcdmqjjxqhkab", "jcdwggduqsuzqm", "jceeclkpqqm",	/* 6984 */
+	"jcffiqf", "jcfftyfvjjb", "jcfplivfndou", "jcghrh",	/* 6988 */
+	"jcgovcm", "jcidqw", "jcisrihrvwqdhi", "jcitosuydk",	/* 6992 */
+	"jciwrca", "jcjtedfutq", "jckgcdpts", "jclijmhgbkq",	/* 6996 */
+	"jcljnkxxuzgn", "jclyyqrbksb", "jcnafiusfr", "jcpixxjxhqqwhr",	/* 7000 */
+	"jcqernasumkm", "jcqkjzddxlsmof", "jcrbnweo", "jcrpdwvjrbb",	/* 7004 */
+	"jcrptlk", "jcu", "jcyczdiky", "jcyv",	/* 7008 */
+	"jd", "jdbibztppbg", "jdccdvbbkvxn", "jdd",	/* 7012 */
+	"jddhfxggguzo", "jdfxoaupbuswek", "jdg", "jdhcjtphnp",	/* 7016 */
+	"jdhqmc", "jdicd", "jdiiufobsca", "jdior",	/* 7020 */
+	"jdjanuocd", "jdjgle", "jdkdsspdzacna", "jdkmfsiy",	/* 7024 */
+	"jdkpc", "jdllhpvjgmdwr", "jdm", "jdnam",	/* 7028 */
+	"jdnazlcznedrz", "jdnci", "jdnhqrgkkqzm", "jdo",	/* 7032 */
+	"jdoptcuxyym", "jdoumkkmpfcyi", "jdr", "jdrbkmvp",	/* 7036 */
+	"jdrgrqnnvukdhb", "jdtflfocjkkc", "jdtplnqtmplb", "jdupw",	/* 7040 */
+	"jduravftxsmiuy", "jduurrotsulif", "jdxjrempncxq", "jdylkb",	/* 7044 */
+	"je", "jeabvzsigqrq", "jeadxbutkll", "jeahkyqpee",	/* 7048 */
+	"jeaiwjvpe", "jeavofms", "jedbss", "jedfvvr",	/* 7052 */
+	"jeegtgpvrn", "jeeoiykddgjjf", "jefeqlm", "jefj",	/* 7056 */
+	"jehcvdlhatdrok", "jehhtyxqntx", "jehkptu", "jehlofubsm",	/* 7060 */
+	"jeixodpmjdxpl", "jejrleyj", "jejtn", "jekchmbgx",	/* 7064 */
+	"jekgr", "jemktntapcumqk", "jemol", "jemoqke",	/* 7068 */
+	"jenh", "jenjflvbh", "jeqfs", "jeqjxpw",	/* 7072 */
+	"jeqoseryf", "jeqyltlpe", "jes", "jetpq",	/* 7076 */
+	"jewexjq", "jewlyzfl", "jexddnauztqgz", "jeywqsvd",	/* 7080 */
+	"jeyzdotzwvuw", "jf", "jfarkjxjoayiza", "jfbahoi",	/* 7084 */
+	"jfbehjhjhwn", "jfbwpol", "jfc", "jfdapusw",	/* 7088 */
+	"jfeb", "jfeqmvfg", "jffjyibuihv", "jffom",	/* 7092 */
+	"jfikdmdalcla", "jfjiuusnji", "jfkhtqtqtfunpw", "jflvccrsauayh",	/* 7096 */
+	"jfndalcbvga", "jfngnnemy", "jfnwp", "jfoddopbfyj",	/* 7100 */
+	"jfpiontqsqa", "jfpjrcgdfs", "jfpmykqpvny", "jfrca",	/* 7104 */
+	"jfs", "jfsdygoqit", "jftqwhkofmz", "jfuimidiadvzd",	/* 7108 */
+	"jfumba", "jfxbs", "jfxwkemu", "jfyuh",	/* 7112 */
+	"jg", "jgagslkups", "jgbjpf", "jgbjvve",	/* 7116 */
+	"jgbkogj", "jghvzz", "jgiznohann", "jgklim",	/* 7120 */
+	"jgmebj", "jgmnnhdgfy", "jgmnosugczsxt", "jgo",	/* 7124 */
+	"jgopjm", "jgp", "jgqopncsbdjm", "jgr",	/* 7128 */
+	"jgrai", "jgrc", "jgrokpebvrawuh", "jgskxsawpqy",	/* 7132 */
+	"jgu", "jguovhoy", "jgxkyepkqwfuu", "jgxnmyzc",	/* 7136 */
+	"jgyxxhmavmuler", "jh", "jhag", "jhclxkn",	/* 7140 */
+	"jhctl", "jhitl", "jhizekpm", "jhjnmehjgrayem",	/* 7144 */
+	"jhkbiifwh", "jhlqgyx", "jhmxw", "jhnukbgjpqu",	/* 7148 */
+	"jhoifamvo", "jhoixfwmbr", "jhoj", "jhpvxalamursu",	/* 7152 */
+	"jhqfznk", "jhrllks", "jhsesktnvx", "jhsigzjoivbxe",	/* 7156 */
+	"jhslipcnlxxju", "jhucb", "jhuyyyst", "jhyjib",	/* 7160 */
+	"jhzgfjbeean", "jhzhe", "jhzogjmvpdde", "ji",	/* 7164 */
+	"jiaj", "jibnghsef", "jieutelq", "jifilbnenypc",	/* 7168 */
+	"jifrncyyg", "jigyazvyqn", "jihm", "jiibvsygmohrw",	/* 7172 */
+	"jikwpmqubnz", "jil", "jilk", "jilohswbxhugzz",	/* 7176 */
+	"jiluyhv", "jimkdmyvuljwfl", "jimuerhqdxny", "jinai",	/* 7180 */
+	"jio", "jioaickede", "jiobuxzmw", "jiofm",	/* 7184 */
+	"jipcfmtg", "jiqwuhn", "jisksmi", "jisq",	/* 7188 */
+	"jiwewfw", "jiynogici", "jiyxgf", "jjacr",	/* 7192 */
+	"jjchswgysksv", "jjcmhphk", "jjeurmbdg", "jjfb",	/* 7196 */
+	"jjgevq", "jjhwykiljncl", "jjkdmmipawnzxv", "jjkel",	/* 7200 */
+	"jjkfqoima", "jjlchapulxuo", "jjlyqadhpeyb", "jjmdhd",	/* 7204 */
+	"jjmlwvaje", "jjnbook", "jjnrrw", "jjqbslzvyerukr",	/* 7208 */
+	"jjqpflzcy", "jjrdjthlubgj", "jjsur", "jjtgzqmi",	/* 7212 */
+	"jjukdilbpddv", "jjuwadfwmzts", "jjv", "jjvorrxyzrva",	/* 7216 */
+	"jjvyg", "jjw", "jjwns", "jjx",	/* 7220 */
+	"jjxmwucoduksx", "jjxrnrzbnvs", "jjxwuogjfx", "jjyl",	/* 7224 */
+	"jjyrstufot", "jk", "jkavpct", "jkchzzbrfzpgim",	/* 7228 */
+	"jkcmndf", "jkcx", "jkdfypnpvt", "jkdprjqsfbc",	/* 7232 */
+	"jkeoxic", "jkey", "jkezxwpjvqpm", "jkfoqje",	/* 7236 */
+	"jkhqhb", "jkicdhxiwulg", "jkjhrp", "jkjjwuvctkn",	/* 7240 */
+	"jkjvnpsfgsyr", "jkllmbqdkxci", "jkmumpge", "jkmyt",	/* 7244 */
+	"jknwommx", "jkp", "jkpkdftspjfyi", "jkqsyescglpxv",	/* 7248 */
+	"jkuishlynvex", "jkvwi", "jkwrs", "jkye",	/* 7252 */
+	"jkyzeaqfgmwdna", "jkz", "jl", "jlaqyapof",	/* 7256 */
+	"jlasg", "jlbobynyoo", "jlcilelkno", "jlcxphpmgybgv",	/* 7260 */
+	"jld", "jldckaggxlqam", "jldi", "jldxg",	/* 7264 */
+	"jlezo", "jlf", "jlftzquvvkkixo", "jlhbvzgd",	/* 7268 */
+	"jlhpdabx", "jlhu", "jllzu", "jlnckwbnyqsy",	/* 7272 */
+	"jlotqa", "jlpdu", "jlppl", "jlqqtfknnjjb",	/* 7276 */
+	"jlu", "jlwmap", "jlyvitiqm", "jlza",	/* 7280 */
+	"jlztckfotypbo", "jmanlywdztkx", "jmarivkno", "jmartv",	/* 7284 */
+	"jmbza", "jmc", "jmcjoqvreyfv", "jmcmfxasq",	/* 7288 */
+	"jmcvggpjgcvsu", "jmjaqwt", "jmjzwz", "jmkcnagke",	/* 7292 */
+	"jmkpdkzwk", "jmkvbtvmb", "jmnsifgbp", "jmnuhakfvcz",	/* 7296 */
+	"jmphvevirhd", "jmqdkmcchopx", "jmsdjcnzkd", "jmsminkawxnzo",	/* 7300 */
+	"jmts", "jmuyaqsvfdrm", "jmwekj", "jmwutnv",	/* 7304 */
+	"jmwyppwe", "jmxkr", "jmzeru", "jmzzmvmywucjf",	/* 7308 */
+	"jn", "jna", "jnashnilg", "jnbsoutm",	/* 7312 */
+	"jncvvgxizut", "jncxoiogfmtpfa", "jndynqqv", "jndzsnxzro",	/* 7316 */
+	"jneoicbqqdy", "jnf", "jngmu", "jngxx",	/* 7320 */
+	"jnjp", "jnjubcanf", "jnn", "jnnjkwzupo",	/* 7324 */
+	"jnq", "jnqfr", "jnsdgcd", "jnuhdrjc",	/* 7328 */
+	"jnuuwvkpocohx", "jnuxbvydqk", "jnuzje", "jnwdhrxliwad",	/* 7332 */
+	"jnwoqdmiikmhhv", "jnwwnutqk", "jnxmololyyswj", "jnytodk",	/* 7336 */
+	"jnzbcdgteoafg", "jnzcufjwuo", "jnzqfcbo", "jo",	/* 7340 */
+	"jocioasbybdv", "jocv", "joevqpley", "jogxclqutrc",	/* 7344 */
+	"jolrwnghnjvexr", "jonhwhbhdoygh", "jonrujshvsaq", "jonvawnpo",	/* 7348 */
+	"jooborn", "joouo", "joowrs", "jooyeckixw",	/* 7352 */
+	"jophqhelijo", "jopuylv", "jorhmav", "jotzfrrui",	/* 7356 */
+	"jovjinqohl", "jovlfoke", "jpbj", "jpbwbknjxrs",	/* 7360 */
+	"jpccr", "jpcevcdvu", "jpcuhmgcxipyog", "jpdckj",	/* 7364 */
+	"jpeijtebfhb", "jpexqzjykpj", "jpfiajh", "jpgln",	/* 7368 */
+	"jpjgjvrdepp", "jplfrpqalvu", "jplhnxsh", "jplt",	/* 7372 */
+	"jpmhhm", "jpnm", "jpnvlmoonczsj", "jppllxpeh",	/* 7376 */
+	"jppnl", "jpqrdznkxefti", "jpr", "jprcqeaucgtt",	/* 7380 */
+	"jpuvsqve", "jpuzrgzytk", "jpxjsjgmhgyd", "jpxotenzo",	/* 7384 */
+	"jpyausbc", "jq", "jqaawlmqsouopd", "jqasigrq",	/* 7388 */
+	"jqcj", "jqdm", "jqfepkzbkyohzn", "jqfk",	/* 7392 */
+	"jqgcsidq", "jqhgj", "jqib", "jqiektbi",	/* 7396 */
+	"jqjdusidfvotye", "jqkdttgg", "jqlgerujr", "jqnbgsqqzcd",	/* 7400 */
+	"jqnrqntusj", "jqnuzaczepxrla", "jqpu", "jqpvxhxxsdn",	/* 7404 */
+	"jqthqkict", "jquqcdifhayde", "jqvjchtwhfwrqp", "jqvvmyrwvgj",	/* 7408 */
+	"jqxoxvfzts", "jqyieg", "jqz", "jqzrpnui",	/* 7412 */
+	"jr", "jra", "jraudazomspu", "jrdbcgdxxnaw",	/* 7416 */
+	"jrdlozgyqw", "jregyzwso", "jrelyhcnfyos", "jrexyhodxen",	/* 7420 */
+	"jrhzijerzfyt", "jrkp", "jrlfbwnhokvxkb", "jrlpjefxolzki",	/* 7424 */
+	"jrntgukzwfbp", "jrntylxhqoq", "jrp", "jrpswdrljx",	/* 7428 */
+	"jrqalvdpzetzjr", "jrqtersnxdkh", "jrruymzt", "jrs",	/* 7432 */
+	"jrsd", "jrsdp", "jrsja", "jrtak",	/* 7436 */
+	"jrtnletza", "jrtxhle", "jruaxir", "jruqbwhv",	/* 7440 */
+	"jruysosrkbm", "jrvusqwtbqbgf", "jrwtson", "jry",	/* 7444 */
+	"js", "jsamaukaldps", "jse", "jsepclosmbywhx",	/* 7448 */
+	"jsf", "jshqfda", "jshtyszcqimmn", "jskxmogqzxjoe",	/* 7452 */
+	"jskygwqgflim", "jskzfmip", "jsmftdiiq", "jsnn",	/* 7456 */
+	"jsnsti", "jso", "jsosxjoezy", "jspnqq",	/* 7460 */
+	"jsq", "jsqapg", "jsrghrozdecm", "jsrlmxzegyb",	/* 7464 */
+	"jsrnhaczipra", "jstn", "jstw", "jsutixc",	/* 7468 */
+	"jsve", "jsvisr", "jswfore", "jsxi",	/* 7472 */
+	"jsxpzdiuo", "jt", "jtauf", "jtbkspu",	/* 7476 */
+	"jtbn", "jtcoelcntsw", "jtdyvydabh", "jtf",	/* 7480 */
+	"jtfnjpjunlz", "jtgpfc", "jthkclvxmgsx", "jtio",	/* 7484 */
+	"jtjlyatzttucyt", "jtmv", "jtmvokuqdolbf", "jtnnovamenqi",	/* 7488 */
+	"jtodafy", "jtpzaognne", "jtqh", "jtqoiu",	/* 7492 */
+	"jtqoxxc", "jtrls", "jtttaphqgs", "jtutfigk",	/* 7496 */
+	"jtvf", "jtwo", "jtwwwiakyy", "jtz",	/* 7500 */
+	"ju", "judlngsbqhwhiv", "judwxwzlzpvhe", "juffrooshxcy",	/* 7504 */
+	"jufogifrjxma", "juhslh", "juinypyhxmkyut", "jujjiqibvoqi",	/* 7508 */
+	"julasknlip", "juloojm", "junpcuatxpq", "juqkqyllpn",	/* 7512 */
+	"juqkrygs", "juqmmq", "juqukrqxr", "jurhcpzegdju",	/* 7516 */
+	"jusffpy", "jusxmgobvp", "juulsa", "juuxr",	/* 7520 */
+	"juwfeha", "juymqkfnvo", "juzcc", "juzhrzzbmlz",	/* 7524 */
+	"jv", "jvadgzuae", "jvakmge", "jvbfa",	/* 7528 */
+	"jvcglmmx", "jvcrwncc", "jvdrufdvol", "jvfjcurdu",	/* 7532 */
+	"jvfmbanbjx", "jvhchqzzjqttn", "jvhhxney", "jvhr",	/* 7536 */
+	"jvidenirniah", "jviu", "jvjappjlr", "jvje",	/* 7540 */
+	"jvkiwnlaaaqq", "jvlpwaxnryja", "jvm", "jvmdfxipsdebk",	/* 7544 */
+	"jvmzarbnxqogt", "jvnbjh", "jvngvtmuca", "jvnsht",	/* 7548 */
+	"jvpgqsji", "jvqfvd", "jvrudesaa", "jvszj",	/* 7552 */
+	"jvtmczpvs", "jvttwddont", "jvvcddq", "jvxfbuoporj",	/* 7556 */
+	"jvylha", "jvyvacca", "jvzzegewd", "jw",	/* 7560 */
+	"jwadtqbftyhyro", "jwbgigwincgnx", "jwc", "jwcfoq",	/* 7564 */
+	"jwebq", "jwegcrvwnyijb", "jwhbeimkfg", "jwhvytk",	/* 7568 */
+	"jwithdwfivm", "jwk", "jwktrwxgaw", "jwnrbvxvedyf",	/* 7572 */
+	"jwnyrzukhz", "jwolznfi", "jwovaep", "jwqkgghxhm",	/* 7576 */
+	"jwrmclc", "jwsvplhhvooihc", "jwufmvkta", "jwvgn",	/* 7580 */
+	"jwvmkotueu", "jwxyfkp", "jwywxl", "jwzlaxsagutxaj",	/* 7584 */
+	"jx", "jxatstdrq", "jxautyp", "jxavqnmeuwoshv",	/* 7588 */
+	"jxdmskgkwr", "jxeeupryistmit", "jxghrbjn", "jxgnxwabimedkr",	/* 7592 */
+	"jxigeirecz", "jxjwpjgneh", "jxlpzbmmn", "jxlxhwkj",	/* 7596 */
+	"jxmcsnevwq", "jxmkmvoplsmls", "jxno", "jxnsp",	/* 7600 */
+	"jxoivim", "jxoswwvhdz", "jxphx", "jxpvwxlnvef",	/* 7604 */
+	"jxqqlx", "jxqxmuvb", "jxsaoypvd", "jxsbwepr",	/* 7608 */
+	"jxsftptbekw", "jxsimd", "jxsplra", "jxtkomkmccktod",	/* 7612 */
+	"jxuh", "jxvsahgj", "jxwbwmi", "jxxhivkrih",	/* 7616 */
+	"jxygltb", "jxytdukc", "jxzpsl", "jy",	/* 7620 */
+	"jyapzzg", "jybklofkmxmsr", "jydcbrxbnh", "jydiq",	/* 7624 */
+	"jydwqq", "jyedeexwwvjq", "jyf", "jyfii",	/* 7628 */
+	"jygmleedy", "jygqweei", "jygssaibvbbzj", "jyiyxzxmwvefc",	/* 7632 */
+	"jyjjo", "jyjoouuhvppyc", "jykfgqxwi", "jykkvlqlzdg",	/* 7636 */
+	"jykwxw", "jymhdwg", "jyni", "jynrz",	/* 7640 */
+	"jyoohgsz", "jyoyptinnh", "jypejbush", "jyqhkv",	/* 7644 */
+	"jyshgpco", "jyumm", "jywduf", "jywnj",	/* 7648 */
+	"jywpgvh", "jywvjc", "jyycnsjdlk", "jyzgfrehgc",	/* 7652 */
+	"jyzk", "jz", "jzadlhqagk", "jzcckdlx",	/* 7656 */
+	"jzdfngc", "jzfblkmlg", "jzgnrszghicnm", "jzgufd",	/* 7660 */
+	"jzhdwoy", "jzhiqfmjrtdpyf", "jzifgam", "jzikpqejuzbaq",	/* 7664 */
+	"jziofxwcuemg", "jzkggl", "jzlq", "jzofrheupnbspf",	/* 7668 */
+	"jzonsfxh", "jzpigefnxcdwlt", "jzpnrjordc", "jzqz",	/* 7672 */
+	"jzsf", "jzt", "jzuyguyunjcjvd", "jzvxslpkldfipd",	/* 7676 */
+	"jzvxyjoozlvvb", "jzvzrqr", "jzwlyo", "jzwwcd",	/* 7680 */
+	"jzxtionth", "jzybgn", "jzz", "ka",	/* 7684 */
+	"kacgmhs", "kacvhve", "kaddtfdma", "kaeuktj",	/* 7688 */
+	"kaf", "kaffoan", "kahgim", "kaifmtqjehher",	/* 7692 */
+	"kajcwe", "kakvhefyribj", "kalqcwe", "kaocqzy",	/* 7696 */
+	"kaoesuqefw", "kaokhhlxwbao", "kaopmuhztd", "kaoujfdhnm",	/* 7700 */
+	"kapfgvvuvfneo", "kapszhyr", "kar", "katyricwg",	/* 7704 */
+	"kauxexefemetqu", "kavebezvur", "kaw", "kawlxedbgr",	/* 7708 */
+	"kaxhwelkbdape", "kaybqdscf", "kb", "kbbgfpsihfcoki",	/* 7712 */
+	"kbceeh", "kbctmwkh", "kbd", "kbfbdqgfsha",	/* 7716 */
+	"kbfgxvnrdwwvqf", "kbhhrendrcynnq", "kbibayjn", "kblehuoxcfxm",	/* 7720 */
+	"kblpabuifkj", "kbmvkbxe", "kbnlofagnlr", "kbotqlwjs",	/* 7724 */
+	"kbphz", "kbrgngxeipl", "kbs", "kbsjqybmxel",	/* 7728 */
+	"kbsoiqxqxjqg", "kbsygzyvdvueh", "kbwcsnvio", "kbwuarut",	/* 7732 */
+	"kbxop", "kbyn", "kc", "kccihx",	/* 7736 */
+	"kccprfovn", "kcedpvxswpb", "kcegsrywyvzgv", "kcepaxc",	/* 7740 */
+	"kcftdszng", "kcgm", "kcgulg", "kcjvefa",	/* 7744 */
+	"kckmcgk", "kcns", "kcovyx", "kcowbxgzb",	/* 7748 */
+	"kcplkdyfh", "kcqr", "kcrpylzfxq", "kcsunijysc",	/* 7752 */
+	"kcszsyepycyyv", "kcszynprpgo", "kctqmhkkavvp", "kcu",	/* 7756 */
+	"kcuwvvwkpasruk", "kcvabb", "kcwzmnu", "kcz",	/* 7760 */
+	"kczdvtklcrptgn", "kd", "kdaxu", "kdbhjvhrqgavwj",	/* 7764 */
+	"kdchttlhgjwt", "kdcn", "kddhau", "kddrokoggd",	/* 7768 */
+	"kdeqhpqtfuesky", "kdingznfoqashk", "kdjsgvtfk", "kdnmd",	/* 7772 */
+	"kdowsqwu", "kdssv", "kdtcft", "kdtrzkmn",	/* 7776 */
+	"kdunfkzekh", "kduusquychft", "kduyeefnc", "kdv",	/* 7780 */
+	"kdzlyoygxsa", "ke", "keadnfanoqf", "keafjkp",	/* 7784 */
+	"keahqjrxfcdryx", "kealhtlqnwhqc", "kebdod", "kecwzibyu",	/* 7788 */
+	"keddxp", "kefbslwgz", "kehcikxkgyn", "keiiilm",	/* 7792 */
+	"kekuqlol", "keldtdhqqnda", "kenju", "kennqb",	/* 7796 */
+	"keplinda", "keppmisr", "kepwaenumq", "keqorqlt",	/* 7800 */
+	"keqykf", "ker", "kexa", "kexdbco",	/* 7804 */
+	"kexvaoutgbtzb", "keyaautomk", "kezdl", "kezrly",	/* 7808 */
+	"kf", "kfcdo", "kfcnapuaom", "kfdnpidmyhnhv",	/* 7812 */
+	"kffnopaxixzg", "kfg", "kfgoibzxptien", "kfhgcyqhwgde",	/* 7816 */
+	"kfhvvx", "kfiflv", "kfklkfi", "kfldbosuwn",	/* 7820 */
+	"kflmfdlxg", "kflwrprzabx", "kfmjw", "kfmoakhiuxvvm",	/* 7824 */
+	"kfncgyymjsx", "kfnscopfdi", "kfnvwz", "kfnxhyv",	/* 7828 */
+	"kfovacyagmh", "kfqcfbcutpfjil", "kfqkxhrbcub", "kfqpmp",	/* 7832 */
+	"kfscekvyov", "kfvgncmwl", "kfvorxfsizoztp", "kfwayjhpewego",	/* 7836 */
+	"kfwgagdwuzagxf", "kfwnyxz", "kfximt", "kfxxjmdzjnnsu",	/* 7840 */
+	"kfzaek", "kfzmcbjepu", "kg", "kgajcgrtbftk",	/* 7844 */
+	"kgawwbhjhp", "kgbjdcacpzkjxp", "kgbr", "kgd",	/* 7848 */
+	"kgdumkbt", "kggdngiu", "kggf", "kgidyljzvjgw",	/* 7852 */
+	"kgionywdqkvbb", "kgjfhjksvq", "kgjkihj", "kgjzjauvwqci",	/* 7856 */
+	"kglvynvuvdop", "kgomrfhglwfvvr", "kgptkissnz", "kgqfbspatfpeb",	/* 7860 */
+	"kgqffifxezcy", "kgquayex", "kgrxkeremwjb", "kgsqmgys",	/* 7864 */
+	"kgtt", "kgumtg", "kgvcjvgzvjqoiq", "kgwbmkr",	/* 7868 */
+	"kgxdt", "kgxgpkaz", "kgxyd", "kgzujfihlckidx",	/* 7872 */
+	"kh", "khb", "khci", "khctdczazz",	/* 7876 */
+	"khesvhjjhz", "khetyyqvqrmn", "khfbzbemltsyus", "khfmkkajrvtn",	/* 7880 */
+	"khfxoylq", "khhdrwzrpj", "khiyrq", "khjvyqlda",	/* 7884 */
+	"khkpvvc", "khlgekl", "khpkizmqrf", "khpw",	/* 7888 */
+	"khqgooekbn", "khsdqbidnpe", "khskxhrdlmxd", "khuwqwzvj",	/* 7892 */
+	"khygmmiekh", "khyskgntrlkx", "khz", "khzozolr",	/* 7896 */
+	"ki", "kiawmmthuunve", "kibgw", "kid",	/* 7900 */
+	"kidr", "kidrm", "kifgugcqox", "kiggfrlxsk",	/* 7904 */
+	"kihufdihvdg", "kiijp", "kiiqvunqswztl", "kij",	/* 7908 */
+	"kikgwtrlhrh", "kiklmuf", "kilyhlwi", "kimvafngtet",	/* 7912 */
+	"kioghrbnpi", "kip", "kippb", "kiqfbskp",	/* 7916 */
+	"kiqitet", "kisdoppsbdk", "kissvz", "kit",	/* 7920 */
+	"kiusgypreo", "kiylg", "kiynm", "kiyqsnqkhh",	/* 7924 */
+	"kizhad", "kizsjwollfea", "kizx", "kjcpukygtbco",	/* 7928 */
+	"kjdw", "kjecdiixzzclh", "kjhta", "kjhxgvrl",	/* 7932 */
+	"kjibisxqj", "kjknvaxvjo", "kjmbwylso", "kjmclgpcc",	/* 7936 */
+	"kjmwes", "kjodfbhojxlnbg", "kjphldtpjfpzu", "kjrrabaxuywhzn",	/* 7940 */
+	"kjsjpxlwanb", "kjthzjtmkchkr", "kjujle", "kjxabetn",	/* 7944 */
+	"kjxhx", "kjxsjnj", "kjzwe", "kk",	/* 7948 */
+	"kkdnp", "kkftjynbjjvvmu", "kkgbbawftokwb", "kkgkaxutay",	/* 7952 */
+	"kkgyd", "kkh", "kkia", "kkkytpvresna",	/* 7956 */
+	"kkmmqbnq", "kkmp", "kkmpftmyxiq", "kknuvvfm",	/* 7960 */
+	"kkop", "kkphosuvi", "kkpvrukxsk", "kkpxcdz",	/* 7964 */
+	"kkpydymo", "kkqkzpovrrxaoj", "kkrpihcgziefzv", "kkryz",	/* 7968 */
+	"kku", "kkxvfnfjrnwnl", "kl", "klaoeustbcjbuu",	/* 7972 */
+	"klbdumwzn", "klbo", "klbxygxilhx", "klc",	/* 7976 */
+	"klcbifarep", "klegikkrou", "klge", "klgyhqtjsrdf",	/* 7980 */
+	"klizanmxb", "kljdmwduuo", "klmbbgfrere", "klmunssjazrewn",	/* 7984 */
+	"klnilu", "klompytcgkv", "klqfzqnykbw", "klrxdzttqerbo",	/* 7988 */
+	"kltoipcbfv", "kltuwr", "kltwmvauisdga", "klv",	/* 7992 */
+	"klvzgkua", "klwf", "klxkuhwfvbha", "klxmpzbb",	/* 7996 */
+	"klxokn", "klyckdyrh", "klzpayykitoh", "km",	/* 8000 */
+	"kmaxtpkwth", "kmcc", "kmcpeulqhw", "kmdgyri",	/* 8004 */
+	"kmdhdkrwzp", "kmdhxmnomtjweg", "kmdtoglkbldjx", "kmgsecgukmoce",	/* 8008 */
+	"kmgviobvadtlia", "kmhpcgp", "kmijs", "kmjvjqfhgws",	/* 8012 */
+	"kmlglnea", "kmlmtqit", "kmlzduwcvrma", "kmmanjlwnasy",	/* 8016 */
+	"kmmefo", "kmoly", "kmomlwddc", "kmopplxuf",	/* 8020 */
+	"kmpeq", "kmpleknrwrgd", "kmpx", "kmpxcivve",	/* 8024 */
+	"kmqgetsv", "kmrvrlohmfh", "kmsfprokto", "kmtpp",	/* 8028 */
+	"kmucgtf", "kmuczne", "kmufvtrmszmatc", "kmuli",	/* 8032 */
+	"kmvlaccbb", "kmw", "kmwd", "kmxpmkasrly",	/* 8036 */
+	"kmyecwjwjf", "kmygka", "kmylf", "kmyz",	/* 8040 */
+	"kmzb", "kn", "knaidhbjos", "knbqemvjoe",	/* 8044 */
+	"kncnvlwfkenmha", "knenyuqf", "knes", "knffjapn",	/* 8048 */
+	"kngi", "kngrd", "kngweupgnhgf", "knh",	/* 8052 */
+	"knifhomtaynymh", "kninlvhcozhui", "knjklikxxq", "knkalzdckue",	/* 8056 */
+	"knkiap", "knlkcdsxhjpin", "knmjr", "knnfwoincjzcyb",	/* 8060 */
+	"knrukxtdgx", "knryqvixjq", "knsddwsyl", "kntmjrawmgd",	/* 8064 */
+	"knukecaiwtfwvh", "knutg", "knuvmln", "knvgmg",	/* 8068 */
+	"knvsshkq", "knwoyomefdx", "knxciyxvrrd", "knyhzigc",	/* 8072 */
+	"knzgidix", "ko", "koa", "koafatxmk",	/* 8076 */
+	"koailmr", "koamhejrtenzml", "koaztrizom", "kobhqdcrpph",	/* 8080 */
+	"kocpgycis", "kocwsd", "kodkbzw", "kodrrlzaccoqx",	/* 8084 */
+	"koegwvegmrvjs", "kofrbxmwgdreiz", "kofrwgak", "kofxwiopdpxozh",	/* 8088 */
+	"kohqz", "kohrx", "kohzijhqkqo", "kokevcrhj",	/* 8092 */
+	"kolzkwxftqduiv", "kom", "komh", "kommwxabqi",	/* 8096 */
+	"kondxbhteogmh", "konliti", "kopfllqpih", "kora",	/* 8100 */
+	"korywgbxtpy", "kosizbk", "kotlvlljywtjw", "kotrjfgq",	/* 8104 */
+	"kottsbrjtbj", "kou", "koupsmqxudzqa", "kovlulxru",	/* 8108 */
+	"kowkqhczrxpztv", "koxn", "koxxyog", "koy",	/* 8112 */
+	"koydpfscl", "koylayfbqvdnen", "kozkklxr", "kozpwrqzdcrzoz",	/* 8116 */
+	"kozsyzrzvi", "kpa", "kpaot", "kpaozdya",	/* 8120 */
+	"kpaxcajpkj", "kpelru", "kpjia", "kpmoeehazprib",	/* 8124 */
+	"kpnlefphy", "kpod", "kppo", "kppqrs",	/* 8128 */
+	"kpqq", "kpqvpo", "kprq", "kprs",	/* 8132 */
+	"kprtusoibv", "kpsstp", "kptarh", "kptdhfrw",	/* 8136 */
+	"kptefmekzfvms", "kpukfsjb", "kpulldfngc", "kpvvjzx",	/* 8140 */
+	"kpwhgfdbf", "kpxg", "kpzvvwcwg", "kq",	/* 8144 */
+	"kqceidqlhvkmdd", "kqcj", "kqctqw", "kqdfhn",	/* 8148 */
+	"kqdpfzjqmo", "kqenpekktng", "kqfwqbp", "kqgpoenldtif",	/* 8152 */
+	"kqia", "kqjcm", "kqjnmnnesj", "kqkpyciporn",	/* 8156 */
+	"kqmshsjgzhi", "kqowzhfdbe", "kqpwmiiadiz", "kqqmuhhub",	/* 8160 */
+	"kqrjlsenxdl", "kqsxdgwbg", "kqtassn", "kquxsjdbovynvk",	/* 8164 */
+	"kqvhewekju", "kqwima", "kqwixirpwd", "kqxctbznotmz",	/* 8168 */
+	"kqxehjr", "krbllqokqg", "krcdam", "krcmij",	/* 8172 */
+	"krfunyjedwtzu", "krfvkddefmdian", "krglbr", "krhssmuwbdkav",	/* 8176 */
+	"kricgisd", "kridagvuvonzcu", "krjbplhkz", "krjoltptnr",	/* 8180 */
+	"krkpylwuuomqwf", "krlcuwvqknr", "krlwmtf", "krlzz",	/* 8184 */
+	"krm", "krmdtwh", "krnafma", "krobgqtiljpx",	/* 8188 */
+	"kroniasbdu", "krpwckqm", "krsgy", "krsqb",	/* 8192 */
+	"krthxcd", "krtlpm", "krumekvu", "krutomzozjalex",	/* 8196 */
+	"krxrpyw", "krzmbwymmgh", "ks", "ksaajmdduw",	/* 8200 */
+	"ksagmashbdxks", "ksakluwtwtpkx", "ksakzw", "kscbht",	/* 8204 */
+	"ksftwfzu", "ksfwuapulmki", "ksgfaziumlxiua", "kshazhcqfujjp",	/* 8208 */
+	"ksjc", "kskcdnaplot", "kskczst", "kskyg",	/* 8212 */
+	"ksllnewdd", "kslxb", "ksm", "ksnd",	/* 8216 */
+	"ksoivblgocji", "ksoovodauynr", "kspiyuy", "ksqloxgnbxa",	/* 8220 */
+	"ksqrnfzaxmmmin", "kstobfqmjvr", "ksuecr", "ksuocibeuhqw",	/* 8224 */
+	"ksvkru", "kswghmwapwvje", "kswlriocqd", "ksxbqoewqlsbld",	/* 8228 */
+	"ksxbzxtskre", "kt", "ktboipvdlj", "ktcbyqtuvjg",	/* 8232 */
+	"ktcsm", "ktcyxf", "ktdoc", "ktdvxibi",	/* 8236 */
+	"ktfcgx", "ktiv", "ktjvg", "ktjzkgurmio",	/* 8240 */
+	"ktkm", "ktngiwsuocf", "ktoyxmrn", "ktpkseexvzcjal",	/* 8244 */
+	"ktqdar", "ktqilkkdjhtywp", "ktqlkthm", "ktqnjbpj",	/* 8248 */
+	"ktqnlkty", "ktqshupgglj", "ktrgqld", "ktst",	/* 8252 */
+	"kttjcu", "ktvonhxlopp", "ktvy", "ktwmhusa",	/* 8256 */
+	"ktxgmutlsms", "ktybknalllttvn", "ktyf", "ktz",	/* 8260 */
+	"ktzeomjayy", "ku", "kua", "kubhulslsdvik",	/* 8264 */
+	"kubj", "kubtmwewmsjnb", "kud", "kufaajwrxt",	/* 8268 */
+	"kugcw", "kuggacei", "kugs", "kuhfzegq",	/* 8272 */
+	"kuiec", "kujfbdxd", "kuoapwpea", "kuoenmrm",	/* 8276 */
+	"kuosfuetcefms", "kup", "kuqj", "kurbtfhevoa",	/* 8280 */
+	"kurmnl", "kuryubuoq", "kusghzx", "kut",	/* 8284 */
+	"kutt", "kutzxjkfti", "kuugzf", "kuuhnazqgd",	/* 8288 */
+	"kuvtnnebrb", "kuw", "kuwf", "kuwfhf",	/* 8292 */
+	"kuwqqsjadcyrid", "kuyaivjsapnk", "kuyr", "kuzyqrlcknpi",	/* 8296 */
+	"kv", "kvarvposeztlz", "kvb", "kvbleeqnyuu",	/* 8300 */
+	"kvcxcn", "kvdc", "kveasbb", "kvefmlywxt",	/* 8304 */
+	"kvekg", "kveql", "kvequarvkyqiz", "kvfltsab",	/* 8308 */
+	"kvgi", "kvhhsiwiunatfq", "kvhsbtau", "kvi",	/* 8312 */
+	"kvia", "kviolaetvndy", "kviqkeixf", "kvja",	/* 8316 */
+	"kvka", "kvnolbza", "kvo", "kvphigtkqm",	/* 8320 */
+	"kvpihhi", "kvqmgrkana", "kvqncsum", "kvqpwfwv",	/* 8324 */
+	"kvqrhhzefwfpfr", "kvqulkpjt", "kvqwnfxcqmre", "kvr",	/* 8328 */
+	"kvrblbwe", "kvsjjdaq", "kvsybqbrgiwoyv", "kvtmvta",	/* 8332 */
+	"kvvqmmmh", "kvxecuyjtzj", "kvxidvlbj", "kvyffvo",	/* 8336 */
+	"kvznkszwimy", "kw", "kwacqjfvpcn", "kwalkpmafmz",	/* 8340 */
+	"kwarmuiyyex", "kwbngkdqczou", "kwbosck", "kwbrktzcwqxmu",	/* 8344 */
+	"kwcmbratq", "kwerfkaol", "kwgdpghoem", "kwglvbovkcvb",	/* 8348 */
+	"kwhcu", "kwhtkuicyyzx", "kwjpezqzk", "kwjtiizztteh",	/* 8352 */
+	"kwjxinmxk", "kwkzeiwg", "kwoyufi", "kwqasfwhozmwrv",	/* 8356 */
+	"kws", "kwvdb", "kwvlpubt", "kwwp",	/* 8360 */
+	"kwy", "kwympfckqoht", "kwyxuqdjsz", "kwzdechujk",	/* 8364 */
+	"kwzrluywc", "kx", "kxayzsze", "kxcpnmcltzafdy",	/* 8368 */
+	"kxczvo", "kxggsiy", "kxgoczgxbuho", "kxgxskwzy",	/* 8372 */
+	"kxibxafao", "kxibzxvymcw", "kxivdazbzz", "kxjfuxwc",	/* 8376 */
+	"kxjhdr", "kxjnx", "kxjre", "kxkfxhpam",	/* 8380 */
+	"kxlnkufwg", "kxnucku", "kxnxlklt", "kxptlywu",	/* 8384 */
+	"kxribllfj", "kxu", "kxuuu", "kxuwota",	/* 8388 */
+	"kxwebfe", "kxwmqy", "kxwsvmaauxhp", "kxxnrjeuegd",	/* 8392 */
+	"kxzuffyg", "ky", "kyb", "kybunvrlvj",	/* 8396 */
+	"kyc", "kycg", "kycvr", "kydofovyargq",	/* 8400 */
+	"kydpy", "kydxu", "kyf", "kyfaqxsqncuy",	/* 8404 */
+	"kyg", "kyhuwgyag", "kyihkkkw", "kykffl",	/* 8408 */
+	"kykngsm", "kylkuupgtwhi", "kymupzxvxmywod", "kymvyexfkm",	/* 8412 */
+	"kypvhndtobln", "kyqcxraeqw", "kysjbho", "kytbuwgbp",	/* 8416 */
+	"kytiwed", "kytzaykj", "kyuo", "kywdsapgm",	/* 8420 */
+	"kywhjp", "kywy", "kyxjstyaxb", "kyyalllx",	/* 8424 */
+	"kz", "kzfmuvn", "kzfsppashtb", "kzg",	/* 8428 */
+	"kzgmaqgoeavhp", "kzht", "kzibwhmss", "kzjmoplbmwparp",	/* 8432 */
+	"kzkmfmiiilj", "kzmwh", "kznwcbbxrsxpd", "kzqnchykhsjw",	/* 8436 */
+	"kzqtszxlwrlkpk", "kzrkubnh", "kzrro", "kztjxugkww",	/* 8440 */
+	"kzujgcplqxvyer", "kzv", "kzwashgzpfw", "kzwwcwxainwe",	/* 8444 */
+	"kzymfh", "kzz", "kzzc", "kzzmnilcwbzuhz",	/* 8448 */
+	"laa", "lad", "ladtmkalzkzmaq", "laewac",	/* 8452 */
+	"laf", "lafftlz", "lafmwwa", "lah",	/* 8456 */
+	"laincnniymxq", "lajsbnlpulvta", "lalbspgzegonp", "lamwq",	/* 8460 */
+	"lanzxooqeprx", "laozl", "lapwdimseibdjk", "latpmogftta",	/* 8464 */
+	"latsfzcputfvse", "latyetevpeq", "lauaymihlflijn", "lav",	/* 8468 */
+	"lavsv", "laxp", "laz", "lb",	/* 8472 */
+	"lbckqmrule", "lbe", "lbegz", "lbeyfmquwgznsm",	/* 8476 */
+	"lbfguk", "lbgnfyawazhaf", "lbifzk", "lbj",	/* 8480 */
+	"lbklnv", "lbkzlsiymrwc", "lbob", "lbqosxvo",	/* 8484 */
+	"lbsbjgb", "lbsdzv", "lbustdjan", "lbuwmxwq",	/* 8488 */
+	"lbwbkswpgmt", "lbwfjgzcdaoi", "lbxz", "lbycwcdkd",	/* 8492 */
+	"lbypoolbze", "lbzzhvhg", "lc", "lcagkd",	/* 8496 */
+	"lcbrffaizejf", "lcc", "lcdi", "lceolg",	/* 8500 */
+	"lcfvfggzutbqt", "lcgmtoxgqxc", "lchthkgyr", "lchv",	/* 8504 */
+	"lciku", "lcjkidygyr", "lcjnmisggg", "lckts",	/* 8508 */
+	"lcmmuzfzd", "lcnhyyefid", "lcnulnufqlh", "lcoqznmyicoo",	/* 8512 */
+	"lcpepmwgfjs", "lcszliq", "lcth", "lctzgydfnuwi",	/* 8516 */
+	"lcupldk", "lcw", "lcwylflwzvwjjx", "lcxzhgd",	/* 8520 */
+	"lcz", "ld", "ldatxfpevlorrw", "ldc",	/* 8524 */
+	"ldchvexsegc", "ldctepdcqxnuqk", "lddeaabvyxdbf", "ldjifpxkb",	/* 8528 */
+	"ldkpiifx", "ldlgwbmqfsxjdb", "ldlwusoe", "ldndoirq",	/* 8532 */
+	"ldoglxgauaw", "ldqbdnnxagmcr", "ldrdxxcmoqx", "ldsceccdmqien",	/* 8536 */
+	"ldsyt", "ldt", "ldtfrhxamtk", "ldwgxadhxwt",	/* 8540 */
+	"ldwhidpnmtlrl", "ldzkxmuxfnr", "le", "leabrxeewx",	/* 8544 */
+	"leaqncrwveoy", "lec", "leeanebgmwiatt", "leecbqwevbyv",	/* 8548 */
+	"leezmsxdfgq", "lefla", "legk", "lehhpikbio",	/* 8552 */
+	"leijtlarb", "lejz", "lelxkscpaezce", "lembcicypgo",	/* 8556 */
+	"lengl", "leqncyyzbouzr", "leqyscdhjya", "lescbjzu",	/* 8560 */
+	"lesjdcmsjc", "leus", "leutjyxoktqwyc", "levaqbu",	/* 8564 */
+	"leweuvyionjxem", "leyfcfnngk", "lf", "lfar",	/* 8568 */
+	"lfbv", "lfbzlcthv", "lfclboamhe", "lfeeswh",	/* 8572 */
+	"lfeyukfaj", "lffngtwuhplmp", "lfhbitxjftngl", "lfhkzbtt",	/* 8576 */
+	"lfjqq", "lflapsdlvwkj", "lfljhihudfm", "lflzoeg",	/* 8580 */
+	"lfmnfxb", "lfmwigvkqlg", "lfmxbezjqwtnuf", "lfnlxogzuyx",	/* 8584 */
+	"lfoqzfblzlfv", "lfpcexgvbbv", "lfpiuqeifw", "lfrysxjprfn",	/* 8588 */
+	"lfsnxoq", "lfwcxp", "lfzrjgfqncmiog", "lfzrl",	/* 8592 */
+	"lg", "lgafi", "lgdeykqmqdpaco", "lgdivnhibvdva",	/* 8596 */
+	"lge", "lgecngxeu", "lgg", "lggddwnlouw",	/* 8600 */
+	"lgk", "lgkmbk", "lgnccditi", "lgnoustuiobokb",	/* 8604 */
+	"lgnzcighye", "lgodqclhvsptb", "lgpsc", "lgptcpu",	/* 8608 */
+	"lgrgqzyf", "lgs", "lgsimbunmw", "lgw",	/* 8612 */
+	"lgy", "lgyglqpva", "lgyicppvdkwmtj", "lgyw",	/* 8616 */
+	"lh", "lhbdgyv", "lhbsjfjbzlim", "lhbtmt",	/* 8620 */
+	"lhbwcopzebhj", "lhcbpdmxrxgn", "lhcqg", "lhcyr",	/* 8624 */
+	"lhczk", "lhd", "lhdwborrz", "lhe",	/* 8628 */
+	"lheqdjaitzrs", "lhevfudgwg", "lhgwyqegsvx", "lhgzreamn",	/* 8632 */
+	"lhkw", "lhlhcnalpedri", "lhlovothz", "lhlzrceklq",	/* 8636 */
+	"lhnef", "lhomrmqhef", "lhoseowfepc", "lhqldqzhp",	/* 8640 */
+	"lhtcdhljgkuj", "lhumcu", "lhwaktmj", "lhwgpqjdfpy",	/* 8644 */
+	"lhwht", "lhxbymxhuysshq", "li", "libheoypzf",	/* 8648 */
+	"licj", "liclqaigggvclh", "licqiqkn", "lid",	/* 8652 */
+	"lidjwnoawhxtl", "lidxxxcwlm", "ligbfrytsqbafl", "ligfvzuddfgeh",	/* 8656 */
+	"lihgdipkcy", "lihko", "lihqesyznkpyxd", "lijfraaiurwsa",	/* 8660 */
+	"likjefcovfthms", "liks", "limp", "limw",	/* 8664 */
+	"liogoys", "lipdcicoisg", "lipmv", "lir",	/* 8668 */
+	"lirxehxfk", "lirygzisuf", "listbjuuslvm", "liunfytc",	/* 8672 */
+	"livwe", "liwyjpfvjqafh", "liysjzile", "lizrwmkbdf",	/* 8676 */
+	"lj", "ljau", "ljbggfycpng", "ljbgoawtycp",	/* 8680 */
+	"ljcb", "ljci", "ljdyjpwgucej", "ljelibio",	/* 8684 */
+	"ljf", "ljfnnvfrwxsl", "ljfoqsrbjt", "ljfu",	/* 8688 */
+	"ljgaiur", "ljhbofzejbw", "ljiog", "ljivjcjb",	/* 8692 */
+	"ljjymfidssulo", "ljkfwehmtyod", "ljmdsehxxami", "ljmvwso",	/* 8696 */
+	"ljmxtuohydubho", "ljov", "ljrvrwfgl", "ljtejvwandxsx",	/* 8700 */
+	"ljulznko", "ljvxffmxcqilv", "ljwlkjcdjxu", "ljwlxzkladm",	/* 8704 */
+	"ljwvshi", "lk", "lkalr", "lkanzstuuxchgs",	/* 8708 */
+	"lkcaklwhho", "lkftmgiw", "lkgmbxu", "lkgxgyfu",	/* 8712 */
+	"lkhvwrbvo", "lkjiuzowi", "lkknmfghcvf", "lkkpawflojvbr",	/* 8716 */
+	"lkkx", "lklz", "lkmjfpfwyxnbvt", "lkoycoza",	/* 8720 */
+	"lkqjtsxcsmmk", "lkrq", "lkrrincmgxox", "lksetjhdsz",	/* 8724 */
+	"lktupqrawzcbh", "lkurbkued", "lkvfncqdg", "lkvrmp",	/* 8728 */
+	"lkxdb", "lkysmux", "lkytvvtkq", "ll",	/* 8732 */
+	"llalcdpoqrtdbf", "llbvkkwoccozzv", "lle", "lleogrprjtg",	/* 8736 */
+	"llezgsxajgkmng", "llglrwg", "llgs", "llgxcvktprhhp",	/* 8740 */
+	"llhskwcucxcbub", "llnnba", "llr", "llrat",	/* 8744 */
+	"llrqrj", "lls", "llsnloqlblj", "llthijkehqrpv",	/* 8748 */
+	"lluadozymjw", "llucficrnuicvy", "llvpsenf", "llwabaqyawchk",	/* 8752 */
+	"llx", "llxazjbmd", "llyubr", "llzzvzdih",	/* 8756 */
+	"lm", "lmalwdoenhjm", "lmctgtxtyxx", "lmcwfeq",	/* 8760 */
+	"lmephgnnuhdtvu", "lmeyutbp", "lmfwctwuauz", "lmghmeduwgvqm",	/* 8764 */
+	"lmhscaras", "lmhvplowxw", "lmjsra", "lmlnh",	/* 8768 */
+	"lmo", "lmql", "lmstogr", "lmtaslv",	/* 8772 */
+	"lmtgczdo", "lmtomti", "lmuemcpiso", "lmumvjeof",	/* 8776 */
+	"lmupnsdrtufwil", "lmutqbzrbxok", "lmvjtiagmlq", "lmvvhtu",	/* 8780 */
+	"lmwe", "lmwrybhmjnobz", "lmx", "ln",	/* 8784 */
+	"lnarxkgeoox", "lnavbixdkqek", "lnaykmlhoxhzct", "lnbfpvimsgmihc",	/* 8788 */
+	"lnbx", "lncdzf", "lncngdhlw", "lncnzkwgz",	/* 8792 */
+	"lndfgedyfzqezt", "lnejrgbno", "lnfja", "lnhqaiybwbgz",	/* 8796 */
+	"lnis", "lnjn", "lnnodqiznathf", "lnnvmsrtzknrfr",	/* 8800 */
+	"lnog", "lnomncpfqvgfd", "lnpuob", "lnqkdvlooba",	/* 8804 */
+	"lnshoimlmzsh", "lnsybtndp", "lnujbshxyk", "lnvqopmra",	/* 8808 */
+	"lnvuyspkdlzv", "lnxcbhtzpkns", "lnygsptvcnlk", "lnyqnyacdomy",	/* 8812 */
+	"lo", "loa", "loaqy", "lobw",	/* 8816 */
+	"loewdnhev", "logfhgcp", "loglw", "loifxpyukkiw",	/* 8820 */
+	"loizzuaadffli", "loj", "lojcicowyrfwn", "lolvj",	/* 8824 */
+	"lolyk", "lomdujc", "lomhnklown", "lomhxdxh",	/* 8828 */
+	"lomiiqayikle", "loprq", "loqdalbpdtkxf", "loqrxbfjuxwr",	/* 8832 */
+	"lorhucdscu", "loricf", "losuasaptvodxe", "lotfcx",	/* 8836 */
+	"louekjkcjvf", "loueubzksku", "lov", "loxlunwcvubk",	/* 8840 */
+	"loykblacwa", "lp", "lpaw", "lpcwsggg",	/* 8844 */
+	"lpdfh", "lpdfmj", "lpefbtao", "lpefigmqzve",	/* 8848 */
+	"lpeoeuwpe", "lpeotc", "lpgdajekwlnk", "lpgxawffako",	/* 8852 */
+	"lphcugnm", "lpi", "lpihzqyk", "lplm",	/* 8856 */
+	"lpo", "lpokljzrdkmxf", "lppvvxetzjudr", "lpqeyfwenybcl",	/* 8860 */
+	"lprefnxjgngwns", "lprri", "lpryniyctl", "lpsiyyhdtd",	/* 8864 */
+	"lpsrmeqxkujhu", "lpsvykdy", "lpthz", "lpuwdfqzk",	/* 8868 */
+	"lpw", "lpxyapiwbljy", "lpyoq", "lpyrq",	/* 8872 */
+	"lpz", "lpzuocgpdlc", "lq", "lqccbqwywwz",	/* 8876 */
+	"lqeybrhrvgiw", "lqgdnfymgonjf", "lqgkdmatl", "lqhr",	/* 8880 */
+	"lqihmvfdkntpv", "lqikozjyjlzyp", "lqiukgqcdhkpsx", "lqll",	/* 8884 */
+	"lqlmtidiqdpc", "lqqcfgax", "lqrtskwbzxmo", "lqruvedyygoivu",	/* 8888 */
+	"lqrzyywtnjdrh", "lqtlnsjln", "lqttqjg", "lqturiid",	/* 8892 */
+	"lqtvfsqvzhao", "lqxhbbtposs", "lqxqksoji", "lqxs",	/* 8896 */
+	"lqyicpcyghqzt", "lqynlnfkzyn", "lqyvscx", "lqzmgzeskdhfkw",	/* 8900 */
+	"lr", "lrbdoibs", "lrbfxfol", "lrdewjhtur",	/* 8904 */
+	"lrdfbdgysb", "lrdnxarsqv", "lrdsbassleylnq", "lrfjghfdu",	/* 8908 */
+	"lrgzgvhxolzj", "lrhhixxetcoal", "lrjn", "lrlqjveeooy",	/* 8912 */
+	"lrltt", "lrp", "lrprf", "lrq",	/* 8916 */
+	"lrqoykytofshrb", "lrtdar", "lrtgxc", "lrtuywsqhabpd",	/* 8920 */
+	"lrvmfxt", "lrvmiisex", "lrwrhwbfz", "lrxjidacswxovv",	/* 8924 */
+	"lryceretpoxy", "lryebm", "lrzugksdsf", "lrzv",	/* 8928 */
+	"ls", "lsalwshiqdaeq", "lsd", "lse",	/* 8932 */
+	"lsfgrrownar", "lsgnuynuqdxh", "lsikgwgsjjzf", "lsjfgn",	/* 8936 */
+	"lsk", "lskoyptmudlm", "lsl", "lsladm",	/* 8940 */
+	"lsmcxe", "lsmgnaigqlgs", "lsnwmdm", "lsqa",	/* 8944 */
+	"lsqchlkqibtie", "lsqjnimyifbh", "lsrqrzxbikjpq", "lssfacgfu",	/* 8948 */
+	"lstemx", "lsxgasxtjlsfls", "lsxzpflsjst", "lsyboysbdxlfp",	/* 8952 */
+	"lsyrcbckho", "lsyyce", "lszuenoycyxle", "lt",	/* 8956 */
+	"ltafi", "ltcgk", "ltcwh", "ltfqdvhujp",	/* 8960 */
+	"ltgfmy", "ltgfzh", "lthxufzrrigy", "ltiddfprzp",	/* 8964 */
+	"ltjekawzzg", "ltkoqmoktctcv", "ltkxolpuqoyck", "ltlhazrtfotejm",	/* 8968 */
+	"ltndijpt", "ltnpgyrzjvs", "ltoawxu", "ltphkftyf",	/* 8972 */
+	"ltqslb", "ltqttkecwccb", "ltqxrgy", "ltrmkcucqhwe",	/* 8976 */
+	"lts", "ltsgfqnpzwqxq", "ltvxkduazc", "ltvzpaxodwu",	/* 8980 */
+	"ltxbaajcsqm", "ltxhmr", "ltxqfpbvxo", "ltybxnf",	/* 8984 */
+	"ltycbjwyyog", "ltyhommtf", "ltymnme", "ltyqmtex",	/* 8988 */
+	"ltzbgj", "lu", "luav", "lubxl",	/* 8992 */
+	"lucegwt", "ludgtcwbctj", "lueggiqugxgos", "luezomtk",	/* 8996 */
+	"lugxxdtpfronnh", "luhidne", "luhlof", "luiiiip",	/* 9000 */
+	"luiik", "luixlshljpclzd", "lul", "lulwediqzgmer",	/* 9004 */
+	"lun", "lunkgdljearkfj", "lunlswijrovca", "lunurhq",	/* 9008 */
+	"luoifvlg", "lurkkj", "lut", "luugtwxvspqx",	/* 9012 */
+	"luuq", "luvqeeujtpr", "luwijannfplgk", "luzfdcg",	/* 9016 */
+	"lv", "lva", "lvbwuvyt", "lvcbxfr",	/* 9020 */
+	"lvcdtxb", "lvdbjrviihk", "lveamqbgjc", "lveiwwlaq",	/* 9024 */
+	"lvgtxgthz", "lvhfyd", "lvhha", "lvjewjcnh",	/* 9028 */
+	"lvjnwfd", "lvkbpaetylnpc", "lvksmultjg", "lvl",	/* 9032 */
+	"lvlkar", "lvlmsd", "lvm", "lvmcitof",	/* 9036 */
+	"lvmybvm", "lvnhry", "lvnldkhjjily", "lvokides",	/* 9040 */
+	"lvpqnhmy", "lvrjg", "lvtbrrdimbzm", "lvunipbwysscc",	/* 9044 */
+	"lvvhaz", "lvvzc", "lvwirdpq", "lvwnck",	/* 9048 */
+	"lvwnrkflbg", "lvwvwiqpx", "lvxa", "lvxaeavg",	/* 9052 */
+	"lvxrbghzsijigq", "lvycsjo", "lvzkpzacghcxeh", "lvzplr",	/* 9056 */
+	"lw", "lwb", "lwbhlztwif", "lwdsadaj",	/* 9060 */
+	"lwfxijguscqlp", "lwfy", "lwgoggvhdmzsfh", "lwhbjk",	/* 9064 */
+	"lwhlcmcfmvpccm", "lwhxdpupipeiuy", "lwjhwcdfr", "lwjmqla",	/* 9068 */
+	"lwjzgqavambbx", "lwlshkrm", "lwlwavpq", "lwnczku",	/* 9072 */
+	"lwnfwsrvldkcgb", "lwnq", "lwobsuqjwqmfa", "lwpjrev",	/* 9076 */
+	"lwqguggqauc", "lwshatheoydpd", "lwsnitejsz", "lwsqmjgihuogkm",	/* 9080 */
+	"lwvddw", "lwvjgkvis", "lwwe", "lwwukophwg",	/* 9084 */
+	"lwxhlpl", "lwz", "lwze", "lwzxt",	/* 9088 */
+	"lx", "lxbt", "lxckd", "lxewkquwzhkiu",	/* 9092 */
+	"lxihgvdmgj", "lxklc", "lxl", "lxlssprgw",	/* 9096 */
+	"lxmcszbeb", "lxmvybazuxj", "lxohaqyfu", "lxopeakn",	/* 9100 */
+	"lxpylirodnu", "lxqhvbehszj", "lxqmalu", "lxrfyyb",	/* 9104 */
+	"lxsyeensucsxie", "lxterduzu", "lxtgkhhappmkie", "lxtv",	/* 9108 */
+	"lxvkqsrslpe", "lxyeds", "lxykybifyjn", "lxypjmjda",	/* 9112 */
+	"lxywlx", "lxzinl", "ly", "lyaiz",	/* 9116 */
+	"lycwybgofonsr", "lycxgrwz", "lydiomxkjeppm", "lydnxlbaawaok",	/* 9120 */
+	"lyffwxvjt", "lyjinz", "lyjllkzobtcxe", "lykvjdymz",	/* 9124 */
+	"lylfhtgthd", "lyn", "lyp", "lypvgg",	/* 9128 */
+	"lyqjbvuthvycb", "lyqoi", "lyqyx", "lyrsig",	/* 9132 */
+	"lyspvr", "lytdgeyyxbyovb", "lyto", "lyuyqq",	/* 9136 */
+	"lyvjtlfcelujzq", "lyw", "lywo", "lyxicnkqq",	/* 9140 */
+	"lyxpnvpket", "lyxt", "lyznfjgcbziiy", "lz",	/* 9144 */
+	"lzaoikcl", "lzbzdomaep", "lzcdnuhzx", "lzdewjgaeccmw",	/* 9148 */
+	"lzefnwjrew", "lzflponekpm", "lzhknt", "lzjndud",	/* 9152 */
+	"lzkmfy", "lzkqwb", "lzkvxjqqbka", "lzmmehstuzdire",	/* 9156 */
+	"lznk", "lznnwswrtcd", "lzpll", "lzpssxooprnlzb",	/* 9160 */
+	"lzqiidmtnc", "lztb", "lztnqdoheoh", "lzu",	/* 9164 */
+	"lzuikdwggkts", "lzvqyarrsr", "lzwkg", "lzwmfjug",	/* 9168 */
+	"lzwxpklisc", "lzyoyal", "lzyxnj", "lzztc",	/* 9172 */
+	"ma", "maaankzlvj", "maakpjmnqnd", "mab",	/* 9176 */
+	"macvxdkjcy", "madh", "madyaoloobqr", "maexr",	/* 9180 */
+	"magm", "magqpotnp", "magvo", "mahiqehbjcbt",	/* 9184 */
+	"mahjbu", "mahmbfm", "majxkndr", "malgcdy",	/* 9188 */
+	"malqjhmpmlb", "mampwo", "manppyw", "manyglvtem",	/* 9192 */
+	"maobhjarb", "mapchedlltc", "mapjctbs", "maqrtk",	/* 9196 */
+	"markqqmina", "masw", "matf", "matw",	/* 9200 */
+	"mau", "mauonb", "mawa", "maxlf",	/* 9204 */
+	"maybzercnxjlcp", "mb", "mbblzegks", "mbdsvtzyhca",	/* 9208 */
+	"mbekvmrzctyojk", "mbg", "mbgifkikb", "mbgolmkeresn",	/* 9212 */
+	"mbgqet", "mbjfbksgfzs", "mbkiejqz", "mbkkdknatazlzf",	/* 9216 */
+	"mblbiajkcla", "mblbprdkaua", "mbnnc", "mbovcgdrolziq",	/* 9220 */
+	"mbpcxbqohih", "mbqnaqvhsop", "mbrkdhzfjdjdcv", "mbthitjdcvxsqe",	/* 9224 */
+	"mbubjlhx", "mbuqf", "mbybex", "mca",	/* 9228 */
+	"mcajzk", "mcbnpm", "mccaixedehu", "mccazquay",	/* 9232 */
+	"mcccjwoke", "mcdmsequh", "mcehtses", "mcemh",	/* 9236 */
+	"mcenzdmb", "mceyrdcaepiqqt", "mcezzgps", "mcfrnxe",	/* 9240 */
+	"mch", "mchybhpraaqz", "mcih", "mcjkm",	/* 9244 */
+	"mcjrhk", "mcmm", "mcmwcfmht", "mcmzqsujmil",	/* 9248 */
+	"mcmzqsx", "mcnhpkftudhc", "mcrmeqfc", "mcrxcpgppaidbg",	/* 9252 */
+	"mcsrazttz", "mcwcyh", "md", "mdakn",	/* 9256 */
+	"mdbwo", "mdcudsqhgvikb", "mddncs", "mddvkttuwws",	/* 9260 */
+	"mdfzhdojxkgikf", "mdg", "mdixubzzcxmr", "mdjfumvrcmgpyx",	/* 9264 */
+	"mdjzd", "mdkxag", "mdlnawkcuns", "mdmrfzpoofyje",	/* 9268 */
+	"mdnaqttjrvai", "mdojv", "mdpdyzvcsnoj", "mdpibroy",	/* 9272 */
+	"mdpkwjqobzpjk", "mdpysfkapvpr", "mdqrpdrfrbbew", "mdsfrwfnbgs",	/* 9276 */
+	"mdsubhjtvo", "mdtpdemtw", "mdtpnmcmyxokvy", "mdujzm",	/* 9280 */
+	"mdunp", "mdvgnnujjuokb", "mdwgoueuyian", "mdwgyudutulaa",	/* 9284 */
+	"mdz", "mdzpqbv", "mdzttgkanox", "mdzxarfuk",	/* 9288 */
+	"me", "meadygnjkjud", "meah", "meaxt",	/* 9292 */
+	"meb", "medjxrmvjbir", "medlxothitffo", "medzcgigvsaui",	/* 9296 */
+	"meefqpzfaqf", "mefvki", "mehgx", "mehqsjhe",	/* 9300 */
+	"mehuhhxjvyjx", "meirvdij", "meizixi", "mejxruilpedf",	/* 9304 */
+	"mejyalbpjgtn", "mekuwwkngknj", "menfoihtrg", "menzugwgvcfx",	/* 9308 */
+	"meomfpoqsb", "meoqpjxulhhszm", "mepbgu", "meqfyvv",	/* 9312 */
+	"meqslrskgtemh", "mer", "meredk", "mew",	/* 9316 */
+	"mewn", "mexb", "mexeftqr", "mexmaot",	/* 9320 */
+	"mexz", "mey", "meyojriqsms", "meyxiuqychbli",	/* 9324 */
+	"mezsyujb", "mfaqpplrnautv", "mfb", "mfbkbdr",	/* 9328 */
+	"mfctbh", "mfcueuq", "mfdgwejraqgjz", "mfeozmb",	/* 9332 */
+	"mffhzjdbtgat", "mfg", "mfgtnhbbxuflfh", "mfhjwn",	/* 9336 */
+	"mfjrwmgs", "mfkt", "mfltkg", "mfokyfloo",	/* 9340 */
+	"mfqqvhfdrs", "mfqqvxca", "mfrfguqqmtmlss", "mfrivanpfji",	/* 9344 */
+	"mfsyulcrojpxl", "mftev", "mfthupqe", "mftljzzymtrpw",	/* 9348 */
+	"mfvsfkiqhps", "mfwiltrpm", "mfwjl", "mfwlfqrc",	/* 9352 */
+	"mfwqhocx", "mfwwyify", "mfwxnuu", "mfxqzwehego",	/* 9356 */
+	"mfxyrighpor", "mfyb", "mfyndfygc", "mg",	/* 9360 */
+	"mgdeymvlg", "mge", "mgguu", "mghxvualvpbsf",	/* 9364 */
+	"mgkksjmpn", "mgmqllwyvtbt", "mgmtlox", "mgol",	/* 9368 */
+	"mgotcqdobdg", "mgozgbojb", "mgpzjcwldtt", "mgq",	/* 9372 */
+	"mgqgsydhg", "mgqkgj", "mgruxryqfdqok", "mgskeuikugtb",	/* 9376 */
+	"mgveq", "mgvoa", "mgxcjeggcrn", "mgyzimwdsnvhj",	/* 9380 */
+	"mgzaxlsygv", "mgzoianxotpf", "mh", "mhb",	/* 9384 */
+	"mhbvrhiitjj", "mhbvwjcqyaccn", "mhcg", "mhdrqk",	/* 9388 */
+	"mhf", "mhjbdu", "mhjli", "mhjswivvjldste",	/* 9392 */
+	"mhk", "mhkifz", "mhl", "mhll",	/* 9396 */
+	"mhltzglru", "mhmdkkywmdav", "mhmizbxmb", "mhmld",	/* 9400 */
+	"mhmnxjrqy", "mhnsusfxgror", "mhohzllhf", "mhoqeflekr",	/* 9404 */
+	"mhpgjgql", "mhpom", "mhptskr", "mhpurwzkd",	/* 9408 */
+	"mhpwgpbzzi", "mhqarubu", "mhqbtqmau", "mhs",	/* 9412 */
+	"mhtnije", "mhuftdxjwjkj", "mhx", "mhxqerydnr",	/* 9416 */
+	"mhyqrdadsoju", "mhyrbmswgz", "mi", "mibyynov",	/* 9420 */
+	"mic", "micxhfcoa", "miecblqfgypss", "miewagrew",	/* 9424 */
+	"mifrjxoiqwcwax", "migt", "migyxrxrfvnl", "mihxsthccj",	/* 9428 */
+	"miigu", "miimpwoun", "mijliqiuo", "mijmosjlpnsi",	/* 9432 */
+	"mikzdueglpuk", "milge", "mimkcjeiuvae", "mimo",	/* 9436 */
+	"minbiicxlwikmv", "minefx", "minyncfpoag", "miohxntzauyle",	/* 9440 */
+	"miojhtcdqxdj", "miomie", "miproieur", "misgpppht",	/* 9444 */
+	"mismoihgezi", "mitbkvphmcgr", "mitib", "miticfmdz",	/* 9448 */
+	"mitihiegakggt", "miv", "mivfgoumygfa", "mivsxsslhbbiih",	/* 9452 */
+	"miw", "mixbfhduzfncw", "miy", "mizcc",	/* 9456 */
+	"mj", "mjbfu", "mjbrajw", "mjdqlmhwad",	/* 9460 */
+	"mjfgvzshpeqzdh", "mjfwwnvlbthk", "mjghfdpre", "mjgjwylwpjv",	/* 9464 */
+	"mjhfphush", "mjhujrebtq", "mjiaxiklj", "mjiy",	/* 9468 */
+	"mjjdqhxck", "mjjz", "mjk", "mjlfgpiuh",	/* 9472 */
+	"mjmoxnxuevhu", "mjn", "mjnliiwabcopes", "mjnqwwhn",	/* 9476 */
+	"mjnszrjczy", "mjntsj", "mjqcyhtiywhcv", "mjrgusjgs",	/* 9480 */
+	"mjv", "mjvkt", "mjxcvtlvohpjq", "mjymg",	/* 9484 */
+	"mjynpl", "mjzr", "mk", "mka",	/* 9488 */
+	"mkbbdx", "mkcsy", "mke", "mkeeoqceada",	/* 9492 */
+	"mkf", "mkgawdsny", "mkgbdzprbz", "mkhk",	/* 9496 */
+	"mkir", "mkjssl", "mkjy", "mkmqsjnxbhix",	/* 9500 */
+	"mkmwhxaf", "mkndlngjna", "mkpfprq", "mkpoih",	/* 9504 */
+	"mkqzptsj", "mkrjal", "mktwzyelc", "mkw",	/* 9508 */
+	"mkydnfsazshe", "mkyqaoymc", "mkzxvspdum", "ml",	/* 9512 */
+	"mlayipjyqtr", "mlbnu", "mlchustznymbsg", "mlcudlkv",	/* 9516 */
+	"mlcxucdfjj", "mldssrsxbxi", "mleastpqfdpjem", "mlht",	/* 9520 */
+	"mliuvuaguxt", "mljykozw", "mlmhrgsrnyex", "mlmiyrhimzeue",	/* 9524 */
+	"mlpebryhjtg", "mlpzdmei", "mlq", "mlqcctczb",	/* 9528 */
+	"mlrxbkkpaibii", "mlsm", "mlstexxjt", "mlu",	/* 9532 */
+	"mlv", "mlvenvnvhvarle", "mlwvbxgnjh", "mlxpal",	/* 9536 */
+	"mlxu", "mlyzise", "mm", "mmaefrz",	/* 9540 */
+	"mmavycbsapdue", "mmbhdwcitaytx", "mmbqrdoxue", "mmc",	/* 9544 */
+	"mmcdwttxkhhvdd", "mmcivormxgsf", "mmckkeiito", "mmdzafgtsh",	/* 9548 */
+	"mmehlyrpex", "mmejw", "mmenossnqjvpef", "mmewddgvsvidm",	/* 9552 */
+	"mmfquzims", "mmfsckiakj", "mmgddzqkxyj", "mmghvqakbftu",	/* 9556 */
+	"mmgnfjnyvcpin", "mmgu", "mmiu", "mmjnt",	/* 9560 */
+	"mmjwjhodgss", "mmk", "mmlsnfkise", "mmmpvcwmvo",	/* 9564 */
+	"mmmqlo", "mmnyfs", "mmoawvhrecpm", "mmojcpbpxdkfz",	/* 9568 */
+	"mmpatljbps", "mmpmmm", "mmq", "mmqnjabld",	/* 9572 */
+	"mmqqroicfy", "mmrrdodktpz", "mmsbfureuipt", "mmsxvawngeoo",	/* 9576 */
+	"mmtrgn", "mmuaydopppppr", "mmub", "mmudlmeqaosdn",	/* 9580 */
+	"mmui", "mmwgzulwxcu", "mmxkdyryjispho", "mmxmrqzhz",	/* 9584 */
+	"mmz", "mn", "mnaficxod", "mnayaxmmojdi",	/* 9588 */
+	"mnbcwlnwt", "mnbvtqdsxyvmr", "mndbzzebqqdhvm", "mndwtytxrd",	/* 9592 */
+	"mnfxgmoamftw", "mnghqecwwxjg", "mnijx", "mnj",	/* 9596 */
+	"mnkifhsqxvnehw", "mnldyssjhpe", "mnlomewmgob", "mnltcpz",	/* 9600 */
+	"mnmyfags", "mnoskzvlnanl", "mnpvkvcq", "mnskzwjas",	/* 9604 */
+	"mntnhlwo", "mnugp", "mnujzzjznnvro", "mnuuqgrcvkhvr",	/* 9608 */
+	"mnvnels", "mnw", "mnweinnotioxt", "mnwwconnqbyt",	/* 9612 */
+	"mnxbmfl", "mnyowuyla", "mnyt", "mnznyvssclffni",	/* 9616 */
+	"mo", "mob", "mod", "modebzgsuqnb",	/* 9620 */
+	"moep", "mofllvba", "mofznp", "mogldiyrcaei",	/* 9624 */
+	"mok", "momuhmdaxqbfy", "mopyfoom", "moqlayqijd",	/* 9628 */
+	"moqmtgixunw", "morcrrkc", "morpzhf", "mortw",	/* 9632 */
+	"motuv", "mou", "moyhxuksljau", "mozuajbfmtokyg",	/* 9636 */
+	"mpa", "mpcbokltscsmb", "mpcebw", "mpdnzufwvpgu",	/* 9640 */
+	"mperkdkb", "mpgaukdlfkqqh", "mpgbebbqi", "mpjwtoydd",	/* 9644 */
+	"mpkmwgawtk", "mpmchzvxvywcak", "mpmmm", "mppkwmz",	/* 9648 */
+	"mprrgyyodvugyy", "mpsokebqvbgtct", "mptnwax", "mpviqstqsvf",	/* 9652 */
+	"mpxdzvlwn", "mpxy", "mpzqhndbnth", "mq",	/* 9656 */
+	"mqcjr", "mqi", "mqijihvipdnnoe", "mqjquv",	/* 9660 */
+	"mqkwijpsrzebcv", "mqljuptrfeht", "mqnokbmer", "mqnxxvzanhgna",	/* 9664 */
+	"mqnyannwrvks", "mqo", "mqoifinyxncm", "mqpco",	/* 9668 */
+	"mqqonp", "mqqrqmyydynknv", "mqqw", "mqrkfe",	/* 9672 */
+	"mqslkuzjqgwpj", "mqsxahmvavaq", "mqsxtdimtttr", "mqvkzsozyiokmb",	/* 9676 */
+	"mqvtfjcjybsusj", "mqyizamxpe", "mr", "mrasqjaxmkdi",	/* 9680 */
+	"mrcihgumflaior", "mrcnt", "mrcxbrbalxvqxi", "mrdezmvigxzucn",	/* 9684 */
+	"mreemydezgapf", "mreyrqekocb", "mribg", "mridkxvrlkzaa",	/* 9688 */
+	"mrixadgkopi", "mrixorcnac", "mrjpkwhgxzfoen", "mrll",	/* 9692 */
+	"mrngvhvgjecba", "mrpdkwpeni", "mrpi", "mrpkkzu",	/* 9696 */
+	"mrrswjy", "mrsdoglscmm", "mrtekxsn", "mrtghikbnvb",	/* 9700 */
+	"mru", "mruvgenfdsdxjf", "mrwj", "mrzdieqnv",	/* 9704 */
+	"mrzepthyprngr", "mrzyyuv", "ms", "msabfomrne",	/* 9708 */
+	"msalnlgcuwkgcz", "msaq", "msbkhifnt", "msbzzq",	/* 9712 */
+	"msdaozsfuz", "msdxpivl", "mseqeqnmdt", "msggrkgqgwq",	/* 9716 */
+	"mshbxypz", "msingqtjogh", "msjasuhzaykww", "mslcbroz",	/* 9720 */
+	"mslizumint", "mslmocvswikak", "msmsnmzs", "msmwuo",	/* 9724 */
+	"msoljlbkd", "mspmdkatgdjb", "msqtcdvowrugoy", "msrnlfxddwnyt",	/* 9728 */
+	"mssbwbnwtv", "mswwopq", "mszjsfspvhs", "mszlw",	/* 9732 */
+	"mszttfgmxxdsd", "mt", "mtagplw", "mtav",	/* 9736 */
+	"mtb", "mtbrwys", "mtdxasgvm", "mtew",	/* 9740 */
+	"mtfcfehx", "mthazuvsacprm", "mthkzzla", "mtjbhniqdqfoj",	/* 9744 */
+	"mtjujtpnto", "mtjxoonngve", "mtkb", "mtllkekkrwkubk",	/* 9748 */
+	"mtlmowqmlsgoll", "mtmyfkciszhww", "mtnszftw", "mtps",	/* 9752 */
+	"mtqioepd", "mtqrc", "mtrfwnhhzikrbw", "mtszkb",	/* 9756 */
+	"mtvb", "mtwbysxvxm", "mtwmmk", "mtxsbxlz",	/* 9760 */
+	"mtxshdeqsbysp", "mtzbfnhtcdwc", "mu", "muadevlls",	/* 9764 */
+	"muaoigfb", "muauuipdrdyile", "muaxbmu", "mub",	/* 9768 */
+	"mubleyahxg", "mubsvtwmbjvvcm", "mubv", "mucuzhjjb",	/* 9772 */
+	"muhdjs", "muhmttcdkk", "muhnumwzy", "muje",	/* 9776 */
+	"muktupmnvuhf", "mulhrgywu", "mulojnnvtbsuq", "mumna",	/* 9780 */
+	"mup", "muqkckn", "muvxnkomhv", "muwqtcinv",	/* 9784 */
+	"muxtior", "muydazmpu", "muyxmmryozsre", "muzxzbzb",	/* 9788 */
+	"mv", "mvaohtpdazf", "mvb", "mvdd",	/* 9792 */
+	"mvdebfaej", "mvenkcv", "mvgbjhuqagxf", "mviplexstg",	/* 9796 */
+	"mvm", "mvmddlyllmp", "mvobobi", "mvoxoyha",	/* 9800 */
+	"mvp", "mvrnkueflul", "mvsknian", "mvuflpag",	/* 9804 */
+	"mvuhviacorsyuq", "mvxbu", "mvxjzrorn", "mvxzosoulqbxd",	/* 9808 */
+	"mvyfamultzyth", "mvyjgydreq", "mvzqaodtn", "mvzssgvr",	/* 9812 */
+	"mwakwyspb", "mwamnfs", "mwbxhlifwp", "mwcqfiuxdm",	/* 9816 */
+	"mwd", "mwepsuyxwkv", "mwhk", "mwhwnlucrdbeb",	/* 9820 */
+	"mwibwwi", "mwkh", "mwkk", "mwkqafikinxwco",	/* 9824 */
+	"mwljchlxad", "mwpvjo", "mwqh", "mwrd",	/* 9828 */
+	"mwrdijts", "mwsosl", "mwsqbgxzo", "mwtcbfuy",	/* 9832 */
+	"mwuqxfto", "mwuxtrzaynlytk", "mwvewq", "mwvjwxcfrld",	/* 9836 */
+	"mwvscauzuagic", "mww", "mwwgspeafz", "mwynxzlqnwn",	/* 9840 */
+	"mx", "mxacodxn", "mxb", "mxbdihfyvdq",	/* 9844 */
+	"mxbhbofrusqybh", "mxbhcq", "mxbtwh", "mxcbrrlue",	/* 9848 */
+	"mxczi", "mxemyyjzyyqpvc", "mxetwgqm", "mxglqvblzwik",	/* 9852 */
+	"mxiiknhlmahzqy", "mxildqkrn", "mxmm", "mxoub",	/* 9856 */
+	"mxoxk", "mxpmlgd", "mxqqgzaecz", "mxqwnurugekrb",	/* 9860 */
+	"mxrag", "mxs", "mxtez", "mxtievtmngr",	/* 9864 */
+	"mxtjct", "mxuvrdycwiatc", "my", "myancms",	/* 9868 */
+	"mybbr", "myc", "mydcfgne", "mydkspakyxas",	/* 9872 */
+	"myghaztctnxdt", "mygydzcdbrhd", "mygylo", "myimzahaqkaez",	/* 9876 */
+	"myitogvgyufryy", "mylfch", "myljkbfsfudhu", "mymowefyptfmvf",	/* 9880 */
+	"myoanqcc", "mypezosd", "mypnnn", "myprpemkczkrb",	/* 9884 */
+	"myqwy", "mysrfvgmnww", "mywm", "myxa",	/* 9888 */
+	"myxiprlfletux", "myxmpbhjqzh", "myxuoc", "myycax",	/* 9892 */
+	"myytlqopscau", "myzfzyrkjcqgqg", "myzjpmogwkvanq", "mz",	/* 9896 */
+	"mzbgeha", "mzbhmszrhshwd", "mzbuurjaqz", "mzcajzkzx",	/* 9900 */
+	"mzekhv", "mzf", "mzffxd", "mzfmqeuufsy",	/* 9904 */
+	"mzgb", "mzhnzpfogw", "mzjhjnl", "mzjhpjxyjkz",	/* 9908 */
+	"mzjpeuelxgfuc", "mzjre", "mzl", "mzlnf",	/* 9912 */
+	"mzmbrfa", "mzmztdgwukwsl", "mzngjtgmhu", "mzpgq",	/* 9916 */
+	"mzq", "mztpxdl", "mzuageuwcprq", "mzvkfbs",	/* 9920 */
+	"mzvvqifuzh", "mzwyeghh", "mzxdnm", "mzxifpvkgpxzne",	/* 9924 */
+	"mzxqd", "mzxtmhstifxgf", "mzxwahupkloj", "mzydplmjogkrsf",	/* 9928 */
+	"na", "naaox", "nabmmkwgczocpp", "nabwjm",	/* 9932 */
+	"nacuasraornlt", "nadag", "nadr", "naenemfowriky",	/* 9936 */
+	"nag", "nagl", "nahjogtaxbr", "naidin",	/* 9940 */
+	"nairliyx", "najnphqz", "nakt", "nanpcpyb",	/* 9944 */
+	"napqxm", "naqjhrntbyuts", "narrwrdkbg", "nasoxj",	/* 9948 */
+	"natkdcxlx", "nau", "navpugg", "nawbfmowalvkdd",	/* 9952 */
+	"nawmhjmb", "nb", "nbaezeek", "nbchb",	/* 9956 */
+	"nbdckoqzkwb", "nbdmuqmvfmo", "nbervpeobyl", "nbg",	/* 9960 */
+	"nbhct", "nbioc", "nbjsdmkzfcxdi", "nbl",	/* 9964 */
+	"nbmo", "nbn", "nbnrgtgjub", "nborgvkwmrqc",	/* 9968 */
+	"nbot", "nbpztqafkyc", "nbqjvqsqcevr", "nbryg",	/* 9972 */
+	"nbsmx", "nbtudrshfssma", "nbufbqoxziyur", "nbvschxhuihrch",	/* 9976 */
+	"nbw", "nbwoy", "nbxk", "nbxmvbuurnehm",	/* 9980 */
+	"nbyzthcsykerv", "nbzme", "ncanztehdhuhal", "ncbt",	/* 9984 */
+	"nccpwsilwznm", "ncd", "ncdyc", "nce",	/* 9988 */
+	"ncebhzuhxvbnd", "ncevicl", "ncfbhtfwrmrzyl", "ncg",	/* 9992 */
+	"ncgwlfbpgccfq", "ncgwxlyost", "ncirymvte", "ncivj",	/* 9996 */
+	"ncklsm", "nclgjgj", "ncmchm", "ncmo",	/* 10000 */
+	"ncouj", "ncqcej", "ncqn", "ncqxai",	/* 10004 */
+	"ncrcssqshw", "ncrirtcodd", "ncs", "ncsmjcuafhsnmv",	/* 10008 */
+	"ncsqakvij", "ncszccxgjzudcb", "nctaucxlvfp", "ncuxcarxnkeek",	/* 10012 */
+	"ncvoouxaquxa", "ndb", "ndcyosypaldxgw", "nddrpcgwgh",	/* 10016 */
+	"ndepnkd", "ndewkuuhvlc", "ndfelxjliex", "ndflvqwi",	/* 10020 */
+	"ndfqlazyfqs", "ndgt", "ndi", "ndicx",	/* 10024 */
+	"ndilijjjfnfdo", "ndjpegbmslsbec", "ndjsyfym", "ndnvqwsfxgi",	/* 10028 */
+	"ndnvyqwvrs", "ndnws", "ndryf", "ndsbuyv",	/* 10032 */
+	"ndsen", "ndslukpunv", "ndtbouzp", "ndtcwlswy",	/* 10036 */
+	"ndtjzfltub", "nduijeelz", "ndukpgd", "ndukyhszf",	/* 10040 */
+	"ndwubp", "ndwwukw", "ndxv", "ndy",	/* 10044 */
+	"ndygnoczkve", "ne", "neagsnnjyknfy", "nebybjp",	/* 10048 */
+	"necyszdyh", "nedjieagxmhcu", "neeig", "negzxaxdysgsx",	/* 10052 */
+	"nekfomsrveq", "nekt", "nengimvfixvsnl", "nepsu",	/* 10056 */
+	"neqpjdk", "nesojbqueqquiq", "nesznnvmpjdlhc", "neub",	/* 10060 */
+	"neulkntyhyrr", "neuvul", "nevrbbryqang", "nevy",	/* 10064 */
+	"newksirifphi", "newuefk", "nexxbbpgg", "nf",	/* 10068 */
+	"nfa", "nfd", "nfdecs", "nfdqkzzjhcdl",	/* 10072 */
+	"nffkyk", "nfgc", "nfgobamrbxpiv", "nfhlalnr",	/* 10076 */
+	"nfinashyievnp", "nfiywfwq", "nfjx", "nfmm",	/* 10080 */
+	"nfnorexrvii", "nfpbkfdcrzey", "nfpbycnndzu", "nfpflpbnufehd",	/* 10084 */
+	"nfpkkozr", "nfqwcc", "nfqx", "nfsapw",	/* 10088 */
+	"nftpoygbr", "nftsosba", "nfukaixvbq", "nfvbmlwvns",	/* 10092 */
+	"nfvuxsadgmn", "nfxesli", "nfxltz", "nfybeoitrwnk",	/* 10096 */
+	"nfzbcvmzdafm", "nfzfo", "nfzhahqrbu", "ng",	/* 10100 */
+	"nga", "ngbeficvilfsm", "ngcusbzonc", "ngehxuxapke",	/* 10104 */
+	"ngg", "ngge", "ngggvcg", "nghnohnbaohy",	/* 10108 */
+	"nghxihmhtafeek", "ngiennyabffqmh", "ngivtqtk", "ngjldl",	/* 10112 */
+	"ngjmqd", "ngjpaakib", "ngl", "ngmpm",	/* 10116 */
+	"ngng", "ngnykzcb", "ngour", "ngrggtrakjo",	/* 10120 */
+	"ngthjx", "ngtm", "nguawwa", "nguisjxilyesiz",	/* 10124 */
+	"ngvjbtcicinsg", "ngyqjvf", "ngyqvujph", "ngyreakwb",	/* 10128 */
+	"ngyweyqpz", "ngzmivzclmh", "ngzmrpftczp", "nh",	/* 10132 */
+	"nha", "nhbgqn", "nhclqikwbw", "nhcregorjtlf",	/* 10136 */
+	"nhdfuqrnzzan", "nhexxeegsgoz", "nhgekt", "nhgyucaezp",	/* 10140 */
+	"nhhgfh", "nhizazam", "nhkmgciuoeyp", "nhmga",	/* 10144 */
+	"nhmho", "nhmyhovwju", "nhnmksbjgpzh", "nho",	/* 10148 */
+	"nhow", "nhqh", "nhqwiipfbea", "nhu",	/* 10152 */
+	"nhuavvephgjwcb", "nhudfqb", "nhuvepyurt", "nhv",	/* 10156 */
+	"nhvithkkteyouq", "nhvwuwia", "nhwldlhwclvrvv", "nhyxjnincuuo",	/* 10160 */
+	"nhzbq", "nhzurkcqz", "nhzwpcteshdauj", "ni",	/* 10164 */
+	"niarzj", "nidblplrtign", "nieujyot", "nigecosejle",	/* 10168 */
+	"nigjrvldtrzw", "nigkldwdo", "nigrkfosjfwun", "nihbpg",	/* 10172 */
+	"niij", "nijso", "nijugktshrkozx", "nik",	/* 10176 */
+	"nikaielxeypcdm", "nikqj", "nillsijal", "nimtc",	/* 10180 */
+	"nimyentkalvfpq", "nioooxuxfzsyfb", "nipxdxde", "niqjxn",	/* 10184 */
+	"niqydkzerwr", "niqzrpfipkntnr", "nireijehgmdcvx", "nitywdw",	/* 10188 */
+	"niv", "nivbfkurmsir", "nivlmjvppfszmp", "nix",	/* 10192 */
+	"nixcgzyer", "nixziptnixebu", "niytfwidnbkkb", "nizndcr",	/* 10196 */
+	"nj", "njag", "njcp", "njcr",	/* 10200 */
+	"njdjzbpfirgeb", "njearyaxyalc", "njfajnewgusm", "njhaujfsbojrcq",	/* 10204 */
+	"njl", "njlmyltgj", "njlxpqcfujnr", "njlxx",	/* 10208 */
+	"njmgtgnemsv", "njmxn", "njncrexke", "njngaemwaspoy",	/* 10212 */
+	"njofsamsbqj", "njogumsic", "njojwfuzm", "njonxzy",	/* 10216 */
+	"njovduijlgqif", "njpwamcjesjz", "njrp", "njrvtubc",	/* 10220 */
+	"njvcnhnxzckh", "njvfozq", "njwnvvhkdaxdsl", "njwyj",	/* 10224 */
+	"njxcjtnsbcgrh", "njxzjg", "njzwthpxz", "nk",	/* 10228 */
+	"nkauil", "nkaulvbplbw", "nkbstopiv", "nkcaddzyop",	/* 10232 */
+	"nkdomr", "nkewrtni", "nkf", "nkgtbxaoas",	/* 10236 */
+	"nkjrgwjefh", "nkkjnrmd", "nkknbkn", "nklfgiobunn",	/* 10240 */
+	"nklqhh", "nkmuymaspb", "nknnyvhohw", "nkodg",	/* 10244 */
+	"nkovn", "nkpmzst", "nkriubvmuzzl", "nkrj",	/* 10248 */
+	"nksngrewiljo", "nkuympgqvqoc", "nkvn", "nkwdn",	/* 10252 */
+	"nkwl", "nkwvkhclhxlu", "nkxaixkua", "nkxhwb",	/* 10256 */
+	"nkxkjdyxd", "nkybrouykvn", "nkynkznfkn", "nl",	/* 10260 */
+	"nlbna", "nleqmj", "nleyqvvefalqfj", "nlhuke",	/* 10264 */
+	"nllhgvigzln", "nllqefzh", "nlm", "nlmctnhnu",	/* 10268 */
+	"nlobljmueebpht", "nlozmjyzmqf", "nlpmmgzdspfq", "nlqczjcopfhsar",	/* 10272 */
+	"nlqezcqw", "nlr", "nlrggceh", "nlrkqwpav",	/* 10276 */
+	"nlrlhyzcklkr", "nlugtdomtyxfdz", "nlvejkuspzft", "nlvnl",	/* 10280 */
+	"nlwvhuloahsl", "nly", "nlybf", "nlyvbxolfbuih",	/* 10284 */
+	"nlyxygxvof", "nm", "nmbx", "nmcidsi",	/* 10288 */
+	"nmdcmjbtks", "nmhblfh", "nmhmqkd", "nmic",	/* 10292 */
+	"nmipgg", "nmjansmdajsgij", "nmkvubkfzk", "nmloevkhsqjo",	/* 10296 */
+	"nmlqotdgvdilig", "nmlynekzffm", "nmn", "nmpzyfuet",	/* 10300 */
+	"nmr", "nmtacm", "nmtxkihyjafa", "nmugadaojifwp",	/* 10304 */
+	"nmv", "nmvbcaxoxhe", "nmvek", "nmwhfx",	/* 10308 */
+	"nmxsqnubv", "nmxycsngnbcngr", "nmywgse", "nn",	/* 10312 */
+	"nnablb", "nnam", "nnaqu", "nnb",	/* 10316 */
+	"nnchlbk", "nndagelcxctt", "nndbjf", "nngjkipcixgy",	/* 10320 */
+	"nngsbzv", "nnhcynnhnlf", "nnhwkaxuzwcyer", "nnixbozzk",	/* 10324 */
+	"nnjn", "nnjny", "nnkvbdaaimd", "nnlsfitzeru",	/* 10328 */
+	"nnmuipjzv", "nnocfiz", "nnoffyh", "nnplixdvwoto",	/* 10332 */
+	"nnpseskvkmhj", "nnq", "nnrccnqjs", "nnsi",	/* 10336 */
+	"nnsnyn", "nnsr", "nnszmxqztd", "nnt",	/* 10340 */
+	"nntwxax", "nnusg", "nnvledkp", "nnvwrhdmayl",	/* 10344 */
+	"nnwqwgy", "nnx", "nnxmngtfzpf", "nnxxsgntihkjp",	/* 10348 */
+	"no", "noacndxriufmea", "noakgbh", "noamuqnnomzbem",	/* 10352 */
+	"nobcskfues", "nobhnwpr", "nocyzyyghnqbau", "nognktyyf",	/* 10356 */
+	"nogze", "noi", "nojplnz", "nojwvwcdljxy",	/* 10360 */
+	"nokj", "nolcjtesjn", "nolgyikqpjdek", "nolxwuld",	/* 10364 */
+	"nomfrsfivtoclh", "nomtrteotpmdki", "nonossneu", "nooaxyau",	/* 10368 */
+	"noon", "nopw", "noqbzxcblof", "noqunohnbuv",	/* 10372 */
+	"noszmyut", "novlkn", "novyr", "novzmyiyeaidjv",	/* 10376 */
+	"noyxpco", "np", "npasyqgznrxu", "npavywnftbuss",	/* 10380 */
+	"npblakosp", "npbmtjzrdt", "npcmy", "npcsx",	/* 10384 */
+	"npddqvvqmr", "npdrrkbd", "npgncwjjhlmaof", "npgs",	/* 10388 */
+	"npgsdzc", "npitss", "npjt", "npjwdd",	/* 10392 */
+	"npkvqlbwmeyak", "npkzicujvq", "npmdfftcxcgzjs", "npncjo",	/* 10396 */
+	"npngpkvospm", "npnytzkml", "npohdgnfs", "nppqhnug",	/* 10400 */
+	"nprsjnatkqy", "npsmrat", "npt", "nptrtphzhl",	/* 10404 */
+	"npvhhynhcnb", "npvs", "npvzldiywzt", "npxxdo",	/* 10408 */
+	"npybkhcnckf", "npzglvqdmr", "nq", "nqa",	/* 10412 */
+	"nqadm", "nqakmf", "nqanhwmitayq", "nqascbx",	/* 10416 */
+	"nqbpdc", "nqfpthqurdmp", "nqighh", "nqiivuqfux",	/* 10420 */
+	"nqj", "nqjjqb", "nqk", "nqkrgiebbcxrvq",	/* 10424 */
+	"nqlcsnhxlgueg", "nqo", "nqqpgegzu", "nqrxeigbl",	/* 10428 */
+	"nqryy", "nqsddfgtja", "nqtdqmpwrlnde", "nqurzy",	/* 10432 */
+	"nqvli", "nqvlyq", "nqvxk", "nqyhvkhjx",	/* 10436 */
+	"nqyleqwmyvd", "nqyn", "nqzidyzkbw", "nqzybpgmh",	/* 10440 */
+	"nr", "nradq", "nrbhx", "nrbiceaafjzhy",	/* 10444 */
+	"nrcezdqsv", "nrdd", "nrddszkk", "nrebizlxq",	/* 10448 */
+	"nrekjorwzte", "nrgnlzkjxwmzuj", "nrgohntsqm", "nriroroamkfipa",	/* 10452 */
+	"nriuc", "nrjmubvtait", "nrjyqupocgycim", "nrkuappvpdqy",	/* 10456 */
+	"nrlazxpu", "nrlmaeldr", "nrlrm", "nrmdjyctofs",	/* 10460 */
+	"nrmxrzvxnwfa", "nrmyflkvyfjxi", "nrrxteuj", "nrsq",	/* 10464 */
+	"nrsxturafl", "nrv", "nrvtrqzxr", "nrx",	/* 10468 */
+	"nrxdeyxeifdie", "nryphg", "nrzgqt", "ns",	/* 10472 */
+	"nsaadil", "nsbgpwpea", "nscbwwjenqfahp", "nscylthxeoqvo",	/* 10476 */
+	"nsdgp", "nsggfhezoeyolz", "nsgsj", "nshe",	/* 10480 */
+	"nshtzg", "nshufcivtfhx", "nsiaazeypwy", "nsie",	/* 10484 */
+	"nsiyuftdris", "nsmawxjavdk", "nsnl", "nsod",	/* 10488 */
+	"nspejwvz", "nspojsimplqxp", "nsppfrkwb", "nssd",	/* 10492 */
+	"nssdrwdckv", "nsu", "nsufceudhw", "nsvvxvwnypujy",	/* 10496 */
+	"nswijiojz", "nsxdbzvqqtfu", "nsydic", "nsyn",	/* 10500 */
+	"nsyx", "nszsdlemrjr", "nszvczxu", "nt",	/* 10504 */
+	"ntcbdcqsxxrm", "ntcjnzjvnpndip", "ntcoxubdlrbf", "ntcpoydtx",	/* 10508 */
+	"ntdiqnbzyo", "ntdk", "nteppyfjrpgb", "ntfgzkregyuop",	/* 10512 */
+	"ntfmbitioyf", "ntghwzxfuatthp", "nthccempqcrut", "ntiqw",	/* 10516 */
+	"ntjldainwb", "ntl", "ntlgidbmkwk", "ntlwtttlvynn",	/* 10520 */
+	"ntmxalebzndo", "ntpaoqpqgdmaze", "ntplpzmtbas", "ntpxjlkpe",	/* 10524 */
+	"ntq", "ntrvalsif", "ntscfcqh", "ntsuxk",	/* 10528 */
+	"ntszc", "ntszrruqsyswps", "ntteu", "nttj",	/* 10532 */
+	"ntudvlerp", "ntvptgtndin", "ntxmzsctwvttgj", "ntxuxbzkbblvc",	/* 10536 */
+	"ntzdgogfo", "nu", "nuafilh", "nuamoredkewxh",	/* 10540 */
+	"nucwrlejqdsjlf", "nudoqqg", "nudvfhutkdg", "nugkxko",	/* 10544 */
+	"nuhcxnryriep", "nullablqiuzfbs", "num", "nunxwtozsuzbeh",	/* 10548 */
+	"nuogxdnvoho", "nuoxmwtyo", "nurm", "nusifwpr",	/* 10552 */
+	"nuuavhkb", "nuv", "nuwfrgqrpsuwcu", "nuwtnk",	/* 10556 */
+	"nuxktrwdujd", "nuxzsnj", "nuzby", "nuzcrafhjynr",	/* 10560 */
+	"nuzehvuxbp", "nv", "nvbgd", "nvds",	/* 10564 */
+	"nvdwfpx", "nveagigsxvua", "nvehpi", "nvfkyv",	/* 10568 */
+	"nvgzh", "nvhwpuapjjjbkv", "nvigfgm", "nvjur",	/* 10572 */
+	"nvkgkjboidh", "nvklplaaegbwgb", "nvmft", "nvmgiyajbiyc",	/* 10576 */
+	"nvne", "nvoc", "nvqmmzgdeurez", "nvrfh",	/* 10580 */
+	"nvsxvidiu", "nvtwcexmtw", "nvv", "nvvgyzrkj",	/* 10584 */
+	"nvwqxzrz", "nvxkfwkcjhh", "nvxrlrlwcmh", "nvxuftmjnbmr",	/* 10588 */
+	"nvy", "nvypeperjrcf", "nvz", "nvzqqxxmpa",	/* 10592 */
+	"nvzvrdxdiqlma", "nw", "nwa", "nwaq",	/* 10596 */
+	"nwcfnaxwx", "nwcqr", "nwctvalq", "nwdruif",	/* 10600 */
+	"nwgotcy", "nwi", "nwiwvzz", "nwkccc",	/* 10604 */
+	"nwlgxglvy", "nwlmnpsppx", "nwlmwmqnwhg", "nwnvssudqbqn",	/* 10608 */
+	"nwobc", "nwoiaqppxgbau", "nwomx", "nwphzhduqzutbm",	/* 10612 */
+	"nwpyqgh", "nwq", "nwqv", "nwqyvtw",	/* 10616 */
+	"nwrhiy", "nwscdfvncn", "nwtccbnh", "nwu",	/* 10620 */
+	"nwuhkviiciimw", "nwuoklackwfr", "nwvcvrfhufc", "nwxxhaxvhtmehr",	/* 10624 */
+	"nwzrmzux", "nx", "nxan", "nxbyuo",	/* 10628 */
+	"nxduitxpyc", "nxe", "nxebuqho", "nxekfcg",	/* 10632 */
+	"nxgligcwaft", "nxgpehlwen", "nxhija", "nxhpuibmlmon",	/* 10636 */
+	"nxjr", "nxl", "nxlivuy", "nxltzzhf",	/* 10640 */
+	"nxmdfr", "nxmuggebwr", "nxmwjlg", "nxnfuwfgs",	/* 10644 */
+	"nxocpu", "nxorfv", "nxpooigerweu", "nxpr",	/* 10648 */
+	"nxrlgooh", "nxsenzzsgn", "nxt", "nxtjezbd",	/* 10652 */
+	"nxtjfeuglg", "nxvi", "nxvtk", "nxwqotkemcjnan",	/* 10656 */
+	"nxxf", "nxxmegeknt", "nxxywyguuwluq", "nxyehmzq",	/* 10660 */
+	"nxznkgomiq", "ny", "nyaumenebj", "nycqsobng",	/* 10664 */
+	"nydasdbwnvv", "nyeiaezifsuukw", "nyeozal", "nyfenfla",	/* 10668 */
+	"nyfjmeepuh", "nyj", "nykqa", "nymgnacivlc",	/* 10672 */
+	"nymlnz", "nymqqcpe", "nynihpl", "nynywtiv",	/* 10676 */
+	"nyo", "nyowplrxpzdpdj", "nyqb", "nyqzsavdcd",	/* 10680 */
+	"nyriomuz", "nyrjksux", "nyrkmwykfz", "nys",	/* 10684 */
+	"nysocisiokeui", "nytkpaa", "nyvlb", "nyyipdib",	/* 10688 */
+	"nyyzhdx", "nz", "nzcmfekg", "nzeraznrk",	/* 10692 */
+	"nzf", "nzg", "nzhgipjere", "nzhswgrrmypdp",	/* 10696 */
+	"nzibcej", "nzilybwdatzzns", "nzioknmtw", "nzjysvah",	/* 10700 */
+	"nzlbb", "nzlhfmwslwtle", "nzmez", "nznyxvl",	/* 10704 */
+	"nzo", "nzoble", "nzthuggbtabyvi", "nztopfumxo",	/* 10708 */
+	"nzwnspmktmqm", "nzxg", "nzxxvgw", "nzzwffnlydqx",	/* 10712 */
+	"oa", "oaccehgsczsaer", "oacfwhbqbkcw", "oadaiiuukk",	/* 10716 */
+	"oadlrqjyphhnrb", "oaea", "oafdfzp", "oafllaasvmjeuk",	/* 10720 */
+	"oafxakqojhj", "oafzxizvtgzn", "oaio", "oaj",	/* 10724 */
+	"oajf", "oajkl", "oakjriesgszeex", "oal",	/* 10728 */
+	"oalohq", "oanbnmwbv", "oaoltu", "oaouwfwpuihguk",	/* 10732 */
+	"oappkrnu", "oapttds", "oaqzoobdu", "oasoj",	/* 10736 */
+	"oastluhbjos", "oasv", "oatmjehtscpyze", "oaufapp",	/* 10740 */
+	"oauspksuded", "oavv", "oawcqubsjsgml", "oawdyuavtwtk",	/* 10744 */
+	"oaxuq", "oaxwdv", "oaycjg", "oazisbbayr",	/* 10748 */
+	"ob", "obcigfl", "obdcmmyiguv", "obdpis",	/* 10752 */
+	"obequu", "obesdsendfiv", "obffedf", "obhidjaqwkeon",	/* 10756 */
+	"obiwmluby", "objylq", "obljrugixifjqk", "obmgef",	/* 10760 */
+	"obnefocutffu", "obnzfphub", "obosce", "obpcqhlfamhcuz",	/* 10764 */
+	"obpoelwxdzew", "obqihilr", "obrsvasblu", "obshszlhgs",	/* 10768 */
+	"obtjhpi", "obtmo", "obuwelng", "obvf",	/* 10772 */
+	"obxgyi", "obxukjjvxmjz", "obychitrt", "obypw",	/* 10776 */
+	"obz", "obzyidxvcbuucp", "oc", "oca",	/* 10780 */
+	"ocb", "occai", "occjphgwhme", "occo",	/* 10784 */
+	"ocebkvt", "ocegtcqn", "oceykvpxhjeh", "ocliuwfcykgyki",	/* 10788 */
+	"oclwjdmpxviy", "ocmarihbzd", "ocmtzbiv", "ocmx",	/* 10792 */
+	"ocnmjmbr", "ocpkzhaxsfold", "ocppwczeem", "ocqfddkxuepuh",	/* 10796 */
+	"ocubsrcgwho", "ocupnkxz", "ocvxbtp", "ocw",	/* 10800 */
+	"ocwtxdmnohp", "ocx", "ocxmur", "ocyolztx",	/* 10804 */
+	"oczhqc", "oczzsfa", "od", "odajfhffgmyxvk",	/* 10808 */
+	"odanf", "odasj", "odbaratidvijfy", "odbhdteppl",	/* 10812 */
+	"odbtgmzlxe", "odbymmozfq", "odcqhjmyzql", "odd",	/* 10816 */
+	"odeft", "odfzczu", "odgl", "odhh",	/* 10820 */
+	"odhwzkgfeuiwe", "odhyehgccp", "odjgn", "odjrtdb",	/* 10824 */
+	"odkkmumjchx", "odle", "ododfuiqpxya", "odosoxosgab",	/* 10828 */
+	"odpdcbshikgn", "odpiekwrnrp", "odrd", "odslabjducv",	/* 10832 */
+	"odugpn", "odvyj", "odvzdq", "odwjirhw",	/* 10836 */
+	"odwypeixomtr", "oe", "oebleiwjllolmo", "oeccba",	/* 10840 */
+	"oeceq", "oecft", "oecuz", "oecxdkb",	/* 10844 */
+	"oee", "oeen", "oeetmfxfask", "oef",	/* 10848 */
+	"oefphd", "oegdorxhxeqpeu", "oeikzjsrkbjg", "oejfmfhhan",	/* 10852 */
+	"oejphzugdiaxpp", "oejtpns", "oeknagibzqxjbq", "oekrsdcy",	/* 10856 */
+	"oel", "oemchmrmxgb", "oemdxgrftqoik", "oemjrjfw",	/* 10860 */
+	"oen", "oengm", "oenmpj", "oeprji",	/* 10864 */
+	"oeptbllxk", "oeqoq", "oeqy", "oesmzbduduj",	/* 10868 */
+	"oet", "oetsnqhcen", "oetydjn", "oeu",	/* 10872 */
+	"oevtg", "oewgykdlmkk", "oewlbiderihtx", "oex",	/* 10876 */
+	"oexfqtte", "oexich", "oeycggynssw", "oeygc",	/* 10880 */
+	"oeypmgxgtbk", "of", "ofbkgceyamvumi", "ofcnhdimvikf",	/* 10884 */
+	"ofcwtbue", "ofegvdndnh", "offsl", "ofgfvobzcviunr",	/* 10888 */
+	"ofgqpautxop", "ofikqohgcv", "ofkfkvumjl", "ofnwpnxbdgrtm",	/* 10892 */
+	"ofouzjyuetl", "ofqdyhfrxjm", "ofrcepqlonqe", "ofsh",	/* 10896 */
+	"ofsr", "oftrorfk", "oftupzqn", "ofugazxmwkhq",	/* 10900 */
+	"ofurxtzscuo", "ofv", "ofxbeyav", "ofxvslxqwy",	/* 10904 */
+	"ofz", "ofzozxrb", "og", "ogagzvsjfp",	/* 10908 */
+	"ogarshainqlj", "ogcrf", "ogcsrgtqspa", "ogcxfzgdxcib",	/* 10912 */
+	"ogdbkhyfbldfg", "ogdlxhpbu", "ogdwqnuqdpx", "ogehxgdakjv",	/* 10916 */
+	"ogfiurvros", "ogi", "ogina", "ogjab",	/* 10920 */
+	"ogje", "ogjsbu", "ogkgfagwv", "ogkutdhq",	/* 10924 */
+	"oglxguorlt", "oglzzklmgunm", "ogmp", "ogmucgwznfob",	/* 10928 */
+	"ogosuqlgchknp", "ogrlrxpjpgdc", "ogrt", "ogs",	/* 10932 */
+	"ogsvoe", "ogt", "ogtcag", "ogtdrwii",	/* 10936 */
+	"ogzblo", "oh", "ohbiew", "ohcekxmalx",	/* 10940 */
+	"ohcjxdymkgcva", "ohdqfpbvv", "ohffdhxlplzysw", "ohfvzjmwpnvahg",	/* 10944 */
+	"ohgu", "ohgv", "ohheukwqf", "ohikyporb",	/* 10948 */
+	"ohilzklipeaqz", "ohimpwyxjx", "ohivmojwmaryna", "ohjyjqiuntn",	/* 10952 */
+	"ohkwadmxmg", "ohlajsverqwyuq", "ohmpxtonpi", "ohmywtitajqp",	/* 10956 */
+	"ohnsviomhef", "ohoiztlfewp", "ohrtobxfth", "ohu",	/* 10960 */
+	"ohwuvrj", "ohxin", "ohzlmrrgfz", "oi",	/* 10964 */
+	"oia", "oib", "oibpuupofvfueo", "oibzquw",	/* 10968 */
+	"oidwht", "oidyncoe", "oif", "oiioyunrkpi",	/* 10972 */
+	"oiixwivbihzgb", "oijjovvlx", "oimonggudwn", "oip",	/* 10976 */
+	"oipcxloj", "oipf", "oiqlrpgo", "oissipuql",	/* 10980 */
+	"oiudjj", "oiupp", "oivydwhztq", "oiyecxe",	/* 10984 */
+	"oiyrdzpeqtb", "oiyzmjd", "oizpmfhp", "oj",	/* 10988 */
+	"ojaqaejj", "ojbwlcunkxgt", "ojekthqci", "ojembyeixev",	/* 10992 */
+	"ojfnfnkl", "ojfpd", "ojhfqjecbr", "ojl",	/* 10996 */
+	"ojnbe", "ojnic", "ojnrxyeau", "ojnwxmmdystj",	/* 11000 */
+	"ojnywstfyjvsqv", "ojpdphwfz", "ojq", "ojqbvvyhb",	/* 11004 */
+	"ojqly", "ojqs", "ojraorcjujg", "ojrtrzpl",	/* 11008 */
+	"ojszxurg", "ojtirsqbqgwaz", "ojusilluur", "ojvjhhud",	/* 11012 */
+	"ojvli", "ojvyqrmctps", "ojwulydaokvs", "ojwzpcymlrfbzb",	/* 11016 */
+	"ojxjdft", "ojygznngtotgsf", "ojyjaauxbm", "ojyqqwodzbj",	/* 11020 */
+	"ok", "okaee", "okaqbli", "okauvakjpph",	/* 11024 */
+	"okeosbwlh", "okfxwho", "okgaslztdkltxe", "okhrlzeicjfgs",	/* 11028 */
+	"okjpzyka", "okkfwsejqww", "okm", "oknt",	/* 11032 */
+	"okoibqlgh", "okplseiapb", "okqdavbe", "okqjvfxftmmux",	/* 11036 */
+	"okqytbsd", "okrjxwqp", "okrrzztyks", "oksy",	/* 11040 */
+	"okwcvxscol", "okysrylvat", "okyuhtftmk", "okyxbkjn",	/* 11044 */
+	"ol", "ola", "olax", "oldh",	/* 11048 */
+	"olg", "olga", "olhuni", "olktwneze",	/* 11052 */
+	"ollogfefsqlqnr", "olmwncfogj", "olnwaktzliw", "olovlkj",	/* 11056 */
+	"olowdu", "olqifhtfsuz", "olqzdgo", "olsdaq",	/* 11060 */
+	"olsodg", "olueqi", "olunqlsqpfdvw", "olwlbcefjfzr",	/* 11064 */
+	"olx", "olztjtubamwyqv", "olzv", "olzxs",	/* 11068 */
+	"om", "omabyzjgjwh", "omapepx", "omcc",	/* 11072 */
+	"omdnstuvfpamho", "omf", "omfqmlfdpr", "omfsxuphcxiyu",	/* 11076 */
+	"omhhjfxlfqit", "omhvraqulslfan", "omiglnkizlr", "omiiekfhqf",	/* 11080 */
+	"omivhrumeq", "omjzfw", "omkuiiuuhhbs", "ommkrnzmdmpnp",	/* 11084 */
+	"ommqgyccwck", "omnxealjd", "omqy", "omrdspie",	/* 11088 */
+	"omrpv", "omtq", "omtsomnmq", "omuxrkkrvowki",	/* 11092 */
+	"omvc", "omwohhjvfn", "omydtcwabrcjpy", "omzk",	/* 11096 */
+	"omzkoc", "on", "onbrxtmzzned", "onbsjwgahy",	/* 11100 */
+	"onbxwiixcyik", "ondd", "ondhzxal", "ondi",	/* 11104 */
+	"ondugwcidv", "one", "oneesfulsp", "onevjacjaaxxc",	/* 11108 */
+	"onhubtwodqqpwz", "onjat", "onjccolxalhsk", "onjklfyjspfan",	/* 11112 */
+	"onk", "onlfgmpcrp", "onmbtrkadgmh", "onmvqzphwjxoa",	/* 11116 */
+	"onmyje", "onmzdatgnf", "onouivp", "onqsq",	/* 11120 */
+	"onsfvtbnsgxod", "onsgdmvzu", "onsjy", "ontedpasm",	/* 11124 */
+	"ontlfadgdp", "ontpdngiirnixc", "onvjlxkihom", "onwabohvtchh",	/* 11128 */
+	"onwndrvl", "onxap", "ony", "onypxojagz",	/* 11132 */
+	"onyxwieloszirs", "onzhxjt", "onzzszkyxdy", "oo",	/* 11136 */
+	"oobcrgumel", "oofdrsym", "oogpjrcmrt", "oogrpyn",	/* 11140 */
+	"oohdmblwu", "ooi", "ooiktscsnsc", "ooillmq",	/* 11144 */
+	"ooimzikhtz", "ookhxg", "ookqkgoxzim", "oolhqogwpkwuem",	/* 11148 */
+	"oolo", "oom", "oomqszkcwz", "oonjve",	/* 11152 */
+	"oonl", "oooalqbk", "ooocrizlkwn", "oooyxic",	/* 11156 */
+	"oopwhxjqja", "ooqcvadpaxcwrh", "oorlmcqck", "ooswc",	/* 11160 */
+	"ootkwq", "oovk", "oovlnmztdubb", "oowcevpca",	/* 11164 */
+	"oowxuzqdieg", "ooxkiylq", "ooxmrowbsq", "ooydnmpwl",	/* 11168 */
+	"ooz", "op", "opbamvwdsbxq", "opd",	/* 11172 */
+	"opdqgdqxtjfsm", "opeahqvfropa", "opfrrxe", "opgkzplhgqivq",	/* 11176 */
+	"opgqtsqlnxc", "opgsrb", "ophdfqto", "ophngae",	/* 11180 */
+	"opicutbpmsy", "opj", "opmtemi", "opnqzlbpimjqc",	/* 11184 */
+	"opnxv", "opnzbamca", "opp", "oppfswrqyxka",	/* 11188 */
+	"opqnr", "opt", "optssqj", "opttglbwhgdbjx",	/* 11192 */
+	"opukzrwbcs", "opusvknuft", "opvcelbprp", "opvhm",	/* 11196 */
+	"opw", "opxtxyvthb", "opxwmtizwhgxf", "opyfdktaua",	/* 11200 */
+	"opyzecwgvd", "opzfmghfoosg", "oq", "oqarjapgyej",	/* 11204 */
+	"oqcacfrjimvmec", "oqdmwz", "oqepebgwmkuxip", "oqkoejvn",	/* 11208 */
+	"oqleklozgwd", "oqm", "oqmlyxhqeffi", "oqnxan",	/* 11212 */
+	"oqohtkp", "oqousuycy", "oqpihbeus", "oqqvvuxyzburb",	/* 11216 */
+	"oqrzuoxbezd", "oqs", "oqskvaolllluex", "oqswxpyt",	/* 11220 */
+	"oquhlxomuqfmjr", "oquu", "oqvcwwxwtcxr", "oqwzpzkpwrs",	/* 11224 */
+	"oqxhvukgbyzuj", "oqxqhy", "oqzmxboxj", "oqzojqlwd",	/* 11228 */
+	"or", "oradxkxxzr", "orbeafadlnjg", "orcn",	/* 11232 */
+	"orcrupepaijasy", "orcyv", "ordrjabjavqcp", "orecftvghqsn",	/* 11236 */
+	"orewaiv", "org", "orgktobe", "orhh",	/* 11240 */
+	"orhkrk", "orkiizczfdawz", "orkpnindyqcxg", "orly",	/* 11244 */
+	"ornfiwfeg", "orngo", "orniaolajkxe", "ornmp",	/* 11248 */
+	"orppb", "orq", "orrafzy", "oruvrba",	/* 11252 */
+	"orx", "orylcnm", "orz", "os",	/* 11256 */
+	"osaauthigf", "osbzwpylbz", "osczmpjsehsxg", "osdrpgs",	/* 11260 */
+	"osdxid", "osegqvah", "oser", "oseragexkbbxp",	/* 11264 */
+	"osexjzs", "osfaen", "osfhfgntstvc", "osgwvryzmrbk",	/* 11268 */
+	"oshoaohhri", "oshonbepzl", "oshseqivljhr", "oslfcighw",	/* 11272 */
+	"oslry", "osn", "osnhjsvm", "osnocmfnl",	/* 11276 */
+	"ospelevg", "osphlsh", "osq", "osqzdvo",	/* 11280 */
+	"osshlfb", "osssew", "ossxfhooc", "osuiaoo",	/* 11284 */
+	"osuxegqj", "osuy", "osx", "osxsmpjg",	/* 11288 */
+	"osxtcoi", "oszj", "oszrwia", "ot",	/* 11292 */
+	"ota", "otcsufqtw", "otdq", "otdrzakwqruvta",	/* 11296 */
+	"otdxxjvxup", "otfg", "otfxyt", "otgvgmkywoiif",	/* 11300 */
+	"othb", "otign", "otiqdrxpktpvr", "otiuramkmydt",	/* 11304 */
+	"otjjlzc", "otjtcdemxk", "otjvwiihelmdvq", "otlbzbd",	/* 11308 */
+	"otlj", "otlpse", "otmbiz", "otmcbojlyusfej",	/* 11312 */
+	"otmj", "otnd", "otnkqzmtlgmtv", "otokrozwpclf",	/* 11316 */
+	"otpfivqjsyzmtr", "otpgulxresi", "otqi", "otqit",	/* 11320 */
+	"ottejlvpmwflpl", "otttyoug", "ottwitqwibznm", "otuaorxlmkgfr",	/* 11324 */
+	"otucfyliqkkw", "otuibk", "otwdzebqrrbvug", "otwwu",	/* 11328 */
+	"otxbdmny", "otxnnvs", "otyqnusfqbi", "ou",	/* 11332 */
+	"ouavc", "oubu", "oucioy", "oucrjukuun",	/* 11336 */
+	"oucuqoe", "oudffdpzkubrsy", "ouek", "ouelhsxqvvp",	/* 11340 */
+	"oufnih", "oufyjwcj", "oug", "ougnqjmus",	/* 11344 */
+	"ouhu", "oujsnovzt", "oujzit", "oukfu",	/* 11348 */
+	"oulqr", "oulwqsismp", "ouncnncxth", "ounmhpghmdw",	/* 11352 */
+	"ounws", "ounzte", "oupjcyzpw", "oupjx",	/* 11356 */
+	"ourpjub", "oustcskdj", "outjgunwvy", "outmguqg",	/* 11360 */
+	"outvccvepli", "outzhrp", "ouury", "ouvupzo",	/* 11364 */
+	"ouwg", "ouwj", "ouyuxpc", "ouywmcbw",	/* 11368 */
+	"ouyzfwxo", "ouzvtuijz", "ovcfqc", "ovctcvsorst",	/* 11372 */
+	"ovcwziuk", "ovdwvcbza", "ovemzjueiypnv", "ovflelq",	/* 11376 */
+	"ovgmyapoyzx", "ovhofy", "ovix", "ovmkzfcbmymc",	/* 11380 */
+	"ovmqpexjzwc", "ovnrgfzhlkxjcy", "ovqzrvqwahgylz", "ovrfxm",	/* 11384 */
+	"ovrmk", "ovsoeoxfxydk", "ovswrbetarnqf", "ovudbfrknln",	/* 11388 */
+	"ovvjqhq", "ovvpvummkht", "ovvqskhxwymy", "ovwxgkimbp",	/* 11392 */
+	"ovxztydxsjpgl", "ovzesyq", "ow", "owcgfkxj",	/* 11396 */
+	"owdxedse", "owebksw", "owgrtjfmikkjdd", "owi",	/* 11400 */
+	"owif", "owiwr", "owjprnnqxt", "owkoznhzfnix",	/* 11404 */
+	"owkqnwvu", "owmwsak", "ownnv", "ownwmjvemnylzo",	/* 11408 */
+	"owotildpxaqum", "owpgvqoldkykm", "owq", "owqv",	/* 11412 */
+	"owroatfonr", "owsblqs", "owswsfnkgpthub", "owu",	/* 11416 */
+	"owuggdbrbpithq", "owwd", "owwgyft", "owx",	/* 11420 */
+	"owxnexswg", "owxxdxryb", "owymyhltbo", "ox",	/* 11424 */
+	"oxalb", "oxcd", "oxck", "oxdhbxkkmhzxw",	/* 11428 */
+	"oxflwwmmllwo", "oxg", "oxgcbzqgt", "oxghpnihedatr",	/* 11432 */
+	"oxgm", "oxgoypqlgbyt", "oxhasztnl", "oxhgnp",	/* 11436 */
+	"oxhmasmhm", "oxhtlmqctrqx", "oxhxa", "oxi",	/* 11440 */
+	"oxjninvljjunhm", "oxl", "oxnudq", "oxpdjlhdpenb",	/* 11444 */
+	"oxrlcamnuoe", "oxsuxagb", "oxszvyzrnaazoy", "oxvfjogljp",	/* 11448 */
+	"oxvgqgd", "oxvinhqlsts", "oxwrdgbzgut", "oxxmbcrd",	/* 11452 */
+	"oxzq", "oy", "oycmrswbt", "oycqaqgdbva",	/* 11456 */
+	"oydaacbgzzyg", "oyddggizviy", "oydsocytk", "oye",	/* 11460 */
+	"oyenicizsi", "oyeoyckctrw", "oygabdlgxxkou", "oygjpzihpueq",	/* 11464 */
+	"oyjbgdoumcwjxx", "oyl", "oymfsqejnjyxy", "oynlqcsmrozuwy",	/* 11468 */
+	"oynlyzfcfwt", "oyomzncunsjjn", "oyooze", "oyoyrojnwtq",	/* 11472 */
+	"oypjzhy", "oyqmjpoelgzbfm", "oysei", "oysfvky",	/* 11476 */
+	"oysqykeylze", "oytsovkciqqd", "oyujakffvb", "oyumuw",	/* 11480 */
+	"oyvdhtlbc", "oywrevgcvds", "oyxcmlvornz", "oyxmmivcvhdppj",	/* 11484 */
+	"oyxocxel", "oyxxjzkvrrqlrr", "oyyabvllseu", "oz",	/* 11488 */
+	"ozabibqpxugl", "ozbwowqtpjrmnz", "ozbyrv", "ozcgnhtbth",	/* 11492 */
+	"ozcmlajg", "ozd", "ozdkyymhoocm", "ozdvbhjdjuo",	/* 11496 */
+	"ozerliithowpyx", "ozfe", "ozftxcnoeyiu", "ozgvt",	/* 11500 */
+	"ozhnrqola", "ozi", "ozivppllilueyc", "ozjcm",	/* 11504 */
+	"ozkcbjgkbw", "ozlaiqs", "ozlsywvascx", "ozmdbtkookoiz",	/* 11508 */
+	"ozmhkh", "ozmod", "ozoavtwko", "ozot",	/* 11512 */
+	"ozqxpdy", "ozqyftqjew", "ozt", "oztfgiu",	/* 11516 */
+	"oztgyxr", "ozud", "ozvkymqrnt", "ozvlb",	/* 11520 */
+	"ozvuc", "ozxzbmcaq", "ozyfmupsfb", "ozyuck",	/* 11524 */
+	"ozzgemmgp", "pa", "pabajrdy", "pacbsi",	/* 11528 */
+	"padxxpyc", "paebvqy", "paexx", "pafio",	/* 11532 */
+	"paflavewbrqbg", "pah", "pahoflbr", "pajbkmujawwww",	/* 11536 */
+	"palftgskujj", "paljcztwiimq", "pallo", "palwwnkixjj",	/* 11540 */
+	"pam", "pamlxwrdslce", "panokfhppkc", "papcev",	/* 11544 */
+	"paqdxzwz", "paqmung", "par", "paranof",	/* 11548 */
+	"parhgtb", "pasgcl", "pavczo", "pawrkng",	/* 11552 */
+	"paxqvsmv", "payax", "paygftuxzzk", "paywjsipddwa",	/* 11556 */
+	"pazpdizs", "pb", "pbcbmipcogtlnm", "pbcic",	/* 11560 */
+	"pbclnre", "pbcqmc", "pbdqkfaaueud", "pbeebnbvucsj",	/* 11564 */
+	"pbfng", "pbiccehmw", "pbikmnljtn", "pbisaw",	/* 11568 */
+	"pbisoiswxuigh", "pbjmo", "pbjmuubnukxcp", "pbkhtjfuoblop",	/* 11572 */
+	"pblvfmcplzsefn", "pbpmpux", "pbq", "pbrddfx",	/* 11576 */
+	"pbsim", "pbtpeyjzovns", "pbucerpsegl", "pbupozklfrflav",	/* 11580 */
+	"pbvrilgsisar", "pbvtzk", "pbwbffmrrqgh", "pbwjpch",	/* 11584 */
+	"pbwp", "pbwvn", "pbzqln", "pbzvs",	/* 11588 */
+	"pc", "pcamzlg", "pcazhldqvsffn", "pccr",	/* 11592 */
+	"pce", "pcfeftpcwulrpr", "pcgdfn", "pcgjkokpqji",	/* 11596 */
+	"pcgrqj", "pcjpdjdwbhyr", "pckpbppcyiu", "pcmafyzoepws",	/* 11600 */
+	"pcmyer", "pcnnslmhvjhwbo", "pcojinhhpm", "pcorhk",	/* 11604 */
+	"pcpuaiccnotsey", "pcqzidhdnmedvo", "pcrxnwwhzfan", "pcsrnefbm",	/* 11608 */
+	"pcsuxxzlv", "pct", "pcvp", "pcvzf",	/* 11612 */
+	"pcxkciwzqjv", "pcxue", "pczl", "pcznhbnpjs",	/* 11616 */
+	"pd", "pdas", "pdbkfyrfcz", "pdbtmo",	/* 11620 */
+	"pdeilidi", "pdeuoqrxswq", "pdgcf", "pdhacxffhaxqy",	/* 11624 */
+	"pdhhfjuibakca", "pdhqlposdpednl", "pdisr", "pdkjczbbgxfho",	/* 11628 */
+	"pdkkuuwkge", "pdkqqakolbkwi", "pdkyx", "pdlxsbfpbq",	/* 11632 */
+	"pdmnbmcqvqrsn", "pdpcuxlvxfqz", "pdqhtxuxinlz", "pdqwguw",	/* 11636 */
+	"pdrggm", "pdrvttmymjlv", "pdsqlaxmlgehi", "pdxcksyprudwgq",	/* 11640 */
+	"pdxlaotacr", "pdxwwwmxhztqc", "pdxyhf", "pdzjekolhpwq",	/* 11644 */
+	"pe", "peaidclwr", "pebpfj", "pecl",	/* 11648 */
+	"peconvslalzhtn", "pedunp", "pefvqrp", "pefy",	/* 11652 */
+	"pegqnvdrnkbl", "pegtg", "pehkqqxljrtxo", "pejhvtn",	/* 11656 */
+	"pelsmhncdt", "penbinsusvrkml", "peprbvi", "peprvbs",	/* 11660 */
+	"pequrywajt", "peqwcksif", "pesdbi", "pesfxq",	/* 11664 */
+	"pevqsjyibwgqmw", "pewjigxscutuw", "pexdwtn", "pezj",	/* 11668 */
+	"pezx", "pf", "pfa", "pfbjizhgdbnyof",	/* 11672 */
+	"pferaxitobtxm", "pffdusls", "pfhhpxcb", "pfhpsnsk",	/* 11676 */
+	"pfjabsraxfus", "pfjntovtjintj", "pfknh", "pfko",	/* 11680 */
+	"pfmlnwqqjdsq", "pfpllcthkijkn", "pfpmy", "pfqqi",	/* 11684 */
+	"pfrjkjr", "pfrreuopav", "pfthsd", "pftslfyzd",	/* 11688 */
+	"pfuooo", "pfwmeokddzy", "pfxmynjehiiig", "pfysqrnxzyvz",	/* 11692 */
+	"pfzvbfwgrznswn", "pg", "pgaepot", "pgcb",	/* 11696 */
+	"pgctnqcob", "pgdshs", "pgg", "pggmjm",	/* 11700 */
+	"pggzvmwv", "pghjtgessxjll", "pgjfwjmtzsike", "pgjhetz",	/* 11704 */
+	"pgjxrgxo", "pgl", "pgmihmapclairj", "pgnaanxkxmpgr",	/* 11708 */
+	"pgnwix", "pgohoixp", "pgokaoayznaylw", "pgomdid",	/* 11712 */
+	"pgpogcphqcnrkl", "pgptlowdndnos", "pgrazryqm", "pgsbhlkxlymp",	/* 11716 */
+	"pgtrrieaddqb", "pgtu", "pgus", "pgv",	/* 11720 */
+	"pgykpewcqi", "pgyqkeyaaanow", "pgzx", "ph",	/* 11724 */
+	"phafpwphdzkb", "phalafjeii", "phcgidb", "phfmyqgpav",	/* 11728 */
+	"phg", "phizonwetiwo", "phkgjks", "phkl",	/* 11732 */
+	"phlxssgzjfoyxy", "phnuyxpc", "phpkb", "phqiuvtfcovz",	/* 11736 */
+	"phr", "phrq", "phssrvklzwhwbi", "phtuhdmefyz",	/* 11740 */
+	"phtz", "phucqpnzz", "phuifeok", "phuvfvommh",	/* 11744 */
+	"phvpvpzpufnoye", "phxdok", "pi", "piavf",	/* 11748 */
+	"pibilqzyoyo", "pibojwdlcbo", "picuttqwtkuix", "pidvnqxvdyhisu",	/* 11752 */
+	"pidxtbtbdla", "piesoaut", "pifv", "pihoxlbumjjq",	/* 11756 */
+	"piimcmwpesog", "piizagzd", "pijk", "pikbixhyugnsj",	/* 11760 */
+	"piowvirbeezg", "pipoqctaqzomwg", "pirqcanzhqdlj", "pitqlgogilszjt",	/* 11764 */
+	"piuusxswh", "piuwinsptbjqz", "pivzhehfcimg", "piwsheqtfni",	/* 11768 */
+	"pixfr", "pixmforb", "pixrqn", "pixztvq",	/* 11772 */
+	"piywlqahptaqo", "pizud", "pj", "pjacokiz",	/* 11776 */
+	"pjblm", "pjdh", "pjepfiqmenkyk", "pjesnaxezaj",	/* 11780 */
+	"pjintzronk", "pjjhmncqyilter", "pjjzhs", "pjkgupegmwl",	/* 11784 */
+	"pjkvqidzqhuyf", "pjky", "pjmwzksafqe", "pjn",	/* 11788 */
+	"pjo", "pjoooggdsuntm", "pjoqlfk", "pjpnpaewkfhdny",	/* 11792 */
+	"pjql", "pjretbqsh", "pjv", "pjvdsvua",	/* 11796 */
+	"pjvtyxpnlxmwcb", "pjxfdtzhcrn", "pjxwwvd", "pjybykgswgoa",	/* 11800 */
+	"pjyfxyfgtht", "pjzvvfl", "pk", "pkckuarmsji",	/* 11804 */
+	"pkgwat", "pkhh", "pki", "pkij",	/* 11808 */
+	"pkjvviof", "pkmirymgnlcwr", "pkmllrghfufbn", "pkpmwcwzfepf",	/* 11812 */
+	"pkpnoeangl", "pkqeve", "pkrh", "pksjcx",	/* 11816 */
+	"pksmpgbjzhvaii", "pktefe", "pkuggaowljztb", "pkwzohludsjxsv",	/* 11820 */
+	"pkxggv", "pkyozuiteccmst", "pkzwunfljvbvl", "pkzwyzkq",	/* 11824 */
+	"pl", "plalgwzec", "plapadvusvt", "plbihbkrv",	/* 11828 */
+	"plclndfccyzpm", "plcrgarvoiyfz", "pldw", "plfgprgqx",	/* 11832 */
+	"plfmfxoifnizp", "plgbqnhp", "plhtfvuupzbd", "pliwerolvijwo",	/* 11836 */
+	"plj", "plkx", "plnd", "ploymgnkw",	/* 11840 */
+	"plqtxvgzdwzfak", "plqvvdga", "plskcff", "pltrq",	/* 11844 */
+	"plvkoyx", "plwlke", "plydsxwvy", "plyvnfpxv",	/* 11848 */
+	"pm", "pmamrxrxofssl", "pmauvbdytdm", "pmcubjbmx",	/* 11852 */
+	"pmdjqmpjqrtlvz", "pmet", "pmfkc", "pmh",	/* 11856 */
+	"pmjk", "pmlfviaawikn", "pmlnbc", "pmmewnninspoum",	/* 11860 */
+	"pmmjbnaefam", "pmpi", "pmpogwptkhil", "pmpyto",	/* 11864 */
+	"pmrfcwsuo", "pmrfyg", "pmtsvemnbqqvod", "pn",	/* 11868 */
+	"pnaldbl", "pncowzenit", "pncwqngjs", "pndblukjbj",	/* 11872 */
+	"pndr", "pnev", "pnfyhkdyd", "pngauusn",	/* 11876 */
+	"pngauzjiaktgxr", "pngcma", "pnhergezycrm", "pnizpepppfmey",	/* 11880 */
+	"pnjeqrjmisouh", "pnjwwgz", "pnmfvdrndv", "pnovjpkvkoz",	/* 11884 */
+	"pnpjvhg", "pnpko", "pnppzgteg", "pnpshkfgiozla",	/* 11888 */
+	"pnpyfpx", "pnqkck", "pnulm", "pnvhblfuq",	/* 11892 */
+	"pnwywhys", "pnxkihkjkywpmt", "pnycklgcgtnz", "pnyfvuqkpgb",	/* 11896 */
+	"pnyjadbbsmnw", "po", "poafllvuzayrp", "poblhzfacfx",	/* 11900 */
+	"poblrlglouacw", "pocbhldcfpfnyl", "poddhutbxkw", "podqs",	/* 11904 */
+	"podrbdhlz", "podznbjszwd", "poezkmveeadwnp", "pog",	/* 11908 */
+	"poijlqj", "pokejv", "poktcydtystm", "pollblw",	/* 11912 */
+	"polymbioabjx", "pom", "ponsmjyiamyhpb", "pooljigrf",	/* 11916 */
+	"pop", "popyknvaers", "posazhkalyr", "posevvnl",	/* 11920 */
+	"potdofhyrkt", "potiuauqkndwr", "potkglfbskl", "potm",	/* 11924 */
+	"pou", "poudr", "poumsy", "poupgwjec",	/* 11928 */
+	"pourtweq", "pousidkkcos", "poxdslncfzxac", "poxdtd",	/* 11932 */
+	"poyv", "pozboazhaiy", "pozxvkwuuyby", "pp",	/* 11936 */
+	"ppargdqv", "ppc", "ppdo", "ppdztooone",	/* 11940 */
+	"ppfdbetrpfu", "ppgkem", "ppgyenrvw", "pphnurggrtlz",	/* 11944 */
+	"ppiqbypyt", "ppmtxyhxu", "pppkdslmonyim", "ppptwbm",	/* 11948 */
+	"pppwq", "pprcilfiojrl", "pprersxa", "pprs",	/* 11952 */
+	"ppslejrsbc", "ppud", "ppulxbpdkutvlg", "ppwpwbte",	/* 11956 */
+	"ppxnblseyviwo", "ppyolrypie", "ppyqfsi", "ppzeyerd",	/* 11960 */
+	"ppzwxigmjr", "pq", "pqaacubzcko", "pqbsnsgjnxg",	/* 11964 */
+	"pqekbofk", "pqerdcilaemj", "pqgpjk", "pqhlo",	/* 11968 */
+	"pqhwzn", "pqiew", "pqjlo", "pqkepxjnpt",	/* 11972 */
+	"pqkgqjlpxkbm", "pqlbul", "pqlnvfcaan", "pqmdhwdatxkq",	/* 11976 */
+	"pqmfgwryf", "pqmtsphrne", "pqmzmvkwpdqb", "pqnljwxjqy",	/* 11980 */
+	"pqozrhecg", "pqpimofkfksn", "pqqjko", "pqqrizpigpunqj",	/* 11984 */
+	"pqqsceq", "pqseuc", "pqsjtf", "pqslvyy",	/* 11988 */
+	"pqv", "pqvnibaagaob", "pqxjyklxyojwf", "pqxlaucv",	/* 11992 */
+	"pqxzkisb", "pqzczwbernr", "pr", "prazg",	/* 11996 */
+	"prbc", "prbnduzfmul", "prcbfgp", "prcellhwvy",	/* 12000 */
+	"prdqhiyzgh", "prekoa", "prf", "prfdenrjof",	/* 12004 */
+	"prgkrzvrdxkw", "prgoaixxxbe", "prgphxiw", "prgunnsis",	/* 12008 */
+	"prhuswxju", "prhxoox", "pri", "priohfws",	/* 12012 */
+	"prjcgs", "prkrxszn", "prn", "prpsyzxmyg",	/* 12016 */
+	"prpttp", "prqaewnwvb", "prqoiuzqfprk", "prsi",	/* 12020 */
+	"prud", "prudmo", "prupbfdhdtgegq", "prvuc",	/* 12024 */
+	"prw", "prwkkrxefpdrhl", "prygclfzg", "ps",	/* 12028 */
+	"psbviy", "pscucqgwnwq", "pscwxgsruo", "psczhlqhxq",	/* 12032 */
+	"psdat", "pse", "pseall", "psekewjvolgi",	/* 12036 */
+	"psfhlgraeh", "psgawgwrvi", "pshgrr", "pshuspeovf",	/* 12040 */
+	"psizhwsxkl", "psknqw", "psloe", "psmgw",	/* 12044 */
+	"psnlau", "psok", "pspddjlehsqe", "pspyic",	/* 12048 */
+	"psqf", "psqtiqcvlkx", "pstrehbrzj", "psuximccpsnbda",	/* 12052 */
+	"psw", "psyoax", "psyynkx", "pt",	/* 12056 */
+	"ptchpkol", "ptetd", "ptfxkadnjtdny", "ptgdqayyrjn",	/* 12060 */
+	"ptid", "ptivbhvrshdrhu", "ptjeqvky", "ptlauthnmpsew",	/* 12064 */
+	"ptljlr", "ptlrenyey", "ptnpwfhazwru", "ptnxhtq",	/* 12068 */
+	"ptny", "ptozkwmuah", "ptp", "ptpunqgd",	/* 12072 */
+	"ptpwzmjdikztky", "ptqzwequw", "ptsxgh", "pttftdnomxlg",	/* 12076 */
+	"ptu", "ptwegwdk", "ptwyxds", "ptwza",	/* 12080 */
+	"ptxdvlwskkp", "ptxyjbtb", "ptyunlqfeunpwx", "pu",	/* 12084 */
+	"pubdhplhwknt", "puckv", "puemex", "puexcarw",	/* 12088 */
+	"pufoqvnxdzpb", "pugjailfeqor", "pugozxnezuwbyg", "puhunvmfzpsfsp",	/* 12092 */
+	"puibvqrlwltk", "puiijkw", "pujktmp", "pukcgpunick",	/* 12096 */
+	"pukclfuxxd", "pulzdrpmpkela", "pumfpact", "pumrlblel",	/* 12100 */
+	"punaahs", "puneoxixy", "pup", "pupeejb",	/* 12104 */
+	"puqqbfb", "puqz", "puribu", "puuuw",	/* 12108 */
+	"puvfz", "puwhtmhniv", "puwhuwv", "puwmvqavvmsr",	/* 12112 */
+	"puwufehzjqji", "puxog", "puzgughzgl", "pv",	/* 12116 */
+	"pvamz", "pvaqt", "pvatao", "pvbkzotkwr",	/* 12120 */
+	"pvbprygkwvmpbr", "pvcefr", "pvcmgltldqrgeu", "pvcmqp",	/* 12124 */
+	"pvdgstzgluoct", "pveadii", "pveizpvxacf", "pvgfhnow",	/* 12128 */
+	"pvgq", "pvhsulj", "pvi", "pvioqw",	/* 12132 */
+	"pvkryodyeobhy", "pvl", "pvldewqvder", "pvlepkj",	/* 12136 */
+	"pvls", "pvntz", "pvooarfhxibe", "pvpogrtbmkp",	/* 12140 */
+	"pvqiktawhwlit", "pvrmxm", "pvshtetcmfop", "pvtbziwo",	/* 12144 */
+	"pvvnjcwtpddyz", "pvxmp", "pvyshkrfh", "pvzocvtdjgv",	/* 12148 */
+	"pvztzarijmzsxh", "pw", "pwaw", "pwbdyydad",	/* 12152 */
+	"pwbsxru", "pwcpsnbvsjnvgl", "pweiwmt", "pwfubwdqtrcau",	/* 12156 */
+	"pwhxqtfwsoxwoz", "pwhzthdrlfdybw", "pwijfuu", "pwjw",	/* 12160 */
+	"pwkakqdrco", "pwlfhbjuorrotj", "pwln", "pwloyszocgeatk",	/* 12164 */
+	"pwofit", "pwognqup", "pwqefaqvo", "pwqi",	/* 12168 */
+	"pwrddbpmqh", "pwrhz", "pwtvifegj", "pwurtlrc",	/* 12172 */
+	"pwv", "pwwaapjkd", "pwxtsnqqfbtjh", "pwz",	/* 12176 */
+	"pwzjhgt", "pwzjibyb", "pwztxsobuwozl", "pxacvmeembvjkm",	/* 12180 */
+	"pxapbjw", "pxbcq", "pxbqvqeiookxti", "pxc",	/* 12184 */
+	"pxd", "pxe", "pxeosngcnttqqz", "pxfmbcsgkbqx",	/* 12188 */
+	"pxgmsplaz", "pxkopdprgslnnn", "pxmgjhsygoay", "pxnonvv",	/* 12192 */
+	"pxpishfuyejobi", "pxrfvgckopyoi", "pxrjfrafzf", "pxrzsynvyjti",	/* 12196 */
+	"pxsbwrtofdb", "pxshdtqag", "pxtcvu", "pxujfzyoqvsm",	/* 12200 */
+	"pxuzbxdxmse", "pxvwjri", "pxx", "pxxxe",	/* 12204 */
+	"pxyjtft", "py", "pyabmuwnx", "pycnsyfumuakv",	/* 12208 */
+	"pycoqty", "pydm", "pydmqvqgjpde", "pydslwzhmoyxk",	/* 12212 */
+	"pyhdebyxeuuey", "pyihvpfung", "pyiveybh", "pyizjd",	/* 12216 */
+	"pylwsuk", "pym", "pymbudjwx", "pymsizhplbg",	/* 12220 */
+	"pyqynxfldiny", "pyrrqunupklckx", "pysftfp", "pysnwg",	/* 12224 */
+	"pyta", "pyugqhe", "pyvedlwpgiolpb", "pyvsdossl",	/* 12228 */
+	"pywceyvkcv", "pywtp", "pyx", "pyxoprpo",	/* 12232 */
+	"pyy", "pyzqcluu", "pyzqlqoir", "pz",	/* 12236 */
+	"pzadeyr", "pzcrldhbutrvo", "pzdxap", "pzhledvoqlymv",	/* 12240 */
+	"pzi", "pzkohqdnc", "pzmedac", "pznaxdel",	/* 12244 */
+	"pznnnyltxpy", "pzokmgtskhl", "pzowzggybno", "pzp",	/* 12248 */
+	"pzperk", "pzpi", "pzpwqh", "pzqrkxpjhtgkbc",	/* 12252 */
+	"pzrgdcgysj", "pzsdqhyp", "pztcqgoud", "pztsh",	/* 12256 */
+	"pzum", "pzyiszckgu", "pzykfzabuua", "pzzyxiyfp",	/* 12260 */
+	"qa", "qadpkakhyfbc", "qafkcvvj", "qaglmkihuy",	/* 12264 */
+	"qagxdlxbuwo", "qaijanprnt", "qainvcgfvicnc", "qajhkxdac",	/* 12268 */
+	"qajtsicehihv", "qakdannoknptug", "qakimksajaxp", "qakltzdtei",	/* 12272 */
+	"qakwztjvj", "qalejfjse", "qalorb", "qalwmzo",	/* 12276 */
+	"qalz", "qaniyxjnemzdl", "qap", "qaprbshj",	/* 12280 */
+	"qaqgunkyhsfivw", "qarkztjw", "qaryrygdavpjt", "qasmczznj",	/* 12284 */
+	"qatfyfrwvksp", "qaultsx", "qawzz", "qazdoviwkm",	/* 12288 */
+	"qazlbcfonfy", "qazwfrpgbrwsvk", "qb", "qba",	/* 12292 */
+	"qbcgtvn", "qbchpbpwrtka", "qbdh", "qbdyocjvmyt",	/* 12296 */
+	"qbhrwram", "qbiffesik", "qbilmlymlm", "qbiqdxsnc",	/* 12300 */
+	"qbkdy", "qblvxed", "qbntk", "qbqhteauxq",	/* 12304 */
+	"qbqtzphjfreh", "qbrzhhohb", "qbsaudboeggy", "qbso",	/* 12308 */
+	"qbux", "qbvtpu", "qbvtxkxvj", "qbzbe",	/* 12312 */
+	"qbzvj", "qc", "qcaihkhr", "qcciemi",	/* 12316 */
+	"qccscrdjan", "qcczmper", "qcezkdv", "qcffvho",	/* 12320 */
+	"qcfqeiuc", "qcfqulednqyb", "qcfu", "qcgtver",	/* 12324 */
+	"qch", "qci", "qcieqzvijbgam", "qckvbis",	/* 12328 */
+	"qckyrztal", "qcnaqutookfnf", "qcomcuqiw", "qcor",	/* 12332 */
+	"qcpxuno", "qcrlalglgsqp", "qcsfibea", "qcsl",	/* 12336 */
+	"qcv", "qcvnzofobdq", "qcvpdtglsmuyo", "qcwlfsp",	/* 12340 */
+	"qcxvqpkwzlv", "qcydipugx", "qcyfrk", "qd",	/* 12344 */
+	"qdasrtjsc", "qdauovhpvtjml", "qdb", "qdbscnz",	/* 12348 */
+	"qdbx", "qdclliqlu", "qddnyzjlapm", "qddpck",	/* 12352 */
+	"qdds", "qdfloiagrwsaau", "qdfzvmf", "qdhl",	/* 12356 */
+	"qdi", "qdje", "qdjjug", "qdjqi",	/* 12360 */
+	"qdk", "qdkzkssyqxv", "qdldsqldzgjao", "qdllexos",	/* 12364 */
+	"qdltxxxkh", "qdmtiz", "qdntphfo", "qdnykynjzczlc",	/* 12368 */
+	"qdorkxgbixcl", "qdq", "qdr", "qdsrlskli",	/* 12372 */
+	"qdswp", "qdtezzjj", "qduzifmxubo", "qdvepsc",	/* 12376 */
+	"qdwmtxbqpmycc", "qdxnqrkygunyvl", "qdystwwupmknr", "qdyxkikvafipd",	/* 12380 */
+	"qdzguu", "qe", "qeamhjru", "qeatsnmlzrieki",	/* 12384 */
+	"qeaxrytsyp", "qebxhnqctqtak", "qecblpk", "qeeepnktdqbsyo",	/* 12388 */
+	"qeeixn", "qefdk", "qefii", "qefrwbfgu",	/* 12392 */
+	"qehejmttipdrn", "qeheuugvjjkeif", "qehia", "qehtrcjrvcta",	/* 12396 */
+	"qeizryf", "qej", "qejqpgyvz", "qem",	/* 12400 */
+	"qemdtmlhadg", "qemnokue", "qeni", "qenie",	/* 12404 */
+	"qenpfsbeqdus", "qensnnqkp", "qeocdbcu", "qeojhntcifsn",	/* 12408 */
+	"qepu", "qer", "qeshrgknxogas", "qesipdt",	/* 12412 */
+	"qetzxzjwyp", "qeurti", "qewc", "qewusnpi",	/* 12416 */
+	"qewxbxexiuws", "qex", "qexqxglxgmwi", "qexsycayecmv",	/* 12420 */
+	"qeyrzrjfowacqy", "qf", "qfat", "qfbnhivqogb",	/* 12424 */
+	"qfbxtrptb", "qfccmx", "qfdggixtgretw", "qffhoettytyjsk",	/* 12428 */
+	"qffouomn", "qfgvhxlhner", "qfhbup", "qfhlsgm",	/* 12432 */
+	"qfhrn", "qfirqnpmxt", "qfizf", "qfjvbyarirprg",	/* 12436 */
+	"qfjzrygkzyv", "qfkjrx", "qflitgzztzwxv", "qfojwncqxtgnk",	/* 12440 */
+	"qfonsutqkwhh", "qfp", "qfpp", "qfqifem",	/* 12444 */
+	"qfqrqfofrnw", "qfqzrpcyx", "qfrcq", "qfrdtvorgf",	/* 12448 */
+	"qfrkjt", "qftok", "qfu", "qfuydahfnzgp",	/* 12452 */
+	"qfv", "qfwotql", "qfxgwnvdsxscas", "qfxwoo",	/* 12456 */
+	"qfy", "qfzhch", "qfzhrjyyh", "qfzj",	/* 12460 */
+	"qg", "qgamdorp", "qgbvfhlhi", "qgdxollxb",	/* 12464 */
+	"qgfcogiyggsj", "qgfelq", "qggdgybzb", "qgghts",	/* 12468 */
+	"qgievn", "qgijdnoqs", "qgimdnliwz", "qgiwipklrco",	/* 12472 */
+	"qgjtkpbkr", "qgk", "qglqavmsnmkt", "qglxo",	/* 12476 */
+	"qgmhzmnhsgcxgi", "qgod", "qgotqnxwjwfot", "qgpfcowfrkahi",	/* 12480 */
+	"qgrwagyhvzn", "qgspcpptm", "qgtqpgv", "qgwembfgn",	/* 12484 */
+	"qgwomcxacjxto", "qgxxzxjzorz", "qgytarrjv", "qgz",	/* 12488 */
+	"qha", "qhax", "qhbsrzcbjoha", "qhcuzwqi",	/* 12492 */
+	"qhdgrcnanasip", "qhefovbz", "qheyd", "qhgru",	/* 12496 */
+	"qhhdov", "qhhoy", "qhhqlqv", "qhiavphubb",	/* 12500 */
+	"qhinfob", "qhj", "qhjbnantco", "qhjcwrfalomcl",	/* 12504 */
+	"qhjunwzs", "qhjwrbcsimuil", "qhklpmbhfizc", "qhkmwktq",	/* 12508 */
+	"qhlm", "qhlqssf", "qhmuqmv", "qhmwxttofqr",	/* 12512 */
+	"qhnudu", "qhoexz", "qhoigcw", "qhperrkql",	/* 12516 */
+	"qhpr", "qhqcovlhx", "qhromdewiafptd", "qhscl",	/* 12520 */
+	"qhshludle", "qhtiyg", "qhtrmzjefgqcg", "qhtsrtlxq",	/* 12524 */
+	"qhtxexcmmw", "qhu", "qhvaxdmpoyzxw", "qhvdk",	/* 12528 */
+	"qhwdnvwgf", "qhxnnwdu", "qia", "qiafsza",	/* 12532 */
+	"qiaglsynd", "qiawroweoqqls", "qibajpm", "qibirki",	/* 12536 */
+	"qibmqdhtatph", "qicmorww", "qifdhxbns", "qifeberbrlb",	/* 12540 */
+	"qifvspn", "qihdstoaueyl", "qihi", "qihq",	/* 12544 */
+	"qiih", "qiivxxhnwryyge", "qikbxmvhx", "qimfvclel",	/* 12548 */
+	"qimhgstcrvdpez", "qimwchahiev", "qinxlz", "qinyxw",	/* 12552 */
+	"qipwglwy", "qiq", "qiqhorwvbqwjui", "qirz",	/* 12556 */
+	"qisaivteuluwaf", "qitbbki", "qiubuzwqtbhr", "qiytpojiwgsk",	/* 12560 */
+	"qizl", "qizowkkpfrhc", "qizpwnp", "qj",	/* 12564 */
+	"qjcboehyh", "qje", "qjeafpyjwfxbcb", "qjeekwdosmrib",	/* 12568 */
+	"qjefdgct", "qjfmcrlknf", "qjgl", "qjgmbknsw",	/* 12572 */
+	"qjgrnz", "qjhkpcwhbodii", "qjjtnqoxeqmk", "qjjtpcnhwgpd",	/* 12576 */
+	"qjkciauev", "qjmkenuzpe", "qjnoyaneoqkxa", "qjo",	/* 12580 */
+	"qjowuo", "qjqhbu", "qjqsdn", "qjqtguklkgh",	/* 12584 */
+	"qjrdkbkeixgo", "qjrmmvykipca", "qjtgglnoied", "qjuwzbg",	/* 12588 */
+	"qjvcbtvqdpc", "qjvisbz", "qjwkwkevaudi", "qjwtbznn",	/* 12592 */
+	"qjyazetsoljwsd", "qjyeqndbkumyqa", "qjyohmusk", "qka",	/* 12596 */
+	"qkbgcqtig", "qkbvs", "qkddjpdwtccx", "qkdjt",	/* 12600 */
+	"qkeffkpvwcmgvz", "qkfmtbopdukgc", "qkfzpxbrkgdywe", "qkgrof",	/* 12604 */
+	"qkgvmxm", "qkhlbxyor", "qkilbamgpavvmr", "qkipbgfibj",	/* 12608 */
+	"qkj", "qkjmitmarn", "qklakh", "qkmewsfdo",	/* 12612 */
+	"qkmqqrmhu", "qkmrvghobgp", "qkofiajomdt", "qkosjkceddv",	/* 12616 */
+	"qkpubpugr", "qkqnnmenpidn", "qkqu", "qkrmnuycqbqd",	/* 12620 */
+	"qkrqrtittz", "qkv", "qkvgxbxfnmwdgb", "qkvl",	/* 12624 */
+	"qkxdsyiacumtm", "qkxsnvjgu", "qkxyjnrphg", "qkzieb",	/* 12628 */
+	"ql", "qlbnrsi", "qlcayxiflbc", "qlclvdeid",	/* 12632 */
+	"qldcaohyqtol", "qldoruigypnth", "qldtkgledygdf", "qlewmosyxacxvn",	/* 12636 */
+	"qlgcaam", "qlgupjm", "qlh", "qlineqwajmrvi",	/* 12640 */
+	"qlno", "qlpgeerwuhqxqk", "qlpiudpajt", "qlqdnt",	/* 12644 */
+	"qlsbfnh", "qlwcwh", "qlxa", "qlysuspbzhuw",	/* 12648 */
+	"qlzrkpcz", "qm", "qmbplulg", "qmeiq",	/* 12652 */
+	"qmiyafjqyitnsc", "qmjfwha", "qmjwqj", "qmna",	/* 12656 */
+	"qmneryjnhe", "qmnynga", "qmpem", "qmq",	/* 12660 */
+	"qmqcbefqq", "qmt", "qmtbutcwieo", "qmu",	/* 12664 */
+	"qmudsuxiykkh", "qmuqrigt", "qmux", "qmvuhhg",	/* 12668 */
+	"qmxaqsdujzy", "qmyfylyfcnqah", "qmzdsapfxys", "qn",	/* 12672 */
+	"qnas", "qnda", "qndkgglzoab", "qndu",	/* 12676 */
+	"qnef", "qnfghdsesqdx", "qnhbdwknbr", "qnikzlrydz",	/* 12680 */
+	"qnksrl", "qnlnat", "qnmj", "qnmoyvbhlixpd",	/* 12684 */
+	"qnnc", "qnndwp", "qnnnwc", "qnphkxbmsaweaa",	/* 12688 */
+	"qnplxeiph", "qnrgxexgjiep", "qnsdosvzt", "qnuttz",	/* 12692 */
+	"qnuxeeexic", "qnwljqtwh", "qnxphmyjkbur", "qnxscqlypmbdgt",	/* 12696 */
+	"qnzsjfdhngfc", "qnztegv", "qo", "qoab",	/* 12700 */
+	"qoablzkhdxhlby", "qoawskmc", "qobcddtwnyix", "qodbrzsspxncd",	/* 12704 */
+	"qofme", "qoftqhvmfckln", "qogcxfqt", "qogmrnyyj",	/* 12708 */
+	"qohmdtbfk", "qoidjpukyt", "qoiyjeikqwlof", "qojhdn",	/* 12712 */
+	"qojyrsws", "qok", "qoklcrqvxjota", "qokuqrrwnow",	/* 12716 */
+	"qolyfmonbp", "qomufixxo", "qonwv", "qooajdbhkbsee",	/* 12720 */
+	"qoqfhyy", "qoqh", "qoqpunhylhou", "qoqtkngzsytr",	/* 12724 */
+	"qorhsxwpabuyxa", "qorlkapmh", "qosjg", "qosy",	/* 12728 */
+	"qouppebhurrkwg", "qovc", "qovczkgmesf", "qoyhx",	/* 12732 */
+	"qoyufeakempczz", "qozaglyx", "qp", "qpcbosxadh",	/* 12736 */
+	"qpe", "qphprcspa", "qphsanvedkclu", "qpiy",	/* 12740 */
+	"qpk", "qplystcu", "qpmhflaufut", "qpmlgqc",	/* 12744 */
+	"qpprdphuc", "qpq", "qpspwkqzfs", "qpssganftmjefo",	/* 12748 */
+	"qptirqtkio", "qptwqbyt", "qpubdtwnu", "qpvtatqlyc",	/* 12752 */
+	"qpwwiyrru", "qpx", "qpyiovzxahd", "qq",	/* 12756 */
+	"qqafd", "qqayotyxnp", "qqbitckezednru", "qqcodnufascqen",	/* 12760 */
+	"qqdrzioewud", "qqdtyk", "qqemuqq", "qqexbj",	/* 12764 */
+	"qqgljj", "qqgnfdkbyuclj", "qqhkauf", "qqjrqkmkqbgnw",	/* 12768 */
+	"qqkhbdqixap", "qqknkmh", "qqlrcskpan", "qqlrhfblx",	/* 12772 */
+	"qqmhqh", "qqmjgx", "qqodtk", "qqptp",	/* 12776 */
+	"qqqdpousqqqg", "qqqqiulowkddx", "qqr", "qqrqyv",	/* 12780 */
+	"qqrzxvravexx", "qqrzzrnwflh", "qqs", "qqusxdkthc",	/* 12784 */
+	"qqv", "qqvxlygwggzv", "qqwdbxkbfz", "qqxd",	/* 12788 */
+	"qqxzgergocsigp", "qqyntvxs", "qqyrnbhixoog", "qr",	/* 12792 */
+	"qrbcoboazvveqf", "qrdsagedhbpkue", "qrdtr", "qrenbnyzvwiq",	/* 12796 */
+	"qrfob", "qrg", "qrgcbgczfjiv", "qrgfjaxsb",	/* 12800 */
+	"qrhmzopnaoxlk", "qrijtwrfphfaw", "qrikfnamwmoi", "qrilhisnajuaag",	/* 12804 */
+	"qriwtage", "qrjzbhc", "qrkmtlxuoxym", "qrlq",	/* 12808 */
+	"qrlsukjdy", "qrmqn", "qrmr", "qrmsq",	/* 12812 */
+	"qrmsqsaf", "qrntjqnehkmpr", "qrpayvbh", "qrq",	/* 12816 */
+	"qrquujpft", "qrrrwmsn", "qrryzxwf", "qrs",	/* 12820 */
+	"qru", "qruhuzbw", "qruwjpjrqtripo", "qruwtjr",	/* 12824 */
+	"qrvgcddbp", "qrvo", "qrwsa", "qrx",	/* 12828 */
+	"qrxbwvajdbqew", "qrxoujjpeawonv", "qrz", "qrzv",	/* 12832 */
+	"qs", "qsadd", "qsakjyibvgte", "qsbmpforivync",	/* 12836 */
+	"qsccpiz", "qsdjfsj", "qsdmcvjqzrbnjq", "qsdtrnijfk",	/* 12840 */
+	"qselrvanhvhmbg", "qsendocksnhfca", "qsenv", "qsfvuxhuaxye",	/* 12844 */
+	"qsfyelq", "qsgt", "qshav", "qsihrqdii",	/* 12848 */
+	"qsjfepyxzxv", "qsjuqzhibb", "qsjwyppfvnpqrs", "qsm",	/* 12852 */
+	"qsmai", "qsnbvbgtqokpc", "qsnwza", "qsqll",	/* 12856 */
+	"qsrjmjcoq", "qst", "qstluaqkk", "qstshteja",	/* 12860 */
+	"qstvxgnjbb", "qsuoxadfpibjw", "qsusls", "qsvksfuxiatjlg",	/* 12864 */
+	"qsvr", "qswjvyuthdzkap", "qsx", "qsxasbwdbwbcdh",	/* 12868 */
+	"qsxzupzbfskuoh", "qt", "qtazlaccdw", "qtdqwsyxktbcw",	/* 12872 */
+	"qtetyy", "qtf", "qtfo", "qtfzyhcnvevb",	/* 12876 */
+	"qtfzzaaxozwbc", "qtgndjiuam", "qtgtidd", "qtgtzcz",	/* 12880 */
+	"qtiqdajz", "qtiznnqnsny", "qtjeelwehxohft", "qtkplynwo",	/* 12884 */
+	"qtlle", "qtllfuxjrhios", "qtndufbadfx", "qtolfdxak",	/* 12888 */
+	"qtp", "qtqwed", "qtsjwvycbqw", "qtspazwyipded",	/* 12892 */
+	"qtxfra", "qtxjmn", "qtxozqddwnd", "qu",	/* 12896 */
+	"quarypykfnyzj", "qubnh", "qubtqiadnjnf", "qucgnys",	/* 12900 */
+	"qudda", "quepb", "quhhgpgdyeeaa", "quhmnbbxxglmky",	/* 12904 */
+	"quklywkdstqxp", "quladmdwtm", "qulxclkz", "qumicwbviusyq",	/* 12908 */
+	"qumrhqrkiiu", "qumsnvnag", "qunfufh", "qunhnzbhcjwdwc",	/* 12912 */
+	"qunytehbvwri", "quogy", "quoyegk", "quqqer",	/* 12916 */
+	"qurdfymrzeigp", "qutbqelgzugi", "qutdbtk", "qutwsbcmx",	/* 12920 */
+	"qutzvu", "quzqj", "quzsj", "quzvlkudfmbitw",	/* 12924 */
+	"qv", "qvaesil", "qvaifi", "qvanhohqdkt",	/* 12928 */
+	"qvaxweaf", "qvbqxyinoo", "qvccxum", "qvdagjav",	/* 12932 */
+	"qvdemebihmvdr", "qvdjpibiwfoueb", "qveyfrrbqg", "qvfkl",	/* 12936 */
+	"qvgvqruz", "qvleelzbiiadhy", "qvm", "qvmlsyt",	/* 12940 */
+	"qvnwldd", "qvoctk", "qvolrib", "qvpgmiqu",	/* 12944 */
+	"qvpvfe", "qvrbjdajn", "qvrfzhufnzh", "qvsnkbelv",	/* 12948 */
+	"qvtdiwl", "qvtmnrgiwdfxcj", "qvvk", "qvwfkzvor",	/* 12952 */
+	"qvwfzau", "qvyln", "qvymytt", "qvyody",	/* 12956 */
+	"qvyovxq", "qvyygzfqoi", "qvzfiagsbhr", "qvzujdqexqx",	/* 12960 */
+	"qvzypug", "qw", "qwadw", "qwarctividyac",	/* 12964 */
+	"qwbgvtuo", "qwccgbs", "qwcfskyrlw", "qwegz",	/* 12968 */
+	"qwemhxbtzuf", "qweyib", "qwfkjpp", "qwftdokzdov",	/* 12972 */
+	"qwgc", "qwiaqls", "qwivncdbe", "qwj",	/* 12976 */
+	"qwkaordsymsvn", "qwm", "qwmkkb", "qwmnqhplgl",	/* 12980 */
+	"qwntglrqc", "qwozsbdoj", "qwpgplj", "qwpxv",	/* 12984 */
+	"qwqeyli", "qwrbnmddsb", "qwsxqyjrawudc", "qwvgbtvtxwf",	/* 12988 */
+	"qwwfcyopnt", "qwy", "qwytngrtfykzdd", "qwzpzrudvlcrr",	/* 12992 */
+	"qx", "qxaqrqdg", "qxasyujgbjdy", "qxbw",	/* 12996 */
+	"qxffhzma", "qxfphepnhs", "qxguduaiwp", "qxjezosax",	/* 13000 */
+	"qxjmagp", "qxlcxl", "qxlr", "qxofwzxcrywb",	/* 13004 */
+	"qxq", "qxqnbegaj", "qxrhtllbicm", "qxsbucj",	/* 13008 */
+	"qxscnpsyylp", "qxszcpduq", "qxtd", "qxvir",	/* 13012 */
+	"qxwaordetctchg", "qxwnoqymjxjuar", "qxysrpcfuyxpz", "qy",	/* 13016 */
+	"qybjbclldvqo", "qybkjfgqdeu", "qydldumgppnph", "qydrkwjjrlejk",	/* 13020 */
+	"qyfyrvufqb", "qygepwppzz", "qygovaxyjr", "qygqaie",	/* 13024 */
+	"qygviqqde", "qyjaoebhw", "qyjen", "qyjxsvtni",	/* 13028 */
+	"qykupee", "qylhvdm", "qymid", "qyo",	/* 13032 */
+	"qyokhfgos", "qypnksgwfacqpd", "qypuhr", "qyrzyqidxo",	/* 13036 */
+	"qysslaybyup", "qysv", "qyswnwyjc", "qytyuzqrnoktm",	/* 13040 */
+	"qyudx", "qyvknr", "qyywz", "qyz",	/* 13044 */
+	"qyzrhrqypeyvbf", "qz", "qza", "qzank",	/* 13048 */
+	"qzapxk", "qzbbvncn", "qzbnmdaykpdnv", "qzbtuujofctup",	/* 13052 */
+	"qzcnpybjxyw", "qzcy", "qzdvzlmndejm", "qze",	/* 13056 */
+	"qzfbeiqonbnomw", "qzi", "qzif", "qziqb",	/* 13060 */
+	"qzlhrtcgqpt", "qzliyemicuzw", "qzon", "qzonvuoogtzkx",	/* 13064 */
+	"qzoolsffleb", "qzp", "qzphbmlut", "qzpqcqscpkj",	/* 13068 */
+	"qzptsvrqptvxs", "qzqme", "qzrano", "qzrblnim",	/* 13072 */
+	"qzregtervrqyrp", "qzrpsxttfrpzkt", "qzsdkpxqqnqzj", "qzssnbloagj",	/* 13076 */
+	"qztht", "qzumvskm", "qzuwiffofgfveg", "qzvvqjoylsw",	/* 13080 */
+	"qzwbhfjz", "qzxlpetni", "qzxwscguxme", "qzynaea",	/* 13084 */
+	"qzyuank", "qzzkgpqlxbuso", "ra", "raaai",	/* 13088 */
+	"rabcyrlpbvq", "racrogodl", "racz", "radic",	/* 13092 */
+	"radmeejzayaa", "raekuhdvlhaah", "raet", "rafhv",	/* 13096 */
+	"rafjrppamxwze", "rafxd", "ragljxjmtxg", "rajwbnjkm",	/* 13100 */
+	"rak", "ralqpqlhmtxnuo", "ramdhufev", "ramvgnxaqhyo",	/* 13104 */
+	"ramxbsnaje", "rapwhud", "rascqmf", "rastrwldigddw",	/* 13108 */
+	"ratipsdd", "ratjqnsigzc", "raukksem", "rauzigminkdqs",	/* 13112 */
+	"ravsudjphn", "raw", "raxiu", "raxyflxaeeoof",	/* 13116 */
+	"raz", "razgww", "rb", "rbarmi",	/* 13120 */
+	"rbblprlep", "rbc", "rbcoi", "rbdbgttsitvkci",	/* 13124 */
+	"rbdnyvdhg", "rbdxpmiue", "rbfhyijiyamd", "rbfnnlmhrrmvg",	/* 13128 */
+	"rbfvumbdk", "rbfzgxruhu", "rbgczghwz", "rbguyxzmaazlh",	/* 13132 */
+	"rbieqkjgz", "rbihbd", "rbmaks", "rbnoorrnruc",	/* 13136 */
+	"rbnstjn", "rboapmsuvypk", "rbofhsfvbg", "rbonamlerq",	/* 13140 */
+	"rbpjlqxexzqtr", "rbqdfdyijf", "rbqmzm", "rbqojaghkx",	/* 13144 */
+	"rbsk", "rbtkzassdkwx", "rbvrq", "rbwrv",	/* 13148 */
+	"rbxojlpjatu", "rbxsacagrxj", "rbygr", "rbyjbzycw",	/* 13152 */
+	"rbzevekq", "rbzrpkyatwpphn", "rc", "rcbbprk",	/* 13156 */
+	"rccmcxjh", "rcebdlxk", "rceeynil", "rcfucrozrmni",	/* 13160 */
+	"rcgiur", "rchd", "rchif", "rchmejgvxm",	/* 13164 */
+	"rcizuxhy", "rcjvyxhbya", "rckovi", "rckqq",	/* 13168 */
+	"rcmktn", "rcmrqkydrhmjt", "rcno", "rco",	/* 13172 */
+	"rcoatre", "rcpfdywav", "rcphzuo", "rcpw",	/* 13176 */
+	"rcqyjcblqpjc", "rcrvvjxfcu", "rctmwdzjdrddt", "rcttsstalqeq",	/* 13180 */
+	"rcvslmis", "rcvv", "rcvyugpwbww", "rcwmizmhwmj",	/* 13184 */
+	"rcwntezhwpgg", "rcza", "rczjbh", "rd",	/* 13188 */
+	"rdaco", "rdajvvhkpyo", "rdb", "rdbdoposox",	/* 13192 */
+	"rdcmjwaexcmzfn", "rddigydtj", "rddrcsznqx", "rddsjnawe",	/* 13196 */
+	"rdevecymzaf", "rdfba", "rdhk", "rdhtmwy",	/* 13200 */
+	"rdhzifaaxm", "rdiiyofcrf", "rdintjblpo", "rdipxfniljki",	/* 13204 */
+	"rdkcuqbgamtfc", "rdkhniv", "rdmkcb", "rdn",	/* 13208 */
+	"rdowzeniuchn", "rdp", "rdpasjuizewb", "rdpfg",	/* 13212 */
+	"rdpzrpvkxm", "rdqilfdvsi", "rdrlavaqcwcew", "rdrryhfnntyf",	/* 13216 */
+	"rdsejrjwzvp", "rdsjdwzpikgvma", "rdsrikjklifjtx", "rdtfidgbvve",	/* 13220 */
+	"rdtxcrvicf", "rdxjcr", "rdybj", "rdybuxpw",	/* 13224 */
+	"rdzeoahq", "rdzqy", "rdzsdu", "re",	/* 13228 */
+	"recohfpc", "redb", "redqgsdrphdity", "reegckzjfbptzh",	/* 13232 */
+	"reeghhlw", "ref", "regubqvnrezty", "reh",	/* 13236 */
+	"rejl", "reklpjwoofjk", "relgqpdcfd", "relk",	/* 13240 */
+	"rem", "reowhzqiumer", "repjwr", "rerjfhzmdc",	/* 13244 */
+	"reryaimmtnuoyx", "res", "resicyvofvql", "reudmhk",	/* 13248 */
+	"rewozpedrykpa", "rexmqn", "reye", "rezpnfpzchslx",	/* 13252 */
+	"rf", "rfbymkxvhltf", "rfcfpnjz", "rfdpfstft",	/* 13256 */
+	"rffgkiddiyj", "rffuygsggr", "rfgddehcu", "rfgdpeyvxwt",	/* 13260 */
+	"rfgo", "rfgqxfhnkuclsz", "rfh", "rfhcgpfbvmjae",	/* 13264 */
+	"rfi", "rfitndkcxyyw", "rfjedawevjjvux", "rfkvqdovfilihy",	/* 13268 */
+	"rfl", "rflqbw", "rfoorosvebaugm", "rfr",	/* 13272 */
+	"rfswuhsjmrjisv", "rftzqp", "rfwfrnsly", "rfzipwown",	/* 13276 */
+	"rfztzshegavl", "rfzuysbw", "rg", "rgapeotsr",	/* 13280 */
+	"rgc", "rgcenueozgt", "rgcwpomozs", "rgdkvpg",	/* 13284 */
+	"rgdkwjnxzhwxfi", "rgdnemoac", "rgen", "rgeubuzfdbk",	/* 13288 */
+	"rggkpp", "rgh", "rgingkbqt", "rgjjlsjnlehg",	/* 13292 */
+	"rgmnhsgsrpr", "rgnbplsrgqnpln", "rgndvxtujzv", "rgovvtc",	/* 13296 */
+	"rgp", "rgpeqxnpolp", "rgpjf", "rgqmylws",	/* 13300 */
+	"rgrc", "rgrdvmkrxso", "rgswqmendlbtrw", "rgthb",	/* 13304 */
+	"rgttogtc", "rgud", "rgwovkzix", "rgxnzhmgdkfmv",	/* 13308 */
+	"rgzrvmdyewmntw", "rh", "rhaqfsa", "rhbjpabfc",	/* 13312 */
+	"rhbsjezbsiig", "rheuijn", "rhfc", "rhfp",	/* 13316 */
+	"rhhbtw", "rhhktev", "rhlfcomyrlu", "rhlhvhyoj",	/* 13320 */
+	"rhmqlsloiv", "rhnk", "rhnlwlivk", "rhnnqixfs",	/* 13324 */
+	"rhounoryhkqz", "rhpexvapsx", "rhqiyeqpsawi", "rhskshxxrpmpe",	/* 13328 */
+	"rhsvkwbghxqrm", "rhswdadtvmtdev", "rhtxthdurvzs", "rhuzwqoh",	/* 13332 */
+	"rhvuciadrgooc", "rhzqya", "riaxcmmqsune", "ribmumc",	/* 13336 */
+	"ricakwoqcxmhqx", "ridbsx", "ridi", "rieuezhbbh",	/* 13340 */
+	"rig", "rigxvpjmqyk", "rigyziezbo", "rihl",	/* 13344 */
+	"rikrsqok", "rilepb", "rimlyjzex", "rimmug",	/* 13348 */
+	"rimnccmih", "rimyu", "rinfhymlexaprj", "ripefjnkqmqwi",	/* 13352 */
+	"riqcsmwksx", "risaftdaeci", "risbggjw", "risnga",	/* 13356 */
+	"ritkmbzs", "riugcno", "riujmnm", "rivjvnzrsrdzj",	/* 13360 */
+	"rivxulrakv", "riyqii", "riz", "rjaf",	/* 13364 */
+	"rjbm", "rjci", "rjcqjgwoa", "rjcwtolir",	/* 13368 */
+	"rjfacmgfycp", "rjg", "rjlebdmnqfa", "rjlo",	/* 13372 */
+	"rjlygygnxuyw", "rjnzzkji", "rjoajhkvx", "rjpcytmdyxv",	/* 13376 */
+	"rjqybeppt", "rjrdwkduyytoz", "rjriwpkdgukbaa", "rjsmpgoerzhuno",	/* 13380 */
+	"rjsxjxzlmcai", "rjtwgdbgzqfi", "rju", "rjuf",	/* 13384 */
+	"rjxbb", "rjxefwrearajcv", "rjxfntejv", "rjyayjefqjv",	/* 13388 */
+	"rjygcelpf", "rjyiqwfyhonwmy", "rjzdxj", "rjzojrjls",	/* 13392 */
+	"rjzpz", "rk", "rkacp", "rkafdfflajwts",	/* 13396 */
+	"rkaza", "rkbhylgb", "rkbxmabu", "rkces",	/* 13400 */
+	"rkcmfolqrxblky", "rkcxbdgtm", "rkdiqjv", "rkfblo",	/* 13404 */
+	"rkfggpid", "rkgynlbtncvx", "rkidpb", "rkkb",	/* 13408 */
+	"rkkl", "rklirjv", "rknrg", "rknxf",	/* 13412 */
+	"rkokpc", "rkorbjtsktc", "rkow", "rkr",	/* 13416 */
+	"rkrn", "rkrqz", "rkvhvyscrkss", "rkvkryggwobe",	/* 13420 */
+	"rkvvigqtim", "rkwjsa", "rkx", "rkxdujjaehhg",	/* 13424 */
+	"rkxzmwyxbsvovw", "rkyfzr", "rkzqpktd", "rl",	/* 13428 */
+	"rlavioo", "rlaxjlhmiatk", "rlc", "rldu",	/* 13432 */
+	"rleff", "rlgfiyfdgmrnj", "rlhjcyyfol", "rljhvlrrdoba",	/* 13436 */
+	"rll", "rlljomsjsfuwd", "rllmufhuzgsl", "rlmurnqeowpz",	/* 13440 */
+	"rlnmeww", "rlnnwxxns", "rlopgditqvefaa", "rlpwgrvu",	/* 13444 */
+	"rlpyjs", "rlqscmpemdupgb", "rlrahlcds", "rlrazibgdovf",	/* 13448 */
+	"rlsorzywht", "rltfqmcg", "rltgzfdbirchz", "rltldxklfb",	/* 13452 */
+	"rlvyben", "rlwgd", "rlxdekxmjep", "rlxtbru",	/* 13456 */
+	"rlzaogy", "rm", "rmapfdeet", "rmbhdqr",	/* 13460 */
+	"rmcfyd", "rmcxngyuh", "rmczlzy", "rmdladqggdptln",	/* 13464 */
+	"rmdvzqbv", "rmesusfwqrshqb", "rmeybalbuykgb", "rmfagvq",	/* 13468 */
+	"rmgmiono", "rmh", "rmhbnsfc", "rmhkeplq",	/* 13472 */
+	"rmhwrob", "rmiewtovir", "rmimfxnqe", "rmjhlrrz",	/* 13476 */
+	"rmkeereqqs", "rmlarunonmlrl", "rmlbrbopt", "rmltppkfztym",	/* 13480 */
+	"rmlunumwozsx", "rmmj", "rmmrsycp", "rmritqtpckk",	/* 13484 */
+	"rmrmtssude", "rmrnywwyupx", "rmsudhf", "rmtfwuvdm",	/* 13488 */
+	"rmwrwjcbltscfm", "rmxbedk", "rmzflbi", "rn",	/* 13492 */
+	"rncvamyl", "rnfilsc", "rngpvf", "rnjwnxpg",	/* 13496 */
+	"rnl", "rnltkjyhiewhr", "rnmhahiqw", "rnmkledofqiwbh",	/* 13500 */
+	"rnnh", "rnnjnd", "rnovrcvsue", "rnp",	/* 13504 */
+	"rnrcwrniv", "rnrzclem", "rnsrogo", "rnsrrbtq",	/* 13508 */
+	"rntnwxda", "rnvb", "rnvke", "rnxhrofszc",	/* 13512 */
+	"rnxsczgwmks", "rnydeabmzcg", "rnyszdpepk", "ro",	/* 13516 */
+	"roahckqthj", "roaijxjp", "roc", "rodfxwyfywr",	/* 13520 */
+	"rof", "rogeiq", "rohixqe", "rohkexkuso",	/* 13524 */
+	"roidnxpnttpyq", "rojkjosynpiew", "rojqqscekyj", "rokeitsbr",	/* 13528 */
+	"rokgofadnhpbn", "rolgbcxdd", "rolrkvdlbwtk", "romnq",	/* 13532 */
+	"ron", "roodmeksre", "ropcaeunymedz", "rorbrwszaiqd",	/* 13536 */
+	"rosxsjo", "rotgtbrqpe", "rougpxdtqc", "rovblxcki",	/* 13540 */
+	"rowbipwycwpd", "rowigw", "rowkhm", "rowzoasudv",	/* 13544 */
+	"roybcntagquxl", "royi", "rp", "rpasikvsuulxha",	/* 13548 */
+	"rpbg", "rpbgnvf", "rpbhbop", "rpdannppta",	/* 13552 */
+	"rpeli", "rpfybxx", "rpgtgxi", "rpidjzyjzubf",	/* 13556 */
+	"rpj", "rplla", "rplr", "rpphsxobfyj",	/* 13560 */
+	"rppp", "rpqhojy", "rpqlmk", "rprkvtsxwyw",	/* 13564 */
+	"rprt", "rprtsx", "rps", "rpsgqvhlizfh",	/* 13568 */
+	"rpsidvgacs", "rpt", "rptsmvihadi", "rpuoq",	/* 13572 */
+	"rpxrjc", "rpxtyhnhp", "rpybyr", "rpygs",	/* 13576 */
+	"rpzzicbc", "rq", "rqbaevkzbw", "rqcuvgmgvzz",	/* 13580 */
+	"rqdedrptu", "rqdindxzks", "rqdzf", "rqene",	/* 13584 */
+	"rqfbwgg", "rqfqn", "rqifxocd", "rqifyipaqq",	/* 13588 */
+	"rqioo", "rqjtxqlox", "rqkfixmiza", "rqkpgoi",	/* 13592 */
+	"rql", "rqlkk", "rqlzrzbon", "rqmpffzvzshnm",	/* 13596 */
+	"rqnk", "rqnzmvjyrpeu", "rqoxhighckdnvm", "rqoy",	/* 13600 */
+	"rqsal", "rqssudgbku", "rqsts", "rqsuvoevag",	/* 13604 */
+	"rqt", "rqvnkulga", "rqwakbtywykk", "rqwtqdl",	/* 13608 */
+	"rqwwpnygpqtxwf", "rqx", "rqynyesuwnhboc", "rqyvdnthbjsgfp",	/* 13612 */
+	"rqyxvyr", "rr", "rracuavb", "rrdjligxrmbzc",	/* 13616 */
+	"rrekodifnwlad", "rrfdqa", "rrfhygnzpev", "rrfwbl",	/* 13620 */
+	"rrgnihrnv", "rrgo", "rrgozbhua", "rrgstogebwsq",	/* 13624 */
+	"rrikpwhqma", "rrir", "rrixworkqjpi", "rrjokzmfvmxwx",	/* 13628 */
+	"rrkolprunk", "rrl", "rrm", "rrmgqixullt",	/* 13632 */
+	"rroanxipr", "rroprnxfzbip", "rrorj", "rrpfberja",	/* 13636 */
+	"rrpivqysxn", "rrqg", "rrqypexijdyo", "rrsg",	/* 13640 */
+	"rruqbjkmvc", "rrwodmukldr", "rryohejsgtmels", "rrzxqvs",	/* 13644 */
+	"rs", "rsabltmtneei", "rsbmlpqlkrct", "rsbydsj",	/* 13648 */
+	"rscmveib", "rsexnn", "rsf", "rsfncue",	/* 13652 */
+	"rsgtgiq", "rsgzbuida", "rsh", "rskirpivc",	/* 13656 */
+	"rskoqvkkfgra", "rskotwfagsmmu", "rskpec", "rslppzsqt",	/* 13660 */
+	"rslqevdlqvyy", "rslvjwfou", "rsmnswpwxpzvm", "rsnjqiocbdri",	/* 13664 */
+	"rsoj", "rspghy", "rspkhmnnlvncau", "rsqjrch",	/* 13668 */
+	"rsqqoydefzt", "rsrcwdmdimbcrl", "rsrifk", "rsscnbecxm",	/* 13672 */
+	"rssefmdejg", "rsudlbphlgdmm", "rsvncuvr", "rswkacyewrzpf",	/* 13676 */
+	"rswpiznr", "rswr", "rswrhersdznxnl", "rt",	/* 13680 */
+	"rtaagwkgppx", "rtaeccawducy", "rtakjbvmxbjf", "rtbdtvmp",	/* 13684 */
+	"rtbeyudak", "rtbxoschedjo", "rtczirsg", "rtdjzezpvy",	/* 13688 */
+	"rteyqaaqmu", "rtfttdao", "rtggcuoexcdx", "rtgzq",	/* 13692 */
+	"rthvhgkrung", "rtidentegojd", "rtipzfwculhay", "rtjechzvphore",	/* 13696 */
+	"rtk", "rtlbhrvrea", "rtleezhc", "rtlzaazoxpngf",	/* 13700 */
+	"rtn", "rtnpyhott", "rtonxoqtpzqze", "rtoqrjunkvgpb",	/* 13704 */
+	"rtorlbifg", "rtpgidsh", "rtq", "rtqb",	/* 13708 */
+	"rtrznosqpf", "rtsrjwqryqsl", "rtsuioihurmkos", "rttdm",	/* 13712 */
+	"rtte", "rttewaoz", "rttpumnkpqnflv", "rtvfmcmz",	/* 13716 */
+	"rtyfil", "rtyloofzfuo", "ru", "ruafqrmcy",	/* 13720 */
+	"rubk", "rubodsprjgrx", "ruedmb", "ruffxncodapyul",	/* 13724 */
+	"rufk", "rufxarfyg", "rugzydyh", "ruhenwxgwlphbh",	/* 13728 */
+	"ruhlfgebeiqq", "ruhoxqce", "ruhpzygaindob", "ruirjvxncbc",	/* 13732 */
+	"rukalklhafxq", "rukotnt", "rula", "runzmyjsfkthv",	/* 13736 */
+	"ruo", "rurkcro", "rurxqlcoz", "rusmoryj",	/* 13740 */
+	"rutbrtqe", "ruuf", "ruvlivbl", "ruvymytmpw",	/* 13744 */
+	"ruw", "ruwqogqcbw", "ruyakazckmbklz", "ruzqwanvtmjwi",	/* 13748 */
+	"rv", "rvbior", "rvbiz", "rvbkxcod",	/* 13752 */
+	"rvc", "rvccaifixmjplv", "rvdg", "rvdgsviys",	/* 13756 */
+	"rvdlda", "rvej", "rvgzkyxri", "rvmsmhmao",	/* 13760 */
+	"rvmzh", "rvnvxdivifpzz", "rvqvuayeeg", "rvsaweztfqzig",	/* 13764 */
+	"rvtwbxbeskl", "rvtwlvl", "rvu", "rvuwfizdl",	/* 13768 */
+	"rvxixec", "rvy", "rw", "rwbbrnxqo",	/* 13772 */
+	"rwc", "rwcyemrhdg", "rwekcdw", "rwflpxauxl",	/* 13776 */
+	"rwguqa", "rwhkxdghjs", "rwi", "rwihjonikklsmv",	/* 13780 */
+	"rwixk", "rwj", "rwjiovx", "rwkmbl",	/* 13784 */
+	"rwlgqvfzf", "rwlqdgksnsy", "rwlqegz", "rwm",	/* 13788 */
+	"rwpapzhfjocot", "rwpci", "rwpg", "rwroyhwykpn",	/* 13792 */
+	"rwsoteywk", "rwtbguuui", "rwulowuhptkwa", "rwvhhp",	/* 13796 */
+	"rwxjocyfigxirw", "rwyitr", "rwz", "rx",	/* 13800 */
+	"rxcomq", "rxcunpx", "rxd", "rxfbl",	/* 13804 */
+	"rxfz", "rxhkdzlkshl", "rxidrwxo", "rxkplnrccfhjl",	/* 13808 */
+	"rxlcezmklvn", "rxmkitrsebcsj", "rxmmouu", "rxngrjglwighvx",	/* 13812 */
+	"rxpf", "rxqelhmjzgkhol", "rxqgjtaxihq", "rxrenlqj",	/* 13816 */
+	"rxrvktqxqsez", "rxs", "rxswuhiyibz", "rxumreahbnjyd",	/* 13820 */
+	"rxvbruwoma", "rxw", "rxwbusojcupge", "rxwgvu",	/* 13824 */
+	"rxykeizr", "rxzwtxq", "ry", "rya",	/* 13828 */
+	"ryakvnc", "ryaptckfp", "ryauywdp", "rybjjz",	/* 13832 */
+	"ryblpqhasr", "ryceke", "ryeizabbyh", "ryeyogwmk",	/* 13836 */
+	"ryeyvhyitbtpe", "ryftxiybdbvzee", "ryfwns", "rygkmfigez",	/* 13840 */
+	"ryheehkty", "ryigews", "ryihhakzxrfox", "ryilicoz",	/* 13844 */
+	"ryizfntjl", "ryjalyvtenurbw", "ryjkp", "ryjxdidtgq",	/* 13848 */
+	"ryninxhqrj", "rynpibwh", "rypvmovcxbbc", "rypxcwnyxkh",	/* 13852 */
+	"ryrl", "ryssnm", "rywawo", "rywzff",	/* 13856 */
+	"ryxccjyh", "rz", "rzb", "rzbeyq",	/* 13860 */
+	"rzcbcfgeode", "rzddxw", "rzdi", "rzemhhi",	/* 13864 */
+	"rzfavffmsve", "rzhbo", "rzijbqqtgyuna", "rzkkxm",	/* 13868 */
+	"rzksprkavlndst", "rzlucqnbjeqxh", "rzmcv", "rznofgpzneneqy",	/* 13872 */
+	"rznw", "rzogyawimg", "rzoqvdra", "rzpwiagfol",	/* 13876 */
+	"rzqzlkhghhhogg", "rzrnibqz", "rzrohsucajbzu", "rztbs",	/* 13880 */
+	"rztfhkuyu", "rztrsgqcra", "rztuswu", "rzudheukf",	/* 13884 */
+	"rzupgpyll", "rzvneb", "rzwbmf", "rzxaqjg",	/* 13888 */
+	"sa", "saacsug", "sabszel", "sabwxinuc",	/* 13892 */
+	"sad", "saeaedklxjmfzy", "safboxitw", "safjjxfcei",	/* 13896 */
+	"safr", "sagvsozz", "sah", "sahwakg",	/* 13900 */
+	"salal", "sanroyaztqm", "saoacmdijys", "saorspgx",	/* 13904 */
+	"sapd", "saqqifealm", "sarftjdtuitsg", "sasfkcl",	/* 13908 */
+	"satflwznqtkmdb", "satqrq", "satyhd", "satzyjmk",	/* 13912 */
+	"sau", "saugkyziakhguj", "saumsfogvtaxna", "savmewpq",	/* 13916 */
+	"sawhhxinipncba", "sawz", "saxifwbbpmcg", "saxyg",	/* 13920 */
+	"sayxg", "sb", "sba", "sbalutdt",	/* 13924 */
+	"sbavixy", "sbawilczts", "sbcexx", "sbcivudiov",	/* 13928 */
+	"sbeiekduixw", "sbeusxbrukjz", "sbfwjrhs", "sbhsayzbvrp",	/* 13932 */
+	"sbiqzpyzvh", "sbktpbwzuahib", "sblanyxgtj", "sbllzxmsyqzbg",	/* 13936 */
+	"sblmszlr", "sbmkdtqth", "sbmqegw", "sbn",	/* 13940 */
+	"sbogoqjnvymj", "sbrjaw", "sbrkqymioisicd", "sbtc",	/* 13944 */
+	"sbttzbubdxcqf", "sbvmcm", "sbwsatf", "sby",	/* 13948 */
+	"sbyqguxtsvbc", "sbzewojsepw", "sbzofctev", "sc",	/* 13952 */
+	"sca", "scaxvom", "scb", "scbpcyalce",	/* 13956 */
+	"sce", "scetluzomnrbfe", "scfmzcpv", "schd",	/* 13960 */
+	"schhdhcxjql", "schrhw", "schzpa", "scjdto",	/* 13964 */
+	"sclrdwzevlabxg", "scltmgt", "scmfeqd", "scmwezjk",	/* 13968 */
+	"scnp", "sco", "scohrzpce", "scpye",	/* 13972 */
+	"scqdtjlfihfygf", "scqzpmxon", "scrzbvdz", "scsjbxxmnw",	/* 13976 */
+	"scuaspktojvzoy", "scup", "scvgelekbndr", "scvjjwufyvuj",	/* 13980 */
+	"scvspudppr", "scwdpdysestulu", "scyotaz", "scznilwiyd",	/* 13984 */
+	"sczyxymyxsb", "sd", "sdatowztczbgu", "sdbataa",	/* 13988 */
+	"sdbbqxcpb", "sdctsfsu", "sddfvymunwrdf", "sddtn",	/* 13992 */
+	"sde", "sdgikkszhdzb", "sdhsq", "sdirdhx",	/* 13996 */
+	"sdjup", "sdo", "sdodpstcux", "sdqholzzyhoxwo",	/* 14000 */
+	"sdqqwtgh", "sdrgbrcoc", "sdsknqsihvug", "sdsynwqm",	/* 14004 */
+	"sdtjezrkvxd", "sdupfqujyitt", "sdvboy", "sdwggblfbgplyb",	/* 14008 */
+	"sdwxyltev", "sdxlxwswle", "sdydul", "sdzlmltlqxfti",	/* 14012 */
+	"sdzzwwe", "se", "sea", "sebcbfpknxbodx",	/* 14016 */
+	"secihzweaamzjh", "secjaaqwke", "sedfy", "seepfu",	/* 14020 */
+	"sehkcypjdmnh", "sehunrwt", "seiud", "sejj",	/* 14024 */
+	"sejsicvjb", "sejtnaaj", "sejuetffgpnjtt", "seks",	/* 14028 */
+	"sekz", "semkesn", "semtq", "semvfylkeerwpu",	/* 14032 */
+	"semw", "sennshjnamktv", "senuimxntljtp", "seofi",	/* 14036 */
+	"sepnkiyphezx", "sepsjefduta", "setbmygb", "setck",	/* 14040 */
+	"seuyo", "sevppnywir", "sevwasangz", "seycclsuzqlpoz",	/* 14044 */
+	"seyeothh", "seyrptdr", "sf", "sfatfbolvkff",	/* 14048 */
+	"sfaxokr", "sfazuk", "sfbii", "sfbux",	/* 14052 */
+	"sfbybltofvxo", "sfcqvqiyoj", "sfd", "sfdetkbevtcp",	/* 14056 */
+	"sfe", "sfebgcff", "sfewyoffk", "sfeyxud",	/* 14060 */
+	"sfg", "sfgqtrmkfe", "sfhhqufmdu", "sfix",	/* 14064 */
+	"sfizgnovom", "sflkwhzh", "sflntwruqblrnr", "sfmrchqjb",	/* 14068 */
+	"sfngdcekewr", "sfnpkjsqeli", "sfnrkoztcvk", "sfpm",	/* 14072 */
+	"sfswffnvw", "sfvpko", "sfwekgep", "sfzekzr",	/* 14076 */
+	"sg", "sgai", "sgayrachxdlm", "sgcgbhlismcxi",	/* 14080 */
+	"sgefgu", "sgeskembq", "sgiko", "sgil",	/* 14084 */
+	"sgip", "sgjtvvio", "sgk", "sglzqbazy",	/* 14088 */
+	"sgmibghb", "sgnf", "sgnlvwouw", "sgnvkfiaktk",	/* 14092 */
+	"sgojzcpgxkuvf", "sgokldqew", "sgqfsk", "sgralrklsif",	/* 14096 */
+	"sgrkyczyugdns", "sgsbdulhn", "sgseouw", "sgtpdird",	/* 14100 */
+	"sgvbqxnqljyar", "sgvclnlxpmqgi", "sgvonmjt", "sgvovsmw",	/* 14104 */
+	"sgxbwbeph", "sgxmqaij", "sh", "shablsoiyilt",	/* 14108 */
+	"shadahf", "shbcdbba", "shbkzizciy", "shcaknye",	/* 14112 */
+	"shclsgpalqt", "shegqsmi", "sheknouoodv", "shfqngc",	/* 14116 */
+	"shgdqkv", "shhecu", "shhnwioendsdo", "shhyubkpt",	/* 14120 */
+	"shkhfymqcufo", "shkwi", "shkxjdizje", "shnqflj",	/* 14124 */
+	"shqhcjsromdlg", "shrrpnuguljib", "shun", "shupcmlvleym",	/* 14128 */
+	"shvcaklh", "shxgqqmdwgmv", "shxuzuuukn", "shy",	/* 14132 */
+	"shybp", "shydbmpi", "shyojzreb", "shzjjveaw",	/* 14136 */
+	"shzkvvlzxtfsr", "shzquhjukxge", "shzsfuh", "si",	/* 14140 */
+	"siafsvi", "siallojxehmd", "sicsxmowhdg", "siee",	/* 14144 */
+	"sifiie", "sigzlnr", "sihdynxl", "sikgcoub",	/* 14148 */
+	"siknigxzcmlsfx", "sikwayb", "silbvuejoey", "sily",	/* 14152 */
+	"sin", "sipafpdhedmbfc", "sipmrxy", "siqfc",	/* 14156 */
+	"siqj", "sishaptuprl", "sivpzvgf", "sj",	/* 14160 */
+	"sjbowqgg", "sjefykkqhjlvgy", "sjeroqwexhbjp", "sjltrt",	/* 14164 */
+	"sjmadbk", "sjnuy", "sjo", "sjpjifjizk",	/* 14168 */
+	"sjpnmmulugta", "sjqalkcqbvsfmp", "sjqyuphxgnmlb", "sjtivfkel",	/* 14172 */
+	"sjtrhmmynrs", "sjvkpcixldnj", "sjvnxdleqlt", "sjvoeqlobhrpy",	/* 14176 */
+	"sjwp", "sjwqqi", "sjxujrcegd", "sjzjpqkqutndb",	/* 14180 */
+	"ska", "skebeyw", "skes", "skf",	/* 14184 */
+	"skfd", "skfpocemy", "skfu", "skfyxxmt",	/* 14188 */
+	"skhsvtxqb", "skhyhvuvf", "skjqzltupmjja", "skjrujoeyu",	/* 14192 */
+	"skjuvk", "skkpxump", "sklhvbkyuzj", "skmm",	/* 14196 */
+	"skmmg", "sknqttu", "skphogix", "skpq",	/* 14200 */
+	"skr", "skvyxzepl", "skz", "skzeomtfrzxlu",	/* 14204 */
+	"skzhmnp", "skzjyavdswzu", "sl", "slc",	/* 14208 */
+	"slcjgrladwabq", "slcwkwvyv", "sletxtaytowzw", "slfvrp",	/* 14212 */
+	"slfznunjiht", "slgclhpvpdsran", "slgwuzizxfnl", "sljpbbjanugjc",	/* 14216 */
+	"slllvcnckfcjj", "slmbakdvbufli", "slmhlz", "slmzvuoi",	/* 14220 */
+	"slnwlgyigvos", "slodfg", "slosskaxg", "slovpdc",	/* 14224 */
+	"slpbpn", "slpxlnylcsi", "slrc", "slrditzj",	/* 14228 */
+	"slrmacdoi", "slryxsby", "sls", "slsnv",	/* 14232 */
+	"slu", "slvyxtswg", "slwiqiv", "slwqxkbobs",	/* 14236 */
+	"slym", "slzbneboyqyw", "sm", "smamxoztktjkd",	/* 14240 */
+	"smcgpnjv", "smcr", "smcy", "smdj",	/* 14244 */
+	"smdvmbaehq", "smeix", "smetgqaqb", "smftchpa",	/* 14248 */
+	"smjkii", "smjtbn", "smkaztshxskuzq", "smknecqligx",	/* 14252 */
+	"smlih", "smmfrewzxs", "smncsxaj", "smneitnnelkk",	/* 14256 */
+	"smnmxkto", "smoryc", "smqhmkqew", "smqxrgrdbt",	/* 14260 */
+	"smrpezlsv", "smsfstdcb", "smsza", "smufsdjd",	/* 14264 */
+	"smvjfzrmxrjr", "smvmdpgiolfm", "smvprthibufvvr", "smwcmfvkx",	/* 14268 */
+	"smwznldtnlae", "smxbbehmgiy", "smxoempbv", "smxtk",	/* 14272 */
+	"smzzfrlfbocfv", "sn", "snbh", "snfevc",	/* 14276 */
+	"snghu", "snic", "snjgud", "snkedjjiha",	/* 14280 */
+	"snlgllkde", "snlswukqeyyu", "snmic", "snnossqgtwfv",	/* 14284 */
+	"snotsakvilk", "snozg", "snt", "snthvrafw",	/* 14288 */
+	"sntowsottu", "snvz", "snwk", "snwrbjpf",	/* 14292 */
+	"snwurqumcrgg", "snxjfiiitfezf", "sny", "snyidqbkdqtzou",	/* 14296 */
+	"soaeei", "sob", "sodc", "sodkfr",	/* 14300 */
+	"sodusfqh", "soeekmoitosz", "sofct", "sofeacsffx",	/* 14304 */
+	"sogiqiyqog", "sohbwrsywjpo", "sohdy", "sojfehzwb",	/* 14308 */
+	"sokqqyncd", "soktxrxtwmmlha", "soljnc", "solm",	/* 14312 */
+	"solph", "sopdz", "sopgqyyckofwr", "sophkghxlq",	/* 14316 */
+	"sopmlvkkqd", "soqcckhxgbw", "sotcqyhyvmahc", "sotpbpiyfgg",	/* 14320 */
+	"sotyelqgxnjyf", "soubfnmzvjq", "soufh", "soulyx",	/* 14324 */
+	"souv", "souw", "sovmnoop", "soxgt",	/* 14328 */
+	"soxnvdfbcsr", "soxrkwiyytlqop", "soxsbpjg", "soyikddlnx",	/* 14332 */
+	"soyvqo", "sozlctmbn", "sozuwdwm", "sp",	/* 14336 */
+	"spablbew", "spbp", "spcseumbhf", "spdtiqpyg",	/* 14340 */
+	"spdyelxxzovhx", "spgcjlhgd", "spi", "spiirqovszun",	/* 14344 */
+	"spkcbmywr", "spkuonmatxw", "splvtyj", "spmgzuolqshi",	/* 14348 */
+	"spnhdsnfkqk", "spokvpzo", "spoykg", "spq",	/* 14352 */
+	"spqfldnex", "sprwztjirfbk", "sptgsqvckzu", "sptndbkreso",	/* 14356 */
+	"sptnwpa", "spusf", "spuy", "spv",	/* 14360 */
+	"spvprnwowgyf", "spvxhegbqkzhmo", "spwkoql", "spwruidqxjaj",	/* 14364 */
+	"spwya", "spxjsztixvbymr", "spyodvwzprkbgo", "spyv",	/* 14368 */
+	"sq", "sqbmynsqmsq", "sqdlddo", "sqdytdmklcyuef",	/* 14372 */
+	"sqe", "sqeno", "sqftlvrbznojfa", "sqgcqrxon",	/* 14376 */
+	"sqgcvgtuiamp", "sqhc", "sqirgetucfebxb", "sqjakeevev",	/* 14380 */
+	"sqjakt", "sqkckmmrwqp", "sqkcy", "sqlprxwzu",	/* 14384 */
+	"sqlvli", "sqm", "sqmbogolzu", "sqmceiafdyhmwp",	/* 14388 */
+	"sqn", "sqoqhsufwd", "sqphrkq", "sqqugei",	/* 14392 */
+	"sqqxbdhrh", "sqrgbssqkjcr", "sqtiuk", "squdt",	/* 14396 */
+	"squmtd", "squrvp", "sqvdvo", "sqweb",	/* 14400 */
+	"sqxjty", "sqxn", "sqxuodpavtzq", "sqyirxwwvgcqi",	/* 14404 */
+	"sr", "srbgo", "srbvs", "srdu",	/* 14408 */
+	"srdxkehc", "srdzzhzby", "sregmmj", "srfaxr",	/* 14412 */
+	"srhdpdoqrfd", "srktdxoxfq", "srmnz", "srnfnamlvkg",	/* 14416 */
+	"sro", "srp", "srpawnzzllsaym", "srpcd",	/* 14420 */
+	"srpqu", "srqhfqbmi", "srqwopowlud", "srreicgvywkyal",	/* 14424 */
+	"srsbruazgt", "srsvolfpoljva", "sryd", "ss",	/* 14428 */
+	"ssajprdi", "ssajrp", "ssbmohjqzxvw", "ssd",	/* 14432 */
+	"ssdxyedoh", "sseiadfc", "ssfkqv", "sshasjm",	/* 14436 */
+	"ssirpwk", "ssjbypov", "ssjkbvdwttitji", "sskhzqazpax",	/* 14440 */
+	"ssmuffqhayg", "sso", "ssqwmeylaoz", "sssfojbetx",	/* 14444 */
+	"sstmjtnpktnzq", "ssuncuwzzeh", "ssvsspylls", "ssvyitty",	/* 14448 */
+	"sswkxyxqbvkyr", "sswuek", "ssxdhemjipxktn", "ssxjx",	/* 14452 */
+	"ssyaclqkxtbje", "ssyvnj", "st", "stahaefothg",	/* 14456 */
+	"stao", "stb", "stcrqmgrsrw", "ste",	/* 14460 */
+	"sterdk", "stfm", "stgbbekhkjgsp", "sth",	/* 14464 */
+	"stheq", "sthkwxaczyztan", "stiaqd", "stk",	/* 14468 */
+	"stkokghzexl", "stlbnpkjfgplg", "stnklezy", "stnpivlbttjd",	/* 14472 */
+	"stouc", "stpaj", "stprfgvwg", "stpwuxyqb",	/* 14476 */
+	"strh", "stthcroyiq", "stvhnjgvfxmb", "stw",	/* 14480 */
+	"stwvtpfmcsgy", "stwxujtlkt", "stxdodtwjb", "stxqakxjxoui",	/* 14484 */
+	"su", "suark", "suarwxjvufz", "subdl",	/* 14488 */
+	"sudkydfejwv", "suevxuydmolva", "suewdupgad", "suf",	/* 14492 */
+	"sufm", "sugi", "suiefakcxpuutp", "sujzmzalqgksy",	/* 14496 */
+	"sukcdxymfrszf", "suljulvxkfju", "sultgp", "sumxrpnfduxvb",	/* 14500 */
+	"sunno", "suoghycuj", "suqmzarmqtr", "sursyq",	/* 14504 */
+	"surusfljlr", "susmawhqmdrin", "suspjvidruiffq", "suurndbwpqiao",	/* 14508 */
+	"suvunjqhqnnpz", "suwiiebfeqnxbr", "sux", "suynksaoaocons",	/* 14512 */
+	"suzzfzpi", "svdlkqpiv", "svdyeoujwabj", "svfkqcuzybazsj",	/* 14516 */
+	"svgzki", "svh", "svhk", "svhtwnwdplkf",	/* 14520 */
+	"svjtkzscpknci", "svmfauksso", "svmovh", "svnt",	/* 14524 */
+	"svp", "svrirblxkbm", "svrtitvenzz", "svu",	/* 14528 */
+	"svutyqiqkasyzg", "svvltmrqz", "svvyhzxa", "svxammhiapo",	/* 14532 */
+	"svxjryehfhm", "svyjgt", "svytpjxegmd", "sw",	/* 14536 */
+	"swaz", "swbhvqfujrpgo", "swbqgttb", "swetu",	/* 14540 */
+	"swfne", "swgmoepwhbxuh", "swgqktkb", "swgucbsgjewkc",	/* 14544 */
+	"swhpsr", "swif", "swil", "swjkfaae",	/* 14548 */
+	"swlaqyaphxowst", "swlr", "swoefghykxbnlw", "sworebqkqweuy",	/* 14552 */
+	"swosns", "swtcxabgaw", "swtqco", "swvu",	/* 14556 */
+	"swwtsrmmeg", "swwwyd", "swxtar", "swzesjbucyjcn",	/* 14560 */
+	"sx", "sxabazv", "sxbhxprb", "sxcb",	/* 14564 */
+	"sxcduazkbyc", "sxcijy", "sxdkqjp", "sxeukkof",	/* 14568 */
+	"sxfhvaqqoabo", "sxfqsrbq", "sxghyex", "sxgooexobfpymm",	/* 14572 */
+	"sxgv", "sxhbsxjgo", "sxhkhurnvo", "sxiz",	/* 14576 */
+	"sxjnjicng", "sxkole", "sxmelftyhqu", "sxnfjyyilmmwd",	/* 14580 */
+	"sxnkwerixkp", "sxoqnhrzix", "sxrxjztofuzax", "sxs",	/* 14584 */
+	"sxshrg", "sxsiwfgtphokgd", "sxtwfc", "sxvlwpnqiptj",	/* 14588 */
+	"sxxk", "sxxm", "sxynkejksw", "sxysl",	/* 14592 */
+	"sxywyzkwx", "sxzmzfbinzc", "sxzwgbflxadts", "sy",	/* 14596 */
+	"sydragglm", "syegm", "syetzyobskoh", "syfwqtvmu",	/* 14600 */
+	"sygdicyuujf", "syhcl", "syiyjwwr", "syiyoqmclk",	/* 14604 */
+	"syjwpdm", "sylrsfx", "symhfsbo", "symn",	/* 14608 */
+	"symtzurlmuzyt", "synswih", "sypalrmocar", "syqgyukgqdq",	/* 14612 */
+	"syriufhjjhkxik", "sytvifxqgcf", "syveslguilskl", "syvf",	/* 14616 */
+	"syvprd", "sywfmltrzy", "sywzebv", "syybfdg",	/* 14620 */
+	"sz", "szardwmqhdhx", "szdwzsiuqigjx", "sze",	/* 14624 */
+	"szf", "szhuwkunaqidg", "szke", "szkfwnwub",	/* 14628 */
+	"szkujoz", "szkw", "sznwdrbqfwu", "szoesokpw",	/* 14632 */
+	"szokpwmrgf", "sztukmm", "szuefwdeoafamc", "szunkqtfeerms",	/* 14636 */
+	"szuv", "szviya", "szx", "szyc",	/* 14640 */
+	"szzgx", "ta", "tadsnn", "tae",	/* 14644 */
+	"tagasfc", "taglprtt", "tahnxh", "taiixxub",	/* 14648 */
+	"takkqhw", "taksbhuu", "takvzp", "taly",	/* 14652 */
+	"tanzg", "taomm", "tapdg", "tapxs",	/* 14656 */
+	"taqdarukxbnt", "tasozabaezjsgh", "tatifitugobdaw", "tatteocpsx",	/* 14660 */
+	"tauhfoufbtbag", "tavgp", "tawt", "tawwctvhaotdb",	/* 14664 */
+	"taxswezt", "tayapfnrwyx", "tayhjvk", "tayuwpimqa",	/* 14668 */
+	"tazhufrsf", "tazlhaxvhhm", "tazvcdvfq", "tb",	/* 14672 */
+	"tbbqsdlbu", "tbcacio", "tbcfkjjedqf", "tbcjafvdltypmc",	/* 14676 */
+	"tbckecoiiqzix", "tbdmsmvzm", "tbe", "tbffhrl",	/* 14680 */
+	"tbgnddlpjnf", "tbgr", "tbihbnkpnqik", "tblnvw",	/* 14684 */
+	"tblqrayyhckcc", "tblrpmqksqj", "tblsoeuah", "tbnrnhkx",	/* 14688 */
+	"tbobl", "tbpgvtlorpgis", "tbpstduzymcgj", "tbrqnirwxrjba",	/* 14692 */
+	"tbrwdpxxjrfaa", "tbshieirbldkd", "tbuioso", "tbuokoz",	/* 14696 */
+	"tbvhddhupat", "tbvmifoiz", "tbvpd", "tbxgbmkiqkgn",	/* 14700 */
+	"tbydfeqsoysbro", "tbykzxnll", "tbzetxdvsila", "tcaa",	/* 14704 */
+	"tcajhdvco", "tcdhkxf", "tcdy", "tcee",	/* 14708 */
+	"tcfxqritz", "tcgqrophczfbyl", "tcgyawmcl", "tchdwphtxbzzi",	/* 14712 */
+	"tchhazhmcircxc", "tchwy", "tcib", "tciijdvz",	/* 14716 */
+	"tcjanboamgrtpz", "tcjbc", "tcjnchjdvpl", "tcjxeansexmjh",	/* 14720 */
+	"tclpt", "tcmqnjvoet", "tcncwreiyci", "tcnjxyaliygfe",	/* 14724 */
+	"tcoh", "tcp", "tcs", "tctq",	/* 14728 */
+	"tcu", "tcwirhwm", "tczf", "tdbbhbggz",	/* 14732 */
+	"tddcukdvsrul", "tddedmkooclgbp", "tdehr", "tdfvtuzl",	/* 14736 */
+	"tdho", "tdijmryodbnrvg", "tdiw", "tdiwaswnw",	/* 14740 */
+	"tdje", "tdjimtkdcsu", "tdl", "tdlid",	/* 14744 */
+	"tdmn", "tdnem", "tdolicadswowzv", "tdot",	/* 14748 */
+	"tdpdbjwjbnaqh", "tdpeazh", "tdpil", "tdqjpaqrherzlt",	/* 14752 */
+	"tdqpqcbcfawt", "tdqwwzmblfmfw", "tdtyimlzsil", "tdushqqlrcu",	/* 14756 */
+	"tdvaro", "tdvjekoquiulem", "tdwxdibwglzut", "tdwxreh",	/* 14760 */
+	"tdydatilj", "tdzp", "tdzqpab", "te",	/* 14764 */
+	"teabmcyjzmrjw", "tebotxrh", "tebpopjfkud", "tebwn",	/* 14768 */
+	"tecluq", "tedhumsyhj", "teg", "tehkmchkwr",	/* 14772 */
+	"teicsmfh", "tekqnga", "temggrboo", "temitkxhzzipe",	/* 14776 */
+	"temkqcbep", "temnyrcnt", "temvfxkcz", "tenc",	/* 14780 */
+	"tepadj", "tepscnfsadkn", "tepzjzxcxiwj", "teqarqbttlnt",	/* 14784 */
+	"teqefqvxrtlggu", "teqzvxbperme", "terddag", "terrhnwiwqlp",	/* 14788 */
+	"tesiaqoor", "tetrxck", "tewbse", "tewgwvzbdurtrl",	/* 14792 */
+	"tewwy", "text", "teybvu", "teyiawpv",	/* 14796 */
+	"teypwrinkw", "tf", "tfaxsvv", "tfeva",	/* 14800 */
+	"tffsr", "tfh", "tfhi", "tfhrx",	/* 14804 */
+	"tfhuwzhtmdveh", "tfhxexkfmk", "tfinmni", "tfinxpjlwo",	/* 14808 */
+	"tfmaimhjr", "tfnplwmbl", "tfnwjmmhfnfrr", "tfqnrbhofukibv",	/* 14812 */
+	"tfqrtjkkf", "tfromrykz", "tfsouus", "tfstqvs",	/* 14816 */
+	"tftmpnebq", "tftsyl", "tfuqgdhquydw", "tfvlkkgzmzkzz",	/* 14820 */
+	"tfwh", "tfwnhs", "tfxzjincrtwp", "tfyc",	/* 14824 */
+	"tfyn", "tfzor", "tg", "tga",	/* 14828 */
+	"tgahcks", "tgaluglqkdr", "tgasnjbfmyo", "tgbdgvtt",	/* 14832 */
+	"tgd", "tgdbdervllm", "tgdde", "tgdrzuqhgkw",	/* 14836 */
+	"tgdvsxzox", "tgeeqjsh", "tgggymodcdi", "tggmrdqpxv",	/* 14840 */
+	"tggmtcsahucn", "tggywlcsqw", "tghgdnp", "tghz",	/* 14844 */
+	"tgilyuxs", "tgliwwjwqxd", "tgmcgbmwi", "tgmqghr",	/* 14848 */
+	"tgnayo", "tgnligrg", "tgpccqyxfh", "tgpgxqbfodz",	/* 14852 */
+	"tgqo", "tgr", "tgsnjhnwfsvn", "tgsucfozdrf",	/* 14856 */
+	"tgtw", "tgwogqsoaiye", "tgwubqqff", "tgxdjmfqaypz",	/* 14860 */
+	"tgxfiklgeupd", "tgyipsrbxrl", "thapeasxraym", "that",	/* 14864 */
+	"thbxdluwes", "thdbo", "thdiwxqxhue", "thdmxrqls",	/* 14868 */
+	"thdpbu", "thdwrpva", "thgef", "thhcx",	/* 14872 */
+	"thhmhsd", "thixxnvfmof", "thjd", "thjk",	/* 14876 */
+	"thjx", "thjyqkfpuraabl", "thjzftm", "thktdrtvlznm",	/* 14880 */
+	"thljarmjdyszkx", "thpf", "thqc", "thqqssrdlqf",	/* 14884 */
+	"thridzo", "thrjp", "thsl", "thsmzmfrriqeg",	/* 14888 */
+	"thsotvhfv", "thuwqcd", "thv", "thxmhihqde",	/* 14892 */
+	"ti", "tic", "tidafj", "tidquq",	/* 14896 */
+	"tidsxprcor", "tie", "tiepyjyvyhcj", "tifipgem",	/* 14900 */
+	"tih", "tihwu", "tihzbjlol", "tihzvai",	/* 14904 */
+	"tiiwxhil", "tijufycqljare", "tikii", "tilw",	/* 14908 */
+	"tinp", "tinqtylt", "tiomfuyunww", "tip",	/* 14912 */
+	"tiqnwysxcnltdw", "tirzgnesn", "tiubdmdbpt", "tivcnoinpsz",	/* 14916 */
+	"tiwfrpgpl", "tixfbasggfx", "tiyo", "tizjzmfsi",	/* 14920 */
+	"tiznals", "tj", "tjat", "tjbfat",	/* 14924 */
+	"tjdkhmxahz", "tjdpob", "tjegerxbyk", "tjfciwfnaytgsu",	/* 14928 */
+	"tjhxy", "tjiiyllejlafsc", "tjjkeq", "tjkeevikaboxeb",	/* 14932 */
+	"tjkrbsdln", "tjpb", "tjpnnzcf", "tjpyq",	/* 14936 */
+	"tjpzadlsinnkn", "tjqzfylmsmjgz", "tjs", "tjtxairvggoo",	/* 14940 */
+	"tjuex", "tjvenms", "tjwjblrfplix", "tjwzzjrco",	/* 14944 */
+	"tjxflokka", "tjxokwgmfdqbe", "tjywwll", "tk",	/* 14948 */
+	"tkcubshajcpm", "tkev", "tkez", "tkhvbwgzleb",	/* 14952 */
+	"tkjmj", "tkjmyfqaid", "tkjzjs", "tkk",	/* 14956 */
+	"tkkydhtoravn", "tklcspoxnkzwb", "tklotdyipoyxf", "tklw",	/* 14960 */
+	"tkmxro", "tkohazvedobql", "tkpmg", "tkrjvpy",	/* 14964 */
+	"tksqctkxhhc", "tkstkncbjfhkaj", "tkvaahmanoov", "tkwngpvu",	/* 14968 */
+	"tkxch", "tkyutstbghl", "tkzrx", "tl",	/* 14972 */
+	"tlafcsianwto", "tlask", "tlbuu", "tlchsqdxh",	/* 14976 */
+	"tlcnjtxojis", "tldesiuxkfjscj", "tlegzgrk", "tlfldjgviunaqc",	/* 14980 */
+	"tlhdesvaqlcdok", "tlhegnjw", "tlhtgpieuxsx", "tliofhgey",	/* 14984 */
+	"tljxnzpx", "tllbcbo", "tlln", "tlmo",	/* 14988 */
+	"tln", "tlogknpznmjle", "tlolvob", "tlqoidvsmou",	/* 14992 */
+	"tlqrcqbvlsiga", "tlr", "tlsfaonvvnegal", "tlshc",	/* 14996 */
+	"tlsoqafxk", "tltmy", "tlvtscfnmedul", "tlvy",	/* 15000 */
+	"tlwgj", "tlwllq", "tlwvjegjms", "tlza",	/* 15004 */
+	"tlzlhgigfkivxk", "tm", "tmaoqitkdrd", "tmapfvpmys",	/* 15008 */
+	"tmbgdnf", "tmbhpmuzrj", "tmcwqmaezhw", "tmeesnkot",	/* 15012 */
+	"tmegqyn", "tmgvc", "tmgvte", "tmhkd",	/* 15016 */
+	"tmhmcece", "tmhmcnloovrntd", "tmibbp", "tmii",	/* 15020 */
+	"tmjycfphkl", "tmkdu", "tmkkloqjb", "tmkpmlz",	/* 15024 */
+	"tmlbzpqidrhwea", "tmlcczlb", "tmlecr", "tmlhczevglyky",	/* 15028 */
+	"tmmswcajaakqrj", "tmppxvq", "tmptmpve", "tmpzmdnpjhxu",	/* 15032 */
+	"tmqecpp", "tmqmzietjhq", "tmrkesjalap", "tmrnbr",	/* 15036 */
+	"tmrwyw", "tmrxweiqa", "tmtb", "tmux",	/* 15040 */
+	"tmvtrnybtlsiyu", "tmwgzrsy", "tmwvgoxurjn", "tmxygzf",	/* 15044 */
+	"tmyfarx", "tmzxrwbebmx", "tn", "tna",	/* 15048 */
+	"tnagttevsgqwkr", "tnbuh", "tncgkh", "tncqbhoj",	/* 15052 */
+	"tndicsvvgus", "tnegvuqbdl", "tnfh", "tngcnilorwts",	/* 15056 */
+	"tnizkhbdhasck", "tnkbrjdquwlnwb", "tnlgswamc", "tnlveoaynwxf",	/* 15060 */
+	"tnmim", "tnorc", "tnosmvqgsp", "tnqbhragjooot",	/* 15064 */
+	"tnsi", "tnsmfoij", "tntquagz", "tnudgtip",	/* 15068 */
+	"tnuxq", "tnwuoszdehjufr", "tnyasukpjaakv", "to",	/* 15072 */
+	"toaxavxss", "tocvdd", "tod", "todzgbmg",	/* 15076 */
+	"toenovqgwyhy", "tofpuqvfkhm", "toghwpogaq", "tohmvsase",	/* 15080 */
+	"tojh", "tolmunphl", "tolnyeaoos", "tolqiwcvoyeais",	/* 15084 */
+	"tom", "tomotuandqcn", "tonppclis", "tonwtkwdh",	/* 15088 */
+	"tonxtrruaog", "toobceivlgnsct", "toogc", "toomorfcjfana",	/* 15092 */
+	"toouziwhicwyx", "topfyhbsbespx", "toqarpwy", "toqqssczktu",	/* 15096 */
+	"toqtyqlxcjnplc", "torauav", "torj", "torphjiuw",	/* 15100 */
+	"tosdbfqabnzine", "tould", "tovdzwstdmez", "tovnoskzr",	/* 15104 */
+	"tovtycbryxjlw", "toxjpevlosmbm", "tozhschhmaax", "tozuroictfft",	/* 15108 */
+	"tp", "tpbh", "tpbmq", "tpcpaayrth",	/* 15112 */
+	"tpcxyhvuui", "tpe", "tphppceai", "tphwltvxczajl",	/* 15116 */
+	"tphyoffeeb", "tpjtsuf", "tpkggsanq", "tplf",	/* 15120 */
+	"tplnxpgbtvd", "tplxcmlasjrutf", "tppx", "tpthlvhnkbyyz",	/* 15124 */
+	"tptjnwtjwxas", "tpuxntevkc", "tpvubnff", "tpwbst",	/* 15128 */
+	"tpxhbvtwjx", "tpxhhkxkyeucm", "tpxvwymrtvzmqw", "tpzgxxqxzmtip",	/* 15132 */
+	"tpzhadytr", "tpzpeaayqtektm", "tpzuuuyrw", "tq",	/* 15136 */
+	"tqacecgfk", "tqahkifx", "tqazzyw", "tqbhvhsj",	/* 15140 */
+	"tqedbuexgbfn", "tqelvikes", "tqepkxwmdcj", "tqfucd",	/* 15144 */
+	"tqilrz", "tqiqlxn", "tqjlubtq", "tqjszgjvev",	/* 15148 */
+	"tqkgt", "tqkxgkio", "tqljxcxlevqb", "tqnfizac",	/* 15152 */
+	"tqoiqzkxestofd", "tqowfbmqpnsx", "tqpl", "tqqwanhptlxb",	/* 15156 */
+	"tqqwlhjutn", "tqrurovhy", "tqs", "tqsnizmrwhj",	/* 15160 */
+	"tqtyhjmwrd", "tqvxeohvvedjtj", "tqxptk", "tqyhtpw",	/* 15164 */
+	"tqymcvnwlea", "tqytivbtmvrr", "tqzteao", "tr",	/* 15168 */
+	"trbchvxwchd", "trbcs", "trbyaoptz", "trcewpviwweu",	/* 15172 */
+	"trcphnrbtlobfm", "trcq", "trcuclqombtq", "trdmvbsszinup",	/* 15176 */
+	"trffonncajse", "trfmppqinaj", "trg", "trgjshdrbkjrfx",	/* 15180 */
+	"triy", "trlz", "trm", "trnpdz",	/* 15184 */
+	"trq", "trqcfwpj", "trsiuyqmxy", "trvep",	/* 15188 */
+	"trvofpsx", "trvqlyvgjbewjv", "trxcmedhywhxvn", "tryzntwl",	/* 15192 */
+	"ts", "tsad", "tsbstcrzhxg", "tsbwcalqmm",	/* 15196 */
+	"tschv", "tsei", "tsevctfycxream", "tsfbxpnj",	/* 15200 */
+	"tsffosmxre", "tsfhmipwh", "tsfkcsysyilxuw", "tsgmuvlhocnyl",	/* 15204 */
+	"tsguro", "tsmybrtz", "tsnkaixw", "tsnwstf",	/* 15208 */
+	"tsnxfncmolktfr", "tsodtkamzj", "tspkayx", "tspvirirgkgo",	/* 15212 */
+	"tsryiwl", "tssaygri", "tstswfalxh", "tsu",	/* 15216 */
+	"tsuejj", "tsx", "tsyypzgaumrwc", "tt",	/* 15220 */
+	"ttcup", "ttduygiwo", "ttheoaww", "tthohocygeujx",	/* 15224 */
+	"tthxtevdvv", "ttinkunrfjuo", "ttmdn", "ttmq",	/* 15228 */
+	"ttmwtsmlkxdsl", "ttnfhknbc", "ttnnv", "ttnroc",	/* 15232 */
+	"ttozbixbuczw", "ttppspmpc", "ttpq", "ttpslook",	/* 15236 */
+	"ttpy", "ttqkfrgbjs", "ttqygknjbx", "ttsdeifewcn",	/* 15240 */
+	"ttsukrxpmhkoyp", "tttbicpxbkupo", "tttowo", "ttukgrby",	/* 15244 */
+	"ttvekurwaizu", "ttvilm", "ttvpzdsqszefs", "ttvvdfqiqugl",	/* 15248 */
+	"ttvxajcidy", "ttvzvmu", "ttwer", "tu",	/* 15252 */
+	"tubaml", "tudiw", "tudkvdjmhoywk", "tuecrgezh",	/* 15256 */
+	"tufdspnp", "tufvehppindm", "tugjb", "tugtmqtbbowlic",	/* 15260 */
+	"tugyekamdngjqj", "tugyo", "tuhegvukuas", "tuheyikhvhow",	/* 15264 */
+	"tuhtkgcfxg", "tuhvhlieynq", "tukny", "tulmbj",	/* 15268 */
+	"tuokgfh", "tupkscgflwxcz", "tuqnaini", "turdfjuhc",	/* 15272 */
+	"turmlofwayit", "tus", "tuuolbgvieqyx", "tuvsqc",	/* 15276 */
+	"tuwbb", "tuxzbqfqpjua", "tuynwmmu", "tv",	/* 15280 */
+	"tvaltclmv", "tvaubjhctn", "tvbisfbmukbz", "tvbjhvb",	/* 15284 */
+	"tvbx", "tvcuhupfkw", "tvfssp", "tvghv",	/* 15288 */
+	"tvi", "tviyngjwhu", "tvltdbk", "tvmb",	/* 15292 */
+	"tvn", "tvnilnmt", "tvpfjisonykx", "tvqqdo",	/* 15296 */
+	"tvrxaijcrsj", "tvtilzwts", "tvtqnlsagloaye", "tvubxecnyppj",	/* 15300 */
+	"tvxkfbj", "tvxszh", "tvyfybta", "tvyglqno",	/* 15304 */
+	"twackpv", "twbwhwasntyjc", "twcda", "twcich",	/* 15308 */
+	"twcpooci", "twcsdkdnfr", "twd", "twfks",	/* 15312 */
+	"twfnhjf", "twgc", "twh", "twhhfnfmv",	/* 15316 */
+	"twhvat", "twiqvlkfbeoo", "twjrupvfehr", "twkhebktdwhqe",	/* 15320 */
+	"twkugwcw", "twlf", "twndjd", "twolch",	/* 15324 */
+	"twpginwfmh", "twputx", "twqttz", "twribcijigtb",	/* 15328 */
+	"twsdg", "twswpvlvqrwp", "twtkxl", "twtv",	/* 15332 */
+	"twvc", "twwf", "twwubwrmxql", "twxcuajf",	/* 15336 */
+	"twzbwt", "twzguqwoz", "tx", "txaauqvokv",	/* 15340 */
+	"txajsfpgjgb", "txamzxqzeq", "txbik", "txboqykqxc",	/* 15344 */
+	"txc", "txcikemtib", "txdfnonkkngoqv", "txdkatmexvqydl",	/* 15348 */
+	"txdonjpcfq", "txdzjtwjo", "txf", "txgpuzefzcm",	/* 15352 */
+	"txhwcs", "txilwphwpc", "txlhuaa", "txlkmfvr",	/* 15356 */
+	"txlpxuhiiryw", "txmgltv", "txpbaqwpim", "txpqekel",	/* 15360 */
+	"txtpt", "txuvtpabc", "txwrvjftf", "txxkzhslr",	/* 15364 */
+	"txyvwopqf", "txzccfcz", "txzxovhdaqwf", "ty",	/* 15368 */
+	"tyak", "tydligq", "tygipvsxu", "tygvxtrjlbygj",	/* 15372 */
+	"tygzo", "tyheksnydxtwed", "tyjapdhgluf", "tyjpbgvi",	/* 15376 */
+	"tympmf", "tymvgknwsqle", "tynfarmkdk", "tynlktyhivcqz",	/* 15380 */
+	"tyopulpddlvt", "typdaunvsdeh", "tyrk", "tyrqrhlg",	/* 15384 */
+	"tyrx", "tyt", "tytddhlluo", "tytkinw",	/* 15388 */
+	"tytza", "tyvcej", "tyxl", "tyxqvfwy",	/* 15392 */
+	"tyxrnaacybzdn", "tyyyj", "tz", "tzadiymazaa",	/* 15396 */
+	"tzcpqofcoodfrn", "tze", "tzermhexw", "tzeufvosj",	/* 15400 */
+	"tzfdlwfwntiur", "tzfocey", "tzhbf", "tzhitoc",	/* 15404 */
+	"tziswwt", "tzitpfjaoimsfo", "tzjhiucfue", "tzjinehmqg",	/* 15408 */
+	"tzjthc", "tzkototbkclu", "tzl", "tzlrfx",	/* 15412 */
+	"tzpakoe", "tzptyzlh", "tzqehtdo", "tzqmczh",	/* 15416 */
+	"tzshoxjqu", "tzsmranfulxox", "tzsuoar", "tztopaznmidlyi",	/* 15420 */
+	"tzuxbnyucucnqo", "tzyueujaky", "ua", "uaa",	/* 15424 */
+	"uabdnpgm", "uabslekzfbmc", "uachsqblhxg", "uaejya",	/* 15428 */
+	"uaflxcvoiyph", "uaglejpur", "uagnlduxlqf", "uahjxwoqutrw",	/* 15432 */
+	"uahnivgvlhwnhb", "uaipioqtpbrjyd", "uajmxmiyfvrdy", "uakbfmb",	/* 15436 */
+	"ualcksgp", "ualfkobwajl", "uamvszkvun", "uanxvs",	/* 15440 */
+	"uanynfn", "uapuklcvc", "uaqpesaerasdzu", "uaqvlpv",	/* 15444 */
+	"uatxreuso", "uav", "uavqkq", "uaxzyzuzrskbls",	/* 15448 */
+	"uayczhkex", "uayudk", "ub", "ubaulomhjdanpq",	/* 15452 */
+	"ubcujxiban", "ubdcvxeparhl", "ube", "ubg",	/* 15456 */
+	"ubidvobtdandag", "ubis", "ubkhwmdnkbi", "ubmcrdupbqh",	/* 15460 */
+	"ubncmdrjhayh", "ubogxsmusrt", "ubojkzdxlrhztg", "ubonvpffdfwi",	/* 15464 */
+	"ubouopbb", "ubp", "ubq", "ubsdvrkc",	/* 15468 */
+	"ubsfneq", "ubsrdkesvhxx", "ubtigawzao", "ubtrkgwfmc",	/* 15472 */
+	"ubuof", "ubvjjrwtjowp", "ubxqiowltmmhr", "ubyratvgeyq",	/* 15476 */
+	"ubzouyntc", "uc", "ucbooqrljww", "ucegkihlgtipx",	/* 15480 */
+	"ucfsnenczq", "uch", "ucjcnghmfu", "ucjwwzgebwmy",	/* 15484 */
+	"uckjvkqkgb", "ucleexycljhmy", "uclhc", "ucljuwr",	/* 15488 */
+	"uclpdoc", "uclsza", "ucoub", "ucpeqwdrubm",	/* 15492 */
+	"ucpghomk", "ucqpvdkrqmnqkl", "ucrihfwg", "ucrryhxsfzne",	/* 15496 */
+	"ucrzbbiyh", "ucsjmtfwcxxhfe", "ucsmdpyiqexpu", "uctq",	/* 15500 */
+	"ucv", "ucvkez", "ucvwrw", "ucw",	/* 15504 */
+	"ucwgclzz", "ucxt", "ucyfghfjzd", "ucyfwhgugzcp",	/* 15508 */
+	"ucyjglfexkkkfu", "ucyynengt", "uczcgmui", "uczhajcvo",	/* 15512 */
+	"uczkutbvvdnp", "uczpj", "ud", "udcdkgbwujno",	/* 15516 */
+	"udclq", "udcztsy", "udfgyrk", "udhrnrjz",	/* 15520 */
+	"udhw", "udhxydwuqwu", "udjwtngqk", "udkdpbgipodbx",	/* 15524 */
+	"udkoyvxfltmfun", "udlmlyhvcx", "udmorcbvlr", "udppfbhirhz",	/* 15528 */
+	"udqhohnkhatbgg", "udredlxjuwef", "udsqnrlveth", "udtryxsgis",	/* 15532 */
+	"udu", "uduuwl", "udvnmfxzlodfm", "udw",	/* 15536 */
+	"udxdylenwqx", "udxykfmeknojr", "udzngiyrrv", "ue",	/* 15540 */
+	"ueazdfycv", "uebdysvq", "uebnjj", "uebrwwlhns",	/* 15544 */
+	"ueenravnbon", "ueexkwj", "ueftrpiqums", "uefxmotg",	/* 15548 */
+	"uehp", "uehqe", "uehvl", "uehvnos",	/* 15552 */
+	"uekpenhqwo", "uemn", "uenkhlzvswmuc", "ueob",	/* 15556 */
+	"uep", "uercpiux", "uerucpnwhs", "uesfqnwoh",	/* 15560 */
+	"ueshrugp", "ueuom", "ueuymwlhhuihmx", "uevvuzmzkbqrm",	/* 15564 */
+	"uevyvarbn", "uewwyiiftivcqn", "uexsdisku", "ueytwkzhuikb",	/* 15568 */
+	"ueyx", "uezltsuscwar", "ufbbpm", "ufbdfzwdpx",	/* 15572 */
+	"ufcbprr", "ufccgxe", "ufchmhtxd", "ufcpilt",	/* 15576 */
+	"ufcynct", "ufeufnomvdv", "ufezsakwy", "ufgynjpcjurrmf",	/* 15580 */
+	"ufimddbsd", "ufionjpv", "ufiqtoyamruth", "ufj",	/* 15584 */
+	"ufksguhp", "uflsesq", "ufltcmofgi", "ufmohjarqxfj",	/* 15588 */
+	"ufnw", "ufqgmodki", "ufqmgltxvuexa", "ufqv",	/* 15592 */
+	"uftgek", "ufu", "ufulgsh", "ufvctxxttacg",	/* 15596 */
+	"ufvjob", "ufwbhncvrj", "ufxp", "ufyhqpcz",	/* 15600 */
+	"ufyrshdx", "ug", "ugafoxp", "ugawmf",	/* 15604 */
+	"ugbporm", "ugdgwdcaurgkw", "ugdteosr", "ugetkfqm",	/* 15608 */
+	"ugexqzzckp", "uggwx", "ugheiy", "ughuhbn",	/* 15612 */
+	"ugi", "ugijfmxyv", "ugjy", "ugkahgihcfft",	/* 15616 */
+	"uglpnvycsnmfi", "ugm", "ugoflu", "ugoj",	/* 15620 */
+	"ugokburqwnrla", "ugozdjb", "ugpoeed", "ugqyongxmmf",	/* 15624 */
+	"ugrlltqkxokvib", "ugsenfx", "ugsg", "ugssor",	/* 15628 */
+	"ugt", "ugth", "ugtmfeiaosn", "ugudbysyph",	/* 15632 */
+	"ugugqgkcbgv", "ugvnqyoxxqps", "ugwpyqtnfj", "ugxbeqcseiqdcy",	/* 15636 */
+	"ugxooshmxemra", "ugybinw", "ugyfo", "ugzmuosnwdpi",	/* 15640 */
+	"uh", "uhaghobocjfx", "uhai", "uhcdxkjswiycyv",	/* 15644 */
+	"uhcosuspzyxn", "uhdlxjeqeic", "uhhqk", "uhhwxsjqtn",	/* 15648 */
+	"uhklkcgmw", "uhkltzygy", "uhkqgsuzdlb", "uhljndccl",	/* 15652 */
+	"uhmtxajvoo", "uhniwaidbzwhld", "uhnytqtlc", "uhofmangshlslr",	/* 15656 */
+	"uhpf", "uhrtixaiejyzo", "uhtuzz", "uhvtfta",	/* 15660 */
+	"uhxlbwucx", "uhytrtd", "uhzwtjwiity", "ui",	/* 15664 */
+	"uibvghqfaalzx", "uiceqzqhlxqz", "uieubghfjyaqf", "uifotgmmkhp",	/* 15668 */
+	"uifsbot", "uifyppchg", "uigdl", "uigu",	/* 15672 */
+	"uiixlqqsysl", "uijxhxb", "uikqikctit", "uimgswgi",	/* 15676 */
+	"uimkxyaa", "uimlqoijgp", "uimmtvuqyfnee", "uinjaxycof",	/* 15680 */
+	"uinpk", "uipamf", "uipdjddfsjhv", "uiperkvz",	/* 15684 */
+	"uiptkhlnlbjpe", "uipwipsj", "uipwuevowwbwks", "uiriqttzt",	/* 15688 */
+	"uiuhbcyqulfqy", "uiujnftaxuedyg", "uiwxvxaxmiqa", "uixuqov",	/* 15692 */
+	"uixxtxm", "uiyibqcd", "uizbbgnihvolkn", "uj",	/* 15696 */
+	"ujbnkqxsui", "ujbrdfryenyvvi", "ujdisptetnwgi", "ujf",	/* 15700 */
+	"ujfbokjlgqoia", "ujfgzxkjn", "ujfosr", "ujgfplyhofpnyn",	/* 15704 */
+	"ujgm", "uji", "ujjdesafyncqwl", "ujkmguyq",	/* 15708 */
+	"ujl", "ujmrnxtbtm", "ujpvpyqstvsuoh", "ujrzyhaiyoam",	/* 15712 */
+	"ujsj", "ujslbqxbtxxwwr", "ujslvaf", "ujto",	/* 15716 */
+	"ujtrcumdfhz", "ujuryy", "ujw", "ujwaujehtiqedq",	/* 15720 */
+	"ujwqauncigzzv", "ujwu", "ujyafuwja", "ujzrvinajyc",	/* 15724 */
+	"uk", "ukaxpl", "ukbeo", "ukbgnkzzr",	/* 15728 */
+	"ukegdxtybh", "ukesfum", "ukfhtszbifsd", "ukfipjc",	/* 15732 */
+	"ukgqpunyzvgh", "ukgwouzujoizsg", "ukhmjbkfkzs", "ukhqakkazwmvtb",	/* 15736 */
+	"ukhrxfjuuf", "ukknzu", "ukkxgyavsb", "ukm",	/* 15740 */
+	"ukmqfhpzmc", "ukndjuadp", "ukodta", "ukopdztg",	/* 15744 */
+	"ukpvsyfcusl", "ukq", "ukqwzmshqdzoh", "uktghtmeu",	/* 15748 */
+	"uktqrc", "ukurnnkbvbwfqt", "ukuyvgxp", "ukvbasd",	/* 15752 */
+	"ukwywado", "ukwzphsupxvk", "ukxdl", "ukxmh",	/* 15756 */
+	"ukygnggqwsfzk", "ukypitl", "ukzjtbarbw", "ukzjzsex",	/* 15760 */
+	"ukzn", "ul", "ulbacvpcbngxsz", "ulcx",	/* 15764 */
+	"ulfpgtv", "ulgvpgzpkq", "ulhsvhgejkqa", "ulkrrgg",	/* 15768 */
+	"ulkzhyyxfax", "ulmjotkrqfaeiv", "ulmpufpzkrxng", "uln",	/* 15772 */
+	"ulowtckpv", "ulsxmvkc", "ultkhmufqmikxe", "ululrigmnjctc",	/* 15776 */
+	"ulupra", "ulveaiwkmsu", "ulvixxyhc", "ulvllmtpl",	/* 15780 */
+	"ulxqgsduyvdp", "uly", "ulyauikeekt", "ulzjdxshhnbnnj",	/* 15784 */
+	"ulzyxsvuvy", "um", "umalhg", "umarssziwcv",	/* 15788 */
+	"umbnpuusvfimfw", "umbq", "umcsafbcemozkh", "umdjbtt",	/* 15792 */
+	"umemcitr", "umfubjrmdnh", "umgiehugme", "umhh",	/* 15796 */
+	"umhyjy", "umjbqzkkywfrb", "umjqgea", "umk",	/* 15800 */
+	"umkejtess", "umle", "umlkscwe", "umlurvoepqti",	/* 15804 */
+	"umluvpwmd", "umlxxrvvjexd", "ummjtbjrlw", "ummtrewytgcay",	/* 15808 */
+	"ummvl", "ummxwrf", "umnejf", "umns",	/* 15812 */
+	"umquducp", "umtrdyqa", "umuflatrxr", "umukm",	/* 15816 */
+	"umuofqujqfospl", "umvcjdjxarmnll", "umvjflxp", "umwbxthjkk",	/* 15820 */
+	"umwdsvnvert", "umxfzhjppdsk", "umxsuogmkvthnm", "umzeebylkrynr",	/* 15824 */
+	"un", "uncwirx", "undks", "unfo",	/* 15828 */
+	"ungaair", "ungfhcto", "unhpzfraxhovwf", "unirwjndnpgq",	/* 15832 */
+	"unjfksxitnpiso", "unjpbxo", "unjxsvcnrlloq", "unkvfl",	/* 15836 */
+	"unlrwsix", "unltzsocy", "unmwblxlovcg", "unng",	/* 15840 */
+	"unpgtjxlk", "unpmxxuhqvryt", "unsabwlseseeii", "unsdjet",	/* 15844 */
+	"untesimiikcfaa", "untfky", "unvfnfmugnm", "unvjpxykhjt",	/* 15848 */
+	"unwpbbfecs", "unxagcdy", "unxayftqhf", "unxiqoula",	/* 15852 */
+	"unyelqaonq", "unyoshacgtrky", "unzknoirecey", "unzxxrmyl",	/* 15856 */
+	"uo", "uoadrfnwljp", "uocaraeharbq", "uocwkzilsafs",	/* 15860 */
+	"uodgjnrgmqq", "uodgs", "uodhgmohd", "uodhstfqaqdyh",	/* 15864 */
+	"uoe", "uoesqufdx", "uofbrotydsrr", "uofcbnqyc",	/* 15868 */
+	"uofxk", "uogdezmdmyqs", "uoglbmmeuq", "uoguv",	/* 15872 */
+	"uogwclp", "uohachrfmil", "uojqfqglpz", "uojydhqiiw",	/* 15876 */
+	"uolloanptg", "uooudtm", "uoozzhyliwry", "uoq",	/* 15880 */
+	"uoqyucujjwf", "uoqznrfwmw", "uorqsmyaxvawso", "uorytbdrzqxqy",	/* 15884 */
+	"uowilsles", "uowqt", "uoxbeavxpybyl", "up",	/* 15888 */
+	"upa", "upamzfjfpmazip", "upanzejkimyu", "upeolko",	/* 15892 */
+	"upfk", "upfmxiihmauxni", "upfrdqlmd", "upfwepeog",	/* 15896 */
+	"uphgcwgnotwxl", "upjcfswzx", "upjpsvsy", "upkaykc",	/* 15900 */
+	"upktchrxytta", "upm", "upmqte", "upmsfzsvpgjk",	/* 15904 */
+	"upniltsegp", "upnn", "uppljeo", "upqdbjkbbibnl",	/* 15908 */
+	"upqmr", "uprttofbnnvsd", "upsi", "upuqzjmtf",	/* 15912 */
+	"upzzxxjkmvg", "uq", "uqaba", "uqbwlwxvudyxea",	/* 15916 */
+	"uqclit", "uqdjykvnm", "uqdkwsa", "uqdnorqj",	/* 15920 */
+	"uqezeldqcfeni", "uqfmvzdzkdsdcr", "uqhpi", "uqhysozqppf",	/* 15924 */
+	"uqidfxuy", "uqjaefersta", "uqkhomcan", "uqkrifhvhe",	/* 15928 */
+	"uqkyrxji", "uqlqcisdojb", "uqlu", "uqn",	/* 15932 */
+	"uqndmtdvhje", "uqnhb", "uqohr", "uqokcuv",	/* 15936 */
+	"uqozccfloehmws", "uqpzfveafjfuue", "uqroxmitqibcj", "uqsfyoval",	/* 15940 */
+	"uqtmtx", "uqu", "uqwnewhle", "uqwnw",	/* 15944 */
+	"uqzfbzldnpwxu", "uqzp", "ur", "urafxj",	/* 15948 */
+	"urbgaubb", "urbr", "urclfahp", "urcsjln",	/* 15952 */
+	"urcto", "ureemetwxk", "urfeq", "urg",	/* 15956 */
+	"urjdbbqo", "urlrldiyzczrvz", "urmlpypdcjcoo", "uroiq",	/* 15960 */
+	"urpziibkrnek", "urrkdmeumvfe", "ursvzle", "urvgow",	/* 15964 */
+	"urw", "urx", "urxlznwkkr", "uryl",	/* 15968 */
+	"urzvfb", "us", "usajbes", "usartmqpcfnbpy",	/* 15972 */
+	"uscapzwl", "uscghqo", "usd", "usdlbewyn",	/* 15976 */
+	"usgjgnfvu", "usgmfbyqmxpqn", "usgudbxc", "usj",	/* 15980 */
+	"uskbdhpkyvts", "uskj", "uslytmzhdiodra", "usmkvicc",	/* 15984 */
+	"usordsvgeb", "uswsbx", "uswwzpfpxperfl", "usyaipqm",	/* 15988 */
+	"usz", "ut", "utaf", "utbe",	/* 15992 */
+	"utbgwrsecskb", "utbjasqvbhea", "utccb", "utdsho",	/* 15996 */
+	"utdxvpkd", "utenjwe", "utimom", "utjiurhsrnrfkd",	/* 16000 */
+	"utkefrvlofqcq", "utkvmaa", "utkwo", "utlpnkakngu",	/* 16004 */
+	"utlvaxiwof", "utmvw", "utnlq", "uto",	/* 16008 */
+	"utqeb", "utqtnvmc", "utr", "utrwxeg",	/* 16012 */
+	"utsiknjsrfksvg", "uttyhaxtz", "utv", "utvhuvvgryjpk",	/* 16016 */
+	"utvsfum", "utwegqjug", "utwnmoxyggfgz", "utxbgcyp",	/* 16020 */
+	"uu", "uubryglzyqzwq", "uubt", "uucikrbkzvm",	/* 16024 */
+	"uucvdaacu", "uud", "uudne", "uufenhtw",	/* 16028 */
+	"uugotx", "uugzzjlknar", "uuibrjgsalmgpp", "uukcceon",	/* 16032 */
+	"uumpbbxpmbbjyt", "uuoe", "uuonjlzanrl", "uuowhs",	/* 16036 */
+	"uuozcdkmxpuiw", "uuqltyhgdt", "uuqywofjj", "uusjdbewrp",	/* 16040 */
+	"uut", "uuuxxkouj", "uuuybmdznu", "uuwarsrkvbm",	/* 16044 */
+	"uuwxmz", "uux", "uuxpdcctlxpsxk", "uuzohznji",	/* 16048 */
+	"uv", "uvaxlkmwpgmc", "uvbjctxtfub", "uvbmky",	/* 16052 */
+	"uvcbrmmazjx", "uvcbugmieks", "uvetpogvv", "uvfqkfcddevxo",	/* 16056 */
+	"uvfzq", "uvimkev", "uvjhezii", "uvkbsahdrz",	/* 16060 */
+	"uvke", "uvlhvu", "uvlot", "uvn",	/* 16064 */
+	"uvnd", "uvoccclo", "uvqagvs", "uvrvxh",	/* 16068 */
+	"uvsgaudvevzx", "uvssedwpudepx", "uvtaow", "uvtsxdempsgu",	/* 16072 */
+	"uvutzohalnz", "uvvukrnmagle", "uvwqnv", "uvwrie",	/* 16076 */
+	"uvwzqsiodire", "uvxka", "uvyeqq", "uvzouilicpdxt",	/* 16080 */
+	"uw", "uwacfpnacxmvqt", "uway", "uwbjcmfeei",	/* 16084 */
+	"uwbjx", "uwcgdfzqatojbr", "uwcr", "uwdtvoootsjkq",	/* 16088 */
+	"uwevtyg", "uwhbtlk", "uwidzfigm", "uwjpor",	/* 16092 */
+	"uwjpzyt", "uwjt", "uwk", "uwkdnnmcmf",	/* 16096 */
+	"uwkvymwzkaijl", "uwncqruaifg", "uwntrpnlf", "uwohfdfjlgo",	/* 16100 */
+	"uworczlf", "uwosvgisbayw", "uwpjkr", "uwpx",	/* 16104 */
+	"uwqayr", "uwqslrwzunrbnr", "uwqyte", "uwrxforse",	/* 16108 */
+	"uwttwwtjom", "uwuhvuvcpvemq", "uwwrtyj", "uwwthjcevgxbxc",	/* 16112 */
+	"uwxeyge", "uwxpyyvsj", "uwytcfwfstc", "ux",	/* 16116 */
+	"uxbqw", "uxcvbly", "uxcvtmvccaa", "uxe",	/* 16120 */
+	"uxehfb", "uxel", "uxelukidclax", "uxfyxcieizxcjw",	/* 16124 */
+	"uxgji", "uxgkvroitqwfl", "uxhitzfdaiscu", "uxhwpuqg",	/* 16128 */
+	"uxi", "uxifmjghrd", "uxjghcavhyy", "uxkdrikuss",	/* 16132 */
+	"uxkivvpgivvwex", "uxkmta", "uxkvrhqozdz", "uxlmgvzhzobjdb",	/* 16136 */
+	"uxlpdggkx", "uxmjvccvmztjr", "uxnedsd", "uxpbvvknzoknlr",	/* 16140 */
+	"uxqrm", "uxskhmwuycw", "uxsuaf", "uxtfzvtuh",	/* 16144 */
+	"uxubhnoohejk", "uxwjdplc", "uxylhdg", "uxyyss",	/* 16148 */
+	"uxzrwiq", "uy", "uyanaxkr", "uyanj",	/* 16152 */
+	"uybsiberzhm", "uydg", "uydmc", "uydmmgqmwirpjr",	/* 16156 */
+	"uydplgy", "uydtiisir", "uydunf", "uyegatvsm",	/* 16160 */
+	"uyfhyrkwn", "uyfzwxqeztlsux", "uygqhs", "uygyddikwgphb",	/* 16164 */
+	"uyh", "uyhqrehslosl", "uyksvitspjtvd", "uylrflkns",	/* 16168 */
+	"uymd", "uymy", "uyoxphpmjqupgf", "uypbgfxpcohd",	/* 16172 */
+	"uyspq", "uyxvjcoaltj", "uyzrct", "uz",	/* 16176 */
+	"uzc", "uzdyczbcs", "uzgt", "uzhrnnxua",	/* 16180 */
+	"uzhvutn", "uzi", "uzibueas", "uzigcqq",	/* 16184 */
+	"uzjxcngh", "uzk", "uzmmlfqvbfel", "uznaebhvn",	/* 16188 */
+	"uznplxnlqj", "uznxxyr", "uzojudqxz", "uzoqxnrrlfymww",	/* 16192 */
+	"uzqqkoacqhjw", "uztiqmluwsjzz", "uztnwzb", "uzttqprw",	/* 16196 */
+	"uzugrollzu", "uzuvzfmrx", "uzvwfrbhrpbujc", "uzwz",	/* 16200 */
+	"uzxnmnsn", "uzyszjxy", "va", "vabwnfctcmwqj",	/* 16204 */
+	"vad", "vadqd", "vadv", "vadygfeoa",	/* 16208 */
+	"vag", "vahnyzynycqju", "vaihlytbu", "vajsdzaxo",	/* 16212 */
+	"vamax", "vamcbvujwdaavx", "vamcf", "vamrctobuh",	/* 16216 */
+	"vanb", "vanpdnjc", "vansaqbfvzt", "vaoeug",	/* 16220 */
+	"vapnopagwj", "vaprgel", "vasaxvlk", "vaskmbl",	/* 16224 */
+	"vasnmxfkshaceh", "vav", "vavmrnmhhcqij", "vaw",	/* 16228 */
+	"vaxy", "vaxyblzrb", "vayphngdmh", "vaytnnlbgowkkl",	/* 16232 */
+	"vazymmtbzyi", "vb", "vbalyxxhrlrpxs", "vbbhrhulp",	/* 16236 */
+	"vbdn", "vbgsy", "vbhaizbjjrs", "vbhtbsywq",	/* 16240 */
+	"vbhxw", "vbhzoszotqe", "vbineurlibja", "vbjnn",	/* 16244 */
+	"vbkyzplqaebpk", "vblqoysizbkzrz", "vblwhyjdybh", "vbnfb",	/* 16248 */
+	"vbqnjhsxhyehws", "vbsg", "vbsme", "vbsn",	/* 16252 */
+	"vbsxtgcr", "vbt", "vbtkw", "vbu",	/* 16256 */
+	"vbwh", "vbxijayza", "vbxmeuufzpdke", "vbxrrsimbwrlh",	/* 16260 */
+	"vbysqhodvst", "vc", "vcajapmjeg", "vcd",	/* 16264 */
+	"vcdqghmxopvfk", "vcecdcyqlzwv", "vcetvondfyrn", "vcfrmk",	/* 16268 */
+	"vcfshyiqmuhf", "vcfyd", "vcgbfruimec", "vcgjbdkx",	/* 16272 */
+	"vcgrtrxljfh", "vchz", "vcjtx", "vckgvclldjm",	/* 16276 */
+	"vcldfq", "vclfbvp", "vclwhvdc", "vcnmszrohdwxt",	/* 16280 */
+	"vcnxhkgqlfb", "vcodairnwp", "vcplnzk", "vcqspkfxd",	/* 16284 */
+	"vcr", "vcruqbucmrzxza", "vcsgyni", "vctheliit",	/* 16288 */
+	"vcwr", "vcysim", "vcyttr", "vcyukzphqrfk",	/* 16292 */
+	"vd", "vdbducsmrb", "vdflh", "vdggluc",	/* 16296 */
+	"vdgxuyfiozlkz", "vdid", "vdijpchjvmzuic", "vdixwmpgial",	/* 16300 */
+	"vdj", "vdkgztrjvot", "vdlbwq", "vdnwjjwkfhsjf",	/* 16304 */
+	"vdovguilwsy", "vdpzxsdio", "vdqfruu", "vdqzvhhbjcakp",	/* 16308 */
+	"vds", "vdsdqzkdjafc", "vdtaqejucn", "vdtlpenb",	/* 16312 */
+	"vdurdnlui", "vduytcmu", "vdvmcz", "vdvzkzsupxb",	/* 16316 */
+	"vdxamsvrklq", "vdxybzrdz", "vdyfwvpvl", "veakt",	/* 16320 */
+	"veal", "veb", "vebrze", "vechvf",	/* 16324 */
+	"vecjzhmcww", "vedkcchtuabnew", "veecsevgp", "vegcflsxhxyl",	/* 16328 */
+	"vehdrxvdh", "vehlevorihyz", "vehmgct", "veht",	/* 16332 */
+	"vejvouwe", "vel", "vemfjic", "veonrgntrfh",	/* 16336 */
+	"veoxjnade", "vepbkcu", "vepotjaisjn", "vepublmnfpywf",	/* 16340 */
+	"vereexv", "verujbj", "vesavzcg", "vetdclpduw",	/* 16344 */
+	"vevcj", "vewfm", "vewphi", "vexhxldk",	/* 16348 */
+	"vf", "vfcgxx", "vfczk", "vfenmme",	/* 16352 */
+	"vfhjxcfolm", "vfhkptt", "vfhldarenevijy", "vfhnfzyft",	/* 16356 */
+	"vfifwatvzmad", "vfky", "vflnmv", "vflsrhyfif",	/* 16360 */
+	"vfmvccpv", "vfnrhilyyu", "vfnu", "vfoismcmew",	/* 16364 */
+	"vfp", "vfsebnbmvrqy", "vfsf", "vfsmzqcn",	/* 16368 */
+	"vfsoviuexqrp", "vfspykeuvb", "vfsrofjzkrqpdv", "vfsvyxadoaf",	/* 16372 */
+	"vfsz", "vfvqabp", "vfwdypndzs", "vfxplhizwhkgo",	/* 16376 */
+	"vfzba", "vfzvy", "vfzzhirhuz", "vg",	/* 16380 */
+	"vgak", "vgbxyohdexjz", "vgcodqva", "vggey",	/* 16384 */
+	"vghcugfwjccwg", "vgioprycebhna", "vgiubdpgahaxo", "vgjjspqmsb",	/* 16388 */
+	"vgmef", "vgng", "vgnkuaivyycllq", "vgojryp",	/* 16392 */
+	"vgpthp", "vgqmbbykwxvtmr", "vgryep", "vgszscqvhyahj",	/* 16396 */
+	"vgtqxae", "vgvckvibvzdg", "vh", "vham",	/* 16400 */
+	"vhaorb", "vhcjddouvvgupw", "vhcnl", "vhcymxm",	/* 16404 */
+	"vhcyrrf", "vhdbhcccvv", "vhdrkglxbiw", "vhdymdyzslfbh",	/* 16408 */
+	"vhevrkncfsqia", "vhhj", "vhi", "vhj",	/* 16412 */
+	"vhjkbnagnt", "vhjrfgfxl", "vhjvzpj", "vhldjzxsfyehvu",	/* 16416 */
+	"vhmyn", "vhopj", "vhpirdiityfgdo", "vhpxpcskeercv",	/* 16420 */
+	"vhqyi", "vhrn", "vhuqabskktlarl", "vhutjtbjguamj",	/* 16424 */
+	"vhvoljfhnqvowg", "vhxld", "vhxlzt", "vhxwkozvhehtji",	/* 16428 */
+	"vhzoml", "viacym", "viasw", "vicgrykhiagz",	/* 16432 */
+	"vidtwfd", "vienlulym", "vihfxsubnrb", "viklgdcrkhj",	/* 16436 */
+	"vikn", "vikpjzpx", "vilwtmiqm", "vimbajainf",	/* 16440 */
+	"vimkqurbvmlefv", "vimm", "vinufsihjy", "vio",	/* 16444 */
+	"violjxkfiyd", "viom", "vioygn", "vipngmcxkwhhs",	/* 16448 */
+	"viptozzibfxf", "viscpqkhs", "visjvirtqczdv", "visvffeo",	/* 16452 */
+	"vitde", "vitzzqxlntw", "viuvpk", "viyxubs",	/* 16456 */
+	"vizseheecm", "vj", "vjauvnyte", "vjbhuabn",	/* 16460 */
+	"vjccga", "vjcdhmkpdfbbz", "vjcghozsspiwk", "vjcp",	/* 16464 */
+	"vjdmpf", "vjfibtpon", "vjfmwuys", "vjgo",	/* 16468 */
+	"vji", "vjjwgfsrc", "vjldw", "vjlievhpcjne",	/* 16472 */
+	"vjlrcpmnnrp", "vjn", "vjnblzofh", "vjnkayajthc",	/* 16476 */
+	"vjnqnv", "vjptptybhdbmfx", "vjqygbct", "vjram",	/* 16480 */
+	"vjrsmfrsin", "vjtbprvmw", "vjtiw", "vjuexg",	/* 16484 */
+	"vjulxlmgfuql", "vjumecoaao", "vjun", "vjunninj",	/* 16488 */
+	"vjuxqcwr", "vjvke", "vjvyclbybob", "vjwjoqvjfo",	/* 16492 */
+	"vjxthvfs", "vjyurkostma", "vjyzi", "vk",	/* 16496 */
+	"vkbmqqlcrp", "vkcuzaprqsuptr", "vkdpfihszxkhra", "vkhvph",	/* 16500 */
+	"vkjrxivq", "vkkyuzwsofgy", "vklokpytqi", "vkltstctpbi",	/* 16504 */
+	"vkmztwoa", "vkntodib", "vknx", "vkobzhmkgf",	/* 16508 */
+	"vkq", "vkqedtvxotksic", "vkrs", "vksaxfzifvzlqt",	/* 16512 */
+	"vksc", "vktng", "vktzkxmdf", "vkvlwlm",	/* 16516 */
+	"vkvyx", "vkwshlcwjdke", "vkxivsnk", "vkyknchluria",	/* 16520 */
+	"vkz", "vl", "vlada", "vlak",	/* 16524 */
+	"vlbxp", "vleu", "vlifrgjgh", "vlimrbvdnhd",	/* 16528 */
+	"vlnxkh", "vlolda", "vlpttau", "vlq",	/* 16532 */
+	"vlqvdghu", "vlqzbzw", "vlraaozjmxf", "vlrbh",	/* 16536 */
+	"vlrjkfh", "vluojsszqc", "vlvnnklblq", "vlwukb",	/* 16540 */
+	"vlxhtbiaoalcgm", "vlyipgi", "vm", "vmao",	/* 16544 */
+	"vmbalpnfyzvqin", "vmcliascj", "vmcnuojx", "vmefzfckgpwad",	/* 16548 */
+	"vmehogzv", "vmezvqazdr", "vmgujg", "vmipkywyzzr",	/* 16552 */
+	"vmlrxezt", "vmlvhc", "vmlwqcqxbhnc", "vmmjdjckqf",	/* 16556 */
+	"vmmpi", "vmmxohhpaji", "vmmziczyl", "vmnntubhv",	/* 16560 */
+	"vmofvadzjgny", "vmqkz", "vmr", "vmsc",	/* 16564 */
+	"vmtd", "vmtizijldtp", "vmummyfkdzhg", "vmw",	/* 16568 */
+	"vmwduhj", "vmwgedmocidji", "vmxam", "vmxqifbhvbszr",	/* 16572 */
+	"vmy", "vmyeout", "vmzcrsiqfnmbtr", "vn",	/* 16576 */
+	"vnaemw", "vncwg", "vndqoyd", "vnesqwnuagzj",	/* 16580 */
+	"vnfidrbmfap", "vnfj", "vngoixmjnxtxmz", "vnjni",	/* 16584 */
+	"vnlk", "vnm", "vnoop", "vnpipevvgmbi",	/* 16588 */
+	"vnpjcsk", "vnpmzincmrbus", "vnrcniwuyyrvja", "vnuckaoogkyy",	/* 16592 */
+	"vnupoizgekztn", "vnvfji", "vnvkvngmyq", "vo",	/* 16596 */
+	"voaixtzl", "vod", "vodfoin", "vodkbkvaeclfzb",	/* 16600 */
+	"vof", "voflbegxpejfrg", "vogx", "voidctjvhsew",	/* 16604 */
+	"vokxgfkqmomvdn", "vonp", "vopiyvlfn", "vopnyxepyov",	/* 16608 */
+	"voqcgwzpocblo", "vosbpktwnrwm", "votgmrorwc", "voucx",	/* 16612 */
+	"vovbdysuejm", "vowce", "vowgezhmju", "vowphj",	/* 16616 */
+	"voxmbkzce", "voyla", "vozjd", "vozx",	/* 16620 */
+	"vozzrxrwxoor", "vp", "vpb", "vpcbdeerg",	/* 16624 */
+	"vpdcjkji", "vpekq", "vpfgmhqksbrx", "vpfno",	/* 16628 */
+	"vpgnxf", "vpgyddvcu", "vphtjdotc", "vpjmsopdqkhn",	/* 16632 */
+	"vpm", "vpnoegzltxgmeq", "vpnwtmai", "vppwvjbqohc",	/* 16636 */
+	"vpt", "vptcaihfxbzsgc", "vptdxtrvfq", "vptyvfic",	/* 16640 */
+	"vpvcmiadbcxt", "vpvepua", "vpvv", "vpxhaljgb",	/* 16644 */
+	"vpy", "vpzkofgyguzoi", "vq", "vqavdm",	/* 16648 */
+	"vqcmbsxec", "vqdblixik", "vqiiwrflnlgibx", "vqims",	/* 16652 */
+	"vqixaxvvfgnwj", "vqjhhgmgskux", "vqls", "vqlsceeqfyjbfo",	/* 16656 */
+	"vqm", "vqoimqhioo", "vqpo", "vqrpbntl",	/* 16660 */
+	"vqrrjd", "vqu", "vqunktweh", "vqvaezen",	/* 16664 */
+	"vqvu", "vqwshse", "vqwtt", "vqx",	/* 16668 */
+	"vqxdixn", "vqxoanbnzh", "vqxyccuhaidjip", "vqzebeuresaq",	/* 16672 */
+	"vqzviafbflzze", "vr", "vrbxlkutbb", "vrcdvlxx",	/* 16676 */
+	"vrchxq", "vrcnynhvx", "vrcoosvailoc", "vrdbiar",	/* 16680 */
+	"vrdufvrfmgtl", "vreosr", "vrfqrmqazqn", "vrftvgicxhudqp",	/* 16684 */
+	"vrgxshuks", "vri", "vriodiqbyzz", "vriwtdy",	/* 16688 */
+	"vrj", "vrkmoyn", "vrlcdozjzpzl", "vrnmhxiiautcg",	/* 16692 */
+	"vropldbnjmgq", "vrov", "vrpwlzkbjc", "vrromzm",	/* 16696 */
+	"vrrxbbssiwxi", "vrsahlprcfw", "vrsefv", "vrsotjbgoyn",	/* 16700 */
+	"vrx", "vrxyyatylln", "vs", "vsasksvix",	/* 16704 */
+	"vsbdqg", "vsc", "vsccctfymsurug", "vscitscqxhc",	/* 16708 */
+	"vscnyrtrxlrgh", "vsctpb", "vseihhmwsltt", "vsfhzchlykeob",	/* 16712 */
+	"vsfrtcopvl", "vsgnsmbf", "vsiz", "vskr",	/* 16716 */
+	"vslwcd", "vsnnxkmzoj", "vsqsumaqdxw", "vsrovbzbsfet",	/* 16720 */
+	"vsrraagp", "vsryc", "vstk", "vstywgfoewwpsu",	/* 16724 */
+	"vsuok", "vswi", "vsxxqssnyqyhm", "vszsrcyrdpwq",	/* 16728 */
+	"vtcphbfdn", "vtd", "vtefkvdt", "vtexsprddmwmmo",	/* 16732 */
+	"vthleipqz", "vtjsn", "vtjuwudf", "vtlqoafpn",	/* 16736 */
+	"vtmfar", "vtmhb", "vtmkerlhrovaza", "vtmw",	/* 16740 */
+	"vtnfnxrokdcukt", "vtpbvn", "vtr", "vttm",	/* 16744 */
+	"vtvd", "vtvjzlsmsysc", "vtwaoykl", "vtwojib",	/* 16748 */
+	"vtwvhvtutlrmyh", "vtxrmvvo", "vtxzxyzhfzwvro", "vtyl",	/* 16752 */
+	"vu", "vuatbgoi", "vubjlvyukwbw", "vucj",	/* 16756 */
+	"vuees", "vueukwem", "vufmufznb", "vufyyelgis",	/* 16760 */
+	"vugqoj", "vugr", "vuhfmdtkvswiys", "vuhpncnkepixnf",	/* 16764 */
+	"vuidpmanlqbur", "vuilfmxpmyj", "vuj", "vujsqrbnw",	/* 16768 */
+	"vuk", "vukkhtlxslh", "vumemviuygpz", "vumtoznlfbaa",	/* 16772 */
+	"vunfpdaohtapfh", "vuoiwdquyj", "vuoqcwzummflsm", "vuoxen",	/* 16776 */
+	"vup", "vupw", "vurfss", "vutezcjxnto",	/* 16780 */
+	"vuuvu", "vuvlcuzvlg", "vuxhhkpvp", "vuxnhrx",	/* 16784 */
+	"vuxqzdbrpneyj", "vuynprkr", "vuzebixwm", "vuzfhi",	/* 16788 */
+	"vuzytgqc", "vv", "vvdlgfkec", "vvdmjnbhkn",	/* 16792 */
+	"vvegiwqt", "vvewqoshjsu", "vvhlo", "vvii",	/* 16796 */
+	"vvjebcmutzzz", "vvknufaeebgeh", "vvlmjsgooqosu", "vvmituld",	/* 16800 */
+	"vvmomdstccwiy", "vvoymqjdk", "vvprc", "vvqutgoderl",	/* 16804 */
+	"vvrvppqxdbhbf", "vvs", "vvsztqriinog", "vvtlwmra",	/* 16808 */
+	"vvttc", "vvvf", "vvvhvftegyr", "vvvsrlxb",	/* 16812 */
+	"vvxn", "vvxrgu", "vvxrvjt", "vvxz",	/* 16816 */
+	"vvyxapq", "vvyzchzuxl", "vvzdnzrpl", "vvziflx",	/* 16820 */
+	"vvzuta", "vw", "vwanoe", "vwauvb",	/* 16824 */
+	"vwaycu", "vwctysfiuxve", "vwdzvrrg", "vwfdz",	/* 16828 */
+	"vwferevvbesajm", "vwgekeaqeq", "vwgkgmftgoe", "vwgvxe",	/* 16832 */
+	"vwizzmuhkgpyu", "vwjtkwe", "vwkxpnozqgilii", "vwojdtzfnofnd",	/* 16836 */
+	"vwpxsclwyuwl", "vwvdvsaingpgl", "vwwpzok", "vwwtrbcnxq",	/* 16840 */
+	"vwxbne", "vwxmbfe", "vwytiefuumrch", "vx",	/* 16844 */
+	"vxayxoq", "vxcabxgfhkmg", "vxck", "vxcm",	/* 16848 */
+	"vxfziaerwziclt", "vxgssuy", "vxgxgivi", "vxhwxrrildvabp",	/* 16852 */
+	"vxjsetqt", "vxkbtcnl", "vxmtbv", "vxmzysmyv",	/* 16856 */
+	"vxncngmjqdyf", "vxnypapxwor", "vxozzey", "vxpmws",	/* 16860 */
+	"vxpwzfss", "vxqzloykc", "vxrhslfyvggjzn", "vxrqohgdarutn",	/* 16864 */
+	"vxsyevfmmqev", "vxvgfaktuyg", "vxwz", "vxzrkswia",	/* 16868 */
+	"vy", "vyaaggjynb", "vyamfzbeicx", "vyayn",	/* 16872 */
+	"vybau", "vybmelem", "vybpkkuhnpkwag", "vybqvnrsp",	/* 16876 */
+	"vybtbfgh", "vybtq", "vybwiwhzlthyxt", "vydka",	/* 16880 */
+	"vydnveqoj", "vyehp", "vyfeauzq", "vyfreiswwn",	/* 16884 */
+	"vyjqeprphp", "vylhl", "vylie", "vylnwtnmgmprc",	/* 16888 */
+	"vymkqgn", "vymrfsvwxa", "vyndgseqyv", "vyodeemwpsos",	/* 16892 */
+	"vyodidrkax", "vyqgdvjpyv", "vyrgt", "vyrpgrggj",	/* 16896 */
+	"vytbjcig", "vytrbojaijenx", "vytzdaimtu", "vywayegrnrm",	/* 16900 */
+	"vywlgnahyj", "vyxiniw", "vyxpvkfyowiaw", "vz",	/* 16904 */
+	"vzad", "vzayazsyf", "vzazulgxyad", "vzdo",	/* 16908 */
+	"vzdob", "vze", "vzeftvqz", "vzgfgilwkl",	/* 16912 */
+	"vzhzsmnabmna", "vzjumxumjn", "vzk", "vzkfucmaq",	/* 16916 */
+	"vzmhneqsocpinx", "vzmrjkpz", "vzocypejtqc", "vzokb",	/* 16920 */
+	"vzrdlw", "vzrftgcprvjx", "vztcmznejmhg", "vztwgptqexhs",	/* 16924 */
+	"vzubsaitaigukg", "vzuciiixhmvsd", "vzumr", "vzvdm",	/* 16928 */
+	"vzvmwjmocrx", "vzwafol", "vzxcutitta", "vzy",	/* 16932 */
+	"wa", "waa", "waayldidlz", "wacaxtpoksn",	/* 16936 */
+	"wacbabrkkzata", "wacfcvbd", "wacknpkamvnq", "wadegerqbmye",	/* 16940 */
+	"waeaoisfkdrfk", "waeeufnzwwa", "waekydif", "waexalhcxwzcgw",	/* 16944 */
+	"wafpkvysslxr", "wahfzufvwr", "wahknrx", "waiflowydtzf",	/* 16948 */
+	"waiol", "wajmcvxoliman", "walnl", "walrprkwlf",	/* 16952 */
+	"wanjhodug", "waorvuziwhwodx", "wapgifvvcsob", "waptkabtejv",	/* 16956 */
+	"waqi", "waqqndlqnnum", "waqtpoi", "warg",	/* 16960 */
+	"warkebvneivo", "waryxuasurbe", "wasftizpm", "wasgceuytublc",	/* 16964 */
+	"wasljgtos", "wasspmhtcqehbr", "wasu", "watmloqwdf",	/* 16968 */
+	"wavesjhklz", "wavlkb", "wax", "waxphbpnsw",	/* 16972 */
+	"wb", "wbaufecgnl", "wbavis", "wbbb",	/* 16976 */
+	"wbbiktbarcu", "wbbrik", "wbcyq", "wbdcpg",	/* 16980 */
+	"wbdsxjkckuayxy", "wbeiornocn", "wbexdpjsmc", "wbgdmd",	/* 16984 */
+	"wbgkmacxlbp", "wbgl", "wbgtm", "wbh",	/* 16988 */
+	"wbhm", "wbitra", "wbjyayv", "wbknkiybnorsn",	/* 16992 */
+	"wbnhnrftecvd", "wbp", "wbqgouei", "wbqiyyzk",	/* 16996 */
+	"wbrwlaysbzqne", "wbsfvdhsgq", "wbsfwpiclrcqeb", "wbsgrekpawbjmy",	/* 17000 */
+	"wbsllfpxfpie", "wbsruf", "wbt", "wbuepc",	/* 17004 */
+	"wbvdzip", "wbvntg", "wbvqbms", "wbzqcziikh",	/* 17008 */
+	"wbztlsifqf", "wc", "wccijbqnh", "wccnfqelxbzyn",	/* 17012 */
+	"wccyg", "wceqthzeivce", "wcflbvglqbj", "wcfmqhvfam",	/* 17016 */
+	"wcfuamjq", "wcfvzqgkl", "wcgzrh", "wchlimwmywotvr",	/* 17020 */
+	"wcifdkec", "wcikwd", "wcjdz", "wcje",	/* 17024 */
+	"wcjhfqqnw", "wcjlzjkiv", "wckbpxpujyaxl", "wckq",	/* 17028 */
+	"wckrtreffh", "wclr", "wcmu", "wcn",	/* 17032 */
+	"wcnuey", "wcq", "wcqradklfe", "wcquoalxlmnz",	/* 17036 */
+	"wcrfat", "wcsmwvvdelotw", "wcsnyhivz", "wcsxmpw",	/* 17040 */
+	"wcsz", "wcvhengkjqscxo", "wcxtryzsfxln", "wd",	/* 17044 */
+	"wda", "wdab", "wdabd", "wdaoziit",	/* 17048 */
+	"wdbkecibshvkmn", "wdboyjuqngwxp", "wdcagpfznx", "wdcefrzmlkea",	/* 17052 */
+	"wdcocmbbmxuu", "wddjrw", "wdhopcbzituyx", "wdhpjo",	/* 17056 */
+	"wdiprcgpmrp", "wdive", "wdlswypkutel", "wdnsklri",	/* 17060 */
+	"wdoofxkjrssw", "wdowakzbb", "wdozxeknrsfag", "wdphezrsuog",	/* 17064 */
+	"wdpwfutq", "wdqhqfnha", "wdqrbmomnc", "wdslltij",	/* 17068 */
+	"wdsocqyuagqy", "wdtca", "wdtcc", "wduswqw",	/* 17072 */
+	"wdvqdwunpxr", "wdwptmkzuxxuvh", "wdwr", "wdx",	/* 17076 */
+	"wdywd", "we", "weaaejsywak", "wechtwkmrdc",	/* 17080 */
+	"weedwcy", "weehuleb", "weejjwahnuuea", "wegi",	/* 17084 */
+	"weimkatcorxwx", "welpnknylnark", "wepujofgeobdj", "wes",	/* 17088 */
+	"wesdih", "wet", "wev", "wewnqyrk",	/* 17092 */
+	"wf", "wfbewhsdrgj", "wfbsziefthahuf", "wfcg",	/* 17096 */
+	"wfcjoqf", "wfdrtfwn", "wfeioxtacosno", "wfelaqdpeud",	/* 17100 */
+	"wff", "wfghoahih", "wfgocxpjw", "wfhdfjwpfvq",	/* 17104 */
+	"wfhogbsvugu", "wfiiktvnfahkce", "wfjfwznof", "wfkg",	/* 17108 */
+	"wfktecik", "wflzlvx", "wfnbilahwu", "wfnzlbk",	/* 17112 */
+	"wforai", "wfpqvmknsuhwvs", "wfqtwyznaxqdhm", "wfrztlobbhe",	/* 17116 */
+	"wfthorq", "wftjhgbduqmk", "wfto", "wfva",	/* 17120 */
+	"wfvbcpvb", "wfwgv", "wfwlrkunuvd", "wfxagi",	/* 17124 */
+	"wfxseifqqish", "wfxz", "wfyjg", "wfzgofdgofyt",	/* 17128 */
+	"wgaacmpibdxs", "wgfgdgclo", "wggyxhufxwavqu", "wghlwz",	/* 17132 */
+	"wghuo", "wgi", "wgilpoth", "wgl",	/* 17136 */
+	"wgljqlokugss", "wglopcrsanpsf", "wgmjvqzb", "wgnbby",	/* 17140 */
+	"wgnqxqwtqt", "wgop", "wgoqlokgazen", "wgpimdqcdlf",	/* 17144 */
+	"wgrkpej", "wgtyovfaygba", "wgumlloecqzk", "wguwdcjuvubnsk",	/* 17148 */
+	"wgvf", "wgwahnity", "wgwflxt", "wgwjqyiwdetwe",	/* 17152 */
+	"wgxrnbzvjrjdi", "wh", "whajcbe", "whfbife",	/* 17156 */
+	"whgacamornp", "whhqciof", "whi", "whicwqkhuztr",	/* 17160 */
+	"whjs", "whjv", "whlitbstipd", "whlmzp",	/* 17164 */
+	"whmalzydzauigd", "whnvkch", "whnzrlkzukeu", "whoolqejczq",	/* 17168 */
+	"whpbmhsfpbymfw", "whpdwgcgxd", "whpmadoebr", "whsiinl",	/* 17172 */
+	"whu", "whwp", "whxiohqsqq", "wi",	/* 17176 */
+	"wiaxem", "wib", "widgeqybluxt", "wiebuzvbejnxf",	/* 17180 */
+	"wif", "wifayuwwqjm", "wiff", "wifs",	/* 17184 */
+	"wihwia", "wiisdtx", "wil", "wilhyjtgmj",	/* 17188 */
+	"wilwwzt", "wimrs", "wimuf", "win",	/* 17192 */
+	"wiovhvamdxm", "wioymgjhiofjy", "wiqjeni", "wirtfx",	/* 17196 */
+	"wisw", "witlvwlmyfm", "wivkdkfktjpicv", "wivwztjwez",	/* 17200 */
+	"wiwsa", "wiwtdebboc", "wizbtj", "wj",	/* 17204 */
+	"wjabecaxbmjol", "wjafmhcaoch", "wjcl", "wjcwuyzzwhfnaw",	/* 17208 */
+	"wjdtahicgm", "wjecxmz", "wjemae", "wjfw",	/* 17212 */
+	"wjfyeditezf", "wjghdnfdt", "wjgsqd", "wjihaqrd",	/* 17216 */
+	"wjipvgtyhixyey", "wjiufcf", "wjlfdgggqzcv", "wjmbwojfvese",	/* 17220 */
+	"wjnapudjdpvd", "wjnzwgccmdub", "wjofecrr", "wjqrybjuzms",	/* 17224 */
+	"wjrj", "wjs", "wjuumdldjey", "wjuywk",	/* 17228 */
+	"wjvg", "wjvgkfnf", "wjvlprvbplqtez", "wjvuajk",	/* 17232 */
+	"wjwkhaibb", "wjxdxzdqc", "wjyzafu", "wjzcjfoyzltnq",	/* 17236 */
+	"wjzghyuc", "wjzkxvbpjruwfg", "wk", "wkab",	/* 17240 */
+	"wkajhcviwkav", "wkfqxlxyjuxpj", "wkgl", "wkgp",	/* 17244 */
+	"wkhujoyuqlk", "wkhux", "wkijx", "wkjctwa",	/* 17248 */
+	"wkkssfclrbbt", "wklvq", "wklwmpybys", "wkn",	/* 17252 */
+	"wkoyzhtz", "wkq", "wkqfpcb", "wkrqqqxpsmvnmi",	/* 17256 */
+	"wkszgbkx", "wku", "wkv", "wkwhlas",	/* 17260 */
+	"wkxbirklpqjc", "wky", "wl", "wlainkqoyenpx",	/* 17264 */
+	"wlaoqtkm", "wlap", "wlc", "wlcirgnfsneshm",	/* 17268 */
+	"wlcmnnakfp", "wlcqpctn", "wldktamyg", "wletzl",	/* 17272 */
+	"wlfmkqxjj", "wlg", "wliio", "wljlqtu",	/* 17276 */
+	"wlk", "wlkyz", "wll", "wlnkoydu",	/* 17280 */
+	"wlnvqivn", "wlpjrsrgdgj", "wlpsw", "wlpxlsf",	/* 17284 */
+	"wlrgnwqabjllmk", "wlrxpmmskifmul", "wltozpsb", "wluksyaxujhg",	/* 17288 */
+	"wlve", "wlvpfksvstt", "wlxybevluwrvis", "wlyyowsmclsu",	/* 17292 */
+	"wm", "wmafcudses", "wmasqpv", "wmbd",	/* 17296 */
+	"wmfe", "wmgsp", "wmhkdljrptwr", "wmipyl",	/* 17300 */
+	"wmiquilvbawvsx", "wmjqtqdwfhqrc", "wmkuujua", "wmlataub",	/* 17304 */
+	"wmlx", "wmmlp", "wmmzi", "wmndsvgfajrq",	/* 17308 */
+	"wmnmqnioksa", "wmqpjfoahsk", "wmqvsfpgxuei", "wmrhnwqwbni",	/* 17312 */
+	"wmrhprnumbfw", "wmsifpzqkioaio", "wmsxhk", "wmtlxnpon",	/* 17316 */
+	"wmufauf", "wmugkqhxtfekb", "wmurjzu", "wmutrnhqmpxk",	/* 17320 */
+	"wmvmdioak", "wmvugzzjnbtqz", "wmvxtwbz", "wmwqfhnefooxk",	/* 17324 */
+	"wmyvtsc", "wn", "wnb", "wnbhsdy",	/* 17328 */
+	"wnc", "wndtckegpnkwgq", "wngot", "wnhanbwshbli",	/* 17332 */
+	"wnhsxyuclcqaap", "wniyjiumxtk", "wnkfhgj", "wnkrt",	/* 17336 */
+	"wnlbproqcjwkez", "wnlqigh", "wnmbpmwxei", "wnnishwk",	/* 17340 */
+	"wnocztqm", "wnopwnyy", "wnpjhfoihfr", "wnpwgn",	/* 17344 */
+	"wnrqdphi", "wntcl", "wnu", "wnvvlvrovia",	/* 17348 */
+	"wnwlvabmdibb", "wnwzktyv", "wnyhhq", "wnyhssfhxlbn",	/* 17352 */
+	"wnytler", "wo", "woawrvnbzbmvbu", "wob",	/* 17356 */
+	"wobkkndasf", "wod", "wodgasz", "wodkksqqftbvr",	/* 17360 */
+	"wodktd", "wodmgsx", "wodpafdqsrdu", "woefxxtuvggzm",	/* 17364 */
+	"wofq", "wofqipzaaw", "wogt", "wohhrpptdiyran",	/* 17368 */
+	"woicdwjjyzgpx", "woiiqptemraky", "woiuevfs", "wokmmqa",	/* 17372 */
+	"womtn", "woozxs", "woqipzd", "worlnkvnc",	/* 17376 */
+	"worwtreoorwz", "woryhdgteryee", "woss", "wossvigqpuo",	/* 17380 */
+	"wosxmjdxylojd", "wott", "wouha", "wowfsfgjqpg",	/* 17384 */
+	"woxcevlpko", "woyrfwzz", "wp", "wparp",	/* 17388 */
+	"wpbeq", "wpcvcuzr", "wpdgwkqn", "wpfxqjerox",	/* 17392 */
+	"wpgaqxfg", "wpgcg", "wphukjqklgnrd", "wpi",	/* 17396 */
+	"wpjytzhrazqbai", "wpkegczippoko", "wplgf", "wpm",	/* 17400 */
+	"wppijlvdfzntz", "wpqfles", "wprbftgpzim", "wpreww",	/* 17404 */
+	"wprqtishwwgqky", "wprvkdusgewwyd", "wpuovrgdkuxan", "wpvhe",	/* 17408 */
+	"wpvxp", "wpw", "wpwd", "wpycb",	/* 17412 */
+	"wpzflv", "wq", "wqalzlwdm", "wqbjecsjpk",	/* 17416 */
+	"wqbuvoxfp", "wqcbgfrxnhfoi", "wqfv", "wqgthzkcui",	/* 17420 */
+	"wqgypoznvupaqx", "wqhiavciwmfiy", "wqjgjabcsij", "wqjiazou",	/* 17424 */
+	"wqnlmvzl", "wqoaxbibwb", "wqosml", "wqovvhpocxmna",	/* 17428 */
+	"wqpb", "wqpbxmnomk", "wqpqzglsjcu", "wqqun",	/* 17432 */
+	"wqr", "wqsepfqxghmom", "wqskzdnqyko", "wqtnmatfjtfpn",	/* 17436 */
+	"wquy", "wqvm", "wqzj", "wr",	/* 17440 */
+	"wra", "wrc", "wrdcov", "wrdxwhtyyddp",	/* 17444 */
+	"wrecfjutgb", "wretlqsfjquvn", "wrgaaptn", "wrhfocvf",	/* 17448 */
+	"wrji", "wrldrnfhnesvuu", "wrltrgrm", "wrlvefrm",	/* 17452 */
+	"wrnd", "wrnvc", "wrplnhtgrtgv", "wrqiwvir",	/* 17456 */
+	"wrqpazl", "wrqz", "wrt", "wrtkxghjsbk",	/* 17460 */
+	"wru", "wruc", "wruga", "wrutruab",	/* 17464 */
+	"wrwlk", "wrxjcdqq", "wryhhjcsbdeohf", "ws",	/* 17468 */
+	"wsdobvn", "wser", "wsfer", "wsgmsoemw",	/* 17472 */
+	"wsgsplwzpibezo", "wshrib", "wsiedxxqec", "wsikaenb",	/* 17476 */
+	"wsjuxsikrogkr", "wsjyircbstayjb", "wskcp", "wskkcung",	/* 17480 */
+	"wsktqpjh", "wsmkqectwaspis", "wsnuidsif", "wsoouzrj",	/* 17484 */
+	"wspiz", "wsrqglf", "wssh", "wssjnoscsel",	/* 17488 */
+	"wstem", "wsxnnveuo", "wsym", "wszmawazeyzlpc",	/* 17492 */
+	"wt", "wtbacyn", "wtdb", "wteasyn",	/* 17496 */
+	"wteqdssdfppy", "wtfqcytbtjqn", "wtgcejpjkmv", "wthjowfx",	/* 17500 */
+	"wthtvv", "wthwiartjsctkv", "wtkudewh", "wtm",	/* 17504 */
+	"wtnj", "wtnmqwpz", "wtnvgibaj", "wtod",	/* 17508 */
+	"wtrbusnveypupa", "wtrskkc", "wtswckhjfz", "wttnf",	/* 17512 */
+	"wtudmrdu", "wtupnjugyafasj", "wtvpqz", "wtvqlfatsqrdt",	/* 17516 */
+	"wtwdhhofrgahq", "wtwrgsnrtawn", "wtxj", "wtzsqgg",	/* 17520 */
+	"wtzwtrraako", "wu", "wuardjqxkyrus", "wube",	/* 17524 */
+	"wubiphv", "wubuwl", "wucgz", "wueiov",	/* 17528 */
+	"wugshkciyjkuxt", "wuh", "wuidec", "wuil",	/* 17532 */
+	"wuiojmfwneuglu", "wuiypct", "wujhif", "wujjfeuul",	/* 17536 */
+	"wujph", "wukfj", "wukfq", "wunnibgx",	/* 17540 */
+	"wuoaudchjrgxv", "wup", "wuq", "wuqavnpyubr",	/* 17544 */
+	"wur", "wuriffgrpoaazo", "wuscqopavv", "wusvyngwojnk",	/* 17548 */
+	"wutjqkestitb", "wutmlibkx", "wuutsysgau", "wuwrvdmfjdv",	/* 17552 */
+	"wuxvoayxviyz", "wuygc", "wuyo", "wuypeepxqssanl",	/* 17556 */
+	"wuznvsonklm", "wv", "wvayeviseq", "wvbhx",	/* 17560 */
+	"wvcdrztyddr", "wvdguwvvw", "wvdraebojo", "wvfglbqsgqsa",	/* 17564 */
+	"wvfnjf", "wvfoolndonti", "wvgtbtozivvoop", "wvhomhlw",	/* 17568 */
+	"wvhtfwzas", "wvk", "wvklnlygats", "wvlsylq",	/* 17572 */
+	"wvoybo", "wvpluzjrjwhrzb", "wvqetdjcdfqyc", "wvtnsxkolqg",	/* 17576 */
+	"wvudhpzonpdkrl", "wvvcgsxrtvyj", "wvwtpui", "wvxg",	/* 17580 */
+	"wvxgdtedrdai", "wvxxnjufdmqqat", "wvzmvbljeu", "wvzo",	/* 17584 */
+	"wvzzshxb", "ww", "wwaswiyuxtuci", "wwb",	/* 17588 */
+	"wwgihek", "wwgswoludcawxs", "wwhmz", "wwi",	/* 17592 */
+	"wwifpdrqmnmfwu", "wwixhlkfld", "wwjcwvwhxmx", "wwjfxtdahz",	/* 17596 */
+	"wwkrzf", "wwlswjyxtjdin", "wwnoruyvx", "wwnxegxwjha",	/* 17600 */
+	"wwozivubc", "wwraxudzamjdu", "wwrbwrudvdrry", "wwsfrxwfhq",	/* 17604 */
+	"wwtj", "wwuwrkw", "wwxxdwuyay", "wwyyvpqsi",	/* 17608 */
+	"wx", "wxbxhbjxvxlf", "wxcynt", "wxdy",	/* 17612 */
+	"wxe", "wxeaicyognmid", "wxebmrl", "wxefouueef",	/* 17616 */
+	"wxenuuhig", "wxexd", "wxfacpuvygud", "wxftwxsempt",	/* 17620 */
+	"wxjjrtjnr", "wxjnrmhauqgsf", "wxkn", "wxmbho",	/* 17624 */
+	"wxmhlbh", "wxog", "wxoi", "wxolzidgcziww",	/* 17628 */
+	"wxpjp", "wxr", "wxtekf", "wxuquumqbpm",	/* 17632 */
+	"wxvstt", "wxxhytuuomzqeh", "wxygru", "wxyroycfuxh",	/* 17636 */
+	"wy", "wyazgins", "wyctjkwfymuld", "wyctsucdjfojr",	/* 17640 */
+	"wydfec", "wye", "wyfiwfkmvt", "wyfohlnb",	/* 17644 */
+	"wyfzbxkddm", "wygezlycmleys", "wygxmuomomaq", "wygyxrlu",	/* 17648 */
+	"wyihxp", "wyiyip", "wyiyondsqfjg", "wymzc",	/* 17652 */
+	"wyoiyqx", "wypgrdcgrcu", "wytkh", "wytypkfxm",	/* 17656 */
+	"wyujl", "wyum", "wyuycn", "wyvln",	/* 17660 */
+	"wywcmmqbbay", "wywi", "wyxnsg", "wyydyosbayd",	/* 17664 */
+	"wyzgi", "wz", "wzanlbmzjxfbko", "wzaxw",	/* 17668 */
+	"wzbvrakqak", "wzcatzvzbglsj", "wzecikgikmww", "wzedeejmbzgck",	/* 17672 */
+	"wzgwska", "wzhww", "wzisqyfzcicvq", "wzjpz",	/* 17676 */
+	"wzjwwjxqaidtbx", "wzjzgeonyxp", "wzkhcdnxnuu", "wzl",	/* 17680 */
+	"wzljl", "wzlundlncjuz", "wznfdfsdxofea", "wzonwrr",	/* 17684 */
+	"wzorq", "wzpfsqzyvdh", "wzpv", "wztzfndp",	/* 17688 */
+	"wzugyhv", "wzwe", "wzwjgex", "wzy",	/* 17692 */
+	"wzyck", "xa", "xaakcv", "xaalzzucyeghc",	/* 17696 */
+	"xaaplzbjfc", "xacbtqvke", "xafan", "xafjpc",	/* 17700 */
+	"xahftwbiw", "xahubwlcvkab", "xaigmpjo", "xaiujnwztjq",	/* 17704 */
+	"xajmmcsevxdq", "xakfekhnsfwp", "xalan", "xanjihkow",	/* 17708 */
+	"xapshy", "xapzhyoepoufb", "xaq", "xaqbqkcwlenpz",	/* 17712 */
+	"xaqnb", "xarahgpwgxuxi", "xarnmuxp", "xasambocoejrt",	/* 17716 */
+	"xatfnewfhpgfae", "xavcvzigbtdeou", "xawluiqvixtb", "xaxpzoyxiwnrwz",	/* 17720 */
+	"xaxzabw", "xaz", "xazqyqes", "xb",	/* 17724 */
+	"xbbadjod", "xbbzq", "xbcldmshaejmvl", "xbcsbubsla",	/* 17728 */
+	"xbdhidemkc", "xbf", "xbfrmzvvp", "xbgiekytgvvb",	/* 17732 */
+	"xbhiauqxn", "xbjmakkjsz", "xbjoqwluae", "xbkrnpdpyqtwh",	/* 17736 */
+	"xblil", "xblpshzzxcxfh", "xbmgzfl", "xbnervga",	/* 17740 */
+	"xbogecpuxxvb", "xbpapytbmb", "xbqpiximcgyr", "xbrjjcwyss",	/* 17744 */
+	"xbrofdxewafwoz", "xbs", "xbt", "xbtdzgmtkwf",	/* 17748 */
+	"xbu", "xbwcmyp", "xbxqvuy", "xbykkowlsoik",	/* 17752 */
+	"xbyrgxgwgjfo", "xbzoaqvhjfnwzz", "xc", "xcapjznz",	/* 17756 */
+	"xcapxdbtz", "xcb", "xccbwknwssjxxb", "xcdrsgsnvywbz",	/* 17760 */
+	"xcduhzygoq", "xcf", "xcffvljzgtjgao", "xcfgg",	/* 17764 */
+	"xcfmfjyt", "xcfmlcazsphcan", "xcgl", "xchqrtzzit",	/* 17768 */
+	"xcjjlhkbadkzeh", "xck", "xckwzssurnlvvv", "xcnyhz",	/* 17772 */
+	"xcoy", "xcpb", "xcpcrysnrzwli", "xcrellfjpxtmp",	/* 17776 */
+	"xctffrk", "xcthulyruswrq", "xcuknemlyqsp", "xcv",	/* 17780 */
+	"xcvcpae", "xcw", "xcwtmgrushop", "xcxack",	/* 17784 */
+	"xcytvoyyo", "xczhz", "xczvbm", "xd",	/* 17788 */
+	"xdbbnzgsuid", "xdbg", "xdbnr", "xdcb",	/* 17792 */
+	"xdcqgqbf", "xdczzxhjwiqnh", "xddkltyp", "xde",	/* 17796 */
+	"xdetyf", "xdiy", "xdj", "xdjymyohm",	/* 17800 */
+	"xdkpqyc", "xdlal", "xdllyftpf", "xdlqgymm",	/* 17804 */
+	"xdmlhwfk", "xdn", "xdnke", "xdosvth",	/* 17808 */
+	"xdowlcoxus", "xdp", "xdrcnuk", "xdrs",	/* 17812 */
+	"xdtcwgiedo", "xdustsjhbgaev", "xduwgyp", "xduwmvohjw",	/* 17816 */
+	"xdvapwxujdrmd", "xdvzzjq", "xdw", "xdwmxmvlqqli",	/* 17820 */
+	"xebrrrsoysm", "xecihwisfon", "xedinlt", "xef",	/* 17824 */
+	"xefgqquqfivymy", "xehg", "xehh", "xehhjznbkeqd",	/* 17828 */
+	"xeiaxdcpfd", "xeiqkrtsf", "xeizmzd", "xek",	/* 17832 */
+	"xekllwluzyxmt", "xel", "xelhnuiyil", "xemno",	/* 17836 */
+	"xencn", "xenzmguajtyr", "xeorvh", "xepzpbbgxopqtg",	/* 17840 */
+	"xeslethm", "xeuu", "xevnynnycojq", "xex",	/* 17844 */
+	"xexbgfhevh", "xexcbigmctnns", "xezvegubzfsbt", "xf",	/* 17848 */
+	"xfacntbrgrnl", "xfamcepl", "xfbahpydqivgk", "xfbj",	/* 17852 */
+	"xfbseyyfom", "xfbtf", "xfcpde", "xfcr",	/* 17856 */
+	"xfctssmtcjh", "xfgnkre", "xfhcpkxrdb", "xfhjwel",	/* 17860 */
+	"xfhvdgdgxuhbn", "xfiggq", "xfikapas", "xfilso",	/* 17864 */
+	"xfitrdz", "xfkz", "xflnxh", "xfmd",	/* 17868 */
+	"xfnccxpcmwynnx", "xfnwc", "xfnyhqq", "xfoha",	/* 17872 */
+	"xfon", "xfp", "xfpitjns", "xfq",	/* 17876 */
+	"xfrbwswv", "xfsosxetioqf", "xftedtttqxmq", "xftse",	/* 17880 */
+	"xfugdf", "xfuymsvviw", "xfw", "xfxnbzntwjb",	/* 17884 */
+	"xfydxcbfclb", "xgai", "xgbncbgaqru", "xgbxigdo",	/* 17888 */
+	"xgbzim", "xgcnwvhugn", "xgcyowyoft", "xgdwxgqkwzm",	/* 17892 */
+	"xgeo", "xgeuotgosx", "xgiyxqak", "xgjp",	/* 17896 */
+	"xgksv", "xglavappo", "xglqhrh", "xglyubvznz",	/* 17900 */
+	"xguyl", "xgvbhj", "xgxjbhglbxfh", "xgzxaxvqsxu",	/* 17904 */
+	"xh", "xhadfauda", "xhbtsejdvzxnkt", "xhdnzcpji",	/* 17908 */
+	"xhdthu", "xhehwvs", "xhfhiyjwybmyx", "xhfkntz",	/* 17912 */
+	"xhgkziry", "xhgwersmeswefl", "xhgyutnsvwwuue", "xhioratppdmo",	/* 17916 */
+	"xhjxhnfna", "xhkfrf", "xhkkuzf", "xhlbynzbpn",	/* 17920 */
+	"xhlgpir", "xhlnrw", "xhlqyiro", "xhmbbcmebdevpo",	/* 17924 */
+	"xhpxmaqid", "xhqamztxwkdrg", "xhqxmhl", "xhrkvkhahizcbe",	/* 17928 */
+	"xhsejouyqrswx", "xhssma", "xhstpjfldtlgt", "xhszytwer",	/* 17932 */
+	"xhuehz", "xhukviawjwsbi", "xhvdyu", "xhweizrxpmqjbk",	/* 17936 */
+	"xhxcnvczplspsz", "xhxnanmn", "xhyjmrt", "xhzbbicxjydaxc",	/* 17940 */
+	"xhzpvofdbvjt", "xiamxqmeftidn", "xiaprbdhxo", "xices",	/* 17944 */
+	"xicszmmia", "xid", "xidezqoctwxf", "xidhgchgtso",	/* 17948 */
+	"xidr", "xiex", "xieznwozknk", "xifwld",	/* 17952 */
+	"xifwwiubcjpvr", "xiimov", "xiivpstljwje", "xijnb",	/* 17956 */
+	"xildjzo", "xilfvrdqry", "xilfwsznogckw", "ximftmrcb",	/* 17960 */
+	"ximtquhr", "ximzqznqvx", "xipx", "xiq",	/* 17964 */
+	"xiquhygrvad", "xiqvc", "xiqx", "xirbcxeblv",	/* 17968 */
+	"xit", "xiuzhdbj", "xivfmyfdr", "xivg",	/* 17972 */
+	"xivry", "xiztf", "xj", "xjbqyzddg",	/* 17976 */
+	"xjbzscdyu", "xjcsp", "xjcxvjnisucvkx", "xjd",	/* 17980 */
+	"xjdunrrxirw", "xjebp", "xjetx", "xjfaeonmdy",	/* 17984 */
+	"xjfavul", "xjfjjfrtiobdvb", "xjhrkib", "xjhxmeat",	/* 17988 */
+	"xjkffb", "xjkopmotjpvii", "xjltlsrq", "xjme",	/* 17992 */
+	"xjmmnstgk", "xjnfu", "xjoguurvqkvina", "xjpcusfts",	/* 17996 */
+	"xjqdysjfbsd", "xjqmyfswvdv", "xjqu", "xjsgtb",	/* 18000 */
+	"xjt", "xjtav", "xjtuclkydmz", "xjwfmdhlzo",	/* 18004 */
+	"xjwhpmoxdceo", "xjygvnoaieykp", "xjzlhkdhls", "xjznu",	/* 18008 */
+	"xk", "xkaygjghzprzyx", "xkbipdy", "xkbrpgyriefo",	/* 18012 */
+	"xkcof", "xkddhgrckge", "xkdkjumlxbtun", "xkg",	/* 18016 */
+	"xkh", "xkhbqttquxu", "xkhgeesq", "xkhordfdalph",	/* 18020 */
+	"xkhylrbydunuu", "xkiqetn", "xkiscfaromniud", "xkjiflvqxxlc",	/* 18024 */
+	"xklwijjmhzrgch", "xkmad", "xknukerxtehov", "xkomtkf",	/* 18028 */
+	"xkpn", "xkprdteebkk", "xkqjcvctjakzu", "xkqpkmrb",	/* 18032 */
+	"xkvezxhbfbck", "xkvmkavmnn", "xkvnittpeo", "xkxslbekkejynr",	/* 18036 */
+	"xkydodrwyqm", "xkynzkrdva", "xkyqxucvqiyyll", "xkywmsxtslzp",	/* 18040 */
+	"xkzhswcyedcff", "xl", "xlazthazvwo", "xlcsaznmpjsef",	/* 18044 */
+	"xlcxcmjoyba", "xldnmbdtbdozb", "xlftyvsfbtx", "xlge",	/* 18048 */
+	"xljsrxvktta", "xlnoyptqia", "xlokulv", "xlooun",	/* 18052 */
+	"xlqbxf", "xlqsj", "xlqvlidstx", "xlrgbaekm",	/* 18056 */
+	"xlsjlyhmnsnpbm", "xlsukyqtefd", "xltgamybcptx", "xluv",	/* 18060 */
+	"xlvecdir", "xlwlgadumst", "xlxnzqor", "xlyuwjjjtzy",	/* 18064 */
+	"xlzfbhvbqqjsf", "xlzpqirrekj", "xm", "xmayfdrqbxd",	/* 18068 */
+	"xmc", "xmceztio", "xmcokiubutbdrg", "xmeskixmxkeaa",	/* 18072 */
+	"xmf", "xmfblfkiv", "xmfggqevy", "xmhqfljfuwiema",	/* 18076 */
+	"xmkgtikvaafuv", "xmksayqljfynl", "xmkxblihwmllb", "xmlvnmbci",	/* 18080 */
+	"xmmdlejxr", "xmmeb", "xmmywkso", "xmncpm",	/* 18084 */
+	"xmnqgu", "xmoruwemcqbf", "xmpdcj", "xmrny",	/* 18088 */
+	"xmrzocwbb", "xmsx", "xmvhcegke", "xmwpmfqh",	/* 18092 */
+	"xmyyjubumtqo", "xn", "xnccxvrcbp", "xnczksy",	/* 18096 */
+	"xndgsotgprj", "xndxylksmetsmb", "xnehoqb", "xnepbnk",	/* 18100 */
+	"xnhy", "xnhychuu", "xnkd", "xnlkbjnhixidw",	/* 18104 */
+	"xnlqcmfa", "xnlwhplbcyt", "xnmeudipfwzwbr", "xnmjd",	/* 18108 */
+	"xnnhhamswh", "xnnvhpasdybvrq", "xnojuwypct", "xnooovt",	/* 18112 */
+	"xnoz", "xnpdmohzcgd", "xnplpfyrug", "xnqimcv",	/* 18116 */
+	"xnrapsilwyuae", "xnrjqgdmkpecb", "xns", "xnsrifgm",	/* 18120 */
+	"xntxkuwe", "xnudlvtxojivi", "xnvzuzuvwbcl", "xnwgsbstsykxb",	/* 18124 */
+	"xnwkzhw", "xnwugwslvkpa", "xnxkwzme", "xnyiypk",	/* 18128 */
+	"xnywq", "xo", "xoakhd", "xoapoxfgjlst",	/* 18132 */
+	"xob", "xoc", "xocxgfmiererr", "xodvst",	/* 18136 */
+	"xoejobe", "xoeykz", "xohtkktkdejz", "xoirnhq",	/* 18140 */
+	"xojhysjvwylpqk", "xojum", "xok", "xokpzi",	/* 18144 */
+	"xoljbrpfijnjo", "xomdfr", "xopfasuoipzxsy", "xopfruqhwbf",	/* 18148 */
+	"xopje", "xoqddr", "xoqk", "xoraceaxrvba",	/* 18152 */
+	"xordbzfzjws", "xorkdb", "xorqamfp", "xosh",	/* 18156 */
+	"xoti", "xotoredmgxh", "xotylgkyz", "xougyg",	/* 18160 */
+	"xouuhfrsge", "xowazitgy", "xowbqp", "xoyaut",	/* 18164 */
+	"xoybsqysmmmqo", "xp", "xpacsdppf", "xpbtgmwxpdbmil",	/* 18168 */
+	"xpc", "xpcitdvlnzs", "xpczjfwoicy", "xpdcwrryiivc",	/* 18172 */
+	"xpdel", "xpe", "xpfjw", "xphkkjdzqnatag",	/* 18176 */
+	"xphubteccpnkc", "xpjpwrg", "xpkkno", "xpl",	/* 18180 */
+	"xplnyzubqq", "xplpuyvxg", "xplwdokahj", "xplwthn",	/* 18184 */
+	"xpocfiqaznjsrs", "xppuvirxycctnv", "xppwjnitlah", "xpqxzusxjxx",	/* 18188 */
+	"xprgklbe", "xprjslmmt", "xpspoyzayeixnh", "xptjewzwlw",	/* 18192 */
+	"xpvtlsgwri", "xpwjtqje", "xpxgizdbcdtr", "xpzgedvolcmqp",	/* 18196 */
+	"xpzyoxiyt", "xq", "xqakxrhwvjafjw", "xqdmdbxk",	/* 18200 */
+	"xqff", "xqgarknthnmq", "xqgsizvtjrdhnb", "xqif",	/* 18204 */
+	"xqirudrnpavop", "xqjqxi", "xqlnurkbrz", "xqmnojdvnmk",	/* 18208 */
+	"xqmylewbzfzo", "xqnkwzijev", "xqohhpfmkjucs", "xqqaymtwaxtkol",	/* 18212 */
+	"xqsxeqdcjtl", "xqtakhbambzp", "xquagmnqckmckf", "xqubuwebsu",	/* 18216 */
+	"xqvpiuyjl", "xqvqjk", "xqwgtqkxcfdnnr", "xqwpvsmf",	/* 18220 */
+	"xqxhvismphthd", "xqxkpkjm", "xqxtxi", "xqxzjijjyidta",	/* 18224 */
+	"xqzd", "xr", "xranckeff", "xrc",	/* 18228 */
+	"xrfpi", "xrgquxyfmphi", "xrhoddqa", "xrjjgaiu",	/* 18232 */
+	"xrkpjrz", "xrkrgxyiffuro", "xrl", "xrlaf",	/* 18236 */
+	"xrne", "xrnuwxqse", "xrowz", "xrpcfxkxofby",	/* 18240 */
+	"xrpmequgb", "xrq", "xrqiuntdek", "xrqlwte",	/* 18244 */
+	"xrqmtsyyyaus", "xrrvfjyuxjiqq", "xrshbm", "xrsx",	/* 18248 */
+	"xrtznuusckork", "xruunczeoq", "xrwj", "xrxa",	/* 18252 */
+	"xryk", "xrynuihlvhqoc", "xrynwhscjeo", "xrysmwzpwfw",	/* 18256 */
+	"xrzgllbl", "xs", "xsa", "xsd",	/* 18260 */
+	"xsdtx", "xsejvabpnqrte", "xsems", "xsfiilr",	/* 18264 */
+	"xsfmurezzd", "xsg", "xsgp", "xsgyuuvjjynjch",	/* 18268 */
+	"xshfcbblszk", "xsiis", "xsjtydgz", "xskfz",	/* 18272 */
+	"xskn", "xsmf", "xsn", "xspmddvlop",	/* 18276 */
+	"xspnccb", "xspqdu", "xspqhbiima", "xsrbtyxrrzchwr",	/* 18280 */
+	"xsvmhadn", "xswlhidfgslp", "xsxojlhpet", "xsyd",	/* 18284 */
+	"xszidnq", "xt", "xtbjqpeu", "xtbzdrvi",	/* 18288 */
+	"xtdyxsllpmqdj", "xtekaxfvmm", "xtemqh", "xtemtrsyvakmr",	/* 18292 */
+	"xtepbnowaa", "xtie", "xtkck", "xtkzf",	/* 18296 */
+	"xtmmxfziz", "xtoe", "xtqjhrwnooqrjf", "xtqr",	/* 18300 */
+	"xtqrin", "xtqv", "xtsqpnkkcjxie", "xtvo",	/* 18304 */
+	"xtvwjxg", "xtwcpriluiqh", "xtxbanjade", "xtxyavgnf",	/* 18308 */
+	"xtz", "xtzshpvzxxd", "xtzuwpt", "xu",	/* 18312 */
+	"xuab", "xualidhfhh", "xudoiltputo", "xuefzammr",	/* 18316 */
+	"xuehldduyi", "xueugjutorto", "xufn", "xuguerogtjnkm",	/* 18320 */
+	"xuh", "xukztocaaaort", "xunb", "xunjxkcjtwennx",	/* 18324 */
+	"xunpcq", "xunpugdgtis", "xuoezhqjhl", "xuoj",	/* 18328 */
+	"xur", "xusgwwf", "xusmwbiktdn", "xuvfbe",	/* 18332 */
+	"xuvgycsvfxc", "xuvpb", "xuwwzekvg", "xuyjvppobmlj",	/* 18336 */
+	"xuykapilqiio", "xuymundivzunf", "xuzwhguim", "xv",	/* 18340 */
+	"xvaldnecwnhv", "xvbfodxpw", "xvcxoycygxgzea", "xvdzjazeqap",	/* 18344 */
+	"xvewqleoow", "xveyeawhacqupv", "xvfaqqg", "xvfzuzsv",	/* 18348 */
+	"xvgbbn", "xvghqmpxspq", "xvgrwndvb", "xvhcqehutrufsg",	/* 18352 */
+	"xvhugyd", "xvkaucrds", "xvlck", "xvlgmzurmpcmp",	/* 18356 */
+	"xvmqubqspxxdh", "xvn", "xvnyuexil", "xvocucf",	/* 18360 */
+	"xvodljlmxpapbj", "xvpadajfdo", "xvpfudz", "xvpwdmubgdqjk",	/* 18364 */
+	"xvsmrui", "xvucypftjotkzq", "xvukvsjl", "xvut",	/* 18368 */
+	"xvuufmbim", "xvwde", "xvyhxer", "xvyicjo",	/* 18372 */
+	"xvymurr", "xw", "xwadgtxtjytcpj", "xwcoyhmqbikc",	/* 18376 */
+	"xwewshg", "xwfk", "xwfsiet", "xwgbpymvcc",	/* 18380 */
+	"xwgwclpzzdgzex", "xwhn", "xwi", "xwjsho",	/* 18384 */
+	"xwjusm", "xwjw", "xwkaqpvokajsn", "xwlfattz",	/* 18388 */
+	"xwncc", "xwoqfemmevg", "xwqmo", "xwrfejxjdc",	/* 18392 */
+	"xwrq", "xwsg", "xwsrru", "xwvecmbaecx",	/* 18396 */
+	"xwvfafqtul", "xwvktealyfhhwp", "xwxcpxhuuju", "xwxewaewykpkd",	/* 18400 */
+	"xwzjvixlljnm", "xx", "xxbcw", "xxbmhv",	/* 18404 */
+	"xxbyx", "xxcnzo", "xxcvvxgjivd", "xxdeb",	/* 18408 */
+	"xxdi", "xxfqmo", "xxgzldedlej", "xxit",	/* 18412 */
+	"xxjawwpc", "xxjljixy", "xxjsb", "xxkxblqof",	/* 18416 */
+	"xxmhvtiyckcdn", "xxnbzmgitc", "xxnojwyh", "xxnsgbttk",	/* 18420 */
+	"xxntnzkxfo", "xxnuelmhy", "xxo", "xxoosptbtpjke",	/* 18424 */
+	"xxpeody", "xxqdun", "xxsxcxzbbdwi", "xxudaxxxs",	/* 18428 */
+	"xxv", "xxvex", "xxvihh", "xxwsxnzfrz",	/* 18432 */
+	"xxxkjhugmr", "xxyop", "xxyrfbw", "xxyrh",	/* 18436 */
+	"xy", "xybbmkoxygb", "xybdnglz", "xyd",	/* 18440 */
+	"xyefsiyeimhkmb", "xyegd", "xyfj", "xyizricymbsr",	/* 18444 */
+	"xyjah", "xymppxb", "xynbdepodvfav", "xyojipyhkgvqrr",	/* 18448 */
+	"xyrxa", "xytetjayqswfo", "xytiztbi", "xytnlmgpflbjdb",	/* 18452 */
+	"xytssr", "xyvamzs", "xyvki", "xywfsttyfpzqp",	/* 18456 */
+	"xywqldoi", "xyx", "xyxecclajlu", "xyymfcixmwoubu",	/* 18460 */
+	"xyyoxidrr", "xyzraqjxnfmn", "xzafmitufghw", "xzaqktv",	/* 18464 */
+	"xzatomr", "xzb", "xzcqqvft", "xze",	/* 18468 */
+	"xzeyrobcp", "xzffsb", "xzfldskocwq", "xzfxogjyzp",	/* 18472 */
+	"xzghvwlztxugf", "xzjdlwg", "xzlczju", "xznuuxdap",	/* 18476 */
+	"xznuycss", "xzo", "xzqy", "xzs",	/* 18480 */
+	"xzsvtgu", "xztvndx", "xzuefjtocaiyu", "xzuglocxy",	/* 18484 */
+	"xzvdak", "xzxwsrngxnvl", "xzzf", "xzzg",	/* 18488 */
+	"ya", "yaaskquyagc", "yacdczqxhqy", "yacxisar",	/* 18492 */
+	"yaetf", "yafkitnyyak", "yahcgni", "yahxnmmwcqib",	/* 18496 */
+	"yalukwtcz", "yanta", "yaqatt", "yaqmug",	/* 18500 */
+	"yaqqb", "yarbmexgcp", "yaritsjxu", "yas",	/* 18504 */
+	"yatagnbbaj", "yatoeyym", "yaub", "yavceiys",	/* 18508 */
+	"yawoixzhsdkaaa", "yawqe", "yawsuthzjaoopy", "yaxmyabpij",	/* 18512 */
+	"yaxn", "yaxq", "yayyokm", "yayyxxhfujbdh",	/* 18516 */
+	"yaz", "yazmwder", "yazumrsdoimq", "yazylcvbnay",	/* 18520 */
+	"yb", "ybazcb", "ybcjg", "ybcq",	/* 18524 */
+	"ybcrkj", "ybdgxiscolxfbj", "ybdz", "ybedlipulmqesy",	/* 18528 */
+	"ybfcrptkcwjnjo", "ybhdg", "ybhspqsxo", "ybkkh",	/* 18532 */
+	"ybnwsfncowvqhd", "ybpvclg", "ybqhj", "ybqtpmdfmf",	/* 18536 */
+	"ybrntncfpjcrqp", "ybti", "ybunmzyglrmxm", "ybwgqu",	/* 18540 */
+	"ybx", "ybykcrd", "ybykljtsvnbibn", "yc",	/* 18544 */
+	"ycb", "ycbfxqgyri", "ycckn", "ycf",	/* 18548 */
+	"yciblcghdasq", "ycjjufjbminigy", "ycjvcjibxccfek", "yckoooru",	/* 18552 */
+	"yclerewy", "yclfyzmhwcqirs", "yclwzfrk", "yclyoltwzzh",	/* 18556 */
+	"ycmsfg", "ycmw", "ycnjcpgf", "ycnvy",	/* 18560 */
+	"ycp", "ycrrijmjmm", "yctkuyeqraul", "yctnvypz",	/* 18564 */
+	"yd", "ydawlrkvte", "ydbdxokxfa", "ydbglcmstgvkm",	/* 18568 */
+	"ydcayhukhx", "ydcfpezwu", "ydcnvfkls", "ydeckvoveme",	/* 18572 */
+	"ydfguljrgbo", "ydftpzr", "ydhhjtuhids", "ydhrxadqgi",	/* 18576 */
+	"ydmltollxydnez", "ydmnr", "ydoetejbfgv", "ydoj",	/* 18580 */
+	"ydpcitxxtcmysn", "ydqrch", "ydqtqagwbpci", "ydqwcohkboxpts",	/* 18584 */
+	"ydqzgm", "ydskldhgy", "yduqdanbqs", "ydxemb",	/* 18588 */
+	"ydybobhqi", "ydysymjgcitmn", "ydzxbekag", "ye",	/* 18592 */
+	"yeaplreuuceivn", "yeb", "yebjr", "yebnesvbztcplq",	/* 18596 */
+	"yebuiqwthq", "yeeohkse", "yeermurzrhiwhj", "yeh",	/* 18600 */
+	"yeiruxvuamz", "yejcu", "yekang", "yeksad",	/* 18604 */
+	"yelbyczwm", "yelfg", "yemishw", "yemjurnpkzfc",	/* 18608 */
+	"yemtuq", "yepat", "yeqf", "yeqz",	/* 18612 */
+	"yerdkg", "yesewd", "yesw", "yeuernaeev",	/* 18616 */
+	"yeutmayzgtaka", "yevrqeelcu", "yewho", "yewo",	/* 18620 */
+	"yexhphxqw", "yexuyjntnf", "yexzcjzdhqgwfs", "yeybsuxcvfevun",	/* 18624 */
+	"yeyzslc", "yf", "yfanoy", "yfc",	/* 18628 */
+	"yffug", "yfhnplh", "yfho", "yfirqgebjuno",	/* 18632 */
+	"yfjgmcr", "yfkctohjxrn", "yfkdtwqlcmdhnj", "yfkfuuf",	/* 18636 */
+	"yfkgzowosey", "yfn", "yfqhuuff", "yfqqioge",	/* 18640 */
+	"yfqudiq", "yfqwgsmlgtnfwg", "yfupksezjpyov", "yfutejzg",	/* 18644 */
+	"yfvracqtlrh", "yfx", "yfxhoiakvf", "yfxkfcurthv",	/* 18648 */
+	"yfxwebrwuhfafn", "yfyvlcdo", "yfzpbefjmxnmg", "yg",	/* 18652 */
+	"ygaczzqko", "ygaf", "ygcoubp", "ygdhaot",	/* 18656 */
+	"ygeg", "yggjkdzdkyq", "yggznx", "ygix",	/* 18660 */
+	"yglh", "ygnyzlmrycoyo", "ygoaguoamca", "ygodrrnjihpp",	/* 18664 */
+	"ygogq", "ygphewqye", "ygqefxkxw", "ygqtowyan",	/* 18668 */
+	"ygsv", "ygtckroopgnb", "yguxrptcwwzr", "yh",	/* 18672 */
+	"yha", "yhaqox", "yhauawcmex", "yhbxpmsv",	/* 18676 */
+	"yhbxuzyss", "yhenc", "yhfzla", "yhgmvae",	/* 18680 */
+	"yhgqs", "yhimfv", "yhjaxuhc", "yhjdebxnc",	/* 18684 */
+	"yhjzmoibyejpvq", "yhlxqbulvdfaa", "yhmbkqxvfd", "yhnfepidpkor",	/* 18688 */
+	"yhnrweseige", "yhosjnfdc", "yhpfg", "yhrgp",	/* 18692 */
+	"yhsqyzn", "yhssz", "yhtafixclcd", "yhtdokehfpdh",	/* 18696 */
+	"yhutkokxfihok", "yhxop", "yhztufqqpv", "yi",	/* 18700 */
+	"yiaawai", "yiaclbwrgnzs", "yiap", "yicwovxwunt",	/* 18704 */
+	"yidcojkeppxp", "yidelcvdoi", "yidgsgin", "yidokkq",	/* 18708 */
+	"yifejiqrir", "yifestrrcacfkh", "yigougavjo", "yijjagnzzehxk",	/* 18712 */
+	"yik", "yindffb", "yiohmuqwwhwp", "yipfqkhtudly",	/* 18716 */
+	"yiqomfoylltutn", "yirr", "yirrxc", "yiskj",	/* 18720 */
+	"yitdch", "yiuc", "yiuxtxjv", "yiuzdbkketjh",	/* 18724 */
+	"yiynamyfbt", "yiyogkhbifmzsc", "yiywaqjnwbbk", "yizqkvyciqt",	/* 18728 */
+	"yj", "yjbecpvhmqe", "yjezjrrqgy", "yjfdpfo",	/* 18732 */
+	"yjffwoz", "yjftndmicr", "yjivfeujux", "yjiztanl",	/* 18736 */
+	"yjjhvmx", "yjjiqzxvyu", "yjkf", "yjkz",	/* 18740 */
+	"yjlauyh", "yjluljkd", "yjlvtofipztmnn", "yjm",	/* 18744 */
+	"yjobuovvbfsqe", "yjpbcp", "yjq", "yjqsssqqmgafcn",	/* 18748 */
+	"yjrqnspaxfhin", "yjs", "yjt", "yjtrori",	/* 18752 */
+	"yjuiwdelonkzy", "yjuk", "yjuyqctzo", "yjvcidccsvvdq",	/* 18756 */
+	"yjvouv", "yjvowmssga", "yjwkzbqpoaer", "yjyh",	/* 18760 */
+	"yjzat", "yjzcnzeqbko", "yk", "ykawrvuel",	/* 18764 */
+	"ykbwplfvvgkyoo", "ykcyr", "ykd", "ykevkytdd",	/* 18768 */
+	"ykfdto", "ykfgeauopbtvu", "ykfhjkcrprd", "ykfneanaqz",	/* 18772 */
+	"ykg", "ykih", "ykix", "ykixagakpqg",	/* 18776 */
+	"ykljfezmomdtei", "yklzpetgng", "ykmksrbmoqr", "ykmozdple",	/* 18780 */
+	"ykpatkpce", "ykpzpp", "ykrrezdpvuv", "ykruxoo",	/* 18784 */
+	"ykwo", "ykzfmezgxv", "ykzoyfxwa", "yl",	/* 18788 */
+	"ylckjqu", "ylcpi", "yldiwauyvbdudu", "yldxgok",	/* 18792 */
+	"yldzineb", "yle", "ylexfbdmipj", "ylfbnmexs",	/* 18796 */
+	"ylfl", "ylgfxu", "ylh", "ylhtyaxjdz",	/* 18800 */
+	"ylhwdpfdxjscze", "ylkbcrzetr", "ylkkeazmypt", "ylm",	/* 18804 */
+	"ylmiyarhqfgfcy", "ylmpqhcpx", "ylnapcxuml", "ylnbvgra",	/* 18808 */
+	"ylnkwmng", "ylovgfgcajf", "ylpcln", "ylphnhopxmxa",	/* 18812 */
+	"ylpw", "yltjrfuaprfl", "yltobll", "yludmuvyj",	/* 18816 */
+	"yluzwsk", "ylxp", "ylxpzvkjzgkb", "ylybhlmskjdg",	/* 18820 */
+	"ylzjqajxfdkkc", "ym", "ymacln", "ymat",	/* 18824 */
+	"ymcasllmdetyf", "ymchoel", "ymdgksgjy", "ymgdaezhtmmt",	/* 18828 */
+	"ymghnqlvsmmu", "ymgkvtxghbk", "ymgqvmrf", "ymgsqf",	/* 18832 */
+	"ymhxbcim", "ymjhpqx", "ymju", "ymk",	/* 18836 */
+	"ymkkwquavz", "ymkudxia", "ymlcoeci", "ymmrcuiifh",	/* 18840 */
+	"ymnddg", "ymohrqfqhhezfu", "ymp", "ymqyrtykvf",	/* 18844 */
+	"ymrjsz", "ymrmljjop", "ymtpqefuxsl", "ymttgeyokqi",	/* 18848 */
+	"ymtuktt", "ymugyno", "ymurbbsff", "ymxrv",	/* 18852 */
+	"ymxwf", "ymycrxnjajdgpd", "ymyoagazy", "ymywpvsbyg",	/* 18856 */
+	"ymzmdorta", "yn", "ynavyibv", "ynbkm",	/* 18860 */
+	"ynbrolcwtisnae", "ynemoqna", "ynhfhitcsy", "ynhmfdhjj",	/* 18864 */
+	"ynhshhqzgtx", "yni", "yniipisy", "ynjwleev",	/* 18868 */
+	"ynkgvkjriqxxf", "ynkgxyuyqrb", "ynkxlykbusfvkv", "ynlwgiuxatlbif",	/* 18872 */
+	"ynmhdpoubrpp", "ynmo", "ynnpzgzrxumfh", "ynns",	/* 18876 */
+	"ynofakn", "ynpwknzuy", "ynqzx", "ynsfqcobglkdeh",	/* 18880 */
+	"ynumvuasw", "ynuwcfzwzahf", "ynuwgpqqhlz", "ynvhzxpvryx",	/* 18884 */
+	"ynxx", "yny", "ynyfsgaa", "ynympwiuiowfmw",	/* 18888 */
+	"ynzbimiyduohd", "yo", "yoaishrrsybmc", "yoashhywny",	/* 18892 */
+	"yobp", "yocdwurdfw", "yocoljr", "yoeab",	/* 18896 */
+	"yofpudcpd", "yofyvipx", "yohwd", "yoitbbz",	/* 18900 */
+	"yoiv", "yojnbi", "yojwwij", "yokwgfcwpcvpv",	/* 18904 */
+	"yolclltgb", "yolzktodoegwmd", "yonlfjc", "yonuyoy",	/* 18908 */
+	"yoo", "yoovl", "yoqsqmlm", "yortvdbz",	/* 18912 */
+	"yoselgeap", "youbdq", "yovtpsa", "yow",	/* 18916 */
+	"yoxvp", "yozpx", "yozvpvvdspsc", "yp",	/* 18920 */
+	"ypatcpqmaql", "ypay", "ypdwjh", "ypdxfvdyi",	/* 18924 */
+	"ypgdgnn", "yphbhsmx", "yphxxurulxpwhr", "ypkrknppweqt",	/* 18928 */
+	"ypl", "ypmuihkxfyf", "ypmuoxwjqfrqj", "ypnsdsf",	/* 18932 */
+	"ypnxvfutb", "ypogwmuyxis", "yppyra", "ypqal",	/* 18936 */
+	"yprgkany", "ypsyakx", "ypudlkvrglbl", "ypvurhpxgxzzl",	/* 18940 */
+	"ypxe", "ypxhvvu", "ypyklnnteetf", "ypysize",	/* 18944 */
+	"ypyyzvayrh", "yq", "yqakb", "yqczfrfef",	/* 18948 */
+	"yqdrg", "yqfkwtd", "yqfnv", "yqgfdsiofn",	/* 18952 */
+	"yqgkyzmjdqyx", "yqgxjmetwa", "yqhlruemg", "yqin",	/* 18956 */
+	"yqkjjvorhri", "yqkt", "yqlhq", "yqljeq",	/* 18960 */
+	"yqodsjk", "yqozzr", "yqphyyfwcsh", "yqptghfolouy",	/* 18964 */
+	"yqqrrokmd", "yqru", "yqrwnxiwpr", "yqsbigxl",	/* 18968 */
+	"yqv", "yqvxwjtaszi", "yqwecuiet", "yqwtduqhnxdthn",	/* 18972 */
+	"yqyapd", "yqycgladgqcrwh", "yqzkwqptktuw", "yr",	/* 18976 */
+	"yrb", "yrchiprmvwh", "yrezviwhdsy", "yrgaapowenf",	/* 18980 */
+	"yrgi", "yrgjghcd", "yrgssgq", "yrirqsktthccpq",	/* 18984 */
+	"yrjdvtxgk", "yrknaue", "yrljf", "yrmxwohfqdbjog",	/* 18988 */
+	"yrnpxnbhjse", "yroibn", "yroump", "yrsoou",	/* 18992 */
+	"yrvnuabwkekj", "yrvvafijl", "yrwpsrjnyi", "yrwttk",	/* 18996 */
+	"yrx", "yrxr", "ys", "ysacjlb",	/* 19000 */
+	"ysas", "ysavamzuuc", "ysbtfelfknp", "yscabqzphqqjj",	/* 19004 */
+	"ysdqxtkygjije", "ysf", "ysfikcgpqms", "ysgwgkgjpgsi",	/* 19008 */
+	"ysiqsqveag", "ysjc", "yskjwb", "yskrgstnyayt",	/* 19012 */
+	"yslzlqdk", "ysm", "ysmglpjcve", "ysnkjkzlhoulml",	/* 19016 */
+	"ysp", "ysqpvoggpve", "ysrnvrccpnrfxs", "yssevsixfqo",	/* 19020 */
+	"ysswq", "ystowfnfgj", "ysvcrt", "ysvr",	/* 19024 */
+	"yswixdayryq", "yswpog", "yswxdnzpekg", "ysx",	/* 19028 */
+	"ysxhhseq", "yt", "ytaakhicsvmdks", "ytbnbqdfict",	/* 19032 */
+	"ytboxyodovwj", "ytf", "ytfufxqpw", "ytgkpxjaxedrne",	/* 19036 */
+	"ytgpyanuwtpht", "ythssygbs", "ythtxr", "ythw",	/* 19040 */
+	"yti", "ytjbbkzinidop", "ytjsdzjowts", "ytjyfrxsdp",	/* 19044 */
+	"ytkesfnvjw", "ytkpndbwp", "ytlbzthjwibu", "ytnvsmb",	/* 19048 */
+	"ytqb", "ytrcu", "ytrlqofkj", "ytrurfh",	/* 19052 */
+	"ytueyfmqmqhekl", "ytvkwhptrn", "ytvv", "ytwggcvf",	/* 19056 */
+	"ytxjzeywywgwu", "ytzgyhzh", "ytznmbvbnyzxsy", "ytzyfbxy",	/* 19060 */
+	"yuahbtefzd", "yuculnwroyvvru", "yuczoux", "yuhjacepd",	/* 19064 */
+	"yujidwd", "yukontktdegqls", "yumt", "yup",	/* 19068 */
+	"yuqmrqxl", "yurefwslic", "yusyvuxvox", "yuszicnyrzazsi",	/* 19072 */
+	"yuuglsfs", "yuuvssejjep", "yuv", "yuxpabp",	/* 19076 */
+	"yuyrpwtj", "yuywsnnmj", "yuzoxgokgt", "yvaczmrz",	/* 19080 */
+	"yvbsejvvbdqyk", "yvbuy", "yvdbqjnkjnrdar", "yvdtty",	/* 19084 */
+	"yvdvslx", "yvefgrxuev", "yvehszxxz", "yvejb",	/* 19088 */
+	"yvf", "yvfdbehiybuaa", "yvgthl", "yvhvjsmcmy",	/* 19092 */
+	"yvjp", "yvlxzqnzzpmqb", "yvnfhzsyn", "yvnnr",	/* 19096 */
+	"yvo", "yvoddyjrtihf", "yvpagmeocjala", "yvpf",	/* 19100 */
+	"yvrrgep", "yvrthl", "yvscmkhhjyxz", "yvsfazpjyfxs",	/* 19104 */
+	"yvsgkkixbaqch", "yvtsqvd", "yvukfawmcks", "yvuqrh",	/* 19108 */
+	"yvuvuks", "yvvcddywk", "yvvvsp", "yvwnmugmsuede",	/* 19112 */
+	"yvwnvrtm", "yvwvxgl", "yvxclcbpm", "yvxlcovqdyfqm",	/* 19116 */
+	"yvytmwupioza", "yvzesxzulygyuj", "yw", "ywbdn",	/* 19120 */
+	"ywc", "ywcioncd", "ywcnslfftdlfvp", "ywdrou",	/* 19124 */
+	"ywewfu", "ywfdlzpiahiqn", "ywfmt", "ywgxovbglzj",	/* 19128 */
+	"ywhmkboffz", "ywjrnihdhay", "ywksz", "ywkyy",	/* 19132 */
+	"ywljcstfr", "ywlrbhkmupj", "ywmgwvguqdh", "ywnjcytjlp",	/* 19136 */
+	"ywolrkwganxciv", "ywqhe", "ywqo", "ywqpsgxjgz",	/* 19140 */
+	"ywtuovt", "ywvs", "ywvwzp", "ywwjbhqvoxlb",	/* 19144 */
+	"ywxf", "ywxocopkv", "ywzbmmyag", "yx",	/* 19148 */
+	"yxafpc", "yxbce", "yxbjkjqbkxv", "yxbodbcryrhp",	/* 19152 */
+	"yxd", "yxdefk", "yxdnucdruink", "yxej",	/* 19156 */
+	"yxgyvjm", "yxhjucqcti", "yxhqirca", "yxipdp",	/* 19160 */
+	"yxkbeonwr", "yxmnghtc", "yxmyc", "yxncth",	/* 19164 */
+	"yxohsvrl", "yxoniarqzecpr", "yxoquer", "yxpr",	/* 19168 */
+	"yxpvqlnsfnilrh", "yxqblvthbn", "yxqpt", "yxqptfcwmjrd",	/* 19172 */
+	"yxrn", "yxsshyf", "yxupskcwfogg", "yxuuuifdmp",	/* 19176 */
+	"yxvayqjeouoi", "yxwam", "yxwl", "yxx",	/* 19180 */
+	"yxxcopr", "yxycugybfyyw", "yxzswy", "yy",	/* 19184 */
+	"yya", "yyazea", "yybgys", "yyccpowyvnfluq",	/* 19188 */
+	"yycoszqnay", "yyfcaxapv", "yyg", "yygcdquzprk",	/* 19192 */
+	"yyhchnzelzgcnl", "yyis", "yyjkqnsbcuee", "yyldr",	/* 19196 */
+	"yyll", "yymvmlnvgpaiuv", "yynazejnkgohpk", "yynnsm",	/* 19200 */
+	"yynrcqpmb", "yysqibxwqnh", "yyt", "yythrfnqmp",	/* 19204 */
+	"yyx", "yyxjmw", "yyyukcsvmemysl", "yz",	/* 19208 */
+	"yzajk", "yzaoryoxhecphm", "yzbhfpkixaxseb", "yzbjhuyzfjhqur",	/* 19212 */
+	"yzbkimrhq", "yzblbzxyi", "yzbsrgxfkefwm", "yzdecairfhefsq",	/* 19216 */
+	"yzdgaf", "yzeixxy", "yzekcajy", "yzfpqeyve",	/* 19220 */
+	"yzfyvdgs", "yzh", "yzhfz", "yzjd",	/* 19224 */
+	"yzjhlrigejn", "yzjqj", "yzju", "yzkfjihonrfoh",	/* 19228 */
+	"yzlppe", "yznho", "yznilcleddh", "yzomsgde",	/* 19232 */
+	"yzp", "yzrwnz", "yzrzasjmzhmhn", "yzsdadnrcqdhvf",	/* 19236 */
+	"yzstcyhncvrma", "yzsycknnirsyl", "yztxsnwymn", "yztzvmwoormv",	/* 19240 */
+	"yzufeti", "yzv", "yzvhzgdars", "yzwv",	/* 19244 */
+	"yzxrtwpsolvoqp", "yzxuq", "yzzioqd", "yzzomgancvwn",	/* 19248 */
+	"za", "zabwdmizc", "zad", "zadwjrc",	/* 19252 */
+	"zaeaa", "zaeufekzxmjkl", "zagapms", "zaglyrantfi",	/* 19256 */
+	"zagskwnnrscq", "zahbf", "zahp", "zaimrkjld",	/* 19260 */
+	"zaiuujtxsqh", "zak", "zakjmff", "zalgid",	/* 19264 */
+	"zalibneothy", "zamcy", "zamyrcnkbycomr", "zanjzhzucoq",	/* 19268 */
+	"zanqd", "zao", "zaocpjtbm", "zaowemnnosua",	/* 19272 */
+	"zapliizsszp", "zapzewzt", "zaqgtzcuzbsv", "zarvgqwrkzr",	/* 19276 */
+	"zatgkxtu", "zatkiqvghnehdm", "zauvud", "zavgudrjes",	/* 19280 */
+	"zavotyjyv", "zaxypq", "zaxyqsjnif", "zaz",	/* 19284 */
+	"zazd", "zaztoyaikk", "zb", "zbalpnwzfzvawj",	/* 19288 */
+	"zbamjv", "zbb", "zbclpngpkf", "zbcufpxtiafv",	/* 19292 */
+	"zbe", "zbelacuo", "zbesxb", "zbfpftl",	/* 19296 */
+	"zbg", "zbgn", "zbixjz", "zbjclrsdql",	/* 19300 */
+	"zblco", "zbneqgayghuilz", "zbor", "zbovmwxp",	/* 19304 */
+	"zbozkte", "zbpslkspfsteki", "zbqokyyarvpzx", "zbrajlvsiqj",	/* 19308 */
+	"zbrqkhvspohdi", "zbsouordibkz", "zbsqaa", "zbtdmc",	/* 19312 */
+	"zbtqhhbyjgufu", "zbvviiem", "zbxfdpuhzjhhhh", "zbxyum",	/* 19316 */
+	"zbyqg", "zbysyhzpc", "zbytkorqymefzz", "zbzionufraw",	/* 19320 */
+	"zc", "zcc", "zccezowufszst", "zccgt",	/* 19324 */
+	"zcd", "zcdcfjhbjtegzg", "zcdtjdwoznowfj", "zcehgkqgctlbvo",	/* 19328 */
+	"zcfnswb", "zcg", "zchddgjlkpzlj", "zcizmutzt",	/* 19332 */
+	"zcjxtohxpcqi", "zck", "zcnstmsaaksmxb", "zcobq",	/* 19336 */
+	"zcohqqrmhdf", "zcomf", "zcqjbgwgonyr", "zcqqrdiu",	/* 19340 */
+	"zcr", "zcrhhvi", "zcriwp", "zctd",	/* 19344 */
+	"zcyotqn", "zczlwsccejfynz", "zdahwvf", "zdazzizbjlz",	/* 19348 */
+	"zdbhowvki", "zdbulthyro", "zdbvnecx", "zdefjgfvoc",	/* 19352 */
+	"zdgl", "zdhfrqox", "zdijqk", "zdjpnt",	/* 19356 */
+	"zdjuemyurij", "zdjugxaslny", "zdldnqlagvqyn", "zdlt",	/* 19360 */
+	"zdoecehavhintd", "zdoh", "zdpsozbevn", "zdqnja",	/* 19364 */
+	"zdsoq", "zdszwgronxys", "zdtrlk", "zdu",	/* 19368 */
+	"zducctlhpv", "zdwrixbfdkue", "zdxgkfxkhnbsp", "zdxsza",	/* 19372 */
+	"zdxtmqdhdpczj", "zdyh", "zdyhgxyokc", "zdynukfoqz",	/* 19376 */
+	"zdzohrrk", "ze", "zeahprg", "zebhaxp",	/* 19380 */
+	"zebjsmhwfgxm", "zebvpbdp", "zebz", "zeckzifsioy",	/* 19384 */
+	"zecmzrmhmvu", "zee", "zeeqand", "zeevdp",	/* 19388 */
+	"zef", "zefol", "zeft", "zefwnzuhniu",	/* 19392 */
+	"zegnhz", "zegtq", "zegyyiu", "zeiqwottnk",	/* 19396 */
+	"zeitjr", "zeixmyirv", "zej", "zejvfqwczuhjw",	/* 19400 */
+	"zek", "zekqggcbq", "zekqszvbspxysm", "zekrqzjhlw",	/* 19404 */
+	"zelkoh", "zelsmuteeipmi", "zelucbnmnuwsty", "zemoy",	/* 19408 */
+	"zemuiybbq", "zeogemouvbl", "zepnwhjrsrkzi", "zeqszfuwtn",	/* 19412 */
+	"zer", "zerchiuqs", "zesshdcxcoag", "zeswm",	/* 19416 */
+	"zesxazq", "zetkyhteoq", "zeu", "zewiecnpe",	/* 19420 */
+	"zewimheyedpv", "zex", "zexivbharjcctj", "zeyemldodx",	/* 19424 */
+	"zezibpfycri", "zf", "zfahmihunuvgbz", "zfary",	/* 19428 */
+	"zfffweclggnvwc", "zffql", "zfjrg", "zfjtrs",	/* 19432 */
+	"zfmbtxfpd", "zfmowwejhglcd", "zfnbnqdsx", "zfommotogh",	/* 19436 */
+	"zfoscibdauyl", "zfphdgjrvqkps", "zfqa", "zfreeouf",	/* 19440 */
+	"zftogelot", "zfv", "zfvjhafo", "zfwyzwd",	/* 19444 */
+	"zfxzzbohboqinx", "zfyibkmlbubva", "zfzmsrgtmy", "zg",	/* 19448 */
+	"zgbn", "zgcdhkmiazeip", "zgdpamnt", "zgfialojjulep",	/* 19452 */
+	"zggjmyo", "zggzrnbvad", "zgilaocfxov", "zgipnjgnnlhbwt",	/* 19456 */
+	"zgj", "zgjkx", "zgjstvnvtifmk", "zgknocibaje",	/* 19460 */
+	"zglpoqbmrpn", "zgnlwd", "zgntttxhxe", "zgnzlkylj",	/* 19464 */
+	"zgoqcfmvtyyp", "zgpdzcgwq", "zgpileis", "zgqohkktii",	/* 19468 */
+	"zgr", "zgrjbivoa", "zgsiy", "zgtiaposs",	/* 19472 */
+	"zgtmhboaqqa", "zgtocrsywv", "zgvnpth", "zgx",	/* 19476 */
+	"zh", "zhbvexexrrfk", "zhbwa", "zhbwsc",	/* 19480 */
+	"zhcbonfvig", "zhdalktmhbqdpz", "zhe", "zhfczxxn",	/* 19484 */
+	"zhfoegpbocnsco", "zhhbhpuzvddgcl", "zhhk", "zhhmxsc",	/* 19488 */
+	"zhicsx", "zhiswkjpjylhs", "zhk", "zhme",	/* 19492 */
+	"zhnujq", "zhqxslmaqa", "zhttsi", "zhudcemuhxhs",	/* 19496 */
+	"zhuq", "zhurhvxkkegaf", "zhvdlk", "zhvfd",	/* 19500 */
+	"zhwgieaqicmn", "zhxbxu", "zhyb", "zhzftli",	/* 19504 */
+	"zhzn", "zhzsmdbo", "zi", "ziacxti",	/* 19508 */
+	"ziaifgrhdai", "ziazri", "zibjunjgwt", "ziej",	/* 19512 */
+	"zige", "ziirxhc", "zikc", "zikiq",	/* 19516 */
+	"zikk", "ziollopgm", "zipqwkdrcbh", "ziptez",	/* 19520 */
+	"zipushmdo", "ziqloa", "ziranrweatm", "zirggxfrg",	/* 19524 */
+	"zisfjrycvf", "zitfmmpzrhhnt", "ziu", "ziudkhzjizqe",	/* 19528 */
+	"ziumdwxh", "zivvqut", "zivxmaft", "zixxbmb",	/* 19532 */
+	"zj", "zjacvjnql", "zjb", "zjc",	/* 19536 */
+	"zjckvzo", "zjefcecufzx", "zjehrgjlwu", "zjfvdmnpygszl",	/* 19540 */
+	"zjhkm", "zjisiqrphtkr", "zjki", "zjldfmewzgebbw",	/* 19544 */
+	"zjlmjbq", "zjlsdvagljhgcl", "zjmdnrd", "zjpuc",	/* 19548 */
+	"zjqubunvwzbalt", "zjrscpsoqomlq", "zjspcei", "zjstkbwklz",	/* 19552 */
+	"zjsvlebtmz", "zjtoxpu", "zjulkpjuijj", "zjvkxyeyw",	/* 19556 */
+	"zjvmn", "zjwtnotxod", "zjzkihd", "zk",	/* 19560 */
+	"zkepnw", "zkfmwoqonjeu", "zkgcpxppy", "zkgfgbqkmczxuf",	/* 19564 */
+	"zkhbugkarfr", "zkjcrk", "zkjobhp", "zkkhhc",	/* 19568 */
+	"zkkswczztleiki", "zklcjofamd", "zklyk", "zkoqyaezw",	/* 19572 */
+	"zkpdqm", "zkswxmnewct", "zktnkjogwhzqz", "zkvwhtvlwywz",	/* 19576 */
+	"zkwdyhlfsqonq", "zkxfu", "zl", "zlautvslmkienm",	/* 19580 */
+	"zlbcpskq", "zlccew", "zleagqk", "zlfxobwpezyrp",	/* 19584 */
+	"zlhbrtdicu", "zlkap", "zlkfnvzrhg", "zlkveussee",	/* 19588 */
+	"zlliawk", "zlm", "zlnmmrhvnwdg", "zlowhe",	/* 19592 */
+	"zlpildpricxz", "zlspntic", "zlv", "zlxli",	/* 19596 */
+	"zlxm", "zlxoecjp", "zlxw", "zlxxueqoexe",	/* 19600 */
+	"zlyaxaafmhe", "zm", "zmakizooynon", "zmaq",	/* 19604 */
+	"zmatgofqufet", "zmatxqiuge", "zmbr", "zmcm",	/* 19608 */
+	"zmd", "zmdiqvf", "zmdmq", "zmdwzz",	/* 19612 */
+	"zme", "zmevzwb", "zmgtohnmsem", "zml",	/* 19616 */
+	"zmltbbtekpb", "zmodtafspc", "zmp", "zmpg",	/* 19620 */
+	"zmtahunjq", "zmttdcrrbm", "zmwaqicvohk", "zmwuicjvqplhni",	/* 19624 */
+	"zmxqcfnyjgfd", "zmyeoj", "zmymgc", "zmymkc",	/* 19628 */
+	"zn", "znafuerrdj", "znarrt", "znclaixpklwkf",	/* 19632 */
+	"zncvgbbvh", "znegu", "znfbjieg", "znfkzicrgvvdpa",	/* 19636 */
+	"zngnt", "znidsguk", "znirjkylnollkm", "znkhcgbsvl",	/* 19640 */
+	"znl", "znlcqqavig", "znlukvlquea", "znnkt",	/* 19644 */
+	"znrsty", "znsoiexa", "zntpxsiotankdx", "znvi",	/* 19648 */
+	"znvqvbyjcmsfx", "znvsmdn", "znvy", "znwkcroxyquvhx",	/* 19652 */
+	"znxzkzicleq", "znyfvctb", "znyhcjnql", "znyiyvyy",	/* 19656 */
+	"znynkg", "zo", "zoacyognq", "zobchm",	/* 19660 */
+	"zobiudozqad", "zoenqyp", "zoepzboq", "zogmbjiakufyjy",	/* 19664 */
+	"zohuinhr", "zohvobdunezxm", "zoivjgeemzeluu", "zojdiymx",	/* 19668 */
+	"zojphadjajzn", "zomygmsaadikz", "zonarvgpqytae", "zongxik",	/* 19672 */
+	"zoomlglcitlrg", "zooprrwzkic", "zooz", "zop",	/* 19676 */
+	"zopenxvnqqiwkn", "zopngq", "zoqds", "zoqwrzrn",	/* 19680 */
+	"zotybkygbbpy", "zoujkhknj", "zovczisqdly", "zovnffcsmwemap",	/* 19684 */
+	"zovpwswic", "zowtxbvj", "zoybjwwusijw", "zoylphihuezkr",	/* 19688 */
+	"zoz", "zpacq", "zpaizqhq", "zpbnq",	/* 19692 */
+	"zpc", "zpdesmitgzrz", "zpdkxic", "zpejxnemszj",	/* 19696 */
+	"zpelkgfck", "zpewvw", "zpggoi", "zpitbaaivye",	/* 19700 */
+	"zpketxbzj", "zppif", "zpqglahsvxfpf", "zpsxhph",	/* 19704 */
+	"zpupybhtjfq", "zpvclzo", "zpxltlyubnmr", "zpy",	/* 19708 */
+	"zpzrzeym", "zpzzptv", "zq", "zqaipf",	/* 19712 */
+	"zqb", "zqbalmdglfb", "zqcegcn", "zqclcezv",	/* 19716 */
+	"zqebkmlvqk", "zqektmgzbugks", "zqhblpip", "zqhygjdysay",	/* 19720 */
+	"zqistdyjwrf", "zqj", "zqlhiqjzlo", "zqlwyrnppln",	/* 19724 */
+	"zqm", "zqmnkjjuyduz", "zqmnpp", "zqnmgjcbo",	/* 19728 */
+	"zqnuuo", "zqo", "zqp", "zqqme",	/* 19732 */
+	"zqrfc", "zqs", "zqu", "zqukbcyeifwfk",	/* 19736 */
+	"zqvamhrwcluf", "zqvsdbmjlzun", "zqxkoukaq", "zqyaolyt",	/* 19740 */
+	"zqyfpsxy", "zqyqjum", "zr", "zraiqsg",	/* 19744 */
+	"zraqnyawxuk", "zraqxgrgumb", "zrch", "zrdhdtwa",	/* 19748 */
+	"zred", "zrfhturwquwuyj", "zrh", "zrihooo",	/* 19752 */
+	"zrlp", "zrmbgnngaqghgx", "zrmtliakdq", "zrorcisoluxu",	/* 19756 */
+	"zrow", "zrsyhkpctckbuz", "zrwwxpnxezx", "zrxzyil",	/* 19760 */
+	"zryvszgn", "zryyzg", "zrz", "zs",	/* 19764 */
+	"zsaahgdklr", "zsb", "zsbvqnvxbphdka", "zscfxqvsgh",	/* 19768 */
+	"zsevvgee", "zsfiufrdtgybzp", "zsk", "zskitcz",	/* 19772 */
+	"zslwmerkn", "zsmm", "zsn", "zsnldtlwy",	/* 19776 */
+	"zspudbrhxqnzh", "zsqicw", "zsqsvakbxhpg", "zssmkhuwgryjer",	/* 19780 */
+	"zstxzux", "zsug", "zsugdlsoe", "zsujplhu",	/* 19784 */
+	"zsuoo", "zsvwzbktje", "zswfjhweeaqs", "zswzzwfbp",	/* 19788 */
+	"zsy", "zsymvpaws", "zt", "ztapuuob",	/* 19792 */
+	"ztavdtgpiut", "ztexoxcbtctv", "zthcrqvgtkt", "zthhjyrnpa",	/* 19796 */
+	"zthhrygpy", "ztjdhzuvvsnvc", "ztjl", "ztkabdlgww",	/* 19800 */
+	"ztm", "ztokrovuphwrba", "ztrgulgqijqxal", "ztrqbyhnlok",	/* 19804 */
+	"ztrrauzv", "ztryimvmlrd", "ztswjqr", "ztvhnovvt",	/* 19808 */
+	"ztvke", "ztvpuc", "ztvwlsiqnnr", "ztwkdwkxteq",	/* 19812 */
+	"ztwmcq", "ztwraljqoe", "ztybll", "ztyrabki",	/* 19816 */
+	"zu", "zuamtl", "zuaoepqc", "zuasgenk",	/* 19820 */
+	"zucc", "zuegwqporp", "zufdwg", "zufqln",	/* 19824 */
+	"zugxyyuqlj", "zuh", "zuixbwzobnxrg", "zuj",	/* 19828 */
+	"zukbkw", "zukojnzevat", "zukp", "zulecxttcru",	/* 19832 */
+	"zumdkavf", "zuosekzkz", "zuovparpca", "zuqainrupcscuc",	/* 19836 */
+	"zuqcu", "zuqqusyw", "zurpf", "zuruuknpbkl",	/* 19840 */
+	"zuslmamayeaq", "zuts", "zuu", "zuvfw",	/* 19844 */
+	"zuwewtvgj", "zuwxzhrw", "zuybljdo", "zv",	/* 19848 */
+	"zvcfxucmd", "zvcqe", "zvcrfrz", "zvdgtkf",	/* 19852 */
+	"zvdwonxk", "zvg", "zvgdegkrfunm", "zvhtdvslqsoq",	/* 19856 */
+	"zvhwgxolk", "zvijxbon", "zvjo", "zvlctorpxs",	/* 19860 */
+	"zvlgovrabdbs", "zvmw", "zvnazcblpdblrr", "zvnmmitmirswuo",	/* 19864 */
+	"zvovnaw", "zvpfdwog", "zvpi", "zvpjtoyz",	/* 19868 */
+	"zvqo", "zvrg", "zvrv", "zvrxwgfjnrf",	/* 19872 */
+	"zvsoislr", "zvssy", "zvtiarxatzegu", "zvtlfay",	/* 19876 */
+	"zvwzyxn", "zvxczprg", "zw", "zwahzegijy",	/* 19880 */
+	"zwblxbwebuntq", "zwbwwtub", "zwc", "zwcvdisng",	/* 19884 */
+	"zwdf", "zwdrulc", "zwezdcxm", "zwjrujyy",	/* 19888 */
+	"zwjsjnf", "zwksv", "zwlgk", "zwmduvldnlixd",	/* 19892 */
+	"zwno", "zwobvrjlav", "zwqdnluutph", "zwqihvrjkdmolx",	/* 19896 */
+	"zwr", "zwwddlvr", "zwxdnsiqxmfg", "zwxf",	/* 19900 */
+	"zwys", "zxalwrnbxnhsb", "zxbgdbrejx", "zxblz",	/* 19904 */
+	"zxcfrdfwr", "zxdfditkwpuulo", "zxdfkghohfqi", "zxdhpucjotro",	/* 19908 */
+	"zxghciuys", "zxgmwimg", "zxgtujonrrxbbl", "zxhpnohqdvege",	/* 19912 */
+	"zxjd", "zxjgpyjdfuyz", "zxjivtbd", "zxjnodurnznai",	/* 19916 */
+	"zxkroyohtuqonr", "zxkushamnb", "zxkzhilmwkbogy", "zxl",	/* 19920 */
+	"zxlw", "zxlz", "zxmsgnbbhhe", "zxoaaxglm",	/* 19924 */
+	"zxpwqggajb", "zxqgcqmrjlcwgs", "zxsqbroy", "zxubcffx",	/* 19928 */
+	"zxuuxkx", "zxv", "zxwbtr", "zxxglj",	/* 19932 */
+	"zxxtevjkujtlc", "zybcrhlviv", "zyd", "zydcp",	/* 19936 */
+	"zydte", "zyfgdxkvz", "zyhoyprcfyalb", "zyhury",	/* 19940 */
+	"zykhced", "zykphfqenklqw", "zym", "zymnnfscrczdh",	/* 19944 */
+	"zympp", "zymtnznoze", "zyn", "zynjxo",	/* 19948 */
+	"zyqclpffoiu", "zyqfkzw", "zyqgjfhvo", "zyrtccdsr",	/* 19952 */
+	"zysgpqvshhad", "zysxngovemd", "zyuvuozuov", "zywfpgso",	/* 19956 */
+	"zywku", "zywyogubeyzqlp", "zyxagu", "zyyl",	/* 19960 */
+	"zyzudgp", "zyzwxncsv", "zz", "zzadua",	/* 19964 */
+	"zzaeipxncq", "zzajnvxvpkrw", "zzciydg", "zzdpstxdanhr",	/* 19968 */
+	"zzeitbzrtnaz", "zzflfciaekvy", "zzfxvqdarep", "zzgkdxu",	/* 19972 */
+	"zzgwfoua", "zzhjtmia", "zzhtstvdx", "zzigxjgwapj",	/* 19976 */
+	"zzkeyr", "zzlbsyjihlh", "zzleprmenwp", "zzngcksbqbpvi",	/* 19980 */
+	"zzopthfz", "zzpncucfqff", "zzrqozu", "zzrvjmwzp",	/* 19984 */
+	"zzs", "zztsdt", "zzul", "zzuxbbtuamm",	/* 19988 */
+	"zzv", "zzvvt", "zzvwzzpitc", "zzvynaqeslspt",	/* 19992 */
+	"zzwbtdkufjgmw", "zzwrh", "zzwsafjjanz", "zzwtvgpycwdza",	/* 19996 */
+	"zzxbsseixo", "zzzlrq", "zzzuvnw", "zzzxfgzy",	/* 20000 */
+	};
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	uint16_t result;
+	static const uint16_t g[40001] = {
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0e98, 0x128c, 0x37fa, 0x06aa,
+	    0x1c54, 0x0000, 0x0000, 0x283b, 0x297f, 0x0f71, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0954, 0x0000, 0x0000, 0x171a, 0x4319,
+	    0x3197, 0x0000, 0x4787, 0x33f8, 0x0467, 0x2a44, 0x396d, 0x0000,
+	    0x2f6d, 0x197f, 0x4801, 0x1850, 0x239e, 0x05ae, 0x0000, 0x2a84,
+	    0x3b38, 0x231c, 0x287e, 0x0000, 0x24e7, 0x20b8, 0x0000, 0x15ac,
+	    0x3698, 0x0000, 0x37e0, 0x4bf7, 0x1102, 0x0000, 0x29f1, 0x22ee,
+	    0x1811, 0x2514, 0x3331, 0x2386, 0x0000, 0x35fa, 0x0000, 0x2fcc,
+	    0x0000, 0x2259, 0x2ebc, 0x0ee6, 0x0000, 0x0000, 0x1793, 0x0000,
+	    0x0000, 0x3625, 0x13fb, 0x1e73, 0x0000, 0x164d, 0x20f0, 0x0000,
+	    0x0000, 0x0000, 0x2178, 0x073d, 0x4ccd, 0x0000, 0x0000, 0x05da,
+	    0x2839, 0x31d9, 0x39e0, 0x14a3, 0x0000, 0x3cf6, 0x16f8, 0x4916,
+	    0x0000, 0x24ea, 0x058e, 0x0000, 0x0000, 0x207d, 0x2239, 0x2b1d,
+	    0x0000, 0x0000, 0x2148, 0x4342, 0x1c7f, 0x052e, 0x35fe, 0x32df,
+	    0x424d, 0x0000, 0x28e3, 0x0000, 0x3a03, 0x4248, 0x0338, 0x0000,
+	    0x0000, 0x0000, 0x3dc9, 0x28c0, 0x08ab, 0x0000, 0x0000, 0x1737,
+	    0x0000, 0x0000, 0x0000, 0x3bbf, 0x389e, 0x32bd, 0x16e6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4af4, 0x2c20, 0x0000, 0x3dc3, 0x0000,
+	    0x08a4, 0x1f83, 0x0000, 0x0000, 0x3bbb, 0x3dcb, 0x0000, 0x0459,
+	    0x0a49, 0x0000, 0x0000, 0x0000, 0x335d, 0x0000, 0x08e0, 0x0000,
+	    0x0000, 0x2906, 0x0b22, 0x1cd3, 0x0000, 0x0eaa, 0x0000, 0x3961,
+	    0x1c4a, 0x0000, 0x0000, 0x4917, 0x495e, 0x0000, 0x47a6, 0x3c81,
+	    0x1c37, 0x230e, 0x0000, 0x426c, 0x0000, 0x0000, 0x1d22, 0x0000,
+	    0x2262, 0x0000, 0x2b8f, 0x1bda, 0x0211, 0x2eda, 0x0320, 0x27a4,
+	    0x0565, 0x0000, 0x0000, 0x0000, 0x0000, 0x24c9, 0x3b38, 0x0bed,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x393a, 0x0000, 0x0000, 0x19c7,
+	    0x1a42, 0x0000, 0x0d56, 0x0000, 0x13d1, 0x448a, 0x0000, 0x4016,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x29ff, 0x30bf, 0x0000, 0x0000,
+	    0x0000, 0x28f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x3196, 0x15dc,
+	    0x17ad, 0x0ef6, 0x277e, 0x147b, 0x2a5e, 0x2db8, 0x0000, 0x0000,
+	    0x4603, 0x415c, 0x1a73, 0x021e, 0x1ddd, 0x0000, 0x0000, 0x3c88,
+	    0x0000, 0x00a2, 0x175e, 0x0000, 0x4824, 0x0000, 0x3028, 0x0ed9,
+	    0x0000, 0x0000, 0x0000, 0x04e4, 0x481a, 0x0000, 0x1bd6, 0x1153,
+	    0x0000, 0x3843, 0x0000, 0x079a, 0x10b2, 0x07da, 0x0000, 0x0000,
+	    0x430f, 0x34e1, 0x28ed, 0x39f8, 0x34e5, 0x0715, 0x0c98, 0x3ef7,
+	    0x261d, 0x0000, 0x0000, 0x25fc, 0x15c0, 0x037c, 0x45f0, 0x0000,
+	    0x0111, 0x0554, 0x3aae, 0x130f, 0x0252, 0x16f6, 0x0dcd, 0x00b2,
+	    0x01e1, 0x0000, 0x0000, 0x1667, 0x40b2, 0x0000, 0x0793, 0x2abf,
+	    0x0c71, 0x0f36, 0x0113, 0x0000, 0x0000, 0x25e7, 0x3d1b, 0x1e01,
+	    0x3f13, 0x0000, 0x18aa, 0x0000, 0x0000, 0x1c50, 0x0111, 0x0000,
+	    0x2b7b, 0x3508, 0x0000, 0x2760, 0x0000, 0x0000, 0x2ee6, 0x2f95,
+	    0x0000, 0x0000, 0x0000, 0x3310, 0x32a6, 0x0000, 0x0000, 0x2203,
+	    0x24ea, 0x0000, 0x4c7e, 0x078d, 0x0897, 0x23aa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2786, 0x1b96, 0x0000, 0x10ef, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x39b2, 0x438a, 0x0000, 0x1c9a, 0x40e0,
+	    0x0000, 0x0000, 0x1296, 0x4651, 0x38dd, 0x28f3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1d8b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x073a, 0x2817, 0x3e47, 0x4026, 0x30a6, 0x0000, 0x0000, 0x0e42,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30cb, 0x3f2b, 0x27a1,
+	    0x0000, 0x104e, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e56, 0x0000,
+	    0x3b2d, 0x3c91, 0x4d3b, 0x3f39, 0x1e5c, 0x219b, 0x25c3, 0x0000,
+	    0x0000, 0x0dbc, 0x0000, 0x4479, 0x0000, 0x1f0a, 0x28e3, 0x00fc,
+	    0x0000, 0x0000, 0x2fa2, 0x2a2a, 0x0d16, 0x37be, 0x0000, 0x36a2,
+	    0x3836, 0x2437, 0x3722, 0x02aa, 0x0000, 0x0000, 0x0c88, 0x39aa,
+	    0x21be, 0x484e, 0x47e4, 0x0000, 0x3a78, 0x37ce, 0x38ca, 0x0000,
+	    0x0000, 0x46ab, 0x2d74, 0x1672, 0x0000, 0x0681, 0x0dbc, 0x40ca,
+	    0x3fdf, 0x2110, 0x4c4e, 0x2373, 0x0000, 0x077f, 0x0000, 0x2eb4,
+	    0x26bf, 0x0000, 0x0233, 0x1267, 0x27f4, 0x2651, 0x23ab, 0x0000,
+	    0x3b1c, 0x2e8b, 0x0000, 0x1298, 0x477d, 0x0684, 0x33fc, 0x4697,
+	    0x1fd1, 0x337e, 0x304c, 0x0000, 0x0b69, 0x21f1, 0x0000, 0x2d57,
+	    0x0000, 0x35a0, 0x0000, 0x04a2, 0x0ff6, 0x43e7, 0x0b52, 0x0000,
+	    0x0000, 0x244d, 0x0000, 0x097b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0cc3, 0x0000, 0x14a3, 0x3bd1, 0x2e83, 0x42e8, 0x1209, 0x19a4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x335d, 0x1ecd, 0x0000, 0x0aef,
+	    0x051a, 0x0000, 0x0000, 0x01b7, 0x4b10, 0x34c6, 0x0000, 0x0000,
+	    0x023c, 0x4458, 0x1271, 0x0000, 0x3690, 0x0000, 0x0295, 0x2e78,
+	    0x3bb3, 0x0000, 0x0000, 0x197c, 0x0000, 0x0000, 0x4350, 0x0000,
+	    0x0000, 0x422c, 0x4ccc, 0x4782, 0x0000, 0x0000, 0x49d6, 0x01c7,
+	    0x2edf, 0x292d, 0x14af, 0x154a, 0x4285, 0x0000, 0x0000, 0x0000,
+	    0x1e19, 0x1e52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x285c,
+	    0x19b8, 0x0000, 0x0eee, 0x10e1, 0x11f2, 0x19f2, 0x0000, 0x4c4a,
+	    0x1740, 0x1c92, 0x1bb1, 0x0000, 0x46f6, 0x2dd8, 0x4816, 0x2f63,
+	    0x0000, 0x0918, 0x23cf, 0x0000, 0x0bb2, 0x1a43, 0x4519, 0x2cd6,
+	    0x0000, 0x38d3, 0x0000, 0x0000, 0x2e87, 0x2043, 0x0f3c, 0x0000,
+	    0x2628, 0x2a7f, 0x0000, 0x0000, 0x0000, 0x21ed, 0x0000, 0x140b,
+	    0x0dfe, 0x3dc9, 0x1648, 0x3050, 0x0000, 0x0000, 0x3b6c, 0x107e,
+	    0x0000, 0x429c, 0x0c82, 0x15f8, 0x22ad, 0x0000, 0x45a3, 0x25f8,
+	    0x3652, 0x0424, 0x0305, 0x4b31, 0x24b6, 0x3c1b, 0x2a2d, 0x28e1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x29c4, 0x21ff, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2a5a, 0x455e, 0x0000, 0x46f5, 0x434f,
+	    0x0000, 0x2d01, 0x3a8a, 0x0000, 0x0000, 0x2764, 0x0000, 0x3e46,
+	    0x0000, 0x0000, 0x182a, 0x4909, 0x462c, 0x3643, 0x1c31, 0x3e64,
+	    0x472e, 0x120c, 0x0000, 0x1f51, 0x0000, 0x0000, 0x4a8b, 0x0000,
+	    0x10ea, 0x0000, 0x0dd5, 0x0000, 0x31b2, 0x0000, 0x3630, 0x0481,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3a16, 0x4816, 0x1c6b, 0x0e57, 0x4736, 0x15a4,
+	    0x0000, 0x0000, 0x0000, 0x0d58, 0x0dcd, 0x0000, 0x421b, 0x1e64,
+	    0x0000, 0x0776, 0x40a9, 0x0000, 0x3d7d, 0x3395, 0x1f91, 0x0f9b,
+	    0x4168, 0x475e, 0x063c, 0x0000, 0x18de, 0x20a1, 0x492b, 0x0000,
+	    0x1f59, 0x0000, 0x0000, 0x4a07, 0x3549, 0x4aea, 0x0000, 0x18b1,
+	    0x16b6, 0x0000, 0x0092, 0x0000, 0x0000, 0x1b65, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4b01, 0x0000, 0x31d8, 0x1f59, 0x0000, 0x137b,
+	    0x0000, 0x0eb1, 0x394e, 0x3be8, 0x11ec, 0x0000, 0x0000, 0x0e1b,
+	    0x35ac, 0x0000, 0x0000, 0x0000, 0x0283, 0x353f, 0x4d1a, 0x0d37,
+	    0x2e0a, 0x051e, 0x1e7a, 0x0000, 0x12d6, 0x3c76, 0x0e91, 0x0000,
+	    0x4c71, 0x3150, 0x3c6a, 0x3d72, 0x0000, 0x3c0f, 0x1768, 0x376f,
+	    0x0000, 0x0000, 0x38a1, 0x0d36, 0x0259, 0x0000, 0x0000, 0x1352,
+	    0x2b23, 0x10d1, 0x4965, 0x37c3, 0x0000, 0x3270, 0x1363, 0x0400,
+	    0x1710, 0x0000, 0x0000, 0x3d01, 0x1a67, 0x0000, 0x18ca, 0x1fc5,
+	    0x0000, 0x0000, 0x2131, 0x0000, 0x1990, 0x0d82, 0x0000, 0x4711,
+	    0x0000, 0x4947, 0x0fa0, 0x0000, 0x0000, 0x0016, 0x38ff, 0x25a1,
+	    0x0000, 0x3680, 0x4187, 0x22fc, 0x0df9, 0x39e6, 0x2c0d, 0x2df8,
+	    0x0000, 0x17e2, 0x1b46, 0x0000, 0x0520, 0x4d12, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x060e, 0x4229, 0x0000, 0x0000, 0x0000,
+	    0x4dd3, 0x0000, 0x1248, 0x0000, 0x1be6, 0x1646, 0x2d66, 0x2605,
+	    0x3f88, 0x0000, 0x418f, 0x1f1e, 0x1e77, 0x0000, 0x0000, 0x2e98,
+	    0x0000, 0x0000, 0x3103, 0x0000, 0x4116, 0x0000, 0x0000, 0x4d59,
+	    0x2a22, 0x0000, 0x0000, 0x3445, 0x0000, 0x0000, 0x45a9, 0x3116,
+	    0x3c0d, 0x0000, 0x0000, 0x0000, 0x07fd, 0x3c67, 0x0000, 0x3368,
+	    0x0cd1, 0x2b35, 0x25b3, 0x0000, 0x110c, 0x486d, 0x0000, 0x3d98,
+	    0x0000, 0x0e12, 0x3b4e, 0x0000, 0x0000, 0x2c96, 0x4429, 0x144c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4b77, 0x05b1, 0x453b, 0x0000,
+	    0x11d0, 0x0000, 0x0000, 0x0000, 0x29d1, 0x0541, 0x2b4d, 0x4b42,
+	    0x0000, 0x0000, 0x0b4a, 0x3618, 0x0000, 0x0000, 0x24ff, 0x0000,
+	    0x0000, 0x00d6, 0x0000, 0x1a0b, 0x0000, 0x0faa, 0x0000, 0x21d3,
+	    0x0000, 0x11ea, 0x0000, 0x29c8, 0x0000, 0x1b67, 0x3767, 0x0000,
+	    0x18fd, 0x0313, 0x1cdc, 0x0000, 0x3552, 0x0000, 0x155b, 0x0000,
+	    0x3cde, 0x0000, 0x3ab7, 0x0000, 0x43e9, 0x0000, 0x0000, 0x4714,
+	    0x0000, 0x123c, 0x0000, 0x25f2, 0x3610, 0x0000, 0x0000, 0x3fc0,
+	    0x15be, 0x29f6, 0x3d81, 0x0000, 0x0f8f, 0x0000, 0x316a, 0x1b79,
+	    0x0000, 0x0000, 0x0000, 0x35ec, 0x2ccc, 0x120d, 0x0000, 0x084d,
+	    0x1ba4, 0x4da7, 0x0054, 0x0000, 0x47b5, 0x0000, 0x14f8, 0x47f2,
+	    0x0b7a, 0x0000, 0x0000, 0x242a, 0x1cca, 0x22df, 0x0000, 0x0d66,
+	    0x0000, 0x0000, 0x26a1, 0x0000, 0x1415, 0x3ef2, 0x0000, 0x239b,
+	    0x0000, 0x46f5, 0x41da, 0x2131, 0x0000, 0x24d4, 0x21e1, 0x2be7,
+	    0x1e29, 0x0000, 0x052f, 0x0000, 0x119e, 0x0000, 0x1e9a, 0x18eb,
+	    0x0000, 0x1cda, 0x18dc, 0x0000, 0x0000, 0x3f10, 0x163d, 0x2ae1,
+	    0x0000, 0x38f8, 0x1d5e, 0x0000, 0x0000, 0x1a86, 0x10bf, 0x0239,
+	    0x0000, 0x4712, 0x1a1d, 0x4276, 0x255d, 0x0000, 0x0000, 0x0fae,
+	    0x165f, 0x0000, 0x45f1, 0x36b6, 0x3597, 0x0000, 0x0000, 0x4459,
+	    0x297f, 0x0000, 0x278a, 0x0000, 0x0000, 0x0000, 0x30de, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d6d, 0x4029, 0x0000,
+	    0x0000, 0x26a0, 0x01d2, 0x187e, 0x0000, 0x10df, 0x456a, 0x246a,
+	    0x0000, 0x0000, 0x24fd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3c23, 0x0000, 0x0000, 0x0000, 0x0000, 0x09da, 0x2126,
+	    0x0000, 0x2509, 0x445d, 0x26e9, 0x13bd, 0x0000, 0x19e1, 0x0000,
+	    0x30eb, 0x0000, 0x1bdd, 0x0000, 0x07d8, 0x21b6, 0x0000, 0x0000,
+	    0x42d7, 0x0000, 0x09ed, 0x346c, 0x0e6c, 0x1cb7, 0x0000, 0x167d,
+	    0x0000, 0x0000, 0x0000, 0x38dc, 0x0410, 0x1800, 0x4c0e, 0x3fd5,
+	    0x31e1, 0x0000, 0x0000, 0x49d0, 0x2560, 0x1c9b, 0x0000, 0x27e6,
+	    0x3111, 0x30b1, 0x49ce, 0x0599, 0x0000, 0x0000, 0x0000, 0x1766,
+	    0x0000, 0x0000, 0x0000, 0x3788, 0x25ff, 0x411e, 0x2237, 0x0004,
+	    0x3f10, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x199d,
+	    0x2fee, 0x0000, 0x2caa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4e01, 0x0000, 0x0000, 0x4a73, 0x0000, 0x0740, 0x136f, 0x3a0d,
+	    0x264f, 0x0000, 0x3d02, 0x1ab2, 0x3027, 0x0000, 0x2753, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0828, 0x0000, 0x44f4, 0x3372, 0x0000,
+	    0x0000, 0x0000, 0x0409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ef5,
+	    0x2e2d, 0x0000, 0x4b09, 0x045c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0794, 0x2d41, 0x0000, 0x20ad, 0x3754, 0x0000,
+	    0x2ff0, 0x0000, 0x0000, 0x2978, 0x26e2, 0x485a, 0x0000, 0x1de8,
+	    0x23a4, 0x0000, 0x29a5, 0x4543, 0x0000, 0x419b, 0x253e, 0x448d,
+	    0x40ad, 0x45cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1422,
+	    0x0000, 0x0000, 0x0000, 0x2af1, 0x3f76, 0x286e, 0x086a, 0x0000,
+	    0x2e99, 0x2303, 0x0000, 0x472f, 0x0000, 0x0000, 0x0000, 0x4c76,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4551, 0x06a9, 0x055f, 0x0045,
+	    0x0000, 0x0000, 0x21cb, 0x0545, 0x3a0b, 0x0000, 0x0000, 0x2896,
+	    0x055c, 0x0d72, 0x05da, 0x0000, 0x0748, 0x0000, 0x02e1, 0x0711,
+	    0x4c94, 0x4bb5, 0x1daa, 0x3d6d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0565, 0x2854, 0x262b, 0x1119, 0x3440, 0x1f94, 0x4999, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x44fd, 0x4c9d, 0x0000, 0x1b95, 0x0000,
+	    0x0000, 0x484d, 0x0000, 0x4c5f, 0x3777, 0x2fdb, 0x0000, 0x0000,
+	    0x0000, 0x2654, 0x2169, 0x0000, 0x202d, 0x0cf5, 0x0000, 0x0ad8,
+	    0x0000, 0x41cf, 0x0dc9, 0x1ded, 0x3f14, 0x3e97, 0x34b6, 0x0000,
+	    0x0000, 0x0000, 0x2743, 0x0000, 0x073a, 0x07f3, 0x0000, 0x00f9,
+	    0x0000, 0x0f4c, 0x21f2, 0x3831, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x08e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3d68, 0x0000, 0x0000, 0x0000, 0x12ad,
+	    0x0000, 0x1386, 0x3f89, 0x0000, 0x0000, 0x0000, 0x02e3, 0x0862,
+	    0x0000, 0x2f91, 0x1ecd, 0x0000, 0x0000, 0x4a82, 0x17e9, 0x0736,
+	    0x3900, 0x06b9, 0x4a62, 0x0154, 0x0000, 0x0a24, 0x4918, 0x3bca,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x414c, 0x0a35, 0x0000, 0x3ed7,
+	    0x0000, 0x3efe, 0x0146, 0x23ea, 0x0000, 0x3be6, 0x0000, 0x0000,
+	    0x32a9, 0x454f, 0x0000, 0x0893, 0x0000, 0x3c6b, 0x004f, 0x2caf,
+	    0x0588, 0x0000, 0x09df, 0x2503, 0x0000, 0x4038, 0x22ae, 0x33c0,
+	    0x2c7e, 0x3408, 0x2cc7, 0x0000, 0x0000, 0x4211, 0x4c3b, 0x0607,
+	    0x18cb, 0x0000, 0x1298, 0x0000, 0x144e, 0x0000, 0x0000, 0x3f12,
+	    0x0000, 0x0000, 0x10bd, 0x3f3b, 0x0000, 0x0000, 0x0000, 0x1110,
+	    0x0000, 0x0000, 0x4955, 0x0000, 0x0000, 0x2eef, 0x018d, 0x0000,
+	    0x03ab, 0x3cc2, 0x0000, 0x4d95, 0x0000, 0x0000, 0x0000, 0x25d2,
+	    0x1020, 0x0000, 0x3c72, 0x0000, 0x0000, 0x42c0, 0x0000, 0x1c81,
+	    0x0000, 0x3a36, 0x0000, 0x4422, 0x30fc, 0x3541, 0x0000, 0x02ed,
+	    0x06d1, 0x0000, 0x0000, 0x121f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x39bf, 0x2200, 0x2f37, 0x0000, 0x0a39, 0x0482, 0x0080, 0x3b4b,
+	    0x0000, 0x104b, 0x0000, 0x0000, 0x07b9, 0x2b02, 0x0000, 0x0000,
+	    0x2f57, 0x44e3, 0x0000, 0x30fa, 0x0ad9, 0x163e, 0x3aab, 0x0000,
+	    0x39db, 0x1a6e, 0x4986, 0x1fd8, 0x0000, 0x4d47, 0x3bcb, 0x0000,
+	    0x0cb7, 0x4019, 0x3960, 0x0000, 0x0000, 0x04a0, 0x0000, 0x0000,
+	    0x1167, 0x0000, 0x0000, 0x428d, 0x0000, 0x0000, 0x4afc, 0x0000,
+	    0x0000, 0x05b9, 0x4c9e, 0x3dcf, 0x11e2, 0x0d4e, 0x0000, 0x0000,
+	    0x21c3, 0x1bc9, 0x0000, 0x1491, 0x0000, 0x1800, 0x1f55, 0x2345,
+	    0x2ff3, 0x4b0b, 0x0000, 0x0584, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x259a, 0x4499, 0x31e3, 0x0000, 0x4a31, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x16e1, 0x0000, 0x0000, 0x0000, 0x3e82, 0x0000,
+	    0x0000, 0x4774, 0x20ef, 0x308c, 0x0000, 0x0000, 0x0000, 0x3b52,
+	    0x2e91, 0x2019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26fd,
+	    0x0d45, 0x4c2c, 0x3491, 0x4940, 0x38ad, 0x4015, 0x2e01, 0x0000,
+	    0x0000, 0x2ec2, 0x0000, 0x0000, 0x2214, 0x0b7f, 0x3658, 0x1df9,
+	    0x0df7, 0x2017, 0x0000, 0x0000, 0x0c32, 0x30d1, 0x3d8e, 0x0000,
+	    0x42df, 0x0000, 0x304d, 0x0000, 0x4db3, 0x0000, 0x3e47, 0x0000,
+	    0x0000, 0x2998, 0x0000, 0x0000, 0x1a55, 0x0000, 0x0000, 0x4338,
+	    0x0000, 0x0000, 0x218d, 0x0000, 0x0000, 0x29cf, 0x1c3b, 0x0000,
+	    0x0000, 0x324a, 0x0000, 0x0000, 0x2c7a, 0x23d6, 0x0839, 0x06f3,
+	    0x0000, 0x07ee, 0x0000, 0x4012, 0x0000, 0x3e2e, 0x0000, 0x2e00,
+	    0x152e, 0x0000, 0x0000, 0x0000, 0x31ba, 0x0000, 0x49c6, 0x07b3,
+	    0x0d5f, 0x36be, 0x0000, 0x0b62, 0x0000, 0x3318, 0x17be, 0x23aa,
+	    0x0000, 0x4993, 0x120e, 0x1ad8, 0x2c42, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x458c, 0x0000, 0x4465, 0x0000, 0x06f0, 0x0000, 0x3934,
+	    0x05d9, 0x0000, 0x1afb, 0x0054, 0x4680, 0x0000, 0x0000, 0x4cfc,
+	    0x0000, 0x1ef3, 0x3570, 0x2c3f, 0x0000, 0x075f, 0x0000, 0x0000,
+	    0x365a, 0x0000, 0x3812, 0x2d76, 0x430f, 0x1383, 0x0000, 0x0000,
+	    0x12be, 0x41d4, 0x0000, 0x2f6f, 0x46bf, 0x0000, 0x0000, 0x128a,
+	    0x0000, 0x0000, 0x3df7, 0x0000, 0x0000, 0x0000, 0x21db, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1083, 0x44c4, 0x048b, 0x0000, 0x2118,
+	    0x0897, 0x0000, 0x15c2, 0x0000, 0x0000, 0x45b7, 0x4d57, 0x4277,
+	    0x10d5, 0x0000, 0x4696, 0x378f, 0x0000, 0x0000, 0x2ab1, 0x0000,
+	    0x2846, 0x0000, 0x0000, 0x4626, 0x0000, 0x1713, 0x0000, 0x1525,
+	    0x173e, 0x0916, 0x0000, 0x4bd7, 0x2638, 0x02e2, 0x0000, 0x3446,
+	    0x28a5, 0x0000, 0x0000, 0x3bb7, 0x0ded, 0x02f2, 0x1e04, 0x10b8,
+	    0x0000, 0x1665, 0x0328, 0x2d72, 0x21a6, 0x2f23, 0x0000, 0x0000,
+	    0x4c3c, 0x0000, 0x294c, 0x2932, 0x45d4, 0x38ef, 0x0000, 0x3060,
+	    0x28ac, 0x2d34, 0x0000, 0x3fef, 0x4bb4, 0x02e4, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0543, 0x0000, 0x0000, 0x130f, 0x09a4, 0x0000,
+	    0x1f5c, 0x0000, 0x0000, 0x09a5, 0x02ae, 0x4708, 0x4510, 0x0000,
+	    0x0000, 0x3232, 0x0000, 0x4357, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x22f6, 0x1bd2, 0x0000, 0x070a, 0x09a7, 0x4b56, 0x2d98, 0x0000,
+	    0x3644, 0x02c6, 0x0000, 0x241a, 0x2dfe, 0x0000, 0x0000, 0x11e3,
+	    0x4c0a, 0x0000, 0x1d8f, 0x1003, 0x0000, 0x0000, 0x1b2c, 0x2c82,
+	    0x2641, 0x4925, 0x0000, 0x0000, 0x0000, 0x08c1, 0x154b, 0x2d55,
+	    0x0000, 0x0bb5, 0x37e2, 0x0000, 0x4c7e, 0x3613, 0x0000, 0x02fe,
+	    0x4890, 0x0000, 0x0488, 0x0000, 0x25ed, 0x473f, 0x4aea, 0x0000,
+	    0x07a6, 0x0000, 0x0000, 0x4b57, 0x0600, 0x4508, 0x28c8, 0x3e0c,
+	    0x100a, 0x0000, 0x07b1, 0x1a87, 0x0000, 0x0000, 0x493c, 0x0000,
+	    0x178d, 0x0000, 0x2975, 0x4c93, 0x0000, 0x0586, 0x047b, 0x0409,
+	    0x0000, 0x1d96, 0x0000, 0x4486, 0x30d7, 0x49e8, 0x1d13, 0x0000,
+	    0x0000, 0x2c9a, 0x2be6, 0x0000, 0x215b, 0x4aea, 0x0000, 0x4e04,
+	    0x16c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x35bc, 0x0000, 0x4541,
+	    0x2145, 0x0000, 0x0000, 0x0000, 0x06b3, 0x0120, 0x2900, 0x0000,
+	    0x0000, 0x4ad7, 0x40e5, 0x1a61, 0x3eec, 0x0000, 0x004a, 0x0000,
+	    0x0000, 0x0000, 0x0747, 0x4995, 0x1505, 0x0000, 0x0000, 0x0000,
+	    0x1ba7, 0x0000, 0x0000, 0x1d4a, 0x0000, 0x05a5, 0x0000, 0x0000,
+	    0x2451, 0x3abe, 0x3820, 0x12d5, 0x0000, 0x0988, 0x1a75, 0x00e2,
+	    0x30b8, 0x3b52, 0x0000, 0x1f2f, 0x0000, 0x1912, 0x0000, 0x24be,
+	    0x21eb, 0x02a2, 0x0000, 0x0000, 0x3007, 0x175a, 0x0000, 0x0000,
+	    0x0000, 0x23ec, 0x0000, 0x0000, 0x0000, 0x2f33, 0x0000, 0x0000,
+	    0x0000, 0x2f78, 0x0000, 0x4701, 0x02ab, 0x41cf, 0x0000, 0x37d0,
+	    0x0000, 0x0000, 0x2757, 0x4124, 0x0000, 0x2b9f, 0x178b, 0x1871,
+	    0x0000, 0x0556, 0x0000, 0x4077, 0x0000, 0x0c38, 0x0000, 0x2d58,
+	    0x486e, 0x0000, 0x0000, 0x0000, 0x0000, 0x364f, 0x00b5, 0x3cce,
+	    0x1141, 0x28c0, 0x4636, 0x4691, 0x0000, 0x2edc, 0x2f79, 0x08ae,
+	    0x197c, 0x0000, 0x0000, 0x4988, 0x0000, 0x0000, 0x0c58, 0x31b9,
+	    0x0e5d, 0x0000, 0x38c4, 0x2e54, 0x0000, 0x412e, 0x1367, 0x3ec2,
+	    0x0745, 0x18ab, 0x0000, 0x2731, 0x2699, 0x0000, 0x480a, 0x0000,
+	    0x0b60, 0x0000, 0x0000, 0x0000, 0x1181, 0x1613, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02e1, 0x0000, 0x4646, 0x2b28, 0x1449, 0x4ae4,
+	    0x3a33, 0x0000, 0x0000, 0x3b61, 0x2829, 0x00dc, 0x0000, 0x493f,
+	    0x409a, 0x2813, 0x0000, 0x4bdb, 0x2995, 0x0000, 0x0000, 0x0000,
+	    0x3191, 0x4de7, 0x372a, 0x16cf, 0x0000, 0x0000, 0x033e, 0x174b,
+	    0x0000, 0x0000, 0x39c9, 0x2016, 0x2766, 0x0000, 0x4846, 0x0000,
+	    0x0180, 0x285c, 0x1e8c, 0x30ce, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x33b9, 0x12b8, 0x0000, 0x19f4, 0x0000, 0x0f47, 0x21f6, 0x3cbb,
+	    0x0000, 0x3043, 0x0000, 0x0000, 0x30da, 0x0000, 0x3801, 0x0000,
+	    0x4c56, 0x0000, 0x0000, 0x3479, 0x0100, 0x0000, 0x1768, 0x0000,
+	    0x4c1f, 0x2ada, 0x0000, 0x0376, 0x1a24, 0x2222, 0x4b7b, 0x0000,
+	    0x0000, 0x3c05, 0x280d, 0x0000, 0x0000, 0x0298, 0x1d14, 0x10d6,
+	    0x0000, 0x174c, 0x0000, 0x1cf1, 0x3a75, 0x0000, 0x0000, 0x4af9,
+	    0x2679, 0x2fa2, 0x0000, 0x0000, 0x0000, 0x0218, 0x043c, 0x0000,
+	    0x401b, 0x43db, 0x0000, 0x024c, 0x0000, 0x2b75, 0x149f, 0x0862,
+	    0x497a, 0x4dd3, 0x1d65, 0x0a55, 0x0000, 0x2e73, 0x0000, 0x02d9,
+	    0x2de4, 0x0000, 0x0000, 0x0df6, 0x1ef4, 0x00fa, 0x08a9, 0x0000,
+	    0x0000, 0x0000, 0x3601, 0x0000, 0x0000, 0x0000, 0x29a5, 0x0fc5,
+	    0x0000, 0x00aa, 0x4a3a, 0x0000, 0x006a, 0x325f, 0x0000, 0x1c27,
+	    0x1bc6, 0x0000, 0x4590, 0x020d, 0x0000, 0x0000, 0x3f4a, 0x07c0,
+	    0x45c7, 0x39ef, 0x0000, 0x0000, 0x0000, 0x0000, 0x33f4, 0x3e2e,
+	    0x0000, 0x0b09, 0x02ff, 0x0660, 0x0000, 0x1975, 0x0400, 0x0000,
+	    0x337a, 0x1d8f, 0x0000, 0x2d8f, 0x0000, 0x2a10, 0x0000, 0x12c6,
+	    0x0208, 0x1328, 0x25c1, 0x3303, 0x40dc, 0x0000, 0x2492, 0x0af0,
+	    0x110a, 0x0000, 0x0289, 0x0000, 0x0a78, 0x0000, 0x4bab, 0x2112,
+	    0x49e7, 0x0141, 0x0000, 0x449c, 0x0000, 0x0000, 0x3766, 0x11ee,
+	    0x10f2, 0x0000, 0x1f19, 0x195a, 0x1e99, 0x0000, 0x0000, 0x4333,
+	    0x0000, 0x1faa, 0x046a, 0x0000, 0x0000, 0x0dc9, 0x0000, 0x4520,
+	    0x1a3e, 0x073d, 0x1454, 0x0000, 0x0000, 0x4bfe, 0x4a02, 0x48f5,
+	    0x0000, 0x0000, 0x3399, 0x0000, 0x1662, 0x19c3, 0x45b1, 0x3d63,
+	    0x0000, 0x0000, 0x398f, 0x4d36, 0x12ce, 0x0000, 0x404c, 0x0000,
+	    0x320a, 0x19c9, 0x1636, 0x28ce, 0x075a, 0x28ab, 0x0a84, 0x0000,
+	    0x3aa9, 0x01e5, 0x0000, 0x4779, 0x0000, 0x47fc, 0x30fd, 0x0000,
+	    0x19f1, 0x0000, 0x1ae4, 0x1371, 0x2328, 0x0000, 0x3e4d, 0x0bd6,
+	    0x0163, 0x0000, 0x0000, 0x2a66, 0x0000, 0x12cd, 0x2981, 0x3bc2,
+	    0x0000, 0x0a54, 0x0d13, 0x4118, 0x13f7, 0x41e6, 0x0086, 0x1bd6,
+	    0x00b9, 0x0f2b, 0x1170, 0x0000, 0x2dc8, 0x0911, 0x0000, 0x0000,
+	    0x0000, 0x18df, 0x3110, 0x0000, 0x0e6e, 0x0000, 0x49c2, 0x0000,
+	    0x0000, 0x0000, 0x0a86, 0x4450, 0x0447, 0x0000, 0x0000, 0x471b,
+	    0x0000, 0x0000, 0x4843, 0x0000, 0x4111, 0x0000, 0x0260, 0x368c,
+	    0x00bd, 0x0000, 0x370a, 0x0000, 0x0000, 0x3b38, 0x0000, 0x0000,
+	    0x1a31, 0x0000, 0x0000, 0x496d, 0x3a6e, 0x0000, 0x0e3d, 0x06c5,
+	    0x0414, 0x2a09, 0x1f0d, 0x0000, 0x0dff, 0x3aea, 0x2417, 0x0000,
+	    0x3b8c, 0x30c9, 0x3ada, 0x44af, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x35dd, 0x0000, 0x2c0c, 0x003f, 0x3f1b, 0x035a, 0x0000, 0x0000,
+	    0x42b0, 0x0811, 0x0000, 0x0522, 0x3dd0, 0x4c74, 0x0000, 0x0000,
+	    0x1de1, 0x0f92, 0x0bf7, 0x0000, 0x37c7, 0x41ad, 0x4831, 0x0000,
+	    0x0000, 0x3783, 0x0000, 0x3e10, 0x0000, 0x0000, 0x0000, 0x222c,
+	    0x3183, 0x1772, 0x0000, 0x0000, 0x0000, 0x3151, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1f90, 0x0000, 0x0000, 0x1be0,
+	    0x3dff, 0x0000, 0x4a40, 0x0000, 0x1361, 0x3950, 0x01d3, 0x168e,
+	    0x332f, 0x2603, 0x0000, 0x2a4e, 0x0000, 0x0815, 0x3b2d, 0x36ca,
+	    0x1860, 0x4072, 0x0136, 0x4974, 0x0000, 0x0e85, 0x0000, 0x0000,
+	    0x3c1a, 0x0000, 0x26bf, 0x0000, 0x3e03, 0x404b, 0x395e, 0x41f2,
+	    0x0000, 0x0000, 0x066a, 0x00ee, 0x0000, 0x0000, 0x1ed1, 0x3355,
+	    0x0000, 0x4565, 0x0000, 0x0944, 0x0000, 0x0000, 0x0000, 0x44dd,
+	    0x0000, 0x348e, 0x0000, 0x0000, 0x0000, 0x0000, 0x105f, 0x0000,
+	    0x4a11, 0x4174, 0x0000, 0x0000, 0x0000, 0x0000, 0x473f, 0x451b,
+	    0x18dd, 0x42ca, 0x044a, 0x0000, 0x1652, 0x0820, 0x0000, 0x0000,
+	    0x2955, 0x41f2, 0x1938, 0x098e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4077, 0x3e6e, 0x123d, 0x3d55, 0x0000, 0x0000, 0x204c, 0x04b2,
+	    0x0000, 0x359c, 0x0000, 0x2a8f, 0x11b5, 0x19b9, 0x1ed2, 0x0000,
+	    0x0000, 0x0000, 0x05cc, 0x0000, 0x0b36, 0x43df, 0x0000, 0x1776,
+	    0x12e7, 0x0703, 0x0000, 0x0000, 0x3786, 0x0000, 0x20a2, 0x0000,
+	    0x0000, 0x467a, 0x1e19, 0x0c16, 0x0000, 0x0000, 0x37c8, 0x0000,
+	    0x0000, 0x0000, 0x26eb, 0x0000, 0x0000, 0x3714, 0x0722, 0x0000,
+	    0x2a70, 0x1678, 0x0000, 0x0000, 0x0000, 0x3e38, 0x0000, 0x0000,
+	    0x2ef5, 0x0000, 0x26e8, 0x0000, 0x11e1, 0x23b6, 0x0000, 0x34ac,
+	    0x0ffb, 0x0000, 0x0000, 0x070a, 0x2ee3, 0x3351, 0x0000, 0x0000,
+	    0x0021, 0x44fa, 0x03bd, 0x30aa, 0x0000, 0x0000, 0x322f, 0x0000,
+	    0x33ba, 0x0000, 0x0a44, 0x0000, 0x131b, 0x2231, 0x1a0c, 0x4865,
+	    0x0000, 0x22aa, 0x38f5, 0x0de4, 0x16aa, 0x0000, 0x0761, 0x255b,
+	    0x0000, 0x1a5b, 0x0000, 0x3718, 0x0000, 0x4426, 0x2aec, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x07f6, 0x0000, 0x0d14, 0x278e,
+	    0x42e8, 0x0d65, 0x356b, 0x2334, 0x0000, 0x0000, 0x0000, 0x0998,
+	    0x0bb4, 0x0000, 0x0000, 0x0000, 0x0000, 0x1828, 0x32ce, 0x3242,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3a39, 0x00cd, 0x1afb, 0x2822,
+	    0x4d41, 0x0000, 0x0ebc, 0x3360, 0x4358, 0x2bd6, 0x219d, 0x0000,
+	    0x1a90, 0x0000, 0x10c2, 0x0000, 0x0839, 0x0000, 0x1fdc, 0x0000,
+	    0x13b1, 0x0aed, 0x16b2, 0x0c81, 0x001e, 0x0000, 0x0000, 0x0000,
+	    0x412c, 0x0000, 0x19ad, 0x03dd, 0x0000, 0x399c, 0x0000, 0x0efc,
+	    0x089a, 0x0000, 0x0000, 0x30c1, 0x495d, 0x1fc8, 0x0000, 0x0000,
+	    0x3797, 0x063a, 0x0000, 0x0000, 0x0000, 0x1ec0, 0x3fbb, 0x3679,
+	    0x049b, 0x30a9, 0x4c84, 0x3f97, 0x0000, 0x0000, 0x2515, 0x282f,
+	    0x0000, 0x2b11, 0x4b32, 0x16ec, 0x07fa, 0x3373, 0x0000, 0x4326,
+	    0x0000, 0x0000, 0x02e9, 0x0000, 0x4459, 0x0000, 0x0000, 0x09ce,
+	    0x31ad, 0x0000, 0x0add, 0x377a, 0x0000, 0x084a, 0x21c9, 0x4781,
+	    0x3b56, 0x0000, 0x0000, 0x0bab, 0x4706, 0x41b4, 0x0000, 0x17b6,
+	    0x0000, 0x3fe2, 0x0000, 0x1a28, 0x3c23, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01ae, 0x0613, 0x0000, 0x4a12, 0x0000, 0x03e9, 0x4d03,
+	    0x1b64, 0x0000, 0x28ca, 0x45ff, 0x464d, 0x0000, 0x0686, 0x0000,
+	    0x0000, 0x2f69, 0x36fb, 0x334c, 0x0000, 0x0000, 0x0438, 0x2171,
+	    0x0000, 0x3caf, 0x2c0b, 0x0000, 0x19cf, 0x1bb9, 0x258f, 0x28c2,
+	    0x0000, 0x0000, 0x1612, 0x27f4, 0x0000, 0x4caa, 0x3f5b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3159, 0x0000, 0x21c4, 0x32ab, 0x0000,
+	    0x0ed9, 0x0000, 0x1e4d, 0x0000, 0x0000, 0x0000, 0x4615, 0x0000,
+	    0x0000, 0x2366, 0x0000, 0x333d, 0x2774, 0x030a, 0x3cf3, 0x0000,
+	    0x0000, 0x0000, 0x3d20, 0x3222, 0x0238, 0x2adf, 0x0000, 0x0000,
+	    0x1554, 0x0000, 0x0000, 0x26a2, 0x0000, 0x0798, 0x0000, 0x1f08,
+	    0x0662, 0x0df9, 0x0000, 0x0000, 0x396f, 0x0000, 0x0000, 0x10e1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2155, 0x0000, 0x21e1,
+	    0x0c74, 0x3c3d, 0x0269, 0x0418, 0x11d4, 0x0000, 0x046b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4540, 0x14ed, 0x0945, 0x0dd6, 0x0000,
+	    0x0161, 0x17cf, 0x2ee2, 0x24eb, 0x0000, 0x0000, 0x46dd, 0x180a,
+	    0x3a5f, 0x4bf1, 0x0000, 0x4dd3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3a83, 0x2b6c, 0x3c07, 0x007b,
+	    0x308b, 0x0000, 0x0000, 0x0000, 0x0068, 0x0000, 0x137d, 0x27fc,
+	    0x2a17, 0x2f47, 0x0000, 0x0000, 0x0447, 0x21a8, 0x0c0d, 0x0000,
+	    0x4299, 0x300c, 0x25ee, 0x0000, 0x0000, 0x1537, 0x08c3, 0x0000,
+	    0x0000, 0x18d9, 0x2de6, 0x0000, 0x20f0, 0x3ef6, 0x1197, 0x0000,
+	    0x3954, 0x0000, 0x0000, 0x461c, 0x43c5, 0x4cd8, 0x2d7a, 0x2fc7,
+	    0x3857, 0x2e31, 0x0000, 0x0000, 0x0000, 0x1ed8, 0x3b19, 0x3941,
+	    0x11fa, 0x0000, 0x0000, 0x0000, 0x2eda, 0x412f, 0x0000, 0x0000,
+	    0x0000, 0x2f98, 0x0000, 0x432f, 0x4320, 0x0000, 0x0000, 0x0000,
+	    0x3351, 0x0000, 0x0000, 0x4c17, 0x1a30, 0x0000, 0x1766, 0x0000,
+	    0x1829, 0x2eeb, 0x0000, 0x0eff, 0x36fa, 0x2b88, 0x0000, 0x47e9,
+	    0x0000, 0x064f, 0x47ad, 0x0000, 0x2ba7, 0x4cff, 0x19df, 0x1df9,
+	    0x03f3, 0x0000, 0x0000, 0x0000, 0x0000, 0x277b, 0x0000, 0x159d,
+	    0x0367, 0x13c6, 0x2a22, 0x0000, 0x2bf7, 0x0000, 0x0295, 0x0713,
+	    0x3682, 0x3f81, 0x04d7, 0x3811, 0x22f3, 0x01e4, 0x0000, 0x268b,
+	    0x3885, 0x13a1, 0x0000, 0x2136, 0x0000, 0x0000, 0x04b4, 0x0000,
+	    0x0000, 0x01bc, 0x0000, 0x20ac, 0x175c, 0x4728, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x32a9, 0x0000, 0x0000, 0x4ac6, 0x0000, 0x0000,
+	    0x3c4e, 0x0000, 0x0000, 0x4d7d, 0x0000, 0x0fb5, 0x18c0, 0x114d,
+	    0x3212, 0x0000, 0x0000, 0x1a2b, 0x1dc6, 0x0000, 0x0000, 0x2281,
+	    0x4673, 0x0000, 0x243c, 0x0000, 0x283d, 0x0000, 0x0000, 0x0000,
+	    0x310e, 0x2091, 0x2584, 0x2b06, 0x0715, 0x43b3, 0x0000, 0x0000,
+	    0x36c1, 0x0000, 0x0000, 0x14b8, 0x2af2, 0x07de, 0x0000, 0x44e5,
+	    0x27b2, 0x0000, 0x0dc7, 0x0000, 0x0000, 0x453b, 0x24f6, 0x42fe,
+	    0x0000, 0x4ac0, 0x0000, 0x0000, 0x3a9e, 0x0998, 0x304e, 0x022f,
+	    0x414e, 0x0000, 0x0000, 0x272e, 0x2801, 0x2932, 0x3a31, 0x0000,
+	    0x0000, 0x4de6, 0x0ae2, 0x0000, 0x209b, 0x0000, 0x0000, 0x0970,
+	    0x0282, 0x0000, 0x0000, 0x35c2, 0x0000, 0x3510, 0x0000, 0x297e,
+	    0x471a, 0x43f9, 0x102c, 0x1ffa, 0x1224, 0x0000, 0x3095, 0x4d10,
+	    0x2d4e, 0x4ca4, 0x0000, 0x3061, 0x0a31, 0x0000, 0x0000, 0x0f7e,
+	    0x0000, 0x0000, 0x0000, 0x31c4, 0x0000, 0x49ea, 0x18fe, 0x0000,
+	    0x00c8, 0x0a1e, 0x0000, 0x02f1, 0x0000, 0x2cb0, 0x0000, 0x03c2,
+	    0x0dd3, 0x00e7, 0x0000, 0x0000, 0x0000, 0x3046, 0x45d6, 0x0000,
+	    0x0000, 0x0000, 0x4135, 0x1ea8, 0x35db, 0x0000, 0x0000, 0x2c38,
+	    0x0093, 0x1a9d, 0x0000, 0x39c1, 0x0000, 0x0000, 0x0000, 0x4d47,
+	    0x1759, 0x0000, 0x4879, 0x0000, 0x0000, 0x3b84, 0x3afa, 0x22d4,
+	    0x0000, 0x0000, 0x3939, 0x0000, 0x2b92, 0x0000, 0x0a8c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c7a, 0x0000, 0x1867,
+	    0x0e02, 0x0cba, 0x3bcf, 0x15db, 0x41c3, 0x0000, 0x0e7b, 0x4e03,
+	    0x0000, 0x3aba, 0x0000, 0x01c1, 0x3089, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x260b, 0x0000, 0x1e3f, 0x0000, 0x0000, 0x0000,
+	    0x1fef, 0x3b20, 0x0000, 0x0000, 0x0000, 0x0000, 0x4adb, 0x329b,
+	    0x34d2, 0x19bc, 0x0000, 0x3023, 0x2b15, 0x0000, 0x4d6a, 0x132d,
+	    0x370d, 0x2bf4, 0x0000, 0x224f, 0x0000, 0x0000, 0x3a6a, 0x4850,
+	    0x2d58, 0x4823, 0x0000, 0x3b47, 0x0000, 0x345b, 0x0000, 0x1c5f,
+	    0x0000, 0x1ecf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0873, 0x0812,
+	    0x17f7, 0x0000, 0x03f5, 0x1f13, 0x15ed, 0x0000, 0x2810, 0x46b8,
+	    0x3b04, 0x1b60, 0x0000, 0x0550, 0x48c0, 0x0544, 0x0000, 0x0000,
+	    0x0a5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22c4, 0x0000,
+	    0x0000, 0x335e, 0x2070, 0x0000, 0x0000, 0x0000, 0x00c4, 0x1bce,
+	    0x0000, 0x0000, 0x0a3f, 0x1e62, 0x182a, 0x1d04, 0x30c7, 0x0000,
+	    0x3b19, 0x0013, 0x133b, 0x0000, 0x30ba, 0x0000, 0x0000, 0x0000,
+	    0x2cc1, 0x276c, 0x0000, 0x36d8, 0x0000, 0x118e, 0x0000, 0x0000,
+	    0x0000, 0x3ec0, 0x259b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0f58, 0x2317, 0x0000, 0x1ee7, 0x2be5, 0x47e2, 0x0000,
+	    0x20e9, 0x0000, 0x17b1, 0x38b5, 0x3703, 0x0a68, 0x370a, 0x242f,
+	    0x26c2, 0x0000, 0x0000, 0x34d7, 0x0000, 0x0000, 0x2eb7, 0x324f,
+	    0x24d0, 0x4a49, 0x3b8b, 0x1866, 0x4327, 0x1ace, 0x49c4, 0x0000,
+	    0x23bf, 0x4a8f, 0x0000, 0x0b58, 0x31f8, 0x0000, 0x1951, 0x1e89,
+	    0x0000, 0x0506, 0x0000, 0x0000, 0x4dfb, 0x22fd, 0x0000, 0x0000,
+	    0x2af5, 0x0e11, 0x0000, 0x0000, 0x0000, 0x04bf, 0x2cd2, 0x2258,
+	    0x0000, 0x1094, 0x0000, 0x1247, 0x0000, 0x23e6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2e40, 0x18d0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x24ec, 0x0a07, 0x0000, 0x3c9a, 0x06a9, 0x0000, 0x0000, 0x3532,
+	    0x17d6, 0x0000, 0x4135, 0x0000, 0x0000, 0x2ab9, 0x0000, 0x02ea,
+	    0x04d6, 0x0000, 0x3fa9, 0x0000, 0x338b, 0x138c, 0x30f4, 0x0000,
+	    0x3e3d, 0x0000, 0x205e, 0x0000, 0x1ebf, 0x40d5, 0x0000, 0x0000,
+	    0x12aa, 0x2c7a, 0x09c1, 0x06a9, 0x19ab, 0x4689, 0x0000, 0x3ccb,
+	    0x17eb, 0x1d08, 0x2c73, 0x0000, 0x2384, 0x0000, 0x324b, 0x0000,
+	    0x18fe, 0x0266, 0x28aa, 0x0000, 0x0000, 0x3f13, 0x0118, 0x1864,
+	    0x0000, 0x1a7f, 0x3bf3, 0x0604, 0x3072, 0x18a4, 0x39b3, 0x011b,
+	    0x0000, 0x3049, 0x1fde, 0x33f1, 0x2b5e, 0x0000, 0x0a29, 0x0000,
+	    0x0ef3, 0x2443, 0x0000, 0x0d76, 0x1ca7, 0x16f9, 0x393c, 0x4e07,
+	    0x0000, 0x2336, 0x31cd, 0x0000, 0x15d5, 0x0000, 0x15ad, 0x26f0,
+	    0x10ae, 0x102f, 0x35f9, 0x04e9, 0x0000, 0x2bf0, 0x1b4c, 0x3eee,
+	    0x0000, 0x0000, 0x0056, 0x3f7a, 0x43ba, 0x0000, 0x0000, 0x0000,
+	    0x0528, 0x0000, 0x0000, 0x0db5, 0x0000, 0x1671, 0x2fd5, 0x4740,
+	    0x32e5, 0x0000, 0x18a7, 0x0175, 0x3701, 0x2c06, 0x0000, 0x273e,
+	    0x0000, 0x1095, 0x0000, 0x25dd, 0x0000, 0x0000, 0x0000, 0x0e41,
+	    0x066e, 0x1bea, 0x2e86, 0x38be, 0x0000, 0x0000, 0x1849, 0x0000,
+	    0x0000, 0x0000, 0x10e4, 0x2bff, 0x42c4, 0x3ea2, 0x0000, 0x1008,
+	    0x1578, 0x006f, 0x0f6d, 0x0000, 0x1b8a, 0x412a, 0x41f7, 0x0000,
+	    0x1242, 0x2473, 0x1023, 0x0000, 0x2011, 0x2b8d, 0x1719, 0x0000,
+	    0x2986, 0x0000, 0x01a9, 0x0000, 0x053b, 0x0d3b, 0x4ca7, 0x282f,
+	    0x2839, 0x0000, 0x0653, 0x0000, 0x0000, 0x04e6, 0x244a, 0x0f7a,
+	    0x0000, 0x0000, 0x3726, 0x0000, 0x2abc, 0x0000, 0x4d10, 0x26ef,
+	    0x0000, 0x45e5, 0x0000, 0x0683, 0x0000, 0x0000, 0x0000, 0x48b3,
+	    0x0000, 0x0000, 0x0000, 0x05e2, 0x2842, 0x4822, 0x0000, 0x3161,
+	    0x0000, 0x0000, 0x3b8c, 0x0000, 0x0000, 0x489a, 0x15d9, 0x0770,
+	    0x0000, 0x2f66, 0x164b, 0x116d, 0x44ee, 0x2eb3, 0x0000, 0x0000,
+	    0x0886, 0x1773, 0x3d6d, 0x1fde, 0x32c3, 0x0000, 0x2871, 0x28e0,
+	    0x0000, 0x00ed, 0x333a, 0x0000, 0x24cd, 0x0000, 0x44a2, 0x0000,
+	    0x46e0, 0x2021, 0x1ee4, 0x35af, 0x0000, 0x1cb1, 0x0000, 0x368c,
+	    0x1412, 0x3315, 0x4344, 0x0b92, 0x0000, 0x20d4, 0x0000, 0x0000,
+	    0x1ea7, 0x329e, 0x1dff, 0x2514, 0x45b8, 0x0873, 0x2bc4, 0x0000,
+	    0x0000, 0x1bee, 0x165b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0051,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2fa6, 0x0000, 0x0000, 0x4bc1,
+	    0x468b, 0x0000, 0x0000, 0x1a1e, 0x0eab, 0x0915, 0x12eb, 0x433a,
+	    0x399c, 0x1dbe, 0x3c30, 0x484c, 0x28c8, 0x0000, 0x0000, 0x4cc7,
+	    0x291b, 0x47ad, 0x0eb5, 0x0f4d, 0x0000, 0x10f3, 0x0ab7, 0x0000,
+	    0x0000, 0x4447, 0x0000, 0x2a7a, 0x25aa, 0x0000, 0x0000, 0x156b,
+	    0x0000, 0x0000, 0x0000, 0x1a12, 0x287f, 0x2761, 0x293a, 0x0000,
+	    0x072f, 0x324d, 0x3240, 0x0000, 0x14c2, 0x0000, 0x0000, 0x0000,
+	    0x198a, 0x3d8a, 0x3550, 0x0000, 0x0000, 0x0e12, 0x0000, 0x0000,
+	    0x20ed, 0x275a, 0x0000, 0x0000, 0x48c4, 0x0694, 0x0621, 0x0000,
+	    0x073c, 0x0000, 0x42ca, 0x26eb, 0x0000, 0x0000, 0x2c8f, 0x42c4,
+	    0x0000, 0x0000, 0x0000, 0x2659, 0x0000, 0x4a92, 0x1f28, 0x0000,
+	    0x1b16, 0x3651, 0x0000, 0x3816, 0x2168, 0x0000, 0x388b, 0x0000,
+	    0x3394, 0x2738, 0x0ee0, 0x0afb, 0x3314, 0x3eeb, 0x0ecb, 0x0000,
+	    0x0000, 0x08fe, 0x04aa, 0x2556, 0x43d4, 0x0000, 0x0000, 0x2fb1,
+	    0x0000, 0x0000, 0x2769, 0x0000, 0x09ab, 0x0000, 0x0000, 0x3e23,
+	    0x0000, 0x4486, 0x21af, 0x0000, 0x471c, 0x0000, 0x0000, 0x45ea,
+	    0x0000, 0x3b74, 0x00b9, 0x2c59, 0x3523, 0x0000, 0x0000, 0x15f9,
+	    0x0000, 0x0000, 0x4424, 0x0000, 0x0000, 0x0000, 0x3f0e, 0x0000,
+	    0x0000, 0x252f, 0x1e34, 0x1c6c, 0x2bc9, 0x3e85, 0x0000, 0x11b7,
+	    0x0000, 0x0000, 0x0000, 0x2fcf, 0x0e53, 0x0000, 0x33bf, 0x3c8c,
+	    0x0000, 0x0000, 0x0000, 0x393b, 0x0000, 0x462c, 0x381f, 0x2dd7,
+	    0x0000, 0x2635, 0x480e, 0x1ec4, 0x20b8, 0x0000, 0x0000, 0x41bf,
+	    0x45ff, 0x0000, 0x0000, 0x0000, 0x476d, 0x0000, 0x1679, 0x0000,
+	    0x0000, 0x363c, 0x0000, 0x0000, 0x0000, 0x3862, 0x25fb, 0x2eae,
+	    0x0000, 0x2fd6, 0x0000, 0x0000, 0x0000, 0x4a62, 0x3901, 0x38fb,
+	    0x4621, 0x2df2, 0x437f, 0x0000, 0x4300, 0x0dab, 0x0000, 0x0000,
+	    0x0000, 0x3c6f, 0x0000, 0x0932, 0x0000, 0x1390, 0x27bd, 0x3a7a,
+	    0x4801, 0x0791, 0x0cc4, 0x162e, 0x0000, 0x0000, 0x2bb3, 0x3ef1,
+	    0x351a, 0x179a, 0x0000, 0x0a71, 0x0000, 0x3bed, 0x0e09, 0x1e32,
+	    0x26d1, 0x0342, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2cdf,
+	    0x3057, 0x2c55, 0x0000, 0x3674, 0x0000, 0x0312, 0x0aeb, 0x3c47,
+	    0x0000, 0x1599, 0x0000, 0x46a8, 0x2d17, 0x19af, 0x0000, 0x425b,
+	    0x3d07, 0x0000, 0x0000, 0x2359, 0x1ba6, 0x0000, 0x1fd3, 0x24ac,
+	    0x0000, 0x07b9, 0x0000, 0x0000, 0x42eb, 0x0f0a, 0x3126, 0x377d,
+	    0x0000, 0x39df, 0x0000, 0x22bb, 0x0848, 0x23ac, 0x0701, 0x0000,
+	    0x12e6, 0x0000, 0x30cc, 0x4742, 0x0000, 0x0000, 0x1567, 0x0000,
+	    0x0000, 0x3b7f, 0x0000, 0x21ef, 0x39ad, 0x2d84, 0x0000, 0x0fa4,
+	    0x0000, 0x0000, 0x0000, 0x4bc6, 0x1fe2, 0x38ae, 0x07b3, 0x0000,
+	    0x2178, 0x455b, 0x06f2, 0x03f4, 0x4a56, 0x493e, 0x48a6, 0x4964,
+	    0x4663, 0x4bff, 0x0000, 0x1c91, 0x0000, 0x032f, 0x0000, 0x0000,
+	    0x139c, 0x0000, 0x466d, 0x0000, 0x4af0, 0x0000, 0x3e80, 0x27ad,
+	    0x0000, 0x019a, 0x0000, 0x0000, 0x0000, 0x42ee, 0x0000, 0x30fe,
+	    0x0000, 0x3b7d, 0x2af1, 0x1cb5, 0x3a7e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0465, 0x0000, 0x0067, 0x0000, 0x4186, 0x09ef,
+	    0x17fd, 0x1f2d, 0x0000, 0x0437, 0x0ad2, 0x112d, 0x04b0, 0x3506,
+	    0x304a, 0x35dc, 0x0000, 0x0f9c, 0x36d6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3a14, 0x0000, 0x1acf, 0x0000, 0x39eb,
+	    0x0c36, 0x0000, 0x3399, 0x3b83, 0x46ac, 0x0000, 0x0000, 0x393a,
+	    0x1453, 0x3202, 0x054b, 0x0ea5, 0x1943, 0x20a2, 0x1108, 0x29d9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x217a, 0x0000, 0x481f, 0x09ba,
+	    0x0000, 0x350c, 0x0000, 0x3358, 0x4965, 0x0000, 0x0000, 0x33ee,
+	    0x24cf, 0x0782, 0x424f, 0x34d2, 0x3295, 0x14d7, 0x2e4c, 0x15d3,
+	    0x0000, 0x2dbf, 0x0000, 0x0000, 0x11a3, 0x1953, 0x0c60, 0x3b37,
+	    0x0000, 0x0000, 0x08d2, 0x3425, 0x0000, 0x0000, 0x3835, 0x0000,
+	    0x0000, 0x438c, 0x23ee, 0x0000, 0x28b2, 0x2e76, 0x4641, 0x19c8,
+	    0x2f8b, 0x3d01, 0x0000, 0x0000, 0x0a9c, 0x412c, 0x0fe6, 0x448a,
+	    0x0000, 0x0f5f, 0x27f7, 0x3956, 0x469c, 0x1a7c, 0x24e1, 0x3a9e,
+	    0x0000, 0x36b3, 0x249d, 0x3c94, 0x0000, 0x0000, 0x0c53, 0x2fa4,
+	    0x0000, 0x0000, 0x2a80, 0x16cb, 0x0000, 0x0000, 0x1cdf, 0x2cf0,
+	    0x36bf, 0x49a6, 0x0000, 0x4283, 0x010b, 0x0000, 0x3283, 0x34cd,
+	    0x3eee, 0x0000, 0x3f55, 0x04d3, 0x0000, 0x0000, 0x0000, 0x168e,
+	    0x45a5, 0x25db, 0x0000, 0x0000, 0x3abb, 0x4633, 0x0000, 0x1729,
+	    0x1245, 0x40ed, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4cc2,
+	    0x0000, 0x0000, 0x1b48, 0x0a56, 0x0273, 0x0000, 0x35d3, 0x0000,
+	    0x309a, 0x0000, 0x0000, 0x0000, 0x1a7f, 0x2092, 0x4bf1, 0x1ae1,
+	    0x0ca2, 0x0000, 0x0000, 0x0c83, 0x098c, 0x358e, 0x0000, 0x0000,
+	    0x1688, 0x4a49, 0x0000, 0x2e5c, 0x0000, 0x0000, 0x227a, 0x0000,
+	    0x3cbd, 0x3564, 0x2da3, 0x4d5b, 0x3a85, 0x0000, 0x0000, 0x1c99,
+	    0x4862, 0x0000, 0x4c40, 0x0000, 0x0000, 0x1624, 0x0558, 0x4826,
+	    0x0000, 0x4982, 0x4a42, 0x1444, 0x0000, 0x3060, 0x04bc, 0x391e,
+	    0x0000, 0x0b72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b1a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0124, 0x0000,
+	    0x0000, 0x4882, 0x3c95, 0x0aa4, 0x0000, 0x1397, 0x283a, 0x0156,
+	    0x0000, 0x42f5, 0x0000, 0x4494, 0x18d4, 0x21f5, 0x34f2, 0x0000,
+	    0x4429, 0x4ad9, 0x0000, 0x0000, 0x0000, 0x074c, 0x00b5, 0x1aab,
+	    0x2c09, 0x44b1, 0x0000, 0x0000, 0x0de9, 0x0000, 0x3719, 0x0000,
+	    0x2936, 0x0ccf, 0x4d94, 0x38af, 0x293e, 0x0000, 0x4a1a, 0x482f,
+	    0x16f4, 0x0000, 0x0000, 0x0c56, 0x0000, 0x0000, 0x3270, 0x0000,
+	    0x0000, 0x2eca, 0x0000, 0x0000, 0x2dbf, 0x2f85, 0x0000, 0x2558,
+	    0x0000, 0x0000, 0x0000, 0x10b6, 0x3c54, 0x0000, 0x0b72, 0x0000,
+	    0x1bbd, 0x0000, 0x4dc5, 0x0291, 0x42e6, 0x43a1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0dab, 0x20b4, 0x4a43, 0x0000, 0x0000,
+	    0x3c25, 0x0000, 0x0000, 0x106d, 0x30f7, 0x12fc, 0x42ff, 0x2bf0,
+	    0x3be5, 0x0aab, 0x4a2e, 0x0000, 0x0000, 0x1bf1, 0x0000, 0x0000,
+	    0x295a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x39ff, 0x0000, 0x1f79, 0x0000, 0x1357, 0x0000, 0x4956,
+	    0x3cdb, 0x0000, 0x0000, 0x449a, 0x2341, 0x365e, 0x2c88, 0x44ff,
+	    0x0000, 0x0000, 0x1e61, 0x0d09, 0x1929, 0x0000, 0x3da1, 0x10d1,
+	    0x039f, 0x0000, 0x0000, 0x0000, 0x0000, 0x3de5, 0x0000, 0x0000,
+	    0x127e, 0x00c1, 0x32a3, 0x0000, 0x2395, 0x4dcd, 0x377e, 0x2a37,
+	    0x0000, 0x31ac, 0x0000, 0x1114, 0x0000, 0x0000, 0x0253, 0x4081,
+	    0x23ff, 0x0000, 0x333c, 0x0dae, 0x2f26, 0x0000, 0x0000, 0x006a,
+	    0x36ff, 0x246b, 0x0000, 0x0000, 0x0000, 0x08af, 0x0000, 0x3db2,
+	    0x0000, 0x1718, 0x0203, 0x2808, 0x328a, 0x4c91, 0x0000, 0x0000,
+	    0x3fad, 0x2010, 0x4586, 0x0000, 0x4789, 0x4df7, 0x3406, 0x3dc0,
+	    0x3dd3, 0x0000, 0x0000, 0x1de2, 0x0e84, 0x04c9, 0x0000, 0x0000,
+	    0x0000, 0x00cb, 0x0000, 0x4234, 0x4057, 0x0000, 0x0000, 0x3036,
+	    0x2686, 0x4ce6, 0x109c, 0x0000, 0x2277, 0x0ba0, 0x00d7, 0x2b25,
+	    0x4284, 0x370b, 0x0000, 0x0000, 0x0000, 0x05c2, 0x071f, 0x0c1d,
+	    0x4425, 0x1c63, 0x0d94, 0x0000, 0x0760, 0x14f8, 0x373c, 0x0000,
+	    0x1d3b, 0x0b5b, 0x0000, 0x0000, 0x383b, 0x3655, 0x0000, 0x0000,
+	    0x0000, 0x3ce5, 0x0000, 0x053b, 0x3d4d, 0x0000, 0x1ef1, 0x0000,
+	    0x0000, 0x0000, 0x33bc, 0x0000, 0x4d2f, 0x0000, 0x0000, 0x282c,
+	    0x21c7, 0x0000, 0x0000, 0x0000, 0x2584, 0x0000, 0x2312, 0x0f02,
+	    0x2e0f, 0x0000, 0x3534, 0x14e4, 0x2384, 0x4a5e, 0x0000, 0x0000,
+	    0x1a1d, 0x0000, 0x4b3c, 0x3f95, 0x3e43, 0x4714, 0x210c, 0x0000,
+	    0x0000, 0x0000, 0x04d4, 0x1233, 0x4577, 0x0000, 0x0000, 0x384d,
+	    0x0000, 0x1fd3, 0x2f0b, 0x3952, 0x018f, 0x36f4, 0x475e, 0x0000,
+	    0x0000, 0x0768, 0x0000, 0x0000, 0x0000, 0x3e0b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x172a, 0x179b, 0x1aaa, 0x2614, 0x3c92, 0x425b,
+	    0x0000, 0x0000, 0x2962, 0x17ec, 0x3577, 0x0000, 0x4b22, 0x054b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3fb5, 0x0000, 0x276d, 0x0000,
+	    0x34e1, 0x2266, 0x0000, 0x0000, 0x210d, 0x0000, 0x3656, 0x4487,
+	    0x0000, 0x4d41, 0x1045, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04b6, 0x0f1a, 0x1988, 0x0000, 0x0000,
+	    0x151b, 0x2977, 0x0000, 0x2fed, 0x430b, 0x063f, 0x4931, 0x0000,
+	    0x1279, 0x4b24, 0x0000, 0x0000, 0x21d5, 0x0000, 0x1f1c, 0x0000,
+	    0x1e10, 0x086d, 0x1f41, 0x0000, 0x4bba, 0x47c2, 0x2873, 0x0000,
+	    0x0000, 0x0000, 0x2d01, 0x2a07, 0x0000, 0x0000, 0x39e3, 0x19cf,
+	    0x4526, 0x0000, 0x17df, 0x0000, 0x33cd, 0x0000, 0x39f9, 0x0000,
+	    0x0000, 0x0000, 0x2e67, 0x0000, 0x0174, 0x1aa5, 0x17ec, 0x036e,
+	    0x36db, 0x0000, 0x2843, 0x00d1, 0x33e5, 0x0000, 0x0000, 0x1586,
+	    0x15cc, 0x34b5, 0x0000, 0x13d8, 0x0567, 0x0000, 0x28b9, 0x2fd7,
+	    0x2e81, 0x0000, 0x2728, 0x0000, 0x0000, 0x0000, 0x317c, 0x0000,
+	    0x0283, 0x0587, 0x47d6, 0x0000, 0x3eda, 0x0000, 0x0000, 0x0000,
+	    0x2db3, 0x0000, 0x0797, 0x3813, 0x48e4, 0x0000, 0x17c5, 0x2581,
+	    0x326e, 0x06de, 0x37f6, 0x12c0, 0x0000, 0x0000, 0x0000, 0x4a39,
+	    0x2b7e, 0x0c15, 0x229e, 0x0000, 0x31db, 0x0484, 0x0000, 0x2559,
+	    0x0000, 0x2382, 0x099d, 0x3687, 0x0000, 0x1917, 0x0000, 0x3f3d,
+	    0x0000, 0x2119, 0x1813, 0x24be, 0x0000, 0x1d88, 0x0000, 0x0000,
+	    0x0000, 0x4d06, 0x234d, 0x0000, 0x0000, 0x08aa, 0x29bc, 0x0000,
+	    0x0edd, 0x0000, 0x0000, 0x24d6, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x19e0, 0x0e19, 0x3869, 0x0000, 0x081f, 0x10e7, 0x2905, 0x4943,
+	    0x076a, 0x052a, 0x0000, 0x1fd9, 0x1d54, 0x090f, 0x2cb5, 0x0000,
+	    0x137f, 0x21ed, 0x0000, 0x45b3, 0x18df, 0x0000, 0x0000, 0x0f08,
+	    0x0000, 0x0000, 0x1c0b, 0x1b30, 0x16f7, 0x0000, 0x4096, 0x3e7b,
+	    0x0000, 0x0000, 0x3daa, 0x0000, 0x081c, 0x0000, 0x4089, 0x0000,
+	    0x0000, 0x0000, 0x29cb, 0x3df5, 0x2469, 0x0000, 0x23c0, 0x4b8f,
+	    0x2244, 0x1c15, 0x30f5, 0x067a, 0x0000, 0x2616, 0x36dd, 0x38ed,
+	    0x275c, 0x0a5e, 0x0000, 0x4320, 0x0000, 0x0000, 0x35c6, 0x041e,
+	    0x2cc7, 0x2823, 0x15a2, 0x253d, 0x12ef, 0x4c1a, 0x386a, 0x12d5,
+	    0x3f39, 0x0c30, 0x0000, 0x1736, 0x0000, 0x2b53, 0x37e0, 0x2f07,
+	    0x0a57, 0x0000, 0x0000, 0x0000, 0x025b, 0x1a80, 0x0000, 0x0000,
+	    0x2c42, 0x446f, 0x0275, 0x0000, 0x26c4, 0x2b8b, 0x0000, 0x1e49,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2e4f, 0x078a, 0x3468, 0x22a5,
+	    0x4ba5, 0x0000, 0x0000, 0x26db, 0x1fa2, 0x3ebb, 0x1959, 0x3561,
+	    0x0000, 0x3e3a, 0x4bc0, 0x0000, 0x30c6, 0x0000, 0x0000, 0x2fc6,
+	    0x20bd, 0x31f4, 0x4b04, 0x0717, 0x0000, 0x0000, 0x0000, 0x1d68,
+	    0x0000, 0x0000, 0x0000, 0x0903, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x084e, 0x03fc, 0x0000, 0x225f, 0x0d19, 0x4bde,
+	    0x0ca5, 0x17dd, 0x1051, 0x3c8f, 0x07ae, 0x490f, 0x0000, 0x0000,
+	    0x0fed, 0x0000, 0x0000, 0x0000, 0x1bf8, 0x20bf, 0x0000, 0x14c8,
+	    0x0000, 0x37d1, 0x1710, 0x1499, 0x3d3d, 0x0000, 0x3b2f, 0x1fde,
+	    0x0000, 0x0000, 0x47c4, 0x0000, 0x0000, 0x0820, 0x3839, 0x0000,
+	    0x0000, 0x0000, 0x358a, 0x0000, 0x0000, 0x0000, 0x4b43, 0x3f01,
+	    0x0000, 0x0000, 0x0000, 0x2af7, 0x2ab3, 0x2f38, 0x0000, 0x1cd9,
+	    0x2064, 0x0000, 0x0000, 0x0630, 0x0000, 0x23c3, 0x0000, 0x228a,
+	    0x0000, 0x0000, 0x0000, 0x0426, 0x345b, 0x3d71, 0x0000, 0x245c,
+	    0x0000, 0x0000, 0x025c, 0x0000, 0x0000, 0x3402, 0x4c73, 0x34bc,
+	    0x0e25, 0x0000, 0x0000, 0x0ce0, 0x47ce, 0x2349, 0x1e11, 0x26cb,
+	    0x44d4, 0x31d8, 0x0000, 0x4899, 0x3620, 0x0000, 0x03ad, 0x271c,
+	    0x1ddb, 0x0000, 0x0000, 0x3f77, 0x122d, 0x0000, 0x0000, 0x3d16,
+	    0x0d57, 0x007e, 0x0000, 0x0000, 0x2c9b, 0x0000, 0x20ea, 0x4377,
+	    0x10d9, 0x340d, 0x090d, 0x1fae, 0x1d31, 0x1222, 0x0000, 0x4de0,
+	    0x07cb, 0x0b5e, 0x17ac, 0x05dc, 0x0000, 0x02d7, 0x0000, 0x0000,
+	    0x16ab, 0x0000, 0x38f9, 0x277b, 0x2c0e, 0x1a22, 0x0000, 0x0000,
+	    0x0000, 0x18b3, 0x242c, 0x1c62, 0x0000, 0x0000, 0x420b, 0x0000,
+	    0x305a, 0x3a3b, 0x19b0, 0x48fb, 0x12ba, 0x1b24, 0x0000, 0x12fa,
+	    0x20ee, 0x4b03, 0x0000, 0x308a, 0x0000, 0x4c82, 0x0000, 0x095b,
+	    0x0000, 0x483f, 0x20ff, 0x2df6, 0x0000, 0x16e8, 0x0000, 0x0000,
+	    0x0000, 0x3836, 0x0000, 0x33f4, 0x144f, 0x0b09, 0x1702, 0x1956,
+	    0x39b5, 0x19f3, 0x0000, 0x175e, 0x0f26, 0x0000, 0x48ee, 0x0000,
+	    0x0000, 0x0000, 0x0654, 0x2409, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1701, 0x19e5, 0x0000, 0x3769, 0x3352, 0x0000, 0x0000, 0x146a,
+	    0x4980, 0x4243, 0x18f2, 0x1295, 0x3846, 0x0000, 0x1227, 0x15ee,
+	    0x0000, 0x0e6e, 0x110d, 0x078b, 0x043c, 0x03f7, 0x0000, 0x0000,
+	    0x0000, 0x129d, 0x4939, 0x277b, 0x4111, 0x0000, 0x0000, 0x4dc7,
+	    0x33d4, 0x0000, 0x0000, 0x222d, 0x0d1b, 0x386e, 0x2c90, 0x26e6,
+	    0x0000, 0x0000, 0x0000, 0x0d0c, 0x32fe, 0x435c, 0x1068, 0x3cb1,
+	    0x4432, 0x330e, 0x3df0, 0x2331, 0x0000, 0x11d6, 0x13a4, 0x0000,
+	    0x2f8b, 0x2728, 0x2c29, 0x2b15, 0x0000, 0x4761, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3197, 0x0a5b, 0x2072,
+	    0x1153, 0x2363, 0x0000, 0x44a7, 0x0000, 0x0000, 0x200a, 0x4721,
+	    0x0000, 0x0047, 0x0000, 0x0448, 0x2296, 0x0000, 0x0000, 0x0000,
+	    0x2f4e, 0x0000, 0x46d0, 0x0000, 0x0000, 0x0199, 0x3d3d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16df, 0x3600, 0x2a7e,
+	    0x1978, 0x0000, 0x0000, 0x382b, 0x099b, 0x0000, 0x2bdd, 0x0000,
+	    0x44e9, 0x0000, 0x396f, 0x2d69, 0x0000, 0x460e, 0x0000, 0x0000,
+	    0x0000, 0x3864, 0x3f53, 0x0000, 0x3878, 0x2942, 0x0000, 0x09e8,
+	    0x48fd, 0x0000, 0x18c5, 0x0000, 0x2883, 0x0000, 0x428f, 0x3300,
+	    0x0000, 0x4df5, 0x0000, 0x3e12, 0x0154, 0x20ad, 0x1a51, 0x0d6e,
+	    0x3945, 0x0dc5, 0x3958, 0x05d1, 0x3eef, 0x052b, 0x3b30, 0x44c2,
+	    0x0c1f, 0x41f9, 0x400e, 0x17e8, 0x0000, 0x342b, 0x0000, 0x0000,
+	    0x0000, 0x03c2, 0x2338, 0x0845, 0x0000, 0x1cd9, 0x0000, 0x38e4,
+	    0x1742, 0x0de2, 0x4a37, 0x0000, 0x0000, 0x0000, 0x37b7, 0x054e,
+	    0x0000, 0x20c0, 0x3644, 0x0000, 0x0000, 0x0000, 0x02df, 0x0000,
+	    0x28f7, 0x0000, 0x0000, 0x4253, 0x3fa1, 0x0864, 0x0000, 0x0000,
+	    0x0000, 0x4a5a, 0x0000, 0x17c8, 0x0000, 0x07f0, 0x1c7e, 0x0000,
+	    0x01ef, 0x1d3e, 0x0000, 0x1223, 0x2ef9, 0x0000, 0x136c, 0x0000,
+	    0x0000, 0x3b24, 0x028c, 0x0ad9, 0x0000, 0x3d01, 0x36a6, 0x0000,
+	    0x202c, 0x1ddd, 0x0000, 0x0000, 0x0000, 0x0000, 0x3fe4, 0x1984,
+	    0x0898, 0x3faf, 0x0000, 0x16a5, 0x42a8, 0x0000, 0x2f66, 0x0000,
+	    0x074b, 0x0e95, 0x3671, 0x4bf5, 0x0000, 0x0000, 0x0000, 0x2312,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4319, 0x3085, 0x0000,
+	    0x12a0, 0x0000, 0x09c4, 0x0000, 0x00b9, 0x0000, 0x0000, 0x0000,
+	    0x4ca8, 0x2c92, 0x41db, 0x3c8f, 0x0000, 0x0000, 0x0000, 0x4a01,
+	    0x0000, 0x4b07, 0x01ff, 0x2583, 0x0000, 0x0000, 0x3f0a, 0x4bfc,
+	    0x3855, 0x0000, 0x0000, 0x1efc, 0x0000, 0x15d0, 0x472e, 0x0000,
+	    0x2059, 0x4229, 0x0000, 0x0000, 0x24e2, 0x055b, 0x0000, 0x4d74,
+	    0x3840, 0x0000, 0x23a8, 0x0000, 0x3b11, 0x2cb9, 0x067d, 0x3588,
+	    0x0000, 0x063b, 0x48e5, 0x3b1f, 0x2520, 0x0000, 0x0000, 0x303b,
+	    0x0940, 0x0000, 0x062f, 0x0000, 0x3abb, 0x0000, 0x0000, 0x0000,
+	    0x2a6f, 0x0fe4, 0x0ec0, 0x18b8, 0x0000, 0x0000, 0x18bc, 0x179c,
+	    0x0000, 0x2082, 0x397f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3ea7, 0x129a, 0x4aa0, 0x0419, 0x4852,
+	    0x0a2f, 0x1c82, 0x0000, 0x0f3b, 0x19e9, 0x0000, 0x0000, 0x22a5,
+	    0x0000, 0x056c, 0x359e, 0x0000, 0x10d4, 0x0000, 0x34bb, 0x35b9,
+	    0x0000, 0x0000, 0x168f, 0x0000, 0x29c9, 0x0000, 0x2e6c, 0x0000,
+	    0x401f, 0x44e5, 0x4316, 0x0000, 0x42ab, 0x0000, 0x296d, 0x3490,
+	    0x0000, 0x0000, 0x23d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dd9,
+	    0x00c5, 0x0000, 0x2523, 0x39e1, 0x0000, 0x0000, 0x0000, 0x1ac6,
+	    0x2445, 0x3d6b, 0x0000, 0x1fda, 0x30b0, 0x036e, 0x0000, 0x4a91,
+	    0x2212, 0x0000, 0x24dd, 0x21bd, 0x0000, 0x30c5, 0x0000, 0x0000,
+	    0x232c, 0x1fe9, 0x1307, 0x4a68, 0x0491, 0x0c27, 0x3a23, 0x1dc3,
+	    0x0000, 0x49b4, 0x3fa9, 0x4036, 0x466f, 0x4bf7, 0x0000, 0x0000,
+	    0x30f2, 0x0890, 0x1134, 0x0000, 0x0000, 0x0000, 0x3171, 0x351e,
+	    0x1fa6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0a78, 0x020b, 0x0000, 0x469e, 0x0000, 0x0000, 0x3bd3, 0x2313,
+	    0x3d96, 0x0000, 0x4160, 0x0ef5, 0x0000, 0x0000, 0x0000, 0x0632,
+	    0x0000, 0x0000, 0x0000, 0x4305, 0x0000, 0x0000, 0x0786, 0x030c,
+	    0x016f, 0x0000, 0x43f7, 0x0000, 0x4dde, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x26d0, 0x4cc6, 0x2e11, 0x0000, 0x0000, 0x0608, 0x4b1a,
+	    0x0000, 0x3064, 0x15c3, 0x0d14, 0x455d, 0x0000, 0x074c, 0x30d2,
+	    0x0000, 0x38ff, 0x03fb, 0x4c61, 0x0000, 0x2967, 0x0e8c, 0x2980,
+	    0x0c1b, 0x0000, 0x33e4, 0x24cd, 0x1eae, 0x13a9, 0x074b, 0x1af1,
+	    0x36cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x348d, 0x0000,
+	    0x0000, 0x0000, 0x43b6, 0x0000, 0x0000, 0x24d3, 0x0000, 0x0000,
+	    0x067e, 0x0000, 0x03f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x27c9,
+	    0x0000, 0x06e1, 0x0000, 0x2e55, 0x0000, 0x24a9, 0x0000, 0x336b,
+	    0x0000, 0x0000, 0x0844, 0x0e15, 0x1ec9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2c30, 0x2648, 0x0000, 0x1323, 0x0316,
+	    0x0000, 0x4af2, 0x0000, 0x2ec4, 0x2243, 0x0000, 0x1d06, 0x2bd1,
+	    0x0000, 0x04db, 0x16eb, 0x3f36, 0x251f, 0x0000, 0x3ce6, 0x3231,
+	    0x0000, 0x230d, 0x06ad, 0x0000, 0x1b7d, 0x1ca2, 0x0000, 0x29c3,
+	    0x29b4, 0x16fe, 0x1642, 0x2247, 0x0000, 0x0000, 0x3345, 0x38f2,
+	    0x37e1, 0x3f8b, 0x48ac, 0x06dc, 0x038b, 0x0303, 0x0000, 0x0000,
+	    0x4af3, 0x0000, 0x1932, 0x0b29, 0x0485, 0x3ff5, 0x0bb4, 0x30e9,
+	    0x0000, 0x0bdc, 0x3242, 0x0000, 0x39c3, 0x42c8, 0x0000, 0x350d,
+	    0x4a96, 0x1d22, 0x0000, 0x27f2, 0x0000, 0x3a31, 0x0000, 0x1e58,
+	    0x24e1, 0x0000, 0x1b14, 0x065d, 0x0000, 0x0000, 0x2fcc, 0x3fbe,
+	    0x0000, 0x3108, 0x0000, 0x0000, 0x3326, 0x245b, 0x3139, 0x09ea,
+	    0x0000, 0x387c, 0x3fdb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x45ed, 0x42e2, 0x2ccb, 0x3fee, 0x177a, 0x0000,
+	    0x3122, 0x338d, 0x0000, 0x0000, 0x2bce, 0x38aa, 0x0000, 0x0000,
+	    0x2aff, 0x0000, 0x2bc6, 0x0000, 0x18d6, 0x0000, 0x0000, 0x00bc,
+	    0x1502, 0x0be9, 0x044e, 0x0000, 0x0000, 0x00ca, 0x0000, 0x0000,
+	    0x0dbe, 0x3188, 0x0000, 0x0000, 0x0295, 0x279b, 0x1bf1, 0x1b63,
+	    0x102c, 0x0000, 0x3e78, 0x2a40, 0x4447, 0x2148, 0x2918, 0x3dd1,
+	    0x4ce0, 0x48b8, 0x4631, 0x0e73, 0x0000, 0x0000, 0x075f, 0x325b,
+	    0x0000, 0x1a57, 0x1738, 0x15c6, 0x134c, 0x244d, 0x2076, 0x0072,
+	    0x13c2, 0x4cf8, 0x0000, 0x0000, 0x0000, 0x26ba, 0x2cb2, 0x07cb,
+	    0x349a, 0x235f, 0x0000, 0x0000, 0x485d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1d59, 0x3198, 0x4320, 0x02e1, 0x0000, 0x3def, 0x0846,
+	    0x24dc, 0x10c1, 0x39e8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x135f, 0x2ba5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30d0,
+	    0x0000, 0x3056, 0x4882, 0x0000, 0x4c2f, 0x0000, 0x351a, 0x2cea,
+	    0x4971, 0x0000, 0x0f06, 0x2d9f, 0x0000, 0x0000, 0x2e88, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4917, 0x0000, 0x0000, 0x0000,
+	    0x2054, 0x0000, 0x3a08, 0x24eb, 0x0000, 0x283b, 0x4d7e, 0x22e7,
+	    0x0000, 0x110b, 0x375c, 0x3cc0, 0x0000, 0x0000, 0x1179, 0x2d14,
+	    0x15af, 0x4a51, 0x0000, 0x0000, 0x0000, 0x0095, 0x0000, 0x2780,
+	    0x4ce7, 0x2c57, 0x32cd, 0x100e, 0x0000, 0x2daa, 0x1988, 0x0000,
+	    0x1fc8, 0x0000, 0x2505, 0x31ab, 0x3130, 0x353b, 0x34ca, 0x161c,
+	    0x3762, 0x1c4b, 0x25c7, 0x4732, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x434a, 0x250c, 0x0000, 0x0000, 0x286f, 0x0c8e, 0x26e3, 0x0000,
+	    0x20a1, 0x380c, 0x01b5, 0x4df4, 0x0e12, 0x02f8, 0x2cca, 0x1cfe,
+	    0x3d9c, 0x4a06, 0x0000, 0x29eb, 0x0000, 0x0000, 0x1443, 0x0e5f,
+	    0x0000, 0x3562, 0x023e, 0x0000, 0x020b, 0x4c73, 0x0000, 0x0000,
+	    0x0000, 0x3e70, 0x0000, 0x33eb, 0x28ad, 0x3d3e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4b61, 0x1232, 0x0793, 0x0000, 0x0be9, 0x3f94,
+	    0x0000, 0x179c, 0x0000, 0x05c6, 0x0000, 0x0000, 0x415c, 0x0918,
+	    0x0000, 0x290d, 0x1021, 0x308b, 0x0000, 0x0000, 0x0c83, 0x25ef,
+	    0x3799, 0x0000, 0x1af5, 0x0000, 0x0000, 0x080e, 0x0000, 0x0000,
+	    0x12b5, 0x11cc, 0x48d9, 0x1116, 0x0000, 0x2cd2, 0x1d09, 0x4997,
+	    0x37e3, 0x2f4c, 0x38f9, 0x0000, 0x4012, 0x45cf, 0x03fd, 0x4afa,
+	    0x0000, 0x0000, 0x3e9b, 0x0000, 0x0fd5, 0x0000, 0x0000, 0x319c,
+	    0x47bd, 0x0000, 0x067e, 0x2873, 0x27d7, 0x04e7, 0x4194, 0x3cd7,
+	    0x228f, 0x4aa7, 0x4ce3, 0x3004, 0x0000, 0x41be, 0x0000, 0x1cc6,
+	    0x11e8, 0x33f4, 0x0000, 0x0000, 0x29f0, 0x1043, 0x0000, 0x17e7,
+	    0x0000, 0x2325, 0x07c3, 0x0000, 0x2800, 0x4c75, 0x2def, 0x0073,
+	    0x26b4, 0x35fe, 0x1b58, 0x062e, 0x4374, 0x187d, 0x0000, 0x0000,
+	    0x36ef, 0x0000, 0x0000, 0x29b6, 0x0c42, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0c34, 0x11c8, 0x019a, 0x4635, 0x0000, 0x3981,
+	    0x3de1, 0x2f96, 0x3c51, 0x4086, 0x0000, 0x3e77, 0x0000, 0x4753,
+	    0x1e78, 0x189b, 0x0000, 0x0000, 0x14b0, 0x4a0d, 0x0834, 0x0000,
+	    0x0000, 0x1d31, 0x1475, 0x4200, 0x0000, 0x0594, 0x0000, 0x0000,
+	    0x0000, 0x1aa7, 0x0000, 0x2ff9, 0x0000, 0x0ec7, 0x2468, 0x0603,
+	    0x0000, 0x0000, 0x48b4, 0x498b, 0x0000, 0x2fb3, 0x0000, 0x0000,
+	    0x2bcb, 0x08c9, 0x0000, 0x2ed0, 0x2d06, 0x0000, 0x2140, 0x2ef2,
+	    0x324c, 0x0000, 0x3686, 0x33e6, 0x08d6, 0x0000, 0x2ca4, 0x0000,
+	    0x4887, 0x0000, 0x0000, 0x2192, 0x1219, 0x0000, 0x0000, 0x1550,
+	    0x0000, 0x38da, 0x3c80, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x39ae, 0x0000, 0x0000, 0x0000, 0x0895, 0x1e80, 0x10ef, 0x0000,
+	    0x0000, 0x23db, 0x0000, 0x279a, 0x2e81, 0x086b, 0x0000, 0x0351,
+	    0x0000, 0x340f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4963,
+	    0x0b82, 0x0000, 0x08ad, 0x0000, 0x000c, 0x350d, 0x0000, 0x2c3b,
+	    0x0000, 0x385b, 0x401e, 0x0000, 0x0000, 0x0000, 0x0000, 0x1584,
+	    0x0f69, 0x102e, 0x0000, 0x19a3, 0x4bd5, 0x0000, 0x0000, 0x061d,
+	    0x1daf, 0x0741, 0x0000, 0x0000, 0x0000, 0x3887, 0x0aee, 0x0714,
+	    0x2688, 0x357f, 0x422e, 0x0000, 0x0000, 0x2058, 0x0000, 0x0000,
+	    0x0000, 0x4a3a, 0x22e8, 0x324d, 0x40ba, 0x30ee, 0x0000, 0x2c11,
+	    0x408e, 0x0e32, 0x0000, 0x1ddd, 0x0000, 0x448e, 0x2cf2, 0x1d70,
+	    0x194a, 0x0000, 0x48c1, 0x006b, 0x375f, 0x2963, 0x0253, 0x45db,
+	    0x0000, 0x366b, 0x3130, 0x1c02, 0x0000, 0x426c, 0x0000, 0x0000,
+	    0x0b50, 0x0000, 0x26ad, 0x0000, 0x125e, 0x28fa, 0x0000, 0x0b0c,
+	    0x0000, 0x3e0d, 0x219f, 0x3d5e, 0x372a, 0x0000, 0x3a16, 0x0000,
+	    0x315f, 0x0000, 0x0000, 0x1365, 0x3966, 0x4366, 0x0000, 0x1778,
+	    0x0000, 0x335d, 0x1f28, 0x1122, 0x0efd, 0x0000, 0x0a7c, 0x49f3,
+	    0x0000, 0x293e, 0x0000, 0x0000, 0x3bac, 0x0000, 0x0000, 0x0000,
+	    0x2f3c, 0x2025, 0x36ec, 0x4300, 0x0000, 0x3e88, 0x2a39, 0x0000,
+	    0x09bc, 0x43bf, 0x0f48, 0x1284, 0x0000, 0x0000, 0x0000, 0x2bbc,
+	    0x0000, 0x40d7, 0x0000, 0x0000, 0x34a5, 0x2b88, 0x043c, 0x47eb,
+	    0x3d63, 0x0000, 0x2264, 0x0000, 0x0000, 0x0fcb, 0x1229, 0x3f11,
+	    0x1340, 0x2e41, 0x3be2, 0x0fa9, 0x0000, 0x0000, 0x4104, 0x0f92,
+	    0x1c3e, 0x0000, 0x33ed, 0x1acb, 0x21ce, 0x0c8f, 0x0000, 0x2a38,
+	    0x0000, 0x0000, 0x0f9a, 0x1209, 0x41b2, 0x0000, 0x0000, 0x3730,
+	    0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a0f, 0x35ee, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1b56, 0x4551, 0x0859, 0x0000, 0x0000,
+	    0x3084, 0x0000, 0x1559, 0x0dea, 0x2325, 0x0000, 0x0000, 0x0000,
+	    0x2678, 0x14f2, 0x2800, 0x0000, 0x0000, 0x0000, 0x0000, 0x258a,
+	    0x0000, 0x3d9d, 0x0000, 0x2210, 0x246e, 0x0000, 0x0000, 0x1e53,
+	    0x0000, 0x0000, 0x1b4e, 0x483e, 0x49ec, 0x0000, 0x0000, 0x36ed,
+	    0x0000, 0x046a, 0x32a7, 0x393f, 0x19e7, 0x0000, 0x0625, 0x0000,
+	    0x27f6, 0x3d1a, 0x0000, 0x1f1c, 0x363f, 0x49c4, 0x0000, 0x25f2,
+	    0x0000, 0x2702, 0x0000, 0x42ab, 0x0000, 0x368d, 0x0000, 0x2747,
+	    0x0000, 0x0000, 0x2898, 0x4da6, 0x37b1, 0x00db, 0x016e, 0x4427,
+	    0x0000, 0x0f1f, 0x482e, 0x0000, 0x0000, 0x0000, 0x089c, 0x0000,
+	    0x3699, 0x06b5, 0x0000, 0x2621, 0x1b36, 0x0000, 0x2b4a, 0x0000,
+	    0x1a17, 0x1afc, 0x1409, 0x4da8, 0x1c6f, 0x362b, 0x0449, 0x472a,
+	    0x23e0, 0x0000, 0x2a8e, 0x0000, 0x0000, 0x0000, 0x244b, 0x0000,
+	    0x047c, 0x0000, 0x227d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0b27, 0x0000, 0x0000, 0x0000, 0x272f, 0x0000, 0x2026,
+	    0x0000, 0x2432, 0x1a2a, 0x08f9, 0x20b7, 0x0000, 0x099c, 0x02b6,
+	    0x0000, 0x0000, 0x0000, 0x125a, 0x28b0, 0x0000, 0x0000, 0x3a27,
+	    0x038d, 0x0000, 0x0000, 0x0000, 0x0000, 0x3de2, 0x0c7d, 0x4489,
+	    0x0000, 0x0752, 0x337b, 0x0000, 0x07c8, 0x0000, 0x0000, 0x0000,
+	    0x3b76, 0x0000, 0x0000, 0x3296, 0x3337, 0x2bdd, 0x0000, 0x3ba9,
+	    0x0000, 0x4b5d, 0x0000, 0x026d, 0x0000, 0x0000, 0x14e6, 0x0000,
+	    0x0000, 0x0000, 0x01d7, 0x104c, 0x18c2, 0x27a1, 0x1434, 0x45a4,
+	    0x327f, 0x0731, 0x0000, 0x0000, 0x0000, 0x1b38, 0x0661, 0x0000,
+	    0x0000, 0x0457, 0x47ea, 0x0000, 0x3c65, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2a78, 0x4212, 0x457f, 0x0000, 0x1dda, 0x30de,
+	    0x0000, 0x2d4d, 0x0000, 0x2fc6, 0x0000, 0x0000, 0x0000, 0x28f7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x488e, 0x319e, 0x1f61, 0x0000,
+	    0x0469, 0x2016, 0x0000, 0x0000, 0x0000, 0x2ada, 0x2e3f, 0x002b,
+	    0x0000, 0x3f85, 0x0050, 0x1efb, 0x0000, 0x090c, 0x0836, 0x1a08,
+	    0x1e78, 0x224b, 0x0000, 0x4cb7, 0x0cbd, 0x0000, 0x39a8, 0x0000,
+	    0x08e0, 0x3112, 0x42d4, 0x4283, 0x4dc2, 0x0000, 0x0000, 0x1416,
+	    0x0000, 0x27d4, 0x0840, 0x0000, 0x23d2, 0x0000, 0x0000, 0x0000,
+	    0x0add, 0x0000, 0x025f, 0x14ea, 0x0000, 0x0000, 0x0000, 0x0081,
+	    0x17e0, 0x0000, 0x0000, 0x0000, 0x2577, 0x0000, 0x252b, 0x0000,
+	    0x229b, 0x23c7, 0x0000, 0x277e, 0x0c89, 0x0000, 0x0000, 0x0eb3,
+	    0x0d05, 0x0000, 0x0000, 0x4530, 0x0000, 0x4ac5, 0x0000, 0x49c4,
+	    0x2127, 0x44aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b2b, 0x2c7c,
+	    0x0000, 0x4af5, 0x0000, 0x0b0a, 0x420a, 0x0000, 0x0000, 0x220c,
+	    0x0000, 0x0000, 0x4d39, 0x3ec8, 0x2cdb, 0x4ba5, 0x00df, 0x0000,
+	    0x0c25, 0x0000, 0x31d5, 0x0aaf, 0x0000, 0x2fa9, 0x0580, 0x0000,
+	    0x21a3, 0x0000, 0x231e, 0x4465, 0x0000, 0x0000, 0x2d9c, 0x3203,
+	    0x0000, 0x1549, 0x4611, 0x4488, 0x192b, 0x1e62, 0x0000, 0x0000,
+	    0x457c, 0x0000, 0x20af, 0x21de, 0x23b6, 0x35f6, 0x12f4, 0x217a,
+	    0x30b9, 0x0000, 0x2e31, 0x3ada, 0x0000, 0x256d, 0x0000, 0x024c,
+	    0x03bd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42c4,
+	    0x0000, 0x2034, 0x427b, 0x0000, 0x1285, 0x0000, 0x4a1c, 0x0000,
+	    0x0000, 0x2921, 0x0000, 0x1a64, 0x0000, 0x1140, 0x0000, 0x1162,
+	    0x0000, 0x2246, 0x0745, 0x0000, 0x0000, 0x0000, 0x03d2, 0x2de8,
+	    0x2429, 0x0000, 0x0000, 0x0000, 0x1711, 0x38e9, 0x0000, 0x0000,
+	    0x0484, 0x340c, 0x1f91, 0x0000, 0x1472, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x09cb, 0x0d04, 0x0000, 0x3bf1, 0x0000, 0x25a2,
+	    0x0000, 0x0000, 0x1852, 0x0f02, 0x3ad3, 0x08d5, 0x0000, 0x0000,
+	    0x4b50, 0x0000, 0x0000, 0x0000, 0x1fdb, 0x0000, 0x321a, 0x094b,
+	    0x0000, 0x1230, 0x374a, 0x0000, 0x18c1, 0x2afe, 0x21f8, 0x0000,
+	    0x363b, 0x1a50, 0x091f, 0x0000, 0x0000, 0x0000, 0x0f58, 0x0000,
+	    0x34a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0deb, 0x0000, 0x0000, 0x3c29, 0x2523, 0x455d, 0x255d,
+	    0x49f1, 0x11a2, 0x0000, 0x3e6a, 0x0d7f, 0x2e57, 0x0000, 0x0000,
+	    0x38d8, 0x474b, 0x4965, 0x0000, 0x0424, 0x0000, 0x0000, 0x2f54,
+	    0x1ddf, 0x2b7c, 0x12e6, 0x1e65, 0x3ccd, 0x0000, 0x1a01, 0x0000,
+	    0x3ecb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e6b, 0x0000,
+	    0x20db, 0x0000, 0x0000, 0x0000, 0x26c5, 0x10d2, 0x1d89, 0x15ee,
+	    0x0000, 0x39d1, 0x362d, 0x3e8b, 0x166b, 0x0000, 0x4d7e, 0x0000,
+	    0x05f5, 0x0161, 0x0000, 0x2d10, 0x3533, 0x0000, 0x091f, 0x473c,
+	    0x0000, 0x201d, 0x025c, 0x1b30, 0x0262, 0x0000, 0x1f5d, 0x4845,
+	    0x27ac, 0x3e88, 0x3224, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3134, 0x0000, 0x0000, 0x2f07, 0x0000, 0x38f0, 0x0000, 0x09e8,
+	    0x0312, 0x316b, 0x4936, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x07e7, 0x0000, 0x06b4, 0x0000, 0x0000, 0x0000, 0x1f55, 0x1785,
+	    0x3ddd, 0x0000, 0x4a50, 0x0000, 0x0a79, 0x41a6, 0x2ddf, 0x203e,
+	    0x3c64, 0x1123, 0x0233, 0x0000, 0x4581, 0x12a9, 0x36c0, 0x0000,
+	    0x0000, 0x1ceb, 0x243e, 0x1a14, 0x02bf, 0x0000, 0x097a, 0x12eb,
+	    0x0000, 0x37c7, 0x0000, 0x0000, 0x4979, 0x29e3, 0x0000, 0x215d,
+	    0x0000, 0x3696, 0x0000, 0x4716, 0x0ff0, 0x2429, 0x0000, 0x00a5,
+	    0x0000, 0x0000, 0x3102, 0x2b71, 0x3aee, 0x0afe, 0x18f6, 0x4423,
+	    0x0000, 0x32a0, 0x0000, 0x0000, 0x0020, 0x41b6, 0x0000, 0x38ae,
+	    0x0000, 0x4b57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e59, 0x0000,
+	    0x2b00, 0x0000, 0x0000, 0x0000, 0x463d, 0x4aff, 0x1926, 0x0000,
+	    0x0000, 0x2616, 0x122e, 0x4901, 0x4c52, 0x0000, 0x0000, 0x0000,
+	    0x2293, 0x0000, 0x3b15, 0x2ba4, 0x0820, 0x44af, 0x0fa9, 0x4383,
+	    0x0000, 0x0000, 0x0000, 0x4892, 0x0000, 0x0000, 0x0000, 0x1826,
+	    0x422d, 0x17d4, 0x2cac, 0x1b47, 0x3433, 0x2085, 0x0913, 0x2f4a,
+	    0x205c, 0x0000, 0x454e, 0x0000, 0x0000, 0x0000, 0x3797, 0x29fc,
+	    0x4bbc, 0x0000, 0x20c9, 0x02f5, 0x2b05, 0x1ca0, 0x0000, 0x387c,
+	    0x0000, 0x4793, 0x0705, 0x339d, 0x3359, 0x0000, 0x0616, 0x0000,
+	    0x0000, 0x4a8d, 0x32d8, 0x3e1c, 0x0000, 0x0000, 0x4ba4, 0x3052,
+	    0x3bd8, 0x0000, 0x3b58, 0x0000, 0x05f0, 0x0fc8, 0x0000, 0x42b0,
+	    0x0000, 0x49a9, 0x3389, 0x0000, 0x1e43, 0x106e, 0x0000, 0x0985,
+	    0x35c3, 0x0000, 0x147d, 0x14f0, 0x0000, 0x29aa, 0x105e, 0x0000,
+	    0x0000, 0x3fbb, 0x35dc, 0x0a2f, 0x3165, 0x0000, 0x0ac4, 0x3fbc,
+	    0x4d78, 0x0000, 0x36df, 0x41c4, 0x0000, 0x024c, 0x0000, 0x4208,
+	    0x0000, 0x0820, 0x4b2d, 0x0000, 0x1274, 0x1ff5, 0x3971, 0x45a9,
+	    0x1ca8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26b6,
+	    0x286f, 0x07d3, 0x2129, 0x42e7, 0x0000, 0x3cdb, 0x2aee, 0x0000,
+	    0x0000, 0x2a47, 0x47c4, 0x4508, 0x2aee, 0x0000, 0x0000, 0x2f71,
+	    0x0943, 0x0000, 0x0b34, 0x476b, 0x0e97, 0x2337, 0x16d8, 0x2227,
+	    0x0000, 0x418e, 0x4c08, 0x266b, 0x4581, 0x4652, 0x0000, 0x0000,
+	    0x0393, 0x0f71, 0x0000, 0x0df8, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x49ac, 0x0000, 0x4d09, 0x0000, 0x06d4, 0x3da1, 0x0000, 0x2bfb,
+	    0x0000, 0x0000, 0x292c, 0x47c7, 0x169c, 0x0000, 0x0000, 0x0000,
+	    0x105f, 0x1dcc, 0x0000, 0x0000, 0x0a0b, 0x0000, 0x056a, 0x0000,
+	    0x4721, 0x00c1, 0x18e5, 0x18f6, 0x4ca2, 0x14a8, 0x45f4, 0x3c18,
+	    0x0000, 0x073b, 0x1c31, 0x0000, 0x0000, 0x31e3, 0x0000, 0x27fd,
+	    0x0000, 0x1759, 0x381e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x25d2, 0x0000, 0x0000, 0x13ad, 0x0b7f, 0x2636, 0x4451, 0x1b9e,
+	    0x01fa, 0x4af0, 0x0000, 0x0000, 0x283e, 0x0000, 0x0000, 0x0000,
+	    0x4170, 0x0000, 0x2f00, 0x4d40, 0x07a0, 0x0000, 0x0000, 0x3502,
+	    0x03ff, 0x0000, 0x2a42, 0x0000, 0x0000, 0x3581, 0x0000, 0x0000,
+	    0x0000, 0x318a, 0x0764, 0x459b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0833, 0x0000, 0x187e, 0x2452, 0x0000, 0x0000, 0x0000,
+	    0x1265, 0x4381, 0x2754, 0x2ca0, 0x0000, 0x3711, 0x45bf, 0x2edf,
+	    0x0000, 0x0000, 0x240e, 0x009a, 0x0f3f, 0x0612, 0x17df, 0x11f7,
+	    0x1a04, 0x4171, 0x25e8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0790,
+	    0x0ca6, 0x0000, 0x0000, 0x1592, 0x19a9, 0x4c2b, 0x27ac, 0x2e68,
+	    0x05fe, 0x0000, 0x4d30, 0x44a8, 0x1ca1, 0x0000, 0x0801, 0x060b,
+	    0x0000, 0x0000, 0x4d2e, 0x1324, 0x0000, 0x0000, 0x4071, 0x25ac,
+	    0x0000, 0x1e6b, 0x0d9a, 0x0000, 0x0000, 0x0000, 0x32b8, 0x0000,
+	    0x23d3, 0x0000, 0x0000, 0x196e, 0x1a22, 0x0000, 0x0000, 0x07e0,
+	    0x02c7, 0x0000, 0x28ab, 0x28e0, 0x0000, 0x3788, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2383, 0x3003, 0x0000, 0x0000, 0x0000,
+	    0x48e9, 0x298f, 0x387c, 0x3819, 0x18bb, 0x4a5f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4bcc, 0x0000, 0x0000, 0x06aa, 0x3eac,
+	    0x3b6a, 0x01f2, 0x12a7, 0x05a4, 0x2faf, 0x2184, 0x0000, 0x0000,
+	    0x32f5, 0x17f4, 0x0000, 0x4038, 0x124d, 0x0000, 0x3273, 0x0000,
+	    0x0000, 0x0e7b, 0x0f79, 0x49ed, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x45d3, 0x0980, 0x0000, 0x31a6, 0x3c20, 0x0000, 0x4b3f,
+	    0x0000, 0x411b, 0x34a9, 0x2415, 0x0000, 0x0000, 0x0000, 0x204d,
+	    0x2a4e, 0x0000, 0x0000, 0x2ff5, 0x0000, 0x0000, 0x369f, 0x0000,
+	    0x1a9b, 0x1dd9, 0x0000, 0x01f0, 0x0000, 0x0000, 0x0000, 0x0d7b,
+	    0x0000, 0x1ea7, 0x2672, 0x289f, 0x4b17, 0x2d51, 0x0000, 0x117d,
+	    0x1445, 0x1cae, 0x0b3f, 0x0000, 0x083a, 0x2687, 0x2acf, 0x2d12,
+	    0x0000, 0x3431, 0x055e, 0x0000, 0x0000, 0x32e1, 0x0000, 0x0000,
+	    0x4d25, 0x2dc0, 0x0859, 0x0000, 0x2743, 0x22a4, 0x3902, 0x1584,
+	    0x0000, 0x0000, 0x16c3, 0x0000, 0x4d7c, 0x0c67, 0x38c3, 0x037b,
+	    0x466e, 0x0000, 0x15f7, 0x3c43, 0x2657, 0x3938, 0x4535, 0x2a04,
+	    0x2b31, 0x0000, 0x4311, 0x0000, 0x0000, 0x28e9, 0x0000, 0x21ef,
+	    0x3c6c, 0x0000, 0x0000, 0x0000, 0x0000, 0x3dcb, 0x0000, 0x0000,
+	    0x0000, 0x1fd2, 0x0000, 0x1543, 0x0000, 0x3c7a, 0x0000, 0x4cc2,
+	    0x35ed, 0x0000, 0x0b75, 0x0000, 0x0000, 0x42fa, 0x1677, 0x3228,
+	    0x0a1a, 0x0000, 0x2ee6, 0x0000, 0x0000, 0x2b24, 0x01f2, 0x4c34,
+	    0x05fb, 0x2ca9, 0x4a68, 0x0000, 0x0196, 0x066e, 0x0000, 0x36e8,
+	    0x0000, 0x0000, 0x2a7a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4df7, 0x426f, 0x256e, 0x0000, 0x0000, 0x4aeb, 0x0060,
+	    0x47a7, 0x0000, 0x0729, 0x12a9, 0x32a8, 0x1d79, 0x2b0b, 0x37a4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x170c, 0x0e90,
+	    0x3aca, 0x2067, 0x457e, 0x0b83, 0x0000, 0x42bd, 0x0000, 0x0000,
+	    0x007c, 0x0000, 0x0000, 0x0026, 0x381e, 0x199e, 0x0000, 0x0000,
+	    0x0000, 0x3a4b, 0x1331, 0x17b4, 0x0858, 0x0000, 0x32cf, 0x0000,
+	    0x2986, 0x0000, 0x0890, 0x4189, 0x185e, 0x2e10, 0x0000, 0x2d34,
+	    0x00da, 0x4317, 0x436e, 0x0000, 0x0000, 0x0519, 0x11e0, 0x0aeb,
+	    0x0000, 0x0000, 0x4c33, 0x0ae5, 0x0000, 0x0000, 0x0000, 0x15a0,
+	    0x0000, 0x4c21, 0x26cc, 0x127a, 0x3f24, 0x4661, 0x12d8, 0x0000,
+	    0x0000, 0x44cc, 0x386e, 0x0000, 0x08db, 0x09e7, 0x38f7, 0x0000,
+	    0x22a4, 0x0000, 0x48ed, 0x2bcb, 0x0000, 0x0000, 0x0000, 0x2444,
+	    0x0000, 0x4459, 0x17d4, 0x257c, 0x1c9d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x475f, 0x4d8b, 0x0000, 0x0a85, 0x0000, 0x0000,
+	    0x1a8a, 0x08c4, 0x0000, 0x2e1d, 0x4d8c, 0x0000, 0x3bc6, 0x334a,
+	    0x3c8a, 0x0000, 0x0000, 0x0000, 0x478c, 0x0000, 0x0000, 0x462d,
+	    0x0000, 0x1da3, 0x0000, 0x0000, 0x1bf2, 0x3e01, 0x25c4, 0x0000,
+	    0x0000, 0x104b, 0x0000, 0x1ebf, 0x1f4b, 0x2622, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2901, 0x0000, 0x0000, 0x3deb, 0x0f05, 0x220a,
+	    0x309c, 0x45ed, 0x3a87, 0x2e15, 0x0000, 0x10af, 0x1e9c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0160, 0x21fe, 0x06fb, 0x0000, 0x0000,
+	    0x02fa, 0x0000, 0x0000, 0x0000, 0x3f84, 0x0afb, 0x0000, 0x4882,
+	    0x0000, 0x0000, 0x21a4, 0x334a, 0x4287, 0x03b1, 0x14d9, 0x4476,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2882, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x05a3, 0x4270, 0x143e, 0x3a2b,
+	    0x0000, 0x0000, 0x0000, 0x1d68, 0x49a0, 0x0b4e, 0x0000, 0x0000,
+	    0x0000, 0x4221, 0x13eb, 0x4803, 0x09d7, 0x2b85, 0x0000, 0x0769,
+	    0x2f51, 0x47ba, 0x0000, 0x0000, 0x1ec1, 0x0000, 0x460e, 0x20b3,
+	    0x2101, 0x039d, 0x07d7, 0x0bf8, 0x0c88, 0x0000, 0x2b7e, 0x331b,
+	    0x0000, 0x0000, 0x3da2, 0x0fe1, 0x1d5a, 0x0000, 0x03c4, 0x0000,
+	    0x0000, 0x40fe, 0x36c2, 0x22ac, 0x4180, 0x0c22, 0x0000, 0x35ed,
+	    0x41f5, 0x35eb, 0x0000, 0x2d1e, 0x42f9, 0x4457, 0x20d3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x32f4, 0x0b00, 0x2410, 0x0000,
+	    0x0000, 0x3c69, 0x26cc, 0x3398, 0x4c53, 0x3e97, 0x1847, 0x37c3,
+	    0x0000, 0x3231, 0x0000, 0x4b21, 0x48c3, 0x0000, 0x0000, 0x4200,
+	    0x1504, 0x2906, 0x1ec3, 0x32fa, 0x0000, 0x0367, 0x0000, 0x0000,
+	    0x0000, 0x2189, 0x16b5, 0x0000, 0x0000, 0x0000, 0x2a12, 0x0000,
+	    0x0ada, 0x2b48, 0x0000, 0x0000, 0x3429, 0x0000, 0x0000, 0x299a,
+	    0x0000, 0x48da, 0x119d, 0x4d6c, 0x0000, 0x1ab1, 0x4886, 0x3746,
+	    0x0000, 0x0000, 0x2591, 0x0000, 0x489b, 0x0000, 0x4c73, 0x11a0,
+	    0x0000, 0x1053, 0x2b5a, 0x0000, 0x22e0, 0x4b8f, 0x0000, 0x0000,
+	    0x0ffa, 0x1731, 0x3642, 0x44d4, 0x40af, 0x0000, 0x4770, 0x0000,
+	    0x06c6, 0x1379, 0x0000, 0x2e8f, 0x131f, 0x356e, 0x0000, 0x0000,
+	    0x2588, 0x4cde, 0x26b4, 0x0000, 0x4650, 0x0000, 0x0664, 0x0000,
+	    0x0000, 0x470b, 0x03f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2f27, 0x0821, 0x0000, 0x0000, 0x089a, 0x0000, 0x2930, 0x0000,
+	    0x3ac1, 0x0000, 0x212b, 0x0000, 0x175c, 0x2154, 0x0000, 0x0534,
+	    0x2716, 0x0000, 0x0000, 0x1ebd, 0x0000, 0x1f9c, 0x0000, 0x414a,
+	    0x484c, 0x0000, 0x3ddf, 0x0000, 0x1a68, 0x0000, 0x0000, 0x21cf,
+	    0x0000, 0x0000, 0x4694, 0x2bc8, 0x0000, 0x1e73, 0x2f4b, 0x0f5f,
+	    0x1fe4, 0x20c1, 0x0000, 0x0000, 0x318d, 0x0000, 0x0c01, 0x4602,
+	    0x0000, 0x0000, 0x0000, 0x3f9b, 0x0000, 0x2d53, 0x0000, 0x0563,
+	    0x0224, 0x0000, 0x0000, 0x4c00, 0x0000, 0x167f, 0x0000, 0x0000,
+	    0x1533, 0x0000, 0x0000, 0x4b78, 0x0000, 0x3932, 0x229a, 0x3aba,
+	    0x0000, 0x419d, 0x0000, 0x0000, 0x45f5, 0x279b, 0x0000, 0x1436,
+	    0x385b, 0x0000, 0x0000, 0x0000, 0x2f62, 0x29bf, 0x15e9, 0x03df,
+	    0x0000, 0x177d, 0x0000, 0x0e5a, 0x0aa0, 0x32e7, 0x1795, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4c91, 0x0000, 0x0000, 0x0000,
+	    0x226e, 0x2dbe, 0x0000, 0x0000, 0x141a, 0x1680, 0x291c, 0x17cc,
+	    0x213e, 0x0000, 0x0000, 0x46d7, 0x0000, 0x2591, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3351, 0x24cd, 0x0000, 0x1d25, 0x237c, 0x26ab,
+	    0x0000, 0x202b, 0x1708, 0x210a, 0x0000, 0x1c8a, 0x0000, 0x1497,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x051e,
+	    0x3d2e, 0x0000, 0x0000, 0x365b, 0x0000, 0x27c4, 0x20f7, 0x03df,
+	    0x3eaf, 0x055e, 0x0000, 0x0000, 0x0000, 0x0000, 0x4674, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x35a6, 0x0000, 0x0000, 0x1263, 0x00e3,
+	    0x40be, 0x4372, 0x2f67, 0x2906, 0x0000, 0x159b, 0x3458, 0x17aa,
+	    0x0000, 0x0000, 0x0000, 0x1450, 0x111b, 0x4584, 0x16b5, 0x0000,
+	    0x2be2, 0x2a5e, 0x4c2b, 0x1048, 0x188a, 0x07ec, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x07bf, 0x1959, 0x0000, 0x4074, 0x001e, 0x0157,
+	    0x0000, 0x4795, 0x0000, 0x2db3, 0x2fab, 0x2a9e, 0x0722, 0x0000,
+	    0x22d9, 0x0000, 0x06fd, 0x1da7, 0x16bd, 0x32b5, 0x3cf4, 0x0000,
+	    0x24cc, 0x0000, 0x443f, 0x0000, 0x0000, 0x0000, 0x29c1, 0x3b62,
+	    0x314b, 0x0000, 0x1079, 0x0000, 0x2f1a, 0x0000, 0x42c3, 0x0000,
+	    0x34da, 0x0000, 0x0ed2, 0x2362, 0x0c7d, 0x1510, 0x0000, 0x35fa,
+	    0x0d09, 0x1f34, 0x21eb, 0x3d48, 0x0e23, 0x0000, 0x2bb7, 0x07c9,
+	    0x0000, 0x325b, 0x0000, 0x44fb, 0x3a19, 0x178e, 0x0000, 0x0000,
+	    0x4b09, 0x1faf, 0x0000, 0x0000, 0x3d12, 0x0499, 0x3b56, 0x0000,
+	    0x0000, 0x0000, 0x1174, 0x0000, 0x0000, 0x0000, 0x0000, 0x14de,
+	    0x335e, 0x0000, 0x1a1f, 0x1f14, 0x0000, 0x28af, 0x0000, 0x2a50,
+	    0x0000, 0x3cf7, 0x0000, 0x1295, 0x0000, 0x0000, 0x2794, 0x0000,
+	    0x0934, 0x4353, 0x19aa, 0x4b69, 0x0000, 0x2057, 0x0000, 0x0000,
+	    0x3f7d, 0x0000, 0x2d47, 0x0000, 0x0000, 0x0000, 0x4670, 0x0000,
+	    0x0000, 0x1fa6, 0x07a5, 0x0000, 0x0000, 0x35ae, 0x0d7a, 0x0230,
+	    0x4a82, 0x0000, 0x2294, 0x2da8, 0x0000, 0x4bfb, 0x1876, 0x1209,
+	    0x42ca, 0x3b48, 0x0f09, 0x199b, 0x0995, 0x055d, 0x0000, 0x3b5b,
+	    0x0000, 0x36cb, 0x4265, 0x12b2, 0x0000, 0x3671, 0x123b, 0x3ec6,
+	    0x01d7, 0x0000, 0x440d, 0x1447, 0x0786, 0x0000, 0x2380, 0x39ed,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x361f, 0x0000, 0x2f1a, 0x0be6,
+	    0x3b62, 0x33fa, 0x0000, 0x2b79, 0x4a63, 0x302d, 0x0000, 0x3589,
+	    0x016f, 0x4216, 0x0c5d, 0x2900, 0x402b, 0x102c, 0x2d88, 0x0000,
+	    0x4563, 0x020d, 0x0c45, 0x19f5, 0x0000, 0x059e, 0x3146, 0x10e6,
+	    0x43ff, 0x2cd4, 0x0000, 0x0000, 0x0000, 0x2925, 0x2e2a, 0x0000,
+	    0x1db5, 0x0000, 0x0000, 0x156e, 0x0ec5, 0x2bcd, 0x477a, 0x0000,
+	    0x0000, 0x01f4, 0x0000, 0x02ae, 0x2c56, 0x1b64, 0x27a7, 0x0000,
+	    0x3ef1, 0x1336, 0x0912, 0x0000, 0x32a9, 0x0000, 0x0000, 0x0000,
+	    0x203f, 0x0ff3, 0x0714, 0x4832, 0x0000, 0x27d8, 0x0000, 0x0000,
+	    0x0000, 0x42ab, 0x0000, 0x29e1, 0x4b10, 0x1ad1, 0x0000, 0x0000,
+	    0x025a, 0x0000, 0x0000, 0x23fb, 0x4366, 0x0c65, 0x09fd, 0x0000,
+	    0x0eb3, 0x4842, 0x0000, 0x2105, 0x171c, 0x11ab, 0x0000, 0x0000,
+	    0x0000, 0x4ca5, 0x2cd5, 0x0000, 0x0f50, 0x126a, 0x0208, 0x0000,
+	    0x3e0b, 0x0000, 0x0000, 0x3915, 0x35d0, 0x0000, 0x0000, 0x0000,
+	    0x2271, 0x31cc, 0x14f5, 0x1612, 0x18ec, 0x0000, 0x0000, 0x0000,
+	    0x1126, 0x25a7, 0x07e1, 0x28d8, 0x0000, 0x4995, 0x0000, 0x2325,
+	    0x0000, 0x3306, 0x17f1, 0x1dcf, 0x0d73, 0x0000, 0x0000, 0x3292,
+	    0x2e64, 0x1ea1, 0x0000, 0x0b6b, 0x1771, 0x14ec, 0x0000, 0x05d5,
+	    0x3e87, 0x1a80, 0x0000, 0x0000, 0x08c3, 0x4688, 0x4da7, 0x0000,
+	    0x4128, 0x0000, 0x0000, 0x2b08, 0x3da6, 0x45f2, 0x0000, 0x4db0,
+	    0x4743, 0x18ba, 0x0000, 0x0000, 0x1869, 0x02e3, 0x3fa4, 0x0000,
+	    0x0000, 0x0000, 0x0eb3, 0x08ff, 0x0459, 0x2482, 0x189e, 0x0525,
+	    0x0000, 0x0000, 0x0000, 0x0b9a, 0x4195, 0x0000, 0x0000, 0x0474,
+	    0x0338, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4d4e, 0x2313, 0x0683, 0x2837, 0x2792, 0x2346, 0x0000,
+	    0x3eee, 0x0c15, 0x1744, 0x1a90, 0x1c32, 0x229f, 0x0000, 0x0000,
+	    0x1b31, 0x00f6, 0x420a, 0x2957, 0x0000, 0x3448, 0x49ec, 0x0000,
+	    0x4b4f, 0x0b3a, 0x0000, 0x25fb, 0x0000, 0x3913, 0x4754, 0x34c5,
+	    0x4bb4, 0x21ab, 0x0000, 0x0000, 0x3c01, 0x0000, 0x0000, 0x0000,
+	    0x1eda, 0x18a3, 0x0000, 0x0000, 0x03f9, 0x0000, 0x0302, 0x3317,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0d04, 0x0000, 0x0fed, 0x1504,
+	    0x0000, 0x0000, 0x05fa, 0x25be, 0x26eb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x38e0, 0x140a, 0x0000, 0x3030, 0x087e, 0x0000,
+	    0x0000, 0x3350, 0x0000, 0x2483, 0x0000, 0x279d, 0x049e, 0x0755,
+	    0x00b7, 0x0000, 0x10b5, 0x19d6, 0x0000, 0x0000, 0x06f6, 0x3ea5,
+	    0x0000, 0x1738, 0x0ce2, 0x0000, 0x2c0f, 0x0000, 0x0000, 0x0000,
+	    0x3ddb, 0x0000, 0x4781, 0x003f, 0x0000, 0x3683, 0x0000, 0x0000,
+	    0x3b7c, 0x0000, 0x203b, 0x0000, 0x0754, 0x492d, 0x0000, 0x0000,
+	    0x1884, 0x0000, 0x44ad, 0x13cc, 0x3bfd, 0x0000, 0x0000, 0x160d,
+	    0x3e55, 0x0000, 0x0449, 0x0a89, 0x0000, 0x38df, 0x0000, 0x0000,
+	    0x1f13, 0x0000, 0x0000, 0x0000, 0x2c71, 0x0000, 0x331b, 0x4873,
+	    0x0000, 0x3a7b, 0x3498, 0x4d38, 0x33da, 0x0000, 0x1e05, 0x199a,
+	    0x0000, 0x0e16, 0x0db0, 0x0000, 0x3538, 0x0000, 0x4b40, 0x0000,
+	    0x4ac8, 0x0000, 0x16ff, 0x2631, 0x47ec, 0x2896, 0x3332, 0x243c,
+	    0x3c78, 0x0000, 0x3122, 0x0000, 0x3047, 0x1957, 0x0e51, 0x31b4,
+	    0x0000, 0x0000, 0x120c, 0x0000, 0x0000, 0x0d8f, 0x0ee0, 0x0000,
+	    0x4c64, 0x0000, 0x39b4, 0x0c3f, 0x0000, 0x007e, 0x4860, 0x0000,
+	    0x0000, 0x4694, 0x2c4b, 0x0000, 0x1889, 0x28ab, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x39d5, 0x0d3a, 0x0000, 0x02e6, 0x0000, 0x0000,
+	    0x0000, 0x1879, 0x49b2, 0x0c78, 0x31b9, 0x1755, 0x1131, 0x0f50,
+	    0x0000, 0x0a0e, 0x34f2, 0x0000, 0x23c9, 0x0000, 0x0000, 0x1345,
+	    0x0000, 0x0000, 0x0000, 0x47dc, 0x3e16, 0x1111, 0x2d72, 0x0000,
+	    0x0000, 0x443a, 0x0000, 0x0000, 0x0000, 0x0000, 0x453f, 0x0d2e,
+	    0x0000, 0x427a, 0x188a, 0x0000, 0x0000, 0x0000, 0x3e24, 0x0000,
+	    0x2789, 0x0000, 0x0d15, 0x40e2, 0x0000, 0x0000, 0x26b6, 0x4be4,
+	    0x3f54, 0x0000, 0x0624, 0x467a, 0x0217, 0x37b5, 0x47de, 0x3da3,
+	    0x16c8, 0x0000, 0x1e7a, 0x0000, 0x0000, 0x1a90, 0x0000, 0x2745,
+	    0x0000, 0x2d8a, 0x3ad6, 0x0000, 0x0000, 0x0000, 0x35de, 0x0000,
+	    0x4ca3, 0x4011, 0x0000, 0x0000, 0x0000, 0x1ce6, 0x0000, 0x1449,
+	    0x04d5, 0x3f01, 0x13f5, 0x0000, 0x0834, 0x08ac, 0x1004, 0x0000,
+	    0x276e, 0x0000, 0x18da, 0x3ed3, 0x474b, 0x0000, 0x23e7, 0x0000,
+	    0x3cd8, 0x0000, 0x009f, 0x0018, 0x3230, 0x2233, 0x0000, 0x39da,
+	    0x3c6f, 0x4e02, 0x051f, 0x0000, 0x1e7d, 0x0000, 0x43ae, 0x0000,
+	    0x00c9, 0x4622, 0x0e99, 0x2841, 0x0000, 0x1171, 0x1d3d, 0x1321,
+	    0x1177, 0x0000, 0x34df, 0x0000, 0x1bbd, 0x4aa2, 0x29f2, 0x0000,
+	    0x0000, 0x0000, 0x16dc, 0x0000, 0x3020, 0x0000, 0x0000, 0x1c2d,
+	    0x0000, 0x1985, 0x0a16, 0x44d7, 0x49b5, 0x0000, 0x465d, 0x3c93,
+	    0x0000, 0x42a9, 0x0000, 0x1cc3, 0x2476, 0x0e28, 0x1316, 0x0900,
+	    0x4313, 0x48d5, 0x30a1, 0x1223, 0x00df, 0x391b, 0x302c, 0x0000,
+	    0x19fe, 0x4891, 0x0000, 0x2ac9, 0x0000, 0x0000, 0x0000, 0x26ac,
+	    0x3ba6, 0x0000, 0x0000, 0x398e, 0x0000, 0x4351, 0x0000, 0x24a1,
+	    0x0000, 0x00ab, 0x0000, 0x070e, 0x1fc5, 0x0306, 0x0000, 0x3921,
+	    0x3a27, 0x3acf, 0x21f1, 0x268a, 0x0e40, 0x3a26, 0x0000, 0x0000,
+	    0x0000, 0x4334, 0x0000, 0x400d, 0x334b, 0x083c, 0x0a78, 0x0000,
+	    0x4c63, 0x1226, 0x0ee2, 0x0000, 0x0d6d, 0x2013, 0x0b36, 0x3277,
+	    0x41a9, 0x26c6, 0x0000, 0x0000, 0x1d84, 0x1dd2, 0x0000, 0x48ab,
+	    0x1f49, 0x0000, 0x4c8b, 0x190c, 0x4082, 0x0000, 0x0000, 0x3769,
+	    0x0000, 0x0000, 0x0000, 0x06a1, 0x0653, 0x0000, 0x0000, 0x0000,
+	    0x4caa, 0x0000, 0x4803, 0x1866, 0x0000, 0x47d6, 0x0000, 0x4a3f,
+	    0x3d8a, 0x0000, 0x0934, 0x2ee2, 0x0000, 0x0000, 0x0000, 0x48ad,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x11a9, 0x4467, 0x0000, 0x3e95,
+	    0x425f, 0x0000, 0x056e, 0x0000, 0x0000, 0x0000, 0x2688, 0x0000,
+	    0x0000, 0x45f6, 0x410f, 0x00b4, 0x2d6e, 0x2689, 0x0000, 0x45ab,
+	    0x0e9e, 0x4208, 0x0000, 0x0000, 0x3202, 0x0000, 0x12a7, 0x0000,
+	    0x4366, 0x0000, 0x0000, 0x1f98, 0x0053, 0x4d4a, 0x1cda, 0x12bb,
+	    0x26eb, 0x4a31, 0x2228, 0x0000, 0x0000, 0x0000, 0x09d7, 0x2e6b,
+	    0x0000, 0x0000, 0x1d82, 0x0c6f, 0x0000, 0x0000, 0x2015, 0x25e6,
+	    0x19b8, 0x04a1, 0x0000, 0x0287, 0x3d57, 0x0000, 0x3975, 0x2222,
+	    0x01b8, 0x48b6, 0x146c, 0x1b13, 0x2d3b, 0x1602, 0x0000, 0x15cc,
+	    0x2b9c, 0x0000, 0x0000, 0x0000, 0x3d9a, 0x3e31, 0x0000, 0x0000,
+	    0x11b4, 0x130c, 0x1542, 0x41cf, 0x1f47, 0x431a, 0x26c6, 0x0000,
+	    0x250b, 0x3864, 0x0000, 0x0000, 0x1fb2, 0x0000, 0x0754, 0x0bca,
+	    0x3f15, 0x4587, 0x4bc1, 0x0000, 0x29b0, 0x0000, 0x0000, 0x1e4a,
+	    0x0000, 0x0000, 0x2b5a, 0x0000, 0x1a5c, 0x0000, 0x2cb3, 0x162a,
+	    0x0189, 0x1a8f, 0x2084, 0x0012, 0x3d7c, 0x4935, 0x0000, 0x0000,
+	    0x0000, 0x1db5, 0x0cad, 0x0000, 0x2b76, 0x0000, 0x473a, 0x0000,
+	    0x4b0c, 0x0000, 0x1d0d, 0x0000, 0x0000, 0x476e, 0x0000, 0x24bc,
+	    0x0000, 0x0000, 0x165e, 0x2dc3, 0x33d9, 0x0000, 0x11f3, 0x0000,
+	    0x3cad, 0x0000, 0x1f3b, 0x0000, 0x2535, 0x1b0a, 0x0985, 0x0000,
+	    0x4152, 0x2cc5, 0x3d87, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x07c9, 0x07c3, 0x0000, 0x26e6, 0x4302, 0x2209, 0x0000, 0x34d8,
+	    0x0ad8, 0x3952, 0x2532, 0x0000, 0x0000, 0x096d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x049d, 0x0000, 0x0000, 0x0000, 0x0360,
+	    0x0000, 0x0000, 0x0000, 0x1dd5, 0x0000, 0x298d, 0x28b7, 0x4bec,
+	    0x46e5, 0x3e98, 0x0000, 0x2573, 0x0000, 0x1661, 0x1b22, 0x391e,
+	    0x37ea, 0x0000, 0x2651, 0x0000, 0x01d3, 0x3780, 0x21ed, 0x431b,
+	    0x0000, 0x2af0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x180a,
+	    0x0a01, 0x4b72, 0x1811, 0x27b6, 0x46af, 0x0000, 0x3427, 0x00b1,
+	    0x2896, 0x2dd7, 0x0000, 0x3e96, 0x0000, 0x4bc9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3ba8, 0x165d, 0x0000, 0x0ba4, 0x1f25,
+	    0x331e, 0x0000, 0x2ca6, 0x3280, 0x0000, 0x0000, 0x0000, 0x2bd7,
+	    0x03a3, 0x0000, 0x0000, 0x0d18, 0x1ff9, 0x0a1b, 0x47aa, 0x1122,
+	    0x3049, 0x2c60, 0x2d50, 0x26ae, 0x0000, 0x0000, 0x0ba5, 0x0000,
+	    0x3aa5, 0x1bb5, 0x0000, 0x0000, 0x0000, 0x20da, 0x06fb, 0x1c9f,
+	    0x0000, 0x446f, 0x00ca, 0x4493, 0x2a42, 0x0797, 0x0efb, 0x1fc6,
+	    0x12b3, 0x092d, 0x31bf, 0x0000, 0x4d2e, 0x0000, 0x0a6c, 0x1d24,
+	    0x0715, 0x366d, 0x0000, 0x0000, 0x40a0, 0x345f, 0x0ca1, 0x0000,
+	    0x2ba0, 0x1549, 0x0000, 0x446c, 0x1263, 0x0000, 0x0000, 0x3033,
+	    0x1439, 0x0000, 0x0000, 0x3758, 0x2b39, 0x313d, 0x49fb, 0x370c,
+	    0x4c5e, 0x341a, 0x33d8, 0x3689, 0x33f0, 0x4ba6, 0x0000, 0x3b5b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0e68, 0x2ccb, 0x4b00, 0x05ac,
+	    0x2135, 0x17a4, 0x0000, 0x16eb, 0x333e, 0x2d4e, 0x19c4, 0x0000,
+	    0x3849, 0x2c78, 0x0000, 0x0e80, 0x2f76, 0x4d0a, 0x0000, 0x0000,
+	    0x30e1, 0x3774, 0x0000, 0x2576, 0x41fa, 0x26e1, 0x0000, 0x49b8,
+	    0x3a27, 0x4c8e, 0x4819, 0x0000, 0x1a18, 0x0000, 0x0000, 0x25d1,
+	    0x3a0a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4e0a, 0x04dd,
+	    0x0000, 0x1eea, 0x0000, 0x00aa, 0x06de, 0x0000, 0x2c1e, 0x4323,
+	    0x2bf9, 0x3cb8, 0x3dbc, 0x36f7, 0x0000, 0x4b71, 0x185e, 0x3ac8,
+	    0x187d, 0x4d0f, 0x130c, 0x217e, 0x0000, 0x4baf, 0x0000, 0x4137,
+	    0x226d, 0x0a98, 0x0000, 0x3ea5, 0x04ee, 0x2053, 0x2aa3, 0x0000,
+	    0x4335, 0x08b8, 0x0000, 0x4c80, 0x0000, 0x0000, 0x28b4, 0x0000,
+	    0x3506, 0x0000, 0x27b4, 0x0000, 0x2643, 0x240f, 0x4826, 0x0000,
+	    0x4af7, 0x0000, 0x23d1, 0x01cd, 0x0000, 0x18da, 0x1276, 0x22ea,
+	    0x044f, 0x0863, 0x0727, 0x3287, 0x346b, 0x0c62, 0x39d3, 0x26de,
+	    0x354c, 0x0000, 0x012b, 0x2595, 0x0000, 0x0000, 0x4050, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3a00, 0x0044, 0x0000, 0x1bc4, 0x0000,
+	    0x0000, 0x239b, 0x0000, 0x0000, 0x0ffb, 0x1090, 0x0000, 0x3572,
+	    0x3876, 0x0000, 0x4c2c, 0x11ff, 0x0000, 0x0000, 0x0000, 0x46b1,
+	    0x0000, 0x1534, 0x2e6f, 0x3a44, 0x4d08, 0x0000, 0x0000, 0x2042,
+	    0x0800, 0x1237, 0x3a71, 0x1dd4, 0x08db, 0x0000, 0x0000, 0x0bb3,
+	    0x4d4d, 0x2467, 0x0000, 0x36c7, 0x2c92, 0x27db, 0x0000, 0x0000,
+	    0x435e, 0x0000, 0x163d, 0x1785, 0x0000, 0x0000, 0x0000, 0x2d57,
+	    0x2931, 0x0000, 0x0000, 0x0000, 0x031b, 0x0000, 0x0efe, 0x3bfa,
+	    0x4ba8, 0x0000, 0x3d7d, 0x0122, 0x21da, 0x0d76, 0x0000, 0x0000,
+	    0x1de7, 0x0337, 0x3661, 0x0000, 0x26bf, 0x4000, 0x0d5e, 0x0000,
+	    0x0000, 0x3537, 0x27b3, 0x1cfd, 0x0000, 0x338d, 0x0000, 0x3fe5,
+	    0x2911, 0x0000, 0x0422, 0x0000, 0x43b3, 0x3ee8, 0x0000, 0x3415,
+	    0x49b5, 0x0dff, 0x0000, 0x38ac, 0x0d6d, 0x0000, 0x118a, 0x06dd,
+	    0x432e, 0x3770, 0x0000, 0x1960, 0x2d61, 0x43c3, 0x47a1, 0x0000,
+	    0x0000, 0x18f4, 0x148e, 0x3d2b, 0x2f61, 0x0000, 0x1a3f, 0x3e56,
+	    0x0000, 0x0000, 0x284a, 0x0000, 0x1981, 0x0000, 0x28a7, 0x1e92,
+	    0x0000, 0x0661, 0x0000, 0x1e0d, 0x0000, 0x1d8e, 0x306d, 0x40cc,
+	    0x0000, 0x3b6c, 0x0000, 0x218d, 0x0000, 0x0000, 0x0000, 0x4a74,
+	    0x2b2a, 0x0d29, 0x2941, 0x0000, 0x438a, 0x0000, 0x0000, 0x0000,
+	    0x36c3, 0x3f34, 0x0000, 0x19d4, 0x0000, 0x0000, 0x20a7, 0x2981,
+	    0x48aa, 0x4b42, 0x36b8, 0x0000, 0x0000, 0x0a0a, 0x2909, 0x0000,
+	    0x0000, 0x220e, 0x0000, 0x1118, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x15cb, 0x21f9, 0x4072, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b91,
+	    0x0000, 0x0000, 0x444e, 0x0000, 0x460d, 0x2f52, 0x4386, 0x2663,
+	    0x277d, 0x0209, 0x1fa2, 0x0b5f, 0x0000, 0x0000, 0x1b41, 0x0000,
+	    0x3936, 0x31f0, 0x0000, 0x0000, 0x0000, 0x20c6, 0x0a36, 0x0000,
+	    0x1590, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f2a,
+	    0x4912, 0x33f9, 0x466c, 0x0000, 0x0000, 0x2bd7, 0x0000, 0x09cd,
+	    0x0204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e79,
+	    0x4948, 0x0a0e, 0x0000, 0x309f, 0x0ca6, 0x0000, 0x1cfb, 0x0000,
+	    0x0000, 0x034d, 0x135f, 0x3ae8, 0x3a0c, 0x0000, 0x34c9, 0x47e1,
+	    0x4ac9, 0x0000, 0x0000, 0x14a4, 0x0010, 0x0bcd, 0x0000, 0x0000,
+	    0x09e6, 0x2c3d, 0x0498, 0x3f4f, 0x0000, 0x0000, 0x04f6, 0x2ec5,
+	    0x0000, 0x28ab, 0x3ce4, 0x3349, 0x0000, 0x1191, 0x0e60, 0x0000,
+	    0x1257, 0x1734, 0x26b9, 0x4b6f, 0x0000, 0x2ee2, 0x0000, 0x2558,
+	    0x0000, 0x07be, 0x4071, 0x0000, 0x0000, 0x18de, 0x382a, 0x49d5,
+	    0x358c, 0x266c, 0x0000, 0x09f0, 0x1857, 0x3582, 0x4855, 0x0000,
+	    0x27a0, 0x0000, 0x0000, 0x487e, 0x0629, 0x37ee, 0x095b, 0x092f,
+	    0x2406, 0x2411, 0x19ce, 0x4d82, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4a1f, 0x0000, 0x1ec7, 0x0000, 0x0000, 0x0000, 0x259b, 0x0000,
+	    0x2c3e, 0x211b, 0x105c, 0x34e6, 0x3640, 0x45ef, 0x140c, 0x0000,
+	    0x0000, 0x3d14, 0x33f7, 0x17c3, 0x480e, 0x07f1, 0x1c67, 0x0000,
+	    0x0462, 0x0000, 0x25b2, 0x04cd, 0x0000, 0x0000, 0x0000, 0x1015,
+	    0x3b8f, 0x04d3, 0x0000, 0x0000, 0x1cca, 0x1ea3, 0x082e, 0x44fe,
+	    0x478f, 0x1787, 0x166a, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000,
+	    0x0b05, 0x0000, 0x0000, 0x0000, 0x0000, 0x225f, 0x08d1, 0x0b20,
+	    0x0000, 0x1dfd, 0x0614, 0x0000, 0x0508, 0x050f, 0x0000, 0x289e,
+	    0x0b0c, 0x0b32, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a6, 0x0000,
+	    0x0b80, 0x0000, 0x1a9b, 0x09c2, 0x0000, 0x1a21, 0x269d, 0x0000,
+	    0x0000, 0x0309, 0x055a, 0x0000, 0x1143, 0x0000, 0x0b9e, 0x0000,
+	    0x0000, 0x0849, 0x315d, 0x0281, 0x0456, 0x0000, 0x216b, 0x0000,
+	    0x2c52, 0x20ca, 0x16c4, 0x19be, 0x29ff, 0x0000, 0x299b, 0x0583,
+	    0x398b, 0x139b, 0x0000, 0x30ff, 0x0000, 0x0000, 0x12dd, 0x0000,
+	    0x0000, 0x2212, 0x437e, 0x3c94, 0x146a, 0x0000, 0x1e6c, 0x0000,
+	    0x3dbd, 0x13f7, 0x0000, 0x13ed, 0x1bea, 0x0000, 0x038c, 0x09ee,
+	    0x0000, 0x0000, 0x3998, 0x225d, 0x0000, 0x0000, 0x0000, 0x4342,
+	    0x4d20, 0x0000, 0x1ed6, 0x0ae5, 0x37f1, 0x3e80, 0x0000, 0x36b0,
+	    0x0000, 0x0000, 0x0000, 0x4d2d, 0x190b, 0x3db3, 0x0549, 0x0000,
+	    0x386b, 0x1f46, 0x3429, 0x0821, 0x0b2e, 0x20ba, 0x0000, 0x0afe,
+	    0x1136, 0x204e, 0x0000, 0x0e2b, 0x1bb1, 0x3c18, 0x06d9, 0x0000,
+	    0x35e2, 0x3700, 0x024d, 0x0000, 0x0726, 0x44c6, 0x0000, 0x4e0d,
+	    0x0000, 0x23d4, 0x1157, 0x1458, 0x2c05, 0x0000, 0x0000, 0x1962,
+	    0x32dc, 0x0000, 0x0299, 0x103c, 0x1785, 0x0000, 0x2b28, 0x070b,
+	    0x4378, 0x3060, 0x005c, 0x06df, 0x4d73, 0x26ea, 0x4d04, 0x1aa6,
+	    0x2398, 0x0000, 0x3611, 0x0947, 0x3f64, 0x0000, 0x2e3f, 0x0000,
+	    0x0a99, 0x2dba, 0x0000, 0x0000, 0x4049, 0x0000, 0x3287, 0x253f,
+	    0x15be, 0x0000, 0x2b42, 0x3e18, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3f64, 0x1617, 0x4a5d, 0x0000, 0x27d7, 0x2ce1, 0x3831, 0x05ae,
+	    0x0000, 0x0000, 0x0000, 0x0884, 0x3c90, 0x4d2e, 0x2ae1, 0x0000,
+	    0x437a, 0x4d67, 0x06c8, 0x13bb, 0x2cfa, 0x437a, 0x2078, 0x0000,
+	    0x15c1, 0x0000, 0x007b, 0x0000, 0x0000, 0x3542, 0x0479, 0x0000,
+	    0x0000, 0x1889, 0x0000, 0x3d86, 0x401f, 0x07d6, 0x4df9, 0x0000,
+	    0x3832, 0x0000, 0x0000, 0x3630, 0x0000, 0x0000, 0x0000, 0x01f7,
+	    0x400c, 0x0094, 0x0000, 0x49af, 0x1eec, 0x2459, 0x0ae8, 0x0470,
+	    0x292c, 0x242d, 0x31a7, 0x3815, 0x1720, 0x33c8, 0x22e7, 0x0000,
+	    0x26f1, 0x23ce, 0x0000, 0x0000, 0x0000, 0x0023, 0x1f9a, 0x279c,
+	    0x1a2d, 0x2ad4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1256,
+	    0x0000, 0x267b, 0x0000, 0x1f11, 0x0b70, 0x30d9, 0x16dd, 0x3c7e,
+	    0x0000, 0x309b, 0x3049, 0x1407, 0x0000, 0x0000, 0x3c21, 0x1d4e,
+	    0x290e, 0x0000, 0x2cc1, 0x0217, 0x2c36, 0x0000, 0x06f2, 0x0000,
+	    0x0000, 0x46b2, 0x3824, 0x0000, 0x0000, 0x06d5, 0x0000, 0x0283,
+	    0x0989, 0x0000, 0x0000, 0x332d, 0x134c, 0x0000, 0x1562, 0x0000,
+	    0x0000, 0x00ff, 0x0000, 0x1f9e, 0x40c9, 0x245a, 0x101b, 0x041c,
+	    0x3bdb, 0x0000, 0x0000, 0x0000, 0x4d5f, 0x493b, 0x0000, 0x0000,
+	    0x3198, 0x2cf0, 0x0000, 0x0000, 0x2d75, 0x3a93, 0x09e5, 0x0000,
+	    0x2e11, 0x0ada, 0x203e, 0x1ab9, 0x2b73, 0x0000, 0x2aca, 0x23e8,
+	    0x0000, 0x0000, 0x3636, 0x1882, 0x0000, 0x0000, 0x0000, 0x0e78,
+	    0x4a0b, 0x0000, 0x3ecb, 0x0000, 0x0000, 0x12ea, 0x1d09, 0x0c52,
+	    0x0000, 0x0ed3, 0x0dd9, 0x07c0, 0x0000, 0x354d, 0x3ee3, 0x23bd,
+	    0x0000, 0x49c0, 0x0000, 0x0000, 0x493c, 0x33cc, 0x25f1, 0x0000,
+	    0x08b2, 0x0000, 0x233d, 0x0a7e, 0x0000, 0x0000, 0x1e5b, 0x39bd,
+	    0x0d90, 0x480f, 0x0000, 0x48bb, 0x26e0, 0x335b, 0x0000, 0x0000,
+	    0x0000, 0x01bf, 0x0000, 0x0000, 0x09d4, 0x1fbd, 0x3441, 0x1714,
+	    0x0000, 0x4b25, 0x0156, 0x0990, 0x2c82, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2f3d, 0x3568, 0x0000, 0x2ed4, 0x0000, 0x04c3, 0x1b4a,
+	    0x2b88, 0x190a, 0x3622, 0x0000, 0x07dd, 0x3194, 0x3242, 0x39d6,
+	    0x350f, 0x3303, 0x1b04, 0x25ce, 0x0000, 0x0000, 0x336e, 0x48ee,
+	    0x1237, 0x2437, 0x0000, 0x09c8, 0x0000, 0x43bb, 0x0000, 0x394a,
+	    0x0000, 0x17b5, 0x0000, 0x0000, 0x0b4b, 0x0000, 0x0000, 0x1b61,
+	    0x1ec8, 0x2441, 0x01b5, 0x0dde, 0x0000, 0x29e4, 0x0000, 0x09b9,
+	    0x0fca, 0x0000, 0x0000, 0x0000, 0x014b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0115, 0x0a2b, 0x305f, 0x0ac4, 0x0000, 0x2de5, 0x0000,
+	    0x4c13, 0x0000, 0x1978, 0x0000, 0x0000, 0x1eba, 0x101c, 0x0000,
+	    0x0000, 0x1c09, 0x0000, 0x0000, 0x13b2, 0x1e51, 0x033e, 0x2e0d,
+	    0x0000, 0x18ac, 0x48ec, 0x0000, 0x0000, 0x0000, 0x14d6, 0x0000,
+	    0x0b14, 0x3d86, 0x08fa, 0x3dfc, 0x1abe, 0x0374, 0x0000, 0x3eeb,
+	    0x0a5a, 0x1302, 0x442c, 0x0b94, 0x0000, 0x4879, 0x4893, 0x094d,
+	    0x2fe0, 0x41fb, 0x06c9, 0x0000, 0x265a, 0x0000, 0x0000, 0x2329,
+	    0x0000, 0x0000, 0x23b5, 0x1b39, 0x2460, 0x1bb6, 0x0000, 0x0c22,
+	    0x25de, 0x006a, 0x11d5, 0x0f7f, 0x0000, 0x0f2f, 0x0000, 0x0000,
+	    0x0af9, 0x3f82, 0x0000, 0x093e, 0x0000, 0x1594, 0x0000, 0x0000,
+	    0x27a4, 0x0000, 0x0000, 0x0c90, 0x1910, 0x0000, 0x22c0, 0x33c7,
+	    0x3e6b, 0x3819, 0x09e3, 0x2695, 0x28b1, 0x0000, 0x0b4f, 0x0000,
+	    0x0000, 0x394d, 0x3ac9, 0x0d71, 0x14b9, 0x3cd6, 0x1098, 0x1c4d,
+	    0x104f, 0x0bdc, 0x0cb6, 0x18f5, 0x36b6, 0x2956, 0x0000, 0x0000,
+	    0x46a1, 0x2bd5, 0x0cbc, 0x0695, 0x0000, 0x0000, 0x226c, 0x0000,
+	    0x0000, 0x102c, 0x0000, 0x42a6, 0x0000, 0x3256, 0x1477, 0x1836,
+	    0x0000, 0x0ff9, 0x0000, 0x2443, 0x49e0, 0x2d12, 0x2ba4, 0x2335,
+	    0x3cd6, 0x0000, 0x0019, 0x0000, 0x0000, 0x0f07, 0x0000, 0x0000,
+	    0x4036, 0x0000, 0x0db1, 0x386f, 0x0000, 0x2afa, 0x0000, 0x126f,
+	    0x0000, 0x0000, 0x3b03, 0x0000, 0x2a6c, 0x0000, 0x09c2, 0x2107,
+	    0x1164, 0x0000, 0x0000, 0x0737, 0x40ba, 0x23d7, 0x0000, 0x0000,
+	    0x3d04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4874,
+	    0x0000, 0x014b, 0x3ef7, 0x0d2a, 0x0000, 0x0000, 0x0cf3, 0x0000,
+	    0x02fe, 0x0000, 0x4df4, 0x2d77, 0x0000, 0x08df, 0x0000, 0x1396,
+	    0x0000, 0x0000, 0x05a1, 0x0000, 0x35d4, 0x27c0, 0x0000, 0x3c65,
+	    0x0000, 0x163a, 0x1d7b, 0x0000, 0x0000, 0x22d6, 0x0e74, 0x0000,
+	    0x0000, 0x4c19, 0x2321, 0x0613, 0x2337, 0x3f6e, 0x0000, 0x0000,
+	    0x0000, 0x1568, 0x27ab, 0x14d6, 0x0000, 0x134c, 0x49d0, 0x372f,
+	    0x421e, 0x0000, 0x0000, 0x2686, 0x0787, 0x0000, 0x1cde, 0x27ea,
+	    0x0000, 0x002e, 0x0000, 0x10a5, 0x3838, 0x2646, 0x3cb0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0ac9, 0x0c03, 0x1586, 0x4b05, 0x2b1c,
+	    0x0000, 0x0000, 0x3ffd, 0x2a27, 0x0000, 0x1c03, 0x0000, 0x45db,
+	    0x0000, 0x09ce, 0x0dda, 0x1853, 0x2115, 0x1dd6, 0x477f, 0x0000,
+	    0x0b69, 0x0000, 0x0000, 0x30ab, 0x2f5f, 0x0000, 0x1a0a, 0x0000,
+	    0x0000, 0x3094, 0x2905, 0x0000, 0x2bc6, 0x0000, 0x0000, 0x0000,
+	    0x37e4, 0x3368, 0x0e22, 0x0287, 0x3c8f, 0x0000, 0x0f23, 0x3b1a,
+	    0x098d, 0x0000, 0x185a, 0x092c, 0x2de4, 0x393b, 0x0000, 0x0000,
+	    0x21df, 0x1f14, 0x0000, 0x0000, 0x0c6f, 0x0000, 0x0000, 0x03bb,
+	    0x0000, 0x0000, 0x411f, 0x450c, 0x0000, 0x1d38, 0x3b82, 0x25b3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1348, 0x07f1, 0x0000,
+	    0x0000, 0x3114, 0x0000, 0x406d, 0x0000, 0x1786, 0x34f9, 0x0000,
+	    0x09af, 0x17cb, 0x1065, 0x41f4, 0x3fb5, 0x2caf, 0x0000, 0x151c,
+	    0x2b73, 0x3cbb, 0x0000, 0x1559, 0x28c9, 0x419f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2919, 0x04c5, 0x4429, 0x0000, 0x0000, 0x0000,
+	    0x2f10, 0x274b, 0x0000, 0x0000, 0x19db, 0x32c8, 0x0f12, 0x0000,
+	    0x0000, 0x0000, 0x4ce7, 0x0201, 0x42b4, 0x0000, 0x0000, 0x44cb,
+	    0x0000, 0x0000, 0x0722, 0x47e9, 0x2474, 0x02d9, 0x0000, 0x4010,
+	    0x0000, 0x0000, 0x01c0, 0x0000, 0x0000, 0x0c1e, 0x0000, 0x1dd5,
+	    0x3bdb, 0x0000, 0x4b2e, 0x11f0, 0x4ac5, 0x2288, 0x3e51, 0x0000,
+	    0x0000, 0x0000, 0x3c52, 0x1e36, 0x16a5, 0x02d6, 0x0dd1, 0x0000,
+	    0x12a8, 0x0000, 0x16b8, 0x0772, 0x03fc, 0x0b61, 0x1fc1, 0x0000,
+	    0x3688, 0x0520, 0x46bb, 0x1cb8, 0x0000, 0x0000, 0x1b12, 0x3ca9,
+	    0x2882, 0x0000, 0x139d, 0x0000, 0x19e0, 0x0000, 0x2d99, 0x0000,
+	    0x0000, 0x37f8, 0x3895, 0x0000, 0x164b, 0x0000, 0x0000, 0x0000,
+	    0x46e8, 0x3b05, 0x2430, 0x0000, 0x0269, 0x42c7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1b59, 0x0000, 0x0000, 0x116d, 0x0000, 0x1b51,
+	    0x0941, 0x0000, 0x0000, 0x3d9c, 0x325e, 0x0000, 0x2205, 0x0000,
+	    0x3bc3, 0x0a59, 0x2d16, 0x3a4d, 0x0bd4, 0x0000, 0x0000, 0x27b7,
+	    0x0000, 0x1d0a, 0x093c, 0x2296, 0x0000, 0x0000, 0x2237, 0x0000,
+	    0x28cb, 0x0000, 0x2ebf, 0x34e9, 0x27d3, 0x0000, 0x142a, 0x0000,
+	    0x276d, 0x4797, 0x3c2a, 0x0000, 0x0000, 0x0000, 0x1ee6, 0x0000,
+	    0x3be5, 0x29ba, 0x2278, 0x0887, 0x3283, 0x0155, 0x06e0, 0x0000,
+	    0x351b, 0x0000, 0x0000, 0x4c08, 0x4293, 0x0000, 0x2348, 0x0000,
+	    0x2b6c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2905, 0x0000, 0x063b, 0x382b, 0x37f3, 0x1130, 0x2daf,
+	    0x1c74, 0x0000, 0x1f74, 0x0000, 0x05f2, 0x2e1a, 0x233a, 0x0000,
+	    0x2601, 0x0d35, 0x04b7, 0x0000, 0x1446, 0x0000, 0x0000, 0x4491,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d7a, 0x2d4d,
+	    0x4d17, 0x0313, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02d3, 0x44e7, 0x3644, 0x0000, 0x4679, 0x24fb, 0x0000, 0x4196,
+	    0x1e1b, 0x0000, 0x0804, 0x3343, 0x0000, 0x4536, 0x1e6f, 0x3e09,
+	    0x3541, 0x15b6, 0x0000, 0x0000, 0x40f0, 0x4481, 0x0000, 0x04e4,
+	    0x0000, 0x0000, 0x1c98, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d41,
+	    0x062d, 0x4c44, 0x49cd, 0x1752, 0x0000, 0x1ea6, 0x1b5f, 0x1dba,
+	    0x0ae7, 0x3719, 0x1325, 0x3289, 0x0a7c, 0x3e25, 0x0198, 0x0000,
+	    0x4787, 0x2b12, 0x1ecf, 0x0000, 0x0000, 0x0000, 0x0000, 0x22a6,
+	    0x4593, 0x0000, 0x0000, 0x0000, 0x0000, 0x0dbc, 0x0000, 0x1d46,
+	    0x0000, 0x0000, 0x0000, 0x1319, 0x444b, 0x2e13, 0x3d75, 0x0000,
+	    0x08d7, 0x0a91, 0x0000, 0x2916, 0x308e, 0x0000, 0x0000, 0x0000,
+	    0x2879, 0x0000, 0x08c5, 0x0000, 0x0000, 0x2158, 0x448c, 0x0105,
+	    0x20bd, 0x35d8, 0x0000, 0x48ad, 0x38fb, 0x0000, 0x229d, 0x10f8,
+	    0x454f, 0x3f44, 0x0000, 0x421c, 0x4690, 0x29de, 0x0000, 0x2891,
+	    0x381e, 0x1696, 0x34b3, 0x0000, 0x0000, 0x0000, 0x0000, 0x3783,
+	    0x0825, 0x0000, 0x3845, 0x0000, 0x0000, 0x3c8c, 0x2754, 0x1d7b,
+	    0x15a8, 0x3887, 0x2d32, 0x3014, 0x27b0, 0x11e3, 0x0000, 0x0000,
+	    0x0000, 0x0b04, 0x0000, 0x14a9, 0x4c14, 0x0000, 0x2ad9, 0x24b7,
+	    0x3801, 0x0000, 0x2c50, 0x2233, 0x0000, 0x2c4a, 0x4889, 0x18dd,
+	    0x0454, 0x2c48, 0x0d6a, 0x11c9, 0x1817, 0x4c95, 0x0000, 0x0000,
+	    0x342f, 0x0000, 0x0000, 0x0b55, 0x0000, 0x0668, 0x1203, 0x0000,
+	    0x0000, 0x0000, 0x3bb8, 0x0000, 0x45ae, 0x39d3, 0x0000, 0x0000,
+	    0x2704, 0x0000, 0x371f, 0x34be, 0x4a92, 0x4b0d, 0x0000, 0x220e,
+	    0x0000, 0x310d, 0x294e, 0x3891, 0x0000, 0x14c5, 0x0000, 0x3ca6,
+	    0x3848, 0x1d62, 0x0000, 0x0000, 0x0e9f, 0x364f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e16, 0x022a, 0x3be4, 0x287c, 0x0000, 0x1337,
+	    0x0000, 0x010a, 0x285f, 0x0000, 0x1314, 0x0977, 0x03f1, 0x3330,
+	    0x0db2, 0x3837, 0x21c0, 0x0b4d, 0x0000, 0x0000, 0x1f93, 0x0d9b,
+	    0x0000, 0x2a3e, 0x0000, 0x1984, 0x0000, 0x38c7, 0x1c80, 0x0000,
+	    0x0000, 0x3ada, 0x0000, 0x3446, 0x3eb4, 0x0000, 0x0000, 0x0000,
+	    0x13dd, 0x0000, 0x0000, 0x1dff, 0x47ab, 0x1b7f, 0x4d43, 0x4739,
+	    0x0000, 0x173d, 0x0000, 0x22b2, 0x428f, 0x14db, 0x01fc, 0x433a,
+	    0x07ae, 0x0012, 0x2f1b, 0x0000, 0x1e75, 0x3155, 0x0000, 0x4b0f,
+	    0x0000, 0x3f65, 0x0b7f, 0x0000, 0x1bfb, 0x1c82, 0x0000, 0x19ea,
+	    0x2699, 0x0000, 0x0000, 0x16b1, 0x43a9, 0x0000, 0x2022, 0x1ecf,
+	    0x0000, 0x0000, 0x3b79, 0x344b, 0x2167, 0x0000, 0x0d10, 0x0000,
+	    0x22bd, 0x0d1e, 0x0000, 0x0c1d, 0x118e, 0x24ec, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00c4, 0x0000, 0x3baf, 0x0000, 0x300e, 0x0000,
+	    0x0588, 0x0000, 0x2089, 0x0000, 0x0000, 0x34c8, 0x474e, 0x0000,
+	    0x3a7c, 0x248f, 0x4117, 0x0000, 0x0000, 0x385f, 0x1a3a, 0x0d2f,
+	    0x130d, 0x0000, 0x48c8, 0x0976, 0x0000, 0x04d3, 0x0000, 0x0000,
+	    0x05b1, 0x0000, 0x0000, 0x0000, 0x0000, 0x1780, 0x4874, 0x0000,
+	    0x0000, 0x0000, 0x165c, 0x07ad, 0x0000, 0x1e79, 0x0000, 0x0000,
+	    0x1fb5, 0x0000, 0x0000, 0x4a40, 0x0468, 0x123f, 0x0000, 0x0000,
+	    0x4ae2, 0x0b10, 0x4a17, 0x0000, 0x407b, 0x1905, 0x4d57, 0x20d6,
+	    0x019d, 0x45ee, 0x1fb8, 0x448d, 0x4066, 0x0000, 0x2ff7, 0x11a5,
+	    0x0000, 0x0000, 0x0000, 0x3f5a, 0x2667, 0x0000, 0x1801, 0x0000,
+	    0x0000, 0x1d6f, 0x0000, 0x1e4d, 0x0000, 0x29e5, 0x0000, 0x1bfa,
+	    0x0000, 0x3858, 0x2b40, 0x0888, 0x0000, 0x389a, 0x0000, 0x261a,
+	    0x0000, 0x31b0, 0x12a8, 0x0000, 0x05e9, 0x381d, 0x290f, 0x4d57,
+	    0x0000, 0x0000, 0x0000, 0x4d83, 0x2745, 0x0000, 0x087c, 0x3576,
+	    0x0000, 0x29a4, 0x156f, 0x0000, 0x33b4, 0x3a35, 0x259b, 0x4a4d,
+	    0x0000, 0x47cf, 0x3105, 0x0000, 0x0000, 0x1da1, 0x33e1, 0x2ba6,
+	    0x4188, 0x0221, 0x49f9, 0x0000, 0x0000, 0x24f3, 0x0ac3, 0x0000,
+	    0x2e43, 0x32f3, 0x01a1, 0x0000, 0x0000, 0x0000, 0x1b06, 0x0000,
+	    0x1f54, 0x0000, 0x295a, 0x1d0b, 0x0000, 0x0000, 0x3ddf, 0x2a0c,
+	    0x480d, 0x0000, 0x24b5, 0x4cdb, 0x0ee6, 0x0614, 0x0000, 0x4bdd,
+	    0x19b8, 0x0000, 0x0000, 0x1a41, 0x328c, 0x0000, 0x30f6, 0x1804,
+	    0x29f0, 0x295f, 0x0000, 0x0000, 0x0000, 0x0000, 0x052a, 0x0000,
+	    0x2760, 0x1a68, 0x0000, 0x0000, 0x0000, 0x0000, 0x1767, 0x3fa2,
+	    0x246f, 0x0000, 0x0000, 0x0000, 0x0000, 0x127d, 0x1677, 0x023d,
+	    0x35d2, 0x07ca, 0x0000, 0x2049, 0x0000, 0x1ba5, 0x0000, 0x178c,
+	    0x0000, 0x1250, 0x0198, 0x0000, 0x1f1b, 0x0000, 0x4a4f, 0x2ad1,
+	    0x0000, 0x3de4, 0x0000, 0x0a12, 0x0363, 0x0000, 0x054c, 0x0000,
+	    0x24ae, 0x03c0, 0x0000, 0x105d, 0x2c6f, 0x0000, 0x0000, 0x0000,
+	    0x3c94, 0x39f1, 0x4db9, 0x1024, 0x0000, 0x457a, 0x2a1d, 0x07b7,
+	    0x47ac, 0x0000, 0x0000, 0x016e, 0x0000, 0x0000, 0x0000, 0x3600,
+	    0x1e91, 0x16fc, 0x11af, 0x11dd, 0x0000, 0x3d11, 0x44eb, 0x3ac9,
+	    0x3204, 0x0000, 0x47e9, 0x3320, 0x45bc, 0x0000, 0x1f0d, 0x1db2,
+	    0x4320, 0x2254, 0x30ab, 0x0000, 0x2736, 0x2565, 0x0000, 0x0000,
+	    0x2cbe, 0x0000, 0x0000, 0x0000, 0x0000, 0x18f1, 0x2ef0, 0x0000,
+	    0x0000, 0x0000, 0x1c26, 0x278f, 0x0000, 0x1a71, 0x0000, 0x0000,
+	    0x1feb, 0x41a5, 0x1fe4, 0x2e3a, 0x23e6, 0x2a99, 0x0000, 0x0000,
+	    0x25a2, 0x36ee, 0x0000, 0x3851, 0x0000, 0x1e01, 0x10e8, 0x14df,
+	    0x0000, 0x0000, 0x0000, 0x141c, 0x47a9, 0x1771, 0x0000, 0x0000,
+	    0x40bf, 0x0000, 0x0000, 0x07b9, 0x0000, 0x4d85, 0x0000, 0x49cb,
+	    0x0000, 0x0000, 0x0000, 0x2bf7, 0x0000, 0x0000, 0x0312, 0x13e4,
+	    0x0000, 0x366d, 0x41c1, 0x0000, 0x2fd6, 0x0000, 0x0000, 0x3b27,
+	    0x40ed, 0x0000, 0x2b03, 0x2b6a, 0x17c0, 0x3172, 0x3fc6, 0x0e21,
+	    0x1b3e, 0x3436, 0x1c8b, 0x0bd7, 0x18c8, 0x0000, 0x2ac0, 0x11ed,
+	    0x0000, 0x091c, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c75, 0x30eb,
+	    0x1802, 0x405d, 0x3265, 0x0000, 0x168d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08ae,
+	    0x0000, 0x28ff, 0x3b02, 0x37c6, 0x4288, 0x1c0d, 0x220d, 0x0000,
+	    0x265d, 0x0115, 0x4daa, 0x0000, 0x1267, 0x045a, 0x0000, 0x029a,
+	    0x3e08, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x37d9, 0x4220,
+	    0x4b60, 0x0e2c, 0x49b4, 0x0000, 0x0dc7, 0x1f17, 0x0000, 0x0000,
+	    0x3591, 0x0000, 0x4aaa, 0x0000, 0x210f, 0x0000, 0x0000, 0x0000,
+	    0x3c27, 0x0000, 0x1874, 0x1236, 0x0000, 0x08fe, 0x41a4, 0x0000,
+	    0x4334, 0x2680, 0x0000, 0x34c0, 0x3d7f, 0x419e, 0x1bdf, 0x0000,
+	    0x0000, 0x0000, 0x27a7, 0x1bb3, 0x42ba, 0x1c01, 0x0000, 0x3062,
+	    0x0399, 0x0000, 0x48e9, 0x0000, 0x0000, 0x22ae, 0x0000, 0x0bff,
+	    0x0000, 0x0da0, 0x489f, 0x0000, 0x0f98, 0x2ce4, 0x45ac, 0x241a,
+	    0x3806, 0x2547, 0x00bd, 0x391c, 0x0f7b, 0x0000, 0x0000, 0x20a0,
+	    0x2f44, 0x06c3, 0x0000, 0x0a89, 0x1d46, 0x0000, 0x3e49, 0x1148,
+	    0x0000, 0x0000, 0x13b7, 0x0000, 0x0e47, 0x2fc0, 0x0000, 0x0000,
+	    0x0000, 0x1280, 0x14ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x33d7, 0x0000, 0x04ee,
+	    0x1b69, 0x0000, 0x490c, 0x206f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4683, 0x365f, 0x3e69, 0x0296, 0x0000, 0x099f, 0x0000, 0x49c9,
+	    0x2798, 0x0000, 0x176f, 0x0000, 0x242d, 0x0e8b, 0x2a7d, 0x364f,
+	    0x0815, 0x07df, 0x0000, 0x04af, 0x0000, 0x2eda, 0x2793, 0x468d,
+	    0x49ce, 0x0d74, 0x0508, 0x404e, 0x2a0d, 0x0000, 0x1e02, 0x0000,
+	    0x0000, 0x0000, 0x3fc1, 0x0000, 0x36c8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x26c7, 0x371c, 0x0000, 0x2e54, 0x0000, 0x0000,
+	    0x0000, 0x34e9, 0x0000, 0x0492, 0x077d, 0x46d7, 0x4d1a, 0x14eb,
+	    0x0000, 0x28a4, 0x0000, 0x1539, 0x3314, 0x048c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0dd7, 0x0000, 0x0c47, 0x0000,
+	    0x0000, 0x49f6, 0x062f, 0x0000, 0x1f9b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x488f, 0x1d4f, 0x4906, 0x293e, 0x29d6, 0x0000, 0x0000,
+	    0x256f, 0x0000, 0x0000, 0x39dc, 0x38a1, 0x0000, 0x06c7, 0x3c87,
+	    0x1fd2, 0x350f, 0x39e5, 0x0000, 0x0ac5, 0x186d, 0x0000, 0x0000,
+	    0x0000, 0x1ab4, 0x05a7, 0x49e4, 0x0000, 0x4725, 0x1cbf, 0x14b1,
+	    0x0000, 0x1465, 0x0000, 0x3a91, 0x1ac5, 0x2b6d, 0x0000, 0x431f,
+	    0x008f, 0x0000, 0x0000, 0x2f8a, 0x0000, 0x1be8, 0x3c4e, 0x0000,
+	    0x408f, 0x0000, 0x0000, 0x2697, 0x40b4, 0x20fc, 0x0000, 0x0000,
+	    0x2363, 0x0000, 0x35b6, 0x17ac, 0x0000, 0x43d8, 0x39a6, 0x0000,
+	    0x0000, 0x081e, 0x0000, 0x0000, 0x347b, 0x0d47, 0x276b, 0x0000,
+	    0x355b, 0x0000, 0x289c, 0x0000, 0x1991, 0x0000, 0x0000, 0x3b79,
+	    0x1fc0, 0x0000, 0x0000, 0x3bec, 0x33a1, 0x0000, 0x0000, 0x099e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x255c, 0x0000, 0x0000, 0x0000, 0x49f7, 0x37f3, 0x0495,
+	    0x3406, 0x4cd6, 0x12eb, 0x0000, 0x4ba8, 0x0000, 0x190f, 0x2153,
+	    0x4bf3, 0x0000, 0x48f7, 0x0000, 0x3597, 0x0000, 0x0000, 0x0000,
+	    0x1350, 0x2cba, 0x0000, 0x0000, 0x3ba0, 0x0000, 0x3ccf, 0x2940,
+	    0x0000, 0x0000, 0x1fe6, 0x1137, 0x4c2e, 0x0000, 0x0000, 0x0fc2,
+	    0x395e, 0x40ff, 0x15d3, 0x3d42, 0x0000, 0x0a6c, 0x1804, 0x08b0,
+	    0x0000, 0x1bcb, 0x0000, 0x1528, 0x0000, 0x031a, 0x4034, 0x0000,
+	    0x498c, 0x3107, 0x0000, 0x0000, 0x1949, 0x1965, 0x0000, 0x0000,
+	    0x0000, 0x49b5, 0x12bd, 0x150a, 0x3f3a, 0x08fa, 0x0148, 0x3036,
+	    0x17f0, 0x0000, 0x0000, 0x36b1, 0x0000, 0x0000, 0x2c43, 0x1d6b,
+	    0x367b, 0x0000, 0x0000, 0x0000, 0x0ebe, 0x0000, 0x491a, 0x3694,
+	    0x0c6b, 0x395d, 0x0000, 0x22c4, 0x0000, 0x3d32, 0x33ee, 0x48e0,
+	    0x4a0c, 0x0000, 0x2bdc, 0x02fc, 0x1c18, 0x3a30, 0x42a7, 0x48ca,
+	    0x4d00, 0x0000, 0x1692, 0x16fc, 0x0000, 0x212a, 0x2477, 0x1f64,
+	    0x18a8, 0x0000, 0x17ef, 0x4c7a, 0x0000, 0x0000, 0x4969, 0x0000,
+	    0x45e2, 0x00dc, 0x0000, 0x0000, 0x0d37, 0x0000, 0x0000, 0x09bc,
+	    0x0000, 0x34c1, 0x05ee, 0x4a32, 0x13a7, 0x3938, 0x4605, 0x4879,
+	    0x23f5, 0x1258, 0x0230, 0x0193, 0x0000, 0x0764, 0x0000, 0x0000,
+	    0x432f, 0x0000, 0x0000, 0x286b, 0x4751, 0x0000, 0x0000, 0x0000,
+	    0x28df, 0x0000, 0x0000, 0x0000, 0x0000, 0x1288, 0x0000, 0x0000,
+	    0x26d6, 0x1220, 0x0000, 0x0000, 0x3cef, 0x4420, 0x0000, 0x3db1,
+	    0x0000, 0x1369, 0x0000, 0x0000, 0x0edf, 0x195f, 0x07fb, 0x0000,
+	    0x12db, 0x1003, 0x0000, 0x0000, 0x0000, 0x0000, 0x1df3, 0x4075,
+	    0x0000, 0x3c24, 0x32f0, 0x0000, 0x250e, 0x172e, 0x0b3c, 0x0000,
+	    0x3a83, 0x0000, 0x3284, 0x39cb, 0x0000, 0x21db, 0x3024, 0x10d4,
+	    0x0aca, 0x0000, 0x49d1, 0x0000, 0x0000, 0x0000, 0x3f60, 0x0000,
+	    0x10fe, 0x0000, 0x455f, 0x0000, 0x3ad7, 0x0000, 0x0000, 0x2edb,
+	    0x0000, 0x2ea2, 0x0f4e, 0x0000, 0x4923, 0x2469, 0x0000, 0x0000,
+	    0x04f2, 0x0000, 0x2ad2, 0x0000, 0x0000, 0x0000, 0x21e0, 0x0000,
+	    0x1fed, 0x0000, 0x015a, 0x3dc7, 0x4d08, 0x0000, 0x2426, 0x0000,
+	    0x0000, 0x0000, 0x4c47, 0x3e6f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1f81, 0x227f, 0x2317, 0x2120, 0x188d, 0x17db, 0x0b85, 0x4128,
+	    0x4742, 0x0000, 0x0000, 0x2bc2, 0x1a88, 0x0000, 0x4acc, 0x15ba,
+	    0x0000, 0x0000, 0x0000, 0x484e, 0x0119, 0x4dd9, 0x1e6a, 0x3cd8,
+	    0x0000, 0x1657, 0x14ed, 0x0000, 0x1ffc, 0x0000, 0x0000, 0x139c,
+	    0x0000, 0x0000, 0x4c05, 0x12b4, 0x3e52, 0x0000, 0x261a, 0x40e3,
+	    0x174f, 0x0000, 0x40a8, 0x0000, 0x0516, 0x0de7, 0x0133, 0x0000,
+	    0x3742, 0x0000, 0x0000, 0x4553, 0x49a3, 0x1328, 0x2156, 0x3146,
+	    0x188c, 0x095e, 0x0000, 0x0000, 0x0000, 0x0000, 0x2497, 0x23b6,
+	    0x12c3, 0x0000, 0x3acd, 0x2f16, 0x0000, 0x0000, 0x0000, 0x2d62,
+	    0x0cf4, 0x36f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1568, 0x0000,
+	    0x1d18, 0x3d24, 0x0000, 0x3d76, 0x0000, 0x0000, 0x0000, 0x4ba0,
+	    0x45fc, 0x0000, 0x4a4d, 0x0000, 0x0000, 0x0000, 0x4cdf, 0x4716,
+	    0x0000, 0x30a6, 0x439f, 0x253d, 0x2b2b, 0x0000, 0x2dee, 0x0000,
+	    0x0000, 0x18db, 0x25fa, 0x0000, 0x0000, 0x0000, 0x12a0, 0x0000,
+	    0x0000, 0x1ce6, 0x0000, 0x2363, 0x2e9e, 0x2935, 0x4181, 0x0000,
+	    0x0000, 0x346c, 0x0000, 0x4ded, 0x222b, 0x0000, 0x1663, 0x0000,
+	    0x0000, 0x2012, 0x0d2e, 0x16ef, 0x24db, 0x2590, 0x2077, 0x4d20,
+	    0x4983, 0x3032, 0x3d94, 0x12a3, 0x2908, 0x0000, 0x20c8, 0x0457,
+	    0x0000, 0x0000, 0x0000, 0x2546, 0x3c3f, 0x1cdc, 0x1329, 0x0000,
+	    0x23c1, 0x156c, 0x3021, 0x3064, 0x4346, 0x16c4, 0x2b1d, 0x0000,
+	    0x0000, 0x39b9, 0x10cc, 0x0000, 0x1dd3, 0x22db, 0x0000, 0x0000,
+	    0x1d31, 0x1781, 0x0000, 0x4368, 0x413c, 0x1599, 0x0000, 0x38fb,
+	    0x0000, 0x0000, 0x0000, 0x0f82, 0x0000, 0x0c6b, 0x0000, 0x1b57,
+	    0x3f2c, 0x30da, 0x0000, 0x42f2, 0x0000, 0x0000, 0x0000, 0x29be,
+	    0x230f, 0x0000, 0x48bc, 0x0000, 0x0950, 0x2811, 0x1d81, 0x0000,
+	    0x4bd5, 0x304b, 0x0000, 0x46ad, 0x0000, 0x28c6, 0x0000, 0x3e88,
+	    0x0000, 0x0000, 0x0628, 0x04e8, 0x0000, 0x3139, 0x4d35, 0x0000,
+	    0x4852, 0x1e22, 0x01af, 0x0000, 0x1365, 0x4a29, 0x2d42, 0x4e13,
+	    0x37d0, 0x0000, 0x46b1, 0x2d39, 0x2fae, 0x0807, 0x0000, 0x4157,
+	    0x42e7, 0x4369, 0x0154, 0x0000, 0x0000, 0x27a4, 0x0000, 0x0046,
+	    0x0000, 0x0000, 0x0000, 0x2125, 0x0000, 0x3dab, 0x480c, 0x0000,
+	    0x4295, 0x0000, 0x0000, 0x1d12, 0x0000, 0x22c6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1b53, 0x20f7, 0x0000, 0x0000, 0x0c3f, 0x2378,
+	    0x3eb9, 0x00c9, 0x3ded, 0x0000, 0x4b6d, 0x399e, 0x42aa, 0x2346,
+	    0x40af, 0x0000, 0x0000, 0x0000, 0x1708, 0x0000, 0x0000, 0x0000,
+	    0x0f90, 0x4928, 0x0c4a, 0x1143, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x19ba, 0x0000, 0x0a0f, 0x3fac, 0x2c5a, 0x1678, 0x0000, 0x3b3d,
+	    0x04d4, 0x0000, 0x0000, 0x0000, 0x1485, 0x0000, 0x0000, 0x1a09,
+	    0x04c5, 0x4073, 0x0000, 0x4309, 0x0000, 0x06fb, 0x3839, 0x06f7,
+	    0x0df7, 0x1587, 0x0000, 0x2d36, 0x3729, 0x0000, 0x21ed, 0x1179,
+	    0x4396, 0x0000, 0x1f64, 0x3938, 0x0000, 0x2fb0, 0x0000, 0x2681,
+	    0x0000, 0x1498, 0x4a85, 0x35e4, 0x21da, 0x13b7, 0x0000, 0x0000,
+	    0x23ca, 0x3dcf, 0x0000, 0x0000, 0x3c78, 0x3207, 0x27bb, 0x0000,
+	    0x2a2e, 0x33e7, 0x1dbd, 0x0000, 0x1bf8, 0x3179, 0x07b3, 0x0000,
+	    0x2faa, 0x4ce0, 0x2e04, 0x0000, 0x323e, 0x49a7, 0x0000, 0x3c74,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x445e, 0x4865, 0x0000, 0x22f2,
+	    0x0000, 0x0000, 0x30b5, 0x0a0d, 0x1394, 0x29cc, 0x1a7d, 0x24f9,
+	    0x0ad5, 0x0d6a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3caa, 0x0d22, 0x0000, 0x0de2, 0x2ff8, 0x0000, 0x10b7,
+	    0x464a, 0x0000, 0x26bf, 0x394f, 0x45e7, 0x30a3, 0x2cf8, 0x4a28,
+	    0x0000, 0x331f, 0x2e59, 0x0000, 0x3263, 0x0000, 0x0000, 0x2fc5,
+	    0x167e, 0x01e1, 0x088b, 0x0000, 0x0000, 0x0000, 0x31e1, 0x0a8d,
+	    0x0000, 0x0000, 0x0000, 0x3b93, 0x0000, 0x28bc, 0x4350, 0x2714,
+	    0x0000, 0x206d, 0x0000, 0x489a, 0x39f0, 0x0000, 0x0e04, 0x0cd5,
+	    0x0000, 0x2535, 0x3f76, 0x425f, 0x2fe9, 0x0000, 0x385d, 0x298c,
+	    0x0000, 0x0b84, 0x4798, 0x0000, 0x0000, 0x0000, 0x073f, 0x0000,
+	    0x0000, 0x48ff, 0x0000, 0x4086, 0x399a, 0x1945, 0x0fde, 0x4aef,
+	    0x4a77, 0x15ad, 0x44fb, 0x0000, 0x21f9, 0x0000, 0x14d5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1230, 0x0000, 0x3e70, 0x2426, 0x2eb3,
+	    0x0000, 0x4745, 0x0000, 0x2a8b, 0x0000, 0x3b75, 0x0980, 0x4835,
+	    0x2d8a, 0x17df, 0x0000, 0x2a18, 0x3962, 0x0ca1, 0x3829, 0x29c9,
+	    0x0000, 0x37fa, 0x14f7, 0x4b3e, 0x0000, 0x0389, 0x2bf7, 0x007f,
+	    0x0000, 0x321b, 0x0000, 0x2582, 0x0000, 0x4a96, 0x1e0b, 0x1a90,
+	    0x1388, 0x08bd, 0x0000, 0x0000, 0x42a1, 0x03d1, 0x0000, 0x0000,
+	    0x1d4c, 0x3c8e, 0x0000, 0x0000, 0x220d, 0x1ef6, 0x0000, 0x0000,
+	    0x4d93, 0x191e, 0x0000, 0x0000, 0x0000, 0x3adc, 0x13c4, 0x07fc,
+	    0x0a4b, 0x30f3, 0x380f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0154, 0x3449, 0x0000, 0x3342, 0x18c6, 0x2857, 0x3a4b, 0x2eb2,
+	    0x08cb, 0x0038, 0x0000, 0x0771, 0x0000, 0x00c0, 0x0256, 0x0000,
+	    0x2b68, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x255e,
+	    0x0000, 0x0000, 0x107f, 0x1a25, 0x0d4b, 0x0000, 0x3238, 0x43fd,
+	    0x0000, 0x3e67, 0x0361, 0x03e6, 0x0000, 0x0ac1, 0x0000, 0x1d16,
+	    0x0000, 0x091b, 0x0afc, 0x4306, 0x4435, 0x0000, 0x0000, 0x1fb2,
+	    0x0000, 0x0a7c, 0x2e95, 0x0000, 0x02d7, 0x0000, 0x0ec7, 0x0000,
+	    0x0000, 0x2188, 0x0000, 0x0000, 0x0000, 0x20a1, 0x0043, 0x0f4f,
+	    0x0000, 0x0000, 0x2ee2, 0x0000, 0x0000, 0x0000, 0x0fcc, 0x1118,
+	    0x3ba1, 0x0993, 0x15e2, 0x3e5c, 0x4944, 0x1580, 0x0000, 0x41e6,
+	    0x0000, 0x0000, 0x4dfb, 0x2427, 0x2bdd, 0x1332, 0x2621, 0x0000,
+	    0x3b95, 0x0000, 0x0000, 0x1493, 0x0000, 0x0000, 0x4915, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4b2c, 0x2d19, 0x0000, 0x16fe, 0x0000,
+	    0x4a46, 0x0000, 0x0000, 0x4a05, 0x0000, 0x0000, 0x39e7, 0x290b,
+	    0x0000, 0x0000, 0x0000, 0x4329, 0x060d, 0x3535, 0x238c, 0x0000,
+	    0x06ba, 0x0000, 0x3dae, 0x0000, 0x0000, 0x0000, 0x0000, 0x41ec,
+	    0x0000, 0x2535, 0x414f, 0x32d1, 0x0000, 0x07b1, 0x0000, 0x3e86,
+	    0x1faf, 0x17a0, 0x00b2, 0x17a4, 0x2267, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1637, 0x0000, 0x243f, 0x0662, 0x22ac, 0x4027, 0x0aa3,
+	    0x0000, 0x0000, 0x2b96, 0x3b22, 0x0000, 0x0000, 0x0000, 0x2c35,
+	    0x33d3, 0x3b21, 0x35bf, 0x0000, 0x0000, 0x0000, 0x0000, 0x143e,
+	    0x2426, 0x26c3, 0x0de0, 0x0000, 0x1f7b, 0x0537, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2037, 0x0000, 0x4b63, 0x2a83, 0x24a8, 0x4582,
+	    0x4d1d, 0x0000, 0x0000, 0x0000, 0x079a, 0x2924, 0x0000, 0x18d3,
+	    0x2e8d, 0x2338, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d56, 0x3e61,
+	    0x0000, 0x0000, 0x0000, 0x44d3, 0x3937, 0x0000, 0x09bb, 0x1720,
+	    0x0000, 0x4db1, 0x0155, 0x0000, 0x35bd, 0x3768, 0x02a9, 0x2004,
+	    0x3ff4, 0x1f75, 0x0000, 0x0000, 0x0000, 0x0c18, 0x2169, 0x4955,
+	    0x42ec, 0x1aee, 0x0000, 0x0000, 0x40af, 0x0000, 0x235a, 0x36a6,
+	    0x2e20, 0x0a40, 0x3b6a, 0x371c, 0x4b1f, 0x1155, 0x0000, 0x0000,
+	    0x0000, 0x4bb7, 0x0000, 0x0000, 0x0000, 0x15da, 0x0000, 0x0000,
+	    0x3888, 0x426e, 0x0000, 0x01a3, 0x0000, 0x0e4d, 0x07d4, 0x0000,
+	    0x3005, 0x3dfe, 0x0000, 0x0000, 0x0000, 0x41d3, 0x2816, 0x0000,
+	    0x417f, 0x4554, 0x0000, 0x1422, 0x0000, 0x0000, 0x0000, 0x16c6,
+	    0x0000, 0x3387, 0x0578, 0x0793, 0x0000, 0x0000, 0x0000, 0x34ab,
+	    0x0441, 0x0000, 0x0000, 0x0000, 0x0000, 0x3175, 0x118f, 0x2c37,
+	    0x0000, 0x3bbb, 0x0dba, 0x30bd, 0x0000, 0x4642, 0x2692, 0x0000,
+	    0x2d01, 0x0438, 0x3b69, 0x0000, 0x0000, 0x26e4, 0x0b96, 0x4771,
+	    0x23a8, 0x37e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x33e0, 0x33d1,
+	    0x0000, 0x124e, 0x0000, 0x0000, 0x0000, 0x2778, 0x007f, 0x35ba,
+	    0x0387, 0x0000, 0x0254, 0x3ca7, 0x27f8, 0x0000, 0x058c, 0x01b2,
+	    0x0000, 0x04ca, 0x0000, 0x0000, 0x3a63, 0x0000, 0x0562, 0x07b3,
+	    0x183b, 0x283c, 0x4575, 0x0000, 0x0000, 0x21a5, 0x0000, 0x25a6,
+	    0x2796, 0x1395, 0x3ce0, 0x0a35, 0x0000, 0x3dff, 0x2328, 0x0000,
+	    0x1c0e, 0x0000, 0x0000, 0x3028, 0x0000, 0x4601, 0x2bea, 0x0979,
+	    0x0000, 0x09e9, 0x3374, 0x0000, 0x0da3, 0x1c0b, 0x2e0c, 0x4564,
+	    0x0000, 0x3b1d, 0x4a0e, 0x0000, 0x284b, 0x183f, 0x2f0e, 0x4bae,
+	    0x31c9, 0x24ee, 0x397c, 0x1b92, 0x0000, 0x3b85, 0x00bf, 0x4cfa,
+	    0x0000, 0x4dfb, 0x1ad3, 0x3b4a, 0x0000, 0x0000, 0x1547, 0x4d1c,
+	    0x3444, 0x46e3, 0x0000, 0x1100, 0x0000, 0x0000, 0x0000, 0x2bdd,
+	    0x0000, 0x1011, 0x0000, 0x1596, 0x08ac, 0x0000, 0x0000, 0x4c85,
+	    0x3e4a, 0x0000, 0x171d, 0x4120, 0x096e, 0x2498, 0x0000, 0x0000,
+	    0x0cab, 0x492b, 0x38ea, 0x2e36, 0x0000, 0x417a, 0x0000, 0x2d96,
+	    0x3837, 0x24b5, 0x0000, 0x2144, 0x28ef, 0x1430, 0x0000, 0x0000,
+	    0x0000, 0x268d, 0x0bee, 0x18b7, 0x363d, 0x26dd, 0x44a8, 0x0000,
+	    0x1f21, 0x36d9, 0x0000, 0x0000, 0x2d96, 0x1f35, 0x38a3, 0x0000,
+	    0x0000, 0x3ce9, 0x1d1e, 0x3095, 0x0000, 0x0000, 0x3b85, 0x0000,
+	    0x0000, 0x0000, 0x454b, 0x45cb, 0x253c, 0x4b34, 0x0000, 0x089b,
+	    0x4e1c, 0x4d36, 0x0000, 0x401a, 0x2678, 0x0000, 0x34c3, 0x3213,
+	    0x0000, 0x0000, 0x4a00, 0x02a9, 0x0b50, 0x0000, 0x0000, 0x0000,
+	    0x3d44, 0x3e17, 0x11b0, 0x0000, 0x159b, 0x0000, 0x3a0f, 0x0000,
+	    0x0db7, 0x37d5, 0x0d99, 0x0000, 0x12b0, 0x1c65, 0x46e7, 0x0000,
+	    0x3b72, 0x228d, 0x0b5b, 0x4cff, 0x0000, 0x2d01, 0x12e3, 0x0153,
+	    0x1f37, 0x397e, 0x1490, 0x0000, 0x0a46, 0x0000, 0x0000, 0x0573,
+	    0x2cec, 0x1b32, 0x2ca2, 0x486f, 0x0000, 0x11c4, 0x0d25, 0x2f8c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x35eb, 0x36bc, 0x0000, 0x148b,
+	    0x2d17, 0x326f, 0x254e, 0x3a45, 0x086d, 0x00f5, 0x06c0, 0x0294,
+	    0x0000, 0x1cf2, 0x0000, 0x181c, 0x3859, 0x2cb7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1b8f, 0x35d3, 0x1fd7, 0x1753, 0x19d8, 0x0000,
+	    0x0000, 0x2e53, 0x0000, 0x2e62, 0x0000, 0x20ca, 0x0000, 0x131d,
+	    0x0000, 0x0000, 0x2201, 0x3f7b, 0x4215, 0x1592, 0x0000, 0x44c2,
+	    0x0211, 0x0000, 0x149d, 0x0000, 0x083d, 0x2248, 0x25d9, 0x39e0,
+	    0x0000, 0x0000, 0x34ec, 0x0000, 0x15e2, 0x17fa, 0x301a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1708, 0x0000, 0x0000, 0x4d40,
+	    0x14a7, 0x0000, 0x3ead, 0x2041, 0x4458, 0x2c86, 0x0000, 0x390d,
+	    0x0920, 0x0000, 0x43b1, 0x33da, 0x24ae, 0x4737, 0x0000, 0x0000,
+	    0x0985, 0x22b8, 0x0000, 0x0000, 0x13cb, 0x4966, 0x06c3, 0x0000,
+	    0x13eb, 0x0000, 0x3681, 0x0000, 0x35ab, 0x0000, 0x0803, 0x0000,
+	    0x2060, 0x40bf, 0x3a42, 0x210e, 0x4b73, 0x1093, 0x4c47, 0x3ba9,
+	    0x0000, 0x2cec, 0x1f06, 0x271b, 0x0000, 0x4703, 0x2349, 0x34c2,
+	    0x0000, 0x2475, 0x0000, 0x0000, 0x3428, 0x0b03, 0x4066, 0x0000,
+	    0x0000, 0x0000, 0x07d0, 0x0000, 0x0eaf, 0x0000, 0x0000, 0x3a09,
+	    0x3bcb, 0x4198, 0x3ae5, 0x0000, 0x4927, 0x3331, 0x0000, 0x3ca4,
+	    0x3242, 0x3949, 0x3cfb, 0x0a03, 0x155f, 0x39ac, 0x156c, 0x0000,
+	    0x0000, 0x0bc1, 0x0c8e, 0x017e, 0x0000, 0x0000, 0x03b9, 0x0000,
+	    0x0000, 0x0000, 0x01c0, 0x0000, 0x0000, 0x15bb, 0x0000, 0x260b,
+	    0x374a, 0x1de9, 0x1e83, 0x20c7, 0x2e23, 0x02c2, 0x0000, 0x444c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01c6, 0x0000, 0x4482, 0x3ab5, 0x0000, 0x0000, 0x0f05,
+	    0x1293, 0x027a, 0x4264, 0x28f9, 0x4271, 0x0000, 0x0065, 0x0000,
+	    0x0000, 0x260b, 0x25f0, 0x34f2, 0x0000, 0x265c, 0x1eea, 0x0657,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x045b, 0x45e4, 0x13a6,
+	    0x0000, 0x1602, 0x0000, 0x0000, 0x0000, 0x1437, 0x30d3, 0x16b9,
+	    0x0000, 0x3286, 0x3ac2, 0x3690, 0x4da6, 0x0000, 0x1b51, 0x4c68,
+	    0x4542, 0x0000, 0x4173, 0x0000, 0x3b07, 0x0000, 0x3ffa, 0x24c9,
+	    0x0000, 0x2fad, 0x0000, 0x3c1b, 0x4793, 0x074a, 0x0000, 0x0000,
+	    0x276e, 0x2e51, 0x1b53, 0x0000, 0x0000, 0x0552, 0x0000, 0x0000,
+	    0x26d6, 0x121a, 0x4073, 0x0733, 0x0000, 0x1251, 0x0fba, 0x0000,
+	    0x2fdd, 0x4562, 0x0000, 0x2fd2, 0x0ee7, 0x0000, 0x11c0, 0x4953,
+	    0x2d10, 0x2c1b, 0x0000, 0x0fd6, 0x2d98, 0x0506, 0x08fc, 0x0000,
+	    0x0b0c, 0x4d4d, 0x1273, 0x0000, 0x1b65, 0x0000, 0x0000, 0x3b96,
+	    0x0aa3, 0x10d2, 0x0000, 0x08ff, 0x1e9f, 0x0000, 0x0000, 0x0000,
+	    0x0372, 0x0000, 0x1d08, 0x0000, 0x4184, 0x0005, 0x0000, 0x0000,
+	    0x49bb, 0x2637, 0x38c9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x22f9, 0x0000, 0x0000, 0x0000, 0x48d0, 0x0000, 0x0000, 0x0000,
+	    0x44ec, 0x0000, 0x1149, 0x06b8, 0x2dc7, 0x0000, 0x29d8, 0x0000,
+	    0x0ccc, 0x0000, 0x0015, 0x0671, 0x329f, 0x0f0b, 0x0000, 0x0000,
+	    0x4b1d, 0x3c9e, 0x4306, 0x0000, 0x3686, 0x157c, 0x3988, 0x06ba,
+	    0x0000, 0x0fb6, 0x44b0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0263, 0x2ab8, 0x2658, 0x0000, 0x0000, 0x36e1, 0x0000, 0x2799,
+	    0x38ab, 0x0000, 0x0000, 0x0000, 0x3bdc, 0x0000, 0x0000, 0x4cdc,
+	    0x14b6, 0x0000, 0x4841, 0x0974, 0x3bdb, 0x0000, 0x0000, 0x183c,
+	    0x425d, 0x2c27, 0x0000, 0x4be9, 0x0000, 0x0f9d, 0x0000, 0x4529,
+	    0x1fe1, 0x0000, 0x01a6, 0x0000, 0x0000, 0x2659, 0x114d, 0x189c,
+	    0x1046, 0x0000, 0x0000, 0x1254, 0x2592, 0x0000, 0x3e7d, 0x0000,
+	    0x0000, 0x0000, 0x12c4, 0x092b, 0x390c, 0x0000, 0x343d, 0x0f4c,
+	    0x251c, 0x0000, 0x3b4d, 0x04b8, 0x0bea, 0x0597, 0x03d1, 0x3e48,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4982, 0x0000, 0x3e96, 0x0000,
+	    0x4aff, 0x0ea0, 0x00f2, 0x0000, 0x0000, 0x0000, 0x0b73, 0x050a,
+	    0x15a6, 0x4b4b, 0x3cc9, 0x0000, 0x1cac, 0x0000, 0x024e, 0x0000,
+	    0x0000, 0x3a91, 0x3986, 0x0000, 0x3737, 0x0000, 0x0000, 0x24ab,
+	    0x0000, 0x0c3e, 0x21ea, 0x49c5, 0x31f7, 0x0000, 0x0089, 0x0000,
+	    0x032f, 0x0000, 0x0000, 0x0000, 0x47d2, 0x0000, 0x32dd, 0x0926,
+	    0x185e, 0x42ff, 0x327a, 0x0000, 0x0000, 0x0c15, 0x0000, 0x1070,
+	    0x47e2, 0x0000, 0x3e25, 0x2d03, 0x0000, 0x0000, 0x0000, 0x343c,
+	    0x2bc8, 0x285d, 0x02e6, 0x256a, 0x0311, 0x453f, 0x0000, 0x0000,
+	    0x1817, 0x366c, 0x2ea5, 0x0000, 0x1f1c, 0x0000, 0x3d20, 0x4416,
+	    0x2192, 0x0000, 0x3edd, 0x1f7e, 0x1596, 0x0000, 0x4b48, 0x0000,
+	    0x20f7, 0x0000, 0x0000, 0x3824, 0x33e9, 0x0000, 0x01fb, 0x28f2,
+	    0x0000, 0x0000, 0x0000, 0x4a2c, 0x24e2, 0x0000, 0x33e6, 0x0000,
+	    0x0000, 0x0000, 0x4d8d, 0x0000, 0x0000, 0x3bd3, 0x0000, 0x1831,
+	    0x0000, 0x0000, 0x37f6, 0x0000, 0x2090, 0x0000, 0x0990, 0x4b60,
+	    0x0c06, 0x17d6, 0x2c64, 0x0000, 0x0000, 0x0000, 0x2edf, 0x4860,
+	    0x4a62, 0x4b06, 0x0000, 0x0000, 0x0000, 0x0000, 0x4392, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0137,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4c37, 0x3917, 0x3444, 0x2080,
+	    0x0000, 0x45bf, 0x0000, 0x0000, 0x4cad, 0x0000, 0x0000, 0x0000,
+	    0x4164, 0x0000, 0x42d1, 0x0000, 0x0000, 0x0000, 0x2a24, 0x0000,
+	    0x1eaa, 0x0000, 0x311b, 0x26fa, 0x4ab0, 0x21b5, 0x0000, 0x4ae9,
+	    0x385a, 0x30bc, 0x47fc, 0x0000, 0x2608, 0x0000, 0x019e, 0x0000,
+	    0x1572, 0x2aab, 0x363c, 0x1c85, 0x4509, 0x0d78, 0x0000, 0x0000,
+	    0x29ce, 0x0000, 0x195f, 0x1226, 0x0000, 0x3b17, 0x267e, 0x0000,
+	    0x0000, 0x48a9, 0x009c, 0x300e, 0x0000, 0x0000, 0x0000, 0x03bf,
+	    0x0000, 0x35e8, 0x45e1, 0x2827, 0x0000, 0x0000, 0x0000, 0x41b6,
+	    0x0000, 0x0000, 0x3985, 0x0000, 0x0000, 0x056d, 0x0000, 0x0000,
+	    0x410a, 0x0000, 0x0000, 0x194f, 0x0000, 0x1b5b, 0x0000, 0x0000,
+	    0x0000, 0x3a1f, 0x0a91, 0x0384, 0x38a1, 0x4b4a, 0x0000, 0x0000,
+	    0x0000, 0x3df9, 0x41ec, 0x0000, 0x102e, 0x2395, 0x0000, 0x01dc,
+	    0x4730, 0x433c, 0x07ce, 0x0000, 0x0000, 0x1151, 0x0000, 0x4b4f,
+	    0x0000, 0x1a29, 0x0000, 0x0000, 0x0000, 0x4d31, 0x3786, 0x46cb,
+	    0x0000, 0x3266, 0x30ad, 0x4421, 0x14cb, 0x049e, 0x38e7, 0x0000,
+	    0x3b9f, 0x4046, 0x0000, 0x0000, 0x0000, 0x0000, 0x00de, 0x0000,
+	    0x0000, 0x0569, 0x4a86, 0x194b, 0x136f, 0x0000, 0x4b63, 0x132b,
+	    0x2281, 0x0000, 0x0000, 0x000a, 0x1a95, 0x018c, 0x10b9, 0x0000,
+	    0x1ddf, 0x29df, 0x1396, 0x0000, 0x407b, 0x36a1, 0x0000, 0x02d0,
+	    0x0000, 0x0000, 0x0000, 0x0945, 0x0000, 0x0000, 0x2290, 0x2da2,
+	    0x1ab8, 0x0000, 0x3e97, 0x30d8, 0x0000, 0x1f33, 0x2b4b, 0x2b2c,
+	    0x0397, 0x0000, 0x1162, 0x4019, 0x44be, 0x1468, 0x0000, 0x3822,
+	    0x23b3, 0x0000, 0x4d14, 0x0000, 0x22fb, 0x3e00, 0x0000, 0x0000,
+	    0x4128, 0x3bcb, 0x0000, 0x0000, 0x1be5, 0x2ee7, 0x0000, 0x0e3f,
+	    0x311b, 0x3217, 0x3c52, 0x0000, 0x2c82, 0x2938, 0x11eb, 0x3f29,
+	    0x2f4b, 0x0000, 0x3f5d, 0x4bc5, 0x49bb, 0x0000, 0x2c26, 0x0000,
+	    0x057a, 0x249f, 0x0488, 0x0000, 0x3504, 0x0000, 0x0000, 0x0000,
+	    0x0f8d, 0x2685, 0x03dc, 0x38db, 0x0276, 0x0000, 0x2955, 0x0eac,
+	    0x1827, 0x0189, 0x29bd, 0x07a5, 0x322a, 0x4744, 0x0000, 0x0bb1,
+	    0x0000, 0x0f53, 0x0000, 0x4af0, 0x10dd, 0x0000, 0x3a1f, 0x2472,
+	    0x1f9c, 0x0000, 0x098e, 0x2bba, 0x3963, 0x0000, 0x2b19, 0x0000,
+	    0x1eae, 0x0519, 0x245f, 0x0000, 0x0e5f, 0x0000, 0x0815, 0x0000,
+	    0x0000, 0x0000, 0x3350, 0x0000, 0x26f9, 0x0b39, 0x212b, 0x0000,
+	    0x0000, 0x0f24, 0x0000, 0x3cf0, 0x1034, 0x3d48, 0x45dd, 0x2ca8,
+	    0x0d8e, 0x2077, 0x0000, 0x0000, 0x4c57, 0x2dea, 0x39ea, 0x291d,
+	    0x2a02, 0x2e12, 0x0000, 0x0000, 0x0000, 0x4801, 0x293e, 0x08ed,
+	    0x0af1, 0x103d, 0x0000, 0x1d6c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x11e6, 0x112a, 0x0000, 0x0087, 0x0000, 0x3a80, 0x1378,
+	    0x0000, 0x0000, 0x2c10, 0x0000, 0x030c, 0x0ecf, 0x3232, 0x13ab,
+	    0x0d3b, 0x2295, 0x0000, 0x1677, 0x0000, 0x0000, 0x32a8, 0x1457,
+	    0x0f18, 0x3a27, 0x42cd, 0x2399, 0x2d9f, 0x0000, 0x374d, 0x14e7,
+	    0x0000, 0x0443, 0x2bf4, 0x0000, 0x425c, 0x2830, 0x4976, 0x08cc,
+	    0x30bd, 0x0000, 0x273e, 0x3f60, 0x0e84, 0x0000, 0x18f5, 0x0000,
+	    0x0000, 0x1561, 0x3c35, 0x0000, 0x0000, 0x04fb, 0x4221, 0x2010,
+	    0x46d4, 0x2657, 0x3958, 0x0000, 0x0531, 0x193b, 0x0c28, 0x3eaf,
+	    0x4d84, 0x0000, 0x11f1, 0x0000, 0x2e93, 0x1a6a, 0x4b46, 0x0000,
+	    0x0000, 0x0000, 0x1de5, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b8c,
+	    0x0000, 0x3549, 0x2a38, 0x0000, 0x254b, 0x0000, 0x1043, 0x2b2e,
+	    0x0000, 0x0000, 0x469b, 0x2a3c, 0x0e19, 0x0d52, 0x2840, 0x0008,
+	    0x46b9, 0x06d7, 0x0917, 0x0000, 0x428e, 0x0000, 0x0000, 0x0ae6,
+	    0x0000, 0x4a5d, 0x1060, 0x00f9, 0x0000, 0x39b6, 0x22fe, 0x0000,
+	    0x48c4, 0x0000, 0x48d1, 0x0000, 0x0000, 0x23bb, 0x18a4, 0x441e,
+	    0x1d52, 0x0000, 0x2a66, 0x4707, 0x47bc, 0x29a0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4547, 0x3f63, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x41ed, 0x3f33, 0x1ea2, 0x22ea, 0x0000, 0x3beb,
+	    0x0000, 0x01b2, 0x3346, 0x0000, 0x0000, 0x4162, 0x0000, 0x3199,
+	    0x0000, 0x0000, 0x0000, 0x0ea5, 0x4cd9, 0x0000, 0x0000, 0x08ad,
+	    0x0000, 0x0a59, 0x0ba2, 0x0000, 0x0000, 0x0000, 0x3ff2, 0x1462,
+	    0x3fbd, 0x0000, 0x0a21, 0x230a, 0x40f1, 0x1bde, 0x21a1, 0x0000,
+	    0x2477, 0x2726, 0x0000, 0x0000, 0x0000, 0x354a, 0x0000, 0x3c92,
+	    0x406a, 0x0000, 0x0000, 0x0000, 0x12c7, 0x16a0, 0x034d, 0x0000,
+	    0x14d7, 0x0edc, 0x0ba8, 0x0000, 0x49c3, 0x0000, 0x3f27, 0x3fc2,
+	    0x213b, 0x2494, 0x4d27, 0x3c90, 0x0000, 0x0000, 0x2942, 0x0000,
+	    0x4221, 0x0000, 0x0000, 0x410d, 0x0000, 0x34af, 0x0000, 0x0000,
+	    0x1834, 0x3927, 0x0000, 0x0000, 0x0976, 0x4c7e, 0x0048, 0x1f9f,
+	    0x002e, 0x2014, 0x20ff, 0x0000, 0x41af, 0x468f, 0x0000, 0x0bee,
+	    0x0cf9, 0x0000, 0x0000, 0x0000, 0x3398, 0x0000, 0x32c3, 0x22b3,
+	    0x1757, 0x33b3, 0x3fe0, 0x2732, 0x0000, 0x35c0, 0x3e80, 0x40b2,
+	    0x0000, 0x3dad, 0x466d, 0x0000, 0x0000, 0x0de1, 0x4423, 0x0000,
+	    0x45e9, 0x0000, 0x0000, 0x0000, 0x2c3b, 0x1143, 0x0000, 0x3a6e,
+	    0x012e, 0x2b18, 0x0000, 0x374b, 0x3749, 0x150d, 0x3a36, 0x0000,
+	    0x141e, 0x2ebc, 0x1015, 0x294f, 0x2bf5, 0x0000, 0x0000, 0x0000,
+	    0x3205, 0x0308, 0x48cf, 0x1b4a, 0x0000, 0x0000, 0x0000, 0x2fef,
+	    0x0000, 0x0000, 0x0d63, 0x445e, 0x1ffd, 0x1c83, 0x0c63, 0x43f9,
+	    0x2c01, 0x0000, 0x0000, 0x1359, 0x0000, 0x0000, 0x092e, 0x49b2,
+	    0x0000, 0x3d94, 0x0c74, 0x0572, 0x22f6, 0x0000, 0x4464, 0x3bc5,
+	    0x28ee, 0x0000, 0x246c, 0x02ed, 0x1e73, 0x0000, 0x4d66, 0x0000,
+	    0x0000, 0x0000, 0x4b4a, 0x3304, 0x0000, 0x49e3, 0x2758, 0x39f8,
+	    0x4dfe, 0x0000, 0x0000, 0x22f1, 0x338f, 0x0000, 0x3255, 0x1313,
+	    0x0000, 0x027b, 0x0000, 0x0000, 0x48bf, 0x0000, 0x3607, 0x0d92,
+	    0x0492, 0x0000, 0x027e, 0x42b9, 0x38e1, 0x0000, 0x18bf, 0x46e8,
+	    0x0000, 0x2c73, 0x1329, 0x0000, 0x29c6, 0x4e0a, 0x0e0b, 0x0000,
+	    0x28a7, 0x2df9, 0x4b62, 0x01d9, 0x14a6, 0x0000, 0x0000, 0x0000,
+	    0x1591, 0x17ff, 0x3be0, 0x162a, 0x0e4a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2b53, 0x0000, 0x43a8, 0x0000, 0x0000, 0x1964,
+	    0x1ce4, 0x0000, 0x0000, 0x1654, 0x32fb, 0x43c7, 0x1ae3, 0x03c0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3347, 0x198a, 0x137b,
+	    0x0000, 0x16db, 0x4269, 0x3dc7, 0x4baa, 0x0000, 0x0000, 0x1687,
+	    0x3d1f, 0x0000, 0x478a, 0x1059, 0x1472, 0x4c84, 0x2ad5, 0x0197,
+	    0x0000, 0x4bdc, 0x0000, 0x0000, 0x0000, 0x43e3, 0x0ec8, 0x26a7,
+	    0x3db9, 0x0000, 0x0000, 0x3327, 0x0000, 0x0000, 0x2709, 0x0000,
+	    0x07d1, 0x25a4, 0x3bdd, 0x0000, 0x18cb, 0x2bb2, 0x0000, 0x04be,
+	    0x2eff, 0x0000, 0x3cfb, 0x0000, 0x34fb, 0x25b1, 0x1c2e, 0x0000,
+	    0x3d70, 0x22b5, 0x4804, 0x0000, 0x0000, 0x0f76, 0x0000, 0x0000,
+	    0x0000, 0x0957, 0x0000, 0x349d, 0x25ff, 0x2dc0, 0x0000, 0x2261,
+	    0x1a61, 0x31e6, 0x0000, 0x0000, 0x0663, 0x0000, 0x347d, 0x26d7,
+	    0x34f8, 0x0000, 0x140b, 0x173b, 0x0000, 0x0b89, 0x17cd, 0x0000,
+	    0x0000, 0x299b, 0x0000, 0x2c0f, 0x0000, 0x426e, 0x0000, 0x1bb1,
+	    0x0000, 0x0000, 0x19d9, 0x0000, 0x1890, 0x46dd, 0x0214, 0x3022,
+	    0x1ebb, 0x0000, 0x3d4f, 0x4a97, 0x0000, 0x371e, 0x3463, 0x0341,
+	    0x19ba, 0x0000, 0x0000, 0x4058, 0x0000, 0x1c8f, 0x2756, 0x0000,
+	    0x0000, 0x0000, 0x24ac, 0x181a, 0x0000, 0x0000, 0x2050, 0x4a41,
+	    0x1044, 0x0000, 0x0000, 0x0474, 0x0000, 0x0000, 0x0000, 0x14cc,
+	    0x4519, 0x3d83, 0x11c1, 0x0000, 0x0000, 0x0000, 0x1378, 0x13ea,
+	    0x11cb, 0x4af6, 0x09f3, 0x4be9, 0x0c7e, 0x0000, 0x2797, 0x0000,
+	    0x0000, 0x12d4, 0x3525, 0x2537, 0x0000, 0x3daa, 0x260d, 0x0000,
+	    0x0000, 0x1986, 0x0000, 0x39a7, 0x0000, 0x0000, 0x24b7, 0x273d,
+	    0x0000, 0x16ac, 0x0000, 0x0edd, 0x0000, 0x1ae9, 0x0000, 0x4551,
+	    0x05fe, 0x0000, 0x0000, 0x065a, 0x0520, 0x2b9b, 0x04de, 0x2fc7,
+	    0x158a, 0x4a2a, 0x0000, 0x39f3, 0x0944, 0x0000, 0x301d, 0x0000,
+	    0x0000, 0x15f8, 0x46da, 0x0000, 0x0000, 0x4ccb, 0x2bbf, 0x0000,
+	    0x1b78, 0x0000, 0x42e2, 0x0000, 0x09f6, 0x4a8b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x05af, 0x0000, 0x36f8, 0x176f,
+	    0x0000, 0x3160, 0x0000, 0x0000, 0x0000, 0x0698, 0x2f0d, 0x0000,
+	    0x1e49, 0x0000, 0x0000, 0x0000, 0x0000, 0x3029, 0x0000, 0x290c,
+	    0x0000, 0x3666, 0x0000, 0x2d32, 0x1e2a, 0x0000, 0x402f, 0x242c,
+	    0x37e8, 0x35db, 0x1030, 0x0000, 0x0000, 0x0000, 0x0000, 0x19a9,
+	    0x2fe3, 0x2b9f, 0x0000, 0x4e13, 0x048e, 0x0000, 0x063c, 0x0000,
+	    0x4198, 0x0000, 0x4d6a, 0x3ca7, 0x0000, 0x33da, 0x0000, 0x1589,
+	    0x0000, 0x0000, 0x0fa2, 0x1981, 0x24c4, 0x2138, 0x0000, 0x0953,
+	    0x1817, 0x2691, 0x07ff, 0x13bc, 0x0000, 0x07df, 0x138d, 0x0000,
+	    0x0000, 0x2206, 0x0000, 0x0000, 0x0000, 0x0000, 0x4152, 0x0000,
+	    0x1ffe, 0x4cb4, 0x190c, 0x406d, 0x40c9, 0x0000, 0x0f4e, 0x0000,
+	    0x0000, 0x3d35, 0x0000, 0x0d05, 0x0e16, 0x060f, 0x47c4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x26d9, 0x0000, 0x0000, 0x0000,
+	    0x4bb1, 0x1200, 0x0000, 0x0000, 0x2df0, 0x2e99, 0x0000, 0x0000,
+	    0x0e49, 0x23dc, 0x18b8, 0x0000, 0x0000, 0x4cba, 0x4b82, 0x0000,
+	    0x2034, 0x16ce, 0x3889, 0x16e0, 0x2592, 0x0046, 0x0000, 0x389e,
+	    0x0000, 0x4501, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x076b, 0x0f28, 0x28c1, 0x0000, 0x2834, 0x21ba, 0x0e8e, 0x4595,
+	    0x2fda, 0x090c, 0x4806, 0x0000, 0x26b9, 0x1a30, 0x0000, 0x0000,
+	    0x3720, 0x3fab, 0x4a4c, 0x0000, 0x0000, 0x48cb, 0x4a2a, 0x330a,
+	    0x0000, 0x4c00, 0x0000, 0x432f, 0x0a9f, 0x4e18, 0x434c, 0x1df3,
+	    0x12a4, 0x0000, 0x4791, 0x00de, 0x0000, 0x00f9, 0x0000, 0x4dab,
+	    0x0000, 0x0000, 0x0000, 0x0c36, 0x321d, 0x0000, 0x04c1, 0x219a,
+	    0x278d, 0x0000, 0x0000, 0x2692, 0x0000, 0x306d, 0x0000, 0x3589,
+	    0x48c6, 0x06e7, 0x0000, 0x1f0b, 0x0000, 0x2d3c, 0x46bd, 0x3d50,
+	    0x25fd, 0x0000, 0x09ec, 0x05eb, 0x304f, 0x1e24, 0x3409, 0x0000,
+	    0x017b, 0x0000, 0x3157, 0x0000, 0x0000, 0x0000, 0x3e5b, 0x0000,
+	    0x0000, 0x46f8, 0x0000, 0x317f, 0x0000, 0x487f, 0x0000, 0x3aab,
+	    0x0000, 0x0000, 0x4258, 0x0000, 0x3b0d, 0x0000, 0x2c10, 0x0000,
+	    0x0000, 0x04bf, 0x0000, 0x01ec, 0x1727, 0x49c2, 0x1cb2, 0x0000,
+	    0x45b1, 0x3190, 0x0000, 0x4538, 0x0000, 0x0000, 0x3678, 0x2c40,
+	    0x0000, 0x2bac, 0x2a5e, 0x0000, 0x0000, 0x17c5, 0x11f1, 0x2ae7,
+	    0x334d, 0x0000, 0x2ee5, 0x1f1e, 0x2397, 0x487d, 0x03f1, 0x0000,
+	    0x2940, 0x1185, 0x494c, 0x0000, 0x0000, 0x0000, 0x287e, 0x4400,
+	    0x32a8, 0x0000, 0x0000, 0x0000, 0x2429, 0x0000, 0x0d85, 0x0000,
+	    0x0000, 0x0000, 0x0523, 0x1346, 0x0ff5, 0x05a5, 0x1d6d, 0x29f3,
+	    0x0000, 0x2be0, 0x0000, 0x01c0, 0x0000, 0x34e4, 0x0fd9, 0x167a,
+	    0x34d8, 0x01bd, 0x0000, 0x0b40, 0x1cd8, 0x2142, 0x0000, 0x0000,
+	    0x4039, 0x1d20, 0x2feb, 0x2ec4, 0x43d1, 0x0000, 0x0000, 0x3754,
+	    0x0000, 0x0000, 0x27cd, 0x4148, 0x2b17, 0x1cfa, 0x16dc, 0x08fa,
+	    0x066f, 0x1a4a, 0x20a7, 0x22d4, 0x44f2, 0x2e3e, 0x15cf, 0x0000,
+	    0x0000, 0x0000, 0x1902, 0x0000, 0x0000, 0x0000, 0x0000, 0x145e,
+	    0x007a, 0x46de, 0x0000, 0x473c, 0x42da, 0x0000, 0x1939, 0x4b9a,
+	    0x48e6, 0x4284, 0x2444, 0x4d92, 0x4474, 0x1051, 0x0000, 0x0000,
+	    0x0000, 0x4843, 0x196f, 0x0f4f, 0x0000, 0x0000, 0x20cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0050, 0x1f3f, 0x0e1f, 0x1113,
+	    0x0000, 0x4d98, 0x04de, 0x1cff, 0x0000, 0x2452, 0x0000, 0x0000,
+	    0x0000, 0x4bd3, 0x09e7, 0x0000, 0x228a, 0x0000, 0x151a, 0x0000,
+	    0x3be9, 0x02b8, 0x0000, 0x4b4e, 0x0159, 0x0000, 0x2b9c, 0x15f1,
+	    0x4a68, 0x1ac8, 0x0000, 0x1614, 0x0b43, 0x0000, 0x0000, 0x04a5,
+	    0x4c8a, 0x45ca, 0x0000, 0x0000, 0x0000, 0x0aae, 0x0000, 0x3c70,
+	    0x1e35, 0x0000, 0x0000, 0x0000, 0x3761, 0x21e8, 0x33cc, 0x240c,
+	    0x0000, 0x457b, 0x0402, 0x0cf6, 0x0000, 0x32cf, 0x2bd7, 0x0000,
+	    0x0000, 0x0e5e, 0x0000, 0x1a58, 0x2b85, 0x0645, 0x0000, 0x4a6f,
+	    0x0000, 0x0000, 0x4537, 0x0000, 0x00be, 0x4236, 0x1f5c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2c53, 0x0000, 0x0000, 0x4017,
+	    0x4927, 0x267c, 0x4af3, 0x0000, 0x0000, 0x0000, 0x2569, 0x06e4,
+	    0x4ace, 0x2f02, 0x4663, 0x1910, 0x071a, 0x4632, 0x2d87, 0x0000,
+	    0x0ce2, 0x1472, 0x0000, 0x10ce, 0x0000, 0x04d7, 0x1491, 0x0000,
+	    0x1e45, 0x0479, 0x0000, 0x0000, 0x29c4, 0x0000, 0x1bc6, 0x094e,
+	    0x3843, 0x1685, 0x08a3, 0x05ce, 0x147d, 0x0000, 0x0000, 0x2995,
+	    0x0000, 0x0000, 0x3b55, 0x0dbe, 0x0000, 0x34ac, 0x0000, 0x394c,
+	    0x19a8, 0x0000, 0x0e3c, 0x2066, 0x216f, 0x0000, 0x3076, 0x0000,
+	    0x16a5, 0x0000, 0x0000, 0x0000, 0x203c, 0x09bb, 0x3ec7, 0x1554,
+	    0x0000, 0x0b35, 0x0ad8, 0x1e60, 0x332a, 0x0000, 0x3984, 0x0000,
+	    0x0670, 0x0f72, 0x0000, 0x0000, 0x0000, 0x1c29, 0x0b62, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4660, 0x2e5b, 0x0000, 0x4b78,
+	    0x185b, 0x147d, 0x2e94, 0x0000, 0x2d8c, 0x101d, 0x09d7, 0x0000,
+	    0x0000, 0x370c, 0x313f, 0x0000, 0x0e35, 0x3910, 0x43d4, 0x0000,
+	    0x27d5, 0x0000, 0x0566, 0x0000, 0x0000, 0x1a78, 0x1c7f, 0x280c,
+	    0x0000, 0x3974, 0x0000, 0x4170, 0x0000, 0x26ab, 0x0000, 0x210b,
+	    0x0027, 0x0000, 0x0000, 0x0000, 0x08d2, 0x03a6, 0x3a88, 0x0000,
+	    0x0000, 0x16de, 0x0000, 0x10de, 0x0000, 0x0000, 0x0000, 0x37bb,
+	    0x0000, 0x0000, 0x0000, 0x29f0, 0x04b3, 0x04c9, 0x0000, 0x0bbe,
+	    0x2e57, 0x3195, 0x0000, 0x0000, 0x0000, 0x3afd, 0x0000, 0x2a42,
+	    0x395f, 0x0000, 0x17ad, 0x0000, 0x0000, 0x4097, 0x0000, 0x0000,
+	    0x0000, 0x34aa, 0x0000, 0x0000, 0x0c41, 0x46c0, 0x166e, 0x0000,
+	    0x1a49, 0x0000, 0x0000, 0x1d61, 0x0000, 0x0e33, 0x0000, 0x0c5e,
+	    0x42a8, 0x19d3, 0x0000, 0x1b10, 0x1ee1, 0x0723, 0x1955, 0x1afa,
+	    0x0fe9, 0x0000, 0x0000, 0x339c, 0x0ced, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2b83, 0x26be, 0x0000, 0x0406, 0x0a95, 0x17c9, 0x0000,
+	    0x04de, 0x063f, 0x36db, 0x40c8, 0x0000, 0x25b6, 0x0000, 0x1b73,
+	    0x2468, 0x4741, 0x1423, 0x1ac1, 0x428f, 0x0000, 0x0000, 0x485a,
+	    0x0000, 0x423c, 0x0000, 0x0000, 0x0000, 0x209f, 0x42bc, 0x3863,
+	    0x0e37, 0x0348, 0x0000, 0x0000, 0x1355, 0x417a, 0x0000, 0x0000,
+	    0x202f, 0x3560, 0x2deb, 0x2cd5, 0x28cb, 0x412d, 0x0000, 0x2b48,
+	    0x4479, 0x0000, 0x0000, 0x0000, 0x3198, 0x4b5a, 0x3fa3, 0x0000,
+	    0x2551, 0x0c39, 0x0000, 0x0000, 0x0dce, 0x0000, 0x0000, 0x273c,
+	    0x258f, 0x0000, 0x394a, 0x2ae4, 0x279c, 0x1da1, 0x4336, 0x01cc,
+	    0x21ac, 0x2b45, 0x0000, 0x17f6, 0x275f, 0x0000, 0x0297, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4223, 0x4740, 0x0000, 0x0bce, 0x07e9,
+	    0x4335, 0x0000, 0x3a27, 0x1f79, 0x0000, 0x3827, 0x48aa, 0x3999,
+	    0x2546, 0x0000, 0x0000, 0x2251, 0x1aac, 0x0000, 0x0000, 0x1db0,
+	    0x0000, 0x0000, 0x0bbe, 0x0000, 0x4cbc, 0x18ce, 0x0000, 0x0000,
+	    0x3f22, 0x0000, 0x30e9, 0x2167, 0x2de0, 0x0000, 0x1ca1, 0x0000,
+	    0x0000, 0x0000, 0x4add, 0x1480, 0x211b, 0x0000, 0x2211, 0x2b0c,
+	    0x046e, 0x146a, 0x421c, 0x1072, 0x0000, 0x0000, 0x0000, 0x31f2,
+	    0x0000, 0x0000, 0x43ef, 0x0000, 0x325f, 0x04c7, 0x0000, 0x4ce0,
+	    0x0000, 0x0000, 0x3ea7, 0x46bc, 0x243d, 0x4778, 0x35a1, 0x48c9,
+	    0x47b4, 0x3e66, 0x24a9, 0x205c, 0x0000, 0x1edd, 0x250f, 0x40de,
+	    0x0000, 0x0af7, 0x0000, 0x3a53, 0x2d2d, 0x0000, 0x3e46, 0x0000,
+	    0x47d1, 0x0000, 0x0000, 0x0000, 0x06f7, 0x0000, 0x0000, 0x1325,
+	    0x1f47, 0x0000, 0x0000, 0x4276, 0x0000, 0x0000, 0x341a, 0x1f80,
+	    0x0000, 0x0000, 0x22f3, 0x0000, 0x0000, 0x0000, 0x30b3, 0x0000,
+	    0x4c65, 0x0000, 0x0000, 0x0000, 0x376f, 0x0000, 0x0000, 0x0000,
+	    0x157d, 0x113e, 0x42ef, 0x12ae, 0x0578, 0x0000, 0x3db4, 0x0000,
+	    0x0000, 0x0c5b, 0x0000, 0x161f, 0x245e, 0x2453, 0x0279, 0x0abe,
+	    0x260e, 0x0000, 0x0fef, 0x42a5, 0x0000, 0x0000, 0x0000, 0x1e0d,
+	    0x0fa4, 0x17ae, 0x0000, 0x23c7, 0x2749, 0x0000, 0x0000, 0x2f42,
+	    0x0167, 0x0000, 0x082a, 0x21b5, 0x0000, 0x2643, 0x04f1, 0x0000,
+	    0x4c85, 0x2572, 0x1d66, 0x16b3, 0x4abd, 0x380a, 0x0000, 0x26eb,
+	    0x2bbe, 0x32e6, 0x4a3d, 0x0000, 0x48ba, 0x0000, 0x3cf7, 0x3b39,
+	    0x1027, 0x0000, 0x3024, 0x303c, 0x4777, 0x2671, 0x1206, 0x2ee6,
+	    0x28cc, 0x0000, 0x0000, 0x02ad, 0x0000, 0x0000, 0x0000, 0x371f,
+	    0x0000, 0x0f83, 0x0387, 0x0000, 0x0000, 0x0000, 0x4bc9, 0x1f69,
+	    0x09da, 0x11fe, 0x4dfb, 0x3e4a, 0x33ec, 0x1e39, 0x0000, 0x0000,
+	    0x2c6a, 0x0000, 0x42b8, 0x0d32, 0x20d5, 0x1280, 0x20e9, 0x38bb,
+	    0x4262, 0x173f, 0x4bf5, 0x0000, 0x0d6d, 0x0000, 0x0000, 0x1e78,
+	    0x0512, 0x49da, 0x4aba, 0x0b4d, 0x437b, 0x0000, 0x11bc, 0x14d3,
+	    0x15a7, 0x2b88, 0x18dd, 0x20f4, 0x09d7, 0x274b, 0x1e59, 0x0000,
+	    0x0f5b, 0x1c6d, 0x2c89, 0x0d6b, 0x0000, 0x0000, 0x488f, 0x303d,
+	    0x0000, 0x0000, 0x0000, 0x43d0, 0x1c7d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x20ec, 0x0000, 0x2e55, 0x283f, 0x428d,
+	    0x09d8, 0x122b, 0x264a, 0x0000, 0x0ed7, 0x411b, 0x315d, 0x0000,
+	    0x0000, 0x3d0e, 0x0000, 0x0000, 0x00c2, 0x0000, 0x0000, 0x4bb1,
+	    0x4a18, 0x2d10, 0x0000, 0x2f3a, 0x1f65, 0x0692, 0x0000, 0x058c,
+	    0x1ee2, 0x2e2a, 0x28e7, 0x1804, 0x31c3, 0x3943, 0x0000, 0x0000,
+	    0x0000, 0x100d, 0x0000, 0x0000, 0x13bd, 0x0000, 0x0000, 0x46fc,
+	    0x0000, 0x0000, 0x39ed, 0x3c5f, 0x1255, 0x2d59, 0x0000, 0x0000,
+	    0x4204, 0x1144, 0x011f, 0x1e05, 0x0000, 0x2bea, 0x0000, 0x2647,
+	    0x44f6, 0x1c2d, 0x0d61, 0x28f0, 0x0000, 0x0000, 0x0862, 0x1697,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1468, 0x15aa, 0x0000, 0x4d93,
+	    0x451f, 0x0000, 0x0000, 0x4cb1, 0x43af, 0x11b2, 0x0000, 0x4873,
+	    0x256a, 0x4b3e, 0x0000, 0x0000, 0x3b17, 0x2ca6, 0x2575, 0x0000,
+	    0x0000, 0x07f8, 0x0ae3, 0x0000, 0x0000, 0x0a65, 0x0000, 0x0000,
+	    0x11d3, 0x12c3, 0x0000, 0x0000, 0x2fa6, 0x0000, 0x2ab0, 0x397d,
+	    0x43db, 0x0000, 0x3e13, 0x0000, 0x251f, 0x0000, 0x0000, 0x4789,
+	    0x4abe, 0x0000, 0x4b49, 0x2a02, 0x13cd, 0x0000, 0x0000, 0x3c5b,
+	    0x18dc, 0x0000, 0x368f, 0x3620, 0x2aec, 0x0000, 0x0e0f, 0x0000,
+	    0x0000, 0x26f6, 0x3218, 0x2bb6, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2f1b, 0x0000, 0x4619, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x016f, 0x4b52, 0x1800, 0x189c, 0x0000,
+	    0x0fb3, 0x0000, 0x1a42, 0x44a7, 0x48cc, 0x17b3, 0x4055, 0x379d,
+	    0x45f1, 0x0c84, 0x179d, 0x2f84, 0x0ea0, 0x2f6d, 0x0000, 0x0cf8,
+	    0x2fb1, 0x0000, 0x4101, 0x0000, 0x213e, 0x2060, 0x0000, 0x0000,
+	    0x1d24, 0x27f8, 0x0c69, 0x0000, 0x41fc, 0x4475, 0x0767, 0x2f6b,
+	    0x0f3f, 0x0000, 0x314d, 0x0000, 0x0000, 0x2d7d, 0x3115, 0x0000,
+	    0x3f7d, 0x0000, 0x134e, 0x00d3, 0x0000, 0x0000, 0x09a4, 0x0000,
+	    0x0000, 0x05f7, 0x2d99, 0x38f6, 0x44d0, 0x0000, 0x0000, 0x0000,
+	    0x1a01, 0x0000, 0x0000, 0x0000, 0x0f03, 0x3dce, 0x0000, 0x0000,
+	    0x469b, 0x0000, 0x48d9, 0x0000, 0x0000, 0x2eb3, 0x0f9a, 0x1df3,
+	    0x37df, 0x4c54, 0x4862, 0x352d, 0x0000, 0x0000, 0x1cb9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4296, 0x0000, 0x0000,
+	    0x0000, 0x0207, 0x18ef, 0x4772, 0x38a7, 0x1216, 0x0068, 0x3533,
+	    0x0000, 0x0000, 0x05d9, 0x307a, 0x24c7, 0x0000, 0x4a69, 0x26dd,
+	    0x0000, 0x0000, 0x0000, 0x4a7b, 0x23c5, 0x3b07, 0x0000, 0x0000,
+	    0x0000, 0x3dda, 0x0b2d, 0x3bfe, 0x0000, 0x0000, 0x0000, 0x16fb,
+	    0x0000, 0x483d, 0x07aa, 0x0000, 0x1749, 0x0000, 0x0000, 0x0000,
+	    0x13de, 0x233d, 0x1d3b, 0x0000, 0x22c7, 0x26c8, 0x3b3c, 0x0000,
+	    0x3a62, 0x0eda, 0x3372, 0x15e6, 0x35a0, 0x4083, 0x281b, 0x14ef,
+	    0x0fd6, 0x22eb, 0x0000, 0x31af, 0x1641, 0x1394, 0x261c, 0x0000,
+	    0x4e11, 0x0000, 0x0000, 0x3fe1, 0x28ac, 0x3cc5, 0x0000, 0x3cc0,
+	    0x0000, 0x1193, 0x0000, 0x0000, 0x0000, 0x0000, 0x36ec, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x318b, 0x3c0d, 0x3f62, 0x415a, 0x0000,
+	    0x3da5, 0x000a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x049a, 0x0000, 0x42c7, 0x0000, 0x0742, 0x0000, 0x34fa,
+	    0x1c87, 0x0000, 0x3562, 0x2bdb, 0x4487, 0x0000, 0x4d1f, 0x0000,
+	    0x0000, 0x396b, 0x1723, 0x46fd, 0x2d52, 0x0000, 0x0000, 0x0000,
+	    0x04a6, 0x0b02, 0x139a, 0x3ba9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2583, 0x0fbe, 0x078c, 0x04e0, 0x17a1, 0x3384, 0x0000, 0x3cd2,
+	    0x0000, 0x060e, 0x0000, 0x4138, 0x0000, 0x0000, 0x3478, 0x0000,
+	    0x2ac2, 0x3f7c, 0x0aa9, 0x0000, 0x260f, 0x0000, 0x0000, 0x0455,
+	    0x21c9, 0x3e8b, 0x1544, 0x0182, 0x1456, 0x0000, 0x33f4, 0x0c32,
+	    0x0000, 0x31cb, 0x43fd, 0x0000, 0x171b, 0x0000, 0x0000, 0x04fe,
+	    0x0000, 0x0000, 0x139c, 0x2953, 0x42dd, 0x3969, 0x475d, 0x46b4,
+	    0x450f, 0x432d, 0x26d5, 0x1e7e, 0x27bc, 0x41d8, 0x0000, 0x0000,
+	    0x0000, 0x15fb, 0x2e97, 0x1a30, 0x0000, 0x0000, 0x138d, 0x433f,
+	    0x26ad, 0x2686, 0x0000, 0x2012, 0x0000, 0x0000, 0x0000, 0x2549,
+	    0x17d8, 0x128c, 0x1afa, 0x013e, 0x0000, 0x48ec, 0x0000, 0x2f62,
+	    0x0000, 0x2b80, 0x0c4a, 0x48b8, 0x446a, 0x40b7, 0x0000, 0x0000,
+	    0x2777, 0x0000, 0x25f5, 0x0faa, 0x068a, 0x1890, 0x0d5e, 0x2fe9,
+	    0x0000, 0x41e7, 0x38ca, 0x498d, 0x0000, 0x07e1, 0x479f, 0x352b,
+	    0x16c6, 0x0559, 0x3aea, 0x0000, 0x0000, 0x1ebc, 0x0000, 0x0000,
+	    0x0000, 0x4156, 0x02b2, 0x0000, 0x0000, 0x0000, 0x367e, 0x2a5c,
+	    0x2fff, 0x0000, 0x0000, 0x2875, 0x2207, 0x2975, 0x0000, 0x0000,
+	    0x0000, 0x047d, 0x0000, 0x003f, 0x168d, 0x0000, 0x3cb9, 0x0000,
+	    0x0aa4, 0x0000, 0x4006, 0x4484, 0x0000, 0x0000, 0x032a, 0x0c30,
+	    0x0640, 0x0000, 0x0583, 0x3332, 0x1423, 0x442a, 0x0000, 0x11ae,
+	    0x3b65, 0x3c2e, 0x1e5c, 0x4b71, 0x2025, 0x0000, 0x0000, 0x1310,
+	    0x00ff, 0x169f, 0x0000, 0x0000, 0x0000, 0x45fa, 0x196e, 0x0466,
+	    0x44cd, 0x0000, 0x4667, 0x0000, 0x4cfd, 0x0000, 0x0eca, 0x2249,
+	    0x2129, 0x2758, 0x0000, 0x1997, 0x38b2, 0x35a1, 0x434a, 0x177a,
+	    0x40ab, 0x0000, 0x3c14, 0x0000, 0x04b7, 0x1652, 0x1860, 0x34e1,
+	    0x0000, 0x04f5, 0x0000, 0x4121, 0x482e, 0x03be, 0x34ea, 0x435a,
+	    0x0c5d, 0x29da, 0x2941, 0x0000, 0x0000, 0x333d, 0x38f4, 0x11f2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x309e, 0x0000,
+	    0x254a, 0x0000, 0x0000, 0x0000, 0x06e9, 0x0000, 0x0000, 0x0000,
+	    0x3e83, 0x42a5, 0x0000, 0x2013, 0x199c, 0x0aaa, 0x204a, 0x114f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2f62, 0x2198, 0x4960, 0x3286,
+	    0x2629, 0x0000, 0x0000, 0x0000, 0x2126, 0x4de4, 0x0000, 0x0000,
+	    0x1b4e, 0x0000, 0x0000, 0x37a9, 0x34e5, 0x2cd3, 0x0241, 0x47bc,
+	    0x33cb, 0x2be5, 0x4917, 0x4064, 0x0000, 0x1a44, 0x0000, 0x34cc,
+	    0x170a, 0x2354, 0x2cab, 0x0000, 0x0000, 0x0000, 0x435a, 0x366c,
+	    0x27ad, 0x0da4, 0x472e, 0x2eac, 0x19d5, 0x0db4, 0x2bac, 0x0000,
+	    0x445a, 0x3f63, 0x0000, 0x04a1, 0x18b8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1c61, 0x06f4, 0x3800, 0x206f, 0x0000, 0x1002, 0x139a,
+	    0x0b3b, 0x0000, 0x0000, 0x3c87, 0x1bc4, 0x4da3, 0x0000, 0x0000,
+	    0x19fa, 0x0000, 0x0dea, 0x0000, 0x0000, 0x0000, 0x31bf, 0x1cf3,
+	    0x25ae, 0x3966, 0x26fd, 0x412c, 0x0000, 0x3d08, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1f26, 0x070e, 0x209b, 0x375b, 0x0c4e, 0x0000,
+	    0x0000, 0x0000, 0x4535, 0x0000, 0x42c1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1b74, 0x3257, 0x1c74, 0x0000, 0x2b1f, 0x1f75, 0x3969,
+	    0x3be7, 0x0f9d, 0x4639, 0x3896, 0x0000, 0x42a9, 0x109e, 0x073e,
+	    0x0000, 0x041b, 0x0000, 0x2077, 0x36bd, 0x0000, 0x3acd, 0x11cf,
+	    0x4c6d, 0x0fd1, 0x0000, 0x3248, 0x3c13, 0x0000, 0x3d0a, 0x0000,
+	    0x0000, 0x08da, 0x0000, 0x2336, 0x108f, 0x32f5, 0x38f5, 0x0000,
+	    0x0000, 0x0b04, 0x035d, 0x2ad9, 0x42b7, 0x0412, 0x0000, 0x1a3a,
+	    0x1acb, 0x1479, 0x0000, 0x26de, 0x114f, 0x1b0e, 0x0000, 0x0000,
+	    0x196f, 0x23d3, 0x0fa3, 0x0000, 0x1065, 0x0000, 0x2166, 0x0000,
+	    0x0000, 0x293c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3323, 0x275b, 0x2321, 0x1adf, 0x0000, 0x328e, 0x0d2e, 0x47fd,
+	    0x0f11, 0x0000, 0x0000, 0x2176, 0x3ca4, 0x0000, 0x4bac, 0x0000,
+	    0x311d, 0x367f, 0x33af, 0x1616, 0x0000, 0x195e, 0x0288, 0x0000,
+	    0x2bd0, 0x1ccd, 0x4366, 0x12a3, 0x41f2, 0x0000, 0x0398, 0x323f,
+	    0x294c, 0x15c2, 0x0000, 0x0000, 0x3c61, 0x2e68, 0x0000, 0x0000,
+	    0x1440, 0x0000, 0x1407, 0x2477, 0x125e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2703, 0x11b3, 0x27e2, 0x1895, 0x0dfd, 0x4593,
+	    0x0000, 0x2b48, 0x02b1, 0x0000, 0x02af, 0x294e, 0x29ec, 0x4258,
+	    0x3a6b, 0x0b59, 0x0281, 0x48f4, 0x45c5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e3a, 0x0000, 0x3826, 0x0000, 0x1195, 0x1e38,
+	    0x2b56, 0x0000, 0x0000, 0x0d80, 0x0000, 0x3041, 0x1fe7, 0x1b2b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1e42, 0x0830, 0x056c, 0x0000,
+	    0x0000, 0x0904, 0x0000, 0x0000, 0x0000, 0x0000, 0x3892, 0x0000,
+	    0x0000, 0x0000, 0x3b33, 0x0e48, 0x25a2, 0x015e, 0x2cae, 0x1f2f,
+	    0x0000, 0x0000, 0x2d83, 0x0000, 0x228c, 0x04b6, 0x2898, 0x0000,
+	    0x4081, 0x0000, 0x4481, 0x0000, 0x372e, 0x4d8b, 0x16ba, 0x29f0,
+	    0x2f6e, 0x0000, 0x0000, 0x0189, 0x0110, 0x0000, 0x0000, 0x0000,
+	    0x1bd1, 0x1884, 0x0000, 0x1d9e, 0x397f, 0x0000, 0x3dc2, 0x0000,
+	    0x0000, 0x2166, 0x0000, 0x25a3, 0x1eb7, 0x0000, 0x0000, 0x311d,
+	    0x0000, 0x0000, 0x465c, 0x0000, 0x0000, 0x0000, 0x0000, 0x2494,
+	    0x35f5, 0x0000, 0x0000, 0x2c76, 0x115c, 0x0000, 0x11d8, 0x0000,
+	    0x0000, 0x0169, 0x0000, 0x4d6d, 0x0000, 0x3128, 0x0000, 0x0000,
+	    0x0000, 0x2634, 0x0000, 0x39ff, 0x4b2e, 0x248a, 0x0000, 0x3be5,
+	    0x2ded, 0x0000, 0x0000, 0x1639, 0x0000, 0x0000, 0x0000, 0x3305,
+	    0x07b6, 0x0000, 0x0000, 0x0378, 0x0000, 0x0000, 0x4a99, 0x0000,
+	    0x0715, 0x19fd, 0x3018, 0x138f, 0x49e6, 0x0000, 0x41ab, 0x0000,
+	    0x4701, 0x0000, 0x0000, 0x3f0b, 0x0b19, 0x32b0, 0x0000, 0x0000,
+	    0x43af, 0x007f, 0x0000, 0x0000, 0x39f8, 0x2cd5, 0x2d54, 0x0000,
+	    0x0f2c, 0x0d9e, 0x3415, 0x35b8, 0x3ff3, 0x0bbb, 0x0000, 0x325d,
+	    0x0000, 0x4458, 0x0000, 0x372c, 0x4962, 0x0000, 0x2f94, 0x0000,
+	    0x3f92, 0x0000, 0x1bf4, 0x1932, 0x4477, 0x1a59, 0x2936, 0x0000,
+	    0x469d, 0x3c10, 0x0000, 0x4876, 0x1b60, 0x0000, 0x0000, 0x3090,
+	    0x4182, 0x3d28, 0x22f4, 0x21fd, 0x0000, 0x0000, 0x0d69, 0x00f9,
+	    0x0000, 0x0000, 0x239e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2a77, 0x0000, 0x0000, 0x4418, 0x0000, 0x1202, 0x4021,
+	    0x4bca, 0x0000, 0x2588, 0x3f87, 0x2889, 0x4697, 0x0000, 0x3d8f,
+	    0x36d9, 0x0000, 0x0000, 0x1e41, 0x0000, 0x1ea8, 0x0000, 0x0000,
+	    0x0000, 0x088b, 0x2e82, 0x3bde, 0x263f, 0x084a, 0x0000, 0x2a51,
+	    0x3255, 0x1806, 0x0000, 0x273e, 0x48b4, 0x3870, 0x4d6d, 0x0000,
+	    0x1386, 0x0c16, 0x2265, 0x26cb, 0x01d9, 0x0000, 0x0000, 0x2e8e,
+	    0x1891, 0x2585, 0x0000, 0x0000, 0x3a96, 0x0000, 0x0f49, 0x08a8,
+	    0x0000, 0x0000, 0x0000, 0x2a26, 0x2894, 0x4169, 0x0000, 0x299e,
+	    0x23b1, 0x0000, 0x0000, 0x0c70, 0x3a9f, 0x4d70, 0x0000, 0x0000,
+	    0x3607, 0x30ea, 0x0c2e, 0x2bc9, 0x440d, 0x147c, 0x0000, 0x4860,
+	    0x0000, 0x4604, 0x27c8, 0x0000, 0x239c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x18f7, 0x335a, 0x4137, 0x0000, 0x18a0, 0x3181,
+	    0x0000, 0x0000, 0x4c01, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4792, 0x0000, 0x0770, 0x03a9, 0x0000, 0x2a3b, 0x0ebe,
+	    0x4057, 0x27b8, 0x0000, 0x0000, 0x471f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x198b, 0x34bb, 0x0000,
+	    0x20b5, 0x0000, 0x2633, 0x0440, 0x3040, 0x3c3e, 0x1193, 0x0000,
+	    0x16fe, 0x294b, 0x4b6d, 0x317a, 0x38b3, 0x0000, 0x429e, 0x2c47,
+	    0x0000, 0x3d3e, 0x0000, 0x3860, 0x1781, 0x1cb8, 0x0f6d, 0x0000,
+	    0x1ef6, 0x427d, 0x0000, 0x0000, 0x0000, 0x24f9, 0x0000, 0x0b9b,
+	    0x001d, 0x183c, 0x1dd9, 0x00e5, 0x0000, 0x4473, 0x21e1, 0x401d,
+	    0x0000, 0x0a08, 0x1349, 0x0000, 0x4b51, 0x0000, 0x0000, 0x2643,
+	    0x3271, 0x354c, 0x0063, 0x0b9b, 0x1f40, 0x1868, 0x4403, 0x0000,
+	    0x0000, 0x21f9, 0x0000, 0x0000, 0x4329, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x47d5, 0x4153, 0x2c4c, 0x30b5, 0x140d, 0x329f,
+	    0x4dea, 0x0000, 0x0000, 0x23f9, 0x480e, 0x0000, 0x119f, 0x0000,
+	    0x0000, 0x3853, 0x3fab, 0x0000, 0x0000, 0x0000, 0x271f, 0x3074,
+	    0x01c8, 0x0000, 0x2285, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000,
+	    0x0000, 0x0000, 0x0000, 0x0bda, 0x15e1, 0x2ef1, 0x0000, 0x22c7,
+	    0x0319, 0x1085, 0x12ac, 0x374d, 0x0000, 0x2e0d, 0x15e1, 0x11da,
+	    0x48ea, 0x0607, 0x0000, 0x0f96, 0x3581, 0x2256, 0x0000, 0x031a,
+	    0x0000, 0x399c, 0x0000, 0x47bd, 0x1d64, 0x352e, 0x1a96, 0x0000,
+	    0x0000, 0x2a0f, 0x0000, 0x489e, 0x0000, 0x091c, 0x0000, 0x0000,
+	    0x3eac, 0x0000, 0x11a7, 0x0b92, 0x0000, 0x097c, 0x0000, 0x09cc,
+	    0x0000, 0x0fcf, 0x2eca, 0x24b4, 0x0000, 0x0000, 0x2fd8, 0x2c06,
+	    0x0000, 0x2a25, 0x0d02, 0x32d6, 0x0000, 0x0000, 0x09eb, 0x0000,
+	    0x0000, 0x3864, 0x2bae, 0x0000, 0x370e, 0x0000, 0x087c, 0x0000,
+	    0x49b0, 0x0000, 0x12bc, 0x270e, 0x10a6, 0x2c6d, 0x25d3, 0x47ef,
+	    0x0000, 0x0000, 0x0000, 0x4059, 0x0000, 0x0000, 0x0e8a, 0x0000,
+	    0x15d9, 0x00a5, 0x064d, 0x15ab, 0x15a8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3757, 0x0000, 0x0000, 0x0000, 0x3f4b, 0x0000,
+	    0x0e2b, 0x0000, 0x33fd, 0x0000, 0x3a60, 0x449e, 0x3f33, 0x1d4b,
+	    0x080d, 0x3f85, 0x34aa, 0x1d5b, 0x3f79, 0x2ce9, 0x40a1, 0x0000,
+	    0x0000, 0x0000, 0x3cac, 0x0000, 0x0000, 0x0178, 0x1a34, 0x0000,
+	    0x361f, 0x49b3, 0x342f, 0x0000, 0x1526, 0x206a, 0x0000, 0x0000,
+	    0x398c, 0x30c9, 0x0000, 0x3f9e, 0x0000, 0x48ca, 0x0804, 0x0000,
+	    0x0cd7, 0x3f22, 0x49c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1731,
+	    0x0000, 0x0725, 0x33cd, 0x0000, 0x2e60, 0x0000, 0x212b, 0x0000,
+	    0x481f, 0x06cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2480,
+	    0x3359, 0x0000, 0x0000, 0x0000, 0x3fc2, 0x1d21, 0x0000, 0x0000,
+	    0x32c0, 0x2494, 0x0000, 0x0000, 0x0000, 0x388b, 0x1c37, 0x280b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3c4e, 0x0000, 0x2deb, 0x08ef,
+	    0x0ae6, 0x38db, 0x0000, 0x4834, 0x07c4, 0x0000, 0x3b89, 0x0000,
+	    0x0758, 0x294e, 0x2d6d, 0x1ef4, 0x0000, 0x1d80, 0x0000, 0x37db,
+	    0x32a5, 0x0000, 0x127f, 0x376a, 0x203d, 0x15c6, 0x0000, 0x20ae,
+	    0x0000, 0x0000, 0x0000, 0x0bdf, 0x2d89, 0x2f4f, 0x2004, 0x0000,
+	    0x1cbd, 0x0fc7, 0x4bec, 0x2b11, 0x0f00, 0x3fa6, 0x0000, 0x14b9,
+	    0x0000, 0x482f, 0x2b95, 0x3e85, 0x0000, 0x0000, 0x24cf, 0x184e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0937, 0x3f41, 0x139d, 0x2188,
+	    0x0000, 0x3330, 0x20a2, 0x0000, 0x357f, 0x0698, 0x0000, 0x49ce,
+	    0x3f92, 0x47ee, 0x0000, 0x4b90, 0x0000, 0x0000, 0x0000, 0x3bf9,
+	    0x47f8, 0x031a, 0x0000, 0x480b, 0x2b03, 0x0000, 0x0000, 0x43ce,
+	    0x48ec, 0x03d0, 0x101d, 0x484e, 0x21e6, 0x0000, 0x0000, 0x0000,
+	    0x1519, 0x0000, 0x0000, 0x1d6f, 0x0000, 0x449d, 0x2b87, 0x28bd,
+	    0x0955, 0x3b01, 0x0000, 0x0000, 0x38bd, 0x0000, 0x12b2, 0x1d4a,
+	    0x157e, 0x0000, 0x0e0a, 0x0000, 0x0000, 0x1de3, 0x1824, 0x0000,
+	    0x3cb7, 0x1448, 0x2085, 0x0000, 0x0000, 0x0000, 0x1514, 0x0000,
+	    0x0563, 0x0847, 0x0000, 0x0000, 0x3e95, 0x0000, 0x0ae1, 0x10c4,
+	    0x48f0, 0x0000, 0x0000, 0x1133, 0x1c6e, 0x0000, 0x3513, 0x0000,
+	    0x2009, 0x0000, 0x0000, 0x32e8, 0x4e16, 0x304b, 0x0000, 0x2093,
+	    0x2bd9, 0x0000, 0x0000, 0x0000, 0x0000, 0x14ef, 0x49a2, 0x0000,
+	    0x3d4c, 0x2746, 0x0d33, 0x0000, 0x02cd, 0x0000, 0x171f, 0x39a6,
+	    0x0000, 0x34b6, 0x3249, 0x1330, 0x0000, 0x1426, 0x0000, 0x0000,
+	    0x2add, 0x39e2, 0x3d22, 0x0919, 0x0000, 0x4610, 0x36e7, 0x0000,
+	    0x2dd6, 0x3abf, 0x0000, 0x39c4, 0x181a, 0x4175, 0x0000, 0x0000,
+	    0x42fc, 0x485d, 0x0000, 0x0000, 0x0000, 0x0533, 0x0000, 0x0000,
+	    0x2b50, 0x0f6f, 0x4e1a, 0x3e07, 0x354b, 0x0b7b, 0x0000, 0x0146,
+	    0x3642, 0x0000, 0x0000, 0x0000, 0x387d, 0x0000, 0x1673, 0x371c,
+	    0x25cb, 0x2e4e, 0x0000, 0x0000, 0x0000, 0x1e0e, 0x3a45, 0x3208,
+	    0x4dc4, 0x23f8, 0x0473, 0x1818, 0x44c4, 0x0000, 0x0bf4, 0x0310,
+	    0x2cd0, 0x230b, 0x2119, 0x0000, 0x0000, 0x0000, 0x36a2, 0x3bc6,
+	    0x48ad, 0x27f9, 0x16ab, 0x3869, 0x1cfb, 0x0000, 0x2a9c, 0x0000,
+	    0x0000, 0x0000, 0x44cc, 0x03ca, 0x0000, 0x0000, 0x4370, 0x38a6,
+	    0x28de, 0x0000, 0x0000, 0x0000, 0x4054, 0x1348, 0x0000, 0x0000,
+	    0x0000, 0x183a, 0x0000, 0x19f2, 0x1401, 0x42a4, 0x2fef, 0x358e,
+	    0x312e, 0x219d, 0x264e, 0x3b9c, 0x0000, 0x0000, 0x2d34, 0x0000,
+	    0x2ac4, 0x00c0, 0x0000, 0x0000, 0x3264, 0x1257, 0x0000, 0x0000,
+	    0x151e, 0x188b, 0x0000, 0x0000, 0x1b5d, 0x0000, 0x0000, 0x1863,
+	    0x0000, 0x2280, 0x0000, 0x42b7, 0x0000, 0x44ec, 0x0a5b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4c12, 0x3ad6, 0x0000, 0x1c84, 0x1a90,
+	    0x0048, 0x0000, 0x4ac1, 0x0000, 0x0000, 0x0000, 0x0000, 0x3198,
+	    0x18a1, 0x4053, 0x0d33, 0x359a, 0x0000, 0x4474, 0x0000, 0x3707,
+	    0x0000, 0x0000, 0x2afe, 0x3edf, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x13e2, 0x0000, 0x3bb1, 0x2997, 0x3b5a, 0x0000, 0x200a,
+	    0x3752, 0x1701, 0x0000, 0x0000, 0x007e, 0x463f, 0x2f5d, 0x41f5,
+	    0x4173, 0x3362, 0x1369, 0x1bc0, 0x0000, 0x40fa, 0x38ba, 0x0000,
+	    0x3153, 0x0000, 0x0000, 0x43fa, 0x4264, 0x29d2, 0x4a58, 0x0000,
+	    0x364c, 0x269b, 0x0000, 0x2acc, 0x01fb, 0x3b67, 0x23b2, 0x3250,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x392f, 0x42cd, 0x0000, 0x0000,
+	    0x2e57, 0x1d8c, 0x2e2d, 0x2b1b, 0x0000, 0x0000, 0x0000, 0x4119,
+	    0x0000, 0x2b7c, 0x1795, 0x4b46, 0x0000, 0x25c8, 0x0000, 0x0000,
+	    0x2962, 0x0000, 0x24ae, 0x2450, 0x0000, 0x27f7, 0x0000, 0x0d7e,
+	    0x0000, 0x0000, 0x0421, 0x0000, 0x0000, 0x0117, 0x3bd5, 0x4413,
+	    0x3225, 0x1bbf, 0x25fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x4063,
+	    0x0000, 0x03dd, 0x4aef, 0x0000, 0x0000, 0x310b, 0x0000, 0x0000,
+	    0x2c53, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ec8, 0x0000, 0x0000,
+	    0x1e7f, 0x47bd, 0x1507, 0x1865, 0x166b, 0x0000, 0x0000, 0x0000,
+	    0x1647, 0x20ff, 0x191b, 0x0000, 0x0000, 0x0000, 0x2385, 0x0000,
+	    0x0000, 0x0000, 0x3792, 0x4222, 0x3133, 0x0526, 0x0000, 0x0000,
+	    0x0000, 0x099e, 0x330b, 0x0000, 0x09a6, 0x2c0f, 0x0000, 0x0cee,
+	    0x0000, 0x0e73, 0x0000, 0x0000, 0x13e8, 0x0000, 0x0000, 0x22d0,
+	    0x1744, 0x2973, 0x17e1, 0x0000, 0x0000, 0x37b2, 0x1a47, 0x2844,
+	    0x0000, 0x0dfa, 0x4932, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2dca, 0x1efd, 0x0670, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x27e2, 0x0000, 0x1560, 0x0000, 0x1839, 0x1a05, 0x0000, 0x1d64,
+	    0x4044, 0x2616, 0x236a, 0x2a95, 0x3a7f, 0x057e, 0x0d5b, 0x39b0,
+	    0x0a1f, 0x0000, 0x4906, 0x0000, 0x4296, 0x0000, 0x3832, 0x405b,
+	    0x2e5d, 0x1e53, 0x0a15, 0x0000, 0x0000, 0x2bee, 0x39e4, 0x292c,
+	    0x1829, 0x0eaa, 0x41b4, 0x45fd, 0x1581, 0x0000, 0x20a8, 0x0aac,
+	    0x3c2d, 0x1237, 0x2d86, 0x192a, 0x0000, 0x2a97, 0x29c5, 0x0000,
+	    0x0202, 0x2a57, 0x20c2, 0x0000, 0x0e4d, 0x0000, 0x0909, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3180, 0x2061, 0x3c9b,
+	    0x1833, 0x019d, 0x0000, 0x0000, 0x0000, 0x3205, 0x177a, 0x08d7,
+	    0x0000, 0x3c90, 0x0000, 0x0000, 0x0eee, 0x28c4, 0x25a1, 0x2456,
+	    0x3f93, 0x0000, 0x2196, 0x1028, 0x0000, 0x0000, 0x4c4f, 0x0000,
+	    0x0000, 0x0610, 0x466c, 0x0000, 0x3017, 0x1ac9, 0x1a1e, 0x264f,
+	    0x1748, 0x1f1d, 0x3722, 0x005d, 0x0000, 0x0000, 0x3b08, 0x0000,
+	    0x0000, 0x4646, 0x20d4, 0x0000, 0x44d2, 0x0000, 0x45c0, 0x126f,
+	    0x20a6, 0x1aa1, 0x4929, 0x0000, 0x4a33, 0x0000, 0x14f9, 0x0000,
+	    0x0000, 0x0000, 0x17c0, 0x0000, 0x0000, 0x0000, 0x2cdc, 0x41ef,
+	    0x44e3, 0x011b, 0x2760, 0x0000, 0x0000, 0x2c70, 0x0000, 0x0669,
+	    0x0000, 0x0000, 0x0000, 0x4cf1, 0x109b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4c40, 0x3678, 0x4cb0, 0x0000, 0x1c76, 0x0000,
+	    0x18c3, 0x0000, 0x0bcc, 0x43be, 0x0424, 0x0000, 0x0346, 0x0000,
+	    0x227e, 0x3424, 0x237a, 0x207d, 0x0000, 0x11c6, 0x0000, 0x0000,
+	    0x4c50, 0x0000, 0x07a8, 0x1fe5, 0x0000, 0x37d8, 0x41eb, 0x1c39,
+	    0x082e, 0x0000, 0x0000, 0x0000, 0x0000, 0x16b3, 0x0000, 0x0151,
+	    0x0000, 0x433b, 0x41e8, 0x07b7, 0x0000, 0x2c7a, 0x0a1b, 0x0a4f,
+	    0x0b42, 0x0000, 0x00f4, 0x0000, 0x205d, 0x0000, 0x0000, 0x06e6,
+	    0x01ae, 0x39cc, 0x1c97, 0x0ce8, 0x23d1, 0x2f18, 0x2ae4, 0x0000,
+	    0x1f84, 0x09ec, 0x0000, 0x0000, 0x4823, 0x0819, 0x0000, 0x0000,
+	    0x0ac4, 0x3f87, 0x0000, 0x2bad, 0x0000, 0x3fc5, 0x0000, 0x1072,
+	    0x1913, 0x0000, 0x0cd2, 0x44e4, 0x3173, 0x0000, 0x0000, 0x0000,
+	    0x02d8, 0x0000, 0x0000, 0x0ee3, 0x33ca, 0x0000, 0x0949, 0x23fa,
+	    0x0000, 0x072a, 0x0000, 0x0000, 0x17c3, 0x0000, 0x0000, 0x42fb,
+	    0x366b, 0x4ced, 0x3e08, 0x0000, 0x0000, 0x133c, 0x0000, 0x405b,
+	    0x0106, 0x295e, 0x0000, 0x26eb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1fb5, 0x0000, 0x32f7, 0x0000, 0x0000, 0x45dc,
+	    0x1123, 0x0000, 0x0f96, 0x1fa6, 0x1016, 0x0000, 0x3964, 0x38bf,
+	    0x005a, 0x3440, 0x07a2, 0x420b, 0x0000, 0x1607, 0x0000, 0x0000,
+	    0x0000, 0x478e, 0x0000, 0x266b, 0x00ab, 0x0000, 0x158b, 0x22c9,
+	    0x007f, 0x0c8e, 0x04ea, 0x0000, 0x22a6, 0x0000, 0x0a81, 0x4a46,
+	    0x0000, 0x3d8e, 0x30af, 0x0000, 0x420f, 0x343c, 0x1c9c, 0x1c3e,
+	    0x3fab, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c02, 0x48fd, 0x09ae,
+	    0x0000, 0x0000, 0x0000, 0x063e, 0x26a8, 0x1aab, 0x0000, 0x0000,
+	    0x22d6, 0x041b, 0x0000, 0x248e, 0x0000, 0x0d5a, 0x0000, 0x0000,
+	    0x163a, 0x3b69, 0x0000, 0x0000, 0x22c5, 0x0000, 0x1597, 0x0000,
+	    0x0000, 0x0ff7, 0x0373, 0x0000, 0x3769, 0x3dad, 0x4bb0, 0x3cf5,
+	    0x16cd, 0x341e, 0x0000, 0x0000, 0x3835, 0x2606, 0x2d47, 0x0000,
+	    0x0000, 0x189d, 0x0c1b, 0x0000, 0x0000, 0x1790, 0x0000, 0x23ba,
+	    0x36ed, 0x0000, 0x0000, 0x0000, 0x3eb2, 0x2dc1, 0x1bef, 0x0000,
+	    0x0000, 0x01c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3380,
+	    0x0b15, 0x05d2, 0x1fde, 0x0000, 0x0000, 0x0000, 0x19e0, 0x0000,
+	    0x3200, 0x0000, 0x1d29, 0x249a, 0x0000, 0x2b6d, 0x0343, 0x3434,
+	    0x3288, 0x0000, 0x0000, 0x3c58, 0x1a6d, 0x0000, 0x350b, 0x0c72,
+	    0x4746, 0x17b6, 0x15e8, 0x0000, 0x3a1f, 0x0000, 0x21bc, 0x0000,
+	    0x1281, 0x0000, 0x0000, 0x07f3, 0x294d, 0x3bc1, 0x2e02, 0x0f98,
+	    0x31e8, 0x034e, 0x1bb6, 0x4692, 0x0f57, 0x1529, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x057c, 0x00a7, 0x0000, 0x148d, 0x0000, 0x0000,
+	    0x4a7f, 0x0000, 0x39de, 0x0431, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4a19, 0x4493, 0x0000, 0x0000,
+	    0x0949, 0x0000, 0x0000, 0x0000, 0x0000, 0x3eba, 0x0ab2, 0x363f,
+	    0x1b2f, 0x0000, 0x0180, 0x0b38, 0x0000, 0x2bfc, 0x2ed6, 0x1ad6,
+	    0x37c7, 0x2765, 0x155c, 0x4661, 0x0000, 0x4b99, 0x0000, 0x01fd,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x35bd,
+	    0x3cee, 0x0000, 0x0000, 0x0000, 0x3bb9, 0x0f2c, 0x4961, 0x0a30,
+	    0x15b3, 0x3e94, 0x1235, 0x0000, 0x1a5e, 0x4485, 0x09d9, 0x00f9,
+	    0x2bc1, 0x0000, 0x01f1, 0x0000, 0x426f, 0x0b45, 0x08fc, 0x0000,
+	    0x01ce, 0x1030, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f4e, 0x1a6a,
+	    0x0000, 0x4a46, 0x0000, 0x0000, 0x0000, 0x3366, 0x0000, 0x0913,
+	    0x0000, 0x3037, 0x0000, 0x0000, 0x107c, 0x3cdf, 0x0000, 0x3221,
+	    0x4106, 0x35fe, 0x4b03, 0x3f8a, 0x0000, 0x0c67, 0x0000, 0x1a2b,
+	    0x3857, 0x0000, 0x273b, 0x0a95, 0x0000, 0x1a53, 0x1c20, 0x0000,
+	    0x3386, 0x150b, 0x3c13, 0x0000, 0x1032, 0x1b3f, 0x0000, 0x0862,
+	    0x0000, 0x0000, 0x1aa5, 0x0000, 0x0000, 0x1694, 0x3d78, 0x4af1,
+	    0x0000, 0x467c, 0x0fdc, 0x0000, 0x0000, 0x4955, 0x0000, 0x0000,
+	    0x0000, 0x3072, 0x031c, 0x1a8f, 0x0000, 0x22dc, 0x0000, 0x0000,
+	    0x44c6, 0x4986, 0x47e9, 0x0000, 0x0000, 0x030b, 0x3ef4, 0x06b0,
+	    0x45bc, 0x1b1f, 0x0000, 0x0000, 0x0000, 0x020e, 0x0000, 0x0000,
+	    0x0224, 0x3dce, 0x06a3, 0x0000, 0x0000, 0x29df, 0x3677, 0x2969,
+	    0x0d6c, 0x3132, 0x181c, 0x2eed, 0x0ec9, 0x0000, 0x0000, 0x0000,
+	    0x13a8, 0x4ca0, 0x3a40, 0x0000, 0x0000, 0x3d3a, 0x0000, 0x37a4,
+	    0x0000, 0x1afe, 0x0000, 0x0000, 0x40bd, 0x3a23, 0x3d31, 0x0dfa,
+	    0x2e43, 0x0000, 0x0000, 0x4cd5, 0x039e, 0x20a6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2e54, 0x3597, 0x0000, 0x0000, 0x297f,
+	    0x0000, 0x0000, 0x0000, 0x0af8, 0x0000, 0x0000, 0x0000, 0x23f6,
+	    0x4107, 0x362e, 0x0000, 0x0000, 0x4091, 0x0000, 0x04ed, 0x1857,
+	    0x0000, 0x252b, 0x4a43, 0x003a, 0x0000, 0x3039, 0x0000, 0x0000,
+	    0x02f0, 0x0000, 0x0000, 0x4356, 0x2bda, 0x119e, 0x0000, 0x4695,
+	    0x3b31, 0x0000, 0x300e, 0x2ec3, 0x33cb, 0x0000, 0x404b, 0x171c,
+	    0x139a, 0x0000, 0x0000, 0x4693, 0x0000, 0x0000, 0x0000, 0x01a6,
+	    0x0000, 0x2daa, 0x0000, 0x3a6f, 0x0000, 0x0000, 0x0000, 0x1fe0,
+	    0x38f2, 0x432c, 0x0000, 0x35f2, 0x09c5, 0x0000, 0x445a, 0x0000,
+	    0x239d, 0x0000, 0x3930, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x15c8, 0x0d26, 0x12b0, 0x0000,
+	    0x0000, 0x1c06, 0x0000, 0x0a90, 0x0000, 0x0000, 0x09ce, 0x0000,
+	    0x0c28, 0x0000, 0x00bb, 0x0000, 0x3078, 0x0000, 0x42be, 0x0000,
+	    0x0cdc, 0x367d, 0x3a6c, 0x0000, 0x3d2e, 0x1f3e, 0x0000, 0x2602,
+	    0x3345, 0x0000, 0x3b5f, 0x0000, 0x34b1, 0x204f, 0x3990, 0x0000,
+	    0x1c95, 0x4144, 0x2520, 0x0000, 0x00c9, 0x18e1, 0x0000, 0x0000,
+	    0x0369, 0x236c, 0x1ba8, 0x00a0, 0x1170, 0x0000, 0x0000, 0x2384,
+	    0x2c7c, 0x0000, 0x0000, 0x0000, 0x0522, 0x4dad, 0x0000, 0x1b99,
+	    0x0100, 0x2cd9, 0x0455, 0x4659, 0x0e5e, 0x0000, 0x0000, 0x1d90,
+	    0x3e1b, 0x34ac, 0x045b, 0x0000, 0x0000, 0x0000, 0x075c, 0x355a,
+	    0x272e, 0x0000, 0x34be, 0x09da, 0x2ca6, 0x3124, 0x2223, 0x08b7,
+	    0x3292, 0x0000, 0x0201, 0x0cc8, 0x0000, 0x113b, 0x27a8, 0x19e0,
+	    0x08dd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3052, 0x0000,
+	    0x0000, 0x2b61, 0x4b67, 0x0000, 0x0000, 0x4833, 0x0000, 0x3517,
+	    0x0000, 0x0dab, 0x0000, 0x02d6, 0x4783, 0x0000, 0x23a8, 0x0000,
+	    0x1127, 0x3101, 0x0000, 0x138c, 0x22e1, 0x2612, 0x142e, 0x0000,
+	    0x0000, 0x29d5, 0x41de, 0x2a41, 0x3e05, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x25f9, 0x0000, 0x0000, 0x00a0, 0x31af, 0x358f,
+	    0x447e, 0x437b, 0x0000, 0x2e18, 0x258d, 0x0f70, 0x0000, 0x4439,
+	    0x32c1, 0x1bca, 0x1de0, 0x011f, 0x0000, 0x41f4, 0x0000, 0x09fa,
+	    0x25bf, 0x3393, 0x01c8, 0x35a3, 0x0136, 0x0000, 0x05c3, 0x0667,
+	    0x0000, 0x0000, 0x0731, 0x0000, 0x137c, 0x0000, 0x2aa5, 0x0a5f,
+	    0x3764, 0x0000, 0x0416, 0x1af7, 0x0000, 0x22e5, 0x3d18, 0x063f,
+	    0x044a, 0x0000, 0x3916, 0x0000, 0x1378, 0x1338, 0x16ac, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3ed7, 0x0000, 0x3363, 0x2b4e, 0x0000,
+	    0x343e, 0x379c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x026e, 0x0fbd, 0x2701, 0x0000, 0x22a3, 0x40e7, 0x442e, 0x3716,
+	    0x0000, 0x17ea, 0x0000, 0x0000, 0x0000, 0x4100, 0x4d2c, 0x0e53,
+	    0x0000, 0x19b0, 0x0000, 0x0000, 0x0000, 0x246a, 0x2234, 0x026b,
+	    0x4d55, 0x1471, 0x1619, 0x4572, 0x0c9e, 0x2505, 0x0000, 0x3bb1,
+	    0x0953, 0x2f9d, 0x0000, 0x2bc4, 0x0396, 0x0402, 0x30cc, 0x1f49,
+	    0x0e16, 0x258b, 0x2879, 0x2d3f, 0x4711, 0x4ac9, 0x08c1, 0x0000,
+	    0x0000, 0x4c3f, 0x3cd5, 0x2ad6, 0x056e, 0x1dd6, 0x1516, 0x0000,
+	    0x0000, 0x20d4, 0x377a, 0x0d65, 0x2abc, 0x2091, 0x2f43, 0x0dc3,
+	    0x2359, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42be, 0x3865,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3206, 0x25bf, 0x4be5, 0x100c,
+	    0x0000, 0x297a, 0x0000, 0x42b4, 0x0000, 0x0000, 0x2113, 0x0000,
+	    0x0000, 0x1eef, 0x1f9e, 0x409f, 0x4318, 0x0000, 0x0000, 0x3961,
+	    0x0f5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a25, 0x0000,
+	    0x0000, 0x46de, 0x173b, 0x19cf, 0x0000, 0x1a99, 0x0000, 0x24a4,
+	    0x0000, 0x1575, 0x07e5, 0x3dd9, 0x0000, 0x0000, 0x3d7a, 0x47ff,
+	    0x0000, 0x07ff, 0x0000, 0x3842, 0x2ca5, 0x0000, 0x1244, 0x225c,
+	    0x1f3f, 0x30e8, 0x001f, 0x0cdb, 0x0000, 0x0000, 0x3ace, 0x3621,
+	    0x09c9, 0x4504, 0x0000, 0x48fb, 0x3f3f, 0x0000, 0x0000, 0x2293,
+	    0x2231, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b65,
+	    0x0000, 0x4b6b, 0x0000, 0x0000, 0x0000, 0x4ccb, 0x0000, 0x0000,
+	    0x096f, 0x3c7f, 0x13d8, 0x1018, 0x011c, 0x43d8, 0x264a, 0x0000,
+	    0x0000, 0x0000, 0x4370, 0x2d11, 0x0000, 0x0e48, 0x1a10, 0x0000,
+	    0x36af, 0x0000, 0x0000, 0x41c2, 0x49a4, 0x0000, 0x0000, 0x0503,
+	    0x0000, 0x13da, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d80,
+	    0x0000, 0x3314, 0x0000, 0x0000, 0x4ba2, 0x2d1e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x27b0, 0x2fa6, 0x1e77, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x38ec, 0x0d41, 0x09e1, 0x3589, 0x0000,
+	    0x39fc, 0x0000, 0x2104, 0x0000, 0x0000, 0x0e64, 0x3bd5, 0x03a8,
+	    0x0c1c, 0x22fb, 0x2d89, 0x2d2b, 0x0000, 0x4daa, 0x0000, 0x3e56,
+	    0x0000, 0x0000, 0x4825, 0x48db, 0x0000, 0x14dc, 0x0000, 0x2e22,
+	    0x0000, 0x1c1f, 0x0000, 0x44a9, 0x180b, 0x0000, 0x10a4, 0x0000,
+	    0x0000, 0x00e7, 0x3b5c, 0x1c8e, 0x000c, 0x0d55, 0x0000, 0x0000,
+	    0x0d6c, 0x17d9, 0x28fc, 0x032d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3d6a, 0x2c80, 0x0f9d, 0x1674, 0x1c34, 0x0000, 0x2437, 0x3bf6,
+	    0x0000, 0x0000, 0x0000, 0x28be, 0x1d31, 0x0000, 0x0000, 0x226b,
+	    0x4278, 0x0e01, 0x0000, 0x0000, 0x0a41, 0x0000, 0x45b7, 0x0000,
+	    0x0000, 0x0000, 0x4869, 0x0000, 0x287e, 0x2b92, 0x0000, 0x29ad,
+	    0x2a45, 0x389d, 0x0000, 0x03c5, 0x44a6, 0x4dea, 0x30c8, 0x0000,
+	    0x0000, 0x0b37, 0x0000, 0x212b, 0x0000, 0x41c3, 0x1546, 0x2926,
+	    0x0000, 0x4cf6, 0x0bc4, 0x00a7, 0x0000, 0x0000, 0x40c6, 0x0000,
+	    0x0000, 0x0e40, 0x36f1, 0x0000, 0x2c4a, 0x01d8, 0x0000, 0x0ef8,
+	    0x0000, 0x0000, 0x0000, 0x25dd, 0x0000, 0x3310, 0x4240, 0x3321,
+	    0x3014, 0x1ce5, 0x0000, 0x0000, 0x3c57, 0x33c4, 0x41d0, 0x0000,
+	    0x3d97, 0x3e18, 0x0000, 0x1862, 0x0000, 0x3e9b, 0x0000, 0x0000,
+	    0x0000, 0x3ba4, 0x0000, 0x475a, 0x2e03, 0x0086, 0x3c33, 0x444d,
+	    0x4038, 0x0000, 0x3759, 0x0000, 0x0000, 0x0000, 0x3f66, 0x4bc4,
+	    0x442a, 0x0000, 0x0c0e, 0x0000, 0x2fdf, 0x0293, 0x0000, 0x1b60,
+	    0x0000, 0x0000, 0x3a9a, 0x0000, 0x419a, 0x0000, 0x1fc6, 0x0000,
+	    0x42f0, 0x0000, 0x18fc, 0x0000, 0x0000, 0x0000, 0x03b7, 0x0868,
+	    0x3f91, 0x0000, 0x3148, 0x0705, 0x3043, 0x0715, 0x0000, 0x0000,
+	    0x4a8f, 0x0000, 0x364e, 0x1a5d, 0x1091, 0x3afc, 0x2fa1, 0x06eb,
+	    0x0000, 0x32eb, 0x0000, 0x2d25, 0x0000, 0x0000, 0x0000, 0x4cc7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x22d8, 0x0000, 0x0000, 0x47b4,
+	    0x0000, 0x4856, 0x0fd9, 0x0000, 0x0000, 0x213b, 0x42ad, 0x391a,
+	    0x2302, 0x30d5, 0x0000, 0x0000, 0x116e, 0x06de, 0x024a, 0x1fa7,
+	    0x0000, 0x0000, 0x3016, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a56,
+	    0x0000, 0x4889, 0x0000, 0x2d0a, 0x0000, 0x1653, 0x0000, 0x48e0,
+	    0x0000, 0x0000, 0x30ae, 0x4b6e, 0x0000, 0x0000, 0x01ab, 0x4c17,
+	    0x0000, 0x4d10, 0x0000, 0x0000, 0x0000, 0x2e93, 0x1b0b, 0x274c,
+	    0x0373, 0x2b98, 0x3a44, 0x0000, 0x1fb0, 0x0d0f, 0x3773, 0x0000,
+	    0x043e, 0x3ac3, 0x0000, 0x239f, 0x1484, 0x000b, 0x4dc3, 0x0021,
+	    0x0000, 0x034e, 0x0000, 0x47b1, 0x0000, 0x0000, 0x0000, 0x4294,
+	    0x0ecb, 0x0000, 0x20a5, 0x22ce, 0x44f4, 0x0173, 0x451a, 0x3592,
+	    0x0000, 0x498a, 0x0000, 0x3676, 0x1d39, 0x0000, 0x0000, 0x0000,
+	    0x13e1, 0x0000, 0x1eca, 0x0000, 0x168b, 0x4272, 0x1db6, 0x0000,
+	    0x0000, 0x0000, 0x1508, 0x0000, 0x1614, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4018, 0x0000, 0x1587, 0x0000, 0x0000, 0x3103, 0x0000,
+	    0x0000, 0x0000, 0x2168, 0x3a60, 0x3aba, 0x3012, 0x4cc5, 0x2565,
+	    0x0000, 0x1098, 0x0cec, 0x4136, 0x0000, 0x0000, 0x227a, 0x136e,
+	    0x0000, 0x0000, 0x12cd, 0x180b, 0x0000, 0x4ca9, 0x0000, 0x4623,
+	    0x0000, 0x0000, 0x08f1, 0x0000, 0x0000, 0x43ce, 0x0000, 0x1684,
+	    0x0000, 0x2a3a, 0x21a8, 0x2142, 0x2af6, 0x0000, 0x067e, 0x0000,
+	    0x0000, 0x0000, 0x3f4d, 0x1007, 0x10eb, 0x2bc7, 0x3cf2, 0x2dd8,
+	    0x0000, 0x0000, 0x17aa, 0x11c9, 0x3554, 0x04ec, 0x1ad4, 0x3932,
+	    0x4b51, 0x0000, 0x0000, 0x06e0, 0x057f, 0x0000, 0x3598, 0x0000,
+	    0x3760, 0x2263, 0x3c1d, 0x4e1a, 0x2c0e, 0x00fd, 0x0000, 0x42f4,
+	    0x37c4, 0x279b, 0x2308, 0x0000, 0x0000, 0x12f4, 0x2587, 0x3b0f,
+	    0x00b5, 0x1f51, 0x0654, 0x076b, 0x1264, 0x2668, 0x0000, 0x344e,
+	    0x0000, 0x0000, 0x18f2, 0x2286, 0x4e03, 0x0000, 0x4487, 0x25af,
+	    0x42c8, 0x0000, 0x1022, 0x173b, 0x3bc3, 0x3e35, 0x0000, 0x0000,
+	    0x3db2, 0x3497, 0x0000, 0x2f51, 0x21cf, 0x147a, 0x169f, 0x11d9,
+	    0x2511, 0x067b, 0x0000, 0x0c6c, 0x0000, 0x21c7, 0x2752, 0x3552,
+	    0x0000, 0x0000, 0x25d8, 0x2c3c, 0x378a, 0x408f, 0x0528, 0x0000,
+	    0x2964, 0x0000, 0x1a79, 0x0000, 0x0000, 0x0000, 0x38c3, 0x1f40,
+	    0x33b8, 0x1678, 0x0950, 0x0000, 0x0000, 0x2887, 0x4c20, 0x0162,
+	    0x0000, 0x3bbf, 0x25b9, 0x0000, 0x0000, 0x4132, 0x0000, 0x0000,
+	    0x10cf, 0x3268, 0x2ddb, 0x2e8b, 0x0000, 0x0a4f, 0x0000, 0x0000,
+	    0x1bbd, 0x0000, 0x219b, 0x0000, 0x0000, 0x3fdc, 0x0000, 0x3784,
+	    0x0000, 0x0000, 0x0947, 0x0000, 0x0000, 0x0000, 0x3048, 0x2857,
+	    0x4cb8, 0x0000, 0x4be8, 0x0000, 0x4d6e, 0x0000, 0x2906, 0x41ed,
+	    0x49e0, 0x0000, 0x0000, 0x0000, 0x071b, 0x330f, 0x3f9e, 0x0000,
+	    0x0000, 0x0184, 0x0000, 0x0876, 0x1480, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x41e5, 0x47f3, 0x03c6, 0x470f, 0x0000, 0x3b1b,
+	    0x0000, 0x1152, 0x4558, 0x0000, 0x0000, 0x3655, 0x1922, 0x179a,
+	    0x0000, 0x0000, 0x4c16, 0x3472, 0x0d26, 0x1ecc, 0x0000, 0x01fd,
+	    0x0b5e, 0x13dd, 0x4704, 0x0000, 0x0000, 0x2270, 0x0000, 0x3057,
+	    0x0000, 0x000b, 0x3cd5, 0x0f1b, 0x09ef, 0x0b27, 0x0000, 0x2910,
+	    0x0000, 0x0e82, 0x0000, 0x0000, 0x0992, 0x0000, 0x1027, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x312e, 0x3a5d, 0x0000, 0x48b6,
+	    0x3035, 0x0cfb, 0x23f0, 0x0000, 0x0000, 0x0000, 0x45ad, 0x167d,
+	    0x3bcc, 0x0000, 0x0000, 0x2be4, 0x0000, 0x4c35, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x015b, 0x0000, 0x489d, 0x1178, 0x0d5f, 0x0000,
+	    0x0000, 0x4430, 0x0000, 0x1467, 0x0000, 0x39ba, 0x2b5d, 0x0000,
+	    0x2c71, 0x0000, 0x0552, 0x0000, 0x0000, 0x07df, 0x2d27, 0x0000,
+	    0x25c1, 0x497d, 0x2b10, 0x040b, 0x2228, 0x0f71, 0x0000, 0x45de,
+	    0x19fd, 0x25d5, 0x0f33, 0x0000, 0x1cb3, 0x3ede, 0x264a, 0x113e,
+	    0x0000, 0x29e4, 0x0000, 0x0000, 0x0000, 0x4222, 0x054e, 0x2491,
+	    0x3f38, 0x35bd, 0x3f67, 0x0000, 0x0000, 0x0000, 0x168d, 0x1979,
+	    0x0000, 0x0000, 0x0000, 0x4cf5, 0x053b, 0x0db6, 0x11f2, 0x0504,
+	    0x2da8, 0x0000, 0x0000, 0x0000, 0x0000, 0x47e3, 0x0000, 0x4d31,
+	    0x0000, 0x1477, 0x0000, 0x0000, 0x2a15, 0x455a, 0x070f, 0x0000,
+	    0x2d54, 0x4b2a, 0x0000, 0x00f3, 0x0000, 0x0000, 0x4414, 0x1b3b,
+	    0x0000, 0x14e0, 0x371d, 0x0000, 0x2688, 0x1c43, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x339a, 0x2eb2, 0x0000, 0x45e6, 0x41a5, 0x037a,
+	    0x0000, 0x11cc, 0x0000, 0x0000, 0x1359, 0x0000, 0x0000, 0x0000,
+	    0x496a, 0x40c8, 0x45ef, 0x3415, 0x0000, 0x39fb, 0x4437, 0x0eef,
+	    0x3fd2, 0x0000, 0x1f0e, 0x12f6, 0x0000, 0x0000, 0x0000, 0x0a51,
+	    0x4051, 0x0ab7, 0x2792, 0x0000, 0x086d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x468f, 0x0000, 0x30cd, 0x09cc, 0x1d87, 0x0000, 0x0000,
+	    0x156e, 0x27ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bc5, 0x0000,
+	    0x0d59, 0x4b3c, 0x3d0e, 0x42c3, 0x1ec3, 0x051f, 0x4213, 0x1538,
+	    0x0000, 0x1d0d, 0x443e, 0x0000, 0x0000, 0x0000, 0x19a2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x180c, 0x0a9b, 0x47cb, 0x0000, 0x449d,
+	    0x199d, 0x1e01, 0x0705, 0x0000, 0x0000, 0x3e7f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0502, 0x17af,
+	    0x47ce, 0x0000, 0x3839, 0x0b32, 0x0000, 0x0000, 0x20ba, 0x0b16,
+	    0x3715, 0x4b41, 0x40eb, 0x1cb5, 0x4a82, 0x316f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x335b, 0x0dee, 0x0000, 0x047f, 0x0000, 0x0000,
+	    0x26e7, 0x0d07, 0x0000, 0x0000, 0x0000, 0x0259, 0x357f, 0x0000,
+	    0x0000, 0x0072, 0x1fd3, 0x055d, 0x0000, 0x200d, 0x0000, 0x1ad1,
+	    0x0000, 0x3275, 0x0000, 0x4205, 0x267d, 0x3516, 0x0000, 0x324a,
+	    0x3398, 0x0000, 0x2eb1, 0x0000, 0x0942, 0x0000, 0x0000, 0x0000,
+	    0x027a, 0x49fb, 0x3151, 0x0000, 0x0000, 0x1c4c, 0x0000, 0x348c,
+	    0x0597, 0x1d23, 0x3599, 0x267f, 0x3d2b, 0x0000, 0x0000, 0x2c66,
+	    0x0bd4, 0x06c2, 0x17f3, 0x0000, 0x0000, 0x0000, 0x4df2, 0x047e,
+	    0x0000, 0x18a6, 0x0000, 0x0000, 0x0000, 0x204d, 0x0000, 0x284d,
+	    0x3e5c, 0x28a7, 0x4d8b, 0x0000, 0x440a, 0x0000, 0x1669, 0x0000,
+	    0x342a, 0x31e8, 0x28ea, 0x0000, 0x0000, 0x2986, 0x0d0d, 0x4356,
+	    0x23cf, 0x0000, 0x0000, 0x3691, 0x197d, 0x1883, 0x0b2f, 0x3fde,
+	    0x0000, 0x10d1, 0x4650, 0x0000, 0x3345, 0x324e, 0x0000, 0x0631,
+	    0x1d9a, 0x0000, 0x0000, 0x49de, 0x1a4e, 0x0000, 0x156a, 0x387a,
+	    0x0000, 0x116b, 0x0000, 0x451a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0331, 0x0000, 0x39de, 0x23bd, 0x162f, 0x42ac, 0x34e3, 0x3eff,
+	    0x3279, 0x006f, 0x0000, 0x4353, 0x0000, 0x14b1, 0x129f, 0x31b8,
+	    0x237c, 0x0d67, 0x0000, 0x4179, 0x0000, 0x0395, 0x25bc, 0x0000,
+	    0x066a, 0x0000, 0x0000, 0x2ef2, 0x0000, 0x0795, 0x3282, 0x4d37,
+	    0x0000, 0x3386, 0x0000, 0x0000, 0x0000, 0x4a15, 0x0000, 0x461a,
+	    0x0000, 0x0000, 0x372e, 0x4897, 0x26b4, 0x2e29, 0x1312, 0x0858,
+	    0x0000, 0x4908, 0x07ac, 0x025a, 0x0b17, 0x0811, 0x0000, 0x0000,
+	    0x0000, 0x16fa, 0x172a, 0x21a1, 0x47c2, 0x03e1, 0x05f5, 0x4061,
+	    0x4a14, 0x0000, 0x04e5, 0x0000, 0x34d7, 0x3d99, 0x4a1f, 0x0000,
+	    0x4c87, 0x035e, 0x0000, 0x4a76, 0x3236, 0x0000, 0x0000, 0x3102,
+	    0x0000, 0x14dd, 0x092c, 0x12df, 0x1aea, 0x0000, 0x2681, 0x0000,
+	    0x3e00, 0x4c62, 0x154f, 0x4d74, 0x278f, 0x2dea, 0x0000, 0x3158,
+	    0x3a12, 0x3c91, 0x2cf0, 0x0000, 0x2778, 0x3d92, 0x4310, 0x0000,
+	    0x31a0, 0x1edc, 0x0000, 0x08a0, 0x0000, 0x0000, 0x0000, 0x2ac2,
+	    0x0ca3, 0x1ec7, 0x0000, 0x0000, 0x10db, 0x2bca, 0x346c, 0x4031,
+	    0x0000, 0x12d0, 0x2e02, 0x14ab, 0x1f4f, 0x4990, 0x0000, 0x2730,
+	    0x0000, 0x4b78, 0x13ea, 0x0000, 0x4693, 0x0000, 0x0000, 0x1c24,
+	    0x1709, 0x0f97, 0x0000, 0x11f3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x259d, 0x34b0,
+	    0x20c2, 0x0000, 0x0000, 0x0280, 0x0000, 0x4c94, 0x4578, 0x4993,
+	    0x0000, 0x174b, 0x171e, 0x0000, 0x3b37, 0x106f, 0x3559, 0x48ac,
+	    0x0000, 0x14f3, 0x0000, 0x0000, 0x0000, 0x0000, 0x392b, 0x0080,
+	    0x0000, 0x15b5, 0x374d, 0x4ba7, 0x3d8d, 0x0000, 0x4a20, 0x43bd,
+	    0x2b42, 0x0000, 0x4a5b, 0x0000, 0x18d5, 0x25af, 0x0000, 0x0000,
+	    0x0000, 0x1ac7, 0x49ee, 0x0000, 0x2309, 0x0142, 0x0000, 0x0000,
+	    0x311e, 0x20bc, 0x1fb0, 0x0000, 0x4856, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x343c, 0x0000, 0x0000, 0x3905, 0x387d, 0x323c, 0x2825,
+	    0x0000, 0x0000, 0x07fb, 0x1dea, 0x0000, 0x0ffa, 0x0000, 0x1ec1,
+	    0x0000, 0x17cf, 0x0000, 0x0000, 0x12a0, 0x34a2, 0x2532, 0x4992,
+	    0x3b4f, 0x2c62, 0x0000, 0x2439, 0x0000, 0x0000, 0x0d97, 0x0000,
+	    0x0000, 0x1e5a, 0x0d08, 0x31f9, 0x0000, 0x0000, 0x0000, 0x2fa8,
+	    0x0000, 0x377c, 0x1b17, 0x0000, 0x0000, 0x0f4e, 0x4863, 0x0000,
+	    0x0000, 0x1d44, 0x0000, 0x0000, 0x385d, 0x3725, 0x2450, 0x0000,
+	    0x44f3, 0x0000, 0x33d3, 0x0ffe, 0x0000, 0x1e2b, 0x178e, 0x3565,
+	    0x0000, 0x4d27, 0x3170, 0x2443, 0x02a7, 0x0000, 0x4252, 0x0000,
+	    0x1f78, 0x457a, 0x3341, 0x4871, 0x0000, 0x209f, 0x43bb, 0x0000,
+	    0x2866, 0x4cc5, 0x0000, 0x3feb, 0x3767, 0x0000, 0x4400, 0x0000,
+	    0x0000, 0x0000, 0x05ec, 0x0000, 0x0000, 0x0ea9, 0x47e9, 0x1fa6,
+	    0x1f19, 0x46c5, 0x433d, 0x0000, 0x0000, 0x2bde, 0x452b, 0x1927,
+	    0x3fdd, 0x0000, 0x2d2f, 0x0c9f, 0x2bc8, 0x0000, 0x0000, 0x2727,
+	    0x0000, 0x0000, 0x49ef, 0x2502, 0x4161, 0x39e8, 0x0000, 0x0000,
+	    0x0000, 0x1d2c, 0x0000, 0x0000, 0x251e, 0x19a7, 0x3d64, 0x486b,
+	    0x44e0, 0x0000, 0x0000, 0x1e14, 0x0000, 0x1cbf, 0x1c55, 0x2020,
+	    0x0000, 0x0000, 0x2b31, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x26c9, 0x2ed8, 0x0000, 0x0000, 0x3df9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x48f9, 0x0000, 0x11c8, 0x0d96, 0x4b4f,
+	    0x0639, 0x47b0, 0x01e6, 0x10d9, 0x292e, 0x245a, 0x0000, 0x0000,
+	    0x0000, 0x3405, 0x08f8, 0x2fd2, 0x0056, 0x421a, 0x35e7, 0x21a5,
+	    0x0000, 0x0b52, 0x0095, 0x0000, 0x24d4, 0x0000, 0x4ce8, 0x1abc,
+	    0x4091, 0x0000, 0x1e67, 0x35c1, 0x4859, 0x019e, 0x13fe, 0x3973,
+	    0x0879, 0x042c, 0x3627, 0x0000, 0x3068, 0x0921, 0x49f2, 0x2ab9,
+	    0x0000, 0x02cc, 0x4d26, 0x008a, 0x0000, 0x08c3, 0x0000, 0x112a,
+	    0x0565, 0x0000, 0x17d1, 0x0000, 0x082a, 0x0000, 0x2c28, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1bf2, 0x3a25, 0x0000, 0x0000,
+	    0x039a, 0x2f8d, 0x0000, 0x0000, 0x0000, 0x0000, 0x353b, 0x0000,
+	    0x0000, 0x3d34, 0x0000, 0x0000, 0x0d0b, 0x0000, 0x2963, 0x31b5,
+	    0x2224, 0x23e5, 0x4361, 0x3393, 0x0000, 0x216e, 0x0000, 0x4ab9,
+	    0x00e8, 0x4dec, 0x0000, 0x0000, 0x1628, 0x0000, 0x0000, 0x2f16,
+	    0x0000, 0x208d, 0x15f1, 0x0000, 0x43a7, 0x349f, 0x0000, 0x48e0,
+	    0x0ea6, 0x15ac, 0x081b, 0x0000, 0x0649, 0x04b2, 0x42e9, 0x4a0a,
+	    0x31e7, 0x0000, 0x119d, 0x2563, 0x0000, 0x0000, 0x0099, 0x3efa,
+	    0x4580, 0x0115, 0x0000, 0x0beb, 0x3f83, 0x0000, 0x34c9, 0x0000,
+	    0x0000, 0x0000, 0x2a66, 0x0000, 0x3342, 0x01ab, 0x0000, 0x0000,
+	    0x16fe, 0x0000, 0x0000, 0x0000, 0x3d84, 0x0000, 0x0000, 0x1165,
+	    0x0000, 0x0000, 0x0000, 0x2551, 0x336d, 0x0000, 0x0000, 0x1c16,
+	    0x18f5, 0x4a74, 0x310b, 0x159d, 0x1f58, 0x0d13, 0x0384, 0x0000,
+	    0x0000, 0x0000, 0x3cc3, 0x3f6a, 0x055f, 0x0000, 0x0000, 0x2ede,
+	    0x2c6e, 0x2c01, 0x0000, 0x0000, 0x0000, 0x0ce0, 0x0000, 0x0000,
+	    0x2174, 0x084a, 0x0000, 0x0000, 0x0000, 0x3294, 0x0000, 0x2d67,
+	    0x049f, 0x4515, 0x33be, 0x0000, 0x1976, 0x268e, 0x150a, 0x4de4,
+	    0x0f20, 0x4831, 0x0000, 0x0000, 0x0000, 0x3a94, 0x0000, 0x3213,
+	    0x0000, 0x0116, 0x1400, 0x1fbf, 0x00bd, 0x0000, 0x3f59, 0x20e5,
+	    0x0000, 0x2e28, 0x0000, 0x0000, 0x2f2e, 0x0b79, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1529, 0x0630, 0x3b9c, 0x1447, 0x23f3, 0x0000,
+	    0x0000, 0x197b, 0x08dc, 0x0000, 0x1d03, 0x0000, 0x36c3, 0x0000,
+	    0x2262, 0x0000, 0x159a, 0x0000, 0x0bb4, 0x07b2, 0x4471, 0x338e,
+	    0x0000, 0x1adb, 0x3c3c, 0x269b, 0x0000, 0x27b0, 0x0000, 0x2fd2,
+	    0x4a89, 0x0000, 0x0abc, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a75,
+	    0x48b0, 0x3bbc, 0x49e3, 0x438e, 0x2f42, 0x0000, 0x121b, 0x2545,
+	    0x3542, 0x0000, 0x0000, 0x0b8d, 0x0000, 0x0000, 0x047a, 0x427d,
+	    0x422e, 0x0000, 0x0000, 0x35a7, 0x0000, 0x1e9a, 0x301d, 0x0000,
+	    0x0000, 0x0000, 0x3705, 0x2b0b, 0x04a1, 0x4d81, 0x0000, 0x3528,
+	    0x3cda, 0x3bb4, 0x0011, 0x0000, 0x0ba2, 0x3034, 0x0000, 0x28f5,
+	    0x1a72, 0x0528, 0x1afe, 0x49e2, 0x10d7, 0x3c34, 0x3dbb, 0x4db7,
+	    0x1aee, 0x0000, 0x2aba, 0x24aa, 0x0000, 0x0000, 0x0000, 0x32fc,
+	    0x0000, 0x0000, 0x081e, 0x36a5, 0x21dd, 0x16da, 0x3882, 0x2a1e,
+	    0x1aae, 0x0000, 0x0000, 0x0000, 0x2e28, 0x382a, 0x3ac0, 0x343c,
+	    0x0000, 0x4b25, 0x2717, 0x1b03, 0x29a3, 0x0000, 0x0000, 0x0000,
+	    0x053d, 0x306d, 0x4841, 0x35c3, 0x36ff, 0x1bdd, 0x04c8, 0x0000,
+	    0x4c02, 0x0000, 0x337f, 0x302f, 0x2f92, 0x3e04, 0x10b1, 0x0000,
+	    0x45c1, 0x0000, 0x0000, 0x0000, 0x2e77, 0x39ad, 0x0000, 0x359c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3950, 0x082d, 0x4cb3, 0x0000,
+	    0x2ce6, 0x0000, 0x0d00, 0x3cd8, 0x32ef, 0x3d16, 0x0000, 0x0000,
+	    0x3c77, 0x3d1a, 0x0d9e, 0x4b6f, 0x0000, 0x0000, 0x0b04, 0x0000,
+	    0x0000, 0x2cd0, 0x31ab, 0x3a38, 0x4705, 0x0000, 0x3d5e, 0x1d8a,
+	    0x26ff, 0x0000, 0x0000, 0x05db, 0x42b7, 0x49dc, 0x4cfd, 0x01de,
+	    0x0000, 0x4dd5, 0x0000, 0x29f2, 0x1042, 0x0000, 0x0000, 0x0000,
+	    0x19d5, 0x38fa, 0x111f, 0x0000, 0x1522, 0x19e9, 0x2e30, 0x090c,
+	    0x0091, 0x0000, 0x0000, 0x0000, 0x066b, 0x15e0, 0x3176, 0x0768,
+	    0x0000, 0x17a2, 0x4536, 0x0000, 0x3527, 0x26a4, 0x22ae, 0x35f9,
+	    0x0000, 0x3517, 0x0000, 0x3b19, 0x0000, 0x4a2f, 0x4826, 0x0000,
+	    0x3340, 0x0000, 0x1772, 0x0c10, 0x2921, 0x0000, 0x0000, 0x06ed,
+	    0x0000, 0x36d5, 0x0000, 0x2ac1, 0x0000, 0x0000, 0x23f9, 0x332e,
+	    0x0000, 0x2ade, 0x18a2, 0x17b7, 0x3dc9, 0x0652, 0x1e1b, 0x38be,
+	    0x28c1, 0x0000, 0x0000, 0x447b, 0x4dc4, 0x4b3e, 0x39ef, 0x0000,
+	    0x304a, 0x0000, 0x0000, 0x4229, 0x0000, 0x39df, 0x23b4, 0x0000,
+	    0x3b31, 0x31f1, 0x35c2, 0x0b8b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x478b, 0x0000, 0x0000, 0x2c76, 0x4990, 0x167a, 0x2929, 0x0000,
+	    0x0000, 0x0000, 0x354f, 0x20df, 0x0000, 0x425f, 0x0c3b, 0x2d1f,
+	    0x00a6, 0x446b, 0x41c9, 0x0000, 0x3ee8, 0x1691, 0x0000, 0x0649,
+	    0x2216, 0x17a4, 0x2e1f, 0x1253, 0x0000, 0x24fa, 0x2063, 0x0000,
+	    0x2073, 0x25e3, 0x159e, 0x3f81, 0x3c00, 0x02b9, 0x4da4, 0x071d,
+	    0x0000, 0x0000, 0x4039, 0x127e, 0x0000, 0x0000, 0x2623, 0x0000,
+	    0x484c, 0x252f, 0x2b84, 0x04e1, 0x4206, 0x0000, 0x0000, 0x0000,
+	    0x425e, 0x0000, 0x0000, 0x115e, 0x38af, 0x0000, 0x0000, 0x0000,
+	    0x250a, 0x0000, 0x0000, 0x2d9f, 0x285c, 0x08ca, 0x0000, 0x4b48,
+	    0x0000, 0x3eca, 0x0000, 0x0efd, 0x0000, 0x0000, 0x2f56, 0x3ccc,
+	    0x0000, 0x0000, 0x0303, 0x0000, 0x0000, 0x3f5e, 0x0db9, 0x10f0,
+	    0x14dd, 0x0000, 0x3fee, 0x355e, 0x4690, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3411, 0x106d, 0x0000, 0x1edb, 0x0000, 0x040f, 0x23f6,
+	    0x353c, 0x0000, 0x0000, 0x0000, 0x2046, 0x0fa3, 0x0000, 0x0000,
+	    0x25d1, 0x263f, 0x221f, 0x08e3, 0x0000, 0x299d, 0x0000, 0x3943,
+	    0x0284, 0x4aab, 0x3f34, 0x0702, 0x34f8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x27e6, 0x0c21, 0x0000, 0x0000, 0x3b8f, 0x0000,
+	    0x2fb5, 0x0ae2, 0x0000, 0x150a, 0x3af5, 0x37da, 0x0000, 0x0000,
+	    0x0000, 0x24d8, 0x33fa, 0x0000, 0x0427, 0x00eb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2bf6, 0x4a9d, 0x0000, 0x0000, 0x2723,
+	    0x14a8, 0x0316, 0x213c, 0x30b8, 0x2c2a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1341, 0x07af, 0x4713, 0x4316, 0x0000, 0x0000, 0x0b7e,
+	    0x26f4, 0x0000, 0x0000, 0x3b45, 0x1d8a, 0x1f9b, 0x0000, 0x001e,
+	    0x1a42, 0x1ee3, 0x357c, 0x494b, 0x0000, 0x442f, 0x0000, 0x0000,
+	    0x0000, 0x2f96, 0x0000, 0x0000, 0x1deb, 0x3b3a, 0x40fa, 0x1482,
+	    0x1615, 0x0000, 0x0be7, 0x307d, 0x1cca, 0x4a98, 0x0000, 0x1d8a,
+	    0x0434, 0x3b13, 0x4007, 0x0000, 0x0000, 0x1dcd, 0x0000, 0x0000,
+	    0x0000, 0x479a, 0x0000, 0x0000, 0x3ad8, 0x010d, 0x2ed5, 0x0000,
+	    0x0000, 0x0000, 0x1ee7, 0x0000, 0x0b50, 0x0000, 0x0000, 0x1395,
+	    0x1240, 0x10b0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e4a, 0x0000,
+	    0x0000, 0x0000, 0x1f35, 0x0000, 0x0000, 0x0000, 0x0000, 0x11c8,
+	    0x0000, 0x0000, 0x0000, 0x0d38, 0x0000, 0x2deb, 0x3a8f, 0x2644,
+	    0x474f, 0x0000, 0x0000, 0x0000, 0x08ae, 0x45d8, 0x0000, 0x495e,
+	    0x0000, 0x0000, 0x31dc, 0x0000, 0x0000, 0x1421, 0x0a41, 0x3fce,
+	    0x3a2c, 0x0000, 0x33ca, 0x00f4, 0x2d4c, 0x0000, 0x14f4, 0x4aa2,
+	    0x16ca, 0x0000, 0x3059, 0x427f, 0x143a, 0x3e1a, 0x0e03, 0x3119,
+	    0x4ad6, 0x0000, 0x25b4, 0x293f, 0x0000, 0x0000, 0x3cf4, 0x0b32,
+	    0x05dd, 0x0299, 0x0000, 0x2121, 0x0000, 0x2088, 0x27bd, 0x1a7b,
+	    0x31aa, 0x13c9, 0x0000, 0x0000, 0x4128, 0x1a37, 0x0ddd, 0x49b7,
+	    0x40e8, 0x4977, 0x32f1, 0x4715, 0x1b7d, 0x0c26, 0x0000, 0x0000,
+	    0x4c95, 0x0000, 0x3d7d, 0x0000, 0x1a18, 0x31cb, 0x0662, 0x0000,
+	    0x16e9, 0x4bb0, 0x3477, 0x3391, 0x11bc, 0x2d42, 0x0000, 0x3fe4,
+	    0x0000, 0x189c, 0x0000, 0x3a7d, 0x0000, 0x1171, 0x205b, 0x0000,
+	    0x26db, 0x0000, 0x3942, 0x0414, 0x2e6c, 0x0000, 0x0000, 0x43c8,
+	    0x2d6d, 0x3ce0, 0x3810, 0x1fee, 0x0000, 0x0000, 0x45f2, 0x0000,
+	    0x41b0, 0x2b97, 0x0000, 0x0000, 0x1fa1, 0x0000, 0x036b, 0x347f,
+	    0x0000, 0x0000, 0x0000, 0x01fe, 0x31f3, 0x0000, 0x0000, 0x2c24,
+	    0x0000, 0x0fcc, 0x0000, 0x1040, 0x0000, 0x0d39, 0x0000, 0x26d8,
+	    0x113c, 0x055c, 0x0000, 0x2b5e, 0x0146, 0x0000, 0x0807, 0x0000,
+	    0x038c, 0x1fbc, 0x39e8, 0x08cb, 0x0000, 0x03e4, 0x0000, 0x34ce,
+	    0x08a1, 0x0000, 0x416a, 0x23ca, 0x4cee, 0x3b2e, 0x0000, 0x1a6e,
+	    0x123e, 0x0bcb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a4c, 0x03b6,
+	    0x0000, 0x0992, 0x0000, 0x3c17, 0x2e8a, 0x3f8b, 0x2e0d, 0x211c,
+	    0x072f, 0x0000, 0x0000, 0x1e4e, 0x1899, 0x0000, 0x12e9, 0x0000,
+	    0x033a, 0x2062, 0x0000, 0x4864, 0x4d20, 0x0490, 0x4322, 0x0000,
+	    0x0000, 0x0000, 0x255f, 0x0000, 0x076d, 0x050b, 0x4b2f, 0x0000,
+	    0x0000, 0x3f7b, 0x254f, 0x1b83, 0x2c01, 0x0000, 0x0000, 0x0000,
+	    0x030f, 0x1c70, 0x0000, 0x0000, 0x0d03, 0x0000, 0x0000, 0x0000,
+	    0x1401, 0x2c58, 0x0b1c, 0x3706, 0x0000, 0x322a, 0x351d, 0x44bb,
+	    0x47ac, 0x1108, 0x1a9b, 0x0000, 0x3911, 0x2bee, 0x0000, 0x0ef1,
+	    0x0000, 0x4682, 0x0000, 0x0000, 0x0440, 0x47f6, 0x27d9, 0x2718,
+	    0x3ae8, 0x217b, 0x1315, 0x0000, 0x0000, 0x4289, 0x32b6, 0x0c08,
+	    0x1fa5, 0x3818, 0x2eb3, 0x440d, 0x105e, 0x0000, 0x1138, 0x30d6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x48e9, 0x0000, 0x4a0c, 0x495d,
+	    0x2d00, 0x0000, 0x1b8f, 0x3e92, 0x0000, 0x0000, 0x11ea, 0x11fb,
+	    0x0000, 0x0000, 0x1056, 0x01bc, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0a7b, 0x2432, 0x0000, 0x0000, 0x0000, 0x36a9, 0x0000, 0x4615,
+	    0x0000, 0x223c, 0x0000, 0x31c2, 0x0000, 0x46a6, 0x06b6, 0x35b7,
+	    0x4b05, 0x334e, 0x0b08, 0x0000, 0x3168, 0x0000, 0x0000, 0x1b50,
+	    0x45a9, 0x0000, 0x0000, 0x0000, 0x3077, 0x0000, 0x23c5, 0x0000,
+	    0x3763, 0x0000, 0x28b2, 0x1f6b, 0x1af7, 0x0000, 0x03ef, 0x0000,
+	    0x13c9, 0x1f9e, 0x4631, 0x0000, 0x0000, 0x410a, 0x0000, 0x38d3,
+	    0x0000, 0x0000, 0x0000, 0x1a91, 0x1076, 0x0000, 0x0276, 0x3a14,
+	    0x33a1, 0x0000, 0x3b8b, 0x01cb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x05d7, 0x14a4, 0x04bb, 0x1716, 0x0d30, 0x2b6f, 0x0000, 0x0000,
+	    0x401e, 0x40b0, 0x0000, 0x125d, 0x2789, 0x0000, 0x0000, 0x0000,
+	    0x098b, 0x0000, 0x0000, 0x208e, 0x0000, 0x052f, 0x0000, 0x0000,
+	    0x390c, 0x0000, 0x1a92, 0x0000, 0x0000, 0x0000, 0x1847, 0x083d,
+	    0x0000, 0x0569, 0x0000, 0x0000, 0x0dd2, 0x3cfb, 0x470c, 0x30f6,
+	    0x129a, 0x1f32, 0x0000, 0x09de, 0x1497, 0x493f, 0x3acb, 0x2839,
+	    0x0000, 0x0000, 0x0000, 0x37d4, 0x0000, 0x1974, 0x0000, 0x010c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x11d0, 0x3afd, 0x0000, 0x0820,
+	    0x4139, 0x4114, 0x0cac, 0x0000, 0x0000, 0x0000, 0x1e68, 0x0000,
+	    0x4d26, 0x3dd0, 0x28d6, 0x22d3, 0x0000, 0x0590, 0x335f, 0x3f60,
+	    0x45f7, 0x1d08, 0x363d, 0x1af3, 0x2d09, 0x1bed, 0x1097, 0x1c57,
+	    0x1e43, 0x252d, 0x472f, 0x0378, 0x0ab2, 0x0000, 0x10e7, 0x4cc7,
+	    0x0000, 0x190b, 0x0000, 0x28c1, 0x0ba0, 0x2dd2, 0x0000, 0x3716,
+	    0x14a1, 0x4377, 0x0000, 0x2e0d, 0x2a83, 0x1cc5, 0x1e4b, 0x0000,
+	    0x0000, 0x20c7, 0x02a2, 0x391e, 0x4636, 0x0000, 0x2f34, 0x3e5f,
+	    0x32fa, 0x0000, 0x0000, 0x2834, 0x0000, 0x2f99, 0x4cde, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4465, 0x179e, 0x0000, 0x072e,
+	    0x0000, 0x4881, 0x3b5f, 0x422a, 0x1d41, 0x0000, 0x161c, 0x330c,
+	    0x0000, 0x0000, 0x0000, 0x142c, 0x0000, 0x35f3, 0x3d7f, 0x0000,
+	    0x0000, 0x015d, 0x0000, 0x0700, 0x0000, 0x1929, 0x02b8, 0x3278,
+	    0x0000, 0x0758, 0x0000, 0x0000, 0x0add, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0a7b, 0x0000, 0x0000, 0x0000, 0x0d15, 0x0d05, 0x1f4d,
+	    0x23cc, 0x0000, 0x0000, 0x4481, 0x0000, 0x0d60, 0x4be2, 0x0e21,
+	    0x0000, 0x10b1, 0x4115, 0x02d6, 0x079b, 0x0000, 0x341d, 0x37d4,
+	    0x2536, 0x34fa, 0x4774, 0x1625, 0x0000, 0x0000, 0x48e2, 0x0df2,
+	    0x467a, 0x0000, 0x0f43, 0x343f, 0x05fa, 0x0000, 0x128d, 0x0000,
+	    0x0000, 0x0000, 0x36ef, 0x24c3, 0x0000, 0x38b6, 0x14ce, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x213f, 0x4661, 0x0000, 0x0000, 0x087b,
+	    0x3705, 0x0000, 0x1fe7, 0x0000, 0x1106, 0x1ff6, 0x3fc3, 0x1420,
+	    0x2077, 0x0a75, 0x0a3f, 0x0000, 0x0000, 0x0000, 0x1a7c, 0x0000,
+	    0x0000, 0x0000, 0x38a6, 0x0000, 0x0000, 0x4d31, 0x2b66, 0x0000,
+	    0x0198, 0x0000, 0x0a14, 0x04a4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2291, 0x0000, 0x0000, 0x2cf6, 0x1e1c, 0x4b0d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2607, 0x0000, 0x0000, 0x2b9e, 0x0000, 0x05f3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x37bd, 0x0000, 0x0000, 0x0af1,
+	    0x3cd2, 0x41d3, 0x124a, 0x1357, 0x08f8, 0x09a1, 0x208f, 0x0bd8,
+	    0x0000, 0x2e9f, 0x18c4, 0x3888, 0x45ab, 0x0000, 0x0000, 0x45b9,
+	    0x28d7, 0x0000, 0x2912, 0x01d4, 0x1de1, 0x2959, 0x1f8c, 0x2509,
+	    0x0000, 0x1c6a, 0x1600, 0x445e, 0x0000, 0x0000, 0x0860, 0x39a5,
+	    0x0f13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45fd, 0x0f5a,
+	    0x0000, 0x47cf, 0x0000, 0x3790, 0x0cc5, 0x0000, 0x329c, 0x3ed7,
+	    0x22be, 0x1205, 0x0000, 0x243a, 0x05c9, 0x0000, 0x0000, 0x440f,
+	    0x01c3, 0x478b, 0x158f, 0x3bb1, 0x0000, 0x0000, 0x496f, 0x0000,
+	    0x0000, 0x3618, 0x3bec, 0x0000, 0x0d07, 0x057d, 0x0b72, 0x0000,
+	    0x33eb, 0x0000, 0x0000, 0x2cfb, 0x21b9, 0x38bb, 0x0000, 0x1a75,
+	    0x025d, 0x4146, 0x0000, 0x2c1c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1c01, 0x162c, 0x0000, 0x038a, 0x008c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3608, 0x3de3, 0x1162, 0x381b, 0x4c49, 0x0000, 0x1cd2,
+	    0x43ee, 0x0000, 0x0000, 0x3e1d, 0x081b, 0x0000, 0x3d78, 0x3278,
+	    0x0000, 0x0000, 0x0000, 0x0bb0, 0x0000, 0x0000, 0x201e, 0x2f06,
+	    0x1594, 0x006a, 0x341b, 0x3d58, 0x0000, 0x1c20, 0x0de5, 0x0000,
+	    0x3d4e, 0x414c, 0x0000, 0x0000, 0x03e1, 0x0000, 0x0000, 0x2285,
+	    0x0000, 0x2456, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ede, 0x0000,
+	    0x1581, 0x0000, 0x0000, 0x477e, 0x268c, 0x0000, 0x4194, 0x4bcf,
+	    0x0000, 0x4b9f, 0x0000, 0x0000, 0x3ed3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x130b, 0x41a4, 0x15dc, 0x0000, 0x0000, 0x2779, 0x0000,
+	    0x4d85, 0x0000, 0x2202, 0x00a6, 0x0000, 0x0000, 0x2365, 0x0000,
+	    0x0000, 0x0000, 0x20cd, 0x0de4, 0x1bfc, 0x0000, 0x41b9, 0x0d8c,
+	    0x0000, 0x316c, 0x185e, 0x0000, 0x343b, 0x1a5a, 0x0000, 0x0000,
+	    0x037d, 0x21cc, 0x1e1d, 0x0000, 0x0000, 0x3591, 0x0f74, 0x0000,
+	    0x3639, 0x2f03, 0x0000, 0x164c, 0x2db2, 0x14b3, 0x4b75, 0x3f39,
+	    0x0000, 0x30f1, 0x0000, 0x0000, 0x4304, 0x0f1b, 0x122c, 0x125c,
+	    0x0000, 0x0000, 0x4c0d, 0x0000, 0x21ee, 0x0c2e, 0x1e27, 0x0000,
+	    0x10fd, 0x30e1, 0x08ff, 0x0555, 0x0000, 0x0676, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1099, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x468e, 0x04df, 0x0079, 0x0dfa, 0x0000, 0x0000,
+	    0x2f9f, 0x30ef, 0x0000, 0x0000, 0x03d9, 0x2cb4, 0x1dd5, 0x42d9,
+	    0x0000, 0x0000, 0x23c6, 0x419c, 0x0000, 0x0000, 0x0000, 0x374a,
+	    0x0989, 0x2e0e, 0x3744, 0x11ed, 0x4969, 0x28c2, 0x0310, 0x34c8,
+	    0x0796, 0x4497, 0x0000, 0x0000, 0x19a9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1da6, 0x0000, 0x03dc, 0x0000, 0x4b9e, 0x0000,
+	    0x2114, 0x31e1, 0x3c60, 0x02b5, 0x0000, 0x2554, 0x0ca8, 0x1c80,
+	    0x0000, 0x0000, 0x2b70, 0x31b1, 0x1e5b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0656, 0x0470, 0x3a04, 0x0000, 0x0000, 0x34a2, 0x3cf9,
+	    0x3b6b, 0x0000, 0x2c7a, 0x3bfa, 0x0000, 0x48d0, 0x0875, 0x0000,
+	    0x1cbc, 0x0000, 0x0000, 0x46a2, 0x0000, 0x3b03, 0x0ca3, 0x0000,
+	    0x0000, 0x3d21, 0x4c87, 0x0000, 0x2e48, 0x374b, 0x0dc4, 0x0000,
+	    0x0000, 0x1311, 0x4020, 0x03e8, 0x4318, 0x2f2f, 0x2ffc, 0x0000,
+	    0x0000, 0x3e2c, 0x421b, 0x42b4, 0x2eb0, 0x0000, 0x42eb, 0x31a9,
+	    0x0000, 0x1a8d, 0x37ea, 0x0000, 0x1117, 0x4780, 0x3d18, 0x4148,
+	    0x0000, 0x3176, 0x0b90, 0x0000, 0x1243, 0x00b7, 0x11c0, 0x2cf5,
+	    0x45c7, 0x0000, 0x0000, 0x0000, 0x3f49, 0x258e, 0x1277, 0x0000,
+	    0x3b30, 0x4c1b, 0x0000, 0x1a61, 0x38d7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1798, 0x09df, 0x0000, 0x0000, 0x0000, 0x1e75,
+	    0x0000, 0x0000, 0x1dfe, 0x0000, 0x4c0a, 0x0000, 0x0000, 0x0164,
+	    0x0000, 0x0000, 0x0000, 0x1655, 0x0000, 0x0000, 0x0000, 0x44e5,
+	    0x0000, 0x1bb6, 0x0000, 0x0000, 0x3ff5, 0x0000, 0x2656, 0x1df4,
+	    0x0dd3, 0x0000, 0x2ce5, 0x0000, 0x0000, 0x0000, 0x487d, 0x3037,
+	    0x1e6a, 0x0f6b, 0x259d, 0x11f9, 0x0000, 0x29b2, 0x0000, 0x117b,
+	    0x4824, 0x0000, 0x0000, 0x3872, 0x2e92, 0x1935, 0x11a4, 0x0000,
+	    0x0dd3, 0x0f2a, 0x0000, 0x4014, 0x2053, 0x0000, 0x345a, 0x1a3a,
+	    0x3acd, 0x34ec, 0x342a, 0x492d, 0x32ce, 0x0000, 0x0000, 0x3b54,
+	    0x4aa9, 0x06b9, 0x0000, 0x0000, 0x30c4, 0x2476, 0x0000, 0x4589,
+	    0x0000, 0x0000, 0x3dd5, 0x0000, 0x1d6e, 0x0000, 0x1c2f, 0x0000,
+	    0x0ba9, 0x0000, 0x0000, 0x4701, 0x0000, 0x0061, 0x0000, 0x0000,
+	    0x0000, 0x449f, 0x3c90, 0x0000, 0x0000, 0x19a1, 0x0000, 0x2348,
+	    0x4d8b, 0x1a3b, 0x0000, 0x0955, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x24cb, 0x0624, 0x4521, 0x05ec, 0x456b, 0x0000, 0x0987, 0x0afd,
+	    0x1e05, 0x1627, 0x0000, 0x4bfa, 0x133f, 0x0000, 0x198c, 0x0000,
+	    0x1bbb, 0x37cf, 0x0000, 0x0000, 0x4d0d, 0x3d91, 0x0000, 0x0000,
+	    0x36f7, 0x0000, 0x4899, 0x0000, 0x0c1d, 0x0000, 0x0000, 0x08d4,
+	    0x233d, 0x4ce9, 0x0000, 0x0000, 0x0000, 0x0000, 0x1760, 0x0000,
+	    0x0000, 0x1cb2, 0x2090, 0x0000, 0x23dd, 0x388c, 0x368b, 0x14fd,
+	    0x0000, 0x1857, 0x01e8, 0x0000, 0x0000, 0x42c9, 0x2c2d, 0x0000,
+	    0x0000, 0x16d2, 0x1cd0, 0x2be7, 0x0000, 0x2b70, 0x1e43, 0x0000,
+	    0x0000, 0x0000, 0x2ad5, 0x4153, 0x0000, 0x4730, 0x081c, 0x1abe,
+	    0x0000, 0x34c7, 0x3f40, 0x0d6f, 0x0000, 0x0000, 0x0000, 0x03a1,
+	    0x0000, 0x0000, 0x48fe, 0x207c, 0x48f7, 0x0a32, 0x33be, 0x0b84,
+	    0x3288, 0x0000, 0x295f, 0x0000, 0x31d0, 0x0000, 0x016e, 0x26d3,
+	    0x0bbc, 0x0000, 0x1210, 0x0000, 0x0000, 0x03ef, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x20dd, 0x481e, 0x0000, 0x0000,
+	    0x0000, 0x1ebe, 0x0000, 0x0000, 0x2f70, 0x392b, 0x3b10, 0x0044,
+	    0x2c18, 0x3778, 0x49f9, 0x0000, 0x0000, 0x0000, 0x1fe8, 0x0000,
+	    0x0000, 0x2ea8, 0x0d2f, 0x3528, 0x1407, 0x4a9f, 0x3ed3, 0x3226,
+	    0x0000, 0x0000, 0x3624, 0x0000, 0x3a52, 0x4070, 0x0add, 0x0948,
+	    0x0000, 0x0000, 0x129b, 0x0000, 0x1e38, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3bab, 0x313e, 0x0000, 0x0000, 0x0000, 0x0000, 0x13f1,
+	    0x0000, 0x0000, 0x4d14, 0x1a14, 0x0000, 0x3ea0, 0x014b, 0x0000,
+	    0x0000, 0x0000, 0x2f26, 0x4098, 0x4069, 0x0000, 0x0000, 0x0a62,
+	    0x0000, 0x38f6, 0x0adb, 0x3565, 0x0000, 0x0a10, 0x0000, 0x055d,
+	    0x2a8b, 0x10a6, 0x2baa, 0x4c25, 0x0006, 0x37e8, 0x3177, 0x316c,
+	    0x3205, 0x2ad5, 0x4680, 0x2a93, 0x44ba, 0x1896, 0x42e7, 0x0000,
+	    0x3629, 0x45eb, 0x02a2, 0x06d0, 0x0000, 0x0000, 0x2d84, 0x0000,
+	    0x36e8, 0x0000, 0x04e8, 0x0000, 0x0185, 0x1f0f, 0x1ff5, 0x0000,
+	    0x0000, 0x37ff, 0x088a, 0x1597, 0x33cb, 0x1025, 0x07f1, 0x326f,
+	    0x0000, 0x0000, 0x0000, 0x01f2, 0x068e, 0x0000, 0x0000, 0x0000,
+	    0x4322, 0x0000, 0x1671, 0x0000, 0x4240, 0x0000, 0x083d, 0x0000,
+	    0x0000, 0x0000, 0x42f6, 0x0000, 0x30ec, 0x25a6, 0x065e, 0x1170,
+	    0x3d75, 0x0000, 0x0000, 0x4d3d, 0x03d4, 0x0000, 0x274a, 0x05a0,
+	    0x3d21, 0x0000, 0x0000, 0x4a7a, 0x0000, 0x0000, 0x0d7c, 0x14b5,
+	    0x2a1d, 0x0000, 0x0000, 0x0000, 0x0cb6, 0x26d0, 0x35ba, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x29be, 0x42bf, 0x4507, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x216a, 0x0000, 0x0000, 0x05e9, 0x0000,
+	    0x0000, 0x3ac6, 0x0000, 0x0000, 0x0000, 0x3a84, 0x035a, 0x2f26,
+	    0x0000, 0x0000, 0x418f, 0x0000, 0x0279, 0x2355, 0x35a0, 0x3da4,
+	    0x294f, 0x3171, 0x3b05, 0x4c55, 0x0000, 0x0000, 0x0000, 0x2c91,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x289c, 0x0000, 0x2f3f, 0x0792,
+	    0x2f1d, 0x2315, 0x2914, 0x136d, 0x0000, 0x2eea, 0x0000, 0x0000,
+	    0x3cc4, 0x0000, 0x25d0, 0x0000, 0x30a1, 0x2df0, 0x0000, 0x0a51,
+	    0x0000, 0x0000, 0x0000, 0x0681, 0x0000, 0x49df, 0x0e90, 0x30bf,
+	    0x45eb, 0x0000, 0x0000, 0x0000, 0x36d2, 0x0000, 0x1674, 0x29a6,
+	    0x0000, 0x3b56, 0x0000, 0x0000, 0x0000, 0x230b, 0x0000, 0x0000,
+	    0x49a2, 0x0000, 0x17b9, 0x2bdc, 0x0000, 0x4cfe, 0x4bc2, 0x0000,
+	    0x0000, 0x0000, 0x3ca0, 0x1e4b, 0x41c5, 0x4360, 0x32e1, 0x4b92,
+	    0x1a40, 0x2955, 0x34c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b84,
+	    0x12fe, 0x0000, 0x0000, 0x0000, 0x2d5f, 0x0000, 0x1546, 0x3d7c,
+	    0x0000, 0x25dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b64, 0x139e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4133, 0x0000, 0x0000,
+	    0x0000, 0x13cd, 0x463c, 0x23cb, 0x0069, 0x0000, 0x0000, 0x0106,
+	    0x0000, 0x389e, 0x0000, 0x052f, 0x0000, 0x3017, 0x0000, 0x0000,
+	    0x1521, 0x0000, 0x0540, 0x4ae4, 0x0000, 0x4529, 0x0000, 0x465c,
+	    0x0000, 0x109a, 0x0000, 0x0367, 0x1188, 0x0421, 0x1f92, 0x1aab,
+	    0x0000, 0x0acd, 0x0000, 0x0000, 0x1f0e, 0x0000, 0x0000, 0x0397,
+	    0x2fe0, 0x11f4, 0x0000, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x17f5, 0x0000, 0x1394,
+	    0x0000, 0x07a2, 0x0521, 0x204f, 0x0000, 0x10d9, 0x2f90, 0x3f5f,
+	    0x1902, 0x0b79, 0x3a18, 0x35d5, 0x0cea, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0883, 0x36bd, 0x0000, 0x0000, 0x12b8, 0x48f6, 0x42fd,
+	    0x4b37, 0x0000, 0x0000, 0x045d, 0x2223, 0x4ae2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x45c8, 0x0000, 0x0000, 0x4aaf, 0x0000, 0x0000,
+	    0x2347, 0x26e3, 0x0000, 0x0000, 0x0000, 0x19f8, 0x294e, 0x0000,
+	    0x0a97, 0x1273, 0x2fbd, 0x0e31, 0x1e42, 0x1abf, 0x3634, 0x0000,
+	    0x0000, 0x0000, 0x31d0, 0x1d7a, 0x0000, 0x0000, 0x0000, 0x4c01,
+	    0x0000, 0x3d52, 0x0000, 0x0000, 0x0000, 0x1fa1, 0x0000, 0x0000,
+	    0x41cf, 0x121e, 0x459d, 0x1085, 0x2f73, 0x2595, 0x2f0d, 0x0000,
+	    0x0000, 0x2b1e, 0x0000, 0x0000, 0x2aca, 0x3ce6, 0x4b93, 0x0000,
+	    0x3ddf, 0x2e2a, 0x0000, 0x45e1, 0x2721, 0x0000, 0x0000, 0x25b0,
+	    0x2081, 0x2721, 0x1756, 0x0000, 0x03cd, 0x20a5, 0x0000, 0x2f01,
+	    0x4d22, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ba, 0x0000, 0x4273,
+	    0x352c, 0x0dfd, 0x1638, 0x27a9, 0x14e1, 0x0000, 0x32e7, 0x261e,
+	    0x0000, 0x0000, 0x0552, 0x48f7, 0x1bd0, 0x0000, 0x4cd2, 0x403a,
+	    0x1d0a, 0x200f, 0x0000, 0x0497, 0x37eb, 0x0000, 0x404c, 0x0000,
+	    0x0000, 0x3473, 0x0000, 0x3e1e, 0x439e, 0x008b, 0x366d, 0x0718,
+	    0x0000, 0x0000, 0x138f, 0x0f6c, 0x1bf9, 0x3f38, 0x1f31, 0x0fa8,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x14f8, 0x0000, 0x0000, 0x00d3,
+	    0x3e59, 0x0000, 0x099f, 0x3684, 0x25a1, 0x0000, 0x0000, 0x1851,
+	    0x06a3, 0x4a3c, 0x3ad1, 0x0000, 0x1b3a, 0x057f, 0x0000, 0x0000,
+	    0x45bd, 0x0000, 0x0000, 0x0000, 0x318e, 0x3f9d, 0x11ec, 0x48b5,
+	    0x249f, 0x0000, 0x0000, 0x0000, 0x0673, 0x1a8b, 0x0888, 0x0000,
+	    0x19f5, 0x2d8b, 0x37bf, 0x0000, 0x03ea, 0x21d6, 0x1451, 0x4846,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2fd7, 0x41bd, 0x0000, 0x2653,
+	    0x3448, 0x2d61, 0x4492, 0x3e9b, 0x0624, 0x3ccb, 0x0000, 0x0c9d,
+	    0x2d98, 0x0000, 0x0000, 0x46c3, 0x4735, 0x1435, 0x23d9, 0x0000,
+	    0x0000, 0x07a9, 0x1bba, 0x0000, 0x2ac7, 0x2574, 0x0000, 0x0000,
+	    0x0000, 0x3876, 0x0000, 0x0000, 0x136e, 0x07c5, 0x4994, 0x0000,
+	    0x0d98, 0x0000, 0x2eb7, 0x00c9, 0x0000, 0x2f6d, 0x0000, 0x0d54,
+	    0x0000, 0x48b6, 0x0000, 0x2f70, 0x0000, 0x121e, 0x0000, 0x0000,
+	    0x0b60, 0x49a2, 0x1390, 0x0000, 0x0000, 0x33ff, 0x0000, 0x0000,
+	    0x21db, 0x187a, 0x44a0, 0x0000, 0x0000, 0x3ff8, 0x31ba, 0x0000,
+	    0x0000, 0x0973, 0x0000, 0x4c16, 0x0000, 0x0000, 0x1650, 0x3e3e,
+	    0x0000, 0x0000, 0x0000, 0x24e0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2772, 0x30a0, 0x0000, 0x2548, 0x4429, 0x0000, 0x0000, 0x3d0e,
+	    0x4232, 0x0000, 0x0000, 0x167b, 0x0000, 0x4ba3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4653, 0x0000, 0x0083, 0x2adb, 0x09f3, 0x28d7,
+	    0x0000, 0x1a5b, 0x0000, 0x3714, 0x28d9, 0x0000, 0x1512, 0x2a7c,
+	    0x0000, 0x0000, 0x0000, 0x0479, 0x37ff, 0x0000, 0x0000, 0x131c,
+	    0x0000, 0x0000, 0x413e, 0x0000, 0x202e, 0x316a, 0x234c, 0x0000,
+	    0x0000, 0x0000, 0x2273, 0x0000, 0x03e0, 0x269a, 0x0000, 0x2e07,
+	    0x16c5, 0x15de, 0x195a, 0x486d, 0x0000, 0x4452, 0x3c63, 0x0000,
+	    0x0000, 0x0b87, 0x0f8a, 0x0000, 0x11d7, 0x4bea, 0x0000, 0x11a8,
+	    0x39d8, 0x4503, 0x05df, 0x0000, 0x0000, 0x0000, 0x4d9e, 0x03e5,
+	    0x0cbc, 0x0000, 0x3d65, 0x323e, 0x0000, 0x2595, 0x2466, 0x2d76,
+	    0x0000, 0x0000, 0x317e, 0x0000, 0x1fd8, 0x029b, 0x3997, 0x25c8,
+	    0x2725, 0x0000, 0x0000, 0x4338, 0x3a72, 0x443f, 0x0000, 0x04b9,
+	    0x0000, 0x4ad2, 0x0000, 0x321c, 0x0223, 0x3fcd, 0x4cf2, 0x419b,
+	    0x19bd, 0x0000, 0x0000, 0x00f6, 0x0000, 0x0000, 0x0000, 0x2e14,
+	    0x15e8, 0x1653, 0x1390, 0x0000, 0x2cbf, 0x0f4c, 0x0000, 0x28ef,
+	    0x0000, 0x45c5, 0x0000, 0x0000, 0x146f, 0x35c7, 0x4d2c, 0x0000,
+	    0x3786, 0x05a8, 0x0a39, 0x0000, 0x1447, 0x1689, 0x0000, 0x2dd0,
+	    0x0000, 0x0000, 0x1042, 0x3522, 0x0000, 0x0000, 0x41e4, 0x33d3,
+	    0x335e, 0x0000, 0x0000, 0x0000, 0x3574, 0x1c0d, 0x28fe, 0x0000,
+	    0x0000, 0x46a2, 0x0000, 0x2a98, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2e59, 0x0000, 0x0000, 0x0000,
+	    0x2cf5, 0x2a2e, 0x0000, 0x3baa, 0x0000, 0x4c4f, 0x395f, 0x0000,
+	    0x30cd, 0x0000, 0x0262, 0x3dd9, 0x0000, 0x21b5, 0x06d3, 0x397b,
+	    0x0000, 0x0000, 0x0000, 0x2fdd, 0x0ff3, 0x0000, 0x0000, 0x1073,
+	    0x475a, 0x3ddb, 0x4025, 0x203c, 0x0000, 0x0230, 0x0000, 0x0363,
+	    0x0000, 0x0000, 0x3519, 0x0000, 0x13e8, 0x1b24, 0x19ab, 0x0000,
+	    0x0000, 0x02ad, 0x0308, 0x0000, 0x0521, 0x0000, 0x2251, 0x0185,
+	    0x2942, 0x22bb, 0x0000, 0x0352, 0x25b9, 0x0000, 0x20e4, 0x0000,
+	    0x2e33, 0x0025, 0x0000, 0x0589, 0x0000, 0x2c70, 0x0e0b, 0x467c,
+	    0x0000, 0x1618, 0x34d3, 0x0af7, 0x0000, 0x3473, 0x02c8, 0x0000,
+	    0x0000, 0x1e1e, 0x0000, 0x0000, 0x0fee, 0x0000, 0x0000, 0x250f,
+	    0x0000, 0x03ed, 0x4d7b, 0x3da0, 0x1f66, 0x3d21, 0x332d, 0x2b3b,
+	    0x0eaa, 0x0a23, 0x0000, 0x29f2, 0x01f3, 0x1b13, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3ee7, 0x1f27, 0x0000, 0x0000,
+	    0x2904, 0x2325, 0x3df2, 0x1f03, 0x4bc3, 0x0000, 0x0000, 0x45cd,
+	    0x0000, 0x0000, 0x1ec8, 0x33cb, 0x0000, 0x0000, 0x121c, 0x12ca,
+	    0x0000, 0x1d47, 0x2c6f, 0x4818, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4af8, 0x1d30, 0x0000, 0x0000, 0x2edd, 0x29ee, 0x0000, 0x0000,
+	    0x2e22, 0x137a, 0x1ead, 0x1bac, 0x0000, 0x1caf, 0x0000, 0x0000,
+	    0x0000, 0x2c33, 0x2df8, 0x1ab6, 0x0000, 0x1f2f, 0x0000, 0x0b4d,
+	    0x0000, 0x3ea1, 0x1d0c, 0x0000, 0x0000, 0x15eb, 0x16fa, 0x478d,
+	    0x169b, 0x02ef, 0x1886, 0x3201, 0x0000, 0x0000, 0x0000, 0x2f81,
+	    0x25d9, 0x15be, 0x0000, 0x429b, 0x0000, 0x0000, 0x379f, 0x06f9,
+	    0x0000, 0x29e3, 0x035c, 0x4df7, 0x0000, 0x123d, 0x0000, 0x157b,
+	    0x1759, 0x18ff, 0x3bd3, 0x2993, 0x0a22, 0x3bbf, 0x0000, 0x0000,
+	    0x442f, 0x0000, 0x1e50, 0x0000, 0x0000, 0x0027, 0x1d2a, 0x0000,
+	    0x0000, 0x0000, 0x4bc5, 0x0000, 0x0000, 0x0000, 0x4c13, 0x0000,
+	    0x4b93, 0x2bc0, 0x0801, 0x1305, 0x0000, 0x0000, 0x0000, 0x4df1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c8f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4c10, 0x2d47, 0x0000, 0x2293, 0x0000,
+	    0x0000, 0x145c, 0x1731, 0x40cb, 0x0000, 0x155e, 0x0bb5, 0x0000,
+	    0x4dbc, 0x2121, 0x4bcf, 0x21fa, 0x0000, 0x0000, 0x1c15, 0x19a2,
+	    0x0000, 0x0000, 0x421f, 0x4530, 0x0000, 0x0000, 0x1dbe, 0x362c,
+	    0x4845, 0x0000, 0x2c86, 0x0cea, 0x3306, 0x4ca5, 0x0877, 0x0000,
+	    0x0000, 0x3c4c, 0x1e79, 0x20cf, 0x3a66, 0x0000, 0x195a, 0x0000,
+	    0x455c, 0x0000, 0x43cb, 0x0000, 0x15b3, 0x0171, 0x1f3f, 0x0000,
+	    0x3f73, 0x0000, 0x0000, 0x3fd5, 0x1e01, 0x193e, 0x01d7, 0x2bc9,
+	    0x162e, 0x46ea, 0x0000, 0x0000, 0x32d7, 0x4d41, 0x0000, 0x2417,
+	    0x0b36, 0x08df, 0x0000, 0x0000, 0x0841, 0x1652, 0x3cde, 0x001b,
+	    0x060d, 0x4cb7, 0x0000, 0x0000, 0x0205, 0x0000, 0x0000, 0x2992,
+	    0x28b4, 0x0000, 0x1fa5, 0x0000, 0x0000, 0x3be4, 0x0000, 0x11f5,
+	    0x0209, 0x4cc0, 0x193d, 0x0000, 0x1552, 0x2431, 0x1144, 0x2b8e,
+	    0x2a91, 0x0000, 0x145a, 0x0000, 0x0179, 0x13e4, 0x1157, 0x0000,
+	    0x2c91, 0x1065, 0x4821, 0x0000, 0x0000, 0x0be1, 0x2b5b, 0x05e5,
+	    0x0000, 0x050f, 0x48b6, 0x0000, 0x3e77, 0x0000, 0x3870, 0x0000,
+	    0x0000, 0x3d67, 0x0000, 0x3d21, 0x0000, 0x0000, 0x390f, 0x0000,
+	    0x0000, 0x022c, 0x0000, 0x1244, 0x1b34, 0x0000, 0x4d72, 0x0000,
+	    0x2ffb, 0x24b3, 0x4b31, 0x0000, 0x3053, 0x348f, 0x0000, 0x4667,
+	    0x086a, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f99, 0x0000, 0x0000,
+	    0x0f81, 0x46e8, 0x4200, 0x0000, 0x0000, 0x3168, 0x0000, 0x0000,
+	    0x0000, 0x1dd2, 0x2649, 0x4357, 0x0000, 0x3cf5, 0x0000, 0x27d0,
+	    0x0000, 0x0000, 0x28e4, 0x17c4, 0x147a, 0x10cc, 0x0000, 0x0ae9,
+	    0x1485, 0x0dfe, 0x232a, 0x0000, 0x0000, 0x0000, 0x0124, 0x0000,
+	    0x33ed, 0x2beb, 0x0000, 0x4bad, 0x0000, 0x335d, 0x43a3, 0x279f,
+	    0x45b8, 0x2bfc, 0x2564, 0x46de, 0x0000, 0x0000, 0x30c0, 0x06c4,
+	    0x0000, 0x0000, 0x0b14, 0x0000, 0x0a5f, 0x0cf5, 0x0000, 0x0000,
+	    0x2d5a, 0x0000, 0x0000, 0x0000, 0x172d, 0x0000, 0x3a42, 0x2e29,
+	    0x44f6, 0x1b6f, 0x0ef7, 0x0000, 0x12ae, 0x0c16, 0x1dd6, 0x0000,
+	    0x3b23, 0x0000, 0x0000, 0x187e, 0x0000, 0x27c3, 0x3386, 0x2eaf,
+	    0x0000, 0x3fe6, 0x4101, 0x0b78, 0x0000, 0x1d2a, 0x0000, 0x10ea,
+	    0x01cd, 0x2995, 0x0000, 0x3450, 0x0000, 0x3d6f, 0x0000, 0x13c1,
+	    0x016b, 0x16cc, 0x4003, 0x1349, 0x3e00, 0x3bfb, 0x0670, 0x1ae8,
+	    0x3870, 0x38cb, 0x0000, 0x43b4, 0x0000, 0x0000, 0x0000, 0x1773,
+	    0x120d, 0x0000, 0x0000, 0x0000, 0x0000, 0x29fe, 0x0000, 0x1c5d,
+	    0x0000, 0x0122, 0x0000, 0x24d5, 0x0000, 0x0000, 0x4a6a, 0x49c0,
+	    0x1ebb, 0x0000, 0x0000, 0x3852, 0x0a17, 0x424f, 0x3d0d, 0x2195,
+	    0x3b52, 0x1b8d, 0x388e, 0x0cd6, 0x0b0e, 0x0000, 0x0000, 0x4a64,
+	    0x0000, 0x2cce, 0x0ee0, 0x0000, 0x174d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x11b6, 0x4095, 0x0000, 0x1b11, 0x0d7a, 0x098a, 0x1f51,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2476, 0x0000, 0x0000, 0x0603,
+	    0x07cd, 0x1736, 0x0000, 0x4276, 0x4c55, 0x4a6a, 0x0000, 0x451a,
+	    0x0000, 0x0000, 0x0440, 0x0253, 0x0000, 0x3e2a, 0x0000, 0x0000,
+	    0x0000, 0x4823, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3665, 0x0000, 0x4b2c, 0x0000, 0x0000, 0x4e18,
+	    0x4a43, 0x38ae, 0x2b82, 0x358d, 0x0c7e, 0x0000, 0x02b7, 0x0000,
+	    0x0000, 0x0442, 0x33e6, 0x0000, 0x3f1e, 0x080e, 0x0000, 0x0000,
+	    0x0000, 0x2634, 0x4b02, 0x0000, 0x2154, 0x447a, 0x3ea1, 0x3f76,
+	    0x14c9, 0x0000, 0x277a, 0x3ad4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4721, 0x0fe9, 0x41ee, 0x0000, 0x27a5, 0x0000, 0x2f99, 0x323d,
+	    0x1516, 0x05ec, 0x38a3, 0x0022, 0x0000, 0x18d5, 0x0000, 0x3564,
+	    0x1211, 0x374a, 0x0000, 0x2c37, 0x0000, 0x0000, 0x45b1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3537, 0x2507, 0x0000, 0x0000,
+	    0x49ad, 0x11ca, 0x17bf, 0x21db, 0x0000, 0x2546, 0x075c, 0x0000,
+	    0x0000, 0x0d88, 0x3689, 0x0000, 0x0cea, 0x0470, 0x0000, 0x0eae,
+	    0x41da, 0x090b, 0x28c2, 0x20c6, 0x2fc0, 0x0000, 0x0000, 0x183f,
+	    0x0000, 0x4282, 0x0632, 0x03c7, 0x4a22, 0x33b4, 0x43ef, 0x2ed5,
+	    0x1ed9, 0x00a6, 0x0000, 0x102c, 0x38fc, 0x0000, 0x3208, 0x0070,
+	    0x0000, 0x05f9, 0x0000, 0x0707, 0x0000, 0x0000, 0x3bec, 0x3b4a,
+	    0x0000, 0x3393, 0x0000, 0x23e1, 0x3e8e, 0x08ea, 0x31d0, 0x0925,
+	    0x36c6, 0x2d1a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2487,
+	    0x09f9, 0x317b, 0x063f, 0x41d5, 0x2a8f, 0x3da5, 0x0000, 0x32e3,
+	    0x0f2c, 0x199b, 0x0243, 0x2a08, 0x3082, 0x2d09, 0x25ea, 0x0000,
+	    0x0000, 0x3852, 0x15cb, 0x0000, 0x0000, 0x0b9a, 0x1fa7, 0x0e5e,
+	    0x062b, 0x0000, 0x299b, 0x19a5, 0x37b0, 0x4d15, 0x3c6d, 0x35b7,
+	    0x101b, 0x0000, 0x0000, 0x11fd, 0x4209, 0x0000, 0x3c2d, 0x0000,
+	    0x0f51, 0x0000, 0x0000, 0x191b, 0x2b2f, 0x21fe, 0x0000, 0x0000,
+	    0x0000, 0x1f39, 0x0000, 0x3205, 0x3aba, 0x0358, 0x470c, 0x3564,
+	    0x0b2c, 0x4a53, 0x375f, 0x04e5, 0x332c, 0x0000, 0x2d5e, 0x1265,
+	    0x0597, 0x18bb, 0x0000, 0x1b8c, 0x0000, 0x4486, 0x2e19, 0x0000,
+	    0x0000, 0x3bbc, 0x1701, 0x2f4d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x13da, 0x0000, 0x0a9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x2552,
+	    0x4522, 0x0cee, 0x364a, 0x1243, 0x0000, 0x0000, 0x0000, 0x4e04,
+	    0x18e2, 0x1c2f, 0x4223, 0x43fe, 0x0000, 0x1cad, 0x04dc, 0x0000,
+	    0x467b, 0x2f76, 0x1058, 0x0000, 0x0000, 0x13c1, 0x3883, 0x03fd,
+	    0x0000, 0x37f1, 0x2bb4, 0x0000, 0x2187, 0x15fa, 0x43d9, 0x0000,
+	    0x0000, 0x3a73, 0x0000, 0x2573, 0x28ec, 0x22cc, 0x048c, 0x0000,
+	    0x0000, 0x0000, 0x3e24, 0x0000, 0x0000, 0x0000, 0x4897, 0x12b9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3f8f, 0x475c, 0x0000, 0x0000,
+	    0x0000, 0x33de, 0x0000, 0x30c4, 0x0000, 0x1653, 0x0000, 0x3470,
+	    0x417e, 0x2a82, 0x4abb, 0x0000, 0x412b, 0x2622, 0x155e, 0x3daa,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x26ec, 0x0000, 0x21a9, 0x22f2, 0x0bfa, 0x40dd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x420d, 0x3725, 0x0b4b, 0x228f, 0x0491, 0x0b49,
+	    0x0000, 0x0000, 0x0000, 0x291f, 0x1d14, 0x0e8d, 0x0000, 0x0000,
+	    0x13fa, 0x1f02, 0x06d3, 0x21af, 0x068a, 0x0000, 0x0000, 0x1982,
+	    0x1273, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2260, 0x0000,
+	    0x1ded, 0x0000, 0x0000, 0x0000, 0x0aa0, 0x14b5, 0x0000, 0x0000,
+	    0x4561, 0x43a8, 0x2ce3, 0x1925, 0x0000, 0x0256, 0x0000, 0x0000,
+	    0x1ddc, 0x0000, 0x14f5, 0x0000, 0x0000, 0x0000, 0x308c, 0x27cd,
+	    0x0000, 0x0000, 0x1e85, 0x0000, 0x2d2f, 0x0000, 0x2367, 0x0000,
+	    0x0000, 0x3cbd, 0x0000, 0x0000, 0x1571, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x32a2, 0x0000, 0x022e, 0x0000, 0x0000, 0x39c5, 0x0ba7,
+	    0x3156, 0x17c2, 0x0000, 0x0b0d, 0x482d, 0x4467, 0x0296, 0x3ee9,
+	    0x0000, 0x2d05, 0x0b0e, 0x4758, 0x0000, 0x3e04, 0x0000, 0x4750,
+	    0x00d3, 0x4024, 0x4168, 0x25d3, 0x2575, 0x205c, 0x0000, 0x15eb,
+	    0x4c0b, 0x0000, 0x068b, 0x0000, 0x0000, 0x4866, 0x0000, 0x0000,
+	    0x2581, 0x45de, 0x1f1e, 0x0000, 0x0000, 0x426a, 0x3572, 0x3326,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x16a7, 0x0e39, 0x0000, 0x0000,
+	    0x0ade, 0x2ac0, 0x0000, 0x0000, 0x0000, 0x1ce8, 0x0000, 0x120e,
+	    0x0000, 0x1b5f, 0x1023, 0x060b, 0x0000, 0x45b6, 0x44af, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30a5, 0x0000, 0x0000,
+	    0x40c3, 0x4815, 0x0000, 0x1755, 0x0000, 0x0000, 0x0c59, 0x306e,
+	    0x0000, 0x1719, 0x0000, 0x3b31, 0x4e1e, 0x0000, 0x37eb, 0x35d6,
+	    0x376d, 0x0000, 0x25e7, 0x3f9b, 0x0000, 0x0000, 0x0000, 0x0fd0,
+	    0x0000, 0x0b9e, 0x3867, 0x42c5, 0x1e72, 0x4266, 0x0000, 0x38cd,
+	    0x0000, 0x3203, 0x07ab, 0x0000, 0x0000, 0x0000, 0x4760, 0x0000,
+	    0x3cfc, 0x18d7, 0x0000, 0x1f82, 0x0000, 0x0000, 0x0cf1, 0x0a79,
+	    0x2d4d, 0x0000, 0x0000, 0x2b26, 0x0066, 0x0000, 0x4981, 0x0000,
+	    0x0000, 0x0000, 0x08fd, 0x0000, 0x2540, 0x4486, 0x0000, 0x35e0,
+	    0x1b9a, 0x13ea, 0x0000, 0x0000, 0x3ec4, 0x03d8, 0x1b97, 0x2f5e,
+	    0x0000, 0x4231, 0x3118, 0x14b2, 0x0000, 0x3788, 0x0981, 0x3bbc,
+	    0x0000, 0x1419, 0x3861, 0x377c, 0x3a10, 0x1928, 0x0000, 0x20ac,
+	    0x34c1, 0x0000, 0x49c2, 0x0000, 0x0000, 0x050b, 0x00f3, 0x0000,
+	    0x0000, 0x2458, 0x21e0, 0x0000, 0x4cee, 0x430a, 0x2fdf, 0x4808,
+	    0x0000, 0x3791, 0x0000, 0x3385, 0x0000, 0x2e53, 0x0000, 0x361e,
+	    0x39a0, 0x2f53, 0x0000, 0x0000, 0x0000, 0x24c4, 0x0000, 0x0000,
+	    0x2971, 0x0000, 0x0000, 0x0c36, 0x0000, 0x1a81, 0x0000, 0x2aad,
+	    0x0e60, 0x36a4, 0x0000, 0x0a39, 0x0000, 0x0d46, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00b4, 0x44d2, 0x0000, 0x3201, 0x08fa, 0x39e8,
+	    0x3750, 0x1fce, 0x0000, 0x2f9e, 0x030a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2dd6, 0x0000, 0x0606, 0x0000, 0x4d62,
+	    0x061f, 0x2745, 0x4a00, 0x0000, 0x1b27, 0x1f04, 0x0f80, 0x4dfa,
+	    0x449e, 0x0000, 0x0000, 0x4824, 0x0000, 0x372c, 0x483d, 0x1869,
+	    0x0000, 0x0000, 0x48cf, 0x0000, 0x1cf9, 0x0000, 0x2f29, 0x3c57,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2894, 0x0e9d, 0x0000, 0x1d39,
+	    0x161d, 0x0000, 0x46d0, 0x22e7, 0x1998, 0x00b2, 0x0000, 0x0772,
+	    0x33c2, 0x3332, 0x0000, 0x0722, 0x429f, 0x14a6, 0x2d87, 0x0ae8,
+	    0x44a5, 0x0cc8, 0x2427, 0x0000, 0x06c5, 0x11ea, 0x0eb0, 0x0000,
+	    0x491d, 0x0000, 0x2ffa, 0x46d6, 0x0117, 0x0000, 0x0000, 0x099f,
+	    0x191f, 0x2e95, 0x0000, 0x0000, 0x3974, 0x0939, 0x0000, 0x0000,
+	    0x0e70, 0x3808, 0x4b93, 0x1c39, 0x0000, 0x0287, 0x0000, 0x1861,
+	    0x0000, 0x0000, 0x4889, 0x0000, 0x0000, 0x0f06, 0x0000, 0x0000,
+	    0x0000, 0x307d, 0x0000, 0x1c40, 0x0000, 0x0000, 0x0000, 0x132f,
+	    0x0000, 0x17a9, 0x1f2d, 0x0000, 0x3383, 0x0000, 0x350a, 0x0000,
+	    0x0000, 0x0000, 0x3d65, 0x17bd, 0x0000, 0x3423, 0x0000, 0x2f14,
+	    0x36cd, 0x0000, 0x29a2, 0x0000, 0x1382, 0x2a7f, 0x0000, 0x47c3,
+	    0x1ba3, 0x2d0e, 0x37fe, 0x0000, 0x1418, 0x0000, 0x0000, 0x0000,
+	    0x3d56, 0x064c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0191,
+	    0x0000, 0x3705, 0x0558, 0x0000, 0x0000, 0x3f25, 0x3499, 0x0000,
+	    0x0000, 0x1f3d, 0x2bb0, 0x4b45, 0x0000, 0x0000, 0x176a, 0x109a,
+	    0x2532, 0x0333, 0x0000, 0x36a6, 0x0000, 0x0000, 0x053b, 0x2141,
+	    0x465e, 0x0000, 0x201b, 0x3acc, 0x0000, 0x0000, 0x1eaf, 0x208e,
+	    0x1c7c, 0x14fd, 0x49b3, 0x0000, 0x0000, 0x37ab, 0x4084, 0x498a,
+	    0x04d8, 0x4b3e, 0x014c, 0x2d80, 0x0000, 0x3530, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2467, 0x2cfb, 0x0000, 0x45b6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1eba, 0x1ca8, 0x0000, 0x39ec, 0x0000, 0x0000,
+	    0x0000, 0x0a59, 0x13e9, 0x0000, 0x3152, 0x2714, 0x3726, 0x0000,
+	    0x08b2, 0x0000, 0x0000, 0x0000, 0x1ebf, 0x0000, 0x0000, 0x0000,
+	    0x1737, 0x11b8, 0x0000, 0x4d16, 0x0000, 0x0000, 0x279c, 0x0000,
+	    0x38f3, 0x3a8d, 0x30cf, 0x2390, 0x2c2a, 0x0000, 0x17ba, 0x0000,
+	    0x1bc7, 0x27fe, 0x4acd, 0x0000, 0x0000, 0x2fec, 0x4b7e, 0x0000,
+	    0x1955, 0x238e, 0x0bb0, 0x2ad1, 0x0000, 0x21ce, 0x3c35, 0x4353,
+	    0x0000, 0x0000, 0x254a, 0x0000, 0x0000, 0x438e, 0x0000, 0x0af7,
+	    0x0000, 0x0f05, 0x26c8, 0x3969, 0x0000, 0x0000, 0x2451, 0x0000,
+	    0x2662, 0x11e1, 0x08a9, 0x0000, 0x07bc, 0x17b3, 0x0000, 0x45e2,
+	    0x0000, 0x0000, 0x165a, 0x0000, 0x1570, 0x0000, 0x2c2f, 0x077c,
+	    0x0000, 0x1aff, 0x0000, 0x14c0, 0x2ae4, 0x0000, 0x4028, 0x08e7,
+	    0x0000, 0x2e52, 0x0000, 0x0601, 0x0000, 0x4270, 0x466d, 0x0000,
+	    0x0000, 0x3b49, 0x4af8, 0x079e, 0x0000, 0x40b1, 0x05c2, 0x0fc0,
+	    0x3766, 0x2614, 0x04cf, 0x0000, 0x1f82, 0x4b95, 0x0000, 0x00bc,
+	    0x22d5, 0x42ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x31ec, 0x0000,
+	    0x0000, 0x0809, 0x3ce1, 0x2cbe, 0x25d5, 0x3426, 0x0000, 0x20e6,
+	    0x0033, 0x1edf, 0x4243, 0x3ff1, 0x0000, 0x3435, 0x0000, 0x0000,
+	    0x3e4e, 0x1282, 0x3ee3, 0x0000, 0x4da0, 0x1deb, 0x14f3, 0x0000,
+	    0x30e4, 0x0000, 0x17fa, 0x0000, 0x49d8, 0x0000, 0x0000, 0x2e2d,
+	    0x0000, 0x1f95, 0x29f6, 0x3860, 0x3d68, 0x0000, 0x3c58, 0x1a90,
+	    0x08f4, 0x0000, 0x4371, 0x0000, 0x1228, 0x0000, 0x0000, 0x03ff,
+	    0x0000, 0x0000, 0x0bbc, 0x0000, 0x4a70, 0x0000, 0x0000, 0x0000,
+	    0x2fa1, 0x00ec, 0x4310, 0x29b3, 0x4738, 0x0000, 0x0000, 0x1440,
+	    0x0000, 0x0d4f, 0x0000, 0x06cf, 0x16e3, 0x0000, 0x33b1, 0x0000,
+	    0x49f4, 0x0517, 0x0000, 0x30f0, 0x106d, 0x0901, 0x3086, 0x0881,
+	    0x0000, 0x0000, 0x039c, 0x0000, 0x2d8d, 0x0000, 0x2c74, 0x0000,
+	    0x0000, 0x45ba, 0x0000, 0x255f, 0x0000, 0x2d71, 0x0338, 0x1337,
+	    0x389b, 0x3f21, 0x44c6, 0x0000, 0x14f4, 0x0000, 0x0a3a, 0x0000,
+	    0x0000, 0x2748, 0x29a0, 0x367f, 0x0000, 0x0000, 0x4df2, 0x3505,
+	    0x0000, 0x3c39, 0x1580, 0x478b, 0x46fd, 0x318a, 0x027d, 0x0000,
+	    0x0000, 0x1760, 0x0000, 0x2511, 0x0000, 0x0000, 0x0000, 0x39c6,
+	    0x0000, 0x0000, 0x44f5, 0x0000, 0x402f, 0x0000, 0x260e, 0x0000,
+	    0x05b1, 0x495c, 0x0000, 0x0000, 0x4cbf, 0x2691, 0x0000, 0x0000,
+	    0x0000, 0x4040, 0x37f1, 0x1893, 0x0000, 0x0000, 0x0000, 0x2b66,
+	    0x2785, 0x1dc9, 0x499f, 0x0000, 0x0000, 0x0000, 0x05f2, 0x25b2,
+	    0x49e4, 0x0118, 0x0000, 0x359b, 0x36a6, 0x139e, 0x1a49, 0x0000,
+	    0x32fc, 0x0000, 0x06ef, 0x0000, 0x0000, 0x30f3, 0x0000, 0x368c,
+	    0x192c, 0x270d, 0x0000, 0x0000, 0x0000, 0x1885, 0x4642, 0x1750,
+	    0x0000, 0x1746, 0x19e9, 0x0000, 0x0000, 0x0e34, 0x0000, 0x0fe3,
+	    0x0000, 0x0000, 0x30a1, 0x33f6, 0x0000, 0x0000, 0x2d79, 0x0000,
+	    0x0000, 0x37f8, 0x0000, 0x2a9b, 0x0000, 0x2f2a, 0x0000, 0x438b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3b8b, 0x4390, 0x1657, 0x0d08,
+	    0x26f6, 0x2c87, 0x0000, 0x04c0, 0x0f74, 0x3671, 0x0000, 0x0dd0,
+	    0x2023, 0x4c52, 0x0000, 0x0000, 0x4da6, 0x0833, 0x0000, 0x0000,
+	    0x3fa3, 0x4cf9, 0x0000, 0x0000, 0x0000, 0x267e, 0x490f, 0x0000,
+	    0x472c, 0x1b13, 0x0000, 0x35ab, 0x0000, 0x02cb, 0x0000, 0x2157,
+	    0x0000, 0x0000, 0x0d94, 0x1eeb, 0x0000, 0x20c5, 0x3773, 0x3c8f,
+	    0x0000, 0x1c18, 0x16bd, 0x2852, 0x0000, 0x4a56, 0x37e4, 0x1566,
+	    0x0a38, 0x2d3b, 0x48cc, 0x3cf8, 0x2792, 0x49f2, 0x4a24, 0x23e8,
+	    0x28d2, 0x30d2, 0x0000, 0x34f7, 0x0000, 0x4d44, 0x0000, 0x0000,
+	    0x1c81, 0x0000, 0x0000, 0x0000, 0x3cb4, 0x0000, 0x3643, 0x2a11,
+	    0x0000, 0x481c, 0x2326, 0x3c21, 0x1ef1, 0x0000, 0x0000, 0x0000,
+	    0x146d, 0x0000, 0x0000, 0x3d2d, 0x262a, 0x0000, 0x2657, 0x0000,
+	    0x0a67, 0x0000, 0x415f, 0x0382, 0x04d2, 0x0000, 0x0000, 0x0fd6,
+	    0x0344, 0x0000, 0x0000, 0x49ac, 0x0859, 0x0000, 0x1d75, 0x0000,
+	    0x4592, 0x3e14, 0x0000, 0x0000, 0x0632, 0x0000, 0x16ae, 0x45a4,
+	    0x064f, 0x0000, 0x02e3, 0x3afa, 0x0d64, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1eb9, 0x3f6e, 0x0000, 0x223d, 0x0000, 0x0000, 0x1b90,
+	    0x34cf, 0x0000, 0x406b, 0x004c, 0x0000, 0x3619, 0x1b84, 0x0000,
+	    0x3f0e, 0x0000, 0x260d, 0x1522, 0x0000, 0x0000, 0x4485, 0x314e,
+	    0x10d4, 0x34f1, 0x1929, 0x0000, 0x40c0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x486c, 0x0000, 0x403b, 0x45b3, 0x0000,
+	    0x0000, 0x1861, 0x0784, 0x190e, 0x0000, 0x0000, 0x09ea, 0x4779,
+	    0x0000, 0x1ee1, 0x0000, 0x0000, 0x3144, 0x0000, 0x0fd7, 0x0000,
+	    0x4509, 0x2ccd, 0x4ca0, 0x1309, 0x29a5, 0x0000, 0x306c, 0x33ba,
+	    0x0000, 0x0002, 0x0000, 0x2cc6, 0x25b3, 0x483b, 0x42b8, 0x4d63,
+	    0x0000, 0x0000, 0x0000, 0x4acb, 0x4dbd, 0x0000, 0x49aa, 0x1b3c,
+	    0x0000, 0x0000, 0x0000, 0x1f14, 0x1fcc, 0x3ed8, 0x1912, 0x4a37,
+	    0x0000, 0x0000, 0x0000, 0x114e, 0x3276, 0x43c2, 0x0d0b, 0x0000,
+	    0x4377, 0x0080, 0x0000, 0x4b08, 0x0000, 0x37c1, 0x3022, 0x3a79,
+	    0x1c88, 0x0000, 0x403c, 0x0000, 0x464c, 0x100f, 0x0000, 0x0000,
+	    0x0000, 0x3819, 0x0f43, 0x0000, 0x061e, 0x0b78, 0x0a06, 0x0a0f,
+	    0x1084, 0x0000, 0x41c8, 0x0640, 0x362f, 0x442d, 0x0000, 0x0781,
+	    0x0000, 0x111a, 0x2cc4, 0x3e1e, 0x0d8a, 0x0000, 0x0000, 0x2c97,
+	    0x3c72, 0x1490, 0x4b6d, 0x062d, 0x0000, 0x0000, 0x2479, 0x1ff3,
+	    0x0000, 0x06cb, 0x1006, 0x480a, 0x0000, 0x0747, 0x0000, 0x4a95,
+	    0x15f4, 0x239a, 0x05b4, 0x30ba, 0x3f29, 0x4d58, 0x350e, 0x04e3,
+	    0x4c2c, 0x244b, 0x36bb, 0x0000, 0x0000, 0x020f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3a4d, 0x4708, 0x0000, 0x3a59,
+	    0x2c90, 0x0000, 0x0000, 0x09b0, 0x10b2, 0x0ae8, 0x0000, 0x426d,
+	    0x4704, 0x0000, 0x0000, 0x0000, 0x0c75, 0x3a64, 0x0000, 0x44db,
+	    0x4ad6, 0x314b, 0x02f7, 0x0000, 0x01ef, 0x0000, 0x192f, 0x3d1b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x137c, 0x1d6e, 0x0a73, 0x2fdd,
+	    0x0000, 0x3519, 0x034b, 0x4b8c, 0x0633, 0x21e6, 0x0000, 0x0000,
+	    0x0cbf, 0x3434, 0x44f4, 0x3d47, 0x453c, 0x3563, 0x0000, 0x0000,
+	    0x1a90, 0x0000, 0x4d54, 0x1fca, 0x150b, 0x489d, 0x0d50, 0x0000,
+	    0x2a21, 0x0000, 0x0000, 0x0000, 0x3b6c, 0x27a3, 0x0000, 0x0000,
+	    0x4ab6, 0x048a, 0x0000, 0x187f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3bf6, 0x0587, 0x3663, 0x40e1, 0x29e2, 0x1309, 0x0000, 0x0000,
+	    0x397a, 0x4bc6, 0x4010, 0x31af, 0x0000, 0x0e45, 0x218b, 0x10ae,
+	    0x0000, 0x201f, 0x1e69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x112e, 0x0000, 0x0000, 0x0000, 0x458b, 0x0000, 0x0000,
+	    0x1fb3, 0x0000, 0x45fb, 0x2776, 0x0db3, 0x0000, 0x0000, 0x329c,
+	    0x298e, 0x0000, 0x3219, 0x270f, 0x0000, 0x0000, 0x0000, 0x01ac,
+	    0x0000, 0x3529, 0x02bd, 0x0000, 0x0672, 0x0000, 0x321f, 0x0000,
+	    0x0000, 0x30af, 0x1524, 0x35ea, 0x0000, 0x3aea, 0x2a5b, 0x354a,
+	    0x0000, 0x0000, 0x093e, 0x0000, 0x4c21, 0x2c4c, 0x18ef, 0x03e9,
+	    0x1c45, 0x0000, 0x4608, 0x0000, 0x0000, 0x1d06, 0x3859, 0x0000,
+	    0x3d5a, 0x0afb, 0x0000, 0x4670, 0x0000, 0x0000, 0x1ce3, 0x164e,
+	    0x0000, 0x0000, 0x4dc7, 0x2112, 0x0000, 0x0000, 0x4dae, 0x109c,
+	    0x4b81, 0x3057, 0x3449, 0x2ed7, 0x0000, 0x0000, 0x0000, 0x0ee9,
+	    0x2dcb, 0x0000, 0x0000, 0x0000, 0x16c3, 0x0000, 0x3f9f, 0x367d,
+	    0x0000, 0x051c, 0x0000, 0x0599, 0x0004, 0x36c3, 0x0000, 0x0000,
+	    0x0000, 0x00e0, 0x0000, 0x4ce9, 0x0000, 0x1a48, 0x0000, 0x0000,
+	    0x1172, 0x1faa, 0x0000, 0x0000, 0x0000, 0x0000, 0x42a6, 0x0000,
+	    0x0000, 0x22f8, 0x0000, 0x0000, 0x3f6d, 0x314e, 0x0000, 0x189c,
+	    0x46e9, 0x1e13, 0x3ebb, 0x0000, 0x0000, 0x40a7, 0x4872, 0x1a4f,
+	    0x2d0f, 0x0d8d, 0x0000, 0x0d85, 0x23e1, 0x10c0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x39e9, 0x42b3, 0x0a3c, 0x36ee, 0x1e62,
+	    0x3c40, 0x0000, 0x40be, 0x2ca3, 0x0000, 0x0000, 0x4885, 0x0000,
+	    0x0000, 0x04ae, 0x0000, 0x46a3, 0x0000, 0x0000, 0x1013, 0x42cf,
+	    0x3196, 0x0000, 0x319b, 0x0000, 0x0858, 0x0000, 0x1832, 0x0000,
+	    0x1b90, 0x1980, 0x0bfa, 0x0000, 0x0006, 0x0000, 0x4b37, 0x0000,
+	    0x1c8f, 0x04ea, 0x0000, 0x02ef, 0x0000, 0x0745, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2783, 0x0000,
+	    0x1fe8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c67,
+	    0x3655, 0x00f3, 0x0000, 0x0000, 0x0651, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2fff, 0x0000, 0x2ea3, 0x0000,
+	    0x0000, 0x0950, 0x0af5, 0x0000, 0x14d3, 0x0000, 0x0000, 0x080f,
+	    0x0000, 0x0000, 0x0000, 0x154d, 0x2b4b, 0x0000, 0x0aca, 0x0000,
+	    0x3333, 0x0000, 0x1542, 0x149d, 0x0000, 0x3948, 0x0000, 0x46de,
+	    0x0000, 0x2556, 0x0000, 0x2a9d, 0x21a7, 0x0000, 0x49d3, 0x38e3,
+	    0x0000, 0x4157, 0x3db8, 0x1d3d, 0x0000, 0x14ca, 0x2f6a, 0x3103,
+	    0x3ada, 0x4752, 0x449d, 0x0d30, 0x0000, 0x32bf, 0x4ae2, 0x47f8,
+	    0x3854, 0x0000, 0x4229, 0x0000, 0x0000, 0x3114, 0x3a0d, 0x057e,
+	    0x330e, 0x3a05, 0x322c, 0x07b9, 0x46cf, 0x0000, 0x297d, 0x0000,
+	    0x05ed, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45db, 0x0000,
+	    0x1d5f, 0x0000, 0x1ca4, 0x3bce, 0x0000, 0x0000, 0x0000, 0x30cf,
+	    0x0000, 0x0000, 0x424d, 0x0000, 0x0000, 0x37aa, 0x2f13, 0x0586,
+	    0x0000, 0x08bd, 0x0000, 0x0000, 0x01e4, 0x0f9c, 0x174c, 0x058a,
+	    0x0000, 0x1e3b, 0x0000, 0x40d3, 0x1812, 0x315e, 0x0000, 0x0000,
+	    0x36c0, 0x0000, 0x369e, 0x34a8, 0x3243, 0x4773, 0x0000, 0x07ff,
+	    0x1326, 0x0000, 0x0000, 0x2865, 0x29ae, 0x0000, 0x2083, 0x39a4,
+	    0x2b33, 0x0000, 0x1ac4, 0x0000, 0x0000, 0x0000, 0x2f95, 0x0d38,
+	    0x0584, 0x37f5, 0x2c80, 0x2a45, 0x0000, 0x399c, 0x1238, 0x0000,
+	    0x1f7e, 0x0000, 0x3d33, 0x0000, 0x15eb, 0x4c34, 0x0e66, 0x0000,
+	    0x0000, 0x0db4, 0x0000, 0x0000, 0x4400, 0x47c8, 0x2650, 0x35db,
+	    0x0000, 0x1120, 0x24ee, 0x0000, 0x0000, 0x3783, 0x0af9, 0x0f24,
+	    0x0000, 0x4d04, 0x3ea9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bee,
+	    0x03a4, 0x2cf1, 0x0000, 0x0000, 0x49d6, 0x1374, 0x0000, 0x0000,
+	    0x0000, 0x45ce, 0x4891, 0x20b7, 0x14a2, 0x0000, 0x04ff, 0x300e,
+	    0x0d6c, 0x2ffc, 0x184e, 0x290a, 0x0000, 0x0000, 0x0000, 0x4569,
+	    0x3b35, 0x0c86, 0x1d87, 0x0000, 0x0000, 0x0453, 0x0000, 0x0000,
+	    0x152b, 0x0000, 0x0000, 0x0aaf, 0x4779, 0x0000, 0x0ac5, 0x2b10,
+	    0x317a, 0x0b05, 0x475a, 0x2c91, 0x0000, 0x0000, 0x0000, 0x14b4,
+	    0x3654, 0x4d2e, 0x0000, 0x21fd, 0x383e, 0x3ba6, 0x42bf, 0x0000,
+	    0x26f3, 0x478d, 0x2221, 0x0000, 0x2797, 0x173b, 0x2353, 0x0000,
+	    0x0000, 0x45c9, 0x42d8, 0x3443, 0x43bc, 0x0000, 0x04f9, 0x0000,
+	    0x0000, 0x0000, 0x0676, 0x0000, 0x0000, 0x0d71, 0x24ce, 0x208c,
+	    0x0000, 0x0000, 0x24df, 0x0165, 0x0000, 0x4e16, 0x1f26, 0x31e2,
+	    0x07dd, 0x3fd0, 0x0abe, 0x31e5, 0x257f, 0x0000, 0x1a1c, 0x0000,
+	    0x40f8, 0x44a3, 0x31a6, 0x2553, 0x1744, 0x39be, 0x27f6, 0x2e2e,
+	    0x3903, 0x0000, 0x2096, 0x0000, 0x0000, 0x06f7, 0x0f4e, 0x4593,
+	    0x15d5, 0x0000, 0x09f6, 0x2a54, 0x0000, 0x1239, 0x0000, 0x2f80,
+	    0x1f6f, 0x0000, 0x0000, 0x2fbf, 0x0000, 0x0000, 0x4e0c, 0x18cf,
+	    0x0000, 0x0c35, 0x0000, 0x0000, 0x0000, 0x38b2, 0x0000, 0x0000,
+	    0x0000, 0x0b2c, 0x1ecd, 0x0000, 0x0000, 0x0000, 0x0000, 0x095f,
+	    0x4219, 0x0000, 0x2d01, 0x3691, 0x0000, 0x3598, 0x0000, 0x27c4,
+	    0x25af, 0x0a15, 0x0000, 0x1326, 0x0000, 0x0565, 0x0000, 0x0000,
+	    0x2c0d, 0x23f7, 0x0000, 0x0000, 0x0000, 0x49ce, 0x0000, 0x0000,
+	    0x34f1, 0x0000, 0x0000, 0x0000, 0x4426, 0x16bc, 0x01be, 0x0000,
+	    0x1897, 0x44d8, 0x174d, 0x2460, 0x0000, 0x1afb, 0x0000, 0x3798,
+	    0x0ba7, 0x2899, 0x0bda, 0x0000, 0x0000, 0x0000, 0x1610, 0x42f3,
+	    0x1675, 0x0000, 0x2ed2, 0x0000, 0x40b9, 0x0000, 0x029c, 0x0000,
+	    0x3e95, 0x0000, 0x1e72, 0x11a9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3313, 0x141e, 0x0000, 0x2a38, 0x0000, 0x47e3, 0x0000, 0x2828,
+	    0x0000, 0x23dd, 0x36ca, 0x0000, 0x0000, 0x337a, 0x0000, 0x0000,
+	    0x0000, 0x217b, 0x4640, 0x0000, 0x333a, 0x2de6, 0x413b, 0x312a,
+	    0x06d7, 0x0000, 0x428b, 0x0000, 0x0000, 0x0000, 0x1ad6, 0x3a86,
+	    0x0000, 0x0000, 0x0000, 0x3e76, 0x05d3, 0x0000, 0x0000, 0x0000,
+	    0x19ff, 0x0000, 0x09c5, 0x0000, 0x0000, 0x3add, 0x0000, 0x3c84,
+	    0x3695, 0x25a9, 0x0000, 0x0000, 0x0ce9, 0x0000, 0x34f0, 0x0000,
+	    0x0000, 0x3153, 0x2628, 0x1172, 0x0000, 0x0000, 0x0000, 0x4d50,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1652,
+	    0x0c11, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a89, 0x0000, 0x0afe,
+	    0x21a0, 0x0071, 0x3cfc, 0x48f1, 0x0000, 0x375e, 0x2630, 0x11ca,
+	    0x0000, 0x03eb, 0x0000, 0x0d8b, 0x0000, 0x2a7c, 0x0000, 0x1364,
+	    0x0000, 0x1a6c, 0x3375, 0x076f, 0x0000, 0x0000, 0x4426, 0x3339,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2345, 0x3280, 0x0000, 0x0000,
+	    0x0000, 0x4ae6, 0x020b, 0x0000, 0x2af3, 0x04fc, 0x1fe1, 0x4d92,
+	    0x1610, 0x4e07, 0x2730, 0x2bdd, 0x374c, 0x0000, 0x06c5, 0x0000,
+	    0x4232, 0x0000, 0x1df1, 0x352d, 0x0000, 0x0000, 0x48fd, 0x18b2,
+	    0x0000, 0x0000, 0x0775, 0x05ab, 0x1c87, 0x3c2a, 0x0c06, 0x3acc,
+	    0x0a0b, 0x0000, 0x018b, 0x0493, 0x186b, 0x0000, 0x0000, 0x0000,
+	    0x0c04, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d27, 0x156c, 0x0000,
+	    0x0000, 0x0000, 0x1815, 0x0000, 0x269e, 0x23a2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x07a5, 0x0000, 0x0000, 0x0000, 0x3fe3, 0x0000,
+	    0x0000, 0x0cf0, 0x0000, 0x0000, 0x49c5, 0x19fc, 0x0000, 0x0000,
+	    0x338a, 0x3011, 0x0000, 0x0000, 0x0000, 0x3588, 0x441e, 0x0000,
+	    0x1427, 0x2096, 0x0000, 0x32f4, 0x0000, 0x087f, 0x14e9, 0x0023,
+	    0x0000, 0x0000, 0x015f, 0x43c0, 0x0000, 0x23e5, 0x01f5, 0x4556,
+	    0x0966, 0x0e3c, 0x400a, 0x25ca, 0x1bd2, 0x0444, 0x15fb, 0x0000,
+	    0x269a, 0x0000, 0x31ca, 0x3898, 0x1041, 0x0000, 0x39eb, 0x0000,
+	    0x3581, 0x0a20, 0x2e61, 0x1249, 0x0000, 0x0000, 0x0cb4, 0x359d,
+	    0x2d88, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f12, 0x0000, 0x4710,
+	    0x02ea, 0x0000, 0x0000, 0x0000, 0x09d2, 0x05cc, 0x1419, 0x0000,
+	    0x0000, 0x10fd, 0x0000, 0x1294, 0x0000, 0x2554, 0x3494, 0x169a,
+	    0x0000, 0x3a92, 0x16ad, 0x0000, 0x0fc9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2252, 0x0000, 0x0000, 0x0000, 0x0000, 0x332e, 0x446d,
+	    0x0000, 0x0c47, 0x00a8, 0x2c4b, 0x0000, 0x15fa, 0x0000, 0x0000,
+	    0x0000, 0x2f30, 0x334c, 0x0000, 0x2b6d, 0x0000, 0x0000, 0x041a,
+	    0x0000, 0x1f4b, 0x28f9, 0x1751, 0x076b, 0x19be, 0x0000, 0x0000,
+	    0x0df4, 0x0000, 0x0000, 0x0c55, 0x1e37, 0x2919, 0x1ac0, 0x0000,
+	    0x0000, 0x1840, 0x1f45, 0x30df, 0x0000, 0x2f32, 0x04c1, 0x322d,
+	    0x0000, 0x0000, 0x0000, 0x3600, 0x0000, 0x2d99, 0x0000, 0x0000,
+	    0x246e, 0x0000, 0x0000, 0x352c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0976, 0x3a51, 0x2a30, 0x0000, 0x0b15, 0x0000, 0x0000, 0x2f56,
+	    0x0000, 0x0657, 0x2eb5, 0x2aa7, 0x2b3c, 0x31a2, 0x390a, 0x0000,
+	    0x28a7, 0x0000, 0x0000, 0x0000, 0x1bfc, 0x22b1, 0x1b0d, 0x289a,
+	    0x359f, 0x34e3, 0x222e, 0x0000, 0x186c, 0x0000, 0x3e56, 0x3a27,
+	    0x0000, 0x3f84, 0x258d, 0x03a6, 0x2c4a, 0x0000, 0x3da6, 0x3a6d,
+	    0x0b22, 0x0000, 0x2cba, 0x39d4, 0x2919, 0x0000, 0x0000, 0x07a5,
+	    0x0000, 0x2b97, 0x0000, 0x0000, 0x0665, 0x0000, 0x1140, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x40f4, 0x0010, 0x473f, 0x0000,
+	    0x0000, 0x0000, 0x10e3, 0x0000, 0x0000, 0x1d34, 0x0000, 0x0000,
+	    0x13ab, 0x0000, 0x0000, 0x42c2, 0x0000, 0x05f4, 0x0000, 0x29f3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3f0f, 0x0000, 0x0000, 0x2a31, 0x0000,
+	    0x0000, 0x0000, 0x4cf4, 0x44cd, 0x3a7e, 0x0000, 0x0000, 0x0000,
+	    0x2fd0, 0x0e2e, 0x1b0a, 0x35ed, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4a0e, 0x0000, 0x2e02, 0x0000, 0x0000, 0x0000, 0x4bd4,
+	    0x0000, 0x3236, 0x0000, 0x0000, 0x4109, 0x0000, 0x0000, 0x2003,
+	    0x0000, 0x0000, 0x3b83, 0x0000, 0x41fd, 0x0d4f, 0x0d02, 0x4627,
+	    0x1c4d, 0x0000, 0x0000, 0x4cb2, 0x0000, 0x3149, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x20f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x309f, 0x34de, 0x0000, 0x41ef, 0x0000, 0x0000, 0x21a9,
+	    0x35d1, 0x328f, 0x0000, 0x0000, 0x0000, 0x2dc3, 0x0000, 0x0000,
+	    0x17b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e2f, 0x0000, 0x14c7,
+	    0x40b8, 0x0000, 0x0000, 0x2760, 0x0000, 0x114a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1167, 0x3dd3, 0x0000,
+	    0x0000, 0x0000, 0x1a75, 0x0000, 0x0000, 0x0000, 0x0000, 0x1eba,
+	    0x4b69, 0x1cc0, 0x0000, 0x0000, 0x0000, 0x0c7f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1a28, 0x1f56, 0x0000, 0x0000, 0x1672,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2ab3, 0x01ad, 0x0000, 0x0000, 0x44fe, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42e7, 0x0000, 0x30f6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1764,
+	    0x4391, 0x02b7, 0x4bf0, 0x0000, 0x0000, 0x08d3, 0x0000, 0x19c0,
+	    0x0000, 0x0000, 0x252a, 0x4b9c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1cf8, 0x0000, 0x3756, 0x461f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x21d9, 0x0aa6, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0b99, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1e0b, 0x0000, 0x1d46, 0x2772, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0950, 0x0d3f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4a0a, 0x0000, 0x0000, 0x0743,
+	    0x0000, 0x3b68, 0x0000, 0x0000, 0x2949, 0x0000, 0x31bb, 0x15ef,
+	    0x0000, 0x1384, 0x451b, 0x0000, 0x0000, 0x0000, 0x3845, 0x3794,
+	    0x0000, 0x0000, 0x4cd8, 0x0000, 0x0000, 0x0000, 0x3f16, 0x0000,
+	    0x33f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48b4,
+	    0x4a04, 0x0000, 0x0000, 0x0000, 0x0715, 0x0000, 0x2be7, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4dc3, 0x2369, 0x0000, 0x0000, 0x0000,
+	    0x141c, 0x3b19, 0x0000, 0x0000, 0x4545, 0x0000, 0x0000, 0x0000,
+	    0x3d7e, 0x0000, 0x1b5f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0937, 0x0000,
+	    0x497b, 0x2124, 0x02ba, 0x3df9, 0x0000, 0x05fd, 0x0000, 0x0000,
+	    0x0000, 0x4b45, 0x0000, 0x0000, 0x4dce, 0x1500, 0x4b3c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x44e9, 0x4426, 0x1b98, 0x0000,
+	    0x312b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2c29, 0x3bec, 0x0000, 0x0000, 0x4802, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1320, 0x2fd3, 0x0000,
+	    0x4a13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x266b, 0x0000, 0x3e72, 0x0000, 0x1f04, 0x4dfd,
+	    0x0000, 0x25ba, 0x0000, 0x0000, 0x0000, 0x263e, 0x0000, 0x0000,
+	    0x2a59, 0x174a, 0x0000, 0x0f16, 0x0000, 0x0000, 0x3adb, 0x2554,
+	    0x3c81, 0x0000, 0x0000, 0x0000, 0x1cd3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1451, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1353,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2514, 0x1cc7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1753, 0x0d49, 0x0000, 0x1602,
+	    0x0000, 0x0000, 0x06d4, 0x0000, 0x37c4, 0x0000, 0x08e5, 0x0000,
+	    0x0000, 0x0000, 0x4ae9, 0x0000, 0x3bfe, 0x0000, 0x0000, 0x49d9,
+	    0x0000, 0x0000, 0x4285, 0x0000, 0x362d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1264, 0x0000, 0x0b3f, 0x2e83, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1dab, 0x0fbe, 0x0000, 0x1992, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1249, 0x098e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x308a, 0x27fe, 0x0000, 0x4a3d, 0x0000, 0x344e, 0x0000,
+	    0x0000, 0x1c4f, 0x0000, 0x0b4c, 0x0000, 0x0512, 0x1bf3, 0x0000,
+	    0x0000, 0x0c02, 0x03c7, 0x0000, 0x0000, 0x4251, 0x0000, 0x4c0c,
+	    0x1a93, 0x4445, 0x2281, 0x0000, 0x0000, 0x4101, 0x13d9, 0x0000,
+	    0x0000, 0x332e, 0x0000, 0x141c, 0x0000, 0x3706, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x099d, 0x031c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1373, 0x0000, 0x0000, 0x1c07, 0x0000, 0x0000, 0x3e6b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0704, 0x0000, 0x4590, 0x174b,
+	    0x3717, 0x0000, 0x0000, 0x0000, 0x33fa, 0x4d2b, 0x251e, 0x147f,
+	    0x0a8e, 0x0000, 0x0000, 0x3de0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1f1c, 0x0000, 0x32b0, 0x0000, 0x2039,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26cc, 0x0000, 0x2fb0,
+	    0x0000, 0x0000, 0x0000, 0x1a03, 0x2ab4, 0x0000, 0x282f, 0x0000,
+	    0x2705, 0x0000, 0x3b8c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x001c, 0x27a0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0f62, 0x0000, 0x0000, 0x0000, 0x1631,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e9c, 0x0000, 0x41b3,
+	    0x0000, 0x4ddf, 0x10ce, 0x3355, 0x4765, 0x4284, 0x0000, 0x0000,
+	    0x34d5, 0x1883, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2864, 0x1f8b, 0x0000, 0x28a8, 0x2368, 0x0000, 0x4640, 0x0000,
+	    0x353b, 0x0000, 0x0000, 0x0000, 0x35dd, 0x0000, 0x4942, 0x0000,
+	    0x10d7, 0x0000, 0x0000, 0x0000, 0x10b4, 0x45e6, 0x0000, 0x0000,
+	    0x4440, 0x1331, 0x0000, 0x0000, 0x0000, 0x180e, 0x3b61, 0x1099,
+	    0x122d, 0x0000, 0x0000, 0x0000, 0x0000, 0x35a2, 0x0000, 0x03b2,
+	    0x0000, 0x0000, 0x0ed9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0c3c, 0x0000, 0x0000, 0x0000, 0x2c77, 0x0000, 0x25e6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48eb,
+	    0x0ee1, 0x011e, 0x0000, 0x0000, 0x0000, 0x02de, 0x158d, 0x0000,
+	    0x192e, 0x0000, 0x0000, 0x0000, 0x467d, 0x1cd1, 0x0e82, 0x0000,
+	    0x0000, 0x15c9, 0x4d1f, 0x4ce7, 0x0000, 0x09ef, 0x2ea4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1f10, 0x0000, 0x0000, 0x2eda,
+	    0x3bba, 0x0ff0, 0x0000, 0x0000, 0x0000, 0x140d, 0x3b72, 0x0000,
+	    0x0f7a, 0x0000, 0x0000, 0x0000, 0x0000, 0x28eb, 0x0d2c, 0x0000,
+	    0x0000, 0x0000, 0x190e, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000,
+	    0x0000, 0x0000, 0x128b, 0x0526, 0x0000, 0x269a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x447d, 0x1ffd, 0x0000, 0x1a30, 0x0000, 0x0000,
+	    0x2c69, 0x2024, 0x1fac, 0x2919, 0x0000, 0x0efa, 0x0000, 0x3e36,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4d28, 0x03e0, 0x25f3, 0x05c8, 0x05e8, 0x4aa3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1e03, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d8e, 0x4059,
+	    0x0000, 0x0000, 0x1e8f, 0x3345, 0x16bc, 0x0000, 0x0000, 0x0000,
+	    0x4d6f, 0x4d64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0ba1, 0x4a03, 0x0000, 0x3f82, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x33b5, 0x1924, 0x0000, 0x0000,
+	    0x0000, 0x256b, 0x0000, 0x0000, 0x3a6e, 0x0000, 0x0000, 0x3ef2,
+	    0x0000, 0x0000, 0x0000, 0x4896, 0x086a, 0x0000, 0x0658, 0x0000,
+	    0x0000, 0x3724, 0x47da, 0x0000, 0x2ed9, 0x0000, 0x0000, 0x4375,
+	    0x25c7, 0x3dd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a24,
+	    0x0000, 0x4af1, 0x168d, 0x4968, 0x0000, 0x259d, 0x0000, 0x32bc,
+	    0x0000, 0x173b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x436d, 0x0000, 0x1eaa, 0x0000, 0x0000, 0x3a2f, 0x0000, 0x0000,
+	    0x03de, 0x2cd5, 0x1cea, 0x0000, 0x1646, 0x0000, 0x0000, 0x38cb,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4db2, 0x0000, 0x0309, 0x0000, 0x0000, 0x12af, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0806, 0x0000,
+	    0x2615, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41a7, 0x0000, 0x0bad,
+	    0x0000, 0x28b5, 0x44c0, 0x39f9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2104, 0x103f, 0x2eb4, 0x0000, 0x0000,
+	    0x0000, 0x19b5, 0x0000, 0x0000, 0x221a, 0x0000, 0x026f, 0x0000,
+	    0x2e4b, 0x0000, 0x0000, 0x0000, 0x298d, 0x4236, 0x0000, 0x040f,
+	    0x02c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4bf3, 0x0000, 0x0000, 0x29f2, 0x2942, 0x0000, 0x0000, 0x1bc2,
+	    0x155c, 0x0000, 0x124a, 0x0000, 0x0000, 0x0000, 0x0cdf, 0x0000,
+	    0x0000, 0x14be, 0x0746, 0x088f, 0x05ac, 0x1b68, 0x4155, 0x0000,
+	    0x0000, 0x2e59, 0x0000, 0x0000, 0x0000, 0x2f92, 0x0000, 0x4b95,
+	    0x0000, 0x0000, 0x0000, 0x010f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4cd7, 0x03ad, 0x0000, 0x48b5, 0x1062, 0x2e72, 0x0000, 0x247e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3d31, 0x0000, 0x0000, 0x0000,
+	    0x25f6, 0x0000, 0x25ca, 0x0000, 0x0000, 0x0000, 0x3871, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2bee, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x45b7, 0x0000, 0x46cd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x410d, 0x0000, 0x2c5f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00e6, 0x23ad, 0x1131, 0x0000, 0x0000,
+	    0x0000, 0x4737, 0x15d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x34a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x189d, 0x0000, 0x4668,
+	    0x0000, 0x3298, 0x0000, 0x0000, 0x36e3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x25fb, 0x1ae1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2eb4, 0x0000, 0x0000, 0x0000, 0x4b81, 0x0000, 0x0000, 0x0000,
+	    0x1197, 0x3805, 0x3423, 0x0d18, 0x0000, 0x154b, 0x0000, 0x0000,
+	    0x0000, 0x36d9, 0x0000, 0x254b, 0x0000, 0x0000, 0x0000, 0x436a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1aee, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x39b9, 0x0000, 0x4bc5, 0x0000, 0x267f, 0x0000, 0x3637, 0x0000,
+	    0x361a, 0x2a6b, 0x49c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x382f,
+	    0x0000, 0x0000, 0x0000, 0x0b61, 0x0000, 0x0000, 0x1b2a, 0x1c91,
+	    0x384c, 0x07c1, 0x1cf4, 0x41ea, 0x0000, 0x33cd, 0x22e4, 0x0000,
+	    0x0000, 0x0000, 0x401b, 0x0000, 0x0000, 0x0000, 0x3ed1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3073, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0dde, 0x20d5, 0x0000, 0x4123,
+	    0x416b, 0x0203, 0x0000, 0x0000, 0x2ec9, 0x0000, 0x0000, 0x11ee,
+	    0x0000, 0x0000, 0x0de3, 0x0000, 0x0000, 0x0000, 0x403a, 0x1548,
+	    0x0000, 0x0770, 0x1917, 0x44c3, 0x0000, 0x2bff, 0x0000, 0x0000,
+	    0x0386, 0x26b7, 0x00aa, 0x3b7d, 0x4973, 0x04c4, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x252f, 0x0000, 0x2656, 0x0000, 0x21fb, 0x0000,
+	    0x0000, 0x05ed, 0x1d95, 0x236e, 0x1c75, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2b49, 0x37a5, 0x239e, 0x0000, 0x0000,
+	    0x4c3e, 0x0000, 0x198b, 0x0000, 0x0000, 0x0000, 0x0000, 0x43d6,
+	    0x1ca8, 0x0000, 0x2227, 0x0000, 0x0000, 0x0f7d, 0x0303, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03f3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2ec8, 0x166d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2d92, 0x0000, 0x1d41, 0x0000, 0x0000, 0x0000, 0x05f2,
+	    0x0000, 0x26c2, 0x0000, 0x0000, 0x1718, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x38c6, 0x46a4, 0x1dee, 0x0000, 0x0000, 0x0000, 0x314d,
+	    0x0000, 0x4a59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4013, 0x4116, 0x3e09, 0x0000, 0x0000, 0x0000, 0x3f7d,
+	    0x3e04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x17a6, 0x0000,
+	    0x0701, 0x0000, 0x0000, 0x1f6e, 0x0000, 0x33ec, 0x0000, 0x4663,
+	    0x0000, 0x1203, 0x0000, 0x0000, 0x0000, 0x00c3, 0x3d35, 0x0000,
+	    0x0000, 0x0000, 0x0d75, 0x0000, 0x0000, 0x0df4, 0x23f6, 0x0000,
+	    0x495a, 0x0000, 0x042b, 0x2304, 0x1cc6, 0x2398, 0x0000, 0x0000,
+	    0x0000, 0x2b5c, 0x0e25, 0x0000, 0x0000, 0x0000, 0x3db0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1cf0, 0x0000, 0x46bd, 0x0000, 0x0000, 0x0000, 0x2c75,
+	    0x0000, 0x40c5, 0x0000, 0x0000, 0x0000, 0x402e, 0x0000, 0x0000,
+	    0x21ea, 0x0000, 0x42f0, 0x1d36, 0x0000, 0x3f68, 0x0000, 0x0000,
+	    0x3a19, 0x381d, 0x0000, 0x0315, 0x305d, 0x0000, 0x26cf, 0x0000,
+	    0x4bdd, 0x4be0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a3e,
+	    0x4ad8, 0x0000, 0x2c92, 0x4a2a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2a9f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x38bc, 0x193a, 0x0a6c, 0x0000, 0x1bc1, 0x0000, 0x0000, 0x0966,
+	    0x04be, 0x2df1, 0x4d7a, 0x0000, 0x1e8c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0bcd, 0x0000, 0x0000, 0x369d, 0x2804, 0x0000, 0x0000,
+	    0x05c7, 0x0000, 0x0000, 0x02fd, 0x0000, 0x0000, 0x0e0a, 0x0000,
+	    0x0000, 0x0000, 0x3c94, 0x0000, 0x0000, 0x0b9a, 0x15aa, 0x0186,
+	    0x0000, 0x0000, 0x4677, 0x0000, 0x0000, 0x07b2, 0x0000, 0x4905,
+	    0x405f, 0x0000, 0x0000, 0x0000, 0x08b4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0dc1, 0x1801, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2c24, 0x1ad3, 0x0000, 0x4937, 0x4bed, 0x0835, 0x177c,
+	    0x0206, 0x0000, 0x3fde, 0x3131, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01f5, 0x3a9d, 0x3a88, 0x0000, 0x0000,
+	    0x0000, 0x462b, 0x0000, 0x0000, 0x0000, 0x248f, 0x0000, 0x29ce,
+	    0x31a1, 0x2a41, 0x0000, 0x0000, 0x0000, 0x36cb, 0x1553, 0x0000,
+	    0x14dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x185b,
+	    0x0000, 0x3ffb, 0x0000, 0x0000, 0x0000, 0x297a, 0x0591, 0x204a,
+	    0x0000, 0x25ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0234, 0x0000,
+	    0x3863, 0x0000, 0x068f, 0x0000, 0x0000, 0x0717, 0x0000, 0x0000,
+	    0x12e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3842, 0x2850,
+	    0x0000, 0x091d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d20, 0x0000,
+	    0x48b9, 0x0000, 0x334a, 0x0000, 0x0000, 0x3ed6, 0x0000, 0x3922,
+	    0x0000, 0x0000, 0x0000, 0x2a37, 0x12d1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0c17, 0x0282, 0x0000, 0x0000, 0x0000, 0x255c, 0x0000,
+	    0x0168, 0x18fe, 0x0000, 0x222f, 0x0000, 0x0000, 0x4a9a, 0x1572,
+	    0x0000, 0x2ad7, 0x2148, 0x0000, 0x0000, 0x0000, 0x21bf, 0x2abb,
+	    0x0000, 0x0000, 0x069e, 0x3a63, 0x0000, 0x1422, 0x0000, 0x0000,
+	    0x3c48, 0x0000, 0x21f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a06,
+	    0x0000, 0x281d, 0x4ca2, 0x0000, 0x1881, 0x0000, 0x359c, 0x402d,
+	    0x2332, 0x0000, 0x4110, 0x0000, 0x1823, 0x15e1, 0x0000, 0x15e1,
+	    0x0000, 0x0000, 0x0e6b, 0x0000, 0x0000, 0x2e78, 0x098f, 0x0000,
+	    0x0000, 0x4545, 0x0000, 0x0000, 0x0000, 0x0000, 0x0403, 0x0000,
+	    0x0000, 0x1a63, 0x0ea3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300,
+	    0x15d0, 0x0000, 0x0000, 0x34ca, 0x0000, 0x235c, 0x30af, 0x3dcc,
+	    0x0000, 0x0000, 0x0000, 0x231c, 0x4c4e, 0x0000, 0x0000, 0x0000,
+	    0x273a, 0x0000, 0x0000, 0x34e8, 0x0000, 0x057b, 0x2be9, 0x0000,
+	    0x49d7, 0x0000, 0x4508, 0x06ed, 0x0000, 0x0000, 0x23a8, 0x0000,
+	    0x0000, 0x31e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03cf,
+	    0x0000, 0x3e3d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3657, 0x491f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2949, 0x0000, 0x3bad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0287,
+	    0x19f6, 0x06c7, 0x0000, 0x2929, 0x003c, 0x2b3e, 0x0000, 0x42cc,
+	    0x0000, 0x0000, 0x1be1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3361, 0x0000, 0x4516, 0x2d2c, 0x35f6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02cf, 0x0000, 0x0000,
+	    0x4a30, 0x0000, 0x0450, 0x0000, 0x0000, 0x0000, 0x4cf3, 0x47b5,
+	    0x0000, 0x0000, 0x0000, 0x3856, 0x0000, 0x0000, 0x0000, 0x0428,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4684, 0x4b71,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x286c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4a05, 0x0000, 0x0000, 0x2412, 0x0d2e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3599, 0x0000,
+	    0x0000, 0x39bb, 0x1817, 0x0000, 0x0000, 0x48af, 0x0000, 0x0000,
+	    0x0000, 0x3e07, 0x0000, 0x08f9, 0x0000, 0x0000, 0x2afb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2c43, 0x0db3, 0x3fc7, 0x0000,
+	    0x1761, 0x0000, 0x0000, 0x43ea, 0x0000, 0x0be5, 0x3965, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x388f,
+	    0x0000, 0x03e3, 0x2f89, 0x0000, 0x2521, 0x098b, 0x0000, 0x1d7e,
+	    0x0000, 0x0000, 0x0000, 0x098e, 0x0000, 0x4c01, 0x0000, 0x0000,
+	    0x46a2, 0x0000, 0x0000, 0x1a5a, 0x21ca, 0x0000, 0x0000, 0x3b4c,
+	    0x2081, 0x160f, 0x0000, 0x2d94, 0x49c9, 0x182f, 0x21bd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2c13, 0x0638, 0x12fd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1dd4, 0x0000, 0x0000, 0x06e6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0d3b, 0x44cc, 0x0000, 0x0000, 0x18b9, 0x0000,
+	    0x0000, 0x4764, 0x34be, 0x3edc, 0x0000, 0x0000, 0x0000, 0x3e0b,
+	    0x23c0, 0x114e, 0x0000, 0x0000, 0x0000, 0x0000, 0x067c, 0x0000,
+	    0x0000, 0x4b58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0e38, 0x226a, 0x384b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1f44, 0x00c3, 0x0000, 0x36bf, 0x4859, 0x0000, 0x1e32,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0e87, 0x45f5, 0x1b02, 0x02e8,
+	    0x0000, 0x0000, 0x40e6, 0x0000, 0x20b3, 0x0415, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x27af, 0x0000, 0x0000, 0x32fc, 0x0000, 0x0000,
+	    0x0000, 0x4211, 0x2709, 0x05d8, 0x0000, 0x0000, 0x0000, 0x1b9b,
+	    0x3ea1, 0x0000, 0x0000, 0x000c, 0x4b98, 0x1ff4, 0x0000, 0x4be2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1bff, 0x0000,
+	    0x2cde, 0x47c2, 0x0000, 0x0000, 0x0000, 0x0f92, 0x0000, 0x1750,
+	    0x0000, 0x0000, 0x0000, 0x022d, 0x0000, 0x0000, 0x0000, 0x40a8,
+	    0x0000, 0x0000, 0x02ca, 0x451e, 0x0000, 0x29e3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x29fc, 0x0000, 0x040a, 0x0000, 0x1222,
+	    0x41be, 0x0000, 0x31c8, 0x0000, 0x2423, 0x0be2, 0x2a71, 0x0000,
+	    0x0000, 0x3f51, 0x0000, 0x0000, 0x0000, 0x1d31, 0x0000, 0x0000,
+	    0x29ae, 0x404e, 0x0000, 0x3cfb, 0x12b2, 0x0000, 0x0d4a, 0x0aa3,
+	    0x0000, 0x0000, 0x36d3, 0x12a4, 0x0000, 0x4d42, 0x208d, 0x0000,
+	    0x49db, 0x0000, 0x0000, 0x426b, 0x4b78, 0x0000, 0x0000, 0x31fe,
+	    0x0000, 0x4972, 0x0000, 0x0000, 0x1045, 0x1cb8, 0x0000, 0x0000,
+	    0x0000, 0x0c97, 0x0000, 0x0000, 0x0000, 0x359d, 0x0000, 0x0000,
+	    0x1e3d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x07dc, 0x0000, 0x0000, 0x0000, 0x025b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x142f, 0x2344, 0x2ce8, 0x31e5, 0x0000,
+	    0x4692, 0x06f5, 0x0000, 0x0000, 0x06f7, 0x043f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4aa8, 0x0000, 0x0000, 0x0000, 0x3696, 0x2350, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2032, 0x3f70, 0x18d2, 0x0000, 0x205a,
+	    0x331d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10cd,
+	    0x0000, 0x0000, 0x1505, 0x0000, 0x0000, 0x07cf, 0x3291, 0x1971,
+	    0x0000, 0x0000, 0x0000, 0x28a4, 0x0000, 0x0000, 0x0000, 0x2852,
+	    0x0000, 0x0549, 0x1340, 0x0000, 0x0000, 0x0000, 0x1f03, 0x0000,
+	    0x1edb, 0x0000, 0x30a2, 0x0000, 0x0000, 0x10b7, 0x1531, 0x0000,
+	    0x2daf, 0x183c, 0x4c1d, 0x0000, 0x408d, 0x0000, 0x0a12, 0x0000,
+	    0x0000, 0x0000, 0x11ea, 0x2544, 0x3269, 0x25fb, 0x0000, 0x041a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x009e, 0x0000, 0x477f,
+	    0x0000, 0x0000, 0x0000, 0x2391, 0x07cf, 0x0000, 0x0000, 0x409d,
+	    0x0000, 0x0f0b, 0x0000, 0x0000, 0x3c73, 0x1e63, 0x0000, 0x0000,
+	    0x0000, 0x38e0, 0x155b, 0x0000, 0x0000, 0x498c, 0x0000, 0x0000,
+	    0x4916, 0x0000, 0x0000, 0x0000, 0x0c2a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4709, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a36, 0x0000,
+	    0x0000, 0x0000, 0x05d8, 0x0000, 0x39fa, 0x0000, 0x0000, 0x41e0,
+	    0x4dad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18ff,
+	    0x343b, 0x256e, 0x0000, 0x0000, 0x1530, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x17a0, 0x0000, 0x0000, 0x363b, 0x0e7f, 0x1e68, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x188f, 0x0000, 0x0000, 0x1623, 0x0000, 0x0000,
+	    0x35c6, 0x34e8, 0x2a43, 0x4257, 0x2f23, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x08bb, 0x0000, 0x0000, 0x3688,
+	    0x218c, 0x0000, 0x44cd, 0x262d, 0x26b0, 0x4a06, 0x0000, 0x0000,
+	    0x3e2e, 0x0000, 0x3640, 0x1c1e, 0x0000, 0x0000, 0x0000, 0x1d4c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2733,
+	    0x0000, 0x362c, 0x0000, 0x0000, 0x0000, 0x0000, 0x153e, 0x4653,
+	    0x0000, 0x0000, 0x3b48, 0x4bc8, 0x0000, 0x0000, 0x3ade, 0x0000,
+	    0x3159, 0x0000, 0x0000, 0x0000, 0x0000, 0x02cc, 0x054c, 0x1a12,
+	    0x06dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e77, 0x0000, 0x0000,
+	    0x0000, 0x484d, 0x0000, 0x34bf, 0x0cdb, 0x2834, 0x0000, 0x3c14,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2984, 0x0000, 0x0000, 0x0000,
+	    0x4770, 0x0000, 0x0000, 0x3ed3, 0x0000, 0x0000, 0x3066, 0x0ea3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0642, 0x0000,
+	    0x0000, 0x0000, 0x240c, 0x0000, 0x3a16, 0x2e8e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2175, 0x0000,
+	    0x0000, 0x2c41, 0x1e74, 0x0000, 0x0000, 0x0000, 0x0000, 0x3909,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4263, 0x0000, 0x2a8a, 0x3fd3,
+	    0x0e9f, 0x450b, 0x0000, 0x0000, 0x0000, 0x0000, 0x2af2, 0x0000,
+	    0x1ec5, 0x22b2, 0x4217, 0x0000, 0x3414, 0x0000, 0x31c9, 0x01d8,
+	    0x0000, 0x0000, 0x0f32, 0x3e8f, 0x15bf, 0x0000, 0x0000, 0x3a7a,
+	    0x0000, 0x4d8a, 0x0f62, 0x3225, 0x2cc3, 0x0000, 0x1bfc, 0x4156,
+	    0x0000, 0x0000, 0x2374, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0eab, 0x0000, 0x2684, 0x0000, 0x0000, 0x4396, 0x282b, 0x2da4,
+	    0x0000, 0x35bb, 0x32c8, 0x2426, 0x1606, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x127d, 0x0e41, 0x0000, 0x012a, 0x09d9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0311, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x361d, 0x0000, 0x0000, 0x3cb5, 0x33a1, 0x0000, 0x46a8, 0x29b4,
+	    0x4b86, 0x0000, 0x1724, 0x0000, 0x0000, 0x2724, 0x1d38, 0x1d48,
+	    0x0000, 0x0000, 0x3437, 0x0000, 0x0000, 0x148b, 0x0000, 0x3ff1,
+	    0x0000, 0x31e7, 0x0000, 0x1f80, 0x0000, 0x0000, 0x496c, 0x08ec,
+	    0x0000, 0x25e5, 0x0000, 0x0000, 0x0176, 0x0000, 0x305d, 0x33e3,
+	    0x1f1f, 0x4bc0, 0x0d90, 0x29dd, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x39fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1246, 0x377b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11fa,
+	    0x0000, 0x0000, 0x0000, 0x2ec5, 0x2063, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2478, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x221c, 0x4ba5, 0x0000, 0x3990,
+	    0x4d19, 0x0000, 0x0000, 0x01da, 0x0dbc, 0x0000, 0x0000, 0x056e,
+	    0x0000, 0x0000, 0x0696, 0x0000, 0x3731, 0x1077, 0x0000, 0x0b52,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4909, 0x0000,
+	    0x2538, 0x0000, 0x04ad, 0x2dcc, 0x12fd, 0x00fd, 0x422e, 0x43a3,
+	    0x07aa, 0x0000, 0x0000, 0x3219, 0x0000, 0x09d1, 0x3409, 0x1714,
+	    0x0000, 0x4a8d, 0x0000, 0x0000, 0x0000, 0x057a, 0x0000, 0x0000,
+	    0x0000, 0x3c3a, 0x0000, 0x0000, 0x23c3, 0x36fd, 0x1d78, 0x02b4,
+	    0x0000, 0x0000, 0x0000, 0x2ade, 0x23ec, 0x0000, 0x0000, 0x0000,
+	    0x1cab, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e5c, 0x0000, 0x0000,
+	    0x0000, 0x47ac, 0x0000, 0x3333, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x232f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21e0,
+	    0x0000, 0x1c6d, 0x0122, 0x0000, 0x2ae3, 0x1676, 0x412d, 0x0000,
+	    0x0b70, 0x1b5b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0e06, 0x0000, 0x0000, 0x0000, 0x1a30,
+	    0x3a62, 0x315f, 0x0000, 0x0000, 0x0af4, 0x0000, 0x0000, 0x4689,
+	    0x177e, 0x0000, 0x0a30, 0x0000, 0x1988, 0x1cba, 0x0000, 0x0000,
+	    0x4c6a, 0x0000, 0x0000, 0x4092, 0x23d9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a79, 0x4dbd, 0x0000,
+	    0x0000, 0x2f56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4b63, 0x0000, 0x251b, 0x2651, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3c73, 0x0000, 0x3b2e, 0x35c7,
+	    0x25ef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x07e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x445b, 0x0000,
+	    0x301c, 0x0b78, 0x0000, 0x0000, 0x0000, 0x477a, 0x0229, 0x28c0,
+	    0x36f4, 0x1a12, 0x412b, 0x3dbf, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3e8c, 0x29ef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4db4, 0x0000, 0x0000, 0x3b5d, 0x07fd,
+	    0x2025, 0x0000, 0x0000, 0x3eca, 0x0000, 0x0462, 0x0000, 0x2357,
+	    0x0000, 0x036c, 0x125e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x402a, 0x0000, 0x0dfc, 0x2f53, 0x42fc, 0x0000, 0x3a3c, 0x0000,
+	    0x0000, 0x299c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02a3, 0x0e20, 0x462b, 0x0000, 0x1a6c, 0x0a7a, 0x0673, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1946, 0x0000, 0x1a48,
+	    0x0000, 0x0000, 0x3df9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1eb9, 0x0000, 0x3659, 0x0cec, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0bba, 0x06cd, 0x09bd,
+	    0x0000, 0x044c, 0x2e9d, 0x18a0, 0x3947, 0x239e, 0x03a2, 0x0f34,
+	    0x1fb8, 0x04e3, 0x335b, 0x4558, 0x17f0, 0x0000, 0x0000, 0x2b34,
+	    0x2679, 0x0000, 0x36c0, 0x2c85, 0x0000, 0x0000, 0x2456, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x25cd, 0x0000, 0x0000, 0x29dc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1bf8,
+	    0x14df, 0x2823, 0x0000, 0x06ed, 0x0000, 0x0000, 0x11f5, 0x09ab,
+	    0x2499, 0x4a12, 0x1eff, 0x3065, 0x0213, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dc0, 0x0000,
+	    0x0000, 0x0000, 0x20ae, 0x1bab, 0x0f55, 0x0123, 0x0000, 0x0000,
+	    0x26dc, 0x3464, 0x0e33, 0x46ce, 0x0000, 0x0000, 0x42de, 0x4969,
+	    0x08e7, 0x0000, 0x0000, 0x0000, 0x1002, 0x0000, 0x4c64, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c01, 0x0000, 0x0000,
+	    0x39c1, 0x4db5, 0x0000, 0x0000, 0x09ba, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x065d, 0x0000, 0x429e, 0x0000, 0x0000, 0x44ea,
+	    0x44cc, 0x0000, 0x0000, 0x0000, 0x4cbc, 0x1372, 0x0d1f, 0x0000,
+	    0x1f50, 0x1d1c, 0x2bf3, 0x0000, 0x0000, 0x0000, 0x4bf8, 0x0000,
+	    0x0000, 0x3a89, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b96, 0x0000,
+	    0x0000, 0x0d80, 0x0000, 0x0000, 0x45b3, 0x3ec1, 0x0000, 0x0bbd,
+	    0x0000, 0x07ec, 0x0656, 0x0000, 0x0000, 0x0000, 0x4ce9, 0x0000,
+	    0x13e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2993, 0x0000,
+	    0x0000, 0x46fd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d2a,
+	    0x21f1, 0x34c1, 0x0000, 0x0000, 0x01b4, 0x0000, 0x3b7c, 0x33f2,
+	    0x0000, 0x0000, 0x26c6, 0x0892, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x07a0, 0x0000, 0x263f, 0x0000, 0x0000, 0x0000,
+	    0x195b, 0x1dab, 0x0000, 0x0000, 0x23b6, 0x368e, 0x2a81, 0x0000,
+	    0x0000, 0x0000, 0x1836, 0x0000, 0x0000, 0x0000, 0x0000, 0x47cf,
+	    0x0000, 0x1958, 0x0000, 0x40fd, 0x0000, 0x0000, 0x0000, 0x276c,
+	    0x0000, 0x0000, 0x2181, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2a2b, 0x3cde, 0x2321, 0x0000, 0x13c9,
+	    0x28c0, 0x0000, 0x2f89, 0x10f7, 0x0000, 0x0000, 0x3521, 0x4a5c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x48ff, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0bc4, 0x1587, 0x21e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x482e,
+	    0x0000, 0x0000, 0x2ff7, 0x452c, 0x316a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e7c,
+	    0x4745, 0x0000, 0x3fbc, 0x0000, 0x0000, 0x2594, 0x0855, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4422, 0x0000, 0x3ddb, 0x0000,
+	    0x497f, 0x0000, 0x0000, 0x0000, 0x0000, 0x36de, 0x2fc1, 0x0000,
+	    0x0000, 0x179c, 0x0000, 0x28cd, 0x1afa, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x09ed, 0x1324, 0x1e2a, 0x0000, 0x0000, 0x0000, 0x00a0,
+	    0x0000, 0x3bf4, 0x0000, 0x0000, 0x1dc4, 0x0000, 0x0000, 0x3241,
+	    0x1c03, 0x1c78, 0x0000, 0x4470, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x42af, 0x0e6a, 0x0000, 0x0000, 0x0000, 0x3d04, 0x02e7, 0x0000,
+	    0x2240, 0x0000, 0x0000, 0x403f, 0x0000, 0x04b7, 0x0000, 0x0000,
+	    0x0642, 0x0000, 0x0000, 0x0000, 0x11c5, 0x0000, 0x0000, 0x0000,
+	    0x1018, 0x43aa, 0x0000, 0x0000, 0x0000, 0x4641, 0x0534, 0x2560,
+	    0x27d9, 0x3967, 0x0000, 0x0000, 0x4c82, 0x0000, 0x33ad, 0x0000,
+	    0x0000, 0x0000, 0x10e1, 0x0000, 0x0000, 0x0000, 0x3d26, 0x0000,
+	    0x22dd, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b6d, 0x2b29, 0x2994,
+	    0x0000, 0x3871, 0x0000, 0x023f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0c19, 0x03c3, 0x0000, 0x282b, 0x0000, 0x0000, 0x0000, 0x3f3a,
+	    0x0000, 0x0000, 0x03e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2e10, 0x0000, 0x0000, 0x0000, 0x0000, 0x03ac, 0x2a53, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0b2e, 0x050e, 0x0000, 0x0000, 0x36e6, 0x0000, 0x0000,
+	    0x3098, 0x0000, 0x0000, 0x0000, 0x0000, 0x418e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2db2, 0x36ac, 0x0000,
+	    0x1aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4068, 0x2735,
+	    0x0000, 0x0000, 0x3744, 0x0837, 0x0000, 0x0000, 0x0000, 0x331e,
+	    0x0000, 0x3dce, 0x0000, 0x0000, 0x09d6, 0x13fd, 0x0000, 0x0000,
+	    0x18fb, 0x0000, 0x0000, 0x444e, 0x0000, 0x0000, 0x1539, 0x0000,
+	    0x0000, 0x36dc, 0x235f, 0x31be, 0x2939, 0x0000, 0x49b7, 0x0000,
+	    0x0000, 0x21c5, 0x0000, 0x0000, 0x02d7, 0x0000, 0x0000, 0x0000,
+	    0x038a, 0x0000, 0x0000, 0x0000, 0x0000, 0x327b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1256, 0x0000, 0x0000, 0x0000, 0x0000, 0x24c4,
+	    0x4b5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x21c7, 0x16ee, 0x0000,
+	    0x250c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x019a, 0x065f, 0x1bf8, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0879, 0x1963,
+	    0x0000, 0x3279, 0x4354, 0x0000, 0x379e, 0x4d1e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x37f9, 0x0000, 0x0000, 0x0000, 0x0bac,
+	    0x0000, 0x3943, 0x0000, 0x4033, 0x17ce, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x088b, 0x0000, 0x3eeb, 0x0000,
+	    0x0000, 0x322e, 0x019f, 0x0000, 0x0000, 0x2275, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x151d, 0x0000, 0x3c50, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x086c, 0x28ba, 0x0000, 0x454d, 0x0000,
+	    0x3633, 0x0000, 0x2239, 0x0000, 0x038c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1c01, 0x0000, 0x08fb, 0x0000, 0x0000, 0x20b6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1a16, 0x25e1, 0x0000, 0x0790,
+	    0x222c, 0x0000, 0x2c76, 0x0000, 0x161b, 0x0fdf, 0x0000, 0x035d,
+	    0x0795, 0x4d5d, 0x0000, 0x0000, 0x0000, 0x0040, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3f4b, 0x02e6, 0x42c3, 0x1d43, 0x0000, 0x3940,
+	    0x3ddc, 0x301e, 0x0000, 0x364e, 0x1f63, 0x15a9, 0x0000, 0x1bd1,
+	    0x0000, 0x0000, 0x2e0b, 0x0000, 0x0000, 0x2228, 0x0000, 0x0000,
+	    0x0000, 0x0a62, 0x0c0a, 0x2917, 0x19a8, 0x15c3, 0x0391, 0x0000,
+	    0x0000, 0x2ff6, 0x29e6, 0x120e, 0x0000, 0x0000, 0x1051, 0x0000,
+	    0x34b0, 0x08af, 0x0000, 0x07f0, 0x036b, 0x3a1a, 0x0244, 0x1000,
+	    0x0000, 0x0000, 0x44b5, 0x29fa, 0x0000, 0x42fb, 0x465b, 0x3812,
+	    0x0000, 0x0000, 0x0000, 0x1c62, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x360b, 0x1567, 0x0000, 0x03d4, 0x0000, 0x0000,
+	    0x46de, 0x0000, 0x0000, 0x0000, 0x25b8, 0x0000, 0x0000, 0x0f0d,
+	    0x40b5, 0x0000, 0x2a6f, 0x0000, 0x1ba0, 0x0000, 0x0000, 0x0000,
+	    0x43e7, 0x0000, 0x0000, 0x0000, 0x30d4, 0x0000, 0x0000, 0x0972,
+	    0x0927, 0x0000, 0x3868, 0x0000, 0x0000, 0x0000, 0x1370, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0400, 0x0000, 0x0000, 0x4c0e, 0x0000,
+	    0x0000, 0x0000, 0x33b2, 0x0000, 0x40fe, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1724, 0x0000, 0x0000, 0x2086, 0x0000, 0x0000,
+	    0x0000, 0x1e23, 0x0000, 0x0000, 0x0000, 0x0613, 0x430f, 0x0000,
+	    0x0000, 0x0787, 0x0000, 0x1117, 0x31d7, 0x0000, 0x0fc5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x102c, 0x0000, 0x4a75, 0x0000,
+	    0x0000, 0x419d, 0x190d, 0x23ff, 0x0000, 0x0000, 0x0000, 0x210f,
+	    0x4bf3, 0x0000, 0x0000, 0x33b8, 0x0000, 0x4cef, 0x0000, 0x0000,
+	    0x0000, 0x3143, 0x0000, 0x497d, 0x0000, 0x0000, 0x3554, 0x20aa,
+	    0x3d1f, 0x31da, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0bc0, 0x0000, 0x0000, 0x260d, 0x4461, 0x0000, 0x0f64,
+	    0x0000, 0x3c02, 0x0000, 0x0000, 0x0000, 0x0000, 0x29ff, 0x0000,
+	    0x4951, 0x0000, 0x068b, 0x0000, 0x0000, 0x0000, 0x0000, 0x344b,
+	    0x0000, 0x125f, 0x0000, 0x0000, 0x0000, 0x0000, 0x4755, 0x1014,
+	    0x04f0, 0x0000, 0x2af1, 0x0000, 0x0000, 0x0000, 0x4444, 0x102a,
+	    0x395c, 0x0000, 0x0000, 0x4140, 0x1de9, 0x0000, 0x0000, 0x0000,
+	    0x4331, 0x0000, 0x1d60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3fcd, 0x0000, 0x0000, 0x0000, 0x32c4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1a1c, 0x19fb, 0x2f2f, 0x0000, 0x0000, 0x0122, 0x2d56, 0x0000,
+	    0x0000, 0x0000, 0x4297, 0x38ba, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3ba5, 0x0000, 0x0000, 0x0000, 0x4a7d,
+	    0x0000, 0x0000, 0x05b6, 0x2788, 0x0000, 0x0d57, 0x0000, 0x0000,
+	    0x3e11, 0x0000, 0x3b3d, 0x054b, 0x078d, 0x0000, 0x3771, 0x0000,
+	    0x2f64, 0x0000, 0x31e6, 0x0000, 0x0000, 0x0000, 0x3874, 0x047a,
+	    0x0000, 0x0000, 0x4dcf, 0x261a, 0x0000, 0x0000, 0x0000, 0x22f9,
+	    0x0000, 0x0000, 0x4224, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1ef8, 0x0000, 0x0000, 0x0000, 0x0000, 0x2afb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3b89, 0x1512, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x070d, 0x0000, 0x029f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1707, 0x0000, 0x295c,
+	    0x0000, 0x4123, 0x158c, 0x0000, 0x0000, 0x0000, 0x2c93, 0x1e1b,
+	    0x3741, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b29, 0x03ff,
+	    0x0000, 0x1f97, 0x0000, 0x45ab, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x00af, 0x0000, 0x2eb3, 0x0000, 0x018e, 0x0000, 0x237d, 0x0000,
+	    0x0000, 0x0000, 0x3d54, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1834, 0x0000, 0x439d, 0x306f, 0x0000, 0x4d9b, 0x0000, 0x0000,
+	    0x0000, 0x300b, 0x0000, 0x0000, 0x0000, 0x42ef, 0x3f48, 0x1b7e,
+	    0x0000, 0x2cae, 0x0000, 0x0000, 0x4370, 0x0000, 0x0000, 0x0000,
+	    0x1e4b, 0x0000, 0x3f50, 0x0000, 0x0000, 0x4446, 0x0000, 0x3f0e,
+	    0x0000, 0x0000, 0x42bd, 0x0000, 0x2648, 0x1ad5, 0x0000, 0x307c,
+	    0x0261, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d6b, 0x4713,
+	    0x3e6d, 0x0000, 0x0000, 0x1780, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x392e, 0x0000, 0x366b, 0x0000, 0x40f8, 0x0000,
+	    0x43ea, 0x0000, 0x0000, 0x4767, 0x0000, 0x0000, 0x0000, 0x1160,
+	    0x0000, 0x0069, 0x2e29, 0x0000, 0x0000, 0x108a, 0x0ba8, 0x0000,
+	    0x0738, 0x0000, 0x0000, 0x34db, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x135c, 0x3af4, 0x0000, 0x0000, 0x0000, 0x4b06, 0x24ed,
+	    0x0000, 0x0000, 0x4758, 0x0000, 0x251f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0559, 0x0000, 0x2ff5, 0x246a, 0x310c, 0x0000,
+	    0x3068, 0x0000, 0x0de8, 0x0000, 0x1536, 0x1d37, 0x0000, 0x0000,
+	    0x1029, 0x29a7, 0x34ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01c7, 0x4074, 0x0000, 0x14f9, 0x0d30, 0x0000, 0x4afc,
+	    0x4c5f, 0x2a2b, 0x0000, 0x32fd, 0x0000, 0x0000, 0x0e75, 0x0000,
+	    0x0000, 0x257d, 0x4493, 0x17a3, 0x0000, 0x0000, 0x0000, 0x2929,
+	    0x0000, 0x0000, 0x4dad, 0x0000, 0x0000, 0x44f6, 0x2fbe, 0x0000,
+	    0x44a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x321e, 0x0000,
+	    0x0000, 0x4c46, 0x471d, 0x2cef, 0x0000, 0x4773, 0x3f3e, 0x0000,
+	    0x12e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0b0c, 0x0000, 0x4a38, 0x0000, 0x1310,
+	    0x0000, 0x0000, 0x0000, 0x171a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1dcc, 0x0000,
+	    0x3754, 0x0000, 0x090e, 0x175c, 0x0000, 0x1dfc, 0x0000, 0x22a1,
+	    0x100b, 0x19f3, 0x0000, 0x1fd4, 0x0000, 0x4744, 0x0000, 0x0000,
+	    0x0e63, 0x13ec, 0x076a, 0x2ee2, 0x0000, 0x349d, 0x0000, 0x35c4,
+	    0x0000, 0x0000, 0x0000, 0x28f2, 0x28c3, 0x4084, 0x0a2f, 0x0000,
+	    0x0f84, 0x44b6, 0x29f8, 0x0000, 0x3edf, 0x0000, 0x0000, 0x0000,
+	    0x14fb, 0x393e, 0x1abb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x18f2, 0x0000, 0x0db6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2938, 0x1b1e, 0x0599, 0x46b4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x108d, 0x0000, 0x17e3, 0x0000, 0x13b4, 0x0000, 0x0ce7,
+	    0x2b44, 0x2442, 0x0000, 0x38ac, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x49fa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23be, 0x0000,
+	    0x1cf0, 0x0000, 0x23de, 0x0000, 0x0000, 0x4b83, 0x0000, 0x178e,
+	    0x0a12, 0x0000, 0x0000, 0x0000, 0x288d, 0x3e47, 0x286a, 0x3a66,
+	    0x0000, 0x0000, 0x0000, 0x19ff, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1caa, 0x0000, 0x0000, 0x0000, 0x0000, 0x3535, 0x445c,
+	    0x0000, 0x0000, 0x131f, 0x0000, 0x0000, 0x0000, 0x381e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05db,
+	    0x09a7, 0x0000, 0x0000, 0x0000, 0x0125, 0x0000, 0x3baf, 0x0000,
+	    0x0000, 0x0000, 0x3dcd, 0x0000, 0x219f, 0x0000, 0x0000, 0x4a52,
+	    0x0000, 0x0000, 0x0000, 0x0af6, 0x0000, 0x2ff1, 0x30bf, 0x0000,
+	    0x02b1, 0x0000, 0x3c5c, 0x0000, 0x25db, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2009, 0x0000, 0x0000, 0x0000, 0x369c, 0x0000,
+	    0x12e2, 0x0000, 0x2bbb, 0x0000, 0x1a14, 0x3669, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1405, 0x168e, 0x482a, 0x2d9d,
+	    0x0000, 0x1c94, 0x18c0, 0x0000, 0x4a8c, 0x0000, 0x0000, 0x0ca6,
+	    0x0000, 0x212c, 0x0000, 0x3885, 0x0000, 0x037f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x236f, 0x3dd5, 0x1aa5, 0x1fa3, 0x0f02,
+	    0x0000, 0x0000, 0x384a, 0x0000, 0x0000, 0x0000, 0x0000, 0x2957,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4d6f, 0x0000, 0x0000, 0x040c, 0x3271, 0x1cd9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3d27, 0x0888, 0x239c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0ac2, 0x0000, 0x0000, 0x0000, 0x0e88, 0x26c1, 0x0000,
+	    0x0000, 0x0000, 0x012b, 0x0000, 0x0000, 0x1f94, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x33b0, 0x4861, 0x24a2, 0x0000, 0x2375, 0x0000,
+	    0x0000, 0x440a, 0x0000, 0x3dd6, 0x0000, 0x2e08, 0x0000, 0x0000,
+	    0x348f, 0x0000, 0x0000, 0x0000, 0x0000, 0x21d2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ad1, 0x0000, 0x4bf9,
+	    0x46ad, 0x319a, 0x4ae2, 0x138a, 0x0000, 0x3f71, 0x13bd, 0x0000,
+	    0x0000, 0x4452, 0x2d9f, 0x097b, 0x2b47, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x29b5, 0x4d68, 0x0000, 0x1c95, 0x0000, 0x0557, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3dca, 0x4ae0, 0x0000,
+	    0x1582, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2783, 0x291e, 0x09ae, 0x0000, 0x1a8a, 0x0000, 0x3ec3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x20b5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x39b1, 0x0000, 0x0000, 0x0000, 0x0303, 0x0000,
+	    0x0000, 0x33c0, 0x2ef8, 0x0000, 0x0000, 0x0000, 0x19ce, 0x0000,
+	    0x4b40, 0x46e5, 0x1730, 0x0000, 0x0000, 0x0000, 0x1595, 0x0000,
+	    0x0b4e, 0x0000, 0x0000, 0x0532, 0x0000, 0x2264, 0x4972, 0x0000,
+	    0x0000, 0x4c16, 0x0000, 0x0040, 0x0000, 0x2a63, 0x0000, 0x0000,
+	    0x2454, 0x0000, 0x34a4, 0x0000, 0x1bed, 0x0000, 0x05f7, 0x0000,
+	    0x0000, 0x0000, 0x0b5c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1d61, 0x077c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4168, 0x0000, 0x4139, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2c5b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0cde, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1530, 0x0000, 0x0f4b, 0x0000,
+	    0x0000, 0x0000, 0x0028, 0x0000, 0x20dd, 0x0000, 0x0000, 0x0000,
+	    0x0ab2, 0x0000, 0x3fed, 0x0000, 0x0000, 0x0000, 0x374f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0b95, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4b12, 0x13c7, 0x1699, 0x0c27, 0x2406,
+	    0x1e8a, 0x0000, 0x3376, 0x0000, 0x0000, 0x157d, 0x0000, 0x0000,
+	    0x0000, 0x3821, 0x0000, 0x0000, 0x16f5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x38d6, 0x0000, 0x41b1, 0x2ef7,
+	    0x0000, 0x2ca2, 0x0000, 0x4b67, 0x0000, 0x12dd, 0x0000, 0x47bf,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2957, 0x0000, 0x0000, 0x382d,
+	    0x0000, 0x0000, 0x0000, 0x428e, 0x2636, 0x15eb, 0x0000, 0x3029,
+	    0x17c7, 0x3afe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2210,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1606, 0x0000,
+	    0x0000, 0x29e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0749, 0x0000,
+	    0x0000, 0x0000, 0x329d, 0x30eb, 0x0000, 0x0000, 0x0000, 0x34ec,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f8, 0x0000,
+	    0x0000, 0x0000, 0x0409, 0x0000, 0x079d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x41bb, 0x37a1, 0x0000, 0x3215, 0x0000,
+	    0x2be6, 0x0000, 0x0000, 0x482c, 0x4266, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x29e3, 0x0000, 0x1807, 0x0000, 0x3b48, 0x0000, 0x3f07,
+	    0x2d96, 0x46d1, 0x350e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0feb,
+	    0x0000, 0x0000, 0x146d, 0x10ec, 0x0000, 0x1b25, 0x0000, 0x3492,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x183d, 0x0000, 0x0000,
+	    0x0000, 0x16a0, 0x0c05, 0x0000, 0x0c6a, 0x0000, 0x0000, 0x0000,
+	    0x49d4, 0x2099, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b1f, 0x0408,
+	    0x386e, 0x4165, 0x3b6b, 0x28ba, 0x0000, 0x1b43, 0x1173, 0x0d11,
+	    0x0dd7, 0x3e4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x403d, 0x2289,
+	    0x0000, 0x1394, 0x0000, 0x0000, 0x4087, 0x0000, 0x0000, 0x4734,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22a1,
+	    0x0000, 0x0000, 0x2dd0, 0x0000, 0x02ad, 0x0000, 0x0000, 0x0000,
+	    0x383b, 0x37c9, 0x0000, 0x0000, 0x368a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x42d5, 0x0000, 0x04af, 0x0000,
+	    0x0000, 0x092e, 0x4a14, 0x0000, 0x2b2c, 0x0000, 0x0000, 0x49c8,
+	    0x420a, 0x3739, 0x1da3, 0x13df, 0x3685, 0x410d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4d0b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x37fb, 0x0000, 0x0cd9, 0x3d01, 0x0000, 0x1314,
+	    0x0000, 0x1fce, 0x0000, 0x0000, 0x0000, 0x0000, 0x281e, 0x1c50,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20d8, 0x0000, 0x469b,
+	    0x1084, 0x0000, 0x32ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4d1a, 0x0000, 0x3c4d, 0x1814, 0x1230,
+	    0x1698, 0x42ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x465f,
+	    0x32cf, 0x0000, 0x388e, 0x1d7f, 0x0000, 0x0000, 0x040d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x29d7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0cd8, 0x0000, 0x0809, 0x419c, 0x0fb4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3aa3, 0x256f, 0x0000, 0x4c7f, 0x2846, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0cf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x16e6, 0x0000, 0x0000, 0x010e, 0x0000,
+	    0x0000, 0x4b21, 0x0000, 0x13c2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ee4, 0x0000, 0x0000, 0x0000, 0x1397, 0x0000,
+	    0x0ad4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0a19, 0x04f2, 0x0000, 0x0000, 0x1996, 0x0000,
+	    0x0000, 0x0000, 0x0119, 0x43a1, 0x0000, 0x19e1, 0x0000, 0x0000,
+	    0x0c36, 0x08c2, 0x0baa, 0x0000, 0x0000, 0x0000, 0x0000, 0x2824,
+	    0x3c5a, 0x0000, 0x0000, 0x0000, 0x28fc, 0x0000, 0x4cfe, 0x3614,
+	    0x0000, 0x4048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1864,
+	    0x0000, 0x0000, 0x185d, 0x0000, 0x366f, 0x0000, 0x0000, 0x30bd,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d60, 0x0000,
+	    0x3920, 0x0000, 0x0000, 0x0000, 0x14dd, 0x0000, 0x01a3, 0x037e,
+	    0x0000, 0x0af4, 0x0000, 0x3637, 0x0000, 0x262f, 0x01eb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e6a, 0x0000,
+	    0x009c, 0x0000, 0x0000, 0x23a6, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4d52, 0x0000, 0x1862, 0x0000, 0x0000,
+	    0x2fef, 0x0000, 0x18a4, 0x0000, 0x0000, 0x0000, 0x139f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4cde, 0x0000, 0x23bc, 0x2d8c,
+	    0x0000, 0x0000, 0x4699, 0x1cff, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x016c, 0x34b6, 0x0000, 0x0000, 0x3dec, 0x17e7, 0x0000, 0x0000,
+	    0x0000, 0x4111, 0x0000, 0x0000, 0x0000, 0x3d9e, 0x2e25, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x166c, 0x0000, 0x0000, 0x0000, 0x4489,
+	    0x2532, 0x0000, 0x0000, 0x0466, 0x0000, 0x2983, 0x0000, 0x2452,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0fde, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2a7c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4bac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3636,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4d56, 0x0000, 0x0000, 0x1fd9,
+	    0x0000, 0x4d0d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41c4, 0x0000,
+	    0x0000, 0x0000, 0x41df, 0x0000, 0x0000, 0x0000, 0x075d, 0x0000,
+	    0x0175, 0x247e, 0x0000, 0x36e8, 0x343c, 0x0be8, 0x0000, 0x3eab,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2de6, 0x4d75, 0x336a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3df9, 0x0000, 0x0000, 0x0566, 0x05b7, 0x2e0a, 0x0000,
+	    0x0000, 0x05a9, 0x0000, 0x10db, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x27d6, 0x164a, 0x0000, 0x47de, 0x0000,
+	    0x0000, 0x0415, 0x3368, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x44c2, 0x0000, 0x3946,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3abc, 0x0000, 0x26e3, 0x0000,
+	    0x3616, 0x0668, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b83, 0x0000,
+	    0x1927, 0x0000, 0x0000, 0x2e64, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3795, 0x3b62, 0x1820, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x26bf, 0x0740,
+	    0x0000, 0x26f5, 0x0000, 0x0000, 0x0fd3, 0x0000, 0x38e2, 0x0640,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x22de, 0x34b3, 0x2c9d, 0x4c9b,
+	    0x0000, 0x0000, 0x48cd, 0x42e8, 0x0000, 0x0000, 0x2119, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0108, 0x0000, 0x2036, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2584, 0x3adf, 0x4021, 0x0000, 0x4486,
+	    0x0000, 0x0000, 0x07ed, 0x0000, 0x0000, 0x0000, 0x4333, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x4c8b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x17b8, 0x0000, 0x049c, 0x05f4, 0x2c1a, 0x0000,
+	    0x4bd1, 0x3c64, 0x2379, 0x0000, 0x0000, 0x379d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1f38, 0x0000, 0x0000, 0x0000, 0x353f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1b4a, 0x279c, 0x0000, 0x0000,
+	    0x4092, 0x0000, 0x4c06, 0x0000, 0x096e, 0x0000, 0x035a, 0x4c5e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2396, 0x0000, 0x0000, 0x0000,
+	    0x4140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x152b, 0x0000, 0x0000, 0x3f9f, 0x39fd, 0x2fc9, 0x0000,
+	    0x0000, 0x2a8b, 0x0000, 0x0000, 0x0c14, 0x152b, 0x0000, 0x16ac,
+	    0x0000, 0x315b, 0x0000, 0x3174, 0x24fe, 0x0000, 0x0000, 0x0b9d,
+	    0x0000, 0x0000, 0x38ff, 0x0000, 0x004a, 0x33d4, 0x0000, 0x0000,
+	    0x0000, 0x4619, 0x0000, 0x3f3b, 0x0000, 0x3832, 0x3856, 0x0000,
+	    0x0000, 0x430f, 0x4500, 0x0000, 0x36bf, 0x0000, 0x0000, 0x10ed,
+	    0x0000, 0x2a1c, 0x108c, 0x0000, 0x1a37, 0x069f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1651, 0x0000, 0x0000, 0x0000, 0x0000, 0x4576,
+	    0x1d77, 0x2d17, 0x0200, 0x2fdb, 0x0000, 0x0000, 0x0000, 0x0ccb,
+	    0x0000, 0x114b, 0x01e2, 0x0000, 0x0000, 0x4807, 0x3dcb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1241, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4c1e, 0x0000, 0x1f99, 0x2b2d,
+	    0x106a, 0x0000, 0x321d, 0x0000, 0x0779, 0x14ac, 0x0000, 0x0000,
+	    0x3cfd, 0x0000, 0x470a, 0x0000, 0x21a2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0032, 0x0000, 0x39f0, 0x3445, 0x2d79, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x180c,
+	    0x0000, 0x0000, 0x2405, 0x0000, 0x3929, 0x0000, 0x0000, 0x3bcf,
+	    0x0000, 0x39c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x14a6, 0x358a,
+	    0x397d, 0x270f, 0x0000, 0x0000, 0x2195, 0x2af0, 0x0000, 0x0000,
+	    0x0000, 0x14e7, 0x0000, 0x38b4, 0x36da, 0x061b, 0x0000, 0x20e1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x27dd, 0x1f7a, 0x28dd, 0x0000,
+	    0x0000, 0x0000, 0x48e3, 0x0766, 0x148d, 0x22d1, 0x407b, 0x2961,
+	    0x4cee, 0x3fd0, 0x0000, 0x0000, 0x492a, 0x12ba, 0x0000, 0x0000,
+	    0x0299, 0x4b11, 0x0000, 0x0000, 0x0000, 0x0000, 0x3897, 0x0000,
+	    0x02fa, 0x0000, 0x25e5, 0x0000, 0x0000, 0x00b8, 0x3dcf, 0x0000,
+	    0x2b49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c43, 0x0000, 0x0000,
+	    0x0000, 0x2082, 0x1c1a, 0x1e13, 0x0000, 0x1988, 0x0000, 0x42b0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2c65, 0x0000, 0x42bb, 0x1332,
+	    0x0000, 0x0000, 0x4428, 0x0000, 0x0000, 0x0000, 0x0136, 0x0000,
+	    0x1278, 0x0000, 0x3616, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2313, 0x0c7f, 0x0000, 0x0000, 0x0a0c, 0x0000,
+	    0x0000, 0x0000, 0x2088, 0x0000, 0x0000, 0x3356, 0x3cc6, 0x0000,
+	    0x158d, 0x0000, 0x379a, 0x0000, 0x3126, 0x0000, 0x0000, 0x4368,
+	    0x2609, 0x0000, 0x4873, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1045, 0x0000, 0x0000, 0x06c3, 0x45c8, 0x0000, 0x163d,
+	    0x0000, 0x272a, 0x0000, 0x0000, 0x3f88, 0x449a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0d30, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x499a, 0x3e39, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x362d, 0x383c, 0x0000, 0x0000, 0x4c7b,
+	    0x0000, 0x4200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3787, 0x0000, 0x0000, 0x0000, 0x2e63, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0e2c, 0x4493, 0x394d, 0x0000, 0x0000, 0x0000,
+	    0x4657, 0x0000, 0x0000, 0x0000, 0x4ae1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2607, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x171c, 0x30e5, 0x3fa5, 0x021f, 0x0a27,
+	    0x0685, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a16, 0x0000,
+	    0x31c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40d1,
+	    0x0000, 0x072d, 0x208f, 0x0000, 0x4b41, 0x117c, 0x0000, 0x0000,
+	    0x1e68, 0x0000, 0x1f5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1859, 0x0000, 0x18f1, 0x1206,
+	    0x3d64, 0x0000, 0x0000, 0x0000, 0x0000, 0x18ba, 0x0000, 0x0000,
+	    0x0000, 0x0c82, 0x0c11, 0x0000, 0x3089, 0x0000, 0x2f19, 0x0000,
+	    0x048b, 0x0000, 0x0000, 0x0000, 0x35dc, 0x0000, 0x3a01, 0x42c2,
+	    0x43ac, 0x0000, 0x4773, 0x0000, 0x0147, 0x0ded, 0x0e92, 0x0000,
+	    0x0000, 0x2a1b, 0x349e, 0x0000, 0x3770, 0x0000, 0x0000, 0x0a1f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3524, 0x0000, 0x0000, 0x19b4, 0x0000, 0x13c6,
+	    0x15b7, 0x425b, 0x0000, 0x0000, 0x3825, 0x3e2f, 0x0000, 0x0f26,
+	    0x06db, 0x0000, 0x17f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45d8, 0x0000,
+	    0x0000, 0x0000, 0x44e3, 0x39ba, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x32d3, 0x3837, 0x0000, 0x2572, 0x0000, 0x2ad0, 0x04f1,
+	    0x0000, 0x3419, 0x0000, 0x09ce, 0x0000, 0x2037, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x15b2,
+	    0x0000, 0x0000, 0x1295, 0x0000, 0x0000, 0x3c17, 0x0000, 0x0000,
+	    0x0000, 0x1180, 0x0000, 0x0000, 0x0000, 0x1a92, 0x3e52, 0x0000,
+	    0x3343, 0x0000, 0x0000, 0x2975, 0x0000, 0x0fa2, 0x0000, 0x09fa,
+	    0x49b0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x45b4, 0x1f7b,
+	    0x0000, 0x0000, 0x3d2e, 0x0000, 0x0000, 0x0000, 0x0000, 0x49d4,
+	    0x3b6c, 0x0000, 0x0000, 0x0000, 0x1ff7, 0x2708, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x271e, 0x0000, 0x2ddc, 0x41b6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1101, 0x4b3a, 0x0000, 0x4dc9, 0x092a, 0x4733,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0ba7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x20b6, 0x3116, 0x05c2, 0x0000, 0x0a8e, 0x43da, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4302, 0x11ed, 0x3df0, 0x0000, 0x2f03,
+	    0x4d21, 0x0000, 0x0bb6, 0x21c4, 0x4b35, 0x0000, 0x3fa3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x460c, 0x0000, 0x0000, 0x0000, 0x36df,
+	    0x1124, 0x0000, 0x0000, 0x0000, 0x0000, 0x22ee, 0x46f3, 0x0714,
+	    0x0000, 0x1b55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0184,
+	    0x46b3, 0x0000, 0x0d8c, 0x0000, 0x0000, 0x143f, 0x0000, 0x4327,
+	    0x35b5, 0x0fb2, 0x0000, 0x0000, 0x0000, 0x0000, 0x395b, 0x0000,
+	    0x149b, 0x4c70, 0x0000, 0x0000, 0x2cb1, 0x0000, 0x0000, 0x0000,
+	    0x4d6a, 0x0000, 0x0000, 0x0000, 0x0000, 0x228a, 0x0000, 0x0000,
+	    0x0bea, 0x0bbf, 0x44c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x27f2, 0x1e12, 0x3fcd, 0x41fc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x306e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3421, 0x0000, 0x31c0, 0x3d40, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x086e, 0x0403, 0x1f1f, 0x0000,
+	    0x16e2, 0x0000, 0x0000, 0x1fd7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3c56, 0x4864, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x345b, 0x048e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0944, 0x01af,
+	    0x2cb0, 0x1016, 0x0000, 0x0b1b, 0x2a66, 0x0000, 0x0000, 0x259e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4ded, 0x2f87, 0x0000, 0x1119, 0x4938, 0x2b2d, 0x0000, 0x088a,
+	    0x3bb2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4856, 0x0000,
+	    0x0000, 0x397b, 0x25a2, 0x0000, 0x0000, 0x31b8, 0x0000, 0x0000,
+	    0x169e, 0x0000, 0x15cf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x345c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2fea, 0x0000, 0x2908, 0x0000, 0x0000, 0x2102, 0x0000, 0x0000,
+	    0x0852, 0x11cd, 0x417a, 0x0000, 0x0000, 0x0000, 0x47c3, 0x0000,
+	    0x02a8, 0x1d9f, 0x1492, 0x0000, 0x0000, 0x3dfd, 0x1cdc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1c6a, 0x1bc9, 0x0000, 0x288e,
+	    0x1768, 0x3cc7, 0x0000, 0x31ef, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0170, 0x0000, 0x3978, 0x0000, 0x0dc9, 0x0000, 0x0000,
+	    0x0000, 0x27d3, 0x0000, 0x0000, 0x0000, 0x24dc, 0x0000, 0x0000,
+	    0x0258, 0x0000, 0x0000, 0x0000, 0x0000, 0x074d, 0x0000, 0x0000,
+	    0x0000, 0x0c0e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22d7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x215b, 0x0a56, 0x0000, 0x0000,
+	    0x48a5, 0x21f8, 0x172f, 0x0000, 0x4689, 0x0000, 0x4268, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1531, 0x03fd, 0x0000, 0x0000, 0x0000,
+	    0x2d5d, 0x0000, 0x1907, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0bbb, 0x10c0, 0x0000, 0x412a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x251e, 0x0000, 0x0000, 0x39fb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1dd8, 0x0000,
+	    0x3ed5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0f7f, 0x0000, 0x0000, 0x1cbd, 0x0000, 0x2dcb,
+	    0x1f54, 0x4107, 0x0000, 0x0000, 0x41a0, 0x3673, 0x0000, 0x0000,
+	    0x4198, 0x0000, 0x0000, 0x2fc2, 0x1c6b, 0x0000, 0x3eb5, 0x0697,
+	    0x0000, 0x0000, 0x0000, 0x45d2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1121, 0x0000, 0x0000, 0x0000, 0x317e,
+	    0x39bc, 0x3d8a, 0x0000, 0x0000, 0x0000, 0x1580, 0x0000, 0x0000,
+	    0x0000, 0x02e0, 0x0000, 0x0618, 0x0000, 0x0000, 0x0000, 0x2804,
+	    0x2bd1, 0x0000, 0x4d12, 0x0000, 0x0000, 0x1ab4, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2704, 0x0000, 0x02a2, 0x0000, 0x3ae0,
+	    0x4a6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x018d, 0x0000,
+	    0x050b, 0x348a, 0x0000, 0x2c0f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0763, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2593, 0x0000,
+	    0x3a66, 0x0b46, 0x0000, 0x0000, 0x382d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x413a, 0x0f7b, 0x08b6, 0x0000, 0x40e5,
+	    0x0000, 0x03da, 0x1831, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2fee, 0x18c6,
+	    0x0000, 0x3a1c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x23a0, 0x20fa, 0x0000, 0x3a6b, 0x0000, 0x1d0a, 0x0000,
+	    0x0000, 0x0000, 0x491a, 0x0000, 0x0000, 0x1e2f, 0x0000, 0x342b,
+	    0x0000, 0x0000, 0x29ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a18,
+	    0x0000, 0x0000, 0x0000, 0x4852, 0x0000, 0x3243, 0x0000, 0x0000,
+	    0x02ba, 0x1060, 0x0000, 0x3e58, 0x0000, 0x0000, 0x0ec1, 0x0000,
+	    0x3e1f, 0x0000, 0x276a, 0x0320, 0x06c0, 0x380c, 0x0000, 0x0000,
+	    0x0000, 0x2ac8, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ef8, 0x1ce0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1089, 0x0000, 0x0000,
+	    0x0b1a, 0x41ce, 0x0761, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x36ce, 0x4242, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1dad, 0x0000, 0x0000, 0x0000, 0x15dc, 0x093f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0e1a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x434d, 0x2c14, 0x0000, 0x4333, 0x0000, 0x0000,
+	    0x0000, 0x23e5, 0x0000, 0x0000, 0x3c71, 0x0000, 0x3669, 0x13fe,
+	    0x0000, 0x3e2c, 0x2fc9, 0x07ba, 0x0000, 0x0abc, 0x1b99, 0x0000,
+	    0x0000, 0x4acc, 0x2113, 0x0294, 0x48c8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4772, 0x40f7, 0x18a2, 0x059f, 0x2c6d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2de8, 0x07ef, 0x004c,
+	    0x45a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x208b, 0x0000, 0x0000, 0x0000, 0x1105, 0x0000,
+	    0x0b09, 0x0000, 0x2d4c, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d62,
+	    0x0f82, 0x0000, 0x0000, 0x0000, 0x0000, 0x44a3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4b97, 0x0000, 0x0000, 0x0000, 0x48c7, 0x0000,
+	    0x0000, 0x2e78, 0x204b, 0x0c72, 0x2d56, 0x34f7, 0x0000, 0x4ab6,
+	    0x416c, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e28, 0x0778, 0x141b,
+	    0x1e86, 0x0000, 0x1c43, 0x0000, 0x46ac, 0x0000, 0x0000, 0x0000,
+	    0x0f3b, 0x12b3, 0x2c40, 0x0000, 0x0000, 0x3f14, 0x0000, 0x0000,
+	    0x0000, 0x46a9, 0x0000, 0x0000, 0x4a85, 0x0000, 0x1cc7, 0x0962,
+	    0x0000, 0x36cd, 0x0e4e, 0x0000, 0x0000, 0x3654, 0x09be, 0x0000,
+	    0x4627, 0x0000, 0x0000, 0x3b09, 0x3909, 0x0000, 0x0000, 0x0000,
+	    0x405c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x374e,
+	    0x11bc, 0x30d2, 0x0000, 0x20be, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3ec1, 0x0000, 0x4047, 0x460f, 0x4808, 0x1d1f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x11a2, 0x0000, 0x0000, 0x040b, 0x0000,
+	    0x0000, 0x0000, 0x3b62, 0x0000, 0x1ac0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0314, 0x2bd7, 0x052f,
+	    0x0000, 0x0000, 0x1abd, 0x0000, 0x0539, 0x02bb, 0x2e54, 0x08ea,
+	    0x0000, 0x0000, 0x36d8, 0x0000, 0x0000, 0x3aaa, 0x4413, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e31, 0x3a54,
+	    0x0000, 0x3bd8, 0x427c, 0x10dc, 0x0000, 0x25f8, 0x0000, 0x0000,
+	    0x0000, 0x25a9, 0x141b, 0x0000, 0x0000, 0x0000, 0x0000, 0x1651,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0442, 0x0000, 0x403c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4c51, 0x0000, 0x136b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0874,
+	    0x0000, 0x2b01, 0x0000, 0x0000, 0x0000, 0x1202, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x130d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x056f, 0x0000, 0x4a57, 0x4421, 0x0000,
+	    0x0f27, 0x3729, 0x0000, 0x0000, 0x27df, 0x0000, 0x0000, 0x319f,
+	    0x3a11, 0x0000, 0x1a79, 0x3e84, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3931, 0x1316, 0x3627, 0x0000, 0x07fa, 0x0000, 0x3162,
+	    0x3562, 0x0000, 0x0000, 0x3af3, 0x44a0, 0x2a74, 0x1e4e, 0x4854,
+	    0x0000, 0x0000, 0x3a30, 0x3b27, 0x0000, 0x0845, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b68,
+	    0x1cd0, 0x0000, 0x43ec, 0x0000, 0x1fc4, 0x37eb, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2ac7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x44f0, 0x0000, 0x0000, 0x1ae4, 0x0000, 0x0b41, 0x1e34,
+	    0x0000, 0x3d33, 0x0000, 0x0d5c, 0x2ead, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2664, 0x0000, 0x3ae6, 0x0000, 0x2eb1,
+	    0x0000, 0x0000, 0x0000, 0x01c3, 0x385f, 0x0000, 0x2a1d, 0x0000,
+	    0x2415, 0x0000, 0x0000, 0x2ede, 0x0364, 0x0000, 0x00a9, 0x0000,
+	    0x0000, 0x1a61, 0x0000, 0x31b6, 0x0000, 0x0000, 0x3c30, 0x0fa4,
+	    0x2d2f, 0x0000, 0x0000, 0x1c5b, 0x0000, 0x0000, 0x1657, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x023a, 0x0000, 0x0d27, 0x0000,
+	    0x01d0, 0x0000, 0x2dde, 0x0000, 0x3093, 0x42d2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f62, 0x0000, 0x0000,
+	    0x060d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x481b, 0x0000, 0x0645, 0x0000,
+	    0x1fd8, 0x0000, 0x0000, 0x3944, 0x0f72, 0x39e0, 0x0000, 0x0000,
+	    0x0000, 0x3d2a, 0x0000, 0x0000, 0x0471, 0x3d43, 0x408a, 0x0000,
+	    0x0000, 0x0000, 0x4a23, 0x0000, 0x483f, 0x0000, 0x119c, 0x0000,
+	    0x177e, 0x2edd, 0x4576, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x21d2, 0x0000, 0x0000, 0x2303, 0x0913, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x48db, 0x0000, 0x0000, 0x0000,
+	    0x271d, 0x0000, 0x0000, 0x4bd5, 0x1953, 0x3963, 0x0000, 0x0000,
+	    0x0000, 0x258e, 0x21a4, 0x0000, 0x0000, 0x0000, 0x427b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0f4d, 0x0000, 0x149f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x49f8, 0x3bd9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ab9, 0x358b, 0x0000,
+	    0x2a6b, 0x2167, 0x0000, 0x0000, 0x34f9, 0x0000, 0x0000, 0x3f2a,
+	    0x0000, 0x2fe6, 0x212b, 0x0000, 0x4458, 0x0000, 0x0000, 0x3d34,
+	    0x0000, 0x0000, 0x391f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1528, 0x2b86, 0x0000, 0x0000, 0x0000, 0x0000, 0x27f4, 0x18fe,
+	    0x0a21, 0x0000, 0x0000, 0x0000, 0x4a1a, 0x2a9f, 0x0000, 0x0000,
+	    0x0000, 0x2c44, 0x0000, 0x17c6, 0x427b, 0x0000, 0x117e, 0x0000,
+	    0x4065, 0x0000, 0x0000, 0x0d7d, 0x0000, 0x405c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3384,
+	    0x4b75, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fb6, 0x3c02, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4704, 0x0000, 0x1e3d, 0x0000, 0x0000,
+	    0x1a42, 0x0a7e, 0x1c45, 0x0000, 0x0000, 0x2743, 0x3662, 0x1e38,
+	    0x0000, 0x0000, 0x2c4e, 0x338c, 0x0000, 0x1e7d, 0x0000, 0x385c,
+	    0x0000, 0x0000, 0x2b93, 0x1eee, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1e90, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0b8b, 0x0000, 0x0000, 0x1946,
+	    0x0835, 0x0000, 0x29df, 0x0000, 0x16c6, 0x0000, 0x1af4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x19d3, 0x4445, 0x0000, 0x1d82,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d82,
+	    0x0000, 0x0000, 0x1f89, 0x0000, 0x0000, 0x129a, 0x0000, 0x0000,
+	    0x0ea2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bc4, 0x4918, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b34, 0x0f34, 0x2455,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x176e, 0x0000, 0x0049, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3ae7, 0x0000, 0x0000, 0x128d,
+	    0x0000, 0x0b0c, 0x0000, 0x16f9, 0x0000, 0x047d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3d43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0ed7, 0x2c08, 0x083a, 0x47b3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0e34, 0x0000, 0x2abf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1abd, 0x0000, 0x2e75,
+	    0x4d35, 0x0000, 0x2726, 0x0000, 0x0000, 0x0000, 0x3aad, 0x0000,
+	    0x0000, 0x0000, 0x0ed8, 0x0000, 0x0000, 0x2a68, 0x0000, 0x112a,
+	    0x0038, 0x02b2, 0x15f5, 0x03a9, 0x0000, 0x0000, 0x0000, 0x4042,
+	    0x1a72, 0x0000, 0x0000, 0x3ad5, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3a22, 0x0000, 0x0000, 0x4589, 0x0000, 0x3c9e, 0x43c2, 0x1bc5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00f1, 0x0000,
+	    0x31f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2c72, 0x0c49, 0x3b00, 0x0000, 0x0000, 0x3449, 0x0000, 0x259c,
+	    0x2954, 0x0000, 0x0000, 0x0000, 0x0006, 0x0000, 0x0000, 0x0000,
+	    0x47a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x20ce, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x183b, 0x11b8, 0x0000, 0x1fee, 0x202e,
+	    0x2a44, 0x3080, 0x0000, 0x1d88, 0x0000, 0x07d8, 0x0000, 0x0000,
+	    0x2255, 0x2bb2, 0x461f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0d9b, 0x1c71, 0x0000, 0x0000, 0x0000, 0x0724, 0x0000, 0x28f5,
+	    0x0000, 0x4bae, 0x0000, 0x0000, 0x2f55, 0x0000, 0x4d5e, 0x0000,
+	    0x0000, 0x1c70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a13,
+	    0x2858, 0x02a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x459a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x187b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0221,
+	    0x0000, 0x0649, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x199a, 0x3ea2, 0x0000, 0x3323, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2d6d, 0x0000, 0x0000, 0x272d, 0x0000,
+	    0x0000, 0x0000, 0x2808, 0x2f1f, 0x0000, 0x0808, 0x0000, 0x0000,
+	    0x3678, 0x0000, 0x0000, 0x488b, 0x0000, 0x0000, 0x0000, 0x43d1,
+	    0x0000, 0x0000, 0x0cca, 0x2dfb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x26e5, 0x0000, 0x0000, 0x0000, 0x3179, 0x0000, 0x0000, 0x3baf,
+	    0x2153, 0x4236, 0x0000, 0x2e41, 0x0000, 0x0000, 0x31b7, 0x3e29,
+	    0x0000, 0x28ad, 0x2b72, 0x026b, 0x0000, 0x0000, 0x0a94, 0x490b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x494d, 0x0000, 0x0000, 0x0000,
+	    0x3113, 0x0000, 0x3b03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1926, 0x02a1, 0x4d25, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x20bd, 0x01e2, 0x3fe2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0afa,
+	    0x0000, 0x1ddc, 0x0000, 0x3c1b, 0x436c, 0x0000, 0x0000, 0x0000,
+	    0x34cb, 0x0000, 0x1f01, 0x0000, 0x0000, 0x4592, 0x0000, 0x0000,
+	    0x0000, 0x1859, 0x0ca1, 0x0000, 0x0000, 0x0000, 0x16ab, 0x1b2f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x02f2, 0x0000, 0x0000, 0x3a2f,
+	    0x0000, 0x0000, 0x2515, 0x43e2, 0x0000, 0x007e, 0x0000, 0x2d89,
+	    0x28d9, 0x473d, 0x431a, 0x0000, 0x0000, 0x0000, 0x0000, 0x14d5,
+	    0x0000, 0x0000, 0x406a, 0x0000, 0x19f3, 0x3fb6, 0x4d42, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x44d9, 0x0000, 0x0000, 0x43f8, 0x251a,
+	    0x0000, 0x2b84, 0x0000, 0x2947, 0x3d5b, 0x208b, 0x0000, 0x0f3a,
+	    0x0000, 0x0000, 0x176f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3bc0, 0x0000, 0x3c36, 0x011a, 0x0000, 0x0000, 0x3d21, 0x0fb1,
+	    0x0000, 0x1007, 0x2ea4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x08f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x1975, 0x0000,
+	    0x081a, 0x0000, 0x0000, 0x0bd1, 0x0000, 0x0124, 0x0000, 0x0000,
+	    0x2488, 0x0b13, 0x0000, 0x0000, 0x0000, 0x0598, 0x0000, 0x062d,
+	    0x0000, 0x242d, 0x0407, 0x0000, 0x0000, 0x0000, 0x2f0e, 0x0000,
+	    0x3f83, 0x3052, 0x0000, 0x0000, 0x291c, 0x4cbc, 0x4d5c, 0x0000,
+	    0x3595, 0x0000, 0x0000, 0x0000, 0x343e, 0x1f18, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x433b, 0x1d8d, 0x0000, 0x217b, 0x0fb0, 0x0000, 0x10f6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1c6d, 0x0000, 0x0000, 0x0dcc,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0329, 0x240d, 0x4842,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ba3, 0x3527, 0x0000,
+	    0x35c8, 0x0000, 0x0000, 0x12f0, 0x0000, 0x03f1, 0x0000, 0x00d4,
+	    0x1e43, 0x0000, 0x485f, 0x0000, 0x0000, 0x0000, 0x38fc, 0x0000,
+	    0x0000, 0x0014, 0x0000, 0x0000, 0x03da, 0x2cc0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1d2a, 0x0000, 0x38b3, 0x1918,
+	    0x0000, 0x0000, 0x0000, 0x13f6, 0x0000, 0x0000, 0x02df, 0x0000,
+	    0x40d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30e5, 0x2232,
+	    0x0000, 0x0000, 0x437d, 0x24bd, 0x0000, 0x2253, 0x0000, 0x0000,
+	    0x17bf, 0x0000, 0x0000, 0x3180, 0x09f5, 0x0000, 0x485e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06b3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2baf,
+	    0x0000, 0x0f0e, 0x0000, 0x1f77, 0x0472, 0x0000, 0x0000, 0x0000,
+	    0x4350, 0x38a0, 0x0ddf, 0x0000, 0x20b3, 0x0000, 0x0000, 0x0c51,
+	    0x0000, 0x2987, 0x3bba, 0x2143, 0x2a07, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3592, 0x4a44, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e5f, 0x0000, 0x3868, 0x3990, 0x11a1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2a39, 0x0000, 0x09bc, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3d91, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3634, 0x26d3, 0x083b, 0x0000, 0x0000, 0x0000,
+	    0x2dfb, 0x0000, 0x041f, 0x0000, 0x0bff, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x217f, 0x2570,
+	    0x0000, 0x1f3e, 0x4006, 0x0000, 0x012c, 0x0000, 0x4b70, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00e2, 0x1efc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x106a, 0x0000, 0x2475, 0x0000, 0x3743,
+	    0x229c, 0x2933, 0x15a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f7d,
+	    0x3b69, 0x0000, 0x0000, 0x3fd4, 0x3069, 0x2046, 0x4d23, 0x21d1,
+	    0x311d, 0x4596, 0x0000, 0x2ad2, 0x0000, 0x0000, 0x25fc, 0x32dd,
+	    0x0000, 0x0000, 0x1676, 0x0000, 0x0000, 0x0000, 0x0744, 0x1d7e,
+	    0x0000, 0x3927, 0x0000, 0x0000, 0x4677, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1aa2, 0x0ffc, 0x0000, 0x3cad, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x3641, 0x0000, 0x0000, 0x0f44, 0x0000,
+	    0x0000, 0x0000, 0x0d54, 0x0000, 0x0000, 0x0000, 0x3e74, 0x0000,
+	    0x4cef, 0x3242, 0x0000, 0x2449, 0x0000, 0x409d, 0x4c48, 0x3796,
+	    0x0000, 0x0000, 0x0000, 0x004f, 0x0000, 0x30ef, 0x0000, 0x0000,
+	    0x429d, 0x0000, 0x0000, 0x0000, 0x20df, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2c22, 0x01be, 0x3f62, 0x0000, 0x0000, 0x0000,
+	    0x2181, 0x46f9, 0x0f1a, 0x4bc0, 0x1ea3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4d72, 0x3a0f, 0x0000, 0x386f, 0x0000, 0x15fb, 0x3047,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x16e8, 0x4cdd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x499e, 0x0000, 0x04b8, 0x0000,
+	    0x0e0e, 0x2dd3, 0x0000, 0x0000, 0x0000, 0x141f, 0x1131, 0x0000,
+	    0x2f5b, 0x4517, 0x3fd0, 0x0000, 0x0000, 0x0000, 0x45f1, 0x094a,
+	    0x0000, 0x14b8, 0x09ac, 0x0000, 0x0000, 0x0000, 0x3f56, 0x0000,
+	    0x0000, 0x00f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x1db8, 0x3c4f,
+	    0x0000, 0x0000, 0x34dd, 0x0000, 0x3a50, 0x0000, 0x0000, 0x2636,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4339, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0b2d, 0x0000, 0x346e, 0x0000, 0x02fe, 0x0000, 0x0000,
+	    0x0000, 0x042f, 0x0000, 0x0000, 0x37d6, 0x0000, 0x3eca, 0x0000,
+	    0x2d64, 0x39b4, 0x0924, 0x2ffc, 0x490e, 0x1097, 0x0000, 0x0000,
+	    0x0000, 0x38d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c53, 0x0000,
+	    0x04d0, 0x26c8, 0x0000, 0x0000, 0x0000, 0x389f, 0x0000, 0x4bb8,
+	    0x0000, 0x44df, 0x0000, 0x0000, 0x0000, 0x18f8, 0x0000, 0x3fa5,
+	    0x0000, 0x0000, 0x08ba, 0x0000, 0x0000, 0x0000, 0x1eaf, 0x0000,
+	    0x0000, 0x368d, 0x0000, 0x0000, 0x4a6c, 0x415f, 0x0000, 0x3ca2,
+	    0x2588, 0x45ac, 0x3936, 0x0000, 0x0000, 0x0000, 0x151f, 0x0000,
+	    0x1977, 0x0000, 0x0000, 0x05e7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x320a, 0x0000, 0x0000, 0x0000, 0x0000, 0x29e0,
+	    0x170a, 0x0418, 0x0000, 0x1f96, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2e6d, 0x2ccf, 0x24cb, 0x0000, 0x0000, 0x412d, 0x0a68, 0x0000,
+	    0x4359, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a78, 0x0000, 0x0000,
+	    0x0000, 0x2da1, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d1b, 0x0b7c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e56,
+	    0x0000, 0x0000, 0x0000, 0x40b4, 0x2c00, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0029, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0fd3, 0x0000, 0x1ae8,
+	    0x0044, 0x0000, 0x0000, 0x200e, 0x0000, 0x0000, 0x2f7a, 0x0000,
+	    0x0000, 0x0000, 0x01e0, 0x0000, 0x0000, 0x4103, 0x3aae, 0x0000,
+	    0x0000, 0x067b, 0x0000, 0x0dfd, 0x0000, 0x0000, 0x3c26, 0x0000,
+	    0x0035, 0x0000, 0x0000, 0x3bf2, 0x13d0, 0x0000, 0x38ff, 0x0000,
+	    0x4a32, 0x0000, 0x0000, 0x4990, 0x0000, 0x2f5f, 0x1635, 0x0000,
+	    0x0000, 0x0000, 0x24c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x4100,
+	    0x0000, 0x0000, 0x0000, 0x4a6d, 0x2daa, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x301a, 0x354e, 0x3ae9, 0x0000, 0x23f8,
+	    0x2320, 0x0000, 0x024b, 0x0000, 0x0000, 0x0000, 0x1364, 0x0000,
+	    0x4baf, 0x0000, 0x2236, 0x0000, 0x3e79, 0x0825, 0x43b8, 0x11a7,
+	    0x0000, 0x0c3a, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c9b, 0x1653,
+	    0x0000, 0x1c4c, 0x034a, 0x0a8b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4b0e, 0x0000, 0x0000, 0x2dc2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x038b, 0x0000, 0x07d8, 0x0000, 0x2995, 0x0000, 0x433d, 0x0d56,
+	    0x0000, 0x0d73, 0x09cd, 0x1c9c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0381, 0x0000, 0x0000, 0x49b2, 0x4d41,
+	    0x0000, 0x0000, 0x3815, 0x0000, 0x0000, 0x4985, 0x0000, 0x0ba8,
+	    0x3d37, 0x0000, 0x0000, 0x0000, 0x00c2, 0x0000, 0x0000, 0x4251,
+	    0x4239, 0x1513, 0x4810, 0x05aa, 0x0000, 0x0ec1, 0x0000, 0x0000,
+	    0x1abe, 0x0204, 0x0000, 0x3c4d, 0x4221, 0x0000, 0x0000, 0x0000,
+	    0x27ce, 0x0000, 0x1b4f, 0x0000, 0x20fe, 0x0000, 0x0000, 0x3a66,
+	    0x0000, 0x0000, 0x40c6, 0x0000, 0x0000, 0x0000, 0x4136, 0x0000,
+	    0x1caa, 0x0000, 0x0000, 0x0000, 0x1839, 0x1e64, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0622, 0x0de5, 0x0000, 0x0000, 0x0000, 0x1867,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c23, 0x0000, 0x2f85,
+	    0x2aba, 0x3aa1, 0x4a97, 0x3654, 0x0000, 0x0000, 0x1b86, 0x0000,
+	    0x0000, 0x02be, 0x494c, 0x0000, 0x0000, 0x02d9, 0x0000, 0x0000,
+	    0x2c8c, 0x09db, 0x0000, 0x0000, 0x3310, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x20fc, 0x0000, 0x3a49, 0x0000, 0x0000, 0x1445, 0x0000,
+	    0x0000, 0x0000, 0x26f3, 0x0906, 0x313c, 0x31cd, 0x4d51, 0x18bb,
+	    0x1889, 0x0000, 0x1607, 0x4935, 0x3fe7, 0x0000, 0x0000, 0x0000,
+	    0x01a2, 0x0000, 0x365c, 0x0000, 0x0000, 0x0000, 0x3ad8, 0x0000,
+	    0x0000, 0x43e4, 0x3d6e, 0x400c, 0x0000, 0x1b8c, 0x4b9e, 0x0000,
+	    0x425b, 0x2d1f, 0x2f21, 0x3e29, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1819, 0x0000, 0x0000, 0x0000, 0x1933, 0x0000,
+	    0x0000, 0x0b9a, 0x101b, 0x0000, 0x2f6a, 0x0000, 0x0ff1, 0x01f1,
+	    0x1e10, 0x0000, 0x0689, 0x0000, 0x2715, 0x297d, 0x344a, 0x004b,
+	    0x1bc8, 0x0000, 0x3d00, 0x4801, 0x3e41, 0x2592, 0x0000, 0x2221,
+	    0x0000, 0x49af, 0x23b8, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000,
+	    0x13b5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2126, 0x0000,
+	    0x0000, 0x3855, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f72,
+	    0x28ff, 0x0000, 0x3461, 0x2c49, 0x0000, 0x121a, 0x0000, 0x0000,
+	    0x0000, 0x42bd, 0x3b7c, 0x0000, 0x0000, 0x13df, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x16dc, 0x04bf, 0x1d7e, 0x2f00, 0x46f3, 0x0000,
+	    0x0000, 0x0000, 0x2a52, 0x0000, 0x4388, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4dcd, 0x0000, 0x1328, 0x36c2, 0x0000,
+	    0x0000, 0x0000, 0x3744, 0x0e0c, 0x4258, 0x2474, 0x327e, 0x0000,
+	    0x0000, 0x1dae, 0x0000, 0x0000, 0x3654, 0x0000, 0x0000, 0x0000,
+	    0x47f5, 0x0000, 0x0000, 0x0000, 0x434b, 0x0000, 0x2554, 0x2946,
+	    0x0000, 0x262e, 0x0000, 0x0000, 0x0f93, 0x0000, 0x1eb1, 0x0000,
+	    0x1323, 0x0000, 0x0000, 0x0000, 0x4aec, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2569, 0x4789, 0x3128, 0x0000, 0x0000, 0x0000, 0x3f50,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x138d, 0x0000, 0x0000,
+	    0x0000, 0x2c12, 0x119b, 0x0000, 0x2fac, 0x08b1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1976, 0x0000, 0x3670, 0x1cde, 0x0000, 0x0000,
+	    0x4b9d, 0x0000, 0x0000, 0x0eaa, 0x421c, 0x0000, 0x0ce1, 0x0000,
+	    0x0000, 0x0000, 0x192f, 0x0000, 0x3fc7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3e2b, 0x3c79, 0x0000, 0x3db1, 0x48cd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x18ad, 0x0000, 0x0000, 0x33d2, 0x0000,
+	    0x2527, 0x4ccc, 0x002f, 0x0000, 0x0000, 0x0000, 0x2d93, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1661, 0x0000, 0x4573, 0x182a,
+	    0x0000, 0x2704, 0x0000, 0x0000, 0x2774, 0x4844, 0x0000, 0x4b17,
+	    0x0000, 0x0000, 0x4c0a, 0x0000, 0x0f00, 0x0000, 0x012b, 0x0dd4,
+	    0x0000, 0x0000, 0x0000, 0x3b78, 0x1b2d, 0x0000, 0x132f, 0x0af5,
+	    0x085b, 0x0fb4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2854,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e85, 0x06e6,
+	    0x0000, 0x0000, 0x0000, 0x00e4, 0x0000, 0x3c2d, 0x1e98, 0x0000,
+	    0x27f7, 0x0000, 0x31a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x13d9,
+	    0x0000, 0x0000, 0x28b5, 0x0000, 0x0000, 0x2940, 0x0000, 0x0000,
+	    0x02f5, 0x0000, 0x0000, 0x3779, 0x0000, 0x20b3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3cca,
+	    0x0000, 0x4050, 0x0000, 0x0000, 0x1948, 0x0000, 0x0000, 0x0000,
+	    0x489f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4d04, 0x2a3e, 0x0000, 0x39d6, 0x0000, 0x00fe,
+	    0x2f37, 0x0000, 0x2ef6, 0x0000, 0x0000, 0x47f0, 0x35c5, 0x0000,
+	    0x0000, 0x3214, 0x0000, 0x0000, 0x4a19, 0x12ae, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x41f6, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4399, 0x1132, 0x2db3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0743, 0x46ed, 0x0000, 0x0000, 0x2f25,
+	    0x0000, 0x2d76, 0x0000, 0x0000, 0x3576, 0x0000, 0x0000, 0x0000,
+	    0x4c6e, 0x0000, 0x2986, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b68,
+	    0x0000, 0x0000, 0x12e1, 0x0000, 0x3c82, 0x0000, 0x0000, 0x0000,
+	    0x1990, 0x0000, 0x4ab4, 0x3e51, 0x4b04, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3207, 0x35bd, 0x0000, 0x3c83, 0x0000, 0x0000, 0x0000,
+	    0x352a, 0x1fdb, 0x0000, 0x179f, 0x1e4c, 0x0000, 0x0000, 0x4038,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1241, 0x2572, 0x0000, 0x0000,
+	    0x0000, 0x0f44, 0x0000, 0x3589, 0x1e07, 0x0000, 0x0000, 0x3f5f,
+	    0x0000, 0x0000, 0x303c, 0x0000, 0x0000, 0x083f, 0x0000, 0x0000,
+	    0x0788, 0x0000, 0x0000, 0x0000, 0x078c, 0x1a9c, 0x0000, 0x2518,
+	    0x0000, 0x04a0, 0x0000, 0x0bae, 0x1a54, 0x0000, 0x0000, 0x0000,
+	    0x1df0, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f4a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3bda, 0x1614, 0x0000, 0x1b67,
+	    0x0000, 0x2b40, 0x0000, 0x0000, 0x41f9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x023f, 0x2093, 0x0000, 0x0000, 0x15f9, 0x0000, 0x0000,
+	    0x4670, 0x1303, 0x1269, 0x0000, 0x0000, 0x410f, 0x4405, 0x0000,
+	    0x0000, 0x0000, 0x3aa5, 0x0000, 0x0000, 0x0000, 0x196b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39b9, 0x0000,
+	    0x0000, 0x389d, 0x0000, 0x06e0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b3e, 0x24d1, 0x3c80,
+	    0x3c2e, 0x2ce3, 0x0000, 0x35d7, 0x0000, 0x2e94, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0d95, 0x2e11, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1e7a, 0x0000, 0x0000, 0x0000, 0x1d31, 0x0000, 0x0aca,
+	    0x0000, 0x234f, 0x4c99, 0x0000, 0x05a7, 0x48cc, 0x13e1, 0x2e0d,
+	    0x39a3, 0x0000, 0x2677, 0x24b9, 0x0000, 0x1e9f, 0x242d, 0x0000,
+	    0x0000, 0x11d4, 0x0000, 0x3a30, 0x0aad, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x258a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x272f, 0x0000, 0x4e17, 0x0000, 0x0000, 0x164f, 0x0684, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1ea9, 0x19f9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3e67, 0x1e5a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0947, 0x0000, 0x0000, 0x34c2, 0x0000,
+	    0x0000, 0x0000, 0x0770, 0x0000, 0x0000, 0x0000, 0x3a64, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0030, 0x0000, 0x0f15, 0x3805, 0x40dc, 0x0000,
+	    0x3141, 0x0b7e, 0x0000, 0x0000, 0x0000, 0x1b32, 0x0000, 0x1ff0,
+	    0x0000, 0x0000, 0x0000, 0x40e4, 0x0000, 0x1809, 0x0000, 0x1aba,
+	    0x0000, 0x1216, 0x24c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0359, 0x0000, 0x15a0, 0x0068, 0x0000, 0x3ff2, 0x0000,
+	    0x0000, 0x19a9, 0x0000, 0x2bd7, 0x0000, 0x3a80, 0x0000, 0x0000,
+	    0x2d87, 0x4176, 0x0000, 0x0000, 0x039f, 0x1c60, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1b71, 0x0000, 0x0000, 0x0000, 0x0000, 0x08eb,
+	    0x0000, 0x0000, 0x3f82, 0x3c86, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2de9, 0x4752, 0x0000, 0x0000, 0x4576, 0x2dbf, 0x0000,
+	    0x0000, 0x0e54, 0x1dce, 0x0000, 0x0000, 0x0000, 0x0000, 0x36e7,
+	    0x0009, 0x05a3, 0x0000, 0x2f09, 0x0000, 0x1537, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x22ed, 0x01ee, 0x0000, 0x4752, 0x3e8d, 0x18c9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ab6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2807, 0x253c, 0x2cf7,
+	    0x4720, 0x3e87, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c4f,
+	    0x0000, 0x1a71, 0x3f9d, 0x0000, 0x2df0, 0x0000, 0x1ef5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4025, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0a13, 0x0000, 0x0000, 0x2359, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4a5f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0c39, 0x0000, 0x0000, 0x0000, 0x3760, 0x0000, 0x0000, 0x216d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2386, 0x0000, 0x0000, 0x0000, 0x0000, 0x1593, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c89, 0x0b8f, 0x3067,
+	    0x0000, 0x14c1, 0x3a21, 0x0000, 0x0000, 0x065b, 0x0000, 0x1c6e,
+	    0x0000, 0x0000, 0x12f5, 0x0000, 0x3ea7, 0x05a5, 0x1406, 0x0000,
+	    0x1877, 0x087f, 0x0000, 0x3c5b, 0x1a94, 0x0000, 0x0000, 0x2578,
+	    0x26b3, 0x0000, 0x0000, 0x4337, 0x08c9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x182c, 0x0000, 0x479e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4966, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cc5, 0x26c6,
+	    0x0000, 0x3871, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4604, 0x0000, 0x0000, 0x0000, 0x472a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x28a9, 0x0000, 0x0000, 0x0000,
+	    0x2786, 0x0000, 0x0000, 0x0a51, 0x267e, 0x14bd, 0x0c08, 0x00f0,
+	    0x274f, 0x3a90, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3461, 0x44c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0f54, 0x3a3f, 0x4921, 0x0000, 0x0000, 0x0000,
+	    0x1ed0, 0x4bd4, 0x0000, 0x0000, 0x0000, 0x0000, 0x402c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x188e,
+	    0x0000, 0x0000, 0x1f9e, 0x1b9c, 0x0000, 0x0000, 0x3b85, 0x00d2,
+	    0x0b4b, 0x0000, 0x0000, 0x0be8, 0x0319, 0x0000, 0x40b6, 0x03c1,
+	    0x0000, 0x0000, 0x4a16, 0x351b, 0x0000, 0x0fe4, 0x05a3, 0x1103,
+	    0x3f85, 0x4cc9, 0x0000, 0x0000, 0x0000, 0x0000, 0x21a4, 0x1794,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x18e4, 0x0000, 0x39ea, 0x0000,
+	    0x08c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a3, 0x0000, 0x3bf6,
+	    0x2556, 0x0000, 0x0000, 0x0000, 0x0000, 0x0282, 0x1571, 0x0000,
+	    0x0000, 0x0000, 0x134b, 0x472a, 0x0000, 0x3915, 0x0000, 0x0000,
+	    0x0000, 0x25e2, 0x2810, 0x11c0, 0x0000, 0x4496, 0x0000, 0x0000,
+	    0x16c0, 0x26fd, 0x0000, 0x2d73, 0x0000, 0x0000, 0x4c5c, 0x0000,
+	    0x0000, 0x4b08, 0x0000, 0x215a, 0x0000, 0x0000, 0x0000, 0x1be2,
+	    0x49e5, 0x0000, 0x4784, 0x0000, 0x0ab8, 0x0000, 0x0000, 0x07de,
+	    0x0000, 0x0000, 0x0602, 0x0000, 0x14c9, 0x0000, 0x1580, 0x1384,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x36ab, 0x0000, 0x45a9, 0x0000, 0x0d9a, 0x1387, 0x0000,
+	    0x0000, 0x0000, 0x2add, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x37f9, 0x0000, 0x0000, 0x0000, 0x3625, 0x4198, 0x0000, 0x3bd1,
+	    0x199b, 0x0ed4, 0x0000, 0x0000, 0x0000, 0x0000, 0x144a, 0x0000,
+	    0x0000, 0x2f22, 0x3d3e, 0x0000, 0x0000, 0x174a, 0x0000, 0x2866,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3660, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1600, 0x2485,
+	    0x11f0, 0x1f6a, 0x0000, 0x0c89, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x35ee, 0x0000, 0x0000, 0x09eb, 0x2bcc, 0x05c2, 0x0000,
+	    0x3782, 0x0000, 0x0000, 0x0000, 0x0998, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0245, 0x0585, 0x0000, 0x0000, 0x36c0, 0x0000, 0x0000,
+	    0x0000, 0x3ed2, 0x4a66, 0x0000, 0x02d0, 0x0000, 0x0000, 0x0000,
+	    0x2f33, 0x2e8c, 0x0000, 0x0f8e, 0x0ed8, 0x0000, 0x169a, 0x0a9a,
+	    0x0000, 0x2693, 0x0000, 0x0000, 0x0000, 0x382b, 0x27b9, 0x0000,
+	    0x03da, 0x4ab6, 0x0000, 0x0000, 0x1807, 0x0000, 0x0000, 0x0000,
+	    0x1d0b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1264, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4787, 0x3edc, 0x0000, 0x1f39, 0x0000, 0x46dd, 0x0000,
+	    0x4ca1, 0x4b07, 0x0000, 0x49b3, 0x0000, 0x0000, 0x0acd, 0x43b6,
+	    0x0000, 0x497c, 0x1166, 0x0000, 0x44ac, 0x3e84, 0x0000, 0x0000,
+	    0x0000, 0x3e9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x39c0, 0x0000, 0x143f, 0x0000, 0x0000, 0x2b99, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x03ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3c80, 0x0a58, 0x0000, 0x07fd, 0x0000, 0x16d7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e5, 0x07a8,
+	    0x4ad3, 0x0000, 0x0000, 0x0000, 0x2ef1, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x46c8, 0x0000, 0x0564, 0x0000, 0x06d8, 0x0000, 0x0000,
+	    0x23fd, 0x2758, 0x0000, 0x18cd, 0x0000, 0x0000, 0x053f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x39d0, 0x0000, 0x0000, 0x499b,
+	    0x0000, 0x019c, 0x0000, 0x0000, 0x20fd, 0x4a99, 0x347e, 0x0000,
+	    0x39d9, 0x0000, 0x3b42, 0x0000, 0x0000, 0x4578, 0x4bed, 0x0326,
+	    0x14db, 0x0000, 0x0000, 0x0000, 0x0000, 0x46d2, 0x0000, 0x07db,
+	    0x0000, 0x0000, 0x2bff, 0x0000, 0x1fcd, 0x0000, 0x0000, 0x0000,
+	    0x40a3, 0x3344, 0x0000, 0x0325, 0x29f4, 0x0000, 0x31d3, 0x0000,
+	    0x0000, 0x0e47, 0x0000, 0x0000, 0x02d5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4a80, 0x0000, 0x4102, 0x2f4e,
+	    0x0000, 0x0000, 0x4c3a, 0x0de6, 0x3b58, 0x2448, 0x0aa8, 0x4b5b,
+	    0x2b07, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x487e, 0x1c7b,
+	    0x3fa4, 0x1a54, 0x0000, 0x0000, 0x1285, 0x0000, 0x24be, 0x49f8,
+	    0x0000, 0x0000, 0x0000, 0x2929, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0b7d, 0x113a, 0x0000, 0x14da, 0x0000, 0x0000, 0x3a56, 0x0fc1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x137f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01f8, 0x20c7, 0x0109, 0x0000, 0x20fe, 0x0000, 0x0000, 0x0000,
+	    0x224f, 0x0000, 0x12ba, 0x0000, 0x0000, 0x3157, 0x0000, 0x125b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06c8,
+	    0x0000, 0x0000, 0x3046, 0x0000, 0x0e98, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1ef3, 0x0000, 0x0000, 0x1aa4, 0x0000,
+	    0x0ca6, 0x0000, 0x4c19, 0x2362, 0x0000, 0x0000, 0x21e3, 0x3c5e,
+	    0x37e0, 0x0000, 0x0000, 0x0000, 0x48e6, 0x176b, 0x0000, 0x48dc,
+	    0x0000, 0x0317, 0x0000, 0x0000, 0x0000, 0x4167, 0x0000, 0x0000,
+	    0x4ad1, 0x0000, 0x0137, 0x0000, 0x2324, 0x0000, 0x0a4f, 0x0000,
+	    0x0000, 0x23a2, 0x0000, 0x3f24, 0x0000, 0x200b, 0x0000, 0x4003,
+	    0x22b5, 0x0000, 0x12c8, 0x24be, 0x2e2f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0425, 0x0000, 0x0000, 0x0797, 0x03ad, 0x0000, 0x42eb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x39cf, 0x0000, 0x0000, 0x223c, 0x0000,
+	    0x1fdd, 0x45e8, 0x3f9a, 0x01e6, 0x2fcc, 0x2e8a, 0x0000, 0x0000,
+	    0x3cc4, 0x0000, 0x0000, 0x032c, 0x0000, 0x3745, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1cb3, 0x0fba, 0x2b81, 0x2606,
+	    0x0000, 0x0000, 0x0000, 0x4dc0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x129d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2c3a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x46d2, 0x43ad, 0x3473, 0x0000, 0x0000, 0x257f, 0x213d,
+	    0x3e0a, 0x2ba0, 0x283a, 0x3d9e, 0x0000, 0x2bee, 0x0000, 0x4e01,
+	    0x0000, 0x0235, 0x0000, 0x4bae, 0x0000, 0x0000, 0x3743, 0x0000,
+	    0x1d9a, 0x0000, 0x0000, 0x0000, 0x261f, 0x3c38, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1483, 0x0000, 0x13c1, 0x0c57, 0x0000, 0x0000,
+	    0x2f61, 0x0000, 0x0000, 0x0000, 0x0424, 0x1d3b, 0x0000, 0x0000,
+	    0x1116, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0f01, 0x1e32, 0x0000, 0x0000, 0x18d2, 0x0000,
+	    0x0000, 0x1a10, 0x3a89, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4d9f, 0x0f68, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4b43, 0x0000, 0x0000, 0x2f7b, 0x2321,
+	    0x0000, 0x0000, 0x38f0, 0x0000, 0x3b3e, 0x0000, 0x3157, 0x0000,
+	    0x14fc, 0x0000, 0x311a, 0x0000, 0x0000, 0x0000, 0x357d, 0x39a3,
+	    0x076d, 0x3efd, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ffc, 0x42ee,
+	    0x3a7f, 0x0000, 0x0000, 0x4a89, 0x0000, 0x0000, 0x1c98, 0x016d,
+	    0x4291, 0x0000, 0x0a24, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006,
+	    0x0000, 0x19e8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b3b,
+	    0x13b4, 0x0000, 0x0000, 0x0000, 0x2f8b, 0x0000, 0x0000, 0x2d9b,
+	    0x4c8c, 0x0000, 0x4445, 0x0000, 0x0168, 0x1b88, 0x0b59, 0x3766,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x14b1, 0x0000, 0x0c38, 0x1a58, 0x0a54, 0x0000, 0x212b, 0x0000,
+	    0x2e40, 0x0000, 0x0000, 0x49e2, 0x0000, 0x0000, 0x439d, 0x0000,
+	    0x34ed, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e63, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1888, 0x0000, 0x378d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4cf2, 0x3a18, 0x0000, 0x0000, 0x0000, 0x2ca7,
+	    0x0000, 0x2fd6, 0x0000, 0x0000, 0x2382, 0x0c1f, 0x0000, 0x0000,
+	    0x3f5f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x36e5, 0x4949,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4049, 0x0000, 0x0000, 0x4d98,
+	    0x0000, 0x0000, 0x1aa2, 0x0000, 0x0000, 0x0000, 0x22cb, 0x2099,
+	    0x4544, 0x0000, 0x058a, 0x0558, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x457e, 0x2e4f, 0x0000, 0x0000, 0x0000,
+	    0x493d, 0x0000, 0x43a4, 0x0000, 0x1168, 0x1f81, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0d65, 0x0000, 0x342b, 0x0000, 0x0000, 0x0000, 0x48f1,
+	    0x1b32, 0x0000, 0x0000, 0x45fa, 0x0000, 0x47db, 0x0f26, 0x0000,
+	    0x0000, 0x284f, 0x4400, 0x0000, 0x1d1a, 0x0000, 0x3180, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x19ab, 0x0000, 0x0000, 0x0000, 0x0ba5, 0x4acd, 0x0590,
+	    0x04b1, 0x0b82, 0x07b5, 0x0859, 0x1689, 0x0000, 0x0000, 0x46c6,
+	    0x0000, 0x0000, 0x0000, 0x1616, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2922, 0x0000, 0x0000, 0x1d20, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x12ea, 0x499e, 0x0000, 0x0000,
+	    0x0000, 0x3794, 0x4ce3, 0x0000, 0x3fc4, 0x3e7d, 0x1692, 0x0bd3,
+	    0x316b, 0x1bf6, 0x0000, 0x0000, 0x1b40, 0x0000, 0x0000, 0x0000,
+	    0x1c14, 0x0000, 0x107e, 0x0000, 0x0000, 0x0000, 0x0bec, 0x0dc6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2683,
+	    0x0000, 0x1cea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b52,
+	    0x0000, 0x0000, 0x0000, 0x4ad0, 0x4a5b, 0x0000, 0x3482, 0x0000,
+	    0x1aec, 0x0000, 0x0000, 0x0000, 0x2a5b, 0x05c5, 0x0816, 0x0000,
+	    0x0000, 0x0000, 0x1e72, 0x0000, 0x4d92, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x203a, 0x41fe, 0x3db3, 0x0000, 0x0000, 0x0000, 0x2ada,
+	    0x0000, 0x3f9e, 0x01e8, 0x0000, 0x3697, 0x0000, 0x3a74, 0x4b00,
+	    0x0000, 0x0000, 0x0000, 0x3668, 0x3562, 0x0000, 0x10cd, 0x036a,
+	    0x4411, 0x0000, 0x0000, 0x0000, 0x48b8, 0x3433, 0x0000, 0x0000,
+	    0x34af, 0x4993, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2536,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00d0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x36d0, 0x28d9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x00e6, 0x4702, 0x360d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1653, 0x0000, 0x0000, 0x3ab4, 0x0117, 0x0000, 0x4684, 0x0000,
+	    0x0000, 0x0158, 0x0000, 0x0000, 0x4cff, 0x0000, 0x0000, 0x0000,
+	    0x0cd6, 0x0000, 0x0000, 0x0000, 0x0000, 0x1590, 0x1057, 0x2d54,
+	    0x0000, 0x0000, 0x0000, 0x1742, 0x0000, 0x457e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2613, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x004d, 0x0000, 0x1fe6, 0x0000, 0x0000, 0x45c4, 0x0000,
+	    0x4707, 0x2d75, 0x017d, 0x09b2, 0x0b39, 0x0000, 0x032d, 0x33b4,
+	    0x1d09, 0x3010, 0x0000, 0x0000, 0x0a19, 0x270d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0991, 0x47c6, 0x0000, 0x0000, 0x356d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3c23, 0x0000, 0x0000, 0x416d, 0x2e4e, 0x0000, 0x0000,
+	    0x1bcc, 0x0000, 0x0000, 0x35f6, 0x0000, 0x0000, 0x0000, 0x3af6,
+	    0x0000, 0x032d, 0x0000, 0x175b, 0x2dcb, 0x4abc, 0x0000, 0x0000,
+	    0x0000, 0x25fa, 0x0000, 0x0000, 0x4255, 0x0000, 0x0000, 0x1563,
+	    0x0000, 0x1b06, 0x0000, 0x4bdb, 0x0000, 0x352f, 0x0000, 0x0000,
+	    0x0000, 0x40a4, 0x0000, 0x0032, 0x0088, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x268a, 0x0000, 0x3a59, 0x4a1a, 0x20c0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4c14, 0x0b0f, 0x27c0, 0x0000, 0x24c8,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x447f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x449f, 0x0000, 0x0000, 0x0000, 0x0000, 0x29c5, 0x0000, 0x0000,
+	    0x27a8, 0x0000, 0x153f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0431, 0x0000, 0x0000, 0x0000, 0x0000, 0x13d0, 0x0000, 0x0000,
+	    0x0371, 0x0000, 0x0000, 0x0000, 0x295d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3295, 0x0000, 0x0000, 0x48a6, 0x0000, 0x3666, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0942, 0x0000, 0x1c12, 0x1b67, 0x0000, 0x054a, 0x0000, 0x0000,
+	    0x201d, 0x0000, 0x2790, 0x0000, 0x0000, 0x0000, 0x25b3, 0x02d4,
+	    0x0000, 0x1b2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f1b,
+	    0x0000, 0x0a6a, 0x315f, 0x1742, 0x0000, 0x0000, 0x1209, 0x0000,
+	    0x0000, 0x1373, 0x0000, 0x0000, 0x0000, 0x2c02, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x31b3, 0x0000, 0x0000, 0x0000, 0x0000, 0x4216,
+	    0x44aa, 0x4c2d, 0x1ac3, 0x0000, 0x4a5e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0875, 0x0000, 0x323e, 0x3843, 0x0000, 0x0c03,
+	    0x0000, 0x4224, 0x0000, 0x1461, 0x0000, 0x476d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x19c3, 0x0000, 0x1766, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0615,
+	    0x0000, 0x0000, 0x01ec, 0x0000, 0x2ef8, 0x0000, 0x0000, 0x2a1f,
+	    0x0000, 0x09c7, 0x0000, 0x3c34, 0x3d00, 0x0000, 0x0000, 0x07be,
+	    0x0000, 0x3edd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0889, 0x0000, 0x0000, 0x3c3b, 0x3a0f,
+	    0x3c96, 0x0000, 0x0000, 0x3003, 0x0000, 0x0000, 0x08e3, 0x0000,
+	    0x0000, 0x4032, 0x0000, 0x0000, 0x0000, 0x4b94, 0x0000, 0x4237,
+	    0x0000, 0x0000, 0x3d25, 0x060a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1557, 0x2e49, 0x0000, 0x29de, 0x0000, 0x2837, 0x1ae9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1ff2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1436, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3546, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1702,
+	    0x0000, 0x39fe, 0x1fd2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1dff, 0x0982, 0x3401, 0x0000, 0x0000, 0x462a,
+	    0x0000, 0x0000, 0x2921, 0x0000, 0x2018, 0x26c4, 0x0000, 0x3f54,
+	    0x44d9, 0x4a10, 0x2c2c, 0x0000, 0x0000, 0x0000, 0x2bf9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3af0, 0x0000,
+	    0x0000, 0x1fab, 0x4584, 0x2e8f, 0x17e5, 0x0000, 0x0000, 0x0000,
+	    0x036d, 0x0000, 0x0000, 0x0000, 0x0000, 0x1796, 0x0000, 0x4720,
+	    0x4098, 0x0000, 0x0000, 0x2fbc, 0x4be5, 0x426e, 0x0000, 0x2b36,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x09e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x280f, 0x2842, 0x05eb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1d65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1da7, 0x2dd5, 0x0000, 0x10b8, 0x0000, 0x0000, 0x13fc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x08ad, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x05d9, 0x0000, 0x0000, 0x0000,
+	    0x4bdc, 0x0000, 0x0896, 0x31ef, 0x0000, 0x0000, 0x0000, 0x3fa8,
+	    0x0000, 0x0000, 0x2e8a, 0x0000, 0x0000, 0x00ea, 0x0000, 0x0f2e,
+	    0x0000, 0x2ebd, 0x2f32, 0x0000, 0x0000, 0x1ad0, 0x2c18, 0x1ef6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04bc, 0x0000,
+	    0x0000, 0x068e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d2a,
+	    0x0000, 0x0000, 0x0000, 0x25f1, 0x4618, 0x0177, 0x0000, 0x4c5d,
+	    0x0000, 0x0000, 0x40ca, 0x2241, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4a7e, 0x0000, 0x4814, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1d2d, 0x0000, 0x13b8, 0x0000, 0x0000, 0x0000, 0x1f40,
+	    0x0000, 0x0000, 0x240c, 0x0000, 0x0044, 0x0000, 0x0000, 0x0000,
+	    0x34b5, 0x45d3, 0x0c1c, 0x2d39, 0x0000, 0x0000, 0x0000, 0x08a0,
+	    0x0e27, 0x2ba9, 0x3ed8, 0x0000, 0x0000, 0x1317, 0x333a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0434, 0x0000, 0x2ab8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x49ae, 0x197d, 0x0a51, 0x0000, 0x4a6f,
+	    0x0000, 0x0000, 0x4625, 0x22bd, 0x0000, 0x3336, 0x0000, 0x0000,
+	    0x2303, 0x0000, 0x2188, 0x1545, 0x0000, 0x371a, 0x0000, 0x3099,
+	    0x0000, 0x0000, 0x0000, 0x0d43, 0x0000, 0x46ea, 0x0000, 0x3a0a,
+	    0x0000, 0x0000, 0x347d, 0x3aaa, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0cf4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2371, 0x1922, 0x0000,
+	    0x0000, 0x3afb, 0x0000, 0x1b35, 0x0000, 0x3b3f, 0x0000, 0x4810,
+	    0x0000, 0x0000, 0x0000, 0x03b3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2da5, 0x297b, 0x1c1c, 0x0000, 0x05fc,
+	    0x209b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a39,
+	    0x0000, 0x0000, 0x358e, 0x0000, 0x0000, 0x0000, 0x4c9e, 0x4959,
+	    0x2d5d, 0x0000, 0x0222, 0x3bdf, 0x0000, 0x2b21, 0x0000, 0x2863,
+	    0x0000, 0x0000, 0x4c83, 0x0000, 0x0000, 0x414c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dec, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4c31, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2127, 0x0000, 0x0000, 0x0000, 0x0a95, 0x0000,
+	    0x0801, 0x3571, 0x0000, 0x4c6b, 0x0000, 0x3f27, 0x0000, 0x25ae,
+	    0x118f, 0x3405, 0x0000, 0x2f59, 0x0000, 0x0000, 0x0000, 0x250f,
+	    0x0000, 0x0000, 0x18e0, 0x0000, 0x480e, 0x0000, 0x0421, 0x0000,
+	    0x0000, 0x0e56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1826, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c81,
+	    0x3c75, 0x0000, 0x0000, 0x0000, 0x44b4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x47a7, 0x0000, 0x4b9f, 0x3990,
+	    0x0000, 0x226f, 0x0000, 0x0000, 0x13c4, 0x265c, 0x26f7, 0x08a0,
+	    0x25e5, 0x0000, 0x0045, 0x4780, 0x371e, 0x0000, 0x2ba5, 0x0000,
+	    0x0000, 0x28b7, 0x0000, 0x06c7, 0x0000, 0x157d, 0x0000, 0x22bf,
+	    0x152f, 0x0000, 0x2a3f, 0x1425, 0x3449, 0x3bb6, 0x0741, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1530, 0x0705, 0x0000, 0x0000,
+	    0x0fe6, 0x0000, 0x0000, 0x0a89, 0x3461, 0x0000, 0x2336, 0x0000,
+	    0x33f5, 0x0000, 0x0000, 0x44a7, 0x4139, 0x0000, 0x28ae, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x231b, 0x0000, 0x2ae5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ede, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d76,
+	    0x0000, 0x0000, 0x012b, 0x0000, 0x0000, 0x0000, 0x1293, 0x0000,
+	    0x0000, 0x0000, 0x4622, 0x0000, 0x0000, 0x035c, 0x0000, 0x0000,
+	    0x0000, 0x0cb0, 0x0000, 0x0000, 0x325a, 0x0000, 0x0e76, 0x1b5e,
+	    0x1845, 0x0000, 0x0000, 0x176c, 0x0000, 0x0000, 0x45dc, 0x478a,
+	    0x0000, 0x0000, 0x362c, 0x0000, 0x2ae0, 0x0000, 0x0000, 0x0000,
+	    0x42f1, 0x0000, 0x1f0b, 0x2f7a, 0x0255, 0x3cd4, 0x0000, 0x00f8,
+	    0x0000, 0x0000, 0x0000, 0x2394, 0x27f7, 0x045c, 0x0000, 0x3f94,
+	    0x0000, 0x0000, 0x1857, 0x0000, 0x08b0, 0x0000, 0x28a3, 0x0000,
+	    0x0000, 0x0000, 0x15e8, 0x0000, 0x0000, 0x0000, 0x4bfd, 0x0947,
+	    0x0000, 0x396e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x404d, 0x0000, 0x0000, 0x35ce, 0x0000, 0x49c6, 0x0000, 0x0000,
+	    0x0263, 0x0000, 0x0000, 0x4b50, 0x0000, 0x475e, 0x0000, 0x3cf1,
+	    0x0262, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0aaf, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e32, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3b78, 0x0000, 0x0000, 0x0690,
+	    0x0a18, 0x0000, 0x2774, 0x0000, 0x0000, 0x3726, 0x0000, 0x2eec,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x29b7,
+	    0x1fad, 0x0000, 0x0000, 0x0000, 0x10a2, 0x0000, 0x0000, 0x40b4,
+	    0x0000, 0x0000, 0x0476, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x046d, 0x0000, 0x0000, 0x0000, 0x48cb, 0x11b8,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x061d, 0x28b1, 0x40c3,
+	    0x2229, 0x41d9, 0x0000, 0x04ad, 0x0000, 0x0000, 0x2744, 0x0000,
+	    0x047d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x08a4, 0x0f29, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x10a0, 0x0000, 0x0000, 0x2076, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1a1a, 0x0000, 0x1f7e, 0x454c, 0x0000, 0x0000,
+	    0x0000, 0x1a6b, 0x0000, 0x0000, 0x1b12, 0x0000, 0x0000, 0x0000,
+	    0x1e1b, 0x38ff, 0x4b92, 0x0000, 0x0000, 0x0000, 0x0000, 0x1772,
+	    0x0cd4, 0x0000, 0x0000, 0x07e1, 0x0000, 0x0000, 0x0000, 0x4d61,
+	    0x4162, 0x357e, 0x0000, 0x015c, 0x494a, 0x0000, 0x0000, 0x0000,
+	    0x043d, 0x0000, 0x449f, 0x0000, 0x1536, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x35c2, 0x0000, 0x0000, 0x0000, 0x3507, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2a54, 0x0000, 0x1f8d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1f0e, 0x0000, 0x0000, 0x0000,
+	    0x3adb, 0x0000, 0x2709, 0x0000, 0x0000, 0x0000, 0x0000, 0x1983,
+	    0x114c, 0x0000, 0x0000, 0x0000, 0x0000, 0x25af, 0x0000, 0x0000,
+	    0x46f4, 0x0000, 0x33ab, 0x1026, 0x0000, 0x0000, 0x0000, 0x4df6,
+	    0x24a9, 0x0000, 0x20d6, 0x0000, 0x180e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1489, 0x151a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x09a1, 0x4cc0, 0x0000, 0x0000, 0x0000,
+	    0x1ab8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d78, 0x0000, 0x0000,
+	    0x0000, 0x3a2f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1343, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2e21,
+	    0x29ab, 0x0000, 0x0000, 0x0d29, 0x112b, 0x0000, 0x0000, 0x0000,
+	    0x2d05, 0x071a, 0x28e5, 0x0000, 0x0000, 0x0000, 0x19f0, 0x0000,
+	    0x41e9, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b86, 0x0000, 0x4528,
+	    0x0000, 0x0bf4, 0x0000, 0x4b23, 0x05c0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2cb8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1f47, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1ea7, 0x0000, 0x0000, 0x0000, 0x49fb, 0x0000,
+	    0x0000, 0x0b74, 0x0000, 0x0618, 0x0000, 0x454a, 0x0000, 0x0000,
+	    0x0c30, 0x1765, 0x3075, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f74,
+	    0x0000, 0x0986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4300,
+	    0x0000, 0x3a24, 0x0fea, 0x124c, 0x33ef, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x30ec, 0x0000, 0x0000, 0x3efe, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e07,
+	    0x165a, 0x0000, 0x0000, 0x0000, 0x0000, 0x205b, 0x0000, 0x0000,
+	    0x0000, 0x2670, 0x3788, 0x0000, 0x0000, 0x0000, 0x2627, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x08f7, 0x0000, 0x0000, 0x1276, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4363, 0x0bdb, 0x1018, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2ae3, 0x0000, 0x063d, 0x0000, 0x1b6d,
+	    0x0000, 0x467d, 0x0000, 0x0000, 0x0d02, 0x4269, 0x0000, 0x411a,
+	    0x08d7, 0x0000, 0x0000, 0x4476, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4c4d, 0x3ca3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4662, 0x0000, 0x0000, 0x03d3, 0x1ac7, 0x0000, 0x2c77,
+	    0x3d8a, 0x259f, 0x0000, 0x0ecf, 0x376d, 0x0082, 0x0000, 0x1336,
+	    0x4217, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4b38, 0x142c, 0x0000, 0x0d88, 0x0000, 0x1c65, 0x0000,
+	    0x0000, 0x0a16, 0x159c, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f85,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dbe,
+	    0x0000, 0x0000, 0x0000, 0x126d, 0x2dd7, 0x0b3e, 0x0000, 0x4ac2,
+	    0x4391, 0x233d, 0x0000, 0x1686, 0x3271, 0x0000, 0x1773, 0x4c85,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3f97, 0x0000, 0x0000,
+	    0x2529, 0x0000, 0x0000, 0x0afa, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4c30, 0x32a9, 0x4d5b, 0x0000, 0x2327, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2595, 0x0000, 0x0000, 0x00e5, 0x0000,
+	    0x0949, 0x01cc, 0x4c32, 0x0000, 0x0000, 0x4844, 0x0000, 0x1146,
+	    0x18af, 0x48db, 0x0000, 0x0000, 0x0000, 0x0000, 0x2173, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0cbe, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x468b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0996, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3806,
+	    0x1f1b, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cd1, 0x03ac, 0x0000,
+	    0x46a6, 0x0000, 0x0000, 0x0000, 0x44a6, 0x0000, 0x3253, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x193c, 0x0000, 0x0000, 0x1a18, 0x0000, 0x0000, 0x0000, 0x49c3,
+	    0x0000, 0x42ba, 0x23a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ef9,
+	    0x2d56, 0x0000, 0x0000, 0x3e2e, 0x0000, 0x0000, 0x2e73, 0x3078,
+	    0x0000, 0x4239, 0x193f, 0x0000, 0x43c0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x485c, 0x0000, 0x0000, 0x0000, 0x33d4, 0x0000,
+	    0x0000, 0x1198, 0x0000, 0x22b0, 0x0000, 0x1060, 0x0000, 0x37bf,
+	    0x0000, 0x4c61, 0x405a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3f62, 0x30fc, 0x01dc, 0x191b, 0x302c, 0x0000, 0x0000, 0x0000,
+	    0x3b64, 0x3137, 0x4c54, 0x0000, 0x0000, 0x1e89, 0x413b, 0x038d,
+	    0x0000, 0x0000, 0x0000, 0x18b7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04f4, 0x2ac7, 0x1a2a, 0x33fb, 0x0000,
+	    0x0000, 0x0b13, 0x0000, 0x0000, 0x06c8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x498b, 0x3dc1, 0x0000, 0x2da9, 0x0000, 0x0000,
+	    0x1439, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10e0, 0x0000,
+	    0x139e, 0x0b05, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e96, 0x0000,
+	    0x0000, 0x0000, 0x3197, 0x1034, 0x25ef, 0x0000, 0x4c5b, 0x48fe,
+	    0x0000, 0x440e, 0x0000, 0x0000, 0x0000, 0x143b, 0x0000, 0x06ca,
+	    0x0000, 0x0000, 0x0000, 0x4ca1, 0x0ebb, 0x0000, 0x0000, 0x1267,
+	    0x4459, 0x0000, 0x3853, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f4a,
+	    0x0000, 0x0000, 0x2d8c, 0x0482, 0x2b65, 0x0000, 0x0226, 0x26e1,
+	    0x23ab, 0x0000, 0x0000, 0x25f9, 0x0000, 0x3505, 0x0226, 0x0000,
+	    0x0000, 0x0000, 0x13c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x22f7,
+	    0x0e73, 0x371b, 0x0000, 0x0000, 0x2e1b, 0x0000, 0x0047, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2499, 0x0000,
+	    0x4acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f56,
+	    0x1142, 0x0000, 0x0000, 0x1876, 0x0000, 0x0000, 0x40b6, 0x0000,
+	    0x0000, 0x11a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x46ee, 0x0000, 0x0000, 0x0000, 0x0cac, 0x0e9c, 0x456f, 0x311f,
+	    0x3a8c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x213f,
+	    0x0000, 0x0000, 0x0000, 0x2cf0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2d2c, 0x0000, 0x30f4, 0x0000, 0x0000, 0x2718, 0x2e82, 0x0000,
+	    0x0000, 0x4850, 0x396f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x30d5, 0x0000, 0x14ac, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x07e5, 0x0000, 0x3788, 0x15e6, 0x3e0a, 0x0000, 0x2f7f, 0x0000,
+	    0x4907, 0x1551, 0x0000, 0x0000, 0x0000, 0x1f54, 0x0000, 0x0000,
+	    0x0000, 0x47d4, 0x31b5, 0x0000, 0x2dec, 0x0000, 0x0000, 0x06d1,
+	    0x2ee4, 0x0000, 0x336b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x11a7, 0x0000, 0x0121, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3738, 0x0000, 0x0000,
+	    0x0000, 0x2ccc, 0x0ab4, 0x1913, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3a3a, 0x0000, 0x125d, 0x0000, 0x30b7, 0x0000, 0x0000, 0x4889,
+	    0x1dd6, 0x4512, 0x4394, 0x0000, 0x0000, 0x33e0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x467c,
+	    0x0000, 0x19c7, 0x2ba8, 0x11c1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x381a, 0x0000, 0x0000, 0x3b24, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1106, 0x1ca9,
+	    0x0c09, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0dfc, 0x0000, 0x0000, 0x0000, 0x4ad2, 0x3172, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3dd3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1399,
+	    0x4989, 0x0000, 0x0000, 0x0f18, 0x2a86, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x29b0, 0x0000, 0x1dee, 0x290f, 0x23d1,
+	    0x0000, 0x0000, 0x08db, 0x4c63, 0x0000, 0x2ed5, 0x3d7f, 0x0000,
+	    0x0000, 0x1c3d, 0x0000, 0x0000, 0x0000, 0x1021, 0x0000, 0x43b1,
+	    0x1f7a, 0x3c35, 0x2f72, 0x0000, 0x0000, 0x0000, 0x07f5, 0x0000,
+	    0x43ed, 0x3451, 0x0000, 0x3b90, 0x11e7, 0x0000, 0x0000, 0x0000,
+	    0x14bc, 0x0000, 0x016f, 0x0000, 0x2d4d, 0x0000, 0x388d, 0x44df,
+	    0x0000, 0x0000, 0x4140, 0x0540, 0x0468, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x4424, 0x0000, 0x4da1, 0x4799, 0x1f0c, 0x0000,
+	    0x325b, 0x0000, 0x0000, 0x0a3d, 0x0000, 0x0000, 0x0000, 0x1dc5,
+	    0x11a1, 0x173f, 0x2a8d, 0x0000, 0x0651, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2839, 0x0000, 0x2ffd, 0x0000, 0x1300, 0x1ad2, 0x0000,
+	    0x429c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2bd9,
+	    0x30f3, 0x0000, 0x0000, 0x0bac, 0x0000, 0x0000, 0x0000, 0x40d6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0210, 0x06f4, 0x1589, 0x0000,
+	    0x056a, 0x31e3, 0x0000, 0x0000, 0x0000, 0x12e4, 0x3c5e, 0x0000,
+	    0x126d, 0x0000, 0x04df, 0x0000, 0x2ef9, 0x0000, 0x305b, 0x0000,
+	    0x23f9, 0x0000, 0x0000, 0x2aa0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x33b1, 0x0000,
+	    0x29c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x44db, 0x1bb6,
+	    0x0000, 0x0000, 0x0000, 0x3f1e, 0x0000, 0x0000, 0x0000, 0x1333,
+	    0x3833, 0x0000, 0x0000, 0x0000, 0x0000, 0x4079, 0x2c08, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3d74,
+	    0x0000, 0x2c1b, 0x0000, 0x0000, 0x0000, 0x02dd, 0x18ac, 0x0000,
+	    0x0000, 0x3a6d, 0x0c36, 0x408a, 0x1c2a, 0x0000, 0x0000, 0x0000,
+	    0x104a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d4c, 0x0000, 0x0000,
+	    0x4adb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x37de,
+	    0x0000, 0x1749, 0x0000, 0x0000, 0x0000, 0x40b6, 0x0000, 0x3828,
+	    0x0000, 0x3f2c, 0x26c9, 0x4147, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2c43, 0x0000, 0x0000, 0x0000, 0x1044, 0x0000,
+	    0x0000, 0x0000, 0x0fe2, 0x4aa8, 0x494f, 0x0000, 0x0000, 0x1d3a,
+	    0x0cd1, 0x43de, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c94, 0x0000,
+	    0x2522, 0x47bb, 0x0000, 0x3a26, 0x0000, 0x0000, 0x2f79, 0x392b,
+	    0x0f08, 0x0000, 0x0000, 0x0000, 0x4b36, 0x0f5d, 0x2351, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2750, 0x4d94, 0x1462, 0x0000, 0x0000,
+	    0x20f1, 0x290d, 0x0000, 0x0000, 0x1f9f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x44b6, 0x3081, 0x0000, 0x0000, 0x0000, 0x0000, 0x1abf,
+	    0x0000, 0x0000, 0x357e, 0x0000, 0x357d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4ab0, 0x0000, 0x0000, 0x0000, 0x0000, 0x10ca, 0x2899,
+	    0x0000, 0x0000, 0x1021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0535,
+	    0x0000, 0x0000, 0x0000, 0x2d69, 0x4cc3, 0x0000, 0x0000, 0x0be2,
+	    0x0000, 0x0000, 0x4904, 0x0000, 0x4d4f, 0x4303, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4106, 0x4d40, 0x0000,
+	    0x04d1, 0x0000, 0x2e7f, 0x0000, 0x0af7, 0x2a14, 0x0000, 0x0000,
+	    0x0cf8, 0x4c38, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2fa2, 0x0000, 0x0000, 0x156f, 0x0ed1, 0x3ba0,
+	    0x0000, 0x0fa5, 0x26af, 0x0000, 0x018a, 0x254e, 0x0000, 0x0000,
+	    0x0a6f, 0x10ab, 0x0000, 0x4384, 0x0000, 0x0000, 0x4d78, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1941, 0x48d8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0de6, 0x0000, 0x294b, 0x0000, 0x0000, 0x138d,
+	    0x3c66, 0x2f54, 0x0000, 0x1203, 0x341c, 0x0000, 0x0000, 0x0000,
+	    0x1b93, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3307, 0x0000,
+	    0x0000, 0x0000, 0x0ad6, 0x3fd3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4113, 0x0000, 0x3274, 0x0000, 0x0000, 0x0000, 0x47bf,
+	    0x0e29, 0x486c, 0x0000, 0x0d76, 0x0000, 0x0000, 0x0000, 0x18ff,
+	    0x0483, 0x1475, 0x0000, 0x093d, 0x0000, 0x0000, 0x2fd7, 0x3c20,
+	    0x0000, 0x174b, 0x44e3, 0x0d37, 0x0000, 0x0000, 0x0000, 0x4254,
+	    0x0000, 0x0000, 0x48e3, 0x3378, 0x0000, 0x0000, 0x0000, 0x3540,
+	    0x0000, 0x2829, 0x1a84, 0x4556, 0x2538, 0x0904, 0x01e7, 0x0000,
+	    0x0000, 0x022e, 0x0000, 0x0000, 0x3a80, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x07ea, 0x1f42, 0x2682, 0x3fa0,
+	    0x0000, 0x1c56, 0x4451, 0x0000, 0x0000, 0x0000, 0x0000, 0x27b1,
+	    0x387c, 0x3f8f, 0x3185, 0x11a1, 0x0000, 0x0000, 0x4d91, 0x4288,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3f19, 0x0000, 0x0000, 0x34f3,
+	    0x1f73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x42cd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3925, 0x20bf,
+	    0x0000, 0x12ce, 0x25d0, 0x46be, 0x21b9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x07ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23b0,
+	    0x0000, 0x2dfa, 0x0000, 0x0000, 0x0b87, 0x404f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x430d, 0x0000, 0x0000, 0x0000, 0x4bf7, 0x00b2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x10a8, 0x0000, 0x1eec, 0x0000, 0x0000,
+	    0x0000, 0x22fd, 0x0000, 0x3be1, 0x3524, 0x02b9, 0x2ed5, 0x44b2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b8d, 0x0000, 0x0000,
+	    0x42eb, 0x0000, 0x4910, 0x0804, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x37b3, 0x0000, 0x44c8, 0x0000, 0x1e3c, 0x2f8b, 0x3480,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0237, 0x0000, 0x0000, 0x0000,
+	    0x32f6, 0x3c18, 0x0000, 0x0000, 0x0000, 0x3a20, 0x2ff3, 0x0000,
+	    0x0000, 0x0000, 0x48de, 0x1193, 0x0000, 0x02ca, 0x0000, 0x0000,
+	    0x3bde, 0x45d6, 0x3478, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041,
+	    0x0000, 0x0000, 0x0000, 0x3288, 0x1a14, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0830,
+	    0x0000, 0x0000, 0x0000, 0x444c, 0x3b9e, 0x0000, 0x25a0, 0x0000,
+	    0x374d, 0x0000, 0x0000, 0x0000, 0x4b2d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x11df, 0x0000, 0x0000, 0x0000, 0x1f07, 0x0000, 0x0000, 0x0000,
+	    0x0934, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e6e, 0x0000, 0x43de,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1148, 0x0000, 0x11b8,
+	    0x3fd9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4229, 0x0000, 0x0000, 0x0000, 0x0000, 0x08ee, 0x0000,
+	    0x0000, 0x0000, 0x474d, 0x0000, 0x0406, 0x0000, 0x0000, 0x0337,
+	    0x3338, 0x0000, 0x0000, 0x2a60, 0x0000, 0x1673, 0x0000, 0x0000,
+	    0x1a65, 0x0000, 0x4b0c, 0x0000, 0x1a28, 0x3d1b, 0x0000, 0x0000,
+	    0x0000, 0x2126, 0x0000, 0x1e52, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1806, 0x0000, 0x0000, 0x0000, 0x10a6,
+	    0x0000, 0x47c2, 0x226f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0fff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4430,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x49dd, 0x0000,
+	    0x0000, 0x43d7, 0x0000, 0x31cf, 0x4281, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1b4f, 0x0000, 0x45f9, 0x443b, 0x0000, 0x2454, 0x0587,
+	    0x0000, 0x2531, 0x0000, 0x0000, 0x0000, 0x17e0, 0x1b8c, 0x2f2a,
+	    0x0000, 0x0000, 0x4a1e, 0x202f, 0x0000, 0x0000, 0x2b38, 0x0000,
+	    0x0000, 0x0000, 0x2645, 0x0000, 0x4d2a, 0x0000, 0x0000, 0x0000,
+	    0x1aff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04a7, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x4cde, 0x09f4, 0x051c, 0x44f1, 0x0000,
+	    0x4bf0, 0x0000, 0x13a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x3663,
+	    0x0000, 0x0000, 0x0000, 0x2cd1, 0x0000, 0x0e51, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f36, 0x140e,
+	    0x0000, 0x2d74, 0x0000, 0x2851, 0x0000, 0x2ac7, 0x2158, 0x0000,
+	    0x0000, 0x0000, 0x0b4e, 0x0000, 0x23de, 0x1b2a, 0x2913, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x35c9, 0x0000, 0x3c65, 0x0000,
+	    0x242f, 0x0000, 0x1789, 0x0000, 0x0000, 0x3f1a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1437, 0x0000, 0x44bf, 0x0000, 0x0000,
+	    0x1e2f, 0x3d56, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bef, 0x2a69,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0278,
+	    0x1dd0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x06b8, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ad, 0x34ee, 0x0000,
+	    0x0000, 0x2ba9, 0x3d04, 0x0000, 0x412a, 0x0000, 0x14bf, 0x23b9,
+	    0x0000, 0x3bbd, 0x0854, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f1e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3fed, 0x2216,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a36,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x01ee, 0x0000, 0x0000, 0x29fe, 0x46cb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x1850, 0x0000, 0x0000, 0x1ca1, 0x0000,
+	    0x0000, 0x018e, 0x3684, 0x0000, 0x152f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02b2, 0x369e, 0x0000, 0x0000, 0x4708, 0x0000, 0x0000,
+	    0x0000, 0x3106, 0x1f23, 0x0753, 0x28f0, 0x4c00, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x45ff, 0x4185, 0x49dc, 0x487e, 0x4059, 0x0000,
+	    0x3747, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x092a, 0x0000, 0x2744, 0x23e4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3d8c, 0x0000, 0x0000, 0x0000, 0x470e, 0x0000, 0x18f5, 0x2ac8,
+	    0x37b9, 0x4589, 0x0431, 0x2b2c, 0x1330, 0x1052, 0x0c34, 0x0000,
+	    0x32ba, 0x48c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x20b6, 0x0000,
+	    0x438c, 0x0000, 0x0000, 0x29b2, 0x34c2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x005c, 0x0000, 0x4e0b, 0x1cc3, 0x2fcc, 0x27d6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x45a7, 0x0000, 0x0000, 0x3c60,
+	    0x2d9b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3024, 0x36a0,
+	    0x0000, 0x0000, 0x063a, 0x2890, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1b4f, 0x0000, 0x20ee, 0x0000, 0x0000, 0x4981, 0x4a58, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x14e8, 0x0000, 0x0000, 0x0000, 0x457f,
+	    0x0000, 0x41a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x13b4, 0x1b37,
+	    0x0000, 0x0000, 0x2968, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x479d, 0x0cfa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2ed8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x18b3, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a28, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ab1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x26fe, 0x4ba5, 0x0000, 0x495c, 0x0d0a,
+	    0x0000, 0x0000, 0x210a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x43d6, 0x233c, 0x0000, 0x385e, 0x0014, 0x3f7e,
+	    0x2652, 0x0000, 0x2882, 0x3dae, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2395, 0x0000, 0x0000, 0x34f3, 0x3864, 0x1b84, 0x0000, 0x0000,
+	    0x42c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0014, 0x0c99,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4201, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x383c, 0x2d42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x23e4, 0x4ab3, 0x0000, 0x0000, 0x0000, 0x0000, 0x4172,
+	    0x0000, 0x1fe8, 0x0000, 0x0000, 0x0000, 0x092b, 0x302f, 0x0000,
+	    0x0000, 0x0000, 0x1f3b, 0x0000, 0x0000, 0x23c7, 0x0000, 0x0000,
+	    0x0000, 0x3b8e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b92,
+	    0x0982, 0x3979, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0198,
+	    0x0000, 0x0000, 0x0000, 0x150b, 0x0000, 0x0000, 0x0000, 0x27d2,
+	    0x0000, 0x0000, 0x0000, 0x147e, 0x0000, 0x0000, 0x0000, 0x248a,
+	    0x0000, 0x415e, 0x0000, 0x0000, 0x0000, 0x0000, 0x38b9, 0x3245,
+	    0x0000, 0x0000, 0x17b3, 0x0000, 0x13c4, 0x0355, 0x143b, 0x0000,
+	    0x329c, 0x0000, 0x0000, 0x0000, 0x00aa, 0x48ef, 0x0000, 0x3b73,
+	    0x3bf1, 0x48c6, 0x2dd4, 0x0000, 0x2517, 0x0000, 0x0000, 0x0000,
+	    0x05fb, 0x0000, 0x0000, 0x0000, 0x056e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3ffb, 0x0000, 0x331c, 0x3262, 0x0000, 0x098a,
+	    0x270e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x35b4, 0x4296,
+	    0x162b, 0x0bac, 0x0000, 0x0000, 0x0000, 0x3a08, 0x0000, 0x2d1b,
+	    0x25cd, 0x0000, 0x0c78, 0x0000, 0x0000, 0x0000, 0x0000, 0x2aa6,
+	    0x361b, 0x0000, 0x0000, 0x0000, 0x33ef, 0x4e1e, 0x130b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x43a1, 0x14e7, 0x0c68, 0x04d6, 0x3c78,
+	    0x0000, 0x0000, 0x4bd4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x407a, 0x0000, 0x0577, 0x0000, 0x0000,
+	    0x0000, 0x4ce9, 0x40f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e5c, 0x0000,
+	    0x2387, 0x4b85, 0x0000, 0x07d6, 0x0000, 0x2956, 0x0000, 0x27d7,
+	    0x0000, 0x10db, 0x0000, 0x0000, 0x13db, 0x21d7, 0x0000, 0x0000,
+	    0x3a84, 0x141a, 0x0000, 0x0000, 0x0000, 0x0000, 0x26d6, 0x45b0,
+	    0x1c38, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1aa1, 0x4abb,
+	    0x3b26, 0x0000, 0x0000, 0x0000, 0x0000, 0x1030, 0x0000, 0x0000,
+	    0x4480, 0x0000, 0x3eb8, 0x0000, 0x0000, 0x4dc4, 0x0000, 0x0000,
+	    0x0000, 0x4bd3, 0x0000, 0x0000, 0x24b7, 0x0000, 0x0000, 0x34e7,
+	    0x0000, 0x0000, 0x250d, 0x3f16, 0x0000, 0x0000, 0x1984, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x421a, 0x0000, 0x0b89, 0x0000, 0x0000, 0x0000, 0x2786,
+	    0x20e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01b5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x18ef, 0x4750, 0x0000, 0x1e66, 0x4a4d,
+	    0x0000, 0x0000, 0x31d5, 0x17a1, 0x2ff5, 0x0000, 0x0000, 0x0000,
+	    0x4149, 0x0000, 0x0000, 0x09fc, 0x0000, 0x2b09, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1070, 0x070b, 0x25ee, 0x0000, 0x0000, 0x0000,
+	    0x0a1a, 0x0000, 0x2484, 0x33ce, 0x3861, 0x0fe2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x275b, 0x345b, 0x0000, 0x0000, 0x0000, 0x2574,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x3c9f, 0x2d1a, 0x303a, 0x0000,
+	    0x16c4, 0x0000, 0x0000, 0x0000, 0x28b3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x45d9, 0x2deb, 0x0000, 0x0000, 0x0000, 0x0121, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x108e, 0x0000, 0x27b7, 0x4394, 0x1718,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x35b8, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1523,
+	    0x0000, 0x328a, 0x0000, 0x0000, 0x0000, 0x1b0c, 0x0000, 0x0000,
+	    0x0000, 0x0098, 0x0917, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x421b, 0x0000, 0x0000, 0x365b,
+	    0x0000, 0x4da8, 0x473e, 0x0000, 0x4b91, 0x0000, 0x136c, 0x0000,
+	    0x00d3, 0x0000, 0x0000, 0x0000, 0x2299, 0x45e7, 0x21e5, 0x0b8c,
+	    0x4793, 0x3e9d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0cdf,
+	    0x0000, 0x0000, 0x22d8, 0x0000, 0x0000, 0x0000, 0x0b24, 0x12ec,
+	    0x01c0,
+	};
+	if (keylen - 2 > 12)
+		return (uint16_t)-1;
+	uint16_t h[4];
+
+	_wyhash_shape(key, keylen, (uint32_t *)h);
+
+	h[0] = h[0] % 40001;
+	h[1] = h[1] % 40001;
+	result = (g[h[0]] + g[h[1]]) % 20000;
+	return (strcmp(hash_keys[result], key) == 0) ? result : (uint16_t)-1;
+}
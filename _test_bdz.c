@@ -0,0 +1,87 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 1957747793, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint64_t g[80] NBPERF_ALIGN64 = {
+		UINT64_C(0x5c3c1a0000000000), UINT64_C(0xf71ed3ef13333cff), UINT64_C(0x7cf7337f7cdfff2d),
+		UINT64_C(0xb53fcf3df86fe333), UINT64_C(0x0dc73731bbfbd1e9), UINT64_C(0xf0fbf345c04c0f03),
+		UINT64_C(0xffef2fb53fb7fc0c), UINT64_C(0xd39fdf77af5c9003), UINT64_C(0x654623000000006f),
+		UINT64_C(0x9de360fcfffcfc77), UINT64_C(0x20edc34bf9ac8dec), UINT64_C(0x0cdef865bd457cf3),
+		UINT64_C(0xfcf763dcfef0c771), UINT64_C(0xffc83b63ac8f3c3f), UINT64_C(0x1fcf59cc39fbbfcf),
+		UINT64_C(0xefecccb7fddc3ccc), UINT64_C(0x5b3e2500000000e2), UINT64_C(0x2f9536f09eb3f1cb),
+		UINT64_C(0x03fff7f338d21732), UINT64_C(0xbffaf3f13339cdd8), UINT64_C(0x3ccff1cfffbff8ff),
+		UINT64_C(0xfdfdfe7fc7273837), UINT64_C(0x0fcf70bfacd2d3ff), UINT64_C(0x076c97c238f17ff3),
+		UINT64_C(0x5a3d1e0000000150), UINT64_C(0x3b3fc038f4bec1cf), UINT64_C(0xffff828377fbefcc),
+		UINT64_C(0x3d7cfa0eeff33f7b), UINT64_C(0x5bc0fc3f7b1edcf5), UINT64_C(0xf64cf23fff0cf474),
+		UINT64_C(0xd3cfbbc4fe70fff7), UINT64_C(0xfabf1d3ff0da4bdf), UINT64_C(0x55371b00000001ba),
+		UINT64_C(0x3efcf73ffffa4f36), UINT64_C(0xf7e6dfaff404cff7), UINT64_C(0x5f73ffa3fff2bf3d),
+		UINT64_C(0xef3f43ddccdde3c0), UINT64_C(0xffcfe4f8db0c7ecf), UINT64_C(0x321b337fd0df6fcf),
+		UINT64_C(0xf6e7dc13bafc3567), UINT64_C(0x5f3f220000000222), UINT64_C(0xccf3fd73fa36f07f),
+		UINT64_C(0xded538d1c3fe34c2), UINT64_C(0x43fffcfc3f3ca6fc), UINT64_C(0xf30cbb0bfc3fd9bc),
+		UINT64_C(0xccd3b2b7c6153ff1), UINT64_C(0xcb403fd67ddfffff), UINT64_C(0x7f8c1fbf0df3bff4),
+		UINT64_C(0x634921000000028f), UINT64_C(0xfc0bd33cfef254f3), UINT64_C(0x01dbf43c7d377bfd),
+		UINT64_C(0x73f2f073bb235333), UINT64_C(0x42090cf8e10ffa7d), UINT64_C(0xf937f37fcce54fd3),
+		UINT64_C(0xfdc6bfbfff2f777f), UINT64_C(0xff7dc76f51fc3d4f), UINT64_C(0x6243230000000301),
+		UINT64_C(0x3050bbcfbe553f3d), UINT64_C(0x0dcf38357fdb33cf), UINT64_C(0xff0fc408f07fc6f3),
+		UINT64_C(0x30ebdcdc8f43f0ff), UINT64_C(0xf0dff13bf400cf03), UINT64_C(0xd33fff0a84fbffc7),
+		UINT64_C(0x1df395fab4dfdf8c), UINT64_C(0x5738190000000375), UINT64_C(0xf07f8cfffffc36df),
+		UINT64_C(0x7f430fbdf3f4bf4f), UINT64_C(0x75cff303cff14c72), UINT64_C(0xbc38ff33f373fb8b),
+		UINT64_C(0xfa3ef0fa3f16f5f7), UINT64_C(0x7c38f2fc2ffc33f9), UINT64_C(0xbf0b1b033f30f7ff),
+		UINT64_C(0x11111100000003db), UINT64_C(0x0ff003bffcffb0df), UINT64_C(0xffffffffffffff00),
+		UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+		UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+	};
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x74b0dc51), (uint32_t *)h);
+
+	h[0] = h[0] % 2048;
+	h[1] = h[1] % 2048;
+	h[2] = h[2] % 2048;
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 2048;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return base_rank;
+}
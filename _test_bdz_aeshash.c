@@ -0,0 +1,76 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 1129566413, seed[1]: 184803526 */
+#include <stdint.h>
+#include "aeshash.h"
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint64_t g[48] NBPERF_ALIGN64 = {
+		UINT64_C(0x9c6c3a0000000000), UINT64_C(0x948c94a546956a81), UINT64_C(0x6f30d251184c0615),
+		UINT64_C(0x6689c96e1a3b342d), UINT64_C(0xc9141947c7ecea13), UINT64_C(0xfb480dbc6c4a3af6),
+		UINT64_C(0xe251b8cc598876d1), UINT64_C(0xb3c65a99440f86f5), UINT64_C(0x9d693700000000b5),
+		UINT64_C(0x8a5b4cd11593a210), UINT64_C(0xda584cc5ad40a930), UINT64_C(0x853d1ae1d9860dc6),
+		UINT64_C(0xe698f1e36b4d3115), UINT64_C(0x690cd06b4f8576ed), UINT64_C(0x7565eac842447a12),
+		UINT64_C(0xcddede2561a69831), UINT64_C(0xa26a36000000016b), UINT64_C(0x226c28b279f92526),
+		UINT64_C(0x11976ce57b42854a), UINT64_C(0x506e07966e0f53a5), UINT64_C(0x936515890c7a5be3),
+		UINT64_C(0x85808d4ea34d00a8), UINT64_C(0x888417aed4c48146), UINT64_C(0xf479fc3a23f58706),
+		UINT64_C(0x9760310000000222), UINT64_C(0xe9ddbf1aead1dd02), UINT64_C(0x65169c3170e206ab),
+		UINT64_C(0x1f1a0788438f4664), UINT64_C(0x8f73ebd15767167d), UINT64_C(0xe88c515e8d80156e),
+		UINT64_C(0x4aa9716a0121b0f6), UINT64_C(0x6a4e66c35ca47db2), UINT64_C(0x9e6c3800000002d2),
+		UINT64_C(0xe928601714074662), UINT64_C(0xd846da114c633556), UINT64_C(0x2a2697047a3f508c),
+		UINT64_C(0xa809e0c6a7ad4db0), UINT64_C(0x67832ef20c8125c0), UINT64_C(0x5d5e344d3458f99a),
+		UINT64_C(0x79edf980dd3656ae), UINT64_C(0x6565360000000387), UINT64_C(0xb5a5bb6278d00098),
+		UINT64_C(0xc5b312a892eda218), UINT64_C(0x02cbe2b5c0ab5aa0), UINT64_C(0xff00ce4adfad8997),
+		UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+	};
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[8];
+
+	aeshash4(key, keylen, UINT64_C(0xb03e0c64353d0cd), (uint32_t*)h);
+
+	h[0] = h[0] % 1240;
+	h[1] = h[1] % 1240;
+	h[2] = h[2] % 1240;
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 1240;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return base_rank;
+}
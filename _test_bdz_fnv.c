@@ -0,0 +1,79 @@
+/* generated with rurban/nbperf 08a5797 -fp _words1000 */
+/* seed[0]: 198677718, seed[1]: 2 */
+#include <stdint.h>
+#include "fnv3.h"
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint64_t g[48] NBPERF_ALIGN64 = {
+		UINT64_C(0x9863320000000000), UINT64_C(0xb2e8f2dd5848b963), UINT64_C(0x0b4c297a9c93c414),
+		UINT64_C(0xad3aef92eb6c0952), UINT64_C(0x1c3f91362bd496a6), UINT64_C(0xc4225e55c256dc29),
+		UINT64_C(0xa85f851a14027beb), UINT64_C(0x50516aa11a35968d), UINT64_C(0x9d663400000000b6),
+		UINT64_C(0x2be6f2ac88b6857e), UINT64_C(0x0762e224caa80130), UINT64_C(0xe5ed1de2a58ba83e),
+		UINT64_C(0xc598c305aa600bec), UINT64_C(0x36640a630011f6e8), UINT64_C(0x24623c514b88244e),
+		UINT64_C(0x929ad2964fd31242), UINT64_C(0x9c6935000000016e), UINT64_C(0x2cab60a0b4229a2a),
+		UINT64_C(0xa7fcb51c144add68), UINT64_C(0xd0304012abb06f86), UINT64_C(0xdf86a55d83c21589),
+		UINT64_C(0xe93cb64005e4e61b), UINT64_C(0x505c0e37953205d9), UINT64_C(0xd5bddac477495446),
+		UINT64_C(0x9b67320000000223), UINT64_C(0x46b65ae36c1b6823), UINT64_C(0xafc79e411523e9ea),
+		UINT64_C(0x35a56d59ded28a6d), UINT64_C(0x1a9432b5016f108e), UINT64_C(0xe01d235b250b2daa),
+		UINT64_C(0xd0b689c540dcb11a), UINT64_C(0xabbdad4dcfc87726), UINT64_C(0x98622c00000002d3),
+		UINT64_C(0xff7328fedb712d74), UINT64_C(0xa5a0f0854a97007f), UINT64_C(0xfb4f222b8c905972),
+		UINT64_C(0xb803086602201808), UINT64_C(0x557a41d9c9942dc2), UINT64_C(0x611c6caa9ce9174a),
+		UINT64_C(0xb65ade187119fa2d), UINT64_C(0x6868340000000384), UINT64_C(0x3cb19593a170083c),
+		UINT64_C(0x61b2741835e0b801), UINT64_C(0x2248052c0c397155), UINT64_C(0xff00af6e0254a0b9),
+		UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+	};
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[8];
+
+	fnv3(key, keylen, UINT64_C(0x20bd794d6), (uint64_t*)h);
+
+	h[0] = h[0] % 1240;
+	h[1] = h[1] % 1240;
+	h[2] = h[2] % 1240;
+	h[1] ^= (h[0] == h[1]);
+	h[2] ^= (h[0] == h[2] || h[1] == h[2]);
+	h[2] ^= 2 * (h[0] == h[2] || h[1] == h[2]);
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 1240;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return base_rank;
+}
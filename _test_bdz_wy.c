@@ -0,0 +1,356 @@
+/* generated with rurban/nbperf 08a5797  _words */
+/* seed[0]: 1804289383, seed[1]: 846930886 */
+#include <stdint.h>
+#include "mi_wyhash.h"
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint64_t g[888] NBPERF_ALIGN64 = {
+		UINT64_C(0xa36f380000000000), UINT64_C(0x2a4d822045886b6f), UINT64_C(0x228624a6fac44953),
+		UINT64_C(0x90e8b95919445540), UINT64_C(0x198d179477b010bd), UINT64_C(0x2b43b017a068e0d0),
+		UINT64_C(0x8744c72225cde802), UINT64_C(0x91a58035269369f7), UINT64_C(0xa26d3900000000be),
+		UINT64_C(0x2a07b11961f12257), UINT64_C(0x5809a80c40606740), UINT64_C(0xede2e4203f5f1003),
+		UINT64_C(0xa450295b0502a96c), UINT64_C(0x8118252fb6c86e74), UINT64_C(0x69a3267c4e8426b6),
+		UINT64_C(0x02072a202f801aed), UINT64_C(0x9f6735000000017b), UINT64_C(0x0a7a786c6e0e9e10),
+		UINT64_C(0xcdda824a994a7318), UINT64_C(0x1820cf1a43dcf55d), UINT64_C(0x055037b892f0128a),
+		UINT64_C(0x1c0a467500b1a251), UINT64_C(0xa7364795ca3522a9), UINT64_C(0x285f0221cd01a912),
+		UINT64_C(0x9e65330000000236), UINT64_C(0xa8c066b8f63a1b62), UINT64_C(0x00e11ad6558fb1f1),
+		UINT64_C(0x371100833205f041), UINT64_C(0x09d90cec95a3c339), UINT64_C(0x4ed4a4f52254561e),
+		UINT64_C(0x851a027498a64617), UINT64_C(0x1568ba524567799f), UINT64_C(0xac763800000002ef),
+		UINT64_C(0x8c11225f46b62225), UINT64_C(0x68e834ad6c846516), UINT64_C(0x9181156644b40156),
+		UINT64_C(0xaa51621621c56482), UINT64_C(0xf4c5c57a0898caa1), UINT64_C(0xe5264a4171a6d1ad),
+		UINT64_C(0x62f3438874d54ed4), UINT64_C(0x96653600000003b3), UINT64_C(0xf2df49df9446138e),
+		UINT64_C(0x05aa1550a6995682), UINT64_C(0x2f0f37890bbcd6a4), UINT64_C(0x7598b51f84896db3),
+		UINT64_C(0x6b7a4aed1f763457), UINT64_C(0x198828b6436dc93e), UINT64_C(0xa1b5388d6a25208c),
+		UINT64_C(0xa56c330000000465), UINT64_C(0x5c2c3004b8b00965), UINT64_C(0x7d1803e5347daa2c),
+		UINT64_C(0x481d94729f462a1b), UINT64_C(0x0152f14001026509), UINT64_C(0x45845b48006b070e),
+		UINT64_C(0x247a01b280389604), UINT64_C(0x9f30bc1125752958), UINT64_C(0x9d66380000000524),
+		UINT64_C(0xa60aea818a1e199c), UINT64_C(0xe0c71a4d989465d6), UINT64_C(0x975af09e21d76f89),
+		UINT64_C(0x340e8355fbf73162), UINT64_C(0x88e06ac1e4825603), UINT64_C(0xd2f828640321c115),
+		UINT64_C(0x1c2234a06d298796), UINT64_C(0xa16a3400000005dd), UINT64_C(0xcb47d5c3303441a0),
+		UINT64_C(0xe8a9d0150d84e088), UINT64_C(0xe423d56155599401), UINT64_C(0xfd6d28855918e36b),
+		UINT64_C(0xdd0e9866758681a2), UINT64_C(0x59a0679e74664d76), UINT64_C(0x6820519e674a9a8c),
+		UINT64_C(0x946036000000069b), UINT64_C(0xba256e724ac8566a), UINT64_C(0xb648b0c704188e2c),
+		UINT64_C(0xf1f5deb4a863df9a), UINT64_C(0x9fb956484f7d8fec), UINT64_C(0x98485a78a29c1077),
+		UINT64_C(0x3b8a0607ab6f158f), UINT64_C(0xa66a6511a2a57a04), UINT64_C(0xa67037000000074e),
+		UINT64_C(0x50a3114393a35ca2), UINT64_C(0xa4ed936494706521), UINT64_C(0x29420e17b0849324),
+		UINT64_C(0xa22567ae86182534), UINT64_C(0x2b00afb294b95620), UINT64_C(0x8de2228dd0226324),
+		UINT64_C(0x3004931a528d3aa2), UINT64_C(0xa66d340000000810), UINT64_C(0x123aa67aad50d801),
+		UINT64_C(0xdbaa19ab4af2fe42), UINT64_C(0x7164a4b9d4371ba0), UINT64_C(0x5286601a5991d612),
+		UINT64_C(0x959d2206686d588a), UINT64_C(0xc46937a830a95701), UINT64_C(0xb199cb90bd4b2605),
+		UINT64_C(0xa36d3a00000008d0), UINT64_C(0x4298021380939a20), UINT64_C(0x5cda35995a648e60),
+		UINT64_C(0x433f411e93435e31), UINT64_C(0x692550c1964e2d43), UINT64_C(0x08c5a4213978080c),
+		UINT64_C(0xb1376a36dae66884), UINT64_C(0xbdf7e5490f828dac), UINT64_C(0x9d68350000000989),
+		UINT64_C(0xb9c1341228173208), UINT64_C(0x2378a838a182b78e), UINT64_C(0xd14273e163307023),
+		UINT64_C(0x2583a876a11d6d4b), UINT64_C(0x0b054a0c742d8eae), UINT64_C(0x6d04057a04d20e1c),
+		UINT64_C(0x4af72464bb168824), UINT64_C(0xa16a340000000a41), UINT64_C(0xcae54a64871210b9),
+		UINT64_C(0x751faf0ab74e958a), UINT64_C(0x8b1e30942391a534), UINT64_C(0x136cb9ac6540b141),
+		UINT64_C(0x1add62d544d8aa09), UINT64_C(0x36240a909be8346e), UINT64_C(0xb431d084814040d5),
+		UINT64_C(0xa16c380000000afe), UINT64_C(0xc2aa5716604bc9a2), UINT64_C(0x490a7648c055467b),
+		UINT64_C(0x3ed5a5785d44222c), UINT64_C(0xa4fd8b6985d32a56), UINT64_C(0x53a7051391ee4041),
+		UINT64_C(0xe4e087046688bbe1), UINT64_C(0x2af080e37a862694), UINT64_C(0x9a65320000000bba),
+		UINT64_C(0x0704b12bb92c04ba), UINT64_C(0xaccb91d3632e2578), UINT64_C(0x890dd5590e45a41b),
+		UINT64_C(0x394a3fd22c41f4d1), UINT64_C(0xbd213e737d252098), UINT64_C(0x53ca819586048759),
+		UINT64_C(0xb00da5925b820866), UINT64_C(0xa66f360000000c71), UINT64_C(0xae22e920633e0b1a),
+		UINT64_C(0x132d184e51525076), UINT64_C(0x40235c191b5d64bc), UINT64_C(0x092066545a706061),
+		UINT64_C(0x00628891a8c66b82), UINT64_C(0x265d04f17c31908d), UINT64_C(0x0d99670166880ad2),
+		UINT64_C(0x9e6a360000000d34), UINT64_C(0xb2b461ad509b8707), UINT64_C(0xc571282685129cd9),
+		UINT64_C(0xfb55c6b12eb8424d), UINT64_C(0x8453e697609e9468), UINT64_C(0xab0aa8606ec51cf3),
+		UINT64_C(0x68de94a567528f06), UINT64_C(0x8dea619b2bc98d54), UINT64_C(0xae733e0000000dec),
+		UINT64_C(0x4802d54155709085), UINT64_C(0x556948aa65961069), UINT64_C(0x9c28ee191a7915c8),
+		UINT64_C(0x8d122c06c2ea31c4), UINT64_C(0x485a089504262e08), UINT64_C(0x1e641611568170f8),
+		UINT64_C(0x0ed971e4407a3231), UINT64_C(0xa46c340000000eb3), UINT64_C(0xf0670d85a7313a86),
+		UINT64_C(0x71141e84227d10b5), UINT64_C(0x9b04303812932400), UINT64_C(0x9a04555b32b1a56e),
+		UINT64_C(0xabe885e12960b562), UINT64_C(0x6179161d465755d2), UINT64_C(0x38029b507668e1df),
+		UINT64_C(0xa06b380000000f70), UINT64_C(0x10a39eb9946b9994), UINT64_C(0xc29284bc109ad21a),
+		UINT64_C(0xc406c751964e85b5), UINT64_C(0x3892de32d0d481f5), UINT64_C(0xa6b8a00864d0d95a),
+		UINT64_C(0x6938fe5c563f6190), UINT64_C(0xe68280460950566c), UINT64_C(0xa27035000000102e),
+		UINT64_C(0x5cb7a1da872b2186), UINT64_C(0x67131ce960ad8aa0), UINT64_C(0x02668562a41a9626),
+		UINT64_C(0xb2233ac41048217a), UINT64_C(0x98e1982f571b7664), UINT64_C(0xbe236d43d3860b69),
+		UINT64_C(0x9d6554a8663a2dc9), UINT64_C(0xa56f3900000010ec), UINT64_C(0x95c24e0c52456263),
+		UINT64_C(0xb06a8a5029825f25), UINT64_C(0xba49866217f04950), UINT64_C(0xa7f2a08c92321c91),
+		UINT64_C(0xcaecf9aa90124214), UINT64_C(0x9904239a84d0c79d), UINT64_C(0xa04723847fd98d2d),
+		UINT64_C(0xa06e3700000011a9), UINT64_C(0xff5b160252725862), UINT64_C(0xfc121a0421665a60),
+		UINT64_C(0x1b214b132d15ca1f), UINT64_C(0x891d94a996818063), UINT64_C(0xc68945fc02f64faa),
+		UINT64_C(0xf606416d1ac3ac18), UINT64_C(0x5436132649e05618), UINT64_C(0xa26a350000001266),
+		UINT64_C(0x6f110d52a1cb0c9c), UINT64_C(0xeb60220cd9120626), UINT64_C(0x8df4cef61802c4d0),
+		UINT64_C(0x24064b546660a047), UINT64_C(0x4984a050689a4d79), UINT64_C(0xd6d6e7004a4aacb4),
+		UINT64_C(0x0a8310505a3f8118), UINT64_C(0xa16c3b0000001324), UINT64_C(0x5671c552a089724a),
+		UINT64_C(0x231e269464848a54), UINT64_C(0x8a669b3379244ff3), UINT64_C(0xc09a663a1ed80738),
+		UINT64_C(0xe20cdfd492460531), UINT64_C(0x694a4fa366876250), UINT64_C(0xd9d8208b4d0cb21e),
+		UINT64_C(0xa7733800000013de), UINT64_C(0x99522e420afb7130), UINT64_C(0x6535558a25421839),
+		UINT64_C(0x044954596da0e66d), UINT64_C(0x9c0b549a112a2110), UINT64_C(0xa8a4355e562ee808),
+		UINT64_C(0xca420ba60ece799f), UINT64_C(0xcdba1f17c1e0da10), UINT64_C(0xa17035000000149c),
+		UINT64_C(0x5aa2944a5d31e041), UINT64_C(0x000dd1c7a2f0d0b6), UINT64_C(0x20455a886236aa8b),
+		UINT64_C(0x22847461858c8ae2), UINT64_C(0xc40e605fb4963315), UINT64_C(0xbca305f1d5c07129),
+		UINT64_C(0x81c587b84c0140ef), UINT64_C(0x9768330000001556), UINT64_C(0x0468a01a61edbbc7),
+		UINT64_C(0x9095c0343937b05b), UINT64_C(0x6db95620791003ae), UINT64_C(0x95adfa1048a0dd79),
+		UINT64_C(0x4623c7b3889d82f8), UINT64_C(0x48dbfee09ad72e59), UINT64_C(0x405bc15446cddc51),
+		UINT64_C(0xa469330000001607), UINT64_C(0x935b827b0a1ea59c), UINT64_C(0x6a5fc48a5f1b49b4),
+		UINT64_C(0xda0d82ec8b6da36c), UINT64_C(0x4835811121a25203), UINT64_C(0x9854872929419d74),
+		UINT64_C(0x85ad265a6052648b), UINT64_C(0x8c12d4c531240542), UINT64_C(0xa1683400000016c7),
+		UINT64_C(0xea175330d19bc665), UINT64_C(0x296523887c4d3940), UINT64_C(0x140b7c57048830dc),
+		UINT64_C(0x178a861bca9822b3), UINT64_C(0xc255950c35056603), UINT64_C(0xdd6180ea6a0a9191),
+		UINT64_C(0xc1ca8068811a9ce4), UINT64_C(0xa771350000001784), UINT64_C(0x8c54204ea108c928),
+		UINT64_C(0x1034c77873d23911), UINT64_C(0x4c82b4940ae2466a), UINT64_C(0xca484559422a5800),
+		UINT64_C(0x768bed0b8a9e2512), UINT64_C(0x42a17a41e7a6b840), UINT64_C(0x8bf2d29270a8472c),
+		UINT64_C(0xa971390000001844), UINT64_C(0x45053d8ba061a164), UINT64_C(0xa9d25b816955de06),
+		UINT64_C(0x6842e28af195e858), UINT64_C(0x08c457049d3066a0), UINT64_C(0xd4e240ec68482084),
+		UINT64_C(0x10598b8832630301), UINT64_C(0x7e35a29756105519), UINT64_C(0x9e6f3b0000001909),
+		UINT64_C(0xa6432c1186aa8009), UINT64_C(0x49e950185306aad0), UINT64_C(0xe2daf11c211c2c2e),
+		UINT64_C(0x99220a1665a17dbd), UINT64_C(0x7ff356c7c42080f8), UINT64_C(0x273a88ce236d4954),
+		UINT64_C(0x26342a5c48219830), UINT64_C(0xa9713a00000019c4), UINT64_C(0x552826740e881543),
+		UINT64_C(0xf402a18a54c80912), UINT64_C(0xec244e2000cc6c24), UINT64_C(0x7bc12490a6999298),
+		UINT64_C(0x00e610caa7991e20), UINT64_C(0x3159a0629420ccd8), UINT64_C(0x904a7aaad7d81122),
+		UINT64_C(0xa26b350000001a89), UINT64_C(0x420247a53423f410), UINT64_C(0x805eb19c211276c3),
+		UINT64_C(0xa9aea1a04d1c4d60), UINT64_C(0x68ba82a8c39310d7), UINT64_C(0x0309614ae6837619),
+		UINT64_C(0x954c66dd24a67a1b), UINT64_C(0x142a855a665786cd), UINT64_C(0xa472360000001b48),
+		UINT64_C(0x67273e3913e80a89), UINT64_C(0x19daa7886528986e), UINT64_C(0xa359099464109048),
+		UINT64_C(0x592a14ab486a40ee), UINT64_C(0xa2ad88f9419421c4), UINT64_C(0x4fed8d7277334011),
+		UINT64_C(0x644529a96e98ae0a), UINT64_C(0x9b62310000001c0a), UINT64_C(0x766e0a5449c5cd0b),
+		UINT64_C(0x73931c70293d557b), UINT64_C(0x08969045e7273872), UINT64_C(0x483ddb4ef6269fe5),
+		UINT64_C(0xa261bc92d32a0a55), UINT64_C(0x6248ea68403192c6), UINT64_C(0x0ab26a83b91b5d59),
+		UINT64_C(0xa06e370000001cc0), UINT64_C(0x5790411dcc1429a5), UINT64_C(0x224880967f8cc84a),
+		UINT64_C(0x02112d78a1624448), UINT64_C(0x86d27547cc926dd4), UINT64_C(0xafa50f1c1ed5390c),
+		UINT64_C(0x81a92464397b0ac3), UINT64_C(0xbae88a13f9016649), UINT64_C(0xa36f360000001d7b),
+		UINT64_C(0x76966694f410871a), UINT64_C(0x05c86b7356a2746c), UINT64_C(0x91181c5a9a8ecb6a),
+		UINT64_C(0x9d5a263aba99a966), UINT64_C(0x602aa78a1ee6d5fe), UINT64_C(0x9c42f4572d855848),
+		UINT64_C(0x0011847527d02c49), UINT64_C(0x9f6b340000001e3a), UINT64_C(0xc6978c8bc0469cba),
+		UINT64_C(0xf6ccc8aa04110445), UINT64_C(0xcc6099e219a04a2e), UINT64_C(0x14f10514238c4053),
+		UINT64_C(0x48c5d4230c9a6d86), UINT64_C(0x580205b4f9e4075f), UINT64_C(0xe199edf3b13d3422),
+		UINT64_C(0xa069330000001eef), UINT64_C(0x6a0b237dbacd5d42), UINT64_C(0x2cc2782c4184879a),
+		UINT64_C(0xa95e39558287b148), UINT64_C(0x27588d399378a078), UINT64_C(0x4044c38121e25be1),
+		UINT64_C(0x1664e2493b24b601), UINT64_C(0x1f5214e80ffded80), UINT64_C(0xa26c340000001fa5),
+		UINT64_C(0xb707a0b3cad09643), UINT64_C(0x785982ed09520193), UINT64_C(0x24669844274a1434),
+		UINT64_C(0x140372d1460812bf), UINT64_C(0x125ecbca92cbc9ca), UINT64_C(0xa44136161e44a148),
+		UINT64_C(0x75473c54a9368ada), UINT64_C(0xa6743e0000002061), UINT64_C(0x9ae8009688054204),
+		UINT64_C(0x9a94a9828444605d), UINT64_C(0x12d8351c464a9da4), UINT64_C(0x1e5b9f388e861860),
+		UINT64_C(0x4df12a06472f4b08), UINT64_C(0xe022b611186f79d3), UINT64_C(0xe29a1645e9323611),
+		UINT64_C(0xa06e360000002123), UINT64_C(0x1515beaa8e094dd3), UINT64_C(0xb742b960d1850881),
+		UINT64_C(0x0c2494c011792974), UINT64_C(0x9297babaa99902c0), UINT64_C(0xc76c1032faa5acf9),
+		UINT64_C(0xe36839a462c4089c), UINT64_C(0x53a52c48c43e9312), UINT64_C(0xa06c3300000021dd),
+		UINT64_C(0x1e268fbb73d54663), UINT64_C(0x174a35a625e70492), UINT64_C(0x930bd9554adb4194),
+		UINT64_C(0x4cd0152851054808), UINT64_C(0x603a7ca800a156d2), UINT64_C(0xd293010dd6ee07e6),
+		UINT64_C(0x40985045ea45b61e), UINT64_C(0xa46b38000000229a), UINT64_C(0x925c147aa5a43862),
+		UINT64_C(0x29852d7253d36060), UINT64_C(0x917bf728346a0198), UINT64_C(0xf881e28633442c17),
+		UINT64_C(0x0105494bb9e5c018), UINT64_C(0x654f12ab50081164), UINT64_C(0x96d3b779e0352491),
+		UINT64_C(0xa470370000002357), UINT64_C(0x550256a84c10b1e8), UINT64_C(0xb4e6bce10aea2125),
+		UINT64_C(0xb1524a4b4c065990), UINT64_C(0xd210826b3391450a), UINT64_C(0x7f54249ac84dd244),
+		UINT64_C(0xb6a1e05608e4fa5e), UINT64_C(0xf99f2891006039d2), UINT64_C(0xa26b360000002415),
+		UINT64_C(0xd702e793490950e6), UINT64_C(0x27172842318689c4), UINT64_C(0x6cce24b5624ca4e8),
+		UINT64_C(0x0648529f15930a2f), UINT64_C(0x3d86a0aa38984572), UINT64_C(0x4584d07c95f51485),
+		UINT64_C(0x05921388ace9b9d7), UINT64_C(0x9e693700000024d1), UINT64_C(0x00a0743234c05146),
+		UINT64_C(0x56c3e29baaa0d840), UINT64_C(0x3cf6e0b6fbb0a498), UINT64_C(0x04812118c612ced1),
+		UINT64_C(0xe481bb0499473453), UINT64_C(0x06b10dcc19489e20), UINT64_C(0x4dc150851ee0508f),
+		UINT64_C(0xa36c380000002589), UINT64_C(0x5a5924718c380669), UINT64_C(0xe640a1bd6c584ac6),
+		UINT64_C(0x69e59f04f02e6228), UINT64_C(0x1d126ed6529be59c), UINT64_C(0x28d29986269a2a09),
+		UINT64_C(0x9e235b0fabb96e22), UINT64_C(0xe14795852290606e), UINT64_C(0xa268330000002649),
+		UINT64_C(0x85c2307e6c42e3f4), UINT64_C(0x9418c2a2ad80ce88), UINT64_C(0x32002a6ced2d68f6),
+		UINT64_C(0x465ea07029d6b629), UINT64_C(0x910a26973b8425a8), UINT64_C(0x52a54e828e06a163),
+		UINT64_C(0xe13f0057057e5a50), UINT64_C(0xa1713a0000002704), UINT64_C(0x921218861a56c599),
+		UINT64_C(0xb922a69520f34344), UINT64_C(0x080a5e44b4b2f2d2), UINT64_C(0x924c26ad1da21450),
+		UINT64_C(0xa878dad10cb0f7e8), UINT64_C(0xdcce675c22a9559e), UINT64_C(0x47913141c3e92392),
+		UINT64_C(0xa7723600000027bf), UINT64_C(0x8053b23941ac9707), UINT64_C(0x8087d954c01257a4),
+		UINT64_C(0x0086204e81113444), UINT64_C(0x2c491021181c9800), UINT64_C(0x3c1e591856db24e7),
+		UINT64_C(0x90515eda2d81d025), UINT64_C(0x94b2aaae20ca701a), UINT64_C(0x9a63310000002882),
+		UINT64_C(0x0cefe2e8921719a8), UINT64_C(0x322234acf8d11731), UINT64_C(0x4239f50a850850ee),
+		UINT64_C(0x39410de7c524b03f), UINT64_C(0x08198e93ae886802), UINT64_C(0x7cb880496650fb41),
+		UINT64_C(0x68b564e0898f7948), UINT64_C(0xa56d370000002937), UINT64_C(0x90919283db9acf88),
+		UINT64_C(0x2801b58953212517), UINT64_C(0x8d434d98450549ae), UINT64_C(0x9a4678347a45fad4),
+		UINT64_C(0xe68983aaac40229c), UINT64_C(0x8a616d755512f010), UINT64_C(0x7309283c85237daf),
+		UINT64_C(0xa7723a00000029f3), UINT64_C(0x07f1d2540b21a442), UINT64_C(0x4020809119017a20),
+		UINT64_C(0x1127200ab1728914), UINT64_C(0x54bd229e15d0a350), UINT64_C(0x785f00ec600948f8),
+		UINT64_C(0xb604359eaa24a971), UINT64_C(0xdb28d08db213c82d), UINT64_C(0x9e68350000002ab2),
+		UINT64_C(0x74008b10a82158f0), UINT64_C(0x4f78c88d0529a3c5), UINT64_C(0x9f1c918c7541e318),
+		UINT64_C(0xb922ed7c91848032), UINT64_C(0x96acac02a51a0a30), UINT64_C(0xb4cd20925c58b74d),
+		UINT64_C(0x51c20513377a6d3f), UINT64_C(0xa16b370000002b67), UINT64_C(0x66506c7b490d8166),
+		UINT64_C(0x841382e24e1e19a3), UINT64_C(0x0d2a9813d340ce58), UINT64_C(0x5a1895b018f4f463),
+		UINT64_C(0xd653f56469452756), UINT64_C(0x9313b6609a220f46), UINT64_C(0x1e86acf1e88a32ed),
+		UINT64_C(0x9b64320000002c20), UINT64_C(0xd676048869486431), UINT64_C(0x387f4c27ad43fe84),
+		UINT64_C(0xc6bb24103a4d3be1), UINT64_C(0xf898fb5729896a61), UINT64_C(0x0518627272b59442),
+		UINT64_C(0xb1a823b17a6b68ea), UINT64_C(0x4dc4048861124fcf), UINT64_C(0x9e69370000002cd4),
+		UINT64_C(0xb0067a9aab454691), UINT64_C(0x25772b045d94acc0), UINT64_C(0xea239b87cc8acea8),
+		UINT64_C(0xd80363b30b9a6181), UINT64_C(0xedde094913636b3b), UINT64_C(0x85303654a0862885),
+		UINT64_C(0xa9b2b9e04c2ba998), UINT64_C(0xa16e380000002d8d), UINT64_C(0x05ed4a510b0466e9),
+		UINT64_C(0x50c9e75b459668a2), UINT64_C(0x17bf80a28ea3d4af), UINT64_C(0x255555a964609557),
+		UINT64_C(0x2e11d1184af790b9), UINT64_C(0xd8a10dc9674ba778), UINT64_C(0xa12e641516a9e598),
+		UINT64_C(0xaa723c0000002e4c), UINT64_C(0x712a96d8644aaa49), UINT64_C(0x24a52878220625da),
+		UINT64_C(0x9e1a251b6502dcc2), UINT64_C(0x5f931b9446008531), UINT64_C(0xb248e5d69d020241),
+		UINT64_C(0x8b004a9c2d995935), UINT64_C(0x5d65380e6c51b937), UINT64_C(0xa16b340000002f0f),
+		UINT64_C(0x4b46af586e87c419), UINT64_C(0x4d12901803372c4b), UINT64_C(0xb282a53c248ce72a),
+		UINT64_C(0x60c5e20866310814), UINT64_C(0xd16c899298503cb1), UINT64_C(0x212123f6d510e9a4),
+		UINT64_C(0xd4d84ab124a23a04), UINT64_C(0xa56d370000002fcc), UINT64_C(0x157256252404817c),
+		UINT64_C(0x4cc25b986a4deda9), UINT64_C(0x60cc7287181951b6), UINT64_C(0x50b31998a67f8a19),
+		UINT64_C(0x60d1126599456309), UINT64_C(0x2be285df5611e1a6), UINT64_C(0x4c555a6e74e52885),
+		UINT64_C(0x9c6632000000308d), UINT64_C(0x326905ce4f0710a7), UINT64_C(0xc1316a6bd5a4a6fc),
+		UINT64_C(0x7326849ae0dac666), UINT64_C(0x1509a3a88f778f22), UINT64_C(0xcfc16195d98a9507),
+		UINT64_C(0x70a19c2202668d38), UINT64_C(0x24d185102023494b), UINT64_C(0x9b6a350000003146),
+		UINT64_C(0x7056b99bb8985f11), UINT64_C(0xb2a88cda37494092), UINT64_C(0x13073145748532b5),
+		UINT64_C(0x328a6058a7c117d5), UINT64_C(0x643ecb0cf5126dad), UINT64_C(0x1042c2e84b3581c3),
+		UINT64_C(0x454411d82cdb8153), UINT64_C(0x9e693400000031fc), UINT64_C(0x4997363549e5a4a5),
+		UINT64_C(0xec0097b1b5cb8320), UINT64_C(0x650897b3127f24a8), UINT64_C(0x9bd4a54c08b93619),
+		UINT64_C(0x4e8288311943dce6), UINT64_C(0x9873d1ab38181015), UINT64_C(0x3402bc1b54e2ea19),
+		UINT64_C(0x9d673100000032b4), UINT64_C(0xbd7b2085209d3d3c), UINT64_C(0x5522ce21f2446b13),
+		UINT64_C(0xe709912996828997), UINT64_C(0x87432fe9030b29a8), UINT64_C(0x41edaa6a1118d97a),
+		UINT64_C(0x284b217f88559d93), UINT64_C(0x8025b22d9b51c102), UINT64_C(0x9c6a36000000336d),
+		UINT64_C(0x47342022abc9b12e), UINT64_C(0xaad0abc945064e41), UINT64_C(0x898b9647b3d13171),
+		UINT64_C(0x17796a43a0789eaa), UINT64_C(0xb47ebd64ce267164), UINT64_C(0x4f44624cd6d65236),
+		UINT64_C(0x406c618e248693e6), UINT64_C(0x9464350000003425), UINT64_C(0x84e0800121660491),
+		UINT64_C(0x4e7ee49114ccbf27), UINT64_C(0x2358325f666272b9), UINT64_C(0x81ff9b92e02df7a3),
+		UINT64_C(0xe4c038dec9ae3f9e), UINT64_C(0x73a098f228161e86), UINT64_C(0x02244ed7d59676f0),
+		UINT64_C(0x955e3700000034d2), UINT64_C(0x6ae64c660ca0a534), UINT64_C(0x49bad6863818c8c0),
+		UINT64_C(0x84c677cf80e5cbee), UINT64_C(0x3191f8d3f3f8e2fb), UINT64_C(0xc00a822523e8fd21),
+		UINT64_C(0x789c3182140a5096), UINT64_C(0x61424b742db5d8ca), UINT64_C(0x935e320000003581),
+		UINT64_C(0x4518de59fbc139c3), UINT64_C(0x9a4c6506f857995b), UINT64_C(0x33bc3af0d0548793),
+		UINT64_C(0x80f48debf7d10d45), UINT64_C(0xe5180c49847c2f36), UINT64_C(0x1b02e02b249b2620),
+		UINT64_C(0xe2d7f80c189de304), UINT64_C(0x85582a000000362b), UINT64_C(0xc745fb14b0d934ef),
+		UINT64_C(0xdb38ade48e9f34d7), UINT64_C(0x7d13a29f5884350c), UINT64_C(0xb331f39367e3daa1),
+		UINT64_C(0xcbd6ebd915ce339b), UINT64_C(0x40f8748206cdbd23), UINT64_C(0x2592592073acc708),
+		UINT64_C(0x87562e00000036cb), UINT64_C(0xc3c4c3eae2a2f1da), UINT64_C(0x891542d46bfc3d5c),
+		UINT64_C(0x90d6fc07fb78b5ec), UINT64_C(0xdec77dcd109cacaf), UINT64_C(0xf7ab284c5e407ba0),
+		UINT64_C(0x98aecd4fa61510f8), UINT64_C(0xb63ce898a5ba86ae), UINT64_C(0x936236000000376c),
+		UINT64_C(0xd51e50244223a864), UINT64_C(0xf905405c8f8f1994), UINT64_C(0xfea37b24155dc6f2),
+		UINT64_C(0x6ee9c6fc4b9a2fba), UINT64_C(0x48ce3dd3276e74ee), UINT64_C(0x2462fc4745251110),
+		UINT64_C(0x35766e5e3ff94347), UINT64_C(0x8c60320000003814), UINT64_C(0xf384dd4804fb559b),
+		UINT64_C(0x14a6053ad706a633), UINT64_C(0x7a7393e1b9f59620), UINT64_C(0xe567a0abbbe5cedb),
+		UINT64_C(0xd12bf16d0cdaffb7), UINT64_C(0x128e2985ceaf1f88), UINT64_C(0xb226b9532057b006),
+		UINT64_C(0x885e3000000038bb), UINT64_C(0xeb505c6c21f2d37c), UINT64_C(0x8bbc0660bbd5a948),
+		UINT64_C(0x495c00ca705514ff), UINT64_C(0x92c1ca07de0bffb1), UINT64_C(0x387c5fb7ec66deb7),
+		UINT64_C(0x87b312ecd5343359), UINT64_C(0x40c9b9c7114e8067), UINT64_C(0x8d5a2d000000395d),
+		UINT64_C(0xc393ebc69b153202), UINT64_C(0x7be31f13ca04735b), UINT64_C(0xee7f448abc1446e7),
+		UINT64_C(0x89fcf1af032e4c62), UINT64_C(0x512e61f312805522), UINT64_C(0x7760a80c31bcc533),
+		UINT64_C(0xad438c7a5ea25b1f), UINT64_C(0x8b5b2d0000003a02), UINT64_C(0xfdb40370fabebbc0),
+		UINT64_C(0x00871b8319783907), UINT64_C(0x236c36e71a9bb10f), UINT64_C(0xeb521e33576cd10e),
+		UINT64_C(0xc0d3b4290a28c506), UINT64_C(0x10b89bff009fb5ed), UINT64_C(0x53a5b0a29e5275a2),
+		UINT64_C(0x97682f0000003aa9), UINT64_C(0xb14eb7fd3aacd809), UINT64_C(0x10284d1c3e4d28ed),
+		UINT64_C(0xc920a4ac640d7a08), UINT64_C(0x304a916aa40420bd), UINT64_C(0x7e1bdf659a668dc7),
+		UINT64_C(0x887307925badb00f), UINT64_C(0xe1f65ebe5ad3c3dc), UINT64_C(0x855b2b0000003b54),
+		UINT64_C(0xbd637d3ee4f1b5f6), UINT64_C(0x1255b530ceb4d743), UINT64_C(0x26657721937cdc79),
+		UINT64_C(0xa404a4f87d1edcca), UINT64_C(0x59a283fb54deffed), UINT64_C(0xbb1e2370f07f0142),
+		UINT64_C(0x3791f71643090456), UINT64_C(0x935f300000003bf3), UINT64_C(0xb6de5a4f0d2948c6),
+		UINT64_C(0x12db038611dd8bef), UINT64_C(0x0c296f4f5209bb3e), UINT64_C(0x091cc0b96799c4df),
+		UINT64_C(0xd8c4460f2393342b), UINT64_C(0xe46d09d07a58a400), UINT64_C(0x5878cbea0db182c5),
+		UINT64_C(0x9763320000003c9f), UINT64_C(0xe14479736398d007), UINT64_C(0x3293e4a9d58c64be),
+		UINT64_C(0xe3d148f193b3920a), UINT64_C(0x05febc540be55a40), UINT64_C(0x918e7acc4164d2be),
+		UINT64_C(0x74b024128e3ba551), UINT64_C(0x57f467b2e67c7053), UINT64_C(0x9664340000003d4c),
+		UINT64_C(0xc453205e883e2c9e), UINT64_C(0x6cb6068288a8cd5e), UINT64_C(0x8922fefd0f4579ea),
+		UINT64_C(0x3c24a8101ea6f870), UINT64_C(0x97b1cfcaeda80c08), UINT64_C(0x5a5622edb7a34900),
+		UINT64_C(0x8654043ed71f352d), UINT64_C(0x9664340000003dfa), UINT64_C(0x952abe5b45e5cf8d),
+		UINT64_C(0x94fc006a66611ca6), UINT64_C(0x021fdc826123bf66), UINT64_C(0xce3a76c4e8ac241c),
+		UINT64_C(0x05d4c5a19f9b505f), UINT64_C(0xe42927c795a9f82e), UINT64_C(0xf7af14435fd940f9),
+		UINT64_C(0x9866330000003ea5), UINT64_C(0xc61a8ec59894909e), UINT64_C(0xa948d4fe2c21bcf1),
+		UINT64_C(0x8390f0fee1088655), UINT64_C(0x7a569b02ef2a18c1), UINT64_C(0xacd85292d16d833c),
+		UINT64_C(0xc750b85a7b027e50), UINT64_C(0xbb6b84a81434f00a), UINT64_C(0x8e61310000003f57),
+		UINT64_C(0x88cb10d11530ec04), UINT64_C(0x86e373d0ea2b8bc6), UINT64_C(0x11cec39f483b4c32),
+		UINT64_C(0x0f3918d80b466443), UINT64_C(0xc68df3b6c8426867), UINT64_C(0xf35bd1dbc22757ae),
+		UINT64_C(0x588712811a8c426f), UINT64_C(0x9a62330000004001), UINT64_C(0xa29a8e633666d2fc),
+		UINT64_C(0x05458fc30584b71a), UINT64_C(0xce475036592078b9), UINT64_C(0x99f1d7189d729ff7),
+		UINT64_C(0x65411986030695eb), UINT64_C(0x2e538e014bda4a90), UINT64_C(0x1710a929bc22413e),
+		UINT64_C(0x8a5c2a00000040b6), UINT64_C(0x05dc369ef1245e1b), UINT64_C(0xd3ef797e7c8b39db),
+		UINT64_C(0x0e2d31b60d195613), UINT64_C(0xb16eb5314d8be527), UINT64_C(0xe82f11268cd6df0d),
+		UINT64_C(0x9016db301c0337fa), UINT64_C(0x7d481d4f9bc2a274), UINT64_C(0x84572a0000004158),
+		UINT64_C(0x5f6fc1ce370c63ef), UINT64_C(0xb14cbf96ae988b6c), UINT64_C(0x4c62715d4f370539),
+		UINT64_C(0xe834fad7b32fc604), UINT64_C(0x1b3721e8ebebb2ce), UINT64_C(0x8ca353fa8b9d9523),
+		UINT64_C(0x8a0d3a18c7c58018), UINT64_C(0x935f3100000041f7), UINT64_C(0x25605af600e57ce3),
+		UINT64_C(0xea5bf2c783861d95), UINT64_C(0xdff8dcbfc3ccb240), UINT64_C(0xa04540c524a04e93),
+		UINT64_C(0xf9ada1610d750d40), UINT64_C(0x4ace8d794ce52550), UINT64_C(0x0aab337430fa46fc),
+		UINT64_C(0x96643000000042a0), UINT64_C(0xaaee50285e6f8a8b), UINT64_C(0xab01ddd7a9fdbd84),
+		UINT64_C(0xd507bc6099e41643), UINT64_C(0x94693be4f8514a13), UINT64_C(0xb74f598696a82e24),
+		UINT64_C(0xf75eb73090c85d82), UINT64_C(0x50aa30ea006184a2), UINT64_C(0x9865320000004354),
+		UINT64_C(0x6c61beab8452c0ca), UINT64_C(0x0cc473a74006ce6c), UINT64_C(0xe70927983d5d0d96),
+		UINT64_C(0x4eb6a4312a270bb5), UINT64_C(0x3180072d692b5a7d), UINT64_C(0xad1405f701c4b18d),
+		UINT64_C(0x5822e33d9384fa3d), UINT64_C(0x7c56300000004403), UINT64_C(0x1e1ef53715e0d395),
+		UINT64_C(0x2c66b8c4a1df8838), UINT64_C(0xf3df62ffc6fbf907), UINT64_C(0x4fdeb51d5beb16a2),
+		UINT64_C(0x38ddcfd535effb4a), UINT64_C(0xa4efa37e2e3fbd92), UINT64_C(0x0ab0e1eb39f2d8fc),
+		UINT64_C(0x9262350000004494), UINT64_C(0x1cf116742c169edb), UINT64_C(0x2d35ab4440251491),
+		UINT64_C(0x42170dd02a01ee9f), UINT64_C(0xcecd8fe96f40d6f9), UINT64_C(0xe9d28802f059ae4d),
+		UINT64_C(0xad177b637f10329c), UINT64_C(0xfedc0304aa2d7657), UINT64_C(0x875f2b000000453d),
+		UINT64_C(0xacd5743d4ed118f0), UINT64_C(0x3fce1409430fd3dc), UINT64_C(0x008fa95097091db3),
+		UINT64_C(0x5fca161938e46d15), UINT64_C(0xbc7b833a783cd7ff), UINT64_C(0x3c61a8c01d1f9bbb),
+		UINT64_C(0x84186aceeb70967b), UINT64_C(0x93632f00000045dd), UINT64_C(0xf3ba3d1525daa822),
+		UINT64_C(0xfd1398ab3f811dd6), UINT64_C(0x003b0a05c1a3e9d0), UINT64_C(0x81b628d67f45b1a4),
+		UINT64_C(0x07c9eb210f8c89e1), UINT64_C(0x0b7fa820934c3e21), UINT64_C(0x9832408175247fec),
+		UINT64_C(0x8e5f300000004689), UINT64_C(0xcf5634c60e03dc49), UINT64_C(0x116ee6b51b4e4de5),
+		UINT64_C(0xa49609dc6d39bcf4), UINT64_C(0x2f6cba2eb6297787), UINT64_C(0x40bd675c4caa5e4c),
+		UINT64_C(0xd327d42bf34199eb), UINT64_C(0x2113b7db235c3d1d), UINT64_C(0x8f5c30000000472d),
+		UINT64_C(0x1f0fa6a816e702c5), UINT64_C(0x2ed1ea234af6ede1), UINT64_C(0x8852d44f02e5fd64),
+		UINT64_C(0xf8ce5ec4b45dfdbb), UINT64_C(0x5bd4219274870fc0), UINT64_C(0x0b8925b082df6267),
+		UINT64_C(0x6be77a3e044b950e), UINT64_C(0x8d613200000047d4), UINT64_C(0x3be350252a9894d2),
+		UINT64_C(0x4233601f9ced3a38), UINT64_C(0x59a7bfbb9254a774), UINT64_C(0xda35278febc510ab),
+		UINT64_C(0xca81e67b00de2e03), UINT64_C(0x77b1eabf4de58cbd), UINT64_C(0x9c4ea10b0320caf2),
+		UINT64_C(0x8f5d2e000000487a), UINT64_C(0x82b346dafdd367cd), UINT64_C(0xec97e18245c7280c),
+		UINT64_C(0x20d73ae26bb9fddc), UINT64_C(0xf851a6985f6b6839), UINT64_C(0xa7a21aead241a792),
+		UINT64_C(0xcfcd24b57b7c0812), UINT64_C(0xf4aeca218c9c5256), UINT64_C(0x885a300000004923),
+		UINT64_C(0xb0f1e20989f8ca23), UINT64_C(0xcb68703b15240ddc), UINT64_C(0x30bdfca9c560f8d5),
+		UINT64_C(0xc407832820d3fff3), UINT64_C(0x41554f6b79608a70), UINT64_C(0x3ba329f3e73bcabb),
+		UINT64_C(0xecc7d43d75d93d17), UINT64_C(0x92612e00000049bf), UINT64_C(0x3b83aab7ee96128c),
+		UINT64_C(0xb512fabe777034c5), UINT64_C(0x9fce42c8a5263705), UINT64_C(0x024edb367ae20815),
+		UINT64_C(0x1c5af04ff0e1393e), UINT64_C(0x529d1898b67e0190), UINT64_C(0x5931b2bfee41edf6),
+		UINT64_C(0x885e340000004a66), UINT64_C(0xa1965401fcaa680f), UINT64_C(0x760740934c18993f),
+		UINT64_C(0xf282f9793739fd70), UINT64_C(0xfce0939227c2f5e1), UINT64_C(0x1f6feff07b53923e),
+		UINT64_C(0xdaa2e54eb2aa3b1f), UINT64_C(0x149134fa8c84c6af), UINT64_C(0x915e320000004b07),
+		UINT64_C(0xc38d43a26902b59b), UINT64_C(0xcaa8b915cb7cc80e), UINT64_C(0xc8a263e02fc7f121),
+		UINT64_C(0x1f5b4cb2db1eb770), UINT64_C(0x7a3a1d0264f85f24), UINT64_C(0x797720aa50dc080d),
+		UINT64_C(0x10f0e1bf1db53268), UINT64_C(0x8d5c330000004baf), UINT64_C(0x93a09f668401f253),
+		UINT64_C(0x2bcb442f4ee41086), UINT64_C(0xd31e57edf2c5cb3f), UINT64_C(0xe091f77a602e8e6f),
+		UINT64_C(0x26dbcb990acc60e0), UINT64_C(0x3089784c32d9f6d1), UINT64_C(0xa8c4fe3c2d027830),
+		UINT64_C(0x8e61340000004c53), UINT64_C(0xcc06b330900cb572), UINT64_C(0x18b0ca8024a75c86),
+		UINT64_C(0x94dcf59f75d71e61), UINT64_C(0x0eb555fc8a0efd64), UINT64_C(0x424abdafb5cf7de8),
+		UINT64_C(0xac48d85ccc059aef), UINT64_C(0x9cbb106c6d44ca95), UINT64_C(0x9966320000004cfb),
+		UINT64_C(0x6f4a5da12401513b), UINT64_C(0xe2ba5d4d8b8437f5), UINT64_C(0xd60b9c646236d84b),
+		UINT64_C(0x1d895c294600b5fc), UINT64_C(0x1716830d7568fe58), UINT64_C(0x9a8c04369b923d8e),
+		UINT64_C(0xfffde85ee1fbe2ba), UINT64_C(0x7f62340000004da5), UINT64_C(0xecc11d05d91a4d56),
+		UINT64_C(0x0a11b103f1b86d19), UINT64_C(0x018f4e31d918fabb), UINT64_C(0x512d5e7f310a3778),
+		UINT64_C(0xea8e9f7d1946e986), UINT64_C(0xffffffffffffff00), UINT64_C(0xffffffffffffffff),
+	};
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[8];
+
+	mi_wyhash4(key, keylen, UINT64_C(0x327b23c66b8b4567), (uint64_t*)h);
+
+	h[0] = h[0] % 24800;
+	h[1] = h[1] % 24800;
+	h[2] = h[2] % 24800;
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 24800;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return base_rank;
+}
@@ -0,0 +1,76 @@
+/* generated with rurban/nbperf 08a5797 -p _words1000 */
+/* seed[0]: 84, seed[1]: 85 */
+#include <stdint.h>
+#include "mi_wyhash.h"
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint64_t g[48] NBPERF_ALIGN64 = {
+		UINT64_C(0xa66c350000000000), UINT64_C(0xa56214a2b1839d7e), UINT64_C(0x83013b52cd836881),
+		UINT64_C(0x93d85e303e1134e2), UINT64_C(0x1148a6b25aa40592), UINT64_C(0x4502e0207e88780a),
+		UINT64_C(0xa646500040eb9290), UINT64_C(0x093fcd9e518eb7b2), UINT64_C(0x96633200000000bc),
+		UINT64_C(0xcc5e9142201cb901), UINT64_C(0x87baf6c8bec4814d), UINT64_C(0x51840c0961edafdc),
+		UINT64_C(0xc71b170d905cb28d), UINT64_C(0x725805b93187e6f1), UINT64_C(0xa850d627589f7e26),
+		UINT64_C(0x326c92c4c5ea1489), UINT64_C(0x9e6a33000000016d), UINT64_C(0x939722e265d03984),
+		UINT64_C(0x89afc6b42560f36b), UINT64_C(0x5590197c940a2397), UINT64_C(0xa0a17b506636b15d),
+		UINT64_C(0x1af2084161e43a8d), UINT64_C(0x707b54547aae95f1), UINT64_C(0x08538e672a185b00),
+		UINT64_C(0x9c69380000000227), UINT64_C(0x61524e7d9e19e845), UINT64_C(0x6f4065894582d4a5),
+		UINT64_C(0x73a1790b6c763d60), UINT64_C(0x7877a4b16c2842d7), UINT64_C(0x10e27921d523d608),
+		UINT64_C(0xa383921d59dfac1e), UINT64_C(0x254f36de64da9dd3), UINT64_C(0x98633400000002da),
+		UINT64_C(0x87520d82e55f4b81), UINT64_C(0x5688d7d663e59478), UINT64_C(0xe89397cc387922f9),
+		UINT64_C(0x9e9580dbd531f82b), UINT64_C(0x2c44ca46023fa5b9), UINT64_C(0xa98024dd15ca1e4e),
+		UINT64_C(0x27530f187698140d), UINT64_C(0x606033000000038c), UINT64_C(0x5b5aa842422d948b),
+		UINT64_C(0x0fbd76e57d8aaa7c), UINT64_C(0x6c6614c93e3ea9bf), UINT64_C(0xff0087f2f48aa803),
+		UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+	};
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[8];
+
+	mi_wyhash4(key, keylen, UINT64_C(0x5500000054), (uint64_t*)h);
+
+	h[0] = h[0] % 1240;
+	h[1] = h[1] % 1240;
+	h[2] = h[2] % 1240;
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 1240;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return base_rank;
+}
@@ -0,0 +1,274 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 1102520059, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[2048] = {
+	    0x0000, 0x0337, 0x0000, 0x0000, 0x0214, 0x0178, 0x0212, 0x0000,
+	    0x00dd, 0x0251, 0x03c6, 0x0122, 0x01ec, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x00bc, 0x0190, 0x000a, 0x0119,
+	    0x02bb, 0x015f, 0x0000, 0x01c3, 0x0069, 0x015a, 0x0000, 0x0000,
+	    0x027d, 0x0000, 0x0000, 0x0000, 0x02bc, 0x0000, 0x0294, 0x01d4,
+	    0x0195, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02be,
+	    0x0256, 0x0000, 0x0000, 0x01c6, 0x034c, 0x0000, 0x0212, 0x0125,
+	    0x0350, 0x0000, 0x01cd, 0x0000, 0x0179, 0x00fa, 0x0000, 0x0000,
+	    0x0034, 0x0360, 0x0000, 0x0000, 0x023e, 0x03e0, 0x0000, 0x038e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01c5, 0x0000, 0x0063,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x00f2, 0x0000, 0x0200, 0x0000,
+	    0x0000, 0x0146, 0x003e, 0x0000, 0x03cf, 0x023e, 0x0000, 0x0000,
+	    0x016f, 0x0000, 0x0000, 0x0397, 0x0036, 0x02a9, 0x0241, 0x02cd,
+	    0x01dd, 0x00bd, 0x023d, 0x036a, 0x0158, 0x0000, 0x0000, 0x0000,
+	    0x02fa, 0x0170, 0x01b0, 0x0356, 0x001a, 0x0000, 0x0258, 0x0000,
+	    0x0000, 0x02d3, 0x028c, 0x01de, 0x0000, 0x00f1, 0x0000, 0x0179,
+	    0x0000, 0x0000, 0x0244, 0x0000, 0x0308, 0x02a3, 0x0155, 0x0000,
+	    0x0000, 0x02b9, 0x0353, 0x0000, 0x011c, 0x0000, 0x0000, 0x022e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x00e2, 0x0000, 0x0000, 0x00e1,
+	    0x0000, 0x01e9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0016, 0x0000,
+	    0x0000, 0x0000, 0x0339, 0x0000, 0x0000, 0x0000, 0x009f, 0x0196,
+	    0x02d3, 0x0000, 0x012e, 0x035c, 0x0000, 0x0245, 0x0329, 0x0348,
+	    0x002f, 0x01d2, 0x0000, 0x0234, 0x0000, 0x0000, 0x00b7, 0x01bc,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01f4, 0x010a, 0x0000, 0x010e, 0x03ad, 0x0000, 0x000c, 0x0330,
+	    0x0000, 0x0000, 0x0000, 0x02b7, 0x0000, 0x02a5, 0x0000, 0x026b,
+	    0x007d, 0x0000, 0x0292, 0x0000, 0x026a, 0x0207, 0x00f6, 0x01cc,
+	    0x00ab, 0x0155, 0x015a, 0x0134, 0x032a, 0x001f, 0x00f1, 0x0000,
+	    0x0000, 0x01be, 0x0000, 0x022a, 0x0000, 0x0037, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x015f, 0x00ac, 0x03a7, 0x0134, 0x0000, 0x0000,
+	    0x0038, 0x00d6, 0x01d5, 0x0000, 0x0243, 0x0000, 0x0000, 0x01c6,
+	    0x039d, 0x01bb, 0x0000, 0x0000, 0x0000, 0x00a6, 0x01cc, 0x0196,
+	    0x0000, 0x02d5, 0x0097, 0x0000, 0x0000, 0x02f7, 0x0000, 0x029e,
+	    0x0000, 0x0000, 0x0000, 0x01a1, 0x0000, 0x0000, 0x0257, 0x0000,
+	    0x0000, 0x00fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0352,
+	    0x0136, 0x0082, 0x0000, 0x0100, 0x03bd, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0357, 0x00f3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x032c, 0x0000, 0x028e, 0x03cc, 0x008c, 0x0000, 0x0000,
+	    0x0000, 0x0119, 0x01db, 0x0000, 0x0175, 0x0286, 0x0000, 0x00b9,
+	    0x0000, 0x0248, 0x002e, 0x0000, 0x038f, 0x0000, 0x0375, 0x03db,
+	    0x0000, 0x01d3, 0x0000, 0x01e4, 0x0000, 0x0004, 0x0000, 0x0000,
+	    0x035c, 0x0220, 0x0000, 0x03a0, 0x0000, 0x0218, 0x0000, 0x0209,
+	    0x036f, 0x01d3, 0x02ca, 0x0071, 0x0376, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0181, 0x02cc, 0x0000, 0x028a, 0x0284, 0x0000, 0x0110,
+	    0x0000, 0x032e, 0x0315, 0x0086, 0x025d, 0x0000, 0x00a5, 0x0000,
+	    0x032a, 0x0314, 0x02a7, 0x00fe, 0x0365, 0x0000, 0x03cc, 0x0000,
+	    0x0109, 0x0007, 0x017e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02c0, 0x00f7, 0x0000, 0x0307, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0008, 0x0000, 0x0000, 0x021e, 0x0000, 0x0000, 0x022b, 0x0000,
+	    0x0000, 0x0384, 0x0000, 0x0274, 0x020d, 0x00be, 0x02f6, 0x0000,
+	    0x0000, 0x0186, 0x0000, 0x0000, 0x0000, 0x030a, 0x0000, 0x01f3,
+	    0x0000, 0x010b, 0x0000, 0x0004, 0x0000, 0x0000, 0x00cb, 0x006f,
+	    0x0111, 0x0000, 0x0000, 0x010f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x037d, 0x020b, 0x012f, 0x0000, 0x0000, 0x012b, 0x0030, 0x0000,
+	    0x0000, 0x0000, 0x017e, 0x0000, 0x0000, 0x03a5, 0x0000, 0x01c2,
+	    0x0000, 0x031b, 0x0000, 0x018f, 0x0000, 0x008b, 0x026c, 0x0000,
+	    0x0000, 0x03df, 0x00bd, 0x0177, 0x0000, 0x02b1, 0x0390, 0x036e,
+	    0x0000, 0x0227, 0x007d, 0x0000, 0x02be, 0x0000, 0x0000, 0x02a4,
+	    0x03e5, 0x03b4, 0x0000, 0x0000, 0x0000, 0x0198, 0x0047, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x030a, 0x00a9, 0x0000, 0x00c1, 0x00e1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0199, 0x014b, 0x0000, 0x00fb, 0x0310,
+	    0x007c, 0x0067, 0x0362, 0x0000, 0x03e0, 0x0304, 0x03b3, 0x00f8,
+	    0x0274, 0x0000, 0x02f8, 0x0012, 0x0000, 0x024d, 0x0341, 0x0000,
+	    0x0000, 0x01d0, 0x0030, 0x02c7, 0x0025, 0x0087, 0x0000, 0x0330,
+	    0x00bf, 0x0000, 0x0000, 0x0000, 0x029a, 0x0000, 0x02d2, 0x0123,
+	    0x022f, 0x02ad, 0x0000, 0x014c, 0x0000, 0x0049, 0x0074, 0x014b,
+	    0x0000, 0x00ad, 0x02b8, 0x0000, 0x03bd, 0x02bd, 0x0000, 0x010c,
+	    0x0000, 0x0085, 0x0000, 0x00e7, 0x0306, 0x0046, 0x0000, 0x0000,
+	    0x016f, 0x0000, 0x0104, 0x0129, 0x003c, 0x0216, 0x0261, 0x0000,
+	    0x0297, 0x0170, 0x0302, 0x0025, 0x00cb, 0x0000, 0x0351, 0x0000,
+	    0x03e7, 0x0000, 0x0000, 0x017d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x03db, 0x0000, 0x03d4, 0x0000,
+	    0x029e, 0x0100, 0x0000, 0x038c, 0x00af, 0x0000, 0x0000, 0x02df,
+	    0x028d, 0x0000, 0x0380, 0x0171, 0x03a8, 0x0000, 0x0244, 0x0000,
+	    0x03ab, 0x02e1, 0x032c, 0x03b9, 0x0000, 0x00d3, 0x0000, 0x01e7,
+	    0x0000, 0x0000, 0x02f3, 0x0000, 0x0000, 0x008e, 0x0000, 0x0000,
+	    0x0141, 0x0175, 0x0157, 0x031f, 0x01b2, 0x02a2, 0x03d7, 0x01d2,
+	    0x0000, 0x036d, 0x0000, 0x0000, 0x0058, 0x030e, 0x0130, 0x0355,
+	    0x0000, 0x03c7, 0x0300, 0x0000, 0x02e3, 0x0000, 0x0000, 0x0037,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f1, 0x03dc,
+	    0x0278, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x030d, 0x0000,
+	    0x01ed, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x017b,
+	    0x0250, 0x037e, 0x0000, 0x0231, 0x0000, 0x0380, 0x0000, 0x0000,
+	    0x0000, 0x01f5, 0x0347, 0x0000, 0x0000, 0x0388, 0x00a7, 0x0102,
+	    0x0000, 0x0000, 0x014c, 0x0000, 0x0004, 0x0000, 0x0000, 0x0078,
+	    0x01cd, 0x0359, 0x0000, 0x0000, 0x0000, 0x0000, 0x0115, 0x0301,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0267, 0x0000, 0x0059,
+	    0x007a, 0x0000, 0x0222, 0x02e8, 0x01f8, 0x0000, 0x00b9, 0x0000,
+	    0x03ca, 0x0000, 0x0000, 0x027f, 0x0000, 0x0000, 0x0369, 0x0009,
+	    0x0000, 0x0000, 0x0000, 0x001e, 0x0033, 0x0000, 0x01b4, 0x0000,
+	    0x0000, 0x0000, 0x038b, 0x0000, 0x0000, 0x0000, 0x01a5, 0x0000,
+	    0x0000, 0x0205, 0x0000, 0x01c5, 0x0292, 0x0188, 0x034f, 0x0000,
+	    0x0000, 0x0245, 0x030f, 0x0000, 0x0000, 0x0308, 0x02b9, 0x0322,
+	    0x004b, 0x0000, 0x015d, 0x0168, 0x037b, 0x0000, 0x0000, 0x01a3,
+	    0x0000, 0x00f3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x032d,
+	    0x0397, 0x0000, 0x018e, 0x02a8, 0x0000, 0x017e, 0x0355, 0x0161,
+	    0x036c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x028e, 0x01a3,
+	    0x0000, 0x02c7, 0x0000, 0x0108, 0x0000, 0x0174, 0x02e4, 0x0000,
+	    0x0310, 0x0000, 0x0000, 0x03b5, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0066, 0x03de, 0x004a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0137, 0x0000, 0x022f, 0x0000,
+	    0x02d0, 0x0000, 0x0000, 0x0000, 0x011e, 0x0000, 0x0306, 0x0000,
+	    0x0138, 0x0000, 0x005c, 0x01da, 0x0000, 0x0000, 0x03be, 0x0194,
+	    0x0000, 0x0000, 0x002b, 0x0335, 0x03bf, 0x0208, 0x0169, 0x0068,
+	    0x0254, 0x0000, 0x0000, 0x0000, 0x039d, 0x024d, 0x00f9, 0x0000,
+	    0x004d, 0x019e, 0x0000, 0x0000, 0x02e3, 0x0000, 0x0000, 0x00e3,
+	    0x037c, 0x018d, 0x005a, 0x0000, 0x025e, 0x0000, 0x0000, 0x0244,
+	    0x0000, 0x0000, 0x0252, 0x0000, 0x0000, 0x03bf, 0x0000, 0x0000,
+	    0x0000, 0x00db, 0x0256, 0x0006, 0x0000, 0x0000, 0x0000, 0x016d,
+	    0x0007, 0x016e, 0x0373, 0x0000, 0x0144, 0x0000, 0x00ad, 0x025b,
+	    0x0096, 0x0000, 0x0000, 0x0000, 0x023a, 0x0037, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0221, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x015d, 0x0000, 0x000c, 0x0068, 0x0349, 0x02bd, 0x0000,
+	    0x0330, 0x00fd, 0x0000, 0x0000, 0x0000, 0x021b, 0x0203, 0x0000,
+	    0x0143, 0x0018, 0x0000, 0x0000, 0x039b, 0x0259, 0x0000, 0x0000,
+	    0x0343, 0x0000, 0x00a2, 0x0000, 0x02b0, 0x0000, 0x0094, 0x034c,
+	    0x02c8, 0x0323, 0x022b, 0x0219, 0x016d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0094, 0x004e, 0x01f4, 0x03ba, 0x02dc, 0x0298, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x029d, 0x0000, 0x0000, 0x0000, 0x02bb,
+	    0x0124, 0x038b, 0x0000, 0x0000, 0x0000, 0x0026, 0x0152, 0x0002,
+	    0x01a7, 0x0357, 0x0231, 0x01e3, 0x0000, 0x031b, 0x01b0, 0x0057,
+	    0x02a2, 0x0240, 0x0000, 0x0000, 0x0228, 0x00e9, 0x0000, 0x01ad,
+	    0x0298, 0x0000, 0x0315, 0x028e, 0x02f8, 0x0000, 0x0000, 0x019c,
+	    0x0309, 0x01b5, 0x0000, 0x0000, 0x0255, 0x0000, 0x02c4, 0x00aa,
+	    0x00ee, 0x0000, 0x0000, 0x0000, 0x01f5, 0x0000, 0x0000, 0x01bf,
+	    0x0000, 0x0000, 0x0000, 0x0095, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01ea, 0x0270, 0x0000, 0x0000, 0x0045, 0x0000, 0x0201, 0x0000,
+	    0x0000, 0x01b5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02d8, 0x0000, 0x0165, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0322, 0x0079, 0x0000, 0x0000, 0x01e2, 0x0000, 0x0000,
+	    0x0305, 0x01c2, 0x0000, 0x03d6, 0x0000, 0x0000, 0x0000, 0x0376,
+	    0x01f6, 0x0277, 0x0056, 0x02bb, 0x0169, 0x0247, 0x0000, 0x017b,
+	    0x0000, 0x0000, 0x0005, 0x0000, 0x0314, 0x0000, 0x0000, 0x027e,
+	    0x0000, 0x03ba, 0x0000, 0x0000, 0x0000, 0x02fd, 0x018c, 0x0134,
+	    0x0000, 0x02db, 0x00cd, 0x0000, 0x0051, 0x005e, 0x0000, 0x0000,
+	    0x036c, 0x0000, 0x026c, 0x03ab, 0x0000, 0x0000, 0x0181, 0x0000,
+	    0x0000, 0x0000, 0x03b3, 0x0000, 0x0000, 0x01ff, 0x0000, 0x0000,
+	    0x0000, 0x01db, 0x0000, 0x03cf, 0x0000, 0x0103, 0x0000, 0x0000,
+	    0x0000, 0x02c6, 0x03d9, 0x0000, 0x0307, 0x0000, 0x0000, 0x0000,
+	    0x0378, 0x0292, 0x01de, 0x00f8, 0x0000, 0x01a0, 0x019e, 0x0000,
+	    0x008d, 0x020f, 0x0199, 0x0000, 0x0000, 0x0000, 0x03bf, 0x0000,
+	    0x0000, 0x0259, 0x0000, 0x0000, 0x005e, 0x00ce, 0x01c9, 0x0000,
+	    0x035c, 0x0000, 0x0106, 0x0000, 0x00b2, 0x0000, 0x0236, 0x0000,
+	    0x0000, 0x0000, 0x0123, 0x0000, 0x03e3, 0x00ed, 0x022d, 0x0335,
+	    0x002b, 0x03c0, 0x00fc, 0x001f, 0x0097, 0x0007, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0364, 0x0000, 0x011d, 0x0000, 0x01b3, 0x0000,
+	    0x0163, 0x0000, 0x0039, 0x01be, 0x0000, 0x029c, 0x0000, 0x0345,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00b7, 0x0055, 0x03ca,
+	    0x00ce, 0x0136, 0x0000, 0x037e, 0x0043, 0x02d0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0234, 0x0000, 0x0000, 0x00db, 0x0358, 0x0170,
+	    0x0000, 0x0002, 0x0147, 0x0000, 0x022f, 0x0217, 0x0232, 0x0000,
+	    0x01c8, 0x0244, 0x0255, 0x0000, 0x0000, 0x0188, 0x0000, 0x01dc,
+	    0x0000, 0x000b, 0x01a2, 0x0334, 0x02f5, 0x0000, 0x010b, 0x0398,
+	    0x0000, 0x0000, 0x0000, 0x0065, 0x0000, 0x014c, 0x020f, 0x0000,
+	    0x01d5, 0x0229, 0x0000, 0x038f, 0x034c, 0x006b, 0x0000, 0x0000,
+	    0x02cc, 0x0000, 0x0133, 0x008d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x004f, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0356, 0x0316, 0x039a,
+	    0x0000, 0x0185, 0x0000, 0x0316, 0x035f, 0x025d, 0x035a, 0x015f,
+	    0x0000, 0x013f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x031e, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x01de, 0x0000,
+	    0x02c6, 0x0000, 0x0000, 0x0027, 0x0000, 0x0000, 0x02d0, 0x0369,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0208, 0x0064, 0x00eb, 0x00cd,
+	    0x0389, 0x023b, 0x0000, 0x0000, 0x0000, 0x02d5, 0x0000, 0x0000,
+	    0x01e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0086, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x020d, 0x0000, 0x027a,
+	    0x0000, 0x0000, 0x0000, 0x01a4, 0x0000, 0x03d4, 0x003e, 0x0302,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0075, 0x0163, 0x00a8,
+	    0x0000, 0x021d, 0x0015, 0x0000, 0x00c4, 0x0000, 0x0000, 0x0018,
+	    0x0306, 0x0000, 0x0000, 0x0000, 0x02e4, 0x0000, 0x01a1, 0x0000,
+	    0x0000, 0x00c5, 0x00ea, 0x00d3, 0x00bb, 0x023f, 0x0000, 0x0000,
+	    0x020d, 0x03e1, 0x0114, 0x02d3, 0x02bf, 0x03b3, 0x0000, 0x029a,
+	    0x0000, 0x030a, 0x00a9, 0x0233, 0x0000, 0x0000, 0x01eb, 0x0000,
+	    0x0000, 0x0000, 0x0053, 0x0000, 0x0000, 0x0000, 0x00fb, 0x0372,
+	    0x03b2, 0x0000, 0x0000, 0x002a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0310, 0x011c, 0x0195, 0x0214, 0x018e, 0x01ef, 0x0000,
+	    0x0000, 0x0000, 0x0394, 0x02dd, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0044, 0x033e, 0x0166, 0x00b1, 0x0356, 0x0198, 0x0000, 0x0254,
+	    0x019b, 0x0000, 0x0277, 0x0000, 0x0239, 0x01c0, 0x0000, 0x0149,
+	    0x035c, 0x018a, 0x02fe, 0x0000, 0x0000, 0x0000, 0x024b, 0x0000,
+	    0x0256, 0x0249, 0x031f, 0x01f7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x0216, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x009a, 0x0000, 0x013c, 0x0153,
+	    0x0000, 0x0000, 0x0274, 0x02ec, 0x035d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x029f, 0x0019, 0x0000, 0x0000, 0x0000, 0x003f,
+	    0x00c1, 0x02ed, 0x0090, 0x0000, 0x0326, 0x0000, 0x0000, 0x039f,
+	    0x0000, 0x017e, 0x021b, 0x0320, 0x0000, 0x0000, 0x0000, 0x03d2,
+	    0x0254, 0x0219, 0x0000, 0x0000, 0x01ba, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0021, 0x0010, 0x0000, 0x0000, 0x0306, 0x0000, 0x0120,
+	    0x0000, 0x0000, 0x0000, 0x0332, 0x0000, 0x024e, 0x03b7, 0x0313,
+	    0x0000, 0x0000, 0x005f, 0x0142, 0x0017, 0x0000, 0x02d8, 0x0000,
+	    0x0000, 0x0000, 0x03e7, 0x0238, 0x0000, 0x0000, 0x01c9, 0x0000,
+	    0x0000, 0x031b, 0x0192, 0x0000, 0x0130, 0x016c, 0x0000, 0x001a,
+	    0x0000, 0x0218, 0x020e, 0x0306, 0x0065, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0059, 0x0000, 0x0000, 0x0000, 0x0272, 0x0000, 0x0000,
+	    0x022e, 0x0000, 0x0000, 0x0000, 0x01eb, 0x0000, 0x0000, 0x02fa,
+	    0x0000, 0x035f, 0x0000, 0x030d, 0x0000, 0x014d, 0x0000, 0x0250,
+	    0x0000, 0x0000, 0x02cc, 0x0202, 0x0304, 0x0000, 0x0287, 0x0217,
+	    0x01b8, 0x0284, 0x0055, 0x0000, 0x0000, 0x03d4, 0x0000, 0x0000,
+	    0x0000, 0x009b, 0x0000, 0x028f, 0x0144, 0x0000, 0x016b, 0x0153,
+	    0x03aa, 0x01db, 0x0000, 0x0135, 0x0000, 0x0000, 0x00c3, 0x0000,
+	    0x0198, 0x0000, 0x0000, 0x0000, 0x0000, 0x030d, 0x0000, 0x0000,
+	    0x03b1, 0x0285, 0x0381, 0x0000, 0x01d8, 0x0202, 0x03bf, 0x0000,
+	    0x0000, 0x01dd, 0x0130, 0x0000, 0x0000, 0x0000, 0x01e6, 0x001b,
+	    0x0000, 0x033c, 0x00d6, 0x0039, 0x0000, 0x0052, 0x0315, 0x0003,
+	    0x00f5, 0x013a, 0x0263, 0x0000, 0x0034, 0x03e5, 0x0174, 0x01c6,
+	    0x0000, 0x038f, 0x0126, 0x0000, 0x01ef, 0x0000, 0x0000, 0x03d4,
+	    0x0005, 0x0000, 0x0143, 0x0000, 0x01cf, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0333, 0x02f8, 0x01e0, 0x0327, 0x0000, 0x0000, 0x0000,
+	    0x02a8, 0x0012, 0x0000, 0x0000, 0x0000, 0x0292, 0x008c, 0x0000,
+	    0x02ab, 0x0000, 0x0131, 0x0000, 0x01da, 0x0000, 0x01a4, 0x03c7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x01ac, 0x0024, 0x030a, 0x0068,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x004f, 0x0026, 0x0000, 0x02f2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0034, 0x0000, 0x0000,
+	    0x0022, 0x0000, 0x0000, 0x0000, 0x03d0, 0x0000, 0x0000, 0x02a3,
+	    0x018d, 0x020c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x039b, 0x0000, 0x02c1, 0x0000, 0x03e0, 0x02f2, 0x0000,
+	    0x00ea, 0x00e5, 0x0000, 0x0000, 0x02f3, 0x0000, 0x0000, 0x009d,
+	    0x007a, 0x01ad, 0x0000, 0x0000, 0x0000, 0x0000, 0x039f, 0x012d,
+	    0x0339, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02be, 0x0000, 0x0000, 0x0069, 0x012b, 0x0000, 0x00ee, 0x0000,
+	    0x031a, 0x033c, 0x0000, 0x0000, 0x00c6, 0x0302, 0x0000, 0x00b7,
+	    0x0098, 0x0000, 0x01aa, 0x0000, 0x0230, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x016c, 0x03d1, 0x0000, 0x0000, 0x002f, 0x0000, 0x0000,
+	    0x03aa, 0x0000, 0x0000, 0x0189, 0x0000, 0x0041, 0x03e3, 0x0262,
+	    0x002f, 0x0000, 0x0000, 0x0369, 0x0396, 0x0366, 0x03b5, 0x0013,
+	    0x0000, 0x0000, 0x03a1, 0x0000, 0x008c, 0x0000, 0x00cd, 0x03dd,
+	    0x0000, 0x0036, 0x03cb, 0x00cf, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02e2, 0x0000, 0x0000, 0x003d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048, 0x0000,
+	    0x000f, 0x01cf, 0x01e1, 0x0000, 0x006f, 0x0000, 0x0271, 0x0000,
+	    0x0000, 0x035e, 0x0230, 0x00a0, 0x0000, 0x03e6, 0x00d5, 0x0000,
+	    0x0000, 0x0000, 0x0031, 0x0000, 0x0000, 0x0151, 0x0011, 0x033d,
+	    0x0000, 0x0247, 0x0000, 0x0000, 0x0000, 0x038e, 0x02e6, 0x0089,
+	    0x027a, 0x0000, 0x00da, 0x0000, 0x0000, 0x0201, 0x01ee, 0x0270,
+	    0x02f7, 0x03a1, 0x0000, 0x0000, 0x0000, 0x03d3, 0x02da, 0x0299,
+	    0x00d7, 0x02b2, 0x0000, 0x0121, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0107, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000,
+	    0x014f, 0x0000, 0x01d7, 0x0000, 0x0000, 0x013d, 0x0000, 0x0073,
+	    0x0000, 0x0000, 0x0000, 0x0301, 0x02b6, 0x0000, 0x0000, 0x030e,
+	    0x0000, 0x0000, 0x0122, 0x0386, 0x0162, 0x0058, 0x0000, 0x0000,
+	    0x0388, 0x0000, 0x01aa, 0x0063, 0x02b5, 0x0321, 0x0000, 0x013d,
+	    0x0274, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0115, 0x00a4,
+	    0x0000, 0x0187, 0x0000, 0x00ee, 0x0133, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0395, 0x0000, 0x02df, 0x00ac, 0x0000, 0x00fb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000, 0x0358, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x007d, 0x01fc, 0x0000, 0x026a, 0x00eb,
+	    0x0000, 0x0000, 0x0000, 0x0147, 0x0099, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01c3, 0x0000, 0x0000, 0x0118, 0x01b6, 0x004b, 0x0000,
+	    0x0000, 0x021a, 0x0000, 0x0000, 0x001e, 0x000f, 0x0000, 0x0000,
+	    0x0000, 0x0351, 0x0000, 0x004b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0169,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x002c, 0x0000, 0x01cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0275, 0x0000, 0x019d, 0x0000, 0x004f,
+	    0x0000, 0x0000, 0x0000, 0x028d, 0x02a6, 0x0035, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x01e2, 0x0000, 0x0000, 0x0000, 0x00c6, 0x02d4,
+	};
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x41b71efb), (uint32_t *)h);
+
+	h[0] = h[0] % 2048;
+	h[1] = h[1] % 2048;
+	return (g[h[0]] + g[h[1]]) % 1000;
+}
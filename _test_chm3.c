@@ -0,0 +1,275 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 1957747793, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[2048] = {
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x024e, 0x0000, 0x0000, 0x00a8,
+	    0x0000, 0x01bc, 0x0000, 0x02b5, 0x0000, 0x03c4, 0x030a, 0x00af,
+	    0x0000, 0x0000, 0x033a, 0x0000, 0x0000, 0x011c, 0x0281, 0x0000,
+	    0x0127, 0x0000, 0x038b, 0x03d4, 0x0000, 0x02de, 0x0000, 0x0000,
+	    0x00ab, 0x0000, 0x01d1, 0x005e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0125, 0x0000, 0x02f1, 0x0000, 0x0000, 0x0163,
+	    0x0000, 0x0000, 0x0000, 0x0289, 0x0000, 0x00b2, 0x0000, 0x003d,
+	    0x0000, 0x01d2, 0x0000, 0x0000, 0x0091, 0x0000, 0x0000, 0x02d7,
+	    0x0000, 0x0191, 0x0000, 0x02ab, 0x0000, 0x00f4, 0x0023, 0x0000,
+	    0x0000, 0x0000, 0x006e, 0x0184, 0x01b2, 0x01db, 0x0000, 0x0000,
+	    0x01d7, 0x0000, 0x0000, 0x03b0, 0x0000, 0x0000, 0x032f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0062, 0x01e8, 0x026d, 0x0000, 0x0224,
+	    0x02a4, 0x0139, 0x0188, 0x0000, 0x00b9, 0x0164, 0x0051, 0x0000,
+	    0x0000, 0x0227, 0x0000, 0x0000, 0x0000, 0x01a1, 0x0000, 0x026a,
+	    0x012c, 0x0095, 0x0000, 0x02db, 0x0000, 0x025b, 0x0000, 0x00b8,
+	    0x0000, 0x0138, 0x0170, 0x0000, 0x02b5, 0x0000, 0x028e, 0x03c4,
+	    0x0000, 0x0276, 0x0134, 0x01ac, 0x0000, 0x0000, 0x01ff, 0x039f,
+	    0x0158, 0x0000, 0x02e0, 0x0051, 0x013b, 0x00ba, 0x00b1, 0x0000,
+	    0x0205, 0x0253, 0x034b, 0x00da, 0x0000, 0x0096, 0x0000, 0x0000,
+	    0x0000, 0x02f4, 0x0000, 0x0000, 0x012b, 0x0137, 0x0000, 0x0000,
+	    0x0185, 0x0000, 0x03c5, 0x01c8, 0x005e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0338, 0x0000, 0x01b3, 0x0000, 0x0000, 0x0000, 0x005c,
+	    0x01f6, 0x0105, 0x0000, 0x006c, 0x0000, 0x0000, 0x02a4, 0x005c,
+	    0x0000, 0x0000, 0x01ed, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03c5, 0x0079, 0x007d, 0x00f8, 0x0387, 0x035a, 0x037c,
+	    0x02da, 0x0000, 0x034d, 0x0139, 0x0000, 0x0000, 0x0310, 0x02c8,
+	    0x0000, 0x00cd, 0x0000, 0x0051, 0x0000, 0x0000, 0x008e, 0x0000,
+	    0x0000, 0x0000, 0x0226, 0x0226, 0x0000, 0x0243, 0x035d, 0x0000,
+	    0x0000, 0x024a, 0x0000, 0x0343, 0x008b, 0x0000, 0x0000, 0x0000,
+	    0x032d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01d0, 0x0000, 0x0000, 0x0000, 0x02da, 0x015e, 0x01c2, 0x01f5,
+	    0x0000, 0x0177, 0x00cf, 0x0000, 0x0371, 0x0000, 0x0251, 0x014c,
+	    0x00a0, 0x0000, 0x01b8, 0x0000, 0x0218, 0x0000, 0x002a, 0x0159,
+	    0x0067, 0x0000, 0x0282, 0x0343, 0x0273, 0x03ad, 0x0000, 0x0000,
+	    0x0000, 0x011f, 0x01ab, 0x0110, 0x0000, 0x03ce, 0x01fc, 0x0000,
+	    0x015d, 0x0000, 0x0262, 0x0000, 0x0279, 0x0098, 0x02f5, 0x0293,
+	    0x0000, 0x0053, 0x0000, 0x0000, 0x0039, 0x0000, 0x0000, 0x0177,
+	    0x025b, 0x01c1, 0x0080, 0x01d6, 0x02c8, 0x0000, 0x0000, 0x00eb,
+	    0x03d5, 0x030d, 0x0116, 0x003f, 0x01c4, 0x00df, 0x0000, 0x0000,
+	    0x012d, 0x0000, 0x019c, 0x0000, 0x0330, 0x0000, 0x01fa, 0x0380,
+	    0x03a3, 0x0266, 0x0000, 0x0062, 0x0000, 0x0266, 0x0175, 0x0000,
+	    0x02f7, 0x01ea, 0x0000, 0x0000, 0x02e4, 0x0000, 0x0000, 0x0000,
+	    0x0368, 0x0000, 0x03dc, 0x0000, 0x0000, 0x02d2, 0x016b, 0x01c0,
+	    0x0000, 0x024d, 0x0000, 0x0000, 0x026b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x03b5, 0x0275, 0x0000, 0x0000, 0x0349,
+	    0x0000, 0x0000, 0x03c0, 0x024a, 0x03a0, 0x0000, 0x01c3, 0x024f,
+	    0x0000, 0x029f, 0x00e6, 0x00e0, 0x0000, 0x03d0, 0x0000, 0x03b1,
+	    0x011e, 0x038a, 0x03c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x01f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x02a0,
+	    0x0000, 0x00d9, 0x0000, 0x0000, 0x037c, 0x0085, 0x0000, 0x02bf,
+	    0x00ba, 0x0000, 0x0341, 0x0000, 0x00e3, 0x0196, 0x0244, 0x037d,
+	    0x0000, 0x0000, 0x0038, 0x0000, 0x0000, 0x0000, 0x01c8, 0x02d5,
+	    0x0199, 0x0000, 0x024c, 0x0000, 0x0052, 0x0000, 0x0000, 0x03d2,
+	    0x0219, 0x0000, 0x0239, 0x0000, 0x02eb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x000e, 0x0000, 0x01a1, 0x0125, 0x0000, 0x0361, 0x0000,
+	    0x03b1, 0x0000, 0x03af, 0x0000, 0x0000, 0x0000, 0x02b7, 0x0000,
+	    0x0000, 0x01c1, 0x034d, 0x0000, 0x00b6, 0x01ab, 0x0000, 0x0000,
+	    0x0000, 0x03d7, 0x0000, 0x0269, 0x0007, 0x0000, 0x03d3, 0x0328,
+	    0x03e0, 0x0110, 0x0000, 0x0000, 0x00d1, 0x0329, 0x0000, 0x00ec,
+	    0x0230, 0x0072, 0x012c, 0x032f, 0x0000, 0x0000, 0x0237, 0x00e0,
+	    0x0209, 0x02f6, 0x0000, 0x0230, 0x0000, 0x0278, 0x00a8, 0x004b,
+	    0x03ca, 0x004a, 0x0035, 0x0000, 0x01ba, 0x0149, 0x0000, 0x02a0,
+	    0x0000, 0x03be, 0x0000, 0x0000, 0x0000, 0x037b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0394, 0x01ce, 0x029a,
+	    0x035c, 0x00f6, 0x030f, 0x0000, 0x0071, 0x0000, 0x034f, 0x0000,
+	    0x02d2, 0x0078, 0x0000, 0x0035, 0x0000, 0x0056, 0x0000, 0x0122,
+	    0x0368, 0x02cf, 0x0000, 0x0000, 0x0000, 0x011b, 0x0000, 0x0000,
+	    0x00b4, 0x03d7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0015,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x027d, 0x00f1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0362, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x015b, 0x0000, 0x02e5, 0x0380, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x021a, 0x0000, 0x0281, 0x0000, 0x0000, 0x021b,
+	    0x0000, 0x02e9, 0x0000, 0x0252, 0x0092, 0x009e, 0x0000, 0x03c8,
+	    0x0000, 0x020c, 0x0126, 0x001a, 0x0000, 0x0303, 0x00ee, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0119, 0x03e0, 0x0000, 0x0000, 0x0000,
+	    0x025c, 0x0000, 0x0000, 0x0000, 0x03c0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022a, 0x03b6, 0x0000,
+	    0x02ff, 0x004f, 0x0063, 0x0000, 0x02ec, 0x0000, 0x03c7, 0x01fe,
+	    0x0000, 0x0000, 0x0000, 0x0107, 0x0047, 0x02c0, 0x0000, 0x00e3,
+	    0x0000, 0x0000, 0x012c, 0x0000, 0x0000, 0x0000, 0x034a, 0x02f3,
+	    0x0000, 0x02f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03d5,
+	    0x0232, 0x02e3, 0x0000, 0x0000, 0x0353, 0x028d, 0x0000, 0x02a0,
+	    0x0095, 0x0290, 0x02f2, 0x0000, 0x0000, 0x00e7, 0x0107, 0x01dc,
+	    0x00af, 0x0000, 0x01ca, 0x0100, 0x0000, 0x0304, 0x017a, 0x00ce,
+	    0x0000, 0x0000, 0x0343, 0x0000, 0x025e, 0x00e5, 0x0222, 0x0000,
+	    0x01d6, 0x0000, 0x0000, 0x015c, 0x00a7, 0x0079, 0x0000, 0x0000,
+	    0x0249, 0x00e4, 0x0000, 0x00db, 0x0011, 0x008b, 0x00a4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x019d, 0x0000, 0x03be, 0x0000, 0x01c4,
+	    0x02c5, 0x0000, 0x0165, 0x0000, 0x0000, 0x0000, 0x004e, 0x0000,
+	    0x0000, 0x008d, 0x0000, 0x0000, 0x0000, 0x037f, 0x0000, 0x01ec,
+	    0x0000, 0x0073, 0x0289, 0x023b, 0x0285, 0x00b0, 0x0296, 0x02b6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02af, 0x0000, 0x0051, 0x0000, 0x0000, 0x0000, 0x02a6,
+	    0x0000, 0x0059, 0x0000, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000,
+	    0x00ec, 0x0000, 0x0338, 0x0076, 0x0043, 0x0318, 0x0000, 0x0000,
+	    0x0332, 0x0000, 0x0000, 0x01f2, 0x0126, 0x0000, 0x0000, 0x0180,
+	    0x00ce, 0x0376, 0x0000, 0x0000, 0x02a1, 0x0000, 0x020e, 0x0000,
+	    0x0215, 0x0000, 0x000f, 0x00c7, 0x0000, 0x0228, 0x0000, 0x01b2,
+	    0x0000, 0x0000, 0x0000, 0x033b, 0x02c8, 0x0000, 0x0000, 0x0000,
+	    0x022c, 0x00c5, 0x017e, 0x0000, 0x0000, 0x0023, 0x024b, 0x0052,
+	    0x011e, 0x03d3, 0x0000, 0x0357, 0x0340, 0x00bd, 0x0000, 0x0000,
+	    0x0175, 0x0000, 0x0291, 0x0034, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02d0, 0x0009, 0x00bf, 0x0000, 0x0000,
+	    0x00c4, 0x0000, 0x0168, 0x021f, 0x0355, 0x030f, 0x0000, 0x0000,
+	    0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02e9, 0x01d3, 0x0000, 0x00c2, 0x02dd, 0x0000, 0x0000, 0x0000,
+	    0x0326, 0x00aa, 0x0329, 0x0000, 0x0000, 0x02d9, 0x0000, 0x0344,
+	    0x0000, 0x0000, 0x0253, 0x0000, 0x0000, 0x00f7, 0x0310, 0x0000,
+	    0x0000, 0x0000, 0x024c, 0x0000, 0x0000, 0x017b, 0x017e, 0x0085,
+	    0x005a, 0x00e2, 0x0281, 0x0000, 0x0218, 0x02af, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x029b, 0x02e5, 0x0000, 0x0191, 0x0186,
+	    0x0000, 0x0000, 0x0000, 0x0342, 0x0254, 0x03cd, 0x0000, 0x0000,
+	    0x03de, 0x00ea, 0x0000, 0x031e, 0x0000, 0x0000, 0x011c, 0x0123,
+	    0x0161, 0x0216, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00a2, 0x0000, 0x0131, 0x0000, 0x0000,
+	    0x0338, 0x0000, 0x0000, 0x0000, 0x0211, 0x0000, 0x0000, 0x0097,
+	    0x0000, 0x02c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0074, 0x0000,
+	    0x010e, 0x0023, 0x0315, 0x03a1, 0x007d, 0x036b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x017f, 0x017d, 0x0000, 0x0000, 0x0298, 0x0000,
+	    0x03a4, 0x0304, 0x0268, 0x0000, 0x0000, 0x0320, 0x0000, 0x0000,
+	    0x00dd, 0x0000, 0x0000, 0x018b, 0x0000, 0x0000, 0x0000, 0x03d0,
+	    0x0204, 0x0255, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03a9, 0x0130, 0x0032, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0222, 0x0000, 0x0362, 0x0000, 0x0000, 0x00f9, 0x02eb,
+	    0x034b, 0x0194, 0x02d9, 0x0000, 0x0000, 0x0177, 0x0275, 0x0000,
+	    0x019c, 0x0000, 0x00c3, 0x0000, 0x01d5, 0x0000, 0x0029, 0x0000,
+	    0x03d6, 0x0000, 0x00fa, 0x0000, 0x0000, 0x0058, 0x0080, 0x01d9,
+	    0x0000, 0x0000, 0x0000, 0x004e, 0x0000, 0x0000, 0x0187, 0x0000,
+	    0x0000, 0x0000, 0x006c, 0x0000, 0x0366, 0x0000, 0x0000, 0x01e6,
+	    0x026a, 0x0000, 0x03da, 0x0262, 0x0000, 0x01b0, 0x0275, 0x0000,
+	    0x010c, 0x026b, 0x0000, 0x0000, 0x0009, 0x00e4, 0x02f1, 0x0000,
+	    0x0000, 0x0000, 0x0032, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x007d, 0x0000, 0x0000, 0x0000, 0x018e, 0x030d,
+	    0x0000, 0x0000, 0x02f3, 0x0000, 0x03d9, 0x0091, 0x02f4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x011e, 0x0000, 0x00bf, 0x0000, 0x03dd,
+	    0x0000, 0x02be, 0x005c, 0x0190, 0x001e, 0x03d1, 0x0000, 0x001d,
+	    0x0000, 0x00ee, 0x0322, 0x03b7, 0x0028, 0x036c, 0x0000, 0x02ea,
+	    0x0347, 0x0000, 0x0000, 0x0000, 0x03a5, 0x011b, 0x0000, 0x02bb,
+	    0x0000, 0x0342, 0x03a0, 0x0177, 0x03c0, 0x0000, 0x010f, 0x0000,
+	    0x0000, 0x0025, 0x0342, 0x0000, 0x0241, 0x0022, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0304, 0x0351, 0x0310, 0x0000, 0x0000,
+	    0x00a6, 0x03ae, 0x0000, 0x027f, 0x010c, 0x022e, 0x0000, 0x0000,
+	    0x0000, 0x0399, 0x0000, 0x018e, 0x0229, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02f9, 0x0000, 0x0000, 0x00c2, 0x0000, 0x00d3, 0x0000,
+	    0x00b3, 0x00e5, 0x026f, 0x0000, 0x0228, 0x0120, 0x0000, 0x0149,
+	    0x00f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x036e, 0x0133, 0x0000,
+	    0x0285, 0x0185, 0x0127, 0x0000, 0x01a1, 0x03e6, 0x0000, 0x0263,
+	    0x0159, 0x025d, 0x0372, 0x0000, 0x027e, 0x0000, 0x001e, 0x0000,
+	    0x01a6, 0x0000, 0x0000, 0x0000, 0x0277, 0x007d, 0x03b2, 0x020b,
+	    0x03c8, 0x0000, 0x0000, 0x017a, 0x0000, 0x0000, 0x0000, 0x037b,
+	    0x03aa, 0x0000, 0x0000, 0x0000, 0x03c3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02b8, 0x01ed, 0x0028,
+	    0x00c5, 0x0000, 0x0000, 0x0063, 0x036a, 0x01cf, 0x0393, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0359, 0x0367, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0025, 0x0339, 0x0086, 0x0000, 0x02b1, 0x0000, 0x0285,
+	    0x00dd, 0x0000, 0x031f, 0x014b, 0x0000, 0x03aa, 0x0000, 0x0000,
+	    0x02bc, 0x008d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x027c,
+	    0x024e, 0x01ab, 0x0393, 0x0284, 0x01f8, 0x0193, 0x0141, 0x0000,
+	    0x0000, 0x010a, 0x0000, 0x03d2, 0x03a2, 0x0130, 0x0000, 0x024f,
+	    0x0000, 0x03bb, 0x0035, 0x0000, 0x0006, 0x0000, 0x0098, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0248, 0x0000, 0x0231, 0x0000, 0x0000, 0x013b,
+	    0x0117, 0x0215, 0x0293, 0x0000, 0x0000, 0x0000, 0x0000, 0x00bd,
+	    0x0146, 0x0093, 0x01f4, 0x0154, 0x0000, 0x018c, 0x0120, 0x0000,
+	    0x01ad, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082,
+	    0x0000, 0x032b, 0x0000, 0x0000, 0x01e2, 0x0000, 0x00e8, 0x0256,
+	    0x0000, 0x0000, 0x0000, 0x00d4, 0x0000, 0x0000, 0x01a1, 0x02d5,
+	    0x00c2, 0x0000, 0x02a8, 0x03da, 0x0000, 0x0000, 0x0000, 0x001b,
+	    0x0000, 0x032f, 0x0000, 0x0000, 0x017d, 0x0080, 0x00cd, 0x025a,
+	    0x014e, 0x0075, 0x0000, 0x0000, 0x03c7, 0x0000, 0x0000, 0x0000,
+	    0x016e, 0x0000, 0x0000, 0x01ee, 0x0000, 0x01b0, 0x0008, 0x0000,
+	    0x0000, 0x02a1, 0x024e, 0x01e7, 0x01e2, 0x0000, 0x0000, 0x0000,
+	    0x0059, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x00df,
+	    0x0000, 0x0307, 0x0000, 0x01ec, 0x008c, 0x0000, 0x0000, 0x0316,
+	    0x0126, 0x0000, 0x0000, 0x0162, 0x0309, 0x0074, 0x0000, 0x0000,
+	    0x0000, 0x01b0, 0x01f2, 0x0000, 0x03ca, 0x01b8, 0x0141, 0x03a5,
+	    0x0000, 0x023b, 0x0000, 0x0061, 0x0000, 0x034c, 0x0194, 0x0367,
+	    0x0000, 0x033f, 0x027e, 0x0126, 0x0000, 0x03db, 0x0000, 0x0367,
+	    0x0000, 0x000c, 0x0000, 0x010f, 0x0290, 0x021d, 0x0000, 0x0000,
+	    0x03d6, 0x0171, 0x0000, 0x0000, 0x0000, 0x0232, 0x0000, 0x009c,
+	    0x0245, 0x0000, 0x0000, 0x02f2, 0x01fe, 0x032a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0265, 0x013b, 0x0063, 0x008b, 0x036f, 0x0000,
+	    0x0055, 0x00b8, 0x0000, 0x0000, 0x02c3, 0x0000, 0x03bc, 0x0238,
+	    0x027c, 0x01ee, 0x0397, 0x0369, 0x022e, 0x007c, 0x02e2, 0x00ad,
+	    0x0000, 0x03ab, 0x0057, 0x0000, 0x0000, 0x0000, 0x0073, 0x00b9,
+	    0x016a, 0x02fa, 0x0011, 0x0000, 0x00a5, 0x0000, 0x021c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0192, 0x0000, 0x016c, 0x0000, 0x0000,
+	    0x0000, 0x01ef, 0x0000, 0x0085, 0x0023, 0x0227, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x015f, 0x0000, 0x03a0, 0x0000, 0x0284,
+	    0x0000, 0x0000, 0x0169, 0x0084, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01b5, 0x0000, 0x0000, 0x0000, 0x035c,
+	    0x0300, 0x00d0, 0x02a7, 0x0000, 0x0193, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02c4, 0x02ed, 0x0012, 0x0000, 0x0000, 0x02d9,
+	    0x019b, 0x0000, 0x0000, 0x0000, 0x0179, 0x03a7, 0x009f, 0x002b,
+	    0x0000, 0x0000, 0x03c6, 0x0173, 0x0000, 0x03d6, 0x0125, 0x0000,
+	    0x014f, 0x0000, 0x0000, 0x0050, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x013e, 0x0000, 0x0000, 0x00de, 0x0000, 0x0000, 0x0000, 0x01d7,
+	    0x00de, 0x0112, 0x03cf, 0x010a, 0x0195, 0x0000, 0x0000, 0x03c3,
+	    0x0000, 0x0000, 0x02ee, 0x0000, 0x0000, 0x01ec, 0x0000, 0x0311,
+	    0x003a, 0x025e, 0x0066, 0x00fe, 0x02ad, 0x0027, 0x0000, 0x03ca,
+	    0x0000, 0x0000, 0x017c, 0x0000, 0x0000, 0x0114, 0x0000, 0x026a,
+	    0x0000, 0x00bc, 0x02f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a9,
+	    0x0386, 0x01b2, 0x0000, 0x012e, 0x0109, 0x0313, 0x0000, 0x0315,
+	    0x0000, 0x0000, 0x0141, 0x0000, 0x01ea, 0x0000, 0x022c, 0x0283,
+	    0x0000, 0x020e, 0x0000, 0x0000, 0x0260, 0x00a9, 0x00a6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0168, 0x01b1, 0x00e1, 0x0000, 0x0000,
+	    0x0013, 0x0262, 0x0328, 0x020c, 0x010b, 0x03cd, 0x0336, 0x0000,
+	    0x0000, 0x0000, 0x0108, 0x004e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0220, 0x0000, 0x0000,
+	    0x0000, 0x0360, 0x0198, 0x0349, 0x0000, 0x0000, 0x006c, 0x0019,
+	    0x0242, 0x0000, 0x0275, 0x0000, 0x0247, 0x0000, 0x02ed, 0x0000,
+	    0x0000, 0x020e, 0x00a5, 0x0000, 0x00d4, 0x00e1, 0x0000, 0x0145,
+	    0x0000, 0x0267, 0x02c1, 0x02b8, 0x0000, 0x0000, 0x0259, 0x0000,
+	    0x0037, 0x0294, 0x0193, 0x0381, 0x015e, 0x039d, 0x0000, 0x0000,
+	    0x0000, 0x01a8, 0x0000, 0x026f, 0x02db, 0x0054, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0170, 0x0000, 0x00ec, 0x01a8, 0x0000, 0x0000,
+	    0x0000, 0x02fb, 0x03c9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03b8, 0x0000, 0x0000, 0x00bf, 0x038c, 0x01eb, 0x02e8,
+	    0x0313, 0x02be, 0x0390, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01d9, 0x0000, 0x0358, 0x0144, 0x0000,
+	    0x0279, 0x0000, 0x0231, 0x036d, 0x0000, 0x0000, 0x0002, 0x0000,
+	    0x0000, 0x0000, 0x031b, 0x0000, 0x0289, 0x0046, 0x0000, 0x038b,
+	    0x02da, 0x023a, 0x0000, 0x0000, 0x005d, 0x028e, 0x03b9, 0x0018,
+	    0x0000, 0x009a, 0x0000, 0x0000, 0x01e8, 0x0000, 0x025f, 0x0388,
+	    0x0000, 0x0000, 0x0239, 0x0000, 0x0288, 0x0201, 0x0000, 0x0044,
+	    0x00c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x033d, 0x0000, 0x0297, 0x01c2,
+	    0x0000, 0x0000, 0x0000, 0x000a, 0x02d6, 0x01a9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0080, 0x00f5, 0x0000, 0x0000, 0x0000, 0x035f,
+	    0x00b5, 0x0351, 0x0000, 0x0000, 0x0000, 0x0081, 0x0000, 0x0000,
+	    0x003c, 0x0000, 0x0000, 0x021f, 0x0000, 0x0000, 0x005b, 0x003c,
+	    0x0000, 0x00a3, 0x0330, 0x023e, 0x0000, 0x0000, 0x0000, 0x038b,
+	    0x0141, 0x027c, 0x0000, 0x0006, 0x0356, 0x0000, 0x02d8, 0x03b0,
+	    0x03cb, 0x013d, 0x0000, 0x0000, 0x0000, 0x0000, 0x036e, 0x0000,
+	    0x0000, 0x0277, 0x003d, 0x02ad, 0x0000, 0x0179, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x015c, 0x0000, 0x01fb, 0x00cb, 0x0000, 0x0346,
+	    0x0000, 0x02b6, 0x02e8, 0x00f7, 0x0000, 0x00ee, 0x0000, 0x0000,
+	    0x0000, 0x0291, 0x0000, 0x0169, 0x0000, 0x0016, 0x0000, 0x0000,
+	    0x0000, 0x00bf, 0x0000, 0x01b5, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x021c, 0x0077, 0x0000, 0x0355, 0x00cd, 0x0000, 0x0000, 0x00be,
+	    0x0000, 0x009a, 0x0000, 0x0000, 0x0056, 0x0080, 0x0000, 0x0000,
+	    0x009c, 0x0022, 0x03af, 0x00bd, 0x0000, 0x0000, 0x0000, 0x00d6,
+	    0x032f, 0x03a1, 0x0000, 0x0000, 0x0271, 0x01fd, 0x0000, 0x0000,
+	    0x0324, 0x0000, 0x0000, 0x033a, 0x004a, 0x018c, 0x0000, 0x0000,
+	    0x0290, 0x02a2, 0x0000, 0x0000, 0x0000, 0x0123, 0x0000, 0x0018,
+	    0x02f3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024f, 0x0383,
+	    0x0173, 0x0000, 0x0000, 0x0000, 0x0032, 0x027b, 0x0000, 0x0000,
+	    0x0166, 0x0372, 0x0000, 0x0090, 0x02c5, 0x0000, 0x0000, 0x0042,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x031f, 0x0000, 0x0000,
+	    0x01ef, 0x01cf, 0x0000, 0x02a7, 0x0000, 0x0000, 0x0000, 0x010d,
+	    0x0000, 0x025d, 0x02d1, 0x00cf, 0x0000, 0x039d, 0x019c, 0x004f,
+	    0x0000, 0x0200, 0x029d, 0x02a6, 0x0000, 0x0000, 0x0000, 0x0050,
+	    0x0000, 0x0000, 0x0367, 0x0000, 0x00f8, 0x0350, 0x0000, 0x0298,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0287, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0268, 0x0000, 0x01a4, 0x0162, 0x0068,
+	    0x0394, 0x0237, 0x0000, 0x0000, 0x0000, 0x0000, 0x02e0, 0x008e,
+	};
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x74b0dc51), (uint32_t *)h);
+
+	h[0] = h[0] % 2048;
+	h[1] = h[1] % 2048;
+	h[2] = h[2] % 2048;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 1000;
+}
@@ -0,0 +1,3120 @@
+/* generated with rurban/nbperf 08a5797  _words */
+/* seed[0]: 1957747793, seed[1]: 424238335 */
+#include <stdint.h>
+#include "aeshash.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[24801] = {
+	    0x1e61, 0x1cbb, 0x4292, 0x2f6e, 0x0000, 0x2025, 0x28a0, 0x3915,
+	    0x13fb, 0x1914, 0x22a0, 0x1286, 0x4cdb, 0x0ee0, 0x0000, 0x0537,
+	    0x10f5, 0x4583, 0x1b7a, 0x3ec6, 0x4ae4, 0x2c01, 0x4334, 0x0000,
+	    0x1d29, 0x2bdc, 0x1033, 0x4dc5, 0x0cd2, 0x45be, 0x1d98, 0x0ca8,
+	    0x4b67, 0x3bae, 0x0000, 0x2c06, 0x43fe, 0x0000, 0x0000, 0x1e9a,
+	    0x2f87, 0x1113, 0x4ccd, 0x0000, 0x39b0, 0x2bee, 0x259c, 0x13e3,
+	    0x1249, 0x0000, 0x0d7f, 0x10d3, 0x4805, 0x4736, 0x1dae, 0x34ea,
+	    0x341b, 0x0740, 0x25be, 0x1a54, 0x3ae4, 0x4ddc, 0x0000, 0x040a,
+	    0x37e0, 0x18b0, 0x20a7, 0x43d8, 0x3827, 0x0000, 0x0000, 0x01da,
+	    0x4abc, 0x408d, 0x32ee, 0x30dd, 0x17eb, 0x1d54, 0x03d8, 0x4349,
+	    0x311c, 0x3b0d, 0x1452, 0x155f, 0x237a, 0x2fc1, 0x0000, 0x3314,
+	    0x1dab, 0x3c63, 0x1cb7, 0x26f0, 0x1a8a, 0x36c8, 0x41bb, 0x3bfb,
+	    0x302a, 0x2f52, 0x280a, 0x2606, 0x00df, 0x0000, 0x4b33, 0x1ca4,
+	    0x258b, 0x4671, 0x0c12, 0x0819, 0x3326, 0x349f, 0x43d7, 0x031f,
+	    0x13ce, 0x4791, 0x06c8, 0x4349, 0x28db, 0x2629, 0x0c58, 0x0e60,
+	    0x3a33, 0x3360, 0x226b, 0x2b9b, 0x388a, 0x2db4, 0x0000, 0x0000,
+	    0x3dd6, 0x11d7, 0x07ed, 0x0000, 0x2e8f, 0x17f6, 0x1ada, 0x0e53,
+	    0x4d7e, 0x3227, 0x0fbc, 0x189b, 0x46cc, 0x3902, 0x3517, 0x3be2,
+	    0x1552, 0x0000, 0x4561, 0x0189, 0x238d, 0x1e53, 0x37dc, 0x3c7b,
+	    0x10f9, 0x2e9f, 0x21e1, 0x0000, 0x41c3, 0x0000, 0x2fe2, 0x24c2,
+	    0x3676, 0x4262, 0x3a18, 0x0446, 0x193a, 0x0000, 0x3a19, 0x032b,
+	    0x1ff9, 0x1c1a, 0x0021, 0x4872, 0x49a4, 0x1c66, 0x41de, 0x2329,
+	    0x088d, 0x442b, 0x0000, 0x4513, 0x12f9, 0x3f35, 0x0212, 0x1d14,
+	    0x4c3b, 0x0000, 0x316e, 0x4bb5, 0x429a, 0x31cf, 0x2c8a, 0x0000,
+	    0x143b, 0x0ba5, 0x2eea, 0x2a18, 0x400b, 0x2105, 0x4c35, 0x0fde,
+	    0x0f49, 0x1f95, 0x394a, 0x3a1e, 0x191e, 0x259d, 0x4c79, 0x0000,
+	    0x16ce, 0x4bfe, 0x1c31, 0x16a0, 0x03be, 0x3e34, 0x10f5, 0x075a,
+	    0x0000, 0x2460, 0x43b7, 0x1613, 0x0000, 0x04e1, 0x0000, 0x3831,
+	    0x4430, 0x4554, 0x275f, 0x1e24, 0x2e59, 0x08b1, 0x0000, 0x106e,
+	    0x0000, 0x4aa3, 0x34a0, 0x132a, 0x4571, 0x27ac, 0x2601, 0x436b,
+	    0x21db, 0x2815, 0x13dc, 0x0f19, 0x0dad, 0x3dd9, 0x0000, 0x2d15,
+	    0x1e66, 0x360c, 0x0000, 0x1c87, 0x0000, 0x0f67, 0x331a, 0x01c2,
+	    0x12ae, 0x0ab2, 0x01a8, 0x2cc5, 0x4955, 0x13dd, 0x0056, 0x052b,
+	    0x2592, 0x0d6a, 0x124e, 0x18ea, 0x345e, 0x4d36, 0x0f15, 0x09bf,
+	    0x1bf1, 0x32b4, 0x2f31, 0x0cd8, 0x1224, 0x096a, 0x0976, 0x0000,
+	    0x14fa, 0x0239, 0x34d2, 0x3860, 0x0c02, 0x2d9d, 0x28ef, 0x22c8,
+	    0x3b02, 0x0000, 0x1b52, 0x0000, 0x3df3, 0x0000, 0x20bd, 0x1ea4,
+	    0x1303, 0x3507, 0x3f18, 0x205b, 0x0867, 0x2cb3, 0x072a, 0x0000,
+	    0x30bd, 0x15d9, 0x1083, 0x3a09, 0x395e, 0x0000, 0x155a, 0x0000,
+	    0x1f94, 0x072a, 0x38e4, 0x0000, 0x0a14, 0x36ce, 0x45ed, 0x0712,
+	    0x0000, 0x0198, 0x4847, 0x45db, 0x4c1a, 0x1679, 0x0000, 0x1e39,
+	    0x1ab2, 0x22e3, 0x0000, 0x4b24, 0x0333, 0x0000, 0x2739, 0x0000,
+	    0x0f47, 0x2aee, 0x4539, 0x302b, 0x2b8d, 0x0000, 0x23a6, 0x09fe,
+	    0x0000, 0x0000, 0x0000, 0x0b94, 0x0715, 0x02d7, 0x075d, 0x15a0,
+	    0x48ca, 0x4d8b, 0x25f4, 0x1f7a, 0x0125, 0x4d22, 0x1ab4, 0x2f77,
+	    0x0ab5, 0x0000, 0x4d53, 0x28a9, 0x039e, 0x0000, 0x0000, 0x369e,
+	    0x0877, 0x0000, 0x2e01, 0x0e7e, 0x3760, 0x3f80, 0x3485, 0x20ce,
+	    0x14b0, 0x03d6, 0x0000, 0x4020, 0x0000, 0x4614, 0x3e1e, 0x062c,
+	    0x3292, 0x2731, 0x3eb2, 0x162c, 0x2f41, 0x4499, 0x08ba, 0x0000,
+	    0x35ba, 0x2115, 0x02e0, 0x16b9, 0x20ff, 0x3080, 0x4640, 0x44ce,
+	    0x0000, 0x3627, 0x0000, 0x22bb, 0x0a8c, 0x05b2, 0x0000, 0x0081,
+	    0x4a9c, 0x3495, 0x0000, 0x0000, 0x294b, 0x0496, 0x3b92, 0x0000,
+	    0x0000, 0x361f, 0x0d89, 0x0166, 0x0c48, 0x1056, 0x0e54, 0x3e36,
+	    0x1ef5, 0x466d, 0x0000, 0x46d7, 0x157a, 0x02f2, 0x3c9a, 0x0000,
+	    0x06df, 0x0760, 0x4159, 0x04a5, 0x0870, 0x1226, 0x0c54, 0x3280,
+	    0x1625, 0x1430, 0x448d, 0x386e, 0x0000, 0x32f9, 0x125b, 0x41bb,
+	    0x3844, 0x3457, 0x0060, 0x00b0, 0x2e65, 0x0e37, 0x3dd2, 0x1db1,
+	    0x4805, 0x1462, 0x3d45, 0x01a4, 0x45e0, 0x2e6b, 0x2324, 0x1312,
+	    0x317a, 0x2d65, 0x4b24, 0x45d4, 0x178c, 0x3711, 0x160e, 0x27a2,
+	    0x0000, 0x1bcf, 0x0dcc, 0x0000, 0x0000, 0x0861, 0x1423, 0x4049,
+	    0x0000, 0x2bea, 0x4b4f, 0x3bfe, 0x0544, 0x3e5d, 0x0000, 0x24c7,
+	    0x4b03, 0x0000, 0x2528, 0x4bed, 0x275c, 0x0000, 0x0d84, 0x09c8,
+	    0x3f41, 0x25bb, 0x159b, 0x2f50, 0x3cd1, 0x0a14, 0x29be, 0x09ed,
+	    0x21b6, 0x0645, 0x1332, 0x396f, 0x4609, 0x3d0f, 0x24dc, 0x0000,
+	    0x0ac9, 0x2d5f, 0x1ae0, 0x1c32, 0x0559, 0x0000, 0x4846, 0x243f,
+	    0x43f7, 0x3fac, 0x45b3, 0x11e9, 0x3e45, 0x013e, 0x15de, 0x3e9c,
+	    0x3cfa, 0x0000, 0x3da4, 0x0298, 0x2aef, 0x084c, 0x0000, 0x3db4,
+	    0x297f, 0x29c5, 0x06ab, 0x2de3, 0x2374, 0x25e2, 0x3472, 0x20da,
+	    0x2893, 0x31c7, 0x0dd0, 0x3606, 0x4779, 0x0749, 0x13be, 0x0000,
+	    0x2497, 0x12f7, 0x07ee, 0x0000, 0x07dc, 0x2f8d, 0x2c1e, 0x32dc,
+	    0x43a2, 0x2bb5, 0x462b, 0x0bae, 0x17e5, 0x04c1, 0x0d93, 0x04dc,
+	    0x04aa, 0x49b1, 0x0e33, 0x21c9, 0x03dc, 0x3c10, 0x2ce9, 0x0168,
+	    0x31f5, 0x0000, 0x465f, 0x3503, 0x0000, 0x2ad6, 0x0b8b, 0x2628,
+	    0x210b, 0x0247, 0x0000, 0x26d3, 0x0000, 0x32e1, 0x3ffe, 0x43c8,
+	    0x03a5, 0x445b, 0x0000, 0x1650, 0x08c2, 0x47d6, 0x4d46, 0x35b7,
+	    0x46ef, 0x0000, 0x0000, 0x0000, 0x2785, 0x1b37, 0x4dd5, 0x0000,
+	    0x0366, 0x0000, 0x4809, 0x34a2, 0x3be0, 0x0000, 0x3ac1, 0x1ddd,
+	    0x2663, 0x0000, 0x4d92, 0x3cf6, 0x38af, 0x3b7c, 0x0000, 0x0000,
+	    0x057c, 0x2d62, 0x47b5, 0x0c01, 0x16ee, 0x2c95, 0x1a32, 0x0000,
+	    0x03fb, 0x42d2, 0x0d77, 0x274c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2b92, 0x0000, 0x278a, 0x435b, 0x3312, 0x0b2f, 0x15a4, 0x32f7,
+	    0x33b9, 0x488d, 0x2e33, 0x19fa, 0x0c5a, 0x488a, 0x0000, 0x0c2e,
+	    0x0000, 0x1729, 0x14f7, 0x23ae, 0x4c1e, 0x3bd0, 0x43f5, 0x2411,
+	    0x32bc, 0x208b, 0x33f2, 0x2f12, 0x0000, 0x4b2f, 0x2249, 0x1c60,
+	    0x12e7, 0x25ba, 0x2702, 0x0bc4, 0x2815, 0x3638, 0x30e4, 0x25b2,
+	    0x32cf, 0x107d, 0x2bb8, 0x00b5, 0x0000, 0x05d4, 0x276d, 0x00e9,
+	    0x28c6, 0x4543, 0x15fc, 0x3e1c, 0x4a5b, 0x0000, 0x4370, 0x0b3a,
+	    0x19cb, 0x3da7, 0x4081, 0x4ae1, 0x0363, 0x2046, 0x36ee, 0x0f2d,
+	    0x0c4a, 0x27b3, 0x1feb, 0x322a, 0x0000, 0x02ab, 0x0542, 0x2cc6,
+	    0x2346, 0x037e, 0x074f, 0x0000, 0x34dc, 0x35e3, 0x060d, 0x359b,
+	    0x207f, 0x04b2, 0x0a50, 0x11b8, 0x4583, 0x0f10, 0x0000, 0x00fc,
+	    0x2530, 0x331e, 0x1cad, 0x3159, 0x2ec7, 0x4924, 0x4105, 0x2ae6,
+	    0x02c9, 0x0000, 0x41a2, 0x4363, 0x1179, 0x2c23, 0x144e, 0x27bd,
+	    0x3328, 0x0000, 0x0866, 0x3ad6, 0x3b7a, 0x2dc8, 0x2736, 0x4562,
+	    0x4d5a, 0x031a, 0x48d0, 0x0320, 0x074e, 0x475a, 0x2806, 0x3af6,
+	    0x1019, 0x0000, 0x463a, 0x38b5, 0x0000, 0x12fc, 0x2635, 0x3d2e,
+	    0x21fe, 0x2ab9, 0x0000, 0x193e, 0x0bca, 0x0000, 0x3a45, 0x36c9,
+	    0x2d2d, 0x2ab6, 0x2e11, 0x0a7f, 0x3d9d, 0x1a0e, 0x2b7a, 0x2ca7,
+	    0x15f4, 0x1c6a, 0x2bb0, 0x1b44, 0x2786, 0x49ec, 0x0000, 0x1444,
+	    0x0aee, 0x16a7, 0x370d, 0x12c0, 0x1acf, 0x131c, 0x45cc, 0x220f,
+	    0x1168, 0x0000, 0x1398, 0x0f28, 0x23ca, 0x2297, 0x1898, 0x2790,
+	    0x0000, 0x3bde, 0x4045, 0x4288, 0x3270, 0x44ad, 0x2d15, 0x4aef,
+	    0x0000, 0x0817, 0x4abe, 0x4e1e, 0x481f, 0x0cfa, 0x0aae, 0x4a5a,
+	    0x0000, 0x3020, 0x2032, 0x1563, 0x323b, 0x32a7, 0x0000, 0x22dc,
+	    0x0000, 0x0000, 0x13ea, 0x0a78, 0x0282, 0x0000, 0x0000, 0x3954,
+	    0x14e8, 0x0bb9, 0x0000, 0x22a3, 0x0275, 0x1c74, 0x08fe, 0x1931,
+	    0x2c47, 0x047a, 0x1b68, 0x0000, 0x14b1, 0x29b6, 0x0000, 0x0be4,
+	    0x1973, 0x1dc3, 0x2370, 0x4364, 0x0cd8, 0x4d7a, 0x37f8, 0x0000,
+	    0x3a56, 0x0000, 0x0000, 0x0308, 0x44c5, 0x4c0f, 0x2a86, 0x26ff,
+	    0x47de, 0x0de6, 0x41c4, 0x0000, 0x2354, 0x4272, 0x314e, 0x41d5,
+	    0x31e8, 0x23ff, 0x0476, 0x3f63, 0x0ed5, 0x3077, 0x1dbd, 0x0b44,
+	    0x3b85, 0x354e, 0x0000, 0x0000, 0x1e74, 0x35fe, 0x19e8, 0x2c41,
+	    0x0000, 0x1841, 0x10d8, 0x28d5, 0x0bbb, 0x0000, 0x4325, 0x1404,
+	    0x4882, 0x2f99, 0x0000, 0x0350, 0x06ce, 0x0c92, 0x3476, 0x3053,
+	    0x1ee6, 0x4cc0, 0x04b6, 0x1c94, 0x4a60, 0x3f00, 0x1cd0, 0x3146,
+	    0x4a38, 0x0000, 0x3fa8, 0x06f5, 0x1239, 0x0890, 0x0dcd, 0x159b,
+	    0x2aec, 0x0000, 0x4170, 0x401f, 0x4119, 0x0000, 0x0000, 0x483e,
+	    0x1ced, 0x1e1b, 0x21c3, 0x3722, 0x28e9, 0x35f4, 0x2970, 0x3a73,
+	    0x2649, 0x242b, 0x0000, 0x0000, 0x2441, 0x0000, 0x3f9e, 0x1559,
+	    0x30bf, 0x29ff, 0x4d5b, 0x1c66, 0x28bc, 0x3791, 0x2da1, 0x1de2,
+	    0x0f0a, 0x15f8, 0x1aa9, 0x2507, 0x0000, 0x0000, 0x0e77, 0x0000,
+	    0x0e57, 0x1f3a, 0x49fc, 0x1edc, 0x1feb, 0x1880, 0x359f, 0x2e90,
+	    0x4032, 0x3059, 0x1b32, 0x1a9b, 0x27da, 0x20ef, 0x0de8, 0x02d3,
+	    0x0eac, 0x0299, 0x0cab, 0x2a1a, 0x0000, 0x0803, 0x178a, 0x38db,
+	    0x3554, 0x32ae, 0x4058, 0x0675, 0x3abd, 0x00a1, 0x4cf7, 0x00be,
+	    0x29f7, 0x470e, 0x36aa, 0x009d, 0x37a7, 0x495c, 0x0000, 0x0000,
+	    0x2f15, 0x2f35, 0x407d, 0x3b05, 0x4927, 0x0000, 0x0e45, 0x40c6,
+	    0x0927, 0x2732, 0x0000, 0x28eb, 0x44f1, 0x2faa, 0x4dba, 0x305d,
+	    0x1982, 0x0000, 0x0000, 0x20cc, 0x3741, 0x45bb, 0x1aab, 0x1451,
+	    0x0c32, 0x22a7, 0x3fd0, 0x0c0e, 0x0000, 0x2f22, 0x2256, 0x0260,
+	    0x2241, 0x1daf, 0x33c0, 0x0219, 0x0000, 0x0000, 0x0af2, 0x3fb4,
+	    0x1876, 0x2709, 0x2d05, 0x0000, 0x02fa, 0x2167, 0x371f, 0x4983,
+	    0x2caa, 0x31e4, 0x07fc, 0x3efb, 0x3c02, 0x1219, 0x4547, 0x0000,
+	    0x4259, 0x2b83, 0x09f3, 0x18b1, 0x3f59, 0x2640, 0x06ba, 0x3938,
+	    0x2b54, 0x408f, 0x0000, 0x07ac, 0x376a, 0x12a6, 0x309e, 0x0000,
+	    0x0fe4, 0x3469, 0x2602, 0x457d, 0x3ed4, 0x2109, 0x257c, 0x0000,
+	    0x4a9c, 0x0ca0, 0x4bff, 0x03fc, 0x39cf, 0x0b43, 0x02dd, 0x1caa,
+	    0x249e, 0x33d7, 0x1461, 0x2cfd, 0x1ba7, 0x445d, 0x3f1d, 0x4c30,
+	    0x1b8f, 0x1e22, 0x0522, 0x0000, 0x441d, 0x0e6d, 0x11c0, 0x0c7b,
+	    0x2e06, 0x19d5, 0x0000, 0x0f22, 0x4058, 0x3b89, 0x4536, 0x4403,
+	    0x0643, 0x0000, 0x0000, 0x3b47, 0x1b99, 0x10b9, 0x2f6d, 0x36f5,
+	    0x4699, 0x2c60, 0x1441, 0x354f, 0x2fab, 0x3541, 0x0f07, 0x1120,
+	    0x4460, 0x37d1, 0x2389, 0x0000, 0x15ea, 0x3766, 0x1524, 0x0000,
+	    0x23f9, 0x3403, 0x22e4, 0x4b61, 0x1a64, 0x1dd0, 0x0000, 0x2a23,
+	    0x00b5, 0x2e01, 0x1f5f, 0x1633, 0x0845, 0x17c7, 0x3214, 0x1b67,
+	    0x0000, 0x2378, 0x3fdb, 0x1b36, 0x179e, 0x1e82, 0x0f2f, 0x131e,
+	    0x19d8, 0x123b, 0x1ce3, 0x05b0, 0x0000, 0x1acd, 0x2818, 0x0000,
+	    0x34a7, 0x0000, 0x06b4, 0x332f, 0x2eee, 0x42ec, 0x0436, 0x1da3,
+	    0x1a54, 0x27f0, 0x1c77, 0x0000, 0x0000, 0x0617, 0x4bd6, 0x1eda,
+	    0x2dd9, 0x42d2, 0x3eff, 0x3d5b, 0x3832, 0x36cc, 0x4be0, 0x0274,
+	    0x2f60, 0x2e25, 0x0000, 0x0ed9, 0x1d59, 0x2634, 0x0ecb, 0x0671,
+	    0x49dc, 0x0000, 0x0000, 0x093b, 0x1719, 0x37d6, 0x39dc, 0x100f,
+	    0x2f56, 0x0a6c, 0x02ab, 0x20f0, 0x3179, 0x10af, 0x4a03, 0x4df6,
+	    0x0db3, 0x09ca, 0x2a9b, 0x1679, 0x10d6, 0x0fe2, 0x0000, 0x0572,
+	    0x32d2, 0x088b, 0x09fb, 0x2b3d, 0x43ad, 0x43f7, 0x2f71, 0x3ff7,
+	    0x1e59, 0x1661, 0x2a6d, 0x038d, 0x4d8e, 0x149b, 0x03bb, 0x0000,
+	    0x133f, 0x4b8e, 0x06bc, 0x1045, 0x09c9, 0x365e, 0x0000, 0x3593,
+	    0x0000, 0x37a2, 0x0000, 0x2956, 0x4832, 0x0000, 0x472e, 0x2369,
+	    0x2c48, 0x13bd, 0x0000, 0x3c08, 0x17a1, 0x27e1, 0x2ecc, 0x1ce3,
+	    0x44a8, 0x376c, 0x38b0, 0x1b50, 0x13ae, 0x0e1e, 0x0000, 0x0000,
+	    0x0000, 0x2d50, 0x2db4, 0x3fc1, 0x439c, 0x2169, 0x02aa, 0x31e2,
+	    0x39b3, 0x3fe8, 0x0524, 0x4911, 0x405d, 0x2f3a, 0x4ba5, 0x3a49,
+	    0x2c85, 0x321e, 0x3b6b, 0x2850, 0x0ce6, 0x128a, 0x0051, 0x34e9,
+	    0x1a92, 0x3f21, 0x16a4, 0x44fc, 0x0ba9, 0x3a8b, 0x0000, 0x4ca9,
+	    0x09f2, 0x38ed, 0x0000, 0x0000, 0x0000, 0x4a25, 0x38f7, 0x45c4,
+	    0x08c5, 0x232d, 0x1ed0, 0x0205, 0x286f, 0x0260, 0x22ae, 0x2149,
+	    0x0000, 0x305a, 0x4350, 0x3f16, 0x4259, 0x419d, 0x1309, 0x4719,
+	    0x0000, 0x1a43, 0x07db, 0x2538, 0x2fbb, 0x0000, 0x07bc, 0x2f0b,
+	    0x3af2, 0x29a8, 0x00b0, 0x0cce, 0x1a41, 0x0000, 0x0000, 0x1cd0,
+	    0x080f, 0x34fb, 0x2a60, 0x0410, 0x1de2, 0x2e10, 0x0057, 0x24c1,
+	    0x36f4, 0x06b7, 0x0e01, 0x2c73, 0x324b, 0x218c, 0x0d22, 0x327a,
+	    0x0ed8, 0x4738, 0x16c0, 0x3700, 0x0753, 0x0000, 0x0863, 0x4c30,
+	    0x0f7a, 0x1143, 0x4b06, 0x23a5, 0x25a3, 0x3dae, 0x2a5f, 0x3120,
+	    0x065c, 0x2f55, 0x0c17, 0x1b20, 0x4d06, 0x16d1, 0x2536, 0x3577,
+	    0x4d28, 0x4e02, 0x19bd, 0x29ee, 0x0000, 0x2619, 0x0000, 0x2aa5,
+	    0x3190, 0x0000, 0x0000, 0x38c6, 0x41bd, 0x301d, 0x2d10, 0x0cf5,
+	    0x0000, 0x29a6, 0x20ce, 0x1078, 0x3b39, 0x1e08, 0x2738, 0x2daa,
+	    0x11d3, 0x4af8, 0x2732, 0x0f8d, 0x4359, 0x0000, 0x45e9, 0x3d80,
+	    0x3a5a, 0x158a, 0x4016, 0x35f5, 0x3da0, 0x21a7, 0x0000, 0x27d4,
+	    0x386d, 0x0b54, 0x1a3c, 0x0013, 0x15bc, 0x3532, 0x3336, 0x4500,
+	    0x08c5, 0x2278, 0x0f85, 0x193d, 0x1b99, 0x3fd0, 0x098c, 0x28a4,
+	    0x30fd, 0x4775, 0x369a, 0x0000, 0x4cda, 0x103c, 0x0714, 0x0127,
+	    0x45ba, 0x0000, 0x0941, 0x0817, 0x0000, 0x10ec, 0x2b0f, 0x239f,
+	    0x0000, 0x0000, 0x0000, 0x1e99, 0x304e, 0x0000, 0x0000, 0x0000,
+	    0x4dd7, 0x0eac, 0x2a1b, 0x1e11, 0x3df3, 0x00bb, 0x3ad8, 0x3675,
+	    0x1cad, 0x3e00, 0x24a7, 0x0370, 0x1112, 0x1679, 0x0ad4, 0x3123,
+	    0x0bfd, 0x0000, 0x0e12, 0x41cd, 0x23e1, 0x2125, 0x23c9, 0x1418,
+	    0x0000, 0x0000, 0x2bc4, 0x1233, 0x16a2, 0x2f96, 0x454f, 0x1773,
+	    0x0000, 0x1b74, 0x026d, 0x3668, 0x2525, 0x2a62, 0x2781, 0x2032,
+	    0x0000, 0x35c5, 0x4049, 0x0000, 0x0000, 0x0c8d, 0x271d, 0x421e,
+	    0x0a51, 0x3ada, 0x07cc, 0x1e87, 0x3c75, 0x14e7, 0x0f1b, 0x0535,
+	    0x3a8e, 0x4ad9, 0x297b, 0x3b26, 0x048a, 0x2096, 0x1404, 0x1d0b,
+	    0x1711, 0x1de7, 0x3eba, 0x26c1, 0x35d3, 0x0000, 0x19ba, 0x0000,
+	    0x0d57, 0x0000, 0x1045, 0x0000, 0x1670, 0x1543, 0x1676, 0x17a2,
+	    0x00a1, 0x48ab, 0x3251, 0x382c, 0x0baf, 0x02cb, 0x26b1, 0x0000,
+	    0x0000, 0x23a5, 0x0000, 0x0000, 0x3d43, 0x0a65, 0x2924, 0x088e,
+	    0x048e, 0x0000, 0x0b6e, 0x475e, 0x42d3, 0x2087, 0x0000, 0x3f50,
+	    0x0828, 0x391f, 0x2490, 0x120a, 0x3f61, 0x31b1, 0x0813, 0x117b,
+	    0x142a, 0x448e, 0x4a00, 0x460b, 0x2146, 0x0000, 0x1a3c, 0x0000,
+	    0x4ca9, 0x1085, 0x0000, 0x1811, 0x1a1d, 0x0000, 0x434c, 0x414a,
+	    0x454f, 0x0000, 0x34e3, 0x24d2, 0x238b, 0x3630, 0x269f, 0x286f,
+	    0x267d, 0x10f4, 0x0629, 0x2052, 0x1147, 0x0000, 0x1054, 0x0ddc,
+	    0x3c12, 0x2b66, 0x0000, 0x0dd5, 0x4a17, 0x2c72, 0x2150, 0x0000,
+	    0x3296, 0x4c1e, 0x19c6, 0x0000, 0x123c, 0x3c74, 0x1a9c, 0x0568,
+	    0x39c3, 0x0000, 0x190d, 0x3105, 0x2efb, 0x0000, 0x1101, 0x1bd5,
+	    0x2444, 0x04b0, 0x2c0d, 0x357e, 0x416f, 0x0bb2, 0x358a, 0x1067,
+	    0x0021, 0x2128, 0x2581, 0x17d9, 0x01cb, 0x359b, 0x2b25, 0x0000,
+	    0x1210, 0x2d63, 0x02f1, 0x17b9, 0x17eb, 0x001a, 0x0700, 0x07f2,
+	    0x30a5, 0x0fb9, 0x1863, 0x2192, 0x2d6d, 0x4cbc, 0x4da7, 0x415f,
+	    0x0000, 0x3fd6, 0x1286, 0x050a, 0x03d1, 0x2209, 0x0d61, 0x2628,
+	    0x409f, 0x1392, 0x0000, 0x2115, 0x0f35, 0x4c31, 0x1dee, 0x4850,
+	    0x05f8, 0x3a0e, 0x33ba, 0x04ee, 0x33ab, 0x08fa, 0x4aa7, 0x0230,
+	    0x0484, 0x20eb, 0x1bef, 0x2cbc, 0x0000, 0x3c2e, 0x3c44, 0x2869,
+	    0x0acc, 0x16fa, 0x303c, 0x2d37, 0x0184, 0x0000, 0x4d11, 0x07df,
+	    0x0000, 0x20c8, 0x0336, 0x0166, 0x2e49, 0x0000, 0x2381, 0x0000,
+	    0x3056, 0x402c, 0x1717, 0x0000, 0x0184, 0x0421, 0x107d, 0x0000,
+	    0x2bdd, 0x45fa, 0x330b, 0x03be, 0x439f, 0x35d0, 0x1ff1, 0x2ae1,
+	    0x3704, 0x0000, 0x439e, 0x0000, 0x2407, 0x4b59, 0x33a7, 0x0000,
+	    0x3b1e, 0x3370, 0x20ff, 0x3e30, 0x0000, 0x2f8d, 0x13ef, 0x0b7d,
+	    0x4d25, 0x0000, 0x23ef, 0x005a, 0x0000, 0x31b4, 0x3dcb, 0x2a5e,
+	    0x0000, 0x4027, 0x283e, 0x33ce, 0x0d29, 0x125d, 0x0000, 0x4829,
+	    0x0f11, 0x0000, 0x35ab, 0x153b, 0x3249, 0x2ca6, 0x273f, 0x2811,
+	    0x0ecd, 0x1f7c, 0x4826, 0x0000, 0x0cb3, 0x2ef3, 0x2c11, 0x49a7,
+	    0x1795, 0x0000, 0x18a4, 0x48fa, 0x01b7, 0x3ccc, 0x4b39, 0x0000,
+	    0x0000, 0x41e2, 0x486f, 0x4668, 0x4a9e, 0x3aed, 0x2d72, 0x440d,
+	    0x089c, 0x1bff, 0x3ca0, 0x0f23, 0x029d, 0x13f2, 0x17bb, 0x4dc0,
+	    0x1c2e, 0x3b33, 0x1ce1, 0x00de, 0x2bc0, 0x38dd, 0x25ab, 0x0fc7,
+	    0x124a, 0x0000, 0x3715, 0x2848, 0x3fef, 0x1aa4, 0x3a56, 0x2596,
+	    0x2aa6, 0x2290, 0x0af4, 0x13e8, 0x008a, 0x05e3, 0x0ad9, 0x4cbc,
+	    0x055a, 0x0000, 0x2a23, 0x2bf2, 0x13d1, 0x113a, 0x0000, 0x3cc8,
+	    0x2621, 0x40b5, 0x0000, 0x0000, 0x0000, 0x0000, 0x1548, 0x1fb2,
+	    0x205b, 0x2c66, 0x1c79, 0x0000, 0x0000, 0x2396, 0x26ca, 0x0000,
+	    0x0000, 0x2cf1, 0x0000, 0x2d69, 0x495b, 0x320a, 0x360f, 0x1c2b,
+	    0x0348, 0x3bf2, 0x33c3, 0x4bc7, 0x1a9e, 0x2c1e, 0x469b, 0x331d,
+	    0x39bd, 0x1324, 0x0000, 0x0000, 0x3931, 0x2d42, 0x0000, 0x035f,
+	    0x0000, 0x30f3, 0x3879, 0x2c05, 0x0000, 0x1ea2, 0x0000, 0x4bd3,
+	    0x2bd7, 0x0a65, 0x43fe, 0x2347, 0x316b, 0x07cd, 0x40b3, 0x0000,
+	    0x2dbb, 0x1e1d, 0x0000, 0x46d8, 0x0cb6, 0x1922, 0x471a, 0x0560,
+	    0x0000, 0x401b, 0x2a7a, 0x20f2, 0x19e4, 0x22b1, 0x3251, 0x03ad,
+	    0x0000, 0x4bbb, 0x000f, 0x069e, 0x3e73, 0x0eed, 0x3cda, 0x08d0,
+	    0x495f, 0x04ae, 0x01b5, 0x32a6, 0x026f, 0x25c0, 0x0000, 0x06b5,
+	    0x3dd9, 0x18c5, 0x0000, 0x4d01, 0x4b89, 0x2224, 0x10e7, 0x031b,
+	    0x1e17, 0x242f, 0x00f7, 0x110f, 0x0bdd, 0x2c8b, 0x0000, 0x1401,
+	    0x369f, 0x0942, 0x1519, 0x4c1d, 0x21f5, 0x08ce, 0x27b2, 0x0c92,
+	    0x10b7, 0x4a45, 0x2664, 0x37d8, 0x30d3, 0x0000, 0x0000, 0x342b,
+	    0x0000, 0x0664, 0x0000, 0x2e24, 0x16e3, 0x28c1, 0x1bce, 0x1a19,
+	    0x20c6, 0x236e, 0x0000, 0x1f9b, 0x3a3a, 0x191c, 0x21f5, 0x1c5d,
+	    0x3c1f, 0x0c4b, 0x3765, 0x4319, 0x33fa, 0x0000, 0x175a, 0x1be7,
+	    0x1064, 0x3121, 0x201f, 0x0045, 0x48e5, 0x0000, 0x38b1, 0x0000,
+	    0x3bb4, 0x05a3, 0x2770, 0x18ab, 0x3dfd, 0x2f95, 0x2a73, 0x3b41,
+	    0x3853, 0x0000, 0x0000, 0x48fb, 0x0000, 0x36bc, 0x0000, 0x0000,
+	    0x1845, 0x2b1e, 0x2ac2, 0x0000, 0x4c03, 0x474b, 0x1244, 0x0000,
+	    0x4b1e, 0x1443, 0x1d31, 0x1681, 0x0ebe, 0x4688, 0x0465, 0x0aed,
+	    0x3fef, 0x1640, 0x43c0, 0x29b2, 0x2220, 0x0000, 0x1165, 0x03c2,
+	    0x1d03, 0x1ce6, 0x0000, 0x2076, 0x1f92, 0x0631, 0x1ec7, 0x0000,
+	    0x324f, 0x3c66, 0x11e6, 0x3748, 0x181c, 0x22cb, 0x0f70, 0x0afa,
+	    0x0000, 0x0536, 0x0000, 0x1331, 0x2884, 0x07c7, 0x1669, 0x2d49,
+	    0x04c3, 0x0000, 0x19d2, 0x3d68, 0x4df5, 0x251e, 0x0f23, 0x0000,
+	    0x0e77, 0x1e5c, 0x18a5, 0x09f0, 0x21ff, 0x4207, 0x4d4e, 0x4c03,
+	    0x0000, 0x3315, 0x0000, 0x279d, 0x14d9, 0x40a6, 0x2269, 0x3064,
+	    0x110b, 0x4db3, 0x3cf9, 0x0000, 0x0000, 0x3db9, 0x45a5, 0x4370,
+	    0x3eea, 0x1a9a, 0x244b, 0x14cc, 0x0f40, 0x0000, 0x3c02, 0x458e,
+	    0x3b0a, 0x1b49, 0x03d3, 0x3b7c, 0x0000, 0x3fb4, 0x36eb, 0x427e,
+	    0x0000, 0x1b6f, 0x23fe, 0x2e83, 0x00e0, 0x2479, 0x0000, 0x3685,
+	    0x2dcb, 0x0e89, 0x0000, 0x4b54, 0x3ece, 0x3609, 0x0000, 0x25da,
+	    0x0000, 0x22bb, 0x3745, 0x2e5b, 0x11d8, 0x4cf4, 0x4c9d, 0x2d49,
+	    0x46e1, 0x44f0, 0x37fe, 0x0dbe, 0x0000, 0x4d31, 0x14d1, 0x493d,
+	    0x190a, 0x172b, 0x462e, 0x2860, 0x192c, 0x31fc, 0x2737, 0x1184,
+	    0x418b, 0x3d6a, 0x1729, 0x0000, 0x07a9, 0x0000, 0x0303, 0x4d1d,
+	    0x4b4b, 0x0e5c, 0x351f, 0x2cf4, 0x0000, 0x4a53, 0x0000, 0x24e9,
+	    0x0000, 0x2cf3, 0x2e1c, 0x128b, 0x49dd, 0x059d, 0x0000, 0x41a7,
+	    0x0000, 0x31e6, 0x4440, 0x0000, 0x08a5, 0x32ce, 0x200c, 0x0000,
+	    0x4be2, 0x0000, 0x2315, 0x0000, 0x0653, 0x37b2, 0x0000, 0x0000,
+	    0x0000, 0x2ad1, 0x29ab, 0x3e6b, 0x318e, 0x0000, 0x0000, 0x3617,
+	    0x0bea, 0x32d2, 0x0000, 0x3d8d, 0x14f9, 0x398c, 0x0000, 0x24cc,
+	    0x2a65, 0x0edf, 0x0ede, 0x0000, 0x150b, 0x0ba1, 0x49cb, 0x1b9f,
+	    0x0000, 0x0799, 0x0000, 0x24d0, 0x0000, 0x0000, 0x40ed, 0x20bd,
+	    0x4a5e, 0x3032, 0x2844, 0x2a30, 0x2d9f, 0x3997, 0x0000, 0x0000,
+	    0x211c, 0x0c55, 0x0000, 0x00a3, 0x0d05, 0x0000, 0x0218, 0x0956,
+	    0x0fbd, 0x1f98, 0x3f1f, 0x0000, 0x3342, 0x4af6, 0x2306, 0x1746,
+	    0x1b9f, 0x12d5, 0x1e78, 0x1893, 0x3c20, 0x0000, 0x40e2, 0x002d,
+	    0x31c0, 0x2e6e, 0x14a1, 0x11e7, 0x2ccf, 0x0c07, 0x2b31, 0x0000,
+	    0x0000, 0x4271, 0x0000, 0x398b, 0x0569, 0x44b2, 0x0b1f, 0x22a5,
+	    0x0000, 0x0000, 0x1ba2, 0x0000, 0x0000, 0x48d2, 0x1f42, 0x486d,
+	    0x4c8b, 0x0000, 0x3a5d, 0x29b2, 0x0000, 0x4140, 0x0000, 0x4689,
+	    0x3997, 0x2ed1, 0x3e8c, 0x017b, 0x271f, 0x4485, 0x3b3c, 0x1080,
+	    0x2d3b, 0x1581, 0x208b, 0x31d9, 0x0000, 0x0000, 0x0000, 0x0038,
+	    0x0084, 0x4392, 0x32f2, 0x0000, 0x03c9, 0x0000, 0x1c3d, 0x0000,
+	    0x3584, 0x0f8e, 0x2fb9, 0x1cfb, 0x3314, 0x3012, 0x3f0d, 0x3081,
+	    0x15dd, 0x11cb, 0x0fab, 0x3cba, 0x182c, 0x1622, 0x4658, 0x0096,
+	    0x175e, 0x1622, 0x4244, 0x0000, 0x0cbf, 0x2a28, 0x0000, 0x28f5,
+	    0x3caa, 0x1ca0, 0x31ee, 0x1061, 0x27c0, 0x0000, 0x0000, 0x147c,
+	    0x27c3, 0x3154, 0x139f, 0x1dac, 0x2130, 0x34da, 0x24d8, 0x3880,
+	    0x1efb, 0x4cd6, 0x248c, 0x02a0, 0x1aad, 0x1e53, 0x188c, 0x1298,
+	    0x1edc, 0x0c3c, 0x020b, 0x2da8, 0x1b27, 0x03f6, 0x17fc, 0x0000,
+	    0x267d, 0x3c13, 0x104b, 0x0000, 0x4398, 0x0121, 0x1ec3, 0x140c,
+	    0x144b, 0x1ef3, 0x09c8, 0x48c6, 0x2c74, 0x0000, 0x394c, 0x193d,
+	    0x0e8a, 0x429e, 0x14c1, 0x14d4, 0x2834, 0x0000, 0x4217, 0x4d53,
+	    0x0000, 0x3021, 0x3f36, 0x0866, 0x0000, 0x121f, 0x1dc3, 0x21d4,
+	    0x1059, 0x1a78, 0x425f, 0x4196, 0x1be3, 0x0000, 0x0000, 0x3a07,
+	    0x2ee7, 0x3651, 0x4dfc, 0x0000, 0x4dc6, 0x0779, 0x0000, 0x0000,
+	    0x0000, 0x4a92, 0x0000, 0x0000, 0x0900, 0x0000, 0x22ed, 0x1083,
+	    0x2a2c, 0x1660, 0x0000, 0x0b87, 0x0000, 0x37da, 0x4642, 0x0000,
+	    0x2523, 0x0307, 0x2c73, 0x3023, 0x0000, 0x49b0, 0x2843, 0x4d90,
+	    0x31cc, 0x231a, 0x35df, 0x42cc, 0x2b5d, 0x3cb5, 0x450a, 0x1743,
+	    0x499f, 0x1ff1, 0x3337, 0x3131, 0x4359, 0x08bc, 0x4be2, 0x3362,
+	    0x131b, 0x102e, 0x2b81, 0x0e26, 0x0f14, 0x0000, 0x0000, 0x4aaf,
+	    0x1254, 0x033f, 0x1166, 0x1d0f, 0x0099, 0x2d84, 0x3833, 0x0000,
+	    0x2a1a, 0x29d0, 0x0df2, 0x439e, 0x0000, 0x0008, 0x3311, 0x20f7,
+	    0x4077, 0x4714, 0x3744, 0x0000, 0x1699, 0x0000, 0x24dd, 0x0000,
+	    0x1b97, 0x0000, 0x0b1c, 0x0380, 0x32b4, 0x3530, 0x3bf1, 0x3736,
+	    0x0782, 0x4c92, 0x1dca, 0x06f6, 0x0000, 0x0000, 0x3d22, 0x0000,
+	    0x0000, 0x2518, 0x2137, 0x0000, 0x3904, 0x3979, 0x3c66, 0x2aaf,
+	    0x184b, 0x3d28, 0x2133, 0x425e, 0x0000, 0x0000, 0x303e, 0x3735,
+	    0x4266, 0x28c5, 0x1d90, 0x0000, 0x29cf, 0x2994, 0x357b, 0x1d5f,
+	    0x0000, 0x19a4, 0x0000, 0x0000, 0x2284, 0x4990, 0x3c51, 0x42e0,
+	    0x24c5, 0x3c05, 0x070a, 0x085d, 0x0223, 0x20e5, 0x08f1, 0x226e,
+	    0x1a72, 0x47ff, 0x1bff, 0x462b, 0x2636, 0x2d66, 0x0d7e, 0x470d,
+	    0x0cd8, 0x44d7, 0x33c1, 0x0000, 0x0000, 0x05c4, 0x273b, 0x0000,
+	    0x2d3f, 0x313d, 0x30c8, 0x0000, 0x0a26, 0x2de6, 0x481f, 0x159f,
+	    0x0000, 0x0000, 0x4390, 0x0a56, 0x35dd, 0x2ad1, 0x1b4d, 0x494c,
+	    0x29fd, 0x0b35, 0x4004, 0x43d1, 0x4989, 0x076f, 0x169a, 0x10a3,
+	    0x0000, 0x15a6, 0x0000, 0x0000, 0x2eb8, 0x25d1, 0x0000, 0x0072,
+	    0x20d2, 0x0000, 0x1299, 0x3735, 0x3b8d, 0x3570, 0x09e5, 0x402a,
+	    0x24f0, 0x2670, 0x4165, 0x083e, 0x2dd0, 0x2831, 0x3da5, 0x0da4,
+	    0x4d53, 0x0af2, 0x4021, 0x1de0, 0x4156, 0x0000, 0x3ba6, 0x3b5f,
+	    0x07bb, 0x13d8, 0x4732, 0x051a, 0x2cbd, 0x0000, 0x4d74, 0x26b3,
+	    0x0c8b, 0x1f22, 0x2957, 0x0f03, 0x0000, 0x4091, 0x135a, 0x10e3,
+	    0x3510, 0x23a8, 0x0000, 0x3d23, 0x0000, 0x4cfb, 0x0000, 0x1ede,
+	    0x281f, 0x26ab, 0x22db, 0x2d1f, 0x15ff, 0x2faf, 0x0000, 0x2479,
+	    0x0a7d, 0x0000, 0x0285, 0x1544, 0x116b, 0x2d11, 0x07d2, 0x40b6,
+	    0x0000, 0x0000, 0x3981, 0x0000, 0x3807, 0x388f, 0x4acc, 0x4170,
+	    0x27bd, 0x1642, 0x3ca5, 0x2443, 0x20ae, 0x0000, 0x0c26, 0x0000,
+	    0x1940, 0x0c1a, 0x3f26, 0x0000, 0x3f43, 0x3a26, 0x107f, 0x4d5d,
+	    0x3a38, 0x3dd2, 0x0000, 0x1db6, 0x1351, 0x0000, 0x0000, 0x0000,
+	    0x1b8f, 0x0000, 0x0000, 0x491f, 0x3413, 0x19a5, 0x0715, 0x1110,
+	    0x0b3d, 0x218a, 0x154a, 0x46a6, 0x3b2d, 0x3678, 0x4c3f, 0x4213,
+	    0x1c1a, 0x0000, 0x14cb, 0x0594, 0x0000, 0x0000, 0x375d, 0x26ba,
+	    0x0000, 0x1020, 0x3188, 0x1bc0, 0x4505, 0x1980, 0x1529, 0x42d5,
+	    0x0000, 0x1a39, 0x12ad, 0x1bfb, 0x0000, 0x2330, 0x3bc4, 0x10cf,
+	    0x4789, 0x0cd2, 0x0000, 0x3117, 0x223b, 0x3845, 0x34a0, 0x3049,
+	    0x4d13, 0x0c25, 0x0000, 0x19da, 0x1841, 0x3716, 0x0000, 0x466a,
+	    0x36f0, 0x204e, 0x0000, 0x3627, 0x0df4, 0x07a1, 0x02d0, 0x4bfb,
+	    0x0000, 0x1e57, 0x0000, 0x0144, 0x2486, 0x0000, 0x0000, 0x070a,
+	    0x3d2a, 0x44ae, 0x29f4, 0x1a43, 0x0d96, 0x0000, 0x4af0, 0x3edb,
+	    0x415b, 0x3cdc, 0x3e8a, 0x1419, 0x1a33, 0x0000, 0x1977, 0x3a4e,
+	    0x0ed8, 0x4b65, 0x41d4, 0x437f, 0x25f9, 0x2778, 0x2ebc, 0x13af,
+	    0x0d36, 0x2ab7, 0x1307, 0x4a6d, 0x3d20, 0x0d6a, 0x1431, 0x4dee,
+	    0x1f8c, 0x4c33, 0x301f, 0x4301, 0x018c, 0x0000, 0x2eef, 0x4b7d,
+	    0x0000, 0x3191, 0x0e53, 0x1311, 0x1dfe, 0x3f92, 0x24fc, 0x0000,
+	    0x1b94, 0x4aed, 0x447c, 0x365a, 0x363d, 0x1e6d, 0x03fa, 0x046a,
+	    0x17fa, 0x0000, 0x3c9c, 0x0ef7, 0x0000, 0x0000, 0x0a74, 0x0000,
+	    0x163d, 0x06cc, 0x0000, 0x0000, 0x0000, 0x1694, 0x140d, 0x0527,
+	    0x2e81, 0x0000, 0x0000, 0x0d38, 0x0f3b, 0x08cb, 0x0000, 0x4873,
+	    0x0000, 0x0163, 0x4597, 0x0000, 0x4010, 0x0000, 0x0000, 0x2a17,
+	    0x3cb8, 0x1863, 0x2154, 0x0000, 0x0000, 0x0000, 0x088a, 0x0000,
+	    0x1508, 0x2224, 0x0d80, 0x00e5, 0x2ffe, 0x3e02, 0x4dc9, 0x3a22,
+	    0x2bce, 0x10f4, 0x21cd, 0x3a21, 0x4a00, 0x3422, 0x3f22, 0x179a,
+	    0x0b92, 0x4717, 0x09e1, 0x0578, 0x292b, 0x0000, 0x0000, 0x0d37,
+	    0x3163, 0x0000, 0x1d5c, 0x0000, 0x432b, 0x4a4c, 0x0000, 0x0cec,
+	    0x4156, 0x22c8, 0x2c76, 0x2111, 0x09ca, 0x4842, 0x47b1, 0x305c,
+	    0x2ec6, 0x4557, 0x482a, 0x14b5, 0x203b, 0x2c04, 0x3493, 0x3400,
+	    0x29a5, 0x0978, 0x0000, 0x049c, 0x39f8, 0x2d65, 0x213a, 0x0379,
+	    0x4d60, 0x2f3f, 0x43f4, 0x4e15, 0x04d4, 0x3796, 0x0000, 0x0000,
+	    0x3ece, 0x0000, 0x038d, 0x3c1a, 0x2feb, 0x2b57, 0x1542, 0x197b,
+	    0x4462, 0x0000, 0x008e, 0x0558, 0x2f8e, 0x2783, 0x1240, 0x3f86,
+	    0x0000, 0x037d, 0x21d1, 0x0a69, 0x0000, 0x0000, 0x13a1, 0x0000,
+	    0x1944, 0x3b8b, 0x4441, 0x1a19, 0x4569, 0x26ac, 0x347f, 0x3401,
+	    0x18e0, 0x3058, 0x4a8e, 0x09a9, 0x2b61, 0x4580, 0x3d87, 0x126b,
+	    0x0b05, 0x0f70, 0x0efc, 0x11d7, 0x1e89, 0x0000, 0x1280, 0x0000,
+	    0x406f, 0x2d21, 0x4b07, 0x06f6, 0x2d4b, 0x07fa, 0x40ea, 0x1f06,
+	    0x2cfa, 0x262b, 0x0985, 0x2494, 0x0000, 0x22e6, 0x0a7d, 0x0000,
+	    0x02d3, 0x1bb0, 0x31d6, 0x2cc9, 0x1777, 0x2b81, 0x11ce, 0x0000,
+	    0x1ac9, 0x016d, 0x305a, 0x4833, 0x4340, 0x3683, 0x2331, 0x194b,
+	    0x3f25, 0x0eff, 0x2f61, 0x0000, 0x0000, 0x28b6, 0x0000, 0x0000,
+	    0x441c, 0x1644, 0x4982, 0x025a, 0x2f70, 0x2544, 0x0000, 0x4835,
+	    0x0076, 0x0000, 0x2de4, 0x4c8e, 0x0000, 0x22c7, 0x31d6, 0x19fc,
+	    0x069f, 0x1786, 0x339d, 0x06ee, 0x13e9, 0x0000, 0x0000, 0x0000,
+	    0x47eb, 0x0ebe, 0x41f1, 0x3f6b, 0x019a, 0x40dd, 0x26db, 0x329b,
+	    0x0000, 0x0000, 0x2095, 0x0000, 0x0000, 0x3bea, 0x21aa, 0x3cac,
+	    0x3f17, 0x0ccb, 0x0000, 0x3fc5, 0x094b, 0x401d, 0x38a6, 0x2a3b,
+	    0x0ffc, 0x0000, 0x07f8, 0x0000, 0x3da9, 0x3997, 0x49e7, 0x41ae,
+	    0x0510, 0x20a9, 0x0f65, 0x0000, 0x0000, 0x0000, 0x3da2, 0x0000,
+	    0x2a9a, 0x306f, 0x0000, 0x4bbe, 0x20e3, 0x0000, 0x43db, 0x21e5,
+	    0x4517, 0x1e3b, 0x4968, 0x3eef, 0x2451, 0x0000, 0x3098, 0x09e8,
+	    0x1456, 0x0000, 0x18f7, 0x2816, 0x3a5a, 0x2e0d, 0x0000, 0x49ed,
+	    0x047d, 0x0256, 0x1331, 0x3dd9, 0x0000, 0x04ac, 0x233d, 0x0000,
+	    0x2dd0, 0x32ec, 0x3555, 0x4774, 0x1678, 0x4dd2, 0x0a12, 0x0ba4,
+	    0x2dfe, 0x005e, 0x25f4, 0x32df, 0x17ae, 0x1875, 0x168f, 0x1d9c,
+	    0x03ce, 0x2fa1, 0x2aa1, 0x1d85, 0x1454, 0x2420, 0x0a67, 0x3ce7,
+	    0x0900, 0x3ab6, 0x0784, 0x054d, 0x43b8, 0x1b72, 0x1823, 0x153a,
+	    0x27e2, 0x293b, 0x2bc3, 0x0987, 0x10a2, 0x0493, 0x391d, 0x2345,
+	    0x0653, 0x261c, 0x0418, 0x35ad, 0x1313, 0x4950, 0x239d, 0x0000,
+	    0x3373, 0x3653, 0x1a8a, 0x0cf1, 0x125d, 0x4013, 0x19e8, 0x067b,
+	    0x457e, 0x0000, 0x0000, 0x28fd, 0x49e5, 0x0000, 0x0dd5, 0x4afe,
+	    0x2b4c, 0x16da, 0x2df2, 0x24a4, 0x03d4, 0x0d4f, 0x17e2, 0x469c,
+	    0x24af, 0x40b2, 0x4079, 0x218d, 0x280f, 0x0000, 0x0607, 0x4103,
+	    0x0042, 0x1e62, 0x131c, 0x2ee5, 0x4a61, 0x0000, 0x3345, 0x02ef,
+	    0x0023, 0x184a, 0x0000, 0x0000, 0x0000, 0x457d, 0x1dcc, 0x0877,
+	    0x0ed6, 0x3234, 0x0000, 0x1d44, 0x343a, 0x3571, 0x1559, 0x1968,
+	    0x43b8, 0x0000, 0x3f0a, 0x2874, 0x14cc, 0x240e, 0x1ab8, 0x318b,
+	    0x0000, 0x2043, 0x36bf, 0x0080, 0x4c4a, 0x4161, 0x2ace, 0x4111,
+	    0x2172, 0x00ed, 0x2b68, 0x2838, 0x086b, 0x388c, 0x3226, 0x0000,
+	    0x27b0, 0x3571, 0x0000, 0x4039, 0x0397, 0x1886, 0x0a18, 0x0000,
+	    0x292e, 0x0aa7, 0x31e2, 0x3175, 0x3f2c, 0x06e0, 0x2a09, 0x2917,
+	    0x0000, 0x0000, 0x193a, 0x2bc4, 0x05b5, 0x23df, 0x1f21, 0x1341,
+	    0x0000, 0x410c, 0x4061, 0x2b9f, 0x02ec, 0x0d4a, 0x426b, 0x2812,
+	    0x0f38, 0x1cca, 0x2b0d, 0x1f48, 0x0e99, 0x201b, 0x2faf, 0x33d1,
+	    0x07ec, 0x2952, 0x0686, 0x46c3, 0x0e4e, 0x4297, 0x3295, 0x0817,
+	    0x0e39, 0x0464, 0x11ae, 0x2835, 0x0000, 0x01f4, 0x4ba0, 0x35df,
+	    0x0000, 0x2c20, 0x0000, 0x2797, 0x0864, 0x0000, 0x1aaf, 0x4cf6,
+	    0x01a9, 0x291a, 0x299a, 0x26c3, 0x0536, 0x4c14, 0x308b, 0x28bc,
+	    0x08f4, 0x12c7, 0x4c70, 0x1995, 0x2994, 0x1f8d, 0x35f1, 0x4c6d,
+	    0x22fe, 0x34cd, 0x0b44, 0x36d7, 0x07bf, 0x35ff, 0x3f87, 0x3e50,
+	    0x0000, 0x0000, 0x0000, 0x0a35, 0x0000, 0x260a, 0x433c, 0x20a2,
+	    0x1a45, 0x0000, 0x25a0, 0x0000, 0x3a4a, 0x0000, 0x0000, 0x0000,
+	    0x1dfb, 0x0000, 0x0000, 0x20de, 0x0000, 0x0000, 0x12e9, 0x0000,
+	    0x1981, 0x0041, 0x0000, 0x43ab, 0x2a70, 0x054f, 0x0e2d, 0x0361,
+	    0x1ec8, 0x3eb5, 0x1dc0, 0x3ac6, 0x2b0d, 0x1e0b, 0x4393, 0x2fde,
+	    0x4b8f, 0x49f9, 0x3eca, 0x24d4, 0x3150, 0x2a28, 0x304e, 0x0114,
+	    0x1343, 0x2de4, 0x1bda, 0x0000, 0x0654, 0x3a1a, 0x08a7, 0x3294,
+	    0x16b1, 0x2991, 0x04ad, 0x3a26, 0x461d, 0x49af, 0x0000, 0x4a36,
+	    0x3dff, 0x3b45, 0x2f66, 0x002d, 0x0af7, 0x2afb, 0x0000, 0x4b7a,
+	    0x49c4, 0x22f8, 0x124f, 0x393a, 0x0000, 0x4cf5, 0x06d9, 0x0000,
+	    0x18e2, 0x1528, 0x0314, 0x0000, 0x138a, 0x42e5, 0x0000, 0x2be5,
+	    0x4585, 0x0000, 0x42a0, 0x0000, 0x1549, 0x2bfd, 0x0b1a, 0x0740,
+	    0x0fa7, 0x0a82, 0x1abd, 0x08f9, 0x1cb8, 0x1c11, 0x0000, 0x382a,
+	    0x34f2, 0x4b2f, 0x4957, 0x0000, 0x3788, 0x08fe, 0x3be6, 0x27c6,
+	    0x007e, 0x435d, 0x1644, 0x3612, 0x342d, 0x360d, 0x0000, 0x0000,
+	    0x0212, 0x2853, 0x3a63, 0x1de1, 0x1402, 0x098d, 0x3fe0, 0x4b0a,
+	    0x4040, 0x3c5d, 0x33e6, 0x0000, 0x2be5, 0x0bf0, 0x3120, 0x2ced,
+	    0x3618, 0x3dfd, 0x29ad, 0x083a, 0x1b96, 0x483d, 0x4a34, 0x3321,
+	    0x1a9b, 0x0000, 0x1247, 0x108a, 0x0000, 0x21be, 0x0000, 0x265a,
+	    0x0000, 0x4870, 0x2cb0, 0x01ef, 0x0000, 0x0ba6, 0x0000, 0x4829,
+	    0x3ca9, 0x11be, 0x3326, 0x3414, 0x4bd6, 0x297d, 0x0701, 0x0832,
+	    0x2ed3, 0x3a51, 0x1d04, 0x21f7, 0x08cc, 0x0000, 0x4ddf, 0x0f21,
+	    0x43cf, 0x3ad0, 0x0634, 0x2936, 0x096a, 0x4972, 0x0208, 0x2bf9,
+	    0x0f56, 0x0000, 0x0000, 0x39c4, 0x18ce, 0x0e13, 0x1c1e, 0x3233,
+	    0x38d0, 0x25e6, 0x4789, 0x4645, 0x3c10, 0x0000, 0x35a1, 0x26a6,
+	    0x3da6, 0x15c7, 0x2705, 0x3956, 0x0000, 0x16ca, 0x08b0, 0x0bb2,
+	    0x0000, 0x1d34, 0x04ec, 0x00e6, 0x4293, 0x04ac, 0x3262, 0x2dcc,
+	    0x3e70, 0x3db7, 0x2e18, 0x132c, 0x387e, 0x142f, 0x0000, 0x2be4,
+	    0x0000, 0x0000, 0x362e, 0x439b, 0x4995, 0x0000, 0x1037, 0x3085,
+	    0x30a7, 0x1157, 0x0dc3, 0x1fbd, 0x0bdb, 0x41cf, 0x1c61, 0x0000,
+	    0x3373, 0x30eb, 0x0000, 0x3b26, 0x1727, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x359c, 0x4d0c, 0x485f, 0x4284, 0x07bf, 0x1825,
+	    0x3e39, 0x36dd, 0x1f0c, 0x4c4f, 0x3d9c, 0x4574, 0x0000, 0x0abd,
+	    0x1bd6, 0x0bf3, 0x4753, 0x44a9, 0x0000, 0x3a45, 0x35fa, 0x1934,
+	    0x4c3d, 0x43a4, 0x086c, 0x2911, 0x3b87, 0x199f, 0x2c62, 0x1852,
+	    0x0000, 0x3e10, 0x07b4, 0x0294, 0x1105, 0x3ac4, 0x0000, 0x0797,
+	    0x0a40, 0x2805, 0x3e23, 0x354d, 0x19c3, 0x0f0e, 0x103f, 0x3091,
+	    0x09d2, 0x1ff9, 0x0ef1, 0x044d, 0x1641, 0x0000, 0x0000, 0x0000,
+	    0x3879, 0x1b90, 0x3b1c, 0x0000, 0x1678, 0x1ab7, 0x22e8, 0x4575,
+	    0x43e6, 0x3540, 0x3ca6, 0x0857, 0x461b, 0x2b37, 0x2cb6, 0x3568,
+	    0x2c4f, 0x005a, 0x0000, 0x3d36, 0x2f94, 0x03b5, 0x0000, 0x2888,
+	    0x2a71, 0x4469, 0x0696, 0x2cb8, 0x24bc, 0x03ad, 0x4c3f, 0x1c2f,
+	    0x4d63, 0x37b1, 0x0a5e, 0x253b, 0x32e4, 0x4d57, 0x4290, 0x0608,
+	    0x0000, 0x0849, 0x00e5, 0x3073, 0x2380, 0x3b97, 0x3a83, 0x21de,
+	    0x0000, 0x2697, 0x107e, 0x1184, 0x2023, 0x4649, 0x4990, 0x20c1,
+	    0x2d7b, 0x37e4, 0x1e14, 0x029b, 0x38f1, 0x103d, 0x1170, 0x3efe,
+	    0x47c6, 0x34ad, 0x11c0, 0x2b4e, 0x49ac, 0x0000, 0x0000, 0x1c52,
+	    0x0000, 0x0000, 0x4ddd, 0x3b84, 0x229a, 0x0000, 0x2729, 0x0202,
+	    0x4ba5, 0x428e, 0x2144, 0x300b, 0x0000, 0x2daa, 0x282e, 0x2995,
+	    0x00e6, 0x0aff, 0x2bda, 0x4445, 0x3427, 0x197a, 0x0f90, 0x406b,
+	    0x0000, 0x1284, 0x3f8c, 0x0000, 0x49a0, 0x05ac, 0x2e77, 0x1050,
+	    0x375a, 0x2a03, 0x3b3c, 0x400d, 0x3e3f, 0x0000, 0x0000, 0x1abe,
+	    0x0000, 0x434f, 0x4dbf, 0x44d0, 0x2705, 0x2505, 0x49a2, 0x1300,
+	    0x1f49, 0x098d, 0x0000, 0x0e2c, 0x0000, 0x1f89, 0x0488, 0x3db2,
+	    0x4437, 0x15dc, 0x2074, 0x4758, 0x2ab3, 0x1bb4, 0x47d6, 0x0000,
+	    0x3285, 0x1d3c, 0x0000, 0x3572, 0x057b, 0x05e9, 0x3ace, 0x1605,
+	    0x2cb3, 0x0a64, 0x14fa, 0x4b2e, 0x1039, 0x0000, 0x0000, 0x0000,
+	    0x26b4, 0x1fc9, 0x1ba5, 0x0000, 0x2aba, 0x03ca, 0x024e, 0x0000,
+	    0x2ee5, 0x0b78, 0x4a62, 0x0000, 0x2e52, 0x4441, 0x0000, 0x4897,
+	    0x0000, 0x3990, 0x183f, 0x29cd, 0x0f60, 0x0000, 0x1fb7, 0x31c5,
+	    0x0b31, 0x27b7, 0x43a7, 0x44f8, 0x328a, 0x49f7, 0x46d3, 0x19df,
+	    0x0000, 0x3d73, 0x2b91, 0x0000, 0x29d2, 0x0000, 0x2d60, 0x4dd6,
+	    0x47e0, 0x0000, 0x0279, 0x0000, 0x4b75, 0x29be, 0x241f, 0x21ab,
+	    0x0d2d, 0x378b, 0x02c9, 0x0000, 0x10b1, 0x13ca, 0x4810, 0x42b8,
+	    0x0706, 0x340d, 0x4053, 0x204d, 0x3e90, 0x13d1, 0x1453, 0x4a06,
+	    0x2057, 0x3647, 0x4462, 0x3510, 0x3726, 0x4b89, 0x3dcb, 0x2cac,
+	    0x4961, 0x3e65, 0x26eb, 0x0000, 0x4c6a, 0x4546, 0x2904, 0x0000,
+	    0x1f71, 0x2114, 0x46bd, 0x381e, 0x385d, 0x017d, 0x143d, 0x3431,
+	    0x26c3, 0x16b6, 0x2c75, 0x0d6f, 0x0000, 0x0000, 0x0000, 0x2354,
+	    0x3a64, 0x1e96, 0x13fa, 0x1151, 0x430b, 0x0000, 0x1e97, 0x0a98,
+	    0x301a, 0x4546, 0x2394, 0x0000, 0x237b, 0x2610, 0x41be, 0x18d1,
+	    0x1258, 0x223b, 0x0f6f, 0x43fe, 0x20d5, 0x0bc6, 0x3dd8, 0x0044,
+	    0x38fe, 0x41b8, 0x1166, 0x24c3, 0x403a, 0x0000, 0x0000, 0x0b64,
+	    0x4d31, 0x44c8, 0x3466, 0x4cb2, 0x1717, 0x02d8, 0x0b53, 0x0000,
+	    0x0000, 0x1b09, 0x0000, 0x2a9d, 0x3ded, 0x42cd, 0x0000, 0x4cb0,
+	    0x0000, 0x0000, 0x35e9, 0x3430, 0x2230, 0x402e, 0x4caa, 0x089d,
+	    0x0000, 0x3e9b, 0x3957, 0x0000, 0x14e7, 0x2b86, 0x1ac0, 0x2d43,
+	    0x4720, 0x397e, 0x0000, 0x2d1a, 0x2364, 0x4a15, 0x088c, 0x0e43,
+	    0x271c, 0x19a0, 0x15fe, 0x0621, 0x1f55, 0x4105, 0x26c4, 0x1c63,
+	    0x1b9d, 0x4822, 0x34cc, 0x1b21, 0x2c4a, 0x0000, 0x4985, 0x2c59,
+	    0x3afc, 0x0c71, 0x073c, 0x2775, 0x08be, 0x324a, 0x471a, 0x4205,
+	    0x01e3, 0x2a5b, 0x3430, 0x0000, 0x1383, 0x068d, 0x0000, 0x0000,
+	    0x3848, 0x0211, 0x2dc1, 0x249a, 0x1b83, 0x1c93, 0x0000, 0x3bf1,
+	    0x14e6, 0x0c28, 0x1758, 0x0000, 0x3699, 0x1c26, 0x0000, 0x2171,
+	    0x3283, 0x2abd, 0x0000, 0x48b7, 0x0000, 0x391e, 0x1143, 0x096e,
+	    0x3524, 0x4d37, 0x1f71, 0x2786, 0x0000, 0x4b84, 0x0000, 0x0000,
+	    0x4355, 0x4266, 0x2f35, 0x3bbb, 0x01a3, 0x4313, 0x449e, 0x4a99,
+	    0x350c, 0x12a3, 0x0000, 0x3539, 0x3529, 0x1f7e, 0x21d6, 0x46bc,
+	    0x22ed, 0x4b5a, 0x0000, 0x2520, 0x0000, 0x3e3d, 0x0644, 0x0000,
+	    0x22a4, 0x4b59, 0x4411, 0x2005, 0x0000, 0x08e0, 0x0682, 0x0ae8,
+	    0x0046, 0x43f7, 0x30ce, 0x3e28, 0x2f05, 0x1d0c, 0x1c0f, 0x2da6,
+	    0x0000, 0x05dd, 0x1470, 0x1e3c, 0x0000, 0x2e44, 0x22d8, 0x0000,
+	    0x2378, 0x468e, 0x0000, 0x2d06, 0x0046, 0x4145, 0x31f7, 0x0ce8,
+	    0x0eb9, 0x1882, 0x4d15, 0x0a56, 0x0521, 0x3a23, 0x0000, 0x3065,
+	    0x1ff0, 0x2364, 0x0000, 0x2fda, 0x2138, 0x0efc, 0x322c, 0x1281,
+	    0x3400, 0x44fb, 0x1bcd, 0x3b45, 0x3284, 0x0000, 0x3de9, 0x32a3,
+	    0x0068, 0x0000, 0x496e, 0x0000, 0x362b, 0x3198, 0x1cbf, 0x0a7b,
+	    0x1527, 0x1e0c, 0x012d, 0x21f2, 0x10b6, 0x3997, 0x3636, 0x0000,
+	    0x0000, 0x20f2, 0x14d9, 0x10dd, 0x39d9, 0x2190, 0x15e4, 0x0000,
+	    0x0000, 0x39ff, 0x0000, 0x0000, 0x1e23, 0x1ff5, 0x0f51, 0x4955,
+	    0x2b61, 0x3bb4, 0x2f04, 0x340e, 0x1916, 0x0266, 0x4693, 0x3814,
+	    0x1450, 0x3577, 0x48c0, 0x0b1a, 0x0000, 0x0711, 0x4763, 0x0000,
+	    0x43c4, 0x0000, 0x0000, 0x2286, 0x1afb, 0x3be6, 0x0000, 0x2392,
+	    0x181a, 0x0000, 0x3ea7, 0x4987, 0x027f, 0x3719, 0x34ed, 0x1c12,
+	    0x4711, 0x2264, 0x031b, 0x2d9e, 0x36b7, 0x2ab5, 0x3192, 0x4081,
+	    0x0000, 0x0000, 0x33c1, 0x0703, 0x0000, 0x442a, 0x096c, 0x0000,
+	    0x032f, 0x2177, 0x1e8a, 0x4642, 0x2c44, 0x0000, 0x1b45, 0x3d71,
+	    0x1e26, 0x33a0, 0x0000, 0x26e4, 0x4219, 0x0000, 0x0000, 0x0000,
+	    0x15c6, 0x037a, 0x0000, 0x303c, 0x0000, 0x127e, 0x1b0d, 0x3d9a,
+	    0x30b8, 0x2898, 0x3117, 0x0dc8, 0x0000, 0x08cb, 0x24df, 0x163f,
+	    0x45e6, 0x3a0a, 0x13ce, 0x2731, 0x09cb, 0x009e, 0x2607, 0x2878,
+	    0x2804, 0x0000, 0x0000, 0x41bd, 0x155e, 0x3b37, 0x1aa9, 0x2f4f,
+	    0x40e3, 0x32d1, 0x1cb8, 0x0000, 0x0000, 0x3397, 0x0000, 0x0000,
+	    0x0000, 0x0d0c, 0x0000, 0x421a, 0x4dae, 0x3a45, 0x4e1a, 0x478c,
+	    0x0a96, 0x0e44, 0x1e30, 0x2a29, 0x3bd9, 0x44f1, 0x004a, 0x1d64,
+	    0x3b48, 0x38de, 0x0484, 0x207e, 0x14c2, 0x213b, 0x4322, 0x10ab,
+	    0x44f4, 0x26aa, 0x1945, 0x0000, 0x2116, 0x4952, 0x10d2, 0x1425,
+	    0x0000, 0x207a, 0x1c51, 0x35df, 0x27df, 0x39f1, 0x1594, 0x0858,
+	    0x0906, 0x0be9, 0x49b2, 0x02d7, 0x2026, 0x22a2, 0x0000, 0x1607,
+	    0x10db, 0x1057, 0x2700, 0x39bc, 0x4667, 0x0000, 0x0659, 0x22cd,
+	    0x0caf, 0x2508, 0x4b50, 0x2d33, 0x0209, 0x206e, 0x004e, 0x22d7,
+	    0x1655, 0x4c94, 0x43ba, 0x0809, 0x4a2e, 0x1abf, 0x3dee, 0x486c,
+	    0x492d, 0x345b, 0x4c96, 0x2c96, 0x33e4, 0x223e, 0x1fdd, 0x2269,
+	    0x1d02, 0x3874, 0x3659, 0x13f2, 0x1a6d, 0x248d, 0x1b3b, 0x0000,
+	    0x3451, 0x1c3c, 0x3b48, 0x0000, 0x26dd, 0x3b91, 0x423b, 0x1d84,
+	    0x4d43, 0x39ee, 0x34a9, 0x20ea, 0x47e3, 0x472a, 0x10c1, 0x399e,
+	    0x0882, 0x1130, 0x0000, 0x2f1d, 0x3be3, 0x24a9, 0x438b, 0x2c2e,
+	    0x2c76, 0x0b48, 0x28a6, 0x2591, 0x4760, 0x343c, 0x2993, 0x30ef,
+	    0x4b2f, 0x1d63, 0x126a, 0x0f71, 0x1b89, 0x4be8, 0x28d5, 0x0000,
+	    0x26e7, 0x3345, 0x1bd3, 0x301f, 0x0000, 0x0eb1, 0x34b3, 0x076a,
+	    0x0000, 0x3bce, 0x1a50, 0x0000, 0x4143, 0x0000, 0x31ee, 0x3d1f,
+	    0x3b60, 0x34de, 0x157b, 0x3dc3, 0x25c7, 0x0f6f, 0x42e0, 0x1eef,
+	    0x3d6a, 0x3e4a, 0x443d, 0x46f1, 0x3a1b, 0x43e6, 0x00f7, 0x1c5a,
+	    0x0000, 0x0000, 0x1cbf, 0x2ab1, 0x29d3, 0x4242, 0x487b, 0x3b98,
+	    0x1f47, 0x0d34, 0x45bc, 0x3380, 0x1996, 0x0a12, 0x355f, 0x3eb3,
+	    0x3bca, 0x3877, 0x0000, 0x0000, 0x245a, 0x4c1a, 0x1093, 0x4d0d,
+	    0x464c, 0x3fb1, 0x3985, 0x0000, 0x4001, 0x2024, 0x4ccb, 0x1bbd,
+	    0x1720, 0x25fc, 0x0000, 0x10de, 0x31c0, 0x4924, 0x101a, 0x3482,
+	    0x0000, 0x39e7, 0x050c, 0x4cb3, 0x4442, 0x1a43, 0x0000, 0x0000,
+	    0x4b63, 0x4764, 0x3299, 0x4dd6, 0x46cf, 0x30bd, 0x0000, 0x39d5,
+	    0x0000, 0x0000, 0x277f, 0x117a, 0x29b9, 0x06e3, 0x034c, 0x0000,
+	    0x07d7, 0x3c43, 0x2b22, 0x480f, 0x0000, 0x06a9, 0x085c, 0x4b12,
+	    0x2a6c, 0x4b26, 0x0422, 0x0510, 0x1931, 0x4757, 0x08fd, 0x4542,
+	    0x3522, 0x24ff, 0x0000, 0x2ce8, 0x0bcf, 0x01fb, 0x1be4, 0x0000,
+	    0x2387, 0x07bf, 0x0021, 0x0000, 0x0000, 0x41e0, 0x400a, 0x44b8,
+	    0x0000, 0x0eaf, 0x4dfc, 0x0002, 0x0000, 0x313f, 0x0292, 0x4593,
+	    0x1e78, 0x44ba, 0x1487, 0x1be2, 0x16a3, 0x1b5b, 0x2a07, 0x33e4,
+	    0x0233, 0x04a9, 0x0a00, 0x41b0, 0x1b9e, 0x1e89, 0x0000, 0x21e4,
+	    0x0922, 0x0000, 0x14a1, 0x140f, 0x49b5, 0x0c59, 0x170c, 0x4a96,
+	    0x2358, 0x15d7, 0x1d61, 0x291c, 0x06a9, 0x0f59, 0x436c, 0x33d4,
+	    0x0000, 0x3e94, 0x0000, 0x11ad, 0x15d9, 0x1f24, 0x3159, 0x45f5,
+	    0x3816, 0x43d2, 0x0ead, 0x02e9, 0x1e74, 0x0000, 0x4cc9, 0x297a,
+	    0x36a4, 0x3b73, 0x45f8, 0x054b, 0x1c51, 0x124d, 0x0000, 0x0000,
+	    0x203c, 0x2b99, 0x2338, 0x498e, 0x3d09, 0x0000, 0x4b35, 0x0000,
+	    0x0ba2, 0x0341, 0x0000, 0x0000, 0x1fe0, 0x3831, 0x0000, 0x4858,
+	    0x1666, 0x0bf3, 0x0000, 0x0e1e, 0x3100, 0x0000, 0x499b, 0x41f2,
+	    0x11b9, 0x0000, 0x1945, 0x021d, 0x27d9, 0x3e1a, 0x0000, 0x43ef,
+	    0x2dc2, 0x0000, 0x0000, 0x0581, 0x1c09, 0x056e, 0x0000, 0x049f,
+	    0x0000, 0x0000, 0x3a49, 0x0000, 0x1772, 0x123a, 0x1dfd, 0x134b,
+	    0x206c, 0x3728, 0x0609, 0x4021, 0x17f2, 0x420f, 0x11b5, 0x0000,
+	    0x2728, 0x0000, 0x33ef, 0x0000, 0x18e3, 0x3677, 0x17b0, 0x1a68,
+	    0x487b, 0x0000, 0x1a38, 0x0000, 0x1329, 0x39a3, 0x0000, 0x13bb,
+	    0x22b7, 0x199e, 0x0af8, 0x1a83, 0x4db8, 0x3df6, 0x2f66, 0x050e,
+	    0x3d70, 0x20bc, 0x0a4f, 0x16b5, 0x4de0, 0x0000, 0x4626, 0x42aa,
+	    0x0000, 0x07fe, 0x3ec0, 0x451a, 0x493e, 0x275f, 0x006c, 0x3f6c,
+	    0x1d36, 0x29f2, 0x0cda, 0x44b1, 0x19ab, 0x1b68, 0x3a94, 0x0fd2,
+	    0x06a8, 0x36aa, 0x2b41, 0x4ce0, 0x06fc, 0x07c9, 0x0000, 0x4916,
+	    0x0b6f, 0x0000, 0x0000, 0x0000, 0x015d, 0x2e53, 0x04cb, 0x1f0a,
+	    0x0000, 0x4167, 0x2fbd, 0x381e, 0x126b, 0x2bb1, 0x2579, 0x0000,
+	    0x1657, 0x103e, 0x0000, 0x0a4b, 0x444b, 0x1eb8, 0x0277, 0x2f09,
+	    0x49ba, 0x24ee, 0x2d2e, 0x0000, 0x3108, 0x11a5, 0x0511, 0x0000,
+	    0x451d, 0x3653, 0x2606, 0x0000, 0x34cc, 0x2ca0, 0x3df3, 0x20f0,
+	    0x1083, 0x260b, 0x2c5c, 0x2111, 0x061c, 0x4807, 0x2b4f, 0x0796,
+	    0x08db, 0x38cb, 0x48c0, 0x4a1d, 0x357e, 0x38a5, 0x3c80, 0x055c,
+	    0x0000, 0x2f5e, 0x2840, 0x07b7, 0x195b, 0x0000, 0x39cb, 0x391d,
+	    0x0000, 0x4159, 0x0087, 0x2fcc, 0x3bcd, 0x28d3, 0x3726, 0x06ad,
+	    0x4d21, 0x0000, 0x3d59, 0x0000, 0x2d34, 0x275a, 0x071f, 0x0000,
+	    0x0e8c, 0x0000, 0x3242, 0x2089, 0x41c3, 0x1226, 0x0000, 0x3454,
+	    0x0000, 0x0000, 0x0000, 0x42b1, 0x354e, 0x1fd4, 0x49fa, 0x22ce,
+	    0x1c40, 0x4544, 0x131c, 0x13b5, 0x3918, 0x2fb9, 0x0000, 0x265f,
+	    0x0000, 0x2a53, 0x30a9, 0x0372, 0x0352, 0x311a, 0x0000, 0x0000,
+	    0x162f, 0x0541, 0x4709, 0x0000, 0x0000, 0x0000, 0x26fa, 0x2a64,
+	    0x49a2, 0x2d98, 0x08e1, 0x026c, 0x356f, 0x42dd, 0x0276, 0x30eb,
+	    0x31d9, 0x2942, 0x0000, 0x1dad, 0x3580, 0x1892, 0x24e9, 0x4b3e,
+	    0x0000, 0x4951, 0x2ea1, 0x1976, 0x498a, 0x130b, 0x3f61, 0x3490,
+	    0x0f5d, 0x1df8, 0x1990, 0x3113, 0x17e3, 0x32f7, 0x0000, 0x0151,
+	    0x49e3, 0x11ae, 0x0000, 0x11b7, 0x0000, 0x1f91, 0x2e10, 0x11a7,
+	    0x0000, 0x2384, 0x1a78, 0x0b61, 0x1b50, 0x01d8, 0x3a74, 0x0000,
+	    0x0000, 0x2d59, 0x20df, 0x04f3, 0x41c1, 0x2956, 0x01f2, 0x4aca,
+	    0x4b6a, 0x417e, 0x1a73, 0x48e8, 0x4af2, 0x1bd9, 0x4ada, 0x492e,
+	    0x3e0b, 0x2ec8, 0x4422, 0x0e22, 0x2ebf, 0x4836, 0x0000, 0x4cc8,
+	    0x4bb2, 0x3f85, 0x4241, 0x0000, 0x348f, 0x1dd3, 0x39d8, 0x0000,
+	    0x21a5, 0x0c9a, 0x207d, 0x410f, 0x3b46, 0x16dc, 0x4327, 0x2a78,
+	    0x2ee2, 0x4581, 0x0c9e, 0x2682, 0x1f37, 0x03ed, 0x4d54, 0x29cf,
+	    0x2de1, 0x0499, 0x03e8, 0x3b80, 0x4b69, 0x2148, 0x4358, 0x143c,
+	    0x41ac, 0x04cd, 0x0cdf, 0x427e, 0x0309, 0x2a24, 0x4cc9, 0x45f0,
+	    0x19bb, 0x0a16, 0x4961, 0x0ed1, 0x477c, 0x4221, 0x0000, 0x1850,
+	    0x2392, 0x1bf2, 0x0000, 0x3583, 0x0000, 0x0000, 0x31b3, 0x3c26,
+	    0x0000, 0x2a4a, 0x3c14, 0x1a35, 0x180c, 0x09c1, 0x0952, 0x4698,
+	    0x0000, 0x240f, 0x32e7, 0x4694, 0x2efc, 0x3b0e, 0x2f1f, 0x203e,
+	    0x2b6c, 0x3bbe, 0x0d11, 0x1e81, 0x3fc9, 0x4c2e, 0x0fc7, 0x4a7c,
+	    0x2f0a, 0x0000, 0x3e5f, 0x2bbb, 0x0000, 0x1fea, 0x0000, 0x0eba,
+	    0x1a11, 0x34fa, 0x270d, 0x2220, 0x44a2, 0x0b29, 0x13fd, 0x1b81,
+	    0x3e24, 0x0000, 0x0000, 0x0000, 0x0000, 0x14bb, 0x2ac3, 0x0547,
+	    0x0f55, 0x4638, 0x0000, 0x0b6f, 0x150d, 0x27ab, 0x0000, 0x3fe9,
+	    0x46d5, 0x0000, 0x1e5a, 0x2685, 0x4c54, 0x3c82, 0x2dcb, 0x2c90,
+	    0x47e4, 0x0000, 0x10d8, 0x0000, 0x2599, 0x494a, 0x3ae9, 0x2963,
+	    0x06af, 0x036d, 0x3171, 0x136f, 0x3d8a, 0x241e, 0x1f38, 0x270d,
+	    0x0d5f, 0x2199, 0x384c, 0x04e1, 0x2e10, 0x4aae, 0x25e6, 0x2e58,
+	    0x0af5, 0x2cb1, 0x3eef, 0x46d2, 0x2079, 0x3563, 0x312b, 0x0000,
+	    0x420f, 0x39d1, 0x1dff, 0x28b9, 0x454f, 0x195d, 0x1d6a, 0x0451,
+	    0x3d2a, 0x4284, 0x0000, 0x3b4c, 0x4201, 0x27b8, 0x1827, 0x15ac,
+	    0x45bd, 0x188c, 0x0146, 0x1fa0, 0x3df6, 0x0c42, 0x15e2, 0x3d07,
+	    0x3ce3, 0x4ce3, 0x2338, 0x4d18, 0x4177, 0x2130, 0x0f15, 0x0000,
+	    0x2f3b, 0x0fe8, 0x373c, 0x13bc, 0x080b, 0x227e, 0x33e9, 0x0a93,
+	    0x2781, 0x0244, 0x167c, 0x0e5d, 0x14e5, 0x0000, 0x1297, 0x3890,
+	    0x1658, 0x031c, 0x1f5a, 0x3afc, 0x24b5, 0x3660, 0x025a, 0x2b19,
+	    0x2409, 0x4b42, 0x2d56, 0x0000, 0x274a, 0x0000, 0x1893, 0x1686,
+	    0x35e4, 0x1491, 0x12bd, 0x0000, 0x00a1, 0x2c62, 0x0000, 0x0000,
+	    0x2af3, 0x4623, 0x47ef, 0x1769, 0x1f16, 0x261d, 0x1f59, 0x445c,
+	    0x4ad2, 0x0000, 0x3e5a, 0x34b5, 0x4699, 0x2778, 0x075c, 0x0b16,
+	    0x0000, 0x3953, 0x41a3, 0x0000, 0x0226, 0x39a0, 0x33e0, 0x3cd3,
+	    0x338d, 0x389a, 0x3b7d, 0x181a, 0x0901, 0x1b0a, 0x16b3, 0x4791,
+	    0x0000, 0x41f1, 0x1ab8, 0x0d57, 0x0f54, 0x2cea, 0x4a1f, 0x13d0,
+	    0x38ce, 0x238a, 0x3d88, 0x0876, 0x09ac, 0x321e, 0x4667, 0x3d33,
+	    0x1b15, 0x3083, 0x1f17, 0x3a7d, 0x453c, 0x1f4c, 0x3f74, 0x27a5,
+	    0x33f2, 0x24ce, 0x0000, 0x0000, 0x481b, 0x05a3, 0x116a, 0x2480,
+	    0x0be0, 0x2aa1, 0x1d58, 0x125a, 0x313d, 0x19ad, 0x303c, 0x13c2,
+	    0x49d8, 0x0000, 0x0138, 0x36f1, 0x0000, 0x00a7, 0x4854, 0x2ab6,
+	    0x0000, 0x0237, 0x34fc, 0x133f, 0x36cd, 0x4956, 0x49d4, 0x010e,
+	    0x28ed, 0x33cc, 0x1f14, 0x1d5c, 0x42ab, 0x10e2, 0x0ead, 0x2ca5,
+	    0x348d, 0x4168, 0x2e4f, 0x4d46, 0x3459, 0x2b5d, 0x0515, 0x19a0,
+	    0x2ca5, 0x3672, 0x3fc1, 0x0538, 0x0000, 0x13bb, 0x1e62, 0x1854,
+	    0x42fb, 0x3e6f, 0x0000, 0x1987, 0x35bb, 0x0000, 0x3d07, 0x3d57,
+	    0x41e3, 0x32ee, 0x0238, 0x19ec, 0x2506, 0x1312, 0x3fc4, 0x1979,
+	    0x04a0, 0x4df6, 0x1bbb, 0x0000, 0x175f, 0x4b8e, 0x103b, 0x37a4,
+	    0x4d6f, 0x0000, 0x2a08, 0x1d8c, 0x0000, 0x2082, 0x3c95, 0x14ac,
+	    0x08c6, 0x1590, 0x245d, 0x0000, 0x151e, 0x4b05, 0x4244, 0x3f82,
+	    0x0000, 0x2ed3, 0x0000, 0x1f65, 0x0a06, 0x3de5, 0x38d8, 0x2643,
+	    0x0c0c, 0x07ec, 0x2949, 0x3432, 0x3a15, 0x1bb5, 0x0a50, 0x1584,
+	    0x4d98, 0x0a5f, 0x0000, 0x0f10, 0x0000, 0x18dc, 0x0f8c, 0x469f,
+	    0x1bad, 0x32f5, 0x45ca, 0x1f77, 0x46ce, 0x0000, 0x4612, 0x17e0,
+	    0x34c2, 0x3b95, 0x1a5d, 0x07ba, 0x2e56, 0x0000, 0x2bf9, 0x0c01,
+	    0x13bc, 0x2114, 0x4a9b, 0x23a4, 0x0491, 0x31bf, 0x481b, 0x0000,
+	    0x0c6d, 0x0680, 0x0000, 0x44fb, 0x29d9, 0x3606, 0x16c3, 0x421d,
+	    0x3700, 0x2e5a, 0x1607, 0x4021, 0x0505, 0x1b8f, 0x0000, 0x0f56,
+	    0x0000, 0x2b63, 0x0e9a, 0x15a9, 0x41ab, 0x098c, 0x35f5, 0x39c8,
+	    0x364f, 0x3ef0, 0x3b3f, 0x1ff7, 0x0000, 0x2f39, 0x2e3e, 0x0000,
+	    0x3d68, 0x3e53, 0x173d, 0x29d3, 0x0986, 0x1230, 0x087f, 0x0000,
+	    0x1df8, 0x0000, 0x074e, 0x3f2b, 0x17a2, 0x40ba, 0x0000, 0x4636,
+	    0x45bf, 0x0000, 0x0000, 0x0000, 0x3258, 0x1943, 0x17d4, 0x1a58,
+	    0x3e28, 0x1fb4, 0x0e15, 0x0000, 0x34d0, 0x0506, 0x4234, 0x2c9a,
+	    0x1d3f, 0x1f20, 0x14e2, 0x4b61, 0x4211, 0x1d6d, 0x0d31, 0x1b5e,
+	    0x2f75, 0x39af, 0x2b1c, 0x2ce4, 0x0f93, 0x47e4, 0x2573, 0x0469,
+	    0x24dc, 0x2f78, 0x43fe, 0x14ec, 0x03bd, 0x3b5e, 0x37c8, 0x4a5f,
+	    0x41da, 0x368b, 0x3272, 0x444c, 0x4c5c, 0x0ab0, 0x0000, 0x443d,
+	    0x4167, 0x0000, 0x4611, 0x0000, 0x3ac7, 0x299a, 0x1978, 0x4d14,
+	    0x2915, 0x1c0a, 0x09d9, 0x0000, 0x0fee, 0x424e, 0x0000, 0x0000,
+	    0x1f66, 0x37c6, 0x21e1, 0x087c, 0x170b, 0x1208, 0x2c3b, 0x25b6,
+	    0x102a, 0x1719, 0x4268, 0x0000, 0x1004, 0x16db, 0x35fa, 0x35b3,
+	    0x077f, 0x26bc, 0x0aaa, 0x0432, 0x1503, 0x0000, 0x033a, 0x25d1,
+	    0x0000, 0x26f5, 0x36d1, 0x19e7, 0x436e, 0x48c5, 0x02f6, 0x0000,
+	    0x0d7e, 0x328b, 0x3a15, 0x1273, 0x0e2e, 0x242c, 0x3f0c, 0x0925,
+	    0x266f, 0x1c5d, 0x0000, 0x1ef6, 0x3e6c, 0x26c7, 0x0000, 0x13c6,
+	    0x17f0, 0x3acb, 0x3f44, 0x4d46, 0x3c54, 0x3b16, 0x0000, 0x0000,
+	    0x4064, 0x25c0, 0x02e2, 0x4057, 0x4828, 0x2314, 0x19ed, 0x2639,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2bce, 0x4152, 0x24df, 0x0529,
+	    0x0000, 0x4154, 0x4c45, 0x1853, 0x05d6, 0x2287, 0x0000, 0x0000,
+	    0x4bff, 0x3d6c, 0x0447, 0x0000, 0x27b8, 0x0000, 0x07a6, 0x0f96,
+	    0x47f9, 0x3bc8, 0x2e5f, 0x0000, 0x1d24, 0x0f64, 0x4bc5, 0x36cd,
+	    0x0000, 0x291e, 0x46c9, 0x4c99, 0x0000, 0x07c4, 0x1507, 0x1364,
+	    0x0e4f, 0x2427, 0x03c1, 0x240c, 0x0000, 0x254c, 0x149c, 0x2b7b,
+	    0x2b5c, 0x2e42, 0x06ad, 0x25cc, 0x0000, 0x4872, 0x0000, 0x4bf0,
+	    0x0000, 0x4a3f, 0x0000, 0x1cc4, 0x222d, 0x04c9, 0x0000, 0x0e7f,
+	    0x358a, 0x4151, 0x4a86, 0x0000, 0x0000, 0x4522, 0x152a, 0x2b44,
+	    0x3a6e, 0x0862, 0x4d46, 0x2798, 0x0680, 0x0000, 0x179d, 0x2a96,
+	    0x0000, 0x4c7a, 0x144d, 0x0000, 0x3d79, 0x05a7, 0x0000, 0x2ce6,
+	    0x19b8, 0x4755, 0x4648, 0x089f, 0x0649, 0x0fc4, 0x0be0, 0x2cc2,
+	    0x0000, 0x2348, 0x298a, 0x2ae3, 0x137c, 0x0000, 0x1034, 0x0000,
+	    0x2ccf, 0x3996, 0x2778, 0x283a, 0x1619, 0x3fe1, 0x28fb, 0x272e,
+	    0x26f4, 0x10f3, 0x0000, 0x3a14, 0x0000, 0x46d8, 0x423e, 0x3f63,
+	    0x0000, 0x04f8, 0x0547, 0x3e06, 0x0000, 0x4b9c, 0x22f2, 0x0629,
+	    0x3419, 0x2399, 0x3dc6, 0x4348, 0x2e3c, 0x0000, 0x33db, 0x3f6b,
+	    0x29f9, 0x3f23, 0x1655, 0x43c8, 0x00fb, 0x167b, 0x44e2, 0x4807,
+	    0x4cc6, 0x18b5, 0x0876, 0x08fc, 0x459c, 0x398a, 0x3dff, 0x125a,
+	    0x4895, 0x1e9c, 0x2b92, 0x1e20, 0x3ee1, 0x3e96, 0x0000, 0x0aed,
+	    0x1c7c, 0x0000, 0x0000, 0x14e9, 0x4c50, 0x3d51, 0x0000, 0x354a,
+	    0x35f1, 0x1ee7, 0x0000, 0x0000, 0x3d7b, 0x0000, 0x16c5, 0x49a9,
+	    0x0000, 0x0488, 0x0000, 0x2e87, 0x0000, 0x13fe, 0x3755, 0x0000,
+	    0x3183, 0x0c5b, 0x1a0f, 0x4b0b, 0x295d, 0x085b, 0x06d9, 0x219f,
+	    0x0286, 0x2274, 0x0000, 0x3d3d, 0x162b, 0x2c3a, 0x470d, 0x0000,
+	    0x0623, 0x0000, 0x0000, 0x0000, 0x335e, 0x24bf, 0x1741, 0x0000,
+	    0x1b3b, 0x3da4, 0x0032, 0x3233, 0x0f91, 0x19d4, 0x1707, 0x18ce,
+	    0x0000, 0x0000, 0x1752, 0x0114, 0x2553, 0x0c65, 0x0000, 0x0000,
+	    0x0a96, 0x0000, 0x4e13, 0x0000, 0x3594, 0x0c92, 0x207d, 0x0000,
+	    0x1b2d, 0x0f1c, 0x1558, 0x0d20, 0x0e5a, 0x0000, 0x1c4f, 0x14ee,
+	    0x30d4, 0x3e94, 0x0000, 0x17ef, 0x4e11, 0x30e8, 0x1d0d, 0x46ad,
+	    0x0000, 0x0000, 0x0000, 0x3317, 0x0705, 0x0000, 0x360b, 0x0000,
+	    0x46fd, 0x3d8b, 0x01da, 0x0f77, 0x299f, 0x2fca, 0x0311, 0x2f95,
+	    0x2766, 0x4c1d, 0x0000, 0x40a6, 0x3ac5, 0x307a, 0x03c8, 0x0000,
+	    0x3374, 0x450f, 0x0f75, 0x0051, 0x2a49, 0x0258, 0x1111, 0x09b3,
+	    0x3617, 0x1abc, 0x0508, 0x419f, 0x41bc, 0x3392, 0x44d4, 0x3572,
+	    0x0000, 0x1457, 0x3e0e, 0x0b6d, 0x0b5f, 0x0000, 0x281e, 0x1aca,
+	    0x00ca, 0x0b4a, 0x1e83, 0x2db5, 0x0000, 0x0297, 0x1006, 0x3875,
+	    0x2773, 0x4cfa, 0x17ee, 0x0000, 0x0000, 0x25d5, 0x0000, 0x17dd,
+	    0x0000, 0x0000, 0x1738, 0x18bb, 0x3b50, 0x4016, 0x282a, 0x3a5b,
+	    0x25b7, 0x38b9, 0x4a4c, 0x227c, 0x11ae, 0x26c9, 0x076b, 0x241a,
+	    0x0000, 0x2d7b, 0x01bc, 0x1d78, 0x1d9e, 0x4cc3, 0x15e1, 0x0fab,
+	    0x4b50, 0x1b6a, 0x0000, 0x1b4c, 0x05b2, 0x1222, 0x41d6, 0x0b36,
+	    0x2067, 0x0959, 0x1e4b, 0x1c35, 0x335a, 0x143f, 0x3a0c, 0x0000,
+	    0x2e9f, 0x22e8, 0x3a3f, 0x00c8, 0x057c, 0x32da, 0x1cd4, 0x1e28,
+	    0x2fef, 0x16b0, 0x1455, 0x019e, 0x464d, 0x0013, 0x0000, 0x3c12,
+	    0x0000, 0x0000, 0x0000, 0x34b5, 0x3c75, 0x241b, 0x3bd4, 0x0be2,
+	    0x0000, 0x0000, 0x0000, 0x446d, 0x30d5, 0x3697, 0x417d, 0x3c14,
+	    0x0000, 0x0000, 0x03f4, 0x0000, 0x323a, 0x2e24, 0x0000, 0x4864,
+	    0x013a, 0x1c3a, 0x37d9, 0x0d4f, 0x0b69, 0x344c, 0x28e2, 0x07a1,
+	    0x1716, 0x434c, 0x42a1, 0x0404, 0x3e33, 0x335b, 0x2f07, 0x11ec,
+	    0x0a4f, 0x1523, 0x06f7, 0x4dcd, 0x2aa2, 0x287c, 0x4864, 0x36b3,
+	    0x20c6, 0x08dc, 0x49f7, 0x138b, 0x0d5e, 0x0000, 0x0000, 0x04ca,
+	    0x417e, 0x44f5, 0x0000, 0x19a0, 0x3854, 0x40c3, 0x0b82, 0x0000,
+	    0x217d, 0x169b, 0x3d93, 0x0000, 0x25eb, 0x1e82, 0x017d, 0x0560,
+	    0x0000, 0x2a7d, 0x3b14, 0x3254, 0x19b2, 0x2a74, 0x041e, 0x254a,
+	    0x29a7, 0x4089, 0x267b, 0x0000, 0x0000, 0x41ff, 0x4d98, 0x39f0,
+	    0x2b59, 0x0000, 0x0e2d, 0x2604, 0x2063, 0x3594, 0x02e3, 0x001d,
+	    0x03c5, 0x29a2, 0x0630, 0x48cc, 0x10c0, 0x3640, 0x1b15, 0x0000,
+	    0x4151, 0x164f, 0x21ec, 0x286b, 0x059f, 0x3747, 0x0000, 0x4192,
+	    0x47b6, 0x33a3, 0x0000, 0x4a46, 0x1a04, 0x3801, 0x1755, 0x3c73,
+	    0x1e6e, 0x4a5e, 0x4c9b, 0x17ed, 0x3046, 0x0736, 0x053e, 0x2ece,
+	    0x0101, 0x0000, 0x13b1, 0x178a, 0x096e, 0x158c, 0x3373, 0x4bba,
+	    0x47e7, 0x325e, 0x4a15, 0x0000, 0x19e0, 0x0000, 0x0a9b, 0x35e2,
+	    0x3469, 0x473b, 0x0000, 0x217a, 0x0000, 0x0080, 0x0000, 0x20e1,
+	    0x14ee, 0x32bc, 0x3553, 0x3ed4, 0x0000, 0x051f, 0x3c91, 0x331b,
+	    0x2139, 0x0000, 0x456c, 0x2ba9, 0x3591, 0x04b4, 0x0000, 0x0f4f,
+	    0x2401, 0x451a, 0x2eaf, 0x0000, 0x2ef4, 0x49fd, 0x10aa, 0x0000,
+	    0x0936, 0x4ca5, 0x36b1, 0x2658, 0x042f, 0x13e1, 0x0000, 0x2c9b,
+	    0x33bc, 0x408c, 0x1e56, 0x0000, 0x34c8, 0x36e2, 0x234e, 0x18ff,
+	    0x3004, 0x46b3, 0x2b27, 0x494d, 0x07eb, 0x0d64, 0x0000, 0x0692,
+	    0x2697, 0x31d7, 0x3f86, 0x42a2, 0x0056, 0x0000, 0x0000, 0x2236,
+	    0x05e7, 0x138a, 0x4cda, 0x1679, 0x26db, 0x0000, 0x3706, 0x38e5,
+	    0x06bf, 0x4547, 0x337c, 0x0c93, 0x0000, 0x0000, 0x3583, 0x0000,
+	    0x28d0, 0x129b, 0x4ccb, 0x1967, 0x4691, 0x2529, 0x0f82, 0x1cca,
+	    0x04b7, 0x18ca, 0x1d3e, 0x2095, 0x0d85, 0x3168, 0x0000, 0x4ae4,
+	    0x074d, 0x3236, 0x139e, 0x0000, 0x1044, 0x360a, 0x1df1, 0x0000,
+	    0x45a2, 0x1455, 0x0667, 0x0000, 0x3d24, 0x2cc7, 0x3482, 0x0000,
+	    0x1e20, 0x02e3, 0x1e8e, 0x1d31, 0x20ce, 0x395c, 0x21d9, 0x0000,
+	    0x0e81, 0x257b, 0x2a7f, 0x0000, 0x2c40, 0x2005, 0x39cf, 0x314b,
+	    0x16cd, 0x305e, 0x146b, 0x4152, 0x279c, 0x01fb, 0x0000, 0x2a01,
+	    0x43dd, 0x37be, 0x21a7, 0x07b4, 0x0000, 0x30f7, 0x232e, 0x49ed,
+	    0x291a, 0x37c1, 0x37d2, 0x4b7c, 0x31ad, 0x3894, 0x0113, 0x29a7,
+	    0x431d, 0x4d43, 0x3955, 0x0982, 0x4de3, 0x32ee, 0x323b, 0x03bd,
+	    0x390c, 0x0b19, 0x2c9d, 0x0000, 0x3c08, 0x224b, 0x07e9, 0x3be7,
+	    0x1ca5, 0x0000, 0x1c3f, 0x0000, 0x1976, 0x0000, 0x4ae6, 0x34ad,
+	    0x493f, 0x4927, 0x32f4, 0x1d82, 0x0000, 0x0000, 0x17d4, 0x0fda,
+	    0x2e0a, 0x3463, 0x0000, 0x38fc, 0x0237, 0x1f3e, 0x3b97, 0x1401,
+	    0x05eb, 0x2de1, 0x29ca, 0x441e, 0x013c, 0x2a78, 0x3ff4, 0x009d,
+	    0x0000, 0x3af7, 0x1afb, 0x2076, 0x2d8a, 0x445b, 0x1d67, 0x0de8,
+	    0x0000, 0x0000, 0x0e58, 0x35e1, 0x0761, 0x14d1, 0x380f, 0x23e4,
+	    0x0c96, 0x359c, 0x2ad6, 0x2c67, 0x1489, 0x3d98, 0x0000, 0x38af,
+	    0x4be1, 0x1105, 0x37e7, 0x0000, 0x1873, 0x0000, 0x42e8, 0x2e40,
+	    0x2ddb, 0x1057, 0x2458, 0x349f, 0x4743, 0x056d, 0x2f4e, 0x2be5,
+	    0x1518, 0x318b, 0x28d7, 0x2787, 0x1150, 0x12d7, 0x1236, 0x0672,
+	    0x3ed9, 0x0949, 0x0000, 0x0fdc, 0x1a64, 0x29fa, 0x06ce, 0x0337,
+	    0x1868, 0x37b5, 0x2f65, 0x40df, 0x37e7, 0x0a4e, 0x0000, 0x046e,
+	    0x0909, 0x29fd, 0x24d1, 0x3978, 0x163d, 0x0000, 0x4212, 0x1d5f,
+	    0x1d58, 0x4a74, 0x0000, 0x3119, 0x094c, 0x4813, 0x43cc, 0x0000,
+	    0x3305, 0x04fc, 0x4399, 0x0a9a, 0x38fb, 0x47a4, 0x1e8f, 0x4415,
+	    0x2a1a, 0x2ffd, 0x002f, 0x0000, 0x46cd, 0x358a, 0x3e57, 0x2100,
+	    0x3c62, 0x4cc0, 0x3310, 0x0000, 0x0000, 0x1ff7, 0x4b07, 0x149c,
+	    0x2fdd, 0x20aa, 0x0000, 0x2c65, 0x1f04, 0x1cf8, 0x2ef2, 0x16c7,
+	    0x0000, 0x422e, 0x0746, 0x35a5, 0x1c53, 0x435f, 0x140a, 0x17db,
+	    0x19d1, 0x4323, 0x1a62, 0x2b7b, 0x23ba, 0x0d3b, 0x2324, 0x48de,
+	    0x07e5, 0x3b37, 0x10e4, 0x074d, 0x4120, 0x05f5, 0x4260, 0x416b,
+	    0x1267, 0x1e53, 0x28ac, 0x2a1c, 0x36ee, 0x0d8b, 0x29f1, 0x3a9f,
+	    0x0e13, 0x25a6, 0x04d7, 0x47e1, 0x2dd1, 0x0948, 0x0f40, 0x3b67,
+	    0x074c, 0x01eb, 0x0db6, 0x22f8, 0x00e1, 0x2349, 0x2282, 0x0000,
+	    0x4a6e, 0x2a32, 0x0000, 0x1ed5, 0x0000, 0x4a58, 0x39ab, 0x0264,
+	    0x40b5, 0x0d5d, 0x1c8b, 0x0000, 0x1474, 0x1f94, 0x3be9, 0x057b,
+	    0x0d8f, 0x0000, 0x04a7, 0x4530, 0x45c6, 0x3990, 0x47dd, 0x0718,
+	    0x20ec, 0x0000, 0x20ad, 0x3100, 0x295a, 0x0000, 0x3045, 0x0a4d,
+	    0x2d57, 0x0807, 0x1f0c, 0x4c1d, 0x0000, 0x0b21, 0x4e08, 0x0260,
+	    0x227e, 0x3a43, 0x10de, 0x0000, 0x0f3f, 0x3205, 0x39a7, 0x3ac5,
+	    0x4665, 0x462b, 0x1b7a, 0x30a3, 0x0472, 0x4649, 0x34a0, 0x1c1a,
+	    0x37d8, 0x360e, 0x0a31, 0x0ce5, 0x18d2, 0x4135, 0x0000, 0x463d,
+	    0x4dd5, 0x0a01, 0x0848, 0x2f1f, 0x2f28, 0x01d1, 0x21df, 0x3e5d,
+	    0x1bc5, 0x41a6, 0x1517, 0x1868, 0x408d, 0x2ab8, 0x0000, 0x0000,
+	    0x0000, 0x1866, 0x3692, 0x2027, 0x2d1e, 0x47f9, 0x3669, 0x4da8,
+	    0x33e0, 0x37ee, 0x20cf, 0x0000, 0x344b, 0x3319, 0x3cc7, 0x09ab,
+	    0x2f93, 0x0000, 0x00dc, 0x49d9, 0x0a4a, 0x3840, 0x054f, 0x196b,
+	    0x490f, 0x39bc, 0x0000, 0x08fe, 0x1af7, 0x18df, 0x3e44, 0x4222,
+	    0x122d, 0x25c3, 0x2bf4, 0x27f1, 0x0d33, 0x2605, 0x32a9, 0x4bef,
+	    0x3e52, 0x0000, 0x2a82, 0x0000, 0x0000, 0x3084, 0x263d, 0x01dc,
+	    0x2e12, 0x1384, 0x117d, 0x3d18, 0x1bd6, 0x0000, 0x2fe5, 0x0e74,
+	    0x0000, 0x0000, 0x046c, 0x0000, 0x349b, 0x2769, 0x25b0, 0x0000,
+	    0x2edf, 0x44f3, 0x169c, 0x09d4, 0x3b24, 0x4a6e, 0x328e, 0x1866,
+	    0x2aba, 0x1664, 0x4c34, 0x0842, 0x2f5a, 0x39da, 0x0dda, 0x3fed,
+	    0x2f56, 0x073d, 0x0c3f, 0x228b, 0x3d44, 0x461a, 0x1b82, 0x0aab,
+	    0x0000, 0x0000, 0x393a, 0x03fa, 0x4bc9, 0x0d8b, 0x0000, 0x0000,
+	    0x0eba, 0x31b6, 0x0095, 0x4cd4, 0x19ed, 0x1060, 0x1d1c, 0x2e50,
+	    0x0467, 0x4269, 0x0000, 0x3319, 0x035c, 0x3536, 0x10a7, 0x3cf9,
+	    0x0000, 0x2db7, 0x17b1, 0x2e7f, 0x4a20, 0x1442, 0x2be0, 0x0460,
+	    0x0ec2, 0x1239, 0x3ed7, 0x4d98, 0x090e, 0x181e, 0x249c, 0x0692,
+	    0x173a, 0x2639, 0x1730, 0x04a2, 0x01a4, 0x0000, 0x0000, 0x0de3,
+	    0x3bf6, 0x0f89, 0x0000, 0x2393, 0x0339, 0x0000, 0x0000, 0x44d4,
+	    0x19da, 0x377e, 0x1533, 0x04ee, 0x0000, 0x1194, 0x123c, 0x0000,
+	    0x3500, 0x153d, 0x4882, 0x0000, 0x41bb, 0x06a1, 0x41c6, 0x0ff7,
+	    0x0437, 0x2caf, 0x0538, 0x223e, 0x0000, 0x0aae, 0x136c, 0x09cb,
+	    0x3194, 0x0000, 0x491b, 0x0000, 0x327e, 0x2750, 0x4c73, 0x2f2f,
+	    0x0ae0, 0x4893, 0x1d82, 0x414a, 0x10cd, 0x29e4, 0x18be, 0x0000,
+	    0x4d13, 0x12d3, 0x4dc4, 0x0000, 0x0000, 0x0738, 0x2b3a, 0x468d,
+	    0x3ad5, 0x0000, 0x1ab5, 0x1c31, 0x41f8, 0x211a, 0x4a92, 0x2c33,
+	    0x0000, 0x3eef, 0x41f1, 0x0677, 0x3b41, 0x032a, 0x002c, 0x37f5,
+	    0x4296, 0x030b, 0x458a, 0x41f1, 0x03e8, 0x444d, 0x3e70, 0x22ea,
+	    0x1c7b, 0x1c91, 0x0134, 0x33e1, 0x29d5, 0x0000, 0x174c, 0x0217,
+	    0x02b1, 0x3278, 0x365a, 0x2239, 0x4baa, 0x0118, 0x136d, 0x0ae1,
+	    0x11de, 0x450f, 0x33be, 0x26e6, 0x208b, 0x3bac, 0x48dd, 0x2685,
+	    0x0567, 0x2bae, 0x3441, 0x079d, 0x0000, 0x0c69, 0x1e1c, 0x4188,
+	    0x430a, 0x255a, 0x1f9f, 0x361d, 0x3b3b, 0x11fe, 0x1daa, 0x46f3,
+	    0x146f, 0x3390, 0x3441, 0x0000, 0x4157, 0x45b3, 0x1b42, 0x4814,
+	    0x1a2c, 0x322c, 0x4098, 0x31de, 0x0916, 0x4800, 0x25ee, 0x024b,
+	    0x4cc2, 0x11b7, 0x42f0, 0x2d41, 0x47e6, 0x0000, 0x4ac3, 0x49cd,
+	    0x0000, 0x1274, 0x36bb, 0x1afc, 0x3c2e, 0x0e3d, 0x3380, 0x3c78,
+	    0x1766, 0x2a8f, 0x2023, 0x339a, 0x4018, 0x0a93, 0x3a1d, 0x12b2,
+	    0x1ab0, 0x215c, 0x1684, 0x4a67, 0x0000, 0x1011, 0x0b52, 0x040a,
+	    0x0000, 0x17ab, 0x10ad, 0x260d, 0x4a1a, 0x2388, 0x2d4b, 0x3cd1,
+	    0x0ecb, 0x3b5a, 0x2fca, 0x0b2b, 0x0ffc, 0x33ef, 0x0000, 0x3d00,
+	    0x3238, 0x06ac, 0x0cbc, 0x0129, 0x184f, 0x4653, 0x3f19, 0x2315,
+	    0x33f3, 0x0347, 0x147d, 0x36fb, 0x4b32, 0x09f7, 0x3d53, 0x0000,
+	    0x20e2, 0x3ef2, 0x13bd, 0x4739, 0x0000, 0x3e7a, 0x32c2, 0x0d17,
+	    0x352f, 0x190e, 0x1794, 0x0ee0, 0x1396, 0x4773, 0x4528, 0x3470,
+	    0x0584, 0x3834, 0x3553, 0x4cfb, 0x0225, 0x1cbb, 0x1142, 0x32a9,
+	    0x3766, 0x03d7, 0x2e73, 0x4c0d, 0x1480, 0x3514, 0x0000, 0x454e,
+	    0x2d09, 0x197b, 0x1e2a, 0x1a72, 0x4b1b, 0x3606, 0x0000, 0x3041,
+	    0x4dbf, 0x0000, 0x1aa2, 0x10f3, 0x0873, 0x4c19, 0x1aec, 0x47a6,
+	    0x1a79, 0x4a3b, 0x2e74, 0x02c8, 0x0abc, 0x26b9, 0x23b2, 0x2430,
+	    0x2b69, 0x1993, 0x033b, 0x0000, 0x288b, 0x4810, 0x0000, 0x1628,
+	    0x0000, 0x0000, 0x3785, 0x1806, 0x4ac2, 0x0000, 0x0171, 0x29eb,
+	    0x42ce, 0x0000, 0x4411, 0x07b7, 0x0000, 0x1378, 0x4989, 0x39fc,
+	    0x0000, 0x22e3, 0x4a9f, 0x0024, 0x1573, 0x10be, 0x1b90, 0x0000,
+	    0x1a4c, 0x0000, 0x3236, 0x3bb1, 0x2386, 0x191c, 0x48d3, 0x0a17,
+	    0x0000, 0x22db, 0x0000, 0x06e4, 0x45da, 0x4114, 0x2142, 0x1895,
+	    0x0000, 0x3438, 0x16ac, 0x0000, 0x0000, 0x0539, 0x46d5, 0x13e8,
+	    0x0000, 0x3e40, 0x4bf4, 0x07b3, 0x00aa, 0x05c8, 0x4d0c, 0x0bd7,
+	    0x1f7c, 0x1acb, 0x4b14, 0x0000, 0x1fc9, 0x0dc7, 0x2444, 0x2c36,
+	    0x0000, 0x207c, 0x0000, 0x3f8b, 0x1f93, 0x3358, 0x1e36, 0x1efe,
+	    0x31fe, 0x0a58, 0x281f, 0x07c9, 0x0235, 0x21df, 0x37f2, 0x1efb,
+	    0x094f, 0x33d9, 0x4a27, 0x1dad, 0x43b9, 0x1edd, 0x2ede, 0x0266,
+	    0x1e22, 0x2eda, 0x150f, 0x2b15, 0x1389, 0x0372, 0x3d47, 0x0000,
+	    0x3e3b, 0x0800, 0x0000, 0x418d, 0x24dd, 0x073e, 0x2f5e, 0x11db,
+	    0x1587, 0x428d, 0x1538, 0x1ceb, 0x0000, 0x0000, 0x4d7c, 0x0000,
+	    0x4681, 0x3129, 0x10a8, 0x3019, 0x420c, 0x211f, 0x3943, 0x0991,
+	    0x3666, 0x4a3c, 0x04d0, 0x396b, 0x1219, 0x0d35, 0x3706, 0x1b92,
+	    0x46f0, 0x1041, 0x4dbb, 0x0000, 0x49f6, 0x06d8, 0x0ef5, 0x16f7,
+	    0x335e, 0x4695, 0x18a8, 0x06e0, 0x327c, 0x22b3, 0x3bea, 0x0829,
+	    0x282c, 0x1456, 0x2813, 0x3b1d, 0x1cff, 0x342c, 0x0000, 0x429b,
+	    0x0000, 0x2525, 0x0000, 0x4630, 0x2369, 0x2d99, 0x469c, 0x0000,
+	    0x4557, 0x0000, 0x26b8, 0x25df, 0x3bf5, 0x35af, 0x15d6, 0x0000,
+	    0x0000, 0x2cee, 0x0000, 0x32c6, 0x444b, 0x4862, 0x1e52, 0x24e0,
+	    0x0000, 0x0a9c, 0x2d66, 0x0000, 0x037a, 0x00bd, 0x2351, 0x045a,
+	    0x1e10, 0x112a, 0x0000, 0x0000, 0x2a69, 0x363c, 0x42e9, 0x22f9,
+	    0x49ec, 0x03a2, 0x466d, 0x0a1b, 0x11f8, 0x0702, 0x194f, 0x2d87,
+	    0x0000, 0x27fe, 0x0000, 0x1fc8, 0x4151, 0x0000, 0x0113, 0x23f7,
+	    0x1ef6, 0x20f3, 0x20e1, 0x3f12, 0x1fa9, 0x0000, 0x18ff, 0x44e2,
+	    0x0747, 0x0844, 0x4728, 0x0f6e, 0x304c, 0x36e0, 0x0000, 0x4cb1,
+	    0x339c, 0x1901, 0x0000, 0x2121, 0x0000, 0x1096, 0x0a15, 0x0aad,
+	    0x0c19, 0x49aa, 0x0261, 0x25e4, 0x4d41, 0x171d, 0x48b6, 0x152d,
+	    0x2765, 0x3a38, 0x275e, 0x02fb, 0x3c8c, 0x2048, 0x1b8e, 0x0000,
+	    0x010b, 0x09cd, 0x0497, 0x0000, 0x4b76, 0x4588, 0x41e3, 0x1954,
+	    0x3622, 0x486e, 0x146c, 0x3edf, 0x404d, 0x1fd7, 0x3f6d, 0x1f73,
+	    0x3a77, 0x3a23, 0x4ad4, 0x3470, 0x3b23, 0x3fa7, 0x0694, 0x3962,
+	    0x3aaa, 0x3929, 0x26d1, 0x32ec, 0x1bba, 0x4958, 0x49d4, 0x0ec2,
+	    0x0c75, 0x224b, 0x14b4, 0x0bdc, 0x3069, 0x1e50, 0x3c97, 0x2c38,
+	    0x2849, 0x0e4f, 0x4816, 0x4316, 0x2585, 0x37c4, 0x31a2, 0x0000,
+	    0x1282, 0x39f4, 0x39e0, 0x325d, 0x1211, 0x00a3, 0x41b7, 0x0311,
+	    0x2192, 0x0000, 0x4af9, 0x125b, 0x0000, 0x0000, 0x2337, 0x009d,
+	    0x372b, 0x25c0, 0x1115, 0x2aa2, 0x16ae, 0x03e9, 0x475c, 0x19c8,
+	    0x07a9, 0x2161, 0x3637, 0x08af, 0x2d3a, 0x39d9, 0x0f93, 0x11df,
+	    0x44f3, 0x0000, 0x1b20, 0x3f2c, 0x0000, 0x10be, 0x047c, 0x2cfd,
+	    0x384d, 0x0000, 0x2c46, 0x0000, 0x1557, 0x0460, 0x1afa, 0x1d7c,
+	    0x0000, 0x13ed, 0x4d98, 0x24d4, 0x1820, 0x26f7, 0x10bf, 0x1ef1,
+	    0x45ca, 0x1138, 0x0a3e, 0x02d8, 0x3862, 0x2ab8, 0x11ab, 0x0000,
+	    0x1b2b, 0x14be, 0x416f, 0x4944, 0x27df, 0x17f7, 0x3390, 0x21a7,
+	    0x3ea1, 0x3022, 0x349c, 0x0b9f, 0x1779, 0x4a53, 0x1578, 0x2911,
+	    0x0000, 0x4977, 0x153a, 0x1e73, 0x0000, 0x2e88, 0x00e0, 0x287a,
+	    0x42a4, 0x0541, 0x37d3, 0x0caa, 0x4914, 0x33d1, 0x18a3, 0x2daf,
+	    0x0888, 0x0000, 0x39d5, 0x0000, 0x338f, 0x2a89, 0x0000, 0x0c04,
+	    0x4bc9, 0x032d, 0x39b9, 0x480e, 0x0000, 0x3b3c, 0x0000, 0x072a,
+	    0x034c, 0x0317, 0x40fa, 0x09b4, 0x46b3, 0x2eb9, 0x3984, 0x13ed,
+	    0x1547, 0x3136, 0x0000, 0x1f06, 0x0000, 0x1ea0, 0x313c, 0x35de,
+	    0x08a7, 0x08d0, 0x0623, 0x1e1b, 0x1e4e, 0x0dd5, 0x1613, 0x0000,
+	    0x30de, 0x1192, 0x07e0, 0x2b72, 0x1725, 0x1153, 0x0a0f, 0x45af,
+	    0x0917, 0x0000, 0x11fe, 0x3d14, 0x1716, 0x048a, 0x4717, 0x3d7a,
+	    0x3d34, 0x0000, 0x0000, 0x0000, 0x4da5, 0x10a3, 0x1b3f, 0x0ca9,
+	    0x0000, 0x0000, 0x0000, 0x45ee, 0x4a72, 0x0d04, 0x069f, 0x1203,
+	    0x35ef, 0x3f80, 0x1dad, 0x440f, 0x2e98, 0x30c3, 0x2557, 0x0000,
+	    0x129c, 0x32a3, 0x343e, 0x0000, 0x349a, 0x1155, 0x0000, 0x3794,
+	    0x020d, 0x0000, 0x0000, 0x29f2, 0x0512, 0x3798, 0x4395, 0x1450,
+	    0x1266, 0x1c46, 0x0000, 0x0000, 0x412d, 0x3740, 0x2e85, 0x4017,
+	    0x3012, 0x49e5, 0x437b, 0x32ee, 0x3a47, 0x27fb, 0x2853, 0x1afb,
+	    0x16c6, 0x3e67, 0x133b, 0x22de, 0x3545, 0x3538, 0x271a, 0x2418,
+	    0x0000, 0x317f, 0x19b8, 0x0000, 0x46e1, 0x2286, 0x05bb, 0x3e90,
+	    0x333b, 0x3061, 0x406b, 0x4279, 0x0000, 0x1413, 0x2bf7, 0x22f9,
+	    0x0bcf, 0x4759, 0x472c, 0x4b1d, 0x4dd5, 0x4769, 0x24d2, 0x4569,
+	    0x12c4, 0x25e7, 0x0000, 0x1227, 0x00c1, 0x1ace, 0x186e, 0x3e3f,
+	    0x38a3, 0x4db6, 0x05e2, 0x1797, 0x299a, 0x0000, 0x3764, 0x0381,
+	    0x21e2, 0x140a, 0x0352, 0x1edc, 0x065c, 0x4b65, 0x4ccb, 0x4185,
+	    0x248e, 0x2197, 0x0000, 0x28cb, 0x0000, 0x04f7, 0x279b, 0x0000,
+	    0x1284, 0x1385, 0x1da2, 0x12e7, 0x0784, 0x451c, 0x0000, 0x44ae,
+	    0x0ef8, 0x3145, 0x22ec, 0x0000, 0x2b16, 0x02f1, 0x287b, 0x0a6f,
+	    0x1001, 0x1615, 0x30b7, 0x1e8b, 0x2b9e, 0x078f, 0x1b3e, 0x2ec1,
+	    0x0691, 0x0000, 0x2d1b, 0x0000, 0x3dc1, 0x0000, 0x0080, 0x1cb9,
+	    0x2acb, 0x1ba3, 0x1128, 0x0147, 0x0000, 0x31d3, 0x0000, 0x1cd9,
+	    0x39dc, 0x0cee, 0x0000, 0x4a1a, 0x45ca, 0x4143, 0x2c54, 0x016d,
+	    0x35fb, 0x0000, 0x2c18, 0x0cf2, 0x4636, 0x004c, 0x3e7d, 0x3d87,
+	    0x0e92, 0x0e7c, 0x4388, 0x0000, 0x0282, 0x264a, 0x02df, 0x3e9f,
+	    0x0000, 0x111a, 0x4978, 0x16ef, 0x4237, 0x19c0, 0x0000, 0x25b9,
+	    0x0000, 0x06c2, 0x26c4, 0x0000, 0x1caf, 0x3c2b, 0x3c9f, 0x4025,
+	    0x20cf, 0x24c5, 0x0000, 0x0000, 0x0408, 0x4d36, 0x45e1, 0x1af8,
+	    0x2ecd, 0x42fb, 0x22f5, 0x19ea, 0x1930, 0x0000, 0x1f79, 0x0dba,
+	    0x2faf, 0x493d, 0x1946, 0x0082, 0x256b, 0x1986, 0x0000, 0x0000,
+	    0x3803, 0x482b, 0x0be7, 0x3bdf, 0x0acb, 0x0000, 0x3c6f, 0x0000,
+	    0x0000, 0x3a34, 0x0000, 0x4d83, 0x16bd, 0x4af5, 0x3544, 0x3a25,
+	    0x0f60, 0x2f9d, 0x2862, 0x3a49, 0x367d, 0x1bc9, 0x0000, 0x3a59,
+	    0x1878, 0x393f, 0x0563, 0x204e, 0x049a, 0x0000, 0x0000, 0x49df,
+	    0x4dd8, 0x1b70, 0x1f7e, 0x4982, 0x2a47, 0x3f7e, 0x3ce5, 0x35d6,
+	    0x2a36, 0x0000, 0x2658, 0x152a, 0x078c, 0x45b7, 0x0000, 0x308b,
+	    0x0323, 0x2da8, 0x237a, 0x45a7, 0x39df, 0x2c4d, 0x21d8, 0x12fb,
+	    0x2971, 0x0fbd, 0x3052, 0x37d6, 0x48f7, 0x0000, 0x4059, 0x11c1,
+	    0x43ad, 0x111a, 0x3ff0, 0x4632, 0x0000, 0x06e2, 0x0e77, 0x0ac8,
+	    0x0000, 0x0186, 0x0000, 0x3525, 0x0373, 0x3362, 0x1eab, 0x0000,
+	    0x3935, 0x0167, 0x194f, 0x4b56, 0x03c4, 0x3f60, 0x3315, 0x0000,
+	    0x0407, 0x0000, 0x16e3, 0x20eb, 0x1591, 0x4b17, 0x0cdc, 0x1e26,
+	    0x0000, 0x19f2, 0x34ee, 0x2d11, 0x0000, 0x4c59, 0x09b0, 0x0000,
+	    0x2265, 0x0000, 0x25b2, 0x0000, 0x3a07, 0x3967, 0x3aae, 0x3e79,
+	    0x0000, 0x1ff6, 0x2482, 0x3706, 0x36ce, 0x0000, 0x18f8, 0x0d06,
+	    0x179b, 0x126d, 0x35a2, 0x3466, 0x38bf, 0x3a8c, 0x433a, 0x43f4,
+	    0x1980, 0x4b3a, 0x0b19, 0x22cb, 0x346a, 0x2c51, 0x13ff, 0x1c36,
+	    0x04f6, 0x0000, 0x0000, 0x02c2, 0x1735, 0x0000, 0x3bba, 0x3f47,
+	    0x15b7, 0x0000, 0x40b6, 0x005f, 0x3359, 0x0000, 0x1e3e, 0x13fd,
+	    0x0000, 0x218e, 0x0000, 0x3a8b, 0x31db, 0x3c1e, 0x2c0e, 0x4764,
+	    0x4526, 0x49b2, 0x0000, 0x00cb, 0x1504, 0x172f, 0x237f, 0x2e2c,
+	    0x329c, 0x0ecd, 0x09bc, 0x4345, 0x1bc9, 0x451d, 0x1f56, 0x0000,
+	    0x0954, 0x3e93, 0x1bcd, 0x0000, 0x1a47, 0x33e9, 0x1d56, 0x0000,
+	    0x405c, 0x29a0, 0x444d, 0x0000, 0x04fc, 0x06bb, 0x03de, 0x0000,
+	    0x0c59, 0x49cf, 0x0b36, 0x09a7, 0x1be9, 0x016c, 0x056a, 0x0000,
+	    0x1ee0, 0x1196, 0x49e0, 0x1188, 0x022f, 0x4de1, 0x47c7, 0x3f7d,
+	    0x1dcd, 0x29a9, 0x31b7, 0x2237, 0x0000, 0x0000, 0x1ef5, 0x33ba,
+	    0x1a6a, 0x01ed, 0x0000, 0x41bc, 0x0eb1, 0x0cf5, 0x1fa9, 0x069e,
+	    0x0275, 0x1d80, 0x2598, 0x0000, 0x09e6, 0x4ba3, 0x1597, 0x22dd,
+	    0x0000, 0x0cd2, 0x03cf, 0x1026, 0x3bc3, 0x3b92, 0x1747, 0x2d14,
+	    0x4091, 0x1033, 0x2891, 0x00f4, 0x0f83, 0x46c6, 0x3c23, 0x0de2,
+	    0x2d6e, 0x3584, 0x380c, 0x127d, 0x0902, 0x2247, 0x0000, 0x1e7b,
+	    0x21f6, 0x3442, 0x2b39, 0x2a9c, 0x0000, 0x1f13, 0x384c, 0x0000,
+	    0x1a98, 0x4b59, 0x0970, 0x01e7, 0x3e2e, 0x38b4, 0x0d44, 0x0000,
+	    0x2776, 0x201a, 0x263b, 0x15ed, 0x40c8, 0x0e2e, 0x45d3, 0x4610,
+	    0x2295, 0x4589, 0x1b1f, 0x316c, 0x0a26, 0x42d3, 0x30bb, 0x2a68,
+	    0x2497, 0x43b4, 0x0ea7, 0x0000, 0x1385, 0x2e0e, 0x11d4, 0x4d82,
+	    0x22c3, 0x0000, 0x0ecf, 0x0000, 0x2b8e, 0x0000, 0x0000, 0x4c43,
+	    0x0f6f, 0x377d, 0x4a18, 0x2da0, 0x2f0d, 0x2bfc, 0x1bef, 0x1b93,
+	    0x3c7d, 0x0000, 0x46e8, 0x0000, 0x0000, 0x4b78, 0x2c82, 0x4959,
+	    0x09d6, 0x4d99, 0x29c9, 0x43ec, 0x0000, 0x0050, 0x4a6f, 0x0b77,
+	    0x4675, 0x46b1, 0x3a1f, 0x1d90, 0x4cb9, 0x4aef, 0x1813, 0x0000,
+	    0x1b40, 0x4cb2, 0x1148, 0x2b3b, 0x4d7f, 0x0000, 0x282e, 0x2f55,
+	    0x0000, 0x0000, 0x4534, 0x0dd3, 0x06f9, 0x3975, 0x1569, 0x3e8c,
+	    0x0000, 0x0000, 0x06a0, 0x4201, 0x0abd, 0x0000, 0x1bc3, 0x458c,
+	    0x498b, 0x0000, 0x02d6, 0x1cc1, 0x0951, 0x3ff8, 0x0000, 0x4c22,
+	    0x0b19, 0x0000, 0x1834, 0x481a, 0x43bf, 0x19fa, 0x2b33, 0x0ce2,
+	    0x227c, 0x019a, 0x2901, 0x0000, 0x0f55, 0x0000, 0x4c61, 0x3b80,
+	    0x3a3d, 0x4053, 0x2573, 0x3246, 0x46e4, 0x3ca5, 0x02a9, 0x0590,
+	    0x3056, 0x0000, 0x0be2, 0x48a3, 0x27bc, 0x01e3, 0x37d0, 0x223f,
+	    0x496e, 0x3a16, 0x1bb4, 0x4b0f, 0x36ee, 0x33c8, 0x1977, 0x4456,
+	    0x461a, 0x2c44, 0x4ccd, 0x107d, 0x064b, 0x46a0, 0x3e31, 0x4443,
+	    0x2382, 0x47c1, 0x1879, 0x1329, 0x0900, 0x17f7, 0x1545, 0x3615,
+	    0x1018, 0x1b90, 0x30fd, 0x41f7, 0x0268, 0x0000, 0x1d4e, 0x1003,
+	    0x0000, 0x25b1, 0x3970, 0x2218, 0x0000, 0x0000, 0x0a7d, 0x11da,
+	    0x0000, 0x164b, 0x3347, 0x14c1, 0x4427, 0x16f8, 0x35c8, 0x4070,
+	    0x0224, 0x314e, 0x0e9b, 0x0000, 0x4378, 0x34f9, 0x4c1c, 0x004c,
+	    0x096f, 0x2404, 0x2205, 0x1b5a, 0x4c0c, 0x3a12, 0x1fa7, 0x1b91,
+	    0x114b, 0x0969, 0x344e, 0x0000, 0x19fd, 0x2fa3, 0x1240, 0x4545,
+	    0x1be3, 0x2ef2, 0x49be, 0x2693, 0x2c89, 0x2aad, 0x2673, 0x0000,
+	    0x0bb7, 0x0000, 0x0d40, 0x0000, 0x0000, 0x2737, 0x1168, 0x06bf,
+	    0x1fb0, 0x1efc, 0x0000, 0x1a3d, 0x06fa, 0x24a9, 0x1c96, 0x0123,
+	    0x104d, 0x26d9, 0x2c56, 0x4039, 0x26d5, 0x0c86, 0x2807, 0x346f,
+	    0x1fac, 0x190a, 0x2c62, 0x0000, 0x087f, 0x0f18, 0x4a92, 0x368f,
+	    0x41dc, 0x4754, 0x1eed, 0x1a4c, 0x0d4a, 0x2315, 0x3f71, 0x0d12,
+	    0x0000, 0x0000, 0x0953, 0x3030, 0x0000, 0x0e92, 0x2985, 0x3a4b,
+	    0x18bc, 0x0000, 0x296e, 0x0000, 0x0000, 0x0376, 0x2268, 0x2efb,
+	    0x2cef, 0x1749, 0x0874, 0x17a8, 0x4ae5, 0x3a17, 0x3a61, 0x45fe,
+	    0x1dd0, 0x2453, 0x0000, 0x1b6d, 0x06ce, 0x4a9a, 0x4054, 0x2d64,
+	    0x28a7, 0x058b, 0x3520, 0x0000, 0x49f5, 0x48ef, 0x0832, 0x2b94,
+	    0x17a0, 0x3b27, 0x27e2, 0x1f3f, 0x14bc, 0x173a, 0x0000, 0x1ce6,
+	    0x0766, 0x0c64, 0x0f9a, 0x2f75, 0x0000, 0x44f5, 0x0bca, 0x0000,
+	    0x48c3, 0x2c39, 0x0376, 0x0000, 0x2d61, 0x3c2b, 0x0000, 0x1ab3,
+	    0x2f3f, 0x4b11, 0x45c1, 0x3a27, 0x0000, 0x2983, 0x27f9, 0x3cb6,
+	    0x4748, 0x2f41, 0x0000, 0x205c, 0x19af, 0x3693, 0x03b5, 0x335d,
+	    0x044a, 0x0713, 0x12a1, 0x2567, 0x21b2, 0x3eca, 0x1d81, 0x0000,
+	    0x07c3, 0x3147, 0x0aa4, 0x36e0, 0x0992, 0x2881, 0x0000, 0x26d6,
+	    0x2492, 0x4b59, 0x34bc, 0x3311, 0x2222, 0x0000, 0x0000, 0x2ed7,
+	    0x134e, 0x3445, 0x0d2c, 0x275d, 0x271a, 0x2e26, 0x376c, 0x4184,
+	    0x35a2, 0x2a06, 0x42c7, 0x217a, 0x1c89, 0x1c50, 0x3f70, 0x0238,
+	    0x4b86, 0x21be, 0x450f, 0x3180, 0x0000, 0x085e, 0x12ed, 0x190c,
+	    0x4244, 0x14f2, 0x082b, 0x095e, 0x1a66, 0x1805, 0x32d3, 0x2ce2,
+	    0x0000, 0x16ae, 0x0000, 0x0000, 0x03d6, 0x0000, 0x2d56, 0x37d3,
+	    0x3baf, 0x0000, 0x0f02, 0x2460, 0x3717, 0x1e1f, 0x4c4d, 0x1301,
+	    0x3570, 0x3ef9, 0x3c21, 0x171b, 0x3303, 0x111a, 0x0000, 0x2eae,
+	    0x0039, 0x075d, 0x3de9, 0x1b1c, 0x1770, 0x0000, 0x0c55, 0x4c1e,
+	    0x447f, 0x0000, 0x2346, 0x2ae3, 0x39f7, 0x32c5, 0x249d, 0x398a,
+	    0x3925, 0x0000, 0x32b3, 0x0000, 0x07bb, 0x07fa, 0x4628, 0x0000,
+	    0x0000, 0x304d, 0x0fbd, 0x0000, 0x4502, 0x35ff, 0x320f, 0x1938,
+	    0x31a2, 0x264a, 0x3299, 0x2358, 0x3c92, 0x0a22, 0x1c47, 0x0864,
+	    0x0ed3, 0x307d, 0x4812, 0x38fd, 0x2af7, 0x1f8f, 0x0000, 0x196f,
+	    0x3ffc, 0x19ae, 0x164c, 0x23b4, 0x0000, 0x0000, 0x0e2d, 0x4dcb,
+	    0x0000, 0x3cbb, 0x2cfc, 0x08a0, 0x18dc, 0x21f7, 0x0c32, 0x2525,
+	    0x28b8, 0x4b76, 0x0000, 0x39bd, 0x15bc, 0x1a29, 0x2387, 0x0000,
+	    0x0000, 0x0466, 0x3d76, 0x3288, 0x3956, 0x00b0, 0x0c59, 0x0c80,
+	    0x44de, 0x0000, 0x2c12, 0x0000, 0x40b4, 0x2712, 0x4a3a, 0x0000,
+	    0x0c53, 0x3457, 0x3da5, 0x421c, 0x0ed9, 0x478e, 0x3f26, 0x3599,
+	    0x0000, 0x1443, 0x0415, 0x1171, 0x3111, 0x44ad, 0x3081, 0x0000,
+	    0x29f7, 0x4a94, 0x47af, 0x058c, 0x4af9, 0x11fe, 0x4b3a, 0x1876,
+	    0x338c, 0x2402, 0x2823, 0x0000, 0x49dc, 0x044c, 0x0000, 0x0400,
+	    0x3d84, 0x25f6, 0x0000, 0x30ce, 0x4dde, 0x164e, 0x0424, 0x2180,
+	    0x0000, 0x0000, 0x0000, 0x24e7, 0x447a, 0x1f3b, 0x2aae, 0x38de,
+	    0x31a7, 0x0000, 0x1ac6, 0x2a8d, 0x0000, 0x325e, 0x35b9, 0x0000,
+	    0x2c16, 0x3e36, 0x0000, 0x1a42, 0x0000, 0x1a39, 0x0224, 0x0000,
+	    0x30d1, 0x12e7, 0x031c, 0x3465, 0x07cf, 0x0576, 0x016c, 0x47ea,
+	    0x340b, 0x1468, 0x1e50, 0x0000, 0x2a8d, 0x26dd, 0x2d25, 0x283a,
+	    0x025b, 0x46b9, 0x1798, 0x0bd8, 0x3a28, 0x1c9b, 0x1f79, 0x0e43,
+	    0x0a76, 0x1534, 0x0c1c, 0x4c61, 0x1eff, 0x1bd3, 0x0000, 0x0fdf,
+	    0x2098, 0x0000, 0x4195, 0x228a, 0x120b, 0x39ce, 0x1ecd, 0x0000,
+	    0x4560, 0x046d, 0x47aa, 0x4946, 0x0e49, 0x250b, 0x2f0d, 0x4bdd,
+	    0x484d, 0x2fff, 0x42eb, 0x3260, 0x1783, 0x3765, 0x4942, 0x191d,
+	    0x1bc1, 0x1166, 0x0000, 0x2858, 0x0d4c, 0x3c56, 0x2bef, 0x0b77,
+	    0x0000, 0x26a3, 0x14b2, 0x2b27, 0x33e7, 0x1171, 0x2ae2, 0x4194,
+	    0x4469, 0x4556, 0x392e, 0x1989, 0x1ec1, 0x282c, 0x408b, 0x472e,
+	    0x3167, 0x0000, 0x0000, 0x469e, 0x3f5c, 0x0000, 0x0683, 0x40fb,
+	    0x2402, 0x3482, 0x2712, 0x1e70, 0x3134, 0x0000, 0x1bc0, 0x1d3e,
+	    0x02fe, 0x1549, 0x3cc1, 0x3809, 0x4a10, 0x4139, 0x3e17, 0x0000,
+	    0x37c8, 0x0000, 0x08f6, 0x46bf, 0x37e1, 0x3c91, 0x1d0b, 0x0000,
+	    0x0000, 0x0000, 0x4a2f, 0x0000, 0x0600, 0x0000, 0x3181, 0x0000,
+	    0x0000, 0x0000, 0x3209, 0x4a25, 0x2573, 0x06b4, 0x2d78, 0x0000,
+	    0x0000, 0x39d9, 0x2d40, 0x4d39, 0x2eec, 0x4ac5, 0x3852, 0x2170,
+	    0x0000, 0x0000, 0x341c, 0x252e, 0x053e, 0x3cf0, 0x4c69, 0x30fa,
+	    0x0000, 0x0000, 0x0000, 0x1506, 0x3b98, 0x1dc8, 0x0442, 0x276c,
+	    0x46fd, 0x0000, 0x2ae3, 0x0000, 0x3c94, 0x219b, 0x0000, 0x0cf7,
+	    0x3815, 0x3b90, 0x3ca1, 0x29d0, 0x40e4, 0x23c3, 0x3493, 0x3cd4,
+	    0x4252, 0x0000, 0x030c, 0x0000, 0x458f, 0x056f, 0x0000, 0x0caa,
+	    0x409e, 0x481b, 0x44d1, 0x0883, 0x1808, 0x1145, 0x03a3, 0x4071,
+	    0x3e5b, 0x0000, 0x0712, 0x3c52, 0x0ff5, 0x140d, 0x3577, 0x2130,
+	    0x01d3, 0x4d2f, 0x0606, 0x1dff, 0x0000, 0x2962, 0x0000, 0x06d9,
+	    0x358e, 0x1e44, 0x3405, 0x29a9, 0x1e3d, 0x2314, 0x0000, 0x0000,
+	    0x057c, 0x01b4, 0x2ac1, 0x340e, 0x3597, 0x3e83, 0x4c57, 0x474e,
+	    0x3489, 0x09bb, 0x0971, 0x182a, 0x1ccc, 0x4868, 0x2da1, 0x0000,
+	    0x0000, 0x390a, 0x3fac, 0x3b3c, 0x2c26, 0x0519, 0x1c36, 0x150c,
+	    0x4388, 0x0d64, 0x1c87, 0x288a, 0x2dbf, 0x0000, 0x3a8f, 0x43c4,
+	    0x3d51, 0x0000, 0x2da7, 0x20a6, 0x2cc0, 0x2184, 0x4213, 0x0c87,
+	    0x0000, 0x0000, 0x47d3, 0x2116, 0x09bb, 0x2871, 0x335d, 0x4d24,
+	    0x334e, 0x4408, 0x23a0, 0x25e1, 0x3cb2, 0x4c92, 0x1152, 0x0000,
+	    0x2773, 0x2935, 0x41eb, 0x0000, 0x4b2e, 0x488d, 0x4458, 0x0000,
+	    0x45a4, 0x0ccb, 0x0f39, 0x4c7d, 0x090b, 0x3b66, 0x0000, 0x0000,
+	    0x2d19, 0x2420, 0x3c17, 0x3e4e, 0x0000, 0x1198, 0x0985, 0x2077,
+	    0x3be1, 0x2052, 0x37d6, 0x4c0b, 0x4197, 0x13c8, 0x215f, 0x3ddf,
+	    0x3503, 0x0f80, 0x1f7b, 0x36ed, 0x1c26, 0x13e7, 0x0000, 0x0000,
+	    0x2d88, 0x0b9f, 0x109c, 0x400b, 0x0000, 0x0107, 0x3fdf, 0x441d,
+	    0x0000, 0x4485, 0x4c0f, 0x2c0d, 0x280b, 0x3b4a, 0x2289, 0x0000,
+	    0x0000, 0x281f, 0x3b4f, 0x4a6d, 0x1dd6, 0x33d2, 0x0000, 0x347f,
+	    0x25fb, 0x18bf, 0x115b, 0x2762, 0x0000, 0x41d3, 0x4158, 0x0000,
+	    0x46eb, 0x3aa9, 0x124a, 0x0000, 0x2d5a, 0x2be0, 0x1da7, 0x0000,
+	    0x0ff2, 0x36bf, 0x43c9, 0x0cb1, 0x3325, 0x2bec, 0x30ba, 0x0139,
+	    0x3fb3, 0x14a4, 0x49d8, 0x0c27, 0x0000, 0x166e, 0x1df9, 0x37b8,
+	    0x190c, 0x255f, 0x0000, 0x144a, 0x0e3e, 0x0000, 0x0000, 0x4cc4,
+	    0x0ac0, 0x30d4, 0x287d, 0x0000, 0x0cf7, 0x3338, 0x27ca, 0x249a,
+	    0x31a3, 0x10ec, 0x11df, 0x0000, 0x30d1, 0x009c, 0x05ab, 0x05ed,
+	    0x1eb1, 0x23e5, 0x2516, 0x00c2, 0x0f71, 0x1339, 0x0000, 0x0ed4,
+	    0x2c4d, 0x4909, 0x07ac, 0x3fa7, 0x0dfc, 0x0000, 0x1154, 0x46b1,
+	    0x0000, 0x4b7b, 0x32e0, 0x43f4, 0x0000, 0x1999, 0x0098, 0x3bfb,
+	    0x1275, 0x458e, 0x12b6, 0x0f89, 0x0000, 0x27b7, 0x392f, 0x145d,
+	    0x0000, 0x3b5a, 0x130a, 0x2863, 0x0180, 0x108c, 0x1d42, 0x0746,
+	    0x014d, 0x0637, 0x2f2f, 0x019b, 0x4696, 0x2850, 0x1384, 0x0000,
+	    0x2712, 0x0000, 0x1784, 0x0000, 0x48c6, 0x4726, 0x0000, 0x0000,
+	    0x04f3, 0x0000, 0x3a95, 0x0845, 0x13f1, 0x43d2, 0x3b65, 0x0291,
+	    0x2f42, 0x06f8, 0x362a, 0x1cde, 0x2af2, 0x12fc, 0x2e4b, 0x0000,
+	    0x3aaa, 0x23c5, 0x2c5f, 0x2628, 0x4118, 0x0eac, 0x03eb, 0x2d42,
+	    0x42ce, 0x25ff, 0x1098, 0x0d6e, 0x1de7, 0x0000, 0x2ce6, 0x0000,
+	    0x33ac, 0x36d1, 0x3562, 0x28f3, 0x2fee, 0x0000, 0x31fb, 0x4d54,
+	    0x3c6d, 0x0000, 0x0000, 0x081f, 0x3d6b, 0x30b8, 0x03f7, 0x182a,
+	    0x2de3, 0x35d0, 0x4298, 0x0000, 0x0000, 0x1eff, 0x3b96, 0x44ce,
+	    0x0da0, 0x1089, 0x0000, 0x4602, 0x0000, 0x3269, 0x0128, 0x0000,
+	    0x0000, 0x12a9, 0x4528, 0x0d7b, 0x350f, 0x3403, 0x3dba, 0x1027,
+	    0x1c27, 0x00d4, 0x2b98, 0x332c, 0x39e6, 0x3b3d, 0x1c24, 0x0000,
+	    0x2a52, 0x40dd, 0x2d01, 0x05ff, 0x403d, 0x1f16, 0x0000, 0x40e9,
+	    0x28c3, 0x0ffa, 0x2e69, 0x4d18, 0x1f18, 0x0000, 0x394b, 0x3607,
+	    0x1012, 0x0000, 0x088a, 0x2101, 0x1fef, 0x39c6, 0x205d, 0x3248,
+	    0x023b, 0x0000, 0x433b, 0x1973, 0x17a4, 0x0181, 0x06f4, 0x0000,
+	    0x1a5c, 0x1ca3, 0x09a5, 0x3111, 0x423e, 0x26c8, 0x4471, 0x31da,
+	    0x16ba, 0x0e49, 0x09b7, 0x0b6c, 0x43a2, 0x0a6d, 0x0000, 0x36c0,
+	    0x1e3f, 0x1d23, 0x35ed, 0x4b81, 0x267c, 0x1e73, 0x0000, 0x240c,
+	    0x074e, 0x0000, 0x3866, 0x3781, 0x1111, 0x03cc, 0x0000, 0x0000,
+	    0x47ca, 0x07d5, 0x0000, 0x0000, 0x3d66, 0x1f72, 0x0036, 0x2194,
+	    0x48de, 0x0e99, 0x0000, 0x0000, 0x0000, 0x4466, 0x0ac4, 0x0b44,
+	    0x3fbc, 0x40b2, 0x0000, 0x0b3d, 0x44e8, 0x0815, 0x0000, 0x44bb,
+	    0x070a, 0x3945, 0x0378, 0x360f, 0x47ac, 0x3edf, 0x25d5, 0x0000,
+	    0x4093, 0x12a0, 0x0000, 0x4475, 0x1d23, 0x0000, 0x26bd, 0x17c9,
+	    0x39ff, 0x0000, 0x0000, 0x06ba, 0x3667, 0x1a81, 0x15a3, 0x1e91,
+	    0x0000, 0x1758, 0x0e1c, 0x43e7, 0x3ded, 0x1fe3, 0x4060, 0x0c3e,
+	    0x0000, 0x0000, 0x13ab, 0x4117, 0x0f36, 0x0cb2, 0x3763, 0x2e36,
+	    0x31d0, 0x3b20, 0x0655, 0x37ae, 0x0000, 0x4860, 0x1403, 0x062f,
+	    0x0d2e, 0x1120, 0x317c, 0x0c99, 0x3a4b, 0x1e6b, 0x0b66, 0x2877,
+	    0x0632, 0x30c4, 0x28f7, 0x392b, 0x051c, 0x3a17, 0x3a3d, 0x3d79,
+	    0x3013, 0x04ac, 0x4aea, 0x288c, 0x0000, 0x0000, 0x3f97, 0x3930,
+	    0x2669, 0x490f, 0x2288, 0x14b3, 0x20dc, 0x3aa8, 0x1cd1, 0x11ee,
+	    0x1019, 0x192b, 0x117b, 0x1470, 0x4dfa, 0x0000, 0x0000, 0x0846,
+	    0x3d89, 0x14d5, 0x25cc, 0x3da5, 0x0000, 0x0d5d, 0x0000, 0x40e9,
+	    0x4545, 0x4c7d, 0x2e19, 0x0000, 0x0bcc, 0x299d, 0x0c08, 0x0000,
+	    0x28cd, 0x0000, 0x3ac0, 0x0dba, 0x4c10, 0x0bfd, 0x0000, 0x27b6,
+	    0x0e09, 0x2063, 0x0000, 0x04fb, 0x1090, 0x0afd, 0x0000, 0x0f8d,
+	    0x0447, 0x2b9b, 0x0d7d, 0x0de7, 0x1e64, 0x4bab, 0x0549, 0x3631,
+	    0x366d, 0x0000, 0x005e, 0x0000, 0x3b64, 0x304d, 0x21b0, 0x16c7,
+	    0x0109, 0x322e, 0x0000, 0x20d3, 0x0d31, 0x4b45, 0x118d, 0x14f5,
+	    0x0dcf, 0x4daf, 0x22c4, 0x2efa, 0x1bc9, 0x46dd, 0x14e3, 0x0cc3,
+	    0x3137, 0x3741, 0x0000, 0x22c9, 0x1acb, 0x26ea, 0x24b3, 0x4e1c,
+	    0x3a44, 0x312b, 0x2ca2, 0x0000, 0x10aa, 0x4979, 0x256c, 0x0000,
+	    0x172e, 0x3b6a, 0x0e8f, 0x3b32, 0x3d5e, 0x3d22, 0x3e92, 0x230f,
+	    0x1ec6, 0x4ba9, 0x1658, 0x3db5, 0x0e64, 0x10e7, 0x1c2d, 0x2b6f,
+	    0x4756, 0x2d76, 0x0000, 0x20d0, 0x2479, 0x44f6, 0x444b, 0x49a3,
+	    0x0000, 0x2469, 0x04e0, 0x0000, 0x1681, 0x1e0a, 0x4d7c, 0x0000,
+	    0x3cbf, 0x25a7, 0x2955, 0x00e6, 0x0137, 0x39ed, 0x40a3, 0x4377,
+	    0x1a80, 0x11b7, 0x141f, 0x484a, 0x1cc5, 0x1869, 0x47f5, 0x1417,
+	    0x164c, 0x4a80, 0x0d34, 0x4462, 0x0000, 0x493f, 0x15c4, 0x1610,
+	    0x461a, 0x4725, 0x27e9, 0x0c30, 0x0899, 0x44d3, 0x0c74, 0x2356,
+	    0x0000, 0x0000, 0x339c, 0x2ddf, 0x482d, 0x0000, 0x3de8, 0x35a6,
+	    0x1209, 0x3283, 0x222b, 0x311e, 0x18b1, 0x05e1, 0x22a0, 0x2178,
+	    0x45a1, 0x40c6, 0x2d66, 0x25d1, 0x1fae, 0x3a9c, 0x018a, 0x0000,
+	    0x0000, 0x129b, 0x4852, 0x078f, 0x2a6f, 0x0710, 0x3da9, 0x41f3,
+	    0x43c1, 0x4670, 0x1617, 0x0000, 0x14b2, 0x08ea, 0x46f6, 0x43df,
+	    0x28ac, 0x08d3, 0x0000, 0x0598, 0x28ef, 0x06a5, 0x0e3d, 0x3d85,
+	    0x3dfe, 0x450d, 0x48cb, 0x3fc3, 0x0dfe, 0x0000, 0x1107, 0x3cbb,
+	    0x4cda, 0x4ca2, 0x40bf, 0x4133, 0x0000, 0x0000, 0x2d68, 0x3cec,
+	    0x38a9, 0x00fe, 0x1ba1, 0x186e, 0x3343, 0x22e3, 0x0000, 0x1a51,
+	    0x20c5, 0x07f9, 0x0000, 0x21e5, 0x4c3d, 0x49a2, 0x4753, 0x411e,
+	    0x4756, 0x317b, 0x2320, 0x0000, 0x4b5e, 0x02c8, 0x085a, 0x0000,
+	    0x42c2, 0x3a40, 0x3696, 0x0000, 0x0e5f, 0x144b, 0x3592, 0x4945,
+	    0x0000, 0x4a88, 0x0000, 0x0000, 0x0000, 0x0173, 0x1f32, 0x0922,
+	    0x4a5d, 0x0854, 0x0000, 0x34eb, 0x0d93, 0x1f80, 0x358d, 0x0000,
+	    0x2f26, 0x124a, 0x3668, 0x0000, 0x2415, 0x16bc, 0x09a9, 0x1ed9,
+	    0x1c95, 0x034c, 0x294e, 0x3bcd, 0x4bc6, 0x1968, 0x15f1, 0x2825,
+	    0x06f6, 0x4650, 0x02cc, 0x2ab4, 0x312c, 0x0000, 0x3de4, 0x1529,
+	    0x2137, 0x0553, 0x37c7, 0x0000, 0x0000, 0x2f1f, 0x0000, 0x20ea,
+	    0x28f9, 0x4aee, 0x16bd, 0x0000, 0x38e1, 0x0000, 0x034b, 0x0000,
+	    0x2770, 0x1976, 0x11ae, 0x0000, 0x4558, 0x17b3, 0x4a2b, 0x40b5,
+	    0x115d, 0x42af, 0x2c93, 0x2825, 0x2789, 0x1567, 0x40a0, 0x449e,
+	    0x0496, 0x2ad2, 0x44fd, 0x3a6d, 0x0000, 0x4dd8, 0x28de, 0x3a84,
+	    0x4859, 0x1c7b, 0x1e86, 0x0000, 0x0c42, 0x45d1, 0x05f6, 0x218c,
+	    0x3647, 0x0000, 0x3ab7, 0x4293, 0x1145, 0x4c53, 0x31aa, 0x1339,
+	    0x2000, 0x0ce4, 0x1094, 0x381b, 0x0ae2, 0x2862, 0x48cf, 0x0000,
+	    0x3db8, 0x0000, 0x25be, 0x3afa, 0x1b0c, 0x13f3, 0x309f, 0x0000,
+	    0x3014, 0x082d, 0x4ab8, 0x35f4, 0x0000, 0x1726, 0x4392, 0x3352,
+	    0x2f7d, 0x4633, 0x38a9, 0x0684, 0x3783, 0x1982, 0x01d2, 0x085c,
+	    0x154c, 0x2efc, 0x4688, 0x0000, 0x451e, 0x257f, 0x21c6, 0x0000,
+	    0x396c, 0x4ddc, 0x08ba, 0x007e, 0x0000, 0x0000, 0x4832, 0x1bc6,
+	    0x2126, 0x3829, 0x0514, 0x18c5, 0x3392, 0x0000, 0x05d0, 0x2aaf,
+	    0x0000, 0x3ea4, 0x3c96, 0x1188, 0x14ec, 0x3057, 0x4257, 0x2f29,
+	    0x06bb, 0x3670, 0x0000, 0x0000, 0x25fa, 0x221f, 0x0952, 0x4beb,
+	    0x0000, 0x0000, 0x4684, 0x12e9, 0x4006, 0x1793, 0x0000, 0x3b16,
+	    0x2e06, 0x13c9, 0x1c53, 0x2c3a, 0x4853, 0x1a47, 0x36c7, 0x0d84,
+	    0x3710, 0x4b16, 0x4058, 0x0000, 0x1fba, 0x4327, 0x0000, 0x3de6,
+	    0x1450, 0x1fb7, 0x0000, 0x27d6, 0x0d91, 0x2ac3, 0x064b, 0x3440,
+	    0x0000, 0x049f, 0x02c9, 0x4d6f, 0x0000, 0x0915, 0x0000, 0x213f,
+	    0x2d57, 0x1821, 0x36b2, 0x083f, 0x34c2, 0x4822, 0x3278, 0x0960,
+	    0x1775, 0x1b9f, 0x0198, 0x04be, 0x2f27, 0x4b47, 0x3a76, 0x0000,
+	    0x3fa1, 0x2476, 0x0da2, 0x0000, 0x0000, 0x4bdb, 0x0000, 0x069c,
+	    0x20e7, 0x2182, 0x172b, 0x1ab2, 0x0570, 0x0000, 0x3b22, 0x0000,
+	    0x3b4e, 0x0ea9, 0x4487, 0x1f6a, 0x0ebb, 0x1ef3, 0x33c0, 0x178d,
+	    0x0000, 0x0000, 0x003e, 0x3620, 0x0000, 0x0000, 0x24dc, 0x0000,
+	    0x2761, 0x2950, 0x1c65, 0x2cee, 0x10be, 0x19c6, 0x0000, 0x4bf3,
+	    0x0000, 0x0000, 0x28c2, 0x2242, 0x48ee, 0x1da5, 0x4599, 0x1f40,
+	    0x32de, 0x0c46, 0x4666, 0x1024, 0x3054, 0x10e4, 0x40e0, 0x0000,
+	    0x0000, 0x4512, 0x0348, 0x4185, 0x20c3, 0x2b71, 0x0000, 0x0000,
+	    0x0000, 0x1a17, 0x16e3, 0x0f34, 0x0000, 0x352d, 0x1762, 0x1a0a,
+	    0x07a2, 0x0e69, 0x0000, 0x46fb, 0x2da2, 0x03ba, 0x1541, 0x2e62,
+	    0x10dd, 0x2a00, 0x3a45, 0x4271, 0x2f61, 0x334a, 0x08f4, 0x4d0d,
+	    0x3863, 0x0f34, 0x104a, 0x0f86, 0x0a53, 0x0000, 0x3f0f, 0x0000,
+	    0x4b07, 0x1d0a, 0x0005, 0x169d, 0x170f, 0x0000, 0x34d2, 0x4509,
+	    0x089a, 0x01c8, 0x1a2d, 0x1877, 0x2ec6, 0x0f0d, 0x0000, 0x063d,
+	    0x16c2, 0x111c, 0x3111, 0x484b, 0x47d5, 0x11c4, 0x0be0, 0x4516,
+	    0x199f, 0x320c, 0x0000, 0x2996, 0x44cb, 0x0205, 0x03f8, 0x3e5f,
+	    0x381c, 0x274b, 0x3054, 0x1e2f, 0x0000, 0x0000, 0x216d, 0x23ef,
+	    0x1c48, 0x3539, 0x0000, 0x4713, 0x487a, 0x1b0b, 0x0bea, 0x2614,
+	    0x21f8, 0x0972, 0x425e, 0x465e, 0x14bf, 0x4ade, 0x0000, 0x3d64,
+	    0x0f1c, 0x3554, 0x0000, 0x0000, 0x12fa, 0x475e, 0x288e, 0x08f5,
+	    0x21bf, 0x09d7, 0x2790, 0x1477, 0x10d8, 0x058f, 0x0000, 0x23a6,
+	    0x0c88, 0x36a5, 0x494b, 0x4aa7, 0x190c, 0x4a97, 0x1eb4, 0x0000,
+	    0x3b38, 0x4de4, 0x1ea0, 0x39e2, 0x0000, 0x18d9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x19bf, 0x09f4, 0x00ec, 0x33d1, 0x0c6a, 0x0cc7,
+	    0x2a15, 0x2a8d, 0x31de, 0x1543, 0x24b6, 0x2ae1, 0x1ac3, 0x3442,
+	    0x4844, 0x3ef6, 0x0e74, 0x021c, 0x2a79, 0x4867, 0x0000, 0x224e,
+	    0x1c7c, 0x085c, 0x1030, 0x4444, 0x3658, 0x1ac7, 0x0000, 0x0000,
+	    0x4c35, 0x3bf2, 0x0000, 0x0170, 0x2fa5, 0x2b22, 0x3fed, 0x0000,
+	    0x3dbc, 0x22ce, 0x04ad, 0x2604, 0x3971, 0x3d7b, 0x26d6, 0x0000,
+	    0x453a, 0x00e0, 0x0000, 0x2674, 0x0000, 0x2902, 0x4cb0, 0x1d2f,
+	    0x3def, 0x43fb, 0x01ec, 0x1ae6, 0x0000, 0x3c52, 0x1155, 0x0db1,
+	    0x0000, 0x0000, 0x0000, 0x143e, 0x0a33, 0x0000, 0x0717, 0x2a6d,
+	    0x2f69, 0x177c, 0x0000, 0x2a5d, 0x31aa, 0x4bf7, 0x35fa, 0x4449,
+	    0x1567, 0x1c90, 0x445a, 0x1d65, 0x343c, 0x2016, 0x0000, 0x0000,
+	    0x3cec, 0x0ca8, 0x0000, 0x3e04, 0x2700, 0x279f, 0x2bcb, 0x0a98,
+	    0x4848, 0x25f9, 0x0000, 0x29ba, 0x258e, 0x1c50, 0x2a9c, 0x3e78,
+	    0x2e28, 0x042e, 0x3202, 0x0000, 0x19cc, 0x2291, 0x3772, 0x0e2d,
+	    0x3d82, 0x0f19, 0x0a8f, 0x28f7, 0x230e, 0x0000, 0x1e14, 0x430e,
+	    0x0776, 0x4b8f, 0x4ce3, 0x37d9, 0x30c0, 0x0558, 0x34e9, 0x4d06,
+	    0x2db6, 0x0000, 0x33c7, 0x0000, 0x0eea, 0x0000, 0x2d2c, 0x22ad,
+	    0x036e, 0x4b03, 0x3e6f, 0x300a, 0x310f, 0x497c, 0x0b85, 0x47f9,
+	    0x013b, 0x0668, 0x2d43, 0x0000, 0x0000, 0x315c, 0x06f2, 0x06d2,
+	    0x0416, 0x4acd, 0x059f, 0x3d05, 0x0d15, 0x1dc4, 0x43a4, 0x4857,
+	    0x0385, 0x316d, 0x1194, 0x4138, 0x0000, 0x1b3e, 0x379d, 0x2efc,
+	    0x0000, 0x3971, 0x4767, 0x3f26, 0x384f, 0x4330, 0x4097, 0x198b,
+	    0x3488, 0x2d9f, 0x411a, 0x3c19, 0x34b8, 0x1d56, 0x1cea, 0x400b,
+	    0x43a8, 0x0000, 0x0000, 0x1034, 0x0000, 0x0169, 0x076b, 0x0000,
+	    0x0000, 0x4aba, 0x2f0b, 0x33b5, 0x1e5d, 0x0575, 0x19d3, 0x3ebd,
+	    0x0000, 0x3dbc, 0x20c2, 0x0000, 0x3c3e, 0x4dbb, 0x2913, 0x03f8,
+	    0x3499, 0x0000, 0x2464, 0x0000, 0x184f, 0x35b4, 0x4a4f, 0x2d05,
+	    0x1c49, 0x0000, 0x11b1, 0x4c13, 0x0120, 0x01c2, 0x3193, 0x4ddc,
+	    0x2772, 0x0d46, 0x38ea, 0x0000, 0x0583, 0x032e, 0x40f7, 0x4039,
+	    0x0edf, 0x316f, 0x2638, 0x0000, 0x0215, 0x0000, 0x3c7f, 0x3aea,
+	    0x1916, 0x0000, 0x1230, 0x348a, 0x0000, 0x22bd, 0x3083, 0x2fee,
+	    0x275c, 0x0000, 0x38a9, 0x2a3b, 0x02c7, 0x010b, 0x253d, 0x4775,
+	    0x38ee, 0x3511, 0x2acd, 0x00ed, 0x092f, 0x2a59, 0x17bc, 0x47d4,
+	    0x04a6, 0x25f1, 0x0000, 0x1568, 0x0000, 0x37bf, 0x4a66, 0x0497,
+	    0x23f2, 0x06bb, 0x3a29, 0x0000, 0x0000, 0x2d97, 0x0000, 0x4600,
+	    0x126b, 0x3160, 0x29e9, 0x4a12, 0x03ba, 0x471e, 0x0000, 0x0000,
+	    0x290d, 0x346f, 0x0000, 0x0f62, 0x195f, 0x4019, 0x3f4b, 0x2701,
+	    0x312c, 0x059f, 0x2923, 0x4bce, 0x1f22, 0x316f, 0x0266, 0x4271,
+	    0x2b3b, 0x200f, 0x1282, 0x4c03, 0x3f42, 0x05c8, 0x391f, 0x2b24,
+	    0x252f, 0x2ff2, 0x0000, 0x0304, 0x4033, 0x409e, 0x04f0, 0x29fa,
+	    0x014b, 0x0092, 0x19a9, 0x1718, 0x19ff, 0x2d8d, 0x4a88, 0x0000,
+	    0x11a4, 0x17d0, 0x0000, 0x0f04, 0x0c8a, 0x4283, 0x09c0, 0x0000,
+	    0x2a6d, 0x1e63, 0x2daa, 0x1ba8, 0x3001, 0x1163, 0x0000, 0x0cec,
+	    0x05c0, 0x4bad, 0x30ed, 0x175f, 0x45c8, 0x2b55, 0x0000, 0x45ef,
+	    0x3861, 0x1328, 0x3c7b, 0x428d, 0x2e68, 0x3866, 0x36a0, 0x0cd8,
+	    0x3a5a, 0x37ab, 0x0000, 0x4bc3, 0x12f6, 0x0623, 0x0000, 0x02a6,
+	    0x26e1, 0x1017, 0x3077, 0x4d3f, 0x4ddc, 0x258f, 0x4dbc, 0x0000,
+	    0x3e8d, 0x0000, 0x0000, 0x0e59, 0x4df0, 0x086a, 0x0c0e, 0x3c41,
+	    0x0000, 0x40a2, 0x1aa2, 0x33db, 0x3fe7, 0x31df, 0x1f59, 0x2b7d,
+	    0x20d2, 0x0044, 0x0552, 0x2a15, 0x16fc, 0x0000, 0x3329, 0x3a83,
+	    0x04c8, 0x1d96, 0x4965, 0x1605, 0x4226, 0x02a2, 0x1272, 0x0000,
+	    0x00c9, 0x167a, 0x131a, 0x365e, 0x3e8d, 0x4c96, 0x0000, 0x0000,
+	    0x0000, 0x300e, 0x396f, 0x231d, 0x36e5, 0x117a, 0x0000, 0x166a,
+	    0x0000, 0x2ae8, 0x1f4a, 0x3c2b, 0x196f, 0x224a, 0x4847, 0x0430,
+	    0x0000, 0x0000, 0x32c8, 0x3491, 0x3dc2, 0x1ee7, 0x018d, 0x3bd8,
+	    0x4659, 0x0000, 0x1a0f, 0x0913, 0x34d4, 0x0f65, 0x4361, 0x0000,
+	    0x2d1b, 0x088a, 0x0000, 0x3f74, 0x1ce5, 0x2fb5, 0x45dd, 0x0000,
+	    0x38c0, 0x1fb6, 0x04d0, 0x04c0, 0x1d52, 0x0000, 0x47e9, 0x3947,
+	    0x0d66, 0x1e7a, 0x0000, 0x0ede, 0x0474, 0x41c8, 0x0ef4, 0x25ab,
+	    0x4bfe, 0x2198, 0x0234, 0x0000, 0x2b52, 0x4b7d, 0x0000, 0x0000,
+	    0x0000, 0x42e8, 0x0000, 0x4a93, 0x097c, 0x266b, 0x34f1, 0x1463,
+	    0x3f8e, 0x0000, 0x37c1, 0x126b, 0x0139, 0x0743, 0x0000, 0x0ade,
+	    0x4839, 0x2a59, 0x35f1, 0x25d8, 0x0000, 0x473f, 0x2b61, 0x1353,
+	    0x2c2e, 0x0000, 0x46de, 0x0000, 0x0000, 0x0f01, 0x1a67, 0x2634,
+	    0x0000, 0x0000, 0x0000, 0x0593, 0x0d34, 0x0000, 0x3968, 0x082e,
+	    0x0000, 0x1a31, 0x0477, 0x41a0, 0x0000, 0x1c3a, 0x11da, 0x2a73,
+	    0x3e5d, 0x1034, 0x4782, 0x00bb, 0x1965, 0x3d07, 0x4678, 0x210f,
+	    0x2ae0, 0x39bf, 0x4198, 0x0000, 0x0f6b, 0x419a, 0x063e, 0x37c0,
+	    0x0732, 0x0855, 0x175a, 0x3589, 0x2815, 0x3878, 0x31a1, 0x027c,
+	    0x322b, 0x1325, 0x114d, 0x3268, 0x3be8, 0x4651, 0x3f78, 0x38b5,
+	    0x0000, 0x21d9, 0x42ab, 0x47f7, 0x072a, 0x3728, 0x3670, 0x2869,
+	    0x0000, 0x1766, 0x3f51, 0x27b0, 0x19f4, 0x020a, 0x2439, 0x0000,
+	    0x3711, 0x190c, 0x0000, 0x2844, 0x2918, 0x2e99, 0x2ffb, 0x4219,
+	    0x0bcf, 0x2781, 0x0000, 0x344b, 0x40e8, 0x14f2, 0x0000, 0x3669,
+	    0x0a5e, 0x081c, 0x3121, 0x2c44, 0x23db, 0x4d04, 0x2b6b, 0x0ebb,
+	    0x39df, 0x26cd, 0x2172, 0x374d, 0x345f, 0x0beb, 0x16f6, 0x1cfc,
+	    0x3f46, 0x032f, 0x13aa, 0x40d5, 0x2356, 0x0000, 0x2316, 0x32cb,
+	    0x3f85, 0x12df, 0x10f9, 0x092c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x442b, 0x49e7, 0x3e85, 0x0000, 0x17a1, 0x4032, 0x0000, 0x33ca,
+	    0x4def, 0x1b98, 0x1b36, 0x0000, 0x3532, 0x26b1, 0x4d3f, 0x059a,
+	    0x0000, 0x13db, 0x022a, 0x0000, 0x0000, 0x3be9, 0x0000, 0x0f1a,
+	    0x0942, 0x0168, 0x4aa7, 0x3c8c, 0x03a0, 0x0c4f, 0x0000, 0x4ba9,
+	    0x3987, 0x1a24, 0x40ae, 0x4b68, 0x1036, 0x0000, 0x0000, 0x28e9,
+	    0x0000, 0x0000, 0x1dd1, 0x26ed, 0x077b, 0x303f, 0x0000, 0x35e4,
+	    0x0000, 0x3d57, 0x4cfc, 0x1abf, 0x3dd9, 0x07b1, 0x2ad6, 0x0367,
+	    0x19a6, 0x1fb3, 0x1756, 0x3f44, 0x0000, 0x084d, 0x0780, 0x01ba,
+	    0x14f2, 0x20b2, 0x0194, 0x3e94, 0x0000, 0x145b, 0x3fb0, 0x357c,
+	    0x26fc, 0x2bbf, 0x0000, 0x340b, 0x1979, 0x300d, 0x2817, 0x2ba5,
+	    0x0000, 0x27e6, 0x461d, 0x1c0c, 0x2bc8, 0x32b6, 0x302c, 0x4800,
+	    0x0000, 0x0000, 0x0000, 0x181b, 0x23b6, 0x1fd0, 0x17ef, 0x08bb,
+	    0x3ccb, 0x15d3, 0x284c, 0x0000, 0x3e45, 0x466b, 0x0705, 0x325d,
+	    0x11a5, 0x411d, 0x1793, 0x0000, 0x0e92, 0x3983, 0x1075, 0x4df9,
+	    0x40ea, 0x1c9a, 0x0000, 0x336e, 0x0e59, 0x0797, 0x24b0, 0x38f9,
+	    0x20b5, 0x120f, 0x26cd, 0x20d4, 0x4a57, 0x18e5, 0x2f90, 0x1cf4,
+	    0x44fd, 0x0000, 0x2525, 0x2525, 0x0000, 0x37d0, 0x1b69, 0x0000,
+	    0x0000, 0x1a77, 0x0000, 0x0000, 0x29a3, 0x274d, 0x018f, 0x2411,
+	    0x14be, 0x00ee, 0x0f6e, 0x1437, 0x1bb4, 0x0000, 0x1f0d, 0x18ad,
+	    0x3698, 0x2f77, 0x2c2a, 0x13ff, 0x3eb4, 0x073a, 0x1064, 0x32cb,
+	    0x1902, 0x104e, 0x0000, 0x178f, 0x06f7, 0x3363, 0x0000, 0x470a,
+	    0x15df, 0x38ce, 0x0000, 0x0cfc, 0x3f3c, 0x3ace, 0x47e2, 0x3cf8,
+	    0x343c, 0x21b4, 0x455a, 0x15e0, 0x05ba, 0x0a56, 0x2750, 0x3fe2,
+	    0x368f, 0x0603, 0x37de, 0x0000, 0x407d, 0x05dd, 0x1ece, 0x0000,
+	    0x1303, 0x3949, 0x0000, 0x0dc2, 0x2e0d, 0x0632, 0x0000, 0x35b9,
+	    0x32e7, 0x0d97, 0x3601, 0x0000, 0x3c0b, 0x062f, 0x2d74, 0x0000,
+	    0x1e9a, 0x0107, 0x0000, 0x140e, 0x30c8, 0x10ee, 0x350e, 0x1d7e,
+	    0x363a, 0x1d24, 0x0000, 0x21f2, 0x1404, 0x31e5, 0x275c, 0x2778,
+	    0x020d, 0x3ab6, 0x0000, 0x2e66, 0x0379, 0x14a6, 0x4403, 0x0000,
+	    0x4895, 0x1102, 0x440d, 0x2e09, 0x4655, 0x0000, 0x46f1, 0x3ef8,
+	    0x30f6, 0x3a50, 0x421c, 0x0b61, 0x1dec, 0x2ef7, 0x3f23, 0x46d0,
+	    0x1e16, 0x071f, 0x204f, 0x4358, 0x2364, 0x0b1d, 0x2167, 0x00d4,
+	    0x0fa3, 0x467c, 0x0000, 0x0000, 0x0000, 0x256f, 0x3e93, 0x0000,
+	    0x0000, 0x002b, 0x0000, 0x0000, 0x4aff, 0x0000, 0x2c3f, 0x2a22,
+	    0x242c, 0x0000, 0x13a6, 0x1c56, 0x4392, 0x1adf, 0x0613, 0x40e4,
+	    0x43f8, 0x2e6d, 0x2cf9, 0x43c2, 0x1d7f, 0x2eb5, 0x3e02, 0x3535,
+	    0x0000, 0x4a18, 0x14f0, 0x2f76, 0x0277, 0x0000, 0x0000, 0x0000,
+	    0x3321, 0x3ddb, 0x0000, 0x1330, 0x16e3, 0x3070, 0x2dcd, 0x0000,
+	    0x2d16, 0x0cef, 0x20b4, 0x11bf, 0x338b, 0x0c81, 0x0000, 0x133d,
+	    0x0000, 0x1b00, 0x0eb8, 0x01c4, 0x43df, 0x4d39, 0x1e34, 0x3038,
+	    0x1941, 0x2b9e, 0x09c8, 0x193f, 0x3625, 0x3baa, 0x0000, 0x0c37,
+	    0x1bc0, 0x0000, 0x0000, 0x1b1b, 0x0000, 0x0000, 0x0147, 0x1946,
+	    0x243e, 0x310b, 0x0000, 0x12a1, 0x1734, 0x1b1e, 0x3055, 0x0ee9,
+	    0x45f3, 0x0000, 0x27ee, 0x2553, 0x3e17, 0x25f6, 0x2639, 0x2240,
+	    0x0c48, 0x1856, 0x24d0, 0x30f7, 0x2600, 0x487e, 0x2598, 0x3e06,
+	    0x48ea, 0x498d, 0x3a01, 0x0000, 0x0000, 0x1178, 0x383b, 0x17ab,
+	    0x4934, 0x1cc8, 0x3faf, 0x3627, 0x00c9, 0x0022, 0x4361, 0x0e61,
+	    0x0a2b, 0x28a4, 0x4957, 0x4610, 0x1d17, 0x344c, 0x3f6a, 0x0000,
+	    0x0d3f, 0x342a, 0x29e4, 0x0000, 0x1cb8, 0x0000, 0x3784, 0x3f55,
+	    0x3335, 0x4b78, 0x2a24, 0x0000, 0x0716, 0x257e, 0x483d, 0x323a,
+	    0x06e6, 0x0000, 0x029e, 0x0a31, 0x1706, 0x1e6d, 0x257b, 0x0d7d,
+	    0x039c, 0x0000, 0x3ae3, 0x21bb, 0x0000, 0x2de6, 0x2f2f, 0x125d,
+	    0x1842, 0x074e, 0x0000, 0x470b, 0x1052, 0x3f5a, 0x365d, 0x2c1b,
+	    0x2d99, 0x290a, 0x225e, 0x3529, 0x4af7, 0x3363, 0x0a14, 0x4074,
+	    0x0000, 0x01e1, 0x2216, 0x2219, 0x2ddb, 0x13b7, 0x0000, 0x056d,
+	    0x102e, 0x3fc0, 0x0749, 0x0000, 0x4e10, 0x0fa0, 0x439c, 0x173f,
+	    0x2f05, 0x1c0b, 0x1a5a, 0x0000, 0x0000, 0x0000, 0x41e2, 0x0000,
+	    0x0a12, 0x2c6d, 0x31b5, 0x3dd7, 0x231c, 0x4448, 0x2779, 0x0e5e,
+	    0x4c9d, 0x2ae7, 0x4952, 0x1842, 0x0000, 0x3bf0, 0x2385, 0x3c4b,
+	    0x312a, 0x0792, 0x0000, 0x170d, 0x43dd, 0x3749, 0x2d15, 0x3120,
+	    0x0adf, 0x0ac6, 0x479c, 0x17ae, 0x0c31, 0x0d1c, 0x41df, 0x317a,
+	    0x2556, 0x0ad2, 0x0000, 0x3514, 0x131d, 0x0000, 0x164f, 0x46eb,
+	    0x1bd2, 0x1440, 0x2769, 0x47d5, 0x3ed1, 0x19cb, 0x30b1, 0x0000,
+	    0x2421, 0x384e, 0x2fbc, 0x2397, 0x135a, 0x0000, 0x2d04, 0x0349,
+	    0x082d, 0x0000, 0x0000, 0x4b0e, 0x1e70, 0x208e, 0x0000, 0x1839,
+	    0x04eb, 0x3eac, 0x4342, 0x0d50, 0x26a2, 0x0aff, 0x3367, 0x0aa7,
+	    0x4216, 0x43bc, 0x0000, 0x4272, 0x0044, 0x0af6, 0x4a9f, 0x434a,
+	    0x45a7, 0x0000, 0x4755, 0x00b9, 0x3976, 0x11a1, 0x0000, 0x0c6d,
+	    0x3fa2, 0x4a18, 0x0000, 0x35f1, 0x1cde, 0x1783, 0x4934, 0x0000,
+	    0x0a8b, 0x0218, 0x22c0, 0x1010, 0x2409, 0x434f, 0x3443, 0x0a34,
+	    0x0b05, 0x1342, 0x4e13, 0x1d92, 0x150b, 0x4964, 0x0000, 0x19a2,
+	    0x3a64, 0x008e, 0x2b4a, 0x2220, 0x0000, 0x0000, 0x0915, 0x2d55,
+	    0x2e47, 0x0000, 0x0000, 0x0f18, 0x4d02, 0x1fc9, 0x392a, 0x22a7,
+	    0x374e, 0x0000, 0x483b, 0x427e, 0x14f0, 0x4a96, 0x4170, 0x1d6e,
+	    0x43ec, 0x08fc, 0x0347, 0x41d2, 0x0000, 0x3085, 0x2865, 0x0000,
+	    0x408d, 0x28cb, 0x3f1c, 0x0811, 0x19e4, 0x342a, 0x22ed, 0x3e02,
+	    0x036b, 0x04c2, 0x05b1, 0x3fab, 0x0000, 0x4802, 0x058a, 0x1c9e,
+	    0x00b6, 0x0a60, 0x0fc4, 0x1bc3, 0x03b9, 0x4ba2, 0x0000, 0x2943,
+	    0x2b7c, 0x2e5e, 0x0e68, 0x0000, 0x0000, 0x4820, 0x3ff6, 0x07bc,
+	    0x4595, 0x2a47, 0x070d, 0x0000, 0x4e16, 0x0000, 0x3adf, 0x169f,
+	    0x0d92, 0x419f, 0x08c0, 0x20e1, 0x3d2e, 0x365c, 0x0000, 0x4a17,
+	    0x096f, 0x28fa, 0x1a00, 0x3670, 0x16ee, 0x3e39, 0x0000, 0x4812,
+	    0x0b66, 0x110c, 0x2761, 0x365b, 0x3ed6, 0x39d8, 0x0df1, 0x4d01,
+	    0x0d6e, 0x1ac7, 0x4784, 0x2106, 0x3bd2, 0x1ec0, 0x151e, 0x2216,
+	    0x182e, 0x1c47, 0x2522, 0x1169, 0x0000, 0x0000, 0x2082, 0x48ad,
+	    0x0000, 0x46ce, 0x1210, 0x1622, 0x4b9b, 0x34a4, 0x2f87, 0x45cf,
+	    0x0615, 0x0536, 0x2ff9, 0x0000, 0x3189, 0x0ee0, 0x449e, 0x4c7a,
+	    0x440f, 0x0000, 0x0b77, 0x240f, 0x13b9, 0x229f, 0x0e14, 0x0000,
+	    0x1b3c, 0x0000, 0x1790, 0x18eb, 0x0000, 0x118a, 0x01ab, 0x0000,
+	    0x0da8, 0x0d62, 0x0000, 0x0233, 0x4abd, 0x06e2, 0x1479, 0x406d,
+	    0x300a, 0x0000, 0x2c2c, 0x1b07, 0x03f7, 0x0e62, 0x2a44, 0x148c,
+	    0x064c, 0x1914, 0x315e, 0x3de3, 0x49ed, 0x0000, 0x0000, 0x429b,
+	    0x1a32, 0x3ae4, 0x3966, 0x086e, 0x29d4, 0x4997, 0x3efb, 0x0000,
+	    0x42de, 0x2536, 0x1e3f, 0x0000, 0x0e8f, 0x1295, 0x34de, 0x0b68,
+	    0x20ca, 0x4569, 0x1485, 0x0a0a, 0x37a8, 0x3d45, 0x0000, 0x12eb,
+	    0x1c2a, 0x00c8, 0x0ae3, 0x43c6, 0x09d9, 0x1669, 0x0000, 0x0000,
+	    0x1c1c, 0x0d39, 0x0000, 0x2581, 0x0000, 0x498c, 0x3eb6, 0x02b7,
+	    0x34df, 0x05f0, 0x0000, 0x0514, 0x1d25, 0x1d92, 0x1ca0, 0x2c48,
+	    0x3f45, 0x495c, 0x013b, 0x337c, 0x02e7, 0x4a64, 0x0583, 0x4cf4,
+	    0x2eed, 0x0000, 0x02e9, 0x4ad7, 0x1df5, 0x1f57, 0x02f9, 0x4446,
+	    0x3302, 0x012f, 0x3e3a, 0x16a6, 0x4c51, 0x2f77, 0x4851, 0x266b,
+	    0x2fba, 0x01c3, 0x347b, 0x491b, 0x2f9e, 0x334d, 0x077d, 0x2b58,
+	    0x40d5, 0x13d0, 0x1a1d, 0x0000, 0x2d77, 0x0000, 0x0000, 0x0668,
+	    0x204a, 0x0d9a, 0x1499, 0x0000, 0x0805, 0x39ac, 0x1ab2, 0x11c7,
+	    0x0000, 0x42fd, 0x377e, 0x2a5a, 0x333d, 0x43b1, 0x1c01, 0x297f,
+	    0x1324, 0x0000, 0x20d9, 0x1f3c, 0x2dcb, 0x2480, 0x0ce9, 0x41bd,
+	    0x0dec, 0x0000, 0x3f48, 0x063e, 0x27d0, 0x4807, 0x2530, 0x2683,
+	    0x250e, 0x3499, 0x2e1d, 0x3d70, 0x22bf, 0x45d3, 0x2cf1, 0x011c,
+	    0x0550, 0x12c1, 0x0000, 0x3d42, 0x1dbe, 0x0cb3, 0x4bb5, 0x396e,
+	    0x075e, 0x0000, 0x0e63, 0x392b, 0x132b, 0x38de, 0x2b0d, 0x27e2,
+	    0x4abd, 0x32d6, 0x481f, 0x0886, 0x2521, 0x30ec, 0x3fc3, 0x0000,
+	    0x106c, 0x0000, 0x039b, 0x397a, 0x3612, 0x2f85, 0x33fd, 0x0000,
+	    0x39a1, 0x1ca3, 0x0000, 0x2e86, 0x0eaa, 0x3e9f, 0x1a8f, 0x130a,
+	    0x0000, 0x1acc, 0x30f3, 0x483c, 0x069e, 0x2558, 0x1632, 0x29e9,
+	    0x02b1, 0x4635, 0x20de, 0x2293, 0x08e3, 0x4de8, 0x0000, 0x20ac,
+	    0x018d, 0x0000, 0x239e, 0x12f3, 0x0000, 0x2c05, 0x0000, 0x1279,
+	    0x352b, 0x4aaf, 0x3a0c, 0x0000, 0x4033, 0x12d6, 0x01b7, 0x2af5,
+	    0x06b2, 0x4497, 0x2588, 0x000d, 0x4188, 0x05f0, 0x3144, 0x1188,
+	    0x0000, 0x0ae7, 0x0000, 0x0e01, 0x3a09, 0x2c3e, 0x2391, 0x454f,
+	    0x308a, 0x0731, 0x0000, 0x2aea, 0x2686, 0x0000, 0x33e4, 0x3f4b,
+	    0x0000, 0x365c, 0x0000, 0x353d, 0x1284, 0x4275, 0x3297, 0x0000,
+	    0x1686, 0x4c5a, 0x26ca, 0x099a, 0x0000, 0x3711, 0x1b03, 0x2049,
+	    0x0000, 0x0591, 0x0000, 0x4b58, 0x3c13, 0x44a5, 0x15f5, 0x4521,
+	    0x0000, 0x02ae, 0x4423, 0x3b46, 0x0000, 0x0000, 0x396d, 0x08b7,
+	    0x14ef, 0x32a5, 0x2780, 0x0000, 0x4a59, 0x1b78, 0x21f1, 0x1b60,
+	    0x2955, 0x4310, 0x1d6a, 0x0000, 0x32f0, 0x0000, 0x20d4, 0x0000,
+	    0x277e, 0x271d, 0x3cab, 0x0000, 0x3297, 0x248f, 0x306e, 0x0b42,
+	    0x4a20, 0x3950, 0x02eb, 0x1d91, 0x34f4, 0x2e66, 0x1e61, 0x23d9,
+	    0x2c21, 0x1675, 0x049b, 0x213d, 0x1945, 0x268a, 0x0000, 0x392f,
+	    0x0305, 0x0095, 0x384e, 0x1c28, 0x1608, 0x0000, 0x2011, 0x1342,
+	    0x0ff7, 0x1b2d, 0x3441, 0x36a6, 0x3896, 0x1aa3, 0x0000, 0x0000,
+	    0x44e5, 0x0495, 0x37c8, 0x4143, 0x4173, 0x0000, 0x3951, 0x2fcd,
+	    0x0000, 0x4da3, 0x3532, 0x0000, 0x24f3, 0x0fa9, 0x2926, 0x2737,
+	    0x0000, 0x00b7, 0x1a79, 0x26a8, 0x0000, 0x3c03, 0x31c9, 0x0b76,
+	    0x2923, 0x3ca3, 0x3ec2, 0x0000, 0x4653, 0x2743, 0x2745, 0x0f77,
+	    0x182f, 0x16a4, 0x1a20, 0x4d37, 0x00d6, 0x46a6, 0x0000, 0x4df9,
+	    0x0000, 0x0000, 0x0f5b, 0x0ab2, 0x0b9a, 0x4c95, 0x120d, 0x3b38,
+	    0x3208, 0x2c3e, 0x45ec, 0x2099, 0x4c19, 0x4900, 0x28ef, 0x394d,
+	    0x1936, 0x0000, 0x0374, 0x1a3b, 0x19b6, 0x2f76, 0x3b31, 0x247e,
+	    0x0000, 0x14a1, 0x0bbb, 0x1c13, 0x407d, 0x15c6, 0x23cd, 0x08b6,
+	    0x445c, 0x0000, 0x1641, 0x1373, 0x0cf9, 0x0000, 0x2e66, 0x4b97,
+	    0x333d, 0x0000, 0x05b5, 0x4cac, 0x02e9, 0x0000, 0x3f2a, 0x0085,
+	    0x03cf, 0x3d21, 0x3484, 0x3d81, 0x1754, 0x0d60, 0x4d93, 0x2454,
+	    0x10c7, 0x155a, 0x0000, 0x48e8, 0x43f2, 0x1ead, 0x021c, 0x14e4,
+	    0x3e24, 0x3fe8, 0x2f1d, 0x1466, 0x17c3, 0x2479, 0x0ad9, 0x01e4,
+	    0x47a4, 0x4c92, 0x419b, 0x1805, 0x1e9f, 0x29c5, 0x0204, 0x34f6,
+	    0x1e9b, 0x39ab, 0x0000, 0x1df1, 0x44d1, 0x1047, 0x4575, 0x1a13,
+	    0x25ee, 0x2a4a, 0x4b6c, 0x0000, 0x25a3, 0x0000, 0x2767, 0x34be,
+	    0x24f6, 0x1306, 0x1d44, 0x280b, 0x157d, 0x347f, 0x3937, 0x41bf,
+	    0x1c6f, 0x41f5, 0x0000, 0x2638, 0x0af1, 0x0000, 0x0000, 0x24b3,
+	    0x03af, 0x2abf, 0x4b96, 0x1959, 0x243f, 0x0000, 0x308a, 0x1240,
+	    0x3ba8, 0x279d, 0x25c6, 0x2703, 0x2168, 0x2aa8, 0x4a6e, 0x0f24,
+	    0x0000, 0x39ec, 0x2563, 0x39a8, 0x3320, 0x1cbd, 0x32be, 0x23bf,
+	    0x1819, 0x0000, 0x0175, 0x16cd, 0x17e8, 0x38d2, 0x1ca2, 0x0000,
+	    0x0000, 0x3849, 0x0b0d, 0x2f0d, 0x21d3, 0x48dd, 0x0000, 0x0000,
+	    0x3bfa, 0x04ba, 0x0f53, 0x31bf, 0x0000, 0x0000, 0x4b13, 0x420b,
+	    0x3892, 0x1ef2, 0x00c5, 0x20a6, 0x19e8, 0x258b, 0x0b60, 0x0cee,
+	    0x47ca, 0x30a1, 0x3c9e, 0x16cd, 0x14cf, 0x0000, 0x0f59, 0x4b11,
+	    0x100b, 0x14e3, 0x443f, 0x1699, 0x49be, 0x060c, 0x0000, 0x3cb7,
+	    0x486a, 0x475d, 0x1376, 0x0000, 0x4316, 0x1c90, 0x3bbb, 0x20b7,
+	    0x0000, 0x1d85, 0x0000, 0x0000, 0x129a, 0x48ad, 0x0f0f, 0x3ec5,
+	    0x0000, 0x3f90, 0x039f, 0x0000, 0x0000, 0x25d6, 0x0e4c, 0x3fe0,
+	    0x2c18, 0x3cbf, 0x0000, 0x06aa, 0x2866, 0x0000, 0x0803, 0x35d5,
+	    0x4d15, 0x4879, 0x0b1c, 0x3ae6, 0x0000, 0x0000, 0x31fb, 0x1ca8,
+	    0x372f, 0x107a, 0x0000, 0x1e26, 0x23df, 0x449b, 0x1922, 0x3105,
+	    0x180e, 0x0000, 0x2e29, 0x390d, 0x3703, 0x0390, 0x38b4, 0x16d6,
+	    0x1740, 0x0000, 0x28af, 0x159b, 0x0000, 0x34f7, 0x22bb, 0x0b20,
+	    0x479e, 0x2c92, 0x27f7, 0x361f, 0x06fe, 0x2b7a, 0x1d2c, 0x288a,
+	    0x013c, 0x013a, 0x0000, 0x269b, 0x2302, 0x265c, 0x46c4, 0x165f,
+	    0x3820, 0x0000, 0x338b, 0x0f80, 0x1b9f, 0x2d87, 0x4e00, 0x0000,
+	    0x4102, 0x32a5, 0x04d5, 0x3cf3, 0x0000, 0x0000, 0x4b8c, 0x0000,
+	    0x0e0d, 0x0000, 0x245e, 0x0000, 0x0000, 0x0000, 0x169f, 0x08e3,
+	    0x0586, 0x1f1e, 0x00a8, 0x3713, 0x1415, 0x3b04, 0x0000, 0x4d58,
+	    0x3eb9, 0x12c2, 0x2022, 0x1b9f, 0x49e1, 0x0720, 0x175b, 0x0bbe,
+	    0x0000, 0x1ed2, 0x48c6, 0x19d7, 0x1e34, 0x221b, 0x35aa, 0x178a,
+	    0x0daf, 0x2af9, 0x25d7, 0x277b, 0x0f60, 0x2012, 0x0000, 0x1d43,
+	    0x22c1, 0x1abb, 0x2eb5, 0x2d85, 0x4dbf, 0x4237, 0x0000, 0x09e0,
+	    0x1857, 0x3b2e, 0x03e2, 0x12a3, 0x4533, 0x0795, 0x2a2a, 0x0359,
+	    0x19b2, 0x1c4d, 0x2154, 0x0ec9, 0x2e23, 0x190e, 0x426e, 0x18a6,
+	    0x4904, 0x1120, 0x0000, 0x195e, 0x40ce, 0x46e9, 0x0164, 0x0000,
+	    0x0000, 0x3562, 0x2862, 0x45f1, 0x35d3, 0x006d, 0x2754, 0x35eb,
+	    0x3679, 0x2410, 0x0000, 0x2a95, 0x4d98, 0x1a6c, 0x15c8, 0x140c,
+	    0x0000, 0x0000, 0x0dc9, 0x420e, 0x0b3b, 0x2f20, 0x0779, 0x3c6a,
+	    0x1667, 0x3b95, 0x0a65, 0x3677, 0x2db0, 0x2162, 0x0000, 0x46da,
+	    0x0a91, 0x4cb5, 0x188e, 0x2266, 0x4a8e, 0x4dbe, 0x4038, 0x47b6,
+	    0x2ef4, 0x301f, 0x2c66, 0x1492, 0x3272, 0x1cdb, 0x100a, 0x1166,
+	    0x0000, 0x3df8, 0x0000, 0x30f2, 0x0000, 0x4227, 0x42f8, 0x3a4f,
+	    0x3788, 0x498f, 0x4a1a, 0x0000, 0x2217, 0x443b, 0x416a, 0x0327,
+	    0x0000, 0x12bb, 0x0000, 0x1043, 0x0000, 0x070b, 0x4962, 0x2f25,
+	    0x17a1, 0x1127, 0x0955, 0x0000, 0x3158, 0x0f2e, 0x0000, 0x081e,
+	    0x44c6, 0x1632, 0x4b0b, 0x228c, 0x4896, 0x11cd, 0x0000, 0x39b3,
+	    0x47d8, 0x30e8, 0x128c, 0x4d9b, 0x09fb, 0x0836, 0x4556, 0x0000,
+	    0x1391, 0x17f9, 0x0000, 0x4041, 0x40cd, 0x42fa, 0x085c, 0x1ec0,
+	    0x174f, 0x0000, 0x0000, 0x0000, 0x412b, 0x482a, 0x4b28, 0x0000,
+	    0x3099, 0x3b80, 0x0b8b, 0x3a22, 0x1c41, 0x186b, 0x0ace, 0x3b2b,
+	    0x1504, 0x0000, 0x3f65, 0x499f, 0x1012, 0x0bba, 0x1722, 0x0000,
+	    0x00f2, 0x1480, 0x49c1, 0x2003, 0x1528, 0x41d5, 0x0897, 0x1fd3,
+	    0x280a, 0x0914, 0x0000, 0x4d93, 0x0536, 0x4ca1, 0x1642, 0x0000,
+	    0x2c9f, 0x482e, 0x3608, 0x2fef, 0x45e5, 0x250e, 0x3bf9, 0x34aa,
+	    0x4d35, 0x449b, 0x4637, 0x0b48, 0x1dd5, 0x35fc, 0x23d3, 0x0889,
+	    0x20f8, 0x0346, 0x015f, 0x0000, 0x1801, 0x4c26, 0x414d, 0x01a4,
+	    0x1ed8, 0x0000, 0x28e6, 0x00cc, 0x1d4f, 0x220d, 0x46d0, 0x2ba1,
+	    0x186f, 0x333c, 0x3edc, 0x28f0, 0x0000, 0x1dcf, 0x48db, 0x23c7,
+	    0x3af8, 0x326a, 0x2abd, 0x0000, 0x0000, 0x127c, 0x0e1a, 0x2857,
+	    0x1161, 0x1f8e, 0x3f68, 0x0a9d, 0x07fe, 0x219d, 0x0000, 0x0740,
+	    0x3bec, 0x2970, 0x2f92, 0x0382, 0x2c02, 0x457c, 0x17d2, 0x2bc3,
+	    0x204e, 0x0272, 0x372b, 0x0000, 0x2ced, 0x0000, 0x06d6, 0x207d,
+	    0x3a3c, 0x0451, 0x37bb, 0x29c8, 0x179e, 0x450d, 0x4bf7, 0x4716,
+	    0x2de1, 0x1aa1, 0x1ccd, 0x4408, 0x3ea3, 0x33ac, 0x4d3f, 0x0000,
+	    0x1e7d, 0x3af1, 0x3d32, 0x10f1, 0x0000, 0x0331, 0x118e, 0x2846,
+	    0x1e70, 0x180f, 0x0000, 0x0000, 0x28a1, 0x113a, 0x3fad, 0x19ad,
+	    0x0497, 0x19cf, 0x0000, 0x0000, 0x24b8, 0x3493, 0x2a12, 0x0000,
+	    0x1bb3, 0x1cf1, 0x1fe7, 0x3580, 0x42db, 0x3386, 0x0000, 0x12a6,
+	    0x11b4, 0x0000, 0x19c0, 0x0000, 0x45f5, 0x037f, 0x3d14, 0x32fd,
+	    0x0df3, 0x0000, 0x0000, 0x38d4, 0x0408, 0x24e9, 0x2ce2, 0x3039,
+	    0x4c3e, 0x400f, 0x4a21, 0x12f0, 0x2134, 0x033a, 0x0000, 0x28d0,
+	    0x3bc0, 0x03f3, 0x0e0b, 0x224b, 0x426c, 0x166b, 0x14f2, 0x099f,
+	    0x0ed8, 0x16eb, 0x4475, 0x2059, 0x12d3, 0x294e, 0x22e6, 0x0000,
+	    0x0000, 0x0000, 0x3195, 0x0464, 0x0000, 0x4a68, 0x32d3, 0x2391,
+	    0x0b99, 0x185b, 0x4203, 0x3b2a, 0x236c, 0x2f7e, 0x0000, 0x446f,
+	    0x4dae, 0x1993, 0x45f5, 0x0000, 0x4331, 0x1751, 0x2664, 0x307e,
+	    0x1135, 0x2a44, 0x2394, 0x3b5c, 0x1fad, 0x32ce, 0x0e74, 0x0000,
+	    0x1ab9, 0x3fc5, 0x0000, 0x412f, 0x0000, 0x0000, 0x1065, 0x0000,
+	    0x3358, 0x3e5a, 0x3e07, 0x3386, 0x29f4, 0x32f2, 0x31f5, 0x0000,
+	    0x4634, 0x2257, 0x47c2, 0x09d6, 0x3024, 0x19c6, 0x3ea3, 0x4da5,
+	    0x0000, 0x3c24, 0x0000, 0x0084, 0x0000, 0x3fa7, 0x42c5, 0x1921,
+	    0x4be7, 0x0000, 0x10cf, 0x44b2, 0x20e8, 0x0411, 0x1140, 0x0f51,
+	    0x32ae, 0x4046, 0x4cb2, 0x0000, 0x0f21, 0x28b6, 0x38c1, 0x4a3b,
+	    0x16ff, 0x46cd, 0x426d, 0x4cfb, 0x3a08, 0x0000, 0x0c82, 0x0d06,
+	    0x3d9d, 0x4a3e, 0x0000, 0x1ca4, 0x0687, 0x4def, 0x11f1, 0x0000,
+	    0x0d2d, 0x4c69, 0x0000, 0x2177, 0x22e6, 0x25e1, 0x21e5, 0x24fb,
+	    0x0113, 0x26c6, 0x1d41, 0x0000, 0x4ad3, 0x39d3, 0x0fb1, 0x287a,
+	    0x2222, 0x0e55, 0x3d45, 0x0000, 0x3372, 0x0000, 0x3913, 0x237d,
+	    0x45ae, 0x0000, 0x0000, 0x228c, 0x2392, 0x0cae, 0x4971, 0x19ca,
+	    0x35ae, 0x3066, 0x39f3, 0x0000, 0x25e6, 0x0000, 0x0000, 0x0000,
+	    0x4956, 0x2ffc, 0x0000, 0x262c, 0x0000, 0x3a4e, 0x4573, 0x14fd,
+	    0x21c3, 0x2ce6, 0x2a3e, 0x4e1d, 0x0723, 0x1f7b, 0x114d, 0x0000,
+	    0x20be, 0x0000, 0x0000, 0x1228, 0x08bf, 0x11f8, 0x37a0, 0x241c,
+	    0x0000, 0x0003, 0x0922, 0x0a88, 0x3f64, 0x1595, 0x2730, 0x0574,
+	    0x3c29, 0x3a87, 0x0000, 0x3261, 0x4a82, 0x2922, 0x0000, 0x2daf,
+	    0x081a, 0x0000, 0x21a2, 0x0620, 0x40e5, 0x0000, 0x22c5, 0x0000,
+	    0x1707, 0x0000, 0x4785, 0x22d5, 0x161d, 0x3649, 0x2015, 0x499e,
+	    0x0000, 0x47e0, 0x4dfe, 0x0000, 0x25a0, 0x0a40, 0x39a7, 0x0000,
+	    0x294c, 0x3f60, 0x4046, 0x375a, 0x1ce8, 0x11c5, 0x126f, 0x4044,
+	    0x0e22, 0x069a, 0x0000, 0x01c1, 0x2180, 0x4571, 0x0495, 0x2852,
+	    0x0000, 0x38c8, 0x0000, 0x2219, 0x2b51, 0x114a, 0x0b44, 0x419f,
+	    0x1f74, 0x1e68, 0x0000, 0x0b30, 0x2add, 0x1d12, 0x3f73, 0x38c1,
+	    0x3da3, 0x0618, 0x0e96, 0x16d2, 0x3d35, 0x2e1b, 0x0000, 0x0000,
+	    0x4405, 0x38f1, 0x0c0f, 0x128c, 0x21f5, 0x4da4, 0x11a8, 0x3cc3,
+	    0x173c, 0x3357, 0x0b07, 0x1fb3, 0x0a8a, 0x4471, 0x2e0c, 0x0d48,
+	    0x2453, 0x263e, 0x2911, 0x3735, 0x0a2d, 0x0edf, 0x3f97, 0x05b8,
+	    0x3522, 0x3c85, 0x222f, 0x1b0e, 0x2ce2, 0x4b52, 0x0000, 0x0000,
+	    0x19bf, 0x4376, 0x136e, 0x34c7, 0x494b, 0x3c48, 0x3804, 0x26ce,
+	    0x46b4, 0x3330, 0x0d9b, 0x43d5, 0x3b88, 0x14e4, 0x477a, 0x2b96,
+	    0x017b, 0x1d99, 0x1894, 0x03f0, 0x1dd3, 0x0000, 0x0000, 0x04b5,
+	    0x0ec0, 0x4b5c, 0x3f5e, 0x389f, 0x04c3, 0x4927, 0x4b19, 0x3deb,
+	    0x0514, 0x285c, 0x40a5, 0x4488, 0x17c9, 0x0000, 0x212a, 0x4ad2,
+	    0x0000, 0x0ba7, 0x1359, 0x03ef, 0x380f, 0x14da, 0x1e84, 0x3aad,
+	    0x0000, 0x43e4, 0x289e, 0x237a, 0x0000, 0x2752, 0x128a, 0x1a8a,
+	    0x0000, 0x317d, 0x19e6, 0x0eed, 0x1d2a, 0x010d, 0x0ada, 0x1763,
+	    0x19ee, 0x3ab7, 0x3818, 0x0000, 0x1334, 0x1f2f, 0x33ce, 0x03e9,
+	    0x0ddc, 0x231d, 0x4ab6, 0x0000, 0x3561, 0x4823, 0x05b7, 0x2ac9,
+	    0x0000, 0x06bb, 0x0000, 0x42d0, 0x05e1, 0x0000, 0x2842, 0x2024,
+	    0x401c, 0x3db8, 0x167c, 0x046e, 0x0000, 0x0000, 0x17ab, 0x0193,
+	    0x41f2, 0x16bc, 0x4104, 0x2d5e, 0x25ad, 0x44d1, 0x41d5, 0x409d,
+	    0x39e9, 0x1646, 0x32d0, 0x2947, 0x0488, 0x154b, 0x11bf, 0x1e94,
+	    0x0000, 0x3267, 0x4d4f, 0x0000, 0x051c, 0x4d87, 0x355f, 0x0000,
+	    0x003b, 0x1a3d, 0x3194, 0x3bd2, 0x0b57, 0x044c, 0x2856, 0x3ccb,
+	    0x03c0, 0x4b62, 0x2efb, 0x2d8a, 0x4583, 0x3325, 0x0000, 0x1009,
+	    0x243a, 0x0000, 0x32c6, 0x4205, 0x40ea, 0x07d4, 0x2b7e, 0x19d2,
+	    0x26cd, 0x483a, 0x2083, 0x2d19, 0x2372, 0x2c1a, 0x4abc, 0x314b,
+	    0x10d9, 0x09a9, 0x19bc, 0x2472, 0x1c85, 0x4270, 0x3a57, 0x27b2,
+	    0x3bf3, 0x13c8, 0x0b22, 0x3e0a, 0x0000, 0x117a, 0x016f, 0x321d,
+	    0x2385, 0x2aa9, 0x4529, 0x0f4c, 0x4299, 0x349e, 0x2b23, 0x2801,
+	    0x0e8d, 0x215c, 0x36c5, 0x0000, 0x0372, 0x0fe8, 0x4afc, 0x19d3,
+	    0x17e4, 0x2eb7, 0x3704, 0x2666, 0x1e17, 0x2e01, 0x27f5, 0x1499,
+	    0x0000, 0x4447, 0x3c26, 0x00e5, 0x2a9f, 0x0000, 0x36a4, 0x02b1,
+	    0x0000, 0x0ced, 0x4593, 0x2ec9, 0x2539, 0x0206, 0x0000, 0x0000,
+	    0x47a4, 0x1d13, 0x0d3c, 0x326f, 0x04b6, 0x0000, 0x3650, 0x4517,
+	    0x215f, 0x0000, 0x4638, 0x008c, 0x1d34, 0x0000, 0x2bdb, 0x3c15,
+	    0x329a, 0x26dd, 0x33c4, 0x2974, 0x3b46, 0x48d9, 0x2d00, 0x0456,
+	    0x147c, 0x001c, 0x4dbc, 0x2178, 0x0000, 0x0000, 0x4d82, 0x08d0,
+	    0x0ed8, 0x1689, 0x33d2, 0x0000, 0x016c, 0x0000, 0x33b2, 0x0000,
+	    0x2ba4, 0x25c0, 0x38fa, 0x1c05, 0x0000, 0x3bf0, 0x0000, 0x4bae,
+	    0x04ee, 0x1be3, 0x0621, 0x0c2d, 0x0000, 0x2c8b, 0x0000, 0x37e8,
+	    0x3c77, 0x466f, 0x0fc6, 0x0c44, 0x0000, 0x0350, 0x2139, 0x1ec0,
+	    0x4d44, 0x4264, 0x391c, 0x0000, 0x253e, 0x021e, 0x32eb, 0x4746,
+	    0x38c0, 0x0000, 0x2ed3, 0x1dd6, 0x1c1d, 0x1370, 0x2f71, 0x142e,
+	    0x2ace, 0x1b3c, 0x247c, 0x281d, 0x4a3b, 0x3acb, 0x3588, 0x402a,
+	    0x28fa, 0x214f, 0x32f8, 0x49ee, 0x372a, 0x0000, 0x4580, 0x3c9a,
+	    0x174e, 0x39d6, 0x070b, 0x08ba, 0x332b, 0x30a4, 0x0bba, 0x1b68,
+	    0x167e, 0x3908, 0x46ba, 0x0cd1, 0x2f6b, 0x49f5, 0x2154, 0x40c0,
+	    0x3ecd, 0x2a95, 0x1ab7, 0x2936, 0x3d77, 0x0a56, 0x3728, 0x0ac0,
+	    0x48ab, 0x3688, 0x2935, 0x0000, 0x1cdc, 0x30c1, 0x3bed, 0x28ae,
+	    0x0818, 0x1e2b, 0x376e, 0x4b83, 0x2e1c, 0x3b07, 0x1aec, 0x0000,
+	    0x3588, 0x3d10, 0x3f16, 0x4cff, 0x1a9a, 0x4498, 0x0000, 0x270a,
+	    0x3537, 0x0dd6, 0x0000, 0x0f2f, 0x0b6f, 0x499f, 0x05fe, 0x13be,
+	    0x4ae6, 0x303d, 0x23b0, 0x192d, 0x391f, 0x40a2, 0x1cd9, 0x2f65,
+	    0x3a1d, 0x2bc9, 0x1aa2, 0x0000, 0x0038, 0x1a0c, 0x29c5, 0x3a64,
+	    0x0d48, 0x1745, 0x003c, 0x2238, 0x151f, 0x3c07, 0x18cb, 0x0b30,
+	    0x1ec8, 0x0000, 0x1110, 0x1264, 0x3ed4, 0x4504, 0x09b6, 0x3835,
+	    0x3e67, 0x0000, 0x181f, 0x0000, 0x1570, 0x0000, 0x0000, 0x1736,
+	    0x3919, 0x3259, 0x49be, 0x0d8f, 0x1439, 0x2f52, 0x1762, 0x3672,
+	    0x4525, 0x286e, 0x3ba1, 0x0000, 0x3f47, 0x2650, 0x1494, 0x0499,
+	    0x052f, 0x2d46, 0x4b89, 0x42e6, 0x1b45, 0x4587, 0x1019, 0x48ce,
+	    0x0000, 0x436b, 0x37ac, 0x3ed6, 0x4ac2, 0x3bf3, 0x31a6, 0x0000,
+	    0x16ab, 0x0000, 0x0000, 0x1e79, 0x1d5e, 0x08b3, 0x063e, 0x3bac,
+	    0x0000, 0x0000, 0x07d9, 0x0d27, 0x3dfe, 0x3025, 0x4cd9, 0x1c12,
+	    0x4304, 0x0000, 0x4dc9, 0x10af, 0x4d35, 0x0000, 0x18d8, 0x16db,
+	    0x0490, 0x14f3, 0x0bf8, 0x0000, 0x0000, 0x0555, 0x295a, 0x23e2,
+	    0x42f1, 0x2695, 0x3df8, 0x4328, 0x3b2c, 0x2091, 0x167d, 0x0000,
+	    0x3218, 0x1c60, 0x103c, 0x2894, 0x493f, 0x116a, 0x03c9, 0x0ec0,
+	    0x03c5, 0x40b1, 0x3db2, 0x2184, 0x0000, 0x0000, 0x1d63, 0x3162,
+	    0x0000, 0x4447, 0x310b, 0x0d81, 0x030e, 0x1d8a, 0x3056, 0x1d05,
+	    0x0685, 0x2d74, 0x09e1, 0x449d, 0x0329, 0x2d05, 0x25fa, 0x28dc,
+	    0x0000, 0x42f4, 0x0000, 0x31ae, 0x2af6, 0x4516, 0x12f6, 0x3d25,
+	    0x12b5, 0x134f, 0x1031, 0x15ca, 0x2c8c, 0x08c0, 0x0000, 0x0b77,
+	    0x0970, 0x1c82, 0x494f, 0x0774, 0x0000, 0x0fbd, 0x0b48, 0x3824,
+	    0x1f5c, 0x2045, 0x002b, 0x1cc4, 0x2edf, 0x1ebf, 0x3a82, 0x2fd4,
+	    0x15c9, 0x318e, 0x4573, 0x2dc0, 0x26c0, 0x0000, 0x0000, 0x0000,
+	    0x3df0, 0x19dc, 0x0000, 0x4bb5, 0x0329, 0x49c5, 0x1f9c, 0x2a84,
+	    0x269a, 0x0000, 0x10fd, 0x0000, 0x234c, 0x0000, 0x3c33, 0x1a31,
+	    0x3d8e, 0x0875, 0x20a6, 0x4031, 0x15ee, 0x17e0, 0x2805, 0x4162,
+	    0x1248, 0x1b90, 0x0000, 0x18a5, 0x2c6f, 0x0f9d, 0x2587, 0x0000,
+	    0x2b7e, 0x4910, 0x2c8d, 0x4d3f, 0x417e, 0x27b9, 0x4d58, 0x3ddd,
+	    0x0000, 0x2702, 0x3a23, 0x0000, 0x3e35, 0x3896, 0x3166, 0x0000,
+	    0x0000, 0x1c23, 0x0766, 0x054d, 0x031b, 0x0000, 0x0000, 0x07c7,
+	    0x29d7, 0x0369, 0x1cdc, 0x0000, 0x0000, 0x0350, 0x2c4d, 0x0000,
+	    0x0000, 0x3438, 0x0000, 0x0aba, 0x231d, 0x0d79, 0x4d97, 0x3be4,
+	    0x05d2, 0x13df, 0x49dd, 0x1656, 0x1cef, 0x0000, 0x0000, 0x0000,
+	    0x279f, 0x1ab6, 0x071c, 0x454b, 0x22f0, 0x2347, 0x2c21, 0x0eed,
+	    0x0000, 0x3665, 0x0945, 0x3911, 0x2dff, 0x47f5, 0x3b74, 0x198f,
+	    0x2114, 0x0000, 0x4379, 0x4243, 0x2eb2, 0x438c, 0x1541, 0x4b55,
+	    0x26b1, 0x2361, 0x0000, 0x170d, 0x2bf3, 0x4d8a, 0x26fc, 0x0eee,
+	    0x096c, 0x3719, 0x1a24, 0x1965, 0x0d7a, 0x1a09, 0x09b8, 0x21a9,
+	    0x2ee4, 0x3266, 0x0317, 0x0000, 0x4b59, 0x0000, 0x21cc, 0x0000,
+	    0x0e85, 0x0371, 0x3119, 0x1387, 0x201e, 0x2ccd, 0x3e26, 0x0279,
+	    0x34d3, 0x39f5, 0x44c0, 0x0000, 0x1161, 0x049a, 0x0abe, 0x400a,
+	    0x295c, 0x0000, 0x0000, 0x29fe, 0x31df, 0x40c8, 0x1e2e, 0x2add,
+	    0x01dc, 0x0000, 0x13de, 0x0000, 0x0fe6, 0x0000, 0x17e3, 0x04b6,
+	    0x1e65, 0x1243, 0x4b15, 0x0e4d, 0x416a, 0x34ef, 0x4c8e, 0x06a5,
+	    0x2d6e, 0x4d16, 0x31a8, 0x265d, 0x43d8, 0x2657, 0x1e64, 0x02ac,
+	    0x0bad, 0x0000, 0x2638, 0x0000, 0x0e77, 0x26a9, 0x1a59, 0x33e3,
+	    0x08ab, 0x22ca, 0x3dcf, 0x0000, 0x1825, 0x3501, 0x0000, 0x0000,
+	    0x1ed2, 0x2740, 0x0000, 0x092a, 0x2a4f, 0x496e, 0x2e4c, 0x3065,
+	    0x3dbe, 0x0000, 0x230c, 0x4d79, 0x225a, 0x0000, 0x113e, 0x0ef5,
+	    0x2994, 0x0cfc, 0x0000, 0x0000, 0x1746, 0x18a0, 0x053f, 0x308f,
+	    0x191b, 0x166f, 0x0000, 0x357f, 0x3436, 0x3321, 0x1702, 0x1171,
+	    0x0000, 0x3344, 0x1bb1, 0x0000, 0x44c3, 0x3d8c, 0x0de4, 0x0227,
+	    0x3404, 0x1bb4, 0x283e, 0x40a2, 0x252d, 0x46d5, 0x1fc3, 0x4972,
+	    0x39a8, 0x219d, 0x1f62, 0x427b, 0x2770, 0x2c7a, 0x0000, 0x0000,
+	    0x01e8, 0x0000, 0x1ed5, 0x3dcd, 0x4aea, 0x422f, 0x4a2d, 0x31e7,
+	    0x0000, 0x0ef3, 0x267f, 0x357f, 0x17fc, 0x4176, 0x1def, 0x280b,
+	    0x44c4, 0x3395, 0x218d, 0x0000, 0x32e8, 0x47fd, 0x103e, 0x0000,
+	    0x00a0, 0x03ca, 0x105c, 0x1ca0, 0x27b8, 0x42bd, 0x0ba9, 0x0000,
+	    0x4676, 0x0000, 0x0000, 0x0000, 0x35f2, 0x0000, 0x3ea9, 0x08dc,
+	    0x0000, 0x2de7, 0x44ed, 0x2412, 0x1cdf, 0x127f, 0x3f86, 0x0aa7,
+	    0x0322, 0x044f, 0x0000, 0x0745, 0x1a23, 0x01ce, 0x1d21, 0x19e0,
+	    0x399f, 0x3582, 0x15a3, 0x146a, 0x2fd9, 0x22f4, 0x0627, 0x2ba1,
+	    0x37a4, 0x180c, 0x2e07, 0x47b2, 0x1c7d, 0x2924, 0x1ae8, 0x4067,
+	    0x25d5, 0x1afe, 0x1a6a, 0x14ae, 0x0000, 0x2e14, 0x0000, 0x1932,
+	    0x2eae, 0x3559, 0x0cd4, 0x32da, 0x48be, 0x0eaf, 0x1b23, 0x09c1,
+	    0x0390, 0x23a2, 0x0000, 0x290d, 0x0000, 0x17d3, 0x3686, 0x0242,
+	    0x1e58, 0x0000, 0x01b8, 0x09d5, 0x11d0, 0x0f97, 0x4282, 0x0c73,
+	    0x4205, 0x02b3, 0x33f4, 0x0bbc, 0x286e, 0x0000, 0x3638, 0x2776,
+	    0x1649, 0x273b, 0x4d7d, 0x1e2b, 0x26f7, 0x4aed, 0x3e94, 0x4c39,
+	    0x0000, 0x429c, 0x0000, 0x0000, 0x42b0, 0x4af1, 0x0d6b, 0x4e14,
+	    0x0000, 0x079a, 0x4c2f, 0x1af5, 0x0bf8, 0x1d54, 0x3988, 0x2b02,
+	    0x3de1, 0x4398, 0x4b9d, 0x3a1a, 0x1fae, 0x28e2, 0x43e3, 0x0000,
+	    0x2603, 0x1960, 0x0709, 0x0000, 0x24f4, 0x0ce2, 0x3f6a, 0x4afc,
+	    0x370a, 0x1042, 0x3730, 0x46dd, 0x0293, 0x3184, 0x2312, 0x448d,
+	    0x15fa, 0x1415, 0x0000, 0x1b5a, 0x22fc, 0x0373, 0x0000, 0x0000,
+	    0x41cb, 0x1520, 0x0000, 0x0000, 0x142d, 0x0975, 0x4c4c, 0x03a3,
+	    0x2ac1, 0x0000, 0x189f, 0x2e2e, 0x019f, 0x3319, 0x13d3, 0x161c,
+	    0x23f9, 0x3dda, 0x1f07, 0x32ed, 0x0000, 0x0000, 0x3527, 0x37c4,
+	    0x20e1, 0x0000, 0x2076, 0x4cbb, 0x0797, 0x040e, 0x0691, 0x1c53,
+	    0x0000, 0x1713, 0x1e90, 0x015b, 0x32e5, 0x449c, 0x01a1, 0x0000,
+	    0x0cf2, 0x1ebc, 0x0000, 0x0000, 0x1e04, 0x09a8, 0x390b, 0x09a4,
+	    0x421b, 0x4068, 0x3d0f, 0x0b20, 0x03a2, 0x1b13, 0x4053, 0x220f,
+	    0x258c, 0x00da, 0x1f06, 0x2524, 0x1d7a, 0x1bec, 0x0000, 0x1bef,
+	    0x0269, 0x03cb, 0x0000, 0x0000, 0x04d3, 0x4b6c, 0x2b32, 0x0000,
+	    0x0395, 0x229a, 0x4b09, 0x0000, 0x385d, 0x0000, 0x15aa, 0x2b75,
+	    0x48da, 0x280e, 0x1327, 0x361b, 0x059d, 0x481b, 0x1ae6, 0x3c35,
+	    0x1bea, 0x0000, 0x0000, 0x1f78, 0x0000, 0x285b, 0x0000, 0x3028,
+	    0x33cb, 0x0000, 0x1c52, 0x084d, 0x0000, 0x2ca9, 0x1269, 0x2cf2,
+	    0x455c, 0x27fa, 0x0000, 0x0768, 0x08dd, 0x234c, 0x274d, 0x06f6,
+	    0x494f, 0x2c2d, 0x36ea, 0x2aa9, 0x0b40, 0x33d6, 0x038a, 0x3470,
+	    0x3a20, 0x4a07, 0x0000, 0x23a8, 0x29b6, 0x1df1, 0x2aac, 0x1e1e,
+	    0x0000, 0x0f85, 0x422e, 0x42b1, 0x3200, 0x2ff1, 0x0b33, 0x0ace,
+	    0x43ad, 0x107d, 0x4539, 0x0a39, 0x27bc, 0x3854, 0x3b6c, 0x0000,
+	    0x0000, 0x3a6c, 0x05a4, 0x1ab8, 0x10d2, 0x3fc0, 0x3dee, 0x4451,
+	    0x0eaf, 0x0c61, 0x1a5b, 0x1308, 0x3cd7, 0x19fe, 0x4227, 0x31ff,
+	    0x0a44, 0x08f4, 0x3f76, 0x200c, 0x279f, 0x194a, 0x1611, 0x140f,
+	    0x0000, 0x1a44, 0x0000, 0x0000, 0x3549, 0x4b0c, 0x4679, 0x1640,
+	    0x2f1f, 0x3a94, 0x4579, 0x316c, 0x2c96, 0x36ff, 0x3ee7, 0x13c0,
+	    0x0000, 0x3e6d, 0x2527, 0x0158, 0x0000, 0x3410, 0x3469, 0x01c1,
+	    0x15f2, 0x37ac, 0x0000, 0x2f20, 0x01f8, 0x0000, 0x2666, 0x0567,
+	    0x0000, 0x474a, 0x035d, 0x00b0, 0x1187, 0x0000, 0x1956, 0x4c34,
+	    0x27b7, 0x4ac8, 0x13d4, 0x2a30, 0x1af9, 0x2008, 0x44ab, 0x43d0,
+	    0x4d8d, 0x4b76, 0x08ec, 0x2957, 0x3fe3, 0x3ced, 0x01b5, 0x0000,
+	    0x41b6, 0x2897, 0x4590, 0x0000, 0x42db, 0x490f, 0x3d8e, 0x0182,
+	    0x380a, 0x35bc, 0x41a5, 0x0000, 0x0000, 0x071c, 0x19f7, 0x1fae,
+	    0x221f, 0x0000, 0x36a6, 0x0000, 0x416c, 0x3687, 0x4c5e, 0x3136,
+	    0x4841, 0x0000, 0x1a6e, 0x25d8, 0x133d, 0x0aed, 0x242c, 0x0808,
+	    0x1bf1, 0x4df0, 0x3f8c, 0x2ab0, 0x2663, 0x37e3, 0x1093, 0x2e38,
+	    0x1495, 0x02c0, 0x1f8d, 0x1d5f, 0x1b6b, 0x4737, 0x09ce, 0x0000,
+	    0x0722, 0x0194, 0x0fd6, 0x2c8c, 0x0000, 0x4553, 0x235d, 0x2dbb,
+	    0x0045, 0x0fa9, 0x2333, 0x2a2a, 0x00df, 0x3195, 0x319d, 0x02f9,
+	    0x33f6, 0x0000, 0x13e8, 0x330c, 0x4303, 0x0c79, 0x0000, 0x0000,
+	    0x059d, 0x269e, 0x2b16, 0x1c2a, 0x27bc, 0x352f, 0x022c, 0x35f4,
+	    0x1369, 0x0000, 0x448a, 0x0000, 0x4d2c, 0x47b1, 0x2dee, 0x3be9,
+	    0x3b22, 0x086f, 0x12a4, 0x04ef, 0x333a, 0x0000, 0x0eeb, 0x4dde,
+	    0x3d22, 0x25a4, 0x2d62, 0x0ffd, 0x15cd, 0x4260, 0x4546, 0x2f34,
+	    0x0000, 0x0000, 0x48c1, 0x4b38, 0x2afe, 0x0000, 0x40fe, 0x02c3,
+	    0x12f6, 0x2ef0, 0x3bd6, 0x215c, 0x0000, 0x3954, 0x2cbb, 0x3b27,
+	    0x1164, 0x0000, 0x3e4a, 0x2a28, 0x29f3, 0x4b93, 0x15e4, 0x404d,
+	    0x04dc, 0x13b7, 0x0b1f, 0x0abc, 0x3f16, 0x4262, 0x0d27, 0x0490,
+	    0x1550, 0x20ac, 0x2eea, 0x3e18, 0x0147, 0x203f, 0x35f7, 0x3bc8,
+	    0x00e0, 0x0000, 0x2a73, 0x0f39, 0x09cf, 0x1f3d, 0x0b35, 0x11c6,
+	    0x16b3, 0x1108, 0x0c33, 0x34de, 0x20d7, 0x4366, 0x3090, 0x44e2,
+	    0x2f44, 0x0576, 0x4758, 0x0365, 0x0317, 0x06c7, 0x4127, 0x2f96,
+	    0x37f6, 0x278f, 0x150a, 0x221a, 0x0dd2, 0x20e3, 0x45c9, 0x3dfe,
+	    0x40bd, 0x0c7e, 0x26fe, 0x171f, 0x1f16, 0x11e7, 0x306a, 0x2344,
+	    0x1c45, 0x0718, 0x2a5a, 0x1f17, 0x0ffb, 0x1299, 0x0000, 0x3bb4,
+	    0x057d, 0x23ca, 0x35b8, 0x23b3, 0x0000, 0x383f, 0x434d, 0x0000,
+	    0x3b54, 0x3be8, 0x0000, 0x30d3, 0x081c, 0x2eac, 0x22a5, 0x0000,
+	    0x19cf, 0x32c1, 0x382e, 0x00cb, 0x0000, 0x1371, 0x3f43, 0x3377,
+	    0x0cc4, 0x0339, 0x0000, 0x2f54, 0x2170, 0x024d, 0x18f5, 0x337e,
+	    0x1e97, 0x4d79, 0x39d3, 0x4502, 0x4e0b, 0x0ba7, 0x4756, 0x1feb,
+	    0x0000, 0x0000, 0x3a22, 0x2da4, 0x0000, 0x48c3, 0x48e2, 0x053b,
+	    0x1d36, 0x494f, 0x299c, 0x4c1e, 0x1f5a, 0x3d34, 0x3104, 0x39df,
+	    0x3f16, 0x3b74, 0x0000, 0x0262, 0x26d4, 0x2df6, 0x059a, 0x2383,
+	    0x4dbc, 0x0232, 0x0000, 0x0000, 0x0000, 0x0000, 0x03b0, 0x053d,
+	    0x002f, 0x1b9a, 0x2cdf, 0x0000, 0x4243, 0x1e23, 0x1ca9, 0x38a2,
+	    0x22a5, 0x2477, 0x0f55, 0x0f32, 0x2a7f, 0x1c6b, 0x2a32, 0x2194,
+	    0x4c71, 0x3e35, 0x0000, 0x0000, 0x02b7, 0x1275, 0x3487, 0x37dc,
+	    0x1770, 0x23c7, 0x37f0, 0x0000, 0x3c8a, 0x4002, 0x1067, 0x499e,
+	    0x29e3, 0x3c40, 0x0318, 0x0001, 0x434e, 0x0ab5, 0x0000, 0x3a89,
+	    0x0000, 0x1155, 0x1ac3, 0x3b63, 0x0000, 0x0000, 0x1978, 0x3ad8,
+	    0x2983, 0x0000, 0x025a, 0x4749, 0x2693, 0x447c, 0x1249, 0x0792,
+	    0x1551, 0x0a8f, 0x4bd2, 0x03b9, 0x0d48, 0x24f9, 0x0000, 0x2a6b,
+	    0x0f3f, 0x29e4, 0x1cf0, 0x2527, 0x3b1a, 0x3ea5, 0x34c7, 0x2bc1,
+	    0x386a, 0x3550, 0x4c18, 0x1556, 0x24a7, 0x0000, 0x0fcc, 0x0000,
+	    0x2c4b, 0x0000, 0x1335, 0x0981, 0x2740, 0x1936, 0x4b9c, 0x454b,
+	    0x4e12, 0x1e05, 0x0244, 0x14a8, 0x42ac, 0x21db, 0x4a38, 0x1f6e,
+	    0x4cfc, 0x2463, 0x1233, 0x0000, 0x1fa4, 0x135d, 0x0608, 0x2dc0,
+	    0x131e, 0x15ca, 0x2431, 0x2b7b, 0x0000, 0x0000, 0x44bb, 0x3fcb,
+	    0x09ce, 0x0000, 0x2e32, 0x0000, 0x3a79, 0x209c, 0x3ba0, 0x0000,
+	    0x2487, 0x0ce0, 0x2d9c, 0x0000, 0x0000, 0x0000, 0x3a8a, 0x0858,
+	    0x0000, 0x26d3, 0x0f14, 0x0f7a, 0x46ea, 0x4a36, 0x1cad, 0x3077,
+	    0x0000, 0x3433, 0x2391, 0x4c7a, 0x3ff6, 0x4b99, 0x0ccd, 0x16cf,
+	    0x1f8f, 0x4810, 0x270a, 0x0000, 0x0000, 0x0000, 0x47eb, 0x2117,
+	    0x1675, 0x0000, 0x116a, 0x3c6e, 0x0712, 0x255a, 0x0c88, 0x2031,
+	    0x2189, 0x0000, 0x4636, 0x0ba5, 0x0170, 0x1e83, 0x21fa, 0x2264,
+	    0x0000, 0x1763, 0x4125, 0x478b, 0x3237, 0x0850, 0x1ba3, 0x3fda,
+	    0x0053, 0x4dee, 0x1100, 0x0000, 0x499f, 0x3bcd, 0x0595, 0x12c5,
+	    0x0c59, 0x0510, 0x20b1, 0x0000, 0x0e9c, 0x335f, 0x442d, 0x0e33,
+	    0x43e7, 0x0000, 0x1db2, 0x4baa, 0x0b06, 0x0000, 0x1599, 0x0c96,
+	    0x0cdd, 0x071f, 0x25e8, 0x4995, 0x0000, 0x0000, 0x19b5, 0x495a,
+	    0x0000, 0x1353, 0x1fa7, 0x08ae, 0x131c, 0x361c, 0x2df2, 0x42ab,
+	    0x02d3, 0x3a95, 0x44c8, 0x404f, 0x0000, 0x2788, 0x3f8a, 0x2d09,
+	    0x0000, 0x3b9b, 0x3aeb, 0x0861, 0x3cff, 0x22c4, 0x2093, 0x4929,
+	    0x1092, 0x0000, 0x13e1, 0x0000, 0x0b98, 0x0000, 0x15fa, 0x0605,
+	    0x2f7b, 0x279a, 0x0000, 0x4aa6, 0x2dbc, 0x03df, 0x13f6, 0x2de8,
+	    0x0ce9, 0x0000, 0x0fe1, 0x30b2, 0x0bda, 0x34fa, 0x1131, 0x2a0b,
+	    0x38ae, 0x1785, 0x44d1, 0x01be, 0x0d13, 0x440f, 0x367a, 0x0000,
+	    0x4978, 0x04ce, 0x3958, 0x1be8, 0x0ebf, 0x4c9e, 0x494e, 0x43d4,
+	    0x0000, 0x47a9, 0x2ae0, 0x3d74, 0x2172, 0x1829, 0x38f9, 0x1fa6,
+	    0x302c, 0x4d36, 0x1100, 0x0000, 0x2050, 0x1f4c, 0x0f24, 0x2568,
+	    0x3c22, 0x3df4, 0x066c, 0x0b6e, 0x0e97, 0x3a7c, 0x3751, 0x0000,
+	    0x0e78, 0x34cd, 0x2627, 0x3e22, 0x0ec2, 0x4d36, 0x430f, 0x0ac8,
+	    0x3e76, 0x0f40, 0x35b5, 0x3e7d, 0x0a9d, 0x093e, 0x2692, 0x0ffb,
+	    0x0000, 0x1bef, 0x1446, 0x4a41, 0x1f11, 0x2686, 0x04b5, 0x0000,
+	    0x0fde, 0x2e91, 0x0000, 0x0209, 0x0dac, 0x2f59, 0x35d8, 0x44b0,
+	    0x1fd0, 0x41b8, 0x43a0, 0x0000, 0x4775, 0x0000, 0x3057, 0x2987,
+	    0x1c54, 0x0296, 0x2dc9, 0x0000, 0x0000, 0x3391, 0x3df7, 0x3d7d,
+	    0x08a5, 0x438f, 0x375c, 0x0000, 0x2d31, 0x0a1b, 0x46d6, 0x123f,
+	    0x2a60, 0x2cb0, 0x276a, 0x14fd, 0x255d, 0x1fa0, 0x0650, 0x0274,
+	    0x4279, 0x3c1d, 0x34ad, 0x1b5e, 0x09ec, 0x345c, 0x45a7, 0x1c6a,
+	    0x1112, 0x47a7, 0x0d53, 0x487c, 0x083c, 0x17c1, 0x0126, 0x2768,
+	    0x2842, 0x3790, 0x46c0, 0x3478, 0x2aa9, 0x391c, 0x0000, 0x115a,
+	    0x0e7b, 0x1c23, 0x19bf, 0x4df3, 0x1b90, 0x0000, 0x019e, 0x10ca,
+	    0x1088, 0x0cd0, 0x201b, 0x2f5d, 0x2ab5, 0x21ca, 0x0000, 0x0497,
+	    0x1dc6, 0x3a86, 0x12e2, 0x4b61, 0x2837, 0x1ee6, 0x3745, 0x465c,
+	    0x146a, 0x0000, 0x1477, 0x20b7, 0x2f50, 0x3694, 0x2d67, 0x2ea8,
+	    0x3619, 0x3a09, 0x490d, 0x2c21, 0x12af, 0x0000, 0x0000, 0x20c0,
+	    0x4046, 0x1816, 0x0000, 0x0000, 0x1622, 0x4a18, 0x37b4, 0x4b0f,
+	    0x2eca, 0x2f45, 0x0000, 0x4b4d, 0x060a, 0x22e9, 0x15ff, 0x0000,
+	    0x33ee, 0x134c, 0x438c, 0x40d5, 0x0000, 0x2f10, 0x4ab1, 0x0187,
+	    0x0e2b, 0x020f, 0x2d67, 0x2e31, 0x3669, 0x1c5d, 0x1f81, 0x2f96,
+	    0x0057, 0x0527, 0x3fef, 0x2e0b, 0x1d2c, 0x4b44, 0x0000, 0x179c,
+	    0x0000, 0x032f, 0x2ea1, 0x31b2, 0x0000, 0x0458, 0x1d57, 0x0fb1,
+	    0x41b9, 0x2b09, 0x3b8f, 0x152d, 0x0607, 0x0f58, 0x142d, 0x4250,
+	    0x0df2, 0x0e2d, 0x0be3, 0x0883, 0x04c3, 0x17d7, 0x2f6c, 0x4941,
+	    0x2d83, 0x0811, 0x0000, 0x0a64, 0x0b80, 0x0339, 0x19f5, 0x3d60,
+	    0x39cb, 0x0000, 0x2eca, 0x2407, 0x0c63, 0x3a6e, 0x460d, 0x440a,
+	    0x4464, 0x2fe3, 0x31bf, 0x3315, 0x0000, 0x0000, 0x45db, 0x1691,
+	    0x1f2e, 0x0335, 0x17cb, 0x3f4a, 0x0000, 0x0000, 0x157a, 0x463e,
+	    0x3321, 0x1670, 0x481a, 0x3780, 0x0000, 0x0000, 0x09c6, 0x448c,
+	    0x34ee, 0x07bf, 0x43b5, 0x2dc6, 0x0000, 0x2a2d, 0x0000, 0x1362,
+	    0x18b0, 0x0000, 0x0df4, 0x4399, 0x0000, 0x4bdf, 0x0000, 0x0000,
+	    0x4c76, 0x0000, 0x041d, 0x16e9, 0x25a3, 0x0c66, 0x21ff, 0x0000,
+	    0x4a2f, 0x0f8c, 0x09d9, 0x1bb6, 0x0000, 0x0268, 0x2272, 0x1b4c,
+	    0x43ee, 0x1df1, 0x1f25, 0x0000, 0x0c44, 0x0000, 0x1336, 0x0000,
+	    0x45c7, 0x0000, 0x0b68, 0x051b, 0x0000, 0x171a, 0x3f0a, 0x0000,
+	    0x3574, 0x0a39, 0x342b, 0x1f0c, 0x0000, 0x43de, 0x384e, 0x3530,
+	    0x0000, 0x221d, 0x09de, 0x0000, 0x45c9, 0x0000, 0x0000, 0x0c88,
+	    0x0000, 0x14ba, 0x4deb, 0x0cba, 0x1fcd, 0x3992, 0x1819, 0x09c5,
+	    0x10ad, 0x41ae, 0x38e1, 0x44c9, 0x0414, 0x4560, 0x0000, 0x0000,
+	    0x1521, 0x2d9f, 0x22cc, 0x00ff, 0x184c, 0x0c4b, 0x0000, 0x1c5b,
+	    0x0000, 0x0000, 0x0a34, 0x0000, 0x0000, 0x4b47, 0x0d9e, 0x1f9f,
+	    0x40cb, 0x24ee, 0x0d2b, 0x0738, 0x0000, 0x20d5, 0x4b36, 0x0000,
+	    0x1dc0, 0x3e07, 0x2e58, 0x02c9, 0x3939, 0x022a, 0x495e, 0x2f23,
+	    0x13bb, 0x1e08, 0x41b1, 0x0000, 0x1989, 0x0000, 0x0000, 0x0000,
+	    0x0c24, 0x3dad, 0x4b59, 0x0685, 0x3d4a, 0x3e23, 0x3bf4, 0x0a88,
+	    0x368b, 0x2a9f, 0x0fe8, 0x195d, 0x0000, 0x3e41, 0x399c, 0x1ab5,
+	    0x4737, 0x0000, 0x0da3, 0x3518, 0x192e, 0x34b3, 0x4ce3, 0x3c44,
+	    0x1f1e, 0x1f39, 0x0000, 0x0000, 0x1416, 0x227b, 0x0792, 0x0e9d,
+	    0x36b7, 0x4897, 0x3055, 0x31df, 0x0000, 0x43bc, 0x38fd, 0x0000,
+	    0x22bd, 0x0000, 0x3d3c, 0x3326, 0x1304, 0x1c19, 0x4dd1, 0x45bb,
+	    0x4790, 0x1070, 0x3344, 0x4b3d, 0x3cb6, 0x0000, 0x3d51, 0x33c0,
+	    0x36ce, 0x29b0, 0x094e, 0x2c6a, 0x4a4c, 0x3d4e, 0x08d1, 0x1d8a,
+	    0x083e, 0x4c8d, 0x0000, 0x079e, 0x2bd5, 0x2576, 0x3f4f, 0x0000,
+	    0x0265, 0x0a54, 0x1847, 0x17ed, 0x45f2, 0x3e9b, 0x3256, 0x129d,
+	    0x40b0, 0x0000, 0x4a26, 0x4b12, 0x0000, 0x1220, 0x0000, 0x0223,
+	    0x0000, 0x0000, 0x2553, 0x1fb2, 0x3234, 0x0707, 0x3c8e, 0x0409,
+	    0x0b46, 0x34aa, 0x3f96, 0x2a78, 0x0000, 0x3ce7, 0x0b61, 0x19b7,
+	    0x222a, 0x2ef7, 0x0000, 0x254c, 0x2d46, 0x32e7, 0x3d5f, 0x2139,
+	    0x0000, 0x48f8, 0x2d5b, 0x375d, 0x052b, 0x3c0b, 0x3fd1, 0x3aa3,
+	    0x4ab6, 0x389a, 0x3bfc, 0x4cb2, 0x2ffe, 0x283a, 0x2b09, 0x3e1d,
+	    0x03c2, 0x0000, 0x14c3, 0x3edf, 0x0000, 0x4475, 0x3c9b, 0x0e1b,
+	    0x1db3, 0x154b, 0x182c, 0x0178, 0x21d4, 0x019d, 0x4cf8, 0x2c8b,
+	    0x065f, 0x35b3, 0x30fb, 0x01de, 0x34b8, 0x313e, 0x04e8, 0x2136,
+	    0x12cc, 0x0000, 0x3e59, 0x1298, 0x0000, 0x0000, 0x0000, 0x0746,
+	    0x329d, 0x0d27, 0x4c0b, 0x3aa9, 0x481f, 0x1108, 0x37c8, 0x2bcd,
+	    0x31ef, 0x0c0e, 0x2a19, 0x237b, 0x346a, 0x04ee, 0x2843, 0x0f28,
+	    0x030d, 0x3a76, 0x0000, 0x0ee8, 0x2770, 0x3a5e, 0x1401, 0x018a,
+	    0x1aac, 0x324b, 0x0c72, 0x21ed, 0x0000, 0x0313, 0x172a, 0x0000,
+	    0x3825, 0x086d, 0x3d1e, 0x02b5, 0x0000, 0x0000, 0x377c, 0x2b20,
+	    0x24f1, 0x48f9, 0x120d, 0x2408, 0x3ad0, 0x4d55, 0x2495, 0x4156,
+	    0x1aac, 0x0402, 0x1122, 0x2fda, 0x06f1, 0x0000, 0x4bc5, 0x0509,
+	    0x277e, 0x38bf, 0x2781, 0x213c, 0x00dc, 0x2db7, 0x0e16, 0x0549,
+	    0x49e0, 0x0000, 0x36b3, 0x078e, 0x0e1c, 0x3fdd, 0x4bd9, 0x2d83,
+	    0x0000, 0x2184, 0x3324, 0x1a29, 0x4c84, 0x060d, 0x3452, 0x46fb,
+	    0x0000, 0x0000, 0x3c01, 0x28ef, 0x1285, 0x4535, 0x0000, 0x3530,
+	    0x03e8, 0x1bf0, 0x0000, 0x0000, 0x3a8d, 0x0000, 0x0000, 0x3ade,
+	    0x1f27, 0x1f40, 0x4d1a, 0x3eba, 0x1942, 0x0000, 0x0000, 0x1438,
+	    0x32e8, 0x0000, 0x0000, 0x1d5e, 0x37bd, 0x3c7a, 0x0b45, 0x01ee,
+	    0x301c, 0x27ed, 0x0000, 0x0e7c, 0x0000, 0x1232, 0x0000, 0x0000,
+	    0x4576, 0x1daf, 0x0530, 0x4582, 0x0000, 0x283c, 0x125a, 0x2755,
+	    0x23f9, 0x4583, 0x3b08, 0x0000, 0x27dc, 0x2a09, 0x4c8c, 0x0d8a,
+	    0x197f, 0x09d3, 0x0000, 0x2d49, 0x2d98, 0x3c58, 0x381d, 0x2622,
+	    0x1d19, 0x31de, 0x0b77, 0x473e, 0x0000, 0x0000, 0x2410, 0x1358,
+	    0x2b15, 0x0000, 0x233e, 0x0460, 0x3dfa, 0x25d3, 0x4a0d, 0x374d,
+	    0x1dff, 0x4a2a, 0x3364, 0x2e92, 0x21dd, 0x1764, 0x0000, 0x135d,
+	    0x409a, 0x29e3, 0x0b3a, 0x3487, 0x0000, 0x37d7, 0x4d52, 0x0ac8,
+	    0x3133, 0x4d7c, 0x42a4, 0x12e5, 0x0000, 0x3fbf, 0x12bd, 0x1fcf,
+	    0x0000, 0x0000, 0x2c7c, 0x4038, 0x4a1c, 0x0c27, 0x39eb, 0x0000,
+	    0x0c37, 0x06cf, 0x49e0, 0x3f22, 0x3130, 0x3bb3, 0x0000, 0x0000,
+	    0x34cf, 0x2b81, 0x0000, 0x4d70, 0x32e0, 0x3d55, 0x312f, 0x229d,
+	    0x2b7f, 0x3a96, 0x1f6d, 0x03d8, 0x164f, 0x0b37, 0x2262, 0x161e,
+	    0x40a2, 0x1f40, 0x311c, 0x0000, 0x24fe, 0x2b7c, 0x10d2, 0x3409,
+	    0x0000, 0x2fbb, 0x0aa2, 0x0000, 0x31c8, 0x0000, 0x1a64, 0x248c,
+	    0x3729, 0x0503, 0x3205, 0x0000, 0x46f0, 0x0bba, 0x3f3c, 0x400c,
+	    0x4ad6, 0x122c, 0x0a7b, 0x1570, 0x45e8, 0x2fe8, 0x19d9, 0x0000,
+	    0x33a7, 0x0000, 0x4be4, 0x468e, 0x0000, 0x12b1, 0x34a8, 0x0d61,
+	    0x0000, 0x4752, 0x2ebb, 0x01b5, 0x1a6b, 0x0232, 0x0000, 0x0000,
+	    0x3175, 0x1e90, 0x208b, 0x070c, 0x0000, 0x03ff, 0x1e5e, 0x146a,
+	    0x1c23, 0x4362, 0x0000, 0x0000, 0x2235, 0x296a, 0x0000, 0x17be,
+	    0x3ca4, 0x0000, 0x1884, 0x0000, 0x2563, 0x1f29, 0x4c7d, 0x3b54,
+	    0x20b3, 0x256f, 0x2043, 0x46b1, 0x1d24, 0x2cf2, 0x1c95, 0x1b9b,
+	    0x2fda, 0x0000, 0x0000, 0x4882, 0x1877, 0x3079, 0x06eb, 0x3b2d,
+	    0x23da, 0x0000, 0x3971, 0x061b, 0x2538, 0x3767, 0x2c55, 0x3923,
+	    0x0245, 0x0000, 0x194b, 0x0000, 0x04c1, 0x0000, 0x3b5a, 0x425e,
+	    0x0e33, 0x1863, 0x4ae8, 0x0e91, 0x0000, 0x116c, 0x1eb2, 0x4086,
+	    0x4dd2, 0x49a4, 0x3bb6, 0x0000, 0x0000, 0x3bda, 0x0000, 0x2cf8,
+	    0x2de5, 0x4859, 0x20f5, 0x0000, 0x0000, 0x21bd, 0x4954, 0x1947,
+	    0x090b, 0x1bba, 0x0581, 0x0174, 0x094a, 0x458a, 0x1911, 0x3857,
+	    0x0c24, 0x0328, 0x0000, 0x15a6, 0x1c3c, 0x35ed, 0x3673, 0x2004,
+	    0x4a7c, 0x0000, 0x2eba, 0x1a06, 0x2b23, 0x37c1, 0x2fec, 0x2dfc,
+	    0x0aea, 0x339c, 0x275c, 0x0000, 0x0000, 0x0728, 0x0000, 0x0000,
+	    0x4035, 0x443b, 0x2827, 0x2c74, 0x0000, 0x3bb3, 0x0246, 0x4a41,
+	    0x0000, 0x4c4e, 0x4b55, 0x141e, 0x0e40, 0x2f8d, 0x2c81, 0x15ae,
+	    0x2b92, 0x0000, 0x435b, 0x15c5, 0x4b81, 0x189c, 0x3a4c, 0x30a1,
+	    0x070e, 0x3aa5, 0x4320, 0x250e, 0x0000, 0x2c7d, 0x27b5, 0x225f,
+	    0x02c7, 0x09c9, 0x0000, 0x0fb8, 0x0000, 0x36bc, 0x3045, 0x0b3a,
+	    0x0314, 0x083e, 0x01a8, 0x0000, 0x0000, 0x3a53, 0x1110, 0x04dc,
+	    0x023e, 0x4ad0, 0x05a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x1bc5,
+	    0x0870, 0x23cc, 0x4438, 0x49d6, 0x3a56, 0x00ce, 0x2443, 0x2cdf,
+	    0x0000, 0x0b5f, 0x091a, 0x2032, 0x20f6, 0x1ea1, 0x0000, 0x3d70,
+	    0x0800, 0x0000, 0x0a74, 0x01b4, 0x1a8a, 0x0cdd, 0x34d4, 0x3f68,
+	    0x0682, 0x2c13, 0x2bc8, 0x0000, 0x2fcb, 0x3fe2, 0x0374, 0x0000,
+	    0x13d4, 0x472d, 0x1595, 0x0000, 0x4bd9, 0x4408, 0x08db, 0x3520,
+	    0x0182, 0x4d2e, 0x0000, 0x4937, 0x0000, 0x47b6, 0x028e, 0x0912,
+	    0x48af, 0x3e87, 0x420c, 0x49bf, 0x44e6, 0x3acc, 0x0000, 0x15f7,
+	    0x0000, 0x22e0, 0x003c, 0x0e7f, 0x0000, 0x012d, 0x3d9c, 0x1363,
+	    0x3cad, 0x101c, 0x47aa, 0x0000, 0x3c31, 0x2ed9, 0x1fe5, 0x1797,
+	    0x0245, 0x2e13, 0x0000, 0x0000, 0x10a7, 0x071a, 0x0000, 0x09f5,
+	    0x1ee2, 0x4a57, 0x0000, 0x4658, 0x2be3, 0x2c50, 0x0000, 0x0000,
+	    0x0000, 0x3db7, 0x32b6, 0x4d75, 0x413f, 0x4d2c, 0x1809, 0x47c2,
+	    0x19dc, 0x1263, 0x1030, 0x12ef, 0x34f8, 0x0000, 0x0000, 0x0638,
+	    0x2118, 0x38b5, 0x0856, 0x050c, 0x27df, 0x1c1f, 0x36a4, 0x1017,
+	    0x4c88, 0x2b4d, 0x3034, 0x379e, 0x2110, 0x4428, 0x0000, 0x47af,
+	    0x4975, 0x0fd5, 0x05ad, 0x0000, 0x2b30, 0x0000, 0x21ad, 0x1225,
+	    0x2e12, 0x20c2, 0x0000, 0x440d, 0x269f, 0x0d46, 0x0000, 0x2164,
+	    0x2b7f, 0x0967, 0x4cde, 0x0000, 0x48a0, 0x052e, 0x2661, 0x1940,
+	    0x0125, 0x0000, 0x0eb3, 0x060e, 0x0000, 0x066d, 0x025a, 0x2d4a,
+	    0x3435, 0x3b36, 0x0000, 0x23cd, 0x30c3, 0x39ea, 0x3171, 0x2140,
+	    0x173b, 0x4c85, 0x3aef, 0x41a9, 0x1dcc, 0x0e9e, 0x34c0, 0x0fc4,
+	    0x0000, 0x2fa3, 0x0974, 0x0a00, 0x0000, 0x30d1, 0x3886, 0x3646,
+	    0x33f1, 0x1587, 0x07fd, 0x2d87, 0x3f05, 0x10ef, 0x2141, 0x2ad4,
+	    0x38a5, 0x4d93, 0x0a04, 0x0000, 0x0594, 0x0000, 0x0000, 0x0000,
+	    0x0b63, 0x4675, 0x1dd3, 0x0009, 0x0000, 0x3964, 0x22fb, 0x2c7a,
+	    0x4ae7, 0x26ab, 0x08f4, 0x2e6d, 0x3778, 0x0000, 0x0000, 0x21fa,
+	    0x4731, 0x1467, 0x1515, 0x1182, 0x2c1e, 0x0000, 0x0000, 0x4e14,
+	    0x0000, 0x0000, 0x4aed, 0x3b30, 0x0000, 0x469e, 0x083c, 0x1ddd,
+	    0x1c23, 0x276a, 0x0c36, 0x4c90, 0x11b3, 0x0d21, 0x2294, 0x4b92,
+	    0x0000, 0x26b2, 0x4bec, 0x4c66, 0x2a20, 0x0d8e, 0x37f8, 0x237c,
+	    0x43eb, 0x0c57, 0x3578, 0x3da3, 0x0d4a, 0x2a25, 0x4d88, 0x1a63,
+	    0x0aa1, 0x0000, 0x2063, 0x309b, 0x0000, 0x36f8, 0x266e, 0x27f5,
+	    0x0f41, 0x4789, 0x07b0, 0x0a1f, 0x382e, 0x40cf, 0x252b, 0x4a16,
+	    0x39dd, 0x2b2d, 0x3687, 0x2cbb, 0x1414, 0x4caf, 0x18f1, 0x3097,
+	    0x2b81, 0x3d0b, 0x10f8, 0x0000, 0x3fae, 0x1d36, 0x0b9f, 0x0000,
+	    0x40db, 0x0000, 0x1191, 0x32fc, 0x3c4d, 0x1eea, 0x0000, 0x2cf5,
+	    0x2c4e, 0x4db8, 0x0000, 0x0175, 0x37c5, 0x0840, 0x4927, 0x3446,
+	    0x1f42, 0x4945, 0x4606, 0x04e9, 0x34a8, 0x29f0, 0x2b5a, 0x3d75,
+	    0x142e, 0x1094, 0x4da7, 0x0000, 0x1c75, 0x0dda, 0x4d2c, 0x3ac5,
+	    0x30f7, 0x402f, 0x16a5, 0x0707, 0x2b28, 0x1145, 0x432d, 0x0000,
+	    0x06c8, 0x2152, 0x429c, 0x1609, 0x4508, 0x12b0, 0x0000, 0x3d84,
+	    0x03f4, 0x310a, 0x3a8f, 0x31d5, 0x0000, 0x0f45, 0x3896, 0x14ec,
+	    0x19b5, 0x1aa1, 0x0000, 0x1d65, 0x28ff, 0x2ae7, 0x3a3a, 0x3205,
+	    0x2c66, 0x2967, 0x189e, 0x06d2, 0x062c, 0x40d0, 0x353e, 0x1dc9,
+	    0x0000, 0x00eb, 0x12cd, 0x3151, 0x086d, 0x0030, 0x338a, 0x410a,
+	    0x2196, 0x2b8c, 0x1f88, 0x18f6, 0x21e1, 0x3930, 0x1711, 0x3373,
+	    0x339a, 0x2df3, 0x031d, 0x2719, 0x09e4, 0x2bbc, 0x42a2, 0x1f83,
+	    0x19a7, 0x28da, 0x0838, 0x20d8, 0x4dd8, 0x0106, 0x15cd, 0x3a16,
+	    0x4bd2, 0x45a1, 0x1074, 0x2c5a, 0x3558, 0x05d4, 0x0000, 0x4296,
+	    0x28bf, 0x062c, 0x0000, 0x3936, 0x0856, 0x45a9, 0x37b9, 0x0000,
+	    0x3e29, 0x0000, 0x15c7, 0x0000, 0x2769, 0x0000, 0x1f65, 0x4a74,
+	    0x2df3, 0x0000, 0x20dc, 0x37ef, 0x3d12, 0x2bfb, 0x0000, 0x1786,
+	    0x2349, 0x0000, 0x1053, 0x0000, 0x06a0, 0x0e1c, 0x41e6, 0x4b1c,
+	    0x0000, 0x41b1, 0x238c, 0x2a77, 0x228f, 0x0000, 0x3b13, 0x0000,
+	    0x0000, 0x3699, 0x448d, 0x0581, 0x3d8f, 0x259a, 0x1ab8, 0x0000,
+	    0x1f67, 0x3d05, 0x0000, 0x27cd, 0x19ce, 0x18f8, 0x48bd, 0x0000,
+	    0x3d77, 0x2e03, 0x3707, 0x0000, 0x13cb, 0x3713, 0x4d55, 0x342b,
+	    0x0000, 0x493c, 0x0466, 0x1a83, 0x0177, 0x0888, 0x2d06, 0x0000,
+	    0x3289, 0x2c68, 0x41cd, 0x2edb, 0x03d8, 0x1cd5, 0x2920, 0x10d5,
+	    0x11fe, 0x0000, 0x23eb, 0x0000, 0x05e9, 0x3192, 0x025c, 0x4828,
+	    0x2dc9, 0x0000, 0x0000, 0x314d, 0x0704, 0x05db, 0x1fc3, 0x0000,
+	    0x1519, 0x480b, 0x0792, 0x3fd7, 0x03f7, 0x0000, 0x0000, 0x497b,
+	    0x3334, 0x2702, 0x2734, 0x0dae, 0x2131, 0x38fd, 0x0000, 0x4707,
+	    0x393a, 0x476d, 0x3e55, 0x0000, 0x0000, 0x343e, 0x363c, 0x0000,
+	    0x3176, 0x0c7b, 0x4cd0, 0x3b7d, 0x166d, 0x15c6, 0x46bf, 0x42f8,
+	    0x0b1b, 0x1453, 0x4c4d, 0x29e1, 0x037e, 0x03d9, 0x0f25, 0x0e58,
+	    0x116c, 0x2662, 0x0dc7, 0x0e78, 0x0de6, 0x0dca, 0x3422, 0x2bde,
+	    0x3099, 0x0000, 0x192d, 0x0221, 0x21db, 0x187d, 0x0000, 0x0ce9,
+	    0x1f50, 0x0000, 0x0e5b, 0x3042, 0x1df1, 0x18cf, 0x0000, 0x0000,
+	    0x0000, 0x1fb0, 0x3b29, 0x16b7, 0x01ee, 0x0c86, 0x1ad4, 0x0f89,
+	    0x064c, 0x0000, 0x4462, 0x050d, 0x2d24, 0x034a, 0x1b95, 0x1354,
+	    0x0ae8, 0x3f3b, 0x1cae, 0x0ff5, 0x2bf7, 0x1804, 0x298a, 0x3c35,
+	    0x423b, 0x45e9, 0x4325, 0x4831, 0x19f2, 0x0337, 0x0000, 0x1cfd,
+	    0x19ce, 0x3aa1, 0x0000, 0x35c3, 0x1b19, 0x4acb, 0x0000, 0x1c7a,
+	    0x0677, 0x160a, 0x21d7, 0x0000, 0x0461, 0x38fb, 0x0000, 0x1669,
+	    0x2be1, 0x2571, 0x0000, 0x0000, 0x1ae7, 0x0000, 0x396f, 0x43b6,
+	    0x0eed, 0x0000, 0x0000, 0x1b3d, 0x4581, 0x356b, 0x2dab, 0x0000,
+	    0x0000, 0x2098, 0x4696, 0x0adc, 0x2dcc, 0x28cd, 0x0602, 0x2a25,
+	    0x31a9, 0x3052, 0x42e3, 0x439d, 0x40ca, 0x4aec, 0x0563, 0x131b,
+	    0x05ce, 0x09a4, 0x2d69, 0x1b32, 0x4299, 0x46a2, 0x0000, 0x11ca,
+	    0x3063, 0x093a, 0x4909, 0x019a, 0x2c8a, 0x0000, 0x4d0f, 0x216b,
+	    0x49db, 0x04cd, 0x28a5, 0x0fcd, 0x002e, 0x177d, 0x39a6, 0x32c0,
+	    0x0000, 0x1d17, 0x0986, 0x391e, 0x0b2c, 0x2c9c, 0x2f63, 0x0ba5,
+	    0x07d3, 0x1b83, 0x0bff, 0x4405, 0x29a9, 0x2ac4, 0x2601, 0x0000,
+	    0x3abd, 0x08ac, 0x11d3, 0x3655, 0x37e2, 0x305c, 0x1dcf, 0x0000,
+	    0x1525, 0x0000, 0x389e, 0x1318, 0x27ef, 0x154d, 0x24d7, 0x0a3a,
+	    0x3e66, 0x0bc7, 0x3c4f, 0x0000, 0x172b, 0x406a, 0x0aca, 0x0e13,
+	    0x2f26, 0x0000, 0x0000, 0x3d8a, 0x12db, 0x083e, 0x3f1a, 0x19c9,
+	    0x47a9, 0x0000, 0x4127, 0x1b8c, 0x1d09, 0x3dc3, 0x2639, 0x1dea,
+	    0x062a, 0x0000, 0x070b, 0x463b, 0x1b3c, 0x45d0, 0x3d0e, 0x10d0,
+	    0x0355, 0x0000, 0x19f0, 0x0215, 0x1997, 0x1587, 0x4104, 0x0000,
+	    0x234e, 0x4100, 0x0000, 0x0000, 0x1ccf, 0x0000, 0x3e24, 0x2b00,
+	    0x09bb, 0x0019, 0x0000, 0x0000, 0x1955, 0x4229, 0x0000, 0x304e,
+	    0x0dbf, 0x1d6b, 0x1872, 0x3496, 0x2948, 0x3dd4, 0x1321, 0x0000,
+	    0x207c, 0x1b60, 0x4092, 0x133f, 0x2550, 0x0005, 0x0000, 0x3792,
+	    0x0000, 0x3707, 0x0fa4, 0x4db1, 0x3f75, 0x08b8, 0x1085, 0x0000,
+	    0x0000, 0x28da, 0x2108, 0x0000, 0x0000, 0x361c, 0x0000, 0x435e,
+	    0x0f9b, 0x4379, 0x37ba, 0x0604, 0x0000, 0x07e0, 0x08a0, 0x3ff6,
+	    0x3ddd, 0x29ba, 0x11be, 0x2446, 0x0000, 0x22ce, 0x23e5, 0x4064,
+	    0x1310, 0x3f84, 0x3b77, 0x1019, 0x0000, 0x41a3, 0x417a, 0x0000,
+	    0x4364, 0x4451, 0x2f76, 0x2223, 0x0138, 0x0739, 0x0810, 0x0000,
+	    0x0000, 0x18c8, 0x38d1, 0x0165, 0x3a44, 0x0e91, 0x2181, 0x27ec,
+	    0x1cd2, 0x3fe7, 0x0000, 0x0000, 0x0000, 0x0ba6, 0x32b7, 0x0f7e,
+	    0x4503, 0x0dfb, 0x324d, 0x0fb7, 0x2792, 0x2097, 0x3cc7, 0x3239,
+	    0x10e9, 0x3ed7, 0x0000, 0x18a6, 0x0ce3, 0x313b, 0x2c12, 0x3e5a,
+	    0x119c, 0x0000, 0x21f5, 0x470e, 0x0000, 0x21f4, 0x4530, 0x04f2,
+	    0x01ee, 0x3060, 0x4d06, 0x0000, 0x36f1, 0x3d23, 0x23bd, 0x3374,
+	    0x1e3e, 0x209b, 0x2573, 0x1a1f, 0x32a7, 0x1a37, 0x3664, 0x3fe1,
+	    0x02bd, 0x00f4, 0x3ade, 0x0e19, 0x0000, 0x0000, 0x1ff7, 0x0f38,
+	    0x26f5, 0x0f34, 0x1bea, 0x46a9, 0x0000, 0x0000, 0x1cc9, 0x1b20,
+	    0x1b02, 0x0779, 0x2925, 0x462b, 0x1276, 0x0000, 0x0000, 0x0000,
+	    0x225b, 0x28c4, 0x249a, 0x0000, 0x1b9d, 0x31b5, 0x3894, 0x0000,
+	    0x38e1, 0x32b3, 0x0000, 0x2a2d, 0x0000, 0x0b87, 0x4a30, 0x0000,
+	    0x094d, 0x49aa, 0x1b8d, 0x2da6, 0x0000, 0x3797, 0x1f24, 0x2a55,
+	    0x1753, 0x0b48, 0x2903, 0x05e4, 0x381a, 0x4aa1, 0x322d, 0x3685,
+	    0x45e1, 0x3e88, 0x0000, 0x4967, 0x29f5, 0x4df7, 0x0544, 0x25ca,
+	    0x387d, 0x117e, 0x3efc, 0x2207, 0x01fb, 0x356b, 0x1d68, 0x213d,
+	    0x4c84, 0x3457, 0x045e, 0x0287, 0x0000, 0x03d8, 0x1df7, 0x3f3e,
+	    0x3e38, 0x0000, 0x0000, 0x0ba9, 0x0951, 0x13e1, 0x17de, 0x1118,
+	    0x071c, 0x4323, 0x0000, 0x3248, 0x366a, 0x354b, 0x0000, 0x0000,
+	    0x3e45, 0x0c3a, 0x4462, 0x1642, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x278b, 0x0000, 0x3726, 0x343e, 0x0f4e, 0x0f41, 0x3694, 0x3661,
+	    0x3b2a, 0x3a07, 0x0000, 0x2333, 0x0000, 0x08d3, 0x3654, 0x282c,
+	    0x25ae, 0x0000, 0x23a9, 0x2aeb, 0x06fe, 0x0000, 0x3e67, 0x42a1,
+	    0x11fa, 0x3835, 0x445e, 0x02eb, 0x054d, 0x0000, 0x0000, 0x0f43,
+	    0x2c18, 0x0000, 0x0000, 0x2738, 0x204b, 0x245d, 0x4948, 0x3401,
+	    0x3ac9, 0x4437, 0x0b27, 0x4ae0, 0x27e8, 0x4dd7, 0x0e1f, 0x0000,
+	    0x2137, 0x0000, 0x166c, 0x0000, 0x0000, 0x1b5f, 0x0c9d, 0x01b5,
+	    0x2e69, 0x0000, 0x4315, 0x1684, 0x35a2, 0x0000, 0x445a, 0x0000,
+	    0x356e, 0x0000, 0x0000, 0x3510, 0x29b7, 0x08e0, 0x34d9, 0x43c4,
+	    0x2c31, 0x00d2, 0x0000, 0x14b6, 0x0000, 0x0e8b, 0x0000, 0x0bbc,
+	    0x12f7, 0x3caf, 0x17ab, 0x1189, 0x2b3c, 0x0f58, 0x1b14, 0x0aab,
+	    0x0000, 0x2fc5, 0x1c38, 0x0a9d, 0x3064, 0x46cc, 0x44bf, 0x37cd,
+	    0x0000, 0x24ef, 0x2509, 0x39be, 0x0000, 0x4b48, 0x0000, 0x3598,
+	    0x2204, 0x0000, 0x36f5, 0x2f74, 0x42c6, 0x387d, 0x0000, 0x2827,
+	    0x4db3, 0x0000, 0x2600, 0x3eb2, 0x0000, 0x14eb, 0x00ab, 0x0000,
+	    0x0000, 0x01ed, 0x0000, 0x47b0, 0x09a7, 0x0000, 0x3580, 0x0000,
+	    0x1419, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d33, 0x3fa8,
+	    0x15db, 0x193a, 0x4e0d, 0x29b3, 0x2ee5, 0x0000, 0x3c4c, 0x1d1d,
+	    0x40f9, 0x30c1, 0x44c2, 0x093b, 0x0000, 0x118c, 0x20ff, 0x2aa5,
+	    0x0000, 0x0000, 0x1411, 0x3bf2, 0x0000, 0x3ec8, 0x0ca4, 0x1a68,
+	    0x0739, 0x0000, 0x0000, 0x1302, 0x0000, 0x0000, 0x0000, 0x0994,
+	    0x398a, 0x0000, 0x0000, 0x4190, 0x257e, 0x1313, 0x2ce9, 0x4b3e,
+	    0x2025, 0x2eca, 0x34ac, 0x3683, 0x4cec, 0x273e, 0x4230, 0x36ed,
+	    0x352e, 0x0690, 0x1f75, 0x400f, 0x4a29, 0x3850, 0x13e0, 0x0000,
+	    0x3aca, 0x0000, 0x0000, 0x222d, 0x246b, 0x0000, 0x2f3a, 0x0000,
+	    0x3598, 0x0229, 0x2106, 0x0000, 0x45ff, 0x3d70, 0x0000, 0x0467,
+	    0x49b0, 0x30fc, 0x2d1a, 0x03be, 0x0000, 0x0000, 0x0f68, 0x237f,
+	    0x0000, 0x491d, 0x30e1, 0x21ab, 0x0c06, 0x4726, 0x0000, 0x3d7f,
+	    0x2b11, 0x22d2, 0x278a, 0x1124, 0x32c1, 0x4387, 0x27be, 0x1ba0,
+	    0x2248, 0x1072, 0x25b0, 0x0000, 0x3d37, 0x320f, 0x40ac, 0x0000,
+	    0x130d, 0x3eed, 0x2959, 0x38c4, 0x0000, 0x1edb, 0x1657, 0x3b4c,
+	    0x2f77, 0x3ce8, 0x0000, 0x0000, 0x065b, 0x3204, 0x05c5, 0x0be0,
+	    0x3a27, 0x0b19, 0x0000, 0x0000, 0x1cad, 0x0000, 0x4a50, 0x03d1,
+	    0x1820, 0x20df, 0x0000, 0x0000, 0x0000, 0x04a4, 0x4740, 0x0000,
+	    0x183b, 0x329d, 0x39dc, 0x4a66, 0x2b26, 0x0a78, 0x2563, 0x2ae7,
+	    0x1f41, 0x279e, 0x39c4, 0x0000, 0x2950, 0x0045, 0x0000, 0x0000,
+	    0x41f8, 0x2897, 0x299b, 0x30f7, 0x4735, 0x0000, 0x42c8, 0x18a9,
+	    0x1e60, 0x1d1c, 0x2112, 0x0000, 0x2844, 0x0000, 0x34cc, 0x04b2,
+	    0x3229, 0x4ac4, 0x1eba, 0x169d, 0x0000, 0x0000, 0x30b7, 0x0000,
+	    0x1c98, 0x0000, 0x24dc, 0x0000, 0x08f7, 0x0000, 0x3ef6, 0x06db,
+	    0x3ce3, 0x0000, 0x206d, 0x21f1, 0x0000, 0x12df, 0x3873, 0x47fa,
+	    0x2143, 0x3524, 0x0dc1, 0x35ac, 0x3c11, 0x3f94, 0x12d8, 0x4718,
+	    0x0de8, 0x0000, 0x3d54, 0x277c, 0x0000, 0x1489, 0x0000, 0x0000,
+	    0x0000, 0x16dc, 0x35cf, 0x3879, 0x0bf6, 0x4410, 0x1879, 0x262e,
+	    0x0000, 0x16af, 0x1890, 0x1a1c, 0x3605, 0x1ed6, 0x4524, 0x3c51,
+	    0x4292, 0x1ce1, 0x2113, 0x1627, 0x3df9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x36ca, 0x0000, 0x0000, 0x4b1a, 0x29ac, 0x2979, 0x10d7,
+	    0x495c, 0x0000, 0x411b, 0x14dc, 0x0000, 0x46f8, 0x0000, 0x0328,
+	    0x15c0, 0x0000, 0x49c1, 0x3a10, 0x1af4, 0x3c13, 0x0000, 0x12d9,
+	    0x0000, 0x195f, 0x0000, 0x3a82, 0x12eb, 0x472e, 0x0000, 0x0b58,
+	    0x4396, 0x0000, 0x3b93, 0x152e, 0x453a, 0x1fc3, 0x230b, 0x4274,
+	    0x0553, 0x2efe, 0x4a89, 0x343f, 0x3df9, 0x0000, 0x4bb5, 0x1ee4,
+	    0x293e, 0x1fb7, 0x0000, 0x2548, 0x0000, 0x030d, 0x0000, 0x494d,
+	    0x392b, 0x1da8, 0x4aef, 0x0000, 0x0000, 0x4ca5, 0x49b1, 0x0000,
+	    0x0589, 0x0000, 0x44f4, 0x2bc9, 0x03b2, 0x2fd8, 0x399d, 0x41ed,
+	    0x3927, 0x158d, 0x2e2a, 0x01fe, 0x139c, 0x4126, 0x302c, 0x0000,
+	    0x2abd, 0x3fde, 0x19ce, 0x1043, 0x0e80, 0x155f, 0x11da, 0x20f5,
+	    0x24c8, 0x4b48, 0x25c3, 0x4022, 0x2398, 0x0000, 0x0000, 0x4467,
+	    0x3caf, 0x031c, 0x36e4, 0x319f, 0x1232, 0x1584, 0x1485, 0x39f7,
+	    0x024e, 0x0000, 0x4155, 0x31bc, 0x1278, 0x3862, 0x3aed, 0x210f,
+	    0x2581, 0x0000, 0x3d8a, 0x0df6, 0x2e89, 0x0000, 0x27bb, 0x02b1,
+	    0x3f74, 0x4b3a, 0x38f2, 0x0000, 0x0000, 0x0139, 0x2132, 0x0000,
+	    0x227c, 0x48bf, 0x0000, 0x13a1, 0x19fe, 0x4747, 0x1adb, 0x0000,
+	    0x4112, 0x1d83, 0x47cf, 0x115a, 0x02d4, 0x0000, 0x0000, 0x1127,
+	    0x0000, 0x0782, 0x0000, 0x04b4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x04c8, 0x0000, 0x0b9b, 0x39b6, 0x2240, 0x469b, 0x2750, 0x06f7,
+	    0x0000, 0x0000, 0x255f, 0x0aaf, 0x0b94, 0x0000, 0x458c, 0x3441,
+	    0x4342, 0x4d69, 0x0000, 0x1c77, 0x1fcb, 0x1aaa, 0x36e8, 0x481d,
+	    0x0000, 0x44f2, 0x2e35, 0x0000, 0x13b8, 0x2b15, 0x1894, 0x15e9,
+	    0x22a1, 0x0233, 0x00e0, 0x0000, 0x3052, 0x3b6f, 0x2412, 0x454d,
+	    0x0000, 0x1d77, 0x4ae4, 0x0000, 0x117e, 0x0000, 0x2991, 0x4a4e,
+	    0x35d6, 0x3847, 0x47aa, 0x20b9, 0x2629, 0x4813, 0x1099, 0x36a2,
+	    0x0000, 0x4907, 0x394b, 0x03ad, 0x0152, 0x2510, 0x2430, 0x0000,
+	    0x4c88, 0x4c8d, 0x0000, 0x0000, 0x0000, 0x2991, 0x1e95, 0x0000,
+	    0x0e41, 0x3eb2, 0x0fe0, 0x0a51, 0x005c, 0x46d3, 0x0000, 0x0cea,
+	    0x0000, 0x0000, 0x3403, 0x0000, 0x0000, 0x0000, 0x3051, 0x1a2e,
+	    0x448b, 0x15be, 0x48dc, 0x49e4, 0x2e80, 0x0000, 0x13dd, 0x05d8,
+	    0x0000, 0x0420, 0x0000, 0x0000, 0x1375, 0x0b1d, 0x0514, 0x4635,
+	    0x0000, 0x0bf4, 0x0000, 0x0000, 0x0a57, 0x396d, 0x3691, 0x1dad,
+	    0x36b9, 0x3015, 0x0178, 0x004c, 0x41a4, 0x15e6, 0x4a8f, 0x194e,
+	    0x0000, 0x0000, 0x253c, 0x3dcf, 0x0000, 0x38c0, 0x1871, 0x31ef,
+	    0x38fb, 0x0000, 0x1709, 0x02e1, 0x0000, 0x04a3, 0x2d8b, 0x05ec,
+	    0x0000, 0x2e52, 0x2a24, 0x40af, 0x1a16, 0x264d, 0x124e, 0x459c,
+	    0x48ea, 0x0000, 0x4ac6, 0x34b8, 0x4850, 0x0000, 0x0000, 0x1447,
+	    0x3445, 0x255c, 0x192d, 0x0df9, 0x06b0, 0x3309, 0x2658, 0x1328,
+	    0x0000, 0x0254, 0x1e3e, 0x1b24, 0x2ea6, 0x2c28, 0x0000, 0x1896,
+	    0x0000, 0x1a73, 0x0732, 0x1b9d, 0x080e, 0x1a07, 0x0286, 0x21da,
+	    0x4479, 0x0000, 0x3ab7, 0x0000, 0x4967, 0x4597, 0x0000, 0x1273,
+	    0x3731, 0x307a, 0x386b, 0x31aa, 0x3821, 0x0f58, 0x1221, 0x33a2,
+	    0x20d1, 0x21e2, 0x0d54, 0x2cb7, 0x17ce, 0x45a3, 0x1bb5, 0x3cec,
+	    0x3362, 0x2ce3, 0x3eac, 0x0000, 0x1232, 0x0000, 0x327d, 0x0000,
+	    0x256c, 0x0000, 0x0000, 0x4bea, 0x46c2, 0x3f1d, 0x3712, 0x2d22,
+	    0x0767, 0x0000, 0x147c, 0x18ae, 0x090d, 0x03c3, 0x0000, 0x14dc,
+	    0x265b, 0x1c59, 0x2293, 0x19d3, 0x3cd9, 0x0000, 0x0eb9, 0x0d92,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0cb1, 0x192f, 0x2e66, 0x4423,
+	    0x36b4, 0x151d, 0x132c, 0x2933, 0x4aac, 0x2592, 0x0000, 0x1db3,
+	    0x4d92, 0x06fc, 0x344d, 0x0ff5, 0x2999, 0x3413, 0x15fe, 0x3328,
+	    0x0000, 0x3259, 0x0000, 0x1286, 0x4bd6, 0x0000, 0x0000, 0x1d16,
+	    0x0207, 0x0000, 0x09d6, 0x3f8b, 0x0000, 0x0000, 0x1bad, 0x4150,
+	    0x1941, 0x20ac, 0x35dc, 0x315a, 0x0add, 0x168a, 0x1503, 0x0000,
+	    0x06be, 0x1bad, 0x297b, 0x0000, 0x4812, 0x1b92, 0x0000, 0x0000,
+	    0x1426, 0x39ba, 0x3f35, 0x1d84, 0x08cf, 0x0363, 0x4bab, 0x0000,
+	    0x0000, 0x1399, 0x3af0, 0x1718, 0x0000, 0x3195, 0x17aa, 0x1134,
+	    0x4235, 0x441d, 0x108e, 0x3ebe, 0x275f, 0x30d4, 0x1255, 0x2854,
+	    0x4737, 0x03cf, 0x2776, 0x2c61, 0x2208, 0x4851, 0x1772, 0x0183,
+	    0x3eba, 0x1c13, 0x1fd0, 0x4991, 0x45c3, 0x49e4, 0x0000, 0x4b2d,
+	    0x488d, 0x0000, 0x057a, 0x248f, 0x1e6c, 0x47f9, 0x0fa5, 0x261b,
+	    0x3ea8, 0x3461, 0x0000, 0x0000, 0x3ccc, 0x2656, 0x0b31, 0x0000,
+	    0x0000, 0x0000, 0x1e99, 0x1da0, 0x1004, 0x42be, 0x0195, 0x2656,
+	    0x2395, 0x04c7, 0x0000, 0x0c06, 0x2c8b, 0x2e46, 0x1f01, 0x1d2d,
+	    0x1bfa, 0x1c24, 0x0466, 0x21a9, 0x1bd5, 0x1aa1, 0x11db, 0x3a9a,
+	    0x2388, 0x268a, 0x1c09, 0x0000, 0x4bb4, 0x4d9f, 0x3c20, 0x01ba,
+	    0x0000, 0x1456, 0x18a1, 0x10d5, 0x0e60, 0x0a4c, 0x013a, 0x4bbd,
+	    0x0000, 0x0000, 0x16bf, 0x3a41, 0x4147, 0x4463, 0x2b01, 0x0000,
+	    0x0e16, 0x1c7a, 0x0505, 0x0000, 0x29e7, 0x4334, 0x2235, 0x1874,
+	    0x07ff, 0x2ce8, 0x26b5, 0x3b4d, 0x0000, 0x3eb0, 0x14b5, 0x02d5,
+	    0x2030, 0x0000, 0x2a1e, 0x0cae, 0x02ea, 0x0d2f, 0x00ff, 0x25d6,
+	    0x0efc, 0x0000, 0x3b19, 0x2f7d, 0x1708, 0x2268, 0x4cbf, 0x0000,
+	    0x050d, 0x05c5, 0x3edc, 0x2a01, 0x3db9, 0x0000, 0x4264, 0x3207,
+	    0x48ee, 0x451d, 0x2a53, 0x33b8, 0x336d, 0x0000, 0x0d6b, 0x0000,
+	    0x0670, 0x13ce, 0x0000, 0x40b3, 0x181c, 0x15bb, 0x2a66, 0x072d,
+	    0x2a83, 0x1bc6, 0x0000, 0x3f1e, 0x12dd, 0x226a, 0x3bf3, 0x2f76,
+	    0x0000, 0x0000, 0x2a26, 0x0000, 0x3e2d, 0x4afb, 0x1ea8, 0x35c1,
+	    0x0000, 0x0481, 0x0fce, 0x0000, 0x3e9c, 0x0000, 0x451a, 0x0000,
+	    0x2354, 0x2969, 0x3ea2, 0x17c4, 0x3cac, 0x34a1, 0x01db, 0x0000,
+	    0x058e, 0x3ed4, 0x0000, 0x4a7d, 0x0002, 0x1015, 0x3558, 0x414d,
+	    0x3a96, 0x438c, 0x0000, 0x24e2, 0x0000, 0x14bd, 0x0056, 0x0000,
+	    0x3618, 0x032e, 0x30cc, 0x1330, 0x3623, 0x0000, 0x1c2a, 0x278e,
+	    0x3d62, 0x0000, 0x0ac4, 0x2c4c, 0x0000, 0x0000, 0x0000, 0x04ed,
+	    0x08d9, 0x45cb, 0x0000, 0x0acf, 0x0000, 0x14c2, 0x3dc3, 0x4cf9,
+	    0x0a99, 0x2d59, 0x3d05, 0x0000, 0x1aa9, 0x34a2, 0x0b25, 0x3db9,
+	    0x14cb, 0x0d40, 0x4c44, 0x3c55, 0x1d52, 0x46c2, 0x0abe, 0x3f4b,
+	    0x336d, 0x163b, 0x3209, 0x34f1, 0x0000, 0x0926, 0x15e7, 0x4894,
+	    0x0000, 0x0541, 0x23cc, 0x0000, 0x1ac0, 0x2c22, 0x34bf, 0x39ab,
+	    0x2cdf, 0x2be8, 0x4042, 0x0000, 0x24e9, 0x0000, 0x31f6, 0x4589,
+	    0x0000, 0x0000, 0x43e0, 0x01c8, 0x2333, 0x132d, 0x4416, 0x3b7d,
+	    0x1bdb, 0x0000, 0x3400, 0x0a66, 0x0000, 0x10d7, 0x3100, 0x36f8,
+	    0x1df8, 0x33a7, 0x0a3a, 0x0000, 0x2f52, 0x0000, 0x0f0e, 0x281a,
+	    0x0f5c, 0x285f, 0x1b58, 0x1312, 0x18b9, 0x3528, 0x365f, 0x228d,
+	    0x0000, 0x1067, 0x3177, 0x3b20, 0x0000, 0x2205, 0x1e1b, 0x0000,
+	    0x2f6e, 0x2e89, 0x1de2, 0x1b6f, 0x2db3, 0x1736, 0x2eea, 0x3ece,
+	    0x1a86, 0x0000, 0x0000, 0x0000, 0x3ee1, 0x220f, 0x4864, 0x2c82,
+	    0x0000, 0x1c12, 0x228b, 0x4cb6, 0x411f, 0x40fd, 0x3b98, 0x12e0,
+	    0x3c43, 0x0000, 0x2551, 0x44ca, 0x0000, 0x17fd, 0x06f4, 0x0000,
+	    0x109e, 0x1a84, 0x2bee, 0x3c97, 0x3adf, 0x2bb8, 0x0000, 0x2ce2,
+	    0x3706, 0x0000, 0x1808, 0x027e, 0x13a3, 0x0a7c, 0x4582, 0x1ecc,
+	    0x0000, 0x1fff, 0x0000, 0x0000, 0x34db, 0x38a0, 0x1c9b, 0x0000,
+	    0x22bc, 0x255a, 0x27bb, 0x42eb, 0x41cf, 0x07e7, 0x0000, 0x0000,
+	    0x0b4f, 0x0000, 0x1ee8, 0x140c, 0x09f5, 0x2e94, 0x4407, 0x18c1,
+	    0x0e33, 0x0000, 0x28cf, 0x3fdd, 0x161b, 0x0000, 0x243a, 0x37a0,
+	    0x0000, 0x0000, 0x0000, 0x2ee6, 0x0000, 0x0527, 0x0f47, 0x0000,
+	    0x15be, 0x1678, 0x33bf, 0x417d, 0x3240, 0x0000, 0x3b45, 0x0000,
+	    0x08c9, 0x172b, 0x0000, 0x46ed, 0x0bbb, 0x40c1, 0x314d, 0x29f0,
+	    0x3f17, 0x0000, 0x16ae, 0x2428, 0x2e94, 0x0000, 0x0000, 0x076c,
+	    0x034b, 0x0000, 0x0000, 0x1141, 0x0000, 0x0000, 0x0000, 0x46ab,
+	    0x3001, 0x3325, 0x00e7, 0x0000, 0x0000, 0x0a9a, 0x0000, 0x11cc,
+	    0x0000, 0x325d, 0x16b8, 0x064a, 0x036e, 0x466a, 0x3b02, 0x02bb,
+	    0x45a6, 0x3333, 0x4434, 0x2449, 0x3aee, 0x4dad, 0x0cff, 0x3994,
+	    0x0007, 0x2bfa, 0x0000, 0x2de7, 0x34f0, 0x3519, 0x4cd3, 0x2cf0,
+	    0x35f4, 0x2c13, 0x0000, 0x0f4a, 0x0d52, 0x0000, 0x0289, 0x108a,
+	    0x0bc3, 0x2956, 0x4c7a, 0x421d, 0x0cfc, 0x0000, 0x0000, 0x2377,
+	    0x131a, 0x0000, 0x490f, 0x0000, 0x030b, 0x0000, 0x4a76, 0x0433,
+	    0x0665, 0x0000, 0x2960, 0x0000, 0x103e, 0x1faa, 0x3d90, 0x0682,
+	    0x2d63, 0x3b6e, 0x2446, 0x1600, 0x0000, 0x3bf2, 0x4764, 0x05bb,
+	    0x1bb4, 0x0000, 0x0000, 0x0000, 0x2aa4, 0x3c6c, 0x1bca, 0x081a,
+	    0x0000, 0x0571, 0x14f4, 0x0000, 0x0000, 0x058b, 0x0489, 0x0000,
+	    0x22ce, 0x18f7, 0x322e, 0x2082, 0x0d0f, 0x387f, 0x0000, 0x36da,
+	    0x32a3, 0x4564, 0x2101, 0x3e0f, 0x226e, 0x0000, 0x0000, 0x4ad0,
+	    0x3cab, 0x1aa2, 0x2adf, 0x053d, 0x36a8, 0x0655, 0x0000, 0x30e9,
+	    0x3275, 0x03ba, 0x0000, 0x1e32, 0x4589, 0x0000, 0x21b7, 0x3559,
+	    0x4624, 0x031d, 0x124f, 0x1038, 0x0632, 0x0000, 0x1e12, 0x4624,
+	    0x2845, 0x02c7, 0x461d, 0x0596, 0x0000, 0x1392, 0x17de, 0x2114,
+	    0x0000, 0x3cf1, 0x1ada, 0x0bac, 0x0000, 0x0813, 0x3919, 0x2ea7,
+	    0x1610, 0x0000, 0x141b, 0x1082, 0x2ae9, 0x0b53, 0x18b9, 0x20af,
+	    0x3978, 0x4bda, 0x2dc1, 0x4b91, 0x3e0f, 0x1164, 0x1f0e, 0x0000,
+	    0x0000, 0x0000, 0x4720, 0x1f64, 0x2003, 0x0000, 0x36ac, 0x0000,
+	    0x0000, 0x1cb8, 0x0000, 0x47d3, 0x0f98, 0x3231, 0x2cf8, 0x15cd,
+	    0x11d7, 0x2950, 0x1369, 0x0000, 0x3964, 0x0000, 0x09ab, 0x4b1e,
+	    0x4cb4, 0x382f, 0x3a02, 0x079c, 0x0000, 0x0ddd, 0x0000, 0x0000,
+	    0x0000, 0x1966, 0x2393, 0x0000, 0x40f8, 0x4084, 0x10a2, 0x2df2,
+	    0x0000, 0x0000, 0x3e6a, 0x0000, 0x0000, 0x0000, 0x4c24, 0x0000,
+	    0x0000, 0x135c, 0x0000, 0x1be1, 0x1c78, 0x0000, 0x022d, 0x0bf2,
+	    0x48db, 0x3603, 0x44d5, 0x1709, 0x2c1e, 0x44a2, 0x1639, 0x2217,
+	    0x10e1, 0x487c, 0x0000, 0x1ede, 0x21a1, 0x2b60, 0x1999, 0x0c2c,
+	    0x1f0a, 0x0514, 0x3133, 0x1116, 0x0000, 0x0000, 0x379c, 0x1059,
+	    0x279f, 0x28c6, 0x4cbf, 0x0000, 0x182b, 0x387d, 0x1055, 0x39d4,
+	    0x3f63, 0x1652, 0x05a4, 0x4366, 0x4d76, 0x0000, 0x0000, 0x0000,
+	    0x0482, 0x3834, 0x0bef, 0x0000, 0x0000, 0x0fc2, 0x0000, 0x17a0,
+	    0x42d4, 0x12a9, 0x038c, 0x1781, 0x2660, 0x1f02, 0x33f1, 0x0000,
+	    0x1cbb, 0x0000, 0x02c8, 0x1754, 0x0000, 0x0bd3, 0x0000, 0x261c,
+	    0x1e41, 0x0000, 0x0000, 0x3e7e, 0x2324, 0x4cb7, 0x0000, 0x41be,
+	    0x0000, 0x0cb2, 0x24fa, 0x37a8, 0x0000, 0x0000, 0x1591, 0x2366,
+	    0x3574, 0x1f8b, 0x0000, 0x2b3a, 0x264b, 0x0000, 0x0881, 0x3d2a,
+	    0x09e3, 0x4972, 0x24c3, 0x17c4, 0x492e, 0x1030, 0x3d1c, 0x2b89,
+	    0x0625, 0x2de2, 0x4bb2, 0x0000, 0x3e5b, 0x3fff, 0x21fd, 0x0000,
+	    0x0000, 0x0000, 0x2ab1, 0x0000, 0x1ad6, 0x4c3c, 0x0d6c, 0x3a99,
+	    0x121d, 0x3450, 0x08ef, 0x3320, 0x0000, 0x0f6a, 0x0dc9, 0x04a5,
+	    0x4b22, 0x2921, 0x493d, 0x0000, 0x3554, 0x2933, 0x0000, 0x3393,
+	    0x211f, 0x09e9, 0x0000, 0x35d3, 0x01de, 0x17a1, 0x4690, 0x1e57,
+	    0x36f7, 0x07da, 0x21f8, 0x0000, 0x0ae3, 0x2056, 0x26b5, 0x1aa3,
+	    0x02d7, 0x0000, 0x37af, 0x2633, 0x48f0, 0x4791, 0x21d5, 0x0cc7,
+	    0x0e3d, 0x3309, 0x493f, 0x0000, 0x12cb, 0x4d96, 0x443f, 0x16b1,
+	    0x0686, 0x40f5, 0x0253, 0x0000, 0x3e17, 0x28ac, 0x0000, 0x15c4,
+	    0x1475, 0x1169, 0x2cb5, 0x3434, 0x084a, 0x1ca0, 0x2a54, 0x1faa,
+	    0x27ae, 0x33b6, 0x2b5e, 0x1edd, 0x0000, 0x0000, 0x1b99, 0x0000,
+	    0x1826, 0x0000, 0x0000, 0x3ff1, 0x364f, 0x0000, 0x0ba9, 0x48af,
+	    0x4c0d, 0x475e, 0x32d0, 0x0000, 0x1913, 0x22ed, 0x4364, 0x0000,
+	    0x2739, 0x31ef, 0x4c31, 0x0000, 0x18ce, 0x09c2, 0x37d9, 0x08ed,
+	    0x2dd5, 0x306b, 0x2a41, 0x24d9, 0x108f, 0x10a3, 0x4d0b, 0x0000,
+	    0x0cdb, 0x2451, 0x2948, 0x306e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x19b6, 0x046c, 0x0000, 0x46ba, 0x134d, 0x4232, 0x1b47, 0x451a,
+	    0x192f, 0x01f4, 0x39ad, 0x0000, 0x47e9, 0x0275, 0x2103, 0x0000,
+	    0x0a91, 0x0000, 0x0dec, 0x226d, 0x32b8, 0x0a3a, 0x0000, 0x24db,
+	    0x3718, 0x4b85, 0x4209, 0x3c52, 0x2b70, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2422, 0x0000, 0x1eb5, 0x0196, 0x4cef, 0x1da9, 0x21a6,
+	    0x0821, 0x3f5a, 0x316c, 0x2a59, 0x48ca, 0x0000, 0x02bc, 0x40da,
+	    0x0000, 0x3f4c, 0x0431, 0x42e9, 0x0000, 0x2179, 0x1f68, 0x0000,
+	    0x2219, 0x0000, 0x146b, 0x08d6, 0x2b28, 0x08fd, 0x0000, 0x0000,
+	    0x0000, 0x3d69, 0x1d63, 0x0000, 0x1b60, 0x2515, 0x29ab, 0x0de8,
+	    0x0f13, 0x0cde, 0x0000, 0x19a9, 0x166c, 0x0000, 0x0b58, 0x20cb,
+	    0x1df9, 0x29e7, 0x4877, 0x45c6, 0x0000, 0x2a2a, 0x4276, 0x1ff0,
+	    0x0e7d, 0x2d78, 0x4ab2, 0x36e7, 0x0000, 0x0000, 0x42be, 0x0000,
+	    0x38f0, 0x1f81, 0x0000, 0x0d1c, 0x243b, 0x20ae, 0x0000, 0x1439,
+	    0x0168, 0x06fe, 0x2495, 0x023e, 0x0000, 0x0000, 0x2007, 0x1732,
+	    0x0000, 0x0000, 0x0000, 0x41ca, 0x2ba7, 0x0000, 0x3c50, 0x3256,
+	    0x0061, 0x35ae, 0x0000, 0x1f7a, 0x16ff, 0x091c, 0x3226, 0x0039,
+	    0x3b54, 0x39fa, 0x1e00, 0x0000, 0x4c8c, 0x172b, 0x2613, 0x1089,
+	    0x249a, 0x0977, 0x0000, 0x4297, 0x0000, 0x4433, 0x0bc0, 0x30b4,
+	    0x1e05, 0x07ac, 0x289d, 0x3302, 0x025e, 0x0000, 0x0000, 0x0000,
+	    0x3ac9, 0x2986, 0x1840, 0x3047, 0x201c, 0x0000, 0x162b, 0x24a8,
+	    0x0a1c, 0x38fe, 0x443d, 0x120c, 0x3e3e, 0x4343, 0x384c, 0x0000,
+	    0x354d, 0x0000, 0x0a2f, 0x16c9, 0x3505, 0x07bf, 0x3c70, 0x27f4,
+	    0x0000, 0x20f4, 0x108d, 0x3320, 0x13ee, 0x4b5a, 0x2833, 0x498d,
+	    0x009d, 0x0052, 0x21bf, 0x1057, 0x2efa, 0x2581, 0x0000, 0x0000,
+	    0x30fa, 0x2ed0, 0x0505, 0x42ed, 0x1b17, 0x0000, 0x2761, 0x04be,
+	    0x4d55, 0x41e5, 0x49cd, 0x4b5a, 0x0000, 0x02c2, 0x1c0a, 0x1281,
+	    0x1709, 0x38c5, 0x2326, 0x3a7c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x18a4, 0x3f4d, 0x0000, 0x06cc, 0x04f6, 0x3c3a, 0x0000, 0x1208,
+	    0x24ac, 0x0917, 0x46d8, 0x29f6, 0x21d5, 0x136d, 0x11be, 0x0af6,
+	    0x0e5d, 0x45a3, 0x4a90, 0x2776, 0x2f24, 0x3c7d, 0x0cc6, 0x39f4,
+	    0x4629, 0x0798, 0x0000, 0x36f8, 0x42d1, 0x4e14, 0x0000, 0x0000,
+	    0x0000, 0x034f, 0x0000, 0x0000, 0x0000, 0x2021, 0x03d5, 0x0000,
+	    0x35b4, 0x29a8, 0x0000, 0x12a6, 0x25e8, 0x4b7c, 0x43ad, 0x26a6,
+	    0x0000, 0x0eb4, 0x4c9b, 0x40bc, 0x3778, 0x0000, 0x1178, 0x0000,
+	    0x0000, 0x1eb5, 0x46d2, 0x2e92, 0x0000, 0x027e, 0x1565, 0x0000,
+	    0x2859, 0x436b, 0x0000, 0x4773, 0x44a7, 0x0000, 0x3ceb, 0x4bd2,
+	    0x2b11, 0x18e7, 0x0000, 0x0000, 0x3ba9, 0x2632, 0x33de, 0x0000,
+	    0x43a2, 0x0000, 0x0000, 0x2e69, 0x1eab, 0x0000, 0x18f3, 0x49ae,
+	    0x3667, 0x4cc2, 0x210b, 0x3280, 0x39d5, 0x0ac4, 0x082d, 0x2f81,
+	    0x230c, 0x2f7e, 0x2a36, 0x0000, 0x2041, 0x1d1e, 0x15d1, 0x3490,
+	    0x338a, 0x0ac4, 0x41b1, 0x0000, 0x45ca, 0x3171, 0x1ae6, 0x3574,
+	    0x2f55, 0x0000, 0x0151, 0x0000, 0x0000, 0x4498, 0x1fa2, 0x3a3d,
+	    0x0000, 0x49b6, 0x0000, 0x3c84, 0x0f53, 0x123c, 0x1f34, 0x220d,
+	    0x06f3, 0x2a12, 0x37da, 0x45db, 0x269f, 0x3087, 0x2a7c, 0x264d,
+	    0x0cd7, 0x0000, 0x0000, 0x08fa, 0x22ba, 0x3909, 0x0000, 0x4493,
+	    0x0000, 0x0000, 0x063a, 0x27b0, 0x090f, 0x22ba, 0x07a7, 0x0f0e,
+	    0x153a, 0x2211, 0x3ac4, 0x4a5b, 0x1aa5, 0x48dd, 0x3802, 0x40d9,
+	    0x0faa, 0x0000, 0x02a0, 0x1479, 0x18f9, 0x1d44, 0x4c97, 0x2d62,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x29ca, 0x1a90, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x043c, 0x00cf, 0x021a, 0x0000, 0x0a92, 0x00c9,
+	    0x0000, 0x02ec, 0x3a9a, 0x0623, 0x23e3, 0x3cb0, 0x0bf0, 0x3ddf,
+	    0x2989, 0x0000, 0x0b0f, 0x0426, 0x0000, 0x0000, 0x4787, 0x0000,
+	    0x008f, 0x35b6, 0x0000, 0x4b43, 0x25b1, 0x4500, 0x4582, 0x34e1,
+	    0x0000, 0x16d1, 0x0bc9, 0x0000, 0x0a33, 0x2e9c, 0x218a, 0x31d8,
+	    0x4c71, 0x30b4, 0x0000, 0x0df6, 0x0000, 0x436e, 0x3969, 0x0000,
+	    0x0738, 0x0000, 0x2e64, 0x0005, 0x1002, 0x1458, 0x0b70, 0x0b53,
+	    0x0000, 0x2dcf, 0x4956, 0x04a6, 0x4180, 0x139f, 0x2c25, 0x44de,
+	    0x0000, 0x1019, 0x0000, 0x47b3, 0x2ddf, 0x48cb, 0x0000, 0x336b,
+	    0x0000, 0x0000, 0x40b3, 0x31ce, 0x3e08, 0x2f2a, 0x1a39, 0x0000,
+	    0x47c5, 0x0000, 0x4770, 0x0401, 0x2522, 0x337f, 0x2848, 0x14eb,
+	    0x15bd, 0x08d8, 0x0000, 0x0b0e, 0x0000, 0x04c1, 0x1797, 0x1e89,
+	    0x3846, 0x0000, 0x0000, 0x1378, 0x0000, 0x3e2f, 0x0000, 0x3652,
+	    0x0000, 0x2990, 0x423c, 0x0c5b, 0x1802, 0x0000, 0x43a2, 0x1c1a,
+	    0x38d5, 0x3a67, 0x348b, 0x3402, 0x2803, 0x3a13, 0x1588, 0x0000,
+	    0x403b, 0x3045, 0x0000, 0x17e6, 0x23fb, 0x150a, 0x0000, 0x1810,
+	    0x0000, 0x336b, 0x32e9, 0x044e, 0x15b2, 0x0000, 0x3e8f, 0x06d8,
+	    0x0241, 0x3a96, 0x391c, 0x0000, 0x27c6, 0x0448, 0x2d10, 0x4b40,
+	    0x2270, 0x3f86, 0x257d, 0x0000, 0x248b, 0x0000, 0x2db4, 0x0000,
+	    0x0000, 0x0f1b, 0x3b82, 0x0de8, 0x0000, 0x1a1d, 0x0408, 0x40da,
+	    0x0000, 0x1bae, 0x3a92, 0x0000, 0x0789, 0x0242, 0x492a, 0x0000,
+	    0x0a4e, 0x0000, 0x2c1d, 0x4dac, 0x2e0b, 0x0000, 0x0875, 0x198b,
+	    0x47c0, 0x1f0d, 0x215b, 0x2634, 0x36b2, 0x46a2, 0x0000, 0x2a47,
+	    0x4d3c, 0x02b4, 0x3de7, 0x2e40, 0x2bdf, 0x047f, 0x2c99, 0x17ac,
+	    0x1034, 0x2fa0, 0x1e83, 0x4748, 0x0000, 0x23f5, 0x4855, 0x097e,
+	    0x0000, 0x317d, 0x1ffa, 0x307a, 0x3290, 0x0000, 0x0000, 0x1998,
+	    0x0000, 0x0000, 0x1c39, 0x1c21, 0x2a03, 0x3480, 0x4c11, 0x435b,
+	    0x0000, 0x3dd8, 0x0000, 0x0000, 0x05dc, 0x3372, 0x12e9, 0x2a17,
+	    0x2c5a, 0x0781, 0x45ae, 0x4592, 0x0000, 0x3142, 0x0000, 0x0d3d,
+	    0x0d66, 0x1ba9, 0x2297, 0x0000, 0x0000, 0x073d, 0x48c9, 0x1c48,
+	    0x0fb5, 0x3cb1, 0x42c2, 0x0000, 0x40af, 0x15a3, 0x21ae, 0x189c,
+	    0x08d5, 0x43cd, 0x3eec, 0x3427, 0x2a54, 0x2fdf, 0x059c, 0x4a8a,
+	    0x0000, 0x271d, 0x30ad, 0x0000, 0x0055, 0x1c37, 0x0000, 0x1cf1,
+	    0x4aaf, 0x2888, 0x3e3c, 0x1b56, 0x1afc, 0x3bd4, 0x0b5f, 0x0000,
+	    0x0000, 0x4763, 0x1950, 0x107c, 0x1f58, 0x188a, 0x2344, 0x0000,
+	    0x38b1, 0x08e7, 0x0127, 0x0000, 0x26f9, 0x18fd, 0x2ce5, 0x1e86,
+	    0x1c5b, 0x3bcc, 0x334b, 0x2055, 0x1ed5, 0x0000, 0x3b6f, 0x0a32,
+	    0x27a8, 0x2f1c, 0x0602, 0x079c, 0x3bbf, 0x3f6a, 0x465a, 0x4d8b,
+	    0x052f, 0x4aae, 0x0802, 0x28aa, 0x498f, 0x3646, 0x0bd1, 0x44e7,
+	    0x36be, 0x3c4f, 0x0000, 0x064d, 0x22e1, 0x4290, 0x186f, 0x0000,
+	    0x351c, 0x0000, 0x093f, 0x1dc6, 0x0000, 0x3c58, 0x4d43, 0x4288,
+	    0x349d, 0x408a, 0x202c, 0x220d, 0x0000, 0x48ac, 0x3d6d, 0x0000,
+	    0x2778, 0x4a1c, 0x0000, 0x2f5f, 0x0aaa, 0x3eca, 0x2765, 0x0000,
+	    0x0224, 0x0000, 0x2660, 0x3846, 0x4cb3, 0x3540, 0x00ab, 0x0000,
+	    0x33cb, 0x4d48, 0x3b66, 0x0000, 0x2363, 0x4371, 0x0d0b, 0x2011,
+	    0x2c53, 0x1387, 0x0000, 0x201f, 0x2a6f, 0x241e, 0x2cd1, 0x29f8,
+	    0x043b, 0x135f, 0x198e, 0x0000, 0x29b6, 0x0d21, 0x0000, 0x0b8f,
+	    0x0000, 0x139d, 0x19f4, 0x1e26, 0x285f, 0x0000, 0x0a8b, 0x24a5,
+	    0x06b6, 0x0000, 0x0000, 0x0000, 0x1e91, 0x0000, 0x0632, 0x0eec,
+	    0x2d05, 0x4ba7, 0x0000, 0x2eb2, 0x04bf, 0x0000, 0x0000, 0x0495,
+	    0x1936, 0x0988, 0x068c, 0x360e, 0x48bb, 0x40c0, 0x4455, 0x1de8,
+	    0x1263, 0x3a9b, 0x0ced, 0x34f7, 0x3d8b, 0x1ac1, 0x0000, 0x0cc0,
+	    0x0afb, 0x1ab5, 0x4a36, 0x233d, 0x2698, 0x0000, 0x3e45, 0x3776,
+	    0x0000, 0x0b55, 0x0000, 0x1d07, 0x3b42, 0x15bf, 0x3d61, 0x1ce4,
+	    0x46c4, 0x00c0, 0x0f44, 0x3486, 0x38f5, 0x0000, 0x314d, 0x4d81,
+	    0x0000, 0x2cce, 0x0000, 0x44d6, 0x0000, 0x0000, 0x0e2e, 0x264c,
+	    0x0000, 0x04fe, 0x4703, 0x2d39, 0x1dfd, 0x4976, 0x2298, 0x19b6,
+	    0x0000, 0x4b90, 0x0000, 0x1eb1, 0x3bba, 0x2c2f, 0x0000, 0x0000,
+	    0x2a8c, 0x26f0, 0x1cac, 0x4161, 0x3608, 0x0000, 0x02c9, 0x4d08,
+	    0x1cb8, 0x3741, 0x38c0, 0x2eb7, 0x1a56, 0x00d0, 0x14ad, 0x1a33,
+	    0x1d1d, 0x00e6, 0x2e08, 0x49c9, 0x3991, 0x0000, 0x3b68, 0x1b2a,
+	    0x0000, 0x0000, 0x1b48, 0x050e, 0x26d9, 0x0168, 0x0000, 0x0e49,
+	    0x3981, 0x40af, 0x0769, 0x227d, 0x3546, 0x1e8e, 0x18a2, 0x4344,
+	    0x18eb, 0x3932, 0x1349, 0x0000, 0x1dbf, 0x314e, 0x1767, 0x31bf,
+	    0x0aa4, 0x259d, 0x0000, 0x0000, 0x0000, 0x4d03, 0x1f47, 0x0251,
+	    0x0000, 0x2ebe, 0x353e, 0x228e, 0x2c75, 0x03f2, 0x4beb, 0x058f,
+	    0x0000, 0x2ae7, 0x295f, 0x0a07, 0x30b1, 0x14de, 0x0000, 0x06db,
+	    0x0000, 0x0000, 0x243c, 0x0296, 0x3c37, 0x0000, 0x11fa, 0x4c20,
+	    0x3f6a, 0x47ae, 0x3084, 0x0000, 0x1aa7, 0x0000, 0x4c43, 0x0000,
+	    0x3461, 0x296a, 0x1ffd, 0x4d37, 0x3e2a, 0x0000, 0x1da7, 0x0000,
+	    0x0000, 0x3a32, 0x383e, 0x0000, 0x4733, 0x0000, 0x040b, 0x0844,
+	    0x4285, 0x3fae, 0x0000, 0x44f3, 0x39df, 0x4b91, 0x2271, 0x1217,
+	    0x096d, 0x0000, 0x0000, 0x26bf, 0x17f6, 0x3a91, 0x3235, 0x0000,
+	    0x0000, 0x0000, 0x41a3, 0x0474, 0x34be, 0x4005, 0x30e4, 0x182d,
+	    0x0000, 0x431d, 0x42ae, 0x0000, 0x40bd, 0x4b22, 0x05ad, 0x1860,
+	    0x03d4, 0x4350, 0x1be5, 0x0000, 0x06f8, 0x0000, 0x464b, 0x3c50,
+	    0x0915, 0x2970, 0x0dbd, 0x10a8, 0x370d, 0x0e5e, 0x0000, 0x0000,
+	    0x0000, 0x3435, 0x0bb9, 0x07c9, 0x012c, 0x0000, 0x0b66, 0x0000,
+	    0x3ad1, 0x3605, 0x0026, 0x2cd5, 0x0000, 0x0000, 0x0926, 0x0000,
+	    0x3217, 0x0000, 0x4571, 0x08e3, 0x1fdb, 0x19e6, 0x0000, 0x0f77,
+	    0x292e, 0x3fe5, 0x0000, 0x07c5, 0x0000, 0x0000, 0x38e2, 0x0968,
+	    0x0f58, 0x4145, 0x3e96, 0x0096, 0x1a30, 0x2580, 0x0000, 0x1e1a,
+	    0x0000, 0x3234, 0x0fa5, 0x0000, 0x1a93, 0x1d8b, 0x49ba, 0x265f,
+	    0x2606, 0x376b, 0x17e3, 0x0000, 0x277a, 0x269a, 0x0000, 0x4d52,
+	    0x0000, 0x3dab, 0x4e06, 0x0047, 0x3e5b, 0x0dba, 0x2617, 0x054a,
+	    0x35e3, 0x0000, 0x1a3f, 0x12f4, 0x0000, 0x401a, 0x2cc6, 0x0000,
+	    0x3cb6, 0x43f3, 0x2e3f, 0x3d8a, 0x228d, 0x1c0d, 0x1dc4, 0x0000,
+	    0x4843, 0x4d0e, 0x0000, 0x4c59, 0x231c, 0x3f2c, 0x0157, 0x0000,
+	    0x0b89, 0x4139, 0x0dea, 0x011f, 0x23ac, 0x0000, 0x063f, 0x2977,
+	    0x0351, 0x205b, 0x4cd4, 0x1bb1, 0x0000, 0x0b75, 0x0000, 0x2d86,
+	    0x0000, 0x48de, 0x0125, 0x0000, 0x0000, 0x0000, 0x1ae6, 0x1ff7,
+	    0x2409, 0x0435, 0x3e59, 0x1ab5, 0x0000, 0x35cd, 0x312f, 0x0000,
+	    0x3a24, 0x0000, 0x00bf, 0x0000, 0x2889, 0x21d2, 0x3d46, 0x0000,
+	    0x4b83, 0x0ada, 0x1f7b, 0x1fcc, 0x0000, 0x3c52, 0x0000, 0x12f3,
+	    0x0000, 0x383c, 0x0af1, 0x0000, 0x2ed3, 0x0f6e, 0x0aa3, 0x4ae4,
+	    0x068a, 0x0000, 0x09bf, 0x0000, 0x3bf9, 0x0000, 0x0000, 0x4910,
+	    0x0000, 0x2095, 0x1de7, 0x2bb1, 0x34aa, 0x0203, 0x174d, 0x0000,
+	    0x1a80, 0x26b9, 0x0000, 0x42b2, 0x2461, 0x0000, 0x0ba3, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x4638, 0x129b, 0x1252, 0x4374,
+	    0x2b55, 0x4a6e, 0x097c, 0x2ffa, 0x365b, 0x2c38, 0x0000, 0x0000,
+	    0x0000, 0x2154, 0x4605, 0x4d2f, 0x2952, 0x0000, 0x062c, 0x40c6,
+	    0x0000, 0x1fd6, 0x2daa, 0x4353, 0x216c, 0x0000, 0x0000, 0x36c2,
+	    0x0fa7, 0x0000, 0x35c3, 0x322f, 0x11d1, 0x3720, 0x36be, 0x2a6d,
+	    0x3388, 0x4009, 0x4a06, 0x225b, 0x0ddd, 0x425b, 0x2a53, 0x3b40,
+	    0x1606, 0x0fc9, 0x3124, 0x182d, 0x43e7, 0x0000, 0x30ec, 0x2704,
+	    0x1e2b, 0x23f9, 0x2511, 0x039a, 0x07b5, 0x3638, 0x2b17, 0x2605,
+	    0x2fed, 0x11df, 0x0903, 0x15ba, 0x4690, 0x29cd, 0x30d4, 0x22bc,
+	    0x17d5, 0x32d6, 0x096b, 0x0000, 0x2d1f, 0x09b0, 0x17ac, 0x3e4d,
+	    0x0000, 0x0000, 0x06e7, 0x3515, 0x3def, 0x42be, 0x4d66, 0x192d,
+	    0x07c6, 0x0000, 0x2ea9, 0x0000, 0x3ac3, 0x3e99, 0x0c92, 0x0000,
+	    0x14a4, 0x0fa0, 0x1ccc, 0x0000, 0x0d93, 0x0000, 0x12d4, 0x0076,
+	    0x0000, 0x0000, 0x3691, 0x3f39, 0x0000, 0x0000, 0x0000, 0x410c,
+	    0x10a5, 0x0000, 0x0000, 0x3c79, 0x0b36, 0x0563, 0x2772, 0x0000,
+	    0x049d, 0x4b3c, 0x4a5c, 0x3381, 0x37ad, 0x0000, 0x1c8b, 0x0bfa,
+	    0x1568, 0x2311, 0x005d, 0x177b, 0x3761, 0x4c8e, 0x0000, 0x2a98,
+	    0x1446, 0x1344, 0x4e11, 0x15bd, 0x0b3a, 0x001f, 0x3151, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x43e7, 0x0000, 0x25f7, 0x438a, 0x1a0d,
+	    0x274b, 0x04bb, 0x3a57, 0x1a8a, 0x0365, 0x29b0, 0x34ea, 0x4537,
+	    0x04fd, 0x4ca2, 0x0000, 0x0000, 0x4af1, 0x39c9, 0x28e9, 0x093c,
+	    0x4a76, 0x1430, 0x3c66, 0x0000, 0x167a, 0x0000, 0x3bb8, 0x4511,
+	    0x26a3, 0x055f, 0x14cd, 0x0000, 0x3d10, 0x0000, 0x0000, 0x0000,
+	    0x1918, 0x06cd, 0x09dc, 0x0000, 0x0000, 0x0000, 0x4da4, 0x0f23,
+	    0x1ee5, 0x0eb6, 0x17be, 0x1471, 0x158b, 0x2358, 0x20c1, 0x45bd,
+	    0x20d5, 0x01be, 0x24f0, 0x41a3, 0x3db8, 0x447d, 0x454c, 0x214f,
+	    0x0aa1, 0x0574, 0x0000, 0x1f3c, 0x0000, 0x0d98, 0x0000, 0x434d,
+	    0x2586, 0x369b, 0x2dc4, 0x3363, 0x0000, 0x2753, 0x0000, 0x488c,
+	    0x0000, 0x08eb, 0x304d, 0x10ba, 0x1d7e, 0x0000, 0x29b2, 0x4408,
+	    0x4020, 0x0721, 0x02c6, 0x0000, 0x35e5, 0x204b, 0x0000, 0x0000,
+	    0x02ea, 0x4333, 0x4d07, 0x3992, 0x0bc5, 0x093f, 0x1968, 0x421a,
+	    0x40a8, 0x4996, 0x0114, 0x0ce4, 0x4182, 0x0095, 0x0000, 0x1ae8,
+	    0x36c0, 0x0000, 0x2cfe, 0x0d1c, 0x0000, 0x0000, 0x39b1, 0x0000,
+	    0x0000, 0x0000, 0x49e7, 0x07ac, 0x2694, 0x0c93, 0x471e, 0x1c62,
+	    0x0156, 0x04b1, 0x0000, 0x1bf9, 0x18b3, 0x0000, 0x0f61, 0x03f9,
+	    0x4638, 0x1ed0, 0x0766, 0x2084, 0x1f6f, 0x1231, 0x0000, 0x3c10,
+	    0x17ba, 0x38fd, 0x0ee3, 0x0000, 0x3e64, 0x0000, 0x0000, 0x2c5b,
+	    0x374e, 0x0190, 0x3e30, 0x12f7, 0x16bf, 0x0000, 0x0000, 0x34e1,
+	    0x0000, 0x3f40, 0x0add, 0x1309, 0x1b19, 0x46eb, 0x0000, 0x0000,
+	    0x2a5b, 0x0d50, 0x1da5, 0x3f0f, 0x487b, 0x17d1, 0x362f, 0x0000,
+	    0x0000, 0x15dc, 0x13a8, 0x3369, 0x3fdf, 0x1096, 0x0000, 0x3830,
+	    0x0000, 0x4633, 0x0000, 0x0d76, 0x4694, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0183, 0x0a70, 0x1bfb, 0x13de, 0x2427, 0x439c, 0x1c8b,
+	    0x18dc, 0x0000, 0x38dc, 0x18c4, 0x0000, 0x05ab, 0x07b8, 0x25c7,
+	    0x201a, 0x0477, 0x262f, 0x01f0, 0x3a50, 0x0000, 0x3b0e, 0x0000,
+	    0x3a4e, 0x0000, 0x4d18, 0x4d18, 0x1b03, 0x0000, 0x453c, 0x40bf,
+	    0x1e07, 0x0000, 0x09f2, 0x4256, 0x37a1, 0x1259, 0x09a9, 0x482e,
+	    0x3b54, 0x492f, 0x355f, 0x0000, 0x00a8, 0x0bc4, 0x08d5, 0x33e4,
+	    0x1415, 0x1116, 0x3616, 0x0000, 0x12ef, 0x2c1c, 0x3a5c, 0x2f35,
+	    0x18ae, 0x1d2f, 0x0000, 0x0fcc, 0x0fbc, 0x0e6b, 0x4b05, 0x0000,
+	    0x18fe, 0x0000, 0x2642, 0x402b, 0x0000, 0x0000, 0x1d9d, 0x0ab7,
+	    0x11da, 0x141a, 0x0f90, 0x0000, 0x0000, 0x3024, 0x473b, 0x1ed8,
+	    0x4cb8, 0x20eb, 0x4a65, 0x4cbf, 0x0000, 0x2436, 0x2d10, 0x0000,
+	    0x0d3f, 0x0000, 0x18c6, 0x2b73, 0x0254, 0x0000, 0x240a, 0x39c8,
+	    0x361c, 0x11f0, 0x15bc, 0x1878, 0x0000, 0x0ad7, 0x440e, 0x0000,
+	    0x0000, 0x1f95, 0x254c, 0x0000, 0x0000, 0x0000, 0x16ab, 0x1fa8,
+	    0x00e7, 0x3aa5, 0x0146, 0x1ab2, 0x319d, 0x0283, 0x0000, 0x3512,
+	    0x3352, 0x46d2, 0x2544, 0x2fe7, 0x1f93, 0x0c3d, 0x3fdc, 0x0000,
+	    0x0b7e, 0x0000, 0x338c, 0x0000, 0x13ba, 0x05ce, 0x1a5a, 0x2565,
+	    0x3f1c, 0x0000, 0x260e, 0x4a4a, 0x40e8, 0x3990, 0x0000, 0x3c95,
+	    0x0eff, 0x2c7e, 0x4ca4, 0x1ff9, 0x19cc, 0x1728, 0x2d4e, 0x2c70,
+	    0x3dfd, 0x0000, 0x0000, 0x4c4b, 0x1eb7, 0x4440, 0x0000, 0x14c9,
+	    0x0000, 0x3804, 0x10d0, 0x1818, 0x224a, 0x0d9b, 0x1ab8, 0x40c1,
+	    0x0000, 0x0000, 0x486f, 0x23b7, 0x0000, 0x0231, 0x1c3d, 0x12b0,
+	    0x3b5e, 0x0000, 0x0ead, 0x131b, 0x05c5, 0x49a4, 0x46f0, 0x350c,
+	    0x4c46, 0x361d, 0x2a08, 0x0000, 0x297d, 0x263b, 0x1113, 0x1b4f,
+	    0x0284, 0x4bcf, 0x4373, 0x1f2f, 0x0000, 0x0000, 0x0124, 0x4dbf,
+	    0x0fca, 0x0000, 0x1046, 0x23b4, 0x0000, 0x0537, 0x248c, 0x0000,
+	    0x2759, 0x1034, 0x40c9, 0x24da, 0x0000, 0x002b, 0x0000, 0x11ad,
+	    0x174f, 0x154c, 0x0000, 0x321d, 0x0000, 0x004e, 0x265f, 0x0000,
+	    0x0000, 0x1596, 0x2013, 0x0000, 0x3329, 0x3584, 0x4b4c, 0x0000,
+	    0x441f, 0x0000, 0x3b62, 0x3ff5, 0x46ad, 0x07ef, 0x0e1e, 0x0636,
+	    0x0e7c, 0x0b82, 0x3104, 0x0b73, 0x0000, 0x0000, 0x0000, 0x0ea2,
+	    0x3156, 0x2ef2, 0x1454, 0x2a1a, 0x495c, 0x2db8, 0x0000, 0x1db6,
+	    0x28ea, 0x0000, 0x0000, 0x226e, 0x459c, 0x44bc, 0x0000, 0x0000,
+	    0x23c2, 0x0000, 0x0000, 0x255b, 0x0000, 0x04b5, 0x1cf8, 0x1964,
+	    0x06bd, 0x0de1, 0x0000, 0x3313, 0x3a9d, 0x081f, 0x4be9, 0x4367,
+	    0x1f85, 0x44bf, 0x41eb, 0x4a9e, 0x497a, 0x0d94, 0x0670, 0x0000,
+	    0x4936, 0x4266, 0x0000, 0x3c14, 0x481b, 0x1d53, 0x0000, 0x206e,
+	    0x2f33, 0x05d1, 0x3191, 0x0000, 0x2c85, 0x2151, 0x476f, 0x3df8,
+	    0x3852, 0x0000, 0x3dd4, 0x1863, 0x0000, 0x2a41, 0x0000, 0x4b8e,
+	    0x45e3, 0x1ac3, 0x0000, 0x1503, 0x3aec, 0x45ca, 0x463c, 0x4983,
+	    0x2359, 0x268f, 0x3254, 0x45e5, 0x0000, 0x1287, 0x11b9, 0x206d,
+	    0x46fc, 0x4564, 0x0000, 0x3605, 0x08b8, 0x1c29, 0x27fc, 0x0cb0,
+	    0x0000, 0x18ae, 0x008e, 0x2c80, 0x0000, 0x41bc, 0x0000, 0x1c77,
+	    0x2eb6, 0x0000, 0x0a04, 0x3c7d, 0x27a7, 0x01e5, 0x0aa4, 0x0000,
+	    0x22c3, 0x3ae4, 0x18ae, 0x0f29, 0x2ca7, 0x2c2c, 0x4327, 0x1db8,
+	    0x1aa1, 0x2bba, 0x3681, 0x0000, 0x3d96, 0x1c59, 0x0000, 0x0cb8,
+	    0x1000, 0x1645, 0x0265, 0x0f15, 0x3c85, 0x097f, 0x0849, 0x0000,
+	    0x31be, 0x21bb, 0x2fdb, 0x38c2, 0x171d, 0x3510, 0x16a1, 0x09b1,
+	    0x4921, 0x0000, 0x4458, 0x0000, 0x1059, 0x02b3, 0x465f, 0x3d42,
+	    0x18e1, 0x0ae1, 0x4442, 0x2785, 0x437f, 0x0b50, 0x277e, 0x2d19,
+	    0x126b, 0x0000, 0x121d, 0x475d, 0x3985, 0x2cfe, 0x0699, 0x3f27,
+	    0x1597, 0x4347, 0x26cf, 0x2ad7, 0x0000, 0x32d2, 0x303c, 0x0dab,
+	    0x2a55, 0x0000, 0x0000, 0x1174, 0x0000, 0x3068, 0x0000, 0x3fdc,
+	    0x0002, 0x032b, 0x08a6, 0x3442, 0x12b7, 0x0f55, 0x2b1d, 0x0000,
+	    0x0ab3, 0x2f20, 0x232f, 0x2d9a, 0x4b59, 0x0000, 0x3ef5, 0x0000,
+	    0x0000, 0x034a, 0x3029, 0x2a05, 0x20d7, 0x0000, 0x4734, 0x0bab,
+	    0x029f, 0x08bc, 0x1a57, 0x26b6, 0x43ca, 0x3198, 0x41e0, 0x1982,
+	    0x0000, 0x0000, 0x0942, 0x4a04, 0x0000, 0x0e73, 0x2c0d, 0x0000,
+	    0x4b60, 0x2766, 0x3cf7, 0x388a, 0x0b0b, 0x2c4f, 0x1220, 0x0000,
+	    0x2735, 0x3ce0, 0x0000, 0x174d, 0x0b9e, 0x3058, 0x318d, 0x0000,
+	    0x2150, 0x2d54, 0x09ca, 0x21da, 0x497e, 0x0000, 0x3df4, 0x21cb,
+	    0x13cf, 0x11e6, 0x0000, 0x290f, 0x2243, 0x4036, 0x24d0, 0x3cf5,
+	    0x2734, 0x0000, 0x0d23, 0x1fa9, 0x3048, 0x2d8a, 0x0000, 0x1903,
+	    0x38af, 0x434d, 0x4e13, 0x244f, 0x319d, 0x4229, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0d2f, 0x0255, 0x0000, 0x1a31, 0x0266, 0x0c9a,
+	    0x0000, 0x2676, 0x0000, 0x01d4, 0x2957, 0x3624, 0x1cde, 0x3eaf,
+	    0x2ad4, 0x3dad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c3b,
+	    0x1b22, 0x3e60, 0x08dc, 0x2015, 0x0000, 0x35f8, 0x1309, 0x0000,
+	    0x4a23, 0x0256, 0x463a, 0x0000, 0x0000, 0x4a84, 0x1836, 0x4c92,
+	    0x4277, 0x2ad9, 0x0000, 0x3d4e, 0x077a, 0x0000, 0x24f0, 0x2920,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0768, 0x26e1, 0x3940, 0x2453,
+	    0x28a9, 0x000a, 0x27c4, 0x41ba, 0x1e40, 0x0000, 0x0a51, 0x2656,
+	    0x3726, 0x2041, 0x133f, 0x0000, 0x3b3f, 0x2e7f, 0x3755, 0x116a,
+	    0x1853, 0x0000, 0x0000, 0x3271, 0x0000, 0x0b72, 0x0000, 0x0000,
+	    0x020b, 0x24f1, 0x0000, 0x3e93, 0x1d09, 0x1c4a, 0x0017, 0x0000,
+	    0x4cb6, 0x4aed, 0x10bc, 0x0000, 0x09c6, 0x0e01, 0x0000, 0x24e3,
+	    0x36aa, 0x17ce, 0x0000, 0x43c1, 0x115e, 0x0b21, 0x45d4, 0x0620,
+	    0x3296, 0x0000, 0x0000, 0x09d5, 0x39a0, 0x03fb, 0x4cd5, 0x0802,
+	    0x24fd, 0x281b, 0x0168, 0x2516, 0x2b22, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2cfa, 0x16e2, 0x3df0, 0x0000, 0x0000, 0x2e9d, 0x3279,
+	    0x0201, 0x1bb9, 0x1a74, 0x4611, 0x0000, 0x3d43, 0x1844, 0x0000,
+	    0x42c8, 0x18d6, 0x13b9, 0x1a0b, 0x3692, 0x0de3, 0x03c1, 0x3ffa,
+	    0x35c4, 0x0000, 0x4677, 0x0725, 0x1113, 0x47f7, 0x26b1, 0x0000,
+	    0x2b35, 0x1fea, 0x2164, 0x3ffb, 0x0000, 0x0000, 0x0000, 0x1b54,
+	    0x3115, 0x0acd, 0x3e98, 0x0000, 0x3824, 0x4954, 0x0ffe, 0x4d3d,
+	    0x10c0, 0x3722, 0x392f, 0x0b98, 0x155a, 0x02ea, 0x0aa3, 0x0000,
+	    0x0000, 0x3d26, 0x4d97, 0x01ea, 0x3b06, 0x1f57, 0x0000, 0x3d53,
+	    0x276a, 0x481f, 0x06c9, 0x2bcc, 0x30cd, 0x0000, 0x08ac, 0x2637,
+	    0x2ccc, 0x0000, 0x1bb5, 0x243a, 0x0498, 0x0000, 0x3656, 0x0000,
+	    0x1b90, 0x23a8, 0x0000, 0x1496, 0x0881, 0x009c, 0x3cef, 0x2718,
+	    0x0000, 0x39b6, 0x289b, 0x2a6d, 0x0000, 0x42ab, 0x0000, 0x0000,
+	    0x0ad4, 0x4257, 0x44f4, 0x19a7, 0x0845, 0x0000, 0x0d89, 0x4dc4,
+	    0x0000, 0x43b5, 0x11ce, 0x277e, 0x0c0c, 0x1bd7, 0x4c64, 0x0000,
+	    0x0414, 0x0204, 0x21ab, 0x2aa8, 0x125e, 0x2da3, 0x10ed, 0x4deb,
+	    0x35d0, 0x4ad9, 0x3373, 0x0efd, 0x4b8b, 0x1651, 0x2683, 0x158a,
+	    0x041b, 0x06d7, 0x20e6, 0x18db, 0x1037, 0x0000, 0x0840, 0x0000,
+	    0x218e, 0x2d0f, 0x1984, 0x4566, 0x1c0a, 0x0000, 0x0000, 0x105b,
+	    0x35b8, 0x2e14, 0x21ca, 0x271e, 0x4514, 0x360e, 0x42c3, 0x438a,
+	    0x0000, 0x1ea1, 0x3888, 0x0999, 0x0000, 0x0000, 0x31a3, 0x0000,
+	    0x0000, 0x209c, 0x3e5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0ef4, 0x0000, 0x0000, 0x0000, 0x3468, 0x1661, 0x390f, 0x0000,
+	    0x4538, 0x0000, 0x0d36, 0x0000, 0x13d6, 0x0000, 0x0000, 0x36f9,
+	    0x0000, 0x1d8e, 0x145f, 0x377d, 0x3e38, 0x0ae4, 0x3160, 0x0000,
+	    0x429c, 0x4453, 0x134f, 0x4d0b, 0x3280, 0x39f6, 0x4102, 0x2f81,
+	    0x0000, 0x063d, 0x2fc1, 0x2f6a, 0x0000, 0x259f, 0x174a, 0x0000,
+	    0x0000, 0x05a0, 0x0000, 0x0000, 0x098d, 0x3b3b, 0x0000, 0x3a27,
+	    0x1c29, 0x1490, 0x21de, 0x0000, 0x4a0b, 0x4203, 0x0000, 0x0000,
+	    0x3d05, 0x1c6c, 0x4af4, 0x0000, 0x1dcf, 0x25a2, 0x0000, 0x472b,
+	    0x0000, 0x0000, 0x1b99, 0x0101, 0x3f83, 0x274d, 0x399e, 0x26ec,
+	    0x1a88, 0x3d46, 0x1090, 0x4753, 0x381d, 0x0000, 0x17bd, 0x3681,
+	    0x4445, 0x0440, 0x154e, 0x3ecd, 0x48f7, 0x380c, 0x4cc2, 0x2ca4,
+	    0x0783, 0x0b9d, 0x3f54, 0x0eec, 0x0000, 0x21f7, 0x29f4, 0x3393,
+	    0x0ef3, 0x0000, 0x04aa, 0x0000, 0x0000, 0x30d0, 0x4374, 0x1823,
+	    0x0000, 0x027d, 0x0563, 0x196d, 0x0a22, 0x243c, 0x3632, 0x435f,
+	    0x3910, 0x0dbb, 0x0000, 0x1fcf, 0x25ee, 0x0300, 0x1a54, 0x33fd,
+	    0x4783, 0x1c06, 0x33d4, 0x43a0, 0x4ce3, 0x0000, 0x3b83, 0x0000,
+	    0x1fe9, 0x1d6f, 0x01c0, 0x0000, 0x0e4c, 0x45dd, 0x0000, 0x0948,
+	    0x399a, 0x463b, 0x27a9, 0x0000, 0x0000, 0x0000, 0x33f0, 0x1358,
+	    0x1c23, 0x0000, 0x1c92, 0x12bc, 0x0000, 0x0000, 0x09c6, 0x2d91,
+	    0x0000, 0x168c, 0x3fe5, 0x3dec, 0x0000, 0x0000, 0x0000, 0x2f1f,
+	    0x389e, 0x0000, 0x38dc, 0x1242, 0x31b0, 0x0000, 0x3b86, 0x0000,
+	    0x0f8e, 0x479e, 0x03bf, 0x3157, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4021, 0x0876, 0x2964, 0x0000, 0x2352, 0x4a81, 0x289b,
+	    0x2fa4, 0x4b64, 0x0000, 0x4c8a, 0x0689, 0x4475, 0x3394, 0x24c3,
+	    0x00c3, 0x0000, 0x1bb3, 0x0000, 0x162e, 0x0000, 0x3eb2, 0x3a4c,
+	    0x13ff, 0x256a, 0x0000, 0x0f7a, 0x1d41, 0x27df, 0x0000, 0x1717,
+	    0x0000, 0x35f0, 0x4bc9, 0x25d0, 0x1b48, 0x0000, 0x0740, 0x37dc,
+	    0x4124, 0x1e9c, 0x1b30, 0x451e, 0x15c5, 0x0706, 0x0000, 0x0fee,
+	    0x2313, 0x0000, 0x0000, 0x0000, 0x2e45, 0x0000, 0x0000, 0x42e4,
+	    0x0c23, 0x3511, 0x1291, 0x26b9, 0x0df6, 0x3ea5, 0x34da, 0x143e,
+	    0x36cd, 0x09a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x422f, 0x0000,
+	    0x1c80, 0x25f1, 0x299a, 0x3725, 0x1052, 0x4332, 0x0000, 0x37d8,
+	    0x454d, 0x0000, 0x29a8, 0x36a9, 0x1e04, 0x10f9, 0x0000, 0x00c9,
+	    0x1f91, 0x0000, 0x1b1f, 0x3ce6, 0x49ad, 0x0e8f, 0x3e1e, 0x2bdf,
+	    0x195c, 0x0000, 0x3878, 0x1317, 0x0000, 0x1bb0, 0x0000, 0x0000,
+	    0x48ae, 0x0385, 0x190f, 0x0000, 0x0000, 0x4095, 0x3baa, 0x0000,
+	    0x1cba, 0x3830, 0x0000, 0x0000, 0x18b0, 0x41d6, 0x4dc0, 0x30cf,
+	    0x0000, 0x1143, 0x1fc8, 0x0000, 0x12bb, 0x4143, 0x0000, 0x150a,
+	    0x0000, 0x41f9, 0x398e, 0x3d50, 0x2fd5, 0x279e, 0x03d7, 0x0905,
+	    0x0000, 0x07bd, 0x43c3, 0x25e8, 0x493a, 0x2788, 0x4cdc, 0x379a,
+	    0x39d6, 0x0000, 0x0f62, 0x49fe, 0x340a, 0x1542, 0x3bf3, 0x0602,
+	    0x3ca4, 0x34a7, 0x358e, 0x19d5, 0x4adf, 0x184b, 0x0000, 0x35df,
+	    0x4bc5, 0x42f4, 0x0000, 0x041e, 0x175e, 0x0bd4, 0x1c37, 0x1121,
+	    0x058e, 0x4c2e, 0x0000, 0x0000, 0x0548, 0x4949, 0x0000, 0x3190,
+	    0x0000, 0x353b, 0x0fd2, 0x1038, 0x3b2e, 0x0000, 0x3f17, 0x1e2c,
+	    0x0a88, 0x0c74, 0x2cb8, 0x44ce, 0x0000, 0x08e0, 0x215a, 0x0000,
+	    0x0000, 0x05af, 0x1904, 0x212e, 0x0102, 0x4c22, 0x05fe, 0x4989,
+	    0x37ee, 0x0524, 0x0000, 0x1aab, 0x4153, 0x4df4, 0x2d57, 0x0000,
+	    0x0000, 0x0000, 0x2835, 0x005a, 0x0000, 0x0000, 0x0000, 0x2daa,
+	    0x0000, 0x0000, 0x1014, 0x4d2d, 0x290b, 0x0de8, 0x118a, 0x4b36,
+	    0x161a, 0x302e, 0x23f8, 0x0000, 0x0000, 0x36d9, 0x1963, 0x1a2a,
+	    0x0c0f, 0x0000, 0x4751, 0x48b0, 0x0000, 0x4647, 0x1778, 0x1341,
+	    0x0000, 0x25d5, 0x1e58, 0x0000, 0x0000, 0x1601, 0x281d, 0x0000,
+	    0x0000, 0x0000, 0x24ce, 0x0000, 0x1734, 0x1e65, 0x346f, 0x2507,
+	    0x1be3, 0x3285, 0x49bc, 0x0000, 0x0000, 0x1601, 0x40ea, 0x0e52,
+	    0x1ebf, 0x4496, 0x0000, 0x443c, 0x3df9, 0x26e5, 0x4cc9, 0x060c,
+	    0x492b, 0x2964, 0x3218, 0x1a7a, 0x339e, 0x1354, 0x0000, 0x2149,
+	    0x0000, 0x2f78, 0x0000, 0x0acc, 0x0000, 0x0878, 0x4a18, 0x4ae7,
+	    0x1cfb, 0x2ca2, 0x14b4, 0x2bb8, 0x491d, 0x4815, 0x0000, 0x3bea,
+	    0x09fe, 0x1d18, 0x38a4, 0x2d87, 0x15e1, 0x0000, 0x3719, 0x3565,
+	    0x2dd3, 0x47f1, 0x0000, 0x0da7, 0x4d4a, 0x0000, 0x0000, 0x0000,
+	    0x0a37, 0x36e5, 0x0000, 0x15e3, 0x46fc, 0x1fac, 0x0000, 0x0000,
+	    0x2265, 0x2886, 0x1044, 0x4b74, 0x1e84, 0x03e3, 0x0000, 0x44f3,
+	    0x0000, 0x1e3b, 0x2667, 0x0487, 0x06db, 0x0000, 0x200f, 0x3d10,
+	    0x4704, 0x3e5f, 0x0ac7, 0x3daf, 0x1cd8, 0x0000, 0x0000, 0x3661,
+	    0x1aa5, 0x42af, 0x0943, 0x4248, 0x0000, 0x1581, 0x1d01, 0x020c,
+	    0x43c9, 0x0e7f, 0x1d00, 0x4d35, 0x3868, 0x0000, 0x0000, 0x0000,
+	    0x175f, 0x0000, 0x2a3b, 0x0000, 0x4c2b, 0x0000, 0x0000, 0x3e36,
+	    0x38b3, 0x0da1, 0x0000, 0x39c4, 0x12f4, 0x1be7, 0x48f6, 0x0000,
+	    0x2e33, 0x2536, 0x0b71, 0x1dcf, 0x4d60, 0x2f0b, 0x0000, 0x1ac4,
+	    0x288a, 0x1a17, 0x237c, 0x0000, 0x1518, 0x1fc4, 0x4b51, 0x4220,
+	    0x464d, 0x0000, 0x332b, 0x0000, 0x4b8d, 0x0000, 0x4bad, 0x197f,
+	    0x3ec4, 0x0000, 0x2828, 0x4a89, 0x4cd9, 0x384c, 0x2421, 0x40fa,
+	    0x2275, 0x4ad1, 0x0000, 0x4cfe, 0x2a1f, 0x0abf, 0x2df1, 0x3c0b,
+	    0x0000, 0x0030, 0x0000, 0x125a, 0x0000, 0x11b3, 0x1020, 0x0e5c,
+	    0x28d3, 0x38c3, 0x37ac, 0x0c51, 0x17b3, 0x08db, 0x22b9, 0x2d5a,
+	    0x07b0, 0x0000, 0x0000, 0x1653, 0x0000, 0x4abf, 0x0000, 0x1ea1,
+	    0x4d46, 0x0000, 0x2013, 0x2840, 0x13bb, 0x29f6, 0x2252, 0x215e,
+	    0x4ddb, 0x099c, 0x15d2, 0x0000, 0x415e, 0x117f, 0x1452, 0x0000,
+	    0x0daa, 0x0000, 0x15d8, 0x4b1f, 0x11b8, 0x285b, 0x0473, 0x259e,
+	    0x0f8d, 0x47cf, 0x30a5, 0x2fd5, 0x0a59, 0x05d2, 0x1dc4, 0x4961,
+	    0x45a9, 0x3bd4, 0x0000, 0x4ded, 0x4853, 0x15aa, 0x0740, 0x2b65,
+	    0x0000, 0x380f, 0x0e75, 0x42d0, 0x0000, 0x1716, 0x0000, 0x3fe8,
+	    0x26ad, 0x4094, 0x0e06, 0x0000, 0x2bfd, 0x141e, 0x0000, 0x0000,
+	    0x1bf5, 0x3e42, 0x35aa, 0x3d0b, 0x153f, 0x0000, 0x0000, 0x0000,
+	    0x4637, 0x0c77, 0x0e00, 0x3d8e, 0x4d1c, 0x0930, 0x292b, 0x0f42,
+	    0x4538, 0x2954, 0x0000, 0x41bb, 0x3d93, 0x0000, 0x2eff, 0x359f,
+	    0x49f6, 0x14ad, 0x46dd, 0x40ce, 0x1c5a, 0x11e5, 0x0000, 0x3580,
+	    0x2733, 0x4b1f, 0x0000, 0x0000, 0x0633, 0x3ce3, 0x0f7a, 0x3da0,
+	    0x0000, 0x1ba7, 0x0000, 0x3dfd, 0x43c3, 0x2711, 0x4acb, 0x0cdd,
+	    0x0000, 0x29b4, 0x160e, 0x375d, 0x2fe9, 0x0000, 0x36cb, 0x3638,
+	    0x1df2, 0x0000, 0x3756, 0x0000, 0x3bc0, 0x30ba, 0x4b89, 0x01e1,
+	    0x345a, 0x0000, 0x43c7, 0x370b, 0x2cb3, 0x1520, 0x270c, 0x198b,
+	    0x37ef, 0x0000, 0x2a3a, 0x4a50, 0x00cc, 0x0000, 0x0272, 0x2a68,
+	    0x0b3c, 0x2165, 0x377f, 0x0000, 0x4c00, 0x0000, 0x1e1d, 0x4836,
+	    0x0000, 0x0000, 0x2d9f, 0x01f2, 0x30ac, 0x199b, 0x3af3, 0x0622,
+	    0x1418, 0x0ba6, 0x0729, 0x0000, 0x41b7, 0x41d6, 0x0000, 0x471b,
+	    0x30c9, 0x4740, 0x48aa, 0x3cb5, 0x0000, 0x13ad, 0x0000, 0x4b57,
+	    0x0642, 0x33c0, 0x3aeb, 0x0000, 0x1b0c, 0x1a17, 0x0000, 0x2649,
+	    0x4cad, 0x14a7, 0x3465, 0x1633, 0x0000, 0x2a09, 0x1636, 0x38f6,
+	    0x4d51, 0x2c53, 0x0000, 0x1391, 0x0133, 0x235d, 0x0deb, 0x00f1,
+	    0x1462, 0x0000, 0x0000, 0x016f, 0x26c5, 0x4647, 0x3e79, 0x1b4a,
+	    0x0000, 0x0000, 0x301b, 0x33b1, 0x238f, 0x0000, 0x2a08, 0x42c1,
+	    0x111b, 0x1624, 0x2f0a, 0x19fd, 0x3510, 0x058b, 0x2202, 0x428a,
+	    0x2fe4, 0x0000, 0x2a4d, 0x0000, 0x1eec, 0x4a17, 0x4bb1, 0x0e99,
+	    0x476d, 0x0000, 0x279f, 0x35fa, 0x0269, 0x45c7, 0x1277, 0x1b55,
+	    0x0000, 0x028a, 0x1438, 0x0000, 0x28a6, 0x2522, 0x1419, 0x0000,
+	    0x2b76, 0x17af, 0x3efa, 0x0000, 0x4bb5, 0x4d7f, 0x0000, 0x1cd4,
+	    0x0000, 0x087a, 0x0000, 0x1df5, 0x3ed8, 0x0000, 0x0000, 0x441f,
+	    0x0414, 0x0000, 0x041d, 0x17ad, 0x4c22, 0x215d, 0x2a94, 0x179a,
+	    0x0bb1, 0x0d04, 0x0000, 0x320d, 0x49df, 0x3e39, 0x43ca, 0x4a8f,
+	    0x153b, 0x3a2b, 0x4544, 0x33a9, 0x0000, 0x4b5a, 0x0000, 0x0000,
+	    0x038a, 0x419c, 0x0857, 0x41c1, 0x336a, 0x400b, 0x39ce, 0x312b,
+	    0x39d0, 0x3344, 0x10b7, 0x0aba, 0x0000, 0x3924, 0x0828, 0x2da7,
+	    0x1e9c, 0x0000, 0x00c7, 0x287d, 0x19f1, 0x0c09, 0x0000, 0x120a,
+	    0x0000, 0x42ae, 0x0000, 0x3109, 0x1daa, 0x262f, 0x355e, 0x0000,
+	    0x467d, 0x0b4e, 0x10b8, 0x1e88, 0x033d, 0x2108, 0x0000, 0x0e37,
+	    0x0000, 0x4cb7, 0x2e39, 0x3038, 0x3a25, 0x4009, 0x0896, 0x22d4,
+	    0x4b5f, 0x1987, 0x1216, 0x0097, 0x0000, 0x0000, 0x0b52, 0x21cf,
+	    0x0000, 0x0000, 0x0000, 0x4d06, 0x0000, 0x0f79, 0x4b0b, 0x4aea,
+	    0x4468, 0x052e, 0x0ec7, 0x0000, 0x07ee, 0x0000, 0x088a, 0x4164,
+	    0x0000, 0x3c2d, 0x4c71, 0x0198, 0x485f, 0x0c97, 0x0000, 0x01d2,
+	    0x3f35, 0x17fd, 0x3daa, 0x05fd, 0x229a, 0x2d6e, 0x0000, 0x2075,
+	    0x0000, 0x14fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x426c, 0x1cad,
+	    0x2e89, 0x460b, 0x1f38, 0x3ae7, 0x14e1, 0x0000, 0x431e, 0x4462,
+	    0x106c, 0x143b, 0x055c, 0x0000, 0x3ffc, 0x38ad, 0x44b0, 0x3917,
+	    0x2369, 0x0000, 0x29f5, 0x1f6e, 0x0000, 0x2055, 0x1156, 0x438f,
+	    0x41f6, 0x0000, 0x4058, 0x2734, 0x01a4, 0x3fc4, 0x0000, 0x2d5a,
+	    0x4ae2, 0x0333, 0x0000, 0x0000, 0x0000, 0x0000, 0x256a, 0x3b73,
+	    0x44cf, 0x0016, 0x20f9, 0x3c29, 0x2098, 0x1080, 0x3519, 0x0000,
+	    0x48a5, 0x4387, 0x1b70, 0x1f3e, 0x0000, 0x018d, 0x4d67, 0x1704,
+	    0x0000, 0x0000, 0x0000, 0x3820, 0x422c, 0x0000, 0x4aaf, 0x0000,
+	    0x371d, 0x4b2e, 0x26b7, 0x0046, 0x3112, 0x0000, 0x40b3, 0x4019,
+	    0x2805, 0x382d, 0x0000, 0x3477, 0x475e, 0x0000, 0x45b8, 0x495b,
+	    0x210d, 0x0000, 0x47f1, 0x2c78, 0x0000, 0x350f, 0x404c, 0x3408,
+	    0x3f3e, 0x0918, 0x1bf9, 0x0000, 0x1c76, 0x1a8e, 0x14dd, 0x37be,
+	    0x4c9f, 0x23f8, 0x0000, 0x2ef1, 0x48d8, 0x12fc, 0x1ad0, 0x0000,
+	    0x0000, 0x1730, 0x0b01, 0x1c7b, 0x29cc, 0x010d, 0x397a, 0x0454,
+	    0x0000, 0x0000, 0x1785, 0x0000, 0x022e, 0x18a7, 0x07cc, 0x2f1d,
+	    0x0000, 0x0ea7, 0x4650, 0x1c95, 0x405f, 0x3fcc, 0x436a, 0x08b1,
+	    0x0bdc, 0x06f2, 0x3c87, 0x21cf, 0x4ba8, 0x1efc, 0x0d48, 0x1e53,
+	    0x0000, 0x12d1, 0x11ca, 0x4695, 0x3c3b, 0x2882, 0x02a1, 0x2033,
+	    0x0566, 0x1293, 0x0000, 0x1573, 0x1d3a, 0x3c2f, 0x046c, 0x4a38,
+	    0x46d5, 0x387f, 0x0000, 0x0565, 0x4c77, 0x0000, 0x1c85, 0x1316,
+	    0x0000, 0x1ee0, 0x0000, 0x2c60, 0x0573, 0x4896, 0x3d1e, 0x44db,
+	    0x4210, 0x0888, 0x4175, 0x10ab, 0x4484, 0x0238, 0x1980, 0x4b08,
+	    0x3560, 0x0000, 0x1aa4, 0x0000, 0x4c2c, 0x13b8, 0x257b, 0x4af2,
+	    0x3ed6, 0x2eb7, 0x0000, 0x0616, 0x0000, 0x0000, 0x0f76, 0x2f33,
+	    0x0000, 0x057a, 0x2fc4, 0x0000, 0x0000, 0x4347, 0x2134, 0x1b2d,
+	    0x109b, 0x3261, 0x16fe, 0x203a, 0x2ce5, 0x24f8, 0x0316, 0x2030,
+	    0x3598, 0x3cc2, 0x0000, 0x1314, 0x0000, 0x0bcd, 0x361e, 0x05a0,
+	    0x0000, 0x0000, 0x07ac, 0x247e, 0x41b3, 0x4b65, 0x16c1, 0x4138,
+	    0x0000, 0x476a, 0x1a85, 0x30f1, 0x0d01, 0x430f, 0x4bb2, 0x0000,
+	    0x359f, 0x1790, 0x2690, 0x1cbb, 0x23f4, 0x1414, 0x32b2, 0x2d29,
+	    0x00f3, 0x4782, 0x2cfd, 0x43da, 0x12bd, 0x14dc, 0x331f, 0x0000,
+	    0x2841, 0x4be8, 0x4082, 0x3d5f, 0x122c, 0x4827, 0x08f8, 0x130c,
+	    0x1c23, 0x4a5a, 0x48c7, 0x2e1c, 0x15d0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x29a1, 0x0000, 0x2412, 0x09a8, 0x15c1, 0x0000, 0x35d0,
+	    0x35bb, 0x273a, 0x0000, 0x0791, 0x1acc, 0x0000, 0x1af7, 0x4339,
+	    0x0d7a, 0x2b15, 0x03d8, 0x3494, 0x0000, 0x2cb6, 0x1fc0, 0x128f,
+	    0x154b, 0x0000, 0x01aa, 0x0f3f, 0x2359, 0x4b8a, 0x21c3, 0x0000,
+	    0x4077, 0x196f, 0x2fda, 0x0000, 0x41cf, 0x2b29, 0x0000, 0x1878,
+	    0x0466, 0x4d36, 0x1d15, 0x0000, 0x1555, 0x0000, 0x0ce9, 0x0000,
+	    0x0000, 0x0000, 0x3ec9, 0x0000, 0x0c29, 0x16c1, 0x34ee, 0x2952,
+	    0x3517, 0x090f, 0x35f4, 0x1efc, 0x0000, 0x32d8, 0x0000, 0x066e,
+	    0x2e39, 0x32e9, 0x3a59, 0x3ff2, 0x0000, 0x48fd, 0x0000, 0x28d5,
+	    0x43c9, 0x1c45, 0x0d60, 0x0ecd, 0x4a94, 0x0ce8, 0x045c, 0x0000,
+	    0x0000, 0x17d4, 0x2cc9, 0x0000, 0x48ee, 0x105f, 0x0000, 0x47c3,
+	    0x446d, 0x3cb3, 0x0000, 0x0000, 0x2e79, 0x2617, 0x16d7, 0x00a3,
+	    0x0a54, 0x0000, 0x4ac0, 0x153c, 0x2dd9, 0x1b21, 0x0000, 0x23ae,
+	    0x2c1e, 0x41d1, 0x4533, 0x0000, 0x1556, 0x0000, 0x0201, 0x06de,
+	    0x3caa, 0x4913, 0x0000, 0x03f5, 0x25d8, 0x01ce, 0x42e4, 0x0000,
+	    0x2f49, 0x24b9, 0x2423, 0x0e37, 0x13e3, 0x4d0f, 0x2af4, 0x372d,
+	    0x0000, 0x025b, 0x271a, 0x414f, 0x1ffb, 0x4476, 0x0456, 0x0110,
+	    0x2dd1, 0x06f0, 0x0000, 0x2d7a, 0x0000, 0x0000, 0x20df, 0x0000,
+	    0x43b5, 0x3535, 0x3585, 0x4a00, 0x09b8, 0x2fb9, 0x3035, 0x0000,
+	    0x341f, 0x1c72, 0x0000, 0x30e9, 0x14de, 0x2b28, 0x0000, 0x1b45,
+	    0x3f5b, 0x1a42, 0x102f, 0x3b02, 0x28db, 0x0000, 0x17e1, 0x0000,
+	    0x0000, 0x3a8a, 0x0000, 0x17ff, 0x4462, 0x3b81, 0x01b5, 0x078b,
+	    0x0106, 0x0fa2, 0x4b62, 0x0c24, 0x40e6, 0x0000, 0x2c74, 0x2837,
+	    0x1d25, 0x0433, 0x032c, 0x0000, 0x0000, 0x0cb8, 0x1259, 0x3213,
+	    0x0985, 0x0000, 0x4110, 0x08ec, 0x2cd3, 0x0d36, 0x47a1, 0x0000,
+	    0x48ed, 0x3180, 0x1cf8, 0x28a8, 0x317a, 0x3fee, 0x09fc, 0x3cfa,
+	    0x0000, 0x3a93, 0x2ac5, 0x2861, 0x38be, 0x0000, 0x01d4, 0x0cf2,
+	    0x1588, 0x4233, 0x3f19, 0x0a13, 0x4d5b, 0x4dae, 0x4a5f, 0x09ee,
+	    0x0000, 0x08a4, 0x05e1, 0x0be8, 0x346f, 0x2488, 0x0000, 0x1885,
+	    0x3938, 0x2a9c, 0x42f2, 0x1d31, 0x13db, 0x0000, 0x0000, 0x4821,
+	    0x0069, 0x27e3, 0x0000, 0x1537, 0x4422, 0x1721, 0x44cc, 0x097a,
+	    0x0000, 0x0000, 0x040c, 0x196f, 0x1432, 0x1f9d, 0x2b29, 0x0000,
+	    0x43af, 0x2a5e, 0x0000, 0x36b8, 0x2b73, 0x0000, 0x4a8d, 0x1181,
+	    0x1a71, 0x0000, 0x0000, 0x0000, 0x32a9, 0x0000, 0x42a1, 0x0fa9,
+	    0x1cf5, 0x218e, 0x2c7d, 0x0ae4, 0x0000, 0x116f, 0x2b55, 0x3111,
+	    0x4bb2, 0x2955, 0x3424, 0x22c4, 0x0000, 0x295c, 0x3e24, 0x251e,
+	    0x2b67, 0x0000, 0x0dcd, 0x0000, 0x123a, 0x1408, 0x0000, 0x1744,
+	    0x275a, 0x2bb7, 0x29ad, 0x25ae, 0x23ef, 0x4a6a, 0x1ab3, 0x3e0c,
+	    0x47a6, 0x083a, 0x323d, 0x0000, 0x0000, 0x0000, 0x04fe, 0x1519,
+	    0x15e1, 0x1487, 0x2791, 0x0000, 0x0f0c, 0x3870, 0x29a6, 0x0000,
+	    0x2e81, 0x3568, 0x0000, 0x0000, 0x4691, 0x1151, 0x0000, 0x0000,
+	    0x0714, 0x0945, 0x0000, 0x293e, 0x30e2, 0x060c, 0x45be, 0x0000,
+	    0x4974, 0x2179, 0x0000, 0x03de, 0x4c0e, 0x0c68, 0x0000, 0x4c28,
+	    0x1da2, 0x0000, 0x4952, 0x2fbf, 0x0000, 0x2fea, 0x0b2d, 0x178d,
+	    0x0000, 0x3f07, 0x0000, 0x4148, 0x0000, 0x4c1e, 0x2610, 0x0000,
+	    0x028a, 0x249b, 0x4905, 0x2814, 0x0000, 0x0000, 0x015f, 0x0000,
+	    0x046e, 0x275a, 0x0ffb, 0x365c, 0x47a6, 0x0000, 0x23a3, 0x0672,
+	    0x1d4b, 0x07e0, 0x0e45, 0x25d3, 0x0a89, 0x19d0, 0x3a95, 0x29f6,
+	    0x280d, 0x0000, 0x36eb, 0x1095, 0x09ff, 0x0b66, 0x0594, 0x2f5c,
+	    0x0000, 0x2f5c, 0x0000, 0x30f7, 0x0dd7, 0x42b2, 0x2ac6, 0x085d,
+	    0x0000, 0x1e0b, 0x4cb0, 0x0065, 0x4249, 0x0605, 0x4320, 0x3bd5,
+	    0x06e7, 0x4abc, 0x0000, 0x0000, 0x3cd4, 0x278f, 0x05d8, 0x281a,
+	    0x1f09, 0x1f31, 0x2bae, 0x3573, 0x0000, 0x388f, 0x2ad2, 0x3d3c,
+	    0x0000, 0x0000, 0x45b0, 0x4446, 0x0000, 0x251a, 0x255d, 0x470f,
+	    0x0ae1, 0x2ed3, 0x4b2c, 0x2e4a, 0x4b2f, 0x4292, 0x3f37, 0x48f3,
+	    0x3747, 0x3aa1, 0x1ba4, 0x2285, 0x4a1d, 0x1502, 0x0a58, 0x021c,
+	    0x0000, 0x3c41, 0x0000, 0x359c, 0x0000, 0x0000, 0x0933, 0x2af3,
+	    0x0000, 0x4e13, 0x281b, 0x4c49, 0x1c66, 0x001b, 0x02d9, 0x4ae8,
+	    0x47d3, 0x0000, 0x22ac, 0x26a1, 0x0889, 0x2766, 0x0000, 0x0f2f,
+	    0x0e03, 0x0000, 0x133f, 0x428d, 0x0000, 0x4277, 0x0045, 0x392f,
+	    0x09ad, 0x4d37, 0x3e73, 0x4b93, 0x4076, 0x075c, 0x102e, 0x322a,
+	    0x491c, 0x25fc, 0x0000, 0x0000, 0x0d83, 0x04fe, 0x3879, 0x04fe,
+	    0x1832, 0x09ae, 0x0000, 0x48ef, 0x0bb2, 0x0830, 0x35f6, 0x0b74,
+	    0x0cf3, 0x1e31, 0x46bb, 0x0425, 0x0fda, 0x0000, 0x0000, 0x4ab0,
+	    0x0000, 0x0d03, 0x2b8b, 0x19f7, 0x2229, 0x4ddc, 0x0000, 0x0cf4,
+	    0x42fe, 0x1a21, 0x18bc, 0x0000, 0x25c7, 0x0000, 0x4075, 0x4545,
+	    0x084f, 0x00f0, 0x481a, 0x0000, 0x1bc4, 0x4281, 0x0000, 0x476d,
+	    0x0000, 0x15de, 0x2f8d, 0x27af, 0x47c4, 0x39b1, 0x066b, 0x227c,
+	    0x0000, 0x2c50, 0x0000, 0x0000, 0x08c1, 0x440f, 0x0000, 0x0000,
+	    0x1c45, 0x2966, 0x0645, 0x1a84, 0x0000, 0x0000, 0x0000, 0x3d0a,
+	    0x11aa, 0x4563, 0x0000, 0x121c, 0x0000, 0x0000, 0x2042, 0x0000,
+	    0x0000, 0x2727, 0x400b, 0x0000, 0x0c3d, 0x052e, 0x13e2, 0x2a18,
+	    0x4ce6, 0x0000, 0x3af0, 0x388c, 0x3ae9, 0x42d6, 0x26ec, 0x320b,
+	    0x005d, 0x1e33, 0x189c, 0x30d3, 0x4c3d, 0x44e9, 0x41ad, 0x4bff,
+	    0x0305, 0x1334, 0x0fd4, 0x32fa, 0x42ee, 0x0000, 0x3d51, 0x273e,
+	    0x0150, 0x1966, 0x213c, 0x148b, 0x13df, 0x3335, 0x0773, 0x2859,
+	    0x26b2, 0x444b, 0x3726, 0x0000, 0x267e, 0x2644, 0x3d65, 0x35d0,
+	    0x3174, 0x48d3, 0x095a, 0x0000, 0x46a4, 0x25f4, 0x4c3d, 0x4dff,
+	    0x0000, 0x1300, 0x178a, 0x1790, 0x25af, 0x3ea0, 0x17f7, 0x1d81,
+	    0x0000, 0x07da, 0x14c8, 0x13b1, 0x0000, 0x380c, 0x0000, 0x248d,
+	    0x0000, 0x10cd, 0x315b, 0x0ce9, 0x1c8f, 0x37cc, 0x3b40, 0x438f,
+	    0x44a5, 0x0d4b, 0x0000, 0x4044, 0x1e91, 0x20a1, 0x1b43, 0x1454,
+	    0x0000, 0x23c1, 0x367c, 0x4c00, 0x2405, 0x3dbd, 0x21ec, 0x194e,
+	    0x0d44, 0x4c42, 0x05d2, 0x2dba, 0x1918, 0x3730, 0x0000, 0x1841,
+	    0x0000, 0x0000, 0x3c18, 0x04d8, 0x15e9, 0x222c, 0x3594, 0x476a,
+	    0x0000, 0x0000, 0x301b, 0x4cd9, 0x0000, 0x12c6, 0x0000, 0x0000,
+	    0x398b, 0x4a54, 0x0000, 0x149d, 0x0000, 0x28d4, 0x2416, 0x0000,
+	    0x052c, 0x0000, 0x0209, 0x10f3, 0x1d3b, 0x2f7c, 0x0000, 0x0ef0,
+	    0x29fa, 0x0000, 0x3d16, 0x4dfc, 0x4534, 0x14a9, 0x2eb4, 0x0d79,
+	    0x0000, 0x1544, 0x1883, 0x008c, 0x2147, 0x0ce9, 0x1bbd, 0x03c3,
+	    0x0939, 0x2103, 0x0000, 0x2a77, 0x0000, 0x1b68, 0x2c6b, 0x0552,
+	    0x24b4, 0x1862, 0x4a9a, 0x3e33, 0x0000, 0x0000, 0x0424, 0x0000,
+	    0x0000, 0x0269, 0x4b36, 0x3f51, 0x1e82, 0x2f5e, 0x104d, 0x3b35,
+	    0x4686, 0x2173, 0x4dd7, 0x12ec, 0x0000, 0x0000, 0x3f7c, 0x1113,
+	    0x151f, 0x0460, 0x0e61, 0x0000, 0x0000, 0x33d7, 0x066a, 0x0000,
+	    0x02da, 0x4c87, 0x0000, 0x3344, 0x1000, 0x0000, 0x4725, 0x0000,
+	    0x344a, 0x1396, 0x3772, 0x06db, 0x0000, 0x31be, 0x2dc1, 0x1989,
+	    0x420a, 0x2998, 0x0594, 0x3c89, 0x371c, 0x0a0a, 0x2dd8, 0x3443,
+	    0x1e38, 0x0000, 0x3656, 0x4253, 0x0000, 0x09a0, 0x0000, 0x31dd,
+	    0x0000, 0x0000, 0x405d, 0x0000, 0x0342, 0x07da, 0x2f7c, 0x2d8a,
+	    0x0000, 0x1870, 0x03c9, 0x40e3, 0x4ba6, 0x3e2f, 0x1a1b, 0x36fd,
+	    0x3326, 0x0000, 0x4c0c, 0x3eb6, 0x00be, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1840, 0x0c9e, 0x35ce, 0x0000, 0x3020, 0x1c1e, 0x0000,
+	    0x10ea, 0x2c40, 0x35dd, 0x1aab, 0x0574, 0x0000, 0x28ec, 0x490b,
+	    0x0000, 0x0000, 0x2a68, 0x19d8, 0x08d0, 0x43af, 0x01bd, 0x48d2,
+	    0x10be, 0x0000, 0x205e, 0x22e9, 0x0000, 0x0271, 0x1845, 0x06bb,
+	    0x0000, 0x24e5, 0x0000, 0x2bcd, 0x3718, 0x4aa1, 0x0000, 0x42eb,
+	    0x3e13, 0x0000, 0x0352, 0x0000, 0x2332, 0x1e91, 0x3fd6, 0x4458,
+	    0x0000, 0x3147, 0x0000, 0x1821, 0x0000, 0x244b, 0x0000, 0x0000,
+	    0x1902, 0x1c69, 0x0000, 0x0000, 0x3e8b, 0x034c, 0x48fb, 0x3bef,
+	    0x0000, 0x0000, 0x1e72, 0x072c, 0x0000, 0x1af0, 0x2d8a, 0x0000,
+	    0x0000, 0x1f44, 0x1f79, 0x3340, 0x405d, 0x0000, 0x0000, 0x0dd7,
+	    0x18fc, 0x13aa, 0x0000, 0x0c22, 0x2fea, 0x1eb3, 0x07e0, 0x0000,
+	    0x242c, 0x0000, 0x0000, 0x0000, 0x2700, 0x2d6c, 0x1966, 0x29fe,
+	    0x0000, 0x3253, 0x0000, 0x19ae, 0x2212, 0x1970, 0x0000, 0x2f08,
+	    0x2625, 0x0039, 0x1f29, 0x431f, 0x0615, 0x2bd6, 0x2fc1, 0x0cba,
+	    0x2149, 0x0000, 0x4967, 0x3488, 0x0000, 0x2e23, 0x0000, 0x0000,
+	    0x0117, 0x04a9, 0x0000, 0x3cad, 0x2400, 0x02d7, 0x4048, 0x3cd5,
+	    0x4380, 0x0000, 0x2453, 0x0c60, 0x4954, 0x16b5, 0x25c8, 0x0000,
+	    0x0291, 0x4cee, 0x1498, 0x0d5b, 0x444e, 0x416b, 0x360b, 0x3161,
+	    0x1ff5, 0x0aa0, 0x27cd, 0x45ac, 0x0000, 0x0000, 0x07ce, 0x0000,
+	    0x1cdb, 0x0000, 0x0000, 0x0000, 0x4d58, 0x43d0, 0x19a8, 0x0000,
+	    0x0000, 0x3c98, 0x1368, 0x4a83, 0x11fa, 0x3845, 0x0519, 0x21d8,
+	    0x3c41, 0x4a81, 0x15c5, 0x4166, 0x3e2e, 0x3e43, 0x273e, 0x4744,
+	    0x2896, 0x0000, 0x19ac, 0x0fc1, 0x0000, 0x0000, 0x1e81, 0x2302,
+	    0x1295, 0x0000, 0x1d20, 0x4512, 0x463c, 0x03cf, 0x3caa, 0x1e5e,
+	    0x4803, 0x0d49, 0x49c2, 0x0000, 0x0000, 0x1b94, 0x1a8d, 0x364e,
+	    0x3df2, 0x0000, 0x30f1, 0x4cd7, 0x0286, 0x0000, 0x0655, 0x07ba,
+	    0x2ae8, 0x27f5, 0x4869, 0x0000, 0x3273, 0x0000, 0x07f7, 0x3cdb,
+	    0x0000, 0x0000, 0x4480, 0x08f7, 0x23b9, 0x0000, 0x4a4d, 0x0000,
+	    0x3ae0, 0x0000, 0x3c05, 0x4696, 0x36a2, 0x3a48, 0x0000, 0x3430,
+	    0x2685, 0x1660, 0x4d1f, 0x0000, 0x1424, 0x463a, 0x0c4f, 0x4c24,
+	    0x0000, 0x0000, 0x115a, 0x0000, 0x2cc2, 0x2851, 0x0000, 0x1844,
+	    0x1e82, 0x0000, 0x2a1b, 0x3bcb, 0x45e7, 0x0000, 0x4725, 0x1fba,
+	    0x4613, 0x2450, 0x3deb, 0x4510, 0x0000, 0x0000, 0x394e, 0x4285,
+	    0x3932, 0x0059, 0x0000, 0x0000, 0x3ad9, 0x4e0f, 0x300a, 0x08bd,
+	    0x0000, 0x1dc0, 0x31c2, 0x27d2, 0x2dc4, 0x4724, 0x3c6d, 0x0000,
+	    0x1657, 0x3f42, 0x37ee, 0x0c44, 0x0000, 0x33c3, 0x20f4, 0x3ea6,
+	    0x1995, 0x45e2, 0x0000, 0x3e4c, 0x1264, 0x0000, 0x32af, 0x244a,
+	    0x0000, 0x3452, 0x29a9, 0x05c4, 0x076a, 0x2078, 0x1ae8, 0x1724,
+	    0x0b8b, 0x4988, 0x10df, 0x0000, 0x3536, 0x3f16, 0x449e, 0x2491,
+	    0x06c7, 0x0ebf, 0x0000, 0x044f, 0x14bf, 0x23ad, 0x1cb4, 0x30d5,
+	    0x3573, 0x31d4, 0x4567, 0x48bd, 0x043d, 0x3555, 0x2442, 0x0000,
+	    0x19ce, 0x0000, 0x39d4, 0x261f, 0x0f98, 0x224d, 0x2379, 0x0000,
+	    0x3ff6, 0x0000, 0x0786, 0x2f7d, 0x39a0, 0x34c3, 0x3629, 0x2fcb,
+	    0x4656, 0x092c, 0x4c68, 0x1fba, 0x12ae, 0x26eb, 0x3db4, 0x0000,
+	    0x3aff, 0x0a88, 0x0000, 0x2cd8, 0x0ed4, 0x444e, 0x1442, 0x0000,
+	    0x0000, 0x36c6, 0x4d60, 0x0000, 0x3f5c, 0x2092, 0x3765, 0x03b7,
+	    0x05fb, 0x0796, 0x2a1e, 0x1c5f, 0x0cd9, 0x07c9, 0x1b86, 0x2552,
+	    0x45ac, 0x27b9, 0x3fa8, 0x2a2f, 0x0000, 0x0000, 0x0cec, 0x03fe,
+	    0x1d24, 0x3ee5, 0x2d23, 0x4b24, 0x0000, 0x0000, 0x050a, 0x22c1,
+	    0x1046, 0x1eb0, 0x4601, 0x4a91, 0x0000, 0x4890, 0x0000, 0x0000,
+	    0x3b9a, 0x479a, 0x1d83, 0x1227, 0x046b, 0x0000, 0x497f, 0x4433,
+	    0x0720, 0x0d42, 0x4a6a, 0x0b79, 0x349a, 0x2519, 0x002c, 0x095e,
+	    0x19d5, 0x0372, 0x4c73, 0x48a3, 0x4cab, 0x0000, 0x40dd, 0x1d64,
+	    0x11a6, 0x2236, 0x0580, 0x154d, 0x435b, 0x0b60, 0x0000, 0x3437,
+	    0x2c28, 0x0000, 0x1283, 0x19eb, 0x3389, 0x0000, 0x0883, 0x4811,
+	    0x251a, 0x0000, 0x2858, 0x1205, 0x106a, 0x06aa, 0x0000, 0x0000,
+	    0x0000, 0x1e25, 0x2088, 0x2aff, 0x0000, 0x20a0, 0x0000, 0x0f2c,
+	    0x0eef, 0x0b43, 0x0000, 0x0000, 0x0000, 0x37f3, 0x1012, 0x2f26,
+	    0x3ba7, 0x273f, 0x27e0, 0x25cf, 0x0000, 0x31e8, 0x1bb1, 0x279f,
+	    0x3db0, 0x15b4, 0x1505, 0x2d09, 0x0f48, 0x1bbd, 0x21dd, 0x2568,
+	    0x0000, 0x4198, 0x0f38, 0x0000, 0x1c46, 0x2ccd, 0x2379, 0x32b7,
+	    0x0000, 0x03ca, 0x4724, 0x48c5, 0x0000, 0x270e, 0x4c78, 0x19f4,
+	    0x4cc1, 0x0000, 0x0000, 0x3968, 0x474b, 0x0aec, 0x1b6c, 0x400b,
+	    0x292b, 0x1440, 0x21ea, 0x37a5, 0x2f6c, 0x0faf, 0x0000, 0x1496,
+	    0x0000, 0x1479, 0x1198, 0x46b4, 0x24ad, 0x0000, 0x2def, 0x048b,
+	    0x3f41, 0x0000, 0x29df, 0x08e8, 0x0000, 0x4958, 0x37ae, 0x3ed1,
+	    0x20d4, 0x1291, 0x3832, 0x369b, 0x0000, 0x197e, 0x02df, 0x1115,
+	    0x3865, 0x0000, 0x11cd, 0x4cdc, 0x3a09, 0x19bb, 0x2f38, 0x3624,
+	    0x2633, 0x29a1, 0x2202, 0x3d6f, 0x3b7b, 0x0000, 0x0000, 0x0000,
+	    0x1cf0, 0x0000, 0x1a16, 0x4194, 0x0000, 0x0165, 0x302e, 0x4b3e,
+	    0x362e, 0x137f, 0x0000, 0x019b, 0x254a, 0x0000, 0x2293, 0x0000,
+	    0x0a6a, 0x1312, 0x384b, 0x34cf, 0x0000, 0x44d3, 0x1a06, 0x0000,
+	    0x16a2, 0x0000, 0x4441, 0x426d, 0x0283, 0x1366, 0x03f5, 0x0000,
+	    0x0000, 0x0000, 0x30dd, 0x1e73, 0x0000, 0x3382, 0x043a, 0x16c0,
+	    0x0000, 0x0000, 0x44cb, 0x0000, 0x26d3, 0x0000, 0x29db, 0x33bb,
+	    0x0860, 0x20e3, 0x3d36, 0x46cc, 0x4b37, 0x034c, 0x090a, 0x0d4a,
+	    0x0000, 0x0f21, 0x2eb0, 0x3e6c, 0x383b, 0x348e, 0x1224, 0x0000,
+	    0x3c9d, 0x00b9, 0x496c, 0x256c, 0x1938, 0x1987, 0x0e79, 0x2027,
+	    0x0000, 0x0f63, 0x302c, 0x0000, 0x2454, 0x0000, 0x0000, 0x2067,
+	    0x0000, 0x25b4, 0x0000, 0x2544, 0x0e45, 0x0000, 0x2b9e, 0x17d1,
+	    0x0000, 0x46e1, 0x0000, 0x2403, 0x4b21, 0x4d7e, 0x405d, 0x03ac,
+	    0x2199, 0x199b, 0x386b, 0x0000, 0x0636, 0x32c5, 0x480d, 0x1748,
+	    0x4b34, 0x36ce, 0x464f, 0x0000, 0x120e, 0x0d5a, 0x09ad, 0x007e,
+	    0x2ded, 0x41a0, 0x2832, 0x264f, 0x0a5a, 0x2208, 0x4207, 0x0000,
+	    0x0146, 0x46dc, 0x267f, 0x16be, 0x0000, 0x23a2, 0x4a68, 0x17e1,
+	    0x4a63, 0x10ed, 0x0bcb, 0x309f, 0x0000, 0x3344, 0x03bb, 0x299f,
+	    0x13dc, 0x0000, 0x2191, 0x1a4b, 0x4c62, 0x01ae, 0x2633, 0x3a2e,
+	    0x0000, 0x2927, 0x0f64, 0x1155, 0x0334, 0x234c, 0x23eb, 0x0000,
+	    0x15e6, 0x4b40, 0x0000, 0x4062, 0x0000, 0x0000, 0x0000, 0x39f3,
+	    0x3a37, 0x411f, 0x0000, 0x0000, 0x19b6, 0x0000, 0x14a8, 0x1bea,
+	    0x4abc, 0x0000, 0x37c0, 0x4052, 0x2be4, 0x354e, 0x0000, 0x0000,
+	    0x3abe, 0x44a9, 0x4dc4, 0x048c, 0x0000, 0x0000, 0x1257, 0x4d40,
+	    0x03e5, 0x0fd7, 0x3b92, 0x1c07, 0x0666, 0x2fc5, 0x45e2, 0x48e8,
+	    0x193f, 0x0930, 0x3d12, 0x0000, 0x3fda, 0x0000, 0x07ce, 0x2bda,
+	    0x3c92, 0x2bfd, 0x1409, 0x2a08, 0x1ace, 0x4c21, 0x0000, 0x0238,
+	    0x3792, 0x3286, 0x4d08, 0x4352, 0x0ca8, 0x0000, 0x242e, 0x0000,
+	    0x03da, 0x3202, 0x0000, 0x311f, 0x0608, 0x4888, 0x2a52, 0x1743,
+	    0x3796, 0x4341, 0x09be, 0x0000, 0x4d71, 0x1936, 0x0000, 0x0000,
+	    0x0514, 0x3bad, 0x4987, 0x1935, 0x3e3b, 0x189a, 0x0e99, 0x3831,
+	    0x35f6, 0x41be, 0x07c0, 0x0000, 0x19c0, 0x185e, 0x0000, 0x16d4,
+	    0x3b03, 0x0000, 0x41d9, 0x3846, 0x4b30, 0x0000, 0x0000, 0x1553,
+	    0x180d, 0x0000, 0x0000, 0x261b, 0x0000, 0x37c5, 0x0000, 0x0000,
+	    0x3e09, 0x3f00, 0x0000, 0x1ab2, 0x0000, 0x0000, 0x1c73, 0x1e66,
+	    0x1c36, 0x4a47, 0x0000, 0x0000, 0x17ca, 0x2745, 0x34c9, 0x0610,
+	    0x394c, 0x43e1, 0x4145, 0x280c, 0x1588, 0x1b44, 0x3c80, 0x1135,
+	    0x23aa, 0x0000, 0x0201, 0x0000, 0x294f, 0x0000, 0x07c4, 0x08d4,
+	    0x0000, 0x13ed, 0x2358, 0x2ead, 0x0000, 0x17b6, 0x42f5, 0x34a0,
+	    0x4d5b, 0x472f, 0x2bb9, 0x1795, 0x3774, 0x3554, 0x0000, 0x0f08,
+	    0x29ff, 0x079b, 0x0000, 0x3940, 0x0000, 0x16fd, 0x3fb5, 0x1b21,
+	    0x0e16, 0x2eb8, 0x0000, 0x0dc2, 0x36a6, 0x1554, 0x0000, 0x0000,
+	    0x388e, 0x45ef, 0x0000, 0x0992, 0x3cf7, 0x2da1, 0x0000, 0x0df9,
+	    0x0000, 0x18c4, 0x4e07, 0x0979, 0x0000, 0x0000, 0x09cf, 0x34fa,
+	    0x45da, 0x1dd3, 0x0000, 0x16f2, 0x0000, 0x09ab, 0x0000, 0x0000,
+	    0x292f, 0x175c, 0x4587, 0x066b, 0x0000, 0x0000, 0x0000, 0x48f5,
+	    0x027f, 0x3541, 0x22b0, 0x2e96, 0x456e, 0x2ad8, 0x15b4, 0x2775,
+	    0x0355, 0x23b3, 0x23a2, 0x0000, 0x3930, 0x2fa9, 0x4de2, 0x287a,
+	    0x21b9, 0x372f, 0x0f5b, 0x2e2e, 0x0bb6, 0x2fd2, 0x0000, 0x24db,
+	    0x2a95, 0x0000, 0x0cd7, 0x1063, 0x4534, 0x0ed8, 0x0000, 0x47d2,
+	    0x0000, 0x06ad, 0x0000, 0x0add, 0x4cac, 0x2481, 0x2d7a, 0x0000,
+	    0x0000, 0x0d92, 0x1305, 0x2329, 0x371a, 0x07ab, 0x0a11, 0x0000,
+	    0x0f91, 0x0000, 0x2012, 0x0000, 0x3c9b, 0x1422, 0x4375, 0x3d69,
+	    0x3887, 0x3e80, 0x342c, 0x353e, 0x2ad9, 0x12c6, 0x21b5, 0x1d1b,
+	    0x1742, 0x46af, 0x4b1a, 0x263a, 0x31fd, 0x0fe7, 0x4968, 0x3178,
+	    0x2827, 0x235e, 0x0000, 0x2f6e, 0x3a32, 0x0000, 0x1344, 0x0000,
+	    0x410f, 0x3bb0, 0x3952, 0x4301, 0x2663, 0x0000, 0x2d2c, 0x2ae9,
+	    0x0d29, 0x0000, 0x0000, 0x0000, 0x445a, 0x3fb2, 0x0000, 0x47b4,
+	    0x0000, 0x0000, 0x0000, 0x18d0, 0x2d5c, 0x2a23, 0x2c72, 0x070c,
+	    0x3715, 0x0000, 0x4855, 0x49db, 0x3ba8, 0x0b62, 0x2ed0, 0x0000,
+	    0x4670, 0x08ea, 0x2abf, 0x12df, 0x0000, 0x174b, 0x4d8e, 0x398d,
+	    0x1851, 0x4296, 0x4083, 0x2e5e, 0x0c8f, 0x0000, 0x0000, 0x208f,
+	    0x0167, 0x40eb, 0x4094, 0x0000, 0x172e, 0x2410, 0x0000, 0x0000,
+	    0x1322, 0x2685, 0x3ad5, 0x0000, 0x3e4f, 0x2382, 0x1e50, 0x3ed3,
+	    0x0000, 0x1dc7, 0x0000, 0x0d17, 0x0000, 0x0589, 0x22f8, 0x0000,
+	    0x2513, 0x3e4d, 0x247d, 0x054b, 0x1197, 0x0a9e, 0x48ed, 0x0000,
+	    0x1090, 0x1e55, 0x271e, 0x0312, 0x0000, 0x32ed, 0x4c58, 0x0000,
+	    0x0000, 0x277a, 0x00cb, 0x2957, 0x2746, 0x0000, 0x198a, 0x0385,
+	    0x0f38, 0x00ed, 0x0000, 0x0000, 0x4431, 0x26c6, 0x37a4, 0x0000,
+	    0x4070, 0x3eb9, 0x1095, 0x0000, 0x1016, 0x39da, 0x0000, 0x2983,
+	    0x1a23, 0x470f, 0x2425, 0x0a4a, 0x0000, 0x2e42, 0x3b93, 0x0000,
+	    0x0000, 0x2c25, 0x0000, 0x3e87, 0x0000, 0x2364, 0x29cd, 0x148c,
+	    0x0000, 0x21b3, 0x3d31, 0x3efb, 0x0000, 0x288a, 0x29db, 0x28a0,
+	    0x0000, 0x0000, 0x02c9, 0x0000, 0x0000, 0x00be, 0x387e, 0x1cec,
+	    0x1b65, 0x0bf7, 0x3729, 0x0a14, 0x0000, 0x07a7, 0x07ed, 0x3d92,
+	    0x40b1, 0x15f6, 0x0000, 0x09c2, 0x4740, 0x2a8a, 0x0000, 0x3dc6,
+	    0x1116, 0x0c84, 0x0000, 0x3c58, 0x19b2, 0x0095, 0x37e3, 0x0378,
+	    0x0000, 0x0000, 0x0000, 0x4994, 0x228a, 0x2e00, 0x0000, 0x07a9,
+	    0x0e6b, 0x0000, 0x0000, 0x27c8, 0x168e, 0x09fb, 0x017c, 0x1297,
+	    0x3f52, 0x26b9, 0x476d, 0x3097, 0x3c89, 0x065e, 0x0000, 0x0000,
+	    0x09cb, 0x2df3, 0x0000, 0x4489, 0x2bba, 0x0aa7, 0x4c94, 0x0000,
+	    0x39ad, 0x32b9, 0x239c, 0x0000, 0x1a32, 0x3b69, 0x0128, 0x0000,
+	    0x0000, 0x2b58, 0x2ec3, 0x0000, 0x0200, 0x3f92, 0x1d4f, 0x0cd7,
+	    0x02ff, 0x0000, 0x2f4b, 0x4292, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2ba7, 0x2f52, 0x3d7d, 0x4433, 0x3f0e, 0x26ec, 0x0000, 0x456b,
+	    0x3dd7, 0x3c76, 0x0000, 0x3c15, 0x2680, 0x44c2, 0x1315, 0x2fa1,
+	    0x2655, 0x4cab, 0x0000, 0x079c, 0x0000, 0x0000, 0x0d64, 0x1335,
+	    0x0000, 0x075f, 0x21ce, 0x3b19, 0x1d1d, 0x17fe, 0x096c, 0x0ff9,
+	    0x2cae, 0x1b64, 0x27c5, 0x0000, 0x1c2b, 0x1ffd, 0x0c6f, 0x47a6,
+	    0x0000, 0x0000, 0x38ee, 0x0000, 0x4a17, 0x4a9f, 0x0000, 0x4dea,
+	    0x0000, 0x0000, 0x0000, 0x0e87, 0x0000, 0x137f, 0x3213, 0x0aa9,
+	    0x14ae, 0x47e0, 0x0000, 0x235a, 0x0000, 0x377e, 0x2255, 0x0b9b,
+	    0x21ef, 0x3415, 0x0059, 0x48a3, 0x1d3c, 0x0000, 0x4141, 0x203b,
+	    0x0e4e, 0x16eb, 0x38cf, 0x3669, 0x388f, 0x02bc, 0x132c, 0x0000,
+	    0x4102, 0x0000, 0x0fdf, 0x32b8, 0x0000, 0x0000, 0x0000, 0x1977,
+	    0x1bf5, 0x0b4c, 0x0ede, 0x0000, 0x4d12, 0x23d5, 0x0390, 0x325a,
+	    0x4d61, 0x0000, 0x1719, 0x0a79, 0x314a, 0x0cc0, 0x3a18, 0x429e,
+	    0x00ef, 0x225f, 0x4569, 0x0000, 0x1e5b, 0x1259, 0x0000, 0x0000,
+	    0x04e5, 0x248c, 0x3e8b, 0x0f53, 0x31a8, 0x036a, 0x0000, 0x1c19,
+	    0x01cb, 0x1983, 0x0000, 0x1ea3, 0x0782, 0x0000, 0x050e, 0x36ee,
+	    0x3d64, 0x1f34, 0x0000, 0x0000, 0x0000, 0x0000, 0x222b, 0x0000,
+	    0x17a1, 0x07ac, 0x4514, 0x13ba, 0x0fda, 0x0000, 0x0000, 0x2d5a,
+	    0x12b3, 0x1676, 0x032c, 0x0000, 0x0669, 0x0000, 0x3163, 0x0b44,
+	    0x1be0, 0x28e6, 0x44e1, 0x0000, 0x0000, 0x136b, 0x0114, 0x0000,
+	    0x0c3b, 0x0c09, 0x119c, 0x0000, 0x4228, 0x3f93, 0x27dc, 0x04dc,
+	    0x0000, 0x2b99, 0x3475, 0x4a32, 0x0000, 0x0000, 0x4619, 0x1e89,
+	    0x4502, 0x355b, 0x0000, 0x06cc, 0x0f76, 0x24ce, 0x0391, 0x1e5f,
+	    0x3ce9, 0x03b2, 0x429e, 0x0000, 0x2551, 0x2d0d, 0x0c5b, 0x2385,
+	    0x3319, 0x0c52, 0x09c0, 0x0000, 0x1f1f, 0x21a6, 0x0000, 0x2624,
+	    0x1e92, 0x47b2, 0x2331, 0x0000, 0x0000, 0x10dd, 0x3e1b, 0x1d50,
+	    0x0ae2, 0x16b1, 0x03b5, 0x1109, 0x0000, 0x2399, 0x446e, 0x15b9,
+	    0x0000, 0x4164, 0x2da0, 0x33ac, 0x1cc7, 0x1245, 0x0000, 0x0000,
+	    0x1f44, 0x454f, 0x333d, 0x0000, 0x0e0b, 0x3ee1, 0x1533, 0x0312,
+	    0x1c9a, 0x0000, 0x05ae, 0x34f7, 0x08b4, 0x0000, 0x430b, 0x06b8,
+	    0x0000, 0x1a93, 0x0a0e, 0x0597, 0x0000, 0x0000, 0x258d, 0x0000,
+	    0x3e38, 0x40ef, 0x0000, 0x0bd8, 0x0000, 0x1d3e, 0x314a, 0x1a07,
+	    0x0030, 0x415a, 0x4509, 0x0000, 0x1cac, 0x0000, 0x0000, 0x0000,
+	    0x118b, 0x2dea, 0x0000, 0x1d64, 0x2880, 0x0000, 0x0000, 0x059a,
+	    0x1f88, 0x230f, 0x01b1, 0x0000, 0x4725, 0x0000, 0x2f79, 0x0163,
+	    0x2a8c, 0x3fb8, 0x410d, 0x306d, 0x0ed3, 0x0644, 0x4c02, 0x46f9,
+	    0x0000, 0x1a7c, 0x2d74, 0x005f, 0x3d93, 0x3f2f, 0x3fb0, 0x485c,
+	    0x2fae, 0x0000, 0x3be9, 0x4cf5, 0x3a7f, 0x124b, 0x0000, 0x0000,
+	    0x2a3f, 0x3fd6, 0x1fc7, 0x441e, 0x132b, 0x49c0, 0x0000, 0x17ab,
+	    0x0000, 0x0000, 0x0000, 0x1554, 0x0000, 0x0000, 0x24fb, 0x0000,
+	    0x3706, 0x0998, 0x1e4d, 0x0772, 0x2e82, 0x2a65, 0x0000, 0x0ca0,
+	    0x0000, 0x02db, 0x4026, 0x0000, 0x0e62, 0x27b9, 0x2b5a, 0x0000,
+	    0x0000, 0x1403, 0x4c1d, 0x0000, 0x0000, 0x33e1, 0x0000, 0x0000,
+	    0x0e54, 0x0000, 0x4db1, 0x01c6, 0x4df9, 0x199a, 0x2217, 0x0000,
+	    0x03dc, 0x0000, 0x0000, 0x49d2, 0x2982, 0x0000, 0x0062, 0x282b,
+	    0x0c3c, 0x1b82, 0x2e47, 0x38ac, 0x0000, 0x3c71, 0x0000, 0x30f9,
+	    0x3737, 0x1c66, 0x0000, 0x15c4, 0x3d19, 0x0000, 0x0000, 0x3d67,
+	    0x1c86, 0x0b14, 0x4807, 0x4684, 0x2b5a, 0x3b94, 0x02b2, 0x2795,
+	    0x20bd, 0x1967, 0x0000, 0x0000, 0x0000, 0x183e, 0x0000, 0x0ea6,
+	    0x228b, 0x48a8, 0x0000, 0x33ed, 0x1a5f, 0x135b, 0x3866, 0x1429,
+	    0x0d4b, 0x0c43, 0x123a, 0x3603, 0x242e, 0x3c95, 0x4a6f, 0x3e32,
+	    0x2576, 0x0000, 0x39e0, 0x3314, 0x23af, 0x0000, 0x237a, 0x0b53,
+	    0x177d, 0x383b, 0x4394, 0x0000, 0x2afb, 0x13e7, 0x29da, 0x1ac1,
+	    0x4165, 0x0000, 0x42ee, 0x3406, 0x06d6, 0x4cf7, 0x2b1b, 0x15e7,
+	    0x0220, 0x2821, 0x0000, 0x0000, 0x228e, 0x12d9, 0x0000, 0x0000,
+	    0x4652, 0x48bb, 0x0000, 0x002b, 0x25d5, 0x0407, 0x3fe5, 0x1c03,
+	    0x1a91, 0x0b96, 0x3ae3, 0x1378, 0x3613, 0x0000, 0x14d1, 0x007f,
+	    0x02fb, 0x0590, 0x4aa1, 0x0000, 0x24c9, 0x33bc, 0x0000, 0x253e,
+	    0x0000, 0x0575, 0x028e, 0x2d63, 0x0000, 0x3ee0, 0x2cb3, 0x0000,
+	    0x0000, 0x0000, 0x1a7f, 0x1ac8, 0x33f4, 0x3863, 0x2108, 0x2b47,
+	    0x2a31, 0x4da5, 0x12a1, 0x0000, 0x45d8, 0x1794, 0x0d32, 0x35ca,
+	    0x0000, 0x1b92, 0x307e, 0x29af, 0x1564, 0x0000, 0x1791, 0x0000,
+	    0x0000, 0x0000, 0x2cca, 0x0f1c, 0x0000, 0x41e2, 0x4bfb, 0x4769,
+	    0x2eb5, 0x0852, 0x0d1f, 0x27ec, 0x3a34, 0x3dbd, 0x0000, 0x4353,
+	    0x1654, 0x0000, 0x2cd9, 0x2f93, 0x0000, 0x0b74, 0x0000, 0x0c14,
+	    0x3840, 0x1f05, 0x27a1, 0x0de9, 0x0000, 0x1d45, 0x19d6, 0x12ba,
+	    0x0000, 0x0000, 0x3b09, 0x381f, 0x0000, 0x46cd, 0x4780, 0x0fab,
+	    0x07ca, 0x0c63, 0x4e00, 0x34f2, 0x0000, 0x40bc, 0x39f2, 0x1286,
+	    0x052c, 0x06f6, 0x219e, 0x3adc, 0x4867, 0x0000, 0x09eb, 0x0000,
+	    0x490e, 0x10d9, 0x0e47, 0x2868, 0x4352, 0x0000, 0x3cce, 0x4737,
+	    0x43dd, 0x3d30, 0x26ea, 0x2aa3, 0x00a8, 0x4d04, 0x3c8b, 0x391b,
+	    0x0000, 0x2919, 0x016e, 0x4318, 0x0000, 0x0a64, 0x380b, 0x10ed,
+	    0x36db, 0x0000, 0x2989, 0x0066, 0x0000, 0x4670, 0x34af, 0x035a,
+	    0x2c1a, 0x0000, 0x1ed7, 0x08e8, 0x0000, 0x0000, 0x15de, 0x18b3,
+	    0x43d5, 0x220b, 0x0041, 0x0000, 0x1f8c, 0x0000, 0x029a, 0x2712,
+	    0x10b9, 0x3ba1, 0x0000, 0x4198, 0x0000, 0x2c3b, 0x4b6b, 0x2689,
+	    0x28af, 0x32aa, 0x3559, 0x0000, 0x2a6c, 0x1889, 0x0000, 0x0000,
+	    0x3547, 0x0000, 0x05da, 0x38ae, 0x4a0a, 0x0210, 0x0b28, 0x0000,
+	    0x0000, 0x1c2c, 0x0eb1, 0x0441, 0x1a1b, 0x0000, 0x4b2c, 0x369f,
+	    0x2556, 0x117c, 0x023f, 0x1c6e, 0x033a, 0x1fa5, 0x429b, 0x3a68,
+	    0x4c20, 0x4cc8, 0x37d2, 0x16f6, 0x0000, 0x06d8, 0x4c4d, 0x454c,
+	    0x45d0, 0x0a2e, 0x36e0, 0x0e56, 0x09a4, 0x3c4c, 0x03e8, 0x0000,
+	    0x0593, 0x3fcd, 0x2dc7, 0x1571, 0x2af7, 0x0805, 0x0000, 0x381b,
+	    0x0000, 0x3a0a, 0x1b72, 0x0bc1, 0x3c93, 0x0000, 0x4cec, 0x1cb5,
+	    0x0638, 0x32d9, 0x321e, 0x33a5, 0x1a44, 0x302f, 0x40fb, 0x0000,
+	    0x1bce, 0x2c5d, 0x2328, 0x0000, 0x0739, 0x3fd9, 0x3865, 0x4a7b,
+	    0x330e, 0x0000, 0x399b, 0x0494, 0x3827, 0x0808, 0x0000, 0x0000,
+	    0x0000, 0x2e3a, 0x2a44, 0x3465, 0x2cbb, 0x058d, 0x1b77, 0x0000,
+	    0x0e64, 0x3f58, 0x19ba, 0x2a90, 0x2563, 0x1235, 0x0000, 0x3b0d,
+	    0x1731, 0x161e, 0x0a27, 0x344a, 0x0000, 0x3ca7, 0x3290, 0x0a95,
+	    0x2428, 0x1fc5, 0x430c, 0x28c9, 0x1c58, 0x1b84, 0x17fa, 0x0000,
+	    0x0000, 0x3b27, 0x128c, 0x0c98, 0x0000, 0x2878, 0x0000, 0x252f,
+	    0x2f18, 0x0000, 0x0bb5, 0x0000, 0x1012, 0x07e6, 0x0000, 0x4df6,
+	    0x0000, 0x4afe, 0x1522, 0x0000, 0x3ff8, 0x2ce4, 0x0101, 0x0435,
+	    0x0000, 0x4a5c, 0x3679, 0x0000, 0x0adf, 0x175c, 0x3f48, 0x00ce,
+	    0x472e, 0x111a, 0x146c, 0x0000, 0x0000, 0x47d5, 0x2e92, 0x2b30,
+	    0x1d40, 0x45b1, 0x0000, 0x3ccf, 0x0a44, 0x354f, 0x1a61, 0x0000,
+	    0x0000, 0x0a06, 0x3d03, 0x3621, 0x0000, 0x1e72, 0x3501, 0x0281,
+	    0x0283, 0x4a3d, 0x0000, 0x086d, 0x206e, 0x0caf, 0x3a40, 0x0304,
+	    0x3044, 0x0a76, 0x133f, 0x2528, 0x0000, 0x439c, 0x0000, 0x3c25,
+	    0x0def, 0x0fd3, 0x45c5, 0x0000, 0x2a31, 0x19a7, 0x0000, 0x3791,
+	    0x1878, 0x0000, 0x0a27, 0x0000, 0x07cc, 0x013c, 0x307e, 0x1870,
+	    0x22ea, 0x26bb, 0x07a8, 0x0000, 0x1ac9, 0x4b01, 0x0000, 0x21b9,
+	    0x15dc, 0x2dd0, 0x4aa7, 0x2ce2, 0x3f14, 0x123f, 0x4b79, 0x0000,
+	    0x218d, 0x3eb0, 0x061a, 0x1c7b, 0x0000, 0x3386, 0x0000, 0x137a,
+	    0x0000, 0x4d03, 0x4c5d, 0x3438, 0x36ca, 0x3b3d, 0x2241, 0x0000,
+	    0x0e36, 0x2de9, 0x20ef, 0x0000, 0x0c49, 0x0069, 0x3ca4, 0x0000,
+	    0x2192, 0x0000, 0x30d7, 0x4133, 0x2b73, 0x0000, 0x46c0, 0x2903,
+	    0x18c9, 0x2f25, 0x47f0, 0x0000, 0x2df6, 0x0000, 0x46d5, 0x2f65,
+	    0x1244, 0x0000, 0x1a2a, 0x1421, 0x430b, 0x0000, 0x14a0, 0x160b,
+	    0x2f34, 0x3d94, 0x0000, 0x0000, 0x23f2, 0x0090, 0x0000, 0x3715,
+	    0x0000, 0x39dc, 0x0000, 0x0000, 0x31c4, 0x283b, 0x0000, 0x0cd9,
+	    0x1c80, 0x29db, 0x2afd, 0x4425, 0x0a55, 0x0000, 0x0000, 0x00bc,
+	    0x4410, 0x42c4, 0x0658, 0x0000, 0x39dc, 0x0000, 0x1f03, 0x3be6,
+	    0x0d30, 0x0249, 0x09ab, 0x3873, 0x4cf9, 0x2d4e, 0x004e, 0x28c6,
+	    0x17a9, 0x2954, 0x0000, 0x224d, 0x1b2d, 0x0000, 0x4b38, 0x192b,
+	    0x4048, 0x10fa, 0x0000, 0x1cd6, 0x0000, 0x0000, 0x1b3b, 0x2615,
+	    0x217d, 0x21d7, 0x328b, 0x2e1d, 0x30af, 0x03f8, 0x3ad2, 0x04e4,
+	    0x462b, 0x0504, 0x4741, 0x0000, 0x2f81, 0x49fd, 0x0000, 0x3b26,
+	    0x21f3, 0x4163, 0x2272, 0x375c, 0x11e6, 0x0000, 0x02db, 0x0000,
+	    0x0000, 0x0000, 0x3fbe, 0x3054, 0x3308, 0x0d05, 0x3b5f, 0x0000,
+	    0x10cb, 0x0000, 0x0000, 0x411d, 0x0f81, 0x102c, 0x0000, 0x0c25,
+	    0x1b47, 0x1355, 0x0000, 0x0f42, 0x13f7, 0x0000, 0x272e, 0x0000,
+	    0x30a6, 0x4ae9, 0x47c8, 0x3530, 0x1db9, 0x0000, 0x4be5, 0x28d8,
+	    0x10db, 0x40a4, 0x3e84, 0x0000, 0x4366, 0x2e8b, 0x0574, 0x4d9c,
+	    0x44d5, 0x0000, 0x1fdc, 0x0ab6, 0x0000, 0x3ee9, 0x4138, 0x0ce4,
+	    0x42cf, 0x0000, 0x29cf, 0x29b6, 0x0000, 0x1226, 0x0000, 0x1bf2,
+	    0x109c, 0x2f2d, 0x015f, 0x2075, 0x4210, 0x0000, 0x05d5, 0x247e,
+	    0x1450, 0x0000, 0x3244, 0x0000, 0x477b, 0x0000, 0x2cd4, 0x48bb,
+	    0x4c58, 0x31ac, 0x0cad, 0x14e8, 0x488c, 0x04cf, 0x37d0, 0x0000,
+	    0x2651, 0x05b0, 0x4d98, 0x361e, 0x0000, 0x04cb, 0x12bd, 0x1311,
+	    0x0000, 0x30f1, 0x0000, 0x0000, 0x0000, 0x0380, 0x42a5, 0x11eb,
+	    0x4d27, 0x2ef8, 0x2c13, 0x3afb, 0x3e41, 0x4596, 0x0000, 0x0000,
+	    0x0000, 0x4503, 0x0000, 0x36b7, 0x05f9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3ae3, 0x4199, 0x3d9d, 0x0000, 0x0f9a, 0x4788,
+	    0x0000, 0x2afb, 0x04ec, 0x3e26, 0x22ba, 0x1725, 0x1d17, 0x4676,
+	    0x0000, 0x367e, 0x465c, 0x0cb7, 0x0000, 0x0f7b, 0x28b3, 0x18bd,
+	    0x46c4, 0x379b, 0x0b78, 0x0bac, 0x1f14, 0x3a0b, 0x1ac2, 0x0ce4,
+	    0x0210, 0x0000, 0x0000, 0x3020, 0x0fe4, 0x4b36, 0x0000, 0x3132,
+	    0x39fd, 0x281d, 0x0000, 0x4135, 0x12e7, 0x2e0f, 0x465a, 0x2633,
+	    0x0000, 0x0000, 0x0000, 0x12bb, 0x24f5, 0x0000, 0x0705, 0x0000,
+	    0x36b8, 0x1de8, 0x201b, 0x17a8, 0x2331, 0x0000, 0x2ad1, 0x2347,
+	    0x2307, 0x3ae1, 0x3b39, 0x49fd, 0x064c, 0x0000, 0x2353, 0x153e,
+	    0x32ef, 0x08f2, 0x3965, 0x2e04, 0x437b, 0x3099, 0x01f2, 0x0fa0,
+	    0x2ca2, 0x4983, 0x1f4b, 0x01b7, 0x2157, 0x1a91, 0x3ee6, 0x4db5,
+	    0x0270, 0x0000, 0x0000, 0x310a, 0x3da3, 0x0d8b, 0x385b, 0x0712,
+	    0x4362, 0x02d5, 0x3117, 0x3ec0, 0x2bc8, 0x4a5c, 0x33dc, 0x3f3d,
+	    0x4a26, 0x2ac5, 0x405b, 0x25a3, 0x01c7, 0x0000, 0x005a, 0x2d3e,
+	    0x262e, 0x0000, 0x088f, 0x3804, 0x30bc, 0x348d, 0x0000, 0x0000,
+	    0x3754, 0x03e3, 0x0000, 0x04e7, 0x0e19, 0x0000, 0x21d8, 0x3505,
+	    0x2152, 0x0000, 0x1246, 0x1373, 0x15d3, 0x0000, 0x2543, 0x1577,
+	    0x0000, 0x12d1, 0x0000, 0x2ba4, 0x344d, 0x0000, 0x1f91, 0x2919,
+	    0x4b28, 0x2af3, 0x0734, 0x29d8, 0x0bc0, 0x1515, 0x0c7f, 0x191b,
+	    0x0b20, 0x1afe, 0x1bab, 0x2c3f, 0x0000, 0x0000, 0x0000, 0x218b,
+	    0x400f, 0x057e, 0x0f05, 0x49c5, 0x0c3c, 0x0000, 0x29db, 0x43d9,
+	    0x0000, 0x0000, 0x4600, 0x0183, 0x0000, 0x30ea, 0x1e3d, 0x048e,
+	    0x33bc, 0x2bd0, 0x0000, 0x35d8, 0x1f0b, 0x0000, 0x49b3, 0x4417,
+	    0x3bab, 0x0acb, 0x3f0a, 0x3f7c, 0x0000, 0x20d6, 0x0000, 0x4ae9,
+	    0x4783, 0x0815, 0x1683, 0x05b5, 0x41ea, 0x0000, 0x0a45, 0x492b,
+	    0x0000, 0x3a4a, 0x2733, 0x1813, 0x3962, 0x0000, 0x4a8a, 0x2787,
+	    0x0000, 0x2eb5, 0x13cc, 0x17d1, 0x2801, 0x0000, 0x0000, 0x2a55,
+	    0x4971, 0x098e, 0x1406, 0x4934, 0x3d83, 0x1c2a, 0x0a9b, 0x0d19,
+	    0x0000, 0x0000, 0x0000, 0x0c9d, 0x0000, 0x274d, 0x0000, 0x001c,
+	    0x0ff9, 0x4295, 0x1287, 0x08f2, 0x0000, 0x1027, 0x1039, 0x4302,
+	    0x0415, 0x234e, 0x0a66, 0x0000, 0x3744, 0x3d09, 0x0000, 0x477e,
+	    0x0498, 0x3c22, 0x2770, 0x261d, 0x2069, 0x0000, 0x0000, 0x22c2,
+	    0x1427, 0x42db, 0x0000, 0x319e, 0x0000, 0x3906, 0x2067, 0x0000,
+	    0x0000, 0x428e, 0x44cf, 0x111e, 0x2fb5, 0x1c3f, 0x1aa6, 0x20dd,
+	    0x0000, 0x0000, 0x180c, 0x40b8, 0x0000, 0x4987, 0x1ff4, 0x36e3,
+	    0x0000, 0x492a, 0x47a9, 0x0000, 0x0000, 0x41de, 0x0000, 0x32f0,
+	    0x219a, 0x2334, 0x0000, 0x0000, 0x0662, 0x18a6, 0x0e17, 0x48a0,
+	    0x0000, 0x2d41, 0x1d57, 0x13ff, 0x1c16, 0x1c7c, 0x0000, 0x3757,
+	    0x0408, 0x0000, 0x13af, 0x3c57, 0x2aa4, 0x0000, 0x2225, 0x3792,
+	    0x0e51, 0x0000, 0x4259, 0x45cf, 0x4a88, 0x4420, 0x2882, 0x3ee2,
+	    0x181d, 0x4b2c, 0x32c4, 0x0000, 0x466f, 0x0000, 0x3950, 0x48ad,
+	    0x0e66, 0x0000, 0x0000, 0x2a13, 0x0000, 0x0000, 0x338c, 0x0000,
+	    0x34ee, 0x3333, 0x0fdf, 0x32fe, 0x25e3, 0x2356, 0x0000, 0x0005,
+	    0x281c, 0x142f, 0x0000, 0x248e, 0x0000, 0x4183, 0x01f0, 0x2c8a,
+	    0x03dd, 0x30e2, 0x2ed4, 0x450a, 0x4d13, 0x0000, 0x0000, 0x4b37,
+	    0x0000, 0x36b6, 0x4948, 0x1d0d, 0x3a58, 0x2eb4, 0x0000, 0x1012,
+	    0x0000, 0x4052, 0x3633, 0x416f, 0x0000, 0x36c3, 0x0741, 0x29cd,
+	    0x2ec6, 0x0000, 0x0d8b, 0x4146, 0x41e5, 0x0000, 0x0a97, 0x0000,
+	    0x0000, 0x22d5, 0x0000, 0x3492, 0x3bc8, 0x2ed6, 0x4b15, 0x0506,
+	    0x1126, 0x1b98, 0x282a, 0x009e, 0x04d6, 0x2d2d, 0x0000, 0x0000,
+	    0x0000, 0x0296, 0x0000, 0x0000, 0x4998, 0x2d47, 0x3aa7, 0x3b5d,
+	    0x2f20, 0x27d7, 0x320f, 0x0000, 0x1640, 0x0273, 0x0ac4, 0x2fa0,
+	    0x460c, 0x0000, 0x2024, 0x0868, 0x4245, 0x0000, 0x22f1, 0x2dd4,
+	    0x28e8, 0x4678, 0x1c83, 0x07bf, 0x0ff2, 0x0000, 0x4254, 0x443b,
+	    0x0000, 0x0000, 0x213f, 0x380e, 0x07db, 0x2a2b, 0x3b1e, 0x4531,
+	    0x3f77, 0x2e55, 0x0d04, 0x2bdf, 0x4444, 0x3412, 0x0000, 0x01c4,
+	    0x0d70, 0x1658, 0x451b, 0x0000, 0x3f53, 0x39b0, 0x036d, 0x0000,
+	    0x0000, 0x3a05, 0x0000, 0x2f73, 0x225c, 0x1b99, 0x31d8, 0x3bc3,
+	    0x2c83, 0x056d, 0x3f71, 0x4621, 0x0923, 0x14ee, 0x2e7b, 0x0000,
+	    0x29d8, 0x0000, 0x1435, 0x48f4, 0x37ea, 0x3376, 0x0000, 0x1ec5,
+	    0x2b36, 0x4dde, 0x37c2, 0x162e, 0x11c9, 0x3d87, 0x3848, 0x0000,
+	    0x20f9, 0x2f0e, 0x0000, 0x306b, 0x3106, 0x0486, 0x0000, 0x39b2,
+	    0x4d5f, 0x0068, 0x4a32, 0x0000, 0x2ae2, 0x2e2c, 0x3144, 0x0000,
+	    0x1fca, 0x10d6, 0x19b9, 0x0000, 0x0000, 0x0000, 0x3fc0, 0x2c87,
+	    0x14df,
+	};
+	uint16_t h[8];
+
+	aeshash4(key, keylen, UINT64_C(0x19495cff74b0dc51), (uint32_t*)h);
+
+	h[0] = h[0] % 24801;
+	h[1] = h[1] % 24801;
+	h[2] = h[2] % 24801;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 20000;
+}
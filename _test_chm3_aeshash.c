@@ -0,0 +1,175 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 304089172, seed[1]: 1303455736 */
+#include <stdint.h>
+#include "aeshash.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[1241] = {
+	    0x02a9, 0x02ac, 0x0000, 0x01c1, 0x029d, 0x018e, 0x014f, 0x0363,
+	    0x0317, 0x013b, 0x018d, 0x0000, 0x01f2, 0x004a, 0x03e4, 0x0057,
+	    0x029f, 0x0000, 0x0000, 0x0000, 0x005d, 0x0056, 0x0230, 0x0000,
+	    0x00ea, 0x03cd, 0x0227, 0x01cb, 0x0286, 0x0226, 0x025b, 0x02c7,
+	    0x02b1, 0x01d2, 0x007e, 0x0138, 0x02f6, 0x0000, 0x0386, 0x0009,
+	    0x018e, 0x0334, 0x0000, 0x02c2, 0x010b, 0x01e2, 0x025a, 0x00b0,
+	    0x02c7, 0x01d0, 0x0000, 0x02d4, 0x01c9, 0x036a, 0x0307, 0x0000,
+	    0x00ee, 0x009f, 0x0000, 0x0045, 0x01a9, 0x0207, 0x0000, 0x02a2,
+	    0x0000, 0x016d, 0x029a, 0x0222, 0x00d9, 0x0214, 0x0320, 0x024b,
+	    0x00d8, 0x0204, 0x0000, 0x0033, 0x0199, 0x0167, 0x0000, 0x02a9,
+	    0x0317, 0x0000, 0x01b2, 0x021e, 0x0361, 0x02a0, 0x0031, 0x019d,
+	    0x0263, 0x0000, 0x00db, 0x01f8, 0x0212, 0x022f, 0x0000, 0x0083,
+	    0x0148, 0x0118, 0x0069, 0x01fc, 0x02c2, 0x0060, 0x004f, 0x01b3,
+	    0x014b, 0x0149, 0x031f, 0x024e, 0x01d9, 0x0227, 0x01d8, 0x0000,
+	    0x038c, 0x0228, 0x0142, 0x0000, 0x01dc, 0x0118, 0x0000, 0x00d3,
+	    0x0000, 0x00f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fc, 0x0098,
+	    0x02b5, 0x0000, 0x0085, 0x005d, 0x0000, 0x0301, 0x00d2, 0x0210,
+	    0x012f, 0x0297, 0x0000, 0x0228, 0x0234, 0x0000, 0x0000, 0x0128,
+	    0x01bc, 0x00d9, 0x0000, 0x0308, 0x03e5, 0x0000, 0x0029, 0x0000,
+	    0x0228, 0x01a4, 0x0000, 0x020d, 0x02f6, 0x0000, 0x01f7, 0x00da,
+	    0x02d2, 0x03a1, 0x037e, 0x03d2, 0x013a, 0x0153, 0x00ec, 0x017f,
+	    0x0139, 0x01e0, 0x01bb, 0x0019, 0x0000, 0x0000, 0x0397, 0x031b,
+	    0x0022, 0x0000, 0x02b1, 0x0127, 0x0000, 0x0389, 0x0371, 0x0120,
+	    0x02c7, 0x021b, 0x0000, 0x038d, 0x0113, 0x02d9, 0x027a, 0x009f,
+	    0x03bc, 0x0000, 0x00d1, 0x01d9, 0x00d4, 0x0000, 0x0135, 0x0033,
+	    0x0383, 0x0212, 0x0245, 0x0000, 0x0223, 0x0293, 0x02c9, 0x02a2,
+	    0x02de, 0x0213, 0x0006, 0x01fa, 0x02a0, 0x003e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x013f, 0x025b, 0x0354, 0x0064, 0x0000, 0x00b4,
+	    0x01c1, 0x0135, 0x036a, 0x0153, 0x0049, 0x02e9, 0x0216, 0x019f,
+	    0x014e, 0x0381, 0x02b4, 0x0000, 0x0000, 0x0218, 0x03c9, 0x0185,
+	    0x0154, 0x0000, 0x03d0, 0x022f, 0x0120, 0x0237, 0x03cd, 0x006f,
+	    0x0031, 0x0005, 0x017b, 0x0189, 0x0000, 0x0036, 0x0148, 0x01fa,
+	    0x0252, 0x00b8, 0x0000, 0x02fa, 0x01c0, 0x0000, 0x0261, 0x025d,
+	    0x0255, 0x00d5, 0x02d5, 0x030c, 0x032d, 0x0106, 0x03dc, 0x0273,
+	    0x029e, 0x0123, 0x00c8, 0x0000, 0x0249, 0x030c, 0x0084, 0x0000,
+	    0x0119, 0x030e, 0x0190, 0x0181, 0x0187, 0x007a, 0x0000, 0x0000,
+	    0x0324, 0x0331, 0x0113, 0x00ab, 0x02b4, 0x0000, 0x027c, 0x027e,
+	    0x01f7, 0x032f, 0x0000, 0x0077, 0x03de, 0x00cd, 0x03e1, 0x0170,
+	    0x0332, 0x01e9, 0x015e, 0x028f, 0x0398, 0x001f, 0x0020, 0x021d,
+	    0x0054, 0x0000, 0x03bd, 0x001b, 0x0314, 0x0253, 0x02aa, 0x0259,
+	    0x007f, 0x03db, 0x0361, 0x037d, 0x03c0, 0x0000, 0x0101, 0x0000,
+	    0x00a2, 0x00ef, 0x0052, 0x01eb, 0x00d8, 0x01e0, 0x01d4, 0x00e3,
+	    0x001f, 0x0000, 0x02ab, 0x02c9, 0x0000, 0x0022, 0x0226, 0x02a4,
+	    0x0000, 0x015a, 0x00e3, 0x026b, 0x03c7, 0x02cc, 0x0000, 0x0211,
+	    0x00f6, 0x02b6, 0x0000, 0x006b, 0x0184, 0x02f9, 0x013c, 0x02f8,
+	    0x0223, 0x0303, 0x0024, 0x01fc, 0x00eb, 0x0265, 0x00aa, 0x006b,
+	    0x0000, 0x0004, 0x00f2, 0x01ea, 0x0192, 0x022c, 0x039c, 0x0110,
+	    0x0117, 0x039c, 0x001c, 0x012b, 0x008e, 0x00a0, 0x0032, 0x0000,
+	    0x036a, 0x0359, 0x02c8, 0x024e, 0x02cd, 0x027d, 0x026b, 0x037c,
+	    0x0012, 0x0264, 0x0071, 0x0280, 0x03b8, 0x00e1, 0x0000, 0x0362,
+	    0x035d, 0x01cf, 0x0135, 0x0040, 0x0023, 0x01ef, 0x03bc, 0x027d,
+	    0x0000, 0x014b, 0x03e5, 0x019b, 0x0000, 0x00d8, 0x03a9, 0x03a4,
+	    0x01e1, 0x00a7, 0x0376, 0x0073, 0x0088, 0x0000, 0x015a, 0x01de,
+	    0x03b2, 0x0288, 0x0099, 0x0000, 0x01d5, 0x0000, 0x01b5, 0x0000,
+	    0x0000, 0x010d, 0x00ea, 0x0359, 0x039b, 0x00a6, 0x0000, 0x00d8,
+	    0x016e, 0x03d9, 0x0000, 0x035c, 0x0340, 0x024a, 0x00d5, 0x027e,
+	    0x0000, 0x024b, 0x01e6, 0x0000, 0x03be, 0x004e, 0x0000, 0x0000,
+	    0x01e4, 0x0048, 0x03e1, 0x019b, 0x01ae, 0x0289, 0x009c, 0x0243,
+	    0x01d4, 0x039f, 0x029b, 0x014a, 0x03b7, 0x0211, 0x0000, 0x0007,
+	    0x00c4, 0x0021, 0x0000, 0x0352, 0x02d6, 0x01fc, 0x0135, 0x03bb,
+	    0x0000, 0x00ac, 0x0158, 0x030c, 0x0246, 0x0000, 0x03d9, 0x001d,
+	    0x0158, 0x0229, 0x02a5, 0x00f5, 0x028c, 0x011e, 0x0000, 0x0319,
+	    0x011f, 0x001d, 0x0180, 0x01f3, 0x023e, 0x02fe, 0x034b, 0x0000,
+	    0x01c0, 0x02dc, 0x0000, 0x00f6, 0x0074, 0x00f8, 0x035e, 0x0058,
+	    0x010d, 0x0339, 0x02e5, 0x0038, 0x033c, 0x025c, 0x0018, 0x00ae,
+	    0x0042, 0x0392, 0x0000, 0x0327, 0x01d9, 0x02a2, 0x03c4, 0x0000,
+	    0x0375, 0x0000, 0x02ff, 0x0265, 0x0263, 0x0285, 0x0000, 0x0377,
+	    0x01ca, 0x0197, 0x020a, 0x0124, 0x0355, 0x01f9, 0x00be, 0x03e1,
+	    0x0000, 0x01ad, 0x0380, 0x012a, 0x0246, 0x000d, 0x0184, 0x03d7,
+	    0x0271, 0x0264, 0x0033, 0x0005, 0x0000, 0x03b8, 0x0000, 0x0000,
+	    0x0132, 0x0293, 0x008e, 0x00d9, 0x010f, 0x0000, 0x0188, 0x032b,
+	    0x017e, 0x0094, 0x034c, 0x0212, 0x0256, 0x0262, 0x0272, 0x02ab,
+	    0x0000, 0x001d, 0x0218, 0x012b, 0x0140, 0x010c, 0x0365, 0x0000,
+	    0x0000, 0x008c, 0x0291, 0x0045, 0x00d1, 0x0355, 0x0000, 0x0092,
+	    0x01e0, 0x0331, 0x0254, 0x00e6, 0x0291, 0x0000, 0x024a, 0x0243,
+	    0x01cc, 0x03da, 0x0000, 0x039d, 0x006b, 0x029c, 0x0202, 0x0184,
+	    0x03b0, 0x0301, 0x0316, 0x00f6, 0x027e, 0x00b5, 0x001e, 0x034c,
+	    0x0000, 0x0336, 0x0057, 0x0386, 0x0000, 0x0340, 0x0020, 0x038d,
+	    0x0000, 0x0279, 0x02e0, 0x0000, 0x00d2, 0x0238, 0x0000, 0x0335,
+	    0x0076, 0x027f, 0x01f0, 0x0329, 0x0000, 0x0084, 0x0000, 0x0148,
+	    0x01b6, 0x01b2, 0x00e8, 0x0000, 0x00d2, 0x0364, 0x006c, 0x0149,
+	    0x0383, 0x0000, 0x002a, 0x0393, 0x00f6, 0x013a, 0x0000, 0x017d,
+	    0x017d, 0x0000, 0x0000, 0x031e, 0x03d5, 0x0198, 0x023e, 0x0000,
+	    0x038e, 0x0350, 0x022a, 0x0067, 0x03e4, 0x021b, 0x01a5, 0x02cb,
+	    0x0256, 0x036f, 0x020f, 0x0188, 0x0151, 0x013a, 0x0286, 0x00b1,
+	    0x0282, 0x0151, 0x0145, 0x0000, 0x000c, 0x00db, 0x0159, 0x03a1,
+	    0x0000, 0x0025, 0x0375, 0x0000, 0x0161, 0x00e8, 0x03d8, 0x0083,
+	    0x018c, 0x0031, 0x038d, 0x02cd, 0x01bc, 0x0000, 0x0053, 0x0000,
+	    0x0000, 0x0000, 0x001b, 0x00b0, 0x0000, 0x0162, 0x022e, 0x0058,
+	    0x0049, 0x0193, 0x00cb, 0x00ee, 0x0000, 0x0000, 0x02cc, 0x0281,
+	    0x0018, 0x0280, 0x03df, 0x0000, 0x0386, 0x0290, 0x01ff, 0x0170,
+	    0x0000, 0x0000, 0x0038, 0x02ee, 0x0000, 0x02ca, 0x0121, 0x0000,
+	    0x0093, 0x011b, 0x02f0, 0x01d2, 0x0193, 0x0372, 0x0360, 0x012c,
+	    0x0301, 0x0000, 0x01d9, 0x0397, 0x0385, 0x02e3, 0x0000, 0x01c4,
+	    0x0000, 0x03de, 0x0000, 0x02b8, 0x038d, 0x0000, 0x036b, 0x0038,
+	    0x03ad, 0x01d3, 0x03e3, 0x00bb, 0x0303, 0x007a, 0x0357, 0x0000,
+	    0x0302, 0x0242, 0x0000, 0x0000, 0x0000, 0x02d9, 0x0066, 0x0000,
+	    0x0263, 0x000e, 0x0270, 0x018f, 0x01f1, 0x03aa, 0x028c, 0x023e,
+	    0x0393, 0x033c, 0x036d, 0x0000, 0x03b2, 0x02ab, 0x029c, 0x03b0,
+	    0x0000, 0x02ff, 0x0310, 0x01c0, 0x03db, 0x00d3, 0x0080, 0x033c,
+	    0x0000, 0x0186, 0x03a4, 0x0142, 0x033d, 0x0341, 0x00cb, 0x0000,
+	    0x0000, 0x028c, 0x028d, 0x0000, 0x0096, 0x0235, 0x035e, 0x02dc,
+	    0x0156, 0x0137, 0x017a, 0x023f, 0x03c1, 0x0370, 0x03d1, 0x004e,
+	    0x0000, 0x0294, 0x0195, 0x015f, 0x0000, 0x0202, 0x03c1, 0x0000,
+	    0x032d, 0x00d3, 0x0203, 0x02f1, 0x0281, 0x012c, 0x006e, 0x033d,
+	    0x0000, 0x00ad, 0x00c0, 0x0268, 0x01c1, 0x02dc, 0x0080, 0x022c,
+	    0x0000, 0x0373, 0x01f5, 0x0109, 0x0000, 0x0066, 0x0387, 0x0000,
+	    0x015f, 0x029e, 0x0391, 0x027d, 0x0194, 0x0000, 0x035c, 0x006f,
+	    0x02d1, 0x01c5, 0x02d4, 0x0000, 0x02c5, 0x0167, 0x014c, 0x017a,
+	    0x00d9, 0x0000, 0x0132, 0x02ee, 0x02c9, 0x0232, 0x0180, 0x0235,
+	    0x0000, 0x0000, 0x0291, 0x0000, 0x0334, 0x02be, 0x01e0, 0x0266,
+	    0x0037, 0x0000, 0x0000, 0x0382, 0x00a0, 0x0000, 0x00cd, 0x0000,
+	    0x017b, 0x00ca, 0x0387, 0x011c, 0x0000, 0x00b6, 0x0002, 0x028c,
+	    0x003a, 0x01cf, 0x0390, 0x0094, 0x0000, 0x020a, 0x0100, 0x0235,
+	    0x018f, 0x017d, 0x03ae, 0x0000, 0x00ef, 0x0017, 0x0159, 0x0000,
+	    0x02bd, 0x00fc, 0x0000, 0x02b4, 0x01bc, 0x015e, 0x0000, 0x0071,
+	    0x028c, 0x0396, 0x0000, 0x0044, 0x022b, 0x0000, 0x02f6, 0x006a,
+	    0x0182, 0x0217, 0x037e, 0x0060, 0x0350, 0x00db, 0x0000, 0x0159,
+	    0x0082, 0x03c2, 0x0000, 0x029d, 0x03bc, 0x017e, 0x001a, 0x0025,
+	    0x0000, 0x00e0, 0x03b7, 0x0095, 0x02db, 0x00d9, 0x01f2, 0x0054,
+	    0x0000, 0x01ae, 0x0210, 0x021d, 0x004f, 0x0000, 0x0059, 0x0357,
+	    0x00af, 0x019f, 0x005e, 0x03d1, 0x0316, 0x0290, 0x01eb, 0x01f3,
+	    0x0000, 0x034b, 0x02f9, 0x00db, 0x012a, 0x00b9, 0x0000, 0x036a,
+	    0x0000, 0x02cb, 0x014b, 0x0000, 0x0000, 0x0000, 0x01cc, 0x0319,
+	    0x006b, 0x0146, 0x0121, 0x0000, 0x010e, 0x01b7, 0x033e, 0x0273,
+	    0x00e7, 0x017f, 0x025a, 0x0326, 0x0026, 0x0000, 0x0225, 0x015d,
+	    0x00d3, 0x024c, 0x0000, 0x0283, 0x03c3, 0x00ca, 0x02ff, 0x0019,
+	    0x0287, 0x0016, 0x0000, 0x001f, 0x0099, 0x0000, 0x001f, 0x02e2,
+	    0x006b, 0x00ba, 0x0351, 0x0032, 0x02a6, 0x0000, 0x03df, 0x034b,
+	    0x03cc, 0x01b9, 0x01e4, 0x03d7, 0x015e, 0x0241, 0x035b, 0x0000,
+	    0x00d6, 0x032a, 0x02d2, 0x034c, 0x0170, 0x02a6, 0x037a, 0x0289,
+	    0x01fe, 0x0000, 0x0000, 0x009e, 0x0155, 0x00b2, 0x0218, 0x0000,
+	    0x0000, 0x0254, 0x01fb, 0x03d3, 0x03d5, 0x0000, 0x0000, 0x02ce,
+	    0x0254, 0x0052, 0x001c, 0x02da, 0x01d8, 0x0000, 0x02ce, 0x0376,
+	    0x02f8, 0x03b6, 0x0204, 0x0258, 0x009f, 0x0013, 0x00b6, 0x036b,
+	    0x0199, 0x0006, 0x0000, 0x0370, 0x02db, 0x016c, 0x0000, 0x0000,
+	    0x0083, 0x0064, 0x00c0, 0x0008, 0x0074, 0x0392, 0x02e7, 0x029c,
+	    0x0000, 0x0202, 0x0000, 0x0000, 0x03dc, 0x00c2, 0x0000, 0x0139,
+	    0x0300, 0x02ef, 0x0386, 0x0000, 0x03c5, 0x00a9, 0x032b, 0x0178,
+	    0x0000, 0x00a7, 0x01ab, 0x00d0, 0x005c, 0x0231, 0x02b8, 0x01db,
+	    0x0000, 0x02e3, 0x02d5, 0x0000, 0x0000, 0x00a7, 0x01d2, 0x007b,
+	    0x0000, 0x03b7, 0x0025, 0x0000, 0x0000, 0x0307, 0x027b, 0x009e,
+	    0x01e2, 0x0081, 0x03ab, 0x0000, 0x0000, 0x0232, 0x020c, 0x02cc,
+	    0x02f7, 0x0000, 0x0178, 0x0080, 0x020f, 0x01bb, 0x01da, 0x01f2,
+	    0x0000, 0x0000, 0x0000, 0x0097, 0x035f, 0x0000, 0x013c, 0x003e,
+	    0x0147, 0x0000, 0x0049, 0x00db, 0x0000, 0x0068, 0x00a8, 0x02c4,
+	    0x01e9, 0x023b, 0x014e, 0x02ba, 0x0000, 0x003a, 0x0104, 0x0317,
+	    0x02f5, 0x004a, 0x02e3, 0x0381, 0x0000, 0x0263, 0x027e, 0x012c,
+	    0x032c, 0x0000, 0x0000, 0x0000, 0x015a, 0x01d5, 0x0146, 0x009f,
+	    0x0269, 0x02a6, 0x00f9, 0x0000, 0x01a5, 0x012e, 0x02de, 0x0257,
+	    0x0183, 0x0000, 0x00f6, 0x006f, 0x02bc, 0x0339, 0x0282, 0x03d4,
+	    0x01b3, 0x038f, 0x0000, 0x0000, 0x0214, 0x0015, 0x01bd, 0x001a,
+	    0x02e3, 0x0023, 0x0031, 0x02b4, 0x0000, 0x02ec, 0x006f, 0x02b4,
+	    0x017d, 0x0033, 0x02bd, 0x0000, 0x01e3, 0x03c2, 0x0192, 0x0000,
+	    0x027c, 0x02de, 0x0000, 0x0186, 0x0000, 0x0000, 0x0000, 0x0197,
+	    0x0000,
+	};
+	uint16_t h[8];
+
+	aeshash4(key, keylen, UINT64_C(0x4db127f812200854), (uint32_t*)h);
+
+	h[0] = h[0] % 1241;
+	h[1] = h[1] % 1241;
+	h[2] = h[2] % 1241;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 1000;
+}
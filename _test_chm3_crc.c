@@ -0,0 +1,3120 @@
+/* generated with rurban/nbperf 08a5797  _words */
+/* seed[0]: 1734575198, seed[1]: 1973594324 */
+#include <stdint.h>
+#include "crc3.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[24801] = {
+	    0x2698, 0x083d, 0x3bd9, 0x0000, 0x0000, 0x0c3e, 0x3438, 0x3d68,
+	    0x4be6, 0x2ec3, 0x0000, 0x005f, 0x0277, 0x0000, 0x01f5, 0x3b28,
+	    0x41d3, 0x3e84, 0x15a6, 0x0a30, 0x3ebc, 0x32fb, 0x021c, 0x419c,
+	    0x3232, 0x268e, 0x1635, 0x160d, 0x1944, 0x0000, 0x0fdd, 0x301a,
+	    0x0000, 0x2818, 0x1e50, 0x0000, 0x3a86, 0x2228, 0x01b1, 0x0000,
+	    0x3786, 0x45a7, 0x28a7, 0x4484, 0x03c9, 0x227c, 0x3f5b, 0x04ee,
+	    0x256e, 0x3822, 0x1c63, 0x35b3, 0x3b5b, 0x402b, 0x4b79, 0x07f7,
+	    0x0000, 0x1f64, 0x2380, 0x2198, 0x1bc5, 0x4928, 0x3414, 0x4034,
+	    0x3a02, 0x3308, 0x0beb, 0x0ff0, 0x12c3, 0x0000, 0x2ec8, 0x1f5c,
+	    0x4082, 0x36da, 0x49a3, 0x0e71, 0x0000, 0x0000, 0x2d05, 0x22f8,
+	    0x4dce, 0x0ad7, 0x1d8f, 0x4623, 0x0000, 0x4787, 0x2109, 0x0690,
+	    0x025d, 0x1ff9, 0x2208, 0x2a6d, 0x3be7, 0x2d68, 0x24c3, 0x0000,
+	    0x4077, 0x0ad5, 0x0000, 0x1fa3, 0x0e47, 0x0c6e, 0x19fc, 0x3cac,
+	    0x3361, 0x3ac3, 0x0c26, 0x4459, 0x3ffc, 0x4773, 0x310f, 0x023c,
+	    0x4462, 0x0000, 0x42a8, 0x33eb, 0x46d1, 0x33c2, 0x1aba, 0x44a3,
+	    0x0000, 0x0f7b, 0x0000, 0x3968, 0x4cc8, 0x1494, 0x4c77, 0x0000,
+	    0x0571, 0x0e00, 0x15e0, 0x3be7, 0x3876, 0x1835, 0x036a, 0x0aef,
+	    0x1aac, 0x4959, 0x455c, 0x3f47, 0x11a2, 0x0000, 0x0000, 0x3d9c,
+	    0x3d30, 0x27db, 0x0e50, 0x0000, 0x46d1, 0x0a3d, 0x15b2, 0x1a58,
+	    0x0000, 0x32a5, 0x3471, 0x2577, 0x0000, 0x2d44, 0x0000, 0x181a,
+	    0x1bf1, 0x2df4, 0x10a6, 0x1647, 0x1935, 0x2c70, 0x0000, 0x3d00,
+	    0x43f9, 0x1ebc, 0x0a7a, 0x31b9, 0x2ccd, 0x10e6, 0x3891, 0x3188,
+	    0x4144, 0x0e4f, 0x4d38, 0x0b60, 0x0dda, 0x083e, 0x15fa, 0x4799,
+	    0x480a, 0x0000, 0x43bf, 0x3d78, 0x39d0, 0x0000, 0x3edd, 0x03f2,
+	    0x3fa0, 0x44ef, 0x2036, 0x1e48, 0x2177, 0x3d6c, 0x1d9c, 0x0f17,
+	    0x0000, 0x058d, 0x2add, 0x073d, 0x4caf, 0x3e03, 0x0000, 0x2f10,
+	    0x41b7, 0x3251, 0x0995, 0x0000, 0x09f3, 0x0000, 0x2ca6, 0x2d89,
+	    0x3076, 0x1a8f, 0x0964, 0x0000, 0x2ebb, 0x3ce9, 0x2d3f, 0x3309,
+	    0x3753, 0x23c0, 0x0000, 0x158b, 0x0000, 0x2d43, 0x0b7f, 0x3824,
+	    0x45b0, 0x3f70, 0x1c91, 0x27d9, 0x1d16, 0x06d4, 0x2976, 0x3782,
+	    0x0000, 0x2576, 0x3f0a, 0x0000, 0x0000, 0x2b3f, 0x054a, 0x0c91,
+	    0x32c8, 0x30af, 0x437a, 0x1076, 0x3ee6, 0x39b0, 0x4ba0, 0x0000,
+	    0x1ea7, 0x3442, 0x3175, 0x06e7, 0x3ad5, 0x306b, 0x0000, 0x1223,
+	    0x372e, 0x0000, 0x358f, 0x0000, 0x0000, 0x03b4, 0x2e6e, 0x0000,
+	    0x3eba, 0x3345, 0x3667, 0x04e9, 0x198a, 0x0000, 0x01e9, 0x2454,
+	    0x02d8, 0x3bf5, 0x1648, 0x04bb, 0x3fdd, 0x2955, 0x25d7, 0x3318,
+	    0x0000, 0x2ec9, 0x1769, 0x2921, 0x1a38, 0x07b4, 0x270d, 0x4441,
+	    0x122d, 0x0000, 0x43e3, 0x41ff, 0x0000, 0x0000, 0x0000, 0x4c9c,
+	    0x378e, 0x158f, 0x34c9, 0x1895, 0x4ba7, 0x0000, 0x1262, 0x3f14,
+	    0x0caf, 0x4a76, 0x375b, 0x161c, 0x0000, 0x0000, 0x0dce, 0x08e2,
+	    0x3b10, 0x2e75, 0x0000, 0x0e51, 0x24d6, 0x4186, 0x075e, 0x371e,
+	    0x1e81, 0x0000, 0x0d61, 0x0000, 0x341d, 0x06e5, 0x3d61, 0x0000,
+	    0x0000, 0x1c36, 0x49ed, 0x2a9f, 0x0c27, 0x4cdb, 0x0e43, 0x1973,
+	    0x2969, 0x3cb4, 0x0000, 0x391f, 0x2850, 0x1621, 0x0123, 0x46ab,
+	    0x4683, 0x361d, 0x2d7b, 0x0dfc, 0x37ca, 0x3f72, 0x39cd, 0x1511,
+	    0x07ac, 0x3884, 0x1963, 0x2f89, 0x47cc, 0x333d, 0x0000, 0x13ae,
+	    0x0d65, 0x1153, 0x0e9f, 0x40a1, 0x1385, 0x1251, 0x0b7b, 0x4a7c,
+	    0x26c4, 0x0f34, 0x20c7, 0x2c90, 0x1703, 0x1326, 0x3145, 0x0000,
+	    0x02b8, 0x0fb5, 0x3d3a, 0x1f4b, 0x4320, 0x1c57, 0x1565, 0x06fc,
+	    0x0000, 0x300e, 0x4c9b, 0x3fde, 0x0543, 0x4c26, 0x26e5, 0x0000,
+	    0x0000, 0x128a, 0x3d0f, 0x18c0, 0x3ebe, 0x0000, 0x3729, 0x098d,
+	    0x304c, 0x4c90, 0x2146, 0x2440, 0x0b9d, 0x1c38, 0x28df, 0x2319,
+	    0x450f, 0x0000, 0x3719, 0x164e, 0x0000, 0x1bf6, 0x3abd, 0x2c60,
+	    0x0000, 0x260c, 0x0000, 0x101b, 0x3401, 0x0dcb, 0x089a, 0x0b13,
+	    0x2b21, 0x0000, 0x302c, 0x1e40, 0x0000, 0x1975, 0x2cf9, 0x0b9f,
+	    0x4846, 0x4b1f, 0x11b5, 0x3eb7, 0x0000, 0x2e21, 0x17e3, 0x0c55,
+	    0x4b9e, 0x3838, 0x0000, 0x0939, 0x31b4, 0x2add, 0x0000, 0x36ae,
+	    0x2cca, 0x2a0a, 0x1074, 0x3212, 0x0000, 0x0588, 0x21a9, 0x0000,
+	    0x2b69, 0x49a4, 0x4ad1, 0x0000, 0x4c30, 0x4893, 0x136b, 0x11cb,
+	    0x1ba6, 0x22cd, 0x26f0, 0x3778, 0x0fe0, 0x1d88, 0x00bf, 0x159c,
+	    0x16a5, 0x4afb, 0x4dfc, 0x20ec, 0x1601, 0x196c, 0x172e, 0x375f,
+	    0x38ec, 0x48d1, 0x2faa, 0x0000, 0x21d4, 0x161c, 0x11d0, 0x19d8,
+	    0x1af9, 0x0c60, 0x0000, 0x304c, 0x27b2, 0x36ce, 0x0e23, 0x1ad5,
+	    0x20c5, 0x3e51, 0x0000, 0x08d6, 0x0fe1, 0x49ce, 0x0000, 0x2734,
+	    0x0fa5, 0x0000, 0x0000, 0x0000, 0x22a3, 0x0000, 0x4a67, 0x0000,
+	    0x0000, 0x0000, 0x2143, 0x157f, 0x4499, 0x0000, 0x1415, 0x0000,
+	    0x31f5, 0x0a67, 0x0cc0, 0x1fc6, 0x0000, 0x0c98, 0x2641, 0x14b2,
+	    0x1d3c, 0x183d, 0x014a, 0x11fb, 0x2e35, 0x3fbf, 0x23d5, 0x0000,
+	    0x1c8d, 0x0c90, 0x4e09, 0x2ef9, 0x32f3, 0x0000, 0x3e5f, 0x0d8f,
+	    0x1233, 0x3870, 0x3a73, 0x3ff1, 0x1fc2, 0x4709, 0x1b5b, 0x143c,
+	    0x185b, 0x02cc, 0x3e9b, 0x0000, 0x26ae, 0x40a9, 0x3755, 0x0c83,
+	    0x2844, 0x1d11, 0x4039, 0x1548, 0x0000, 0x0786, 0x0000, 0x1b56,
+	    0x335c, 0x0000, 0x3c02, 0x000e, 0x19f9, 0x0000, 0x376c, 0x2b75,
+	    0x14cf, 0x104a, 0x2b25, 0x0a9f, 0x1c9e, 0x2194, 0x0000, 0x0000,
+	    0x263c, 0x46c5, 0x12f5, 0x433e, 0x0400, 0x2330, 0x0e58, 0x2a98,
+	    0x2b4e, 0x21f5, 0x1cea, 0x3e8f, 0x40fd, 0x1a05, 0x0cfc, 0x0000,
+	    0x2f73, 0x0000, 0x21f0, 0x0814, 0x26f1, 0x2a24, 0x2786, 0x4152,
+	    0x3f88, 0x0000, 0x187c, 0x0566, 0x0000, 0x1792, 0x00bc, 0x0324,
+	    0x375c, 0x0000, 0x211a, 0x0000, 0x35c4, 0x1f9a, 0x1800, 0x304f,
+	    0x4862, 0x0000, 0x308e, 0x294a, 0x1b3d, 0x1dc6, 0x031e, 0x0000,
+	    0x4482, 0x0985, 0x1084, 0x1eea, 0x197c, 0x2d55, 0x4881, 0x0000,
+	    0x0000, 0x2140, 0x0000, 0x36fc, 0x3072, 0x4a56, 0x46d7, 0x0000,
+	    0x3fc5, 0x4b12, 0x3833, 0x331d, 0x0031, 0x3909, 0x2947, 0x08b2,
+	    0x1ef8, 0x09e0, 0x281d, 0x2a18, 0x11fa, 0x0d0b, 0x149d, 0x0000,
+	    0x344e, 0x06ff, 0x4c1d, 0x4dad, 0x3e35, 0x2b64, 0x0000, 0x43f1,
+	    0x49b4, 0x4d0b, 0x18fc, 0x2f71, 0x2bda, 0x1095, 0x2b6a, 0x4418,
+	    0x06fc, 0x2248, 0x17c1, 0x0000, 0x29da, 0x272e, 0x18aa, 0x01cb,
+	    0x0a2f, 0x14b2, 0x0000, 0x3d77, 0x4c75, 0x26cc, 0x1a67, 0x3d68,
+	    0x0000, 0x4bf1, 0x405e, 0x0000, 0x0000, 0x0000, 0x281a, 0x0a43,
+	    0x30f1, 0x0000, 0x19ee, 0x4842, 0x2d7b, 0x146a, 0x26a7, 0x16e8,
+	    0x480e, 0x1aca, 0x041e, 0x0000, 0x1a38, 0x256c, 0x25e7, 0x2566,
+	    0x198f, 0x358c, 0x3e68, 0x0007, 0x011d, 0x22f5, 0x2836, 0x0046,
+	    0x3fe5, 0x3ea8, 0x2867, 0x39c0, 0x1dbf, 0x1fa3, 0x47f9, 0x29e0,
+	    0x0000, 0x1b6e, 0x0000, 0x4c49, 0x044d, 0x016c, 0x1280, 0x2edd,
+	    0x057e, 0x3cd6, 0x09a3, 0x0000, 0x04fb, 0x21df, 0x1029, 0x3d03,
+	    0x0f61, 0x0000, 0x116b, 0x388d, 0x1c5d, 0x2ebf, 0x0698, 0x0000,
+	    0x401b, 0x43d5, 0x3e40, 0x06d3, 0x3a8e, 0x1ec1, 0x3584, 0x1f97,
+	    0x1ecb, 0x2b0c, 0x1fdb, 0x055c, 0x09ce, 0x0000, 0x13f5, 0x1eac,
+	    0x32e5, 0x4278, 0x31b4, 0x32b9, 0x049f, 0x28a8, 0x0000, 0x4923,
+	    0x0000, 0x43f3, 0x2cec, 0x0361, 0x0bcc, 0x4874, 0x03c1, 0x4ca7,
+	    0x0000, 0x3220, 0x30c5, 0x0263, 0x12c8, 0x2e71, 0x0000, 0x2543,
+	    0x46d8, 0x0000, 0x4519, 0x1c0a, 0x27db, 0x0000, 0x14b8, 0x0000,
+	    0x47ac, 0x3b1e, 0x25a2, 0x0dea, 0x0ff4, 0x30de, 0x4101, 0x0000,
+	    0x49da, 0x3fbd, 0x2cbf, 0x309e, 0x0000, 0x1fc6, 0x372b, 0x27c8,
+	    0x0ebd, 0x247b, 0x122c, 0x0fab, 0x2b1b, 0x1e6c, 0x3e5b, 0x2e56,
+	    0x0000, 0x096f, 0x30a8, 0x0000, 0x4c32, 0x0021, 0x0b3c, 0x2c6b,
+	    0x0000, 0x0bd4, 0x3c8b, 0x195a, 0x35fd, 0x15c3, 0x0000, 0x4104,
+	    0x0000, 0x47b7, 0x4a67, 0x470b, 0x3990, 0x2d14, 0x1358, 0x3b1e,
+	    0x313b, 0x34d5, 0x29cc, 0x13f8, 0x012a, 0x1c0e, 0x26cc, 0x01ee,
+	    0x0000, 0x3279, 0x408c, 0x4468, 0x3320, 0x0fae, 0x1c6c, 0x0000,
+	    0x129f, 0x1dcf, 0x015d, 0x0817, 0x0000, 0x442f, 0x30eb, 0x27dc,
+	    0x36dd, 0x0000, 0x0000, 0x1c37, 0x2cb6, 0x4277, 0x0000, 0x29a4,
+	    0x16c0, 0x3fec, 0x0928, 0x4ad2, 0x1d35, 0x49ca, 0x41d3, 0x4e0b,
+	    0x3f6a, 0x3638, 0x0000, 0x0000, 0x1808, 0x45b5, 0x3342, 0x0000,
+	    0x42fd, 0x141a, 0x3dc4, 0x0000, 0x0000, 0x2199, 0x342a, 0x033f,
+	    0x0000, 0x4b09, 0x3968, 0x4ab2, 0x10fc, 0x080f, 0x4731, 0x25a0,
+	    0x0937, 0x3e84, 0x4bac, 0x2a2d, 0x4263, 0x33d6, 0x4024, 0x0000,
+	    0x2399, 0x03fb, 0x0000, 0x2841, 0x0000, 0x091f, 0x3f05, 0x46fe,
+	    0x11cf, 0x1117, 0x23d3, 0x0000, 0x033f, 0x0000, 0x1cde, 0x4d0f,
+	    0x0000, 0x4a12, 0x3f2e, 0x4967, 0x0000, 0x3a7a, 0x0000, 0x2d02,
+	    0x2f64, 0x29f4, 0x43b0, 0x4370, 0x3e06, 0x4669, 0x27f8, 0x085d,
+	    0x3a9a, 0x3249, 0x1e91, 0x31f7, 0x3aad, 0x07aa, 0x0000, 0x244b,
+	    0x0fce, 0x1ba3, 0x4314, 0x19f7, 0x4654, 0x4274, 0x2f89, 0x0985,
+	    0x006f, 0x1c44, 0x1821, 0x1d04, 0x39ba, 0x1cb4, 0x0c2f, 0x18fa,
+	    0x09c4, 0x0283, 0x0000, 0x0000, 0x0c42, 0x2a0e, 0x304a, 0x02ff,
+	    0x4d90, 0x30eb, 0x33e3, 0x2211, 0x48e6, 0x0000, 0x22f5, 0x06a7,
+	    0x0e3b, 0x0aaa, 0x046f, 0x0029, 0x2659, 0x2203, 0x29f0, 0x374d,
+	    0x02b1, 0x0831, 0x0000, 0x4dd8, 0x0cda, 0x2108, 0x259c, 0x0025,
+	    0x362a, 0x0000, 0x086a, 0x13ae, 0x4497, 0x30dc, 0x03ba, 0x0f0c,
+	    0x344e, 0x1f40, 0x069f, 0x1ae6, 0x2e73, 0x05d3, 0x3088, 0x0f14,
+	    0x0000, 0x0ec5, 0x0874, 0x2928, 0x264f, 0x3730, 0x0000, 0x3588,
+	    0x33a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x393b, 0x1d55, 0x384b,
+	    0x182a, 0x3e90, 0x0000, 0x4830, 0x33c1, 0x1493, 0x0f20, 0x42b6,
+	    0x0798, 0x4440, 0x48a8, 0x35ff, 0x15f2, 0x0080, 0x2c6d, 0x0aed,
+	    0x4805, 0x0000, 0x10b5, 0x13ff, 0x0000, 0x1185, 0x1603, 0x3544,
+	    0x2112, 0x379f, 0x32b0, 0x1e58, 0x0ef1, 0x3c61, 0x0000, 0x403e,
+	    0x4663, 0x0acb, 0x3bbc, 0x0000, 0x3006, 0x2c07, 0x1de1, 0x22bc,
+	    0x13cd, 0x0dcb, 0x33d9, 0x48b3, 0x2179, 0x0000, 0x27ba, 0x1f77,
+	    0x0000, 0x08f0, 0x1afa, 0x34ed, 0x2ec3, 0x031e, 0x41c2, 0x41ea,
+	    0x0bd5, 0x0ef1, 0x05a3, 0x454e, 0x03ed, 0x0cdb, 0x0743, 0x3611,
+	    0x3c39, 0x3328, 0x12d9, 0x07ee, 0x34f5, 0x0000, 0x41c9, 0x30c6,
+	    0x20bb, 0x4be9, 0x3a24, 0x0537, 0x40e1, 0x0c04, 0x1145, 0x0000,
+	    0x1ce2, 0x0a2f, 0x0644, 0x0250, 0x3c51, 0x03f9, 0x37a5, 0x0e3c,
+	    0x311f, 0x4059, 0x1ccb, 0x405f, 0x3b03, 0x1fd8, 0x3fb0, 0x0000,
+	    0x39bf, 0x0000, 0x0000, 0x365e, 0x4d40, 0x3bbf, 0x18ed, 0x4df3,
+	    0x0000, 0x0a51, 0x1e4c, 0x3af6, 0x1641, 0x2429, 0x0000, 0x388c,
+	    0x4c4f, 0x0000, 0x191e, 0x3f9d, 0x0000, 0x39f6, 0x38c9, 0x19ec,
+	    0x26b6, 0x2b4b, 0x022d, 0x172b, 0x082b, 0x1b3b, 0x0000, 0x06ad,
+	    0x28cd, 0x0000, 0x3123, 0x011e, 0x318b, 0x0000, 0x16c5, 0x0000,
+	    0x1078, 0x4d02, 0x06b8, 0x0000, 0x4315, 0x143f, 0x3514, 0x1bac,
+	    0x4862, 0x1e2f, 0x2034, 0x1db5, 0x31d0, 0x49bc, 0x00e5, 0x4206,
+	    0x1569, 0x1f62, 0x0000, 0x40aa, 0x0e22, 0x0d1b, 0x11ef, 0x35e7,
+	    0x265b, 0x0ca4, 0x125b, 0x3919, 0x3062, 0x3607, 0x0725, 0x174e,
+	    0x04b8, 0x0000, 0x1d9d, 0x1de9, 0x2678, 0x482f, 0x2a42, 0x4d42,
+	    0x2da4, 0x1561, 0x0000, 0x0000, 0x271a, 0x3c69, 0x4409, 0x38d9,
+	    0x3785, 0x291f, 0x2c0f, 0x11b3, 0x3cd1, 0x294c, 0x4263, 0x490d,
+	    0x2a16, 0x24b5, 0x1c89, 0x485d, 0x1948, 0x31c9, 0x4dbc, 0x074a,
+	    0x21cc, 0x058c, 0x47a3, 0x0000, 0x1ff1, 0x42db, 0x0be0, 0x3f3f,
+	    0x0000, 0x2ecf, 0x0000, 0x25ba, 0x17ef, 0x47f9, 0x4b4e, 0x3ed1,
+	    0x0260, 0x3a8b, 0x3092, 0x1fcf, 0x2b55, 0x32a8, 0x1753, 0x066b,
+	    0x0000, 0x31f6, 0x0075, 0x3f50, 0x36bf, 0x3254, 0x0b46, 0x19e1,
+	    0x43f4, 0x4c4f, 0x238a, 0x41c8, 0x375e, 0x2f0d, 0x0000, 0x222b,
+	    0x1619, 0x3e08, 0x2e6c, 0x2cbb, 0x0777, 0x0000, 0x036b, 0x4032,
+	    0x4bd7, 0x00e4, 0x477e, 0x2eb4, 0x0000, 0x0000, 0x0a16, 0x0000,
+	    0x2a95, 0x0000, 0x10ad, 0x26b7, 0x0588, 0x0000, 0x33c8, 0x0000,
+	    0x45a3, 0x3c9b, 0x099c, 0x3611, 0x4682, 0x1fda, 0x355e, 0x0814,
+	    0x0000, 0x0000, 0x367f, 0x0000, 0x292b, 0x2556, 0x007e, 0x0db6,
+	    0x0000, 0x0000, 0x0000, 0x475f, 0x0816, 0x0000, 0x418e, 0x1822,
+	    0x4455, 0x04be, 0x2e11, 0x32b5, 0x174b, 0x4198, 0x140b, 0x17ab,
+	    0x0000, 0x09ae, 0x0380, 0x488a, 0x3c2f, 0x1f30, 0x216a, 0x3130,
+	    0x0000, 0x3ec7, 0x225d, 0x1f96, 0x29c9, 0x0000, 0x4313, 0x4d36,
+	    0x0b27, 0x1adb, 0x3ab9, 0x4461, 0x489f, 0x46f1, 0x25f9, 0x1c1e,
+	    0x3ea8, 0x0000, 0x4b52, 0x0ed0, 0x15d9, 0x1c44, 0x2d0a, 0x4a3a,
+	    0x0000, 0x1549, 0x2473, 0x0016, 0x0eba, 0x0000, 0x0ef3, 0x0000,
+	    0x2aee, 0x2017, 0x0000, 0x3232, 0x00e6, 0x0000, 0x0000, 0x0000,
+	    0x499a, 0x158d, 0x42c8, 0x1957, 0x0000, 0x48df, 0x0000, 0x073c,
+	    0x1b1d, 0x45f6, 0x45fa, 0x1399, 0x0000, 0x0f44, 0x2bff, 0x0000,
+	    0x31a8, 0x007d, 0x1324, 0x0811, 0x194c, 0x195d, 0x2073, 0x4320,
+	    0x4678, 0x1e3b, 0x19ca, 0x1588, 0x0000, 0x2bb2, 0x0000, 0x0000,
+	    0x2965, 0x0000, 0x4a42, 0x0000, 0x1366, 0x1df4, 0x0d5a, 0x2842,
+	    0x233b, 0x3cf2, 0x434a, 0x34c2, 0x39ba, 0x1ff0, 0x0000, 0x399f,
+	    0x4b1a, 0x35f9, 0x18bb, 0x3264, 0x0b49, 0x212b, 0x352d, 0x253a,
+	    0x11bc, 0x1b99, 0x0000, 0x0ffb, 0x1844, 0x0000, 0x1fea, 0x426f,
+	    0x2095, 0x11dc, 0x41ac, 0x315f, 0x38fc, 0x1b39, 0x4d0b, 0x34ed,
+	    0x388e, 0x3388, 0x3157, 0x3433, 0x0615, 0x07bf, 0x0000, 0x240b,
+	    0x4a09, 0x2fc5, 0x36c0, 0x04d0, 0x3ae8, 0x16a2, 0x011c, 0x45e8,
+	    0x27c2, 0x36e8, 0x3fbc, 0x4d5a, 0x277b, 0x2731, 0x0000, 0x3eab,
+	    0x22fb, 0x1824, 0x0000, 0x0172, 0x2785, 0x4931, 0x34a6, 0x1eab,
+	    0x4572, 0x447b, 0x212e, 0x3448, 0x488f, 0x0000, 0x4c73, 0x068d,
+	    0x371c, 0x3511, 0x189f, 0x0000, 0x0f33, 0x315d, 0x123e, 0x0f35,
+	    0x2ea3, 0x0000, 0x2931, 0x132b, 0x0000, 0x4b85, 0x29ef, 0x0c17,
+	    0x0000, 0x0f3a, 0x1684, 0x02bc, 0x235a, 0x3eda, 0x0000, 0x0000,
+	    0x1da1, 0x0000, 0x2b6a, 0x3a39, 0x0000, 0x34f0, 0x14ef, 0x49f5,
+	    0x1d8c, 0x02c8, 0x19bc, 0x1c61, 0x482d, 0x0bd6, 0x1584, 0x3fd4,
+	    0x1165, 0x34da, 0x20bb, 0x0000, 0x2d99, 0x405d, 0x0f12, 0x4820,
+	    0x011a, 0x0ca1, 0x33e5, 0x3fe8, 0x0000, 0x0436, 0x0000, 0x0b76,
+	    0x24ce, 0x2d5b, 0x28f8, 0x02cc, 0x21ee, 0x0621, 0x3e16, 0x2880,
+	    0x1689, 0x3b51, 0x244a, 0x0000, 0x0000, 0x1acc, 0x0d17, 0x0000,
+	    0x0d8d, 0x4c6b, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e35, 0x2e8c,
+	    0x2941, 0x0000, 0x2aeb, 0x0aec, 0x26bf, 0x3e31, 0x0000, 0x20ac,
+	    0x0000, 0x4612, 0x0992, 0x4c61, 0x1b11, 0x4a7b, 0x48f6, 0x256e,
+	    0x3f2d, 0x26be, 0x3945, 0x1183, 0x3a9a, 0x1a1b, 0x4d00, 0x49c8,
+	    0x33bc, 0x1915, 0x0000, 0x1939, 0x4492, 0x0000, 0x40cc, 0x2015,
+	    0x1311, 0x3539, 0x3251, 0x39ef, 0x4c39, 0x156e, 0x4a65, 0x4b22,
+	    0x4d3e, 0x1d4d, 0x1d79, 0x09fd, 0x0000, 0x0000, 0x0000, 0x1c33,
+	    0x0e34, 0x0000, 0x23f1, 0x1c31, 0x3903, 0x10b5, 0x428f, 0x0584,
+	    0x4da6, 0x0000, 0x3750, 0x3e53, 0x0000, 0x2db4, 0x097f, 0x27d3,
+	    0x0000, 0x2dfc, 0x0000, 0x304a, 0x3411, 0x44ef, 0x29c0, 0x1fd8,
+	    0x001a, 0x3d48, 0x18cc, 0x3e07, 0x0000, 0x0edc, 0x49b0, 0x2d0d,
+	    0x3cf4, 0x0000, 0x34ae, 0x0000, 0x36f2, 0x3bc5, 0x0000, 0x2d3f,
+	    0x310e, 0x180e, 0x35a8, 0x0000, 0x350d, 0x3390, 0x3f76, 0x0ac7,
+	    0x3b3c, 0x0873, 0x0000, 0x0000, 0x4095, 0x4587, 0x1b89, 0x0000,
+	    0x1e08, 0x0597, 0x1ed0, 0x0d6f, 0x2094, 0x384b, 0x0000, 0x0000,
+	    0x3d67, 0x0000, 0x3538, 0x4bca, 0x0000, 0x04d2, 0x3033, 0x0000,
+	    0x292f, 0x0000, 0x232a, 0x3cc4, 0x36b8, 0x25d4, 0x35c3, 0x2ec0,
+	    0x0f95, 0x09bb, 0x3727, 0x0c6f, 0x00c9, 0x30d0, 0x4b27, 0x2213,
+	    0x32c6, 0x0000, 0x499e, 0x066c, 0x36db, 0x1d26, 0x061b, 0x30df,
+	    0x0000, 0x0000, 0x356d, 0x2adb, 0x0000, 0x128f, 0x3537, 0x10bf,
+	    0x01b6, 0x39cb, 0x031e, 0x4929, 0x0000, 0x1ac8, 0x465a, 0x37d4,
+	    0x0000, 0x2cca, 0x22ed, 0x2e2b, 0x0000, 0x22c5, 0x3bef, 0x0478,
+	    0x2a10, 0x2b82, 0x0f58, 0x1a9b, 0x1aff, 0x0000, 0x1208, 0x31b9,
+	    0x4c2e, 0x0af5, 0x2b6f, 0x2e0f, 0x3790, 0x110a, 0x0000, 0x2aca,
+	    0x3f13, 0x3e12, 0x39f0, 0x0000, 0x10c3, 0x15bc, 0x0f32, 0x3338,
+	    0x4218, 0x2244, 0x2506, 0x3299, 0x0775, 0x0000, 0x4c92, 0x39ba,
+	    0x180a, 0x3dd7, 0x3599, 0x3f9d, 0x15b3, 0x2c44, 0x15fe, 0x4074,
+	    0x3ab7, 0x1765, 0x0f60, 0x18f4, 0x0000, 0x2800, 0x4865, 0x052e,
+	    0x100f, 0x2d6c, 0x1ec2, 0x264d, 0x3d2e, 0x2ac4, 0x0000, 0x22d4,
+	    0x1b11, 0x45bb, 0x2aa2, 0x0000, 0x0000, 0x455e, 0x35b5, 0x0cea,
+	    0x0f63, 0x1ffe, 0x0000, 0x4335, 0x0000, 0x3075, 0x0000, 0x1de2,
+	    0x22ca, 0x389d, 0x09cf, 0x0d1d, 0x3f4f, 0x08f6, 0x11e2, 0x2c7e,
+	    0x20f8, 0x0000, 0x1777, 0x10af, 0x0000, 0x4b10, 0x2f16, 0x02fe,
+	    0x0922, 0x3e37, 0x0000, 0x2281, 0x12ed, 0x3aa3, 0x06ec, 0x29e2,
+	    0x0f75, 0x0a0c, 0x3b01, 0x1269, 0x323c, 0x21b8, 0x0487, 0x23b8,
+	    0x0000, 0x0a68, 0x0000, 0x1130, 0x0000, 0x2e24, 0x28cb, 0x0000,
+	    0x0b11, 0x12d6, 0x0000, 0x1ee4, 0x300b, 0x4834, 0x4bb2, 0x0bea,
+	    0x48aa, 0x0000, 0x3d1c, 0x2eb5, 0x49f7, 0x0b91, 0x0000, 0x2b65,
+	    0x3d82, 0x1ac3, 0x0000, 0x22db, 0x121c, 0x33a0, 0x0000, 0x197d,
+	    0x4920, 0x27e9, 0x0703, 0x0000, 0x0942, 0x3394, 0x2651, 0x0000,
+	    0x3b40, 0x0000, 0x4b69, 0x0d09, 0x4405, 0x125e, 0x2c95, 0x0a9f,
+	    0x3aaf, 0x3986, 0x00af, 0x3baa, 0x1233, 0x44be, 0x100d, 0x0000,
+	    0x0000, 0x2835, 0x1aa2, 0x0328, 0x0000, 0x3753, 0x0000, 0x2df2,
+	    0x2e4b, 0x192c, 0x0056, 0x4d6a, 0x4554, 0x10de, 0x4751, 0x3753,
+	    0x1900, 0x4bd8, 0x2501, 0x13ec, 0x3346, 0x2cfe, 0x0000, 0x3a5c,
+	    0x136f, 0x1e6f, 0x3fa8, 0x0000, 0x0000, 0x0817, 0x00c2, 0x47b8,
+	    0x36a5, 0x1a57, 0x1609, 0x06ec, 0x4015, 0x157c, 0x0d07, 0x2bba,
+	    0x02af, 0x0000, 0x31de, 0x1315, 0x0000, 0x3347, 0x128c, 0x046c,
+	    0x4cf5, 0x3234, 0x0000, 0x25d2, 0x2fb9, 0x2dc6, 0x004c, 0x2c84,
+	    0x0000, 0x2b29, 0x17bc, 0x1b21, 0x0000, 0x0000, 0x370c, 0x13ed,
+	    0x0a4b, 0x258b, 0x347d, 0x275a, 0x3f26, 0x09e9, 0x19cd, 0x39f2,
+	    0x3e09, 0x3ad2, 0x2b0d, 0x3947, 0x20f0, 0x1cc8, 0x2eb5, 0x49f9,
+	    0x09c7, 0x3e8b, 0x374a, 0x4154, 0x4a04, 0x0000, 0x29cc, 0x455e,
+	    0x4854, 0x0000, 0x21bb, 0x226b, 0x2c5d, 0x0c12, 0x302b, 0x2675,
+	    0x4b63, 0x0949, 0x0000, 0x3b16, 0x1607, 0x2b0a, 0x3bcc, 0x0000,
+	    0x13a5, 0x1783, 0x1d50, 0x447d, 0x34fe, 0x1825, 0x28ad, 0x3209,
+	    0x4350, 0x06ca, 0x0000, 0x23c5, 0x2dc0, 0x3498, 0x263f, 0x0000,
+	    0x329a, 0x0000, 0x4d59, 0x29d4, 0x0fe8, 0x37d9, 0x4878, 0x37f5,
+	    0x39ca, 0x418d, 0x3bec, 0x3bcf, 0x0208, 0x09ce, 0x0000, 0x3a4a,
+	    0x0200, 0x4b09, 0x276c, 0x348e, 0x3b0f, 0x0000, 0x0973, 0x46dc,
+	    0x0000, 0x1bfb, 0x0000, 0x09d7, 0x1b20, 0x189a, 0x18d2, 0x3ea5,
+	    0x0000, 0x1c43, 0x0000, 0x0000, 0x20ff, 0x1be3, 0x2e70, 0x3dc5,
+	    0x238a, 0x4081, 0x0b51, 0x446a, 0x26c8, 0x27ef, 0x0000, 0x2be7,
+	    0x12ff, 0x21a8, 0x02a0, 0x40b2, 0x0000, 0x0123, 0x055f, 0x3325,
+	    0x280a, 0x2be2, 0x4c16, 0x396e, 0x10fc, 0x33c0, 0x4a68, 0x1618,
+	    0x14ab, 0x4042, 0x3790, 0x0b80, 0x10cf, 0x1462, 0x0000, 0x1eb4,
+	    0x0186, 0x0000, 0x249d, 0x391d, 0x0000, 0x0fa8, 0x3748, 0x3737,
+	    0x0000, 0x1e62, 0x0000, 0x04fa, 0x4560, 0x2372, 0x2b95, 0x3a83,
+	    0x0000, 0x0abb, 0x40d3, 0x26c5, 0x369f, 0x2fa2, 0x3fc4, 0x4387,
+	    0x34d8, 0x35a4, 0x0000, 0x25ea, 0x04d0, 0x2d74, 0x3f2f, 0x3bab,
+	    0x1781, 0x0000, 0x0000, 0x0000, 0x15b7, 0x0000, 0x0b73, 0x0c76,
+	    0x3920, 0x0000, 0x10cd, 0x4380, 0x27f2, 0x4b8f, 0x0000, 0x0aa1,
+	    0x472d, 0x2cb4, 0x38e1, 0x0000, 0x162a, 0x3f92, 0x0949, 0x0c4b,
+	    0x0000, 0x2f57, 0x23a6, 0x36aa, 0x0428, 0x3709, 0x0f72, 0x0000,
+	    0x0000, 0x2ec8, 0x36bb, 0x22f2, 0x0000, 0x48ce, 0x4021, 0x0797,
+	    0x2af9, 0x25ea, 0x4892, 0x089e, 0x2b92, 0x37bf, 0x35c8, 0x4230,
+	    0x12f9, 0x1dd4, 0x3291, 0x0000, 0x3a44, 0x259f, 0x16af, 0x3e1b,
+	    0x35a3, 0x0000, 0x276f, 0x10e0, 0x1be4, 0x0000, 0x0bcb, 0x2ee0,
+	    0x32fb, 0x2e78, 0x0000, 0x043a, 0x06b4, 0x31b0, 0x1c57, 0x03b0,
+	    0x496d, 0x3af8, 0x1e91, 0x0496, 0x3263, 0x0000, 0x0000, 0x276f,
+	    0x0000, 0x22ad, 0x08d9, 0x3678, 0x22fb, 0x0000, 0x2bcf, 0x2ff5,
+	    0x4c7e, 0x1aef, 0x01fd, 0x0855, 0x36bb, 0x20fb, 0x3d1d, 0x345d,
+	    0x4d42, 0x0218, 0x2524, 0x0cb4, 0x0a9b, 0x0561, 0x216c, 0x0991,
+	    0x1a53, 0x1425, 0x3366, 0x0a85, 0x4dc4, 0x3277, 0x0000, 0x0000,
+	    0x0000, 0x1c9d, 0x2e19, 0x0a75, 0x0fb4, 0x3169, 0x3b19, 0x0000,
+	    0x0ced, 0x0000, 0x2d4e, 0x1278, 0x0000, 0x2f20, 0x1cc2, 0x1655,
+	    0x09f4, 0x0000, 0x079b, 0x11fa, 0x1387, 0x0000, 0x3ae3, 0x0644,
+	    0x3301, 0x3999, 0x3266, 0x2324, 0x05fd, 0x0647, 0x10c2, 0x0ab6,
+	    0x3ae1, 0x0000, 0x3354, 0x0000, 0x3292, 0x1caf, 0x4364, 0x11bd,
+	    0x36c1, 0x18c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a75, 0x0000,
+	    0x13ec, 0x0edd, 0x25a1, 0x0000, 0x116b, 0x2c7a, 0x496a, 0x0000,
+	    0x215d, 0x432b, 0x3426, 0x215b, 0x020b, 0x0000, 0x0000, 0x1381,
+	    0x36fb, 0x3c81, 0x3d3a, 0x0948, 0x4155, 0x29fa, 0x3f5e, 0x40ee,
+	    0x4dc0, 0x12ab, 0x2219, 0x0000, 0x15a6, 0x1399, 0x4820, 0x0000,
+	    0x3f3b, 0x0e7c, 0x4ad8, 0x27fb, 0x2b13, 0x0000, 0x0c47, 0x0dc0,
+	    0x17a3, 0x02ee, 0x2d10, 0x1b36, 0x23cb, 0x129b, 0x44b3, 0x12df,
+	    0x3a7b, 0x0c58, 0x1880, 0x382c, 0x3bbe, 0x4cb1, 0x1946, 0x4b39,
+	    0x3451, 0x43c6, 0x1e2f, 0x27a7, 0x4325, 0x0b75, 0x1fca, 0x1202,
+	    0x0a52, 0x0c1f, 0x1771, 0x2bf0, 0x107e, 0x1f39, 0x0000, 0x0000,
+	    0x4669, 0x04ae, 0x1cc7, 0x1cfa, 0x472f, 0x4001, 0x2dc2, 0x2549,
+	    0x2919, 0x116f, 0x42e5, 0x2fa5, 0x47bf, 0x01e9, 0x0a08, 0x346b,
+	    0x0000, 0x1351, 0x0cba, 0x0000, 0x1d4e, 0x41d2, 0x4a94, 0x055f,
+	    0x3eaf, 0x3315, 0x111c, 0x3b0c, 0x43b0, 0x3565, 0x0000, 0x1922,
+	    0x3959, 0x3371, 0x1ee9, 0x26a3, 0x3eef, 0x0000, 0x3902, 0x0bf9,
+	    0x0000, 0x053a, 0x08b9, 0x101f, 0x3a32, 0x26b7, 0x02f7, 0x162c,
+	    0x0000, 0x3c08, 0x14fc, 0x0000, 0x06f8, 0x2199, 0x0d84, 0x2c85,
+	    0x461a, 0x0da6, 0x303f, 0x1576, 0x0357, 0x2622, 0x3ba6, 0x3271,
+	    0x0000, 0x2aa1, 0x2f51, 0x4655, 0x2f43, 0x21af, 0x1368, 0x21e0,
+	    0x052a, 0x1d9f, 0x0000, 0x24b6, 0x039d, 0x32e1, 0x1b59, 0x0000,
+	    0x456e, 0x1c1b, 0x30ef, 0x08b0, 0x1b04, 0x06fb, 0x486d, 0x3f56,
+	    0x0678, 0x0000, 0x3db8, 0x03c7, 0x0000, 0x0000, 0x44b8, 0x2642,
+	    0x3a9f, 0x2b03, 0x32e6, 0x4db5, 0x1b72, 0x37f1, 0x4d79, 0x2d5c,
+	    0x48b1, 0x197a, 0x3c0c, 0x4015, 0x25ff, 0x46cd, 0x3816, 0x46c0,
+	    0x35dd, 0x30c2, 0x2c39, 0x2e41, 0x369a, 0x0d8c, 0x06b6, 0x0000,
+	    0x3aa7, 0x46c2, 0x0000, 0x37e3, 0x2479, 0x2d9e, 0x3342, 0x2aad,
+	    0x071d, 0x2e36, 0x4ab4, 0x0a64, 0x4337, 0x3913, 0x2c35, 0x167f,
+	    0x1acc, 0x12dc, 0x3554, 0x316f, 0x020b, 0x48ef, 0x10f4, 0x3e20,
+	    0x06e0, 0x1c44, 0x0000, 0x2b24, 0x2bb2, 0x44f6, 0x22e1, 0x40bd,
+	    0x4824, 0x4389, 0x256e, 0x4949, 0x3de4, 0x372b, 0x1c24, 0x2f20,
+	    0x4d09, 0x0000, 0x0000, 0x1ff0, 0x0000, 0x0000, 0x1fb2, 0x0000,
+	    0x30a0, 0x2208, 0x0b0e, 0x4461, 0x0000, 0x288d, 0x0000, 0x17b1,
+	    0x0393, 0x3e2a, 0x2886, 0x1cd0, 0x04ae, 0x178f, 0x0a96, 0x3d9e,
+	    0x2ada, 0x39c2, 0x30ca, 0x08a6, 0x0d9a, 0x3dba, 0x0000, 0x04c9,
+	    0x0866, 0x0000, 0x0966, 0x1fc0, 0x300f, 0x0490, 0x3a3a, 0x2350,
+	    0x0fec, 0x4896, 0x07c4, 0x0000, 0x012a, 0x12fe, 0x2d96, 0x0754,
+	    0x1498, 0x08bc, 0x21f4, 0x10b7, 0x0000, 0x18e7, 0x0000, 0x3dc6,
+	    0x0000, 0x3f14, 0x0000, 0x0a23, 0x25b3, 0x39fa, 0x1a2f, 0x0000,
+	    0x373c, 0x3773, 0x169d, 0x1415, 0x0000, 0x2fb5, 0x3b31, 0x2853,
+	    0x1220, 0x0895, 0x2db6, 0x2454, 0x2916, 0x20ce, 0x2976, 0x0291,
+	    0x0000, 0x0000, 0x3bc6, 0x0424, 0x0000, 0x3bd0, 0x0000, 0x2bfb,
+	    0x0000, 0x4677, 0x1919, 0x00ad, 0x11ad, 0x35c1, 0x13fe, 0x20e5,
+	    0x013b, 0x4ab8, 0x1c73, 0x18e6, 0x3a9f, 0x4b4f, 0x0000, 0x0086,
+	    0x1b35, 0x22d9, 0x042c, 0x298a, 0x0000, 0x3d32, 0x010e, 0x398a,
+	    0x4216, 0x33cf, 0x29d5, 0x35b6, 0x0ec2, 0x1eae, 0x1f90, 0x0000,
+	    0x0c09, 0x0000, 0x442f, 0x33ac, 0x4b93, 0x488f, 0x0000, 0x0000,
+	    0x2b3e, 0x0000, 0x34cf, 0x3468, 0x1d62, 0x0587, 0x0000, 0x09da,
+	    0x04e8, 0x4576, 0x2d03, 0x0c20, 0x0000, 0x23a1, 0x4d71, 0x4d77,
+	    0x2465, 0x2419, 0x0000, 0x3be6, 0x0670, 0x1552, 0x2e77, 0x1192,
+	    0x3d33, 0x46bc, 0x0000, 0x393d, 0x2160, 0x4dac, 0x3f2f, 0x12c3,
+	    0x0000, 0x22c9, 0x3909, 0x3d2f, 0x15ee, 0x384d, 0x2ac6, 0x24ae,
+	    0x0a60, 0x0000, 0x184d, 0x49c2, 0x2379, 0x2738, 0x1aca, 0x0411,
+	    0x0000, 0x3021, 0x42a4, 0x271a, 0x3db3, 0x1379, 0x0b94, 0x31fa,
+	    0x018a, 0x0957, 0x0580, 0x4721, 0x3303, 0x21ac, 0x46e4, 0x0f98,
+	    0x0000, 0x0987, 0x0000, 0x47e5, 0x18fe, 0x434f, 0x1131, 0x33ce,
+	    0x440d, 0x3af6, 0x213a, 0x38a7, 0x0000, 0x3c65, 0x033e, 0x3704,
+	    0x134b, 0x0000, 0x2f72, 0x1b39, 0x3f47, 0x0af6, 0x233f, 0x159b,
+	    0x4ab3, 0x0601, 0x1bf5, 0x3fee, 0x2e2a, 0x2350, 0x42f9, 0x195a,
+	    0x46fb, 0x1aab, 0x0d5d, 0x0000, 0x1a8d, 0x1c4c, 0x0000, 0x0000,
+	    0x0705, 0x183f, 0x353d, 0x0000, 0x17de, 0x2296, 0x1451, 0x199d,
+	    0x0000, 0x0000, 0x29fe, 0x2d21, 0x1e4f, 0x08ed, 0x46c2, 0x053a,
+	    0x0db0, 0x10cc, 0x2d5c, 0x4477, 0x3874, 0x1312, 0x31c1, 0x28e4,
+	    0x1842, 0x0000, 0x2bb6, 0x179b, 0x3791, 0x1d12, 0x393d, 0x338c,
+	    0x46f9, 0x4529, 0x3727, 0x0b78, 0x46eb, 0x1317, 0x3a19, 0x139e,
+	    0x3148, 0x0ff9, 0x0000, 0x49ad, 0x0000, 0x07e3, 0x0000, 0x2050,
+	    0x16a3, 0x0000, 0x12f1, 0x1b22, 0x17ac, 0x2e6a, 0x061e, 0x2153,
+	    0x2804, 0x47af, 0x0000, 0x0208, 0x4905, 0x3a2e, 0x4b1b, 0x4932,
+	    0x18c1, 0x2f78, 0x1d54, 0x4c84, 0x0d93, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4308, 0x1979, 0x3f7f, 0x2d13, 0x01e1, 0x18c3, 0x0330,
+	    0x2e6f, 0x0000, 0x17a9, 0x067d, 0x1fb6, 0x4577, 0x1bcf, 0x2942,
+	    0x21f1, 0x1198, 0x1e80, 0x046c, 0x33e8, 0x0945, 0x363b, 0x1a95,
+	    0x4cf3, 0x0934, 0x150a, 0x20e7, 0x3db5, 0x1507, 0x1c01, 0x0000,
+	    0x21ba, 0x3dac, 0x0f6d, 0x381c, 0x2b32, 0x01a6, 0x3d2e, 0x0000,
+	    0x1a11, 0x0787, 0x212a, 0x374e, 0x4ba1, 0x3b69, 0x0d06, 0x3807,
+	    0x4653, 0x3bc1, 0x0016, 0x0000, 0x4c65, 0x4437, 0x3986, 0x0d88,
+	    0x3539, 0x4d8d, 0x2efe, 0x0000, 0x1577, 0x4164, 0x25b1, 0x20e5,
+	    0x43cc, 0x1414, 0x0000, 0x372d, 0x4a3d, 0x1412, 0x47fd, 0x258b,
+	    0x1c18, 0x19ad, 0x1d9f, 0x2ba5, 0x0fac, 0x3e0d, 0x2356, 0x19d1,
+	    0x0000, 0x2f46, 0x44c1, 0x1a89, 0x4a42, 0x0685, 0x2b07, 0x020f,
+	    0x0000, 0x1d2f, 0x0000, 0x385f, 0x3320, 0x42b2, 0x0000, 0x0000,
+	    0x40e7, 0x0000, 0x1a34, 0x0000, 0x4cfc, 0x0468, 0x247e, 0x3a91,
+	    0x0000, 0x1ed6, 0x4683, 0x3013, 0x4e17, 0x1a4a, 0x45da, 0x2839,
+	    0x2be5, 0x3f44, 0x0000, 0x2cac, 0x20b1, 0x0000, 0x2301, 0x03cd,
+	    0x227a, 0x4e09, 0x0000, 0x0fd0, 0x0000, 0x371a, 0x012f, 0x0000,
+	    0x0000, 0x21d4, 0x181b, 0x0000, 0x2e15, 0x2ecf, 0x440b, 0x38c1,
+	    0x304e, 0x2f6c, 0x00f8, 0x085d, 0x270d, 0x0000, 0x440c, 0x0000,
+	    0x0000, 0x0041, 0x043c, 0x4b9a, 0x48fc, 0x2389, 0x0b94, 0x24da,
+	    0x2e33, 0x1415, 0x468a, 0x42df, 0x1288, 0x349a, 0x3c42, 0x31c8,
+	    0x0000, 0x22d5, 0x0000, 0x4521, 0x22e4, 0x1c58, 0x3c21, 0x2034,
+	    0x0b8f, 0x2a8a, 0x06aa, 0x0000, 0x1ffe, 0x2446, 0x27ea, 0x34bd,
+	    0x0cd1, 0x39d0, 0x18b3, 0x4b01, 0x2193, 0x42cf, 0x19f5, 0x30c3,
+	    0x3d09, 0x0318, 0x0000, 0x227d, 0x0000, 0x0000, 0x1a0c, 0x0862,
+	    0x0000, 0x2064, 0x41d5, 0x0000, 0x016c, 0x1aad, 0x2c6a, 0x3e36,
+	    0x1631, 0x37c1, 0x4276, 0x15e7, 0x29bd, 0x18e5, 0x0000, 0x47ca,
+	    0x3b2c, 0x0000, 0x28d1, 0x0b11, 0x05ec, 0x0000, 0x09b7, 0x4b94,
+	    0x2758, 0x14bc, 0x37b9, 0x0b73, 0x0000, 0x32c7, 0x0000, 0x3976,
+	    0x17c6, 0x3d0a, 0x11d3, 0x27a4, 0x43e9, 0x4253, 0x1245, 0x2cfe,
+	    0x368e, 0x3b11, 0x18fe, 0x15a1, 0x381b, 0x1efc, 0x3d5f, 0x3ed5,
+	    0x309e, 0x4c06, 0x1e45, 0x14dd, 0x3042, 0x3876, 0x1d7f, 0x2934,
+	    0x0000, 0x0000, 0x3215, 0x18ce, 0x4c27, 0x3b77, 0x01d4, 0x4745,
+	    0x2537, 0x3f37, 0x0000, 0x0000, 0x4122, 0x2f21, 0x00da, 0x03b9,
+	    0x3672, 0x1251, 0x4a1d, 0x0000, 0x3d36, 0x1106, 0x3d16, 0x0b89,
+	    0x0000, 0x1b4a, 0x23b8, 0x36fd, 0x15ca, 0x0000, 0x472e, 0x4adf,
+	    0x37d5, 0x0540, 0x325d, 0x164c, 0x1f9c, 0x4178, 0x1c31, 0x282f,
+	    0x0000, 0x3d95, 0x0000, 0x2955, 0x3303, 0x3438, 0x2009, 0x0000,
+	    0x2243, 0x0000, 0x1980, 0x1183, 0x45e1, 0x33a7, 0x43ff, 0x3d2d,
+	    0x322d, 0x3d5b, 0x10b5, 0x0000, 0x2ee5, 0x1cc0, 0x1999, 0x3f07,
+	    0x3d67, 0x0000, 0x1351, 0x03f6, 0x0e7d, 0x4546, 0x2e40, 0x16f4,
+	    0x19ca, 0x0000, 0x2812, 0x1be1, 0x378c, 0x0a41, 0x1c04, 0x08ae,
+	    0x13ef, 0x39c5, 0x0806, 0x4d3b, 0x0b22, 0x2529, 0x193a, 0x4d8c,
+	    0x26f7, 0x188f, 0x2c88, 0x4b7b, 0x0000, 0x3d01, 0x0000, 0x4b69,
+	    0x0000, 0x1ba2, 0x00a4, 0x0047, 0x160c, 0x060f, 0x0000, 0x17cf,
+	    0x0000, 0x161a, 0x328d, 0x1ded, 0x0000, 0x3aa5, 0x010b, 0x0000,
+	    0x44a8, 0x045c, 0x1ea0, 0x3d9c, 0x37ef, 0x09f3, 0x2bc2, 0x20ff,
+	    0x0000, 0x0495, 0x1e4c, 0x208a, 0x4304, 0x1252, 0x23bc, 0x367b,
+	    0x2bc2, 0x426a, 0x0e26, 0x3218, 0x0000, 0x38d0, 0x4422, 0x2e7f,
+	    0x3c7d, 0x0000, 0x48cf, 0x1b57, 0x0000, 0x16e0, 0x0000, 0x2e6b,
+	    0x3f4e, 0x07aa, 0x3181, 0x0f75, 0x42ea, 0x384e, 0x06c6, 0x11a8,
+	    0x2b78, 0x4c8c, 0x0000, 0x3bbb, 0x49df, 0x3a37, 0x1ac0, 0x42cc,
+	    0x0000, 0x0000, 0x32d3, 0x2c39, 0x0000, 0x3cc3, 0x0550, 0x3d7b,
+	    0x0000, 0x38b7, 0x275c, 0x0000, 0x436d, 0x0000, 0x0000, 0x37b1,
+	    0x1d3d, 0x019e, 0x377a, 0x442f, 0x45b7, 0x0000, 0x0000, 0x20bc,
+	    0x4ce3, 0x1469, 0x0000, 0x2a12, 0x16b1, 0x20f7, 0x0000, 0x3a82,
+	    0x44b8, 0x375a, 0x3201, 0x093f, 0x0fe1, 0x18c7, 0x34d1, 0x2e49,
+	    0x4d14, 0x2ce9, 0x0000, 0x0158, 0x2bf2, 0x49ed, 0x0b63, 0x0f08,
+	    0x31c7, 0x364f, 0x0035, 0x1f8d, 0x48d6, 0x4267, 0x45d9, 0x3ff7,
+	    0x3c8b, 0x1b8f, 0x2d82, 0x3206, 0x20bd, 0x0000, 0x0000, 0x2604,
+	    0x1b7a, 0x3c14, 0x2630, 0x0618, 0x009c, 0x012b, 0x0455, 0x3ea5,
+	    0x429c, 0x0b16, 0x136c, 0x2f2a, 0x4b4d, 0x4378, 0x0fb3, 0x2dc6,
+	    0x15fd, 0x0000, 0x0f9b, 0x4cd1, 0x1706, 0x0682, 0x1061, 0x2813,
+	    0x36ef, 0x21c8, 0x1c0a, 0x0000, 0x0c36, 0x0d2a, 0x16c8, 0x1ead,
+	    0x0000, 0x3ce0, 0x1101, 0x3aa1, 0x39d6, 0x116f, 0x1180, 0x3065,
+	    0x4c8d, 0x4452, 0x0000, 0x01fb, 0x12ae, 0x2592, 0x4419, 0x0181,
+	    0x0000, 0x0000, 0x1925, 0x1b17, 0x3969, 0x18bd, 0x42f0, 0x0d30,
+	    0x1559, 0x011c, 0x0000, 0x26a7, 0x493e, 0x054d, 0x1a8a, 0x2be2,
+	    0x3c8e, 0x22a4, 0x2ea5, 0x28cc, 0x13d4, 0x43d8, 0x0c49, 0x0000,
+	    0x0000, 0x0e31, 0x0000, 0x4ab1, 0x0000, 0x3386, 0x01c9, 0x1750,
+	    0x3dc5, 0x3694, 0x2d9f, 0x199d, 0x170d, 0x0937, 0x1093, 0x2629,
+	    0x397a, 0x0000, 0x104c, 0x1158, 0x0000, 0x2b6d, 0x023c, 0x29e8,
+	    0x4796, 0x0647, 0x275b, 0x0674, 0x34b5, 0x3a23, 0x0a88, 0x080a,
+	    0x0a77, 0x1592, 0x0e23, 0x201f, 0x2563, 0x39d3, 0x0f8a, 0x1109,
+	    0x490f, 0x0770, 0x32de, 0x1d05, 0x2cb0, 0x455f, 0x2432, 0x0000,
+	    0x0000, 0x2e75, 0x0000, 0x42ef, 0x2d9d, 0x1d91, 0x189f, 0x054d,
+	    0x00a3, 0x01c5, 0x2978, 0x0000, 0x4337, 0x16c7, 0x370a, 0x40ce,
+	    0x2626, 0x0000, 0x0521, 0x0000, 0x0000, 0x4589, 0x08e8, 0x0000,
+	    0x346b, 0x3e8a, 0x12c2, 0x0000, 0x0000, 0x0e55, 0x3510, 0x4b72,
+	    0x29f4, 0x4aa0, 0x4cfd, 0x0000, 0x365c, 0x0000, 0x2892, 0x0000,
+	    0x2333, 0x2a29, 0x0000, 0x0000, 0x0000, 0x0000, 0x1339, 0x2b7a,
+	    0x0000, 0x47f0, 0x1bb2, 0x28c3, 0x2e64, 0x0827, 0x2355, 0x19bb,
+	    0x166e, 0x0434, 0x01f7, 0x131d, 0x2278, 0x0000, 0x4b76, 0x0000,
+	    0x0088, 0x330c, 0x04c3, 0x1b51, 0x35f3, 0x0000, 0x0000, 0x1802,
+	    0x1482, 0x0f5e, 0x48e6, 0x2ea4, 0x301f, 0x3579, 0x47d7, 0x2fa2,
+	    0x4023, 0x2216, 0x0000, 0x0000, 0x0000, 0x08e6, 0x4dd0, 0x0000,
+	    0x370a, 0x0032, 0x4df7, 0x0000, 0x269c, 0x2ca6, 0x48f8, 0x33df,
+	    0x0000, 0x1fce, 0x4bcf, 0x23d1, 0x0ad0, 0x1003, 0x150c, 0x46e7,
+	    0x49cb, 0x0000, 0x0000, 0x155d, 0x3b37, 0x2ffa, 0x3490, 0x276f,
+	    0x28a1, 0x2cd8, 0x0ce8, 0x0000, 0x0000, 0x3ea0, 0x40dc, 0x1e2d,
+	    0x2c78, 0x1309, 0x265a, 0x3386, 0x3a37, 0x4a2e, 0x17c9, 0x20d6,
+	    0x0000, 0x0000, 0x08d9, 0x0000, 0x00c0, 0x0000, 0x4727, 0x2264,
+	    0x239e, 0x39d7, 0x1725, 0x4b08, 0x0000, 0x0000, 0x0f1f, 0x360b,
+	    0x1238, 0x0000, 0x1624, 0x3ea1, 0x15f6, 0x0000, 0x0000, 0x40b9,
+	    0x3a03, 0x2951, 0x3a20, 0x1ba4, 0x0000, 0x3c82, 0x3ff8, 0x14d4,
+	    0x04b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x338c, 0x1931,
+	    0x0000, 0x0000, 0x2379, 0x0000, 0x3330, 0x329b, 0x055b, 0x05e1,
+	    0x2da5, 0x0000, 0x4bc9, 0x4081, 0x2cb3, 0x0000, 0x033b, 0x21a2,
+	    0x2ea2, 0x3f3a, 0x0e8c, 0x2f66, 0x0203, 0x132f, 0x4185, 0x0000,
+	    0x0000, 0x0000, 0x1ae3, 0x29b5, 0x0918, 0x30e2, 0x4481, 0x1ca0,
+	    0x30b3, 0x0ef5, 0x2c48, 0x0000, 0x4723, 0x2b1d, 0x3a50, 0x2a75,
+	    0x29ea, 0x468c, 0x20fe, 0x1a0d, 0x031d, 0x4871, 0x01f3, 0x2911,
+	    0x0000, 0x2341, 0x3e19, 0x01c1, 0x4da1, 0x27a8, 0x4d04, 0x3668,
+	    0x4548, 0x17bc, 0x0023, 0x28a9, 0x081a, 0x4aee, 0x4d43, 0x0000,
+	    0x2951, 0x3717, 0x0000, 0x087d, 0x0d26, 0x4c42, 0x33d6, 0x1b30,
+	    0x45d0, 0x460e, 0x4a8c, 0x030f, 0x4d37, 0x07c4, 0x0000, 0x450c,
+	    0x0000, 0x1d7f, 0x0b43, 0x473d, 0x214a, 0x1883, 0x2258, 0x3dc2,
+	    0x092a, 0x0000, 0x12c7, 0x2ac9, 0x470b, 0x1ca2, 0x01e2, 0x4875,
+	    0x1886, 0x129b, 0x0ac1, 0x19c6, 0x0372, 0x1f88, 0x0000, 0x3ad8,
+	    0x0000, 0x09af, 0x1275, 0x4d31, 0x0000, 0x2b9b, 0x1b16, 0x34b8,
+	    0x3753, 0x40cb, 0x3d3a, 0x0a9e, 0x44e5, 0x0000, 0x06a4, 0x151d,
+	    0x310b, 0x03a8, 0x0000, 0x0071, 0x257a, 0x0000, 0x1720, 0x2788,
+	    0x27f4, 0x0000, 0x48ae, 0x0000, 0x147e, 0x09f9, 0x2b89, 0x20bd,
+	    0x47d0, 0x3983, 0x3a43, 0x0000, 0x0902, 0x1e56, 0x294d, 0x3684,
+	    0x48e1, 0x26db, 0x4bd6, 0x14ac, 0x0000, 0x0000, 0x1feb, 0x0ba0,
+	    0x3b7d, 0x0030, 0x38ed, 0x393c, 0x42b0, 0x0d94, 0x447f, 0x2a74,
+	    0x35a3, 0x39e6, 0x078d, 0x0000, 0x1acf, 0x0e82, 0x097d, 0x0000,
+	    0x09c5, 0x13c0, 0x0000, 0x0000, 0x4c5c, 0x422c, 0x1b7a, 0x3cfb,
+	    0x1c1a, 0x2191, 0x49a7, 0x1cba, 0x017f, 0x19b1, 0x46c4, 0x34f2,
+	    0x0000, 0x0000, 0x044a, 0x2df4, 0x48a9, 0x25b8, 0x0000, 0x0000,
+	    0x197d, 0x26ee, 0x3666, 0x09b1, 0x1d10, 0x1ebe, 0x1493, 0x1c02,
+	    0x0000, 0x31ef, 0x4c3b, 0x3536, 0x4048, 0x01e0, 0x0000, 0x3a3d,
+	    0x44e4, 0x2b2c, 0x24c9, 0x0738, 0x3231, 0x46b3, 0x3441, 0x0000,
+	    0x407c, 0x02a3, 0x45b3, 0x0000, 0x0000, 0x4189, 0x0000, 0x17a9,
+	    0x2859, 0x423d, 0x0b7b, 0x2353, 0x2dae, 0x1dbd, 0x0ebd, 0x4a41,
+	    0x4c43, 0x210f, 0x041f, 0x39d1, 0x2b5d, 0x0000, 0x0000, 0x31d4,
+	    0x0000, 0x4135, 0x47e4, 0x3c96, 0x2b7d, 0x2b1a, 0x4db6, 0x21ae,
+	    0x074b, 0x09e8, 0x0b65, 0x34c9, 0x0c05, 0x4984, 0x1881, 0x0000,
+	    0x3ce3, 0x2bf0, 0x46dd, 0x1085, 0x01a3, 0x48e4, 0x0000, 0x4964,
+	    0x2401, 0x0000, 0x31c0, 0x2e91, 0x0ea6, 0x17bc, 0x1b05, 0x36fe,
+	    0x0628, 0x3782, 0x1110, 0x0d53, 0x2efe, 0x271f, 0x3a75, 0x3795,
+	    0x20cf, 0x0000, 0x13c5, 0x0d37, 0x0000, 0x0000, 0x253c, 0x0000,
+	    0x4bad, 0x1591, 0x14be, 0x1f64, 0x0189, 0x19b1, 0x32c8, 0x3408,
+	    0x48f8, 0x14e1, 0x09c3, 0x0000, 0x4183, 0x2ed6, 0x18a3, 0x24e5,
+	    0x2401, 0x34f1, 0x34fc, 0x0000, 0x3a49, 0x26e6, 0x433c, 0x0000,
+	    0x36fa, 0x1b1c, 0x0484, 0x3da7, 0x0000, 0x00e2, 0x47c0, 0x44fc,
+	    0x2c21, 0x0be1, 0x019a, 0x0000, 0x3a8b, 0x0000, 0x13e1, 0x2d5d,
+	    0x0000, 0x14ee, 0x243a, 0x2c8e, 0x3b49, 0x0a19, 0x2301, 0x4004,
+	    0x3356, 0x1b34, 0x25f6, 0x0000, 0x115d, 0x19fc, 0x0000, 0x4c9c,
+	    0x0000, 0x0370, 0x3481, 0x0000, 0x1e49, 0x0000, 0x07bb, 0x1ab5,
+	    0x4860, 0x488b, 0x0000, 0x1034, 0x2685, 0x44a1, 0x4461, 0x0e38,
+	    0x1359, 0x209b, 0x4163, 0x1251, 0x0000, 0x27e3, 0x270a, 0x0f60,
+	    0x03d3, 0x0000, 0x2ca5, 0x3020, 0x3aa4, 0x0e6a, 0x09fb, 0x2032,
+	    0x0709, 0x0000, 0x3afb, 0x100e, 0x22ee, 0x4d82, 0x1faf, 0x470a,
+	    0x0000, 0x0000, 0x3c6e, 0x2227, 0x1d68, 0x3b0c, 0x234d, 0x0000,
+	    0x2425, 0x19b7, 0x027a, 0x2b5d, 0x4c1c, 0x4464, 0x47c9, 0x03ec,
+	    0x3562, 0x379d, 0x4616, 0x1b90, 0x3515, 0x0000, 0x35ba, 0x4dcf,
+	    0x12eb, 0x0000, 0x2a51, 0x49ac, 0x1ba3, 0x16e5, 0x459b, 0x090d,
+	    0x0926, 0x086b, 0x1bb5, 0x0000, 0x4cf3, 0x1a06, 0x0000, 0x3867,
+	    0x06cf, 0x2887, 0x0104, 0x4b49, 0x2f10, 0x2cd9, 0x1520, 0x0000,
+	    0x00f3, 0x3ebc, 0x2f5e, 0x4b58, 0x0f5c, 0x2114, 0x0000, 0x2a6b,
+	    0x3619, 0x0000, 0x1e11, 0x37e4, 0x3634, 0x2e1d, 0x0ef8, 0x3ab0,
+	    0x1331, 0x222d, 0x0d9d, 0x3e0b, 0x3cb3, 0x40f4, 0x3bb6, 0x2e2c,
+	    0x07f0, 0x07ec, 0x219f, 0x47f2, 0x4250, 0x41f1, 0x338d, 0x1915,
+	    0x0367, 0x1aaf, 0x0000, 0x3cc4, 0x3916, 0x2664, 0x2d55, 0x01c9,
+	    0x2f99, 0x03bb, 0x0000, 0x3cbc, 0x0648, 0x0000, 0x0000, 0x4c96,
+	    0x29f6, 0x2513, 0x2266, 0x0a37, 0x2e5f, 0x0ccd, 0x2efe, 0x2b52,
+	    0x3f00, 0x0d2f, 0x2d04, 0x3bbb, 0x202f, 0x1b1f, 0x3811, 0x0e33,
+	    0x1541, 0x31fa, 0x28d3, 0x0000, 0x3da0, 0x0bbc, 0x3247, 0x0b35,
+	    0x3ba5, 0x496b, 0x3b33, 0x3617, 0x0000, 0x337b, 0x0cd7, 0x491c,
+	    0x3faa, 0x472e, 0x45c3, 0x196c, 0x4d3a, 0x0000, 0x2a8d, 0x3d8a,
+	    0x113e, 0x3858, 0x2979, 0x212f, 0x3169, 0x3ce4, 0x07a2, 0x31fa,
+	    0x0843, 0x4b36, 0x0000, 0x2767, 0x142e, 0x3af6, 0x00b1, 0x4c93,
+	    0x0619, 0x1781, 0x3e1d, 0x14f5, 0x0ad3, 0x3dd3, 0x3538, 0x435c,
+	    0x0297, 0x24e0, 0x006a, 0x4c81, 0x49ad, 0x03ed, 0x32ea, 0x4c41,
+	    0x49c2, 0x0000, 0x3baf, 0x1d88, 0x46fa, 0x0fbf, 0x1338, 0x48f3,
+	    0x43c5, 0x0dbc, 0x3f08, 0x0000, 0x232f, 0x1753, 0x26df, 0x458d,
+	    0x3bc2, 0x0000, 0x2309, 0x0000, 0x1c80, 0x466c, 0x16f8, 0x4c5f,
+	    0x4b95, 0x29a4, 0x4094, 0x1b7f, 0x41de, 0x3806, 0x3914, 0x3b9d,
+	    0x3faf, 0x0000, 0x2b36, 0x2ecd, 0x0000, 0x0000, 0x2f2b, 0x15f4,
+	    0x0000, 0x1718, 0x263f, 0x0d21, 0x245e, 0x0fb2, 0x0000, 0x0bc8,
+	    0x1f22, 0x0000, 0x31ae, 0x1c91, 0x0aab, 0x3198, 0x1c0b, 0x4cc1,
+	    0x0311, 0x20aa, 0x227b, 0x0943, 0x341c, 0x0000, 0x1b35, 0x0000,
+	    0x1bb3, 0x0000, 0x3a3a, 0x353d, 0x1a6e, 0x3d38, 0x259d, 0x0034,
+	    0x09b9, 0x10bd, 0x423c, 0x0159, 0x07ea, 0x3dd4, 0x0000, 0x1881,
+	    0x4d08, 0x0000, 0x104e, 0x0484, 0x0d33, 0x2444, 0x4b01, 0x3465,
+	    0x48de, 0x4e11, 0x0000, 0x2cf0, 0x0000, 0x0000, 0x3756, 0x2f73,
+	    0x1ee2, 0x34f4, 0x3525, 0x3c2a, 0x0000, 0x11c4, 0x34de, 0x28d6,
+	    0x02c7, 0x2353, 0x1eb2, 0x274d, 0x0000, 0x0000, 0x0000, 0x3373,
+	    0x2f46, 0x0000, 0x0962, 0x0a21, 0x2a81, 0x0000, 0x0000, 0x239d,
+	    0x14ed, 0x4c38, 0x4477, 0x0e10, 0x1241, 0x4c75, 0x1e93, 0x2b50,
+	    0x24dc, 0x2f20, 0x3712, 0x2347, 0x1dfe, 0x06b0, 0x0000, 0x0000,
+	    0x2159, 0x00fd, 0x4ce3, 0x2c6f, 0x185b, 0x146d, 0x1690, 0x2c27,
+	    0x416c, 0x0000, 0x4362, 0x262b, 0x3d97, 0x0000, 0x04a0, 0x1ddc,
+	    0x3c01, 0x2ed1, 0x3420, 0x41b6, 0x0f6d, 0x03ce, 0x4db8, 0x1053,
+	    0x4353, 0x0000, 0x15bc, 0x20d9, 0x4054, 0x0000, 0x0bb9, 0x206a,
+	    0x48f8, 0x0000, 0x3d68, 0x3672, 0x2680, 0x011b, 0x3660, 0x3099,
+	    0x274b, 0x0000, 0x42c0, 0x4a9e, 0x3934, 0x0c75, 0x09a3, 0x0d12,
+	    0x1486, 0x4e1a, 0x0000, 0x3752, 0x162b, 0x2d2a, 0x16e4, 0x0000,
+	    0x32f9, 0x0000, 0x2fbb, 0x4295, 0x310e, 0x0000, 0x41e4, 0x07c4,
+	    0x41f0, 0x3698, 0x3956, 0x046f, 0x2f16, 0x1066, 0x2b67, 0x0cf0,
+	    0x3a96, 0x0000, 0x2fbe, 0x488a, 0x4c6e, 0x2c6e, 0x1f85, 0x11fb,
+	    0x2d0e, 0x25a1, 0x0b2c, 0x1de3, 0x1f50, 0x1050, 0x0000, 0x2ed4,
+	    0x3238, 0x0000, 0x0000, 0x0000, 0x4b85, 0x0000, 0x0720, 0x00e6,
+	    0x4de8, 0x3662, 0x2023, 0x050c, 0x3998, 0x0000, 0x0000, 0x27ad,
+	    0x3dd2, 0x1a24, 0x17d4, 0x1764, 0x0000, 0x0951, 0x217e, 0x111d,
+	    0x0f3d, 0x45d5, 0x0584, 0x1ac5, 0x3597, 0x0021, 0x334d, 0x0870,
+	    0x123e, 0x10e6, 0x4844, 0x166e, 0x0ef0, 0x3a3b, 0x4652, 0x2e5d,
+	    0x454b, 0x064a, 0x39a7, 0x1abf, 0x191f, 0x27b2, 0x4712, 0x22f8,
+	    0x26ae, 0x1255, 0x34bd, 0x1763, 0x0000, 0x0409, 0x369a, 0x0000,
+	    0x2dc4, 0x43e6, 0x0d95, 0x0000, 0x2f3d, 0x3007, 0x239b, 0x1e53,
+	    0x18ee, 0x2e41, 0x098b, 0x0025, 0x38fe, 0x33f7, 0x4885, 0x2df1,
+	    0x143a, 0x4321, 0x3615, 0x0000, 0x4b4f, 0x363c, 0x4b9e, 0x15ca,
+	    0x1f51, 0x0000, 0x21b0, 0x0000, 0x3dda, 0x1fad, 0x06fa, 0x1b0b,
+	    0x0fe3, 0x3097, 0x3123, 0x0e65, 0x0000, 0x3e3c, 0x484e, 0x1928,
+	    0x0000, 0x0000, 0x409f, 0x0000, 0x22df, 0x1202, 0x41a8, 0x1f7c,
+	    0x1cfc, 0x0000, 0x481f, 0x1675, 0x311d, 0x0211, 0x18f2, 0x0000,
+	    0x0937, 0x4a83, 0x2574, 0x2f90, 0x4be5, 0x43c9, 0x0000, 0x4940,
+	    0x184a, 0x1856, 0x1fcf, 0x09bd, 0x0000, 0x0125, 0x3467, 0x43e8,
+	    0x377d, 0x1856, 0x23f1, 0x4aba, 0x43ab, 0x100e, 0x19b0, 0x0000,
+	    0x09fe, 0x3fc6, 0x367f, 0x4a15, 0x4a23, 0x2b3a, 0x1fb3, 0x1af0,
+	    0x0000, 0x0000, 0x3d9e, 0x2f83, 0x312f, 0x2353, 0x0000, 0x4c33,
+	    0x2597, 0x2498, 0x3ed4, 0x0000, 0x1881, 0x035e, 0x0000, 0x147c,
+	    0x3539, 0x3e8e, 0x225c, 0x0000, 0x319f, 0x1254, 0x0000, 0x146c,
+	    0x124b, 0x3997, 0x048f, 0x3a86, 0x21ec, 0x3dc2, 0x2af9, 0x2c2d,
+	    0x0000, 0x446d, 0x2da9, 0x4188, 0x1798, 0x1460, 0x0cae, 0x20c1,
+	    0x089c, 0x2764, 0x2942, 0x4583, 0x0000, 0x0000, 0x0000, 0x02dc,
+	    0x00de, 0x16eb, 0x4493, 0x4062, 0x461c, 0x15db, 0x1227, 0x2282,
+	    0x3201, 0x1d6c, 0x2eca, 0x3acf, 0x0000, 0x199f, 0x2854, 0x0000,
+	    0x254e, 0x2120, 0x013c, 0x1909, 0x2f1d, 0x0000, 0x27ce, 0x220c,
+	    0x01d6, 0x0da9, 0x09f9, 0x2bbb, 0x0000, 0x3146, 0x2485, 0x374e,
+	    0x4362, 0x296b, 0x3f62, 0x0000, 0x4157, 0x3638, 0x2d9b, 0x1e05,
+	    0x0aef, 0x42fb, 0x1427, 0x20bf, 0x01da, 0x40b4, 0x1234, 0x0082,
+	    0x1cc7, 0x0f54, 0x24bc, 0x006e, 0x1da3, 0x1f33, 0x0000, 0x11a3,
+	    0x0000, 0x42c0, 0x11fb, 0x2f6b, 0x092d, 0x0000, 0x091d, 0x4dd6,
+	    0x16ac, 0x0000, 0x0f2c, 0x2645, 0x160e, 0x17e6, 0x2e8f, 0x25b9,
+	    0x256f, 0x42c6, 0x0f0b, 0x2a65, 0x06c0, 0x2a12, 0x16a4, 0x39f3,
+	    0x4ae0, 0x0000, 0x3dd4, 0x0114, 0x4957, 0x3e1b, 0x3dee, 0x0000,
+	    0x1841, 0x23ac, 0x441c, 0x2ae1, 0x0000, 0x139d, 0x1fd6, 0x2b6c,
+	    0x1bef, 0x1e5c, 0x0000, 0x4968, 0x1f60, 0x4077, 0x1302, 0x0000,
+	    0x0000, 0x316f, 0x06dc, 0x069b, 0x1a9a, 0x2597, 0x0ed7, 0x126f,
+	    0x4aaa, 0x159d, 0x40c8, 0x3e37, 0x3c54, 0x399a, 0x2e01, 0x1e1d,
+	    0x102f, 0x0000, 0x0000, 0x1569, 0x0000, 0x00fc, 0x1873, 0x2daf,
+	    0x1821, 0x1475, 0x49cc, 0x10b1, 0x272a, 0x1858, 0x416d, 0x0a3c,
+	    0x4483, 0x113a, 0x2a9d, 0x0000, 0x319a, 0x22e3, 0x046f, 0x2d2f,
+	    0x0cd0, 0x0246, 0x0c75, 0x35c9, 0x2554, 0x312a, 0x057b, 0x0ad8,
+	    0x012e, 0x0ec3, 0x4468, 0x08df, 0x0e3b, 0x0000, 0x2f07, 0x3151,
+	    0x37bc, 0x3865, 0x4843, 0x2a2f, 0x22b7, 0x2bb7, 0x0000, 0x466b,
+	    0x1a8a, 0x0000, 0x3626, 0x421d, 0x3f1a, 0x3b9a, 0x07ea, 0x0000,
+	    0x346f, 0x23c1, 0x2606, 0x0ab4, 0x2266, 0x35c8, 0x30a4, 0x4818,
+	    0x17f1, 0x0000, 0x0000, 0x075f, 0x075a, 0x1d70, 0x178d, 0x4bbf,
+	    0x0c58, 0x2d43, 0x264e, 0x0b10, 0x0000, 0x23f7, 0x2004, 0x21be,
+	    0x1867, 0x21c9, 0x0e5e, 0x184b, 0x3ea9, 0x4d8e, 0x0d9d, 0x3e23,
+	    0x2fd1, 0x4a6f, 0x0000, 0x1796, 0x2371, 0x1dc0, 0x22f2, 0x12df,
+	    0x356d, 0x1b23, 0x0000, 0x3760, 0x4c33, 0x20e1, 0x2f2b, 0x2b07,
+	    0x3e91, 0x451b, 0x47cb, 0x0a9d, 0x1d8d, 0x17e3, 0x26c7, 0x04e2,
+	    0x02d4, 0x1c16, 0x4603, 0x08f4, 0x0000, 0x476d, 0x0000, 0x0000,
+	    0x35da, 0x0000, 0x06b0, 0x17e4, 0x0000, 0x1bcf, 0x4c03, 0x35bf,
+	    0x46fc, 0x3fe7, 0x01b8, 0x00bc, 0x370f, 0x0e88, 0x0000, 0x1db5,
+	    0x4103, 0x0000, 0x3ea1, 0x31bc, 0x49af, 0x0000, 0x1651, 0x20f6,
+	    0x4467, 0x4c62, 0x00f3, 0x32c6, 0x43ef, 0x0442, 0x0000, 0x1a7d,
+	    0x2c55, 0x2ea5, 0x0000, 0x3eb8, 0x4b4d, 0x258e, 0x44f8, 0x1df9,
+	    0x4166, 0x0785, 0x2153, 0x0000, 0x346e, 0x4220, 0x2699, 0x26fd,
+	    0x0000, 0x126a, 0x0000, 0x1184, 0x3607, 0x1faf, 0x019f, 0x176b,
+	    0x366d, 0x0db1, 0x3b85, 0x0000, 0x0000, 0x3ef4, 0x3fee, 0x0000,
+	    0x0cfb, 0x0131, 0x30a2, 0x4ac1, 0x3c04, 0x4508, 0x0000, 0x1cc8,
+	    0x1894, 0x4836, 0x231e, 0x3edb, 0x3aeb, 0x2d06, 0x39f0, 0x3391,
+	    0x182a, 0x0000, 0x438d, 0x2cb3, 0x4710, 0x2d85, 0x2de2, 0x299b,
+	    0x0cbe, 0x1d60, 0x01da, 0x03d4, 0x3676, 0x0b6c, 0x2b0f, 0x3ccd,
+	    0x1521, 0x08fe, 0x39a2, 0x2ff4, 0x2fb0, 0x461a, 0x39ea, 0x3e74,
+	    0x3eb8, 0x0000, 0x0000, 0x309e, 0x0fc2, 0x016e, 0x112a, 0x0000,
+	    0x3568, 0x4526, 0x1f1f, 0x0074, 0x2503, 0x0000, 0x2505, 0x0089,
+	    0x43c1, 0x125d, 0x0d86, 0x0a43, 0x2a10, 0x018f, 0x22d7, 0x18fa,
+	    0x4d51, 0x4142, 0x2c91, 0x09cb, 0x4047, 0x16ca, 0x0000, 0x03c3,
+	    0x2954, 0x21b2, 0x4d09, 0x0e01, 0x1cf8, 0x0000, 0x0000, 0x369d,
+	    0x3a14, 0x0000, 0x0288, 0x0688, 0x35a3, 0x1707, 0x12e5, 0x3aab,
+	    0x193d, 0x3773, 0x0b40, 0x2618, 0x0000, 0x0000, 0x2799, 0x306b,
+	    0x30f7, 0x3b57, 0x4410, 0x4a31, 0x0371, 0x0000, 0x25e6, 0x297a,
+	    0x18a6, 0x106c, 0x42a9, 0x05b6, 0x365b, 0x3ec4, 0x0000, 0x0a1e,
+	    0x3d9f, 0x0000, 0x439e, 0x0000, 0x3843, 0x0000, 0x11f9, 0x284e,
+	    0x3890, 0x16fe, 0x432c, 0x342b, 0x1caf, 0x2e37, 0x15c2, 0x307c,
+	    0x458e, 0x2279, 0x0000, 0x0bbe, 0x2c70, 0x082b, 0x0000, 0x09e6,
+	    0x4cbc, 0x19f2, 0x2ace, 0x05df, 0x0177, 0x0000, 0x3d1f, 0x0000,
+	    0x3422, 0x3927, 0x45ae, 0x1412, 0x0000, 0x3ca5, 0x2048, 0x4870,
+	    0x0df2, 0x10d3, 0x0bca, 0x2d1d, 0x1d36, 0x2a42, 0x381e, 0x0000,
+	    0x322f, 0x43ff, 0x01bf, 0x0000, 0x0000, 0x28d3, 0x0155, 0x3e06,
+	    0x25d7, 0x0247, 0x0000, 0x430e, 0x4d79, 0x0000, 0x0616, 0x0000,
+	    0x2f77, 0x1c6d, 0x0000, 0x2d17, 0x0000, 0x1026, 0x0e7b, 0x0000,
+	    0x31c5, 0x4539, 0x1843, 0x0dce, 0x32de, 0x0ce4, 0x36b5, 0x1aa0,
+	    0x0000, 0x0e10, 0x4d1a, 0x000e, 0x3994, 0x2ce7, 0x2f0c, 0x4cfd,
+	    0x241b, 0x479f, 0x1b2b, 0x2c8e, 0x3b74, 0x0000, 0x467d, 0x2e20,
+	    0x023a, 0x0000, 0x33bd, 0x2a75, 0x3af5, 0x0000, 0x2d6b, 0x3ee9,
+	    0x0000, 0x3dc0, 0x2c2d, 0x0547, 0x4397, 0x02e1, 0x3798, 0x46bf,
+	    0x0000, 0x0000, 0x0554, 0x4072, 0x2db9, 0x1ebd, 0x1adb, 0x2065,
+	    0x0f9b, 0x001d, 0x0000, 0x3922, 0x131d, 0x2a0e, 0x0e05, 0x3a7c,
+	    0x0000, 0x2dbb, 0x4904, 0x0bc9, 0x2bec, 0x1f40, 0x254f, 0x0002,
+	    0x477a, 0x31d3, 0x1b1a, 0x2d69, 0x15a3, 0x27f3, 0x2f06, 0x1acf,
+	    0x224b, 0x2b01, 0x2c7c, 0x18bf, 0x159a, 0x0c15, 0x295d, 0x0000,
+	    0x0000, 0x0000, 0x1510, 0x497d, 0x47b6, 0x091e, 0x0000, 0x0000,
+	    0x1c24, 0x1f83, 0x0000, 0x027a, 0x3f8e, 0x33ac, 0x07cb, 0x3909,
+	    0x066c, 0x42a7, 0x0000, 0x4c97, 0x2283, 0x042f, 0x246e, 0x0bbc,
+	    0x1b0c, 0x3650, 0x295c, 0x189b, 0x4023, 0x0000, 0x0000, 0x2525,
+	    0x35bc, 0x1e89, 0x1b8e, 0x0c2c, 0x4e0c, 0x0e64, 0x1f4a, 0x2a0f,
+	    0x3ef7, 0x0cef, 0x1c28, 0x3dfd, 0x3431, 0x1c3b, 0x2029, 0x0e65,
+	    0x1544, 0x2432, 0x4609, 0x07e6, 0x3986, 0x3cca, 0x0000, 0x2215,
+	    0x264d, 0x15fd, 0x0112, 0x0000, 0x17b1, 0x36a1, 0x2161, 0x0000,
+	    0x0000, 0x42c6, 0x445e, 0x47e0, 0x38ce, 0x0000, 0x3c93, 0x0000,
+	    0x485d, 0x17bb, 0x4921, 0x49f7, 0x2205, 0x4167, 0x0000, 0x121c,
+	    0x0f73, 0x14bf, 0x2a26, 0x4bd3, 0x0000, 0x0000, 0x335f, 0x2d96,
+	    0x0000, 0x4cd7, 0x2a9b, 0x469b, 0x3355, 0x4473, 0x3068, 0x0000,
+	    0x342b, 0x0000, 0x10f0, 0x16cf, 0x3259, 0x3deb, 0x3730, 0x0cb0,
+	    0x26fc, 0x0000, 0x1845, 0x1e45, 0x3283, 0x2ac4, 0x0000, 0x1a19,
+	    0x0787, 0x2fe5, 0x025c, 0x04cf, 0x29ba, 0x0d4e, 0x4963, 0x44dd,
+	    0x1078, 0x3ba1, 0x3e83, 0x113c, 0x3c35, 0x4469, 0x0000, 0x3cf0,
+	    0x0932, 0x32a0, 0x453e, 0x0c49, 0x06d5, 0x1ba8, 0x3bc6, 0x3537,
+	    0x0c34, 0x381a, 0x37e8, 0x32ae, 0x0501, 0x183a, 0x4024, 0x2292,
+	    0x300d, 0x0000, 0x140a, 0x43e4, 0x0000, 0x0000, 0x4a0b, 0x0000,
+	    0x0000, 0x0000, 0x243f, 0x0000, 0x42dd, 0x100e, 0x2972, 0x0e1b,
+	    0x0000, 0x44ce, 0x4b02, 0x0000, 0x4bd2, 0x3414, 0x0000, 0x1525,
+	    0x0000, 0x169e, 0x0000, 0x148f, 0x158f, 0x0000, 0x4408, 0x193e,
+	    0x01c1, 0x0000, 0x0000, 0x0000, 0x2605, 0x2a95, 0x3153, 0x0000,
+	    0x27e8, 0x0000, 0x1e4a, 0x112f, 0x105c, 0x4314, 0x3af0, 0x26ad,
+	    0x0000, 0x363c, 0x2f0a, 0x4c75, 0x0000, 0x0b77, 0x1c6b, 0x0000,
+	    0x261c, 0x0000, 0x0000, 0x396d, 0x3fde, 0x275f, 0x1b96, 0x3234,
+	    0x46bd, 0x0353, 0x2d1b, 0x020d, 0x2f3d, 0x07c6, 0x0000, 0x4e03,
+	    0x3ed2, 0x22b5, 0x4931, 0x41b7, 0x2963, 0x29c5, 0x053b, 0x15ba,
+	    0x2379, 0x0de7, 0x15ff, 0x0fb7, 0x0164, 0x25cf, 0x0df2, 0x22f8,
+	    0x0000, 0x0000, 0x28af, 0x3e6e, 0x4ca4, 0x0000, 0x49d9, 0x1117,
+	    0x0eb8, 0x1b51, 0x4dde, 0x1afd, 0x4832, 0x0000, 0x4cce, 0x29c0,
+	    0x0000, 0x1095, 0x342c, 0x0000, 0x139e, 0x43d9, 0x39e8, 0x03bb,
+	    0x2622, 0x1ac6, 0x1669, 0x297e, 0x1fa6, 0x2fd3, 0x31fb, 0x1457,
+	    0x2b22, 0x1716, 0x3619, 0x08f8, 0x0443, 0x2875, 0x1f2d, 0x4977,
+	    0x15b6, 0x4770, 0x2f6c, 0x121f, 0x4b1f, 0x0ae8, 0x1895, 0x0000,
+	    0x287b, 0x0ac5, 0x31f1, 0x3303, 0x2f96, 0x36d7, 0x2abb, 0x10a7,
+	    0x0000, 0x088a, 0x0f42, 0x0cba, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x4234, 0x45da, 0x101d, 0x0fd9, 0x4b19, 0x3eae, 0x32cf,
+	    0x42dc, 0x0000, 0x1934, 0x26f0, 0x30de, 0x11b2, 0x137e, 0x1e2c,
+	    0x16d4, 0x1a68, 0x344b, 0x1a0b, 0x39d4, 0x15a4, 0x050d, 0x0000,
+	    0x4315, 0x4811, 0x0000, 0x0000, 0x0000, 0x48c2, 0x0dda, 0x2323,
+	    0x0ed9, 0x3997, 0x1e60, 0x0000, 0x1312, 0x1cfa, 0x2ed7, 0x0000,
+	    0x0000, 0x26e7, 0x3ec8, 0x0000, 0x2c7b, 0x0000, 0x40b1, 0x0ae8,
+	    0x269d, 0x42ae, 0x0000, 0x0e10, 0x490c, 0x29d6, 0x3d83, 0x3338,
+	    0x0a24, 0x42ea, 0x1388, 0x1708, 0x2328, 0x2d96, 0x3ee7, 0x0000,
+	    0x057f, 0x36c8, 0x0000, 0x1e2f, 0x0d64, 0x32d3, 0x359b, 0x13c9,
+	    0x13ac, 0x2370, 0x0000, 0x40d5, 0x0000, 0x3fef, 0x422c, 0x07ef,
+	    0x124e, 0x4359, 0x2e0c, 0x0d77, 0x0000, 0x0b2d, 0x29c7, 0x174e,
+	    0x0630, 0x39dd, 0x0000, 0x3aea, 0x0d63, 0x318e, 0x292d, 0x0289,
+	    0x2916, 0x175d, 0x1c84, 0x1cb2, 0x4c34, 0x4a45, 0x1e2b, 0x1d0a,
+	    0x00ec, 0x0000, 0x2a3d, 0x3ba1, 0x0000, 0x0000, 0x2577, 0x03fc,
+	    0x07e3, 0x07d7, 0x0000, 0x0000, 0x2856, 0x0000, 0x2025, 0x0000,
+	    0x3eda, 0x4ad9, 0x3b7b, 0x091e, 0x09b5, 0x4bd8, 0x248f, 0x450a,
+	    0x0000, 0x2cc7, 0x0000, 0x12f5, 0x074e, 0x2513, 0x0000, 0x0000,
+	    0x36e3, 0x4a56, 0x3893, 0x4cd5, 0x0000, 0x3846, 0x01d0, 0x32f9,
+	    0x2476, 0x3665, 0x09e5, 0x332d, 0x2a3d, 0x0ced, 0x2d66, 0x1503,
+	    0x4d52, 0x23fe, 0x200c, 0x204a, 0x45d3, 0x1dff, 0x262b, 0x102a,
+	    0x0000, 0x1e43, 0x2bbd, 0x3565, 0x0e06, 0x3da0, 0x0000, 0x0000,
+	    0x4728, 0x1d20, 0x2cbb, 0x0000, 0x0000, 0x0000, 0x11ac, 0x2a92,
+	    0x0000, 0x2fa2, 0x1f80, 0x448e, 0x0eb7, 0x34c9, 0x02bf, 0x2454,
+	    0x0000, 0x4de7, 0x0f8c, 0x0990, 0x1a5a, 0x033d, 0x408a, 0x4762,
+	    0x43b8, 0x1080, 0x3cf9, 0x1f48, 0x3498, 0x1319, 0x0000, 0x0000,
+	    0x0fac, 0x0000, 0x3659, 0x4534, 0x2c5b, 0x260f, 0x1d6e, 0x34bf,
+	    0x20bb, 0x4687, 0x2042, 0x49d1, 0x3691, 0x3196, 0x14e2, 0x40e0,
+	    0x2058, 0x0880, 0x0000, 0x4189, 0x40cd, 0x380e, 0x0000, 0x38fe,
+	    0x497c, 0x30b4, 0x175e, 0x1da7, 0x4414, 0x2373, 0x37b1, 0x14f5,
+	    0x0000, 0x23b4, 0x1720, 0x44fb, 0x0cb9, 0x09d0, 0x0000, 0x0b6e,
+	    0x0000, 0x1aba, 0x2b66, 0x1a26, 0x1f58, 0x2b52, 0x4e02, 0x3051,
+	    0x3392, 0x28b5, 0x0000, 0x1883, 0x0dc0, 0x310c, 0x4b13, 0x36e0,
+	    0x27f1, 0x391c, 0x4003, 0x44f4, 0x3960, 0x0241, 0x1cfd, 0x0415,
+	    0x3358, 0x019e, 0x0439, 0x46fc, 0x3f05, 0x2ae8, 0x3b8d, 0x18c7,
+	    0x4580, 0x0000, 0x068a, 0x4683, 0x0693, 0x2e78, 0x40f9, 0x182c,
+	    0x0000, 0x3661, 0x2094, 0x1c14, 0x2a60, 0x0000, 0x3365, 0x2688,
+	    0x2b1f, 0x0000, 0x0548, 0x01af, 0x2393, 0x2bf5, 0x0b3d, 0x169d,
+	    0x26a7, 0x0000, 0x28b7, 0x0211, 0x30f5, 0x0000, 0x33ee, 0x47ff,
+	    0x4897, 0x0000, 0x0000, 0x0a80, 0x2179, 0x10f8, 0x4cfa, 0x0a31,
+	    0x4cba, 0x1b55, 0x0000, 0x0000, 0x30e4, 0x0380, 0x37b5, 0x1519,
+	    0x2b85, 0x4061, 0x10cb, 0x0000, 0x1429, 0x1f57, 0x1225, 0x3915,
+	    0x02bf, 0x270d, 0x04b3, 0x0000, 0x10d3, 0x0665, 0x2d1c, 0x0f0f,
+	    0x1ede, 0x1a60, 0x4863, 0x29bd, 0x0000, 0x0000, 0x2e14, 0x0000,
+	    0x41b5, 0x0f7f, 0x2730, 0x0000, 0x3c7d, 0x36be, 0x1262, 0x1b50,
+	    0x1cd0, 0x0000, 0x0000, 0x3a9c, 0x03ea, 0x0000, 0x121d, 0x333b,
+	    0x2c93, 0x0000, 0x357c, 0x2cf7, 0x1b4a, 0x3793, 0x49cd, 0x4707,
+	    0x2e79, 0x13c1, 0x3877, 0x442b, 0x2003, 0x3369, 0x3e28, 0x26e2,
+	    0x0537, 0x23a5, 0x4deb, 0x1e01, 0x096f, 0x3bd3, 0x136a, 0x02d8,
+	    0x1a85, 0x093f, 0x1526, 0x291c, 0x0000, 0x3702, 0x3cc9, 0x2265,
+	    0x0130, 0x218a, 0x3ef0, 0x2d8e, 0x4247, 0x33cd, 0x0000, 0x220e,
+	    0x0000, 0x2332, 0x34ad, 0x11e1, 0x0000, 0x0bc7, 0x0000, 0x3e25,
+	    0x0000, 0x2df5, 0x0368, 0x2360, 0x39ba, 0x0000, 0x114c, 0x0a18,
+	    0x4357, 0x0000, 0x0000, 0x1aa9, 0x1c2a, 0x4cad, 0x030a, 0x0710,
+	    0x36cb, 0x1541, 0x4118, 0x2dd5, 0x131f, 0x313f, 0x0000, 0x0f3d,
+	    0x4861, 0x0000, 0x0000, 0x0000, 0x02f5, 0x3035, 0x47e7, 0x2c1f,
+	    0x0000, 0x02fc, 0x3534, 0x3568, 0x06a1, 0x1898, 0x0000, 0x1bdb,
+	    0x0000, 0x0d4e, 0x2c81, 0x20a8, 0x0506, 0x0000, 0x1c70, 0x40f5,
+	    0x121f, 0x3567, 0x2773, 0x4216, 0x478f, 0x4b57, 0x25bb, 0x09e1,
+	    0x025e, 0x0000, 0x4ad0, 0x2c6a, 0x0000, 0x43dc, 0x0000, 0x3484,
+	    0x0000, 0x0000, 0x0000, 0x1c47, 0x47ef, 0x2ec3, 0x1d0b, 0x07fa,
+	    0x0000, 0x0a0a, 0x05d8, 0x31f1, 0x4af5, 0x3580, 0x44e9, 0x1e56,
+	    0x4110, 0x0000, 0x337e, 0x40d8, 0x3e21, 0x1091, 0x0402, 0x1550,
+	    0x0000, 0x0000, 0x38ff, 0x0000, 0x26d4, 0x0303, 0x3afe, 0x4411,
+	    0x0000, 0x3085, 0x4599, 0x2dc0, 0x4a6f, 0x4a76, 0x0000, 0x3f17,
+	    0x1f44, 0x2a5b, 0x0000, 0x4360, 0x1ad8, 0x3a5f, 0x2947, 0x1690,
+	    0x0aee, 0x023b, 0x13c1, 0x0553, 0x1b9f, 0x17af, 0x1c14, 0x3982,
+	    0x0000, 0x1dae, 0x38a9, 0x0e30, 0x2f74, 0x0bfb, 0x3964, 0x34c7,
+	    0x1117, 0x0000, 0x11b8, 0x026e, 0x1939, 0x038d, 0x1949, 0x0922,
+	    0x1024, 0x25cf, 0x0000, 0x0000, 0x22f0, 0x0000, 0x3128, 0x4d18,
+	    0x2f56, 0x35a2, 0x459b, 0x3436, 0x24b3, 0x204e, 0x0e06, 0x3a01,
+	    0x3205, 0x1c4f, 0x086c, 0x0000, 0x11e1, 0x00a3, 0x1f1a, 0x0cc5,
+	    0x2543, 0x13ab, 0x3d33, 0x1220, 0x3cac, 0x4a25, 0x18a3, 0x19eb,
+	    0x356d, 0x2a2a, 0x0000, 0x23cf, 0x0000, 0x3acd, 0x0e59, 0x0574,
+	    0x49f8, 0x086a, 0x3afc, 0x0592, 0x4760, 0x4b76, 0x19a5, 0x0000,
+	    0x3db4, 0x04a8, 0x3ba9, 0x4d78, 0x0000, 0x249c, 0x0fc0, 0x0a12,
+	    0x17a4, 0x40d1, 0x0b55, 0x20db, 0x0000, 0x3623, 0x3b73, 0x0d8f,
+	    0x0b4b, 0x07e6, 0x3a00, 0x4801, 0x24b3, 0x11a5, 0x3259, 0x0211,
+	    0x3535, 0x4902, 0x0a45, 0x441e, 0x0ffe, 0x0000, 0x3880, 0x0000,
+	    0x48ee, 0x0bdc, 0x036f, 0x2b46, 0x0000, 0x4172, 0x14c3, 0x2b68,
+	    0x4649, 0x1989, 0x4aed, 0x14a1, 0x4dac, 0x3fe4, 0x0671, 0x1fa5,
+	    0x230e, 0x33e3, 0x260b, 0x3369, 0x16fe, 0x249e, 0x41d7, 0x00b1,
+	    0x07ec, 0x0ad4, 0x3041, 0x1265, 0x4bda, 0x0cb3, 0x0000, 0x159e,
+	    0x1eb3, 0x10eb, 0x0000, 0x34cc, 0x017d, 0x29a3, 0x32d6, 0x0b44,
+	    0x4437, 0x0000, 0x28e9, 0x2ac3, 0x0000, 0x39b0, 0x39a6, 0x0000,
+	    0x0592, 0x323f, 0x0000, 0x4063, 0x4986, 0x2956, 0x4d71, 0x2841,
+	    0x24da, 0x4cf4, 0x0000, 0x2cc0, 0x0000, 0x1309, 0x4312, 0x1836,
+	    0x0cbf, 0x150f, 0x4d7d, 0x266e, 0x0c2a, 0x3dee, 0x04b2, 0x0e04,
+	    0x13ef, 0x10df, 0x3704, 0x1171, 0x02cb, 0x2d57, 0x3876, 0x4b86,
+	    0x26d2, 0x3a12, 0x1a52, 0x33f0, 0x2f93, 0x0000, 0x0000, 0x17e3,
+	    0x1645, 0x2eeb, 0x31bf, 0x35ce, 0x2c2c, 0x0000, 0x199a, 0x0000,
+	    0x0c84, 0x471e, 0x14a3, 0x2f9f, 0x13a6, 0x392a, 0x3359, 0x094c,
+	    0x0842, 0x37b0, 0x0000, 0x3d8e, 0x412d, 0x485d, 0x4924, 0x0000,
+	    0x18e2, 0x242a, 0x16e5, 0x0be9, 0x4929, 0x2347, 0x257b, 0x0fdc,
+	    0x2f79, 0x0f01, 0x3978, 0x37d5, 0x3388, 0x1a3f, 0x2256, 0x1d84,
+	    0x28f8, 0x0000, 0x3934, 0x0a1f, 0x36cd, 0x0682, 0x22ea, 0x0ffe,
+	    0x3b33, 0x1673, 0x1d2f, 0x421f, 0x4622, 0x4150, 0x0000, 0x34ba,
+	    0x4a1e, 0x34c9, 0x08d7, 0x336b, 0x43b5, 0x0000, 0x402d, 0x2b65,
+	    0x174a, 0x4065, 0x23e5, 0x00f3, 0x031d, 0x0978, 0x1aba, 0x0000,
+	    0x3c27, 0x0000, 0x0271, 0x0ec2, 0x4831, 0x2aea, 0x144f, 0x1269,
+	    0x2620, 0x1007, 0x49d9, 0x41bd, 0x0000, 0x349c, 0x4025, 0x0000,
+	    0x3120, 0x0000, 0x0000, 0x1156, 0x2665, 0x4678, 0x19bf, 0x233e,
+	    0x20bb, 0x0e5c, 0x0000, 0x0f2e, 0x0000, 0x0000, 0x4a58, 0x23e6,
+	    0x0b7f, 0x4b69, 0x0242, 0x2672, 0x28bc, 0x20e8, 0x0000, 0x4539,
+	    0x4a25, 0x0000, 0x1728, 0x083c, 0x16bd, 0x4aa6, 0x3d37, 0x2643,
+	    0x2f37, 0x2399, 0x2f5c, 0x2093, 0x4acf, 0x4a86, 0x178e, 0x0000,
+	    0x0472, 0x21c9, 0x0000, 0x32f5, 0x14b8, 0x0000, 0x2dd8, 0x4b11,
+	    0x41c0, 0x2f35, 0x1cab, 0x216c, 0x19de, 0x4d19, 0x4d13, 0x0000,
+	    0x31df, 0x0000, 0x2a25, 0x1075, 0x4a81, 0x3a19, 0x027c, 0x42cc,
+	    0x2a6a, 0x0066, 0x25e1, 0x0000, 0x4c6b, 0x20b3, 0x25dd, 0x497e,
+	    0x1a8c, 0x1483, 0x0000, 0x0000, 0x1d71, 0x0dc1, 0x0874, 0x17bf,
+	    0x0a16, 0x2a49, 0x00ca, 0x1d3f, 0x1066, 0x303a, 0x4479, 0x433c,
+	    0x06d9, 0x04f0, 0x4da7, 0x1dc0, 0x0699, 0x0d1f, 0x037c, 0x0000,
+	    0x01c2, 0x0221, 0x0000, 0x2aa9, 0x423f, 0x0004, 0x4263, 0x4c05,
+	    0x2766, 0x0f45, 0x0000, 0x3be0, 0x3450, 0x4728, 0x31d9, 0x0ad8,
+	    0x45b2, 0x3e13, 0x4413, 0x0ff8, 0x2888, 0x41fa, 0x163c, 0x0b7c,
+	    0x0000, 0x095e, 0x0aa7, 0x0000, 0x2b67, 0x0000, 0x2ed3, 0x0bcc,
+	    0x2c7a, 0x1c9b, 0x3137, 0x066b, 0x017b, 0x144a, 0x3107, 0x23c7,
+	    0x2d43, 0x0350, 0x1c37, 0x0000, 0x0d69, 0x0e9f, 0x4442, 0x176f,
+	    0x2852, 0x3185, 0x20e6, 0x495e, 0x0000, 0x1afb, 0x4134, 0x0612,
+	    0x332a, 0x35d0, 0x0000, 0x02ac, 0x48ca, 0x0000, 0x37ef, 0x0a71,
+	    0x1633, 0x2f71, 0x4170, 0x4cb5, 0x1856, 0x16e9, 0x38cb, 0x29ca,
+	    0x0000, 0x0000, 0x01c5, 0x075e, 0x4bd5, 0x23f2, 0x1257, 0x0000,
+	    0x3f0c, 0x0000, 0x0000, 0x19fc, 0x0000, 0x042f, 0x0000, 0x0000,
+	    0x297d, 0x1176, 0x25eb, 0x4b4a, 0x0000, 0x0000, 0x0d43, 0x4bb3,
+	    0x0720, 0x1d98, 0x0c5c, 0x4a4e, 0x44c3, 0x02b5, 0x31f5, 0x409b,
+	    0x470f, 0x0000, 0x243f, 0x2b08, 0x1173, 0x1b2b, 0x0599, 0x31c1,
+	    0x2b98, 0x1dff, 0x2d3a, 0x13c4, 0x08bc, 0x0000, 0x44b2, 0x16e0,
+	    0x2a41, 0x103a, 0x0b62, 0x1de3, 0x144d, 0x3058, 0x2a7a, 0x0000,
+	    0x333b, 0x0706, 0x0000, 0x3bc9, 0x2c33, 0x3637, 0x37f7, 0x1cbf,
+	    0x24d2, 0x4e1f, 0x2ef7, 0x4679, 0x04cf, 0x2a90, 0x3d56, 0x1f44,
+	    0x3195, 0x21f9, 0x0544, 0x0dff, 0x0000, 0x0000, 0x1e59, 0x0000,
+	    0x0000, 0x2181, 0x3864, 0x47d8, 0x277d, 0x32a3, 0x171c, 0x215d,
+	    0x0d57, 0x2052, 0x00c0, 0x09a8, 0x32eb, 0x15dc, 0x0eaa, 0x03ab,
+	    0x2e95, 0x09f8, 0x08e1, 0x2f97, 0x446c, 0x34b6, 0x0000, 0x2dd3,
+	    0x05e1, 0x04ab, 0x411b, 0x11a2, 0x052f, 0x28c2, 0x0000, 0x00b8,
+	    0x0000, 0x3eac, 0x0000, 0x4d1c, 0x36ea, 0x0981, 0x3992, 0x3571,
+	    0x2d13, 0x13b4, 0x1407, 0x053f, 0x1b78, 0x3306, 0x0000, 0x397a,
+	    0x26f0, 0x4597, 0x033d, 0x3692, 0x0eb0, 0x2a87, 0x205e, 0x4c79,
+	    0x07a5, 0x0261, 0x36a6, 0x0000, 0x0000, 0x206b, 0x2f98, 0x47e1,
+	    0x477f, 0x0243, 0x4a2c, 0x0000, 0x4a07, 0x3279, 0x2b2b, 0x4a63,
+	    0x006e, 0x27c8, 0x2a57, 0x22b1, 0x006d, 0x0992, 0x39a5, 0x402e,
+	    0x13c1, 0x1511, 0x0000, 0x21a5, 0x186e, 0x270b, 0x3d25, 0x43fb,
+	    0x42f2, 0x325f, 0x39f6, 0x2800, 0x0956, 0x007b, 0x01f7, 0x476b,
+	    0x0000, 0x42d4, 0x0ef8, 0x0000, 0x23ff, 0x42e8, 0x36bf, 0x2434,
+	    0x42d5, 0x1547, 0x083c, 0x2255, 0x3533, 0x2132, 0x3660, 0x48fa,
+	    0x2698, 0x07d2, 0x38dc, 0x3937, 0x2b18, 0x199c, 0x44d0, 0x0000,
+	    0x3458, 0x0000, 0x2677, 0x032f, 0x0000, 0x349d, 0x0000, 0x0e21,
+	    0x4b6e, 0x36f9, 0x2d66, 0x0d2c, 0x0000, 0x41b5, 0x381c, 0x4518,
+	    0x43a9, 0x3ff9, 0x28d1, 0x2717, 0x13b6, 0x4bf6, 0x1008, 0x0000,
+	    0x494b, 0x0000, 0x0000, 0x0a90, 0x0000, 0x195a, 0x1924, 0x37a2,
+	    0x06bb, 0x0000, 0x0da9, 0x1c5e, 0x1ff9, 0x4401, 0x25cf, 0x3deb,
+	    0x0000, 0x45c1, 0x1f35, 0x331e, 0x24b6, 0x1718, 0x46b0, 0x4343,
+	    0x0000, 0x0000, 0x464a, 0x0a39, 0x0000, 0x0000, 0x0000, 0x4b23,
+	    0x0000, 0x0540, 0x3128, 0x0000, 0x38eb, 0x4ae6, 0x1c9c, 0x23ab,
+	    0x0000, 0x31c1, 0x2c1f, 0x0000, 0x0128, 0x26a0, 0x2b2b, 0x4591,
+	    0x320f, 0x3b3a, 0x2320, 0x1102, 0x19fc, 0x2eb0, 0x0000, 0x0000,
+	    0x0000, 0x224e, 0x168a, 0x0000, 0x044a, 0x0000, 0x420d, 0x33e9,
+	    0x001f, 0x3adc, 0x1430, 0x24ea, 0x4dfd, 0x0d8a, 0x3479, 0x053b,
+	    0x1c31, 0x214e, 0x2357, 0x37f6, 0x2d8b, 0x31db, 0x190b, 0x4a1a,
+	    0x0da3, 0x0000, 0x3391, 0x028f, 0x0000, 0x42fc, 0x0172, 0x2ea7,
+	    0x3435, 0x2956, 0x2621, 0x4b99, 0x1766, 0x16ce, 0x243a, 0x4a3c,
+	    0x4b33, 0x30e9, 0x4221, 0x0b1c, 0x4163, 0x33ed, 0x3fd8, 0x4417,
+	    0x3036, 0x3fbb, 0x0aec, 0x0000, 0x4603, 0x1bcb, 0x3524, 0x1d68,
+	    0x062b, 0x049b, 0x0000, 0x406a, 0x3bc2, 0x0000, 0x342b, 0x1a5e,
+	    0x37e9, 0x1ea6, 0x0000, 0x1060, 0x3991, 0x0d4b, 0x20aa, 0x41dd,
+	    0x452e, 0x2ad4, 0x380d, 0x0000, 0x33f9, 0x3238, 0x04b6, 0x305b,
+	    0x327a, 0x20c9, 0x25ff, 0x2206, 0x0671, 0x05d5, 0x354b, 0x329d,
+	    0x4467, 0x00d0, 0x3c95, 0x38e2, 0x1f5e, 0x3bf2, 0x2adc, 0x3cc7,
+	    0x3e90, 0x2a3b, 0x383d, 0x4483, 0x49eb, 0x1dbb, 0x13e7, 0x1845,
+	    0x2ca4, 0x0a07, 0x3e01, 0x21ba, 0x464e, 0x096a, 0x0107, 0x00f6,
+	    0x446b, 0x0000, 0x41ba, 0x44d7, 0x18a1, 0x47e6, 0x257e, 0x1399,
+	    0x154a, 0x4b75, 0x039e, 0x0000, 0x0000, 0x47f6, 0x0d47, 0x1273,
+	    0x20be, 0x0000, 0x0000, 0x3e4f, 0x0000, 0x3d6c, 0x0000, 0x0000,
+	    0x4bb5, 0x0dc3, 0x1012, 0x249b, 0x44c5, 0x49e2, 0x4ce4, 0x220b,
+	    0x3fb7, 0x4509, 0x2f67, 0x33d8, 0x14e6, 0x433e, 0x012c, 0x4115,
+	    0x3965, 0x4d93, 0x092f, 0x2f41, 0x0000, 0x0000, 0x285e, 0x2abd,
+	    0x2241, 0x2eea, 0x488e, 0x2bb3, 0x42c3, 0x0000, 0x36dc, 0x097e,
+	    0x0ca3, 0x0000, 0x0d60, 0x35be, 0x43a4, 0x49ad, 0x0000, 0x0000,
+	    0x4125, 0x0000, 0x29eb, 0x20e5, 0x0000, 0x1e97, 0x0000, 0x0f35,
+	    0x1727, 0x31a0, 0x06d2, 0x1c4c, 0x0d91, 0x13af, 0x436e, 0x2dac,
+	    0x35a4, 0x4ba7, 0x0000, 0x1e2f, 0x4345, 0x0000, 0x3693, 0x3c31,
+	    0x22e2, 0x34ee, 0x0000, 0x191f, 0x0000, 0x2882, 0x0fb2, 0x2656,
+	    0x49dc, 0x3a0c, 0x403e, 0x0253, 0x15be, 0x1d44, 0x108c, 0x0239,
+	    0x2bb1, 0x3414, 0x46f6, 0x1cdd, 0x0000, 0x06d3, 0x143f, 0x036f,
+	    0x401f, 0x21e4, 0x4c04, 0x4988, 0x1495, 0x0000, 0x3061, 0x3f26,
+	    0x3f2f, 0x08b1, 0x0000, 0x3fc8, 0x490a, 0x3f94, 0x0000, 0x1374,
+	    0x41c3, 0x183d, 0x08ec, 0x084f, 0x4462, 0x1881, 0x0000, 0x3c0e,
+	    0x3d42, 0x0833, 0x0000, 0x1ef7, 0x3b48, 0x4721, 0x30ea, 0x2360,
+	    0x3f2d, 0x03c5, 0x1d16, 0x0ada, 0x335b, 0x0000, 0x247e, 0x0903,
+	    0x3123, 0x0001, 0x04c7, 0x3b2c, 0x45e1, 0x294c, 0x3d22, 0x1c23,
+	    0x1149, 0x0000, 0x1b6d, 0x25be, 0x3354, 0x4c74, 0x27af, 0x26f3,
+	    0x382e, 0x0000, 0x013f, 0x0000, 0x0000, 0x0a3b, 0x4bdf, 0x3c9f,
+	    0x44ec, 0x387e, 0x1737, 0x120b, 0x1c13, 0x0000, 0x0000, 0x3650,
+	    0x178c, 0x4088, 0x0000, 0x0d7a, 0x430d, 0x0ab9, 0x433f, 0x39ea,
+	    0x481b, 0x3933, 0x10e6, 0x0faa, 0x4b18, 0x4c08, 0x0000, 0x2b8d,
+	    0x1731, 0x1106, 0x0ab8, 0x1573, 0x2542, 0x032a, 0x4115, 0x0000,
+	    0x3a8c, 0x0000, 0x212f, 0x201f, 0x103b, 0x409a, 0x3448, 0x0000,
+	    0x0000, 0x3e92, 0x10e6, 0x0000, 0x1db5, 0x4a03, 0x0000, 0x032d,
+	    0x10bd, 0x223a, 0x0e6c, 0x2686, 0x08ec, 0x137e, 0x32f7, 0x1f6d,
+	    0x120b, 0x0000, 0x15d2, 0x20a2, 0x14fa, 0x0053, 0x0000, 0x0000,
+	    0x173f, 0x3608, 0x17c3, 0x46ed, 0x1ae7, 0x1f64, 0x1f5a, 0x150c,
+	    0x3dd1, 0x412a, 0x0000, 0x1e7a, 0x0000, 0x2c29, 0x38d6, 0x4135,
+	    0x4914, 0x2ced, 0x1441, 0x0000, 0x0000, 0x0000, 0x4113, 0x302e,
+	    0x0000, 0x192e, 0x3868, 0x1aec, 0x0820, 0x4576, 0x06b0, 0x336d,
+	    0x13b4, 0x1998, 0x0000, 0x304c, 0x1db5, 0x0000, 0x0000, 0x2126,
+	    0x1718, 0x0aab, 0x38fa, 0x124d, 0x0000, 0x4486, 0x0000, 0x0000,
+	    0x14c2, 0x0dc1, 0x2230, 0x4476, 0x1652, 0x4726, 0x09a2, 0x0000,
+	    0x2947, 0x26d1, 0x0000, 0x0000, 0x4186, 0x1a7b, 0x1ebb, 0x35e3,
+	    0x4610, 0x4580, 0x47b2, 0x4129, 0x2f84, 0x0000, 0x24d6, 0x31dd,
+	    0x3d1e, 0x0000, 0x1bcd, 0x263f, 0x3c14, 0x0ecb, 0x1685, 0x0000,
+	    0x3341, 0x181f, 0x0000, 0x4e19, 0x40cc, 0x4a21, 0x2392, 0x2a7e,
+	    0x2110, 0x0000, 0x0000, 0x1ec9, 0x1fa3, 0x428a, 0x2706, 0x3a43,
+	    0x1cdb, 0x1644, 0x2ea4, 0x3150, 0x459d, 0x0000, 0x486b, 0x486c,
+	    0x113d, 0x4897, 0x1ca5, 0x1779, 0x2e15, 0x1934, 0x19ca, 0x0000,
+	    0x23ed, 0x2cdb, 0x3e39, 0x3cc4, 0x0000, 0x13cb, 0x0000, 0x2204,
+	    0x0000, 0x0000, 0x1eab, 0x37a0, 0x1d3b, 0x43ad, 0x3660, 0x0000,
+	    0x0000, 0x1852, 0x46c7, 0x0493, 0x2bbf, 0x4ca2, 0x0aaf, 0x48cc,
+	    0x4c63, 0x352e, 0x0000, 0x03d5, 0x19d1, 0x2abc, 0x134e, 0x08c1,
+	    0x0fa9, 0x4324, 0x0000, 0x0f74, 0x1289, 0x0000, 0x1068, 0x318e,
+	    0x13c5, 0x0000, 0x20f4, 0x0b23, 0x326b, 0x3de9, 0x09ac, 0x4b66,
+	    0x0000, 0x3aa3, 0x0b9a, 0x3c71, 0x22c0, 0x0000, 0x47eb, 0x01f1,
+	    0x3e51, 0x34c1, 0x0b36, 0x0000, 0x494a, 0x310b, 0x3106, 0x4b4a,
+	    0x260e, 0x0b0a, 0x0000, 0x0bee, 0x3be8, 0x1bba, 0x205a, 0x4610,
+	    0x3e98, 0x1240, 0x4991, 0x2f84, 0x0000, 0x0e06, 0x0000, 0x376b,
+	    0x1c1d, 0x2ffc, 0x204c, 0x3b54, 0x3efb, 0x3f18, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1acb, 0x0000, 0x226b, 0x0af5, 0x1f5f, 0x0c9d,
+	    0x0000, 0x4a22, 0x336e, 0x1dab, 0x0000, 0x0d7f, 0x1ddb, 0x0000,
+	    0x4b22, 0x4b5c, 0x0dc7, 0x0000, 0x0000, 0x46d6, 0x3a1b, 0x16ee,
+	    0x0b2f, 0x4223, 0x0000, 0x114c, 0x0421, 0x3e34, 0x0000, 0x479c,
+	    0x0296, 0x17a5, 0x3ebc, 0x3e1f, 0x3281, 0x0e46, 0x09cf, 0x0445,
+	    0x41b4, 0x0ff9, 0x0000, 0x3667, 0x0585, 0x19f2, 0x2ea9, 0x1f7e,
+	    0x0255, 0x1511, 0x0000, 0x4039, 0x0000, 0x1eb5, 0x0000, 0x0000,
+	    0x4198, 0x168b, 0x2e92, 0x3345, 0x2d1b, 0x0369, 0x41b2, 0x3c01,
+	    0x0000, 0x09eb, 0x414d, 0x4b5c, 0x1a49, 0x30fb, 0x4835, 0x1943,
+	    0x40d4, 0x443a, 0x1c39, 0x465f, 0x4084, 0x0000, 0x2b69, 0x0df9,
+	    0x46a7, 0x4279, 0x3d17, 0x053c, 0x4c1d, 0x4158, 0x3a30, 0x3564,
+	    0x0e93, 0x187c, 0x4523, 0x04c3, 0x2f91, 0x0ee6, 0x0000, 0x0000,
+	    0x3526, 0x38c6, 0x244a, 0x0000, 0x0000, 0x0000, 0x2e92, 0x1438,
+	    0x41f3, 0x0000, 0x47e3, 0x0072, 0x3362, 0x0000, 0x1b32, 0x0000,
+	    0x4a11, 0x4b0d, 0x2c61, 0x393b, 0x15fa, 0x040a, 0x4d70, 0x2f93,
+	    0x46fc, 0x0000, 0x089f, 0x0000, 0x0000, 0x0000, 0x1c75, 0x270f,
+	    0x38ab, 0x0804, 0x45a1, 0x0000, 0x2b20, 0x2576, 0x05cb, 0x1e90,
+	    0x390f, 0x0c61, 0x3819, 0x4933, 0x0bd8, 0x4954, 0x0caf, 0x2e2f,
+	    0x0000, 0x2c86, 0x08cc, 0x4758, 0x0091, 0x0b30, 0x08c3, 0x1a34,
+	    0x199a, 0x0169, 0x460c, 0x0000, 0x421c, 0x4781, 0x40a4, 0x1d05,
+	    0x24e9, 0x2475, 0x1980, 0x220b, 0x2baf, 0x0000, 0x2db8, 0x137a,
+	    0x0594, 0x3fae, 0x49c3, 0x219a, 0x0cc1, 0x1cdb, 0x0000, 0x3ae1,
+	    0x47df, 0x34c0, 0x2174, 0x179e, 0x00f6, 0x2b6f, 0x1614, 0x18af,
+	    0x33c4, 0x2dd9, 0x0000, 0x0f3c, 0x29b3, 0x0615, 0x3c30, 0x4b63,
+	    0x0273, 0x4807, 0x1875, 0x4be0, 0x4974, 0x35ef, 0x24d1, 0x285b,
+	    0x306f, 0x30dc, 0x2c2a, 0x43c4, 0x0000, 0x0618, 0x1d62, 0x13c2,
+	    0x3f73, 0x243a, 0x0000, 0x4025, 0x0dd9, 0x0000, 0x4409, 0x274b,
+	    0x0000, 0x0000, 0x2332, 0x2cfa, 0x12be, 0x0000, 0x3680, 0x0000,
+	    0x282f, 0x4db8, 0x4401, 0x477c, 0x0000, 0x06f2, 0x2968, 0x17e2,
+	    0x0000, 0x41bf, 0x0903, 0x0000, 0x2e8e, 0x424d, 0x3dc9, 0x01ec,
+	    0x48b8, 0x3630, 0x0000, 0x4650, 0x2184, 0x0000, 0x0000, 0x346d,
+	    0x41d5, 0x0000, 0x00d2, 0x3844, 0x1265, 0x3b0f, 0x2303, 0x3bed,
+	    0x164f, 0x3dc8, 0x0e47, 0x3442, 0x27b4, 0x3634, 0x113a, 0x2a87,
+	    0x1f19, 0x1560, 0x3d8a, 0x3b21, 0x214e, 0x0000, 0x2ebd, 0x2035,
+	    0x0b62, 0x2090, 0x2457, 0x147f, 0x0000, 0x0562, 0x3690, 0x111b,
+	    0x140c, 0x3c2b, 0x3b11, 0x4b4c, 0x0000, 0x00ed, 0x49c5, 0x4a1b,
+	    0x1cda, 0x0666, 0x26fc, 0x3c0b, 0x1e17, 0x0d4b, 0x26b1, 0x0f93,
+	    0x1d0b, 0x1d24, 0x2b9f, 0x1186, 0x37b8, 0x1807, 0x0000, 0x0000,
+	    0x12cc, 0x2297, 0x2d76, 0x3d0c, 0x14f0, 0x1398, 0x172c, 0x02b9,
+	    0x19cc, 0x14a3, 0x3503, 0x3522, 0x1383, 0x3084, 0x3310, 0x44f2,
+	    0x3956, 0x0bb0, 0x0e21, 0x1218, 0x0000, 0x1ca7, 0x19c2, 0x008d,
+	    0x126b, 0x2d8f, 0x0000, 0x041b, 0x2e1c, 0x3ce1, 0x2378, 0x4d71,
+	    0x189c, 0x1eb2, 0x2e83, 0x27be, 0x244d, 0x3d71, 0x1427, 0x48d1,
+	    0x4d2b, 0x4e15, 0x221e, 0x2d2f, 0x0000, 0x1182, 0x0dfa, 0x2717,
+	    0x3220, 0x1b32, 0x01cb, 0x0000, 0x37e1, 0x316d, 0x41bd, 0x1c39,
+	    0x2ede, 0x3da0, 0x0790, 0x019c, 0x3db1, 0x2c1e, 0x15a3, 0x18a5,
+	    0x0000, 0x0000, 0x2b65, 0x076c, 0x48d9, 0x1ba9, 0x1b42, 0x2919,
+	    0x220f, 0x3c6b, 0x25c2, 0x2806, 0x0000, 0x4a51, 0x48f5, 0x0000,
+	    0x0277, 0x20f5, 0x1b42, 0x1065, 0x0b67, 0x46bb, 0x0000, 0x0000,
+	    0x4c4e, 0x4839, 0x093c, 0x30e5, 0x2f43, 0x1254, 0x0bd4, 0x303d,
+	    0x2099, 0x0000, 0x04bd, 0x2d86, 0x13e1, 0x4588, 0x0e9a, 0x0959,
+	    0x48e1, 0x36d2, 0x0000, 0x3b55, 0x11a7, 0x0000, 0x06b6, 0x0b5b,
+	    0x2f1d, 0x39d4, 0x3db4, 0x4287, 0x3814, 0x0000, 0x0000, 0x0000,
+	    0x02f8, 0x4c2a, 0x3c27, 0x48d3, 0x0000, 0x0001, 0x1bd9, 0x40aa,
+	    0x1f88, 0x0000, 0x4c31, 0x15f7, 0x0000, 0x1817, 0x05af, 0x4021,
+	    0x2459, 0x387d, 0x466f, 0x0970, 0x0a97, 0x1e37, 0x10e0, 0x2f14,
+	    0x2b3a, 0x08d2, 0x4a25, 0x07e7, 0x0397, 0x2fdf, 0x488a, 0x170b,
+	    0x3a2e, 0x318c, 0x293c, 0x0000, 0x10e6, 0x45de, 0x0000, 0x0000,
+	    0x3fad, 0x3ac3, 0x1ab1, 0x38f6, 0x48a6, 0x18a8, 0x3ffa, 0x4608,
+	    0x2140, 0x1826, 0x38d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x13c3,
+	    0x09fe, 0x33e9, 0x05b0, 0x1330, 0x0ab3, 0x1cb9, 0x3ccc, 0x17e2,
+	    0x2b02, 0x3bdd, 0x408e, 0x2ed4, 0x045d, 0x360f, 0x0000, 0x098a,
+	    0x0000, 0x3058, 0x4db7, 0x0606, 0x202f, 0x225c, 0x0000, 0x0626,
+	    0x0adf, 0x42ff, 0x1de9, 0x0848, 0x21a2, 0x251a, 0x14bc, 0x2f9e,
+	    0x3ded, 0x0eac, 0x29b0, 0x44ca, 0x242c, 0x08df, 0x0797, 0x0000,
+	    0x32c5, 0x0492, 0x05cd, 0x0e0a, 0x2ff5, 0x49bd, 0x36b9, 0x0000,
+	    0x4623, 0x3d89, 0x1050, 0x0898, 0x2c41, 0x0305, 0x1030, 0x064b,
+	    0x340b, 0x478e, 0x2e36, 0x4413, 0x1127, 0x184d, 0x1094, 0x3f22,
+	    0x06b3, 0x43d5, 0x41a0, 0x3d9c, 0x1918, 0x2905, 0x3bd9, 0x2ac9,
+	    0x3b8e, 0x2a39, 0x11cc, 0x096f, 0x0ee7, 0x0dcd, 0x0000, 0x0000,
+	    0x0000, 0x18d7, 0x02ff, 0x0000, 0x3763, 0x4710, 0x1f64, 0x0712,
+	    0x0000, 0x0d93, 0x4791, 0x0000, 0x27f6, 0x09c2, 0x1e51, 0x0c0f,
+	    0x33c6, 0x40bb, 0x0bad, 0x0a45, 0x3454, 0x1b87, 0x4280, 0x20e9,
+	    0x0000, 0x4c52, 0x10a4, 0x4600, 0x20c7, 0x04e0, 0x36b2, 0x2fc0,
+	    0x346e, 0x4ba4, 0x0d78, 0x3527, 0x43a4, 0x12c2, 0x00ea, 0x138d,
+	    0x44d1, 0x3aaf, 0x4017, 0x14bb, 0x282e, 0x0000, 0x12d9, 0x38d5,
+	    0x3f49, 0x2893, 0x484e, 0x1552, 0x1a57, 0x2e00, 0x0f54, 0x33c6,
+	    0x0dab, 0x0209, 0x01b6, 0x10cb, 0x0ea5, 0x3835, 0x07f2, 0x0000,
+	    0x0a96, 0x4454, 0x01f2, 0x07a1, 0x0000, 0x44b4, 0x0000, 0x0000,
+	    0x0382, 0x321c, 0x0eb7, 0x2717, 0x083c, 0x01f5, 0x0000, 0x0000,
+	    0x0b54, 0x3f63, 0x4c94, 0x49c0, 0x0dd1, 0x3a0c, 0x41d0, 0x36bf,
+	    0x2989, 0x4d35, 0x25cd, 0x0235, 0x3d8a, 0x0401, 0x0000, 0x45d0,
+	    0x2dd4, 0x0000, 0x3549, 0x1da9, 0x1b36, 0x03ee, 0x2719, 0x0000,
+	    0x4b0d, 0x0000, 0x4c56, 0x422c, 0x3e35, 0x2682, 0x29bc, 0x476c,
+	    0x4ba7, 0x3ab5, 0x2632, 0x36e7, 0x0000, 0x0167, 0x05c1, 0x4b80,
+	    0x0db5, 0x2f16, 0x16a1, 0x0d94, 0x0000, 0x3d97, 0x0000, 0x0000,
+	    0x3940, 0x378a, 0x40f9, 0x407e, 0x0000, 0x0000, 0x270b, 0x0b47,
+	    0x1f32, 0x0b16, 0x26d7, 0x4909, 0x4372, 0x1b90, 0x1d76, 0x0000,
+	    0x04c8, 0x0000, 0x1b9c, 0x222e, 0x3b8a, 0x3011, 0x328d, 0x1ba7,
+	    0x13fe, 0x304e, 0x1553, 0x4179, 0x43ab, 0x435f, 0x0000, 0x0e5a,
+	    0x29dd, 0x1d86, 0x03ad, 0x1035, 0x2f7a, 0x0c14, 0x3a49, 0x492f,
+	    0x3323, 0x2da7, 0x13f9, 0x0000, 0x3178, 0x1012, 0x0000, 0x1bc4,
+	    0x4387, 0x4225, 0x00fe, 0x2200, 0x0000, 0x0000, 0x3080, 0x0e12,
+	    0x2730, 0x283b, 0x1872, 0x2d16, 0x0000, 0x221a, 0x087a, 0x44fd,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x2dca, 0x2667, 0x11a2, 0x1c54,
+	    0x33ca, 0x12e1, 0x00c2, 0x2e92, 0x061e, 0x0c61, 0x0000, 0x2971,
+	    0x1706, 0x4cc1, 0x07ec, 0x0000, 0x0016, 0x05f5, 0x0000, 0x0000,
+	    0x0c2d, 0x44a5, 0x0000, 0x33ed, 0x1086, 0x30ff, 0x2b63, 0x080a,
+	    0x18e7, 0x4274, 0x0000, 0x1425, 0x2e00, 0x2546, 0x24ea, 0x0000,
+	    0x07b9, 0x0000, 0x3c10, 0x0f1f, 0x1280, 0x3288, 0x35e4, 0x4cb0,
+	    0x2d97, 0x1191, 0x2e58, 0x0c58, 0x2714, 0x4cfc, 0x31df, 0x2af2,
+	    0x2aac, 0x3f25, 0x2cd0, 0x33f9, 0x414b, 0x3aaf, 0x155b, 0x47e7,
+	    0x4ce8, 0x1ffc, 0x4018, 0x0fcc, 0x27d3, 0x47c6, 0x0000, 0x2728,
+	    0x117b, 0x160b, 0x0c65, 0x0000, 0x1e78, 0x3a32, 0x4011, 0x118c,
+	    0x40cb, 0x3693, 0x463f, 0x2e23, 0x3ac5, 0x3d9f, 0x315b, 0x468b,
+	    0x3644, 0x3e33, 0x4497, 0x1362, 0x0000, 0x2b9f, 0x0000, 0x3040,
+	    0x11d7, 0x0000, 0x1407, 0x20c7, 0x1463, 0x3d91, 0x0000, 0x29e2,
+	    0x3899, 0x08a7, 0x388e, 0x4307, 0x0d7b, 0x0000, 0x43ba, 0x039a,
+	    0x30c3, 0x0000, 0x00b0, 0x0d85, 0x1320, 0x0000, 0x165b, 0x33ae,
+	    0x2f35, 0x29bc, 0x2e79, 0x197a, 0x0000, 0x2d9a, 0x49bd, 0x0000,
+	    0x0d13, 0x20ff, 0x02b9, 0x0389, 0x072b, 0x1bc4, 0x10dc, 0x0c74,
+	    0x43a8, 0x2402, 0x09b2, 0x1eff, 0x0019, 0x046a, 0x3b0a, 0x2099,
+	    0x1e98, 0x0000, 0x0000, 0x22f1, 0x3648, 0x0000, 0x1095, 0x2e3c,
+	    0x10a2, 0x09bd, 0x4275, 0x3221, 0x0000, 0x1aa8, 0x269f, 0x0000,
+	    0x0f92, 0x3a1e, 0x4136, 0x2410, 0x2b7d, 0x0b42, 0x194f, 0x3f4b,
+	    0x0000, 0x43a9, 0x2ba4, 0x2b35, 0x17f1, 0x1961, 0x2582, 0x305d,
+	    0x3f5a, 0x2c09, 0x1ed3, 0x3774, 0x02ba, 0x3480, 0x263f, 0x134a,
+	    0x41c2, 0x315a, 0x48b9, 0x468d, 0x3380, 0x0000, 0x1cfd, 0x0000,
+	    0x0000, 0x0108, 0x0000, 0x0000, 0x026b, 0x240e, 0x1d79, 0x1c5e,
+	    0x377c, 0x0208, 0x100f, 0x3b7e, 0x2ce3, 0x3d26, 0x096f, 0x0000,
+	    0x41a2, 0x2367, 0x33b3, 0x16f7, 0x2c24, 0x3c72, 0x0b57, 0x1fd0,
+	    0x06ab, 0x25b7, 0x4611, 0x1432, 0x473d, 0x4667, 0x1d2b, 0x0000,
+	    0x08f0, 0x0ea4, 0x0cd8, 0x0000, 0x0000, 0x1209, 0x0960, 0x165e,
+	    0x0000, 0x390f, 0x4b3b, 0x0526, 0x2e2f, 0x212b, 0x4dd9, 0x0000,
+	    0x3b28, 0x1071, 0x26eb, 0x1651, 0x27b4, 0x1b7e, 0x0000, 0x2330,
+	    0x0000, 0x0000, 0x1627, 0x4b68, 0x0000, 0x2f80, 0x0000, 0x094f,
+	    0x4738, 0x0000, 0x0eb2, 0x277d, 0x0000, 0x3516, 0x360a, 0x14c7,
+	    0x31f8, 0x0000, 0x0af0, 0x28b4, 0x47c2, 0x1d5a, 0x20e3, 0x4993,
+	    0x3567, 0x440f, 0x30d1, 0x2e2b, 0x3c4e, 0x0560, 0x2327, 0x0acd,
+	    0x0000, 0x0000, 0x1371, 0x3411, 0x03e2, 0x0000, 0x263d, 0x427c,
+	    0x0000, 0x3a12, 0x11f8, 0x2395, 0x4c4d, 0x1b74, 0x1cd5, 0x0f8b,
+	    0x28f3, 0x3fce, 0x4b7c, 0x3379, 0x42ec, 0x4a8b, 0x4be7, 0x2b1a,
+	    0x0569, 0x206c, 0x2baf, 0x494a, 0x1a1e, 0x119d, 0x3d64, 0x403d,
+	    0x4574, 0x0000, 0x2e15, 0x4da0, 0x46ca, 0x1e10, 0x188d, 0x2c3a,
+	    0x110b, 0x2f6e, 0x3edd, 0x1490, 0x0000, 0x04d4, 0x0000, 0x0c1c,
+	    0x2a9e, 0x1b42, 0x3749, 0x0d5e, 0x36fd, 0x0000, 0x3300, 0x0bc8,
+	    0x0171, 0x0000, 0x2478, 0x219d, 0x398b, 0x1f3f, 0x0ff5, 0x2774,
+	    0x0000, 0x1c05, 0x0070, 0x29e1, 0x14bf, 0x0000, 0x3964, 0x3e7b,
+	    0x47b0, 0x3dea, 0x0000, 0x4689, 0x1883, 0x4b6d, 0x3179, 0x0aba,
+	    0x190e, 0x4203, 0x4d36, 0x4bd3, 0x3c0f, 0x0f7e, 0x36e5, 0x0000,
+	    0x0000, 0x16fa, 0x2947, 0x0000, 0x0000, 0x0000, 0x2b49, 0x2f7c,
+	    0x265b, 0x0000, 0x227c, 0x0000, 0x2ade, 0x2cba, 0x06ad, 0x4316,
+	    0x1e84, 0x3fec, 0x2233, 0x0000, 0x08fd, 0x32bb, 0x2b91, 0x0e65,
+	    0x0000, 0x1db6, 0x2795, 0x1734, 0x23cd, 0x25c7, 0x0000, 0x0000,
+	    0x0000, 0x2d04, 0x0000, 0x0000, 0x421e, 0x36f4, 0x1b1e, 0x0000,
+	    0x36db, 0x48b5, 0x0510, 0x3d0a, 0x403b, 0x0adf, 0x2560, 0x1628,
+	    0x0000, 0x4099, 0x0000, 0x2d80, 0x381c, 0x2ce5, 0x0f8c, 0x18b0,
+	    0x2483, 0x4e06, 0x0597, 0x466e, 0x10e5, 0x16cc, 0x0000, 0x0000,
+	    0x2129, 0x0000, 0x223a, 0x3282, 0x465d, 0x184a, 0x3052, 0x297d,
+	    0x0000, 0x1ce7, 0x0ef1, 0x0000, 0x0000, 0x270c, 0x4393, 0x4d45,
+	    0x2589, 0x0000, 0x0000, 0x0e8c, 0x25be, 0x1a8b, 0x0000, 0x37ef,
+	    0x1d9f, 0x0701, 0x2ea0, 0x2789, 0x0000, 0x0190, 0x2ed8, 0x1ae3,
+	    0x1016, 0x0739, 0x4e19, 0x4d4d, 0x100b, 0x3168, 0x348a, 0x054e,
+	    0x0000, 0x0ad8, 0x1073, 0x1702, 0x2d79, 0x0000, 0x2c3e, 0x0234,
+	    0x3257, 0x1514, 0x24e2, 0x29d4, 0x0000, 0x020a, 0x1ce5, 0x1050,
+	    0x0000, 0x3b11, 0x066a, 0x0000, 0x3037, 0x1cf0, 0x0000, 0x042b,
+	    0x0ba2, 0x2dde, 0x2ff9, 0x2116, 0x1306, 0x16ea, 0x083a, 0x09f6,
+	    0x1ce5, 0x2d06, 0x0000, 0x148d, 0x0539, 0x2d2b, 0x0000, 0x37c3,
+	    0x4678, 0x0ffe, 0x0000, 0x092e, 0x10b8, 0x17dd, 0x0000, 0x1089,
+	    0x1d0e, 0x0000, 0x0552, 0x2e6d, 0x3f4f, 0x32a5, 0x0000, 0x293d,
+	    0x0951, 0x3701, 0x23d9, 0x40b9, 0x22b0, 0x179d, 0x245d, 0x466e,
+	    0x089b, 0x3262, 0x2c56, 0x0000, 0x471b, 0x3611, 0x0174, 0x0475,
+	    0x0000, 0x0000, 0x0000, 0x2bb4, 0x0000, 0x3b2d, 0x1df0, 0x0c8f,
+	    0x0000, 0x0000, 0x3ae0, 0x397e, 0x2a7f, 0x067a, 0x059f, 0x3bd8,
+	    0x4529, 0x0000, 0x3277, 0x37bb, 0x23a7, 0x18c8, 0x39d2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2365, 0x2f0a, 0x2465, 0x0000, 0x1371,
+	    0x1938, 0x4a26, 0x4713, 0x47df, 0x440f, 0x097a, 0x2a1b, 0x429a,
+	    0x2303, 0x4667, 0x0000, 0x17f1, 0x48e6, 0x41ce, 0x3c8d, 0x4565,
+	    0x2d36, 0x1fd5, 0x43c7, 0x0000, 0x0000, 0x0000, 0x353a, 0x4329,
+	    0x30b7, 0x0000, 0x01ea, 0x171e, 0x40c4, 0x3d0f, 0x260f, 0x37ee,
+	    0x259d, 0x041b, 0x497b, 0x0000, 0x0000, 0x0000, 0x06fe, 0x2411,
+	    0x207f, 0x0db0, 0x0e59, 0x0000, 0x0000, 0x0000, 0x3d38, 0x409e,
+	    0x296c, 0x4122, 0x1328, 0x1ac7, 0x0c16, 0x454b, 0x09b6, 0x2f9a,
+	    0x0000, 0x393c, 0x17de, 0x3de6, 0x4b9d, 0x0000, 0x3d1b, 0x329e,
+	    0x117d, 0x1934, 0x4e15, 0x07c3, 0x07d1, 0x3220, 0x31a5, 0x0000,
+	    0x4ac8, 0x3aa0, 0x265a, 0x21c5, 0x2b5d, 0x4bca, 0x37ef, 0x0000,
+	    0x3091, 0x44bb, 0x0059, 0x0000, 0x0000, 0x2c01, 0x0000, 0x0b5a,
+	    0x48ea, 0x19a8, 0x341f, 0x3b85, 0x1ef2, 0x2fac, 0x3f04, 0x0000,
+	    0x348c, 0x1df2, 0x36e7, 0x4b66, 0x160b, 0x03bc, 0x1758, 0x2382,
+	    0x3d8d, 0x379a, 0x00cf, 0x416b, 0x06b7, 0x2922, 0x308c, 0x22d3,
+	    0x110e, 0x0000, 0x0000, 0x1f24, 0x3a57, 0x0000, 0x1704, 0x3c7f,
+	    0x1921, 0x206d, 0x36ce, 0x1542, 0x280e, 0x4aba, 0x0b98, 0x03e3,
+	    0x30bd, 0x3083, 0x37cb, 0x16ba, 0x1158, 0x3297, 0x4095, 0x041e,
+	    0x3cc5, 0x0000, 0x2bda, 0x3581, 0x3bbc, 0x0706, 0x3d44, 0x0d61,
+	    0x1119, 0x2b68, 0x1dd1, 0x1feb, 0x1feb, 0x224b, 0x4058, 0x196d,
+	    0x116a, 0x01fe, 0x246f, 0x0000, 0x2e1a, 0x0000, 0x0e2b, 0x0000,
+	    0x3ff9, 0x26ff, 0x06c1, 0x114b, 0x29fc, 0x0000, 0x2b5d, 0x3e2c,
+	    0x2c73, 0x0777, 0x2b26, 0x41d5, 0x1ba9, 0x084d, 0x1f42, 0x0000,
+	    0x0000, 0x4829, 0x0a87, 0x0000, 0x0774, 0x2df4, 0x01b9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x10ab, 0x23be, 0x1f4c, 0x35ef,
+	    0x08dd, 0x048d, 0x0f92, 0x0000, 0x37e0, 0x3b29, 0x0000, 0x248e,
+	    0x07d6, 0x0000, 0x1549, 0x2848, 0x2271, 0x0000, 0x0000, 0x48bc,
+	    0x2dbf, 0x1275, 0x0e97, 0x22dd, 0x2db5, 0x0000, 0x1029, 0x0a40,
+	    0x3147, 0x09ab, 0x1b75, 0x323d, 0x3c29, 0x192b, 0x06de, 0x0a77,
+	    0x28d7, 0x2f88, 0x2ef2, 0x4225, 0x08f3, 0x18d6, 0x1393, 0x0000,
+	    0x0dd4, 0x26c2, 0x0000, 0x3c17, 0x3d76, 0x0d02, 0x1229, 0x3349,
+	    0x42fd, 0x20c3, 0x0000, 0x2468, 0x2bd5, 0x259f, 0x0ef1, 0x1d79,
+	    0x0ae2, 0x036f, 0x478e, 0x2227, 0x0eea, 0x1d55, 0x36e0, 0x42f1,
+	    0x2135, 0x4ad8, 0x00b1, 0x4b0b, 0x452b, 0x0eb4, 0x0f05, 0x2ab0,
+	    0x16b9, 0x0000, 0x4d76, 0x1ef4, 0x39c0, 0x0000, 0x0653, 0x0c23,
+	    0x0dcd, 0x21d6, 0x0000, 0x325b, 0x040e, 0x1ba9, 0x3bcf, 0x4d2f,
+	    0x0000, 0x0000, 0x1ac4, 0x0cc9, 0x0000, 0x01e6, 0x0ba6, 0x0aa3,
+	    0x4b71, 0x40ee, 0x1255, 0x4b76, 0x223d, 0x0000, 0x3569, 0x0000,
+	    0x2c7f, 0x0000, 0x04ee, 0x0d01, 0x1bf5, 0x49a4, 0x2231, 0x4d69,
+	    0x2180, 0x23fc, 0x4dda, 0x0a0b, 0x0000, 0x3c3b, 0x06be, 0x457c,
+	    0x0000, 0x1d2d, 0x4cb0, 0x0000, 0x4008, 0x46c9, 0x0637, 0x13af,
+	    0x17e1, 0x2db9, 0x2e98, 0x3c4a, 0x21d6, 0x0000, 0x22b4, 0x0000,
+	    0x20e5, 0x39a1, 0x4b7c, 0x22a0, 0x4045, 0x0b49, 0x11fe, 0x4700,
+	    0x3c02, 0x3b52, 0x0000, 0x10fd, 0x0ef7, 0x0000, 0x1557, 0x4766,
+	    0x0000, 0x4c73, 0x0000, 0x0000, 0x4bdc, 0x40b7, 0x0000, 0x40c5,
+	    0x372c, 0x2a3f, 0x403e, 0x0000, 0x1ab5, 0x1dc0, 0x0000, 0x0000,
+	    0x1951, 0x0000, 0x0000, 0x1f0f, 0x206c, 0x0000, 0x45a1, 0x4342,
+	    0x1b03, 0x0bf4, 0x0d71, 0x2af7, 0x2ef9, 0x358a, 0x24fc, 0x22e5,
+	    0x0000, 0x404b, 0x1092, 0x15d3, 0x13e5, 0x3a65, 0x2881, 0x39b5,
+	    0x0000, 0x0000, 0x12de, 0x041d, 0x1260, 0x3212, 0x2389, 0x2ad8,
+	    0x21a0, 0x0cd3, 0x3c18, 0x36a0, 0x1473, 0x2e64, 0x2e8e, 0x2a7d,
+	    0x3e2a, 0x4bbb, 0x3239, 0x08d7, 0x021c, 0x187e, 0x1115, 0x3087,
+	    0x0919, 0x40bb, 0x237d, 0x210b, 0x4d1e, 0x14bd, 0x32a2, 0x0000,
+	    0x30e8, 0x17a3, 0x093c, 0x2377, 0x4960, 0x2aed, 0x4dba, 0x1c8a,
+	    0x3519, 0x09b9, 0x0000, 0x0000, 0x3c12, 0x4969, 0x0380, 0x3a5b,
+	    0x00cd, 0x0d52, 0x4420, 0x1359, 0x0000, 0x45c9, 0x0826, 0x3ec5,
+	    0x4165, 0x0000, 0x438c, 0x3f04, 0x0c61, 0x0000, 0x0d8f, 0x1bf8,
+	    0x2004, 0x2f51, 0x46fa, 0x2592, 0x0d16, 0x3ef8, 0x2d7e, 0x4831,
+	    0x0000, 0x2a6e, 0x385d, 0x0000, 0x1f5d, 0x27e3, 0x19bc, 0x436e,
+	    0x0000, 0x30bb, 0x013c, 0x1619, 0x1ea3, 0x3365, 0x3a79, 0x0000,
+	    0x0b86, 0x3775, 0x0000, 0x45cf, 0x03cd, 0x42e1, 0x172c, 0x48a7,
+	    0x2860, 0x05bc, 0x0873, 0x27cc, 0x15a3, 0x1f46, 0x3edf, 0x3980,
+	    0x0000, 0x4265, 0x46c8, 0x4b5a, 0x146d, 0x4289, 0x2bd8, 0x20f7,
+	    0x252b, 0x0cd1, 0x26c7, 0x04a0, 0x06c7, 0x2534, 0x41bf, 0x2f40,
+	    0x1b79, 0x2462, 0x453c, 0x3d6c, 0x2b2f, 0x0c1f, 0x0ebf, 0x22cf,
+	    0x45f0, 0x09dd, 0x4223, 0x0000, 0x0c07, 0x0e37, 0x345e, 0x04c9,
+	    0x403d, 0x0290, 0x2f5e, 0x2324, 0x0000, 0x42aa, 0x0891, 0x01ec,
+	    0x1d66, 0x0f8a, 0x0000, 0x0ae1, 0x0000, 0x4a18, 0x0000, 0x0000,
+	    0x4daf, 0x0000, 0x0f99, 0x4417, 0x4a8f, 0x3c1a, 0x1486, 0x2f84,
+	    0x2403, 0x0000, 0x245c, 0x439a, 0x1486, 0x231f, 0x1e7b, 0x17d2,
+	    0x0a2e, 0x0357, 0x0c28, 0x09d4, 0x1b73, 0x361d, 0x3f50, 0x1697,
+	    0x39a5, 0x4e01, 0x1edc, 0x29a2, 0x4a7c, 0x0000, 0x0b58, 0x0306,
+	    0x0205, 0x31e8, 0x0ebf, 0x4188, 0x3c81, 0x2d9a, 0x17bd, 0x4327,
+	    0x4bcd, 0x38d3, 0x3f11, 0x41ca, 0x33fb, 0x4ac2, 0x0000, 0x4db0,
+	    0x1f66, 0x1b37, 0x3d4a, 0x1cff, 0x0000, 0x0000, 0x24a4, 0x325e,
+	    0x0a13, 0x2741, 0x4338, 0x0000, 0x0000, 0x3bd1, 0x0000, 0x0000,
+	    0x1c1c, 0x41b6, 0x1c4c, 0x1c8b, 0x4bd0, 0x0a52, 0x397e, 0x1c50,
+	    0x0916, 0x4239, 0x1a17, 0x0000, 0x4cb7, 0x4311, 0x0f27, 0x16b3,
+	    0x40b3, 0x0d87, 0x0000, 0x2ee6, 0x3a3d, 0x2696, 0x0000, 0x0000,
+	    0x0994, 0x0000, 0x1adc, 0x1003, 0x0000, 0x34df, 0x34fa, 0x0000,
+	    0x1309, 0x248b, 0x457a, 0x3218, 0x475e, 0x141f, 0x0870, 0x1c2a,
+	    0x4d5f, 0x1a0a, 0x0000, 0x0f3e, 0x0038, 0x2abd, 0x02e2, 0x315f,
+	    0x1f72, 0x30cd, 0x12f6, 0x3725, 0x443d, 0x28d3, 0x2f13, 0x0000,
+	    0x277f, 0x39f7, 0x2904, 0x0000, 0x26bc, 0x028a, 0x3812, 0x0ff2,
+	    0x4ace, 0x3dde, 0x2455, 0x0000, 0x0000, 0x2a40, 0x2941, 0x32bc,
+	    0x45b1, 0x147b, 0x149a, 0x251c, 0x1dc5, 0x2c03, 0x151b, 0x4b55,
+	    0x35a0, 0x3273, 0x0615, 0x0000, 0x3848, 0x31a2, 0x0000, 0x3185,
+	    0x3cb7, 0x0000, 0x2a5b, 0x0000, 0x04ca, 0x0000, 0x0000, 0x0769,
+	    0x04c5, 0x1d75, 0x0eed, 0x1442, 0x4372, 0x2ffe, 0x1968, 0x0000,
+	    0x283a, 0x03dd, 0x1130, 0x0000, 0x02de, 0x35ca, 0x306a, 0x2969,
+	    0x0411, 0x0000, 0x0000, 0x363b, 0x2e59, 0x3020, 0x4c98, 0x4538,
+	    0x3641, 0x2411, 0x0850, 0x223a, 0x0000, 0x0000, 0x0000, 0x2a8a,
+	    0x4858, 0x458e, 0x34d9, 0x1365, 0x4ceb, 0x1e17, 0x0935, 0x2580,
+	    0x257d, 0x0000, 0x1f85, 0x0e73, 0x32bb, 0x4c44, 0x3be2, 0x0000,
+	    0x197e, 0x0dba, 0x0000, 0x48a4, 0x0000, 0x078c, 0x1062, 0x13e2,
+	    0x0b4e, 0x3cd9, 0x257f, 0x3e22, 0x20b4, 0x4261, 0x2295, 0x3f22,
+	    0x0000, 0x1ca2, 0x0000, 0x418d, 0x37af, 0x4893, 0x2a07, 0x1ab4,
+	    0x1aa4, 0x3b0f, 0x4a89, 0x0000, 0x2d82, 0x2caa, 0x414c, 0x0352,
+	    0x0f67, 0x3ce9, 0x2ab1, 0x07e9, 0x4461, 0x0635, 0x189a, 0x0000,
+	    0x0fa4, 0x3e70, 0x2b7b, 0x3ba0, 0x399f, 0x328f, 0x0000, 0x4077,
+	    0x37be, 0x4319, 0x2b15, 0x1703, 0x47cf, 0x0000, 0x26e9, 0x06c6,
+	    0x4d19, 0x361b, 0x1ac2, 0x1337, 0x0000, 0x435b, 0x151e, 0x43d8,
+	    0x4177, 0x0da7, 0x17d5, 0x0000, 0x0000, 0x3743, 0x2ceb, 0x0cb3,
+	    0x0000, 0x1746, 0x09b8, 0x135f, 0x422e, 0x0000, 0x47c8, 0x0a78,
+	    0x2067, 0x1a92, 0x0f3a, 0x11da, 0x2112, 0x256e, 0x25d7, 0x1d2f,
+	    0x0c27, 0x0000, 0x484a, 0x0000, 0x0000, 0x09a5, 0x121e, 0x35a5,
+	    0x0000, 0x2baf, 0x4dc4, 0x0000, 0x0000, 0x4def, 0x3d97, 0x0442,
+	    0x12c6, 0x42d3, 0x0b83, 0x0000, 0x48e1, 0x3fbe, 0x2087, 0x3a07,
+	    0x2194, 0x40f6, 0x099d, 0x105c, 0x312d, 0x19f4, 0x0000, 0x22c7,
+	    0x0000, 0x1520, 0x09cf, 0x1d50, 0x3367, 0x48f6, 0x0d51, 0x1e68,
+	    0x2ea9, 0x0000, 0x436d, 0x0827, 0x03bb, 0x48ed, 0x37c1, 0x41e6,
+	    0x331b, 0x1d00, 0x0740, 0x4269, 0x264a, 0x0000, 0x3313, 0x209c,
+	    0x4a03, 0x28da, 0x34bb, 0x0000, 0x4d8c, 0x0ec3, 0x1570, 0x403d,
+	    0x0718, 0x0a24, 0x3dab, 0x3438, 0x1f33, 0x0c1c, 0x0000, 0x3eac,
+	    0x1256, 0x0d0e, 0x1c3d, 0x3637, 0x0000, 0x48ee, 0x3123, 0x1136,
+	    0x1c78, 0x23f3, 0x0000, 0x3abe, 0x060f, 0x0000, 0x408b, 0x49ed,
+	    0x3bc3, 0x2576, 0x3c00, 0x2ec4, 0x1c19, 0x2309, 0x2718, 0x0000,
+	    0x1419, 0x0568, 0x0000, 0x34fd, 0x4de1, 0x0000, 0x0000, 0x2181,
+	    0x0c96, 0x0000, 0x2e64, 0x4c35, 0x0000, 0x1e30, 0x0000, 0x443c,
+	    0x165e, 0x0841, 0x0000, 0x0a71, 0x4a3e, 0x1939, 0x0000, 0x054e,
+	    0x3e99, 0x16fe, 0x2db4, 0x03fa, 0x4a1f, 0x236f, 0x4b47, 0x0153,
+	    0x0000, 0x2422, 0x2747, 0x02a1, 0x28b6, 0x0000, 0x0000, 0x0256,
+	    0x0646, 0x0e08, 0x4d25, 0x009b, 0x032f, 0x1b83, 0x0709, 0x12e5,
+	    0x1bb7, 0x3c08, 0x4285, 0x3353, 0x0000, 0x0000, 0x013e, 0x1b4c,
+	    0x0000, 0x2905, 0x4ddc, 0x27e7, 0x0338, 0x4ac8, 0x1907, 0x0000,
+	    0x0000, 0x263b, 0x0000, 0x24ce, 0x125b, 0x4457, 0x2f06, 0x0d4e,
+	    0x0000, 0x470b, 0x0000, 0x4a66, 0x0ff7, 0x4bd5, 0x17c1, 0x4650,
+	    0x24a7, 0x3f5b, 0x09fd, 0x26fb, 0x48c8, 0x0000, 0x183e, 0x0d1a,
+	    0x2f23, 0x3d87, 0x28db, 0x1e6e, 0x36c7, 0x25e6, 0x1326, 0x0000,
+	    0x0000, 0x0813, 0x10c8, 0x34b7, 0x0cc5, 0x3e0b, 0x0abf, 0x4444,
+	    0x0000, 0x4573, 0x0000, 0x0000, 0x23b6, 0x1438, 0x2b5f, 0x3e86,
+	    0x0865, 0x00d9, 0x1a2e, 0x07b6, 0x4d0a, 0x0000, 0x26fe, 0x0000,
+	    0x2491, 0x0b1e, 0x24fc, 0x1b20, 0x2344, 0x018e, 0x2cf5, 0x4b19,
+	    0x066b, 0x4cdc, 0x0e4f, 0x32ef, 0x074a, 0x0000, 0x3cd0, 0x40cd,
+	    0x3a20, 0x4171, 0x2b33, 0x1705, 0x381a, 0x4199, 0x1f76, 0x102a,
+	    0x3946, 0x3488, 0x29f4, 0x4394, 0x323b, 0x0000, 0x1934, 0x1c0a,
+	    0x0b77, 0x2f45, 0x00d5, 0x4d4a, 0x0000, 0x01bd, 0x0cae, 0x36af,
+	    0x468f, 0x1666, 0x3b3d, 0x0000, 0x483f, 0x1607, 0x074b, 0x33a2,
+	    0x2ac8, 0x152b, 0x0974, 0x2323, 0x0026, 0x46bd, 0x2f8f, 0x37b7,
+	    0x2409, 0x1b38, 0x26e9, 0x4a05, 0x4c36, 0x0000, 0x48ad, 0x0d73,
+	    0x28ab, 0x0ed2, 0x135b, 0x3b0b, 0x071e, 0x2164, 0x4b75, 0x2eeb,
+	    0x1b98, 0x151d, 0x0000, 0x114e, 0x2c5e, 0x0312, 0x3d6c, 0x0000,
+	    0x497c, 0x11e2, 0x46aa, 0x1c4f, 0x32f2, 0x1b27, 0x2672, 0x15c1,
+	    0x2abb, 0x2d47, 0x32e4, 0x4918, 0x0000, 0x31bd, 0x0000, 0x1398,
+	    0x1e3c, 0x43d8, 0x0245, 0x179e, 0x0000, 0x0000, 0x4646, 0x0000,
+	    0x1884, 0x4d43, 0x1716, 0x36f8, 0x26b9, 0x4bce, 0x0000, 0x1c18,
+	    0x3425, 0x2b46, 0x2d87, 0x1f2c, 0x2ee7, 0x001b, 0x4133, 0x0000,
+	    0x41fe, 0x0857, 0x0000, 0x0159, 0x420e, 0x2a04, 0x049f, 0x3889,
+	    0x0000, 0x3392, 0x3d12, 0x25ff, 0x0000, 0x425a, 0x152a, 0x0000,
+	    0x3f2c, 0x4981, 0x1274, 0x02bb, 0x0000, 0x3fd3, 0x2f10, 0x3e45,
+	    0x3540, 0x00ea, 0x26a5, 0x2485, 0x2db7, 0x1205, 0x2b69, 0x1aeb,
+	    0x07bb, 0x04f1, 0x251e, 0x12b4, 0x1e5d, 0x4890, 0x2767, 0x0625,
+	    0x4cc0, 0x1757, 0x0374, 0x01d2, 0x1c75, 0x1a8a, 0x1c80, 0x0f7c,
+	    0x443a, 0x4c9d, 0x4457, 0x0e39, 0x38c0, 0x1ef2, 0x217c, 0x00cb,
+	    0x345c, 0x1fb7, 0x125c, 0x4589, 0x3dfb, 0x0000, 0x2703, 0x1265,
+	    0x0000, 0x3a7a, 0x19eb, 0x3ad4, 0x435c, 0x0201, 0x3ba5, 0x0000,
+	    0x0000, 0x177a, 0x3bb8, 0x28c8, 0x494c, 0x4c22, 0x3181, 0x1651,
+	    0x343b, 0x425e, 0x144b, 0x4c07, 0x153b, 0x3cd9, 0x0000, 0x3f6c,
+	    0x46aa, 0x0f2f, 0x2271, 0x2b49, 0x3cd9, 0x0b91, 0x0000, 0x263c,
+	    0x0000, 0x4424, 0x3181, 0x0000, 0x1c0e, 0x05cc, 0x1b04, 0x392b,
+	    0x4b7d, 0x075d, 0x49ed, 0x2d32, 0x0000, 0x051e, 0x0833, 0x1e98,
+	    0x2f61, 0x0795, 0x0000, 0x4275, 0x0ad8, 0x1d5b, 0x27f9, 0x2bea,
+	    0x485e, 0x0b8e, 0x0000, 0x0000, 0x05d8, 0x4a64, 0x2198, 0x1fe2,
+	    0x0cdc, 0x1845, 0x1367, 0x0681, 0x0b7e, 0x17ba, 0x1ead, 0x1f08,
+	    0x11e2, 0x016f, 0x3116, 0x0650, 0x1bcc, 0x39d8, 0x3aed, 0x00ee,
+	    0x1bd2, 0x02b0, 0x0501, 0x0000, 0x384e, 0x0000, 0x19f1, 0x4608,
+	    0x1d7d, 0x0104, 0x23e5, 0x361c, 0x44cc, 0x0446, 0x4943, 0x3fda,
+	    0x3306, 0x0000, 0x0f6d, 0x48c8, 0x118c, 0x20a2, 0x0338, 0x3aa8,
+	    0x4b7b, 0x09c5, 0x0000, 0x2028, 0x44ad, 0x078c, 0x0000, 0x357e,
+	    0x4375, 0x0a9d, 0x458e, 0x3e68, 0x1ae2, 0x28f0, 0x4a64, 0x2532,
+	    0x1518, 0x2487, 0x150f, 0x0000, 0x44d3, 0x3789, 0x3af7, 0x041a,
+	    0x0000, 0x2a2a, 0x26d9, 0x3576, 0x0000, 0x284b, 0x0000, 0x0000,
+	    0x1ece, 0x326a, 0x23e0, 0x0e42, 0x138e, 0x2a70, 0x321b, 0x2be3,
+	    0x0000, 0x0000, 0x340f, 0x34fd, 0x4905, 0x3f50, 0x3d74, 0x1b83,
+	    0x0000, 0x0671, 0x2052, 0x150b, 0x3e08, 0x0000, 0x0995, 0x17a5,
+	    0x073c, 0x38bc, 0x36e1, 0x2ffd, 0x0bda, 0x0000, 0x10f3, 0x360c,
+	    0x0000, 0x2edb, 0x3fc8, 0x1605, 0x27ed, 0x3150, 0x3b76, 0x3e53,
+	    0x0e57, 0x4777, 0x0000, 0x1203, 0x220a, 0x1a9e, 0x2cc3, 0x3f93,
+	    0x2201, 0x4493, 0x4a1a, 0x48cb, 0x083d, 0x347d, 0x1dcd, 0x3a5a,
+	    0x4797, 0x3be4, 0x22f2, 0x4dc2, 0x39a4, 0x24ac, 0x298e, 0x1290,
+	    0x290b, 0x0b7a, 0x348c, 0x3336, 0x1d25, 0x02a0, 0x1357, 0x0000,
+	    0x18d7, 0x300d, 0x4829, 0x0290, 0x411f, 0x16eb, 0x1715, 0x13ce,
+	    0x0b7c, 0x0000, 0x3c12, 0x0641, 0x224c, 0x0000, 0x390c, 0x06b9,
+	    0x0149, 0x1174, 0x1557, 0x169a, 0x01b3, 0x10e1, 0x3986, 0x29d8,
+	    0x30c3, 0x39c3, 0x0000, 0x1ef1, 0x008b, 0x0000, 0x0000, 0x373d,
+	    0x0000, 0x339f, 0x3f04, 0x14c8, 0x10ea, 0x0000, 0x05b8, 0x0000,
+	    0x378f, 0x4d23, 0x0000, 0x43eb, 0x2682, 0x4c0f, 0x168c, 0x3cdc,
+	    0x1c0d, 0x0000, 0x06ed, 0x3d45, 0x3d24, 0x06aa, 0x4d55, 0x22ff,
+	    0x3c4d, 0x0588, 0x08b9, 0x4b64, 0x1db3, 0x0139, 0x42a7, 0x2073,
+	    0x201d, 0x320d, 0x2e1f, 0x13fb, 0x0000, 0x0000, 0x0000, 0x1831,
+	    0x2292, 0x27e9, 0x086d, 0x0000, 0x0c88, 0x10cf, 0x2ba4, 0x2f28,
+	    0x2ce7, 0x2b20, 0x31d8, 0x3c27, 0x0a1b, 0x0016, 0x0000, 0x3f1c,
+	    0x1227, 0x3a35, 0x1fdd, 0x3c34, 0x0000, 0x45a4, 0x05fc, 0x0d28,
+	    0x0000, 0x141d, 0x4d41, 0x431b, 0x14ff, 0x2a52, 0x3bc9, 0x166d,
+	    0x330c, 0x4cc2, 0x13ed, 0x49fd, 0x0000, 0x20af, 0x3cda, 0x3db6,
+	    0x0000, 0x1628, 0x45e5, 0x41c8, 0x2f46, 0x372b, 0x21cb, 0x0000,
+	    0x28b4, 0x0581, 0x3de6, 0x0650, 0x0000, 0x0000, 0x2f58, 0x0000,
+	    0x1b8e, 0x20dd, 0x4d62, 0x2332, 0x0000, 0x00b5, 0x2a83, 0x0000,
+	    0x0000, 0x05fa, 0x129a, 0x360a, 0x1d40, 0x2b11, 0x0000, 0x41aa,
+	    0x2bfa, 0x38fe, 0x010c, 0x0d3e, 0x3aed, 0x151f, 0x0000, 0x3e52,
+	    0x0a65, 0x1467, 0x3c9d, 0x0000, 0x27a8, 0x07dd, 0x0000, 0x0351,
+	    0x3774, 0x3d02, 0x31cc, 0x2dfe, 0x4165, 0x140f, 0x1421, 0x34db,
+	    0x01b7, 0x0d83, 0x21a7, 0x0000, 0x4030, 0x31df, 0x4a24, 0x1cef,
+	    0x1bd4, 0x16f5, 0x199a, 0x2a59, 0x34de, 0x0529, 0x3eed, 0x0088,
+	    0x47c4, 0x16a6, 0x41c5, 0x17d1, 0x0000, 0x0000, 0x0000, 0x312e,
+	    0x42ff, 0x0000, 0x124a, 0x1b02, 0x46d8, 0x0dd5, 0x0000, 0x38ef,
+	    0x43ba, 0x42d5, 0x2ee1, 0x2100, 0x2663, 0x0000, 0x0562, 0x4a64,
+	    0x0000, 0x2f9b, 0x0000, 0x0000, 0x379b, 0x4b2e, 0x04ba, 0x2dbe,
+	    0x0000, 0x347e, 0x0000, 0x4023, 0x2080, 0x4a5b, 0x0818, 0x2f63,
+	    0x3fbc, 0x0000, 0x0000, 0x27f4, 0x4358, 0x0000, 0x1607, 0x475b,
+	    0x0000, 0x3528, 0x148e, 0x2098, 0x37e1, 0x4d7e, 0x2c7b, 0x0af2,
+	    0x3a0b, 0x1cb3, 0x3ddb, 0x141d, 0x116c, 0x0000, 0x491b, 0x050a,
+	    0x1a00, 0x457f, 0x3078, 0x058b, 0x28ad, 0x113a, 0x30e4, 0x0efc,
+	    0x20ae, 0x2a0f, 0x252d, 0x3e6a, 0x31b6, 0x0d0a, 0x2a2c, 0x2838,
+	    0x212d, 0x3538, 0x155a, 0x0365, 0x3157, 0x4538, 0x0695, 0x2852,
+	    0x0044, 0x1682, 0x4557, 0x4632, 0x3b5b, 0x0000, 0x24be, 0x2058,
+	    0x0000, 0x0000, 0x243d, 0x29cc, 0x47ac, 0x2b12, 0x401c, 0x085f,
+	    0x4d53, 0x364f, 0x0000, 0x0187, 0x40c3, 0x2c87, 0x3be7, 0x11c1,
+	    0x4c71, 0x202b, 0x210b, 0x17dc, 0x475c, 0x305f, 0x0000, 0x0bfd,
+	    0x0443, 0x3d14, 0x2e85, 0x1f4a, 0x3f4b, 0x0000, 0x325d, 0x327c,
+	    0x4628, 0x164d, 0x4a27, 0x4985, 0x1354, 0x4a68, 0x343e, 0x1794,
+	    0x0000, 0x3fcd, 0x0000, 0x0000, 0x0e1a, 0x0000, 0x087f, 0x3e59,
+	    0x1bd8, 0x3986, 0x3400, 0x2d28, 0x06b9, 0x2fbf, 0x4c2d, 0x03ad,
+	    0x266f, 0x355f, 0x1063, 0x4a6f, 0x2caf, 0x4c7c, 0x298d, 0x0000,
+	    0x24cc, 0x0000, 0x103d, 0x3a13, 0x2be7, 0x393b, 0x3334, 0x0000,
+	    0x0000, 0x0000, 0x31ac, 0x3cd6, 0x1a3b, 0x4be3, 0x3a85, 0x0000,
+	    0x0000, 0x10bc, 0x3fd4, 0x43e6, 0x050e, 0x0000, 0x0000, 0x4844,
+	    0x3f91, 0x2d7c, 0x34c6, 0x220f, 0x2875, 0x25b4, 0x1e0c, 0x0369,
+	    0x15f7, 0x09f5, 0x0000, 0x493f, 0x1c37, 0x1f11, 0x240a, 0x0c5e,
+	    0x0000, 0x2614, 0x2e49, 0x1367, 0x0000, 0x42c1, 0x0000, 0x4d72,
+	    0x3573, 0x3f5f, 0x139e, 0x3d23, 0x10a6, 0x0000, 0x0d5c, 0x11e0,
+	    0x219a, 0x252d, 0x4b19, 0x31ab, 0x3aa6, 0x1729, 0x0000, 0x0000,
+	    0x1d78, 0x3247, 0x1465, 0x0000, 0x0aa1, 0x0f23, 0x23d3, 0x1e2a,
+	    0x0825, 0x282d, 0x0d20, 0x4e1c, 0x21cd, 0x3aa1, 0x3a97, 0x283c,
+	    0x27dc, 0x418e, 0x04e1, 0x2f86, 0x066b, 0x32aa, 0x0381, 0x1574,
+	    0x049a, 0x0e86, 0x1836, 0x3c50, 0x2dd6, 0x1437, 0x0b5a, 0x2526,
+	    0x20a5, 0x15e4, 0x0000, 0x3bd4, 0x3eae, 0x3712, 0x1667, 0x1ae0,
+	    0x407f, 0x1143, 0x1aab, 0x497f, 0x2227, 0x0000, 0x42d9, 0x2a35,
+	    0x3b2c, 0x3b0c, 0x1bee, 0x39bf, 0x0024, 0x253c, 0x2e56, 0x1f67,
+	    0x1787, 0x2a1f, 0x0000, 0x0000, 0x0992, 0x3f9d, 0x0000, 0x0000,
+	    0x4cc1, 0x3754, 0x1af6, 0x493a, 0x3269, 0x017b, 0x1250, 0x478d,
+	    0x031d, 0x394c, 0x1e71, 0x1fbd, 0x38cb, 0x03c0, 0x2fa5, 0x253f,
+	    0x0000, 0x0000, 0x0558, 0x42ff, 0x177f, 0x14cf, 0x4656, 0x3797,
+	    0x0000, 0x0000, 0x3f5c, 0x210d, 0x0de0, 0x3d8a, 0x0000, 0x3112,
+	    0x0364, 0x45fd, 0x315d, 0x0000, 0x3670, 0x0c3e, 0x2e9d, 0x294f,
+	    0x3922, 0x49ad, 0x32b8, 0x0000, 0x469f, 0x4a09, 0x2d8a, 0x3b6a,
+	    0x48c5, 0x225b, 0x33a6, 0x08b7, 0x0000, 0x254c, 0x1462, 0x33d8,
+	    0x31fe, 0x1fb7, 0x11a7, 0x2d3d, 0x0000, 0x0000, 0x0b06, 0x4d58,
+	    0x1452, 0x105d, 0x34cd, 0x358b, 0x2029, 0x26cc, 0x0e1c, 0x318f,
+	    0x36b6, 0x0000, 0x24a5, 0x36c7, 0x147f, 0x0000, 0x2099, 0x3919,
+	    0x12fb, 0x11b4, 0x0602, 0x46df, 0x3ae1, 0x4d7f, 0x007c, 0x255e,
+	    0x03a5, 0x09c6, 0x0ed1, 0x2443, 0x24be, 0x4d06, 0x1f3c, 0x03bf,
+	    0x332c, 0x0000, 0x0453, 0x2e40, 0x28c8, 0x38f5, 0x146b, 0x3eb5,
+	    0x1a3d, 0x4399, 0x4953, 0x3927, 0x2e03, 0x0d85, 0x0000, 0x2175,
+	    0x1266, 0x092a, 0x2e9c, 0x4de1, 0x480f, 0x1fa3, 0x350a, 0x3ff4,
+	    0x0ea1, 0x1f0c, 0x3916, 0x0df9, 0x0000, 0x2835, 0x37b9, 0x1447,
+	    0x2d12, 0x00a0, 0x0068, 0x45e5, 0x15e6, 0x23b2, 0x0000, 0x3c89,
+	    0x44e7, 0x31cb, 0x17f6, 0x0000, 0x46ce, 0x0a96, 0x245e, 0x0370,
+	    0x4856, 0x2718, 0x2820, 0x26f9, 0x4d58, 0x45bc, 0x18a7, 0x2280,
+	    0x2616, 0x30ca, 0x25e8, 0x3553, 0x2381, 0x37fb, 0x1913, 0x0d30,
+	    0x0000, 0x0000, 0x436c, 0x384b, 0x282d, 0x3506, 0x0000, 0x12df,
+	    0x002b, 0x3f0c, 0x1a03, 0x4d86, 0x4cf8, 0x1881, 0x1889, 0x0083,
+	    0x3fb9, 0x3b9b, 0x25c6, 0x4c59, 0x386b, 0x2edb, 0x0000, 0x06e3,
+	    0x27dc, 0x1633, 0x13ed, 0x1b3b, 0x0000, 0x0000, 0x182a, 0x1bba,
+	    0x2d83, 0x23a7, 0x39c9, 0x172c, 0x07c9, 0x3f09, 0x0faf, 0x0000,
+	    0x0000, 0x0c6b, 0x0000, 0x0ef3, 0x29ee, 0x0229, 0x114d, 0x007d,
+	    0x312f, 0x3aa7, 0x2719, 0x0000, 0x1b17, 0x19ba, 0x0fa4, 0x405e,
+	    0x1031, 0x0000, 0x204e, 0x1e4f, 0x3929, 0x4135, 0x27cd, 0x0000,
+	    0x010c, 0x4a62, 0x3f0a, 0x4d43, 0x1dba, 0x05f6, 0x087d, 0x3c2a,
+	    0x0e69, 0x0000, 0x06a0, 0x0000, 0x398f, 0x4d1d, 0x163b, 0x353c,
+	    0x2669, 0x36e3, 0x17a3, 0x3fc3, 0x1c4a, 0x4ae2, 0x026e, 0x0000,
+	    0x4047, 0x0000, 0x352a, 0x0607, 0x2bb3, 0x3783, 0x2eb1, 0x0827,
+	    0x2835, 0x02b6, 0x0000, 0x4103, 0x4180, 0x1194, 0x4a49, 0x0cd9,
+	    0x2829, 0x0786, 0x28b5, 0x44b8, 0x0237, 0x07f8, 0x1ccf, 0x338b,
+	    0x0d0b, 0x222e, 0x0000, 0x0000, 0x4340, 0x0773, 0x4b57, 0x41b2,
+	    0x319c, 0x1b5c, 0x03ff, 0x0ff2, 0x0f64, 0x0000, 0x0155, 0x1b70,
+	    0x25f5, 0x459d, 0x0000, 0x2cf2, 0x1a14, 0x36ad, 0x3566, 0x0000,
+	    0x0000, 0x440c, 0x0b1b, 0x2810, 0x4bbe, 0x0000, 0x0125, 0x4c76,
+	    0x07b7, 0x1e8c, 0x2dae, 0x176e, 0x0000, 0x0000, 0x273a, 0x0e7e,
+	    0x0000, 0x0365, 0x2953, 0x2c64, 0x4de7, 0x1bfb, 0x3c1f, 0x0000,
+	    0x0221, 0x007e, 0x0000, 0x314f, 0x0000, 0x14c9, 0x4c5e, 0x46da,
+	    0x02a1, 0x47d6, 0x3c64, 0x48b4, 0x294d, 0x4d7b, 0x0000, 0x367e,
+	    0x42ab, 0x1dcc, 0x269a, 0x4abf, 0x0000, 0x4840, 0x0d86, 0x19a1,
+	    0x3b9e, 0x13d6, 0x458f, 0x3733, 0x0000, 0x4c7c, 0x0000, 0x086d,
+	    0x14d1, 0x0d93, 0x0ef7, 0x3b54, 0x075c, 0x29c9, 0x0343, 0x0000,
+	    0x1c6f, 0x40d4, 0x414e, 0x3afe, 0x3981, 0x3b94, 0x079d, 0x428a,
+	    0x0000, 0x48e3, 0x0000, 0x022e, 0x4759, 0x0bae, 0x46de, 0x0ac1,
+	    0x4706, 0x0000, 0x0000, 0x2ff8, 0x40ec, 0x3a1d, 0x3e4b, 0x0000,
+	    0x2fbf, 0x0c79, 0x20e4, 0x25fb, 0x112c, 0x0d32, 0x0000, 0x1e0e,
+	    0x338d, 0x3833, 0x471c, 0x4576, 0x0000, 0x19ac, 0x0000, 0x454e,
+	    0x0000, 0x057c, 0x1c65, 0x2c03, 0x2b80, 0x1513, 0x1245, 0x3572,
+	    0x010e, 0x0000, 0x32da, 0x09e6, 0x0000, 0x4d4b, 0x3789, 0x28bc,
+	    0x499e, 0x4141, 0x4cef, 0x2e75, 0x0c12, 0x307b, 0x0000, 0x032d,
+	    0x1475, 0x00b8, 0x0e64, 0x1f09, 0x43d9, 0x2c34, 0x4d58, 0x02a4,
+	    0x0aa7, 0x3844, 0x1cd8, 0x0583, 0x40b2, 0x0000, 0x0b80, 0x4cfc,
+	    0x2576, 0x2774, 0x4b51, 0x1008, 0x4841, 0x20a3, 0x43ea, 0x399d,
+	    0x4d6e, 0x283f, 0x36c1, 0x1509, 0x1069, 0x0000, 0x3ba7, 0x0000,
+	    0x0000, 0x2f1a, 0x18b2, 0x2e91, 0x36d8, 0x275b, 0x374b, 0x0ed2,
+	    0x0143, 0x0000, 0x3d5d, 0x4300, 0x185f, 0x4533, 0x389d, 0x0221,
+	    0x4407, 0x409e, 0x1a26, 0x0000, 0x2be9, 0x0000, 0x2ad6, 0x2eaa,
+	    0x4599, 0x354f, 0x030b, 0x397d, 0x476e, 0x4df9, 0x2dfc, 0x2acc,
+	    0x45a1, 0x4919, 0x01cf, 0x47c6, 0x08e8, 0x26eb, 0x1942, 0x4579,
+	    0x22a6, 0x3d59, 0x2cba, 0x0a8d, 0x20c5, 0x3128, 0x2121, 0x4380,
+	    0x0fa8, 0x473a, 0x2c1d, 0x45d9, 0x46ef, 0x0000, 0x0000, 0x1b35,
+	    0x2cd3, 0x2849, 0x0975, 0x0000, 0x29ec, 0x4a87, 0x4047, 0x2aae,
+	    0x2c8e, 0x0000, 0x44de, 0x10b1, 0x09af, 0x0000, 0x1147, 0x057e,
+	    0x0000, 0x2ab5, 0x0f47, 0x0983, 0x2a1e, 0x0000, 0x3db4, 0x0000,
+	    0x1897, 0x378f, 0x3c61, 0x1f66, 0x4850, 0x2f5c, 0x3ab5, 0x0e1e,
+	    0x0000, 0x4988, 0x43b3, 0x3c56, 0x0ed1, 0x3e88, 0x0000, 0x27d1,
+	    0x2718, 0x0000, 0x3e19, 0x0000, 0x0339, 0x1eb2, 0x20a4, 0x0d09,
+	    0x1dc3, 0x2615, 0x2c39, 0x1ab9, 0x1bb8, 0x4dfa, 0x0152, 0x0000,
+	    0x112a, 0x35bf, 0x3d78, 0x1a58, 0x2a4f, 0x0fae, 0x1791, 0x19a9,
+	    0x1002, 0x21a5, 0x0000, 0x0000, 0x0000, 0x15e2, 0x2de5, 0x2828,
+	    0x317d, 0x05af, 0x3bbc, 0x137b, 0x0096, 0x0867, 0x0000, 0x0000,
+	    0x389a, 0x40f2, 0x0000, 0x21d8, 0x2886, 0x4a88, 0x256e, 0x3839,
+	    0x4cae, 0x2db5, 0x0577, 0x09b4, 0x3a87, 0x165f, 0x403e, 0x195e,
+	    0x431e, 0x1e99, 0x4382, 0x1246, 0x23d3, 0x361d, 0x1b9a, 0x4b4e,
+	    0x0540, 0x057c, 0x0aa9, 0x0000, 0x2211, 0x4547, 0x0000, 0x3b74,
+	    0x02a8, 0x0947, 0x4cc2, 0x0cf0, 0x226d, 0x4374, 0x06f5, 0x0000,
+	    0x2fb1, 0x3b62, 0x22f2, 0x1afd, 0x40d2, 0x44a4, 0x0bd1, 0x011b,
+	    0x3eb2, 0x3e60, 0x0000, 0x4ba6, 0x26cd, 0x09ef, 0x123f, 0x4b75,
+	    0x21a7, 0x083f, 0x4d76, 0x0000, 0x1ba4, 0x2f05, 0x2895, 0x2d36,
+	    0x47c6, 0x3caf, 0x27b3, 0x0000, 0x4baf, 0x3754, 0x329d, 0x434f,
+	    0x3190, 0x256c, 0x0490, 0x4647, 0x0000, 0x0000, 0x4ba6, 0x03ae,
+	    0x1450, 0x147b, 0x4a9e, 0x0000, 0x0000, 0x269e, 0x4d69, 0x4102,
+	    0x0000, 0x0000, 0x26b8, 0x2330, 0x3ee5, 0x3c3a, 0x4167, 0x4976,
+	    0x1434, 0x0000, 0x0000, 0x148c, 0x3d44, 0x074b, 0x4324, 0x34d6,
+	    0x4e12, 0x3374, 0x0000, 0x0550, 0x10af, 0x0000, 0x1b02, 0x2672,
+	    0x2f95, 0x11bf, 0x1bdc, 0x2f69, 0x0000, 0x1e76, 0x2049, 0x1611,
+	    0x47f3, 0x3f98, 0x2f77, 0x1cf1, 0x4558, 0x3e13, 0x31ad, 0x41d2,
+	    0x2c27, 0x488c, 0x492b, 0x42da, 0x25c9, 0x3fb9, 0x0232, 0x0000,
+	    0x0000, 0x2b0d, 0x3249, 0x1db5, 0x3532, 0x1080, 0x0000, 0x0000,
+	    0x0d79, 0x0000, 0x13d9, 0x3a0d, 0x2665, 0x2132, 0x18e4, 0x15fb,
+	    0x05e6, 0x0000, 0x27ec, 0x2c75, 0x4c52, 0x2d61, 0x179c, 0x0300,
+	    0x2a9a, 0x0000, 0x2765, 0x11fa, 0x1935, 0x2fc7, 0x3bcf, 0x4df8,
+	    0x293d, 0x29ac, 0x08b4, 0x0000, 0x2891, 0x2037, 0x37f9, 0x0abb,
+	    0x406b, 0x4d62, 0x0000, 0x1cf6, 0x2adc, 0x0436, 0x40d4, 0x1f5a,
+	    0x219f, 0x2349, 0x337c, 0x3070, 0x2e3b, 0x470e, 0x4a07, 0x40f2,
+	    0x0961, 0x39fc, 0x4d79, 0x03a3, 0x41d9, 0x4b56, 0x0000, 0x4c9e,
+	    0x4b86, 0x3798, 0x36bf, 0x05fa, 0x3a0a, 0x33f7, 0x49e8, 0x4268,
+	    0x2056, 0x035f, 0x0000, 0x4cff, 0x2d79, 0x4bd3, 0x17c2, 0x295b,
+	    0x31ad, 0x053a, 0x3013, 0x00ee, 0x1307, 0x1253, 0x1e44, 0x3880,
+	    0x4aeb, 0x1dcc, 0x08a8, 0x3bc6, 0x02d1, 0x0160, 0x30f9, 0x25a1,
+	    0x417e, 0x2ece, 0x417f, 0x0372, 0x4a6f, 0x0e64, 0x161a, 0x36bf,
+	    0x1a79, 0x33a9, 0x298e, 0x3c16, 0x0934, 0x19e0, 0x28e7, 0x403b,
+	    0x3cb3, 0x39b9, 0x3e7f, 0x1d17, 0x06a0, 0x3a9b, 0x0b52, 0x4619,
+	    0x36ec, 0x3b1b, 0x121d, 0x423e, 0x40e4, 0x274e, 0x0d10, 0x165f,
+	    0x0be6, 0x0aa8, 0x4544, 0x1439, 0x0000, 0x48d0, 0x375f, 0x4ca7,
+	    0x2acf, 0x1b6a, 0x20a3, 0x49b1, 0x2859, 0x21dd, 0x0000, 0x3801,
+	    0x2a09, 0x1e18, 0x238a, 0x4c28, 0x0a5f, 0x2d23, 0x0000, 0x08ca,
+	    0x1f68, 0x0000, 0x0000, 0x4e19, 0x033f, 0x1e08, 0x1d39, 0x1258,
+	    0x0000, 0x3575, 0x0000, 0x1f61, 0x00f4, 0x4108, 0x1844, 0x1fa4,
+	    0x0f20, 0x1017, 0x1c60, 0x237a, 0x3ada, 0x0247, 0x2b15, 0x1e26,
+	    0x0000, 0x1eea, 0x0b00, 0x3014, 0x1b87, 0x33e7, 0x34a3, 0x0bc8,
+	    0x0000, 0x2c72, 0x118a, 0x2937, 0x0000, 0x1e2c, 0x0000, 0x3e47,
+	    0x1569, 0x376a, 0x0000, 0x31f0, 0x43f4, 0x123e, 0x0000, 0x0000,
+	    0x1dc4, 0x4aa0, 0x212e, 0x18e8, 0x0000, 0x29c3, 0x0ecc, 0x060c,
+	    0x427c, 0x3bcc, 0x42b8, 0x020d, 0x16fb, 0x1d57, 0x0557, 0x25db,
+	    0x3163, 0x14c8, 0x0000, 0x37db, 0x0000, 0x04cb, 0x0000, 0x36a6,
+	    0x237a, 0x4600, 0x1ec4, 0x0000, 0x4e08, 0x4171, 0x293e, 0x223a,
+	    0x3dc5, 0x2889, 0x0000, 0x0000, 0x334d, 0x4484, 0x0000, 0x04d3,
+	    0x0c6b, 0x0761, 0x0000, 0x0000, 0x3c78, 0x31d5, 0x0f3f, 0x414f,
+	    0x3107, 0x2c6a, 0x1202, 0x0000, 0x0000, 0x304d, 0x00aa, 0x0e53,
+	    0x1b95, 0x013c, 0x0000, 0x2857, 0x0000, 0x1901, 0x2e0e, 0x4098,
+	    0x247d, 0x4721, 0x3087, 0x3790, 0x4c2a, 0x11b7, 0x37dd, 0x0dac,
+	    0x308b, 0x0000, 0x4d05, 0x395d, 0x37b4, 0x0978, 0x3ab0, 0x2a96,
+	    0x0000, 0x3bfd, 0x48d6, 0x0000, 0x460e, 0x2101, 0x030a, 0x0a7c,
+	    0x2495, 0x0000, 0x43f5, 0x45c2, 0x323b, 0x091e, 0x3fea, 0x1338,
+	    0x1062, 0x2bc3, 0x37b7, 0x21a0, 0x1006, 0x3d77, 0x45af, 0x3c72,
+	    0x0266, 0x35f8, 0x2614, 0x4750, 0x1dfa, 0x1187, 0x063d, 0x06b1,
+	    0x49a0, 0x18c2, 0x0b6f, 0x2e9e, 0x343c, 0x1651, 0x4aee, 0x2ad0,
+	    0x194d, 0x3ee7, 0x115c, 0x0000, 0x1233, 0x0440, 0x0000, 0x0000,
+	    0x0000, 0x3ffe, 0x08a8, 0x15da, 0x3363, 0x3fe4, 0x1947, 0x0000,
+	    0x1434, 0x0bce, 0x3c08, 0x23dd, 0x0000, 0x0000, 0x22e1, 0x2ff2,
+	    0x0457, 0x3133, 0x0000, 0x48a9, 0x0d4d, 0x16ed, 0x016a, 0x0980,
+	    0x362b, 0x4db6, 0x3f20, 0x0a2f, 0x26ff, 0x3dfd, 0x1993, 0x00cd,
+	    0x3711, 0x0000, 0x0000, 0x0000, 0x2096, 0x2158, 0x3e8d, 0x1ae8,
+	    0x0000, 0x0000, 0x2e82, 0x0b8e, 0x459c, 0x065e, 0x3126, 0x3b44,
+	    0x4544, 0x038f, 0x30c1, 0x408d, 0x0d48, 0x0000, 0x3c10, 0x0000,
+	    0x0e36, 0x3553, 0x40c5, 0x0000, 0x4107, 0x36b0, 0x1723, 0x28de,
+	    0x1d3d, 0x2249, 0x3fb0, 0x0fdc, 0x4c83, 0x2334, 0x1f35, 0x0000,
+	    0x0000, 0x2ebb, 0x3b74, 0x0000, 0x2f57, 0x12a8, 0x373f, 0x0000,
+	    0x4599, 0x3774, 0x1967, 0x39e6, 0x1c18, 0x098b, 0x1652, 0x4121,
+	    0x3c1c, 0x3065, 0x26d2, 0x02d7, 0x3fb8, 0x4b55, 0x00bc, 0x2f5e,
+	    0x0000, 0x1c6b, 0x0a15, 0x24c9, 0x2d04, 0x04a1, 0x0000, 0x3ec0,
+	    0x21df, 0x15f6, 0x0b28, 0x4de6, 0x343b, 0x2a6d, 0x0000, 0x15c4,
+	    0x0000, 0x2101, 0x0000, 0x23bf, 0x2e5f, 0x0efb, 0x02cb, 0x4005,
+	    0x161d, 0x19ce, 0x00ea, 0x37a0, 0x084a, 0x08b1, 0x1c01, 0x2ac9,
+	    0x23c4, 0x1d97, 0x0263, 0x3ecd, 0x43a5, 0x1948, 0x26a2, 0x0000,
+	    0x1350, 0x0240, 0x44ca, 0x4a6f, 0x2365, 0x4655, 0x0000, 0x3beb,
+	    0x0816, 0x0000, 0x0f7a, 0x37f3, 0x1a3c, 0x27a1, 0x0385, 0x422f,
+	    0x3a59, 0x0000, 0x3a2e, 0x4774, 0x30c3, 0x373d, 0x0000, 0x0000,
+	    0x3f8a, 0x1f4c, 0x2553, 0x3340, 0x0ed8, 0x1ef4, 0x0000, 0x0c5e,
+	    0x0781, 0x19de, 0x0c70, 0x4b5e, 0x1f75, 0x3d40, 0x0f66, 0x1232,
+	    0x4112, 0x40ad, 0x2c0a, 0x3632, 0x0fe6, 0x0000, 0x0baa, 0x1a6f,
+	    0x0000, 0x16a5, 0x0084, 0x3cde, 0x3947, 0x05f4, 0x44f2, 0x15b6,
+	    0x0000, 0x0095, 0x48eb, 0x2ebf, 0x1df3, 0x4c8f, 0x0c22, 0x0000,
+	    0x0000, 0x4291, 0x4976, 0x2adb, 0x0000, 0x4ae9, 0x2a23, 0x322f,
+	    0x036b, 0x3dc8, 0x26eb, 0x3852, 0x1552, 0x1de8, 0x1670, 0x4763,
+	    0x2941, 0x0434, 0x0000, 0x0000, 0x2fb3, 0x02da, 0x27ae, 0x0000,
+	    0x3ab9, 0x1651, 0x47e6, 0x0000, 0x44bb, 0x3df9, 0x4255, 0x46ba,
+	    0x4ca1, 0x4d2f, 0x0000, 0x201c, 0x3b59, 0x4277, 0x2487, 0x3215,
+	    0x0000, 0x3528, 0x1926, 0x4cb8, 0x046a, 0x391e, 0x340b, 0x226f,
+	    0x0c41, 0x3491, 0x049a, 0x4bbe, 0x27de, 0x4096, 0x15f1, 0x3d20,
+	    0x17f1, 0x2071, 0x359f, 0x0ec1, 0x0000, 0x0000, 0x4120, 0x3315,
+	    0x32d2, 0x3cd5, 0x040a, 0x0000, 0x279d, 0x00e6, 0x0000, 0x26ad,
+	    0x2d6a, 0x0000, 0x3a13, 0x0000, 0x0a12, 0x269d, 0x368c, 0x2d1d,
+	    0x0000, 0x1ac3, 0x38be, 0x0000, 0x2146, 0x4a2a, 0x259f, 0x0000,
+	    0x2f3d, 0x30f4, 0x4083, 0x122a, 0x2e84, 0x0000, 0x19d5, 0x1fd7,
+	    0x0000, 0x26c1, 0x0000, 0x38ee, 0x0248, 0x3b35, 0x20f3, 0x0000,
+	    0x1faf, 0x2b9c, 0x3323, 0x40a0, 0x2e06, 0x0000, 0x0968, 0x16a5,
+	    0x4d7e, 0x2d59, 0x265f, 0x0000, 0x0a53, 0x2afd, 0x1406, 0x02cc,
+	    0x088f, 0x374b, 0x05e8, 0x0386, 0x2224, 0x0000, 0x1c82, 0x2133,
+	    0x20ae, 0x4a35, 0x0000, 0x25ab, 0x1f12, 0x3075, 0x3706, 0x0000,
+	    0x49c3, 0x1f08, 0x2f56, 0x2c78, 0x134f, 0x270d, 0x106c, 0x3cae,
+	    0x41c9, 0x0000, 0x0ca4, 0x47b2, 0x0000, 0x1992, 0x3d66, 0x032e,
+	    0x26b7, 0x0000, 0x4084, 0x0000, 0x3fb7, 0x0000, 0x4b8d, 0x1b0e,
+	    0x383d, 0x2a4d, 0x1081, 0x00e8, 0x3e19, 0x0000, 0x14d0, 0x0b90,
+	    0x0ccb, 0x0000, 0x0b1d, 0x0000, 0x4cf3, 0x0000, 0x26a3, 0x2ccb,
+	    0x1a40, 0x10b1, 0x0000, 0x25df, 0x323f, 0x3f6d, 0x3551, 0x1170,
+	    0x1670, 0x21e6, 0x0000, 0x2591, 0x0a1a, 0x1f5d, 0x043d, 0x0000,
+	    0x2c01, 0x0f1a, 0x2729, 0x0ad7, 0x2a96, 0x19dc, 0x05b4, 0x4228,
+	    0x456e, 0x4cb4, 0x4b58, 0x1dc6, 0x36e6, 0x2013, 0x2217, 0x31ea,
+	    0x3810, 0x4d00, 0x1969, 0x46f2, 0x4655, 0x31b4, 0x0487, 0x4459,
+	    0x289b, 0x0000, 0x0d93, 0x21a5, 0x0000, 0x3c30, 0x02ea, 0x31d8,
+	    0x0538, 0x0a15, 0x279d, 0x1449, 0x227c, 0x086e, 0x2999, 0x477e,
+	    0x13aa, 0x082d, 0x4306, 0x0540, 0x0000, 0x462d, 0x0721, 0x42bf,
+	    0x171a, 0x2733, 0x45e3, 0x2b9e, 0x4cc5, 0x007d, 0x3f13, 0x049e,
+	    0x0d92, 0x2a74, 0x0000, 0x0000, 0x22e9, 0x2ed8, 0x3510, 0x1170,
+	    0x3f03, 0x2c54, 0x3f09, 0x0000, 0x2963, 0x22ad, 0x06e4, 0x0000,
+	    0x3212, 0x3ab7, 0x3343, 0x2921, 0x434b, 0x4427, 0x2a11, 0x0000,
+	    0x0d5b, 0x4a60, 0x0000, 0x0366, 0x0000, 0x1c26, 0x1302, 0x0511,
+	    0x0000, 0x0000, 0x288b, 0x0000, 0x13f5, 0x4c07, 0x374c, 0x050f,
+	    0x1fec, 0x211f, 0x0000, 0x4753, 0x3045, 0x0000, 0x3cdd, 0x256a,
+	    0x0000, 0x3a16, 0x0c8c, 0x0000, 0x4265, 0x1e26, 0x2836, 0x3671,
+	    0x1361, 0x4515, 0x40f1, 0x25f1, 0x270d, 0x0000, 0x0000, 0x1eea,
+	    0x48ee, 0x065e, 0x14bf, 0x0000, 0x3935, 0x0ae6, 0x43df, 0x1bda,
+	    0x0e8e, 0x0000, 0x4be5, 0x447c, 0x0283, 0x0776, 0x31b4, 0x376d,
+	    0x0000, 0x2ec6, 0x3c27, 0x32a0, 0x4b5d, 0x3dd9, 0x0822, 0x221a,
+	    0x4b29, 0x328e, 0x1d53, 0x436f, 0x122a, 0x1d87, 0x0000, 0x20ab,
+	    0x3df3, 0x1e1a, 0x0000, 0x0000, 0x01ae, 0x2dab, 0x222a, 0x1559,
+	    0x4779, 0x0000, 0x19fb, 0x241b, 0x368e, 0x49e4, 0x09a8, 0x3c88,
+	    0x0000, 0x0000, 0x47f3, 0x0e7c, 0x33f7, 0x1b26, 0x2121, 0x4d49,
+	    0x1240, 0x2ffc, 0x459a, 0x43ff, 0x2974, 0x468b, 0x39b8, 0x0000,
+	    0x0850, 0x2631, 0x48b7, 0x0b9b, 0x0a6e, 0x0a3a, 0x4aca, 0x2907,
+	    0x26b1, 0x29a2, 0x1604, 0x083f, 0x0d5b, 0x0000, 0x3537, 0x1d38,
+	    0x16fd, 0x44f4, 0x3f4c, 0x0bc7, 0x1681, 0x0000, 0x4d0b, 0x0000,
+	    0x2136, 0x0000, 0x3f12, 0x3327, 0x251f, 0x39b8, 0x0729, 0x0000,
+	    0x39c5, 0x1dae, 0x499c, 0x379b, 0x3c31, 0x07d2, 0x0000, 0x1fdc,
+	    0x1f4d, 0x3ba9, 0x1a07, 0x0000, 0x33f0, 0x298a, 0x1bf2, 0x022a,
+	    0x27bc, 0x3127, 0x0000, 0x3941, 0x0000, 0x3147, 0x4ad8, 0x40aa,
+	    0x0000, 0x4474, 0x2bcf, 0x293e, 0x20d1, 0x3648, 0x0000, 0x0b35,
+	    0x3da4, 0x0000, 0x25ee, 0x25fa, 0x0000, 0x0710, 0x0f70, 0x26cc,
+	    0x16fc, 0x0000, 0x0c82, 0x4b60, 0x0197, 0x0000, 0x0ed9, 0x0000,
+	    0x0000, 0x1b61, 0x4cbe, 0x0202, 0x0000, 0x47bd, 0x2082, 0x1e84,
+	    0x2370, 0x0000, 0x0abf, 0x2a86, 0x3dcb, 0x0000, 0x0000, 0x42e7,
+	    0x0d79, 0x0984, 0x4dce, 0x30df, 0x0000, 0x2b1d, 0x2394, 0x0823,
+	    0x3617, 0x41ae, 0x46de, 0x0ffb, 0x359d, 0x394d, 0x46d7, 0x475d,
+	    0x3e8f, 0x1c51, 0x29f6, 0x341b, 0x0000, 0x44ea, 0x0bd1, 0x0000,
+	    0x0c44, 0x0000, 0x1933, 0x12e1, 0x0000, 0x3b7a, 0x0e70, 0x0000,
+	    0x0000, 0x49e1, 0x280e, 0x2f59, 0x0000, 0x0000, 0x40e2, 0x254d,
+	    0x255d, 0x2bfd, 0x0016, 0x0000, 0x0b71, 0x33ba, 0x0c6f, 0x0000,
+	    0x0000, 0x2432, 0x0000, 0x1bc1, 0x0000, 0x2e99, 0x0000, 0x0000,
+	    0x2ec3, 0x0000, 0x37e5, 0x015d, 0x06f0, 0x0000, 0x29a3, 0x27df,
+	    0x3c9b, 0x0000, 0x0e63, 0x18ff, 0x067d, 0x0557, 0x42c3, 0x0000,
+	    0x3a25, 0x0000, 0x3bc0, 0x0611, 0x02a9, 0x18c1, 0x04fa, 0x3db9,
+	    0x38b5, 0x4b31, 0x3760, 0x3a2f, 0x0000, 0x3e68, 0x2e5a, 0x4c74,
+	    0x4dc6, 0x15ba, 0x365a, 0x29a9, 0x1a09, 0x20a3, 0x0e1a, 0x0000,
+	    0x40d0, 0x107e, 0x4938, 0x0000, 0x220a, 0x3213, 0x4061, 0x455a,
+	    0x2bd4, 0x36ce, 0x0a11, 0x4735, 0x1e92, 0x0096, 0x088e, 0x19b6,
+	    0x2160, 0x14d5, 0x0000, 0x004a, 0x3e3a, 0x1f4d, 0x190f, 0x1057,
+	    0x0000, 0x1c24, 0x32d0, 0x1a12, 0x13d7, 0x09e3, 0x3a1a, 0x2494,
+	    0x084b, 0x0000, 0x307e, 0x305d, 0x12cb, 0x1314, 0x36c5, 0x23a9,
+	    0x1d17, 0x072b, 0x384f, 0x2f51, 0x41d5, 0x0000, 0x00b4, 0x4872,
+	    0x38e3, 0x1d7c, 0x2147, 0x1095, 0x3505, 0x2235, 0x1c21, 0x249e,
+	    0x3568, 0x0000, 0x35df, 0x340a, 0x33f0, 0x2a22, 0x3dfb, 0x3382,
+	    0x0947, 0x0000, 0x409c, 0x0a9f, 0x017f, 0x3be9, 0x1ef9, 0x393d,
+	    0x3232, 0x3aaa, 0x01ae, 0x1c28, 0x47d1, 0x2257, 0x037f, 0x0000,
+	    0x3670, 0x1778, 0x2f77, 0x4c6b, 0x082a, 0x1721, 0x0000, 0x4dbe,
+	    0x27f8, 0x1de4, 0x4b01, 0x0c4e, 0x0000, 0x03c6, 0x0000, 0x2f32,
+	    0x2c21, 0x0000, 0x0000, 0x30ac, 0x2620, 0x3790, 0x2379, 0x16f3,
+	    0x0085, 0x1415, 0x0440, 0x00ee, 0x281c, 0x335f, 0x152e, 0x2bb1,
+	    0x3309, 0x4c4a, 0x25c9, 0x3c53, 0x0000, 0x18b0, 0x0000, 0x0000,
+	    0x3e49, 0x3598, 0x226c, 0x46ec, 0x0b29, 0x2f6a, 0x0000, 0x06e8,
+	    0x3551, 0x2183, 0x0000, 0x1a41, 0x014d, 0x1f93, 0x400f, 0x0655,
+	    0x3d34, 0x048f, 0x34e0, 0x122a, 0x2f41, 0x2ba4, 0x3d3d, 0x0000,
+	    0x0e07, 0x0000, 0x4d4c, 0x1ded, 0x1b92, 0x3d0d, 0x3156, 0x0e20,
+	    0x187e, 0x376b, 0x3dad, 0x0000, 0x23a6, 0x3373, 0x333a, 0x2fe8,
+	    0x2a19, 0x3934, 0x0000, 0x454f, 0x24ba, 0x0000, 0x3c56, 0x396c,
+	    0x0cb6, 0x0af4, 0x2e85, 0x4729, 0x27f2, 0x2fe2, 0x4ab7, 0x27c1,
+	    0x0000, 0x3247, 0x1371, 0x495d, 0x4622, 0x0000, 0x2285, 0x0352,
+	    0x1315, 0x0471, 0x2dcf, 0x1793, 0x12ab, 0x4ab7, 0x1a4b, 0x0888,
+	    0x0000, 0x4678, 0x06e9, 0x32a0, 0x0000, 0x31aa, 0x4955, 0x347e,
+	    0x0000, 0x3e01, 0x4601, 0x1e9d, 0x28b1, 0x2643, 0x0000, 0x2cb1,
+	    0x3058, 0x0f50, 0x053d, 0x39de, 0x1e79, 0x45d3, 0x0000, 0x4b8f,
+	    0x0000, 0x31f6, 0x0000, 0x1dad, 0x435b, 0x3063, 0x0c64, 0x0000,
+	    0x0000, 0x0000, 0x449a, 0x0067, 0x3a85, 0x3ddc, 0x0dc4, 0x2405,
+	    0x0000, 0x0000, 0x0000, 0x260a, 0x1a23, 0x2c31, 0x32fd, 0x3386,
+	    0x0f78, 0x2747, 0x0000, 0x4759, 0x0000, 0x0000, 0x070a, 0x2352,
+	    0x3aaa, 0x3e38, 0x0000, 0x1114, 0x248d, 0x105b, 0x0000, 0x0000,
+	    0x3c03, 0x03b1, 0x266d, 0x014c, 0x0956, 0x17ff, 0x0000, 0x384d,
+	    0x4d81, 0x0000, 0x017a, 0x1d2c, 0x21d4, 0x4430, 0x3778, 0x0688,
+	    0x0000, 0x018c, 0x2529, 0x228d, 0x10f5, 0x4c5e, 0x46f5, 0x3927,
+	    0x0000, 0x242d, 0x0000, 0x498c, 0x4a2a, 0x36f1, 0x1247, 0x3782,
+	    0x4c4b, 0x01b0, 0x1057, 0x0000, 0x3ce8, 0x3d53, 0x3eb2, 0x0000,
+	    0x0000, 0x4d0e, 0x4619, 0x2a66, 0x0000, 0x16b9, 0x0000, 0x2115,
+	    0x0a09, 0x0667, 0x43ed, 0x04fc, 0x0996, 0x264a, 0x2ac2, 0x45f8,
+	    0x340d, 0x3cf1, 0x0d8e, 0x40cf, 0x1e40, 0x294a, 0x08b9, 0x1b96,
+	    0x4c71, 0x2c11, 0x134c, 0x3989, 0x30c6, 0x0000, 0x2612, 0x0ef8,
+	    0x0017, 0x0000, 0x2a77, 0x36db, 0x1f19, 0x3d2d, 0x1849, 0x233e,
+	    0x0000, 0x3cee, 0x0000, 0x31ea, 0x1978, 0x103f, 0x0000, 0x0000,
+	    0x1de9, 0x0b27, 0x17d7, 0x0000, 0x0000, 0x320a, 0x23d0, 0x0000,
+	    0x0000, 0x0ddf, 0x0000, 0x16e2, 0x1bf2, 0x0000, 0x0000, 0x4076,
+	    0x346d, 0x0000, 0x30c9, 0x0000, 0x29fe, 0x1083, 0x12c0, 0x0f8a,
+	    0x0d6b, 0x1a5a, 0x21a4, 0x0000, 0x097a, 0x0a55, 0x12aa, 0x04b2,
+	    0x0000, 0x0000, 0x1f85, 0x0000, 0x3d0f, 0x3861, 0x0ba2, 0x3067,
+	    0x1221, 0x1869, 0x0ac3, 0x3d02, 0x2b6d, 0x47c5, 0x20a6, 0x49cb,
+	    0x47e6, 0x28f2, 0x0000, 0x3f8f, 0x0813, 0x416e, 0x450b, 0x2a2c,
+	    0x2353, 0x3514, 0x0aac, 0x4103, 0x0000, 0x0db2, 0x09fa, 0x3351,
+	    0x12c1, 0x1c56, 0x1acb, 0x0c43, 0x3c7f, 0x334b, 0x1ba2, 0x3aaa,
+	    0x12d8, 0x39a9, 0x0202, 0x0000, 0x0000, 0x28b4, 0x3389, 0x03c8,
+	    0x0000, 0x25e4, 0x02c4, 0x0000, 0x3e6e, 0x4cf6, 0x472d, 0x46c3,
+	    0x2500, 0x3079, 0x316e, 0x0088, 0x3484, 0x00fe, 0x047e, 0x1488,
+	    0x075b, 0x1e31, 0x45c0, 0x1d1e, 0x0000, 0x1df7, 0x2a64, 0x03fe,
+	    0x3286, 0x2369, 0x1e32, 0x0000, 0x4a00, 0x1160, 0x21ea, 0x171c,
+	    0x0393, 0x41b8, 0x0000, 0x4ad9, 0x23f5, 0x096d, 0x1dfd, 0x0000,
+	    0x1d4a, 0x0000, 0x2bcd, 0x0745, 0x119a, 0x2946, 0x087f, 0x4426,
+	    0x05dd, 0x0e37, 0x0000, 0x2d99, 0x1593, 0x2af9, 0x0000, 0x0a8a,
+	    0x0d00, 0x4820, 0x0000, 0x1dc8, 0x0000, 0x10b5, 0x37bd, 0x35e7,
+	    0x3c3a, 0x0050, 0x1855, 0x3efe, 0x4504, 0x0000, 0x35ec, 0x3c2b,
+	    0x30e9, 0x32da, 0x0000, 0x1106, 0x0000, 0x3da9, 0x0000, 0x3603,
+	    0x0000, 0x0ca2, 0x227d, 0x20fb, 0x1049, 0x0000, 0x3bda, 0x3352,
+	    0x3093, 0x3c83, 0x4285, 0x200a, 0x48ae, 0x106e, 0x0114, 0x1321,
+	    0x4d39, 0x1716, 0x2432, 0x1dc8, 0x12d0, 0x0a0e, 0x4af7, 0x0000,
+	    0x4aac, 0x3fce, 0x1c88, 0x3496, 0x3db3, 0x17bc, 0x4ac2, 0x0000,
+	    0x1ad5, 0x3d28, 0x0000, 0x0a34, 0x0000, 0x3c5d, 0x46d4, 0x30c1,
+	    0x0724, 0x477b, 0x0d67, 0x0000, 0x051e, 0x2211, 0x2e51, 0x1847,
+	    0x26e2, 0x0000, 0x1963, 0x1fce, 0x0000, 0x4bdb, 0x162e, 0x2f6d,
+	    0x44a3, 0x2d0b, 0x0295, 0x0c36, 0x35e4, 0x0296, 0x0da4, 0x0000,
+	    0x3bd6, 0x17d3, 0x0000, 0x2347, 0x0bb7, 0x0d63, 0x0000, 0x35b2,
+	    0x2b78, 0x17f8, 0x3d34, 0x168c, 0x056a, 0x3a03, 0x046e, 0x472c,
+	    0x1a43, 0x333c, 0x0000, 0x01b5, 0x4057, 0x3fb4, 0x23b3, 0x0cd5,
+	    0x3ae2, 0x2494, 0x0c7b, 0x4890, 0x4622, 0x3cc6, 0x16a9, 0x0000,
+	    0x0000, 0x187b, 0x0000, 0x3057, 0x0808, 0x00ce, 0x3593, 0x0567,
+	    0x0000, 0x0000, 0x233d, 0x01e7, 0x2c53, 0x2a9c, 0x0000, 0x0df2,
+	    0x40d7, 0x401c, 0x2d7c, 0x30bc, 0x4831, 0x0a5a, 0x14c3, 0x0000,
+	    0x179e, 0x34e2, 0x1ba3, 0x060c, 0x3484, 0x4caa, 0x1c6b, 0x4161,
+	    0x390a, 0x0a88, 0x3815, 0x456d, 0x0000, 0x1a89, 0x37f1, 0x0000,
+	    0x3289, 0x1d83, 0x4bab, 0x035b, 0x3a3f, 0x3434, 0x0000, 0x4455,
+	    0x20a6, 0x44fc, 0x3380, 0x1a86, 0x1d26, 0x2fdf, 0x0c29, 0x4248,
+	    0x1269, 0x22c1, 0x30bd, 0x365f, 0x1f3d, 0x2e4a, 0x2196, 0x0cb3,
+	    0x110a, 0x2c61, 0x0000, 0x0344, 0x333d, 0x0000, 0x0000, 0x4a85,
+	    0x1195, 0x4307, 0x2e0a, 0x4996, 0x42d9, 0x20c7, 0x21a5, 0x0000,
+	    0x0e4b, 0x16af, 0x200b, 0x48e9, 0x2e25, 0x08d3, 0x3b28, 0x2c08,
+	    0x37b0, 0x3611, 0x0000, 0x2d80, 0x2176, 0x2cc5, 0x3965, 0x2a69,
+	    0x3d26, 0x0000, 0x2593, 0x3229, 0x376c, 0x3a91, 0x0000, 0x0000,
+	    0x14dd, 0x4982, 0x3b6b, 0x2ee4, 0x050a, 0x0fb4, 0x31d1, 0x0000,
+	    0x03d4, 0x4466, 0x065c, 0x2516, 0x0aeb, 0x32de, 0x0a90, 0x0000,
+	    0x4055, 0x4814, 0x3869, 0x0c82, 0x41ef, 0x2bf4, 0x3b1c, 0x36b9,
+	    0x0000, 0x1a92, 0x32b1, 0x039f, 0x4d4d, 0x206d, 0x4d5c, 0x0000,
+	    0x0104, 0x41df, 0x3192, 0x39d8, 0x2e3e, 0x3de2, 0x343d, 0x1b94,
+	    0x1efc, 0x36d4, 0x19cd, 0x33c1, 0x02b5, 0x0ce0, 0x0000, 0x0000,
+	    0x2090, 0x2172, 0x3ed9, 0x3a3f, 0x3b76, 0x05c6, 0x3009, 0x1755,
+	    0x37cf, 0x2143, 0x0165, 0x125e, 0x13d2, 0x0e79, 0x0000, 0x0dc9,
+	    0x20ad, 0x1a51, 0x0219, 0x19a8, 0x0000, 0x4807, 0x4e00, 0x3d86,
+	    0x17f1, 0x0230, 0x3e04, 0x38e3, 0x41a8, 0x042d, 0x4707, 0x3bde,
+	    0x39a6, 0x0000, 0x3941, 0x4cec, 0x2f75, 0x175f, 0x4453, 0x41b9,
+	    0x248c, 0x2461, 0x2178, 0x1788, 0x0000, 0x161c, 0x1aa6, 0x22ec,
+	    0x04bc, 0x216f, 0x2917, 0x1742, 0x0350, 0x0d69, 0x0000, 0x3606,
+	    0x0000, 0x3e98, 0x4595, 0x1630, 0x0422, 0x3f88, 0x0d4e, 0x3d43,
+	    0x32f0, 0x343e, 0x1814, 0x218c, 0x0000, 0x273f, 0x086a, 0x00f0,
+	    0x0000, 0x3876, 0x1f94, 0x13bb, 0x2b1d, 0x1709, 0x1157, 0x11cb,
+	    0x3ab1, 0x1a58, 0x2131, 0x2b26, 0x0a0c, 0x1aac, 0x39a7, 0x0d56,
+	    0x0000, 0x0000, 0x0000, 0x36c5, 0x0000, 0x2f94, 0x2a63, 0x0000,
+	    0x3c1f, 0x2539, 0x23cd, 0x2fc0, 0x1407, 0x1c03, 0x2aab, 0x46e9,
+	    0x2fe1, 0x0000, 0x405b, 0x49e1, 0x32b4, 0x4187, 0x1832, 0x1358,
+	    0x15fe, 0x309f, 0x0000, 0x44df, 0x0d62, 0x0000, 0x1e65, 0x1854,
+	    0x00fb, 0x31f1, 0x2f01, 0x1172, 0x0000, 0x2d45, 0x0000, 0x2d7b,
+	    0x3be9, 0x2738, 0x2de6, 0x3d45, 0x1a13, 0x32c0, 0x3628, 0x08d9,
+	    0x16f6, 0x0275, 0x1eba, 0x44f7, 0x3b55, 0x4420, 0x00dc, 0x0a67,
+	    0x157c, 0x2110, 0x0000, 0x33a6, 0x0440, 0x2df3, 0x0000, 0x0000,
+	    0x33d4, 0x1394, 0x02de, 0x0ca2, 0x0000, 0x28f1, 0x4749, 0x3dc6,
+	    0x1c77, 0x362a, 0x2d31, 0x20e1, 0x268d, 0x0515, 0x0000, 0x42c2,
+	    0x36fe, 0x0000, 0x4cad, 0x38e4, 0x3694, 0x0000, 0x39ee, 0x0000,
+	    0x2795, 0x0000, 0x0000, 0x0246, 0x0d35, 0x4373, 0x162c, 0x0092,
+	    0x3670, 0x0d7c, 0x1824, 0x36f0, 0x1f38, 0x4cad, 0x2c36, 0x0000,
+	    0x0000, 0x14f3, 0x0578, 0x14a8, 0x1ff9, 0x29dd, 0x4ddc, 0x1f7d,
+	    0x0d1f, 0x1d1b, 0x47c3, 0x4ada, 0x4aaa, 0x0000, 0x0000, 0x0d1d,
+	    0x13dc, 0x0000, 0x0000, 0x31f7, 0x0000, 0x0000, 0x42e8, 0x0fba,
+	    0x0da0, 0x3550, 0x4069, 0x1612, 0x0000, 0x4a3e, 0x4a33, 0x437c,
+	    0x2fa1, 0x0742, 0x0f7d, 0x390d, 0x2309, 0x02bf, 0x20bb, 0x2101,
+	    0x0937, 0x0000, 0x3d91, 0x0000, 0x3a3e, 0x3629, 0x1290, 0x4a24,
+	    0x3f00, 0x3b70, 0x2657, 0x0000, 0x0025, 0x0000, 0x20cb, 0x2d2c,
+	    0x14b2, 0x3534, 0x3916, 0x1501, 0x2d1b, 0x022c, 0x3be8, 0x4216,
+	    0x10c1, 0x349b, 0x052c, 0x47ca, 0x23b2, 0x4938, 0x039e, 0x3490,
+	    0x055a, 0x13f7, 0x02e4, 0x450a, 0x020b, 0x2308, 0x1c4b, 0x1cf8,
+	    0x1bff, 0x2fab, 0x218c, 0x1a68, 0x1f6d, 0x0000, 0x3947, 0x2277,
+	    0x149e, 0x2b56, 0x0b43, 0x038e, 0x12a1, 0x39c2, 0x28f5, 0x008c,
+	    0x3145, 0x31df, 0x0000, 0x011d, 0x4dc0, 0x30e9, 0x0000, 0x2524,
+	    0x0585, 0x0e0c, 0x2513, 0x0000, 0x00cd, 0x3eb8, 0x407e, 0x462d,
+	    0x4395, 0x457c, 0x04db, 0x4697, 0x3034, 0x0000, 0x01df, 0x1801,
+	    0x4b58, 0x1c34, 0x144f, 0x222d, 0x0000, 0x4974, 0x1c16, 0x2c31,
+	    0x34cf, 0x2035, 0x2769, 0x0000, 0x0000, 0x4dc0, 0x09dd, 0x425c,
+	    0x2880, 0x44d8, 0x3a3d, 0x4390, 0x0000, 0x0000, 0x4b0b, 0x43dd,
+	    0x0baa, 0x2243, 0x16ca, 0x08ae, 0x0000, 0x0000, 0x32d9, 0x04ed,
+	    0x4003, 0x094f, 0x0165, 0x2635, 0x392e, 0x3564, 0x02ee, 0x0332,
+	    0x0000, 0x4784, 0x17a4, 0x3c1c, 0x3245, 0x13cb, 0x457c, 0x188e,
+	    0x09a0, 0x20d4, 0x11bc, 0x3400, 0x45ec, 0x3cf3, 0x307d, 0x40d5,
+	    0x0000, 0x0000, 0x2ee3, 0x0bc6, 0x0000, 0x0000, 0x4153, 0x184a,
+	    0x18d0, 0x1162, 0x31b0, 0x1231, 0x0000, 0x127a, 0x0000, 0x2ffd,
+	    0x26f4, 0x46f8, 0x0000, 0x1e96, 0x0532, 0x4be2, 0x2347, 0x0a40,
+	    0x324c, 0x47c9, 0x0d31, 0x0000, 0x0c1b, 0x4cb6, 0x0000, 0x0000,
+	    0x12b6, 0x0000, 0x4dae, 0x0c82, 0x0b04, 0x05fa, 0x453f, 0x319f,
+	    0x2196, 0x185d, 0x4d40, 0x029a, 0x1c1e, 0x428b, 0x41e8, 0x0df4,
+	    0x07ed, 0x4bab, 0x07a9, 0x2056, 0x0000, 0x3668, 0x153d, 0x1551,
+	    0x0074, 0x131c, 0x3c47, 0x100c, 0x44b7, 0x3b58, 0x479f, 0x2844,
+	    0x4a1d, 0x3616, 0x32ae, 0x2ecf, 0x3385, 0x2595, 0x1e54, 0x2b26,
+	    0x2c4d, 0x2943, 0x3a7b, 0x3d8c, 0x4d37, 0x43f7, 0x2d31, 0x0000,
+	    0x12f8, 0x0000, 0x32e9, 0x0000, 0x22a6, 0x4ba9, 0x3274, 0x2808,
+	    0x27f3, 0x02e3, 0x1af0, 0x0000, 0x3baa, 0x0000, 0x09b6, 0x0000,
+	    0x3ac0, 0x13da, 0x419f, 0x1517, 0x38c2, 0x22e7, 0x3759, 0x3e68,
+	    0x0938, 0x2ef3, 0x04a5, 0x3cd6, 0x4bb2, 0x230e, 0x316d, 0x30fe,
+	    0x2f9a, 0x3a9b, 0x1c2a, 0x4d27, 0x1726, 0x099e, 0x4399, 0x3bf5,
+	    0x01c6, 0x2761, 0x4743, 0x1f81, 0x0b80, 0x11f4, 0x0000, 0x452b,
+	    0x0fc6, 0x3ed2, 0x417e, 0x386f, 0x43c5, 0x4c53, 0x2a76, 0x405f,
+	    0x1cc8, 0x04d9, 0x0b47, 0x482b, 0x4a99, 0x1d3a, 0x4c15, 0x0000,
+	    0x460c, 0x0000, 0x2fea, 0x0f16, 0x0000, 0x4c27, 0x35b7, 0x3561,
+	    0x0000, 0x0000, 0x4952, 0x258a, 0x01fc, 0x45b8, 0x26bd, 0x3860,
+	    0x1ff6, 0x2c2b, 0x2d43, 0x29c3, 0x045b, 0x1537, 0x1b99, 0x46f6,
+	    0x02a3, 0x3ebf, 0x0000, 0x3301, 0x0000, 0x0667, 0x2d2a, 0x0000,
+	    0x0173, 0x3157, 0x0000, 0x3311, 0x475f, 0x0131, 0x1497, 0x339e,
+	    0x2420, 0x067a, 0x3ba6, 0x051c, 0x0b0e, 0x2798, 0x0ad4, 0x048a,
+	    0x1ddd, 0x27a7, 0x0577, 0x0ca2, 0x38e2, 0x0000, 0x0000, 0x4de5,
+	    0x0479, 0x4c1f, 0x06c8, 0x4888, 0x1e8e, 0x10f4, 0x371e, 0x386d,
+	    0x2e4f, 0x3cb8, 0x23cc, 0x1560, 0x0000, 0x3a4d, 0x2365, 0x0e01,
+	    0x0000, 0x38c7, 0x0b2e, 0x2e87, 0x2630, 0x0583, 0x23ed, 0x38a9,
+	    0x238f, 0x0dbe, 0x0000, 0x4d05, 0x0000, 0x4bea, 0x0565, 0x1a12,
+	    0x1da6, 0x39d1, 0x1944, 0x0635, 0x1c00, 0x4ddf, 0x0000, 0x18a9,
+	    0x0899, 0x0000, 0x23a9, 0x1977, 0x0156, 0x06c0, 0x240e, 0x0000,
+	    0x0e62, 0x13b0, 0x0b38, 0x2a68, 0x2550, 0x11e2, 0x4c4c, 0x449f,
+	    0x49bb, 0x2f9a, 0x35f0, 0x1f15, 0x091e, 0x0547, 0x05ed, 0x186f,
+	    0x431e, 0x494a, 0x140e, 0x4a01, 0x012d, 0x0823, 0x1fe6, 0x0000,
+	    0x17ea, 0x1127, 0x3215, 0x2f5e, 0x10e8, 0x26b8, 0x26ff, 0x0000,
+	    0x0000, 0x3fb0, 0x4988, 0x3dcb, 0x1a40, 0x09d1, 0x0c8c, 0x28e4,
+	    0x3135, 0x08cb, 0x3b98, 0x0000, 0x4473, 0x4552, 0x27f6, 0x45df,
+	    0x07cf, 0x0a7b, 0x0000, 0x0bf7, 0x1e29, 0x2f9f, 0x3a6d, 0x3bd5,
+	    0x1184, 0x4a25, 0x48f7, 0x145a, 0x41af, 0x123a, 0x4962, 0x0291,
+	    0x0000, 0x4c84, 0x1b47, 0x01a6, 0x0000, 0x056f, 0x4bf1, 0x1468,
+	    0x29b2, 0x0603, 0x28d2, 0x20a8, 0x245d, 0x0000, 0x0000, 0x3d64,
+	    0x0000, 0x347e, 0x1dbb, 0x1071, 0x0393, 0x153e, 0x309f, 0x41f3,
+	    0x07e1, 0x34cf, 0x4c0d, 0x3813, 0x222d, 0x2920, 0x3cb5, 0x0835,
+	    0x0652, 0x3feb, 0x11da, 0x175e, 0x0000, 0x0000, 0x1e34, 0x2ddc,
+	    0x3277, 0x44c3, 0x0000, 0x30d4, 0x3fcf, 0x0000, 0x0d0a, 0x4970,
+	    0x3435, 0x16c8, 0x2489, 0x2e35, 0x0000, 0x22cd, 0x1195, 0x1065,
+	    0x0de5, 0x2b40, 0x0000, 0x2e01, 0x4b65, 0x2bfd, 0x0e07, 0x0a8b,
+	    0x452c, 0x4240, 0x1b88, 0x489a, 0x3501, 0x0530, 0x14e3, 0x0baa,
+	    0x4a6f, 0x44ac, 0x0309, 0x226c, 0x1081, 0x13b0, 0x1eaf, 0x4b52,
+	    0x4cb0, 0x0000, 0x28a9, 0x2e9f, 0x195e, 0x2dbe, 0x06ed, 0x3195,
+	    0x0000, 0x4b5c, 0x0000, 0x07a2, 0x18fc, 0x47a5, 0x49b2, 0x4c21,
+	    0x0000, 0x0000, 0x2493, 0x000f, 0x1a63, 0x0000, 0x49c5, 0x388b,
+	    0x1c3b, 0x398f, 0x0000, 0x26ec, 0x0000, 0x0000, 0x0d16, 0x0000,
+	    0x3a26, 0x315e, 0x0000, 0x2ace, 0x0000, 0x1b61, 0x2d92, 0x23e2,
+	    0x46a8, 0x0000, 0x160a, 0x0000, 0x2bcf, 0x0e53, 0x0000, 0x28b2,
+	    0x01b8, 0x0000, 0x48b4, 0x0000, 0x3349, 0x01b8, 0x44f6, 0x099e,
+	    0x0000, 0x00d1, 0x04d2, 0x0c56, 0x34a3, 0x2151, 0x1af8, 0x0000,
+	    0x037c, 0x12fb, 0x4c06, 0x1ffe, 0x0000, 0x44c1, 0x078a, 0x3748,
+	    0x40a1, 0x0dfd, 0x0000, 0x3d85, 0x3654, 0x111a, 0x34e7, 0x4b9a,
+	    0x0998, 0x0000, 0x0000, 0x1a6a, 0x1581, 0x0000, 0x3256, 0x40ed,
+	    0x29e6, 0x3e3c, 0x11ef, 0x3ac7, 0x0078, 0x401d, 0x1ac3, 0x1cbb,
+	    0x0537, 0x31ce, 0x05cb, 0x2db7, 0x1033, 0x1bd8, 0x400c, 0x4914,
+	    0x2caa, 0x168e, 0x32a9, 0x2809, 0x0000, 0x0000, 0x28af, 0x4553,
+	    0x07f7, 0x2ca6, 0x0bc7, 0x0fa2, 0x0e96, 0x2501, 0x3a9a, 0x3a37,
+	    0x2c99, 0x1257, 0x1df5, 0x4b17, 0x0000, 0x33af, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x230c, 0x357a, 0x0000, 0x13d9, 0x0dd4, 0x2ef7,
+	    0x0e05, 0x4bf6, 0x1646, 0x4435, 0x311d, 0x4333, 0x1096, 0x2a68,
+	    0x0dce, 0x0309, 0x1cf7, 0x0000, 0x1661, 0x0000, 0x0000, 0x02cf,
+	    0x3401, 0x0b01, 0x0000, 0x18bf, 0x0000, 0x0d19, 0x0dd1, 0x0000,
+	    0x0000, 0x3df2, 0x4083, 0x0f45, 0x24e1, 0x0000, 0x1350, 0x1155,
+	    0x0d99, 0x1cec, 0x2868, 0x4c96, 0x4c44, 0x0000, 0x214f, 0x2778,
+	    0x1eaf, 0x378d, 0x2a15, 0x0000, 0x1a12, 0x128b, 0x0cb8, 0x38d6,
+	    0x4bf9, 0x0a37, 0x26bd, 0x3fc3, 0x2fbd, 0x387e, 0x1f67, 0x1639,
+	    0x0000, 0x26b7, 0x3298, 0x2e46, 0x1486, 0x2a3c, 0x2779, 0x130a,
+	    0x49f9, 0x4670, 0x0922, 0x4555, 0x32ce, 0x3744, 0x2630, 0x20b6,
+	    0x0000, 0x0201, 0x0eb5, 0x107c, 0x05c2, 0x110b, 0x0000, 0x20c9,
+	    0x0000, 0x0000, 0x1af9, 0x006b, 0x1e5c, 0x0000, 0x0000, 0x4496,
+	    0x46ac, 0x2d94, 0x443f, 0x1e01, 0x4541, 0x1f48, 0x30b5, 0x3e6c,
+	    0x47be, 0x3455, 0x0000, 0x1ecf, 0x3aa4, 0x064c, 0x3247, 0x0d46,
+	    0x4b26, 0x0000, 0x00ed, 0x0d7e, 0x0000, 0x08e8, 0x0eb6, 0x3658,
+	    0x0000, 0x0000, 0x0000, 0x211b, 0x04c9, 0x3c84, 0x4ca0, 0x2cb0,
+	    0x3cdd, 0x1da0, 0x1ac3, 0x1770, 0x269e, 0x1ec9, 0x0000, 0x05d8,
+	    0x0000, 0x4b77, 0x004e, 0x1a05, 0x0000, 0x0b06, 0x3413, 0x00d7,
+	    0x04de, 0x0e01, 0x3c8c, 0x4b61, 0x0b68, 0x0bad, 0x4232, 0x3805,
+	    0x1f2d, 0x2b55, 0x3ac2, 0x0cb5, 0x139b, 0x26f0, 0x156b, 0x3649,
+	    0x3c4e, 0x34ab, 0x4664, 0x44e5, 0x0000, 0x1249, 0x136f, 0x13f8,
+	    0x2bd4, 0x48a6, 0x08a4, 0x28ce, 0x1e02, 0x0082, 0x4a93, 0x143a,
+	    0x43c2, 0x14e3, 0x0000, 0x0000, 0x42c9, 0x2f52, 0x1208, 0x0358,
+	    0x1945, 0x4927, 0x4248, 0x0906, 0x36bf, 0x1383, 0x0000, 0x49b5,
+	    0x3394, 0x22e6, 0x2ff4, 0x3899, 0x0465, 0x4791, 0x2145, 0x0000,
+	    0x1a41, 0x3fc7, 0x0000, 0x2bfd, 0x0000, 0x3266, 0x3017, 0x3166,
+	    0x0000, 0x2c33, 0x094c, 0x1c9f, 0x0000, 0x3f13, 0x0a1a, 0x24ad,
+	    0x34aa, 0x0000, 0x166a, 0x0eaf, 0x2057, 0x22fa, 0x3bb2, 0x1e41,
+	    0x38ef, 0x3a79, 0x0000, 0x25c2, 0x3e9e, 0x1948, 0x03ff, 0x39e1,
+	    0x2e14, 0x46aa, 0x0000, 0x27c8, 0x403d, 0x0000, 0x3304, 0x0000,
+	    0x3bc7, 0x1ba9, 0x38a9, 0x3dc4, 0x2be9, 0x01a1, 0x07c2, 0x07d6,
+	    0x3f89, 0x4666, 0x2d23, 0x2dd5, 0x189e, 0x258d, 0x2237, 0x4727,
+	    0x3a81, 0x1b87, 0x3a28, 0x14a0, 0x335c, 0x09c7, 0x313f, 0x44d5,
+	    0x0091, 0x4d22, 0x10ce, 0x0000, 0x0000, 0x4d73, 0x469b, 0x0000,
+	    0x1fd3, 0x48fa, 0x049c, 0x4633, 0x3a42, 0x2c58, 0x4d8b, 0x45b6,
+	    0x114e, 0x0000, 0x1e1c, 0x4cd8, 0x0000, 0x186b, 0x0000, 0x1137,
+	    0x1b9b, 0x2bcf, 0x448c, 0x4b83, 0x2a09, 0x1764, 0x20ee, 0x3491,
+	    0x0000, 0x3d9c, 0x3355, 0x39e2, 0x0000, 0x0000, 0x37c3, 0x1b51,
+	    0x41f3, 0x26f6, 0x363b, 0x3822, 0x3303, 0x0000, 0x1313, 0x3144,
+	    0x0000, 0x083e, 0x0000, 0x0000, 0x0b64, 0x0000, 0x0ee9, 0x32c1,
+	    0x13b6, 0x0000, 0x130b, 0x0027, 0x44e2, 0x14c6, 0x2272, 0x393e,
+	    0x155b, 0x182a, 0x381e, 0x4c1d, 0x21ae, 0x0000, 0x0000, 0x0000,
+	    0x3d88, 0x2603, 0x0000, 0x0000, 0x0000, 0x0000, 0x13e7, 0x0000,
+	    0x2758, 0x227d, 0x2a16, 0x0000, 0x0000, 0x3d4a, 0x3e47, 0x2cf3,
+	    0x439c, 0x2caa, 0x0000, 0x2889, 0x0ec2, 0x0000, 0x2179, 0x3c40,
+	    0x0000, 0x32d1, 0x1402, 0x3217, 0x2377, 0x09c3, 0x1102, 0x45ca,
+	    0x0000, 0x0000, 0x0000, 0x36e6, 0x4de0, 0x3ba6, 0x0346, 0x3be5,
+	    0x3272, 0x2053, 0x05ae, 0x4238, 0x0796, 0x0000, 0x2dd5, 0x0000,
+	    0x2518, 0x0000, 0x3287, 0x3c25, 0x0349, 0x401f, 0x0394, 0x0000,
+	    0x16b5, 0x0000, 0x0000, 0x476b, 0x0000, 0x3757, 0x35fa, 0x1a75,
+	    0x275b, 0x0c63, 0x136b, 0x3668, 0x0884, 0x27c3, 0x0014, 0x43e8,
+	    0x4471, 0x0000, 0x0ca0, 0x0000, 0x0689, 0x35ff, 0x09bb, 0x0d38,
+	    0x4ada, 0x41fb, 0x088a, 0x0000, 0x3158, 0x090a, 0x3122, 0x3282,
+	    0x37aa, 0x0000, 0x0000, 0x0000, 0x2730, 0x0000, 0x01ee, 0x11da,
+	    0x158a, 0x194f, 0x29ca, 0x0719, 0x47fb, 0x0000, 0x0715, 0x0aac,
+	    0x2bb6, 0x4a83, 0x370a, 0x0000, 0x0000, 0x44bc, 0x2207, 0x3e39,
+	    0x4b29, 0x0000, 0x2ec1, 0x3588, 0x038c, 0x0000, 0x2f5f, 0x1deb,
+	    0x217b, 0x3b32, 0x12fb, 0x17fa, 0x37db, 0x3f2d, 0x1079, 0x3caa,
+	    0x184b, 0x155c, 0x23ba, 0x4c25, 0x316b, 0x0000, 0x1453, 0x33de,
+	    0x0518, 0x067c, 0x229d, 0x1b9d, 0x21f2, 0x0ca8, 0x3ed0, 0x2532,
+	    0x338c, 0x18a6, 0x405f, 0x0a65, 0x0c45, 0x0472, 0x0000, 0x4267,
+	    0x09e1, 0x2e14, 0x0000, 0x0000, 0x1d30, 0x3177, 0x297e, 0x4cca,
+	    0x1451, 0x0000, 0x47d1, 0x2f2a, 0x4ac7, 0x2749, 0x17f5, 0x18cc,
+	    0x07db, 0x39cd, 0x2b50, 0x353d, 0x1cc1, 0x2f5e, 0x41d1, 0x4cae,
+	    0x0000, 0x3a16, 0x2bfb, 0x3e44, 0x09ed, 0x0347, 0x0000, 0x2338,
+	    0x374b, 0x4535, 0x13cf, 0x1783, 0x394e, 0x3c67, 0x0000, 0x0057,
+	    0x0000, 0x0000, 0x0ecd, 0x1a53, 0x26e2, 0x2bd6, 0x2098, 0x17e2,
+	    0x0611, 0x301f, 0x06f3, 0x3380, 0x2ff4, 0x0408, 0x0dfe, 0x4718,
+	    0x168c, 0x0000, 0x0648, 0x0000, 0x3e7a, 0x3c30, 0x3868, 0x0000,
+	    0x3987, 0x1e73, 0x011c, 0x45e9, 0x1e99, 0x4207, 0x0000, 0x1fa2,
+	    0x287c, 0x1f27, 0x36e0, 0x0575, 0x1c2c, 0x40e1, 0x0000, 0x4d58,
+	    0x3aaa, 0x08c3, 0x12f0, 0x0332, 0x46bc, 0x0882, 0x0000, 0x050b,
+	    0x05ad, 0x1baf, 0x4a7a, 0x146c, 0x4d9d, 0x0255, 0x4a78, 0x0000,
+	    0x25bb, 0x0c6a, 0x0cc7, 0x1135, 0x3573, 0x185d, 0x3654, 0x0696,
+	    0x1447, 0x11b5, 0x0000, 0x3a02, 0x2dcd, 0x474a, 0x2564, 0x0000,
+	    0x0890, 0x1565, 0x1262, 0x28e4, 0x197c, 0x1c99, 0x35ea, 0x20b8,
+	    0x20a8, 0x3bc7, 0x2e90, 0x2e91, 0x2c69, 0x29b6, 0x0000, 0x223e,
+	    0x0181, 0x47c7, 0x2bd0, 0x2077, 0x4654, 0x22ac, 0x0000, 0x3afc,
+	    0x07e5, 0x4490, 0x161f, 0x0000, 0x0000, 0x2475, 0x22fb, 0x1328,
+	    0x190f, 0x0000, 0x24e4, 0x0000, 0x4c0d, 0x0000, 0x44d7, 0x0c84,
+	    0x1fc0, 0x0c6a, 0x2af3, 0x377a, 0x3b30, 0x0000, 0x3639, 0x0000,
+	    0x06f3, 0x04c5, 0x4b1d, 0x07a6, 0x0e4b, 0x4072, 0x142b, 0x41e5,
+	    0x1fb4, 0x0703, 0x45ab, 0x17dd, 0x22d0, 0x2b9a, 0x43b2, 0x0025,
+	    0x1553, 0x4a13, 0x3690, 0x2d34, 0x1de7, 0x2c13, 0x0191, 0x4948,
+	    0x0000, 0x4a82, 0x0000, 0x3234, 0x12eb, 0x40ea, 0x2b6c, 0x36bf,
+	    0x0213, 0x4682, 0x1d48, 0x0000, 0x2de5, 0x0f99, 0x0ca4, 0x256c,
+	    0x2e64, 0x0965, 0x0000, 0x34e9, 0x3230, 0x1e5b, 0x396d, 0x0000,
+	    0x1b58, 0x3935, 0x4241, 0x16f7, 0x1d5e, 0x3431, 0x0901, 0x0183,
+	    0x3f82, 0x3450, 0x1264, 0x3236, 0x0000, 0x1907, 0x0000, 0x1775,
+	    0x0000, 0x1f09, 0x1768, 0x0a84, 0x0000, 0x3eab, 0x1e05, 0x0867,
+	    0x1674, 0x0000, 0x3af2, 0x36bb, 0x15fe, 0x03f6, 0x3602, 0x2f81,
+	    0x17b0, 0x4505, 0x2400, 0x08ad, 0x2c47, 0x40c1, 0x4dda, 0x13f9,
+	    0x03e3, 0x2112, 0x2026, 0x0000, 0x4551, 0x4a7d, 0x0000, 0x0000,
+	    0x0000, 0x1294, 0x04ce, 0x4664, 0x2b36, 0x19f0, 0x4910, 0x12cb,
+	    0x01a2, 0x0a5e, 0x0000, 0x4748, 0x2503, 0x2e4f, 0x4e10, 0x0000,
+	    0x3b38, 0x22f1, 0x2c46, 0x0f94, 0x0649, 0x1a89, 0x428a, 0x1b54,
+	    0x3892, 0x2749, 0x0558, 0x0000, 0x0592, 0x0000, 0x36ef, 0x2a93,
+	    0x0000, 0x0a7c, 0x4302, 0x10bf, 0x33ac, 0x210d, 0x079f, 0x0000,
+	    0x2df8, 0x0000, 0x0138, 0x4b5c, 0x0507, 0x0a2f, 0x389d, 0x3050,
+	    0x1347, 0x0e1d, 0x3015, 0x10d8, 0x0738, 0x1138, 0x2271, 0x37bf,
+	    0x4b0e, 0x0000, 0x3035, 0x1f1e, 0x3038, 0x37c4, 0x0000, 0x1eee,
+	    0x29e6, 0x0e35, 0x0000, 0x4bcb, 0x37a1, 0x17af, 0x3587, 0x1d09,
+	    0x4203, 0x2747, 0x08ed, 0x2626, 0x1041, 0x14cc, 0x3ba6, 0x1477,
+	    0x4677, 0x491f, 0x17e3, 0x3901, 0x45f3, 0x4268, 0x04ca, 0x0000,
+	    0x1be0, 0x0000, 0x325c, 0x0499, 0x27d4, 0x1ee7, 0x3d80, 0x1295,
+	    0x0000, 0x356e, 0x0000, 0x07de, 0x2ced, 0x4d23, 0x3259, 0x392f,
+	    0x342c, 0x4db0, 0x000c, 0x1a18, 0x0000, 0x0000, 0x244d, 0x15e2,
+	    0x0000, 0x1414, 0x4739, 0x40c3, 0x4467, 0x2b7a, 0x1af3, 0x3423,
+	    0x0ec8, 0x0000, 0x2c15, 0x4038, 0x1afa, 0x0000, 0x45ce, 0x3f32,
+	    0x4222, 0x2bbd, 0x385f, 0x23e9, 0x287d, 0x4a50, 0x0000, 0x0b27,
+	    0x0000, 0x25af, 0x0000, 0x4086, 0x2284, 0x42e1, 0x0043, 0x0000,
+	    0x4401, 0x2110, 0x4960, 0x0958, 0x0000, 0x2edd, 0x4669, 0x3af8,
+	    0x0e84, 0x4ad7, 0x3a10, 0x01c4, 0x4ac0, 0x2e48, 0x4458, 0x02e5,
+	    0x0000, 0x0000, 0x33fc, 0x0ada, 0x406d, 0x39f9, 0x1c73, 0x0dd1,
+	    0x2c5c, 0x1cdb, 0x4c85, 0x4567, 0x320d, 0x4829, 0x32b7, 0x48d5,
+	    0x338f, 0x02f1, 0x253a, 0x2e91, 0x00fe, 0x225b, 0x136c, 0x16a9,
+	    0x0178, 0x3eb8, 0x0a95, 0x3da9, 0x368f, 0x49e0, 0x3847, 0x4276,
+	    0x1642, 0x1fd7, 0x06b1, 0x0000, 0x1c24, 0x4bc8, 0x1f16, 0x1a5a,
+	    0x4cf6, 0x09b2, 0x1337, 0x0df4, 0x3c24, 0x0a72, 0x0000, 0x24da,
+	    0x33a1, 0x46e5, 0x3e75, 0x0000, 0x384a, 0x0262, 0x10bf, 0x041a,
+	    0x2c1a, 0x0000, 0x1821, 0x2a37, 0x2c56, 0x0ee0, 0x2ff2, 0x1d92,
+	    0x2822, 0x0000, 0x46c1, 0x0117, 0x2595, 0x17b4, 0x0077, 0x32c5,
+	    0x3c33, 0x4546, 0x1ae6, 0x43dd, 0x37db, 0x43f2, 0x421f, 0x0b64,
+	    0x1027, 0x3f20, 0x282c, 0x2591, 0x2900, 0x0000, 0x1d66, 0x154e,
+	    0x0000, 0x0000, 0x4152, 0x0f3d, 0x1542, 0x217f, 0x0c4a, 0x3476,
+	    0x1604, 0x376d, 0x0dc5, 0x0024, 0x48da, 0x1ae8, 0x0000, 0x24c7,
+	    0x2028, 0x450d, 0x0909, 0x0000, 0x412c, 0x0c00, 0x450b, 0x1bde,
+	    0x3c03, 0x0000, 0x1b03, 0x111d, 0x0ed9, 0x0000, 0x3f61, 0x0d70,
+	    0x0b93, 0x212a, 0x151a, 0x1c0a, 0x0843, 0x3ba7, 0x02c6, 0x0150,
+	    0x0000, 0x4067, 0x20ac, 0x0efc, 0x26a6, 0x0111, 0x08b9, 0x2493,
+	    0x189a, 0x00fd, 0x0000, 0x0000, 0x0000, 0x19af, 0x4499, 0x1037,
+	    0x04e6, 0x08f8, 0x1105, 0x0aa5, 0x474c, 0x19d0, 0x0000, 0x0a64,
+	    0x1aed, 0x3a43, 0x0253, 0x3b89, 0x078b, 0x0000, 0x0000, 0x14b2,
+	    0x103b, 0x0000, 0x3ec6, 0x1998, 0x0000, 0x0875, 0x09be, 0x09c6,
+	    0x4532, 0x246b, 0x0000, 0x25f2, 0x3216, 0x3a7c, 0x1426, 0x0aa3,
+	    0x0000, 0x0f96, 0x28d2, 0x0000, 0x0000, 0x1440, 0x0000, 0x0560,
+	    0x264c, 0x3019, 0x3669, 0x41a4, 0x29ed, 0x0000, 0x3d49, 0x32e9,
+	    0x00df, 0x1968, 0x2d74, 0x09fe, 0x3488, 0x32e6, 0x0000, 0x3b9c,
+	    0x304a, 0x12f4, 0x147c, 0x097b, 0x202c, 0x39ae, 0x0000, 0x2034,
+	    0x4d50, 0x0000, 0x384e, 0x0000, 0x3e72, 0x43a8, 0x42c5, 0x0000,
+	    0x2391, 0x0cdf, 0x2520, 0x0b98, 0x0000, 0x0000, 0x0000, 0x2a1c,
+	    0x420f, 0x46bf, 0x21f5, 0x290f, 0x3e06, 0x30f1, 0x2f6d, 0x0f58,
+	    0x4d11, 0x29b7, 0x0be7, 0x1b3a, 0x365d, 0x0940, 0x0000, 0x0000,
+	    0x267e, 0x4618, 0x183a, 0x30b0, 0x0000, 0x0000, 0x34c5, 0x42c6,
+	    0x0da5, 0x2451, 0x16d3, 0x1d8a, 0x36c2, 0x002d, 0x4b4b, 0x3784,
+	    0x47a5, 0x0000, 0x0000, 0x2882, 0x2646, 0x22f3, 0x0000, 0x1d95,
+	    0x04a1, 0x4648, 0x1ddb, 0x0103, 0x1d8c, 0x2940, 0x2288, 0x2423,
+	    0x0000, 0x0deb, 0x4ce2, 0x34a9, 0x2f4e, 0x0000, 0x1e33, 0x1a73,
+	    0x0000, 0x0e62, 0x028d, 0x03e9, 0x0e11, 0x424c, 0x3db8, 0x3c80,
+	    0x0000, 0x11ff, 0x1519, 0x0000, 0x0355, 0x0000, 0x4dd7, 0x3cb8,
+	    0x37a2, 0x1028, 0x05d1, 0x2006, 0x2af4, 0x0000, 0x2fc3, 0x1813,
+	    0x471e, 0x0000, 0x0b0e, 0x0c2d, 0x1373, 0x467b, 0x32fa, 0x3010,
+	    0x4535, 0x0000, 0x26ee, 0x424e, 0x20b6, 0x17da, 0x1d4c, 0x251e,
+	    0x0000, 0x4cf9, 0x4bd2, 0x2bc7, 0x02a3, 0x0000, 0x1188, 0x0bc0,
+	    0x0000, 0x1538, 0x0b99, 0x41c3, 0x2a83, 0x1c73, 0x2854, 0x15fa,
+	    0x078e, 0x0000, 0x0f50, 0x3c9b, 0x1cbe, 0x04fe, 0x45b1, 0x21b3,
+	    0x3d7d, 0x0fc8, 0x117e, 0x0748, 0x1a08, 0x003d, 0x1067, 0x4c5a,
+	    0x0000, 0x1754, 0x1a6c, 0x2b24, 0x437e, 0x1f88, 0x193b, 0x1523,
+	    0x0000, 0x091f, 0x2abe, 0x4ba2, 0x0184, 0x1b51, 0x09f5, 0x28e5,
+	    0x3422, 0x0000, 0x1088, 0x1e29, 0x3009, 0x05af, 0x0f57, 0x3631,
+	    0x32fe, 0x1e2d, 0x03c3, 0x1edc, 0x0000, 0x2d01, 0x3283, 0x1337,
+	    0x350d, 0x156d, 0x166d, 0x0000, 0x2e6e, 0x0000, 0x145e, 0x119d,
+	    0x4231, 0x027c, 0x4ad4, 0x4339, 0x4d07, 0x04ff, 0x0820, 0x171c,
+	    0x214f, 0x0000, 0x0f5a, 0x3ba4, 0x2d85, 0x4dd7, 0x0000, 0x2d54,
+	    0x0dab, 0x2301, 0x383c, 0x3879, 0x2d6f, 0x042d, 0x2b4f, 0x2bd2,
+	    0x0000, 0x22ad, 0x2218, 0x2a58, 0x0000, 0x0000, 0x3abe, 0x4603,
+	    0x1563, 0x2580, 0x35b2, 0x30eb, 0x3d56, 0x0ac2, 0x3ed5, 0x0430,
+	    0x313d, 0x0000, 0x1d15, 0x474d, 0x1710, 0x3e46, 0x489a, 0x2040,
+	    0x39bb, 0x0000, 0x165b, 0x1e98, 0x13c8, 0x371f, 0x0000, 0x4371,
+	    0x0000, 0x333d, 0x1a48, 0x2867, 0x00d5, 0x4036, 0x27d9, 0x0000,
+	    0x42b0, 0x0000, 0x13bc, 0x2a2d, 0x1364, 0x2416, 0x308d, 0x06a6,
+	    0x15f6, 0x0263, 0x0000, 0x0000, 0x17ae, 0x2127, 0x326a, 0x1f8f,
+	    0x1def, 0x2057, 0x0f45, 0x0000, 0x0510, 0x4ada, 0x4010, 0x4d09,
+	    0x2fc9, 0x34db, 0x168c, 0x0000, 0x09f8, 0x2c70, 0x0000, 0x1e18,
+	    0x4cea, 0x4676, 0x0000, 0x2d7b, 0x450c, 0x27b1, 0x1a96, 0x32a8,
+	    0x0bd1, 0x0000, 0x0000, 0x4afc, 0x2d87, 0x18e4, 0x0c05, 0x4ae3,
+	    0x0000, 0x0f6a, 0x0000, 0x4ab9, 0x0b16, 0x2b78, 0x4d3e, 0x2691,
+	    0x0000, 0x0000, 0x3ab7, 0x4aa9, 0x0ba7, 0x4ae0, 0x13a6, 0x1af8,
+	    0x4c38, 0x205d, 0x02f6, 0x0455, 0x2554, 0x425d, 0x349f, 0x0000,
+	    0x0000, 0x0b0a, 0x0000, 0x316f, 0x0000, 0x1f61, 0x0000, 0x045c,
+	    0x0da5, 0x3185, 0x1362, 0x0000, 0x0f60, 0x3caf, 0x0000, 0x1f09,
+	    0x1bb5, 0x3719, 0x225d, 0x4876, 0x11b7, 0x0f0d, 0x317d, 0x41f7,
+	    0x2700, 0x424e, 0x0389, 0x3c26, 0x444c, 0x3f72, 0x05d5, 0x1c2b,
+	    0x00cd, 0x023c, 0x0000, 0x2657, 0x0000, 0x43f6, 0x3d51, 0x17d8,
+	    0x2b63, 0x2570, 0x41fa, 0x01fe, 0x0a4b, 0x3ce9, 0x37e5, 0x2186,
+	    0x374c, 0x387b, 0x0cfd, 0x0000, 0x0000, 0x218b, 0x0000, 0x2785,
+	    0x1323, 0x0542, 0x0cce, 0x0000, 0x4710, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x028c, 0x1e13, 0x0000, 0x2d23, 0x0c99, 0x0000, 0x413f,
+	    0x3148, 0x0f6e, 0x0b0e, 0x440f, 0x0000, 0x113d, 0x3ecf, 0x32ed,
+	    0x0000, 0x09ff, 0x0000, 0x0d33, 0x430c, 0x0000, 0x3274, 0x25ba,
+	    0x0a2c, 0x0000, 0x0000, 0x4cea, 0x0000, 0x0000, 0x0d40, 0x4698,
+	    0x2066, 0x0378, 0x0000, 0x48b4, 0x0000, 0x1f73, 0x4120, 0x4c00,
+	    0x0286, 0x4289, 0x2c9b, 0x04a9, 0x48b8, 0x0000, 0x4a9d, 0x1514,
+	    0x0361, 0x0000, 0x0000, 0x471d, 0x28d3, 0x23be, 0x000a, 0x012f,
+	    0x2af6, 0x4372, 0x4dc4, 0x0000, 0x41a0, 0x0000, 0x2f5d, 0x3571,
+	    0x3cf6, 0x14a5, 0x4040, 0x159e, 0x05bf, 0x18a2, 0x22ef, 0x4bef,
+	    0x1937, 0x0000, 0x0f7c, 0x3026, 0x12ef, 0x1947, 0x16ff, 0x354e,
+	    0x0901, 0x31bb, 0x3b3e, 0x0ce4, 0x0000, 0x3832, 0x3c43, 0x3750,
+	    0x0000, 0x3923, 0x1e81, 0x0000, 0x1263, 0x150a, 0x10c4, 0x0000,
+	    0x0eb2, 0x1b2c, 0x12e0, 0x2dc3, 0x1c94, 0x264a, 0x15c5, 0x2402,
+	    0x0a52, 0x2be9, 0x0da7, 0x3446, 0x0000, 0x0000, 0x47c8, 0x0000,
+	    0x31ac, 0x3723, 0x01d0, 0x25e5, 0x2d92, 0x49ce, 0x2e10, 0x42f5,
+	    0x0b70, 0x39bd, 0x16a8, 0x0948, 0x21bb, 0x393d, 0x151e, 0x1b9f,
+	    0x1792, 0x0fa0, 0x4983, 0x0000, 0x301c, 0x0000, 0x2a32, 0x4523,
+	    0x0a13, 0x160d, 0x437f, 0x34b4, 0x4d68, 0x49ee, 0x0acb, 0x04f8,
+	    0x24f8, 0x0c56, 0x4acf, 0x2f39, 0x0000, 0x0b1f, 0x41ee, 0x1902,
+	    0x4690, 0x02fc, 0x3369, 0x4700, 0x4d6d, 0x1259, 0x0000, 0x2c83,
+	    0x1bb2, 0x06ef, 0x1aee, 0x2a28, 0x2e34, 0x1ea7, 0x29e3, 0x041f,
+	    0x05fe, 0x111f, 0x03c9, 0x45ab, 0x26ec, 0x484b, 0x46ed, 0x34b4,
+	    0x453f, 0x118d, 0x207e, 0x0000, 0x0000, 0x333c, 0x120f, 0x0000,
+	    0x1d87, 0x2bda, 0x03c3, 0x0000, 0x4b62, 0x3683, 0x0000, 0x4ba2,
+	    0x2b4a, 0x4bbd, 0x12bb, 0x3e11, 0x4028, 0x4a97, 0x41d8, 0x0000,
+	    0x0000, 0x3e7a, 0x1f97, 0x48dc, 0x1cba, 0x1da4, 0x486c, 0x02a3,
+	    0x18f6, 0x219b, 0x2de1, 0x2006, 0x4d64, 0x1a06, 0x0cc4, 0x3a9e,
+	    0x1b9c, 0x01e7, 0x0063, 0x2ff3, 0x1a27, 0x0000, 0x2e3f, 0x4d18,
+	    0x4548, 0x0000, 0x4a6d, 0x34d2, 0x13e2, 0x428f, 0x0789, 0x1a5b,
+	    0x1bda, 0x00a9, 0x17c4, 0x4d54, 0x0000, 0x19e0, 0x1ced, 0x29d0,
+	    0x21ce, 0x126e, 0x0efb, 0x4370, 0x0ff8, 0x0000, 0x342a, 0x06b3,
+	    0x305d, 0x1e72, 0x19f1, 0x1213, 0x48fa, 0x0000, 0x1b08, 0x3753,
+	    0x14c4, 0x1131, 0x3560, 0x06d5, 0x4d20, 0x2eb7, 0x09f5, 0x06bd,
+	    0x0000, 0x0000, 0x2078, 0x0781, 0x3424, 0x23a0, 0x0000, 0x4af2,
+	    0x3401, 0x0219, 0x14b9, 0x0200, 0x0000, 0x28e2, 0x0000, 0x19d8,
+	    0x2b3c, 0x3708, 0x2f10, 0x358d, 0x1a5a, 0x1885, 0x0a43, 0x18eb,
+	    0x3779, 0x232e, 0x0955, 0x3c6e, 0x17c1, 0x248f, 0x30e2, 0x24c4,
+	    0x4204, 0x0000, 0x2e24, 0x3c98, 0x01b9, 0x2378, 0x2532, 0x26ee,
+	    0x2b93, 0x1fd2, 0x13d3, 0x1dbe, 0x1724, 0x3529, 0x361d, 0x0000,
+	    0x0000, 0x4e18, 0x3269, 0x17d0, 0x4035, 0x2c0f, 0x1e76, 0x1165,
+	    0x3945, 0x0000, 0x0000, 0x4935, 0x473a, 0x0000, 0x172c, 0x14c1,
+	    0x1689, 0x49b0, 0x08bd, 0x3667, 0x32a2, 0x1ca7, 0x1fe4, 0x3547,
+	    0x061a, 0x4122, 0x3f0e, 0x1a1c, 0x494e, 0x2f5b, 0x4312, 0x0000,
+	    0x0d2e, 0x3c40, 0x0c03, 0x437f, 0x3da8, 0x16ce, 0x2f3f, 0x168b,
+	    0x17d8, 0x1254, 0x220e, 0x1347, 0x15e4, 0x4185, 0x08d8, 0x0000,
+	    0x0d3f, 0x1d45, 0x0000, 0x2a5d, 0x2037, 0x1439, 0x38bf, 0x1a2e,
+	    0x3054, 0x29d2, 0x42fe, 0x1945, 0x4d7f, 0x37e6, 0x4592, 0x2671,
+	    0x0000, 0x13c3, 0x2ca5, 0x0b4f, 0x15dd, 0x30b8, 0x10d4, 0x0000,
+	    0x14b7, 0x1327, 0x379a, 0x2951, 0x468e, 0x2a3b, 0x16cd, 0x0000,
+	    0x3931, 0x0000, 0x44f8, 0x0b33, 0x0000, 0x13e3, 0x23a4, 0x0000,
+	    0x0000, 0x442a, 0x4796, 0x3a92, 0x2bc4, 0x2ada, 0x09cf, 0x0000,
+	    0x3187, 0x2b2e, 0x0000, 0x0d52, 0x123c, 0x086f, 0x0000, 0x4d19,
+	    0x266d, 0x0000, 0x49cb, 0x2fb7, 0x0000, 0x0000, 0x14e5, 0x2c40,
+	    0x11f5, 0x15bc, 0x395b, 0x4616, 0x11a2, 0x0000, 0x0000, 0x49fd,
+	    0x498b, 0x0000, 0x1fe5, 0x208a, 0x0000, 0x4761, 0x0a86, 0x3563,
+	    0x0000, 0x09fa, 0x0f97, 0x0cd8, 0x08fc, 0x449d, 0x0000, 0x2abe,
+	    0x3c50, 0x0381, 0x4452, 0x0000, 0x4d0c, 0x2ddc, 0x2a77, 0x3dca,
+	    0x22c0, 0x491d, 0x2dd8, 0x3e80, 0x3269, 0x4977, 0x1360, 0x0000,
+	    0x4c71, 0x02ab, 0x2cd2, 0x4b8b, 0x00e4, 0x46b4, 0x1069, 0x104c,
+	    0x3807, 0x30de, 0x2a5c, 0x2ee7, 0x0000, 0x49ff, 0x211b, 0x0000,
+	    0x3918, 0x228e, 0x0000, 0x2b45, 0x1123, 0x222b, 0x30ba, 0x4830,
+	    0x3809, 0x0725, 0x2a11, 0x0c60, 0x0000, 0x0000, 0x0000, 0x0e17,
+	    0x2bb4, 0x0000, 0x0000, 0x3804, 0x146f, 0x0bf5, 0x125f, 0x203b,
+	    0x00fc, 0x027d, 0x3590, 0x48e5, 0x0000, 0x0de6, 0x3953, 0x29fd,
+	    0x3fc7, 0x0b33, 0x1a9c, 0x39af, 0x3b4a, 0x4a5f, 0x3a50, 0x2631,
+	    0x09b5, 0x0000, 0x1177, 0x1aef, 0x18fd, 0x0000, 0x1532, 0x0000,
+	    0x0000, 0x4d09, 0x1e05, 0x17be, 0x218e, 0x01e3, 0x0000, 0x4246,
+	    0x2c3d, 0x01bf, 0x17ef, 0x39e1, 0x0000, 0x480e, 0x05ac, 0x0000,
+	    0x0290, 0x2902, 0x029e, 0x0936, 0x0000, 0x0000, 0x0c0b, 0x21d5,
+	    0x358a, 0x0000, 0x47d8, 0x0f9c, 0x037e, 0x0000, 0x25cd, 0x157d,
+	    0x0000, 0x0000, 0x0a79, 0x3230, 0x3507, 0x0000, 0x1e4b, 0x4718,
+	    0x23fc, 0x0a33, 0x138d, 0x0165, 0x3930, 0x3e73, 0x3ded, 0x099b,
+	    0x075b, 0x3f9a, 0x2bd8, 0x0000, 0x0826, 0x0000, 0x2a36, 0x0bb2,
+	    0x0000, 0x4516, 0x0000, 0x1358, 0x240d, 0x2da1, 0x0505, 0x0000,
+	    0x1a1f, 0x45df, 0x3e89, 0x2af4, 0x28fa, 0x161f, 0x0000, 0x0000,
+	    0x21f7, 0x253e, 0x32b3, 0x3243, 0x0000, 0x1f29, 0x34b6, 0x4a16,
+	    0x2321, 0x322e, 0x2a0f, 0x0dcb, 0x25ce, 0x44de, 0x4dc4, 0x03d9,
+	    0x1f2c, 0x3e34, 0x0000, 0x0000, 0x0683, 0x2357, 0x3f6d, 0x0000,
+	    0x0d2d, 0x07fb, 0x0000, 0x278c, 0x24b5, 0x14d2, 0x2a7c, 0x096f,
+	    0x06d4, 0x3cc4, 0x29fe, 0x2178, 0x4812, 0x498e, 0x19bc, 0x3358,
+	    0x4c7a, 0x36e7, 0x0000, 0x0000, 0x0493, 0x2fe3, 0x0000, 0x4943,
+	    0x2c74, 0x0000, 0x45d8, 0x2886, 0x1d3d, 0x35ae, 0x0bba, 0x283b,
+	    0x1ee3, 0x23cd, 0x434e, 0x0ea1, 0x472c, 0x4055, 0x42bb, 0x2048,
+	    0x2465, 0x395a, 0x0a17, 0x0000, 0x258a, 0x04f6, 0x3a2e, 0x0000,
+	    0x183a, 0x2070, 0x06eb, 0x1076, 0x4d03, 0x0aa9, 0x073d, 0x1ef2,
+	    0x0000, 0x220a, 0x209e, 0x0000, 0x0000, 0x0000, 0x1bdc, 0x28f6,
+	    0x2330, 0x25ca, 0x0000, 0x3533, 0x1a61, 0x0000, 0x0629, 0x23d8,
+	    0x0000, 0x0000, 0x0000, 0x18b0, 0x0000, 0x2a5c, 0x3938, 0x45d4,
+	    0x0e44, 0x3ad0, 0x08bc, 0x0000, 0x0000, 0x18fd, 0x35d7, 0x2cdf,
+	    0x0000, 0x256a, 0x201e, 0x2c9a, 0x0000, 0x347d, 0x2326, 0x100d,
+	    0x3804, 0x0856, 0x4435, 0x30b6, 0x3421, 0x2963, 0x22e3, 0x03e9,
+	    0x0000, 0x46ae, 0x0000, 0x3ee2, 0x1d17, 0x3115, 0x3920, 0x1089,
+	    0x36c6, 0x0255, 0x10c3, 0x0b34, 0x3719, 0x1490, 0x0000, 0x0000,
+	    0x4cb6, 0x0000, 0x0000, 0x0000, 0x06a2, 0x1a73, 0x0000, 0x4dc9,
+	    0x0000, 0x0000, 0x2a3a, 0x0395, 0x34ee, 0x0000, 0x389b, 0x3d2c,
+	    0x0709, 0x0000, 0x0000, 0x20a5, 0x209a, 0x0000, 0x1c96, 0x39ae,
+	    0x2185, 0x23a1, 0x0000, 0x4483, 0x0000, 0x365f, 0x12b9, 0x2e26,
+	    0x0000, 0x3717, 0x05fe, 0x006b, 0x07f6, 0x03c4, 0x4047, 0x0000,
+	    0x2beb, 0x3d64, 0x2b58, 0x2a6d, 0x4637, 0x445b, 0x3e66, 0x3325,
+	    0x0000, 0x3567, 0x15c0, 0x0000, 0x1563, 0x0000, 0x2018, 0x3767,
+	    0x43aa, 0x38c2, 0x4157, 0x1f13, 0x1952, 0x0000, 0x2ff4, 0x0a87,
+	    0x2138, 0x20a8, 0x030a, 0x038d, 0x0000, 0x0000, 0x0435, 0x0000,
+	    0x439b, 0x0000, 0x3e2f, 0x1133, 0x0000, 0x379b, 0x499d, 0x3a17,
+	    0x19d2, 0x0000, 0x1ec1, 0x0d25, 0x4df8, 0x03ad, 0x0000, 0x0980,
+	    0x17ba, 0x0000, 0x0000, 0x3eec, 0x3271, 0x202f, 0x192f, 0x1efa,
+	    0x0dc5, 0x4c47, 0x07c8, 0x375f, 0x392a, 0x1ebb, 0x0000, 0x3422,
+	    0x0000, 0x4ba9, 0x27b7, 0x070d, 0x0ed8, 0x2898, 0x2a3b, 0x0000,
+	    0x0eb7, 0x4da3, 0x4bd5, 0x2195, 0x0673, 0x248f, 0x1f22, 0x44d4,
+	    0x0000, 0x3919, 0x0000, 0x0000, 0x1db1, 0x2701, 0x360d, 0x0000,
+	    0x0956, 0x0000, 0x33e5, 0x272c, 0x07f6, 0x4036, 0x02e6, 0x0c12,
+	    0x4380, 0x042f, 0x4672, 0x424e, 0x13a5, 0x3415, 0x0000, 0x3416,
+	    0x4069, 0x4d40, 0x3129, 0x1d24, 0x428d, 0x0000, 0x3a41, 0x472c,
+	    0x273b, 0x0000, 0x0000, 0x0000, 0x2bd9, 0x3a3a, 0x0570, 0x0000,
+	    0x1aa4, 0x3c5a, 0x4667, 0x2316, 0x0000, 0x400e, 0x2472, 0x0a99,
+	    0x2f2e, 0x47ac, 0x21bf, 0x34c1, 0x16f6, 0x0f6f, 0x0000, 0x0af6,
+	    0x3844, 0x0000, 0x0146, 0x4c54, 0x0000, 0x2e04, 0x1de4, 0x33a6,
+	    0x0000, 0x11dc, 0x0eea, 0x115d, 0x059a, 0x0317, 0x022e, 0x1b40,
+	    0x0000, 0x30f7, 0x3f5a, 0x103f, 0x4796, 0x0000, 0x1da4, 0x0000,
+	    0x4c35, 0x0000, 0x293f, 0x0000, 0x2bcb, 0x1748, 0x056d, 0x0d7c,
+	    0x0d5f, 0x0000, 0x4a3d, 0x2a16, 0x0eb4, 0x1a41, 0x0000, 0x00dd,
+	    0x39b9, 0x43be, 0x2a84, 0x4c1e, 0x43cc, 0x1764, 0x3c47, 0x35c6,
+	    0x398e, 0x0000, 0x10f5, 0x1e22, 0x1b72, 0x3bc8, 0x0f2d, 0x14b7,
+	    0x31b4, 0x0000, 0x0000, 0x0000, 0x160e, 0x3fb7, 0x2c00, 0x0000,
+	    0x4ccb, 0x3b41, 0x0000, 0x0000, 0x155a, 0x2c05, 0x009e, 0x40b7,
+	    0x1be8, 0x2d42, 0x0000, 0x3f6d, 0x0000, 0x15fd, 0x08e7, 0x453c,
+	    0x0000, 0x1036, 0x2a04, 0x0117, 0x1001, 0x0000, 0x2070, 0x4bbf,
+	    0x134d, 0x483c, 0x4390, 0x3940, 0x0000, 0x33b5, 0x39c1, 0x19df,
+	    0x1293, 0x0000, 0x0000, 0x2da4, 0x0593, 0x326a, 0x2a1b, 0x1919,
+	    0x179d, 0x2822, 0x01ce, 0x33f5, 0x1eb7, 0x0000, 0x370b, 0x23c8,
+	    0x198f, 0x2b9d, 0x0000, 0x0287, 0x09af, 0x3601, 0x07b2, 0x3e16,
+	    0x0000, 0x23f0, 0x3b05, 0x0cb3, 0x1037, 0x427a, 0x03c8, 0x35c9,
+	    0x0000, 0x1438, 0x27e0, 0x481b, 0x233a, 0x4830, 0x4c90, 0x4d6d,
+	    0x22df, 0x0000, 0x324b, 0x1c67, 0x0aad, 0x17bb, 0x2121, 0x1728,
+	    0x0000, 0x0000, 0x47bd, 0x4c1e, 0x0000, 0x16dd, 0x0000, 0x3124,
+	    0x3570, 0x0a0e, 0x0000, 0x2f84, 0x3d00, 0x0000, 0x35cc, 0x0000,
+	    0x2af2, 0x2fc5, 0x0c57, 0x4b1e, 0x286b, 0x0094, 0x3958, 0x389b,
+	    0x0000, 0x14d5, 0x10dd, 0x2d50, 0x0b6b, 0x0000, 0x0000, 0x2bab,
+	    0x42ee, 0x18ce, 0x1735, 0x0f6d, 0x0000, 0x0000, 0x02ec, 0x0dcf,
+	    0x0000, 0x1898, 0x0478, 0x0d7e, 0x0000, 0x0000, 0x2477, 0x1ea1,
+	    0x1788, 0x3832, 0x0a6f, 0x0000, 0x1bd2, 0x4b24, 0x0ed7, 0x1de1,
+	    0x3ae3, 0x0000, 0x3ff5, 0x433d, 0x2a2f, 0x0000, 0x0790, 0x071f,
+	    0x0000, 0x0000, 0x3df4, 0x22aa, 0x186b, 0x0ed5, 0x3305, 0x2a4f,
+	    0x3dae, 0x016a, 0x2ba4, 0x4acf, 0x167d, 0x2dff, 0x2aaa, 0x3e26,
+	    0x43c5, 0x285f, 0x438b, 0x144b, 0x0000, 0x1a4e, 0x2c20, 0x2249,
+	    0x0000, 0x3d30, 0x0000, 0x1b59, 0x0000, 0x421b, 0x0000, 0x0000,
+	    0x499f, 0x0ee5, 0x0d8f, 0x2663, 0x1a25, 0x2af4, 0x0e5b, 0x2ef5,
+	    0x1e0d, 0x10db, 0x46b1, 0x39ca, 0x0000, 0x4227, 0x4a46, 0x4a0e,
+	    0x0000, 0x0ec9, 0x0341, 0x3955, 0x0000, 0x2e7f, 0x291c, 0x0000,
+	    0x125b, 0x46ca, 0x0000, 0x2444, 0x3417, 0x3c9d, 0x2c1a, 0x046c,
+	    0x11f0, 0x1d7b, 0x3717, 0x37ca, 0x3000, 0x095e, 0x04d8, 0x2b11,
+	    0x295a, 0x0000, 0x0000, 0x0000, 0x0dab, 0x126d, 0x185e, 0x0000,
+	    0x3379, 0x19ff, 0x0000, 0x36ff, 0x151d, 0x0000, 0x2d9b, 0x27da,
+	    0x0000, 0x4072, 0x3e07, 0x4ae5, 0x240a, 0x384e, 0x243f, 0x359a,
+	    0x0cea, 0x3f99, 0x0000, 0x0000, 0x0000, 0x20bd, 0x2944, 0x0cb9,
+	    0x45eb, 0x2c41, 0x0000, 0x2bed, 0x0000, 0x14b6, 0x0000, 0x22a1,
+	    0x1172, 0x0000, 0x0000, 0x3340, 0x0000, 0x3ffc, 0x1c23, 0x0000,
+	    0x1970, 0x4a8e, 0x1b70, 0x3da0, 0x16d5, 0x44e2, 0x4967, 0x0908,
+	    0x0000, 0x3536, 0x1d5e, 0x0000, 0x17f3, 0x0000, 0x0000, 0x3d64,
+	    0x0695, 0x2990, 0x3722, 0x0000, 0x20e8, 0x0000, 0x18ee, 0x0000,
+	    0x0207, 0x0000, 0x01e2, 0x3d3c, 0x1502, 0x4b0a, 0x2d68, 0x3959,
+	    0x0000, 0x46cf, 0x1c40, 0x0026, 0x3240, 0x0fcc, 0x4023, 0x2e2d,
+	    0x303f, 0x0dac, 0x1fa8, 0x452c, 0x07cd, 0x1f97, 0x0000, 0x0e28,
+	    0x0000, 0x4177, 0x2b44, 0x2752, 0x17fe, 0x0000, 0x0000, 0x3879,
+	    0x4a9a, 0x1bdc, 0x1463, 0x256f, 0x2462, 0x4bda, 0x0000, 0x0c6e,
+	    0x0000, 0x2d8c, 0x4cb9, 0x0bcd, 0x3642, 0x2f6e, 0x4bb8, 0x1e1d,
+	    0x0460, 0x2858, 0x2073, 0x0665, 0x1c4f, 0x05cf, 0x0000, 0x0000,
+	    0x1bfd, 0x1197, 0x2300, 0x0000, 0x1362, 0x0000, 0x1ff0, 0x0000,
+	    0x28df, 0x4e19, 0x0000, 0x0000, 0x1c03, 0x4d27, 0x1dfc, 0x353c,
+	    0x0000, 0x4166, 0x0000, 0x444f, 0x4267, 0x3616, 0x0000, 0x1630,
+	    0x14ca, 0x0aac, 0x2b48, 0x3da1, 0x0000, 0x3fa5, 0x0bd0, 0x2cf7,
+	    0x30e2, 0x3645, 0x09fd, 0x09cc, 0x2ad8, 0x39b8, 0x0fc6, 0x1e36,
+	    0x3760, 0x47b1, 0x3d44, 0x3ef3, 0x0000, 0x489c, 0x254d, 0x4dac,
+	    0x1b2f, 0x0323, 0x0000, 0x3531, 0x466e, 0x2560, 0x187f, 0x02eb,
+	    0x4898, 0x1cd9, 0x0d15, 0x38d7, 0x2fad, 0x1d29, 0x343d, 0x1b0d,
+	    0x2d68, 0x4cf2, 0x05d5, 0x1ce0, 0x2d79, 0x45c1, 0x4b3d, 0x122b,
+	    0x347b, 0x0000, 0x1df1, 0x0154, 0x0307, 0x0252, 0x0054, 0x0000,
+	    0x0000, 0x2dea, 0x0000, 0x0000, 0x1d8b, 0x2d70, 0x445e, 0x0c77,
+	    0x2b6a, 0x0000, 0x0000, 0x372e, 0x48d7, 0x27d4, 0x4009, 0x081b,
+	    0x4ca5, 0x46b6, 0x0000, 0x1c4f, 0x42ed, 0x134a, 0x110c, 0x0da8,
+	    0x3e85, 0x0000, 0x309f, 0x3f9d, 0x284d, 0x3651, 0x3ef3, 0x277b,
+	    0x4d24, 0x0436, 0x0000, 0x38d9, 0x3b0d, 0x0da0, 0x0092, 0x3382,
+	    0x0000, 0x0490, 0x4445, 0x0000, 0x4467, 0x10db, 0x48b1, 0x0ca4,
+	    0x14a0, 0x3358, 0x0000, 0x4a3e, 0x01b4, 0x385f, 0x0000, 0x046d,
+	    0x20b0, 0x3102, 0x0000, 0x3aeb, 0x0000, 0x0000, 0x0000, 0x48eb,
+	    0x287b, 0x329c, 0x2e7e, 0x1d62, 0x053b, 0x2bd2, 0x4a03, 0x3283,
+	    0x43b2, 0x0000, 0x0000, 0x378d, 0x323e, 0x0d22, 0x19e1, 0x0000,
+	    0x0000, 0x3878, 0x1021, 0x4211, 0x1130, 0x058e, 0x4bab, 0x3a37,
+	    0x156d, 0x19a0, 0x0308, 0x2936, 0x0000, 0x3435, 0x1d0e, 0x1b74,
+	    0x0000, 0x0000, 0x3407, 0x17fd, 0x1bcc, 0x4503, 0x0b43, 0x0bc8,
+	    0x0053, 0x0000, 0x1542, 0x1e40, 0x089c, 0x3042, 0x3610, 0x41b3,
+	    0x450e, 0x23e6, 0x2919, 0x41a6, 0x0033, 0x2a3b, 0x2e76, 0x0d12,
+	    0x2893, 0x3fc7, 0x1fec, 0x1cb2, 0x02a5, 0x01d3, 0x01ae, 0x4821,
+	    0x0b77, 0x1e90, 0x0ff3, 0x087d, 0x3578, 0x3220, 0x2444, 0x1da0,
+	    0x1f95, 0x4348, 0x44e6, 0x2b2f, 0x13da, 0x1b5f, 0x37bd, 0x0000,
+	    0x0248, 0x0000, 0x1f8d, 0x2cd4, 0x0000, 0x0a16, 0x361e, 0x06fc,
+	    0x0000, 0x0e93, 0x35f4, 0x0000, 0x1c2f, 0x0000, 0x2581, 0x0000,
+	    0x0000, 0x1892, 0x291e, 0x0000, 0x0000, 0x450f, 0x0000, 0x1697,
+	    0x38c8, 0x47a0, 0x2c7b, 0x1a74, 0x0000, 0x0000, 0x0c75, 0x2970,
+	    0x46a3, 0x3b72, 0x13d1, 0x0000, 0x24b7, 0x2d4e, 0x094e, 0x0000,
+	    0x1d4c, 0x24de, 0x425c, 0x156b, 0x29da, 0x16dd, 0x046e, 0x13c5,
+	    0x3002, 0x2348, 0x0000, 0x0149, 0x0de1, 0x209a, 0x0000, 0x4969,
+	    0x0000, 0x1e68, 0x0caa, 0x4b6e, 0x11d3, 0x45bc, 0x2575, 0x0000,
+	    0x0000, 0x36ac, 0x0000, 0x2866, 0x0000, 0x25ad, 0x35e6, 0x33f0,
+	    0x0000, 0x49d8, 0x194c, 0x1b39, 0x1db5, 0x2085, 0x442b, 0x4114,
+	    0x0a3f, 0x4708, 0x0000, 0x3b5e, 0x0dae, 0x1182, 0x489e, 0x1bc9,
+	    0x4c1a, 0x4284, 0x0000, 0x0dbb, 0x30d9, 0x33b0, 0x0000, 0x329c,
+	    0x0000, 0x0d7b, 0x3796, 0x138a, 0x0000, 0x08b6, 0x0000, 0x0000,
+	    0x2017, 0x0ae8, 0x1c15, 0x259f, 0x42d1, 0x3a7e, 0x18bd, 0x2390,
+	    0x1b2b, 0x0000, 0x39f5, 0x2b0b, 0x0000, 0x0b74, 0x4959, 0x1ae4,
+	    0x0000, 0x1c39, 0x0000, 0x0a5c, 0x2b5f, 0x0037, 0x0000, 0x0000,
+	    0x359c, 0x2bd8, 0x19aa, 0x0194, 0x16ac, 0x1035, 0x2b5b, 0x4051,
+	    0x2a17, 0x0000, 0x4a9d, 0x206b, 0x0000, 0x4adb, 0x433f, 0x4d26,
+	    0x3aa7, 0x3389, 0x0000, 0x3d5b, 0x0000, 0x3282, 0x2e38, 0x15f6,
+	    0x34d8, 0x4aa7, 0x1082, 0x331a, 0x31fb, 0x0000, 0x0000, 0x4a8f,
+	    0x2529, 0x27e0, 0x2987, 0x33d9, 0x309f, 0x0000, 0x0bf2, 0x18f5,
+	    0x365f, 0x0000, 0x22ff, 0x2549, 0x370a, 0x3f66, 0x0000, 0x1aab,
+	    0x0000, 0x2695, 0x276c, 0x0000, 0x44de, 0x2f37, 0x0000, 0x20ea,
+	    0x0285, 0x00a1, 0x4a6b, 0x0000, 0x3b07, 0x3b08, 0x2751, 0x0000,
+	    0x06e4, 0x300d, 0x17d7, 0x1264, 0x12c8, 0x285f, 0x0000, 0x1116,
+	    0x47d9, 0x03e7, 0x0000, 0x2fbd, 0x1b8f, 0x0000, 0x23b0, 0x3aad,
+	    0x1334, 0x17dc, 0x018f, 0x484c, 0x2d69, 0x12c8, 0x0000, 0x4042,
+	    0x2fef, 0x0000, 0x2d04, 0x0000, 0x0000, 0x1339, 0x0000, 0x02e5,
+	    0x0171, 0x2eda, 0x0000, 0x1d9f, 0x2528, 0x271d, 0x43e8, 0x0aab,
+	    0x0000, 0x0000, 0x1ffb, 0x19ca, 0x2c52, 0x0000, 0x0000, 0x0000,
+	    0x2873, 0x3029, 0x30f5, 0x0f42, 0x0000, 0x10ff, 0x13c1, 0x4345,
+	    0x0000, 0x05cc, 0x0000, 0x0000, 0x28b2, 0x0000, 0x30af, 0x2b2d,
+	    0x021e, 0x0000, 0x18b5, 0x39dc, 0x0000, 0x140b, 0x2852, 0x0000,
+	    0x39df, 0x0d58, 0x1435, 0x0000, 0x0c09, 0x0000, 0x18a4, 0x2d2f,
+	    0x3cd8, 0x2535, 0x2506, 0x1796, 0x0270, 0x0e4a, 0x3b71, 0x0000,
+	    0x0000, 0x21eb, 0x12c7, 0x1b5b, 0x0000, 0x4bfa, 0x2d58, 0x010e,
+	    0x3613, 0x0000, 0x0000, 0x0777, 0x0847, 0x00c9, 0x0565, 0x2c4e,
+	    0x0000, 0x0000, 0x1277, 0x3fc1, 0x1b87, 0x0af4, 0x0000, 0x0e01,
+	    0x4ddd, 0x0000, 0x0000, 0x0000, 0x45a3, 0x0185, 0x20cd, 0x0000,
+	    0x0000, 0x3391, 0x056a, 0x151d, 0x1c20, 0x2ed5, 0x4691, 0x209a,
+	    0x0fe2, 0x0000, 0x026d, 0x0000, 0x0000, 0x0171, 0x0e11, 0x0000,
+	    0x1921, 0x0f7d, 0x22ca, 0x06dc, 0x0725, 0x1755, 0x3907, 0x0585,
+	    0x0000, 0x26d9, 0x2fce, 0x327f, 0x28c1, 0x126f, 0x23a0, 0x30ec,
+	    0x430a, 0x0651, 0x0803, 0x24df, 0x3ca7, 0x219d, 0x0000, 0x1def,
+	    0x0000, 0x2f64, 0x3022, 0x24ae, 0x0000, 0x16f3, 0x0000, 0x26ba,
+	    0x05eb, 0x0000, 0x0d6b, 0x0cde, 0x489a, 0x1ec1, 0x0000, 0x302e,
+	    0x1ff5, 0x15d8, 0x1149, 0x018f, 0x3fec, 0x0d5d, 0x080a, 0x054d,
+	    0x0167, 0x4a31, 0x0000, 0x0000, 0x094e, 0x28d5, 0x0000, 0x34c1,
+	    0x4a6d, 0x0000, 0x1a18, 0x3219, 0x284a, 0x0076, 0x0000, 0x0000,
+	    0x122e, 0x0000, 0x0000, 0x3dcb, 0x4214, 0x315d, 0x4991, 0x0ece,
+	    0x1176, 0x0000, 0x3ed7, 0x3d11, 0x0000, 0x2fcf, 0x4339, 0x1e5d,
+	    0x2d03, 0x06d8, 0x498f, 0x0000, 0x46ee, 0x48c6, 0x3649, 0x01e9,
+	    0x2b3c, 0x0939, 0x1722, 0x3e7c, 0x4abe, 0x152f, 0x0000, 0x38f7,
+	    0x4be6, 0x1eb5, 0x0000, 0x11e2, 0x0000, 0x0000, 0x2255, 0x3cbd,
+	    0x1506, 0x0025, 0x46bd, 0x2976, 0x23b0, 0x212f, 0x4473, 0x2bfc,
+	    0x07ba, 0x0000, 0x0000, 0x2023, 0x4329, 0x298c, 0x085a, 0x0000,
+	    0x2e2b, 0x0000, 0x4735, 0x0000, 0x2c11, 0x3d85, 0x054b, 0x31b9,
+	    0x1961, 0x44e9, 0x3111, 0x33ed, 0x2c0e, 0x3bdb, 0x485e, 0x0000,
+	    0x30d5, 0x02d4, 0x0000, 0x0000, 0x0000, 0x0d25, 0x11c7, 0x02c9,
+	    0x0000, 0x0000, 0x1e7d, 0x0d12, 0x3351, 0x1654, 0x362b, 0x2aad,
+	    0x4c23, 0x32af, 0x2de5, 0x0000, 0x339c, 0x4dee, 0x0a9d, 0x0419,
+	    0x0000, 0x2fb4, 0x0000, 0x0000, 0x00e2, 0x0000, 0x2b25, 0x0b05,
+	    0x055d, 0x1f34, 0x3dc3, 0x3796, 0x45b2, 0x0dec, 0x41a0, 0x24ff,
+	    0x48ec, 0x05a9, 0x1854, 0x0000, 0x0000, 0x3e12, 0x1ea0, 0x402c,
+	    0x1b58, 0x0000, 0x0000, 0x46bb, 0x1963, 0x0728, 0x1023, 0x0000,
+	    0x0000, 0x0000, 0x3bee, 0x0000, 0x2517, 0x0000, 0x08c4, 0x0000,
+	    0x448c, 0x0000, 0x2e32, 0x0f8c, 0x0000, 0x0960, 0x172d, 0x0b80,
+	    0x196a, 0x2efc, 0x0000, 0x0000, 0x0000, 0x0000, 0x213d, 0x3e8e,
+	    0x1f11, 0x0d52, 0x23d9, 0x3ad8, 0x0000, 0x0000, 0x1a64, 0x0f44,
+	    0x2409, 0x0000, 0x1a46, 0x0000, 0x0ea0, 0x3e69, 0x12f4, 0x09a9,
+	    0x08d7, 0x167f, 0x0732, 0x3f3a, 0x42dc, 0x1cbe, 0x049c, 0x3df0,
+	    0x0000, 0x4b7e, 0x0000, 0x357a, 0x1067, 0x0000, 0x16b6, 0x3c9e,
+	    0x1ace, 0x0000, 0x1c1f, 0x37f8, 0x0318, 0x4de3, 0x1a51, 0x0000,
+	    0x0000, 0x210a, 0x1077, 0x4159, 0x2ef1, 0x09c8, 0x075f, 0x0000,
+	    0x1ad2, 0x0000, 0x0000, 0x0000, 0x0000, 0x458c, 0x00f5, 0x1ab8,
+	    0x2b9e, 0x1bd4, 0x08d5, 0x45ba, 0x200e, 0x24b2, 0x1580, 0x179a,
+	    0x2694, 0x0fd2, 0x3323, 0x0000, 0x3416, 0x345d, 0x47cd, 0x1c1a,
+	    0x0000, 0x0454, 0x075a, 0x3764, 0x0000, 0x437a, 0x2f8b, 0x05e6,
+	    0x1668, 0x34bd, 0x0962, 0x0000, 0x3a90, 0x1521, 0x0000, 0x4bc4,
+	    0x0000, 0x4d68, 0x4b5c, 0x3cd1, 0x2bb5, 0x2e78, 0x0000, 0x0000,
+	    0x16ca, 0x0000, 0x0218, 0x1213, 0x2ae9, 0x448d, 0x0000, 0x1cef,
+	    0x0000, 0x34e5, 0x3270, 0x0c18, 0x414c, 0x0000, 0x0000, 0x4299,
+	    0x2855, 0x14d2, 0x0000, 0x17ea, 0x1eff, 0x058e, 0x0000, 0x3aec,
+	    0x06a0, 0x20b4, 0x0000, 0x0398, 0x36f1, 0x2d47, 0x3402, 0x21ef,
+	    0x0b0f, 0x03c3, 0x21ee, 0x0fa4, 0x25a4, 0x30dc, 0x0ed4, 0x3dc4,
+	    0x0000, 0x024c, 0x18e2, 0x42fc, 0x0000, 0x1b25, 0x0000, 0x0000,
+	    0x1c79, 0x3873, 0x182f, 0x0000, 0x3c6f, 0x0000, 0x11a9, 0x037a,
+	    0x0000, 0x47aa, 0x40b5, 0x3340, 0x4be8, 0x0000, 0x0000, 0x1c69,
+	    0x032f, 0x1f94, 0x05b8, 0x0486, 0x3174, 0x19ce, 0x1b96, 0x0000,
+	    0x1aa3, 0x3f84, 0x172e, 0x3543, 0x1fc0, 0x24a2, 0x1d30, 0x2e71,
+	    0x3fa5, 0x0000, 0x129c, 0x160f, 0x036e, 0x3135, 0x06da, 0x06a9,
+	    0x4420, 0x28ea, 0x066d, 0x0000, 0x10ec, 0x0575, 0x335c, 0x175d,
+	    0x4dea, 0x0bff, 0x363a, 0x3ff5, 0x0000, 0x0000, 0x2b28, 0x3939,
+	    0x1316, 0x19bd, 0x0518, 0x422a, 0x0000, 0x0000, 0x2f1d, 0x0000,
+	    0x4de3, 0x0000, 0x1694, 0x15f3, 0x120f, 0x2ee9, 0x437b, 0x0000,
+	    0x45f3, 0x4873, 0x0000, 0x0000, 0x03c9, 0x0000, 0x4d59, 0x41cc,
+	    0x0000, 0x4c97, 0x1f19, 0x0000, 0x2cec, 0x4126, 0x019e, 0x07fe,
+	    0x29ec, 0x395d, 0x0000, 0x05da, 0x0000, 0x0ebd, 0x0000, 0x1e74,
+	    0x3091, 0x048b, 0x4907, 0x4a0b, 0x2ca9, 0x39d7, 0x313f, 0x36e1,
+	    0x4d10, 0x0000, 0x3f34, 0x46b2, 0x23a8, 0x3441, 0x041a, 0x0000,
+	    0x3c40, 0x0000, 0x3c3d, 0x4c4a, 0x0291, 0x0000, 0x181f, 0x03b7,
+	    0x4a27, 0x0000, 0x0000, 0x39a9, 0x492c, 0x3c28, 0x0000, 0x0000,
+	    0x4a3a, 0x4b2e, 0x1ae6, 0x43e8, 0x1e30, 0x31f1, 0x0000, 0x16b2,
+	    0x47fb, 0x3e1b, 0x0f9f, 0x1204, 0x16be, 0x0c22, 0x0000, 0x2573,
+	    0x3d10, 0x2f29, 0x3c2b, 0x0000, 0x3870, 0x0000, 0x0000, 0x0c5a,
+	    0x4107, 0x0000, 0x0000, 0x0000, 0x1d6e, 0x30af, 0x0000, 0x1c71,
+	    0x0000, 0x16d2, 0x0000, 0x1787, 0x0b0a, 0x0000, 0x2496, 0x0000,
+	    0x0007, 0x0d90, 0x30d9, 0x0000, 0x3a84, 0x190a, 0x0000, 0x2d9b,
+	    0x4ab9, 0x0000, 0x265c, 0x1acd, 0x2663, 0x1f26, 0x0000, 0x2548,
+	    0x42a2, 0x0000, 0x0dc3, 0x0000, 0x0000, 0x2e4c, 0x2f90, 0x0000,
+	    0x1202, 0x2400, 0x3807, 0x2a37, 0x2adf, 0x3e71, 0x339a, 0x07ab,
+	    0x1970, 0x2589, 0x4b58, 0x0000, 0x2554, 0x4d01, 0x1a27, 0x4212,
+	    0x0000, 0x45c8, 0x29c7, 0x0000, 0x2e09, 0x051c, 0x0772, 0x10c7,
+	    0x20e7, 0x36b7, 0x1a5e, 0x0000, 0x0000, 0x4816, 0x0000, 0x1902,
+	    0x2275, 0x47d2, 0x29d7, 0x0171, 0x0c52, 0x2193, 0x0000, 0x0deb,
+	    0x0736, 0x3c2f, 0x0209, 0x4e06, 0x1125, 0x0000, 0x152d, 0x0000,
+	    0x0335, 0x2277, 0x37f4, 0x0000, 0x2081, 0x3fae, 0x0bad, 0x4aa5,
+	    0x1ff6, 0x4a99, 0x31b8, 0x4d09, 0x1f82, 0x39e2, 0x3bf0, 0x04e6,
+	    0x0000, 0x0a2a, 0x192f, 0x42dd, 0x0000, 0x2b2b, 0x1c3d, 0x0219,
+	    0x2fcb, 0x17c6, 0x0abc, 0x0000, 0x4c1c, 0x0000, 0x3902, 0x1aa7,
+	    0x4487, 0x3bac, 0x3e61, 0x0ef0, 0x1088, 0x0757, 0x3b83, 0x0171,
+	    0x457d, 0x0000, 0x4939, 0x4b77, 0x44be, 0x0000, 0x1a59, 0x0000,
+	    0x1ef1, 0x061e, 0x2b56, 0x268f, 0x0093, 0x2e36, 0x0000, 0x4527,
+	    0x0468, 0x0d31, 0x25df, 0x03d8, 0x3cc3, 0x05a3, 0x25b8, 0x47e6,
+	    0x0000, 0x0f11, 0x123c, 0x30cb, 0x4e0d, 0x0000, 0x1e75, 0x3459,
+	    0x3951, 0x0000, 0x3cc8, 0x4e16, 0x3007, 0x0000, 0x4583, 0x2909,
+	    0x015e, 0x4b9b, 0x27da, 0x2fa9, 0x2f34, 0x4067, 0x0000, 0x124b,
+	    0x055f, 0x0000, 0x3d2d, 0x0771, 0x1ee5, 0x0f98, 0x0000, 0x3f45,
+	    0x0bb1, 0x44ad, 0x0000, 0x43cf, 0x31fd, 0x0000, 0x0119, 0x0000,
+	    0x1c5b, 0x3f9a, 0x0000, 0x1a09, 0x2bd4, 0x07e0, 0x0355, 0x0000,
+	    0x0000, 0x07e8, 0x055b, 0x02de, 0x1898, 0x4935, 0x1e91, 0x21b5,
+	    0x0000, 0x054f, 0x0000, 0x0000, 0x2553, 0x2e5f, 0x0000, 0x2167,
+	    0x3ddc, 0x0000, 0x2cab, 0x0000, 0x1d1f, 0x0f98, 0x21c0, 0x38d2,
+	    0x32d8, 0x1a5f, 0x0000, 0x11f9, 0x3f27, 0x0000, 0x0000, 0x0000,
+	    0x40da, 0x27f1, 0x1734, 0x2304, 0x3786, 0x0000, 0x0000, 0x0964,
+	    0x0cc3, 0x41fb, 0x0000, 0x0000, 0x3112, 0x0000, 0x0000, 0x1018,
+	    0x0000, 0x4743, 0x2b82, 0x488c, 0x01da, 0x0000, 0x0000, 0x364a,
+	    0x05b8, 0x1545, 0x176e, 0x0000, 0x0f16, 0x0000, 0x3de8, 0x1b66,
+	    0x3a63, 0x0000, 0x38dc, 0x05b0, 0x39bf, 0x001d, 0x2f0c, 0x2bca,
+	    0x0000, 0x0000, 0x1f45, 0x3979, 0x3b56, 0x22d2, 0x12c9, 0x0c5a,
+	    0x4c60, 0x0000, 0x43b3, 0x0e37, 0x3cf8, 0x3a61, 0x0000, 0x0000,
+	    0x0a39, 0x4a06, 0x0c04, 0x3faf, 0x0d2d, 0x36d4, 0x1976, 0x0000,
+	    0x16c3, 0x37a4, 0x277d, 0x0dbd, 0x4c82, 0x46c8, 0x0000, 0x10a9,
+	    0x27ac, 0x0000, 0x196c, 0x45a9, 0x0c1f, 0x0000, 0x02a3, 0x35b8,
+	    0x0ad6, 0x0000, 0x2810, 0x2538, 0x482d, 0x4d01, 0x1ec8, 0x10d6,
+	    0x0000, 0x2670, 0x3b76, 0x20ce, 0x3dfc, 0x0798, 0x1977, 0x05d6,
+	    0x253f, 0x4e0b, 0x27cf, 0x2105, 0x0000, 0x0000, 0x01b6, 0x09a1,
+	    0x47ca, 0x09a4, 0x0000, 0x1c0e, 0x2630, 0x06ce, 0x0812, 0x3fa4,
+	    0x0800, 0x266a, 0x0ddb, 0x0000, 0x216f, 0x11b4, 0x0000, 0x0151,
+	    0x0d89, 0x478f, 0x477a, 0x0276, 0x0084, 0x22c4, 0x1378, 0x3bf5,
+	    0x0000, 0x01b3, 0x2431, 0x16fc, 0x0c48, 0x05cb, 0x2f80, 0x23a3,
+	    0x0000, 0x4984, 0x3f56, 0x2c14, 0x2b2d, 0x19b4, 0x0fa7, 0x44e3,
+	    0x08d1, 0x3471, 0x3496, 0x24ec, 0x01ba, 0x48c9, 0x4570, 0x3956,
+	    0x4772, 0x1a03, 0x22d4, 0x0918, 0x0000, 0x3a82, 0x0000, 0x45e5,
+	    0x3243, 0x29e8, 0x0000, 0x4006, 0x2a19, 0x0000, 0x2046, 0x2e2f,
+	    0x1332, 0x26c5, 0x085d, 0x1852, 0x0000, 0x0000, 0x0000, 0x031b,
+	    0x1a34, 0x261b, 0x2226, 0x2e84, 0x0000, 0x47f8, 0x4703, 0x0bcc,
+	    0x3dc8, 0x0000, 0x3b64, 0x3337, 0x3827, 0x2217, 0x0000, 0x1ba1,
+	    0x439e, 0x0000, 0x0d0b, 0x2dd7, 0x1f6d, 0x0000, 0x0000, 0x0000,
+	    0x352a, 0x3ee0, 0x2aa5, 0x0cbd, 0x099f, 0x0000, 0x4629, 0x0e3b,
+	    0x2edc, 0x1420, 0x1839, 0x3bdf, 0x44be, 0x23e9, 0x0000, 0x0000,
+	    0x00f9, 0x11de, 0x19ae, 0x06fb, 0x0000, 0x0fa8, 0x4b7b, 0x4839,
+	    0x0000, 0x3464, 0x0000, 0x0000, 0x363a, 0x071d, 0x04de, 0x06f8,
+	    0x4750, 0x49db, 0x24d4, 0x0183, 0x0be3, 0x3988, 0x2b69, 0x4be6,
+	    0x3ea5, 0x0243, 0x0000, 0x01d8, 0x1ece, 0x218d, 0x0a6a, 0x0000,
+	    0x2256, 0x40a7, 0x0ba9, 0x3e7a, 0x0000, 0x44c8, 0x3625, 0x0959,
+	    0x0935, 0x2d66, 0x3a59, 0x0361, 0x2ed6, 0x3e9d, 0x229d, 0x46fb,
+	    0x0000, 0x241c, 0x37e0, 0x218b, 0x0000, 0x3cfc, 0x0000, 0x0000,
+	    0x0327, 0x08ef, 0x4919, 0x1812, 0x0000, 0x1b97, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x15a9, 0x0000, 0x327d, 0x2b10,
+	    0x1cad, 0x1960, 0x1d75, 0x0bb3, 0x46f4, 0x0000, 0x2b40, 0x0000,
+	    0x23a7, 0x108b, 0x0000, 0x1bdf, 0x3ce2, 0x3084, 0x3d6c, 0x1e54,
+	    0x08c1, 0x0000, 0x0000, 0x0000, 0x2229, 0x0000, 0x0000, 0x46c3,
+	    0x4431, 0x1b2c, 0x057f, 0x19ea, 0x127f, 0x0000, 0x30b3, 0x3d91,
+	    0x0251, 0x1493, 0x2768, 0x4d9c, 0x2d33, 0x0169, 0x3247, 0x1652,
+	    0x0000, 0x3dd9, 0x15ec, 0x1bca, 0x34f0, 0x0000, 0x2306, 0x39f9,
+	    0x2e2b, 0x0000, 0x36ef, 0x16b9, 0x077c, 0x0000, 0x34a1, 0x4d45,
+	    0x19c2, 0x11ed, 0x2a25, 0x104b, 0x3209, 0x23ce, 0x245d, 0x325c,
+	    0x0000, 0x0000, 0x03a2, 0x0000, 0x10e6, 0x0020, 0x0e89, 0x0000,
+	    0x0000, 0x0000, 0x39dd, 0x0000, 0x0000, 0x403c, 0x035c, 0x2f08,
+	    0x245c, 0x0000, 0x0000, 0x3742, 0x14b1, 0x1e0c, 0x0000, 0x0cbc,
+	    0x30d1, 0x0000, 0x0000, 0x0000, 0x316b, 0x3bf9, 0x078e, 0x4431,
+	    0x1952, 0x0000, 0x264d, 0x0000, 0x2dee, 0x3262, 0x1433, 0x3749,
+	    0x27a3, 0x4b7d, 0x4955, 0x4971, 0x0000, 0x4af5, 0x1cf3, 0x2103,
+	    0x0000, 0x1850, 0x39c3, 0x4a68, 0x26dc, 0x43d2, 0x1634, 0x4bff,
+	    0x0000, 0x0000, 0x30b7, 0x17e9, 0x2a9a, 0x0976, 0x46d9, 0x0000,
+	    0x495e, 0x0000, 0x215f, 0x282c, 0x0eb5, 0x0000, 0x0000, 0x1d52,
+	    0x3008, 0x0b6e, 0x01d0, 0x303d, 0x2803, 0x45e1, 0x0000, 0x27ed,
+	    0x0000, 0x0845, 0x2b7c, 0x35dd, 0x47f8, 0x0000, 0x4617, 0x0edb,
+	    0x0000, 0x13dd, 0x25ed, 0x2e3e, 0x005b, 0x0475, 0x4bf3, 0x0000,
+	    0x4e15, 0x4cd2, 0x0ea8, 0x01e9, 0x3daf, 0x3c36, 0x251f, 0x0000,
+	    0x4020, 0x0000, 0x0000, 0x0000, 0x397e, 0x35ea, 0x4c0f, 0x1551,
+	    0x1e53, 0x0000, 0x1d0c, 0x45c8, 0x0000, 0x0000, 0x1389, 0x3ef0,
+	    0x085e, 0x2719, 0x16f5, 0x10c6, 0x325c, 0x0000, 0x0207, 0x359c,
+	    0x0000, 0x43fc, 0x08b1, 0x47a7, 0x17b2, 0x0000, 0x1c29, 0x026e,
+	    0x29ad, 0x30b9, 0x0000, 0x18ef, 0x33ea, 0x0000, 0x0469, 0x2ab6,
+	    0x15d7, 0x06cc, 0x03e6, 0x0000, 0x4a47, 0x426d, 0x0000, 0x344e,
+	    0x1037, 0x0000, 0x0000, 0x2e30, 0x0000, 0x1b11, 0x12c8, 0x4d10,
+	    0x3a88, 0x0000, 0x0000, 0x0000, 0x00da, 0x2e0b, 0x07c4, 0x48d7,
+	    0x1034, 0x0533, 0x0000, 0x29d8, 0x4c98, 0x334c, 0x0813, 0x391a,
+	    0x098a, 0x0000, 0x18ff, 0x497b, 0x0000, 0x43b9, 0x0000, 0x28f9,
+	    0x4b90, 0x35e4, 0x0800, 0x0000, 0x13de, 0x16fe, 0x0000, 0x1848,
+	    0x07df, 0x2fab, 0x1b32, 0x4b57, 0x173b, 0x1aff, 0x4039, 0x44e4,
+	    0x0000, 0x3561, 0x3cc0, 0x0000, 0x4c5a, 0x057f, 0x40ea, 0x0a7a,
+	    0x4be0, 0x0000, 0x0000, 0x3cdd, 0x0000, 0x1260, 0x0c73, 0x1494,
+	    0x30a5, 0x1afb, 0x1fef, 0x0325, 0x385e, 0x0000, 0x0000, 0x20bd,
+	    0x44fc, 0x0ed1, 0x0b68, 0x3112, 0x0000, 0x0a86, 0x1aa5, 0x0000,
+	    0x0945, 0x16ed, 0x161a, 0x01ed, 0x0000, 0x0000, 0x0000, 0x127f,
+	    0x090b, 0x0000, 0x0000, 0x0882, 0x0000, 0x0000, 0x1937, 0x0bd0,
+	    0x1f74, 0x15ff, 0x4014, 0x03b3, 0x0000, 0x0000, 0x0000, 0x466b,
+	    0x23b9, 0x24e8, 0x0a7e, 0x3586, 0x311e, 0x0000, 0x2c9c, 0x41eb,
+	    0x43bd, 0x3fe4, 0x0000, 0x38b8, 0x1c8a, 0x149f, 0x162d, 0x43ab,
+	    0x0000, 0x0336, 0x0273, 0x3025, 0x4cf3, 0x4469, 0x0b6f, 0x13f6,
+	    0x3162, 0x310e, 0x0000, 0x3809, 0x34fd, 0x3028, 0x10ec, 0x0000,
+	    0x144e, 0x0000, 0x2e59, 0x0c77, 0x490b, 0x01ef, 0x350a, 0x2552,
+	    0x4b02, 0x2ab3, 0x29d5, 0x0000, 0x0000, 0x0000, 0x1892, 0x40bb,
+	    0x0000, 0x153b, 0x3117, 0x1cce, 0x0000, 0x0000, 0x21d5, 0x0000,
+	    0x0000, 0x0000, 0x2dd3, 0x251a, 0x29b9, 0x0000, 0x1250, 0x17bf,
+	    0x0598, 0x114b, 0x12f9, 0x375a, 0x262d, 0x3960, 0x0000, 0x0000,
+	    0x09eb, 0x0000, 0x368c, 0x2ca8, 0x4685, 0x0000, 0x0000, 0x0000,
+	    0x12c3, 0x0000, 0x056f, 0x4740, 0x1b92, 0x1b41, 0x4a7e, 0x2392,
+	    0x0000, 0x0170, 0x0000, 0x3306, 0x0000, 0x1137, 0x3c0f, 0x4678,
+	    0x243f, 0x2998, 0x323a, 0x36bb, 0x0803, 0x0c03, 0x401c, 0x3ab8,
+	    0x0000, 0x0213, 0x0000, 0x0000, 0x0000, 0x385e, 0x19b1, 0x0000,
+	    0x1f44, 0x0000, 0x28f7, 0x07e4, 0x0000, 0x05da, 0x12a7, 0x139a,
+	    0x0000, 0x02eb, 0x0099, 0x0023, 0x0edd, 0x0000, 0x3e59, 0x0000,
+	    0x33fb, 0x0000, 0x0000, 0x4c28, 0x1875, 0x2998, 0x1985, 0x0000,
+	    0x0a8b, 0x0996, 0x0b48, 0x42dd, 0x0000, 0x1a05, 0x0000, 0x40a4,
+	    0x0000, 0x0000, 0x0000, 0x3df3, 0x0000, 0x1243, 0x410b, 0x089e,
+	    0x256a, 0x4120, 0x0000, 0x2d71, 0x27ca, 0x3ad4, 0x0000, 0x0000,
+	    0x4bdf, 0x0000, 0x0cb7, 0x192a, 0x31fd, 0x0000, 0x4468, 0x1c65,
+	    0x2880, 0x0000, 0x3236, 0x268c, 0x3d32, 0x14af, 0x0000, 0x0000,
+	    0x3fae, 0x0704, 0x3ecd, 0x4bee, 0x0000, 0x4dad, 0x3c22, 0x0947,
+	    0x4d98, 0x0000, 0x1461, 0x27ab, 0x4832, 0x0000, 0x4cfa, 0x1d20,
+	    0x0000, 0x3e38, 0x1ef8, 0x09ba, 0x2dc4, 0x0000, 0x0000, 0x1264,
+	    0x07c0, 0x0000, 0x0000, 0x1305, 0x4b31, 0x25b4, 0x0977, 0x0000,
+	    0x484a, 0x4c3e, 0x492c, 0x2838, 0x0d35, 0x1be4, 0x1314, 0x4a8a,
+	    0x4d01, 0x25e9, 0x28ca, 0x15bf, 0x3b17, 0x2335, 0x0000, 0x4d2f,
+	    0x0000, 0x4e1f, 0x1d17, 0x438f, 0x10e6, 0x18c4, 0x141e, 0x0515,
+	    0x0000, 0x1c81, 0x34cd, 0x117b, 0x4bde, 0x2429, 0x1211, 0x03ef,
+	    0x0000, 0x0000, 0x06a8, 0x4d39, 0x14f4, 0x1a6c, 0x4be9, 0x345c,
+	    0x3d56, 0x11e1, 0x4b28, 0x4414, 0x45e2, 0x06ab, 0x34da, 0x0000,
+	    0x160d, 0x0000, 0x0135, 0x3b39, 0x0000, 0x22bc, 0x0000, 0x0977,
+	    0x0000, 0x25af, 0x0000, 0x1a20, 0x0eab, 0x0000, 0x0157, 0x1e45,
+	    0x3db0, 0x041b, 0x3cf4, 0x18b3, 0x0000, 0x3c25, 0x0369, 0x4057,
+	    0x09db, 0x3ea1, 0x0000, 0x073f, 0x1197, 0x0000, 0x2575, 0x15d4,
+	    0x0000, 0x4a74, 0x4e0a, 0x3d62, 0x304e, 0x0717, 0x3141, 0x3ece,
+	    0x38ba, 0x2cd4, 0x0000, 0x187f, 0x4833, 0x2d31, 0x0000, 0x39e3,
+	    0x32e7, 0x18ba, 0x2d17, 0x0000, 0x0e4e, 0x42e7, 0x2ad9, 0x0000,
+	    0x0c8b, 0x3c20, 0x3248, 0x0000, 0x283b, 0x0000, 0x20d3, 0x0000,
+	    0x0000, 0x1676, 0x0000, 0x4572, 0x370c, 0x0000, 0x0373, 0x0000,
+	    0x29a1, 0x0000, 0x0000, 0x1a8b, 0x0000, 0x2539, 0x3f48, 0x0000,
+	    0x38fb, 0x0000, 0x4cc4, 0x2482, 0x4bfc, 0x3c71, 0x1bfe, 0x3f9e,
+	    0x0000, 0x110e, 0x4933, 0x391d, 0x041b, 0x4650, 0x2dc0, 0x0aa2,
+	    0x2888, 0x0000, 0x0490, 0x0ad9, 0x0000, 0x0a5f, 0x3464, 0x0000,
+	    0x0000, 0x3241, 0x001f, 0x33da, 0x0000, 0x006c, 0x33d7, 0x49a8,
+	    0x26cc, 0x1527, 0x3c42, 0x0000, 0x42f7, 0x0878, 0x4a29, 0x3bc7,
+	    0x0000, 0x3ee6, 0x0000, 0x0000, 0x3b03, 0x2d5c, 0x16a6, 0x0000,
+	    0x1e7e, 0x499d, 0x13b8, 0x04b4, 0x0000, 0x0000, 0x37dd, 0x3ca4,
+	    0x0000, 0x0000, 0x20f8, 0x0548, 0x03e1, 0x3c08, 0x3740, 0x2f0a,
+	    0x0000, 0x1883, 0x0000, 0x1652, 0x4143, 0x14f4, 0x0c0d, 0x0000,
+	    0x3e1c, 0x4837, 0x486d, 0x0000, 0x35a9, 0x2d62, 0x4c89, 0x0000,
+	    0x129e, 0x1ebd, 0x34f7, 0x0192, 0x238b, 0x438f, 0x22f4, 0x4b89,
+	    0x4237, 0x1f86, 0x0000, 0x0000, 0x23bf, 0x0f34, 0x0000, 0x06c7,
+	    0x0000, 0x30b4, 0x1258, 0x3895, 0x071d, 0x0000, 0x3192, 0x4af5,
+	    0x3868, 0x0000, 0x2b1b, 0x2280, 0x0000, 0x4a43, 0x0000, 0x43d4,
+	    0x43da, 0x137f, 0x0000, 0x3c80, 0x4c04, 0x4b9a, 0x2b66, 0x252e,
+	    0x31c9, 0x0000, 0x35bc, 0x0000, 0x3fe3, 0x0000, 0x3829, 0x27ea,
+	    0x0e4a, 0x0000, 0x2926, 0x14ee, 0x1621, 0x49d8, 0x0000, 0x4ba2,
+	    0x0000, 0x255c, 0x0000, 0x3046, 0x19de, 0x1a0d, 0x0000, 0x0000,
+	    0x0a0f, 0x05d0, 0x222d, 0x0da9, 0x434e, 0x1bc0, 0x1ff0, 0x0000,
+	    0x1410, 0x10bc, 0x23fd, 0x0000, 0x0000, 0x0000, 0x0e7d, 0x3da0,
+	    0x0000, 0x0000, 0x2559, 0x0000, 0x1916, 0x2ada, 0x3959, 0x3f50,
+	    0x1f06, 0x38c1, 0x0000, 0x2eef, 0x128a, 0x0000, 0x3fc0, 0x0000,
+	    0x1b26, 0x4d13, 0x3ad7, 0x0000, 0x01b4, 0x0000, 0x4313, 0x24c8,
+	    0x2199, 0x0000, 0x211f, 0x2384, 0x1d48, 0x3c65, 0x3330, 0x0000,
+	    0x0000, 0x1922, 0x0000, 0x0000, 0x3d4d, 0x0000, 0x46ca, 0x0000,
+	    0x3541, 0x3052, 0x0000, 0x0ba3, 0x066a, 0x266c, 0x0000, 0x0d87,
+	    0x060f, 0x2f97, 0x393a, 0x42be, 0x0a74, 0x3460, 0x199f, 0x3620,
+	    0x0f57, 0x3b1b, 0x2559, 0x3c1e, 0x0000, 0x1567, 0x0e6c, 0x08a8,
+	    0x0000, 0x0000, 0x109f, 0x1a28, 0x234e, 0x44d5, 0x3b01, 0x1f23,
+	    0x0000, 0x249f, 0x0c36, 0x23a9, 0x1f5e, 0x4279, 0x150b, 0x1437,
+	    0x0000, 0x1bc1, 0x4b71, 0x10e9, 0x0000, 0x36cd, 0x05f2, 0x0000,
+	    0x1c2f, 0x34ac, 0x0000, 0x0000, 0x2270, 0x3a7e, 0x0000, 0x396d,
+	    0x0000, 0x3417, 0x19da, 0x0000, 0x19dd, 0x2308, 0x025a, 0x47da,
+	    0x2861, 0x3269, 0x0000, 0x09cf, 0x0992, 0x1caf, 0x3b78, 0x0dcc,
+	    0x4619, 0x0335, 0x45cc, 0x315c, 0x3d80, 0x09b5, 0x0ee7, 0x3ceb,
+	    0x2d2e, 0x0a61, 0x0f99, 0x1dda, 0x354a, 0x2639, 0x04c5, 0x3e3d,
+	    0x0b8a, 0x3c73, 0x0fc2, 0x314a, 0x0768, 0x0000, 0x37f0, 0x266d,
+	    0x40a6, 0x3270, 0x0000, 0x467f, 0x4908, 0x3dac, 0x47a5, 0x2b09,
+	    0x27f7, 0x0000, 0x0000, 0x23f4, 0x01c4, 0x3bc4, 0x1dda, 0x40bd,
+	    0x1d6a, 0x3660, 0x2765, 0x3c51, 0x0000, 0x0416, 0x0000, 0x4653,
+	    0x17c5, 0x0000, 0x0000, 0x2c2b, 0x1e32, 0x474c, 0x0a8a, 0x276d,
+	    0x2ab8, 0x4aff, 0x310f, 0x0000, 0x0df4, 0x3caa, 0x0000, 0x0000,
+	    0x1991, 0x4cc7, 0x2419, 0x2f75, 0x0000, 0x35e6, 0x4461, 0x1ab4,
+	    0x4180, 0x3f0b, 0x0000, 0x3762, 0x0000, 0x312f, 0x14e1, 0x1dbd,
+	    0x4969, 0x4b09, 0x0000, 0x000f, 0x0000, 0x0d43, 0x47be, 0x23c4,
+	    0x0000, 0x1f0d, 0x2d71, 0x2ba3, 0x419d, 0x2746, 0x1799, 0x3926,
+	    0x0bf8, 0x1d0b, 0x1bd1, 0x4ae4, 0x04bd, 0x422a, 0x4a24, 0x036e,
+	    0x2389, 0x44ae, 0x161a, 0x0000, 0x4d9c, 0x0000, 0x0000, 0x02bf,
+	    0x287b, 0x0000, 0x3b7a, 0x0000, 0x3bf1, 0x2395, 0x0000, 0x0000,
+	    0x19fc, 0x096c, 0x0000, 0x18cd, 0x0682, 0x4b47, 0x0000, 0x42b3,
+	    0x1a8f, 0x0000, 0x2435, 0x1e37, 0x3179, 0x373e, 0x0000, 0x0000,
+	    0x03a8, 0x283b, 0x0000, 0x0000, 0x0000, 0x4728, 0x4d6b, 0x4336,
+	    0x0000, 0x4a19, 0x15f4, 0x475f, 0x293b, 0x3edc, 0x415e, 0x1048,
+	    0x2982, 0x05fc, 0x0297, 0x3014, 0x1d80, 0x3c66, 0x0000, 0x0000,
+	    0x3da5, 0x1b7c, 0x0cac, 0x0000, 0x1a4a, 0x0b19, 0x11f6, 0x2de7,
+	    0x388b, 0x3825, 0x4d9b, 0x024e, 0x0000, 0x246d, 0x303a, 0x4650,
+	    0x0000, 0x32b8, 0x0000, 0x39cb, 0x0000, 0x0d71, 0x1c12, 0x32e7,
+	    0x1dfc, 0x08c5, 0x18a8, 0x0000, 0x4cc9, 0x2bff, 0x274e, 0x3c45,
+	    0x3d74, 0x0000, 0x3def, 0x084a, 0x13e2, 0x286a, 0x497c, 0x49ec,
+	    0x1da5, 0x1250, 0x050e, 0x01af, 0x3238, 0x0000, 0x07c2, 0x1528,
+	    0x4d71, 0x0000, 0x0000, 0x17f5, 0x155c, 0x330a, 0x0000, 0x0d34,
+	    0x196b, 0x3cc0, 0x0e1b, 0x0000, 0x0000, 0x0000, 0x0356, 0x3d69,
+	    0x0327, 0x4552, 0x323c, 0x082c, 0x04d8, 0x4d77, 0x31e7, 0x470e,
+	    0x3b02, 0x0c6f, 0x3a8f, 0x3341, 0x04b4, 0x259b, 0x3dbb, 0x1c38,
+	    0x0000, 0x32ab, 0x426d, 0x07dc, 0x0868, 0x0000, 0x222d, 0x0000,
+	    0x091f, 0x093f, 0x4959, 0x01ed, 0x1881, 0x02cf, 0x3c06, 0x35d0,
+	    0x0000, 0x466d, 0x0000, 0x40c0, 0x22b8, 0x0000, 0x321a, 0x468c,
+	    0x18bc, 0x1a3a, 0x018b, 0x07eb, 0x3013, 0x08f8, 0x0000, 0x47ec,
+	    0x38f0, 0x0000, 0x4a9c, 0x0bfe, 0x45c6, 0x0000, 0x3667, 0x0286,
+	    0x0530, 0x30e6, 0x0ce2, 0x4d66, 0x0a35, 0x1520, 0x4893, 0x0000,
+	    0x26de, 0x0000, 0x0fa4, 0x2e7b, 0x124f, 0x49f1, 0x4403, 0x4622,
+	    0x25e3, 0x0c58, 0x0000, 0x0000, 0x3e25, 0x168e, 0x012f, 0x2b73,
+	    0x391f, 0x0000, 0x2349, 0x0000, 0x0e98, 0x26f6, 0x491c, 0x1157,
+	    0x30d6, 0x0000, 0x0000, 0x19a1, 0x19f9, 0x118e, 0x1048, 0x1985,
+	    0x1695, 0x0000, 0x4b3f, 0x45c9, 0x0000, 0x12bb, 0x4853, 0x0000,
+	    0x13e9, 0x1268, 0x32a7, 0x344c, 0x399c, 0x4a79, 0x4de8, 0x4971,
+	    0x0000, 0x0000, 0x2acb, 0x027b, 0x15cc, 0x4814, 0x18eb, 0x0000,
+	    0x0000, 0x0738, 0x0000, 0x1369, 0x307b, 0x0000, 0x1216, 0x0000,
+	    0x0000, 0x124d, 0x17a4, 0x1f15, 0x0000, 0x0000, 0x2f2f, 0x0991,
+	    0x3f2c, 0x4339, 0x1e19, 0x0478, 0x11ef, 0x0000, 0x1415, 0x09cf,
+	    0x0000, 0x27e7, 0x0da7, 0x0000, 0x0244, 0x1d20, 0x1c3b, 0x0000,
+	    0x19bf, 0x3e0f, 0x0f7e, 0x49d3, 0x3771, 0x2ce6, 0x2fbd, 0x2969,
+	    0x0000, 0x17c8, 0x0204, 0x1f04, 0x0d18, 0x014f, 0x318d, 0x23d9,
+	    0x0000, 0x0000, 0x0bb1, 0x2d61, 0x3940, 0x0000, 0x1382, 0x0000,
+	    0x3787, 0x2827, 0x47aa, 0x0000, 0x0000, 0x1c7c, 0x099a, 0x4948,
+	    0x0934, 0x274f, 0x2e25, 0x277b, 0x0000, 0x1546, 0x1341, 0x317f,
+	    0x0797, 0x2f59, 0x271f, 0x0000, 0x4402, 0x4d19, 0x2917, 0x06ba,
+	    0x0000, 0x1973, 0x3ac0, 0x0569, 0x2345, 0x2a16, 0x3f2d, 0x31c5,
+	    0x2c20, 0x0000, 0x26d5, 0x397f, 0x36d3, 0x4482, 0x0448, 0x139f,
+	    0x3c6a, 0x4061, 0x0000, 0x2672, 0x2a48, 0x3e17, 0x243f, 0x0008,
+	    0x4915, 0x1234, 0x1b95, 0x451e, 0x13d4, 0x390b, 0x04cf, 0x013b,
+	    0x3b9b, 0x4b3f, 0x1b71, 0x0000, 0x4df8, 0x346e, 0x12f5, 0x11f4,
+	    0x2d6f, 0x1a3a, 0x292c, 0x18bb, 0x2957, 0x1f36, 0x0000, 0x08fd,
+	    0x2720, 0x2aa6, 0x1963, 0x3f0a, 0x055b, 0x04f7, 0x44a1, 0x0000,
+	    0x22f8, 0x3793, 0x39d6, 0x0000, 0x3ae7, 0x07fd, 0x2428, 0x24dd,
+	    0x2bcf, 0x0000, 0x1c69, 0x0305, 0x3f87, 0x1337, 0x0000, 0x236f,
+	    0x3f00, 0x48c1, 0x2c89, 0x05d3, 0x34fe, 0x0000, 0x4463, 0x054a,
+	    0x4b8a, 0x0000, 0x20aa, 0x4a96, 0x2fce, 0x3e13, 0x3223, 0x2ed3,
+	    0x1e9e, 0x22b2, 0x0000, 0x0000, 0x4a38, 0x1cb7, 0x0000, 0x0000,
+	    0x4000, 0x49ca, 0x4c5d, 0x12f1, 0x0000, 0x327c, 0x1103, 0x213c,
+	    0x0000, 0x34ac, 0x3f74, 0x0000, 0x3186, 0x0000, 0x1f8c, 0x0dae,
+	    0x44f5, 0x3fe0, 0x31f8, 0x286c, 0x3e9c, 0x1a5b, 0x2052, 0x34c7,
+	    0x0000, 0x1007, 0x47ae, 0x42af, 0x1993, 0x03dd, 0x0000, 0x220e,
+	    0x4300, 0x4c56, 0x201e, 0x0000, 0x3eb5, 0x4796, 0x3622, 0x4b14,
+	    0x0000, 0x15f9, 0x3195, 0x3fa9, 0x0000, 0x354b, 0x46a6, 0x3086,
+	    0x32d6, 0x0000, 0x03b3, 0x0000, 0x30b4, 0x1de6, 0x433f, 0x384f,
+	    0x31ce, 0x0000, 0x0000, 0x1663, 0x0000, 0x0000, 0x0000, 0x0a43,
+	    0x2bca, 0x3a37, 0x0bf5, 0x08fb, 0x3b1c, 0x1923, 0x453b, 0x2530,
+	    0x0000, 0x0000, 0x4499, 0x0000, 0x20d3, 0x0000, 0x0000, 0x14e0,
+	    0x1202, 0x22d0, 0x0000, 0x0075, 0x091c, 0x3282, 0x0000, 0x16e6,
+	    0x0000, 0x0000, 0x18d6, 0x3f17, 0x0000, 0x3563, 0x13ea, 0x0000,
+	    0x31d2, 0x081e, 0x00e1, 0x0d15, 0x0ee2, 0x0000, 0x0000, 0x468e,
+	    0x19a2, 0x249b, 0x1398, 0x3ae0, 0x218d, 0x418d, 0x0000, 0x26b1,
+	    0x2899, 0x11c5, 0x4c39, 0x20f0, 0x313d, 0x42da, 0x3210, 0x030d,
+	    0x0810, 0x0000, 0x0000, 0x0000, 0x4a31, 0x4329, 0x0ef0, 0x270f,
+	    0x10d1, 0x0651, 0x14fa, 0x0c5d, 0x3dd8, 0x1194, 0x40f2, 0x2801,
+	    0x2814, 0x3409, 0x1fed, 0x12b5, 0x31e6, 0x1520, 0x0000, 0x1e0b,
+	    0x10a8, 0x3802, 0x0737, 0x4ced, 0x4c46, 0x48ee, 0x2de6, 0x1ad9,
+	    0x307c, 0x0000, 0x0000, 0x0aa4, 0x455c, 0x0000, 0x38e2, 0x3ab4,
+	    0x11c5, 0x3772, 0x0000, 0x3888, 0x27b5, 0x3d8d, 0x1b7e, 0x0267,
+	    0x3887, 0x1f29, 0x2b7f, 0x0000, 0x1605, 0x4dc5, 0x09c8, 0x0803,
+	    0x2b0a, 0x0727, 0x3f6a, 0x29fe, 0x4133, 0x2b78, 0x0000, 0x3795,
+	    0x1d03, 0x0000, 0x06c6, 0x372f, 0x3cf4, 0x216c, 0x1874, 0x1600,
+	    0x08be, 0x0000, 0x1d0e, 0x2763, 0x40e3, 0x3bdf, 0x1c35, 0x1553,
+	    0x1dda, 0x445c, 0x26d3, 0x4127, 0x08b6, 0x0000, 0x12f9, 0x1e96,
+	    0x38cd, 0x4ddd, 0x1ddb, 0x22e2, 0x14a3, 0x105b, 0x3a98, 0x0000,
+	    0x0000, 0x0925, 0x4ce7, 0x30f6, 0x0000, 0x1bfd, 0x1162, 0x3df8,
+	    0x03b1, 0x229b, 0x4818, 0x3104, 0x1014, 0x49db, 0x4208, 0x1332,
+	    0x0000, 0x31f5, 0x0000, 0x391d, 0x367f, 0x31b3, 0x2d96, 0x0000,
+	    0x0d1f, 0x40ce, 0x2f1d, 0x26a3, 0x0ea5, 0x49e7, 0x0000, 0x0000,
+	    0x3c69, 0x0a56, 0x0000, 0x1f61, 0x1120, 0x2b20, 0x37aa, 0x09d2,
+	    0x1cd3, 0x2388, 0x0000, 0x128e, 0x3a77, 0x4640, 0x0000, 0x485e,
+	    0x3ecc, 0x0000, 0x247a, 0x42fc, 0x4196, 0x3a54, 0x33cb, 0x0000,
+	    0x41a8, 0x12c8, 0x42e1, 0x0ece, 0x0000, 0x4b78, 0x0aa4, 0x0467,
+	    0x0000, 0x25b3, 0x0000, 0x2619, 0x12a3, 0x2cc8, 0x0b96, 0x36c3,
+	    0x3284, 0x2ae9, 0x290f, 0x0000, 0x4386, 0x1ab5, 0x35c8, 0x4d1f,
+	    0x49a3, 0x0000, 0x0000, 0x093b, 0x0000, 0x0b5d, 0x1162, 0x3db4,
+	    0x1ba3, 0x1863, 0x18c5, 0x3b49, 0x0000, 0x43d6, 0x2ae8, 0x1db0,
+	    0x0422, 0x03b1, 0x08c0, 0x0000, 0x2f34, 0x0848, 0x0000, 0x0000,
+	    0x4668, 0x4733, 0x0000, 0x0157, 0x24a5, 0x0beb, 0x3056, 0x0000,
+	    0x0000, 0x00c7, 0x3a53, 0x0000, 0x0000, 0x0000, 0x0ea5, 0x0000,
+	    0x129f, 0x193a, 0x0000, 0x0090, 0x27e9, 0x0000, 0x2b48, 0x327d,
+	    0x0000, 0x0a98, 0x07dd, 0x0000, 0x26c4, 0x0000, 0x44d9, 0x0000,
+	    0x2fdb, 0x1aae, 0x34c1, 0x074e, 0x3520, 0x412b, 0x4d71, 0x36c5,
+	    0x3024, 0x17ee, 0x0f2d, 0x2652, 0x2c30, 0x010d, 0x0000, 0x0af2,
+	    0x3362, 0x0000, 0x3c4d, 0x1f21, 0x27f7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x355c, 0x42b6, 0x1879, 0x0000, 0x0000, 0x3f8e,
+	    0x0000, 0x080e, 0x4120, 0x0000, 0x38ab, 0x0000, 0x0dfe, 0x1596,
+	    0x3c50, 0x1a4c, 0x478c, 0x450e, 0x266d, 0x4bb4, 0x3a53, 0x4d38,
+	    0x1ce3, 0x4d3d, 0x1dfa, 0x33e8, 0x0000, 0x06a4, 0x25f2, 0x0000,
+	    0x0000, 0x3642, 0x3fbc, 0x1012, 0x1f7c, 0x0000, 0x2174, 0x0000,
+	    0x4c5b, 0x435a, 0x0685, 0x3022, 0x3ec5, 0x1edc, 0x2399, 0x3e4c,
+	    0x417a, 0x3758, 0x0000, 0x3ea2, 0x0000, 0x4294, 0x4c1f, 0x27de,
+	    0x0000, 0x0525, 0x3bbc, 0x1d5a, 0x04b6, 0x35d8, 0x48de, 0x0000,
+	    0x0acf, 0x0937, 0x1214, 0x0bac, 0x3cf2, 0x16ab, 0x0061, 0x2c98,
+	    0x33ec, 0x0000, 0x189e, 0x18c9, 0x3ea7, 0x2a8e, 0x0000, 0x3f15,
+	    0x3fbc, 0x0000, 0x15b1, 0x09cc, 0x0f9c, 0x3f91, 0x1af0, 0x34f0,
+	    0x17c6, 0x3f04, 0x4cc9, 0x2583, 0x2f19, 0x2db0, 0x0f06, 0x36ea,
+	    0x0000, 0x3e00, 0x0000, 0x33ab, 0x467a, 0x3471, 0x170f, 0x09fb,
+	    0x0a68, 0x3603, 0x0bee, 0x3405, 0x1faa, 0x0000, 0x3c1e, 0x0000,
+	    0x34ed, 0x2a77, 0x4976, 0x2299, 0x0000, 0x28ef, 0x0000, 0x4520,
+	    0x3ea0, 0x0000, 0x1579, 0x353d, 0x0000, 0x0000, 0x34bb, 0x0000,
+	    0x03b3, 0x4344, 0x1f7c, 0x40d1, 0x356b, 0x2c48, 0x3628, 0x0000,
+	    0x326b, 0x2a0c, 0x2ef5, 0x4a78, 0x0000, 0x44ee, 0x0000, 0x1bb8,
+	    0x4425, 0x0fc5, 0x0000, 0x0000, 0x185d, 0x0000, 0x39ee, 0x26e5,
+	    0x15ed, 0x4617, 0x4bdc, 0x0000, 0x0b7e, 0x0000, 0x1fc3, 0x4053,
+	    0x38be, 0x0000, 0x39fc, 0x3329, 0x23e0, 0x3087, 0x4c74, 0x0000,
+	    0x0000, 0x0000, 0x25da, 0x4a9b, 0x0000, 0x2096, 0x3c84, 0x3792,
+	    0x3396, 0x0534, 0x3488, 0x4572, 0x0000, 0x4019, 0x3194, 0x4db8,
+	    0x37b0, 0x0000, 0x2265, 0x4c8b, 0x0000, 0x2839, 0x41f9, 0x2cae,
+	    0x09fc, 0x1f7c, 0x23b2, 0x1fc0, 0x4303, 0x4659, 0x186e, 0x1735,
+	    0x322d, 0x19c0, 0x0000, 0x1c5f, 0x1512, 0x0000, 0x002e, 0x0000,
+	    0x134f, 0x0c5e, 0x09c0, 0x41f4, 0x0000, 0x381c, 0x0000, 0x1315,
+	    0x4414, 0x3c4e, 0x4b94, 0x0000, 0x072d, 0x2fcf, 0x2fa8, 0x47cb,
+	    0x151f, 0x363d, 0x0000, 0x00be, 0x1c7f, 0x0000, 0x4c15, 0x0000,
+	    0x0000, 0x0991, 0x0000, 0x3eaa, 0x0000, 0x4bcb, 0x446a, 0x1806,
+	    0x0000, 0x3005, 0x47fd, 0x085a, 0x0000, 0x1b00, 0x36b0, 0x0000,
+	    0x1eb0, 0x21c2, 0x1c15, 0x380f, 0x22db, 0x1906, 0x0dc7, 0x0000,
+	    0x0000, 0x2f1a, 0x0000, 0x0000, 0x183f, 0x0000, 0x0000, 0x0000,
+	    0x0a84, 0x0000, 0x4924, 0x3496, 0x0000, 0x4daa, 0x0000, 0x0a24,
+	    0x0000, 0x3c55, 0x0f1b, 0x1c01, 0x1feb, 0x1490, 0x07f8, 0x0000,
+	    0x1afb, 0x39b5, 0x1209, 0x0000, 0x1a67, 0x091f, 0x0000, 0x3b8b,
+	    0x1647, 0x0000, 0x0217, 0x0cef, 0x02ad, 0x47e0, 0x0000, 0x11ac,
+	    0x18ed, 0x1c8e, 0x0c34, 0x0588, 0x19e0, 0x2097, 0x0000, 0x166d,
+	    0x4437, 0x2e24, 0x0116, 0x4665, 0x0000, 0x0000, 0x05e8, 0x496a,
+	    0x0000, 0x3130, 0x0000, 0x3726, 0x28c9, 0x2415, 0x237e, 0x0c14,
+	    0x3cf4, 0x3e9e, 0x3511, 0x4743, 0x0000, 0x0000, 0x0000, 0x09f3,
+	    0x0a9a, 0x3cf8, 0x0000, 0x0000, 0x2bae, 0x1e9c, 0x0000, 0x4922,
+	    0x0000, 0x0000, 0x2a79, 0x00c3, 0x0000, 0x14fc, 0x29d3, 0x0000,
+	    0x3acc, 0x3ba6, 0x1ab3, 0x1735, 0x0000, 0x192a, 0x0242, 0x0199,
+	    0x3d3e, 0x23f9, 0x230b, 0x1dd0, 0x2fb6, 0x0000, 0x19b3, 0x2ab9,
+	    0x46cc, 0x22ad, 0x171d, 0x06a7, 0x3b38, 0x0000, 0x470b, 0x4bdc,
+	    0x275c, 0x3137, 0x0000, 0x2056, 0x176d, 0x4ae6, 0x1a64, 0x19b7,
+	    0x292c, 0x1ad1, 0x412d, 0x0000, 0x0000, 0x3d1f, 0x2b91, 0x442e,
+	    0x0f7a, 0x335c, 0x0000, 0x4712, 0x01f8, 0x0000, 0x1728, 0x0000,
+	    0x0000, 0x2dfb, 0x30d5, 0x3387, 0x0000, 0x317f, 0x0000, 0x3776,
+	    0x30bd, 0x47c8, 0x0000, 0x0000, 0x4169, 0x2305, 0x26e8, 0x259a,
+	    0x0578, 0x0259, 0x162f, 0x1425, 0x2f8d, 0x1d31, 0x0000, 0x237e,
+	    0x0000, 0x0000, 0x36ce, 0x2635, 0x331d, 0x2094, 0x10d7, 0x4160,
+	    0x0018, 0x0519, 0x4bd2, 0x2818, 0x0000, 0x2c79, 0x0000, 0x3eb8,
+	    0x30fb, 0x2591, 0x16b4, 0x2745, 0x0000, 0x4c11, 0x0000, 0x33bc,
+	    0x0000, 0x261e, 0x0000, 0x2a49, 0x3286, 0x3db4, 0x0f4f, 0x11e6,
+	    0x2894, 0x1435, 0x0000, 0x2c8e, 0x4003, 0x1fea, 0x35ab, 0x0000,
+	    0x12d3, 0x39a8, 0x0b1e, 0x339e, 0x2357, 0x3ea0, 0x0000, 0x019e,
+	    0x1230, 0x03de, 0x0000, 0x0000, 0x2245, 0x0000, 0x0000, 0x4859,
+	    0x286e, 0x2891, 0x2296, 0x3aac, 0x4913, 0x4b5b, 0x03c8, 0x0000,
+	    0x106b, 0x1f1b, 0x1399, 0x439e, 0x0000, 0x4cec, 0x1ffa, 0x0000,
+	    0x2059, 0x3075, 0x0000, 0x4b0a, 0x068f, 0x0000, 0x48aa, 0x1a8c,
+	    0x0000, 0x2c08, 0x2a78, 0x0b1a, 0x2e0e, 0x1c46, 0x20d7, 0x0000,
+	    0x0000, 0x2e05, 0x0000, 0x046f, 0x0c27, 0x2f16, 0x2770, 0x10d7,
+	    0x0a85, 0x0933, 0x4b9c, 0x3c1c, 0x3e95, 0x4708, 0x3f83, 0x0000,
+	    0x0000, 0x0000, 0x18c5, 0x0000, 0x4cbd, 0x1b03, 0x0000, 0x0000,
+	    0x1c73, 0x0000, 0x059a, 0x4350, 0x4c58, 0x076b, 0x3dd9, 0x2094,
+	    0x0000, 0x0fe6, 0x0000, 0x1d98, 0x2ddc, 0x3611, 0x463d, 0x2fa5,
+	    0x189a, 0x144a, 0x4826, 0x472f, 0x0000, 0x1245, 0x0000, 0x1ee8,
+	    0x2e6c, 0x4511, 0x0e30, 0x3c2a, 0x0000, 0x2921, 0x1f1a, 0x0d0a,
+	    0x21e3, 0x3f35, 0x14b3, 0x0000, 0x1551, 0x3b47, 0x0000, 0x0000,
+	    0x1693, 0x2cd3, 0x061b, 0x1f27, 0x4049, 0x0000, 0x40f0, 0x384e,
+	    0x0000, 0x1b9e, 0x0000, 0x0000, 0x045c, 0x01d2, 0x10cd, 0x1de0,
+	    0x2015, 0x26c8, 0x0ece, 0x0e18, 0x3749, 0x4a12, 0x38ca, 0x2b2e,
+	    0x0000, 0x0000, 0x3c69, 0x31df, 0x26d2, 0x35b5, 0x14e0, 0x1815,
+	    0x0000, 0x2f20, 0x3bb4, 0x0f57, 0x36c7, 0x4b34, 0x3b1a, 0x27c0,
+	    0x0000, 0x0591, 0x0000, 0x1512, 0x12da, 0x21d8, 0x0000, 0x29d8,
+	    0x2e2a, 0x0000, 0x2511, 0x02bd, 0x0a84, 0x48e7, 0x4ad1, 0x27ed,
+	    0x0000, 0x28d3, 0x06e3, 0x2ff6, 0x451c, 0x114b, 0x2194, 0x2f92,
+	    0x0000, 0x4b32, 0x0000, 0x2de5, 0x1334, 0x0000, 0x13c5, 0x0000,
+	    0x1989, 0x0000, 0x0000, 0x2ef9, 0x0000, 0x4c49, 0x2477, 0x2cca,
+	    0x2207, 0x0000, 0x0000, 0x0000, 0x3d78, 0x1f0e, 0x1ceb, 0x34ee,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1312, 0x0688, 0x1759, 0x0000,
+	    0x00b8, 0x0000, 0x1f41, 0x1069, 0x0000, 0x3ce4, 0x17b2, 0x4d59,
+	    0x07cd, 0x0000, 0x0000, 0x18e8, 0x1592, 0x21b0, 0x1ccc, 0x0000,
+	    0x14bb, 0x098d, 0x145c, 0x1045, 0x0000, 0x0000, 0x0ede, 0x47b9,
+	    0x1cc5, 0x2a50, 0x2942, 0x0000, 0x4134, 0x0211, 0x08f0, 0x0000,
+	    0x2a9e, 0x4c16, 0x2550, 0x2b13, 0x4203, 0x452f, 0x0000, 0x222b,
+	    0x3271, 0x27d0, 0x1269, 0x1c0c, 0x499e, 0x0000, 0x2af0, 0x08ee,
+	    0x3b0f, 0x1651, 0x162c, 0x0000, 0x0000, 0x356e, 0x0000, 0x334f,
+	    0x1a1d, 0x32eb, 0x1298, 0x278c, 0x0000, 0x3ccd, 0x1825, 0x17a9,
+	    0x27b1, 0x0bf5, 0x055f, 0x0000, 0x04fa, 0x17cc, 0x3a16, 0x2358,
+	    0x0f94, 0x2284, 0x0000, 0x0015, 0x01f3, 0x3219, 0x3a34, 0x0000,
+	    0x4950, 0x345d, 0x3116, 0x13eb, 0x16da, 0x16fa, 0x23b8, 0x490c,
+	    0x0341, 0x3168, 0x0210, 0x0000, 0x251f, 0x0000, 0x1654, 0x103a,
+	    0x1d1e, 0x4114, 0x0000, 0x326f, 0x0000, 0x4c96, 0x0000, 0x456a,
+	    0x0000, 0x2829, 0x2deb, 0x3c26, 0x0e19, 0x067c, 0x0000, 0x1887,
+	    0x0000, 0x168e, 0x4bbc, 0x4bfb, 0x187f, 0x0135, 0x0426, 0x026a,
+	    0x041a, 0x3e88, 0x4657, 0x280b, 0x44a9, 0x0000, 0x3b0a, 0x1ac3,
+	    0x208f, 0x0000, 0x276a, 0x2768, 0x1087, 0x0885, 0x10f6, 0x0000,
+	    0x1892, 0x298b, 0x381a, 0x1f63, 0x429a, 0x0000, 0x447a, 0x2246,
+	    0x0000, 0x3c08, 0x0000, 0x34f9, 0x257a, 0x0000, 0x3f96, 0x3bf9,
+	    0x2cfe, 0x0000, 0x02d7, 0x110a, 0x48c3, 0x46f6, 0x39e3, 0x4187,
+	    0x0000, 0x2922, 0x2784, 0x23e4, 0x178e, 0x2c92, 0x438d, 0x1286,
+	    0x0000, 0x365f, 0x4226, 0x0000, 0x3dd8, 0x243b, 0x072c, 0x379d,
+	    0x1d33, 0x1c65, 0x2dac, 0x0000, 0x0000, 0x2df1, 0x0000, 0x07a0,
+	    0x3d69, 0x2d6c, 0x4a2a, 0x3361, 0x0000, 0x4a24, 0x0b8f, 0x1916,
+	    0x16dd, 0x07eb, 0x0000, 0x0000, 0x0000, 0x479c, 0x2877, 0x2e4c,
+	    0x4ac7, 0x0f94, 0x156d, 0x2f64, 0x349c, 0x0dae, 0x1547, 0x2ccf,
+	    0x16bb, 0x12c6, 0x1ce0, 0x29f5, 0x15ef, 0x36dc, 0x2169, 0x178e,
+	    0x4512, 0x0000, 0x49b0, 0x008f, 0x2ebf, 0x386a, 0x1399, 0x25d3,
+	    0x4a2b, 0x0000, 0x36d6, 0x0000, 0x0c96, 0x0000, 0x0000, 0x0000,
+	    0x3eef, 0x0000, 0x1c2b, 0x3980, 0x0000, 0x0038, 0x4172, 0x35e1,
+	    0x0000, 0x4cdf, 0x0820, 0x0000, 0x2158, 0x1a1a, 0x1318, 0x441e,
+	    0x0512, 0x41f6, 0x2110, 0x4317, 0x0000, 0x0000, 0x0ac7, 0x0000,
+	    0x0000, 0x1830, 0x4771, 0x2cf4, 0x4060, 0x4283, 0x1641, 0x0000,
+	    0x4abd, 0x2124, 0x0000, 0x05a3, 0x0000, 0x0764, 0x0000, 0x0000,
+	    0x0000, 0x2e03, 0x14bc, 0x4dac, 0x0000, 0x2a9a, 0x0000, 0x0000,
+	    0x4a74, 0x0000, 0x3643, 0x30db, 0x2f85, 0x3314, 0x0000, 0x0000,
+	    0x0000, 0x08f0, 0x0000, 0x0ad3, 0x4349, 0x029d, 0x1ec8, 0x0000,
+	    0x0000, 0x0ea7, 0x145c, 0x3b69, 0x4b3f, 0x3c5e, 0x3819, 0x1885,
+	    0x17ca, 0x3d8e, 0x0000, 0x1170, 0x3743, 0x4beb, 0x4ac8, 0x247c,
+	    0x236e, 0x05c8, 0x0000, 0x3e3e, 0x0b71, 0x0b6f, 0x02eb, 0x33f6,
+	    0x2075, 0x0667, 0x04a8, 0x4dc8, 0x10da, 0x0000, 0x13b8, 0x0b22,
+	    0x25ab, 0x0000, 0x0000, 0x2345, 0x13ab, 0x3369, 0x3139, 0x0000,
+	    0x178b, 0x27bf, 0x0be0, 0x4cb0, 0x0fb7, 0x04ca, 0x0d2e, 0x474e,
+	    0x0629, 0x0cb0, 0x0000, 0x20a6, 0x3eea, 0x405c, 0x27c4, 0x3598,
+	    0x3b4a, 0x0000, 0x3735, 0x0245, 0x2ed3, 0x1484, 0x0822, 0x1073,
+	    0x425a, 0x0000, 0x25e7, 0x291f, 0x2941, 0x04ab, 0x1b8b, 0x21c0,
+	    0x1762, 0x184c, 0x2f58, 0x01c4, 0x4668, 0x011d, 0x3d45, 0x199b,
+	    0x494e, 0x2ba6, 0x2a08, 0x0000, 0x48ef, 0x2844, 0x3492, 0x476e,
+	    0x0000, 0x0000, 0x2791, 0x0cdd, 0x3a4c, 0x168a, 0x1069, 0x0c61,
+	    0x4ddf, 0x0b09, 0x37f2, 0x14fa, 0x43bf, 0x2937, 0x2698, 0x1c9e,
+	    0x18f0, 0x0000, 0x21ab, 0x3117, 0x0072, 0x23e1, 0x0000, 0x3e0e,
+	    0x2407, 0x3d18, 0x41c4, 0x33b2, 0x4748, 0x0000, 0x1e0b, 0x12f4,
+	    0x2501, 0x08f2, 0x46e5, 0x12ed, 0x0000, 0x10c1, 0x0da8, 0x4462,
+	    0x2f60, 0x0207, 0x17dc, 0x0612, 0x0000, 0x0000, 0x3947, 0x1cbb,
+	    0x38d7, 0x1878, 0x0000, 0x047b, 0x33fa, 0x0000, 0x0000, 0x0a17,
+	    0x0000, 0x04d0, 0x0000, 0x0000, 0x070a, 0x4956, 0x430b, 0x14ec,
+	    0x0000, 0x0000, 0x44ae, 0x3900, 0x458c, 0x3103, 0x01d7, 0x4941,
+	    0x2a1f, 0x4d21, 0x2aeb, 0x1134, 0x2ce9, 0x0000, 0x1cf1, 0x482e,
+	    0x160e, 0x0000, 0x482d, 0x33f8, 0x4145, 0x4543, 0x4ab1, 0x139c,
+	    0x1072, 0x0000, 0x2c39, 0x0000, 0x1416, 0x450a, 0x0000, 0x0000,
+	    0x1012, 0x2104, 0x052e, 0x43a9, 0x3d66, 0x0000, 0x2ff7, 0x3899,
+	    0x0000, 0x317f, 0x0000, 0x3bbc, 0x1b1e, 0x195c, 0x4b59, 0x1b69,
+	    0x01d3, 0x46f6, 0x43ad, 0x0000, 0x1fab, 0x2bb0, 0x44a9, 0x24d4,
+	    0x2f7d, 0x4bed, 0x48cc, 0x0000, 0x0000, 0x4a9b, 0x2e00, 0x4950,
+	    0x4887, 0x1f40, 0x2e4b, 0x2ab3, 0x0000, 0x0000, 0x3a40, 0x26f8,
+	    0x3ccb, 0x0000, 0x0000, 0x0000, 0x0000, 0x08f0, 0x20c0, 0x1bc6,
+	    0x3009, 0x4b6b, 0x113e, 0x05e5, 0x1267, 0x35f6, 0x0000, 0x2a84,
+	    0x4560, 0x266c, 0x0000, 0x0000, 0x0000, 0x3e76, 0x41ed, 0x178f,
+	    0x436a, 0x0000, 0x0638, 0x2cab, 0x3a42, 0x0000, 0x0993, 0x3c71,
+	    0x07ea, 0x3258, 0x0000, 0x23c6, 0x0000, 0x0000, 0x2644, 0x426e,
+	    0x0000, 0x3cc9, 0x2b76, 0x27eb, 0x0284, 0x2d79, 0x4273, 0x1457,
+	    0x0000, 0x0000, 0x231c, 0x45f6, 0x0a38, 0x11f6, 0x383c, 0x1a2a,
+	    0x38ae, 0x35e8, 0x1979, 0x0570, 0x22a8, 0x0000, 0x4c07, 0x3807,
+	    0x3145, 0x232a, 0x4c45, 0x28fb, 0x0000, 0x025f, 0x0000, 0x218a,
+	    0x1f14, 0x41ea, 0x2a08, 0x055d, 0x0000, 0x2560, 0x4d2d, 0x0000,
+	    0x41a8, 0x16c5, 0x0908, 0x4c43, 0x0000, 0x0000, 0x1ed5, 0x0d4c,
+	    0x0000, 0x0039, 0x35a7, 0x18da, 0x4b9d, 0x2015, 0x2c39, 0x0772,
+	    0x1fff, 0x3c2f, 0x211f, 0x3dda, 0x0000, 0x226e, 0x2f72, 0x3300,
+	    0x376d, 0x1632, 0x0f47, 0x4616, 0x0000, 0x07f0, 0x0ab9, 0x0757,
+	    0x42ee, 0x0000, 0x0000, 0x35f4, 0x4cae, 0x122a, 0x2bc9, 0x0000,
+	    0x0000, 0x1418, 0x0000, 0x455d, 0x0027, 0x0350, 0x2332, 0x2eee,
+	    0x0000, 0x3ea7, 0x3c13, 0x30b3, 0x0000, 0x0c5b, 0x248b, 0x3135,
+	    0x1d54, 0x0000, 0x0051, 0x0000, 0x09a4, 0x0000, 0x03e5, 0x36ee,
+	    0x4686, 0x0000, 0x45a6, 0x0000, 0x164f, 0x254c, 0x1b9c, 0x0000,
+	    0x2eac, 0x2162, 0x0000, 0x333e, 0x2d5d, 0x3823, 0x038a, 0x0000,
+	    0x0000, 0x22a8, 0x49c5, 0x03ec, 0x0000, 0x19eb, 0x2220, 0x4143,
+	    0x0000, 0x0c0a, 0x0332, 0x4b2f, 0x0000, 0x38a3, 0x414a, 0x25c4,
+	    0x0000, 0x2da7, 0x0f69, 0x14f3, 0x1e5c, 0x26c6, 0x4bd1, 0x06b9,
+	    0x2f90, 0x0000, 0x37ad, 0x0408, 0x0d99, 0x3489, 0x0000, 0x4309,
+	    0x04d1, 0x0c50, 0x0000, 0x007f, 0x1d22, 0x0000, 0x498d, 0x31de,
+	    0x2689, 0x2bb6, 0x469d, 0x4b2b, 0x0000, 0x25bd, 0x0000, 0x332d,
+	    0x46a6, 0x414f, 0x1d26, 0x02b2, 0x0c87, 0x2bbc, 0x1511, 0x0000,
+	    0x1f1d, 0x12f0, 0x3530, 0x3114, 0x291f, 0x0000, 0x2a26, 0x0000,
+	    0x0db1, 0x3186, 0x0000, 0x09db, 0x3099, 0x095e, 0x32ce, 0x2327,
+	    0x0000, 0x13cd, 0x266a, 0x192d, 0x3deb, 0x3f18, 0x2c07, 0x0000,
+	    0x3dbe, 0x312b, 0x39b8, 0x0000, 0x0277, 0x150a, 0x0777, 0x361f,
+	    0x0000, 0x10a0, 0x4d6f, 0x3f47, 0x0866, 0x0000, 0x46c9, 0x106c,
+	    0x3c72, 0x2def, 0x0000, 0x0a29, 0x0000, 0x1b69, 0x088b, 0x0eca,
+	    0x38d0, 0x2b48, 0x400f, 0x1fe6, 0x4200, 0x4805, 0x2092, 0x0000,
+	    0x2a2d, 0x0708, 0x22f1, 0x0000, 0x0000, 0x2cf3, 0x1226, 0x0000,
+	    0x2004, 0x02a2, 0x3bbf, 0x0000, 0x48cc, 0x0860, 0x4119, 0x0e3e,
+	    0x28b6, 0x06b4, 0x0000, 0x1ef9, 0x0000, 0x2eb0, 0x4d27, 0x0b4c,
+	    0x04c8, 0x1864, 0x467f, 0x2664, 0x0d87, 0x0000, 0x2919, 0x0000,
+	    0x1741, 0x356b, 0x1262, 0x38a4, 0x40ce, 0x2a66, 0x3203, 0x1526,
+	    0x31b2, 0x2f03, 0x2207, 0x3d3c, 0x1c82, 0x1e64, 0x394d, 0x4645,
+	    0x2788, 0x1e1e, 0x2635, 0x3632, 0x0dff, 0x2176, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x30ed, 0x112e, 0x0d11, 0x3b48, 0x38e6, 0x0000,
+	    0x41de, 0x1b03, 0x4472, 0x131b, 0x3356, 0x0000, 0x0000, 0x0000,
+	    0x2134, 0x032c, 0x0000, 0x0773, 0x3d13, 0x1de0, 0x050e, 0x0000,
+	    0x2b9d, 0x219c, 0x0c0d, 0x31ae, 0x0e42, 0x1182, 0x09af, 0x1c6a,
+	    0x3c50, 0x28b0, 0x0000, 0x398d, 0x0000, 0x11fa, 0x3df8, 0x18e9,
+	    0x3b8b, 0x31d3, 0x0000, 0x41f4, 0x308b, 0x3e8c, 0x0dc2, 0x4463,
+	    0x242f, 0x2ceb, 0x0f15, 0x3310, 0x0000, 0x03bb, 0x0000, 0x0a9d,
+	    0x2f1f, 0x0c7e, 0x3a19, 0x0000, 0x4031, 0x1fcd, 0x41e2, 0x1464,
+	    0x099c, 0x3113, 0x0000, 0x153f, 0x442a, 0x0000, 0x1af4, 0x0000,
+	    0x1de7, 0x0f86, 0x164a, 0x0000, 0x1365, 0x0003, 0x05de, 0x4138,
+	    0x0000, 0x0000, 0x0fc0, 0x3595, 0x293d, 0x1462, 0x395b, 0x03bd,
+	    0x0000, 0x0000, 0x3a33, 0x0d9c, 0x1b56, 0x0324, 0x1960, 0x0000,
+	    0x38a9, 0x023f, 0x2392, 0x0000, 0x2280, 0x3f22, 0x0000, 0x4be3,
+	    0x1204, 0x0000, 0x0000, 0x49c0, 0x4c77, 0x0000, 0x0a34, 0x0000,
+	    0x1592, 0x0000, 0x2176, 0x2ed5, 0x0000, 0x2f28, 0x0000, 0x0000,
+	    0x1e44, 0x262c, 0x0000, 0x40f4, 0x2d6d, 0x0000, 0x3ff4, 0x128f,
+	    0x0000, 0x0000, 0x15c7, 0x1487, 0x165b, 0x0000, 0x3e7e, 0x3bed,
+	    0x2263, 0x0e4f, 0x00ac, 0x2baa, 0x0000, 0x3539, 0x441f, 0x1730,
+	    0x4966, 0x3d99, 0x0000, 0x0000, 0x0000, 0x2464, 0x03b3, 0x168c,
+	    0x10c1, 0x0aad, 0x373e, 0x0000, 0x3f2c, 0x10e6, 0x4b00, 0x29f1,
+	    0x00b7, 0x29b0, 0x3dc6, 0x31be, 0x046f, 0x1099, 0x3e1f, 0x3902,
+	    0x042b, 0x1336, 0x49e8, 0x3f32, 0x0000, 0x073e, 0x0315, 0x3887,
+	    0x1b94, 0x1ca4, 0x0000, 0x0000, 0x44fb, 0x1fb0, 0x0745, 0x0000,
+	    0x437a, 0x4a2c, 0x36fe, 0x0000, 0x0258, 0x3844, 0x2706, 0x3432,
+	    0x1364, 0x0684, 0x1dbd, 0x261d, 0x3c95, 0x0ab3, 0x4a0e, 0x4562,
+	    0x0000, 0x3385, 0x44c7, 0x0000, 0x0000, 0x0000, 0x46ef, 0x1ba9,
+	    0x2c4f, 0x013e, 0x09fb, 0x0000, 0x0000, 0x0000, 0x49c3, 0x2976,
+	    0x35ff, 0x228b, 0x07c3, 0x3442, 0x2adb, 0x0000, 0x0000, 0x15b7,
+	    0x4173, 0x0000, 0x32b2, 0x0d7d, 0x0eaa, 0x00be, 0x2d3f, 0x082f,
+	    0x48f2, 0x01dd, 0x0000, 0x31f1, 0x24d2, 0x0b1e, 0x0b6f, 0x3e42,
+	    0x0000, 0x2003, 0x303d, 0x2a8c, 0x0ce5, 0x26dd, 0x0000, 0x06af,
+	    0x0000, 0x2665, 0x3392, 0x0000, 0x08d9, 0x4095, 0x2ff6, 0x4661,
+	    0x27f3, 0x3e2d, 0x4589, 0x4212, 0x2786, 0x2965, 0x0000, 0x45be,
+	    0x0cbe, 0x1ab5, 0x0000, 0x196e, 0x32ca, 0x06ad, 0x18f1, 0x31b0,
+	    0x07fd, 0x0a6b, 0x32d7, 0x48f7, 0x4497, 0x4ac3, 0x0000, 0x0000,
+	    0x0000, 0x0bf4, 0x1a40, 0x0000, 0x0000, 0x0db6, 0x4793, 0x0000,
+	    0x0000, 0x0477, 0x121c, 0x0000, 0x471c, 0x0000, 0x2533, 0x475c,
+	    0x4327, 0x0000, 0x1108, 0x27b4, 0x301c, 0x078d, 0x2db1, 0x122b,
+	    0x4a74, 0x4234, 0x1020, 0x3c85, 0x38b6, 0x0000, 0x3098, 0x0000,
+	    0x0a4c, 0x26d8, 0x2166, 0x41fd, 0x0000, 0x1bfc, 0x0000, 0x476e,
+	    0x1acb, 0x3b47, 0x3fc9, 0x06df, 0x48b2, 0x1d74, 0x0d45, 0x4736,
+	    0x36a5, 0x231d, 0x456b, 0x229d, 0x0000, 0x4a21, 0x14e3, 0x179f,
+	    0x4996, 0x07a6, 0x00e8, 0x3002, 0x0000, 0x119d, 0x38b6, 0x42f6,
+	    0x2993, 0x1824, 0x39fe, 0x0000, 0x4bca, 0x2bf5, 0x0000, 0x1c15,
+	    0x0000, 0x0220, 0x1831, 0x0c56, 0x0000, 0x1992, 0x110e, 0x1a3c,
+	    0x0d95, 0x0000, 0x0000, 0x3de6, 0x34b5, 0x0000, 0x0000, 0x4d80,
+	    0x0000, 0x309f, 0x3347, 0x28d0, 0x13ff, 0x4b17, 0x1342, 0x0000,
+	    0x2e2c, 0x0000, 0x15d2, 0x4699, 0x03c5, 0x48bd, 0x27de, 0x0000,
+	    0x169c, 0x215b, 0x0000, 0x386c, 0x1e22, 0x13e0, 0x45da, 0x211c,
+	    0x3cb2, 0x49d2, 0x1b85, 0x279e, 0x2290, 0x364b, 0x00af, 0x05f7,
+	    0x09d1, 0x39bd, 0x42c6, 0x3a41, 0x0000, 0x41cb, 0x0a11, 0x4a20,
+	    0x1542, 0x0000, 0x0016, 0x28b8, 0x27a5, 0x08a5, 0x27af, 0x1b2b,
+	    0x2781, 0x0000, 0x0000, 0x1a61, 0x2450, 0x0000, 0x0000, 0x0000,
+	    0x3c14, 0x344f, 0x197f, 0x42ba, 0x0000, 0x0000, 0x0000, 0x08f8,
+	    0x3c28, 0x0000, 0x1c62, 0x2f63, 0x0191, 0x4160, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x14f0, 0x0000, 0x0000, 0x1fc3, 0x0000, 0x4828,
+	    0x0000, 0x1a43, 0x0000, 0x26b0, 0x1095, 0x0000, 0x1d8c, 0x208c,
+	    0x4667, 0x4a94, 0x0000, 0x0000, 0x0000, 0x0216, 0x4915, 0x1fbd,
+	    0x43ec, 0x3c6d, 0x2000, 0x2e1f, 0x34de, 0x0000, 0x3e71, 0x073f,
+	    0x0000, 0x2a94, 0x26a2, 0x012b, 0x0000, 0x0f4e, 0x0000, 0x300f,
+	    0x0e11, 0x0000, 0x1443, 0x1df8, 0x0000, 0x4b43, 0x0dfe, 0x15ee,
+	    0x146c, 0x3f6d, 0x0ae4, 0x468c, 0x2b2d, 0x284a, 0x3823, 0x180f,
+	    0x375c, 0x0000, 0x3ee2, 0x160b, 0x33ab, 0x293e, 0x4b69, 0x24f1,
+	    0x0777, 0x0b26, 0x0000, 0x255b, 0x0000, 0x0000, 0x454e, 0x0000,
+	    0x33b9, 0x0000, 0x1cac, 0x35f4, 0x154b, 0x106f, 0x2e67, 0x3d29,
+	    0x0f8e, 0x1016, 0x1e75, 0x1eea, 0x13f3, 0x316d, 0x36f6, 0x0000,
+	    0x0000, 0x0000, 0x0fdb, 0x0000, 0x3d86, 0x11fb, 0x4470, 0x1fe4,
+	    0x3fe4, 0x1d58, 0x0000, 0x0000, 0x0e77, 0x37e8, 0x1316, 0x09c2,
+	    0x0000, 0x0a0e, 0x0000, 0x0000, 0x48e7, 0x0000, 0x43f8, 0x0000,
+	    0x477e, 0x1e68, 0x0000, 0x0823, 0x36cd, 0x44c5, 0x23db, 0x0000,
+	    0x1522, 0x0000, 0x199f, 0x0000, 0x3f31, 0x17b7, 0x3c83, 0x0fea,
+	    0x22e7, 0x4da0, 0x297d, 0x22d4, 0x2ab9, 0x0000, 0x3be0, 0x1272,
+	    0x31e0, 0x0000, 0x0000, 0x3294, 0x0000, 0x4cda, 0x04c5, 0x4c29,
+	    0x456b, 0x018f, 0x0abd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4432, 0x18ca, 0x23be, 0x34dd, 0x4a4d, 0x49cf, 0x33b7, 0x3403,
+	    0x07a8, 0x2312, 0x0000, 0x0000, 0x19e2, 0x1232, 0x4d3f, 0x0000,
+	    0x4a9b, 0x0000, 0x468b, 0x0000, 0x1ef1, 0x0000, 0x0000, 0x0ed4,
+	    0x0000, 0x39b6, 0x3bc4, 0x4bb2, 0x0000, 0x2979, 0x0000, 0x0000,
+	    0x01d6, 0x44fb, 0x2c4b, 0x0ba9, 0x4367, 0x15e7, 0x003b, 0x0000,
+	    0x0000, 0x0000, 0x28e7, 0x06f3, 0x3328, 0x3e00, 0x2985, 0x0000,
+	    0x21da, 0x4050, 0x2a51, 0x0000, 0x3faf, 0x41d9, 0x4413, 0x037c,
+	    0x1cb7, 0x0000, 0x1a9a, 0x4a64, 0x3c14, 0x28df, 0x4777, 0x338d,
+	    0x056c, 0x0000, 0x2577, 0x31de, 0x440c, 0x2373, 0x07c2, 0x0d85,
+	    0x426a, 0x46ef, 0x1905, 0x0000, 0x2ef5, 0x0000, 0x011b, 0x40ad,
+	    0x0000, 0x0000, 0x0000, 0x3427, 0x1b74, 0x0000, 0x42af, 0x0f1c,
+	    0x23d7, 0x4ac7, 0x38f2, 0x0000, 0x0983, 0x4da0, 0x33a8, 0x0000,
+	    0x3ecf, 0x07d8, 0x0a2f, 0x20d6, 0x3a42, 0x35be, 0x333b, 0x3aed,
+	    0x4ccb, 0x1806, 0x1e82, 0x0000, 0x0000, 0x0a43, 0x109c, 0x0000,
+	    0x21d8, 0x1bc3, 0x4c78, 0x1951, 0x0000, 0x0000, 0x3e39, 0x0000,
+	    0x4c6d, 0x068c, 0x30e9, 0x4827, 0x154b, 0x0ce9, 0x0847, 0x1af1,
+	    0x2fcd, 0x0000, 0x01f2, 0x4961, 0x1866, 0x1285, 0x0920, 0x3445,
+	    0x3acc, 0x0000, 0x38d3, 0x494d, 0x3543, 0x07d9, 0x4125, 0x0000,
+	    0x17b1, 0x368e, 0x0000, 0x3c3f, 0x145a, 0x1a9c, 0x48e6, 0x312f,
+	    0x488a, 0x1931, 0x2013, 0x0000, 0x4db8, 0x46ce, 0x0000, 0x3011,
+	    0x44ec, 0x0000, 0x254b, 0x0000, 0x3569, 0x44cf, 0x098d, 0x4332,
+	    0x3544, 0x3803, 0x4492, 0x05c1, 0x4ccc, 0x17ff, 0x4a81, 0x4747,
+	    0x0c58, 0x478d, 0x0000, 0x0000, 0x398b, 0x4b0c, 0x26c6, 0x3964,
+	    0x0000, 0x3e3f, 0x4c12, 0x36ec, 0x0000, 0x1092, 0x419a, 0x0000,
+	    0x2628, 0x2788, 0x19e0, 0x3eca, 0x31f1, 0x0000, 0x47d8, 0x4d18,
+	    0x328c, 0x4abe, 0x3975, 0x0cc6, 0x121a, 0x0d92, 0x495d, 0x07d6,
+	    0x3c1b, 0x4c8a, 0x0000, 0x0000, 0x0000, 0x09c9, 0x11d8, 0x4889,
+	    0x2aaa, 0x4a24, 0x0000, 0x0ef9, 0x33b0, 0x302d, 0x4607, 0x1b5a,
+	    0x0b3d, 0x3e41, 0x0696, 0x2b68, 0x3926, 0x3373, 0x4c83, 0x2db1,
+	    0x4b15, 0x3d47, 0x05ed, 0x4193, 0x32a7, 0x2b33, 0x30a2, 0x2b4a,
+	    0x0588, 0x0000, 0x2b2f, 0x43fa, 0x0c5e, 0x066a, 0x1686, 0x0000,
+	    0x4555, 0x0e65, 0x0000, 0x0000, 0x10a4, 0x3a29, 0x43be, 0x1ce3,
+	    0x0000, 0x0000, 0x0000, 0x314f, 0x43d8, 0x1e95, 0x3975, 0x0000,
+	    0x1b4b, 0x29d3, 0x4abb, 0x0c8f, 0x0000, 0x052f, 0x1bbd, 0x1059,
+	    0x2bbf, 0x43db, 0x0000, 0x04b7, 0x28fd, 0x02af, 0x4d27, 0x3c62,
+	    0x40c5, 0x4707, 0x35bb, 0x0073, 0x05b5, 0x4dee, 0x0217, 0x2f25,
+	    0x4604, 0x3157, 0x2564, 0x07c9, 0x2248, 0x0000, 0x1a3b, 0x4a12,
+	    0x2614, 0x0000, 0x0000, 0x3a7f, 0x0000, 0x0000, 0x0000, 0x34d3,
+	    0x2ece, 0x0043, 0x0000, 0x0000, 0x0000, 0x166d, 0x090f, 0x0100,
+	    0x4bd0, 0x0000, 0x2777, 0x2c84, 0x3c72, 0x1607, 0x01f5, 0x4936,
+	    0x0000, 0x352f, 0x0caf, 0x48c6, 0x49bf, 0x0000, 0x0000, 0x4d4e,
+	    0x0000, 0x0000, 0x131b, 0x028d, 0x0000, 0x0ece, 0x0000, 0x4aa6,
+	    0x3506, 0x0dff, 0x0cfc, 0x2081, 0x30d1, 0x1eb8, 0x29a9, 0x0000,
+	    0x0000, 0x26f2, 0x4c57, 0x317f, 0x4043, 0x2b78, 0x3fde, 0x275b,
+	    0x373a, 0x0000, 0x2464, 0x35cd, 0x0000, 0x278b, 0x0000, 0x3e4b,
+	    0x13e0, 0x4142, 0x17b6, 0x0000, 0x35db, 0x0000, 0x2854, 0x1cc5,
+	    0x370a, 0x41ed, 0x3ea0, 0x2f00, 0x21cb, 0x4a23, 0x0e47, 0x0000,
+	    0x1b9d, 0x1b0f, 0x1851, 0x0000, 0x0756, 0x3c20, 0x0000, 0x0000,
+	    0x1c6b, 0x0000, 0x2810, 0x39bc, 0x0000, 0x1c3a, 0x2e6b, 0x0000,
+	    0x2933, 0x0000, 0x2c3b, 0x3920, 0x0000, 0x2518, 0x483c, 0x1ef2,
+	    0x4b11, 0x0000, 0x0efc, 0x0000, 0x3164, 0x246b, 0x0550, 0x196b,
+	    0x0000, 0x0000, 0x3f8a, 0x1734, 0x0000, 0x3354, 0x35fb, 0x12f8,
+	    0x3771, 0x3d0e, 0x2ac5, 0x496e, 0x0041, 0x49c3, 0x0000, 0x1458,
+	    0x2364, 0x0961, 0x0000, 0x3a85, 0x1f73, 0x345f, 0x2dea, 0x0000,
+	    0x1bd0, 0x0000, 0x3129, 0x4c1c, 0x0000, 0x0000, 0x0f7f, 0x2a74,
+	    0x1a7a, 0x22d4, 0x0000, 0x3bee, 0x2f51, 0x1a89, 0x22b6, 0x361a,
+	    0x2f6a, 0x17b2, 0x3e1b, 0x3e2e, 0x196b, 0x0000, 0x0000, 0x3627,
+	    0x2d49, 0x1452, 0x1136, 0x0000, 0x4d4e, 0x0000, 0x0370, 0x404c,
+	    0x0000, 0x2294, 0x3250, 0x30ba, 0x321e, 0x0000, 0x15fd, 0x0000,
+	    0x0000, 0x3c1b, 0x4609, 0x0000, 0x0000, 0x3c00, 0x3a0f, 0x0000,
+	    0x1b5f, 0x4475, 0x40b0, 0x0000, 0x0000, 0x4dc9, 0x0000, 0x3e1d,
+	    0x1b0e, 0x0000, 0x0be6, 0x27a9, 0x11e9, 0x04ec, 0x43ab, 0x0000,
+	    0x4599, 0x4282, 0x2d41, 0x2e40, 0x14fd, 0x37ca, 0x23d0, 0x0000,
+	    0x2462, 0x0000, 0x0000, 0x1317, 0x351d, 0x2514, 0x478e, 0x426b,
+	    0x2ae3, 0x4d21, 0x24f8, 0x2faa, 0x0000, 0x4c39, 0x12b6, 0x494c,
+	    0x058a, 0x49d7, 0x4e1b, 0x4369, 0x05e6, 0x4997, 0x0000, 0x0000,
+	    0x0235, 0x3067, 0x0000, 0x1530, 0x0da8, 0x1670, 0x1dbb, 0x0000,
+	    0x08df, 0x2d25, 0x0000, 0x0000, 0x2473, 0x0000, 0x0cb0, 0x4163,
+	    0x0000, 0x2683, 0x0cd4, 0x117b, 0x3b8f, 0x3fa2, 0x0000, 0x0a10,
+	    0x0000, 0x3173, 0x2432, 0x2535, 0x26cc, 0x3f11, 0x030f, 0x0000,
+	    0x133b, 0x0e6a, 0x06ce, 0x2d46, 0x0000, 0x3576, 0x0a7c, 0x29bd,
+	    0x3345, 0x21da, 0x091d, 0x272f, 0x036c, 0x2f5b, 0x1c57, 0x0000,
+	    0x3238, 0x0000, 0x1c82, 0x0540, 0x4375, 0x45c0, 0x4bb8, 0x3d66,
+	    0x09e9, 0x4421, 0x2948, 0x0000, 0x0000, 0x0000, 0x40ce, 0x196f,
+	    0x03ec, 0x1990, 0x0000, 0x0000, 0x10d0, 0x2c98, 0x38be, 0x0000,
+	    0x0779, 0x0000, 0x4199, 0x1765, 0x33cb, 0x3185, 0x0000, 0x3c76,
+	    0x43e9, 0x276a, 0x0000, 0x0000, 0x4984, 0x4dfb, 0x07ad, 0x17d5,
+	    0x1594, 0x0000, 0x39f1, 0x03b3, 0x0000, 0x0409, 0x168e, 0x0000,
+	    0x11fb, 0x2b3e, 0x0000, 0x0000, 0x12ed, 0x2021, 0x107a, 0x029b,
+	    0x0687, 0x057a, 0x2a17, 0x1bdf, 0x1be1, 0x26dd, 0x3398, 0x4766,
+	    0x0000, 0x2769, 0x1125, 0x35be, 0x26bc, 0x32e4, 0x49bf, 0x0000,
+	    0x2b3d, 0x0000, 0x0000, 0x2d3c, 0x0000, 0x0000, 0x0000, 0x46ed,
+	    0x0506, 0x0000, 0x3f50, 0x0446, 0x0000, 0x0000, 0x0000, 0x4b21,
+	    0x0000, 0x34ed, 0x1e30, 0x4bb2, 0x0000, 0x41d1, 0x3a01, 0x32bc,
+	    0x0000, 0x436b, 0x0000, 0x2ca0, 0x254c, 0x1076, 0x4ab7, 0x0000,
+	    0x429b, 0x0000, 0x2cf7, 0x1335, 0x4310, 0x1930, 0x21d3, 0x3937,
+	    0x4773, 0x025a, 0x0000, 0x230f, 0x4a9f, 0x4a10, 0x2bad, 0x01af,
+	    0x0000, 0x0000, 0x299e, 0x3b19, 0x4556, 0x14c8, 0x0000, 0x3628,
+	    0x2bea, 0x2d92, 0x4c2d, 0x0eb1, 0x0a39, 0x0000, 0x0f66, 0x0c42,
+	    0x4d42, 0x1f1b, 0x3296, 0x0000, 0x3b66, 0x459a, 0x2726, 0x1eca,
+	    0x01b4, 0x3afa, 0x0000, 0x0000, 0x4b07, 0x0000, 0x4dfd, 0x269f,
+	    0x0000, 0x1560, 0x0000, 0x2f35, 0x0000, 0x0616, 0x0000, 0x20f0,
+	    0x3b6e, 0x23e3, 0x06ab, 0x21e2, 0x3c0b, 0x0337, 0x3e38, 0x4e1a,
+	    0x38ad, 0x084d, 0x2722, 0x1f44, 0x0000, 0x17f6, 0x0000, 0x0000,
+	    0x2ff3, 0x37f8, 0x14bc, 0x1e93, 0x0000, 0x0103, 0x141d, 0x10cb,
+	    0x3bc8, 0x06e6, 0x0000, 0x118f, 0x0ead, 0x3464, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x348f, 0x340c, 0x3647, 0x195b, 0x0000,
+	    0x044f, 0x45a1, 0x1123, 0x1498, 0x1dc9, 0x0000, 0x0000, 0x13b2,
+	    0x0000, 0x3977, 0x2045, 0x3d35, 0x2144, 0x2cd7, 0x16a6, 0x3279,
+	    0x19e8, 0x0e47, 0x0000, 0x069b, 0x31f9, 0x3b6f, 0x053f, 0x0000,
+	    0x3345, 0x34a8, 0x235f, 0x484e, 0x0d5c, 0x0ee9, 0x18cd, 0x45ea,
+	    0x1d92, 0x264c, 0x396d, 0x3a02, 0x2b2c, 0x1482, 0x4320, 0x0000,
+	    0x0000, 0x4742, 0x375d, 0x0000, 0x19a1, 0x4922, 0x1bd8, 0x129c,
+	    0x46c0, 0x1df1, 0x4ac9, 0x0000, 0x2e91, 0x2cfc, 0x4bb8, 0x0000,
+	    0x1272, 0x109a, 0x0000, 0x0000, 0x48eb, 0x42be, 0x0000, 0x0000,
+	    0x0000, 0x0551, 0x0f13, 0x0000, 0x37c1, 0x4af0, 0x3489, 0x29f4,
+	    0x04a2, 0x1abd, 0x4d2c, 0x0000, 0x3cc2, 0x0000, 0x413a, 0x27a7,
+	    0x0000, 0x142e, 0x1306, 0x3957, 0x0000, 0x3729, 0x43e9, 0x3a89,
+	    0x1257, 0x4bdb, 0x4ca3, 0x0000, 0x0000, 0x1adc, 0x0000, 0x0000,
+	    0x187c, 0x0000, 0x3471, 0x0000, 0x46c2, 0x0ddc, 0x2882, 0x3dc4,
+	    0x0b3a, 0x22a9, 0x0000, 0x3f81, 0x4d1e, 0x176c, 0x46a2, 0x0000,
+	    0x4715, 0x4629, 0x079d, 0x4de7, 0x0000, 0x20ec, 0x0000, 0x4292,
+	    0x1e42, 0x4864, 0x45d0, 0x15a2, 0x35f5, 0x0000, 0x3062, 0x39b1,
+	    0x4207, 0x1a53, 0x1534, 0x07b3, 0x297e, 0x2875, 0x0000, 0x04b7,
+	    0x1939, 0x0000, 0x20cb, 0x0000, 0x0000, 0x1dbc, 0x3b33, 0x0d0a,
+	    0x4980, 0x0000, 0x06a3, 0x0000, 0x1fb7, 0x1a16, 0x0000, 0x227f,
+	    0x1311, 0x0000, 0x42d9, 0x1fdd, 0x0000, 0x2e6e, 0x4154, 0x38d4,
+	    0x41fc, 0x4d2d, 0x3929, 0x1c9c, 0x3176, 0x0000, 0x2be3, 0x2b26,
+	    0x4883, 0x1709, 0x0000, 0x1850, 0x0000, 0x4e00, 0x1ab4, 0x364d,
+	    0x26dd, 0x0000, 0x2791, 0x3aa1, 0x1e34, 0x0000, 0x0000, 0x4d65,
+	    0x2473, 0x4bec, 0x0000, 0x3ea3, 0x0000, 0x038a, 0x460a, 0x0000,
+	    0x4bbf, 0x4502, 0x26b4, 0x2adf, 0x0000, 0x30c3, 0x396f, 0x0000,
+	    0x0998, 0x1cd4, 0x28cb, 0x0000, 0x1ba0, 0x3143, 0x0b1c, 0x018d,
+	    0x1d0f, 0x0000, 0x2eff, 0x0be8, 0x33ad, 0x0097, 0x0153, 0x037f,
+	    0x0000, 0x4100, 0x215c, 0x178c, 0x362d, 0x3291, 0x0007, 0x1036,
+	    0x2175, 0x0000, 0x0699, 0x2a32, 0x1cba, 0x3d41, 0x11ff, 0x23a7,
+	    0x07f7, 0x23eb, 0x0217, 0x47b7, 0x31ad, 0x2bb8, 0x347c, 0x0000,
+	    0x0000, 0x2a50, 0x4103, 0x0000, 0x0000, 0x185c, 0x0000, 0x0002,
+	    0x201d, 0x09e9, 0x357d, 0x0000, 0x340a, 0x1c5f, 0x0000, 0x0000,
+	    0x1467, 0x4635, 0x0cb4, 0x3aca, 0x0000, 0x0465, 0x0000, 0x31da,
+	    0x0000, 0x1748, 0x054c, 0x4d06, 0x38ad, 0x0f1d, 0x4c51, 0x457f,
+	    0x4dde, 0x04bf, 0x0c33, 0x0000, 0x0000, 0x0990, 0x0f89, 0x0000,
+	    0x1392, 0x0000, 0x0000, 0x0000, 0x0000, 0x2de9, 0x0000, 0x4c9a,
+	    0x14c9, 0x00fb, 0x18f7, 0x1940, 0x160c, 0x1299, 0x1d6a, 0x3153,
+	    0x0687, 0x0000, 0x18ea, 0x4b03, 0x0000, 0x3677, 0x2994, 0x4686,
+	    0x364d, 0x2565, 0x0000, 0x2b38, 0x22d5, 0x3ec1, 0x0000, 0x1a1e,
+	    0x375b, 0x0000, 0x3891, 0x0000, 0x244d, 0x3f82, 0x0ff5, 0x0000,
+	    0x17cc, 0x1b7d, 0x0000, 0x3eed, 0x0000, 0x10b3, 0x3c7e, 0x3a40,
+	    0x076d, 0x4376, 0x0000, 0x2e97, 0x0000, 0x0000, 0x1ba5, 0x3be6,
+	    0x0000, 0x3e48, 0x1c90, 0x45cc, 0x110f, 0x21f7, 0x3bff, 0x4ae8,
+	    0x4783, 0x4dd8, 0x2720, 0x4135, 0x455f, 0x2576, 0x1394, 0x0015,
+	    0x05f6, 0x387a, 0x4782, 0x0000, 0x2a57, 0x0f2e, 0x1f90, 0x3254,
+	    0x30c1, 0x0000, 0x1c14, 0x0b1f, 0x08a4, 0x0000, 0x28ec, 0x3836,
+	    0x0000, 0x31af, 0x4884, 0x0000, 0x14aa, 0x0000, 0x265d, 0x2a06,
+	    0x1c4b, 0x245f, 0x0000, 0x0000, 0x28ea, 0x0000, 0x0000, 0x0000,
+	    0x1f22, 0x120d, 0x1fdc, 0x4472, 0x0241, 0x0fc1, 0x0000, 0x0e9a,
+	    0x4b43, 0x179c, 0x1b67, 0x4003, 0x237f, 0x02ca, 0x324f, 0x43fe,
+	    0x3e7f, 0x2fd5, 0x0000, 0x07bd, 0x0000, 0x07a5, 0x0000, 0x0b4d,
+	    0x09d3, 0x3b7a, 0x31af, 0x41c0, 0x0000, 0x32b0, 0x0447, 0x0000,
+	    0x0228, 0x104a, 0x36fb, 0x1e2e, 0x0587, 0x1ba2, 0x11d1, 0x1bca,
+	    0x3ed3, 0x0000, 0x0000, 0x1950, 0x0000, 0x1f6c, 0x0c3b, 0x00cb,
+	    0x0000, 0x34f2, 0x1bb4, 0x0000, 0x1cfb, 0x3ea1, 0x12d2, 0x39a2,
+	    0x162f, 0x0000, 0x05e7, 0x404d, 0x41af, 0x2649, 0x0c4b, 0x39a3,
+	    0x42f0, 0x419d, 0x2d69, 0x4cbb, 0x4497, 0x0000, 0x3bee, 0x48e0,
+	    0x45e0, 0x23fb, 0x1836, 0x0000, 0x085f, 0x0000, 0x0000, 0x1062,
+	    0x4b44, 0x0000, 0x0182, 0x1bc3, 0x0000, 0x35de, 0x0000, 0x12c3,
+	    0x4106, 0x46ee, 0x2cc9, 0x06bc, 0x2dd8, 0x0000, 0x02aa, 0x2adf,
+	    0x40a9, 0x00cb, 0x3fd7, 0x46fe, 0x05d5, 0x1a32, 0x0000, 0x0319,
+	    0x13d2, 0x3188, 0x0000, 0x217b, 0x2496, 0x32d5, 0x0000, 0x0822,
+	    0x10dd, 0x004b, 0x0000, 0x072c, 0x0000, 0x0fc2, 0x39e6, 0x3f41,
+	    0x3345, 0x2be0, 0x385c, 0x4649, 0x4b5b, 0x0000, 0x37ee, 0x0620,
+	    0x4967, 0x2dfa, 0x3258, 0x0000, 0x4a96, 0x0000, 0x0766, 0x3990,
+	    0x18c7, 0x03e6, 0x0834, 0x0000, 0x3bbe, 0x0000, 0x296c, 0x04c7,
+	    0x274d, 0x0844, 0x1ea0, 0x2f01, 0x35b1, 0x0000, 0x2d32, 0x0082,
+	    0x35f7, 0x3d57, 0x4a17, 0x0d3e, 0x09e2, 0x481d, 0x0000, 0x0000,
+	    0x1193, 0x3902, 0x303d, 0x0000, 0x0d0a, 0x464d, 0x35e9, 0x4ab6,
+	    0x4b79, 0x0000, 0x18f1, 0x4903, 0x0000, 0x35d5, 0x3e95, 0x29ed,
+	    0x26e2, 0x0000, 0x0000, 0x3c52, 0x1857, 0x312e, 0x144c, 0x0591,
+	    0x1464, 0x26cd, 0x2683, 0x0b32, 0x0000, 0x0000, 0x0000, 0x317e,
+	    0x0000, 0x1bf7, 0x2cee, 0x0000, 0x0000, 0x078f, 0x1f95, 0x0ac4,
+	    0x4790, 0x16af, 0x45b8, 0x3e90, 0x1bd5, 0x24ce, 0x0bf9, 0x0000,
+	    0x264b, 0x4b70, 0x22df, 0x3b05, 0x1765, 0x0000, 0x1d38, 0x0000,
+	    0x3b54, 0x31f7, 0x24e4, 0x45d8, 0x0000, 0x3433, 0x2e53, 0x0d42,
+	    0x02e2, 0x2f2a, 0x0000, 0x1295, 0x0000, 0x0bb2, 0x0000, 0x05aa,
+	    0x0000, 0x4d88, 0x26d6, 0x0000, 0x0000, 0x0164, 0x0000, 0x13d4,
+	    0x01a4, 0x24ef, 0x1d5f, 0x2b15, 0x44bf, 0x285e, 0x0000, 0x0000,
+	    0x429d, 0x0744, 0x209d, 0x2e24, 0x0455, 0x0000, 0x166a, 0x4cd6,
+	    0x0000, 0x077a, 0x013c, 0x4bd2, 0x0278, 0x3ac1, 0x00d3, 0x1a50,
+	    0x0cc6, 0x0389, 0x1562, 0x11d4, 0x2ff5, 0x0000, 0x0000, 0x2c9a,
+	    0x4116, 0x143d, 0x02c5, 0x23c3, 0x4529, 0x3ad9, 0x0000, 0x48a4,
+	    0x3bd0, 0x4863, 0x0ff2, 0x3cf2, 0x48d8, 0x0000, 0x12af, 0x3d7e,
+	    0x0000, 0x0133, 0x0000, 0x0bcf, 0x447d, 0x1ecd, 0x2c1b, 0x3c6e,
+	    0x3357, 0x2f03, 0x4a25, 0x0000, 0x0000, 0x0000, 0x2ce8, 0x2448,
+	    0x0360, 0x2c89, 0x133a, 0x22a0, 0x0000, 0x2896, 0x323b, 0x402d,
+	    0x244f, 0x2741, 0x4401, 0x0000, 0x3182, 0x1a78, 0x1844, 0x2969,
+	    0x08ec, 0x40b1, 0x0fd1, 0x1ce1, 0x2827, 0x3c8a, 0x27cb, 0x0000,
+	    0x0000, 0x4488, 0x41d2, 0x4cba, 0x1c73, 0x0000, 0x33fb, 0x0000,
+	    0x36f0, 0x34a6, 0x0000, 0x37f3, 0x2dd3, 0x4839, 0x0000, 0x0000,
+	    0x250f, 0x1cc8, 0x2bf9, 0x0a76, 0x15ec, 0x1117, 0x3d48, 0x0222,
+	    0x469f, 0x31a1, 0x0f81, 0x0446, 0x43b7, 0x3490, 0x0000, 0x4d57,
+	    0x0c0b, 0x0000, 0x2b67, 0x0000, 0x4272, 0x27aa, 0x1cc3, 0x2d9a,
+	    0x0000, 0x31f4, 0x2373, 0x059c, 0x1e62, 0x1d4c, 0x35c7, 0x19da,
+	    0x34cf, 0x01bb, 0x49a4, 0x0535, 0x261d, 0x32d5, 0x103d, 0x0ae1,
+	    0x0000, 0x0000, 0x3b2a, 0x0000, 0x041d, 0x0be0, 0x473e, 0x4acc,
+	    0x325d, 0x261a, 0x102d, 0x3897, 0x0000, 0x08f8, 0x2ddf, 0x0000,
+	    0x477f, 0x14f4, 0x348a, 0x0000, 0x3e1d, 0x24fb, 0x4d91, 0x0eb1,
+	    0x0000, 0x28c4, 0x1c16, 0x065d, 0x06a3, 0x33f8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x2f5b, 0x1084, 0x0000, 0x32c3, 0x0114, 0x1e54,
+	    0x1dee, 0x1a93, 0x25cc, 0x27c9, 0x4ae8, 0x0a5f, 0x2593, 0x0000,
+	    0x462e, 0x1431, 0x468e, 0x36d2, 0x215c, 0x0000, 0x1c8e, 0x3a45,
+	    0x198b, 0x4ace, 0x040e, 0x0000, 0x3cb9, 0x4765, 0x48d3, 0x4a0f,
+	    0x4119, 0x0000, 0x022e, 0x0000, 0x0000, 0x09ed, 0x3eb9, 0x0000,
+	    0x4845, 0x0fa2, 0x0e31, 0x09f2, 0x0000, 0x3d6a, 0x0000, 0x3ada,
+	    0x27b1, 0x1b3f, 0x070a, 0x37a8, 0x087f, 0x0000, 0x4b48, 0x1e00,
+	    0x0000, 0x285b, 0x1640, 0x0018, 0x49c7, 0x0000, 0x023e, 0x0000,
+	    0x2e0d, 0x0000, 0x2120, 0x0000, 0x0a06, 0x22da, 0x4a0b, 0x28d8,
+	    0x3323, 0x0000, 0x4e0f, 0x0000, 0x24a3, 0x4a18, 0x05c3, 0x20c1,
+	    0x1875, 0x2c95, 0x401d, 0x259a, 0x33ab, 0x0718, 0x3f2b, 0x3056,
+	    0x1d0b, 0x4e05, 0x146d, 0x3660, 0x217d, 0x4174, 0x2f14, 0x40b8,
+	    0x426c, 0x3ae2, 0x4d11, 0x3848, 0x344e, 0x2f5a, 0x35a8, 0x0ab7,
+	    0x3787, 0x4ad7, 0x3aaf, 0x1fae, 0x3356, 0x42c5, 0x25bd, 0x0077,
+	    0x46a4, 0x04d5, 0x1218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x4d14, 0x4b82, 0x1775, 0x47a4, 0x144a, 0x2fe4, 0x0000, 0x39aa,
+	    0x3f37, 0x1d29, 0x3254, 0x311c, 0x2102, 0x3088, 0x39f9, 0x0000,
+	    0x1e02, 0x173a, 0x44cd, 0x3a57, 0x1208, 0x0000, 0x126a, 0x023f,
+	    0x3318, 0x0000, 0x1152, 0x0000, 0x4987, 0x4b4f, 0x1a71, 0x2306,
+	    0x2c10, 0x369a, 0x2969, 0x3b37, 0x3f8b, 0x2b81, 0x0148, 0x0099,
+	    0x17cd, 0x0000, 0x3deb, 0x2587, 0x0000, 0x0000, 0x0a9b, 0x0b99,
+	    0x27b1, 0x0b4f, 0x4d11, 0x484d, 0x0836, 0x26ed, 0x0000, 0x0000,
+	    0x1a71, 0x2140, 0x077a, 0x0000, 0x0000, 0x024f, 0x0000, 0x1d0b,
+	    0x4281, 0x422e, 0x3b9a, 0x32e1, 0x1091, 0x3424, 0x304f, 0x0000,
+	    0x4755, 0x2ba1, 0x2cdc, 0x4699, 0x486b, 0x3608, 0x4b49, 0x06ed,
+	    0x14a9, 0x48d4, 0x272a, 0x0000, 0x0000, 0x15f1, 0x4262, 0x3140,
+	    0x380d, 0x4c7f, 0x0000, 0x0000, 0x0b00, 0x2eaf, 0x27e6, 0x0000,
+	    0x3130, 0x0000, 0x4390, 0x432c, 0x0000, 0x43b4, 0x0000, 0x21dc,
+	    0x1551, 0x32f0, 0x2ab8, 0x0000, 0x0dd4, 0x45b1, 0x1e18, 0x1a8e,
+	    0x3abb, 0x0000, 0x48e3, 0x49e7, 0x0480, 0x0000, 0x2805, 0x15a1,
+	    0x0df2, 0x2c91, 0x0000, 0x0a15, 0x0000, 0x0000, 0x34a6, 0x3b95,
+	    0x1092, 0x0000, 0x0000, 0x0000, 0x0000, 0x4286, 0x1327, 0x0000,
+	    0x45c3, 0x1a81, 0x02cc, 0x0771, 0x0000, 0x0000, 0x47c9, 0x4080,
+	    0x08c2, 0x0000, 0x3fd3, 0x2d26, 0x2e04, 0x37c2, 0x2ccf, 0x23b4,
+	    0x0000, 0x0000, 0x02c7, 0x1c09, 0x17c2, 0x1979, 0x1951, 0x0c01,
+	    0x0000, 0x1bac, 0x33ab, 0x32e1, 0x2758, 0x1264, 0x0000, 0x046d,
+	    0x0000, 0x0dae, 0x4cb2, 0x35d2, 0x4c0e, 0x34fe, 0x0000, 0x4dbd,
+	    0x33cf, 0x1ff1, 0x0000, 0x4dc0, 0x0000, 0x46e5, 0x18e8, 0x3b1c,
+	    0x21da, 0x45a5, 0x0ac2, 0x3370, 0x0000, 0x2e01, 0x0000, 0x0000,
+	    0x4048, 0x0000, 0x0000, 0x2374, 0x0a4b, 0x2267, 0x0000, 0x0000,
+	    0x0000, 0x05e1, 0x4bc2, 0x0695, 0x1cfd, 0x28a6, 0x11d0, 0x0000,
+	    0x3191, 0x4309, 0x0000, 0x4646, 0x33bd, 0x0000, 0x152f, 0x4bf7,
+	    0x1456, 0x02ea, 0x248e, 0x095d, 0x25f3, 0x48c3, 0x0000, 0x141f,
+	    0x0000, 0x422e, 0x24a1, 0x0000, 0x35d6, 0x39c1, 0x0eac, 0x23a1,
+	    0x0000, 0x419e, 0x1b23, 0x3a4b, 0x3b25, 0x0000, 0x3c13, 0x1766,
+	    0x0000, 0x450e, 0x44de, 0x2ffb, 0x0c5a, 0x0000, 0x1a9f, 0x1db3,
+	    0x0338, 0x21e0, 0x3457, 0x0000, 0x36d3, 0x4165, 0x03b5, 0x0e33,
+	    0x0084, 0x0804, 0x0f74, 0x38dd, 0x3e5c, 0x0000, 0x0225, 0x4066,
+	    0x0000, 0x0000, 0x01d3, 0x0726, 0x375f, 0x0000, 0x3faa, 0x0574,
+	    0x0000, 0x2c0a, 0x0b11, 0x054a, 0x1f71, 0x3109, 0x49ba, 0x1fad,
+	    0x1db9, 0x1958, 0x318d, 0x0000, 0x0000, 0x0000, 0x2e29, 0x1458,
+	    0x42ec, 0x0000, 0x087c, 0x3fc0, 0x0000, 0x251b, 0x3179, 0x0000,
+	    0x3707, 0x0000, 0x0000, 0x0000, 0x1f8d, 0x0000, 0x2309, 0x2467,
+	    0x2956, 0x2263, 0x2c72, 0x0000, 0x3041, 0x3832, 0x4340, 0x0000,
+	    0x1d78, 0x44c9, 0x292a, 0x2777, 0x3150, 0x05d6, 0x22fd, 0x1f04,
+	    0x0000, 0x27e6, 0x0000, 0x0000, 0x0000, 0x1cf2, 0x0000, 0x0000,
+	    0x0edf, 0x14c3, 0x2862, 0x4b1b, 0x4b7a, 0x0000, 0x499f, 0x20f5,
+	    0x4732, 0x1ece, 0x3fe6, 0x266e, 0x423c, 0x0ba0, 0x3118, 0x43b9,
+	    0x0000, 0x0000, 0x05cd, 0x0000, 0x05d7, 0x48c0, 0x1981, 0x069a,
+	    0x036b, 0x21b5, 0x0000, 0x283f, 0x131b, 0x11a8, 0x0000, 0x180a,
+	    0x2496, 0x1672, 0x0000, 0x1179, 0x211c, 0x05c6, 0x0000, 0x06b7,
+	    0x377d, 0x3904, 0x493b, 0x2bef, 0x0000, 0x3d9c, 0x2000, 0x0000,
+	    0x0e0d, 0x3c04, 0x1d8a, 0x2cd8, 0x4813, 0x0000, 0x360f, 0x1df9,
+	    0x18b8, 0x0000, 0x0000, 0x0000, 0x0b79, 0x0baa, 0x017a, 0x219c,
+	    0x424a, 0x4a7c, 0x45b8, 0x4b8a, 0x0000, 0x2150, 0x0000, 0x33ea,
+	    0x0000, 0x206e, 0x3768, 0x2c99, 0x4cec, 0x0000, 0x35d0, 0x0000,
+	    0x438a, 0x1e8b, 0x1607, 0x1cfc, 0x2cdb, 0x09a5, 0x0000, 0x0000,
+	    0x0981, 0x0000, 0x3f10, 0x2e6d, 0x0000, 0x1e0d, 0x228f, 0x0782,
+	    0x0000, 0x0000, 0x319e, 0x2b4b, 0x2977, 0x0000, 0x16ef, 0x4dd2,
+	    0x214d, 0x0ee2, 0x3593, 0x265d, 0x3a80, 0x3eb4, 0x264d, 0x2e24,
+	    0x0000, 0x21a5, 0x0842, 0x04f3, 0x4766, 0x0000, 0x29ed, 0x0000,
+	    0x3709, 0x0000, 0x456f, 0x305a, 0x35e1, 0x3f27, 0x07ac, 0x46b4,
+	    0x0a31, 0x0f78, 0x1e15, 0x45c7, 0x0ee4, 0x1389, 0x00df, 0x328b,
+	    0x1fde, 0x3c1b, 0x0000, 0x0000, 0x495e, 0x468b, 0x0000, 0x4985,
+	    0x27ea, 0x0000, 0x07ca, 0x1250, 0x2f88, 0x0dc6, 0x3006, 0x433e,
+	    0x06c0, 0x12c6, 0x0000, 0x4d49, 0x32a7, 0x1ecc, 0x014a, 0x0127,
+	    0x0000, 0x37dd, 0x4ab0, 0x384e, 0x347a, 0x0000, 0x0000, 0x0000,
+	    0x3b0b, 0x2126, 0x4d65, 0x1d1c, 0x0bfd, 0x32d2, 0x12f2, 0x4015,
+	    0x2554, 0x1b3d, 0x3114, 0x2b0b, 0x03be, 0x28eb, 0x089c, 0x13f6,
+	    0x4619, 0x021c, 0x21dd, 0x3302, 0x3d8b, 0x179f, 0x0000, 0x1c1d,
+	    0x051a, 0x1fb0, 0x496c, 0x0000, 0x0009, 0x1f80, 0x0f1f, 0x124f,
+	    0x0db7, 0x34c9, 0x2915, 0x32cd, 0x1bf3, 0x0000, 0x1d04, 0x0486,
+	    0x2d19, 0x1aa7, 0x14b5, 0x4779, 0x165d, 0x0ba4, 0x208b, 0x0000,
+	    0x3326, 0x0000, 0x0ddc, 0x03bc, 0x2ce2, 0x0486, 0x319c, 0x0000,
+	    0x36eb, 0x1778, 0x3ed7, 0x01cf, 0x3765, 0x39ee, 0x35b8, 0x2d30,
+	    0x3325, 0x13c6, 0x3d84, 0x2d70, 0x253d, 0x2774, 0x0000, 0x0667,
+	    0x0e90, 0x0000, 0x10c5, 0x0000, 0x0b74, 0x3af7, 0x0c68, 0x28ff,
+	    0x2fc4, 0x0000, 0x1a9b, 0x2265, 0x1e0e, 0x0438, 0x0000, 0x3500,
+	    0x3110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05fa,
+	    0x218b, 0x4b7d, 0x0047, 0x3fb6, 0x0000, 0x0000, 0x0d6e, 0x4e05,
+	    0x4cfe, 0x3db7, 0x1cd0, 0x0000, 0x0000, 0x0000, 0x021e, 0x2f96,
+	    0x0000, 0x2ece, 0x0000, 0x2adb, 0x4bab, 0x2dc7, 0x1159, 0x0000,
+	    0x0883, 0x230c, 0x12db, 0x2243, 0x18c6, 0x1c32, 0x0000, 0x0000,
+	    0x0000, 0x24a8, 0x476b, 0x3b6c, 0x3f33, 0x44cd, 0x2fe6, 0x1291,
+	    0x3650, 0x4497, 0x23a6, 0x2cd3, 0x0dbc, 0x0000, 0x34a3, 0x031d,
+	    0x3642, 0x0000, 0x118e, 0x2c1c, 0x164e, 0x38db, 0x1544, 0x0000,
+	    0x0000, 0x0000, 0x41a7, 0x3932, 0x35ef, 0x004d, 0x2ffc, 0x0000,
+	    0x4b35, 0x0000, 0x49cc, 0x288f, 0x2a0a, 0x07ec, 0x38fb, 0x1dde,
+	    0x1b8f, 0x1bc4, 0x3a55, 0x0625, 0x0000, 0x155e, 0x0000, 0x0891,
+	    0x2117, 0x255c, 0x2419, 0x2d14, 0x41ba, 0x2cbe, 0x01d4, 0x4834,
+	    0x31e2, 0x44cd, 0x32f3, 0x3486, 0x48bf, 0x1bc0, 0x216a, 0x0000,
+	    0x17c4, 0x2c94, 0x129d, 0x0000, 0x0d42, 0x438c, 0x1e2c, 0x3fcb,
+	    0x0000, 0x1699, 0x2554, 0x1be4, 0x1eb0, 0x0000, 0x0f1b, 0x351c,
+	    0x1cde, 0x005e, 0x3e60, 0x0589, 0x0000, 0x170c, 0x40ef, 0x0aa1,
+	    0x0000, 0x0000, 0x0918, 0x0000, 0x199c, 0x2341, 0x0596, 0x0052,
+	    0x0000, 0x25a4, 0x3949, 0x0000, 0x0000, 0x0000, 0x41b7, 0x2758,
+	    0x0000, 0x3eae, 0x0000, 0x48ed, 0x0000, 0x0000, 0x165a, 0x430f,
+	    0x0130, 0x47e1, 0x0000, 0x4a80, 0x2eda, 0x2ac8, 0x1d43, 0x44fe,
+	    0x2584, 0x2f72, 0x08f4, 0x2c16, 0x07b3, 0x2d88, 0x0000, 0x0c01,
+	    0x13c3, 0x28b8, 0x0000, 0x483f, 0x3c17, 0x3bac, 0x4737, 0x0000,
+	    0x1bbe, 0x0000, 0x2ef7, 0x0000, 0x068e, 0x0000, 0x282c, 0x304d,
+	    0x194b, 0x429d, 0x0000, 0x3abe, 0x0060, 0x2060, 0x0000, 0x1fd5,
+	    0x0000, 0x1d4b, 0x171e, 0x0000, 0x0000, 0x0000, 0x4cac, 0x32c0,
+	    0x3a3c, 0x40c8, 0x1e61, 0x2662, 0x4335, 0x46ed, 0x2c2a, 0x0000,
+	    0x0000, 0x2781, 0x0000, 0x1495, 0x1943, 0x0000, 0x1153, 0x0379,
+	    0x1a4d, 0x1c09, 0x0000, 0x0000, 0x068f, 0x3ce1, 0x3bc2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24a6, 0x146c, 0x2de8,
+	    0x2da4, 0x0000, 0x39ba, 0x16ee, 0x2dcb, 0x0d13, 0x0000, 0x1a62,
+	    0x3a05, 0x0d4c, 0x44dc, 0x4505, 0x24b7, 0x0000, 0x2838, 0x0000,
+	    0x0b1e,
+	};
+	uint16_t h[6];
+
+	crc3(key, keylen, UINT64_C(0x75a2a8d46763845e), (uint64_t*)h);
+
+	h[0] = h[0] % 24801;
+	h[1] = h[1] % 24801;
+	h[2] = h[2] % 24801;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 20000;
+}
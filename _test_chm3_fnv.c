@@ -0,0 +1,175 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 1957747793, seed[1]: 424238335 */
+#include <stdint.h>
+#include "fnv3.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[1241] = {
+	    0x025f, 0x03d7, 0x00b3, 0x00bc, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x014c, 0x0000, 0x01d7, 0x02dd, 0x02fd, 0x039d, 0x0130, 0x00a0,
+	    0x006a, 0x02f0, 0x0072, 0x0106, 0x0000, 0x022e, 0x009b, 0x0000,
+	    0x01f9, 0x01f2, 0x015e, 0x0195, 0x00dc, 0x031b, 0x0325, 0x01b9,
+	    0x0077, 0x017e, 0x023c, 0x01fa, 0x0369, 0x027b, 0x022e, 0x034d,
+	    0x009c, 0x01cc, 0x0070, 0x0000, 0x0097, 0x0262, 0x019a, 0x0000,
+	    0x005c, 0x0277, 0x00dc, 0x02d1, 0x02e7, 0x0000, 0x0000, 0x0276,
+	    0x0283, 0x018d, 0x0000, 0x0271, 0x0000, 0x0000, 0x0160, 0x0323,
+	    0x01da, 0x0298, 0x01f5, 0x027e, 0x0351, 0x01d0, 0x0200, 0x0000,
+	    0x010e, 0x03d0, 0x01d9, 0x0000, 0x01d9, 0x000a, 0x0225, 0x0121,
+	    0x0000, 0x00f5, 0x00bc, 0x0248, 0x0316, 0x0114, 0x0064, 0x0000,
+	    0x026b, 0x02bb, 0x0000, 0x00f5, 0x01d4, 0x0000, 0x00be, 0x01d2,
+	    0x021f, 0x0000, 0x0124, 0x0000, 0x0033, 0x0163, 0x0103, 0x0174,
+	    0x0277, 0x02b9, 0x038b, 0x008d, 0x0000, 0x02a5, 0x00e2, 0x0231,
+	    0x0060, 0x035f, 0x0387, 0x0000, 0x0209, 0x00d9, 0x02c4, 0x0315,
+	    0x0000, 0x0297, 0x00ba, 0x033c, 0x0190, 0x0217, 0x02a1, 0x024c,
+	    0x02ee, 0x0112, 0x038f, 0x02bc, 0x0037, 0x0113, 0x0387, 0x0000,
+	    0x024d, 0x0375, 0x0221, 0x0347, 0x023e, 0x0333, 0x030b, 0x01dc,
+	    0x01d1, 0x0229, 0x0170, 0x013e, 0x0058, 0x02e0, 0x0343, 0x0000,
+	    0x013f, 0x0000, 0x0089, 0x0034, 0x0360, 0x008c, 0x016b, 0x0171,
+	    0x0000, 0x01f2, 0x02b5, 0x0254, 0x0000, 0x0000, 0x035e, 0x030d,
+	    0x02d6, 0x027b, 0x00d1, 0x0168, 0x036d, 0x021e, 0x006d, 0x008d,
+	    0x011e, 0x00e8, 0x031d, 0x0000, 0x0021, 0x006c, 0x03a0, 0x035e,
+	    0x021b, 0x00e0, 0x0000, 0x006a, 0x000f, 0x0345, 0x02a7, 0x00d1,
+	    0x0119, 0x0243, 0x0020, 0x01a1, 0x00a3, 0x00d0, 0x0000, 0x0203,
+	    0x02b4, 0x0000, 0x01d5, 0x01e8, 0x0289, 0x038f, 0x0028, 0x027d,
+	    0x0000, 0x0033, 0x02b3, 0x00ad, 0x0344, 0x030b, 0x023e, 0x0000,
+	    0x0000, 0x0374, 0x0254, 0x03e1, 0x02a8, 0x0014, 0x001e, 0x0000,
+	    0x0071, 0x03e6, 0x016a, 0x0000, 0x019c, 0x01c5, 0x029c, 0x0264,
+	    0x0169, 0x0369, 0x001f, 0x0088, 0x01b0, 0x03bc, 0x029e, 0x0163,
+	    0x02a9, 0x03ae, 0x0340, 0x0026, 0x01f3, 0x0215, 0x0330, 0x011e,
+	    0x0370, 0x0197, 0x0116, 0x02cf, 0x02ea, 0x033c, 0x006d, 0x0047,
+	    0x0000, 0x0071, 0x0095, 0x0012, 0x01ed, 0x0000, 0x03da, 0x020d,
+	    0x02ce, 0x00d9, 0x039c, 0x00eb, 0x013e, 0x0345, 0x0000, 0x0076,
+	    0x006b, 0x0000, 0x0124, 0x0326, 0x0000, 0x0386, 0x0215, 0x0000,
+	    0x0000, 0x0184, 0x009d, 0x0289, 0x02c9, 0x0014, 0x0310, 0x0073,
+	    0x0149, 0x033d, 0x02e0, 0x0359, 0x0000, 0x02fc, 0x038a, 0x0272,
+	    0x0081, 0x0000, 0x0000, 0x01ea, 0x00d6, 0x032f, 0x0000, 0x0006,
+	    0x0050, 0x01ae, 0x0190, 0x0000, 0x0000, 0x01c4, 0x024c, 0x012b,
+	    0x02f7, 0x0081, 0x0115, 0x03ab, 0x0000, 0x0274, 0x0000, 0x0000,
+	    0x0364, 0x037a, 0x01aa, 0x0313, 0x0000, 0x0000, 0x03bf, 0x0055,
+	    0x0223, 0x0254, 0x0000, 0x0000, 0x0325, 0x0000, 0x01c0, 0x02e1,
+	    0x0000, 0x011d, 0x0000, 0x01e4, 0x0039, 0x0284, 0x0038, 0x0256,
+	    0x011d, 0x039e, 0x0135, 0x0362, 0x0000, 0x026c, 0x0154, 0x0037,
+	    0x0000, 0x003a, 0x025c, 0x00b9, 0x0000, 0x0000, 0x0027, 0x0000,
+	    0x034d, 0x003c, 0x00f2, 0x0178, 0x0000, 0x0000, 0x0348, 0x0035,
+	    0x0158, 0x0223, 0x0264, 0x01d8, 0x0000, 0x0204, 0x03d3, 0x02c9,
+	    0x0330, 0x0000, 0x03e7, 0x0000, 0x00ae, 0x0000, 0x01e9, 0x01e8,
+	    0x03e3, 0x01ca, 0x0381, 0x03e0, 0x02c1, 0x0208, 0x0000, 0x0000,
+	    0x0255, 0x0000, 0x0260, 0x03e4, 0x015a, 0x0000, 0x0000, 0x019a,
+	    0x036b, 0x03d5, 0x0000, 0x0211, 0x0039, 0x007a, 0x0042, 0x02de,
+	    0x02d8, 0x01b3, 0x0000, 0x0168, 0x0000, 0x02f5, 0x026c, 0x038e,
+	    0x0000, 0x0100, 0x03e3, 0x018f, 0x0319, 0x029c, 0x0350, 0x032f,
+	    0x000f, 0x0279, 0x0361, 0x02f3, 0x0323, 0x03c3, 0x0338, 0x0059,
+	    0x0303, 0x0000, 0x034f, 0x01f2, 0x0137, 0x02d0, 0x0000, 0x007c,
+	    0x0280, 0x008c, 0x012a, 0x017e, 0x0082, 0x0000, 0x0053, 0x0315,
+	    0x0000, 0x0149, 0x0054, 0x03c1, 0x0382, 0x0130, 0x0000, 0x02f7,
+	    0x0329, 0x005f, 0x0142, 0x014d, 0x0000, 0x022e, 0x00bb, 0x0000,
+	    0x0000, 0x0184, 0x0046, 0x0000, 0x0000, 0x0124, 0x0070, 0x034e,
+	    0x01b0, 0x0000, 0x037d, 0x02ac, 0x0174, 0x0000, 0x020d, 0x0000,
+	    0x01e7, 0x0041, 0x001f, 0x0000, 0x00b1, 0x0128, 0x0136, 0x0000,
+	    0x0295, 0x0086, 0x0000, 0x0000, 0x0030, 0x01e9, 0x0138, 0x0000,
+	    0x0238, 0x022c, 0x0220, 0x0000, 0x0000, 0x0223, 0x0000, 0x0000,
+	    0x02a4, 0x025c, 0x0140, 0x0282, 0x0000, 0x0117, 0x02eb, 0x028d,
+	    0x01e7, 0x00e3, 0x035b, 0x015d, 0x02f3, 0x0000, 0x002e, 0x0191,
+	    0x011c, 0x0000, 0x0234, 0x028d, 0x015c, 0x0358, 0x0123, 0x00d4,
+	    0x019a, 0x02ad, 0x01ca, 0x0000, 0x00a9, 0x02a8, 0x0340, 0x0117,
+	    0x0092, 0x0315, 0x033f, 0x038d, 0x0000, 0x02e7, 0x01aa, 0x0084,
+	    0x0000, 0x00bd, 0x02be, 0x0119, 0x0000, 0x0382, 0x031b, 0x0000,
+	    0x0026, 0x0372, 0x01a5, 0x0000, 0x016b, 0x002c, 0x035b, 0x011c,
+	    0x0000, 0x013e, 0x032b, 0x02b0, 0x0000, 0x03a2, 0x00ec, 0x0177,
+	    0x0334, 0x03e3, 0x016d, 0x02f7, 0x01e4, 0x0105, 0x0365, 0x0234,
+	    0x0111, 0x0097, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f9, 0x02b2,
+	    0x00dd, 0x0395, 0x0252, 0x009b, 0x0360, 0x023c, 0x02cc, 0x02b9,
+	    0x039c, 0x0376, 0x009c, 0x00cd, 0x0229, 0x01a5, 0x028b, 0x0336,
+	    0x0215, 0x0000, 0x010f, 0x0000, 0x020d, 0x00dd, 0x0398, 0x0000,
+	    0x0292, 0x0335, 0x003c, 0x0000, 0x0341, 0x0207, 0x01b5, 0x0212,
+	    0x000b, 0x0292, 0x02ae, 0x01e1, 0x001e, 0x0000, 0x0392, 0x0226,
+	    0x00a1, 0x0023, 0x01d4, 0x0078, 0x0045, 0x0202, 0x0046, 0x00a2,
+	    0x010c, 0x037e, 0x0000, 0x0350, 0x0000, 0x03d7, 0x015d, 0x032d,
+	    0x0000, 0x00d6, 0x036b, 0x0000, 0x01a5, 0x02fa, 0x0000, 0x0266,
+	    0x00c1, 0x022d, 0x001b, 0x0363, 0x0061, 0x0231, 0x0003, 0x0075,
+	    0x0000, 0x01dd, 0x0000, 0x00f9, 0x0166, 0x0049, 0x02ee, 0x0274,
+	    0x0211, 0x0207, 0x00cb, 0x0084, 0x0272, 0x019b, 0x03a2, 0x03b4,
+	    0x02ca, 0x0220, 0x0000, 0x02d8, 0x0350, 0x02d2, 0x0235, 0x0288,
+	    0x02c7, 0x0381, 0x0066, 0x0312, 0x0086, 0x0158, 0x00b7, 0x01c6,
+	    0x010e, 0x00ae, 0x0360, 0x0276, 0x02a8, 0x02d2, 0x025a, 0x0170,
+	    0x0284, 0x0010, 0x0116, 0x0032, 0x02f1, 0x018b, 0x039a, 0x0084,
+	    0x02dc, 0x0152, 0x00c5, 0x0100, 0x0093, 0x0000, 0x03ad, 0x00e5,
+	    0x0366, 0x035f, 0x02dc, 0x0205, 0x025f, 0x0111, 0x02aa, 0x01e7,
+	    0x01eb, 0x0050, 0x0251, 0x0000, 0x02d3, 0x022c, 0x0357, 0x0000,
+	    0x029a, 0x0000, 0x01e9, 0x0022, 0x02ea, 0x006d, 0x0000, 0x03cc,
+	    0x000e, 0x0000, 0x0000, 0x034d, 0x0195, 0x0073, 0x0069, 0x00ae,
+	    0x0000, 0x0000, 0x0000, 0x01f6, 0x03da, 0x0028, 0x00e9, 0x00ff,
+	    0x01e4, 0x0000, 0x0227, 0x0111, 0x0056, 0x0000, 0x02f5, 0x0009,
+	    0x029a, 0x0356, 0x030c, 0x029b, 0x0095, 0x0081, 0x01a7, 0x0000,
+	    0x03d1, 0x0000, 0x014f, 0x021c, 0x00bd, 0x00eb, 0x03c5, 0x0318,
+	    0x0000, 0x0368, 0x03d6, 0x0002, 0x0158, 0x03e6, 0x024d, 0x01da,
+	    0x0000, 0x0024, 0x0000, 0x01c2, 0x033d, 0x0000, 0x0261, 0x022f,
+	    0x0164, 0x0297, 0x0053, 0x0000, 0x0160, 0x03a2, 0x0266, 0x0000,
+	    0x0000, 0x01df, 0x0000, 0x0324, 0x03dd, 0x01c8, 0x01d5, 0x028c,
+	    0x02ec, 0x0000, 0x02d2, 0x0000, 0x0122, 0x0189, 0x0092, 0x0000,
+	    0x0011, 0x0037, 0x004b, 0x0000, 0x02ab, 0x026a, 0x0184, 0x01ec,
+	    0x016e, 0x00aa, 0x037b, 0x0000, 0x0000, 0x0285, 0x022a, 0x02f5,
+	    0x008a, 0x0080, 0x0133, 0x0067, 0x03ab, 0x0388, 0x0141, 0x0398,
+	    0x0000, 0x0070, 0x008e, 0x0048, 0x00b2, 0x03a8, 0x0047, 0x01e3,
+	    0x0321, 0x0357, 0x0321, 0x0000, 0x02ba, 0x0000, 0x00e3, 0x03d7,
+	    0x0012, 0x0000, 0x00af, 0x00ac, 0x03a3, 0x021d, 0x0041, 0x00a4,
+	    0x01e7, 0x014f, 0x0295, 0x0393, 0x0123, 0x0383, 0x0000, 0x006f,
+	    0x0079, 0x0000, 0x0249, 0x00a8, 0x0000, 0x02c1, 0x0000, 0x0000,
+	    0x025a, 0x016c, 0x0006, 0x00fa, 0x0000, 0x0272, 0x008e, 0x0000,
+	    0x0169, 0x00f3, 0x00ee, 0x0000, 0x037e, 0x0079, 0x0324, 0x02d1,
+	    0x03c2, 0x0000, 0x01bc, 0x0000, 0x0000, 0x005a, 0x03aa, 0x00c3,
+	    0x02ee, 0x01c2, 0x0197, 0x00b8, 0x005e, 0x007b, 0x00b5, 0x0000,
+	    0x00e6, 0x0187, 0x00db, 0x036a, 0x0244, 0x0294, 0x0036, 0x0146,
+	    0x01b4, 0x033a, 0x0000, 0x014f, 0x0000, 0x03aa, 0x0000, 0x0291,
+	    0x01f8, 0x03c9, 0x0085, 0x02ab, 0x039d, 0x00b1, 0x0000, 0x0107,
+	    0x0121, 0x026b, 0x0038, 0x02fe, 0x0280, 0x02bb, 0x0216, 0x036e,
+	    0x03de, 0x0205, 0x00dd, 0x0130, 0x0005, 0x0300, 0x0002, 0x0114,
+	    0x025d, 0x0012, 0x0193, 0x0000, 0x0000, 0x0024, 0x0000, 0x0232,
+	    0x01d0, 0x00db, 0x03a4, 0x03de, 0x032c, 0x0110, 0x0220, 0x0229,
+	    0x012a, 0x0000, 0x0000, 0x0025, 0x0160, 0x0198, 0x0152, 0x02b5,
+	    0x02e8, 0x0078, 0x0307, 0x0216, 0x0000, 0x00a7, 0x0000, 0x012b,
+	    0x0000, 0x0385, 0x03e7, 0x0050, 0x0000, 0x029a, 0x0093, 0x0359,
+	    0x0000, 0x01ed, 0x0285, 0x02bf, 0x002b, 0x02b2, 0x0000, 0x0000,
+	    0x028e, 0x0000, 0x0021, 0x025b, 0x02dc, 0x02c6, 0x0189, 0x0252,
+	    0x0354, 0x0000, 0x0000, 0x0359, 0x0000, 0x0111, 0x00c6, 0x0000,
+	    0x0203, 0x0000, 0x0000, 0x0000, 0x01f0, 0x01ef, 0x032b, 0x0217,
+	    0x02b3, 0x0026, 0x02b7, 0x0000, 0x002a, 0x018f, 0x02d2, 0x00e0,
+	    0x029c, 0x0184, 0x03de, 0x0000, 0x02f6, 0x0000, 0x0388, 0x0036,
+	    0x0217, 0x02af, 0x0000, 0x0311, 0x03a4, 0x03c5, 0x0000, 0x0354,
+	    0x01c8, 0x0000, 0x014b, 0x022f, 0x0116, 0x0000, 0x02ed, 0x02ae,
+	    0x0388, 0x03e6, 0x021d, 0x0090, 0x004e, 0x00ed, 0x0056, 0x0192,
+	    0x0309, 0x0000, 0x0348, 0x037a, 0x0108, 0x0000, 0x0000, 0x01fa,
+	    0x02b3, 0x0337, 0x0068, 0x0000, 0x0320, 0x0160, 0x0000, 0x0068,
+	    0x0221, 0x035a, 0x01d4, 0x0271, 0x0163, 0x0346, 0x0000, 0x0000,
+	    0x0206, 0x0151, 0x0165, 0x0000, 0x00b1, 0x01d0, 0x020d, 0x02b2,
+	    0x0136, 0x0230, 0x00c3, 0x0124, 0x027b, 0x01c7, 0x03b7, 0x00bc,
+	    0x004a, 0x012a, 0x0164, 0x002e, 0x00b9, 0x0000, 0x024f, 0x0075,
+	    0x01b1, 0x0000, 0x026c, 0x0000, 0x0337, 0x00b8, 0x0002, 0x0306,
+	    0x0000, 0x0000, 0x023a, 0x001d, 0x022c, 0x026b, 0x00c0, 0x0347,
+	    0x024d, 0x00d9, 0x0344, 0x0000, 0x0000, 0x0088, 0x0104, 0x0281,
+	    0x00bd, 0x026a, 0x0325, 0x028f, 0x0345, 0x01ea, 0x0179, 0x0221,
+	    0x0381, 0x0000, 0x0000, 0x01e0, 0x02e1, 0x03be, 0x0385, 0x0000,
+	    0x03a2, 0x0029, 0x01ec, 0x029b, 0x0000, 0x025c, 0x0384, 0x038d,
+	    0x01e1, 0x0123, 0x00ce, 0x00b4, 0x0000, 0x0300, 0x02e7, 0x0198,
+	    0x02be, 0x00af, 0x017a, 0x0001, 0x02fd, 0x030f, 0x00ac, 0x03e1,
+	    0x0362, 0x03d9, 0x00bf, 0x01b3, 0x0000, 0x01d9, 0x0053, 0x0093,
+	    0x0210, 0x025b, 0x0275, 0x01dd, 0x00bd, 0x01f4, 0x0000, 0x02aa,
+	    0x009a, 0x0023, 0x02ff, 0x0000, 0x00df, 0x0324, 0x03ac, 0x001f,
+	    0x007f, 0x0000, 0x0162, 0x01f1, 0x03be, 0x0120, 0x0127, 0x0392,
+	    0x03d4, 0x0000, 0x014d, 0x0000, 0x0384, 0x0000, 0x0108, 0x0000,
+	    0x03b6, 0x0149, 0x0211, 0x0000, 0x014a, 0x0006, 0x01aa, 0x00cd,
+	    0x016a, 0x0291, 0x0000, 0x0301, 0x029d, 0x0298, 0x0100, 0x0000,
+	    0x0020, 0x0167, 0x00b1, 0x00f0, 0x0393, 0x0000, 0x02dd, 0x030b,
+	    0x0000,
+	};
+	uint16_t h[8];
+
+	fnv3(key, keylen, UINT64_C(0x19495cff74b0dc51), (uint64_t*)h);
+
+	h[0] = h[0] % 1241;
+	h[1] = h[1] % 1241;
+	h[2] = h[2] % 1241;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 1000;
+}
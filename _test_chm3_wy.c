@@ -0,0 +1,3120 @@
+/* generated with rurban/nbperf 08a5797  /tmp/words */
+/* seed[0]: 304089172, seed[1]: 1303455736 */
+#include <stdint.h>
+#include "mi_wyhash.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[24801] = {
+	    0x2b72, 0x3ca7, 0x3e03, 0x40e0, 0x195c, 0x353b, 0x2d6a, 0x481a,
+	    0x35ce, 0x4b6f, 0x02c7, 0x03a1, 0x208d, 0x0f32, 0x48b4, 0x0dba,
+	    0x48d0, 0x35d9, 0x44c2, 0x44bb, 0x38d8, 0x25c9, 0x2877, 0x47e1,
+	    0x1bc9, 0x0d21, 0x4d7e, 0x39c3, 0x3f64, 0x03d3, 0x2c65, 0x281a,
+	    0x1eaf, 0x482b, 0x3656, 0x0000, 0x02d0, 0x2ad0, 0x30b7, 0x3925,
+	    0x0000, 0x0000, 0x0000, 0x2765, 0x4416, 0x2874, 0x2a0f, 0x0000,
+	    0x2ce4, 0x1666, 0x2999, 0x0000, 0x3394, 0x0f27, 0x3525, 0x0ddd,
+	    0x0389, 0x4d52, 0x0406, 0x2192, 0x264e, 0x1bfc, 0x205f, 0x1ef0,
+	    0x0b7c, 0x0000, 0x1951, 0x024e, 0x0000, 0x0cac, 0x0000, 0x444b,
+	    0x25f2, 0x00e1, 0x32e1, 0x1471, 0x4704, 0x054e, 0x4af0, 0x01ad,
+	    0x1b0f, 0x3967, 0x26de, 0x0000, 0x192b, 0x4354, 0x0000, 0x0b2d,
+	    0x0000, 0x365a, 0x235c, 0x1bac, 0x00aa, 0x39c7, 0x0000, 0x1e84,
+	    0x31d3, 0x12ce, 0x1f84, 0x0c09, 0x1413, 0x3e16, 0x1133, 0x204b,
+	    0x2d6f, 0x0114, 0x0747, 0x35a2, 0x25a3, 0x464c, 0x2ca4, 0x3ade,
+	    0x4b89, 0x0000, 0x0964, 0x3f09, 0x0387, 0x1d85, 0x410b, 0x0893,
+	    0x2104, 0x326d, 0x3437, 0x263a, 0x3ac7, 0x1f6d, 0x302c, 0x39e9,
+	    0x27b5, 0x47b6, 0x210a, 0x0000, 0x0000, 0x4836, 0x0000, 0x491d,
+	    0x3730, 0x428a, 0x2b46, 0x035c, 0x000e, 0x2b46, 0x0263, 0x20e1,
+	    0x0000, 0x2a93, 0x0b8d, 0x4210, 0x18a2, 0x4175, 0x0f96, 0x0000,
+	    0x4ac6, 0x0000, 0x1ba5, 0x0f50, 0x145d, 0x0a9a, 0x4b20, 0x143b,
+	    0x0000, 0x21b8, 0x15c8, 0x0000, 0x3f53, 0x328d, 0x0c31, 0x2f39,
+	    0x0514, 0x0000, 0x20ea, 0x08c5, 0x3eed, 0x0000, 0x0000, 0x05f4,
+	    0x4c30, 0x14cd, 0x0000, 0x3666, 0x46d2, 0x0042, 0x309b, 0x4931,
+	    0x4a5d, 0x331f, 0x03b5, 0x1569, 0x398a, 0x1bbd, 0x1926, 0x1b3a,
+	    0x40ad, 0x3fb2, 0x0011, 0x444f, 0x4b94, 0x0f35, 0x36c8, 0x0831,
+	    0x3a3a, 0x1eba, 0x4a12, 0x2eed, 0x4e18, 0x0869, 0x0ab6, 0x2cb0,
+	    0x1881, 0x1cc9, 0x46fd, 0x0bff, 0x3116, 0x0000, 0x2cf4, 0x490c,
+	    0x2dd7, 0x37f6, 0x285b, 0x3a63, 0x2e35, 0x2520, 0x1dab, 0x1a3e,
+	    0x49eb, 0x1fb2, 0x2cdd, 0x3eff, 0x4b89, 0x1445, 0x27aa, 0x12dc,
+	    0x4196, 0x1c7c, 0x4578, 0x37e1, 0x0000, 0x03c1, 0x066b, 0x27af,
+	    0x38ba, 0x2d51, 0x3b88, 0x4712, 0x18f7, 0x11b5, 0x2b48, 0x1415,
+	    0x3620, 0x3abf, 0x295d, 0x0000, 0x0c5c, 0x418b, 0x0258, 0x4040,
+	    0x3948, 0x0000, 0x20d1, 0x0000, 0x07ef, 0x26c8, 0x4697, 0x1333,
+	    0x33f4, 0x0000, 0x2cf4, 0x0000, 0x334b, 0x378d, 0x10b5, 0x0000,
+	    0x0000, 0x060b, 0x0000, 0x2d86, 0x02a5, 0x0000, 0x26cb, 0x0db0,
+	    0x0fc5, 0x0000, 0x082e, 0x0cca, 0x02db, 0x0000, 0x0000, 0x167f,
+	    0x0e61, 0x4838, 0x3180, 0x364f, 0x2e1c, 0x0000, 0x3646, 0x225c,
+	    0x0758, 0x1098, 0x0430, 0x1f2c, 0x146c, 0x0331, 0x3961, 0x0fe4,
+	    0x3b5e, 0x0751, 0x050f, 0x334d, 0x0000, 0x0000, 0x4cf2, 0x405d,
+	    0x2fe2, 0x47cb, 0x2c3d, 0x2542, 0x0000, 0x43af, 0x0af5, 0x1fd7,
+	    0x2ea5, 0x1502, 0x4ae7, 0x0fc2, 0x1568, 0x04cb, 0x0000, 0x48ff,
+	    0x4833, 0x4bc8, 0x2265, 0x38a6, 0x0536, 0x0fb8, 0x0000, 0x0000,
+	    0x4d59, 0x1952, 0x1f53, 0x0000, 0x2d7d, 0x0fb5, 0x0000, 0x198c,
+	    0x105e, 0x0000, 0x4601, 0x1409, 0x2ae1, 0x46ca, 0x0000, 0x4c5a,
+	    0x0d85, 0x0000, 0x3bce, 0x0000, 0x2251, 0x2ce8, 0x2b1a, 0x361a,
+	    0x0000, 0x0e10, 0x0b55, 0x1eaa, 0x3ec3, 0x48d7, 0x1404, 0x01c8,
+	    0x2a40, 0x289f, 0x2137, 0x0adf, 0x1cbb, 0x007f, 0x3e41, 0x1278,
+	    0x208d, 0x17e2, 0x0000, 0x0000, 0x2583, 0x0464, 0x3418, 0x2f1c,
+	    0x2197, 0x2f29, 0x16b2, 0x179b, 0x2631, 0x03b8, 0x1b4d, 0x16ff,
+	    0x4c8b, 0x2f65, 0x1111, 0x0000, 0x0218, 0x4619, 0x3d5a, 0x18d4,
+	    0x2b31, 0x2c1a, 0x4d7d, 0x0000, 0x28ef, 0x1bb5, 0x2a5a, 0x34ad,
+	    0x16ad, 0x4b5b, 0x2438, 0x0000, 0x2510, 0x4987, 0x0a4b, 0x46c9,
+	    0x47a3, 0x0000, 0x24e0, 0x0000, 0x4778, 0x0000, 0x34bd, 0x28f7,
+	    0x1ebd, 0x11c3, 0x1a4f, 0x1383, 0x1cd3, 0x0399, 0x236c, 0x1852,
+	    0x1095, 0x0000, 0x0000, 0x2b0a, 0x328c, 0x06c1, 0x1165, 0x3cdb,
+	    0x1c5c, 0x4d41, 0x0c72, 0x0b67, 0x4893, 0x13ed, 0x393a, 0x47b7,
+	    0x4967, 0x36a6, 0x066b, 0x2b8f, 0x2696, 0x0000, 0x33ca, 0x4483,
+	    0x3600, 0x14d9, 0x448a, 0x2aa9, 0x264a, 0x33b0, 0x38b4, 0x2acb,
+	    0x20cd, 0x4947, 0x0749, 0x42ae, 0x07d6, 0x41c1, 0x29d0, 0x0000,
+	    0x0daf, 0x0000, 0x4360, 0x0000, 0x0000, 0x0d84, 0x1486, 0x1ea5,
+	    0x0b8f, 0x26e7, 0x1bf9, 0x0100, 0x2214, 0x45c8, 0x0000, 0x1a43,
+	    0x298c, 0x3e9c, 0x0000, 0x304e, 0x0000, 0x352c, 0x2ede, 0x0bc7,
+	    0x4dc5, 0x11e3, 0x3207, 0x0050, 0x2a4a, 0x21c8, 0x110b, 0x0000,
+	    0x0ac7, 0x23c4, 0x356a, 0x39da, 0x1a01, 0x3af0, 0x4d0b, 0x0000,
+	    0x0000, 0x11f3, 0x3aae, 0x3796, 0x428e, 0x2eac, 0x3f7f, 0x16a5,
+	    0x35de, 0x0d67, 0x3b58, 0x0021, 0x4318, 0x0000, 0x4476, 0x0000,
+	    0x29f7, 0x0000, 0x0000, 0x1958, 0x0757, 0x14f8, 0x0000, 0x0f26,
+	    0x0000, 0x0000, 0x0000, 0x3fd5, 0x20c9, 0x0000, 0x0000, 0x03a0,
+	    0x3baa, 0x0000, 0x45c0, 0x0000, 0x290f, 0x44dc, 0x4c19, 0x04de,
+	    0x286f, 0x4bc0, 0x4a73, 0x3c76, 0x1a2c, 0x0ece, 0x0f75, 0x20b2,
+	    0x3f91, 0x2b96, 0x3721, 0x0b70, 0x1dd4, 0x1152, 0x16c5, 0x2f3d,
+	    0x41ad, 0x3068, 0x433b, 0x0000, 0x335c, 0x0a96, 0x0104, 0x1fe7,
+	    0x0568, 0x0192, 0x0000, 0x0b5d, 0x1f29, 0x2ab8, 0x47a2, 0x0913,
+	    0x46f4, 0x2ec1, 0x3117, 0x4b24, 0x1f25, 0x0000, 0x0000, 0x22c9,
+	    0x40bf, 0x3365, 0x28e9, 0x116e, 0x1c41, 0x25b2, 0x23af, 0x2a12,
+	    0x2561, 0x2929, 0x3476, 0x214b, 0x01d2, 0x1924, 0x0000, 0x2508,
+	    0x1e7f, 0x0000, 0x1dd0, 0x3f80, 0x0b06, 0x0cea, 0x3920, 0x41d3,
+	    0x3901, 0x0000, 0x37e2, 0x35e9, 0x3b6f, 0x0000, 0x0000, 0x0000,
+	    0x2f7b, 0x09dd, 0x0000, 0x27a2, 0x08f8, 0x20ea, 0x20b5, 0x224d,
+	    0x41c5, 0x0000, 0x277e, 0x3010, 0x12a4, 0x4189, 0x0f46, 0x29b9,
+	    0x1b4b, 0x3d48, 0x445d, 0x2bad, 0x4832, 0x108b, 0x4bbc, 0x1bf4,
+	    0x0000, 0x20eb, 0x0000, 0x4896, 0x1b85, 0x0000, 0x018c, 0x0c96,
+	    0x1d91, 0x0000, 0x0e69, 0x49ad, 0x1f31, 0x161d, 0x2769, 0x018f,
+	    0x2eb9, 0x3c20, 0x3033, 0x2fc2, 0x4552, 0x49e7, 0x0bd6, 0x1574,
+	    0x365d, 0x2254, 0x1115, 0x0422, 0x0000, 0x448f, 0x1931, 0x0a6e,
+	    0x0000, 0x1a65, 0x20b1, 0x40f9, 0x0000, 0x0855, 0x2a97, 0x3154,
+	    0x0000, 0x4cb9, 0x0286, 0x3bc2, 0x30fd, 0x3249, 0x1eb7, 0x0000,
+	    0x1c0e, 0x147e, 0x0000, 0x0953, 0x1871, 0x1bf1, 0x172e, 0x004a,
+	    0x2177, 0x4d37, 0x28ca, 0x0e01, 0x0b66, 0x0000, 0x0c49, 0x1fe4,
+	    0x4012, 0x1bc4, 0x0000, 0x1e8e, 0x03c6, 0x0000, 0x160e, 0x34de,
+	    0x45bd, 0x3ae4, 0x0000, 0x170c, 0x02a4, 0x0433, 0x298c, 0x0000,
+	    0x0000, 0x0bdf, 0x38ae, 0x2f88, 0x3066, 0x255e, 0x3401, 0x0000,
+	    0x0b8f, 0x1163, 0x17a0, 0x442a, 0x0064, 0x03a4, 0x3871, 0x0000,
+	    0x0000, 0x23ce, 0x0000, 0x0502, 0x2162, 0x0000, 0x0000, 0x0000,
+	    0x1c47, 0x2850, 0x4bdf, 0x052b, 0x1691, 0x0000, 0x131a, 0x03fc,
+	    0x48b6, 0x249e, 0x0c27, 0x0000, 0x3f52, 0x0560, 0x0c59, 0x0000,
+	    0x0572, 0x0000, 0x2c0e, 0x1d7d, 0x0f56, 0x124a, 0x2636, 0x0000,
+	    0x0cdd, 0x0157, 0x1693, 0x3afe, 0x1583, 0x2a29, 0x39b9, 0x1549,
+	    0x0000, 0x33fb, 0x0000, 0x0000, 0x0000, 0x344e, 0x2192, 0x3c86,
+	    0x1da4, 0x1dbb, 0x0000, 0x0cfd, 0x11fa, 0x0000, 0x2e02, 0x0000,
+	    0x2cdd, 0x0000, 0x475d, 0x39e4, 0x0000, 0x36bc, 0x37f4, 0x15f2,
+	    0x423c, 0x1b5c, 0x0225, 0x4676, 0x4ca9, 0x0000, 0x222b, 0x41c9,
+	    0x0000, 0x2f15, 0x3e1c, 0x4e19, 0x2704, 0x2005, 0x0958, 0x2256,
+	    0x12aa, 0x0000, 0x246b, 0x4200, 0x0117, 0x19bd, 0x0001, 0x1ca9,
+	    0x05c6, 0x4a52, 0x2f19, 0x3707, 0x2572, 0x3c66, 0x0000, 0x0358,
+	    0x09f0, 0x0a53, 0x3f8c, 0x1f29, 0x3105, 0x4546, 0x1d0e, 0x2cb5,
+	    0x09fb, 0x0000, 0x3512, 0x1620, 0x079e, 0x3823, 0x0000, 0x0b4f,
+	    0x1daa, 0x0b1d, 0x0582, 0x0000, 0x24c5, 0x3c7e, 0x4847, 0x2a26,
+	    0x1ca4, 0x4301, 0x1536, 0x2f85, 0x3695, 0x14d8, 0x0685, 0x3ac2,
+	    0x1844, 0x4901, 0x1535, 0x46fe, 0x32cd, 0x0000, 0x3417, 0x2a5c,
+	    0x3201, 0x37b0, 0x4060, 0x0000, 0x4b08, 0x3b61, 0x03de, 0x3808,
+	    0x4b51, 0x36fc, 0x0047, 0x0822, 0x0000, 0x1937, 0x02a9, 0x26fe,
+	    0x25fe, 0x0000, 0x2c4a, 0x2c21, 0x36d7, 0x056f, 0x0299, 0x2a60,
+	    0x42f6, 0x0161, 0x0fc1, 0x0e46, 0x39e4, 0x3392, 0x1836, 0x0000,
+	    0x1182, 0x0517, 0x0c28, 0x0000, 0x3ca8, 0x15bd, 0x08fd, 0x1108,
+	    0x1c8d, 0x180f, 0x0000, 0x34ab, 0x2f2b, 0x1108, 0x4542, 0x42dc,
+	    0x1d32, 0x079c, 0x0000, 0x0be3, 0x07ce, 0x0dc2, 0x0936, 0x1edc,
+	    0x1662, 0x2bae, 0x0000, 0x0a0e, 0x0000, 0x4a2c, 0x11bc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x2199, 0x21ca, 0x360d, 0x3ed0, 0x0e3b,
+	    0x3369, 0x1378, 0x0369, 0x38a1, 0x0dd0, 0x0c00, 0x05dc, 0x44b0,
+	    0x0000, 0x2159, 0x0000, 0x0000, 0x1038, 0x0000, 0x24b7, 0x05d6,
+	    0x2b07, 0x1908, 0x349c, 0x4d97, 0x4c85, 0x0000, 0x0c21, 0x3aa9,
+	    0x4439, 0x18de, 0x382e, 0x1e29, 0x2148, 0x0000, 0x1b78, 0x104b,
+	    0x28f6, 0x0307, 0x1f67, 0x0000, 0x30c2, 0x1073, 0x0131, 0x1642,
+	    0x3c26, 0x4695, 0x00ce, 0x0664, 0x0000, 0x2895, 0x1783, 0x47fc,
+	    0x382e, 0x2fba, 0x1cc6, 0x04f8, 0x0000, 0x159e, 0x0000, 0x1ae9,
+	    0x0000, 0x315f, 0x171a, 0x489c, 0x0000, 0x0000, 0x1094, 0x0000,
+	    0x0000, 0x3438, 0x2970, 0x247f, 0x0000, 0x2ab5, 0x0000, 0x1c1c,
+	    0x0f45, 0x28ac, 0x1bd7, 0x312e, 0x1d4d, 0x357c, 0x3990, 0x0273,
+	    0x0db8, 0x0000, 0x0023, 0x0000, 0x39d9, 0x2a18, 0x0000, 0x0914,
+	    0x1aae, 0x0000, 0x0000, 0x1704, 0x01e5, 0x166d, 0x0031, 0x0306,
+	    0x3950, 0x0000, 0x3419, 0x4ac9, 0x1952, 0x02a2, 0x34b8, 0x2780,
+	    0x15c7, 0x0c27, 0x3b52, 0x23a8, 0x14df, 0x0000, 0x3866, 0x1d1c,
+	    0x0b58, 0x2ac6, 0x0000, 0x2958, 0x2edf, 0x0000, 0x3e01, 0x0000,
+	    0x3fdd, 0x20ef, 0x055b, 0x0f71, 0x40df, 0x2202, 0x49f7, 0x42ca,
+	    0x494a, 0x1442, 0x039e, 0x39d8, 0x440a, 0x263c, 0x47ce, 0x072d,
+	    0x42db, 0x3e05, 0x2824, 0x2735, 0x387e, 0x0230, 0x0b0f, 0x0000,
+	    0x0000, 0x279c, 0x29d8, 0x1001, 0x36a0, 0x1408, 0x04ab, 0x22cb,
+	    0x1b94, 0x43f8, 0x3570, 0x3dee, 0x3a9a, 0x2e4e, 0x11b7, 0x0000,
+	    0x1554, 0x2032, 0x0000, 0x1058, 0x04dc, 0x2daf, 0x3385, 0x0000,
+	    0x48ae, 0x0000, 0x4877, 0x13e2, 0x0000, 0x4197, 0x4b58, 0x0000,
+	    0x0000, 0x0351, 0x3afa, 0x0000, 0x0000, 0x0000, 0x0d1b, 0x31bf,
+	    0x1dc0, 0x2804, 0x0e06, 0x0000, 0x2edd, 0x2597, 0x2b63, 0x107b,
+	    0x1c76, 0x2eeb, 0x2124, 0x36da, 0x074f, 0x1d34, 0x3e64, 0x319e,
+	    0x11f5, 0x3981, 0x01cd, 0x377a, 0x28d8, 0x3f11, 0x4aa5, 0x3b4b,
+	    0x3f32, 0x2e8e, 0x411c, 0x466a, 0x0000, 0x47d8, 0x0000, 0x48df,
+	    0x0000, 0x3b68, 0x418a, 0x2d3c, 0x2cc8, 0x0000, 0x3d62, 0x2a7e,
+	    0x49cd, 0x1f32, 0x0000, 0x1468, 0x45ee, 0x4bfe, 0x0000, 0x028f,
+	    0x0000, 0x317a, 0x4382, 0x0000, 0x2286, 0x1523, 0x4313, 0x1021,
+	    0x0000, 0x0000, 0x4212, 0x049e, 0x29df, 0x0000, 0x0000, 0x0000,
+	    0x1649, 0x296f, 0x238a, 0x01a2, 0x4444, 0x0000, 0x25fc, 0x3703,
+	    0x40b4, 0x1445, 0x1c3b, 0x082d, 0x0000, 0x20c4, 0x0000, 0x33e8,
+	    0x0d81, 0x2af6, 0x080f, 0x2d62, 0x0e5d, 0x0906, 0x0000, 0x1120,
+	    0x1549, 0x3430, 0x357d, 0x0000, 0x447d, 0x0000, 0x1712, 0x2eba,
+	    0x2512, 0x4e07, 0x0000, 0x0052, 0x06dd, 0x1f58, 0x221e, 0x3b8d,
+	    0x49cb, 0x315c, 0x0000, 0x3590, 0x4998, 0x494b, 0x3e49, 0x41db,
+	    0x0311, 0x2b93, 0x1e8e, 0x0000, 0x3648, 0x4655, 0x05d7, 0x2ce5,
+	    0x0537, 0x1f8c, 0x2fee, 0x189f, 0x0000, 0x2400, 0x0deb, 0x2817,
+	    0x295f, 0x3100, 0x3330, 0x031f, 0x35a0, 0x3ab1, 0x16a7, 0x0000,
+	    0x3a3f, 0x23f2, 0x1913, 0x335e, 0x3256, 0x0adb, 0x4ce2, 0x0a75,
+	    0x37fc, 0x3c06, 0x0000, 0x0000, 0x2ef3, 0x1986, 0x2c93, 0x10fd,
+	    0x278e, 0x0ced, 0x3657, 0x2d90, 0x27d9, 0x000f, 0x072f, 0x3d55,
+	    0x180c, 0x1316, 0x16d3, 0x3bd5, 0x3c93, 0x320c, 0x485a, 0x3398,
+	    0x0000, 0x32f7, 0x0000, 0x3c84, 0x15b0, 0x306c, 0x23f5, 0x34fa,
+	    0x38db, 0x2435, 0x2477, 0x03d0, 0x45b6, 0x433b, 0x37ea, 0x1055,
+	    0x0000, 0x1b11, 0x0000, 0x10d6, 0x46ec, 0x0000, 0x1282, 0x4603,
+	    0x3607, 0x3cb4, 0x0a0a, 0x26e6, 0x087a, 0x2464, 0x0000, 0x2370,
+	    0x0815, 0x1afb, 0x450a, 0x4aaa, 0x0a53, 0x43b8, 0x2979, 0x2841,
+	    0x0ed5, 0x0000, 0x1c71, 0x4645, 0x1cba, 0x3f9c, 0x0000, 0x0000,
+	    0x1502, 0x0000, 0x0f17, 0x0000, 0x3233, 0x0000, 0x2a30, 0x2b8c,
+	    0x2776, 0x0000, 0x0000, 0x05c3, 0x0000, 0x1624, 0x39e0, 0x05ae,
+	    0x3668, 0x4314, 0x0000, 0x486c, 0x05e5, 0x0000, 0x3df8, 0x183f,
+	    0x4cfb, 0x2402, 0x422b, 0x01a1, 0x2b78, 0x0000, 0x0546, 0x0000,
+	    0x32fe, 0x4597, 0x271e, 0x3c6f, 0x0000, 0x138d, 0x2945, 0x0a21,
+	    0x3ae9, 0x2fad, 0x3b2b, 0x470c, 0x2db1, 0x0000, 0x26e2, 0x3180,
+	    0x0179, 0x1b41, 0x277e, 0x3a32, 0x0000, 0x15d6, 0x36fc, 0x0537,
+	    0x0ac9, 0x0000, 0x23bf, 0x3998, 0x2fca, 0x0000, 0x0000, 0x0409,
+	    0x4a07, 0x222c, 0x0667, 0x0e53, 0x0000, 0x2545, 0x49e7, 0x4479,
+	    0x46cf, 0x1f0e, 0x1007, 0x34c5, 0x0173, 0x483a, 0x45c9, 0x0f4b,
+	    0x0b26, 0x0000, 0x098e, 0x35de, 0x23b5, 0x4d65, 0x0000, 0x0000,
+	    0x4d3a, 0x15f5, 0x1326, 0x366e, 0x0de5, 0x1109, 0x0fcc, 0x1c03,
+	    0x0ede, 0x2c74, 0x2a30, 0x1199, 0x4b66, 0x0000, 0x132a, 0x079b,
+	    0x4022, 0x39b6, 0x338c, 0x0000, 0x2225, 0x2896, 0x4888, 0x3d5d,
+	    0x0735, 0x2a3d, 0x24c1, 0x1161, 0x3509, 0x02e0, 0x2766, 0x2e8e,
+	    0x13d3, 0x3c24, 0x3dec, 0x0730, 0x2f48, 0x1feb, 0x2176, 0x4800,
+	    0x44dd, 0x0ce8, 0x43b7, 0x248c, 0x1a72, 0x17b8, 0x2eb1, 0x3006,
+	    0x3bd2, 0x421a, 0x0000, 0x0000, 0x1aea, 0x126c, 0x154a, 0x10ee,
+	    0x1aa0, 0x13e1, 0x3fdf, 0x40eb, 0x02f9, 0x1281, 0x1118, 0x0c7d,
+	    0x0000, 0x1cc2, 0x0000, 0x2868, 0x2059, 0x4761, 0x20ce, 0x4885,
+	    0x2a3e, 0x4cc2, 0x2a2f, 0x252d, 0x4a5e, 0x4cda, 0x2cad, 0x06c5,
+	    0x15ff, 0x0000, 0x0df2, 0x042f, 0x132e, 0x1eef, 0x424d, 0x3df9,
+	    0x4c70, 0x08fd, 0x32bd, 0x329f, 0x0000, 0x3907, 0x0000, 0x0000,
+	    0x39dc, 0x1d22, 0x2bf8, 0x0000, 0x0000, 0x0382, 0x263e, 0x229d,
+	    0x1155, 0x11df, 0x4a09, 0x0000, 0x0000, 0x4691, 0x32e5, 0x40bf,
+	    0x0000, 0x20be, 0x11c1, 0x29da, 0x43da, 0x0000, 0x00aa, 0x07c8,
+	    0x0000, 0x3e6c, 0x0aa3, 0x3107, 0x1058, 0x2948, 0x45f1, 0x183f,
+	    0x05a9, 0x0b00, 0x1c20, 0x0000, 0x3cc0, 0x476b, 0x3a2c, 0x1a8a,
+	    0x18da, 0x0000, 0x3c29, 0x01d3, 0x0000, 0x4343, 0x467e, 0x0000,
+	    0x0930, 0x3e55, 0x0e77, 0x0a17, 0x037f, 0x05ef, 0x434d, 0x1411,
+	    0x344d, 0x1084, 0x4074, 0x2c1f, 0x3a5a, 0x36ac, 0x41bd, 0x3e8d,
+	    0x217e, 0x3d52, 0x0000, 0x2fa1, 0x1fa4, 0x02b3, 0x3034, 0x1fdc,
+	    0x4aa1, 0x0ada, 0x1fb4, 0x0992, 0x0000, 0x4550, 0x0000, 0x0000,
+	    0x37ff, 0x409a, 0x1fbb, 0x0000, 0x12c5, 0x1c51, 0x0000, 0x30a4,
+	    0x3b8a, 0x435d, 0x4358, 0x3142, 0x33c7, 0x068d, 0x0000, 0x1776,
+	    0x22d5, 0x00bc, 0x096f, 0x2900, 0x00a8, 0x0000, 0x327d, 0x0000,
+	    0x2082, 0x15f8, 0x24ff, 0x331b, 0x1643, 0x291e, 0x47e0, 0x1641,
+	    0x1753, 0x05b8, 0x1dc9, 0x48ee, 0x115f, 0x0000, 0x3234, 0x45f7,
+	    0x4ac2, 0x0000, 0x3366, 0x1257, 0x08a2, 0x3fdf, 0x1fe8, 0x4832,
+	    0x2ea2, 0x3096, 0x0000, 0x2327, 0x0000, 0x03c7, 0x4be3, 0x1399,
+	    0x0cbd, 0x40f5, 0x0000, 0x2a38, 0x4111, 0x0ee3, 0x07c7, 0x0335,
+	    0x485d, 0x20b8, 0x3968, 0x0000, 0x1d72, 0x377b, 0x282e, 0x0391,
+	    0x0000, 0x2f4f, 0x16c7, 0x281c, 0x0e6d, 0x1aca, 0x172b, 0x0000,
+	    0x047b, 0x289e, 0x3353, 0x0000, 0x07d1, 0x0000, 0x29ae, 0x0370,
+	    0x4467, 0x37cd, 0x3bd2, 0x0f57, 0x00a3, 0x1570, 0x4c40, 0x2c0b,
+	    0x285f, 0x0000, 0x445d, 0x3590, 0x2ca6, 0x256d, 0x2b70, 0x4250,
+	    0x203c, 0x1025, 0x0e55, 0x310d, 0x43c5, 0x47b3, 0x1e15, 0x0000,
+	    0x0000, 0x2ed5, 0x1a37, 0x4c15, 0x4ca6, 0x2726, 0x1561, 0x0000,
+	    0x0369, 0x392d, 0x0000, 0x02ba, 0x18b8, 0x26f9, 0x15dc, 0x0000,
+	    0x42c4, 0x0743, 0x3366, 0x06cd, 0x1a41, 0x0000, 0x00d3, 0x2ee7,
+	    0x0000, 0x2815, 0x08e0, 0x29a7, 0x13a1, 0x1edd, 0x3c56, 0x38a1,
+	    0x0000, 0x483d, 0x1755, 0x2713, 0x14c0, 0x409e, 0x1e36, 0x32f3,
+	    0x4d13, 0x2687, 0x0000, 0x3f61, 0x0ee8, 0x4061, 0x48ab, 0x0000,
+	    0x12cc, 0x4d15, 0x0db2, 0x354a, 0x24fe, 0x3e5d, 0x4814, 0x3cd7,
+	    0x0000, 0x20c5, 0x0000, 0x2fc3, 0x1c68, 0x0000, 0x4bf8, 0x2f05,
+	    0x0000, 0x0000, 0x1016, 0x0000, 0x0000, 0x4539, 0x182c, 0x0000,
+	    0x0000, 0x0000, 0x3be9, 0x47d0, 0x0000, 0x4214, 0x1a0d, 0x446c,
+	    0x0d0d, 0x32e4, 0x0000, 0x2289, 0x2242, 0x0000, 0x0000, 0x2cde,
+	    0x4aac, 0x2d76, 0x2f38, 0x40d2, 0x1e0b, 0x09ee, 0x3763, 0x38bf,
+	    0x0000, 0x3830, 0x2064, 0x349d, 0x0a38, 0x0975, 0x08fe, 0x085e,
+	    0x2135, 0x1c3d, 0x346b, 0x0290, 0x0000, 0x2562, 0x1463, 0x0000,
+	    0x0000, 0x3685, 0x0000, 0x0000, 0x3882, 0x08de, 0x3d22, 0x445a,
+	    0x0000, 0x4113, 0x0bb7, 0x07e0, 0x45ff, 0x0000, 0x13a0, 0x4216,
+	    0x2831, 0x434d, 0x1774, 0x32ce, 0x0000, 0x27b4, 0x0000, 0x0000,
+	    0x2231, 0x2f05, 0x06b1, 0x01b8, 0x4c8d, 0x0442, 0x19cf, 0x0000,
+	    0x236c, 0x1f45, 0x4975, 0x344a, 0x2758, 0x0000, 0x303b, 0x25e7,
+	    0x2ddf, 0x1b62, 0x358e, 0x424a, 0x347a, 0x0000, 0x04e3, 0x18fb,
+	    0x033d, 0x188c, 0x0280, 0x1693, 0x2ae4, 0x26a8, 0x3afa, 0x3ca6,
+	    0x32b4, 0x3d0b, 0x22b2, 0x3579, 0x0112, 0x2263, 0x1cc7, 0x0000,
+	    0x0585, 0x31b4, 0x111c, 0x17d9, 0x02ad, 0x3e83, 0x3d40, 0x4038,
+	    0x0000, 0x0000, 0x0f96, 0x2911, 0x1545, 0x0000, 0x3367, 0x4d19,
+	    0x1c9a, 0x1d18, 0x006a, 0x0893, 0x150e, 0x43b4, 0x3747, 0x0000,
+	    0x1e65, 0x4a68, 0x2a29, 0x1754, 0x3104, 0x0ff2, 0x4b1c, 0x304d,
+	    0x3c1d, 0x2181, 0x3710, 0x46d6, 0x34a5, 0x1a95, 0x12d1, 0x34e6,
+	    0x3589, 0x0000, 0x141f, 0x02b8, 0x0000, 0x451c, 0x203a, 0x0439,
+	    0x0000, 0x0b2d, 0x0000, 0x2d98, 0x28c5, 0x1fac, 0x231c, 0x0e3f,
+	    0x4ccc, 0x024b, 0x1404, 0x2e8d, 0x3386, 0x0b4e, 0x454f, 0x0000,
+	    0x1105, 0x1755, 0x0000, 0x2d5a, 0x16cf, 0x0e99, 0x15e6, 0x4b31,
+	    0x132e, 0x2897, 0x0e16, 0x20fa, 0x183c, 0x0b09, 0x4699, 0x0000,
+	    0x0000, 0x0000, 0x3b50, 0x4da9, 0x0c78, 0x0000, 0x4471, 0x2020,
+	    0x1f0f, 0x1b51, 0x0000, 0x0000, 0x0000, 0x2874, 0x4255, 0x3e6f,
+	    0x3e27, 0x0000, 0x4bc8, 0x262b, 0x227b, 0x2463, 0x0112, 0x2f04,
+	    0x0d7b, 0x2a2e, 0x3073, 0x1488, 0x1e4e, 0x0000, 0x0936, 0x1b54,
+	    0x0000, 0x061f, 0x2095, 0x49ac, 0x389f, 0x27f1, 0x1a6e, 0x35bf,
+	    0x400e, 0x320a, 0x0b2a, 0x245d, 0x25bd, 0x4ac8, 0x0102, 0x1d63,
+	    0x2821, 0x2132, 0x35ff, 0x0125, 0x0000, 0x42a0, 0x0b9f, 0x1182,
+	    0x3073, 0x0000, 0x1994, 0x3102, 0x0b35, 0x00aa, 0x37c1, 0x0000,
+	    0x0dfe, 0x0000, 0x1815, 0x35cc, 0x3db2, 0x30cd, 0x0000, 0x261b,
+	    0x2e3c, 0x0000, 0x2cbc, 0x2fc2, 0x0abd, 0x359e, 0x43c8, 0x3e81,
+	    0x454a, 0x078b, 0x236e, 0x0000, 0x0142, 0x1768, 0x3e55, 0x0abc,
+	    0x092d, 0x4909, 0x239a, 0x3186, 0x1678, 0x39f6, 0x01d9, 0x2427,
+	    0x0000, 0x1e6b, 0x3f99, 0x26ef, 0x104a, 0x1549, 0x1877, 0x24e8,
+	    0x28e3, 0x215c, 0x382f, 0x2e6a, 0x21be, 0x2a85, 0x0000, 0x0000,
+	    0x25b1, 0x0000, 0x1690, 0x3232, 0x0000, 0x2777, 0x0000, 0x0000,
+	    0x32fa, 0x108e, 0x1b77, 0x37aa, 0x0164, 0x0000, 0x3fd7, 0x349a,
+	    0x207e, 0x371f, 0x420a, 0x33ba, 0x1a90, 0x0000, 0x1b96, 0x3bc4,
+	    0x0645, 0x4dba, 0x0000, 0x2210, 0x367a, 0x0000, 0x3c5d, 0x0000,
+	    0x4365, 0x0000, 0x32e2, 0x10de, 0x17e3, 0x0000, 0x1fe8, 0x1ac3,
+	    0x26df, 0x08ce, 0x4742, 0x026d, 0x46a1, 0x083f, 0x34ca, 0x3625,
+	    0x42c6, 0x4950, 0x3076, 0x0000, 0x2973, 0x32d0, 0x0e51, 0x38f3,
+	    0x01d1, 0x250d, 0x3e2c, 0x14f9, 0x0000, 0x2388, 0x4b7b, 0x291e,
+	    0x2e9a, 0x2d9a, 0x3427, 0x182e, 0x2772, 0x0000, 0x2e70, 0x3455,
+	    0x222a, 0x1bd5, 0x1952, 0x2250, 0x0de1, 0x0253, 0x0eb5, 0x4d7f,
+	    0x0000, 0x4d9f, 0x0e19, 0x0bb3, 0x0000, 0x0c16, 0x3851, 0x287b,
+	    0x3cb2, 0x0fb7, 0x40e1, 0x00b4, 0x333e, 0x0eca, 0x3c4b, 0x3d71,
+	    0x4238, 0x1a10, 0x1eb8, 0x2f58, 0x2162, 0x3550, 0x40ec, 0x27ce,
+	    0x4674, 0x310f, 0x2a1c, 0x2bf0, 0x0000, 0x395b, 0x456a, 0x354a,
+	    0x3127, 0x08aa, 0x36ec, 0x2f30, 0x3469, 0x162d, 0x0000, 0x0f90,
+	    0x0b9f, 0x351e, 0x4d6b, 0x01ae, 0x21be, 0x0e6d, 0x08dd, 0x0000,
+	    0x1eb4, 0x4d6b, 0x18c2, 0x32dd, 0x3b9f, 0x0a23, 0x26b9, 0x0000,
+	    0x231e, 0x2a3d, 0x0000, 0x391e, 0x43d3, 0x44b5, 0x1690, 0x1d63,
+	    0x261c, 0x20ec, 0x22ef, 0x4d9d, 0x0000, 0x0000, 0x3c57, 0x2b9e,
+	    0x017c, 0x1473, 0x3eb4, 0x23e0, 0x1244, 0x0000, 0x4186, 0x3f2c,
+	    0x1d44, 0x1421, 0x1dbd, 0x3f7c, 0x2b39, 0x02fb, 0x2159, 0x24a2,
+	    0x3d08, 0x06f8, 0x0000, 0x2186, 0x05c9, 0x4c3d, 0x4a28, 0x42ff,
+	    0x4293, 0x4386, 0x260a, 0x1a4b, 0x0225, 0x3d98, 0x1199, 0x3190,
+	    0x2829, 0x44d9, 0x0529, 0x0150, 0x1dd6, 0x214b, 0x2099, 0x2eb0,
+	    0x30f6, 0x1662, 0x221a, 0x44f9, 0x2153, 0x3124, 0x0618, 0x3577,
+	    0x1730, 0x15b9, 0x1c20, 0x0493, 0x424d, 0x0000, 0x0000, 0x2e86,
+	    0x291d, 0x13e7, 0x0f3d, 0x0716, 0x0f94, 0x2743, 0x3ed7, 0x3ea4,
+	    0x0000, 0x4138, 0x22af, 0x1c24, 0x3c14, 0x0000, 0x13ec, 0x2333,
+	    0x46b4, 0x2c14, 0x10ed, 0x0000, 0x2d9b, 0x3ecd, 0x085f, 0x0000,
+	    0x43dc, 0x00c1, 0x0e54, 0x40ec, 0x0df7, 0x0000, 0x41a7, 0x0062,
+	    0x46df, 0x0ff3, 0x0000, 0x0688, 0x0504, 0x18a3, 0x0682, 0x0729,
+	    0x0000, 0x3b8d, 0x0bcc, 0x1e3e, 0x2cf2, 0x3a8d, 0x0832, 0x04f4,
+	    0x1114, 0x0671, 0x24e6, 0x35cd, 0x1250, 0x2ece, 0x0000, 0x2f4a,
+	    0x0000, 0x2ded, 0x1797, 0x4492, 0x4e15, 0x3fc3, 0x21d6, 0x477a,
+	    0x0890, 0x0000, 0x1373, 0x3294, 0x0000, 0x0000, 0x2908, 0x0b90,
+	    0x2653, 0x281d, 0x3b2c, 0x0f2b, 0x443f, 0x1fdb, 0x0058, 0x0000,
+	    0x3c83, 0x0000, 0x4dd8, 0x26e2, 0x3599, 0x3c74, 0x28ba, 0x0000,
+	    0x3314, 0x1fa0, 0x0303, 0x1fda, 0x20d0, 0x1ae8, 0x2146, 0x23b2,
+	    0x2cf1, 0x4298, 0x48c6, 0x11eb, 0x29a0, 0x05f4, 0x1300, 0x4dbd,
+	    0x0000, 0x05bf, 0x08d1, 0x2b45, 0x3bcb, 0x2ee1, 0x23f1, 0x13fd,
+	    0x19c2, 0x3bf4, 0x06dc, 0x0000, 0x4d3e, 0x200a, 0x0000, 0x4886,
+	    0x0fe9, 0x0000, 0x1bf4, 0x07a7, 0x31de, 0x1e95, 0x033d, 0x2bd1,
+	    0x4ba9, 0x2fd4, 0x40f3, 0x47f6, 0x2d20, 0x0000, 0x07b5, 0x1439,
+	    0x36f7, 0x140d, 0x0000, 0x3c87, 0x2c0b, 0x2dee, 0x1fb8, 0x2b84,
+	    0x144c, 0x045d, 0x2aff, 0x3cb5, 0x3200, 0x11ce, 0x24c2, 0x2a4c,
+	    0x053d, 0x329d, 0x3f4e, 0x43bd, 0x08ca, 0x43aa, 0x394e, 0x46ea,
+	    0x0000, 0x0000, 0x0838, 0x2cc0, 0x32ae, 0x043f, 0x41e0, 0x0000,
+	    0x08fb, 0x435a, 0x44bc, 0x3301, 0x0608, 0x2d63, 0x16d6, 0x2f0b,
+	    0x0000, 0x3684, 0x0224, 0x10ac, 0x4d0e, 0x3950, 0x1dee, 0x40c8,
+	    0x371c, 0x2173, 0x447e, 0x160d, 0x0b9a, 0x092a, 0x1f39, 0x4869,
+	    0x2c97, 0x23e4, 0x3559, 0x3bd3, 0x0f0e, 0x3c95, 0x115f, 0x456a,
+	    0x45d6, 0x2103, 0x0000, 0x10d7, 0x121e, 0x0096, 0x3fba, 0x4288,
+	    0x29ad, 0x18bd, 0x319a, 0x0be2, 0x1c45, 0x0362, 0x0000, 0x283d,
+	    0x021c, 0x3a52, 0x143a, 0x0000, 0x1015, 0x37c2, 0x08e2, 0x477a,
+	    0x1b45, 0x0728, 0x406c, 0x3ad5, 0x1169, 0x13b9, 0x26fd, 0x4ce7,
+	    0x49b9, 0x3d99, 0x1d56, 0x33bc, 0x0000, 0x3388, 0x0000, 0x2d4e,
+	    0x0000, 0x178b, 0x09c1, 0x054e, 0x2a5a, 0x3745, 0x198f, 0x1019,
+	    0x27ef, 0x4cef, 0x328e, 0x2fb9, 0x4953, 0x3a73, 0x0000, 0x0000,
+	    0x3898, 0x10b8, 0x4377, 0x3b17, 0x0cac, 0x01fc, 0x147c, 0x149f,
+	    0x3de7, 0x0a82, 0x1818, 0x466e, 0x378b, 0x3dc1, 0x154c, 0x469b,
+	    0x0000, 0x3f03, 0x3010, 0x02be, 0x0000, 0x1c52, 0x21ff, 0x04ae,
+	    0x11d6, 0x1641, 0x0f59, 0x4402, 0x07bc, 0x44bb, 0x2e97, 0x241b,
+	    0x146b, 0x3aae, 0x09ef, 0x1f93, 0x4a36, 0x1622, 0x0000, 0x2aff,
+	    0x1eb2, 0x4bcf, 0x0000, 0x0827, 0x0000, 0x23b8, 0x0000, 0x0000,
+	    0x2af0, 0x35d1, 0x36e9, 0x3d75, 0x2e2d, 0x24e3, 0x0000, 0x1445,
+	    0x2b97, 0x049e, 0x1176, 0x31aa, 0x06e1, 0x34e2, 0x29eb, 0x01a3,
+	    0x1676, 0x3066, 0x44aa, 0x0000, 0x33bd, 0x1752, 0x0bd4, 0x1067,
+	    0x351e, 0x1307, 0x2909, 0x2c7f, 0x2804, 0x265a, 0x0000, 0x43d4,
+	    0x0bda, 0x3679, 0x44e8, 0x47fd, 0x345a, 0x36f3, 0x11e3, 0x1f6c,
+	    0x0000, 0x3684, 0x1652, 0x0000, 0x0000, 0x3c96, 0x1714, 0x46b7,
+	    0x0000, 0x0dc9, 0x0dca, 0x2d06, 0x1f32, 0x0000, 0x09b0, 0x19e7,
+	    0x0000, 0x0000, 0x2aa5, 0x32f3, 0x1057, 0x27e6, 0x1b87, 0x2460,
+	    0x1dc3, 0x4ccf, 0x3a3c, 0x2f8a, 0x3fda, 0x252f, 0x2ec3, 0x1a49,
+	    0x3e3a, 0x0000, 0x1b40, 0x364d, 0x1a05, 0x0000, 0x0000, 0x2a0c,
+	    0x0fc5, 0x1387, 0x0ad5, 0x0000, 0x4163, 0x4725, 0x36de, 0x2a01,
+	    0x0f33, 0x0000, 0x0000, 0x17ef, 0x2bd3, 0x0000, 0x0019, 0x0000,
+	    0x3db7, 0x0000, 0x21e9, 0x2e0c, 0x0088, 0x470b, 0x02cd, 0x490d,
+	    0x35e3, 0x494e, 0x029f, 0x26c7, 0x0d38, 0x0000, 0x201f, 0x435a,
+	    0x28d6, 0x3f8c, 0x450b, 0x287c, 0x357b, 0x0000, 0x2aaa, 0x413c,
+	    0x4194, 0x4a16, 0x087c, 0x05c1, 0x4b02, 0x0000, 0x23d3, 0x2c77,
+	    0x4dda, 0x0ec2, 0x118b, 0x485b, 0x217f, 0x01bc, 0x1a9f, 0x4b5e,
+	    0x210d, 0x24e2, 0x3ae0, 0x2428, 0x0000, 0x3767, 0x0000, 0x27a2,
+	    0x3a5c, 0x0bca, 0x15e7, 0x383f, 0x4ae8, 0x0000, 0x3e6d, 0x3056,
+	    0x0efa, 0x117a, 0x4a2d, 0x22e9, 0x0bc0, 0x2693, 0x1eae, 0x337b,
+	    0x0506, 0x2a7d, 0x4564, 0x4488, 0x1ef7, 0x1fc2, 0x0000, 0x333e,
+	    0x27fc, 0x2251, 0x32b3, 0x2741, 0x0000, 0x24dd, 0x497f, 0x2d16,
+	    0x42f9, 0x28c8, 0x0666, 0x0000, 0x0ffa, 0x3e0f, 0x3a48, 0x3dc2,
+	    0x3473, 0x1d2c, 0x3029, 0x4cd3, 0x392e, 0x2f97, 0x0000, 0x2ea1,
+	    0x2912, 0x12cb, 0x2412, 0x0000, 0x1433, 0x0000, 0x2700, 0x1ffb,
+	    0x152a, 0x47ba, 0x2f2a, 0x0c83, 0x0b10, 0x4d6c, 0x11b8, 0x4059,
+	    0x3ee2, 0x384e, 0x1058, 0x2c3f, 0x4ab1, 0x0000, 0x11fd, 0x45dd,
+	    0x36a7, 0x344e, 0x1d7d, 0x45e6, 0x2498, 0x3ce6, 0x1cd3, 0x2256,
+	    0x235e, 0x0af9, 0x4c33, 0x2a1d, 0x4a01, 0x047f, 0x0000, 0x2fca,
+	    0x1fc8, 0x4092, 0x03cb, 0x24d2, 0x29da, 0x3bb3, 0x0000, 0x13f6,
+	    0x2059, 0x0000, 0x4706, 0x1fe2, 0x11a6, 0x0000, 0x3276, 0x3ab7,
+	    0x0816, 0x4c71, 0x0000, 0x1352, 0x4c5a, 0x0000, 0x102f, 0x421d,
+	    0x0000, 0x2600, 0x3bdc, 0x090a, 0x2506, 0x21e3, 0x0202, 0x0000,
+	    0x0000, 0x0000, 0x0f47, 0x481d, 0x2e6d, 0x076f, 0x06ba, 0x35a1,
+	    0x2d82, 0x3744, 0x17d6, 0x0b4b, 0x0a7f, 0x2d90, 0x2a3d, 0x3b98,
+	    0x20f7, 0x274e, 0x1547, 0x3c68, 0x1779, 0x1d4d, 0x3fcd, 0x0000,
+	    0x4808, 0x3c04, 0x0000, 0x488e, 0x3279, 0x064b, 0x1c2d, 0x1a7e,
+	    0x34e3, 0x03e2, 0x386e, 0x4d84, 0x0000, 0x3238, 0x0701, 0x19f4,
+	    0x46d2, 0x4a7e, 0x0000, 0x01a1, 0x371f, 0x317f, 0x2987, 0x2491,
+	    0x375f, 0x1551, 0x314d, 0x0a5f, 0x0b28, 0x10ae, 0x4a28, 0x3bde,
+	    0x4c39, 0x0000, 0x4091, 0x0000, 0x3f63, 0x007a, 0x1f32, 0x0000,
+	    0x1657, 0x3c5b, 0x031e, 0x0000, 0x17ca, 0x42ec, 0x496a, 0x0000,
+	    0x4d15, 0x048a, 0x0a03, 0x205d, 0x49fe, 0x1a63, 0x1a31, 0x0000,
+	    0x2c5a, 0x13e1, 0x1cae, 0x0000, 0x3e5d, 0x35b8, 0x3570, 0x4a2c,
+	    0x3543, 0x1ac7, 0x3f27, 0x01b0, 0x2f8c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x1002, 0x0000, 0x2124, 0x0181, 0x37f5, 0x0e3f,
+	    0x0355, 0x079a, 0x022d, 0x1a9e, 0x0000, 0x09d0, 0x29cc, 0x0000,
+	    0x0000, 0x3f40, 0x0780, 0x01bf, 0x0000, 0x373f, 0x380b, 0x1b97,
+	    0x3da6, 0x33a0, 0x013d, 0x2760, 0x4bfe, 0x0000, 0x4045, 0x3eb9,
+	    0x279e, 0x0c9c, 0x0000, 0x2da1, 0x2c71, 0x2fb9, 0x1aa6, 0x337f,
+	    0x4414, 0x1ec6, 0x44c0, 0x228b, 0x452d, 0x3c33, 0x4a99, 0x29d7,
+	    0x40ff, 0x00ea, 0x4aa4, 0x2e74, 0x0e61, 0x178e, 0x33e1, 0x47d7,
+	    0x0000, 0x00f0, 0x1124, 0x18c3, 0x09ad, 0x24c1, 0x00a9, 0x4292,
+	    0x1f64, 0x3952, 0x1924, 0x0c5e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0b53, 0x239f, 0x18db, 0x1bb1, 0x07c6, 0x2e03, 0x0000,
+	    0x4bac, 0x06f4, 0x09cc, 0x21b0, 0x20c7, 0x4031, 0x0b25, 0x1ec3,
+	    0x1689, 0x324a, 0x0000, 0x1aa2, 0x0000, 0x0000, 0x0000, 0x02e4,
+	    0x0000, 0x26f5, 0x0000, 0x0000, 0x0000, 0x387b, 0x08b1, 0x1209,
+	    0x424e, 0x24c4, 0x1c2c, 0x416a, 0x3077, 0x3cd5, 0x36d9, 0x43f0,
+	    0x1968, 0x0c31, 0x12ca, 0x4cdb, 0x36fc, 0x0000, 0x3b48, 0x3581,
+	    0x3b9e, 0x38ed, 0x0436, 0x17f4, 0x21bc, 0x38cc, 0x0000, 0x06ab,
+	    0x267a, 0x3e74, 0x2022, 0x02af, 0x2ff2, 0x433d, 0x2f70, 0x1617,
+	    0x42ea, 0x1893, 0x474d, 0x0383, 0x3548, 0x0899, 0x0000, 0x108a,
+	    0x3bb1, 0x0000, 0x1562, 0x0000, 0x0000, 0x0bbb, 0x0000, 0x0c2f,
+	    0x4aa1, 0x16fa, 0x0000, 0x223b, 0x0000, 0x0914, 0x0d0b, 0x0146,
+	    0x12de, 0x20bd, 0x0000, 0x27d2, 0x22fc, 0x1a8b, 0x1255, 0x0000,
+	    0x0573, 0x2696, 0x28ef, 0x3f68, 0x25ec, 0x28a8, 0x0000, 0x29d7,
+	    0x195a, 0x4114, 0x06c3, 0x3cc3, 0x2f6d, 0x0ca9, 0x0000, 0x0000,
+	    0x09db, 0x459a, 0x136c, 0x1e51, 0x2e8f, 0x31b0, 0x02f3, 0x301b,
+	    0x045f, 0x0000, 0x1476, 0x0000, 0x2c50, 0x11a1, 0x2871, 0x0000,
+	    0x1c2b, 0x1b79, 0x0b28, 0x0000, 0x0367, 0x2450, 0x1f13, 0x49de,
+	    0x3a15, 0x208f, 0x15fd, 0x36e1, 0x460e, 0x165e, 0x4988, 0x008c,
+	    0x0000, 0x16ac, 0x1592, 0x0000, 0x48d1, 0x04ca, 0x12e6, 0x09ea,
+	    0x0000, 0x2272, 0x0000, 0x3b89, 0x3262, 0x0000, 0x48b1, 0x3f37,
+	    0x48e1, 0x0893, 0x2ff2, 0x22f3, 0x4000, 0x09fa, 0x4949, 0x3198,
+	    0x0bc4, 0x1873, 0x3165, 0x0000, 0x320d, 0x2c4c, 0x2a34, 0x10c6,
+	    0x4954, 0x0000, 0x0de7, 0x0ab7, 0x4c89, 0x0000, 0x2464, 0x33c6,
+	    0x4b65, 0x3c03, 0x23df, 0x00f6, 0x45c6, 0x0d73, 0x4358, 0x2c3b,
+	    0x1019, 0x0000, 0x4c42, 0x3ba6, 0x403c, 0x2d26, 0x0038, 0x2110,
+	    0x20e3, 0x0e80, 0x071a, 0x2f46, 0x45c3, 0x0000, 0x4475, 0x0000,
+	    0x27db, 0x2c59, 0x0000, 0x270d, 0x0000, 0x4553, 0x1584, 0x3649,
+	    0x16fd, 0x0ed1, 0x0000, 0x4196, 0x319c, 0x0628, 0x0be2, 0x0b14,
+	    0x41e4, 0x40e2, 0x14bc, 0x0652, 0x2ffa, 0x00e9, 0x0618, 0x0000,
+	    0x0000, 0x0cd3, 0x0337, 0x0000, 0x00ba, 0x117b, 0x0000, 0x1298,
+	    0x4063, 0x10b5, 0x0000, 0x16c1, 0x2ced, 0x4117, 0x2084, 0x0c5a,
+	    0x3a6c, 0x203a, 0x001c, 0x0f90, 0x13be, 0x2407, 0x20b3, 0x07bf,
+	    0x2001, 0x1686, 0x29c1, 0x0000, 0x028e, 0x02f3, 0x269c, 0x2662,
+	    0x4c78, 0x43ac, 0x0000, 0x2816, 0x0000, 0x2920, 0x0000, 0x0000,
+	    0x0704, 0x4353, 0x38c0, 0x0000, 0x2702, 0x223d, 0x34d1, 0x289e,
+	    0x03cd, 0x1e7c, 0x0a86, 0x0000, 0x498e, 0x0000, 0x38fe, 0x214f,
+	    0x0000, 0x1112, 0x0df7, 0x0061, 0x3a3a, 0x47dd, 0x32c9, 0x022c,
+	    0x1ffc, 0x25cb, 0x2abe, 0x0000, 0x0000, 0x0000, 0x2480, 0x1661,
+	    0x0000, 0x21e4, 0x192a, 0x4265, 0x0acf, 0x0000, 0x0000, 0x1502,
+	    0x4daa, 0x1703, 0x3a31, 0x0000, 0x2fe1, 0x3d38, 0x1c35, 0x0000,
+	    0x3c33, 0x2095, 0x0000, 0x0b99, 0x2e1c, 0x4b75, 0x0000, 0x3b0c,
+	    0x2fd9, 0x0000, 0x3b51, 0x0094, 0x0000, 0x0000, 0x3275, 0x0a4d,
+	    0x3f28, 0x43e3, 0x366e, 0x0000, 0x1332, 0x0000, 0x11f1, 0x3164,
+	    0x1304, 0x3872, 0x007e, 0x29b7, 0x3f19, 0x33f9, 0x4def, 0x03f1,
+	    0x3eec, 0x2ab5, 0x3c6b, 0x00ff, 0x0cde, 0x1de5, 0x0000, 0x0000,
+	    0x1bb3, 0x3578, 0x0000, 0x32e3, 0x3570, 0x43f6, 0x019c, 0x1dfd,
+	    0x0971, 0x11b4, 0x14fb, 0x0000, 0x4bc3, 0x2cc3, 0x0981, 0x3373,
+	    0x0000, 0x0fd2, 0x1a70, 0x2426, 0x2e6e, 0x39c6, 0x36f6, 0x0186,
+	    0x293e, 0x43fe, 0x2252, 0x3581, 0x39fb, 0x2402, 0x2388, 0x20de,
+	    0x352e, 0x1b47, 0x2565, 0x4457, 0x0000, 0x3157, 0x2c71, 0x4be4,
+	    0x1d67, 0x1f1a, 0x2f00, 0x42c8, 0x0000, 0x4d77, 0x31bf, 0x37bf,
+	    0x0000, 0x4a7c, 0x0fe2, 0x2df6, 0x297c, 0x2f5a, 0x28f4, 0x4085,
+	    0x1a6c, 0x4cda, 0x4c97, 0x3fef, 0x14f7, 0x0000, 0x0000, 0x082e,
+	    0x0000, 0x4679, 0x088b, 0x3365, 0x2ee1, 0x1ec3, 0x12fc, 0x00e1,
+	    0x3dc3, 0x22b3, 0x4c44, 0x4831, 0x30ac, 0x1400, 0x23c8, 0x465c,
+	    0x0000, 0x086f, 0x49fa, 0x1d0d, 0x12c8, 0x2d2c, 0x2c9e, 0x19dc,
+	    0x0865, 0x39ed, 0x207e, 0x4bdf, 0x2400, 0x405c, 0x4607, 0x3e98,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x24ba, 0x1fdc, 0x1045, 0x0000,
+	    0x0000, 0x4c3d, 0x0000, 0x0bc5, 0x0dd3, 0x024e, 0x325a, 0x2e1c,
+	    0x4a84, 0x0000, 0x0acd, 0x238f, 0x0000, 0x00da, 0x2297, 0x3102,
+	    0x30bc, 0x0a42, 0x3bd7, 0x3b08, 0x0000, 0x39ab, 0x0454, 0x23ac,
+	    0x21b0, 0x2c9b, 0x1fd0, 0x0000, 0x32f4, 0x4a4b, 0x0472, 0x0c5b,
+	    0x0f6f, 0x24e7, 0x2a44, 0x2464, 0x0000, 0x1498, 0x4ac8, 0x130a,
+	    0x05fe, 0x1e3e, 0x2b89, 0x4349, 0x1e8c, 0x11ec, 0x2760, 0x470f,
+	    0x091b, 0x3132, 0x0000, 0x0433, 0x1336, 0x2293, 0x0ce0, 0x2e5d,
+	    0x248c, 0x29ea, 0x3618, 0x1e66, 0x0000, 0x0f1f, 0x17fc, 0x359c,
+	    0x0151, 0x1ea0, 0x4cb2, 0x457b, 0x02bf, 0x27bc, 0x0000, 0x07bb,
+	    0x2b82, 0x22b2, 0x3f4c, 0x01e1, 0x34e4, 0x1452, 0x01f9, 0x2bde,
+	    0x32da, 0x38b1, 0x4a2e, 0x2794, 0x1401, 0x0164, 0x39c7, 0x0da3,
+	    0x1a30, 0x0e81, 0x26e3, 0x0000, 0x0000, 0x0000, 0x119a, 0x3511,
+	    0x26d2, 0x1ce8, 0x0eea, 0x4d89, 0x0be2, 0x34ed, 0x42fe, 0x0000,
+	    0x358f, 0x1ebb, 0x1173, 0x35d8, 0x0f80, 0x2c9a, 0x0427, 0x0afe,
+	    0x0e0a, 0x4c4a, 0x0000, 0x1079, 0x2bc5, 0x080e, 0x0000, 0x0000,
+	    0x3f7d, 0x0000, 0x081a, 0x2b3e, 0x1e6e, 0x0000, 0x28e6, 0x2432,
+	    0x0550, 0x1e71, 0x318c, 0x4200, 0x0877, 0x477e, 0x0a92, 0x1332,
+	    0x082e, 0x37f7, 0x008d, 0x47a5, 0x2604, 0x0000, 0x0000, 0x4d1a,
+	    0x0b80, 0x0000, 0x14de, 0x3625, 0x37f6, 0x0000, 0x0fc3, 0x0000,
+	    0x47fe, 0x3408, 0x20fe, 0x4b1e, 0x04c7, 0x4895, 0x275c, 0x2f3b,
+	    0x308b, 0x1b1c, 0x2df3, 0x0cc7, 0x0000, 0x2a99, 0x0714, 0x0be1,
+	    0x26de, 0x3bfa, 0x0000, 0x22ed, 0x0000, 0x1308, 0x384a, 0x439e,
+	    0x0f29, 0x0353, 0x1e68, 0x1d9d, 0x432d, 0x2ad8, 0x2322, 0x0c66,
+	    0x0000, 0x48ab, 0x1821, 0x0a76, 0x0000, 0x0367, 0x4450, 0x1a0a,
+	    0x28fa, 0x0000, 0x279a, 0x0000, 0x3180, 0x2b0e, 0x19da, 0x06ec,
+	    0x119e, 0x2dcd, 0x26e7, 0x1814, 0x38f4, 0x4440, 0x457e, 0x1fb4,
+	    0x3480, 0x19b8, 0x0f0e, 0x4546, 0x31ca, 0x35de, 0x4a4d, 0x4531,
+	    0x2c95, 0x06f6, 0x33fc, 0x3720, 0x1dee, 0x1788, 0x313c, 0x0000,
+	    0x05cd, 0x3c02, 0x21fd, 0x2602, 0x43a2, 0x1976, 0x1058, 0x2bff,
+	    0x2039, 0x1f1c, 0x48ea, 0x3917, 0x063e, 0x2b03, 0x4150, 0x0000,
+	    0x25e8, 0x0000, 0x3eec, 0x2ae6, 0x0fd8, 0x24d5, 0x0000, 0x09b0,
+	    0x230e, 0x0e90, 0x2d16, 0x0000, 0x2211, 0x3609, 0x176e, 0x0807,
+	    0x324d, 0x38c2, 0x0987, 0x0ad4, 0x2b11, 0x4126, 0x0000, 0x190e,
+	    0x0000, 0x0c5c, 0x44ac, 0x20c9, 0x37b4, 0x3cd6, 0x0000, 0x3ddd,
+	    0x133a, 0x3316, 0x0000, 0x17c5, 0x3236, 0x2f15, 0x4afa, 0x0b61,
+	    0x0ca8, 0x2899, 0x4388, 0x1c75, 0x2e86, 0x1a63, 0x0714, 0x0000,
+	    0x0000, 0x4b52, 0x012b, 0x383d, 0x28d4, 0x23ae, 0x0000, 0x3af2,
+	    0x4a9d, 0x2566, 0x1559, 0x057c, 0x0000, 0x2a8b, 0x1e46, 0x4bff,
+	    0x2066, 0x1cf9, 0x0000, 0x1cc6, 0x115c, 0x1b90, 0x45ef, 0x1760,
+	    0x0000, 0x49c8, 0x0000, 0x3f36, 0x247a, 0x190a, 0x07aa, 0x0330,
+	    0x42b1, 0x0000, 0x29c5, 0x0000, 0x166f, 0x202a, 0x2edd, 0x0000,
+	    0x1845, 0x4d6f, 0x3bd2, 0x085d, 0x3bcd, 0x0000, 0x0db8, 0x3330,
+	    0x067c, 0x28bb, 0x0000, 0x1baf, 0x2581, 0x2c8c, 0x2dff, 0x0d25,
+	    0x294c, 0x3b51, 0x3113, 0x40c9, 0x0000, 0x2a62, 0x0a4b, 0x0000,
+	    0x0fb6, 0x3b89, 0x3ed9, 0x4c1b, 0x381b, 0x0870, 0x02c0, 0x32e0,
+	    0x41de, 0x3ba2, 0x23dd, 0x0417, 0x20bc, 0x3793, 0x46b7, 0x3694,
+	    0x2dd4, 0x1719, 0x144b, 0x0000, 0x07d8, 0x197a, 0x25fc, 0x1df4,
+	    0x0000, 0x1ccf, 0x2718, 0x1231, 0x3ef2, 0x04b1, 0x4121, 0x4786,
+	    0x2691, 0x069a, 0x2fbe, 0x4c54, 0x1ca5, 0x0193, 0x0d6f, 0x10ab,
+	    0x3049, 0x02a5, 0x1623, 0x3512, 0x3b10, 0x26dc, 0x1229, 0x44fb,
+	    0x0000, 0x03a7, 0x03b4, 0x0000, 0x48d2, 0x1ab3, 0x46b4, 0x22c9,
+	    0x222c, 0x19b4, 0x3623, 0x48b0, 0x2e3b, 0x0000, 0x3c28, 0x2f26,
+	    0x4a09, 0x3032, 0x4590, 0x2c57, 0x2d7c, 0x3770, 0x0000, 0x3fd7,
+	    0x3ffb, 0x40cc, 0x0000, 0x1b95, 0x1057, 0x1d7a, 0x4914, 0x1ab0,
+	    0x4b8f, 0x35be, 0x3950, 0x0d6d, 0x04ef, 0x0000, 0x200f, 0x2099,
+	    0x28d0, 0x3edb, 0x0000, 0x3e3b, 0x483c, 0x103a, 0x0000, 0x20ed,
+	    0x3574, 0x3180, 0x3f1a, 0x2631, 0x0359, 0x016e, 0x147f, 0x23b3,
+	    0x1d97, 0x1ae1, 0x33bc, 0x0000, 0x2674, 0x4d1f, 0x0713, 0x48bc,
+	    0x1d88, 0x0245, 0x0673, 0x0000, 0x1d8e, 0x07f6, 0x34a0, 0x0000,
+	    0x0731, 0x2006, 0x032c, 0x4535, 0x3344, 0x36af, 0x0ce1, 0x45e0,
+	    0x25a3, 0x2715, 0x0000, 0x0000, 0x0000, 0x4d53, 0x0000, 0x0000,
+	    0x4657, 0x48f0, 0x0000, 0x23d3, 0x0317, 0x3864, 0x49bb, 0x33d0,
+	    0x2594, 0x40f1, 0x0647, 0x078c, 0x4460, 0x0d25, 0x0000, 0x41b7,
+	    0x1ee7, 0x1dc6, 0x236e, 0x0332, 0x2f1f, 0x2bcc, 0x1245, 0x0000,
+	    0x1c0d, 0x44ec, 0x1f6b, 0x22ae, 0x4d6b, 0x08e6, 0x26bb, 0x0000,
+	    0x2eac, 0x0deb, 0x22ae, 0x0ad7, 0x0bce, 0x44f6, 0x22e7, 0x33b2,
+	    0x2374, 0x0000, 0x2635, 0x42eb, 0x3ba5, 0x1a0f, 0x0000, 0x0133,
+	    0x17d6, 0x0000, 0x0975, 0x2525, 0x2b2f, 0x334a, 0x0000, 0x4cba,
+	    0x3a82, 0x4459, 0x0000, 0x2587, 0x1270, 0x0000, 0x3e33, 0x1322,
+	    0x315f, 0x47ea, 0x0000, 0x219a, 0x1279, 0x2b75, 0x4992, 0x126d,
+	    0x233a, 0x1d36, 0x28ec, 0x0351, 0x0000, 0x4465, 0x2ae8, 0x1292,
+	    0x32e4, 0x0b44, 0x0eb5, 0x4abc, 0x0505, 0x09a6, 0x043e, 0x22ea,
+	    0x0e8d, 0x4dd5, 0x066c, 0x2187, 0x4a38, 0x18ad, 0x47d5, 0x1bce,
+	    0x0000, 0x1402, 0x3d8b, 0x431a, 0x2959, 0x20ca, 0x49ef, 0x0a2e,
+	    0x0000, 0x0000, 0x2449, 0x32d1, 0x352d, 0x1e3c, 0x125f, 0x2358,
+	    0x0000, 0x069f, 0x0000, 0x4870, 0x35e1, 0x0000, 0x0000, 0x1119,
+	    0x3afe, 0x298c, 0x1aeb, 0x3f2e, 0x342c, 0x0000, 0x07cf, 0x0394,
+	    0x3936, 0x2677, 0x2a6a, 0x03ca, 0x1fe3, 0x1c55, 0x1b08, 0x293d,
+	    0x0715, 0x4dd7, 0x3059, 0x45bd, 0x03a6, 0x4627, 0x0fe1, 0x36ee,
+	    0x4869, 0x0000, 0x1134, 0x141f, 0x0edc, 0x49af, 0x2187, 0x0af3,
+	    0x40a2, 0x3336, 0x06e5, 0x1b2d, 0x0000, 0x0b3c, 0x0000, 0x4ce4,
+	    0x0ba9, 0x2a2b, 0x0e89, 0x0ac5, 0x438b, 0x35ee, 0x2638, 0x2b1c,
+	    0x170a, 0x0000, 0x0467, 0x3ac0, 0x4699, 0x2310, 0x4b75, 0x0000,
+	    0x4d3c, 0x3245, 0x021f, 0x1482, 0x36f6, 0x36e3, 0x0000, 0x3649,
+	    0x13fb, 0x0a85, 0x292b, 0x43aa, 0x456c, 0x4505, 0x2ddd, 0x0c52,
+	    0x0c85, 0x3695, 0x275b, 0x23c6, 0x0000, 0x1fe7, 0x3784, 0x4372,
+	    0x0000, 0x19e1, 0x3dfb, 0x493e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x367f, 0x2469, 0x0000, 0x2a37, 0x4805, 0x0000, 0x321a,
+	    0x441a, 0x20a0, 0x4b69, 0x1869, 0x2676, 0x286c, 0x0c80, 0x2d8f,
+	    0x0000, 0x3ef3, 0x0000, 0x1987, 0x3a49, 0x269e, 0x0000, 0x2bfc,
+	    0x0000, 0x0000, 0x131c, 0x4649, 0x3685, 0x0000, 0x1319, 0x3104,
+	    0x0000, 0x1e0e, 0x2db5, 0x12ba, 0x062e, 0x41d9, 0x0a5f, 0x0000,
+	    0x1091, 0x3489, 0x2fec, 0x2b1d, 0x4544, 0x18d8, 0x1e4f, 0x2386,
+	    0x3572, 0x36f2, 0x4d8f, 0x0c2e, 0x2073, 0x22ec, 0x1901, 0x0000,
+	    0x2db8, 0x45c2, 0x0000, 0x21cd, 0x2ce3, 0x051c, 0x295e, 0x2a81,
+	    0x3ac3, 0x1a7d, 0x499f, 0x0000, 0x1dec, 0x0000, 0x2855, 0x0000,
+	    0x0161, 0x18c2, 0x1f8b, 0x2a4e, 0x2d46, 0x0000, 0x020a, 0x4bd1,
+	    0x4596, 0x0c1b, 0x2da1, 0x1ddf, 0x1479, 0x4a77, 0x0376, 0x4a5f,
+	    0x0024, 0x0f74, 0x3851, 0x37ec, 0x43e6, 0x1004, 0x0610, 0x22b7,
+	    0x4b56, 0x2c31, 0x48a1, 0x01bc, 0x397a, 0x2ce0, 0x2ded, 0x2bf3,
+	    0x3a45, 0x2a58, 0x0000, 0x3951, 0x0000, 0x145f, 0x2630, 0x2830,
+	    0x0000, 0x4c96, 0x0504, 0x1554, 0x0ee7, 0x0715, 0x12d7, 0x49f0,
+	    0x27a9, 0x4616, 0x0eeb, 0x2ee4, 0x4060, 0x0000, 0x43b9, 0x0408,
+	    0x1425, 0x1c26, 0x0446, 0x0000, 0x1fa0, 0x0e10, 0x175e, 0x46ec,
+	    0x3569, 0x24cc, 0x304f, 0x4aca, 0x336a, 0x294b, 0x2f47, 0x4003,
+	    0x128d, 0x2acd, 0x1a78, 0x285f, 0x0556, 0x457a, 0x4951, 0x4587,
+	    0x3787, 0x3841, 0x0000, 0x42d4, 0x4258, 0x0000, 0x1e3e, 0x0000,
+	    0x347c, 0x14c9, 0x335b, 0x49a8, 0x1fc9, 0x41e8, 0x2dcc, 0x0e25,
+	    0x2486, 0x48fb, 0x16a8, 0x361f, 0x09cf, 0x4234, 0x0ead, 0x0742,
+	    0x0efd, 0x48ca, 0x142c, 0x0069, 0x0000, 0x36ee, 0x4af4, 0x04ea,
+	    0x03ef, 0x0000, 0x23eb, 0x2a7c, 0x3e6d, 0x491d, 0x0000, 0x4d51,
+	    0x24c3, 0x0000, 0x1d50, 0x4483, 0x33c6, 0x4492, 0x0000, 0x0bfe,
+	    0x0f56, 0x2ce7, 0x056b, 0x27bc, 0x18eb, 0x28bb, 0x0ead, 0x2746,
+	    0x25cf, 0x0000, 0x2e1d, 0x3f63, 0x1d2b, 0x08d4, 0x1588, 0x0000,
+	    0x3bc0, 0x1a29, 0x15d7, 0x1bac, 0x310b, 0x3458, 0x1ff1, 0x47d8,
+	    0x0000, 0x0000, 0x42e7, 0x3e1a, 0x3a74, 0x216a, 0x34ba, 0x32b1,
+	    0x0000, 0x20c7, 0x1738, 0x2a21, 0x2d60, 0x2d30, 0x2ef9, 0x0000,
+	    0x0215, 0x4a25, 0x1458, 0x1ad0, 0x4004, 0x26a8, 0x115e, 0x259e,
+	    0x0000, 0x2dea, 0x13ae, 0x10b7, 0x353e, 0x0000, 0x3140, 0x0754,
+	    0x1270, 0x3baf, 0x1c6d, 0x40a2, 0x3cba, 0x132f, 0x2d2f, 0x16fb,
+	    0x2b08, 0x3997, 0x05ca, 0x28ec, 0x375f, 0x132d, 0x1067, 0x2fd0,
+	    0x23b3, 0x0000, 0x1a5d, 0x0000, 0x0000, 0x0bfc, 0x2eec, 0x36c3,
+	    0x0281, 0x365d, 0x1b7e, 0x4b63, 0x3bcb, 0x2804, 0x3a51, 0x2c5b,
+	    0x0b2f, 0x0000, 0x118d, 0x37ce, 0x2595, 0x2132, 0x3928, 0x16f9,
+	    0x0ebb, 0x12df, 0x2f72, 0x0000, 0x1807, 0x3896, 0x48b4, 0x36cf,
+	    0x3cb2, 0x1182, 0x20ed, 0x3d67, 0x3814, 0x0000, 0x0000, 0x30ae,
+	    0x0000, 0x0000, 0x4113, 0x0787, 0x420b, 0x0000, 0x0000, 0x49a4,
+	    0x0000, 0x0d13, 0x1f76, 0x28eb, 0x2565, 0x1858, 0x436b, 0x3726,
+	    0x3aba, 0x2882, 0x0000, 0x1106, 0x05a7, 0x1e94, 0x0000, 0x200b,
+	    0x09ee, 0x1309, 0x2698, 0x417e, 0x28f9, 0x0000, 0x4dc1, 0x005a,
+	    0x3156, 0x0000, 0x21ba, 0x2589, 0x2d4e, 0x0000, 0x0000, 0x0000,
+	    0x0555, 0x24ba, 0x2c97, 0x200f, 0x44b0, 0x436f, 0x4334, 0x1c6b,
+	    0x0689, 0x0dfe, 0x4845, 0x0000, 0x3e4a, 0x0000, 0x0000, 0x1cb7,
+	    0x0c4c, 0x405a, 0x144a, 0x16d7, 0x0f83, 0x0000, 0x08f8, 0x16a8,
+	    0x3932, 0x197c, 0x35eb, 0x3412, 0x33b9, 0x3a67, 0x263a, 0x1b03,
+	    0x0000, 0x27bf, 0x0000, 0x4360, 0x0000, 0x1292, 0x0f1f, 0x365c,
+	    0x3d04, 0x0477, 0x4649, 0x36f1, 0x0000, 0x4d5a, 0x2821, 0x0000,
+	    0x2a44, 0x2630, 0x2529, 0x15c4, 0x0d20, 0x44c6, 0x0000, 0x4794,
+	    0x0249, 0x0e9a, 0x4069, 0x0000, 0x431b, 0x2a16, 0x0000, 0x0000,
+	    0x1d37, 0x14f7, 0x185b, 0x0810, 0x2aff, 0x272a, 0x4850, 0x201c,
+	    0x1c99, 0x2f0b, 0x095d, 0x46b1, 0x0fda, 0x0000, 0x41a7, 0x04cf,
+	    0x4d4d, 0x00ca, 0x0000, 0x4059, 0x4622, 0x2f6b, 0x41c5, 0x3237,
+	    0x1c13, 0x4ac9, 0x3be7, 0x1bb4, 0x0000, 0x2b39, 0x281f, 0x425b,
+	    0x0533, 0x1036, 0x1c48, 0x2ddc, 0x1745, 0x0000, 0x2df4, 0x084f,
+	    0x43ca, 0x4609, 0x14f0, 0x0000, 0x11d0, 0x0000, 0x1a86, 0x0000,
+	    0x4007, 0x4959, 0x0800, 0x1903, 0x4764, 0x3075, 0x3b92, 0x0e14,
+	    0x2d7a, 0x0000, 0x20cc, 0x3a73, 0x102f, 0x09d4, 0x0d2c, 0x44cd,
+	    0x0000, 0x498f, 0x479d, 0x0624, 0x2699, 0x0000, 0x29b9, 0x0d18,
+	    0x252a, 0x157d, 0x0000, 0x440f, 0x11e3, 0x45da, 0x3192, 0x10c2,
+	    0x0000, 0x0000, 0x438d, 0x36ef, 0x1ace, 0x1d34, 0x0000, 0x071f,
+	    0x1349, 0x0000, 0x043c, 0x0000, 0x07e1, 0x497a, 0x3ef7, 0x3f89,
+	    0x0137, 0x1e7c, 0x0000, 0x47b7, 0x11cd, 0x3293, 0x031b, 0x3073,
+	    0x0000, 0x0000, 0x3621, 0x25f8, 0x4d63, 0x0000, 0x244f, 0x0000,
+	    0x0977, 0x2d67, 0x1604, 0x4616, 0x2a3b, 0x1242, 0x0be1, 0x0000,
+	    0x1755, 0x05ed, 0x18da, 0x1cf0, 0x0a83, 0x06ae, 0x2991, 0x4891,
+	    0x23b5, 0x2b4b, 0x371d, 0x0000, 0x1387, 0x187f, 0x01ff, 0x001f,
+	    0x356e, 0x4876, 0x396a, 0x0000, 0x2962, 0x0000, 0x1268, 0x0000,
+	    0x2b94, 0x078b, 0x0000, 0x04f0, 0x1099, 0x17e9, 0x39a1, 0x0564,
+	    0x499e, 0x47cc, 0x190a, 0x0a89, 0x0149, 0x1a8c, 0x2a91, 0x08e3,
+	    0x0000, 0x0c6e, 0x0000, 0x436d, 0x2ca8, 0x0463, 0x28a8, 0x48e4,
+	    0x22c1, 0x1fcf, 0x0eb4, 0x2a44, 0x12f3, 0x43d1, 0x0000, 0x1862,
+	    0x027a, 0x2e4d, 0x2b50, 0x0e52, 0x4801, 0x3112, 0x0000, 0x2f31,
+	    0x2203, 0x35d6, 0x0cd2, 0x16d0, 0x3414, 0x43dc, 0x0000, 0x1d33,
+	    0x4bf1, 0x2a93, 0x22ea, 0x3101, 0x4314, 0x032b, 0x0000, 0x13ff,
+	    0x19d2, 0x28e0, 0x165a, 0x0000, 0x0c52, 0x4593, 0x3cb8, 0x0000,
+	    0x2738, 0x0000, 0x25cc, 0x3bea, 0x30f3, 0x27b7, 0x22fa, 0x431f,
+	    0x3735, 0x0000, 0x1d6f, 0x3c1e, 0x0783, 0x46d0, 0x295c, 0x1429,
+	    0x0000, 0x49c1, 0x1c64, 0x18c9, 0x372c, 0x070c, 0x2647, 0x3fdb,
+	    0x1885, 0x1dd6, 0x0c34, 0x0000, 0x0000, 0x49a2, 0x02b6, 0x47a9,
+	    0x3859, 0x4575, 0x443f, 0x36cb, 0x2816, 0x0000, 0x39ac, 0x02fa,
+	    0x220d, 0x2bde, 0x446a, 0x1a99, 0x21b7, 0x4c54, 0x4a65, 0x3e17,
+	    0x1967, 0x49f7, 0x22c6, 0x11ac, 0x27b0, 0x206f, 0x26e3, 0x031b,
+	    0x39ae, 0x440b, 0x1630, 0x3585, 0x3bdf, 0x21c5, 0x0ee0, 0x0733,
+	    0x1945, 0x0758, 0x4909, 0x0aa1, 0x40d3, 0x05cc, 0x0000, 0x2fdb,
+	    0x27a6, 0x1b51, 0x2de0, 0x42a4, 0x3732, 0x0000, 0x0f5e, 0x2d7d,
+	    0x0976, 0x0d06, 0x0000, 0x02f5, 0x2b1d, 0x0000, 0x0000, 0x0000,
+	    0x164c, 0x319c, 0x2895, 0x3eb3, 0x4438, 0x40e0, 0x07e3, 0x3980,
+	    0x4508, 0x14e5, 0x4494, 0x3aff, 0x3edc, 0x3d8c, 0x498a, 0x2881,
+	    0x466a, 0x3da9, 0x1939, 0x2789, 0x229a, 0x3260, 0x0bd3, 0x233a,
+	    0x14f1, 0x24cd, 0x22fc, 0x1468, 0x0000, 0x46b4, 0x405f, 0x4c23,
+	    0x3a82, 0x3920, 0x1f74, 0x3bbe, 0x0000, 0x31e8, 0x32b7, 0x31f9,
+	    0x38ac, 0x0831, 0x0000, 0x2c49, 0x2cbc, 0x39aa, 0x3e82, 0x3d8b,
+	    0x2bdc, 0x035f, 0x093e, 0x30ce, 0x24b6, 0x0000, 0x1203, 0x0a40,
+	    0x0be1, 0x0d2a, 0x1551, 0x2480, 0x0806, 0x0000, 0x08ce, 0x0cff,
+	    0x0000, 0x1332, 0x4174, 0x1a62, 0x389d, 0x3d4d, 0x2417, 0x2d8e,
+	    0x30fa, 0x3294, 0x0436, 0x13e1, 0x0000, 0x0efc, 0x3a84, 0x3d9b,
+	    0x2195, 0x30bc, 0x0000, 0x3bbd, 0x3c42, 0x0b4e, 0x3338, 0x399e,
+	    0x227d, 0x0000, 0x07d2, 0x3398, 0x0c9f, 0x0000, 0x0a25, 0x0000,
+	    0x160e, 0x1fc0, 0x0000, 0x48ae, 0x1842, 0x0000, 0x2f56, 0x22fa,
+	    0x0000, 0x2c86, 0x0000, 0x11c5, 0x1443, 0x0836, 0x0000, 0x23a8,
+	    0x3e2b, 0x05c4, 0x418b, 0x0000, 0x0000, 0x446a, 0x2105, 0x2999,
+	    0x0000, 0x072d, 0x0000, 0x1835, 0x4136, 0x36a1, 0x2195, 0x31e3,
+	    0x2c76, 0x393a, 0x42de, 0x0000, 0x0721, 0x4865, 0x0d74, 0x0000,
+	    0x1643, 0x2e54, 0x1c5d, 0x3309, 0x1531, 0x0000, 0x3a3c, 0x08f3,
+	    0x42f7, 0x0000, 0x1106, 0x0000, 0x0e63, 0x1a05, 0x1c25, 0x31b3,
+	    0x0b62, 0x46d8, 0x255d, 0x0000, 0x2d3c, 0x0304, 0x0be4, 0x0f84,
+	    0x2e63, 0x3c0c, 0x156b, 0x37e7, 0x1c25, 0x22d0, 0x2efb, 0x409b,
+	    0x2622, 0x3318, 0x27e6, 0x0242, 0x476d, 0x26c0, 0x2c66, 0x4182,
+	    0x4a91, 0x2f4e, 0x3680, 0x37fb, 0x3929, 0x2054, 0x0000, 0x07a2,
+	    0x0000, 0x06b8, 0x0a20, 0x2ba5, 0x2f71, 0x1822, 0x0cdb, 0x4001,
+	    0x3880, 0x4ab0, 0x23b9, 0x364a, 0x07b6, 0x0000, 0x0c99, 0x0000,
+	    0x0000, 0x10d7, 0x1387, 0x2a55, 0x3ad9, 0x100e, 0x1c95, 0x33e1,
+	    0x3147, 0x0b4a, 0x409c, 0x1a10, 0x305c, 0x0000, 0x3b22, 0x4215,
+	    0x3cac, 0x2c96, 0x2924, 0x1ab4, 0x21e5, 0x389d, 0x2f71, 0x2966,
+	    0x3592, 0x150a, 0x0000, 0x4873, 0x0000, 0x24ad, 0x0000, 0x42e1,
+	    0x3482, 0x4154, 0x0000, 0x2465, 0x3292, 0x415b, 0x0602, 0x276f,
+	    0x414e, 0x2011, 0x4834, 0x41f6, 0x2c39, 0x1a50, 0x00a5, 0x2cb1,
+	    0x4b91, 0x0000, 0x0b26, 0x0000, 0x0ef7, 0x0000, 0x0000, 0x46d6,
+	    0x0fed, 0x117f, 0x425a, 0x3cf9, 0x3a18, 0x229b, 0x0000, 0x0ddc,
+	    0x2b5e, 0x197b, 0x10e7, 0x21f7, 0x0c59, 0x41a4, 0x0000, 0x0b5d,
+	    0x01fb, 0x2905, 0x1f84, 0x2d98, 0x0000, 0x3f31, 0x33b6, 0x0000,
+	    0x1cf3, 0x1078, 0x1477, 0x0000, 0x4b68, 0x4574, 0x355f, 0x3f78,
+	    0x4532, 0x1f3d, 0x22b8, 0x1cc0, 0x3d9d, 0x48c5, 0x0000, 0x0000,
+	    0x1074, 0x4166, 0x23f1, 0x27fb, 0x2fe8, 0x4c26, 0x1be1, 0x2ca4,
+	    0x0000, 0x2bc7, 0x02fd, 0x0000, 0x3965, 0x0000, 0x2052, 0x45b0,
+	    0x103e, 0x0000, 0x26d9, 0x4d51, 0x1817, 0x4a32, 0x1e3e, 0x1a0d,
+	    0x0000, 0x42fe, 0x3677, 0x0000, 0x2a91, 0x259d, 0x2078, 0x0430,
+	    0x27cf, 0x2553, 0x1582, 0x2d96, 0x0000, 0x453f, 0x147a, 0x40da,
+	    0x3135, 0x22ba, 0x3884, 0x3f81, 0x1e62, 0x163b, 0x468c, 0x36fd,
+	    0x1e90, 0x0000, 0x1d4a, 0x0f31, 0x3921, 0x105d, 0x0d11, 0x16ee,
+	    0x4a87, 0x1391, 0x0000, 0x09c9, 0x2bd3, 0x4c2d, 0x0000, 0x1f0b,
+	    0x186c, 0x06f6, 0x1ab8, 0x1149, 0x3345, 0x4368, 0x0000, 0x0ecf,
+	    0x1280, 0x0000, 0x1230, 0x3275, 0x2665, 0x0000, 0x3a01, 0x0000,
+	    0x0000, 0x212b, 0x4436, 0x14bf, 0x2a56, 0x0000, 0x4596, 0x408c,
+	    0x4b9a, 0x40a0, 0x40f1, 0x0000, 0x308e, 0x0000, 0x2a7b, 0x0b46,
+	    0x433a, 0x0a5e, 0x2d86, 0x2d40, 0x45fd, 0x1992, 0x2a3c, 0x1690,
+	    0x0000, 0x0b94, 0x289c, 0x3999, 0x49e5, 0x1a86, 0x4221, 0x2bde,
+	    0x136f, 0x2893, 0x0000, 0x05bd, 0x075c, 0x4165, 0x4da9, 0x36ad,
+	    0x1239, 0x0cd0, 0x06b0, 0x117a, 0x1bab, 0x28fd, 0x0000, 0x14dc,
+	    0x40d5, 0x4a16, 0x1099, 0x0f09, 0x0000, 0x3914, 0x2653, 0x0000,
+	    0x3ea2, 0x0000, 0x3006, 0x1b85, 0x18ad, 0x11cc, 0x3d2b, 0x0000,
+	    0x3b63, 0x0000, 0x3645, 0x2b2e, 0x07ae, 0x366f, 0x0000, 0x0000,
+	    0x0bf0, 0x2da0, 0x0000, 0x0000, 0x3cdf, 0x29fb, 0x33eb, 0x35e7,
+	    0x433d, 0x0279, 0x4acf, 0x4cc6, 0x0000, 0x2ada, 0x4b37, 0x0000,
+	    0x1799, 0x2d90, 0x0000, 0x07ce, 0x178e, 0x476b, 0x38fc, 0x29fb,
+	    0x10dd, 0x1574, 0x0f3f, 0x401a, 0x1ec6, 0x4059, 0x4336, 0x0000,
+	    0x0831, 0x2604, 0x0000, 0x436a, 0x05ee, 0x0000, 0x3cc1, 0x3c6e,
+	    0x09b4, 0x28f8, 0x4bc4, 0x3907, 0x0e7b, 0x4808, 0x3f76, 0x119e,
+	    0x10e3, 0x1eaa, 0x4a33, 0x19f7, 0x0000, 0x45b9, 0x2390, 0x0be4,
+	    0x145e, 0x0000, 0x0428, 0x301a, 0x310b, 0x3458, 0x107f, 0x04f9,
+	    0x1769, 0x1d4e, 0x4a92, 0x1363, 0x2a2f, 0x0000, 0x23fb, 0x4970,
+	    0x2102, 0x2614, 0x1222, 0x3020, 0x32bf, 0x0000, 0x2123, 0x4285,
+	    0x1269, 0x38a6, 0x34cb, 0x074e, 0x34f3, 0x0d52, 0x1799, 0x1624,
+	    0x350e, 0x181e, 0x1edf, 0x2392, 0x389c, 0x47d7, 0x0000, 0x424f,
+	    0x215b, 0x0a2d, 0x17c7, 0x021d, 0x291a, 0x02d6, 0x3a86, 0x49b8,
+	    0x14e7, 0x0000, 0x0409, 0x39bc, 0x314e, 0x0000, 0x3f2d, 0x03c6,
+	    0x3255, 0x1766, 0x00df, 0x0a32, 0x4169, 0x3090, 0x205e, 0x3216,
+	    0x315a, 0x3b33, 0x0000, 0x0000, 0x0d04, 0x1966, 0x048a, 0x20ef,
+	    0x0b40, 0x3155, 0x2dfd, 0x2f49, 0x0000, 0x1059, 0x0000, 0x3d49,
+	    0x19dd, 0x22e2, 0x4644, 0x1b43, 0x2f36, 0x4741, 0x1e13, 0x11e1,
+	    0x48cd, 0x0000, 0x3301, 0x2d85, 0x3973, 0x4480, 0x2d14, 0x3d60,
+	    0x2f45, 0x0000, 0x0c3f, 0x1a3b, 0x28b9, 0x0e34, 0x3105, 0x08d1,
+	    0x21e5, 0x225a, 0x2629, 0x38ff, 0x2cff, 0x1272, 0x0000, 0x0000,
+	    0x31db, 0x0000, 0x1031, 0x1f27, 0x0000, 0x03ab, 0x0dce, 0x08b7,
+	    0x2774, 0x0000, 0x3093, 0x0bd6, 0x33c4, 0x1b4d, 0x021a, 0x3674,
+	    0x0000, 0x476a, 0x235e, 0x05ce, 0x43c6, 0x0a2e, 0x3911, 0x4751,
+	    0x2829, 0x01f2, 0x0000, 0x0000, 0x14d6, 0x42fa, 0x240d, 0x0000,
+	    0x4335, 0x4569, 0x38fa, 0x3161, 0x38f5, 0x1e38, 0x0278, 0x2f92,
+	    0x1da4, 0x0000, 0x092e, 0x0000, 0x1303, 0x2785, 0x0000, 0x0000,
+	    0x17c7, 0x38fd, 0x1488, 0x1e1d, 0x0491, 0x0000, 0x250d, 0x4db9,
+	    0x4ad5, 0x0000, 0x18e1, 0x0e31, 0x38c5, 0x3466, 0x17f4, 0x0586,
+	    0x4c31, 0x4019, 0x3f66, 0x4a19, 0x1d9a, 0x0000, 0x206a, 0x325e,
+	    0x3b4f, 0x2d4d, 0x22c9, 0x0000, 0x08fb, 0x3f86, 0x1a66, 0x1391,
+	    0x308d, 0x0001, 0x0950, 0x1aad, 0x40f7, 0x4071, 0x2298, 0x0afe,
+	    0x0556, 0x3046, 0x40bd, 0x38e9, 0x4435, 0x23a7, 0x0000, 0x2849,
+	    0x15c6, 0x270f, 0x4a1c, 0x1884, 0x0d4c, 0x424d, 0x23f0, 0x17dc,
+	    0x0000, 0x0000, 0x23d5, 0x2eb5, 0x01a1, 0x309a, 0x325f, 0x08c2,
+	    0x2ae4, 0x4e0a, 0x1e70, 0x0b50, 0x194c, 0x3f3e, 0x0bc2, 0x235d,
+	    0x39b4, 0x0000, 0x14f2, 0x49fc, 0x33be, 0x0b36, 0x23aa, 0x3ff5,
+	    0x444e, 0x0000, 0x0000, 0x13c9, 0x2c23, 0x3f38, 0x11ac, 0x0e06,
+	    0x4a89, 0x2388, 0x15e4, 0x4b51, 0x4c2b, 0x1575, 0x3d5a, 0x4bc0,
+	    0x48c3, 0x0000, 0x41c1, 0x0000, 0x3b4f, 0x0000, 0x19b8, 0x0a9b,
+	    0x35dc, 0x1220, 0x486f, 0x163c, 0x28fd, 0x0bbb, 0x1bc0, 0x29d1,
+	    0x145a, 0x42e6, 0x08d8, 0x0fc6, 0x4b02, 0x1031, 0x2e4a, 0x470f,
+	    0x0000, 0x37a8, 0x1f17, 0x4aae, 0x3356, 0x21b8, 0x3dd4, 0x1a70,
+	    0x342e, 0x43d1, 0x2b91, 0x2b47, 0x4996, 0x1693, 0x471d, 0x12de,
+	    0x0000, 0x3d72, 0x210a, 0x0d9e, 0x2267, 0x4bfb, 0x3662, 0x3dee,
+	    0x3bd3, 0x1537, 0x2639, 0x0027, 0x44da, 0x2a45, 0x0448, 0x4467,
+	    0x1197, 0x0b5a, 0x0ffa, 0x4d32, 0x405e, 0x4c62, 0x3be5, 0x1384,
+	    0x3089, 0x33dd, 0x13de, 0x1fe0, 0x2b63, 0x267e, 0x3e7f, 0x3f72,
+	    0x49fc, 0x0000, 0x4a84, 0x060c, 0x4885, 0x0000, 0x4750, 0x2fbd,
+	    0x0571, 0x0000, 0x024d, 0x00a9, 0x0d08, 0x4984, 0x1588, 0x265c,
+	    0x03c2, 0x2d52, 0x23dc, 0x0000, 0x35ba, 0x0000, 0x0000, 0x1152,
+	    0x2f7d, 0x0fca, 0x4413, 0x2e4a, 0x174b, 0x0fba, 0x4329, 0x4070,
+	    0x2e41, 0x0000, 0x1dee, 0x3ab6, 0x13ce, 0x37b7, 0x0000, 0x080c,
+	    0x07a2, 0x0000, 0x0000, 0x0000, 0x48a0, 0x45d5, 0x2ef8, 0x403f,
+	    0x2857, 0x3c5f, 0x416c, 0x0a53, 0x3810, 0x2448, 0x2b1e, 0x3c96,
+	    0x0823, 0x2f9f, 0x2d6f, 0x0000, 0x07ca, 0x3003, 0x4767, 0x38c3,
+	    0x315a, 0x1707, 0x4930, 0x29c4, 0x3b4f, 0x35cd, 0x13a1, 0x2f03,
+	    0x23db, 0x0425, 0x243c, 0x18cc, 0x0000, 0x2bf5, 0x422e, 0x1b59,
+	    0x31b5, 0x1e88, 0x0000, 0x3995, 0x4536, 0x014d, 0x1023, 0x0000,
+	    0x3dcd, 0x45f8, 0x354b, 0x3834, 0x1871, 0x0a1f, 0x4349, 0x1e5d,
+	    0x0000, 0x0000, 0x0000, 0x2783, 0x179b, 0x1d8c, 0x1bb8, 0x4666,
+	    0x33f3, 0x0000, 0x007a, 0x4a9d, 0x0a66, 0x465f, 0x026b, 0x0000,
+	    0x48a0, 0x0000, 0x3761, 0x099d, 0x0000, 0x0000, 0x1d0c, 0x0b06,
+	    0x1262, 0x09e2, 0x06c1, 0x054d, 0x164e, 0x40de, 0x498a, 0x1ace,
+	    0x3311, 0x45be, 0x2465, 0x213c, 0x0ef6, 0x4837, 0x4cc9, 0x13ef,
+	    0x0691, 0x4781, 0x166b, 0x0b5f, 0x05fe, 0x1dda, 0x1e97, 0x046a,
+	    0x228c, 0x115d, 0x0b30, 0x3086, 0x3d7b, 0x47c1, 0x0000, 0x4c71,
+	    0x3c47, 0x4d82, 0x05f6, 0x0d9d, 0x456d, 0x3a1b, 0x12ba, 0x1654,
+	    0x1147, 0x2ec2, 0x0a4e, 0x053e, 0x15aa, 0x2df2, 0x0000, 0x0ab0,
+	    0x0e43, 0x168a, 0x116e, 0x156e, 0x24f3, 0x330e, 0x1994, 0x3ee6,
+	    0x2d28, 0x184f, 0x0000, 0x472f, 0x2db6, 0x2bd2, 0x4709, 0x3b15,
+	    0x46ae, 0x2c56, 0x26fe, 0x07fb, 0x3eeb, 0x0000, 0x4245, 0x4780,
+	    0x1f23, 0x38be, 0x0000, 0x2b84, 0x2966, 0x2283, 0x355a, 0x4cb9,
+	    0x3d34, 0x27e9, 0x0000, 0x2ea6, 0x0000, 0x2c76, 0x10c6, 0x3722,
+	    0x0000, 0x2283, 0x3fcb, 0x3d13, 0x1909, 0x0000, 0x0000, 0x1277,
+	    0x0065, 0x46cd, 0x2d8a, 0x4a63, 0x0000, 0x0159, 0x0dbd, 0x3751,
+	    0x2f47, 0x0000, 0x3893, 0x183e, 0x2cce, 0x0000, 0x2453, 0x1345,
+	    0x22f1, 0x0df7, 0x192b, 0x43e2, 0x1703, 0x0000, 0x1e67, 0x4751,
+	    0x4356, 0x36f6, 0x28d8, 0x3371, 0x39f1, 0x3db3, 0x0cb9, 0x388e,
+	    0x00d6, 0x2e35, 0x31bf, 0x407b, 0x4497, 0x2bad, 0x0000, 0x44f4,
+	    0x3fca, 0x0000, 0x486e, 0x45dc, 0x403e, 0x215d, 0x3960, 0x3ce8,
+	    0x13d3, 0x0000, 0x2696, 0x1536, 0x1ff4, 0x0000, 0x1275, 0x0000,
+	    0x1129, 0x0000, 0x0d33, 0x42fc, 0x4ded, 0x4280, 0x0f6f, 0x0000,
+	    0x168f, 0x0000, 0x0a6b, 0x2704, 0x390f, 0x1645, 0x0000, 0x24e0,
+	    0x48de, 0x1348, 0x0000, 0x2111, 0x0000, 0x3206, 0x4742, 0x18b4,
+	    0x2303, 0x4646, 0x38de, 0x2672, 0x322c, 0x0000, 0x0000, 0x0000,
+	    0x39d0, 0x48bf, 0x0c92, 0x1a19, 0x2d58, 0x0ac8, 0x3a5f, 0x0236,
+	    0x0bf3, 0x1caf, 0x206b, 0x3ac3, 0x0543, 0x1ca1, 0x3f1c, 0x45de,
+	    0x1e33, 0x17c6, 0x331c, 0x0000, 0x2443, 0x24d0, 0x4966, 0x0000,
+	    0x0d99, 0x3fa7, 0x3ead, 0x20c6, 0x043b, 0x3063, 0x49d0, 0x1e09,
+	    0x17fa, 0x1e2a, 0x4984, 0x411a, 0x1e5b, 0x3fa9, 0x0ae2, 0x3029,
+	    0x3df4, 0x0693, 0x0000, 0x3327, 0x0000, 0x1405, 0x099b, 0x0207,
+	    0x3a20, 0x1cb6, 0x2c53, 0x2a82, 0x142d, 0x3ecd, 0x4d5b, 0x0000,
+	    0x3cb8, 0x0fa5, 0x28f5, 0x4d8d, 0x0000, 0x03c8, 0x0c47, 0x4c13,
+	    0x0000, 0x261f, 0x4bc7, 0x435f, 0x0a8e, 0x2017, 0x2462, 0x036f,
+	    0x4630, 0x0000, 0x4203, 0x3225, 0x0000, 0x0c1d, 0x4a12, 0x0000,
+	    0x0bd9, 0x0f92, 0x1cd4, 0x0000, 0x0000, 0x37bd, 0x19ab, 0x377e,
+	    0x2ccc, 0x4a03, 0x40af, 0x07d7, 0x406c, 0x0000, 0x0000, 0x3abf,
+	    0x244a, 0x0000, 0x3505, 0x0000, 0x3e9a, 0x3232, 0x438c, 0x18b6,
+	    0x3bf8, 0x0da9, 0x0efb, 0x0061, 0x0000, 0x0f74, 0x0000, 0x0451,
+	    0x0358, 0x4830, 0x3225, 0x1f8d, 0x3dda, 0x0000, 0x2fb6, 0x0f2f,
+	    0x0000, 0x4101, 0x0000, 0x18c2, 0x0dbb, 0x0000, 0x1c68, 0x0000,
+	    0x0000, 0x307d, 0x11d6, 0x4ad1, 0x3f47, 0x4103, 0x0000, 0x0000,
+	    0x4223, 0x3c45, 0x32d8, 0x3bc5, 0x259c, 0x4dc6, 0x3110, 0x09dd,
+	    0x28bf, 0x05a6, 0x01a1, 0x0000, 0x3930, 0x2c24, 0x032d, 0x180e,
+	    0x395f, 0x23b9, 0x3232, 0x36ff, 0x3a24, 0x0631, 0x0b5a, 0x2110,
+	    0x0000, 0x2031, 0x115e, 0x155b, 0x0000, 0x11e7, 0x0000, 0x3556,
+	    0x1de2, 0x0997, 0x3685, 0x22da, 0x40e6, 0x0000, 0x0000, 0x3cb5,
+	    0x4692, 0x3cf1, 0x20a8, 0x0000, 0x4cf0, 0x4293, 0x0000, 0x0000,
+	    0x1066, 0x3711, 0x2e60, 0x3ef7, 0x2432, 0x0000, 0x016e, 0x0f80,
+	    0x388a, 0x2197, 0x1c6a, 0x4557, 0x0d2a, 0x48a4, 0x1e84, 0x15e9,
+	    0x2296, 0x1926, 0x0000, 0x4369, 0x2e09, 0x0b52, 0x0000, 0x4877,
+	    0x2901, 0x0f3b, 0x11de, 0x0e65, 0x0000, 0x2601, 0x39e3, 0x2de0,
+	    0x4d86, 0x00e0, 0x0000, 0x1561, 0x262c, 0x377e, 0x1971, 0x0947,
+	    0x452c, 0x0b51, 0x3a41, 0x3ff2, 0x13b8, 0x18fc, 0x0186, 0x06fa,
+	    0x4107, 0x1f20, 0x3862, 0x41aa, 0x2e3d, 0x3c98, 0x4962, 0x0259,
+	    0x0000, 0x15f0, 0x0cb5, 0x2fcf, 0x1927, 0x2579, 0x4cfe, 0x3b1c,
+	    0x0000, 0x1002, 0x47e0, 0x336f, 0x4dfb, 0x11b3, 0x4aff, 0x4bdc,
+	    0x03cf, 0x0f39, 0x3fd5, 0x2ab9, 0x18ed, 0x4491, 0x2c90, 0x3caa,
+	    0x49f1, 0x0476, 0x0000, 0x1e6a, 0x0000, 0x053d, 0x011a, 0x336a,
+	    0x4bcc, 0x2d35, 0x4543, 0x2c52, 0x2f73, 0x2d3b, 0x31b8, 0x2efd,
+	    0x0000, 0x1f01, 0x206d, 0x0000, 0x0000, 0x429a, 0x4ca9, 0x00f2,
+	    0x0539, 0x3a6c, 0x1a46, 0x4554, 0x2b34, 0x2732, 0x2f5e, 0x0da5,
+	    0x0000, 0x2214, 0x0000, 0x27a5, 0x1746, 0x080d, 0x0000, 0x0000,
+	    0x21c9, 0x01fe, 0x1315, 0x2dba, 0x221a, 0x3e68, 0x0176, 0x4b81,
+	    0x4a9f, 0x29ce, 0x0000, 0x0000, 0x2ced, 0x0000, 0x293a, 0x0000,
+	    0x0000, 0x450c, 0x2b03, 0x1a4c, 0x3af4, 0x03ef, 0x0000, 0x1383,
+	    0x1139, 0x0000, 0x07d6, 0x4a7c, 0x4a58, 0x0346, 0x33be, 0x40c9,
+	    0x0fc5, 0x18e6, 0x0000, 0x0ebb, 0x07d0, 0x2247, 0x272e, 0x0d6e,
+	    0x0b85, 0x01c8, 0x0000, 0x138c, 0x053b, 0x3dbc, 0x0000, 0x3821,
+	    0x43b2, 0x0000, 0x4751, 0x0ff4, 0x4bea, 0x1656, 0x0439, 0x4605,
+	    0x4435, 0x3aa3, 0x1699, 0x3dea, 0x1c38, 0x3a09, 0x2508, 0x4b7d,
+	    0x2e20, 0x29e7, 0x1926, 0x0f7e, 0x46c6, 0x1143, 0x17c1, 0x4201,
+	    0x3627, 0x0000, 0x0327, 0x32d9, 0x266a, 0x413e, 0x2b9f, 0x0000,
+	    0x253d, 0x3c40, 0x0000, 0x3195, 0x4809, 0x2e35, 0x4a77, 0x44e3,
+	    0x45a9, 0x0000, 0x0000, 0x0000, 0x43c3, 0x3559, 0x18ce, 0x411a,
+	    0x14f4, 0x0000, 0x140b, 0x14a6, 0x0bbb, 0x413e, 0x32fa, 0x083a,
+	    0x0000, 0x33e5, 0x3a6a, 0x4837, 0x4c83, 0x332d, 0x0f02, 0x18ce,
+	    0x39e4, 0x0048, 0x3954, 0x0619, 0x0000, 0x0d11, 0x0969, 0x0000,
+	    0x2121, 0x37c8, 0x2052, 0x2bb5, 0x13ef, 0x43c3, 0x24ce, 0x1010,
+	    0x33ed, 0x0e11, 0x3bcf, 0x17a5, 0x2a6e, 0x2996, 0x22a8, 0x067b,
+	    0x3cf8, 0x03bd, 0x27cb, 0x0000, 0x22aa, 0x0000, 0x4881, 0x1d82,
+	    0x3cc3, 0x4509, 0x1034, 0x3df0, 0x484b, 0x25aa, 0x22ed, 0x3226,
+	    0x1394, 0x47ed, 0x4d6c, 0x15d0, 0x0e22, 0x4b15, 0x0000, 0x30c8,
+	    0x119f, 0x4c02, 0x3db1, 0x2f0e, 0x47b8, 0x17f2, 0x040a, 0x1748,
+	    0x3647, 0x0a4e, 0x0000, 0x3b90, 0x48b4, 0x33c9, 0x02c0, 0x08b0,
+	    0x011a, 0x0000, 0x03f3, 0x0000, 0x1d67, 0x2b17, 0x441d, 0x4527,
+	    0x2602, 0x0000, 0x4732, 0x0000, 0x329b, 0x1adb, 0x34d1, 0x3b10,
+	    0x0000, 0x2fde, 0x08fa, 0x057d, 0x094a, 0x19ed, 0x0000, 0x0000,
+	    0x4425, 0x0000, 0x48e0, 0x0cc7, 0x01f7, 0x11fa, 0x1267, 0x0ac8,
+	    0x1e87, 0x235a, 0x187b, 0x48e8, 0x3902, 0x4084, 0x4165, 0x0423,
+	    0x45eb, 0x195f, 0x0000, 0x283f, 0x18ed, 0x0000, 0x0000, 0x1259,
+	    0x3aa4, 0x0000, 0x18b5, 0x06be, 0x1467, 0x0000, 0x0000, 0x498b,
+	    0x0529, 0x3acd, 0x0000, 0x3fe2, 0x1905, 0x2559, 0x46ad, 0x48ab,
+	    0x23dc, 0x0eb7, 0x1ccd, 0x3ace, 0x0e4d, 0x0000, 0x45d6, 0x3eb7,
+	    0x0000, 0x32db, 0x01ee, 0x21cb, 0x28b5, 0x2a73, 0x0144, 0x4cbf,
+	    0x38af, 0x0000, 0x20d0, 0x0000, 0x2a4a, 0x1fbe, 0x294a, 0x22ff,
+	    0x0a5e, 0x3784, 0x0360, 0x4047, 0x4418, 0x0000, 0x2750, 0x3485,
+	    0x0ab7, 0x3dd9, 0x362f, 0x1210, 0x324c, 0x0000, 0x0000, 0x3449,
+	    0x238c, 0x0000, 0x36e1, 0x22f2, 0x0000, 0x3389, 0x1914, 0x0926,
+	    0x37c9, 0x16b5, 0x3f58, 0x16f4, 0x0000, 0x4039, 0x38f0, 0x0000,
+	    0x37d3, 0x3964, 0x0000, 0x03b9, 0x2902, 0x0eed, 0x2aa0, 0x3084,
+	    0x0289, 0x293a, 0x44d9, 0x06fe, 0x19bc, 0x0000, 0x1150, 0x25cb,
+	    0x3e39, 0x0000, 0x1887, 0x0000, 0x2b15, 0x076c, 0x351b, 0x18fb,
+	    0x03d4, 0x3454, 0x3c3b, 0x3ec0, 0x4164, 0x1d45, 0x1f43, 0x1541,
+	    0x2ff3, 0x04e2, 0x175d, 0x10e0, 0x2abd, 0x3de5, 0x3c51, 0x0000,
+	    0x1842, 0x0000, 0x25e2, 0x02e6, 0x0000, 0x4cb1, 0x0e2f, 0x17fc,
+	    0x49a7, 0x46d4, 0x1b66, 0x027c, 0x30f5, 0x26f7, 0x44cb, 0x4073,
+	    0x0cdb, 0x0000, 0x0000, 0x0000, 0x1096, 0x0000, 0x0b02, 0x4b22,
+	    0x3285, 0x1913, 0x1bae, 0x12ba, 0x0044, 0x0280, 0x1f9e, 0x0938,
+	    0x3abd, 0x1142, 0x0000, 0x1383, 0x2f16, 0x0fa2, 0x223b, 0x121d,
+	    0x3faf, 0x0000, 0x0000, 0x40cb, 0x2780, 0x44e9, 0x0b43, 0x052c,
+	    0x19cf, 0x0000, 0x4c9b, 0x0000, 0x3df4, 0x20c5, 0x2faa, 0x0000,
+	    0x0c12, 0x101b, 0x019d, 0x41e0, 0x14a1, 0x49c3, 0x0de3, 0x213b,
+	    0x27df, 0x0000, 0x370a, 0x1916, 0x3c1d, 0x0000, 0x0b55, 0x34a0,
+	    0x0000, 0x1d67, 0x25a8, 0x0000, 0x0000, 0x2106, 0x17d2, 0x32d8,
+	    0x2031, 0x0000, 0x0000, 0x3085, 0x46e1, 0x4b88, 0x0000, 0x0fb4,
+	    0x3ec6, 0x3f19, 0x2875, 0x2647, 0x3638, 0x0000, 0x0000, 0x2a07,
+	    0x34de, 0x3764, 0x02e4, 0x36b7, 0x136e, 0x1878, 0x0000, 0x3b13,
+	    0x0000, 0x360b, 0x1c73, 0x39f0, 0x3df6, 0x169d, 0x0717, 0x2ea1,
+	    0x0000, 0x21fc, 0x1529, 0x28c0, 0x1745, 0x156d, 0x1da5, 0x3484,
+	    0x0000, 0x0000, 0x4676, 0x0ce8, 0x4418, 0x3c53, 0x1d61, 0x3675,
+	    0x0732, 0x4c0d, 0x2c3f, 0x3798, 0x26a8, 0x215c, 0x17ff, 0x363a,
+	    0x49c4, 0x01ff, 0x2e36, 0x2ca9, 0x1942, 0x1dd5, 0x38de, 0x18b1,
+	    0x0000, 0x3806, 0x3344, 0x4937, 0x31cd, 0x08d8, 0x4c6f, 0x4d8a,
+	    0x0d3c, 0x2828, 0x30c9, 0x1d6f, 0x0000, 0x10d9, 0x174f, 0x0000,
+	    0x24fe, 0x23ce, 0x2bda, 0x2e70, 0x28a0, 0x37f3, 0x0217, 0x4c27,
+	    0x0000, 0x266b, 0x4d65, 0x0968, 0x27ba, 0x1f39, 0x4cbe, 0x4288,
+	    0x32d5, 0x3bd6, 0x2a6d, 0x1a59, 0x1d0e, 0x25a1, 0x0000, 0x0000,
+	    0x0cef, 0x0239, 0x0000, 0x37ed, 0x476a, 0x4b0e, 0x0000, 0x0810,
+	    0x4057, 0x0000, 0x0000, 0x1e02, 0x2a02, 0x2401, 0x1ad7, 0x03c1,
+	    0x2af0, 0x0ca2, 0x1af2, 0x05e5, 0x0b4b, 0x39bf, 0x2be8, 0x0606,
+	    0x4a54, 0x334c, 0x0000, 0x4d5b, 0x08a9, 0x31b4, 0x28db, 0x2998,
+	    0x2346, 0x3075, 0x06f9, 0x2d72, 0x25e9, 0x06a1, 0x182d, 0x0835,
+	    0x10a6, 0x0000, 0x118b, 0x0a3e, 0x0caa, 0x0000, 0x0000, 0x18f4,
+	    0x216c, 0x2e81, 0x017c, 0x1a01, 0x3c9b, 0x48e6, 0x20ef, 0x1bb4,
+	    0x0000, 0x10f9, 0x2e8e, 0x0000, 0x0000, 0x2fbb, 0x283e, 0x1429,
+	    0x2e56, 0x3777, 0x0271, 0x4524, 0x180e, 0x32df, 0x272e, 0x0000,
+	    0x337b, 0x147c, 0x0000, 0x0000, 0x0ee9, 0x0000, 0x25df, 0x4415,
+	    0x0000, 0x044b, 0x1517, 0x3d30, 0x4189, 0x27c4, 0x36cf, 0x1fc2,
+	    0x15c8, 0x15d6, 0x0000, 0x0000, 0x00fd, 0x03f1, 0x2219, 0x2259,
+	    0x135f, 0x1b8d, 0x20e0, 0x36d0, 0x0000, 0x0000, 0x476a, 0x313a,
+	    0x435c, 0x3d7f, 0x428f, 0x1c42, 0x0000, 0x1c22, 0x4c05, 0x3ce4,
+	    0x4260, 0x3794, 0x0000, 0x2a71, 0x4066, 0x3633, 0x2db8, 0x145b,
+	    0x0000, 0x1c93, 0x35ae, 0x1a40, 0x3089, 0x0525, 0x1c8c, 0x4c21,
+	    0x1a4d, 0x2577, 0x0000, 0x3451, 0x0000, 0x13f9, 0x498a, 0x0000,
+	    0x3568, 0x0475, 0x19ec, 0x3951, 0x0f42, 0x0166, 0x139c, 0x0000,
+	    0x1134, 0x260b, 0x0d56, 0x36ff, 0x41ae, 0x2779, 0x45cf, 0x328c,
+	    0x407c, 0x396e, 0x219b, 0x096d, 0x0a41, 0x08db, 0x0124, 0x0000,
+	    0x0000, 0x42c4, 0x1e0b, 0x23db, 0x4880, 0x327c, 0x3f2b, 0x3305,
+	    0x138e, 0x0000, 0x3ac6, 0x3ca0, 0x35c1, 0x0000, 0x3070, 0x2d02,
+	    0x10c4, 0x42bf, 0x0000, 0x0000, 0x0000, 0x09ac, 0x28a3, 0x3e01,
+	    0x0dde, 0x453d, 0x1f82, 0x08ec, 0x1585, 0x48a2, 0x15fd, 0x2cfe,
+	    0x167b, 0x232c, 0x2086, 0x1c67, 0x0d58, 0x0000, 0x0d48, 0x3b5f,
+	    0x2cdd, 0x1b38, 0x0cd1, 0x0000, 0x3f5e, 0x3f60, 0x45cb, 0x4b4f,
+	    0x4560, 0x4919, 0x2755, 0x1d20, 0x0fb0, 0x2502, 0x2545, 0x1a1d,
+	    0x1142, 0x0f2c, 0x1224, 0x0000, 0x0028, 0x2c32, 0x0ec9, 0x1c1b,
+	    0x0000, 0x301b, 0x2cf8, 0x0b9e, 0x2b10, 0x0000, 0x27e8, 0x1004,
+	    0x3129, 0x1ee8, 0x0353, 0x1666, 0x25c7, 0x1547, 0x0000, 0x2878,
+	    0x3fa5, 0x0000, 0x373b, 0x4700, 0x1f0f, 0x2c69, 0x3a76, 0x116e,
+	    0x4c4e, 0x1243, 0x24a9, 0x1d2e, 0x2cb0, 0x4ab5, 0x0d1d, 0x3be8,
+	    0x0a0c, 0x45d0, 0x0000, 0x402c, 0x191a, 0x3d8b, 0x49e7, 0x0000,
+	    0x2881, 0x3a37, 0x4753, 0x0000, 0x2c3c, 0x2de4, 0x1658, 0x3c37,
+	    0x1f4d, 0x1f7e, 0x086e, 0x3f95, 0x30a2, 0x427d, 0x0000, 0x0f5e,
+	    0x3f42, 0x3a65, 0x0000, 0x486a, 0x254a, 0x0364, 0x398e, 0x3fb9,
+	    0x2dde, 0x12bf, 0x0abf, 0x18cd, 0x427b, 0x1a07, 0x3ced, 0x232d,
+	    0x3b8e, 0x3591, 0x4052, 0x2c8a, 0x309d, 0x145c, 0x308b, 0x24e0,
+	    0x354f, 0x2632, 0x26c8, 0x2702, 0x010c, 0x33e7, 0x3334, 0x2bc7,
+	    0x3c67, 0x29ac, 0x4010, 0x3284, 0x1716, 0x16c8, 0x4184, 0x11d6,
+	    0x1377, 0x0000, 0x0000, 0x32ac, 0x0000, 0x1d2a, 0x338a, 0x1a67,
+	    0x4d9c, 0x0000, 0x2703, 0x24c0, 0x41b4, 0x11e5, 0x053e, 0x0000,
+	    0x0000, 0x3646, 0x48fe, 0x0000, 0x2397, 0x3c46, 0x2ff1, 0x024c,
+	    0x2563, 0x0000, 0x2252, 0x3d28, 0x42f8, 0x0f64, 0x4bf7, 0x32fe,
+	    0x475c, 0x1450, 0x0000, 0x3df8, 0x2eaf, 0x36cf, 0x23c1, 0x21bc,
+	    0x34f1, 0x2cb3, 0x0000, 0x0000, 0x0f12, 0x0000, 0x0867, 0x39f5,
+	    0x0000, 0x10d7, 0x21d8, 0x1932, 0x2390, 0x23c3, 0x0bea, 0x2251,
+	    0x2de8, 0x0b39, 0x20e6, 0x4c58, 0x4605, 0x0000, 0x15ec, 0x1e88,
+	    0x1aca, 0x0000, 0x18b5, 0x0000, 0x05d2, 0x4497, 0x30d0, 0x34e4,
+	    0x1c11, 0x33b6, 0x0000, 0x408e, 0x2b75, 0x15bd, 0x1304, 0x2c4b,
+	    0x1adf, 0x0239, 0x227b, 0x0e27, 0x06f7, 0x1ab8, 0x073b, 0x1294,
+	    0x2baf, 0x35fc, 0x0871, 0x182b, 0x344c, 0x08c1, 0x181f, 0x0000,
+	    0x281e, 0x28ef, 0x27c7, 0x190c, 0x24f9, 0x246f, 0x47ab, 0x0754,
+	    0x104d, 0x057a, 0x045d, 0x3981, 0x0f15, 0x21ab, 0x4a69, 0x0244,
+	    0x0000, 0x17b7, 0x41b0, 0x2d43, 0x0dda, 0x01c5, 0x0000, 0x1fa9,
+	    0x0726, 0x188a, 0x1cd3, 0x3ea9, 0x0000, 0x3f43, 0x3e7f, 0x0000,
+	    0x1925, 0x2758, 0x381a, 0x2536, 0x03fd, 0x2593, 0x32a8, 0x1cd5,
+	    0x4578, 0x0000, 0x4b52, 0x1a61, 0x0137, 0x2922, 0x48de, 0x0531,
+	    0x2f4a, 0x4d5f, 0x186e, 0x1dfd, 0x26cd, 0x40c8, 0x2d73, 0x45f8,
+	    0x11e7, 0x0692, 0x0000, 0x352c, 0x1b19, 0x1ee1, 0x229f, 0x0e01,
+	    0x0000, 0x1539, 0x0f92, 0x1e1b, 0x1502, 0x02be, 0x0000, 0x3306,
+	    0x0e6b, 0x19f8, 0x06f7, 0x015f, 0x4a0c, 0x4c22, 0x40cb, 0x4369,
+	    0x1d79, 0x4056, 0x0b80, 0x4cc7, 0x08a4, 0x165b, 0x40e5, 0x2bf4,
+	    0x0000, 0x0000, 0x0000, 0x4c3a, 0x03c0, 0x3308, 0x4b4b, 0x0000,
+	    0x1c20, 0x0814, 0x0000, 0x0459, 0x4185, 0x38f0, 0x262b, 0x2586,
+	    0x1d1b, 0x244c, 0x4424, 0x070c, 0x2d50, 0x31ac, 0x14da, 0x4444,
+	    0x0d4e, 0x142e, 0x30e4, 0x1bcc, 0x2a35, 0x0ef5, 0x409b, 0x0000,
+	    0x4b77, 0x0697, 0x18b3, 0x07d0, 0x1142, 0x18cb, 0x3e54, 0x27e4,
+	    0x11c6, 0x3bdf, 0x05c5, 0x2f5c, 0x4c45, 0x1d69, 0x00b5, 0x373a,
+	    0x2a20, 0x1b81, 0x0af9, 0x1c64, 0x3f20, 0x46cb, 0x0000, 0x015d,
+	    0x3541, 0x1b1d, 0x3127, 0x0000, 0x475e, 0x093e, 0x19f4, 0x0ed8,
+	    0x0000, 0x0000, 0x3118, 0x10d5, 0x0000, 0x18f1, 0x14fe, 0x2703,
+	    0x4593, 0x0000, 0x40c9, 0x01c8, 0x0000, 0x463e, 0x0b8c, 0x0000,
+	    0x2488, 0x27b7, 0x0000, 0x312b, 0x46f5, 0x32c5, 0x1e1c, 0x307b,
+	    0x103e, 0x0000, 0x0be2, 0x44d5, 0x3b9d, 0x2a4d, 0x3210, 0x35b7,
+	    0x10c5, 0x3d04, 0x44f0, 0x42b6, 0x471f, 0x0b6d, 0x0dd5, 0x0000,
+	    0x04cb, 0x0000, 0x304c, 0x29f6, 0x1610, 0x4950, 0x1671, 0x1c6e,
+	    0x0000, 0x4b91, 0x0000, 0x3ec7, 0x299d, 0x269e, 0x31a2, 0x2be4,
+	    0x3ac8, 0x0000, 0x3ad2, 0x006b, 0x4249, 0x4d8a, 0x2fc5, 0x2f2e,
+	    0x367d, 0x45cc, 0x04d8, 0x02e4, 0x22f5, 0x3fa9, 0x1d45, 0x20b9,
+	    0x4508, 0x1781, 0x33de, 0x0b67, 0x0506, 0x2132, 0x34be, 0x0df3,
+	    0x0000, 0x4641, 0x4770, 0x0000, 0x3ffd, 0x0a9a, 0x196d, 0x1fec,
+	    0x0000, 0x3724, 0x004b, 0x26f1, 0x4d65, 0x01c8, 0x0000, 0x41f2,
+	    0x240b, 0x1c88, 0x2bdf, 0x399e, 0x1632, 0x3db9, 0x0000, 0x49a9,
+	    0x011d, 0x1067, 0x2131, 0x12b0, 0x0000, 0x0000, 0x2cde, 0x3e03,
+	    0x2182, 0x1b15, 0x0de8, 0x0c87, 0x423e, 0x482d, 0x0000, 0x0ce6,
+	    0x0f92, 0x14c0, 0x0000, 0x3fd7, 0x1407, 0x3004, 0x40aa, 0x2f97,
+	    0x4abb, 0x27e8, 0x0000, 0x1f21, 0x29d4, 0x22e3, 0x0068, 0x1bbf,
+	    0x0bfb, 0x48ba, 0x0000, 0x08b9, 0x0000, 0x1d7b, 0x08f8, 0x0000,
+	    0x3b77, 0x439a, 0x451c, 0x0e6f, 0x0000, 0x3bf8, 0x0abc, 0x4921,
+	    0x0f7b, 0x095a, 0x178f, 0x0000, 0x429f, 0x23bf, 0x0000, 0x0000,
+	    0x1f18, 0x0000, 0x3b0c, 0x08b3, 0x20bd, 0x0ac4, 0x0b99, 0x16ad,
+	    0x2de7, 0x3ddb, 0x3b1a, 0x4349, 0x0000, 0x11e2, 0x3d27, 0x40bf,
+	    0x216a, 0x0000, 0x0000, 0x3f6b, 0x0bc4, 0x16f5, 0x3111, 0x2ecd,
+	    0x0c27, 0x4d88, 0x2663, 0x2bef, 0x29ca, 0x3d19, 0x4806, 0x38e8,
+	    0x2bb0, 0x0000, 0x31bd, 0x3d6d, 0x08b3, 0x3532, 0x0000, 0x47eb,
+	    0x0000, 0x2946, 0x0c1e, 0x4069, 0x2b55, 0x39c0, 0x31dc, 0x0000,
+	    0x3b72, 0x451e, 0x4aa0, 0x2bc0, 0x0000, 0x2c46, 0x2853, 0x2dbf,
+	    0x14bf, 0x3474, 0x249f, 0x30cb, 0x2fd8, 0x118a, 0x0000, 0x0000,
+	    0x26fd, 0x1eed, 0x3e0e, 0x40c2, 0x178b, 0x0ecf, 0x0000, 0x2988,
+	    0x3347, 0x0de1, 0x3fd0, 0x1160, 0x0d4e, 0x257b, 0x0000, 0x456e,
+	    0x1e2b, 0x12a7, 0x44a9, 0x2579, 0x0000, 0x1d3c, 0x30a8, 0x26a8,
+	    0x2e50, 0x47e2, 0x10e3, 0x23a8, 0x243f, 0x0000, 0x3373, 0x14df,
+	    0x1a41, 0x1c13, 0x2800, 0x075b, 0x0000, 0x0106, 0x30ba, 0x1e72,
+	    0x36b5, 0x0110, 0x119e, 0x4a75, 0x4d58, 0x0000, 0x0967, 0x2d3f,
+	    0x2f6c, 0x3281, 0x0796, 0x0000, 0x330a, 0x2a01, 0x2061, 0x0000,
+	    0x3e79, 0x3923, 0x0000, 0x0788, 0x4c58, 0x0819, 0x01d6, 0x0ae5,
+	    0x1ee5, 0x467c, 0x1cbf, 0x0693, 0x459f, 0x1397, 0x3af6, 0x08e3,
+	    0x0000, 0x090e, 0x2996, 0x36d2, 0x3b97, 0x2486, 0x0131, 0x4467,
+	    0x31f8, 0x081c, 0x18e4, 0x2054, 0x2e33, 0x03e7, 0x4014, 0x0000,
+	    0x446d, 0x32c7, 0x448c, 0x1ce9, 0x2b07, 0x3342, 0x4494, 0x1b1c,
+	    0x4767, 0x35ca, 0x28b3, 0x06e6, 0x0000, 0x310a, 0x3274, 0x4d59,
+	    0x28bd, 0x1b38, 0x0000, 0x0730, 0x4b85, 0x3128, 0x0e36, 0x40a7,
+	    0x3a0d, 0x0000, 0x3148, 0x4870, 0x1e19, 0x20d4, 0x24b1, 0x4ca8,
+	    0x0000, 0x275d, 0x4d3e, 0x1df9, 0x0c7e, 0x1d1d, 0x0000, 0x2980,
+	    0x0fff, 0x1fa0, 0x0fee, 0x2892, 0x26bc, 0x38ed, 0x2e15, 0x4b7d,
+	    0x0000, 0x2d04, 0x0a3f, 0x148f, 0x04f1, 0x3553, 0x274c, 0x3ee5,
+	    0x2fb1, 0x1cdf, 0x0643, 0x354e, 0x2060, 0x2643, 0x0a46, 0x4d0f,
+	    0x0af1, 0x344b, 0x1b4c, 0x49fa, 0x3e5f, 0x018d, 0x3556, 0x2bcd,
+	    0x0bd0, 0x30e3, 0x4774, 0x0000, 0x06fb, 0x0000, 0x3849, 0x3315,
+	    0x37d3, 0x0706, 0x0000, 0x0000, 0x2a1f, 0x0000, 0x0000, 0x07a9,
+	    0x4006, 0x0000, 0x0af0, 0x16c9, 0x358a, 0x3337, 0x14a2, 0x3ed5,
+	    0x2ca6, 0x1011, 0x28ff, 0x0000, 0x1a21, 0x0553, 0x27b1, 0x0000,
+	    0x2594, 0x480a, 0x05cf, 0x0000, 0x460b, 0x298a, 0x0000, 0x1f58,
+	    0x20ef, 0x35e7, 0x1029, 0x0f41, 0x0000, 0x0000, 0x0000, 0x3ca2,
+	    0x4b2c, 0x3bdd, 0x0000, 0x0c73, 0x37bd, 0x316b, 0x0000, 0x4c85,
+	    0x0000, 0x2d5d, 0x0879, 0x0000, 0x445b, 0x0845, 0x1f02, 0x3d9c,
+	    0x1513, 0x0000, 0x0120, 0x46f6, 0x1347, 0x1e08, 0x0995, 0x24e2,
+	    0x0000, 0x08fb, 0x4d03, 0x210b, 0x0000, 0x0000, 0x2251, 0x0000,
+	    0x0e17, 0x0000, 0x236d, 0x0000, 0x2825, 0x0000, 0x3613, 0x47d1,
+	    0x0000, 0x0e27, 0x3095, 0x4ca1, 0x279d, 0x354d, 0x3d16, 0x4847,
+	    0x44d6, 0x4759, 0x18a3, 0x0000, 0x0000, 0x06f6, 0x33cb, 0x1bd7,
+	    0x444d, 0x4cef, 0x4340, 0x2428, 0x1908, 0x14f1, 0x2315, 0x48b9,
+	    0x499f, 0x344a, 0x1a29, 0x0631, 0x0abd, 0x3d57, 0x27ee, 0x0a31,
+	    0x137c, 0x12b6, 0x3ec4, 0x1c51, 0x1b24, 0x3d86, 0x0000, 0x0000,
+	    0x2925, 0x3be7, 0x37fd, 0x0000, 0x422a, 0x435e, 0x48e8, 0x1813,
+	    0x14c7, 0x07d9, 0x19ff, 0x0000, 0x0c56, 0x0000, 0x2ea8, 0x34bc,
+	    0x3f4c, 0x0000, 0x0000, 0x0000, 0x3496, 0x3593, 0x3365, 0x32e9,
+	    0x01b8, 0x05f7, 0x05c3, 0x0000, 0x3d34, 0x3b74, 0x16c1, 0x35ce,
+	    0x0eac, 0x3f13, 0x2dea, 0x3d4e, 0x3c50, 0x0000, 0x19e0, 0x271d,
+	    0x395d, 0x0a29, 0x14d7, 0x1709, 0x0156, 0x14a4, 0x3c8c, 0x258c,
+	    0x0966, 0x43bb, 0x4c1a, 0x0000, 0x17d2, 0x3ffd, 0x2dca, 0x4b9b,
+	    0x399b, 0x3ad4, 0x307d, 0x4933, 0x49d1, 0x2e86, 0x45ef, 0x3b10,
+	    0x1642, 0x0d29, 0x08f4, 0x4316, 0x13ce, 0x3cf1, 0x0000, 0x4de1,
+	    0x4ab5, 0x34e0, 0x4111, 0x478a, 0x2f2b, 0x3cf1, 0x3697, 0x2dcc,
+	    0x2451, 0x0000, 0x04c9, 0x0663, 0x2beb, 0x1524, 0x12c1, 0x0000,
+	    0x3fc8, 0x48f7, 0x188d, 0x0000, 0x0f86, 0x0afd, 0x22a8, 0x399f,
+	    0x0ef6, 0x014b, 0x3479, 0x228a, 0x154b, 0x1c4f, 0x0293, 0x0000,
+	    0x237e, 0x1914, 0x0000, 0x0000, 0x44a2, 0x1095, 0x0e92, 0x0353,
+	    0x3540, 0x0000, 0x45fb, 0x0000, 0x0000, 0x2fd1, 0x31a7, 0x08ee,
+	    0x33c9, 0x1848, 0x20a9, 0x2fed, 0x0fd5, 0x0000, 0x29d5, 0x0000,
+	    0x2af1, 0x3a96, 0x4bfa, 0x49c4, 0x2389, 0x25a8, 0x0000, 0x1d93,
+	    0x4961, 0x1a4a, 0x2988, 0x3a20, 0x0000, 0x0000, 0x0c79, 0x0000,
+	    0x4724, 0x1bf1, 0x4a28, 0x42dd, 0x17bf, 0x294c, 0x20d8, 0x3e77,
+	    0x3f4f, 0x0000, 0x1f0a, 0x457e, 0x27e3, 0x4321, 0x48d1, 0x0792,
+	    0x3e99, 0x4b3e, 0x17f9, 0x325e, 0x0000, 0x4956, 0x1f12, 0x4959,
+	    0x02f0, 0x2d8f, 0x20a8, 0x481a, 0x3e65, 0x1664, 0x35f6, 0x2042,
+	    0x31f1, 0x1cba, 0x0000, 0x2674, 0x2f1b, 0x1d8c, 0x3a7e, 0x0000,
+	    0x4ba2, 0x0ba4, 0x3ffd, 0x2650, 0x0000, 0x272e, 0x4202, 0x38cb,
+	    0x0000, 0x117c, 0x05d7, 0x2b5a, 0x097c, 0x40b5, 0x0f62, 0x23d3,
+	    0x0a3e, 0x0000, 0x2325, 0x4144, 0x3b2c, 0x2c37, 0x0000, 0x0000,
+	    0x1dff, 0x3638, 0x228b, 0x3ec5, 0x272d, 0x0000, 0x20b0, 0x2d08,
+	    0x082c, 0x2a5e, 0x49fc, 0x2abd, 0x2e4e, 0x3cde, 0x249c, 0x2957,
+	    0x23ed, 0x35c2, 0x25e5, 0x4286, 0x0000, 0x42bf, 0x3d98, 0x03f2,
+	    0x1fc7, 0x2fe6, 0x015e, 0x4414, 0x1728, 0x07d4, 0x20b0, 0x0b0a,
+	    0x1f83, 0x0000, 0x36fc, 0x0000, 0x1fb0, 0x0e62, 0x4201, 0x02a9,
+	    0x2311, 0x3508, 0x12a1, 0x0000, 0x2c37, 0x0067, 0x1f58, 0x1414,
+	    0x359f, 0x0501, 0x0000, 0x47ab, 0x430a, 0x0000, 0x1619, 0x3afc,
+	    0x26b3, 0x0000, 0x363e, 0x3e75, 0x0b4a, 0x3372, 0x02ad, 0x2dd8,
+	    0x2b40, 0x1d71, 0x0000, 0x0000, 0x2cbd, 0x451a, 0x2d71, 0x295a,
+	    0x3bce, 0x0000, 0x3083, 0x042b, 0x4293, 0x0000, 0x0000, 0x208b,
+	    0x0000, 0x31ee, 0x0909, 0x35d6, 0x3110, 0x20ba, 0x0000, 0x4797,
+	    0x498f, 0x44b9, 0x2ea5, 0x424b, 0x2af9, 0x226f, 0x0000, 0x0000,
+	    0x1366, 0x0000, 0x42bf, 0x2585, 0x3787, 0x305d, 0x37b7, 0x3901,
+	    0x0000, 0x3aee, 0x1de2, 0x0000, 0x0473, 0x0000, 0x062f, 0x0d77,
+	    0x00d3, 0x4e1a, 0x05c5, 0x0000, 0x0f55, 0x0af9, 0x40da, 0x2c58,
+	    0x2fbd, 0x0000, 0x395f, 0x101f, 0x454f, 0x0000, 0x472e, 0x1cef,
+	    0x1f92, 0x0033, 0x2fb6, 0x184c, 0x0072, 0x08e6, 0x0911, 0x13c6,
+	    0x4238, 0x0000, 0x0d5b, 0x3e5c, 0x0000, 0x0f63, 0x453b, 0x2626,
+	    0x41fe, 0x2e71, 0x0000, 0x063c, 0x0000, 0x02fa, 0x3223, 0x4c59,
+	    0x0000, 0x15ad, 0x07f8, 0x03b6, 0x3fa9, 0x06e2, 0x391c, 0x3290,
+	    0x4397, 0x38e9, 0x3d49, 0x014d, 0x274c, 0x0000, 0x08d6, 0x0076,
+	    0x0000, 0x3d28, 0x0000, 0x2b26, 0x011d, 0x1e7f, 0x23f4, 0x3ed2,
+	    0x3023, 0x4958, 0x04b9, 0x3520, 0x0290, 0x0000, 0x006e, 0x04d1,
+	    0x2691, 0x4700, 0x1d25, 0x0000, 0x01b2, 0x195b, 0x0162, 0x3f09,
+	    0x0fd3, 0x476e, 0x0a7f, 0x2d78, 0x2ec7, 0x1b8f, 0x3f16, 0x4b35,
+	    0x1b82, 0x0000, 0x0f8c, 0x285e, 0x0000, 0x38c4, 0x2160, 0x0000,
+	    0x3066, 0x0000, 0x35cd, 0x0000, 0x3680, 0x196c, 0x2250, 0x0000,
+	    0x0bbb, 0x3f51, 0x08c1, 0x1ab8, 0x0649, 0x2d35, 0x1d24, 0x34dc,
+	    0x0343, 0x4580, 0x0f46, 0x39a3, 0x2321, 0x0000, 0x0bdf, 0x395c,
+	    0x02ce, 0x01a4, 0x0000, 0x0000, 0x3c59, 0x17d1, 0x08f4, 0x01b7,
+	    0x2922, 0x27b8, 0x4a1a, 0x36c8, 0x3eb1, 0x26ff, 0x0843, 0x0000,
+	    0x0d2a, 0x4b97, 0x4b48, 0x3010, 0x10a2, 0x12ad, 0x0234, 0x0000,
+	    0x0000, 0x387c, 0x0000, 0x4bf4, 0x2093, 0x4532, 0x3dcb, 0x296b,
+	    0x0000, 0x41b0, 0x0000, 0x261e, 0x21bc, 0x2a60, 0x2486, 0x035c,
+	    0x2b2d, 0x0a27, 0x1f33, 0x3d9e, 0x0000, 0x0000, 0x04a5, 0x16cf,
+	    0x097e, 0x0000, 0x2981, 0x0000, 0x305e, 0x1849, 0x263e, 0x0dd9,
+	    0x0000, 0x3598, 0x27a9, 0x204a, 0x126f, 0x28e8, 0x48aa, 0x01d3,
+	    0x1ddc, 0x09f4, 0x1bf4, 0x0df2, 0x022f, 0x0e5e, 0x1c17, 0x4039,
+	    0x1f34, 0x1180, 0x4a57, 0x0fde, 0x1ff5, 0x15c3, 0x0154, 0x2538,
+	    0x3eb7, 0x0000, 0x1162, 0x2136, 0x1854, 0x1906, 0x0538, 0x3c1e,
+	    0x4bb6, 0x3133, 0x2a98, 0x3905, 0x3300, 0x203b, 0x031b, 0x0000,
+	    0x1357, 0x0000, 0x1434, 0x01e7, 0x0000, 0x02bd, 0x39cb, 0x3d55,
+	    0x4928, 0x066d, 0x2ae5, 0x26bc, 0x1d13, 0x176d, 0x33b2, 0x0000,
+	    0x3b21, 0x1a11, 0x0000, 0x2082, 0x0000, 0x0202, 0x3b2c, 0x0000,
+	    0x0000, 0x0000, 0x0f3f, 0x00fe, 0x105d, 0x35a6, 0x334f, 0x49bd,
+	    0x1b53, 0x386c, 0x000d, 0x4239, 0x0128, 0x1b08, 0x2c4a, 0x2b8c,
+	    0x1e7a, 0x1c77, 0x0172, 0x1fa4, 0x1a51, 0x4a3a, 0x4ae0, 0x453c,
+	    0x1b0f, 0x49cb, 0x0000, 0x004f, 0x0515, 0x3a0a, 0x00d9, 0x434f,
+	    0x3436, 0x0218, 0x0000, 0x4c65, 0x1f51, 0x14a0, 0x0380, 0x2d9c,
+	    0x0e67, 0x21cc, 0x171a, 0x347c, 0x38d1, 0x1865, 0x06e2, 0x379f,
+	    0x07f2, 0x2109, 0x3270, 0x0000, 0x148b, 0x21af, 0x0000, 0x0000,
+	    0x0946, 0x43cc, 0x0e0b, 0x135c, 0x3e1b, 0x3afe, 0x0000, 0x1165,
+	    0x4ddb, 0x01cc, 0x3df0, 0x1fb7, 0x06f0, 0x29f4, 0x44e5, 0x0000,
+	    0x2123, 0x31e0, 0x0496, 0x4040, 0x1d1a, 0x2eeb, 0x0000, 0x2e5a,
+	    0x39df, 0x366a, 0x01a5, 0x2b46, 0x152e, 0x1a8a, 0x4dcb, 0x3cbb,
+	    0x20e5, 0x13e6, 0x4cb3, 0x385c, 0x1a8d, 0x05f8, 0x054e, 0x0000,
+	    0x13ca, 0x0000, 0x2e79, 0x39f2, 0x12bd, 0x0052, 0x1eae, 0x157c,
+	    0x0000, 0x1862, 0x3807, 0x3a0b, 0x2596, 0x4c9f, 0x1ceb, 0x0f9b,
+	    0x14fb, 0x3445, 0x2f3d, 0x3752, 0x4a0e, 0x0000, 0x13bd, 0x0000,
+	    0x4dac, 0x0000, 0x08e8, 0x4baa, 0x3097, 0x2733, 0x3c36, 0x022f,
+	    0x46f4, 0x1741, 0x42a6, 0x3c18, 0x4d2f, 0x482a, 0x0000, 0x3456,
+	    0x3eac, 0x3fb5, 0x3a2b, 0x0000, 0x1a2d, 0x0603, 0x11ca, 0x17d6,
+	    0x494b, 0x2743, 0x353c, 0x39c5, 0x0b9f, 0x43c0, 0x22cd, 0x0cb9,
+	    0x32ce, 0x1e91, 0x0a4e, 0x2be9, 0x24ce, 0x20a6, 0x1625, 0x27a9,
+	    0x0000, 0x3194, 0x0000, 0x4a25, 0x0000, 0x0de7, 0x45ed, 0x24d5,
+	    0x1ceb, 0x19c5, 0x25d4, 0x177f, 0x3c26, 0x3c44, 0x2448, 0x063c,
+	    0x3646, 0x4933, 0x19c5, 0x0000, 0x455a, 0x238b, 0x3aa5, 0x4760,
+	    0x1592, 0x3247, 0x135f, 0x0000, 0x0000, 0x1020, 0x155d, 0x1483,
+	    0x2f12, 0x3db5, 0x2a74, 0x38e5, 0x171f, 0x344e, 0x4107, 0x1320,
+	    0x3997, 0x2f63, 0x11c8, 0x2c28, 0x2d1e, 0x452c, 0x1359, 0x0000,
+	    0x4c2b, 0x1d23, 0x2212, 0x2a4b, 0x3bab, 0x1b18, 0x0f24, 0x4b0c,
+	    0x0000, 0x340f, 0x332f, 0x0353, 0x2f01, 0x0d38, 0x1c4e, 0x2453,
+	    0x2ede, 0x0dba, 0x41bc, 0x4cae, 0x194c, 0x0442, 0x2d03, 0x0000,
+	    0x3123, 0x4b99, 0x42ce, 0x0000, 0x3339, 0x0110, 0x1345, 0x40a3,
+	    0x245d, 0x1046, 0x1553, 0x34e4, 0x3ab5, 0x4c82, 0x1d71, 0x2b12,
+	    0x17fd, 0x3d5b, 0x4a28, 0x0000, 0x39e1, 0x4493, 0x0000, 0x373d,
+	    0x11c9, 0x13cc, 0x16ce, 0x3792, 0x1a13, 0x2546, 0x321b, 0x0047,
+	    0x0000, 0x0000, 0x41c6, 0x294f, 0x2605, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2633, 0x0000, 0x0054, 0x1449, 0x46c4, 0x10a6, 0x3b51,
+	    0x1a2b, 0x2e7d, 0x0a5a, 0x4d15, 0x0e0e, 0x2c8f, 0x1abb, 0x14f3,
+	    0x36c0, 0x2071, 0x0371, 0x2bb8, 0x4d49, 0x0911, 0x0a6e, 0x287c,
+	    0x1372, 0x0000, 0x4520, 0x0dbf, 0x0760, 0x1350, 0x10c8, 0x0000,
+	    0x0000, 0x4533, 0x0000, 0x2841, 0x147c, 0x45d6, 0x0378, 0x02ff,
+	    0x4758, 0x4149, 0x0000, 0x0433, 0x209b, 0x2dae, 0x0b5a, 0x0000,
+	    0x1820, 0x43c9, 0x293b, 0x3ffa, 0x32cc, 0x0000, 0x1a5f, 0x1c3b,
+	    0x27c1, 0x1430, 0x13e7, 0x19c0, 0x1a9f, 0x4e12, 0x1d2d, 0x0000,
+	    0x384d, 0x38eb, 0x0000, 0x1a1d, 0x26b8, 0x0000, 0x0a4c, 0x24b8,
+	    0x046a, 0x1120, 0x260f, 0x141a, 0x16f1, 0x2070, 0x02b2, 0x0000,
+	    0x3572, 0x0000, 0x33f6, 0x1870, 0x4956, 0x2841, 0x3768, 0x0000,
+	    0x22df, 0x3a52, 0x0000, 0x36bc, 0x0000, 0x1e65, 0x0000, 0x0000,
+	    0x40cc, 0x1959, 0x0e30, 0x1055, 0x3193, 0x38ef, 0x0000, 0x0663,
+	    0x0000, 0x2be8, 0x0000, 0x376c, 0x2862, 0x4cc8, 0x186b, 0x0000,
+	    0x2870, 0x3858, 0x0701, 0x3161, 0x1168, 0x1db2, 0x0000, 0x0000,
+	    0x31c9, 0x10e6, 0x00e6, 0x1974, 0x44ce, 0x37dd, 0x1c26, 0x2d69,
+	    0x4a8e, 0x25dd, 0x1f60, 0x0000, 0x39ea, 0x0db0, 0x07c0, 0x2c3c,
+	    0x3516, 0x1b2d, 0x2e4d, 0x0000, 0x187c, 0x1128, 0x16bf, 0x0000,
+	    0x2fa1, 0x207c, 0x4085, 0x1f31, 0x0bb6, 0x16e6, 0x0000, 0x059f,
+	    0x0000, 0x0dd8, 0x0000, 0x0000, 0x394b, 0x0000, 0x3ab3, 0x4cc5,
+	    0x0714, 0x112b, 0x3076, 0x0000, 0x1514, 0x3217, 0x1a5c, 0x36cf,
+	    0x4a7d, 0x43a5, 0x0000, 0x359e, 0x0a5e, 0x0bdc, 0x0490, 0x1836,
+	    0x038d, 0x0000, 0x3005, 0x057b, 0x1f18, 0x0000, 0x36cf, 0x1719,
+	    0x26d0, 0x1c1e, 0x2b5f, 0x194f, 0x0000, 0x349f, 0x3509, 0x1e0e,
+	    0x096d, 0x0ec3, 0x1e80, 0x3fde, 0x0c48, 0x0692, 0x39e3, 0x4927,
+	    0x0085, 0x248e, 0x47ec, 0x3971, 0x249f, 0x4431, 0x0000, 0x28a9,
+	    0x33cd, 0x2bc5, 0x0000, 0x0000, 0x0000, 0x03a2, 0x4603, 0x1fed,
+	    0x159b, 0x4299, 0x4071, 0x07b3, 0x4d34, 0x0000, 0x1870, 0x06c9,
+	    0x0aba, 0x3788, 0x4125, 0x0000, 0x0723, 0x1dcd, 0x3e2d, 0x1a61,
+	    0x415c, 0x195c, 0x0f15, 0x0cc6, 0x0000, 0x02d8, 0x05d1, 0x0301,
+	    0x4d27, 0x4673, 0x0804, 0x2780, 0x1e7f, 0x0035, 0x3a92, 0x4236,
+	    0x49b6, 0x0cfa, 0x3f10, 0x0f1a, 0x1696, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1a7b, 0x2aab, 0x1253, 0x0efd, 0x2463, 0x0000, 0x29ea,
+	    0x0000, 0x443e, 0x053c, 0x2a08, 0x210c, 0x09f0, 0x1b46, 0x40cf,
+	    0x20e4, 0x0f41, 0x0000, 0x2bb5, 0x0000, 0x0000, 0x1894, 0x1c69,
+	    0x396e, 0x0000, 0x0e15, 0x0000, 0x1edc, 0x3103, 0x241f, 0x0000,
+	    0x0b1b, 0x0000, 0x1259, 0x0740, 0x352c, 0x0000, 0x4935, 0x291d,
+	    0x0000, 0x22c8, 0x2e68, 0x20a0, 0x080c, 0x4198, 0x02e4, 0x0387,
+	    0x3f38, 0x0a98, 0x424b, 0x1e27, 0x0d5e, 0x07f3, 0x4c7d, 0x3ea1,
+	    0x16e7, 0x1c5c, 0x3c4e, 0x1d14, 0x0000, 0x0000, 0x36d1, 0x1cf0,
+	    0x0000, 0x1ad6, 0x0fe6, 0x4933, 0x0000, 0x20aa, 0x2779, 0x31ab,
+	    0x3638, 0x4b43, 0x2d13, 0x4406, 0x21f6, 0x468b, 0x27c9, 0x29a5,
+	    0x4e14, 0x4a2c, 0x357c, 0x4764, 0x0046, 0x0000, 0x3cf0, 0x4c0c,
+	    0x4438, 0x32da, 0x19ad, 0x2da8, 0x0000, 0x172f, 0x0000, 0x2cc6,
+	    0x4255, 0x109d, 0x3f6b, 0x4abc, 0x3410, 0x4bf0, 0x08f9, 0x4b2d,
+	    0x1729, 0x091f, 0x3203, 0x458e, 0x0265, 0x24d8, 0x4468, 0x0000,
+	    0x27c4, 0x0fb1, 0x0000, 0x0d6a, 0x4001, 0x3969, 0x299a, 0x136d,
+	    0x237e, 0x351f, 0x33d3, 0x4679, 0x3366, 0x23e4, 0x0000, 0x42a9,
+	    0x3b78, 0x45da, 0x41bf, 0x3e7a, 0x0000, 0x0000, 0x0000, 0x4d2a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x1e63, 0x36a0, 0x0000, 0x00e2,
+	    0x0000, 0x34ce, 0x00cb, 0x122d, 0x3b20, 0x362f, 0x4000, 0x198b,
+	    0x0000, 0x0eb5, 0x329e, 0x1c1b, 0x13b9, 0x165f, 0x1b60, 0x3cf0,
+	    0x281e, 0x32f7, 0x1acf, 0x0000, 0x158a, 0x0b83, 0x375d, 0x256d,
+	    0x0000, 0x456a, 0x0110, 0x1eed, 0x0000, 0x0d70, 0x46e6, 0x44be,
+	    0x3a26, 0x372a, 0x2ef4, 0x1ca2, 0x2da7, 0x2062, 0x1508, 0x1a69,
+	    0x468f, 0x128f, 0x0467, 0x14e1, 0x1209, 0x133a, 0x2af5, 0x0000,
+	    0x44b6, 0x0000, 0x0000, 0x2ac3, 0x4d17, 0x3a37, 0x03f7, 0x1666,
+	    0x3157, 0x0550, 0x4708, 0x3935, 0x0000, 0x3641, 0x212e, 0x3ada,
+	    0x33f4, 0x0000, 0x1e6f, 0x4a08, 0x0000, 0x4cb0, 0x45eb, 0x2c4b,
+	    0x3ff7, 0x081d, 0x37a5, 0x27d1, 0x0283, 0x2290, 0x20d0, 0x3f40,
+	    0x1f69, 0x1d3c, 0x2cfd, 0x126b, 0x0000, 0x2b8c, 0x2a5a, 0x1074,
+	    0x124b, 0x025a, 0x45fb, 0x0a6c, 0x0000, 0x2cc4, 0x0324, 0x2fb5,
+	    0x08ba, 0x1290, 0x09d5, 0x4c31, 0x3058, 0x0000, 0x18dd, 0x0000,
+	    0x15ba, 0x014b, 0x4ae4, 0x0305, 0x0000, 0x0ff6, 0x0000, 0x2ccd,
+	    0x4d41, 0x2377, 0x0a7f, 0x479e, 0x0d4a, 0x0000, 0x0000, 0x3135,
+	    0x0000, 0x46c2, 0x4232, 0x113d, 0x23a9, 0x4bed, 0x1eb3, 0x1dfe,
+	    0x1b39, 0x1bb6, 0x45a9, 0x432d, 0x3160, 0x4694, 0x234a, 0x2897,
+	    0x497e, 0x0000, 0x4ce5, 0x1226, 0x2d54, 0x35e0, 0x4baa, 0x2d60,
+	    0x0000, 0x310e, 0x0000, 0x1ecc, 0x4c4b, 0x0000, 0x3f13, 0x19bb,
+	    0x28a1, 0x0899, 0x14fb, 0x2cb0, 0x1437, 0x0bda, 0x497a, 0x30c5,
+	    0x11c5, 0x0000, 0x05fe, 0x061e, 0x0000, 0x0000, 0x1079, 0x1f3f,
+	    0x0cad, 0x04ca, 0x0000, 0x1d13, 0x4375, 0x0000, 0x01ba, 0x4702,
+	    0x3533, 0x2648, 0x0000, 0x1deb, 0x3492, 0x0679, 0x45cb, 0x42c5,
+	    0x413e, 0x0000, 0x14ab, 0x2982, 0x47fd, 0x27b3, 0x0000, 0x0607,
+	    0x426a, 0x0000, 0x4da2, 0x3067, 0x43fb, 0x32ad, 0x0000, 0x1074,
+	    0x2fe5, 0x3932, 0x3e66, 0x09f6, 0x0000, 0x0c37, 0x1d45, 0x071d,
+	    0x0e02, 0x0289, 0x3596, 0x1471, 0x1232, 0x25a1, 0x1410, 0x0000,
+	    0x30c6, 0x3006, 0x0000, 0x2bd8, 0x4341, 0x3fb2, 0x364b, 0x0000,
+	    0x1c4b, 0x0000, 0x212f, 0x2f6c, 0x4919, 0x17bc, 0x1312, 0x1a8d,
+	    0x270b, 0x4474, 0x2897, 0x4808, 0x0d08, 0x2184, 0x36b1, 0x09f8,
+	    0x38a7, 0x022d, 0x0183, 0x1047, 0x0000, 0x44d2, 0x4a02, 0x2d3a,
+	    0x1839, 0x0545, 0x1352, 0x0b83, 0x0000, 0x423a, 0x2903, 0x4a8a,
+	    0x39fa, 0x1fe2, 0x0305, 0x3a6e, 0x47ff, 0x18f7, 0x1b59, 0x3dfa,
+	    0x0477, 0x34d4, 0x2b8e, 0x0206, 0x2eef, 0x2150, 0x0000, 0x2ca3,
+	    0x4847, 0x243b, 0x2dfa, 0x0000, 0x07e4, 0x4a91, 0x0000, 0x06df,
+	    0x2ae3, 0x3052, 0x44b7, 0x180e, 0x454f, 0x0000, 0x0f3f, 0x1205,
+	    0x0000, 0x3802, 0x3b98, 0x0000, 0x1098, 0x06cb, 0x02a8, 0x0000,
+	    0x2eb0, 0x2a26, 0x40aa, 0x4b88, 0x2206, 0x1628, 0x37f5, 0x0000,
+	    0x08e8, 0x0000, 0x0f4d, 0x0000, 0x1ddd, 0x468c, 0x1485, 0x214b,
+	    0x42f1, 0x4a94, 0x4939, 0x1f97, 0x2c29, 0x0000, 0x2e61, 0x22d3,
+	    0x16b1, 0x4e07, 0x0000, 0x0879, 0x4da1, 0x3522, 0x4608, 0x0000,
+	    0x3cae, 0x0569, 0x0560, 0x004b, 0x0000, 0x345e, 0x3231, 0x3c02,
+	    0x138c, 0x3f16, 0x02b2, 0x05c4, 0x08bd, 0x08f9, 0x14b1, 0x0000,
+	    0x0000, 0x428a, 0x0cfe, 0x229d, 0x4a90, 0x3754, 0x192c, 0x1b3c,
+	    0x3dff, 0x0000, 0x127b, 0x1e9b, 0x0db9, 0x0000, 0x2da8, 0x0efc,
+	    0x0000, 0x29ee, 0x13d9, 0x3164, 0x23f7, 0x1fbb, 0x4370, 0x0f4b,
+	    0x0a2d, 0x05c9, 0x2089, 0x4712, 0x4708, 0x2c9a, 0x0245, 0x2fb4,
+	    0x0ada, 0x0000, 0x1ec3, 0x058b, 0x0000, 0x31ad, 0x175d, 0x0ccd,
+	    0x3322, 0x0f1a, 0x0000, 0x0940, 0x3f1f, 0x41d5, 0x17ba, 0x0000,
+	    0x0e92, 0x4b0e, 0x306f, 0x43c1, 0x1d87, 0x0e94, 0x1e5b, 0x0897,
+	    0x0baa, 0x0000, 0x4a97, 0x1263, 0x13a6, 0x0000, 0x0788, 0x0352,
+	    0x1e98, 0x477a, 0x0000, 0x0000, 0x0000, 0x279f, 0x0000, 0x2038,
+	    0x2ed8, 0x33ad, 0x35f7, 0x0000, 0x4483, 0x018f, 0x06f4, 0x0000,
+	    0x414c, 0x23dd, 0x4c8f, 0x18b2, 0x36eb, 0x14d1, 0x3340, 0x3fc2,
+	    0x0000, 0x063b, 0x0000, 0x29da, 0x1dbb, 0x1d6c, 0x1578, 0x0e77,
+	    0x337c, 0x3932, 0x4dae, 0x0000, 0x167a, 0x101f, 0x4497, 0x28d2,
+	    0x0982, 0x2da7, 0x0000, 0x3971, 0x096d, 0x3790, 0x0000, 0x42fa,
+	    0x4d86, 0x059c, 0x3153, 0x0000, 0x284a, 0x183c, 0x2b85, 0x1e5e,
+	    0x1e67, 0x216d, 0x1cbd, 0x2eb5, 0x3ee9, 0x1a47, 0x0000, 0x0000,
+	    0x1d6d, 0x388a, 0x3445, 0x4e07, 0x1200, 0x089a, 0x3514, 0x0000,
+	    0x326d, 0x0a2d, 0x0443, 0x3efc, 0x0000, 0x0000, 0x09e5, 0x3976,
+	    0x2623, 0x0c73, 0x0000, 0x0000, 0x2707, 0x0000, 0x3aa2, 0x0f32,
+	    0x499b, 0x0b44, 0x26f0, 0x4498, 0x2ea9, 0x450e, 0x3fc2, 0x0000,
+	    0x19f4, 0x4c4e, 0x2861, 0x023e, 0x2ce1, 0x2b45, 0x4053, 0x0000,
+	    0x1209, 0x3aff, 0x0b5a, 0x2970, 0x2239, 0x2b59, 0x1677, 0x41af,
+	    0x0011, 0x2dd9, 0x4539, 0x101c, 0x2e56, 0x46be, 0x0000, 0x1135,
+	    0x38a6, 0x20a8, 0x0000, 0x164f, 0x28f2, 0x465f, 0x0fc7, 0x0e32,
+	    0x1a2e, 0x0000, 0x2383, 0x0580, 0x41b6, 0x491b, 0x33c3, 0x0000,
+	    0x3c66, 0x3c79, 0x2366, 0x1b92, 0x0dac, 0x49e5, 0x10d6, 0x3dc8,
+	    0x0000, 0x0000, 0x01ef, 0x3590, 0x0000, 0x1550, 0x49fa, 0x0a55,
+	    0x0000, 0x0000, 0x0000, 0x4331, 0x2052, 0x0551, 0x4cae, 0x1646,
+	    0x1a75, 0x32fe, 0x4371, 0x0000, 0x37e2, 0x4bc7, 0x0000, 0x120b,
+	    0x180c, 0x3ae0, 0x1858, 0x1c2b, 0x140e, 0x290e, 0x35ab, 0x32bf,
+	    0x0000, 0x480e, 0x1c64, 0x294e, 0x1dab, 0x429d, 0x0910, 0x0000,
+	    0x2858, 0x284d, 0x3b52, 0x1687, 0x28f2, 0x0bb8, 0x11fe, 0x3989,
+	    0x1ed6, 0x1e44, 0x256f, 0x13e2, 0x00c8, 0x324c, 0x0000, 0x10c0,
+	    0x40d2, 0x1130, 0x3d13, 0x0000, 0x0000, 0x2f92, 0x465b, 0x23f9,
+	    0x39ce, 0x0000, 0x1916, 0x34b9, 0x0afd, 0x306a, 0x0fa4, 0x0edc,
+	    0x0000, 0x3d85, 0x3e13, 0x2b33, 0x412a, 0x3944, 0x0000, 0x48ff,
+	    0x308c, 0x094f, 0x2a59, 0x0000, 0x0000, 0x30b3, 0x0000, 0x4d95,
+	    0x373a, 0x0000, 0x0000, 0x2198, 0x0000, 0x2a2f, 0x3905, 0x1874,
+	    0x1ede, 0x32e0, 0x0000, 0x2337, 0x10db, 0x3c64, 0x14cd, 0x192c,
+	    0x207e, 0x20d3, 0x2d14, 0x1750, 0x48c9, 0x0000, 0x16d3, 0x416b,
+	    0x365f, 0x3435, 0x36f1, 0x0d80, 0x3025, 0x265e, 0x02a3, 0x262d,
+	    0x27e8, 0x4945, 0x3384, 0x0000, 0x2b61, 0x3998, 0x3328, 0x41cd,
+	    0x248b, 0x0000, 0x0000, 0x0000, 0x17f4, 0x0000, 0x0000, 0x0000,
+	    0x053f, 0x22a3, 0x0000, 0x4acb, 0x2d7a, 0x0000, 0x43dc, 0x1322,
+	    0x3ab7, 0x0a07, 0x0b42, 0x1653, 0x0000, 0x0000, 0x095d, 0x2237,
+	    0x1f99, 0x3b0a, 0x2d1f, 0x19ad, 0x08a3, 0x2af1, 0x0000, 0x4120,
+	    0x3086, 0x4741, 0x0000, 0x3318, 0x0b01, 0x0000, 0x2ae9, 0x0d39,
+	    0x42ce, 0x3c03, 0x2794, 0x308b, 0x0000, 0x311d, 0x181f, 0x184f,
+	    0x400e, 0x4af2, 0x091c, 0x1562, 0x4916, 0x1441, 0x4694, 0x2ad0,
+	    0x346f, 0x2d91, 0x1694, 0x0000, 0x1adf, 0x198b, 0x0000, 0x107a,
+	    0x0cf7, 0x1aa0, 0x120c, 0x0862, 0x0000, 0x48d2, 0x0000, 0x1dbc,
+	    0x180d, 0x3419, 0x294d, 0x285e, 0x21bc, 0x0000, 0x01e8, 0x0000,
+	    0x17d7, 0x0309, 0x26f3, 0x35c5, 0x296e, 0x0000, 0x33a3, 0x0900,
+	    0x2d5b, 0x0e77, 0x0000, 0x3dcf, 0x3f4f, 0x2298, 0x20ea, 0x0000,
+	    0x0296, 0x1678, 0x138d, 0x0000, 0x0000, 0x164b, 0x2c5d, 0x0000,
+	    0x19c8, 0x40be, 0x2b5c, 0x2c56, 0x0000, 0x20f3, 0x18fb, 0x19c3,
+	    0x4940, 0x2dcc, 0x124e, 0x0aa4, 0x06a1, 0x3243, 0x3cc8, 0x0cf0,
+	    0x2932, 0x08e0, 0x4cff, 0x1790, 0x231c, 0x43df, 0x3772, 0x37d0,
+	    0x087f, 0x004b, 0x0225, 0x0050, 0x2d1f, 0x0ad1, 0x4549, 0x0bd9,
+	    0x44e6, 0x1b51, 0x26cd, 0x0000, 0x0000, 0x3fac, 0x18f6, 0x0667,
+	    0x430e, 0x3e76, 0x205f, 0x3bce, 0x1e37, 0x066b, 0x4c9a, 0x1cf4,
+	    0x3d50, 0x0000, 0x0000, 0x0c8e, 0x0cfa, 0x238e, 0x2014, 0x0c21,
+	    0x262a, 0x406d, 0x485d, 0x48d4, 0x0825, 0x4d74, 0x0baf, 0x0000,
+	    0x2aa7, 0x0000, 0x1d80, 0x0559, 0x388b, 0x003c, 0x09ac, 0x0f75,
+	    0x3d4e, 0x1578, 0x0000, 0x4acf, 0x08d4, 0x0000, 0x3fb1, 0x1a00,
+	    0x17bd, 0x2c14, 0x01d6, 0x40ee, 0x1a8b, 0x3fd9, 0x48ef, 0x3df1,
+	    0x3472, 0x0000, 0x0000, 0x1a6f, 0x1684, 0x43c7, 0x1660, 0x49fb,
+	    0x2416, 0x12b6, 0x0000, 0x13d3, 0x0000, 0x2484, 0x2cfe, 0x3883,
+	    0x3ff4, 0x0000, 0x3c4a, 0x0000, 0x2c94, 0x436e, 0x0836, 0x273b,
+	    0x0444, 0x4bf1, 0x029d, 0x49cd, 0x4413, 0x2fcc, 0x4685, 0x02aa,
+	    0x412e, 0x18dc, 0x0000, 0x3797, 0x38de, 0x43bf, 0x028a, 0x1125,
+	    0x0e8f, 0x0000, 0x0000, 0x045c, 0x42f5, 0x0000, 0x1c63, 0x3be7,
+	    0x4984, 0x434f, 0x0000, 0x2b41, 0x4176, 0x3b32, 0x0000, 0x0000,
+	    0x38c9, 0x3412, 0x0ac7, 0x1ac6, 0x26cd, 0x14d7, 0x3825, 0x0000,
+	    0x1a08, 0x0b76, 0x0a28, 0x2dbd, 0x4578, 0x1928, 0x1857, 0x0c3f,
+	    0x230d, 0x2648, 0x3c7c, 0x478a, 0x380e, 0x0000, 0x4d6f, 0x3ccf,
+	    0x27eb, 0x12b6, 0x3c71, 0x2e85, 0x2526, 0x272e, 0x21dd, 0x1f81,
+	    0x4a29, 0x376f, 0x1903, 0x11e7, 0x12ed, 0x1e73, 0x4644, 0x22b7,
+	    0x0e28, 0x3ebe, 0x0528, 0x08f9, 0x0a86, 0x1303, 0x3324, 0x0000,
+	    0x067f, 0x16a4, 0x3109, 0x35ca, 0x15d5, 0x0000, 0x3505, 0x0527,
+	    0x38be, 0x34db, 0x2568, 0x49e1, 0x02f5, 0x32c6, 0x0000, 0x1251,
+	    0x0d50, 0x2047, 0x3ac2, 0x3cb8, 0x0000, 0x3e9f, 0x00f2, 0x3d18,
+	    0x0000, 0x09e0, 0x3692, 0x44c2, 0x1774, 0x2869, 0x0000, 0x005b,
+	    0x42de, 0x2515, 0x1526, 0x0000, 0x2e76, 0x4b3c, 0x34d3, 0x449d,
+	    0x0b46, 0x4669, 0x0204, 0x3c61, 0x0000, 0x0000, 0x2433, 0x0746,
+	    0x0f49, 0x1367, 0x03cd, 0x3ec0, 0x4d05, 0x0e0b, 0x3654, 0x0000,
+	    0x0000, 0x0000, 0x42f2, 0x4a72, 0x0000, 0x4c37, 0x078a, 0x4d67,
+	    0x3fcd, 0x286e, 0x1ec7, 0x0064, 0x3425, 0x0000, 0x46f1, 0x25ef,
+	    0x1a95, 0x20be, 0x00cd, 0x28be, 0x2c10, 0x3ad5, 0x289b, 0x0881,
+	    0x1bab, 0x03fa, 0x0000, 0x0000, 0x39dc, 0x3baf, 0x18f3, 0x412a,
+	    0x1c17, 0x0b79, 0x0000, 0x3879, 0x276b, 0x26f7, 0x0000, 0x04ab,
+	    0x02bf, 0x2772, 0x2124, 0x4504, 0x17ba, 0x0000, 0x0000, 0x2cc8,
+	    0x24d3, 0x46bc, 0x34c5, 0x3352, 0x281a, 0x1b23, 0x18ac, 0x3ba3,
+	    0x0000, 0x0c17, 0x0add, 0x0000, 0x18b9, 0x0000, 0x2801, 0x3694,
+	    0x21b9, 0x2d8a, 0x0000, 0x32f8, 0x4b40, 0x42d6, 0x2d9d, 0x0000,
+	    0x476f, 0x0ecd, 0x032b, 0x2a06, 0x0c7d, 0x296c, 0x02f3, 0x1b0e,
+	    0x4505, 0x0000, 0x0ef3, 0x0000, 0x10d8, 0x2f11, 0x3ac1, 0x2faa,
+	    0x4847, 0x0000, 0x4b4e, 0x0000, 0x0b1f, 0x23c7, 0x0000, 0x13af,
+	    0x1666, 0x442b, 0x4728, 0x0000, 0x0000, 0x3058, 0x0000, 0x17fb,
+	    0x0422, 0x389b, 0x4bda, 0x097c, 0x0000, 0x1e56, 0x0000, 0x38cc,
+	    0x04e3, 0x35b2, 0x0000, 0x0000, 0x134c, 0x1b2c, 0x0000, 0x0000,
+	    0x11a9, 0x394c, 0x20bd, 0x238b, 0x20c4, 0x37ff, 0x1cb1, 0x0b62,
+	    0x4482, 0x1b5b, 0x3890, 0x4109, 0x1f67, 0x0d21, 0x01ce, 0x193d,
+	    0x2d76, 0x416c, 0x0bb0, 0x4115, 0x101c, 0x0000, 0x26e4, 0x19ce,
+	    0x19ba, 0x0000, 0x2179, 0x49c6, 0x2a49, 0x0a16, 0x0000, 0x448f,
+	    0x1abb, 0x1614, 0x4a50, 0x1ccb, 0x0c24, 0x4813, 0x0000, 0x2548,
+	    0x0000, 0x422b, 0x0e3e, 0x21b8, 0x4571, 0x4188, 0x3eb2, 0x1ea6,
+	    0x02a9, 0x0c7d, 0x30aa, 0x0000, 0x157a, 0x1c62, 0x2160, 0x06c4,
+	    0x0000, 0x1c5d, 0x0bfd, 0x0000, 0x3624, 0x2231, 0x4427, 0x1521,
+	    0x36ed, 0x31a8, 0x4495, 0x0edf, 0x35eb, 0x4968, 0x1c22, 0x30d8,
+	    0x0000, 0x02d1, 0x2b8f, 0x2ce5, 0x3692, 0x2be0, 0x1d41, 0x0000,
+	    0x15e3, 0x0000, 0x2fdf, 0x3a63, 0x0fe8, 0x3fa9, 0x146f, 0x06b0,
+	    0x0000, 0x3995, 0x0792, 0x0000, 0x03d4, 0x2bfc, 0x4670, 0x22ae,
+	    0x0d81, 0x2870, 0x3f4b, 0x0e38, 0x3c79, 0x0000, 0x484e, 0x3b1d,
+	    0x2553, 0x4537, 0x134f, 0x249d, 0x40f9, 0x08e0, 0x3642, 0x19d5,
+	    0x4077, 0x016a, 0x44de, 0x001d, 0x2d40, 0x41d4, 0x13bd, 0x10dc,
+	    0x2f9a, 0x2b27, 0x29c6, 0x0022, 0x11d6, 0x0352, 0x2227, 0x0000,
+	    0x4ab1, 0x1733, 0x3ee8, 0x1bb8, 0x1fb5, 0x2ebb, 0x1b7b, 0x0752,
+	    0x2043, 0x118b, 0x0000, 0x12c5, 0x0588, 0x0000, 0x3ef9, 0x4b3b,
+	    0x1128, 0x4de4, 0x0a19, 0x3c8b, 0x125a, 0x412e, 0x392b, 0x31e2,
+	    0x25a6, 0x1402, 0x0000, 0x0000, 0x1511, 0x47a5, 0x16b2, 0x4ce2,
+	    0x0000, 0x2847, 0x1a92, 0x39c5, 0x1fbd, 0x127b, 0x0000, 0x3d96,
+	    0x3962, 0x0c91, 0x26da, 0x0000, 0x0173, 0x4520, 0x4b64, 0x2f24,
+	    0x1994, 0x0000, 0x40d5, 0x3441, 0x1fa9, 0x4678, 0x269a, 0x37c5,
+	    0x0000, 0x0000, 0x1430, 0x2f42, 0x26af, 0x364d, 0x4c38, 0x0000,
+	    0x4a65, 0x0000, 0x3453, 0x3bb1, 0x4232, 0x2906, 0x0000, 0x44c9,
+	    0x0000, 0x3133, 0x0e42, 0x19a1, 0x166f, 0x1493, 0x026f, 0x0000,
+	    0x4783, 0x0000, 0x43e1, 0x0000, 0x37a7, 0x0c86, 0x2a03, 0x1eba,
+	    0x232c, 0x068f, 0x025d, 0x249e, 0x1a38, 0x0000, 0x407b, 0x0000,
+	    0x1ce7, 0x0d04, 0x0392, 0x060a, 0x15fd, 0x23c3, 0x0000, 0x1a37,
+	    0x26be, 0x06ec, 0x0000, 0x03c9, 0x1fc8, 0x365e, 0x38d6, 0x32a0,
+	    0x3cc5, 0x1bd3, 0x29bf, 0x3516, 0x244a, 0x021b, 0x1024, 0x3a22,
+	    0x0000, 0x3c1e, 0x471d, 0x12d7, 0x467b, 0x1231, 0x05cb, 0x0571,
+	    0x0d6a, 0x39fa, 0x153f, 0x438b, 0x250f, 0x0d1c, 0x24af, 0x313c,
+	    0x453b, 0x185f, 0x04c6, 0x15e0, 0x3f72, 0x3d41, 0x2376, 0x332b,
+	    0x3d4f, 0x36a6, 0x0000, 0x3667, 0x1e5d, 0x0f31, 0x3592, 0x1e77,
+	    0x329d, 0x0000, 0x2bbf, 0x478b, 0x0454, 0x25cd, 0x38cb, 0x2dff,
+	    0x465f, 0x3d68, 0x492f, 0x209c, 0x347b, 0x49d3, 0x0e07, 0x2006,
+	    0x1547, 0x3444, 0x03ce, 0x2d36, 0x0000, 0x2dab, 0x1fb1, 0x0a55,
+	    0x0000, 0x2b16, 0x47d1, 0x2a8f, 0x0b86, 0x2f15, 0x4c0a, 0x0000,
+	    0x453d, 0x487f, 0x303e, 0x0000, 0x18ad, 0x425b, 0x412e, 0x2848,
+	    0x043a, 0x3ec0, 0x1a46, 0x0000, 0x1679, 0x455a, 0x4de0, 0x2602,
+	    0x3993, 0x29a5, 0x060e, 0x27f0, 0x4674, 0x2096, 0x0214, 0x386d,
+	    0x31d9, 0x34fa, 0x2cda, 0x0000, 0x32b8, 0x0000, 0x403a, 0x1d69,
+	    0x17e8, 0x2cce, 0x0fbd, 0x0000, 0x0e28, 0x13d9, 0x1c35, 0x234c,
+	    0x13eb, 0x0000, 0x3ef7, 0x31cf, 0x4045, 0x0ee3, 0x091b, 0x0000,
+	    0x04f4, 0x40bd, 0x4bca, 0x4a96, 0x1b38, 0x0000, 0x370c, 0x1087,
+	    0x19ac, 0x18a1, 0x08e0, 0x35de, 0x0000, 0x07ab, 0x10f7, 0x15f3,
+	    0x0000, 0x171e, 0x3fbb, 0x2cba, 0x0000, 0x2371, 0x2561, 0x0000,
+	    0x351e, 0x40e7, 0x3528, 0x2735, 0x06bc, 0x1296, 0x2ff0, 0x4412,
+	    0x2858, 0x2a2e, 0x11ef, 0x2d67, 0x35c7, 0x1822, 0x3e01, 0x0000,
+	    0x337a, 0x4532, 0x041a, 0x3604, 0x1ca2, 0x1eb8, 0x3a62, 0x3ad7,
+	    0x4c3e, 0x2153, 0x3115, 0x46ef, 0x0000, 0x0000, 0x0235, 0x1cca,
+	    0x32ce, 0x2892, 0x19e8, 0x29b8, 0x3087, 0x2efc, 0x411e, 0x158b,
+	    0x33dc, 0x4966, 0x0824, 0x0000, 0x45d2, 0x0000, 0x4a24, 0x1684,
+	    0x208b, 0x0000, 0x3e7b, 0x3455, 0x317f, 0x2fb3, 0x16a8, 0x28e8,
+	    0x0f9a, 0x1b9a, 0x3319, 0x0000, 0x4851, 0x40e2, 0x4c2f, 0x0bf3,
+	    0x0000, 0x16ea, 0x0000, 0x3d0a, 0x048f, 0x0000, 0x0000, 0x1ac3,
+	    0x0000, 0x2e83, 0x1a51, 0x0da9, 0x0628, 0x29f5, 0x0000, 0x0f02,
+	    0x2711, 0x06c9, 0x39c5, 0x1a5c, 0x2849, 0x1e07, 0x3c87, 0x016e,
+	    0x0000, 0x2acd, 0x1af3, 0x0758, 0x0000, 0x0000, 0x0c56, 0x2b47,
+	    0x0016, 0x0000, 0x0b82, 0x0ebb, 0x0000, 0x44ba, 0x0000, 0x0000,
+	    0x3fe1, 0x48da, 0x4377, 0x4e1f, 0x1dd3, 0x0000, 0x010a, 0x0d81,
+	    0x0000, 0x290d, 0x0000, 0x2691, 0x4353, 0x06fa, 0x27b2, 0x1c16,
+	    0x41d2, 0x0000, 0x3ca7, 0x3417, 0x0000, 0x25fc, 0x3c28, 0x4153,
+	    0x0000, 0x098f, 0x4d63, 0x455f, 0x0ed4, 0x1cc8, 0x081c, 0x2359,
+	    0x301d, 0x26c7, 0x4dc6, 0x0c27, 0x187c, 0x0000, 0x3fae, 0x3c64,
+	    0x0000, 0x3797, 0x0ba2, 0x0c36, 0x2f4b, 0x1b10, 0x4346, 0x2010,
+	    0x4a42, 0x0000, 0x0000, 0x2fc4, 0x08a9, 0x24dd, 0x1700, 0x47f0,
+	    0x0000, 0x2e19, 0x33f2, 0x22a8, 0x3535, 0x0863, 0x2756, 0x19de,
+	    0x0000, 0x374e, 0x1017, 0x354c, 0x1314, 0x2afb, 0x1e0e, 0x0000,
+	    0x2bbe, 0x0c2a, 0x2a45, 0x1dae, 0x3466, 0x0000, 0x2897, 0x0f95,
+	    0x303a, 0x33be, 0x37cf, 0x1c0c, 0x0862, 0x1060, 0x12c9, 0x1ca5,
+	    0x0000, 0x0000, 0x0000, 0x30d4, 0x2768, 0x4bd4, 0x2a48, 0x10f1,
+	    0x1ed0, 0x3056, 0x3ab1, 0x1e4f, 0x1251, 0x06c1, 0x2888, 0x0000,
+	    0x0000, 0x2fb9, 0x3742, 0x07af, 0x4e0f, 0x3cde, 0x1ba0, 0x4360,
+	    0x11c4, 0x157f, 0x2dcd, 0x3f67, 0x45ec, 0x0000, 0x1c01, 0x2a93,
+	    0x388d, 0x0473, 0x43a2, 0x0000, 0x2e10, 0x3d02, 0x0000, 0x3c6e,
+	    0x1c62, 0x0000, 0x0000, 0x2726, 0x0000, 0x0000, 0x0b20, 0x1dec,
+	    0x171d, 0x3ab4, 0x4247, 0x40ee, 0x48f6, 0x1efd, 0x2fe4, 0x4866,
+	    0x1a59, 0x41aa, 0x0000, 0x2081, 0x3996, 0x0f18, 0x2aba, 0x0eb9,
+	    0x00c4, 0x3cf5, 0x2be3, 0x1569, 0x4d7f, 0x2b9d, 0x069b, 0x07e2,
+	    0x41da, 0x1580, 0x398a, 0x1504, 0x1cdd, 0x4c0f, 0x0000, 0x0000,
+	    0x1d04, 0x08d1, 0x19bd, 0x25ea, 0x40b1, 0x3ba2, 0x04b5, 0x3fb8,
+	    0x1a4e, 0x1261, 0x3161, 0x0000, 0x19b2, 0x356c, 0x0000, 0x1a59,
+	    0x46a8, 0x37a1, 0x290a, 0x39c6, 0x2786, 0x329f, 0x37bb, 0x1b43,
+	    0x014e, 0x4b66, 0x209a, 0x31ed, 0x2b3f, 0x015c, 0x2e2b, 0x0130,
+	    0x1bae, 0x2f31, 0x4644, 0x3bdf, 0x0000, 0x0ae9, 0x09ae, 0x0000,
+	    0x437a, 0x0ec5, 0x0000, 0x4aca, 0x012c, 0x3a39, 0x1598, 0x11c2,
+	    0x0000, 0x34dd, 0x480e, 0x3a9c, 0x0000, 0x26c2, 0x4680, 0x4939,
+	    0x41a9, 0x1716, 0x112b, 0x2239, 0x3222, 0x3b75, 0x04f2, 0x1d9a,
+	    0x0000, 0x0000, 0x1b46, 0x2684, 0x4d3f, 0x0000, 0x0000, 0x21ac,
+	    0x4d8a, 0x1bd5, 0x0000, 0x3bd1, 0x32c3, 0x06a0, 0x0000, 0x2e07,
+	    0x02b3, 0x1fea, 0x1784, 0x4d63, 0x429b, 0x2b3e, 0x3024, 0x1187,
+	    0x029c, 0x1d03, 0x1dc9, 0x0000, 0x3f6a, 0x0af7, 0x06a6, 0x0000,
+	    0x1284, 0x2437, 0x4901, 0x3066, 0x42af, 0x1408, 0x2fce, 0x2a3d,
+	    0x1bc8, 0x1161, 0x222c, 0x3aca, 0x43d5, 0x083a, 0x3c79, 0x1fc2,
+	    0x0000, 0x457a, 0x1472, 0x3d16, 0x272e, 0x06c9, 0x4042, 0x02d8,
+	    0x497a, 0x0796, 0x4dbf, 0x4dfb, 0x1ed6, 0x1a24, 0x270a, 0x2b1c,
+	    0x0eca, 0x2ab2, 0x1708, 0x0000, 0x0a9b, 0x22ae, 0x147b, 0x0f33,
+	    0x25c2, 0x38a0, 0x1c65, 0x06d8, 0x2cb6, 0x0000, 0x4dbc, 0x1f26,
+	    0x15c5, 0x0e71, 0x0bde, 0x0000, 0x0000, 0x1567, 0x0000, 0x3ae3,
+	    0x042a, 0x3139, 0x4c7b, 0x0874, 0x06d5, 0x406e, 0x31b0, 0x08a6,
+	    0x2c16, 0x3ab2, 0x2b71, 0x0dd2, 0x2c01, 0x17ce, 0x281c, 0x422d,
+	    0x1721, 0x4770, 0x0000, 0x3b3e, 0x0816, 0x1464, 0x207f, 0x2f1c,
+	    0x0000, 0x067a, 0x098f, 0x3541, 0x3e4b, 0x36d8, 0x3b2a, 0x0000,
+	    0x0445, 0x15ff, 0x09ca, 0x3927, 0x0000, 0x16aa, 0x0000, 0x02ab,
+	    0x09f5, 0x0000, 0x0549, 0x0000, 0x1b26, 0x0b95, 0x3b9b, 0x0000,
+	    0x0000, 0x3c26, 0x3eea, 0x0000, 0x4a52, 0x48c5, 0x135c, 0x2edc,
+	    0x2205, 0x29d6, 0x468f, 0x20bd, 0x0000, 0x0000, 0x1e61, 0x0000,
+	    0x332c, 0x2dca, 0x1662, 0x3e71, 0x2dc2, 0x17bf, 0x1d2b, 0x4bb6,
+	    0x24f6, 0x0000, 0x0000, 0x223a, 0x0000, 0x4c19, 0x033a, 0x11fa,
+	    0x0000, 0x28b6, 0x3cd1, 0x44a4, 0x1704, 0x0000, 0x43df, 0x07a4,
+	    0x2e67, 0x3ffd, 0x2ecf, 0x48d8, 0x362f, 0x0000, 0x0000, 0x1c02,
+	    0x2c3a, 0x0000, 0x2338, 0x4a65, 0x0c9c, 0x39d9, 0x29dd, 0x2f6f,
+	    0x414a, 0x0788, 0x206d, 0x42fc, 0x0413, 0x059e, 0x1f09, 0x2158,
+	    0x3a40, 0x1099, 0x43de, 0x3013, 0x0138, 0x14b3, 0x2023, 0x218c,
+	    0x4ad2, 0x0000, 0x0000, 0x010d, 0x3bc5, 0x0000, 0x4be9, 0x0000,
+	    0x4aea, 0x4b64, 0x39a3, 0x0812, 0x0000, 0x080e, 0x08dc, 0x292d,
+	    0x18c9, 0x1ae5, 0x0000, 0x4d68, 0x20c7, 0x17e2, 0x4944, 0x0750,
+	    0x1608, 0x0000, 0x1e9e, 0x3701, 0x3616, 0x4284, 0x0a0e, 0x1c3b,
+	    0x0000, 0x41ac, 0x0ff8, 0x1de0, 0x044d, 0x375f, 0x1078, 0x0000,
+	    0x3d95, 0x3fa1, 0x409c, 0x0000, 0x3470, 0x0763, 0x0000, 0x0865,
+	    0x088b, 0x12b3, 0x2498, 0x12f2, 0x0000, 0x0000, 0x17bf, 0x1290,
+	    0x0c77, 0x30e3, 0x234e, 0x2f8a, 0x228b, 0x0abd, 0x44aa, 0x21da,
+	    0x480d, 0x3643, 0x477d, 0x327a, 0x469e, 0x0b6d, 0x0000, 0x15f0,
+	    0x25cf, 0x29fb, 0x0d06, 0x050e, 0x2a24, 0x0000, 0x1a66, 0x071f,
+	    0x1cb5, 0x1f68, 0x0000, 0x435f, 0x409c, 0x0e35, 0x06d9, 0x230d,
+	    0x19f6, 0x04be, 0x3253, 0x4367, 0x35d9, 0x2c58, 0x200d, 0x1101,
+	    0x2847, 0x0102, 0x0000, 0x4da5, 0x3417, 0x0000, 0x3351, 0x0d11,
+	    0x2ca0, 0x3dc1, 0x3ee0, 0x0000, 0x2423, 0x16be, 0x0000, 0x4995,
+	    0x4bd5, 0x0390, 0x03e0, 0x3aa3, 0x35eb, 0x2638, 0x1748, 0x456b,
+	    0x2764, 0x2713, 0x34c0, 0x03c5, 0x021c, 0x379d, 0x4955, 0x3755,
+	    0x0000, 0x3359, 0x3cee, 0x432c, 0x1163, 0x3870, 0x06ff, 0x2b6b,
+	    0x119e, 0x4280, 0x0ab3, 0x10f3, 0x0000, 0x4cbf, 0x1d8c, 0x0cd0,
+	    0x0fd7, 0x0000, 0x4add, 0x3bda, 0x0000, 0x0000, 0x14a1, 0x1147,
+	    0x10fd, 0x3429, 0x0000, 0x3cb1, 0x47ce, 0x394b, 0x0000, 0x4349,
+	    0x10b0, 0x4532, 0x3e95, 0x0000, 0x17e5, 0x14b5, 0x105c, 0x3d9c,
+	    0x3818, 0x3b8c, 0x45e9, 0x4bea, 0x049c, 0x2581, 0x0e73, 0x0000,
+	    0x0000, 0x0000, 0x08e9, 0x1706, 0x2cc4, 0x0000, 0x24ca, 0x06cb,
+	    0x3a05, 0x3ffa, 0x0000, 0x4b79, 0x2abb, 0x11d5, 0x285c, 0x12b8,
+	    0x0fe0, 0x4110, 0x0f48, 0x3f5c, 0x153f, 0x2fd3, 0x3ea9, 0x05ae,
+	    0x39a4, 0x2c97, 0x0e46, 0x448e, 0x3bbc, 0x19f7, 0x0000, 0x40a9,
+	    0x4ba8, 0x121b, 0x3784, 0x3664, 0x13a2, 0x469d, 0x01be, 0x34ce,
+	    0x45ee, 0x2420, 0x4add, 0x0271, 0x14e9, 0x2643, 0x3fde, 0x0c41,
+	    0x0000, 0x0bcd, 0x26b4, 0x2748, 0x40ee, 0x2429, 0x0000, 0x0540,
+	    0x3a02, 0x2aa7, 0x2ecc, 0x0f6f, 0x0000, 0x2fe0, 0x16fb, 0x1224,
+	    0x201c, 0x121f, 0x1a75, 0x3fb9, 0x11e1, 0x21d0, 0x0000, 0x3288,
+	    0x4769, 0x0000, 0x0000, 0x1d1f, 0x0000, 0x0c16, 0x0000, 0x43fd,
+	    0x142a, 0x048f, 0x0000, 0x3c6e, 0x320e, 0x0000, 0x1fbf, 0x28d4,
+	    0x1c9b, 0x3690, 0x0b0c, 0x0bce, 0x382c, 0x45c1, 0x19e9, 0x2967,
+	    0x1027, 0x0000, 0x397f, 0x0000, 0x31aa, 0x3019, 0x1c0e, 0x19ae,
+	    0x0000, 0x15cd, 0x402c, 0x0000, 0x4e1a, 0x019e, 0x042d, 0x24ee,
+	    0x47d0, 0x1114, 0x2797, 0x44cd, 0x2391, 0x13ec, 0x0000, 0x0000,
+	    0x0000, 0x1632, 0x0b39, 0x2dc1, 0x2137, 0x028c, 0x1df2, 0x2165,
+	    0x2de2, 0x01db, 0x148a, 0x3de1, 0x0000, 0x2aec, 0x43b3, 0x02ad,
+	    0x21c0, 0x041b, 0x24c2, 0x17a4, 0x10d4, 0x29b7, 0x3a3a, 0x014d,
+	    0x20b4, 0x0942, 0x0000, 0x1f43, 0x0e1b, 0x1f05, 0x4630, 0x0000,
+	    0x11b2, 0x401c, 0x47c8, 0x3749, 0x0ee5, 0x4cda, 0x18e7, 0x32d7,
+	    0x1029, 0x224c, 0x1b35, 0x4caf, 0x0e36, 0x36e9, 0x4837, 0x13b9,
+	    0x06a3, 0x4b80, 0x0e18, 0x1801, 0x1976, 0x20f8, 0x2b5c, 0x0000,
+	    0x0000, 0x358c, 0x3042, 0x2787, 0x31ec, 0x4cc8, 0x4a19, 0x24e3,
+	    0x00ce, 0x4655, 0x0000, 0x068e, 0x2d16, 0x0000, 0x0b9a, 0x145f,
+	    0x3d4f, 0x0000, 0x1fc9, 0x4ba1, 0x0708, 0x40af, 0x10d4, 0x0000,
+	    0x3596, 0x1f8b, 0x0000, 0x0000, 0x22a6, 0x1c78, 0x17e2, 0x30f3,
+	    0x3200, 0x3ef3, 0x356f, 0x3345, 0x02ac, 0x2b5b, 0x2ca1, 0x20d0,
+	    0x3394, 0x27c7, 0x05af, 0x375a, 0x0000, 0x4097, 0x0000, 0x1abf,
+	    0x0ed3, 0x2851, 0x1ba1, 0x1857, 0x0678, 0x4a6d, 0x380d, 0x212e,
+	    0x4bab, 0x16b7, 0x05d7, 0x2443, 0x0000, 0x3b1f, 0x3480, 0x3dbf,
+	    0x3cbf, 0x25ad, 0x3253, 0x057a, 0x19dd, 0x0000, 0x3bff, 0x42dc,
+	    0x2a25, 0x3f11, 0x1c7d, 0x3470, 0x1a0b, 0x0000, 0x35d2, 0x22c2,
+	    0x0000, 0x329c, 0x0058, 0x360f, 0x001a, 0x2c00, 0x44a4, 0x36c4,
+	    0x0000, 0x03bf, 0x0000, 0x3030, 0x326e, 0x0083, 0x0486, 0x2091,
+	    0x2a2d, 0x2a49, 0x4919, 0x2fbb, 0x1285, 0x1059, 0x209e, 0x418f,
+	    0x0cbd, 0x437c, 0x3811, 0x0000, 0x0000, 0x0000, 0x3dea, 0x0000,
+	    0x1cfb, 0x0af7, 0x16bf, 0x4a70, 0x31b0, 0x00b8, 0x47f3, 0x0000,
+	    0x2f61, 0x407a, 0x3b0d, 0x089f, 0x0000, 0x49c8, 0x2856, 0x0000,
+	    0x3279, 0x28f8, 0x1eed, 0x14b9, 0x21cd, 0x4339, 0x1e53, 0x3fcb,
+	    0x11dd, 0x41b2, 0x3b91, 0x0000, 0x1415, 0x1774, 0x4bef, 0x0000,
+	    0x1167, 0x10be, 0x1a05, 0x36d9, 0x1471, 0x2e17, 0x03c2, 0x0000,
+	    0x3739, 0x089a, 0x13e7, 0x1547, 0x2cd5, 0x4bc6, 0x383d, 0x13b2,
+	    0x4935, 0x0000, 0x0d79, 0x0000, 0x2515, 0x2587, 0x0000, 0x3253,
+	    0x0000, 0x0be3, 0x3acd, 0x35e4, 0x308a, 0x338c, 0x0084, 0x0efa,
+	    0x4cb6, 0x390e, 0x2a86, 0x283d, 0x1a4d, 0x0000, 0x4900, 0x4b5a,
+	    0x0464, 0x06b6, 0x3661, 0x1e44, 0x0000, 0x4a60, 0x07a0, 0x0000,
+	    0x147b, 0x0000, 0x1763, 0x0000, 0x46bc, 0x0b75, 0x0bd2, 0x0000,
+	    0x3888, 0x18d0, 0x292d, 0x411f, 0x0000, 0x3114, 0x3c31, 0x05b7,
+	    0x0000, 0x2153, 0x2422, 0x2e05, 0x0000, 0x01da, 0x0afc, 0x3778,
+	    0x49ac, 0x0000, 0x40ce, 0x0000, 0x0aa3, 0x1982, 0x0000, 0x28b3,
+	    0x340b, 0x1771, 0x17ac, 0x401e, 0x0000, 0x36d5, 0x3268, 0x0000,
+	    0x000e, 0x062e, 0x467c, 0x30f5, 0x42e8, 0x3567, 0x1e9f, 0x34ae,
+	    0x30eb, 0x384f, 0x2bba, 0x0000, 0x0000, 0x0002, 0x2fc3, 0x354a,
+	    0x2e24, 0x136d, 0x0000, 0x379c, 0x0d15, 0x241f, 0x3190, 0x058e,
+	    0x0000, 0x43d8, 0x288c, 0x0000, 0x2d7b, 0x0000, 0x280c, 0x4a37,
+	    0x19bb, 0x3ef8, 0x3866, 0x24f8, 0x4600, 0x4165, 0x3393, 0x0000,
+	    0x1a0e, 0x0000, 0x0000, 0x3449, 0x293a, 0x473c, 0x0151, 0x2698,
+	    0x0000, 0x03cf, 0x1fc4, 0x0000, 0x28b2, 0x0000, 0x2b3b, 0x4a39,
+	    0x311d, 0x17ba, 0x4d2d, 0x0aa1, 0x2fd2, 0x32d4, 0x0ae0, 0x071e,
+	    0x042c, 0x210e, 0x2965, 0x26fb, 0x2f81, 0x0000, 0x0d1c, 0x2dbc,
+	    0x0000, 0x29aa, 0x0000, 0x20b9, 0x334e, 0x01b6, 0x446e, 0x06f7,
+	    0x1054, 0x0000, 0x3ff7, 0x3544, 0x4785, 0x3fd3, 0x0b76, 0x0000,
+	    0x1199, 0x4828, 0x185d, 0x189e, 0x008c, 0x13af, 0x29a5, 0x168d,
+	    0x1e36, 0x0d2d, 0x0000, 0x41c4, 0x1d04, 0x43d6, 0x1721, 0x1ef3,
+	    0x2501, 0x0000, 0x0fb8, 0x283e, 0x0000, 0x1b60, 0x1801, 0x3a7f,
+	    0x1959, 0x0a33, 0x0a3e, 0x1cab, 0x4d10, 0x0000, 0x1296, 0x2146,
+	    0x4a2f, 0x21d5, 0x0000, 0x441a, 0x3373, 0x3fe5, 0x1ad3, 0x375a,
+	    0x26e0, 0x29f3, 0x4706, 0x147f, 0x15a6, 0x4941, 0x4d3c, 0x2432,
+	    0x1bbd, 0x09db, 0x432d, 0x0000, 0x2484, 0x1608, 0x0000, 0x40c8,
+	    0x30dc, 0x0000, 0x4dbe, 0x3e15, 0x0000, 0x3b16, 0x478b, 0x487d,
+	    0x3b84, 0x0000, 0x3c16, 0x030c, 0x0ed0, 0x0000, 0x39fb, 0x3da4,
+	    0x185b, 0x0000, 0x0000, 0x0517, 0x30dc, 0x3db3, 0x20c5, 0x29cf,
+	    0x36f8, 0x0ce0, 0x4a5c, 0x294f, 0x0859, 0x4730, 0x1824, 0x2b75,
+	    0x0084, 0x0000, 0x1e79, 0x0000, 0x0aa5, 0x2cfc, 0x1cd5, 0x47c1,
+	    0x26a2, 0x0000, 0x1e86, 0x4751, 0x0989, 0x0000, 0x4bd6, 0x3b1d,
+	    0x2981, 0x1321, 0x151b, 0x0623, 0x3c1a, 0x1603, 0x1245, 0x3ee2,
+	    0x0000, 0x0000, 0x090e, 0x22ce, 0x0486, 0x0b8e, 0x0000, 0x0000,
+	    0x2f01, 0x2b95, 0x242f, 0x0e20, 0x4c7d, 0x3a45, 0x0064, 0x02a3,
+	    0x3690, 0x3d4b, 0x0e80, 0x0000, 0x0000, 0x0000, 0x0000, 0x4e04,
+	    0x0000, 0x3aca, 0x0000, 0x329f, 0x0379, 0x48ab, 0x1780, 0x04d8,
+	    0x4632, 0x0091, 0x0929, 0x1de5, 0x0000, 0x0000, 0x0000, 0x0515,
+	    0x1be9, 0x41b3, 0x1e77, 0x0000, 0x34d5, 0x0be7, 0x3e13, 0x48e4,
+	    0x159b, 0x37d5, 0x0000, 0x37b4, 0x457b, 0x1421, 0x2fb9, 0x11ac,
+	    0x1b70, 0x12fa, 0x1868, 0x1eb5, 0x4c81, 0x2686, 0x3ce6, 0x0000,
+	    0x2507, 0x40b1, 0x19d2, 0x220f, 0x0000, 0x0dac, 0x0dea, 0x0661,
+	    0x0844, 0x293a, 0x00da, 0x1850, 0x0000, 0x369e, 0x46a0, 0x0000,
+	    0x0000, 0x27d8, 0x0000, 0x0000, 0x3098, 0x0f81, 0x4b4a, 0x0000,
+	    0x18f7, 0x0000, 0x47cf, 0x0000, 0x0000, 0x47ad, 0x0000, 0x0000,
+	    0x0000, 0x1b9f, 0x0946, 0x266b, 0x0000, 0x2e32, 0x2f5d, 0x04ba,
+	    0x4474, 0x34c5, 0x1c97, 0x3b58, 0x0473, 0x4749, 0x49c8, 0x0f33,
+	    0x4199, 0x099c, 0x2f3d, 0x4def, 0x1321, 0x0000, 0x1803, 0x40a6,
+	    0x0ca5, 0x2372, 0x0000, 0x3275, 0x0000, 0x3b60, 0x0dbb, 0x38e6,
+	    0x3634, 0x0649, 0x2f78, 0x486c, 0x05a7, 0x3a88, 0x0af4, 0x31b6,
+	    0x0480, 0x1742, 0x26c2, 0x0000, 0x0e36, 0x3aaf, 0x4a37, 0x0161,
+	    0x08a9, 0x0000, 0x4abb, 0x30cf, 0x0000, 0x2ca7, 0x34d4, 0x27ec,
+	    0x0000, 0x420f, 0x3d0f, 0x0f8d, 0x113f, 0x0000, 0x0923, 0x0000,
+	    0x0501, 0x25e1, 0x2b18, 0x2aa7, 0x0000, 0x396e, 0x0000, 0x0000,
+	    0x0000, 0x21f5, 0x3d00, 0x0000, 0x3a1d, 0x0000, 0x0000, 0x1cf8,
+	    0x4b8f, 0x1c95, 0x0000, 0x1793, 0x3e32, 0x0000, 0x0ca0, 0x341c,
+	    0x43a0, 0x1a5b, 0x45ca, 0x0000, 0x41f2, 0x095f, 0x2be4, 0x156c,
+	    0x227c, 0x44fd, 0x3438, 0x0000, 0x3de9, 0x20e9, 0x26c2, 0x0a61,
+	    0x27e1, 0x0000, 0x0000, 0x24b4, 0x137c, 0x0cf9, 0x43bb, 0x351d,
+	    0x2891, 0x1b38, 0x306d, 0x13a3, 0x0000, 0x0df7, 0x043d, 0x3a71,
+	    0x3e9f, 0x204c, 0x01c2, 0x0000, 0x2a9d, 0x07b3, 0x0000, 0x1d92,
+	    0x35be, 0x058f, 0x0968, 0x413a, 0x0000, 0x275c, 0x01a1, 0x34b2,
+	    0x0000, 0x393a, 0x0000, 0x10f0, 0x1664, 0x2367, 0x2c6d, 0x35f4,
+	    0x2786, 0x0000, 0x2bde, 0x1830, 0x0301, 0x150d, 0x0873, 0x49a4,
+	    0x42f0, 0x41e4, 0x3b8c, 0x303b, 0x4d18, 0x10b0, 0x0fc2, 0x1ed6,
+	    0x3f0e, 0x2847, 0x3520, 0x00e1, 0x0000, 0x36cf, 0x14da, 0x4576,
+	    0x4261, 0x0000, 0x25b3, 0x4513, 0x2036, 0x2190, 0x4da6, 0x1b15,
+	    0x0882, 0x0904, 0x0000, 0x0000, 0x1f68, 0x2f5f, 0x49c4, 0x10b4,
+	    0x0000, 0x29ad, 0x18f7, 0x0000, 0x21b0, 0x0f9e, 0x330a, 0x0c48,
+	    0x2070, 0x0186, 0x0d20, 0x3c46, 0x326a, 0x4b96, 0x11b5, 0x41a2,
+	    0x2862, 0x1dc4, 0x230e, 0x0000, 0x0000, 0x41a9, 0x17c4, 0x0567,
+	    0x3c6e, 0x2a4a, 0x3747, 0x0813, 0x379f, 0x3a4e, 0x1be8, 0x2ace,
+	    0x4afc, 0x4b2b, 0x2af5, 0x240a, 0x4750, 0x0000, 0x24bb, 0x0000,
+	    0x0000, 0x3bd9, 0x4c4f, 0x1c8c, 0x4b7d, 0x3265, 0x0651, 0x0000,
+	    0x4de4, 0x085a, 0x18f7, 0x2c61, 0x0246, 0x36df, 0x03d4, 0x0000,
+	    0x41a9, 0x0000, 0x38ed, 0x078b, 0x2c42, 0x3b92, 0x1479, 0x32a7,
+	    0x496f, 0x3e78, 0x411f, 0x4c14, 0x0000, 0x2224, 0x2b5c, 0x48cc,
+	    0x1d4d, 0x4abc, 0x0add, 0x0ffd, 0x337a, 0x40f7, 0x1ebf, 0x4e1d,
+	    0x0000, 0x0000, 0x26ca, 0x1336, 0x03de, 0x25d9, 0x42c6, 0x2160,
+	    0x0f23, 0x4650, 0x0000, 0x08ed, 0x118d, 0x2e5d, 0x158d, 0x0000,
+	    0x4224, 0x1c21, 0x18b5, 0x4238, 0x3258, 0x3156, 0x01a3, 0x1f6f,
+	    0x42dc, 0x111c, 0x4bb0, 0x0000, 0x2b10, 0x4a8d, 0x0ce4, 0x1a73,
+	    0x0401, 0x0c0f, 0x4857, 0x32e9, 0x137c, 0x2851, 0x1861, 0x2442,
+	    0x0d9f, 0x0000, 0x4401, 0x09ff, 0x0000, 0x204d, 0x1186, 0x1dc8,
+	    0x0de5, 0x3d7b, 0x0000, 0x0000, 0x088a, 0x3c08, 0x0000, 0x0614,
+	    0x0000, 0x033e, 0x0b81, 0x0000, 0x0000, 0x113d, 0x2bd7, 0x40c9,
+	    0x170e, 0x0000, 0x0c6f, 0x4545, 0x052a, 0x1398, 0x0f68, 0x072d,
+	    0x354f, 0x064d, 0x1ea7, 0x0000, 0x215d, 0x0d26, 0x41a8, 0x0024,
+	    0x48d2, 0x0000, 0x1983, 0x0000, 0x37af, 0x38cf, 0x19ab, 0x2982,
+	    0x0000, 0x0000, 0x21a4, 0x3d2a, 0x0000, 0x2c4b, 0x11bc, 0x0000,
+	    0x4872, 0x4657, 0x2e21, 0x49f1, 0x0eb1, 0x489d, 0x0de8, 0x0b87,
+	    0x22fb, 0x3e8f, 0x3763, 0x0000, 0x27e5, 0x31e0, 0x20be, 0x29cc,
+	    0x1888, 0x3513, 0x0000, 0x23a3, 0x01f5, 0x4337, 0x1f06, 0x0000,
+	    0x23da, 0x195f, 0x49e7, 0x32cb, 0x0255, 0x17bc, 0x3986, 0x0e05,
+	    0x3ab2, 0x0645, 0x3bdd, 0x28c2, 0x46f2, 0x043b, 0x2d0e, 0x12b6,
+	    0x32c6, 0x1b90, 0x0f95, 0x23df, 0x4354, 0x0a60, 0x0000, 0x0000,
+	    0x4bd6, 0x0d9a, 0x0000, 0x0263, 0x0000, 0x4c18, 0x0000, 0x0ea2,
+	    0x2a64, 0x0289, 0x1b6c, 0x0000, 0x0000, 0x0000, 0x3c8e, 0x0999,
+	    0x0000, 0x2d79, 0x0000, 0x1d91, 0x1f53, 0x0000, 0x0912, 0x10d5,
+	    0x0429, 0x0000, 0x36f8, 0x075e, 0x3d52, 0x2fe4, 0x3ae9, 0x362f,
+	    0x057c, 0x1212, 0x1088, 0x2ca6, 0x4735, 0x355f, 0x0000, 0x2cb0,
+	    0x0975, 0x0000, 0x35ec, 0x3c7b, 0x2198, 0x27ae, 0x0000, 0x10d1,
+	    0x27dd, 0x23d1, 0x47c7, 0x0492, 0x4cf8, 0x0f00, 0x206b, 0x41fe,
+	    0x4228, 0x35ae, 0x3294, 0x0b45, 0x476e, 0x0973, 0x2ea8, 0x0000,
+	    0x230b, 0x4bf3, 0x0e2c, 0x43f2, 0x2efd, 0x06db, 0x0129, 0x1b69,
+	    0x0562, 0x3d86, 0x32b1, 0x4a26, 0x11e6, 0x0000, 0x0000, 0x434b,
+	    0x1a8c, 0x39f8, 0x4a2d, 0x32db, 0x26c1, 0x102f, 0x0337, 0x279a,
+	    0x00e3, 0x43ff, 0x21d1, 0x2113, 0x2db0, 0x2994, 0x07e6, 0x0296,
+	    0x1664, 0x4904, 0x4c87, 0x0e41, 0x4ca1, 0x3109, 0x2127, 0x21cf,
+	    0x0f15, 0x4bdb, 0x112d, 0x3075, 0x17be, 0x2b56, 0x0000, 0x49fa,
+	    0x1b7d, 0x4223, 0x0130, 0x31e0, 0x0000, 0x0000, 0x17d5, 0x33f5,
+	    0x398f, 0x0000, 0x24f7, 0x0779, 0x3d0d, 0x1889, 0x03ad, 0x0000,
+	    0x3ff9, 0x19b0, 0x26c7, 0x2f91, 0x0000, 0x4b15, 0x2147, 0x033e,
+	    0x1f9b, 0x09b7, 0x0000, 0x1039, 0x0000, 0x0000, 0x1df1, 0x1a92,
+	    0x4303, 0x0719, 0x0000, 0x11f2, 0x03b1, 0x0423, 0x3b40, 0x23ab,
+	    0x2909, 0x4dbe, 0x0000, 0x4bf8, 0x0000, 0x4b25, 0x42d0, 0x226f,
+	    0x1fa3, 0x37b2, 0x0cc6, 0x3b11, 0x16c2, 0x2a2f, 0x00f8, 0x1979,
+	    0x12f7, 0x0000, 0x20ca, 0x04ef, 0x0333, 0x1bd4, 0x22fc, 0x0d51,
+	    0x030e, 0x12e2, 0x0000, 0x0c9f, 0x2a3a, 0x0c0d, 0x0766, 0x1bf3,
+	    0x0070, 0x21bc, 0x0000, 0x0bf9, 0x2c10, 0x0cd0, 0x0336, 0x05ce,
+	    0x0000, 0x2ac9, 0x0000, 0x42a1, 0x4a0a, 0x043d, 0x2b2c, 0x4127,
+	    0x3cda, 0x390e, 0x33e6, 0x22be, 0x009d, 0x32b3, 0x19b1, 0x16bf,
+	    0x1003, 0x338d, 0x4dcf, 0x1564, 0x4b31, 0x2c63, 0x466d, 0x13d2,
+	    0x0000, 0x0000, 0x0576, 0x0fc2, 0x10c1, 0x42db, 0x205b, 0x0000,
+	    0x0000, 0x44d4, 0x0429, 0x0000, 0x2d11, 0x28ed, 0x1d78, 0x25a2,
+	    0x1c41, 0x0000, 0x02a9, 0x0f75, 0x0e57, 0x0000, 0x3092, 0x029c,
+	    0x1b29, 0x1fcf, 0x0ece, 0x322e, 0x2da6, 0x0000, 0x08db, 0x279b,
+	    0x08ab, 0x362a, 0x1c67, 0x0db9, 0x0000, 0x27c4, 0x417b, 0x1365,
+	    0x23be, 0x14d0, 0x3291, 0x04d1, 0x25eb, 0x08cf, 0x24f2, 0x3f66,
+	    0x0000, 0x04d6, 0x0704, 0x0000, 0x2983, 0x0000, 0x2d41, 0x148d,
+	    0x0408, 0x413f, 0x2ffd, 0x3703, 0x0162, 0x2383, 0x4c44, 0x0000,
+	    0x096f, 0x3f1a, 0x1d51, 0x0000, 0x3b0b, 0x0000, 0x0000, 0x0000,
+	    0x21a3, 0x4154, 0x0f21, 0x03db, 0x0000, 0x14f8, 0x0826, 0x0000,
+	    0x016b, 0x1bb6, 0x142f, 0x1562, 0x24fa, 0x39a2, 0x3c27, 0x179d,
+	    0x4369, 0x022c, 0x01fa, 0x0045, 0x3057, 0x29bb, 0x4e0d, 0x2914,
+	    0x43fd, 0x13fb, 0x03b2, 0x1a0f, 0x0ec5, 0x0000, 0x3ed2, 0x0a83,
+	    0x1414, 0x0000, 0x415b, 0x0000, 0x2c43, 0x178e, 0x2be9, 0x34e6,
+	    0x31bd, 0x18a6, 0x002a, 0x0000, 0x0000, 0x378d, 0x48a5, 0x4c1f,
+	    0x0000, 0x30ca, 0x0000, 0x0000, 0x116f, 0x16b8, 0x2df6, 0x03c2,
+	    0x0e57, 0x1fe7, 0x153d, 0x0000, 0x04f7, 0x3b22, 0x0000, 0x21d3,
+	    0x0000, 0x232c, 0x278e, 0x17d2, 0x0000, 0x05a7, 0x3346, 0x1667,
+	    0x0000, 0x2b60, 0x209e, 0x0000, 0x0000, 0x49ff, 0x2f26, 0x2720,
+	    0x3725, 0x076d, 0x0352, 0x1fee, 0x1168, 0x35b3, 0x0311, 0x0000,
+	    0x023f, 0x0000, 0x1175, 0x4c88, 0x10de, 0x335d, 0x38f7, 0x1731,
+	    0x0000, 0x3915, 0x0612, 0x4a35, 0x1c95, 0x0000, 0x3407, 0x0000,
+	    0x4329, 0x434e, 0x4997, 0x2107, 0x070c, 0x0861, 0x240c, 0x1147,
+	    0x1b50, 0x0000, 0x3c8f, 0x14b3, 0x22bb, 0x0000, 0x3955, 0x2bfa,
+	    0x08db, 0x4c4d, 0x1cb6, 0x0164, 0x31d9, 0x26e8, 0x0000, 0x0000,
+	    0x20eb, 0x4349, 0x2c46, 0x236f, 0x2da8, 0x012d, 0x0276, 0x07db,
+	    0x3054, 0x0d24, 0x42bc, 0x23a7, 0x261c, 0x39b1, 0x02c9, 0x37b9,
+	    0x0000, 0x1f1b, 0x3d4c, 0x2a71, 0x01ad, 0x25c1, 0x321c, 0x0000,
+	    0x4b8b, 0x23fa, 0x0000, 0x2da0, 0x03c7, 0x0000, 0x2572, 0x32c7,
+	    0x4273, 0x18ef, 0x0000, 0x0000, 0x1de1, 0x2549, 0x166a, 0x38a5,
+	    0x2a96, 0x0000, 0x3289, 0x44f2, 0x1244, 0x3fd0, 0x116e, 0x0268,
+	    0x252d, 0x0000, 0x47ba, 0x4888, 0x0000, 0x3546, 0x4866, 0x007c,
+	    0x12b7, 0x21eb, 0x0000, 0x0000, 0x1d21, 0x4c3d, 0x155d, 0x0000,
+	    0x00e6, 0x4197, 0x0000, 0x36f6, 0x31d5, 0x0000, 0x20e5, 0x29fa,
+	    0x498d, 0x0000, 0x2556, 0x3459, 0x4a4b, 0x302c, 0x1df5, 0x05cb,
+	    0x0000, 0x0000, 0x0000, 0x1047, 0x12a7, 0x34e4, 0x3f65, 0x4aeb,
+	    0x29e7, 0x2af9, 0x432b, 0x351b, 0x0000, 0x448c, 0x045f, 0x1631,
+	    0x27be, 0x0000, 0x0000, 0x2f48, 0x089f, 0x496f, 0x1d3f, 0x4d51,
+	    0x0000, 0x2089, 0x2857, 0x0000, 0x2933, 0x21fe, 0x40b1, 0x4594,
+	    0x4b21, 0x486b, 0x3461, 0x0000, 0x0000, 0x0000, 0x1328, 0x3739,
+	    0x1831, 0x11a3, 0x2015, 0x17b2, 0x333d, 0x3c1b, 0x0000, 0x0c7e,
+	    0x0637, 0x10ca, 0x02d6, 0x47db, 0x274a, 0x387e, 0x0f37, 0x0cdc,
+	    0x0a25, 0x4616, 0x0aaf, 0x115f, 0x0000, 0x1c0f, 0x03e8, 0x30cc,
+	    0x36a5, 0x0e76, 0x0000, 0x0000, 0x0c42, 0x0000, 0x1899, 0x0000,
+	    0x0000, 0x2a28, 0x0000, 0x3383, 0x4365, 0x0ad3, 0x207f, 0x20fb,
+	    0x122e, 0x0829, 0x0c72, 0x35a1, 0x2032, 0x26c8, 0x2cdf, 0x002c,
+	    0x4c1c, 0x0000, 0x1dd4, 0x3c28, 0x0000, 0x2f61, 0x359a, 0x1f93,
+	    0x3370, 0x1cf1, 0x215a, 0x1bf3, 0x180f, 0x2160, 0x086a, 0x1702,
+	    0x2b75, 0x0102, 0x44cf, 0x3dba, 0x19be, 0x0497, 0x09c9, 0x4cbe,
+	    0x4d9d, 0x0000, 0x039d, 0x3d3c, 0x4157, 0x0bdc, 0x40da, 0x2166,
+	    0x27b7, 0x0000, 0x3544, 0x3ef5, 0x2857, 0x275e, 0x3a6c, 0x2073,
+	    0x4010, 0x0000, 0x04cf, 0x0000, 0x4d45, 0x2af2, 0x3814, 0x4e0e,
+	    0x4215, 0x0000, 0x0ccd, 0x2afe, 0x0409, 0x43b9, 0x06c5, 0x2a06,
+	    0x2ee2, 0x0000, 0x3a97, 0x3543, 0x3292, 0x3445, 0x0f0d, 0x0000,
+	    0x1e63, 0x335b, 0x399c, 0x12c2, 0x134f, 0x19c8, 0x2698, 0x3818,
+	    0x09b2, 0x047d, 0x0000, 0x0000, 0x0000, 0x051e, 0x2f2d, 0x10da,
+	    0x0955, 0x0000, 0x352d, 0x459b, 0x308d, 0x31e7, 0x2333, 0x0d6a,
+	    0x369e, 0x26e9, 0x4681, 0x2d0d, 0x2bae, 0x2e71, 0x4413, 0x1cf0,
+	    0x0768, 0x173d, 0x1e05, 0x4dd2, 0x0000, 0x20e2, 0x38cf, 0x46b8,
+	    0x35dc, 0x3924, 0x0000, 0x2f6b, 0x4aff, 0x3f5e, 0x1b4c, 0x191a,
+	    0x2b49, 0x48f2, 0x0000, 0x0dff, 0x4d44, 0x4d95, 0x39cc, 0x3974,
+	    0x2200, 0x06b5, 0x3728, 0x1720, 0x0000, 0x4bbe, 0x13fa, 0x48a9,
+	    0x0000, 0x27ff, 0x0044, 0x0151, 0x2ea5, 0x07c9, 0x2479, 0x0000,
+	    0x4d06, 0x1147, 0x0b00, 0x0c31, 0x0b35, 0x4d97, 0x4b1b, 0x0000,
+	    0x44bd, 0x0000, 0x07f4, 0x3f99, 0x48e0, 0x038a, 0x4844, 0x37ac,
+	    0x42c8, 0x0000, 0x3433, 0x248a, 0x4ba7, 0x0000, 0x31f8, 0x27fe,
+	    0x025b, 0x0000, 0x1f97, 0x1493, 0x4419, 0x2d86, 0x0181, 0x2dee,
+	    0x013f, 0x0000, 0x21a9, 0x0740, 0x2727, 0x3174, 0x0000, 0x3217,
+	    0x0f12, 0x1e67, 0x004d, 0x40f7, 0x0000, 0x342e, 0x12f0, 0x0000,
+	    0x4672, 0x3888, 0x0000, 0x1f88, 0x1e07, 0x0000, 0x1caa, 0x418e,
+	    0x1790, 0x0ef6, 0x0000, 0x0000, 0x0000, 0x1d74, 0x2144, 0x4834,
+	    0x0000, 0x3fd2, 0x1e89, 0x2368, 0x1bd9, 0x38e4, 0x2df9, 0x1d9e,
+	    0x0000, 0x1ba0, 0x0000, 0x2036, 0x2ade, 0x1c85, 0x4c9f, 0x247d,
+	    0x4e0d, 0x055d, 0x161f, 0x0e5e, 0x48cf, 0x42bd, 0x0cf0, 0x4093,
+	    0x4027, 0x0000, 0x2b21, 0x04f6, 0x4961, 0x2d87, 0x0000, 0x0b3b,
+	    0x2707, 0x0000, 0x4198, 0x05cb, 0x21c6, 0x167f, 0x1bfa, 0x31b1,
+	    0x279d, 0x058b, 0x3f23, 0x475f, 0x159d, 0x08c2, 0x1fad, 0x2706,
+	    0x2655, 0x4738, 0x45ae, 0x0664, 0x34c3, 0x0311, 0x2ca5, 0x34ed,
+	    0x0000, 0x0000, 0x41bc, 0x33bf, 0x39f3, 0x3874, 0x0000, 0x4785,
+	    0x0a64, 0x3281, 0x16f2, 0x28df, 0x4c72, 0x19cd, 0x1bf9, 0x104a,
+	    0x1d2c, 0x132a, 0x3f14, 0x4115, 0x41a9, 0x4d94, 0x312a, 0x404f,
+	    0x0c2e, 0x2e76, 0x0a35, 0x33ec, 0x3991, 0x0297, 0x06eb, 0x4dcc,
+	    0x0000, 0x07c6, 0x0aaa, 0x3edc, 0x00b5, 0x3af8, 0x0956, 0x20a5,
+	    0x0b97, 0x4809, 0x4b08, 0x4c49, 0x0000, 0x3c6c, 0x0000, 0x4602,
+	    0x489d, 0x0666, 0x1f7c, 0x12f1, 0x4190, 0x0000, 0x1067, 0x103b,
+	    0x3bc9, 0x23cf, 0x3a5e, 0x1e0d, 0x0e86, 0x1454, 0x0000, 0x2ea2,
+	    0x0f9a, 0x24f2, 0x3917, 0x1df8, 0x0108, 0x4349, 0x0d04, 0x3ca1,
+	    0x1d37, 0x196e, 0x2fe4, 0x226d, 0x19c5, 0x07f3, 0x375c, 0x0c36,
+	    0x2dcb, 0x0651, 0x2a65, 0x286e, 0x3cfb, 0x14d6, 0x0522, 0x0363,
+	    0x15e6, 0x254f, 0x0000, 0x063d, 0x0000, 0x0382, 0x1282, 0x2a32,
+	    0x0833, 0x0000, 0x4162, 0x2171, 0x029c, 0x0000, 0x0268, 0x099b,
+	    0x2813, 0x30e7, 0x0165, 0x0064, 0x2551, 0x0186, 0x0ddb, 0x451c,
+	    0x1cc9, 0x05c3, 0x0000, 0x3e01, 0x488b, 0x2a94, 0x14d9, 0x0000,
+	    0x1624, 0x0096, 0x0000, 0x27e3, 0x0000, 0x2929, 0x183a, 0x2335,
+	    0x1452, 0x336d, 0x35df, 0x0000, 0x1780, 0x0aa3, 0x0b34, 0x2105,
+	    0x464d, 0x0000, 0x0000, 0x0000, 0x3932, 0x08de, 0x1c16, 0x1106,
+	    0x1002, 0x45fe, 0x0000, 0x0000, 0x07e2, 0x46d2, 0x4d2c, 0x00f4,
+	    0x398e, 0x4752, 0x2624, 0x325d, 0x4af2, 0x129d, 0x0000, 0x17ed,
+	    0x2653, 0x43ce, 0x0000, 0x303c, 0x30f1, 0x05cb, 0x0000, 0x1e89,
+	    0x0000, 0x2ac3, 0x1b6f, 0x25d6, 0x097b, 0x3835, 0x0f0b, 0x2e99,
+	    0x4701, 0x4171, 0x0000, 0x3467, 0x04ac, 0x037a, 0x0000, 0x0000,
+	    0x0000, 0x1218, 0x03c0, 0x2bd2, 0x3d14, 0x2aba, 0x12c7, 0x296d,
+	    0x16d8, 0x0000, 0x14cd, 0x2862, 0x27e0, 0x35d4, 0x4d83, 0x4452,
+	    0x2cf4, 0x1055, 0x4b91, 0x0dca, 0x4a8f, 0x3326, 0x3432, 0x30f7,
+	    0x139b, 0x4915, 0x0000, 0x0a55, 0x20cc, 0x1905, 0x054e, 0x0000,
+	    0x414d, 0x2b74, 0x2eb2, 0x09d5, 0x2edb, 0x2ba4, 0x2813, 0x0000,
+	    0x3b62, 0x45b7, 0x23aa, 0x2acc, 0x27cb, 0x1267, 0x12e1, 0x4b89,
+	    0x3a12, 0x41b5, 0x2468, 0x1348, 0x2ae7, 0x0a94, 0x3c94, 0x0b7c,
+	    0x1cab, 0x2e1f, 0x3e15, 0x2602, 0x0000, 0x35d2, 0x4523, 0x369c,
+	    0x4723, 0x3065, 0x4517, 0x0000, 0x474f, 0x0cee, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0892, 0x35f3, 0x1de8, 0x0000, 0x186a, 0x222e,
+	    0x429d, 0x15b6, 0x0000, 0x3fcc, 0x0000, 0x0dc7, 0x2e8a, 0x0000,
+	    0x13b9, 0x1e03, 0x1e1b, 0x1504, 0x10de, 0x2b50, 0x246b, 0x2087,
+	    0x491a, 0x2f70, 0x08f5, 0x369f, 0x0d09, 0x0a8d, 0x0000, 0x2d71,
+	    0x074d, 0x0000, 0x292d, 0x22ac, 0x165d, 0x49d3, 0x4ce8, 0x2037,
+	    0x2372, 0x4bdf, 0x0dcf, 0x2bd0, 0x2360, 0x40b9, 0x319f, 0x3e5f,
+	    0x28ca, 0x3a5e, 0x2bd3, 0x0864, 0x1ba8, 0x0de9, 0x2506, 0x2f71,
+	    0x17ca, 0x4c31, 0x0b84, 0x38e5, 0x2149, 0x301b, 0x0000, 0x0b9c,
+	    0x1f16, 0x186d, 0x034d, 0x1ae4, 0x0000, 0x4be8, 0x2187, 0x0000,
+	    0x3f8f, 0x0000, 0x459b, 0x16b0, 0x4091, 0x292b, 0x03ca, 0x3076,
+	    0x0000, 0x2728, 0x2bb8, 0x0000, 0x32ad, 0x1dd4, 0x0e90, 0x416c,
+	    0x13c9, 0x1b8e, 0x077f, 0x43f0, 0x0000, 0x2e73, 0x0ef9, 0x13bc,
+	    0x3b97, 0x3bc4, 0x37e5, 0x0000, 0x0000, 0x0703, 0x2f93, 0x0036,
+	    0x3ab2, 0x155a, 0x0000, 0x0d0e, 0x2aeb, 0x4888, 0x36ea, 0x0000,
+	    0x002f, 0x3117, 0x4592, 0x0d85, 0x37e9, 0x1c04, 0x0000, 0x184c,
+	    0x1746, 0x1748, 0x2a61, 0x0000, 0x0000, 0x2021, 0x21ae, 0x3801,
+	    0x452f, 0x2816, 0x02cf, 0x31f4, 0x4873, 0x2a39, 0x1427, 0x4c24,
+	    0x0000, 0x451d, 0x2898, 0x24a6, 0x105e, 0x1c50, 0x4405, 0x0000,
+	    0x1b28, 0x17ce, 0x2ec5, 0x3438, 0x4de9, 0x2402, 0x3d92, 0x0964,
+	    0x490c, 0x110f, 0x0cc1, 0x0000, 0x2c53, 0x01f8, 0x0477, 0x1fbe,
+	    0x1f90, 0x1f21, 0x0dea, 0x0b1e, 0x2292, 0x0c0c, 0x343b, 0x45d6,
+	    0x11e9, 0x4924, 0x256e, 0x16a1, 0x0bf6, 0x402e, 0x2ae9, 0x0000,
+	    0x1a82, 0x412e, 0x0000, 0x0000, 0x0a2f, 0x0000, 0x0000, 0x016d,
+	    0x4dee, 0x0afa, 0x039e, 0x17a0, 0x2897, 0x136d, 0x03d7, 0x1dec,
+	    0x4148, 0x15c3, 0x073b, 0x23e3, 0x1ecf, 0x04e5, 0x0ce3, 0x1eec,
+	    0x0000, 0x2d2d, 0x37d6, 0x1486, 0x352d, 0x06ab, 0x2ead, 0x2c7a,
+	    0x4c09, 0x4061, 0x12a0, 0x03a5, 0x0000, 0x1e2c, 0x0567, 0x0d78,
+	    0x193b, 0x480b, 0x22c6, 0x3378, 0x201e, 0x237e, 0x0857, 0x0000,
+	    0x0113, 0x30f1, 0x0377, 0x0b32, 0x441e, 0x2b06, 0x0000, 0x2b6f,
+	    0x29bb, 0x18de, 0x3ada, 0x2331, 0x37f9, 0x16d0, 0x4de7, 0x0210,
+	    0x2749, 0x128d, 0x248e, 0x289e, 0x339b, 0x21d8, 0x2e46, 0x0000,
+	    0x3dbd, 0x428a, 0x1ea6, 0x35fd, 0x0c89, 0x3b83, 0x4523, 0x4ca1,
+	    0x2e61, 0x2677, 0x3bec, 0x05aa, 0x0000, 0x2152, 0x02e6, 0x0000,
+	    0x0756, 0x3336, 0x2d56, 0x2d51, 0x2a90, 0x1c9c, 0x23f6, 0x2794,
+	    0x1970, 0x1fcc, 0x42e7, 0x26c9, 0x3b6f, 0x0094, 0x24fe, 0x104c,
+	    0x0c15, 0x1ffb, 0x0ce2, 0x4c8c, 0x4384, 0x0202, 0x1c99, 0x4a52,
+	    0x2cb8, 0x0000, 0x163b, 0x4776, 0x0000, 0x032d, 0x4a5d, 0x08cd,
+	    0x439c, 0x2ce3, 0x1c6e, 0x1591, 0x1af3, 0x1714, 0x0000, 0x03a9,
+	    0x02b7, 0x370f, 0x2f23, 0x3d31, 0x207e, 0x0000, 0x1263, 0x0ac7,
+	    0x0000, 0x1514, 0x0c10, 0x34f8, 0x198b, 0x0000, 0x3ec7, 0x0f79,
+	    0x440e, 0x2d29, 0x4afb, 0x0132, 0x1d84, 0x4b1d, 0x40da, 0x34ad,
+	    0x07ce, 0x0000, 0x391a, 0x205d, 0x1139, 0x21dd, 0x17ab, 0x397d,
+	    0x1b5c, 0x3538, 0x33aa, 0x421c, 0x2f70, 0x41ed, 0x0000, 0x3a2e,
+	    0x0000, 0x21f2, 0x2cca, 0x0000, 0x028b, 0x1d50, 0x0000, 0x39b6,
+	    0x4490, 0x3119, 0x44ba, 0x4d36, 0x2115, 0x2958, 0x2aec, 0x3f46,
+	    0x3075, 0x226f, 0x2d81, 0x0000, 0x37e1, 0x41f3, 0x268a, 0x0000,
+	    0x0000, 0x3b1d, 0x3508, 0x38a8, 0x4d2a, 0x016d, 0x11c3, 0x41f5,
+	    0x0000, 0x1430, 0x4db8, 0x1cbd, 0x0000, 0x1d4c, 0x148d, 0x3401,
+	    0x4860, 0x3d03, 0x0000, 0x2532, 0x0000, 0x13d6, 0x361f, 0x0000,
+	    0x2c7a, 0x21b9, 0x2b46, 0x2916, 0x41f1, 0x0000, 0x2516, 0x369e,
+	    0x0000, 0x0000, 0x4d80, 0x3939, 0x4cef, 0x2076, 0x06f1, 0x273d,
+	    0x4ce0, 0x29d0, 0x20c8, 0x4e00, 0x0520, 0x38d8, 0x0000, 0x26d6,
+	    0x330a, 0x01cc, 0x1439, 0x4c8a, 0x3749, 0x1b61, 0x3ef1, 0x320f,
+	    0x076e, 0x0000, 0x210a, 0x0000, 0x46d2, 0x2c84, 0x1167, 0x3c7e,
+	    0x0000, 0x0000, 0x3f84, 0x0553, 0x491a, 0x449a, 0x0000, 0x4910,
+	    0x11f3, 0x46a5, 0x3423, 0x1a92, 0x2536, 0x1d7a, 0x4354, 0x4c2e,
+	    0x2a22, 0x2135, 0x3896, 0x1cd5, 0x0b4c, 0x4ada, 0x0d09, 0x0000,
+	    0x18f4, 0x49bf, 0x10cf, 0x0000, 0x0000, 0x0000, 0x2d14, 0x0000,
+	    0x2e5e, 0x4b13, 0x2a7b, 0x1f5b, 0x19e7, 0x450d, 0x4195, 0x0000,
+	    0x28b6, 0x49b5, 0x32b6, 0x00dc, 0x0000, 0x1623, 0x119f, 0x4765,
+	    0x29a2, 0x0000, 0x3a54, 0x0000, 0x0f77, 0x1594, 0x2721, 0x2865,
+	    0x0000, 0x1b06, 0x2906, 0x008a, 0x26cf, 0x3a25, 0x0000, 0x30ff,
+	    0x34bc, 0x0000, 0x0c3b, 0x0000, 0x29bf, 0x0000, 0x2e0f, 0x0000,
+	    0x01ba, 0x0c37, 0x098c, 0x3c56, 0x0000, 0x4cfe, 0x066c, 0x482d,
+	    0x4405, 0x073f, 0x1209, 0x1c96, 0x16a0, 0x0f2e, 0x0041, 0x18db,
+	    0x3a93, 0x3f7d, 0x1431, 0x0000, 0x3556, 0x1f08, 0x2e6c, 0x1a22,
+	    0x4ca7, 0x2964, 0x31a6, 0x0de2, 0x4b89, 0x2396, 0x0000, 0x0aa2,
+	    0x2596, 0x1d77, 0x44c9, 0x1b12, 0x4224, 0x2e53, 0x1b9f, 0x2f01,
+	    0x21a0, 0x47f8, 0x2af8, 0x3791, 0x02e5, 0x1e5a, 0x3752, 0x4595,
+	    0x133d, 0x0cd7, 0x2f4f, 0x0cbe, 0x39e0, 0x0000, 0x0000, 0x0000,
+	    0x2de1, 0x39fa, 0x349e, 0x4792, 0x34af, 0x04e0, 0x328d, 0x337a,
+	    0x0000, 0x1a86, 0x10b1, 0x165d, 0x3e6a, 0x28b8, 0x408f, 0x0095,
+	    0x25d6, 0x48b1, 0x11ce, 0x2524, 0x0f02, 0x2ada, 0x3716, 0x3ecc,
+	    0x1253, 0x4a56, 0x2ed6, 0x0d73, 0x4bcb, 0x27d4, 0x0000, 0x03b1,
+	    0x18ee, 0x2970, 0x44af, 0x3130, 0x0000, 0x0c8d, 0x2235, 0x2fb9,
+	    0x4988, 0x3b42, 0x1ffd, 0x46f4, 0x0112, 0x16dc, 0x0220, 0x4475,
+	    0x2682, 0x0000, 0x099f, 0x0000, 0x448a, 0x4ba0, 0x1a98, 0x0000,
+	    0x0000, 0x0efb, 0x40ae, 0x14ab, 0x1681, 0x0161, 0x09de, 0x1ba5,
+	    0x2c28, 0x20ec, 0x2cc1, 0x1d3b, 0x192b, 0x44cb, 0x08cb, 0x3e91,
+	    0x2f56, 0x3726, 0x25ad, 0x1589, 0x1e93, 0x38b1, 0x2c70, 0x3607,
+	    0x14f4, 0x0000, 0x4518, 0x1a70, 0x3f6d, 0x39d6, 0x0000, 0x0072,
+	    0x1779, 0x0000, 0x1178, 0x125f, 0x0242, 0x1d66, 0x0000, 0x102a,
+	    0x0000, 0x270b, 0x002d, 0x4806, 0x4094, 0x02dc, 0x0000, 0x269e,
+	    0x2ce8, 0x44a3, 0x0000, 0x4767, 0x0000, 0x45eb, 0x0371, 0x2fa1,
+	    0x0c30, 0x4983, 0x0c52, 0x1a54, 0x0b78, 0x06de, 0x458a, 0x1bcc,
+	    0x2876, 0x2d38, 0x3e20, 0x0000, 0x0fdc, 0x1379, 0x0cd7, 0x02ff,
+	    0x057f, 0x485f, 0x32d5, 0x0000, 0x4623, 0x0000, 0x2e1f, 0x0000,
+	    0x0000, 0x2c87, 0x4d69, 0x0093, 0x1162, 0x2454, 0x0000, 0x3889,
+	    0x39bb, 0x0255, 0x3201, 0x4245, 0x1383, 0x2b9d, 0x1c8d, 0x229e,
+	    0x1b5d, 0x37e9, 0x171a, 0x195a, 0x1eba, 0x0000, 0x3944, 0x0000,
+	    0x44da, 0x0000, 0x0250, 0x0000, 0x134b, 0x4c0d, 0x0e12, 0x1cf7,
+	    0x0000, 0x417c, 0x2a3e, 0x0fc3, 0x418e, 0x319a, 0x2751, 0x330c,
+	    0x2160, 0x3a59, 0x1d97, 0x0000, 0x1110, 0x2f94, 0x2404, 0x162d,
+	    0x0000, 0x054b, 0x0000, 0x3282, 0x0e82, 0x4265, 0x44e3, 0x0d3e,
+	    0x40b6, 0x0d64, 0x1095, 0x479b, 0x4571, 0x0000, 0x1011, 0x05c0,
+	    0x4d58, 0x0995, 0x2776, 0x0000, 0x13bc, 0x3446, 0x393c, 0x3d38,
+	    0x1ced, 0x0ad8, 0x1916, 0x31d7, 0x277c, 0x01ad, 0x290c, 0x0d92,
+	    0x08a8, 0x4809, 0x3ade, 0x281e, 0x25f1, 0x3025, 0x0470, 0x19ee,
+	    0x076b, 0x0000, 0x2b6c, 0x3351, 0x34ab, 0x0000, 0x13df, 0x1f8b,
+	    0x0cde, 0x0000, 0x0000, 0x0000, 0x4a8c, 0x1877, 0x260f, 0x03b8,
+	    0x0000, 0x3caf, 0x0000, 0x2978, 0x3ed7, 0x36e8, 0x3e3a, 0x27fc,
+	    0x1a3c, 0x1328, 0x08bd, 0x07c1, 0x1c3e, 0x4017, 0x41b4, 0x2c49,
+	    0x0000, 0x11fa, 0x0000, 0x4857, 0x25be, 0x36c6, 0x0cd6, 0x13c6,
+	    0x270b, 0x0000, 0x0866, 0x3041, 0x4146, 0x0a9b, 0x003f, 0x174f,
+	    0x302d, 0x0000, 0x4a7a, 0x0000, 0x358d, 0x2163, 0x3044, 0x0000,
+	    0x1bd0, 0x0774, 0x3bf6, 0x446f, 0x33c6, 0x0000, 0x4562, 0x0b2e,
+	    0x01d5, 0x4000, 0x0ab3, 0x3258, 0x4a59, 0x15b8, 0x49bf, 0x0e76,
+	    0x0291, 0x0000, 0x380c, 0x0000, 0x04f9, 0x166c, 0x0cfb, 0x0fb3,
+	    0x4145, 0x10ed, 0x17cf, 0x33c7, 0x155d, 0x0000, 0x46b7, 0x34da,
+	    0x0000, 0x3d87, 0x2c2d, 0x3d2a, 0x1926, 0x08f3, 0x4a3c, 0x3d7a,
+	    0x260c, 0x0000, 0x0000, 0x0000, 0x260d, 0x08d5, 0x1073, 0x3b51,
+	    0x4c66, 0x1174, 0x41e0, 0x4a50, 0x3031, 0x204c, 0x4d78, 0x3436,
+	    0x0a06, 0x1218, 0x2c48, 0x1a00, 0x0d2e, 0x0a77, 0x31b9, 0x070b,
+	    0x3ec8, 0x3d96, 0x0d7d, 0x0000, 0x2201, 0x1265, 0x2363, 0x48cd,
+	    0x41b6, 0x16c7, 0x1c5a, 0x0d4e, 0x41f5, 0x0658, 0x2008, 0x3a9b,
+	    0x0000, 0x0000, 0x3b13, 0x4730, 0x2a79, 0x040f, 0x0836, 0x2dcc,
+	    0x39b2, 0x1342, 0x4ca7, 0x0a40, 0x0000, 0x0ead, 0x0000, 0x0000,
+	    0x0000, 0x4ba4, 0x4514, 0x2816, 0x1930, 0x2681, 0x2b14, 0x214d,
+	    0x37fa, 0x425f, 0x20e8, 0x1a11, 0x4c68, 0x0338, 0x0000, 0x0c00,
+	    0x1765, 0x2a82, 0x2660, 0x0360, 0x2d1b, 0x0000, 0x0000, 0x0d8b,
+	    0x1c95, 0x49ee, 0x0327, 0x14bc, 0x3c9d, 0x0000, 0x1a0c, 0x0000,
+	    0x3b25, 0x36fe, 0x46ce, 0x1e5d, 0x06f5, 0x0c28, 0x425f, 0x0000,
+	    0x0488, 0x1339, 0x4d72, 0x276d, 0x480c, 0x0000, 0x48c1, 0x0000,
+	    0x083d, 0x0000, 0x1e04, 0x3d50, 0x1f86, 0x2616, 0x17bb, 0x36b2,
+	    0x0000, 0x2e3c, 0x2c91, 0x3aa2, 0x0787, 0x479b, 0x16b2, 0x0cb1,
+	    0x2bbc, 0x4bcd, 0x2742, 0x330b, 0x03f5, 0x4230, 0x06ac, 0x491d,
+	    0x45c9, 0x4603, 0x12a4, 0x224e, 0x0000, 0x2f3b, 0x0a31, 0x0022,
+	    0x07de, 0x2e77, 0x0b07, 0x0e45, 0x0000, 0x44f5, 0x4052, 0x119a,
+	    0x0287, 0x0000, 0x3998, 0x2082, 0x47da, 0x07ad, 0x44c3, 0x0000,
+	    0x430a, 0x1bb8, 0x0a13, 0x380e, 0x2a70, 0x2bc9, 0x1608, 0x18aa,
+	    0x0000, 0x0e78, 0x09dc, 0x3ae4, 0x2e61, 0x4b89, 0x1f18, 0x0000,
+	    0x0000, 0x1217, 0x0000, 0x405b, 0x0000, 0x43a5, 0x14bf, 0x0000,
+	    0x372d, 0x04fd, 0x278f, 0x1a38, 0x0000, 0x0204, 0x4568, 0x3d2c,
+	    0x1a1c, 0x0000, 0x04e4, 0x3ff0, 0x1d9e, 0x0000, 0x4ac1, 0x0000,
+	    0x2872, 0x2499, 0x44ce, 0x3499, 0x0000, 0x41ef, 0x26a0, 0x0b93,
+	    0x0000, 0x1c60, 0x4663, 0x0000, 0x3881, 0x1a56, 0x3e8f, 0x2ed8,
+	    0x0000, 0x0310, 0x0b8f, 0x3c04, 0x0000, 0x1c75, 0x18c7, 0x1071,
+	    0x0000, 0x4bee, 0x45d7, 0x4584, 0x0c0d, 0x0fb4, 0x49bb, 0x2c04,
+	    0x0e27, 0x25ea, 0x21a4, 0x42ab, 0x4814, 0x2c11, 0x26d0, 0x1519,
+	    0x0000, 0x37a0, 0x0000, 0x105a, 0x18c8, 0x2078, 0x37b5, 0x2cad,
+	    0x4255, 0x3443, 0x05fd, 0x42e0, 0x0000, 0x1bd8, 0x3a55, 0x0230,
+	    0x2f07, 0x0000, 0x450a, 0x26b4, 0x4e0e, 0x0a76, 0x2aff, 0x0ec7,
+	    0x2690, 0x1de5, 0x396e, 0x3426, 0x21d7, 0x12a2, 0x443b, 0x1ead,
+	    0x4b4d, 0x4380, 0x1f31, 0x213c, 0x0000, 0x0000, 0x1c98, 0x312d,
+	    0x3d35, 0x3a25, 0x016f, 0x1d52, 0x355f, 0x25da, 0x38b1, 0x343c,
+	    0x0953, 0x0816, 0x037b, 0x0f78, 0x256c, 0x1184, 0x1cad, 0x2d3c,
+	    0x0000, 0x0000, 0x4df8, 0x4de0, 0x4829, 0x0000, 0x228b, 0x144f,
+	    0x0000, 0x25e3, 0x09ff, 0x1ab8, 0x265a, 0x1121, 0x398d, 0x3ad6,
+	    0x0000, 0x0b0d, 0x36ee, 0x331e, 0x4d4d, 0x180b, 0x2e4a, 0x229b,
+	    0x0eed, 0x1896, 0x26f5, 0x0000, 0x0bbd, 0x2650, 0x0000, 0x34b1,
+	    0x3525, 0x0000, 0x3481, 0x2183, 0x403a, 0x3bb5, 0x4bde, 0x0000,
+	    0x103d, 0x486b, 0x29a2, 0x4a09, 0x288a, 0x0000, 0x3f69, 0x0e54,
+	    0x10cc, 0x0fe8, 0x2110, 0x292e, 0x40d4, 0x0000, 0x024d, 0x0000,
+	    0x33e5, 0x0000, 0x1f9e, 0x2228, 0x0f8e, 0x3551, 0x4297, 0x4bc0,
+	    0x4c2a, 0x0240, 0x0000, 0x2a89, 0x27eb, 0x3d7c, 0x00be, 0x00be,
+	    0x0000, 0x2166, 0x112c, 0x374f, 0x0000, 0x45f1, 0x47fb, 0x095a,
+	    0x0292, 0x1269, 0x07dc, 0x1dce, 0x1067, 0x0e8e, 0x0000, 0x0fcd,
+	    0x4c8b, 0x0000, 0x23f8, 0x1e53, 0x4648, 0x0000, 0x1eed, 0x4b4d,
+	    0x3aa5, 0x1441, 0x41bd, 0x3648, 0x29fd, 0x19f1, 0x02f1, 0x26da,
+	    0x4a7d, 0x0d3a, 0x1a8a, 0x045f, 0x0fc7, 0x1819, 0x28e4, 0x3bcd,
+	    0x0826, 0x0000, 0x0fca, 0x4d38, 0x00df, 0x48a6, 0x44b6, 0x00c2,
+	    0x0000, 0x1695, 0x0000, 0x0000, 0x0000, 0x3f6e, 0x18c8, 0x4a42,
+	    0x0000, 0x348f, 0x0f7c, 0x11f5, 0x2311, 0x211b, 0x0000, 0x3360,
+	    0x3324, 0x0000, 0x0f34, 0x290d, 0x3176, 0x35b4, 0x1a85, 0x0000,
+	    0x0000, 0x4a13, 0x03d9, 0x4788, 0x0000, 0x128a, 0x0000, 0x141b,
+	    0x0172, 0x115d, 0x1bb7, 0x17aa, 0x4741, 0x0000, 0x1905, 0x235e,
+	    0x4b0c, 0x22f4, 0x15b7, 0x2607, 0x0c0a, 0x3ec6, 0x271f, 0x0000,
+	    0x4565, 0x3d67, 0x00da, 0x2d57, 0x2081, 0x0000, 0x1502, 0x0000,
+	    0x1c10, 0x1dbb, 0x4a2d, 0x1942, 0x28e9, 0x46f8, 0x0000, 0x27fc,
+	    0x4868, 0x1684, 0x2724, 0x1616, 0x0631, 0x2eaa, 0x3201, 0x15e2,
+	    0x4b05, 0x21e2, 0x146c, 0x4d79, 0x1500, 0x0000, 0x0000, 0x4a4b,
+	    0x1301, 0x0000, 0x24be, 0x1097, 0x3830, 0x2293, 0x0d48, 0x0000,
+	    0x227d, 0x2fe6, 0x1e62, 0x1a48, 0x1a3d, 0x0000, 0x35cf, 0x1c04,
+	    0x3c54, 0x0d9e, 0x18bc, 0x38de, 0x1dd1, 0x0000, 0x183c, 0x1cd6,
+	    0x3099, 0x0c47, 0x0000, 0x34db, 0x07a3, 0x198b, 0x4683, 0x310a,
+	    0x4726, 0x316f, 0x0000, 0x4b36, 0x0d2d, 0x32fc, 0x0000, 0x35a1,
+	    0x4413, 0x1fa6, 0x071a, 0x395b, 0x0000, 0x2058, 0x4ac2, 0x3d7f,
+	    0x14fb, 0x1966, 0x0000, 0x37cc, 0x16a9, 0x33f2, 0x45a4, 0x0000,
+	    0x4c02, 0x433b, 0x458a, 0x1427, 0x38a4, 0x4bbd, 0x1aac, 0x03d2,
+	    0x0000, 0x3c48, 0x0eca, 0x4989, 0x0000, 0x021b, 0x477c, 0x07ee,
+	    0x3bb0, 0x368e, 0x4d27, 0x40e1, 0x4dc3, 0x12ab, 0x3afe, 0x26aa,
+	    0x3e47, 0x4504, 0x230f, 0x34e0, 0x060d, 0x3bd4, 0x2d1e, 0x312a,
+	    0x1dd9, 0x0000, 0x4826, 0x3923, 0x4a43, 0x3e07, 0x1136, 0x1da7,
+	    0x30c0, 0x0000, 0x2a23, 0x34df, 0x2bca, 0x1cf5, 0x1526, 0x3e7a,
+	    0x2d14, 0x3946, 0x0000, 0x0000, 0x2c65, 0x0000, 0x493e, 0x14e7,
+	    0x0183, 0x2c77, 0x469b, 0x405a, 0x31cf, 0x3d63, 0x0000, 0x01f0,
+	    0x0000, 0x26e2, 0x22d5, 0x3f49, 0x1d4e, 0x4298, 0x1a25, 0x0613,
+	    0x0000, 0x3a80, 0x0000, 0x1938, 0x1a0c, 0x19d0, 0x4def, 0x0326,
+	    0x3e16, 0x306d, 0x1e25, 0x0000, 0x11d9, 0x0000, 0x2281, 0x4500,
+	    0x489e, 0x0000, 0x0767, 0x1809, 0x4ccf, 0x39e0, 0x0000, 0x0000,
+	    0x3d54, 0x4ce1, 0x1ac7, 0x1785, 0x2fee, 0x27a2, 0x3388, 0x4211,
+	    0x25bf, 0x4084, 0x1bad, 0x0000, 0x4977, 0x1828, 0x2caf, 0x4953,
+	    0x322e, 0x3867, 0x27b5, 0x22e9, 0x250a, 0x36c1, 0x3371, 0x37ba,
+	    0x0000, 0x0cfb, 0x3261, 0x4a15, 0x1cde, 0x0000, 0x0000, 0x3a35,
+	    0x24f8, 0x1628, 0x01ff, 0x0000, 0x1c14, 0x3083, 0x0000, 0x38a6,
+	    0x36bf, 0x0848, 0x0000, 0x15c5, 0x402c, 0x119d, 0x0000, 0x2bc8,
+	    0x3361, 0x0000, 0x32f0, 0x3a80, 0x410a, 0x0000, 0x31b7, 0x2a3b,
+	    0x39cf, 0x245e, 0x12de, 0x1825, 0x27fe, 0x0000, 0x4cd1, 0x433f,
+	    0x0983, 0x3e32, 0x380c, 0x0e6f, 0x0637, 0x2331, 0x1af5, 0x4a61,
+	    0x4163, 0x0c4d, 0x219b, 0x1cef, 0x4b5e, 0x151b, 0x218c, 0x115f,
+	    0x0fce, 0x0000, 0x1479, 0x4d72, 0x4331, 0x178a, 0x1928, 0x1af2,
+	    0x329b, 0x0a1a, 0x2338, 0x00cd, 0x156b, 0x2b3a, 0x3a2d, 0x18af,
+	    0x3102, 0x0000, 0x223d, 0x326e, 0x03c8, 0x1270, 0x0e44, 0x4986,
+	    0x45c5, 0x1f2c, 0x329e, 0x1d30, 0x0000, 0x35d7, 0x1876, 0x0000,
+	    0x1e27, 0x3bd7, 0x273c, 0x0ff4, 0x0000, 0x16bf, 0x4a18, 0x1ecc,
+	    0x3bfb, 0x3ff3, 0x18ab, 0x1f4a, 0x0e17, 0x21b3, 0x0025, 0x1e5e,
+	    0x2ae2, 0x2703, 0x3cad, 0x0cf7, 0x0000, 0x0000, 0x2aa7, 0x0000,
+	    0x049a, 0x18d6, 0x1b98, 0x00e9, 0x25ae, 0x0000, 0x0000, 0x0639,
+	    0x1dcb, 0x0c07, 0x38db, 0x0000, 0x0dfd, 0x3298, 0x322f, 0x4c76,
+	    0x167c, 0x1996, 0x0000, 0x33cc, 0x0000, 0x0000, 0x2108, 0x4747,
+	    0x3921, 0x0000, 0x2f6a, 0x1598, 0x1a07, 0x11d3, 0x1e95, 0x4e15,
+	    0x39aa, 0x10cd, 0x3dce, 0x0000, 0x0000, 0x4198, 0x0000, 0x1cb5,
+	    0x0000, 0x0000, 0x4d2d, 0x1e60, 0x1997, 0x30bd, 0x44fe, 0x0e67,
+	    0x2b1e, 0x06e1, 0x157a, 0x0746, 0x27c8, 0x0088, 0x0000, 0x089b,
+	    0x10ab, 0x3208, 0x4c8a, 0x1efe, 0x3845, 0x3f2d, 0x023a, 0x1752,
+	    0x38ce, 0x10cf, 0x0d5b, 0x014c, 0x0784, 0x3b9f, 0x124e, 0x2332,
+	    0x08ab, 0x2876, 0x0000, 0x09cd, 0x0000, 0x492c, 0x4366, 0x3fc4,
+	    0x02db, 0x4125, 0x1fd1, 0x1369, 0x3c7a, 0x3ff0, 0x3931, 0x23e9,
+	    0x1fe2, 0x4be6, 0x267f, 0x0000, 0x3414, 0x0000, 0x09a9, 0x11e0,
+	    0x3a10, 0x4ba4, 0x0a39, 0x2e83, 0x4060, 0x1e00, 0x0d77, 0x0f2b,
+	    0x0000, 0x2c83, 0x496d, 0x1b60, 0x49c8, 0x24fc, 0x3fbe, 0x4713,
+	    0x06a7, 0x44fc, 0x3c4d, 0x4960, 0x0000, 0x27b1, 0x0000, 0x0000,
+	    0x2898, 0x19e5, 0x0000, 0x4c8d, 0x3e47, 0x3466, 0x2327, 0x006b,
+	    0x27d1, 0x0000, 0x2bc8, 0x2884, 0x102b, 0x480f, 0x1ebf, 0x3469,
+	    0x19a2, 0x1436, 0x0156, 0x1df4, 0x3258, 0x42ee, 0x403f, 0x35ea,
+	    0x4512, 0x32f7, 0x24ab, 0x11d7, 0x2aae, 0x36b8, 0x0000, 0x22fc,
+	    0x049f, 0x3174, 0x402c, 0x3f0c, 0x20b5, 0x0cc3, 0x08d9, 0x0d0c,
+	    0x14a2, 0x0e36, 0x3ffb, 0x0b2e, 0x1cec, 0x09fc, 0x0bcf, 0x4b2c,
+	    0x3ca6, 0x0bf1, 0x4641, 0x12ca, 0x03df, 0x2503, 0x0000, 0x0322,
+	    0x1ea5, 0x2187, 0x0000, 0x1c69, 0x18c3, 0x1cfb, 0x09e7, 0x2da0,
+	    0x3d40, 0x0000, 0x0000, 0x01f3, 0x1159, 0x0000, 0x2f94, 0x0000,
+	    0x200f, 0x25ff, 0x0d8f, 0x0f7c, 0x0000, 0x4266, 0x3364, 0x01c7,
+	    0x0000, 0x0409, 0x0000, 0x053b, 0x07e2, 0x0000, 0x0000, 0x2ed8,
+	    0x0000, 0x0196, 0x0000, 0x0ce2, 0x0aaf, 0x0ac2, 0x24fe, 0x405f,
+	    0x0000, 0x29fb, 0x0000, 0x35f4, 0x4556, 0x2143, 0x41ac, 0x0000,
+	    0x2df9, 0x13d7, 0x4964, 0x1e65, 0x0000, 0x29e7, 0x0000, 0x1a4f,
+	    0x1db4, 0x0000, 0x0000, 0x3dd7, 0x31ab, 0x4a00, 0x07b7, 0x0000,
+	    0x4a96, 0x0000, 0x28f4, 0x0000, 0x0676, 0x084b, 0x051f, 0x18b3,
+	    0x00a6, 0x0acd, 0x281c, 0x3d36, 0x0000, 0x42fa, 0x3f1f, 0x0000,
+	    0x49ac, 0x0b52, 0x0afc, 0x0e9f, 0x388e, 0x2260, 0x007d, 0x1c17,
+	    0x193c, 0x0000, 0x44ba, 0x1cf6, 0x26fb, 0x04c7, 0x05e2, 0x1015,
+	    0x3c3f, 0x3d88, 0x05fa, 0x3aab, 0x251b, 0x4280, 0x3eb2, 0x1a47,
+	    0x2a7b, 0x2b2e, 0x20d2, 0x0000, 0x3ce5, 0x4730, 0x4758, 0x0cf0,
+	    0x429e, 0x27d1, 0x0bee, 0x0ad2, 0x09a8, 0x0b11, 0x2a53, 0x4406,
+	    0x200d, 0x3895, 0x01cb, 0x3567, 0x2a8a, 0x1a26, 0x3d36, 0x151a,
+	    0x351e, 0x0df8, 0x311e, 0x1d51, 0x3d56, 0x4910, 0x42e5, 0x4471,
+	    0x1a44, 0x0161, 0x2113, 0x3968, 0x09f3, 0x0bfa, 0x2262, 0x35c8,
+	    0x15a2, 0x0000, 0x0552, 0x3037, 0x0fc6, 0x16a2, 0x22a9, 0x4362,
+	    0x1185, 0x2387, 0x2161, 0x0483, 0x4938, 0x4200, 0x1887, 0x3b06,
+	    0x0000, 0x4cdf, 0x0d7b, 0x29fb, 0x0000, 0x298a, 0x3235, 0x4cc7,
+	    0x02d6, 0x32ec, 0x0000, 0x370e, 0x4a67, 0x3c22, 0x2810, 0x0ed7,
+	    0x39c2, 0x1411, 0x1930, 0x3315, 0x27f5, 0x4d2d, 0x2b1d, 0x24de,
+	    0x15df, 0x0000, 0x4367, 0x0000, 0x38ae, 0x3e07, 0x1d58, 0x044e,
+	    0x2157, 0x0000, 0x42ab, 0x0553, 0x1987, 0x1581, 0x4097, 0x0000,
+	    0x2619, 0x0cff, 0x0000, 0x1fb9, 0x378a, 0x3328, 0x0000, 0x3e15,
+	    0x40ae, 0x0000, 0x21ae, 0x016e, 0x2c5a, 0x1df3, 0x0000, 0x0000,
+	    0x0705, 0x0000, 0x131f, 0x4c15, 0x339c, 0x40bc, 0x44c2, 0x1a18,
+	    0x390b, 0x026f, 0x1f3a, 0x4a87, 0x2c13, 0x4bec, 0x0000, 0x0000,
+	    0x1aea, 0x4e15, 0x2742, 0x0000, 0x3910, 0x1cec, 0x3989, 0x30ef,
+	    0x3fc0, 0x0be2, 0x1ddf, 0x3490, 0x10ee, 0x14a0, 0x17d6, 0x078f,
+	    0x1949, 0x4cf6, 0x0000, 0x07d0, 0x03e1, 0x0e73, 0x0ed1, 0x1e2d,
+	    0x3803, 0x0bf0, 0x4bc7, 0x1599, 0x0869, 0x0000, 0x0000, 0x256e,
+	    0x0541, 0x2dd1, 0x11f9, 0x0000, 0x34a9, 0x38a7, 0x0000, 0x0000,
+	    0x1443, 0x279a, 0x426f, 0x2c12, 0x3a69, 0x0000, 0x4a31, 0x0000,
+	    0x4d13, 0x3bd7, 0x480b, 0x0000, 0x0c7b, 0x0813, 0x19e8, 0x3821,
+	    0x1b64, 0x4811, 0x4a18, 0x0000, 0x31cc, 0x116f, 0x24b1, 0x2360,
+	    0x19e9, 0x3876, 0x0000, 0x460d, 0x1f65, 0x4725, 0x2981, 0x4d2e,
+	    0x2568, 0x0000, 0x32e6, 0x4451, 0x258b, 0x0e13, 0x081c, 0x1f29,
+	    0x31c3, 0x137d, 0x0125, 0x2eef, 0x0000, 0x3a0b, 0x1a10, 0x0000,
+	    0x270a, 0x3835, 0x2ab9, 0x10be, 0x0d40, 0x000a, 0x2786, 0x4af3,
+	    0x4790, 0x2cb1, 0x2da1, 0x1fee, 0x1c69, 0x322e, 0x491b, 0x4c37,
+	    0x23a8, 0x0000, 0x1103, 0x2dc6, 0x46ea, 0x297a, 0x3daf, 0x4bd0,
+	    0x3738, 0x0434, 0x2979, 0x4af2, 0x2e55, 0x337f, 0x16b0, 0x0000,
+	    0x0f83, 0x1584, 0x2e6b, 0x2f5f, 0x0ff3, 0x2d82, 0x0368, 0x4cd6,
+	    0x3f87, 0x3f42, 0x14f2, 0x0800, 0x2378, 0x143b, 0x0000, 0x4d12,
+	    0x0000, 0x045e, 0x19ff, 0x0000, 0x0000, 0x394c, 0x1315, 0x0f0a,
+	    0x334b, 0x0000, 0x08df, 0x2b2e, 0x0d49, 0x1bf2, 0x43bd, 0x08e4,
+	    0x15cb, 0x0000, 0x1561, 0x4177, 0x0415, 0x2488, 0x0763, 0x3304,
+	    0x2980, 0x4d72, 0x4519, 0x1393, 0x479d, 0x1177, 0x0000, 0x4876,
+	    0x0000, 0x4915, 0x0000, 0x3f2d, 0x35e6, 0x304e, 0x2bff, 0x3ac8,
+	    0x088f, 0x02c2, 0x3e39, 0x0956, 0x0000, 0x2df4, 0x174a, 0x0000,
+	    0x4cb8, 0x02fc, 0x3675, 0x3b84, 0x2f8d, 0x39d6, 0x0000, 0x4519,
+	    0x3ba4, 0x1cc2, 0x0146, 0x11b2, 0x13bf, 0x24b7, 0x4415, 0x00f0,
+	    0x1740, 0x0bac, 0x148e, 0x3a2a, 0x1fd5, 0x40b3, 0x1e9d, 0x463c,
+	    0x3101, 0x1687, 0x471a, 0x2f8a, 0x4d0c, 0x2e39, 0x21d7, 0x0c73,
+	    0x08c1, 0x0000, 0x1790, 0x243a, 0x242c, 0x07bb, 0x2598, 0x0000,
+	    0x2f89, 0x43e0, 0x31ca, 0x3cf1, 0x128b, 0x2da1, 0x2e36, 0x33bd,
+	    0x45b1, 0x2bb2, 0x0f24, 0x2176, 0x0000, 0x0000, 0x25bc, 0x4e10,
+	    0x2f9a, 0x44d9, 0x14db, 0x021e, 0x1a1f, 0x111e, 0x0675, 0x4a11,
+	    0x3050, 0x0000, 0x0838, 0x3839, 0x00e4, 0x0d45, 0x0000, 0x0000,
+	    0x1ea7, 0x3b76, 0x0236, 0x4321, 0x0000, 0x451d, 0x1950, 0x0000,
+	    0x0000, 0x0000, 0x49bc, 0x14af, 0x0bd3, 0x2fa9, 0x2f59, 0x1b8a,
+	    0x4691, 0x0000, 0x0000, 0x4151, 0x3743, 0x07d8, 0x4b07, 0x1354,
+	    0x18a1, 0x47ab, 0x1dcc, 0x0000, 0x1f36, 0x0000, 0x36a0, 0x187c,
+	    0x0000, 0x2395, 0x0000, 0x2e93, 0x0000, 0x0000, 0x0c7a, 0x32ff,
+	    0x0000, 0x1cb1, 0x45bd, 0x004c, 0x0000, 0x0000, 0x3a76, 0x270e,
+	    0x0000, 0x0000, 0x1547, 0x3aca, 0x4988, 0x3ea1, 0x3101, 0x1d8a,
+	    0x0000, 0x3bf1, 0x0000, 0x0000, 0x0d65, 0x11ac, 0x0000, 0x1ce9,
+	    0x0000, 0x0000, 0x0af3, 0x0000, 0x2b9d, 0x3d81, 0x2b55, 0x389c,
+	    0x42d2, 0x0000, 0x3470, 0x0000, 0x318a, 0x2e9b, 0x3708, 0x0c7d,
+	    0x3b71, 0x0000, 0x24eb, 0x0000, 0x2f63, 0x0000, 0x0000, 0x2739,
+	    0x4dc4, 0x0000, 0x0000, 0x2c2d, 0x0000, 0x0000, 0x442c, 0x0a1a,
+	    0x1c47, 0x0000, 0x1d59, 0x2d86, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0b33, 0x0000, 0x41df, 0x4a37, 0x090f, 0x025e, 0x1288,
+	    0x49ab, 0x23cc, 0x2015, 0x0e17, 0x4352, 0x1de4, 0x156e, 0x2623,
+	    0x2aa8, 0x1963, 0x4078, 0x4c0c, 0x070f, 0x1cc1, 0x0a1d, 0x0000,
+	    0x0000, 0x355c, 0x3482, 0x03ba, 0x0000, 0x2484, 0x344e, 0x0000,
+	    0x0f16, 0x40f8, 0x0000, 0x323b, 0x0000, 0x0000, 0x08dc, 0x3cd6,
+	    0x0000, 0x17b6, 0x1695, 0x1a8e, 0x0000, 0x4b14, 0x357c, 0x0000,
+	    0x4125, 0x18dc, 0x1cbf, 0x0000, 0x0000, 0x4e1f, 0x4bbd, 0x101b,
+	    0x2812, 0x342f, 0x1f4f, 0x4478, 0x383d, 0x0fcd, 0x1934, 0x174b,
+	    0x11ed, 0x437e, 0x324f, 0x0000, 0x0be9, 0x0000, 0x1b1b, 0x0000,
+	    0x4c08, 0x3f76, 0x4aab, 0x0000, 0x2bda, 0x2037, 0x0000, 0x4d4b,
+	    0x0000, 0x2601, 0x269c, 0x2c0e, 0x17cc, 0x0c80, 0x1063, 0x0000,
+	    0x1c26, 0x0d54, 0x1866, 0x28e0, 0x4d0d, 0x41cc, 0x47bc, 0x1a83,
+	    0x0000, 0x4dac, 0x480e, 0x1d1a, 0x0a24, 0x0000, 0x0a6f, 0x0972,
+	    0x03b2, 0x3566, 0x1037, 0x3c06, 0x1f8c, 0x4bc0, 0x180c, 0x4c89,
+	    0x0374, 0x2a8c, 0x2b9c, 0x4a2f, 0x0000, 0x2449, 0x07ad, 0x258e,
+	    0x24da, 0x0b5b, 0x02ca, 0x0000, 0x093f, 0x0000, 0x01d5, 0x29bd,
+	    0x3a9e, 0x0688, 0x059e, 0x3934, 0x2e80, 0x163c, 0x2b18, 0x1922,
+	    0x0000, 0x2369, 0x2993, 0x437f, 0x4a2b, 0x3c26, 0x31bb, 0x09d2,
+	    0x145e, 0x4ceb, 0x1432, 0x2767, 0x1fdb, 0x4a5a, 0x2875, 0x186c,
+	    0x0263, 0x04af, 0x092f, 0x13ca, 0x0dfd, 0x423e, 0x0000, 0x3e8b,
+	    0x30a5, 0x28f3, 0x2f55, 0x1d51, 0x44f6, 0x11e5, 0x02f2, 0x4ab0,
+	    0x0000, 0x0753, 0x0c9b, 0x0000, 0x4832, 0x1998, 0x1f32, 0x213e,
+	    0x203c, 0x1308, 0x0275, 0x434c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x45c9, 0x207d, 0x0000, 0x4564, 0x0000, 0x29fc, 0x2f92, 0x0000,
+	    0x0000, 0x0000, 0x47c6, 0x0e1e, 0x4600, 0x36d8, 0x34ab, 0x19fe,
+	    0x0ab6, 0x2a45, 0x4864, 0x4595, 0x4188, 0x1498, 0x45d7, 0x0000,
+	    0x0000, 0x0000, 0x2f7c, 0x0000, 0x3a0d, 0x178c, 0x0000, 0x07e1,
+	    0x0e64, 0x32e3, 0x0000, 0x4920, 0x151c, 0x0e31, 0x1f21, 0x205f,
+	    0x0159, 0x3964, 0x3de9, 0x155a, 0x1fe6, 0x0000, 0x0000, 0x3630,
+	    0x0a2d, 0x1626, 0x0dec, 0x0bfa, 0x2a68, 0x4985, 0x0000, 0x4c76,
+	    0x0477, 0x1487, 0x45fa, 0x0000, 0x43a7, 0x0000, 0x4d27, 0x156e,
+	    0x014a, 0x24e3, 0x2cdf, 0x0415, 0x43a8, 0x2aa3, 0x0f2b, 0x1fdf,
+	    0x2b8d, 0x4d19, 0x24b7, 0x044a, 0x08c1, 0x0000, 0x0000, 0x0000,
+	    0x1849, 0x2ea2, 0x2454, 0x0000, 0x0000, 0x485a, 0x10fb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x438c, 0x29e2, 0x0000, 0x0a66,
+	    0x1d83, 0x13ee, 0x0b8d, 0x2788, 0x494a, 0x0000, 0x0000, 0x181f,
+	    0x0000, 0x0000, 0x2173, 0x3c65, 0x197d, 0x1026, 0x1bb1, 0x360b,
+	    0x4cd7, 0x0000, 0x278d, 0x3dd9, 0x1692, 0x4959, 0x0000, 0x3ccf,
+	    0x4b6d, 0x07d0, 0x0718, 0x0000, 0x3d21, 0x3564, 0x1214, 0x162b,
+	    0x0000, 0x1d37, 0x32f0, 0x13c0, 0x4873, 0x1931, 0x2c56, 0x0718,
+	    0x0000, 0x34b9, 0x201e, 0x0372, 0x4a9d, 0x39a9, 0x341e, 0x478f,
+	    0x0d2a, 0x1e56, 0x453e, 0x3e3d, 0x1293, 0x03cc, 0x0000, 0x2a37,
+	    0x367b, 0x0000, 0x0000, 0x07d1, 0x132d, 0x48ee, 0x26a3, 0x0000,
+	    0x0000, 0x0000, 0x489e, 0x378a, 0x2807, 0x3374, 0x0000, 0x1b33,
+	    0x30be, 0x0e7c, 0x341e, 0x0170, 0x05a2, 0x0000, 0x2536, 0x0fe5,
+	    0x0000, 0x0000, 0x012a, 0x0384, 0x344f, 0x0000, 0x130e, 0x3821,
+	    0x00c5, 0x3ea1, 0x2bde, 0x2d38, 0x3b59, 0x00b7, 0x0000, 0x19a3,
+	    0x0000, 0x4562, 0x1ea0, 0x130c, 0x45b1, 0x0000, 0x0a91, 0x176d,
+	    0x1dc2, 0x07cc, 0x0cb6, 0x49af, 0x2724, 0x0a0f, 0x0000, 0x12ec,
+	    0x0000, 0x4427, 0x2e40, 0x0000, 0x0000, 0x3797, 0x2d53, 0x0000,
+	    0x03a6, 0x43fd, 0x20b9, 0x1f64, 0x3d26, 0x0b38, 0x1ee5, 0x37f1,
+	    0x0000, 0x1172, 0x4a60, 0x27ed, 0x0000, 0x1345, 0x100c, 0x458d,
+	    0x0000, 0x0000, 0x35b8, 0x370d, 0x2015, 0x0000, 0x25c9, 0x0000,
+	    0x03d1, 0x2894, 0x1b15, 0x0000, 0x2d7c, 0x25e1, 0x3bb6, 0x4216,
+	    0x408a, 0x270d, 0x2633, 0x0392, 0x4740, 0x4286, 0x0347, 0x0a0f,
+	    0x0000, 0x4198, 0x0000, 0x2496, 0x0000, 0x19a4, 0x1b6a, 0x1125,
+	    0x2404, 0x0702, 0x15f2, 0x1237, 0x0000, 0x0000, 0x3a4b, 0x0000,
+	    0x294c, 0x3594, 0x3cfe, 0x0000, 0x3b33, 0x3847, 0x07c1, 0x3866,
+	    0x405a, 0x1522, 0x2274, 0x0197, 0x29b2, 0x0000, 0x44f5, 0x0ac8,
+	    0x0000, 0x0000, 0x1a1e, 0x03f3, 0x0000, 0x1253, 0x175e, 0x0000,
+	    0x0ad5, 0x1eb6, 0x0000, 0x2b24, 0x438c, 0x0402, 0x2e3c, 0x36bb,
+	    0x39b1, 0x0152, 0x14f8, 0x4308, 0x1968, 0x4154, 0x1311, 0x3fde,
+	    0x1b1d, 0x0000, 0x023d, 0x3663, 0x0000, 0x32fd, 0x20a0, 0x1103,
+	    0x4e17, 0x3379, 0x0000, 0x1ae7, 0x0000, 0x0021, 0x169d, 0x3143,
+	    0x0000, 0x0000, 0x3b3f, 0x070c, 0x1253, 0x06a2, 0x3b4c, 0x45dd,
+	    0x0000, 0x4214, 0x4daa, 0x13c5, 0x1d09, 0x0bf8, 0x0000, 0x35a7,
+	    0x0df6, 0x0000, 0x0000, 0x1e18, 0x2b4c, 0x204c, 0x4b0a, 0x0000,
+	    0x227e, 0x242d, 0x19d6, 0x22cd, 0x0c29, 0x2930, 0x1ffd, 0x2780,
+	    0x0000, 0x419d, 0x0000, 0x3052, 0x3d21, 0x406e, 0x3cc4, 0x17a7,
+	    0x051c, 0x0251, 0x3850, 0x0578, 0x0f62, 0x0000, 0x26e2, 0x09da,
+	    0x3c89, 0x1fc4, 0x0a07, 0x0000, 0x126b, 0x28fa, 0x0970, 0x4812,
+	    0x1aed, 0x277a, 0x2f15, 0x0000, 0x1f25, 0x1f20, 0x33cd, 0x4231,
+	    0x261a, 0x0edf, 0x11a6, 0x40af, 0x3ef3, 0x4167, 0x2f8a, 0x38de,
+	    0x1362, 0x0000, 0x4a7c, 0x3ecc, 0x4679, 0x2d7c, 0x0900, 0x0000,
+	    0x2cdc, 0x0000, 0x377f, 0x46eb, 0x2ee6, 0x3c8a, 0x0211, 0x1570,
+	    0x400a, 0x0000, 0x1cf7, 0x0000, 0x1e19, 0x38a2, 0x05f7, 0x232c,
+	    0x4576, 0x0596, 0x0000, 0x388d, 0x19d2, 0x4d94, 0x0000, 0x4572,
+	    0x0000, 0x4974, 0x0000, 0x1e39, 0x2441, 0x2084, 0x0000, 0x0000,
+	    0x37f6, 0x136b, 0x3ddd, 0x38b0, 0x0000, 0x2b1f, 0x1411, 0x0000,
+	    0x02b3, 0x0000, 0x1e2a, 0x309b, 0x215b, 0x2549, 0x05ff, 0x3da7,
+	    0x0e14, 0x3972, 0x4d0b, 0x464e, 0x2935, 0x0000, 0x3be0, 0x4b00,
+	    0x36cc, 0x0000, 0x27db, 0x3f5e, 0x0000, 0x1868, 0x2818, 0x0000,
+	    0x0000, 0x37d1, 0x2a47, 0x46b2, 0x2efe, 0x002c, 0x1856, 0x2675,
+	    0x386b, 0x4426, 0x0000, 0x1c12, 0x1761, 0x0e86, 0x0000, 0x4cb8,
+	    0x1551, 0x209b, 0x0000, 0x4184, 0x0000, 0x22cd, 0x26e7, 0x22a6,
+	    0x28a7, 0x4b3a, 0x0000, 0x0b28, 0x051a, 0x1287, 0x3285, 0x0000,
+	    0x0be6, 0x286e, 0x3280, 0x231d, 0x2671, 0x1fc6, 0x19cc, 0x1474,
+	    0x3777, 0x0000, 0x3162, 0x0865, 0x0ce1, 0x2161, 0x2883, 0x0000,
+	    0x049e, 0x3287, 0x13dc, 0x0000, 0x4487, 0x0000, 0x0000, 0x029c,
+	    0x281b, 0x1b2a, 0x0000, 0x18ad, 0x2846, 0x2956, 0x436f, 0x40d3,
+	    0x475d, 0x2edc, 0x0000, 0x13f6, 0x3d9f, 0x1f44, 0x0000, 0x1da2,
+	    0x2f45, 0x0000, 0x03e5, 0x0f98, 0x3377, 0x2670, 0x3f97, 0x0000,
+	    0x0ce8, 0x0000, 0x1b03, 0x0109, 0x2317, 0x0000, 0x0000, 0x44ab,
+	    0x46c0, 0x0000, 0x0000, 0x2a1c, 0x4618, 0x0892, 0x0000, 0x4c1f,
+	    0x386f, 0x0000, 0x2005, 0x43d9, 0x0000, 0x3ce4, 0x0000, 0x0000,
+	    0x1d66, 0x4b05, 0x40ea, 0x06e5, 0x1787, 0x0000, 0x1462, 0x406d,
+	    0x0ab1, 0x4716, 0x0000, 0x31c6, 0x43e2, 0x43a9, 0x0541, 0x4e14,
+	    0x0000, 0x27ae, 0x2f77, 0x4290, 0x26cb, 0x21c1, 0x4c58, 0x25e9,
+	    0x1e74, 0x0358, 0x0896, 0x4c12, 0x1678, 0x411e, 0x0000, 0x0000,
+	    0x4ccd, 0x3242, 0x1a7e, 0x3de5, 0x3499, 0x146c, 0x3905, 0x2d0b,
+	    0x459d, 0x10b1, 0x0000, 0x0000, 0x0000, 0x041c, 0x2488, 0x4b50,
+	    0x2a28, 0x390f, 0x35b8, 0x2e29, 0x22a3, 0x0df4, 0x2f34, 0x1df9,
+	    0x0000, 0x3eb8, 0x3f52, 0x0000, 0x481b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x2063, 0x46b1, 0x497f, 0x19b9, 0x20e3, 0x102a, 0x23d0,
+	    0x0000, 0x0000, 0x0000, 0x15ee, 0x33c6, 0x2d02, 0x311b, 0x31ed,
+	    0x0337, 0x0d4d, 0x1834, 0x4360, 0x2f7e, 0x0000, 0x2830, 0x0427,
+	    0x2cfa, 0x465f, 0x30a7, 0x28a2, 0x4bc5, 0x0000, 0x28c5, 0x106b,
+	    0x3fc6, 0x17c7, 0x2f51, 0x1c8e, 0x19a9, 0x3b18, 0x12f4, 0x0000,
+	    0x0000, 0x0000, 0x4e00, 0x0000, 0x2c2e, 0x4d48, 0x0000, 0x06f9,
+	    0x3f1f, 0x0fb5, 0x0000, 0x41e1, 0x0000, 0x0000, 0x3ffb, 0x0000,
+	    0x03ac, 0x0e5b, 0x00b4, 0x0d6b, 0x2e89, 0x0a6a, 0x0000, 0x2f33,
+	    0x210a, 0x1f13, 0x3fa0, 0x29ad, 0x0000, 0x3070, 0x0bc1, 0x4a1f,
+	    0x3239, 0x21f9, 0x0000, 0x0a31, 0x0000, 0x2439, 0x388a, 0x17b9,
+	    0x321c, 0x3902, 0x0000, 0x1fde, 0x380f, 0x30cd, 0x3876, 0x1262,
+	    0x3842, 0x1fa7, 0x2235, 0x0000, 0x3a04, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1428, 0x050f, 0x33cb, 0x297f, 0x07cf, 0x24b0, 0x4b46,
+	    0x1cc6, 0x110f, 0x0000, 0x2fa1, 0x0000, 0x46b1, 0x4ded, 0x1e97,
+	    0x0000, 0x0000, 0x2465, 0x3a65, 0x0000, 0x1dbe, 0x4cc2, 0x0000,
+	    0x121f, 0x2f07, 0x1079, 0x2f04, 0x1d47, 0x2911, 0x4439, 0x308e,
+	    0x0f4f, 0x43e2, 0x241d, 0x2605, 0x3aa4, 0x29c0, 0x1fe1, 0x429e,
+	    0x0000, 0x1820, 0x0000, 0x4018, 0x38a8, 0x1278, 0x0000, 0x08e7,
+	    0x0000, 0x0ef6, 0x4419, 0x24c9, 0x206e, 0x0000, 0x356e, 0x2f17,
+	    0x0726, 0x39b0, 0x4ae7, 0x1e81, 0x1154, 0x0000, 0x287a, 0x3170,
+	    0x0d66, 0x1eba, 0x0000, 0x335f, 0x0c06, 0x3f90, 0x294c, 0x4434,
+	    0x055f, 0x085e, 0x0560, 0x0000, 0x3828, 0x4c66, 0x410b, 0x33dc,
+	    0x0745, 0x1207, 0x197b, 0x0000, 0x0000, 0x45e3, 0x2611, 0x0000,
+	    0x0e4d, 0x2e3b, 0x0000, 0x34ba, 0x4563, 0x29fe, 0x0000, 0x2dc5,
+	    0x367c, 0x3c96, 0x1100, 0x102c, 0x195a, 0x1fc1, 0x2b95, 0x22e7,
+	    0x0000, 0x0ee8, 0x2dd1, 0x0000, 0x1b83, 0x4c97, 0x3808, 0x1586,
+	    0x0000, 0x0ccd, 0x146b, 0x18d4, 0x0a6b, 0x3e8b, 0x0000, 0x0000,
+	    0x013b, 0x3c2f, 0x32bb, 0x0000, 0x0000, 0x0000, 0x21cb, 0x0000,
+	    0x01b5, 0x0000, 0x45d6, 0x3548, 0x2c2e, 0x3681, 0x0000, 0x07b2,
+	    0x2be3, 0x0000, 0x0000, 0x017c, 0x1a23, 0x1825, 0x0000, 0x0502,
+	    0x11a2, 0x0000, 0x0000, 0x4014, 0x2690, 0x4d0d, 0x1fce, 0x12f2,
+	    0x221f, 0x31b8, 0x0f58, 0x003e, 0x233c, 0x0d35, 0x0000, 0x4670,
+	    0x0f7f, 0x2afe, 0x1f70, 0x2b26, 0x243e, 0x4742, 0x4acb, 0x3824,
+	    0x45ff, 0x347a, 0x4323, 0x0000, 0x33d6, 0x0000, 0x436b, 0x2704,
+	    0x361c, 0x3f80, 0x2389, 0x0000, 0x420f, 0x0000, 0x0000, 0x4302,
+	    0x1489, 0x0000, 0x36da, 0x0000, 0x078f, 0x2c0e, 0x029b, 0x056e,
+	    0x0000, 0x0000, 0x0000, 0x19b5, 0x163d, 0x200c, 0x0000, 0x133c,
+	    0x04e9, 0x39a1, 0x2014, 0x439c, 0x0130, 0x1b4c, 0x2844, 0x0000,
+	    0x41ea, 0x4340, 0x4c3f, 0x4053, 0x2743, 0x1209, 0x24c4, 0x0000,
+	    0x0998, 0x4a09, 0x0000, 0x314c, 0x42a7, 0x0a49, 0x3796, 0x0000,
+	    0x298f, 0x0000, 0x46f3, 0x0000, 0x1c3e, 0x0a56, 0x0000, 0x0000,
+	    0x40fa, 0x0000, 0x2557, 0x02f2, 0x3ef1, 0x10de, 0x36fb, 0x0000,
+	    0x3a9f, 0x4b2f, 0x42ec, 0x2b2e, 0x1ed7, 0x2af2, 0x31b8, 0x0000,
+	    0x0885, 0x21af, 0x4532, 0x2f53, 0x2855, 0x0000, 0x0000, 0x18fc,
+	    0x184e, 0x0000, 0x117b, 0x4c54, 0x44dc, 0x0000, 0x322d, 0x4758,
+	    0x25a8, 0x0000, 0x0000, 0x003c, 0x28fd, 0x1088, 0x0a27, 0x3f28,
+	    0x0136, 0x0000, 0x176b, 0x15e4, 0x4be0, 0x0561, 0x375f, 0x1e5b,
+	    0x2848, 0x3520, 0x11e7, 0x0000, 0x0000, 0x0000, 0x3aaf, 0x2336,
+	    0x0000, 0x49fa, 0x1780, 0x1afb, 0x0f15, 0x2ba0, 0x2f43, 0x4bc6,
+	    0x0aca, 0x1573, 0x0000, 0x11a4, 0x4cb3, 0x0000, 0x051e, 0x0000,
+	    0x0000, 0x118a, 0x31ee, 0x04c1, 0x31ef, 0x2e9b, 0x1ca1, 0x0000,
+	    0x0000, 0x3c8b, 0x2c32, 0x1667, 0x00a6, 0x15b8, 0x3df1, 0x2618,
+	    0x33ec, 0x19c9, 0x3c63, 0x4507, 0x34d6, 0x4271, 0x0787, 0x0be3,
+	    0x412a, 0x07d5, 0x3d20, 0x0422, 0x3535, 0x3ad2, 0x4a64, 0x0000,
+	    0x0000, 0x0947, 0x4e10, 0x186a, 0x107a, 0x246f, 0x28db, 0x4625,
+	    0x0d59, 0x410c, 0x0987, 0x310b, 0x2829, 0x1608, 0x1c0a, 0x4225,
+	    0x2da2, 0x0a26, 0x0000, 0x0000, 0x2a46, 0x037d, 0x0000, 0x2cc0,
+	    0x0000, 0x2aae, 0x4813, 0x168b, 0x2dd2, 0x1c0d, 0x04b5, 0x4431,
+	    0x3f8f, 0x16f8, 0x46fe, 0x0000, 0x1a34, 0x310e, 0x0000, 0x2730,
+	    0x4aa9, 0x032f, 0x0000, 0x12fb, 0x22fd, 0x4ca3, 0x2697, 0x093c,
+	    0x2fae, 0x0000, 0x15af, 0x2374, 0x38d6, 0x1f68, 0x105f, 0x0000,
+	    0x0699, 0x2964, 0x1589, 0x44a5, 0x0000, 0x1473, 0x3d33, 0x4a86,
+	    0x10e1, 0x07b9, 0x4220, 0x2245, 0x1fe3, 0x0000, 0x3a85, 0x3898,
+	    0x1f77, 0x3530, 0x0000, 0x0000, 0x0000, 0x3b5a, 0x1085, 0x1ea9,
+	    0x2fc2, 0x0000, 0x34a4, 0x2390, 0x2e3a, 0x4108, 0x1df6, 0x39e5,
+	    0x05aa, 0x2fd8, 0x07a5, 0x02ee, 0x0f65, 0x4722, 0x04af, 0x293d,
+	    0x221f, 0x0000, 0x0000, 0x1381, 0x324b, 0x3303, 0x3c4b, 0x49dd,
+	    0x287a, 0x290c, 0x1215, 0x4621, 0x3d55, 0x141e, 0x1a48, 0x1d69,
+	    0x0000, 0x432a, 0x2f61, 0x0000, 0x4459, 0x4664, 0x0000, 0x204b,
+	    0x184b, 0x0000, 0x0000, 0x322a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x3d5f, 0x160d, 0x1d7d, 0x439e, 0x0e13, 0x0000, 0x1c59, 0x2452,
+	    0x0000, 0x1aa7, 0x1604, 0x33cd, 0x1b54, 0x0000, 0x0000, 0x0000,
+	    0x15f3, 0x0000, 0x2fc4, 0x1ea0, 0x4bee, 0x050a, 0x0000, 0x3e2d,
+	    0x00a2, 0x2235, 0x0000, 0x2fdb, 0x0898, 0x2e40, 0x0000, 0x4996,
+	    0x1ef6, 0x3fe3, 0x3794, 0x40bf, 0x0fbf, 0x2f95, 0x0000, 0x0bcd,
+	    0x304d, 0x4dea, 0x0000, 0x4762, 0x0000, 0x0000, 0x0238, 0x3169,
+	    0x263d, 0x0000, 0x0000, 0x4017, 0x0000, 0x0c9a, 0x0000, 0x24b9,
+	    0x0000, 0x2f14, 0x3197, 0x05f5, 0x0000, 0x0000, 0x08bf, 0x2c1a,
+	    0x44eb, 0x0395, 0x3f9d, 0x4c59, 0x1efe, 0x3006, 0x17c6, 0x4351,
+	    0x1147, 0x4546, 0x0000, 0x3de9, 0x0000, 0x2cfb, 0x07a7, 0x0000,
+	    0x299f, 0x0000, 0x0fc3, 0x0000, 0x39e5, 0x27d4, 0x0000, 0x4d94,
+	    0x0000, 0x0000, 0x1c0d, 0x249b, 0x2fca, 0x0848, 0x0000, 0x1d31,
+	    0x1c2a, 0x4b68, 0x0000, 0x2860, 0x0ba6, 0x0b16, 0x3d83, 0x4ce4,
+	    0x0000, 0x0000, 0x0213, 0x1bb2, 0x24b3, 0x091e, 0x0c0a, 0x2e3d,
+	    0x39f3, 0x3449, 0x351c, 0x221c, 0x26e0, 0x320e, 0x06dc, 0x3c88,
+	    0x0c9f, 0x14fa, 0x38a5, 0x3caa, 0x0446, 0x064a, 0x0000, 0x0924,
+	    0x2d24, 0x3a00, 0x0000, 0x3634, 0x1d23, 0x46af, 0x2dcb, 0x3591,
+	    0x1096, 0x3317, 0x4066, 0x0dbf, 0x0185, 0x1ccd, 0x41cc, 0x3706,
+	    0x2fb9, 0x1886, 0x0000, 0x1e45, 0x4736, 0x16c0, 0x3c9f, 0x404f,
+	    0x28e0, 0x3a85, 0x2fb6, 0x261a, 0x2845, 0x0000, 0x0077, 0x4005,
+	    0x0757, 0x2ed3, 0x2e54, 0x0000, 0x4b01, 0x0000, 0x48fe, 0x4487,
+	    0x1831, 0x032b, 0x45e4, 0x1df4, 0x2ab1, 0x09af, 0x4672, 0x4954,
+	    0x1757, 0x2d5e, 0x3f6f, 0x390e, 0x0000, 0x0144, 0x0000, 0x1854,
+	    0x0f06, 0x0000, 0x4c3c, 0x423b, 0x062c, 0x3fe7, 0x263d, 0x0b5b,
+	    0x3cef, 0x2c74, 0x269d, 0x1cd5, 0x4abd, 0x0000, 0x24c1, 0x115d,
+	    0x0000, 0x02dd, 0x0f1f, 0x0000, 0x0c0a, 0x0000, 0x0000, 0x4bf3,
+	    0x1b04, 0x2302, 0x0000, 0x3aed, 0x4ba7, 0x20ab, 0x1808, 0x0000,
+	    0x29a9, 0x0000, 0x0b8b, 0x0000, 0x25ab, 0x0000, 0x0a07, 0x1491,
+	    0x3b0a, 0x3c36, 0x0000, 0x1841, 0x1c7b, 0x0000, 0x1d96, 0x0000,
+	    0x3f59, 0x0000, 0x2f6f, 0x0d21, 0x4946, 0x0000, 0x1529, 0x359d,
+	    0x1353, 0x0000, 0x14c5, 0x0cbb, 0x11d7, 0x4ce2, 0x2577, 0x0000,
+	    0x078b, 0x0000, 0x408c, 0x216d, 0x17cd, 0x0000, 0x0000, 0x13df,
+	    0x3d78, 0x0a9d, 0x113e, 0x2b39, 0x2a9c, 0x0000, 0x0980, 0x0000,
+	    0x2e75, 0x2c1d, 0x0070, 0x34f0, 0x1ba0, 0x3e74, 0x1c1f, 0x0000,
+	    0x0178, 0x1e38, 0x05d0, 0x0b91, 0x0000, 0x4ad9, 0x32fa, 0x3468,
+	    0x2dff, 0x0000, 0x4330, 0x4743, 0x47bf, 0x04b3, 0x1277, 0x4791,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0c0b, 0x37ef, 0x2dd7, 0x17d4,
+	    0x45a6, 0x0000, 0x0000, 0x08ea, 0x1609, 0x0000, 0x4223, 0x3e03,
+	    0x222a, 0x446c, 0x4c0e, 0x0000, 0x0a77, 0x35df, 0x3b80, 0x2c5e,
+	    0x0000, 0x1d72, 0x272a, 0x0000, 0x0bb4, 0x3e3e, 0x1052, 0x0993,
+	    0x0000, 0x3e67, 0x0000, 0x4130, 0x4e04, 0x107c, 0x0000, 0x01d7,
+	    0x1d29, 0x1231, 0x47cf, 0x350d, 0x477c, 0x186e, 0x2a6b, 0x2286,
+	    0x0000, 0x0000, 0x0ff2, 0x0000, 0x0ca9, 0x3ba8, 0x2a8c, 0x47b5,
+	    0x1a60, 0x1d9b, 0x4741, 0x0000, 0x2e68, 0x0000, 0x49ae, 0x1c57,
+	    0x0000, 0x2e02, 0x0644, 0x0000, 0x494c, 0x4ac8, 0x0000, 0x1216,
+	    0x2335, 0x45f0, 0x4243, 0x2779, 0x477f, 0x0000, 0x01eb, 0x0000,
+	    0x35f2, 0x0000, 0x1466, 0x0000, 0x0853, 0x184f, 0x388e, 0x1d81,
+	    0x22bb, 0x0000, 0x34be, 0x4cd9, 0x1bf8, 0x471b, 0x3760, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d6a, 0x0ef4, 0x0000,
+	    0x4d4a, 0x4977, 0x0000, 0x0000, 0x4bac, 0x008a, 0x0000, 0x2c28,
+	    0x346c, 0x3682, 0x0000, 0x0000, 0x3d48, 0x082a, 0x0000, 0x093f,
+	    0x4714, 0x2c0a, 0x14ca, 0x2f89, 0x0000, 0x45f3, 0x0000, 0x2739,
+	    0x18dd, 0x3629, 0x2fa9, 0x24f9, 0x1830, 0x0000, 0x4d84, 0x33b4,
+	    0x0000, 0x2409, 0x1a9b, 0x0000, 0x22cd, 0x2411, 0x2cf5, 0x0000,
+	    0x4a06, 0x0000, 0x08a0, 0x2454, 0x3a32, 0x0000, 0x02c8, 0x44a8,
+	    0x1158, 0x0e27, 0x3001, 0x04c6, 0x0000, 0x0000, 0x0000, 0x1fa6,
+	    0x0558, 0x37e3, 0x0e18, 0x3d06, 0x358e, 0x2093, 0x09c4, 0x3b86,
+	    0x0000, 0x4725, 0x1001, 0x142e, 0x2e43, 0x0000, 0x1ad4, 0x0000,
+	    0x0db2, 0x28e6, 0x3456, 0x3607, 0x0000, 0x1e2d, 0x4c37, 0x31bd,
+	    0x1303, 0x0000, 0x1689, 0x0000, 0x3fa7, 0x0a86, 0x0d4c, 0x38c3,
+	    0x3e60, 0x3ac1, 0x029e, 0x239d, 0x30b3, 0x319e, 0x2b0f, 0x1bd3,
+	    0x0e0a, 0x1b08, 0x34ea, 0x0000, 0x1246, 0x1c90, 0x0000, 0x1678,
+	    0x0000, 0x1371, 0x1042, 0x0000, 0x306e, 0x0a95, 0x2a18, 0x3e5a,
+	    0x3837, 0x1929, 0x3e57, 0x3ee2, 0x2a7c, 0x19c3, 0x189f, 0x0fb1,
+	    0x1325, 0x003a, 0x2843, 0x0000, 0x0000, 0x0a54, 0x46a3, 0x3c86,
+	    0x1822, 0x17a6, 0x4def, 0x49c7, 0x0000, 0x1b24, 0x0000, 0x0160,
+	    0x09e2, 0x1c34, 0x223e, 0x17f2, 0x0444, 0x37fa, 0x178d, 0x0000,
+	    0x0000, 0x0000, 0x31e9, 0x0a78, 0x0000, 0x322e, 0x24bf, 0x0000,
+	    0x0000, 0x0639, 0x2284, 0x2eef, 0x1bf3, 0x3b97, 0x0376, 0x0000,
+	    0x0000, 0x0000, 0x4a54, 0x1b80, 0x0000, 0x0000, 0x0000, 0x1037,
+	    0x3b43, 0x0000, 0x1a20, 0x19f8, 0x0000, 0x208b, 0x340b, 0x0000,
+	    0x3707, 0x00df, 0x2847, 0x2efc, 0x0000, 0x0b7f, 0x0000, 0x2269,
+	    0x2946, 0x05e2, 0x354a, 0x156e, 0x2039, 0x0000, 0x0a2a, 0x0000,
+	    0x21a9, 0x329f, 0x4886, 0x0000, 0x3755, 0x3857, 0x0000, 0x4a01,
+	    0x1c5f, 0x1f7f, 0x2a43, 0x0612, 0x0000, 0x1219, 0x0000, 0x19cf,
+	    0x0000, 0x0000, 0x13c7, 0x2861, 0x0000, 0x154e, 0x0e97, 0x2cc6,
+	    0x3911, 0x360d, 0x0000, 0x15a4, 0x0000, 0x45d7, 0x0476, 0x3262,
+	    0x3d67, 0x1752, 0x43a9, 0x4d30, 0x1c99, 0x159d, 0x2bb9, 0x2958,
+	    0x25c7, 0x3be6, 0x1083, 0x1c59, 0x2a14, 0x1339, 0x12d9, 0x275a,
+	    0x0000, 0x0000, 0x4850, 0x35bd, 0x2779, 0x0000, 0x06ff, 0x3599,
+	    0x0000, 0x2ac7, 0x2512, 0x0000, 0x0000, 0x474d, 0x0000, 0x0000,
+	    0x3e51, 0x336d, 0x0ee7, 0x0d1e, 0x4c39, 0x0813, 0x19ff, 0x0000,
+	    0x3177, 0x2cc5, 0x214d, 0x2c4f, 0x0000, 0x0efc, 0x4d38, 0x3bde,
+	    0x2338, 0x0000, 0x4a7c, 0x2cf5, 0x0000, 0x27bd, 0x28ea, 0x1466,
+	    0x0000, 0x18b5, 0x01ca, 0x3d18, 0x0000, 0x4aec, 0x28e9, 0x2922,
+	    0x2408, 0x0000, 0x2024, 0x22bd, 0x3867, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1ac2, 0x2a1c, 0x0000, 0x0000, 0x0000, 0x342e, 0x202a,
+	    0x1af9, 0x4ba0, 0x3c0c, 0x0000, 0x0000, 0x0000, 0x0000, 0x073e,
+	    0x0000, 0x463b, 0x0000, 0x2ba7, 0x49e8, 0x2906, 0x0000, 0x1e3f,
+	    0x030d, 0x26bb, 0x4285, 0x4bea, 0x0000, 0x2c71, 0x0000, 0x2e1e,
+	    0x1e8b, 0x0000, 0x054e, 0x0000, 0x3ae3, 0x2745, 0x45c5, 0x27f6,
+	    0x2bcc, 0x0000, 0x1362, 0x1cfd, 0x3610, 0x0000, 0x0000, 0x4d13,
+	    0x143b, 0x2d11, 0x1c05, 0x0000, 0x0f9c, 0x48d8, 0x24bb, 0x1cd6,
+	    0x0000, 0x48c2, 0x3009, 0x0000, 0x2ac1, 0x46f5, 0x0000, 0x0000,
+	    0x391e, 0x0000, 0x01a1, 0x3a7c, 0x43c5, 0x3cf7, 0x0000, 0x47ea,
+	    0x0000, 0x0000, 0x37b9, 0x2197, 0x0725, 0x3e36, 0x11cd, 0x196f,
+	    0x3291, 0x0d61, 0x0000, 0x1464, 0x0000, 0x1a05, 0x0000, 0x12a8,
+	    0x3648, 0x0000, 0x212f, 0x1cfb, 0x0000, 0x0000, 0x47fd, 0x17b3,
+	    0x3b67, 0x4281, 0x0dd8, 0x35e8, 0x47ea, 0x0000, 0x246f, 0x4b77,
+	    0x0000, 0x3935, 0x3c16, 0x0000, 0x1bd1, 0x0000, 0x3dd6, 0x0000,
+	    0x0000, 0x2bbd, 0x0065, 0x3e26, 0x37fb, 0x0695, 0x3e00, 0x108d,
+	    0x2750, 0x2019, 0x27de, 0x3fe2, 0x3e96, 0x2f17, 0x0000, 0x4c83,
+	    0x12a1, 0x2649, 0x3022, 0x39db, 0x4b0e, 0x4b04, 0x2e15, 0x0000,
+	    0x0000, 0x0000, 0x21dc, 0x12bb, 0x39d3, 0x24fd, 0x0cc0, 0x3cc1,
+	    0x2a68, 0x291f, 0x4b7b, 0x3efa, 0x2a72, 0x295e, 0x4a10, 0x22d0,
+	    0x487e, 0x0c4f, 0x0000, 0x0000, 0x437a, 0x0e7b, 0x326c, 0x44b1,
+	    0x0000, 0x3bce, 0x1021, 0x0000, 0x36ad, 0x35db, 0x365e, 0x017f,
+	    0x1126, 0x2599, 0x3403, 0x0d1c, 0x0b0b, 0x0000, 0x0000, 0x3d3a,
+	    0x2993, 0x3629, 0x0000, 0x248e, 0x264d, 0x14bf, 0x2ad5, 0x0000,
+	    0x0000, 0x0000, 0x36b6, 0x21c7, 0x3cd4, 0x4d0b, 0x0000, 0x0000,
+	    0x0791, 0x0000, 0x0000, 0x0000, 0x4ae9, 0x4af8, 0x2515, 0x1d9a,
+	    0x0000, 0x197e, 0x0c19, 0x130c, 0x3fdf, 0x0118, 0x4877, 0x3372,
+	    0x2fdc, 0x28c2, 0x2e2e, 0x0000, 0x0000, 0x0000, 0x0683, 0x369e,
+	    0x0000, 0x0000, 0x1e31, 0x0526, 0x0000, 0x44c4, 0x2a24, 0x0493,
+	    0x0000, 0x3c0c, 0x0000, 0x0000, 0x3ab3, 0x0000, 0x3b13, 0x199f,
+	    0x1f5c, 0x087a, 0x2bdb, 0x0000, 0x4769, 0x3261, 0x4a39, 0x145a,
+	    0x0000, 0x14f9, 0x3e85, 0x226e, 0x0000, 0x46ba, 0x2c86, 0x0000,
+	    0x0dba, 0x3601, 0x0270, 0x0000, 0x0000, 0x0383, 0x15bd, 0x0136,
+	    0x0eb9, 0x00bf, 0x0000, 0x1f80, 0x1d16, 0x0000, 0x2369, 0x1ccb,
+	    0x0000, 0x2b6e, 0x0474, 0x0cfc, 0x4254, 0x0000, 0x325e, 0x0000,
+	    0x0000, 0x392c, 0x1a59, 0x324f, 0x0ed7, 0x3882, 0x0000, 0x0000,
+	    0x0000, 0x471f, 0x0000, 0x2f3b, 0x0000, 0x27dc, 0x1be3, 0x16fc,
+	    0x26e6, 0x0000, 0x4190, 0x0000, 0x017e, 0x43ac, 0x49bb, 0x0000,
+	    0x0000, 0x1b73, 0x2032, 0x2798, 0x4c5b, 0x0000, 0x1b19, 0x4325,
+	    0x2db6, 0x0aef, 0x34c2, 0x46e1, 0x4bbf, 0x1e55, 0x1c59, 0x2fe8,
+	    0x0c2a, 0x0000, 0x15ae, 0x1cfd, 0x0000, 0x0000, 0x0000, 0x4af7,
+	    0x396e, 0x34d8, 0x249d, 0x3d82, 0x18f1, 0x39d8, 0x4ca8, 0x4150,
+	    0x24e2, 0x05f6, 0x127e, 0x3a65, 0x0000, 0x4b22, 0x0000, 0x3520,
+	    0x3017, 0x2381, 0x2b28, 0x3e02, 0x0b71, 0x28f3, 0x0d2c, 0x0000,
+	    0x00aa, 0x0000, 0x4702, 0x1399, 0x20e0, 0x29c7, 0x32c9, 0x313d,
+	    0x0caa, 0x0000, 0x0835, 0x0000, 0x3fc6, 0x0a98, 0x08dc, 0x44c4,
+	    0x0fd1, 0x01c6, 0x19a8, 0x0262, 0x0b60, 0x2769, 0x055c, 0x0000,
+	    0x0000, 0x4438, 0x3961, 0x0000, 0x0220, 0x0000, 0x2821, 0x05a1,
+	    0x4aa8, 0x0000, 0x1a4e, 0x0000, 0x039f, 0x1a6f, 0x3fbb, 0x0000,
+	    0x2430, 0x3089, 0x4bcb, 0x0000, 0x3987, 0x0000, 0x0000, 0x3c8f,
+	    0x0000, 0x0000, 0x390c, 0x190a, 0x3c88, 0x0000, 0x3b4e, 0x34a5,
+	    0x2276, 0x1ee5, 0x0000, 0x0000, 0x0000, 0x157c, 0x4dd4, 0x2c52,
+	    0x230f, 0x2219, 0x0e9b, 0x22ae, 0x19cb, 0x0000, 0x0baf, 0x1168,
+	    0x3974, 0x3e15, 0x31a3, 0x1341, 0x4588, 0x35e5, 0x0000, 0x0000,
+	    0x352e, 0x34ae, 0x2648, 0x0000, 0x0683, 0x0000, 0x0000, 0x1200,
+	    0x0333, 0x12ff, 0x1bae, 0x2b11, 0x0000, 0x0c29, 0x329f, 0x28fb,
+	    0x319c, 0x37be, 0x0b9f, 0x0000, 0x2272, 0x0000, 0x1801, 0x2234,
+	    0x17ee, 0x307f, 0x14e1, 0x089c, 0x2eee, 0x1359, 0x1cfb, 0x3853,
+	    0x4292, 0x1678, 0x2cbf, 0x0000, 0x45aa, 0x0b79, 0x0f7b, 0x0000,
+	    0x1d9e, 0x0000, 0x4627, 0x0c56, 0x0480, 0x434e, 0x1740, 0x2465,
+	    0x362f, 0x0000, 0x0437, 0x26cc, 0x0bf2, 0x039f, 0x064e, 0x0840,
+	    0x480c, 0x0de9, 0x4aa6, 0x0000, 0x1c7c, 0x02e2, 0x31a4, 0x22b8,
+	    0x0000, 0x0000, 0x456f, 0x17c8, 0x43f5, 0x2a66, 0x0000, 0x0c35,
+	    0x23ad, 0x0000, 0x0d92, 0x41b5, 0x437b, 0x0000, 0x3f14, 0x0358,
+	    0x1301, 0x4025, 0x0485, 0x2003, 0x0000, 0x31a5, 0x3464, 0x3028,
+	    0x2976, 0x4411, 0x2ee0, 0x21ba, 0x442d, 0x0e5b, 0x0c6b, 0x18ac,
+	    0x46ce, 0x4089, 0x19a6, 0x27cd, 0x4577, 0x4a90, 0x0000, 0x4588,
+	    0x0000, 0x3d93, 0x3b7e, 0x4884, 0x2737, 0x4379, 0x1019, 0x2de7,
+	    0x2ac3, 0x0000, 0x4710, 0x21f7, 0x3065, 0x0bb2, 0x107d, 0x3574,
+	    0x0000, 0x0000, 0x0000, 0x20e7, 0x4b96, 0x14c4, 0x0000, 0x041e,
+	    0x07cd, 0x0000, 0x276e, 0x318e, 0x1d6f, 0x38d1, 0x0cc8, 0x4656,
+	    0x0000, 0x357e, 0x1ff9, 0x3301, 0x0000, 0x1fe1, 0x30f2, 0x0000,
+	    0x276f, 0x3416, 0x0000, 0x0000, 0x22bd, 0x0721, 0x4a49, 0x0000,
+	    0x33c7, 0x012f, 0x0000, 0x496e, 0x233e, 0x11a6, 0x0000, 0x0000,
+	    0x1da6, 0x0000, 0x368e, 0x0395, 0x0000, 0x1f41, 0x0000, 0x3f82,
+	    0x0000, 0x0000, 0x20e6, 0x0d3a, 0x0000, 0x21f0, 0x4841, 0x1fab,
+	    0x3261, 0x342c, 0x35d2, 0x350a, 0x21d2, 0x0000, 0x4b20, 0x2ecb,
+	    0x39dd, 0x4cf2, 0x0fe6, 0x173e, 0x4609, 0x0000, 0x448b, 0x0f1b,
+	    0x0000, 0x0000, 0x1798, 0x0d72, 0x0000, 0x3357, 0x3fe0, 0x49e0,
+	    0x4647, 0x0000, 0x24ca, 0x2e4d, 0x3806, 0x0000, 0x0000, 0x0000,
+	    0x4b9c, 0x3c1c, 0x0000, 0x06b2, 0x0000, 0x117b, 0x3323, 0x2b7f,
+	    0x3c63, 0x111c, 0x1793, 0x354a, 0x0008, 0x3f39, 0x2a20, 0x1633,
+	    0x0084, 0x0d88, 0x0000, 0x272f, 0x0000, 0x0000, 0x3dd5, 0x328e,
+	    0x3414, 0x0000, 0x0c5b, 0x0000, 0x2b8b, 0x28fe, 0x1024, 0x4846,
+	    0x0364, 0x0794, 0x178f, 0x0000, 0x309e, 0x341f, 0x2a5d, 0x4267,
+	    0x0000, 0x34e6, 0x0000, 0x0000, 0x130e, 0x1180, 0x46c9, 0x1a77,
+	    0x0b52, 0x0e0f, 0x074d, 0x16d4, 0x0a41, 0x1d73, 0x29e7, 0x1a65,
+	    0x32ec, 0x05f4, 0x0000, 0x095e, 0x0000, 0x4924, 0x0000, 0x39c0,
+	    0x0000, 0x2e89, 0x169c, 0x0e4b, 0x0000, 0x0000, 0x1eae, 0x0000,
+	    0x0000, 0x0000, 0x3e6e, 0x0000, 0x427b, 0x1837, 0x11c4, 0x308c,
+	    0x0000, 0x04ed, 0x24cc, 0x3383, 0x3da8, 0x05c3, 0x2ad2, 0x1e46,
+	    0x0bcc, 0x04ed, 0x0000, 0x401a, 0x2cf7, 0x0000, 0x0000, 0x0000,
+	    0x4c09, 0x487e, 0x2ffa, 0x0000, 0x15ea, 0x2b65, 0x2bb2, 0x0000,
+	    0x07be, 0x0000, 0x341d, 0x0e16, 0x2552, 0x30ff, 0x0000, 0x4527,
+	    0x47cc, 0x2043, 0x074d, 0x184c, 0x0000, 0x0966, 0x0529, 0x16ea,
+	    0x0f8f, 0x3e8a, 0x0000, 0x0000, 0x180a, 0x383d, 0x2eaa, 0x0fe4,
+	    0x4a7b, 0x27cb, 0x2b4b, 0x3ab3, 0x0000, 0x4dd0, 0x3c6a, 0x141f,
+	    0x16f5, 0x36b4, 0x35b4, 0x0000, 0x4b8f, 0x1896, 0x1ad0, 0x348c,
+	    0x1799, 0x1dc3, 0x11aa, 0x0000, 0x149d, 0x0203, 0x0000, 0x2d5c,
+	    0x4226, 0x2d2e, 0x3c43, 0x0000, 0x0000, 0x11b0, 0x0000, 0x0485,
+	    0x02f6, 0x09fa, 0x0000, 0x0000, 0x1bbf, 0x13d8, 0x48ee, 0x2eaa,
+	    0x213b, 0x0000, 0x2391, 0x0000, 0x1d78, 0x0248, 0x285c, 0x2b5a,
+	    0x0000, 0x3230, 0x27b9, 0x3188, 0x168c, 0x08ff, 0x0000, 0x26c4,
+	    0x12ab, 0x0000, 0x061d, 0x21af, 0x0000, 0x3ed4, 0x1201, 0x360e,
+	    0x0f11, 0x4072, 0x0000, 0x0000, 0x015a, 0x3c90, 0x3615, 0x0000,
+	    0x3e85, 0x0000, 0x22c4, 0x1fc8, 0x2585, 0x0000, 0x3e59, 0x3888,
+	    0x3dd6, 0x0000, 0x300b, 0x0000, 0x2615, 0x0000, 0x0b0f, 0x2f7e,
+	    0x4958, 0x1f2b, 0x4c2d, 0x2750, 0x04e0, 0x1d26, 0x042b, 0x2e5e,
+	    0x3b90, 0x14d4, 0x277f, 0x2c89, 0x0ab8, 0x395b, 0x3191, 0x3c12,
+	    0x40b7, 0x2229, 0x0000, 0x2631, 0x1ad7, 0x2aff, 0x3a4e, 0x0000,
+	    0x0000, 0x1a55, 0x010e, 0x251e, 0x398a, 0x4957, 0x2528, 0x1581,
+	    0x14cb, 0x4ba1, 0x3e9c, 0x45a1, 0x23ed, 0x0000, 0x0000, 0x0000,
+	    0x0193, 0x30c9, 0x0dcf, 0x0000, 0x43fd, 0x0000, 0x4855, 0x26df,
+	    0x0000, 0x0000, 0x0000, 0x4c1e, 0x472a, 0x49fd, 0x2a86, 0x2972,
+	    0x1a94, 0x4836, 0x230c, 0x16f3, 0x072f, 0x47f1, 0x240a, 0x0559,
+	    0x48d7, 0x0b6c, 0x3ea6, 0x45cd, 0x3aba, 0x417e, 0x42b4, 0x0000,
+	    0x0000, 0x4bda, 0x0842, 0x2457, 0x3949, 0x18b2, 0x11ac, 0x499e,
+	    0x3549, 0x22aa, 0x0b68, 0x031f, 0x3658, 0x0fc0, 0x237e, 0x0000,
+	    0x32e6, 0x008d, 0x3737, 0x0000, 0x0594, 0x2de2, 0x3799, 0x44be,
+	    0x40d3, 0x087b, 0x0000, 0x41a8, 0x2e87, 0x26bf, 0x1ddd, 0x2083,
+	    0x458c, 0x2dfb, 0x4c80, 0x35be, 0x070c, 0x15c4, 0x2716, 0x0173,
+	    0x175e, 0x38d2, 0x0ae8, 0x4a8f, 0x0000, 0x10a4, 0x0000, 0x2995,
+	    0x355d, 0x437a, 0x37a4, 0x19ea, 0x0000, 0x3ddc, 0x0000, 0x274f,
+	    0x14f5, 0x4b22, 0x3f83, 0x1b51, 0x08a8, 0x371e, 0x48e5, 0x0000,
+	    0x0584, 0x0ec9, 0x2132, 0x322f, 0x3cbc, 0x372f, 0x26e2, 0x3554,
+	    0x3af5, 0x0000, 0x0000, 0x2856, 0x0b51, 0x0000, 0x0000, 0x060e,
+	    0x02f7, 0x0000, 0x4baa, 0x11c8, 0x1297, 0x0000, 0x0000, 0x49c9,
+	    0x0138, 0x0000, 0x44ec, 0x2834, 0x0000, 0x12cc, 0x0000, 0x29a9,
+	    0x0000, 0x2b05, 0x25fa, 0x1024, 0x44ec, 0x0006, 0x2e92, 0x0bf1,
+	    0x0000, 0x1c49, 0x21eb, 0x0000, 0x2e73, 0x0000, 0x2dd7, 0x2623,
+	    0x20e0, 0x011d, 0x0000, 0x0000, 0x1f57, 0x0000, 0x0000, 0x00a1,
+	    0x4de5, 0x2b83, 0x459a, 0x1119, 0x1101, 0x1694, 0x2e05, 0x21e9,
+	    0x0000, 0x0db3, 0x34b7, 0x3ed3, 0x34d8, 0x0000, 0x25f1, 0x48dc,
+	    0x1f17, 0x4cfc, 0x182d, 0x45dd, 0x2c29, 0x3d03, 0x11bc, 0x0000,
+	    0x00ee, 0x1601, 0x396e, 0x3d4a, 0x44c0, 0x4a37, 0x4b0d, 0x02bc,
+	    0x0000, 0x4824, 0x0000, 0x1580, 0x1584, 0x3165, 0x0a64, 0x29fd,
+	    0x44e6, 0x312c, 0x1ebf, 0x3920, 0x3256, 0x26af, 0x37d0, 0x4b77,
+	    0x30a7, 0x0000, 0x42ee, 0x3fd1, 0x0000, 0x0107, 0x2f57, 0x0000,
+	    0x4b9a, 0x0897, 0x0000, 0x0000, 0x0300, 0x4c03, 0x1bca, 0x42bb,
+	    0x3f05, 0x0000, 0x4654, 0x0000, 0x31f6, 0x078e, 0x1b2f, 0x19a8,
+	    0x43ec, 0x256c, 0x0e1b, 0x1fdf, 0x1b7b, 0x30fe, 0x3475, 0x3de6,
+	    0x1c89, 0x0000, 0x0cab, 0x0000, 0x208f, 0x3f2f, 0x29d9, 0x0000,
+	    0x3e0d, 0x0000, 0x0000, 0x2220, 0x4a26, 0x0000, 0x020c, 0x1b00,
+	    0x1432, 0x096a, 0x0b09, 0x0000, 0x0e85, 0x0000, 0x0000, 0x3768,
+	    0x02c0, 0x0000, 0x28be, 0x3bdc, 0x2aa2, 0x2967, 0x1798, 0x0135,
+	    0x0000, 0x3291, 0x0000, 0x1a2f, 0x44b1, 0x134e, 0x0f60, 0x0000,
+	    0x265f, 0x10bd, 0x3f37, 0x44ed, 0x2317, 0x0000, 0x2b76, 0x05bf,
+	    0x48fc, 0x4bd4, 0x1396, 0x27cb, 0x0000, 0x0000, 0x46df, 0x0000,
+	    0x221f, 0x11b6, 0x0000, 0x1fd5, 0x2696, 0x2aa2, 0x0000, 0x0000,
+	    0x1a26, 0x04d7, 0x0000, 0x0b3b, 0x3384, 0x0000, 0x43b9, 0x0832,
+	    0x0000, 0x0000, 0x25ee, 0x07c1, 0x0000, 0x3450, 0x0000, 0x0000,
+	    0x0298, 0x08c9, 0x1ba1, 0x0000, 0x0600, 0x2fe8, 0x2e38, 0x0000,
+	    0x25f1, 0x0000, 0x269b, 0x0000, 0x0000, 0x2c03, 0x30b3, 0x33d6,
+	    0x087d, 0x0814, 0x0000, 0x2064, 0x200c, 0x4716, 0x34bc, 0x26aa,
+	    0x456c, 0x4a9d, 0x0000, 0x0f78, 0x0000, 0x2c68, 0x0000, 0x364e,
+	    0x017b, 0x1a32, 0x16e2, 0x0d1a, 0x3cdb, 0x0312, 0x1275, 0x4bb7,
+	    0x2eb6, 0x2671, 0x1a20, 0x1645, 0x3718, 0x2f70, 0x2fd0, 0x4132,
+	    0x0000, 0x1555, 0x4db0, 0x0000, 0x47a8, 0x3040, 0x0753, 0x4d3c,
+	    0x1bf0, 0x3edb, 0x1690, 0x3611, 0x2e84, 0x3511, 0x1a5b, 0x18ad,
+	    0x0091, 0x0000, 0x2e91, 0x0000, 0x0000, 0x03c0, 0x3752, 0x1e74,
+	    0x0000, 0x183b, 0x21dd, 0x0000, 0x21e5, 0x03bf, 0x3aac, 0x0ba5,
+	    0x0e1f, 0x209d, 0x3d27, 0x45b3, 0x1025, 0x0000, 0x457c, 0x2215,
+	    0x3bdb, 0x0000, 0x1dbf, 0x0155, 0x1645, 0x3ae9, 0x3970, 0x3fb4,
+	    0x03d6, 0x0000, 0x3ec3, 0x1c63, 0x0000, 0x0000, 0x286b, 0x2c34,
+	    0x0000, 0x0000, 0x0000, 0x02a7, 0x0000, 0x0000, 0x2dfb, 0x0000,
+	    0x01e8, 0x1ce6, 0x1cbb, 0x4a74, 0x0000, 0x1af7, 0x28de, 0x4790,
+	    0x1aac, 0x431e, 0x0000, 0x2363, 0x02c9, 0x156f, 0x0b5a, 0x2cd2,
+	    0x0000, 0x2f25, 0x0000, 0x2c94, 0x2d00, 0x0000, 0x2e0b, 0x40ed,
+	    0x3fec, 0x0000, 0x4162, 0x1706, 0x0b3e, 0x252b, 0x4647, 0x06e3,
+	    0x1c26, 0x1810, 0x2a1a, 0x127f, 0x3160, 0x462a, 0x0000, 0x165c,
+	    0x4b8e, 0x0000, 0x0000, 0x0000, 0x34a2, 0x0000, 0x1a51, 0x3d8e,
+	    0x21b3, 0x36bc, 0x0184, 0x1045, 0x33ac, 0x4cf7, 0x3429, 0x15bf,
+	    0x3938, 0x2212, 0x0000, 0x2089, 0x0000, 0x0c96, 0x0000, 0x44cc,
+	    0x08c3, 0x3142, 0x2313, 0x4b80, 0x35e3, 0x29ff, 0x0000, 0x3aab,
+	    0x0000, 0x1476, 0x12b6, 0x0000, 0x3591, 0x0000, 0x0000, 0x42a6,
+	    0x0954, 0x41ef, 0x1e7c, 0x3205, 0x4457, 0x3755, 0x27f1, 0x0000,
+	    0x0000, 0x02f9, 0x0000, 0x0469, 0x3d7c, 0x1af1, 0x0000, 0x39d5,
+	    0x3326, 0x466f, 0x39a6, 0x427e, 0x0444, 0x1863, 0x346e, 0x0c25,
+	    0x1d5e, 0x0000, 0x04ae, 0x2826, 0x4909, 0x0758, 0x0000, 0x2087,
+	    0x24df, 0x4144, 0x3393, 0x0000, 0x44fb, 0x3fd3, 0x26ab, 0x25e0,
+	    0x21a6, 0x2078, 0x0000, 0x4a2f, 0x26bf, 0x094f, 0x0261, 0x05e1,
+	    0x0d30, 0x3478, 0x1135, 0x0aca, 0x0000, 0x42c7, 0x2b18, 0x00b7,
+	    0x4749, 0x2b1e, 0x0272, 0x3884, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1666, 0x4c64, 0x1621, 0x0939, 0x01bf, 0x0000, 0x1bd7, 0x0000,
+	    0x075f, 0x3412, 0x0000, 0x21d4, 0x1ed0, 0x1f39, 0x1c86, 0x2d58,
+	    0x2f5f, 0x2a83, 0x00bd, 0x1560, 0x0418, 0x3543, 0x4150, 0x0c62,
+	    0x0000, 0x1da2, 0x12de, 0x0000, 0x0000, 0x2679, 0x48c6, 0x0000,
+	    0x0000, 0x495a, 0x0000, 0x2225, 0x1903, 0x0000, 0x0000, 0x4041,
+	    0x0000, 0x103a, 0x4475, 0x4df3, 0x132e, 0x1b92, 0x0066, 0x3c0f,
+	    0x0a75, 0x0000, 0x0000, 0x2198, 0x3458, 0x0000, 0x1a26, 0x05b2,
+	    0x4897, 0x1161, 0x0735, 0x4b40, 0x1188, 0x4de0, 0x0000, 0x4390,
+	    0x0000, 0x0000, 0x0136, 0x440f, 0x0000, 0x3855, 0x4a54, 0x33f9,
+	    0x0000, 0x162b, 0x0000, 0x430b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x1dc5, 0x04ef, 0x31e3, 0x0000, 0x0000, 0x2812, 0x0000, 0x0000,
+	    0x4434, 0x1342, 0x3d1f, 0x216a, 0x0000, 0x05dd, 0x4904, 0x276a,
+	    0x036f, 0x445e, 0x23e9, 0x2769, 0x0cfd, 0x0b65, 0x0da8, 0x4b5f,
+	    0x0000, 0x257e, 0x0000, 0x0000, 0x1d1b, 0x0789, 0x1e0c, 0x1599,
+	    0x4d64, 0x446d, 0x0000, 0x441f, 0x12ae, 0x2f28, 0x3e05, 0x3a16,
+	    0x2ea5, 0x0060, 0x2ae5, 0x0000, 0x1d8d, 0x009b, 0x3f0b, 0x0000,
+	    0x0b69, 0x2c43, 0x4026, 0x0000, 0x0b87, 0x2f26, 0x0394, 0x0000,
+	    0x0000, 0x3677, 0x4caf, 0x4167, 0x1a3b, 0x148f, 0x2748, 0x1ee0,
+	    0x1c6b, 0x15b8, 0x0fe7, 0x0ca5, 0x2dde, 0x0b06, 0x252b, 0x2ccb,
+	    0x4df9, 0x216a, 0x0000, 0x3184, 0x38a6, 0x0000, 0x46d0, 0x0000,
+	    0x3832, 0x0a27, 0x21e0, 0x40b3, 0x0000, 0x0000, 0x42f5, 0x2fd2,
+	    0x247f, 0x3eab, 0x39a6, 0x2b15, 0x3172, 0x0000, 0x3a3e, 0x06ed,
+	    0x3467, 0x3b02, 0x0000, 0x0da9, 0x0000, 0x0000, 0x2c93, 0x0000,
+	    0x282f, 0x2e43, 0x0000, 0x20df, 0x2347, 0x2d2f, 0x16fb, 0x16ba,
+	    0x2925, 0x41e8, 0x1e48, 0x0000, 0x157a, 0x1ed6, 0x15ec, 0x4118,
+	    0x0000, 0x27d0, 0x0000, 0x0000, 0x0000, 0x2921, 0x322b, 0x4064,
+	    0x38bc, 0x0aa1, 0x0000, 0x3094, 0x3c56, 0x40d0, 0x045d, 0x0000,
+	    0x389c, 0x165b, 0x296b, 0x0dfa, 0x325c, 0x4b34, 0x0000, 0x0f5a,
+	    0x480f, 0x359e, 0x0817, 0x121d, 0x257b, 0x0000, 0x1cea, 0x262a,
+	    0x356f, 0x38e5, 0x0e2e, 0x0000, 0x0cb5, 0x454d, 0x49b3, 0x40b4,
+	    0x2b9e, 0x25f6, 0x329c, 0x31de, 0x462a, 0x0000, 0x1384, 0x16c9,
+	    0x0fab, 0x3279, 0x302a, 0x0378, 0x1214, 0x0000, 0x41f8, 0x0000,
+	    0x08f8, 0x3bbe, 0x0000, 0x2e40, 0x06d8, 0x3ffa, 0x1277, 0x33c2,
+	    0x3a62, 0x0000, 0x1d1d, 0x31ff, 0x0000, 0x09bc, 0x0000, 0x1fad,
+	    0x3a54, 0x342b, 0x1858, 0x0000, 0x1973, 0x0000, 0x41f1, 0x335e,
+	    0x143c, 0x08e9, 0x069f, 0x42b1, 0x0000, 0x10ae, 0x1dfc, 0x0c31,
+	    0x0065, 0x2743, 0x0000, 0x1d1f, 0x1eff, 0x3025, 0x4869, 0x1421,
+	    0x4c2c, 0x1575, 0x1464, 0x3f8e, 0x0741, 0x2c67, 0x2669, 0x126c,
+	    0x4132, 0x3b95, 0x3305, 0x3acb, 0x4319, 0x3561, 0x02f2, 0x2aa0,
+	    0x31fb, 0x170e, 0x0000, 0x4048, 0x0000, 0x103c, 0x0403, 0x2599,
+	    0x0000, 0x44f6, 0x2213, 0x3524, 0x4638, 0x1da7, 0x0000, 0x4bf8,
+	    0x164e, 0x0000, 0x12c7, 0x39fb, 0x34f7, 0x29c3, 0x0056, 0x0146,
+	    0x0000, 0x076e, 0x3c75, 0x0000, 0x2672, 0x0000, 0x0000, 0x0796,
+	    0x3b27, 0x30dc, 0x02c7, 0x0000, 0x21e0, 0x3563, 0x0000, 0x39cf,
+	    0x0a44, 0x0000, 0x0000, 0x2225, 0x249b, 0x20be, 0x0000, 0x0000,
+	    0x46e0, 0x1b1d, 0x0000, 0x2c2d, 0x2063, 0x0000, 0x0000, 0x0d5c,
+	    0x13c0, 0x252e, 0x4bbb, 0x086e, 0x46d1, 0x0889, 0x3e8b, 0x0507,
+	    0x4676, 0x0000, 0x083f, 0x29d4, 0x4a0a, 0x0712, 0x3a12, 0x3834,
+	    0x0c70, 0x41cd, 0x373b, 0x3ca5, 0x17b0, 0x36ca, 0x0000, 0x0000,
+	    0x0000, 0x4980, 0x0000, 0x155e, 0x0000, 0x022a, 0x2830, 0x44d4,
+	    0x4ac5, 0x1912, 0x1701, 0x1611, 0x2fd9, 0x0a2a, 0x47ed, 0x0000,
+	    0x4d38, 0x04f3, 0x0000, 0x0000, 0x16f7, 0x0000, 0x0000, 0x0000,
+	    0x25a5, 0x0000, 0x323b, 0x0000, 0x24f9, 0x4ba3, 0x0000, 0x34a1,
+	    0x0c64, 0x2466, 0x366e, 0x0000, 0x44ec, 0x0267, 0x0b75, 0x1b8a,
+	    0x0000, 0x0000, 0x448f, 0x4607, 0x0000, 0x2cd9, 0x0000, 0x2ca9,
+	    0x1527, 0x0000, 0x0a8a, 0x15a0, 0x3b64, 0x0000, 0x342a, 0x44dc,
+	    0x348e, 0x0000, 0x316b, 0x2940, 0x34e2, 0x2c08, 0x1e54, 0x19a2,
+	    0x3812, 0x04b1, 0x0000, 0x0e54, 0x405d, 0x3304, 0x0000, 0x3115,
+	    0x0ad9, 0x23e1, 0x13a1, 0x3424, 0x0467, 0x0000, 0x184b, 0x0513,
+	    0x1649, 0x388e, 0x1899, 0x1123, 0x0000, 0x2111, 0x0000, 0x0000,
+	    0x06bd, 0x0bcd, 0x4482, 0x2347, 0x0000, 0x0948, 0x0000, 0x31e5,
+	    0x4a17, 0x177d, 0x39b4, 0x458c, 0x1bc3, 0x0000, 0x0000, 0x44d2,
+	    0x1308, 0x2004, 0x2d3e, 0x2041, 0x0000, 0x308e, 0x3d69, 0x2e8b,
+	    0x29c6, 0x00c0, 0x19a8, 0x2af7, 0x0000, 0x0000, 0x18b0, 0x139a,
+	    0x0000, 0x1471, 0x2075, 0x0000, 0x0655, 0x0000, 0x0000, 0x4d67,
+	    0x0000, 0x0000, 0x1088, 0x0000, 0x0b2a, 0x2683, 0x36fd, 0x1fd8,
+	    0x0000, 0x4057, 0x0557, 0x2f06, 0x3b83, 0x2180, 0x058d, 0x0000,
+	    0x0000, 0x3dde, 0x233d, 0x0204, 0x0085, 0x4e00, 0x0000, 0x2b21,
+	    0x3b36, 0x23f9, 0x46f4, 0x0000, 0x005d, 0x25d4, 0x0000, 0x04ad,
+	    0x4883, 0x247d, 0x43ef, 0x0000, 0x4b85, 0x2ca2, 0x3d19, 0x04b8,
+	    0x0371, 0x1261, 0x308b, 0x0000, 0x38e5, 0x4d88, 0x4c1d, 0x2ac9,
+	    0x0000, 0x1c42, 0x39c6, 0x0000, 0x31c1, 0x0000, 0x2c88, 0x0000,
+	    0x0000, 0x0000, 0x092f, 0x497b, 0x3f15, 0x159e, 0x0000, 0x2bc0,
+	    0x4d74, 0x0e69, 0x3639, 0x0000, 0x4385, 0x0000, 0x0000, 0x0d3e,
+	    0x0000, 0x112f, 0x44de, 0x15b7, 0x2621, 0x0000, 0x3937, 0x43b7,
+	    0x0000, 0x19e5, 0x4d2e, 0x0000, 0x0000, 0x0bb3, 0x0000, 0x3276,
+	    0x0000, 0x4a4c, 0x4667, 0x4b08, 0x25f8, 0x3073, 0x0000, 0x0000,
+	    0x0000, 0x0f6f, 0x2581, 0x3750, 0x2068, 0x3e86, 0x34d8, 0x1313,
+	    0x035b, 0x1b99, 0x2a9a, 0x344b, 0x2bca, 0x0000, 0x2829, 0x0000,
+	    0x4c3a, 0x07c2, 0x0000, 0x391f, 0x2ac1, 0x32f3, 0x4b44, 0x0000,
+	    0x0000, 0x0000, 0x0b34, 0x0000, 0x0000, 0x0000, 0x0000, 0x2a3b,
+	    0x0ecb, 0x0138, 0x0000, 0x3f68, 0x0000, 0x3937, 0x1f4e, 0x0781,
+	    0x299d, 0x0000, 0x3c8f, 0x49c4, 0x476b, 0x2ef4, 0x021b, 0x0000,
+	    0x075d, 0x2378, 0x38d1, 0x4159, 0x4264, 0x198f, 0x0000, 0x23cd,
+	    0x05d4, 0x2227, 0x4538, 0x1a7a, 0x4a05, 0x4c24, 0x0000, 0x3d39,
+	    0x3f77, 0x3090, 0x4af6, 0x314b, 0x0ab1, 0x0000, 0x44b7, 0x37e2,
+	    0x2105, 0x3bce, 0x2302, 0x3358, 0x0000, 0x26e8, 0x0000, 0x06a3,
+	    0x0000, 0x0000, 0x444f, 0x110e, 0x1b76, 0x1bfc, 0x2c03, 0x0c8b,
+	    0x1500, 0x2f1f, 0x0000, 0x456d, 0x14cd, 0x0000, 0x4d3e, 0x12de,
+	    0x0000, 0x20b1, 0x0000, 0x07ea, 0x0000, 0x0000, 0x2b41, 0x1f67,
+	    0x3f97, 0x14d5, 0x006e, 0x0000, 0x3acd, 0x0438, 0x3219, 0x0000,
+	    0x2e1f, 0x4405, 0x2bf5, 0x1dc3, 0x0a65, 0x0f33, 0x0000, 0x1c65,
+	    0x4631, 0x0000, 0x0000, 0x0000, 0x2efd, 0x0000, 0x14fa, 0x0000,
+	    0x3c5e, 0x0d9b, 0x3b0d, 0x0afe, 0x098f, 0x155f, 0x13c7, 0x0f74,
+	    0x266d, 0x3b83, 0x3026, 0x4a9e, 0x3735, 0x4510, 0x35a6, 0x0000,
+	    0x1561, 0x0075, 0x46c0, 0x21f7, 0x3236, 0x3af2, 0x0000, 0x0000,
+	    0x108c, 0x0461, 0x0000, 0x4ae5, 0x0b06, 0x0000, 0x489d, 0x0000,
+	    0x3359, 0x4a70, 0x07b6, 0x0959, 0x0000, 0x0e65, 0x1a85, 0x30ad,
+	    0x021b, 0x2698, 0x0a65, 0x0e14, 0x298e, 0x26af, 0x4611, 0x2791,
+	    0x4d6f, 0x2f41, 0x0000, 0x2960, 0x1704, 0x1f9e, 0x0000, 0x1c87,
+	    0x0000, 0x2942, 0x0000, 0x2999, 0x19e1, 0x18fa, 0x0cab, 0x0000,
+	    0x4cc0, 0x0000, 0x3710, 0x3a34, 0x47cd, 0x1eec, 0x0fcb, 0x1f80,
+	    0x0893, 0x2696, 0x184f, 0x4784, 0x0000, 0x437c, 0x39b3, 0x35ba,
+	    0x1d94, 0x0000, 0x4af4, 0x1e33, 0x339a, 0x22dc, 0x303a, 0x1207,
+	    0x0000, 0x4a36, 0x07a9, 0x0000, 0x3c53, 0x148d, 0x32d7, 0x0be7,
+	    0x1a60, 0x1ed0, 0x0000, 0x3e7f, 0x0000, 0x1519, 0x2c56, 0x3667,
+	    0x137e, 0x10ac, 0x2b71, 0x4a8b, 0x0000, 0x0000, 0x0abb, 0x2b87,
+	    0x0000, 0x4177, 0x0000, 0x0896, 0x1f9a, 0x3dfc, 0x25b9, 0x37a8,
+	    0x1c7d, 0x255d, 0x3868, 0x0000, 0x07c5, 0x0000, 0x488a, 0x37e8,
+	    0x33aa, 0x2236, 0x2d9d, 0x0000, 0x3b6b, 0x1f69, 0x0000, 0x42d3,
+	    0x1f2b, 0x0000, 0x0073, 0x25c2, 0x0000, 0x1174, 0x0000, 0x44bf,
+	    0x3630, 0x0000, 0x19c4, 0x0000, 0x4ad2, 0x0fef, 0x3aca, 0x03be,
+	    0x27c2, 0x44a2, 0x0d38, 0x3f4a, 0x4942, 0x0000, 0x4d05, 0x0000,
+	    0x0000, 0x0000, 0x3508, 0x0000, 0x0000, 0x3b64, 0x0000, 0x0000,
+	    0x040b, 0x1764, 0x1a08, 0x1fd8, 0x1014, 0x3288, 0x06c9, 0x0d3e,
+	    0x0000, 0x0000, 0x4ca2, 0x0000, 0x0000, 0x14e5, 0x3a26, 0x2be4,
+	    0x068d, 0x36c7, 0x0000, 0x284d, 0x4550, 0x39ef, 0x0000, 0x20b2,
+	    0x0000, 0x3f51, 0x0cae, 0x0000, 0x0b23, 0x030c, 0x1778, 0x37cb,
+	    0x04c7, 0x3d31, 0x2595, 0x0000, 0x3cef, 0x1f41, 0x3f51, 0x0000,
+	    0x3666, 0x01e6, 0x1488, 0x0dfa, 0x4cc0, 0x0ada, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x3d4b, 0x0f37, 0x1a4b, 0x396f, 0x3027, 0x0000,
+	    0x066b, 0x49eb, 0x0608, 0x2f33, 0x0000, 0x02a6, 0x45bf, 0x12ab,
+	    0x04d6, 0x34d1, 0x08c0, 0x2665, 0x0000, 0x2223, 0x43ff, 0x1a43,
+	    0x0000, 0x0000, 0x47f1, 0x0000, 0x1a0f, 0x1dc7, 0x1295, 0x0000,
+	    0x3251, 0x2992, 0x2531, 0x0c2b, 0x27f2, 0x0000, 0x0000, 0x0000,
+	    0x426d, 0x377c, 0x1b1f, 0x0000, 0x427e, 0x0b74, 0x0000, 0x4c55,
+	    0x0f85, 0x164d, 0x0000, 0x0b3a, 0x23fa, 0x0000, 0x0000, 0x0000,
+	    0x3233, 0x0000, 0x09bb, 0x4283, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x120f, 0x1c38, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d42, 0x1c1d,
+	    0x31c8, 0x0000, 0x22d9, 0x0000, 0x0000, 0x200e, 0x3c1c, 0x4c91,
+	    0x12bc, 0x0de8, 0x0595, 0x0952, 0x2607, 0x27d8, 0x1bd8, 0x1d3e,
+	    0x1327, 0x0000, 0x057f, 0x4618, 0x0000, 0x0ed0, 0x0000, 0x0b80,
+	    0x0517, 0x3ce4, 0x103e, 0x016f, 0x4350, 0x0000, 0x2bcb, 0x2b4d,
+	    0x489a, 0x2471, 0x4df5, 0x29d1, 0x4678, 0x208e, 0x0201, 0x0000,
+	    0x2bfa, 0x0cc8, 0x41b9, 0x40e2, 0x0000, 0x143b, 0x0000, 0x203d,
+	    0x0000, 0x3049, 0x0000, 0x257f, 0x0a8f, 0x41aa, 0x0fac, 0x0ccc,
+	    0x4162, 0x0000, 0x0000, 0x225f, 0x2969, 0x3e23, 0x0d0d, 0x36c1,
+	    0x4471, 0x05b7, 0x0000, 0x0000, 0x0000, 0x2d20, 0x49c0, 0x136d,
+	    0x1bac, 0x141c, 0x1aee, 0x0000, 0x2f69, 0x01bd, 0x001c, 0x0000,
+	    0x1396, 0x3c0d, 0x1304, 0x0000, 0x0000, 0x0000, 0x0c38, 0x41df,
+	    0x2f24, 0x1f35, 0x09ce, 0x1a86, 0x1bf2, 0x0000, 0x0000, 0x00b1,
+	    0x0000, 0x17a1, 0x2f39, 0x43a6, 0x0154, 0x07aa, 0x4d27, 0x47f3,
+	    0x0000, 0x2131, 0x0919, 0x27b5, 0x19f1, 0x448a, 0x3446, 0x0045,
+	    0x0000, 0x189a, 0x0000, 0x1b9a, 0x1a95, 0x1252, 0x294e, 0x36a8,
+	    0x17ba, 0x0000, 0x01bc, 0x3b1c, 0x09ac, 0x3c72, 0x0000, 0x2bd2,
+	    0x0b7a, 0x06a1, 0x2772, 0x1df4, 0x157b, 0x11c5, 0x1d37, 0x42ab,
+	    0x274b, 0x4b10, 0x22db, 0x0842, 0x0000, 0x0000, 0x0acf, 0x122f,
+	    0x11db, 0x1cf5, 0x2ef7, 0x0f1d, 0x2a77, 0x0000, 0x0000, 0x2596,
+	    0x2bf9, 0x0000, 0x1a6b, 0x2a68, 0x2e07, 0x1da8, 0x0000, 0x3726,
+	    0x0000, 0x0b78, 0x4a4a, 0x3fd7, 0x2d0b, 0x14eb, 0x0000, 0x0000,
+	    0x16f6, 0x0000, 0x4d81, 0x4c70, 0x2745, 0x26ea, 0x1d5b, 0x0000,
+	    0x10c5, 0x453d, 0x078c, 0x16ce, 0x19d8, 0x0fd9, 0x3c04, 0x1834,
+	    0x4c4a, 0x0000, 0x2f79, 0x0bc1, 0x383f, 0x336b, 0x09a6, 0x316a,
+	    0x1d87, 0x0000, 0x0000, 0x20b7, 0x293f, 0x4928, 0x006c, 0x0f08,
+	    0x0000, 0x12ff, 0x1d53, 0x1c73, 0x0000, 0x08ce, 0x4384, 0x15c9,
+	    0x26be, 0x18f8, 0x15ac, 0x0535, 0x2c06, 0x3336, 0x34ef, 0x2622,
+	    0x31d8, 0x3f09, 0x193a, 0x323e, 0x0000, 0x0d41, 0x217b, 0x0140,
+	    0x0c0d, 0x080a, 0x4745, 0x0df9, 0x0000, 0x0000, 0x2302, 0x0000,
+	    0x4365, 0x0000, 0x0000, 0x02de, 0x0000, 0x1310, 0x0a35, 0x38bf,
+	    0x0000, 0x1606, 0x44f8, 0x429c, 0x00f8, 0x46ce, 0x4875, 0x0ebe,
+	    0x38f4, 0x1007, 0x0a72, 0x0000, 0x0000, 0x04d1, 0x24f5, 0x4641,
+	    0x0000, 0x0000, 0x43ff, 0x466d, 0x0000, 0x0000, 0x1eb1, 0x0f03,
+	    0x143e, 0x1d5c, 0x0000, 0x1d30, 0x1ab8, 0x0000, 0x0000, 0x2c07,
+	    0x19fb, 0x28c0, 0x0000, 0x2a8c, 0x00ae, 0x1cd3, 0x0000, 0x0000,
+	    0x0000, 0x2d77, 0x23d8, 0x0000, 0x4196, 0x2045, 0x0000, 0x456e,
+	    0x0000, 0x1532, 0x134b, 0x0000, 0x0000, 0x0000, 0x3a09, 0x47a0,
+	    0x0000, 0x172c, 0x0000, 0x3f2d, 0x4a08, 0x0a26, 0x1ec0, 0x3c58,
+	    0x3c3f, 0x4a48, 0x349a, 0x45e1, 0x30bf, 0x0000, 0x1a91, 0x0000,
+	    0x0000, 0x40c3, 0x0e6c, 0x0d07, 0x1388, 0x0000, 0x1f4b, 0x3ceb,
+	    0x0cf6, 0x0000, 0x1f58, 0x0000, 0x3d46, 0x358d, 0x0f3f, 0x03ca,
+	    0x09d2, 0x0000, 0x3127, 0x0000, 0x3bbb, 0x2c21, 0x1b10, 0x0000,
+	    0x2e33, 0x39cd, 0x0f16, 0x39f6, 0x48cf, 0x3206, 0x4c99, 0x0000,
+	    0x297f, 0x1454, 0x4400, 0x07fe, 0x33cf, 0x0000, 0x184f, 0x0000,
+	    0x10a6, 0x34c3, 0x3ad9, 0x0000, 0x0a3a, 0x2802, 0x2639, 0x28e3,
+	    0x28d5, 0x148e, 0x3cf7, 0x20c4, 0x0000, 0x0000, 0x2997, 0x3b00,
+	    0x1292, 0x0103, 0x22ef, 0x2eb6, 0x0000, 0x111e, 0x0000, 0x3e41,
+	    0x400e, 0x0d11, 0x038a, 0x0000, 0x1ca5, 0x2d25, 0x0416, 0x471e,
+	    0x25ed, 0x0000, 0x1c90, 0x02e6, 0x0000, 0x26e5, 0x1069, 0x3cad,
+	    0x0000, 0x1d62, 0x4d43, 0x1bf0, 0x2f3c, 0x1fe2, 0x0000, 0x2543,
+	    0x4432, 0x0000, 0x0aea, 0x48fe, 0x0000, 0x41da, 0x449e, 0x3dc6,
+	    0x2457, 0x1b2d, 0x0000, 0x3de4, 0x09c3, 0x0000, 0x1916, 0x2f74,
+	    0x2c3e, 0x19b2, 0x1f15, 0x240c, 0x48be, 0x0000, 0x3135, 0x03f1,
+	    0x1eff, 0x0eec, 0x01c6, 0x16db, 0x0000, 0x2709, 0x406b, 0x46ef,
+	    0x46cd, 0x01de, 0x0233, 0x3ad0, 0x366b, 0x0000, 0x0000, 0x3636,
+	    0x0e41, 0x0000, 0x13f2, 0x295a, 0x490c, 0x1977, 0x15aa, 0x0000,
+	    0x0af9, 0x1520, 0x0000, 0x22e3, 0x10d0, 0x227f, 0x0000, 0x3855,
+	    0x37ab, 0x1524, 0x1316, 0x067a, 0x1460, 0x2977, 0x49e9, 0x12e8,
+	    0x3322, 0x0e1f, 0x0000, 0x1f3c, 0x17ae, 0x27fc, 0x41a1, 0x2e8d,
+	    0x0d20, 0x4c0c, 0x3f33, 0x3fbf, 0x3ce7, 0x0e9b, 0x00c0, 0x27df,
+	    0x4078, 0x01aa, 0x0e4a, 0x3cbe, 0x048e, 0x49ea, 0x2f93, 0x1581,
+	    0x06bf, 0x38ff, 0x1317, 0x0000, 0x0fc1, 0x2ada, 0x0000, 0x1b9f,
+	    0x2dac, 0x0000, 0x2bd9, 0x2065, 0x460c, 0x427c, 0x18f7, 0x2cf2,
+	    0x25a5, 0x2d07, 0x0abd, 0x0000, 0x2d16, 0x29d5, 0x3d24, 0x4c45,
+	    0x229c, 0x158d, 0x1496, 0x12a1, 0x0000, 0x2ec9, 0x2139, 0x1307,
+	    0x3a42, 0x1a4c, 0x307b, 0x0e05, 0x26ff, 0x0000, 0x4832, 0x47d3,
+	    0x1813, 0x0ab0, 0x2ca1, 0x0fd2, 0x24a8, 0x238d, 0x0000, 0x110f,
+	    0x0000, 0x28b2, 0x3bec, 0x0000, 0x0f9b, 0x2b10, 0x0eb7, 0x21bd,
+	    0x151c, 0x42e9, 0x0000, 0x0000, 0x26f5, 0x1a9a, 0x2bf5, 0x21db,
+	    0x3415, 0x127d, 0x3841, 0x43b6, 0x3169, 0x0000, 0x0000, 0x087f,
+	    0x3949, 0x0000, 0x0000, 0x45e5, 0x14d5, 0x17db, 0x315f, 0x1044,
+	    0x0000, 0x0000, 0x3250, 0x0000, 0x0000, 0x0000, 0x29f2, 0x1157,
+	    0x0000, 0x0000, 0x1741, 0x07f1, 0x039d, 0x0000, 0x2abb, 0x497f,
+	    0x2493, 0x3a89, 0x1a13, 0x350c, 0x0419, 0x2b2b, 0x22fe, 0x343d,
+	    0x211e, 0x021a, 0x0c8b, 0x019a, 0x0b5a, 0x41ac, 0x494a, 0x4acf,
+	    0x25f6, 0x09af, 0x2d1f, 0x30f5, 0x0000, 0x0000, 0x2176, 0x2647,
+	    0x1d40, 0x4ad8, 0x0000, 0x4108, 0x0000, 0x22cb, 0x1439, 0x119a,
+	    0x22e3, 0x2976, 0x0000, 0x021c, 0x4b6d, 0x0000, 0x1696, 0x12c8,
+	    0x1c4f, 0x47f5, 0x49a1, 0x247e, 0x1d7c, 0x42f8, 0x0000, 0x3038,
+	    0x288e, 0x32c1, 0x08f7, 0x4df7, 0x4dab, 0x0000, 0x06ab, 0x1d7e,
+	    0x4927, 0x0000, 0x19f1, 0x0000, 0x2930, 0x0145, 0x0000, 0x47fe,
+	    0x14a2, 0x2fd8, 0x45cc, 0x4aa6, 0x0000, 0x108b, 0x0610, 0x03ec,
+	    0x0000, 0x2e41, 0x19dd, 0x1e8d, 0x0000, 0x22b8, 0x3c37, 0x0000,
+	    0x0000, 0x19e4, 0x2250, 0x08e4, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x2932, 0x0f00, 0x3502, 0x05d6, 0x2f60, 0x05d2, 0x07a2, 0x192d,
+	    0x40ec, 0x3c10, 0x1e25, 0x1912, 0x2cc1, 0x3141, 0x4661, 0x1201,
+	    0x07ff, 0x0000, 0x22b0, 0x0ad5, 0x0000, 0x0d74, 0x0000, 0x07c5,
+	    0x472d, 0x0d59, 0x0000, 0x3d68, 0x2dc1, 0x2636, 0x0000, 0x0834,
+	    0x0ded, 0x0000, 0x08d4, 0x1ef8, 0x0000, 0x3c07, 0x0000, 0x39cc,
+	    0x19ac, 0x0eca, 0x0000, 0x0000, 0x1b54, 0x0000, 0x4264, 0x4d38,
+	    0x0000, 0x0000, 0x295b, 0x0000, 0x3706, 0x4082, 0x33ee, 0x2a88,
+	    0x0000, 0x2e4e, 0x2909, 0x06d6, 0x4939, 0x403f, 0x096d, 0x1a6f,
+	    0x0000, 0x0000, 0x0000, 0x00fb, 0x1f7a, 0x0000, 0x0000, 0x11df,
+	    0x195d, 0x2a3b, 0x0000, 0x0000, 0x0000, 0x48b2, 0x3759, 0x34ad,
+	    0x3df6, 0x248c, 0x0000, 0x038a, 0x3120, 0x1204, 0x12cc, 0x15ed,
+	    0x454e, 0x0000, 0x2a72, 0x0000, 0x3a4e, 0x17b6, 0x4155, 0x49f2,
+	    0x31fb, 0x179d, 0x00f4, 0x000c, 0x3907, 0x0875, 0x0000, 0x17cc,
+	    0x0000, 0x35e9, 0x0a44, 0x0000, 0x0000, 0x18bd, 0x3361, 0x240a,
+	    0x1419, 0x283a, 0x0000, 0x00a1, 0x1fdb, 0x0000, 0x0000, 0x494b,
+	    0x245d, 0x1021, 0x4741, 0x155c, 0x1d77, 0x461c, 0x30c3, 0x0000,
+	    0x137f, 0x0000, 0x09af, 0x1aeb, 0x39e6, 0x0161, 0x1e75, 0x080b,
+	    0x0ecf, 0x3484, 0x0114, 0x176c, 0x0000, 0x0651, 0x2cb0, 0x190c,
+	    0x25f7, 0x0534, 0x2123, 0x3b88, 0x2504, 0x0000, 0x0000, 0x2b21,
+	    0x0d73, 0x30e1, 0x0000, 0x0829, 0x3883, 0x05ac, 0x17ef, 0x3550,
+	    0x142d, 0x4aa0, 0x3a97, 0x0831, 0x021c, 0x117c, 0x28bc, 0x10f0,
+	    0x410a, 0x0466, 0x1871, 0x12f5, 0x0ada, 0x025d, 0x0000, 0x1b8c,
+	    0x0000, 0x3631, 0x232a, 0x0000, 0x3c91, 0x4e09, 0x0000, 0x15ee,
+	    0x2dba, 0x0000, 0x0000, 0x0000, 0x2323, 0x209c, 0x4388, 0x0000,
+	    0x1529, 0x45c1, 0x18a4, 0x2da9, 0x0332, 0x0000, 0x0564, 0x2978,
+	    0x3ae3, 0x0000, 0x0000, 0x0ccd, 0x0000, 0x30e9, 0x1c8c, 0x3894,
+	    0x467a, 0x0000, 0x0000, 0x0000, 0x0000, 0x107c, 0x4539, 0x49c0,
+	    0x0000, 0x2fd7, 0x4696, 0x0592, 0x0460, 0x0655, 0x09e0, 0x1ade,
+	    0x0e8a, 0x0fc8, 0x40aa, 0x2c9a, 0x4429, 0x0000, 0x06b2, 0x0000,
+	    0x04fd, 0x26f6, 0x0000, 0x1ec5, 0x43d3, 0x262c, 0x24ac, 0x47b4,
+	    0x3b81, 0x2cde, 0x46b0, 0x0656, 0x0000, 0x272c, 0x0674, 0x261d,
+	    0x0000, 0x4565, 0x435f, 0x1bb6, 0x068c, 0x01f8, 0x0000, 0x3808,
+	    0x1a75, 0x2041, 0x3576, 0x2b83, 0x0000, 0x0000, 0x0000, 0x44cc,
+	    0x4add, 0x3438, 0x4532, 0x1b95, 0x0460, 0x4470, 0x4423, 0x3f00,
+	    0x49b7, 0x2abe, 0x31fe, 0x42f4, 0x0000, 0x0000, 0x1b09, 0x0569,
+	    0x3021, 0x0561, 0x0000, 0x3bd5, 0x18ee, 0x4b16, 0x1cbc, 0x0000,
+	    0x1fd9, 0x2424, 0x0000, 0x010f, 0x1f5f, 0x387c, 0x0000, 0x3a7b,
+	    0x4627, 0x0496, 0x23c1, 0x10c4, 0x1922, 0x2639, 0x1aaf, 0x1747,
+	    0x0000, 0x0000, 0x3b46, 0x23c3, 0x3a73, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x27b3, 0x39cc, 0x0000, 0x3410, 0x1354, 0x4854, 0x0d87,
+	    0x3a40, 0x4e0b, 0x0b27, 0x12fe, 0x0000, 0x0000, 0x11b5, 0x3fb9,
+	    0x20e0, 0x0000, 0x0000, 0x48e2, 0x0000, 0x2d43, 0x44af, 0x4d7a,
+	    0x3d45, 0x0000, 0x348e, 0x257c, 0x357c, 0x0637, 0x3529, 0x2ac6,
+	    0x2663, 0x1814, 0x0d03, 0x4725, 0x0b2d, 0x0000, 0x4b9e, 0x100a,
+	    0x206f, 0x0000, 0x0875, 0x3add, 0x17b8, 0x3447, 0x37cf, 0x0161,
+	    0x273e, 0x0000, 0x4372, 0x0000, 0x0000, 0x23e4, 0x0000, 0x1056,
+	    0x3b6a, 0x4609, 0x0000, 0x0000, 0x0fcd, 0x137b, 0x3611, 0x1288,
+	    0x357a, 0x0604, 0x49df, 0x2885, 0x2f38, 0x0000, 0x0000, 0x27c1,
+	    0x0000, 0x13a7, 0x3a9e, 0x492c, 0x0000, 0x4519, 0x053d, 0x0ef5,
+	    0x048b, 0x29b0, 0x39c3, 0x0000, 0x49eb, 0x061d, 0x0b96, 0x11fc,
+	    0x0000, 0x0000, 0x34a0, 0x00f2, 0x01cd, 0x0000, 0x193e, 0x07dd,
+	    0x4769, 0x16c8, 0x388e, 0x029d, 0x43c6, 0x2533, 0x24a7, 0x4435,
+	    0x2779, 0x0000, 0x38ed, 0x3600, 0x2ca1, 0x3a2a, 0x1c53, 0x09d1,
+	    0x0000, 0x1664, 0x247f, 0x264e, 0x0000, 0x0000, 0x0000, 0x458f,
+	    0x1c9b, 0x3646, 0x4a8e, 0x345b, 0x2495, 0x1360, 0x0000, 0x2570,
+	    0x0000, 0x0000, 0x094f, 0x0bdc, 0x42e9, 0x07ec, 0x0000, 0x148d,
+	    0x4b4f, 0x0000, 0x1c7b, 0x24d0, 0x0000, 0x3841, 0x2e40, 0x0000,
+	    0x1ef8, 0x366c, 0x450a, 0x0b1c, 0x41a3, 0x2a5e, 0x3bfa, 0x0000,
+	    0x0000, 0x1720, 0x0000, 0x2037, 0x0733, 0x4544, 0x344c, 0x457c,
+	    0x29ed, 0x2805, 0x0000, 0x2050, 0x05d4, 0x2d65, 0x4508, 0x2742,
+	    0x0000, 0x0000, 0x3e74, 0x2b90, 0x38ab, 0x0000, 0x4d1c, 0x0d42,
+	    0x0000, 0x132a, 0x0d5f, 0x3d7a, 0x3308, 0x03fb, 0x020f, 0x2291,
+	    0x11f6, 0x0000, 0x3076, 0x0000, 0x1785, 0x1324, 0x0000, 0x09aa,
+	    0x49d4, 0x2e13, 0x4a4b, 0x3b7a, 0x0000, 0x0de6, 0x0000, 0x0be0,
+	    0x4555, 0x3783, 0x0000, 0x1cab, 0x35a4, 0x0722, 0x22e2, 0x1c14,
+	    0x0e65, 0x1533, 0x25f3, 0x14e8, 0x0dac, 0x3344, 0x0000, 0x03be,
+	    0x2f7d, 0x1748, 0x34aa, 0x4b8b, 0x3b10, 0x3366, 0x037f, 0x2b85,
+	    0x4a52, 0x3e6d, 0x0000, 0x0fd8, 0x2216, 0x3d66, 0x0000, 0x1760,
+	    0x0ee4, 0x0350, 0x2d6e, 0x0000, 0x0000, 0x03a7, 0x0000, 0x0000,
+	    0x0000, 0x3d06, 0x1f76, 0x3751, 0x0e31, 0x270e, 0x04bc, 0x496f,
+	    0x4754, 0x215c, 0x3738, 0x0000, 0x28d3, 0x14fb, 0x22a4, 0x37ee,
+	    0x1025, 0x0000, 0x25f0, 0x230f, 0x1dce, 0x0000, 0x0000, 0x0000,
+	    0x4db2, 0x49ba, 0x194d, 0x2ee5, 0x0187, 0x0000, 0x46d0, 0x0aa2,
+	    0x0000, 0x0000, 0x183a, 0x0000, 0x0000, 0x1595, 0x0000, 0x2dec,
+	    0x3a28, 0x370d, 0x0000, 0x0034, 0x36c6, 0x217b, 0x0185, 0x40f6,
+	    0x49f5, 0x1f8f, 0x012c, 0x3892, 0x4c33, 0x4b98, 0x1be0, 0x29ac,
+	    0x2b8f, 0x1b88, 0x2cd0, 0x0877, 0x3bb7, 0x07eb, 0x224b, 0x4880,
+	    0x0000, 0x25a4, 0x4d7b, 0x1485, 0x386c, 0x231f, 0x4254, 0x0000,
+	    0x0000, 0x47f7, 0x4ad7, 0x48a9, 0x0000, 0x31d2, 0x1947, 0x35cc,
+	    0x238b, 0x3404, 0x1589, 0x1eff, 0x12cc, 0x32e1, 0x0000, 0x411d,
+	    0x1fbd, 0x2377, 0x2bfd, 0x0000, 0x0000, 0x44be, 0x1663, 0x0000,
+	    0x4282, 0x47d8, 0x2b76, 0x0000, 0x0000, 0x0000, 0x4b5f, 0x3a75,
+	    0x0000, 0x2369, 0x2182, 0x1127, 0x4a1a, 0x0000, 0x0293, 0x3856,
+	    0x08b4, 0x1cb7, 0x3bdb, 0x1ac6, 0x14da, 0x1b29, 0x0420, 0x390d,
+	    0x300a, 0x2b1f, 0x1ead, 0x0e42, 0x0000, 0x0873, 0x0000, 0x0000,
+	    0x1fa4, 0x04b2, 0x0000, 0x32b2, 0x0000, 0x0000, 0x4630, 0x0621,
+	    0x0000, 0x11cd, 0x1152, 0x0346, 0x345a, 0x1b8e, 0x35dc, 0x0b7f,
+	    0x1adc, 0x0000, 0x089f, 0x40d2, 0x09b1, 0x371e, 0x2ed0, 0x14dc,
+	    0x2eb9, 0x3202, 0x24a6, 0x0000, 0x0000, 0x1aba, 0x2d85, 0x43ef,
+	    0x0000, 0x4bdd, 0x0641, 0x4343, 0x0971, 0x31f3, 0x0f83, 0x0eaf,
+	    0x0000, 0x019e, 0x464a, 0x00ee, 0x12c8, 0x229a, 0x37bc, 0x19be,
+	    0x09fc, 0x2103, 0x2f6f, 0x26b5, 0x3336, 0x21df, 0x25c2, 0x1583,
+	    0x468b, 0x2549, 0x2e51, 0x08c1, 0x0b47, 0x190b, 0x12be, 0x2258,
+	    0x2f67, 0x4336, 0x34e9, 0x2bd9, 0x1cc0, 0x2965, 0x0000, 0x46b3,
+	    0x1e8d, 0x3e21, 0x0000, 0x0000, 0x461f, 0x0000, 0x4a5c, 0x30f7,
+	    0x2800, 0x143c, 0x0000, 0x2aed, 0x0000, 0x3eb0, 0x1895, 0x0000,
+	    0x1398, 0x103d, 0x4aba, 0x0000, 0x1b4e, 0x182a, 0x0000, 0x0308,
+	    0x0000, 0x3f49, 0x2aff, 0x0000, 0x18a9, 0x2579, 0x0000, 0x1e58,
+	    0x0000, 0x0738, 0x0000, 0x3786, 0x3a93, 0x0d3f, 0x4ae8, 0x0000,
+	    0x0000, 0x009b, 0x0000, 0x0fc6, 0x3f92, 0x479e, 0x0b6b, 0x1db5,
+	    0x3796, 0x0000, 0x3663, 0x0000, 0x0000, 0x0782, 0x337a, 0x3e89,
+	    0x4cd4, 0x2117, 0x0000, 0x1d20, 0x295d, 0x1f82, 0x1cc9, 0x303b,
+	    0x3d4b, 0x4661, 0x3370, 0x4646, 0x0000, 0x0000, 0x1b7d, 0x0000,
+	    0x0f5c, 0x2b8b, 0x0faf, 0x0000, 0x012f, 0x4bfa, 0x3dfa, 0x128c,
+	    0x2bb8, 0x4009, 0x3898, 0x2469, 0x0000, 0x0000, 0x2c69, 0x124d,
+	    0x13a4, 0x3b17, 0x458d, 0x0000, 0x028e, 0x085b, 0x14d9, 0x253e,
+	    0x0000, 0x287b, 0x2830, 0x0000, 0x34dc, 0x0000, 0x0000, 0x018d,
+	    0x38ec, 0x4868, 0x0000, 0x1fb4, 0x2943, 0x3018, 0x4322, 0x0517,
+	    0x0fb0, 0x395b, 0x0000, 0x0000, 0x2f6f, 0x0000, 0x3570, 0x47f5,
+	    0x1ffd, 0x0000, 0x0d71, 0x0000, 0x4a8b, 0x135d, 0x0c1f, 0x0000,
+	    0x01b6, 0x0000, 0x38e1, 0x152e, 0x420d, 0x3c11, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x149c, 0x108f, 0x4c31, 0x3cce, 0x39c5, 0x0000,
+	    0x0000, 0x03ff, 0x0000, 0x29bf, 0x218c, 0x2bf6, 0x304d, 0x3656,
+	    0x0000, 0x189d, 0x277b, 0x0255, 0x48d0, 0x1900, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0d2b, 0x4261, 0x16c1, 0x4505, 0x196b,
+	    0x21b1, 0x111d, 0x11a4, 0x4340, 0x0000, 0x1fac, 0x0000, 0x1371,
+	    0x33aa, 0x0000, 0x36e1, 0x109b, 0x3759, 0x414f, 0x22cb, 0x21da,
+	    0x3d3b, 0x4b97, 0x4648, 0x0789, 0x0000, 0x4dee, 0x0000, 0x1b0a,
+	    0x41b8, 0x2051, 0x200d, 0x1818, 0x04c5, 0x0d12, 0x1809, 0x0000,
+	    0x0000, 0x0000, 0x30c4, 0x3314, 0x0000, 0x2ecb, 0x4367, 0x0142,
+	    0x09fb, 0x3fd0, 0x0000, 0x0000, 0x498a, 0x2d99, 0x4a48, 0x4b3a,
+	    0x4b97, 0x35b1, 0x41c4, 0x2659, 0x2c85, 0x0000, 0x0333, 0x2e7f,
+	    0x0c31, 0x0000, 0x3a63, 0x2dbf, 0x04bb, 0x2033, 0x1ba4, 0x3611,
+	    0x3c0e, 0x0000, 0x0000, 0x05bf, 0x08f9, 0x041f, 0x1c98, 0x0000,
+	    0x0000, 0x0032, 0x1e33, 0x2464, 0x31eb, 0x4637, 0x4482, 0x0803,
+	    0x2a07, 0x3cf6, 0x0000, 0x33a1, 0x3feb, 0x4249, 0x16fc, 0x27ec,
+	    0x0000, 0x0000, 0x0000, 0x115b, 0x0000, 0x0000, 0x0caa, 0x0000,
+	    0x0b4c, 0x465c, 0x0000, 0x2862, 0x0a75, 0x1e90, 0x0630, 0x3dc3,
+	    0x2f68, 0x155f, 0x0c8d, 0x21c3, 0x2bce, 0x18dd, 0x4967, 0x0000,
+	    0x10b7, 0x31c9, 0x4658, 0x4a84, 0x0fee, 0x43d9, 0x15e8, 0x0000,
+	    0x27fe, 0x23bd, 0x0000, 0x0000, 0x4cd2, 0x073d, 0x06d4, 0x1268,
+	    0x458b, 0x4507, 0x2cdb, 0x3afe, 0x2533, 0x0000, 0x49b4, 0x0000,
+	    0x13a5, 0x0000, 0x0000, 0x0000, 0x011e, 0x1b54, 0x2f63, 0x1ea7,
+	    0x36f3, 0x4b89, 0x3c69, 0x2712, 0x0000, 0x4d09, 0x0000, 0x228f,
+	    0x1e0e, 0x0000, 0x0000, 0x022c, 0x15ce, 0x0000, 0x4b21, 0x3d22,
+	    0x067e, 0x12e0, 0x069d, 0x0b9b, 0x1518, 0x29fa, 0x46d4, 0x0000,
+	    0x1919, 0x0000, 0x2d2a, 0x2945, 0x0000, 0x0000, 0x3c08, 0x07d0,
+	    0x2c7b, 0x33a0, 0x0000, 0x490c, 0x0000, 0x0000, 0x0000, 0x2702,
+	    0x1f87, 0x4adb, 0x3c2c, 0x0000, 0x0000, 0x0000, 0x2238, 0x0000,
+	    0x1e4b, 0x289f, 0x1620, 0x0000, 0x28b4, 0x1ef3, 0x15b8, 0x4452,
+	    0x1da4, 0x0f50, 0x4416, 0x1dab, 0x266e, 0x14c8, 0x0000, 0x0000,
+	    0x428c, 0x0db2, 0x1867, 0x1933, 0x3432, 0x03db, 0x4b84, 0x43bd,
+	    0x222b, 0x139b, 0x3cc1, 0x057d, 0x4da9, 0x2f65, 0x1769, 0x2264,
+	    0x2da1, 0x34b4, 0x0fe5, 0x46e5, 0x21b4, 0x3b16, 0x082f, 0x3030,
+	    0x2f4f, 0x0000, 0x0000, 0x3120, 0x4a45, 0x120a, 0x04a5, 0x0bad,
+	    0x07d1, 0x366f, 0x36a9, 0x3c55, 0x2e1b, 0x3d3f, 0x4d13, 0x0000,
+	    0x4528, 0x404b, 0x0000, 0x092b, 0x0dc5, 0x0000, 0x0000, 0x0000,
+	    0x1cff, 0x2722, 0x367a, 0x3351, 0x18dc, 0x1198, 0x464d, 0x3725,
+	    0x3cf5, 0x4469, 0x0000, 0x0000, 0x2741, 0x0000, 0x1b1a, 0x0000,
+	    0x2416, 0x1c0a, 0x0000, 0x31d4, 0x2d8f, 0x0000, 0x467b, 0x2c19,
+	    0x0592, 0x07ef, 0x0c99, 0x0ab7, 0x1f4d, 0x474e, 0x25c2, 0x4a95,
+	    0x2b1e, 0x0719, 0x360d, 0x4d40, 0x044a, 0x0000, 0x4128, 0x1d39,
+	    0x2d43, 0x0000, 0x0000, 0x0aa3, 0x2ad3, 0x3f1f, 0x0b94, 0x0000,
+	    0x0000, 0x3b7f, 0x0000, 0x10a6, 0x4714, 0x48c0, 0x0000, 0x2dfa,
+	    0x0ef0, 0x4ca6, 0x438e, 0x21c4, 0x14ec, 0x0121, 0x0000, 0x2180,
+	    0x0000, 0x1ab7, 0x1a64, 0x3491, 0x0000, 0x03ee, 0x1ace, 0x4ae2,
+	    0x1451, 0x0281, 0x0000, 0x41bd, 0x0000, 0x33b9, 0x3ee6, 0x4db0,
+	    0x14fa, 0x01c6, 0x02f8, 0x2d24, 0x3182, 0x302b, 0x031a, 0x0000,
+	    0x0000, 0x2470, 0x217f, 0x37a8, 0x3ed7, 0x0fc4, 0x338a, 0x3057,
+	    0x3178, 0x2c22, 0x2be1, 0x3a59, 0x2f9d, 0x1cd2, 0x35d6, 0x1a7c,
+	    0x1bff, 0x0000, 0x3fd3, 0x25ee, 0x0012, 0x3610, 0x0105, 0x230d,
+	    0x0465, 0x4463, 0x0000, 0x1fa4, 0x0000, 0x0000, 0x07b6, 0x4990,
+	    0x427f, 0x2d70, 0x0000, 0x0000, 0x3baa, 0x2a95, 0x2c36, 0x1275,
+	    0x17bf, 0x3def, 0x0000, 0x12bf, 0x0000, 0x0000, 0x06b2, 0x08bd,
+	    0x4723, 0x49de, 0x38d3, 0x0062, 0x0000, 0x004a, 0x1eb8, 0x0000,
+	    0x2896, 0x0bb8, 0x3cf1, 0x0000, 0x054a, 0x14b0, 0x1e60, 0x371a,
+	    0x0acb, 0x1b91, 0x2894, 0x04a8, 0x1c33, 0x1fe5, 0x0000, 0x212b,
+	    0x0600, 0x1830, 0x0879, 0x14b9, 0x0000, 0x2650, 0x0000, 0x0000,
+	    0x4035, 0x0000, 0x46ea, 0x26c9, 0x1612, 0x0000, 0x3d18, 0x0407,
+	    0x01f1, 0x0000, 0x1bd2, 0x1fb6, 0x08c0, 0x0000, 0x06a7, 0x0000,
+	    0x14f0, 0x0000, 0x26fc, 0x0000, 0x18b2, 0x0221, 0x0000, 0x0af7,
+	    0x05fc, 0x35c3, 0x2bce, 0x2fb6, 0x3086, 0x0333, 0x0000, 0x334b,
+	    0x0000, 0x47a7, 0x3d38, 0x0000, 0x191e, 0x0c44, 0x463b, 0x18aa,
+	    0x0000, 0x46bf, 0x43a2, 0x1581, 0x32a0, 0x0000, 0x00b4, 0x0000,
+	    0x042a, 0x21a8, 0x361a, 0x2a33, 0x0000, 0x0000, 0x0ece, 0x0000,
+	    0x1c1f, 0x345e, 0x269a, 0x2447, 0x44ab, 0x368b, 0x196c, 0x206c,
+	    0x0000, 0x0000, 0x3047, 0x2d92, 0x1e4a, 0x1ded, 0x1e69, 0x1351,
+	    0x1e34, 0x0000, 0x28d6, 0x0000, 0x2251, 0x1b83, 0x261d, 0x1fed,
+	    0x0000, 0x0833, 0x1b28, 0x0000, 0x0000, 0x0000, 0x27e6, 0x0000,
+	    0x0825, 0x1c2c, 0x42c3, 0x308d, 0x1137, 0x3c25, 0x24be, 0x4099,
+	    0x0000, 0x4412, 0x0000, 0x092e, 0x410a, 0x0000, 0x2300, 0x0000,
+	    0x33e3, 0x0000, 0x1878, 0x12af, 0x2fc4, 0x0000, 0x3782, 0x04c8,
+	    0x0000, 0x0000, 0x042a, 0x3d5f, 0x0000, 0x0000, 0x3961, 0x2215,
+	    0x0143, 0x149a, 0x27e2, 0x2065, 0x1da4, 0x3529, 0x0789, 0x1d6e,
+	    0x36bf, 0x3066, 0x0b1a, 0x11af, 0x30eb, 0x0000, 0x0000, 0x2254,
+	    0x1126, 0x0000, 0x4dc5, 0x12be, 0x0000, 0x0243, 0x0000, 0x0000,
+	    0x352e, 0x1ba3, 0x0000, 0x4c4d, 0x0000, 0x0235, 0x0000, 0x1e94,
+	    0x0923, 0x145b, 0x03ba, 0x2a33, 0x3588, 0x34fc, 0x0000, 0x106a,
+	    0x1967, 0x0000, 0x2c49, 0x476b, 0x1f52, 0x448a, 0x0b6d, 0x4bcd,
+	    0x22f6, 0x0000, 0x387f, 0x0000, 0x2cd2, 0x1630, 0x305b, 0x0000,
+	    0x3da6, 0x0e7e, 0x4591, 0x0000, 0x0000, 0x1fb8, 0x0000, 0x4603,
+	    0x2238, 0x1778, 0x1acb, 0x0000, 0x19dd, 0x4b73, 0x0e6c, 0x4a82,
+	    0x4de5, 0x1a85, 0x0a83, 0x1f68, 0x0000, 0x331d, 0x2fdf, 0x0000,
+	    0x20aa, 0x0000, 0x0317, 0x0000, 0x1b36, 0x19bf, 0x0082, 0x38b2,
+	    0x0984, 0x0c5c, 0x0000, 0x388e, 0x3c69, 0x1667, 0x14ed, 0x12b1,
+	    0x2673, 0x4599, 0x48a6, 0x1eb9, 0x237c, 0x03a6, 0x0068, 0x0000,
+	    0x045b, 0x0000, 0x05e9, 0x209c, 0x419d, 0x1f51, 0x00e3, 0x0b6e,
+	    0x0000, 0x4b87, 0x0000, 0x3929, 0x061d, 0x0000, 0x40c7, 0x0000,
+	    0x1a8f, 0x0000, 0x3bcb, 0x298b, 0x30ed, 0x0000, 0x04bb, 0x3a02,
+	    0x0000, 0x3d8d, 0x00c5, 0x0000, 0x0c67, 0x32ef, 0x09ac, 0x0000,
+	    0x013b, 0x0000, 0x423e, 0x0000, 0x4d7a, 0x07b7, 0x153b, 0x129f,
+	    0x2f71, 0x453a, 0x3648, 0x03a4, 0x0000, 0x0000, 0x2db7, 0x197e,
+	    0x229d, 0x336f, 0x052b, 0x21df, 0x0000, 0x1903, 0x0000, 0x0000,
+	    0x4542, 0x0960, 0x344c, 0x23ca, 0x367f, 0x0000, 0x2bc1, 0x03c5,
+	    0x20ea, 0x0d72, 0x3cd3, 0x2062, 0x4ba3, 0x2d09, 0x4c27, 0x1070,
+	    0x48bc, 0x2a86, 0x0000, 0x0d61, 0x1a3f, 0x0000, 0x00cf, 0x3805,
+	    0x3959, 0x0503, 0x0000, 0x1dd8, 0x0000, 0x4d2c, 0x0e18, 0x198c,
+	    0x0000, 0x2de5, 0x4419, 0x1b9d, 0x0000, 0x2b25, 0x0000, 0x4152,
+	    0x0000, 0x0000, 0x4bcf, 0x4ca3, 0x0ad3, 0x08c1, 0x14d0, 0x375e,
+	    0x2a43, 0x1645, 0x0000, 0x0000, 0x2c83, 0x0000, 0x27eb, 0x4155,
+	    0x01bd, 0x0000, 0x2285, 0x14ff, 0x1bc2, 0x0000, 0x2dff, 0x0000,
+	    0x34de, 0x35c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1495, 0x3caf,
+	    0x1b8a, 0x19a6, 0x0138, 0x2fe1, 0x3907, 0x0000, 0x0000, 0x0000,
+	    0x2f28, 0x0a94, 0x0894, 0x18db, 0x0000, 0x2d55, 0x0000, 0x14d5,
+	    0x4449, 0x459a, 0x4774, 0x1ab1, 0x2c04, 0x30d9, 0x1aa3, 0x0000,
+	    0x0000, 0x1d6c, 0x46d1, 0x2fdf, 0x0000, 0x0a8f, 0x4c55, 0x3bd0,
+	    0x0000, 0x3adf, 0x0a2a, 0x471b, 0x2b42, 0x49dc, 0x127a, 0x0000,
+	    0x1af4, 0x0000, 0x0000, 0x0000, 0x1958, 0x0f34, 0x13d8, 0x0136,
+	    0x4c6c, 0x42d0, 0x07ae, 0x3614, 0x1b32, 0x1e91, 0x0000, 0x46fd,
+	    0x45d7, 0x0aae, 0x0000, 0x159c, 0x0bea, 0x332b, 0x0000, 0x1b3f,
+	    0x3751, 0x4368, 0x193e, 0x106d, 0x1b94, 0x0000, 0x1dab, 0x086a,
+	    0x0017, 0x1abf, 0x3e7e, 0x0000, 0x0d5d, 0x0000, 0x49a0, 0x1dc1,
+	    0x2ad7, 0x37da, 0x4850, 0x238e, 0x39ad, 0x0000, 0x2bd6, 0x42f0,
+	    0x1502, 0x1b5e, 0x3465, 0x433b, 0x04c0, 0x466b, 0x1c2a, 0x25ae,
+	    0x2047, 0x43ca, 0x25e1, 0x3094, 0x1653, 0x0000, 0x3535, 0x1cfc,
+	    0x0000, 0x0000, 0x0000, 0x2bbf, 0x0a19, 0x2a9f, 0x2dcc, 0x444c,
+	    0x0000, 0x2acc, 0x3d7b, 0x25ff, 0x0000, 0x0000, 0x43d6, 0x487a,
+	    0x0000, 0x21b9, 0x07ab, 0x0b75, 0x1659, 0x0000, 0x0000, 0x0000,
+	    0x28a8, 0x0a0f, 0x2444, 0x30ef, 0x4954, 0x3db8, 0x1aef, 0x25e7,
+	    0x2f48, 0x261b, 0x3237, 0x33c3, 0x32ac, 0x4dee, 0x0000, 0x32fb,
+	    0x0f0e, 0x0000, 0x139d, 0x0000, 0x36de, 0x0000, 0x08fa, 0x3302,
+	    0x0000, 0x0000, 0x3a68, 0x0000, 0x1464, 0x0d26, 0x0000, 0x0000,
+	    0x168c, 0x47e9, 0x0000, 0x0000, 0x465d, 0x0000, 0x48f3, 0x2b49,
+	    0x05d9, 0x0000, 0x134d, 0x13c3, 0x0000, 0x0000, 0x0000, 0x2a0e,
+	    0x0000, 0x35c0, 0x0532, 0x0dff, 0x0103, 0x4382, 0x0000, 0x2f23,
+	    0x2d99, 0x2bcc, 0x33d6, 0x0000, 0x2566, 0x3209, 0x2fad, 0x1ae9,
+	    0x39f9, 0x0000, 0x274f, 0x0000, 0x1bc8, 0x038c, 0x48be, 0x1b5d,
+	    0x28bd, 0x0000, 0x118a, 0x3f05, 0x0000, 0x221d, 0x35e4, 0x353f,
+	    0x0f76, 0x0e55, 0x119e, 0x2bb7, 0x1220, 0x2434, 0x3ed2, 0x0000,
+	    0x3367, 0x2a0e, 0x0000, 0x3bfe, 0x2c6a, 0x1585, 0x372d, 0x0000,
+	    0x0000, 0x4490, 0x3e5e, 0x0000, 0x0000, 0x0c7b, 0x05bf, 0x0000,
+	    0x0000, 0x4aad, 0x0000, 0x02dd, 0x0000, 0x09af, 0x0000, 0x3314,
+	    0x2f4c, 0x3174, 0x023b, 0x2d35, 0x0000, 0x0000, 0x0766, 0x0819,
+	    0x4457, 0x17a0, 0x0000, 0x3639, 0x0000, 0x0000, 0x2ef2, 0x125f,
+	    0x4674, 0x0000, 0x0bfb, 0x1a82, 0x4268, 0x0000, 0x42bf, 0x0000,
+	    0x0000, 0x278d, 0x2a47, 0x0000, 0x35f3, 0x401b, 0x1fbe, 0x19c8,
+	    0x3888, 0x093c, 0x0000, 0x05b4, 0x1c9c, 0x20c4, 0x0747, 0x4537,
+	    0x103b, 0x499b, 0x47f8, 0x4379, 0x0000, 0x470c, 0x1ac4, 0x1d84,
+	    0x0000, 0x44cb, 0x1bf0, 0x2212, 0x34d3, 0x0000, 0x0000, 0x4612,
+	    0x0000, 0x2a18, 0x0000, 0x2f9c, 0x0000, 0x02f8, 0x0000, 0x20ae,
+	    0x414a, 0x4678, 0x0000, 0x0000, 0x0000, 0x36db, 0x0000, 0x0000,
+	    0x0b79, 0x0000, 0x4591, 0x1f48, 0x170d, 0x2060, 0x39eb, 0x0000,
+	    0x3f00, 0x4348, 0x3718, 0x0a53, 0x2df1, 0x11f5, 0x041d, 0x4ac8,
+	    0x0000, 0x09cb, 0x2b48, 0x322f, 0x0000, 0x236a, 0x2a80, 0x00ac,
+	    0x3d6a, 0x1557, 0x45d8, 0x0000, 0x1e4f, 0x0000, 0x4bad, 0x2619,
+	    0x32f2, 0x0000, 0x2c0d, 0x0000, 0x17d5, 0x44df, 0x4ad7, 0x3266,
+	    0x2075, 0x37f7, 0x2359, 0x4de0, 0x08bf, 0x28c4, 0x104d, 0x1855,
+	    0x3808, 0x16b8, 0x0000, 0x32f8, 0x2f0e, 0x0000, 0x0df7, 0x4a4c,
+	    0x170d, 0x1dd7, 0x16e7, 0x1c90, 0x0584, 0x25d7, 0x4b69, 0x09b1,
+	    0x49d3, 0x12d4, 0x1393, 0x2e85, 0x1fe0, 0x2b78, 0x2202, 0x0313,
+	    0x0000, 0x0000, 0x25b4, 0x4d79, 0x3008, 0x43f8, 0x4a00, 0x0000,
+	    0x4008, 0x37b2, 0x0000, 0x0000, 0x1cca, 0x41a5, 0x1732, 0x3590,
+	    0x0000, 0x04ec, 0x1145, 0x1076, 0x0000, 0x0000, 0x386c, 0x1989,
+	    0x271b, 0x368f, 0x3c4b, 0x48d2, 0x0ea1, 0x46db, 0x242f, 0x0000,
+	    0x0108, 0x396f, 0x0ff1, 0x2250, 0x0017, 0x3ad5, 0x11f0, 0x46e3,
+	    0x23fb, 0x2e5f, 0x144a, 0x283e, 0x3e18, 0x2d90, 0x0000, 0x4175,
+	    0x1586, 0x1428, 0x0000, 0x3f02, 0x0000, 0x4598, 0x21b9, 0x3443,
+	    0x21e2, 0x0e75, 0x0000, 0x0000, 0x013e, 0x2473, 0x0000, 0x1f36,
+	    0x0000, 0x3720, 0x1d66, 0x0000, 0x3ca5, 0x4530, 0x0000, 0x1599,
+	    0x3c02, 0x49fb, 0x2131, 0x053d, 0x05cf, 0x4dd4, 0x0412, 0x0000,
+	    0x02fe, 0x3646, 0x0000, 0x3845, 0x0000, 0x3753, 0x0000, 0x2153,
+	    0x3ce4, 0x0000, 0x0000, 0x49d6, 0x2f85, 0x0924, 0x4576, 0x031f,
+	    0x0968, 0x0000, 0x0b61, 0x4268, 0x0000, 0x0000, 0x138a, 0x4d03,
+	    0x4337, 0x4c92, 0x39d7, 0x0185, 0x1f11, 0x113b, 0x2fcc, 0x19f6,
+	    0x1ae2, 0x013e, 0x0000, 0x4cc6, 0x46e3, 0x0988, 0x0000, 0x007e,
+	    0x09f7, 0x2417, 0x223e, 0x27b4, 0x3f85, 0x4af1, 0x3147, 0x0c9e,
+	    0x138a, 0x0000, 0x2cd6, 0x10dd, 0x3111, 0x1849, 0x26f3, 0x0000,
+	    0x4d8a, 0x334f, 0x304d, 0x0000, 0x456a, 0x2b15, 0x3295, 0x0000,
+	    0x1dbf, 0x3e0a, 0x17e9, 0x3034, 0x427c, 0x3f73, 0x28ee, 0x0000,
+	    0x3cb1, 0x318f, 0x2d8c, 0x4dd0, 0x1436, 0x4c0c, 0x0971, 0x0000,
+	    0x1254, 0x2972, 0x2de6, 0x2296, 0x17c5, 0x2829, 0x1e4d, 0x02e4,
+	    0x070e, 0x27d4, 0x2a11, 0x0000, 0x234a, 0x10a9, 0x3c5c, 0x1a34,
+	    0x0bf4, 0x0c2d, 0x2c58, 0x0dfd, 0x1fc1, 0x0784, 0x45d8, 0x0ff2,
+	    0x0263, 0x48b1, 0x1bb3, 0x2ffb, 0x301b, 0x29f5, 0x47e1, 0x0c6f,
+	    0x0000, 0x0000, 0x44e5, 0x4ce6, 0x4c8d, 0x0000, 0x4b64, 0x186b,
+	    0x0000, 0x0000, 0x2f6f, 0x39df, 0x0f60, 0x2671, 0x0000, 0x26c6,
+	    0x0000, 0x073b, 0x215d, 0x12be, 0x12e4, 0x0000, 0x1a9c, 0x0000,
+	    0x0000, 0x0000, 0x2f7d, 0x3b23, 0x36d8, 0x2ee1, 0x0db7, 0x0533,
+	    0x1c5d, 0x4361, 0x3d88, 0x2f8d, 0x3a09, 0x41ce, 0x3a69, 0x22a1,
+	    0x1360, 0x01c9, 0x00ff, 0x13d6, 0x0000, 0x10ec, 0x22b1, 0x0000,
+	    0x0000, 0x331b, 0x35c7, 0x254b, 0x3b57, 0x03d2, 0x3540, 0x4dfd,
+	    0x40da, 0x1c14, 0x0c2c, 0x0cba, 0x2ced, 0x0000, 0x4bdf, 0x194f,
+	    0x08b0, 0x2a1f, 0x271a, 0x1388, 0x3f9b, 0x00e7, 0x26b7, 0x0322,
+	    0x0000, 0x0000, 0x0ac7, 0x3e75, 0x2d32, 0x31ea, 0x03c5, 0x0dbf,
+	    0x4438, 0x4759, 0x0e47, 0x1334, 0x38cf, 0x1013, 0x3fcf, 0x10a1,
+	    0x4777, 0x072e, 0x108f, 0x2c1a, 0x0000, 0x4554, 0x3f4d, 0x0000,
+	    0x2702, 0x2a7d, 0x427d, 0x4ab9, 0x3351, 0x0000, 0x0833, 0x19b2,
+	    0x3799, 0x2334, 0x10ab, 0x441b, 0x0000, 0x0000, 0x0000, 0x45d7,
+	    0x0000, 0x4b49, 0x0000, 0x0000, 0x066b, 0x4552, 0x1e52, 0x1176,
+	    0x4a1b, 0x30f1, 0x2bdc, 0x4217, 0x090a, 0x4337, 0x46ee, 0x3586,
+	    0x0000, 0x0127, 0x378a, 0x08bc, 0x134d, 0x0539, 0x1843, 0x0f50,
+	    0x3abd, 0x1ff1, 0x0000, 0x0995, 0x0000, 0x100b, 0x2648, 0x4ac1,
+	    0x1834, 0x121f, 0x0000, 0x0000, 0x4a91, 0x49cd, 0x135c, 0x0000,
+	    0x0d68, 0x118b, 0x0000, 0x0e6a, 0x0044, 0x3e55, 0x321c, 0x4062,
+	    0x1c1e, 0x325d, 0x0000, 0x378b, 0x2c13, 0x2d36, 0x42ed, 0x1f8c,
+	    0x46d6, 0x0446, 0x4adc, 0x0000, 0x31e1, 0x05fc, 0x0000, 0x0000,
+	    0x3203, 0x0000, 0x06de, 0x0000, 0x0107, 0x1bfe, 0x27d9, 0x0000,
+	    0x3ce0, 0x02b2, 0x1e83, 0x1021, 0x0de4, 0x0750, 0x4d76, 0x2e66,
+	    0x1e2a, 0x0000, 0x0192, 0x479d, 0x0000, 0x1c81, 0x0000, 0x0000,
+	    0x0000, 0x2852, 0x15be, 0x3e37, 0x332d, 0x4a1b, 0x0000, 0x0000,
+	    0x4d74, 0x0000, 0x303e, 0x1756, 0x470d, 0x2a85, 0x27ef, 0x3883,
+	    0x1ad5, 0x10bf, 0x383b, 0x0000, 0x3ad6, 0x0000, 0x0b01, 0x0000,
+	    0x4b22, 0x0000, 0x398f, 0x2700, 0x48d0, 0x0000, 0x09dc, 0x313b,
+	    0x46a8, 0x343d, 0x46da, 0x081a, 0x1062, 0x38e6, 0x0000, 0x11a2,
+	    0x0000, 0x2244, 0x0000, 0x0000, 0x2b5d, 0x0000, 0x0000, 0x2e07,
+	    0x30c3, 0x153a, 0x1bbf, 0x3eb8, 0x1c79, 0x0e5e, 0x2c6f, 0x0000,
+	    0x25a9, 0x254d, 0x2211, 0x0000, 0x243f, 0x0090, 0x4310, 0x0000,
+	    0x0165, 0x2d27, 0x15c7, 0x17a9, 0x099c, 0x3320, 0x394a, 0x3f97,
+	    0x0000, 0x295c, 0x30e1, 0x0000, 0x240f, 0x4877, 0x0000, 0x3cd9,
+	    0x1298, 0x33f8, 0x1208, 0x2140, 0x449e, 0x298e, 0x17ef, 0x1ed5,
+	    0x03f6, 0x01af, 0x2b99, 0x0000, 0x0de2, 0x4321, 0x0206, 0x1469,
+	    0x251d, 0x42a4, 0x265a, 0x0000, 0x2f3a, 0x34ec, 0x2e9b, 0x0000,
+	    0x0000, 0x22d3, 0x0278, 0x2628, 0x052f, 0x32d7, 0x0000, 0x28c9,
+	    0x0000, 0x4d9b, 0x0000, 0x0000, 0x0000, 0x0d7e, 0x0000, 0x2815,
+	    0x2eb6, 0x11dd, 0x39c1, 0x0000, 0x0000, 0x35b0, 0x3e26, 0x0000,
+	    0x1982, 0x0000, 0x0eb6, 0x31b9, 0x0f83, 0x389b, 0x0000, 0x19c9,
+	    0x2559, 0x065c, 0x069e, 0x16ab, 0x3ac1, 0x0000, 0x4bd0, 0x4af8,
+	    0x09df, 0x2be8, 0x0000, 0x0012, 0x427e, 0x0917, 0x0000, 0x27ef,
+	    0x0000, 0x3bd1, 0x4418, 0x39d6, 0x0000, 0x2143, 0x0c03, 0x0186,
+	    0x1ff0, 0x45f5, 0x13f2, 0x0000, 0x0f70, 0x3c57, 0x4b41, 0x0000,
+	    0x1578, 0x0b63, 0x2e00, 0x4d02, 0x435c, 0x2182, 0x26a0, 0x0a17,
+	    0x2cd1, 0x4b5a, 0x2ebc, 0x3830, 0x176e, 0x4012, 0x0b34, 0x0c41,
+	    0x016b, 0x21f3, 0x0000, 0x2d3d, 0x3269, 0x46c8, 0x2b30, 0x1deb,
+	    0x0000, 0x469f, 0x0000, 0x35d4, 0x4965, 0x0cf3, 0x0000, 0x347f,
+	    0x4557, 0x0000, 0x0000, 0x40ff, 0x4df8, 0x1a78, 0x36c9, 0x0000,
+	    0x0d4b, 0x4862, 0x0000, 0x0303, 0x057c, 0x4483, 0x3845, 0x461d,
+	    0x0000, 0x4337, 0x408b, 0x08c2, 0x4c12, 0x4365, 0x0000, 0x486f,
+	    0x2824, 0x096a, 0x4cf0, 0x00d9, 0x456b, 0x47d2, 0x42aa, 0x2e59,
+	    0x1c69, 0x0000, 0x0000, 0x3fff, 0x35f8, 0x228a, 0x4357, 0x3471,
+	    0x0f90, 0x0000, 0x22ea, 0x2c23, 0x085c, 0x1e39, 0x05ab, 0x1f6c,
+	    0x33a4, 0x0a73, 0x0000, 0x3a95, 0x1a3e, 0x0000, 0x19c8, 0x33da,
+	    0x08c3, 0x0443, 0x1b30, 0x0734, 0x2a73, 0x0879, 0x3d13, 0x3433,
+	    0x2ff7, 0x0000, 0x47fc, 0x28dc, 0x0000, 0x3736, 0x2dbf, 0x3ef6,
+	    0x0000, 0x1b43, 0x1d56, 0x0c6a, 0x0882, 0x3307, 0x3359, 0x27c0,
+	    0x20cb, 0x3e0e, 0x2a14, 0x1cb9, 0x159a, 0x0000, 0x3e5c, 0x1662,
+	    0x0777, 0x1659, 0x0000, 0x2740, 0x0000, 0x0000, 0x00ec, 0x4db7,
+	    0x08e6, 0x1d40, 0x23a2, 0x4c9a, 0x07e0, 0x0d5e, 0x0000, 0x34f9,
+	    0x0512, 0x3bfb, 0x46c4, 0x3a6c, 0x0811, 0x024e, 0x0000, 0x43ef,
+	    0x4c15, 0x40a6, 0x0805, 0x2a29, 0x0433, 0x332c, 0x0000, 0x3c1f,
+	    0x14d3, 0x37c4, 0x2c07, 0x2a35, 0x0000, 0x0000, 0x0000, 0x24d6,
+	    0x140e, 0x0909, 0x2d10, 0x0000, 0x1055, 0x0000, 0x3a23, 0x2c51,
+	    0x1e55, 0x0000, 0x21c5, 0x2996, 0x3aac, 0x240f, 0x2dbe, 0x44e4,
+	    0x0000, 0x0000, 0x223c, 0x38a9, 0x3d1c, 0x0000, 0x0b29, 0x23cf,
+	    0x06eb, 0x4471, 0x0ac5, 0x122c, 0x0b99, 0x09b3, 0x2b41, 0x06d8,
+	    0x0000, 0x380b, 0x1311, 0x0000, 0x089a, 0x0000, 0x1bb5, 0x2c2e,
+	    0x34cf, 0x24f5, 0x0b5e, 0x3dcc, 0x331c, 0x38c8, 0x3485, 0x3b7c,
+	    0x3fb1, 0x41a0, 0x3c44, 0x1d1e, 0x0355, 0x357d, 0x006c, 0x2e88,
+	    0x2ce3, 0x3fd2, 0x44f1, 0x3400, 0x0000, 0x0888, 0x0000, 0x0000,
+	    0x0000, 0x3fa5, 0x03db, 0x12cd, 0x2b7c, 0x1c43, 0x05c0, 0x20cf,
+	    0x2a02, 0x2101, 0x0fbd, 0x10ba, 0x05e1, 0x3698, 0x007c, 0x2494,
+	    0x0000, 0x0000, 0x0000, 0x3d21, 0x0000, 0x4486, 0x2c40, 0x20bc,
+	    0x06f3, 0x026e, 0x4b6e, 0x0f5b, 0x0ef4, 0x0000, 0x2c56, 0x4414,
+	    0x0000, 0x0000, 0x2d08, 0x0000, 0x4108, 0x0000, 0x0fc6, 0x0462,
+	    0x0f6f, 0x1230, 0x07a5, 0x0000, 0x3e93, 0x367c, 0x2cfd, 0x0000,
+	    0x07ba, 0x0279, 0x4528, 0x25bd, 0x0000, 0x34de, 0x1ae2, 0x0000,
+	    0x2145, 0x1671, 0x0af9, 0x06d7, 0x0dba, 0x065f, 0x2bce, 0x0000,
+	    0x0595, 0x3793, 0x0000, 0x0000, 0x3b14, 0x2c28, 0x0439, 0x0000,
+	    0x0000, 0x0d31, 0x1a93, 0x1ade, 0x10a0, 0x0000, 0x11de, 0x4e06,
+	    0x0000, 0x2c8c, 0x0000, 0x16f6, 0x0000, 0x4797, 0x0000, 0x0000,
+	    0x49aa, 0x370f, 0x1a97, 0x0000, 0x0a4d, 0x2965, 0x2c93, 0x0000,
+	    0x399b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3842, 0x0000,
+	    0x31b6, 0x1a04, 0x4a76, 0x285a, 0x2297, 0x0000, 0x0000, 0x2ce1,
+	    0x0000, 0x0000, 0x4878, 0x3484, 0x277e, 0x0000, 0x2268, 0x0000,
+	    0x4718, 0x352f, 0x0180, 0x1c5f, 0x0000, 0x0000, 0x1576, 0x27d3,
+	    0x3714, 0x2993, 0x2de4, 0x0000, 0x491b, 0x0000, 0x0000, 0x303a,
+	    0x0000, 0x2e43, 0x16ba, 0x0000, 0x1ed1, 0x4de0, 0x0000, 0x4335,
+	    0x49e8, 0x0000, 0x0000, 0x0000, 0x0000, 0x2034, 0x0000, 0x0298,
+	    0x2f3e, 0x0000, 0x0000, 0x4711, 0x1ae7, 0x0000, 0x48bb, 0x293d,
+	    0x0000, 0x0000, 0x1654, 0x0959, 0x0000, 0x3fc4, 0x100a, 0x09e9,
+	    0x371c, 0x04b9, 0x0626, 0x1587, 0x0000, 0x1b13, 0x0e4d, 0x2918,
+	    0x463e, 0x2697, 0x0000, 0x204f, 0x0a88, 0x0298, 0x0a62, 0x2737,
+	    0x0000, 0x2ec4, 0x0000, 0x089e, 0x494b, 0x0000, 0x0ff2, 0x0000,
+	    0x1d52, 0x1a57, 0x341d, 0x4414, 0x4a3d, 0x3a52, 0x06b2, 0x42f2,
+	    0x195e, 0x0af9, 0x0fec, 0x4d17, 0x0000, 0x1c47, 0x1388, 0x3afd,
+	    0x1332, 0x45fe, 0x1620, 0x21a5, 0x400f, 0x30f2, 0x4dac, 0x0000,
+	    0x0000, 0x05f3, 0x0b2a, 0x3412, 0x0619, 0x4339, 0x3dcb, 0x3f21,
+	    0x429c, 0x4c19, 0x0000, 0x3ddf, 0x4d95, 0x0174, 0x3e94, 0x333d,
+	    0x1991, 0x0000, 0x32a3, 0x02fd, 0x10e5, 0x0a10, 0x0de0, 0x0000,
+	    0x0000, 0x035a, 0x39e3, 0x0d0f, 0x0000, 0x280b, 0x0783, 0x0000,
+	    0x46a8, 0x37a9, 0x15d4, 0x3307, 0x0e94, 0x1549, 0x0bf1, 0x0000,
+	    0x0199, 0x0000, 0x0000, 0x201c, 0x314a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x11dd, 0x0212, 0x0893, 0x17e3, 0x46d9, 0x4bcc, 0x0000,
+	    0x08ad, 0x0000, 0x0000, 0x08cd, 0x43e5, 0x3856, 0x46ef, 0x1e51,
+	    0x0d0b, 0x0678, 0x0000, 0x0000, 0x0b2e, 0x0000, 0x22e4, 0x26ef,
+	    0x4725, 0x4695, 0x09b5, 0x0bd0, 0x4daf, 0x2eb2, 0x35ed, 0x3e76,
+	    0x0afd, 0x25f8, 0x0000, 0x05b6, 0x2508, 0x2f1b, 0x1b1c, 0x25f3,
+	    0x0000, 0x0000, 0x0b7e, 0x356e, 0x2b8e, 0x0dfc, 0x4863, 0x0000,
+	    0x3b23, 0x0000, 0x1a08, 0x22dd, 0x090c, 0x3d69, 0x23aa, 0x0116,
+	    0x1197, 0x4138, 0x0d55, 0x0000, 0x1d5f, 0x0000, 0x07e3, 0x2e5e,
+	    0x0000, 0x1c69, 0x0000, 0x0a76, 0x24d9, 0x137c, 0x0000, 0x1ec1,
+	    0x2f8a, 0x0000, 0x0cd9, 0x2aff, 0x3f56, 0x2f60, 0x1adf, 0x253c,
+	    0x4075, 0x0000, 0x1ac9, 0x2cbf, 0x20ef, 0x3275, 0x1d02, 0x08a5,
+	    0x3c24, 0x001a, 0x2b3d, 0x399f, 0x2fc4, 0x081d, 0x0000, 0x152e,
+	    0x0000, 0x2d10, 0x3a17, 0x3ecc, 0x2dcd, 0x0000, 0x4326, 0x1ef7,
+	    0x0000, 0x0000, 0x3d20, 0x2f5d, 0x152e, 0x3901, 0x0000, 0x092e,
+	    0x3bea, 0x27f5, 0x2b96, 0x0000, 0x1e40, 0x3720, 0x0853, 0x37e0,
+	    0x0000, 0x46a5, 0x0d58, 0x40ee, 0x2b1b, 0x0000, 0x0893, 0x18d7,
+	    0x0000, 0x1ae3, 0x3991, 0x3a51, 0x42c3, 0x070a, 0x0000, 0x23ac,
+	    0x0000, 0x0550, 0x0000, 0x18c5, 0x446c, 0x0b98, 0x0000, 0x30c1,
+	    0x0000, 0x0d30, 0x3783, 0x0000, 0x3df4, 0x3373, 0x44c4, 0x180a,
+	    0x3d96, 0x4bca, 0x0000, 0x31f8, 0x2d71, 0x0000, 0x2894, 0x18b7,
+	    0x1aa5, 0x0000, 0x02a5, 0x14c8, 0x33d7, 0x2393, 0x0f9e, 0x2f47,
+	    0x3911, 0x0000, 0x0000, 0x423a, 0x1733, 0x2d66, 0x19e8, 0x0000,
+	    0x4c02, 0x0056, 0x2d6d, 0x167c, 0x30b5, 0x0000, 0x0480, 0x2403,
+	    0x0763, 0x0dfe, 0x071c, 0x3ac0, 0x1448, 0x0412, 0x25e1, 0x0ec8,
+	    0x0000, 0x151d, 0x3ca8, 0x2b98, 0x234c, 0x0000, 0x2b56, 0x0c2e,
+	    0x3d55, 0x3d7d, 0x3352, 0x1cee, 0x1b91, 0x1a8b, 0x0971, 0x2922,
+	    0x0400, 0x49eb, 0x0000, 0x315c, 0x4ab1, 0x13df, 0x268c, 0x0000,
+	    0x0000, 0x3d51, 0x035f, 0x09e5, 0x2c0c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x1e46, 0x16dc, 0x2972, 0x3d5a, 0x1385, 0x43ed, 0x0000,
+	    0x03f4, 0x022e, 0x06aa, 0x11d7, 0x2de9, 0x0000, 0x24da, 0x3d9b,
+	    0x4912, 0x2753, 0x1e06, 0x0af5, 0x0117, 0x19e5, 0x1a9f, 0x1400,
+	    0x4a93, 0x4d1d, 0x0000, 0x1c59, 0x3fe7, 0x0000, 0x2a75, 0x0000,
+	    0x0927, 0x073a, 0x222f, 0x0000, 0x0000, 0x2a27, 0x0000, 0x1f97,
+	    0x0000, 0x011f, 0x0ebb, 0x2977, 0x49ac, 0x0000, 0x49b8, 0x4a56,
+	    0x24a3, 0x0833, 0x2332, 0x40ce, 0x4055, 0x416c, 0x0000, 0x4d48,
+	    0x0000, 0x0191, 0x3b1d, 0x4b3c, 0x1e67, 0x19b1, 0x0000, 0x05a6,
+	    0x35b9, 0x0000, 0x0000, 0x41a0, 0x4961, 0x2747, 0x0000, 0x0000,
+	    0x3ecf, 0x0000, 0x3e67, 0x3f9f, 0x0000, 0x0000, 0x019f, 0x150b,
+	    0x3f42, 0x2a3c, 0x3251, 0x0c1e, 0x0000, 0x415e, 0x0b52, 0x06db,
+	    0x4c20, 0x0022, 0x3ea3, 0x0fcc, 0x0000, 0x2294, 0x385a, 0x330d,
+	    0x0000, 0x11fb, 0x0000, 0x0000, 0x3387, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x3a2f, 0x4b57, 0x44f2, 0x0000, 0x22c5, 0x16a5, 0x0000,
+	    0x0000, 0x0000, 0x2e94, 0x0000, 0x0c05, 0x1e65, 0x3aa3, 0x0000,
+	    0x1768, 0x1f12, 0x3bfd, 0x3210, 0x44f7, 0x41d9, 0x4dd8, 0x0000,
+	    0x0c08, 0x1a3c, 0x1892, 0x0dce, 0x322f, 0x3f4c, 0x0000, 0x2250,
+	    0x0000, 0x47b9, 0x1dd6, 0x30a0, 0x0918, 0x0000, 0x48e8, 0x4d06,
+	    0x0000,
+	};
+	uint16_t h[8];
+
+	mi_wyhash4(key, keylen, UINT64_C(0x4db127f812200854), (uint64_t*)h);
+
+	h[0] = h[0] % 24801;
+	h[1] = h[1] % 24801;
+	h[2] = h[2] % 24801;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 20000;
+}
@@ -0,0 +1,175 @@
+/* generated with rurban/nbperf 08a5797 -p _words1000 */
+/* seed[0]: 16, seed[1]: 17 */
+#include <stdint.h>
+#include "mi_wyhash.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[1241] = {
+	    0x0133, 0x0000, 0x0255, 0x036c, 0x0000, 0x006d, 0x007f, 0x0000,
+	    0x00e8, 0x0000, 0x0067, 0x038e, 0x013b, 0x00c5, 0x02b3, 0x004e,
+	    0x0000, 0x037a, 0x0090, 0x0000, 0x0077, 0x034d, 0x023d, 0x039b,
+	    0x0391, 0x00e0, 0x012a, 0x0086, 0x021b, 0x0000, 0x023b, 0x0318,
+	    0x01e7, 0x0000, 0x01e0, 0x0178, 0x00dc, 0x00a4, 0x01b9, 0x0000,
+	    0x0046, 0x0198, 0x0360, 0x016a, 0x0057, 0x03bf, 0x0218, 0x00d3,
+	    0x0000, 0x0000, 0x03c9, 0x0069, 0x0142, 0x0000, 0x01c1, 0x00b1,
+	    0x0000, 0x008f, 0x0093, 0x02ed, 0x0000, 0x026a, 0x0297, 0x0000,
+	    0x0358, 0x01c7, 0x029f, 0x02de, 0x0222, 0x0395, 0x033d, 0x0094,
+	    0x0000, 0x001b, 0x008d, 0x0000, 0x03da, 0x02e9, 0x0000, 0x0028,
+	    0x01b3, 0x03ca, 0x0152, 0x01f9, 0x0343, 0x00cb, 0x0159, 0x0376,
+	    0x0111, 0x01b5, 0x0000, 0x0000, 0x0108, 0x0002, 0x017d, 0x0299,
+	    0x02cb, 0x01a2, 0x03ca, 0x03af, 0x0229, 0x0149, 0x02bc, 0x00cb,
+	    0x0000, 0x024a, 0x0130, 0x0000, 0x02f3, 0x02ed, 0x030a, 0x02a3,
+	    0x0280, 0x01b1, 0x02a6, 0x01d5, 0x0036, 0x0318, 0x02cd, 0x0000,
+	    0x01f0, 0x018d, 0x00e1, 0x0018, 0x028e, 0x019f, 0x0000, 0x030c,
+	    0x011f, 0x01f0, 0x0000, 0x00af, 0x0358, 0x0000, 0x0107, 0x011d,
+	    0x02a6, 0x00c2, 0x029c, 0x0000, 0x0020, 0x0240, 0x0322, 0x010d,
+	    0x01f9, 0x0275, 0x02b1, 0x01c3, 0x033b, 0x03c0, 0x018c, 0x024a,
+	    0x0000, 0x0252, 0x03df, 0x0155, 0x00ae, 0x022b, 0x0302, 0x030b,
+	    0x0134, 0x018c, 0x0000, 0x0000, 0x0000, 0x0003, 0x03b0, 0x018b,
+	    0x0187, 0x0000, 0x0100, 0x03bd, 0x028a, 0x00da, 0x02b7, 0x0334,
+	    0x02a6, 0x010a, 0x039f, 0x03e0, 0x0302, 0x01b5, 0x01ca, 0x0000,
+	    0x0000, 0x0000, 0x0192, 0x02c1, 0x01f1, 0x012a, 0x0117, 0x01c0,
+	    0x025a, 0x0000, 0x02f1, 0x013a, 0x008b, 0x032e, 0x00c1, 0x0000,
+	    0x0000, 0x0362, 0x037f, 0x0076, 0x02e1, 0x00d3, 0x0000, 0x0000,
+	    0x02ee, 0x037d, 0x01c8, 0x039e, 0x0120, 0x03d1, 0x03b5, 0x01fa,
+	    0x0347, 0x03d3, 0x0120, 0x0297, 0x0395, 0x00e3, 0x01c5, 0x03d0,
+	    0x035d, 0x0365, 0x0000, 0x02b9, 0x00dd, 0x0000, 0x0382, 0x0315,
+	    0x0169, 0x0099, 0x01c2, 0x008a, 0x00c0, 0x0000, 0x038f, 0x0000,
+	    0x02ee, 0x0233, 0x00e6, 0x024b, 0x017d, 0x0210, 0x030a, 0x03c3,
+	    0x0094, 0x0000, 0x01c0, 0x0162, 0x0035, 0x03b6, 0x00f3, 0x0072,
+	    0x0000, 0x0131, 0x0349, 0x0000, 0x0067, 0x0000, 0x0295, 0x007c,
+	    0x0000, 0x0017, 0x03e1, 0x019f, 0x0000, 0x02f0, 0x005d, 0x0346,
+	    0x01e6, 0x0133, 0x020a, 0x03d9, 0x0184, 0x0242, 0x00dc, 0x0000,
+	    0x0093, 0x0348, 0x00e3, 0x03c5, 0x0000, 0x00a9, 0x0248, 0x0000,
+	    0x0000, 0x0146, 0x03d4, 0x034a, 0x03e7, 0x0155, 0x01bc, 0x03a8,
+	    0x000b, 0x01bf, 0x0315, 0x0180, 0x0004, 0x031e, 0x01c7, 0x033b,
+	    0x00dd, 0x036a, 0x0000, 0x02c2, 0x0309, 0x0000, 0x0000, 0x0244,
+	    0x011c, 0x035d, 0x0382, 0x00fe, 0x0300, 0x027f, 0x00dc, 0x0158,
+	    0x021d, 0x0000, 0x0000, 0x011c, 0x038b, 0x00db, 0x02f3, 0x02b4,
+	    0x037b, 0x0194, 0x02ed, 0x0247, 0x0000, 0x019c, 0x0000, 0x0000,
+	    0x0194, 0x03e2, 0x036f, 0x0000, 0x017b, 0x014f, 0x031c, 0x0292,
+	    0x02b9, 0x03ca, 0x004c, 0x03b4, 0x0000, 0x0332, 0x0000, 0x03af,
+	    0x0105, 0x03e1, 0x0389, 0x0000, 0x0041, 0x0081, 0x00e8, 0x00ac,
+	    0x0099, 0x030a, 0x0279, 0x0233, 0x02df, 0x01dc, 0x00d2, 0x03ba,
+	    0x00cf, 0x01b7, 0x02be, 0x0000, 0x034c, 0x014b, 0x03c8, 0x0000,
+	    0x03dd, 0x0000, 0x006c, 0x0151, 0x0000, 0x02f3, 0x03ba, 0x01ab,
+	    0x0296, 0x0198, 0x0172, 0x0283, 0x0047, 0x019e, 0x0277, 0x028d,
+	    0x0280, 0x0087, 0x01fd, 0x034a, 0x01f8, 0x0122, 0x0203, 0x015a,
+	    0x026d, 0x0199, 0x03b3, 0x02d3, 0x01a8, 0x0000, 0x03bc, 0x0395,
+	    0x009c, 0x0000, 0x02a4, 0x0088, 0x0312, 0x0000, 0x02d7, 0x0147,
+	    0x02b1, 0x00d5, 0x023e, 0x0102, 0x010a, 0x001e, 0x015d, 0x0000,
+	    0x019c, 0x00e0, 0x0305, 0x0000, 0x03e6, 0x0000, 0x035a, 0x0000,
+	    0x0000, 0x00c3, 0x01c7, 0x00d5, 0x0198, 0x001d, 0x0035, 0x032d,
+	    0x01a8, 0x023f, 0x0000, 0x0000, 0x00a2, 0x01ac, 0x031d, 0x02f6,
+	    0x0155, 0x015f, 0x0000, 0x0000, 0x03b6, 0x0000, 0x0000, 0x0342,
+	    0x0386, 0x02e0, 0x03e4, 0x0000, 0x00b6, 0x0000, 0x0000, 0x0325,
+	    0x00fd, 0x0279, 0x00e1, 0x0214, 0x028c, 0x00cd, 0x02de, 0x0000,
+	    0x0127, 0x013d, 0x00d5, 0x01d8, 0x03b5, 0x00f0, 0x036d, 0x0000,
+	    0x027d, 0x0000, 0x01ef, 0x0000, 0x0000, 0x0050, 0x01c5, 0x0366,
+	    0x0049, 0x0189, 0x00a1, 0x033b, 0x0143, 0x0206, 0x0000, 0x0000,
+	    0x0298, 0x017b, 0x034f, 0x0395, 0x03de, 0x0000, 0x0014, 0x0248,
+	    0x027e, 0x0000, 0x0000, 0x00ad, 0x024e, 0x0000, 0x02ca, 0x01a3,
+	    0x025f, 0x0380, 0x00db, 0x0056, 0x012e, 0x0000, 0x029a, 0x009b,
+	    0x0036, 0x03a6, 0x0071, 0x03e3, 0x005f, 0x0000, 0x034c, 0x03b1,
+	    0x0000, 0x0209, 0x01ea, 0x0089, 0x01b3, 0x0150, 0x0179, 0x0368,
+	    0x02df, 0x0345, 0x0231, 0x0392, 0x00d6, 0x02ae, 0x0000, 0x035c,
+	    0x00de, 0x01e1, 0x017e, 0x0196, 0x0122, 0x036f, 0x0151, 0x00ee,
+	    0x03c5, 0x016e, 0x02c3, 0x0000, 0x0000, 0x00db, 0x0000, 0x02c0,
+	    0x021d, 0x000b, 0x0000, 0x0000, 0x03cf, 0x0000, 0x0047, 0x0388,
+	    0x0121, 0x00b3, 0x0000, 0x0156, 0x00a4, 0x027c, 0x02b0, 0x018b,
+	    0x0391, 0x0070, 0x01b5, 0x0322, 0x012b, 0x00bb, 0x0039, 0x00e6,
+	    0x0063, 0x0329, 0x002a, 0x0065, 0x0118, 0x03bf, 0x034f, 0x001d,
+	    0x00bd, 0x0221, 0x0223, 0x0000, 0x0000, 0x0254, 0x016a, 0x008f,
+	    0x013f, 0x0000, 0x0266, 0x0000, 0x0318, 0x01fb, 0x0177, 0x003e,
+	    0x026d, 0x0262, 0x0000, 0x00e2, 0x03d2, 0x01b2, 0x0396, 0x0007,
+	    0x01b8, 0x01a5, 0x0000, 0x00c7, 0x0395, 0x0069, 0x0000, 0x0388,
+	    0x0324, 0x0222, 0x03ba, 0x0033, 0x016f, 0x02b5, 0x0370, 0x000b,
+	    0x004b, 0x01f8, 0x0000, 0x0000, 0x03ce, 0x0000, 0x026d, 0x0006,
+	    0x0133, 0x02f6, 0x01a8, 0x0138, 0x0187, 0x03df, 0x01e6, 0x007e,
+	    0x0000, 0x01a7, 0x01f2, 0x0000, 0x0022, 0x0110, 0x0299, 0x0112,
+	    0x038e, 0x00ca, 0x0148, 0x01a8, 0x02bf, 0x02dd, 0x0386, 0x00b0,
+	    0x00e5, 0x015a, 0x013b, 0x016f, 0x0126, 0x0000, 0x0034, 0x013d,
+	    0x0396, 0x0195, 0x017e, 0x01bc, 0x00b6, 0x0130, 0x0000, 0x0059,
+	    0x0000, 0x025f, 0x02dd, 0x0000, 0x039f, 0x0000, 0x032e, 0x0301,
+	    0x0000, 0x037d, 0x00cd, 0x02e1, 0x039a, 0x0204, 0x0000, 0x0151,
+	    0x0000, 0x01e2, 0x011a, 0x0300, 0x0280, 0x0079, 0x0000, 0x032a,
+	    0x02f7, 0x0000, 0x01b4, 0x01d3, 0x0346, 0x0239, 0x0388, 0x0087,
+	    0x02c5, 0x0000, 0x01ff, 0x03d7, 0x02d3, 0x0237, 0x01b4, 0x019b,
+	    0x0151, 0x0399, 0x032d, 0x026d, 0x01d4, 0x023c, 0x0000, 0x0000,
+	    0x0322, 0x0215, 0x0189, 0x0000, 0x02ac, 0x03c2, 0x0000, 0x01fc,
+	    0x0000, 0x01ee, 0x00e8, 0x0000, 0x005e, 0x0170, 0x017c, 0x03dc,
+	    0x026d, 0x0317, 0x015b, 0x0297, 0x019d, 0x0039, 0x032a, 0x0323,
+	    0x0214, 0x0000, 0x01df, 0x0000, 0x0000, 0x0151, 0x03c6, 0x0203,
+	    0x03e1, 0x0371, 0x029f, 0x0240, 0x0000, 0x0000, 0x0000, 0x01e0,
+	    0x003c, 0x01d8, 0x00b7, 0x01a9, 0x00ca, 0x01c4, 0x00f3, 0x0000,
+	    0x010c, 0x0053, 0x017a, 0x0264, 0x0026, 0x00b4, 0x0227, 0x0000,
+	    0x0000, 0x0149, 0x011b, 0x0000, 0x0328, 0x0127, 0x0183, 0x0003,
+	    0x0190, 0x01a4, 0x0000, 0x0000, 0x002b, 0x0287, 0x0000, 0x0321,
+	    0x0018, 0x034e, 0x002a, 0x0000, 0x0165, 0x0000, 0x03a8, 0x0294,
+	    0x02f8, 0x0180, 0x01b6, 0x01bd, 0x00ae, 0x0000, 0x00a9, 0x024f,
+	    0x0000, 0x0332, 0x0077, 0x0140, 0x0232, 0x0000, 0x033f, 0x0000,
+	    0x021c, 0x0201, 0x0356, 0x0241, 0x03d3, 0x005b, 0x0049, 0x017b,
+	    0x0279, 0x0000, 0x02fa, 0x03e2, 0x02f4, 0x00c3, 0x0000, 0x01c1,
+	    0x0214, 0x02f8, 0x00a7, 0x00bc, 0x0345, 0x002b, 0x0117, 0x0244,
+	    0x0000, 0x0300, 0x01b4, 0x0083, 0x03cd, 0x01b6, 0x00f7, 0x0000,
+	    0x03ba, 0x0307, 0x005f, 0x03e3, 0x0000, 0x0099, 0x03cf, 0x0000,
+	    0x0000, 0x0000, 0x021f, 0x00a1, 0x0094, 0x0178, 0x0081, 0x00b1,
+	    0x0000, 0x03a7, 0x005f, 0x0102, 0x03c6, 0x0000, 0x038d, 0x011c,
+	    0x0027, 0x03a0, 0x0312, 0x0000, 0x005d, 0x0000, 0x0000, 0x03bc,
+	    0x03aa, 0x0000, 0x0301, 0x022e, 0x0282, 0x0380, 0x0003, 0x0025,
+	    0x0232, 0x017a, 0x00db, 0x0000, 0x0110, 0x0183, 0x0264, 0x01ed,
+	    0x0000, 0x0263, 0x0119, 0x0000, 0x0331, 0x0000, 0x0000, 0x03ab,
+	    0x0229, 0x0000, 0x01f0, 0x0000, 0x037e, 0x02ed, 0x02d3, 0x0000,
+	    0x009d, 0x037d, 0x0000, 0x0330, 0x0000, 0x0363, 0x02d9, 0x00de,
+	    0x0013, 0x0000, 0x0271, 0x025f, 0x0334, 0x0000, 0x0187, 0x0135,
+	    0x0229, 0x0296, 0x0303, 0x03a8, 0x0000, 0x02c5, 0x020e, 0x0000,
+	    0x03a6, 0x0068, 0x0000, 0x0389, 0x0055, 0x037c, 0x01a2, 0x02ed,
+	    0x0000, 0x0113, 0x00e4, 0x015f, 0x02f7, 0x01df, 0x02da, 0x02d1,
+	    0x029e, 0x0063, 0x00eb, 0x0294, 0x0000, 0x01d5, 0x03c3, 0x02fb,
+	    0x00f3, 0x01a1, 0x03bf, 0x0257, 0x004c, 0x037e, 0x02a5, 0x0361,
+	    0x0309, 0x0011, 0x029f, 0x018b, 0x003b, 0x0143, 0x036c, 0x03d5,
+	    0x004a, 0x0000, 0x029a, 0x0245, 0x0327, 0x026b, 0x024e, 0x01ef,
+	    0x0000, 0x0000, 0x0153, 0x01e3, 0x018e, 0x036a, 0x0226, 0x0000,
+	    0x036b, 0x02a6, 0x03c0, 0x009c, 0x0102, 0x02d2, 0x00cb, 0x0000,
+	    0x0000, 0x00bb, 0x0218, 0x02df, 0x0000, 0x0179, 0x00e6, 0x0000,
+	    0x0000, 0x0249, 0x01c3, 0x0251, 0x03e6, 0x003a, 0x0301, 0x0028,
+	    0x0000, 0x033e, 0x0288, 0x021b, 0x0000, 0x0339, 0x02a0, 0x0233,
+	    0x0090, 0x03bb, 0x03d4, 0x00c7, 0x023d, 0x028f, 0x0000, 0x03a7,
+	    0x030d, 0x00e7, 0x0000, 0x0375, 0x003c, 0x0334, 0x0145, 0x033a,
+	    0x00da, 0x006a, 0x02e6, 0x001e, 0x00e2, 0x006e, 0x007e, 0x0158,
+	    0x03c5, 0x0273, 0x0150, 0x0000, 0x03d3, 0x0378, 0x0000, 0x01b2,
+	    0x0170, 0x017f, 0x0394, 0x0099, 0x0299, 0x0308, 0x007d, 0x0191,
+	    0x0000, 0x0112, 0x0000, 0x0102, 0x00d7, 0x0000, 0x01ab, 0x01cc,
+	    0x03c8, 0x02f0, 0x0345, 0x0111, 0x0000, 0x030d, 0x01fc, 0x0250,
+	    0x00f9, 0x0000, 0x031f, 0x0124, 0x007e, 0x0352, 0x01f2, 0x032a,
+	    0x024d, 0x02d9, 0x001d, 0x00dd, 0x01de, 0x00ab, 0x0000, 0x0196,
+	    0x00df, 0x0117, 0x0363, 0x0000, 0x02ca, 0x0000, 0x02b6, 0x0000,
+	    0x02c0, 0x0305, 0x0000, 0x0000, 0x0098, 0x033b, 0x01d3, 0x0021,
+	    0x01b6, 0x01ef, 0x0000, 0x0000, 0x0096, 0x0223, 0x0000, 0x0303,
+	    0x00b8, 0x0315, 0x0183, 0x0078, 0x0163, 0x0028, 0x00cd, 0x0000,
+	    0x0000, 0x0136, 0x0000, 0x029a, 0x009c, 0x020e, 0x008c, 0x004d,
+	    0x0000, 0x00da, 0x0243, 0x0000, 0x013d, 0x0000, 0x025d, 0x0197,
+	    0x02d6, 0x023b, 0x0000, 0x0306, 0x01e7, 0x00b6, 0x016b, 0x03b2,
+	    0x01a8, 0x0310, 0x0397, 0x0000, 0x00ee, 0x028e, 0x0000, 0x02e4,
+	    0x0000, 0x02ed, 0x0082, 0x0000, 0x0201, 0x0387, 0x0000, 0x0355,
+	    0x0029, 0x01ed, 0x00aa, 0x00b3, 0x026a, 0x0335, 0x0000, 0x023d,
+	    0x01f8, 0x0000, 0x0364, 0x0000, 0x0000, 0x001f, 0x03c4, 0x026c,
+	    0x01bb, 0x0000, 0x0000, 0x0215, 0x0230, 0x0126, 0x0293, 0x01fb,
+	    0x01ac, 0x02be, 0x0000, 0x00a3, 0x0000, 0x0227, 0x011a, 0x0069,
+	    0x024e, 0x0258, 0x01eb, 0x0000, 0x036a, 0x03a3, 0x00cd, 0x0196,
+	    0x01c8, 0x0100, 0x0199, 0x0000, 0x03df, 0x0310, 0x015e, 0x0057,
+	    0x0000, 0x00d8, 0x0273, 0x0300, 0x00ad, 0x0000, 0x0399, 0x0383,
+	    0x02c0, 0x015f, 0x00b9, 0x00a0, 0x00b1, 0x01f7, 0x0003, 0x0000,
+	    0x0236,
+	};
+	uint16_t h[8];
+
+	mi_wyhash4(key, keylen, UINT64_C(0x1100000010), (uint64_t*)h);
+
+	h[0] = h[0] % 1241;
+	h[1] = h[1] % 1241;
+	h[2] = h[2] % 1241;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 1000;
+}
@@ -0,0 +1,269 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 1681692777, seed[1]: 1714636915 */
+#include <stdint.h>
+#include "aeshash.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[2001] = {
+	    0x029e, 0x0000, 0x01cc, 0x02b3, 0x0265, 0x0000, 0x0000, 0x0068,
+	    0x007b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02a2, 0x0000,
+	    0x0000, 0x023b, 0x0000, 0x0000, 0x0310, 0x013b, 0x0000, 0x011a,
+	    0x0000, 0x03d1, 0x02ef, 0x0000, 0x0000, 0x0319, 0x00ed, 0x02e2,
+	    0x0328, 0x0000, 0x00cf, 0x0182, 0x0000, 0x025d, 0x0000, 0x0000,
+	    0x0000, 0x004e, 0x014e, 0x0000, 0x03b4, 0x0000, 0x0294, 0x00af,
+	    0x0355, 0x0038, 0x00cc, 0x02ec, 0x0057, 0x0000, 0x0000, 0x01ba,
+	    0x0000, 0x02ef, 0x0260, 0x0000, 0x0000, 0x0213, 0x008f, 0x02a6,
+	    0x0254, 0x01ba, 0x0000, 0x0385, 0x0289, 0x0000, 0x0000, 0x01e7,
+	    0x0065, 0x0000, 0x0000, 0x0000, 0x0253, 0x0000, 0x0000, 0x0188,
+	    0x0000, 0x0000, 0x0079, 0x02f0, 0x03e0, 0x0000, 0x0182, 0x0000,
+	    0x01e2, 0x0000, 0x0000, 0x00b0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00f3, 0x0088, 0x00b5, 0x0000, 0x02df, 0x0235,
+	    0x0189, 0x0000, 0x0178, 0x00b7, 0x03c5, 0x02c8, 0x029b, 0x0000,
+	    0x0140, 0x00b2, 0x0304, 0x0066, 0x0000, 0x0000, 0x015b, 0x0000,
+	    0x0362, 0x014a, 0x02f3, 0x0000, 0x0000, 0x0000, 0x00bc, 0x0193,
+	    0x0000, 0x01d3, 0x02c6, 0x0000, 0x0000, 0x0221, 0x0212, 0x0000,
+	    0x00e3, 0x01c2, 0x0000, 0x0000, 0x0000, 0x0175, 0x0000, 0x0000,
+	    0x0396, 0x0000, 0x01a8, 0x013f, 0x01e5, 0x03c0, 0x0000, 0x024d,
+	    0x0000, 0x0000, 0x0000, 0x02a9, 0x00b9, 0x0000, 0x0133, 0x029a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0191, 0x0000,
+	    0x0000, 0x02ac, 0x0195, 0x03da, 0x0000, 0x0349, 0x00d7, 0x00d7,
+	    0x0000, 0x0000, 0x02b3, 0x0000, 0x020b, 0x0000, 0x00a7, 0x027d,
+	    0x0000, 0x0080, 0x004f, 0x0000, 0x0000, 0x0000, 0x017e, 0x03d5,
+	    0x0000, 0x01c6, 0x0000, 0x02f8, 0x0197, 0x034e, 0x0050, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x024c, 0x00f1, 0x00c8, 0x0000, 0x0202, 0x00d6, 0x0000,
+	    0x0000, 0x0000, 0x021a, 0x01ef, 0x01c1, 0x0000, 0x0000, 0x0000,
+	    0x0228, 0x0000, 0x023f, 0x0000, 0x0000, 0x00b3, 0x0000, 0x0056,
+	    0x0000, 0x0000, 0x0000, 0x0217, 0x0000, 0x02c7, 0x027f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00e1, 0x0000, 0x0321, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02b4, 0x0000, 0x00a6, 0x02a2, 0x037c,
+	    0x0000, 0x002a, 0x016d, 0x01d9, 0x0000, 0x0000, 0x0044, 0x0000,
+	    0x0000, 0x0300, 0x0000, 0x0000, 0x0221, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0207, 0x0000, 0x01f8, 0x0000, 0x01a7, 0x0000,
+	    0x0000, 0x0000, 0x0365, 0x0355, 0x0000, 0x0000, 0x0240, 0x00ed,
+	    0x018f, 0x0273, 0x0000, 0x024a, 0x03af, 0x0000, 0x010b, 0x00f8,
+	    0x0000, 0x0102, 0x02a8, 0x0000, 0x0000, 0x0271, 0x0000, 0x0000,
+	    0x01c6, 0x029b, 0x0000, 0x0110, 0x0060, 0x022a, 0x0019, 0x0000,
+	    0x0000, 0x0382, 0x0000, 0x029d, 0x0174, 0x018e, 0x0000, 0x0042,
+	    0x0000, 0x037b, 0x0138, 0x01ca, 0x0000, 0x0088, 0x03a6, 0x0000,
+	    0x0000, 0x0000, 0x0071, 0x0000, 0x0000, 0x03a1, 0x018b, 0x0000,
+	    0x0079, 0x0000, 0x0000, 0x0000, 0x03af, 0x0000, 0x0000, 0x0000,
+	    0x005d, 0x0000, 0x0182, 0x01d5, 0x0000, 0x0160, 0x01db, 0x03a6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03c3, 0x0000, 0x0000,
+	    0x00e6, 0x0000, 0x0000, 0x03c2, 0x0270, 0x0000, 0x0000, 0x0315,
+	    0x0000, 0x0384, 0x0000, 0x03a1, 0x0081, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00c8, 0x035e, 0x02e2, 0x0000, 0x01f8, 0x032a,
+	    0x0295, 0x0000, 0x01b3, 0x02ff, 0x0000, 0x0000, 0x0297, 0x0000,
+	    0x0000, 0x0266, 0x0000, 0x0000, 0x0000, 0x0000, 0x03d9, 0x0000,
+	    0x02aa, 0x00b0, 0x0000, 0x01ed, 0x0000, 0x0000, 0x02fc, 0x0154,
+	    0x0301, 0x0103, 0x031b, 0x026c, 0x0335, 0x0000, 0x0331, 0x0377,
+	    0x0000, 0x020a, 0x02f2, 0x0000, 0x0140, 0x01ac, 0x0100, 0x0000,
+	    0x0000, 0x0000, 0x026b, 0x024e, 0x0000, 0x00cb, 0x022e, 0x0314,
+	    0x03a2, 0x0053, 0x0000, 0x0000, 0x0298, 0x0000, 0x0000, 0x039c,
+	    0x015e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x016d, 0x038a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0079, 0x0000, 0x0000, 0x03d6, 0x01a0, 0x0021,
+	    0x0064, 0x0000, 0x0000, 0x0177, 0x0000, 0x00d8, 0x0000, 0x030a,
+	    0x0000, 0x02b2, 0x032b, 0x031d, 0x0000, 0x027c, 0x032b, 0x0256,
+	    0x0000, 0x0000, 0x016c, 0x01ff, 0x01da, 0x0000, 0x0118, 0x01a5,
+	    0x013e, 0x0000, 0x00c3, 0x0147, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02aa, 0x00ab, 0x0000, 0x0000, 0x0000,
+	    0x03c4, 0x0000, 0x0190, 0x0000, 0x0000, 0x01f3, 0x0363, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01d0, 0x003d, 0x0000, 0x0194, 0x0383,
+	    0x0000, 0x0093, 0x0000, 0x0000, 0x0000, 0x0178, 0x0000, 0x0000,
+	    0x0000, 0x00ef, 0x0014, 0x008d, 0x027e, 0x0000, 0x020a, 0x0000,
+	    0x03a3, 0x0000, 0x0000, 0x0122, 0x0158, 0x0000, 0x0000, 0x01eb,
+	    0x0000, 0x0000, 0x0000, 0x0111, 0x0000, 0x018b, 0x00ad, 0x0000,
+	    0x0000, 0x0358, 0x010d, 0x020b, 0x0000, 0x0000, 0x0161, 0x0000,
+	    0x0000, 0x00c3, 0x0000, 0x0000, 0x03ae, 0x022a, 0x01f5, 0x0000,
+	    0x02a9, 0x0000, 0x0251, 0x00d7, 0x0343, 0x0000, 0x0000, 0x03b9,
+	    0x0000, 0x03d0, 0x03a1, 0x0150, 0x0000, 0x0239, 0x0210, 0x01ac,
+	    0x0000, 0x0000, 0x0293, 0x017b, 0x0000, 0x0000, 0x03cc, 0x0000,
+	    0x0000, 0x01fa, 0x0000, 0x0000, 0x0000, 0x00d7, 0x01b0, 0x0000,
+	    0x0000, 0x0196, 0x0000, 0x019f, 0x009c, 0x0000, 0x01dc, 0x0000,
+	    0x026f, 0x03af, 0x0000, 0x0000, 0x0000, 0x0067, 0x0000, 0x030b,
+	    0x035d, 0x0000, 0x0000, 0x0096, 0x01fb, 0x02d0, 0x0000, 0x0000,
+	    0x0001, 0x0000, 0x03b4, 0x034d, 0x0123, 0x0000, 0x030f, 0x0000,
+	    0x0159, 0x0000, 0x014a, 0x0000, 0x0217, 0x0000, 0x0217, 0x02a6,
+	    0x0000, 0x00bc, 0x0000, 0x035e, 0x0000, 0x015f, 0x017a, 0x0092,
+	    0x0000, 0x0282, 0x016e, 0x01a7, 0x0000, 0x0000, 0x0000, 0x00b8,
+	    0x03da, 0x0000, 0x0299, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01ce, 0x0000, 0x006e, 0x0000, 0x01f3, 0x0388, 0x0264,
+	    0x03e4, 0x0000, 0x0254, 0x035a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03c5, 0x0317, 0x0000, 0x03c0, 0x0000, 0x0387, 0x0234,
+	    0x003e, 0x0364, 0x0281, 0x0000, 0x0269, 0x0022, 0x0334, 0x0048,
+	    0x0214, 0x0000, 0x0000, 0x0000, 0x035b, 0x0000, 0x0000, 0x0016,
+	    0x00cf, 0x01ff, 0x0318, 0x0000, 0x00b8, 0x0075, 0x0287, 0x0074,
+	    0x0000, 0x0022, 0x0000, 0x0002, 0x0210, 0x0246, 0x01d2, 0x00e4,
+	    0x0000, 0x01a6, 0x016d, 0x01a1, 0x01c7, 0x00d6, 0x028c, 0x0340,
+	    0x02e8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0270, 0x0000, 0x0000,
+	    0x0000, 0x0199, 0x0000, 0x0000, 0x000a, 0x0000, 0x0000, 0x01c7,
+	    0x0000, 0x0000, 0x0000, 0x039a, 0x0003, 0x0035, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0382, 0x027a, 0x029d, 0x0000, 0x0000, 0x0000,
+	    0x007d, 0x0000, 0x0000, 0x01e9, 0x02dd, 0x016a, 0x02fa, 0x0000,
+	    0x01e7, 0x009c, 0x0000, 0x0000, 0x0000, 0x02cf, 0x03cf, 0x003e,
+	    0x0000, 0x0132, 0x0000, 0x0200, 0x0000, 0x0000, 0x029d, 0x01c0,
+	    0x0000, 0x001a, 0x0149, 0x0352, 0x0000, 0x0091, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0361, 0x015e, 0x023e, 0x0000, 0x015c,
+	    0x0347, 0x035c, 0x0320, 0x036a, 0x0124, 0x0316, 0x02a3, 0x01b6,
+	    0x039a, 0x0000, 0x0000, 0x0000, 0x03cd, 0x00c5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x017a, 0x03ab, 0x01f2, 0x0000, 0x01e1, 0x0000,
+	    0x0000, 0x0358, 0x014c, 0x0000, 0x0000, 0x0000, 0x01e7, 0x0000,
+	    0x028c, 0x01b0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0011,
+	    0x00e0, 0x0000, 0x0000, 0x0191, 0x031c, 0x0000, 0x0000, 0x0088,
+	    0x0000, 0x0301, 0x0000, 0x013d, 0x0000, 0x00de, 0x00ea, 0x0000,
+	    0x0000, 0x0105, 0x0000, 0x0000, 0x0000, 0x0053, 0x0000, 0x0000,
+	    0x018c, 0x0000, 0x0000, 0x00d9, 0x0000, 0x0000, 0x0000, 0x02c7,
+	    0x0323, 0x0000, 0x0128, 0x0000, 0x0261, 0x031e, 0x0000, 0x0000,
+	    0x001a, 0x0367, 0x0000, 0x02f4, 0x02fb, 0x0000, 0x0081, 0x0284,
+	    0x0184, 0x0000, 0x0000, 0x01a0, 0x0000, 0x02e5, 0x0000, 0x029e,
+	    0x0000, 0x009d, 0x0000, 0x031c, 0x013d, 0x0000, 0x0146, 0x034e,
+	    0x01f2, 0x0000, 0x0091, 0x0076, 0x002a, 0x0000, 0x001f, 0x0117,
+	    0x0000, 0x0000, 0x015b, 0x0000, 0x0000, 0x0000, 0x0286, 0x0239,
+	    0x0000, 0x036d, 0x0108, 0x0082, 0x0253, 0x0000, 0x0141, 0x00d5,
+	    0x00c1, 0x01ef, 0x01e3, 0x0000, 0x02d7, 0x0000, 0x0000, 0x0000,
+	    0x008a, 0x0000, 0x00cd, 0x0000, 0x0110, 0x00e5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x008b, 0x0000, 0x01c2, 0x0000, 0x0137, 0x02a1,
+	    0x00ec, 0x0000, 0x02e1, 0x001e, 0x0000, 0x0000, 0x0000, 0x013e,
+	    0x0000, 0x0000, 0x0000, 0x0369, 0x004e, 0x0233, 0x00f4, 0x037a,
+	    0x0000, 0x0000, 0x0000, 0x0081, 0x00ed, 0x0000, 0x0375, 0x001a,
+	    0x0000, 0x0000, 0x0296, 0x0000, 0x031a, 0x0000, 0x0000, 0x0212,
+	    0x0393, 0x0000, 0x02c4, 0x00f9, 0x0000, 0x0009, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0095, 0x0000, 0x00d0, 0x033c, 0x0399, 0x0000,
+	    0x0000, 0x0000, 0x01b9, 0x00c9, 0x00d6, 0x0000, 0x0000, 0x016d,
+	    0x0191, 0x035d, 0x009a, 0x0155, 0x0152, 0x0000, 0x0000, 0x0000,
+	    0x00ac, 0x0000, 0x0000, 0x00d9, 0x0000, 0x016b, 0x0000, 0x0064,
+	    0x016e, 0x03cc, 0x0000, 0x0073, 0x0111, 0x0000, 0x0000, 0x0000,
+	    0x008b, 0x0000, 0x0075, 0x0253, 0x02f4, 0x0000, 0x0000, 0x00c0,
+	    0x0000, 0x033f, 0x0000, 0x03a9, 0x0000, 0x026e, 0x0272, 0x0005,
+	    0x0000, 0x02e0, 0x0009, 0x0000, 0x0063, 0x02e2, 0x0000, 0x035c,
+	    0x00f6, 0x0000, 0x0000, 0x0000, 0x01d6, 0x0000, 0x021e, 0x0000,
+	    0x00a1, 0x0000, 0x0000, 0x0000, 0x010b, 0x0282, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0355, 0x0000, 0x02cf, 0x00df, 0x014c,
+	    0x0000, 0x00ba, 0x0359, 0x0000, 0x004c, 0x0000, 0x0313, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x00fb, 0x0272, 0x0040, 0x0000,
+	    0x00d3, 0x0000, 0x0000, 0x0000, 0x0291, 0x026d, 0x0000, 0x025d,
+	    0x0325, 0x0000, 0x0000, 0x0000, 0x0148, 0x02e5, 0x00a4, 0x013e,
+	    0x0000, 0x0318, 0x03a5, 0x0000, 0x0124, 0x0000, 0x0000, 0x022e,
+	    0x0000, 0x022c, 0x0000, 0x0000, 0x038f, 0x0000, 0x019f, 0x01b4,
+	    0x0000, 0x0000, 0x0000, 0x0112, 0x00ca, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0378, 0x0000, 0x0000, 0x014d, 0x0000, 0x0338, 0x0000,
+	    0x016a, 0x032c, 0x0328, 0x0000, 0x0000, 0x015a, 0x0000, 0x00ab,
+	    0x0000, 0x0317, 0x0000, 0x0000, 0x0000, 0x01e8, 0x0000, 0x0394,
+	    0x0000, 0x0000, 0x0186, 0x0158, 0x0000, 0x038d, 0x0237, 0x0172,
+	    0x0288, 0x0116, 0x0000, 0x0000, 0x03a6, 0x01fd, 0x011d, 0x02c2,
+	    0x0397, 0x0244, 0x029f, 0x0000, 0x0000, 0x01c7, 0x0000, 0x03b8,
+	    0x0000, 0x0000, 0x03e2, 0x0000, 0x02dd, 0x0000, 0x0000, 0x0000,
+	    0x00c4, 0x0039, 0x0105, 0x0000, 0x0000, 0x0303, 0x0000, 0x0000,
+	    0x033b, 0x0000, 0x0000, 0x0164, 0x0000, 0x0371, 0x0000, 0x0062,
+	    0x0000, 0x000f, 0x0106, 0x0000, 0x010f, 0x00b4, 0x03bc, 0x0000,
+	    0x02cd, 0x034f, 0x00ef, 0x0010, 0x0000, 0x03d2, 0x0000, 0x0281,
+	    0x001b, 0x0000, 0x033e, 0x0000, 0x007e, 0x0354, 0x038d, 0x0039,
+	    0x00e3, 0x0000, 0x0000, 0x0052, 0x009e, 0x017f, 0x0000, 0x016b,
+	    0x01a7, 0x02f7, 0x020e, 0x02dc, 0x037f, 0x0000, 0x03d0, 0x0049,
+	    0x0000, 0x0254, 0x0000, 0x0136, 0x0000, 0x0000, 0x0000, 0x00d2,
+	    0x0000, 0x016e, 0x0000, 0x0000, 0x0000, 0x02eb, 0x0000, 0x0000,
+	    0x0383, 0x00ba, 0x0381, 0x02ee, 0x0042, 0x0000, 0x0000, 0x0025,
+	    0x0000, 0x0000, 0x00fc, 0x0000, 0x0203, 0x0000, 0x0000, 0x0376,
+	    0x0000, 0x0000, 0x00a7, 0x0000, 0x0000, 0x0371, 0x019a, 0x0000,
+	    0x0233, 0x02e9, 0x01e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x032e,
+	    0x0059, 0x02f5, 0x001d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03c9, 0x0000, 0x0299, 0x0075, 0x0000, 0x0135, 0x0000,
+	    0x03c9, 0x000f, 0x0000, 0x0000, 0x0000, 0x037e, 0x018b, 0x0000,
+	    0x0000, 0x022b, 0x0000, 0x0174, 0x02e3, 0x0000, 0x0330, 0x01ab,
+	    0x0000, 0x0000, 0x0276, 0x0000, 0x032a, 0x0000, 0x0000, 0x02ec,
+	    0x0347, 0x0000, 0x0000, 0x03bb, 0x0000, 0x0374, 0x0000, 0x0000,
+	    0x0024, 0x01bc, 0x036d, 0x02e5, 0x0000, 0x03d4, 0x0000, 0x0000,
+	    0x0000, 0x011f, 0x028c, 0x016f, 0x0000, 0x005a, 0x0000, 0x0000,
+	    0x0000, 0x0027, 0x0000, 0x0079, 0x0209, 0x0000, 0x0000, 0x0177,
+	    0x0000, 0x0000, 0x03a0, 0x0000, 0x0000, 0x01a7, 0x0000, 0x0000,
+	    0x0000, 0x030a, 0x02d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x02a4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03ac, 0x0000, 0x00b2,
+	    0x0000, 0x003c, 0x00f8, 0x0000, 0x0000, 0x004c, 0x03d5, 0x0000,
+	    0x01f0, 0x0000, 0x0000, 0x0000, 0x03bf, 0x01a3, 0x0287, 0x0000,
+	    0x0000, 0x0000, 0x02f3, 0x030c, 0x0033, 0x0000, 0x0000, 0x0000,
+	    0x00d5, 0x0000, 0x02f0, 0x0000, 0x0000, 0x02d7, 0x018f, 0x02be,
+	    0x0000, 0x0000, 0x03e5, 0x0000, 0x0000, 0x0143, 0x0000, 0x0000,
+	    0x01c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x027a, 0x01db, 0x02a1,
+	    0x0000, 0x0000, 0x033f, 0x03a8, 0x034d, 0x0000, 0x0000, 0x0000,
+	    0x000a, 0x0310, 0x0000, 0x0000, 0x03c4, 0x0000, 0x011c, 0x0234,
+	    0x024f, 0x0000, 0x00e9, 0x0000, 0x0000, 0x0000, 0x0000, 0x016e,
+	    0x013b, 0x01f8, 0x00cb, 0x013c, 0x02a1, 0x02bb, 0x0000, 0x0077,
+	    0x0000, 0x0357, 0x0000, 0x0000, 0x038f, 0x0000, 0x0000, 0x0000,
+	    0x036c, 0x0000, 0x0000, 0x0362, 0x01d7, 0x0000, 0x02fb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x010e, 0x0246, 0x0000, 0x030d, 0x02d3,
+	    0x0000, 0x03a5, 0x0124, 0x0000, 0x0000, 0x003e, 0x0168, 0x0000,
+	    0x01b8, 0x0000, 0x0000, 0x010b, 0x0000, 0x034b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02ba, 0x000d, 0x02e8, 0x00c2, 0x01f2, 0x0144,
+	    0x021f, 0x0042, 0x0000, 0x014e, 0x0000, 0x0000, 0x00ee, 0x0000,
+	    0x03db, 0x002e, 0x0000, 0x0104, 0x0000, 0x0034, 0x0000, 0x012a,
+	    0x001b, 0x0000, 0x0125, 0x0378, 0x0038, 0x0000, 0x0049, 0x0000,
+	    0x0000, 0x0000, 0x02dc, 0x03b3, 0x0005, 0x0000, 0x0000, 0x0000,
+	    0x01dd, 0x0208, 0x0000, 0x004d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x021c, 0x0000, 0x0000, 0x0327, 0x0282, 0x0000,
+	    0x0194, 0x0000, 0x0000, 0x0000, 0x0081, 0x013b, 0x0000, 0x00b5,
+	    0x0193, 0x0000, 0x03a7, 0x0190, 0x0368, 0x0320, 0x02f7, 0x0000,
+	    0x03af, 0x0000, 0x0000, 0x016d, 0x019d, 0x0000, 0x035c, 0x0000,
+	    0x0000, 0x0000, 0x0268, 0x02b7, 0x0369, 0x0000, 0x0216, 0x0000,
+	    0x0145, 0x0310, 0x0000, 0x0000, 0x0102, 0x0000, 0x00df, 0x02be,
+	    0x0000, 0x030e, 0x0080, 0x0000, 0x0254, 0x0398, 0x0000, 0x0000,
+	    0x0261, 0x0000, 0x031b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0365,
+	    0x0224, 0x0258, 0x0345, 0x0123, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0137, 0x0243, 0x0000, 0x0071, 0x01d8, 0x0000, 0x0000,
+	    0x0000, 0x0209, 0x0000, 0x03a2, 0x0000, 0x004e, 0x013a, 0x0000,
+	    0x0000, 0x0000, 0x0213, 0x037f, 0x02d0, 0x0000, 0x0018, 0x0197,
+	    0x02b8, 0x026f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0085, 0x0138, 0x03a9, 0x03e2, 0x039e, 0x0000, 0x0000,
+	    0x007e, 0x0000, 0x0000, 0x0000, 0x0357, 0x021d, 0x03b9, 0x0000,
+	    0x0000, 0x0000, 0x01b8, 0x0000, 0x01fc, 0x0000, 0x0315, 0x0313,
+	    0x011c, 0x02cc, 0x01d2, 0x015f, 0x0000, 0x03ab, 0x00df, 0x0000,
+	    0x0187, 0x031f, 0x011a, 0x0000, 0x0236, 0x03e6, 0x0000, 0x0000,
+	    0x0181, 0x0000, 0x0069, 0x022b, 0x0000, 0x026a, 0x0000, 0x0000,
+	    0x038d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0285, 0x0000, 0x0000,
+	    0x0110, 0x00aa, 0x0000, 0x032a, 0x0000, 0x0047, 0x0000, 0x0000,
+	    0x0080, 0x01a6, 0x0353, 0x0202, 0x03b0, 0x0000, 0x0309, 0x0048,
+	    0x0000, 0x012d, 0x0000, 0x03be, 0x00f6, 0x00fb, 0x0000, 0x0000,
+	    0x0275, 0x017f, 0x003f, 0x01fe, 0x0000, 0x034d, 0x0000, 0x01c6,
+	    0x0000, 0x00cc, 0x01fb, 0x0198, 0x032f, 0x0000, 0x0000, 0x01c3,
+	    0x0000, 0x02d1, 0x0000, 0x0000, 0x024e, 0x0000, 0x031b, 0x0000,
+	    0x0000, 0x0218, 0x022d, 0x0000, 0x0000, 0x0000, 0x01cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02ab,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02b4, 0x0092, 0x00db, 0x0000, 0x0000, 0x0389, 0x0000,
+	    0x0173, 0x0277, 0x02d4, 0x0000, 0x0000, 0x004e, 0x00b0, 0x0000,
+	    0x03a5, 0x0000, 0x0000, 0x007b, 0x00ee, 0x0000, 0x0000, 0x0000,
+	    0x003a, 0x0000, 0x0000, 0x0219, 0x007c, 0x0000, 0x0000, 0x03cb,
+	    0x01d1, 0x00f6, 0x0181, 0x0000, 0x00ed, 0x025a, 0x0000, 0x0000,
+	    0x033c, 0x0131, 0x0311, 0x020f, 0x037f, 0x0206, 0x00b5, 0x0040,
+	    0x008e, 0x0000, 0x0000, 0x003f, 0x0000, 0x01d2, 0x028d, 0x0000,
+	    0x0000, 0x020f, 0x0000, 0x0000, 0x0331, 0x0033, 0x0000, 0x0000,
+	    0x0104, 0x0000, 0x0000, 0x0000, 0x0000, 0x002b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0037, 0x0000, 0x039a, 0x0000, 0x0000,
+	    0x0000, 0x035e, 0x02b6, 0x0000, 0x0000, 0x0355, 0x01c9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f5,
+	    0x0392, 0x038f, 0x0063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0221, 0x0315, 0x035f, 0x03e7, 0x0000, 0x02ae, 0x0000, 0x024f,
+	    0x0000, 0x0000, 0x02e1, 0x0217, 0x0000, 0x0000, 0x03af, 0x0141,
+	    0x0300, 0x0000, 0x0033, 0x02fa, 0x0000, 0x0000, 0x0006, 0x0153,
+	    0x02d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0364, 0x0000, 0x0000,
+	    0x0000, 0x0117, 0x01ea, 0x0000, 0x0000, 0x0000, 0x02a8, 0x0000,
+	    0x0241, 0x0000, 0x029f, 0x0000, 0x0129, 0x0156, 0x014b, 0x03aa,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x02a0, 0x0000, 0x0000, 0x03b6,
+	    0x0000, 0x0000, 0x01b8, 0x01da, 0x0000, 0x0000, 0x0000, 0x02db,
+	    0x0274, 0x0000, 0x0000, 0x02d9, 0x01d7, 0x0329, 0x0233, 0x0000,
+	    0x0286, 0x0000, 0x0000, 0x0000, 0x01b5, 0x0124, 0x0335, 0x0111,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0149, 0x0000, 0x0000, 0x0000,
+	    0x0019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0019, 0x01dc, 0x0274,
+	    0x0220,
+	};
+	uint16_t h[4];
+
+	aeshash2(key, keylen, UINT64_C(0x66334873643c9869), (uint32_t*)h);
+
+	h[0] = h[0] % 2001;
+	h[1] = h[1] % 2001;
+	return (g[h[0]] + g[h[1]]) % 1000;
+}
@@ -0,0 +1,269 @@
+/* generated with rurban/nbperf 08a5797 -fp _words1000 */
+/* seed[0]: 198677718, seed[1]: 2 */
+#include <stdint.h>
+#include "crc3.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[2001] = {
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0172, 0x0000, 0x0000,
+	    0x03e0, 0x0394, 0x0210, 0x0000, 0x0000, 0x0153, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0190, 0x0295, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x02c9, 0x0146, 0x0000, 0x0335,
+	    0x0302, 0x0000, 0x03d3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0299, 0x02d7, 0x0000, 0x01d6, 0x005f, 0x021f, 0x0064,
+	    0x03a3, 0x0000, 0x024c, 0x01d3, 0x0039, 0x0000, 0x02fe, 0x0361,
+	    0x038f, 0x0000, 0x0094, 0x0000, 0x01ad, 0x039e, 0x03e0, 0x0000,
+	    0x0000, 0x00c1, 0x0000, 0x0170, 0x0000, 0x0341, 0x0395, 0x0082,
+	    0x0000, 0x03d2, 0x01d1, 0x0000, 0x0000, 0x0000, 0x00a8, 0x029f,
+	    0x024f, 0x0000, 0x0000, 0x020c, 0x033e, 0x03d3, 0x01b2, 0x0021,
+	    0x0000, 0x0000, 0x0019, 0x008d, 0x0000, 0x0266, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x002a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x002a, 0x0237, 0x03d2, 0x0000, 0x02cb,
+	    0x0000, 0x034f, 0x0000, 0x0000, 0x014a, 0x0263, 0x015f, 0x0000,
+	    0x0000, 0x02e8, 0x0198, 0x0000, 0x01a6, 0x0000, 0x0000, 0x0000,
+	    0x02c5, 0x0271, 0x02b9, 0x0000, 0x00ce, 0x039b, 0x0014, 0x0000,
+	    0x0089, 0x0000, 0x0000, 0x0007, 0x01e2, 0x006b, 0x0306, 0x0000,
+	    0x0194, 0x0000, 0x0000, 0x0030, 0x0000, 0x0000, 0x0171, 0x0314,
+	    0x0000, 0x0240, 0x03aa, 0x0342, 0x0078, 0x02c1, 0x0000, 0x0000,
+	    0x0000, 0x00b8, 0x0000, 0x0000, 0x021b, 0x0000, 0x0275, 0x0224,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x030a, 0x0036, 0x0000, 0x01f9,
+	    0x0000, 0x0000, 0x01e8, 0x002d, 0x0000, 0x026e, 0x03c3, 0x0040,
+	    0x0000, 0x0349, 0x02e3, 0x0000, 0x0000, 0x0100, 0x0135, 0x0000,
+	    0x0000, 0x02ed, 0x02b2, 0x01b8, 0x0334, 0x02d1, 0x00e5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0126, 0x00e6, 0x0000, 0x0135, 0x009b,
+	    0x0000, 0x01f7, 0x0132, 0x0000, 0x0000, 0x021a, 0x0000, 0x0390,
+	    0x0000, 0x03e5, 0x0000, 0x00bb, 0x0000, 0x0000, 0x0000, 0x00dd,
+	    0x02a4, 0x031b, 0x01d1, 0x0099, 0x02a4, 0x01d9, 0x0000, 0x0000,
+	    0x0000, 0x0020, 0x0000, 0x0000, 0x028a, 0x0000, 0x03bd, 0x03e2,
+	    0x0000, 0x0000, 0x0027, 0x036a, 0x03cc, 0x014d, 0x0257, 0x02fa,
+	    0x0000, 0x0000, 0x0000, 0x0073, 0x0000, 0x0000, 0x020a, 0x00ae,
+	    0x0000, 0x0229, 0x0000, 0x0000, 0x0194, 0x02a6, 0x02f4, 0x0000,
+	    0x004a, 0x02fc, 0x03ac, 0x0000, 0x0245, 0x0000, 0x037a, 0x032e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0225, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x018f, 0x0000, 0x025e, 0x019c, 0x003c, 0x019e, 0x0000,
+	    0x0000, 0x01ee, 0x000c, 0x0270, 0x0396, 0x024c, 0x0000, 0x0342,
+	    0x00ca, 0x0225, 0x0000, 0x0000, 0x0000, 0x03c4, 0x0000, 0x0000,
+	    0x0000, 0x03b1, 0x0000, 0x03d6, 0x0023, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x00b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x03d3, 0x0000,
+	    0x00e7, 0x021a, 0x032f, 0x0000, 0x009e, 0x01c9, 0x037f, 0x0156,
+	    0x013f, 0x0128, 0x017e, 0x0000, 0x002e, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0287, 0x00a6, 0x0000, 0x0000, 0x031c, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0060, 0x004e, 0x01ce, 0x0000, 0x02a4,
+	    0x01a3, 0x0281, 0x00ec, 0x0398, 0x00b6, 0x0000, 0x00ed, 0x0000,
+	    0x0000, 0x022e, 0x0000, 0x0333, 0x0000, 0x0000, 0x0000, 0x0190,
+	    0x0180, 0x0000, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x036f, 0x01ae, 0x0000, 0x0000, 0x02dd, 0x00fd, 0x0000, 0x0000,
+	    0x022a, 0x0000, 0x033b, 0x0000, 0x000f, 0x0098, 0x023e, 0x0000,
+	    0x0000, 0x0000, 0x007c, 0x0333, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x006f, 0x0000, 0x0000, 0x0113, 0x0306, 0x0000, 0x03ca,
+	    0x03dd, 0x0000, 0x0000, 0x03aa, 0x0000, 0x03dd, 0x0223, 0x0370,
+	    0x0000, 0x00c7, 0x0276, 0x0000, 0x0000, 0x0000, 0x01d0, 0x0388,
+	    0x03b3, 0x017c, 0x03c8, 0x0355, 0x00b6, 0x002f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0115, 0x008f, 0x00a7, 0x031b, 0x0000,
+	    0x0141, 0x01fb, 0x0326, 0x01f1, 0x0000, 0x012f, 0x03ac, 0x0000,
+	    0x0000, 0x0096, 0x0000, 0x0000, 0x00eb, 0x0081, 0x0321, 0x0000,
+	    0x0000, 0x036e, 0x007e, 0x0000, 0x03b9, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0153, 0x0000, 0x027d, 0x0000, 0x0163, 0x0162,
+	    0x0000, 0x01f0, 0x014a, 0x0388, 0x0000, 0x0094, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x03b5, 0x0256, 0x0377, 0x0000,
+	    0x0375, 0x00f5, 0x0000, 0x0048, 0x00ad, 0x00b9, 0x0114, 0x00b6,
+	    0x00fb, 0x0214, 0x0000, 0x0005, 0x00de, 0x01bc, 0x0000, 0x0372,
+	    0x0000, 0x0000, 0x0000, 0x0366, 0x03b2, 0x0353, 0x0000, 0x0000,
+	    0x0000, 0x0056, 0x0000, 0x018d, 0x0000, 0x021b, 0x0000, 0x020e,
+	    0x01fd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0050, 0x0000, 0x0000,
+	    0x0042, 0x0062, 0x037f, 0x0000, 0x02c9, 0x0094, 0x031a, 0x034e,
+	    0x0050, 0x0000, 0x0000, 0x0000, 0x0000, 0x008a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02f3, 0x02bd, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02e0, 0x0034, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0382, 0x0000, 0x038e, 0x0000, 0x02b9, 0x0000, 0x01f8, 0x0282,
+	    0x0000, 0x0000, 0x0353, 0x019f, 0x0000, 0x0312, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x009b, 0x01ae, 0x0314, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00a4, 0x039b, 0x0213, 0x0385, 0x0000, 0x031d,
+	    0x0000, 0x027d, 0x0000, 0x026b, 0x0269, 0x00c7, 0x026f, 0x029d,
+	    0x03e4, 0x0000, 0x026b, 0x01c8, 0x0000, 0x02cc, 0x0076, 0x0371,
+	    0x030c, 0x0000, 0x027f, 0x0000, 0x0000, 0x02b7, 0x0000, 0x0338,
+	    0x0225, 0x033b, 0x023b, 0x00f2, 0x03c0, 0x0308, 0x0150, 0x0000,
+	    0x01aa, 0x01b2, 0x0000, 0x0222, 0x00d7, 0x0000, 0x0224, 0x0000,
+	    0x01b6, 0x025a, 0x00c3, 0x031f, 0x0000, 0x0000, 0x01af, 0x0219,
+	    0x02dc, 0x0152, 0x0003, 0x0000, 0x0000, 0x01be, 0x00fc, 0x0178,
+	    0x0000, 0x0000, 0x00b9, 0x0000, 0x03de, 0x0373, 0x037f, 0x0351,
+	    0x0000, 0x0000, 0x013f, 0x0000, 0x02ee, 0x002d, 0x0000, 0x00b9,
+	    0x0000, 0x02e4, 0x0377, 0x0000, 0x0000, 0x000c, 0x0383, 0x02ba,
+	    0x02bf, 0x0166, 0x0099, 0x0000, 0x0000, 0x0000, 0x035c, 0x00fa,
+	    0x0000, 0x02ad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0395,
+	    0x003a, 0x0124, 0x02fc, 0x0000, 0x00a7, 0x0012, 0x0371, 0x0281,
+	    0x0000, 0x0000, 0x002e, 0x0000, 0x0175, 0x037f, 0x0000, 0x031c,
+	    0x0000, 0x01df, 0x0000, 0x0091, 0x0000, 0x02b1, 0x0000, 0x0000,
+	    0x002d, 0x0000, 0x0352, 0x0008, 0x00b8, 0x0000, 0x0000, 0x01b8,
+	    0x0000, 0x0000, 0x014d, 0x03da, 0x01b7, 0x01c1, 0x0000, 0x02ab,
+	    0x00ba, 0x0000, 0x033e, 0x00e7, 0x0000, 0x0051, 0x036b, 0x027a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00aa, 0x0000, 0x02c8,
+	    0x0000, 0x004a, 0x0000, 0x00e2, 0x00d0, 0x0000, 0x0000, 0x0000,
+	    0x03e2, 0x0093, 0x0000, 0x01fe, 0x03a9, 0x02ff, 0x037c, 0x03c7,
+	    0x0000, 0x0183, 0x0132, 0x00b5, 0x0000, 0x0000, 0x0000, 0x0347,
+	    0x010f, 0x0000, 0x0094, 0x025f, 0x0000, 0x0000, 0x0000, 0x0316,
+	    0x0066, 0x0000, 0x0000, 0x02f2, 0x02a6, 0x02c1, 0x014f, 0x0000,
+	    0x0264, 0x0000, 0x0193, 0x02e9, 0x0267, 0x019c, 0x0000, 0x0295,
+	    0x017b, 0x0000, 0x0000, 0x01fc, 0x0000, 0x01f0, 0x0000, 0x0000,
+	    0x01e6, 0x0000, 0x004f, 0x0000, 0x0000, 0x03e7, 0x0000, 0x0128,
+	    0x0000, 0x000c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0304, 0x0189, 0x00fa, 0x0000, 0x0325, 0x0228, 0x00b5, 0x00dd,
+	    0x0025, 0x0261, 0x0000, 0x001d, 0x0000, 0x0000, 0x0028, 0x0081,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0201, 0x00de, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02e2, 0x01c4, 0x0000, 0x01e8, 0x0053,
+	    0x0000, 0x0000, 0x00c0, 0x02ae, 0x0000, 0x0000, 0x0000, 0x00aa,
+	    0x00ff, 0x0198, 0x01e1, 0x0000, 0x01b1, 0x02e7, 0x0104, 0x007c,
+	    0x0000, 0x01f4, 0x0000, 0x039b, 0x007b, 0x01e9, 0x024a, 0x0000,
+	    0x030e, 0x0000, 0x0000, 0x01a3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0233, 0x0000, 0x019a, 0x0000, 0x02a3, 0x0000, 0x0000,
+	    0x0115, 0x0000, 0x0000, 0x0311, 0x0000, 0x0174, 0x0000, 0x02d0,
+	    0x03ad, 0x0166, 0x0000, 0x0000, 0x038f, 0x037a, 0x0000, 0x0000,
+	    0x01c9, 0x0037, 0x0294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0362, 0x0000, 0x03a7, 0x0000, 0x012c, 0x02a4, 0x0000,
+	    0x0000, 0x028f, 0x0000, 0x00fe, 0x007d, 0x0000, 0x0352, 0x039b,
+	    0x0000, 0x0000, 0x0000, 0x03bf, 0x0000, 0x0000, 0x00b0, 0x00f2,
+	    0x0000, 0x0000, 0x0384, 0x02e3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0232, 0x00ef, 0x0000, 0x0000, 0x00a8, 0x002d,
+	    0x026a, 0x0000, 0x0377, 0x0000, 0x0000, 0x0000, 0x0000, 0x0092,
+	    0x0000, 0x0000, 0x031c, 0x0152, 0x0354, 0x0000, 0x039d, 0x0000,
+	    0x0000, 0x0000, 0x002e, 0x012a, 0x0396, 0x0000, 0x0000, 0x0000,
+	    0x0031, 0x0000, 0x029c, 0x01e2, 0x0000, 0x022e, 0x0000, 0x0000,
+	    0x02f3, 0x03c1, 0x0153, 0x0277, 0x0100, 0x02bf, 0x0092, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0275, 0x02be,
+	    0x0000, 0x03de, 0x0000, 0x0120, 0x012c, 0x0209, 0x0000, 0x02eb,
+	    0x0000, 0x0229, 0x0000, 0x023c, 0x0000, 0x0244, 0x0000, 0x0136,
+	    0x03cb, 0x0000, 0x00be, 0x0247, 0x00e5, 0x0000, 0x01f0, 0x0000,
+	    0x01a3, 0x00d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x013b,
+	    0x0000, 0x0000, 0x0000, 0x018f, 0x0367, 0x0000, 0x021f, 0x0000,
+	    0x025c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0245, 0x0000, 0x0000, 0x0000, 0x0032, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0122, 0x00d1,
+	    0x0000, 0x0000, 0x03cd, 0x0000, 0x0000, 0x0000, 0x0222, 0x02ea,
+	    0x009f, 0x0286, 0x01fe, 0x02bc, 0x0115, 0x02e0, 0x0000, 0x0270,
+	    0x0000, 0x0000, 0x0000, 0x0101, 0x0253, 0x0000, 0x0000, 0x02f6,
+	    0x00de, 0x0350, 0x0044, 0x0000, 0x004e, 0x0011, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x016b, 0x016c, 0x0000, 0x01ab, 0x0000, 0x00f8,
+	    0x02cd, 0x01d8, 0x0000, 0x0000, 0x002f, 0x032e, 0x018c, 0x009a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x00b2, 0x0000, 0x0000, 0x0000,
+	    0x0285, 0x00d9, 0x0000, 0x02ac, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0173, 0x0000, 0x0117, 0x0000, 0x03c2, 0x0000, 0x0000, 0x0192,
+	    0x007a, 0x017f, 0x02b5, 0x0000, 0x0347, 0x01ab, 0x01ff, 0x0000,
+	    0x022a, 0x0000, 0x00b6, 0x0378, 0x0000, 0x028d, 0x0000, 0x0000,
+	    0x0000, 0x00c5, 0x027b, 0x0000, 0x009e, 0x02e4, 0x0392, 0x001f,
+	    0x02e0, 0x0134, 0x0000, 0x0113, 0x0127, 0x0000, 0x03ba, 0x0000,
+	    0x0000, 0x02a2, 0x0028, 0x0083, 0x007d, 0x0000, 0x0000, 0x0000,
+	    0x0296, 0x0000, 0x02b3, 0x0000, 0x02d6, 0x015b, 0x035b, 0x0000,
+	    0x0000, 0x0000, 0x004a, 0x01e5, 0x005b, 0x01c0, 0x0000, 0x0284,
+	    0x00d4, 0x00aa, 0x024e, 0x039f, 0x0110, 0x016d, 0x020f, 0x0000,
+	    0x0000, 0x0000, 0x001b, 0x0000, 0x02c0, 0x0108, 0x03da, 0x0000,
+	    0x018e, 0x0213, 0x0000, 0x0000, 0x006c, 0x01c1, 0x0310, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x03e1, 0x02df, 0x0000, 0x0000, 0x036f,
+	    0x013c, 0x0022, 0x007a, 0x0308, 0x0000, 0x0000, 0x0389, 0x0000,
+	    0x00e8, 0x038f, 0x0000, 0x0000, 0x020a, 0x03a3, 0x0000, 0x0000,
+	    0x0072, 0x0378, 0x0000, 0x0156, 0x0057, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0349, 0x00f7, 0x02a9, 0x0000, 0x0000, 0x0154,
+	    0x0121, 0x00c8, 0x0000, 0x01ab, 0x0000, 0x00ea, 0x0182, 0x02f2,
+	    0x035a, 0x03c5, 0x0000, 0x0000, 0x0354, 0x0000, 0x01b9, 0x0000,
+	    0x0076, 0x02fd, 0x0000, 0x02fb, 0x0000, 0x020d, 0x0319, 0x019f,
+	    0x0000, 0x0105, 0x0000, 0x0000, 0x0000, 0x0391, 0x0000, 0x03c5,
+	    0x004d, 0x0000, 0x03e1, 0x00e9, 0x0000, 0x0268, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00bf, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x014c, 0x0000, 0x025b, 0x0017, 0x0273, 0x001e, 0x03d0, 0x02e0,
+	    0x0000, 0x0000, 0x0037, 0x0000, 0x025f, 0x0000, 0x0000, 0x014f,
+	    0x03a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0328, 0x0000, 0x0000,
+	    0x0000, 0x0068, 0x0242, 0x0000, 0x0194, 0x0000, 0x0000, 0x010d,
+	    0x00eb, 0x0000, 0x00e7, 0x0000, 0x0000, 0x0000, 0x0012, 0x0000,
+	    0x018f, 0x0000, 0x032d, 0x0000, 0x0000, 0x0240, 0x0000, 0x0000,
+	    0x0000, 0x03e3, 0x03a0, 0x0233, 0x031d, 0x0109, 0x01d0, 0x0000,
+	    0x0000, 0x03e6, 0x0000, 0x0172, 0x01c7, 0x02d8, 0x0000, 0x0173,
+	    0x0124, 0x0000, 0x0331, 0x0000, 0x00c6, 0x0171, 0x03bd, 0x0000,
+	    0x0000, 0x0000, 0x0324, 0x0312, 0x0000, 0x0000, 0x0000, 0x0188,
+	    0x0000, 0x0000, 0x0249, 0x01b9, 0x0017, 0x0000, 0x01da, 0x02c7,
+	    0x0000, 0x0032, 0x0000, 0x017b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0322, 0x0000, 0x0000, 0x02fd,
+	    0x0000, 0x0000, 0x0140, 0x0315, 0x0000, 0x0000, 0x0076, 0x0000,
+	    0x0000, 0x029a, 0x0000, 0x0000, 0x0000, 0x0356, 0x0000, 0x0000,
+	    0x0116, 0x0153, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x027c, 0x0000, 0x0000, 0x02ce, 0x018d, 0x00f0, 0x0000, 0x029f,
+	    0x0000, 0x0000, 0x0320, 0x0050, 0x01e3, 0x0219, 0x0000, 0x03dd,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0005, 0x0000, 0x0234, 0x0000,
+	    0x01c4, 0x025d, 0x00ce, 0x0000, 0x0000, 0x0000, 0x01c2, 0x0102,
+	    0x02c2, 0x01d6, 0x03d4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0084,
+	    0x0082, 0x0000, 0x0000, 0x0000, 0x02f2, 0x015d, 0x007a, 0x0000,
+	    0x01a0, 0x02c6, 0x0000, 0x03ac, 0x0253, 0x0000, 0x02c7, 0x0137,
+	    0x0000, 0x01b5, 0x022d, 0x00f2, 0x0000, 0x0000, 0x0000, 0x0177,
+	    0x0323, 0x0205, 0x0000, 0x0368, 0x0000, 0x0101, 0x024c, 0x0000,
+	    0x0293, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x020d, 0x01e6, 0x0054, 0x0000, 0x0000, 0x0000, 0x032c, 0x0000,
+	    0x02b4, 0x0000, 0x00d4, 0x0000, 0x0090, 0x0359, 0x01ff, 0x03e7,
+	    0x0000, 0x0229, 0x0000, 0x01fd, 0x02b2, 0x0000, 0x0000, 0x0000,
+	    0x01be, 0x0185, 0x0000, 0x02e7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0176, 0x00d5, 0x0000, 0x0000, 0x0000, 0x01ab, 0x0196,
+	    0x0000, 0x0000, 0x0159, 0x03b6, 0x00c4, 0x0190, 0x0000, 0x0257,
+	    0x0000, 0x0000, 0x00e0, 0x03a5, 0x0000, 0x0000, 0x0004, 0x0000,
+	    0x0000, 0x0120, 0x0000, 0x03a5, 0x0065, 0x0233, 0x0000, 0x0000,
+	    0x0000, 0x0206, 0x0000, 0x0000, 0x00da, 0x01a0, 0x0000, 0x01e5,
+	    0x0000, 0x0000, 0x019a, 0x0221, 0x0000, 0x019c, 0x0000, 0x0000,
+	    0x021c, 0x0000, 0x0000, 0x0299, 0x0000, 0x0000, 0x0000, 0x0337,
+	    0x0000, 0x025c, 0x0000, 0x0000, 0x02ab, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x002b, 0x0000, 0x02fa, 0x021b, 0x0000, 0x02b7, 0x026f,
+	    0x0000, 0x0117, 0x007d, 0x0000, 0x0000, 0x02d3, 0x0381, 0x01ae,
+	    0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0307, 0x0139, 0x031e,
+	    0x0204, 0x00b4, 0x0000, 0x006f, 0x0088, 0x01db, 0x0000, 0x0000,
+	    0x027e, 0x0363, 0x0000, 0x00d2, 0x0000, 0x0000, 0x0000, 0x01c0,
+	    0x0000, 0x0392, 0x0284, 0x0000, 0x0000, 0x01f6, 0x0000, 0x0000,
+	    0x03ab, 0x0000, 0x002b, 0x0102, 0x0363, 0x0000, 0x0105, 0x0308,
+	    0x016e, 0x030a, 0x0000, 0x008c, 0x0000, 0x0000, 0x012d, 0x024a,
+	    0x0000, 0x0172, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a8, 0x0010,
+	    0x020e, 0x0121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x027b,
+	    0x0000, 0x027a, 0x00c2, 0x0000, 0x0000, 0x011e, 0x0000, 0x016c,
+	    0x0000, 0x02e7, 0x0000, 0x026f, 0x0000, 0x0000, 0x0250, 0x0000,
+	    0x0000, 0x0297, 0x031a, 0x0281, 0x0048, 0x0000, 0x0000, 0x033f,
+	    0x0325, 0x0000, 0x01d0, 0x001e, 0x0000, 0x0000, 0x0000, 0x0110,
+	    0x0389, 0x037a, 0x004d, 0x017a, 0x0000, 0x0000, 0x0309, 0x0000,
+	    0x0000, 0x00f4, 0x0327, 0x0026, 0x0000, 0x0179, 0x0000, 0x0000,
+	    0x01bd, 0x0000, 0x0000, 0x0000, 0x01ec, 0x0000, 0x015a, 0x0000,
+	    0x013f, 0x0000, 0x0000, 0x0059, 0x01f3, 0x0000, 0x00ff, 0x0000,
+	    0x0000, 0x0000, 0x02a4, 0x02ef, 0x0000, 0x0000, 0x0227, 0x032d,
+	    0x0000, 0x0000, 0x0000, 0x02f5, 0x03cf, 0x02f7, 0x0000, 0x0051,
+	    0x0082, 0x0214, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0366, 0x0315, 0x0000, 0x0000, 0x004f, 0x0000, 0x0000,
+	    0x00d6, 0x00da, 0x0000, 0x0000, 0x03b4, 0x000f, 0x02c9, 0x02ec,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0252, 0x00bd, 0x00db, 0x03c9,
+	    0x0097, 0x0000, 0x0049, 0x0000, 0x007a, 0x0268, 0x0000, 0x0000,
+	    0x0163, 0x0000, 0x002b, 0x0000, 0x003f, 0x0218, 0x0232, 0x01d7,
+	    0x0000, 0x024b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x03b1, 0x00b5, 0x0002, 0x0000, 0x039a, 0x001d, 0x038b, 0x002d,
+	    0x0267, 0x003b, 0x0000, 0x02e2, 0x02ba, 0x0000, 0x0111, 0x01f9,
+	    0x0288, 0x0000, 0x03c2, 0x0000, 0x00c3, 0x034d, 0x0000, 0x0000,
+	    0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0168, 0x01c3, 0x0000, 0x0212, 0x0380, 0x0000, 0x0000,
+	    0x0168, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0176, 0x0223, 0x0000, 0x0000, 0x0000, 0x018a,
+	    0x0027, 0x0000, 0x0000, 0x025b, 0x009a, 0x0390, 0x0167, 0x0000,
+	    0x002b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0393,
+	    0x0270, 0x0000, 0x00e9, 0x0000, 0x00d3, 0x02b1, 0x01a1, 0x0000,
+	    0x00fa, 0x025d, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x013c,
+	    0x0000, 0x0000, 0x0000, 0x03d1, 0x028e, 0x0000, 0x0291, 0x01f3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x00e1, 0x0107, 0x03bb, 0x0340,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0183, 0x02b8, 0x02ef, 0x0106,
+	    0x0169, 0x0000, 0x01d4, 0x02ed, 0x03dc, 0x0000, 0x0276, 0x0000,
+	    0x0000, 0x0000, 0x01a2, 0x0000, 0x0132, 0x0233, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x031c, 0x0000, 0x0171, 0x01d2,
+	    0x03c6, 0x0153, 0x03b0, 0x0088, 0x003b, 0x036a, 0x0000, 0x02cf,
+	    0x0000,
+	};
+	uint16_t h[4];
+
+	crc2(key, keylen, UINT64_C(0x20bd794d6), (uint64_t*)h);
+
+	h[0] = h[0] % 2001;
+	h[1] = h[1] % 2001;
+	return (g[h[0]] + g[h[1]]) % 1000;
+}
@@ -0,0 +1,269 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 605667344, seed[1]: 1963799634 */
+#include <stdint.h>
+#include "fnv3.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[2001] = {
+	    0x0000, 0x0000, 0x0000, 0x02c1, 0x0000, 0x0000, 0x0043, 0x024e,
+	    0x005a, 0x03de, 0x02a3, 0x00e3, 0x028b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0325, 0x0000, 0x0000, 0x039f, 0x0251, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0321, 0x0000, 0x0000, 0x020a, 0x00a4, 0x0000,
+	    0x00dc, 0x02ad, 0x0155, 0x0000, 0x011e, 0x02f5, 0x01b7, 0x0000,
+	    0x0000, 0x0000, 0x023d, 0x0029, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01a0, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f6, 0x0000,
+	    0x0000, 0x0089, 0x0000, 0x0000, 0x0054, 0x01b5, 0x0000, 0x0000,
+	    0x0000, 0x00a5, 0x028b, 0x02e0, 0x033d, 0x0391, 0x006c, 0x0000,
+	    0x0000, 0x0238, 0x00a4, 0x02f2, 0x0133, 0x000d, 0x033d, 0x0000,
+	    0x021a, 0x0000, 0x014d, 0x01db, 0x0000, 0x0293, 0x0000, 0x0000,
+	    0x0000, 0x0244, 0x033c, 0x01e6, 0x0000, 0x03a6, 0x0313, 0x0000,
+	    0x0000, 0x0000, 0x0147, 0x0000, 0x0310, 0x0000, 0x0000, 0x0000,
+	    0x00fb, 0x0000, 0x00c0, 0x0246, 0x0169, 0x0176, 0x0000, 0x0000,
+	    0x0398, 0x0000, 0x0192, 0x0000, 0x0000, 0x03b0, 0x02c8, 0x02b1,
+	    0x0000, 0x0000, 0x017e, 0x003c, 0x03c3, 0x00e2, 0x0000, 0x0250,
+	    0x0206, 0x0309, 0x0000, 0x0000, 0x0000, 0x0046, 0x01d4, 0x0000,
+	    0x01cd, 0x0244, 0x0046, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0231,
+	    0x0283, 0x0000, 0x0000, 0x0022, 0x0225, 0x0000, 0x0176, 0x0205,
+	    0x01a6, 0x0000, 0x02ec, 0x0001, 0x0302, 0x0389, 0x014f, 0x0000,
+	    0x00ba, 0x0034, 0x0000, 0x0000, 0x0000, 0x03cf, 0x0000, 0x032f,
+	    0x0000, 0x0000, 0x0173, 0x0000, 0x0000, 0x0000, 0x02e9, 0x0000,
+	    0x0000, 0x0389, 0x00ba, 0x00f8, 0x0122, 0x0030, 0x0288, 0x0000,
+	    0x0000, 0x0014, 0x00cf, 0x030f, 0x00a8, 0x01bd, 0x0000, 0x0000,
+	    0x0348, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x008c, 0x02c1,
+	    0x00d2, 0x0000, 0x011a, 0x018d, 0x0000, 0x0000, 0x0000, 0x0057,
+	    0x00bf, 0x02e7, 0x015d, 0x0177, 0x00ee, 0x03a3, 0x0000, 0x0184,
+	    0x0000, 0x0000, 0x0000, 0x032c, 0x0000, 0x0000, 0x0144, 0x00d0,
+	    0x003d, 0x036c, 0x02a1, 0x03b7, 0x0224, 0x0000, 0x01e6, 0x0000,
+	    0x0214, 0x0329, 0x008d, 0x0000, 0x00db, 0x0000, 0x0000, 0x0000,
+	    0x03ce, 0x0000, 0x0000, 0x01dc, 0x022e, 0x0280, 0x01ff, 0x0000,
+	    0x0101, 0x003d, 0x0000, 0x0220, 0x01d1, 0x0000, 0x0000, 0x0000,
+	    0x006c, 0x032f, 0x0000, 0x03c7, 0x0351, 0x03e2, 0x007a, 0x0000,
+	    0x014f, 0x032e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0177, 0x01ff, 0x0000, 0x0044, 0x0000, 0x004a, 0x00ab, 0x03a7,
+	    0x02af, 0x0116, 0x0122, 0x02d0, 0x0000, 0x0000, 0x00f7, 0x0000,
+	    0x0000, 0x00bc, 0x0000, 0x0315, 0x0000, 0x0000, 0x0000, 0x000f,
+	    0x0000, 0x0000, 0x0003, 0x0000, 0x02c5, 0x035f, 0x0000, 0x0000,
+	    0x0000, 0x01af, 0x031a, 0x0384, 0x03d0, 0x001a, 0x0000, 0x0000,
+	    0x0139, 0x0000, 0x01c0, 0x0000, 0x024f, 0x01ac, 0x0254, 0x0363,
+	    0x038f, 0x0168, 0x0068, 0x00c3, 0x0162, 0x0000, 0x0000, 0x0011,
+	    0x0000, 0x0171, 0x0000, 0x0000, 0x0000, 0x0041, 0x00b6, 0x01c8,
+	    0x0000, 0x0000, 0x0000, 0x035a, 0x0000, 0x0220, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x008b, 0x0230, 0x0000, 0x0000,
+	    0x0337, 0x025e, 0x0000, 0x0209, 0x0000, 0x0000, 0x0000, 0x034b,
+	    0x02ab, 0x036f, 0x00b7, 0x0000, 0x0000, 0x032b, 0x01b6, 0x0000,
+	    0x02a9, 0x023c, 0x0000, 0x01b8, 0x0000, 0x034b, 0x011c, 0x02d0,
+	    0x0000, 0x0000, 0x0130, 0x0000, 0x0000, 0x021e, 0x0000, 0x0000,
+	    0x0374, 0x0000, 0x0000, 0x0260, 0x0000, 0x00bb, 0x0250, 0x0000,
+	    0x0000, 0x038f, 0x0299, 0x03dd, 0x0000, 0x025f, 0x01a3, 0x0189,
+	    0x03d8, 0x0000, 0x0000, 0x03c1, 0x0000, 0x01b5, 0x024a, 0x0000,
+	    0x0000, 0x009a, 0x0000, 0x026f, 0x0000, 0x0000, 0x0361, 0x01a4,
+	    0x0000, 0x0000, 0x00fd, 0x0000, 0x0352, 0x0051, 0x02d4, 0x0367,
+	    0x0000, 0x0000, 0x023c, 0x01a4, 0x01b3, 0x0294, 0x0387, 0x03ba,
+	    0x03e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0147,
+	    0x0310, 0x0354, 0x03ab, 0x0000, 0x0250, 0x0103, 0x0000, 0x0000,
+	    0x0125, 0x03af, 0x0286, 0x0000, 0x03c5, 0x000c, 0x0253, 0x0000,
+	    0x02be, 0x0387, 0x0000, 0x0000, 0x0000, 0x0134, 0x0000, 0x017c,
+	    0x0000, 0x00bf, 0x0000, 0x01c2, 0x01e8, 0x01fd, 0x0000, 0x0000,
+	    0x0257, 0x02db, 0x0346, 0x01b8, 0x005f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x015c, 0x0000, 0x0000, 0x01c6, 0x0000, 0x0000,
+	    0x01bf, 0x0000, 0x0156, 0x01d2, 0x00f4, 0x01e9, 0x0170, 0x0000,
+	    0x028f, 0x003a, 0x01b2, 0x0000, 0x01d4, 0x01b8, 0x0000, 0x0000,
+	    0x0068, 0x0097, 0x00b9, 0x0000, 0x0000, 0x016d, 0x03db, 0x0000,
+	    0x02e7, 0x0000, 0x0026, 0x0000, 0x0000, 0x01e3, 0x0037, 0x0360,
+	    0x0150, 0x0000, 0x0083, 0x0000, 0x0004, 0x023f, 0x0000, 0x0000,
+	    0x0000, 0x0011, 0x0000, 0x0000, 0x0102, 0x002b, 0x0264, 0x0000,
+	    0x0000, 0x0343, 0x0000, 0x003c, 0x0192, 0x018b, 0x0000, 0x00d4,
+	    0x0000, 0x009a, 0x0052, 0x03bc, 0x026f, 0x0000, 0x0332, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0382, 0x01fa, 0x032c, 0x0000,
+	    0x0092, 0x00a7, 0x0000, 0x0305, 0x02aa, 0x0000, 0x000e, 0x0157,
+	    0x0356, 0x0000, 0x02f8, 0x0000, 0x0000, 0x0000, 0x00a4, 0x0000,
+	    0x029e, 0x0248, 0x0000, 0x007c, 0x0000, 0x0044, 0x0000, 0x0000,
+	    0x02ff, 0x0215, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01f3, 0x03a1, 0x00b5, 0x019e, 0x00f8, 0x00f1, 0x01d8,
+	    0x0000, 0x0000, 0x02c6, 0x015e, 0x0000, 0x007b, 0x0394, 0x027d,
+	    0x02d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0218, 0x00ad,
+	    0x0199, 0x0243, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02a8,
+	    0x037a, 0x0000, 0x0000, 0x00b0, 0x0000, 0x0023, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x01c4, 0x0000, 0x0000, 0x0000, 0x023a, 0x0039,
+	    0x0063, 0x0249, 0x0193, 0x0000, 0x030e, 0x0000, 0x0104, 0x0000,
+	    0x03d1, 0x0000, 0x02fd, 0x0000, 0x0000, 0x0000, 0x03d2, 0x02bb,
+	    0x016c, 0x012a, 0x009e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x023b, 0x0076, 0x0251, 0x017c, 0x0000, 0x0000, 0x0000,
+	    0x00df, 0x0000, 0x0294, 0x03df, 0x0000, 0x029c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0117, 0x00ff, 0x027f, 0x03e7, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02c8, 0x036c, 0x0000, 0x0000, 0x0121,
+	    0x0000, 0x0000, 0x0349, 0x0144, 0x02ed, 0x01a8, 0x0000, 0x0000,
+	    0x01e9, 0x02c7, 0x0378, 0x0000, 0x02bc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x036a, 0x0086, 0x0000, 0x0123, 0x00a5, 0x01d0,
+	    0x0000, 0x02f1, 0x0000, 0x0010, 0x0000, 0x018e, 0x028a, 0x0000,
+	    0x0000, 0x0150, 0x0000, 0x0000, 0x0000, 0x024d, 0x0000, 0x00c4,
+	    0x0000, 0x00b8, 0x0000, 0x0000, 0x02b2, 0x031f, 0x0390, 0x0000,
+	    0x01cd, 0x0000, 0x0000, 0x0351, 0x0000, 0x0341, 0x0000, 0x013e,
+	    0x0000, 0x0000, 0x026c, 0x0000, 0x01eb, 0x03d5, 0x0389, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0051, 0x0000, 0x0000, 0x03e5, 0x0000,
+	    0x0000, 0x0000, 0x01ea, 0x0000, 0x0367, 0x0000, 0x022d, 0x0000,
+	    0x0000, 0x0135, 0x02bc, 0x02c9, 0x0000, 0x03bb, 0x0059, 0x01af,
+	    0x0398, 0x0000, 0x0000, 0x0122, 0x004c, 0x00e0, 0x0000, 0x022a,
+	    0x0078, 0x0000, 0x0000, 0x02c9, 0x02ee, 0x0000, 0x0000, 0x005e,
+	    0x0000, 0x0257, 0x0000, 0x02f2, 0x02fb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0030, 0x0216, 0x0121, 0x0000, 0x02df, 0x0000, 0x0000,
+	    0x0000, 0x0285, 0x0000, 0x0000, 0x0000, 0x02f7, 0x0123, 0x0000,
+	    0x03bf, 0x0000, 0x0000, 0x0000, 0x022e, 0x03bd, 0x002c, 0x0108,
+	    0x01da, 0x02d7, 0x0009, 0x0041, 0x00e3, 0x0000, 0x0000, 0x015e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0067, 0x01fb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02fa, 0x0000,
+	    0x02d1, 0x0000, 0x0000, 0x0000, 0x0319, 0x0379, 0x017b, 0x014d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0306, 0x02f8,
+	    0x0000, 0x0245, 0x0000, 0x007d, 0x0000, 0x0379, 0x0000, 0x0000,
+	    0x0000, 0x00ee, 0x014e, 0x0098, 0x0000, 0x0000, 0x0000, 0x01e3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0144, 0x0170, 0x0000, 0x0000,
+	    0x0000, 0x0179, 0x032a, 0x0000, 0x016a, 0x01cf, 0x0000, 0x0000,
+	    0x02d8, 0x0000, 0x0000, 0x01a2, 0x0000, 0x0361, 0x0000, 0x02f8,
+	    0x0366, 0x00b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0269,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x035f,
+	    0x0000, 0x0213, 0x019e, 0x0000, 0x0374, 0x01f5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0349, 0x0104, 0x0000, 0x0376, 0x02ca, 0x00c2,
+	    0x0184, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a2, 0x0000,
+	    0x0241, 0x0000, 0x0000, 0x0000, 0x0079, 0x02ac, 0x000b, 0x0000,
+	    0x0000, 0x023a, 0x02e1, 0x0000, 0x0066, 0x0256, 0x0105, 0x0000,
+	    0x01a0, 0x0282, 0x031e, 0x01e8, 0x02a2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00ac, 0x0000, 0x01af, 0x0000, 0x0000, 0x0000,
+	    0x00ec, 0x02f2, 0x0072, 0x0028, 0x0002, 0x0067, 0x03b8, 0x01d6,
+	    0x0186, 0x0000, 0x01a5, 0x0097, 0x0000, 0x039f, 0x0000, 0x03d4,
+	    0x0000, 0x01dc, 0x01aa, 0x0000, 0x0000, 0x0364, 0x0000, 0x0045,
+	    0x0360, 0x03d7, 0x0000, 0x03cc, 0x0000, 0x0018, 0x0000, 0x0267,
+	    0x0000, 0x0000, 0x0000, 0x00f5, 0x0020, 0x0274, 0x0166, 0x0000,
+	    0x008c, 0x0000, 0x0000, 0x025e, 0x0000, 0x00be, 0x0311, 0x02f0,
+	    0x0000, 0x0357, 0x0017, 0x0000, 0x002f, 0x006d, 0x015f, 0x0000,
+	    0x0000, 0x03db, 0x0115, 0x0000, 0x0338, 0x008b, 0x0254, 0x03b3,
+	    0x017b, 0x0261, 0x0000, 0x0000, 0x03b6, 0x029f, 0x02f3, 0x0000,
+	    0x02d9, 0x035e, 0x03ce, 0x0000, 0x0000, 0x021c, 0x00e3, 0x0000,
+	    0x025d, 0x0000, 0x0000, 0x00b4, 0x0000, 0x0000, 0x0000, 0x02e7,
+	    0x0000, 0x01c3, 0x002f, 0x031c, 0x0000, 0x0000, 0x0000, 0x015a,
+	    0x0000, 0x013c, 0x0000, 0x0000, 0x000a, 0x0335, 0x02cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0161, 0x017f, 0x0000, 0x01f9, 0x0000,
+	    0x030a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0384, 0x01c7,
+	    0x0000, 0x00a0, 0x012b, 0x0000, 0x0266, 0x020f, 0x0000, 0x0334,
+	    0x02d8, 0x0000, 0x01f2, 0x0000, 0x02f4, 0x0000, 0x004f, 0x0000,
+	    0x03ce, 0x0000, 0x01d7, 0x0024, 0x0000, 0x0000, 0x02d5, 0x0000,
+	    0x03d7, 0x0300, 0x0000, 0x0095, 0x0037, 0x01ee, 0x0000, 0x03c2,
+	    0x0000, 0x003c, 0x0000, 0x0018, 0x0000, 0x0000, 0x0021, 0x034d,
+	    0x0000, 0x0172, 0x014b, 0x0000, 0x0061, 0x0000, 0x0223, 0x0027,
+	    0x01ca, 0x0000, 0x0000, 0x03b6, 0x02a6, 0x0000, 0x0000, 0x0000,
+	    0x01d3, 0x0049, 0x0121, 0x0000, 0x0201, 0x0000, 0x0000, 0x039e,
+	    0x0368, 0x0214, 0x0000, 0x0000, 0x0000, 0x0000, 0x022f, 0x0163,
+	    0x00c8, 0x0000, 0x0119, 0x0000, 0x0246, 0x0308, 0x0000, 0x0000,
+	    0x01c1, 0x0000, 0x0000, 0x02b8, 0x0000, 0x0000, 0x0120, 0x0275,
+	    0x0000, 0x00c2, 0x0026, 0x03bf, 0x001c, 0x0000, 0x0254, 0x0285,
+	    0x0000, 0x0000, 0x0000, 0x010a, 0x0131, 0x0000, 0x01ec, 0x0000,
+	    0x03c9, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x0000, 0x0085,
+	    0x0000, 0x0000, 0x0120, 0x0000, 0x0000, 0x013b, 0x0000, 0x0000,
+	    0x004b, 0x00e0, 0x0000, 0x0000, 0x0000, 0x000d, 0x004f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x013a, 0x0314, 0x0000, 0x0000, 0x0000,
+	    0x00ab, 0x02af, 0x0000, 0x0000, 0x0000, 0x01c9, 0x0000, 0x033d,
+	    0x0111, 0x0000, 0x026c, 0x0000, 0x034f, 0x0000, 0x0000, 0x0233,
+	    0x00db, 0x009f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0005, 0x0000,
+	    0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x00e8, 0x0000, 0x0000, 0x0143, 0x0247, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01e8, 0x0156, 0x0000, 0x03b4, 0x01af,
+	    0x0000, 0x0290, 0x0000, 0x02af, 0x0000, 0x004e, 0x0000, 0x0221,
+	    0x0000, 0x0338, 0x0086, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0358, 0x03da, 0x0000, 0x02e6, 0x0000, 0x039c, 0x0000,
+	    0x00e0, 0x0000, 0x0000, 0x0000, 0x0242, 0x0064, 0x0000, 0x0017,
+	    0x0000, 0x0000, 0x0190, 0x002c, 0x02d4, 0x012d, 0x002d, 0x0327,
+	    0x0000, 0x0000, 0x001a, 0x0189, 0x0008, 0x0087, 0x00f7, 0x02d2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012f,
+	    0x02c4, 0x0000, 0x0066, 0x00b0, 0x0000, 0x0000, 0x0000, 0x02bc,
+	    0x0000, 0x0000, 0x017f, 0x0000, 0x0000, 0x0278, 0x0000, 0x03d2,
+	    0x0000, 0x0000, 0x0323, 0x0000, 0x000b, 0x016e, 0x0000, 0x0270,
+	    0x0000, 0x002d, 0x0000, 0x03e4, 0x0000, 0x0000, 0x0000, 0x005e,
+	    0x0284, 0x0318, 0x00c6, 0x00c6, 0x0000, 0x01e3, 0x0000, 0x0000,
+	    0x0000, 0x0113, 0x0000, 0x02b4, 0x0000, 0x0000, 0x02dc, 0x0000,
+	    0x0000, 0x0000, 0x0358, 0x0149, 0x007e, 0x0000, 0x01c7, 0x01eb,
+	    0x018d, 0x0000, 0x0373, 0x0000, 0x01ac, 0x0109, 0x00b3, 0x0000,
+	    0x02e5, 0x0000, 0x0000, 0x0000, 0x02f8, 0x0000, 0x02ba, 0x0000,
+	    0x0000, 0x02f0, 0x01b1, 0x017d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02e2, 0x01dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0383, 0x0229, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01b3, 0x021f, 0x037d, 0x022c, 0x0000, 0x01f7, 0x0000, 0x0029,
+	    0x0000, 0x0169, 0x0000, 0x0263, 0x0254, 0x0000, 0x0000, 0x017f,
+	    0x0000, 0x0000, 0x0000, 0x0380, 0x0000, 0x03e2, 0x0000, 0x0037,
+	    0x011c, 0x02da, 0x0000, 0x0000, 0x0150, 0x0004, 0x0000, 0x0075,
+	    0x0064, 0x0278, 0x0000, 0x0204, 0x0156, 0x0000, 0x006f, 0x031c,
+	    0x0000, 0x02f4, 0x0000, 0x0000, 0x0352, 0x0000, 0x0047, 0x03a2,
+	    0x0271, 0x0000, 0x0315, 0x0000, 0x01b1, 0x031d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x01e6, 0x0000, 0x0000, 0x0000,
+	    0x0163, 0x0000, 0x00f1, 0x0000, 0x01dd, 0x037d, 0x0094, 0x0102,
+	    0x01a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x03c5, 0x0000, 0x0071,
+	    0x0314, 0x0000, 0x0211, 0x0050, 0x0132, 0x0000, 0x0000, 0x015f,
+	    0x0116, 0x0052, 0x01b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x019c, 0x0000, 0x0337, 0x0000, 0x0000, 0x0000, 0x008b, 0x025f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01cf, 0x0000, 0x03b2,
+	    0x01ce, 0x02d1, 0x0000, 0x0000, 0x0000, 0x00a0, 0x0000, 0x01dd,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x008f, 0x01bc, 0x0000, 0x01fb,
+	    0x0000, 0x03ca, 0x0160, 0x0165, 0x0000, 0x01df, 0x0000, 0x02f8,
+	    0x0000, 0x0050, 0x0067, 0x0039, 0x034e, 0x03c6, 0x039b, 0x00e3,
+	    0x0156, 0x0000, 0x0000, 0x0000, 0x012f, 0x0000, 0x0178, 0x0255,
+	    0x0000, 0x0000, 0x019a, 0x0000, 0x035e, 0x026d, 0x0277, 0x0000,
+	    0x00ac, 0x0000, 0x032d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0312,
+	    0x0000, 0x0359, 0x0306, 0x01cd, 0x0000, 0x033f, 0x0318, 0x0000,
+	    0x0000, 0x0000, 0x01f2, 0x0000, 0x0279, 0x0000, 0x0235, 0x0000,
+	    0x0000, 0x0035, 0x00de, 0x0000, 0x038b, 0x011e, 0x0000, 0x0112,
+	    0x0000, 0x0000, 0x00ea, 0x0000, 0x0145, 0x0000, 0x0000, 0x0000,
+	    0x0137, 0x0000, 0x0000, 0x00a0, 0x0295, 0x0005, 0x0000, 0x0000,
+	    0x00c4, 0x0000, 0x0000, 0x00c1, 0x029b, 0x0000, 0x0000, 0x016d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0181, 0x0385, 0x0000, 0x0000,
+	    0x0023, 0x022d, 0x0000, 0x01dd, 0x0000, 0x01d7, 0x0028, 0x0000,
+	    0x0000, 0x02e1, 0x0000, 0x0157, 0x0000, 0x03c1, 0x0350, 0x031f,
+	    0x0000, 0x0000, 0x0143, 0x0000, 0x02e8, 0x03e0, 0x0000, 0x0230,
+	    0x0000, 0x01fc, 0x0356, 0x0053, 0x0000, 0x0000, 0x0000, 0x00e0,
+	    0x0236, 0x0000, 0x023e, 0x0000, 0x0000, 0x0163, 0x0000, 0x020f,
+	    0x0386, 0x0000, 0x0188, 0x00cb, 0x0000, 0x0000, 0x00df, 0x00b2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0153, 0x009f, 0x005b, 0x0000,
+	    0x0000, 0x0000, 0x03e1, 0x004a, 0x009a, 0x0000, 0x0016, 0x001b,
+	    0x025f, 0x0000, 0x0000, 0x032f, 0x00d9, 0x0133, 0x0230, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0136, 0x027a, 0x0129, 0x0000, 0x0000,
+	    0x00a6, 0x0000, 0x0000, 0x016c, 0x03b3, 0x0000, 0x0000, 0x0000,
+	    0x0219, 0x02cb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0133, 0x03d3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00cf, 0x0000, 0x0157, 0x0000, 0x023f, 0x0273,
+	    0x0261, 0x007a, 0x0000, 0x0000, 0x009b, 0x0000, 0x0000, 0x0000,
+	    0x00a5, 0x0368, 0x026c, 0x0354, 0x0000, 0x0000, 0x0000, 0x01cc,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x035e, 0x03b8, 0x0268, 0x008e,
+	    0x0000, 0x02e4, 0x0000, 0x033f, 0x0242, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03d7, 0x00f2, 0x038b, 0x028a, 0x03d6, 0x00e1, 0x0332,
+	    0x0000, 0x02a6, 0x0000, 0x03bc, 0x008b, 0x01a1, 0x02b1, 0x0000,
+	    0x0000, 0x0000, 0x0063, 0x0000, 0x0000, 0x00db, 0x0087, 0x0000,
+	    0x027e, 0x0000, 0x02c0, 0x0000, 0x03d6, 0x030b, 0x0255, 0x0000,
+	    0x00fe, 0x0397, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x0000,
+	    0x018f, 0x0042, 0x00f1, 0x00c7, 0x0080, 0x0289, 0x0000, 0x02d8,
+	    0x0000, 0x03c1, 0x0000, 0x0000, 0x0108, 0x0246, 0x02a5, 0x010b,
+	    0x0000, 0x013c, 0x0000, 0x0188, 0x0225, 0x01d3, 0x03cb, 0x035c,
+	    0x0000, 0x0000, 0x0013, 0x019c, 0x0000, 0x0304, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x03e1, 0x0000, 0x0227, 0x01d0,
+	    0x0089, 0x0019, 0x02c2, 0x0000, 0x003c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0157, 0x02aa, 0x0000, 0x02ca,
+	    0x000b, 0x0000, 0x0000, 0x0000, 0x00e2, 0x0000, 0x0020, 0x0254,
+	    0x03aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x014c, 0x0000, 0x0297, 0x0000,
+	    0x03d3, 0x02d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03bf,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a8, 0x0000, 0x01d9,
+	    0x003b, 0x0350, 0x0000, 0x0052, 0x0000, 0x0000, 0x0000, 0x00f3,
+	    0x0000, 0x0000, 0x0000, 0x01c8, 0x03be, 0x0000, 0x03ac, 0x0331,
+	    0x0000, 0x0000, 0x00d0, 0x0000, 0x0000, 0x03b6, 0x00a9, 0x02aa,
+	    0x0000, 0x000e, 0x0240, 0x0000, 0x0000, 0x0000, 0x0000, 0x03d4,
+	    0x01bb, 0x0000, 0x00d6, 0x0000, 0x03e6, 0x0000, 0x0100, 0x0258,
+	    0x0224, 0x020e, 0x0000, 0x0000, 0x0088, 0x026d, 0x0004, 0x002e,
+	    0x0000,
+	};
+	uint16_t h[4];
+
+	fnv(key, keylen, UINT64_C(0x750d34522419c010), (uint64_t*)h);
+
+	h[0] = h[0] % 2001;
+	h[1] = h[1] % 2001;
+	return (g[h[0]] + g[h[1]]) % 1000;
+}
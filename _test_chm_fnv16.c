@@ -0,0 +1,269 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 596516649, seed[1]: 1189641421 */
+#include <stdint.h>
+#include "fnv16.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[2001] = {
+	    0x0000, 0x0200, 0x0033, 0x01e0, 0x036b, 0x0147, 0x020d, 0x0000,
+	    0x0000, 0x0000, 0x0281, 0x0000, 0x01c6, 0x0000, 0x0000, 0x0316,
+	    0x0000, 0x0000, 0x0000, 0x03ae, 0x0228, 0x02ac, 0x0237, 0x008f,
+	    0x0000, 0x012a, 0x017b, 0x0000, 0x0260, 0x029f, 0x039d, 0x020b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x02ca, 0x016a, 0x023d, 0x0000,
+	    0x0000, 0x0054, 0x01a2, 0x0000, 0x02c1, 0x0253, 0x0271, 0x01ea,
+	    0x0000, 0x025f, 0x02b6, 0x0390, 0x0000, 0x0000, 0x01ed, 0x0000,
+	    0x0234, 0x0000, 0x0000, 0x0000, 0x0359, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0055, 0x0000, 0x0000, 0x022b, 0x0000, 0x0350, 0x0000,
+	    0x0000, 0x0078, 0x0000, 0x0000, 0x0000, 0x00f0, 0x000b, 0x03e6,
+	    0x02ae, 0x0000, 0x0000, 0x01ab, 0x01e4, 0x0299, 0x0000, 0x018d,
+	    0x0161, 0x0000, 0x0000, 0x02a7, 0x0000, 0x0000, 0x0321, 0x0000,
+	    0x0000, 0x03b1, 0x01a3, 0x0000, 0x01f9, 0x03d7, 0x00e3, 0x028d,
+	    0x02bc, 0x00ff, 0x002d, 0x0000, 0x0000, 0x0105, 0x02e4, 0x02c8,
+	    0x028f, 0x02b0, 0x0000, 0x0000, 0x02da, 0x02e8, 0x0000, 0x03a7,
+	    0x0384, 0x018e, 0x020f, 0x02c6, 0x0382, 0x008a, 0x0061, 0x0164,
+	    0x0000, 0x0000, 0x0000, 0x01bb, 0x027d, 0x0000, 0x0000, 0x0071,
+	    0x0000, 0x0311, 0x0000, 0x0028, 0x0000, 0x0000, 0x00fd, 0x0000,
+	    0x0000, 0x00d2, 0x037c, 0x0131, 0x021d, 0x0062, 0x01b3, 0x035f,
+	    0x039b, 0x0000, 0x01e8, 0x0000, 0x01b9, 0x0000, 0x03b0, 0x00f0,
+	    0x0000, 0x015f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0254, 0x032b,
+	    0x0000, 0x0010, 0x032e, 0x0084, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x015a, 0x0261, 0x0000, 0x0000, 0x0000, 0x00cc, 0x0000, 0x0028,
+	    0x0000, 0x01ea, 0x036f, 0x00ea, 0x0000, 0x0000, 0x0174, 0x0223,
+	    0x02ad, 0x0124, 0x0292, 0x0000, 0x01ea, 0x0037, 0x0305, 0x0209,
+	    0x0000, 0x0000, 0x0000, 0x037a, 0x0144, 0x025c, 0x02aa, 0x0054,
+	    0x006c, 0x024a, 0x0000, 0x02d1, 0x01c0, 0x0000, 0x03ae, 0x0000,
+	    0x0000, 0x01eb, 0x02ca, 0x0000, 0x026a, 0x027d, 0x0000, 0x024a,
+	    0x0000, 0x0018, 0x0164, 0x0355, 0x0000, 0x0000, 0x0000, 0x02c5,
+	    0x0000, 0x0000, 0x00bf, 0x0000, 0x01e6, 0x000f, 0x029d, 0x0000,
+	    0x00bf, 0x0109, 0x0000, 0x0000, 0x0379, 0x018b, 0x0000, 0x00b9,
+	    0x0000, 0x01e2, 0x0000, 0x02a4, 0x0000, 0x0000, 0x0000, 0x02a6,
+	    0x0000, 0x0000, 0x0000, 0x0188, 0x02c6, 0x0000, 0x01a3, 0x0000,
+	    0x0019, 0x03bf, 0x0208, 0x0000, 0x02be, 0x0000, 0x012b, 0x0000,
+	    0x01f2, 0x0000, 0x0000, 0x0298, 0x0000, 0x03ce, 0x02ba, 0x02ef,
+	    0x02b5, 0x0000, 0x01fb, 0x0000, 0x01a1, 0x0000, 0x0000, 0x0160,
+	    0x00cc, 0x0000, 0x0000, 0x00bb, 0x0000, 0x0000, 0x019a, 0x0190,
+	    0x0326, 0x017c, 0x02c6, 0x03bd, 0x0000, 0x0000, 0x03d6, 0x0000,
+	    0x019f, 0x013d, 0x0000, 0x038a, 0x01c5, 0x02d7, 0x0233, 0x0000,
+	    0x0000, 0x018a, 0x0040, 0x0000, 0x031b, 0x00ac, 0x0000, 0x0173,
+	    0x0275, 0x0000, 0x00f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01a2, 0x0233, 0x03d1, 0x01c2, 0x00aa, 0x0192, 0x0000,
+	    0x039c, 0x00a3, 0x0000, 0x01a7, 0x0297, 0x02ae, 0x0156, 0x039a,
+	    0x005e, 0x00f9, 0x02c8, 0x030b, 0x0280, 0x0000, 0x0278, 0x0000,
+	    0x0000, 0x0000, 0x00bc, 0x0000, 0x0024, 0x0000, 0x0000, 0x02d4,
+	    0x0000, 0x0000, 0x025a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01d9, 0x01d3, 0x0085, 0x0370, 0x0000,
+	    0x0000, 0x0347, 0x0000, 0x004c, 0x0000, 0x006b, 0x0000, 0x0000,
+	    0x00d6, 0x03d8, 0x0260, 0x01cc, 0x0000, 0x0000, 0x0137, 0x01f7,
+	    0x00c2, 0x0202, 0x01be, 0x0000, 0x0075, 0x0000, 0x028b, 0x0127,
+	    0x0000, 0x0000, 0x0111, 0x0071, 0x0000, 0x01ec, 0x011b, 0x0000,
+	    0x02e4, 0x0000, 0x0000, 0x03e6, 0x0000, 0x0289, 0x0335, 0x0000,
+	    0x0257, 0x0351, 0x03d1, 0x0108, 0x009c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x036d, 0x0000, 0x0000, 0x023c, 0x0000, 0x0000,
+	    0x0358, 0x038f, 0x0000, 0x0053, 0x0000, 0x0338, 0x0000, 0x0000,
+	    0x00e9, 0x03b5, 0x0360, 0x0030, 0x01a1, 0x0000, 0x03b7, 0x0000,
+	    0x0000, 0x038d, 0x0218, 0x0000, 0x0000, 0x0000, 0x024e, 0x0000,
+	    0x0000, 0x0000, 0x00e0, 0x0000, 0x0000, 0x01cd, 0x001e, 0x0000,
+	    0x0098, 0x0000, 0x0000, 0x0272, 0x0000, 0x0235, 0x0306, 0x0000,
+	    0x017e, 0x0000, 0x029f, 0x0000, 0x026e, 0x0000, 0x01b7, 0x01e8,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02db, 0x03d2, 0x0398,
+	    0x0000, 0x003f, 0x0000, 0x0191, 0x0000, 0x02c7, 0x03ad, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0105, 0x03b4, 0x039e,
+	    0x0000, 0x0201, 0x00f5, 0x0000, 0x0099, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01c8, 0x01e9, 0x0000, 0x0000, 0x0037, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c9, 0x02a3, 0x00db,
+	    0x0295, 0x0000, 0x023f, 0x0042, 0x021f, 0x02af, 0x0000, 0x0164,
+	    0x0250, 0x0000, 0x00c0, 0x01f6, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x00cb, 0x015f, 0x0107, 0x00bd, 0x0000, 0x02b7, 0x00b7,
+	    0x0000, 0x0000, 0x0000, 0x0168, 0x0000, 0x0000, 0x018c, 0x0000,
+	    0x0350, 0x0231, 0x0000, 0x0115, 0x02be, 0x0000, 0x0000, 0x000b,
+	    0x0000, 0x0000, 0x0000, 0x0065, 0x02dd, 0x003a, 0x0031, 0x01b6,
+	    0x0000, 0x0000, 0x0102, 0x0000, 0x024f, 0x0000, 0x0106, 0x02d9,
+	    0x0157, 0x0000, 0x02f7, 0x0000, 0x00ee, 0x0245, 0x028a, 0x004a,
+	    0x00c6, 0x02ad, 0x03b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0067,
+	    0x0000, 0x0000, 0x039d, 0x0266, 0x002b, 0x03cb, 0x035c, 0x0000,
+	    0x0000, 0x00ea, 0x0235, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0168, 0x0000, 0x0000, 0x0040, 0x00b0, 0x0022, 0x016e, 0x0000,
+	    0x0000, 0x01b4, 0x0000, 0x029a, 0x0000, 0x0000, 0x0127, 0x0000,
+	    0x024b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0217, 0x0000, 0x0100,
+	    0x0000, 0x03d9, 0x0000, 0x012f, 0x0000, 0x0000, 0x01ca, 0x03b2,
+	    0x029d, 0x0000, 0x0000, 0x0082, 0x0000, 0x0205, 0x0000, 0x0392,
+	    0x0329, 0x01ff, 0x0265, 0x0000, 0x0000, 0x0000, 0x0208, 0x0000,
+	    0x0000, 0x0000, 0x0203, 0x0305, 0x0000, 0x02ca, 0x0318, 0x025b,
+	    0x0029, 0x0137, 0x0179, 0x0391, 0x03bd, 0x0000, 0x0183, 0x020f,
+	    0x0000, 0x0184, 0x0000, 0x0000, 0x03d0, 0x0000, 0x02b4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03e4, 0x0000, 0x0000,
+	    0x0000, 0x02ac, 0x00ee, 0x01d5, 0x0000, 0x03c7, 0x0000, 0x0000,
+	    0x0248, 0x0000, 0x03bd, 0x012e, 0x0000, 0x0000, 0x0078, 0x00f8,
+	    0x0000, 0x0000, 0x0293, 0x000a, 0x0000, 0x0174, 0x0151, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02a4, 0x0000, 0x0078, 0x0000, 0x0259,
+	    0x0000, 0x03da, 0x0305, 0x01d7, 0x039b, 0x031a, 0x01cd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0065, 0x0199, 0x021f, 0x0000, 0x0087,
+	    0x0222, 0x0000, 0x0000, 0x0000, 0x01c1, 0x0000, 0x0000, 0x01f8,
+	    0x02e2, 0x03d5, 0x0000, 0x01cf, 0x0000, 0x03b1, 0x0073, 0x0116,
+	    0x0000, 0x005e, 0x0279, 0x017d, 0x0026, 0x0000, 0x0000, 0x0000,
+	    0x01a2, 0x0233, 0x0279, 0x0343, 0x0000, 0x0000, 0x01c7, 0x0000,
+	    0x0000, 0x026e, 0x0211, 0x0000, 0x0000, 0x0000, 0x02d9, 0x02b1,
+	    0x0000, 0x0000, 0x039e, 0x0000, 0x0000, 0x00b5, 0x0000, 0x0000,
+	    0x0000, 0x03ca, 0x02fa, 0x03d2, 0x0000, 0x0000, 0x0194, 0x0000,
+	    0x0000, 0x02b6, 0x0000, 0x0064, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0103, 0x03a6, 0x0000, 0x0000, 0x0000, 0x024f, 0x0000, 0x02a4,
+	    0x0059, 0x0000, 0x0000, 0x029c, 0x015b, 0x0125, 0x0021, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02ab, 0x0367, 0x03e0, 0x01f4, 0x0000,
+	    0x0222, 0x00e3, 0x0000, 0x0189, 0x01d5, 0x0000, 0x0000, 0x00fb,
+	    0x0247, 0x0000, 0x0000, 0x0000, 0x0000, 0x0356, 0x0000, 0x0000,
+	    0x0332, 0x0000, 0x0000, 0x01aa, 0x0043, 0x03e2, 0x0000, 0x008e,
+	    0x0398, 0x015b, 0x0000, 0x0000, 0x0000, 0x0000, 0x03cf, 0x03d2,
+	    0x0000, 0x032a, 0x00b6, 0x0000, 0x0001, 0x0014, 0x0000, 0x02d0,
+	    0x0000, 0x011b, 0x02a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ed,
+	    0x02f5, 0x0284, 0x01e8, 0x0000, 0x01d0, 0x00f8, 0x02f7, 0x0000,
+	    0x0000, 0x0053, 0x0000, 0x0000, 0x0000, 0x0000, 0x02bb, 0x0000,
+	    0x0000, 0x0000, 0x0137, 0x00c0, 0x01c5, 0x0100, 0x0000, 0x0000,
+	    0x01c2, 0x034b, 0x01f1, 0x0000, 0x0000, 0x0000, 0x02c4, 0x00bb,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0176, 0x0069, 0x0170, 0x019b,
+	    0x0000, 0x027f, 0x0323, 0x0000, 0x02bc, 0x0000, 0x0207, 0x00a1,
+	    0x034e, 0x0000, 0x0000, 0x0006, 0x0000, 0x0000, 0x0000, 0x0137,
+	    0x01bb, 0x0000, 0x017c, 0x0000, 0x036f, 0x036e, 0x037d, 0x01c9,
+	    0x0000, 0x0074, 0x0000, 0x035f, 0x0272, 0x032f, 0x0000, 0x0000,
+	    0x03e4, 0x0097, 0x038a, 0x0000, 0x0000, 0x0000, 0x027e, 0x02be,
+	    0x0000, 0x02f5, 0x0000, 0x017c, 0x0000, 0x033f, 0x0000, 0x0000,
+	    0x03af, 0x0219, 0x0000, 0x031e, 0x01bc, 0x017f, 0x00f2, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x008b, 0x03c5,
+	    0x0000, 0x033d, 0x0216, 0x0000, 0x0000, 0x0000, 0x0039, 0x00f6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x038c, 0x0000,
+	    0x0000, 0x0000, 0x01a9, 0x01ee, 0x0000, 0x0000, 0x0000, 0x01fc,
+	    0x0000, 0x0000, 0x0000, 0x012b, 0x026e, 0x01c6, 0x02ea, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0196, 0x00b5, 0x0035, 0x0000,
+	    0x0086, 0x0000, 0x0000, 0x036e, 0x00ad, 0x0000, 0x01aa, 0x0000,
+	    0x0000, 0x0000, 0x0174, 0x0301, 0x0000, 0x0048, 0x0000, 0x0337,
+	    0x0337, 0x0303, 0x0286, 0x0000, 0x026d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02aa, 0x0000, 0x0000, 0x0000, 0x00b3, 0x0000, 0x0271,
+	    0x01f3, 0x0000, 0x0302, 0x01d5, 0x004c, 0x00bf, 0x02fa, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0007, 0x0001, 0x01a0, 0x0000, 0x0000,
+	    0x014e, 0x0000, 0x0000, 0x0000, 0x0148, 0x0000, 0x0000, 0x0000,
+	    0x0365, 0x0279, 0x0357, 0x03af, 0x0000, 0x0399, 0x03b2, 0x0000,
+	    0x014e, 0x023f, 0x0000, 0x0000, 0x03b8, 0x0000, 0x0000, 0x0386,
+	    0x0135, 0x0000, 0x0091, 0x02ea, 0x0000, 0x02fe, 0x0000, 0x0000,
+	    0x0052, 0x0000, 0x0131, 0x0000, 0x02a2, 0x0000, 0x0000, 0x0295,
+	    0x0124, 0x0000, 0x0000, 0x012e, 0x0000, 0x032a, 0x00b9, 0x03c5,
+	    0x0328, 0x0268, 0x0014, 0x0244, 0x034f, 0x0000, 0x037f, 0x0247,
+	    0x0000, 0x030e, 0x021e, 0x0000, 0x0000, 0x026b, 0x0000, 0x0000,
+	    0x0371, 0x0000, 0x0000, 0x0148, 0x01a1, 0x0000, 0x0000, 0x02d6,
+	    0x0000, 0x00e1, 0x0065, 0x0000, 0x0208, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x00ee, 0x0000, 0x0064, 0x0000, 0x0000, 0x019d, 0x0000,
+	    0x0000, 0x0198, 0x0234, 0x008c, 0x009e, 0x02c2, 0x004f, 0x0000,
+	    0x0000, 0x02af, 0x0059, 0x01c8, 0x0000, 0x005b, 0x01ca, 0x0132,
+	    0x0000, 0x0375, 0x0000, 0x020e, 0x0061, 0x0347, 0x027b, 0x0000,
+	    0x026c, 0x00c0, 0x0000, 0x0000, 0x0000, 0x0229, 0x01dc, 0x0000,
+	    0x0000, 0x0000, 0x024d, 0x029e, 0x00b7, 0x018a, 0x0000, 0x03af,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0203, 0x0000, 0x0000, 0x002e,
+	    0x0000, 0x0119, 0x000d, 0x0000, 0x0271, 0x02d1, 0x0000, 0x03c2,
+	    0x010d, 0x0000, 0x0000, 0x00f9, 0x0000, 0x0095, 0x0225, 0x0000,
+	    0x0373, 0x002b, 0x0000, 0x0042, 0x0000, 0x03d8, 0x0000, 0x0000,
+	    0x0189, 0x0000, 0x00d9, 0x0000, 0x0000, 0x0048, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02f6, 0x0000, 0x012b, 0x0000, 0x019d,
+	    0x0160, 0x0000, 0x02d4, 0x0000, 0x0296, 0x0000, 0x0000, 0x0212,
+	    0x0000, 0x0000, 0x00e8, 0x0000, 0x0000, 0x0269, 0x014c, 0x0000,
+	    0x02fd, 0x03b3, 0x0000, 0x02e5, 0x037a, 0x0000, 0x01b1, 0x0000,
+	    0x0000, 0x0000, 0x0298, 0x0000, 0x016a, 0x0180, 0x0000, 0x003d,
+	    0x0000, 0x0000, 0x0274, 0x02e3, 0x01c7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03b9, 0x0000, 0x0375, 0x0000, 0x0000, 0x031f, 0x0134,
+	    0x0000, 0x0000, 0x01d1, 0x01a2, 0x03df, 0x0000, 0x031f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x01eb, 0x0000, 0x0000, 0x0000,
+	    0x00da, 0x02ee, 0x0000, 0x0000, 0x0000, 0x015d, 0x0118, 0x0139,
+	    0x02ab, 0x03c0, 0x0000, 0x0000, 0x0195, 0x0000, 0x0003, 0x0000,
+	    0x02a3, 0x0000, 0x000c, 0x01d8, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x00a8, 0x0000, 0x0000, 0x0000, 0x0226, 0x0000, 0x01dd, 0x02ec,
+	    0x00e4, 0x0149, 0x020e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01c8, 0x0000, 0x0000, 0x02f8, 0x0000, 0x00c1, 0x0000,
+	    0x006e, 0x0358, 0x0000, 0x0000, 0x0000, 0x0000, 0x02ff, 0x0000,
+	    0x0349, 0x0001, 0x0000, 0x03c2, 0x0000, 0x0000, 0x004e, 0x0004,
+	    0x006e, 0x0000, 0x0000, 0x0000, 0x027c, 0x0000, 0x0000, 0x0000,
+	    0x0064, 0x0000, 0x0000, 0x014a, 0x00f7, 0x0000, 0x0000, 0x0000,
+	    0x0073, 0x0000, 0x012c, 0x0000, 0x00d5, 0x035e, 0x00cf, 0x0383,
+	    0x0000, 0x0000, 0x0020, 0x02a5, 0x0000, 0x0179, 0x0000, 0x0000,
+	    0x0000, 0x002a, 0x0000, 0x0238, 0x0000, 0x0000, 0x01fa, 0x0000,
+	    0x026c, 0x0158, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006,
+	    0x0000, 0x0000, 0x0000, 0x000c, 0x00e7, 0x01bd, 0x03dc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0075, 0x0302, 0x0083, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02b3, 0x0000, 0x008a,
+	    0x00ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01cb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x033c, 0x0224, 0x0385, 0x0000, 0x0000,
+	    0x0220, 0x0000, 0x0000, 0x0000, 0x0129, 0x00b0, 0x0000, 0x018a,
+	    0x0061, 0x0000, 0x03c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x00b5,
+	    0x0000, 0x0000, 0x02df, 0x01a8, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03a9, 0x0000, 0x0000, 0x007d, 0x0000, 0x0000, 0x0360,
+	    0x0000, 0x0309, 0x0000, 0x01fc, 0x0000, 0x005a, 0x0000, 0x0275,
+	    0x0000, 0x0000, 0x02d3, 0x0000, 0x0000, 0x0000, 0x0043, 0x0243,
+	    0x0256, 0x0314, 0x0000, 0x00b2, 0x0199, 0x00b3, 0x0381, 0x0000,
+	    0x0079, 0x0000, 0x0000, 0x01a1, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x019d, 0x0000, 0x0166, 0x0000, 0x0318, 0x02d0, 0x0000, 0x00f1,
+	    0x0000, 0x00b5, 0x0000, 0x026d, 0x0000, 0x0000, 0x00cd, 0x02af,
+	    0x0000, 0x012b, 0x031e, 0x0000, 0x0158, 0x03c1, 0x0029, 0x0000,
+	    0x0009, 0x0000, 0x0049, 0x0391, 0x0000, 0x01b2, 0x0000, 0x0211,
+	    0x0000, 0x01c9, 0x024e, 0x00dc, 0x0000, 0x02a8, 0x0205, 0x0000,
+	    0x0000, 0x0000, 0x03aa, 0x0000, 0x0000, 0x0000, 0x00b7, 0x033a,
+	    0x0000, 0x01c0, 0x0000, 0x0000, 0x0000, 0x022e, 0x0000, 0x00a0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0394, 0x0000, 0x02c4, 0x0000,
+	    0x0000, 0x0067, 0x02a3, 0x0000, 0x00a3, 0x03c6, 0x020f, 0x0000,
+	    0x0000, 0x0000, 0x011a, 0x0000, 0x0000, 0x015d, 0x03dc, 0x02cd,
+	    0x01df, 0x0359, 0x019c, 0x004e, 0x003b, 0x0000, 0x013f, 0x0292,
+	    0x02b7, 0x01a5, 0x0264, 0x01bf, 0x037d, 0x0000, 0x02ad, 0x0000,
+	    0x03d3, 0x0000, 0x02df, 0x0000, 0x0000, 0x0059, 0x0000, 0x0000,
+	    0x0090, 0x02f5, 0x0000, 0x0000, 0x0132, 0x0000, 0x0000, 0x0000,
+	    0x0391, 0x0325, 0x001a, 0x008a, 0x03a0, 0x017a, 0x0000, 0x0376,
+	    0x0000, 0x0000, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x032d,
+	    0x03cc, 0x018e, 0x0000, 0x004c, 0x0150, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03dc, 0x0000, 0x0000, 0x0016, 0x0110, 0x0000, 0x0000,
+	    0x039f, 0x0310, 0x0000, 0x0034, 0x0000, 0x0000, 0x00a7, 0x017d,
+	    0x019d, 0x0000, 0x03c1, 0x0000, 0x01ba, 0x0000, 0x003e, 0x03a3,
+	    0x00d3, 0x00aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0258, 0x0000,
+	    0x02de, 0x03d6, 0x0000, 0x00b0, 0x0000, 0x01b5, 0x0000, 0x01cf,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x027c, 0x0000, 0x0016,
+	    0x0000, 0x0269, 0x02dc, 0x0210, 0x0000, 0x0043, 0x0376, 0x0237,
+	    0x0000, 0x01ee, 0x0000, 0x0000, 0x0106, 0x0000, 0x0000, 0x002a,
+	    0x0000, 0x0000, 0x01cd, 0x03a6, 0x0000, 0x01f6, 0x0000, 0x0000,
+	    0x00ae, 0x0336, 0x0000, 0x0000, 0x00cb, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02f7, 0x02f6, 0x0000, 0x0179, 0x0237, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0258, 0x00aa, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0373, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0165, 0x034b, 0x0000, 0x004d, 0x0000, 0x02e9, 0x0076,
+	    0x0000, 0x0278, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02e6, 0x0000, 0x03a4, 0x0000, 0x01f5, 0x03af, 0x0000, 0x0000,
+	    0x0000, 0x02d6, 0x0000, 0x0025, 0x0000, 0x0363, 0x0000, 0x0000,
+	    0x0000, 0x01af, 0x0000, 0x0000, 0x0000, 0x0335, 0x02ad, 0x0084,
+	    0x00c1, 0x0000, 0x0156, 0x03de, 0x0236, 0x0000, 0x003d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ef,
+	    0x0000, 0x03db, 0x0000, 0x0151, 0x01cc, 0x0082, 0x005d, 0x01c3,
+	    0x0000, 0x0000, 0x0000, 0x0065, 0x027a, 0x0000, 0x0000, 0x0000,
+	    0x02c4, 0x0000, 0x01d5, 0x0182, 0x0000, 0x0000, 0x020a, 0x00c8,
+	    0x0000, 0x000b, 0x0339, 0x0000, 0x0000, 0x0000, 0x029c, 0x0000,
+	    0x00da, 0x0133, 0x0000, 0x0000, 0x0000, 0x002c, 0x0354, 0x0000,
+	    0x0000, 0x0000, 0x029b, 0x016d, 0x02e1, 0x0000, 0x02ac, 0x0259,
+	    0x0000, 0x0114, 0x037d, 0x0233, 0x0000, 0x0038, 0x0000, 0x02b4,
+	    0x03cd, 0x02eb, 0x029d, 0x0000, 0x01d6, 0x0000, 0x033a, 0x0000,
+	    0x03a6, 0x0394, 0x0340, 0x01fc, 0x012f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03bb, 0x0077, 0x0000, 0x0000, 0x0000, 0x0000, 0x0381,
+	    0x0000, 0x030f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fd,
+	    0x0000, 0x00be, 0x023d, 0x0000, 0x01ff, 0x03a5, 0x01cd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0254, 0x03ba, 0x01e6, 0x0000, 0x0000,
+	    0x007b, 0x02f6, 0x002f, 0x0000, 0x0000, 0x03d2, 0x00af, 0x00e9,
+	    0x03d5, 0x0000, 0x0000, 0x011f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x003e, 0x0000, 0x0000, 0x020c, 0x00a8,
+	    0x00ae, 0x02ca, 0x011b, 0x0398, 0x016f, 0x033b, 0x0010, 0x0000,
+	    0x0000, 0x0376, 0x02a3, 0x0000, 0x0000, 0x0309, 0x02e5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x03a0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x006f, 0x012f, 0x0000, 0x0374, 0x0000, 0x008f, 0x0000, 0x0000,
+	    0x0000, 0x011a, 0x0000, 0x0000, 0x02ee, 0x0000, 0x0395, 0x038e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x011e, 0x0000, 0x009d, 0x0000,
+	    0x020c,
+	};
+	uint16_t h[4];
+
+	fnv16_2(key, keylen, 0x1f29, 0x238e, (uint16_t*)h);
+
+	h[0] = h[0] % 2001;
+	h[1] = h[1] % 2001;
+	return (g[h[0]] + g[h[1]]) % 1000;
+}
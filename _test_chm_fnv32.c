@@ -0,0 +1,269 @@
+/* generated with rurban/nbperf 08a5797 -fp _words1000 */
+/* seed[0]: 2246822507, seed[1]: 1 */
+#include <stdint.h>
+#include "fnv3.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[2001] = {
+	    0x013e, 0x00eb, 0x0000, 0x0000, 0x0000, 0x03d0, 0x0000, 0x0340,
+	    0x03c5, 0x00e2, 0x015d, 0x0000, 0x0171, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0016, 0x01e9, 0x0000, 0x00da, 0x02da, 0x0000, 0x0099,
+	    0x030e, 0x03df, 0x0218, 0x0347, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02ce, 0x0037, 0x0000, 0x0294, 0x0398, 0x0000, 0x029c, 0x0000,
+	    0x0194, 0x03a3, 0x0000, 0x0171, 0x0000, 0x0000, 0x0000, 0x0081,
+	    0x003a, 0x03c7, 0x0000, 0x0000, 0x0128, 0x0000, 0x0000, 0x0206,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0088, 0x0079, 0x0362, 0x0000,
+	    0x01c1, 0x017b, 0x0000, 0x0000, 0x0000, 0x0132, 0x0024, 0x0123,
+	    0x0154, 0x0000, 0x03c4, 0x01fe, 0x0068, 0x0000, 0x0000, 0x037a,
+	    0x027a, 0x0313, 0x0031, 0x0000, 0x0392, 0x0000, 0x0000, 0x0000,
+	    0x00bf, 0x0000, 0x0000, 0x03c9, 0x0000, 0x00dd, 0x00ca, 0x0000,
+	    0x0000, 0x0000, 0x030b, 0x0000, 0x0387, 0x00ea, 0x02c7, 0x039b,
+	    0x0295, 0x01c6, 0x019f, 0x0000, 0x0000, 0x03bd, 0x0000, 0x0000,
+	    0x024f, 0x0000, 0x0000, 0x02a3, 0x02fa, 0x0000, 0x0000, 0x0000,
+	    0x02ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ee, 0x0000, 0x0000,
+	    0x0254, 0x003f, 0x0000, 0x0000, 0x0343, 0x0076, 0x0000, 0x025a,
+	    0x02f5, 0x025b, 0x01bd, 0x01b6, 0x01ef, 0x02b9, 0x0000, 0x0000,
+	    0x02e0, 0x0133, 0x0000, 0x021e, 0x0000, 0x00c9, 0x0269, 0x02f2,
+	    0x0000, 0x0184, 0x0291, 0x0000, 0x0130, 0x0076, 0x027b, 0x0000,
+	    0x01f2, 0x00c2, 0x009b, 0x012e, 0x03aa, 0x03a6, 0x0000, 0x02c2,
+	    0x0000, 0x0000, 0x0000, 0x0180, 0x0000, 0x004c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0093, 0x0000, 0x0213, 0x0017, 0x0000, 0x0073,
+	    0x037d, 0x0278, 0x00e0, 0x0000, 0x0256, 0x0000, 0x02a8, 0x0380,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a3, 0x0000, 0x0250,
+	    0x0000, 0x012d, 0x0000, 0x02ee, 0x02b9, 0x022f, 0x022a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0265, 0x0000, 0x0000, 0x0000, 0x008b,
+	    0x03cd, 0x01cc, 0x010c, 0x0008, 0x0000, 0x0000, 0x0000, 0x020e,
+	    0x0000, 0x000d, 0x0000, 0x0394, 0x0106, 0x0000, 0x024d, 0x0189,
+	    0x02d3, 0x003f, 0x0000, 0x024c, 0x0000, 0x033a, 0x0000, 0x0143,
+	    0x021e, 0x036c, 0x0200, 0x0000, 0x02fc, 0x039b, 0x0000, 0x0000,
+	    0x0000, 0x03d4, 0x0025, 0x02b3, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0150, 0x016b, 0x0000, 0x0179, 0x01d8, 0x0000, 0x009d,
+	    0x023d, 0x035d, 0x0000, 0x0000, 0x01a2, 0x0000, 0x0100, 0x0126,
+	    0x0000, 0x0000, 0x01b1, 0x0000, 0x0000, 0x02d2, 0x0000, 0x032e,
+	    0x0000, 0x0000, 0x0000, 0x01ae, 0x0000, 0x0248, 0x0000, 0x0360,
+	    0x0000, 0x0000, 0x0000, 0x03cd, 0x0206, 0x0000, 0x0000, 0x0241,
+	    0x03a5, 0x02eb, 0x03b8, 0x02ef, 0x0054, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0270, 0x0000, 0x0000, 0x03e7, 0x0000, 0x0000, 0x01ff,
+	    0x03e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x009e,
+	    0x0286, 0x0000, 0x0000, 0x034c, 0x0000, 0x0289, 0x00b2, 0x0000,
+	    0x02a8, 0x0000, 0x02c1, 0x0000, 0x0000, 0x025e, 0x00fd, 0x022b,
+	    0x0000, 0x0028, 0x0339, 0x0000, 0x0384, 0x036a, 0x0000, 0x0000,
+	    0x03a0, 0x0000, 0x0350, 0x0000, 0x0000, 0x0285, 0x0173, 0x02ad,
+	    0x0000, 0x039c, 0x0000, 0x015d, 0x0000, 0x0000, 0x0000, 0x01a9,
+	    0x0389, 0x0107, 0x01cf, 0x0000, 0x01fc, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02fa, 0x0000, 0x0361, 0x0269, 0x0374, 0x0000, 0x0000,
+	    0x006b, 0x0000, 0x0000, 0x0203, 0x037f, 0x00de, 0x0000, 0x0000,
+	    0x033d, 0x0076, 0x0000, 0x01e1, 0x0001, 0x0000, 0x0000, 0x01e3,
+	    0x0000, 0x00a8, 0x0000, 0x0000, 0x0000, 0x020c, 0x01d3, 0x0000,
+	    0x0031, 0x0000, 0x0000, 0x0000, 0x0000, 0x026b, 0x0000, 0x0068,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x013c, 0x032f, 0x0000, 0x0000,
+	    0x0000, 0x019c, 0x0000, 0x0398, 0x0000, 0x0168, 0x0000, 0x007a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x01c7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x00c8, 0x0143, 0x0000, 0x005d, 0x039d, 0x0274, 0x0000,
+	    0x02ee, 0x008e, 0x010c, 0x0120, 0x0275, 0x01b9, 0x0113, 0x0390,
+	    0x0000, 0x0000, 0x03d1, 0x01dc, 0x03dd, 0x0000, 0x0000, 0x019e,
+	    0x01ef, 0x032f, 0x0000, 0x0000, 0x006e, 0x0348, 0x03ba, 0x027f,
+	    0x0000, 0x03d4, 0x0000, 0x01ed, 0x0000, 0x0054, 0x0000, 0x031b,
+	    0x02a2, 0x0000, 0x0000, 0x014a, 0x02db, 0x02aa, 0x0000, 0x0000,
+	    0x03e7, 0x0000, 0x0071, 0x0000, 0x0136, 0x0000, 0x02b0, 0x0000,
+	    0x03e1, 0x00d8, 0x0000, 0x00f7, 0x028b, 0x0183, 0x02d8, 0x0000,
+	    0x0000, 0x00ab, 0x0000, 0x0000, 0x0061, 0x0000, 0x0353, 0x0000,
+	    0x014c, 0x0242, 0x0000, 0x0000, 0x0000, 0x0000, 0x00aa, 0x0000,
+	    0x016f, 0x0000, 0x0308, 0x0325, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0029, 0x0014, 0x0000, 0x01ca, 0x00ad, 0x0324, 0x0000, 0x0000,
+	    0x0310, 0x0006, 0x0000, 0x01aa, 0x02f6, 0x0356, 0x0000, 0x0000,
+	    0x009b, 0x0000, 0x006b, 0x0367, 0x012a, 0x0000, 0x0000, 0x005e,
+	    0x018f, 0x0324, 0x0000, 0x013a, 0x0000, 0x0000, 0x0000, 0x0050,
+	    0x0056, 0x0000, 0x0372, 0x0192, 0x016d, 0x0000, 0x0000, 0x0000,
+	    0x01f4, 0x0000, 0x01cb, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01fd, 0x0000, 0x0000, 0x0000, 0x01a2,
+	    0x02dd, 0x0000, 0x00ac, 0x01e8, 0x0000, 0x0000, 0x0000, 0x02ba,
+	    0x0000, 0x0000, 0x0000, 0x00b3, 0x0000, 0x0267, 0x014a, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x018b, 0x0037, 0x0000, 0x00ff, 0x00af,
+	    0x00e2, 0x03a4, 0x004b, 0x0000, 0x00d5, 0x0267, 0x021f, 0x004c,
+	    0x03dc, 0x0000, 0x0173, 0x0000, 0x0000, 0x017c, 0x0000, 0x03cf,
+	    0x0000, 0x0381, 0x0000, 0x0000, 0x0313, 0x0000, 0x0000, 0x01a0,
+	    0x02c5, 0x01b6, 0x0000, 0x020d, 0x03b7, 0x0000, 0x038b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0261, 0x0000, 0x0000, 0x0000, 0x0139,
+	    0x01cb, 0x007a, 0x00c9, 0x006f, 0x028e, 0x0000, 0x0000, 0x0000,
+	    0x039f, 0x0000, 0x02fd, 0x009d, 0x0000, 0x0185, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x01b2, 0x0270, 0x0000, 0x0000, 0x0000, 0x01f8,
+	    0x01ae, 0x02be, 0x0342, 0x00c5, 0x0000, 0x0000, 0x02f9, 0x0000,
+	    0x0000, 0x0000, 0x0318, 0x011f, 0x015f, 0x01a7, 0x01f6, 0x0000,
+	    0x01cf, 0x03df, 0x0000, 0x033f, 0x0024, 0x0000, 0x0000, 0x0381,
+	    0x02a6, 0x01f8, 0x0160, 0x0000, 0x0182, 0x0035, 0x0355, 0x0210,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0229, 0x0000, 0x0000, 0x0364,
+	    0x0000, 0x0000, 0x0356, 0x0000, 0x0000, 0x0000, 0x0340, 0x035c,
+	    0x0000, 0x0000, 0x0027, 0x0000, 0x011a, 0x0000, 0x0148, 0x0000,
+	    0x0000, 0x0000, 0x03c3, 0x02b3, 0x0000, 0x0000, 0x03cb, 0x0000,
+	    0x0027, 0x0000, 0x0000, 0x0251, 0x0000, 0x00ae, 0x0245, 0x0000,
+	    0x000d, 0x0000, 0x0301, 0x02cf, 0x0344, 0x0152, 0x0055, 0x0000,
+	    0x0000, 0x01ee, 0x016c, 0x01b8, 0x00f9, 0x0191, 0x0000, 0x0000,
+	    0x0122, 0x0022, 0x0000, 0x0004, 0x0000, 0x0000, 0x01de, 0x0000,
+	    0x0000, 0x004c, 0x0354, 0x037c, 0x0274, 0x0000, 0x0000, 0x0354,
+	    0x010b, 0x0000, 0x0000, 0x03d1, 0x0000, 0x03a8, 0x0000, 0x0079,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x020c, 0x0269, 0x0000, 0x0331, 0x0238, 0x03e0,
+	    0x0000, 0x02ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0272, 0x0000, 0x0116, 0x02bd, 0x0000, 0x029c, 0x0000, 0x015a,
+	    0x0000, 0x0000, 0x01bf, 0x0000, 0x0000, 0x009b, 0x02e6, 0x03d3,
+	    0x0255, 0x0000, 0x0361, 0x027f, 0x0000, 0x0000, 0x01ce, 0x0000,
+	    0x00ee, 0x00cd, 0x0000, 0x00d7, 0x0000, 0x0000, 0x0000, 0x02cb,
+	    0x0000, 0x02d4, 0x01ec, 0x0381, 0x0020, 0x0000, 0x0000, 0x0222,
+	    0x03b9, 0x0000, 0x0281, 0x0190, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0319, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0172, 0x0158, 0x0000, 0x0000, 0x01ab, 0x0000, 0x0000, 0x0000,
+	    0x023c, 0x0000, 0x0000, 0x02b5, 0x0208, 0x0348, 0x0000, 0x0000,
+	    0x0115, 0x023a, 0x015c, 0x005a, 0x00c3, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0270, 0x0000, 0x01f3, 0x0000, 0x0000,
+	    0x0000, 0x0145, 0x03bf, 0x003d, 0x0000, 0x0000, 0x019e, 0x038e,
+	    0x0347, 0x0000, 0x02be, 0x0000, 0x02d6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01d0, 0x016a, 0x01f2, 0x02b1, 0x011a, 0x0000, 0x0000,
+	    0x00fb, 0x0000, 0x029f, 0x0000, 0x0000, 0x0297, 0x0088, 0x0000,
+	    0x0366, 0x02d6, 0x030b, 0x01f6, 0x0000, 0x0000, 0x01be, 0x0000,
+	    0x0000, 0x0000, 0x0111, 0x02c4, 0x03a8, 0x03de, 0x0000, 0x0000,
+	    0x01f9, 0x032a, 0x00b1, 0x0000, 0x02fd, 0x0297, 0x00ea, 0x0000,
+	    0x0000, 0x009a, 0x0302, 0x0000, 0x0000, 0x0000, 0x001f, 0x0000,
+	    0x0000, 0x02e4, 0x0000, 0x0087, 0x001e, 0x0000, 0x02bc, 0x00e1,
+	    0x03be, 0x00ac, 0x0000, 0x0000, 0x012c, 0x0000, 0x0000, 0x0006,
+	    0x025f, 0x0000, 0x006b, 0x00bb, 0x0000, 0x004f, 0x02c2, 0x0098,
+	    0x0134, 0x0000, 0x0000, 0x0112, 0x0000, 0x018a, 0x0095, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0202, 0x035b, 0x0000, 0x0000, 0x0000,
+	    0x02c6, 0x03aa, 0x028b, 0x0000, 0x0000, 0x0000, 0x03dd, 0x0053,
+	    0x0327, 0x00f3, 0x02c0, 0x0048, 0x00a5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02ae, 0x035f, 0x0000, 0x023a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x016c, 0x0000, 0x0338, 0x0000,
+	    0x0205, 0x01a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0177, 0x0212, 0x0000, 0x0186,
+	    0x0000, 0x03bb, 0x0000, 0x0000, 0x0000, 0x03d7, 0x0000, 0x0000,
+	    0x0000, 0x0018, 0x02a6, 0x0346, 0x0000, 0x0000, 0x0284, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0209, 0x0000, 0x0000, 0x012a, 0x0000,
+	    0x0000, 0x0000, 0x02f8, 0x0214, 0x0000, 0x0044, 0x01f5, 0x015e,
+	    0x0000, 0x03b0, 0x0000, 0x0000, 0x0216, 0x0004, 0x0393, 0x01b6,
+	    0x01eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0127, 0x0000, 0x00b7, 0x0000, 0x00bd,
+	    0x00a1, 0x019e, 0x00d7, 0x0000, 0x0279, 0x032c, 0x0000, 0x02b7,
+	    0x0215, 0x0000, 0x0000, 0x0000, 0x0232, 0x022e, 0x01a0, 0x008e,
+	    0x0000, 0x0226, 0x02d8, 0x03a5, 0x01ec, 0x0000, 0x0009, 0x022b,
+	    0x0258, 0x00fe, 0x0000, 0x0000, 0x0000, 0x03ad, 0x0000, 0x0000,
+	    0x0395, 0x0021, 0x0000, 0x0000, 0x00fa, 0x02ad, 0x0000, 0x0000,
+	    0x0342, 0x0343, 0x02e9, 0x02e8, 0x0000, 0x0337, 0x0000, 0x0244,
+	    0x0000, 0x0000, 0x011e, 0x0015, 0x0196, 0x0000, 0x038c, 0x0000,
+	    0x0000, 0x03c5, 0x01ad, 0x0000, 0x0176, 0x0000, 0x0000, 0x014a,
+	    0x0000, 0x037f, 0x0357, 0x0107, 0x0000, 0x0000, 0x0000, 0x00f0,
+	    0x0000, 0x0000, 0x0392, 0x00d1, 0x0231, 0x0235, 0x036c, 0x00d9,
+	    0x001d, 0x0000, 0x0074, 0x039f, 0x0000, 0x00fc, 0x0260, 0x0000,
+	    0x025e, 0x0000, 0x0177, 0x0382, 0x0124, 0x03dc, 0x03d9, 0x0174,
+	    0x0000, 0x02d8, 0x0000, 0x0000, 0x0000, 0x0085, 0x0363, 0x0000,
+	    0x0000, 0x007a, 0x0171, 0x0258, 0x0000, 0x0000, 0x0000, 0x0062,
+	    0x0000, 0x0262, 0x0178, 0x00e1, 0x00dd, 0x008c, 0x0000, 0x0000,
+	    0x0128, 0x0000, 0x01d2, 0x01ec, 0x0000, 0x0000, 0x0000, 0x0246,
+	    0x02df, 0x0000, 0x0000, 0x03d2, 0x0000, 0x001f, 0x0000, 0x0000,
+	    0x03b0, 0x0000, 0x0113, 0x02ac, 0x0039, 0x02e1, 0x0309, 0x0000,
+	    0x0000, 0x0000, 0x020b, 0x0000, 0x0000, 0x0260, 0x0376, 0x0000,
+	    0x031f, 0x039f, 0x00a8, 0x0149, 0x0000, 0x00e3, 0x0000, 0x0000,
+	    0x0000, 0x0051, 0x01fd, 0x0083, 0x0321, 0x0000, 0x01d7, 0x0000,
+	    0x0169, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x006b,
+	    0x0000, 0x01a5, 0x01e7, 0x0142, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0080, 0x00f8, 0x0000, 0x021a, 0x00c0, 0x0046, 0x0000, 0x0000,
+	    0x00c0, 0x0102, 0x0000, 0x0000, 0x031a, 0x03c4, 0x0000, 0x0000,
+	    0x0306, 0x0000, 0x037d, 0x0000, 0x0000, 0x01e2, 0x0000, 0x0000,
+	    0x02a1, 0x023d, 0x02c5, 0x0371, 0x0000, 0x0000, 0x0242, 0x02b4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0194, 0x0000,
+	    0x0000, 0x0276, 0x00a1, 0x0129, 0x0022, 0x0000, 0x03d9, 0x0000,
+	    0x0085, 0x0000, 0x035a, 0x02f8, 0x0317, 0x0000, 0x00fc, 0x0327,
+	    0x0000, 0x0216, 0x0000, 0x0000, 0x0000, 0x034e, 0x0010, 0x0286,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x014d, 0x013f, 0x0241, 0x0312,
+	    0x00be, 0x0000, 0x0197, 0x030d, 0x03d7, 0x0000, 0x0000, 0x0000,
+	    0x01ee, 0x0000, 0x00c6, 0x0000, 0x033c, 0x0000, 0x0000, 0x01fa,
+	    0x02f7, 0x0000, 0x0168, 0x0000, 0x0000, 0x0000, 0x0290, 0x0105,
+	    0x0000, 0x0232, 0x0000, 0x0000, 0x005b, 0x02cc, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x01ff, 0x0177, 0x0000, 0x0136, 0x0135, 0x0000,
+	    0x0000, 0x0000, 0x02b7, 0x0284, 0x0000, 0x0079, 0x0049, 0x017a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012c, 0x032d,
+	    0x0000, 0x011c, 0x0000, 0x0000, 0x02d9, 0x0172, 0x002c, 0x019d,
+	    0x022c, 0x025c, 0x0000, 0x0163, 0x0000, 0x0000, 0x03a2, 0x0000,
+	    0x0000, 0x0000, 0x0266, 0x0000, 0x0000, 0x0243, 0x0000, 0x0304,
+	    0x025a, 0x01e1, 0x01ba, 0x0253, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0314, 0x0150, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x019c, 0x0000,
+	    0x0000, 0x0222, 0x0349, 0x014b, 0x0231, 0x0069, 0x0000, 0x0000,
+	    0x00bf, 0x00a6, 0x03b1, 0x0104, 0x0000, 0x01f0, 0x0000, 0x0000,
+	    0x00b4, 0x030b, 0x0269, 0x00c9, 0x0000, 0x0000, 0x0000, 0x0282,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0211, 0x00be, 0x024a, 0x0000,
+	    0x0000, 0x0252, 0x0103, 0x0000, 0x0227, 0x03e5, 0x0000, 0x0000,
+	    0x0060, 0x012c, 0x03b3, 0x0000, 0x0127, 0x0304, 0x0000, 0x0251,
+	    0x01e1, 0x0000, 0x01f2, 0x0108, 0x0000, 0x039a, 0x0167, 0x0000,
+	    0x0325, 0x0000, 0x02f9, 0x0000, 0x033a, 0x0000, 0x0000, 0x0000,
+	    0x027c, 0x03ab, 0x0000, 0x0000, 0x0000, 0x02b2, 0x0000, 0x0000,
+	    0x03be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0308, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0228, 0x02ce, 0x0000, 0x0305, 0x027b, 0x033c,
+	    0x0000, 0x029c, 0x0000, 0x01c6, 0x038e, 0x0000, 0x0000, 0x03c3,
+	    0x0000, 0x0000, 0x035a, 0x010b, 0x031e, 0x00bf, 0x02a0, 0x0000,
+	    0x0000, 0x0356, 0x0000, 0x0000, 0x01a6, 0x01af, 0x015b, 0x030e,
+	    0x03b2, 0x0188, 0x0000, 0x02b8, 0x0236, 0x00ed, 0x0000, 0x01d6,
+	    0x00c9, 0x0113, 0x0000, 0x0000, 0x027a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0159, 0x0000, 0x03bc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02eb, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x030c, 0x0000, 0x0000, 0x02a4, 0x035b, 0x0047, 0x0000, 0x0000,
+	    0x01a6, 0x0000, 0x0000, 0x01b8, 0x0000, 0x02df, 0x0364, 0x0000,
+	    0x03d9, 0x0000, 0x00f1, 0x0302, 0x01c7, 0x0000, 0x024c, 0x0000,
+	    0x0000, 0x02ef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x006c, 0x01e1, 0x0000, 0x0260, 0x00fb, 0x0000,
+	    0x0000, 0x0000, 0x0330, 0x0000, 0x0320, 0x01dc, 0x00f9, 0x0210,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x027f, 0x0000, 0x0158, 0x0000,
+	    0x0000, 0x03df, 0x02d0, 0x02fb, 0x0000, 0x010e, 0x0267, 0x02db,
+	    0x0000, 0x0000, 0x0106, 0x0381, 0x0000, 0x03af, 0x0000, 0x0000,
+	    0x035c, 0x001e, 0x00c8, 0x0166, 0x0000, 0x0000, 0x0253, 0x00b6,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02ed, 0x0000, 0x0213,
+	    0x0000, 0x01f7, 0x0186, 0x0000, 0x0000, 0x0000, 0x0176, 0x00fe,
+	    0x0000, 0x0112, 0x0000, 0x0000, 0x0000, 0x0000, 0x035f, 0x0000,
+	    0x0000, 0x0346, 0x0123, 0x0000, 0x00c9, 0x012e, 0x00ca, 0x0000,
+	    0x026b, 0x01a2, 0x016d, 0x00e4, 0x0000, 0x0084, 0x0000, 0x0000,
+	    0x00f4, 0x0000, 0x0000, 0x0280, 0x0041, 0x01c2, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0051, 0x03c2,
+	    0x00a8, 0x0021, 0x0000, 0x0309, 0x0000, 0x0311, 0x0000, 0x0000,
+	    0x0380, 0x0000, 0x0273, 0x0000, 0x01f4, 0x0000, 0x0000, 0x0137,
+	    0x0000, 0x0000, 0x0000, 0x0388, 0x0318, 0x035f, 0x0000, 0x0000,
+	    0x0224, 0x002f, 0x0000, 0x03e6, 0x03ae, 0x00de, 0x010a, 0x0201,
+	    0x0203, 0x0000, 0x0368, 0x01a8, 0x0000, 0x0000, 0x00a4, 0x0000,
+	    0x0000, 0x0275, 0x0000, 0x014b, 0x0257, 0x0000, 0x0043, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0162, 0x01b6, 0x0144, 0x0000, 0x03bf,
+	    0x0000, 0x0000, 0x03d2, 0x0000, 0x0000, 0x0000, 0x0221, 0x0000,
+	    0x01e4, 0x03c0, 0x007d, 0x0000, 0x0000, 0x02e1, 0x021f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a7, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0170, 0x0000,
+	    0x0000, 0x0209, 0x0000, 0x010f, 0x0066, 0x0000, 0x0000, 0x0390,
+	    0x0000, 0x037b, 0x0129, 0x007b, 0x0000, 0x03cf, 0x02f7, 0x00fc,
+	    0x0000, 0x0000, 0x0000, 0x0240, 0x0000, 0x020d, 0x01db, 0x03b1,
+	    0x0000, 0x0125, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e2, 0x0120,
+	    0x02e4, 0x0000, 0x0000, 0x0000, 0x019d, 0x00f5, 0x0000, 0x0000,
+	    0x003c, 0x0000, 0x0000, 0x00f9, 0x034d, 0x0306, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0353, 0x0000, 0x0196, 0x0000, 0x0000, 0x0081,
+	    0x0000, 0x0000, 0x0000, 0x025e, 0x034a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0049, 0x01f6, 0x0288, 0x0023, 0x0182, 0x014f, 0x010f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x011e, 0x01b2, 0x0000, 0x024f,
+	    0x0000, 0x0000, 0x00cd, 0x0127, 0x015a, 0x0000, 0x0305, 0x0000,
+	    0x0000, 0x0000, 0x0391, 0x0000, 0x0000, 0x023f, 0x03dc, 0x026a,
+	    0x029c, 0x0000, 0x0042, 0x0000, 0x0000, 0x0000, 0x0078, 0x0191,
+	    0x016f, 0x0000, 0x0000, 0x03de, 0x0000, 0x0000, 0x0000, 0x001f,
+	    0x0000, 0x0345, 0x0399, 0x039f, 0x0000, 0x0185, 0x0247, 0x00d5,
+	    0x03d3, 0x00a4, 0x0128, 0x00b1, 0x002d, 0x0000, 0x0347, 0x0000,
+	    0x01a7, 0x0000, 0x0000, 0x03a1, 0x0000, 0x0000, 0x00a6, 0x0000,
+	    0x018c, 0x0000, 0x0000, 0x0089, 0x00e5, 0x0000, 0x0239, 0x0000,
+	    0x02fe, 0x022b, 0x0082, 0x02ce, 0x02ee, 0x00a0, 0x0000, 0x0036,
+	    0x0000, 0x0367, 0x025f, 0x0000, 0x0000, 0x0000, 0x0058, 0x0000,
+	    0x0000, 0x0181, 0x0000, 0x0000, 0x0053, 0x030b, 0x0000, 0x01e9,
+	    0x0000, 0x0133, 0x014e, 0x0026, 0x0000, 0x0169, 0x0000, 0x01b7,
+	    0x0000,
+	};
+	uint16_t h[4];
+
+	fnv32_2(key, keylen, 0x85ebca6b, 0x1, (uint32_t*)h);
+
+	h[0] = h[0] % 2001;
+	h[1] = h[1] % 2001;
+	return (g[h[0]] + g[h[1]]) % 1000;
+}
@@ -0,0 +1,269 @@
+/* generated with rurban/nbperf 08a5797 -p _words1000 */
+/* seed[0]: 4, seed[1]: 5 */
+#include <stdint.h>
+#include "mi_wyhash.h"
+
+uint16_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint16_t g[2001] = {
+	    0x038c, 0x0161, 0x0221, 0x008d, 0x0000, 0x030e, 0x00a8, 0x02ba,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0383, 0x0328, 0x02ae, 0x0000,
+	    0x0053, 0x00fb, 0x011f, 0x0000, 0x00b7, 0x0000, 0x019a, 0x013a,
+	    0x0214, 0x0271, 0x0075, 0x0089, 0x0000, 0x0000, 0x0181, 0x0000,
+	    0x0000, 0x0000, 0x02fa, 0x003a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x023d, 0x0206, 0x0000, 0x0000, 0x0000, 0x0141, 0x0000, 0x02ba,
+	    0x0000, 0x0000, 0x0283, 0x0269, 0x0000, 0x0000, 0x034a, 0x0000,
+	    0x0164, 0x0255, 0x0000, 0x0000, 0x021c, 0x0345, 0x02c5, 0x0000,
+	    0x02b9, 0x0000, 0x0000, 0x0326, 0x026a, 0x031e, 0x0000, 0x004a,
+	    0x03e4, 0x0000, 0x01e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0370,
+	    0x0000, 0x0000, 0x00c8, 0x0000, 0x01c3, 0x02d9, 0x0000, 0x0222,
+	    0x0000, 0x0000, 0x032d, 0x030b, 0x0000, 0x0000, 0x00f3, 0x0074,
+	    0x0000, 0x032a, 0x0000, 0x000d, 0x0000, 0x0346, 0x0252, 0x002b,
+	    0x0394, 0x032f, 0x0000, 0x0000, 0x0000, 0x0000, 0x03b3, 0x0000,
+	    0x0000, 0x0226, 0x0000, 0x0010, 0x0277, 0x01fb, 0x007d, 0x0000,
+	    0x0293, 0x0000, 0x0000, 0x00c6, 0x0000, 0x02a7, 0x0000, 0x0146,
+	    0x0000, 0x013a, 0x011b, 0x03aa, 0x0285, 0x0077, 0x00d7, 0x005f,
+	    0x035f, 0x0293, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01c2, 0x029b, 0x00e9, 0x024d, 0x0051,
+	    0x0000, 0x0000, 0x0342, 0x0000, 0x0000, 0x0000, 0x0000, 0x01b5,
+	    0x015a, 0x0000, 0x025a, 0x01a4, 0x0000, 0x019a, 0x028b, 0x0000,
+	    0x0000, 0x0292, 0x01e1, 0x0018, 0x0212, 0x0338, 0x0055, 0x00d7,
+	    0x0000, 0x0000, 0x01f3, 0x0000, 0x0321, 0x0000, 0x023c, 0x0000,
+	    0x02dd, 0x0066, 0x0000, 0x0167, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0079, 0x022d, 0x0220, 0x0000, 0x0047, 0x0035, 0x0000, 0x0000,
+	    0x0000, 0x0166, 0x0000, 0x0000, 0x01fd, 0x0000, 0x0171, 0x031d,
+	    0x0277, 0x0000, 0x0000, 0x0168, 0x0235, 0x00dd, 0x0229, 0x00e7,
+	    0x0131, 0x0000, 0x01a1, 0x0000, 0x0052, 0x0000, 0x00f5, 0x00ad,
+	    0x01d6, 0x0128, 0x0000, 0x0158, 0x0287, 0x0000, 0x0000, 0x0073,
+	    0x0000, 0x00e1, 0x0000, 0x01e7, 0x0000, 0x0000, 0x0308, 0x0201,
+	    0x0000, 0x0000, 0x00f7, 0x0000, 0x01b4, 0x023c, 0x0000, 0x0000,
+	    0x009a, 0x0362, 0x0000, 0x0000, 0x03c6, 0x0003, 0x01f2, 0x0004,
+	    0x0000, 0x0000, 0x0000, 0x01c4, 0x0353, 0x0101, 0x0000, 0x0000,
+	    0x0000, 0x02c4, 0x02df, 0x0000, 0x0000, 0x0000, 0x0006, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x02c6, 0x0000, 0x0215,
+	    0x0000, 0x0000, 0x0000, 0x0375, 0x0000, 0x03b3, 0x0000, 0x0000,
+	    0x00c3, 0x0000, 0x019c, 0x0000, 0x0000, 0x0000, 0x0000, 0x01b9,
+	    0x0073, 0x0000, 0x005d, 0x031b, 0x0000, 0x0000, 0x023c, 0x020d,
+	    0x0000, 0x0382, 0x0014, 0x0000, 0x02b0, 0x025c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0345, 0x01e9, 0x02a6, 0x0195, 0x0248,
+	    0x0000, 0x0000, 0x03ad, 0x0005, 0x0000, 0x0000, 0x0000, 0x035d,
+	    0x0210, 0x004b, 0x0000, 0x000c, 0x0000, 0x0145, 0x02a8, 0x0089,
+	    0x0000, 0x00d5, 0x004e, 0x014b, 0x0000, 0x0173, 0x0000, 0x02af,
+	    0x00b4, 0x0366, 0x039e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x013b, 0x0000, 0x0170, 0x0000, 0x0000,
+	    0x037f, 0x0379, 0x0000, 0x0000, 0x0351, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x008c, 0x0004, 0x0000, 0x0000, 0x0000, 0x00c3, 0x0000,
+	    0x0071, 0x0156, 0x00b4, 0x00f0, 0x00cf, 0x0103, 0x0000, 0x009c,
+	    0x0000, 0x0000, 0x0347, 0x0000, 0x02b7, 0x02d7, 0x0000, 0x0328,
+	    0x01df, 0x0377, 0x01a3, 0x01bc, 0x0000, 0x0000, 0x0034, 0x0000,
+	    0x001a, 0x01c6, 0x0000, 0x0119, 0x0367, 0x02b3, 0x0000, 0x01ae,
+	    0x0000, 0x0000, 0x01b2, 0x02d0, 0x0313, 0x0000, 0x039b, 0x0000,
+	    0x0000, 0x01b6, 0x0306, 0x0000, 0x0000, 0x001b, 0x018e, 0x0000,
+	    0x0000, 0x0000, 0x0305, 0x03a5, 0x0000, 0x0312, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x03c1, 0x00e8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x01ad, 0x0000, 0x004b, 0x0000, 0x016b, 0x01d9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02f5, 0x036f, 0x0000, 0x003c, 0x0000, 0x0000, 0x0083,
+	    0x01d8, 0x005f, 0x02aa, 0x0000, 0x0000, 0x012f, 0x02a1, 0x0000,
+	    0x0000, 0x0396, 0x03bc, 0x00f6, 0x029f, 0x00c5, 0x0000, 0x00f2,
+	    0x0298, 0x01ee, 0x0000, 0x00d5, 0x03b1, 0x0000, 0x0244, 0x0230,
+	    0x0275, 0x0053, 0x00ae, 0x0000, 0x0304, 0x033c, 0x00c1, 0x01a4,
+	    0x0000, 0x01b3, 0x03dd, 0x0000, 0x0079, 0x03ba, 0x03e2, 0x0000,
+	    0x0000, 0x0149, 0x0000, 0x0008, 0x0000, 0x0182, 0x0000, 0x0101,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01c1, 0x0000,
+	    0x0000, 0x0110, 0x0263, 0x01e6, 0x0365, 0x0000, 0x010d, 0x0000,
+	    0x02cc, 0x02b1, 0x0000, 0x0000, 0x0118, 0x025c, 0x0000, 0x01d7,
+	    0x01b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0344,
+	    0x0000, 0x014d, 0x022e, 0x020f, 0x0000, 0x0000, 0x01a3, 0x0000,
+	    0x02cc, 0x02c9, 0x0000, 0x03d2, 0x0000, 0x0231, 0x0108, 0x0082,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x010e, 0x0000, 0x03d0,
+	    0x0198, 0x007d, 0x0000, 0x0000, 0x0057, 0x0000, 0x03da, 0x02db,
+	    0x0000, 0x0000, 0x0038, 0x0000, 0x036b, 0x0333, 0x022a, 0x0381,
+	    0x021d, 0x0000, 0x0353, 0x0000, 0x026c, 0x0000, 0x00b3, 0x0037,
+	    0x028c, 0x0000, 0x0000, 0x0086, 0x01fc, 0x0000, 0x0000, 0x0053,
+	    0x0000, 0x0000, 0x0359, 0x02f1, 0x0000, 0x0000, 0x0163, 0x0000,
+	    0x00c0, 0x0114, 0x0153, 0x00e2, 0x02c1, 0x0000, 0x025c, 0x0000,
+	    0x02d7, 0x01ad, 0x02c4, 0x0000, 0x0000, 0x0028, 0x03d8, 0x0214,
+	    0x00a5, 0x00ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x02ea, 0x00cc,
+	    0x028e, 0x0000, 0x0000, 0x0000, 0x0026, 0x0104, 0x02fb, 0x0000,
+	    0x02d3, 0x0000, 0x01b8, 0x0000, 0x0000, 0x0000, 0x02e3, 0x0071,
+	    0x00be, 0x03b5, 0x0000, 0x0000, 0x0000, 0x0205, 0x0179, 0x0000,
+	    0x0000, 0x0022, 0x0000, 0x0244, 0x01c0, 0x0000, 0x0000, 0x0378,
+	    0x03d6, 0x0025, 0x01bd, 0x015a, 0x0000, 0x0000, 0x0000, 0x0310,
+	    0x0064, 0x0000, 0x0000, 0x01a9, 0x0347, 0x02da, 0x0000, 0x0000,
+	    0x036f, 0x0000, 0x0116, 0x0000, 0x0341, 0x01af, 0x0040, 0x015e,
+	    0x0000, 0x03b9, 0x0000, 0x03a3, 0x0000, 0x023d, 0x001d, 0x0000,
+	    0x0255, 0x0328, 0x0000, 0x0000, 0x020b, 0x0301, 0x036d, 0x0000,
+	    0x0000, 0x0000, 0x019b, 0x0000, 0x0193, 0x0000, 0x0183, 0x029c,
+	    0x0000, 0x0000, 0x023d, 0x0000, 0x010a, 0x017e, 0x0000, 0x0000,
+	    0x033f, 0x03cb, 0x0346, 0x0000, 0x0314, 0x035f, 0x0000, 0x0000,
+	    0x032f, 0x00fd, 0x0000, 0x0375, 0x0207, 0x02de, 0x0000, 0x0344,
+	    0x0000, 0x0000, 0x0313, 0x01ba, 0x030c, 0x02a2, 0x019e, 0x0000,
+	    0x0000, 0x0000, 0x02be, 0x0000, 0x0000, 0x01a7, 0x0000, 0x0000,
+	    0x0323, 0x01ab, 0x0110, 0x005b, 0x0000, 0x0000, 0x031f, 0x00a0,
+	    0x007e, 0x003f, 0x0000, 0x0079, 0x0000, 0x0000, 0x0010, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0221, 0x01ee, 0x0000, 0x020a, 0x0234,
+	    0x0036, 0x0000, 0x0248, 0x0000, 0x0000, 0x0000, 0x0016, 0x0000,
+	    0x024f, 0x00fe, 0x01c2, 0x0316, 0x0071, 0x034a, 0x0000, 0x012b,
+	    0x0000, 0x036b, 0x02e0, 0x0000, 0x0396, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0324, 0x0090, 0x0273, 0x0151, 0x0000, 0x0277, 0x0000,
+	    0x01de, 0x0000, 0x027d, 0x0000, 0x0000, 0x021d, 0x0000, 0x0000,
+	    0x0171, 0x02cd, 0x0000, 0x032d, 0x0000, 0x000e, 0x0000, 0x0000,
+	    0x0000, 0x01dd, 0x0000, 0x007a, 0x00bb, 0x0000, 0x0159, 0x0000,
+	    0x0000, 0x02d3, 0x027d, 0x0095, 0x0000, 0x0341, 0x0376, 0x0208,
+	    0x03cf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x038d, 0x0000,
+	    0x01a0, 0x01b2, 0x0000, 0x02f2, 0x003e, 0x0240, 0x03d5, 0x01da,
+	    0x0000, 0x0000, 0x0364, 0x037f, 0x0084, 0x028a, 0x003c, 0x0000,
+	    0x0000, 0x03aa, 0x03d8, 0x0000, 0x00eb, 0x0000, 0x038c, 0x0000,
+	    0x010c, 0x0000, 0x01fa, 0x0000, 0x0000, 0x0000, 0x02d8, 0x006c,
+	    0x0061, 0x0000, 0x0024, 0x0000, 0x0000, 0x00e5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00f8, 0x00cc, 0x0218, 0x0000, 0x0137,
+	    0x0000, 0x0000, 0x0091, 0x02fe, 0x02ce, 0x0272, 0x0000, 0x008d,
+	    0x0147, 0x0280, 0x0000, 0x0223, 0x027a, 0x0000, 0x0000, 0x029c,
+	    0x031f, 0x0000, 0x03ba, 0x023a, 0x0000, 0x0088, 0x0000, 0x02c1,
+	    0x0362, 0x0000, 0x0000, 0x0100, 0x017c, 0x0000, 0x02c8, 0x0000,
+	    0x0299, 0x0000, 0x0071, 0x032d, 0x0000, 0x018d, 0x0000, 0x0000,
+	    0x0142, 0x0000, 0x0141, 0x01da, 0x0000, 0x03be, 0x00d7, 0x0000,
+	    0x0000, 0x0374, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x004a, 0x01ce, 0x00ea, 0x0287, 0x0279, 0x0000,
+	    0x0000, 0x0229, 0x0000, 0x0378, 0x0000, 0x0000, 0x020f, 0x0219,
+	    0x0000, 0x0000, 0x0000, 0x01c9, 0x0000, 0x0000, 0x0300, 0x01e4,
+	    0x01de, 0x0000, 0x0241, 0x0000, 0x03ce, 0x03b8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0098, 0x0000, 0x032b, 0x0000,
+	    0x0000, 0x0000, 0x0043, 0x0298, 0x0000, 0x0000, 0x0036, 0x0000,
+	    0x039b, 0x01b9, 0x0154, 0x0000, 0x02fc, 0x03d1, 0x0000, 0x0134,
+	    0x01c5, 0x0000, 0x0000, 0x0000, 0x0160, 0x0000, 0x00f4, 0x0000,
+	    0x00d1, 0x0000, 0x00dc, 0x0000, 0x02b5, 0x027b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x029a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x033a, 0x0000, 0x01f5, 0x0000, 0x01e7, 0x0000, 0x01b9,
+	    0x0000, 0x0000, 0x039f, 0x037e, 0x03e1, 0x0000, 0x0000, 0x022a,
+	    0x0000, 0x00b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0304,
+	    0x0251, 0x0000, 0x02e7, 0x00ec, 0x00dd, 0x02a2, 0x0000, 0x0214,
+	    0x0000, 0x0000, 0x018d, 0x0000, 0x0000, 0x0000, 0x0384, 0x039e,
+	    0x0284, 0x025a, 0x0000, 0x010b, 0x0000, 0x0000, 0x021d, 0x019d,
+	    0x0000, 0x0389, 0x0000, 0x00fa, 0x0000, 0x0000, 0x015d, 0x0000,
+	    0x0000, 0x005c, 0x0000, 0x0000, 0x0000, 0x0000, 0x031e, 0x0000,
+	    0x01b1, 0x005d, 0x0071, 0x0000, 0x0000, 0x0231, 0x0000, 0x0000,
+	    0x0000, 0x038b, 0x0000, 0x0000, 0x02bd, 0x03da, 0x0000, 0x0009,
+	    0x0000, 0x002f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f2,
+	    0x038f, 0x0000, 0x01f8, 0x019b, 0x029e, 0x0000, 0x0000, 0x0151,
+	    0x03ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0089, 0x0196,
+	    0x0000, 0x01a3, 0x0294, 0x0000, 0x00e5, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0349, 0x0000, 0x0000, 0x0338, 0x0035, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x035e, 0x0376,
+	    0x03d1, 0x0000, 0x0000, 0x0019, 0x0000, 0x0136, 0x0000, 0x0382,
+	    0x02a6, 0x0000, 0x0000, 0x0000, 0x0098, 0x00a7, 0x0000, 0x03e4,
+	    0x0258, 0x0000, 0x0000, 0x001f, 0x01ff, 0x012a, 0x03d4, 0x0000,
+	    0x0123, 0x0000, 0x038a, 0x0000, 0x0146, 0x03cf, 0x03c6, 0x0390,
+	    0x0146, 0x0000, 0x00e8, 0x0000, 0x0000, 0x0089, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00f8, 0x0241, 0x0000, 0x01fd, 0x0353, 0x0000,
+	    0x0033, 0x0000, 0x0000, 0x014a, 0x0000, 0x024e, 0x0000, 0x02b4,
+	    0x0345, 0x0000, 0x0000, 0x0000, 0x0257, 0x00b9, 0x0000, 0x0000,
+	    0x0000, 0x0388, 0x0060, 0x0000, 0x03bc, 0x00f4, 0x0334, 0x0098,
+	    0x0132, 0x0000, 0x0074, 0x0000, 0x0000, 0x0000, 0x0000, 0x0307,
+	    0x0000, 0x0270, 0x01c7, 0x00b2, 0x0081, 0x002c, 0x0000, 0x0000,
+	    0x0212, 0x0000, 0x0000, 0x0000, 0x038e, 0x0000, 0x0226, 0x0000,
+	    0x0076, 0x0000, 0x0000, 0x00d6, 0x0000, 0x0000, 0x0000, 0x017e,
+	    0x0000, 0x0132, 0x00fe, 0x03a5, 0x0286, 0x0000, 0x0000, 0x0165,
+	    0x0000, 0x0024, 0x0000, 0x0000, 0x0028, 0x008c, 0x0185, 0x0000,
+	    0x0000, 0x01f3, 0x009a, 0x0146, 0x02c0, 0x0000, 0x0125, 0x0000,
+	    0x01a6, 0x0137, 0x0000, 0x0000, 0x00d8, 0x0000, 0x0000, 0x0297,
+	    0x01d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001b, 0x02dd,
+	    0x0000, 0x0000, 0x031f, 0x0000, 0x0000, 0x0167, 0x03da, 0x030a,
+	    0x0000, 0x0094, 0x0000, 0x02d0, 0x03a9, 0x0000, 0x0000, 0x039b,
+	    0x0000, 0x0000, 0x01fd, 0x0303, 0x0032, 0x0000, 0x0000, 0x00b6,
+	    0x0224, 0x00d5, 0x00fb, 0x01f1, 0x023f, 0x0000, 0x0000, 0x025b,
+	    0x0000, 0x0000, 0x02d2, 0x0000, 0x0000, 0x00ca, 0x0000, 0x03dc,
+	    0x0000, 0x0280, 0x0000, 0x01de, 0x0000, 0x0385, 0x0254, 0x0108,
+	    0x0000, 0x0332, 0x0377, 0x0000, 0x0139, 0x00c8, 0x0000, 0x0395,
+	    0x00b3, 0x0000, 0x0198, 0x0000, 0x025c, 0x0000, 0x01a5, 0x0000,
+	    0x0146, 0x0248, 0x0000, 0x0000, 0x0259, 0x0000, 0x0000, 0x0000,
+	    0x02db, 0x01d8, 0x0139, 0x017e, 0x0000, 0x0096, 0x028f, 0x0000,
+	    0x00e0, 0x0357, 0x011b, 0x0000, 0x0000, 0x03bd, 0x03a4, 0x0109,
+	    0x0150, 0x0000, 0x0000, 0x021f, 0x0000, 0x0000, 0x0000, 0x0198,
+	    0x0019, 0x0000, 0x0000, 0x033f, 0x0000, 0x0000, 0x0000, 0x01f7,
+	    0x0000, 0x0000, 0x00d9, 0x0189, 0x026a, 0x033b, 0x002b, 0x0000,
+	    0x0213, 0x01d9, 0x0000, 0x0000, 0x013c, 0x0000, 0x0000, 0x02e5,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x036b, 0x0000, 0x0000,
+	    0x0000, 0x0120, 0x0000, 0x0252, 0x02c1, 0x0000, 0x0000, 0x0130,
+	    0x01cb, 0x011f, 0x020d, 0x00db, 0x03b2, 0x0151, 0x0000, 0x00a3,
+	    0x0000, 0x00cd, 0x01d1, 0x0033, 0x0200, 0x0000, 0x0342, 0x022a,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0202, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0319, 0x00f9, 0x0322,
+	    0x0000, 0x0000, 0x02d7, 0x0000, 0x0000, 0x036e, 0x0247, 0x0000,
+	    0x0390, 0x0000, 0x0000, 0x01ec, 0x0358, 0x0000, 0x01d1, 0x00aa,
+	    0x01b5, 0x0085, 0x0310, 0x0000, 0x0178, 0x01c1, 0x014b, 0x0000,
+	    0x00bc, 0x0300, 0x0000, 0x0000, 0x0000, 0x034c, 0x01ec, 0x0303,
+	    0x006d, 0x0221, 0x0000, 0x0000, 0x0000, 0x0068, 0x0000, 0x03bf,
+	    0x0000, 0x0000, 0x0357, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e7,
+	    0x000f, 0x0228, 0x0359, 0x0000, 0x0000, 0x0000, 0x01f5, 0x0000,
+	    0x00ec, 0x0139, 0x02fa, 0x0000, 0x02c4, 0x0000, 0x016c, 0x0015,
+	    0x0000, 0x0000, 0x0362, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x00d4, 0x0000, 0x030c, 0x0000, 0x02ad, 0x033d, 0x01ff, 0x0000,
+	    0x009e, 0x0000, 0x0000, 0x01df, 0x0000, 0x02a5, 0x010f, 0x0349,
+	    0x0000, 0x0000, 0x0000, 0x0015, 0x0000, 0x0000, 0x01e5, 0x0000,
+	    0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ed, 0x0000,
+	    0x0000, 0x02e8, 0x017d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0089, 0x0000, 0x0040, 0x0003, 0x0000, 0x03c0,
+	    0x0000, 0x0000, 0x0354, 0x021c, 0x0194, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0366, 0x0136, 0x0000, 0x0105, 0x0000, 0x0000,
+	    0x0346, 0x0000, 0x0000, 0x0245, 0x0000, 0x0278, 0x034d, 0x0000,
+	    0x022e, 0x0000, 0x025c, 0x0000, 0x0000, 0x0000, 0x0033, 0x0107,
+	    0x0242, 0x0166, 0x01b4, 0x0000, 0x0000, 0x036c, 0x0000, 0x00b8,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02e8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0035, 0x02cf, 0x01dc, 0x0000,
+	    0x019d, 0x0069, 0x02bb, 0x03e6, 0x0000, 0x0000, 0x0000, 0x00cb,
+	    0x0000, 0x0208, 0x00e9, 0x0000, 0x0000, 0x01e0, 0x0000, 0x0000,
+	    0x01a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02a9, 0x0000, 0x0000, 0x0335, 0x030c,
+	    0x0017, 0x02ca, 0x0215, 0x0000, 0x0038, 0x0000, 0x02a5, 0x02ec,
+	    0x0000, 0x0000, 0x0000, 0x03a0, 0x0218, 0x03d9, 0x0000, 0x00c4,
+	    0x02bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x029d, 0x00b1, 0x0000,
+	    0x02a4, 0x01e6, 0x0000, 0x01bb, 0x01e2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x00a8, 0x0000, 0x03bc, 0x02c7, 0x0000, 0x0166, 0x0000,
+	    0x003b, 0x0356, 0x0000, 0x025a, 0x017f, 0x0000, 0x01d4, 0x02e6,
+	    0x038b, 0x0000, 0x03d3, 0x0000, 0x0077, 0x0078, 0x0000, 0x0000,
+	    0x02ef, 0x0000, 0x03a8, 0x024f, 0x0372, 0x00e4, 0x0246, 0x0000,
+	    0x004d, 0x00dd, 0x0000, 0x0187, 0x0000, 0x0027, 0x0000, 0x002d,
+	    0x0156, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ea, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0255, 0x0000, 0x001a, 0x003e,
+	    0x004e, 0x0000, 0x0000, 0x01cc, 0x03df, 0x00b9, 0x0000, 0x02b2,
+	    0x004f, 0x0000, 0x009b, 0x0203, 0x0362, 0x0224, 0x0140, 0x01b2,
+	    0x0000, 0x0194, 0x0000, 0x020b, 0x0000, 0x00e7, 0x0000, 0x0000,
+	    0x02eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0145,
+	    0x024f, 0x019c, 0x038f, 0x0000, 0x0308, 0x0000, 0x0000, 0x0361,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000c, 0x0000, 0x0103,
+	    0x0000, 0x0277, 0x0000, 0x0000, 0x02f6, 0x00bd, 0x0172, 0x0000,
+	    0x025d, 0x0000, 0x00b1, 0x0000, 0x02e4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x023f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0241, 0x0000, 0x0000, 0x02a5, 0x0122, 0x02cf, 0x00b6,
+	    0x0000, 0x0041, 0x01b2, 0x00df, 0x0000, 0x0183, 0x01a7, 0x0399,
+	    0x01ef, 0x018e, 0x02ef, 0x0324, 0x0056, 0x037c, 0x0000, 0x0061,
+	    0x0000, 0x00a2, 0x0144, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x037f, 0x0000,
+	    0x0363, 0x0000, 0x000f, 0x0000, 0x02f8, 0x0000, 0x0000, 0x0000,
+	    0x02bd, 0x00e8, 0x0000, 0x038d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0062, 0x0171, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x016e, 0x0261, 0x00c3, 0x0000, 0x033f,
+	    0x0000, 0x02a8, 0x0217, 0x027c, 0x0191, 0x00cc, 0x015d, 0x0154,
+	    0x0378, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e6, 0x0000, 0x00e2,
+	    0x037b, 0x0000, 0x0177, 0x0000, 0x037e, 0x0000, 0x0000, 0x0000,
+	    0x032d, 0x0041, 0x0000, 0x02e1, 0x036a, 0x0185, 0x0000, 0x0225,
+	    0x0000, 0x0000, 0x02af, 0x0000, 0x0000, 0x03b3, 0x0000, 0x02ca,
+	    0x0000, 0x0000, 0x0000, 0x039d, 0x03e3, 0x0000, 0x0000, 0x0000,
+	    0x0281, 0x0042, 0x030a, 0x0000, 0x00bf, 0x0242, 0x03e7, 0x0000,
+	    0x008f, 0x0000, 0x0000, 0x0000, 0x0245, 0x016d, 0x0000, 0x0000,
+	    0x029c, 0x0000, 0x000d, 0x01d9, 0x008f, 0x031c, 0x0000, 0x0137,
+	    0x0000,
+	};
+	uint16_t h[4];
+
+	mi_wyhash2(key, keylen, UINT64_C(0x500000004), (uint32_t*)h);
+
+	h[0] = h[0] % 2001;
+	h[1] = h[1] % 2001;
+	return (g[h[0]] + g[h[1]]) % 1000;
+}
@@ -0,0 +1,217 @@
+/* generated with rurban/nbperf 08a5797 -L _dense64 */
+/* seed[0]: 0, seed[1]: 0 */
+#include <stdint.h>
+
+const uint16_t inthash_table[2000] = {
+	922, 841, 493, 1756, 411, 376, 1445, 1796, 939, 989,
+	1875, 1385, 799, 904, 837, 48, 1159, 454, 999, 19,
+	834, 158, 1315, 451, 529, 569, 282, 683, 1249, 845,
+	1975, 1327, 172, 558, 1567, 501, 355, 1281, 102, 1612,
+	812, 167, 1938, 325, 1155, 1632, 465, 112, 1322, 758,
+	120, 1018, 142, 1093, 75, 759, 1849, 1058, 114, 789,
+	298, 1397, 1054, 940, 468, 324, 649, 1576, 1338, 941,
+	269, 630, 301, 973, 61, 774, 425, 1270, 1566, 721,
+	882, 1819, 307, 1755, 1692, 1998, 1488, 1150, 1485, 326,
+	406, 97, 1699, 382, 740, 1140, 314, 938, 587, 2,
+	1253, 976, 1637, 1346, 1882, 900, 246, 44, 1832, 905,
+	1499, 1057, 1083, 1642, 1764, 98, 1232, 1174, 1295, 1970,
+	150, 1715, 693, 899, 948, 1003, 347, 1729, 124, 1390,
+	1060, 1269, 1376, 1005, 1152, 661, 1264, 1147, 1175, 1032,
+	1069, 528, 1007, 90, 244, 1606, 1179, 31, 1842, 166,
+	1896, 669, 339, 408, 1434, 1496, 1590, 1378, 95, 1934,
+	413, 389, 332, 4, 1514, 378, 198, 39, 603, 1584,
+	684, 170, 731, 1453, 321, 415, 173, 1312, 257, 1266,
+	748, 1825, 1956, 1772, 1564, 224, 218, 730, 162, 221,
+	944, 1995, 1599, 499, 1897, 1481, 1156, 381, 1325, 1381,
+	1265, 657, 157, 473, 153, 429, 1888, 710, 1127, 1731,
+	1038, 1803, 33, 225, 676, 1440, 1655, 811, 118, 258,
+	510, 1922, 749, 765, 1021, 1958, 577, 29, 793, 849,
+	1393, 1370, 1336, 1797, 309, 853, 896, 1681, 778, 385,
+	1542, 1382, 1903, 620, 107, 894, 87, 1846, 220, 1650,
+	885, 862, 144, 1738, 6, 1948, 864, 336, 516, 1173,
+	1351, 571, 1925, 1469, 1343, 333, 1601, 362, 1610, 1944,
+	1424, 1365, 147, 754, 1402, 1309, 570, 1506, 199, 1752,
+	1221, 996, 545, 1219, 1631, 1285, 1403, 764, 1943, 1899,
+	1735, 1909, 553, 1300, 755, 1562, 660, 547, 696, 1063,
+	323, 1294, 1388, 1503, 308, 1885, 304, 1640, 1557, 805,
+	1067, 844, 1019, 1522, 1962, 42, 600, 1094, 1993, 786,
+	360, 1528, 985, 1306, 1747, 681, 850, 149, 1785, 1087,
+	1033, 461, 662, 276, 1833, 666, 1916, 187, 526, 1220,
+	438, 1959, 647, 236, 1318, 1420, 361, 701, 279, 1366,
+	67, 1983, 287, 1918, 788, 349, 1678, 1668, 490, 770,
+	1017, 671, 1000, 479, 1855, 1666, 1604, 1836, 1471, 348,
+	1931, 1203, 932, 1997, 193, 907, 1565, 1141, 930, 1988,
+	444, 1597, 1720, 379, 1556, 1823, 1405, 1357, 1261, 1407,
+	866, 330, 1126, 699, 1483, 363, 643, 422, 492, 946,
+	911, 485, 341, 956, 1259, 1116, 1282, 739, 1994, 1106,
+	1837, 1090, 824, 508, 412, 1118, 262, 1645, 1549, 504,
+	1379, 634, 268, 1500, 1703, 945, 908, 1292, 1794, 1536,
+	1722, 316, 833, 639, 822, 254, 1317, 1242, 49, 1079,
+	735, 266, 1933, 63, 1022, 111, 11, 311, 140, 204,
+	1806, 1297, 1120, 937, 1541, 1974, 1239, 1716, 177, 181,
+	273, 1732, 1332, 1521, 785, 143, 1444, 847, 267, 464,
+	156, 1031, 390, 45, 798, 1299, 877, 903, 757, 1978,
+	206, 420, 1911, 1663, 1417, 1015, 1726, 484, 1167, 10,
+	186, 1515, 1319, 695, 1436, 1964, 1679, 292, 1, 1919,
+	1494, 1540, 1776, 1330, 1091, 1648, 1774, 761, 1170, 1704,
+	769, 230, 1741, 892, 617, 1082, 659, 931, 771, 337,
+	1414, 1302, 1594, 1187, 470, 1347, 1724, 738, 867, 640,
+	1713, 169, 1750, 1268, 1041, 359, 405, 302, 541, 78,
+	1602, 593, 434, 1698, 249, 305, 66, 1710, 294, 1201,
+	1467, 1307, 804, 1334, 1480, 86, 312, 1276, 732, 469,
+	1935, 1810, 716, 200, 943, 1470, 103, 726, 767, 673,
+	1643, 831, 1432, 1271, 919, 264, 663, 110, 1649, 328,
+	1766, 540, 1185, 480, 259, 998, 891, 1763, 935, 88,
+	1543, 1137, 486, 15, 971, 1639, 736, 495, 1727, 1110,
+	1399, 1218, 700, 117, 1040, 1072, 229, 1688, 1197, 1768,
+	1714, 1932, 403, 708, 1192, 1194, 1143, 591, 458, 23,
+	1345, 1356, 1835, 656, 1046, 163, 1924, 1717, 1498, 299,
+	1588, 574, 1554, 579, 552, 106, 1923, 623, 1478, 1904,
+	1792, 803, 852, 556, 906, 1529, 1053, 1800, 1154, 1493,
+	559, 687, 280, 1680, 322, 240, 1490, 924, 1985, 596,
+	1394, 1798, 180, 1193, 1070, 1636, 1364, 1341, 1412, 1454,
+	418, 1136, 84, 101, 482, 288, 954, 1131, 73, 1223,
+	1742, 1113, 1222, 1986, 125, 1050, 1622, 860, 54, 217,
+	427, 1706, 1591, 371, 1502, 399, 1111, 1947, 1024, 1354,
+	1686, 1023, 122, 625, 562, 1415, 1326, 1182, 1323, 548,
+	698, 1078, 880, 129, 1151, 1455, 1928, 1257, 1730, 1537,
+	1921, 1586, 1373, 1099, 453, 487, 606, 318, 546, 497,
+	1425, 472, 374, 1117, 1616, 589, 1893, 21, 1682, 335,
+	1121, 1830, 1572, 261, 400, 1335, 725, 1101, 462, 1374,
+	1009, 1965, 1224, 416, 386, 1991, 560, 1348, 760, 1872,
+	1778, 272, 682, 1308, 1739, 1633, 703, 260, 821, 995,
+	91, 12, 1719, 1685, 781, 342, 1889, 679, 881, 1428,
+	982, 38, 826, 1618, 128, 1225, 1535, 975, 859, 1929,
+	1569, 1208, 1449, 284, 525, 1801, 138, 1333, 527, 445,
+	94, 184, 734, 243, 1206, 1196, 419, 1625, 780, 1035,
+	1202, 686, 72, 215, 1409, 358, 727, 1881, 1740, 1371,
+	319, 1073, 1316, 1864, 1102, 179, 1255, 250, 456, 522,
+	148, 1571, 239, 1450, 1695, 635, 440, 448, 835, 168,
+	951, 1260, 745, 667, 159, 231, 270, 383, 219, 1507,
+	1398, 8, 1570, 1894, 1451, 1850, 1095, 1429, 961, 707,
+	886, 1441, 1491, 1892, 1252, 733, 1296, 334, 794, 474,
+	62, 1809, 1518, 1927, 283, 713, 1845, 1236, 876, 918,
+	928, 1581, 1034, 201, 1615, 1659, 1419, 690, 426, 1505,
+	1433, 214, 1821, 875, 475, 393, 581, 1337, 1721, 477,
+	1275, 575, 183, 1992, 1551, 1693, 1198, 165, 988, 776,
+	1880, 898, 373, 1188, 1321, 586, 79, 711, 981, 1860,
+	1861, 1775, 1816, 3, 65, 1826, 93, 77, 476, 1620,
+	1707, 1509, 1392, 1879, 459, 1829, 773, 417, 1367, 678,
+	1413, 933, 1457, 1677, 1426, 934, 843, 443, 963, 533,
+	1148, 1771, 197, 1630, 1691, 1135, 1789, 449, 442, 766,
+	58, 1661, 35, 1410, 610, 1676, 354, 47, 357, 1476,
+	1176, 970, 1010, 1607, 1160, 823, 1940, 763, 626, 1233,
+	1418, 1982, 828, 555, 645, 1950, 146, 1841, 1874, 392,
+	1438, 621, 1553, 1844, 85, 1044, 1129, 300, 1386, 255,
+	1560, 697, 836, 1146, 471, 890, 505, 1303, 1328, 340,
+	768, 675, 1973, 1045, 1028, 846, 1230, 428, 433, 1867,
+	883, 1733, 636, 394, 1180, 1209, 1171, 1592, 1215, 28,
+	109, 1813, 983, 1718, 435, 952, 702, 136, 1968, 1051,
+	367, 1811, 190, 582, 622, 1626, 1629, 1391, 37, 1634,
+	13, 1583, 719, 1672, 594, 1056, 1178, 1037, 1234, 370,
+	178, 871, 1229, 1186, 222, 1744, 2000, 108, 228, 132,
+	1857, 1013, 1883, 491, 1782, 1286, 1279, 1162, 1472, 174,
+	1743, 1289, 1030, 902, 208, 1396, 1395, 1492, 30, 1184,
+	521, 1501, 1217, 715, 1908, 1497, 1248, 573, 665, 604,
+	974, 1753, 263, 1459, 407, 1621, 1244, 1770, 1525, 592,
+	1011, 1651, 1263, 281, 1608, 884, 1195, 1125, 926, 1670,
+	1353, 344, 1103, 839, 1702, 1773, 1452, 1256, 1547, 870,
+	685, 1839, 64, 646, 1891, 1917, 1574, 116, 535, 960,
+	1372, 950, 879, 161, 542, 1937, 1936, 608, 397, 1538,
+	1439, 962, 1895, 130, 1955, 1086, 1690, 588, 41, 1990,
+	460, 366, 895, 238, 1757, 1684, 1489, 1061, 1406, 532,
+	151, 820, 965, 651, 724, 936, 1912, 1675, 1533, 615,
+	346, 1245, 842, 1664, 1360, 364, 1344, 1546, 955, 1999,
+	1862, 616, 543, 1158, 858, 69, 1355, 40, 1532, 563,
+	248, 825, 977, 688, 210, 511, 1134, 368, 387, 1246,
+	1953, 584, 1667, 463, 285, 503, 1324, 343, 1008, 851,
+	1210, 176, 817, 1545, 642, 1563, 1404, 175, 709, 1108,
+	235, 517, 741, 1926, 992, 1761, 1447, 916, 82, 119,
+	226, 439, 1644, 1359, 855, 1274, 1475, 372, 1822, 351,
+	1227, 1762, 278, 5, 317, 1311, 391, 1748, 520, 338,
+	1749, 16, 664, 275, 1694, 1942, 644, 580, 653, 567,
+	446, 714, 1133, 494, 631, 830, 1765, 1190, 1866, 1284,
+	127, 1641, 874, 1853, 1097, 141, 227, 878, 496, 1683,
+	145, 607, 966, 813, 986, 652, 1163, 350, 1769, 1568,
+	1241, 889, 1049, 624, 1456, 568, 1609, 909, 1780, 205,
+	1701, 1585, 613, 489, 819, 1361, 50, 356, 578, 601,
+	327, 1577, 1482, 1555, 848, 1123, 993, 1920, 807, 377,
+	1808, 74, 1807, 1027, 188, 972, 1624, 1980, 897, 638,
+	1254, 1745, 791, 1603, 1795, 1443, 1132, 1181, 293, 1138,
+	241, 1854, 1647, 1157, 1214, 1115, 742, 104, 1709, 27,
+	628, 1487, 1746, 856, 1290, 1272, 353, 1534, 1243, 1705,
+	704, 133, 1144, 1465, 523, 632, 857, 1847, 602, 1291,
+	1887, 1619, 1877, 345, 303, 629, 1951, 1734, 557, 1805,
+	431, 929, 1504, 192, 1960, 1139, 1080, 1427, 1665, 534,
+	1423, 1516, 1026, 743, 202, 1189, 1914, 942, 1462, 949,
+	25, 1523, 1820, 1799, 801, 1708, 203, 1084, 53, 380,
+	1984, 1635, 1055, 737, 832, 213, 979, 99, 1598, 531,
+	1177, 1561, 1788, 68, 691, 1871, 539, 134, 888, 1812,
+	795, 1029, 1062, 718, 1105, 1077, 1305, 1611, 572, 414,
+	1231, 245, 1228, 674, 756, 430, 1827, 1200, 1627, 1369,
+	1578, 746, 1124, 1250, 498, 1416, 1081, 160, 9, 395,
+	506, 654, 519, 1696, 705, 808, 1383, 672, 1461, 1076,
+	126, 1767, 1349, 60, 1238, 1301, 1074, 1109, 1384, 1092,
+	990, 421, 286, 1342, 712, 1550, 627, 1422, 1107, 398,
+	1408, 910, 1437, 352, 728, 1068, 1100, 599, 1779, 1313,
+	668, 1066, 1786, 814, 1890, 655, 915, 551, 1961, 723,
+	611, 751, 585, 1043, 1870, 1512, 612, 901, 524, 1758,
+	802, 1421, 432, 590, 530, 1900, 1579, 1226, 17, 384,
+	401, 1689, 1558, 365, 1623, 1759, 209, 1802, 1817, 1673,
+	816, 1884, 46, 1952, 1831, 1036, 1145, 1075, 1552, 1653,
+	1368, 1164, 1781, 1531, 375, 689, 1848, 1930, 1510, 1071,
+	295, 121, 658, 1380, 1130, 953, 296, 1873, 796, 720,
+	437, 331, 512, 1387, 1596, 329, 1375, 1851, 1646, 637,
+	313, 1905, 863, 441, 1473, 1161, 1575, 1957, 194, 868,
+	483, 1288, 1760, 680, 1204, 452, 777, 18, 1520, 1725,
+	1511, 1530, 1442, 113, 809, 1411, 1971, 80, 57, 1654,
+	538, 787, 598, 980, 1838, 872, 1362, 1987, 7, 1989,
+	537, 783, 24, 1628, 1213, 1207, 729, 927, 1320, 1128,
+	1967, 618, 488, 1902, 1513, 1886, 71, 869, 1613, 1858,
+	466, 747, 182, 195, 513, 277, 1468, 913, 782, 320,
+	614, 1662, 800, 271, 89, 1430, 59, 619, 1448, 1240,
+	650, 237, 967, 1865, 290, 1580, 1477, 997, 1828, 815,
+	315, 838, 921, 969, 1400, 43, 1168, 694, 1065, 274,
+	536, 20, 1486, 436, 1431, 1304, 810, 1273, 191, 1582,
+	81, 1939, 1401, 1524, 155, 1976, 509, 1149, 500, 518,
+	1737, 1754, 923, 481, 34, 137, 1089, 797, 1901, 1277,
+	753, 1856, 994, 818, 1389, 1205, 583, 1088, 1237, 515,
+	1859, 1247, 1658, 1212, 1258, 1787, 1025, 917, 1526, 1001,
+	1614, 404, 1777, 1818, 1878, 544, 1153, 706, 83, 1600,
+	234, 1104, 1096, 196, 1278, 1736, 1052, 507, 1595, 1495,
+	1573, 964, 1910, 1687, 947, 1283, 1657, 984, 1559, 1047,
+	467, 1963, 1656, 1751, 369, 1791, 455, 252, 1996, 865,
+	1280, 154, 1484, 597, 185, 1915, 854, 829, 873, 1119,
+	1898, 1211, 1945, 772, 70, 633, 609, 1508, 959, 722,
+	1876, 247, 402, 1474, 152, 1016, 912, 920, 779, 1804,
+	100, 1267, 1012, 223, 1358, 550, 96, 36, 232, 792,
+	1114, 957, 131, 1869, 692, 1815, 105, 914, 1064, 1112,
+	55, 1843, 1712, 1048, 92, 135, 1723, 1700, 1339, 1972,
+	784, 840, 1669, 171, 514, 564, 566, 1293, 1122, 1458,
+	549, 306, 1199, 1906, 991, 478, 1142, 1287, 447, 561,
+	750, 1941, 1913, 1783, 1548, 1979, 1593, 1784, 1460, 827,
+	1587, 242, 1946, 502, 212, 76, 1039, 1235, 595, 450,
+	1216, 1085, 139, 1977, 1262, 289, 968, 887, 310, 1098,
+	1674, 207, 1605, 1517, 893, 233, 565, 1363, 1834, 1793,
+	410, 32, 762, 1840, 1172, 1350, 14, 775, 388, 265,
+	52, 605, 1589, 1014, 1446, 806, 22, 1183, 1969, 1165,
+	641, 925, 1539, 253, 251, 1463, 1660, 1790, 1166, 1466,
+	554, 1638, 409, 423, 1340, 123, 1852, 1329, 1981, 1711,
+	1824, 1652, 216, 1617, 1907, 26, 211, 861, 1954, 1863,
+	1059, 1042, 1966, 1868, 1020, 256, 189, 978, 1671, 752,
+	1314, 1435, 958, 1949, 790, 744, 1728, 717, 164, 576,
+	1464, 56, 1814, 396, 1519, 1479, 297, 1006, 1544, 51,
+	1527, 1298, 1352, 1004, 670, 677, 1377, 1191, 648, 987,
+	1002, 1169, 1697, 457, 1310, 424, 1251, 115, 291, 1331,
+};
+
+uint32_t
+inthash(const uint64_t key)
+{
+	uint64_t d;
+
+	d = key - UINT64_C(1099511627777);
+	if (d < 2000)
+		return (uint32_t)inthash_table[d] - 1;
+	return (uint32_t)-1;
+}
@@ -0,0 +1,137 @@
+/* generated with rurban/nbperf 08a5797 -I _randruns */
+/* seed[0]: 0, seed[1]: 0 */
+#include <stdint.h>
+
+const uint16_t inthash_table[702] = {
+	404, 325, 131, 345, 75, 119, 402, 99, 370, 396,
+	506, 478, 382, 337, 502, 459, 260, 4, 239, 602,
+	443, 15, 424, 389, 471, 457, 176, 399, 31, 290,
+	428, 35, 572, 49, 110, 174, 460, 250, 130, 571,
+	434, 544, 573, 467, 537, 281, 417, 507, 195, 33,
+	536, 306, 561, 297, 288, 105, 13, 526, 279, 50,
+	335, 369, 350, 514, 431, 128, 418, 308, 309, 410,
+	500, 509, 365, 623, 378, 355, 199, 420, 429, 192,
+	474, 3, 438, 2, 191, 109, 609, 541, 423, 481,
+	626, 562, 479, 91, 331, 275, 510, 535, 190, 577,
+	625, 8, 363, 529, 456, 240, 312, 287, 96, 186,
+	458, 291, 269, 88, 461, 12, 289, 591, 28, 56,
+	319, 334, 527, 588, 284, 587, 229, 17, 207, 59,
+	278, 180, 249, 450, 549, 466, 138, 607, 60, 385,
+	231, 132, 45, 594, 528, 127, 324, 563, 576, 144,
+	292, 491, 166, 486, 360, 194, 223, 342, 604, 327,
+	82, 211, 129, 512, 107, 583, 543, 43, 593, 266,
+	197, 552, 243, 525, 106, 453, 178, 542, 595, 92,
+	90, 258, 603, 485, 437, 114, 517, 546, 244, 406,
+	539, 80, 392, 323, 425, 241, 493, 545, 518, 299,
+	622, 26, 483, 252, 610, 302, 433, 164, 218, 313,
+	497, 634, 273, 242, 120, 452, 124, 606, 155, 39,
+	16, 394, 63, 574, 272, 100, 551, 463, 464, 136,
+	141, 627, 184, 134, 442, 628, 274, 150, 235, 388,
+	513, 69, 151, 367, 488, 629, 612, 568, 448, 103,
+	41, 200, 383, 301, 490, 46, 62, 619, 77, 253,
+	560, 117, 18, 344, 589, 177, 157, 412, 9, 630,
+	387, 580, 167, 600, 601, 584, 113, 209, 11, 581,
+	614, 398, 379, 36, 351, 538, 523, 53, 271, 24,
+	477, 259, 582, 101, 504, 343, 111, 245, 524, 487,
+	158, 598, 0, 590, 0, 390, 0, 465, 0, 585,
+	0, 236, 0, 395, 0, 515, 0, 384, 0, 212,
+	0, 611, 0, 276, 0, 405, 0, 530, 0, 248,
+	0, 353, 0, 70, 0, 293, 0, 29, 0, 238,
+	0, 328, 0, 419, 0, 317, 0, 83, 0, 137,
+	0, 196, 0, 495, 0, 161, 0, 153, 0, 339,
+	0, 349, 0, 233, 0, 567, 0, 21, 0, 58,
+	0, 159, 0, 225, 0, 93, 0, 22, 0, 332,
+	0, 597, 0, 357, 0, 520, 0, 320, 0, 314,
+	0, 295, 0, 311, 0, 596, 0, 125, 0, 440,
+	0, 498, 0, 415, 0, 371, 0, 170, 0, 232,
+	0, 40, 0, 298, 0, 617, 0, 146, 0, 565,
+	0, 531, 0, 318, 0, 224, 0, 397, 0, 447,
+	0, 578, 0, 97, 0, 52, 0, 73, 0, 364,
+	0, 179, 0, 79, 0, 566, 0, 400, 0, 14,
+	0, 168, 0, 451, 0, 203, 0, 377, 0, 51,
+	0, 210, 0, 632, 0, 540, 0, 358, 0, 436,
+	0, 286, 0, 187, 0, 615, 0, 173, 0, 234,
+	0, 221, 0, 112, 0, 454, 0, 354, 0, 133,
+	0, 175, 0, 372, 0, 254, 0, 27, 0, 30,
+	0, 407, 0, 215, 0, 416, 0, 569, 0, 135,
+	0, 270, 0, 71, 0, 118, 0, 219, 0, 37,
+	0, 522, 0, 316, 0, 300, 0, 579, 0, 430,
+	0, 256, 0, 102, 0, 222, 0, 476, 0, 87,
+	0, 386, 0, 403, 0, 348, 0, 148, 0, 149,
+	0, 427, 0, 261, 0, 468, 0, 315, 0, 618,
+	0, 414, 0, 326, 0, 310, 0, 160, 0, 255,
+	0, 492, 0, 262, 0, 462, 0, 411, 0, 575,
+	0, 374, 0, 193, 0, 214, 0, 605, 0, 47,
+	0, 441, 0, 213, 0, 307, 0, 294, 0, 201,
+	0, 189, 0, 116, 0, 6, 0, 67, 0, 64,
+	0, 48, 0, 265, 0, 95, 0, 624, 0, 469,
+	0, 409, 0, 633, 0, 156, 0, 202, 0, 57,
+	0, 494, 0, 426, 0, 20, 0, 217, 0, 346,
+	0, 54, 0, 373, 0, 23, 0, 94, 0, 480,
+	0, 237, 0, 519, 0, 139, 0, 5, 0, 470,
+	0, 226, 0, 484, 0, 19, 0, 548, 0, 181,
+	0, 230, 0, 121, 0, 564, 0, 115, 0, 505,
+	0, 501, 0, 368, 0, 74, 0, 635, 0, 341,
+	0, 534, 0, 482, 0, 329, 0, 228, 0, 32,
+	0, 89,
+};
+
+const int32_t inthash_sparse[133] = {
+	70000, 77000, 84000, 91000, 98000, 105000, 112000, 119000, 126000, 133000,
+	140000, 147000, 154000, 161000, 168000, 175000, 182000, 189000, 196000, 203000,
+	210000, 217000, 224000, 231000, 238000, 245000, 252000, 259000, 266000, 273000,
+	280000, 287000, 294000, 301000, 308000, 315000, 322000, 329000, 336000, 343000,
+	350000, 357000, 364000, 371000, 378000, 385000, 392000, 399000, 406000, 413000,
+	420000, 427000, 434000, 441000, 448000, 455000, 462000, 469000, 476000, 483000,
+	490000, 497000, 504000, 511000, 518000, 525000, 532000, 539000, 546000, 553000,
+	560000, 567000, 574000, 581000, 588000, 595000, 602000, 609000, 616000, 623000,
+	630000, 637000, 644000, 651000, 658000, 665000, 672000, 679000, 686000, 693000,
+	700000, 707000, 714000, 721000, 728000, 735000, 742000, 749000, 756000, 763000,
+	770000, 777000, 784000, 791000, 798000, 805000, 812000, 819000, 826000, 833000,
+	840000, 847000, 854000, 861000, 868000, 875000, 882000, 889000, 896000, 903000,
+	910000, 917000, 924000, 931000, 938000, 945000, 952000, 959000, 966000, 973000,
+	980000, 987000, 994000,
+};
+
+const uint16_t inthash_sparse_idx[133] = {
+	510, 65, 85, 320, 37, 282, 204, 443, 0, 164,
+	498, 187, 339, 549, 33, 552, 444, 557, 454, 390,
+	97, 171, 554, 335, 77, 434, 83, 585, 321, 507,
+	365, 515, 6, 226, 360, 205, 43, 520, 555, 71,
+	146, 591, 246, 153, 266, 558, 279, 80, 407, 329,
+	392, 107, 84, 474, 161, 197, 121, 162, 546, 303,
+	607, 41, 168, 276, 24, 151, 262, 125, 54, 471,
+	141, 412, 332, 612, 304, 215, 620, 122, 431, 379,
+	619, 358, 553, 355, 400, 284, 181, 351, 502, 245,
+	472, 495, 263, 302, 207, 346, 250, 75, 380, 445,
+	375, 438, 103, 9, 615, 67, 267, 630, 420, 219,
+	203, 182, 139, 184, 361, 569, 531, 142, 421, 374,
+	60, 295, 281, 598, 144, 256, 64, 170, 488, 532,
+	337, 556, 448,
+};
+
+uint32_t
+inthash(const int32_t key)
+{
+	uint32_t d;
+
+	d = (uint32_t)key - UINT32_C(100);
+	if (d < 301)
+		return (uint32_t)inthash_table[d] - 1;
+	d = (uint32_t)key - UINT32_C(1000);
+	if (d < 401)
+		return (uint32_t)inthash_table[d + 301] - 1;
+	{
+		const int32_t *p = inthash_sparse;
+		uint32_t n = 133;
+
+		while (n > 1) {
+			const uint32_t half = n / 2;
+			p = p[half] <= key ? p + half : p;
+			n -= half;
+		}
+		if (*p == key)
+			return inthash_sparse_idx[p - inthash_sparse];
+	}
+	return (uint32_t)-1;
+}
@@ -0,0 +1,12 @@
+/* generated with rurban/nbperf 08a5797 -I _seq200 */
+/* seed[0]: 0, seed[1]: 0 */
+#include <stdint.h>
+
+uint32_t
+inthash(const int32_t key)
+{
+	uint32_t d;
+
+	d = (uint32_t)key - UINT32_C(1);
+	return d < 200 ? (uint32_t)d : (uint32_t)-1;
+}
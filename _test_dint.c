@@ -0,0 +1,98 @@
+/* generated with rurban/nbperf 08a5797 -Ip _rand200 */
+/* seed[0]: 198677718, seed[1]: 2 */
+#include <stdint.h>
+
+static inline void _inthash2(const int32_t key, uint32_t *h)
+{
+	*h = (key * (UINT32_C(0xEB382D69) + UINT32_C(198677718)))
+		 + UINT32_C(2);
+}
+
+const int32_t inthash_keys[200] = {
+	130, 156, 117, 98, 64, 162, 135, 21, 145, 36,	/* 10 */
+	146, 144, 193, 85, 53, 147, 198, 71, 43, 48,	/* 20 */
+	94, 81, 103, 150, 95, 3, 77, 160, 16, 66,	/* 30 */
+	159, 86, 119, 158, 116, 24, 127, 99, 92, 131,	/* 40 */
+	185, 199, 14, 176, 30, 83, 157, 170, 166, 52,	/* 50 */
+	187, 178, 137, 93, 126, 6, 164, 97, 56, 17,	/* 60 */
+	121, 33, 75, 25, 188, 39, 12, 168, 200, 186,	/* 70 */
+	114, 184, 29, 177, 169, 32, 62, 151, 1, 109,	/* 80 */
+	140, 54, 87, 57, 101, 67, 8, 59, 141, 195,	/* 90 */
+	41, 28, 7, 51, 19, 90, 125, 40, 112, 163,	/* 100 */
+	26, 139, 107, 136, 110, 68, 143, 105, 60, 31,	/* 110 */
+	123, 197, 100, 118, 142, 13, 42, 70, 122, 111,	/* 120 */
+	22, 5, 96, 47, 102, 115, 35, 27, 49, 120,	/* 130 */
+	34, 23, 18, 4, 78, 38, 181, 89, 37, 74,	/* 140 */
+	173, 165, 128, 134, 106, 174, 80, 154, 149, 171,	/* 150 */
+	69, 72, 61, 45, 175, 44, 50, 20, 133, 182,	/* 160 */
+	73, 91, 132, 9, 189, 76, 79, 15, 58, 84,	/* 170 */
+	152, 11, 65, 129, 88, 10, 190, 113, 2, 183,	/* 180 */
+	104, 153, 191, 108, 46, 63, 161, 124, 148, 167,	/* 190 */
+	179, 55, 192, 180, 194, 155, 172, 196, 138, 82,	/* 200 */
+	};
+uint16_t
+inthash(const int32_t key)
+{
+	uint16_t result;
+	static const uint16_t g[401] = {
+	     177,  100,    0,    0,    0,  191,    0,    0,
+	       0,    0,  138,  104,   77,    0,   53,  194,
+	     108,  116,   89,  191,    0,    0,   47,   11,
+	      21,    0,    0,  148,    0,    0,    0,   20,
+	       0,    0,    0,    0,  112,    0,    0,  103,
+	       0,   84,  181,   94,    0,  147,   41,  145,
+	       0,  179,  138,    0,    0,  180,  137,    0,
+	     126,  166,  151,  102,   64,   91,   91,    0,
+	      99,    0,    0,    0,  198,    0,    0,    0,
+	     143,   52,    0,    0,  103,   76,    0,  112,
+	     197,  138,    0,    0,  135,   66,    0,   83,
+	     164,    0,  174,    0,    0,    0,    0,  122,
+	       0,    0,    0,  151,    0,  128,  136,  168,
+	      75,    0,    0,  120,  161,    0,   30,  110,
+	       0,    0,  144,    0,    0,   51,   21,    0,
+	       0,  176,    0,   58,   88,   25,  109,    0,
+	      48,  119,  179,  127,    0,  125,    0,    0,
+	       0,    4,  164,   40,    0,  172,    0,   68,
+	       0,   97,    0,  154,  184,  167,    0,  174,
+	       0,    0,    0,   96,   37,    0,    0,    0,
+	       1,    0,    0,   62,    0,    0,   71,  156,
+	      35,   59,   30,   63,    0,    0,    0,    0,
+	     183,    0,   79,    0,    0,    0,    0,   41,
+	       0,   12,   87,    0,    0,   67,  130,   86,
+	       0,   42,  163,    0,   18,    0,    0,    0,
+	       0,    0,    0,  143,    0,  105,    2,    0,
+	       0,    0,    0,    0,  196,  132,    0,    0,
+	      36,    0,    0,    0,  131,    0,   61,  150,
+	      26,   88,    0,   71,   69,  187,   50,  186,
+	     127,    0,  106,  103,  178,    0,  156,    0,
+	       0,    0,   98,    0,    0,   47,    0,  152,
+	       0,   11,   24,    9,    0,  149,   10,   49,
+	       0,  198,  129,    0,    0,   46,    0,    0,
+	       0,  122,  155,   45,    0,   51,  133,   29,
+	     193,    0,  157,    0,   14,    7,    0,    0,
+	      75,    0,    0,    0,   81,    0,    0,    0,
+	     190,    0,   87,  164,    0,   72,    0,  135,
+	     193,  133,    0,  101,  121,    0,    0,  132,
+	     179,    0,    0,  137,    0,    0,   16,    4,
+	       0,    0,   52,  156,    0,    0,  188,   42,
+	       0,    6,    0,    0,  113,    0,    3,    0,
+	       0,    0,   88,    0,    0,  159,   19,    0,
+	       0,   46,  131,    0,   33,  162,    0,  114,
+	      92,    0,    0,    0,    0,  199,    0,    0,
+	       0,   83,    0,  192,    0,    0,    0,  189,
+	       0,   92,    0,    0,   34,    0,    0,    0,
+	     161,    0,    0,  105,    0,    0,    0,   85,
+	      90,    0,   43,  116,   28,    0,   77,    0,
+	       0,  169,   54,    0,    0,    0,   84,    0,
+	       0,   31,  118,    0,    0,    0,   93,    0,
+	      73,
+	};
+	uint16_t h[2];
+
+	_inthash2(key, (uint32_t*)h);
+
+	h[0] = h[0] % 401;
+	h[1] = h[1] % 401;
+	result = (g[h[0]] + g[h[1]]) % 200;
+	return (inthash_keys[result] == key) ? result : (uint16_t)-1;
+}
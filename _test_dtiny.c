@@ -0,0 +1,332 @@
+/* generated with rurban/nbperf 08a5797  _words64 */
+/* seed[0]: 0, seed[1]: 0 */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+const char * const hash_keys[64] = {
+	"aa", "aaamvo", "aaaoepsaxqker", "aaawkatdsy",	/* 4 */
+	"aaazaiwmzo", "aabozllo", "aacwukjxnef", "aafjjxv",	/* 8 */
+	"aafkxt", "aafyjfdobuf", "aagbaqo", "aagwgqbdhc",	/* 12 */
+	"aahpgumys", "aahqwu", "aajoixnfterwky", "aakgie",	/* 16 */
+	"aalazfxybys", "aalqbxuarll", "aamevrbsmiecou", "aanimh",	/* 20 */
+	"aarfotdcsb", "aau", "aauljgrerearvd", "aaupkdl",	/* 24 */
+	"aavgjlqyprl", "aawplxnsl", "aaxw", "ab",	/* 28 */
+	"aba", "abb", "abcroqn", "abcyoudhuyoxv",	/* 32 */
+	"abded", "abdpauwxnyjjw", "abdvzz", "abemcsgtsaqf",	/* 36 */
+	"abgcyzzmsfaohz", "abgfzpabokt", "abghylkt", "abmtelekzgph",	/* 40 */
+	"abnnfppd", "abnznvhmvnpdsm", "abqg", "abrbqe",	/* 44 */
+	"abri", "abrsthrindrt", "abrvngkjcvst", "abttuirixp",	/* 48 */
+	"abucje", "abvlrapgztar", "abxrbvbhskm", "abzjq",	/* 52 */
+	"ac", "aca", "acat", "accdawrk",	/* 56 */
+	"acdumcj", "acfctctvvuqq", "acgeshhyiqp", "acgq",	/* 60 */
+	"acgsyaenn", "achaergtd", "acjqckgbahcww", "acklttjonmfsqw",	/* 64 */
+	};
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	switch (keylen) {
+	case 2:
+		switch (((const uint8_t *)key)[1]) {
+		case 'a':
+			if (memcmp(key, hash_keys[0], 2) == 0)
+				return 0;
+			return (uint32_t)-1;
+		case 'b':
+			if (memcmp(key, hash_keys[27], 2) == 0)
+				return 27;
+			return (uint32_t)-1;
+		case 'c':
+			if (memcmp(key, hash_keys[52], 2) == 0)
+				return 52;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 3:
+		switch (((const uint8_t *)key)[1]) {
+		case 'a':
+			if (memcmp(key, hash_keys[21], 3) == 0)
+				return 21;
+			return (uint32_t)-1;
+		case 'b':
+			if (memcmp(key, hash_keys[28], 3) == 0)
+				return 28;
+			if (memcmp(key, hash_keys[29], 3) == 0)
+				return 29;
+			return (uint32_t)-1;
+		case 'c':
+			if (memcmp(key, hash_keys[53], 3) == 0)
+				return 53;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 4:
+		switch (((const uint8_t *)key)[2]) {
+		case 'a':
+			if (memcmp(key, hash_keys[54], 4) == 0)
+				return 54;
+			return (uint32_t)-1;
+		case 'g':
+			if (memcmp(key, hash_keys[59], 4) == 0)
+				return 59;
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, hash_keys[42], 4) == 0)
+				return 42;
+			return (uint32_t)-1;
+		case 'r':
+			if (memcmp(key, hash_keys[44], 4) == 0)
+				return 44;
+			return (uint32_t)-1;
+		case 'x':
+			if (memcmp(key, hash_keys[26], 4) == 0)
+				return 26;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 5:
+		if (memcmp(key, hash_keys[32], 5) == 0)
+			return 32;
+		if (memcmp(key, hash_keys[51], 5) == 0)
+			return 51;
+		return (uint32_t)-1;
+	case 6:
+		switch (((const uint8_t *)key)[2]) {
+		case 'a':
+			if (memcmp(key, hash_keys[1], 6) == 0)
+				return 1;
+			return (uint32_t)-1;
+		case 'd':
+			if (memcmp(key, hash_keys[34], 6) == 0)
+				return 34;
+			return (uint32_t)-1;
+		case 'f':
+			if (memcmp(key, hash_keys[8], 6) == 0)
+				return 8;
+			return (uint32_t)-1;
+		case 'h':
+			if (memcmp(key, hash_keys[13], 6) == 0)
+				return 13;
+			return (uint32_t)-1;
+		case 'k':
+			if (memcmp(key, hash_keys[15], 6) == 0)
+				return 15;
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, hash_keys[19], 6) == 0)
+				return 19;
+			return (uint32_t)-1;
+		case 'r':
+			if (memcmp(key, hash_keys[43], 6) == 0)
+				return 43;
+			return (uint32_t)-1;
+		case 'u':
+			if (memcmp(key, hash_keys[48], 6) == 0)
+				return 48;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 7:
+		switch (((const uint8_t *)key)[2]) {
+		case 'c':
+			if (memcmp(key, hash_keys[30], 7) == 0)
+				return 30;
+			return (uint32_t)-1;
+		case 'd':
+			if (memcmp(key, hash_keys[56], 7) == 0)
+				return 56;
+			return (uint32_t)-1;
+		case 'f':
+			if (memcmp(key, hash_keys[7], 7) == 0)
+				return 7;
+			return (uint32_t)-1;
+		case 'g':
+			if (memcmp(key, hash_keys[10], 7) == 0)
+				return 10;
+			return (uint32_t)-1;
+		case 'u':
+			if (memcmp(key, hash_keys[23], 7) == 0)
+				return 23;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 8:
+		switch (((const uint8_t *)key)[2]) {
+		case 'b':
+			if (memcmp(key, hash_keys[5], 8) == 0)
+				return 5;
+			return (uint32_t)-1;
+		case 'c':
+			if (memcmp(key, hash_keys[55], 8) == 0)
+				return 55;
+			return (uint32_t)-1;
+		case 'g':
+			if (memcmp(key, hash_keys[38], 8) == 0)
+				return 38;
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, hash_keys[40], 8) == 0)
+				return 40;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 9:
+		switch (((const uint8_t *)key)[4]) {
+		case 'e':
+			if (memcmp(key, hash_keys[61], 9) == 0)
+				return 61;
+			return (uint32_t)-1;
+		case 'g':
+			if (memcmp(key, hash_keys[12], 9) == 0)
+				return 12;
+			return (uint32_t)-1;
+		case 'l':
+			if (memcmp(key, hash_keys[25], 9) == 0)
+				return 25;
+			return (uint32_t)-1;
+		case 'y':
+			if (memcmp(key, hash_keys[60], 9) == 0)
+				return 60;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 10:
+		switch (((const uint8_t *)key)[4]) {
+		case 'a':
+			if (memcmp(key, hash_keys[4], 10) == 0)
+				return 4;
+			return (uint32_t)-1;
+		case 'g':
+			if (memcmp(key, hash_keys[11], 10) == 0)
+				return 11;
+			return (uint32_t)-1;
+		case 'k':
+			if (memcmp(key, hash_keys[3], 10) == 0)
+				return 3;
+			return (uint32_t)-1;
+		case 'o':
+			if (memcmp(key, hash_keys[20], 10) == 0)
+				return 20;
+			return (uint32_t)-1;
+		case 'u':
+			if (memcmp(key, hash_keys[47], 10) == 0)
+				return 47;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 11:
+		switch (((const uint8_t *)key)[3]) {
+		case 'a':
+			if (memcmp(key, hash_keys[16], 11) == 0)
+				return 16;
+			return (uint32_t)-1;
+		case 'e':
+			if (memcmp(key, hash_keys[58], 11) == 0)
+				return 58;
+			return (uint32_t)-1;
+		case 'f':
+			if (memcmp(key, hash_keys[37], 11) == 0)
+				return 37;
+			return (uint32_t)-1;
+		case 'g':
+			if (memcmp(key, hash_keys[24], 11) == 0)
+				return 24;
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, hash_keys[17], 11) == 0)
+				return 17;
+			return (uint32_t)-1;
+		case 'r':
+			if (memcmp(key, hash_keys[50], 11) == 0)
+				return 50;
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, hash_keys[6], 11) == 0)
+				return 6;
+			return (uint32_t)-1;
+		case 'y':
+			if (memcmp(key, hash_keys[9], 11) == 0)
+				return 9;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 12:
+		switch (((const uint8_t *)key)[3]) {
+		case 'c':
+			if (memcmp(key, hash_keys[57], 12) == 0)
+				return 57;
+			return (uint32_t)-1;
+		case 'l':
+			if (memcmp(key, hash_keys[49], 12) == 0)
+				return 49;
+			return (uint32_t)-1;
+		case 'm':
+			if (memcmp(key, hash_keys[35], 12) == 0)
+				return 35;
+			return (uint32_t)-1;
+		case 's':
+			if (memcmp(key, hash_keys[45], 12) == 0)
+				return 45;
+			return (uint32_t)-1;
+		case 't':
+			if (memcmp(key, hash_keys[39], 12) == 0)
+				return 39;
+			return (uint32_t)-1;
+		case 'v':
+			if (memcmp(key, hash_keys[46], 12) == 0)
+				return 46;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 13:
+		switch (((const uint8_t *)key)[2]) {
+		case 'a':
+			if (memcmp(key, hash_keys[2], 13) == 0)
+				return 2;
+			return (uint32_t)-1;
+		case 'c':
+			if (memcmp(key, hash_keys[31], 13) == 0)
+				return 31;
+			return (uint32_t)-1;
+		case 'd':
+			if (memcmp(key, hash_keys[33], 13) == 0)
+				return 33;
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, hash_keys[62], 13) == 0)
+				return 62;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 14:
+		switch (((const uint8_t *)key)[2]) {
+		case 'g':
+			if (memcmp(key, hash_keys[36], 14) == 0)
+				return 36;
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, hash_keys[14], 14) == 0)
+				return 14;
+			return (uint32_t)-1;
+		case 'k':
+			if (memcmp(key, hash_keys[63], 14) == 0)
+				return 63;
+			return (uint32_t)-1;
+		case 'm':
+			if (memcmp(key, hash_keys[18], 14) == 0)
+				return 18;
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, hash_keys[41], 14) == 0)
+				return 41;
+			return (uint32_t)-1;
+		case 'u':
+			if (memcmp(key, hash_keys[22], 14) == 0)
+				return 22;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	}
+	return (uint32_t)-1;
+}
@@ -0,0 +1,889 @@
+/* generated with rurban/nbperf 08a5797 -bI _randneg */
+/* seed[0]: 1804289383, seed[1]: 846930886 */
+#include <stdint.h>
+#include <stddef.h>
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__) && \
+    !defined NBPERF_NO_DISPATCH
+#ifndef NBPERF_DISPATCH
+#define NBPERF_DISPATCH
+#endif
+#include <immintrin.h>
+#elif defined __AVX2__ || defined __AVX512F__
+#include <immintrin.h>
+#endif
+
+static inline void _inthash2(const int32_t key, uint32_t *h)
+{
+	*h = (key * (UINT32_C(0xEB382D69) + UINT32_C(1804289383)))
+		 + UINT32_C(846930886);
+}
+
+const int32_t inthash_keys[2000] = {
+	22191317, -51939742, 49841712, -30939442, 63981914, -38219546, -13369191, -5739082, 14351205, -5249075,	/* 10 */
+	44451635, -349005, 31711453, -60969871, -66919956, -16239232, -14979214, 29191417, 4341062, 66991957,	/* 20 */
+	57401820, -22819326, 38221546, 17291247, -22889327, 46901670, -12809183, 15051215, 60551865, -43539622,	/* 30 */
+	16101230, -11479164, 41931599, 53201760, -34719496, 5671081, -34439492, -63349905, -63629909, 1051015,	/* 40 */
+	-69369991, -4479064, 24781354, 24571351, -18619266, 21701310, -18689267, 67901970, 46481664, -11899170,	/* 50 */
+	54321776, -65939942, -62579894, -61529879, -9799140, -29189417, -23869341, 421006, 701010, 14001200,	/* 60 */
+	-55719796, 37031529, -19529279, -24219346, -60479864, -32129459, -61039872, 17851255, -14279204, -28209403,	/* 70 */
+	-7279104, -11199160, 3081044, -58309833, -21139302, 63351905, -34299490, -41229589, 52431749, 8821126,	/* 80 */
+	-6929099, -21629309, 56071801, 37171531, -64399920, -37729539, -15539222, -54809783, -15679224, 59921856,	/* 90 */
+	-19599280, 38851555, -38639552, 35911513, -44519636, 58101830, -65659938, 20791297, 8891127, 43401620,	/* 100 */
+	47671681, 3501050, 3641052, -13999200, 43121616, 25971371, 32061458, -40389577, 23381334, -53129759,	/* 110 */
+	-60409863, -51869741, 21981314, 17501250, 24221346, -1539022, 1541022, -22609323, -51729739, 62651895,	/* 120 */
+	-42559608, 8471121, -10359148, 9731139, -17219246, -41509593, 65871941, -37449535, -62719896, -47389677,	/* 130 */
+	69091987, -63769911, 28701410, -48719696, -40669581, 50261718, -57959828, -23519336, 61181874, 46411663,	/* 140 */
+	-29959428, -11409163, 49981714, -18479264, -26879384, 9521136, 28001400, -50959728, -31149445, -21839312,	/* 150 */
+	-58449835, -48229689, -11759168, -69159988, -68669981, 36541522, -66849955, 14421206, 55161788, -6649095,	/* 160 */
+	-62369891, -65029929, 37871541, -60199860, 52571751, -67339962, 31011443, 34861498, 13161188, 17431249,	/* 170 */
+	-32199460, 54251775, -66569951, -16449235, -32059458, -65379934, -2239032, 7421106, -69789997, 6441092,	/* 180 */
+	-40109573, 18831269, -41789597, 65451935, 8611123, 14561208, -10289147, -489007, -23099330, -45919656,	/* 190 */
+	-57049815, 39341562, 68881984, -2099030, 141002, -37589537, 30241432, 1751025, 36611523, -22259318,	/* 200 */
+	-61669881, -15049215, -34999500, -48019686, 68111973, -39199560, -64539922, -60899870, 13231189, -3289047,	/* 210 */
+	-42419606, -36749525, -48999700, -36189517, -40319576, 57821826, -32409463, -17849255, 69231989, 45291647,	/* 220 */
+	-38429549, -49769711, -35069501, 68041972, 12461178, 55441792, 14281204, 41861598, -30799440, 34581494,	/* 230 */
+	-54389777, -26389377, -51659738, -10569151, 25691367, 7981114, 52291747, -7699110, 34091487, 60691867,	/* 240 */
+	18971271, 211003, -26739382, 25621366, -46199660, 37451535, 34931499, -25689367, -66149945, 66571951,	/* 250 */
+	-9309133, -6299090, -53689767, 69791997, 61811883, -39619566, -23169331, 67131959, -66499950, -12529179,	/* 260 */
+	-12879184, -12109173, -45289647, -9449135, 41301590, -14209203, -66079944, -40249575, -36539522, 42701610,	/* 270 */
+	41581594, -47319676, 39691567, -3009043, 14071201, 61741882, 24151345, -42629609, -41719596, 50191717,	/* 280 */
+	58171831, 6301090, -51519736, -27159388, 53481764, -45429649, 2031029, -13719196, -34019486, 23941342,	/* 290 */
+	-24639352, 57681824, -64749925, -1609023, 36401520, 2451035, -50469721, -27439392, 5461078, 26321376,	/* 300 */
+	-67199960, 50401720, -41369591, -13229189, -7349105, -18549265, -58659838, 42421606, -46059658, -16659238,	/* 310 */
+	-51099730, 56001800, -12039172, 26391377, 38501550, 54811783, 32341462, -839012, -61809883, -40529579,	/* 320 */
+	6861098, -43959628, 21001300, -17009243, -21349305, 19181274, 64331919, 41161588, 1611023, -14629209,	/* 330 */
+	-54669781, -7209103, 61111873, 12111173, -64049915, 30871441, 5881084, 44311633, -69509993, 61461878,	/* 340 */
+	-8329119, -34579494, 19601280, -63489907, -1399020, -279004, -35489507, -27089387, -47529679, -36819526,	/* 350 */
+	-43819626, -66359948, -31989457, 59221846, 12811183, 10641152, -59359848, 10921156, -57259818, 51311733,	/* 360 */
+	44801640, -33459478, -3079044, -15959228, -45499650, -67409963, -56209803, 45431649, 65731939, -36119516,	/* 370 */
+	841012, 63071901, -1679024, 67761968, 17711253, 50821726, -54529779, -51379734, 67691967, 28491407,	/* 380 */
+	-22119316, -37939542, 27371391, 23731339, 45781654, -53549765, 32481464, -67759968, -37519536, -26949385,	/* 390 */
+	63701910, -55929799, -9379134, -58729839, 38081544, -22539322, -12179174, -63979914, 59291847, -10989157,	/* 400 */
+	33461478, -66639952, -55579794, -29539422, -63139902, -14559208, 45851655, 57261818, -21069301, 60481864,	/* 410 */
+	-23799340, -24569351, 62091887, -46549665, 29751425, -37099530, -20229289, 7631109, -20369291, -40949585,	/* 420 */
+	-2449035, -1259018, -55439792, -52989757, 10991157, 68811983, -19179274, 8751125, -40459578, -65449935,	/* 430 */
+	56981814, -60059858, -16379234, 42911613, 15191217, -61739882, 59361848, 36051515, 59781854, -47599680,	/* 440 */
+	-16589237, -2799040, -48789697, 39901570, 9031129, -55789797, 45361648, -66429949, -49279704, 32691467,	/* 450 */
+	27651395, 18691267, -32619466, -21489307, -6579094, -3429049, -18829269, -57189817, 35701510, 69721996,	/* 460 */
+	-67689967, -44239632, -15259218, -21769311, 50611723, 54181774, 14211203, -44099630, 21561308, 12251175,	/* 470 */
+	-15399220, -35209503, -52079744, 63141902, -26809383, -6999100, 23521336, 6091087, 19741282, 26181374,	/* 480 */
+	60901870, -58589837, -23379334, 38711553, 69511993, -23449335, 15471221, 17991257, 3011043, 23871341,	/* 490 */
+	-59569851, 6791097, -60619866, -52009743, -22189317, -20929299, -65869941, -39829569, 33181474, -13789197,	/* 500 */
+	2241032, -6509093, -9659138, 20931299, 64261918, -49559708, -50259718, -57819826, 9801140, 45711653,	/* 510 */
+	58801840, 30311433, -3219046, 63281904, -61879884, 59151845, 45011643, 34721496, 13861198, -42769611,	/* 520 */
+	63911913, 63211903, 15611223, 6651095, -41649595, 63841912, -7419106, 29541422, 55931799, -49069701,	/* 530 */
+	-52149745, -39759568, 28631409, 67271961, -67549965, -67829969, -31709453, -39689567, 39831569, -25409363,	/* 540 */
+	22541322, -64609923, -8679124, -11269161, 42001600, -19249275, -43609623, 19461278, -19809283, -59709853,	/* 550 */
+	-10499150, -38149545, 2591037, 4831069, 35211503, 35001500, 48441692, -30099430, 20511293, -40809583,	/* 560 */
+	27721396, 5391077, -4339062, 9241132, 54671781, 49491707, 12391177, 47741682, 20021286, 58031829,	/* 570 */
+	55231789, 66641952, -17569251, -55509793, 24011343, 26951385, -56419806, -64679924, 66151945, 27791397,	/* 580 */
+	-27719396, 24991357, 7701110, 65311933, -53059758, 47881684, -62509893, 50751725, -29469421, 48931699,	/* 590 */
+	-45359648, 4201060, 48091687, -60339862, -40599580, 48161688, -27929399, -58519836, -33529479, -10009143,	/* 600 */
+	-32899470, -35839512, -139002, 61881884, 51171731, -31289447, -3499050, 15961228, 16871241, 48581694,	/* 610 */
+	48231689, -38009543, -36679524, -66989957, -28139402, 11551165, 62721896, -53969771, -54879784, 12671181,	/* 620 */
+	18201260, 68321976, 32551465, 40531579, -12389177, -19039272, 16731239, 11761168, 1891027, 63001900,	/* 630 */
+	34371491, 18761268, 61531879, -46899670, -5529079, 28841412, -14489207, -54949785, 28281404, 14981214,	/* 640 */
+	5111073, 53271761, 3921056, -2939042, -52639752, 47181674, -50539722, 10221146, 33741482, -68879984,	/* 650 */
+	66221946, 55301790, 39971571, -41859598, 23241332, 65171931, 67621966, 11341162, 48371691, 1961028,	/* 660 */
+	61321876, -53619766, -4829069, 491007, 34161488, 48301690, -68459978, 41651595, -40039572, -61319876,	/* 670 */
+	8261118, -15609223, -42139602, 50121716, -42979614, 68391977, 65031929, 66921956, 57121816, -8189117,	/* 680 */
+	1401020, -69579994, -42489607, -24149345, 25481364, -1469021, 22891327, -43469621, 34021486, 47251675,	/* 690 */
+	-53409763, -5809083, -44799640, -10779154, 61671881, 8681124, -16729239, -59639852, -27299390, -48579694,	/* 700 */
+	-16519236, 29821426, 21841312, -28979414, 48021686, 43681624, -39129559, 65521936, 15891227, -7139102,	/* 710 */
+	41021586, 28771411, 68951985, 65241932, -48159688, -67479964, 61601880, 52991757, 37241532, 25271361,	/* 720 */
+	-42279604, -59219846, 36191517, 38781554, 34791497, 48651695, -20509293, -7629109, -9169131, -64329919,	/* 730 */
+	-13649195, 33111473, 21421306, -10919156, 11061158, -35559508, 44101630, 55371791, -21279304, 29401420,	/* 740 */
+	-48299690, -8469121, 20161288, 16031229, -20719296, -24009343, -6089087, -42209603, 17151245, -53479764,	/* 750 */
+	60131859, -25619366, -41999600, -69649995, -48509693, -35979514, 69021986, 69161988, 53341762, 65591937,	/* 760 */
+	11691167, -15749225, -62999900, -65169931, 38991557, 31431449, 51731739, -24079344, -27859398, -46619666,	/* 770 */
+	24081344, -49909713, 13091187, -49139702, 16941242, 69651995, 57751825, 15331219, -49419706, -30169431,	/* 780 */
+	52011743, -17289247, -27789397, -24359348, -66219946, -65099930, 57541822, -2659038, -47179674, -31639452,	/* 790 */
+	24501350, 10011143, -15329219, -59499850, -30379434, -31499450, 13301190, 31501450, 6721096, -13019186,	/* 800 */
+	-10639152, 55651795, -13509193, 55581794, 54111773, -4899070, -47109673, 40601580, 69931999, 58381834,	/* 810 */
+	-34859498, -42069601, -2869041, -32339462, -3779054, -2169031, 28071401, -30589437, 62861898, 27231389,	/* 820 */
+	-31359448, 63491907, 60411863, -50889727, 11831169, 911013, -58869841, 18901270, 43191617, -4689067,	/* 830 */
+	-18759268, 19321276, 50051715, -38569551, -21979314, 18131259, 4761068, 13931199, -1889027, 53131759,	/* 840 */
+	18271261, 3781054, -7909113, -58239832, -22469321, 17571251, -69929999, 45991657, 52151745, 39271561,	/* 850 */
+	42351605, -64889927, -28349405, -30309433, 16381234, -3989057, 5951085, 69441992, 15121216, 19811283,	/* 860 */
+	-38779554, 53831769, 1331019, -44029629, -20789297, -209003, 56561808, -63279904, -1959028, -54249775,	/* 870 */
+	-37799540, 29611423, -41929599, -9869141, -66779954, 61951885, -36259518, -45849655, -10219146, -8539122,	/* 880 */
+	12321176, 52221746, 66781954, 34301490, 24711353, -68949985, -69859998, -12319176, 19531279, -28559408,	/* 890 */
+	54391777, -53339762, 51451735, 6581094, 3151045, -45149645, -16169231, 25131359, 49771711, -38849555,	/* 900 */
+	-29889427, -47949685, -22959328, 5531079, -24499350, 36331519, -29819426, 28561408, -54179774, 26881384,	/* 910 */
+	27021386, 40461578, -32969471, -17359248, 38361548, 56351805, 46971671, -49489707, -29749425, 40951585,	/* 920 */
+	61251875, -11969171, 19251275, -12249175, 40881584, 8541122, -6369091, 59431849, 32621466, 28351405,	/* 930 */
+	43611623, -48089687, 66431949, 1000, 19951285, 35631509, 66291947, -67059958, -27369391, -53269761,	/* 940 */
+	58661838, 7561108, 9941142, 6511093, 29121416, 12041172, 59571851, 39131559, -26669381, 56701810,	/* 950 */
+	65941942, -22049315, 26251375, 43471621, 10291147, -63909913, -13859198, -14349205, 56281804, 31921456,	/* 960 */
+	-629009, -38079544, -58939842, -57329819, 65661938, -25759368, -5039072, 42631609, 37801540, 16451235,	/* 970 */
+	54461778, 7911113, -31079444, -69001, -16309233, -4409063, 64121916, -39059558, -61949885, -25829369,	/* 980 */
+	47461678, -69439992, -6719096, 35281504, 60621866, -7769111, -19879284, -56839812, 69861998, 45501650,	/* 990 */
+	16171231, -34369491, -26529379, 351005, 53761768, -54319776, 29051415, -18969271, 68531979, 36891527,	/* 1000 */
+	-9519136, 37521536, -47039672, 39201560, -57399820, 12181174, 3991057, 18061258, -52289747, 27301390,	/* 1010 */
+	-43679624, 38641552, 8961128, -29399420, 23801340, -6229089, -30449435, -17639252, 17921256, 22751325,	/* 1020 */
+	39411563, 65101930, -19389277, -35909513, -50609723, 57051815, 771011, -69019986, 46061658, -54459778,	/* 1030 */
+	4551065, -51589737, 4621066, -20299290, -979014, 16591237, -5389077, -56139802, 41371591, -48649695,	/* 1040 */
+	-34509493, 30101430, -15469221, 31991457, -8609123, -50749725, -56909813, 44171631, 29681424, 2941042,	/* 1050 */
+	-56349805, -32759468, 29891427, 60971871, -59849855, 8121116, 12951185, 15681224, 60271861, -46339662,	/* 1060 */
+	-27509393, 53551765, 23031329, 10781154, -909013, 29471421, -45779654, 7071101, 5601080, 28421406,	/* 1070 */
+	36261518, -16099230, -46689667, -45569651, -39479564, -13579194, 62791897, 21491307, 40181574, -38989557,	/* 1080 */
+	-58099830, -56699810, 46131659, -18199260, -68389977, 24641352, 18341262, -14419206, -52709753, 37381534,	/* 1090 */
+	-48439692, 33391477, -55999800, 46201660, -11339162, -7489107, 39761568, 59851855, 34441492, -28069401,	/* 1100 */
+	35841512, 66081944, 47951685, 18481264, -28699410, 63631909, -67269961, 47321676, -44309633, 46551665,	/* 1110 */
+	13651195, 38011543, 26671381, -61389877, 33951485, -28489407, -8889127, -28839412, -51029729, 19111273,	/* 1120 */
+	-52919756, -55369791, -7979114, 14701210, 64191917, -48859698, -45639652, 62371891, -60549865, 14771211,	/* 1130 */
+	-42349605, 49141702, 17081244, -4269061, 68181974, 7771111, 8401120, 53971771, 35771511, 65381934,	/* 1140 */
+	14631209, 31641452, 44661638, 4411063, -2309033, -55649795, 21141302, -21699310, 45151645, -57679824,	/* 1150 */
+	45641652, 60201860, -33109473, 10431149, -33039472, -36959528, 44241632, 40251575, 54041772, -8959128,	/* 1160 */
+	67201960, 48791697, -66709953, 2661038, -45219646, -56769811, 37591537, 49281704, -39409563, -41579594,	/* 1170 */
+	45221646, 44031629, 28141402, -34159488, -3849055, -33809483, 19041272, -61459878, -27019386, -17919256,	/* 1180 */
+	-28419406, 18621266, -33389477, -5879084, -49209703, -1049015, -47809683, 68601980, -19739282, -25899370,	/* 1190 */
+	61041872, -39969571, -57469821, 62931899, -55299790, 26531379, 12741182, -55159788, -33949485, 64541922,	/* 1200 */
+	-8819126, -44659638, 24361348, 67061958, 49701710, -26179374, -26039372, 49351705, 59501850, -14839212,	/* 1210 */
+	-54039772, 40741582, -40879584, 40391577, 21281304, -60829869, -63209903, -27579394, -44589637, 5811083,	/* 1220 */
+	24921356, 36961528, 25831369, 26601380, 68461978, 49631709, -65309933, 56841812, 30171431, 46831669,	/* 1230 */
+	23101330, 9381134, -57749825, -35419506, 41791597, -24989357, 6931099, 40671581, 56631809, 9591137,	/* 1240 */
+	-69719996, -43189617, -9729139, -2519036, -63069901, 3571051, -20649295, -3709053, 68251975, 69301990,	/* 1250 */
+	-3359048, -20859298, -18129259, -20579294, -45709653, 21631309, 23661338, -17149245, -44729639, -2589037,	/* 1260 */
+	-33879484, 50891727, -62089887, 46761668, -18269261, 27861398, -1819026, -69089987, 36121516, 30521436,	/* 1270 */
+	-26319376, 15751225, 4481064, 34231489, -37659538, 22611323, -29049415, -5319076, 15541222, -32549465,	/* 1280 */
+	-66009943, 49561708, 44381634, -15819226, 57191817, 47811683, 35561508, 18411263, -29259418, -51309733,	/* 1290 */
+	-32269461, 19391277, 67481964, 56491807, -68039972, -31219446, 34511493, 55021786, -769011, -13439192,	/* 1300 */
+	19881284, -56279804, -65589937, 6371091, 6231089, 52501750, 11131159, 26461378, 17641252, 32971471,	/* 1310 */
+	-19319276, -25269361, -8259118, -64469921, 1191017, 54531779, -20089287, 51031729, 13721196, 1681024,	/* 1320 */
+	47041672, -2029029, 50331719, 64891927, 16241232, 48511693, -61599880, -59149845, -38289547, -40739582,	/* 1330 */
+	21351305, -17079244, 5321076, 51871741, 33041472, -52359748, -46479664, 56911813, -68739982, 55721796,	/* 1340 */
+	70002000, 42071601, -37869541, 30801440, 31081444, 58241832, -16799240, -42839612, -64119916, 43961628,	/* 1350 */
+	46341662, -47249675, -52499750, 43821626, -42909613, -53899770, -25479364, -4129059, -43259618, -17989257,	/* 1360 */
+	-19949285, 52081744, 39551565, 35491507, 2521036, 40321576, -7069101, 52641752, -31429449, -65239932,	/* 1370 */
+	-57119816, -42699610, 58521836, -7839112, -30729439, -6859098, 62441892, -22679324, 64611923, 54741782,	/* 1380 */
+	-44939642, -5179074, -18409263, -11059158, -24779354, -57539822, 35981514, 30941442, -33179474, 14491207,	/* 1390 */
+	-32479464, 39621566, 66501950, 15261218, 58731839, 37101530, 59711853, 8331119, -13159188, 9101130,	/* 1400 */
+	-26599380, -4619066, -4759068, -11689167, -19669281, 5181074, 57471821, -64189917, -31849455, 50961728,	/* 1410 */
+	2871041, 3361048, 47601680, -43889627, 51241732, 68741982, 7281104, 30591437, 64401920, 4691067,	/* 1420 */
+	-53199760, 29261418, -38499550, 26741382, -12669181, 11481164, -49349705, 25061358, 58941842, -699010,	/* 1430 */
+	44731639, -43749625, 34651495, 32761468, 21071301, -23029329, -9239132, 68671981, -28769411, 42771611,	/* 1440 */
+	51661738, -61249875, -29609423, -68529979, -63839912, -5949085, -59919856, -55229789, -14909213, -3149045,	/* 1450 */
+	-20439292, -16869241, 28981414, 22471321, 29961428, -8049115, 35421506, 22121316, 56211803, -31779454,	/* 1460 */
+	43261618, -32689467, 44941642, 62161888, 57891827, -30519436, -65519936, 64821926, 37941542, -29119416,	/* 1470 */
+	38291547, 49001700, 64961928, 7491107, -46269661, -3639052, 47391677, 27931399, 26111373, 9451135,	/* 1480 */
+	64681924, 60831869, 35071501, -67969971, 20721296, 13791197, 58591837, -62019886, 4271061, 10151145,	/* 1490 */
+	-62789897, -25339362, 53621766, -12599180, -26249375, -35139502, 58871841, -10149145, 33601480, -59009843,	/* 1500 */
+	-44449635, 20091287, 67411963, 66361948, -34089487, 12881184, 59991857, -34929499, 66851955, -27649395,	/* 1510 */
+	-68809983, 20441292, -41159588, -58379834, -63419906, 25901370, 27581394, -29329419, -64819926, 67551965,	/* 1520 */
+	1261018, -11129159, 22681324, -47459678, -6019086, 62581894, 35141502, -22749325, -16029229, 32411463,	/* 1530 */
+	50541722, -45989657, -14139202, 55511793, -24849355, 25761368, -41439592, 36681524, 11901170, -4199060,	/* 1540 */
+	-24709353, -61179874, -53829769, -33249475, 53411763, -18899270, -25059358, -2379034, 42281604, 30731439,	/* 1550 */
+	52851755, 58311833, 59011843, 3221046, 25341362, -66289947, -36049515, -44379634, 35351505, 2171031,	/* 1560 */
+	47111673, 33531479, 36821526, -12739182, -56069801, -57609823, -23239332, -5109073, -69299990, 25551365,	/* 1570 */
+	-68249975, -34649495, 41511593, 56141802, 4131059, -6789097, 37661538, -39269561, 27161388, 7841112,	/* 1580 */
+	33321476, -55089787, 19671281, 39481564, 17781254, -65729939, 30451435, 5041072, 31291447, -62859898,	/* 1590 */
+	-53759768, -35699510, -59779854, 48861698, -51239732, 10501150, 51101730, 26811383, 54601780, -55859798,	/* 1600 */
+	33671481, -62929899, 51521736, 33251475, 13441192, 2731039, 60341862, 14841212, 30381434, -58799840,	/* 1610 */
+	-59289847, -34229489, 28211403, -36329519, -49629709, -14769211, -69229989, 11411163, 28911413, -50679724,	/* 1620 */
+	561008, 13371191, -68319976, -37169531, -8399120, 43891627, -10429149, 54951785, 44871641, -62299890,	/* 1630 */
+	53061758, 8051115, -54739782, 20861298, -43329619, -33319476, 41091587, -9029129, -41089587, -44169631,	/* 1640 */
+	14911213, 20581294, -63559908, 16311233, 53691767, 45081644, 1121016, -50819726, 45921656, 48721696,	/* 1650 */
+	43331619, -35629509, 22261318, 23311333, 60061858, -18059258, 15821226, -58169831, 49911713, 6021086,	/* 1660 */
+	61391877, 15401220, -67619966, -30239432, 52921756, 20651295, -56559808, -62649895, 57611823, -30659438,	/* 1670 */
+	-39549565, -37309533, 4901070, 69371991, 62021886, 32201460, -35349505, -50119716, 3431049, -9589137,	/* 1680 */
+	-22329319, 51941742, -21209303, -24289347, -35769511, -10709153, 10361148, 17011243, 65801940, 21911313,	/* 1690 */
+	12601180, -60269861, 54881784, -31569451, 38921556, 10711153, 46691667, 16801240, 7211103, 11621166,	/* 1700 */
+	-43049615, -25199360, 2381034, -32829469, -25129359, -21419306, 62511893, 23451335, -38359548, 24851355,	/* 1710 */
+	56771811, -45009643, -15189217, -10079144, 38151545, 37731539, 3291047, 50681724, -20159288, 22961328,	/* 1720 */
+	67341962, 24291347, -68109973, 7351105, -5459078, 44521636, 57331819, -9939142, -35279504, -46829669,	/* 1730 */
+	33811483, 11971171, -44869641, 7001100, -18339262, 30031429, 46621666, -47669681, -33669481, -67129959,	/* 1740 */
+	42561608, -24429349, -52429749, -68599980, -51799740, -54109773, -559008, -1329019, 10851155, -48929699,	/* 1750 */
+	-3569051, 41721596, -54599780, -29679424, 981014, -59429849, 13021186, 57961828, 43751625, 66711953,	/* 1760 */
+	-41019586, 20371291, 5741082, 47531679, -4549065, -23659338, 7141102, 17361248, 31151445, 22051315,	/* 1770 */
+	-20019286, -62159888, -43399620, -28909413, -65799940, 23591337, -4059058, 25411363, 51591737, 27091387,	/* 1780 */
+	-51449735, 31781454, 13581194, 51381734, -45079644, 60761868, 42211603, 29331419, 50471721, -27229389,	/* 1790 */
+	42491607, 9871141, 2311033, 45571651, 9311133, -50329719, -59079844, -23309333, -38919556, -5669081,	/* 1800 */
+	-16939242, -15119216, 36471521, 1471021, 64751925, 32901470, 63771911, 20301290, 40041572, -48369691,	/* 1810 */
+	63561908, -28279404, 58451835, -52219746, 43051615, 5251075, 53901770, -11549165, 31851455, -19459278,	/* 1820 */
+	-52569751, -1189017, 38571551, -49979714, -30029429, -37029529, -13299190, 24431349, -60689867, 62231889,	/* 1830 */
+	21211303, -8749125, 631009, 4971071, 17221246, -50189717, -21909313, -25549365, -28629409, 59641852,	/* 1840 */
+	40111573, -46409663, -11619166, 41441592, -6159088, -39899570, -56979814, -59989857, 9661138, -9099130,	/* 1850 */
+	42841612, 27511393, 41231589, 49211703, 55091787, 2101030, -14069201, 3711053, -12949185, 49421706,	/* 1860 */
+	-36889527, -22399320, -60759868, -11829169, -46129659, 32831469, 42141602, -50399720, -60129859, 6161088,	/* 1870 */
+	-8119116, 33881484, -62229889, -40179574, -3919056, 43541622, -30869441, -37379534, 67971971, -15889227,	/* 1880 */
+	-41299590, 14141202, -23729339, -64259918, -46969671, 49071701, -34789497, 64471921, -51169731, -61109873,	/* 1890 */
+	-12459178, -6439092, 62301890, -17499250, -14699210, 31571451, -2729039, 31221446, 9171131, 18551265,	/* 1900 */
+	-64959928, -33599480, -58029829, 10081144, 66011943, 52711753, 22821326, 281004, 22401320, 13511193,	/* 1910 */
+	2801040, -39339562, 51801740, -31009443, 64051915, -67899970, -19109273, -50049715, -52849755, -36609523,	/* 1920 */
+	-56489807, -63699910, -10849155, 12531179, 46271661, 10571151, -43119616, 40811583, 63421906, 30661438,	/* 1930 */
+	-17429249, 42981614, 69581994, -4969071, -52779754, -1119016, -20999300, 20231289, 11271161, 52781754,	/* 1940 */
+	3851055, -13089187, -36469521, -37239532, 59081844, -23589337, -17709253, -23939342, 55861798, -25969371,	/* 1950 */
+	55791797, -13929199, 71001, 32131459, 26041372, -47879684, 1821026, 44591637, -31919456, 16521236,	/* 1960 */
+	-49699710, -1749025, -419006, 52361748, -55019786, 38431549, -17779254, -36399520, -38709553, 36751525,	/* 1970 */
+	-47739682, 8191117, -5599080, -46759668, -21559308, 31361448, -26109373, -56629809, 39061558, 16661238,	/* 1980 */
+	37311533, -26459378, 22331319, 56421806, -57889827, -7559108, 4061058, -62439892, 67831969, -27999400,	/* 1990 */
+	-33739482, 23171331, 27441392, 11201160, -49839712, -24919356, 25201360, -68179974, 21771311, 32271461,	/* 2000 */
+	};
+static const uint16_t inthash_g[4004] = {
+	       0, 1536,    0,  283,  880,  614,    0,    0,
+	       0, 1363,  319,    0,    0,    0,    0,    0,
+	       0, 1921,  780,    0,    0,    0,  810,  713,
+	    1871,    0,    0,    0,  964,    0,  462,   60,
+	       0,    0,    0,  757,  132,    0, 1466,    0,
+	       0,    0, 1617,  771,  338,    0,    0,    0,
+	      96, 1640, 1837,  447,    0,    0,  394,    0,
+	     400,    0,    0,    0,    0,  782, 1646, 1449,
+	       0,   49,   46,    0, 1346, 1032,  985,    0,
+	     432,  398,  579, 1710,  109, 1366,    0,    0,
+	       0, 1588,    0, 1614,    0,  152,  970,   59,
+	       0,   14,    0,  803,    0, 1757,    0,  902,
+	    1514,  709,    0,    0, 1506,    0,    0,    0,
+	       0,    0, 1047,    0,  532, 1243,    0,    0,
+	       0,    0, 1698,  666,    0,    0,    0, 1010,
+	     948,  646,    0,    0,   42,  431, 1871,   59,
+	     695,    0, 1779,    0,    0,    0,  729,    0,
+	       0,    0,   28, 1501, 1146, 1215,    0,    0,
+	    1215, 1914, 1775,  961,  963,    0,    0, 1263,
+	    1920,  376,    0,  905,    0,  908,  135,  508,
+	       0, 1011,    0,    0,    0, 1875,    0,    0,
+	     919,    0,    0, 1802,  485, 1500,    0,    0,
+	       0,    0,  652,    0,  419,    0,    0,  473,
+	    1107,    0,  625,    0,    0,    0,  571,    0,
+	      68, 1632,    0,    0,    0,    0, 1693, 1305,
+	       0,    0,    0, 1550,  232,   22, 1443,    0,
+	       0, 1135,  915,  678,  705,  687,    0,    0,
+	       0,    0,  653,    0,    0,  530,    0, 1740,
+	    1293, 1154,    0,    0,    0, 1977, 1712, 1145,
+	    1351,    0,    0,    0,  689,   31,    0,    0,
+	       0,  493,    0, 1999, 1598,    0, 1354,    0,
+	     668, 1405, 1356,   51,  594,  223,    0, 1428,
+	    1921,    0, 1987,    0,    0,    0, 1902,    0,
+	       0,    0,    0,    0,    0,    0,  198,    0,
+	       0,    0, 1966,  725, 1706, 1164,    0,    0,
+	       0, 1975,    0,  505,    0,    0,    0,    0,
+	    1360,  242,  308,    0,    0,    0, 1496,   24,
+	    1006,    0,    0,  879,  632,  835, 1395,  398,
+	    1118, 1350,    0,  676, 1374,  125, 1050,    0,
+	       0,  567, 1416, 1388,  473,    0,    0,    0,
+	    1414, 1342, 1753,    0,    0,    0,   50,  501,
+	    1884,    0,    0,    0,    0,  245,  273,    0,
+	       0,    0,    0,    0,    0, 1708, 1191,  417,
+	       0, 1945, 1635, 1346,  358,    0,    0,    0,
+	       0, 1578, 1176, 1852,    0,    0,  441,    0,
+	     817,    0,    0,    0,    0,  861, 1621,  347,
+	     534,    0,  100,    0, 1726,  989, 1005,    0,
+	     227, 1501, 1686,    0, 1212,    0,    0,    0,
+	    1089, 1875,  588, 1877, 1273,    0,    0, 1805,
+	     265,  158,    0, 1161,    0,    0,  290, 1118,
+	    1888, 1596,  337,    0,    0, 1603,  666,    0,
+	     789,    0, 1506,  607,    0, 1900,    0,    0,
+	       0,   89,  547, 1936, 1177,    0,    0,  967,
+	     328, 1341,    0,    0,    0,    0, 1831,    0,
+	     165, 1948,    0,    0,    0,    0,  472,    0,
+	       0,    0,    0,  305,  130,   85,    0,    0,
+	    1108,    0, 1914,    0, 1784,    0,  752, 1552,
+	    1899, 1836, 1548,    0,  537,    0, 1706,  858,
+	    1382,  826,    0,    0,    0, 1904,  614,    0,
+	       0,    0,    0,  259,  670,  170,    0,    0,
+	       0,    0, 1101,  627,    0,  153,    0, 1943,
+	     246, 1394, 1531,    0,    0,    0,    0,    8,
+	       0,  977,  979,  452,    0,    0, 1310, 1592,
+	       0,    0,    0,  409,  560,    0, 1682,    0,
+	       0,    0, 1187, 1172,    0, 1934,    0,    0,
+	       0,    0,  689,  440,    0,    0,    0,  293,
+	       0,    0, 1866,    0,    0,    0, 1551,    0,
+	       0,    0,    0,  642,  225,  502,  169,    0,
+	       0, 1304, 1746, 1725, 1986, 1967,  492,    0,
+	     378,  819,  303,  439, 1308, 1748,    0,    0,
+	    1549, 1242, 1835,    0, 1237,    0, 1604, 1704,
+	    1652,    0,    0, 1007, 1154,  774,  137,  669,
+	       0,  424,    0,  174, 1992,    0,    0,    0,
+	       0,  930,    0,  750, 1958,    0,    0,    0,
+	    1560,    0, 1124,  884,    0,    0,    0,  800,
+	     310,    0,    0,    0,  783, 1580,    0,  439,
+	       0,    0,    0,    0, 1957,    0,  467,    0,
+	       0,  443,    0, 1984, 1113,    0,    0,    0,
+	    1093, 1062, 1249, 1984,    0,    0, 1093, 1377,
+	     417,    0,    0,    0,    0,  100,  563,   96,
+	       0,    0, 1710,  142,  597, 1276,  580,    0,
+	    1944,    0,   93, 1219,  796,    0, 1314,    0,
+	       0, 1020,    0,  125,    0,    0, 1525, 1932,
+	    1734,  172,    0,    0,    0, 1101,    0,  965,
+	     563,    0,    0,    0, 1932,  944,    0, 1130,
+	       0,    0,  236,    0, 1412, 1267,    0,    0,
+	       0,    0,  285, 1704, 1466,    0, 1428,  314,
+	    1294, 1593,    0,    0, 1789,  288,  544,  176,
+	     940,    0,    0,  917,    0,  989,  366,    0,
+	       0,    0,    0,  213,  957, 1088,    0,    0,
+	       0, 1260,   12, 1831, 1971, 1804, 1384, 1692,
+	     449,  510,  258,    0, 1175,    0,  809,  269,
+	     395,  762,    0,    0,    0,  767,  497, 1383,
+	       0,    0,    0, 1957, 1574, 1299,    0,    0,
+	       0,    0,  592,    0, 1703,    0,    0,    0,
+	    1259,    0, 1677,    0,    0,    0,    0,    0,
+	    1459,  769,    0,    0,    0,    0,  968,  955,
+	       0,    0,    0, 1053,    1,    0,  110,    0,
+	       0,    0, 1887,    0, 1408, 1743,    0,  322,
+	       0,  798, 1990,    0,    0,    0,    0, 1717,
+	    1689,  906, 1529,  243,    0,    0, 1366,  348,
+	       0,    0,    0, 1146,  999,  786,    0,    0,
+	       0, 1972,    0, 1213,    0, 1694,  622, 1535,
+	    1810,  248, 1568,  507,  807,    0,    0, 1203,
+	    1233,    0,  995,    0,    0,    0, 1794,    0,
+	       0,    0,    0,    0,  641,  838, 1509, 1722,
+	       0,    0,    0,    0, 1643,  683,  541,    0,
+	    1063, 1583, 1436,    0,    0,    0,    0,    0,
+	       0, 1390,  381,    0,    0,  278,    0, 1615,
+	    1447,    0, 1738,    0,  775, 1267,   93,  118,
+	       0,  218,    0, 1474,  449, 1715,  151,  391,
+	       0,    0,  252, 1546,    0,    0,    0,    0,
+	     436,  554,  565,    0,    0,    0, 1585,  328,
+	     899,    0,    0,    0,    0, 1374,  640, 1676,
+	    1072,    0,    0,    0, 1885, 1815, 1305,    0,
+	       0,    0,    0,    0,  622,  637,    0,    0,
+	       0,  349, 1830,    0,    0,    0,  581,   56,
+	    1669, 1601,    0,    0,    0, 1409, 1077,  997,
+	    1755,    0, 1890,    0,  696,  581, 1067,    0,
+	       0,    0,   23,    0, 1051,    0,    0,    0,
+	       0,    0, 1934, 1288, 1240,    0,  887, 1151,
+	     746,  879,    0,  735,    0,    0, 1894, 1259,
+	    1700, 1064,  237,    0,    0, 1038,  265,  680,
+	       0,    0, 1199, 1012,    0, 1857,    0, 1633,
+	       0,  223, 1516,  260,  891,    0,    0,  298,
+	       0,  779,    0, 1940,    0,    0, 1457, 1788,
+	       0, 1739,    0,    0,    0,  776,  400,    0,
+	       0,    0,  635,  911,  933, 1002,    0,    0,
+	       0,  552, 1349,  101, 1155,    0,  630, 1929,
+	    1183,  499, 1004,    0, 1138,    0,    0,    0,
+	     186, 1045,    0,    0,    0,    0, 1217, 1294,
+	       0,    0,    0, 1227,  854,  767, 1085,    0,
+	       0,    0, 1606,  801,    0,   66,    0,    0,
+	     721,  552, 1342,    0,    0,    0,    0,  159,
+	     477,  991, 1225, 1850,    0,    0, 1332,    0,
+	    1681, 1148,    0,    0, 1433,    0,  714,    0,
+	       0,    0,    0, 1070,    0, 1201,    0,    0,
+	     927,    0,  453, 1743,    0,    0,    0,   72,
+	    1453, 1555, 1129,    0,    0,    0,  932, 1728,
+	       0,    0,    0,    0, 1131, 1688,  339,    0,
+	       0,    0, 1281, 1049, 1380, 1811, 1338,  687,
+	       0, 1558, 1567, 1073,    0,  187,  901,    0,
+	     931,  293,  174,    0,    0, 1126,  468, 1545,
+	     356,    0,    0, 1634, 1472, 1427,  470, 1852,
+	    1611,    0,    0, 1735, 1750,    0,  772,    0,
+	       0,   84,    0,   55,  753,    0,    0,    0,
+	     570,  726,  247,  939,    0,    0,  612,    0,
+	    1203,    0,    0,    0, 1849, 1843, 1754,  755,
+	       0,    0,    0,    0, 1462, 1272,  755,    0,
+	       0,  204,  450,   26,   81,    0,    0,    0,
+	       0, 1768,  250, 1035,    0,    0,   50,  480,
+	     331,  115,    0,    0,    0,  215, 1767, 1144,
+	     727,    0,  836, 1321, 1351, 1633,   38,    0,
+	    1206,    0, 1171, 1245,  573,  990,    0,    0,
+	       0, 1320, 1861, 1182,    0,    0,    0,  196,
+	       0, 1619,    0,    0,    0,    0,    0,  982,
+	     788,    0,    0,    0,    0, 1384, 1777, 1409,
+	       0,    0,    0, 1099,    0,    0,    0,    0,
+	       0, 1605, 1735,  576, 1192,    0, 1488,  947,
+	      11,   76,    0,    0,  610,    0,  133, 1848,
+	     343,    0, 1530,    0,    0, 1492,  931,    0,
+	       0,    0, 1316,    0, 1680, 1376,  969,    0,
+	       0, 1488,  538,  960,  932,    0,    0, 1093,
+	      66, 1179,    0,  438, 1613,    0, 1379, 1954,
+	    1087, 1487,  651,    0,    0, 1340, 1619,    0,
+	       0,    0,    0, 1905,  617, 1759,  154,    0,
+	       0,    0,  232, 1271, 1021,  763,    0,    0,
+	    1694,  115,    0,    0,    0,    0,    0,  307,
+	     659,  433,    0,    0,    0,  633,  160,  445,
+	       0,    0,    0,  617, 1528, 1213, 1008,    0,
+	    1905,    0,  180,    0,  499,  543,    0,    0,
+	       0, 1842,  751,  952,    0, 1104,    0,  510,
+	    1086,  380,   52,    0,    0,    0, 1892, 1168,
+	     781,    0,    0,    0,  450, 1030, 1023,    0,
+	       0,    0,    0, 1325, 1714,  576, 1819, 1947,
+	       0, 1897,   49, 1960,  535,  781,    0,    0,
+	     517,    0,  244,    0,    0,  147,  712,    7,
+	     259,    0,    0,    0,  346,  503,  878, 1847,
+	       0,    0,   35, 1323, 1827, 1528, 1920,    0,
+	       0, 1412, 1580, 1730,    0,    0,  954,    0,
+	       0,  355,  996,    0,    0, 1690,  930,  109,
+	    1426, 1235,    0,    0, 1376,  730,  965,  546,
+	     574,    0, 1153,    0, 1927,  993,    0,  888,
+	       0, 1920,  841, 1800, 1004,  729,    0,    0,
+	    1292,  910,    0, 1355,    0,    0,  211,  123,
+	    1374,    0,    0,    0,    0,    0,  354,    0,
+	      22,    0,    0,    0, 1284,  268, 1882,    0,
+	       0,    0,  963,    0, 1760, 1091,    0,    0,
+	       0, 1790,  883,    0,    0,    0, 1070, 1390,
+	       0, 1760,    0,    0,    0,    0,    0, 1922,
+	    1289,    0,    0, 1226,    0,  524, 1721,    0,
+	       0,    0,  682,  155,  290, 1658,  656,    0,
+	       0,    0,  831,  612, 1326,    0,    0,    0,
+	     286,  220,    0,    0, 1487,    0,  614, 1923,
+	    1507, 1120,    0,    0,    0, 1480,  387, 1024,
+	       0,    0,    0, 1675,    0,  133,    0,    0,
+	       0,    0,  458,    0, 1164,    0,    0, 1043,
+	    1287,  951,  114,  296,    0,    0,    0, 1172,
+	       0,    0,    0,    0,    0,  126,    0,    0,
+	       0,    0,    0, 1771, 1679,  813,    0,    0,
+	       0,    0,   36, 1011, 1117, 1288,  305, 1491,
+	     724, 1799, 1804,    0,    0, 1428,    0, 1910,
+	     815,  277,  170,    0,    0,    0, 1512, 1446,
+	       0,    0,    0, 1000,  790,  363,  871,    0,
+	       0,    0, 1725,  313,    0,    0,    0,    0,
+	    1882, 1695,  562,    0,    0, 1480,    0,  564,
+	     466, 1547, 1657,  728,    0,    0,    0, 1515,
+	     973,    0,    0,    0,  924,   57,  668,    0,
+	       0,    0,    0,  657,    0,  268,    0,    0,
+	    1519,    0, 1244,  883,    0,    0, 1019,    0,
+	    1542, 1426, 1795,    0,    0,    0,    0, 1425,
+	    1662,    0,    0,    0,  407, 1697, 1765,  278,
+	       0, 1355,  686,  280, 1807, 1718,  546,  841,
+	    1996,  953,  488,  526,    0,  883,    0,    0,
+	    1953,  943,  309,  198,  701,    0,    0,  438,
+	    1594,    0,    0, 1953,    0,  498,  704,  558,
+	       0,    0,    0,    0,  881,  814,    0,    0,
+	       0, 1097, 1291,  318, 1103,    0,    0,    0,
+	    1005,    0,  572, 1902,    0,    0,    0,    0,
+	       0,    0,    0,    0,    0, 1281, 1399, 1656,
+	       0,    0, 1437,    0, 1836,    0,  768,    0,
+	       0,    0,    0,  829,  886,    0,    0,    0,
+	      13,  849, 1821,  653,    0,    0,    0, 1479,
+	    1136,  962,    0,    0,    0,    0,  684,  993,
+	    1426, 1351,    0,    0,  857, 1452,  551,    0,
+	       0,    0,  848,  760, 1475, 1616,    0,    0,
+	       0,  801,  434,    0,  580,    0,    0,  914,
+	     464, 1199,    0,    0,    0,    0,    0,    0,
+	     977,    0,    0,    0,    0, 1069, 1672,    0,
+	       0,    0,  998,  816,  624,  972,    0,    0,
+	       0,    0,  834,  858, 1311,    0,    0,    0,
+	     226, 1205,  401,    0,    0,    0, 1345, 1584,
+	     622,  404,  764, 1312,  201, 1270, 1214,    0,
+	       0,    0,    0,    0,  110, 1942,  894,    0,
+	    1475,    0, 1102, 1473, 1082,    0,    0,    0,
+	     184,   54,  506, 1135,    0,    0,    0,  664,
+	    1619,    0,    0,    0,    0,    0, 1648,  334,
+	    1068,    0,    0, 1481,    0, 1316, 1128,    0,
+	       0,    0,  326,  489,    0,  958,    0,    0,
+	      88, 1195,    0,    0,    0,    0,    0,    0,
+	    1903,  174,    0,    0,    0,    0, 1158, 1737,
+	       0,    0,    0,    0, 1147, 1675, 1639,    0,
+	       0,    0,    0, 1157,  865,  134,   10,    0,
+	    1928,  570,  895,  691,    0,    0,    0,  677,
+	    1307,  103, 1029,    0, 1548,    0,    0,  605,
+	     280,    0,    0,    0,  839,  137,    0, 1644,
+	       0,    0,    0, 1238,    0, 1059,  128,    0,
+	       0,  191,  612, 1169,    0, 1602,    0,    0,
+	       0, 1345,  961,    0,    0,    0,    0,    0,
+	    1121,    0,    0,    0, 1039,  996, 1529,  111,
+	       0,    0, 1967,    0,    0, 1314, 1809,    0,
+	     863, 1439,  460, 1701,   96,    0,    0,    0,
+	     427,  631, 1147, 1771,    0,    0,    0, 1803,
+	    1079,    0,    0,    0, 1413,  367, 1833,  346,
+	    1925, 1721,    0,    0,  589,  943,    0, 1390,
+	    1577,    0, 1141, 1200,    0,    0,    0,    0,
+	       0, 1662,   90, 1066,    0,    0,    0,  410,
+	     117, 1244,    0,    0,    0,  254,  513,  765,
+	    1639,    0,    0,    0,  583,    0,  511,    0,
+	       0,    0,    0,  650,   44,    0,    0,    0,
+	       0,    0,  734, 1013,  886,    0, 1962, 1273,
+	    1665,    0,    0,    0,    0,    0, 1715, 1896,
+	    1241,    0,    0,    0,    0, 1852, 1099,    0,
+	     796,    0, 1418, 1131,  700, 1721,    0,    0,
+	       0, 1196,   40,  123,  749,    0,    0,  464,
+	    1489,  853,    0,    0,    0,  523, 1462, 1110,
+	     474,  440,    0,    0,    0, 1668,  604, 1709,
+	       0,    0,    0, 1064,  602,    0, 1761,    0,
+	       0,    0,    0, 1065,  415,    0,    0, 1795,
+	    1822, 1781,  978,    0,    0,    0,    0,    0,
+	    1626,  823,    0,    0,  828,    0, 1561, 1997,
+	       0,    0,    0,    0, 1536,   63,  577,    0,
+	       0,    0,  485, 1702,  744,  867,  573,  540,
+	    1650,  295,  611,    0, 1926, 1132,    0,  139,
+	     856, 1040,    0, 1379,    0,    0, 1658, 1929,
+	       0,    0,    0,    0, 1699, 1373,  607,    0,
+	       0,    0,    0, 1268,  347, 1499,    0,    0,
+	     398,  181,   81,    0,   84,    0,    0, 1076,
+	       0, 1252, 1394,  674,    0,    0,  262,    0,
+	       0,    0,    0,    0, 1471,  925, 1186,    0,
+	       0,    0,    0,    0,    0, 1180,  347,    0,
+	       0,  554,    9, 1254,    0,    0,    0,    0,
+	     947, 1961,  747,    0,    0,    0,    0,  625,
+	     721,    0,    0,    0, 1877,    5,   86,   80,
+	       0,    0,    0, 1105, 1069,  312, 1352, 1770,
+	       0,  708, 1306, 1517,  178,    0,  904,    0,
+	    1854, 1140,    0,    0,    0,    0,    0,  773,
+	     632, 1941,    0,    0,    0,  119,  370,  255,
+	       0,    0,    0,    0,  360, 1554,  369,    0,
+	       0, 1806, 1851, 1858,  385,    0,    0,    0,
+	       0,  166, 1460,  690,    0,    0,  945,    0,
+	       0,  300,    0,    0,    8,  291, 1834, 1927,
+	    1350,    0, 1745, 1791,  583, 1484, 1188,    0,
+	     240,    0, 1625,  802, 1693,    0,    0,    0,
+	       0, 1476, 1236,  598,    0,    0,    0, 1041,
+	      73,  208,    0,    0,    0,    0, 1498, 1375,
+	     452, 1399,    0,  235,    0, 1395, 1250, 1269,
+	       0,    0, 1058,  859, 1246, 1889,    0,    0,
+	       0, 1235, 1653,  722, 1864,    0,    0,  775,
+	    1399,    0,    0,    0,    0,    0,    0,  950,
+	       3,    0,    0,    0,    0,   12, 1756,    0,
+	       0,    0,    0,  722,  636,  625,    0,    0,
+	       0,    0,  272, 1298,   77,    0,    0,    0,
+	    1950, 1099,  597,    0,    0,    0, 1503, 1515,
+	    1531, 1037,    0,    0,  822, 1287,  739,    0,
+	       0, 1445,  193,  164,  333, 1775, 1510,    0,
+	       0,    0, 1711,  522, 1534,  840,    0,    0,
+	     723,   12,  672,  461, 1118,    0,    0,    0,
+	    1956,   92,    0,    0,    0,    0,    0,    0,
+	       0,    0,    0,  712, 1465,  921, 1742,    0,
+	       0,    0,  310,  202,  372, 1749,    0,    0,
+	    1189, 1807,  965,  784,    0,    0,    0,  940,
+	     620,  199,  128, 1687,    0,    0, 1077, 1670,
+	       0,    0,    0,    0,    0,  677, 1556,    0,
+	    1447, 1756, 1517,  658,  971, 1279,    0,  957,
+	       0, 1462,  392, 1994,    0,    0,    0,    0,
+	     229, 1620, 1092,    0,    0,    0,    0, 1858,
+	      38,    0,    0,    0,  920,  478, 1178, 1868,
+	       0,    0,    0, 1804, 1721,  896,    0,    0,
+	       0,   42, 1733,  361,    0,  187,    0,    0,
+	    1409, 1595,  369,    0,    0,    0,    0, 1575,
+	       0,    0,    0,    0,    0, 1088, 1854, 1431,
+	       0,    0,    0, 1982,    0,  241,  267,    0,
+	       0,  525, 1657, 1331,   59,    0,  648,    0,
+	    1720,  909, 1613, 1210,    0,    0,  186,  186,
+	    1876,    0,    0,    0, 1061, 1061, 1039,  938,
+	    1646, 1237,    0,    0, 1025, 1035,    0, 1931,
+	       0,    0, 1093, 1429, 1325, 1867,    0,    0,
+	       0, 1460, 1910,    0,    0,    0,    0,  379,
+	     949,  637,    0,    0,    0, 1482,    0, 1778,
+	    1780,    0,    0,    0,    0, 1309, 1095,    0,
+	       0,    0, 1232,   47,    0,  606,    0,    0,
+	       0,  950,  677,  738,  435,    0,    0,  850,
+	     628,  833,    0,    0,    0,    0, 1303, 1876,
+	     222,    0,    0,    0,    0, 1207, 1452, 1968,
+	       0,    0,    0,  683, 1624, 1615,    0,    0,
+	       0,    0, 1286, 1090,    0,    0,    0,   62,
+	     840,  494, 1120,    0,    0,  590, 1066,  808,
+	       0, 1327,    0,    0,    0,  368,  858,    0,
+	     889,    0,    0,  556,  235,    0,    0,    0,
+	       0,    0,    0,    0,    0, 1804,    0,    0,
+	    1299,  691, 1474,    0,    0,    0, 1521,    0,
+	    1163,  519,    0,    0,    0,    0,  160,  431,
+	       0,    0,    0,  920,  650, 1071, 1666,    0,
+	       0, 1539,  621,  540, 1493,  584,    0,  838,
+	     542, 1925,  371,    0,    0,    0, 1507,  220,
+	     274,  231, 1195, 1605,    0,    0, 1392,   59,
+	     824,    0, 1221,    0, 1211, 1907, 1873,    0,
+	       0,    0,    0, 1156,  841, 1274,    0,    0,
+	    1502,  575,  955,    0,  267,    0,    0,    0,
+	     725,  599,    0,    0,    0,    0, 1228,  451,
+	     387,    0,    0,    0,    0,  234,  410, 1989,
+	       0,    0,    0,   23, 1833, 1033, 1708,    0,
+	       0,    0,  360,  380,    0,    0,    0,    0,
+	    1229, 1303, 1504,    0,    0,    0,    0, 1216,
+	    1442,    0,    0,    0,    0, 1334,  526,  221,
+	       0,    0,    0,    0,  657, 1874, 1557,    0,
+	       0, 1396,  922,    0,  512,    0,    0,    0,
+	     627,    0, 1946, 1657,    0,    0,    0, 1216,
+	       0, 1127,    0,    0,    0, 1859, 1012,  795,
+	       0,    0,    0,    0, 1813,  224,   64,    0,
+	       0,    0,  935,  662,    0,    0,    0,    0,
+	       0,    0, 1747,  433,    0,    0,    0, 1973,
+	       0, 1796,    0,    0, 1274,    0,    0, 1801,
+	     566,    0,    0,    0, 1249,    0, 1842,    0,
+	    1154,    0,  780, 1888, 1773,  537,    0,    0,
+	     388, 1533,   27,    0,  264,    0,    0,   22,
+	     176,    0,    0, 1976,  556,    0, 1751, 1520,
+	    1747,    0,    0,    0,    0, 1170,    0,    0,
+	       0,    0,  675, 1477,    0,    0,    0,    0,
+	       0,    0,  765, 1637,  490,    0,    0, 1598,
+	       8, 1270,  874,    0,    0,    0,  592,    0,
+	    1966,  867,    0,    0,    0,  484,    0,    0,
+	       0,    0,    0,    0,  201, 1919,    0,    0,
+	       0,    0, 1285, 1723,  512,    0,    0,    0,
+	       0, 1727, 1867,    0,    0,    0,    0,  688,
+	     188,  633,    0,    0,    0,    0, 1001,  894,
+	       0,  113,    0,  239, 1937, 1725, 1990,    0,
+	       0,    0, 1124,  383, 1104, 1525,    0,    0,
+	      25,  179,    0,    0,    0,    0,    0,  301,
+	     942,    0,    0,    0,    0,    0, 1816, 1186,
+	       0,    0,    0,    0,    0, 1714,    0,    0,
+	       0,    0,    0,    0,  497,  383,    0,    0,
+	       0,    0, 1521, 1080,    0,    0, 1333, 1044,
+	     299, 1532, 1752,    0,    0, 1099,    0, 1368,
+	       0,  513,    0,    0, 1104, 1923,  596, 1140,
+	       0,    0,    0, 1293,  743, 1277,  851,  351,
+	       0, 1003, 1957,  278,    0,    0,    0,    0,
+	     269, 1832,    0,    0,    0,    0,    0,    0,
+	     500,    0,    0,    0, 1673,  514, 1817,    0,
+	       0,    0,    0,    0,    0, 1455,  327,    0,
+	       0,  803,  858,    0, 1774,    0,    0,    0,
+	       0, 1772,  149, 1629,    0,    0,    0,  862,
+	     706,    0,    0,    0,    0,  352,    0, 1651,
+	       0,    0,    0,    0,    0, 1397,  266,    0,
+	    1253,    0,  797, 1159,  778,    0,    0,    0,
+	       0,  103, 1724,  189,    0,    0,    0,  374,
+	    1527,  702,    0,    0,    0,  694, 1830,  545,
+	     549, 1094,    0,    0,  655,    0,  761,    0,
+	    1283,    0, 1960, 1379,    0,    0, 1847,    0,
+	       0, 1783,  357,  975,  739,    0,    0,  238,
+	    1419, 1729,    0,    0,    0,    0,    0,  587,
+	       0,    0,    0,   30,    0, 1636, 1974,    0,
+	       0,    0, 1990,  688,  553, 1370,    0,    0,
+	       0,  373,  186, 1398,  661,    0,    0, 1788,
+	       0,  863,    0,    0, 1554,    0, 1137, 1909,
+	     389,  708,    0,    0,    0, 1406, 1687,  822,
+	    1454,    0,    0, 1078,  927, 1978,    0,    0,
+	       0,    0, 1596, 1553,    0,    0,    0, 1508,
+	     313, 1856, 1109,    0,    0,    0,    0, 1052,
+	     233,    0,    0,    0,    0,    0,    0,  945,
+	       0,    0,    0,  866,    0,  783, 1353,    0,
+	       0,    0, 1997, 1851, 1251,  669,    0,    0,
+	    1439,    0,    0,    0,    0,    0,    0, 1924,
+	     289, 1571,    0,    0,    0,    0,  898,  723,
+	       0,    0,    0,    0,  386, 1122, 1090,    0,
+	       0,    0,    0, 1386, 1837, 1380,    0,    0,
+	    1838,  451,  463,  343, 1193,    0, 1513, 1954,
+	       0, 1264, 1705,  448,    0,    0,  578, 1084,
+	       0,    0,    0,    0, 1581, 1136,    0,    0,
+	       0,    0,    0, 1963, 1651,  889, 1027,    0,
+	       0, 1981, 1036,  877,    0,    0,    0,    0,
+	       0,    0,  103,    0,    0,    0,    0,  426,
+	    1233,    0,    0,    0, 1184,    0,   88, 1037,
+	       0,    0,    0,  727,  638,  396,  644, 1740,
+	    1448,  892,    0,  588,  922,    0,    0,    0,
+	    1627, 1389, 1949,  447,    0,    0,    0,  441,
+	    1426,    0,    0,    0,    0,  327,   58,  531,
+	       0,    0,    0,    0, 1858,  591,  876,    0,
+	       0,  524,  382,    0,  385,    0, 1185,    0,
+	       0, 1765, 1679, 1917,    0,    0,    0,   91,
+	     144, 1390,    0,    0,    0,  862,    0,  482,
+	    1397,    0,    0,    0, 1190, 1234,  986,    0,
+	       0,    0, 1758, 1716, 1623,    0,    0,    0,
+	       0,  689,  491, 1738,    0,    0,    0,    0,
+	     517,  243,    0,    0,    0,    0, 1770,  475,
+	    1523,    0, 1840,    0, 1373, 1729,  606,    0,
+	       0,    0, 1975, 1582,  864, 1441,    0,  856,
+	       0, 1058, 1991,    0, 1232,    0,    0, 1350,
+	     939,  341,    0,    0,    0,    0,    2, 1231,
+	       0, 1440, 1628,    0,    0,  758, 1505,    0,
+	     645,    0,    0,  437,    0,  276,    0,    0,
+	       0,    0, 1262,    0,  302,    0,    0,  423,
+	       0, 1083,  306,    0,    0,    0,  650,    0,
+	    1894,  738,    0,    0,    0,  459, 1235,    0,
+	       0,    0,    0,  946, 1464, 1115,  885,    0,
+	       0,    0,  528,  486, 1235,  990, 1536,    0,
+	       0, 1807,  720,    0,    0,    0,    0, 1866,
+	    1451,  860,    0,  349,    0,    0, 1011, 1564,
+	       0,    0,    0,  425,  929, 1089,  539,    0,
+	       0,    0,    0, 1818, 1044,  529,    0,    0,
+	    1297,  185,    0,    0,    0,    0,    0, 1372,
+	    1007, 1959, 1311,    0,    0,    0,  235,    0,
+	       0,    0,    0,    0, 1430,  956,    0,    0,
+	       0,    0, 1402,    0,    0,  496,    0,    0,
+	     420, 1387, 1000, 1823,    0,    0,    0, 1209,
+	    1098, 1524, 1630,    0, 1231,    0, 1401, 1797,
+	     131, 1938,    0,    0, 1981,  456,  548, 1691,
+	       0,    0,    0, 1100,  276, 1961,   30,    0,
+	    1792, 1107, 1076, 1901,    0,    0,    0,    0,
+	     375,  296,  557, 1318,    0,    0,    0,  871,
+	    1906,    0,    0,    0,    0,   61, 1952,    0,
+	       0,    0,    0,    0,  623, 1952, 1209,    0,
+	       0,  390, 1498,  124, 1149,    0,    0,    0,
+	    1160, 1423, 1717,  908,    0,    0,    0, 1479,
+	    1913,    0,    0,    0,    0, 1544,  656, 1060,
+	    1483,    0,    0,  384,  764, 1695,  107,    0,
+	       0,    0,  145,  317, 1880,    0,    0,    0,
+	       0,  104, 1163,  870,    0,    0,    0, 1222,
+	     329, 1581,    0,    0,    0,  253, 1348,    0,
+	    1031,    0,    0,    0,    0, 1865,  808,    0,
+	     889,    0, 1252, 1278, 1995,  688, 1466,    0,
+	       0, 1208,    0, 1705,  514,    0,    0, 1786,
+	    1819,    0,    0,    0,    0,    0,  915, 1815,
+	     471,    0,    0,    0, 1371, 1853,  427,    0,
+	       0,    0,    0,  898,    0,  212,    0,    0,
+	       0,    0, 1456,  966,  364,    0,  703, 1486,
+	     921, 1680,  695,    0,  948,    0,  925, 1352,
+	     456, 1610,    0,  148,    0,  759,  897,    0,
+	       0,    0,    0,  665, 1579,    0,    0,    0,
+	       0,    0, 1912,    0, 1469,  681,    0,    0,
+	    1296, 1445, 1841,    0,    0,    0,    0, 1351,
+	       0,    0,    0,    0,    0,    0, 1572,   33,
+	       0,    0,    0,  685,  344,   15, 1081,    0,
+	       0,  582, 1134,  560, 1563, 1420,    0,  791,
+	    1261,    0,  964,    0,    0,    0,    0,  980,
+	     464,  992,  613,    0,    0,    0, 1464,  350,
+	       0,    0,    0,    0,  807,  194, 1634,    0,
+	       0,    0,    0,   53,  102,    0,    0,    0,
+	     403, 1597,  730, 1745,    0,    0, 1132,    0,
+	     151, 1497,    0,  479,    0,    0,    0, 1827,
+	     634,  914,    0,    0,  430, 1959, 1166,   84,
+	       0,    0,    0,  409, 1480, 1450,  207,    0,
+	       0,    0,    0, 1982,    0,    0,    0,  359,
+	    1287,    0,    0,    0,    0,    0,    0,    0,
+	     122,    0,    0,    0,    0,    0, 1985,  748,
+	       0,    0,    0,    0,  733, 1776,   94,    0,
+	       0, 1665, 1119,  793,  318,    0,  818,    0,
+	     371, 1247,  217,   73,    0,    0,    0, 1332,
+	    1495,    0,    0,    0,    0, 1167,   79,  789,
+	       0,
+};
+
+uint16_t
+inthash(const int32_t key)
+{
+	uint16_t result;
+	const uint16_t *g = inthash_g;
+	uint16_t h[2];
+
+	_inthash2(key, (uint32_t*)h);
+
+	h[0] = h[0] % 4001;
+	h[1] = h[1] % 4001;
+	result = (g[h[0]] + g[h[1]]) % 2000;
+	return (inthash_keys[result] == key) ? result : (uint16_t)-1;
+}
+
+void
+inthash_prefetch(const int32_t key)
+{
+	uint16_t h[2];
+
+	_inthash2(key, (uint32_t*)h);
+
+	h[0] = h[0] % 4001;
+	h[1] = h[1] % 4001;
+	__builtin_prefetch(&inthash_g[h[0]]);
+	__builtin_prefetch(&inthash_g[h[1]]);
+}
+
+void
+inthash_batch(const int32_t *keys, uint32_t *out, size_t n)
+{
+	const uint16_t *g = inthash_g;
+	uint16_t hb[8][2];
+
+	for (size_t s = 0; s < n; s += 8) {
+		const size_t nb = n - s < 8 ? n - s : 8;
+		for (size_t j = 0; j < nb; j++) {
+			const int32_t key = keys[s + j];
+			uint16_t h[2];
+
+			_inthash2(key, (uint32_t*)h);
+
+			h[0] = h[0] % 4001;
+			h[1] = h[1] % 4001;
+			hb[j][0] = h[0];
+			__builtin_prefetch(&g[h[0]]);
+			hb[j][1] = h[1];
+			__builtin_prefetch(&g[h[1]]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint16_t *h = hb[j];
+			uint16_t result = (g[h[0]] + g[h[1]]) % 2000;
+			out[s + j] = (inthash_keys[result] == keys[s + j]) ? result : (uint32_t)-1;
+		}
+	}
+}
+
+#if defined NBPERF_DISPATCH || defined __AVX512F__
+#ifdef NBPERF_DISPATCH
+__attribute__((target("avx512f")))
+#endif
+static size_t
+inthash_x8_avx512(const int32_t *keys, uint32_t *out, size_t n)
+{
+	size_t i = 0;
+	const __m512i mul = _mm512_set1_epi32((int)UINT32_C(0x56c372d0));
+	const __m512i add = _mm512_set1_epi32((int)UINT32_C(846930886));
+	const __m512i lo16 = _mm512_set1_epi32(0xffff);
+	const __m512i m = _mm512_set1_epi32((int)(UINT32_C(0xFFFFFFFF) / 4001 + 1));
+	const __m512i v = _mm512_set1_epi32(4001);
+	const __m512i e = _mm512_set1_epi32(2000);
+	const __m512i gmask = _mm512_set1_epi32(0xffff);
+
+	for (; i + 16 <= n; i += 16) {
+		const __m512i k = _mm512_loadu_si512((const void *)(keys + i));
+		const __m512i h = _mm512_add_epi32(_mm512_mullo_epi32(k, mul), add);
+		__m512i h0 = _mm512_and_si512(h, lo16);
+		__m512i h1 = _mm512_srli_epi32(h, 16);
+		h0 = _mm512_mullo_epi32(h0, m);
+		h0 = _mm512_mask_blend_epi32(0xAAAA,
+		    _mm512_srli_epi64(_mm512_mul_epu32(h0, v), 32),
+		    _mm512_mul_epu32(_mm512_srli_epi64(h0, 32), v));
+		h1 = _mm512_mullo_epi32(h1, m);
+		h1 = _mm512_mask_blend_epi32(0xAAAA,
+		    _mm512_srli_epi64(_mm512_mul_epu32(h1, v), 32),
+		    _mm512_mul_epu32(_mm512_srli_epi64(h1, 32), v));
+		const __m512i g0 = _mm512_and_si512(gmask, _mm512_i32gather_epi32(h0, (const void *)inthash_g, 2));
+		const __m512i g1 = _mm512_and_si512(gmask, _mm512_i32gather_epi32(h1, (const void *)inthash_g, 2));
+		__m512i r = _mm512_add_epi32(g0, g1);
+		r = _mm512_mask_sub_epi32(r, _mm512_cmpge_epu32_mask(r, e), r, e);
+		const __m512i kk = _mm512_i32gather_epi32(r,
+		    (const void *)inthash_keys, 4);
+		r = _mm512_mask_mov_epi32(_mm512_set1_epi32(-1),
+		    _mm512_cmpeq_epi32_mask(kk, k), r);
+		_mm512_storeu_si512((void *)(out + i), r);
+	}
+	return i;
+}
+#endif
+
+#if defined NBPERF_DISPATCH || defined __AVX2__ && !defined __AVX512F__
+#ifdef NBPERF_DISPATCH
+__attribute__((target("avx2")))
+#endif
+static size_t
+inthash_x8_avx2(const int32_t *keys, uint32_t *out, size_t n)
+{
+	size_t i = 0;
+	const __m256i mul = _mm256_set1_epi32((int)UINT32_C(0x56c372d0));
+	const __m256i add = _mm256_set1_epi32((int)UINT32_C(846930886));
+	const __m256i lo16 = _mm256_set1_epi32(0xffff);
+	const __m256i m = _mm256_set1_epi32((int)(UINT32_C(0xFFFFFFFF) / 4001 + 1));
+	const __m256i v = _mm256_set1_epi32(4001);
+	const __m256i e = _mm256_set1_epi32(2000);
+	const __m256i gmask = _mm256_set1_epi32(0xffff);
+
+	for (; i + 8 <= n; i += 8) {
+		const __m256i k = _mm256_loadu_si256((const __m256i *)(keys + i));
+		const __m256i h = _mm256_add_epi32(_mm256_mullo_epi32(k, mul), add);
+		__m256i h0 = _mm256_and_si256(h, lo16);
+		__m256i h1 = _mm256_srli_epi32(h, 16);
+		h0 = _mm256_mullo_epi32(h0, m);
+		h0 = _mm256_blend_epi32(
+		    _mm256_srli_epi64(_mm256_mul_epu32(h0, v), 32),
+		    _mm256_mul_epu32(_mm256_srli_epi64(h0, 32), v), 0xAA);
+		h1 = _mm256_mullo_epi32(h1, m);
+		h1 = _mm256_blend_epi32(
+		    _mm256_srli_epi64(_mm256_mul_epu32(h1, v), 32),
+		    _mm256_mul_epu32(_mm256_srli_epi64(h1, 32), v), 0xAA);
+		const __m256i g0 = _mm256_and_si256(gmask, _mm256_i32gather_epi32((const int *)inthash_g, h0, 2));
+		const __m256i g1 = _mm256_and_si256(gmask, _mm256_i32gather_epi32((const int *)inthash_g, h1, 2));
+		__m256i r = _mm256_add_epi32(g0, g1);
+		r = _mm256_sub_epi32(r, _mm256_and_si256(_mm256_cmpgt_epi32(r,
+		    _mm256_sub_epi32(e, _mm256_set1_epi32(1))), e));
+		const __m256i kk = _mm256_i32gather_epi32(
+		    (const int *)inthash_keys, r, 4);
+		r = _mm256_or_si256(r, _mm256_xor_si256(_mm256_cmpeq_epi32(kk, k),
+		    _mm256_set1_epi32(-1)));
+		_mm256_storeu_si256((void *)(out + i), r);
+	}
+	return i;
+}
+#endif
+
+void
+inthash_x8(const int32_t *keys, uint32_t *out, size_t n)
+{
+	size_t i = 0;
+#if defined NBPERF_DISPATCH
+	if (__builtin_cpu_supports("avx512f"))
+		i = inthash_x8_avx512(keys, out, n);
+	else if (__builtin_cpu_supports("avx2"))
+		i = inthash_x8_avx2(keys, out, n);
+#elif defined __AVX512F__
+	i = inthash_x8_avx512(keys, out, n);
+#elif defined __AVX2__
+	i = inthash_x8_avx2(keys, out, n);
+#endif
+	for (; i < n; i++) {
+		const uint16_t r = inthash(keys[i]);
+		out[i] = r == (uint16_t)-1 ? (uint32_t)-1 : r;
+	}
+}
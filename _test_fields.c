@@ -0,0 +1,2558 @@
+/* generated with rurban/nbperf 08a5797  -B u64,u32 _pairs */
+/* seed[0]: 278722862, seed[1]: 233665123 */
+#include <stdint.h>
+
+static inline uint64_t _inthash64(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return x ^ (x >> 31);
+}
+
+#include <string.h>
+
+static inline uint64_t
+_fixed_le(const uint8_t *p, unsigned n)
+{
+	uint64_t v = 0;
+
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	memcpy(&v, p, n);
+#else
+	while (n--)
+		v = v << 8 | p[n];
+#endif
+	return v;
+}
+
+static inline void
+_fixedhash(const uint64_t a, const uint32_t b, uint64_t *h)
+{
+	uint64_t x = UINT64_C(0xded7263109cf92e);
+
+	x = _inthash64(x ^ a);
+	x = _inthash64(x ^ b);
+	h[0] = x;
+}
+
+#include <string.h>
+const uint8_t hash_keys[2000][12] = {
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x05, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x0d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x0d, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x07, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x0c, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x08, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x0b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x08, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x08, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x07, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x0d, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x0f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x0b, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x0f, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x07, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x09, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x0b, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x0d, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x08, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x05, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x0d, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x0b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x0f, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x0f, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x08, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x0e, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x08, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x0d, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x0d, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x0c, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x08, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x0c, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x08, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x05, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x0f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x0f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x0f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x0e, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x0d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x09, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x07, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x0d, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x0b, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x0d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x0f, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x0f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x0a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x0e, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x05, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x0e, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x0f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x0d, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x0a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x0a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x0c, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x0a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x0a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x0f, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x05, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x0d, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x08, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x0f, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x0f, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x0f, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x0f, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x09, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x07, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x0f, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x09, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x08, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x0e, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x0f, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x08, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x08, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x0a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x0d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x0b, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x09, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x0d, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x0d, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x09, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x0b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x0b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x0f, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x08, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x0d, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x09, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x0b, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x0c, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x08, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x0d, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x0b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x0f, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x0f, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x0f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x0d, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x05, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x08, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x76, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x0f, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x0d, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x0d, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x0a, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x0f, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x0d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x0c, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2e, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x0f, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x0a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x08, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x0c, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x05, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x0f, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x09, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x0b, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x0b, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x0d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4a, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x68, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x0e, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x09, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x12, 0x0b, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x42, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x0b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb6, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x08, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7a, 0x07, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x08, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x0d, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x05, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4e, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9a, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x0d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x0e, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x0f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x58, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xca, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x09, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa6, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x78, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x54, 0x0e, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x0b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x05, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfe, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x07, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xda, 0x09, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x56, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x0b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x34, 0x0f, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xa4, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x0f, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd4, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x36, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x32, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x66, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x05, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8e, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8c, 0x0d, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5e, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0e, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x98, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x2a, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd6, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x26, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5c, 0x0f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9e, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x74, 0x0e, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe2, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfa, 0x0b, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x82, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x72, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xe6, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd2, 0x07, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xac, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x18, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xec, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xea, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6c, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3a, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x64, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xb4, 0x0e, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf2, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1a, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x8a, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x94, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x86, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xd8, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xbc, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xae, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3e, 0x0a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xee, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x3c, 0x06, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x06, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x1c, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x46, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x88, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x0a, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xde, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x96, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x6a, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xf6, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xc6, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00 },
+	{ 0x05, 0x00, 0x00, 0x00, 0x5a, 0x07, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00 },
+};
+
+uint16_t
+hash(const uint64_t a, const uint32_t b)
+{
+	uint16_t result;
+	static const uint16_t g[4001] = {
+	    0x04ff, 0x02ad, 0x009a, 0x0772, 0x0000, 0x0000, 0x0780, 0x0357,
+	    0x0516, 0x0394, 0x0000, 0x0000, 0x0000, 0x0581, 0x01da, 0x04d7,
+	    0x0000, 0x0000, 0x0000, 0x06b5, 0x0000, 0x0000, 0x0000, 0x05c0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x07a8, 0x064f, 0x0000, 0x03da,
+	    0x052a, 0x053b, 0x0047, 0x0719, 0x0000, 0x0000, 0x0000, 0x0377,
+	    0x0000, 0x00c9, 0x0589, 0x0625, 0x0000, 0x0000, 0x0000, 0x016f,
+	    0x0000, 0x0000, 0x01c4, 0x0000, 0x0000, 0x029f, 0x0000, 0x006d,
+	    0x03c9, 0x05ba, 0x0000, 0x015a, 0x0299, 0x0000, 0x0799, 0x00e8,
+	    0x0000, 0x04a8, 0x046c, 0x0378, 0x0000, 0x0000, 0x0000, 0x0113,
+	    0x05f8, 0x0000, 0x02e5, 0x0000, 0x01c2, 0x0000, 0x0000, 0x0000,
+	    0x05db, 0x03dc, 0x0000, 0x05f9, 0x0000, 0x072a, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x06c0, 0x029c, 0x0481, 0x0000, 0x0439,
+	    0x0000, 0x07b7, 0x0507, 0x0000, 0x06f2, 0x0473, 0x0000, 0x0000,
+	    0x0000, 0x0094, 0x05ef, 0x063a, 0x01d3, 0x0000, 0x007c, 0x00c4,
+	    0x0301, 0x0000, 0x022a, 0x0000, 0x0000, 0x018a, 0x0000, 0x006e,
+	    0x02fb, 0x0000, 0x0000, 0x0000, 0x042d, 0x0000, 0x077e, 0x0000,
+	    0x0000, 0x0060, 0x0000, 0x0048, 0x0000, 0x02d0, 0x06d8, 0x0000,
+	    0x058a, 0x0000, 0x0000, 0x0000, 0x04d7, 0x0000, 0x0000, 0x0683,
+	    0x0000, 0x02b0, 0x06cd, 0x02f4, 0x0030, 0x0000, 0x071d, 0x0000,
+	    0x073c, 0x0000, 0x06e8, 0x02d5, 0x0724, 0x039f, 0x077f, 0x03d7,
+	    0x0574, 0x0778, 0x0000, 0x04a8, 0x0000, 0x0000, 0x00d4, 0x064c,
+	    0x0000, 0x0000, 0x06a4, 0x0457, 0x0000, 0x0000, 0x002f, 0x0000,
+	    0x02ed, 0x015e, 0x04d9, 0x0000, 0x0000, 0x00a3, 0x068a, 0x0000,
+	    0x0000, 0x06e5, 0x0000, 0x0000, 0x074b, 0x0000, 0x06af, 0x0000,
+	    0x0376, 0x0000, 0x0449, 0x0193, 0x0000, 0x0000, 0x0000, 0x0404,
+	    0x0460, 0x02c5, 0x0000, 0x0000, 0x014d, 0x0664, 0x074b, 0x028f,
+	    0x05dc, 0x0000, 0x046a, 0x00b4, 0x06e9, 0x0589, 0x008a, 0x075d,
+	    0x01ed, 0x0779, 0x0694, 0x0000, 0x06e0, 0x0000, 0x0000, 0x070f,
+	    0x05a6, 0x040c, 0x0000, 0x0000, 0x0000, 0x027d, 0x0000, 0x0000,
+	    0x0000, 0x06e7, 0x0000, 0x0202, 0x04aa, 0x042b, 0x0000, 0x0000,
+	    0x0328, 0x0000, 0x0197, 0x0488, 0x0193, 0x02e2, 0x0000, 0x0000,
+	    0x00be, 0x0000, 0x0000, 0x0000, 0x04fa, 0x03bc, 0x0694, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01b9, 0x0000, 0x0055, 0x0000, 0x0000,
+	    0x05c5, 0x03dc, 0x045d, 0x0000, 0x0000, 0x0000, 0x0539, 0x00ba,
+	    0x0000, 0x0000, 0x0000, 0x005c, 0x0000, 0x0000, 0x0256, 0x06d2,
+	    0x0000, 0x0058, 0x0000, 0x018e, 0x0000, 0x00ee, 0x0506, 0x01bf,
+	    0x007a, 0x01ea, 0x01a5, 0x056c, 0x0000, 0x0084, 0x05df, 0x02d1,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0491, 0x0333, 0x0000,
+	    0x0000, 0x0000, 0x071b, 0x06ba, 0x0540, 0x030b, 0x03a2, 0x0000,
+	    0x0103, 0x01b2, 0x00b0, 0x0000, 0x0000, 0x00ab, 0x05d2, 0x0000,
+	    0x0000, 0x0701, 0x0000, 0x0000, 0x06e7, 0x0354, 0x00e9, 0x0000,
+	    0x0423, 0x064d, 0x0375, 0x0458, 0x0000, 0x05c2, 0x03c6, 0x0000,
+	    0x0257, 0x0000, 0x0000, 0x06d4, 0x0000, 0x0000, 0x0026, 0x043b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05bb, 0x021c,
+	    0x0760, 0x06ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x004e, 0x0000, 0x0000, 0x0579, 0x0708, 0x01c6, 0x0282, 0x04b2,
+	    0x0000, 0x037a, 0x0000, 0x0299, 0x0643, 0x06d4, 0x02db, 0x0000,
+	    0x01a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0262, 0x0000, 0x0244,
+	    0x0736, 0x02da, 0x0000, 0x001a, 0x0202, 0x0797, 0x0744, 0x01f5,
+	    0x0280, 0x0000, 0x0540, 0x0000, 0x0407, 0x0000, 0x05b8, 0x0000,
+	    0x0000, 0x0000, 0x02d6, 0x0000, 0x03a4, 0x0000, 0x028d, 0x01ab,
+	    0x0000, 0x00da, 0x0008, 0x0062, 0x03fe, 0x0347, 0x04ac, 0x044e,
+	    0x0000, 0x0652, 0x0000, 0x007e, 0x0771, 0x0000, 0x0000, 0x0521,
+	    0x0000, 0x0000, 0x05a4, 0x0000, 0x06e9, 0x0000, 0x0000, 0x01f2,
+	    0x0013, 0x0000, 0x05e9, 0x0000, 0x0000, 0x0000, 0x04c4, 0x03dc,
+	    0x0000, 0x002e, 0x0580, 0x0000, 0x0000, 0x0000, 0x03ca, 0x0534,
+	    0x015a, 0x031f, 0x068d, 0x0000, 0x052a, 0x0000, 0x0000, 0x04a7,
+	    0x00de, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x061c, 0x0400,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x006f, 0x0000, 0x0000,
+	    0x05bf, 0x0394, 0x0000, 0x0528, 0x0000, 0x0692, 0x0000, 0x0000,
+	    0x0404, 0x0000, 0x0018, 0x02e6, 0x0035, 0x018a, 0x0000, 0x01ba,
+	    0x055d, 0x04de, 0x0000, 0x045f, 0x02f9, 0x0000, 0x0000, 0x0695,
+	    0x0000, 0x0000, 0x0000, 0x056f, 0x0266, 0x0515, 0x0000, 0x0000,
+	    0x00d4, 0x0000, 0x0000, 0x076f, 0x0402, 0x03b1, 0x0153, 0x0373,
+	    0x0689, 0x0061, 0x0417, 0x0000, 0x0000, 0x006d, 0x0000, 0x0659,
+	    0x0000, 0x0230, 0x0000, 0x00c4, 0x0083, 0x02e9, 0x01cd, 0x046f,
+	    0x0000, 0x047e, 0x0000, 0x078a, 0x0000, 0x0000, 0x0010, 0x0000,
+	    0x03e3, 0x0000, 0x0337, 0x0000, 0x0000, 0x0000, 0x0362, 0x0199,
+	    0x0724, 0x06cc, 0x0000, 0x00a6, 0x0000, 0x06d5, 0x02cd, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0016, 0x0000, 0x0000,
+	    0x06b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0658,
+	    0x0000, 0x0085, 0x064a, 0x02fe, 0x0000, 0x009b, 0x0000, 0x0000,
+	    0x05ad, 0x01eb, 0x0493, 0x027f, 0x0000, 0x018b, 0x06cb, 0x025a,
+	    0x0246, 0x00fb, 0x0000, 0x03a6, 0x04b6, 0x0000, 0x039f, 0x066c,
+	    0x052c, 0x008f, 0x0000, 0x0616, 0x03c4, 0x0000, 0x0000, 0x0621,
+	    0x0000, 0x0000, 0x0000, 0x04ad, 0x0719, 0x0000, 0x0002, 0x0000,
+	    0x0000, 0x0000, 0x01e1, 0x0496, 0x0200, 0x05aa, 0x04da, 0x034e,
+	    0x0000, 0x06bf, 0x0000, 0x0000, 0x0000, 0x07ab, 0x0280, 0x009a,
+	    0x0317, 0x00b4, 0x008b, 0x00f6, 0x0000, 0x0000, 0x0000, 0x0523,
+	    0x0000, 0x031a, 0x05aa, 0x0000, 0x042b, 0x0000, 0x01a8, 0x0583,
+	    0x0179, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e7, 0x0433, 0x0791,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0281, 0x0000, 0x0000,
+	    0x05a0, 0x03d4, 0x01e6, 0x0635, 0x0256, 0x072c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x05ac, 0x06ab, 0x0371, 0x0000, 0x0000, 0x0490,
+	    0x067b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x055c, 0x0128,
+	    0x07a0, 0x0000, 0x0720, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0398, 0x0000, 0x0000, 0x04db, 0x01cf, 0x0000, 0x0000,
+	    0x02de, 0x04bd, 0x06a6, 0x0000, 0x01fd, 0x0444, 0x0000, 0x032d,
+	    0x0000, 0x069e, 0x0000, 0x0000, 0x04b5, 0x0000, 0x0000, 0x0383,
+	    0x0522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0684, 0x0000, 0x0019,
+	    0x0000, 0x0000, 0x079e, 0x0000, 0x04a4, 0x0000, 0x0000, 0x0000,
+	    0x0225, 0x0000, 0x0341, 0x054f, 0x0000, 0x0205, 0x006f, 0x0000,
+	    0x0000, 0x0693, 0x0666, 0x0000, 0x0086, 0x0000, 0x0000, 0x001a,
+	    0x06f9, 0x0778, 0x05b7, 0x0000, 0x0000, 0x0000, 0x033b, 0x0295,
+	    0x0000, 0x0000, 0x07cc, 0x00b5, 0x0285, 0x03b3, 0x0000, 0x0000,
+	    0x0427, 0x006f, 0x0000, 0x0000, 0x0000, 0x04ea, 0x0000, 0x01dd,
+	    0x0000, 0x0601, 0x00da, 0x0511, 0x0542, 0x023e, 0x0000, 0x0068,
+	    0x0000, 0x0000, 0x0312, 0x0000, 0x076a, 0x0120, 0x01b6, 0x01c0,
+	    0x004d, 0x0365, 0x0000, 0x0000, 0x048d, 0x0000, 0x0000, 0x0000,
+	    0x0231, 0x01db, 0x0000, 0x0336, 0x0000, 0x03ad, 0x0375, 0x0000,
+	    0x0000, 0x00a3, 0x0000, 0x0636, 0x0000, 0x0000, 0x057f, 0x0000,
+	    0x0000, 0x05af, 0x0288, 0x0000, 0x01f9, 0x0000, 0x0000, 0x0789,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0139, 0x07a2, 0x0198,
+	    0x0081, 0x0000, 0x05a2, 0x043c, 0x0761, 0x0000, 0x055f, 0x0406,
+	    0x0000, 0x0000, 0x0000, 0x0064, 0x0000, 0x077f, 0x0000, 0x0315,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0693, 0x0000, 0x0313, 0x0000,
+	    0x0765, 0x03f6, 0x0000, 0x0000, 0x047c, 0x06ad, 0x01d8, 0x0000,
+	    0x0000, 0x0000, 0x0780, 0x0000, 0x00d8, 0x032e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x07ac, 0x023a, 0x0000, 0x0000, 0x00f0, 0x0000,
+	    0x05a3, 0x04d8, 0x0000, 0x0000, 0x0000, 0x054d, 0x0270, 0x0000,
+	    0x02d1, 0x0368, 0x01a2, 0x0396, 0x00aa, 0x0675, 0x0000, 0x067a,
+	    0x01fb, 0x0365, 0x06ab, 0x0000, 0x0085, 0x034c, 0x0538, 0x0424,
+	    0x0000, 0x04c4, 0x02f9, 0x0000, 0x0000, 0x0000, 0x04ed, 0x0000,
+	    0x0000, 0x0518, 0x0054, 0x027c, 0x0000, 0x022b, 0x0000, 0x0000,
+	    0x0158, 0x035d, 0x0342, 0x0000, 0x0000, 0x0000, 0x049e, 0x018f,
+	    0x0000, 0x04e4, 0x0069, 0x0000, 0x0000, 0x0000, 0x05d9, 0x07bb,
+	    0x02a7, 0x0505, 0x0688, 0x0000, 0x02b2, 0x0000, 0x0000, 0x0000,
+	    0x06b0, 0x02b9, 0x0000, 0x0000, 0x0000, 0x01b1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0166, 0x0000, 0x0638, 0x0000, 0x050c, 0x0000,
+	    0x0026, 0x0000, 0x0000, 0x0000, 0x0032, 0x035b, 0x0000, 0x07ce,
+	    0x0000, 0x0000, 0x0000, 0x0749, 0x0011, 0x0000, 0x0000, 0x01c4,
+	    0x0000, 0x0000, 0x01e7, 0x06e9, 0x007b, 0x0535, 0x0000, 0x02ba,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0143, 0x0000, 0x027f, 0x0000,
+	    0x0000, 0x0000, 0x0374, 0x0000, 0x0000, 0x078a, 0x02f1, 0x0000,
+	    0x023b, 0x0000, 0x00d6, 0x0000, 0x0372, 0x0000, 0x0000, 0x01e8,
+	    0x0000, 0x0000, 0x0000, 0x05b0, 0x04fb, 0x0064, 0x0000, 0x0000,
+	    0x0000, 0x0275, 0x0012, 0x06a7, 0x0000, 0x019c, 0x0000, 0x040e,
+	    0x0000, 0x0000, 0x0000, 0x0407, 0x0539, 0x0000, 0x0000, 0x05c8,
+	    0x060b, 0x0148, 0x0000, 0x0000, 0x0000, 0x0664, 0x0000, 0x0000,
+	    0x0654, 0x0000, 0x0572, 0x0000, 0x00b1, 0x0761, 0x0000, 0x0000,
+	    0x02dc, 0x02a4, 0x078b, 0x0413, 0x042e, 0x0000, 0x03d9, 0x0274,
+	    0x05b2, 0x0121, 0x0000, 0x0000, 0x0584, 0x017a, 0x0000, 0x0222,
+	    0x0682, 0x0239, 0x0580, 0x0000, 0x00f0, 0x005d, 0x0000, 0x0000,
+	    0x05cd, 0x02d3, 0x0758, 0x065d, 0x07ca, 0x0038, 0x011d, 0x0000,
+	    0x04be, 0x01e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0622,
+	    0x0627, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05a7,
+	    0x0000, 0x0000, 0x015f, 0x0488, 0x0000, 0x0381, 0x0456, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0642, 0x0000, 0x00cc, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x03ce, 0x0679, 0x0000, 0x0000, 0x0000,
+	    0x005e, 0x06c0, 0x05fe, 0x0000, 0x05ab, 0x0607, 0x01c6, 0x0000,
+	    0x0000, 0x032d, 0x0648, 0x04c5, 0x079d, 0x0000, 0x0000, 0x0000,
+	    0x02f3, 0x0000, 0x0000, 0x0000, 0x0553, 0x04e6, 0x00ea, 0x006a,
+	    0x031e, 0x028a, 0x0000, 0x078e, 0x0000, 0x0122, 0x0000, 0x0000,
+	    0x0233, 0x07a9, 0x0000, 0x0000, 0x012d, 0x0165, 0x0000, 0x0782,
+	    0x0000, 0x020f, 0x0724, 0x0000, 0x0000, 0x0000, 0x01f1, 0x0100,
+	    0x0000, 0x0000, 0x01fd, 0x0000, 0x01f6, 0x05f1, 0x0000, 0x04d2,
+	    0x04ca, 0x0000, 0x05fe, 0x039f, 0x0000, 0x00a2, 0x0000, 0x0000,
+	    0x0000, 0x010a, 0x0000, 0x03fb, 0x0591, 0x0000, 0x0007, 0x03d0,
+	    0x029a, 0x0015, 0x06b8, 0x0000, 0x069b, 0x0000, 0x0737, 0x073b,
+	    0x0653, 0x0000, 0x0728, 0x0000, 0x0455, 0x028b, 0x0000, 0x075b,
+	    0x00b9, 0x0000, 0x0000, 0x0000, 0x0000, 0x026d, 0x02e6, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0119, 0x0000, 0x0290, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0264, 0x03cc, 0x050a, 0x07b0, 0x05cf, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0238, 0x02c9, 0x0000, 0x00a1,
+	    0x0000, 0x0491, 0x0536, 0x0000, 0x06d1, 0x0000, 0x050f, 0x0211,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02cc, 0x0420,
+	    0x0478, 0x0000, 0x0000, 0x0000, 0x02a1, 0x0000, 0x066f, 0x0352,
+	    0x0000, 0x016c, 0x055d, 0x029e, 0x0000, 0x0000, 0x0000, 0x0099,
+	    0x01b2, 0x0000, 0x06fb, 0x00b8, 0x0000, 0x0412, 0x026f, 0x074c,
+	    0x0000, 0x0457, 0x0456, 0x0430, 0x0000, 0x0000, 0x01bf, 0x0000,
+	    0x0000, 0x0000, 0x0205, 0x0000, 0x02c1, 0x0000, 0x0073, 0x0000,
+	    0x01d4, 0x05d5, 0x0000, 0x017a, 0x00e0, 0x0000, 0x0000, 0x0548,
+	    0x0000, 0x00a6, 0x0000, 0x0087, 0x0000, 0x0000, 0x000f, 0x0000,
+	    0x03a4, 0x023d, 0x0000, 0x028c, 0x0000, 0x0000, 0x06e9, 0x008f,
+	    0x0554, 0x0274, 0x060b, 0x0047, 0x0078, 0x0508, 0x0000, 0x0635,
+	    0x0000, 0x0000, 0x0000, 0x0068, 0x0000, 0x0133, 0x0000, 0x0000,
+	    0x0755, 0x0000, 0x0510, 0x0000, 0x02e4, 0x0446, 0x0341, 0x03a4,
+	    0x05ce, 0x0000, 0x0134, 0x0000, 0x0000, 0x0000, 0x0000, 0x008c,
+	    0x0000, 0x0568, 0x0000, 0x0600, 0x0000, 0x0000, 0x0000, 0x03dc,
+	    0x0000, 0x0641, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03b4,
+	    0x0000, 0x0664, 0x04b0, 0x0000, 0x0000, 0x063b, 0x0000, 0x05d6,
+	    0x0000, 0x00dd, 0x045e, 0x02f9, 0x0000, 0x0000, 0x01ce, 0x0380,
+	    0x01fa, 0x04d9, 0x0000, 0x0613, 0x068a, 0x0000, 0x0000, 0x0578,
+	    0x0215, 0x0000, 0x0000, 0x004d, 0x0000, 0x0000, 0x0000, 0x06b7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05c2, 0x0000, 0x0324,
+	    0x01c2, 0x0556, 0x0047, 0x04f2, 0x0000, 0x06de, 0x0000, 0x027a,
+	    0x005b, 0x0000, 0x02b0, 0x0135, 0x0540, 0x0133, 0x0000, 0x0000,
+	    0x0000, 0x0016, 0x0000, 0x0000, 0x038d, 0x009d, 0x03da, 0x0421,
+	    0x04a1, 0x0000, 0x04cc, 0x0000, 0x00c7, 0x0000, 0x0185, 0x03db,
+	    0x06a6, 0x0402, 0x0000, 0x05ff, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03b2, 0x0000, 0x0000, 0x047a, 0x05a6, 0x0000, 0x0793,
+	    0x0000, 0x0111, 0x0000, 0x071b, 0x0000, 0x07c6, 0x027f, 0x0000,
+	    0x07bd, 0x00c8, 0x0000, 0x0000, 0x0000, 0x04b8, 0x0000, 0x01aa,
+	    0x0460, 0x0000, 0x0000, 0x0000, 0x0320, 0x040e, 0x0120, 0x0000,
+	    0x0000, 0x0383, 0x03fa, 0x0000, 0x0000, 0x004b, 0x01fb, 0x008e,
+	    0x0342, 0x0250, 0x0000, 0x0223, 0x0000, 0x023d, 0x0173, 0x0000,
+	    0x02bb, 0x0000, 0x0000, 0x0000, 0x0436, 0x0000, 0x0000, 0x0000,
+	    0x00ce, 0x0000, 0x04d2, 0x0034, 0x00c8, 0x0000, 0x0000, 0x0000,
+	    0x05e2, 0x0000, 0x0451, 0x0520, 0x0000, 0x0000, 0x01e5, 0x0000,
+	    0x0000, 0x0541, 0x0000, 0x02e3, 0x0000, 0x0146, 0x0000, 0x00b1,
+	    0x0000, 0x0075, 0x04a8, 0x0481, 0x0000, 0x01fc, 0x0000, 0x0525,
+	    0x001e, 0x0000, 0x02cf, 0x03e4, 0x0000, 0x06f8, 0x0469, 0x06a2,
+	    0x0000, 0x01d9, 0x0000, 0x0000, 0x0000, 0x0634, 0x020e, 0x0000,
+	    0x003b, 0x01db, 0x0000, 0x0000, 0x0630, 0x01c1, 0x017c, 0x0023,
+	    0x0579, 0x074f, 0x0103, 0x0000, 0x0000, 0x0093, 0x0464, 0x006d,
+	    0x0000, 0x0000, 0x045a, 0x04c0, 0x0693, 0x0763, 0x02b8, 0x011f,
+	    0x04ba, 0x0000, 0x0426, 0x0000, 0x0000, 0x0000, 0x0000, 0x0409,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x01ef, 0x0000, 0x0000, 0x012a,
+	    0x0000, 0x02b9, 0x0000, 0x0000, 0x0000, 0x050c, 0x0000, 0x00dc,
+	    0x0395, 0x0000, 0x0000, 0x0000, 0x0267, 0x078d, 0x03c5, 0x004a,
+	    0x0000, 0x0546, 0x03e7, 0x0465, 0x0575, 0x064d, 0x0000, 0x076e,
+	    0x0000, 0x0000, 0x07b6, 0x0000, 0x0000, 0x07ad, 0x0000, 0x055b,
+	    0x051c, 0x0000, 0x042f, 0x0000, 0x0000, 0x0000, 0x0005, 0x0000,
+	    0x0507, 0x01bc, 0x06f1, 0x00bf, 0x01cb, 0x0000, 0x077a, 0x0000,
+	    0x04fe, 0x0000, 0x0000, 0x0000, 0x0602, 0x00ee, 0x0785, 0x059f,
+	    0x0000, 0x0000, 0x0000, 0x02b7, 0x0000, 0x0000, 0x02f4, 0x00f9,
+	    0x0216, 0x0114, 0x03c1, 0x0414, 0x0070, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x060f, 0x036a, 0x027d, 0x039b, 0x0734, 0x01cc, 0x0193,
+	    0x0000, 0x0687, 0x0000, 0x02be, 0x032f, 0x0000, 0x0684, 0x04fd,
+	    0x0000, 0x0000, 0x0000, 0x06dd, 0x0000, 0x032c, 0x01fa, 0x0000,
+	    0x05be, 0x0208, 0x0000, 0x05f8, 0x06a5, 0x0000, 0x0000, 0x0291,
+	    0x06d0, 0x07b3, 0x0217, 0x0000, 0x0000, 0x00bd, 0x0506, 0x003c,
+	    0x0000, 0x015b, 0x0000, 0x0651, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x059c, 0x0629, 0x0615,
+	    0x0000, 0x05f0, 0x0102, 0x0000, 0x0654, 0x0358, 0x0000, 0x0291,
+	    0x0618, 0x0000, 0x03a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x00cc,
+	    0x02ea, 0x021f, 0x04fa, 0x0538, 0x033a, 0x0000, 0x071b, 0x0309,
+	    0x0000, 0x03e5, 0x0000, 0x01d2, 0x049e, 0x0000, 0x0000, 0x0000,
+	    0x02d9, 0x02f7, 0x00d0, 0x01b4, 0x0493, 0x0000, 0x038e, 0x0148,
+	    0x009d, 0x0000, 0x0000, 0x039f, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x03f0, 0x0000, 0x05b0, 0x058a, 0x0628,
+	    0x0000, 0x0000, 0x0000, 0x0144, 0x0000, 0x0000, 0x063e, 0x0000,
+	    0x0000, 0x0287, 0x04e2, 0x0000, 0x03d8, 0x0499, 0x0000, 0x020d,
+	    0x0000, 0x0437, 0x07ac, 0x0000, 0x046f, 0x0000, 0x05b0, 0x0000,
+	    0x0434, 0x0078, 0x0000, 0x0000, 0x075a, 0x0456, 0x0494, 0x0000,
+	    0x068d, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c0, 0x0301, 0x02d3,
+	    0x044b, 0x0347, 0x025c, 0x05b9, 0x051b, 0x0000, 0x0000, 0x0000,
+	    0x0277, 0x0000, 0x0186, 0x063c, 0x0000, 0x0000, 0x0509, 0x0000,
+	    0x0000, 0x0000, 0x001e, 0x0000, 0x0000, 0x05b6, 0x056f, 0x05e6,
+	    0x0086, 0x0000, 0x0765, 0x0000, 0x000f, 0x0000, 0x05ed, 0x026d,
+	    0x04f9, 0x0000, 0x0000, 0x06f6, 0x02eb, 0x05d1, 0x0163, 0x065e,
+	    0x01c9, 0x0000, 0x0000, 0x03dd, 0x0000, 0x056a, 0x06da, 0x0061,
+	    0x056d, 0x0000, 0x03cd, 0x055d, 0x070b, 0x0000, 0x036b, 0x0000,
+	    0x0625, 0x076d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x018f, 0x0484, 0x0000, 0x0000, 0x076f, 0x02d8, 0x0268, 0x0631,
+	    0x0000, 0x0000, 0x0402, 0x06ee, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0112, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000,
+	    0x0729, 0x0000, 0x0310, 0x0000, 0x0000, 0x0575, 0x0166, 0x0000,
+	    0x00be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0388, 0x0000,
+	    0x0000, 0x0000, 0x05e5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0077,
+	    0x0000, 0x0000, 0x0000, 0x0129, 0x0000, 0x0000, 0x04f9, 0x0000,
+	    0x0000, 0x0000, 0x04f3, 0x01d1, 0x05e7, 0x0192, 0x0000, 0x0000,
+	    0x0782, 0x011b, 0x045c, 0x0000, 0x0460, 0x070c, 0x04d1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x053a, 0x0589,
+	    0x010c, 0x0501, 0x023c, 0x0454, 0x0398, 0x0043, 0x0381, 0x0000,
+	    0x02ce, 0x059e, 0x0710, 0x0000, 0x0000, 0x0000, 0x0000, 0x0296,
+	    0x0000, 0x0284, 0x0570, 0x0000, 0x0000, 0x0112, 0x0178, 0x00f5,
+	    0x0729, 0x0730, 0x0324, 0x0198, 0x0000, 0x06e1, 0x0000, 0x0255,
+	    0x02b3, 0x0000, 0x0238, 0x0000, 0x0000, 0x0358, 0x01e1, 0x04a3,
+	    0x07cc, 0x056d, 0x0455, 0x06c6, 0x0307, 0x0000, 0x01ac, 0x0000,
+	    0x0000, 0x0324, 0x01ca, 0x0000, 0x03a8, 0x0227, 0x0410, 0x00bb,
+	    0x0000, 0x0000, 0x058e, 0x0066, 0x0593, 0x0000, 0x0000, 0x06e1,
+	    0x0000, 0x02f8, 0x0000, 0x0795, 0x0142, 0x04af, 0x0000, 0x04e9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0306, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0164, 0x051d, 0x0000, 0x00aa, 0x0000,
+	    0x0000, 0x03a2, 0x0000, 0x03c7, 0x036e, 0x0000, 0x0079, 0x06f5,
+	    0x0000, 0x058d, 0x0000, 0x0000, 0x009c, 0x0000, 0x0393, 0x0558,
+	    0x0000, 0x0000, 0x0598, 0x069c, 0x0055, 0x0000, 0x0000, 0x05da,
+	    0x0712, 0x046f, 0x05c3, 0x0000, 0x0360, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x06a8, 0x0721, 0x0000, 0x0121, 0x0000, 0x0000,
+	    0x069c, 0x0224, 0x04cd, 0x07b4, 0x0000, 0x07ab, 0x01ff, 0x029b,
+	    0x0655, 0x0000, 0x072b, 0x0000, 0x0791, 0x0000, 0x0457, 0x0000,
+	    0x0000, 0x075c, 0x066d, 0x0000, 0x078f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0627, 0x0000,
+	    0x0440, 0x0000, 0x0000, 0x0623, 0x0251, 0x0163, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x017a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x002b, 0x050f, 0x007b, 0x0000, 0x0000, 0x05ff, 0x0000, 0x02ee,
+	    0x0000, 0x02ac, 0x03f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x041c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0598,
+	    0x0000, 0x0000, 0x04c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0275, 0x0000, 0x0000, 0x0000,
+	    0x05b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0477, 0x06d8, 0x001f, 0x0000, 0x03a5, 0x0718, 0x0549, 0x00b5,
+	    0x0785, 0x0000, 0x0205, 0x0000, 0x04c3, 0x0000, 0x0000, 0x0704,
+	    0x0000, 0x0000, 0x009d, 0x04c2, 0x0000, 0x0000, 0x0000, 0x0025,
+	    0x0430, 0x0784, 0x0110, 0x000a, 0x0000, 0x05f8, 0x038a, 0x0000,
+	    0x0000, 0x04fd, 0x0524, 0x02de, 0x01bd, 0x0000, 0x0000, 0x040e,
+	    0x0000, 0x0000, 0x0327, 0x0000, 0x0000, 0x03a0, 0x0775, 0x0000,
+	    0x070a, 0x0000, 0x0000, 0x0000, 0x037d, 0x01ca, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01a9, 0x034a, 0x0000, 0x0000, 0x00c6,
+	    0x039c, 0x0000, 0x0000, 0x0622, 0x0260, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x013b, 0x01f1, 0x0000, 0x0676, 0x0000, 0x07a9, 0x02ef,
+	    0x0000, 0x068e, 0x0000, 0x01bf, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0386, 0x0371, 0x00e1, 0x0710, 0x0000,
+	    0x03c0, 0x0000, 0x0000, 0x0012, 0x071a, 0x0000, 0x01dd, 0x0000,
+	    0x067e, 0x0651, 0x0000, 0x0000, 0x00b7, 0x0330, 0x0000, 0x016f,
+	    0x0161, 0x004f, 0x0000, 0x0000, 0x04a5, 0x0000, 0x05cf, 0x0000,
+	    0x0000, 0x012c, 0x0577, 0x0000, 0x067f, 0x0000, 0x0000, 0x0000,
+	    0x0270, 0x0000, 0x0000, 0x0000, 0x06ba, 0x0280, 0x0000, 0x0000,
+	    0x0218, 0x0690, 0x0000, 0x0735, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0185, 0x0000, 0x0000, 0x025d, 0x00fd, 0x051a, 0x0277,
+	    0x0000, 0x019d, 0x0753, 0x0018, 0x00e6, 0x075e, 0x0000, 0x0104,
+	    0x0000, 0x0000, 0x0689, 0x0000, 0x0000, 0x0000, 0x0000, 0x0343,
+	    0x0668, 0x0773, 0x01a0, 0x0471, 0x01a0, 0x0000, 0x01c1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0031, 0x0000, 0x04de, 0x05f3, 0x0502,
+	    0x06fa, 0x0000, 0x0000, 0x076d, 0x00cf, 0x037f, 0x03b9, 0x0000,
+	    0x058a, 0x0000, 0x05e8, 0x0000, 0x0000, 0x0468, 0x0693, 0x0000,
+	    0x050e, 0x0000, 0x0000, 0x0000, 0x00e2, 0x051c, 0x06ed, 0x0469,
+	    0x0000, 0x0000, 0x02e6, 0x0662, 0x0000, 0x0000, 0x0000, 0x02ee,
+	    0x0409, 0x0000, 0x01b8, 0x0000, 0x0150, 0x0793, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02cb, 0x0227, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0418, 0x0000, 0x01bf, 0x0000, 0x0000, 0x033c, 0x054c,
+	    0x0738, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x009c, 0x0000, 0x0216, 0x0000, 0x074e, 0x0000, 0x0000, 0x060f,
+	    0x0000, 0x0000, 0x0000, 0x025b, 0x059a, 0x0000, 0x0000, 0x0000,
+	    0x043d, 0x0649, 0x0000, 0x05b1, 0x02ab, 0x0000, 0x063d, 0x0000,
+	    0x04cf, 0x0000, 0x0000, 0x020c, 0x0065, 0x0000, 0x0000, 0x0096,
+	    0x0000, 0x0000, 0x002c, 0x06ec, 0x0000, 0x0089, 0x0000, 0x029a,
+	    0x06f8, 0x0186, 0x0616, 0x0000, 0x0000, 0x06c1, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0107, 0x0000, 0x0000, 0x0000, 0x063a, 0x0000,
+	    0x04c7, 0x0389, 0x0000, 0x027a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x030d, 0x059e, 0x0000, 0x0000, 0x0000, 0x03dd, 0x0000, 0x0000,
+	    0x0000, 0x03b2, 0x0000, 0x049c, 0x0000, 0x079d, 0x012f, 0x0000,
+	    0x0016, 0x073e, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ef, 0x01dc,
+	    0x0000, 0x013f, 0x07c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x071e,
+	    0x03c3, 0x0000, 0x0517, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x066e, 0x04c1, 0x041c, 0x0164, 0x074f, 0x02ec, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0266, 0x02e9, 0x00a3, 0x0000, 0x03d2, 0x0000,
+	    0x048a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fc, 0x00ed,
+	    0x021f, 0x0000, 0x0000, 0x0297, 0x0742, 0x0000, 0x0175, 0x0000,
+	    0x0000, 0x03aa, 0x0000, 0x0000, 0x03a6, 0x0000, 0x0000, 0x0754,
+	    0x0352, 0x0106, 0x0000, 0x05b1, 0x039d, 0x05a7, 0x0000, 0x0000,
+	    0x04df, 0x0000, 0x0216, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02d2, 0x06c3, 0x0000, 0x0000, 0x051f,
+	    0x06c0, 0x0418, 0x0673, 0x05f2, 0x00ad, 0x0000, 0x0000, 0x0401,
+	    0x0000, 0x00db, 0x0000, 0x017e, 0x0000, 0x02ef, 0x0000, 0x0781,
+	    0x0000, 0x06c1, 0x0000, 0x05d6, 0x0000, 0x0512, 0x0000, 0x024b,
+	    0x0000, 0x04bd, 0x0000, 0x065b, 0x056e, 0x0000, 0x0000, 0x0029,
+	    0x0071, 0x03bc, 0x00f8, 0x0000, 0x06f7, 0x0355, 0x0268, 0x0000,
+	    0x05c1, 0x0000, 0x0000, 0x0000, 0x03e5, 0x0000, 0x04ba, 0x0000,
+	    0x0000, 0x0200, 0x077b, 0x07a5, 0x0499, 0x0000, 0x0000, 0x0328,
+	    0x0000, 0x0064, 0x0000, 0x0000, 0x0000, 0x057d, 0x0000, 0x011d,
+	    0x0000, 0x0000, 0x0000, 0x04a1, 0x0024, 0x0000, 0x0000, 0x0000,
+	    0x075f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x057b, 0x07ae,
+	    0x0000, 0x0000, 0x0000, 0x01df, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0169, 0x0000, 0x0000, 0x0152, 0x06c3, 0x0000, 0x0000,
+	    0x048d, 0x04e3, 0x0000, 0x03b8, 0x00ae, 0x00fb, 0x0000, 0x0000,
+	    0x0058, 0x0000, 0x0777, 0x0000, 0x0000, 0x0327, 0x0542, 0x0000,
+	    0x07cf, 0x0537, 0x0000, 0x00ad, 0x0000, 0x0000, 0x0000, 0x068f,
+	    0x0000, 0x0000, 0x01db, 0x0643, 0x059f, 0x037a, 0x0000, 0x0000,
+	    0x03db, 0x0089, 0x0678, 0x055f, 0x0141, 0x0000, 0x0177, 0x0000,
+	    0x01fb, 0x0000, 0x0000, 0x0635, 0x0000, 0x04ff, 0x00e7, 0x0681,
+	    0x050d, 0x0000, 0x0696, 0x0000, 0x0367, 0x068c, 0x0000, 0x0213,
+	    0x0000, 0x0000, 0x0304, 0x0438, 0x0000, 0x01fe, 0x0000, 0x02d0,
+	    0x0563, 0x0365, 0x05b5, 0x0720, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x00de, 0x0240, 0x0000, 0x037c, 0x0065, 0x0000, 0x0000,
+	    0x0000, 0x0760, 0x0546, 0x0000, 0x0000, 0x0000, 0x02a4, 0x056a,
+	    0x00db, 0x013f, 0x0015, 0x0645, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0559, 0x0190, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0443, 0x054b, 0x043d, 0x059c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x056b, 0x0734, 0x041b, 0x0000, 0x02d9, 0x0000,
+	    0x0427, 0x076d, 0x0000, 0x0000, 0x024d, 0x03eb, 0x04e8, 0x0000,
+	    0x0000, 0x00e8, 0x0089, 0x0000, 0x037e, 0x0000, 0x0000, 0x02fd,
+	    0x0000, 0x0000, 0x016d, 0x0000, 0x0000, 0x0017, 0x0000, 0x0030,
+	    0x06a1, 0x0484, 0x0350, 0x0000, 0x014a, 0x0307, 0x0000, 0x042b,
+	    0x0000, 0x0465, 0x0000, 0x02af, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x044b, 0x0014, 0x0000, 0x0000, 0x00f7, 0x00e3, 0x027c,
+	    0x0639, 0x0325, 0x0000, 0x0000, 0x067e, 0x0000, 0x0000, 0x0000,
+	    0x04b7, 0x0000, 0x074d, 0x0000, 0x00ab, 0x01b3, 0x00b7, 0x0000,
+	    0x0000, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000, 0x04d8, 0x0000,
+	    0x0000, 0x0213, 0x014b, 0x06c4, 0x07ba, 0x0000, 0x03ca, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0720,
+	    0x0000, 0x0000, 0x0783, 0x0000, 0x0205, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0407, 0x0000, 0x05d8, 0x025b, 0x0302,
+	    0x067d, 0x0459, 0x0000, 0x0436, 0x01f7, 0x0771, 0x0764, 0x0000,
+	    0x0672, 0x07b7, 0x07be, 0x0475, 0x01ab, 0x05b0, 0x0000, 0x0000,
+	    0x003e, 0x0504, 0x01eb, 0x0000, 0x015d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03b9, 0x026a, 0x0000, 0x01a6, 0x0000, 0x0000, 0x0000,
+	    0x0138, 0x0266, 0x0000, 0x0000, 0x0000, 0x0000, 0x0332, 0x079c,
+	    0x0121, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0795, 0x0003,
+	    0x0056, 0x06f8, 0x02b6, 0x065d, 0x01eb, 0x0000, 0x005b, 0x0000,
+	    0x0000, 0x0000, 0x0126, 0x073d, 0x0000, 0x0300, 0x0431, 0x0783,
+	    0x03a5, 0x0000, 0x039a, 0x0399, 0x07c7, 0x078b, 0x0000, 0x069d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0087, 0x015d, 0x0000,
+	    0x00e2, 0x066e, 0x03e4, 0x06af, 0x0000, 0x038f, 0x054d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0516, 0x0000, 0x0000, 0x0711,
+	    0x0738, 0x0000, 0x0000, 0x0000, 0x0000, 0x03d9, 0x046b, 0x015c,
+	    0x0000, 0x01a8, 0x0000, 0x061c, 0x0000, 0x0000, 0x0000, 0x0333,
+	    0x00ba, 0x0154, 0x0399, 0x0000, 0x0000, 0x051c, 0x06ed, 0x043a,
+	    0x0000, 0x003d, 0x0238, 0x077d, 0x0000, 0x0505, 0x013c, 0x0000,
+	    0x0606, 0x0000, 0x0000, 0x00b9, 0x0000, 0x0000, 0x036e, 0x0000,
+	    0x0165, 0x0000, 0x0715, 0x0000, 0x075b, 0x0000, 0x0000, 0x0049,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03fc, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x06d7, 0x0567, 0x0522, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x018e, 0x0000, 0x0159, 0x03fd, 0x0000, 0x026b, 0x0000,
+	    0x0000, 0x0000, 0x0653, 0x0000, 0x0234, 0x0000, 0x0099, 0x0000,
+	    0x0000, 0x0000, 0x0021, 0x06a2, 0x00b3, 0x01eb, 0x0000, 0x0150,
+	    0x0000, 0x012f, 0x0098, 0x0332, 0x0000, 0x06a6, 0x0000, 0x0063,
+	    0x0294, 0x0277, 0x0000, 0x0000, 0x0241, 0x0000, 0x01e4, 0x0000,
+	    0x05e4, 0x04f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0089, 0x06a1, 0x0004, 0x0000, 0x0000, 0x0563, 0x0000,
+	    0x0037, 0x0000, 0x0000, 0x0000, 0x0000, 0x0757, 0x0000, 0x010f,
+	    0x0000, 0x0000, 0x0000, 0x01aa, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0752, 0x0073, 0x0163, 0x0000, 0x06a0, 0x02e7,
+	    0x0000, 0x02a8, 0x0424, 0x0000, 0x0375, 0x0000, 0x03e1, 0x018f,
+	    0x0000, 0x0000, 0x0000, 0x040f, 0x0470, 0x0000, 0x0000, 0x0141,
+	    0x0000, 0x02cf, 0x0000, 0x0000, 0x00fe, 0x0000, 0x0000, 0x05d2,
+	    0x0000, 0x017c, 0x0000, 0x02df, 0x06a3, 0x02d6, 0x0000, 0x04d0,
+	    0x0000, 0x0000, 0x04f3, 0x0265, 0x0000, 0x03cc, 0x0000, 0x0334,
+	    0x00ed, 0x0344, 0x0767, 0x06bf, 0x0000, 0x0000, 0x01bc, 0x0000,
+	    0x001c, 0x0000, 0x0083, 0x0000, 0x0148, 0x0000, 0x02ef, 0x0172,
+	    0x06f9, 0x0000, 0x05a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x04c6,
+	    0x0000, 0x03b3, 0x0000, 0x0448, 0x068b, 0x011d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00a8, 0x0000, 0x0000, 0x03e0, 0x07c1, 0x0224,
+	    0x0000, 0x0000, 0x0523, 0x0123, 0x0000, 0x022e, 0x0000, 0x0000,
+	    0x0722, 0x074d, 0x0123, 0x02f3, 0x035a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x003f, 0x02b5, 0x0000, 0x053d,
+	    0x06b9, 0x06cc, 0x0000, 0x0467, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x014b, 0x0000, 0x00ad, 0x0000, 0x029f, 0x0000, 0x0656,
+	    0x0000, 0x0000, 0x0392, 0x0000, 0x0576, 0x0000, 0x0000, 0x0776,
+	    0x0000, 0x0000, 0x04ea, 0x0079, 0x0000, 0x03e9, 0x0000, 0x0000,
+	    0x02e5, 0x0000, 0x0000, 0x03ea, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02b9, 0x0000, 0x061d, 0x04a5, 0x04a7, 0x0000, 0x0000,
+	    0x0205, 0x0082, 0x0678, 0x0000, 0x0000, 0x0000, 0x0775, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x031e, 0x00ce, 0x0686,
+	    0x0000, 0x0000, 0x01a3, 0x046d, 0x0201, 0x0000, 0x0000, 0x064d,
+	    0x0000, 0x0429, 0x0346, 0x0000, 0x0000, 0x0000, 0x002d, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x01d4, 0x0397, 0x003b, 0x067c,
+	    0x0153, 0x0000, 0x0000, 0x00ad, 0x035c, 0x0000, 0x01e4, 0x01e0,
+	    0x0000, 0x0768, 0x0132, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x05a2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x069c, 0x0000, 0x0000, 0x0466, 0x0000, 0x02d1, 0x02c2, 0x0000,
+	    0x0000, 0x0359, 0x0511, 0x07a4, 0x078e, 0x0000, 0x057f, 0x0000,
+	    0x025f, 0x0000, 0x0000, 0x0000, 0x07b8, 0x0000, 0x0151, 0x0000,
+	    0x0000, 0x0000, 0x047e, 0x03b9, 0x0000, 0x01e0, 0x0000, 0x0000,
+	    0x029e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0029,
+	    0x0000, 0x0251, 0x0000, 0x052b, 0x0594, 0x03fe, 0x0000, 0x0000,
+	    0x0174, 0x0638, 0x0000, 0x0000, 0x0000, 0x06de, 0x0000, 0x009f,
+	    0x050e, 0x0000, 0x0000, 0x0000, 0x0000, 0x032d, 0x05c5, 0x0573,
+	    0x0554, 0x04dc, 0x0000, 0x0000, 0x00e0, 0x0000, 0x0000, 0x040e,
+	    0x0000, 0x0000, 0x06b1, 0x0000, 0x0000, 0x00f4, 0x0325, 0x0000,
+	    0x0000, 0x01d6, 0x04cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x036d, 0x04d6, 0x0000, 0x0000, 0x0606, 0x056e,
+	    0x0279, 0x02b0, 0x01fe, 0x0000, 0x0000, 0x0000, 0x05d8, 0x03af,
+	    0x02ac, 0x035b, 0x0000, 0x006b, 0x0000, 0x04fa, 0x00ca, 0x0000,
+	    0x0000, 0x0000, 0x0123, 0x0000, 0x00f4, 0x0000, 0x0000, 0x0000,
+	    0x063f, 0x0258, 0x0000, 0x02fc, 0x0000, 0x0023, 0x0279, 0x0000,
+	    0x0000, 0x07ad, 0x0000, 0x0000, 0x06e6, 0x01ec, 0x0000, 0x05f6,
+	    0x019e, 0x01f4, 0x0000, 0x079e, 0x02d7, 0x05a1, 0x0157, 0x0000,
+	    0x0000, 0x05bf, 0x0549, 0x0000, 0x001f, 0x0000, 0x0000, 0x0000,
+	    0x0798, 0x0315, 0x0230, 0x0000, 0x06c5, 0x0000, 0x008b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x075f, 0x0000, 0x0000, 0x03c3,
+	    0x0000, 0x0000, 0x03c9, 0x06e4, 0x0000, 0x06cb, 0x0000, 0x0070,
+	    0x008d, 0x02ca, 0x0000, 0x0000, 0x0000, 0x036f, 0x0000, 0x078c,
+	    0x03c6, 0x0504, 0x0000, 0x0175, 0x0000, 0x0000, 0x0000, 0x0699,
+	    0x0572, 0x0000, 0x00eb, 0x06c5, 0x0705, 0x0000, 0x03d0, 0x04ae,
+	    0x0788, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01a9, 0x0000,
+	    0x0000, 0x0000, 0x04af, 0x0000, 0x0000, 0x0000, 0x01b3, 0x0000,
+	    0x05f7, 0x01bd, 0x06c4, 0x0000, 0x0543, 0x04a0, 0x0000, 0x0000,
+	    0x01cc, 0x0000, 0x056b, 0x07ce, 0x07cd, 0x0000, 0x0639, 0x045a,
+	    0x0512, 0x0000, 0x03bf, 0x0000, 0x06b3, 0x0000, 0x0000, 0x0000,
+	    0x020e, 0x01fe, 0x0359, 0x0000, 0x0000, 0x0000, 0x0013, 0x072c,
+	    0x0000, 0x0357, 0x0000, 0x0294, 0x0000, 0x0604, 0x0176, 0x0000,
+	    0x0000, 0x0263, 0x0000, 0x0000, 0x0000, 0x04a4, 0x0762, 0x01b3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0497, 0x0791, 0x03cb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0578, 0x065f, 0x04fc, 0x0395,
+	    0x0000, 0x056d, 0x0171, 0x00ef, 0x0000, 0x0000, 0x0200, 0x0000,
+	    0x06df, 0x0000, 0x0000, 0x028c, 0x047b, 0x004d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x009c, 0x0000, 0x022e, 0x0000, 0x05eb, 0x05ea,
+	    0x0000, 0x0641, 0x0000, 0x0516, 0x0076, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0665, 0x064e, 0x02f1, 0x0000, 0x03bb, 0x0000, 0x0000,
+	    0x012d, 0x02d5, 0x0000, 0x0000, 0x0000, 0x0069, 0x0000, 0x0000,
+	    0x0000, 0x0483, 0x0000, 0x07a7, 0x0000, 0x0656, 0x0280, 0x0000,
+	    0x0346, 0x04a5, 0x0707, 0x007c, 0x0000, 0x0000, 0x009f, 0x05fb,
+	    0x0000, 0x0000, 0x0270, 0x07a4, 0x0000, 0x0000, 0x0503, 0x03c8,
+	    0x02a5, 0x019a, 0x015d, 0x0000, 0x02a0, 0x04da, 0x0480, 0x050d,
+	    0x05f8, 0x0000, 0x0161, 0x0000, 0x0000, 0x0784, 0x0159, 0x0000,
+	    0x0000, 0x0000, 0x0278, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02c3, 0x0109, 0x0230, 0x0000, 0x02b9, 0x0723, 0x0000,
+	    0x0000, 0x0000, 0x0496, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x03ba, 0x0000, 0x029a, 0x059a, 0x0000, 0x060f, 0x0000, 0x0000,
+	    0x009a, 0x0789, 0x0000, 0x0310, 0x0000, 0x0000, 0x0000, 0x0407,
+	    0x0000, 0x01dc, 0x03ae, 0x0000, 0x0000, 0x0000, 0x06d1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0134, 0x0000, 0x05c6, 0x0051, 0x0000,
+	    0x01d1, 0x076a, 0x07a6, 0x06e4, 0x0296, 0x00a9, 0x028d, 0x0146,
+	    0x0583, 0x0000, 0x00cc, 0x0000, 0x05a1, 0x0564, 0x06c2, 0x06f0,
+	    0x0060, 0x0485, 0x0646, 0x02ba, 0x0000, 0x0000, 0x0178, 0x00a9,
+	    0x0520, 0x0273, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f1, 0x05c2,
+	    0x00bc, 0x06a1, 0x0770, 0x05d1, 0x0000, 0x024b, 0x0000, 0x061f,
+	    0x0000, 0x00e8, 0x0000, 0x0255, 0x064e, 0x04cb, 0x04de, 0x018c,
+	    0x0000, 0x0296, 0x0000, 0x0721, 0x0000, 0x06f8, 0x0000, 0x0000,
+	    0x005b, 0x0000, 0x05eb, 0x0000, 0x04f5, 0x0000, 0x0000, 0x00f6,
+	    0x00c1, 0x0552, 0x0000, 0x05a4, 0x02ba, 0x0578, 0x01e3, 0x0760,
+	    0x0557, 0x0000, 0x073a, 0x072e, 0x0000, 0x0675, 0x0000, 0x04c7,
+	    0x0463, 0x068d, 0x0000, 0x036a, 0x0000, 0x0000, 0x0000, 0x016b,
+	    0x02ae, 0x0000, 0x0000, 0x07c6, 0x0438, 0x0448, 0x0681, 0x0000,
+	    0x0000, 0x069e, 0x0000, 0x0571, 0x0000, 0x022d, 0x0000, 0x0624,
+	    0x059d, 0x0000, 0x0406, 0x07bb, 0x06f7, 0x0000, 0x026a, 0x0391,
+	    0x007c, 0x0000, 0x0389, 0x0435, 0x0599, 0x01af, 0x0456, 0x079c,
+	    0x0065, 0x0000, 0x0000, 0x041d, 0x0000, 0x0000, 0x07a5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x045b, 0x0000, 0x06a6, 0x0544, 0x044a,
+	    0x0000, 0x0000, 0x0651, 0x0000, 0x0164, 0x0084, 0x0000, 0x0789,
+	    0x0746, 0x00fe, 0x0507, 0x0000, 0x0000, 0x0000, 0x0633, 0x0000,
+	    0x0329, 0x05de, 0x0000, 0x0000, 0x0000, 0x02ca, 0x0000, 0x0000,
+	    0x02cf, 0x0000, 0x027e, 0x0000, 0x0000, 0x0000, 0x02d0, 0x0000,
+	    0x0000, 0x0000, 0x0712, 0x0000, 0x026c, 0x0310, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x07a2, 0x02bb, 0x0000, 0x0111, 0x053b,
+	    0x072f, 0x0660, 0x0000, 0x0000, 0x0535, 0x0000, 0x008d, 0x0000,
+	    0x0000,
+	};
+	uint16_t h[4];
+
+	_fixedhash(a, b, (uint64_t*)h);
+
+	h[0] = h[0] % 4001;
+	h[1] = h[1] % 4001;
+	result = (g[h[0]] + g[h[1]]) % 2000;
+	return (_fixed_le(hash_keys[result] + 0, 8) == a &&
+	    _fixed_le(hash_keys[result] + 8, 4) == b) ? result : (uint16_t)-1;
+}
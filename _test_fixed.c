@@ -0,0 +1,2557 @@
+/* generated with rurban/nbperf 08a5797  -B 16 _uuids */
+/* seed[0]: 1804289383, seed[1]: 846930886 */
+#include <stdint.h>
+
+static inline uint64_t _inthash64(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return x ^ (x >> 31);
+}
+
+#include <string.h>
+
+static inline uint64_t
+_fixed_le(const uint8_t *p, unsigned n)
+{
+	uint64_t v = 0;
+
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	memcpy(&v, p, n);
+#else
+	while (n--)
+		v = v << 8 | p[n];
+#endif
+	return v;
+}
+
+static inline void
+_fixedhash(const uint8_t key[16], uint64_t *h)
+{
+	uint64_t x = UINT64_C(0x327b23c66b8b4567);
+
+	x = _inthash64(x ^ _fixed_le(key + 0, 8));
+	x = _inthash64(x ^ _fixed_le(key + 8, 8));
+	h[0] = x;
+}
+
+#include <string.h>
+const uint8_t hash_keys[2000][16] = {
+	{ 0xb7, 0xdf, 0x77, 0x38, 0x00, 0xb8, 0x40, 0xb8, 0x85, 0x08, 0x00, 0x00, 0x00, 0x00, 0x84, 0x40 },
+	{ 0x3b, 0x07, 0xd2, 0x44, 0x03, 0x84, 0x43, 0x84, 0x88, 0x9c, 0x00, 0x00, 0x00, 0x0c, 0x5c, 0x10 },
+	{ 0x85, 0x3d, 0x36, 0x05, 0x02, 0x95, 0x42, 0x95, 0x82, 0x13, 0x00, 0x00, 0x00, 0x06, 0xaa, 0xb9 },
+	{ 0x6a, 0x7b, 0xe1, 0xb7, 0x03, 0xe7, 0x43, 0xe7, 0x8b, 0x51, 0x00, 0x00, 0x00, 0x0f, 0x3a, 0x71 },
+	{ 0xa6, 0x3d, 0x1b, 0x3e, 0x00, 0x9e, 0x40, 0x9e, 0x84, 0x52, 0x00, 0x00, 0x00, 0x00, 0x61, 0x84 },
+	{ 0xc3, 0xf0, 0xfc, 0x22, 0x04, 0xc2, 0x44, 0xc2, 0x81, 0x4e, 0x00, 0x00, 0x00, 0x16, 0xa3, 0x04 },
+	{ 0x6b, 0xf5, 0x28, 0x02, 0x06, 0xa2, 0x46, 0xa2, 0x8e, 0x6e, 0x00, 0x00, 0x00, 0x2b, 0xfe, 0x84 },
+	{ 0xd1, 0x39, 0xaa, 0x68, 0x02, 0xe8, 0x42, 0xe8, 0x84, 0x58, 0x00, 0x00, 0x00, 0x08, 0x72, 0x40 },
+	{ 0x8a, 0x32, 0x78, 0x67, 0x01, 0x97, 0x41, 0x97, 0x8b, 0x21, 0x00, 0x00, 0x00, 0x02, 0x87, 0x11 },
+	{ 0xdb, 0x84, 0x1e, 0xb0, 0x05, 0xb0, 0x45, 0xb0, 0x87, 0xd0, 0x00, 0x00, 0x00, 0x20, 0x59, 0x00 },
+	{ 0x66, 0x6f, 0xfe, 0x5a, 0x00, 0x7a, 0x40, 0x7a, 0x83, 0x56, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x24 },
+	{ 0x9d, 0xcb, 0xdc, 0xc5, 0x05, 0x55, 0x45, 0x55, 0x85, 0x53, 0x00, 0x00, 0x00, 0x1c, 0x6e, 0x39 },
+	{ 0x1a, 0x73, 0x89, 0xf7, 0x00, 0x27, 0x40, 0x27, 0x81, 0x11, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf1 },
+	{ 0xc6, 0x53, 0xa1, 0x72, 0x03, 0x12, 0x43, 0x12, 0x85, 0x7e, 0x00, 0x00, 0x00, 0x09, 0x6d, 0x44 },
+	{ 0x35, 0x17, 0x0b, 0xb0, 0x02, 0xb0, 0x42, 0xb0, 0x82, 0xd0, 0x00, 0x00, 0x00, 0x07, 0x39, 0x00 },
+	{ 0x5b, 0xb9, 0xed, 0x26, 0x03, 0x06, 0x43, 0x06, 0x85, 0x2a, 0x00, 0x00, 0x00, 0x09, 0x24, 0x24 },
+	{ 0x6a, 0x99, 0xb4, 0x4c, 0x00, 0x0c, 0x40, 0x0c, 0x80, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90 },
+	{ 0x10, 0x6b, 0x32, 0x9e, 0x05, 0xfe, 0x45, 0xfe, 0x89, 0xf2, 0x00, 0x00, 0x00, 0x23, 0xe8, 0x04 },
+	{ 0x56, 0x76, 0xe0, 0x6d, 0x05, 0x7d, 0x45, 0x7d, 0x86, 0x6b, 0x00, 0x00, 0x00, 0x1e, 0x1f, 0x09 },
+	{ 0x07, 0x3a, 0x15, 0x1d, 0x01, 0x2d, 0x41, 0x2d, 0x88, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x61, 0xe9 },
+	{ 0x5a, 0xa0, 0x96, 0x5f, 0x05, 0x0f, 0x45, 0x0f, 0x83, 0x69, 0x00, 0x00, 0x00, 0x19, 0x96, 0xe1 },
+	{ 0x8c, 0x59, 0x78, 0x8d, 0x07, 0x9d, 0x47, 0x9d, 0x85, 0x4b, 0x00, 0x00, 0x00, 0x39, 0xf6, 0x49 },
+	{ 0x9a, 0x3d, 0xbb, 0x81, 0x02, 0xd1, 0x42, 0xd1, 0x83, 0xb7, 0x00, 0x00, 0x00, 0x07, 0xee, 0xa1 },
+	{ 0x8c, 0xc5, 0x15, 0x79, 0x02, 0x49, 0x42, 0x49, 0x8f, 0xff, 0x00, 0x00, 0x00, 0x05, 0x38, 0xd1 },
+	{ 0x96, 0x43, 0xfd, 0x51, 0x05, 0xa1, 0x45, 0xa1, 0x87, 0x67, 0x00, 0x00, 0x00, 0x1f, 0xaf, 0x41 },
+	{ 0x7b, 0x04, 0xe6, 0xea, 0x06, 0x0a, 0x46, 0x0a, 0x8a, 0x46, 0x00, 0x00, 0x00, 0x24, 0x78, 0x64 },
+	{ 0x1a, 0x25, 0xbf, 0xa0, 0x01, 0xa0, 0x41, 0xa0, 0x8b, 0x60, 0x00, 0x00, 0x00, 0x02, 0xa4, 0x00 },
+	{ 0x09, 0x7e, 0xe7, 0xd8, 0x03, 0x58, 0x43, 0x58, 0x87, 0x68, 0x00, 0x00, 0x00, 0x0b, 0x2e, 0x40 },
+	{ 0x5a, 0x40, 0xa6, 0xdb, 0x00, 0x4b, 0x40, 0x4b, 0x82, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x15, 0xf9 },
+	{ 0x0a, 0x98, 0x3e, 0x9f, 0x01, 0x4f, 0x41, 0x4f, 0x89, 0x29, 0x00, 0x00, 0x00, 0x01, 0xb6, 0x61 },
+	{ 0xef, 0x0b, 0x5d, 0xe1, 0x03, 0x31, 0x43, 0x31, 0x86, 0x57, 0x00, 0x00, 0x00, 0x0a, 0x2f, 0x61 },
+	{ 0x46, 0x6b, 0x9d, 0x53, 0x04, 0x43, 0x44, 0x43, 0x8d, 0xd5, 0x00, 0x00, 0x00, 0x12, 0x29, 0x89 },
+	{ 0x76, 0xdb, 0x30, 0xf8, 0x06, 0x78, 0x46, 0x78, 0x8d, 0x48, 0x00, 0x00, 0x00, 0x29, 0xd8, 0x40 },
+	{ 0xf1, 0x80, 0x28, 0x5e, 0x07, 0xbe, 0x47, 0xbe, 0x86, 0x32, 0x00, 0x00, 0x00, 0x3b, 0xf1, 0x04 },
+	{ 0xd9, 0xed, 0x05, 0xd0, 0x06, 0xd0, 0x46, 0xd0, 0x8f, 0xb0, 0x00, 0x00, 0x00, 0x2e, 0x69, 0x00 },
+	{ 0x98, 0xd6, 0x9a, 0x63, 0x06, 0x53, 0x46, 0x53, 0x8c, 0x45, 0x00, 0x00, 0x00, 0x27, 0xfe, 0xe9 },
+	{ 0x97, 0xf8, 0xe8, 0xc6, 0x00, 0xa6, 0x40, 0xa6, 0x84, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xa4 },
+	{ 0x45, 0x40, 0x21, 0x5f, 0x00, 0x0f, 0x40, 0x0f, 0x80, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1 },
+	{ 0x4c, 0xaa, 0x2e, 0x3e, 0x03, 0x9e, 0x43, 0x9e, 0x89, 0x52, 0x00, 0x00, 0x00, 0x0d, 0x15, 0x84 },
+	{ 0x76, 0x7b, 0x41, 0x74, 0x01, 0xb4, 0x41, 0xb4, 0x8b, 0xec, 0x00, 0x00, 0x00, 0x02, 0xe6, 0x90 },
+	{ 0x31, 0x9b, 0x0f, 0x99, 0x06, 0x69, 0x46, 0x69, 0x8c, 0xdf, 0x00, 0x00, 0x00, 0x29, 0x17, 0x11 },
+	{ 0x14, 0xe2, 0xb2, 0xe7, 0x04, 0x17, 0x44, 0x17, 0x8c, 0xa1, 0x00, 0x00, 0x00, 0x10, 0xba, 0x11 },
+	{ 0x2d, 0xbf, 0x23, 0xfe, 0x05, 0x5e, 0x45, 0x5e, 0x85, 0x92, 0x00, 0x00, 0x00, 0x1c, 0xce, 0x84 },
+	{ 0x75, 0x14, 0x20, 0x56, 0x05, 0x36, 0x45, 0x36, 0x84, 0x7a, 0x00, 0x00, 0x00, 0x1b, 0x27, 0x64 },
+	{ 0x0a, 0xf8, 0x2e, 0x23, 0x06, 0x13, 0x46, 0x13, 0x8a, 0x85, 0x00, 0x00, 0x00, 0x24, 0xe5, 0x69 },
+	{ 0x3f, 0x31, 0x88, 0x36, 0x03, 0x16, 0x43, 0x16, 0x85, 0x9a, 0x00, 0x00, 0x00, 0x09, 0x85, 0xe4 },
+	{ 0xf4, 0x60, 0x8f, 0xc7, 0x06, 0xf7, 0x46, 0xf7, 0x80, 0xc1, 0x00, 0x00, 0x00, 0x30, 0x82, 0x51 },
+	{ 0xaa, 0x66, 0xd1, 0x30, 0x00, 0x30, 0x40, 0x30, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00 },
+	{ 0x60, 0xaf, 0x2f, 0x88, 0x02, 0x08, 0x42, 0x08, 0x8e, 0x38, 0x00, 0x00, 0x00, 0x04, 0x20, 0x40 },
+	{ 0xa8, 0x51, 0xf6, 0x37, 0x00, 0x67, 0x40, 0x67, 0x82, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x29, 0x71 },
+	{ 0xf3, 0x17, 0x41, 0x3e, 0x06, 0x9e, 0x46, 0x9e, 0x8e, 0x52, 0x00, 0x00, 0x00, 0x2b, 0xc9, 0x84 },
+	{ 0xd3, 0x1e, 0x8d, 0x9f, 0x00, 0x4f, 0x40, 0x4f, 0x82, 0x29, 0x00, 0x00, 0x00, 0x00, 0x18, 0x61 },
+	{ 0x53, 0x84, 0x53, 0xd7, 0x00, 0x07, 0x40, 0x07, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31 },
+	{ 0x0c, 0x41, 0x7c, 0xac, 0x06, 0x6c, 0x46, 0x6c, 0x8c, 0xf4, 0x00, 0x00, 0x00, 0x29, 0x3d, 0x90 },
+	{ 0xa0, 0xac, 0x44, 0x2e, 0x04, 0x8e, 0x44, 0x8e, 0x8f, 0xe2, 0x00, 0x00, 0x00, 0x14, 0xbe, 0xc4 },
+	{ 0xf0, 0xf0, 0x41, 0x18, 0x00, 0x98, 0x40, 0x98, 0x84, 0x28, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x40 },
+	{ 0x14, 0x64, 0xf0, 0xce, 0x03, 0x2e, 0x43, 0x2e, 0x86, 0x42, 0x00, 0x00, 0x00, 0x0a, 0x1c, 0x44 },
+	{ 0x8b, 0xdb, 0xb6, 0x74, 0x06, 0xb4, 0x46, 0xb4, 0x8e, 0xec, 0x00, 0x00, 0x00, 0x2c, 0xee, 0x90 },
+	{ 0xf0, 0xa2, 0x76, 0xc1, 0x02, 0x11, 0x42, 0x11, 0x8e, 0x77, 0x00, 0x00, 0x00, 0x04, 0x45, 0x21 },
+	{ 0x27, 0x80, 0x93, 0x13, 0x06, 0x03, 0x46, 0x03, 0x8a, 0x15, 0x00, 0x00, 0x00, 0x24, 0x24, 0x09 },
+	{ 0x82, 0xda, 0x90, 0xb5, 0x04, 0x45, 0x44, 0x45, 0x8d, 0xe3, 0x00, 0x00, 0x00, 0x12, 0x3a, 0x99 },
+	{ 0x83, 0xd6, 0x14, 0xe7, 0x06, 0x17, 0x46, 0x17, 0x8a, 0xa1, 0x00, 0x00, 0x00, 0x25, 0x16, 0x11 },
+	{ 0x21, 0xbf, 0xc4, 0x41, 0x07, 0x91, 0x47, 0x91, 0x84, 0xf7, 0x00, 0x00, 0x00, 0x39, 0x40, 0x21 },
+	{ 0x02, 0xf2, 0x8c, 0x96, 0x05, 0x76, 0x45, 0x76, 0x86, 0x3a, 0x00, 0x00, 0x00, 0x1d, 0xd2, 0x64 },
+	{ 0x3d, 0x9a, 0x6f, 0x56, 0x04, 0x36, 0x44, 0x36, 0x8d, 0x7a, 0x00, 0x00, 0x00, 0x11, 0xbb, 0x64 },
+	{ 0xda, 0x58, 0xa2, 0xbc, 0x01, 0x7c, 0x41, 0x7c, 0x8a, 0x64, 0x00, 0x00, 0x00, 0x02, 0x34, 0x10 },
+	{ 0x65, 0x38, 0xd4, 0xfe, 0x06, 0x5e, 0x46, 0x5e, 0x8c, 0x92, 0x00, 0x00, 0x00, 0x28, 0x8a, 0x84 },
+	{ 0x45, 0x22, 0x4e, 0xca, 0x03, 0xea, 0x43, 0xea, 0x8b, 0x66, 0x00, 0x00, 0x00, 0x0f, 0x51, 0xe4 },
+	{ 0xdf, 0xdd, 0xcc, 0x64, 0x07, 0xa4, 0x47, 0xa4, 0x85, 0x7c, 0x00, 0x00, 0x00, 0x3a, 0x61, 0x10 },
+	{ 0xd9, 0x21, 0x79, 0x60, 0x07, 0x60, 0x47, 0x60, 0x83, 0xa0, 0x00, 0x00, 0x00, 0x36, 0x64, 0x00 },
+	{ 0x9a, 0x8b, 0x85, 0xd8, 0x01, 0x58, 0x41, 0x58, 0x89, 0x68, 0x00, 0x00, 0x00, 0x01, 0xce, 0x40 },
+	{ 0x05, 0x25, 0x3a, 0x24, 0x01, 0x64, 0x41, 0x64, 0x89, 0xbc, 0x00, 0x00, 0x00, 0x01, 0xef, 0x10 },
+	{ 0x54, 0x14, 0x3b, 0x1d, 0x07, 0x2d, 0x47, 0x2d, 0x82, 0x3b, 0x00, 0x00, 0x00, 0x33, 0x7d, 0xe9 },
+	{ 0x00, 0xfb, 0x84, 0x32, 0x01, 0xd2, 0x41, 0xd2, 0x8c, 0xbe, 0x00, 0x00, 0x00, 0x03, 0x50, 0x44 },
+	{ 0x05, 0x85, 0x29, 0xa8, 0x06, 0x28, 0x46, 0x28, 0x8b, 0x18, 0x00, 0x00, 0x00, 0x25, 0xe6, 0x40 },
+	{ 0x6d, 0xda, 0x0b, 0x39, 0x04, 0x09, 0x44, 0x09, 0x8c, 0x3f, 0x00, 0x00, 0x00, 0x10, 0x48, 0x51 },
+	{ 0x72, 0xb1, 0x7b, 0x06, 0x06, 0xe6, 0x46, 0xe6, 0x80, 0x4a, 0x00, 0x00, 0x00, 0x2f, 0x96, 0xa4 },
+	{ 0xaf, 0x3e, 0x40, 0xfd, 0x03, 0x0d, 0x43, 0x0d, 0x85, 0x5b, 0x00, 0x00, 0x00, 0x09, 0x4e, 0xa9 },
+	{ 0x0e, 0xf1, 0xec, 0x53, 0x03, 0x43, 0x43, 0x43, 0x86, 0xd5, 0x00, 0x00, 0x00, 0x0a, 0xa3, 0x89 },
+	{ 0x6b, 0x17, 0x76, 0x65, 0x00, 0xf5, 0x40, 0xf5, 0x86, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xea, 0x79 },
+	{ 0x80, 0xe3, 0x88, 0x51, 0x00, 0xa1, 0x40, 0xa1, 0x84, 0x67, 0x00, 0x00, 0x00, 0x00, 0x65, 0x41 },
+	{ 0x36, 0xde, 0x1c, 0x52, 0x03, 0xf2, 0x43, 0xf2, 0x8b, 0x9e, 0x00, 0x00, 0x00, 0x0f, 0x90, 0xc4 },
+	{ 0x3b, 0xb5, 0x8c, 0x1f, 0x06, 0xcf, 0x46, 0xcf, 0x8f, 0xa9, 0x00, 0x00, 0x00, 0x2e, 0x5b, 0x61 },
+	{ 0x69, 0x62, 0x8a, 0xf0, 0x05, 0xf0, 0x45, 0xf0, 0x89, 0x90, 0x00, 0x00, 0x00, 0x23, 0x41, 0x00 },
+	{ 0xde, 0x82, 0x58, 0xae, 0x01, 0x0e, 0x41, 0x0e, 0x87, 0x62, 0x00, 0x00, 0x00, 0x01, 0x1c, 0xc4 },
+	{ 0x06, 0x6e, 0x88, 0xad, 0x01, 0xbd, 0x41, 0xbd, 0x8c, 0x2b, 0x00, 0x00, 0x00, 0x03, 0x05, 0x89 },
+	{ 0xc8, 0x4a, 0xa9, 0xd6, 0x06, 0xb6, 0x46, 0xb6, 0x8e, 0xfa, 0x00, 0x00, 0x00, 0x2d, 0x09, 0x64 },
+	{ 0x49, 0xe7, 0x99, 0x6a, 0x00, 0x8a, 0x40, 0x8a, 0x83, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x64 },
+	{ 0xc5, 0x88, 0x15, 0x02, 0x03, 0xa2, 0x43, 0xa2, 0x89, 0x6e, 0x00, 0x00, 0x00, 0x0d, 0x32, 0x84 },
+	{ 0xdd, 0x69, 0x01, 0xe7, 0x03, 0x17, 0x43, 0x17, 0x85, 0xa1, 0x00, 0x00, 0x00, 0x09, 0x8c, 0x11 },
+	{ 0x12, 0x02, 0x4b, 0x7e, 0x04, 0xde, 0x44, 0xde, 0x82, 0x12, 0x00, 0x00, 0x00, 0x17, 0xb0, 0x84 },
+	{ 0x57, 0x90, 0x37, 0x34, 0x03, 0x74, 0x43, 0x74, 0x88, 0x2c, 0x00, 0x00, 0x00, 0x0b, 0xec, 0x90 },
+	{ 0x39, 0xa0, 0xb1, 0x26, 0x07, 0x06, 0x47, 0x06, 0x81, 0x2a, 0x00, 0x00, 0x00, 0x31, 0x54, 0x24 },
+	{ 0xf2, 0x99, 0x7f, 0x25, 0x05, 0xb5, 0x45, 0xb5, 0x87, 0xf3, 0x00, 0x00, 0x00, 0x20, 0x91, 0xf9 },
+	{ 0x67, 0x4d, 0xaf, 0xf7, 0x06, 0x27, 0x46, 0x27, 0x8b, 0x11, 0x00, 0x00, 0x00, 0x25, 0xd9, 0xf1 },
+	{ 0x33, 0x32, 0x28, 0x79, 0x05, 0x49, 0x45, 0x49, 0x84, 0xff, 0x00, 0x00, 0x00, 0x1b, 0xee, 0xd1 },
+	{ 0x48, 0x02, 0xb6, 0x33, 0x03, 0x23, 0x43, 0x23, 0x85, 0xf5, 0x00, 0x00, 0x00, 0x09, 0xd6, 0xc9 },
+	{ 0xb7, 0x91, 0xac, 0xe1, 0x02, 0x31, 0x42, 0x31, 0x8f, 0x57, 0x00, 0x00, 0x00, 0x04, 0xcd, 0x61 },
+	{ 0x2c, 0xc3, 0x9f, 0xcc, 0x03, 0x8c, 0x43, 0x8c, 0x88, 0xd4, 0x00, 0x00, 0x00, 0x0c, 0x94, 0x90 },
+	{ 0xfa, 0x6f, 0x28, 0xf0, 0x03, 0xf0, 0x43, 0xf0, 0x8b, 0x90, 0x00, 0x00, 0x00, 0x0f, 0x81, 0x00 },
+	{ 0xc1, 0x8e, 0x56, 0xd2, 0x06, 0x72, 0x46, 0x72, 0x8d, 0x1e, 0x00, 0x00, 0x00, 0x29, 0x8a, 0xc4 },
+	{ 0x32, 0x18, 0xd1, 0xb2, 0x07, 0x52, 0x47, 0x52, 0x83, 0x3e, 0x00, 0x00, 0x00, 0x35, 0x96, 0x44 },
+	{ 0xd1, 0x69, 0xa2, 0x2a, 0x05, 0x4a, 0x45, 0x4a, 0x85, 0x06, 0x00, 0x00, 0x00, 0x1b, 0xf9, 0x64 },
+	{ 0xe4, 0x55, 0x4c, 0xad, 0x05, 0xbd, 0x45, 0xbd, 0x88, 0x2b, 0x00, 0x00, 0x00, 0x20, 0xed, 0x89 },
+	{ 0x0e, 0xd4, 0x19, 0xbe, 0x07, 0x1e, 0x47, 0x1e, 0x81, 0xd2, 0x00, 0x00, 0x00, 0x32, 0xa7, 0x84 },
+	{ 0x5c, 0x07, 0xb7, 0x7d, 0x01, 0x8d, 0x41, 0x8d, 0x8a, 0xdb, 0x00, 0x00, 0x00, 0x02, 0x67, 0xa9 },
+	{ 0x9c, 0x82, 0x8e, 0x3c, 0x04, 0xfc, 0x44, 0xfc, 0x82, 0xe4, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x10 },
+	{ 0xc9, 0xb1, 0xca, 0xf4, 0x03, 0x34, 0x43, 0x34, 0x86, 0x6c, 0x00, 0x00, 0x00, 0x0a, 0x42, 0x90 },
+	{ 0x6a, 0x5e, 0x0f, 0x22, 0x07, 0xc2, 0x47, 0xc2, 0x86, 0x4e, 0x00, 0x00, 0x00, 0x3c, 0x2f, 0x04 },
+	{ 0x99, 0xef, 0xf1, 0x2a, 0x04, 0x4a, 0x44, 0x4a, 0x8e, 0x06, 0x00, 0x00, 0x00, 0x12, 0x65, 0x64 },
+	{ 0x3c, 0x03, 0x56, 0x76, 0x05, 0x56, 0x45, 0x56, 0x85, 0x5a, 0x00, 0x00, 0x00, 0x1c, 0x78, 0xe4 },
+	{ 0x90, 0x23, 0x3e, 0xfb, 0x02, 0x6b, 0x42, 0x6b, 0x80, 0xed, 0x00, 0x00, 0x00, 0x05, 0xd8, 0xb9 },
+	{ 0x24, 0x8e, 0x06, 0x7d, 0x00, 0x8d, 0x40, 0x8d, 0x83, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xa9 },
+	{ 0x07, 0x4c, 0x3a, 0x4a, 0x07, 0x6a, 0x47, 0x6a, 0x83, 0xe6, 0x00, 0x00, 0x00, 0x36, 0xf7, 0xe4 },
+	{ 0x91, 0x9c, 0x85, 0x46, 0x05, 0x26, 0x45, 0x26, 0x84, 0x0a, 0x00, 0x00, 0x00, 0x1a, 0x81, 0xa4 },
+	{ 0xc0, 0xe0, 0x9c, 0xf7, 0x03, 0x27, 0x43, 0x27, 0x86, 0x11, 0x00, 0x00, 0x00, 0x09, 0xef, 0xf1 },
+	{ 0x6e, 0xa5, 0x97, 0xa9, 0x03, 0x79, 0x43, 0x79, 0x88, 0x4f, 0x00, 0x00, 0x00, 0x0c, 0x0f, 0x31 },
+	{ 0x08, 0xb3, 0x5b, 0x68, 0x03, 0xe8, 0x43, 0xe8, 0x8b, 0x58, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x40 },
+	{ 0x32, 0xd2, 0x38, 0xf5, 0x00, 0x85, 0x40, 0x85, 0x83, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x45, 0x19 },
+	{ 0x2a, 0x7e, 0xcd, 0x11, 0x01, 0x61, 0x41, 0x61, 0x89, 0xa7, 0x00, 0x00, 0x00, 0x01, 0xe6, 0xc1 },
+	{ 0xbc, 0x86, 0xef, 0x43, 0x01, 0x33, 0x41, 0x33, 0x88, 0x65, 0x00, 0x00, 0x00, 0x01, 0x70, 0x29 },
+	{ 0x6e, 0x75, 0x9f, 0xe7, 0x01, 0x17, 0x41, 0x17, 0x87, 0xa1, 0x00, 0x00, 0x00, 0x01, 0x30, 0x11 },
+	{ 0x79, 0x0d, 0xde, 0x86, 0x02, 0x66, 0x42, 0x66, 0x80, 0xca, 0x00, 0x00, 0x00, 0x05, 0xc0, 0xa4 },
+	{ 0x83, 0xa6, 0x1d, 0x25, 0x03, 0xb5, 0x43, 0xb5, 0x89, 0xf3, 0x00, 0x00, 0x00, 0x0d, 0xbd, 0xf9 },
+	{ 0x7f, 0xfa, 0x29, 0x4c, 0x05, 0x0c, 0x45, 0x0c, 0x83, 0x54, 0x00, 0x00, 0x00, 0x19, 0x78, 0x90 },
+	{ 0x2f, 0xf1, 0xd1, 0x8c, 0x01, 0x4c, 0x41, 0x4c, 0x89, 0x14, 0x00, 0x00, 0x00, 0x01, 0xae, 0x90 },
+	{ 0x6b, 0xe3, 0x02, 0xd5, 0x00, 0x65, 0x40, 0x65, 0x82, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x27, 0xd9 },
+	{ 0x55, 0x7b, 0x5c, 0x3b, 0x03, 0xab, 0x43, 0xab, 0x89, 0xad, 0x00, 0x00, 0x00, 0x0d, 0x74, 0x39 },
+	{ 0x17, 0x75, 0x4f, 0xf9, 0x04, 0xc9, 0x44, 0xc9, 0x81, 0x7f, 0x00, 0x00, 0x00, 0x16, 0xe5, 0xd1 },
+	{ 0x57, 0x42, 0x6c, 0xdd, 0x04, 0xed, 0x44, 0xed, 0x82, 0x7b, 0x00, 0x00, 0x00, 0x18, 0x43, 0x69 },
+	{ 0x43, 0xbb, 0x2d, 0xac, 0x07, 0x6c, 0x47, 0x6c, 0x83, 0xf4, 0x00, 0x00, 0x00, 0x37, 0x15, 0x90 },
+	{ 0xd4, 0x4a, 0x09, 0x93, 0x04, 0x83, 0x44, 0x83, 0x8f, 0x95, 0x00, 0x00, 0x00, 0x14, 0x5b, 0x09 },
+	{ 0xfe, 0x7b, 0x0c, 0x4d, 0x07, 0x5d, 0x47, 0x5d, 0x83, 0x8b, 0x00, 0x00, 0x00, 0x36, 0x37, 0xc9 },
+	{ 0x94, 0x2f, 0x22, 0x58, 0x05, 0xd8, 0x45, 0xd8, 0x88, 0xe8, 0x00, 0x00, 0x00, 0x22, 0x26, 0x40 },
+	{ 0x76, 0xf9, 0x03, 0x8d, 0x02, 0x9d, 0x42, 0x9d, 0x82, 0x4b, 0x00, 0x00, 0x00, 0x06, 0xd4, 0x49 },
+	{ 0xb3, 0x37, 0xff, 0x2d, 0x00, 0x3d, 0x40, 0x3d, 0x81, 0xab, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x89 },
+	{ 0x4a, 0x95, 0x53, 0x45, 0x03, 0xd5, 0x43, 0xd5, 0x8a, 0xd3, 0x00, 0x00, 0x00, 0x0e, 0xaf, 0x39 },
+	{ 0x65, 0xb6, 0x97, 0x17, 0x07, 0x47, 0x47, 0x47, 0x82, 0xf1, 0x00, 0x00, 0x00, 0x34, 0xf5, 0xb1 },
+	{ 0x1f, 0x98, 0xc4, 0x1b, 0x01, 0x8b, 0x41, 0x8b, 0x8a, 0xcd, 0x00, 0x00, 0x00, 0x02, 0x61, 0x79 },
+	{ 0xa2, 0x13, 0x65, 0x4c, 0x01, 0x0c, 0x41, 0x0c, 0x87, 0x54, 0x00, 0x00, 0x00, 0x01, 0x18, 0x90 },
+	{ 0x0f, 0xed, 0x70, 0x85, 0x05, 0x15, 0x45, 0x15, 0x83, 0x93, 0x00, 0x00, 0x00, 0x19, 0xd3, 0xb9 },
+	{ 0x71, 0x85, 0xff, 0x12, 0x02, 0xb2, 0x42, 0xb2, 0x82, 0xde, 0x00, 0x00, 0x00, 0x07, 0x43, 0xc4 },
+	{ 0xa5, 0x53, 0xbc, 0x39, 0x05, 0x09, 0x45, 0x09, 0x83, 0x3f, 0x00, 0x00, 0x00, 0x19, 0x5a, 0x51 },
+	{ 0xe7, 0x05, 0xbc, 0x54, 0x02, 0x94, 0x42, 0x94, 0x82, 0x0c, 0x00, 0x00, 0x00, 0x06, 0xa5, 0x90 },
+	{ 0x19, 0xba, 0x22, 0xb4, 0x06, 0xf4, 0x46, 0xf4, 0x80, 0xac, 0x00, 0x00, 0x00, 0x30, 0x58, 0x90 },
+	{ 0x55, 0xc9, 0x26, 0x92, 0x02, 0x32, 0x42, 0x32, 0x8f, 0x5e, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xc4 },
+	{ 0xff, 0x16, 0xa0, 0xfb, 0x04, 0x6b, 0x44, 0x6b, 0x8e, 0xed, 0x00, 0x00, 0x00, 0x13, 0x84, 0xb9 },
+	{ 0x15, 0x12, 0xaa, 0xa9, 0x06, 0x79, 0x46, 0x79, 0x8d, 0x4f, 0x00, 0x00, 0x00, 0x29, 0xe5, 0x31 },
+	{ 0x1b, 0x51, 0x3b, 0x94, 0x05, 0xd4, 0x45, 0xd4, 0x88, 0xcc, 0x00, 0x00, 0x00, 0x21, 0xf7, 0x90 },
+	{ 0x26, 0x85, 0x0e, 0xe1, 0x04, 0x31, 0x44, 0x31, 0x8d, 0x57, 0x00, 0x00, 0x00, 0x11, 0x91, 0x61 },
+	{ 0xca, 0x5f, 0x84, 0xcf, 0x06, 0x7f, 0x46, 0x7f, 0x8d, 0x79, 0x00, 0x00, 0x00, 0x2a, 0x33, 0x01 },
+	{ 0xbc, 0x69, 0x1c, 0xae, 0x05, 0x0e, 0x45, 0x0e, 0x83, 0x62, 0x00, 0x00, 0x00, 0x19, 0x8c, 0xc4 },
+	{ 0xd4, 0xf7, 0xc3, 0x6e, 0x07, 0xce, 0x47, 0xce, 0x86, 0xa2, 0x00, 0x00, 0x00, 0x3c, 0xe9, 0xc4 },
+	{ 0xfa, 0x9f, 0x20, 0xb2, 0x06, 0x52, 0x46, 0x52, 0x8c, 0x3e, 0x00, 0x00, 0x00, 0x27, 0xf2, 0x44 },
+	{ 0xc6, 0x35, 0xce, 0xdd, 0x06, 0xed, 0x46, 0xed, 0x80, 0x7b, 0x00, 0x00, 0x00, 0x2f, 0xf7, 0x69 },
+	{ 0x5b, 0x9c, 0x1a, 0x91, 0x06, 0xe1, 0x46, 0xe1, 0x80, 0x27, 0x00, 0x00, 0x00, 0x2f, 0x51, 0xc1 },
+	{ 0x60, 0x91, 0x5c, 0xf3, 0x05, 0xe3, 0x45, 0xe3, 0x89, 0x35, 0x00, 0x00, 0x00, 0x22, 0xa7, 0x49 },
+	{ 0x4d, 0x45, 0xc2, 0xec, 0x00, 0xac, 0x40, 0xac, 0x84, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x73, 0x90 },
+	{ 0x2d, 0xef, 0x1b, 0xc0, 0x07, 0xc0, 0x47, 0xc0, 0x86, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x10, 0x00 },
+	{ 0xdf, 0xcb, 0xa7, 0x37, 0x01, 0x67, 0x41, 0x67, 0x89, 0xd1, 0x00, 0x00, 0x00, 0x01, 0xf7, 0x71 },
+	{ 0x2b, 0xc8, 0x1b, 0x9a, 0x01, 0xba, 0x41, 0xba, 0x8c, 0x16, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x24 },
+	{ 0xbf, 0x79, 0x7b, 0xd9, 0x06, 0xa9, 0x46, 0xa9, 0x8e, 0x9f, 0x00, 0x00, 0x00, 0x2c, 0x5b, 0x91 },
+	{ 0x20, 0xe2, 0x12, 0xa4, 0x01, 0xe4, 0x41, 0xe4, 0x8d, 0x3c, 0x00, 0x00, 0x00, 0x03, 0x93, 0x10 },
+	{ 0xaa, 0x78, 0xf6, 0x5d, 0x06, 0x6d, 0x46, 0x6d, 0x8c, 0xfb, 0x00, 0x00, 0x00, 0x29, 0x4a, 0x69 },
+	{ 0x4f, 0x3c, 0xcb, 0x50, 0x04, 0x50, 0x44, 0x50, 0x8e, 0x30, 0x00, 0x00, 0x00, 0x12, 0x99, 0x00 },
+	{ 0xe0, 0xc7, 0x2b, 0x69, 0x03, 0x39, 0x43, 0x39, 0x86, 0x8f, 0x00, 0x00, 0x00, 0x0a, 0x62, 0xb1 },
+	{ 0x69, 0x02, 0x9b, 0x6c, 0x01, 0x2c, 0x41, 0x2c, 0x88, 0x34, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x90 },
+	{ 0xd2, 0x05, 0x36, 0xd8, 0x02, 0x58, 0x42, 0x58, 0x80, 0x68, 0x00, 0x00, 0x00, 0x05, 0x7e, 0x40 },
+	{ 0x34, 0x2d, 0xac, 0xab, 0x07, 0x1b, 0x47, 0x1b, 0x81, 0xbd, 0x00, 0x00, 0x00, 0x32, 0x7c, 0xd9 },
+	{ 0xd8, 0xf1, 0x81, 0x9e, 0x04, 0xfe, 0x44, 0xfe, 0x82, 0xf2, 0x00, 0x00, 0x00, 0x18, 0xec, 0x04 },
+	{ 0x0e, 0x56, 0x57, 0xa5, 0x06, 0x35, 0x46, 0x35, 0x8b, 0x73, 0x00, 0x00, 0x00, 0x26, 0x86, 0xf9 },
+	{ 0xd7, 0x0c, 0x9e, 0x67, 0x07, 0x97, 0x47, 0x97, 0x85, 0x21, 0x00, 0x00, 0x00, 0x39, 0x9b, 0x11 },
+	{ 0x82, 0x0f, 0x04, 0x45, 0x04, 0xd5, 0x44, 0xd5, 0x81, 0xd3, 0x00, 0x00, 0x00, 0x17, 0x59, 0x39 },
+	{ 0x6d, 0x3e, 0x76, 0x8b, 0x06, 0xfb, 0x46, 0xfb, 0x80, 0xdd, 0x00, 0x00, 0x00, 0x30, 0xba, 0x19 },
+	{ 0xc2, 0x0c, 0x18, 0xeb, 0x07, 0x5b, 0x47, 0x5b, 0x83, 0x7d, 0x00, 0x00, 0x00, 0x36, 0x1a, 0x59 },
+	{ 0xb5, 0xac, 0xc9, 0xaa, 0x04, 0xca, 0x44, 0xca, 0x81, 0x86, 0x00, 0x00, 0x00, 0x16, 0xef, 0x64 },
+	{ 0x42, 0x41, 0xe7, 0x61, 0x04, 0xb1, 0x44, 0xb1, 0x80, 0xd7, 0x00, 0x00, 0x00, 0x16, 0x02, 0x61 },
+	{ 0x43, 0xa9, 0x08, 0x7f, 0x01, 0x2f, 0x41, 0x2f, 0x88, 0x49, 0x00, 0x00, 0x00, 0x01, 0x66, 0xa1 },
+	{ 0xaf, 0xd9, 0xd5, 0xab, 0x00, 0x1b, 0x40, 0x1b, 0x80, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd9 },
+	{ 0x9d, 0x1e, 0x22, 0xea, 0x02, 0x0a, 0x42, 0x0a, 0x8e, 0x46, 0x00, 0x00, 0x00, 0x04, 0x28, 0x64 },
+	{ 0x44, 0xd4, 0x84, 0x73, 0x05, 0x63, 0x45, 0x63, 0x85, 0xb5, 0x00, 0x00, 0x00, 0x1d, 0x04, 0x49 },
+	{ 0x59, 0x09, 0x7d, 0x7f, 0x06, 0x2f, 0x46, 0x2f, 0x8b, 0x49, 0x00, 0x00, 0x00, 0x26, 0x3c, 0xa1 },
+	{ 0x75, 0x44, 0x18, 0x18, 0x07, 0x98, 0x47, 0x98, 0x85, 0x28, 0x00, 0x00, 0x00, 0x39, 0xaa, 0x40 },
+	{ 0xec, 0x2a, 0xf6, 0x78, 0x03, 0xf8, 0x43, 0xf8, 0x8b, 0xc8, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x40 },
+	{ 0x87, 0x34, 0x3e, 0x69, 0x06, 0x39, 0x46, 0x39, 0x8b, 0x8f, 0x00, 0x00, 0x00, 0x26, 0xb8, 0xb1 },
+	{ 0x62, 0xf4, 0x02, 0x43, 0x04, 0x33, 0x44, 0x33, 0x8d, 0x65, 0x00, 0x00, 0x00, 0x11, 0xa2, 0x29 },
+	{ 0x38, 0xd5, 0x24, 0xb6, 0x07, 0x96, 0x47, 0x96, 0x85, 0x1a, 0x00, 0x00, 0x00, 0x39, 0x8b, 0xe4 },
+	{ 0xc4, 0x3e, 0xc6, 0x79, 0x03, 0x49, 0x43, 0x49, 0x86, 0xff, 0x00, 0x00, 0x00, 0x0a, 0xca, 0xd1 },
+	{ 0x6e, 0x87, 0xc5, 0x14, 0x07, 0x54, 0x47, 0x54, 0x83, 0x4c, 0x00, 0x00, 0x00, 0x35, 0xb3, 0x90 },
+	{ 0xfa, 0xbc, 0xf3, 0x47, 0x02, 0x77, 0x42, 0x77, 0x81, 0x41, 0x00, 0x00, 0x00, 0x06, 0x13, 0x51 },
+	{ 0xf9, 0xc1, 0x6f, 0x15, 0x00, 0xa5, 0x40, 0xa5, 0x84, 0x83, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x59 },
+	{ 0xf5, 0x49, 0xee, 0xcc, 0x02, 0x8c, 0x42, 0x8c, 0x81, 0xd4, 0x00, 0x00, 0x00, 0x06, 0x7c, 0x90 },
+	{ 0x5f, 0xc5, 0xd0, 0x83, 0x06, 0x73, 0x46, 0x73, 0x8d, 0x25, 0x00, 0x00, 0x00, 0x29, 0x97, 0xa9 },
+	{ 0x53, 0x48, 0xae, 0xad, 0x07, 0xbd, 0x47, 0xbd, 0x86, 0x2b, 0x00, 0x00, 0x00, 0x3b, 0xe1, 0x89 },
+	{ 0x3d, 0xca, 0x67, 0x18, 0x06, 0x98, 0x46, 0x98, 0x8e, 0x28, 0x00, 0x00, 0x00, 0x2b, 0x7a, 0x40 },
+	{ 0x83, 0x58, 0x52, 0xce, 0x05, 0x2e, 0x45, 0x2e, 0x84, 0x42, 0x00, 0x00, 0x00, 0x1a, 0xd4, 0x44 },
+	{ 0x2a, 0x90, 0xf2, 0x3e, 0x07, 0x9e, 0x47, 0x9e, 0x85, 0x52, 0x00, 0x00, 0x00, 0x3a, 0x05, 0x84 },
+	{ 0xb3, 0x1a, 0x2c, 0x98, 0x04, 0x18, 0x44, 0x18, 0x8c, 0xa8, 0x00, 0x00, 0x00, 0x10, 0xc2, 0x40 },
+	{ 0xce, 0xd7, 0x05, 0x18, 0x04, 0x98, 0x44, 0x98, 0x80, 0x28, 0x00, 0x00, 0x00, 0x15, 0x1a, 0x40 },
+	{ 0x5a, 0xee, 0x60, 0xb6, 0x03, 0x96, 0x43, 0x96, 0x89, 0x1a, 0x00, 0x00, 0x00, 0x0c, 0xdb, 0xe4 },
+	{ 0x6b, 0x47, 0x6e, 0x27, 0x03, 0x57, 0x43, 0x57, 0x87, 0x61, 0x00, 0x00, 0x00, 0x0b, 0x27, 0x91 },
+	{ 0xef, 0x89, 0x1f, 0xfa, 0x04, 0x1a, 0x44, 0x1a, 0x8c, 0xb6, 0x00, 0x00, 0x00, 0x10, 0xd2, 0xa4 },
+	{ 0x15, 0x90, 0x6c, 0xc2, 0x07, 0x62, 0x47, 0x62, 0x83, 0xae, 0x00, 0x00, 0x00, 0x36, 0x81, 0x84 },
+	{ 0xf7, 0xbe, 0xb9, 0x49, 0x07, 0x19, 0x47, 0x19, 0x81, 0xaf, 0x00, 0x00, 0x00, 0x32, 0x60, 0x71 },
+	{ 0x9d, 0x4e, 0x1a, 0xac, 0x04, 0x6c, 0x44, 0x6c, 0x8e, 0xf4, 0x00, 0x00, 0x00, 0x13, 0x8d, 0x90 },
+	{ 0x2c, 0x93, 0xa8, 0x0a, 0x01, 0x2a, 0x41, 0x2a, 0x88, 0x26, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xe4 },
+	{ 0x30, 0xed, 0x55, 0xbe, 0x03, 0x1e, 0x43, 0x1e, 0x85, 0xd2, 0x00, 0x00, 0x00, 0x09, 0xb7, 0x84 },
+	{ 0x98, 0x28, 0xe0, 0x88, 0x03, 0x08, 0x43, 0x08, 0x85, 0x38, 0x00, 0x00, 0x00, 0x09, 0x30, 0x40 },
+	{ 0xa2, 0x73, 0x54, 0xd0, 0x05, 0xd0, 0x45, 0xd0, 0x88, 0xb0, 0x00, 0x00, 0x00, 0x21, 0xc9, 0x00 },
+	{ 0xdc, 0x4f, 0xab, 0x20, 0x05, 0x20, 0x45, 0x20, 0x83, 0xe0, 0x00, 0x00, 0x00, 0x1a, 0x44, 0x00 },
+	{ 0xe8, 0x4f, 0x0a, 0xdd, 0x02, 0xed, 0x42, 0xed, 0x84, 0x7b, 0x00, 0x00, 0x00, 0x08, 0x8f, 0x69 },
+	{ 0x91, 0x6c, 0x8d, 0x84, 0x02, 0xc4, 0x42, 0xc4, 0x83, 0x5c, 0x00, 0x00, 0x00, 0x07, 0xa6, 0x10 },
+	{ 0xd0, 0x6e, 0x1d, 0xf8, 0x03, 0x78, 0x43, 0x78, 0x88, 0x48, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x40 },
+	{ 0x17, 0xf3, 0x12, 0x12, 0x05, 0xb2, 0x45, 0xb2, 0x87, 0xde, 0x00, 0x00, 0x00, 0x20, 0x6f, 0xc4 },
+	{ 0x23, 0xd4, 0x9f, 0x3a, 0x07, 0x5a, 0x47, 0x5a, 0x83, 0x76, 0x00, 0x00, 0x00, 0x36, 0x0b, 0xa4 },
+	{ 0x43, 0x5b, 0x3e, 0x28, 0x02, 0xa8, 0x42, 0xa8, 0x82, 0x98, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x40 },
+	{ 0x56, 0x29, 0x16, 0x16, 0x06, 0xf6, 0x46, 0xf6, 0x80, 0xba, 0x00, 0x00, 0x00, 0x30, 0x74, 0x64 },
+	{ 0x10, 0x3b, 0x3a, 0xdc, 0x03, 0x9c, 0x43, 0x9c, 0x89, 0x44, 0x00, 0x00, 0x00, 0x0d, 0x07, 0x10 },
+	{ 0x95, 0xe4, 0x0d, 0xcd, 0x00, 0xdd, 0x40, 0xdd, 0x86, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xc9 },
+	{ 0xfd, 0x1f, 0x98, 0x97, 0x00, 0xc7, 0x40, 0xc7, 0x85, 0x71, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xb1 },
+	{ 0x92, 0x1a, 0x47, 0x5f, 0x06, 0x0f, 0x46, 0x0f, 0x8a, 0x69, 0x00, 0x00, 0x00, 0x24, 0xb4, 0xe1 },
+	{ 0x00, 0x5f, 0xef, 0x84, 0x04, 0xc4, 0x44, 0xc4, 0x81, 0x5c, 0x00, 0x00, 0x00, 0x16, 0xb6, 0x10 },
+	{ 0xd8, 0x91, 0x92, 0x1a, 0x00, 0x3a, 0x40, 0x3a, 0x81, 0x96, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x24 },
+	{ 0xf6, 0x15, 0x7b, 0x3c, 0x01, 0xfc, 0x41, 0xfc, 0x8d, 0xe4, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x10 },
+	{ 0xb5, 0x7c, 0xd1, 0xe8, 0x02, 0x68, 0x42, 0x68, 0x80, 0xd8, 0x00, 0x00, 0x00, 0x05, 0xca, 0x40 },
+	{ 0x45, 0xd0, 0x08, 0xa5, 0x07, 0x35, 0x47, 0x35, 0x82, 0x73, 0x00, 0x00, 0x00, 0x33, 0xf0, 0xf9 },
+	{ 0x70, 0xea, 0x6a, 0x64, 0x05, 0xa4, 0x45, 0xa4, 0x87, 0x7c, 0x00, 0x00, 0x00, 0x1f, 0xd1, 0x10 },
+	{ 0xa5, 0x23, 0xc4, 0x77, 0x02, 0xa7, 0x42, 0xa7, 0x82, 0x91, 0x00, 0x00, 0x00, 0x07, 0x08, 0xf1 },
+	{ 0x92, 0xe5, 0xd3, 0xcf, 0x05, 0x7f, 0x45, 0x7f, 0x86, 0x79, 0x00, 0x00, 0x00, 0x1e, 0x35, 0x01 },
+	{ 0x27, 0x50, 0x9b, 0x51, 0x03, 0xa1, 0x43, 0xa1, 0x89, 0x67, 0x00, 0x00, 0x00, 0x0d, 0x2b, 0x41 },
+	{ 0x77, 0x46, 0xcd, 0xe4, 0x01, 0x24, 0x41, 0x24, 0x87, 0xfc, 0x00, 0x00, 0x00, 0x01, 0x4d, 0x10 },
+	{ 0x66, 0xed, 0xc0, 0x73, 0x01, 0x63, 0x41, 0x63, 0x89, 0xb5, 0x00, 0x00, 0x00, 0x01, 0xec, 0x49 },
+	{ 0x12, 0xeb, 0xaa, 0x83, 0x00, 0x73, 0x40, 0x73, 0x83, 0x25, 0x00, 0x00, 0x00, 0x00, 0x33, 0xa9 },
+	{ 0xef, 0xb9, 0x17, 0xbc, 0x06, 0x7c, 0x46, 0x7c, 0x8d, 0x64, 0x00, 0x00, 0x00, 0x2a, 0x0c, 0x10 },
+	{ 0x7d, 0x19, 0xc1, 0xe3, 0x05, 0xd3, 0x45, 0xd3, 0x88, 0xc5, 0x00, 0x00, 0x00, 0x21, 0xeb, 0xe9 },
+	{ 0x09, 0xae, 0xdf, 0x9a, 0x05, 0xba, 0x45, 0xba, 0x88, 0x16, 0x00, 0x00, 0x00, 0x20, 0xcb, 0x24 },
+	{ 0x68, 0x96, 0xfe, 0x80, 0x06, 0x80, 0x46, 0x80, 0x8d, 0x80, 0x00, 0x00, 0x00, 0x2a, 0x40, 0x00 },
+	{ 0x7b, 0x22, 0xb9, 0x7f, 0x02, 0x2f, 0x42, 0x2f, 0x8f, 0x49, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xa1 },
+	{ 0x95, 0xf6, 0x32, 0xfa, 0x07, 0x1a, 0x47, 0x1a, 0x81, 0xb6, 0x00, 0x00, 0x00, 0x32, 0x6e, 0xa4 },
+	{ 0x56, 0xf4, 0xa2, 0x86, 0x06, 0x66, 0x46, 0x66, 0x8c, 0xca, 0x00, 0x00, 0x00, 0x28, 0xf0, 0xa4 },
+	{ 0x51, 0x6f, 0x78, 0xde, 0x00, 0x3e, 0x40, 0x3e, 0x81, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x04 },
+	{ 0x4e, 0xef, 0x00, 0xf9, 0x05, 0xc9, 0x45, 0xc9, 0x88, 0x7f, 0x00, 0x00, 0x00, 0x21, 0x77, 0xd1 },
+	{ 0xe8, 0xae, 0xfa, 0x61, 0x07, 0xb1, 0x47, 0xb1, 0x85, 0xd7, 0x00, 0x00, 0x00, 0x3b, 0x28, 0x61 },
+	{ 0x13, 0x1b, 0xa2, 0x45, 0x02, 0xd5, 0x42, 0xd5, 0x83, 0xd3, 0x00, 0x00, 0x00, 0x08, 0x05, 0x39 },
+	{ 0x95, 0x2a, 0xa6, 0x8a, 0x07, 0xaa, 0x47, 0xaa, 0x85, 0xa6, 0x00, 0x00, 0x00, 0x3a, 0xbc, 0xe4 },
+	{ 0x12, 0xfd, 0xcf, 0xb0, 0x06, 0xb0, 0x46, 0xb0, 0x8e, 0xd0, 0x00, 0x00, 0x00, 0x2c, 0xb9, 0x00 },
+	{ 0xc7, 0xcc, 0xe7, 0xbd, 0x05, 0xcd, 0x45, 0xcd, 0x88, 0x9b, 0x00, 0x00, 0x00, 0x21, 0xa6, 0x29 },
+	{ 0x6a, 0xf9, 0xa3, 0xd0, 0x04, 0xd0, 0x44, 0xd0, 0x81, 0xb0, 0x00, 0x00, 0x00, 0x17, 0x29, 0x00 },
+	{ 0x2a, 0xde, 0xbc, 0x95, 0x06, 0x25, 0x46, 0x25, 0x8b, 0x03, 0x00, 0x00, 0x00, 0x25, 0xc1, 0x59 },
+	{ 0x70, 0x1e, 0xdd, 0xf4, 0x06, 0x34, 0x46, 0x34, 0x8b, 0x6c, 0x00, 0x00, 0x00, 0x26, 0x7a, 0x90 },
+	{ 0xce, 0xf4, 0xd7, 0xad, 0x00, 0xbd, 0x40, 0xbd, 0x85, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x89 },
+	{ 0x99, 0xbf, 0xf9, 0x68, 0x01, 0xe8, 0x41, 0xe8, 0x8d, 0x58, 0x00, 0x00, 0x00, 0x03, 0xa2, 0x40 },
+	{ 0x5d, 0xb0, 0xf5, 0x8a, 0x06, 0xaa, 0x46, 0xaa, 0x8e, 0xa6, 0x00, 0x00, 0x00, 0x2c, 0x68, 0xe4 },
+	{ 0x45, 0x04, 0x7c, 0x35, 0x07, 0xc5, 0x47, 0xc5, 0x86, 0x63, 0x00, 0x00, 0x00, 0x3c, 0x5d, 0x99 },
+	{ 0x50, 0xd3, 0xe4, 0x30, 0x03, 0x30, 0x43, 0x30, 0x86, 0x50, 0x00, 0x00, 0x00, 0x0a, 0x29, 0x00 },
+	{ 0xf9, 0x55, 0xd2, 0x29, 0x05, 0xf9, 0x45, 0xf9, 0x89, 0xcf, 0x00, 0x00, 0x00, 0x23, 0xac, 0x31 },
+	{ 0x54, 0x02, 0x15, 0xf0, 0x00, 0xf0, 0x40, 0xf0, 0x86, 0x90, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x00 },
+	{ 0xe2, 0xdc, 0x06, 0x62, 0x03, 0x02, 0x43, 0x02, 0x85, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x04 },
+	{ 0xf8, 0x78, 0x20, 0x8c, 0x00, 0x4c, 0x40, 0x4c, 0x82, 0x14, 0x00, 0x00, 0x00, 0x00, 0x16, 0x90 },
+	{ 0x9f, 0x92, 0xed, 0x67, 0x06, 0x97, 0x46, 0x97, 0x8e, 0x21, 0x00, 0x00, 0x00, 0x2b, 0x6d, 0x11 },
+	{ 0x3a, 0x3c, 0x45, 0xd4, 0x04, 0x14, 0x44, 0x14, 0x8c, 0x8c, 0x00, 0x00, 0x00, 0x10, 0xa1, 0x90 },
+	{ 0x2c, 0x28, 0x0b, 0x1e, 0x06, 0x7e, 0x46, 0x7e, 0x8d, 0x72, 0x00, 0x00, 0x00, 0x2a, 0x26, 0x04 },
+	{ 0x10, 0x0b, 0x43, 0x1a, 0x01, 0x3a, 0x41, 0x3a, 0x88, 0x96, 0x00, 0x00, 0x00, 0x01, 0x81, 0x24 },
+	{ 0x03, 0x40, 0x56, 0xed, 0x03, 0xfd, 0x43, 0xfd, 0x8b, 0xeb, 0x00, 0x00, 0x00, 0x0f, 0xe8, 0x09 },
+	{ 0xa2, 0x91, 0x27, 0x65, 0x01, 0xf5, 0x41, 0xf5, 0x8d, 0xb3, 0x00, 0x00, 0x00, 0x03, 0xd4, 0x79 },
+	{ 0xc4, 0xec, 0x80, 0x54, 0x06, 0x94, 0x46, 0x94, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x2b, 0x45, 0x90 },
+	{ 0x3c, 0x51, 0x20, 0xcd, 0x03, 0xdd, 0x43, 0xdd, 0x8b, 0x0b, 0x00, 0x00, 0x00, 0x0e, 0xec, 0xc9 },
+	{ 0x0f, 0x8d, 0x81, 0x01, 0x00, 0x51, 0x40, 0x51, 0x82, 0x37, 0x00, 0x00, 0x00, 0x00, 0x19, 0xa1 },
+	{ 0x98, 0x88, 0xd0, 0x0c, 0x07, 0xcc, 0x47, 0xcc, 0x86, 0x94, 0x00, 0x00, 0x00, 0x3c, 0xca, 0x90 },
+	{ 0x2b, 0x5c, 0x7e, 0xae, 0x07, 0x0e, 0x47, 0x0e, 0x81, 0x62, 0x00, 0x00, 0x00, 0x31, 0xc4, 0xc4 },
+	{ 0x9c, 0xb2, 0x85, 0xfe, 0x07, 0x5e, 0x47, 0x5e, 0x83, 0x92, 0x00, 0x00, 0x00, 0x36, 0x46, 0x84 },
+	{ 0x14, 0x47, 0x1e, 0x39, 0x07, 0x09, 0x47, 0x09, 0x81, 0x3f, 0x00, 0x00, 0x00, 0x31, 0x7e, 0x51 },
+	{ 0xab, 0x92, 0x4d, 0x24, 0x04, 0x64, 0x44, 0x64, 0x8e, 0xbc, 0x00, 0x00, 0x00, 0x13, 0x47, 0x10 },
+	{ 0xbc, 0xb6, 0xe7, 0x05, 0x03, 0x95, 0x43, 0x95, 0x89, 0x13, 0x00, 0x00, 0x00, 0x0c, 0xd4, 0xb9 },
+	{ 0xea, 0x93, 0xdd, 0x98, 0x05, 0x18, 0x45, 0x18, 0x83, 0xa8, 0x00, 0x00, 0x00, 0x19, 0xf2, 0x40 },
+	{ 0x55, 0xab, 0x53, 0xfd, 0x06, 0x0d, 0x46, 0x0d, 0x8a, 0x5b, 0x00, 0x00, 0x00, 0x24, 0x9c, 0xa9 },
+	{ 0x3c, 0x81, 0x18, 0x8f, 0x06, 0x3f, 0x46, 0x3f, 0x8b, 0xb9, 0x00, 0x00, 0x00, 0x27, 0x03, 0x81 },
+	{ 0x3e, 0xe3, 0xbd, 0xdf, 0x04, 0x8f, 0x44, 0x8f, 0x8f, 0xe9, 0x00, 0x00, 0x00, 0x14, 0xc7, 0xe1 },
+	{ 0x7b, 0xd0, 0x73, 0x5a, 0x05, 0x7a, 0x45, 0x7a, 0x86, 0x56, 0x00, 0x00, 0x00, 0x1d, 0xfe, 0x24 },
+	{ 0x0d, 0x0d, 0x09, 0x1c, 0x05, 0xdc, 0x45, 0xdc, 0x89, 0x04, 0x00, 0x00, 0x00, 0x22, 0x55, 0x10 },
+	{ 0x61, 0x2c, 0xf1, 0xa1, 0x02, 0xf1, 0x42, 0xf1, 0x84, 0x97, 0x00, 0x00, 0x00, 0x08, 0xa6, 0xe1 },
+	{ 0x15, 0x30, 0x7d, 0x3e, 0x02, 0x9e, 0x42, 0x9e, 0x82, 0x52, 0x00, 0x00, 0x00, 0x06, 0xd9, 0x84 },
+	{ 0x3a, 0x0c, 0x4e, 0x12, 0x01, 0xb2, 0x41, 0xb2, 0x8b, 0xde, 0x00, 0x00, 0x00, 0x02, 0xdf, 0xc4 },
+	{ 0x10, 0xb8, 0xfc, 0xf5, 0x04, 0x85, 0x44, 0x85, 0x8f, 0xa3, 0x00, 0x00, 0x00, 0x14, 0x6d, 0x19 },
+	{ 0xb1, 0x53, 0x1b, 0xf6, 0x02, 0xd6, 0x42, 0xd6, 0x83, 0xda, 0x00, 0x00, 0x00, 0x08, 0x0a, 0xe4 },
+	{ 0xd0, 0xbb, 0xe8, 0x4f, 0x01, 0xff, 0x41, 0xff, 0x8d, 0xf9, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x01 },
+	{ 0xd5, 0xb1, 0x2a, 0xb1, 0x01, 0x01, 0x41, 0x01, 0x87, 0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01 },
+	{ 0x41, 0xf4, 0x1d, 0x0a, 0x06, 0x2a, 0x46, 0x2a, 0x8b, 0x26, 0x00, 0x00, 0x00, 0x25, 0xfe, 0xe4 },
+	{ 0x84, 0x71, 0xa9, 0x95, 0x03, 0x25, 0x43, 0x25, 0x86, 0x03, 0x00, 0x00, 0x00, 0x09, 0xe3, 0x59 },
+	{ 0xc3, 0x73, 0x3a, 0x09, 0x03, 0xd9, 0x43, 0xd9, 0x8a, 0xef, 0x00, 0x00, 0x00, 0x0e, 0xcd, 0xf1 },
+	{ 0x1e, 0x01, 0xab, 0x3b, 0x02, 0xab, 0x42, 0xab, 0x82, 0xad, 0x00, 0x00, 0x00, 0x07, 0x1e, 0x39 },
+	{ 0xf2, 0x4b, 0xb4, 0xce, 0x07, 0x2e, 0x47, 0x2e, 0x82, 0x42, 0x00, 0x00, 0x00, 0x33, 0x8c, 0x44 },
+	{ 0x86, 0xb6, 0x7c, 0x50, 0x05, 0x50, 0x45, 0x50, 0x85, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x39, 0x00 },
+	{ 0x15, 0x60, 0x75, 0x00, 0x05, 0x00, 0x45, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00 },
+	{ 0x4e, 0x23, 0x74, 0x89, 0x06, 0x59, 0x46, 0x59, 0x8c, 0x6f, 0x00, 0x00, 0x00, 0x28, 0x4a, 0xf1 },
+	{ 0x79, 0x5b, 0xa8, 0xdd, 0x00, 0xed, 0x40, 0xed, 0x86, 0x7b, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x69 },
+	{ 0x6b, 0x77, 0x65, 0xe9, 0x05, 0xb9, 0x45, 0xb9, 0x88, 0x0f, 0x00, 0x00, 0x00, 0x20, 0xbf, 0xb1 },
+	{ 0x69, 0xe0, 0x4d, 0x09, 0x06, 0xd9, 0x46, 0xd9, 0x8f, 0xef, 0x00, 0x00, 0x00, 0x2e, 0xe3, 0xf1 },
+	{ 0xb2, 0x9c, 0x6a, 0x7f, 0x03, 0x2f, 0x43, 0x2f, 0x86, 0x49, 0x00, 0x00, 0x00, 0x0a, 0x22, 0xa1 },
+	{ 0xf3, 0x35, 0x13, 0xd3, 0x02, 0xc3, 0x42, 0xc3, 0x83, 0x55, 0x00, 0x00, 0x00, 0x07, 0xa0, 0x89 },
+	{ 0xf8, 0xd8, 0x10, 0x10, 0x05, 0x10, 0x45, 0x10, 0x83, 0x70, 0x00, 0x00, 0x00, 0x19, 0xa1, 0x00 },
+	{ 0x39, 0x70, 0xb9, 0x64, 0x04, 0xa4, 0x44, 0xa4, 0x80, 0x7c, 0x00, 0x00, 0x00, 0x15, 0x89, 0x10 },
+	{ 0x6f, 0x23, 0x59, 0xc2, 0x04, 0x62, 0x44, 0x62, 0x8e, 0xae, 0x00, 0x00, 0x00, 0x13, 0x35, 0x84 },
+	{ 0xbd, 0x04, 0xb1, 0x5c, 0x02, 0x1c, 0x42, 0x1c, 0x8e, 0xc4, 0x00, 0x00, 0x00, 0x04, 0x73, 0x10 },
+	{ 0xe8, 0x7f, 0x02, 0x9f, 0x05, 0x4f, 0x45, 0x4f, 0x85, 0x29, 0x00, 0x00, 0x00, 0x1c, 0x2e, 0x61 },
+	{ 0xa1, 0xa7, 0xc8, 0x60, 0x06, 0x60, 0x46, 0x60, 0x8c, 0xa0, 0x00, 0x00, 0x00, 0x28, 0xa4, 0x00 },
+	{ 0xe2, 0x8e, 0x3c, 0x0b, 0x04, 0x7b, 0x44, 0x7b, 0x8f, 0x5d, 0x00, 0x00, 0x00, 0x14, 0x13, 0x19 },
+	{ 0xea, 0x16, 0x1b, 0x7f, 0x04, 0x2f, 0x44, 0x2f, 0x8d, 0x49, 0x00, 0x00, 0x00, 0x11, 0x80, 0xa1 },
+	{ 0x7c, 0x1e, 0x3d, 0xb1, 0x04, 0x01, 0x44, 0x01, 0x8c, 0x07, 0x00, 0x00, 0x00, 0x10, 0x08, 0x01 },
+	{ 0xb4, 0x81, 0x4d, 0xb6, 0x00, 0x96, 0x40, 0x96, 0x84, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x57, 0xe4 },
+	{ 0x34, 0xe7, 0x13, 0xee, 0x00, 0x4e, 0x40, 0x4e, 0x82, 0x22, 0x00, 0x00, 0x00, 0x00, 0x17, 0xc4 },
+	{ 0x3e, 0xb3, 0xc6, 0x1d, 0x02, 0x2d, 0x42, 0x2d, 0x8f, 0x3b, 0x00, 0x00, 0x00, 0x04, 0xbb, 0xe9 },
+	{ 0xb2, 0x1e, 0xa8, 0x66, 0x02, 0x46, 0x42, 0x46, 0x8f, 0xea, 0x00, 0x00, 0x00, 0x05, 0x2b, 0x24 },
+	{ 0x59, 0x87, 0x3f, 0x98, 0x07, 0x18, 0x47, 0x18, 0x81, 0xa8, 0x00, 0x00, 0x00, 0x32, 0x52, 0x40 },
+	{ 0x00, 0xad, 0xb9, 0xdb, 0x03, 0x4b, 0x43, 0x4b, 0x87, 0x0d, 0x00, 0x00, 0x00, 0x0a, 0xd7, 0xf9 },
+	{ 0x5f, 0xb3, 0xab, 0x56, 0x00, 0x36, 0x40, 0x36, 0x81, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x64 },
+	{ 0x2e, 0xd8, 0x7a, 0xc5, 0x03, 0x55, 0x43, 0x55, 0x87, 0x53, 0x00, 0x00, 0x00, 0x0b, 0x1a, 0x39 },
+	{ 0x28, 0xe7, 0xb4, 0x31, 0x02, 0x81, 0x42, 0x81, 0x81, 0x87, 0x00, 0x00, 0x00, 0x06, 0x45, 0x01 },
+	{ 0xdc, 0x1f, 0xb3, 0x5e, 0x02, 0xbe, 0x42, 0xbe, 0x83, 0x32, 0x00, 0x00, 0x00, 0x07, 0x85, 0x04 },
+	{ 0xbb, 0x3d, 0xa0, 0xba, 0x00, 0xda, 0x40, 0xda, 0x85, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xa4 },
+	{ 0x22, 0x79, 0x2b, 0x84, 0x00, 0xc4, 0x40, 0xc4, 0x85, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x96, 0x10 },
+	{ 0x03, 0xdb, 0xeb, 0x9b, 0x01, 0x0b, 0x41, 0x0b, 0x87, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x16, 0x79 },
+	{ 0xe3, 0x3b, 0xf5, 0xe6, 0x07, 0xc6, 0x47, 0xc6, 0x86, 0x6a, 0x00, 0x00, 0x00, 0x3c, 0x6d, 0x24 },
+	{ 0x49, 0x1c, 0x0c, 0xfa, 0x01, 0x1a, 0x41, 0x1a, 0x87, 0xb6, 0x00, 0x00, 0x00, 0x01, 0x36, 0xa4 },
+	{ 0x55, 0xf9, 0x1e, 0x54, 0x04, 0x94, 0x44, 0x94, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x14, 0xf5, 0x90 },
+	{ 0x9b, 0xd4, 0xd4, 0x61, 0x01, 0xb1, 0x41, 0xb1, 0x8b, 0xd7, 0x00, 0x00, 0x00, 0x02, 0xdc, 0x61 },
+	{ 0x8d, 0xc0, 0x99, 0xab, 0x04, 0x1b, 0x44, 0x1b, 0x8c, 0xbd, 0x00, 0x00, 0x00, 0x10, 0xda, 0xd9 },
+	{ 0x87, 0x82, 0x08, 0xc0, 0x04, 0xc0, 0x44, 0xc0, 0x81, 0x40, 0x00, 0x00, 0x00, 0x16, 0x90, 0x00 },
+	{ 0xc2, 0xd7, 0xa5, 0x5b, 0x06, 0xcb, 0x46, 0xcb, 0x8f, 0x8d, 0x00, 0x00, 0x00, 0x2e, 0x24, 0xf9 },
+	{ 0x1d, 0x83, 0xe9, 0x22, 0x01, 0xc2, 0x41, 0xc2, 0x8c, 0x4e, 0x00, 0x00, 0x00, 0x03, 0x17, 0x04 },
+	{ 0xdc, 0xeb, 0x3f, 0xce, 0x02, 0x2e, 0x42, 0x2e, 0x8f, 0x42, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x44 },
+	{ 0x7b, 0x70, 0x83, 0xd6, 0x00, 0xb6, 0x40, 0xb6, 0x84, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x81, 0x64 },
+	{ 0x32, 0x36, 0xa4, 0x47, 0x03, 0x77, 0x43, 0x77, 0x88, 0x41, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x51 },
+	{ 0xd0, 0x9e, 0x15, 0xba, 0x05, 0xda, 0x45, 0xda, 0x88, 0xf6, 0x00, 0x00, 0x00, 0x22, 0x3d, 0xa4 },
+	{ 0x00, 0x12, 0x25, 0x2d, 0x06, 0x3d, 0x46, 0x3d, 0x8b, 0xab, 0x00, 0x00, 0x00, 0x26, 0xea, 0x89 },
+	{ 0x3d, 0x4c, 0xa4, 0xff, 0x05, 0xaf, 0x45, 0xaf, 0x87, 0xc9, 0x00, 0x00, 0x00, 0x20, 0x4d, 0xa1 },
+	{ 0x78, 0x72, 0x49, 0xd8, 0x05, 0x58, 0x45, 0x58, 0x85, 0x68, 0x00, 0x00, 0x00, 0x1c, 0x8e, 0x40 },
+	{ 0x84, 0x53, 0xd7, 0x00, 0x07, 0x00, 0x47, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00 },
+	{ 0x29, 0xe3, 0x38, 0x63, 0x04, 0x53, 0x44, 0x53, 0x8e, 0x45, 0x00, 0x00, 0x00, 0x12, 0xb2, 0xe9 },
+	{ 0xe1, 0xf2, 0xa7, 0x5d, 0x07, 0x6d, 0x47, 0x6d, 0x83, 0xfb, 0x00, 0x00, 0x00, 0x37, 0x24, 0x69 },
+	{ 0xfe, 0x1b, 0x1c, 0xc9, 0x02, 0x99, 0x42, 0x99, 0x82, 0x2f, 0x00, 0x00, 0x00, 0x06, 0xbf, 0x71 },
+	{ 0xaa, 0xe4, 0x93, 0x49, 0x01, 0x19, 0x41, 0x19, 0x87, 0xaf, 0x00, 0x00, 0x00, 0x01, 0x34, 0x71 },
+	{ 0xf2, 0x1b, 0xbd, 0x0c, 0x04, 0xcc, 0x44, 0xcc, 0x81, 0x94, 0x00, 0x00, 0x00, 0x17, 0x02, 0x90 },
+	{ 0x08, 0x95, 0x88, 0xd3, 0x07, 0xc3, 0x47, 0xc3, 0x86, 0x55, 0x00, 0x00, 0x00, 0x3c, 0x3e, 0x89 },
+	{ 0x99, 0xa2, 0x26, 0xd3, 0x05, 0xc3, 0x45, 0xc3, 0x88, 0x55, 0x00, 0x00, 0x00, 0x21, 0x32, 0x89 },
+	{ 0xe3, 0x29, 0xd0, 0xb9, 0x01, 0x89, 0x41, 0x89, 0x8a, 0xbf, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x51 },
+	{ 0xee, 0xdb, 0x66, 0x1f, 0x00, 0xcf, 0x40, 0xcf, 0x85, 0xa9, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x61 },
+	{ 0xd9, 0x3f, 0x4b, 0xf5, 0x03, 0x85, 0x43, 0x85, 0x88, 0xa3, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x19 },
+	{ 0x21, 0xdd, 0x96, 0xd6, 0x03, 0xb6, 0x43, 0xb6, 0x89, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0xc5, 0x64 },
+	{ 0x0d, 0x8a, 0xcb, 0x35, 0x06, 0xc5, 0x46, 0xc5, 0x8f, 0x63, 0x00, 0x00, 0x00, 0x2d, 0xd3, 0x99 },
+	{ 0x20, 0x76, 0x75, 0xb8, 0x07, 0x38, 0x47, 0x38, 0x82, 0x88, 0x00, 0x00, 0x00, 0x34, 0x1c, 0x40 },
+	{ 0xb8, 0x0f, 0x6e, 0xfa, 0x03, 0x1a, 0x43, 0x1a, 0x85, 0xb6, 0x00, 0x00, 0x00, 0x09, 0x9e, 0xa4 },
+	{ 0x23, 0x74, 0xaf, 0xb6, 0x02, 0x96, 0x42, 0x96, 0x82, 0x1a, 0x00, 0x00, 0x00, 0x06, 0xaf, 0xe4 },
+	{ 0x1c, 0x4c, 0xbf, 0xc6, 0x07, 0xa6, 0x47, 0xa6, 0x85, 0x8a, 0x00, 0x00, 0x00, 0x3a, 0x7f, 0xa4 },
+	{ 0xd6, 0x11, 0x1a, 0x35, 0x05, 0xc5, 0x45, 0xc5, 0x88, 0x63, 0x00, 0x00, 0x00, 0x21, 0x49, 0x99 },
+	{ 0x3f, 0xdf, 0x42, 0x11, 0x06, 0x61, 0x46, 0x61, 0x8c, 0xa7, 0x00, 0x00, 0x00, 0x28, 0xb0, 0xc1 },
+	{ 0xc1, 0x7c, 0x31, 0xa5, 0x00, 0x35, 0x40, 0x35, 0x81, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf9 },
+	{ 0x3d, 0xb8, 0x41, 0xeb, 0x00, 0x5b, 0x40, 0x5b, 0x82, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x20, 0x59 },
+	{ 0x73, 0x1d, 0x17, 0xf2, 0x01, 0x92, 0x41, 0x92, 0x8a, 0xfe, 0x00, 0x00, 0x00, 0x02, 0x77, 0x44 },
+	{ 0x12, 0x80, 0x0d, 0x97, 0x05, 0xc7, 0x45, 0xc7, 0x88, 0x71, 0x00, 0x00, 0x00, 0x21, 0x60, 0xb1 },
+	{ 0x71, 0x68, 0x2c, 0x7d, 0x06, 0x8d, 0x46, 0x8d, 0x8d, 0xdb, 0x00, 0x00, 0x00, 0x2a, 0xe9, 0xa9 },
+	{ 0xbe, 0xcb, 0xc1, 0xfe, 0x03, 0x5e, 0x43, 0x5e, 0x87, 0x92, 0x00, 0x00, 0x00, 0x0b, 0x56, 0x84 },
+	{ 0x52, 0x6a, 0xfd, 0x10, 0x02, 0x10, 0x42, 0x10, 0x8e, 0x70, 0x00, 0x00, 0x00, 0x04, 0x41, 0x00 },
+	{ 0x5f, 0x48, 0x0e, 0x6a, 0x05, 0x8a, 0x45, 0x8a, 0x86, 0xc6, 0x00, 0x00, 0x00, 0x1e, 0xae, 0x64 },
+	{ 0x4f, 0xba, 0x8d, 0x69, 0x05, 0x39, 0x45, 0x39, 0x84, 0x8f, 0x00, 0x00, 0x00, 0x1b, 0x46, 0xb1 },
+	{ 0xfd, 0x7f, 0x88, 0x1b, 0x05, 0x8b, 0x45, 0x8b, 0x86, 0xcd, 0x00, 0x00, 0x00, 0x1e, 0xb9, 0x79 },
+	{ 0x6e, 0xf3, 0x62, 0x00, 0x02, 0x00, 0x42, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00 },
+	{ 0x21, 0x8f, 0xcc, 0x7f, 0x05, 0x2f, 0x45, 0x2f, 0x84, 0x49, 0x00, 0x00, 0x00, 0x1a, 0xde, 0xa1 },
+	{ 0x25, 0x3b, 0xc0, 0x58, 0x03, 0xd8, 0x43, 0xd8, 0x8a, 0xe8, 0x00, 0x00, 0x00, 0x0e, 0xc6, 0x40 },
+	{ 0xa5, 0xa1, 0x86, 0x90, 0x03, 0x90, 0x43, 0x90, 0x88, 0xf0, 0x00, 0x00, 0x00, 0x0c, 0xb1, 0x00 },
+	{ 0x3e, 0x48, 0x29, 0x31, 0x07, 0x81, 0x47, 0x81, 0x84, 0x87, 0x00, 0x00, 0x00, 0x38, 0x4f, 0x01 },
+	{ 0x75, 0x91, 0xe2, 0x6f, 0x06, 0x1f, 0x46, 0x1f, 0x8a, 0xd9, 0x00, 0x00, 0x00, 0x25, 0x77, 0xc1 },
+	{ 0x4b, 0x90, 0xd7, 0x77, 0x05, 0xa7, 0x45, 0xa7, 0x87, 0x91, 0x00, 0x00, 0x00, 0x1f, 0xf2, 0xf1 },
+	{ 0x85, 0x1f, 0x63, 0x70, 0x06, 0x70, 0x46, 0x70, 0x8d, 0x10, 0x00, 0x00, 0x00, 0x29, 0x71, 0x00 },
+	{ 0x41, 0xa6, 0x52, 0xb3, 0x07, 0xa3, 0x47, 0xa3, 0x85, 0x75, 0x00, 0x00, 0x00, 0x3a, 0x51, 0xc9 },
+	{ 0x39, 0xee, 0x7b, 0x7d, 0x05, 0x8d, 0x45, 0x8d, 0x86, 0xdb, 0x00, 0x00, 0x00, 0x1e, 0xcf, 0xa9 },
+	{ 0x8f, 0x87, 0xaa, 0x4d, 0x05, 0x5d, 0x45, 0x5d, 0x85, 0x8b, 0x00, 0x00, 0x00, 0x1c, 0xc3, 0xc9 },
+	{ 0x3b, 0x37, 0xca, 0x06, 0x05, 0xe6, 0x45, 0xe6, 0x89, 0x4a, 0x00, 0x00, 0x00, 0x22, 0xca, 0xa4 },
+	{ 0xcf, 0xf0, 0x5b, 0xdf, 0x02, 0x8f, 0x42, 0x8f, 0x81, 0xe9, 0x00, 0x00, 0x00, 0x06, 0x8b, 0xe1 },
+	{ 0x5d, 0xfe, 0xbf, 0xe1, 0x05, 0x31, 0x45, 0x31, 0x84, 0x57, 0x00, 0x00, 0x00, 0x1a, 0xf3, 0x61 },
+	{ 0xee, 0xbd, 0x93, 0x8a, 0x04, 0xaa, 0x44, 0xaa, 0x80, 0xa6, 0x00, 0x00, 0x00, 0x15, 0xc0, 0xe4 },
+	{ 0x1b, 0xbc, 0xd8, 0x80, 0x00, 0x80, 0x40, 0x80, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00 },
+	{ 0xe9, 0x1a, 0x97, 0x4d, 0x02, 0x5d, 0x42, 0x5d, 0x80, 0x8b, 0x00, 0x00, 0x00, 0x05, 0x95, 0xc9 },
+	{ 0x71, 0xb5, 0xf6, 0xd4, 0x05, 0x14, 0x45, 0x14, 0x83, 0x8c, 0x00, 0x00, 0x00, 0x19, 0xc9, 0x90 },
+	{ 0x9c, 0x52, 0x96, 0x7a, 0x02, 0x9a, 0x42, 0x9a, 0x82, 0x36, 0x00, 0x00, 0x00, 0x06, 0xc4, 0xa4 },
+	{ 0x61, 0x8c, 0xe1, 0x25, 0x07, 0xb5, 0x47, 0xb5, 0x85, 0xf3, 0x00, 0x00, 0x00, 0x3b, 0x65, 0xf9 },
+	{ 0x93, 0xcf, 0x32, 0xd4, 0x01, 0x14, 0x41, 0x14, 0x87, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x29, 0x90 },
+	{ 0xfb, 0x1c, 0xe2, 0xcb, 0x07, 0x3b, 0x47, 0x3b, 0x82, 0x9d, 0x00, 0x00, 0x00, 0x34, 0x47, 0x99 },
+	{ 0xcc, 0x14, 0x70, 0x44, 0x01, 0x84, 0x41, 0x84, 0x8a, 0x9c, 0x00, 0x00, 0x00, 0x02, 0x4c, 0x10 },
+	{ 0x1e, 0x7f, 0x6d, 0x54, 0x03, 0x94, 0x43, 0x94, 0x89, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0xcd, 0x90 },
+	{ 0x2f, 0x56, 0x3c, 0xde, 0x04, 0x3e, 0x44, 0x3e, 0x8d, 0xb2, 0x00, 0x00, 0x00, 0x11, 0xff, 0x04 },
+	{ 0x08, 0xe3, 0x53, 0x2a, 0x06, 0x4a, 0x46, 0x4a, 0x8c, 0x06, 0x00, 0x00, 0x00, 0x27, 0x8d, 0x64 },
+	{ 0x81, 0x91, 0x42, 0x2c, 0x03, 0xec, 0x43, 0xec, 0x8b, 0x74, 0x00, 0x00, 0x00, 0x0f, 0x61, 0x90 },
+	{ 0xa7, 0x98, 0x8e, 0xf4, 0x07, 0x34, 0x47, 0x34, 0x82, 0x6c, 0x00, 0x00, 0x00, 0x33, 0xe2, 0x90 },
+	{ 0xef, 0xd6, 0xea, 0x51, 0x02, 0xa1, 0x42, 0xa1, 0x82, 0x67, 0x00, 0x00, 0x00, 0x06, 0xe9, 0x41 },
+	{ 0x42, 0x5f, 0xb9, 0xf6, 0x00, 0xd6, 0x40, 0xd6, 0x85, 0xda, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xe4 },
+	{ 0x37, 0x79, 0xb1, 0x00, 0x01, 0x00, 0x41, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00 },
+	{ 0xb2, 0x4e, 0xa0, 0x28, 0x04, 0xa8, 0x44, 0xa8, 0x80, 0x98, 0x00, 0x00, 0x00, 0x15, 0xae, 0x40 },
+	{ 0x7d, 0xe5, 0x4e, 0x53, 0x05, 0x43, 0x45, 0x43, 0x84, 0xd5, 0x00, 0x00, 0x00, 0x1b, 0xaf, 0x89 },
+	{ 0x6f, 0x53, 0x51, 0x84, 0x06, 0xc4, 0x46, 0xc4, 0x8f, 0x5c, 0x00, 0x00, 0x00, 0x2d, 0xc6, 0x10 },
+	{ 0xfd, 0x9d, 0x5a, 0xb0, 0x01, 0xb0, 0x41, 0xb0, 0x8b, 0xd0, 0x00, 0x00, 0x00, 0x02, 0xd9, 0x00 },
+	{ 0x93, 0xb1, 0x60, 0x3f, 0x04, 0xef, 0x44, 0xef, 0x82, 0x89, 0x00, 0x00, 0x00, 0x18, 0x57, 0x21 },
+	{ 0x9a, 0xbb, 0x7d, 0x9a, 0x03, 0xba, 0x43, 0xba, 0x8a, 0x16, 0x00, 0x00, 0x00, 0x0d, 0xe3, 0x24 },
+	{ 0x73, 0xfa, 0xc9, 0x8f, 0x07, 0x3f, 0x47, 0x3f, 0x82, 0xb9, 0x00, 0x00, 0x00, 0x34, 0x81, 0x81 },
+	{ 0xe8, 0x1f, 0x13, 0x1b, 0x00, 0x8b, 0x40, 0x8b, 0x83, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x79 },
+	{ 0xe5, 0xec, 0x65, 0x8d, 0x04, 0x9d, 0x44, 0x9d, 0x80, 0x4b, 0x00, 0x00, 0x00, 0x15, 0x48, 0x49 },
+	{ 0x78, 0xa2, 0x41, 0x9a, 0x07, 0xba, 0x47, 0xba, 0x86, 0x16, 0x00, 0x00, 0x00, 0x3b, 0xb3, 0x24 },
+	{ 0xc9, 0xe1, 0xc2, 0xb6, 0x05, 0x96, 0x45, 0x96, 0x87, 0x1a, 0x00, 0x00, 0x00, 0x1f, 0x33, 0xe4 },
+	{ 0x30, 0x9f, 0x8b, 0x67, 0x04, 0x97, 0x44, 0x97, 0x80, 0x21, 0x00, 0x00, 0x00, 0x15, 0x11, 0x11 },
+	{ 0x8a, 0x62, 0x70, 0x29, 0x03, 0xf9, 0x43, 0xf9, 0x8b, 0xcf, 0x00, 0x00, 0x00, 0x0f, 0xc8, 0x31 },
+	{ 0x9d, 0x00, 0x50, 0x55, 0x05, 0xe5, 0x45, 0xe5, 0x89, 0x43, 0x00, 0x00, 0x00, 0x22, 0xbe, 0xd9 },
+	{ 0x3c, 0x33, 0x4e, 0x38, 0x07, 0xb8, 0x47, 0xb8, 0x86, 0x08, 0x00, 0x00, 0x00, 0x3b, 0x94, 0x40 },
+	{ 0xff, 0x94, 0x63, 0x14, 0x05, 0x54, 0x45, 0x54, 0x85, 0x4c, 0x00, 0x00, 0x00, 0x1c, 0x63, 0x90 },
+	{ 0x6c, 0x60, 0xc4, 0xee, 0x01, 0x4e, 0x41, 0x4e, 0x89, 0x22, 0x00, 0x00, 0x00, 0x01, 0xb3, 0xc4 },
+	{ 0xfb, 0x0a, 0xbd, 0x9e, 0x00, 0xfe, 0x40, 0xfe, 0x86, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x04 },
+	{ 0x3f, 0x61, 0x7f, 0xf8, 0x05, 0x78, 0x45, 0x78, 0x86, 0x48, 0x00, 0x00, 0x00, 0x1d, 0xe8, 0x40 },
+	{ 0x15, 0x7e, 0x47, 0x95, 0x01, 0x25, 0x41, 0x25, 0x88, 0x03, 0x00, 0x00, 0x00, 0x01, 0x4f, 0x59 },
+	{ 0x35, 0x94, 0xcd, 0xc9, 0x03, 0x99, 0x43, 0x99, 0x89, 0x2f, 0x00, 0x00, 0x00, 0x0c, 0xf1, 0x71 },
+	{ 0x87, 0x9f, 0xdb, 0x55, 0x00, 0xe5, 0x40, 0xe5, 0x86, 0x43, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xd9 },
+	{ 0xcc, 0xf2, 0x21, 0xe1, 0x07, 0x31, 0x47, 0x31, 0x82, 0x57, 0x00, 0x00, 0x00, 0x33, 0xb7, 0x61 },
+	{ 0x69, 0x32, 0x93, 0x2e, 0x03, 0x8e, 0x43, 0x8e, 0x88, 0xe2, 0x00, 0x00, 0x00, 0x0c, 0xa2, 0xc4 },
+	{ 0x7e, 0x80, 0xe3, 0x01, 0x02, 0x51, 0x42, 0x51, 0x80, 0x37, 0x00, 0x00, 0x00, 0x05, 0x5d, 0xa1 },
+	{ 0xa8, 0x64, 0x1b, 0x64, 0x06, 0xa4, 0x46, 0xa4, 0x8e, 0x7c, 0x00, 0x00, 0x00, 0x2c, 0x19, 0x10 },
+	{ 0x81, 0x73, 0x6f, 0x97, 0x07, 0xc7, 0x47, 0xc7, 0x86, 0x71, 0x00, 0x00, 0x00, 0x3c, 0x7c, 0xb1 },
+	{ 0x8e, 0xbc, 0x1d, 0xdd, 0x05, 0xed, 0x45, 0xed, 0x89, 0x7b, 0x00, 0x00, 0x00, 0x23, 0x1d, 0x69 },
+	{ 0xed, 0xc2, 0x0f, 0x58, 0x02, 0xd8, 0x42, 0xd8, 0x83, 0xe8, 0x00, 0x00, 0x00, 0x08, 0x16, 0x40 },
+	{ 0x7c, 0x9b, 0xff, 0xca, 0x04, 0xea, 0x44, 0xea, 0x82, 0x66, 0x00, 0x00, 0x00, 0x18, 0x25, 0xe4 },
+	{ 0xf0, 0x36, 0xd9, 0xd5, 0x07, 0x65, 0x47, 0x65, 0x83, 0xc3, 0x00, 0x00, 0x00, 0x36, 0xad, 0xd9 },
+	{ 0xb5, 0x5e, 0xff, 0x53, 0x06, 0x43, 0x46, 0x43, 0x8b, 0xd5, 0x00, 0x00, 0x00, 0x27, 0x35, 0x89 },
+	{ 0xbb, 0x6d, 0x98, 0x7c, 0x03, 0x3c, 0x43, 0x3c, 0x86, 0xa4, 0x00, 0x00, 0x00, 0x0a, 0x76, 0x10 },
+	{ 0x0f, 0x6f, 0xae, 0x6c, 0x04, 0x2c, 0x44, 0x2c, 0x8d, 0x34, 0x00, 0x00, 0x00, 0x11, 0x67, 0x90 },
+	{ 0x95, 0x96, 0x43, 0x76, 0x02, 0x56, 0x42, 0x56, 0x80, 0x5a, 0x00, 0x00, 0x00, 0x05, 0x74, 0xe4 },
+	{ 0x81, 0xaf, 0x14, 0xc1, 0x00, 0x11, 0x40, 0x11, 0x80, 0x77, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21 },
+	{ 0x31, 0x88, 0xea, 0x6c, 0x00, 0x2c, 0x40, 0x2c, 0x81, 0x34, 0x00, 0x00, 0x00, 0x00, 0x07, 0x90 },
+	{ 0x34, 0xc9, 0x41, 0x59, 0x04, 0x29, 0x44, 0x29, 0x8d, 0x1f, 0x00, 0x00, 0x00, 0x11, 0x4e, 0x91 },
+	{ 0x9e, 0x19, 0xa7, 0x1c, 0x03, 0xdc, 0x43, 0xdc, 0x8b, 0x04, 0x00, 0x00, 0x00, 0x0e, 0xe5, 0x10 },
+	{ 0xad, 0xf4, 0xf2, 0x74, 0x02, 0xb4, 0x42, 0xb4, 0x82, 0xec, 0x00, 0x00, 0x00, 0x07, 0x4e, 0x90 },
+	{ 0x7e, 0x33, 0x18, 0xaa, 0x03, 0xca, 0x43, 0xca, 0x8a, 0x86, 0x00, 0x00, 0x00, 0x0e, 0x5b, 0x64 },
+	{ 0xbe, 0x9b, 0xca, 0x3c, 0x00, 0xfc, 0x40, 0xfc, 0x86, 0xe4, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x10 },
+	{ 0x59, 0xf2, 0xdc, 0x84, 0x01, 0xc4, 0x41, 0xc4, 0x8c, 0x5c, 0x00, 0x00, 0x00, 0x03, 0x1e, 0x10 },
+	{ 0xc9, 0x64, 0x00, 0x9d, 0x04, 0xad, 0x44, 0xad, 0x80, 0xbb, 0x00, 0x00, 0x00, 0x15, 0xdc, 0xe9 },
+	{ 0xa5, 0x71, 0x8e, 0xce, 0x01, 0x2e, 0x41, 0x2e, 0x88, 0x42, 0x00, 0x00, 0x00, 0x01, 0x64, 0x44 },
+	{ 0x04, 0x0b, 0xe3, 0x5d, 0x03, 0x6d, 0x43, 0x6d, 0x87, 0xfb, 0x00, 0x00, 0x00, 0x0b, 0xbc, 0x69 },
+	{ 0x41, 0x94, 0x2d, 0x86, 0x01, 0x66, 0x41, 0x66, 0x89, 0xca, 0x00, 0x00, 0x00, 0x01, 0xf4, 0xa4 },
+	{ 0x27, 0xce, 0x5d, 0x6a, 0x04, 0x8a, 0x44, 0x8a, 0x8f, 0xc6, 0x00, 0x00, 0x00, 0x14, 0x9a, 0x64 },
+	{ 0x6d, 0x0e, 0x7e, 0xc9, 0x04, 0x99, 0x44, 0x99, 0x80, 0x2f, 0x00, 0x00, 0x00, 0x15, 0x23, 0x71 },
+	{ 0xd9, 0x6f, 0x43, 0xb7, 0x05, 0xe7, 0x45, 0xe7, 0x89, 0x51, 0x00, 0x00, 0x00, 0x22, 0xd6, 0x71 },
+	{ 0x2d, 0x5f, 0x34, 0x7a, 0x00, 0x9a, 0x40, 0x9a, 0x84, 0x36, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa4 },
+	{ 0x5d, 0x33, 0x33, 0x71, 0x05, 0xc1, 0x45, 0xc1, 0x88, 0x47, 0x00, 0x00, 0x00, 0x21, 0x1b, 0x81 },
+	{ 0xa4, 0x88, 0x2f, 0xc9, 0x05, 0x99, 0x45, 0x99, 0x87, 0x2f, 0x00, 0x00, 0x00, 0x1f, 0x55, 0x71 },
+	{ 0xa4, 0xd5, 0xfa, 0x20, 0x04, 0x20, 0x44, 0x20, 0x8c, 0xe0, 0x00, 0x00, 0x00, 0x11, 0x04, 0x00 },
+	{ 0x09, 0xcc, 0xb2, 0x2f, 0x01, 0xdf, 0x41, 0xdf, 0x8d, 0x19, 0x00, 0x00, 0x00, 0x03, 0x80, 0x41 },
+	{ 0x52, 0xe8, 0xbf, 0x29, 0x02, 0xf9, 0x42, 0xf9, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x08, 0xd6, 0x31 },
+	{ 0xd8, 0x25, 0xf5, 0x2e, 0x05, 0x8e, 0x45, 0x8e, 0x86, 0xe2, 0x00, 0x00, 0x00, 0x1e, 0xda, 0xc4 },
+	{ 0x61, 0x5c, 0xe9, 0x63, 0x05, 0x53, 0x45, 0x53, 0x85, 0x45, 0x00, 0x00, 0x00, 0x1c, 0x58, 0xe9 },
+	{ 0xf5, 0x97, 0xb9, 0x23, 0x01, 0x13, 0x41, 0x13, 0x87, 0x85, 0x00, 0x00, 0x00, 0x01, 0x27, 0x69 },
+	{ 0x38, 0xa5, 0x2c, 0xf4, 0x05, 0x34, 0x45, 0x34, 0x84, 0x6c, 0x00, 0x00, 0x00, 0x1b, 0x12, 0x90 },
+	{ 0xef, 0x3b, 0x55, 0xa3, 0x05, 0x93, 0x45, 0x93, 0x87, 0x05, 0x00, 0x00, 0x00, 0x1f, 0x12, 0x69 },
+	{ 0x1f, 0xc8, 0xbb, 0xdd, 0x03, 0xed, 0x43, 0xed, 0x8b, 0x7b, 0x00, 0x00, 0x00, 0x0f, 0x69, 0x69 },
+	{ 0x07, 0x1c, 0x42, 0x88, 0x05, 0x08, 0x45, 0x08, 0x83, 0x38, 0x00, 0x00, 0x00, 0x19, 0x50, 0x40 },
+	{ 0xc8, 0x1a, 0xb2, 0x14, 0x04, 0x54, 0x44, 0x54, 0x8e, 0x4c, 0x00, 0x00, 0x00, 0x12, 0xbb, 0x90 },
+	{ 0x82, 0x3e, 0xfc, 0x07, 0x07, 0x37, 0x47, 0x37, 0x82, 0x81, 0x00, 0x00, 0x00, 0x34, 0x0d, 0xd1 },
+	{ 0x9b, 0x57, 0x12, 0x48, 0x00, 0xc8, 0x40, 0xc8, 0x85, 0x78, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x40 },
+	{ 0x59, 0x57, 0x47, 0xd6, 0x04, 0xb6, 0x44, 0xb6, 0x80, 0xfa, 0x00, 0x00, 0x00, 0x16, 0x31, 0x64 },
+	{ 0x0b, 0x63, 0xcb, 0x0f, 0x00, 0xbf, 0x40, 0xbf, 0x85, 0x39, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x81 },
+	{ 0x1c, 0xb8, 0x5c, 0xb2, 0x02, 0x52, 0x42, 0x52, 0x80, 0x3e, 0x00, 0x00, 0x00, 0x05, 0x62, 0x44 },
+	{ 0x7a, 0x27, 0x35, 0x4d, 0x00, 0x5d, 0x40, 0x5d, 0x82, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x21, 0xc9 },
+	{ 0x94, 0x9a, 0xbf, 0x44, 0x00, 0x84, 0x40, 0x84, 0x83, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x44, 0x10 },
+	{ 0x17, 0x15, 0x60, 0x75, 0x00, 0x05, 0x40, 0x05, 0x80, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19 },
+	{ 0x8e, 0xd9, 0xf0, 0x72, 0x02, 0x12, 0x42, 0x12, 0x8e, 0x7e, 0x00, 0x00, 0x00, 0x04, 0x49, 0x44 },
+	{ 0x3a, 0xd7, 0xda, 0x82, 0x01, 0x22, 0x41, 0x22, 0x87, 0xee, 0x00, 0x00, 0x00, 0x01, 0x48, 0x84 },
+	{ 0x7c, 0xcb, 0xf7, 0x8c, 0x07, 0x4c, 0x47, 0x4c, 0x83, 0x14, 0x00, 0x00, 0x00, 0x35, 0x3e, 0x90 },
+	{ 0x4b, 0x60, 0xdf, 0xb5, 0x03, 0x45, 0x43, 0x45, 0x86, 0xe3, 0x00, 0x00, 0x00, 0x0a, 0xb0, 0x99 },
+	{ 0xe6, 0x0a, 0x38, 0x22, 0x00, 0xc2, 0x40, 0xc2, 0x85, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x93, 0x04 },
+	{ 0x82, 0xf8, 0x63, 0x4a, 0x00, 0x6a, 0x40, 0x6a, 0x82, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xe4 },
+	{ 0xee, 0xed, 0x8b, 0x4c, 0x07, 0x0c, 0x47, 0x0c, 0x81, 0x54, 0x00, 0x00, 0x00, 0x31, 0xa8, 0x90 },
+	{ 0x23, 0xf2, 0x71, 0xcf, 0x03, 0x7f, 0x43, 0x7f, 0x88, 0x79, 0x00, 0x00, 0x00, 0x0c, 0x39, 0x01 },
+	{ 0x7d, 0xb5, 0x56, 0x91, 0x02, 0xe1, 0x42, 0xe1, 0x84, 0x27, 0x00, 0x00, 0x00, 0x08, 0x49, 0xc1 },
+	{ 0xb3, 0xc7, 0xe6, 0x73, 0x07, 0x63, 0x47, 0x63, 0x83, 0xb5, 0x00, 0x00, 0x00, 0x36, 0x90, 0x49 },
+	{ 0x03, 0x8e, 0x21, 0x44, 0x02, 0x84, 0x42, 0x84, 0x81, 0x9c, 0x00, 0x00, 0x00, 0x06, 0x54, 0x10 },
+	{ 0x1f, 0xe6, 0x8e, 0x72, 0x00, 0x12, 0x40, 0x12, 0x80, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44 },
+	{ 0xe8, 0xfc, 0xc4, 0xb8, 0x06, 0x38, 0x46, 0x38, 0x8b, 0x88, 0x00, 0x00, 0x00, 0x26, 0xac, 0x40 },
+	{ 0x18, 0x5e, 0xae, 0xfe, 0x00, 0x5e, 0x40, 0x5e, 0x82, 0x92, 0x00, 0x00, 0x00, 0x00, 0x22, 0x84 },
+	{ 0xb7, 0x73, 0xda, 0x4c, 0x06, 0x0c, 0x46, 0x0c, 0x8a, 0x54, 0x00, 0x00, 0x00, 0x24, 0x90, 0x90 },
+	{ 0x44, 0x56, 0xc2, 0x5a, 0x04, 0x7a, 0x44, 0x7a, 0x8f, 0x56, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x24 },
+	{ 0x4a, 0x65, 0x5b, 0x83, 0x01, 0x73, 0x41, 0x73, 0x8a, 0x25, 0x00, 0x00, 0x00, 0x02, 0x19, 0xa9 },
+	{ 0x85, 0xba, 0xf8, 0x1e, 0x03, 0x7e, 0x43, 0x7e, 0x88, 0x72, 0x00, 0x00, 0x00, 0x0c, 0x32, 0x04 },
+	{ 0x85, 0xea, 0xef, 0xe0, 0x05, 0xe0, 0x45, 0xe0, 0x89, 0x20, 0x00, 0x00, 0x00, 0x22, 0x84, 0x00 },
+	{ 0xd5, 0x45, 0x8d, 0xc5, 0x06, 0x55, 0x46, 0x55, 0x8c, 0x53, 0x00, 0x00, 0x00, 0x28, 0x18, 0x39 },
+	{ 0xe9, 0x7a, 0x86, 0xd1, 0x07, 0x21, 0x47, 0x21, 0x81, 0xe7, 0x00, 0x00, 0x00, 0x32, 0xd2, 0x41 },
+	{ 0x16, 0xc7, 0x96, 0x1e, 0x01, 0x7e, 0x41, 0x7e, 0x8a, 0x72, 0x00, 0x00, 0x00, 0x02, 0x3a, 0x04 },
+	{ 0xc8, 0x98, 0x74, 0x2d, 0x05, 0x3d, 0x45, 0x3d, 0x84, 0xab, 0x00, 0x00, 0x00, 0x1b, 0x70, 0x89 },
+	{ 0xb2, 0xcc, 0x62, 0x41, 0x05, 0x91, 0x45, 0x91, 0x86, 0xf7, 0x00, 0x00, 0x00, 0x1e, 0xfc, 0x21 },
+	{ 0x1d, 0x06, 0x27, 0x09, 0x00, 0xd9, 0x40, 0xd9, 0x85, 0xef, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xf1 },
+	{ 0x3c, 0x21, 0x29, 0x0b, 0x01, 0x7b, 0x41, 0x7b, 0x8a, 0x5d, 0x00, 0x00, 0x00, 0x02, 0x31, 0x19 },
+	{ 0xf9, 0xa3, 0x9c, 0x80, 0x04, 0x80, 0x44, 0x80, 0x8f, 0x80, 0x00, 0x00, 0x00, 0x14, 0x40, 0x00 },
+	{ 0x1c, 0x3a, 0x9a, 0x99, 0x01, 0x69, 0x41, 0x69, 0x89, 0xdf, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x11 },
+	{ 0xff, 0x64, 0x6b, 0x52, 0x02, 0xf2, 0x42, 0xf2, 0x84, 0x9e, 0x00, 0x00, 0x00, 0x08, 0xac, 0xc4 },
+	{ 0xe9, 0xe6, 0x23, 0xbd, 0x01, 0xcd, 0x41, 0xcd, 0x8c, 0x9b, 0x00, 0x00, 0x00, 0x03, 0x3e, 0x29 },
+	{ 0x23, 0x44, 0xb7, 0xf4, 0x00, 0x34, 0x40, 0x34, 0x81, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x90 },
+	{ 0x13, 0xc9, 0x5c, 0x20, 0x06, 0x20, 0x46, 0x20, 0x8a, 0xe0, 0x00, 0x00, 0x00, 0x25, 0x84, 0x00 },
+	{ 0x2e, 0xa8, 0x83, 0x03, 0x00, 0xf3, 0x40, 0xf3, 0x86, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xa9 },
+	{ 0x1c, 0x6a, 0x92, 0x5b, 0x03, 0xcb, 0x43, 0xcb, 0x8a, 0x8d, 0x00, 0x00, 0x00, 0x0e, 0x62, 0xf9 },
+	{ 0x36, 0xc0, 0x49, 0xbd, 0x07, 0xcd, 0x47, 0xcd, 0x86, 0x9b, 0x00, 0x00, 0x00, 0x3c, 0xda, 0x29 },
+	{ 0x25, 0xe9, 0x7a, 0x33, 0x07, 0x23, 0x47, 0x23, 0x81, 0xf5, 0x00, 0x00, 0x00, 0x32, 0xee, 0xc9 },
+	{ 0xcc, 0x74, 0x5f, 0xc8, 0x06, 0x48, 0x46, 0x48, 0x8b, 0xf8, 0x00, 0x00, 0x00, 0x27, 0x74, 0x40 },
+	{ 0x20, 0x64, 0x50, 0x8b, 0x00, 0xfb, 0x40, 0xfb, 0x86, 0xdd, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x19 },
+	{ 0x06, 0xbc, 0x53, 0x04, 0x00, 0x44, 0x40, 0x44, 0x81, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10 },
+	{ 0x44, 0x26, 0xca, 0x98, 0x02, 0x18, 0x42, 0x18, 0x8e, 0xa8, 0x00, 0x00, 0x00, 0x04, 0x62, 0x40 },
+	{ 0xd7, 0x5a, 0x68, 0xbe, 0x06, 0x1e, 0x46, 0x1e, 0x8a, 0xd2, 0x00, 0x00, 0x00, 0x25, 0x6b, 0x84 },
+	{ 0x80, 0x47, 0xf3, 0xa3, 0x03, 0x93, 0x43, 0x93, 0x89, 0x05, 0x00, 0x00, 0x00, 0x0c, 0xc6, 0x69 },
+	{ 0x8b, 0xf9, 0x89, 0x09, 0x02, 0xd9, 0x42, 0xd9, 0x83, 0xef, 0x00, 0x00, 0x00, 0x08, 0x1b, 0xf1 },
+	{ 0xb3, 0xe5, 0xb9, 0x08, 0x03, 0x88, 0x43, 0x88, 0x88, 0xb8, 0x00, 0x00, 0x00, 0x0c, 0x78, 0x40 },
+	{ 0xe2, 0xac, 0x0e, 0xa0, 0x00, 0xa0, 0x40, 0xa0, 0x84, 0x60, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00 },
+	{ 0xff, 0xe2, 0x2d, 0x6b, 0x03, 0xdb, 0x43, 0xdb, 0x8a, 0xfd, 0x00, 0x00, 0x00, 0x0e, 0xdd, 0x59 },
+	{ 0x22, 0x0d, 0x8e, 0x98, 0x06, 0x18, 0x46, 0x18, 0x8a, 0xa8, 0x00, 0x00, 0x00, 0x25, 0x22, 0x40 },
+	{ 0xf6, 0xe1, 0x07, 0xac, 0x01, 0x6c, 0x41, 0x6c, 0x89, 0xf4, 0x00, 0x00, 0x00, 0x02, 0x05, 0x90 },
+	{ 0x90, 0xee, 0xcb, 0x6b, 0x01, 0xdb, 0x41, 0xdb, 0x8c, 0xfd, 0x00, 0x00, 0x00, 0x03, 0x71, 0x59 },
+	{ 0xf3, 0x05, 0x1c, 0x11, 0x00, 0x61, 0x40, 0x61, 0x82, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x24, 0xc1 },
+	{ 0xba, 0x24, 0x49, 0xf3, 0x02, 0xe3, 0x42, 0xe3, 0x84, 0x35, 0x00, 0x00, 0x00, 0x08, 0x55, 0x49 },
+	{ 0x79, 0xd9, 0x6a, 0xf6, 0x01, 0xd6, 0x41, 0xd6, 0x8c, 0xda, 0x00, 0x00, 0x00, 0x03, 0x5e, 0xe4 },
+	{ 0xaf, 0x0e, 0x49, 0x3b, 0x00, 0xab, 0x40, 0xab, 0x84, 0xad, 0x00, 0x00, 0x00, 0x00, 0x72, 0x39 },
+	{ 0xf6, 0xc3, 0x35, 0x17, 0x05, 0x47, 0x45, 0x47, 0x84, 0xf1, 0x00, 0x00, 0x00, 0x1b, 0xd9, 0xb1 },
+	{ 0x8d, 0x72, 0xcf, 0x54, 0x05, 0x94, 0x45, 0x94, 0x87, 0x0c, 0x00, 0x00, 0x00, 0x1f, 0x1d, 0x90 },
+	{ 0x30, 0xcf, 0x83, 0x29, 0x06, 0xf9, 0x46, 0xf9, 0x80, 0xcf, 0x00, 0x00, 0x00, 0x30, 0x9e, 0x31 },
+	{ 0x06, 0xec, 0x4a, 0xc6, 0x02, 0xa6, 0x42, 0xa6, 0x82, 0x8a, 0x00, 0x00, 0x00, 0x07, 0x03, 0xa4 },
+	{ 0x34, 0x99, 0x49, 0x97, 0x01, 0xc7, 0x41, 0xc7, 0x8c, 0x71, 0x00, 0x00, 0x00, 0x03, 0x28, 0xb1 },
+	{ 0xa2, 0x43, 0x5d, 0x0e, 0x03, 0x6e, 0x43, 0x6e, 0x88, 0x02, 0x00, 0x00, 0x00, 0x0b, 0xc3, 0x44 },
+	{ 0xd9, 0x8d, 0x16, 0x4c, 0x02, 0x0c, 0x42, 0x0c, 0x8e, 0x54, 0x00, 0x00, 0x00, 0x04, 0x30, 0x90 },
+	{ 0xdc, 0x9d, 0x75, 0x77, 0x03, 0xa7, 0x43, 0xa7, 0x89, 0x91, 0x00, 0x00, 0x00, 0x0d, 0x56, 0xf1 },
+	{ 0x5c, 0xe5, 0x69, 0x1a, 0x07, 0x3a, 0x47, 0x3a, 0x82, 0x96, 0x00, 0x00, 0x00, 0x34, 0x39, 0x24 },
+	{ 0x34, 0x7b, 0x77, 0x02, 0x05, 0xa2, 0x45, 0xa2, 0x87, 0x6e, 0x00, 0x00, 0x00, 0x1f, 0xba, 0x84 },
+	{ 0x81, 0x61, 0x4a, 0x6a, 0x01, 0x8a, 0x41, 0x8a, 0x8a, 0xc6, 0x00, 0x00, 0x00, 0x02, 0x5e, 0x64 },
+	{ 0x5e, 0x9a, 0x54, 0x8f, 0x02, 0x3f, 0x42, 0x3f, 0x8f, 0xb9, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x81 },
+	{ 0x4b, 0xde, 0xa1, 0xce, 0x04, 0x2e, 0x44, 0x2e, 0x8d, 0x42, 0x00, 0x00, 0x00, 0x11, 0x78, 0x44 },
+	{ 0x86, 0x86, 0x84, 0x8e, 0x02, 0xee, 0x42, 0xee, 0x84, 0x82, 0x00, 0x00, 0x00, 0x08, 0x95, 0x44 },
+	{ 0xb1, 0x05, 0x51, 0x9f, 0x04, 0x4f, 0x44, 0x4f, 0x8e, 0x29, 0x00, 0x00, 0x00, 0x12, 0x90, 0x61 },
+	{ 0xd3, 0x7e, 0x7d, 0x23, 0x05, 0x13, 0x45, 0x13, 0x83, 0x85, 0x00, 0x00, 0x00, 0x19, 0xbf, 0x69 },
+	{ 0x2c, 0xf3, 0x97, 0x8e, 0x05, 0xee, 0x45, 0xee, 0x89, 0x82, 0x00, 0x00, 0x00, 0x23, 0x29, 0x44 },
+	{ 0x37, 0x2b, 0xe6, 0xa9, 0x02, 0x79, 0x42, 0x79, 0x81, 0x4f, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x31 },
+	{ 0x0a, 0x7a, 0x6c, 0x0a, 0x05, 0x2a, 0x45, 0x2a, 0x84, 0x26, 0x00, 0x00, 0x00, 0x1a, 0xaa, 0xe4 },
+	{ 0x51, 0xed, 0x3a, 0xf7, 0x01, 0x27, 0x41, 0x27, 0x88, 0x11, 0x00, 0x00, 0x00, 0x01, 0x53, 0xf1 },
+	{ 0xfe, 0x68, 0xe7, 0x20, 0x01, 0x20, 0x41, 0x20, 0x87, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x44, 0x00 },
+	{ 0x0c, 0x5f, 0x4f, 0x41, 0x02, 0x91, 0x42, 0x91, 0x81, 0xf7, 0x00, 0x00, 0x00, 0x06, 0x96, 0x21 },
+	{ 0x85, 0x6d, 0x2d, 0xc7, 0x04, 0xf7, 0x44, 0xf7, 0x82, 0xc1, 0x00, 0x00, 0x00, 0x18, 0xa6, 0x51 },
+	{ 0xa8, 0x34, 0x23, 0xa2, 0x04, 0x42, 0x44, 0x42, 0x8d, 0xce, 0x00, 0x00, 0x00, 0x12, 0x21, 0x04 },
+	{ 0xbd, 0x34, 0xa9, 0x1e, 0x04, 0x7e, 0x44, 0x7e, 0x8f, 0x72, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x04 },
+	{ 0x57, 0x72, 0x64, 0x9f, 0x07, 0x4f, 0x47, 0x4f, 0x83, 0x29, 0x00, 0x00, 0x00, 0x35, 0x6a, 0x61 },
+	{ 0xde, 0x16, 0xbb, 0xc2, 0x06, 0x62, 0x46, 0x62, 0x8c, 0xae, 0x00, 0x00, 0x00, 0x28, 0xbd, 0x84 },
+	{ 0xce, 0xa7, 0x0d, 0x56, 0x02, 0x36, 0x42, 0x36, 0x8f, 0x7a, 0x00, 0x00, 0x00, 0x04, 0xe3, 0x64 },
+	{ 0xc0, 0x92, 0xd2, 0xa0, 0x04, 0xa0, 0x44, 0xa0, 0x80, 0x60, 0x00, 0x00, 0x00, 0x15, 0x64, 0x00 },
+	{ 0x5a, 0x52, 0xcc, 0x08, 0x06, 0x88, 0x46, 0x88, 0x8d, 0xb8, 0x00, 0x00, 0x00, 0x2a, 0xa8, 0x40 },
+	{ 0xcb, 0x48, 0xe3, 0xd4, 0x02, 0x14, 0x42, 0x14, 0x8e, 0x8c, 0x00, 0x00, 0x00, 0x04, 0x51, 0x90 },
+	{ 0x65, 0x56, 0xa7, 0x93, 0x02, 0x83, 0x42, 0x83, 0x81, 0x95, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x09 },
+	{ 0x98, 0xc4, 0x75, 0x36, 0x00, 0x16, 0x40, 0x16, 0x80, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe4 },
+	{ 0xa7, 0xe6, 0x59, 0x4b, 0x05, 0xbb, 0x45, 0xbb, 0x88, 0x1d, 0x00, 0x00, 0x00, 0x20, 0xd6, 0x99 },
+	{ 0xe2, 0x10, 0x79, 0xf2, 0x03, 0x92, 0x43, 0x92, 0x88, 0xfe, 0x00, 0x00, 0x00, 0x0c, 0xbf, 0x44 },
+	{ 0x24, 0xa0, 0x2b, 0xaa, 0x06, 0xca, 0x46, 0xca, 0x8f, 0x86, 0x00, 0x00, 0x00, 0x2e, 0x17, 0x64 },
+	{ 0xae, 0x24, 0xea, 0x36, 0x05, 0x16, 0x45, 0x16, 0x83, 0x9a, 0x00, 0x00, 0x00, 0x19, 0xdd, 0xe4 },
+	{ 0x1e, 0x31, 0xa2, 0xfd, 0x05, 0x0d, 0x45, 0x0d, 0x83, 0x5b, 0x00, 0x00, 0x00, 0x19, 0x82, 0xa9 },
+	{ 0x81, 0xc1, 0x39, 0xee, 0x06, 0x4e, 0x46, 0x4e, 0x8c, 0x22, 0x00, 0x00, 0x00, 0x27, 0xbf, 0xc4 },
+	{ 0xce, 0x59, 0x42, 0xff, 0x03, 0xaf, 0x43, 0xaf, 0x89, 0xc9, 0x00, 0x00, 0x00, 0x0d, 0x91, 0xa1 },
+	{ 0x44, 0x86, 0xba, 0x1c, 0x06, 0xdc, 0x46, 0xdc, 0x80, 0x04, 0x00, 0x00, 0x00, 0x2f, 0x0d, 0x10 },
+	{ 0x65, 0x86, 0x9f, 0x55, 0x04, 0xe5, 0x44, 0xe5, 0x82, 0x43, 0x00, 0x00, 0x00, 0x17, 0xf4, 0xd9 },
+	{ 0x94, 0x7c, 0xec, 0xaf, 0x04, 0x5f, 0x44, 0x5f, 0x8e, 0x99, 0x00, 0x00, 0x00, 0x13, 0x1b, 0x41 },
+	{ 0x9a, 0x1f, 0xe8, 0xec, 0x06, 0xac, 0x46, 0xac, 0x8e, 0xb4, 0x00, 0x00, 0x00, 0x2c, 0x83, 0x90 },
+	{ 0x2d, 0xdc, 0xf6, 0x93, 0x01, 0x83, 0x41, 0x83, 0x8a, 0x95, 0x00, 0x00, 0x00, 0x02, 0x49, 0x09 },
+	{ 0x2b, 0x2c, 0x86, 0xec, 0x04, 0xac, 0x44, 0xac, 0x80, 0xb4, 0x00, 0x00, 0x00, 0x15, 0xd3, 0x90 },
+	{ 0xdc, 0x7f, 0xa2, 0xe2, 0x07, 0x82, 0x47, 0x82, 0x84, 0x8e, 0x00, 0x00, 0x00, 0x38, 0x5e, 0x04 },
+	{ 0x25, 0x89, 0x8a, 0xaf, 0x02, 0x5f, 0x42, 0x5f, 0x80, 0x99, 0x00, 0x00, 0x00, 0x05, 0x9f, 0x41 },
+	{ 0xe5, 0x9e, 0x9b, 0x36, 0x06, 0x16, 0x46, 0x16, 0x8a, 0x9a, 0x00, 0x00, 0x00, 0x25, 0x09, 0xe4 },
+	{ 0x53, 0x18, 0xb6, 0xeb, 0x05, 0x5b, 0x45, 0x5b, 0x85, 0x7d, 0x00, 0x00, 0x00, 0x1c, 0xae, 0x59 },
+	{ 0xc3, 0x43, 0x42, 0x47, 0x01, 0x77, 0x41, 0x77, 0x8a, 0x41, 0x00, 0x00, 0x00, 0x02, 0x25, 0x51 },
+	{ 0xb5, 0x4c, 0xda, 0x26, 0x00, 0x06, 0x40, 0x06, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24 },
+	{ 0x07, 0xe7, 0xce, 0xf8, 0x04, 0x78, 0x44, 0x78, 0x8f, 0x48, 0x00, 0x00, 0x00, 0x13, 0xf8, 0x40 },
+	{ 0xe3, 0xf5, 0x5d, 0x29, 0x00, 0xf9, 0x40, 0xf9, 0x86, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x31 },
+	{ 0x0e, 0xa4, 0x21, 0xfc, 0x04, 0xbc, 0x44, 0xbc, 0x81, 0x24, 0x00, 0x00, 0x00, 0x16, 0x6a, 0x10 },
+	{ 0x90, 0xd0, 0xf8, 0xd6, 0x05, 0xb6, 0x45, 0xb6, 0x87, 0xfa, 0x00, 0x00, 0x00, 0x20, 0x9d, 0x64 },
+	{ 0xf7, 0x40, 0xf7, 0x30, 0x06, 0x30, 0x46, 0x30, 0x8b, 0x50, 0x00, 0x00, 0x00, 0x26, 0x49, 0x00 },
+	{ 0xe4, 0x25, 0x54, 0xeb, 0x03, 0x5b, 0x43, 0x5b, 0x87, 0x7d, 0x00, 0x00, 0x00, 0x0b, 0x42, 0x59 },
+	{ 0xe9, 0x4a, 0x8f, 0x0f, 0x04, 0xbf, 0x44, 0xbf, 0x81, 0x39, 0x00, 0x00, 0x00, 0x16, 0x86, 0x81 },
+	{ 0x96, 0xdf, 0x91, 0xff, 0x02, 0xaf, 0x42, 0xaf, 0x82, 0xc9, 0x00, 0x00, 0x00, 0x07, 0x33, 0xa1 },
+	{ 0x20, 0xc4, 0x40, 0x0f, 0x05, 0xbf, 0x45, 0xbf, 0x88, 0x39, 0x00, 0x00, 0x00, 0x21, 0x04, 0x81 },
+	{ 0x5e, 0xfa, 0x44, 0x13, 0x07, 0x03, 0x47, 0x03, 0x81, 0x15, 0x00, 0x00, 0x00, 0x31, 0x2a, 0x09 },
+	{ 0x95, 0x18, 0x81, 0x5d, 0x01, 0x6d, 0x41, 0x6d, 0x89, 0xfb, 0x00, 0x00, 0x00, 0x02, 0x08, 0x69 },
+	{ 0x96, 0x14, 0x05, 0x8f, 0x03, 0x3f, 0x43, 0x3f, 0x86, 0xb9, 0x00, 0x00, 0x00, 0x0a, 0x89, 0x81 },
+	{ 0xfd, 0xeb, 0x25, 0x07, 0x00, 0x37, 0x40, 0x37, 0x81, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xd1 },
+	{ 0x5b, 0x1e, 0x58, 0x78, 0x05, 0xf8, 0x45, 0xf8, 0x89, 0xc8, 0x00, 0x00, 0x00, 0x23, 0xa0, 0x40 },
+	{ 0xe7, 0x65, 0xab, 0xd8, 0x07, 0x58, 0x47, 0x58, 0x83, 0x68, 0x00, 0x00, 0x00, 0x35, 0xee, 0x40 },
+	{ 0x76, 0xc9, 0x0b, 0xcb, 0x00, 0x3b, 0x40, 0x3b, 0x81, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x99 },
+	{ 0x7a, 0x39, 0x5a, 0x7a, 0x06, 0x9a, 0x46, 0x9a, 0x8e, 0x36, 0x00, 0x00, 0x00, 0x2b, 0x94, 0xa4 },
+	{ 0xfb, 0xe8, 0x6f, 0x3b, 0x06, 0xab, 0x46, 0xab, 0x8e, 0xad, 0x00, 0x00, 0x00, 0x2c, 0x76, 0x39 },
+	{ 0x0b, 0x45, 0xf8, 0x7a, 0x04, 0x9a, 0x44, 0x9a, 0x80, 0x36, 0x00, 0x00, 0x00, 0x15, 0x2c, 0xa4 },
+	{ 0xb3, 0x67, 0xf6, 0xef, 0x02, 0x9f, 0x42, 0x9f, 0x82, 0x59, 0x00, 0x00, 0x00, 0x06, 0xde, 0xc1 },
+	{ 0xdd, 0x4b, 0x2f, 0x52, 0x06, 0xf2, 0x46, 0xf2, 0x80, 0x9e, 0x00, 0x00, 0x00, 0x30, 0x3c, 0xc4 },
+	{ 0x77, 0xc4, 0x8f, 0xfd, 0x02, 0x0d, 0x42, 0x0d, 0x8e, 0x5b, 0x00, 0x00, 0x00, 0x04, 0x34, 0xa9 },
+	{ 0x14, 0x17, 0x26, 0x77, 0x04, 0xa7, 0x44, 0xa7, 0x80, 0x91, 0x00, 0x00, 0x00, 0x15, 0xa4, 0xf1 },
+	{ 0xb2, 0x6c, 0x72, 0xbd, 0x00, 0xcd, 0x40, 0xcd, 0x85, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x29 },
+	{ 0xdf, 0x00, 0x1a, 0xc7, 0x01, 0xf7, 0x41, 0xf7, 0x8d, 0xc1, 0x00, 0x00, 0x00, 0x03, 0xdc, 0x51 },
+	{ 0xb3, 0x4a, 0x24, 0x5a, 0x06, 0x7a, 0x46, 0x7a, 0x8d, 0x56, 0x00, 0x00, 0x00, 0x29, 0xf2, 0x24 },
+	{ 0x37, 0x0e, 0x14, 0x14, 0x06, 0x54, 0x46, 0x54, 0x8c, 0x4c, 0x00, 0x00, 0x00, 0x28, 0x0b, 0x90 },
+	{ 0xd1, 0x87, 0x74, 0xbf, 0x01, 0x6f, 0x41, 0x6f, 0x8a, 0x09, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x21 },
+	{ 0x24, 0x40, 0x3c, 0x26, 0x02, 0x06, 0x42, 0x06, 0x8e, 0x2a, 0x00, 0x00, 0x00, 0x04, 0x18, 0x24 },
+	{ 0x66, 0xcf, 0xed, 0xde, 0x05, 0x3e, 0x45, 0x3e, 0x84, 0xb2, 0x00, 0x00, 0x00, 0x1b, 0x7b, 0x04 },
+	{ 0xc7, 0x4f, 0x25, 0xa4, 0x04, 0xe4, 0x44, 0xe4, 0x82, 0x3c, 0x00, 0x00, 0x00, 0x17, 0xeb, 0x10 },
+	{ 0x72, 0x51, 0x8b, 0x82, 0x02, 0x22, 0x42, 0x22, 0x8e, 0xee, 0x00, 0x00, 0x00, 0x04, 0x8c, 0x84 },
+	{ 0x65, 0xd4, 0x69, 0xac, 0x03, 0x6c, 0x43, 0x6c, 0x87, 0xf4, 0x00, 0x00, 0x00, 0x0b, 0xb5, 0x90 },
+	{ 0x04, 0x59, 0xad, 0xb4, 0x01, 0xf4, 0x41, 0xf4, 0x8d, 0xac, 0x00, 0x00, 0x00, 0x03, 0xd0, 0x90 },
+	{ 0x64, 0x3d, 0x50, 0xcc, 0x04, 0x8c, 0x44, 0x8c, 0x8f, 0xd4, 0x00, 0x00, 0x00, 0x14, 0xac, 0x90 },
+	{ 0x8b, 0x10, 0x2a, 0x04, 0x07, 0x44, 0x47, 0x44, 0x82, 0xdc, 0x00, 0x00, 0x00, 0x34, 0xca, 0x10 },
+	{ 0x3c, 0xce, 0xe2, 0xe6, 0x04, 0xc6, 0x44, 0xc6, 0x81, 0x6a, 0x00, 0x00, 0x00, 0x16, 0xc9, 0x24 },
+	{ 0x2e, 0xba, 0xa8, 0x30, 0x07, 0x30, 0x47, 0x30, 0x82, 0x50, 0x00, 0x00, 0x00, 0x33, 0xa9, 0x00 },
+	{ 0x1d, 0x18, 0x4c, 0x36, 0x07, 0x16, 0x47, 0x16, 0x81, 0x9a, 0x00, 0x00, 0x00, 0x32, 0x35, 0xe4 },
+	{ 0x76, 0x2d, 0x77, 0x1d, 0x03, 0x2d, 0x43, 0x2d, 0x86, 0x3b, 0x00, 0x00, 0x00, 0x0a, 0x15, 0xe9 },
+	{ 0xe4, 0xc0, 0xe9, 0x99, 0x00, 0x69, 0x40, 0x69, 0x82, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x11 },
+	{ 0x1d, 0xe3, 0xd8, 0xa6, 0x06, 0x86, 0x46, 0x86, 0x8d, 0xaa, 0x00, 0x00, 0x00, 0x2a, 0x8e, 0x24 },
+	{ 0x7e, 0x63, 0x10, 0x6c, 0x06, 0x2c, 0x46, 0x2c, 0x8b, 0x34, 0x00, 0x00, 0x00, 0x26, 0x17, 0x90 },
+	{ 0x07, 0x9a, 0x04, 0xa1, 0x05, 0xf1, 0x45, 0xf1, 0x89, 0x97, 0x00, 0x00, 0x00, 0x23, 0x4c, 0xe1 },
+	{ 0xb4, 0xb1, 0x45, 0x78, 0x02, 0xf8, 0x42, 0xf8, 0x84, 0xc8, 0x00, 0x00, 0x00, 0x08, 0xd0, 0x40 },
+	{ 0xa9, 0xad, 0x69, 0xed, 0x06, 0xfd, 0x46, 0xfd, 0x80, 0xeb, 0x00, 0x00, 0x00, 0x30, 0xd6, 0x09 },
+	{ 0xc2, 0xc5, 0x80, 0x2e, 0x00, 0x8e, 0x40, 0x8e, 0x83, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc4 },
+	{ 0xbe, 0x1e, 0x08, 0x23, 0x00, 0x13, 0x40, 0x13, 0x80, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69 },
+	{ 0x97, 0xdb, 0x16, 0x31, 0x04, 0x81, 0x44, 0x81, 0x8f, 0x87, 0x00, 0x00, 0x00, 0x14, 0x49, 0x01 },
+	{ 0x3b, 0x85, 0x94, 0x5d, 0x04, 0x6d, 0x44, 0x6d, 0x8e, 0xfb, 0x00, 0x00, 0x00, 0x13, 0x96, 0x69 },
+	{ 0x6a, 0xab, 0xd9, 0x79, 0x06, 0x49, 0x46, 0x49, 0x8b, 0xff, 0x00, 0x00, 0x00, 0x27, 0x80, 0xd1 },
+	{ 0x56, 0x16, 0xf0, 0xe9, 0x00, 0xb9, 0x40, 0xb9, 0x85, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x85, 0xb1 },
+	{ 0xf7, 0x8e, 0xc1, 0x87, 0x04, 0xb7, 0x44, 0xb7, 0x81, 0x01, 0x00, 0x00, 0x00, 0x16, 0x3a, 0xd1 },
+	{ 0xd8, 0xc1, 0x89, 0xdc, 0x02, 0x9c, 0x42, 0x9c, 0x82, 0x44, 0x00, 0x00, 0x00, 0x06, 0xcf, 0x10 },
+	{ 0x3d, 0xe8, 0x39, 0xad, 0x02, 0xbd, 0x42, 0xbd, 0x83, 0x2b, 0x00, 0x00, 0x00, 0x07, 0x7f, 0x89 },
+	{ 0x9c, 0x34, 0xc3, 0xe5, 0x06, 0x75, 0x46, 0x75, 0x8d, 0x33, 0x00, 0x00, 0x00, 0x29, 0xb1, 0x79 },
+	{ 0xb5, 0xdc, 0xc1, 0x6c, 0x07, 0x2c, 0x47, 0x2c, 0x82, 0x34, 0x00, 0x00, 0x00, 0x33, 0x6f, 0x90 },
+	{ 0x4e, 0x11, 0x4f, 0x5c, 0x00, 0x1c, 0x40, 0x1c, 0x80, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10 },
+	{ 0x9c, 0xd0, 0x58, 0x93, 0x03, 0x83, 0x43, 0x83, 0x88, 0x95, 0x00, 0x00, 0x00, 0x0c, 0x55, 0x09 },
+	{ 0x56, 0xe2, 0x7d, 0x59, 0x00, 0x29, 0x40, 0x29, 0x81, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x91 },
+	{ 0x55, 0x5d, 0x89, 0xa6, 0x07, 0x86, 0x47, 0x86, 0x84, 0xaa, 0x00, 0x00, 0x00, 0x38, 0x9a, 0x24 },
+	{ 0x0d, 0x5a, 0xd3, 0x73, 0x04, 0x63, 0x44, 0x63, 0x8e, 0xb5, 0x00, 0x00, 0x00, 0x13, 0x3e, 0x49 },
+	{ 0xe6, 0xb7, 0xf1, 0xfd, 0x04, 0x0d, 0x44, 0x0d, 0x8c, 0x5b, 0x00, 0x00, 0x00, 0x10, 0x68, 0xa9 },
+	{ 0x08, 0x35, 0x99, 0x4f, 0x02, 0xff, 0x42, 0xff, 0x84, 0xf9, 0x00, 0x00, 0x00, 0x08, 0xfa, 0x01 },
+	{ 0xfd, 0xfd, 0x4a, 0x34, 0x06, 0x74, 0x46, 0x74, 0x8d, 0x2c, 0x00, 0x00, 0x00, 0x29, 0xa4, 0x90 },
+	{ 0xd4, 0x67, 0xdc, 0x28, 0x00, 0xa8, 0x40, 0xa8, 0x84, 0x98, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x40 },
+	{ 0xa9, 0x9b, 0x44, 0xc0, 0x00, 0xc0, 0x40, 0xc0, 0x85, 0x40, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00 },
+	{ 0x51, 0xff, 0x60, 0x24, 0x07, 0x64, 0x47, 0x64, 0x83, 0xbc, 0x00, 0x00, 0x00, 0x36, 0x9f, 0x10 },
+	{ 0x29, 0x35, 0x7e, 0x88, 0x01, 0x08, 0x41, 0x08, 0x87, 0x38, 0x00, 0x00, 0x00, 0x01, 0x10, 0x40 },
+	{ 0x10, 0xe8, 0xf4, 0xb7, 0x06, 0xe7, 0x46, 0xe7, 0x80, 0x51, 0x00, 0x00, 0x00, 0x2f, 0xa4, 0x71 },
+	{ 0x9e, 0xc7, 0x60, 0xf7, 0x07, 0x27, 0x47, 0x27, 0x82, 0x11, 0x00, 0x00, 0x00, 0x33, 0x27, 0xf1 },
+	{ 0x7a, 0x87, 0x24, 0xd1, 0x05, 0x21, 0x45, 0x21, 0x83, 0xe7, 0x00, 0x00, 0x00, 0x1a, 0x4e, 0x41 },
+	{ 0xbb, 0xbb, 0x62, 0xd3, 0x01, 0xc3, 0x41, 0xc3, 0x8c, 0x55, 0x00, 0x00, 0x00, 0x03, 0x1a, 0x89 },
+	{ 0xeb, 0xfa, 0xfe, 0xb6, 0x01, 0x96, 0x41, 0x96, 0x8b, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x83, 0xe4 },
+	{ 0x11, 0x84, 0x89, 0x65, 0x03, 0xf5, 0x43, 0xf5, 0x8b, 0xb3, 0x00, 0x00, 0x00, 0x0f, 0xa8, 0x79 },
+	{ 0x67, 0x9b, 0x7a, 0x4e, 0x04, 0xae, 0x44, 0xae, 0x80, 0xc2, 0x00, 0x00, 0x00, 0x15, 0xe6, 0x44 },
+	{ 0x8e, 0x3e, 0x5b, 0xc4, 0x05, 0x04, 0x45, 0x04, 0x83, 0x1c, 0x00, 0x00, 0x00, 0x19, 0x28, 0x10 },
+	{ 0x7b, 0x52, 0xb1, 0x41, 0x04, 0x91, 0x44, 0x91, 0x8f, 0xf7, 0x00, 0x00, 0x00, 0x14, 0xda, 0x21 },
+	{ 0xbc, 0x39, 0x24, 0xec, 0x02, 0xac, 0x42, 0xac, 0x82, 0xb4, 0x00, 0x00, 0x00, 0x07, 0x23, 0x90 },
+	{ 0xda, 0x3a, 0xd0, 0x27, 0x05, 0x57, 0x45, 0x57, 0x85, 0x61, 0x00, 0x00, 0x00, 0x1c, 0x83, 0x91 },
+	{ 0x61, 0x0f, 0x1f, 0x0c, 0x06, 0xcc, 0x46, 0xcc, 0x8f, 0x94, 0x00, 0x00, 0x00, 0x2e, 0x32, 0x90 },
+	{ 0xcc, 0x26, 0x95, 0x71, 0x07, 0xc1, 0x47, 0xc1, 0x86, 0x47, 0x00, 0x00, 0x00, 0x3c, 0x1f, 0x81 },
+	{ 0x01, 0xf7, 0x08, 0x64, 0x03, 0xa4, 0x43, 0xa4, 0x89, 0x7c, 0x00, 0x00, 0x00, 0x0d, 0x41, 0x10 },
+	{ 0x15, 0xde, 0x37, 0x19, 0x05, 0xe9, 0x45, 0xe9, 0x89, 0x5f, 0x00, 0x00, 0x00, 0x22, 0xee, 0x11 },
+	{ 0xbe, 0x30, 0x2d, 0x50, 0x06, 0x50, 0x46, 0x50, 0x8c, 0x30, 0x00, 0x00, 0x00, 0x27, 0xd9, 0x00 },
+	{ 0xf0, 0x06, 0xe2, 0x13, 0x05, 0x03, 0x45, 0x03, 0x83, 0x15, 0x00, 0x00, 0x00, 0x19, 0x1e, 0x09 },
+	{ 0x8a, 0x92, 0x67, 0xeb, 0x06, 0x5b, 0x46, 0x5b, 0x8c, 0x7d, 0x00, 0x00, 0x00, 0x28, 0x64, 0x59 },
+	{ 0xa3, 0x3e, 0xe1, 0x40, 0x05, 0x40, 0x45, 0x40, 0x84, 0xc0, 0x00, 0x00, 0x00, 0x1b, 0x90, 0x00 },
+	{ 0x05, 0x37, 0x5f, 0x51, 0x07, 0xa1, 0x47, 0xa1, 0x85, 0x67, 0x00, 0x00, 0x00, 0x3a, 0x33, 0x41 },
+	{ 0x1c, 0xe8, 0x54, 0x74, 0x04, 0xb4, 0x44, 0xb4, 0x80, 0xec, 0x00, 0x00, 0x00, 0x16, 0x1e, 0x90 },
+	{ 0xef, 0x59, 0x28, 0x38, 0x01, 0xb8, 0x41, 0xb8, 0x8c, 0x08, 0x00, 0x00, 0x00, 0x02, 0xf4, 0x40 },
+	{ 0xe3, 0xd7, 0x8a, 0x94, 0x04, 0xd4, 0x44, 0xd4, 0x81, 0xcc, 0x00, 0x00, 0x00, 0x17, 0x4f, 0x90 },
+	{ 0x85, 0x8b, 0x00, 0x5c, 0x01, 0x1c, 0x41, 0x1c, 0x87, 0xc4, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x10 },
+	{ 0xe2, 0x5e, 0x44, 0x49, 0x02, 0x19, 0x42, 0x19, 0x8e, 0xaf, 0x00, 0x00, 0x00, 0x04, 0x66, 0x71 },
+	{ 0xa9, 0x4d, 0x7a, 0x69, 0x02, 0x39, 0x42, 0x39, 0x8f, 0x8f, 0x00, 0x00, 0x00, 0x04, 0xf0, 0xb1 },
+	{ 0xcd, 0xab, 0x89, 0x24, 0x00, 0x64, 0x40, 0x64, 0x82, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x27, 0x10 },
+	{ 0x87, 0xb2, 0x00, 0x82, 0x07, 0x22, 0x47, 0x22, 0x81, 0xee, 0x00, 0x00, 0x00, 0x32, 0xe0, 0x84 },
+	{ 0xeb, 0x2f, 0x72, 0x46, 0x02, 0x26, 0x42, 0x26, 0x8f, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x9d, 0xa4 },
+	{ 0xdb, 0xd1, 0xe9, 0x07, 0x04, 0x37, 0x44, 0x37, 0x8d, 0x81, 0x00, 0x00, 0x00, 0x11, 0xc3, 0xd1 },
+	{ 0x65, 0x08, 0xdd, 0x3c, 0x03, 0xfc, 0x43, 0xfc, 0x8b, 0xe4, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x10 },
+	{ 0x99, 0x42, 0x37, 0x4f, 0x00, 0xff, 0x40, 0xff, 0x86, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01 },
+	{ 0x43, 0x2b, 0x46, 0x66, 0x00, 0x46, 0x40, 0x46, 0x81, 0xea, 0x00, 0x00, 0x00, 0x00, 0x13, 0x24 },
+	{ 0x05, 0xd2, 0xf3, 0xff, 0x04, 0xaf, 0x44, 0xaf, 0x80, 0xc9, 0x00, 0x00, 0x00, 0x15, 0xef, 0xa1 },
+	{ 0x52, 0x1d, 0x32, 0xb9, 0x03, 0x89, 0x43, 0x89, 0x88, 0xbf, 0x00, 0x00, 0x00, 0x0c, 0x7f, 0x51 },
+	{ 0xfc, 0xd1, 0xce, 0x40, 0x02, 0x40, 0x42, 0x40, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x05, 0x10, 0x00 },
+	{ 0x9c, 0x22, 0x9e, 0xb8, 0x00, 0x38, 0x40, 0x38, 0x81, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x40 },
+	{ 0x82, 0xaa, 0x98, 0xf3, 0x01, 0xe3, 0x41, 0xe3, 0x8d, 0x35, 0x00, 0x00, 0x00, 0x03, 0x8f, 0x49 },
+	{ 0x2a, 0x60, 0xfa, 0x7c, 0x05, 0x3c, 0x45, 0x3c, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x1b, 0x66, 0x10 },
+	{ 0xdd, 0x39, 0x0a, 0x25, 0x00, 0xb5, 0x40, 0xb5, 0x84, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf9 },
+	{ 0x02, 0x92, 0x9d, 0x12, 0x00, 0xb2, 0x40, 0xb2, 0x84, 0xde, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xc4 },
+	{ 0x5b, 0x89, 0xf5, 0x64, 0x00, 0xa4, 0x40, 0xa4, 0x84, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x69, 0x10 },
+	{ 0x89, 0xe4, 0xae, 0x10, 0x03, 0x10, 0x43, 0x10, 0x85, 0x70, 0x00, 0x00, 0x00, 0x09, 0x61, 0x00 },
+	{ 0xe6, 0x6a, 0x27, 0xa6, 0x05, 0x86, 0x45, 0x86, 0x86, 0xaa, 0x00, 0x00, 0x00, 0x1e, 0x82, 0x24 },
+	{ 0xfa, 0xec, 0xeb, 0x09, 0x04, 0xd9, 0x44, 0xd9, 0x81, 0xef, 0x00, 0x00, 0x00, 0x17, 0x7f, 0xf1 },
+	{ 0x27, 0x02, 0xd0, 0xfa, 0x05, 0x1a, 0x45, 0x1a, 0x83, 0xb6, 0x00, 0x00, 0x00, 0x1a, 0x06, 0xa4 },
+	{ 0xd8, 0x73, 0xbf, 0x85, 0x04, 0x15, 0x44, 0x15, 0x8c, 0x93, 0x00, 0x00, 0x00, 0x10, 0xa9, 0xb9 },
+	{ 0x9b, 0x87, 0x0a, 0x0a, 0x03, 0x2a, 0x43, 0x2a, 0x86, 0x26, 0x00, 0x00, 0x00, 0x0a, 0x02, 0xe4 },
+	{ 0x58, 0xa9, 0x8d, 0xfb, 0x01, 0x6b, 0x41, 0x6b, 0x89, 0xed, 0x00, 0x00, 0x00, 0x02, 0x02, 0xb9 },
+	{ 0x3c, 0x6e, 0xf3, 0x62, 0x00, 0x02, 0x40, 0x02, 0x80, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 },
+	{ 0xa0, 0x2e, 0x82, 0x15, 0x03, 0xa5, 0x43, 0xa5, 0x89, 0x83, 0x00, 0x00, 0x00, 0x0d, 0x48, 0x59 },
+	{ 0x14, 0x34, 0xf9, 0x0c, 0x00, 0xcc, 0x40, 0xcc, 0x85, 0x94, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x90 },
+	{ 0x48, 0xce, 0x42, 0xa3, 0x02, 0x93, 0x42, 0x93, 0x82, 0x05, 0x00, 0x00, 0x00, 0x06, 0xa0, 0x69 },
+	{ 0xd6, 0x7c, 0xb7, 0x21, 0x00, 0x71, 0x40, 0x71, 0x83, 0x17, 0x00, 0x00, 0x00, 0x00, 0x31, 0xe1 },
+	{ 0xbf, 0xf7, 0x3d, 0xf2, 0x07, 0x92, 0x47, 0x92, 0x84, 0xfe, 0x00, 0x00, 0x00, 0x39, 0x4f, 0x44 },
+	{ 0xfb, 0x3a, 0xb5, 0x60, 0x03, 0x60, 0x43, 0x60, 0x87, 0xa0, 0x00, 0x00, 0x00, 0x0b, 0x64, 0x00 },
+	{ 0xa7, 0x38, 0x9f, 0x70, 0x02, 0x70, 0x42, 0x70, 0x81, 0x10, 0x00, 0x00, 0x00, 0x05, 0xf1, 0x00 },
+	{ 0x09, 0x01, 0x25, 0xbf, 0x02, 0x6f, 0x42, 0x6f, 0x81, 0x09, 0x00, 0x00, 0x00, 0x05, 0xec, 0x21 },
+	{ 0xac, 0x10, 0x0f, 0x3d, 0x05, 0x4d, 0x45, 0x4d, 0x85, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x19, 0x29 },
+	{ 0x34, 0x4b, 0x7f, 0x40, 0x03, 0x40, 0x43, 0x40, 0x86, 0xc0, 0x00, 0x00, 0x00, 0x0a, 0x90, 0x00 },
+	{ 0xc4, 0xda, 0x5b, 0x27, 0x00, 0x57, 0x40, 0x57, 0x82, 0x61, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x91 },
+	{ 0x4e, 0xbf, 0x09, 0x37, 0x03, 0x67, 0x43, 0x67, 0x87, 0xd1, 0x00, 0x00, 0x00, 0x0b, 0x93, 0x71 },
+	{ 0x33, 0xaf, 0xea, 0x92, 0x06, 0x32, 0x46, 0x32, 0x8b, 0x5e, 0x00, 0x00, 0x00, 0x26, 0x61, 0xc4 },
+	{ 0xa8, 0xb1, 0xe5, 0xbb, 0x05, 0x2b, 0x45, 0x2b, 0x84, 0x2d, 0x00, 0x00, 0x00, 0x1a, 0xb5, 0x39 },
+	{ 0x17, 0xc3, 0x1a, 0x50, 0x03, 0x50, 0x43, 0x50, 0x87, 0x30, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00 },
+	{ 0xe5, 0xbc, 0x6d, 0xcb, 0x02, 0x3b, 0x42, 0x3b, 0x8f, 0x9d, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x99 },
+	{ 0x48, 0xb0, 0x70, 0x0e, 0x06, 0x6e, 0x46, 0x6e, 0x8d, 0x02, 0x00, 0x00, 0x00, 0x29, 0x57, 0x44 },
+	{ 0x7c, 0xe9, 0xca, 0x21, 0x03, 0x71, 0x43, 0x71, 0x88, 0x17, 0x00, 0x00, 0x00, 0x0b, 0xd7, 0xe1 },
+	{ 0x60, 0xdf, 0x27, 0x4a, 0x04, 0x6a, 0x44, 0x6a, 0x8e, 0xe6, 0x00, 0x00, 0x00, 0x13, 0x7b, 0xe4 },
+	{ 0x6f, 0xee, 0xe6, 0x32, 0x03, 0xd2, 0x43, 0xd2, 0x8a, 0xbe, 0x00, 0x00, 0x00, 0x0e, 0x98, 0x44 },
+	{ 0x2e, 0x0c, 0xee, 0x55, 0x03, 0xe5, 0x43, 0xe5, 0x8b, 0x43, 0x00, 0x00, 0x00, 0x0f, 0x2a, 0xd9 },
+	{ 0x51, 0x21, 0xae, 0x87, 0x01, 0xb7, 0x41, 0xb7, 0x8c, 0x01, 0x00, 0x00, 0x00, 0x02, 0xf0, 0xd1 },
+	{ 0xec, 0x48, 0xc9, 0x0d, 0x00, 0x1d, 0x40, 0x1d, 0x80, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x03, 0x49 },
+	{ 0xa2, 0x25, 0x8a, 0x79, 0x07, 0x49, 0x47, 0x49, 0x82, 0xff, 0x00, 0x00, 0x00, 0x35, 0x12, 0xd1 },
+	{ 0x1b, 0x03, 0x71, 0x3d, 0x07, 0x4d, 0x47, 0x4d, 0x83, 0x1b, 0x00, 0x00, 0x00, 0x35, 0x4d, 0x29 },
+	{ 0x64, 0xd8, 0xe5, 0x7a, 0x01, 0x9a, 0x41, 0x9a, 0x8b, 0x36, 0x00, 0x00, 0x00, 0x02, 0x90, 0xa4 },
+	{ 0x54, 0xfd, 0x9a, 0x22, 0x02, 0xc2, 0x42, 0xc2, 0x83, 0x4e, 0x00, 0x00, 0x00, 0x07, 0x9b, 0x04 },
+	{ 0x88, 0xfb, 0x4f, 0x0b, 0x07, 0x7b, 0x47, 0x7b, 0x84, 0x5d, 0x00, 0x00, 0x00, 0x37, 0xf5, 0x19 },
+	{ 0x9d, 0x7e, 0x12, 0x6e, 0x06, 0xce, 0x46, 0xce, 0x8f, 0xa2, 0x00, 0x00, 0x00, 0x2e, 0x4d, 0xc4 },
+	{ 0x5c, 0x85, 0x79, 0x96, 0x02, 0x76, 0x42, 0x76, 0x81, 0x3a, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x64 },
+	{ 0xaa, 0xf6, 0xb8, 0x76, 0x07, 0x56, 0x47, 0x56, 0x83, 0x5a, 0x00, 0x00, 0x00, 0x35, 0xd0, 0xe4 },
+	{ 0x75, 0x61, 0xea, 0xad, 0x03, 0xbd, 0x43, 0xbd, 0x8a, 0x2b, 0x00, 0x00, 0x00, 0x0d, 0xf9, 0x89 },
+	{ 0xab, 0x14, 0x8b, 0x0b, 0x03, 0x7b, 0x43, 0x7b, 0x88, 0x5d, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x19 },
+	{ 0x74, 0x96, 0x5e, 0x3d, 0x04, 0x4d, 0x44, 0x4d, 0x8e, 0x1b, 0x00, 0x00, 0x00, 0x12, 0x7f, 0x29 },
+	{ 0x69, 0xfe, 0x1f, 0x9e, 0x02, 0xfe, 0x42, 0xfe, 0x84, 0xf2, 0x00, 0x00, 0x00, 0x08, 0xf4, 0x04 },
+	{ 0xdd, 0x98, 0xf9, 0xa9, 0x05, 0x79, 0x45, 0x79, 0x86, 0x4f, 0x00, 0x00, 0x00, 0x1d, 0xf3, 0x31 },
+	{ 0x58, 0x5b, 0xc3, 0xa4, 0x02, 0xe4, 0x42, 0xe4, 0x84, 0x3c, 0x00, 0x00, 0x00, 0x08, 0x5b, 0x10 },
+	{ 0xe7, 0x83, 0x7e, 0x6d, 0x03, 0x7d, 0x43, 0x7d, 0x88, 0x6b, 0x00, 0x00, 0x00, 0x0c, 0x2b, 0x09 },
+	{ 0xf0, 0x54, 0xac, 0x6a, 0x03, 0x8a, 0x43, 0x8a, 0x88, 0xc6, 0x00, 0x00, 0x00, 0x0c, 0x86, 0x64 },
+	{ 0x91, 0xcc, 0x7d, 0x08, 0x07, 0x88, 0x47, 0x88, 0x84, 0xb8, 0x00, 0x00, 0x00, 0x38, 0xb8, 0x40 },
+	{ 0xc8, 0xe6, 0x3e, 0x84, 0x03, 0xc4, 0x43, 0xc4, 0x8a, 0x5c, 0x00, 0x00, 0x00, 0x0e, 0x2e, 0x10 },
+	{ 0xc1, 0xdc, 0x21, 0x29, 0x04, 0xf9, 0x44, 0xf9, 0x82, 0xcf, 0x00, 0x00, 0x00, 0x18, 0xba, 0x31 },
+	{ 0x46, 0xb9, 0x67, 0xaa, 0x02, 0xca, 0x42, 0xca, 0x83, 0x86, 0x00, 0x00, 0x00, 0x07, 0xc7, 0x64 },
+	{ 0xd4, 0xe5, 0x9e, 0x41, 0x01, 0x91, 0x41, 0x91, 0x8a, 0xf7, 0x00, 0x00, 0x00, 0x02, 0x74, 0x21 },
+	{ 0x1a, 0x07, 0xed, 0x0b, 0x05, 0x7b, 0x45, 0x7b, 0x86, 0x5d, 0x00, 0x00, 0x00, 0x1e, 0x09, 0x19 },
+	{ 0xff, 0xb2, 0x35, 0xa9, 0x01, 0x79, 0x41, 0x79, 0x8a, 0x4f, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x31 },
+	{ 0x8c, 0x77, 0x4b, 0x22, 0x03, 0xc2, 0x43, 0xc2, 0x8a, 0x4e, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x04 },
+	{ 0x8c, 0x47, 0x53, 0x60, 0x01, 0x60, 0x41, 0x60, 0x89, 0xa0, 0x00, 0x00, 0x00, 0x01, 0xe4, 0x00 },
+	{ 0xca, 0xcb, 0x21, 0xbb, 0x01, 0x2b, 0x41, 0x2b, 0x88, 0x2d, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x39 },
+	{ 0x63, 0xbf, 0x8e, 0xb3, 0x03, 0xa3, 0x43, 0xa3, 0x89, 0x75, 0x00, 0x00, 0x00, 0x0d, 0x39, 0xc9 },
+	{ 0x97, 0x8d, 0x4b, 0xda, 0x05, 0xfa, 0x45, 0xfa, 0x89, 0xd6, 0x00, 0x00, 0x00, 0x23, 0xb8, 0x24 },
+	{ 0x50, 0xa3, 0xec, 0x6e, 0x00, 0xce, 0x40, 0xce, 0x85, 0xa2, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xc4 },
+	{ 0x8d, 0x42, 0xd7, 0x92, 0x03, 0x32, 0x43, 0x32, 0x86, 0x5e, 0x00, 0x00, 0x00, 0x0a, 0x35, 0xc4 },
+	{ 0xb1, 0xb3, 0x0b, 0x7a, 0x07, 0x9a, 0x47, 0x9a, 0x85, 0x36, 0x00, 0x00, 0x00, 0x39, 0xc8, 0xa4 },
+	{ 0xe7, 0x53, 0x86, 0xab, 0x01, 0x1b, 0x41, 0x1b, 0x87, 0xbd, 0x00, 0x00, 0x00, 0x01, 0x38, 0xd9 },
+	{ 0x02, 0x44, 0xd2, 0xbb, 0x02, 0x2b, 0x42, 0x2b, 0x8f, 0x2d, 0x00, 0x00, 0x00, 0x04, 0xb3, 0x39 },
+	{ 0xad, 0x59, 0x5d, 0xc6, 0x05, 0xa6, 0x45, 0xa6, 0x87, 0x8a, 0x00, 0x00, 0x00, 0x1f, 0xe7, 0xa4 },
+	{ 0xde, 0xb2, 0x50, 0x70, 0x03, 0x70, 0x43, 0x70, 0x88, 0x10, 0x00, 0x00, 0x00, 0x0b, 0xd1, 0x00 },
+	{ 0x53, 0xe4, 0x43, 0x5b, 0x04, 0xcb, 0x44, 0xcb, 0x81, 0x8d, 0x00, 0x00, 0x00, 0x16, 0xf8, 0xf9 },
+	{ 0x3a, 0x6c, 0x3d, 0x96, 0x06, 0x76, 0x46, 0x76, 0x8d, 0x3a, 0x00, 0x00, 0x00, 0x29, 0xbe, 0x64 },
+	{ 0x4a, 0x47, 0x88, 0xee, 0x05, 0x4e, 0x45, 0x4e, 0x85, 0x22, 0x00, 0x00, 0x00, 0x1c, 0x23, 0xc4 },
+	{ 0x03, 0x70, 0x4e, 0xaf, 0x06, 0x5f, 0x46, 0x5f, 0x8c, 0x99, 0x00, 0x00, 0x00, 0x28, 0x97, 0x41 },
+	{ 0x01, 0x49, 0x4e, 0x89, 0x00, 0x59, 0x40, 0x59, 0x82, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf1 },
+	{ 0xa7, 0x1a, 0xcc, 0xdb, 0x06, 0x4b, 0x46, 0x4b, 0x8c, 0x0d, 0x00, 0x00, 0x00, 0x27, 0x99, 0xf9 },
+	{ 0xc9, 0x16, 0x36, 0x46, 0x06, 0x26, 0x46, 0x26, 0x8b, 0x0a, 0x00, 0x00, 0x00, 0x25, 0xcd, 0xa4 },
+	{ 0xbd, 0xb2, 0x6b, 0x37, 0x05, 0x67, 0x45, 0x67, 0x85, 0xd1, 0x00, 0x00, 0x00, 0x1d, 0x2f, 0x71 },
+	{ 0xbc, 0x09, 0x2d, 0x2a, 0x00, 0x4a, 0x40, 0x4a, 0x82, 0x06, 0x00, 0x00, 0x00, 0x00, 0x15, 0x64 },
+	{ 0xb1, 0xa0, 0xe6, 0x4d, 0x01, 0x5d, 0x41, 0x5d, 0x89, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xdb, 0xc9 },
+	{ 0xf1, 0x6e, 0x03, 0x31, 0x01, 0x81, 0x41, 0x81, 0x8a, 0x87, 0x00, 0x00, 0x00, 0x02, 0x43, 0x01 },
+	{ 0x54, 0xdf, 0xc7, 0x8d, 0x06, 0x9d, 0x46, 0x9d, 0x8e, 0x4b, 0x00, 0x00, 0x00, 0x2b, 0xbc, 0x49 },
+	{ 0xda, 0xa6, 0x6d, 0x13, 0x00, 0x03, 0x40, 0x03, 0x80, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09 },
+	{ 0x29, 0x47, 0xa3, 0xb5, 0x07, 0x45, 0x47, 0x45, 0x82, 0xe3, 0x00, 0x00, 0x00, 0x34, 0xd8, 0x99 },
+	{ 0xd3, 0xcc, 0x47, 0x7a, 0x03, 0x9a, 0x43, 0x9a, 0x89, 0x36, 0x00, 0x00, 0x00, 0x0c, 0xf8, 0xa4 },
+	{ 0x62, 0x58, 0x6d, 0x95, 0x07, 0x25, 0x47, 0x25, 0x82, 0x03, 0x00, 0x00, 0x00, 0x33, 0x0b, 0x59 },
+	{ 0x56, 0x46, 0xe8, 0xab, 0x03, 0x1b, 0x43, 0x1b, 0x85, 0xbd, 0x00, 0x00, 0x00, 0x09, 0xa4, 0xd9 },
+	{ 0x47, 0x84, 0xf4, 0x1a, 0x02, 0x3a, 0x42, 0x3a, 0x8f, 0x96, 0x00, 0x00, 0x00, 0x04, 0xf5, 0x24 },
+	{ 0x25, 0x0b, 0xc8, 0x96, 0x01, 0x76, 0x41, 0x76, 0x8a, 0x3a, 0x00, 0x00, 0x00, 0x02, 0x22, 0x64 },
+	{ 0x6c, 0x90, 0xbc, 0xb0, 0x03, 0xb0, 0x43, 0xb0, 0x89, 0xd0, 0x00, 0x00, 0x00, 0x0d, 0x99, 0x00 },
+	{ 0x29, 0x65, 0x76, 0x4a, 0x03, 0x6a, 0x43, 0x6a, 0x87, 0xe6, 0x00, 0x00, 0x00, 0x0b, 0xa7, 0xe4 },
+	{ 0xbd, 0xd0, 0x3d, 0xcc, 0x01, 0x8c, 0x41, 0x8c, 0x8a, 0xd4, 0x00, 0x00, 0x00, 0x02, 0x64, 0x90 },
+	{ 0x5a, 0x70, 0x9e, 0x9d, 0x02, 0xad, 0x42, 0xad, 0x82, 0xbb, 0x00, 0x00, 0x00, 0x07, 0x28, 0xe9 },
+	{ 0x28, 0x1c, 0x27, 0xc1, 0x03, 0x11, 0x43, 0x11, 0x85, 0x77, 0x00, 0x00, 0x00, 0x09, 0x67, 0x21 },
+	{ 0x6d, 0x8c, 0x40, 0xe2, 0x05, 0x82, 0x45, 0x82, 0x86, 0x8e, 0x00, 0x00, 0x00, 0x1e, 0x56, 0x04 },
+	{ 0xac, 0xab, 0xa3, 0xeb, 0x02, 0x5b, 0x42, 0x5b, 0x80, 0x7d, 0x00, 0x00, 0x00, 0x05, 0x8c, 0x59 },
+	{ 0x1f, 0xaa, 0xe9, 0x48, 0x07, 0xc8, 0x47, 0xc8, 0x86, 0x78, 0x00, 0x00, 0x00, 0x3c, 0x8c, 0x40 },
+	{ 0xa6, 0x9d, 0x0a, 0xc2, 0x05, 0x62, 0x45, 0x62, 0x85, 0xae, 0x00, 0x00, 0x00, 0x1c, 0xf9, 0x84 },
+	{ 0x08, 0xd1, 0x2d, 0xfd, 0x00, 0x0d, 0x40, 0x0d, 0x80, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9 },
+	{ 0x7d, 0x67, 0x8c, 0x3a, 0x04, 0x5a, 0x44, 0x5a, 0x8e, 0x76, 0x00, 0x00, 0x00, 0x12, 0xef, 0xa4 },
+	{ 0x4f, 0x5a, 0x9d, 0xe5, 0x00, 0x75, 0x40, 0x75, 0x83, 0x33, 0x00, 0x00, 0x00, 0x00, 0x35, 0x79 },
+	{ 0x64, 0x8b, 0x1b, 0x23, 0x03, 0x13, 0x43, 0x13, 0x85, 0x85, 0x00, 0x00, 0x00, 0x09, 0x73, 0x69 },
+	{ 0xe8, 0x9c, 0xd5, 0x34, 0x01, 0x74, 0x41, 0x74, 0x8a, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x90 },
+	{ 0x72, 0xcf, 0x4d, 0x9b, 0x03, 0x0b, 0x43, 0x0b, 0x85, 0x4d, 0x00, 0x00, 0x00, 0x09, 0x42, 0x79 },
+	{ 0x84, 0x23, 0xdf, 0x3e, 0x04, 0x9e, 0x44, 0x9e, 0x80, 0x52, 0x00, 0x00, 0x00, 0x15, 0x51, 0x84 },
+	{ 0xf5, 0xa9, 0xde, 0x50, 0x07, 0x50, 0x47, 0x50, 0x83, 0x30, 0x00, 0x00, 0x00, 0x35, 0x79, 0x00 },
+	{ 0x0b, 0xe1, 0x8d, 0x28, 0x01, 0xa8, 0x41, 0xa8, 0x8b, 0x98, 0x00, 0x00, 0x00, 0x02, 0xbe, 0x40 },
+	{ 0x75, 0xfd, 0x7f, 0x5b, 0x00, 0xcb, 0x40, 0xcb, 0x85, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xf9 },
+	{ 0xbe, 0xfb, 0xb9, 0xc0, 0x05, 0xc0, 0x45, 0xc0, 0x88, 0x40, 0x00, 0x00, 0x00, 0x21, 0x10, 0x00 },
+	{ 0x91, 0xba, 0x57, 0xdb, 0x01, 0x4b, 0x41, 0x4b, 0x89, 0x0d, 0x00, 0x00, 0x00, 0x01, 0xab, 0xf9 },
+	{ 0x9e, 0x49, 0x9e, 0xde, 0x06, 0x3e, 0x46, 0x3e, 0x8b, 0xb2, 0x00, 0x00, 0x00, 0x26, 0xf7, 0x04 },
+	{ 0x9f, 0x32, 0xfd, 0xe3, 0x01, 0xd3, 0x41, 0xd3, 0x8c, 0xc5, 0x00, 0x00, 0x00, 0x03, 0x53, 0xe9 },
+	{ 0x14, 0x94, 0xe8, 0x90, 0x05, 0x90, 0x45, 0x90, 0x86, 0xf0, 0x00, 0x00, 0x00, 0x1e, 0xf1, 0x00 },
+	{ 0x1f, 0x1b, 0x02, 0x02, 0x00, 0xa2, 0x40, 0xa2, 0x84, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x66, 0x84 },
+	{ 0x04, 0xb9, 0x9d, 0x38, 0x06, 0xb8, 0x46, 0xb8, 0x8f, 0x08, 0x00, 0x00, 0x00, 0x2d, 0x24, 0x40 },
+	{ 0x33, 0x4f, 0xfb, 0x0e, 0x01, 0x6e, 0x41, 0x6e, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x44 },
+	{ 0xfc, 0x36, 0x39, 0x92, 0x05, 0x32, 0x45, 0x32, 0x84, 0x5e, 0x00, 0x00, 0x00, 0x1a, 0xfd, 0xc4 },
+	{ 0xfd, 0x4f, 0x90, 0x59, 0x03, 0x29, 0x43, 0x29, 0x86, 0x1f, 0x00, 0x00, 0x00, 0x09, 0xfc, 0x91 },
+	{ 0xba, 0xa2, 0x0c, 0x0c, 0x03, 0xcc, 0x43, 0xcc, 0x8a, 0x94, 0x00, 0x00, 0x00, 0x0e, 0x6a, 0x90 },
+	{ 0x25, 0xd7, 0x55, 0x06, 0x00, 0xe6, 0x40, 0xe6, 0x86, 0x4a, 0x00, 0x00, 0x00, 0x00, 0xce, 0xa4 },
+	{ 0xb0, 0x57, 0x97, 0xc4, 0x01, 0x04, 0x41, 0x04, 0x87, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x08, 0x10 },
+	{ 0xad, 0x0b, 0x93, 0x6f, 0x07, 0x1f, 0x47, 0x1f, 0x81, 0xd9, 0x00, 0x00, 0x00, 0x32, 0xb5, 0xc1 },
+	{ 0x4b, 0xfc, 0x74, 0x63, 0x00, 0x53, 0x40, 0x53, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xe9 },
+	{ 0xe5, 0x3e, 0xab, 0xb2, 0x01, 0x52, 0x41, 0x52, 0x89, 0x3e, 0x00, 0x00, 0x00, 0x01, 0xbe, 0x44 },
+	{ 0x31, 0xe8, 0xd9, 0xf0, 0x04, 0xf0, 0x44, 0xf0, 0x82, 0x90, 0x00, 0x00, 0x00, 0x18, 0x61, 0x00 },
+	{ 0xcf, 0x06, 0xfc, 0xda, 0x06, 0xfa, 0x46, 0xfa, 0x80, 0xd6, 0x00, 0x00, 0x00, 0x30, 0xac, 0x24 },
+	{ 0x2b, 0xf8, 0x13, 0x5c, 0x04, 0x1c, 0x44, 0x1c, 0x8c, 0xc4, 0x00, 0x00, 0x00, 0x10, 0xe3, 0x10 },
+	{ 0xc0, 0x62, 0xda, 0xde, 0x02, 0x3e, 0x42, 0x3e, 0x8f, 0xb2, 0x00, 0x00, 0x00, 0x05, 0x07, 0x04 },
+	{ 0x0d, 0x78, 0xa6, 0x08, 0x00, 0x88, 0x40, 0x88, 0x83, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40 },
+	{ 0x08, 0x83, 0x63, 0xa6, 0x01, 0x86, 0x41, 0x86, 0x8a, 0xaa, 0x00, 0x00, 0x00, 0x02, 0x52, 0x24 },
+	{ 0x1c, 0x1c, 0xc8, 0x04, 0x05, 0x44, 0x45, 0x44, 0x84, 0xdc, 0x00, 0x00, 0x00, 0x1b, 0xba, 0x10 },
+	{ 0x29, 0x95, 0x6e, 0x0c, 0x05, 0xcc, 0x45, 0xcc, 0x88, 0x94, 0x00, 0x00, 0x00, 0x21, 0x9a, 0x90 },
+	{ 0x4a, 0x17, 0x91, 0x2c, 0x02, 0xec, 0x42, 0xec, 0x84, 0x74, 0x00, 0x00, 0x00, 0x08, 0x89, 0x90 },
+	{ 0x7c, 0xb9, 0xd2, 0x5f, 0x01, 0x0f, 0x41, 0x0f, 0x87, 0x69, 0x00, 0x00, 0x00, 0x01, 0x1e, 0xe1 },
+	{ 0xb5, 0x2f, 0x07, 0x91, 0x03, 0xe1, 0x43, 0xe1, 0x8b, 0x27, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0xc1 },
+	{ 0x11, 0x54, 0x91, 0xa3, 0x01, 0x93, 0x41, 0x93, 0x8b, 0x05, 0x00, 0x00, 0x00, 0x02, 0x7a, 0x69 },
+	{ 0xcd, 0xbd, 0xae, 0x51, 0x06, 0xa1, 0x46, 0xa1, 0x8e, 0x67, 0x00, 0x00, 0x00, 0x2b, 0xf1, 0x41 },
+	{ 0x2e, 0x2a, 0xc0, 0xea, 0x00, 0x0a, 0x40, 0x0a, 0x80, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64 },
+	{ 0xb3, 0xb5, 0xc1, 0x46, 0x01, 0x26, 0x41, 0x26, 0x88, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x51, 0xa4 },
+	{ 0x4c, 0x0e, 0x99, 0x90, 0x06, 0x90, 0x46, 0x90, 0x8d, 0xf0, 0x00, 0x00, 0x00, 0x2b, 0x11, 0x00 },
+	{ 0x31, 0x1d, 0x4d, 0x80, 0x05, 0x80, 0x45, 0x80, 0x86, 0x80, 0x00, 0x00, 0x00, 0x1e, 0x40, 0x00 },
+	{ 0x60, 0x13, 0x9a, 0xda, 0x04, 0xfa, 0x44, 0xfa, 0x82, 0xd6, 0x00, 0x00, 0x00, 0x18, 0xc4, 0x24 },
+	{ 0x30, 0x21, 0xc9, 0x4e, 0x03, 0xae, 0x43, 0xae, 0x89, 0xc2, 0x00, 0x00, 0x00, 0x0d, 0x8a, 0x44 },
+	{ 0xd9, 0x0f, 0x54, 0x33, 0x01, 0x23, 0x41, 0x23, 0x87, 0xf5, 0x00, 0x00, 0x00, 0x01, 0x4a, 0xc9 },
+	{ 0xfa, 0x51, 0x56, 0x5b, 0x07, 0xcb, 0x47, 0xcb, 0x86, 0x8d, 0x00, 0x00, 0x00, 0x3c, 0xba, 0xf9 },
+	{ 0x4e, 0x8f, 0x11, 0x75, 0x01, 0x05, 0x41, 0x05, 0x87, 0x23, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x19 },
+	{ 0xb4, 0x63, 0x7b, 0x21, 0x04, 0x71, 0x44, 0x71, 0x8f, 0x17, 0x00, 0x00, 0x00, 0x13, 0xb9, 0xe1 },
+	{ 0x8e, 0x8c, 0x26, 0x1b, 0x03, 0x8b, 0x43, 0x8b, 0x88, 0xcd, 0x00, 0x00, 0x00, 0x0c, 0x8d, 0x79 },
+	{ 0x90, 0x53, 0x36, 0xbd, 0x04, 0xcd, 0x44, 0xcd, 0x81, 0x9b, 0x00, 0x00, 0x00, 0x17, 0x0c, 0x29 },
+	{ 0xd6, 0xac, 0xae, 0xe3, 0x02, 0xd3, 0x42, 0xd3, 0x83, 0xc5, 0x00, 0x00, 0x00, 0x07, 0xf9, 0xe9 },
+	{ 0x01, 0x5b, 0x73, 0xb6, 0x06, 0x96, 0x46, 0x96, 0x8e, 0x1a, 0x00, 0x00, 0x00, 0x2b, 0x5f, 0xe4 },
+	{ 0xb0, 0x69, 0xbc, 0xf1, 0x07, 0x41, 0x47, 0x41, 0x82, 0xc7, 0x00, 0x00, 0x00, 0x34, 0x9e, 0x81 },
+	{ 0xa0, 0xdc, 0x3b, 0xf0, 0x06, 0xf0, 0x46, 0xf0, 0x80, 0x90, 0x00, 0x00, 0x00, 0x30, 0x21, 0x00 },
+	{ 0xb6, 0x48, 0x5e, 0x58, 0x01, 0xd8, 0x41, 0xd8, 0x8c, 0xe8, 0x00, 0x00, 0x00, 0x03, 0x66, 0x40 },
+	{ 0x88, 0x6b, 0x67, 0xc5, 0x00, 0x55, 0x40, 0x55, 0x82, 0x53, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x39 },
+	{ 0xb1, 0xd0, 0xde, 0x0f, 0x03, 0xbf, 0x43, 0xbf, 0x8a, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x81 },
+	{ 0xe3, 0x77, 0x9b, 0x10, 0x00, 0x10, 0x40, 0x10, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00 },
+	{ 0x0c, 0xad, 0x19, 0x98, 0x01, 0x18, 0x41, 0x18, 0x87, 0xa8, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40 },
+	{ 0xa7, 0x86, 0x69, 0xc7, 0x00, 0xf7, 0x40, 0xf7, 0x86, 0xc1, 0x00, 0x00, 0x00, 0x00, 0xee, 0x51 },
+	{ 0x0f, 0x3f, 0xb6, 0xaa, 0x01, 0xca, 0x41, 0xca, 0x8c, 0x86, 0x00, 0x00, 0x00, 0x03, 0x33, 0x64 },
+	{ 0xaa, 0x19, 0x06, 0xd9, 0x01, 0xa9, 0x41, 0xa9, 0x8b, 0x9f, 0x00, 0x00, 0x00, 0x02, 0xc1, 0x91 },
+	{ 0xd6, 0xfa, 0x79, 0x3a, 0x01, 0x5a, 0x41, 0x5a, 0x89, 0x76, 0x00, 0x00, 0x00, 0x01, 0xd3, 0xa4 },
+	{ 0x31, 0x6b, 0x17, 0xd7, 0x04, 0x07, 0x44, 0x07, 0x8c, 0x31, 0x00, 0x00, 0x00, 0x10, 0x38, 0x31 },
+	{ 0xe9, 0xc8, 0x51, 0x28, 0x05, 0xa8, 0x45, 0xa8, 0x87, 0x98, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x40 },
+	{ 0x73, 0xca, 0xd1, 0xcd, 0x04, 0xdd, 0x44, 0xdd, 0x82, 0x0b, 0x00, 0x00, 0x00, 0x17, 0xa6, 0xc9 },
+	{ 0xb4, 0xff, 0x0f, 0xcf, 0x01, 0x7f, 0x41, 0x7f, 0x8a, 0x79, 0x00, 0x00, 0x00, 0x02, 0x3d, 0x01 },
+	{ 0x69, 0xb0, 0x55, 0x47, 0x04, 0x77, 0x44, 0x77, 0x8f, 0x41, 0x00, 0x00, 0x00, 0x13, 0xef, 0x51 },
+	{ 0x07, 0x6a, 0x0c, 0xdf, 0x03, 0x8f, 0x43, 0x8f, 0x88, 0xe9, 0x00, 0x00, 0x00, 0x0c, 0xa9, 0xe1 },
+	{ 0xec, 0x5a, 0xee, 0x3a, 0x06, 0x5a, 0x46, 0x5a, 0x8c, 0x76, 0x00, 0x00, 0x00, 0x28, 0x57, 0xa4 },
+	{ 0x91, 0x1e, 0xc3, 0x2d, 0x04, 0x3d, 0x44, 0x3d, 0x8d, 0xab, 0x00, 0x00, 0x00, 0x11, 0xf6, 0x89 },
+	{ 0x74, 0x18, 0x9c, 0x24, 0x03, 0x64, 0x43, 0x64, 0x87, 0xbc, 0x00, 0x00, 0x00, 0x0b, 0x7f, 0x10 },
+	{ 0x37, 0xd9, 0xa0, 0x84, 0x05, 0xc4, 0x45, 0xc4, 0x88, 0x5c, 0x00, 0x00, 0x00, 0x21, 0x3e, 0x10 },
+	{ 0xf7, 0x5e, 0xc9, 0xc5, 0x02, 0x55, 0x42, 0x55, 0x80, 0x53, 0x00, 0x00, 0x00, 0x05, 0x70, 0x39 },
+	{ 0x15, 0xae, 0x3f, 0x57, 0x03, 0x87, 0x43, 0x87, 0x88, 0xb1, 0x00, 0x00, 0x00, 0x0c, 0x71, 0x31 },
+	{ 0xdb, 0xa1, 0xf1, 0x45, 0x01, 0xd5, 0x41, 0xd5, 0x8c, 0xd3, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x39 },
+	{ 0x04, 0xa7, 0x78, 0x0b, 0x00, 0x7b, 0x40, 0x7b, 0x83, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x19 },
+	{ 0xbb, 0x4f, 0xc5, 0xe7, 0x07, 0x17, 0x47, 0x17, 0x81, 0xa1, 0x00, 0x00, 0x00, 0x32, 0x44, 0x11 },
+	{ 0x06, 0x20, 0xbe, 0x56, 0x03, 0x36, 0x43, 0x36, 0x86, 0x7a, 0x00, 0x00, 0x00, 0x0a, 0x4f, 0x64 },
+	{ 0x7e, 0x03, 0x20, 0xe8, 0x01, 0x68, 0x41, 0x68, 0x89, 0xd8, 0x00, 0x00, 0x00, 0x01, 0xfa, 0x40 },
+	{ 0xdf, 0xfb, 0x9e, 0xf9, 0x03, 0xc9, 0x43, 0xc9, 0x8a, 0x7f, 0x00, 0x00, 0x00, 0x0e, 0x53, 0xd1 },
+	{ 0xee, 0x6f, 0xc9, 0x33, 0x06, 0x23, 0x46, 0x23, 0x8a, 0xf5, 0x00, 0x00, 0x00, 0x25, 0xa8, 0xc9 },
+	{ 0xfc, 0x06, 0x41, 0xd0, 0x02, 0xd0, 0x42, 0xd0, 0x83, 0xb0, 0x00, 0x00, 0x00, 0x07, 0xe9, 0x00 },
+	{ 0x2f, 0x74, 0x0f, 0x73, 0x00, 0x63, 0x40, 0x63, 0x82, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x26, 0x49 },
+	{ 0x69, 0x14, 0xc0, 0x99, 0x07, 0x69, 0x47, 0x69, 0x83, 0xdf, 0x00, 0x00, 0x00, 0x36, 0xe9, 0x11 },
+	{ 0xb9, 0x3a, 0xea, 0xee, 0x07, 0x4e, 0x47, 0x4e, 0x83, 0x22, 0x00, 0x00, 0x00, 0x35, 0x5b, 0xc4 },
+	{ 0x38, 0x75, 0x35, 0x32, 0x02, 0xd2, 0x42, 0xd2, 0x83, 0xbe, 0x00, 0x00, 0x00, 0x07, 0xf4, 0x44 },
+	{ 0x19, 0xa7, 0xfd, 0x87, 0x00, 0xb7, 0x40, 0xb7, 0x85, 0x01, 0x00, 0x00, 0x00, 0x00, 0x82, 0xd1 },
+	{ 0x4a, 0x77, 0x80, 0xb0, 0x07, 0xb0, 0x47, 0xb0, 0x85, 0xd0, 0x00, 0x00, 0x00, 0x3b, 0x19, 0x00 },
+	{ 0xec, 0xc6, 0x8b, 0x26, 0x01, 0x06, 0x41, 0x06, 0x87, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x24 },
+	{ 0x14, 0xb2, 0xbb, 0x25, 0x01, 0xb5, 0x41, 0xb5, 0x8b, 0xf3, 0x00, 0x00, 0x00, 0x02, 0xe9, 0xf9 },
+	{ 0xe1, 0xe0, 0x82, 0x30, 0x01, 0x30, 0x41, 0x30, 0x88, 0x50, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00 },
+	{ 0x9a, 0x9d, 0xab, 0x05, 0x07, 0x95, 0x47, 0x95, 0x85, 0x13, 0x00, 0x00, 0x00, 0x39, 0x7c, 0xb9 },
+	{ 0x94, 0xfa, 0xae, 0xc8, 0x05, 0x48, 0x45, 0x48, 0x84, 0xf8, 0x00, 0x00, 0x00, 0x1b, 0xe4, 0x40 },
+	{ 0xcb, 0x2b, 0x11, 0x3f, 0x05, 0xef, 0x45, 0xef, 0x89, 0x89, 0x00, 0x00, 0x00, 0x23, 0x35, 0x21 },
+	{ 0xd2, 0x65, 0x26, 0x5c, 0x07, 0x1c, 0x47, 0x1c, 0x81, 0xc4, 0x00, 0x00, 0x00, 0x32, 0x8b, 0x10 },
+	{ 0xb6, 0xc6, 0x20, 0x71, 0x02, 0xc1, 0x42, 0xc1, 0x83, 0x47, 0x00, 0x00, 0x00, 0x07, 0x95, 0x81 },
+	{ 0xce, 0x29, 0x4b, 0x3d, 0x01, 0x4d, 0x41, 0x4d, 0x89, 0x1b, 0x00, 0x00, 0x00, 0x01, 0xb1, 0x29 },
+	{ 0xf4, 0xcc, 0x2c, 0xb3, 0x01, 0xa3, 0x41, 0xa3, 0x8b, 0x75, 0x00, 0x00, 0x00, 0x02, 0xad, 0xc9 },
+	{ 0x48, 0x50, 0x80, 0x8a, 0x01, 0xaa, 0x41, 0xaa, 0x8b, 0xa6, 0x00, 0x00, 0x00, 0x02, 0xc4, 0xe4 },
+	{ 0x78, 0xf0, 0x0b, 0xf1, 0x06, 0x41, 0x46, 0x41, 0x8b, 0xc7, 0x00, 0x00, 0x00, 0x27, 0x1c, 0x81 },
+	{ 0x4c, 0xda, 0x26, 0x00, 0x06, 0x00, 0x46, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00 },
+	{ 0x26, 0xa2, 0xe1, 0x76, 0x00, 0x56, 0x40, 0x56, 0x82, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe4 },
+	{ 0x62, 0x76, 0x40, 0x2a, 0x03, 0x4a, 0x43, 0x4a, 0x87, 0x06, 0x00, 0x00, 0x00, 0x0a, 0xd1, 0x64 },
+	{ 0x54, 0xaf, 0xcf, 0xcb, 0x04, 0x3b, 0x44, 0x3b, 0x8d, 0x9d, 0x00, 0x00, 0x00, 0x11, 0xe5, 0x99 },
+	{ 0xc4, 0x8c, 0x90, 0xd0, 0x01, 0xd0, 0x41, 0xd0, 0x8c, 0xb0, 0x00, 0x00, 0x00, 0x03, 0x49, 0x00 },
+	{ 0x92, 0x98, 0x09, 0x78, 0x06, 0xf8, 0x46, 0xf8, 0x80, 0xc8, 0x00, 0x00, 0x00, 0x30, 0x90, 0x40 },
+	{ 0x74, 0xb4, 0x30, 0xd2, 0x00, 0x72, 0x40, 0x72, 0x83, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x32, 0xc4 },
+	{ 0x27, 0x32, 0xc8, 0xbc, 0x07, 0x7c, 0x47, 0x7c, 0x84, 0x64, 0x00, 0x00, 0x00, 0x38, 0x04, 0x10 },
+	{ 0x4a, 0xe3, 0x1d, 0x9c, 0x02, 0x5c, 0x42, 0x5c, 0x80, 0x84, 0x00, 0x00, 0x00, 0x05, 0x91, 0x10 },
+	{ 0x4f, 0xea, 0x85, 0x2b, 0x07, 0x9b, 0x47, 0x9b, 0x85, 0x3d, 0x00, 0x00, 0x00, 0x39, 0xd7, 0xd9 },
+	{ 0xed, 0xa4, 0x3c, 0xc3, 0x06, 0xb3, 0x46, 0xb3, 0x8e, 0xe5, 0x00, 0x00, 0x00, 0x2c, 0xe1, 0x29 },
+	{ 0x73, 0x4d, 0x0f, 0xb4, 0x03, 0xf4, 0x43, 0xf4, 0x8b, 0xac, 0x00, 0x00, 0x00, 0x0f, 0xa0, 0x90 },
+	{ 0xcc, 0xc2, 0x2a, 0x1f, 0x04, 0xcf, 0x44, 0xcf, 0x81, 0xa9, 0x00, 0x00, 0x00, 0x17, 0x1f, 0x61 },
+	{ 0xc4, 0xbc, 0x88, 0x92, 0x04, 0x32, 0x44, 0x32, 0x8d, 0x5e, 0x00, 0x00, 0x00, 0x11, 0x99, 0xc4 },
+	{ 0xed, 0xf2, 0x07, 0x1a, 0x05, 0x3a, 0x45, 0x3a, 0x84, 0x96, 0x00, 0x00, 0x00, 0x1b, 0x51, 0x24 },
+	{ 0x89, 0xb4, 0xb6, 0x4e, 0x00, 0xae, 0x40, 0xae, 0x84, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x76, 0x44 },
+	{ 0x36, 0x30, 0x62, 0x77, 0x00, 0xa7, 0x40, 0xa7, 0x84, 0x91, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf1 },
+	{ 0xa9, 0x2f, 0xa7, 0xd4, 0x06, 0x14, 0x46, 0x14, 0x8a, 0x8c, 0x00, 0x00, 0x00, 0x24, 0xf1, 0x90 },
+	{ 0x8f, 0x57, 0xb2, 0x8b, 0x02, 0xfb, 0x42, 0xfb, 0x84, 0xdd, 0x00, 0x00, 0x00, 0x08, 0xe2, 0x19 },
+	{ 0xbe, 0x7d, 0xf7, 0xa7, 0x04, 0xd7, 0x44, 0xd7, 0x81, 0xe1, 0x00, 0x00, 0x00, 0x17, 0x6c, 0x91 },
+	{ 0xeb, 0xdd, 0x2c, 0x21, 0x05, 0x71, 0x45, 0x71, 0x86, 0x17, 0x00, 0x00, 0x00, 0x1d, 0x9b, 0xe1 },
+	{ 0x26, 0x37, 0x44, 0x8a, 0x05, 0xaa, 0x45, 0xaa, 0x87, 0xa6, 0x00, 0x00, 0x00, 0x20, 0x14, 0xe4 },
+	{ 0x96, 0x91, 0xc7, 0xa8, 0x04, 0x28, 0x44, 0x28, 0x8d, 0x18, 0x00, 0x00, 0x00, 0x11, 0x46, 0x40 },
+	{ 0xda, 0xd6, 0x64, 0xd5, 0x02, 0x65, 0x42, 0x65, 0x80, 0xc3, 0x00, 0x00, 0x00, 0x05, 0xbb, 0xd9 },
+	{ 0x7c, 0x4e, 0x35, 0x73, 0x06, 0x63, 0x46, 0x63, 0x8c, 0xb5, 0x00, 0x00, 0x00, 0x28, 0xca, 0x49 },
+	{ 0x4d, 0x57, 0xe8, 0x19, 0x06, 0xe9, 0x46, 0xe9, 0x80, 0x5f, 0x00, 0x00, 0x00, 0x2f, 0xc0, 0x11 },
+	{ 0xdb, 0x24, 0x2f, 0x2c, 0x00, 0xec, 0x40, 0xec, 0x86, 0x74, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x90 },
+	{ 0x2f, 0x86, 0x34, 0xa0, 0x06, 0xa0, 0x46, 0xa0, 0x8e, 0x60, 0x00, 0x00, 0x00, 0x2b, 0xe4, 0x00 },
+	{ 0xa3, 0x8c, 0xab, 0x97, 0x03, 0xc7, 0x43, 0xc7, 0x8a, 0x71, 0x00, 0x00, 0x00, 0x0e, 0x44, 0xb1 },
+	{ 0xb6, 0x96, 0x28, 0xaf, 0x00, 0x5f, 0x40, 0x5f, 0x82, 0x99, 0x00, 0x00, 0x00, 0x00, 0x23, 0x41 },
+	{ 0x2d, 0x71, 0x59, 0xa7, 0x06, 0xd7, 0x46, 0xd7, 0x8f, 0xe1, 0x00, 0x00, 0x00, 0x2e, 0xc8, 0x91 },
+	{ 0x93, 0x33, 0x9e, 0x26, 0x04, 0x06, 0x44, 0x06, 0x8c, 0x2a, 0x00, 0x00, 0x00, 0x10, 0x30, 0x24 },
+	{ 0x36, 0x60, 0x5a, 0x39, 0x03, 0x09, 0x43, 0x09, 0x85, 0x3f, 0x00, 0x00, 0x00, 0x09, 0x36, 0x51 },
+	{ 0xfa, 0x3f, 0x31, 0x2e, 0x01, 0x8e, 0x41, 0x8e, 0x8a, 0xe2, 0x00, 0x00, 0x00, 0x02, 0x6a, 0xc4 },
+	{ 0xac, 0x2d, 0xe1, 0xd2, 0x01, 0x72, 0x41, 0x72, 0x8a, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x16, 0xc4 },
+	{ 0xf2, 0x39, 0x8f, 0xa1, 0x00, 0xf1, 0x40, 0xf1, 0x86, 0x97, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xe1 },
+	{ 0xd2, 0x53, 0x01, 0x2f, 0x00, 0xdf, 0x40, 0xdf, 0x86, 0x19, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x41 },
+	{ 0xd0, 0x50, 0x4b, 0x63, 0x07, 0x53, 0x47, 0x53, 0x83, 0x45, 0x00, 0x00, 0x00, 0x35, 0xa4, 0xe9 },
+	{ 0xb4, 0x93, 0x72, 0xe3, 0x06, 0xd3, 0x46, 0xd3, 0x8f, 0xc5, 0x00, 0x00, 0x00, 0x2e, 0x91, 0xe9 },
+	{ 0xc5, 0x0a, 0x52, 0xe9, 0x02, 0xb9, 0x42, 0xb9, 0x83, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x69, 0xb1 },
+	{ 0x2f, 0x26, 0x45, 0x1c, 0x01, 0xdc, 0x41, 0xdc, 0x8d, 0x04, 0x00, 0x00, 0x00, 0x03, 0x75, 0x10 },
+	{ 0xbf, 0xe5, 0x18, 0xc5, 0x01, 0x55, 0x41, 0x55, 0x89, 0x53, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x39 },
+	{ 0x54, 0x62, 0x05, 0x74, 0x05, 0xb4, 0x45, 0xb4, 0x87, 0xec, 0x00, 0x00, 0x00, 0x20, 0x86, 0x90 },
+	{ 0x75, 0xaf, 0xb5, 0x04, 0x02, 0x44, 0x42, 0x44, 0x8f, 0xdc, 0x00, 0x00, 0x00, 0x05, 0x22, 0x10 },
+	{ 0xa9, 0x7d, 0x72, 0x2b, 0x04, 0x9b, 0x44, 0x9b, 0x80, 0x3d, 0x00, 0x00, 0x00, 0x15, 0x35, 0xd9 },
+	{ 0x66, 0x9f, 0xf6, 0x1c, 0x02, 0xdc, 0x42, 0xdc, 0x84, 0x04, 0x00, 0x00, 0x00, 0x08, 0x2d, 0x10 },
+	{ 0xc1, 0x5e, 0x5f, 0x10, 0x04, 0x10, 0x44, 0x10, 0x8c, 0x70, 0x00, 0x00, 0x00, 0x10, 0x81, 0x00 },
+	{ 0x94, 0x4c, 0xf4, 0xed, 0x01, 0xfd, 0x41, 0xfd, 0x8d, 0xeb, 0x00, 0x00, 0x00, 0x03, 0xf4, 0x09 },
+	{ 0x7b, 0xee, 0x45, 0xef, 0x01, 0x9f, 0x41, 0x9f, 0x8b, 0x59, 0x00, 0x00, 0x00, 0x02, 0xa0, 0xc1 },
+	{ 0x33, 0xcd, 0xbd, 0x27, 0x02, 0x57, 0x42, 0x57, 0x80, 0x61, 0x00, 0x00, 0x00, 0x05, 0x79, 0x91 },
+	{ 0x19, 0x5a, 0x33, 0x30, 0x02, 0x30, 0x42, 0x30, 0x8f, 0x50, 0x00, 0x00, 0x00, 0x04, 0xc9, 0x00 },
+	{ 0xf4, 0x7e, 0x62, 0x5c, 0x03, 0x1c, 0x43, 0x1c, 0x85, 0xc4, 0x00, 0x00, 0x00, 0x09, 0xab, 0x10 },
+	{ 0xd2, 0xd0, 0xc3, 0x48, 0x01, 0xc8, 0x41, 0xc8, 0x8c, 0x78, 0x00, 0x00, 0x00, 0x03, 0x2c, 0x40 },
+	{ 0x05, 0xf0, 0xc6, 0x94, 0x00, 0xd4, 0x40, 0xd4, 0x85, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90 },
+	{ 0x80, 0xf5, 0xad, 0x7e, 0x06, 0xde, 0x46, 0xde, 0x80, 0x12, 0x00, 0x00, 0x00, 0x2f, 0x28, 0x84 },
+	{ 0x38, 0x57, 0x62, 0x9d, 0x06, 0xad, 0x46, 0xad, 0x8e, 0xbb, 0x00, 0x00, 0x00, 0x2c, 0x90, 0xe9 },
+	{ 0x6a, 0x2e, 0x17, 0x60, 0x05, 0x60, 0x45, 0x60, 0x85, 0xa0, 0x00, 0x00, 0x00, 0x1c, 0xe4, 0x00 },
+	{ 0x1d, 0xd1, 0xb3, 0x79, 0x00, 0x49, 0x40, 0x49, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd1 },
+	{ 0xa3, 0x0e, 0xe9, 0x7e, 0x02, 0xde, 0x42, 0xde, 0x84, 0x12, 0x00, 0x00, 0x00, 0x08, 0x38, 0x84 },
+	{ 0x81, 0x43, 0x77, 0xd5, 0x05, 0x65, 0x45, 0x65, 0x85, 0xc3, 0x00, 0x00, 0x00, 0x1d, 0x19, 0xd9 },
+	{ 0xc0, 0xc2, 0xca, 0x62, 0x07, 0x02, 0x47, 0x02, 0x81, 0x0e, 0x00, 0x00, 0x00, 0x31, 0x1c, 0x04 },
+	{ 0x05, 0xa2, 0xfc, 0x3d, 0x02, 0x4d, 0x42, 0x4d, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x05, 0x4b, 0x29 },
+	{ 0x0f, 0x21, 0xe4, 0x15, 0x05, 0xa5, 0x45, 0xa5, 0x87, 0x83, 0x00, 0x00, 0x00, 0x1f, 0xdc, 0x59 },
+	{ 0xf2, 0xe7, 0x49, 0x7c, 0x04, 0x3c, 0x44, 0x3c, 0x8d, 0xa4, 0x00, 0x00, 0x00, 0x11, 0xee, 0x10 },
+	{ 0x11, 0xb4, 0x81, 0x27, 0x06, 0x57, 0x46, 0x57, 0x8c, 0x61, 0x00, 0x00, 0x00, 0x28, 0x31, 0x91 },
+	{ 0x7f, 0xac, 0x5e, 0xf5, 0x06, 0x85, 0x46, 0x85, 0x8d, 0xa3, 0x00, 0x00, 0x00, 0x2a, 0x81, 0x19 },
+	{ 0x49, 0x4c, 0x04, 0xbc, 0x03, 0x7c, 0x43, 0x7c, 0x88, 0x64, 0x00, 0x00, 0x00, 0x0c, 0x24, 0x10 },
+	{ 0xa2, 0xf1, 0x16, 0xe9, 0x06, 0xb9, 0x46, 0xb9, 0x8f, 0x0f, 0x00, 0x00, 0x00, 0x2d, 0x31, 0xb1 },
+	{ 0xf7, 0xdc, 0x8b, 0xde, 0x03, 0x3e, 0x43, 0x3e, 0x86, 0xb2, 0x00, 0x00, 0x00, 0x0a, 0x83, 0x04 },
+	{ 0xba, 0x84, 0x39, 0x77, 0x07, 0xa7, 0x47, 0xa7, 0x85, 0x91, 0x00, 0x00, 0x00, 0x3a, 0x8e, 0xf1 },
+	{ 0xba, 0x54, 0x41, 0xb5, 0x05, 0x45, 0x45, 0x45, 0x84, 0xe3, 0x00, 0x00, 0x00, 0x1b, 0xc4, 0x99 },
+	{ 0x28, 0x69, 0xf2, 0x18, 0x01, 0x98, 0x41, 0x98, 0x8b, 0x28, 0x00, 0x00, 0x00, 0x02, 0x8a, 0x40 },
+	{ 0xaf, 0x6e, 0x38, 0xbf, 0x05, 0x6f, 0x45, 0x6f, 0x86, 0x09, 0x00, 0x00, 0x00, 0x1d, 0x86, 0x21 },
+	{ 0x9d, 0x6b, 0xed, 0x41, 0x00, 0x91, 0x40, 0x91, 0x83, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x52, 0x21 },
+	{ 0xf8, 0x2a, 0x56, 0x35, 0x01, 0xc5, 0x41, 0xc5, 0x8c, 0x63, 0x00, 0x00, 0x00, 0x03, 0x21, 0x99 },
+	{ 0x19, 0x8a, 0x2a, 0xf2, 0x04, 0x92, 0x44, 0x92, 0x8f, 0xfe, 0x00, 0x00, 0x00, 0x14, 0xe3, 0x44 },
+	{ 0xe0, 0x97, 0x33, 0xa7, 0x00, 0xd7, 0x40, 0xd7, 0x85, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x91 },
+	{ 0xe5, 0x6e, 0xa3, 0x74, 0x03, 0xb4, 0x43, 0xb4, 0x89, 0xec, 0x00, 0x00, 0x00, 0x0d, 0xb6, 0x90 },
+	{ 0xd5, 0xe1, 0x22, 0x73, 0x03, 0x63, 0x43, 0x63, 0x87, 0xb5, 0x00, 0x00, 0x00, 0x0b, 0x78, 0x49 },
+	{ 0xeb, 0xad, 0x34, 0x5f, 0x03, 0x0f, 0x43, 0x0f, 0x85, 0x69, 0x00, 0x00, 0x00, 0x09, 0x5a, 0xe1 },
+	{ 0xdf, 0x60, 0x0a, 0x4b, 0x06, 0xbb, 0x46, 0xbb, 0x8f, 0x1d, 0x00, 0x00, 0x00, 0x2d, 0x4c, 0x99 },
+	{ 0x2d, 0x8f, 0x2c, 0x3c, 0x02, 0xfc, 0x42, 0xfc, 0x84, 0xe4, 0x00, 0x00, 0x00, 0x08, 0xe8, 0x10 },
+	{ 0xa1, 0x47, 0xd8, 0xdc, 0x01, 0x9c, 0x41, 0x9c, 0x8b, 0x44, 0x00, 0x00, 0x00, 0x02, 0x97, 0x10 },
+	{ 0x80, 0x77, 0xeb, 0x65, 0x05, 0xf5, 0x45, 0xf5, 0x89, 0xb3, 0x00, 0x00, 0x00, 0x23, 0x7c, 0x79 },
+	{ 0xe4, 0x07, 0x82, 0x56, 0x07, 0x36, 0x47, 0x36, 0x82, 0x7a, 0x00, 0x00, 0x00, 0x33, 0xff, 0x64 },
+	{ 0x5d, 0xce, 0xc8, 0x1f, 0x02, 0xcf, 0x42, 0xcf, 0x83, 0xa9, 0x00, 0x00, 0x00, 0x07, 0xe3, 0x61 },
+	{ 0x16, 0xa9, 0xc3, 0x89, 0x05, 0x59, 0x45, 0x59, 0x85, 0x6f, 0x00, 0x00, 0x00, 0x1c, 0x98, 0xf1 },
+	{ 0x3f, 0xaf, 0x4a, 0x4f, 0x03, 0xff, 0x43, 0xff, 0x8b, 0xf9, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x01 },
+	{ 0xa2, 0xde, 0xf1, 0xbc, 0x00, 0x7c, 0x40, 0x7c, 0x83, 0x64, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x10 },
+	{ 0x19, 0xd7, 0xf5, 0x49, 0x03, 0x19, 0x43, 0x19, 0x85, 0xaf, 0x00, 0x00, 0x00, 0x09, 0x98, 0x71 },
+	{ 0x5e, 0x4c, 0x8a, 0x38, 0x03, 0xb8, 0x43, 0xb8, 0x8a, 0x08, 0x00, 0x00, 0x00, 0x0d, 0xd4, 0x40 },
+	{ 0x1f, 0xf8, 0xb3, 0x9f, 0x06, 0x4f, 0x46, 0x4f, 0x8c, 0x29, 0x00, 0x00, 0x00, 0x27, 0xcc, 0x61 },
+	{ 0x13, 0xe7, 0x2e, 0xb5, 0x02, 0x45, 0x42, 0x45, 0x8f, 0xe3, 0x00, 0x00, 0x00, 0x05, 0x26, 0x99 },
+	{ 0xd4, 0xc7, 0xcb, 0xac, 0x05, 0x6c, 0x45, 0x6c, 0x85, 0xf4, 0x00, 0x00, 0x00, 0x1d, 0x65, 0x90 },
+	{ 0x3e, 0x18, 0x31, 0x6f, 0x05, 0x1f, 0x45, 0x1f, 0x83, 0xd9, 0x00, 0x00, 0x00, 0x1a, 0x39, 0xc1 },
+	{ 0x32, 0xb4, 0x66, 0x60, 0x04, 0x60, 0x44, 0x60, 0x8e, 0xa0, 0x00, 0x00, 0x00, 0x13, 0x24, 0x00 },
+	{ 0xe8, 0xcc, 0xcc, 0xf6, 0x03, 0xd6, 0x43, 0xd6, 0x8a, 0xda, 0x00, 0x00, 0x00, 0x0e, 0xb6, 0xe4 },
+	{ 0x5a, 0x22, 0xd4, 0x46, 0x04, 0x26, 0x44, 0x26, 0x8d, 0x0a, 0x00, 0x00, 0x00, 0x11, 0x35, 0xa4 },
+	{ 0x92, 0xb5, 0xdc, 0x0d, 0x03, 0x1d, 0x43, 0x1d, 0x85, 0xcb, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x49 },
+	{ 0x9b, 0x39, 0x3f, 0xb3, 0x04, 0xa3, 0x44, 0xa3, 0x80, 0x75, 0x00, 0x00, 0x00, 0x15, 0x7f, 0xc9 },
+	{ 0xa7, 0xb6, 0x61, 0x89, 0x03, 0x59, 0x43, 0x59, 0x87, 0x6f, 0x00, 0x00, 0x00, 0x0b, 0x34, 0xf1 },
+	{ 0xca, 0x4d, 0x5f, 0xa2, 0x00, 0x42, 0x40, 0x42, 0x81, 0xce, 0x00, 0x00, 0x00, 0x00, 0x11, 0x04 },
+	{ 0x89, 0x66, 0xeb, 0xf7, 0x02, 0x27, 0x42, 0x27, 0x8f, 0x11, 0x00, 0x00, 0x00, 0x04, 0xa1, 0xf1 },
+	{ 0xff, 0xc4, 0x5a, 0xd6, 0x07, 0xb6, 0x47, 0xb6, 0x85, 0xfa, 0x00, 0x00, 0x00, 0x3b, 0x75, 0x64 },
+	{ 0xcb, 0x78, 0xdb, 0x96, 0x04, 0x76, 0x44, 0x76, 0x8f, 0x3a, 0x00, 0x00, 0x00, 0x13, 0xe6, 0x64 },
+	{ 0x4f, 0x6c, 0xc3, 0x12, 0x06, 0xb2, 0x46, 0xb2, 0x8e, 0xde, 0x00, 0x00, 0x00, 0x2c, 0xd3, 0xc4 },
+	{ 0x1d, 0x66, 0x16, 0x8d, 0x05, 0x9d, 0x45, 0x9d, 0x87, 0x4b, 0x00, 0x00, 0x00, 0x1f, 0x82, 0x49 },
+	{ 0xa4, 0x58, 0x38, 0x07, 0x03, 0x37, 0x43, 0x37, 0x86, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x55, 0xd1 },
+	{ 0xf6, 0x93, 0x3d, 0x55, 0x02, 0xe5, 0x42, 0xe5, 0x84, 0x43, 0x00, 0x00, 0x00, 0x08, 0x60, 0xd9 },
+	{ 0xa8, 0xff, 0xb0, 0x12, 0x03, 0xb2, 0x43, 0xb2, 0x89, 0xde, 0x00, 0x00, 0x00, 0x0d, 0xa7, 0xc4 },
+	{ 0x9d, 0x9b, 0xe5, 0x03, 0x02, 0xf3, 0x42, 0xf3, 0x84, 0xa5, 0x00, 0x00, 0x00, 0x08, 0xb2, 0xa9 },
+	{ 0x44, 0x08, 0xf8, 0x03, 0x05, 0xf3, 0x45, 0xf3, 0x89, 0xa5, 0x00, 0x00, 0x00, 0x23, 0x64, 0xa9 },
+	{ 0xad, 0xa7, 0x28, 0x1d, 0x04, 0x2d, 0x44, 0x2d, 0x8d, 0x3b, 0x00, 0x00, 0x00, 0x11, 0x6f, 0xe9 },
+	{ 0xed, 0x92, 0x17, 0x96, 0x00, 0x76, 0x40, 0x76, 0x83, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x36, 0x64 },
+	{ 0xab, 0x62, 0x55, 0x62, 0x02, 0x02, 0x42, 0x02, 0x8e, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04 },
+	{ 0x8d, 0x90, 0xa1, 0xe9, 0x01, 0xb9, 0x41, 0xb9, 0x8c, 0x0f, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xb1 },
+	{ 0x4b, 0x30, 0xe7, 0xf3, 0x00, 0xe3, 0x40, 0xe3, 0x86, 0x35, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x49 },
+	{ 0x9a, 0xeb, 0x75, 0x5c, 0x06, 0x1c, 0x46, 0x1c, 0x8a, 0xc4, 0x00, 0x00, 0x00, 0x25, 0x53, 0x10 },
+	{ 0x09, 0x4e, 0xf0, 0x16, 0x00, 0xf6, 0x40, 0xf6, 0x86, 0xba, 0x00, 0x00, 0x00, 0x00, 0xec, 0x64 },
+	{ 0x78, 0x24, 0x7f, 0x81, 0x06, 0xd1, 0x46, 0xd1, 0x8f, 0xb7, 0x00, 0x00, 0x00, 0x2e, 0x76, 0xa1 },
+	{ 0x62, 0x46, 0x48, 0x68, 0x00, 0xe8, 0x40, 0xe8, 0x86, 0x58, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x40 },
+	{ 0x0a, 0x1a, 0x7c, 0x86, 0x00, 0x66, 0x40, 0x66, 0x82, 0xca, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa4 },
+	{ 0x73, 0x9a, 0xda, 0x0b, 0x02, 0x7b, 0x42, 0x7b, 0x81, 0x5d, 0x00, 0x00, 0x00, 0x06, 0x27, 0x19 },
+	{ 0x87, 0xcf, 0xd3, 0x17, 0x03, 0x47, 0x43, 0x47, 0x86, 0xf1, 0x00, 0x00, 0x00, 0x0a, 0xbd, 0xb1 },
+	{ 0xb9, 0xf4, 0x52, 0x31, 0x00, 0x81, 0x40, 0x81, 0x83, 0x87, 0x00, 0x00, 0x00, 0x00, 0x41, 0x01 },
+	{ 0x77, 0xf4, 0x87, 0xbf, 0x04, 0x6f, 0x44, 0x6f, 0x8f, 0x09, 0x00, 0x00, 0x00, 0x13, 0xa8, 0x21 },
+	{ 0x80, 0x95, 0xbd, 0xfa, 0x02, 0x1a, 0x42, 0x1a, 0x8e, 0xb6, 0x00, 0x00, 0x00, 0x04, 0x6a, 0xa4 },
+	{ 0xb7, 0x26, 0x0f, 0xf5, 0x07, 0x85, 0x47, 0x85, 0x84, 0xa3, 0x00, 0x00, 0x00, 0x38, 0x8b, 0x19 },
+	{ 0xbd, 0x64, 0xa0, 0xe0, 0x06, 0xe0, 0x46, 0xe0, 0x80, 0x20, 0x00, 0x00, 0x00, 0x2f, 0x44, 0x00 },
+	{ 0x6f, 0xa1, 0x1b, 0xdb, 0x05, 0x4b, 0x45, 0x4b, 0x85, 0x0d, 0x00, 0x00, 0x00, 0x1c, 0x03, 0xf9 },
+	{ 0xf8, 0xf5, 0xe2, 0xa5, 0x01, 0x35, 0x41, 0x35, 0x88, 0x73, 0x00, 0x00, 0x00, 0x01, 0x74, 0xf9 },
+	{ 0xac, 0xf9, 0x6e, 0x42, 0x00, 0xe2, 0x40, 0xe2, 0x86, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x84 },
+	{ 0xc3, 0x25, 0x6f, 0xb2, 0x05, 0x52, 0x45, 0x52, 0x85, 0x3e, 0x00, 0x00, 0x00, 0x1c, 0x4e, 0x44 },
+	{ 0x93, 0xff, 0x2a, 0x96, 0x03, 0x76, 0x43, 0x76, 0x88, 0x3a, 0x00, 0x00, 0x00, 0x0b, 0xfa, 0x64 },
+	{ 0x25, 0x1d, 0xed, 0xc3, 0x07, 0xb3, 0x47, 0xb3, 0x85, 0xe5, 0x00, 0x00, 0x00, 0x3b, 0x47, 0x29 },
+	{ 0x8b, 0xc9, 0x91, 0x47, 0x00, 0x77, 0x40, 0x77, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00, 0x37, 0x51 },
+	{ 0x59, 0x27, 0x50, 0x14, 0x02, 0x54, 0x42, 0x54, 0x80, 0x4c, 0x00, 0x00, 0x00, 0x05, 0x6b, 0x90 },
+	{ 0xfc, 0x66, 0x31, 0x54, 0x07, 0x94, 0x47, 0x94, 0x85, 0x0c, 0x00, 0x00, 0x00, 0x39, 0x6d, 0x90 },
+	{ 0xc9, 0x93, 0xf8, 0x5f, 0x07, 0x0f, 0x47, 0x0f, 0x81, 0x69, 0x00, 0x00, 0x00, 0x31, 0xd2, 0xe1 },
+	{ 0x01, 0xc7, 0x10, 0xa2, 0x01, 0x42, 0x41, 0x42, 0x88, 0xce, 0x00, 0x00, 0x00, 0x01, 0x95, 0x04 },
+	{ 0x88, 0x4d, 0x95, 0x30, 0x04, 0x30, 0x44, 0x30, 0x8d, 0x50, 0x00, 0x00, 0x00, 0x11, 0x89, 0x00 },
+	{ 0x06, 0xce, 0x78, 0x31, 0x06, 0x81, 0x46, 0x81, 0x8d, 0x87, 0x00, 0x00, 0x00, 0x2a, 0x4d, 0x01 },
+	{ 0x3a, 0xe9, 0xff, 0xaf, 0x07, 0x5f, 0x47, 0x5f, 0x83, 0x99, 0x00, 0x00, 0x00, 0x36, 0x55, 0x41 },
+	{ 0x86, 0x68, 0xb1, 0xf9, 0x06, 0xc9, 0x46, 0xc9, 0x8f, 0x7f, 0x00, 0x00, 0x00, 0x2e, 0x09, 0xd1 },
+	{ 0xc8, 0x68, 0x7c, 0x6b, 0x02, 0xdb, 0x42, 0xdb, 0x83, 0xfd, 0x00, 0x00, 0x00, 0x08, 0x27, 0x59 },
+	{ 0x31, 0x3b, 0x20, 0x15, 0x01, 0xa5, 0x41, 0xa5, 0x8b, 0x83, 0x00, 0x00, 0x00, 0x02, 0xb4, 0x59 },
+	{ 0x70, 0x3c, 0xb0, 0x89, 0x02, 0x59, 0x42, 0x59, 0x80, 0x6f, 0x00, 0x00, 0x00, 0x05, 0x82, 0xf1 },
+	{ 0x6d, 0x5c, 0x49, 0x20, 0x03, 0x20, 0x43, 0x20, 0x85, 0xe0, 0x00, 0x00, 0x00, 0x09, 0xc4, 0x00 },
+	{ 0x57, 0xc0, 0x2e, 0xf6, 0x05, 0xd6, 0x45, 0xd6, 0x88, 0xda, 0x00, 0x00, 0x00, 0x22, 0x0e, 0xe4 },
+	{ 0xeb, 0x8f, 0x61, 0xca, 0x06, 0xea, 0x46, 0xea, 0x80, 0x66, 0x00, 0x00, 0x00, 0x2f, 0xcd, 0xe4 },
+	{ 0x50, 0x38, 0x4f, 0x82, 0x06, 0x22, 0x46, 0x22, 0x8a, 0xee, 0x00, 0x00, 0x00, 0x25, 0x9c, 0x84 },
+	{ 0x1e, 0xcd, 0x37, 0xab, 0x02, 0x1b, 0x42, 0x1b, 0x8e, 0xbd, 0x00, 0x00, 0x00, 0x04, 0x6e, 0xd9 },
+	{ 0x5c, 0x67, 0xa7, 0x01, 0x06, 0x51, 0x46, 0x51, 0x8c, 0x37, 0x00, 0x00, 0x00, 0x27, 0xe5, 0xa1 },
+	{ 0x52, 0xb8, 0xc7, 0x67, 0x00, 0x97, 0x40, 0x97, 0x84, 0x21, 0x00, 0x00, 0x00, 0x00, 0x59, 0x11 },
+	{ 0xd6, 0x2e, 0xec, 0xca, 0x01, 0xea, 0x41, 0xea, 0x8d, 0x66, 0x00, 0x00, 0x00, 0x03, 0xa9, 0xe4 },
+	{ 0xe5, 0x20, 0xd9, 0x1d, 0x05, 0x2d, 0x45, 0x2d, 0x84, 0x3b, 0x00, 0x00, 0x00, 0x1a, 0xc9, 0xe9 },
+	{ 0x3b, 0xd3, 0x5e, 0xb4, 0x02, 0xf4, 0x42, 0xf4, 0x84, 0xac, 0x00, 0x00, 0x00, 0x08, 0xb8, 0x90 },
+	{ 0x5d, 0x03, 0x3b, 0xaf, 0x03, 0x5f, 0x43, 0x5f, 0x87, 0x99, 0x00, 0x00, 0x00, 0x0b, 0x5d, 0x41 },
+	{ 0x77, 0x76, 0xc5, 0xa6, 0x03, 0x86, 0x43, 0x86, 0x88, 0xaa, 0x00, 0x00, 0x00, 0x0c, 0x6a, 0x24 },
+	{ 0x0b, 0x75, 0xf0, 0x3c, 0x06, 0xfc, 0x46, 0xfc, 0x80, 0xe4, 0x00, 0x00, 0x00, 0x30, 0xc8, 0x10 },
+	{ 0x4c, 0x8c, 0x5b, 0xa9, 0x07, 0x79, 0x47, 0x79, 0x84, 0x4f, 0x00, 0x00, 0x00, 0x37, 0xd7, 0x31 },
+	{ 0x8e, 0x6e, 0x53, 0x86, 0x07, 0x66, 0x47, 0x66, 0x83, 0xca, 0x00, 0x00, 0x00, 0x36, 0xbc, 0xa4 },
+	{ 0x97, 0xab, 0x1e, 0x6f, 0x02, 0x1f, 0x42, 0x1f, 0x8e, 0xd9, 0x00, 0x00, 0x00, 0x04, 0x7f, 0xc1 },
+	{ 0x67, 0xb9, 0x4c, 0xe3, 0x00, 0xd3, 0x40, 0xd3, 0x85, 0xc5, 0x00, 0x00, 0x00, 0x00, 0xad, 0xe9 },
+	{ 0x42, 0x11, 0xef, 0x9f, 0x02, 0x4f, 0x42, 0x4f, 0x80, 0x29, 0x00, 0x00, 0x00, 0x05, 0x54, 0x61 },
+	{ 0x56, 0x94, 0xb3, 0x02, 0x01, 0xa2, 0x41, 0xa2, 0x8b, 0x6e, 0x00, 0x00, 0x00, 0x02, 0xaa, 0x84 },
+	{ 0x4f, 0x8a, 0x95, 0xa7, 0x02, 0xd7, 0x42, 0xd7, 0x83, 0xe1, 0x00, 0x00, 0x00, 0x08, 0x10, 0x91 },
+	{ 0x30, 0x51, 0xc1, 0x10, 0x06, 0x10, 0x46, 0x10, 0x8a, 0x70, 0x00, 0x00, 0x00, 0x24, 0xc1, 0x00 },
+	{ 0x7e, 0xfe, 0xa5, 0x1a, 0x03, 0x3a, 0x43, 0x3a, 0x86, 0x96, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x24 },
+	{ 0xde, 0x34, 0x8e, 0x57, 0x02, 0x87, 0x42, 0x87, 0x81, 0xb1, 0x00, 0x00, 0x00, 0x06, 0x63, 0x31 },
+	{ 0xea, 0x46, 0x13, 0x41, 0x06, 0x91, 0x46, 0x91, 0x8d, 0xf7, 0x00, 0x00, 0x00, 0x2b, 0x1e, 0x21 },
+	{ 0xf5, 0x79, 0xe6, 0x8e, 0x04, 0xee, 0x44, 0xee, 0x82, 0x82, 0x00, 0x00, 0x00, 0x18, 0x4d, 0x44 },
+	{ 0x18, 0x40, 0xdc, 0x69, 0x04, 0x39, 0x44, 0x39, 0x8d, 0x8f, 0x00, 0x00, 0x00, 0x11, 0xd4, 0xb1 },
+	{ 0x3c, 0xfe, 0xda, 0xa8, 0x07, 0x28, 0x47, 0x28, 0x82, 0x18, 0x00, 0x00, 0x00, 0x33, 0x36, 0x40 },
+	{ 0x12, 0x20, 0x1e, 0x13, 0x01, 0x03, 0x41, 0x03, 0x87, 0x15, 0x00, 0x00, 0x00, 0x01, 0x06, 0x09 },
+	{ 0x66, 0x04, 0x61, 0x6e, 0x05, 0xce, 0x45, 0xce, 0x88, 0xa2, 0x00, 0x00, 0x00, 0x21, 0xb1, 0xc4 },
+	{ 0x52, 0x9a, 0xf4, 0xd2, 0x04, 0x72, 0x44, 0x72, 0x8f, 0x1e, 0x00, 0x00, 0x00, 0x13, 0xc2, 0xc4 },
+	{ 0xb2, 0xea, 0x34, 0xd6, 0x01, 0xb6, 0x41, 0xb6, 0x8b, 0xfa, 0x00, 0x00, 0x00, 0x02, 0xed, 0x64 },
+	{ 0x7f, 0xca, 0x31, 0x8a, 0x02, 0xaa, 0x42, 0xaa, 0x82, 0xa6, 0x00, 0x00, 0x00, 0x07, 0x18, 0xe4 },
+	{ 0x56, 0xc4, 0xaa, 0xc4, 0x04, 0x04, 0x44, 0x04, 0x8c, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x20, 0x10 },
+	{ 0x16, 0xf7, 0x8d, 0xe0, 0x03, 0xe0, 0x43, 0xe0, 0x8b, 0x20, 0x00, 0x00, 0x00, 0x0f, 0x04, 0x00 },
+	{ 0xbd, 0xe2, 0x62, 0xf9, 0x07, 0xc9, 0x47, 0xc9, 0x86, 0x7f, 0x00, 0x00, 0x00, 0x3c, 0x9b, 0xd1 },
+	{ 0xc7, 0x6c, 0xf8, 0x39, 0x01, 0x09, 0x41, 0x09, 0x87, 0x3f, 0x00, 0x00, 0x00, 0x01, 0x12, 0x51 },
+	{ 0x86, 0x56, 0x8c, 0xcc, 0x00, 0x8c, 0x40, 0x8c, 0x83, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x90 },
+	{ 0xca, 0x2f, 0x8d, 0x0d, 0x04, 0x1d, 0x44, 0x1d, 0x8c, 0xcb, 0x00, 0x00, 0x00, 0x10, 0xeb, 0x49 },
+	{ 0xc6, 0x83, 0x99, 0x34, 0x05, 0x74, 0x45, 0x74, 0x86, 0x2c, 0x00, 0x00, 0x00, 0x1d, 0xbc, 0x90 },
+	{ 0x45, 0xbd, 0xe3, 0x78, 0x00, 0xf8, 0x40, 0xf8, 0x86, 0xc8, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x40 },
+	{ 0x0c, 0xbf, 0x3e, 0xc5, 0x07, 0x55, 0x47, 0x55, 0x83, 0x53, 0x00, 0x00, 0x00, 0x35, 0xc2, 0x39 },
+	{ 0x36, 0xae, 0x24, 0x90, 0x01, 0x90, 0x41, 0x90, 0x8a, 0xf0, 0x00, 0x00, 0x00, 0x02, 0x71, 0x00 },
+	{ 0x83, 0x0a, 0x88, 0x77, 0x06, 0xa7, 0x46, 0xa7, 0x8e, 0x91, 0x00, 0x00, 0x00, 0x2c, 0x40, 0xf1 },
+	{ 0x32, 0x84, 0x6e, 0x9e, 0x01, 0xfe, 0x41, 0xfe, 0x8d, 0xf2, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x04 },
+	{ 0x17, 0x93, 0x22, 0x8e, 0x00, 0xee, 0x40, 0xee, 0x86, 0x82, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x44 },
+	{ 0x80, 0x17, 0xfb, 0xe1, 0x01, 0x31, 0x41, 0x31, 0x88, 0x57, 0x00, 0x00, 0x00, 0x01, 0x6b, 0x61 },
+	{ 0x27, 0xfe, 0x55, 0x2c, 0x06, 0xec, 0x46, 0xec, 0x80, 0x74, 0x00, 0x00, 0x00, 0x2f, 0xe9, 0x90 },
+	{ 0x79, 0xbb, 0x98, 0x61, 0x05, 0xb1, 0x45, 0xb1, 0x87, 0xd7, 0x00, 0x00, 0x00, 0x20, 0x64, 0x61 },
+	{ 0xe4, 0xf0, 0xe1, 0x5b, 0x02, 0xcb, 0x42, 0xcb, 0x83, 0x8d, 0x00, 0x00, 0x00, 0x07, 0xcc, 0xf9 },
+	{ 0x8f, 0xa5, 0x7c, 0xe2, 0x01, 0x82, 0x41, 0x82, 0x8a, 0x8e, 0x00, 0x00, 0x00, 0x02, 0x46, 0x04 },
+	{ 0x05, 0x07, 0x67, 0x8f, 0x05, 0x3f, 0x45, 0x3f, 0x84, 0xb9, 0x00, 0x00, 0x00, 0x1b, 0x85, 0x81 },
+	{ 0x5e, 0xe8, 0x1e, 0xe6, 0x00, 0xc6, 0x40, 0xc6, 0x85, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x99, 0x24 },
+	{ 0x5b, 0x3c, 0x2b, 0x0d, 0x02, 0x1d, 0x42, 0x1d, 0x8e, 0xcb, 0x00, 0x00, 0x00, 0x04, 0x77, 0x49 },
+	{ 0xe5, 0x50, 0xd0, 0xdf, 0x07, 0x8f, 0x47, 0x8f, 0x84, 0xe9, 0x00, 0x00, 0x00, 0x39, 0x21, 0xe1 },
+	{ 0x49, 0x2e, 0x32, 0x27, 0x07, 0x57, 0x47, 0x57, 0x83, 0x61, 0x00, 0x00, 0x00, 0x35, 0xdf, 0x91 },
+	{ 0x8d, 0xf0, 0x91, 0x6d, 0x06, 0x7d, 0x46, 0x7d, 0x8d, 0x6b, 0x00, 0x00, 0x00, 0x2a, 0x19, 0x09 },
+	{ 0xb7, 0x13, 0xea, 0xc8, 0x01, 0x48, 0x41, 0x48, 0x88, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xa4, 0x40 },
+	{ 0x86, 0x38, 0xba, 0x37, 0x04, 0x67, 0x44, 0x67, 0x8e, 0xd1, 0x00, 0x00, 0x00, 0x13, 0x61, 0x71 },
+	{ 0xd7, 0xc6, 0x05, 0xaa, 0x00, 0xca, 0x40, 0xca, 0x85, 0x86, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x64 },
+	{ 0x71, 0x38, 0x34, 0xbb, 0x04, 0x2b, 0x44, 0x2b, 0x8d, 0x2d, 0x00, 0x00, 0x00, 0x11, 0x5f, 0x39 },
+	{ 0xad, 0xc4, 0xfa, 0xb2, 0x00, 0x52, 0x40, 0x52, 0x82, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x44 },
+	{ 0xdb, 0xef, 0xbb, 0x9c, 0x00, 0x5c, 0x40, 0x5c, 0x82, 0x84, 0x00, 0x00, 0x00, 0x00, 0x21, 0x10 },
+	{ 0xe1, 0x92, 0xb7, 0xd9, 0x02, 0xa9, 0x42, 0xa9, 0x82, 0x9f, 0x00, 0x00, 0x00, 0x07, 0x13, 0x91 },
+	{ 0x27, 0xec, 0x2f, 0xff, 0x00, 0xaf, 0x40, 0xaf, 0x84, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x77, 0xa1 },
+	{ 0xfb, 0xb8, 0x77, 0x79, 0x04, 0x49, 0x44, 0x49, 0x8d, 0xff, 0x00, 0x00, 0x00, 0x12, 0x5c, 0xd1 },
+	{ 0x0b, 0x16, 0x00, 0xb8, 0x02, 0x38, 0x42, 0x38, 0x8f, 0x88, 0x00, 0x00, 0x00, 0x04, 0xec, 0x40 },
+	{ 0x5d, 0x9e, 0xd0, 0x5d, 0x00, 0x6d, 0x40, 0x6d, 0x82, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x69 },
+	{ 0x83, 0xf3, 0xe7, 0x7c, 0x02, 0x3c, 0x42, 0x3c, 0x8f, 0xa4, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x10 },
+	{ 0x03, 0x10, 0x5f, 0x2b, 0x01, 0x9b, 0x41, 0x9b, 0x8b, 0x3d, 0x00, 0x00, 0x00, 0x02, 0x93, 0xd9 },
+	{ 0x9f, 0xe0, 0xb7, 0xbe, 0x05, 0x1e, 0x45, 0x1e, 0x83, 0xd2, 0x00, 0x00, 0x00, 0x1a, 0x2f, 0x84 },
+	{ 0xc3, 0x55, 0x67, 0x74, 0x07, 0xb4, 0x47, 0xb4, 0x85, 0xec, 0x00, 0x00, 0x00, 0x3b, 0x56, 0x90 },
+	{ 0x24, 0x22, 0x69, 0x91, 0x05, 0xe1, 0x45, 0xe1, 0x89, 0x27, 0x00, 0x00, 0x00, 0x22, 0x8f, 0xc1 },
+	{ 0x84, 0x41, 0xb1, 0xd3, 0x00, 0xc3, 0x40, 0xc3, 0x85, 0x55, 0x00, 0x00, 0x00, 0x00, 0x94, 0x89 },
+	{ 0x0b, 0x93, 0xc2, 0xd1, 0x03, 0x21, 0x43, 0x21, 0x85, 0xe7, 0x00, 0x00, 0x00, 0x09, 0xca, 0x41 },
+	{ 0xdf, 0x4d, 0xe5, 0x1e, 0x00, 0x7e, 0x40, 0x7e, 0x83, 0x72, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x04 },
+	{ 0x3a, 0xba, 0x07, 0xed, 0x04, 0xfd, 0x44, 0xfd, 0x82, 0xeb, 0x00, 0x00, 0x00, 0x18, 0xe2, 0x09 },
+	{ 0xb8, 0x5d, 0x39, 0x51, 0x01, 0xa1, 0x41, 0xa1, 0x8b, 0x67, 0x00, 0x00, 0x00, 0x02, 0xa7, 0x41 },
+	{ 0xdd, 0x1b, 0x37, 0x90, 0x04, 0x90, 0x44, 0x90, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x14, 0xd1, 0x00 },
+	{ 0x0f, 0xbd, 0x78, 0xc3, 0x02, 0xb3, 0x42, 0xb3, 0x82, 0xe5, 0x00, 0x00, 0x00, 0x07, 0x49, 0x29 },
+	{ 0xee, 0x3f, 0xd1, 0x71, 0x03, 0xc1, 0x43, 0xc1, 0x8a, 0x47, 0x00, 0x00, 0x00, 0x0e, 0x17, 0x81 },
+	{ 0xe0, 0x2b, 0x96, 0xbb, 0x06, 0x2b, 0x46, 0x2b, 0x8b, 0x2d, 0x00, 0x00, 0x00, 0x26, 0x0b, 0x39 },
+	{ 0x06, 0x02, 0xeb, 0xc1, 0x07, 0x11, 0x47, 0x11, 0x81, 0x77, 0x00, 0x00, 0x00, 0x31, 0xef, 0x21 },
+	{ 0xf1, 0x20, 0x38, 0xda, 0x02, 0xfa, 0x42, 0xfa, 0x84, 0xd6, 0x00, 0x00, 0x00, 0x08, 0xdc, 0x24 },
+	{ 0x0c, 0xdd, 0x11, 0x5a, 0x03, 0x7a, 0x43, 0x7a, 0x88, 0x56, 0x00, 0x00, 0x00, 0x0c, 0x16, 0x24 },
+	{ 0x7b, 0x82, 0xa9, 0x03, 0x06, 0xf3, 0x46, 0xf3, 0x80, 0xa5, 0x00, 0x00, 0x00, 0x30, 0x4a, 0xa9 },
+	{ 0x21, 0x42, 0x02, 0x28, 0x06, 0xa8, 0x46, 0xa8, 0x8e, 0x98, 0x00, 0x00, 0x00, 0x2c, 0x4e, 0x40 },
+	{ 0x3c, 0x9e, 0xeb, 0x24, 0x02, 0x64, 0x42, 0x64, 0x80, 0xbc, 0x00, 0x00, 0x00, 0x05, 0xb7, 0x10 },
+	{ 0x2a, 0x13, 0x30, 0x25, 0x06, 0xb5, 0x46, 0xb5, 0x8e, 0xf3, 0x00, 0x00, 0x00, 0x2c, 0xfb, 0xf9 },
+	{ 0x94, 0xca, 0xb7, 0x06, 0x02, 0xe6, 0x42, 0xe6, 0x84, 0x4a, 0x00, 0x00, 0x00, 0x08, 0x66, 0xa4 },
+	{ 0xd3, 0xfc, 0x3f, 0x3c, 0x05, 0xfc, 0x45, 0xfc, 0x89, 0xe4, 0x00, 0x00, 0x00, 0x23, 0xd0, 0x10 },
+	{ 0xbe, 0xad, 0xef, 0x69, 0x07, 0x39, 0x47, 0x39, 0x82, 0x8f, 0x00, 0x00, 0x00, 0x34, 0x2a, 0xb1 },
+	{ 0x09, 0x31, 0x1d, 0x81, 0x04, 0xd1, 0x44, 0xd1, 0x81, 0xb7, 0x00, 0x00, 0x00, 0x17, 0x32, 0xa1 },
+	{ 0x98, 0x76, 0xaa, 0xdf, 0x01, 0x8f, 0x41, 0x8f, 0x8a, 0xe9, 0x00, 0x00, 0x00, 0x02, 0x6d, 0xe1 },
+	{ 0x36, 0xfb, 0xee, 0xe7, 0x00, 0x17, 0x40, 0x17, 0x80, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11 },
+	{ 0x22, 0xa9, 0x23, 0x46, 0x03, 0x26, 0x43, 0x26, 0x86, 0x0a, 0x00, 0x00, 0x00, 0x09, 0xe9, 0xa4 },
+	{ 0x60, 0x61, 0x65, 0x31, 0x03, 0x81, 0x43, 0x81, 0x88, 0x87, 0x00, 0x00, 0x00, 0x0c, 0x47, 0x01 },
+	{ 0xc1, 0xf9, 0xf3, 0xbe, 0x01, 0x1e, 0x41, 0x1e, 0x87, 0xd2, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x84 },
+	{ 0xeb, 0x7d, 0x3c, 0x9d, 0x00, 0xad, 0x40, 0xad, 0x84, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x74, 0xe9 },
+	{ 0x8e, 0x5c, 0x2e, 0x59, 0x01, 0x29, 0x41, 0x29, 0x88, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x58, 0x91 },
+	{ 0xb7, 0x43, 0xe2, 0x8a, 0x03, 0xaa, 0x43, 0xaa, 0x89, 0xa6, 0x00, 0x00, 0x00, 0x0d, 0x6c, 0xe4 },
+	{ 0xf1, 0xbb, 0xcd, 0x88, 0x00, 0x08, 0x40, 0x08, 0x80, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40 },
+	{ 0x6d, 0xaa, 0x13, 0x77, 0x01, 0xa7, 0x41, 0xa7, 0x8b, 0x91, 0x00, 0x00, 0x00, 0x02, 0xba, 0xf1 },
+	{ 0xaa, 0x96, 0xc8, 0xf2, 0x02, 0x92, 0x42, 0x92, 0x81, 0xfe, 0x00, 0x00, 0x00, 0x06, 0x9b, 0x44 },
+	{ 0xe0, 0xf7, 0x23, 0x2b, 0x05, 0x9b, 0x45, 0x9b, 0x87, 0x3d, 0x00, 0x00, 0x00, 0x1f, 0x6b, 0xd9 },
+	{ 0x5b, 0xe9, 0xe4, 0xe8, 0x05, 0x68, 0x45, 0x68, 0x85, 0xd8, 0x00, 0x00, 0x00, 0x1d, 0x3a, 0x40 },
+	{ 0x3b, 0xa3, 0x66, 0xf2, 0x00, 0x92, 0x40, 0x92, 0x83, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x53, 0x44 },
+	{ 0xb3, 0x97, 0xee, 0xb1, 0x05, 0x01, 0x45, 0x01, 0x83, 0x07, 0x00, 0x00, 0x00, 0x19, 0x0a, 0x01 },
+	{ 0x65, 0xa4, 0x71, 0xea, 0x01, 0x0a, 0x41, 0x0a, 0x87, 0x46, 0x00, 0x00, 0x00, 0x01, 0x14, 0x64 },
+	{ 0xf1, 0x02, 0x66, 0x45, 0x06, 0xd5, 0x46, 0xd5, 0x8f, 0xd3, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x39 },
+	{ 0xce, 0x89, 0x3a, 0xc1, 0x06, 0x11, 0x46, 0x11, 0x8a, 0x77, 0x00, 0x00, 0x00, 0x24, 0xcd, 0x21 },
+	{ 0xc0, 0xb0, 0xa5, 0x35, 0x00, 0xc5, 0x40, 0xc5, 0x85, 0x63, 0x00, 0x00, 0x00, 0x00, 0x97, 0x99 },
+	{ 0xeb, 0x5f, 0x6a, 0x08, 0x04, 0x88, 0x44, 0x88, 0x8f, 0xb8, 0x00, 0x00, 0x00, 0x14, 0x88, 0x40 },
+	{ 0xc7, 0x01, 0x5b, 0x4d, 0x06, 0x5d, 0x46, 0x5d, 0x8c, 0x8b, 0x00, 0x00, 0x00, 0x28, 0x7d, 0xc9 },
+	{ 0x70, 0x9c, 0xa0, 0x0d, 0x07, 0x1d, 0x47, 0x1d, 0x81, 0xcb, 0x00, 0x00, 0x00, 0x32, 0x99, 0x49 },
+	{ 0x28, 0x4c, 0x1f, 0x83, 0x05, 0x73, 0x45, 0x73, 0x86, 0x25, 0x00, 0x00, 0x00, 0x1d, 0xb1, 0xa9 },
+	{ 0xae, 0x42, 0xbc, 0xcb, 0x01, 0x3b, 0x41, 0x3b, 0x88, 0x9d, 0x00, 0x00, 0x00, 0x01, 0x83, 0x99 },
+	{ 0x0c, 0x8f, 0x47, 0x03, 0x04, 0xf3, 0x44, 0xf3, 0x82, 0xa5, 0x00, 0x00, 0x00, 0x18, 0x7e, 0xa9 },
+	{ 0x1c, 0x9a, 0x8a, 0x1d, 0x06, 0x2d, 0x46, 0x2d, 0x8b, 0x3b, 0x00, 0x00, 0x00, 0x26, 0x23, 0xe9 },
+	{ 0xbb, 0x9d, 0x90, 0x3e, 0x05, 0x9e, 0x45, 0x9e, 0x87, 0x52, 0x00, 0x00, 0x00, 0x1f, 0x8d, 0x84 },
+	{ 0x7e, 0xe0, 0xd2, 0x85, 0x07, 0x15, 0x47, 0x15, 0x81, 0x93, 0x00, 0x00, 0x00, 0x32, 0x27, 0xb9 },
+	{ 0x44, 0xa4, 0x8c, 0xb1, 0x03, 0x01, 0x43, 0x01, 0x85, 0x07, 0x00, 0x00, 0x00, 0x09, 0x06, 0x01 },
+	{ 0x21, 0xad, 0x9f, 0x14, 0x01, 0x54, 0x41, 0x54, 0x89, 0x4c, 0x00, 0x00, 0x00, 0x01, 0xc3, 0x90 },
+	{ 0x6f, 0x71, 0x24, 0x19, 0x02, 0xe9, 0x42, 0xe9, 0x84, 0x5f, 0x00, 0x00, 0x00, 0x08, 0x78, 0x11 },
+	{ 0xa1, 0x2a, 0x06, 0x47, 0x05, 0x77, 0x45, 0x77, 0x86, 0x41, 0x00, 0x00, 0x00, 0x1d, 0xdd, 0x51 },
+	{ 0x5c, 0x55, 0x81, 0xd4, 0x00, 0x14, 0x40, 0x14, 0x80, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90 },
+	{ 0x92, 0x85, 0xe4, 0x4b, 0x00, 0xbb, 0x40, 0xbb, 0x85, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x88, 0x99 },
+	{ 0xff, 0x46, 0x98, 0xbd, 0x06, 0xcd, 0x46, 0xcd, 0x8f, 0x9b, 0x00, 0x00, 0x00, 0x2e, 0x40, 0x29 },
+	{ 0x41, 0x28, 0x90, 0x9a, 0x06, 0xba, 0x46, 0xba, 0x8f, 0x16, 0x00, 0x00, 0x00, 0x2d, 0x3f, 0x24 },
+	{ 0xc0, 0x15, 0x10, 0x87, 0x03, 0xb7, 0x43, 0xb7, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x0d, 0xcc, 0xd1 },
+	{ 0x32, 0x06, 0xac, 0x85, 0x01, 0x15, 0x41, 0x15, 0x87, 0x93, 0x00, 0x00, 0x00, 0x01, 0x2b, 0xb9 },
+	{ 0xd5, 0x15, 0x96, 0x03, 0x03, 0xf3, 0x43, 0xf3, 0x8b, 0xa5, 0x00, 0x00, 0x00, 0x0f, 0x98, 0xa9 },
+	{ 0x49, 0xc9, 0xc6, 0xd5, 0x04, 0x65, 0x44, 0x65, 0x8e, 0xc3, 0x00, 0x00, 0x00, 0x13, 0x4f, 0xd9 },
+	{ 0xa4, 0xa6, 0x02, 0x5e, 0x01, 0xbe, 0x41, 0xbe, 0x8c, 0x32, 0x00, 0x00, 0x00, 0x03, 0x09, 0x04 },
+	{ 0x1b, 0x6f, 0x0e, 0x29, 0x01, 0xf9, 0x41, 0xf9, 0x8d, 0xcf, 0x00, 0x00, 0x00, 0x03, 0xe4, 0x31 },
+	{ 0xde, 0x94, 0x7d, 0xdb, 0x07, 0x4b, 0x47, 0x4b, 0x83, 0x0d, 0x00, 0x00, 0x00, 0x35, 0x2f, 0xf9 },
+	{ 0x48, 0x80, 0x78, 0x4c, 0x04, 0x0c, 0x44, 0x0c, 0x8c, 0x54, 0x00, 0x00, 0x00, 0x10, 0x60, 0x90 },
+	{ 0x01, 0xa9, 0x3e, 0x0d, 0x05, 0x1d, 0x45, 0x1d, 0x83, 0xcb, 0x00, 0x00, 0x00, 0x1a, 0x25, 0x49 },
+	{ 0x74, 0x66, 0x66, 0x7b, 0x01, 0xeb, 0x41, 0xeb, 0x8d, 0x6d, 0x00, 0x00, 0x00, 0x03, 0xad, 0xb9 },
+	{ 0xda, 0x0a, 0xd8, 0x65, 0x02, 0xf5, 0x42, 0xf5, 0x84, 0xb3, 0x00, 0x00, 0x00, 0x08, 0xbe, 0x79 },
+	{ 0xbe, 0x4d, 0xff, 0xe5, 0x02, 0x75, 0x42, 0x75, 0x81, 0x33, 0x00, 0x00, 0x00, 0x06, 0x09, 0x79 },
+	{ 0x58, 0x8b, 0xbb, 0x66, 0x05, 0x46, 0x45, 0x46, 0x84, 0xea, 0x00, 0x00, 0x00, 0x1b, 0xcf, 0x24 },
+	{ 0x43, 0x0d, 0x73, 0xd1, 0x04, 0x21, 0x44, 0x21, 0x8c, 0xe7, 0x00, 0x00, 0x00, 0x11, 0x0c, 0x41 },
+	{ 0xe3, 0xa7, 0x92, 0xd2, 0x02, 0x72, 0x42, 0x72, 0x81, 0x1e, 0x00, 0x00, 0x00, 0x05, 0xfa, 0xc4 },
+	{ 0xc7, 0x1f, 0x2d, 0xe2, 0x02, 0x82, 0x42, 0x82, 0x81, 0x8e, 0x00, 0x00, 0x00, 0x06, 0x4a, 0x04 },
+	{ 0xec, 0x78, 0xc0, 0xcf, 0x02, 0x7f, 0x42, 0x7f, 0x81, 0x79, 0x00, 0x00, 0x00, 0x06, 0x3b, 0x01 },
+	{ 0x42, 0xbf, 0xa9, 0x7a, 0x05, 0x9a, 0x45, 0x9a, 0x87, 0x36, 0x00, 0x00, 0x00, 0x1f, 0x60, 0xa4 },
+	{ 0x88, 0x7d, 0x8c, 0xf2, 0x06, 0x92, 0x46, 0x92, 0x8d, 0xfe, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x44 },
+	{ 0x30, 0x03, 0xf6, 0xb9, 0x07, 0x89, 0x47, 0x89, 0x84, 0xbf, 0x00, 0x00, 0x00, 0x38, 0xc7, 0x51 },
+	{ 0x70, 0xba, 0x72, 0xa2, 0x03, 0x42, 0x43, 0x42, 0x86, 0xce, 0x00, 0x00, 0x00, 0x0a, 0x9d, 0x04 },
+	{ 0xed, 0x44, 0x4d, 0x3f, 0x01, 0xef, 0x41, 0xef, 0x8d, 0x89, 0x00, 0x00, 0x00, 0x03, 0xbd, 0x21 },
+	{ 0xac, 0x5d, 0xd9, 0x94, 0x03, 0xd4, 0x43, 0xd4, 0x8a, 0xcc, 0x00, 0x00, 0x00, 0x0e, 0xa7, 0x90 },
+	{ 0x3f, 0xfd, 0x14, 0xa6, 0x02, 0x86, 0x42, 0x86, 0x81, 0xaa, 0x00, 0x00, 0x00, 0x06, 0x5e, 0x24 },
+	{ 0x52, 0x4d, 0x2a, 0x7b, 0x05, 0xeb, 0x45, 0xeb, 0x89, 0x6d, 0x00, 0x00, 0x00, 0x23, 0x05, 0xb9 },
+	{ 0xdc, 0x6d, 0x7d, 0xb5, 0x01, 0x45, 0x41, 0x45, 0x88, 0xe3, 0x00, 0x00, 0x00, 0x01, 0x9c, 0x99 },
+	{ 0x75, 0xdf, 0xac, 0xc6, 0x04, 0xa6, 0x44, 0xa6, 0x80, 0x8a, 0x00, 0x00, 0x00, 0x15, 0x9b, 0xa4 },
+	{ 0xf1, 0x50, 0x30, 0x9c, 0x05, 0x5c, 0x45, 0x5c, 0x85, 0x84, 0x00, 0x00, 0x00, 0x1c, 0xb9, 0x10 },
+	{ 0xf4, 0x4e, 0x6a, 0x9a, 0x00, 0xba, 0x40, 0xba, 0x85, 0x16, 0x00, 0x00, 0x00, 0x00, 0x87, 0x24 },
+	{ 0x1f, 0x7a, 0xf1, 0x86, 0x05, 0x66, 0x45, 0x66, 0x85, 0xca, 0x00, 0x00, 0x00, 0x1d, 0x24, 0xa4 },
+	{ 0xac, 0x40, 0x06, 0xff, 0x07, 0xaf, 0x47, 0xaf, 0x85, 0xc9, 0x00, 0x00, 0x00, 0x3b, 0x09, 0xa1 },
+	{ 0xca, 0xfb, 0x19, 0x7d, 0x03, 0x8d, 0x43, 0x8d, 0x88, 0xdb, 0x00, 0x00, 0x00, 0x0c, 0x9b, 0xa9 },
+	{ 0xe2, 0x40, 0x71, 0xb4, 0x05, 0xf4, 0x45, 0xf4, 0x89, 0xac, 0x00, 0x00, 0x00, 0x23, 0x70, 0x90 },
+	{ 0xf8, 0x8a, 0x45, 0xb9, 0x06, 0x89, 0x46, 0x89, 0x8d, 0xbf, 0x00, 0x00, 0x00, 0x2a, 0xb5, 0x51 },
+	{ 0xa1, 0x95, 0xa3, 0x33, 0x00, 0x23, 0x40, 0x23, 0x80, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc9 },
+	{ 0x05, 0x55, 0x31, 0xe6, 0x03, 0xc6, 0x43, 0xc6, 0x8a, 0x6a, 0x00, 0x00, 0x00, 0x0e, 0x3d, 0x24 },
+	{ 0x4e, 0x41, 0x47, 0x1e, 0x02, 0x7e, 0x42, 0x7e, 0x81, 0x72, 0x00, 0x00, 0x00, 0x06, 0x36, 0x04 },
+	{ 0xed, 0x74, 0x45, 0x01, 0x04, 0x51, 0x44, 0x51, 0x8e, 0x37, 0x00, 0x00, 0x00, 0x12, 0xa1, 0xa1 },
+	{ 0xd2, 0x35, 0x2e, 0x9a, 0x04, 0xba, 0x44, 0xba, 0x81, 0x16, 0x00, 0x00, 0x00, 0x16, 0x57, 0x24 },
+	{ 0x59, 0xa5, 0x12, 0x2d, 0x03, 0x3d, 0x43, 0x3d, 0x86, 0xab, 0x00, 0x00, 0x00, 0x0a, 0x7c, 0x89 },
+	{ 0xf3, 0xb2, 0xd5, 0xec, 0x03, 0xac, 0x43, 0xac, 0x89, 0xb4, 0x00, 0x00, 0x00, 0x0d, 0x7b, 0x90 },
+	{ 0xa6, 0x6d, 0x13, 0x00, 0x03, 0x00, 0x43, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00 },
+	{ 0xda, 0xb8, 0x92, 0x40, 0x06, 0x40, 0x46, 0x40, 0x8b, 0xc0, 0x00, 0x00, 0x00, 0x27, 0x10, 0x00 },
+	{ 0x37, 0xa9, 0xa8, 0xc2, 0x03, 0x62, 0x43, 0x62, 0x87, 0xae, 0x00, 0x00, 0x00, 0x0b, 0x71, 0x84 },
+	{ 0xb4, 0x33, 0x83, 0x5f, 0x02, 0x0f, 0x42, 0x0f, 0x8e, 0x69, 0x00, 0x00, 0x00, 0x04, 0x3c, 0xe1 },
+	{ 0x8a, 0xb0, 0x3a, 0x80, 0x02, 0x80, 0x42, 0x80, 0x81, 0x80, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00 },
+	{ 0x4a, 0xc5, 0x4b, 0x07, 0x06, 0x37, 0x46, 0x37, 0x8b, 0x81, 0x00, 0x00, 0x00, 0x26, 0x9f, 0xd1 },
+	{ 0x1a, 0x85, 0xaf, 0x24, 0x06, 0x64, 0x46, 0x64, 0x8c, 0xbc, 0x00, 0x00, 0x00, 0x28, 0xd7, 0x10 },
+	{ 0x59, 0x75, 0x1a, 0x6b, 0x00, 0xdb, 0x40, 0xdb, 0x85, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x59 },
+	{ 0x23, 0x56, 0xdd, 0x21, 0x06, 0x71, 0x46, 0x71, 0x8d, 0x17, 0x00, 0x00, 0x00, 0x29, 0x7d, 0xe1 },
+	{ 0xf6, 0x63, 0x45, 0x93, 0x00, 0x83, 0x40, 0x83, 0x83, 0x95, 0x00, 0x00, 0x00, 0x00, 0x43, 0x09 },
+	{ 0x95, 0xc6, 0x3b, 0x38, 0x04, 0xb8, 0x44, 0xb8, 0x81, 0x08, 0x00, 0x00, 0x00, 0x16, 0x44, 0x40 },
+	{ 0x12, 0xcd, 0xd7, 0xee, 0x04, 0x4e, 0x44, 0x4e, 0x8e, 0x22, 0x00, 0x00, 0x00, 0x12, 0x87, 0xc4 },
+	{ 0x16, 0x49, 0xd4, 0x05, 0x00, 0x95, 0x40, 0x95, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x56, 0xb9 },
+	{ 0xe6, 0x3a, 0x2f, 0xe4, 0x03, 0x24, 0x43, 0x24, 0x85, 0xfc, 0x00, 0x00, 0x00, 0x09, 0xdd, 0x10 },
+	{ 0x5f, 0xe3, 0xa3, 0x18, 0x02, 0x98, 0x42, 0x98, 0x82, 0x28, 0x00, 0x00, 0x00, 0x06, 0xba, 0x40 },
+	{ 0xf5, 0x19, 0xf7, 0x0a, 0x00, 0x2a, 0x40, 0x2a, 0x81, 0x26, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe4 },
+	{ 0x47, 0xe4, 0xe3, 0x9e, 0x06, 0xfe, 0x46, 0xfe, 0x80, 0xf2, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x04 },
+	{ 0x6b, 0xc5, 0x30, 0x40, 0x04, 0x40, 0x44, 0x40, 0x8d, 0xc0, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00 },
+	{ 0x6c, 0x12, 0xfa, 0x97, 0x02, 0xc7, 0x42, 0xc7, 0x83, 0x71, 0x00, 0x00, 0x00, 0x07, 0xb6, 0xb1 },
+	{ 0x1d, 0x36, 0x1e, 0xcb, 0x03, 0x3b, 0x43, 0x3b, 0x86, 0x9d, 0x00, 0x00, 0x00, 0x0a, 0x6f, 0x99 },
+	{ 0xff, 0x34, 0x73, 0x90, 0x00, 0x90, 0x40, 0x90, 0x83, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00 },
+	{ 0xe4, 0xa3, 0x17, 0x04, 0x04, 0x44, 0x44, 0x44, 0x8d, 0xdc, 0x00, 0x00, 0x00, 0x12, 0x32, 0x10 },
+	{ 0xf5, 0x2c, 0x1c, 0x37, 0x06, 0x67, 0x46, 0x67, 0x8c, 0xd1, 0x00, 0x00, 0x00, 0x28, 0xfd, 0x71 },
+	{ 0xae, 0xf0, 0x76, 0xa6, 0x04, 0x86, 0x44, 0x86, 0x8f, 0xaa, 0x00, 0x00, 0x00, 0x14, 0x76, 0x24 },
+	{ 0x01, 0x2b, 0x7b, 0xf4, 0x04, 0x34, 0x44, 0x34, 0x8d, 0x6c, 0x00, 0x00, 0x00, 0x11, 0xaa, 0x90 },
+	{ 0x98, 0xa6, 0xa2, 0xa1, 0x03, 0xf1, 0x43, 0xf1, 0x8b, 0x97, 0x00, 0x00, 0x00, 0x0f, 0x88, 0xe1 },
+	{ 0x64, 0xbb, 0x12, 0xe5, 0x05, 0x75, 0x45, 0x75, 0x86, 0x33, 0x00, 0x00, 0x00, 0x1d, 0xc7, 0x79 },
+	{ 0x7f, 0x4c, 0x6f, 0x71, 0x01, 0xc1, 0x41, 0xc1, 0x8c, 0x47, 0x00, 0x00, 0x00, 0x03, 0x13, 0x81 },
+	{ 0x4c, 0x2c, 0x6c, 0x25, 0x02, 0xb5, 0x42, 0xb5, 0x82, 0xf3, 0x00, 0x00, 0x00, 0x07, 0x53, 0xf9 },
+	{ 0x16, 0x5b, 0xf9, 0x32, 0x06, 0xd2, 0x46, 0xd2, 0x8f, 0xbe, 0x00, 0x00, 0x00, 0x2e, 0x84, 0x44 },
+	{ 0x97, 0x2d, 0x5c, 0x56, 0x01, 0x36, 0x41, 0x36, 0x88, 0x7a, 0x00, 0x00, 0x00, 0x01, 0x77, 0x64 },
+	{ 0xfa, 0x8c, 0xfb, 0x85, 0x00, 0x15, 0x40, 0x15, 0x80, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb9 },
+	{ 0xe6, 0x1c, 0x5d, 0x4f, 0x06, 0xff, 0x46, 0xff, 0x80, 0xf9, 0x00, 0x00, 0x00, 0x30, 0xf2, 0x01 },
+	{ 0x0a, 0x4a, 0x74, 0x48, 0x02, 0xc8, 0x42, 0xc8, 0x83, 0x78, 0x00, 0x00, 0x00, 0x07, 0xbc, 0x40 },
+	{ 0xe9, 0x98, 0x59, 0x66, 0x03, 0x46, 0x43, 0x46, 0x86, 0xea, 0x00, 0x00, 0x00, 0x0a, 0xb7, 0x24 },
+	{ 0x58, 0x3d, 0xf1, 0x0f, 0x06, 0xbf, 0x46, 0xbf, 0x8f, 0x39, 0x00, 0x00, 0x00, 0x2d, 0x82, 0x81 },
+	{ 0x7f, 0x2e, 0x9c, 0xdc, 0x05, 0x9c, 0x45, 0x9c, 0x87, 0x44, 0x00, 0x00, 0x00, 0x1f, 0x77, 0x10 },
+	{ 0xe8, 0x31, 0x38, 0x48, 0x06, 0xc8, 0x46, 0xc8, 0x8f, 0x78, 0x00, 0x00, 0x00, 0x2d, 0xfc, 0x40 },
+	{ 0xcf, 0x24, 0xcf, 0x6f, 0x03, 0x1f, 0x43, 0x1f, 0x85, 0xd9, 0x00, 0x00, 0x00, 0x09, 0xbd, 0xc1 },
+	{ 0x92, 0x68, 0x11, 0xb6, 0x04, 0x96, 0x44, 0x96, 0x80, 0x1a, 0x00, 0x00, 0x00, 0x15, 0x07, 0xe4 },
+	{ 0xde, 0xe2, 0x48, 0x32, 0x05, 0xd2, 0x45, 0xd2, 0x88, 0xbe, 0x00, 0x00, 0x00, 0x21, 0xe0, 0x44 },
+	{ 0xd2, 0xb2, 0xf0, 0xb3, 0x05, 0xa3, 0x45, 0xa3, 0x87, 0x75, 0x00, 0x00, 0x00, 0x1f, 0xc5, 0xc9 },
+	{ 0x6e, 0x57, 0xcd, 0x52, 0x04, 0xf2, 0x44, 0xf2, 0x82, 0x9e, 0x00, 0x00, 0x00, 0x18, 0x74, 0xc4 },
+	{ 0xa9, 0xfb, 0x34, 0x44, 0x05, 0x84, 0x45, 0x84, 0x86, 0x9c, 0x00, 0x00, 0x00, 0x1e, 0x6c, 0x10 },
+	{ 0x45, 0x70, 0x19, 0x21, 0x02, 0x71, 0x42, 0x71, 0x81, 0x17, 0x00, 0x00, 0x00, 0x05, 0xf5, 0xe1 },
+	{ 0xb2, 0x00, 0xd5, 0xd1, 0x06, 0x21, 0x46, 0x21, 0x8a, 0xe7, 0x00, 0x00, 0x00, 0x25, 0x90, 0x41 },
+	{ 0xc2, 0xf5, 0x77, 0xf0, 0x02, 0xf0, 0x42, 0xf0, 0x84, 0x90, 0x00, 0x00, 0x00, 0x08, 0xa1, 0x00 },
+	{ 0x33, 0x7f, 0xf2, 0xd0, 0x03, 0xd0, 0x43, 0xd0, 0x8a, 0xb0, 0x00, 0x00, 0x00, 0x0e, 0x89, 0x00 },
+	{ 0x90, 0xa1, 0x01, 0x14, 0x03, 0x54, 0x43, 0x54, 0x87, 0x4c, 0x00, 0x00, 0x00, 0x0b, 0x13, 0x90 },
+	{ 0x61, 0xaa, 0xb3, 0xba, 0x03, 0xda, 0x43, 0xda, 0x8a, 0xf6, 0x00, 0x00, 0x00, 0x0e, 0xd5, 0xa4 },
+	{ 0x3f, 0x13, 0xb5, 0xa1, 0x06, 0xf1, 0x46, 0xf1, 0x80, 0x97, 0x00, 0x00, 0x00, 0x30, 0x2e, 0xe1 },
+	{ 0x69, 0xce, 0x27, 0xdc, 0x00, 0x9c, 0x40, 0x9c, 0x84, 0x44, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x10 },
+	{ 0xcf, 0x72, 0x99, 0xc6, 0x01, 0xa6, 0x41, 0xa6, 0x8b, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xa4 },
+	{ 0xcb, 0xa8, 0xd3, 0x58, 0x06, 0xd8, 0x46, 0xd8, 0x8f, 0xe8, 0x00, 0x00, 0x00, 0x2e, 0xd6, 0x40 },
+	{ 0x71, 0x56, 0x07, 0x50, 0x00, 0x50, 0x40, 0x50, 0x82, 0x30, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00 },
+	{ 0x47, 0x37, 0x29, 0xc3, 0x03, 0xb3, 0x43, 0xb3, 0x89, 0xe5, 0x00, 0x00, 0x00, 0x0d, 0xaf, 0x29 },
+	{ 0xf8, 0x5a, 0x4d, 0xf7, 0x04, 0x27, 0x44, 0x27, 0x8d, 0x11, 0x00, 0x00, 0x00, 0x11, 0x3d, 0xf1 },
+	{ 0xa0, 0x5e, 0x79, 0xd7, 0x06, 0x07, 0x46, 0x07, 0x8a, 0x31, 0x00, 0x00, 0x00, 0x24, 0x54, 0x31 },
+	{ 0x88, 0x9b, 0x5f, 0x87, 0x02, 0xb7, 0x42, 0xb7, 0x83, 0x01, 0x00, 0x00, 0x00, 0x07, 0x5e, 0xd1 },
+	{ 0xe4, 0x73, 0x1f, 0x42, 0x01, 0xe2, 0x41, 0xe2, 0x8d, 0x2e, 0x00, 0x00, 0x00, 0x03, 0x8b, 0x84 },
+	{ 0xb6, 0xa8, 0x4d, 0xdc, 0x06, 0x9c, 0x46, 0x9c, 0x8e, 0x44, 0x00, 0x00, 0x00, 0x2b, 0xaf, 0x10 },
+	{ 0xdd, 0xe6, 0xc4, 0x00, 0x04, 0x00, 0x44, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00 },
+	{ 0x88, 0x1d, 0x9d, 0x6e, 0x01, 0xce, 0x41, 0xce, 0x8c, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x41, 0xc4 },
+	{ 0x36, 0x90, 0x51, 0xfb, 0x05, 0x6b, 0x45, 0x6b, 0x85, 0xed, 0x00, 0x00, 0x00, 0x1d, 0x5a, 0xb9 },
+	{ 0xb9, 0x88, 0xb5, 0x45, 0x05, 0xd5, 0x45, 0xd5, 0x88, 0xd3, 0x00, 0x00, 0x00, 0x22, 0x03, 0x39 },
+	{ 0xd1, 0xe7, 0x64, 0x43, 0x06, 0x33, 0x46, 0x33, 0x8b, 0x65, 0x00, 0x00, 0x00, 0x26, 0x6e, 0x29 },
+	{ 0x77, 0x58, 0xf3, 0x11, 0x07, 0x61, 0x47, 0x61, 0x83, 0xa7, 0x00, 0x00, 0x00, 0x36, 0x72, 0xc1 },
+	{ 0xb0, 0x87, 0x8f, 0x86, 0x03, 0x66, 0x43, 0x66, 0x87, 0xca, 0x00, 0x00, 0x00, 0x0b, 0x8c, 0xa4 },
+	{ 0x02, 0xc2, 0x94, 0xd4, 0x03, 0x14, 0x43, 0x14, 0x85, 0x8c, 0x00, 0x00, 0x00, 0x09, 0x79, 0x90 },
+	{ 0xc6, 0x23, 0xa9, 0xb0, 0x00, 0xb0, 0x40, 0xb0, 0x84, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00 },
+	{ 0x96, 0xc1, 0xbf, 0x6a, 0x06, 0x8a, 0x46, 0x8a, 0x8d, 0xc6, 0x00, 0x00, 0x00, 0x2a, 0xc2, 0x64 },
+	{ 0xac, 0xdb, 0x9b, 0xad, 0x04, 0xbd, 0x44, 0xbd, 0x81, 0x2b, 0x00, 0x00, 0x00, 0x16, 0x73, 0x89 },
+	{ 0x26, 0xd2, 0xd9, 0x38, 0x02, 0xb8, 0x42, 0xb8, 0x83, 0x08, 0x00, 0x00, 0x00, 0x07, 0x64, 0x40 },
+	{ 0x19, 0x3c, 0x60, 0x9b, 0x06, 0x0b, 0x46, 0x0b, 0x8a, 0x4d, 0x00, 0x00, 0x00, 0x24, 0x84, 0x79 },
+	{ 0x51, 0x51, 0xa6, 0x49, 0x04, 0x19, 0x44, 0x19, 0x8c, 0xaf, 0x00, 0x00, 0x00, 0x10, 0xca, 0x71 },
+	{ 0x8d, 0xde, 0x6c, 0x40, 0x00, 0x40, 0x40, 0x40, 0x81, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00 },
+	{ 0x10, 0xd6, 0xcf, 0x8a, 0x00, 0xaa, 0x40, 0xaa, 0x84, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x70, 0xe4 },
+	{ 0x50, 0x86, 0x19, 0xd9, 0x04, 0xa9, 0x44, 0xa9, 0x80, 0x9f, 0x00, 0x00, 0x00, 0x15, 0xb7, 0x91 },
+	{ 0x67, 0xe9, 0x44, 0xa5, 0x03, 0x35, 0x43, 0x35, 0x86, 0x73, 0x00, 0x00, 0x00, 0x0a, 0x48, 0xf9 },
+	{ 0xbd, 0x82, 0x73, 0x75, 0x03, 0x05, 0x43, 0x05, 0x85, 0x23, 0x00, 0x00, 0x00, 0x09, 0x1e, 0x19 },
+	{ 0xd4, 0x1a, 0x11, 0xd1, 0x02, 0x21, 0x42, 0x21, 0x8e, 0xe7, 0x00, 0x00, 0x00, 0x04, 0x88, 0x41 },
+	{ 0x86, 0xd4, 0x4e, 0xe5, 0x01, 0x75, 0x41, 0x75, 0x8a, 0x33, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x79 },
+	{ 0x22, 0xd9, 0x1b, 0x08, 0x05, 0x88, 0x45, 0x88, 0x86, 0xb8, 0x00, 0x00, 0x00, 0x1e, 0x98, 0x40 },
+	{ 0xd1, 0x09, 0xb2, 0xa6, 0x00, 0x86, 0x40, 0x86, 0x83, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x46, 0x24 },
+	{ 0xe1, 0x62, 0xc0, 0x17, 0x00, 0x47, 0x40, 0x47, 0x81, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x13, 0xb1 },
+	{ 0x5a, 0xbe, 0x68, 0xf4, 0x01, 0x34, 0x41, 0x34, 0x88, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x72, 0x90 },
+	{ 0xf2, 0xb7, 0x51, 0xba, 0x01, 0xda, 0x41, 0xda, 0x8c, 0xf6, 0x00, 0x00, 0x00, 0x03, 0x6d, 0xa4 },
+	{ 0xb9, 0x58, 0xbd, 0x83, 0x03, 0x73, 0x43, 0x73, 0x88, 0x25, 0x00, 0x00, 0x00, 0x0b, 0xe5, 0xa9 },
+	{ 0x86, 0x08, 0xc2, 0x75, 0x02, 0x05, 0x42, 0x05, 0x8e, 0x23, 0x00, 0x00, 0x00, 0x04, 0x14, 0x19 },
+	{ 0x8b, 0x5d, 0xf4, 0x5b, 0x05, 0xcb, 0x45, 0xcb, 0x88, 0x8d, 0x00, 0x00, 0x00, 0x21, 0x8e, 0xf9 },
+	{ 0x1d, 0xb3, 0xe0, 0xe4, 0x04, 0x24, 0x44, 0x24, 0x8c, 0xfc, 0x00, 0x00, 0x00, 0x11, 0x25, 0x10 },
+	{ 0x90, 0x83, 0x2e, 0x7f, 0x07, 0x2f, 0x47, 0x2f, 0x82, 0x49, 0x00, 0x00, 0x00, 0x33, 0x9a, 0xa1 },
+	{ 0x42, 0x71, 0xdf, 0x23, 0x07, 0x13, 0x47, 0x13, 0x81, 0x85, 0x00, 0x00, 0x00, 0x32, 0x0b, 0x69 },
+	{ 0x41, 0x46, 0x63, 0x2f, 0x02, 0xdf, 0x42, 0xdf, 0x84, 0x19, 0x00, 0x00, 0x00, 0x08, 0x3e, 0x41 },
+	{ 0x76, 0xab, 0x39, 0x36, 0x04, 0x16, 0x44, 0x16, 0x8c, 0x9a, 0x00, 0x00, 0x00, 0x10, 0xb1, 0xe4 },
+	{ 0x08, 0x17, 0xc6, 0xba, 0x06, 0xda, 0x46, 0xda, 0x8f, 0xf6, 0x00, 0x00, 0x00, 0x2e, 0xf1, 0xa4 },
+	{ 0x3f, 0x7f, 0x52, 0x8d, 0x01, 0x9d, 0x41, 0x9d, 0x8b, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x9a, 0x49 },
+	{ 0xf2, 0x69, 0x87, 0x63, 0x03, 0x53, 0x43, 0x53, 0x87, 0x45, 0x00, 0x00, 0x00, 0x0b, 0x0c, 0xe9 },
+	{ 0xd9, 0xbd, 0x0e, 0x0e, 0x04, 0x6e, 0x44, 0x6e, 0x8f, 0x02, 0x00, 0x00, 0x00, 0x13, 0x9f, 0x44 },
+	{ 0xb9, 0x0a, 0xf3, 0x2c, 0x04, 0xec, 0x44, 0xec, 0x82, 0x74, 0x00, 0x00, 0x00, 0x18, 0x39, 0x90 },
+	{ 0xb9, 0xd6, 0x7f, 0x9c, 0x04, 0x5c, 0x44, 0x5c, 0x8e, 0x84, 0x00, 0x00, 0x00, 0x13, 0x01, 0x10 },
+	{ 0xd5, 0x33, 0x68, 0x98, 0x00, 0x18, 0x40, 0x18, 0x80, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40 },
+	{ 0x70, 0x6c, 0xa8, 0x4b, 0x04, 0xbb, 0x44, 0xbb, 0x81, 0x1d, 0x00, 0x00, 0x00, 0x16, 0x60, 0x99 },
+	{ 0xab, 0xb0, 0x1f, 0xb9, 0x00, 0x89, 0x40, 0x89, 0x83, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x49, 0x51 },
+	{ 0x53, 0x66, 0x81, 0x42, 0x03, 0xe2, 0x43, 0xe2, 0x8b, 0x2e, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x84 },
+	{ 0xb7, 0xf1, 0x9c, 0x65, 0x06, 0xf5, 0x46, 0xf5, 0x80, 0xb3, 0x00, 0x00, 0x00, 0x30, 0x66, 0x79 },
+	{ 0x38, 0x27, 0x6a, 0xdb, 0x04, 0x4b, 0x44, 0x4b, 0x8e, 0x0d, 0x00, 0x00, 0x00, 0x12, 0x6d, 0xf9 },
+	{ 0x0a, 0x2c, 0xa1, 0xb3, 0x06, 0xa3, 0x46, 0xa3, 0x8e, 0x75, 0x00, 0x00, 0x00, 0x2c, 0x0b, 0xc9 },
+	{ 0x5f, 0x18, 0x16, 0xa8, 0x03, 0x28, 0x43, 0x28, 0x86, 0x18, 0x00, 0x00, 0x00, 0x09, 0xf6, 0x40 },
+	{ 0xb0, 0x09, 0xcd, 0x6d, 0x02, 0x7d, 0x42, 0x7d, 0x81, 0x6b, 0x00, 0x00, 0x00, 0x06, 0x31, 0x09 },
+	{ 0x35, 0xc4, 0xc5, 0x8b, 0x05, 0xfb, 0x45, 0xfb, 0x89, 0xdd, 0x00, 0x00, 0x00, 0x23, 0xc4, 0x19 },
+	{ 0x1a, 0xd3, 0x79, 0x7b, 0x04, 0xeb, 0x44, 0xeb, 0x82, 0x6d, 0x00, 0x00, 0x00, 0x18, 0x2f, 0xb9 },
+	{ 0x72, 0x81, 0x83, 0x44, 0x04, 0x84, 0x44, 0x84, 0x8f, 0x9c, 0x00, 0x00, 0x00, 0x14, 0x64, 0x10 },
+	{ 0x0f, 0x9f, 0xa6, 0x2e, 0x06, 0x8e, 0x46, 0x8e, 0x8d, 0xe2, 0x00, 0x00, 0x00, 0x2a, 0xf6, 0xc4 },
+	{ 0x38, 0xc2, 0xff, 0x89, 0x01, 0x59, 0x41, 0x59, 0x89, 0x6f, 0x00, 0x00, 0x00, 0x01, 0xd0, 0xf1 },
+	{ 0x02, 0x74, 0xca, 0x7d, 0x04, 0x8d, 0x44, 0x8d, 0x8f, 0xdb, 0x00, 0x00, 0x00, 0x14, 0xb5, 0xa9 },
+	{ 0xbf, 0x97, 0x4e, 0x6e, 0x02, 0xce, 0x42, 0xce, 0x83, 0xa2, 0x00, 0x00, 0x00, 0x07, 0xdd, 0xc4 },
+	{ 0x49, 0x7b, 0xfc, 0x7e, 0x05, 0xde, 0x45, 0xde, 0x89, 0x12, 0x00, 0x00, 0x00, 0x22, 0x6c, 0x84 },
+	{ 0xa9, 0xcb, 0x3c, 0x82, 0x03, 0x22, 0x43, 0x22, 0x85, 0xee, 0x00, 0x00, 0x00, 0x09, 0xd0, 0x84 },
+	{ 0xa5, 0xef, 0x50, 0xe7, 0x02, 0x17, 0x42, 0x17, 0x8e, 0xa1, 0x00, 0x00, 0x00, 0x04, 0x5e, 0x11 },
+	{ 0x47, 0x67, 0x21, 0x85, 0x06, 0x15, 0x46, 0x15, 0x8a, 0x93, 0x00, 0x00, 0x00, 0x24, 0xfd, 0xb9 },
+	{ 0xae, 0x72, 0xb4, 0x8d, 0x03, 0x9d, 0x43, 0x9d, 0x89, 0x4b, 0x00, 0x00, 0x00, 0x0d, 0x0e, 0x49 },
+	{ 0xf9, 0x73, 0xa4, 0xbe, 0x02, 0x1e, 0x42, 0x1e, 0x8e, 0xd2, 0x00, 0x00, 0x00, 0x04, 0x7b, 0x84 },
+	{ 0x3d, 0x6a, 0x77, 0x94, 0x01, 0xd4, 0x41, 0xd4, 0x8c, 0xcc, 0x00, 0x00, 0x00, 0x03, 0x57, 0x90 },
+	{ 0xb6, 0x2a, 0x8b, 0xc3, 0x05, 0xb3, 0x45, 0xb3, 0x87, 0xe5, 0x00, 0x00, 0x00, 0x20, 0x7b, 0x29 },
+	{ 0x1b, 0xce, 0xfd, 0xad, 0x06, 0xbd, 0x46, 0xbd, 0x8f, 0x2b, 0x00, 0x00, 0x00, 0x2d, 0x67, 0x89 },
+	{ 0x61, 0xf8, 0x7e, 0x11, 0x02, 0x61, 0x42, 0x61, 0x80, 0xa7, 0x00, 0x00, 0x00, 0x05, 0xa8, 0xc1 },
+	{ 0x3c, 0xec, 0xb5, 0x7b, 0x00, 0xeb, 0x40, 0xeb, 0x86, 0x6d, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xb9 },
+	{ 0xbd, 0x52, 0x7b, 0xb3, 0x00, 0xa3, 0x40, 0xa3, 0x84, 0x75, 0x00, 0x00, 0x00, 0x00, 0x67, 0xc9 },
+	{ 0xe3, 0x89, 0xc0, 0x3d, 0x06, 0x4d, 0x46, 0x4d, 0x8c, 0x1b, 0x00, 0x00, 0x00, 0x27, 0xb3, 0x29 },
+	{ 0xdf, 0x7d, 0xdc, 0xe0, 0x02, 0xe0, 0x42, 0xe0, 0x84, 0x20, 0x00, 0x00, 0x00, 0x08, 0x44, 0x00 },
+	{ 0x11, 0xa2, 0x5b, 0xfa, 0x00, 0x1a, 0x40, 0x1a, 0x80, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa4 },
+	{ 0x89, 0x96, 0xe3, 0xb9, 0x04, 0x89, 0x44, 0x89, 0x8f, 0xbf, 0x00, 0x00, 0x00, 0x14, 0x91, 0x51 },
+	{ 0x32, 0xe4, 0x5e, 0x22, 0x06, 0xc2, 0x46, 0xc2, 0x8f, 0x4e, 0x00, 0x00, 0x00, 0x2d, 0xab, 0x04 },
+	{ 0x1b, 0xec, 0xd0, 0x42, 0x02, 0xe2, 0x42, 0xe2, 0x84, 0x2e, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x84 },
+	{ 0xdc, 0xcd, 0x6d, 0x39, 0x06, 0x09, 0x46, 0x09, 0x8a, 0x3f, 0x00, 0x00, 0x00, 0x24, 0x6c, 0x51 },
+	{ 0x98, 0xf4, 0x6c, 0xf8, 0x02, 0x78, 0x42, 0x78, 0x81, 0x48, 0x00, 0x00, 0x00, 0x06, 0x18, 0x40 },
+	{ 0xa4, 0xf3, 0xcc, 0xb5, 0x00, 0x45, 0x40, 0x45, 0x81, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x12, 0x99 },
+	{ 0xc8, 0x38, 0x84, 0xa9, 0x00, 0x79, 0x40, 0x79, 0x83, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x39, 0x31 },
+	{ 0xcc, 0x44, 0x68, 0x06, 0x03, 0xe6, 0x43, 0xe6, 0x8b, 0x4a, 0x00, 0x00, 0x00, 0x0f, 0x32, 0xa4 },
+	{ 0x9f, 0xb0, 0xbf, 0xfc, 0x02, 0xbc, 0x42, 0xbc, 0x83, 0x24, 0x00, 0x00, 0x00, 0x07, 0x7a, 0x10 },
+	{ 0x84, 0xa1, 0xa1, 0x57, 0x05, 0x87, 0x45, 0x87, 0x86, 0xb1, 0x00, 0x00, 0x00, 0x1e, 0x8d, 0x31 },
+	{ 0xf9, 0xf1, 0x66, 0xd7, 0x03, 0x07, 0x43, 0x07, 0x85, 0x31, 0x00, 0x00, 0x00, 0x09, 0x2a, 0x31 },
+	{ 0xcc, 0x92, 0x32, 0x5d, 0x02, 0x6d, 0x42, 0x6d, 0x80, 0xfb, 0x00, 0x00, 0x00, 0x05, 0xe2, 0x69 },
+	{ 0x04, 0x89, 0xa5, 0x76, 0x04, 0x56, 0x44, 0x56, 0x8e, 0x5a, 0x00, 0x00, 0x00, 0x12, 0xcc, 0xe4 },
+	{ 0x58, 0x0d, 0xf9, 0x4d, 0x04, 0x5d, 0x44, 0x5d, 0x8e, 0x8b, 0x00, 0x00, 0x00, 0x13, 0x09, 0xc9 },
+	{ 0xa1, 0xc5, 0x9a, 0xf5, 0x02, 0x85, 0x42, 0x85, 0x81, 0xa3, 0x00, 0x00, 0x00, 0x06, 0x59, 0x19 },
+	{ 0x0e, 0x26, 0x5f, 0xe3, 0x03, 0xd3, 0x43, 0xd3, 0x8a, 0xc5, 0x00, 0x00, 0x00, 0x0e, 0x9f, 0xe9 },
+	{ 0x63, 0x41, 0xcc, 0x9a, 0x02, 0xba, 0x42, 0xba, 0x83, 0x16, 0x00, 0x00, 0x00, 0x07, 0x6f, 0x24 },
+	{ 0x85, 0x0d, 0x3e, 0x43, 0x00, 0x33, 0x40, 0x33, 0x81, 0x65, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x29 },
+	{ 0x78, 0xc0, 0x14, 0x2f, 0x03, 0xdf, 0x43, 0xdf, 0x8b, 0x19, 0x00, 0x00, 0x00, 0x0e, 0xfc, 0x41 },
+	{ 0x96, 0x61, 0xcf, 0xe6, 0x01, 0xc6, 0x41, 0xc6, 0x8c, 0x6a, 0x00, 0x00, 0x00, 0x03, 0x25, 0x24 },
+	{ 0x99, 0x54, 0x5c, 0x7c, 0x07, 0x3c, 0x47, 0x3c, 0x82, 0xa4, 0x00, 0x00, 0x00, 0x34, 0x56, 0x10 },
+	{ 0x3a, 0x5a, 0x18, 0x69, 0x00, 0x39, 0x40, 0x39, 0x81, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xb1 },
+	{ 0x5a, 0xd0, 0x8e, 0x21, 0x07, 0x71, 0x47, 0x71, 0x84, 0x17, 0x00, 0x00, 0x00, 0x37, 0x5f, 0xe1 },
+	{ 0xf9, 0x25, 0xda, 0x67, 0x03, 0x97, 0x43, 0x97, 0x89, 0x21, 0x00, 0x00, 0x00, 0x0c, 0xe3, 0x11 },
+	{ 0x13, 0x99, 0x64, 0x5e, 0x03, 0xbe, 0x43, 0xbe, 0x8a, 0x32, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x04 },
+	{ 0x6c, 0x42, 0xf2, 0x59, 0x05, 0x29, 0x45, 0x29, 0x84, 0x1f, 0x00, 0x00, 0x00, 0x1a, 0xa0, 0x91 },
+	{ 0xdd, 0xb6, 0xcc, 0x3e, 0x01, 0x9e, 0x41, 0x9e, 0x8b, 0x52, 0x00, 0x00, 0x00, 0x02, 0x9d, 0x84 },
+	{ 0x45, 0x52, 0x46, 0x8c, 0x06, 0x4c, 0x46, 0x4c, 0x8c, 0x14, 0x00, 0x00, 0x00, 0x27, 0xa6, 0x90 },
+	{ 0x89, 0x49, 0x19, 0x62, 0x06, 0x02, 0x46, 0x02, 0x8a, 0x0e, 0x00, 0x00, 0x00, 0x24, 0x18, 0x04 },
+	{ 0x5d, 0x80, 0xfd, 0xc8, 0x04, 0x48, 0x44, 0x48, 0x8d, 0xf8, 0x00, 0x00, 0x00, 0x12, 0x54, 0x40 },
+	{ 0xd6, 0xdc, 0xa6, 0xa5, 0x05, 0x35, 0x45, 0x35, 0x84, 0x73, 0x00, 0x00, 0x00, 0x1b, 0x1c, 0xf9 },
+	{ 0x51, 0x9f, 0x70, 0xa0, 0x02, 0xa0, 0x42, 0xa0, 0x82, 0x60, 0x00, 0x00, 0x00, 0x06, 0xe4, 0x00 },
+	{ 0x96, 0xaf, 0x9a, 0x3d, 0x00, 0x4d, 0x40, 0x4d, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x17, 0x29 },
+	{ 0x8a, 0x80, 0x42, 0xbe, 0x00, 0x1e, 0x40, 0x1e, 0x80, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x03, 0x84 },
+	{ 0xe3, 0x59, 0xc8, 0x7b, 0x03, 0xeb, 0x43, 0xeb, 0x8b, 0x6d, 0x00, 0x00, 0x00, 0x0f, 0x59, 0xb9 },
+	{ 0x25, 0xb9, 0x82, 0x71, 0x04, 0xc1, 0x44, 0xc1, 0x81, 0x47, 0x00, 0x00, 0x00, 0x16, 0x99, 0x81 },
+	{ 0xe2, 0xbe, 0x33, 0xcd, 0x06, 0xdd, 0x46, 0xdd, 0x80, 0x0b, 0x00, 0x00, 0x00, 0x2f, 0x1a, 0xc9 },
+	{ 0x60, 0x31, 0x6d, 0x6f, 0x01, 0x1f, 0x41, 0x1f, 0x87, 0xd9, 0x00, 0x00, 0x00, 0x01, 0x41, 0xc1 },
+	{ 0x6e, 0xd5, 0x8f, 0x6b, 0x05, 0xdb, 0x45, 0xdb, 0x88, 0xfd, 0x00, 0x00, 0x00, 0x22, 0x49, 0x59 },
+	{ 0xf0, 0x84, 0xa4, 0x2c, 0x05, 0xec, 0x45, 0xec, 0x89, 0x74, 0x00, 0x00, 0x00, 0x23, 0x11, 0x90 },
+	{ 0xa6, 0x4f, 0x40, 0x6b, 0x06, 0xdb, 0x46, 0xdb, 0x8f, 0xfd, 0x00, 0x00, 0x00, 0x2e, 0xff, 0x59 },
+	{ 0xa7, 0x68, 0x97, 0x32, 0x04, 0xd2, 0x44, 0xd2, 0x81, 0xbe, 0x00, 0x00, 0x00, 0x17, 0x3c, 0x44 },
+	{ 0xe1, 0x74, 0xe5, 0x44, 0x06, 0x84, 0x46, 0x84, 0x8d, 0x9c, 0x00, 0x00, 0x00, 0x2a, 0x74, 0x10 },
+	{ 0x9a, 0x6d, 0xb3, 0x43, 0x05, 0x33, 0x45, 0x33, 0x84, 0x65, 0x00, 0x00, 0x00, 0x1b, 0x08, 0x29 },
+	{ 0x77, 0xa6, 0xbd, 0x68, 0x05, 0xe8, 0x45, 0xe8, 0x89, 0x58, 0x00, 0x00, 0x00, 0x22, 0xe2, 0x40 },
+	{ 0x26, 0xb5, 0x06, 0xa3, 0x06, 0x93, 0x46, 0x93, 0x8e, 0x05, 0x00, 0x00, 0x00, 0x2b, 0x38, 0x69 },
+	{ 0x03, 0xee, 0x10, 0xc8, 0x07, 0x48, 0x47, 0x48, 0x82, 0xf8, 0x00, 0x00, 0x00, 0x35, 0x04, 0x40 },
+	{ 0x95, 0x78, 0x70, 0xe1, 0x06, 0x31, 0x46, 0x31, 0x8b, 0x57, 0x00, 0x00, 0x00, 0x26, 0x55, 0x61 },
+	{ 0x30, 0x6f, 0x93, 0xa5, 0x02, 0x35, 0x42, 0x35, 0x8f, 0x73, 0x00, 0x00, 0x00, 0x04, 0xde, 0xf9 },
+	{ 0xe3, 0x0b, 0xfe, 0x24, 0x05, 0x64, 0x45, 0x64, 0x85, 0xbc, 0x00, 0x00, 0x00, 0x1d, 0x0f, 0x10 },
+	{ 0x22, 0x2b, 0x61, 0x2d, 0x02, 0x3d, 0x42, 0x3d, 0x8f, 0xab, 0x00, 0x00, 0x00, 0x05, 0x02, 0x89 },
+	{ 0x90, 0x71, 0x09, 0x52, 0x00, 0xf2, 0x40, 0xf2, 0x86, 0x9e, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xc4 },
+	{ 0xd0, 0x20, 0x53, 0xa1, 0x04, 0xf1, 0x44, 0xf1, 0x82, 0x97, 0x00, 0x00, 0x00, 0x18, 0x6a, 0xe1 },
+	{ 0x70, 0x8a, 0x7a, 0xe0, 0x00, 0xe0, 0x40, 0xe0, 0x86, 0x20, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00 },
+	{ 0xa1, 0xf5, 0x92, 0xb7, 0x04, 0xe7, 0x44, 0xe7, 0x82, 0x51, 0x00, 0x00, 0x00, 0x18, 0x08, 0x71 },
+	{ 0x7a, 0x57, 0x2d, 0x0f, 0x02, 0xbf, 0x42, 0xbf, 0x83, 0x39, 0x00, 0x00, 0x00, 0x07, 0x8a, 0x81 },
+	{ 0x15, 0x00, 0x85, 0x7c, 0x00, 0x3c, 0x40, 0x3c, 0x81, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10 },
+	{ 0x1e, 0xfd, 0x2f, 0x6d, 0x04, 0x7d, 0x44, 0x7d, 0x8f, 0x6b, 0x00, 0x00, 0x00, 0x14, 0x25, 0x09 },
+	{ 0xdb, 0x06, 0x5c, 0x97, 0x04, 0xc7, 0x44, 0xc7, 0x81, 0x71, 0x00, 0x00, 0x00, 0x16, 0xd2, 0xb1 },
+	{ 0x1b, 0x9f, 0x05, 0xeb, 0x04, 0x5b, 0x44, 0x5b, 0x8e, 0x7d, 0x00, 0x00, 0x00, 0x12, 0xf8, 0x59 },
+	{ 0x91, 0x4e, 0xba, 0xef, 0x06, 0x9f, 0x46, 0x9f, 0x8e, 0x59, 0x00, 0x00, 0x00, 0x2b, 0xd6, 0xc1 },
+	{ 0x73, 0x7d, 0x07, 0x76, 0x06, 0x56, 0x46, 0x56, 0x8c, 0x5a, 0x00, 0x00, 0x00, 0x28, 0x24, 0xe4 },
+	{ 0xf7, 0xac, 0x94, 0x1c, 0x00, 0xdc, 0x40, 0xdc, 0x86, 0x04, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x10 },
+	{ 0x78, 0x12, 0x5a, 0x54, 0x00, 0x94, 0x40, 0x94, 0x84, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x55, 0x90 },
+	{ 0x8f, 0x27, 0xba, 0xc9, 0x00, 0x99, 0x40, 0x99, 0x84, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x71 },
+	{ 0x80, 0xc5, 0xb5, 0xbc, 0x04, 0x7c, 0x44, 0x7c, 0x8f, 0x64, 0x00, 0x00, 0x00, 0x14, 0x1c, 0x10 },
+	{ 0x1b, 0x21, 0x43, 0xd2, 0x03, 0x72, 0x43, 0x72, 0x88, 0x1e, 0x00, 0x00, 0x00, 0x0b, 0xde, 0xc4 },
+	{ 0x38, 0x45, 0x3d, 0x70, 0x00, 0x70, 0x40, 0x70, 0x83, 0x10, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00 },
+	{ 0x7a, 0xa4, 0xf7, 0x66, 0x01, 0x46, 0x41, 0x46, 0x88, 0xea, 0x00, 0x00, 0x00, 0x01, 0x9f, 0x24 },
+	{ 0x62, 0xa6, 0x37, 0xec, 0x05, 0xac, 0x45, 0xac, 0x87, 0xb4, 0x00, 0x00, 0x00, 0x20, 0x2b, 0x90 },
+	{ 0x0e, 0x74, 0x2a, 0x3a, 0x02, 0x5a, 0x42, 0x5a, 0x80, 0x76, 0x00, 0x00, 0x00, 0x05, 0x87, 0xa4 },
+	{ 0x06, 0x9e, 0x80, 0x6f, 0x04, 0x1f, 0x44, 0x1f, 0x8c, 0xd9, 0x00, 0x00, 0x00, 0x10, 0xfb, 0xc1 },
+	{ 0xe4, 0xd3, 0x0e, 0xc6, 0x06, 0xa6, 0x46, 0xa6, 0x8e, 0x8a, 0x00, 0x00, 0x00, 0x2c, 0x33, 0xa4 },
+	{ 0x37, 0x5b, 0xde, 0x6b, 0x04, 0xdb, 0x44, 0xdb, 0x81, 0xfd, 0x00, 0x00, 0x00, 0x17, 0x93, 0x59 },
+	{ 0x13, 0x7b, 0x91, 0xc9, 0x07, 0x99, 0x47, 0x99, 0x85, 0x2f, 0x00, 0x00, 0x00, 0x39, 0xb9, 0x71 },
+	{ 0xc5, 0x58, 0x1d, 0x40, 0x01, 0x40, 0x41, 0x40, 0x88, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00 },
+	{ 0x2b, 0x4a, 0x59, 0x81, 0x00, 0xd1, 0x40, 0xd1, 0x85, 0xb7, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa1 },
+	{ 0x84, 0xbf, 0x73, 0xec, 0x01, 0xac, 0x41, 0xac, 0x8b, 0xb4, 0x00, 0x00, 0x00, 0x02, 0xcb, 0x90 },
+	{ 0x89, 0x19, 0x21, 0xa0, 0x03, 0xa0, 0x43, 0xa0, 0x89, 0x60, 0x00, 0x00, 0x00, 0x0d, 0x24, 0x00 },
+	{ 0x73, 0xe8, 0xa4, 0x62, 0x01, 0x02, 0x41, 0x02, 0x87, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x04, 0x04 },
+	{ 0xcd, 0x8d, 0xb6, 0x8f, 0x04, 0x3f, 0x44, 0x3f, 0x8d, 0xb9, 0x00, 0x00, 0x00, 0x12, 0x07, 0x81 },
+	{ 0x47, 0x07, 0x32, 0x01, 0x01, 0x51, 0x41, 0x51, 0x89, 0x37, 0x00, 0x00, 0x00, 0x01, 0xbb, 0xa1 },
+	{ 0x19, 0x0c, 0x68, 0xd9, 0x03, 0xa9, 0x43, 0xa9, 0x89, 0x9f, 0x00, 0x00, 0x00, 0x0d, 0x65, 0x91 },
+	{ 0xa6, 0xcd, 0x02, 0x84, 0x07, 0xc4, 0x47, 0xc4, 0x86, 0x5c, 0x00, 0x00, 0x00, 0x3c, 0x4e, 0x10 },
+	{ 0x2e, 0x8a, 0xb0, 0x6e, 0x04, 0xce, 0x44, 0xce, 0x81, 0xa2, 0x00, 0x00, 0x00, 0x17, 0x15, 0xc4 },
+	{ 0xcf, 0x54, 0xc7, 0x31, 0x05, 0x81, 0x45, 0x81, 0x86, 0x87, 0x00, 0x00, 0x00, 0x1e, 0x4b, 0x01 },
+	{ 0x68, 0x67, 0x06, 0xbe, 0x04, 0x1e, 0x44, 0x1e, 0x8c, 0xd2, 0x00, 0x00, 0x00, 0x10, 0xf3, 0x84 },
+	{ 0xa4, 0x28, 0x40, 0x45, 0x00, 0xd5, 0x40, 0xd5, 0x85, 0xd3, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x39 },
+	{ 0xb4, 0x15, 0xb0, 0xca, 0x05, 0xea, 0x45, 0xea, 0x89, 0x66, 0x00, 0x00, 0x00, 0x22, 0xf9, 0xe4 },
+	{ 0x88, 0xe9, 0x29, 0xde, 0x01, 0x3e, 0x41, 0x3e, 0x88, 0xb2, 0x00, 0x00, 0x00, 0x01, 0x8b, 0x04 },
+	{ 0x8b, 0xab, 0xbe, 0xb2, 0x04, 0x52, 0x44, 0x52, 0x8e, 0x3e, 0x00, 0x00, 0x00, 0x12, 0xaa, 0x44 },
+	{ 0xd3, 0x00, 0xbb, 0x0a, 0x04, 0x2a, 0x44, 0x2a, 0x8d, 0x26, 0x00, 0x00, 0x00, 0x11, 0x56, 0xe4 },
+	{ 0xed, 0x26, 0x7a, 0xaa, 0x05, 0xca, 0x45, 0xca, 0x88, 0x86, 0x00, 0x00, 0x00, 0x21, 0x83, 0x64 },
+	{ 0xfb, 0x88, 0x7f, 0xb7, 0x01, 0xe7, 0x41, 0xe7, 0x8d, 0x51, 0x00, 0x00, 0x00, 0x03, 0x9e, 0x71 },
+	{ 0xfe, 0xc8, 0xd6, 0xa4, 0x05, 0xe4, 0x45, 0xe4, 0x89, 0x3c, 0x00, 0x00, 0x00, 0x22, 0xb3, 0x10 },
+	{ 0xf9, 0x08, 0x07, 0xd2, 0x07, 0x72, 0x47, 0x72, 0x84, 0x1e, 0x00, 0x00, 0x00, 0x37, 0x6e, 0xc4 },
+	{ 0x23, 0x26, 0xe5, 0x5f, 0x04, 0x0f, 0x44, 0x0f, 0x8c, 0x69, 0x00, 0x00, 0x00, 0x10, 0x78, 0xe1 },
+	{ 0xb0, 0x39, 0xc5, 0x2f, 0x04, 0xdf, 0x44, 0xdf, 0x82, 0x19, 0x00, 0x00, 0x00, 0x17, 0xba, 0x41 },
+	{ 0x7e, 0xb0, 0xda, 0xc3, 0x04, 0xb3, 0x44, 0xb3, 0x80, 0xe5, 0x00, 0x00, 0x00, 0x16, 0x15, 0x29 },
+	{ 0xb6, 0xf6, 0x18, 0x33, 0x05, 0x23, 0x45, 0x23, 0x83, 0xf5, 0x00, 0x00, 0x00, 0x1a, 0x62, 0xc9 },
+	{ 0x0d, 0x2a, 0xdb, 0xb1, 0x02, 0x01, 0x42, 0x01, 0x8e, 0x07, 0x00, 0x00, 0x00, 0x04, 0x04, 0x01 },
+	{ 0x58, 0xd9, 0x85, 0xbd, 0x03, 0xcd, 0x43, 0xcd, 0x8a, 0x9b, 0x00, 0x00, 0x00, 0x0e, 0x72, 0x29 },
+	{ 0x0b, 0xc3, 0xba, 0x93, 0x05, 0x83, 0x45, 0x83, 0x86, 0x95, 0x00, 0x00, 0x00, 0x1e, 0x61, 0x09 },
+	{ 0x76, 0x0f, 0xa4, 0x88, 0x07, 0x08, 0x47, 0x08, 0x81, 0x38, 0x00, 0x00, 0x00, 0x31, 0x70, 0x40 },
+	{ 0x93, 0x03, 0xa6, 0x64, 0x01, 0xa4, 0x41, 0xa4, 0x8b, 0x7c, 0x00, 0x00, 0x00, 0x02, 0xb1, 0x10 },
+	{ 0x9f, 0xfe, 0x8a, 0x53, 0x01, 0x43, 0x41, 0x43, 0x88, 0xd5, 0x00, 0x00, 0x00, 0x01, 0x97, 0x89 },
+	{ 0x54, 0x32, 0x0d, 0xb2, 0x03, 0x52, 0x43, 0x52, 0x87, 0x3e, 0x00, 0x00, 0x00, 0x0b, 0x06, 0x44 },
+	{ 0xce, 0x3b, 0x70, 0x6a, 0x07, 0x8a, 0x47, 0x8a, 0x84, 0xc6, 0x00, 0x00, 0x00, 0x38, 0xd6, 0x64 },
+	{ 0xfc, 0xb3, 0xfb, 0xab, 0x06, 0x1b, 0x46, 0x1b, 0x8a, 0xbd, 0x00, 0x00, 0x00, 0x25, 0x46, 0xd9 },
+	{ 0xf3, 0xe2, 0xcd, 0xae, 0x06, 0x0e, 0x46, 0x0e, 0x8a, 0x62, 0x00, 0x00, 0x00, 0x24, 0xa8, 0xc4 },
+	{ 0x67, 0x1d, 0xb8, 0x35, 0x03, 0xc5, 0x43, 0xc5, 0x8a, 0x63, 0x00, 0x00, 0x00, 0x0e, 0x35, 0x99 },
+	{ 0x34, 0x1b, 0x87, 0x7e, 0x00, 0xde, 0x40, 0xde, 0x86, 0x12, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x84 },
+	{ 0x0a, 0xaa, 0x63, 0xcc, 0x07, 0x8c, 0x47, 0x8c, 0x84, 0xd4, 0x00, 0x00, 0x00, 0x38, 0xf4, 0x90 },
+	{ 0xc2, 0x59, 0xe3, 0x42, 0x05, 0xe2, 0x45, 0xe2, 0x89, 0x2e, 0x00, 0x00, 0x00, 0x22, 0x9b, 0x84 },
+	{ 0x3a, 0x8a, 0x10, 0x2b, 0x02, 0x9b, 0x42, 0x9b, 0x82, 0x3d, 0x00, 0x00, 0x00, 0x06, 0xc9, 0xd9 },
+	{ 0xfe, 0x98, 0xde, 0xe2, 0x03, 0x82, 0x43, 0x82, 0x88, 0x8e, 0x00, 0x00, 0x00, 0x0c, 0x4e, 0x04 },
+	{ 0xda, 0x88, 0x9a, 0x7e, 0x03, 0xde, 0x43, 0xde, 0x8b, 0x12, 0x00, 0x00, 0x00, 0x0e, 0xf4, 0x84 },
+	{ 0xaa, 0xc6, 0xc0, 0xb4, 0x04, 0xf4, 0x44, 0xf4, 0x82, 0xac, 0x00, 0x00, 0x00, 0x18, 0x88, 0x90 },
+	{ 0xa6, 0xba, 0xdd, 0x57, 0x01, 0x87, 0x41, 0x87, 0x8a, 0xb1, 0x00, 0x00, 0x00, 0x02, 0x55, 0x31 },
+	{ 0x48, 0x9e, 0x4a, 0xe1, 0x00, 0x31, 0x40, 0x31, 0x81, 0x57, 0x00, 0x00, 0x00, 0x00, 0x09, 0x61 },
+	{ 0x63, 0x23, 0xfa, 0x05, 0x06, 0x95, 0x46, 0x95, 0x8e, 0x13, 0x00, 0x00, 0x00, 0x2b, 0x52, 0xb9 },
+	{ 0xe0, 0x49, 0x69, 0x50, 0x02, 0x50, 0x42, 0x50, 0x80, 0x30, 0x00, 0x00, 0x00, 0x05, 0x59, 0x00 },
+	{ 0xba, 0x06, 0x77, 0x5e, 0x06, 0xbe, 0x46, 0xbe, 0x8f, 0x32, 0x00, 0x00, 0x00, 0x2d, 0x75, 0x04 },
+	{ 0x29, 0x17, 0xab, 0xf3, 0x04, 0xe3, 0x44, 0xe3, 0x82, 0x35, 0x00, 0x00, 0x00, 0x17, 0xe1, 0x49 },
+	{ 0x24, 0x70, 0x33, 0xe8, 0x04, 0x68, 0x44, 0x68, 0x8e, 0xd8, 0x00, 0x00, 0x00, 0x13, 0x6a, 0x40 },
+	{ 0xa5, 0x83, 0xb3, 0xfb, 0x07, 0x6b, 0x47, 0x6b, 0x83, 0xed, 0x00, 0x00, 0x00, 0x37, 0x06, 0xb9 },
+	{ 0x01, 0xd9, 0x35, 0xcf, 0x07, 0x7f, 0x47, 0x7f, 0x84, 0x79, 0x00, 0x00, 0x00, 0x38, 0x31, 0x01 },
+	{ 0x97, 0x0f, 0x89, 0xc1, 0x05, 0x11, 0x45, 0x11, 0x83, 0x77, 0x00, 0x00, 0x00, 0x19, 0xab, 0x21 },
+	{ 0xac, 0x8d, 0xd1, 0x56, 0x06, 0x36, 0x46, 0x36, 0x8b, 0x7a, 0x00, 0x00, 0x00, 0x26, 0x93, 0x64 },
+	{ 0x75, 0x31, 0xf2, 0xeb, 0x01, 0x5b, 0x41, 0x5b, 0x89, 0x7d, 0x00, 0x00, 0x00, 0x01, 0xd6, 0x59 },
+	{ 0x34, 0xf9, 0x39, 0x1b, 0x06, 0x8b, 0x46, 0x8b, 0x8d, 0xcd, 0x00, 0x00, 0x00, 0x2a, 0xcf, 0x79 },
+	{ 0x40, 0xaa, 0xce, 0x81, 0x05, 0xd1, 0x45, 0xd1, 0x88, 0xb7, 0x00, 0x00, 0x00, 0x21, 0xd4, 0xa1 },
+	{ 0xa5, 0x05, 0xf1, 0xe2, 0x06, 0x82, 0x46, 0x82, 0x8d, 0x8e, 0x00, 0x00, 0x00, 0x2a, 0x5a, 0x04 },
+	{ 0x11, 0x66, 0xb6, 0xd0, 0x07, 0xd0, 0x47, 0xd0, 0x86, 0xb0, 0x00, 0x00, 0x00, 0x3d, 0x09, 0x00 },
+	{ 0xf0, 0x24, 0xb4, 0xa8, 0x01, 0x28, 0x41, 0x28, 0x88, 0x18, 0x00, 0x00, 0x00, 0x01, 0x56, 0x40 },
+	{ 0xcb, 0x96, 0xae, 0x2b, 0x00, 0x9b, 0x40, 0x9b, 0x84, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xd9 },
+	{ 0xfd, 0x31, 0xbd, 0xc4, 0x07, 0x04, 0x47, 0x04, 0x81, 0x1c, 0x00, 0x00, 0x00, 0x31, 0x38, 0x10 },
+	{ 0x5e, 0xca, 0x4c, 0x51, 0x04, 0xa1, 0x44, 0xa1, 0x80, 0x67, 0x00, 0x00, 0x00, 0x15, 0x6d, 0x41 },
+	{ 0x17, 0xa5, 0x47, 0xbb, 0x07, 0x2b, 0x47, 0x2b, 0x82, 0x2d, 0x00, 0x00, 0x00, 0x33, 0x61, 0x39 },
+	{ 0x8c, 0xf5, 0x0d, 0x3b, 0x04, 0xab, 0x44, 0xab, 0x80, 0xad, 0x00, 0x00, 0x00, 0x15, 0xca, 0x39 },
+	{ 0xba, 0xd2, 0x03, 0xce, 0x06, 0x2e, 0x46, 0x2e, 0x8b, 0x42, 0x00, 0x00, 0x00, 0x26, 0x30, 0x44 },
+	{ 0x37, 0x8b, 0xd6, 0x2d, 0x07, 0x3d, 0x47, 0x3d, 0x82, 0xab, 0x00, 0x00, 0x00, 0x34, 0x64, 0x89 },
+	{ 0x7f, 0x7c, 0x67, 0x33, 0x04, 0x23, 0x44, 0x23, 0x8c, 0xf5, 0x00, 0x00, 0x00, 0x11, 0x1c, 0xc9 },
+	{ 0x09, 0xfc, 0xa9, 0xf1, 0x04, 0x41, 0x44, 0x41, 0x8d, 0xc7, 0x00, 0x00, 0x00, 0x12, 0x18, 0x81 },
+	{ 0x00, 0x7d, 0xc2, 0x19, 0x00, 0xe9, 0x40, 0xe9, 0x86, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x11 },
+	{ 0x43, 0x8b, 0x35, 0xea, 0x05, 0x0a, 0x45, 0x0a, 0x83, 0x46, 0x00, 0x00, 0x00, 0x19, 0x64, 0x64 },
+	{ 0xea, 0xc3, 0xd5, 0x5a, 0x07, 0x7a, 0x47, 0x7a, 0x84, 0x56, 0x00, 0x00, 0x00, 0x37, 0xe6, 0x24 },
+	{ 0x57, 0x12, 0x75, 0x1b, 0x02, 0x8b, 0x42, 0x8b, 0x81, 0xcd, 0x00, 0x00, 0x00, 0x06, 0x77, 0x79 },
+	{ 0xdb, 0x36, 0x54, 0x59, 0x07, 0x29, 0x47, 0x29, 0x82, 0x1f, 0x00, 0x00, 0x00, 0x33, 0x44, 0x91 },
+	{ 0xa0, 0xca, 0x16, 0xc3, 0x00, 0xb3, 0x40, 0xb3, 0x84, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x29 },
+	{ 0x39, 0x8e, 0x8b, 0xf9, 0x00, 0xc9, 0x40, 0xc9, 0x85, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xd1 },
+	{ 0xd4, 0x7a, 0x01, 0x55, 0x06, 0xe5, 0x46, 0xe5, 0x80, 0x43, 0x00, 0x00, 0x00, 0x2f, 0x88, 0xd9 },
+	{ 0xe1, 0x14, 0xf5, 0xc0, 0x01, 0xc0, 0x41, 0xc0, 0x8c, 0x40, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00 },
+	{ 0x64, 0x6d, 0x48, 0x8e, 0x06, 0xee, 0x46, 0xee, 0x80, 0x82, 0x00, 0x00, 0x00, 0x30, 0x05, 0x44 },
+	{ 0xd7, 0xa8, 0x33, 0x15, 0x04, 0xa5, 0x44, 0xa5, 0x80, 0x83, 0x00, 0x00, 0x00, 0x15, 0x92, 0x59 },
+	{ 0x79, 0x8b, 0xa0, 0x9f, 0x03, 0x4f, 0x43, 0x4f, 0x87, 0x29, 0x00, 0x00, 0x00, 0x0a, 0xf2, 0x61 },
+	{ 0x87, 0x52, 0x10, 0xfe, 0x02, 0x5e, 0x42, 0x5e, 0x80, 0x92, 0x00, 0x00, 0x00, 0x05, 0x9a, 0x84 },
+	{ 0x3e, 0x65, 0xfb, 0xc6, 0x03, 0xa6, 0x43, 0xa6, 0x89, 0x8a, 0x00, 0x00, 0x00, 0x0d, 0x4f, 0xa4 },
+	{ 0x15, 0xfc, 0x09, 0xae, 0x02, 0x0e, 0x42, 0x0e, 0x8e, 0x62, 0x00, 0x00, 0x00, 0x04, 0x38, 0xc4 },
+	{ 0x22, 0x8b, 0x50, 0xb1, 0x07, 0x01, 0x47, 0x01, 0x81, 0x07, 0x00, 0x00, 0x00, 0x31, 0x0e, 0x01 },
+	{ 0x7f, 0x9a, 0x39, 0xc8, 0x00, 0x48, 0x40, 0x48, 0x81, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x40 },
+	{ 0xea, 0x63, 0xe5, 0xd6, 0x02, 0xb6, 0x42, 0xb6, 0x82, 0xfa, 0x00, 0x00, 0x00, 0x07, 0x59, 0x64 },
+	{ 0x46, 0xe9, 0x5f, 0x6c, 0x05, 0x2c, 0x45, 0x2c, 0x84, 0x34, 0x00, 0x00, 0x00, 0x1a, 0xbf, 0x90 },
+	{ 0xdf, 0x30, 0x12, 0x89, 0x04, 0x59, 0x44, 0x59, 0x8e, 0x6f, 0x00, 0x00, 0x00, 0x12, 0xe6, 0xf1 },
+	{ 0x2e, 0x3c, 0xe6, 0x17, 0x06, 0x47, 0x46, 0x47, 0x8b, 0xf1, 0x00, 0x00, 0x00, 0x27, 0x67, 0xb1 },
+	{ 0xbf, 0x49, 0x84, 0x17, 0x04, 0x47, 0x44, 0x47, 0x8d, 0xf1, 0x00, 0x00, 0x00, 0x12, 0x4b, 0xb1 },
+	{ 0xc1, 0x2e, 0x67, 0x4e, 0x01, 0xae, 0x41, 0xae, 0x8b, 0xc2, 0x00, 0x00, 0x00, 0x02, 0xd2, 0x44 },
+	{ 0x58, 0xbb, 0xb3, 0x28, 0x07, 0xa8, 0x47, 0xa8, 0x85, 0x98, 0x00, 0x00, 0x00, 0x3a, 0x9e, 0x40 },
+	{ 0x65, 0x26, 0xaf, 0xd1, 0x00, 0x21, 0x40, 0x21, 0x80, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x04, 0x41 },
+	{ 0xb8, 0xbd, 0x28, 0xd5, 0x06, 0x65, 0x46, 0x65, 0x8c, 0xc3, 0x00, 0x00, 0x00, 0x28, 0xe3, 0xd9 },
+	{ 0xe1, 0x44, 0xed, 0x82, 0x04, 0x22, 0x44, 0x22, 0x8c, 0xee, 0x00, 0x00, 0x00, 0x11, 0x14, 0x84 },
+	{ 0xb5, 0x11, 0x34, 0xfc, 0x07, 0xbc, 0x47, 0xbc, 0x86, 0x24, 0x00, 0x00, 0x00, 0x3b, 0xd2, 0x10 },
+	{ 0x66, 0x82, 0x23, 0x87, 0x06, 0xb7, 0x46, 0xb7, 0x8f, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x16, 0xd1 },
+	{ 0x2e, 0x5a, 0xb8, 0xac, 0x02, 0x6c, 0x42, 0x6c, 0x80, 0xf4, 0x00, 0x00, 0x00, 0x05, 0xdd, 0x90 },
+	{ 0x7b, 0xa0, 0x7b, 0x98, 0x03, 0x18, 0x43, 0x18, 0x85, 0xa8, 0x00, 0x00, 0x00, 0x09, 0x92, 0x40 },
+	{ 0xd2, 0x82, 0xf8, 0xf1, 0x03, 0x41, 0x43, 0x41, 0x86, 0xc7, 0x00, 0x00, 0x00, 0x0a, 0x96, 0x81 },
+	{ 0x46, 0x89, 0x6f, 0xe8, 0x00, 0x68, 0x40, 0x68, 0x82, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x40 },
+	{ 0x4e, 0xa1, 0x36, 0xa2, 0x07, 0x42, 0x47, 0x42, 0x82, 0xce, 0x00, 0x00, 0x00, 0x34, 0xad, 0x04 },
+	{ 0xf5, 0xf7, 0xa8, 0xa7, 0x05, 0xd7, 0x45, 0xd7, 0x88, 0xe1, 0x00, 0x00, 0x00, 0x22, 0x1a, 0x91 },
+	{ 0x6f, 0xd1, 0x13, 0x9d, 0x07, 0xad, 0x47, 0xad, 0x85, 0xbb, 0x00, 0x00, 0x00, 0x3a, 0xea, 0xe9 },
+	{ 0x68, 0x19, 0x3c, 0x67, 0x05, 0x97, 0x45, 0x97, 0x87, 0x21, 0x00, 0x00, 0x00, 0x1f, 0x3f, 0x11 },
+	{ 0x8c, 0xa7, 0x42, 0xe4, 0x06, 0x24, 0x46, 0x24, 0x8a, 0xfc, 0x00, 0x00, 0x00, 0x25, 0xb5, 0x10 },
+	{ 0x2c, 0x75, 0xd5, 0x75, 0x05, 0x05, 0x45, 0x05, 0x83, 0x23, 0x00, 0x00, 0x00, 0x19, 0x32, 0x19 },
+	{ 0x12, 0x50, 0x15, 0xd5, 0x03, 0x65, 0x43, 0x65, 0x87, 0xc3, 0x00, 0x00, 0x00, 0x0b, 0x85, 0xd9 },
+	{ 0x63, 0x8f, 0x96, 0xf1, 0x01, 0x41, 0x41, 0x41, 0x88, 0xc7, 0x00, 0x00, 0x00, 0x01, 0x92, 0x81 },
+	{ 0xa5, 0xd1, 0x7e, 0x52, 0x05, 0xf2, 0x45, 0xf2, 0x89, 0x9e, 0x00, 0x00, 0x00, 0x23, 0x58, 0xc4 },
+	{ 0x24, 0xed, 0xf6, 0x01, 0x05, 0x51, 0x45, 0x51, 0x85, 0x37, 0x00, 0x00, 0x00, 0x1c, 0x43, 0xa1 },
+	{ 0x47, 0xb4, 0xeb, 0xdc, 0x04, 0x9c, 0x44, 0x9c, 0x80, 0x44, 0x00, 0x00, 0x00, 0x15, 0x3f, 0x10 },
+	{ 0x18, 0x8e, 0xa6, 0xc0, 0x02, 0xc0, 0x42, 0xc0, 0x83, 0x40, 0x00, 0x00, 0x00, 0x07, 0x90, 0x00 },
+	{ 0xc5, 0x3a, 0x4a, 0xab, 0x05, 0x1b, 0x45, 0x1b, 0x83, 0xbd, 0x00, 0x00, 0x00, 0x1a, 0x10, 0xd9 },
+	{ 0x12, 0x32, 0x43, 0x40, 0x07, 0x40, 0x47, 0x40, 0x82, 0xc0, 0x00, 0x00, 0x00, 0x34, 0x90, 0x00 },
+	{ 0x9c, 0x04, 0xcc, 0x23, 0x04, 0x13, 0x44, 0x13, 0x8c, 0x85, 0x00, 0x00, 0x00, 0x10, 0x99, 0x69 },
+	{ 0x28, 0xc9, 0xe1, 0x9c, 0x06, 0x5c, 0x46, 0x5c, 0x8c, 0x84, 0x00, 0x00, 0x00, 0x28, 0x71, 0x10 },
+	{ 0x7c, 0x3c, 0x10, 0x46, 0x00, 0x26, 0x40, 0x26, 0x81, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x05, 0xa4 },
+	{ 0x47, 0xd2, 0xbe, 0x71, 0x00, 0xc1, 0x40, 0xc1, 0x85, 0x47, 0x00, 0x00, 0x00, 0x00, 0x91, 0x81 },
+	{ 0x02, 0x27, 0x00, 0x26, 0x06, 0x06, 0x46, 0x06, 0x8a, 0x2a, 0x00, 0x00, 0x00, 0x24, 0x48, 0x24 },
+	{ 0x9e, 0x97, 0x69, 0x35, 0x04, 0xc5, 0x44, 0xc5, 0x81, 0x63, 0x00, 0x00, 0x00, 0x16, 0xbf, 0x99 },
+	{ 0xa6, 0x1f, 0x48, 0xa9, 0x04, 0x79, 0x44, 0x79, 0x8f, 0x4f, 0x00, 0x00, 0x00, 0x14, 0x01, 0x31 },
+	{ 0xcd, 0x3f, 0xec, 0x38, 0x05, 0xb8, 0x45, 0xb8, 0x88, 0x08, 0x00, 0x00, 0x00, 0x20, 0xb4, 0x40 },
+	{ 0xe1, 0xc2, 0xaf, 0x9b, 0x05, 0x0b, 0x45, 0x0b, 0x83, 0x4d, 0x00, 0x00, 0x00, 0x19, 0x6e, 0x79 },
+	{ 0x82, 0x5c, 0xce, 0x9c, 0x03, 0x5c, 0x43, 0x5c, 0x87, 0x84, 0x00, 0x00, 0x00, 0x0b, 0x49, 0x10 },
+	{ 0x1e, 0x61, 0x9a, 0xbf, 0x07, 0x6f, 0x47, 0x6f, 0x84, 0x09, 0x00, 0x00, 0x00, 0x37, 0x42, 0x21 },
+	{ 0x6c, 0x72, 0xea, 0x1b, 0x07, 0x8b, 0x47, 0x8b, 0x84, 0xcd, 0x00, 0x00, 0x00, 0x38, 0xe5, 0x79 },
+	{ 0x40, 0xc8, 0xa1, 0x16, 0x01, 0xf6, 0x41, 0xf6, 0x8d, 0xba, 0x00, 0x00, 0x00, 0x03, 0xd8, 0x64 },
+	{ 0x90, 0x05, 0x6c, 0x66, 0x06, 0x46, 0x46, 0x46, 0x8b, 0xea, 0x00, 0x00, 0x00, 0x27, 0x5b, 0x24 },
+	{ 0x6e, 0x27, 0xd5, 0x90, 0x02, 0x90, 0x42, 0x90, 0x81, 0xf0, 0x00, 0x00, 0x00, 0x06, 0x91, 0x00 },
+	{ 0xb8, 0xda, 0xfb, 0x6a, 0x02, 0x8a, 0x42, 0x8a, 0x81, 0xc6, 0x00, 0x00, 0x00, 0x06, 0x72, 0x64 },
+	{ 0xfb, 0x6a, 0xad, 0x22, 0x05, 0xc2, 0x45, 0xc2, 0x88, 0x4e, 0x00, 0x00, 0x00, 0x21, 0x27, 0x04 },
+	{ 0xc1, 0xac, 0x29, 0x67, 0x02, 0x97, 0x42, 0x97, 0x82, 0x21, 0x00, 0x00, 0x00, 0x06, 0xb5, 0x11 },
+	{ 0x73, 0x2f, 0x3d, 0x1f, 0x07, 0xcf, 0x47, 0xcf, 0x86, 0xa9, 0x00, 0x00, 0x00, 0x3c, 0xf9, 0x61 },
+	{ 0x97, 0x3f, 0x81, 0x83, 0x07, 0x73, 0x47, 0x73, 0x84, 0x25, 0x00, 0x00, 0x00, 0x37, 0x7d, 0xa9 },
+	{ 0xcf, 0xd2, 0x89, 0x4a, 0x06, 0x6a, 0x46, 0x6a, 0x8c, 0xe6, 0x00, 0x00, 0x00, 0x29, 0x23, 0xe4 },
+	{ 0x74, 0xe4, 0x28, 0x94, 0x02, 0xd4, 0x42, 0xd4, 0x83, 0xcc, 0x00, 0x00, 0x00, 0x07, 0xff, 0x90 },
+	{ 0x1a, 0xf1, 0x4c, 0x10, 0x01, 0x10, 0x41, 0x10, 0x87, 0x70, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00 },
+	{ 0x72, 0x03, 0xc1, 0x2b, 0x03, 0x9b, 0x43, 0x9b, 0x89, 0x3d, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xd9 },
+	{ 0x2b, 0x7a, 0x51, 0x43, 0x03, 0x33, 0x43, 0x33, 0x86, 0x65, 0x00, 0x00, 0x00, 0x0a, 0x3c, 0x29 },
+	{ 0xa6, 0xea, 0xd5, 0x19, 0x03, 0xe9, 0x43, 0xe9, 0x8b, 0x5f, 0x00, 0x00, 0x00, 0x0f, 0x4a, 0x11 },
+	{ 0xf3, 0x95, 0x03, 0x57, 0x07, 0x87, 0x47, 0x87, 0x84, 0xb1, 0x00, 0x00, 0x00, 0x38, 0xa9, 0x31 },
+	{ 0x78, 0x42, 0x52, 0x16, 0x02, 0xf6, 0x42, 0xf6, 0x84, 0xba, 0x00, 0x00, 0x00, 0x08, 0xc4, 0x64 },
+	{ 0x2c, 0xa5, 0xcd, 0x37, 0x07, 0x67, 0x47, 0x67, 0x83, 0xd1, 0x00, 0x00, 0x00, 0x36, 0xcb, 0x71 },
+	{ 0x6b, 0x29, 0x9b, 0x92, 0x07, 0x32, 0x47, 0x32, 0x82, 0x5e, 0x00, 0x00, 0x00, 0x33, 0xc5, 0xc4 },
+	{ 0x2f, 0xa4, 0x07, 0x35, 0x02, 0xc5, 0x42, 0xc5, 0x83, 0x63, 0x00, 0x00, 0x00, 0x07, 0xab, 0x99 },
+	{ 0x50, 0x08, 0x57, 0xc0, 0x03, 0xc0, 0x43, 0xc0, 0x8a, 0x40, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x00 },
+	{ 0x33, 0x62, 0x20, 0x3b, 0x07, 0xab, 0x47, 0xab, 0x85, 0xad, 0x00, 0x00, 0x00, 0x3a, 0xcc, 0x39 },
+	{ 0xba, 0x72, 0x14, 0x4a, 0x01, 0x6a, 0x41, 0x6a, 0x89, 0xe6, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe4 },
+	{ 0x20, 0x16, 0x86, 0x34, 0x02, 0x74, 0x42, 0x74, 0x81, 0x2c, 0x00, 0x00, 0x00, 0x06, 0x04, 0x90 },
+	{ 0x6d, 0xf7, 0xdd, 0xce, 0x00, 0x2e, 0x40, 0x2e, 0x81, 0x42, 0x00, 0x00, 0x00, 0x00, 0x08, 0x44 },
+	{ 0xf3, 0x65, 0x0b, 0x95, 0x05, 0x25, 0x45, 0x25, 0x84, 0x03, 0x00, 0x00, 0x00, 0x1a, 0x77, 0x59 },
+	{ 0x99, 0x24, 0x64, 0xba, 0x04, 0xda, 0x44, 0xda, 0x81, 0xf6, 0x00, 0x00, 0x00, 0x17, 0x89, 0xa4 },
+	{ 0xad, 0x77, 0x30, 0x5b, 0x01, 0xcb, 0x41, 0xcb, 0x8c, 0x8d, 0x00, 0x00, 0x00, 0x03, 0x36, 0xf9 },
+	{ 0xc0, 0x45, 0x08, 0x49, 0x06, 0x19, 0x46, 0x19, 0x8a, 0xaf, 0x00, 0x00, 0x00, 0x25, 0x2e, 0x71 },
+	{ 0x78, 0xdd, 0xe6, 0xc4, 0x00, 0x04, 0x40, 0x04, 0x80, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10 },
+	{ 0xd5, 0x93, 0x58, 0x1c, 0x04, 0xdc, 0x44, 0xdc, 0x82, 0x04, 0x00, 0x00, 0x00, 0x17, 0x9d, 0x10 },
+	{ 0x45, 0xed, 0xdb, 0x3a, 0x03, 0x5a, 0x43, 0x5a, 0x87, 0x76, 0x00, 0x00, 0x00, 0x0b, 0x3b, 0xa4 },
+	{ 0xc8, 0xc8, 0x6b, 0xef, 0x07, 0x9f, 0x47, 0x9f, 0x85, 0x59, 0x00, 0x00, 0x00, 0x3a, 0x14, 0xc1 },
+	{ 0xea, 0xb1, 0xb0, 0x2d, 0x01, 0x3d, 0x41, 0x3d, 0x88, 0xab, 0x00, 0x00, 0x00, 0x01, 0x88, 0x89 },
+	{ 0x7d, 0x97, 0x83, 0xfc, 0x06, 0xbc, 0x46, 0xbc, 0x8f, 0x24, 0x00, 0x00, 0x00, 0x2d, 0x5a, 0x10 },
+	{ 0xd4, 0x97, 0xd3, 0xea, 0x03, 0x0a, 0x43, 0x0a, 0x85, 0x46, 0x00, 0x00, 0x00, 0x09, 0x3c, 0x64 },
+	{ 0xcb, 0xc6, 0xa5, 0xed, 0x02, 0xfd, 0x42, 0xfd, 0x84, 0xeb, 0x00, 0x00, 0x00, 0x08, 0xee, 0x09 },
+	{ 0xb8, 0xab, 0x03, 0xa8, 0x00, 0x28, 0x40, 0x28, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40 },
+	{ 0x39, 0xbe, 0x83, 0xbb, 0x03, 0x2b, 0x43, 0x2b, 0x86, 0x2d, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x39 },
+	{ 0x2d, 0x11, 0x6a, 0x23, 0x02, 0x13, 0x42, 0x13, 0x8e, 0x85, 0x00, 0x00, 0x00, 0x04, 0x4d, 0x69 },
+	{ 0x91, 0xea, 0x4f, 0x9d, 0x03, 0xad, 0x43, 0xad, 0x89, 0xbb, 0x00, 0x00, 0x00, 0x0d, 0x82, 0xe9 },
+	{ 0x23, 0xc2, 0x7a, 0x0d, 0x01, 0x1d, 0x41, 0x1d, 0x87, 0xcb, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x49 },
+	{ 0x72, 0xff, 0x45, 0x5d, 0x05, 0x6d, 0x45, 0x6d, 0x85, 0xfb, 0x00, 0x00, 0x00, 0x1d, 0x70, 0x69 },
+	{ 0xf6, 0xf3, 0x2c, 0xd9, 0x07, 0xa9, 0x47, 0xa9, 0x85, 0x9f, 0x00, 0x00, 0x00, 0x3a, 0xad, 0x91 },
+	{ 0xe6, 0xd5, 0xc4, 0x92, 0x00, 0x32, 0x40, 0x32, 0x81, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc4 },
+	{ 0x4d, 0xa5, 0xb2, 0x70, 0x05, 0x70, 0x45, 0x70, 0x86, 0x10, 0x00, 0x00, 0x00, 0x1d, 0x91, 0x00 },
+	{ 0x4d, 0xc3, 0x85, 0x05, 0x01, 0x95, 0x41, 0x95, 0x8b, 0x13, 0x00, 0x00, 0x00, 0x02, 0x80, 0xb9 },
+	{ 0xf8, 0x0c, 0x83, 0xa0, 0x05, 0xa0, 0x45, 0xa0, 0x87, 0x60, 0x00, 0x00, 0x00, 0x1f, 0xa4, 0x00 },
+	{ 0x8e, 0x0e, 0x64, 0x02, 0x02, 0xa2, 0x42, 0xa2, 0x82, 0x6e, 0x00, 0x00, 0x00, 0x06, 0xee, 0x84 },
+	{ 0xca, 0xdd, 0x46, 0xe8, 0x07, 0x68, 0x47, 0x68, 0x83, 0xd8, 0x00, 0x00, 0x00, 0x36, 0xda, 0x40 },
+	{ 0xc3, 0xc1, 0x04, 0x60, 0x02, 0x60, 0x42, 0x60, 0x80, 0xa0, 0x00, 0x00, 0x00, 0x05, 0xa4, 0x00 },
+	{ 0x8f, 0xf3, 0x47, 0x39, 0x00, 0x09, 0x40, 0x09, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51 },
+	{ 0xd6, 0x5e, 0xe4, 0x8c, 0x04, 0x4c, 0x44, 0x4c, 0x8e, 0x14, 0x00, 0x00, 0x00, 0x12, 0x76, 0x90 },
+	{ 0x44, 0x74, 0x94, 0xef, 0x00, 0x9f, 0x40, 0x9f, 0x84, 0x59, 0x00, 0x00, 0x00, 0x00, 0x62, 0xc1 },
+	{ 0x18, 0xdc, 0x71, 0x17, 0x01, 0x47, 0x41, 0x47, 0x88, 0xf1, 0x00, 0x00, 0x00, 0x01, 0xa1, 0xb1 },
+	{ 0xa3, 0x6e, 0xd9, 0x02, 0x07, 0xa2, 0x47, 0xa2, 0x85, 0x6e, 0x00, 0x00, 0x00, 0x3a, 0x42, 0x84 },
+	{ 0xa8, 0xcf, 0xb8, 0x50, 0x01, 0x50, 0x41, 0x50, 0x89, 0x30, 0x00, 0x00, 0x00, 0x01, 0xb9, 0x00 },
+	{ 0x63, 0xef, 0x86, 0x75, 0x06, 0x05, 0x46, 0x05, 0x8a, 0x23, 0x00, 0x00, 0x00, 0x24, 0x3c, 0x19 },
+	{ 0x5d, 0x51, 0x06, 0x06, 0x01, 0xe6, 0x41, 0xe6, 0x8d, 0x4a, 0x00, 0x00, 0x00, 0x03, 0x9a, 0xa4 },
+	{ 0x8f, 0x09, 0xe8, 0x34, 0x04, 0x74, 0x44, 0x74, 0x8f, 0x2c, 0x00, 0x00, 0x00, 0x13, 0xd4, 0x90 },
+	{ 0xec, 0xf6, 0x82, 0xe8, 0x03, 0x68, 0x43, 0x68, 0x87, 0xd8, 0x00, 0x00, 0x00, 0x0b, 0x9a, 0x40 },
+	{ 0x78, 0x90, 0x1c, 0x6d, 0x01, 0x7d, 0x41, 0x7d, 0x8a, 0x6b, 0x00, 0x00, 0x00, 0x02, 0x37, 0x09 },
+	{ 0x71, 0xd3, 0xc9, 0x69, 0x01, 0x39, 0x41, 0x39, 0x88, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x7e, 0xb1 },
+	{ 0x93, 0x81, 0x68, 0x7d, 0x02, 0x8d, 0x42, 0x8d, 0x81, 0xdb, 0x00, 0x00, 0x00, 0x06, 0x81, 0xa9 },
+	{ 0x8c, 0x29, 0x80, 0xcb, 0x05, 0x3b, 0x45, 0x3b, 0x84, 0x9d, 0x00, 0x00, 0x00, 0x1b, 0x5b, 0x99 },
+	{ 0x67, 0x6b, 0x82, 0x8c, 0x02, 0x4c, 0x42, 0x4c, 0x80, 0x14, 0x00, 0x00, 0x00, 0x05, 0x46, 0x90 },
+	{ 0x3e, 0x36, 0x04, 0x04, 0x01, 0x44, 0x41, 0x44, 0x88, 0xdc, 0x00, 0x00, 0x00, 0x01, 0x9a, 0x10 },
+	{ 0x83, 0x76, 0x25, 0x63, 0x01, 0x53, 0x41, 0x53, 0x89, 0x45, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xe9 },
+	{ 0xdf, 0xad, 0xd4, 0xa2, 0x05, 0x42, 0x45, 0x42, 0x84, 0xce, 0x00, 0x00, 0x00, 0x1b, 0xa5, 0x04 },
+	{ 0xc8, 0xb6, 0x46, 0xc2, 0x01, 0x62, 0x41, 0x62, 0x89, 0xae, 0x00, 0x00, 0x00, 0x01, 0xe9, 0x84 },
+	{ 0xfa, 0x21, 0x5e, 0x99, 0x05, 0x69, 0x45, 0x69, 0x85, 0xdf, 0x00, 0x00, 0x00, 0x1d, 0x45, 0x11 },
+	{ 0x7a, 0xd4, 0xef, 0x28, 0x03, 0xa8, 0x43, 0xa8, 0x89, 0x98, 0x00, 0x00, 0x00, 0x0d, 0x5e, 0x40 },
+	{ 0xf3, 0x82, 0xde, 0x2a, 0x01, 0x4a, 0x41, 0x4a, 0x89, 0x06, 0x00, 0x00, 0x00, 0x01, 0xa9, 0x64 },
+	{ 0x13, 0x4b, 0x9a, 0x07, 0x05, 0x37, 0x45, 0x37, 0x84, 0x81, 0x00, 0x00, 0x00, 0x1b, 0x31, 0xd1 },
+	{ 0x08, 0x05, 0xa1, 0x8d, 0x00, 0x9d, 0x40, 0x9d, 0x84, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x60, 0x49 },
+	{ 0xd8, 0xa3, 0xb7, 0x47, 0x06, 0x77, 0x46, 0x77, 0x8d, 0x41, 0x00, 0x00, 0x00, 0x29, 0xcb, 0x51 },
+	{ 0xa8, 0xe1, 0xdd, 0x7d, 0x07, 0x8d, 0x47, 0x8d, 0x84, 0xdb, 0x00, 0x00, 0x00, 0x39, 0x03, 0xa9 },
+	{ 0xc2, 0xa7, 0xad, 0x99, 0x04, 0x69, 0x44, 0x69, 0x8e, 0xdf, 0x00, 0x00, 0x00, 0x13, 0x73, 0x11 },
+	{ 0x88, 0xcb, 0x57, 0x49, 0x05, 0x19, 0x45, 0x19, 0x83, 0xaf, 0x00, 0x00, 0x00, 0x19, 0xfc, 0x71 },
+	{ 0xfd, 0x01, 0xc6, 0x02, 0x04, 0xa2, 0x44, 0xa2, 0x80, 0x6e, 0x00, 0x00, 0x00, 0x15, 0x76, 0x84 },
+	{ 0x66, 0x22, 0x34, 0x03, 0x01, 0xf3, 0x41, 0xf3, 0x8d, 0xa5, 0x00, 0x00, 0x00, 0x03, 0xcc, 0xa9 },
+	{ 0xd3, 0x9c, 0x4f, 0xb8, 0x01, 0x38, 0x41, 0x38, 0x88, 0x88, 0x00, 0x00, 0x00, 0x01, 0x7c, 0x40 },
+	{ 0xeb, 0x11, 0x9f, 0xb1, 0x06, 0x01, 0x46, 0x01, 0x8a, 0x07, 0x00, 0x00, 0x00, 0x24, 0x0c, 0x01 },
+	{ 0xee, 0x0f, 0xd9, 0xaf, 0x01, 0x5f, 0x41, 0x5f, 0x89, 0x99, 0x00, 0x00, 0x00, 0x01, 0xe1, 0x41 },
+	{ 0x2a, 0x31, 0x02, 0xba, 0x02, 0xda, 0x42, 0xda, 0x83, 0xf6, 0x00, 0x00, 0x00, 0x08, 0x21, 0xa4 },
+	{ 0x48, 0x32, 0xad, 0xf5, 0x05, 0x85, 0x45, 0x85, 0x86, 0xa3, 0x00, 0x00, 0x00, 0x1e, 0x77, 0x19 },
+	{ 0xbc, 0x1b, 0x52, 0x57, 0x06, 0x87, 0x46, 0x87, 0x8d, 0xb1, 0x00, 0x00, 0x00, 0x2a, 0x9b, 0x31 },
+	{ 0x93, 0x51, 0x70, 0xbb, 0x00, 0x2b, 0x40, 0x2b, 0x81, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x39 },
+	{ 0xaf, 0xbc, 0x03, 0x16, 0x03, 0xf6, 0x43, 0xf6, 0x8b, 0xba, 0x00, 0x00, 0x00, 0x0f, 0xb0, 0x64 },
+	{ 0xc6, 0x05, 0xd7, 0x1b, 0x04, 0x8b, 0x44, 0x8b, 0x8f, 0xcd, 0x00, 0x00, 0x00, 0x14, 0xa3, 0x79 },
+	{ 0x66, 0x52, 0x2b, 0xc5, 0x04, 0x55, 0x44, 0x55, 0x8e, 0x53, 0x00, 0x00, 0x00, 0x12, 0xc4, 0x39 },
+	{ 0x61, 0x7a, 0xbb, 0xf8, 0x01, 0x78, 0x41, 0x78, 0x8a, 0x48, 0x00, 0x00, 0x00, 0x02, 0x28, 0x40 },
+	{ 0x40, 0x4a, 0xde, 0xfd, 0x01, 0x0d, 0x41, 0x0d, 0x87, 0x5b, 0x00, 0x00, 0x00, 0x01, 0x1a, 0xa9 },
+	{ 0x95, 0x48, 0x79, 0x1f, 0x03, 0xcf, 0x43, 0xcf, 0x8a, 0xa9, 0x00, 0x00, 0x00, 0x0e, 0x81, 0x61 },
+	{ 0xca, 0x7d, 0x57, 0x64, 0x02, 0xa4, 0x42, 0xa4, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x06, 0xf9, 0x10 },
+	{ 0x5f, 0x65, 0xe0, 0xff, 0x01, 0xaf, 0x41, 0xaf, 0x8b, 0xc9, 0x00, 0x00, 0x00, 0x02, 0xd5, 0xa1 },
+	{ 0xf4, 0x00, 0xa0, 0x43, 0x02, 0x33, 0x42, 0x33, 0x8f, 0x65, 0x00, 0x00, 0x00, 0x04, 0xd6, 0x29 },
+	{ 0x16, 0xd9, 0xbb, 0x4b, 0x07, 0xbb, 0x47, 0xbb, 0x86, 0x1d, 0x00, 0x00, 0x00, 0x3b, 0xc2, 0x99 },
+	{ 0xe7, 0xd1, 0x48, 0xc4, 0x02, 0x04, 0x42, 0x04, 0x8e, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x10, 0x10 },
+	{ 0x41, 0xc4, 0x25, 0x48, 0x03, 0xc8, 0x43, 0xc8, 0x8a, 0x78, 0x00, 0x00, 0x00, 0x0e, 0x4c, 0x40 },
+	{ 0xab, 0xe0, 0x17, 0x7b, 0x02, 0xeb, 0x42, 0xeb, 0x84, 0x6d, 0x00, 0x00, 0x00, 0x08, 0x83, 0xb9 },
+	{ 0x84, 0xef, 0x6b, 0xae, 0x04, 0x0e, 0x44, 0x0e, 0x8c, 0x62, 0x00, 0x00, 0x00, 0x10, 0x70, 0xc4 },
+	{ 0x9f, 0x15, 0x2b, 0x4e, 0x05, 0xae, 0x45, 0xae, 0x87, 0xc2, 0x00, 0x00, 0x00, 0x20, 0x42, 0x44 },
+	{ 0xa7, 0x08, 0xa7, 0xae, 0x00, 0x0e, 0x40, 0x0e, 0x80, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4 },
+	{ 0xcf, 0xa2, 0x91, 0x88, 0x04, 0x08, 0x44, 0x08, 0x8c, 0x38, 0x00, 0x00, 0x00, 0x10, 0x40, 0x40 },
+	{ 0x53, 0x36, 0x89, 0x80, 0x01, 0x80, 0x41, 0x80, 0x8a, 0x80, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00 },
+	{ 0x3d, 0x1c, 0xad, 0x3d, 0x03, 0x4d, 0x43, 0x4d, 0x87, 0x1b, 0x00, 0x00, 0x00, 0x0a, 0xe5, 0x29 },
+	{ 0x35, 0x76, 0xfb, 0x34, 0x07, 0x74, 0x47, 0x74, 0x84, 0x2c, 0x00, 0x00, 0x00, 0x37, 0x8c, 0x90 },
+	{ 0x68, 0x37, 0x0e, 0xfc, 0x01, 0xbc, 0x41, 0xbc, 0x8c, 0x24, 0x00, 0x00, 0x00, 0x03, 0x02, 0x10 },
+	{ 0x0c, 0x2f, 0x57, 0x7f, 0x00, 0x2f, 0x40, 0x2f, 0x81, 0x49, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa1 },
+	{ 0x74, 0xc6, 0x55, 0xff, 0x06, 0xaf, 0x46, 0xaf, 0x8e, 0xc9, 0x00, 0x00, 0x00, 0x2c, 0xab, 0xa1 },
+	{ 0xfb, 0xd6, 0x4a, 0x0e, 0x00, 0x6e, 0x40, 0x6e, 0x83, 0x02, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x44 },
+	{ 0x02, 0xa4, 0xc2, 0x3f, 0x06, 0xef, 0x46, 0xef, 0x80, 0x89, 0x00, 0x00, 0x00, 0x30, 0x13, 0x21 },
+	{ 0xd0, 0x3e, 0x26, 0x36, 0x01, 0x16, 0x41, 0x16, 0x87, 0x9a, 0x00, 0x00, 0x00, 0x01, 0x2d, 0xe4 },
+	{ 0x00, 0xdd, 0xb1, 0x9d, 0x05, 0xad, 0x45, 0xad, 0x87, 0xbb, 0x00, 0x00, 0x00, 0x20, 0x36, 0xe9 },
+	{ 0x6c, 0xc0, 0xb4, 0x72, 0x06, 0x12, 0x46, 0x12, 0x8a, 0x7e, 0x00, 0x00, 0x00, 0x24, 0xd9, 0x44 },
+	{ 0x29, 0xb3, 0x40, 0xa1, 0x01, 0xf1, 0x41, 0xf1, 0x8d, 0x97, 0x00, 0x00, 0x00, 0x03, 0xc4, 0xe1 },
+	{ 0xaa, 0x48, 0xfe, 0x9b, 0x04, 0x0b, 0x44, 0x0b, 0x8c, 0x4d, 0x00, 0x00, 0x00, 0x10, 0x58, 0x79 },
+	{ 0x62, 0x28, 0x75, 0xd3, 0x04, 0xc3, 0x44, 0xc3, 0x81, 0x55, 0x00, 0x00, 0x00, 0x16, 0xac, 0x89 },
+	{ 0x45, 0xa0, 0x10, 0xe3, 0x04, 0xd3, 0x44, 0xd3, 0x81, 0xc5, 0x00, 0x00, 0x00, 0x17, 0x45, 0xe9 },
+	{ 0x9b, 0x09, 0x47, 0xf1, 0x02, 0x41, 0x42, 0x41, 0x8f, 0xc7, 0x00, 0x00, 0x00, 0x05, 0x14, 0x81 },
+	{ 0x54, 0x7f, 0xd8, 0x09, 0x01, 0xd9, 0x41, 0xd9, 0x8c, 0xef, 0x00, 0x00, 0x00, 0x03, 0x69, 0xf1 },
+	{ 0x8f, 0x39, 0xdf, 0xf6, 0x06, 0xd6, 0x46, 0xd6, 0x8f, 0xda, 0x00, 0x00, 0x00, 0x2e, 0xba, 0xe4 },
+	{ 0x50, 0x56, 0x22, 0x17, 0x02, 0x47, 0x42, 0x47, 0x8f, 0xf1, 0x00, 0x00, 0x00, 0x05, 0x2f, 0xb1 },
+	{ 0xb8, 0x3f, 0x66, 0xbc, 0x05, 0x7c, 0x45, 0x7c, 0x86, 0x64, 0x00, 0x00, 0x00, 0x1e, 0x14, 0x10 },
+	{ 0xc4, 0x0e, 0xce, 0xb7, 0x00, 0xe7, 0x40, 0xe7, 0x86, 0x51, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x71 },
+	{ 0x51, 0x81, 0x9e, 0x0b, 0x06, 0x7b, 0x46, 0x7b, 0x8d, 0x5d, 0x00, 0x00, 0x00, 0x29, 0xff, 0x19 },
+	{ 0xdc, 0x01, 0xe0, 0xc9, 0x06, 0x99, 0x46, 0x99, 0x8e, 0x2f, 0x00, 0x00, 0x00, 0x2b, 0x87, 0x71 },
+	{ 0x8b, 0x7b, 0xc6, 0xf0, 0x01, 0xf0, 0x41, 0xf0, 0x8d, 0x90, 0x00, 0x00, 0x00, 0x03, 0xc1, 0x00 },
+	{ 0x26, 0x55, 0x17, 0x1f, 0x01, 0xcf, 0x41, 0xcf, 0x8c, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x45, 0x61 },
+	{ 0x53, 0x96, 0x79, 0x04, 0x06, 0x44, 0x46, 0x44, 0x8b, 0xdc, 0x00, 0x00, 0x00, 0x27, 0x42, 0x10 },
+	{ 0x44, 0xf2, 0x57, 0x08, 0x01, 0x88, 0x41, 0x88, 0x8a, 0xb8, 0x00, 0x00, 0x00, 0x02, 0x58, 0x40 },
+	{ 0x39, 0x22, 0xef, 0x0d, 0x06, 0x1d, 0x46, 0x1d, 0x8a, 0xcb, 0x00, 0x00, 0x00, 0x25, 0x5f, 0x49 },
+	{ 0x83, 0x88, 0x4a, 0x90, 0x07, 0x90, 0x47, 0x90, 0x84, 0xf0, 0x00, 0x00, 0x00, 0x39, 0x31, 0x00 },
+	{ 0x2f, 0xd3, 0xfe, 0xf7, 0x05, 0x27, 0x45, 0x27, 0x84, 0x11, 0x00, 0x00, 0x00, 0x1a, 0x8b, 0xf1 },
+	{ 0xaf, 0x20, 0x6e, 0x68, 0x06, 0xe8, 0x46, 0xe8, 0x80, 0x58, 0x00, 0x00, 0x00, 0x2f, 0xb2, 0x40 },
+	{ 0x46, 0x1d, 0xd2, 0xfc, 0x05, 0xbc, 0x45, 0xbc, 0x88, 0x24, 0x00, 0x00, 0x00, 0x20, 0xe2, 0x10 },
+	{ 0x9d, 0xe9, 0xaf, 0x5a, 0x01, 0x7a, 0x41, 0x7a, 0x8a, 0x56, 0x00, 0x00, 0x00, 0x02, 0x2e, 0x24 },
+	{ 0x93, 0x63, 0x95, 0xe8, 0x06, 0x68, 0x46, 0x68, 0x8c, 0xd8, 0x00, 0x00, 0x00, 0x29, 0x0a, 0x40 },
+	{ 0x9a, 0x0d, 0xc3, 0xbf, 0x00, 0x6f, 0x40, 0x6f, 0x83, 0x09, 0x00, 0x00, 0x00, 0x00, 0x30, 0x21 },
+	{ 0xcf, 0xc0, 0x64, 0x1d, 0x00, 0x2d, 0x40, 0x2d, 0x81, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe9 },
+	{ 0xd1, 0x1b, 0xd7, 0xd3, 0x06, 0xc3, 0x46, 0xc3, 0x8f, 0x55, 0x00, 0x00, 0x00, 0x2d, 0xb8, 0x89 },
+	{ 0xef, 0xa6, 0xf2, 0x8f, 0x00, 0x3f, 0x40, 0x3f, 0x81, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x81 },
+	{ 0xb7, 0xc1, 0xa4, 0xa3, 0x04, 0x93, 0x44, 0x93, 0x80, 0x05, 0x00, 0x00, 0x00, 0x14, 0xec, 0x69 },
+	{ 0x8d, 0x25, 0x04, 0xfd, 0x07, 0x0d, 0x47, 0x0d, 0x81, 0x5b, 0x00, 0x00, 0x00, 0x31, 0xb6, 0xa9 },
+	{ 0x3f, 0xcd, 0x1c, 0xe4, 0x00, 0x24, 0x40, 0x24, 0x80, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10 },
+	{ 0xa0, 0x10, 0xaf, 0x80, 0x07, 0x80, 0x47, 0x80, 0x84, 0x80, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00 },
+	{ 0x6c, 0xde, 0x87, 0x07, 0x02, 0x37, 0x42, 0x37, 0x8f, 0x81, 0x00, 0x00, 0x00, 0x04, 0xe7, 0xd1 },
+	{ 0x62, 0xc4, 0x0a, 0x81, 0x01, 0xd1, 0x41, 0xd1, 0x8c, 0xb7, 0x00, 0x00, 0x00, 0x03, 0x4c, 0xa1 },
+	{ 0x26, 0x07, 0x4c, 0xc8, 0x03, 0x48, 0x43, 0x48, 0x86, 0xf8, 0x00, 0x00, 0x00, 0x0a, 0xc4, 0x40 },
+	{ 0xab, 0xc2, 0x44, 0xe6, 0x06, 0xc6, 0x46, 0xc6, 0x8f, 0x6a, 0x00, 0x00, 0x00, 0x2d, 0xe1, 0x24 },
+	{ 0x6a, 0x4b, 0xe9, 0xf5, 0x01, 0x85, 0x41, 0x85, 0x8a, 0xa3, 0x00, 0x00, 0x00, 0x02, 0x4f, 0x19 },
+	{ 0x55, 0x4b, 0x64, 0x79, 0x01, 0x49, 0x41, 0x49, 0x88, 0xff, 0x00, 0x00, 0x00, 0x01, 0xa6, 0xd1 },
+	{ 0xb0, 0xd5, 0x59, 0xdd, 0x01, 0xed, 0x41, 0xed, 0x8d, 0x7b, 0x00, 0x00, 0x00, 0x03, 0xb5, 0x69 },
+	{ 0xf1, 0xeb, 0xc5, 0x4a, 0x02, 0x6a, 0x42, 0x6a, 0x80, 0xe6, 0x00, 0x00, 0x00, 0x05, 0xd3, 0xe4 },
+	{ 0x68, 0xe4, 0xc8, 0xd7, 0x05, 0x07, 0x45, 0x07, 0x83, 0x31, 0x00, 0x00, 0x00, 0x19, 0x46, 0x31 },
+	{ 0x40, 0x7a, 0xd6, 0xbf, 0x03, 0x6f, 0x43, 0x6f, 0x88, 0x09, 0x00, 0x00, 0x00, 0x0b, 0xca, 0x21 },
+	{ 0x2b, 0xaa, 0x49, 0x05, 0x05, 0x95, 0x45, 0x95, 0x87, 0x13, 0x00, 0x00, 0x00, 0x1f, 0x28, 0xb9 },
+	{ 0x8a, 0x14, 0xa5, 0xd2, 0x05, 0x72, 0x45, 0x72, 0x86, 0x1e, 0x00, 0x00, 0x00, 0x1d, 0xa6, 0xc4 },
+	{ 0xbf, 0x19, 0x8c, 0x55, 0x01, 0xe5, 0x41, 0xe5, 0x8d, 0x43, 0x00, 0x00, 0x00, 0x03, 0x96, 0xd9 },
+	{ 0x4c, 0xf7, 0xf8, 0x95, 0x02, 0x25, 0x42, 0x25, 0x8f, 0x03, 0x00, 0x00, 0x00, 0x04, 0x99, 0x59 },
+	{ 0x6f, 0xbe, 0xee, 0x70, 0x01, 0x70, 0x41, 0x70, 0x8a, 0x10, 0x00, 0x00, 0x00, 0x02, 0x11, 0x00 },
+	{ 0x40, 0xf8, 0x98, 0xd8, 0x04, 0x58, 0x44, 0x58, 0x8e, 0x68, 0x00, 0x00, 0x00, 0x12, 0xde, 0x40 },
+	{ 0xb9, 0x28, 0xc5, 0xc1, 0x01, 0x11, 0x41, 0x11, 0x87, 0x77, 0x00, 0x00, 0x00, 0x01, 0x23, 0x21 },
+	{ 0xc2, 0x29, 0xeb, 0x80, 0x03, 0x80, 0x43, 0x80, 0x88, 0x80, 0x00, 0x00, 0x00, 0x0c, 0x40, 0x00 },
+	{ 0x94, 0xac, 0xe4, 0x71, 0x06, 0xc1, 0x46, 0xc1, 0x8f, 0x47, 0x00, 0x00, 0x00, 0x2d, 0x9d, 0x81 },
+	{ 0x9f, 0x80, 0xc8, 0x3a, 0x00, 0x5a, 0x40, 0x5a, 0x82, 0x76, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xa4 },
+	{ 0x7a, 0x09, 0x62, 0xb8, 0x04, 0x38, 0x44, 0x38, 0x8d, 0x88, 0x00, 0x00, 0x00, 0x11, 0xcc, 0x40 },
+	{ 0xad, 0xd7, 0x1f, 0xdf, 0x06, 0x8f, 0x46, 0x8f, 0x8d, 0xe9, 0x00, 0x00, 0x00, 0x2b, 0x03, 0xe1 },
+	{ 0x59, 0xd5, 0x09, 0xef, 0x05, 0x9f, 0x45, 0x9f, 0x87, 0x59, 0x00, 0x00, 0x00, 0x1f, 0x98, 0xc1 },
+	{ 0xd3, 0x30, 0xb2, 0xcc, 0x06, 0x8c, 0x46, 0x8c, 0x8d, 0xd4, 0x00, 0x00, 0x00, 0x2a, 0xdc, 0x90 },
+	{ 0xfc, 0x84, 0x03, 0xe9, 0x03, 0xb9, 0x43, 0xb9, 0x8a, 0x0f, 0x00, 0x00, 0x00, 0x0d, 0xdb, 0xb1 },
+	{ 0x46, 0x3b, 0xa5, 0x91, 0x01, 0xe1, 0x41, 0xe1, 0x8d, 0x27, 0x00, 0x00, 0x00, 0x03, 0x87, 0xc1 },
+	{ 0x63, 0x11, 0xd4, 0xd8, 0x00, 0x58, 0x40, 0x58, 0x82, 0x68, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x40 },
+	{ 0xbc, 0x99, 0x14, 0x70, 0x07, 0x70, 0x47, 0x70, 0x84, 0x10, 0x00, 0x00, 0x00, 0x37, 0x51, 0x00 },
+	{ 0x9c, 0xa0, 0x60, 0xd1, 0x01, 0x21, 0x41, 0x21, 0x87, 0xe7, 0x00, 0x00, 0x00, 0x01, 0x46, 0x41 },
+	{ 0x9d, 0xfb, 0xd4, 0x87, 0x07, 0xb7, 0x47, 0xb7, 0x86, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x84, 0xd1 },
+	{ 0xe0, 0x79, 0x61, 0x12, 0x04, 0xb2, 0x44, 0xb2, 0x80, 0xde, 0x00, 0x00, 0x00, 0x16, 0x0b, 0xc4 },
+	{ 0x4c, 0x5c, 0x63, 0xe7, 0x05, 0x17, 0x45, 0x17, 0x83, 0xa1, 0x00, 0x00, 0x00, 0x19, 0xe8, 0x11 },
+	{ 0x83, 0x28, 0x5b, 0x0c, 0x02, 0xcc, 0x42, 0xcc, 0x83, 0x94, 0x00, 0x00, 0x00, 0x07, 0xd2, 0x90 },
+	{ 0x9e, 0xb5, 0x3b, 0xca, 0x00, 0xea, 0x40, 0xea, 0x86, 0x66, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xe4 },
+	{ 0x28, 0x99, 0xe9, 0xda, 0x03, 0xfa, 0x43, 0xfa, 0x8b, 0xd6, 0x00, 0x00, 0x00, 0x0f, 0xd0, 0x24 },
+	{ 0xcc, 0x62, 0x3a, 0x9b, 0x00, 0x0b, 0x40, 0x0b, 0x80, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79 },
+	{ 0x0a, 0xc8, 0x36, 0x61, 0x03, 0xb1, 0x43, 0xb1, 0x89, 0xd7, 0x00, 0x00, 0x00, 0x0d, 0xa0, 0x61 },
+	{ 0xbc, 0xe6, 0xde, 0xc7, 0x05, 0xf7, 0x45, 0xf7, 0x89, 0xc1, 0x00, 0x00, 0x00, 0x23, 0x94, 0x51 },
+	{ 0xd1, 0xb7, 0x6c, 0x81, 0x03, 0xd1, 0x43, 0xd1, 0x8a, 0xb7, 0x00, 0x00, 0x00, 0x0e, 0x90, 0xa1 },
+	{ 0x03, 0x5e, 0x29, 0x82, 0x00, 0x22, 0x40, 0x22, 0x80, 0xee, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84 },
+	{ 0x71, 0x08, 0x3c, 0xf9, 0x01, 0xc9, 0x41, 0xc9, 0x8c, 0x7f, 0x00, 0x00, 0x00, 0x03, 0x2f, 0xd1 },
+	{ 0xa4, 0x0a, 0x6d, 0xb0, 0x04, 0xb0, 0x44, 0xb0, 0x80, 0xd0, 0x00, 0x00, 0x00, 0x15, 0xf9, 0x00 },
+	{ 0x10, 0x89, 0x05, 0x33, 0x02, 0x23, 0x42, 0x23, 0x8e, 0xf5, 0x00, 0x00, 0x00, 0x04, 0x90, 0xc9 },
+	{ 0xf0, 0xd2, 0x6e, 0x83, 0x04, 0x73, 0x44, 0x73, 0x8f, 0x25, 0x00, 0x00, 0x00, 0x13, 0xcb, 0xa9 },
+	{ 0xfe, 0x4b, 0x14, 0x8b, 0x04, 0xfb, 0x44, 0xfb, 0x82, 0xdd, 0x00, 0x00, 0x00, 0x18, 0xce, 0x19 },
+	{ 0x11, 0x36, 0xbf, 0x0e, 0x05, 0x6e, 0x45, 0x6e, 0x86, 0x02, 0x00, 0x00, 0x00, 0x1d, 0x7b, 0x44 },
+	{ 0xda, 0x6a, 0xc7, 0xe9, 0x07, 0xb9, 0x47, 0xb9, 0x86, 0x0f, 0x00, 0x00, 0x00, 0x3b, 0xa3, 0xb1 },
+	{ 0x0d, 0xd8, 0x95, 0x8c, 0x05, 0x4c, 0x45, 0x4c, 0x85, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x0e, 0x90 },
+	{ 0x7d, 0x85, 0x5e, 0xcf, 0x00, 0x7f, 0x40, 0x7f, 0x83, 0x79, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x01 },
+	{ 0x04, 0xd7, 0x6f, 0xcd, 0x02, 0xdd, 0x42, 0xdd, 0x84, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x32, 0xc9 },
+	{ 0xec, 0xd8, 0xb0, 0x53, 0x07, 0x43, 0x47, 0x43, 0x82, 0xd5, 0x00, 0x00, 0x00, 0x34, 0xbb, 0x89 },
+	{ 0x68, 0x84, 0xd9, 0x53, 0x00, 0x43, 0x40, 0x43, 0x81, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x11, 0x89 },
+	{ 0xe0, 0xa9, 0x58, 0xd4, 0x07, 0x14, 0x47, 0x14, 0x81, 0x8c, 0x00, 0x00, 0x00, 0x32, 0x19, 0x90 },
+	{ 0x72, 0x33, 0xb8, 0xed, 0x05, 0xfd, 0x45, 0xfd, 0x89, 0xeb, 0x00, 0x00, 0x00, 0x23, 0xdc, 0x09 },
+	{ 0x10, 0x1d, 0x68, 0x47, 0x07, 0x77, 0x47, 0x77, 0x84, 0x41, 0x00, 0x00, 0x00, 0x37, 0xb9, 0x51 },
+	{ 0x18, 0xee, 0x96, 0x44, 0x07, 0x84, 0x47, 0x84, 0x84, 0x9c, 0x00, 0x00, 0x00, 0x38, 0x7c, 0x10 },
+	{ 0x97, 0x5d, 0x54, 0x18, 0x03, 0x98, 0x43, 0x98, 0x89, 0x28, 0x00, 0x00, 0x00, 0x0c, 0xea, 0x40 },
+	{ 0x5e, 0x7c, 0x81, 0xfa, 0x06, 0x1a, 0x46, 0x1a, 0x8a, 0xb6, 0x00, 0x00, 0x00, 0x25, 0x3a, 0xa4 },
+	{ 0xfe, 0xe6, 0xa9, 0x39, 0x02, 0x09, 0x42, 0x09, 0x8e, 0x3f, 0x00, 0x00, 0x00, 0x04, 0x24, 0x51 },
+	{ 0x9e, 0xe5, 0x33, 0x8c, 0x03, 0x4c, 0x43, 0x4c, 0x87, 0x14, 0x00, 0x00, 0x00, 0x0a, 0xde, 0x90 },
+	{ 0xd7, 0xf5, 0xfd, 0x6c, 0x03, 0x2c, 0x43, 0x2c, 0x86, 0x34, 0x00, 0x00, 0x00, 0x0a, 0x0f, 0x90 },
+	{ 0xb6, 0x78, 0x56, 0x1a, 0x04, 0x3a, 0x44, 0x3a, 0x8d, 0x96, 0x00, 0x00, 0x00, 0x11, 0xdd, 0x24 },
+	{ 0xae, 0x54, 0xe1, 0xf8, 0x07, 0x78, 0x47, 0x78, 0x84, 0x48, 0x00, 0x00, 0x00, 0x37, 0xc8, 0x40 },
+	{ 0x09, 0x61, 0x15, 0x43, 0x07, 0x33, 0x47, 0x33, 0x82, 0x65, 0x00, 0x00, 0x00, 0x33, 0xd4, 0x29 },
+	{ 0xe6, 0xe7, 0xe9, 0xbf, 0x06, 0x6f, 0x46, 0x6f, 0x8d, 0x09, 0x00, 0x00, 0x00, 0x29, 0x64, 0x21 },
+	{ 0x4d, 0x27, 0xf0, 0x57, 0x04, 0x87, 0x44, 0x87, 0x8f, 0xb1, 0x00, 0x00, 0x00, 0x14, 0x7f, 0x31 },
+	{ 0x41, 0x76, 0x5a, 0xf1, 0x05, 0x41, 0x45, 0x41, 0x84, 0xc7, 0x00, 0x00, 0x00, 0x1b, 0x9a, 0x81 },
+	{ 0x66, 0xff, 0xe5, 0xa0, 0x07, 0xa0, 0x47, 0xa0, 0x85, 0x60, 0x00, 0x00, 0x00, 0x3a, 0x24, 0x00 },
+	{ 0x67, 0xcb, 0x72, 0x10, 0x07, 0x10, 0x47, 0x10, 0x81, 0x70, 0x00, 0x00, 0x00, 0x31, 0xe1, 0x00 },
+	{ 0x12, 0x9d, 0xe0, 0x2c, 0x01, 0xec, 0x41, 0xec, 0x8d, 0x74, 0x00, 0x00, 0x00, 0x03, 0xb1, 0x90 },
+	{ 0x16, 0x79, 0xcb, 0xc7, 0x02, 0xf7, 0x42, 0xf7, 0x84, 0xc1, 0x00, 0x00, 0x00, 0x08, 0xca, 0x51 },
+	{ 0xc6, 0xa1, 0x6b, 0xc9, 0x01, 0x99, 0x41, 0x99, 0x8b, 0x2f, 0x00, 0x00, 0x00, 0x02, 0x8d, 0x71 },
+	{ 0x11, 0xd2, 0x53, 0xbc, 0x02, 0x7c, 0x42, 0x7c, 0x81, 0x64, 0x00, 0x00, 0x00, 0x06, 0x2c, 0x10 },
+	{ 0x5f, 0x95, 0xd8, 0xc1, 0x04, 0x11, 0x44, 0x11, 0x8c, 0x77, 0x00, 0x00, 0x00, 0x10, 0x89, 0x21 },
+	{ 0x98, 0x58, 0xd8, 0x4a, 0x05, 0x6a, 0x45, 0x6a, 0x85, 0xe6, 0x00, 0x00, 0x00, 0x1d, 0x4f, 0xe4 },
+	{ 0x85, 0x9d, 0x25, 0x89, 0x07, 0x59, 0x47, 0x59, 0x83, 0x6f, 0x00, 0x00, 0x00, 0x35, 0xfc, 0xf1 },
+	{ 0xc9, 0x34, 0x08, 0xdb, 0x02, 0x4b, 0x42, 0x4b, 0x80, 0x0d, 0x00, 0x00, 0x00, 0x05, 0x41, 0xf9 },
+	{ 0xb5, 0xfa, 0x94, 0x01, 0x03, 0x51, 0x43, 0x51, 0x87, 0x37, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xa1 },
+	{ 0xbf, 0xc7, 0x46, 0x30, 0x05, 0x30, 0x45, 0x30, 0x84, 0x50, 0x00, 0x00, 0x00, 0x1a, 0xe9, 0x00 },
+	{ 0xf6, 0x75, 0x6a, 0xc0, 0x06, 0xc0, 0x46, 0xc0, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x2d, 0x90, 0x00 },
+	{ 0xde, 0x04, 0x96, 0x95, 0x00, 0x25, 0x40, 0x25, 0x81, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x59 },
+	{ 0x73, 0x6a, 0xe2, 0x49, 0x00, 0x19, 0x40, 0x19, 0x80, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71 },
+	{ 0xc9, 0xff, 0x95, 0x4b, 0x01, 0xbb, 0x41, 0xbb, 0x8c, 0x1d, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x99 },
+	{ 0x4d, 0xf3, 0x7c, 0xc7, 0x03, 0xf7, 0x43, 0xf7, 0x8b, 0xc1, 0x00, 0x00, 0x00, 0x0f, 0xb8, 0x51 },
+	{ 0x5c, 0x19, 0xdc, 0xaa, 0x07, 0xca, 0x47, 0xca, 0x86, 0x86, 0x00, 0x00, 0x00, 0x3c, 0xab, 0x64 },
+	{ 0x25, 0x6b, 0xb8, 0x1a, 0x06, 0x3a, 0x46, 0x3a, 0x8b, 0x96, 0x00, 0x00, 0x00, 0x26, 0xc5, 0x24 },
+	{ 0xaf, 0x8c, 0x0b, 0x54, 0x01, 0x94, 0x41, 0x94, 0x8b, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x7d, 0x90 },
+	{ 0x4b, 0x13, 0x15, 0x5e, 0x04, 0xbe, 0x44, 0xbe, 0x81, 0x32, 0x00, 0x00, 0x00, 0x16, 0x7d, 0x04 },
+	{ 0xbb, 0xeb, 0x5a, 0x95, 0x04, 0x25, 0x44, 0x25, 0x8d, 0x03, 0x00, 0x00, 0x00, 0x11, 0x2d, 0x59 },
+	{ 0x8a, 0xfe, 0x04, 0xd7, 0x01, 0x07, 0x41, 0x07, 0x87, 0x31, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x31 },
+	{ 0x87, 0xff, 0xca, 0xd9, 0x05, 0xa9, 0x45, 0xa9, 0x87, 0x9f, 0x00, 0x00, 0x00, 0x20, 0x09, 0x91 },
+	{ 0xb0, 0xb7, 0x87, 0x48, 0x05, 0xc8, 0x45, 0xc8, 0x88, 0x78, 0x00, 0x00, 0x00, 0x21, 0x6c, 0x40 },
+	{ 0x1e, 0xaf, 0x65, 0x16, 0x05, 0xf6, 0x45, 0xf6, 0x89, 0xba, 0x00, 0x00, 0x00, 0x23, 0x88, 0x64 },
+	{ 0xc5, 0xb8, 0x0c, 0xc4, 0x06, 0x04, 0x46, 0x04, 0x8a, 0x1c, 0x00, 0x00, 0x00, 0x24, 0x30, 0x10 },
+	{ 0xa4, 0x3a, 0x65, 0x72, 0x07, 0x12, 0x47, 0x12, 0x81, 0x7e, 0x00, 0x00, 0x00, 0x31, 0xfd, 0x44 },
+	{ 0x54, 0xcd, 0xa2, 0x60, 0x00, 0x60, 0x40, 0x60, 0x82, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00 },
+	{ 0xba, 0xef, 0xd6, 0x63, 0x02, 0x53, 0x42, 0x53, 0x80, 0x45, 0x00, 0x00, 0x00, 0x05, 0x66, 0xe9 },
+	{ 0x47, 0x19, 0x57, 0x2e, 0x07, 0x8e, 0x47, 0x8e, 0x84, 0xe2, 0x00, 0x00, 0x00, 0x39, 0x12, 0xc4 },
+	{ 0xf6, 0x45, 0x72, 0xfe, 0x04, 0x5e, 0x44, 0x5e, 0x8e, 0x92, 0x00, 0x00, 0x00, 0x13, 0x12, 0x84 },
+	{ 0x7e, 0x15, 0x46, 0x15, 0x07, 0xa5, 0x47, 0xa5, 0x85, 0x83, 0x00, 0x00, 0x00, 0x3a, 0x70, 0x59 },
+	{ 0x41, 0x16, 0x6b, 0x6d, 0x00, 0x7d, 0x40, 0x7d, 0x83, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x09 },
+	{ 0xde, 0x64, 0x86, 0x19, 0x04, 0xe9, 0x44, 0xe9, 0x82, 0x5f, 0x00, 0x00, 0x00, 0x18, 0x1c, 0x11 },
+	{ 0x64, 0x5b, 0x23, 0x61, 0x00, 0xb1, 0x40, 0xb1, 0x84, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x61 },
+	{ 0xa8, 0x81, 0xed, 0xf9, 0x02, 0xc9, 0x42, 0xc9, 0x83, 0x7f, 0x00, 0x00, 0x00, 0x07, 0xc1, 0xd1 },
+	{ 0x0d, 0xf6, 0x68, 0x21, 0x01, 0x71, 0x41, 0x71, 0x8a, 0x17, 0x00, 0x00, 0x00, 0x02, 0x13, 0xe1 },
+	{ 0x9f, 0x62, 0xf5, 0xa5, 0x04, 0x35, 0x44, 0x35, 0x8d, 0x73, 0x00, 0x00, 0x00, 0x11, 0xb2, 0xf9 },
+	{ 0x4f, 0xd8, 0x5f, 0xfe, 0x01, 0x5e, 0x41, 0x5e, 0x89, 0x92, 0x00, 0x00, 0x00, 0x01, 0xde, 0x84 },
+	{ 0x46, 0x9b, 0x95, 0x15, 0x06, 0xa5, 0x46, 0xa5, 0x8e, 0x83, 0x00, 0x00, 0x00, 0x2c, 0x26, 0x59 },
+	{ 0x7a, 0xb7, 0x1c, 0x93, 0x07, 0x83, 0x47, 0x83, 0x84, 0x95, 0x00, 0x00, 0x00, 0x38, 0x6d, 0x09 },
+	{ 0x77, 0x28, 0xfb, 0x4f, 0x04, 0xff, 0x44, 0xff, 0x82, 0xf9, 0x00, 0x00, 0x00, 0x18, 0xf6, 0x01 },
+	{ 0x60, 0xfc, 0xf9, 0xdf, 0x00, 0x8f, 0x40, 0x8f, 0x83, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xe1 },
+	{ 0x31, 0xb8, 0xe2, 0x2e, 0x02, 0x8e, 0x42, 0x8e, 0x81, 0xe2, 0x00, 0x00, 0x00, 0x06, 0x86, 0xc4 },
+	{ 0x33, 0x02, 0x30, 0xb7, 0x02, 0xe7, 0x42, 0xe7, 0x84, 0x51, 0x00, 0x00, 0x00, 0x08, 0x6c, 0x71 },
+	{ 0x92, 0x38, 0x19, 0xf4, 0x02, 0x34, 0x42, 0x34, 0x8f, 0x6c, 0x00, 0x00, 0x00, 0x04, 0xda, 0x90 },
+	{ 0x11, 0x06, 0xc7, 0x4c, 0x03, 0x0c, 0x43, 0x0c, 0x85, 0x54, 0x00, 0x00, 0x00, 0x09, 0x48, 0x90 },
+	{ 0x7c, 0x6c, 0x08, 0x08, 0x02, 0x88, 0x42, 0x88, 0x81, 0xb8, 0x00, 0x00, 0x00, 0x06, 0x68, 0x40 },
+	{ 0xbf, 0x67, 0x56, 0xac, 0x00, 0x6c, 0x40, 0x6c, 0x82, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x90 },
+	{ 0x49, 0xf9, 0xbe, 0x97, 0x06, 0xc7, 0x46, 0xc7, 0x8f, 0x71, 0x00, 0x00, 0x00, 0x2d, 0xee, 0xb1 },
+	{ 0xc6, 0xef, 0x36, 0x20, 0x00, 0x20, 0x40, 0x20, 0x80, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00 },
+	{ 0xa2, 0xc1, 0x1f, 0x27, 0x04, 0x57, 0x44, 0x57, 0x8e, 0x61, 0x00, 0x00, 0x00, 0x12, 0xd5, 0x91 },
+	{ 0xb1, 0x83, 0x13, 0xb8, 0x05, 0x38, 0x45, 0x38, 0x84, 0x88, 0x00, 0x00, 0x00, 0x1b, 0x3c, 0x40 },
+	{ 0x76, 0x5d, 0x6e, 0xdf, 0x05, 0x8f, 0x45, 0x8f, 0x86, 0xe9, 0x00, 0x00, 0x00, 0x1e, 0xe5, 0xe1 },
+	{ 0xe7, 0x35, 0xb4, 0x16, 0x04, 0xf6, 0x44, 0xf6, 0x82, 0xba, 0x00, 0x00, 0x00, 0x18, 0x9c, 0x64 },
+	{ 0x18, 0x70, 0xd4, 0x2b, 0x06, 0x9b, 0x46, 0x9b, 0x8e, 0x3d, 0x00, 0x00, 0x00, 0x2b, 0xa1, 0xd9 },
+	{ 0xce, 0x0b, 0x78, 0xa8, 0x05, 0x28, 0x45, 0x28, 0x84, 0x18, 0x00, 0x00, 0x00, 0x1a, 0x96, 0x40 },
+	{ 0x1f, 0x4a, 0xf9, 0xc4, 0x03, 0x04, 0x43, 0x04, 0x85, 0x1c, 0x00, 0x00, 0x00, 0x09, 0x18, 0x10 },
+	{ 0x21, 0x2f, 0xdc, 0xfb, 0x00, 0x6b, 0x40, 0x6b, 0x82, 0xed, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xb9 },
+	{ 0x6a, 0xc9, 0xac, 0x0e, 0x02, 0x6e, 0x42, 0x6e, 0x81, 0x02, 0x00, 0x00, 0x00, 0x05, 0xe7, 0x44 },
+	{ 0x93, 0xe1, 0x58, 0x01, 0x07, 0x51, 0x47, 0x51, 0x83, 0x37, 0x00, 0x00, 0x00, 0x35, 0x87, 0xa1 },
+	{ 0xb8, 0x8d, 0x31, 0x13, 0x04, 0x03, 0x44, 0x03, 0x8c, 0x15, 0x00, 0x00, 0x00, 0x10, 0x18, 0x09 },
+	{ 0xc1, 0x10, 0x94, 0xb9, 0x05, 0x89, 0x45, 0x89, 0x86, 0xbf, 0x00, 0x00, 0x00, 0x1e, 0xa3, 0x51 },
+	{ 0x9b, 0x69, 0x37, 0x75, 0x07, 0x05, 0x47, 0x05, 0x81, 0x23, 0x00, 0x00, 0x00, 0x31, 0x46, 0x19 },
+	{ 0x22, 0xf6, 0xed, 0x9d, 0x01, 0xad, 0x41, 0xad, 0x8b, 0xbb, 0x00, 0x00, 0x00, 0x02, 0xce, 0xe9 },
+	{ 0x37, 0xf7, 0x73, 0x19, 0x01, 0xe9, 0x41, 0xe9, 0x8d, 0x5f, 0x00, 0x00, 0x00, 0x03, 0xa6, 0x11 },
+	{ 0xd0, 0xeb, 0xe0, 0x11, 0x04, 0x61, 0x44, 0x61, 0x8e, 0xa7, 0x00, 0x00, 0x00, 0x13, 0x2c, 0xc1 },
+	{ 0x74, 0x48, 0x93, 0xe6, 0x05, 0xc6, 0x45, 0xc6, 0x88, 0x6a, 0x00, 0x00, 0x00, 0x21, 0x55, 0x24 },
+	{ 0x5e, 0x2e, 0xb7, 0xa3, 0x07, 0x93, 0x47, 0x93, 0x85, 0x05, 0x00, 0x00, 0x00, 0x39, 0x5e, 0x69 },
+	{ 0x86, 0xe6, 0x74, 0x12, 0x07, 0xb2, 0x47, 0xb2, 0x85, 0xde, 0x00, 0x00, 0x00, 0x3b, 0x37, 0xc4 },
+	{ 0xbb, 0x1f, 0xce, 0x25, 0x04, 0xb5, 0x44, 0xb5, 0x80, 0xf3, 0x00, 0x00, 0x00, 0x16, 0x27, 0xf9 },
+	{ 0x00, 0x8f, 0xe7, 0x46, 0x07, 0x26, 0x47, 0x26, 0x82, 0x0a, 0x00, 0x00, 0x00, 0x33, 0x19, 0xa4 },
+	{ 0x2a, 0xfc, 0x8f, 0x2a, 0x02, 0x4a, 0x42, 0x4a, 0x80, 0x06, 0x00, 0x00, 0x00, 0x05, 0x3d, 0x64 },
+	{ 0xcd, 0x0f, 0xf4, 0x76, 0x03, 0x56, 0x43, 0x56, 0x87, 0x5a, 0x00, 0x00, 0x00, 0x0b, 0x20, 0xe4 },
+	{ 0x8d, 0x12, 0xdf, 0xd0, 0x00, 0xd0, 0x40, 0xd0, 0x85, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x00 },
+	{ 0x61, 0xda, 0xab, 0x7c, 0x06, 0x3c, 0x46, 0x3c, 0x8b, 0xa4, 0x00, 0x00, 0x00, 0x26, 0xde, 0x10 },
+	{ 0x6d, 0x2c, 0x51, 0x5e, 0x00, 0xbe, 0x40, 0xbe, 0x85, 0x32, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x04 },
+	{ 0x79, 0x6d, 0xce, 0x0a, 0x07, 0x2a, 0x47, 0x2a, 0x82, 0x26, 0x00, 0x00, 0x00, 0x33, 0x52, 0xe4 },
+	{ 0xee, 0x8d, 0x9b, 0xc8, 0x02, 0x48, 0x42, 0x48, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x05, 0x34, 0x40 },
+	{ 0x04, 0x3b, 0xdb, 0x1f, 0x05, 0xcf, 0x45, 0xcf, 0x88, 0xa9, 0x00, 0x00, 0x00, 0x21, 0xbd, 0x61 },
+	{ 0x8b, 0x2d, 0xfc, 0x99, 0x03, 0x69, 0x43, 0x69, 0x87, 0xdf, 0x00, 0x00, 0x00, 0x0b, 0xa1, 0x11 },
+	{ 0x16, 0x2c, 0x01, 0x70, 0x04, 0x70, 0x44, 0x70, 0x8f, 0x10, 0x00, 0x00, 0x00, 0x13, 0xb1, 0x00 },
+	{ 0x6b, 0x95, 0x38, 0x7e, 0x01, 0xde, 0x41, 0xde, 0x8d, 0x12, 0x00, 0x00, 0x00, 0x03, 0x7c, 0x84 },
+	{ 0x2c, 0x15, 0xe5, 0xf1, 0x00, 0x41, 0x40, 0x41, 0x81, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x10, 0x81 },
+	{ 0x42, 0xdd, 0x7c, 0x0f, 0x01, 0xbf, 0x41, 0xbf, 0x8c, 0x39, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x81 },
+	{ 0xea, 0xe1, 0xa7, 0xef, 0x03, 0x9f, 0x43, 0x9f, 0x89, 0x59, 0x00, 0x00, 0x00, 0x0d, 0x1c, 0xc1 },
+	{ 0x24, 0xbd, 0xfe, 0x3f, 0x02, 0xef, 0x42, 0xef, 0x84, 0x89, 0x00, 0x00, 0x00, 0x08, 0x9b, 0x21 },
+	{ 0xd7, 0x78, 0x3b, 0x53, 0x02, 0x43, 0x42, 0x43, 0x8f, 0xd5, 0x00, 0x00, 0x00, 0x05, 0x1d, 0x89 },
+	{ 0x6e, 0x0a, 0x02, 0xfb, 0x06, 0x6b, 0x46, 0x6b, 0x8c, 0xed, 0x00, 0x00, 0x00, 0x29, 0x30, 0xb9 },
+	{ 0xca, 0xad, 0x4f, 0x26, 0x05, 0x06, 0x45, 0x06, 0x83, 0x2a, 0x00, 0x00, 0x00, 0x19, 0x3c, 0x24 },
+	{ 0xdb, 0x54, 0x26, 0xee, 0x03, 0x4e, 0x43, 0x4e, 0x87, 0x22, 0x00, 0x00, 0x00, 0x0a, 0xeb, 0xc4 },
+	{ 0x0e, 0x08, 0x8d, 0x4e, 0x07, 0xae, 0x47, 0xae, 0x85, 0xc2, 0x00, 0x00, 0x00, 0x3a, 0xfa, 0x44 },
+	{ 0x57, 0x60, 0x3f, 0x72, 0x01, 0x12, 0x41, 0x12, 0x87, 0x7e, 0x00, 0x00, 0x00, 0x01, 0x25, 0x44 },
+	{ 0x2c, 0x45, 0xdd, 0xb3, 0x02, 0xa3, 0x42, 0xa3, 0x82, 0x75, 0x00, 0x00, 0x00, 0x06, 0xf3, 0xc9 },
+	{ 0x43, 0x3d, 0x6b, 0x93, 0x06, 0x83, 0x46, 0x83, 0x8d, 0x95, 0x00, 0x00, 0x00, 0x2a, 0x67, 0x09 },
+	{ 0xa3, 0x5c, 0xb3, 0xd5, 0x01, 0x65, 0x41, 0x65, 0x89, 0xc3, 0x00, 0x00, 0x00, 0x01, 0xf1, 0xd9 },
+	{ 0x3f, 0x01, 0x90, 0x74, 0x00, 0xb4, 0x40, 0xb4, 0x84, 0xec, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x90 },
+	{ 0x28, 0xb7, 0xbc, 0x6f, 0x00, 0x1f, 0x40, 0x1f, 0x80, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc1 },
+	{ 0xc7, 0x9c, 0xef, 0xfb, 0x03, 0x6b, 0x43, 0x6b, 0x87, 0xed, 0x00, 0x00, 0x00, 0x0b, 0xae, 0xb9 },
+	{ 0x21, 0x5f, 0xd4, 0xbd, 0x02, 0xcd, 0x42, 0xcd, 0x83, 0x9b, 0x00, 0x00, 0x00, 0x07, 0xd8, 0x29 },
+	{ 0xb2, 0x7e, 0x97, 0xea, 0x07, 0x0a, 0x47, 0x0a, 0x81, 0x46, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x64 },
+	{ 0xfc, 0x54, 0x0c, 0x27, 0x01, 0x57, 0x41, 0x57, 0x89, 0x61, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x91 },
+	{ 0x5c, 0xb5, 0x71, 0x58, 0x04, 0xd8, 0x44, 0xd8, 0x81, 0xe8, 0x00, 0x00, 0x00, 0x17, 0x76, 0x40 },
+	{ 0xa0, 0xfa, 0x0e, 0x85, 0x03, 0x15, 0x43, 0x15, 0x85, 0x93, 0x00, 0x00, 0x00, 0x09, 0x7f, 0xb9 },
+	{ 0xf8, 0xa8, 0x18, 0x4e, 0x02, 0xae, 0x42, 0xae, 0x82, 0xc2, 0x00, 0x00, 0x00, 0x07, 0x2e, 0x44 },
+	{ 0xcc, 0xdf, 0xfc, 0xb4, 0x00, 0xf4, 0x40, 0xf4, 0x86, 0xac, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x90 },
+	{ 0x8f, 0xd5, 0x74, 0xa4, 0x03, 0xe4, 0x43, 0xe4, 0x8b, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x23, 0x10 },
+	{ 0x89, 0xc6, 0xdb, 0x7b, 0x06, 0xeb, 0x46, 0xeb, 0x80, 0x6d, 0x00, 0x00, 0x00, 0x2f, 0xdb, 0xb9 },
+	{ 0xb4, 0xe1, 0x3d, 0x3a, 0x05, 0x5a, 0x45, 0x5a, 0x85, 0x76, 0x00, 0x00, 0x00, 0x1c, 0xa3, 0xa4 },
+	{ 0x32, 0x66, 0x9c, 0x09, 0x05, 0xd9, 0x45, 0xd9, 0x88, 0xef, 0x00, 0x00, 0x00, 0x22, 0x31, 0xf1 },
+	{ 0x27, 0x9e, 0x65, 0xa8, 0x02, 0x28, 0x42, 0x28, 0x8f, 0x18, 0x00, 0x00, 0x00, 0x04, 0xa6, 0x40 },
+	{ 0xc4, 0x6e, 0xbe, 0x3b, 0x05, 0xab, 0x45, 0xab, 0x87, 0xad, 0x00, 0x00, 0x00, 0x20, 0x20, 0x39 },
+	{ 0xaf, 0xeb, 0xfa, 0xd8, 0x06, 0x58, 0x46, 0x58, 0x8c, 0x68, 0x00, 0x00, 0x00, 0x28, 0x3e, 0x40 },
+	{ 0xab, 0x44, 0x82, 0xcd, 0x05, 0xdd, 0x45, 0xdd, 0x89, 0x0b, 0x00, 0x00, 0x00, 0x22, 0x60, 0xc9 },
+	{ 0xd7, 0x2a, 0x70, 0xfc, 0x03, 0xbc, 0x43, 0xbc, 0x8a, 0x24, 0x00, 0x00, 0x00, 0x0d, 0xf2, 0x10 },
+	{ 0x4b, 0x43, 0x0d, 0x20, 0x07, 0x20, 0x47, 0x20, 0x81, 0xe0, 0x00, 0x00, 0x00, 0x32, 0xc4, 0x00 },
+	{ 0x9e, 0x37, 0x79, 0xb1, 0x00, 0x01, 0x40, 0x01, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+	{ 0x9b, 0xb7, 0x01, 0xcc, 0x05, 0x8c, 0x45, 0x8c, 0x86, 0xd4, 0x00, 0x00, 0x00, 0x1e, 0xc4, 0x90 },
+	{ 0x43, 0xd9, 0x00, 0x41, 0x03, 0x91, 0x43, 0x91, 0x88, 0xf7, 0x00, 0x00, 0x00, 0x0c, 0xb8, 0x21 },
+	{ 0x08, 0x65, 0x91, 0x11, 0x05, 0x61, 0x45, 0x61, 0x85, 0xa7, 0x00, 0x00, 0x00, 0x1c, 0xee, 0xc1 },
+	{ 0x03, 0xbe, 0x19, 0x06, 0x04, 0xe6, 0x44, 0xe6, 0x82, 0x4a, 0x00, 0x00, 0x00, 0x17, 0xfe, 0xa4 },
+	{ 0x36, 0x42, 0x87, 0xa4, 0x06, 0xe4, 0x46, 0xe4, 0x80, 0x3c, 0x00, 0x00, 0x00, 0x2f, 0x7b, 0x10 },
+	{ 0x07, 0xb7, 0xd7, 0x36, 0x02, 0x16, 0x42, 0x16, 0x8e, 0x9a, 0x00, 0x00, 0x00, 0x04, 0x59, 0xe4 },
+	{ 0xee, 0x21, 0xfe, 0xdc, 0x07, 0x9c, 0x47, 0x9c, 0x85, 0x44, 0x00, 0x00, 0x00, 0x39, 0xe7, 0x10 },
+	{ 0xa3, 0xbc, 0xa3, 0x59, 0x06, 0x29, 0x46, 0x29, 0x8b, 0x1f, 0x00, 0x00, 0x00, 0x25, 0xf2, 0x91 },
+	{ 0x98, 0x0b, 0x0d, 0xf3, 0x06, 0xe3, 0x46, 0xe3, 0x80, 0x35, 0x00, 0x00, 0x00, 0x2f, 0x6d, 0x49 },
+	{ 0x99, 0x72, 0x2f, 0x11, 0x03, 0x61, 0x43, 0x61, 0x87, 0xa7, 0x00, 0x00, 0x00, 0x0b, 0x6a, 0xc1 },
+	{ 0x18, 0x10, 0xe4, 0xa7, 0x01, 0xd7, 0x41, 0xd7, 0x8c, 0xe1, 0x00, 0x00, 0x00, 0x03, 0x62, 0x91 },
+	{ 0xea, 0x33, 0xee, 0x14, 0x00, 0x54, 0x40, 0x54, 0x82, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x90 },
+	{ 0xa1, 0x77, 0xd0, 0x9e, 0x03, 0xfe, 0x43, 0xfe, 0x8b, 0xf2, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x04 },
+	{ 0x58, 0x2b, 0xcb, 0xe2, 0x00, 0x82, 0x40, 0x82, 0x83, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x42, 0x04 },
+	{ 0x40, 0x5d, 0x04, 0x2a, 0x07, 0x4a, 0x47, 0x4a, 0x83, 0x06, 0x00, 0x00, 0x00, 0x35, 0x21, 0x64 },
+	{ 0xc5, 0xd5, 0xdf, 0x59, 0x02, 0x29, 0x42, 0x29, 0x8f, 0x1f, 0x00, 0x00, 0x00, 0x04, 0xaa, 0x91 },
+	{ 0x20, 0x94, 0x48, 0x4d, 0x03, 0x5d, 0x43, 0x5d, 0x87, 0x8b, 0x00, 0x00, 0x00, 0x0b, 0x4f, 0xc9 },
+	{ 0xc7, 0x7f, 0x1d, 0x66, 0x07, 0x46, 0x47, 0x46, 0x82, 0xea, 0x00, 0x00, 0x00, 0x34, 0xe7, 0x24 },
+	{ 0xd6, 0x8e, 0xdc, 0x4e, 0x06, 0xae, 0x46, 0xae, 0x8e, 0xc2, 0x00, 0x00, 0x00, 0x2c, 0x9e, 0x44 },
+	{ 0x69, 0x80, 0x5d, 0x85, 0x02, 0x15, 0x42, 0x15, 0x8e, 0x93, 0x00, 0x00, 0x00, 0x04, 0x55, 0xb9 },
+	{ 0x7e, 0xce, 0xad, 0x58, 0x00, 0xd8, 0x40, 0xd8, 0x85, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x40 },
+	{ 0x20, 0x46, 0x7d, 0xf6, 0x04, 0xd6, 0x44, 0xd6, 0x81, 0xda, 0x00, 0x00, 0x00, 0x17, 0x62, 0xe4 },
+	{ 0x91, 0x3c, 0x95, 0xc2, 0x00, 0x62, 0x40, 0x62, 0x82, 0xae, 0x00, 0x00, 0x00, 0x00, 0x25, 0x84 },
+	{ 0x0d, 0xa8, 0x9d, 0xca, 0x02, 0xea, 0x42, 0xea, 0x84, 0x66, 0x00, 0x00, 0x00, 0x08, 0x7d, 0xe4 },
+	{ 0xd3, 0x4e, 0x85, 0x61, 0x02, 0xb1, 0x42, 0xb1, 0x82, 0xd7, 0x00, 0x00, 0x00, 0x07, 0x3e, 0x61 },
+	{ 0xc9, 0x81, 0xd3, 0x32, 0x00, 0xd2, 0x40, 0xd2, 0x85, 0xbe, 0x00, 0x00, 0x00, 0x00, 0xac, 0x44 },
+	{ 0xb5, 0xca, 0x9c, 0x3f, 0x00, 0xef, 0x40, 0xef, 0x86, 0x89, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x21 },
+	{ 0x82, 0x2c, 0xd6, 0xda, 0x00, 0xfa, 0x40, 0xfa, 0x86, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x24 },
+	{ 0xe9, 0x68, 0x61, 0xa4, 0x00, 0xe4, 0x40, 0xe4, 0x86, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x10 },
+	{ 0x52, 0xca, 0xec, 0x94, 0x06, 0xd4, 0x46, 0xd4, 0x8f, 0xcc, 0x00, 0x00, 0x00, 0x2e, 0x9f, 0x90 },
+	{ 0x4e, 0x71, 0x3e, 0xe0, 0x04, 0xe0, 0x44, 0xe0, 0x82, 0x20, 0x00, 0x00, 0x00, 0x17, 0xc4, 0x00 },
+	{ 0x51, 0xcf, 0x68, 0x62, 0x05, 0x02, 0x45, 0x02, 0x83, 0x0e, 0x00, 0x00, 0x00, 0x19, 0x14, 0x04 },
+	{ 0xa0, 0x7c, 0x4c, 0x6c, 0x02, 0x2c, 0x42, 0x2c, 0x8f, 0x34, 0x00, 0x00, 0x00, 0x04, 0xb7, 0x90 },
+	{ 0xc4, 0x20, 0xf3, 0xe4, 0x07, 0x24, 0x47, 0x24, 0x81, 0xfc, 0x00, 0x00, 0x00, 0x32, 0xfd, 0x10 },
+	{ 0x53, 0xb4, 0x4b, 0x99, 0x02, 0x69, 0x42, 0x69, 0x80, 0xdf, 0x00, 0x00, 0x00, 0x05, 0xcf, 0x11 },
+	{ 0x5c, 0x37, 0xaf, 0x3f, 0x03, 0xef, 0x43, 0xef, 0x8b, 0x89, 0x00, 0x00, 0x00, 0x0f, 0x79, 0x21 },
+	{ 0xa3, 0xda, 0x75, 0xee, 0x02, 0x4e, 0x42, 0x4e, 0x80, 0x22, 0x00, 0x00, 0x00, 0x05, 0x4f, 0xc4 },
+	{ 0x18, 0xbe, 0x9e, 0x82, 0x05, 0x22, 0x45, 0x22, 0x83, 0xee, 0x00, 0x00, 0x00, 0x1a, 0x58, 0x84 },
+	{ 0xf4, 0xfc, 0x24, 0x75, 0x04, 0x05, 0x44, 0x05, 0x8c, 0x23, 0x00, 0x00, 0x00, 0x10, 0x28, 0x19 },
+	{ 0xf5, 0xc7, 0xb0, 0xe5, 0x03, 0x75, 0x43, 0x75, 0x88, 0x33, 0x00, 0x00, 0x00, 0x0b, 0xf3, 0x79 },
+	{ 0xad, 0x29, 0x66, 0x04, 0x03, 0x44, 0x43, 0x44, 0x86, 0xdc, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0x10 },
+	{ 0x81, 0x13, 0x80, 0x13, 0x03, 0x03, 0x43, 0x03, 0x85, 0x15, 0x00, 0x00, 0x00, 0x09, 0x12, 0x09 },
+	{ 0xd7, 0xd8, 0x2a, 0xd7, 0x07, 0x07, 0x47, 0x07, 0x81, 0x31, 0x00, 0x00, 0x00, 0x31, 0x62, 0x31 },
+	{ 0xc7, 0xea, 0xba, 0x52, 0x01, 0xf2, 0x41, 0xf2, 0x8d, 0x9e, 0x00, 0x00, 0x00, 0x03, 0xc8, 0xc4 },
+	{ 0x39, 0x40, 0xc1, 0xa2, 0x02, 0x42, 0x42, 0x42, 0x8f, 0xce, 0x00, 0x00, 0x00, 0x05, 0x19, 0x04 },
+	{ 0xf7, 0x10, 0xff, 0x6e, 0x03, 0xce, 0x43, 0xce, 0x8a, 0xa2, 0x00, 0x00, 0x00, 0x0e, 0x79, 0xc4 },
+	{ 0x06, 0x50, 0xb6, 0x18, 0x05, 0x98, 0x45, 0x98, 0x87, 0x28, 0x00, 0x00, 0x00, 0x1f, 0x4a, 0x40 },
+	{ 0xa8, 0x04, 0x2b, 0xe0, 0x01, 0xe0, 0x41, 0xe0, 0x8d, 0x20, 0x00, 0x00, 0x00, 0x03, 0x84, 0x00 },
+	{ 0x1f, 0x2d, 0x27, 0x2f, 0x06, 0xdf, 0x46, 0xdf, 0x80, 0x19, 0x00, 0x00, 0x00, 0x2f, 0x36, 0x41 },
+	{ 0x13, 0x69, 0x6c, 0x9c, 0x01, 0x5c, 0x41, 0x5c, 0x89, 0x84, 0x00, 0x00, 0x00, 0x01, 0xd9, 0x10 },
+	{ 0xc3, 0xa3, 0x31, 0xcb, 0x06, 0x3b, 0x46, 0x3b, 0x8b, 0x9d, 0x00, 0x00, 0x00, 0x26, 0xd1, 0x99 },
+	{ 0x87, 0x04, 0x46, 0xa7, 0x03, 0xd7, 0x43, 0xd7, 0x8a, 0xe1, 0x00, 0x00, 0x00, 0x0e, 0xbe, 0x91 },
+	{ 0xe7, 0xb3, 0x76, 0x2f, 0x05, 0xdf, 0x45, 0xdf, 0x89, 0x19, 0x00, 0x00, 0x00, 0x22, 0x78, 0x41 },
+	{ 0x35, 0x64, 0xd6, 0x07, 0x01, 0x37, 0x41, 0x37, 0x88, 0x81, 0x00, 0x00, 0x00, 0x01, 0x79, 0xd1 },
+	{ 0xe8, 0x01, 0x40, 0x86, 0x04, 0x66, 0x44, 0x66, 0x8e, 0xca, 0x00, 0x00, 0x00, 0x13, 0x58, 0xa4 },
+	{ 0xbe, 0x00, 0x35, 0x8e, 0x03, 0xee, 0x43, 0xee, 0x8b, 0x82, 0x00, 0x00, 0x00, 0x0f, 0x71, 0x44 },
+	{ 0xd5, 0x63, 0x60, 0x5a, 0x02, 0x7a, 0x42, 0x7a, 0x81, 0x56, 0x00, 0x00, 0x00, 0x06, 0x22, 0x24 },
+	{ 0xcb, 0xf6, 0x9d, 0xaf, 0x05, 0x5f, 0x45, 0x5f, 0x85, 0x99, 0x00, 0x00, 0x00, 0x1c, 0xd9, 0x41 },
+	{ 0x50, 0xb6, 0x11, 0x9b, 0x07, 0x0b, 0x47, 0x0b, 0x81, 0x4d, 0x00, 0x00, 0x00, 0x31, 0x9a, 0x79 },
+	{ 0x21, 0x12, 0x0a, 0x66, 0x04, 0x46, 0x44, 0x46, 0x8d, 0xea, 0x00, 0x00, 0x00, 0x12, 0x43, 0x24 },
+	{ 0x4f, 0x0c, 0xd3, 0x8e, 0x01, 0xee, 0x41, 0xee, 0x8d, 0x82, 0x00, 0x00, 0x00, 0x03, 0xb9, 0x44 },
+	{ 0xae, 0xa2, 0xac, 0x4f, 0x05, 0xff, 0x45, 0xff, 0x89, 0xf9, 0x00, 0x00, 0x00, 0x23, 0xf4, 0x01 },
+	{ 0x2a, 0x01, 0x0a, 0xf8, 0x00, 0x78, 0x40, 0x78, 0x83, 0x48, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40 },
+	{ 0x3e, 0x95, 0xf3, 0x88, 0x06, 0x08, 0x46, 0x08, 0x8a, 0x38, 0x00, 0x00, 0x00, 0x24, 0x60, 0x40 },
+	{ 0x71, 0xe5, 0xee, 0x96, 0x07, 0x76, 0x47, 0x76, 0x84, 0x3a, 0x00, 0x00, 0x00, 0x37, 0xaa, 0x64 },
+	{ 0x68, 0xb4, 0xd1, 0x15, 0x02, 0xa5, 0x42, 0xa5, 0x82, 0x83, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x59 },
+	{ 0x5c, 0xd3, 0x43, 0xed, 0x00, 0xfd, 0x40, 0xfd, 0x86, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x09 },
+	{ 0xb1, 0x23, 0x24, 0x34, 0x00, 0x74, 0x40, 0x74, 0x83, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x34, 0x90 },
+	{ 0x0e, 0xc1, 0xf4, 0x91, 0x00, 0xe1, 0x40, 0xe1, 0x86, 0x27, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc1 },
+	{ 0x64, 0x0d, 0x59, 0x0a, 0x02, 0x2a, 0x42, 0x2a, 0x8f, 0x26, 0x00, 0x00, 0x00, 0x04, 0xae, 0xe4 },
+	{ 0x4d, 0x75, 0xba, 0xae, 0x03, 0x0e, 0x43, 0x0e, 0x85, 0x62, 0x00, 0x00, 0x00, 0x09, 0x54, 0xc4 },
+	{ 0x6f, 0x41, 0x2c, 0x57, 0x00, 0x87, 0x40, 0x87, 0x83, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x47, 0x31 },
+	{ 0x60, 0x43, 0x92, 0x9c, 0x07, 0x5c, 0x47, 0x5c, 0x83, 0x84, 0x00, 0x00, 0x00, 0x36, 0x29, 0x10 },
+	{ 0x2d, 0x41, 0x61, 0xe5, 0x04, 0x75, 0x44, 0x75, 0x8f, 0x33, 0x00, 0x00, 0x00, 0x13, 0xdd, 0x79 },
+	{ 0x4c, 0x7a, 0x36, 0x7c, 0x01, 0x3c, 0x41, 0x3c, 0x88, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x86, 0x10 },
+	{ 0xc5, 0x6a, 0x42, 0x6d, 0x07, 0x7d, 0x47, 0x7d, 0x84, 0x6b, 0x00, 0x00, 0x00, 0x38, 0x13, 0x09 },
+	{ 0xfd, 0xcd, 0x52, 0x72, 0x04, 0x12, 0x44, 0x12, 0x8c, 0x7e, 0x00, 0x00, 0x00, 0x10, 0x91, 0x44 },
+	{ 0x3b, 0x55, 0x9c, 0x9b, 0x02, 0x0b, 0x42, 0x0b, 0x8e, 0x4d, 0x00, 0x00, 0x00, 0x04, 0x2c, 0x79 },
+	{ 0xc2, 0x77, 0xb5, 0xd7, 0x02, 0x07, 0x42, 0x07, 0x8e, 0x31, 0x00, 0x00, 0x00, 0x04, 0x1c, 0x31 },
+	{ 0xec, 0xa8, 0xb8, 0x91, 0x04, 0xe1, 0x44, 0xe1, 0x82, 0x27, 0x00, 0x00, 0x00, 0x17, 0xcd, 0xc1 },
+	{ 0xd3, 0xae, 0x74, 0xe5, 0x07, 0x75, 0x47, 0x75, 0x84, 0x33, 0x00, 0x00, 0x00, 0x37, 0x9b, 0x79 },
+	{ 0x57, 0xde, 0x01, 0x8b, 0x01, 0xfb, 0x41, 0xfb, 0x8d, 0xdd, 0x00, 0x00, 0x00, 0x03, 0xec, 0x19 },
+	{ 0x33, 0xfd, 0xb4, 0xe9, 0x04, 0xb9, 0x44, 0xb9, 0x81, 0x0f, 0x00, 0x00, 0x00, 0x16, 0x4d, 0xb1 },
+	{ 0xd8, 0x43, 0xc7, 0xc3, 0x01, 0xb3, 0x41, 0xb3, 0x8b, 0xe5, 0x00, 0x00, 0x00, 0x02, 0xe3, 0x29 },
+	{ 0x00, 0x2f, 0xf7, 0xc2, 0x02, 0x62, 0x42, 0x62, 0x80, 0xae, 0x00, 0x00, 0x00, 0x05, 0xad, 0x84 },
+	{ 0xc6, 0xd1, 0x63, 0x8b, 0x03, 0xfb, 0x43, 0xfb, 0x8b, 0xdd, 0x00, 0x00, 0x00, 0x0f, 0xd8, 0x19 },
+	{ 0x8f, 0xb7, 0xa2, 0x0f, 0x07, 0xbf, 0x47, 0xbf, 0x86, 0x39, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x81 },
+	{ 0xb1, 0x35, 0x49, 0x61, 0x06, 0xb1, 0x46, 0xb1, 0x8e, 0xd7, 0x00, 0x00, 0x00, 0x2c, 0xc6, 0x61 },
+	{ 0x38, 0xf2, 0xf7, 0x4b, 0x03, 0xbb, 0x43, 0xbb, 0x8a, 0x1d, 0x00, 0x00, 0x00, 0x0d, 0xea, 0x99 },
+	{ 0x79, 0x3d, 0xd6, 0x48, 0x04, 0xc8, 0x44, 0xc8, 0x81, 0x78, 0x00, 0x00, 0x00, 0x16, 0xdc, 0x40 },
+	{ 0x63, 0xa1, 0xbc, 0x1e, 0x07, 0x7e, 0x47, 0x7e, 0x84, 0x72, 0x00, 0x00, 0x00, 0x38, 0x22, 0x04 },
+	{ 0x55, 0x2d, 0x91, 0xe4, 0x05, 0x24, 0x45, 0x24, 0x83, 0xfc, 0x00, 0x00, 0x00, 0x1a, 0x6d, 0x10 },
+	{ 0xf4, 0xae, 0x5a, 0x1e, 0x05, 0x7e, 0x45, 0x7e, 0x86, 0x72, 0x00, 0x00, 0x00, 0x1e, 0x2a, 0x04 },
+	{ 0xb9, 0xa6, 0x87, 0xda, 0x01, 0xfa, 0x41, 0xfa, 0x8d, 0xd6, 0x00, 0x00, 0x00, 0x03, 0xe8, 0x24 },
+	{ 0xd5, 0xc3, 0x4f, 0xde, 0x07, 0x3e, 0x47, 0x3e, 0x82, 0xb2, 0x00, 0x00, 0x00, 0x34, 0x73, 0x04 },
+	{ 0x01, 0x79, 0x46, 0x4b, 0x02, 0xbb, 0x42, 0xbb, 0x83, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x74, 0x99 },
+	{ 0xcd, 0xdb, 0x80, 0xe6, 0x02, 0xc6, 0x42, 0xc6, 0x83, 0x6a, 0x00, 0x00, 0x00, 0x07, 0xb1, 0x24 },
+	{ 0x72, 0x9f, 0x55, 0xd9, 0x00, 0xa9, 0x40, 0xa9, 0x84, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x91 },
+	{ 0x9e, 0x67, 0x71, 0x73, 0x02, 0x63, 0x42, 0x63, 0x80, 0xb5, 0x00, 0x00, 0x00, 0x05, 0xb2, 0x49 },
+	{ 0x1a, 0x55, 0xb7, 0x62, 0x04, 0x02, 0x44, 0x02, 0x8c, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x10, 0x04 },
+	{ 0x5b, 0x6c, 0x22, 0xcf, 0x04, 0x7f, 0x44, 0x7f, 0x8f, 0x79, 0x00, 0x00, 0x00, 0x14, 0x37, 0x01 },
+	{ 0x40, 0x2d, 0x0c, 0x68, 0x04, 0xe8, 0x44, 0xe8, 0x82, 0x58, 0x00, 0x00, 0x00, 0x18, 0x12, 0x40 },
+	{ 0x35, 0x47, 0x03, 0x72, 0x05, 0x12, 0x45, 0x12, 0x83, 0x7e, 0x00, 0x00, 0x00, 0x19, 0xb5, 0x44 },
+	{ 0x7d, 0x37, 0x94, 0x78, 0x01, 0xf8, 0x41, 0xf8, 0x8d, 0xc8, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x40 },
+	{ 0x49, 0x99, 0xcf, 0x13, 0x02, 0x03, 0x42, 0x03, 0x8e, 0x15, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x09 },
+	{ 0x0c, 0x11, 0x84, 0xea, 0x04, 0x0a, 0x44, 0x0a, 0x8c, 0x46, 0x00, 0x00, 0x00, 0x10, 0x50, 0x64 },
+	{ 0x23, 0xa4, 0xa7, 0x78, 0x04, 0xf8, 0x44, 0xf8, 0x82, 0xc8, 0x00, 0x00, 0x00, 0x18, 0xb0, 0x40 },
+	{ 0x35, 0xe2, 0x98, 0x20, 0x02, 0x20, 0x42, 0x20, 0x8e, 0xe0, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00 },
+	{ 0xd1, 0x99, 0x99, 0xec, 0x07, 0xac, 0x47, 0xac, 0x85, 0xb4, 0x00, 0x00, 0x00, 0x3a, 0xdb, 0x90 },
+	{ 0xf9, 0xd3, 0x94, 0x42, 0x06, 0xe2, 0x46, 0xe2, 0x80, 0x2e, 0x00, 0x00, 0x00, 0x2f, 0x5f, 0x84 },
+	{ 0x42, 0x8f, 0xb1, 0xb8, 0x03, 0x38, 0x43, 0x38, 0x86, 0x88, 0x00, 0x00, 0x00, 0x0a, 0x5c, 0x40 },
+	{ 0xae, 0xc0, 0x7e, 0xe4, 0x02, 0x24, 0x42, 0x24, 0x8e, 0xfc, 0x00, 0x00, 0x00, 0x04, 0x95, 0x10 },
+	{ 0x8a, 0xe0, 0x32, 0x42, 0x04, 0xe2, 0x44, 0xe2, 0x82, 0x2e, 0x00, 0x00, 0x00, 0x17, 0xd7, 0x84 },
+	{ 0x80, 0x2a, 0x21, 0x0e, 0x07, 0x6e, 0x47, 0x6e, 0x84, 0x02, 0x00, 0x00, 0x00, 0x37, 0x33, 0x44 },
+	{ 0x51, 0x03, 0xdb, 0xf2, 0x05, 0x92, 0x45, 0x92, 0x86, 0xfe, 0x00, 0x00, 0x00, 0x1f, 0x07, 0x44 },
+	{ 0x48, 0xfe, 0x3a, 0x65, 0x04, 0xf5, 0x44, 0xf5, 0x82, 0xb3, 0x00, 0x00, 0x00, 0x18, 0x92, 0x79 },
+	{ 0xf1, 0xcd, 0xf2, 0xb5, 0x06, 0x45, 0x46, 0x45, 0x8b, 0xe3, 0x00, 0x00, 0x00, 0x27, 0x4e, 0x99 },
+	{ 0x2f, 0x08, 0x72, 0x87, 0x05, 0xb7, 0x45, 0xb7, 0x88, 0x01, 0x00, 0x00, 0x00, 0x20, 0xa8, 0xd1 },
+	{ 0x17, 0x27, 0x85, 0xa2, 0x06, 0x42, 0x46, 0x42, 0x8b, 0xce, 0x00, 0x00, 0x00, 0x27, 0x29, 0x04 },
+	{ 0xf1, 0x9d, 0xfa, 0xf3, 0x03, 0xe3, 0x43, 0xe3, 0x8b, 0x35, 0x00, 0x00, 0x00, 0x0f, 0x1b, 0x49 },
+	{ 0xcd, 0x5d, 0xbe, 0xcd, 0x01, 0xdd, 0x41, 0xdd, 0x8d, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x78, 0xc9 },
+	{ 0x36, 0x12, 0x8f, 0xe2, 0x04, 0x82, 0x44, 0x82, 0x8f, 0x8e, 0x00, 0x00, 0x00, 0x14, 0x52, 0x04 },
+	{ 0xe6, 0x87, 0xfa, 0x3b, 0x01, 0xab, 0x41, 0xab, 0x8b, 0xad, 0x00, 0x00, 0x00, 0x02, 0xc8, 0x39 },
+	{ 0x81, 0xdf, 0x0c, 0x83, 0x02, 0x73, 0x42, 0x73, 0x81, 0x25, 0x00, 0x00, 0x00, 0x05, 0xff, 0xa9 },
+	{ 0x4b, 0xae, 0xaa, 0x0c, 0x01, 0xcc, 0x41, 0xcc, 0x8c, 0x94, 0x00, 0x00, 0x00, 0x03, 0x3a, 0x90 },
+	{ 0x1e, 0x4f, 0x75, 0x92, 0x01, 0x32, 0x41, 0x32, 0x88, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x6d, 0xc4 },
+	{ 0x30, 0xbd, 0x5d, 0xfc, 0x00, 0xbc, 0x40, 0xbc, 0x85, 0x24, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x10 },
+	{ 0x22, 0x5b, 0x58, 0xef, 0x04, 0x9f, 0x44, 0x9f, 0x80, 0x59, 0x00, 0x00, 0x00, 0x15, 0x5a, 0xc1 },
+	{ 0x27, 0x20, 0xa3, 0x8f, 0x01, 0x3f, 0x41, 0x3f, 0x88, 0xb9, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x81 },
+	{ 0x63, 0x71, 0xc4, 0x5c, 0x05, 0x1c, 0x45, 0x1c, 0x83, 0xc4, 0x00, 0x00, 0x00, 0x1a, 0x1b, 0x10 },
+	{ 0xd9, 0xda, 0xe0, 0xa3, 0x00, 0x93, 0x40, 0x93, 0x84, 0x05, 0x00, 0x00, 0x00, 0x00, 0x54, 0x69 },
+	{ 0x1a, 0xa3, 0x81, 0xb9, 0x02, 0x89, 0x42, 0x89, 0x81, 0xbf, 0x00, 0x00, 0x00, 0x06, 0x6d, 0x51 },
+	{ 0x5e, 0x1c, 0x92, 0x76, 0x01, 0x56, 0x41, 0x56, 0x89, 0x5a, 0x00, 0x00, 0x00, 0x01, 0xc8, 0xe4 },
+	{ 0x17, 0x45, 0x58, 0x37, 0x02, 0x67, 0x42, 0x67, 0x80, 0xd1, 0x00, 0x00, 0x00, 0x05, 0xc5, 0x71 },
+	{ 0x82, 0x8c, 0xc6, 0x5e, 0x05, 0xbe, 0x45, 0xbe, 0x88, 0x32, 0x00, 0x00, 0x00, 0x20, 0xf9, 0x04 },
+	{ 0x2a, 0xae, 0xc4, 0xd3, 0x03, 0xc3, 0x43, 0xc3, 0x8a, 0x55, 0x00, 0x00, 0x00, 0x0e, 0x26, 0x89 },
+	{ 0xf4, 0x30, 0x98, 0x05, 0x04, 0x95, 0x44, 0x95, 0x80, 0x13, 0x00, 0x00, 0x00, 0x14, 0xfe, 0xb9 },
+};
+
+uint16_t
+hash(const uint8_t key[16])
+{
+	uint16_t result;
+	static const uint16_t g[4001] = {
+	    0x0000, 0x0722, 0x048c, 0x05b1, 0x0680, 0x0650, 0x00bc, 0x04e6,
+	    0x04f6, 0x0000, 0x0000, 0x0000, 0x06f7, 0x01b2, 0x026d, 0x0000,
+	    0x0000, 0x04d9, 0x0000, 0x03b2, 0x0329, 0x0000, 0x0000, 0x026c,
+	    0x022b, 0x0000, 0x0000, 0x0000, 0x01c9, 0x039c, 0x0621, 0x0007,
+	    0x02f1, 0x04ef, 0x0000, 0x0169, 0x0258, 0x0000, 0x02ee, 0x03c1,
+	    0x02e8, 0x0000, 0x03d4, 0x0372, 0x0000, 0x0268, 0x0322, 0x021b,
+	    0x0000, 0x0000, 0x05a0, 0x0000, 0x02af, 0x0000, 0x0000, 0x0340,
+	    0x0000, 0x06bf, 0x0624, 0x02b7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x04a3, 0x0000, 0x060c, 0x06da, 0x04d1, 0x0155, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0659, 0x0000,
+	    0x0689, 0x0790, 0x0069, 0x04d9, 0x0215, 0x0283, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0496, 0x04ad, 0x00ad, 0x0000, 0x0000, 0x0000,
+	    0x0190, 0x0000, 0x0182, 0x07ab, 0x0623, 0x0000, 0x0686, 0x020b,
+	    0x0330, 0x0692, 0x0000, 0x0691, 0x0000, 0x014a, 0x069c, 0x05ee,
+	    0x0767, 0x0000, 0x0000, 0x0000, 0x0602, 0x0000, 0x0000, 0x0000,
+	    0x044c, 0x0000, 0x0055, 0x00de, 0x0105, 0x0583, 0x0021, 0x0000,
+	    0x0000, 0x038f, 0x0036, 0x0000, 0x0000, 0x0000, 0x0772, 0x021f,
+	    0x05c0, 0x0000, 0x0000, 0x0647, 0x01b8, 0x0000, 0x0000, 0x004d,
+	    0x0000, 0x074d, 0x05d5, 0x07c3, 0x0000, 0x0082, 0x0416, 0x0000,
+	    0x06e7, 0x0575, 0x04c4, 0x02fd, 0x0000, 0x03d3, 0x0000, 0x0000,
+	    0x040f, 0x0000, 0x0000, 0x01c6, 0x0000, 0x01e3, 0x0576, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05d8,
+	    0x0000, 0x05e4, 0x0000, 0x0000, 0x0000, 0x04ce, 0x0315, 0x03a5,
+	    0x01ee, 0x01ff, 0x0000, 0x0000, 0x0256, 0x06e1, 0x0000, 0x05e8,
+	    0x04c6, 0x0000, 0x052f, 0x03d0, 0x0000, 0x0390, 0x0000, 0x05ea,
+	    0x0000, 0x0667, 0x0000, 0x0471, 0x0000, 0x03eb, 0x0037, 0x0058,
+	    0x0121, 0x074e, 0x01b0, 0x01e2, 0x0480, 0x0742, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0769, 0x0381, 0x0082, 0x0000, 0x0623,
+	    0x0393, 0x0039, 0x0000, 0x0243, 0x07b5, 0x0000, 0x04bc, 0x0000,
+	    0x0000, 0x0170, 0x0000, 0x055d, 0x0000, 0x00be, 0x0000, 0x0333,
+	    0x0000, 0x0000, 0x0000, 0x0279, 0x07b5, 0x0000, 0x004a, 0x0416,
+	    0x0000, 0x06d5, 0x0637, 0x0000, 0x0000, 0x0000, 0x0000, 0x02d9,
+	    0x044a, 0x0000, 0x05ac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x043d, 0x0000, 0x0000, 0x02ba, 0x012c, 0x0551,
+	    0x0000, 0x03a7, 0x0238, 0x07bd, 0x06b5, 0x00bf, 0x0000, 0x0000,
+	    0x0000, 0x07a9, 0x075d, 0x0000, 0x0000, 0x0415, 0x0000, 0x0000,
+	    0x0000, 0x0179, 0x0000, 0x0000, 0x06e0, 0x0302, 0x0358, 0x0000,
+	    0x0378, 0x0449, 0x0000, 0x0000, 0x0000, 0x0000, 0x07c9, 0x0000,
+	    0x041f, 0x0000, 0x0000, 0x04bd, 0x06b0, 0x01b8, 0x06f2, 0x0149,
+	    0x0529, 0x0000, 0x0000, 0x0000, 0x0000, 0x000e, 0x0000, 0x0000,
+	    0x028a, 0x025b, 0x0473, 0x0000, 0x0000, 0x0000, 0x036d, 0x05ea,
+	    0x0356, 0x0000, 0x0700, 0x0000, 0x020c, 0x014f, 0x0188, 0x0655,
+	    0x02d6, 0x0562, 0x0000, 0x0094, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0722, 0x0000, 0x03d3, 0x003a,
+	    0x0548, 0x07b8, 0x0000, 0x0000, 0x01aa, 0x0000, 0x0000, 0x0089,
+	    0x05a4, 0x0000, 0x0000, 0x0572, 0x0000, 0x04c6, 0x0000, 0x0000,
+	    0x02b7, 0x0182, 0x0243, 0x007a, 0x0485, 0x05d0, 0x074d, 0x0000,
+	    0x004e, 0x0040, 0x040d, 0x0226, 0x0000, 0x0000, 0x05dc, 0x00f2,
+	    0x04e6, 0x05ad, 0x0000, 0x0000, 0x04d8, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0297, 0x041a, 0x022b, 0x0000, 0x0398, 0x05c2, 0x0000,
+	    0x0085, 0x07b2, 0x07c8, 0x0000, 0x05eb, 0x00bd, 0x05a0, 0x0000,
+	    0x04b2, 0x055e, 0x0000, 0x064f, 0x0000, 0x0000, 0x01c4, 0x055e,
+	    0x0000, 0x0000, 0x052d, 0x01d1, 0x01fe, 0x006d, 0x070c, 0x0282,
+	    0x0000, 0x0412, 0x0000, 0x00dc, 0x0000, 0x05ef, 0x0514, 0x0366,
+	    0x0069, 0x0000, 0x0504, 0x04f4, 0x0000, 0x06b3, 0x0000, 0x0000,
+	    0x0000, 0x0168, 0x052a, 0x0268, 0x0000, 0x0000, 0x01fb, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x060e, 0x0000, 0x06c3, 0x049a, 0x02ce,
+	    0x07c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x045b, 0x00fd, 0x0419,
+	    0x0000, 0x0000, 0x021f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x00e7, 0x0490, 0x0000, 0x021e, 0x0531, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0509, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165,
+	    0x03a6, 0x0000, 0x046a, 0x0000, 0x057e, 0x0078, 0x0000, 0x0000,
+	    0x0000, 0x0390, 0x0000, 0x04e2, 0x0000, 0x02eb, 0x0000, 0x013b,
+	    0x005f, 0x0133, 0x0000, 0x0000, 0x0500, 0x061b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x047d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0072,
+	    0x0000, 0x0663, 0x0484, 0x0000, 0x0000, 0x006a, 0x0000, 0x0000,
+	    0x07b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x035a, 0x0000, 0x00ab,
+	    0x0444, 0x0000, 0x0000, 0x0000, 0x03af, 0x0000, 0x05ee, 0x0402,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0090, 0x0230, 0x0000,
+	    0x02ca, 0x0000, 0x0623, 0x0000, 0x01a5, 0x0285, 0x0000, 0x0000,
+	    0x00fd, 0x0664, 0x0000, 0x0000, 0x0368, 0x03e6, 0x0000, 0x0000,
+	    0x045a, 0x01e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0088,
+	    0x0000, 0x0399, 0x0000, 0x0176, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0768, 0x0369, 0x00f5, 0x05be, 0x0338, 0x0000, 0x036e, 0x016d,
+	    0x0000, 0x0558, 0x0000, 0x018f, 0x0154, 0x022d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x021e, 0x03e1,
+	    0x0000, 0x0000, 0x0000, 0x00d2, 0x0326, 0x0000, 0x078f, 0x0000,
+	    0x0696, 0x0000, 0x07bd, 0x0000, 0x0000, 0x07ca, 0x0000, 0x0474,
+	    0x0000, 0x0000, 0x0508, 0x009d, 0x0000, 0x009f, 0x044c, 0x0000,
+	    0x0374, 0x027d, 0x0560, 0x022b, 0x0000, 0x0000, 0x0000, 0x074b,
+	    0x0000, 0x0596, 0x0315, 0x0000, 0x046f, 0x0000, 0x0000, 0x0187,
+	    0x0000, 0x06fc, 0x0000, 0x0000, 0x0000, 0x035b, 0x0000, 0x05ee,
+	    0x0705, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0405,
+	    0x03e2, 0x03e1, 0x0572, 0x0737, 0x0000, 0x042d, 0x060d, 0x0028,
+	    0x0000, 0x037c, 0x0092, 0x01fd, 0x0000, 0x02bd, 0x0161, 0x01a0,
+	    0x05f1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0254, 0x02b8, 0x0239,
+	    0x01bb, 0x0000, 0x06b0, 0x0000, 0x0000, 0x0000, 0x0171, 0x0130,
+	    0x0354, 0x000e, 0x0497, 0x0000, 0x0000, 0x0425, 0x0125, 0x0546,
+	    0x065f, 0x0722, 0x0000, 0x03c3, 0x0000, 0x0000, 0x0000, 0x06e5,
+	    0x060a, 0x01dc, 0x0781, 0x05d9, 0x0503, 0x06ce, 0x0000, 0x00a0,
+	    0x0166, 0x015d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0625,
+	    0x0000, 0x0000, 0x078a, 0x044f, 0x0000, 0x04fb, 0x0000, 0x03d3,
+	    0x0000, 0x0000, 0x04e2, 0x0000, 0x0022, 0x060f, 0x0010, 0x070d,
+	    0x0000, 0x0247, 0x0388, 0x0000, 0x04ca, 0x0676, 0x0692, 0x0000,
+	    0x0000, 0x0139, 0x051d, 0x0000, 0x0000, 0x0120, 0x0000, 0x0540,
+	    0x05e6, 0x0320, 0x0000, 0x0000, 0x0000, 0x0000, 0x05cf, 0x0635,
+	    0x05db, 0x0000, 0x0000, 0x0000, 0x0000, 0x044a, 0x0272, 0x014b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x05cf, 0x0000, 0x0000, 0x061b,
+	    0x0000, 0x0000, 0x032f, 0x0000, 0x0000, 0x0000, 0x04ae, 0x00d8,
+	    0x023e, 0x0000, 0x0717, 0x0290, 0x05a3, 0x0000, 0x02c4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x018e, 0x0795, 0x0000, 0x0635,
+	    0x0000, 0x079d, 0x0000, 0x0783, 0x0382, 0x0000, 0x0000, 0x0453,
+	    0x0000, 0x0000, 0x00a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x010d,
+	    0x0000, 0x0072, 0x0160, 0x0000, 0x0000, 0x00d1, 0x056c, 0x0000,
+	    0x0000, 0x0014, 0x0000, 0x0000, 0x0000, 0x03a5, 0x0201, 0x077e,
+	    0x0000, 0x0675, 0x04b5, 0x0000, 0x023e, 0x0000, 0x0000, 0x0000,
+	    0x0244, 0x0000, 0x05ed, 0x01c1, 0x03fc, 0x0000, 0x00c2, 0x0094,
+	    0x0000, 0x068c, 0x03c3, 0x04e3, 0x0000, 0x04d6, 0x01e7, 0x03e0,
+	    0x0000, 0x011b, 0x0000, 0x0013, 0x0000, 0x0000, 0x0000, 0x068a,
+	    0x035a, 0x05a4, 0x0000, 0x0000, 0x04c9, 0x00d8, 0x0000, 0x079a,
+	    0x0000, 0x0000, 0x0000, 0x069d, 0x0000, 0x0690, 0x0000, 0x0031,
+	    0x0763, 0x0000, 0x0000, 0x0000, 0x0000, 0x0195, 0x0000, 0x0400,
+	    0x006c, 0x074e, 0x0000, 0x05d8, 0x0000, 0x0640, 0x022e, 0x0000,
+	    0x06c3, 0x0000, 0x069a, 0x0000, 0x0145, 0x0000, 0x046e, 0x0341,
+	    0x0000, 0x021a, 0x071c, 0x0000, 0x052c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0341, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x073b, 0x0791, 0x06fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0657,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0616,
+	    0x0731, 0x02cd, 0x0000, 0x04d2, 0x0648, 0x0000, 0x0027, 0x0756,
+	    0x031a, 0x0328, 0x0000, 0x0000, 0x0464, 0x06cb, 0x0000, 0x0000,
+	    0x0545, 0x033f, 0x014e, 0x009d, 0x0339, 0x031e, 0x009b, 0x0284,
+	    0x07c1, 0x0000, 0x02c2, 0x0000, 0x078f, 0x006e, 0x0000, 0x0000,
+	    0x0000, 0x0251, 0x0000, 0x04d9, 0x0731, 0x0000, 0x0000, 0x0000,
+	    0x0356, 0x0000, 0x007b, 0x0000, 0x0000, 0x0000, 0x047f, 0x0012,
+	    0x049c, 0x0000, 0x0642, 0x0000, 0x032e, 0x0000, 0x0585, 0x00f9,
+	    0x0651, 0x0000, 0x0000, 0x0745, 0x0000, 0x0000, 0x0000, 0x0442,
+	    0x00ee, 0x02f4, 0x07c0, 0x0397, 0x051b, 0x0000, 0x02a1, 0x047a,
+	    0x02e8, 0x0000, 0x052e, 0x019c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x064a, 0x0000, 0x067b, 0x0000, 0x06dc, 0x0000,
+	    0x0000, 0x0249, 0x07c1, 0x0316, 0x0000, 0x0362, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x06c4, 0x018c, 0x0086, 0x0536, 0x0000,
+	    0x0000, 0x00b0, 0x06de, 0x0000, 0x0000, 0x063f, 0x0000, 0x0000,
+	    0x0750, 0x06f8, 0x0417, 0x01c4, 0x0000, 0x05e4, 0x0000, 0x01d7,
+	    0x0000, 0x0171, 0x0315, 0x0000, 0x0000, 0x01e9, 0x0027, 0x04cf,
+	    0x01d1, 0x0000, 0x0361, 0x0000, 0x0581, 0x0000, 0x0740, 0x0165,
+	    0x0000, 0x0000, 0x0000, 0x03ca, 0x0000, 0x05ea, 0x0076, 0x03f2,
+	    0x0000, 0x0518, 0x0000, 0x0000, 0x0000, 0x00ae, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02d0, 0x0000, 0x0166, 0x0171, 0x07af, 0x0632,
+	    0x0712, 0x0000, 0x0000, 0x01c9, 0x0543, 0x0253, 0x0000, 0x0000,
+	    0x0571, 0x0000, 0x0000, 0x0000, 0x041a, 0x007a, 0x004b, 0x0000,
+	    0x0000, 0x0000, 0x0303, 0x0000, 0x0000, 0x06a9, 0x06cc, 0x0000,
+	    0x04a5, 0x06f9, 0x0000, 0x05b2, 0x0000, 0x0424, 0x0442, 0x025a,
+	    0x0612, 0x070b, 0x06e7, 0x0610, 0x0496, 0x0385, 0x017a, 0x000a,
+	    0x0601, 0x0000, 0x0131, 0x02c0, 0x0000, 0x0298, 0x0000, 0x059b,
+	    0x0000, 0x05c9, 0x0087, 0x03ee, 0x0278, 0x0000, 0x0464, 0x0000,
+	    0x0000, 0x061c, 0x0607, 0x0000, 0x04b5, 0x0318, 0x0000, 0x0000,
+	    0x0289, 0x0000, 0x0047, 0x0000, 0x0530, 0x05c1, 0x0000, 0x0000,
+	    0x0000, 0x018f, 0x01bf, 0x02a8, 0x05ca, 0x0637, 0x03c7, 0x0000,
+	    0x0000, 0x05b1, 0x0000, 0x0000, 0x0000, 0x06f4, 0x0388, 0x0291,
+	    0x0246, 0x01f1, 0x0120, 0x0266, 0x0000, 0x0000, 0x0000, 0x0505,
+	    0x0000, 0x0322, 0x06df, 0x0000, 0x0000, 0x02b7, 0x0433, 0x02c5,
+	    0x0000, 0x0000, 0x0679, 0x03a2, 0x0000, 0x0444, 0x0381, 0x0216,
+	    0x0000, 0x0000, 0x0000, 0x043f, 0x0097, 0x0000, 0x0196, 0x0000,
+	    0x0568, 0x0287, 0x034d, 0x0000, 0x0000, 0x047e, 0x0000, 0x0798,
+	    0x0000, 0x00a0, 0x0000, 0x04b1, 0x0000, 0x02cd, 0x015a, 0x0447,
+	    0x059d, 0x03fa, 0x0341, 0x0000, 0x0728, 0x0269, 0x0000, 0x0453,
+	    0x06f1, 0x0000, 0x0646, 0x07a8, 0x0000, 0x0473, 0x0000, 0x0000,
+	    0x0363, 0x012a, 0x0000, 0x033a, 0x0000, 0x067b, 0x0330, 0x04d2,
+	    0x0790, 0x0000, 0x0616, 0x03a1, 0x01bd, 0x0529, 0x0096, 0x0574,
+	    0x06eb, 0x0200, 0x0000, 0x00cb, 0x02a5, 0x0397, 0x0000, 0x0000,
+	    0x0148, 0x0000, 0x05aa, 0x0000, 0x042c, 0x0000, 0x0101, 0x0000,
+	    0x0000, 0x07ac, 0x0432, 0x0000, 0x0126, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x010f, 0x0009, 0x0000, 0x0000, 0x0000, 0x0245, 0x0135,
+	    0x0136, 0x0000, 0x0792, 0x0375, 0x0000, 0x0380, 0x01ba, 0x0000,
+	    0x06b1, 0x0000, 0x0000, 0x06f3, 0x0000, 0x0000, 0x0000, 0x006c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x003c, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02f6, 0x0000, 0x0000, 0x0000, 0x062f, 0x0000, 0x0000,
+	    0x0000, 0x011a, 0x0000, 0x0000, 0x00fa, 0x0000, 0x0000, 0x0387,
+	    0x0000, 0x05aa, 0x02b3, 0x0000, 0x056f, 0x0343, 0x0000, 0x0000,
+	    0x01e5, 0x02e1, 0x0122, 0x0000, 0x0000, 0x02a4, 0x0589, 0x0000,
+	    0x060b, 0x03e7, 0x0510, 0x0000, 0x0704, 0x01d7, 0x00d6, 0x00f5,
+	    0x0000, 0x0651, 0x0000, 0x0008, 0x036d, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0060, 0x02e0, 0x042f, 0x0247, 0x0000,
+	    0x06f9, 0x0255, 0x0500, 0x0000, 0x06b9, 0x001b, 0x02d4, 0x0000,
+	    0x0000, 0x0000, 0x072c, 0x0000, 0x0776, 0x00d9, 0x01ed, 0x014a,
+	    0x0169, 0x0000, 0x0000, 0x0000, 0x0000, 0x06b2, 0x050b, 0x0000,
+	    0x0000, 0x075d, 0x06e5, 0x0000, 0x01c5, 0x06f3, 0x0000, 0x03f6,
+	    0x025c, 0x04ae, 0x0000, 0x0268, 0x0000, 0x05e7, 0x068c, 0x0000,
+	    0x01c4, 0x06ca, 0x044c, 0x01e6, 0x0000, 0x0000, 0x0000, 0x004e,
+	    0x027a, 0x0000, 0x0000, 0x0000, 0x027b, 0x0000, 0x071a, 0x0000,
+	    0x02b5, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x0000, 0x0000,
+	    0x05ec, 0x0506, 0x0000, 0x0209, 0x0000, 0x062a, 0x06ee, 0x0000,
+	    0x0000, 0x0516, 0x0251, 0x0000, 0x0000, 0x0000, 0x0000, 0x04c1,
+	    0x0000, 0x0000, 0x0000, 0x0388, 0x0000, 0x030d, 0x032e, 0x058d,
+	    0x0000, 0x0099, 0x0000, 0x01f1, 0x0000, 0x00e1, 0x0000, 0x02f4,
+	    0x01c0, 0x0000, 0x04d6, 0x01fe, 0x0000, 0x0000, 0x0000, 0x062f,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x070f, 0x0000, 0x037c,
+	    0x078e, 0x05af, 0x036f, 0x0000, 0x0393, 0x0261, 0x0000, 0x05f8,
+	    0x0000, 0x0014, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x021e, 0x0257, 0x0572, 0x0000, 0x06b5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0001, 0x01b9, 0x0000, 0x0000, 0x014c, 0x0000,
+	    0x0129, 0x072b, 0x0000, 0x0590, 0x037c, 0x0000, 0x0000, 0x0000,
+	    0x00b8, 0x0413, 0x0000, 0x04a7, 0x0000, 0x0000, 0x0700, 0x0000,
+	    0x0000, 0x0000, 0x02e3, 0x03a0, 0x0000, 0x0702, 0x04f3, 0x0066,
+	    0x0000, 0x030f, 0x065b, 0x0000, 0x05ac, 0x06c7, 0x04c9, 0x068d,
+	    0x0322, 0x04aa, 0x03b1, 0x062d, 0x02a2, 0x0191, 0x0000, 0x0000,
+	    0x0000, 0x0520, 0x069c, 0x03b1, 0x0000, 0x0181, 0x0000, 0x0000,
+	    0x0000, 0x045e, 0x02c5, 0x0000, 0x0000, 0x049c, 0x0000, 0x01f8,
+	    0x0000, 0x02aa, 0x007c, 0x0651, 0x0000, 0x02a0, 0x0000, 0x0000,
+	    0x0000, 0x0389, 0x0000, 0x0000, 0x021d, 0x013b, 0x0560, 0x0000,
+	    0x0000, 0x0000, 0x0556, 0x01de, 0x0000, 0x0000, 0x0000, 0x02eb,
+	    0x0000, 0x0000, 0x0557, 0x0402, 0x0143, 0x0000, 0x0000, 0x012f,
+	    0x05e4, 0x0000, 0x02f3, 0x0461, 0x0000, 0x0076, 0x0000, 0x0032,
+	    0x0649, 0x067c, 0x0000, 0x0000, 0x0267, 0x03a2, 0x0262, 0x0338,
+	    0x0000, 0x0000, 0x0379, 0x05a7, 0x0357, 0x0000, 0x0000, 0x029f,
+	    0x0442, 0x0000, 0x01aa, 0x020f, 0x0000, 0x0000, 0x0000, 0x066e,
+	    0x0000, 0x0000, 0x0311, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x06b2, 0x0000, 0x0000, 0x002a, 0x0000, 0x00c8, 0x0438, 0x0000,
+	    0x0000, 0x0000, 0x05b1, 0x034a, 0x04f6, 0x0000, 0x0156, 0x0000,
+	    0x0000, 0x00a8, 0x0098, 0x0000, 0x0000, 0x04d9, 0x04e9, 0x06da,
+	    0x05fb, 0x0000, 0x01f9, 0x0000, 0x0298, 0x0000, 0x0035, 0x0570,
+	    0x0000, 0x0000, 0x0000, 0x046c, 0x0000, 0x0000, 0x0491, 0x02ac,
+	    0x0000, 0x0000, 0x03cf, 0x07b4, 0x072b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x027e, 0x01bb, 0x0680, 0x0000, 0x03e8,
+	    0x00c9, 0x02ce, 0x0000, 0x0000, 0x0000, 0x03bb, 0x0000, 0x0000,
+	    0x0426, 0x0000, 0x0000, 0x02e9, 0x05f1, 0x0000, 0x0343, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0312,
+	    0x0436, 0x0667, 0x0000, 0x0000, 0x0000, 0x0000, 0x03ac, 0x0000,
+	    0x0000, 0x0604, 0x0355, 0x021b, 0x0000, 0x0000, 0x00dd, 0x024c,
+	    0x0000, 0x0179, 0x0485, 0x0559, 0x04b0, 0x01d2, 0x00f1, 0x034a,
+	    0x019b, 0x03ad, 0x0000, 0x024a, 0x0000, 0x02b0, 0x02f1, 0x078d,
+	    0x03c9, 0x0000, 0x0688, 0x0000, 0x0000, 0x018e, 0x0210, 0x02cb,
+	    0x038f, 0x0207, 0x06af, 0x0000, 0x0000, 0x00e7, 0x0789, 0x0000,
+	    0x0000, 0x0000, 0x0270, 0x0299, 0x0000, 0x0529, 0x04ca, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0757,
+	    0x0000, 0x0000, 0x0521, 0x0000, 0x0000, 0x0269, 0x0000, 0x0000,
+	    0x0000, 0x03d4, 0x044d, 0x0000, 0x071a, 0x0000, 0x0729, 0x01bb,
+	    0x0585, 0x0000, 0x0000, 0x0095, 0x0000, 0x0000, 0x0448, 0x0000,
+	    0x070f, 0x03d1, 0x0000, 0x0000, 0x0000, 0x056a, 0x02e0, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x04b6, 0x0000, 0x02d9, 0x0000,
+	    0x0713, 0x0529, 0x04b1, 0x0000, 0x062d, 0x0584, 0x0595, 0x0000,
+	    0x0193, 0x0000, 0x077f, 0x0000, 0x0000, 0x0314, 0x0780, 0x01fa,
+	    0x0000, 0x0000, 0x068a, 0x0411, 0x0000, 0x0000, 0x0000, 0x05b8,
+	    0x02c4, 0x0000, 0x0000, 0x0000, 0x000b, 0x0000, 0x053e, 0x05c0,
+	    0x0408, 0x0000, 0x05d5, 0x0000, 0x0551, 0x0793, 0x0000, 0x05c6,
+	    0x0398, 0x0478, 0x0000, 0x0518, 0x0120, 0x00b4, 0x0658, 0x0000,
+	    0x04b5, 0x0000, 0x0000, 0x04fd, 0x0000, 0x02b6, 0x0124, 0x0000,
+	    0x06de, 0x0000, 0x0000, 0x0000, 0x0000, 0x04ab, 0x0000, 0x0360,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0560, 0x0000, 0x0000, 0x0000,
+	    0x01ce, 0x010a, 0x0000, 0x0000, 0x0253, 0x0067, 0x0000, 0x0000,
+	    0x0583, 0x0000, 0x0214, 0x0000, 0x00bb, 0x0000, 0x0000, 0x04bc,
+	    0x069b, 0x0018, 0x00fe, 0x0000, 0x0000, 0x00a7, 0x0000, 0x0000,
+	    0x0000, 0x02bb, 0x0000, 0x0000, 0x03d6, 0x0000, 0x0500, 0x0000,
+	    0x0000, 0x01ef, 0x040a, 0x0524, 0x0000, 0x008e, 0x0000, 0x0000,
+	    0x0000, 0x06e0, 0x0000, 0x0000, 0x0000, 0x0527, 0x020e, 0x04ff,
+	    0x0000, 0x020d, 0x0000, 0x0000, 0x0731, 0x0284, 0x0000, 0x0000,
+	    0x0615, 0x0000, 0x0000, 0x02fb, 0x0000, 0x025e, 0x02e5, 0x04e0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x027e, 0x0000, 0x02cc, 0x0000,
+	    0x03bd, 0x0206, 0x0000, 0x01cf, 0x0000, 0x0000, 0x038d, 0x0000,
+	    0x0000, 0x05f3, 0x019e, 0x0000, 0x00c0, 0x051a, 0x0000, 0x067b,
+	    0x0000, 0x0044, 0x01b3, 0x0000, 0x0728, 0x0000, 0x04d5, 0x0000,
+	    0x03e4, 0x010c, 0x0000, 0x0000, 0x0000, 0x00e8, 0x0149, 0x06d2,
+	    0x0000, 0x0000, 0x01b3, 0x022f, 0x0000, 0x0782, 0x0000, 0x0000,
+	    0x0000, 0x04d4, 0x021f, 0x0274, 0x021e, 0x0000, 0x0000, 0x0641,
+	    0x03fb, 0x0000, 0x0000, 0x0000, 0x0446, 0x051c, 0x0000, 0x0000,
+	    0x0000, 0x02da, 0x0000, 0x0000, 0x0286, 0x0000, 0x075e, 0x0000,
+	    0x0000, 0x0600, 0x0000, 0x0420, 0x02c6, 0x0000, 0x0000, 0x0000,
+	    0x049e, 0x0000, 0x0000, 0x0000, 0x045b, 0x003f, 0x0000, 0x0000,
+	    0x0000, 0x04f2, 0x0000, 0x064c, 0x0000, 0x0000, 0x0512, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0504, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04fa, 0x028d, 0x002d, 0x01c4, 0x0000,
+	    0x00f6, 0x003b, 0x05d8, 0x0524, 0x0000, 0x0111, 0x0460, 0x06c2,
+	    0x0000, 0x0000, 0x026b, 0x06e7, 0x0044, 0x0000, 0x00f0, 0x0000,
+	    0x0000, 0x0000, 0x0204, 0x035b, 0x0779, 0x0000, 0x0000, 0x05bf,
+	    0x0000, 0x06f0, 0x065d, 0x0000, 0x0655, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0229, 0x06fd, 0x0000, 0x02f0, 0x01c8, 0x04f7, 0x028f,
+	    0x044a, 0x02c4, 0x07c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x06f9,
+	    0x0001, 0x0000, 0x0150, 0x0000, 0x0000, 0x0000, 0x0000, 0x0512,
+	    0x0000, 0x0799, 0x0000, 0x0287, 0x013e, 0x0642, 0x00d8, 0x0000,
+	    0x0343, 0x054d, 0x01ee, 0x0000, 0x000e, 0x07b6, 0x0348, 0x0000,
+	    0x0738, 0x0065, 0x0610, 0x07b9, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x03ed, 0x0000, 0x05d7, 0x0266, 0x00d5, 0x00cf, 0x03ba, 0x034c,
+	    0x0000, 0x0000, 0x0749, 0x0435, 0x0185, 0x0000, 0x0000, 0x0193,
+	    0x0113, 0x05b4, 0x0000, 0x0000, 0x061c, 0x0000, 0x01da, 0x03c1,
+	    0x0000, 0x0000, 0x05fc, 0x034e, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x07cf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0342, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0526, 0x05ac, 0x0000, 0x0000, 0x0000,
+	    0x0468, 0x047a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0499, 0x0232, 0x05ac, 0x0633, 0x069f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x018c, 0x05f4, 0x060c, 0x03b6, 0x037b, 0x0133,
+	    0x0242, 0x0000, 0x0546, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0316, 0x0429, 0x0000, 0x06bc, 0x0241, 0x0000, 0x0595, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0736, 0x0391, 0x0270, 0x0000, 0x0000,
+	    0x0000, 0x0209, 0x0000, 0x0000, 0x0257, 0x0000, 0x00c9, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02e8, 0x0000, 0x0000,
+	    0x0292, 0x0000, 0x045b, 0x0000, 0x0000, 0x0000, 0x058f, 0x03ef,
+	    0x0000, 0x0144, 0x00ab, 0x0000, 0x0468, 0x04f6, 0x04ee, 0x0000,
+	    0x013a, 0x0000, 0x0000, 0x00f3, 0x0284, 0x0314, 0x0000, 0x060f,
+	    0x07a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e3, 0x0008, 0x0000,
+	    0x0000, 0x073e, 0x0000, 0x0000, 0x0296, 0x0000, 0x044b, 0x0000,
+	    0x0698, 0x0000, 0x04f1, 0x0000, 0x0000, 0x0408, 0x00f0, 0x03ca,
+	    0x00df, 0x05ca, 0x0000, 0x0000, 0x0000, 0x00f8, 0x06bb, 0x0000,
+	    0x0000, 0x0000, 0x04a9, 0x0000, 0x03fe, 0x0000, 0x0000, 0x0523,
+	    0x0011, 0x03bb, 0x0000, 0x005d, 0x045b, 0x00e1, 0x0000, 0x0621,
+	    0x0138, 0x0000, 0x0000, 0x03a9, 0x03c1, 0x07c4, 0x047d, 0x0302,
+	    0x04a9, 0x0000, 0x0000, 0x0524, 0x0000, 0x0378, 0x0000, 0x0000,
+	    0x0000, 0x0460, 0x0728, 0x0000, 0x0000, 0x0000, 0x0397, 0x0000,
+	    0x0000, 0x033f, 0x0000, 0x0000, 0x0060, 0x069a, 0x0000, 0x0000,
+	    0x01dd, 0x0000, 0x0048, 0x025d, 0x04ba, 0x0000, 0x0000, 0x03e0,
+	    0x0000, 0x0000, 0x01ac, 0x05d8, 0x0000, 0x0000, 0x001b, 0x06bc,
+	    0x0310, 0x0000, 0x0000, 0x0000, 0x02a3, 0x0000, 0x06d9, 0x0000,
+	    0x0000, 0x01e8, 0x04c5, 0x073c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0346, 0x0000, 0x028b, 0x0508, 0x0000, 0x01ef, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0575, 0x0435, 0x0000, 0x07a4, 0x01d1, 0x01d6,
+	    0x0601, 0x0000, 0x0000, 0x0000, 0x0000, 0x03de, 0x06b6, 0x0000,
+	    0x0152, 0x0000, 0x0000, 0x010b, 0x0000, 0x0000, 0x0000, 0x029d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02de, 0x0000,
+	    0x0000, 0x04c6, 0x0518, 0x079e, 0x0400, 0x004b, 0x0000, 0x02b8,
+	    0x0000, 0x03b3, 0x05fd, 0x00fa, 0x0000, 0x0000, 0x064a, 0x0000,
+	    0x0000, 0x0000, 0x003a, 0x0000, 0x0000, 0x0000, 0x0696, 0x06b9,
+	    0x0125, 0x0689, 0x0237, 0x05e5, 0x0000, 0x00c6, 0x00ba, 0x0000,
+	    0x0000, 0x0000, 0x0147, 0x0754, 0x066e, 0x07ac, 0x0000, 0x0000,
+	    0x006d, 0x025d, 0x0000, 0x0000, 0x0381, 0x0000, 0x0569, 0x0000,
+	    0x07aa, 0x0000, 0x0020, 0x0197, 0x0643, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0517, 0x0000, 0x04ec, 0x0000, 0x0000, 0x07c4,
+	    0x0000, 0x0693, 0x0000, 0x0757, 0x00ce, 0x04e1, 0x076a, 0x0000,
+	    0x0282, 0x03b6, 0x0000, 0x0251, 0x0000, 0x026b, 0x0095, 0x052b,
+	    0x0000, 0x0000, 0x0412, 0x0000, 0x0000, 0x0125, 0x009d, 0x00ef,
+	    0x0741, 0x0000, 0x07c1, 0x0000, 0x0000, 0x0000, 0x01fc, 0x0078,
+	    0x0000, 0x0000, 0x013c, 0x04e5, 0x04cd, 0x0000, 0x0000, 0x0000,
+	    0x00d6, 0x0256, 0x0000, 0x0000, 0x01d6, 0x0556, 0x02f1, 0x0000,
+	    0x04a0, 0x0000, 0x0000, 0x02c2, 0x0702, 0x01a6, 0x0000, 0x0000,
+	    0x0506, 0x06d2, 0x0627, 0x01f2, 0x0000, 0x0028, 0x0000, 0x0000,
+	    0x05f0, 0x0000, 0x0000, 0x006e, 0x062d, 0x0000, 0x0000, 0x00bb,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x077a, 0x0000, 0x0000,
+	    0x0000, 0x05a1, 0x0000, 0x0243, 0x0031, 0x0603, 0x0777, 0x0000,
+	    0x0000, 0x03f5, 0x0000, 0x0000, 0x041a, 0x04dc, 0x0000, 0x030c,
+	    0x0000, 0x00cf, 0x0023, 0x0008, 0x0000, 0x0000, 0x00c3, 0x076b,
+	    0x0000, 0x0796, 0x00e8, 0x0000, 0x0283, 0x0000, 0x0000, 0x063d,
+	    0x03cc, 0x0000, 0x05eb, 0x0587, 0x0000, 0x0595, 0x0000, 0x01f4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x071a, 0x0000, 0x0503, 0x022e,
+	    0x05d3, 0x0000, 0x019c, 0x0731, 0x013a, 0x0000, 0x0511, 0x0000,
+	    0x066d, 0x0284, 0x05ab, 0x0000, 0x0000, 0x0000, 0x01d3, 0x0000,
+	    0x0000, 0x0000, 0x0200, 0x06ba, 0x05ec, 0x0000, 0x0000, 0x000c,
+	    0x00a5, 0x0498, 0x016b, 0x0732, 0x06dd, 0x03f5, 0x0000, 0x0000,
+	    0x03c3, 0x0207, 0x072d, 0x0000, 0x0000, 0x0000, 0x06f8, 0x0000,
+	    0x03b4, 0x01f9, 0x019d, 0x0000, 0x03c5, 0x0771, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02b8, 0x01ed, 0x0000, 0x01ad, 0x0000, 0x013d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0079, 0x05a7, 0x00d1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01b3, 0x05d5, 0x020e, 0x0488, 0x076f,
+	    0x0000, 0x0000, 0x0608, 0x02c3, 0x0000, 0x05d4, 0x0000, 0x0000,
+	    0x017a, 0x0000, 0x03f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0511,
+	    0x0000, 0x0000, 0x02c3, 0x0000, 0x0000, 0x044f, 0x0188, 0x0000,
+	    0x03a6, 0x0254, 0x0000, 0x05c9, 0x0000, 0x042c, 0x0000, 0x0106,
+	    0x0720, 0x0772, 0x0000, 0x0000, 0x0000, 0x0000, 0x050c, 0x02bd,
+	    0x0000, 0x078f, 0x0692, 0x0000, 0x0738, 0x0000, 0x0290, 0x0000,
+	    0x054c, 0x0000, 0x0210, 0x0000, 0x0000, 0x0000, 0x0478, 0x0254,
+	    0x0000, 0x01df, 0x0000, 0x03db, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0017, 0x0000, 0x00a3, 0x05e6, 0x0000, 0x0456, 0x045d,
+	    0x0000, 0x0276, 0x02b2, 0x0000, 0x0000, 0x0000, 0x0182, 0x062e,
+	    0x04f1, 0x004a, 0x01a5, 0x0000, 0x055a, 0x0000, 0x0000, 0x056c,
+	    0x0000, 0x0000, 0x019b, 0x022a, 0x0000, 0x058e, 0x0128, 0x01d4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x068c, 0x000a, 0x052e, 0x05bc,
+	    0x0537, 0x0000, 0x0000, 0x0000, 0x034b, 0x0000, 0x0000, 0x03dd,
+	    0x0000, 0x0000, 0x0000, 0x05f7, 0x0374, 0x042f, 0x01b2, 0x0000,
+	    0x017b, 0x0000, 0x0000, 0x0612, 0x0000, 0x055f, 0x00bb, 0x0000,
+	    0x0000, 0x0720, 0x0000, 0x0000, 0x0000, 0x0087, 0x011e, 0x050d,
+	    0x0015, 0x043e, 0x0731, 0x035c, 0x0109, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0267, 0x0462, 0x0000, 0x0000, 0x0000, 0x000d, 0x069d,
+	    0x0000, 0x00d0, 0x0000, 0x04c7, 0x0104, 0x077f, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x060b, 0x0000, 0x00ba, 0x0000, 0x028a,
+	    0x067d, 0x00f9, 0x0545, 0x052e, 0x01a1, 0x03e2, 0x0774, 0x01eb,
+	    0x06c7, 0x039e, 0x0000, 0x0000, 0x010e, 0x0000, 0x01f4, 0x0000,
+	    0x0435, 0x00c1, 0x0078, 0x0000, 0x0474, 0x05c4, 0x0196, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0309, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0788, 0x0000, 0x0000, 0x053d, 0x05ac,
+	    0x0000, 0x0000, 0x06d4, 0x0000, 0x0691, 0x0000, 0x069e, 0x071b,
+	    0x03c6, 0x0000, 0x009c, 0x068f, 0x0000, 0x0000, 0x0501, 0x0000,
+	    0x0000, 0x0000, 0x01a9, 0x0102, 0x0000, 0x0374, 0x005a, 0x0750,
+	    0x0000, 0x0000, 0x0000, 0x05cb, 0x0000, 0x0000, 0x0000, 0x034f,
+	    0x029b, 0x0000, 0x0000, 0x0000, 0x063d, 0x024d, 0x031f, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02d0, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01a7, 0x07bf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0550,
+	    0x047c, 0x0782, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0101, 0x0105, 0x035b, 0x022f, 0x0000, 0x06a1, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0462, 0x04a9, 0x01c0, 0x0000,
+	    0x0000, 0x0000, 0x026d, 0x0000, 0x016c, 0x0674, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04cd, 0x0000, 0x0000, 0x029e, 0x0689, 0x0376,
+	    0x0000, 0x05d6, 0x0000, 0x0000, 0x0547, 0x02d6, 0x013b, 0x0765,
+	    0x01b1, 0x0103, 0x0045, 0x0000, 0x0695, 0x0000, 0x0000, 0x065b,
+	    0x0000, 0x0000, 0x011f, 0x05a9, 0x0000, 0x0301, 0x032c, 0x0138,
+	    0x03cd, 0x0632, 0x0560, 0x07a2, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0536, 0x0000, 0x0000, 0x0000, 0x0000, 0x0118, 0x0048,
+	    0x0000, 0x0000, 0x0000, 0x0185, 0x0322, 0x0000, 0x0000, 0x0000,
+	    0x0488, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000, 0x0707, 0x0000,
+	    0x0000, 0x0000, 0x0074, 0x0000, 0x0000, 0x06c5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03e8, 0x0354, 0x06a8,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x01d1, 0x0000, 0x0699, 0x0000,
+	    0x005b, 0x0000, 0x02ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x07c9,
+	    0x00d1, 0x0000, 0x01be, 0x0000, 0x00e9, 0x03d2, 0x02ab, 0x0576,
+	    0x009a, 0x001a, 0x0049, 0x048c, 0x0000, 0x0638, 0x014f, 0x0455,
+	    0x0000, 0x0000, 0x0000, 0x035f, 0x0479, 0x0233, 0x0000, 0x022c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x04ed, 0x0000, 0x0000, 0x059a,
+	    0x0000, 0x01ce, 0x0392, 0x0000, 0x0000, 0x02e5, 0x0000, 0x0000,
+	    0x0000, 0x0647, 0x0000, 0x0587, 0x0424, 0x06cc, 0x0000, 0x0000,
+	    0x0000, 0x059a, 0x0000, 0x02d5, 0x01d5, 0x03a5, 0x06ed, 0x0000,
+	    0x0000, 0x041b, 0x03d4, 0x0000, 0x0203, 0x06a0, 0x0378, 0x0000,
+	    0x0000, 0x05a1, 0x0000, 0x0000, 0x037a, 0x0000, 0x0237, 0x036d,
+	    0x0000, 0x0000, 0x05d0, 0x0052, 0x03dd, 0x074f, 0x0000, 0x013f,
+	    0x0000, 0x0000, 0x0000, 0x0443, 0x0000, 0x0258, 0x0000, 0x0000,
+	    0x0000, 0x06f6, 0x0000, 0x0000, 0x065b, 0x0000, 0x03c9, 0x0000,
+	    0x0352, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06c0,
+	    0x04b0, 0x0000, 0x0000, 0x0473, 0x0000, 0x0063, 0x03b5, 0x02f9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06fc, 0x0489, 0x04f0,
+	    0x0000, 0x0000, 0x0000, 0x057d, 0x0000, 0x0151, 0x0000, 0x0045,
+	    0x0000, 0x0523, 0x0000, 0x0000, 0x0000, 0x0405, 0x0000, 0x05e0,
+	    0x06d5, 0x0000, 0x016a, 0x0000, 0x0455, 0x0542, 0x0000, 0x0459,
+	    0x0112, 0x0000, 0x0000, 0x01a6, 0x042e, 0x0000, 0x0000, 0x0154,
+	    0x0461, 0x0653, 0x0293, 0x0000, 0x0000, 0x04a7, 0x04aa, 0x0000,
+	    0x0017, 0x05b5, 0x06c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ce,
+	    0x0000, 0x0000, 0x0000, 0x0326, 0x06d4, 0x0000, 0x02c9, 0x0000,
+	    0x063c, 0x0000, 0x0000, 0x0550, 0x070d, 0x0000, 0x0000, 0x0476,
+	    0x018c, 0x0000, 0x0000, 0x066d, 0x0726, 0x0000, 0x0000, 0x051d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05d9,
+	    0x01ca, 0x0642, 0x013b, 0x030d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x066c, 0x0000, 0x0640, 0x0000, 0x05cc, 0x0000, 0x0000, 0x0797,
+	    0x0000, 0x04dd, 0x0000, 0x0000, 0x0655, 0x0711, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0211, 0x02e4, 0x01e6, 0x0206, 0x0000, 0x0512,
+	    0x00ee, 0x0132, 0x0000, 0x0000, 0x0000, 0x040b, 0x0000, 0x0000,
+	    0x0000, 0x0294, 0x0000, 0x0786, 0x029b, 0x0764, 0x0275, 0x0000,
+	    0x002c, 0x0000, 0x0475, 0x0000, 0x0000, 0x022b, 0x0000, 0x0000,
+	    0x0000, 0x0333, 0x0000, 0x0748, 0x0000, 0x0075, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0791, 0x0000, 0x0472,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x02a2, 0x00d4, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0418, 0x0000, 0x0000, 0x06ab, 0x0000, 0x0429,
+	    0x055d, 0x0073, 0x0640, 0x0000, 0x07cc, 0x0000, 0x0000, 0x0000,
+	    0x03a4, 0x0000, 0x0000, 0x0047, 0x0444, 0x072d, 0x0111, 0x0000,
+	    0x0000, 0x0000, 0x001d, 0x077f, 0x057a, 0x0000, 0x0086, 0x0752,
+	    0x04e2, 0x0000, 0x0000, 0x0054, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x04d6, 0x0000, 0x0000, 0x034d,
+	    0x0000, 0x03f3, 0x02d6, 0x052f, 0x03ab, 0x025f, 0x0000, 0x021b,
+	    0x0000, 0x0000, 0x010f, 0x01d7, 0x0000, 0x01fb, 0x0000, 0x0000,
+	    0x043c, 0x0000, 0x04fa, 0x0115, 0x0000, 0x0000, 0x04e6, 0x0000,
+	    0x0000, 0x0000, 0x02b6, 0x070d, 0x0000, 0x02d9, 0x0000, 0x0000,
+	    0x0336, 0x0000, 0x00fe, 0x0000, 0x0000, 0x0103, 0x0000, 0x0000,
+	    0x027f, 0x0353, 0x0682, 0x0000, 0x0051, 0x0000, 0x0000, 0x0013,
+	    0x037b, 0x05a5, 0x04a2, 0x0000, 0x0366, 0x0777, 0x078e, 0x0000,
+	    0x0000, 0x0664, 0x0000, 0x03e6, 0x047e, 0x0181, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0708, 0x0355, 0x0000, 0x06c7, 0x033e,
+	    0x04b6, 0x044d, 0x029a, 0x06ae, 0x0281, 0x0000, 0x055d, 0x0000,
+	    0x0000, 0x006c, 0x028c, 0x0000, 0x02c1, 0x0000, 0x0000, 0x01d2,
+	    0x0789, 0x02e7, 0x04f6, 0x0000, 0x0000, 0x0137, 0x0000, 0x0000,
+	    0x0000, 0x035d, 0x0711, 0x0733, 0x007d, 0x0000, 0x0000, 0x0000,
+	    0x04de, 0x049f, 0x055b, 0x0000, 0x0000, 0x0000, 0x0093, 0x005a,
+	    0x0549, 0x01c4, 0x047c, 0x06ce, 0x0000, 0x0599, 0x0000, 0x0000,
+	    0x04c6, 0x0000, 0x0000, 0x047d, 0x0218, 0x0000, 0x0000, 0x06e3,
+	    0x04a5, 0x053e, 0x0434, 0x0610, 0x0000, 0x04e1, 0x06ad, 0x0000,
+	    0x0000, 0x02d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x06cb, 0x002c, 0x0000, 0x02d6, 0x033a, 0x0000, 0x0000, 0x0444,
+	    0x0161, 0x0000, 0x0162, 0x0000, 0x0000, 0x0000, 0x0000, 0x04b4,
+	    0x0000, 0x078c, 0x0691, 0x0000, 0x0000, 0x003b, 0x00db, 0x0000,
+	    0x0600, 0x072d, 0x0000, 0x0000, 0x0000, 0x0279, 0x061e, 0x0458,
+	    0x0000, 0x00c0, 0x030c, 0x0000, 0x0154, 0x032e, 0x0688, 0x06e2,
+	    0x0000, 0x0000, 0x020f, 0x0000, 0x0000, 0x076e, 0x0000, 0x0000,
+	    0x0000, 0x0269, 0x015c, 0x026e, 0x075b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x04ab, 0x05b4, 0x063a, 0x0000, 0x0590, 0x0000, 0x0000,
+	    0x0000, 0x0050, 0x01e7, 0x02e1, 0x060e, 0x0317, 0x0000, 0x024f,
+	    0x0000, 0x065a, 0x04d7, 0x0000, 0x0000, 0x0000, 0x0291, 0x0494,
+	    0x0000, 0x06f5, 0x043a, 0x0000, 0x004e, 0x0000, 0x0713, 0x0000,
+	    0x0000, 0x03c9, 0x06c8, 0x045f, 0x03b1, 0x05db, 0x06b5, 0x06e4,
+	    0x0515, 0x0000, 0x0010, 0x0000, 0x01f3, 0x079b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x05ea, 0x0000, 0x04fe, 0x01d9, 0x0000,
+	    0x0132, 0x000d, 0x0620, 0x0000, 0x04ae, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0004, 0x0678, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0279, 0x0000, 0x06eb, 0x03e9, 0x0213,
+	    0x00f2, 0x032b, 0x06a4, 0x05f3, 0x00e0, 0x0000, 0x0000, 0x0469,
+	    0x049f, 0x059c, 0x0000, 0x0000, 0x02de, 0x0000, 0x0000, 0x0000,
+	    0x0660, 0x0000, 0x026b, 0x0798, 0x0000, 0x045d, 0x0000, 0x06ce,
+	    0x0000, 0x049a, 0x079e, 0x0000, 0x04f0, 0x020b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04fa, 0x00fb, 0x0000, 0x0000, 0x0739, 0x0000,
+	    0x0000, 0x0000, 0x011c, 0x0000, 0x0000, 0x03df, 0x0000, 0x0240,
+	    0x0410, 0x0000, 0x0000, 0x06d7, 0x0562, 0x0000, 0x0000, 0x0000,
+	    0x070e, 0x0405, 0x0675, 0x0000, 0x05dc, 0x0000, 0x0000, 0x00da,
+	    0x0000, 0x017b, 0x0000, 0x0159, 0x0000, 0x0000, 0x00a7, 0x0000,
+	    0x0302, 0x0519, 0x0000, 0x0000, 0x01f7, 0x0076, 0x0000, 0x052f,
+	    0x04e1, 0x0351, 0x0000, 0x0000, 0x020d, 0x03f6, 0x0000, 0x0000,
+	    0x05bd, 0x0000, 0x0000, 0x061f, 0x0000, 0x073d, 0x0000, 0x051e,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a8, 0x04da, 0x0000,
+	    0x01dd, 0x0000, 0x0000, 0x0752, 0x0000, 0x0000, 0x0000, 0x0652,
+	    0x056d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01f6, 0x046c, 0x0000, 0x0000, 0x0000, 0x0513, 0x03f5,
+	    0x0000, 0x05b2, 0x06e7, 0x01f6, 0x0000, 0x0000, 0x07c9, 0x01f0,
+	    0x0000, 0x0777, 0x06c4, 0x00a4, 0x0000, 0x0386, 0x0000, 0x0000,
+	    0x054f, 0x0000, 0x06c7, 0x0000, 0x0293, 0x0000, 0x0556, 0x019a,
+	    0x0000, 0x00ab, 0x04fe, 0x030c, 0x0000, 0x0000, 0x0000, 0x03c6,
+	    0x0439, 0x0000, 0x058c, 0x06da, 0x0000, 0x0000, 0x0000, 0x0375,
+	    0x0000, 0x03c9, 0x0000, 0x0000, 0x0000, 0x04ac, 0x0035, 0x032b,
+	    0x0000, 0x0000, 0x0170, 0x0000, 0x00b4, 0x003e, 0x0000, 0x0275,
+	    0x0000, 0x0000, 0x0272, 0x0000, 0x0666, 0x0000, 0x021a, 0x0673,
+	    0x0000, 0x0000, 0x07a7, 0x0000, 0x027f, 0x00cd, 0x0000, 0x050a,
+	    0x0174, 0x029f, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x03b0, 0x0517, 0x0000,
+	    0x05ce, 0x03d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x02ae, 0x0000,
+	    0x0000, 0x051a, 0x0000, 0x0000, 0x0000, 0x0000, 0x06ea, 0x0050,
+	    0x0681, 0x0581, 0x0000, 0x0000, 0x05b8, 0x06ab, 0x0000, 0x0000,
+	    0x0000, 0x0160, 0x0000, 0x00eb, 0x01f3, 0x0479, 0x0000, 0x0000,
+	    0x044c, 0x00ac, 0x0000, 0x0000, 0x06de, 0x0134, 0x0359, 0x0000,
+	    0x0000, 0x076c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0275, 0x06d0, 0x0000, 0x07c5, 0x02c1, 0x0000, 0x018b, 0x0000,
+	    0x02e4, 0x0000, 0x0000, 0x01ae, 0x027b, 0x0720, 0x0126, 0x0000,
+	    0x0000,
+	};
+	uint16_t h[4];
+
+	_fixedhash(key, (uint64_t*)h);
+
+	h[0] = h[0] % 4001;
+	h[1] = h[1] % 4001;
+	result = (g[h[0]] + g[h[1]]) % 2000;
+	return (memcmp(hash_keys[result], key, 16) == 0) ? result : (uint16_t)-1;
+}
@@ -0,0 +1,124 @@
+/* generated with rurban/nbperf 08a5797  -B 16 _uuids */
+/* seed[0]: 1681692777, seed[1]: 1714636915 */
+#include <stdint.h>
+
+static inline uint64_t _inthash64(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return x ^ (x >> 31);
+}
+
+#include <string.h>
+
+static inline uint64_t
+_fixed_le(const uint8_t *p, unsigned n)
+{
+	uint64_t v = 0;
+
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	memcpy(&v, p, n);
+#else
+	while (n--)
+		v = v << 8 | p[n];
+#endif
+	return v;
+}
+
+static inline void
+_fixedhash(const uint8_t key[16], uint64_t *h)
+{
+	uint64_t x = UINT64_C(0x66334873643c9869);
+
+	x = _inthash64(x ^ _fixed_le(key + 0, 8));
+	x = _inthash64(x ^ _fixed_le(key + 8, 8));
+	h[0] = x;
+}
+
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+hash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 hash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+uint32_t
+hash(const uint8_t key[16])
+{
+	static const uint64_t g[96] NBPERF_ALIGN64 = {
+		UINT64_C(0x8e62300000000000), UINT64_C(0x6d621403971fef9b), UINT64_C(0x429d2fc3223a8127),
+		UINT64_C(0x7cdc9aa0e62d3d17), UINT64_C(0x862a6d23bc39255a), UINT64_C(0xc9de96ed8b36a731),
+		UINT64_C(0x58dd35947fcf760d), UINT64_C(0x4bd90d82121a8e05), UINT64_C(0x99663400000000aa),
+		UINT64_C(0x34ecef41650b9604), UINT64_C(0xc22c951e6b823680), UINT64_C(0x9949e2ce9626c152),
+		UINT64_C(0xbedc7b45f54c60b9), UINT64_C(0xb22a176540cfb6ad), UINT64_C(0xea9597bd8af1a429),
+		UINT64_C(0x23e9cc86b5861f6c), UINT64_C(0x956a32000000015b), UINT64_C(0xf5911a94cf0122e0),
+		UINT64_C(0xe802f5b03f28b195), UINT64_C(0xb524c80e55b8048b), UINT64_C(0x889450995f1aea61),
+		UINT64_C(0x72dcd532400fadd7), UINT64_C(0x33b8774c959cd1fe), UINT64_C(0x5201eeea1c9b0508),
+		UINT64_C(0xa26c33000000020b), UINT64_C(0x629a149f48df1a92), UINT64_C(0xb16779d7b04d289b),
+		UINT64_C(0x2590aa995b263425), UINT64_C(0x8dd8984dab191a43), UINT64_C(0x08b7dfa989480416),
+		UINT64_C(0x518205c9746b3836), UINT64_C(0x8964d19076937082), UINT64_C(0x9b643300000002c9),
+		UINT64_C(0x12b94e0b47a1ca33), UINT64_C(0xbd85cc6299bc5229), UINT64_C(0x6a89f30d2355f47e),
+		UINT64_C(0x8e5d07a8c4a8d0d5), UINT64_C(0xabd1ca7a51410551), UINT64_C(0x98a89e92ceb16704),
+		UINT64_C(0x3621de3e5041a404), UINT64_C(0x9b693a000000037f), UINT64_C(0x475b12400be55068),
+		UINT64_C(0x06c8a55898e69886), UINT64_C(0x48462a20cb14f0f7), UINT64_C(0x98fb55cae53770f4),
+		UINT64_C(0x3336ef0635c0a009), UINT64_C(0xd19f8348535b2920), UINT64_C(0x988614ea0200c415),
+		UINT64_C(0x8f5d330000000438), UINT64_C(0x1cc5285c883d5a0e), UINT64_C(0xc998c0f1d953d994),
+		UINT64_C(0xf02c487e55750fd9), UINT64_C(0x23b8cdf2f5ee3dd4), UINT64_C(0xd64e41f87ca5797d),
+		UINT64_C(0x6e1a078178cc8416), UINT64_C(0x42e8181f2b20e930), UINT64_C(0x9e6a3800000004e1),
+		UINT64_C(0xacd819e6622d5ad2), UINT64_C(0x4ca0962b766a49a4), UINT64_C(0xfecf0b50bb889a70),
+		UINT64_C(0x81045ea6a450b1fa), UINT64_C(0x1223c702254b07ac), UINT64_C(0x171666d872d15d2d),
+		UINT64_C(0x62e1bb641ea85763), UINT64_C(0x9961300000000599), UINT64_C(0xcf4cf5a9bad86552),
+		UINT64_C(0xbe2469ade2b3a40f), UINT64_C(0x7ed4ade5875745e3), UINT64_C(0x2ab460e58967707e),
+		UINT64_C(0x8c685161a045df28), UINT64_C(0x1a10867aa189f42c), UINT64_C(0xb0ce566f820064a8),
+		UINT64_C(0x9a6633000000064d), UINT64_C(0x89203ca581d85c34), UINT64_C(0xf8091669c23d3f95),
+		UINT64_C(0xf55dfa8abc0b2b8a), UINT64_C(0x7098904aac610378), UINT64_C(0x097cbd10922b9cb5),
+		UINT64_C(0xbaaba398a1c4a435), UINT64_C(0x658f155be02e5f4b), UINT64_C(0xa56c3700000006ff),
+		UINT64_C(0xba0babe2e36243b8), UINT64_C(0x18a9742a28828001), UINT64_C(0x0a74a7d8a201c778),
+		UINT64_C(0x78682873dd228695), UINT64_C(0x32c861186c48e040), UINT64_C(0x2a8684fc96214868),
+		UINT64_C(0xdb38a4564a904148), UINT64_C(0x13131300000007c1), UINT64_C(0xffffff00164b9a4a),
+		UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+		UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+	};
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[8];
+
+	_fixedhash(key, (uint64_t*)h);
+
+	h[0] = h[0] % 2480;
+	h[1] = h[1] % 2480;
+	h[2] = h[2] % 2480;
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 2480;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return base_rank;
+}
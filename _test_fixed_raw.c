@@ -0,0 +1,362 @@
+/* generated with rurban/nbperf 08a5797  -B 16 -R _uuids.bin */
+/* seed[0]: 719885386, seed[1]: 1649760492 */
+#include <stdint.h>
+
+static inline uint64_t _inthash64(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return x ^ (x >> 31);
+}
+
+#include <string.h>
+
+static inline uint64_t
+_fixed_le(const uint8_t *p, unsigned n)
+{
+	uint64_t v = 0;
+
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	memcpy(&v, p, n);
+#else
+	while (n--)
+		v = v << 8 | p[n];
+#endif
+	return v;
+}
+
+static inline void
+_fixedhash(const uint8_t key[16], uint64_t *h)
+{
+	uint64_t x = UINT64_C(0x625558ec2ae8944a);
+
+	x = _inthash64(x ^ _fixed_le(key + 0, 8));
+	x = _inthash64(x ^ _fixed_le(key + 8, 8));
+	h[0] = x;
+}
+
+uint16_t
+hash(const uint8_t key[16])
+{
+	static const uint16_t g[2481] = {
+	    0x00c0, 0x06ee, 0x0000, 0x0266, 0x0000, 0x07ac, 0x00df, 0x041e,
+	    0x06aa, 0x0222, 0x028e, 0x025d, 0x0000, 0x01bd, 0x013c, 0x067a,
+	    0x021f, 0x0144, 0x07c9, 0x0152, 0x05eb, 0x0600, 0x04b3, 0x01ae,
+	    0x001a, 0x008b, 0x05a4, 0x04e3, 0x00c6, 0x0290, 0x0599, 0x0000,
+	    0x0000, 0x0000, 0x05e2, 0x05a3, 0x0000, 0x01f0, 0x03a8, 0x04f9,
+	    0x05d9, 0x002a, 0x0724, 0x00a4, 0x032d, 0x0599, 0x0000, 0x0000,
+	    0x011b, 0x04dc, 0x0266, 0x0000, 0x051d, 0x0494, 0x06ea, 0x0000,
+	    0x06a9, 0x0000, 0x049b, 0x0000, 0x06ff, 0x0717, 0x0714, 0x01db,
+	    0x003c, 0x0528, 0x019e, 0x061d, 0x05c7, 0x05c5, 0x06eb, 0x0409,
+	    0x0000, 0x0735, 0x05d5, 0x03c5, 0x02c0, 0x06a4, 0x0332, 0x047d,
+	    0x07bb, 0x0187, 0x0000, 0x0770, 0x00dd, 0x01bf, 0x05bc, 0x05dd,
+	    0x048c, 0x0000, 0x0499, 0x05ae, 0x034e, 0x01de, 0x0300, 0x01e1,
+	    0x0000, 0x0326, 0x077b, 0x0062, 0x0678, 0x0000, 0x07be, 0x0325,
+	    0x05a7, 0x0443, 0x02c2, 0x049d, 0x079b, 0x0000, 0x0042, 0x0378,
+	    0x0000, 0x0469, 0x02ea, 0x0178, 0x0247, 0x07a0, 0x0044, 0x01f1,
+	    0x0000, 0x0594, 0x0000, 0x03da, 0x0213, 0x0085, 0x01d3, 0x0005,
+	    0x03ec, 0x0030, 0x0267, 0x0363, 0x0675, 0x0000, 0x0000, 0x048e,
+	    0x0521, 0x02bd, 0x03d2, 0x06e5, 0x04dd, 0x05d2, 0x012d, 0x0000,
+	    0x03dc, 0x0376, 0x07c3, 0x077e, 0x0000, 0x0420, 0x0000, 0x03f4,
+	    0x06dc, 0x00ae, 0x036a, 0x0060, 0x00ce, 0x04ae, 0x05fc, 0x0774,
+	    0x0000, 0x04d5, 0x0000, 0x0000, 0x01dc, 0x06e4, 0x007c, 0x020c,
+	    0x0000, 0x0497, 0x074b, 0x0450, 0x02b6, 0x061a, 0x047a, 0x01b1,
+	    0x0235, 0x0452, 0x025d, 0x059d, 0x06ee, 0x0062, 0x032d, 0x0000,
+	    0x02d5, 0x02fa, 0x0345, 0x00ef, 0x0166, 0x0342, 0x038d, 0x01a8,
+	    0x06d8, 0x01d7, 0x0111, 0x0792, 0x0438, 0x01dd, 0x02cb, 0x06f8,
+	    0x0276, 0x033d, 0x074e, 0x0130, 0x0056, 0x01cc, 0x062b, 0x0464,
+	    0x03ba, 0x0000, 0x0407, 0x060b, 0x06cd, 0x0115, 0x0161, 0x0535,
+	    0x056c, 0x0239, 0x05d1, 0x0787, 0x0664, 0x00dc, 0x0000, 0x065c,
+	    0x0170, 0x0695, 0x02ce, 0x016d, 0x0605, 0x03ab, 0x0707, 0x0406,
+	    0x00c9, 0x0042, 0x04f8, 0x0791, 0x0000, 0x052d, 0x0122, 0x0110,
+	    0x002d, 0x01af, 0x0000, 0x0000, 0x068a, 0x005e, 0x0038, 0x0032,
+	    0x06cf, 0x0413, 0x022f, 0x0732, 0x0396, 0x056b, 0x0059, 0x03f5,
+	    0x0595, 0x07ce, 0x024f, 0x05e5, 0x0656, 0x049c, 0x0000, 0x00eb,
+	    0x03aa, 0x00bd, 0x0053, 0x005e, 0x074d, 0x0687, 0x047c, 0x0139,
+	    0x075b, 0x0546, 0x0000, 0x009d, 0x0000, 0x0697, 0x0000, 0x0179,
+	    0x03f3, 0x005c, 0x0000, 0x0511, 0x050d, 0x0049, 0x057f, 0x0110,
+	    0x01be, 0x033f, 0x051b, 0x014e, 0x06c2, 0x0000, 0x04c4, 0x0679,
+	    0x00b0, 0x078c, 0x02e6, 0x0159, 0x0000, 0x060b, 0x0000, 0x04b0,
+	    0x06e4, 0x0142, 0x0378, 0x051d, 0x019c, 0x00a9, 0x0140, 0x0796,
+	    0x02e4, 0x04b2, 0x07c3, 0x0339, 0x04c9, 0x0000, 0x0189, 0x027b,
+	    0x05b3, 0x07bb, 0x03b9, 0x01cd, 0x053c, 0x074c, 0x046c, 0x055e,
+	    0x02eb, 0x0428, 0x0790, 0x0000, 0x06a1, 0x02bf, 0x0101, 0x0403,
+	    0x0286, 0x0539, 0x03fb, 0x078a, 0x0735, 0x03d9, 0x0000, 0x018c,
+	    0x0000, 0x046f, 0x057c, 0x00eb, 0x0000, 0x0000, 0x0628, 0x03dc,
+	    0x02b1, 0x03b4, 0x0646, 0x0702, 0x0000, 0x0439, 0x06d9, 0x0698,
+	    0x0672, 0x0251, 0x0683, 0x029e, 0x016f, 0x04dc, 0x0000, 0x056a,
+	    0x041b, 0x0044, 0x0212, 0x0000, 0x0532, 0x0629, 0x0000, 0x02d3,
+	    0x02d1, 0x0000, 0x031d, 0x0421, 0x0139, 0x0000, 0x018f, 0x0695,
+	    0x0488, 0x0000, 0x0159, 0x0000, 0x0000, 0x0000, 0x05d7, 0x0370,
+	    0x0000, 0x0758, 0x0602, 0x061a, 0x0000, 0x06d5, 0x00a9, 0x066e,
+	    0x0638, 0x0784, 0x0000, 0x031e, 0x01ec, 0x024f, 0x0194, 0x036f,
+	    0x011d, 0x0000, 0x0482, 0x0000, 0x0000, 0x05f7, 0x0742, 0x0181,
+	    0x0000, 0x0512, 0x0155, 0x0000, 0x05b9, 0x014b, 0x06f5, 0x0384,
+	    0x00dc, 0x0742, 0x0547, 0x02be, 0x0559, 0x06ef, 0x0587, 0x03e0,
+	    0x0498, 0x0639, 0x0495, 0x005f, 0x0000, 0x01b4, 0x01ee, 0x0646,
+	    0x0000, 0x00a6, 0x074e, 0x0212, 0x0426, 0x0000, 0x0456, 0x0436,
+	    0x0564, 0x04eb, 0x0000, 0x05ea, 0x0000, 0x0784, 0x02da, 0x0221,
+	    0x0472, 0x0000, 0x07ad, 0x0461, 0x0244, 0x0000, 0x0217, 0x0092,
+	    0x04f8, 0x05cb, 0x0001, 0x076e, 0x07ab, 0x072a, 0x0000, 0x02d8,
+	    0x035b, 0x06a9, 0x05e2, 0x059f, 0x07b3, 0x0000, 0x0028, 0x0773,
+	    0x0298, 0x0000, 0x0305, 0x04b4, 0x011b, 0x00bd, 0x03ba, 0x0416,
+	    0x0299, 0x05e7, 0x037c, 0x01b6, 0x0000, 0x04d0, 0x0063, 0x04e3,
+	    0x0000, 0x0134, 0x0539, 0x0492, 0x07c3, 0x0193, 0x069b, 0x0000,
+	    0x01f3, 0x046b, 0x0462, 0x04a4, 0x0370, 0x07c1, 0x06c9, 0x0000,
+	    0x0438, 0x057a, 0x0000, 0x0000, 0x0095, 0x0766, 0x0268, 0x0536,
+	    0x01fc, 0x06eb, 0x0090, 0x06b7, 0x0000, 0x040f, 0x0452, 0x04ec,
+	    0x0537, 0x0549, 0x0589, 0x0200, 0x0216, 0x0000, 0x0521, 0x0000,
+	    0x06af, 0x0339, 0x0443, 0x0000, 0x01ce, 0x03e9, 0x015d, 0x04a3,
+	    0x0646, 0x0000, 0x0550, 0x039f, 0x06ce, 0x05c1, 0x0367, 0x00c0,
+	    0x01a2, 0x018a, 0x02d2, 0x0000, 0x06e2, 0x0566, 0x03e1, 0x038c,
+	    0x00c5, 0x05c4, 0x045e, 0x0511, 0x068d, 0x05a8, 0x07c0, 0x0454,
+	    0x0757, 0x0416, 0x0000, 0x0000, 0x06de, 0x06df, 0x0585, 0x001a,
+	    0x028b, 0x05db, 0x0000, 0x0257, 0x0000, 0x0448, 0x0000, 0x0371,
+	    0x02b2, 0x06ae, 0x05a3, 0x06a0, 0x02e3, 0x0354, 0x005c, 0x01b6,
+	    0x01cf, 0x0033, 0x01e7, 0x04f5, 0x0000, 0x0685, 0x0289, 0x0309,
+	    0x003d, 0x02e1, 0x0000, 0x0707, 0x0236, 0x0760, 0x06b7, 0x0113,
+	    0x0789, 0x03ba, 0x0000, 0x05a5, 0x00ef, 0x0418, 0x0153, 0x0563,
+	    0x0081, 0x05aa, 0x0743, 0x07c6, 0x0359, 0x0529, 0x0147, 0x0000,
+	    0x076d, 0x0330, 0x0280, 0x03e6, 0x078e, 0x0000, 0x008a, 0x0251,
+	    0x0000, 0x072b, 0x05fe, 0x05aa, 0x01b5, 0x05c0, 0x03aa, 0x03b7,
+	    0x04bf, 0x0000, 0x029a, 0x0000, 0x0000, 0x059d, 0x00fe, 0x07a9,
+	    0x0000, 0x0000, 0x046d, 0x0000, 0x049c, 0x03cf, 0x06cf, 0x0356,
+	    0x0711, 0x0000, 0x0000, 0x0236, 0x0007, 0x0000, 0x04af, 0x028d,
+	    0x059f, 0x04a5, 0x068e, 0x06bb, 0x0000, 0x0591, 0x03cf, 0x0776,
+	    0x0467, 0x078c, 0x0366, 0x0768, 0x0098, 0x0000, 0x01bb, 0x02bc,
+	    0x0539, 0x0071, 0x06cd, 0x0000, 0x076a, 0x0000, 0x0000, 0x066f,
+	    0x06a4, 0x0000, 0x0000, 0x00c1, 0x079e, 0x0000, 0x02a2, 0x0000,
+	    0x0263, 0x0000, 0x01a0, 0x0733, 0x0257, 0x0651, 0x0000, 0x039a,
+	    0x0014, 0x0244, 0x03cd, 0x058c, 0x0556, 0x018e, 0x06da, 0x0729,
+	    0x0763, 0x022f, 0x03d9, 0x0637, 0x01b8, 0x0000, 0x05b3, 0x032b,
+	    0x0204, 0x0637, 0x0218, 0x0365, 0x0000, 0x030c, 0x00e7, 0x01d9,
+	    0x0493, 0x0150, 0x0549, 0x01da, 0x0000, 0x06cd, 0x020a, 0x0000,
+	    0x0437, 0x01cd, 0x056b, 0x0605, 0x016c, 0x0059, 0x01f2, 0x01ac,
+	    0x0282, 0x0688, 0x01d3, 0x06f2, 0x053f, 0x0000, 0x0000, 0x0000,
+	    0x0636, 0x0449, 0x0753, 0x07ae, 0x0000, 0x037f, 0x0000, 0x02aa,
+	    0x0000, 0x03f1, 0x0000, 0x00c3, 0x0012, 0x04a4, 0x0000, 0x06eb,
+	    0x0000, 0x0606, 0x0740, 0x04ce, 0x02d8, 0x001d, 0x0320, 0x0000,
+	    0x0364, 0x047c, 0x0191, 0x0616, 0x0308, 0x0628, 0x078d, 0x0000,
+	    0x0336, 0x074b, 0x076c, 0x0733, 0x0572, 0x03d6, 0x0127, 0x0000,
+	    0x03e7, 0x0645, 0x0109, 0x0518, 0x0675, 0x0000, 0x0058, 0x03ca,
+	    0x037a, 0x0554, 0x036c, 0x0000, 0x0239, 0x03a5, 0x0000, 0x0792,
+	    0x0000, 0x03b9, 0x06e9, 0x0599, 0x01aa, 0x03ec, 0x00c9, 0x0000,
+	    0x0613, 0x0009, 0x016c, 0x006d, 0x0537, 0x0000, 0x06db, 0x00e2,
+	    0x0300, 0x0000, 0x016a, 0x01ee, 0x01c9, 0x0059, 0x039a, 0x0411,
+	    0x018b, 0x072c, 0x04e1, 0x0005, 0x07ad, 0x026e, 0x0000, 0x05f4,
+	    0x0000, 0x0676, 0x0000, 0x0572, 0x005d, 0x0768, 0x054c, 0x066c,
+	    0x00b6, 0x02be, 0x01bf, 0x0000, 0x02f7, 0x04db, 0x06e5, 0x0122,
+	    0x0694, 0x0431, 0x0209, 0x0342, 0x0142, 0x07ba, 0x0000, 0x079d,
+	    0x0000, 0x06b9, 0x0000, 0x0616, 0x00ef, 0x00b7, 0x01b8, 0x00e1,
+	    0x0000, 0x04db, 0x00e6, 0x01d5, 0x023c, 0x0258, 0x0728, 0x01c6,
+	    0x027b, 0x07bb, 0x0000, 0x0000, 0x0069, 0x00c3, 0x0473, 0x0430,
+	    0x06ee, 0x01d8, 0x00a6, 0x0000, 0x0085, 0x02cd, 0x06d2, 0x0554,
+	    0x0000, 0x0046, 0x0360, 0x000a, 0x02fd, 0x0335, 0x05b0, 0x04a6,
+	    0x0000, 0x0227, 0x01f4, 0x0000, 0x0488, 0x050b, 0x069b, 0x002a,
+	    0x02ea, 0x0379, 0x01e6, 0x00d2, 0x038e, 0x0617, 0x03eb, 0x03ef,
+	    0x0150, 0x0725, 0x0000, 0x02e8, 0x0334, 0x02cd, 0x041b, 0x0000,
+	    0x0000, 0x0000, 0x03c8, 0x0134, 0x00c3, 0x059f, 0x063f, 0x0780,
+	    0x05bd, 0x0530, 0x0341, 0x0000, 0x0405, 0x0767, 0x037e, 0x01d2,
+	    0x05cf, 0x04ed, 0x009d, 0x079a, 0x067f, 0x0728, 0x0230, 0x00d2,
+	    0x06df, 0x0000, 0x001d, 0x0052, 0x06c0, 0x04b2, 0x0172, 0x0405,
+	    0x0684, 0x07a1, 0x0297, 0x0000, 0x04ca, 0x011a, 0x0000, 0x0000,
+	    0x05d2, 0x0781, 0x0000, 0x026c, 0x01a6, 0x0044, 0x0707, 0x0101,
+	    0x0000, 0x02a3, 0x0268, 0x06aa, 0x04ab, 0x0000, 0x05ee, 0x0169,
+	    0x0000, 0x0217, 0x0000, 0x02fd, 0x01b6, 0x00dc, 0x0650, 0x0000,
+	    0x071e, 0x0000, 0x04ab, 0x00c4, 0x00e1, 0x03d9, 0x0000, 0x047a,
+	    0x055b, 0x023f, 0x07cb, 0x0717, 0x061b, 0x05bf, 0x03bb, 0x022a,
+	    0x0616, 0x0782, 0x0352, 0x040f, 0x037b, 0x014b, 0x0000, 0x0000,
+	    0x0761, 0x0000, 0x03dd, 0x03dd, 0x0518, 0x012f, 0x01be, 0x0000,
+	    0x0516, 0x02e1, 0x0000, 0x0471, 0x011a, 0x0678, 0x013a, 0x006c,
+	    0x02ef, 0x0311, 0x0279, 0x07b9, 0x04db, 0x061b, 0x0370, 0x07c0,
+	    0x008a, 0x0577, 0x05ad, 0x0134, 0x0213, 0x02a1, 0x003f, 0x0091,
+	    0x0798, 0x0276, 0x00d2, 0x07b8, 0x02c6, 0x0029, 0x0000, 0x011e,
+	    0x03d3, 0x01d7, 0x06e7, 0x04c6, 0x0000, 0x0079, 0x0067, 0x006e,
+	    0x041a, 0x0000, 0x02f1, 0x004a, 0x01d2, 0x0000, 0x006a, 0x05ae,
+	    0x00a6, 0x0355, 0x0212, 0x06e5, 0x041f, 0x04f6, 0x064f, 0x0000,
+	    0x01cc, 0x0000, 0x0284, 0x0000, 0x001b, 0x0000, 0x0000, 0x0520,
+	    0x0640, 0x022b, 0x0000, 0x0000, 0x0000, 0x06d9, 0x0178, 0x03a8,
+	    0x065b, 0x0747, 0x0606, 0x0280, 0x06ad, 0x005b, 0x069a, 0x0305,
+	    0x0583, 0x0000, 0x0000, 0x0000, 0x0000, 0x00d1, 0x0000, 0x06c6,
+	    0x047c, 0x0529, 0x0000, 0x0000, 0x02bb, 0x0000, 0x06b6, 0x0164,
+	    0x0792, 0x0577, 0x0495, 0x0000, 0x0481, 0x0165, 0x059d, 0x050c,
+	    0x0549, 0x0222, 0x0708, 0x04a9, 0x07cd, 0x0000, 0x0000, 0x0000,
+	    0x02ea, 0x0476, 0x00d3, 0x0207, 0x0000, 0x0000, 0x03c1, 0x013d,
+	    0x0000, 0x03fc, 0x0547, 0x023f, 0x0000, 0x0028, 0x05a1, 0x0282,
+	    0x0170, 0x0160, 0x0000, 0x04ea, 0x02b8, 0x05d2, 0x0000, 0x0296,
+	    0x0000, 0x0000, 0x0591, 0x0211, 0x0000, 0x06ce, 0x0000, 0x071d,
+	    0x0000, 0x0366, 0x0000, 0x02a8, 0x0039, 0x06e1, 0x034a, 0x073d,
+	    0x0228, 0x0000, 0x006f, 0x010e, 0x06fe, 0x0779, 0x0000, 0x03b8,
+	    0x0383, 0x0000, 0x0000, 0x0348, 0x071e, 0x0000, 0x0718, 0x02a5,
+	    0x0000, 0x0358, 0x04e6, 0x0000, 0x0424, 0x012a, 0x047a, 0x0767,
+	    0x00c4, 0x0000, 0x0346, 0x0000, 0x0485, 0x0532, 0x001c, 0x00f0,
+	    0x01a2, 0x078f, 0x0046, 0x0483, 0x0000, 0x0000, 0x013b, 0x047b,
+	    0x032d, 0x04e9, 0x04e6, 0x0000, 0x03ee, 0x05f2, 0x0000, 0x0000,
+	    0x0060, 0x010a, 0x06a9, 0x0294, 0x0000, 0x05c6, 0x04ed, 0x0000,
+	    0x05e6, 0x0737, 0x05c6, 0x05e5, 0x027d, 0x014b, 0x0000, 0x02e8,
+	    0x06a3, 0x0000, 0x074e, 0x051d, 0x060b, 0x06fb, 0x0712, 0x040d,
+	    0x04b4, 0x042e, 0x03b8, 0x04dc, 0x03c6, 0x0673, 0x04ed, 0x049e,
+	    0x0000, 0x0007, 0x0035, 0x0000, 0x01c7, 0x0000, 0x0447, 0x001a,
+	    0x04e3, 0x0463, 0x06ba, 0x0753, 0x03f0, 0x070c, 0x00ed, 0x036d,
+	    0x06d9, 0x0000, 0x0541, 0x0000, 0x01bc, 0x030a, 0x0049, 0x05ba,
+	    0x06ab, 0x0000, 0x01d7, 0x0000, 0x00bc, 0x01a4, 0x006f, 0x0374,
+	    0x06df, 0x0092, 0x0000, 0x074e, 0x0734, 0x0411, 0x0000, 0x0208,
+	    0x0000, 0x0515, 0x0266, 0x005c, 0x0632, 0x03bc, 0x0354, 0x0324,
+	    0x0039, 0x07bd, 0x02c4, 0x06b1, 0x064e, 0x04cf, 0x0487, 0x00b9,
+	    0x04c7, 0x037c, 0x0000, 0x02b5, 0x012f, 0x02dd, 0x0048, 0x06f9,
+	    0x076b, 0x0000, 0x0178, 0x0000, 0x05fc, 0x04a0, 0x0690, 0x0000,
+	    0x05a7, 0x0000, 0x05a2, 0x058f, 0x076f, 0x04b9, 0x0000, 0x05ec,
+	    0x01c9, 0x0757, 0x0168, 0x0789, 0x03f5, 0x011c, 0x05b6, 0x0000,
+	    0x026d, 0x04c9, 0x0000, 0x0441, 0x0000, 0x01b4, 0x0661, 0x011b,
+	    0x0778, 0x0162, 0x0000, 0x04cd, 0x0780, 0x071b, 0x04e5, 0x038e,
+	    0x0000, 0x05e3, 0x02f4, 0x04cb, 0x07cb, 0x03bd, 0x0000, 0x0000,
+	    0x0449, 0x0598, 0x01f5, 0x0000, 0x0373, 0x032c, 0x0394, 0x03f6,
+	    0x00a3, 0x01ae, 0x073f, 0x0242, 0x048f, 0x0000, 0x0062, 0x0000,
+	    0x02ce, 0x0276, 0x0000, 0x0732, 0x0000, 0x0196, 0x03d8, 0x02bf,
+	    0x0000, 0x04ce, 0x003e, 0x05bd, 0x0772, 0x0521, 0x0733, 0x0545,
+	    0x0221, 0x0144, 0x0000, 0x074c, 0x031c, 0x0355, 0x040a, 0x04a4,
+	    0x07a9, 0x05c3, 0x0000, 0x033e, 0x021d, 0x018f, 0x025c, 0x0000,
+	    0x0424, 0x065f, 0x0000, 0x0000, 0x0192, 0x073d, 0x04d5, 0x0453,
+	    0x070e, 0x063e, 0x058f, 0x0000, 0x0000, 0x057d, 0x070d, 0x0005,
+	    0x0636, 0x037a, 0x07cf, 0x052b, 0x0000, 0x07b8, 0x0213, 0x0000,
+	    0x0000, 0x05e7, 0x062a, 0x07c3, 0x067c, 0x0000, 0x008e, 0x0351,
+	    0x052d, 0x0646, 0x06e7, 0x03bb, 0x0501, 0x0000, 0x0664, 0x00be,
+	    0x04ab, 0x055a, 0x07b5, 0x01ad, 0x0000, 0x06e3, 0x0000, 0x03db,
+	    0x01f8, 0x0551, 0x06b0, 0x03c0, 0x00c1, 0x0000, 0x0213, 0x0000,
+	    0x02c3, 0x024e, 0x03d4, 0x0000, 0x01bb, 0x050d, 0x0000, 0x04fd,
+	    0x03af, 0x071d, 0x05e6, 0x02d3, 0x02f8, 0x041d, 0x0261, 0x0785,
+	    0x00b5, 0x03b8, 0x0780, 0x0659, 0x0000, 0x0559, 0x035a, 0x04dd,
+	    0x00df, 0x05e8, 0x06ed, 0x0690, 0x0776, 0x057a, 0x075b, 0x01b6,
+	    0x062c, 0x0000, 0x071c, 0x06aa, 0x06d8, 0x0252, 0x074d, 0x000a,
+	    0x017a, 0x0000, 0x0311, 0x0018, 0x0000, 0x0774, 0x02d7, 0x0000,
+	    0x0728, 0x0000, 0x0641, 0x047a, 0x0000, 0x0410, 0x04ab, 0x0325,
+	    0x02c0, 0x0280, 0x02ac, 0x0364, 0x002e, 0x05fa, 0x07ad, 0x0242,
+	    0x04bd, 0x077d, 0x0543, 0x0708, 0x03e8, 0x0081, 0x0713, 0x04df,
+	    0x011e, 0x0787, 0x03d8, 0x0344, 0x0715, 0x0257, 0x00cd, 0x0222,
+	    0x03fb, 0x0567, 0x0055, 0x018e, 0x00e8, 0x0000, 0x077e, 0x079e,
+	    0x02a2, 0x0778, 0x0572, 0x0612, 0x0219, 0x07aa, 0x01be, 0x02c3,
+	    0x0342, 0x03b7, 0x0000, 0x0000, 0x0588, 0x0724, 0x03cf, 0x053e,
+	    0x063f, 0x005f, 0x0000, 0x056e, 0x02d3, 0x0000, 0x0064, 0x0654,
+	    0x0000, 0x01b7, 0x0609, 0x0613, 0x06b2, 0x041a, 0x07ac, 0x03cf,
+	    0x06e9, 0x05ad, 0x01e7, 0x00e7, 0x05f1, 0x0548, 0x03c7, 0x0000,
+	    0x03ad, 0x0000, 0x0000, 0x0435, 0x039a, 0x06bb, 0x0000, 0x02a7,
+	    0x07b0, 0x043d, 0x00f0, 0x01a5, 0x00a2, 0x047a, 0x05c3, 0x02d7,
+	    0x0500, 0x00af, 0x0000, 0x0000, 0x0000, 0x0246, 0x0720, 0x078a,
+	    0x05c6, 0x033c, 0x0679, 0x0000, 0x00d8, 0x0000, 0x0434, 0x05de,
+	    0x0000, 0x03fd, 0x0000, 0x010d, 0x00a8, 0x0000, 0x05a9, 0x035d,
+	    0x0322, 0x0000, 0x06af, 0x0098, 0x0000, 0x0659, 0x0000, 0x0000,
+	    0x0450, 0x00c7, 0x06aa, 0x02cf, 0x0000, 0x00e9, 0x0401, 0x0421,
+	    0x05af, 0x0000, 0x05cc, 0x0637, 0x06c9, 0x0614, 0x01b3, 0x01aa,
+	    0x0000, 0x003a, 0x0106, 0x06a5, 0x03da, 0x0199, 0x00ad, 0x048a,
+	    0x072e, 0x0334, 0x0000, 0x0000, 0x0042, 0x0000, 0x0000, 0x060d,
+	    0x018b, 0x00e5, 0x04a1, 0x0000, 0x0060, 0x0000, 0x0000, 0x04f9,
+	    0x052a, 0x05bd, 0x0591, 0x0573, 0x01dd, 0x02b2, 0x06d9, 0x056a,
+	    0x04a5, 0x03f0, 0x0241, 0x0000, 0x0000, 0x0461, 0x0415, 0x0000,
+	    0x05df, 0x00bf, 0x0341, 0x019a, 0x0000, 0x0000, 0x0000, 0x0071,
+	    0x0078, 0x05dd, 0x0275, 0x038c, 0x063a, 0x05ed, 0x04a3, 0x0000,
+	    0x037c, 0x0177, 0x0584, 0x057c, 0x01f3, 0x0254, 0x0460, 0x07b6,
+	    0x021f, 0x02c9, 0x051f, 0x0000, 0x038e, 0x034d, 0x0341, 0x0109,
+	    0x0249, 0x03cd, 0x0109, 0x061d, 0x0149, 0x07a4, 0x0764, 0x01a7,
+	    0x0572, 0x0000, 0x05da, 0x0123, 0x01c5, 0x0430, 0x0346, 0x0000,
+	    0x0000, 0x070a, 0x0000, 0x01be, 0x0050, 0x0250, 0x055d, 0x022e,
+	    0x07a7, 0x053c, 0x0682, 0x05a4, 0x078d, 0x0086, 0x06b9, 0x0000,
+	    0x0768, 0x0501, 0x023d, 0x01f1, 0x0198, 0x0000, 0x0500, 0x037b,
+	    0x037d, 0x0546, 0x06b9, 0x0340, 0x04c2, 0x0435, 0x03a6, 0x06c8,
+	    0x0004, 0x0000, 0x03c0, 0x0182, 0x02ab, 0x04f5, 0x057b, 0x0023,
+	    0x03b3, 0x0575, 0x0368, 0x059a, 0x0366, 0x048b, 0x00de, 0x0000,
+	    0x0103, 0x0736, 0x07b9, 0x015f, 0x057a, 0x057b, 0x0239, 0x0127,
+	    0x0051, 0x0536, 0x01dd, 0x0165, 0x00c1, 0x04e5, 0x0273, 0x0793,
+	    0x01aa, 0x0404, 0x0388, 0x0611, 0x0000, 0x0081, 0x076c, 0x0000,
+	    0x0000, 0x07cd, 0x074b, 0x0000, 0x0549, 0x0000, 0x006a, 0x0081,
+	    0x0612, 0x05af, 0x009d, 0x02a3, 0x0283, 0x0182, 0x056a, 0x01e2,
+	    0x05f2, 0x0000, 0x026b, 0x0000, 0x0756, 0x0000, 0x0015, 0x0000,
+	    0x049f, 0x00ab, 0x0066, 0x0000, 0x021a, 0x05ef, 0x01b1, 0x0000,
+	    0x0000, 0x0000, 0x0232, 0x0000, 0x07bb, 0x020a, 0x0000, 0x0339,
+	    0x0427, 0x029b, 0x042d, 0x0000, 0x03f9, 0x028b, 0x0651, 0x0000,
+	    0x0000, 0x014f, 0x04fc, 0x0000, 0x0000, 0x0647, 0x0000, 0x0000,
+	    0x01b5, 0x0000, 0x01b4, 0x0756, 0x0298, 0x0363, 0x04a5, 0x0000,
+	    0x0024, 0x02d4, 0x0010, 0x0477, 0x0229, 0x00e3, 0x022c, 0x011b,
+	    0x04c6, 0x072c, 0x03b6, 0x0000, 0x0480, 0x0161, 0x0000, 0x0000,
+	    0x0712, 0x0000, 0x0183, 0x0000, 0x0000, 0x0000, 0x0079, 0x00ad,
+	    0x053a, 0x0000, 0x05ef, 0x0047, 0x06b2, 0x013f, 0x002a, 0x0605,
+	    0x06ac, 0x0000, 0x04fd, 0x0353, 0x02c5, 0x00b6, 0x0000, 0x014f,
+	    0x01b1, 0x052e, 0x0759, 0x02ff, 0x0509, 0x00cf, 0x074d, 0x0000,
+	    0x03ef, 0x034d, 0x0609, 0x0474, 0x0000, 0x0666, 0x04d5, 0x0000,
+	    0x0130, 0x0000, 0x0221, 0x026e, 0x016e, 0x0000, 0x02cc, 0x038c,
+	    0x03bd, 0x0057, 0x0529, 0x0074, 0x006b, 0x0000, 0x057b, 0x0686,
+	    0x01b5, 0x02e0, 0x00f1, 0x0000, 0x0253, 0x0313, 0x0636, 0x01e9,
+	    0x0000, 0x007c, 0x054b, 0x000c, 0x022b, 0x0241, 0x051b, 0x051f,
+	    0x0489, 0x0000, 0x0000, 0x03b3, 0x0000, 0x018f, 0x06b5, 0x039c,
+	    0x0000, 0x023b, 0x00ea, 0x0664, 0x0318, 0x0272, 0x0195, 0x050b,
+	    0x01d0, 0x0000, 0x05ca, 0x065f, 0x0000, 0x0000, 0x072f, 0x05b0,
+	    0x0000, 0x045f, 0x033b, 0x06b2, 0x07c0, 0x0000, 0x0106, 0x004e,
+	    0x0000, 0x0400, 0x0000, 0x03fe, 0x029b, 0x0212, 0x026c, 0x0000,
+	    0x0102, 0x0308, 0x00c6, 0x059e, 0x0505, 0x01f5, 0x0330, 0x01d5,
+	    0x02b2, 0x0000, 0x033a, 0x00e5, 0x05b0, 0x017e, 0x074f, 0x041d,
+	    0x06f1, 0x078b, 0x0000, 0x0000, 0x0737, 0x04a8, 0x037f, 0x0000,
+	    0x01cf, 0x017c, 0x02fd, 0x053f, 0x0000, 0x02bf, 0x0000, 0x00e9,
+	    0x024e, 0x0000, 0x0000, 0x06d9, 0x0704, 0x02c8, 0x0000, 0x0744,
+	    0x020c, 0x0561, 0x02f2, 0x0544, 0x07ac, 0x014f, 0x0045, 0x06c4,
+	    0x0569, 0x0598, 0x0555, 0x0341, 0x0603, 0x03fb, 0x025d, 0x0000,
+	    0x00f2, 0x0110, 0x0000, 0x0161, 0x04e6, 0x03d0, 0x0504, 0x0363,
+	    0x040e, 0x01c8, 0x00f2, 0x0167, 0x035a, 0x068f, 0x01d0, 0x0211,
+	    0x068f, 0x00ea, 0x05a8, 0x0181, 0x0660, 0x053b, 0x0000, 0x0239,
+	    0x038d, 0x00c6, 0x06c8, 0x07c4, 0x0128, 0x071b, 0x073a, 0x0517,
+	    0x0042, 0x03fb, 0x0669, 0x0588, 0x00ce, 0x0678, 0x0438, 0x03c3,
+	    0x0734, 0x0000, 0x0637, 0x0627, 0x0000, 0x06f1, 0x05b1, 0x0522,
+	    0x069b, 0x06c7, 0x043d, 0x048d, 0x031b, 0x00da, 0x045f, 0x00a7,
+	    0x04b2, 0x02c1, 0x0000, 0x0000, 0x01d7, 0x034e, 0x04c6, 0x0726,
+	    0x0000, 0x0200, 0x02b8, 0x0653, 0x0264, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0424, 0x0385, 0x0000, 0x0113, 0x067b, 0x061f,
+	    0x0000, 0x0000, 0x013b, 0x00b3, 0x06d9, 0x0437, 0x0000, 0x076b,
+	    0x04b0, 0x00c0, 0x0000, 0x044a, 0x011f, 0x005a, 0x0649, 0x0706,
+	    0x050c, 0x0110, 0x04f4, 0x03a3, 0x04ac, 0x075b, 0x0309, 0x0309,
+	    0x002e, 0x069c, 0x0401, 0x0657, 0x0000, 0x05d9, 0x0000, 0x0000,
+	    0x017e, 0x0461, 0x0332, 0x040e, 0x050c, 0x054e, 0x0000, 0x02b8,
+	    0x0000, 0x05c1, 0x0452, 0x0064, 0x0000, 0x0008, 0x06e2, 0x04b9,
+	    0x0608, 0x0490, 0x021a, 0x0775, 0x077a, 0x0000, 0x0000, 0x0000,
+	    0x0378, 0x0000, 0x0000, 0x0576, 0x0697, 0x0640, 0x0000, 0x0715,
+	    0x0266, 0x03f9, 0x0664, 0x029a, 0x0000, 0x02da, 0x0000, 0x0137,
+	    0x0782, 0x079e, 0x00f8, 0x0689, 0x0587, 0x0067, 0x057a, 0x0486,
+	    0x0000, 0x02bb, 0x0026, 0x01ca, 0x0518, 0x074f, 0x0046, 0x0442,
+	    0x0736, 0x07a7, 0x0419, 0x0042, 0x0456, 0x033a, 0x06e1, 0x05b1,
+	    0x07a7, 0x063a, 0x032c, 0x0631, 0x0701, 0x05bb, 0x00c6, 0x0000,
+	    0x03a5, 0x00b1, 0x0000, 0x0145, 0x0000, 0x000f, 0x073d, 0x03b7,
+	    0x0741, 0x00dd, 0x029c, 0x05e6, 0x0318, 0x0639, 0x044c, 0x0000,
+	    0x0222, 0x0676, 0x0102, 0x00ff, 0x0322, 0x0421, 0x00d9, 0x0211,
+	    0x00ae, 0x0501, 0x05d5, 0x0646, 0x01ad, 0x0050, 0x02b5, 0x0000,
+	    0x0000, 0x037d, 0x0038, 0x07cc, 0x0489, 0x0000, 0x034f, 0x0000,
+	    0x04ae, 0x0727, 0x00c6, 0x062f, 0x0000, 0x043a, 0x0227, 0x0413,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02b1, 0x00d3, 0x07c1,
+	    0x0232, 0x0333, 0x03c0, 0x015f, 0x0000, 0x0264, 0x0252, 0x0530,
+	    0x0530, 0x0000, 0x0642, 0x03ca, 0x01a7, 0x0784, 0x06c0, 0x05b2,
+	    0x02f8, 0x00b1, 0x0715, 0x0590, 0x00a5, 0x010e, 0x0194, 0x0000,
+	    0x00a7, 0x079f, 0x0253, 0x07bf, 0x00f7, 0x07ca, 0x0509, 0x01c8,
+	    0x0715, 0x0077, 0x041b, 0x05dd, 0x0000, 0x0435, 0x03fc, 0x02e0,
+	    0x0455, 0x06bd, 0x01ed, 0x0000, 0x02ff, 0x0416, 0x01c0, 0x00c8,
+	    0x0623, 0x03ed, 0x06d4, 0x0000, 0x0000, 0x00ea, 0x0391, 0x0047,
+	    0x0000, 0x0475, 0x00a4, 0x049c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0149, 0x04a2, 0x015b, 0x0000, 0x0380, 0x0000, 0x0373, 0x0789,
+	    0x0000, 0x026c, 0x00b1, 0x0000, 0x078d, 0x02ae, 0x0000, 0x018d,
+	    0x044a, 0x0244, 0x0735, 0x0109, 0x0702, 0x01a8, 0x02e9, 0x00d5,
+	    0x0000, 0x00dc, 0x01d2, 0x0526, 0x01d5, 0x0000, 0x0000, 0x0000,
+	    0x019b, 0x0216, 0x05ba, 0x0625, 0x00bb, 0x0000, 0x05ac, 0x05e3,
+	    0x0092, 0x0380, 0x00aa, 0x0428, 0x0000, 0x0570, 0x0484, 0x0195,
+	    0x0000, 0x065a, 0x0000, 0x0004, 0x0704, 0x0654, 0x03e2, 0x0202,
+	    0x0446, 0x076d, 0x0305, 0x0000, 0x0209, 0x00e5, 0x01a4, 0x0106,
+	    0x02cb, 0x0069, 0x0000, 0x02aa, 0x0598, 0x0024, 0x00b2, 0x0079,
+	    0x02ed, 0x0509, 0x0000, 0x0793, 0x0382, 0x0554, 0x0088, 0x0096,
+	    0x0516, 0x0226, 0x0418, 0x03f2, 0x0364, 0x0000, 0x006f, 0x0000,
+	    0x0722, 0x01d2, 0x0000, 0x06a5, 0x0000, 0x045d, 0x04bb, 0x0343,
+	    0x0000, 0x0000, 0x0000, 0x0011, 0x0468, 0x032d, 0x0612, 0x001c,
+	    0x0000,
+	};
+	uint16_t h[8];
+
+	_fixedhash(key, (uint64_t*)h);
+
+	h[0] = h[0] % 2481;
+	h[1] = h[1] % 2481;
+	h[2] = h[2] % 2481;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 2000;
+}
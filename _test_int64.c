@@ -0,0 +1,734 @@
+/* generated with rurban/nbperf 08a5797 -L _rand64 */
+/* seed[0]: 783368690, seed[1]: 1102520059 */
+#include <stdint.h>
+
+static inline uint64_t _inthash64(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return x ^ (x >> 31);
+}
+
+static inline void _inthash2(const uint64_t key, uint32_t *h)
+{
+	*h = (uint32_t)_inthash64(key + UINT64_C(0x41b71efb2eb141f2));
+}
+
+const uint64_t inthash_keys[2000] = {
+	18446732898204647429u, 1906965479429, 18446738790899777541u, 18446737588308934661u, 8469675507717, 17059610099717, 18446738533201739781u, 16922171146245, 18446732245369618437u, 18446733740018237445u,	/* 10 */
+	3435973836805, 18446735269026594821u, 16767552323589, 8658654068741, 18446742312772960261u, 18446739649893236741u, 18446728740676304901u, 18446728946834735109u, 13606456393733, 5050881540101,	/* 20 */
+	3212635537413, 3264175144965, 2456721293317, 18446734238234443781u, 18446735354925940741u, 18446738773719908357u, 6614249635845, 8778913153029, 18446735372105809925u, 18446735217486987269u,	/* 30 */
+	18446742553291128837u, 18446741196081463301u, 18446742690730082309u, 16269336117253, 18446737468049850373u, 18446734736450650117u, 12867722018821, 18446737485229719557u, 8177617731589, 18446740079389966341u,	/* 40 */
+	12747462934533, 841813590021, 2611340115973, 5531917877253, 14156212207621, 18446737880366710789u, 4071628996613, 18446739787332190213u, 18446737639848542213u, 18446736780855083013u,	/* 50 */
+	18446736626236260357u, 12317966204933, 4174708211717, 18446740629145780229u, 14809047236613, 11974368821253, 18446736162379792389u, 18446740560426303493u, 14723147890693, 1803886264325,	/* 60 */
+	18446739014238076933u, 9723805958149, 18446740388627611653u, 6803228196869, 3848290697221, 18446734135155228677u, 14139032338437, 18446741470959370245u, 9603546873861, 18446731059958644741u,	/* 70 */
+	18446739443734806533u, 18446736557516783621u, 18446733430780592133u, 12060268167173, 18446727589625069573u, 18446736265459007493u, 7610682048517, 18446738722180300805u, 5153960755205, 18446736798034952197u,	/* 80 */
+	18446742415852175365u, 13846974562309, 18446732881024778245u, 18446728276819836933u, 11269994184709, 18446730011986624517u, 8418135900165, 18446732743585824773u, 18446737914726449157u, 18446743618443018245u,	/* 90 */
+	18446731575354720261u, 18446736952653774853u, 601295421445, 18446737777287495685u, 18446732314089095173u, 18446736385718091781u, 9929964388357, 2319282339845, 3332894621701, 18446732915384516613u,	/* 100 */
+	18446730407123615749u, 2370821947397, 7885559955461, 18446731128678121477u, 18446735337746071557u, 12455405158405, 16836271800325, 18446736712135606277u, 3831110828037, 18446729118633426949u,	/* 110 */
+	8280696946693, 14551349198853, 18446743773061840901u, 13262859010053, 18446742003535314949u, 9088150798341, 11063835754501, 18446727641164677125u, 10874857193477, 18446734530292219909u,	/* 120 */
+	18446731472275505157u, 18446727125768601605u, 10393820856325, 18446739615533498373u, 3161095929861, 18446728637597089797u, 9191230013445, 18446735028508426245u, 18446738000625795077u, 18446739220396507141u,	/* 130 */
+	18446729788648325125u, 515396075525, 18446737897546579973u, 18446736866754428933u, 10033043603461, 18446740096569835525u, 18446736059300577285u, 18446737072912859141u, 4105988734981, 17145509445637,	/* 140 */
+	18446731403556028421u, 18446739856051666949u, 12386685681669, 18446737742927757317u, 7473243095045, 18446734478752612357u, 18446727486545854469u, 6579889897477, 18446741075822379013u, 927712935941,	/* 150 */
+	18446729668389240837u, 8074538516485, 18446734410033135621u, 223338299397, 18446737158812205061u, 18446735664163586053u, 6734508720133, 18446732674866348037u, 687194767365, 18446742982787858437u,	/* 160 */
+	18446743687162494981u, 1958505086981, 18446734753630519301u, 18446741900456099845u, 18446728122201014277u, 12799002542085, 18446730733541130245u, 18446734169514967045u, 8675833937925, 18446742158154137605u,	/* 170 */
+	18446727520905592837u, 18446734925429211141u, 18446736918294036485u, 18446742055074922501u, 18446739186036768773u, 10909216931845, 18446735784422670341u, 18446736007760969733u, 15066745274373, 12403865550853,	/* 180 */
+	3917010173957, 15169824489477, 15118284881925, 18446739873231536133u, 18446736763675213829u, 6408091205637, 8263517077509, 15822659518469, 18446732434348179461u, 12043088297989,	/* 190 */
+	18446728895295127557u, 9053791059973, 15874199126021, 18446731987671580677u, 18446737261891420165u, 14912126451717, 16217796509701, 18446743979220271109u, 18446742381492436997u, 18446727727064023045u,	/* 200 */
+	16406775070725, 1202590842885, 11338713661445, 18446734839529865221u, 18446732451528048645u, 18446736694955737093u, 5944234737669, 18446743721522233349u, 18446735389285679109u, 10771777978373,	/* 210 */
+	12128987643909, 18446729049913950213u, 1872605741061, 10239202033669, 18446740371447742469u, 3384434229253, 18446729719928848389u, 12987981103109, 7593502179333, 14705968021509,	/* 220 */
+	18446740302728265733u, 18446744065119617029u, 18446735440825286661u, 14070312861701, 4226247819269, 18446741831736623109u, 18446736179559661573u, 13743895347205, 18446737553949196293u, 18446739993490620421u,	/* 230 */
+	3298534883333, 7971459301381, 18446728379899052037u, 15891378995205, 9431748182021, 5703716569093, 326417514501, 4535485464581, 18446727555265331205u, 7043746365445,	/* 240 */
+	18446727400646508549u, 412316860421, 2834678415365, 18446733465140330501u, 7748121001989, 1769526525957, 18446736505977176069u, 18446739924771143685u, 9569187135493, 14791867367429,	/* 250 */
+	18446731884592365573u, 12077448036357, 18446728998374342661u, 16784732192773, 3693671874565, 18446727160128339973u, 7902739824645, 13778255085573, 18446727228847816709u, 10307921510405,	/* 260 */
+	10960756539397, 8899172237317, 18446731266117074949u, 11544872091653, 8040178778117, 18446730372763877381u, 18446735973401231365u, 18446739289115983877u, 18446727984762060805u, 18446742020715184133u,	/* 270 */
+	18446741333520416773u, 1924145348613, 16939351015429, 18446736935473905669u, 15616501088261, 6047313952773, 18446739941951012869u, 14104672600069, 18446733344881246213u, 18446732176650141701u,	/* 280 */
+	18446728242460098565u, 5617817223173, 18446735200307118085u, 18446736351358353413u, 18446734959788949509u, 14035953123333, 18446739632713367557u, 3058016714757, 15255723835397, 8126078124037,	/* 290 */
+	18446743601263149061u, 18446742759449559045u, 1425929142277, 9225589751813, 18446737691388149765u, 18446741797376884741u, 14276471291909, 18446740852484079621u, 18446736213919399941u, 15101105012741,	/* 300 */
+	257698037765, 18446740646325649413u, 2628519985157, 18446729530950287365u, 10823317585925, 18446731678433935365u, 18446728139380883461u, 18446727606804938757u, 18446738292683571205u, 18446740354267873285u,	/* 310 */
+	15444702396421, 18446742433032044549u, 18446730888159952901u, 18446734083615621125u, 3075196583941, 9964324126725, 18446731231757336581u, 18446740680685387781u, 18446732692046217221u, 4123168604165,	/* 320 */
+	3246995275781, 10273561772037, 18446741711477538821u, 17179869184005, 15908558864389, 5394478923781, 9242769620997, 9036611190789, 4982162063365, 14413910245381,	/* 330 */
+	11510512353285, 11854109736965, 9397388443653, 3882650435589, 18446738103705010181u, 15805479649285, 3281355014149, 5961414606853, 9363028705285, 18446743566903410693u,	/* 340 */
+	11785390260229, 8022998908933, 18446735406465548293u, 18446733327701377029u, 10204842295301, 7988639170565, 18446727864502976517u, 18446738120884879365u, 9156870275077, 18446734152335097861u,	/* 350 */
+	18446732348448833541u, 11562051960837, 18446735492364894213u, 11699490914309, 18446740526066565125u, 18446728586057482245u, 18446728431438659589u, 18446739976310751237u, 13073880449029, 18446732125110534149u,	/* 360 */
+	1168231104517, 3642132267013, 14293651161093, 13228499271685, 18446739271936114693u, 8521215115269, 18446738636280954885u, 6717328850949, 18446731180217729029u, 8985071583237,	/* 370 */
+	18446730991239168005u, 18446741110182117381u, 1889785610245, 4277787426821, 5497558138885, 18446731540994981893u, 18446737004193382405u, 18446740886843817989u, 18446730218145054725u, 15547781611525,	/* 380 */
+	16819091931141, 6476810682373, 18446742467391782917u, 9826885173253, 18446733860277321733u, 18446727177308209157u, 11493332484101, 6820408066053, 18446741883276230661u, 18446729685569110021u,	/* 390 */
+	18446740405807480837u, 18446732382808571909u, 5480378269701, 14053132992517, 8847632629765, 1563368095749, 14431090114565, 18446732709226086405u, 12884901888005, 12816182411269,	/* 400 */
+	11287174053893, 1477468749829, 14173392076805, 8366596292613, 6957847019525, 7370163879941, 18446734770810388485u, 13640816132101, 910533066757, 18446740148109443077u,	/* 410 */
+	4209067950085, 18446736523157045253u, 1443109011461, 15685220564997, 18446732331268964357u, 18446734203874705413u, 3899830304773, 4483945857029, 15530601742341, 1735166787589,	/* 420 */
+	18446738223964094469u, 10514079940613, 18446728105021145093u, 1717986918405, 7198365188101, 11836929867781, 18446728964014604293u, 18446742639190474757u, 2302102470661, 18446730080706101253u,	/* 430 */
+	18446735921861623813u, 5669356830725, 16372415332357, 1649267441669, 13537736916997, 3539053051909, 18446729926087278597u, 18446732571787132933u, 18446735990581100549u, 5995774345221,	/* 440 */
+	18446738756540039173u, 3624952397829, 704374636549, 18446731008419037189u, 9637906612229, 18446738086525140997u, 17162689314821, 18446730905339822085u, 11768210391045, 18446736299818745861u,	/* 450 */
+	18446739151677030405u, 18446741281980809221u, 18446733808737714181u, 18446742484571652101u, 8108898254853, 2405181685765, 18446743463824195589u, 18446739237576376325u, 2972117368837, 5720896438277,	/* 460 */
+	18446729908907409413u, 2336462209029, 18446728053481537541u, 15204184227845, 10754598109189, 4741643894789, 18446742536111259653u, 7541962571781, 7284264534021, 2731599200261,	/* 470 */
+	18446738155244617733u, 3573412790277, 18446734117975359493u, 15479062134789, 18446730286864531461u, 18446738687820562437u, 14018773254149, 18446741814556753925u, 10222022164485, 7387343749125,	/* 480 */
+	15633680957445, 3745211482117, 18446735595444109317u, 18446736093660315653u, 6150393167877, 18446743704342364165u, 7799660609541, 4243427688453, 16028817948677, 7627861917701,	/* 490 */
+	18446731936131973125u, 4312147165189, 13383118094341, 18446739168856899589u, 18446739478094544901u, 13864154431493, 11046655885317, 18446741556858716165u, 18446741969175576581u, 18446742450211913733u,	/* 500 */
+	7696581394437, 18446742037895053317u, 13572096655365, 14121852469253, 18446728775036043269u, 18446740216828919813u, 18446737502409588741u, 18446729891727540229u, 3470333575173, 18446729273252249605u,	/* 510 */
+	3040836845573, 18446733654118891525u, 4432406249477, 12163347382277, 18446736883934298117u, 5789615915013, 2388001816581, 18446743206126157829u, 18446739804512059397u, 1236950581253,	/* 520 */
+	18446742089434660869u, 18446740869663948805u, 18446741591218454533u, 16527034155013, 15341623181317, 18446732554607263749u, 790273982469, 18446730527382700037u, 10050223472645, 18446742329952829445u,	/* 530 */
+	4861902979077, 7215545057285, 16063177687045, 18446729994806755333u, 18446738979878338565u, 17111149707269, 14242111553541, 8504035246085, 18446743154586550277u, 18446732056391057413u,	/* 540 */
+	6665789243397, 5308579577861, 18446733619759153157u, 13091060318213, 16166256902149, 18446739701432844293u, 3504693313541, 18446731437915766789u, 2817498546181, 18446729599669764101u,	/* 550 */
+	18446734513112350725u, 18446729015554211845u, 446676598789, 18446728001941929989u, 6562710028293, 18446743910500794373u, 16612933500933, 12094627905541, 4552665333765, 16544214024197,	/* 560 */
+	18446729410691203077u, 18446740268368527365u, 15083925143557, 18446738172424486917u, 4827543240709, 8211977469957, 18446733276161769477u, 18446729032734081029u, 1357209665541, 18446742261233352709u,	/* 570 */
+	18446729359151595525u, 18446740422987350021u, 18446732211009880069u, 18446731506635243525u, 4587025072133, 18446737210351812613u, 13056700579845, 18446735646983716869u, 18446729152993165317u, 18446742398672306181u,	/* 580 */
+	18446732073570926597u, 14345190768645, 6012954214405, 2765958938629, 16733192585221, 3109556322309, 18446733310521507845u, 18446743395104718853u, 16303695855621, 18446731094318383109u,	/* 590 */
+	14620068675589, 7404523618309, 12730283065349, 9294309228549, 18446734976968818693u, 12472585027589, 14259291422725, 18446734495932481541u, 5325759447045, 10806137716741,	/* 600 */
+	5188320493573, 18446728671956828165u, 18446738842439385093u, 18446743790241710085u, 18446729445050941445u, 18446727709884153861u, 18446743257665765381u, 13365938225157, 9792525434885, 18446743326385242117u,	/* 610 */
+	18446735681343455237u, 1151051235333, 2954937499653, 18446730132245708805u, 18446736231099269125u, 3985729650693, 18446730493022961669u, 18446742278413221893u, 68719476741, 8143257993221,	/* 620 */
+	18446731489455374341u, 18446740165289312261u, 18446739959130882053u, 11098195492869, 14637248544773, 18446737846006972421u, 18446741866096361477u, 7060926234629, 4569845202949, 18446729737108717573u,	/* 630 */
+	18446733258981900293u, 18446731850232627205u, 377957122053, 18446738481662132229u, 14482629722117, 18446730149425577989u, 670014898181, 18446729960447016965u, 4999341932549, 13950053777413,	/* 640 */
+	18446730682001522693u, 18446734255414312965u, 18446730458663223301u, 4054449127429, 11733850652677, 18446729084273688581u, 13554916786181, 18446729307611987973u, 1305670057989, 18446741299160678405u,	/* 650 */
+	18446727898862714885u, 11012296146949, 18446740715045126149u, 1546188226565, 1632087572485, 18446729823008063493u, 18446740921203556357u, 18446728397078921221u, 1047972020229, 11458972745733,	/* 660 */
+	9809705304069, 18446737622668673029u, 11613591568389, 4260607557637, 18446733705658499077u, 9758165696517, 13761075216389, 13675175870469, 18446736815214821381u, 9380208574469,	/* 670 */
+	18446738705000431621u, 18446736437257699333u, 18446730561742438405u, 18446741350700285957u, 395136991237, 566935683077, 18446743807421579269u, 18446731334836551685u, 10325101379589, 13812614823941,	/* 680 */
+	15650860826629, 2130303778821, 549755813893, 18446728981194473477u, 18446736849574559749u, 18446737227531681797u, 1099511627781, 18446729135813296133u, 14499809591301, 18446727091408863237u,	/* 690 */
+	18446739323475722245u, 18446740611965911045u, 10857677324293, 18446735578264240133u, 18446727572445200389u, 18446734787990257669u, 18446742347132698629u, 13726715478021, 18446736677775867909u, 9122510536709,	/* 700 */
+	12627203850245, 15857019256837, 2010044694533, 2525440770053, 18446728208100360197u, 18446731077138513925u, 18446731369196290053u, 6631429505029, 16423954939909, 18446731163037859845u,	/* 710 */
+	6356551598085, 13159779794949, 18446727366286770181u, 8607114461189, 11871289606149, 18446730647641784325u, 18446738395762786309u, 6116033429509, 18446729393511333893u, 18446741058642509829u,	/* 720 */
+	4638564679685, 18446741178901594117u, 18446736746495344645u, 18446729479410679813u, 3178275799045, 85899345925, 6528350289925, 6975026888709, 10788957847557, 18446734667731173381u,	/* 730 */
+	18446732777945563141u, 18446736729315475461u, 18446729204532772869u, 18446735114407772165u, 11029476016133, 8057358647301, 18446733207442292741u, 18446736987013513221u, 18446731970491711493u, 18446733362061115397u,	/* 740 */
+	18446729582489894917u, 14001593384965, 9311489097733, 18446727280387424261u, 16045997817861, 5566277615621, 18446741127361986565u, 9672266350597, 16458314678277, 18446728603237351429u,	/* 750 */
+	18446727297567293445u, 2783138807813, 18446738189604356101u, 1614907703301, 5755256176645, 18446734461572743173u, 18446743360744980485u, 4604204941317, 15238543966213, 18446742501751521285u,	/* 760 */
+	1391569403909, 18446737519589457925u, 18446743085867073541u, 10015863734277, 16234976378885, 18446731592534589445u, 15187004358661, 3968549781509, 18446743996400140293u, 8710193676293,	/* 770 */
+	12335146074117, 14929306320901, 3487513444357, 9414568312837, 13280038879237, 14448269983749, 18446738464482263045u, 2594160246789, 18446743034327465989u, 18446739392195198981u,	/* 780 */
+	18446742192513875973u, 18446740337088004101u, 8538394984453, 188978561029, 18446741488139239429u, 18446731111498252293u, 4191888080901, 18446741436599631877u, 2353642078213, 2645699854341,	/* 790 */
+	18446735698523324421u, 8160437862405, 10840497455109, 18446736196739530757u, 6511170420741, 18446736368538222597u, 18446729513770418181u, 18446734908249341957u, 18446732365628702725u, 3229815406597,	/* 800 */
+	18446733104363077637u, 18446734873889603589u, 10582799417349, 944892805125, 12558484373509, 7335804141573, 18446730630461915141u, 18446743292025503749u, 7524782702597, 2113123909637,	/* 810 */
+	7232724926469, 1219770712069, 18446743858961186821u, 18446741917635969029u, 6373731467269, 5257039970309, 15272903704581, 9328668966917, 15015205666821, 6906307411973,	/* 820 */
+	18446743137406681093u, 12541304504325, 18446727847323107333u, 18446731901772234757u, 6923487281157, 18446728225280229381u, 18446736832394690565u, 16870631538693, 2903397892101, 18446734375673397253u,	/* 830 */
+	18446741745837277189u, 8400956030981, 8796093022213, 18446733155902685189u, 18446742948428120069u, 858993459205, 18446730699181391877u, 18446734272594182149u, 18446729634029502469u, 18446728173740621829u,	/* 840 */
+	1340029796357, 16131897163781, 18446739838871797765u, 13022340841477, 4088808865797, 6768868458501, 1082331758597, 18446738601921216517u, 5274219839493, 18446741453779501061u,	/* 850 */
+	18446735286206464005u, 18446740113749704709u, 18446730613282045957u, 8881992368133, 12300786335749, 18446729754288586757u, 7146825580549, 34359738373, 18446739563993890821u, 8452495638533,	/* 860 */
+	18446739821691928581u, 1030792151045, 7490422964229, 18446738498842001413u, 4518305595397, 18446733791557844997u, 18446738653460824069u, 18446742879708643333u, 18446737021373251589u, 4415226380293,	/* 870 */
+	18446734306953920517u, 9706626088965, 18446735543904501765u, 18446727795783499781u, 18446736969833644037u, 18446731781513150469u, 18446738567561478149u, 11115375362053, 18446744030759878661u, 18446734066435751941u,	/* 880 */
+	5927054868485, 13039520710661, 8435315769349, 5360119185413, 18446729771468455941u, 7301444403205, 18446727881682845701u, 7129645711365, 18446727005509517317u, 18446737536769327109u,	/* 890 */
+	15410342658053, 18446742656370343941u, 12781822672901, 9277129359365, 18446740989923033093u, 12919261626373, 13829794693125, 4157528342533, 9775345565701, 18446730338404139013u,	/* 900 */
+	3350074490885, 10136122818565, 1494648619013, 18446734100795490309u, 10153302687749, 18446739357835460613u, 18446733482320199685u, 2422361554949, 5016521801733, 15049565405189,	/* 910 */
+	10256381902853, 12970801233925, 8332236554245, 5291399708677, 18446738361403047941u, 13194139533317, 18446732932564385797u, 18446732812305301509u, 15358803050501, 18446740732224995333u,	/* 920 */
+	10737418240005, 18446731248937205765u, 4346506903557, 18446731558174851077u, 18446738825259515909u, 18446728482978267141u, 1992864825349, 18446737674208280581u, 18446728860935389189u, 18446736248279138309u,	/* 930 */
+	3195455668229, 3676492005381, 18446728345539313669u, 9105330667525, 6854767804421, 16647293239301, 11716670783493, 16441134809093, 18446728689136697349u, 18446741728657408005u,	/* 940 */
+	18446737605488803845u, 9878424780805, 6425271074821, 18446738258323832837u, 8950711844869, 2662879723525, 292057776133, 18446742364312567813u, 6064493821957, 1941325217797,	/* 950 */
+	5428838662149, 10479720202245, 10531259809797, 7438883356677, 18446742999967727621u, 13211319402501, 12713103196165, 16320875724805, 2044404432901, 14671608283141,	/* 960 */
+	18446730269684662277u, 10995116277765, 2267742732293, 18446733379240984581u, 18446743515363803141u, 18446728070661406725u, 12283606466565, 11184094838789, 6236292513797, 4398046511109,	/* 970 */
+	5978594476037, 1975684956165, 15290083573765, 17076789968901, 18446735475185025029u, 16097537425413, 18446736488797306885u, 17093969838085, 16973710753797, 18446730475843092485u,	/* 980 */
+	15925738733573, 5806795784197, 18446732657686478853u, 18446727778603630597u, 18446728568877613061u, 1460288880645, 18446732142290403333u, 979252543493, 18446734616191565829u, 18446740749404864517u,	/* 990 */
+	2199023255557, 18446741951995707397u, 18446739306295853061u, 18446741505319108613u, 3126736191493, 16183436771333, 13795434954757, 18446737931906318341u, 6219112644613, 18446743584083279877u,	/* 1000 */
+	18446741574038585349u, 18446727383466639365u, 11081015623685, 18446732623326740485u, 12661563588613, 18446734684911042565u, 18446727761423761413u, 16475494547461, 18446732090750795781u, 2851858284549,	/* 1010 */
+	16011638079493, 18446739907591274501u, 5068061409285, 15994458210309, 18446734719270780933u, 6133213298693, 18446730097885970437u, 4690104287237, 18446742673550213125u, 18446742793809297413u,	/* 1020 */
+	8744553414661, 18446743738702102533u, 18446730063526232069u, 18446738945518600197u, 18446732417168310277u, 11802570129413, 1580547964933, 18446726936790040581u, 18446744047939747845u, 15582141349893,	/* 1030 */
+	171798691845, 2216203124741, 18446738997058207749u, 14190571945989, 10977936408581, 5600637353989, 16716012716037, 4964982194181, 12489764896773, 18446731300476813317u,	/* 1040 */
+	9483287789573, 18446742914068381701u, 13589276524549, 18446729616849633285u, 18446743051507335173u, 18446733602579283973u, 18446743446644326405u, 16389595201541, 18446741230441201669u, 5583457484805,	/* 1050 */
+	7645041786885, 16630113370117, 6184752906245, 18446743412284588037u, 18446736471617437701u, 18446728843755520005u, 11905649344517, 18446735612623978501u, 5377299054597, 18446742896888512517u,	/* 1060 */
+	7078106103813, 18446738378582917125u, 18446738670640693253u, 8572754722821, 18446731025598906373u, 7679401525253, 18446727108588732421u, 18446737760107626501u, 51539607557, 18446730853800214533u,	/* 1070 */
+	12592844111877, 18446743103046942725u, 4020089389061, 8005819039749, 18446740543246434309u, 18446734599011696645u, 3315714752517, 18446733963356536837u, 18446728362719182853u, 15771119910917,	/* 1080 */
+	2714419331077, 15221364097029, 18446740199649050629u, 18446731695613804549u, 18446727417826377733u, 18446733173082554373u, 3367254360069, 8349416423429, 18446735045688295429u, 9259949490181,	/* 1090 */
+	18446727331927031813u, 18446732795125432325u, 18446735011328557061u, 16561393893381, 18446733997716275205u, 18446741144541855749u, 18446739117317292037u, 5634997092357, 18446727435006246917u, 18446740491706826757u,	/* 1100 */
+	18446733911816929285u, 7164005449733, 18446732262549487621u, 18446737794467364869u, 4002909519877, 18446736076480446469u, 18446733499500068869u, 498216206341, 18446727246027685893u, 8315056685061,	/* 1110 */
+	3951369912325, 18446740766584733701u, 13915694039045, 18446733671298760709u, 11132555231237, 18446740027850358789u, 18446732159470272517u, 9689446219781, 18446726971149778949u, 6098853560325,	/* 1120 */
+	11407433138181, 18446743944860532741u, 11441792876549, 18446728517338005509u, 18446730922519691269u, 18446740251188658181u, 14310831030277, 14087492730885, 2869038153733, 18446729805828194309u,	/* 1130 */
+	6253472382981, 18446741625578192901u, 5514738008069, 18446734289774051333u, 18446736591876521989u, 17179869189, 7249904795653, 8297876815877, 18446738344223178757u, 16252156248069,	/* 1140 */
+	9586367004677, 18446738309863440389u, 18446730802260606981u, 18446742931248250885u, 7834020347909, 18446734032076013573u, 18446742587650867205u, 7559142440965, 18446735956221362181u, 18446729977626886149u,	/* 1150 */
+	18446738052165402629u, 18446741522498977797u, 652835028997, 8624294330373, 11991548690437, 13451837571077, 11321533792261, 18446735234666856453u, 6442450944005, 18446735303386333189u,	/* 1160 */
+	18446734358493528069u, 18446728757856174085u, 18446737416510242821u, 18446742209693745157u, 773094113285, 18446732829485170693u, 15736760172549, 10170482556933, 13125420056581, 5171140624389,	/* 1170 */
+	18446729324791857157u, 18446729496590548997u, 8091718385669, 18446733757198106629u, 18446736420077830149u, 18446741677117800453u, 5875515260933, 9912784519173, 18446737399330373637u, 8383776161797,	/* 1180 */
+	18446736316998615045u, 3023656976389, 4913442586629, 7009386627077, 4930622455813, 18446727503725723653u, 11424613007365, 18446742862528774149u, 6682969112581, 18446730200965185541u,	/* 1190 */
+	6322191859717, 18446727263207555077u, 12936441495557, 18446728706316566533u, 18446744013580009477u, 1322849927173, 5686536699909, 7456063225861, 8967891714053, 9620726743045,	/* 1200 */
+	8486855376901, 18446729238892511237u, 18446734805170126853u, 9981503995909, 18446734221054574597u, 18446742570470998021u, 206158430213, 11476152614917, 103079215109, 18446738275503702021u,	/* 1210 */
+	13709535608837, 18446731918952103941u, 10496900071429, 1185410973701, 9534827397125, 721554505733, 18446738206784225285u, 14602888806405, 18446731626894327813u, 18446732485887787013u,	/* 1220 */
+	18446727538085462021u, 18446731833052758021u, 18446728448618528773u, 18446733946176667653u, 4037269258245, 18446733413600722949u, 18446740182469181445u, 18446737983445925893u, 5892695130117, 1855425871877,	/* 1230 */
+	18446738619101085701u, 18446740800944472069u, 11922829213701, 18446727950402322437u, 137438953477, 18446742828169035781u, 18446733087183208453u, 18446726953969909765u, 8933531975685, 18446731386376159237u,	/* 1240 */
+	18446737811647234053u, 8813272891397, 6751688589317, 15702400434181, 11235634446341, 18446727194488078341u, 14877766713349, 18446740818124341253u, 18446728414258790405u, 13898514169861,	/* 1250 */
+	6270652252165, 18446736282638876677u, 18446733722838368261u, 15393162788869, 18446731764333281285u, 18446727830143238149u, 18446733980536406021u, 18446735183127248901u, 18446736901114167301u, 12369505812485,	/* 1260 */
+	360777252869, 4810363371525, 18446729943267147781u, 18446732004851449861u, 18446727812963368965u, 4329327034373, 18446733052823470085u, 1288490188805, 18446730441483354117u, 18446742106614530053u,	/* 1270 */
+	18446731317656682501u, 18446734564651958277u, 18446739512454283269u, 16080357556229, 18446737141632335877u, 18446726988329648133u, 18446729376331464709u, 18446737949086187525u, 7181185318917, 18446735148767510533u,	/* 1280 */
+	18446739082957553669u, 18446734702090911749u, 5446018531333, 18446738138064748549u, 18446739735792582661u, 2078764171269, 11819749998597, 18446728190920491013u, 4655744548869, 18446727142948470789u,	/* 1290 */
+	7352984010757, 18446729565310025733u, 10445360463877, 7782480740357, 18446740697865256965u, 8864812498949, 18446734049255882757u, 635655159813, 10376640987141, 18446741642758062085u,	/* 1300 */
+	18446733224622161925u, 12232066859013, 2164663517189, 18446737382150504453u, 16956530884613, 17042430230533, 18446733241802031109u, 18446738876799123461u, 18446740783764602885u, 18446740062210097157u,	/* 1310 */
+	18446739426554937349u, 18446743429464457221u, 5085241278469, 18446739460914675717u, 18446732399988441093u, 18446738962698469381u, 18446730321224269829u, 18446734856709734405u, 11579231830021, 18446731729973542917u,	/* 1320 */
+	18446733533859807237u, 18446737725747888133u, 12249246728197, 18446731661254066181u, 7730941132805, 15668040695813, 18446741247621070853u, 824633720837, 7868380086277, 120259084293,	/* 1330 */
+	18446741264800940037u, 15719580303365, 6493990551557, 18446740972743163909u, 18446736024940838917u, 18446739031417946117u, 18446742810989166597u, 18446742072254791685u, 18446743498183933957u, 15942918602757,	/* 1340 */
+	18446741848916492293u, 18446730956879429637u, 18446730578922307589u, 15513421873157, 12197707120645, 12214886989829, 18446728929654865925u, 18446727967582191621u, 10668698763269, 18446736454437568517u,	/* 1350 */
+	18446727744243892229u, 18446734341313658885u, 18446735423645417477u, 2233382993925, 18446731609714458629u, 18446734822349996037u, 18446743309205372933u, 18446740835304210437u, 18446728809395781637u, 3728031612933,	/* 1360 */
+	12421045420037, 9500467658757, 3401614098437, 18446729548130156549u, 4793183502341, 18446727623984807941u, 481036337157, 18446740234008788997u, 7919919693829, 16355235463173,	/* 1370 */
+	11373073399813, 18446743120226811909u, 18446739065777684485u, 10462540333061, 18446742140974268421u, 18446735732883062789u, 18446730252504793093u, 2989297238021, 18446743017147596805u, 18446737244711550981u,	/* 1380 */
+	8641474199557, 1013612281861, 14379550507013, 18446737571129065477u, 463856467973, 18446733293341638661u, 3762391351301, 6889127542789, 18446738911158861829u, 18446730870980083717u,	/* 1390 */
+	4294967296005, 3521873182725, 18446740457347088389u, 13932873908229, 10685878632453, 16338055593989, 18446736643416129541u, 18446737828827103237u, 18446741385060024325u, 18446729256072380421u,	/* 1400 */
+	16853451669509, 18446734547472089093u, 18446738808079646725u, 2576980377605, 18446731953311842309u, 18446733001283862533u, 18446739890411405317u, 9517647527941, 15599321219077, 13623636262917,	/* 1410 */
+	18446742707909951493u, 18446730767900868613u, 10084583211013, 18446741024282771461u, 18446740440167219205u, 18446743274845634565u, 4466765987845, 18446741539678846981u, 11252814315525, 18446733636939022341u,	/* 1420 */
+	1838246002693, 18446734650551304197u, 8830452760581, 18446733877457190917u, 18446732228189749253u, 18446733121542946821u, 18446726902430302213u, 15564961480709, 18446730424303484933u, 18446728293999706117u,	/* 1430 */
+	18446735165947379717u, 11596411699205, 18446736128020054021u, 14568529068037, 11630771437573, 18446737090092728325u, 18446727314747162629u, 5652176961541, 18446740938383425541u, 18446730029166493701u,	/* 1440 */
+	18446731455095635973u, 7816840478725, 18446729874547671045u, 18446738069345271813u, 5033701670917, 18446737966266056709u, 1374389534725, 18446734581831827461u, 14465449852933, 18446740045030227973u,	/* 1450 */
+	12008728559621, 16664473108485, 14654428413957, 13692355739653, 16578573762565, 18446740010670489605u, 18446743841781317637u, 2181843386373, 18446743755881971717u, 14362370637829,	/* 1460 */
+	18446735818782408709u, 18446738516021870597u, 6648609374213, 1511828488197, 18446733774377975813u, 10703058501637, 18446743824601448453u, 18446728792215912453u, 343597383685, 18446731352016420869u,	/* 1470 */
+	18446728500158136325u, 18446728465798397957u, 3779571220485, 10892037062661, 18446727452186116101u, 2748779069445, 584115552261, 18446733190262423557u, 14826227105797, 8761733283845,	/* 1480 */
+	18446738430122524677u, 5841155522565, 14585708937221, 9070970929157, 18446732520247525381u, 18446743669982625797u, 18446729462230810629u, 4707284156421, 4449586118661, 18446734444392873989u,	/* 1490 */
+	18446732468707917829u, 9947144257541, 12025908428805, 14980845928453, 18446741367880155141u, 16904991277061, 1683627180037, 3092376453125, 18446741763017146373u, 18446730974059298821u,	/* 1500 */
+	9861244911621, 18446738241143963653u, 1821066133509, 18446737193171943429u, 18446729290432118789u, 18446735062868164613u, 18446737450869981189u, 2920577761285, 18446734942609080325u, 12902081757189,	/* 1510 */
+	18446730664821653509u, 9174050144261, 3796751089669, 15375982919685, 7318624272389, 4758823763973, 6459630813189, 1254130450437, 11647951306757, 4896262717445,	/* 1520 */
+	3006477107205, 6081673691141, 13967233646597, 5823975653381, 18446731042778775557u, 2284922601477, 1597727834117, 7421703487493, 9740985827333, 2491081031685,	/* 1530 */
+	7851200217093, 18446734891069472773u, 7954279432197, 18446739598353629189u, 18446735080048033797u, 18446727658344546309u, 16595753631749, 10187662426117, 13434657701893, 18446728723496435717u,	/* 1540 */
+	3556232921093, 18446727057049124869u, 18446737708568018949u, 14516989460485, 18446737657028411397u, 18446741093002248197u, 18446727349106900997u, 18446742725089820677u, 15427522527237, 18446741780197015557u,	/* 1550 */
+	12111807774725, 18446728878115258373u, 18446727039869255685u, 5909874999301, 16492674416645, 12644383719429, 9139690405893, 3865470566405, 18446732984103993349u, 11888469475333,	/* 1560 */
+	18446742518931390469u, 18446741316340547589u, 18446728654776958981u, 18446737124452466693u, 3418793967621, 18446741041462640645u, 7765300871173, 18446735767242801157u, 12180527251461, 13142599925765,	/* 1570 */
+	16149077032965, 18446727469365985285u, 18446743223306027013u, 9998683865093, 18446738550381608965u, 18446734427213004805u, 18446739203216637957u, 4724464025605, 4672924418053, 1752346656773,	/* 1580 */
+	18446735801602539525u, 18446740663505518597u, 9345848836101, 18446732503067656197u, 6390911336453, 5549097746437, 18446733447960461317u, 13176959664133, 18446739495274414085u, 5772436045829,	/* 1590 */
+	2147483648005, 3453153705989, 18446732588967002117u, 18446729651209371653u, 18446743171766419461u, 18446741934815838213u, 12506944765957, 18446738739360169989u, 15960098471941, 18446730235324923909u,	/* 1600 */
+	2439541424133, 18446735509544763397u, 18446728036301668357u, 18446735251846725637u, 18446741694297669637u, 10943576670213, 18446735715703193605u, 10926396801029, 18446743377924849669u, 18446728259639967749u,	/* 1610 */
+	18446740508886695941u, 18446735904681754629u, 15753940041733, 10290741641221, 738734374917, 755914244101, 7095285972997, 18446733138722816005u, 5239860101125, 14534169329669,	/* 1620 */
+	5342939316229, 18446742295593091077u, 18446727211667947525u, 8246337208325, 6700148981765, 18446732949744254981u, 3143916060677, 18446731712793673733u, 18446741659937931269u, 18446739718612713477u,	/* 1630 */
+	18446731747153412101u, 18446737175992074245u, 18446732537427394565u, 18446732846665039877u, 6201932775429, 18446739409375068165u, 12146167513093, 2508260900869, 18446730510202830853u, 8693013807109,	/* 1640 */
+	6545530159109, 18446741007102902277u, 4140348473349, 18446736145199923205u, 10565619548165, 18446729221712642053u, 17128329576453, 9208409882629, 18446734633371435013u, 18446738584741347333u,	/* 1650 */
+	18446730115065839621u, 18446729341971726341u, 6871947673605, 10342281248773, 18446729170173034501u, 4844723109893, 18446730304044400645u, 2473901162501, 18446740319908134917u, 11682311045125,	/* 1660 */
+	18446728620417220613u, 18446729857367801861u, 3934190043141, 5205500362757, 14396730376197, 2680059592709, 14843406974981, 18446732107930664965u, 18446738928338731013u, 5119601016837,	/* 1670 */
+	1408749273093, 996432412677, 10118942949381, 18446732966924124165u, 12678743457797, 18446741402239893509u, 18446728534517874693u, 2027224563717, 13348758355973, 5738076307461,	/* 1680 */
+	18446729101453557765u, 18446743343565111301u, 18446739667073105925u, 13108240187397, 18446738017805664261u, 18446738327043309573u, 18446735870322016261u, 12610023981061, 18446735320566202373u, 18446742123794399237u,	/* 1690 */
+	18446737330610896901u, 8916352106501, 7267084664837, 14860586844165, 18446743240485896197u, 18446733825917583365u, 18446742622010605573u, 3590592659461, 18446737347790766085u, 7507602833413,	/* 1700 */
+	13417477832709, 18446735131587641349u, 5102421147653, 18446743549723541509u, 10359461117957, 18446729187352903685u, 18446732863844909061u, 18446733516679938053u, 18446742776629428229u, 18446733551039676421u,	/* 1710 */
+	18446739752972451845u, 18446739770152321029u, 18446735561084370949u, 18446740474526957573u, 18446732640506609669u, 18446733070003339269u, 10634339024901, 18446728087841275909u, 18446730166605447173u, 18446730355584008197u,	/* 1720 */
+	6786048327685, 18446730544562569221u, 18446729067093819397u, 18446735458005155845u, 18446727675524415493u, 12953621364741, 13486197309445, 18446738034985533445u, 14740327759877, 18446732193830010885u,	/* 1730 */
+	18446735097227902981u, 18446739375015329797u, 1666447310853, 11355893530629, 15788299780101, 18446736660595998725u, 274877906949, 618475290629, 309237645317, 14757507629061,	/* 1740 */
+	18446728551697743877u, 18446727916042584069u, 14207751815173, 13984413515781, 18446743962040401925u, 10548439678981, 2697239461893, 9019431321605, 18446733928996798469u, 11751030521861,	/* 1750 */
+	12764642803717, 9552007266309, 18446737863186841605u, 18446735750062931973u, 18446733035643600901u, 6940667150341, 18446732760765693957u, 18446734186694836229u, 7112465842181, 18446742175334006789u,	/* 1760 */
+	6287832121349, 5411658792965, 1786706395141, 7937099563013, 6597069766661, 18446734994148687877u, 11957188952069, 14946486190085, 893353197573, 11166914969605,	/* 1770 */
+	807453851653, 7662221656069, 18446735853142147077u, 17025250361349, 7576322310149, 18446733568219545605u, 3813930958853, 18446739546814021637u, 18446731798693019653u, 5222680231941,	/* 1780 */
+	18446742742269689861u, 18446733018463731717u, 11527692222469, 18446727692704284677u, 5463198400517, 18446736110840184837u, 18446734324133789701u, 18446730046346362885u, 6992206757893, 18446737296251158533u,	/* 1790 */
+	1116691496965, 18446730939699560453u, 12833362280453, 18446737313431027717u, 18446728156560752645u, 12352325943301, 16200616640517, 18446743481004064773u, 2886218022917, 12695923326981,	/* 1800 */
+	14328010899461, 9466107920389, 18446728328359444485u, 18446738447302393861u, 8727373545477, 6339371728901, 18446743927680663557u, 18446730785080737797u, 18446742244053483525u, 13520557047813,	/* 1810 */
+	18446727933222453253u, 18446743876141056005u, 16750372454405, 16114717294597, 18446731644074196997u, 18446733688478629893u, 2061584302085, 18446734392853266437u, 13314398617605, 18446733396420853765u,	/* 1820 */
+	18446737279071289349u, 18446727074228994053u, 11149735100421, 10651518894085, 18446736334178484229u, 18446739048597815301u, 9448928051205, 13657996001285, 1529008357381, 18446739254756245509u,	/* 1830 */
+	13297218748421, 18446736609056391173u, 15152644620293, 18446728912474996741u, 4776003633157, 15461882265605, 18446731523815112709u, 17008070492165, 18446741161721724933u, 18446740577606172677u,	/* 1840 */
+	5858335391749, 11390253268997, 18446731145857990661u, 18446729702748979205u, 18446739100137422853u, 6837587935237, 18446731283296944133u, 16698832846853, 12850542149637, 7026566496261,	/* 1850 */
+	18446738859619254277u, 12266426597381, 18446736574696652805u, 18446731197397598213u, 2937757630469, 15977278341125, 4879082848261, 18446735526724632581u, 8194797600773, 9895604649989,	/* 1860 */
+	13005160972293, 18446735629803847685u, 18446741986355445765u, 14224931684357, 18446729840187932677u, 11201274707973, 18446742226873614341u, 2095944040453, 12524124635141, 240518168581,	/* 1870 */
+	18446732296909225989u, 14688788152325, 2800318676997, 18446738893978992645u, 18446730389943746565u, 9002251452421, 18446732039211188229u, 18446737055732989957u, 3607772528645, 1065151889413,	/* 1880 */
+	16801912061957, 962072674309, 18446730836620345349u, 9655086481413, 6305011990533, 14774687498245, 18446728019121799173u, 18446740594786041861u, 1133871366149, 18446732022031319045u,	/* 1890 */
+	11665131175941, 10617159155717, 4621384810501, 14894946582533, 8589934592005, 18446740130929573893u, 18446732279729356805u, 18446734014896144389u, 6167573037061, 18446735887501885445u,	/* 1900 */
+	15135464751109, 18446736402897960965u, 13503377178629, 18446736042120708101u, 13469017440261, 7713761263621, 18446732726405955589u, 15324443312133, 2250562863109, 1700807049221,	/* 1910 */
+	15496242003973, 18446743652802756613u, 10411000725509, 18446735939041492997u, 429496729605, 18446743532543672325u, 12575664242693, 2542620639237, 14963666059269, 10599979286533,	/* 1920 */
+	4363686772741, 18446739134497161221u, 16286515986437, 18446735835962277893u, 16990890622981, 1271310319621, 5136780886021, 14998025797637, 18446742604830736389u, 16509854285829,	/* 1930 */
+	18446731815872888837u, 18446730183785316357u, 18446736540336914437u, 4501125726213, 10101763080197, 8229157339141, 18446728826575650821u, 18446730596102176773u, 18446737364970635269u, 9844065042437,	/* 1940 */
+	2559800508421, 18446730750720999429u, 18446738412942655493u, 18446739340655591429u, 16887811407877, 18446742845348904965u, 18446732606146871301u, 18446731420735897605u, 4947802324997, 11218454577157,	/* 1950 */
+	18446739581173760005u, 18446728311179575301u, 15032385536005, 18446731867412496389u, 18446737433690112005u, 18446739684252975109u, 11940009082885, 16681652977669, 3710851743749, 18446743068687204357u,	/* 1960 */
+	18446742965607989253u, 8555574853637, 10428180594693, 15307263442949, 18446733843097452549u, 13881334300677, 18446741608398323717u, 876173328389, 18446726919610171397u, 18446743188946288645u,	/* 1970 */
+	10067403341829, 18446733585399414789u, 154618822661, 18446727022689386501u, 3659312136197, 18446731214577467397u, 13400297963525, 13245679140869, 18446741419419762693u, 18446733894637060101u,	/* 1980 */
+	10720238370821, 18446740904023687173u, 18446741213261332485u, 6030134083589, 18446740955563294725u, 4380866641925, 18446737107272597509u, 18446740285548396549u, 12438225289221, 532575944709,	/* 1990 */
+	18446730716361261061u, 15839839387653, 18446730819440476165u, 18446729427871072261u, 18446743635622887429u, 18446737038553120773u, 18446739529634152453u, 13331578486789, 11304353923077, 18446743893320925189u,	/* 2000 */
+	};
+uint16_t
+inthash(const uint64_t key)
+{
+	uint16_t result;
+	static const uint16_t g[4001] = {
+	       0,    0,  866,  390,    0,    0,  956,    0,
+	       0,  889, 1469, 1276,    0,    0,    0, 1379,
+	    1495, 1877,    0, 1476,    0,    0, 1543,    0,
+	     127,    0,    0,    0,    0,  446,    0,    0,
+	       0, 1011,    0, 1186,    0,    0,    0,    0,
+	       0, 1867,    0,  351,  631,    0,    0, 1983,
+	       0, 1265,  675,   86, 1567,    0, 1585, 1534,
+	       0,    0,    0,  696,  456,    0,  287,    0,
+	    1655, 1404,  153,  781,    0,    0,    0,    0,
+	       0, 1740,  914,    0, 1686,    0,  135,    0,
+	       0, 1089, 1159,    0, 1006,    0,    0,   90,
+	     257, 1085, 1615,  485,  755,    0,  519,    0,
+	      96, 1509,    0, 1225,    0,   50,    0,    0,
+	       0,  884,  759,    0, 1026,    0,    0,  772,
+	     119,  438,  271,   46,    0,  661,  890,    0,
+	     761,  395, 1895,    0,    0,  353,    0, 1257,
+	       0,    0,    0, 1376, 1296,    0, 1591, 1192,
+	    1252,    0,    0,  990,    0,    0, 1722, 1176,
+	     343,  377,  507,  758,    0,    0,  273,    0,
+	    1594,    0, 1348, 1211,    0,    0,  689,  404,
+	       0,    0, 1560,    0,    0, 1448,  660, 1605,
+	    1156,    0,    0,    0,    0,    0,    0,    0,
+	       0,    0,  924,  752, 1216,  591, 1337,  719,
+	    1271,    0,    0, 1984,   60, 1116, 1742,    0,
+	     937, 1481,  649, 1384,    0,  369,  929, 1180,
+	    1133, 1012, 1762, 1141,    0,    0, 1171,    0,
+	     880,  440,    0,    0,    0,  715, 1070,    0,
+	     509,    0,    0,  958, 1687, 1366,  319,    0,
+	       0,    0,  273,    0, 1870,    0,  425, 1632,
+	    1644,    0, 1404, 1717,    0, 1628,    0,    0,
+	       0,  621, 1248,    0, 1670, 1852, 1313,    0,
+	    1634,    0,    0,    0,    0,    0,  206, 1512,
+	     374,    0, 1281,    0,    0, 1083,    0,  527,
+	       0,  733,    0,    0,    0,  770, 1911,    0,
+	     669,    0, 1502,    0,    0,    0, 1450,  142,
+	       0, 1401, 1489, 1328,    0,    0,    0,  838,
+	       0, 1073,    0,  285,    0, 1617, 1362,    0,
+	       0,  947,    0,    0,  749,    0,    0,  366,
+	     343,  551,    0,    0,    0,    0,    0,    0,
+	    1735,    0,  737,    0,    0, 1321, 1235,    0,
+	       0, 1574,  538,    0,    0, 1542,    0,    0,
+	    1385,    0,   69,    0,  189,    0,    0,    0,
+	    1000,    0, 1562, 1996,  158,    0, 1527, 1773,
+	     420,  623, 1765,    0, 1938,  789,    0,    0,
+	       0,    0,    0,    0,  112, 1287,    0,    0,
+	    1016,    0, 1839, 1851,    0,  211, 1159,  258,
+	    1548, 1458,  643,    0, 1326,    0,    0,  423,
+	    1913,  742,    0,    0,    0, 1595,    0,    0,
+	       0,    0,    0,  344,  188,  731,  607,    0,
+	       0,    0, 1428, 1526,  959,  374, 1446,    0,
+	       0,  974,  466,    0,    0, 1150, 1268, 1660,
+	       0, 1365,    0,    0,    5,   36,    0,    0,
+	       0,    0, 1005,    0,  588,  223,    0,  315,
+	       0, 1694,    0,  394, 1790,    0,    0,    0,
+	       0,    0,  140,    0, 1496,    0,  117, 1929,
+	    1247,    0,    0, 1560,  996,    0,    0,    0,
+	       0, 1187, 1817,  456,    0, 1216,    0,  506,
+	     243,  411,    0,    0, 1063,  618, 1847, 1821,
+	    1040,    0,    0,  822,    0,    0,    0, 1438,
+	    1209,    0,    0,  250,  384,  952,    0,  137,
+	       0,  992,    0,  967,  805, 1737,    0,    0,
+	    1501, 1210,    0, 1756,    0,    0, 1011,    0,
+	     516,    0,    0,  386, 1390,  994,   56, 1564,
+	    1702,  567,    0, 1249, 1703,  961,  876,  969,
+	     547, 1719,  612,    0,    0, 1470,  347,  127,
+	       0, 1951,    0, 1043, 1035, 1193,    0,    0,
+	       0,  119,  138,    0,    0,    0,   28,    0,
+	    1994, 1711,  872,  645,    0,    0,    0,    0,
+	     681,    0,    0,    0, 1569,  163,    0, 1944,
+	    1825, 1021,    0,    0,  481,    0,    0, 1366,
+	       0,  974, 1983,    0,    0,    0,  116,  552,
+	       0,  934,    0,    0,    0,  654,    0,  729,
+	       0,    0, 1171,  844,    0, 1864,    0,    0,
+	       0,    0,    0,    0,    0,   61,    0,    0,
+	       0, 1019,    0,  599, 1447, 1664, 1180,    0,
+	    1866,  942,    0, 1919,    0,  792,    0,  894,
+	       0,  610,    0,  275,  833,    0,    0,    0,
+	    1059,    0,    0,    0,  302,    0, 1832,  210,
+	       0,  622,  356,    0, 1666,    0,    0, 1295,
+	       0,    0, 1864, 1382,    0,    0, 1359, 1845,
+	    1458,    0,  144,    0,    0, 1941, 1863,    0,
+	       0,    0,    0,    0,  382, 1146, 1820,    0,
+	       0, 1777,  981,    0,    0, 1843, 1320,  820,
+	       0,   32,    0,    0,  789,  836,  991,    0,
+	       0, 1619, 1792,  788,    0,    0,    0, 1116,
+	    1832,    0,    0, 1035,    0,    0,    0,    0,
+	       0, 1846, 1175,  540,    0, 1079, 1339,  372,
+	       0,    0, 1948,    0,    0,    0, 1782,    0,
+	       0,    0,    0,    0, 1291, 1727,    0,    0,
+	       0, 1081,  538,  287,    0, 1550,    0,    0,
+	    1878,  454, 1087,  124,    0,    0,    0,    0,
+	     887,  626,    0, 1721, 1796,    0,    0,    0,
+	     363,    0, 1366, 1144,    0,  212,    0, 1037,
+	     341,    0,    0,    0, 1604,  677,  362, 1819,
+	    1373, 1238,    0,  498,    0,    0, 1502,    0,
+	       0,    0,    0,  714, 1207,    0,  211,  407,
+	       0,  208,    0,    0,    0,  255,    0,    0,
+	     508, 1033, 1364,  677,    0,    0, 1217,    0,
+	       0, 1060,  973,  688, 1531,    0,  516, 1152,
+	       0,  317, 1654,  445,    0,    0, 1947,    0,
+	       0,  823,    0,    0,    0,  105,  442,    0,
+	       0,    0,   94,    0,    0,  590, 1141,    0,
+	    1774,    0,  245,  329,    0,    0,    0,    0,
+	     253,    0,  213,  882,    0,    0,  829,    0,
+	       0, 1931,    0,    0,  411,    0,    0,    0,
+	       0,  232,    0,  419,  843, 1932,    0,  254,
+	       0,  413,  377,    0,    0, 1193,    0,    0,
+	     125,    0,    0,  909,    0, 1269,    0,    0,
+	       0,  689, 1141,    0,    0,    0,    0,    0,
+	     773,  977,  172,  896,    0,    0,  741,  661,
+	    1786, 1510, 1432,  422,    0,    0, 1621,    0,
+	       0, 1610,    0,    0, 1739,    0,    0,    0,
+	       0, 1889, 1152,    0,    0,    0, 1009,  940,
+	       0,  165,    0,    0,  479, 1993,    0,    0,
+	       0,   19, 1788, 1914,    0,    0,  213,    0,
+	    1059,    0,    0,    0,    0, 1903, 1966,    0,
+	     468,    0,  121,  662,  686,    0,    0,    0,
+	    1622,    0,    0,    0,  428, 1006, 1998,    0,
+	       0,    0, 1934,    0, 1448,  382,    0, 1234,
+	     741, 1491,   73,    0,  522,  625, 1355,  325,
+	    1640,    0,    0,    0,    0,    0, 1254,    0,
+	       0,    0, 1025, 1597,  179,    0,    0,    0,
+	       0,    0,  197, 1425, 1803,    0, 1511,  184,
+	    1596,    0, 1647,  594,  428,    0, 1369, 1592,
+	    1883, 1469,  537,    0, 1058,    0,  703,  413,
+	     889, 1753,    0,    0, 1951,  788, 1648,  691,
+	       0,    0,    0,    0, 1713,  603,  106, 1666,
+	    1523,    0,    0,    0, 1662,    0,    0,    0,
+	     949,    0,  440,  472, 1578,    0,    0,  170,
+	       0,    0,    0,   59,    2, 1243,    0,  636,
+	    1096,    0,    0,  207,    0,  297,   15,  754,
+	     524,  566, 1458,  476,  907, 1806,    0,    0,
+	    1416,    0,    0, 1791, 1494,    0, 1861, 1289,
+	       0, 1903,    0,  746,    0,  802,    0, 1642,
+	    1361,    0, 1445,    0, 1734,  242,  689, 1863,
+	       0,  179, 1766,    0,    0,    0,  706, 1295,
+	       0,    0,    0,    0,    0,  820, 1818,    0,
+	    1565, 1177,  816,    0, 1830,  727,  281,    0,
+	       0,    0,  781,    0, 1345,    0,  757,  292,
+	    1395, 1433,    0,    0,    0,    0, 1650,    0,
+	    1459, 1261, 1044,   37,    0, 1177, 1227,    0,
+	      63,    0, 1018, 1044,  859,    0,    0,  794,
+	       0,    0,  995, 1643,    0,   85,  469,    0,
+	       0,    0, 1826,    0,    0,    0, 1770, 1392,
+	       0,  494,    0,    0,  387, 1412,    0, 1996,
+	      54,    0,  234,    0, 1609, 1651,    0, 1453,
+	     185,    0,  197,    0,    0,    0,  910,  247,
+	     469,    0, 1004,  108,    0,  748,  266, 1868,
+	       0,    0,    0,  412,    0,  914,    0,    0,
+	       0,    0,  668,    0,  692,    0,    0,    0,
+	    1439,    0,    0, 1887, 1225,    0,  585,    0,
+	       0,  236,    0,    0,    0, 1110,    0,    0,
+	       0,    0,  142,   85,    0, 1720, 1727,    0,
+	    1904,    0,    0,    0, 1787,    0,    0,  854,
+	    1799,  802,    0,  463,  519, 1595, 1677,    0,
+	     912,    0,    0, 1965,  956, 1258, 1156,    0,
+	       0,  788,    0,    0,  740,    0, 1510,  666,
+	       0,  365,    0,    0,   80,  581,    0,    0,
+	       0,    0,    0,    0, 1087,  795, 1225, 1570,
+	     685, 1896, 1281,  987,  908,    0, 1189,    0,
+	       0,    0, 1868, 1647,    0,    0, 1160, 1155,
+	       0, 1338,  290, 1763,    0,    0,  507,  997,
+	     619,  963, 1397,  543,    0, 1157,  113,    0,
+	       0,    0,    0,  203,    0, 1371, 1235,    0,
+	       0, 1728,    0,  706,    0,    0,    0, 1795,
+	       0,    0,    0,    0,    3, 1982,    0,    0,
+	    1445,    0, 1583,    0, 1373,    0,    0,    0,
+	       0,    0,    0,    0,    0,    0, 1392,  401,
+	    1503,  429,    0, 1158,    0,  291,    0, 1451,
+	       0,  676,    0,  824,  358,  217, 1000,  576,
+	    1561,    0, 1305, 1695, 1797,  182,    0, 1808,
+	    1173,    0, 1071,    0,  211,    0,    0,    0,
+	       0,    0,    0,    0,    0, 1588,  439, 1947,
+	    1733,  298,  798,  935,    0,    0, 1408,    0,
+	    1465,  762,  290, 1690,  494, 1898,  865, 1665,
+	       0,    0,    0,  101,    0,    0,    0,    0,
+	       0,    0, 1029,    0,  777,    0,    0,  694,
+	    1554, 1141,    0,    0,    0, 1357,  727,  826,
+	       0,    0,    0,    0,  102,   89,    0,    0,
+	       0,    0,  200,    0, 1657,  378,    0,    0,
+	       0,    0,    0,    0,  971,    0, 1002,    0,
+	       0, 1942, 1936, 1066,  225, 1637,    0,    0,
+	       0, 1319,  711,  948,  978,    0,    0,    0,
+	     468,  205,    0,    9, 1625, 1483,    0,    0,
+	     943,  731, 1782,    0,    0,  699,    0,    0,
+	     367,  275,    0,  239, 1051,    0, 1326,  762,
+	       0,    0,   16,  918,    0,    0,    0,  169,
+	       0, 1508, 1978,  790,    0,  403, 1537,  562,
+	     390,    0,    0, 1244,    0,    0,  980,    0,
+	       0,    0,  968,    0,    0, 1977, 1336,  308,
+	    1489,    0,    0,  475,    0, 1847, 1243,    0,
+	    1427, 1840,    0, 1553,    0,    0,    0,    0,
+	       0, 1229,    0, 1277,    0,  545, 1450,  639,
+	    1313,    0,    0,    0,    0, 1853,  379,  596,
+	       0,    0,    0, 1564,    0,    0,    0,    0,
+	       0,    0,    0,    0, 1243, 1052,    0,  497,
+	       0, 1755, 1700,  362, 1766,  229, 1805,    0,
+	     206, 1504, 1530,    0,  624,    0,  289,    0,
+	     786,   30, 1731,  965,  174,  379,    0, 1165,
+	     937,  355,    0,    0,  766,  299,    0,   23,
+	     235, 1892,    0,   13,    0,    0, 1663, 1407,
+	       0, 1552, 1386,    0,    0,    0,    0,    0,
+	    1739,  147, 1165, 1072, 1608,    0,    0,  751,
+	       0,    0,  847,    0,  416,  777,    0,   63,
+	    1129, 1628,    0,    0,    0,    0,    0,  891,
+	       0, 1769,    0,  276,  439,    0,    0,    0,
+	       0,    0, 1241,    0,    0,    0,  853, 1263,
+	       0,    0,    0, 1755, 1192,    0,    0,    0,
+	       0,    0,  424,    0,    0, 1585,    0,   71,
+	       0,    0,    0,  175,  951,    0,  788,    0,
+	     399,  683,    0,    0,    0,    0,    0,    0,
+	     343,   91,    0,    0,    0, 1854,    0,    3,
+	       0,    0, 1457,    0,    0, 1562,    0, 1558,
+	       0,  378,  848,    0,    0, 1991,  435,    0,
+	       0,    0, 1917,  657,    0, 1137,    0,  466,
+	     162,  180, 1334,  464,  695,  852,  416,    0,
+	       0, 1111,    0,  337,  485,    0,  474,    0,
+	    1862, 1512,  755,    0, 1684,    0,    0,  267,
+	    1907, 1725, 1367,  744, 1434,    0,  509,  901,
+	       0, 1320,  351, 1806, 1848,    0,    0,    0,
+	     941,  605,    0,    0,    0,    0,    0,  296,
+	       0, 1559,    0, 1319,    0,    0, 1907,  514,
+	       0,    0,    0,  887,    0,  194,    0,  281,
+	    1101,    0,  593,    0, 1968,    0,    0,    0,
+	       0, 1198, 1747,    0,    0, 1790, 1896,  973,
+	       0,    0,    0, 1554,    0,    0,    0,    0,
+	       0,  259, 1128,  760,  264,  238,    0,    0,
+	    1489,    0,    0,    0,    0,  705,  710,    0,
+	       0,    0,    0,   56,  141, 1732,    0,  335,
+	       0,  501, 1361,  296,    0,    0,  921,  184,
+	       0,    0,    0,  795, 1936, 1749,    0,    0,
+	    1724,    0,    0, 1087,  348,    0,    0,    0,
+	    1280,  718,    0,    0,  901,    0, 1806,  455,
+	       0,    0,    0,  703,    0,    0,    0,  299,
+	    1636, 1857,    0, 1423,  335, 1521,    0, 1483,
+	    1429,    0, 1141,   17,    0,    0,   86,  822,
+	    1411, 1553, 1704,    0,    0,    0,  376, 1387,
+	       0, 1337,  467,    0,    0,  340, 1652,  434,
+	       0,    0,  810,  745,  486, 1557,  442,    0,
+	       0,  890,  372,  238,  352, 1650,    0,    0,
+	      67,  907,    0, 1574,    0,    0,    0,    0,
+	       0, 1554,   95, 1811,  853,  431,    0,  586,
+	    1790, 1245, 1524,    0,    0,    0, 1431, 1808,
+	     246,    0, 1109,  919, 1829, 1661,    0,    0,
+	     763, 1341, 1730,    0,    0,    0,    0, 1252,
+	       0,  782, 1885,    0,    0, 1594, 1723,    0,
+	       0, 1002,    0,    0, 1327,    0,    0, 1737,
+	       0, 1716,    0, 1041,    0, 1381,  691,    0,
+	       0,    0,    0, 1389,  399,    0,    0,    0,
+	       0,    0,    0,    0, 1388, 1098,    0, 1295,
+	       0,  147,    0,    0, 1200,    0,  417,    0,
+	    1467, 1170,    0,    0,    0,  721, 1773,    0,
+	     409,  699, 1874,  956,    0,    0,    0, 1663,
+	    1098,    0, 1276, 1522,    0,    0,    0,  498,
+	     278,  604,  637,    0,  769,  783,    0,    0,
+	       0, 1128,    0,    0,    0, 1616,  850,  358,
+	    1085,    0,    0,    0, 1125,    0,    0, 1560,
+	       0,    0,  112,    0,    0,  278,    0,   25,
+	       0,    0,    0, 1393,  303,  738,    0,   48,
+	    1521,   40, 1424, 1333,  352,  607, 1246,    0,
+	     480,    0,    0,    0, 1131,    0,    0,    0,
+	       0,  836,  628,    0,    0, 1345, 1522,    0,
+	     838,    0,    0,    0,    0,    0,    0, 1430,
+	       0, 1515,  269,    0,    0, 1906, 1308,    0,
+	       0, 1501,    0,    0,  986,    0,  925,    0,
+	    1787,    0,    0,    0,    0,    0,    0,    0,
+	     195,  170,    0,  713,    0,  169,    0,  735,
+	     309, 1745,    0,    0,  413,  374, 1297, 1943,
+	     807,    0, 1288, 1312,    0,  640, 1025, 1117,
+	       0, 1133,  507,    0, 1373,  373, 1158,    0,
+	    1969,    0,    0, 1838,    0,  902,    0, 1681,
+	     417,    0,  982, 1526,    0, 1805,    0,    0,
+	     398, 1378, 1173,    0,  159,  220, 1684,    0,
+	      37,    0,  642,    0,    0,    0,  242, 1651,
+	     650, 1986,    0,  227, 1303,    0,  771, 1331,
+	       0,  608,  806,    0,  450,    0,    0,    0,
+	    1092,    0,    0,  224,    0, 1123, 1215,    0,
+	       0,  262,  916,  454,  897,  215,    0, 1065,
+	       0,    0, 1094, 1829,   28,  551,    0,    0,
+	     225,    0,    0,    0,    0,    0,    0,    0,
+	       0,    0,    0,    0,  964,  289,  999,    0,
+	       0,    0,  650,  240,  526,  674,    0, 1697,
+	    1105,  719,    1,  406,  654,    0,  634,  347,
+	       0,    0,    0,  619,    0,  172,    0,    0,
+	    1268,    0, 1281,    0,    0, 1167,  237, 1099,
+	     186,    0,    0,  275,  880,  948, 1784, 1789,
+	     281,    0,    0, 1047,   39,    0, 1687,    0,
+	     732,    0, 1194, 1026,   57, 1716,    0, 1826,
+	       0, 1287,    0, 1752,  756,    0,  446,    0,
+	    1394,    0,    0,  906,    0, 1617, 1830,  313,
+	     635, 1647,    0, 1913,  918,    0,    0, 1241,
+	       0,    0,    0, 1529,    0,    0,    0,  398,
+	    1744,    0,    0,    0,    0,    0,  442,  500,
+	       0,  307,  205,    0,    0,  127, 1653, 1439,
+	       0,   53,    0,    0,    0, 1582,    0,    0,
+	       0,    0,    0, 1014,  804,    0,    0,  531,
+	     150, 1088, 1754,    0,  105,  513,    0,    0,
+	       0,  867, 1909,    0, 1212,    0,  729, 1959,
+	     590,  190,    0, 1177,    0,    0,    0, 1844,
+	       0,  624,    0, 1812,    0,  850,  920, 1583,
+	       0,    0, 1728,  252,  986,    0,    0,  465,
+	    1236,   74,   40, 1256,    0,    0,    0,  283,
+	     237,    0,    0,  131,  874,  721,    0,    0,
+	       0,    0,  766,    0,  427, 1886,  428,  476,
+	       0,    0,    0,  109,  177, 1014,    0, 1084,
+	       0,    0,  409,    0,  378,  901,  243,    0,
+	       0,  412, 1669,    0,    0,    0,    0, 1175,
+	     355, 1120, 1696,   86, 1211,    0,  210,    0,
+	    1503,    0,    0, 1617,    0,  983, 1611,    0,
+	    1268,    0,    0,    0,  351,    0,  548,  426,
+	     982,    0,  827, 1143,    0,    0,    0,    0,
+	       0, 1882,  208,    0, 1102, 1873, 1626,    0,
+	       0,  444,    0, 1488, 1754,  343,    0, 1344,
+	       0, 1959,    0, 1914,    0,  404,    0,    0,
+	     116,    0,  490,  728, 1152,    0,    0,  463,
+	       0,    0, 1258, 1353,  147, 1841,  667,    0,
+	     995,    0, 1672, 1573,    0, 1185,  660, 1794,
+	       1, 1316,    0,  263, 1409,  995, 1047,    0,
+	       0,    0,  555,  978,  596, 1359, 1936,    0,
+	     427,    0,    0,  998,  348,    0,  610, 1074,
+	       0,    0,    0, 1771,    0,    0,    0, 1376,
+	       0,    0,    0,    0,  395, 1184, 1823,  882,
+	    1902,    0, 1252, 1852, 1452,    0,    0, 1883,
+	       0,  365, 1166,    0, 1881,  120,    0,  136,
+	     946,   27,    0,  808,  889,  512,    0,    0,
+	    1860,    0,    0,    0,    0,  527,    0,  151,
+	    1247,    0,    0,    0,    0,  490,   54,    0,
+	     866,    0,  787,    0,    0, 1902, 1777, 1585,
+	    1327,    0, 1295,    0,    0,    0,  134, 1972,
+	       0,  967,    0,    0,    0, 1775,    0, 1471,
+	       0,  194,    0, 1015,  239,    0, 1427,  670,
+	     446,    0,    0,    0,    0,    0,    0, 1124,
+	       0,  231,    0,    0, 1272,  331, 1710,    0,
+	    1018,    0,    0,  394, 1255,    0, 1330,    0,
+	       0,    0,   82, 1067,  499,    0, 1618, 1040,
+	       0,    0,    0,    0,    0,    0, 1387, 1561,
+	    1509,  725,    0,  743,    0,  170,  870,    0,
+	       0, 1309,    0,    0,    0,    0,    0, 1008,
+	    1894,  841, 1797,    0,  402,    0, 1122,  471,
+	       0,    0,    0,  615,    0, 1283, 1334,  599,
+	       0, 1140,    0, 1963,  712,    0, 1080,    0,
+	       0,    0,  851, 1807, 1987,  103,    0, 1402,
+	     389,    0, 1673,    0, 1514, 1601,  213,    0,
+	       0,    0,  835,    0,    0,    0,    0, 1062,
+	       0, 1478,   44,  803, 1039,  253, 1164,    0,
+	     357,    0, 1609,  906,    0, 1858,  231, 1395,
+	     527,    0, 1339,  433, 1231,    0,    0, 1857,
+	       0,  655,    0, 1494, 1941, 1455,    0,  266,
+	    1081,    0, 1077,  661,    0,    0,  304,  767,
+	     155, 1493,    0,  881, 1987, 1140,  199,  532,
+	       0,  508, 1003,    0,  476,    0, 1949, 1381,
+	       0,    0,    0,    0,    0, 1466,   63,    0,
+	       0, 1723,    0,  478, 1407,    0,    0, 1270,
+	       0,    0,    0,   81,    0, 1798,    0,  164,
+	       0,   32,    0, 1503,    0,    0, 1182,  270,
+	       0,  673,    0,  529,    0,    0,    0,    0,
+	    1414,    0,    0,    0,    0,    0,    0,    0,
+	    1521, 1327,    0,  321,  465,    0,    0,  641,
+	       0,    0,    0, 1023, 1190,  272,    0,    0,
+	       0,    0,  861,    0,    0, 1578,    0,  241,
+	    1524,    0, 1463,    0,    0,    0,  455,    0,
+	    1693, 1161,    0,    0,    0,    0, 1722,    0,
+	     614,    0,    0, 1939,  540,    0,  256,    0,
+	       0,    0,  978,    0,  853,    0,    0,    0,
+	    1480,    0, 1328, 1953,   70,    0,  862,    0,
+	       0,  918,    0, 1998,    0,    0, 1129,    0,
+	       0,    0,    0, 1805,    0,  251, 1456,    0,
+	       0, 1543,    0,  643,   29,    0,    0, 1945,
+	       0,    0, 1306,  121,    0,    0, 1428,  285,
+	    1314,    0,    0,    0,  736,    0,    0,    0,
+	       0, 1333,    0,    0,    0,  784,    0,  198,
+	    1082, 1738, 1169,  519,    0,    0,    0,  794,
+	       0,  813,   30,    0,    0,    0, 1884,    0,
+	       0, 1545,  160,    0,    0,    0,    0,  653,
+	       0, 1547,    0,    0,    0,    0, 1490,    0,
+	       0,    0,    0,    0, 1324,    0,    0,    0,
+	    1973, 1547, 1063,    0,    0,  181,    0,    0,
+	       0,    0, 1496, 1120,  748,  235,  669,    0,
+	    1659,    0, 1391,  716,    0,    0,    0,  218,
+	      24,  325,    0,  862, 1884,    0,    0,    0,
+	     387,    0,  560,  488,  343,  972,    0,    0,
+	       0,  684, 1728,   52,    0,    0,  939,  471,
+	       0,    0,    0,    0,    0,    0,    0, 1197,
+	       0, 1546,    0,    0,  984, 1446, 1173,    0,
+	       0,  140,    0,    0,    0,    0,    0,    0,
+	     759, 1342,  871,    0,  810,   46,  177,    0,
+	     372,  754, 1293,    0, 1593,    0,    0, 1265,
+	    1694, 1753, 1027,    0,    0, 1830,  482,    0,
+	    1219, 1720,    0,    0, 1669,  530,  936,    0,
+	     799,    0,    0,  377,  518,    0,    0, 1048,
+	       0,    0,    0, 1262, 1533, 1500, 1250, 1068,
+	       0,    0,    0,    0,    0, 1153,    0,  992,
+	    1783,    0, 1593,    0,    0,    0,    0,    0,
+	     293,  532,  885,  492,  533, 1944, 1923, 1327,
+	       0,  496,    0, 1372,    0, 1896,    0, 1317,
+	       0,    0,    0,  539,    0,    0,    0,  421,
+	     112,  671, 1615,    0,    0,  609, 1400,  530,
+	     571, 1138,    0, 1244,    0,  264, 1446,    0,
+	    1220,  274,    0,  379, 1139,  110,  733,    0,
+	       0,    0,    0,    0, 1641, 1689, 1787,    0,
+	     572,    0,    0,    0,    0,    0,    0,    0,
+	    1916,    0,  314, 1721, 1638,    0, 1314,    0,
+	       0,  114,    0, 1422,    0,  888,   75, 1377,
+	       0,    0, 1998,    0,    0,  402,    0,  248,
+	       0,    0,    0,   23,  392,    0,    0,    0,
+	    1341, 1862,    0,  634,    0,    0,    0, 1725,
+	       0,    0,    0,   65,  997, 1120, 1591,    0,
+	    1194,  883,    0, 1668,    0,  275,    0,  388,
+	       0,    0,    0, 1357, 1306,    0, 1200,    0,
+	       0,  845, 1364,  892,  729,    0, 1833, 1901,
+	    1057,    0,    0,    0, 1821, 1099,    0,    0,
+	       0,    0,    0,    0,    0,   52,    0,    0,
+	       0,  494,    0,    0,    0, 1568, 1426, 1328,
+	       0, 1611,    0, 1295,  502,    0, 1719,  371,
+	     411, 1317,    0,    0, 1142, 1680,    0,  286,
+	    1461,    0,    0,    0,    0, 1125,    0,   98,
+	       0,    0, 1447,    0,    0, 1557, 1049, 1716,
+	     136,  628, 1613, 1359,  986, 1755, 1989,    0,
+	     318,  897,  838,  402,    0,    0,    0,  660,
+	       0,    0,    0,  788,    0,    0, 1788,    0,
+	       0, 1823,    0, 1738,   90, 1802,    0,    0,
+	       0,  389,  658, 1874,    0,    0, 1622, 1692,
+	       0, 1636,    0, 1106,    0, 1157,    0,    0,
+	     973,    0,  626,    0,    0,    0,    0,    0,
+	       0,    0,    0,  223, 1844,    0,    0,    0,
+	    1248, 1054,  434, 1775,  963,    0,    0,    0,
+	       0,    0,  188,    0,  361,    0, 1004, 1785,
+	       0,    0,    0,  829,    0,    0,    0,  709,
+	       0,  502,    0, 1301,    0,    0,    0,  392,
+	       0, 1050, 1334, 1504,  896,    0,    0,    0,
+	     390,    0, 1933,    0,  941, 1218,    0, 1218,
+	       0, 1672,    0,  453, 1213,    0, 1821,  412,
+	     881,    0,    0,    0,  472,   34,    0, 1822,
+	       0,    0,  832,  192, 1277, 1120,    0,    0,
+	      22, 1480,  864, 1386,    0,    0,  473, 1391,
+	    1929,   17,    0,  253,    0,    0,    0,  354,
+	       0,    0, 1682,    0,    0,  872,    0,    0,
+	       0,    0,  898,    0,    0,    0,  713,  753,
+	    1691,  574, 1426,    0, 1074,    0,    0,    0,
+	       0,    0,    0,    0,    0,    0,  713,    0,
+	     550,  595,  719,    0,    0, 1715,    0,   69,
+	    1658,  305,    0,   64,    0, 1231,  839,    0,
+	     288,    0,  301,    0,    0,    0,    0, 1175,
+	     501,  164,    0,    0,    0,    0,   62,    0,
+	     334,  174, 1958,  737,    0,    0, 1266,  100,
+	       0,  740,    0,    0,  767,  644,  592, 1307,
+	    1831,    0,    0,    0,  384,    0,  592,    0,
+	       0,    0,    0,   30, 1779,    0, 1133, 1178,
+	       0,    0,    0,  635,    0,    0, 1889,    0,
+	       0,  416, 1350,  421, 1036,    0,    0,    0,
+	       0,    0,    0,    0,  868, 1398, 1656,    0,
+	     557,  768, 1729,    0,  267,    0,    0, 1840,
+	       0,    0,    0, 1811,    0,    0,    0,  816,
+	    1778,    0,    0,    0,    0,    0,    0,  725,
+	       0,    0,    0, 1284,    0,    0,    0,  160,
+	       0,    0,    0,    0, 1650,    0,    0, 1035,
+	       0,    0,    0,    0,  396,    0, 1933,  403,
+	     705,    0,    0,    0,    0,    0,  595,    0,
+	     556,    0,   43,    0, 1639,    0,    0, 1566,
+	    1043,    0, 1572,  618,    0,    0,  738,  773,
+	    1398,    0,    0,  893,  342, 1990,    0,    0,
+	    1068, 1214,    0,    0,    0,    0,    0,   49,
+	       0,  680, 1899, 1977,  814,    0,  256,    0,
+	    1893, 1123,    0,    0,    0,    0, 1535,    0,
+	     853,    0,    0,  133,    0,    0,  912,    0,
+	    1405,    0, 1191,    0,    0,    0, 1447, 1475,
+	     157, 1510,  636,    0, 1205,    0, 1459,    0,
+	     323,    0,    0,    0,    0,  599,    0,    0,
+	    1667,  267,    0, 1326, 1345,  905,  318,    0,
+	     547,    0, 1292,    0,    0,    0,   61,    0,
+	       0,    0,    0,    0,    0,    0,  709,    0,
+	     437,    0,    0,    0,    0, 1025,    0,  758,
+	     406,   92,  606, 1149,    0,  276,  355,    0,
+	     973,    0,    0,  749, 1957,    0,    0, 1557,
+	       0,    0,    0,  228,  994,    0,    0,    0,
+	     499, 1919,    0,    0,    0, 1082,    0,  147,
+	       0,  873,    0,  913, 1356,    0, 1437,    0,
+	    1380,   24,    0, 1995,    0,   62, 1517,    0,
+	      99,    0,    0, 1019,  912,    0,    0,  228,
+	    1376, 1827,    0,    0,    0, 1046, 1462,    0,
+	     318, 1251, 1836, 1741, 1767, 1860,  791,    0,
+	     828, 1675, 1150,    0,  256,  809,    0,  146,
+	    1259, 1634,    0,  652,    0,  712,    0,    0,
+	       0, 1302, 1318, 1119,    0,  106,  640,    0,
+	    1055,    0,    0,    0,  942,    0, 1967, 1640,
+	       0,  658, 1594, 1747,    0,    0,  162,    0,
+	       0,    0, 1342, 1118,    0,  668,    0, 1151,
+	    1148,  328,    0, 1415,    0,    0, 1975, 1927,
+	    1631,    0,    0,    0,    0,  152, 1380,  291,
+	    1443,  778,    0,    0,  773,  632,    0, 1257,
+	       0,  819, 1848, 1571,  227,    0, 1472,  425,
+	       0,    0,    0,  541,    0,    0,  157,    0,
+	     812, 1892,    0,    0,    0,  196,    0,    0,
+	    1638, 1368, 1688,  581, 1779, 1474, 1977,  860,
+	       0, 1506, 1759,    0,   35,    0,    0,    0,
+	       0,  739,    0,    0,    0,    0, 1935,    0,
+	       0, 1367,    0,    0,    0,    0,    0,    0,
+	       0,    0,    0,  111,    0, 1711,    0,    0,
+	     764,    0,    0,    0,    0,    0,  229, 1191,
+	       0,    0,    0,   57, 1085, 1648,  801,   11,
+	     819,
+	};
+	uint16_t h[2];
+
+	_inthash2(key, (uint32_t*)h);
+
+	h[0] = h[0] % 4001;
+	h[1] = h[1] % 4001;
+	result = (g[h[0]] + g[h[1]]) % 2000;
+	return (inthash_keys[result] == key) ? result : (uint16_t)-1;
+}
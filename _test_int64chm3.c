@@ -0,0 +1,341 @@
+/* generated with rurban/nbperf 08a5797 -L _rand64 */
+/* seed[0]: 137806862, seed[1]: 42999170 */
+#include <stdint.h>
+
+static inline uint64_t _inthash64(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return x ^ (x >> 31);
+}
+
+static inline void _inthash4(const uint64_t key, uint64_t *h)
+{
+	*h = _inthash64(key + UINT64_C(0x2901d820836c40e));
+}
+
+uint16_t
+inthash(const uint64_t key)
+{
+	static const uint16_t g[2481] = {
+	     653,  166, 1668,  544,  591,  672, 1010, 1492,
+	     964,    0,  559,    0,    0,  420,    0, 1992,
+	    1227,  264,  301, 1745,  418, 1079, 1480,  846,
+	     918, 1370, 1733, 1014,   59, 1219, 1767, 1614,
+	     598, 1976, 1046,  555,  525,    0,  565,  805,
+	     637,   91,  794,    8, 1290,  110, 1970,    0,
+	     717,  530, 1777,    0, 1505,    0, 1413,   68,
+	    1514,  319,  141,  170,  513,    0, 1706,    0,
+	    1486,  424,  721,  323, 1548, 1743,  254, 1217,
+	     747, 1062,    0,  119, 1916,    0,  649,   29,
+	       0, 1666, 1067, 1165, 1418,    0, 1682,  841,
+	    1355, 1680, 1365,  726, 1073, 1855, 1409, 1854,
+	       0,  390, 1908, 1771,  702, 1449, 1897,  837,
+	     639,  386,  837,  869,    0, 1899, 1635,  671,
+	       0,  125, 1041, 1272,  551,  891,  523,  856,
+	      67,   12,   93,  711,   93, 1725,    0,  362,
+	       0,    0,    4,  507,    0,  342,  757,   54,
+	    1394,  885, 1610,  781,   82,  347,  406,  764,
+	    1000,  494,   63,  243, 1252,  225,  342, 1036,
+	    1829, 1259,  133,  857,    0,  474,  880, 1807,
+	       0,    0,    0, 1089,  162,  572, 1862,  589,
+	     393,  197, 1033,  333, 1689,  129,  346, 1018,
+	     298,  209,  138,    0,  603,  575, 1249,  597,
+	       4, 1117,  438,  635, 1578,  650, 1577, 1197,
+	     610,  751, 1660,  451, 1448, 1935,    0,  112,
+	       0, 1182,  524,    0,  679, 1677, 1260,  429,
+	     656,  921, 1373,  809,    0,  674, 1906,  933,
+	     294, 1036,    0,    0,    0,  661,    0, 1292,
+	    1528,    0, 1452,   99, 1516,  883, 1536,  549,
+	     676,    0, 1628,  485,    0, 1437,  748, 1829,
+	    1970,   58,    0, 1527, 1235, 1273,    0,    0,
+	       0, 1322,  651, 1148,    0, 1620,    0, 1546,
+	       0,  559,  702,    0,    0,    0,  996, 1054,
+	       0, 1222, 1730,    0,  309, 1362, 1210,  403,
+	     630,    0,  867,  382,  497, 1083, 1930,    0,
+	       0,  204,    0,  641,  276,  200,  375,   99,
+	    1285,    0,  868,    0, 1211,  647, 1996, 1708,
+	       0, 1001,  194,   44,  285,    0, 1632, 1155,
+	     574,  271, 1833,    0, 1663,  812,    0,  353,
+	       0, 1207,    0, 1198,    0, 1107,  183, 1771,
+	    1669,  628,    0,    0, 1728, 1119, 1254,  921,
+	     114,    0, 1167, 1314,  802,  839,  127, 1631,
+	      32, 1944,  610, 1527,    0,    0, 1136,    0,
+	    1244, 1713,  343,  271, 1035, 1566, 1739, 1174,
+	       0,  481,  178,    0, 1035,  274, 1438,  676,
+	    1461,  577,  896, 1770, 1139, 1032,   64,  976,
+	    1440,  287,    0, 1237,    0,   43,  103,    0,
+	     462, 1067,  108, 1556, 1238,    0,    0,  144,
+	    1127, 1468, 1404, 1225,  939, 1227, 1762,  292,
+	     357,    0, 1649,  883,    0,  988,    0,    0,
+	    1041,  272,  977,    0,    0,  157,    0,    0,
+	       0,    0, 1023,  359,  959, 1877,  512,  815,
+	       0,  985,  208,  607, 1763,  600, 1350, 1541,
+	       0,  539,  362,    0,  424,    0, 1712,    0,
+	     489, 1581, 1258,  345,  278, 1085,  503,  606,
+	      28, 1847,  406,  274, 1337,  738,  189, 1014,
+	     319, 1089,   59,    0,  918,  749,  905, 1844,
+	       0, 1661,  969,  311, 1951, 1263,  802,   89,
+	    1304,   45,    0, 1754,  268,  587, 1471,    0,
+	    1998,    6,    0, 1052,   10,    0,  148, 1923,
+	    1315, 1315, 1258,  612,  653, 1616,    0,  670,
+	    1266,   59,    0,  765,  850,    0, 1671, 1478,
+	     650,  680,  321, 1054,    0, 1036, 1628,  612,
+	      99, 1980,  824, 1032, 1766, 1429, 1914, 1551,
+	     629, 1996,  784, 1011, 1967,    0,  966, 1100,
+	       0,    0, 1839,    0,  220, 1544,  165, 1925,
+	       0,  457,  480, 1284,    0, 1624,  759, 1113,
+	     923, 1947, 1370,    0,    0,  175,   34, 1792,
+	       0,    0,  777,    0, 1396,  240, 1551, 1591,
+	    1606,  430, 1772, 1537, 1387,    0,    0, 1740,
+	    1344,    0, 1046, 1341,  256,  608, 1769,  476,
+	    1508,    0, 1858,    0, 1334, 1100,  816, 1722,
+	    1594,  973,  283,  106, 1460,  221, 1489, 1526,
+	     841,  587,    0, 1582, 1136,  205,   58, 1355,
+	    1954, 1854,  139, 1905, 1369, 1900, 1544, 1164,
+	       0, 1132, 1594,  566, 1175,  132, 1958,  645,
+	     304,    0,  847, 1740, 1260,    0,  811, 1402,
+	       0,    0,  134, 1307,    0, 1932,  713,    0,
+	    1973,    0,  948, 1922, 1133,  146, 1095,  843,
+	      52,  474,    0, 1687,  928,  531,    0,    0,
+	     539, 1968,  408, 1290,    0,    0,    0, 1882,
+	    1757, 1910,  538,    0,  849, 1287,  634, 1034,
+	     486,  519, 1555, 1709, 1920, 1425,  977,  213,
+	       0, 1582,  752,    0,  353, 1392, 1824,    0,
+	       0,    0, 1806, 1856, 1314,  792,    0, 1254,
+	    1804,  427, 1444, 1407, 1781, 1865,  923,   19,
+	    1451,    0,    0, 1190,   44,  427, 1662,    0,
+	    1141,  123, 1368,  666, 1322,  319,  436,  573,
+	    1576,  238,  147,  816,    0, 1367,   56, 1435,
+	       0,    0,    0,    0,  610, 1846, 1935,  907,
+	     191,   78, 1547,  496,    0,  695,   89,  518,
+	     988,  209, 1729,   19, 1682,  141,  595, 1956,
+	     833, 1794,    0,  876, 1575, 1996, 1809, 1003,
+	       0,  437,   66,  621,   25,  788,  188,  264,
+	       0, 1443,    0,    0, 1527,  661,    0,  705,
+	       0, 1632,    0,    0, 1805, 1513,  962, 1690,
+	     523, 1465,   68, 1057, 1462,  383,  317, 1979,
+	     683,  963,  538,  124,  406, 1047,    0,    0,
+	    1664, 1515, 1275,    0, 1741,  719, 1381,    0,
+	    1535,  446, 1100,    0,    0,  951,  696,  832,
+	     169, 1471, 1471, 1660,    0, 1785,    0, 1314,
+	       0,    0, 1491, 1744, 1754, 1309, 1564,    0,
+	    1595, 1330,  692, 1642,  272, 1384,  915,  606,
+	    1840, 1081,  849,  748,  226,    0,  504, 1270,
+	     729, 1490, 1061, 1392,  639,  877, 1185,    0,
+	     515,  533,  700, 1340,    0, 1654, 1854, 1995,
+	    1731,   33, 1733, 1415, 1689,    0, 1160,    0,
+	     457,    0,  268,  877,  694,  236,    0, 1251,
+	     469, 1393,   42,  584,  973, 1467, 1507, 1787,
+	     118,  931,  280, 1613, 1625,    0,   99, 1818,
+	    1124,    0, 1760, 1456,  883,  480,  944,    0,
+	    1203,    0,    0, 1990,  390, 1330, 1055,  101,
+	    1450, 1370, 1992,  832, 1406, 1040,  450,    0,
+	    1818,    0,    0,    0, 1140, 1370,  352,  710,
+	    1334, 1637,    0,  523,  205,    0, 1127, 1297,
+	     748, 1831,  841,    0,  471,   81,  323,  347,
+	       0,  900,  331,    0,  750, 1281, 1503, 1418,
+	    1431,  893,  568,    0, 1220,  131,  295, 1735,
+	    1537, 1013,    0,    0,  136, 1724,  109, 1404,
+	    1295, 1972,    0,  493, 1785, 1835, 1733, 1372,
+	       0, 1733,  437,  353,  776, 1958, 1070,  122,
+	     226,    0,  143,    0,  998, 1909,  545,    0,
+	     968,    0, 1893, 1491, 1327, 1291,  420, 1632,
+	    1926,    0, 1082, 1075,  919,  828,    0, 1873,
+	       0, 1642, 1928, 1352,  416, 1514, 1425,  293,
+	     451, 1087,  604, 1873,  423,  274,    0, 1421,
+	     317, 1677,  136, 1350, 1959, 1803, 1650,    0,
+	     341,  542, 1735,  992,    0,    0,  546,  261,
+	    1188,  568,  669, 1165,  317,  142,  700,    0,
+	       0,    0, 1191, 1951,  385,    0, 1549,    0,
+	    1474,    0, 1945,  151,  255,  844,  869,    0,
+	       0,  219,  699, 1356,  413,    0,  432,  499,
+	       0,  756,  159, 1207,  529, 1522, 1397, 1015,
+	    1501,  414,  295,  697,  675,    0, 1783, 1308,
+	     732, 1316, 1490,  176,    0,    0,    0,    0,
+	       0,  258,    0, 1556,  948,    0,  151, 1592,
+	    1343, 1708,  142,  904,    0, 1353,    0, 1905,
+	    1490, 1750, 1688,  417,  142,  374, 1623,    0,
+	    1923, 1134, 1720,  638,  172,  732,  246,  929,
+	    1932,   58,  507,    0, 1036, 1873,   46,  779,
+	    1186,  143,  310, 1793,    0,    0,    0,  458,
+	    1113,  146, 1010,  134,    0,    0,  560,   14,
+	     718,   69,  372,  522, 1684, 1362, 1576,  189,
+	    1524,  677, 1847,  642,    0,    0,  850,    0,
+	     703,  619,    0,  249, 1971, 1567,    0, 1928,
+	     801,   98,    0,    0,  864, 1512, 1068, 1611,
+	       0,    0,  246, 1889, 1194, 1897,  960, 1254,
+	     127, 1873,  202,  564, 1227,    0, 1113, 1186,
+	       0,   52,   35, 1191,  962,  142, 1505, 1463,
+	    1690, 1359,  761,    0,  977, 1509,  652, 1623,
+	      24, 1687, 1005,    0,    0,  396, 1017,    0,
+	      36,  395,    0,  965, 1000,  234,    0,  913,
+	    1307,   82,    0,  153,    0, 1312,  182, 1799,
+	       0,   52,    0, 1701,  584,  972,  226, 1050,
+	     365,    0,  402,  780, 1291, 1112, 1245,  787,
+	     292,    2, 1318,  680, 1899,  177, 1707, 1405,
+	     501, 1911,  831, 1654,    0,  343, 1293,  840,
+	       0, 1440, 1585,    0,  870,  147, 1671,  419,
+	    1049,    0,  749, 1985,  153, 1287, 1123,  467,
+	     135,  372, 1206,    0,  193, 1537,  517,  567,
+	    1978, 1463,    0,  201,  927, 1427, 1839,  438,
+	       0,  829,  273,    0,  956,  192,  586,  822,
+	    1678,    0, 1272,  704,  501, 1234, 1409, 1707,
+	      15, 1832,  599,  982,  216,    0,  153,  414,
+	    1679, 1233,  883,  138,    0,  147,  880,  787,
+	     367,  538, 1788, 1282, 1591, 1369,   68, 1737,
+	       0,  383,  466,  114,   16,  706, 1823, 1807,
+	    1290,  808, 1123,  795,    0,    0, 1826, 1991,
+	     673,    0, 1465,  909, 1728,  174,   52, 1308,
+	     867, 1800, 1814, 1709,  365,  916,   66,    0,
+	       0, 1494, 1130, 1819, 1307, 1669,    0, 1822,
+	    1231,  767, 1458, 1581,  596, 1388, 1596,    0,
+	    1133,  938, 1353, 1874,  785,  364, 1802,    0,
+	    1266, 1759,    0,  936, 1920, 1950,  253,  945,
+	       0,  495,  641, 1791,  247,  118,    0,  705,
+	     756,  613,  807, 1988,  596, 1192,    0,    0,
+	      43,    0, 1613,    0, 1880,  129,    0,  227,
+	    1545,  777,  296,  465, 1637, 1350,    0,  279,
+	     977,    0,    0,  308,  545,  433, 1978,    0,
+	    1884, 1629,  783,  643,  579,  245, 1712,  426,
+	       0, 1880,  378, 1147,  278,   72,  535, 1324,
+	     805,  821, 1972, 1787,    0,    0,  872, 1094,
+	    1317, 1536,  124,    0, 1905, 1252,  772, 1159,
+	     155,  301, 1519, 1584,    0,  140,    0, 1161,
+	     380, 1988,    0, 1731, 1406, 1371,  817, 1866,
+	     285, 1407,  963, 1117,  723,    0, 1284,    0,
+	    1421,  300, 1986, 1226,    0,    0, 1097, 1438,
+	       0,  256,  308, 1920, 1450,    0, 1599, 1138,
+	    1453,   40,  645,  136, 1829,  706, 1621,  887,
+	    1302,  302,  814,  213, 1504,  702, 1639,    0,
+	     353, 1021,    0,  779, 1403,  277, 1810,  230,
+	     684,  842,  630,  630,  411, 1543, 1909,  457,
+	    1493, 1187,  542,  901,  703,  897, 1713, 1884,
+	     225, 1952,  795, 1521, 1004, 1188,  323, 1935,
+	     371, 1019,  607,    0,  240, 1122,  485,    0,
+	       0,  331,  396, 1663,    0, 1613, 1864,  996,
+	    1703,  651,  505,  943,    0, 1615,    0, 1148,
+	    1677, 1361,    0, 1240,  862,  345,    0,  427,
+	     317,   77, 1272, 1043, 1077, 1371,  365,    0,
+	      82,    0,    0, 1229,    0,    0, 1547,    0,
+	    1145, 1506,  435, 1014, 1284,  116,  200, 1414,
+	       0,  833,    0,    0,  730,  135,  100, 1756,
+	     454,  609,  397, 1015,    0,   70,    0,  224,
+	     377, 1200,  286,  435,  425, 1642, 1211,    0,
+	    1466, 1864, 1672, 1669,  424, 1494,    0,  235,
+	     510,  810,  126,  766,    0,  367,  645, 1125,
+	    1696,  499,  379, 1086,    0,  921,    3,  438,
+	    1391,  967, 1565,    0,  869, 1265,  819,  711,
+	     703,    5, 1604,  237,  755,  787, 1892,    0,
+	    1696,  305,  178,   35, 1544,  520, 1307, 1451,
+	       0, 1128, 1160, 1763, 1506, 1548,  778,    0,
+	      20,  115, 1866,    0,   60,    0, 1346,  954,
+	     402,    0,  256, 1634, 1874, 1546, 1246, 1238,
+	    1666, 1251,  417, 1663, 1602, 1582,  664,  286,
+	    1973,   88, 1681,    0,  107,  615, 1601, 1465,
+	    1435,  652,    0,  624,  427,  385,    0,    0,
+	    1798, 1907, 1072,   32,    0, 1925,   96, 1018,
+	      40,    0,  924, 1065, 1260,  113,  956,    0,
+	     650, 1191, 1022, 1953,  721, 1324,    0, 1730,
+	       6,    0, 1464, 1892,  375,  677,    0,  992,
+	     374,   92,  383, 1851,    0,  385,   67,    0,
+	    1652,  512,  651,  557,    0,  370, 1018,  727,
+	    1268, 1810, 1699, 1920,    0,  994, 1759, 1463,
+	     476,  943,    0,  241, 1027,  163, 1112, 1364,
+	     650, 1725,    0, 1883,  282, 1279,  540,    0,
+	    1769, 1246,    0,  912,  407,    0, 1914,   67,
+	     718, 1491, 1713,  770,  803,    0,  533,  969,
+	     801, 1065, 1787,   17,  366,  286, 1863,  314,
+	     597,  379,  734,  582,  903,  470,  578, 1829,
+	     216, 1306,  463,    0,  980,    0,    0,  112,
+	    1340,  766,    0,    0,  969,  613, 1702,  909,
+	    1805, 1208, 1814,    0,    0, 1210, 1808, 1273,
+	       0,  948,  620, 1573,  779, 1280,  316,  516,
+	    1536, 1231,    0, 1653, 1077, 1710,  243, 1289,
+	     530,  229,  751, 1105,  426,    0,  550, 1467,
+	    1778,  487,    0,    0,  136, 1705, 1282, 1373,
+	    1009,    0, 1513,  199,  392, 1500,    0, 1184,
+	       0,  211, 1970,    0,    0, 1704,    0,  638,
+	       0, 1111, 1889, 1529,  346, 1333, 1959,    0,
+	    1686,  777,  713,  189,    0, 1100, 1870,    0,
+	     164,  609, 1777, 1252,  114, 1163,  408, 1304,
+	    1843,  974, 1487, 1026, 1380,  766,  338, 1103,
+	    1150, 1457,    0,    0,  274,  114, 1280,    0,
+	    1889, 1474,  124, 1165,  269, 1557,    0,  492,
+	    1946,    0, 1083,  159,    0,  824, 1651,  694,
+	       0, 1324,  336,  951, 1510, 1848,    0,  974,
+	    1968, 1071,    0, 1358, 1217, 1365,    0, 1075,
+	       0, 1666,    0, 1520,  158,  524,  307, 1943,
+	    1328,   68, 1753,    0,    0,  187,    0, 1249,
+	    1296, 1475,  712,    0,  394,    0, 1644,  454,
+	     145, 1187, 1444,  243, 1457,  134, 1875,  452,
+	       0, 1492, 1085, 1487,    0,  367,    0,  619,
+	      64,    0, 1814, 1557, 1519, 1211, 1320,  312,
+	     292, 1841,  589, 1472,    0, 1920, 1233,    0,
+	       0,   61,  153, 1337, 1357, 1559, 1865,  941,
+	    1149,    0, 1160,  529, 1742,    0, 1738, 1240,
+	    1621, 1708,  488,  509, 1684,    0, 1987, 1070,
+	    1584,  348, 1787,    0,  456,    0,  664, 1641,
+	    1415, 1225,    0, 1757, 1014,  102, 1346,    0,
+	    1920, 1420,  700,  709, 1508,  921,  215, 1753,
+	       0,    0,  479,   34,  229,   55,  661, 1076,
+	     932,  615,  651,  817,  857,  343, 1361,  206,
+	      18, 1531,  327,   35,  457, 1137, 1800, 1122,
+	    1307,  662,  507,    0,    0, 1932,    0, 1015,
+	     142, 1498, 1488, 1942, 1279,    5,  992, 1761,
+	    1993,  316,   72,   23, 1719,  116, 1041, 1291,
+	     393,  757,  297,    0,  536, 1270, 1036, 1928,
+	     211,    0,    0,  839,  323, 1549,    0,  611,
+	    1409,  228, 1197,  690, 1323,  696,  901, 1003,
+	    1672,    0, 1079,  349,  518, 1222, 1680, 1372,
+	       0,  382,  444,   99,  211, 1056,  661, 1776,
+	       0,  654,  803,   56,  961,  396,  570,  969,
+	       0, 1271,  374, 1343,    0, 1010,    0, 1247,
+	     761,    0,    0,    0, 1741,    0,  410,    0,
+	    1041,  936,  893,  626, 1488, 1886,    0, 1440,
+	    1863,    0,  930, 1951,    0,    0,    0, 1581,
+	    1975,    0, 1886,  568,  703, 1153, 1035,    0,
+	       0,  175,  237, 1886,  754,  495,  326, 1729,
+	    1793,  966, 1563,  271, 1128,  913,    0, 1741,
+	    1951,    0,  471,    0,    1,  831, 1014, 1270,
+	     864, 1424,   77,  413,  273,  779,  381,  927,
+	     341,    0,   49, 1175, 1432,    0,  535,  199,
+	       0,    0, 1721, 1501,  699,  885, 1718, 1858,
+	     110, 1845, 1060, 1376,    0,    0,    0,    0,
+	     713,    0, 1396,    0, 1244,    0, 1210,  863,
+	     708,    0, 1346,   23, 1058,  434,  217,  643,
+	    1037,    0,  790,    0,  770, 1269,  195,  490,
+	    1280,  514, 1688,    0, 1713,  603,  204,    0,
+	     408,   24, 1738, 1946,  317, 1816, 1147, 1356,
+	       0,  172,  131,  650,  495,    0,  685, 1658,
+	    1615,  756,  998, 1975,  211, 1669, 1367,  282,
+	    1458,    0,    0, 1822, 1671,  652,  481, 1758,
+	     139,  863,    0,    0, 1008,  583,  343,  567,
+	    1393,  848, 1301, 1932,  276,  934, 1843, 1710,
+	    1411, 1625, 1609,  888, 1663,  881, 1044,    0,
+	    1822,  817,  601,  897, 1727,  412,  714,  970,
+	       0,    0,  173, 1168,  997,   94,  542, 1484,
+	    1067, 1723,    0,   82,  151,    0,    0,  649,
+	     483, 1031,    0, 1299,    0,  824,  691,  290,
+	     757,  814, 1833,  546,  263,  134, 1704, 1902,
+	    1882,   83,  629,  776,  143, 1988,  204,    0,
+	       0,  942,   21,  694,  865,  675,  885,    0,
+	       0,  577, 1477,    0, 1923,  189,  261,    0,
+	     144,  924,    0,  132, 1865,    0,  104,  447,
+	     255,  722,  134,  364, 1379,    0,    0,    0,
+	    1938,  303, 1183, 1889,    0, 1217,    0,  766,
+	       0,  653, 1455,  676, 1876, 1391,  928,    0,
+	    1839, 1710,    0, 1362, 1110, 1223, 1171, 1841,
+	     479,   40,  518,    0,  941, 1789,    0, 1174,
+	       0, 1166, 1935,  934,  924, 1854, 1981,  507,
+	       0,
+	};
+	uint16_t h[8];
+
+	_inthash4(key, (uint64_t*)h);
+
+	h[0] = h[0] % 2481;
+	h[1] = h[1] % 2481;
+	h[2] = h[2] % 2481;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 2000;
+}
@@ -0,0 +1,74 @@
+/* generated with rurban/nbperf 08a5797 -fIp _rand100 */
+/* seed[0]: 2246822507, seed[1]: 1 */
+#include <stdint.h>
+#include <string.h>
+#ifndef popcount64
+#if defined __GNUC__ || defined __clang__
+#define popcount64 __builtin_popcountll
+#else
+static inline unsigned
+inthash_popcount64(uint64_t x)
+{
+	x -= (x >> 1) & UINT64_C(0x5555555555555555);
+	x = (x & UINT64_C(0x3333333333333333)) + ((x >> 2) & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+	return (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);
+}
+#define popcount64 inthash_popcount64
+#endif
+#endif
+#ifdef __GNUC__
+#define NBPERF_ALIGN64 __attribute__((aligned(64)))
+#else
+#define NBPERF_ALIGN64
+#endif
+/* one bit per unassigned (3) vertex of a g word */
+#define THREES(x) ((x) & ((x) >> 1) & UINT64_C(0x5555555555555555))
+
+
+static inline void _inthash4(const int32_t key, uint64_t *h)
+{
+	*h = (int64_t)key * (UINT64_C(0x9DDFEA08EB382D69) + UINT64_C(2246822507))
+		 + UINT32_C(1);
+}
+
+#define GWORD(i) (((i) >> 5) / 7 * 8 + 1 + ((i) >> 5) % 7)
+#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))
+
+uint32_t
+inthash(const int32_t key)
+{
+	static const uint64_t g[16] NBPERF_ALIGN64 = {
+		UINT64_C(0x9a69350000000000), UINT64_C(0xe358ad9186873983), UINT64_C(0x2621c893202bc01c),
+		UINT64_C(0xa368365386104a65), UINT64_C(0x815bf3f2565448f3), UINT64_C(0xb363d33b0b5afe40),
+		UINT64_C(0xd0b2215022a2ea36), UINT64_C(0xe0d3647550aa00a1), UINT64_C(0x16161600000000b6),
+		UINT64_C(0xff00d099aa10bf5f), UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+		UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+		UINT64_C(0xffffffffffffffff),
+	};
+	uint32_t index, base_rank, idx_v, idx_b;
+	const uint64_t *blk;
+	uint32_t vertex;
+	uint16_t h[8];
+
+	_inthash4(key, (uint64_t*)h);
+
+	h[0] = h[0] % 248;
+	h[1] = h[1] % 248;
+	h[2] = h[2] % 248;
+	h[1] ^= (h[0] == h[1]);
+	h[2] ^= (h[0] == h[2] || h[1] == h[2]);
+	h[2] ^= 2 * (h[0] == h[2] || h[1] == h[2]);
+	const uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);
+	vertex = h[i % 3] % 248;
+
+	index = vertex >> 5;
+	idx_v = index % 7;
+	blk = g + index / 7 * 8;
+	base_rank = (uint32_t)blk[0] + (uint32_t)((blk[0] >> (32 + 8 * (idx_v / 2))) & 0xff);
+	base_rank += (idx_v & 1) * (32 - popcount64(THREES(blk[idx_v])));
+	idx_b = (vertex & 31) << 1;
+	base_rank += (vertex & 31) - popcount64(THREES(blk[1 + idx_v])
+	    & ((UINT64_C(1) << idx_b) - 1));
+	return base_rank;
+}
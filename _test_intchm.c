@@ -0,0 +1,75 @@
+/* generated with rurban/nbperf 08a5797 -fIp _rand100 */
+/* seed[0]: 2246822507, seed[1]: 1 */
+#include <stdint.h>
+
+static inline void _inthash2(const int32_t key, uint32_t *h)
+{
+	*h = (key * (UINT32_C(0xEB382D69) + UINT32_C(2246822507)))
+		 + UINT32_C(1);
+}
+
+uint16_t
+inthash(const int32_t key)
+{
+	static const uint16_t g[401] = {
+	     172,   95,    0,    0,   62,    0,    0,  149,
+	     158,    0,  142,    0,    0,  188,    0,    0,
+	       0,   81,    0,  166,   21,    0,  139,  178,
+	       0,    0,  114,    0,    0,  141,    0,    0,
+	     118,    0,    0,  186,    0,    0,  196,   61,
+	       0,    0,  193,   88,  147,    0,  159,    0,
+	      39,   12,    0,  128,  190,   94,  109,    0,
+	       0,    0,    0,    0,   46,   82,    0,  198,
+	       0,   74,   24,   63,    0,  154,    0,   18,
+	     183,   48,  110,  164,   90,    0,  122,    0,
+	     128,    0,    0,    0,    0,    0,    0,  180,
+	      51,    0,    0,    0,    0,   96,   54,   35,
+	       0,   54,  156,   71,   77,    0,    0,    0,
+	      11,    0,    0,  168,    0,   47,    0,    0,
+	       0,    0,    0,   74,  111,    0,    0,   23,
+	       0,    0,    0,  101,   20,  130,    0,   39,
+	     139,   44,  186,   26,    0,    0,  143,   13,
+	       0,    0,  110,    0,  144,   77,    0,    0,
+	     192,    0,    0,  169,    0,    0,  118,    0,
+	       0,   57,    0,    0,   84,    0,    0,  174,
+	      16,    0,  107,  157,    0,  137,    7,    0,
+	       0,   97,    0,    0,  174,    0,    4,    0,
+	       0,  164,  138,  197,    0,  132,  174,    0,
+	      50,  117,    0,   95,    0,    0,  190,  153,
+	       3,   88,    7,    0,   90,   22,  136,    0,
+	      68,  130,    0,  195,    0,    0,  165,   36,
+	       0,  128,    0,    0,   29,    4,   86,    0,
+	       0,    0,  110,    0,   83,    0,    0,    0,
+	       0,   38,    0,   42,  127,    0,    0,  112,
+	       0,    0,  187,  121,    0,    0,    0,    0,
+	     162,    0,   31,   87,  102,    0,   69,    6,
+	       0,   89,    0,    0,  113,   96,    0,  173,
+	     104,    0,    0,   83,    0,  183,   30,    0,
+	     151,  126,   32,    0,  182,   40,    0,   98,
+	       0,    0,  185,    0,    0,    0,  182,    0,
+	      10,   56,    0,    8,  178,    0,    0,  189,
+	       0,    0,   91,    0,    0,  131,    0,    0,
+	      87,    0,    0,   16,   22,    0,  107,  177,
+	       0,   48,    0,  162,    0,   23,  131,   58,
+	      46,    0,  167,  135,   53,    0,  156,    0,
+	       0,  129,   36,    0,  119,    0,    0,   32,
+	       0,   59,   87,   99,    0,   84,   43,    0,
+	     103,   85,    0,    0,   50,    0,    0,   69,
+	       0,   46,  161,    0,    0,   39,  194,  156,
+	     124,    0,    0,    0,  197,    0,   78,    0,
+	       0,  199,    0,  186,   23,  176,    0,   80,
+	     120,  171,    0,   87,   86,    0,    0,    0,
+	       0,    0,   88,    0,    0,    0,    0,   75,
+	       0,    0,   37,    0,    0,    0,    8,    3,
+	     184,    0,    0,    0,    0,   52,    0,   16,
+	       0,
+	};
+	uint16_t h[2];
+
+	_inthash2(key, (uint32_t*)h);
+
+	h[0] = h[0] % 401;
+	h[1] = h[1] % 401;
+	h[1] ^= (h[0] == h[1]);
+	return (g[h[0]] + g[h[1]]) % 200;
+}
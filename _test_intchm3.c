@@ -0,0 +1,50 @@
+/* generated with rurban/nbperf 08a5797 -fIp _rand100 */
+/* seed[0]: 2246822507, seed[1]: 1 */
+#include <stdint.h>
+
+static inline void _inthash4(const int32_t key, uint64_t *h)
+{
+	*h = (int64_t)key * (UINT64_C(0x9DDFEA08EB382D69) + UINT64_C(2246822507))
+		 + UINT32_C(1);
+}
+
+uint16_t
+inthash(const int32_t key)
+{
+	static const uint8_t g[249] = {
+	    198, 89, 95,  4, 74, 82,  0,  0,  0,  0,
+	    100,  0,  0, 105, 133, 184, 94, 76, 178, 91,
+	    126, 147, 134, 82, 54, 44,  4, 192,  0, 142,
+	    85, 161, 156, 168,  6, 142,  0, 144, 179, 68,
+	     0, 125, 63, 64,  0, 95, 17,  0, 88, 101,
+	     0, 177,  0,  0,  0, 131, 188, 68,  0, 199,
+	    69, 123, 84, 141, 89, 169, 83, 130, 169, 83,
+	    105, 68, 92, 56,  3, 156,  0,  0, 33, 21,
+	    159, 169, 103, 108, 192, 50, 25, 189, 69, 157,
+	    94, 144, 86, 189, 19, 118, 153, 69, 170, 179,
+	    85, 178, 135, 149, 162, 156,  0, 112,  0, 166,
+	     0, 25, 28,  0, 11, 140, 129, 59, 51, 55,
+	    138, 79, 127, 65, 159, 185, 152, 16, 26, 46,
+	    25, 33, 103,  0, 78, 155, 173, 10, 138,  4,
+	     0, 166, 189,  0, 147, 59, 199, 143,  0, 31,
+	    117,  0,  0, 102,  0, 61,  0, 188, 183, 193,
+	     0, 29,  0, 63, 131, 25, 98, 68, 184, 16,
+	     0, 151, 127, 135, 107,  0, 32, 112,  0, 155,
+	    178, 79, 25,  9, 27,  0, 24, 186, 111, 54,
+	     0, 198, 147, 179, 42, 174,  8, 79, 76, 57,
+	    117, 192, 86, 63, 165,  0, 32, 25, 185, 96,
+	     0,  0,  0,  0, 14, 171, 166, 102,  0, 55,
+	     0, 130, 37, 130, 176, 70, 51,  0, 140, 169,
+	    60, 89, 25,  0, 106, 119,  0, 66, 52, 50,
+	    76, 86, 126,  0, 156, 87,  0, 134, 167,
+	};
+	uint16_t h[8];
+
+	_inthash4(key, (uint64_t*)h);
+
+	h[0] = h[0] % 249;
+	h[1] = h[1] % 249;
+	h[2] = h[2] % 249;
+	h[1] ^= (h[0] == h[1]);
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 200;
+}
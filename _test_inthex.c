@@ -0,0 +1,524 @@
+/* generated with rurban/nbperf 08a5797 -I _randhex */
+/* seed[0]: 1681692777, seed[1]: 1714636915 */
+#include <stdint.h>
+
+static inline void _inthash2(const int32_t key, uint32_t *h)
+{
+	*h = (key * (UINT32_C(0xEB382D69) + UINT32_C(1681692777)))
+		 + UINT32_C(1714636915);
+}
+
+uint16_t
+inthash(const int32_t key)
+{
+	static const uint16_t g[4001] = {
+	    1936, 1694,    0, 1717, 1435,  715,    0, 1072,
+	       0,  680, 1357,    0,  276, 1158,    0,  623,
+	     714,  331,  806,    0,    0,    0,  606,  345,
+	    1757,    0,  138, 1944,  847, 1197,    0,    0,
+	       0,    0,    0, 1607,    0, 1623,    0,  815,
+	    1632,  670,    0,    0,  732,    0,   51,    0,
+	    1727,    0,  794,  705,  476,  176,    0,    0,
+	     835,    0,    0,    0,   93, 1653, 1083, 1183,
+	       0, 1092,  857,    0,    0,    0,    0,    0,
+	       0,  964, 1212,  573,  226,  447,    0,    0,
+	     995,    0,  143,  398, 1555, 1475,  531,  110,
+	     740, 1504,    0,    0,    0,   11,    0,   83,
+	     725, 1759, 1873,  370, 1105, 1026,    0, 1738,
+	    1710,    0,    0,    0, 1121, 1241,  622,    0,
+	       9,  456,  795,    0, 1691,  381,    0,  819,
+	     562,  344, 1817, 1662,    0,  284,    0,    0,
+	       0,    0, 1895,    0, 1429,  451,  575,  335,
+	      10,  756,  617,    0, 1335,    0,    0,  773,
+	      62, 1627,    0, 1324,  207, 1600,    0,    0,
+	       0,    0,    0,    0,    0,  439,  965, 1051,
+	     631,    0,    0,    0, 1206,    0,  532,    0,
+	       0, 1311,  200,  762,  968,  950, 1674,    0,
+	     565,    0,    0,    0,  316,  909, 1672,  217,
+	    1379, 1632,    0,    0,    0, 1285, 1044,    0,
+	     926,  607,  843,  395, 1973,  317,    0,    0,
+	       0,    0,    0,    0,  204,  433, 1755,   91,
+	    1612, 1007,   76,    0,    0,    0,    0,    0,
+	     474,   51,  903, 1435, 1468, 1332,    0,    0,
+	    1194,    0, 1863,    0,  375, 1816,  615,    0,
+	    1600,    0, 1590,    0,    0,    0,    0, 1861,
+	    1296,    0,  878, 1870,  445, 1833,  646,    0,
+	       0,    0,    0,    0,   92, 1481,  166, 1469,
+	     566, 1391,    0,  268,    0,    0,    0,    0,
+	    1077, 1354,  909,   32,    0, 1567,    0,    0,
+	     911,    0,    0,    0, 1986, 1605,    0, 1272,
+	     838,  155,    0, 1618,    0,  543,    0,    0,
+	    1243, 1085,   42, 1782,  795, 1603,    0,    0,
+	     121,    0, 1087,  672, 1234, 1910, 1964, 1702,
+	    1489,  172,  881, 1259,    0,    0,    0,    0,
+	    1814,  556,   85,    0, 1028,  434,    0,    0,
+	       0,    0,  151,    0, 1424, 1032,  492,  992,
+	    1982,    0,    0,    0, 1849,    0,    0, 1467,
+	    1154, 1562, 1680,  217,    0, 1230,    0,    0,
+	       0,  233,    0,  269, 1330,    0, 1476,  495,
+	     250,    0, 1381,    0,  809,    0,  377,  800,
+	     241,  891, 1865, 1187, 1764,    0,    0,    0,
+	       0,    0,    0,  198,  436,  713, 1430,    6,
+	     956,  560,    0,    0, 1056,    0,  706, 1700,
+	     753,    0,  395, 1198,  239,    0, 1895,    0,
+	       0,    0,    0,    0,    0, 1260,  153, 1855,
+	       0,    0,    0,    0,    0,    0,    0, 1277,
+	     926,  164, 1249, 1932,    0,    0,  160,    0,
+	       0,  609, 1729, 1525,  363, 1022,  926, 1196,
+	       0,    0,    0,    0,    0,    0,    0, 1564,
+	    1546, 1103,    0, 1345,    0,    0,  400,    0,
+	       0,    0,  213, 1105, 1712,  927, 1877, 1187,
+	     591,    0,    0,  542,    0, 1468, 1116,  788,
+	     193, 1254,  765,   34,    0,    0,    0,    0,
+	    1688,    0,    0,  780,    0, 1620,    0,  843,
+	       0,    0,    0,    0,    0,    0, 1787, 1392,
+	     942,   45, 1758,   53,    0,    0,    0,    0,
+	       0,    0, 1929, 1066, 1588,  190,    0,    0,
+	       0,    0,    0,    0,    0,  557,  221, 1456,
+	    1369,   73, 1086,    0,    0,    0,    0,    0,
+	       0,  353,  861, 1560,    0,  570, 1384,    0,
+	    1199,    0,    0,  807,    0, 1293, 1344,  989,
+	       0,  905,  792,    0,    0,    0,    0,    0,
+	       0,  277, 1071,  185, 1894,  641, 1642,    0,
+	       0,    0,    0,    0,    0, 1606, 1385,  792,
+	     731, 1717, 1678,    0,    0,    0,    0,  553,
+	    1480, 1346,    0,  948,  371, 1534,  763,    0,
+	     295,    0,    0,    0,    0,    0, 1663, 1996,
+	    1874,  662,  910,    0,    0,    0,    0,    0,
+	       0,    0,  383,  850, 1236, 1771,  450,    0,
+	       0,  655,    0,    0, 1334,  668,  304,    0,
+	     776, 1416,    0,    0,    0,    0, 1806,    0,
+	     467,  536,  798,  356, 1512, 1981, 1749, 1169,
+	       0, 1237,    0,  463,  497,  859,    0, 1989,
+	    1132, 1225,    0,    0, 1518,    0,    0,    0,
+	     886,    0, 1013,    0, 1170,  322,    0,    0,
+	    1102,  245,    0,    0,  871,    0, 1340, 1676,
+	    1131, 1453,    0,  500,    0,    0, 1358,    0,
+	    1627,  128,    0,    0, 1708,    0,    0,    0,
+	       0,    0, 1585,  405,  516,  895, 1965,  719,
+	       0,    0,  919, 1245,    0,    0,    0,  460,
+	     697,  759, 1221, 1018,  196,    0,    0,    0,
+	    1270,    0,    0, 1788, 1916,  717, 1931,  220,
+	      18,    0,    0,    0,    0,  776,    0, 1977,
+	     552, 1866,  684, 1894, 1589,  981,    0,  801,
+	       0,  243, 1479,  724, 1097,  891,   47,  528,
+	    1235,    0,    0,    0,    0,    0,    0,    0,
+	    1803, 1952, 1314, 1481, 1408,    0,  952,    0,
+	       0,    0,    0,  754,    0,  845, 1626,  370,
+	       0,    0,    0,    0,  221,    0,    0, 1535,
+	     383, 1708,  970, 1151, 1760,    0,    0,    0,
+	     746,    0,    0,  243, 1731,  448,    0, 1535,
+	    1060,    0,  207,    0,    0,    0,    0, 1743,
+	    1587,   74,  782,  189, 1176,  942,    0, 1395,
+	     404,    0,    0,  232, 1464,    0,  955,    0,
+	     616,    0,    0,    0, 1813,    0,    0,  613,
+	     399,  941,    0, 1162, 1883, 1991,    0,  831,
+	       0,  349,    0, 1652, 1767,  988,  386,    0,
+	     760, 1001,  232,    0,  391,    0,    0, 1289,
+	    1003, 1416,    0,  669, 1604,    0,    0,    0,
+	       0,    0,    0,  435, 1909, 1601,  917,   61,
+	      31,    0,    0,  533,    0,    0,    0,  175,
+	     784, 1998,  852, 1317,    0,    0, 1753,    0,
+	     761,  723,    0,  622,    0,  723,  108,  287,
+	     774, 1302,    0,    0,    0, 1109,  558,  439,
+	     248,  214, 1209,    0, 1109, 1405,  244,    0,
+	       0,    0,    0,  488,  456, 1938, 1150,   99,
+	       0,    0, 1767,  137,    0,  779, 1376, 1045,
+	     559,  296,  866,    0, 1720,    0,    0,    0,
+	       0,    0,    0,    0, 1774,    0,  340, 1491,
+	       0,    0,  140,    0,    0,    0,    0,  956,
+	     537, 1734,   32,  462, 1159,    0,    0, 1059,
+	       0,    0,    0, 1333,    0,    0,  424,    0,
+	     320,    0,    0,    0,    0,    0,    0,    0,
+	    1539, 1437,  767, 1730,  133,    0,  725,  551,
+	       0,  209,    0,  596, 1750, 1192, 1205, 1478,
+	     444,    0,    0,    0,    0,    0,  726, 1286,
+	    1967,    0, 1661,   92, 1772,    0,    0,    0,
+	       0,    0,    0,    0,  524,  699,  777,  828,
+	     538, 1055,    0,  684,    0,    0, 1272, 1651,
+	    1445,  275, 1758,  294, 1953,    0,    0,    0,
+	       0, 1690,    0, 1084,  923, 1684, 1868,  162,
+	    1318,    0, 1711, 1878,    0,  640,    0,  422,
+	    1172,  756, 1647,  663,  697,    0,    0,    0,
+	       0,    0, 1732,  400, 1090,  993, 1196, 1841,
+	     880, 1554,    0,    0,    0,    0,    0,    0,
+	    1578,  723, 1886,  403,    0,    0, 1015,    0,
+	       0,    0,    0, 1388,    0,  592,    0, 1835,
+	    1064,    0,    0,    0, 1702,    0, 1439,    0,
+	    1155,  398, 1890, 1156, 1893,    0,    0,    0,
+	       0, 1983,    0,    0, 1774, 1892,    0, 1244,
+	    1126,    0,    0,    0,  625,    0,  630,  869,
+	    1375, 1331,  940,    0, 1845,    0, 1656,    0,
+	       0,    0,    0,  594,  551,  778, 1334,  831,
+	     692,    0,    0,    0,    0,    0,    0,   69,
+	       0,  379,  975,  105, 1538,    0,   50,    0,
+	       0,    0,    0,    0, 1777, 1651,   78,  814,
+	       0,    0,    0,  713,    0,  297,    0,  786,
+	     134, 1528, 1347,    0,  141,  872,    0,  348,
+	    1875,    0, 1432, 1630,  602, 1939,  275,  760,
+	       0,    0, 1081,    0,   49,  608,    0, 1669,
+	     910, 1992,    0,  583, 1412,    0,    0,  596,
+	       0,  346, 1009, 1329, 1709,  552, 1959,  457,
+	    1167,    0,    0,    0,    0,    0,    0,  688,
+	    1467, 1556,    0,  290,  301,    0,    0,    0,
+	       0,    0,    0, 1416, 1276,  551, 1185, 1509,
+	     548,    0,    0,    0, 1214,    0,   11, 1848,
+	    1275,  734, 1638,  188,    0,    0,    0,    0,
+	       0,    0,    0,  554, 1677, 1265, 1503, 1437,
+	    1565, 1683,    0,  976,    0,  766,    0,  448,
+	    1705,  112,  323, 1803, 1421,    0,    0,    0,
+	       0,    0,    0,    0,  182, 1386, 1337,    0,
+	       0,    0,    0,  967,    0,    0,    0,  114,
+	     834, 1629,  494,  315,  233,    0,    0,    0,
+	       0,    0,  839,  934, 1602,   74,  735, 1756,
+	    1020,    0,    0,    0,    0,    0,    0,    0,
+	     107, 1093,    0, 1580, 1602,    0, 1046,  245,
+	       0,    0, 1773, 1873, 1144,  738, 1039, 1336,
+	    1675,    0,    0, 1975, 1216,    0,    0, 1854,
+	    1471, 1798,  707,    0,   18,    0,    0,    0,
+	    1265,    0,    0,    0,    0,  361,  307, 1864,
+	    1836, 1739,    0,    0,    0, 1253,    0, 1615,
+	     584,  994, 1202, 1799,    0, 1474,    0,    0,
+	       0,    0,    0,  718,  901,  683,  919, 1251,
+	      93,    0,    0,    0,    0,    0, 1049, 1903,
+	    1962, 1823,    0,  265,    0,    0,    0,  488,
+	    1937,    0,  211, 1601, 1102,  601, 1409,    0,
+	     311,    0,   22,    0,    0,    0, 1480,  394,
+	     473,  512,  408,  867,  789,    0,    0,    0,
+	       0,    0, 1601,  223, 1876,  310,  519,  254,
+	       0,    0,    0,    0,    0,    0, 1148, 1595,
+	    1383, 1820,  815, 1514,    0,    0,    0,    0,
+	       0,    0,    0,  749, 1015,  865, 1988, 1435,
+	       0, 1547,  428,    0, 1030,    0,  749,    0,
+	    1346,    0,  983,    0, 1068,    0,    0, 1277,
+	       0,    0, 1808, 1613, 1376, 1653,    0,    0,
+	       0,    0,    0,    0,    0,  779,  929,  611,
+	    1648,    0,  407,    0,    0,    0,    0,    0,
+	       0,    0,  413, 1316,  514,  722,    0,    0,
+	       0,    0, 1381,    0,    0, 1455,  700, 1322,
+	    1811, 1184, 1046,    0,    0,  579,    0,    0,
+	       0, 1051,    0,    0,    0,    0, 1698,  405,
+	       0,    0,    0,    0,    0,    0, 1686, 1721,
+	    1122, 1533,    0,    0, 1965,    0,    0,  699,
+	       0,  525,  624, 1210,  442,  561,    0,    0,
+	       0,    0,    0,    0,    0, 1655,  827, 1262,
+	    1744,  270,    0,    0, 1595,    0, 1484,    0,
+	     886, 1095, 1924,  405,  590,    1,    0,    0,
+	       0,    0,    0,    0,  313,  298,    0,  614,
+	     941, 1837,    0,    0,    0,    0,    0,    0,
+	     687,  564, 1997, 1217, 1628,    0, 1837,    0,
+	       0, 1090,    0, 1734, 1096, 1310, 1387, 1852,
+	     440, 1349,    0,    0,    0,    0,    0,    0,
+	       0, 1311,  774,    0,   33,  521, 1317,    0,
+	       0,    0,    0,    0,  425,  859,  988, 1791,
+	       0,    0,    0,    0,    0,    0,    0,    0,
+	     536, 1427,  123,  144,  527,    0,    0,    0,
+	       0,    0,    0, 1742, 1059,  896, 1993,  900,
+	     416,  217,    0,    0, 1749, 1775,    0,  591,
+	    1133, 1032,    8, 1223, 1516,    0,    0,    0,
+	       0,    0,   90,  535, 1233, 1113, 1149, 1179,
+	     253, 1120,    1,    0,    0,    0,  560,    0,
+	     160,    0,  205, 1887, 1025,    0,  101,  224,
+	       0,  473,    0, 1961, 1994,   68, 1274,  102,
+	     468,    0,    0, 1670,  612,    0,    0, 1055,
+	     704, 1179, 1603,    0, 1555,    0,    0,    0,
+	       0, 1332,    0,    0, 1073, 1503, 1802, 1494,
+	       0,    0,    0,    0,    0,  155,    0,  100,
+	    1616, 1703, 1400,   72,    0,    0,    0,    0,
+	    1976,    0, 1727,    0, 1882, 1990,  310,  959,
+	    1337,    0,    0,    0,    0,    0,    0, 1171,
+	     639,   75, 1062,  984,    0,    0,    0,  833,
+	       0,  118,    0,  947,  360,    0,  655,  446,
+	       0,    0,    0,    0,    0,    0, 1303,  676,
+	     604, 1906,  333,  469,    0,    0,    0, 1951,
+	       0,    0,    0,    0, 1207,  216,    0, 1576,
+	       0,    0,    0,    0, 1537,    0, 1586, 1562,
+	    1797, 1379,  410,    0, 1692,    0,    0,    0,
+	       0, 1843,    0, 1876,  397,  808, 1338,  992,
+	    1692,    0,    0,    0,    0,    0,    0,  159,
+	     797, 1215, 1290,    0,    0,    0,    0,    0,
+	    1110,    0,    0,  954, 1061, 1826,  416,  844,
+	       0,    0, 1155,    0,    0,    0,    0, 1356,
+	     727,  127, 1745,    0,    0,    0,    0,  808,
+	       0,    0,    0,   33,  775, 1971, 1910,    0,
+	       0,    0, 1800,    0, 1053,    0,    0,  946,
+	       0, 1768,  483, 1315,   17, 1575,    0,    0,
+	       0,    0,  811, 1186,  450, 1891, 1654,  651,
+	       0,    0,    0,    0,    0, 1360,    0, 1826,
+	     816,  135, 1916, 1681,  882,    0, 1695, 1823,
+	       0,    0,  712, 1707, 1473,  792,  746,  626,
+	       0,    0,    0,    0,    0,    0,    0,    0,
+	     203, 1950,  603, 1447, 1809,    0,  521,    0,
+	    1865,    0,    0, 1321,    0,  431,    0, 1264,
+	       0,    0,    0,    0,    0,    0,    0,  321,
+	    1779,  724,  267,  393,    0,  159,    0,    0,
+	       0,    0,    0,  229, 1305, 1215, 1203, 1900,
+	       0,    0,    0,    0,    0,    0,    0, 1164,
+	     888,  861,    0,    0,    0,    0,    0,  574,
+	       0,    0,  647, 1356,  464,    0, 1125,    0,
+	    1299,    0,    0,    0,    0,    0,    0,  619,
+	       0,  234,  441,  151,    0,    0,    0,    0,
+	       0,    0,    0,  109, 1839, 1158, 1786,  324,
+	       0,    0,    0,    0,    0,    0,    0, 1278,
+	    1715,   16,    0, 1593, 1327,    0,    0,  431,
+	       0,  914,    0,    0, 1235,  187,    0, 1144,
+	       0,    0,    0,    0,    0,    0,  210,  421,
+	     125,    0,  114,  849,    0,    0,    0,    0,
+	       0,    0,    0, 1168, 1423,  799, 1058, 1157,
+	       0,    0,    0,    0,    0, 1124,    0, 1052,
+	    1606,  969,  725,  310,    0,    0,    0,    0,
+	       0,    0, 1830, 1075,  947, 1508, 1596, 1775,
+	       0,    0,    0,    0,    0,    0,    0, 1398,
+	     636, 1231,    0,  256,  342,    0,    0,  406,
+	       0,    0,    0, 1404,  335,    0, 1659, 1821,
+	       0,    0,    0,    0, 1975,  928,    0,  994,
+	     504, 1159,   23,  282,    0,    0,    0,    0,
+	       0,  676,    0,  597,  156, 1795,  633,    0,
+	       0,    0,    0,    0,  150,    0, 1302,  777,
+	    1718,    0, 1668,  457,    0,    0,    0,    0,
+	       0,    0,    0,  569, 1572, 1911, 1346, 1429,
+	       0,    0,    0,    0, 1607,    0,    0, 1154,
+	     333,    0, 1836, 1010,    0,    0, 1946,    0,
+	    1281, 1398,    0,  165, 1977, 1493,  282, 1736,
+	       0,    0,    0,    0,    0,    0, 1406, 1367,
+	    1812,  934,  457,    0,    0,    0,    0,    0,
+	       0,    0,    0,   28,  913, 1568,  568,  514,
+	       0,    0,  779,  543,    0,  494,    0,  303,
+	    1547,  925,  204,   24,    0,    0,    0,    0,
+	       0,    0,    0,  133,  939, 1983, 1728, 1909,
+	       0,    0,    0,    0,    0,    0,    0,  140,
+	    1359, 1920,  982, 1265,    0,  201,    0,    0,
+	       0, 1477,    0,  738,    0, 1805,  992,    0,
+	       0,    0,    0,    0, 1981,    0,    0,  933,
+	    1687, 1006, 1348,  989, 1478,    0, 1627,    0,
+	       0,    0,    0,    0,  823, 1636,    0,  757,
+	     479,    0,    0,    0,    0,    0,    0, 1449,
+	    1679,    0, 1123, 1815,    0,    0,    0,    0,
+	       0,    0,    0, 1953, 1488,  796,    0, 1357,
+	      44,    0, 1170, 1908,    0,    0,    0, 1390,
+	    1923,  373,  330,    0,    0,  263,    0,    0,
+	       0,    0,  604,  149, 1649,    0,  582,    0,
+	    1928,    0,    0,    0,    0,    0,  993, 1520,
+	     523, 1063,  263,  839, 1978,  328,    0,    0,
+	       0,    0,  818,  122, 1967,    0, 1298,    0,
+	       0,    0,    0,    0,    0,    0,  402, 1374,
+	    1147,  349,    0, 1664,    0,    0,  699,    0,
+	       0, 1203, 1665, 1034,    0,  582,    0,  747,
+	       0, 1776,    0, 1940,    0,    0,    0,    0,
+	    1876, 1402,  148,  603,    0,    0, 1727,    0,
+	    1870,    0,  702,    0, 1023, 1219,    0,    0,
+	       0,    0,    0,    0,    0,    0,    0, 1123,
+	     744, 1530, 1461,  998,    0,    0,  423,    0,
+	       0, 1170,  260,  415,  870,    0,  842,    0,
+	       0,    0,    0,    0,    0,  208,    0, 1574,
+	    1537, 1119,    0,  381,    0,    0,    0,    0,
+	       0, 1474,  232, 1060, 1405,    7,  972,    0,
+	      71,    0,    0,    0,    0,    0, 1561, 1764,
+	       0,  659,    0,    0,    0,    0,    0,    0,
+	       0, 1609, 1094,  991,    0,  764, 1205,    0,
+	       0,    0,    0,    0,    0,  868, 1191,  383,
+	     848,  359,    0,    0,    0,    0,    0, 1859,
+	       0, 1412, 1131, 1393, 1122,  452,    0,  917,
+	       0,    0, 1309,    0,    0, 1130,    0,    0,
+	       0, 1792,    0,  882,    0,    0,    0, 1294,
+	     943,  963,  944, 1563, 1695, 1047,    0,    0,
+	       0,    0,    0,    0, 1625, 1080,    0,  458,
+	    1877,  642,    0,    0,    0, 1827,    0,    0,
+	       0,    0, 1783,  212, 1896,  458,    0,    0,
+	       0,    0,    0,    0,  711,  257,  286, 1928,
+	       0,   54,    0,    0,    0,    0,    0, 1871,
+	    1753,  539, 1883,    0,  460, 1443,    0,  989,
+	       0,    0,    0,    0, 1238, 1578,   36, 1648,
+	     454,    0,    0,    0,    0,    0,    0,    0,
+	     378,    0, 1798,  665,  936,    0,    0,    0,
+	       0,    0,  943, 1410,  709,  812,  166, 1749,
+	    1581,    0,    0,    0,  123,    0,    0, 1273,
+	     671,    0,   12, 1889, 1927,    0,    0,    0,
+	       0,  290,    0, 1968, 1582, 1014, 1545,  520,
+	     794,    0,    0,    0,    0,    0,    0, 1919,
+	     324, 1597, 1091, 1153, 1033,    0,    0,    0,
+	      88,  584,    0,  476, 1464, 1206, 1487,  706,
+	     709,    0,    0,    0,    0,    0,    0,  288,
+	    1291,  986,    0,  397,    0,  119, 1642,    0,
+	    1013,    0,    0,   66,  719,   15,  698, 1158,
+	       0,    0,    0, 1549,    0,  604, 1912, 1707,
+	    1559, 1434,  189,  420,    0,    0,    0,    0,
+	    1375,    0,  278,  555,    0, 1634, 1499, 1801,
+	       0,    0,    0,    0,    0,    0, 1063,    0,
+	    1036, 1947,    0,  675,    0,    0,    0, 1662,
+	       0,    0,    0, 1054, 1452, 1200,  348,    0,
+	       0,    0,    0,    0,  396,    0,    0,  291,
+	     931,  803,  540, 1784,    0,    0,    0,    0,
+	       0,    0, 1860,  918,  428, 1198,   59,    0,
+	       0,    0,    0, 1588,    0,    0,   18, 1811,
+	    1548,   11, 1050,    0,    0,    0,    0,    0,
+	       0,    0, 1082,   55, 1892,  130, 1089,    0,
+	       0,    0,    0,    0,    0,    0,  428, 1411,
+	     834, 1103,  947,    0,    0,    0, 1178,    0,
+	       0,    0, 1631,  117,  685, 1687,  264,  336,
+	       0,    0,    0,    0,    0,    0, 1108,    0,
+	       0, 1497,  888,    0,    0, 1175,    0,    0,
+	       0, 1462,  824, 1190, 1924, 1591, 1364,    0,
+	       0,   21, 1513,    0,    0,    0,  333,    0,
+	     884,    0,    0,    0,    0,    0,    0,    0,
+	       0,    0, 1295,  387,    0, 1382,    0,    0,
+	       0,  816,    0,    0,    0,    0,    1,  230,
+	     860,  857,    1,    0,    0,    0,    0,    0,
+	       0, 1850,  979,    0,  993, 1778, 1446,    0,
+	       0,  704,    0,    0,    0,    0, 1463, 1944,
+	     119,   56,  902,  240,    0,    0,  487,    0,
+	       0,    0,  158,    0, 1281,    0, 1914,    0,
+	       0,    0, 1953,    0,    0,    0, 1104,  369,
+	     887, 1865,    0, 1566,    0,  680,    0,    0,
+	       0,    0,  247,    0,  222,    0,  392,  436,
+	       0,    0,    0,    0,    0,  339, 1107,  832,
+	      81, 1612,    0,    0,    0,    0,    0,    0,
+	       0,    0,  198, 1297,    0,    0,  655, 1790,
+	       0, 1454,    0,    0, 1268,    0, 1055,    0,
+	    1824,  627, 1595,    0,  116,    0,  561,    0,
+	       0,    0, 1392, 1829,   51, 1931,    0,    0,
+	       0,    0,    0,    0,    0,    0,  437,  438,
+	     787, 1644, 1697,  542,    0,    0,    0,    0,
+	       0,    0, 1270, 1330, 1165,   19,    0,    0,
+	       0,    0,    0,    0,    0,    0,    0,  111,
+	     760,    0,  643, 1695,    0,    0,  186,    0,
+	       0,    0,  776, 1599, 1562,  482,    0,    0,
+	       0,    0,    0,    0,    0,    0,  686, 1324,
+	     691,  693,  327, 1652,    0,  897,    0,    0,
+	       0,    0,  100, 1669, 1624,    0, 1967,    0,
+	       0,    0,    0,    0,    0,    0, 1970,    0,
+	     199,  137,  713,    0,    0,    0,    0,    0,
+	       0,    0,    8,  967, 1763, 1282,  326,    0,
+	       0,    0,    0,    0,    0,  169, 1905,  527,
+	    1682,    0, 1100,    0,    0,    0,   14,    0,
+	       0,    0,  815, 1227,  207,  712, 1086,    0,
+	       0,    0,    0,    0,    0,    0,    0, 1780,
+	     111, 1736, 1106,    0,    0,    0,    0,    0,
+	       0,  733, 1436,  682, 1907,    0, 1248,    0,
+	       0,    0,    0,    0,    0,  223,    0, 1423,
+	    1042, 1326,  141,    0,    0,    0, 1323,    0,
+	    1373,    0,    0,  695, 1292,  791, 1900,    0,
+	       0,    0,    0,    0,    0,    0, 1583,  258,
+	       0, 1726, 1822,    0,    0,    0,    0, 1181,
+	       0,    0,  906, 1871,   82, 1797, 1719,    0,
+	       0,    0,  173,    0,    0, 1064,  684,  213,
+	      63,  451,  806,    0,    0,    0,    0,    0,
+	       0, 1445,  610,  466,  932,  937,  758, 1655,
+	       0,  475,    0,    0,    0,    0, 1261,  241,
+	    1283,  407, 1395,    0,    0,    0,  942,    0,
+	       0,    0,  299,    0, 1355, 1438,  508,  147,
+	       0,    0,    0,    0,    0,    0,  273,  137,
+	    1313,  131, 1527,    0,    0,    0,    0,    0,
+	     218, 1069, 1560,  646, 1857, 1366,  988,    0,
+	    1724,    0,    0, 1174,    0,  609, 1172, 1516,
+	    1935,  815,  592, 1045,    0, 1707,    0,    0,
+	       0,    0, 1979, 1875,  899,  401,  135,    0,
+	       0,    0,    0,  859,    0,    0, 1888,  187,
+	    1741, 1465, 1138,    0,    0,    0,    0,  541,
+	       0,    0,  478,  678, 1659, 1922, 1395,    0,
+	       0,    0,    0,    0,    0,    0, 1797, 1114,
+	     197,    0,    0,    0, 1307, 1212,    0,    0,
+	       0,    0, 1202,  134,  352, 1584, 1482,    0,
+	       0,    0,    0,    0,    0,    0, 1319,  533,
+	    1980,    0,  764,    0, 1820,    0,    0,    0,
+	       0,    0, 1626,  449,    0,   82,  936,    0,
+	    1315,    0,    0,    0,    0,    0, 1284,  637,
+	     225, 1959, 1733,    0,    0,    0,    0,    0,
+	       0,    0, 1024, 1101, 1271, 1677, 1437,    0,
+	       0,    0,    0,    0,    0,    0,    0,  424,
+	       0,  438,  861, 1645,    0,  966,    0,  470,
+	       0, 1078, 1633,  964, 1594, 1258, 1353,    0,
+	       0,    0,    0,    0, 1831,  261,  401, 1408,
+	       0, 1912,  281,    0,  625,    0,    0,    0,
+	       0, 1612, 1288,  526, 1909,    0,  802,    0,
+	       0,    0,    0,    0,    0, 1200,  559,    0,
+	    1153,  795,  319,    0,    0,    0,    0,    0,
+	       0, 1378,   77,   67,    0,  517, 1398,    0,
+	       0,   34,    0,    0,    0, 1656,  417, 1907,
+	     279,  568,    0,    0,    0,    0,    0,    0,
+	    1628, 1508, 1048,  183,  538,  898,    0,    0,
+	       0,    0,    0,    0, 1224,  401, 1834,  936,
+	     672,    0,    0,    0,    0,    0,    0,    0,
+	    1942,    3,  677,    0,  885,  260,    0,    0,
+	       0,    0,    0,    0, 1800,    0,    0,  904,
+	    1770,  957, 1571,    0,    0,    0,  927,    0,
+	     385,  252,  648,  996,  521, 1785,    0,    0,
+	    1107,    0,    0,    0, 1685,    0, 1723,    0,
+	       0,  744,    0,    0,    0,    0,    0,    0,
+	       0, 1364, 1130, 1687,    0,  651,    0,    0,
+	       0,  191,    0,    0,    0, 1515, 1430,   86,
+	    1335, 1744,    0,    0,  171,    0, 1401,    0,
+	    1861,    0,    0,  332,   13,    0,    0,    0,
+	       0,    0,    0,    0,  498, 1921,  429, 1975,
+	     749,    0,    0,  544,    0,    0,  800,  898,
+	     274, 1743, 1515, 1481, 1437,    0,    0,    0,
+	       0,    0,    0,    0,  864,  743,  275,  500,
+	     146,    0,    0,  917,    0,    0,    0, 1741,
+	     570, 1457,    0,    0, 1045,    0, 1880,    0,
+	       0,    0,    0, 1623,  804,    0,  652, 1037,
+	       0,    0,    0,    0,    0,    0,    0, 1547,
+	    1306,  937,  215,  712,    0,    0,    0,    0,
+	       0,    0,   16, 1208,    0,    0,  106,  600,
+	       0,    0,    0,    0,    0, 1640,  394,   69,
+	    1076, 1115, 1701, 1123,    0,    0,    0,    0,
+	       0,    0, 1032,  734, 1501, 1590,    0,  629,
+	       0,    0,  902,    0,    0,    0,    0,  308,
+	      85, 1522,  229,   37,    0,    0,  349,   84,
+	       0,    0, 1057, 1441,  637,  630, 1748, 1246,
+	       0,    0,    0,    0,    0,    0, 1984,  271,
+	    1712, 1431, 1884, 1146,    0,    0,    0,    0,
+	       0, 1986,  120,    0,  315,    0, 1781,    0,
+	       0,    0,    0, 1807,    0, 1418,    0, 1846,
+	       0, 1163, 1853,    0,    0,    0,    0,    0,
+	       0,  237,  977,   14,   91,    0,   16,    0,
+	       0,    0,  471,    0,    0, 1035, 1896, 1540,
+	     296,  544, 1528,    0,    0,    0,    0,    0,
+	       0,  242,    0, 1828, 1693,  892,  338,    0,
+	       0,    0,    0,    0,    0,  202, 1047, 1118,
+	     309,  479,  333,    0,    0,    0,    0, 1394,
+	       0,  365,  901, 1038, 1984,  195, 1657,    0,
+	       0,    0,    0,  283, 1006,  124,  956,    0,
+	    1459, 1166,  876,    0, 1599,    0,    0,    0,
+	       0,  679, 1012, 1096,  817, 1340, 1375,  936,
+	       0,  748,    0,    0,    0,  720,  152, 1258,
+	       0,    0, 1542,    0,    0,    0,  255,    0,
+	       0, 1495,  514,  396, 1818,    0,    0,    0,
+	       0,    0, 1294,    0,    0,    0, 1164,   39,
+	      30,  231,  684,    0,    0, 1415,    0,    0,
+	       0, 1101, 1619, 1304,  906,  676, 1810,    0,
+	       0,    0,    0,    0,    0,  632,  855, 1229,
+	      63, 1188,    0,    0,    0,    0,    0,  337,
+	       0,  717,    0, 1354,  841, 1029, 1195,    0,
+	       0, 1528,    0,    0,    0,   10,  690, 1761,
+	    1502,  997,    0,    0,    0,    0,    0,    0,
+	       0,  703,  725,  314,  685,  907,  318,    0,
+	       0,    0,    0,    0,    0, 1067, 1426,    0,
+	    1796, 1361,  427,    0,    0,    0,    0,    0,
+	       0,  366, 1224, 1689, 1503, 1507,  390,    0,
+	       0,    0,    0,    0,    0,  350, 1482,  266,
+	     856, 1851,  805,    0,    0,   35,    0,    0,
+	       0,  939, 1771,    0, 1312, 1731, 1067,    0,
+	    1334,    0,    0,    0,    0,   29,    0,  392,
+	    1716, 1660,    1,    0,    0,    0,    0,    0,
+	       0,   41,    0, 1763,   96,    0,   46,    0,
+	       0,    0,    0,    0,    0,  426,  845,  616,
+	     846,  315, 1671,    0,    0,    0,    0,    0,
+	       0, 1426,  180, 1420, 1969,   11, 1693,    0,
+	       0,    0,    0,    0,    0,    0, 1888,    0,
+	     752, 1505,  664,    0,    0,    0,    0,    0,
+	       0,  213,    0, 1380,    0,  911,  958,    0,
+	       0, 1005,    0,    0,    0,  109,    0,  530,
+	     449,    0, 1974,    0,    0,    0,    0,    0,
+	       0,  505,  535,    0,  503, 1377, 1442,    0,
+	       0,  245,    0, 1440,    0, 1578, 1269,  344,
+	       0,  840,  171,    0,    0,    0,    0,    0,
+	       0,
+	};
+	uint16_t h[2];
+
+	_inthash2(key, (uint32_t*)h);
+
+	h[0] = h[0] % 4001;
+	h[1] = h[1] % 4001;
+	return (g[h[0]] + g[h[1]]) % 2000;
+}
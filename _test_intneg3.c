@@ -0,0 +1,539 @@
+/* generated with rurban/nbperf 08a5797 -I _randneg */
+/* seed[0]: 1780695788, seed[1]: 709393584 */
+#include <stdint.h>
+
+static inline void _inthash4(const int32_t key, uint64_t *h)
+{
+	*h = (int64_t)key * (UINT64_C(0x9DDFEA08EB382D69) + UINT64_C(1780695788))
+		 + UINT32_C(709393584);
+}
+
+const int32_t inthash_keys[2000] = {
+	22191317, -51939742, 49841712, -30939442, 63981914, -38219546, -13369191, -5739082, 14351205, -5249075,	/* 10 */
+	44451635, -349005, 31711453, -60969871, -66919956, -16239232, -14979214, 29191417, 4341062, 66991957,	/* 20 */
+	57401820, -22819326, 38221546, 17291247, -22889327, 46901670, -12809183, 15051215, 60551865, -43539622,	/* 30 */
+	16101230, -11479164, 41931599, 53201760, -34719496, 5671081, -34439492, -63349905, -63629909, 1051015,	/* 40 */
+	-69369991, -4479064, 24781354, 24571351, -18619266, 21701310, -18689267, 67901970, 46481664, -11899170,	/* 50 */
+	54321776, -65939942, -62579894, -61529879, -9799140, -29189417, -23869341, 421006, 701010, 14001200,	/* 60 */
+	-55719796, 37031529, -19529279, -24219346, -60479864, -32129459, -61039872, 17851255, -14279204, -28209403,	/* 70 */
+	-7279104, -11199160, 3081044, -58309833, -21139302, 63351905, -34299490, -41229589, 52431749, 8821126,	/* 80 */
+	-6929099, -21629309, 56071801, 37171531, -64399920, -37729539, -15539222, -54809783, -15679224, 59921856,	/* 90 */
+	-19599280, 38851555, -38639552, 35911513, -44519636, 58101830, -65659938, 20791297, 8891127, 43401620,	/* 100 */
+	47671681, 3501050, 3641052, -13999200, 43121616, 25971371, 32061458, -40389577, 23381334, -53129759,	/* 110 */
+	-60409863, -51869741, 21981314, 17501250, 24221346, -1539022, 1541022, -22609323, -51729739, 62651895,	/* 120 */
+	-42559608, 8471121, -10359148, 9731139, -17219246, -41509593, 65871941, -37449535, -62719896, -47389677,	/* 130 */
+	69091987, -63769911, 28701410, -48719696, -40669581, 50261718, -57959828, -23519336, 61181874, 46411663,	/* 140 */
+	-29959428, -11409163, 49981714, -18479264, -26879384, 9521136, 28001400, -50959728, -31149445, -21839312,	/* 150 */
+	-58449835, -48229689, -11759168, -69159988, -68669981, 36541522, -66849955, 14421206, 55161788, -6649095,	/* 160 */
+	-62369891, -65029929, 37871541, -60199860, 52571751, -67339962, 31011443, 34861498, 13161188, 17431249,	/* 170 */
+	-32199460, 54251775, -66569951, -16449235, -32059458, -65379934, -2239032, 7421106, -69789997, 6441092,	/* 180 */
+	-40109573, 18831269, -41789597, 65451935, 8611123, 14561208, -10289147, -489007, -23099330, -45919656,	/* 190 */
+	-57049815, 39341562, 68881984, -2099030, 141002, -37589537, 30241432, 1751025, 36611523, -22259318,	/* 200 */
+	-61669881, -15049215, -34999500, -48019686, 68111973, -39199560, -64539922, -60899870, 13231189, -3289047,	/* 210 */
+	-42419606, -36749525, -48999700, -36189517, -40319576, 57821826, -32409463, -17849255, 69231989, 45291647,	/* 220 */
+	-38429549, -49769711, -35069501, 68041972, 12461178, 55441792, 14281204, 41861598, -30799440, 34581494,	/* 230 */
+	-54389777, -26389377, -51659738, -10569151, 25691367, 7981114, 52291747, -7699110, 34091487, 60691867,	/* 240 */
+	18971271, 211003, -26739382, 25621366, -46199660, 37451535, 34931499, -25689367, -66149945, 66571951,	/* 250 */
+	-9309133, -6299090, -53689767, 69791997, 61811883, -39619566, -23169331, 67131959, -66499950, -12529179,	/* 260 */
+	-12879184, -12109173, -45289647, -9449135, 41301590, -14209203, -66079944, -40249575, -36539522, 42701610,	/* 270 */
+	41581594, -47319676, 39691567, -3009043, 14071201, 61741882, 24151345, -42629609, -41719596, 50191717,	/* 280 */
+	58171831, 6301090, -51519736, -27159388, 53481764, -45429649, 2031029, -13719196, -34019486, 23941342,	/* 290 */
+	-24639352, 57681824, -64749925, -1609023, 36401520, 2451035, -50469721, -27439392, 5461078, 26321376,	/* 300 */
+	-67199960, 50401720, -41369591, -13229189, -7349105, -18549265, -58659838, 42421606, -46059658, -16659238,	/* 310 */
+	-51099730, 56001800, -12039172, 26391377, 38501550, 54811783, 32341462, -839012, -61809883, -40529579,	/* 320 */
+	6861098, -43959628, 21001300, -17009243, -21349305, 19181274, 64331919, 41161588, 1611023, -14629209,	/* 330 */
+	-54669781, -7209103, 61111873, 12111173, -64049915, 30871441, 5881084, 44311633, -69509993, 61461878,	/* 340 */
+	-8329119, -34579494, 19601280, -63489907, -1399020, -279004, -35489507, -27089387, -47529679, -36819526,	/* 350 */
+	-43819626, -66359948, -31989457, 59221846, 12811183, 10641152, -59359848, 10921156, -57259818, 51311733,	/* 360 */
+	44801640, -33459478, -3079044, -15959228, -45499650, -67409963, -56209803, 45431649, 65731939, -36119516,	/* 370 */
+	841012, 63071901, -1679024, 67761968, 17711253, 50821726, -54529779, -51379734, 67691967, 28491407,	/* 380 */
+	-22119316, -37939542, 27371391, 23731339, 45781654, -53549765, 32481464, -67759968, -37519536, -26949385,	/* 390 */
+	63701910, -55929799, -9379134, -58729839, 38081544, -22539322, -12179174, -63979914, 59291847, -10989157,	/* 400 */
+	33461478, -66639952, -55579794, -29539422, -63139902, -14559208, 45851655, 57261818, -21069301, 60481864,	/* 410 */
+	-23799340, -24569351, 62091887, -46549665, 29751425, -37099530, -20229289, 7631109, -20369291, -40949585,	/* 420 */
+	-2449035, -1259018, -55439792, -52989757, 10991157, 68811983, -19179274, 8751125, -40459578, -65449935,	/* 430 */
+	56981814, -60059858, -16379234, 42911613, 15191217, -61739882, 59361848, 36051515, 59781854, -47599680,	/* 440 */
+	-16589237, -2799040, -48789697, 39901570, 9031129, -55789797, 45361648, -66429949, -49279704, 32691467,	/* 450 */
+	27651395, 18691267, -32619466, -21489307, -6579094, -3429049, -18829269, -57189817, 35701510, 69721996,	/* 460 */
+	-67689967, -44239632, -15259218, -21769311, 50611723, 54181774, 14211203, -44099630, 21561308, 12251175,	/* 470 */
+	-15399220, -35209503, -52079744, 63141902, -26809383, -6999100, 23521336, 6091087, 19741282, 26181374,	/* 480 */
+	60901870, -58589837, -23379334, 38711553, 69511993, -23449335, 15471221, 17991257, 3011043, 23871341,	/* 490 */
+	-59569851, 6791097, -60619866, -52009743, -22189317, -20929299, -65869941, -39829569, 33181474, -13789197,	/* 500 */
+	2241032, -6509093, -9659138, 20931299, 64261918, -49559708, -50259718, -57819826, 9801140, 45711653,	/* 510 */
+	58801840, 30311433, -3219046, 63281904, -61879884, 59151845, 45011643, 34721496, 13861198, -42769611,	/* 520 */
+	63911913, 63211903, 15611223, 6651095, -41649595, 63841912, -7419106, 29541422, 55931799, -49069701,	/* 530 */
+	-52149745, -39759568, 28631409, 67271961, -67549965, -67829969, -31709453, -39689567, 39831569, -25409363,	/* 540 */
+	22541322, -64609923, -8679124, -11269161, 42001600, -19249275, -43609623, 19461278, -19809283, -59709853,	/* 550 */
+	-10499150, -38149545, 2591037, 4831069, 35211503, 35001500, 48441692, -30099430, 20511293, -40809583,	/* 560 */
+	27721396, 5391077, -4339062, 9241132, 54671781, 49491707, 12391177, 47741682, 20021286, 58031829,	/* 570 */
+	55231789, 66641952, -17569251, -55509793, 24011343, 26951385, -56419806, -64679924, 66151945, 27791397,	/* 580 */
+	-27719396, 24991357, 7701110, 65311933, -53059758, 47881684, -62509893, 50751725, -29469421, 48931699,	/* 590 */
+	-45359648, 4201060, 48091687, -60339862, -40599580, 48161688, -27929399, -58519836, -33529479, -10009143,	/* 600 */
+	-32899470, -35839512, -139002, 61881884, 51171731, -31289447, -3499050, 15961228, 16871241, 48581694,	/* 610 */
+	48231689, -38009543, -36679524, -66989957, -28139402, 11551165, 62721896, -53969771, -54879784, 12671181,	/* 620 */
+	18201260, 68321976, 32551465, 40531579, -12389177, -19039272, 16731239, 11761168, 1891027, 63001900,	/* 630 */
+	34371491, 18761268, 61531879, -46899670, -5529079, 28841412, -14489207, -54949785, 28281404, 14981214,	/* 640 */
+	5111073, 53271761, 3921056, -2939042, -52639752, 47181674, -50539722, 10221146, 33741482, -68879984,	/* 650 */
+	66221946, 55301790, 39971571, -41859598, 23241332, 65171931, 67621966, 11341162, 48371691, 1961028,	/* 660 */
+	61321876, -53619766, -4829069, 491007, 34161488, 48301690, -68459978, 41651595, -40039572, -61319876,	/* 670 */
+	8261118, -15609223, -42139602, 50121716, -42979614, 68391977, 65031929, 66921956, 57121816, -8189117,	/* 680 */
+	1401020, -69579994, -42489607, -24149345, 25481364, -1469021, 22891327, -43469621, 34021486, 47251675,	/* 690 */
+	-53409763, -5809083, -44799640, -10779154, 61671881, 8681124, -16729239, -59639852, -27299390, -48579694,	/* 700 */
+	-16519236, 29821426, 21841312, -28979414, 48021686, 43681624, -39129559, 65521936, 15891227, -7139102,	/* 710 */
+	41021586, 28771411, 68951985, 65241932, -48159688, -67479964, 61601880, 52991757, 37241532, 25271361,	/* 720 */
+	-42279604, -59219846, 36191517, 38781554, 34791497, 48651695, -20509293, -7629109, -9169131, -64329919,	/* 730 */
+	-13649195, 33111473, 21421306, -10919156, 11061158, -35559508, 44101630, 55371791, -21279304, 29401420,	/* 740 */
+	-48299690, -8469121, 20161288, 16031229, -20719296, -24009343, -6089087, -42209603, 17151245, -53479764,	/* 750 */
+	60131859, -25619366, -41999600, -69649995, -48509693, -35979514, 69021986, 69161988, 53341762, 65591937,	/* 760 */
+	11691167, -15749225, -62999900, -65169931, 38991557, 31431449, 51731739, -24079344, -27859398, -46619666,	/* 770 */
+	24081344, -49909713, 13091187, -49139702, 16941242, 69651995, 57751825, 15331219, -49419706, -30169431,	/* 780 */
+	52011743, -17289247, -27789397, -24359348, -66219946, -65099930, 57541822, -2659038, -47179674, -31639452,	/* 790 */
+	24501350, 10011143, -15329219, -59499850, -30379434, -31499450, 13301190, 31501450, 6721096, -13019186,	/* 800 */
+	-10639152, 55651795, -13509193, 55581794, 54111773, -4899070, -47109673, 40601580, 69931999, 58381834,	/* 810 */
+	-34859498, -42069601, -2869041, -32339462, -3779054, -2169031, 28071401, -30589437, 62861898, 27231389,	/* 820 */
+	-31359448, 63491907, 60411863, -50889727, 11831169, 911013, -58869841, 18901270, 43191617, -4689067,	/* 830 */
+	-18759268, 19321276, 50051715, -38569551, -21979314, 18131259, 4761068, 13931199, -1889027, 53131759,	/* 840 */
+	18271261, 3781054, -7909113, -58239832, -22469321, 17571251, -69929999, 45991657, 52151745, 39271561,	/* 850 */
+	42351605, -64889927, -28349405, -30309433, 16381234, -3989057, 5951085, 69441992, 15121216, 19811283,	/* 860 */
+	-38779554, 53831769, 1331019, -44029629, -20789297, -209003, 56561808, -63279904, -1959028, -54249775,	/* 870 */
+	-37799540, 29611423, -41929599, -9869141, -66779954, 61951885, -36259518, -45849655, -10219146, -8539122,	/* 880 */
+	12321176, 52221746, 66781954, 34301490, 24711353, -68949985, -69859998, -12319176, 19531279, -28559408,	/* 890 */
+	54391777, -53339762, 51451735, 6581094, 3151045, -45149645, -16169231, 25131359, 49771711, -38849555,	/* 900 */
+	-29889427, -47949685, -22959328, 5531079, -24499350, 36331519, -29819426, 28561408, -54179774, 26881384,	/* 910 */
+	27021386, 40461578, -32969471, -17359248, 38361548, 56351805, 46971671, -49489707, -29749425, 40951585,	/* 920 */
+	61251875, -11969171, 19251275, -12249175, 40881584, 8541122, -6369091, 59431849, 32621466, 28351405,	/* 930 */
+	43611623, -48089687, 66431949, 1000, 19951285, 35631509, 66291947, -67059958, -27369391, -53269761,	/* 940 */
+	58661838, 7561108, 9941142, 6511093, 29121416, 12041172, 59571851, 39131559, -26669381, 56701810,	/* 950 */
+	65941942, -22049315, 26251375, 43471621, 10291147, -63909913, -13859198, -14349205, 56281804, 31921456,	/* 960 */
+	-629009, -38079544, -58939842, -57329819, 65661938, -25759368, -5039072, 42631609, 37801540, 16451235,	/* 970 */
+	54461778, 7911113, -31079444, -69001, -16309233, -4409063, 64121916, -39059558, -61949885, -25829369,	/* 980 */
+	47461678, -69439992, -6719096, 35281504, 60621866, -7769111, -19879284, -56839812, 69861998, 45501650,	/* 990 */
+	16171231, -34369491, -26529379, 351005, 53761768, -54319776, 29051415, -18969271, 68531979, 36891527,	/* 1000 */
+	-9519136, 37521536, -47039672, 39201560, -57399820, 12181174, 3991057, 18061258, -52289747, 27301390,	/* 1010 */
+	-43679624, 38641552, 8961128, -29399420, 23801340, -6229089, -30449435, -17639252, 17921256, 22751325,	/* 1020 */
+	39411563, 65101930, -19389277, -35909513, -50609723, 57051815, 771011, -69019986, 46061658, -54459778,	/* 1030 */
+	4551065, -51589737, 4621066, -20299290, -979014, 16591237, -5389077, -56139802, 41371591, -48649695,	/* 1040 */
+	-34509493, 30101430, -15469221, 31991457, -8609123, -50749725, -56909813, 44171631, 29681424, 2941042,	/* 1050 */
+	-56349805, -32759468, 29891427, 60971871, -59849855, 8121116, 12951185, 15681224, 60271861, -46339662,	/* 1060 */
+	-27509393, 53551765, 23031329, 10781154, -909013, 29471421, -45779654, 7071101, 5601080, 28421406,	/* 1070 */
+	36261518, -16099230, -46689667, -45569651, -39479564, -13579194, 62791897, 21491307, 40181574, -38989557,	/* 1080 */
+	-58099830, -56699810, 46131659, -18199260, -68389977, 24641352, 18341262, -14419206, -52709753, 37381534,	/* 1090 */
+	-48439692, 33391477, -55999800, 46201660, -11339162, -7489107, 39761568, 59851855, 34441492, -28069401,	/* 1100 */
+	35841512, 66081944, 47951685, 18481264, -28699410, 63631909, -67269961, 47321676, -44309633, 46551665,	/* 1110 */
+	13651195, 38011543, 26671381, -61389877, 33951485, -28489407, -8889127, -28839412, -51029729, 19111273,	/* 1120 */
+	-52919756, -55369791, -7979114, 14701210, 64191917, -48859698, -45639652, 62371891, -60549865, 14771211,	/* 1130 */
+	-42349605, 49141702, 17081244, -4269061, 68181974, 7771111, 8401120, 53971771, 35771511, 65381934,	/* 1140 */
+	14631209, 31641452, 44661638, 4411063, -2309033, -55649795, 21141302, -21699310, 45151645, -57679824,	/* 1150 */
+	45641652, 60201860, -33109473, 10431149, -33039472, -36959528, 44241632, 40251575, 54041772, -8959128,	/* 1160 */
+	67201960, 48791697, -66709953, 2661038, -45219646, -56769811, 37591537, 49281704, -39409563, -41579594,	/* 1170 */
+	45221646, 44031629, 28141402, -34159488, -3849055, -33809483, 19041272, -61459878, -27019386, -17919256,	/* 1180 */
+	-28419406, 18621266, -33389477, -5879084, -49209703, -1049015, -47809683, 68601980, -19739282, -25899370,	/* 1190 */
+	61041872, -39969571, -57469821, 62931899, -55299790, 26531379, 12741182, -55159788, -33949485, 64541922,	/* 1200 */
+	-8819126, -44659638, 24361348, 67061958, 49701710, -26179374, -26039372, 49351705, 59501850, -14839212,	/* 1210 */
+	-54039772, 40741582, -40879584, 40391577, 21281304, -60829869, -63209903, -27579394, -44589637, 5811083,	/* 1220 */
+	24921356, 36961528, 25831369, 26601380, 68461978, 49631709, -65309933, 56841812, 30171431, 46831669,	/* 1230 */
+	23101330, 9381134, -57749825, -35419506, 41791597, -24989357, 6931099, 40671581, 56631809, 9591137,	/* 1240 */
+	-69719996, -43189617, -9729139, -2519036, -63069901, 3571051, -20649295, -3709053, 68251975, 69301990,	/* 1250 */
+	-3359048, -20859298, -18129259, -20579294, -45709653, 21631309, 23661338, -17149245, -44729639, -2589037,	/* 1260 */
+	-33879484, 50891727, -62089887, 46761668, -18269261, 27861398, -1819026, -69089987, 36121516, 30521436,	/* 1270 */
+	-26319376, 15751225, 4481064, 34231489, -37659538, 22611323, -29049415, -5319076, 15541222, -32549465,	/* 1280 */
+	-66009943, 49561708, 44381634, -15819226, 57191817, 47811683, 35561508, 18411263, -29259418, -51309733,	/* 1290 */
+	-32269461, 19391277, 67481964, 56491807, -68039972, -31219446, 34511493, 55021786, -769011, -13439192,	/* 1300 */
+	19881284, -56279804, -65589937, 6371091, 6231089, 52501750, 11131159, 26461378, 17641252, 32971471,	/* 1310 */
+	-19319276, -25269361, -8259118, -64469921, 1191017, 54531779, -20089287, 51031729, 13721196, 1681024,	/* 1320 */
+	47041672, -2029029, 50331719, 64891927, 16241232, 48511693, -61599880, -59149845, -38289547, -40739582,	/* 1330 */
+	21351305, -17079244, 5321076, 51871741, 33041472, -52359748, -46479664, 56911813, -68739982, 55721796,	/* 1340 */
+	70002000, 42071601, -37869541, 30801440, 31081444, 58241832, -16799240, -42839612, -64119916, 43961628,	/* 1350 */
+	46341662, -47249675, -52499750, 43821626, -42909613, -53899770, -25479364, -4129059, -43259618, -17989257,	/* 1360 */
+	-19949285, 52081744, 39551565, 35491507, 2521036, 40321576, -7069101, 52641752, -31429449, -65239932,	/* 1370 */
+	-57119816, -42699610, 58521836, -7839112, -30729439, -6859098, 62441892, -22679324, 64611923, 54741782,	/* 1380 */
+	-44939642, -5179074, -18409263, -11059158, -24779354, -57539822, 35981514, 30941442, -33179474, 14491207,	/* 1390 */
+	-32479464, 39621566, 66501950, 15261218, 58731839, 37101530, 59711853, 8331119, -13159188, 9101130,	/* 1400 */
+	-26599380, -4619066, -4759068, -11689167, -19669281, 5181074, 57471821, -64189917, -31849455, 50961728,	/* 1410 */
+	2871041, 3361048, 47601680, -43889627, 51241732, 68741982, 7281104, 30591437, 64401920, 4691067,	/* 1420 */
+	-53199760, 29261418, -38499550, 26741382, -12669181, 11481164, -49349705, 25061358, 58941842, -699010,	/* 1430 */
+	44731639, -43749625, 34651495, 32761468, 21071301, -23029329, -9239132, 68671981, -28769411, 42771611,	/* 1440 */
+	51661738, -61249875, -29609423, -68529979, -63839912, -5949085, -59919856, -55229789, -14909213, -3149045,	/* 1450 */
+	-20439292, -16869241, 28981414, 22471321, 29961428, -8049115, 35421506, 22121316, 56211803, -31779454,	/* 1460 */
+	43261618, -32689467, 44941642, 62161888, 57891827, -30519436, -65519936, 64821926, 37941542, -29119416,	/* 1470 */
+	38291547, 49001700, 64961928, 7491107, -46269661, -3639052, 47391677, 27931399, 26111373, 9451135,	/* 1480 */
+	64681924, 60831869, 35071501, -67969971, 20721296, 13791197, 58591837, -62019886, 4271061, 10151145,	/* 1490 */
+	-62789897, -25339362, 53621766, -12599180, -26249375, -35139502, 58871841, -10149145, 33601480, -59009843,	/* 1500 */
+	-44449635, 20091287, 67411963, 66361948, -34089487, 12881184, 59991857, -34929499, 66851955, -27649395,	/* 1510 */
+	-68809983, 20441292, -41159588, -58379834, -63419906, 25901370, 27581394, -29329419, -64819926, 67551965,	/* 1520 */
+	1261018, -11129159, 22681324, -47459678, -6019086, 62581894, 35141502, -22749325, -16029229, 32411463,	/* 1530 */
+	50541722, -45989657, -14139202, 55511793, -24849355, 25761368, -41439592, 36681524, 11901170, -4199060,	/* 1540 */
+	-24709353, -61179874, -53829769, -33249475, 53411763, -18899270, -25059358, -2379034, 42281604, 30731439,	/* 1550 */
+	52851755, 58311833, 59011843, 3221046, 25341362, -66289947, -36049515, -44379634, 35351505, 2171031,	/* 1560 */
+	47111673, 33531479, 36821526, -12739182, -56069801, -57609823, -23239332, -5109073, -69299990, 25551365,	/* 1570 */
+	-68249975, -34649495, 41511593, 56141802, 4131059, -6789097, 37661538, -39269561, 27161388, 7841112,	/* 1580 */
+	33321476, -55089787, 19671281, 39481564, 17781254, -65729939, 30451435, 5041072, 31291447, -62859898,	/* 1590 */
+	-53759768, -35699510, -59779854, 48861698, -51239732, 10501150, 51101730, 26811383, 54601780, -55859798,	/* 1600 */
+	33671481, -62929899, 51521736, 33251475, 13441192, 2731039, 60341862, 14841212, 30381434, -58799840,	/* 1610 */
+	-59289847, -34229489, 28211403, -36329519, -49629709, -14769211, -69229989, 11411163, 28911413, -50679724,	/* 1620 */
+	561008, 13371191, -68319976, -37169531, -8399120, 43891627, -10429149, 54951785, 44871641, -62299890,	/* 1630 */
+	53061758, 8051115, -54739782, 20861298, -43329619, -33319476, 41091587, -9029129, -41089587, -44169631,	/* 1640 */
+	14911213, 20581294, -63559908, 16311233, 53691767, 45081644, 1121016, -50819726, 45921656, 48721696,	/* 1650 */
+	43331619, -35629509, 22261318, 23311333, 60061858, -18059258, 15821226, -58169831, 49911713, 6021086,	/* 1660 */
+	61391877, 15401220, -67619966, -30239432, 52921756, 20651295, -56559808, -62649895, 57611823, -30659438,	/* 1670 */
+	-39549565, -37309533, 4901070, 69371991, 62021886, 32201460, -35349505, -50119716, 3431049, -9589137,	/* 1680 */
+	-22329319, 51941742, -21209303, -24289347, -35769511, -10709153, 10361148, 17011243, 65801940, 21911313,	/* 1690 */
+	12601180, -60269861, 54881784, -31569451, 38921556, 10711153, 46691667, 16801240, 7211103, 11621166,	/* 1700 */
+	-43049615, -25199360, 2381034, -32829469, -25129359, -21419306, 62511893, 23451335, -38359548, 24851355,	/* 1710 */
+	56771811, -45009643, -15189217, -10079144, 38151545, 37731539, 3291047, 50681724, -20159288, 22961328,	/* 1720 */
+	67341962, 24291347, -68109973, 7351105, -5459078, 44521636, 57331819, -9939142, -35279504, -46829669,	/* 1730 */
+	33811483, 11971171, -44869641, 7001100, -18339262, 30031429, 46621666, -47669681, -33669481, -67129959,	/* 1740 */
+	42561608, -24429349, -52429749, -68599980, -51799740, -54109773, -559008, -1329019, 10851155, -48929699,	/* 1750 */
+	-3569051, 41721596, -54599780, -29679424, 981014, -59429849, 13021186, 57961828, 43751625, 66711953,	/* 1760 */
+	-41019586, 20371291, 5741082, 47531679, -4549065, -23659338, 7141102, 17361248, 31151445, 22051315,	/* 1770 */
+	-20019286, -62159888, -43399620, -28909413, -65799940, 23591337, -4059058, 25411363, 51591737, 27091387,	/* 1780 */
+	-51449735, 31781454, 13581194, 51381734, -45079644, 60761868, 42211603, 29331419, 50471721, -27229389,	/* 1790 */
+	42491607, 9871141, 2311033, 45571651, 9311133, -50329719, -59079844, -23309333, -38919556, -5669081,	/* 1800 */
+	-16939242, -15119216, 36471521, 1471021, 64751925, 32901470, 63771911, 20301290, 40041572, -48369691,	/* 1810 */
+	63561908, -28279404, 58451835, -52219746, 43051615, 5251075, 53901770, -11549165, 31851455, -19459278,	/* 1820 */
+	-52569751, -1189017, 38571551, -49979714, -30029429, -37029529, -13299190, 24431349, -60689867, 62231889,	/* 1830 */
+	21211303, -8749125, 631009, 4971071, 17221246, -50189717, -21909313, -25549365, -28629409, 59641852,	/* 1840 */
+	40111573, -46409663, -11619166, 41441592, -6159088, -39899570, -56979814, -59989857, 9661138, -9099130,	/* 1850 */
+	42841612, 27511393, 41231589, 49211703, 55091787, 2101030, -14069201, 3711053, -12949185, 49421706,	/* 1860 */
+	-36889527, -22399320, -60759868, -11829169, -46129659, 32831469, 42141602, -50399720, -60129859, 6161088,	/* 1870 */
+	-8119116, 33881484, -62229889, -40179574, -3919056, 43541622, -30869441, -37379534, 67971971, -15889227,	/* 1880 */
+	-41299590, 14141202, -23729339, -64259918, -46969671, 49071701, -34789497, 64471921, -51169731, -61109873,	/* 1890 */
+	-12459178, -6439092, 62301890, -17499250, -14699210, 31571451, -2729039, 31221446, 9171131, 18551265,	/* 1900 */
+	-64959928, -33599480, -58029829, 10081144, 66011943, 52711753, 22821326, 281004, 22401320, 13511193,	/* 1910 */
+	2801040, -39339562, 51801740, -31009443, 64051915, -67899970, -19109273, -50049715, -52849755, -36609523,	/* 1920 */
+	-56489807, -63699910, -10849155, 12531179, 46271661, 10571151, -43119616, 40811583, 63421906, 30661438,	/* 1930 */
+	-17429249, 42981614, 69581994, -4969071, -52779754, -1119016, -20999300, 20231289, 11271161, 52781754,	/* 1940 */
+	3851055, -13089187, -36469521, -37239532, 59081844, -23589337, -17709253, -23939342, 55861798, -25969371,	/* 1950 */
+	55791797, -13929199, 71001, 32131459, 26041372, -47879684, 1821026, 44591637, -31919456, 16521236,	/* 1960 */
+	-49699710, -1749025, -419006, 52361748, -55019786, 38431549, -17779254, -36399520, -38709553, 36751525,	/* 1970 */
+	-47739682, 8191117, -5599080, -46759668, -21559308, 31361448, -26109373, -56629809, 39061558, 16661238,	/* 1980 */
+	37311533, -26459378, 22331319, 56421806, -57889827, -7559108, 4061058, -62439892, 67831969, -27999400,	/* 1990 */
+	-33739482, 23171331, 27441392, 11201160, -49839712, -24919356, 25201360, -68179974, 21771311, 32271461,	/* 2000 */
+	};
+uint16_t
+inthash(const int32_t key)
+{
+	uint16_t result;
+	static const uint16_t g[2481] = {
+	     736,    0, 1239, 1362,  289,   94,    0,  676,
+	    1026,  960, 1962, 1457,  100,    0, 1706,  589,
+	       0, 1756,    0,  598, 1562,  999,  572, 1520,
+	       0,    0, 1218, 1625,  483,    0,  854, 1393,
+	       0,    0,    0,  930, 1631,    0, 1298,    0,
+	       0, 1428,  521,    0,    0,  809,  147,    0,
+	     230, 1570, 1862,    0,  500, 1912, 1569,  769,
+	       0,  795, 1951, 1051,    0, 1191, 1265, 1909,
+	    1821,    0,  834,  712,  202,    0,  282, 1408,
+	    1696, 1496, 1441, 1152,  417, 1413, 1916,    0,
+	       0,    0, 1238,    0, 1668, 1237,  154, 1627,
+	    1601, 1694,  590,  377,  281, 1726, 1206,    0,
+	    1045,    0,  265, 1163,    0,    0,  770,    0,
+	    1820, 1066,  501,    0, 1264,  349, 1322,  810,
+	       0,    0,  192,  140,    0,  504,    0, 1949,
+	     912,  815, 1220,  666,    0, 1366, 1910, 1567,
+	     457,   63,  269,  486,  348, 1672,    0,    0,
+	    1755,  650, 1907,  296,  654, 1560, 1789,    0,
+	       0, 1652,  231,  818, 1024,   32, 1352,  860,
+	    1781,  179,  465,  988,    0, 1191,  344,  923,
+	     288, 1576, 1696, 1543,  863,    0, 1878, 1966,
+	    1504,  550,  217, 1224, 1184,    0, 1618, 1928,
+	    1372,  310, 1389,  937,  672, 1414, 1718, 1654,
+	    1276,  543,    0,  273,  882,    0,    0, 1762,
+	     653, 1613,    0,  856,  721,  318,  228,  569,
+	     416,  604,  452, 1292,    0,    0,    0,  838,
+	    1969, 1916, 1630,    0, 1912,    0,  529, 1260,
+	     607, 1038,  155, 1819, 1306,    0,  400,  832,
+	     601,   62,  572, 1647, 1881,  859,    0,    0,
+	    1636,  850,  125,    0,    0, 1220,   35, 1279,
+	    1653,  605,    0, 1835, 1707, 1943, 1074, 1860,
+	    1305,   99,  558,  823,    0,  511, 1594,  716,
+	     287,  776,  458, 1892,    0,  405,  166, 1339,
+	    1360, 1741, 1405,  355, 1933,  578, 1451,    0,
+	    1725, 1103, 1274,  901,  959,  469, 1618,  120,
+	     327, 1055,    0,    0, 1993, 1424, 1161, 1088,
+	    1303, 1322,  860,    0, 1060,  647,  650,   24,
+	     241,  237, 1576, 1627,  421, 1072, 1936,    0,
+	       0,   29,  622,    0, 1766,  759, 1455, 1873,
+	     676, 1899, 1370,    0, 1305,    0,    0,  918,
+	     381,    0,  775,  887,    0,    0,  269,  823,
+	    1004,    0,    0,  548,  319, 1962,  198,  309,
+	    1572,  116,  524, 1933, 1767,  764, 1362,    0,
+	    1843, 1752,    0,  558,    0,  952,  138, 1558,
+	     554,  788,    0, 1225,    0,    0,  316, 1154,
+	     931,  981, 1724,  765,  921, 1024,   81, 1605,
+	     812,  800,  921,  664,  824, 1584,  315, 1694,
+	     796,    0,  611, 1068, 1965,  848,  622,  269,
+	     757, 1007,  561,  844,    0, 1225, 1270, 1475,
+	    1979, 1473,    0,    0, 1578, 1035,    0,  200,
+	    1829, 1674,  849,    0, 1749,  604, 1919, 1726,
+	       0,  599, 1825,  134,  198,  426, 1877, 1875,
+	    1272, 1285, 1977, 1397,  770,  758, 1948,    0,
+	     860,    0,  434,  211, 1209,    0,  511,  717,
+	    1970,  902,  233, 1311,  260,   44,  471,    0,
+	     274, 1237, 1925, 1762, 1349,  451, 1866,    0,
+	     996,  983,  958,    0, 1492,    0,  454,    0,
+	     720,  923,  790, 1326,  805, 1974,  993,    0,
+	    1047, 1383,    0, 1993,  364,  848, 1702, 1581,
+	    1774, 1730,    0, 1412, 1432,  365, 1083,    0,
+	     942, 1563,  615, 1798, 1992, 1520, 1063, 1337,
+	     866, 1718, 1141,  840,  162, 1007,    0,  738,
+	    1569,  400,    0,  192,  252,    0,  704, 1219,
+	     769,    0, 1299, 1514,  482, 1006,    0,  184,
+	    1082, 1146,  607,    0,    0, 1944,    0,  893,
+	    1592,  178,  627,  842,  112,  815,   60,  124,
+	       0,  955, 1308,  546,  416,  792,  356,    0,
+	    1934, 1980,  658, 1376,    0, 1122,  604,  628,
+	     851,  943, 1820,  570,  707,  948, 1163, 1382,
+	     899, 1762,   39,  641,    0,  749,  277, 1407,
+	     296,  614, 1697,  932, 1802,  779,    0,  257,
+	       0,    0, 1712, 1224,  432,    0,  374,    0,
+	     171,  604,  239, 1239,    0,    0,    0,    0,
+	    1442, 1714,  297,  627,    0,    0,  982,  360,
+	    1817,    0,  107, 1555,  451,  440,    0, 1962,
+	    1764,  392, 1828,  847,  487,    0, 1627,  964,
+	    1445, 1441,    0,  306,  944, 1786, 1189, 1685,
+	     733,  291,    0,  673,  549,    0,  145, 1230,
+	    1169,  719, 1412, 1035,  340,  467,  727, 1869,
+	    1335, 1890, 1577, 1705, 1320,  100, 1853, 1851,
+	    1928,  253,  552,  579, 1065,    0,  411, 1361,
+	      80,  531, 1778,    0,  290, 1867,  559,    0,
+	    1126, 1411,  595,  284,  523, 1589,  194,    0,
+	    1844,  715, 1871,  126,  132, 1489,  110, 1810,
+	     123, 1389,  480, 1870, 1957, 1188,  548,  920,
+	       0, 1255, 1016,  663,   40,    0,  363,  983,
+	    1087, 1907,    0, 1121, 1987,   36,  811, 1993,
+	     772,  230,   71, 1634,    0, 1214,  751, 1168,
+	    1570,  367,  138,    0,  157,    0,    0,  933,
+	     194,    0, 1571, 1274, 1813,  343,  393, 1984,
+	    1823,    0,  937, 1527,   53, 1504,  104, 1540,
+	    1723,    0,  823, 1644,  603,    0,  560,  821,
+	     575,  218,    0, 1856,  126,  238, 1977,  570,
+	       0,  646, 1802,  937, 1793,  695, 1924,  985,
+	     166, 1358, 1238, 1449,  614,   74,    0,  263,
+	     395, 1444, 1696, 1078,  613,  550,  998, 1826,
+	       0,   21,  809,  755,  538,  111,  241, 1368,
+	       0, 1034,  639,  904,    0, 1687, 1807,  569,
+	    1360,  986, 1060,   52, 1261,  818, 1914,    0,
+	    1940, 1717,  823,    0,    0,  873, 1105, 1043,
+	    1944,    0, 1054, 1196,  131, 1932,    4, 1779,
+	     771,    0,  983,  253, 1637, 1298,    0,  446,
+	    1889,  670,  108,  275,  740,  989, 1326,  168,
+	       0, 1670, 1076,  742, 1878,    0,  787,  837,
+	    1734,    0,  971,  968, 1782, 1601,    0,  910,
+	     269, 1533,  507,    0, 1123, 1617, 1766, 1470,
+	     838,  966,  294,  763, 1753, 1672,  999, 1293,
+	    1177,    0, 1882,  503,    0, 1942,    0,    0,
+	    1692,  403,  286,    0, 1890,    0,  172,    0,
+	    1615,    0,  245,  951, 1660,  734,    0, 1227,
+	       0,  639, 1489, 1083,  678, 1703,    0,  331,
+	      58, 1396,    0, 1184,   66, 1605, 1640, 1309,
+	    1629,  943,  647,    0, 1927,  898, 1731,    0,
+	     569,  266, 1686,  467, 1847,  206, 1132, 1029,
+	    1267, 1788, 1875, 1808, 1959,    0,   88, 1567,
+	       0, 1892, 1893, 1307,  793,  369,  788,    0,
+	     182,    0,  194,  215,    0, 1864, 1561,  885,
+	    1133,    0,  830, 1625, 1802,    0,    0,    0,
+	     811,    0,  648,    0,  123, 1830, 1175, 1477,
+	     569, 1432,    0, 1438, 1575, 1513, 1042, 1320,
+	    1062, 1309,  713, 1667,  396,    0, 1917,  556,
+	    1179,    0,  136, 1824,  322,    0,  195,  687,
+	     656,    0, 1017,  661,  992,  559, 1126, 1951,
+	    1232, 1309,  795,  952,  163, 1853, 1933, 1129,
+	    1376,  494, 1869,  784,  480,  896, 1882, 1847,
+	     737,    0, 1608,  258,  895,  540,  914,    0,
+	      30,  370, 1723, 1524, 1608,  688,  848, 1331,
+	    1366, 1061, 1938, 1442,    0,  444,  941, 1302,
+	     669,  450,    0,    0,  814, 1590, 1960,  899,
+	    1362, 1693, 1751,  316,    0, 1324, 1454,  203,
+	     987,    0,  781,    0,  281,  307, 1451, 1570,
+	    1364,    0,    0, 1343, 1735,  162, 1339,  448,
+	    1242, 1852,  351, 1119, 1777, 1167,  437,    0,
+	     230,  123, 1785, 1905,  188,  941,   23, 1732,
+	     383,  256,  120,   64, 1509,  535, 1315, 1481,
+	    1796, 1937,    0,    0,    0, 1284,  884, 1918,
+	     176,  655, 1694,  807,  390,  765, 1815,  184,
+	    1380, 1808,  980, 1550,    6, 1677,  147, 1507,
+	       0,   93,    0, 1136,  265,    0,    0, 1379,
+	       0,  552,  984,  300, 1901, 1785,   72,  674,
+	      36,    0,   32, 1328, 1643,  901,    0,  140,
+	    1873,    0,  117,  764, 1149,  310,  735,  925,
+	    1957,  312,  711, 1426, 1965,    0,   20,  366,
+	     562, 1383,  526,  445,  949,  706,  483,  271,
+	     545,  822, 1531, 1112, 1307,  405, 1830,  777,
+	       0,    0, 1019,  380,  487, 1123, 1727,    0,
+	       0, 1182,    0,  134,  927,  180,  248, 1147,
+	    1620,  547,  671,  867, 1622, 1792,    0,    0,
+	       0,   64, 1258, 1282, 1210, 1752,    0,    0,
+	    1971,  402,   47, 1475,    0,  229,    0,    0,
+	       0,    0, 1630, 1440,    0,  274, 1569, 1532,
+	     404, 1191, 1032,  404,  841,   81, 1345,  834,
+	     885,  743,  779,  603, 1025, 1103,  895, 1041,
+	     626, 1306, 1485, 1525,  434, 1621, 1139, 1512,
+	    1341, 1360,  578, 1167, 1418,  208,   48, 1053,
+	     804, 1814,    0,  741,    0, 1317, 1828, 1286,
+	    1329,  484,  398, 1256,  265, 1226, 1953,  122,
+	    1845,  792, 1444, 1196,    0,  193,  478, 1427,
+	     963, 1889, 1592, 1117,  540,  347,  747,  190,
+	     502, 1536, 1075,  937,    0,  196,   82,  624,
+	    1153, 1260,  534,    0,    0,    0,  326,  698,
+	     559,   26, 1962, 1950,  487,    0,    0, 1873,
+	    1344,  617, 1786, 1480,    0,    0, 1032, 1244,
+	     581, 1152,  925, 1913, 1270,  569, 1459, 1289,
+	    1427, 1454,  674, 1392,  103, 1340, 1982,   20,
+	       0, 1937, 1549, 1753,    0,  628, 1673,  128,
+	     493, 1303,  426,    0,    0,  495,  387,  749,
+	    1988, 1652,   40,  702,    0, 1190,   59,    0,
+	     970,  132, 1662,    0, 1244, 1748, 1720,  554,
+	    1916, 1785,  582,  504,  730, 1308,    0,  100,
+	    1195,  857,  377, 1109,    0,    0,  378, 1753,
+	     202,  670,  124,  255,    0,  376, 1406, 1212,
+	    1169,  642, 1237, 1347,    0,    0,  465,  293,
+	       0,   94, 1563, 1383,    0,   63,  433, 1222,
+	     330, 1065,  193,    0,  903,  882,  478,  342,
+	     285,  513, 1296,  371,  872, 1210,    0,  829,
+	     631,  104,  435,  488, 1337, 1389,    0,   69,
+	      66,    0,  503,    0, 1875,    0,  911, 1904,
+	     503,    0,  708,  532, 1353,  755, 1410,  461,
+	    1023,  496,    0,    0,   36, 1641,    0, 1322,
+	       0, 1834,    0,    0,  851, 1940,  764, 1550,
+	    1639,  642, 1066,  236, 1492,    9,  228, 1688,
+	     742,  500,    0, 1851,    0, 1741, 1070, 1912,
+	       0,    0,  103,   20,  726, 1727,  172, 1070,
+	    1057, 1818,  142, 1515, 1293,  283, 1969, 1447,
+	    1069, 1492,    0,    0,  650, 1303,  503,  270,
+	    1934, 1584,  153, 1161, 1398,    0,    0, 1384,
+	    1362,    0,  473, 1952,  777,   15, 1120,  894,
+	       0,  187,    0, 1409, 1786,  889, 1358,    0,
+	     322,  445,   99, 1029,  642, 1149, 1136,    0,
+	    1588,  702, 1344,  139,  675,  506,    0,  519,
+	       0,  380,  888, 1653, 1711, 1415,    0,    0,
+	    1925, 1252,    0, 1158,   10,  444, 1533,  779,
+	    1771, 1252, 1606,  133,  250, 1118,  496,  101,
+	     951, 1439, 1368,   38,  695, 1507, 1129, 1235,
+	    1780,    0,  678,  416,    0,  193,  714, 1678,
+	    1693,  320, 1369,  123,  415,    0, 1620, 1608,
+	       0,  367, 1574, 1320, 1988,  293,    0,    0,
+	     222, 1635,    0,  310,  669,  718,  452, 1036,
+	    1659, 1900,    0,  942, 1811, 1388, 1254,  537,
+	       0,  697,  128, 1813, 1579,    0,    0,  726,
+	       0, 1299,    0, 1318,  479,    0, 1464, 1338,
+	     358,    0,    0,    0,    0,    0,   24,  254,
+	     749,    0,  342, 1188,    0,    0,  612,  557,
+	       0,  465, 1804,  407, 1743,   11,  766,  501,
+	    1160, 1399,  635, 1138,  350,    0,  746,    0,
+	    1058,  186, 1782,  534,  727, 1546,    0,  941,
+	    1669,  486,    0, 1650,  198,  525,    0,  502,
+	     979, 1063, 1823,  367, 1075,    0, 1761,  932,
+	     212,    0,  566,    0, 1920,    0, 1537,  687,
+	     740, 1912,  759, 1579,  637, 1434, 1776, 1272,
+	     599,  775, 1857, 1590,  533,  823,  431,    0,
+	      81,    0,  930,    0,    0,   32,   82, 1209,
+	     319,    0,  243,  279,  372,  170,   83,  446,
+	    1276, 1188, 1042, 1408,    0,  355,  419, 1147,
+	     869,  722,    0, 1277, 1146,  258,    0,  274,
+	     520,  251,    0, 1845,    0, 1075, 1116,  417,
+	    1807, 1946,    0,  680, 1989,  588, 1550,   52,
+	     320,  540,    0,    0, 1319, 1877,  602, 1180,
+	    1146,  488,  257,    0,  364,  179, 1045, 1818,
+	    1328,    0,    0,    0,  673, 1017, 1259,    0,
+	    1769,  172,    0,  909,  302, 1305,  840,  987,
+	    1131,  593, 1101,  983, 1782,  106,  752, 1686,
+	     565,    0,  315,  230, 1159,  258, 1497,  503,
+	    1651, 1914,    0,  743,  564,    0,  655, 1251,
+	       0,  140,    0, 1607,   11,  645, 1033, 1046,
+	       0,    0,  985, 1445,    0, 1248, 1747,  478,
+	    1906, 1581,  925, 1668,    0,    4, 1040,  750,
+	     181,    0, 1416,  729, 1495,    0,    0,  394,
+	    1483,    0,    0,  183, 1095,  290, 1596,  604,
+	       0,    0,  775,  155,  656, 1076, 1113, 1906,
+	     663,  852,  481,  634,  504,  444, 1758, 1436,
+	    1345,  842,  199, 1745, 1397, 1268,    0, 1049,
+	       0, 1768,    0,  869, 1749,  923,    0, 1607,
+	       0,  640,  697,    0,  188,  611, 1874,  823,
+	     832, 1188, 1350,  981,  429, 1951, 1508, 1181,
+	    1046, 1408,  380,    0,   73, 1949,  977, 1079,
+	       0,    0, 1813,  305, 1991,    0,  810,    0,
+	    1355,  437,  751, 1001,  381,  470,    0,    0,
+	    1175,  313, 1829, 1731, 1212, 1062, 1197, 1227,
+	    1201,  516, 1492,  455,    0, 1841,  713,    0,
+	    1056, 1566, 1978,  731,    0, 1159,  434, 1935,
+	    1515, 1199,  491,    0,    0,  650,    0, 1837,
+	     900, 1185,  298,  647,  591,    0,  809,    0,
+	    1667,  510, 1171,  837, 1779, 1793,  800,    0,
+	      81, 1319,  644, 1651,   45, 1227, 1181, 1174,
+	     642, 1219,  303,   65, 1619, 1653,  228,  522,
+	       0,  171, 1633,    0, 1198,    0,    0,   25,
+	     240,  619, 1319, 1514, 1295, 1024, 1715,    0,
+	    1687,    0,    0, 1043, 1365,    0,    0,  188,
+	    1515, 1003,  630,  372,    0,  760,    0, 1053,
+	     767, 1614, 1801,  673, 1653,  887,  500,  974,
+	     891,    0,  725, 1437,    0,   75, 1283,   80,
+	    1262,  580, 1184,    0,  567, 1432, 1414, 1854,
+	     743,  813,  299, 1834, 1943,    0,    0, 1257,
+	     688,  790,  314,    0,  524,    0,  459,  719,
+	    1167,  128, 1849,    0,  119,    0, 1641,  429,
+	    1725,    0, 1023,  699, 1609,  679,   39,  566,
+	     920,   39, 1693,  125,  805,  322, 1961,    0,
+	    1313,  809,    0,    0,    0, 1814, 1056,    0,
+	     811, 1232, 1467, 1009, 1556,    0, 1495,   48,
+	     481, 1957,    0,  519,   14, 1630,   53,    0,
+	     472, 1263,   31,  953,    0, 1366,  846, 1647,
+	     871, 1439,  346,    0, 1653, 1790, 1574,    0,
+	     909,  971,  123,    0,    0, 1977, 1293,  562,
+	    1170, 1343, 1708,    0, 1500, 1344, 1140, 1360,
+	    1107,    0,   93, 1361, 1331,  175, 1047, 1622,
+	     632, 1687,    0, 1049,  335, 1000,    0,  676,
+	       0,  201,  600,    0, 1164, 1061, 1834,  145,
+	       0,  900,  708,    0,  983, 1911, 1860,    0,
+	    1137, 1733, 1246, 1784,  326,  874, 1505, 1691,
+	     668,    0, 1163,    0,  710,  538, 1627,  477,
+	    1440,    0, 1919,    0,  799,    0,  825,    0,
+	     356,  759, 1692, 1614,  693, 1988, 1893, 1314,
+	       0,    0,    0, 1872,  301, 1157,  755, 1203,
+	     130,    0, 1159, 1124,    0,   63,    0, 1538,
+	       0,  709, 1651, 1336, 1734, 1962,  978,  980,
+	     538, 1146,  460,  810,  990,    0,  509,    0,
+	    1538,    0, 1797,  544,  855,  670, 1593, 1711,
+	    1709, 1992,    0,  420,  892,    0,  346,  431,
+	    1255,  426, 1097,  489,  950,    0, 1801,  346,
+	    1906, 1061, 1799, 1180,  631, 1748,   72,    0,
+	       0, 1174, 1135, 1776,  330,    0, 1287,  407,
+	     282,    0,    0,  664,    0,  652, 1347,  135,
+	       0,  825,  276,   91, 1684,  501, 1922,    0,
+	       0,  192,   73, 1415, 1323, 1156, 1489, 1302,
+	    1735, 1918,  469,  754, 1014,  851,  739,  175,
+	       0,  579,  310,  151, 1914,  414,    0, 1084,
+	     769,  396, 1782, 1233, 1784,  741, 1819,    0,
+	    1308,  285, 1786,  455,  620,    0,    0, 1153,
+	    1508, 1927,  485,  774,  842,    0,  355,    0,
+	    1798, 1068,  620, 1554,  452, 1951,  284,  882,
+	    1350, 1219, 1891, 1029, 1447,  463, 1906, 1451,
+	    1012,  221,    0,  379, 1787,    0,  231,  877,
+	     403, 1330,  913,    0, 1037,    0, 1900,    0,
+	    1513, 1144,  903,  128,    0,  146, 1293,    0,
+	     895, 1807, 1132, 1338,    0, 1116,  577, 1521,
+	    1880,  190, 1671,  997,  475, 1689,    0, 1922,
+	    1585, 1677,    0,  601, 1064,    0, 1368,  945,
+	    1233,  307,  932, 1860, 1491,    0, 1703, 1809,
+	       7,    0, 1754, 1380,  177, 1230,    0, 1873,
+	       0, 1737,    0,  576,    0,    0, 1115,  731,
+	     469, 1662,  967, 1834,  497,   15,  299,  195,
+	    1010,    0, 1419, 1964,  271,  620,  800, 1281,
+	    1601, 1978,    0,    0,  332,  562, 1431, 1212,
+	     684, 1629, 1237, 1176,    0,  794,  471, 1758,
+	    1481,  984, 1731,    0,    0,  972,  356, 1560,
+	    1592, 1735, 1006,    0, 1140, 1096, 1233, 1143,
+	    1721,  140,  589,    0,    0, 1221, 1462,  881,
+	    1803, 1170,  202,  302, 1462, 1162,  640, 1994,
+	      80,
+	};
+	uint16_t h[8];
+
+	_inthash4(key, (uint64_t*)h);
+
+	h[0] = h[0] % 2481;
+	h[1] = h[1] % 2481;
+	h[2] = h[2] % 2481;
+	result = (g[h[0]] + g[h[1]] + g[h[2]]) % 2000;
+	return (inthash_keys[result] == key) ? result : (uint16_t)-1;
+}
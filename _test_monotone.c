@@ -0,0 +1,2794 @@
+/* generated with rurban/nbperf 08a5797  _words_sorted */
+/* seed[0]: 1726956429, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+
+#ifndef NBPERF_GETBITS
+#define NBPERF_GETBITS
+static inline uint32_t _getbits(const uint8_t *g, uint64_t i, const unsigned bits)
+{
+	uint64_t x;
+	const uint64_t bit = i * bits;
+	memcpy(&x, g + (bit >> 3), sizeof(x));
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	x = __builtin_bswap64(x);
+#endif
+	return (uint32_t)((x >> (bit & 7)) & ((UINT64_C(1) << bits) - 1));
+}
+#endif
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	static const uint8_t g[21708] = {
+	     0x97, 0x24, 0x60, 0x2a, 0x38, 0xc1, 0x72, 0x4b, 0x35, 0x16,
+	     0xc0, 0x30, 0xda, 0x58, 0xcc, 0x26, 0x80, 0x12, 0x0a, 0x9a,
+	     0x45, 0x80, 0x77, 0xb8, 0x44, 0x03, 0x20, 0x72, 0x00, 0xc0,
+	     0xef, 0xdd, 0x00, 0x00, 0x62, 0x8b, 0x04, 0x00, 0xfd, 0xa4,
+	     0x59, 0x71, 0x6e, 0xd7, 0xd7, 0xfa, 0x8a, 0x42, 0x93, 0xf0,
+	     0xa8, 0x3b, 0x00, 0x78, 0xc1, 0xe8, 0x3d, 0x91, 0x1f, 0x90,
+	     0x84, 0x01, 0xf6, 0x14, 0x37, 0xa0, 0xcc, 0x89, 0x83, 0x89,
+	     0x08, 0xb0, 0x98, 0x22, 0xe0, 0xf5, 0x07, 0x09, 0x7e, 0x28,
+	     0x14, 0x72, 0xcd, 0xaf, 0x7d, 0xf8, 0x73, 0xa6, 0x22, 0x87,
+	     0xe3, 0x59, 0x00, 0xfa, 0x21, 0xb1, 0x00, 0x00, 0x80, 0x09,
+	     0x26, 0x6e, 0x53, 0xc5, 0x51, 0x48, 0x00, 0x7b, 0x07, 0x90,
+	     0xf9, 0x26, 0xe6, 0x37, 0x9c, 0x97, 0x3b, 0x83, 0xf4, 0x1c,
+	     0xc0, 0x1b, 0xc7, 0x9c, 0xb4, 0x01, 0xe5, 0x3f, 0xc8, 0xde,
+	     0x03, 0xb8, 0x67, 0x4c, 0x53, 0x31, 0x2c, 0xa0, 0x70, 0xa4,
+	     0x00, 0xb5, 0x75, 0x03, 0x48, 0x86, 0x76, 0x3e, 0x00, 0x40,
+	     0x02, 0x54, 0xc5, 0xb2, 0x1f, 0x40, 0x05, 0x00, 0xe0, 0x90,
+	     0x01, 0x00, 0x10, 0x40, 0x06, 0x58, 0x23, 0x9f, 0xac, 0xf8,
+	     0x58, 0xbc, 0x1f, 0xe5, 0x2a, 0x79, 0x40, 0x35, 0x7f, 0x01,
+	     0x00, 0xbe, 0x6c, 0x40, 0x5e, 0x79, 0x46, 0x03, 0x00, 0x05,
+	     0x40, 0xc9, 0x22, 0x4e, 0xc8, 0x00, 0x00, 0x6e, 0x0c, 0x70,
+	     0x19, 0x2c, 0xa3, 0x00, 0x13, 0x98, 0xb0, 0x50, 0x84, 0x01,
+	     0xcd, 0xd7, 0x5b, 0x82, 0x53, 0x00, 0x00, 0x80, 0x14, 0x76,
+	     0x0e, 0xc0, 0x4c, 0x0c, 0x00, 0x93, 0x21, 0x94, 0xcd, 0xb7,
+	     0xf1, 0x59, 0x40, 0x4a, 0x58, 0x9a, 0x03, 0xfc, 0x7e, 0x6e,
+	     0xce, 0x72, 0x26, 0xac, 0xd9, 0x80, 0x1f, 0x10, 0x32, 0xce,
+	     0x8d, 0x07, 0x7b, 0x40, 0xcb, 0xbb, 0x05, 0x9c, 0xb7, 0xe7,
+	     0x03, 0x00, 0x1e, 0x04, 0x24, 0xfd, 0xc5, 0x49, 0xed, 0xef,
+	     0x5a, 0xc5, 0x5c, 0x81, 0xc7, 0xb1, 0x7d, 0x01, 0x3c, 0x8f,
+	     0x58, 0xc5, 0x9f, 0x7d, 0xe5, 0x17, 0x46, 0x2e, 0x87, 0x55,
+	     0xbd, 0x2d, 0x65, 0x28, 0x00, 0x80, 0x92, 0x75, 0x48, 0x2a,
+	     0x39, 0x6f, 0x1e, 0xa0, 0x0e, 0x90, 0xee, 0x1e, 0x69, 0xe8,
+	     0x88, 0x4a, 0x00, 0xec, 0x78, 0xe4, 0xa5, 0x8d, 0x6b, 0xbd,
+	     0x03, 0x34, 0x00, 0x8c, 0x3e, 0x09, 0x28, 0xfc, 0x3e, 0x62,
+	     0x10, 0xa0, 0x12, 0x22, 0xb3, 0x29, 0x00, 0xce, 0x30, 0xd8,
+	     0x80, 0x13, 0x98, 0x7f, 0x80, 0x0f, 0x0d, 0x00, 0xac, 0xfd,
+	     0x52, 0x79, 0x3f, 0xd7, 0x8d, 0xde, 0x16, 0x80, 0xe5, 0x37,
+	     0xb1, 0x45, 0x03, 0xf6, 0xf9, 0xbe, 0xea, 0xff, 0x01, 0x72,
+	     0x68, 0x80, 0x99, 0x11, 0xc0, 0x00, 0xdc, 0xc8, 0xaf, 0xd6,
+	     0x59, 0x00, 0xf8, 0x57, 0x56, 0x58, 0xff, 0xdb, 0x91, 0x93,
+	     0xa7, 0xdb, 0xdf, 0xbc, 0xf3, 0x03, 0xd8, 0x9b, 0xb4, 0x00,
+	     0xf4, 0x99, 0xfa, 0x03, 0x94, 0x4e, 0x80, 0xa1, 0x17, 0x20,
+	     0xdc, 0x11, 0xa8, 0x2f, 0xc0, 0xbd, 0x82, 0xce, 0xec, 0x62,
+	     0xb1, 0xd4, 0xdc, 0x3d, 0xb7, 0x4c, 0x79, 0xb5, 0x3f, 0x66,
+	     0xd9, 0x07, 0xf0, 0x1a, 0xed, 0x79, 0xfb, 0x14, 0xef, 0x18,
+	     0x01, 0x5a, 0x06, 0x60, 0x0e, 0x60, 0xfa, 0x55, 0xbb, 0x3b,
+	     0xe9, 0xa3, 0x93, 0x02, 0x00, 0x13, 0xfc, 0x7c, 0x76, 0xea,
+	     0xd8, 0xa8, 0x49, 0xfd, 0x05, 0xbc, 0x14, 0x7b, 0xef, 0xcb,
+	     0x65, 0x09, 0xf8, 0x5e, 0x47, 0x00, 0x56, 0xe8, 0x56, 0xc5,
+	     0x1c, 0x1a, 0xe5, 0x9e, 0x03, 0x78, 0x57, 0xa5, 0x03, 0xf0,
+	     0xca, 0x10, 0x60, 0x0f, 0x38, 0xb9, 0x0c, 0x88, 0xba, 0x34,
+	     0x56, 0xdd, 0x03, 0x00, 0x04, 0x38, 0xfb, 0x93, 0x03, 0x04,
+	     0x57, 0x00, 0x00, 0x09, 0x6f, 0x6f, 0xd5, 0x1c, 0x00, 0x9d,
+	     0x85, 0x63, 0xeb, 0x03, 0x92, 0x5d, 0x2c, 0x08, 0x4e, 0x04,
+	     0x00, 0x00, 0x67, 0xc0, 0x1e, 0x70, 0xd8, 0x1e, 0x78, 0xb1,
+	     0x0a, 0x60, 0x0a, 0x78, 0x37, 0xa8, 0x00, 0x40, 0x24, 0x1d,
+	     0xcd, 0x02, 0x3e, 0xc7, 0x42, 0x77, 0x01, 0x00, 0xdc, 0x14,
+	     0xd1, 0x4c, 0x68, 0xcc, 0x96, 0xdb, 0x51, 0x00, 0x68, 0x71,
+	     0xef, 0x00, 0x40, 0x57, 0x80, 0xb6, 0x11, 0xc0, 0xdc, 0x14,
+	     0xa7, 0x80, 0x21, 0x80, 0x89, 0x34, 0xc6, 0x70, 0xf2, 0x34,
+	     0x20, 0x44, 0x96, 0x6f, 0x79, 0x00, 0x9c, 0x14, 0xb0, 0x1d,
+	     0x00, 0x4d, 0x84, 0xbe, 0x1e, 0x00, 0xd0, 0x0e, 0x3e, 0x9d,
+	     0xbf, 0xbc, 0x6f, 0x26, 0x01, 0xe8, 0x43, 0xc0, 0x14, 0xbb,
+	     0x1f, 0x88, 0xfd, 0x3f, 0x71, 0x0e, 0x53, 0x86, 0x97, 0x01,
+	     0xd7, 0x13, 0x80, 0xfa, 0xcd, 0x98, 0x3f, 0x00, 0x3b, 0x00,
+	     0x10, 0x53, 0xf8, 0x01, 0x85, 0x23, 0x88, 0x77, 0xcb, 0x69,
+	     0x01, 0x9e, 0xc3, 0x27, 0x95, 0xa3, 0x33, 0x3b, 0xb7, 0x2f,
+	     0x54, 0xd1, 0xaf, 0x53, 0x5c, 0x00, 0x9c, 0x17, 0x40, 0x90,
+	     0x14, 0x00, 0xf5, 0xf8, 0xe1, 0xb3, 0x9b, 0x94, 0x01, 0x46,
+	     0x00, 0x05, 0x40, 0x06, 0x6c, 0xdf, 0x94, 0xe9, 0xb2, 0xae,
+	     0x04, 0x91, 0x6f, 0x00, 0x27, 0x20, 0x62, 0x40, 0x76, 0x00,
+	     0x71, 0xe3, 0x6d, 0xef, 0xeb, 0xd0, 0xc5, 0x6a, 0xbe, 0x93,
+	     0xb9, 0xa7, 0xd1, 0xf3, 0x11, 0x67, 0x3c, 0x15, 0xcc, 0xff,
+	     0x7d, 0x4f, 0x3c, 0x27, 0x20, 0x1f, 0xe7, 0xeb, 0x15, 0xc4,
+	     0x1c, 0x70, 0xc3, 0x32, 0x69, 0x6e, 0xde, 0xfe, 0xc8, 0xcd,
+	     0x0a, 0x01, 0x52, 0x00, 0x80, 0x67, 0xbb, 0xaa, 0x8b, 0x2b,
+	     0xc7, 0x05, 0xb1, 0x2e, 0x10, 0x46, 0xb2, 0x86, 0x0f, 0x70,
+	     0x01, 0xe4, 0x70, 0x34, 0x3c, 0x00, 0x69, 0x1a, 0x38, 0xa9,
+	     0x2e, 0x6f, 0x2d, 0x8a, 0x05, 0x15, 0x2c, 0x62, 0x28, 0xc4,
+	     0x02, 0x30, 0x00, 0x72, 0x2e, 0x6a, 0xfe, 0xbf, 0x6d, 0x7b,
+	     0x00, 0x00, 0x1f, 0x00, 0x15, 0xc9, 0x90, 0x30, 0x46, 0x3e,
+	     0x40, 0x9c, 0xea, 0x00, 0xbc, 0x00, 0x6c, 0x1a, 0xe9, 0x29,
+	     0xeb, 0x00, 0xcc, 0x93, 0x0e, 0xe8, 0xd9, 0x9c, 0xda, 0x2c,
+	     0xc0, 0xf8, 0x12, 0x65, 0xdb, 0x3b, 0x3c, 0x00, 0x80, 0x7a,
+	     0xd5, 0x03, 0x1c, 0xe0, 0xfc, 0x0e, 0x03, 0x08, 0x1b, 0xb8,
+	     0x00, 0x00, 0x00, 0xb0, 0x3d, 0xb9, 0x21, 0x88, 0xff, 0xa8,
+	     0x01, 0x00, 0xd0, 0x09, 0x56, 0x09, 0x60, 0x0b, 0x00, 0x0c,
+	     0x9c, 0x3b, 0x2e, 0xcb, 0x0f, 0x40, 0x02, 0x00, 0x98, 0xed,
+	     0xb7, 0xd9, 0x4d, 0x80, 0x4d, 0xcd, 0xb9, 0xab, 0x09, 0x10,
+	     0x14, 0x01, 0xd8, 0x03, 0x0e, 0xd0, 0x05, 0x68, 0x08, 0x9a,
+	     0x5e, 0x37, 0x8f, 0xb3, 0x89, 0x6f, 0x00, 0x6d, 0x40, 0x93,
+	     0x6f, 0x13, 0xcd, 0x6a, 0x32, 0x00, 0x40, 0xb7, 0x58, 0x23,
+	     0x80, 0x58, 0x59, 0x8d, 0x59, 0x03, 0xa0, 0x60, 0x00, 0x1b,
+	     0x20, 0xc8, 0xfd, 0xe3, 0x53, 0x8a, 0xd1, 0x02, 0xa0, 0xa8,
+	     0x01, 0x34, 0x6c, 0x2a, 0x9f, 0x2c, 0x02, 0x3e, 0x52, 0x05,
+	     0xc0, 0x0f, 0x18, 0x85, 0x00, 0x4b, 0x8c, 0x4f, 0x44, 0x41,
+	     0xbc, 0x67, 0x00, 0x82, 0xa5, 0xb3, 0x47, 0x21, 0x78, 0x48,
+	     0xc0, 0x67, 0x08, 0x3a, 0x63, 0x3b, 0x8f, 0x17, 0x3f, 0x22,
+	     0x43, 0xdf, 0x21, 0x2b, 0xff, 0x14, 0xb0, 0x63, 0xb0, 0xa0,
+	     0x02, 0x0b, 0x10, 0xb0, 0xc2, 0xd3, 0x52, 0xbd, 0xe9, 0x1d,
+	     0x0d, 0xa8, 0x83, 0x6f, 0xa3, 0x77, 0x1d, 0x10, 0xe9, 0x37,
+	     0xc8, 0x3f, 0xdf, 0x20, 0xcd, 0xe0, 0xba, 0x35, 0xad, 0x73,
+	     0x37, 0xcb, 0x04, 0x20, 0x76, 0x80, 0x92, 0x93, 0x5e, 0x9d,
+	     0x35, 0xec, 0xdc, 0x40, 0xe4, 0x8c, 0xc4, 0x00, 0x0e, 0xdd,
+	     0x88, 0x14, 0xb0, 0x9e, 0x02, 0x5e, 0x7d, 0xd0, 0xbd, 0x38,
+	     0xd2, 0x1a, 0x01, 0x01, 0x00, 0xad, 0x6b, 0x01, 0xbc, 0x00,
+	     0xe1, 0x2e, 0x20, 0xcd, 0xb5, 0xf9, 0x01, 0xd8, 0x58, 0xfe,
+	     0xcf, 0xdb, 0x88, 0x33, 0x2b, 0x5d, 0x5f, 0xcd, 0x77, 0xdf,
+	     0x41, 0x14, 0x00, 0x12, 0xf0, 0x95, 0x36, 0x4c, 0xaf, 0x1c,
+	     0xcd, 0x3a, 0x54, 0xc8, 0x8b, 0x65, 0x40, 0xb4, 0x71, 0xce,
+	     0xcc, 0x18, 0x00, 0x6b, 0xa2, 0xa3, 0x99, 0x0d, 0x91, 0x92,
+	     0x0f, 0x45, 0x5b, 0xd6, 0x00, 0x72, 0x28, 0xc6, 0x95, 0x2a,
+	     0xfc, 0x99, 0xa8, 0x62, 0xe1, 0x45, 0x9f, 0xf3, 0x24, 0x56,
+	     0x6d, 0x48, 0xae, 0x1a, 0x31, 0x47, 0xe6, 0x4b, 0x00, 0xac,
+	     0x07, 0xf0, 0x41, 0xfe, 0x24, 0x40, 0xee, 0xcf, 0xa9, 0x27,
+	     0x7f, 0x80, 0x59, 0x8c, 0x06, 0x20, 0x0e, 0x01, 0x80, 0x37,
+	     0xc2, 0x5d, 0x75, 0xc6, 0x17, 0x80, 0x26, 0x11, 0xd0, 0xe3,
+	     0xd5, 0x01, 0x4f, 0x00, 0x19, 0x90, 0x02, 0x00, 0xa0, 0xa8,
+	     0x12, 0x66, 0xfd, 0x0d, 0x2e, 0x64, 0xb2, 0xbc, 0x10, 0x0d,
+	     0xee, 0xa5, 0xea, 0x5b, 0xa4, 0x78, 0xd9, 0x02, 0x00, 0x00,
+	     0x02, 0x8f, 0x38, 0x31, 0xc5, 0xf2, 0xd0, 0x00, 0x80, 0x50,
+	     0x89, 0xc1, 0x73, 0x3c, 0xac, 0x3e, 0xe0, 0xb7, 0xb6, 0x5d,
+	     0x76, 0xdf, 0xb8, 0xf7, 0x01, 0x50, 0x02, 0x00, 0x7a, 0xb9,
+	     0x5a, 0x3b, 0xd0, 0xd2, 0xaa, 0xc4, 0x5a, 0x6d, 0x5f, 0xbf,
+	     0x45, 0xdc, 0x15, 0xae, 0xe3, 0x7e, 0xe2, 0x72, 0x5c, 0x83,
+	     0xc0, 0x32, 0x54, 0xbf, 0x00, 0x3a, 0x5b, 0x8c, 0xc7, 0xa4,
+	     0x7a, 0x03, 0x00, 0x62, 0x40, 0x60, 0x0a, 0x18, 0xb8, 0x26,
+	     0x77, 0x8e, 0x0a, 0xff, 0x02, 0x40, 0xb4, 0xbe, 0x74, 0xae,
+	     0xa3, 0x01, 0x00, 0x66, 0xd9, 0x6c, 0xab, 0xdb, 0xe4, 0x02,
+	     0x44, 0x79, 0xc7, 0x99, 0x8a, 0x00, 0xa8, 0xe5, 0xbb, 0xeb,
+	     0x02, 0xd0, 0x05, 0xfc, 0x5e, 0x4c, 0x11, 0x40, 0xec, 0x69,
+	     0x01, 0x40, 0x96, 0x94, 0xfd, 0xb1, 0x02, 0xac, 0x82, 0x00,
+	     0x40, 0xa6, 0x4c, 0x05, 0x00, 0xae, 0x3b, 0xc0, 0xc1, 0x08,
+	     0x00, 0xb4, 0x4b, 0x9e, 0x96, 0xf0, 0xf5, 0x1b, 0xa6, 0x64,
+	     0x08, 0x18, 0xe1, 0x5d, 0x09, 0xc2, 0x9d, 0x5b, 0x2d, 0x12,
+	     0x34, 0xa8, 0x35, 0x21, 0x04, 0x80, 0x38, 0xc6, 0xa0, 0x3a,
+	     0x0e, 0xa0, 0xf2, 0x5d, 0x0b, 0x00, 0x00, 0x8c, 0x00, 0x98,
+	     0x1a, 0x80, 0xf5, 0x02, 0xaa, 0x80, 0x39, 0xa0, 0x8a, 0x01,
+	     0x2c, 0x01, 0x9c, 0xb5, 0x0b, 0x66, 0x01, 0x40, 0x33, 0xaf,
+	     0x27, 0x56, 0x51, 0x8b, 0xaf, 0x0d, 0x31, 0x5e, 0x13, 0xa0,
+	     0x16, 0x03, 0x00, 0x80, 0x6c, 0xe4, 0xe9, 0x58, 0xa8, 0x00,
+	     0xb2, 0x3f, 0xc0, 0x07, 0x68, 0xa2, 0x01, 0xfa, 0x06, 0x13,
+	     0xde, 0x4f, 0xb1, 0x29, 0x76, 0xc7, 0x4b, 0xf4, 0x08, 0x02,
+	     0xdc, 0x43, 0x00, 0xa0, 0x3d, 0x0f, 0x0c, 0x5b, 0xa2, 0x7f,
+	     0x29, 0xd1, 0x05, 0x68, 0x58, 0xfe, 0x20, 0xba, 0xb3, 0x32,
+	     0x02, 0x72, 0x61, 0xa5, 0x13, 0xcc, 0x3c, 0x78, 0x02, 0x80,
+	     0x5a, 0xbd, 0xd9, 0x68, 0x24, 0x39, 0x7e, 0xf0, 0x11, 0xf0,
+	     0x02, 0xcc, 0xcf, 0xaf, 0x62, 0x66, 0xe6, 0x22, 0x75, 0x98,
+	     0x5b, 0x46, 0x05, 0xc9, 0xc1, 0xae, 0x88, 0x76, 0x1b, 0x26,
+	     0xda, 0xce, 0x2c, 0x8f, 0x5c, 0xae, 0x17, 0x81, 0x3c, 0x68,
+	     0x00, 0x6b, 0x05, 0xa0, 0xaa, 0xdc, 0x4a, 0x00, 0x82, 0xe7,
+	     0x8d, 0xd5, 0x32, 0x00, 0x00, 0xc5, 0x36, 0x20, 0x82, 0x05,
+	     0x88, 0x01, 0x5c, 0xf4, 0x2d, 0xb8, 0x6a, 0x08, 0x53, 0x00,
+	     0x3c, 0xa1, 0x97, 0x00, 0x38, 0xba, 0x94, 0xe8, 0x2a, 0xd6,
+	     0x88, 0xda, 0x97, 0x00, 0x0b, 0x03, 0x00, 0x30, 0x9c, 0x26,
+	     0x84, 0x14, 0x1e, 0x00, 0xc8, 0x03, 0xe2, 0x54, 0xaa, 0xb3,
+	     0x51, 0xa4, 0x01, 0x48, 0x4f, 0xf0, 0xf5, 0xaa, 0x5e, 0xac,
+	     0xef, 0xa0, 0x71, 0xa8, 0x06, 0xd8, 0xb1, 0xc4, 0x0d, 0x40,
+	     0xf0, 0xaf, 0x00, 0x90, 0xad, 0x14, 0xfa, 0xd3, 0x72, 0x99,
+	     0x02, 0x74, 0x16, 0x45, 0x1d, 0xd6, 0x9f, 0x78, 0xab, 0x71,
+	     0x39, 0x34, 0x37, 0x62, 0x01, 0x86, 0xca, 0x21, 0x20, 0xc2,
+	     0x0a, 0x8f, 0xbd, 0x25, 0x6b, 0x0f, 0xd5, 0x02, 0xc4, 0x23,
+	     0x00, 0xaa, 0x12, 0x50, 0x4e, 0x0c, 0x00, 0x80, 0xa9, 0x25,
+	     0x07, 0x20, 0xe8, 0x0b, 0x00, 0x9c, 0xb0, 0x3a, 0x36, 0x53,
+	     0x21, 0x73, 0x00, 0xc0, 0xd7, 0xdf, 0x86, 0xef, 0x31, 0x00,
+	     0x00, 0x00, 0x08, 0x00, 0x72, 0xde, 0x06, 0x03, 0xf0, 0x16,
+	     0x3a, 0xe2, 0x13, 0x40, 0xa6, 0x34, 0x16, 0x10, 0xb9, 0x35,
+	     0x04, 0xc6, 0xbf, 0xaf, 0x9e, 0x30, 0x4a, 0x0e, 0x79, 0x8b,
+	     0x04, 0x00, 0x4e, 0x50, 0xc0, 0x7a, 0xa4, 0xcc, 0x00, 0x90,
+	     0x60, 0x6f, 0xb9, 0xb8, 0xae, 0x9b, 0x8c, 0x17, 0xba, 0x06,
+	     0x80, 0x0d, 0x20, 0x97, 0xe7, 0x8c, 0x6d, 0xa8, 0x34, 0x11,
+	     0x7c, 0x96, 0x59, 0x7a, 0x57, 0x2c, 0x02, 0xac, 0x26, 0x1f,
+	     0x0c, 0x80, 0x98, 0xab, 0x00, 0x32, 0x8f, 0xd1, 0xb0, 0x06,
+	     0x70, 0x4d, 0x1d, 0xc0, 0x1a, 0x09, 0x20, 0x00, 0xe0, 0x28,
+	     0x8f, 0x93, 0x54, 0xf8, 0x95, 0x6d, 0xf2, 0x05, 0x00, 0x03,
+	     0xb0, 0x92, 0x27, 0x42, 0x00, 0x71, 0x3f, 0x08, 0xd9, 0x00,
+	     0xa8, 0x2d, 0x20, 0x00, 0x68, 0x01, 0x6c, 0x41, 0x91, 0x16,
+	     0x10, 0x24, 0x03, 0x00, 0x3f, 0x00, 0x33, 0x70, 0x02, 0x7c,
+	     0x01, 0x24, 0x80, 0x6a, 0xf6, 0x59, 0x02, 0x8a, 0x34, 0xc0,
+	     0x0c, 0x00, 0x10, 0x93, 0x01, 0x38, 0x10, 0x20, 0x86, 0x46,
+	     0x46, 0x91, 0xce, 0x9b, 0x49, 0xa8, 0x5e, 0x8e, 0xbe, 0x83,
+	     0x1e, 0xc0, 0xce, 0x02, 0xe0, 0x54, 0x64, 0xc0, 0xd7, 0xf0,
+	     0x02, 0xd4, 0x20, 0x3d, 0x3b, 0x20, 0x07, 0xa3, 0x3f, 0x6e,
+	     0x06, 0x80, 0x0e, 0x00, 0x3e, 0x80, 0x45, 0xe0, 0x2c, 0x97,
+	     0xe0, 0x33, 0x14, 0xbc, 0x0b, 0x96, 0x00, 0x90, 0x56, 0x2f,
+	     0x98, 0x80, 0xbe, 0x7a, 0xba, 0x87, 0x00, 0xce, 0x00, 0x08,
+	     0x40, 0x59, 0x04, 0xfc, 0x01, 0xe4, 0x82, 0x01, 0x40, 0x48,
+	     0x00, 0xa8, 0x30, 0x80, 0x13, 0x00, 0xa6, 0x02, 0xba, 0x6b,
+	     0x7c, 0x5e, 0xb0, 0x45, 0x17, 0x97, 0xff, 0xf6, 0x60, 0x92,
+	     0xaf, 0x54, 0x6b, 0x4e, 0x18, 0xcd, 0xa2, 0x03, 0x64, 0x72,
+	     0x74, 0x71, 0x16, 0x4b, 0x18, 0xd3, 0x70, 0xda, 0x14, 0x15,
+	     0x8d, 0x10, 0xbe, 0x8c, 0x08, 0x40, 0x6b, 0xa6, 0x45, 0x85,
+	     0x00, 0x0b, 0xdf, 0x7e, 0x59, 0xb1, 0x96, 0xb9, 0x67, 0x64,
+	     0x49, 0x82, 0xfa, 0xf9, 0x01, 0xe7, 0xd5, 0x1e, 0x5b, 0x1d,
+	     0x5e, 0x35, 0x75, 0xdd, 0x69, 0xc2, 0x1e, 0x03, 0x90, 0x76,
+	     0xb1, 0x27, 0xac, 0x4d, 0x18, 0xbd, 0x63, 0x40, 0xc6, 0x07,
+	     0x60, 0x02, 0x52, 0x70, 0x9d, 0x30, 0x08, 0xc8, 0x45, 0xd4,
+	     0xd5, 0xce, 0xfc, 0x46, 0xb7, 0x1d, 0x00, 0x00, 0xd2, 0xf1,
+	     0x1b, 0x69, 0xfb, 0x55, 0x80, 0xcd, 0xad, 0xbf, 0xcf, 0x6f,
+	     0x00, 0xc4, 0x38, 0x00, 0x0d, 0x00, 0x7c, 0xe7, 0x06, 0x71,
+	     0x5c, 0x31, 0xc5, 0xfe, 0x40, 0x73, 0x58, 0xcd, 0x64, 0x70,
+	     0x02, 0xfc, 0xee, 0x71, 0xec, 0xdc, 0xe9, 0xbe, 0x04, 0xac,
+	     0xab, 0x77, 0x0b, 0x00, 0xf8, 0xb0, 0x00, 0x25, 0x93, 0x02,
+	     0x03, 0x28, 0xaf, 0x4c, 0x80, 0xc8, 0xb4, 0xd8, 0xd6, 0x60,
+	     0x30, 0xd7, 0x17, 0xd0, 0x20, 0x63, 0x00, 0x00, 0x00, 0xa0,
+	     0xb7, 0x58, 0x21, 0x56, 0x20, 0xc7, 0x41, 0x74, 0x6d, 0xd8,
+	     0x99, 0xed, 0x4f, 0x00, 0x10, 0xeb, 0x00, 0x00, 0xd4, 0x59,
+	     0xd5, 0x44, 0xaa, 0x00, 0x04, 0x80, 0x9e, 0xd8, 0x96, 0xba,
+	     0xd3, 0x00, 0x67, 0x00, 0xc0, 0x02, 0xd0, 0x06, 0x16, 0x26,
+	     0x32, 0xf8, 0x96, 0xd7, 0x02, 0x2c, 0x68, 0x3e, 0xa0, 0x7e,
+	     0xe0, 0x6b, 0xe1, 0x6c, 0x1c, 0x00, 0x6d, 0x13, 0x03, 0x98,
+	     0x5a, 0xaf, 0x03, 0x80, 0x02, 0x00, 0x4c, 0x39, 0x40, 0x72,
+	     0xe1, 0xb5, 0x27, 0xbe, 0xc8, 0x03, 0x20, 0x65, 0xae, 0xfd,
+	     0xf7, 0xdf, 0x8e, 0x57, 0x00, 0x70, 0x9a, 0x56, 0x8b, 0x27,
+	     0x12, 0x17, 0x45, 0x81, 0x2d, 0x68, 0x6f, 0x2d, 0xa2, 0x0f,
+	     0x18, 0xc8, 0x48, 0xc0, 0x16, 0x0c, 0x80, 0x91, 0x51, 0x3a,
+	     0x40, 0x14, 0x4d, 0x4b, 0x51, 0xc2, 0x45, 0xae, 0xfb, 0x39,
+	     0x54, 0x79, 0xc1, 0x11, 0xc0, 0x57, 0xed, 0x03, 0xa0, 0xff,
+	     0xa2, 0x1c, 0xff, 0x00, 0x18, 0xb7, 0x01, 0x15, 0x38, 0x92,
+	     0x52, 0x63, 0x7e, 0x7f, 0x00, 0x2e, 0x20, 0x08, 0x70, 0xd8,
+	     0x01, 0x5e, 0xc0, 0x83, 0x0d, 0x3e, 0xa8, 0x55, 0x14, 0x91,
+	     0xf3, 0xad, 0x3d, 0x83, 0x6b, 0x46, 0x40, 0xed, 0x08, 0x00,
+	     0x08, 0xde, 0xc2, 0x1e, 0xa7, 0x97, 0x04, 0x40, 0x54, 0x84,
+	     0x94, 0xed, 0xc1, 0x03, 0x80, 0xa6, 0x04, 0x45, 0x43, 0xe0,
+	     0x45, 0xf6, 0x68, 0x98, 0x0f, 0x20, 0xbd, 0x50, 0xae, 0x57,
+	     0x80, 0xaa, 0xec, 0x09, 0x00, 0x80, 0x04, 0xe3, 0x54, 0x09,
+	     0x86, 0x6b, 0x43, 0x97, 0xce, 0x7c, 0x86, 0x52, 0x42, 0xbd,
+	     0x1e, 0x64, 0x15, 0xa6, 0x0c, 0x00, 0x68, 0x69, 0x1d, 0xb5,
+	     0x7f, 0xc8, 0x03, 0xd3, 0x89, 0xc4, 0x60, 0x03, 0xd0, 0x99,
+	     0x65, 0x91, 0x18, 0x32, 0x87, 0x01, 0x00, 0x03, 0xc0, 0x00,
+	     0x5f, 0xe4, 0xb9, 0xed, 0xe5, 0x6b, 0x80, 0x54, 0x3f, 0x0d,
+	     0x95, 0xe7, 0x90, 0x2b, 0x75, 0x11, 0xf0, 0x00, 0xf8, 0xaa,
+	     0xb1, 0x02, 0xc5, 0x0b, 0xc0, 0xef, 0xce, 0x3b, 0x9d, 0x0f,
+	     0xc0, 0x4c, 0xee, 0x1b, 0x0c, 0x00, 0xe0, 0xd4, 0x03, 0xf8,
+	     0x8c, 0x51, 0xf2, 0x07, 0x6f, 0xfd, 0xb5, 0x6e, 0x23, 0x1b,
+	     0x84, 0x00, 0x88, 0x8c, 0x70, 0xa9, 0x3d, 0x00, 0x50, 0x16,
+	     0xbe, 0x01, 0xa8, 0x56, 0xbb, 0x8b, 0x03, 0x00, 0x14, 0x1e,
+	     0x80, 0x59, 0x57, 0x8b, 0x2c, 0xf9, 0x2c, 0x98, 0xb7, 0x97,
+	     0x0a, 0x02, 0x00, 0x9d, 0x43, 0x83, 0x58, 0x84, 0xa8, 0x00,
+	     0x0a, 0x40, 0xd5, 0x1a, 0xb8, 0xb5, 0x00, 0xcc, 0xf0, 0x0d,
+	     0x07, 0x50, 0x41, 0x20, 0x25, 0x24, 0x0e, 0xe0, 0xd2, 0xfa,
+	     0x91, 0x80, 0xcf, 0x4e, 0x02, 0x18, 0x9c, 0x00, 0x96, 0x86,
+	     0x6e, 0x0a, 0xf0, 0xbb, 0x00, 0x80, 0x91, 0x57, 0x11, 0xd0,
+	     0xd3, 0xc6, 0x00, 0xa6, 0xed, 0x74, 0x18, 0x5a, 0x00, 0x64,
+	     0x00, 0xe2, 0xb2, 0x3d, 0x03, 0x2a, 0x30, 0x80, 0x01, 0x0d,
+	     0x6e, 0xbc, 0x14, 0x54, 0xf8, 0x13, 0xa0, 0xcc, 0x81, 0x2d,
+	     0xa9, 0xe3, 0x44, 0xd8, 0xa5, 0xd5, 0xb6, 0x43, 0x00, 0x0b,
+	     0xe0, 0x8e, 0x31, 0x18, 0x97, 0x8a, 0x02, 0x0a, 0xf0, 0x96,
+	     0x96, 0x00, 0x4c, 0xa2, 0x9a, 0x33, 0xc7, 0xf4, 0x88, 0x57,
+	     0x08, 0xb0, 0x56, 0xdb, 0xd7, 0xaa, 0x9b, 0xcd, 0x80, 0x18,
+	     0xe8, 0xdf, 0x8f, 0x80, 0xa7, 0xc0, 0xc3, 0x02, 0xdc, 0x2b,
+	     0x22, 0x86, 0xa0, 0x6f, 0x01, 0x4c, 0x80, 0xe3, 0x2b, 0x28,
+	     0x16, 0x1a, 0x3e, 0xe8, 0x6d, 0x53, 0x1a, 0x99, 0x02, 0xa6,
+	     0x6d, 0x31, 0x80, 0xb1, 0x9c, 0x00, 0xc8, 0x5e, 0x30, 0xc0,
+	     0xaa, 0x05, 0xe0, 0xd2, 0xc6, 0x96, 0x2e, 0x13, 0x06, 0x00,
+	     0x6e, 0x42, 0x19, 0xc8, 0x67, 0x38, 0x24, 0x0c, 0x00, 0x40,
+	     0x01, 0xc7, 0x9d, 0x0f, 0x01, 0x80, 0xe9, 0x36, 0x06, 0x68,
+	     0x01, 0x20, 0x39, 0x35, 0xb9, 0x7c, 0x00, 0x14, 0xc5, 0x87,
+	     0x76, 0x0c, 0x00, 0x58, 0x05, 0x01, 0x38, 0x9a, 0xe9, 0x77,
+	     0x05, 0xe4, 0x0f, 0xe2, 0x93, 0x2e, 0xdf, 0x80, 0xe9, 0x5e,
+	     0x69, 0xe5, 0xf2, 0x60, 0x1d, 0x84, 0x01, 0x08, 0x47, 0x3e,
+	     0x57, 0xf5, 0x02, 0x00, 0x62, 0x80, 0xc8, 0xe1, 0x07, 0xcd,
+	     0x35, 0xe9, 0x58, 0xa5, 0x11, 0x8f, 0x01, 0xc2, 0xd7, 0x16,
+	     0xa0, 0xa8, 0x67, 0x89, 0xc6, 0x28, 0xf8, 0x28, 0x21, 0x00,
+	     0xa4, 0x69, 0xaf, 0x14, 0x9c, 0x06, 0x18, 0x22, 0x00, 0xe1,
+	     0x32, 0x00, 0x60, 0x26, 0xcc, 0xde, 0x08, 0x00, 0xe2, 0xdf,
+	     0xc3, 0xbd, 0x46, 0x57, 0xb3, 0x29, 0x64, 0x5e, 0x66, 0x5d,
+	     0x03, 0x45, 0x55, 0x2b, 0x7e, 0x0a, 0x01, 0xac, 0xa2, 0x1a,
+	     0x07, 0x48, 0xe6, 0x39, 0x80, 0xf0, 0xab, 0x58, 0x9e, 0x2f,
+	     0x01, 0x85, 0xe1, 0x14, 0x00, 0x00, 0x4c, 0x01, 0x80, 0xb2,
+	     0x22, 0x07, 0xc0, 0x07, 0x73, 0x40, 0x40, 0xe3, 0x00, 0x95,
+	     0xe2, 0x72, 0x80, 0xda, 0x7a, 0xc9, 0x01, 0x77, 0x96, 0x00,
+	     0xac, 0x0a, 0xa0, 0x77, 0x15, 0xc2, 0xc2, 0x85, 0xc4, 0x0e,
+	     0xb8, 0x5a, 0xcb, 0x00, 0x00, 0x64, 0x50, 0x53, 0xe7, 0x91,
+	     0x1d, 0xbf, 0x3a, 0xe8, 0x3f, 0x0a, 0xdd, 0x59, 0x77, 0x5d,
+	     0xb6, 0x2b, 0x64, 0xfe, 0x22, 0x35, 0xe0, 0x8b, 0x1c, 0x3c,
+	     0x2f, 0x19, 0x10, 0xc0, 0x43, 0x03, 0x24, 0x00, 0x00, 0x53,
+	     0x06, 0x20, 0x6b, 0x87, 0x1b, 0x2a, 0x40, 0x75, 0xf1, 0x43,
+	     0x5d, 0x41, 0x00, 0x00, 0x00, 0x30, 0x58, 0x05, 0x01, 0x1f,
+	     0x80, 0x1e, 0x00, 0x03, 0x2c, 0xc3, 0xa3, 0xc1, 0xec, 0xdc,
+	     0x56, 0xa8, 0x00, 0x00, 0x80, 0x05, 0x24, 0x2d, 0x5c, 0xe0,
+	     0x93, 0xec, 0x30, 0xbf, 0x74, 0x02, 0x66, 0x83, 0xbf, 0x0c,
+	     0x00, 0x3b, 0xf2, 0x55, 0x5a, 0x66, 0x26, 0xef, 0x60, 0xaa,
+	     0x4c, 0x00, 0x50, 0x10, 0xc0, 0x4b, 0x96, 0xba, 0x74, 0x5e,
+	     0xf6, 0x0e, 0x30, 0x4a, 0xe6, 0xf3, 0xc4, 0x23, 0xcd, 0x9e,
+	     0x4b, 0x75, 0xa8, 0x39, 0x00, 0x19, 0x30, 0xde, 0x70, 0x00,
+	     0x92, 0x0a, 0xe0, 0x9e, 0x88, 0xaf, 0x7f, 0x10, 0x30, 0x0c,
+	     0xab, 0xc4, 0x03, 0x93, 0x3e, 0xc9, 0x69, 0xf9, 0x00, 0x00,
+	     0xbb, 0x29, 0x00, 0xdd, 0x6f, 0x1c, 0x8b, 0x72, 0x40, 0x01,
+	     0x86, 0xc1, 0x65, 0x97, 0x17, 0xb6, 0x73, 0x39, 0x3f, 0x23,
+	     0xc7, 0x4d, 0xe3, 0x3b, 0x0a, 0x00, 0x4c, 0xa6, 0x67, 0x22,
+	     0x60, 0x40, 0xd6, 0xb2, 0xf6, 0xec, 0x94, 0x12, 0x09, 0x40,
+	     0xc4, 0x31, 0x01, 0x00, 0xc0, 0x06, 0x00, 0x4c, 0x3b, 0x6a,
+	     0x00, 0x51, 0x02, 0x00, 0xc0, 0x29, 0x1c, 0x80, 0x70, 0xe0,
+	     0x3f, 0x03, 0x31, 0xd6, 0x3e, 0x40, 0x55, 0x70, 0xd7, 0x89,
+	     0x41, 0x5f, 0x4c, 0x9e, 0x27, 0x66, 0x1f, 0x20, 0x40, 0xcc,
+	     0x08, 0xc9, 0x2d, 0x21, 0x7f, 0x55, 0x7d, 0x0c, 0xa0, 0x17,
+	     0x54, 0xbb, 0x8c, 0x05, 0x60, 0xda, 0xb6, 0x03, 0x50, 0x6e,
+	     0x1a, 0x50, 0xef, 0xce, 0x88, 0x8d, 0x64, 0x4a, 0xf8, 0x9b,
+	     0x3e, 0x00, 0x63, 0x79, 0x6a, 0xfb, 0x14, 0x03, 0x3e, 0xb6,
+	     0x1a, 0x00, 0x40, 0xdf, 0xb0, 0x09, 0x29, 0x8d, 0x86, 0xa9,
+	     0x18, 0x95, 0xe4, 0xd4, 0x57, 0x72, 0x05, 0x00, 0xb0, 0x1e,
+	     0x00, 0x79, 0x10, 0x80, 0xa0, 0x00, 0x7a, 0xbd, 0x23, 0xc2,
+	     0x3f, 0xe4, 0x25, 0xb6, 0x69, 0x00, 0xab, 0x47, 0x6b, 0xec,
+	     0xc4, 0xe1, 0x18, 0xe0, 0x65, 0xd5, 0xb7, 0x95, 0x52, 0x14,
+	     0x09, 0x30, 0x93, 0x0f, 0x59, 0x00, 0x1a, 0xa0, 0x34, 0x00,
+	     0xbc, 0x01, 0x4a, 0x80, 0x09, 0x70, 0x00, 0x00, 0xba, 0xbb,
+	     0xeb, 0x19, 0x60, 0x04, 0x70, 0xc0, 0xe4, 0x1d, 0x40, 0x0a,
+	     0xc0, 0x93, 0xa4, 0x00, 0x26, 0xdb, 0xe4, 0x78, 0x50, 0x01,
+	     0x4b, 0xf4, 0x0a, 0xc0, 0x31, 0xfe, 0x6d, 0x80, 0xd5, 0x0e,
+	     0x5c, 0xdb, 0xe0, 0x75, 0x58, 0xf1, 0x76, 0x64, 0x44, 0x02,
+	     0x7e, 0x2e, 0xc0, 0x72, 0x76, 0xb3, 0x83, 0xad, 0x80, 0x4c,
+	     0x1c, 0x30, 0x2b, 0x59, 0x1d, 0x58, 0x2c, 0x1f, 0xc0, 0x03,
+	     0xf4, 0x37, 0xf1, 0xa3, 0xf3, 0x29, 0x10, 0x00, 0x4d, 0x00,
+	     0x40, 0xc9, 0x36, 0x02, 0xc8, 0x91, 0x6d, 0x31, 0xfc, 0x3d,
+	     0x69, 0xf6, 0xae, 0x0e, 0x74, 0x17, 0x70, 0x00, 0x64, 0xf3,
+	     0x9b, 0x62, 0x37, 0x6b, 0x7c, 0x4f, 0xd8, 0x20, 0x00, 0x3f,
+	     0x56, 0x9e, 0x43, 0x46, 0x80, 0x31, 0x67, 0x0c, 0x80, 0x13,
+	     0xce, 0xbd, 0xac, 0x4a, 0xeb, 0x66, 0x03, 0x1c, 0xce, 0x10,
+	     0xe0, 0x10, 0xf4, 0xcb, 0x0f, 0xf7, 0x81, 0x7d, 0x06, 0xe0,
+	     0x03, 0xc8, 0x5b, 0x0d, 0x64, 0x0a, 0x00, 0xb0, 0xb1, 0x19,
+	     0xc5, 0x08, 0x26, 0x8d, 0x02, 0x00, 0x53, 0xe9, 0xb8, 0x08,
+	     0x00, 0xfc, 0x75, 0x00, 0x30, 0x40, 0x7a, 0xe6, 0x7b, 0xe5,
+	     0x63, 0xca, 0x02, 0x10, 0x97, 0x7b, 0x68, 0x0c, 0xff, 0x6f,
+	     0x07, 0x40, 0xb1, 0x40, 0x60, 0x74, 0x58, 0x36, 0xf6, 0xb1,
+	     0x01, 0x3a, 0x00, 0xef, 0x00, 0x50, 0xd0, 0x54, 0xc1, 0x41,
+	     0x6d, 0x60, 0x74, 0x02, 0xdc, 0xca, 0xf4, 0xa8, 0x29, 0x9e,
+	     0xc3, 0x46, 0xfe, 0x23, 0x00, 0xbc, 0xc3, 0x36, 0xe7, 0x99,
+	     0x37, 0x0b, 0x9d, 0x55, 0x0c, 0x18, 0xe8, 0x21, 0xa0, 0xf3,
+	     0xfd, 0x7a, 0x63, 0x06, 0xd5, 0xc8, 0x8d, 0xda, 0xd7, 0x08,
+	     0x3c, 0x67, 0xe4, 0x0c, 0x00, 0xd8, 0xf1, 0xb4, 0x12, 0x04,
+	     0x11, 0xe1, 0x84, 0xc7, 0xac, 0x24, 0x98, 0x0d, 0xd8, 0x95,
+	     0xe9, 0x43, 0xc0, 0x2b, 0xa4, 0x00, 0x30, 0x8c, 0xe5, 0x6f,
+	     0x05, 0xe0, 0x8c, 0x89, 0xc5, 0x8b, 0x54, 0xaa, 0x0d, 0xcb,
+	     0x4b, 0x79, 0x8b, 0x21, 0x80, 0x89, 0x07, 0xf0, 0x74, 0xc4,
+	     0x0b, 0x07, 0x20, 0x89, 0x08, 0x48, 0xcd, 0x08, 0xed, 0x0b,
+	     0x38, 0x08, 0xde, 0x77, 0x66, 0x9a, 0x58, 0x1c, 0x56, 0x78,
+	     0xbb, 0xc6, 0x50, 0x0b, 0x00, 0xdd, 0x81, 0xfa, 0xa8, 0x92,
+	     0x1e, 0x61, 0x99, 0x98, 0x00, 0xc0, 0x98, 0x09, 0x00, 0xa8,
+	     0xbb, 0xa2, 0x3e, 0xc0, 0xd6, 0x02, 0x00, 0x1c, 0x00, 0x63,
+	     0x3d, 0x03, 0x38, 0x02, 0xb4, 0x12, 0x54, 0xb0, 0x80, 0x82,
+	     0x74, 0x50, 0x6d, 0xae, 0xad, 0x08, 0x38, 0x80, 0x34, 0x60,
+	     0x02, 0x14, 0x48, 0x02, 0x00, 0x34, 0x99, 0xec, 0x1f, 0x90,
+	     0x2c, 0x58, 0xd3, 0x59, 0x80, 0x61, 0x08, 0x7d, 0x03, 0x28,
+	     0x75, 0x48, 0x14, 0x00, 0xbd, 0x0a, 0x05, 0x13, 0x2b, 0x6b,
+	     0x2c, 0x82, 0x91, 0x6c, 0x9a, 0x59, 0xfc, 0x0f, 0x38, 0x5c,
+	     0x01, 0x4b, 0xc0, 0x16, 0xf0, 0x78, 0xc9, 0xe0, 0x0a, 0x97,
+	     0xa2, 0x0c, 0x20, 0xe5, 0x7b, 0x20, 0xc4, 0x79, 0x7a, 0x5c,
+	     0x2d, 0x10, 0x45, 0x40, 0xe6, 0xb9, 0x2f, 0x61, 0x63, 0x2f,
+	     0x80, 0x6a, 0x0b, 0x78, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x50,
+	     0x9d, 0x3b, 0x14, 0xe0, 0xca, 0x5f, 0x88, 0x10, 0xbf, 0x00,
+	     0x70, 0xc0, 0x35, 0xec, 0xab, 0x4b, 0x01, 0x04, 0x71, 0x18,
+	     0xd2, 0x04, 0xd4, 0x00, 0x0a, 0x40, 0x54, 0x42, 0x03, 0x58,
+	     0x26, 0x74, 0xc7, 0x8b, 0x5f, 0x02, 0x84, 0x01, 0x00, 0xf2,
+	     0x4f, 0x5e, 0x6c, 0x6b, 0x6f, 0x8d, 0xef, 0x9c, 0x0b, 0x28,
+	     0x7b, 0x01, 0xe6, 0x3b, 0xbe, 0x67, 0xd0, 0x51, 0xa1, 0xff,
+	     0x2f, 0xc3, 0x7b, 0x70, 0xda, 0x0e, 0x6a, 0x00, 0x09, 0x80,
+	     0x0f, 0x81, 0x6d, 0xbb, 0x7b, 0xbe, 0xd6, 0x62, 0xf0, 0x0a,
+	     0x9e, 0x03, 0x60, 0x6d, 0x9e, 0x05, 0x81, 0x80, 0xe0, 0x23,
+	     0x0f, 0x05, 0xbd, 0x00, 0x60, 0x51, 0xf9, 0x77, 0x46, 0xa8,
+	     0x01, 0x24, 0xc7, 0x8e, 0x4f, 0xb6, 0x25, 0x01, 0x80, 0x89,
+	     0xd7, 0x2f, 0xce, 0x52, 0x01, 0x6a, 0x40, 0xa4, 0x18, 0xe1,
+	     0x31, 0xe8, 0x72, 0x39, 0x11, 0xc0, 0xaa, 0x6e, 0x00, 0xd4,
+	     0x1f, 0x40, 0xe3, 0x01, 0xcc, 0x84, 0xde, 0x1b, 0xe0, 0x06,
+	     0x00, 0x58, 0x4f, 0x10, 0xe6, 0x16, 0x07, 0x00, 0xd0, 0x39,
+	     0x5c, 0x40, 0x32, 0x0b, 0x10, 0xa7, 0x2e, 0x5c, 0x80, 0xb1,
+	     0xbd, 0x32, 0x02, 0x00, 0x1f, 0x0a, 0xa9, 0x85, 0x61, 0x5d,
+	     0x0d, 0x00, 0x0b, 0x60, 0x32, 0xf8, 0x9e, 0x02, 0x35, 0x00,
+	     0x1e, 0x70, 0xe1, 0xb3, 0x01, 0x16, 0x55, 0x06, 0xbe, 0xf8,
+	     0xbd, 0x72, 0x00, 0xe3, 0xcd, 0x23, 0xad, 0xc5, 0x9e, 0xd0,
+	     0x59, 0x8e, 0xf1, 0x46, 0x58, 0x9f, 0x5f, 0x00, 0x22, 0x7b,
+	     0x2b, 0x14, 0x81, 0x1d, 0x3c, 0xe0, 0x77, 0x6d, 0x02, 0xce,
+	     0x00, 0x02, 0x30, 0x9a, 0xd6, 0xa3, 0xb0, 0xff, 0x8b, 0x54,
+	     0xa5, 0x28, 0xe9, 0xe4, 0x28, 0x95, 0xd0, 0x7e, 0x7c, 0x0a,
+	     0x73, 0x02, 0x80, 0xf7, 0x03, 0x18, 0x19, 0x1d, 0x5f, 0xc0,
+	     0xac, 0x46, 0xf6, 0x82, 0x52, 0x80, 0x65, 0x14, 0x27, 0x13,
+	     0xd6, 0x40, 0xc5, 0xf0, 0x0c, 0x00, 0xd9, 0x78, 0x0c, 0x65,
+	     0x00, 0xa0, 0xf1, 0x8b, 0x0d, 0x5f, 0x1c, 0x80, 0x1e, 0x70,
+	     0x05, 0xf8, 0xb0, 0x2b, 0x0e, 0x00, 0x80, 0x44, 0xc7, 0x2e,
+	     0x26, 0x17, 0x00, 0x00, 0x7b, 0x27, 0x00, 0x6c, 0x31, 0xe9,
+	     0x89, 0xa8, 0x3a, 0x00, 0x28, 0x90, 0xe8, 0xf9, 0x9c, 0x01,
+	     0x58, 0x88, 0x29, 0xa0, 0x05, 0xae, 0x3b, 0xb7, 0x9d, 0x99,
+	     0x78, 0xba, 0x23, 0x5a, 0x01, 0xba, 0x7f, 0x7a, 0x26, 0x1c,
+	     0x29, 0x01, 0xf3, 0xcf, 0xc5, 0x2b, 0x41, 0x46, 0x57, 0x63,
+	     0xfd, 0x1c, 0x0a, 0xa8, 0x12, 0x7d, 0x00, 0x40, 0x41, 0x8c,
+	     0x0c, 0xec, 0x88, 0x43, 0x46, 0xdb, 0x38, 0xb8, 0xfa, 0x7f,
+	     0x24, 0x00, 0x2b, 0xfa, 0x4b, 0x2c, 0x6a, 0x69, 0xb7, 0x96,
+	     0x70, 0x27, 0x68, 0x01, 0x6b, 0xef, 0x40, 0x98, 0x01, 0xcc,
+	     0xc0, 0x1b, 0xc0, 0x66, 0x76, 0x07, 0x04, 0x9b, 0x7c, 0x15,
+	     0x8a, 0xe9, 0x66, 0x53, 0x80, 0x5e, 0x4b, 0x3a, 0x1c, 0x85,
+	     0x00, 0x3a, 0xcf, 0x55, 0x82, 0x4c, 0x0a, 0x45, 0xb5, 0x20,
+	     0xd0, 0xcb, 0x00, 0x30, 0x80, 0xdf, 0x84, 0x0a, 0xc3, 0x7a,
+	     0x5b, 0x12, 0x4b, 0x1e, 0xc0, 0xc8, 0x69, 0x20, 0x50, 0x38,
+	     0x3a, 0x35, 0x7f, 0xc6, 0xd7, 0xdf, 0x7e, 0x98, 0x33, 0x00,
+	     0xc0, 0x01, 0x00, 0xec, 0x73, 0x59, 0xff, 0x5f, 0x06, 0x00,
+	     0x00, 0x13, 0x5e, 0xe5, 0xe1, 0xdf, 0x7f, 0x5c, 0x77, 0xf5,
+	     0x09, 0x00, 0xb5, 0x76, 0xa7, 0x58, 0xbb, 0x24, 0xd1, 0x19,
+	     0x01, 0xec, 0x22, 0x71, 0xf3, 0x09, 0x08, 0x07, 0xc6, 0x42,
+	     0x80, 0xe8, 0x31, 0x86, 0xe2, 0x0e, 0x6e, 0x80, 0x59, 0xc7,
+	     0x74, 0x03, 0x22, 0xd9, 0x02, 0x3a, 0xf8, 0xee, 0x5e, 0x14,
+	     0x7f, 0x61, 0x5c, 0xa5, 0x3a, 0x48, 0x7e, 0x00, 0x42, 0xb2,
+	     0xe3, 0xc7, 0x8d, 0x9b, 0x00, 0x79, 0x07, 0xf0, 0xe8, 0xae,
+	     0x9f, 0x80, 0x14, 0x00, 0xa0, 0x01, 0x8c, 0x94, 0x64, 0x50,
+	     0x8b, 0x61, 0x23, 0x96, 0x01, 0xa0, 0x28, 0xd2, 0xc4, 0x77,
+	     0x10, 0x00, 0x39, 0x2e, 0xf6, 0xcb, 0x02, 0x30, 0x04, 0xb9,
+	     0x30, 0x00, 0xd0, 0xe5, 0xa1, 0xc4, 0x6d, 0xc0, 0x58, 0xe3,
+	     0xd2, 0xe1, 0xfa, 0x9a, 0xb2, 0x19, 0x70, 0xc4, 0x87, 0x8a,
+	     0xc6, 0xe8, 0x45, 0xd6, 0x8d, 0xb6, 0xa6, 0x6f, 0x5a, 0x3b,
+	     0x0f, 0x3b, 0x80, 0x51, 0x00, 0x67, 0x62, 0x10, 0x78, 0x17,
+	     0xc2, 0x90, 0x2c, 0x60, 0x14, 0x00, 0x30, 0x01, 0xcc, 0x30,
+	     0x3d, 0x7a, 0x20, 0xa7, 0x01, 0xcb, 0x02, 0x1d, 0x92, 0xa3,
+	     0xbc, 0xb7, 0x90, 0xfc, 0x5d, 0x02, 0x40, 0x00, 0x04, 0x69,
+	     0x00, 0x00, 0xa0, 0x2a, 0x02, 0xa0, 0xff, 0x08, 0xc0, 0x0c,
+	     0x3f, 0x4d, 0xd7, 0xe9, 0x33, 0x4f, 0x06, 0x50, 0x13, 0x4d,
+	     0x67, 0x34, 0x03, 0x42, 0x02, 0xd0, 0x01, 0xad, 0x63, 0x2d,
+	     0x64, 0x2f, 0x5a, 0x00, 0x00, 0xce, 0x58, 0xd9, 0x03, 0xcc,
+	     0x8f, 0xab, 0x2e, 0x80, 0xca, 0x44, 0x2c, 0x67, 0x78, 0xc0,
+	     0x03, 0x3e, 0x58, 0xc1, 0x0c, 0x99, 0x84, 0x49, 0x3c, 0x25,
+	     0x9f, 0x5f, 0x5d, 0xc0, 0x34, 0x04, 0xf8, 0xf2, 0x01, 0x92,
+	     0x97, 0x08, 0x0d, 0xa8, 0x2d, 0x0a, 0xaa, 0xe1, 0x6f, 0x7a,
+	     0x02, 0x91, 0x5b, 0xed, 0xe7, 0xd9, 0x45, 0xfe, 0x34, 0xb7,
+	     0xc7, 0x2d, 0x57, 0x51, 0xd6, 0xad, 0x62, 0xac, 0x2f, 0x3a,
+	     0x9e, 0xd9, 0x5a, 0x78, 0xbe, 0x92, 0x75, 0x3c, 0x03, 0x8c,
+	     0x09, 0xfa, 0xcf, 0xf7, 0xd2, 0x04, 0x00, 0x6a, 0x24, 0x00,
+	     0x20, 0xa5, 0x6b, 0x3a, 0x6d, 0xa0, 0x73, 0xb2, 0xb8, 0xf0,
+	     0x1e, 0xe0, 0x80, 0x46, 0xda, 0x07, 0x40, 0xf5, 0xc8, 0xae,
+	     0x99, 0xde, 0x67, 0x70, 0x02, 0xae, 0x7c, 0x09, 0x00, 0x87,
+	     0x06, 0x78, 0xfc, 0xf9, 0xa7, 0x71, 0x2b, 0xc3, 0x03, 0x04,
+	     0xe7, 0x1a, 0x00, 0x70, 0x04, 0x15, 0xa7, 0x00, 0x8a, 0x6c,
+	     0x18, 0x03, 0x58, 0x00, 0xe3, 0xb6, 0x7e, 0x10, 0x9d, 0xea,
+	     0x00, 0x51, 0x2b, 0xc3, 0xf3, 0x00, 0xbc, 0xed, 0x02, 0x31,
+	     0xe0, 0xcb, 0x29, 0x21, 0x3e, 0x5a, 0x9d, 0x39, 0x2a, 0xb6,
+	     0x39, 0x98, 0xcc, 0x7a, 0xb5, 0xaf, 0x6a, 0xd3, 0xad, 0x00,
+	     0x0c, 0x03, 0x30, 0x0e, 0x75, 0xb1, 0x42, 0x80, 0xb3, 0x77,
+	     0x36, 0x64, 0xb2, 0x1c, 0xc0, 0xe9, 0x4b, 0x02, 0x3c, 0xef,
+	     0x80, 0x8e, 0xe5, 0x0d, 0x18, 0xc7, 0x75, 0x6f, 0x08, 0x20,
+	     0x48, 0x50, 0xe2, 0x43, 0xe2, 0x3e, 0x23, 0x35, 0x05, 0xf0,
+	     0xb2, 0x00, 0x80, 0xca, 0xb2, 0x7b, 0x01, 0x70, 0xfd, 0x2e,
+	     0x20, 0x0d, 0x60, 0x96, 0x7f, 0x47, 0xb3, 0x6e, 0x33, 0x11,
+	     0xa1, 0x59, 0x25, 0x33, 0xfa, 0xa1, 0x74, 0x91, 0x01, 0x58,
+	     0xaa, 0x5b, 0x8d, 0x20, 0x88, 0x0d, 0x3f, 0xa1, 0x60, 0x1b,
+	     0x60, 0x81, 0x14, 0xe0, 0x3c, 0x14, 0xa0, 0xcf, 0x31, 0xba,
+	     0x30, 0x71, 0xa5, 0x8c, 0x33, 0x03, 0x7e, 0x60, 0x17, 0x86,
+	     0x0c, 0xe1, 0xde, 0xbc, 0xe1, 0xbb, 0xa0, 0xa5, 0xce, 0x99,
+	     0x84, 0x92, 0x05, 0x16, 0x00, 0x07, 0x1e, 0x01, 0x47, 0xd9,
+	     0x50, 0x03, 0x62, 0x14, 0x01, 0xe8, 0x2c, 0x31, 0x03, 0x38,
+	     0x4c, 0xef, 0x00, 0x7e, 0x53, 0xb2, 0x3b, 0x00, 0x24, 0x65,
+	     0x00, 0xe0, 0x0b, 0xa0, 0x02, 0xe8, 0x85, 0x78, 0xfb, 0x3a,
+	     0x06, 0x08, 0xc4, 0x21, 0xa2, 0xbe, 0x20, 0x14, 0x30, 0x49,
+	     0xf9, 0x1f, 0xe0, 0x7a, 0xeb, 0x1b, 0xa7, 0x8f, 0x17, 0xc9,
+	     0x0d, 0x18, 0x0e, 0xa5, 0x9a, 0x62, 0x8a, 0xdc, 0x03, 0x24,
+	     0xe6, 0x72, 0xae, 0x98, 0xf1, 0x16, 0x4e, 0xec, 0x5d, 0x00,
+	     0x3f, 0x01, 0x06, 0x00, 0x00, 0x27, 0xcf, 0x05, 0x00, 0x58,
+	     0x32, 0xa0, 0x75, 0x76, 0x47, 0x63, 0x03, 0x00, 0xd6, 0x00,
+	     0xc0, 0x60, 0x8f, 0x05, 0x01, 0x44, 0x00, 0xf1, 0x2a, 0x08,
+	     0x36, 0x1a, 0x79, 0x80, 0x38, 0x00, 0xe0, 0x06, 0x10, 0x11,
+	     0x5e, 0xc0, 0xae, 0xc8, 0xcf, 0x03, 0x00, 0xa7, 0xe9, 0x17,
+	     0xac, 0x99, 0xff, 0xe5, 0x52, 0xf3, 0x82, 0xba, 0x46, 0x46,
+	     0x89, 0x53, 0x3f, 0x12, 0xc0, 0xe7, 0x35, 0x9e, 0x2e, 0x34,
+	     0xa0, 0x07, 0xb8, 0x5a, 0xd9, 0x80, 0x15, 0x80, 0x94, 0x65,
+	     0x46, 0x79, 0x21, 0x18, 0xb7, 0x2d, 0xd1, 0x01, 0x00, 0x00,
+	     0x28, 0x80, 0x6c, 0x03, 0x20, 0xad, 0x36, 0x40, 0x09, 0xb0,
+	     0xa9, 0x48, 0x01, 0x05, 0xed, 0x20, 0x57, 0x0b, 0x2a, 0x3c,
+	     0x62, 0x2c, 0xe0, 0x82, 0xd0, 0x26, 0x34, 0x44, 0x30, 0x00,
+	     0x60, 0x26, 0x45, 0x0c, 0xee, 0x64, 0x10, 0x00, 0x78, 0x50,
+	     0x8f, 0x32, 0x1e, 0x83, 0x04, 0x64, 0x6d, 0x60, 0x1d, 0x8e,
+	     0xf9, 0x4e, 0x48, 0x19, 0x8d, 0x21, 0x98, 0x1a, 0xd0, 0x96,
+	     0x02, 0x00, 0x7e, 0xd4, 0xc2, 0xa3, 0xe1, 0xe5, 0xae, 0x80,
+	     0x73, 0xb3, 0x05, 0x60, 0x56, 0x25, 0x5f, 0x80, 0xb4, 0x17,
+	     0x07, 0xdc, 0x00, 0xc9, 0xc1, 0xe9, 0xa1, 0x05, 0x60, 0xcd,
+	     0x58, 0x00, 0x12, 0x0f, 0xbc, 0x13, 0x2e, 0x0b, 0x1d, 0x66,
+	     0xbc, 0xb2, 0x71, 0xb2, 0x54, 0xfe, 0x0a, 0xca, 0x5f, 0x89,
+	     0x89, 0x66, 0x00, 0xc0, 0x09, 0xf8, 0xc2, 0xc4, 0x5e, 0x00,
+	     0x0e, 0xcc, 0x56, 0xac, 0x7e, 0x18, 0x80, 0x0a, 0xf0, 0x22,
+	     0x03, 0xca, 0xdf, 0xd6, 0x1b, 0x00, 0xb2, 0x03, 0x28, 0xa9,
+	     0xdf, 0x52, 0x05, 0x00, 0x90, 0x8c, 0x80, 0xb6, 0x10, 0x63,
+	     0x01, 0x00, 0x00, 0x5f, 0x5d, 0x14, 0x90, 0x03, 0xc8, 0xd7,
+	     0x71, 0x48, 0x35, 0x3d, 0x05, 0xa0, 0x02, 0x55, 0x40, 0x29,
+	     0x49, 0xe1, 0x00, 0xe4, 0x3f, 0x30, 0x28, 0x00, 0x05, 0xac,
+	     0xc8, 0x10, 0xc0, 0xc6, 0x9a, 0x84, 0xc7, 0x9f, 0xb8, 0x1b,
+	     0x60, 0x1d, 0xfe, 0xd6, 0x48, 0x1c, 0x80, 0x1e, 0x68, 0xfb,
+	     0xdf, 0xf9, 0x17, 0x80, 0x1f, 0x30, 0x00, 0x14, 0x01, 0xa5,
+	     0x0b, 0xc4, 0x1f, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x47, 0x7f,
+	     0x14, 0x77, 0x01, 0xf7, 0x25, 0xe0, 0x12, 0xe5, 0x02, 0xc4,
+	     0x00, 0xeb, 0x1e, 0x00, 0x40, 0xf6, 0xc6, 0xed, 0x93, 0xbf,
+	     0x0b, 0x80, 0x31, 0x00, 0x6d, 0x00, 0xe0, 0x89, 0xca, 0x16,
+	     0x5c, 0x89, 0x32, 0xa0, 0xa5, 0xdb, 0x5f, 0x00, 0x3e, 0x78,
+	     0x19, 0xf0, 0xf1, 0x02, 0xb4, 0xc4, 0xff, 0xb9, 0x06, 0x50,
+	     0x03, 0x00, 0x98, 0x2e, 0x3a, 0x00, 0xc8, 0x23, 0x48, 0xe0,
+	     0xac, 0xbe, 0x07, 0x00, 0x00, 0xe6, 0xa3, 0x2d, 0x9c, 0x6e,
+	     0xc5, 0x26, 0xb0, 0x80, 0x3d, 0x71, 0xad, 0xa6, 0x73, 0x2d,
+	     0x80, 0xaf, 0x0b, 0x12, 0x10, 0xad, 0x90, 0x80, 0x4b, 0xaf,
+	     0xa8, 0x27, 0x97, 0x15, 0x00, 0x86, 0xe6, 0x4b, 0x35, 0x2d,
+	     0xfe, 0x40, 0xf3, 0x30, 0x06, 0x50, 0x16, 0x1a, 0x10, 0x00,
+	     0xc0, 0x87, 0x55, 0x03, 0xbe, 0x00, 0x74, 0x21, 0xa1, 0x17,
+	     0xdf, 0x17, 0x27, 0xa3, 0x23, 0xcb, 0x27, 0xb5, 0xd7, 0xd3,
+	     0xf9, 0xa9, 0x61, 0x72, 0x02, 0x20, 0x00, 0x8c, 0x71, 0x41,
+	     0x06, 0xa8, 0xf1, 0x93, 0x27, 0x23, 0x08, 0xae, 0x7c, 0x02,
+	     0xfb, 0xd9, 0x41, 0x1d, 0xb6, 0x11, 0x01, 0x86, 0x7e, 0xf5,
+	     0x48, 0x4b, 0x92, 0x8b, 0x00, 0x50, 0xf8, 0x7d, 0x06, 0x00,
+	     0xe4, 0xbb, 0x66, 0x35, 0x78, 0x40, 0x80, 0x77, 0x16, 0xf7,
+	     0x1e, 0x08, 0xe0, 0x25, 0x2a, 0x80, 0x74, 0x1f, 0x00, 0xf8,
+	     0x50, 0x45, 0x4c, 0x08, 0x20, 0xdb, 0x00, 0x14, 0x18, 0xb3,
+	     0xe6, 0x25, 0xb2, 0x59, 0x95, 0xad, 0x00, 0xa2, 0xf7, 0xdb,
+	     0x03, 0x28, 0x2d, 0xee, 0x59, 0x24, 0x00, 0x00, 0x24, 0x03,
+	     0xee, 0xa6, 0x44, 0xe3, 0x70, 0x00, 0x20, 0x8b, 0xdd, 0x28,
+	     0x5f, 0x68, 0x02, 0x62, 0x12, 0x5e, 0xf2, 0x98, 0x76, 0x28,
+	     0xbf, 0x21, 0x80, 0xb8, 0x06, 0x40, 0x00, 0x56, 0xad, 0xfe,
+	     0x95, 0x57, 0xae, 0x19, 0x7c, 0x64, 0x00, 0xf4, 0xff, 0x23,
+	     0x93, 0x00, 0x8a, 0x95, 0x33, 0x11, 0x04, 0x94, 0xdc, 0x00,
+	     0xc0, 0x74, 0x04, 0x00, 0x08, 0x4d, 0xb5, 0x45, 0xf7, 0x3c,
+	     0x74, 0x01, 0xa0, 0xda, 0x70, 0xdf, 0xe3, 0x67, 0x23, 0xf5,
+	     0x00, 0xc0, 0xb0, 0x56, 0xab, 0xe6, 0x64, 0xb9, 0x0b, 0xef,
+	     0x03, 0x68, 0x03, 0x00, 0x3d, 0x03, 0xa8, 0xb4, 0xd6, 0x33,
+	     0x3d, 0x88, 0x57, 0x99, 0xe4, 0x59, 0x01, 0x0c, 0x13, 0x00,
+	     0x70, 0xc2, 0x00, 0x00, 0x14, 0x00, 0x8f, 0x1b, 0x20, 0x1f,
+	     0x39, 0x29, 0x24, 0x07, 0x60, 0x62, 0x38, 0x84, 0x97, 0x52,
+	     0x40, 0x8c, 0xd8, 0x05, 0x00, 0x00, 0x43, 0x87, 0x5d, 0xb0,
+	     0x31, 0xea, 0xa3, 0x0f, 0xc0, 0x2c, 0x5c, 0x10, 0x1a, 0x01,
+	     0x44, 0x7e, 0x02, 0x00, 0xc8, 0xf7, 0xb4, 0x2d, 0xf2, 0x88,
+	     0x78, 0x9f, 0x7d, 0xa0, 0x7c, 0x42, 0x29, 0x95, 0x63, 0x03,
+	     0xe8, 0x80, 0x65, 0xf2, 0x48, 0x3a, 0x42, 0x81, 0x54, 0xe1,
+	     0xf6, 0x5d, 0x1d, 0xc3, 0x1b, 0x62, 0x62, 0x1b, 0xa0, 0x1b,
+	     0x69, 0x09, 0xb7, 0x64, 0x06, 0x7f, 0x76, 0x03, 0x90, 0x88,
+	     0x13, 0x00, 0xb0, 0xa5, 0x0d, 0xb4, 0x82, 0xa0, 0x5a, 0xae,
+	     0xba, 0x4e, 0x17, 0x80, 0xae, 0x48, 0xab, 0x06, 0x5c, 0xed,
+	     0x6a, 0x00, 0xe0, 0x3a, 0x05, 0x00, 0x84, 0x61, 0x80, 0x77,
+	     0xf8, 0x8b, 0x5d, 0x54, 0x7c, 0x00, 0xa0, 0x00, 0xc8, 0xee,
+	     0xa5, 0x65, 0x31, 0x32, 0x0c, 0x30, 0x05, 0xfe, 0x07, 0x2a,
+	     0x80, 0x11, 0xb1, 0xb1, 0x01, 0x50, 0x80, 0x29, 0xb7, 0x52,
+	     0x8f, 0xee, 0x50, 0x80, 0x34, 0x4e, 0x98, 0x00, 0x0c, 0x80,
+	     0x5a, 0xdf, 0xb6, 0x00, 0xe0, 0x5a, 0x15, 0xc0, 0x09, 0xa0,
+	     0xd9, 0x6d, 0xe1, 0x00, 0x2b, 0xf5, 0xb6, 0x0a, 0x3a, 0x7c,
+	     0x44, 0xc0, 0xe9, 0x50, 0x01, 0x80, 0x6a, 0x74, 0x80, 0x35,
+	     0x85, 0x03, 0x80, 0x3a, 0x00, 0x1b, 0x80, 0x0b, 0xf0, 0xb8,
+	     0xd8, 0x3d, 0xc0, 0x1e, 0xc0, 0x76, 0x51, 0xd2, 0x6a, 0x00,
+	     0x09, 0x0d, 0x00, 0xf8, 0x2c, 0xe1, 0x3b, 0x9e, 0x0a, 0x03,
+	     0x00, 0x56, 0xcc, 0xe0, 0x31, 0xc1, 0x14, 0x31, 0xdd, 0x97,
+	     0x4a, 0x8c, 0xbd, 0x2b, 0x55, 0x00, 0x57, 0xc0, 0x18, 0x50,
+	     0x01, 0x0c, 0x01, 0xd0, 0xc7, 0xd8, 0x86, 0x3e, 0x86, 0xf3,
+	     0xd3, 0x2e, 0x2a, 0x13, 0x4a, 0x73, 0xdf, 0xec, 0x1f, 0xfb,
+	     0x42, 0x2c, 0xb6, 0x24, 0x22, 0xc0, 0x14, 0x10, 0x83, 0xa1,
+	     0xb8, 0x7b, 0xc0, 0x28, 0x62, 0xe9, 0x01, 0x9c, 0x00, 0x15,
+	     0x5c, 0xd2, 0x54, 0x16, 0xcd, 0x03, 0x4c, 0xd5, 0x0b, 0x38,
+	     0xd0, 0x00, 0x67, 0x14, 0x40, 0x46, 0xd9, 0x0a, 0x13, 0xf1,
+	     0xbb, 0x8a, 0x35, 0x27, 0x93, 0x38, 0x5c, 0x00, 0x4a, 0xca,
+	     0x5e, 0xfe, 0xec, 0x95, 0x50, 0x2f, 0xc7, 0xfa, 0x02, 0x2a,
+	     0x60, 0x33, 0x70, 0x1b, 0x69, 0x2c, 0x01, 0x34, 0xc0, 0xe0,
+	     0xc3, 0x83, 0xd3, 0x6e, 0x22, 0x80, 0xb3, 0x64, 0x04, 0xc8,
+	     0x95, 0xcd, 0x0a, 0x11, 0xd4, 0x03, 0x00, 0x82, 0x80, 0x65,
+	     0xf6, 0x8f, 0x01, 0x38, 0x45, 0xbb, 0xc9, 0x9e, 0x14, 0x02,
+	     0xe8, 0x23, 0x00, 0x4f, 0x50, 0x3f, 0xb8, 0x46, 0x4a, 0x19,
+	     0x35, 0x36, 0x5c, 0x1e, 0x8d, 0xf2, 0x51, 0x3c, 0x76, 0x0e,
+	     0x99, 0x39, 0x2c, 0xcb, 0x6d, 0x1a, 0xf1, 0xd5, 0x3f, 0xbc,
+	     0x45, 0x85, 0x7a, 0x8c, 0x7c, 0x1a, 0xd8, 0x75, 0x75, 0x82,
+	     0xd1, 0xad, 0x63, 0x57, 0xad, 0xfa, 0x1d, 0x80, 0x15, 0xc6,
+	     0x52, 0xb7, 0xe7, 0x0c, 0x1b, 0x20, 0xab, 0x68, 0x6a, 0x13,
+	     0xa0, 0xd8, 0x61, 0x26, 0x51, 0x8a, 0xb4, 0x02, 0x60, 0xef,
+	     0x00, 0x26, 0x80, 0x53, 0x9a, 0x1e, 0x52, 0x0f, 0x84, 0x59,
+	     0x0b, 0x00, 0x0a, 0xd8, 0xc7, 0x1f, 0x03, 0x41, 0xeb, 0x67,
+	     0x97, 0x01, 0x30, 0x86, 0x33, 0x24, 0x01, 0x58, 0x9c, 0x29,
+	     0x78, 0x4f, 0xa6, 0x0d, 0x50, 0xef, 0x01, 0x37, 0x25, 0x4b,
+	     0x9d, 0x21, 0x34, 0x48, 0x5b, 0x40, 0xb9, 0x68, 0xda, 0xd0,
+	     0x9a, 0x59, 0x59, 0xe3, 0x1b, 0x37, 0xe4, 0xdf, 0x9d, 0x49,
+	     0x0d, 0x90, 0x2d, 0x01, 0x00, 0x80, 0x08, 0x1c, 0x80, 0x2d,
+	     0x60, 0xc1, 0xa6, 0x04, 0xc0, 0xe2, 0x45, 0x80, 0xc9, 0x00,
+	     0x09, 0xae, 0x7e, 0x54, 0xef, 0x00, 0x80, 0x4b, 0xfc, 0x00,
+	     0xb0, 0x19, 0x28, 0x01, 0x00, 0x6d, 0xd5, 0x00, 0xe9, 0x01,
+	     0xb8, 0x07, 0xc0, 0x02, 0xe0, 0x02, 0x08, 0x00, 0x40, 0xa6,
+	     0x0d, 0xf8, 0x01, 0x6a, 0x0c, 0xc0, 0xee, 0x62, 0xbd, 0xe3,
+	     0x2c, 0xe2, 0xc5, 0x57, 0x06, 0x10, 0x1b, 0x0c, 0x04, 0x00,
+	     0x40, 0x19, 0xc2, 0x01, 0x26, 0x00, 0x40, 0x4e, 0x69, 0x14,
+	     0x03, 0x10, 0x82, 0x8a, 0x38, 0x9f, 0xfc, 0x93, 0x00, 0x19,
+	     0x10, 0x20, 0xcf, 0x05, 0x24, 0x98, 0x00, 0x50, 0x05, 0x10,
+	     0x03, 0x00, 0x00, 0x70, 0x7a, 0xda, 0x07, 0xa0, 0xed, 0xd0,
+	     0xbb, 0x9b, 0x07, 0x40, 0x05, 0x94, 0x96, 0x72, 0x1d, 0x00,
+	     0xb0, 0x33, 0x03, 0x9c, 0x09, 0x40, 0x9c, 0x46, 0x3a, 0x02,
+	     0x00, 0x69, 0x10, 0x22, 0x6e, 0x01, 0xd4, 0x00, 0xa1, 0x2f,
+	     0x40, 0xcc, 0x05, 0x24, 0x26, 0x00, 0xe5, 0xa9, 0x38, 0xbe,
+	     0xff, 0x6c, 0x66, 0x40, 0x7a, 0x75, 0xa2, 0x0c, 0x1d, 0x9b,
+	     0x01, 0xa0, 0xda, 0x02, 0x94, 0x9b, 0x80, 0x1c, 0x00, 0x00,
+	     0xb0, 0x58, 0x32, 0x00, 0x2e, 0x00, 0x00, 0xb8, 0x2e, 0x7f,
+	     0x6e, 0x16, 0x0f, 0x40, 0x48, 0xc3, 0xe4, 0xf1, 0x77, 0x0b,
+	     0x80, 0xdb, 0x6e, 0xb5, 0xc4, 0xb4, 0x24, 0x01, 0x08, 0x1f,
+	     0x6d, 0x61, 0x22, 0x1c, 0x10, 0x23, 0x7f, 0x45, 0x95, 0x09,
+	     0x80, 0xbb, 0x29, 0x76, 0x00, 0xbd, 0x6c, 0x60, 0x2a, 0x03,
+	     0x00, 0x92, 0x17, 0x00, 0xbb, 0xdc, 0x92, 0x00, 0xa2, 0x34,
+	     0x33, 0xe0, 0xe6, 0x32, 0x9f, 0x75, 0xd3, 0x91, 0x0b, 0x2d,
+	     0xc3, 0x01, 0xec, 0x80, 0x24, 0x62, 0x4d, 0x41, 0x01, 0x84,
+	     0x4b, 0xc0, 0xd5, 0x05, 0x90, 0xc7, 0x26, 0x4b, 0xb6, 0x0e,
+	     0x20, 0xdf, 0x0e, 0x50, 0xf5, 0x2b, 0x6e, 0x6a, 0x4e, 0xf0,
+	     0xf4, 0x17, 0x40, 0xb7, 0x2e, 0xb0, 0xc7, 0xb0, 0x73, 0x80,
+	     0xdb, 0xb7, 0xd6, 0xd6, 0x89, 0xb9, 0xe7, 0x05, 0x20, 0x01,
+	     0x88, 0x01, 0x26, 0x1e, 0xe0, 0xfb, 0xb5, 0x94, 0x8a, 0x16,
+	     0x00, 0x39, 0x01, 0x45, 0x98, 0x01, 0x78, 0xc0, 0x4a, 0x09,
+	     0x00, 0x70, 0x00, 0x00, 0xd2, 0xcf, 0x45, 0x00, 0xc8, 0x00,
+	     0x00, 0x32, 0xc0, 0x5c, 0x00, 0xc8, 0x17, 0x80, 0x13, 0x15,
+	     0x0a, 0xe8, 0xe0, 0x1c, 0x85, 0x1c, 0xe0, 0xd6, 0x53, 0x6f,
+	     0x01, 0xf0, 0x0f, 0x40, 0xa0, 0x91, 0x02, 0x68, 0xcc, 0xef,
+	     0x99, 0x96, 0x70, 0x01, 0x6c, 0xf4, 0x35, 0x80, 0x02, 0x08,
+	     0xa0, 0x5e, 0x00, 0x0a, 0x08, 0x08, 0x88, 0x20, 0xa1, 0x00,
+	     0x80, 0x66, 0xc3, 0x14, 0xe9, 0x95, 0x00, 0x40, 0x2e, 0xf4,
+	     0xd0, 0x23, 0xf4, 0xe3, 0x77, 0x11, 0x10, 0x3a, 0x6f, 0xd0,
+	     0x63, 0x34, 0x7e, 0x22, 0x03, 0x00, 0x5a, 0x53, 0xc8, 0xb8,
+	     0xca, 0x60, 0x6c, 0x21, 0xa6, 0x3a, 0x00, 0xd6, 0xe4, 0x00,
+	     0x7a, 0x7f, 0xc0, 0x2f, 0xf3, 0xf9, 0xe6, 0x03, 0x2c, 0x13,
+	     0x98, 0x4d, 0x07, 0xc0, 0x01, 0x7f, 0x78, 0xe9, 0x11, 0xdc,
+	     0x03, 0x6e, 0x50, 0x19, 0xc0, 0x85, 0x04, 0x00, 0x00, 0x71,
+	     0x39, 0xc0, 0x3c, 0xd3, 0xc4, 0x04, 0xe8, 0x24, 0xe0, 0x3c,
+	     0x35, 0xc4, 0xea, 0x52, 0xeb, 0xc5, 0xec, 0x05, 0x2c, 0x2a,
+	     0x57, 0x06, 0xbb, 0x24, 0xfb, 0x0e, 0xf3, 0x16, 0x0b, 0xdc,
+	     0xf7, 0x55, 0x2f, 0x82, 0x0d, 0x88, 0xba, 0x11, 0x69, 0x1e,
+	     0x01, 0x80, 0xf5, 0xec, 0x6a, 0x9e, 0xf7, 0xef, 0x95, 0xe4,
+	     0xfb, 0x07, 0x00, 0x97, 0x39, 0xd4, 0x19, 0x6c, 0xa8, 0x0f,
+	     0xf7, 0xb1, 0x82, 0x0d, 0x60, 0x6c, 0x11, 0x43, 0xc8, 0x07,
+	     0x00, 0xa0, 0xf1, 0xa2, 0x2f, 0x75, 0x15, 0x40, 0x26, 0x8b,
+	     0x57, 0x3b, 0xaf, 0x94, 0x8a, 0x0c, 0x40, 0xd0, 0x02, 0x90,
+	     0x8c, 0x71, 0xb2, 0x0d, 0x50, 0xb1, 0xa5, 0xff, 0xc6, 0xb7,
+	     0x4b, 0x11, 0xab, 0xe0, 0xb8, 0x17, 0xe0, 0xb1, 0x9c, 0xa6,
+	     0x89, 0x7c, 0x1d, 0x20, 0xeb, 0x23, 0x98, 0x5b, 0x50, 0xc0,
+	     0x9d, 0xfd, 0x07, 0xb4, 0x97, 0x4c, 0x6a, 0x29, 0x90, 0x64,
+	     0x63, 0x03, 0x5b, 0xc0, 0x9a, 0xbb, 0x29, 0x57, 0x87, 0xe1,
+	     0x33, 0xc0, 0xfc, 0x04, 0xac, 0xdd, 0xb7, 0x10, 0xc0, 0x0b,
+	     0x69, 0x03, 0x30, 0x3c, 0x80, 0x12, 0xc6, 0xff, 0xf4, 0x47,
+	     0x37, 0x00, 0x0a, 0x60, 0x1c, 0x09, 0xba, 0x16, 0x09, 0xa0,
+	     0x06, 0xc0, 0x9a, 0x01, 0xf5, 0x80, 0x18, 0xd0, 0x23, 0x03,
+	     0xb2, 0x80, 0xa2, 0xb7, 0xc7, 0x47, 0x03, 0x52, 0x00, 0x00,
+	     0x83, 0xda, 0xd3, 0xa2, 0xcb, 0x14, 0x88, 0x98, 0xcd, 0x04,
+	     0x6c, 0xc0, 0x05, 0x52, 0x7b, 0xaa, 0xff, 0x01, 0xc8, 0x50,
+	     0xc0, 0x73, 0x03, 0x28, 0xe7, 0x01, 0x75, 0x0f, 0xa0, 0xe6,
+	     0x06, 0x00, 0xc0, 0x18, 0x16, 0xdb, 0x5b, 0x01, 0x00, 0x0c,
+	     0xd5, 0xbc, 0x0d, 0xb0, 0xec, 0x6d, 0xf3, 0x30, 0x80, 0x2c,
+	     0x7f, 0x7d, 0x92, 0xc8, 0x20, 0x16, 0xda, 0x0f, 0x50, 0xe3,
+	     0x8b, 0x8d, 0x88, 0xae, 0xa6, 0x87, 0x4b, 0xb6, 0x00, 0x00,
+	     0xe2, 0x6f, 0xc0, 0x07, 0x4f, 0xc6, 0x0b, 0x95, 0x0e, 0x50,
+	     0xf4, 0x9b, 0x4f, 0x16, 0x00, 0x85, 0xc6, 0x40, 0xa6, 0x42,
+	     0x1c, 0xe0, 0xdd, 0xa7, 0x1d, 0xe4, 0xf8, 0x7e, 0x93, 0x23,
+	     0x9c, 0xba, 0x00, 0x5d, 0xc0, 0x96, 0xfc, 0x17, 0x00, 0x5d,
+	     0x78, 0x34, 0x1a, 0x09, 0x38, 0x0c, 0xb6, 0x3f, 0x55, 0x5c,
+	     0xfb, 0x9f, 0xc1, 0x01, 0x1e, 0x61, 0x76, 0x32, 0x8e, 0x01,
+	     0x4c, 0x59, 0xa3, 0xde, 0xa4, 0x55, 0xec, 0x76, 0x4d, 0x12,
+	     0xc5, 0x36, 0x39, 0x48, 0x54, 0x86, 0x2a, 0x7e, 0xc0, 0x00,
+	     0x34, 0xff, 0x2e, 0x66, 0x1a, 0xd0, 0x06, 0x94, 0xd6, 0x5b,
+	     0x2f, 0x8b, 0x64, 0x2c, 0x49, 0x00, 0x6c, 0xa0, 0xfa, 0x25,
+	     0xfe, 0xf1, 0xaf, 0x80, 0xd9, 0x03, 0x75, 0xa2, 0x3a, 0x37,
+	     0xed, 0x10, 0xb6, 0xe8, 0x32, 0xd4, 0x7f, 0xbd, 0xef, 0x33,
+	     0xe5, 0xc9, 0x51, 0xc4, 0x89, 0x14, 0xc0, 0xe7, 0x02, 0x00,
+	     0x4a, 0x00, 0x27, 0x00, 0x80, 0x6e, 0x40, 0x86, 0x10, 0xc0,
+	     0x2f, 0x0d, 0xd8, 0x02, 0x00, 0x00, 0x00, 0x80, 0x74, 0x06,
+	     0x00, 0x1e, 0xe2, 0x2f, 0xc0, 0x4c, 0x6e, 0xf3, 0x32, 0x91,
+	     0xac, 0x8b, 0xb9, 0x01, 0xc8, 0x45, 0x81, 0xa8, 0x82, 0xa7,
+	     0x96, 0xa9, 0xa7, 0x04, 0xbb, 0xf7, 0x0f, 0x28, 0x8b, 0x68,
+	     0x5c, 0x10, 0x37, 0x01, 0xc0, 0x02, 0x00, 0x61, 0xcb, 0x28,
+	     0x02, 0x03, 0xd8, 0x6c, 0x0f, 0x40, 0xf6, 0xdd, 0x2f, 0xe7,
+	     0x18, 0x46, 0x08, 0xe6, 0x26, 0xaf, 0x03, 0x10, 0xca, 0x1d,
+	     0x05, 0x00, 0x00, 0xd0, 0x8c, 0x28, 0xec, 0x0f, 0x60, 0x15,
+	     0x11, 0x24, 0x29, 0xc6, 0xfe, 0x51, 0x14, 0x3f, 0xb8, 0x39,
+	     0x80, 0xf3, 0x0d, 0x18, 0xd4, 0x5a, 0x52, 0x00, 0x1d, 0x30,
+	     0x61, 0x00, 0xa8, 0x4c, 0x05, 0x00, 0x19, 0xf0, 0xce, 0x18,
+	     0x00, 0x7d, 0x39, 0xa0, 0xed, 0xbe, 0x9a, 0x80, 0x8e, 0xbe,
+	     0xb8, 0x29, 0x90, 0xbc, 0x80, 0x9f, 0x4c, 0x43, 0xef, 0x00,
+	     0x04, 0x00, 0xa2, 0x17, 0xfc, 0xe2, 0x02, 0xee, 0xe6, 0x37,
+	     0x20, 0x63, 0xf8, 0x5c, 0xd7, 0x9b, 0x16, 0x00, 0x70, 0xd7,
+	     0x14, 0x3c, 0x7b, 0xaa, 0xb6, 0x0b, 0x00, 0xb0, 0x66, 0x4d,
+	     0xb5, 0xc8, 0x05, 0x30, 0x48, 0xcd, 0xb1, 0x86, 0xf0, 0x7f,
+	     0xca, 0xa0, 0x0d, 0xb4, 0x94, 0x84, 0x47, 0xee, 0xdd, 0x14,
+	     0x48, 0x40, 0x5c, 0xf9, 0xb6, 0x51, 0xf7, 0x59, 0xc0, 0x11,
+	     0x01, 0x98, 0xbe, 0x01, 0x8d, 0x2d, 0x20, 0xf9, 0x82, 0xe5,
+	     0xd3, 0x3d, 0x00, 0xe4, 0x09, 0x40, 0x03, 0x04, 0x3f, 0xc6,
+	     0x57, 0xc8, 0x78, 0x0e, 0x46, 0x8e, 0x17, 0x00, 0x40, 0xb4,
+	     0x72, 0x1d, 0x23, 0xf4, 0x40, 0x7f, 0x9f, 0x01, 0x00, 0x80,
+	     0x62, 0xc5, 0x0f, 0x04, 0xa8, 0x8a, 0x0b, 0x40, 0x7c, 0xa4,
+	     0x57, 0x5d, 0xb8, 0xb8, 0xa7, 0x48, 0x98, 0x03, 0xf4, 0x01,
+	     0x3a, 0x25, 0xe0, 0xa8, 0xc0, 0xb7, 0x01, 0x2e, 0x80, 0x16,
+	     0x20, 0xbf, 0x4c, 0x24, 0x48, 0x9b, 0x5b, 0x07, 0x5d, 0x33,
+	     0xd5, 0x24, 0xa2, 0x6c, 0xcf, 0x3c, 0x01, 0x6e, 0xc2, 0x85,
+	     0x6e, 0x4e, 0xc5, 0x02, 0x2c, 0xe9, 0xe3, 0x41, 0xdc, 0x00,
+	     0xce, 0x01, 0x1d, 0xed, 0x10, 0x42, 0xc6, 0x80, 0x9c, 0x28,
+	     0xb8, 0x7f, 0x88, 0x01, 0x58, 0x1c, 0x00, 0x22, 0x80, 0x07,
+	     0x13, 0x34, 0x01, 0xa6, 0xe6, 0x81, 0x52, 0xf7, 0x6c, 0x0f,
+	     0xd1, 0xf9, 0x87, 0xdc, 0x03, 0xd4, 0xa0, 0x68, 0x00, 0xb0,
+	     0x0b, 0x00, 0x48, 0x59, 0x00, 0xbd, 0x22, 0x4e, 0xe7, 0xb8,
+	     0x0c, 0xc5, 0x0e, 0xbe, 0x0b, 0xc8, 0x01, 0x5e, 0x20, 0x38,
+	     0x20, 0x0c, 0xe9, 0xd7, 0xbb, 0x54, 0xc0, 0xd4, 0x89, 0x65,
+	     0x09, 0x4c, 0xae, 0xa1, 0x0e, 0x30, 0xa1, 0x13, 0xd2, 0xde,
+	     0xf4, 0x7e, 0xa6, 0xe6, 0x53, 0xb1, 0x80, 0x27, 0x60, 0x75,
+	     0xd1, 0xd0, 0x62, 0x00, 0x94, 0x54, 0x99, 0x04, 0x46, 0x2d,
+	     0xdd, 0x36, 0xc0, 0x5e, 0xde, 0x1b, 0x74, 0x42, 0xa9, 0x1a,
+	     0x00, 0x20, 0x4a, 0x51, 0x80, 0xf4, 0xfd, 0x7c, 0x3b, 0xab,
+	     0x00, 0x80, 0xd7, 0x3c, 0xa0, 0x1b, 0x43, 0x31, 0x29, 0x80,
+	     0xc6, 0x09, 0x00, 0x28, 0x7f, 0x04, 0x1e, 0x16, 0x00, 0xe3,
+	     0x12, 0xe8, 0xfe, 0xc9, 0xec, 0x04, 0x50, 0x12, 0xad, 0x80,
+	     0x99, 0xa5, 0xc7, 0x01, 0x48, 0x59, 0x00, 0x01, 0x0f, 0x53,
+	     0xc8, 0x03, 0x54, 0x57, 0xed, 0x1a, 0x9d, 0x89, 0xf7, 0x1e,
+	     0x2b, 0xa3, 0xef, 0x5d, 0x7f, 0x01, 0x00, 0x18, 0x1d, 0xc8,
+	     0x8d, 0x2d, 0xa3, 0x00, 0x6a, 0x01, 0xa0, 0x6c, 0xad, 0x54,
+	     0x5b, 0x35, 0x34, 0xb4, 0xbb, 0xd2, 0x6f, 0x9c, 0x2a, 0x93,
+	     0xc2, 0x56, 0x1b, 0x33, 0x25, 0xdf, 0x0c, 0x00, 0x70, 0x42,
+	     0x37, 0x00, 0x80, 0x16, 0x92, 0xce, 0x8c, 0xff, 0xcf, 0x27,
+	     0x2c, 0xc6, 0x02, 0xe0, 0x02, 0x00, 0xce, 0xf8, 0x0f, 0x89,
+	     0x01, 0x4c, 0xe8, 0x9f, 0xf6, 0x32, 0xb0, 0xc5, 0x7b, 0x00,
+	     0x7d, 0x2a, 0xc9, 0x43, 0xf7, 0xa1, 0x0e, 0x7d, 0x00, 0x60,
+	     0x9c, 0xdb, 0xcb, 0x96, 0x5d, 0x80, 0x1a, 0x40, 0x38, 0x58,
+	     0x01, 0x66, 0x30, 0x11, 0x00, 0x00, 0x30, 0xec, 0xd1, 0x0c,
+	     0x9a, 0x8f, 0xd3, 0xc9, 0xb2, 0x23, 0x42, 0x93, 0x91, 0x3d,
+	     0x52, 0xe3, 0x00, 0xec, 0xfa, 0x6a, 0xf9, 0x96, 0x0d, 0x33,
+	     0x07, 0x00, 0x00, 0x29, 0x68, 0x4b, 0x80, 0x15, 0xcc, 0x07,
+	     0xd8, 0xd4, 0x00, 0x00, 0x00, 0x4b, 0x5f, 0x11, 0xc1, 0xbf,
+	     0x85, 0xbc, 0x14, 0x13, 0x88, 0xb9, 0xc7, 0x8f, 0x11, 0x60,
+	     0x07, 0xf8, 0xf3, 0x72, 0x91, 0xd8, 0x2c, 0x89, 0x7d, 0x24,
+	     0x01, 0x77, 0x00, 0x60, 0x89, 0x8e, 0x57, 0x3d, 0x45, 0x80,
+	     0x39, 0xe1, 0x5b, 0x08, 0x83, 0x00, 0x1c, 0x28, 0x73, 0x38,
+	     0x02, 0x74, 0x80, 0x0a, 0x14, 0x40, 0x09, 0x33, 0xf1, 0x3d,
+	     0x18, 0x60, 0x09, 0x98, 0xd2, 0x01, 0xa6, 0x94, 0xfa, 0x6e,
+	     0x67, 0x03, 0x20, 0x48, 0x75, 0x6b, 0x6e, 0xd3, 0x00, 0x76,
+	     0xd0, 0xec, 0x5b, 0x7f, 0x50, 0x89, 0x01, 0x00, 0x72, 0x27,
+	     0x71, 0xad, 0x26, 0x36, 0x02, 0x9e, 0x9f, 0x46, 0x02, 0x11,
+	     0xfd, 0x5b, 0x09, 0xf0, 0x7c, 0x1e, 0x2f, 0xda, 0x80, 0x1b,
+	     0x40, 0xf9, 0xbc, 0x03, 0x2c, 0x76, 0x00, 0x60, 0x1b, 0x0b,
+	     0xbb, 0x7d, 0x7c, 0xc0, 0x17, 0x9d, 0x1f, 0x0d, 0x00, 0x2a,
+	     0x80, 0x9a, 0x6e, 0xfd, 0x00, 0x60, 0x1f, 0x57, 0x65, 0xda,
+	     0x02, 0x00, 0x00, 0xa7, 0x80, 0xb5, 0x0d, 0x00, 0xc8, 0xbb,
+	     0xf6, 0x0d, 0x00, 0xb0, 0x00, 0xf0, 0x2f, 0x00, 0x4d, 0xb9,
+	     0x41, 0x05, 0xd0, 0xba, 0x37, 0x42, 0x16, 0x01, 0xa0, 0x70,
+	     0x96, 0xf8, 0xa8, 0x5c, 0x33, 0x04, 0xf7, 0x8c, 0x41, 0x09,
+	     0x5b, 0x26, 0x00, 0xb0, 0x6c, 0x1d, 0x66, 0xb5, 0xcd, 0x1d,
+	     0x8f, 0x0f, 0x59, 0x23, 0xa0, 0x02, 0x00, 0x00, 0x94, 0x2d,
+	     0xe5, 0x17, 0x74, 0xaa, 0xc3, 0xf2, 0x47, 0x18, 0x80, 0xc9,
+	     0x34, 0x33, 0x00, 0xe7, 0xa5, 0xa1, 0x09, 0x80, 0xe8, 0xa0,
+	     0xdb, 0x3b, 0xe0, 0xea, 0x61, 0x1b, 0x28, 0x05, 0x1b, 0xea,
+	     0x3d, 0xec, 0xed, 0x9f, 0x23, 0xa0, 0x12, 0x0a, 0x60, 0x88,
+	     0x01, 0x05, 0x00, 0x00, 0x90, 0x0b, 0x03, 0xbc, 0x80, 0x80,
+	     0x7a, 0x26, 0x47, 0x7a, 0x01, 0x5c, 0x67, 0x0e, 0x50, 0x9e,
+	     0xd9, 0x01, 0x86, 0x9d, 0xb5, 0x04, 0xa0, 0x01, 0xf6, 0xef,
+	     0x71, 0x11, 0xf0, 0x15, 0x00, 0xdc, 0x00, 0x17, 0x48, 0xa2,
+	     0xbb, 0x02, 0xe6, 0x77, 0x00, 0x00, 0x90, 0x02, 0xfc, 0x19,
+	     0x00, 0x40, 0x7a, 0x4c, 0x64, 0x98, 0x00, 0xc7, 0x82, 0x7e,
+	     0x09, 0xf0, 0x64, 0xf9, 0x26, 0x74, 0x6c, 0xa3, 0x53, 0x66,
+	     0x01, 0x76, 0xc0, 0x18, 0x80, 0x35, 0xa4, 0x68, 0xf4, 0x5f,
+	     0x04, 0x10, 0x5b, 0x01, 0x7e, 0xf5, 0x5b, 0x17, 0x10, 0x3d,
+	     0x24, 0xe9, 0x3e, 0xfb, 0x68, 0x25, 0xc6, 0xe9, 0x00, 0x98,
+	     0xfb, 0xf8, 0x14, 0x38, 0x0d, 0xa7, 0x8d, 0xa7, 0x3d, 0xf7,
+	     0xbf, 0xfd, 0xe7, 0x7e, 0x0b, 0x14, 0x4d, 0x83, 0xeb, 0x2d,
+	     0x58, 0xd9, 0x18, 0xa2, 0x2f, 0x00, 0xa0, 0x5e, 0xf5, 0xf5,
+	     0x0c, 0x18, 0x3a, 0xf0, 0x07, 0xc8, 0x15, 0xb0, 0x41, 0x94,
+	     0x98, 0x3b, 0xee, 0xcc, 0x9b, 0xba, 0xed, 0x97, 0xd1, 0xff,
+	     0x65, 0x40, 0x02, 0x88, 0x5b, 0x19, 0x80, 0x09, 0x60, 0x49,
+	     0x57, 0x01, 0xb8, 0x8a, 0x8a, 0xd3, 0xc6, 0xcd, 0x46, 0xcb,
+	     0xf7, 0xc6, 0xef, 0x04, 0x08, 0xb0, 0x5c, 0x03, 0x80, 0x6b,
+	     0xe9, 0x0e, 0x36, 0xf0, 0x06, 0xf3, 0x1a, 0x04, 0xb8, 0xc7,
+	     0x00, 0xed, 0x6b, 0x76, 0x43, 0xef, 0xc9, 0x2e, 0x80, 0x33,
+	     0x0b, 0x88, 0xe8, 0x20, 0xad, 0x08, 0x00, 0x40, 0x70, 0x58,
+	     0x2d, 0xe4, 0x25, 0xf8, 0x50, 0x6e, 0x75, 0x9d, 0x37, 0x40,
+	     0xed, 0x35, 0x1f, 0x43, 0xf5, 0x0a, 0xeb, 0x7b, 0xdc, 0xc9,
+	     0x00, 0x00, 0x26, 0x94, 0xb9, 0xbd, 0xae, 0x54, 0x51, 0xc6,
+	     0x2f, 0x80, 0x80, 0xc7, 0x5d, 0x89, 0x9f, 0xfd, 0xed, 0x7d,
+	     0xbb, 0xec, 0x56, 0x30, 0xc0, 0x1b, 0x40, 0x6d, 0x8a, 0x53,
+	     0x00, 0x09, 0xb3, 0x64, 0x01, 0x00, 0x24, 0xc6, 0xff, 0x41,
+	     0x2b, 0x4d, 0xb4, 0xfb, 0xaa, 0x35, 0x20, 0xf0, 0xae, 0xe2,
+	     0x89, 0x9b, 0xc5, 0x11, 0xb0, 0x8d, 0x59, 0xa2, 0x80, 0xa4,
+	     0x17, 0x36, 0x07, 0x06, 0xb4, 0x78, 0x5d, 0xb3, 0x01, 0x9a,
+	     0x17, 0x5b, 0x59, 0x40, 0xc8, 0xe4, 0x40, 0x8d, 0x00, 0x79,
+	     0x80, 0x1a, 0xe4, 0x6f, 0xf2, 0xec, 0x77, 0x40, 0x5e, 0xd1,
+	     0xfe, 0x19, 0x72, 0xd2, 0x16, 0xf5, 0x09, 0x88, 0xab, 0xc1,
+	     0x61, 0x00, 0xc3, 0x11, 0x64, 0xfd, 0x20, 0xe1, 0xb3, 0xe7,
+	     0xfe, 0x00, 0x60, 0xc0, 0x5d, 0x00, 0x00, 0xba, 0xf4, 0xc0,
+	     0xf8, 0x9a, 0xac, 0x01, 0x72, 0x04, 0x24, 0xb8, 0x5f, 0x62,
+	     0x3e, 0x06, 0x68, 0xa5, 0xef, 0x00, 0x36, 0xa0, 0x46, 0x9a,
+	     0xe2, 0x04, 0x00, 0x42, 0x45, 0x69, 0x0f, 0x46, 0x01, 0x61,
+	     0x61, 0x41, 0x02, 0x18, 0x00, 0xe8, 0xe8, 0xfd, 0x10, 0x90,
+	     0x84, 0x95, 0x64, 0x6c, 0x40, 0x42, 0x11, 0x03, 0xf8, 0x01,
+	     0x00, 0xc0, 0x70, 0x8a, 0x63, 0x03, 0x00, 0x68, 0x0e, 0xe0,
+	     0x3c, 0x42, 0xd7, 0xd0, 0x0b, 0x00, 0xe0, 0xd4, 0xe6, 0x53,
+	     0xd5, 0xae, 0xda, 0x6e, 0x40, 0x1c, 0xed, 0x9f, 0x00, 0xdf,
+	     0x04, 0xc0, 0x90, 0xfc, 0x1f, 0xe7, 0xa8, 0x53, 0xed, 0x04,
+	     0x04, 0x11, 0xac, 0x17, 0x00, 0x60, 0x02, 0x00, 0x00, 0x79,
+	     0xf3, 0x11, 0xf0, 0x4f, 0xc0, 0x96, 0xfb, 0xd1, 0x16, 0xb0,
+	     0x53, 0x76, 0x63, 0x00, 0x3f, 0x60, 0xeb, 0xb5, 0x47, 0x14,
+	     0xbf, 0x30, 0x13, 0x50, 0xf3, 0x93, 0x8e, 0x8d, 0x74, 0x1e,
+	     0x57, 0x91, 0xf9, 0x49, 0x96, 0xc5, 0xd9, 0x45, 0x03, 0xe0,
+	     0x4d, 0xe3, 0x82, 0x98, 0x65, 0x54, 0x6b, 0x00, 0xe5, 0xda,
+	     0x0e, 0x56, 0x06, 0x88, 0x98, 0x3c, 0xce, 0x1a, 0x40, 0x41,
+	     0x0f, 0xba, 0xfd, 0xb3, 0xb4, 0xba, 0x05, 0x28, 0x23, 0xf9,
+	     0x99, 0xc3, 0xf8, 0x32, 0x03, 0x00, 0x17, 0x0a, 0x40, 0xae,
+	     0x02, 0x80, 0x14, 0x7f, 0xed, 0xc7, 0x51, 0xa7, 0x03, 0xf6,
+	     0x6e, 0xe4, 0x83, 0x92, 0xeb, 0x7f, 0xce, 0x80, 0xed, 0x91,
+	     0x66, 0xbd, 0x02, 0x00, 0x66, 0x4e, 0x63, 0x0a, 0x00, 0x08,
+	     0x8a, 0xa2, 0x7c, 0x91, 0x5c, 0x03, 0x70, 0x0d, 0x86, 0x15,
+	     0xa0, 0x14, 0x43, 0x9b, 0x70, 0xf4, 0x40, 0x9d, 0x81, 0x23,
+	     0x74, 0x19, 0xdf, 0x1f, 0x03, 0x62, 0x07, 0xfc, 0x01, 0x7c,
+	     0xe3, 0x5d, 0xc0, 0xe2, 0x01, 0x96, 0xdd, 0xb9, 0x22, 0xbe,
+	     0x42, 0x05, 0x24, 0x6d, 0x57, 0x26, 0x68, 0xe6, 0x5c, 0x3e,
+	     0xf3, 0x97, 0x08, 0xd4, 0xad, 0xbe, 0x01, 0x3f, 0x63, 0x7d,
+	     0xf1, 0x97, 0xec, 0x5c, 0x10, 0xa8, 0x83, 0x0b, 0x50, 0x79,
+	     0x56, 0x33, 0x3f, 0x01, 0x01, 0xd0, 0x1b, 0xda, 0x41, 0x53,
+	     0x1d, 0xc1, 0x46, 0x8c, 0x20, 0x84, 0xbc, 0x1a, 0x45, 0xe0,
+	     0xe8, 0x79, 0x5c, 0x80, 0x4b, 0xbb, 0x02, 0xe8, 0x0e, 0x05,
+	     0xd8, 0xd3, 0x9d, 0x06, 0x48, 0xa9, 0x62, 0xc0, 0xb8, 0xe1,
+	     0xa6, 0xdb, 0x72, 0x17, 0x66, 0x35, 0x2f, 0xe8, 0x02, 0x0b,
+	     0x12, 0xc0, 0x1b, 0x85, 0x01, 0x74, 0x2a, 0xab, 0x19, 0x94,
+	     0x7b, 0xa9, 0x82, 0x00, 0x48, 0xf3, 0xa8, 0x7f, 0xf8, 0x01,
+	     0x82, 0x7c, 0x05, 0x62, 0xf1, 0x3a, 0xa5, 0x0c, 0xa8, 0x75,
+	     0xd6, 0x0f, 0x08, 0xaa, 0x01, 0x00, 0xe3, 0x5f, 0x3d, 0x01,
+	     0x7c, 0x01, 0x62, 0x3a, 0x1f, 0xd0, 0x2a, 0x61, 0x21, 0x9a,
+	     0xa9, 0xcd, 0x5b, 0x06, 0xf0, 0x99, 0x1d, 0x80, 0x64, 0x5c,
+	     0x0e, 0x4e, 0x01, 0x80, 0x92, 0xff, 0x80, 0xd0, 0xd5, 0x04,
+	     0x07, 0xc0, 0x21, 0x69, 0xc3, 0x97, 0x4f, 0x6e, 0x00, 0x63,
+	     0x0e, 0x88, 0x18, 0xb8, 0xe4, 0x08, 0xf8, 0xba, 0x51, 0xfb,
+	     0x76, 0x31, 0xee, 0x9b, 0x0e, 0xe8, 0xeb, 0x14, 0x50, 0x3f,
+	     0x36, 0x42, 0x06, 0x30, 0xb3, 0x48, 0x36, 0x16, 0x09, 0x00,
+	     0x00, 0x7a, 0x6b, 0x16, 0x1e, 0x08, 0x58, 0xbc, 0xeb, 0x20,
+	     0x31, 0x00, 0x80, 0x0a, 0x39, 0x01, 0x53, 0xb0, 0x11, 0x09,
+	     0x36, 0x55, 0x66, 0x80, 0x14, 0x86, 0x61, 0x07, 0x9c, 0x01,
+	     0xb5, 0x27, 0xbf, 0xf1, 0xd6, 0x12, 0x58, 0x41, 0xf8, 0x21,
+	     0x22, 0x01, 0x02, 0xb6, 0x12, 0xbd, 0xcb, 0x7b, 0x3d, 0x5e,
+	     0x8b, 0xdd, 0xf0, 0x03, 0x0f, 0x00, 0xf4, 0xe1, 0xa4, 0x57,
+	     0xe6, 0x35, 0x04, 0x88, 0x0d, 0xd4, 0x3e, 0x00, 0x00, 0x28,
+	     0x01, 0x8e, 0x02, 0x8c, 0x45, 0xe3, 0x15, 0xcf, 0xee, 0x58,
+	     0x40, 0x93, 0x04, 0xd8, 0xe8, 0x89, 0x72, 0xc0, 0x83, 0xdf,
+	     0x01, 0x3c, 0x00, 0x35, 0xb3, 0x7f, 0x20, 0x9e, 0x91, 0xa0,
+	     0x00, 0x85, 0x70, 0x52, 0xac, 0xdd, 0x1e, 0xf6, 0x85, 0xa7,
+	     0xb1, 0x35, 0x36, 0xf4, 0xf9, 0x27, 0x35, 0x2f, 0x07, 0x00,
+	     0x5e, 0xbd, 0x3f, 0x46, 0x8c, 0xcd, 0x02, 0xda, 0x27, 0x80,
+	     0xd4, 0xbe, 0x22, 0x8a, 0x01, 0xdd, 0xa6, 0xbe, 0x9e, 0x00,
+	     0x00, 0x66, 0x54, 0x94, 0xe3, 0x02, 0x60, 0xb7, 0x01, 0x35,
+	     0x1d, 0x60, 0x7d, 0x4b, 0x56, 0x3c, 0x00, 0x30, 0xf6, 0xa1,
+	     0x46, 0x02, 0x7a, 0x31, 0xf0, 0xb2, 0x8e, 0xac, 0x7a, 0x9a,
+	     0x8c, 0x15, 0xa5, 0x00, 0x18, 0x89, 0xc8, 0x00, 0x40, 0xc5,
+	     0xf6, 0x73, 0x67, 0x4c, 0xb3, 0x29, 0x40, 0xbb, 0x03, 0xdc,
+	     0x2c, 0x56, 0x7a, 0x4f, 0x84, 0x01, 0xfa, 0x2d, 0x08, 0x16,
+	     0xa0, 0x06, 0x48, 0x9d, 0xe3, 0x80, 0x1e, 0x60, 0x75, 0x96,
+	     0xc3, 0x3b, 0x55, 0x29, 0x20, 0xaf, 0x06, 0x00, 0x84, 0x40,
+	     0xc4, 0x69, 0x06, 0xfe, 0xb4, 0x98, 0x7a, 0x1e, 0xa4, 0x47,
+	     0x10, 0x03, 0x1a, 0xd8, 0xe7, 0xb6, 0x0b, 0x4d, 0x8e, 0x79,
+	     0x00, 0x21, 0xbb, 0xe3, 0x0f, 0xd1, 0xc3, 0x6b, 0x4c, 0x19,
+	     0x97, 0x14, 0x18, 0x90, 0x51, 0xe3, 0x26, 0x00, 0x70, 0x01,
+	     0x86, 0x80, 0x0b, 0x55, 0x0b, 0x20, 0xa8, 0x96, 0x57, 0xc8,
+	     0xf4, 0xf0, 0xa3, 0xd6, 0xee, 0x1a, 0x00, 0x20, 0x5d, 0xe5,
+	     0x8c, 0x75, 0x24, 0x36, 0x7d, 0x77, 0x46, 0x01, 0x38, 0xaf,
+	     0x8d, 0x94, 0x0d, 0x00, 0x94, 0xd6, 0xcb, 0x5b, 0x11, 0x0b,
+	     0x08, 0x08, 0x56, 0x00, 0xd1, 0xb3, 0x05, 0xe0, 0xee, 0xc2,
+	     0x1b, 0xdc, 0x10, 0x63, 0x3a, 0x63, 0x89, 0x28, 0xc0, 0xd1,
+	     0xe8, 0x8f, 0x58, 0x5c, 0x4b, 0x76, 0xd8, 0x89, 0xa3, 0x62,
+	     0xa1, 0x49, 0x03, 0xe6, 0x03, 0x70, 0x5c, 0xb2, 0xb4, 0x88,
+	     0xf0, 0xbd, 0xa6, 0x01, 0x46, 0xa4, 0xa9, 0xc7, 0x3a, 0x66,
+	     0x95, 0xb6, 0x00, 0x6e, 0x66, 0x6f, 0xea, 0x03, 0xa0, 0xbb,
+	     0xb7, 0xe2, 0x2e, 0x52, 0x78, 0xcb, 0x7a, 0x1a, 0xfe, 0x2f,
+	     0x90, 0xae, 0x11, 0x42, 0x78, 0xe4, 0x4a, 0x87, 0xb6, 0x00,
+	     0x26, 0x1f, 0xac, 0x0e, 0x9e, 0x03, 0x80, 0x80, 0x10, 0xa0,
+	     0x0b, 0xf0, 0xa5, 0x1d, 0x64, 0x40, 0x17, 0x08, 0x98, 0xa1,
+	     0x70, 0x8d, 0xa5, 0x08, 0xa0, 0x85, 0x02, 0xbe, 0x16, 0xc0,
+	     0x22, 0x08, 0x78, 0x16, 0x98, 0x00, 0x00, 0x20, 0x0c, 0x98,
+	     0xc7, 0x01, 0x60, 0xd3, 0xfb, 0x91, 0xda, 0x3f, 0x55, 0x0c,
+	     0x29, 0x40, 0x8e, 0x04, 0x00, 0x00, 0x6f, 0x05, 0x76, 0xbf,
+	     0x05, 0x00, 0x64, 0x00, 0x0f, 0xa6, 0x21, 0x22, 0xbf, 0xb3,
+	     0x4e, 0xc0, 0x02, 0xb0, 0xd3, 0x38, 0xc4, 0x46, 0x09, 0x05,
+	     0xf0, 0x3e, 0x01, 0x1c, 0xad, 0x67, 0x87, 0x2a, 0xd1, 0x80,
+	     0x01, 0x80, 0x60, 0x0f, 0xf0, 0x68, 0xc5, 0x95, 0x3f, 0x5c,
+	     0x5f, 0x05, 0xe0, 0xc0, 0x00, 0xb5, 0x3e, 0x37, 0x79, 0x07,
+	     0x90, 0x03, 0xc4, 0x41, 0x08, 0x50, 0xcd, 0xc6, 0x3a, 0x6d,
+	     0xd5, 0x42, 0x3d, 0x6d, 0xbe, 0x14, 0xdd, 0x34, 0x80, 0x0f,
+	     0x55, 0x70, 0x01, 0x13, 0x40, 0x75, 0x4e, 0x86, 0x9e, 0x01,
+	     0x12, 0x40, 0xc8, 0x57, 0x32, 0x73, 0xfa, 0xa1, 0xf6, 0xfb,
+	     0x70, 0xc7, 0xec, 0xaa, 0xf7, 0x25, 0x00, 0xe7, 0x39, 0x6c,
+	     0x7b, 0x80, 0x1e, 0x55, 0x79, 0x2f, 0x7f, 0x01, 0xdc, 0xcc,
+	     0xdb, 0xcc, 0xcc, 0x03, 0x00, 0x26, 0x80, 0xb5, 0x05, 0x48,
+	     0xab, 0x77, 0x00, 0x11, 0x35, 0x31, 0x51, 0x01, 0xa0, 0x00,
+	     0xc1, 0x16, 0xb0, 0x0c, 0x00, 0xe6, 0xff, 0x55, 0x58, 0x36,
+	     0x95, 0x00, 0x00, 0xe2, 0xf1, 0x1c, 0xf7, 0x5b, 0x6a, 0x5a,
+	     0x00, 0xf2, 0x9c, 0x7d, 0x44, 0x50, 0x0a, 0x84, 0x35, 0xd6,
+	     0x3d, 0x56, 0xe6, 0xba, 0xec, 0xcf, 0xdb, 0x40, 0x92, 0x3c,
+	     0xff, 0x92, 0xc5, 0x3d, 0xd6, 0xf1, 0x1e, 0x80, 0x72, 0x3b,
+	     0x06, 0xd0, 0x59, 0x35, 0x88, 0x62, 0xea, 0x77, 0x54, 0x17,
+	     0xb7, 0xb1, 0x48, 0x40, 0xd8, 0x86, 0x70, 0xc2, 0x02, 0xfc,
+	     0x25, 0x1e, 0xd2, 0x78, 0x14, 0x3c, 0x9f, 0x55, 0x0b, 0x50,
+	     0x00, 0xb9, 0x85, 0x58, 0x76, 0xaa, 0x01, 0x48, 0xab, 0x6b,
+	     0x5d, 0xca, 0xe9, 0x0e, 0x5c, 0x59, 0x01, 0xf6, 0x27, 0xcb,
+	     0x78, 0x00, 0x00, 0x64, 0x53, 0x40, 0x2a, 0xc6, 0xb5, 0x4c,
+	     0x21, 0x3d, 0x14, 0x11, 0xf0, 0x03, 0x1c, 0xfe, 0xa1, 0xad,
+	     0x90, 0x61, 0x61, 0x1d, 0xf6, 0xc1, 0x50, 0x0d, 0x90, 0xd0,
+	     0x39, 0x01, 0xd4, 0xe0, 0x5f, 0x0f, 0xf8, 0xb1, 0x00, 0x49,
+	     0x02, 0x1f, 0x45, 0x36, 0x82, 0xfb, 0x00, 0x31, 0x17, 0xa3,
+	     0x38, 0x00, 0xc0, 0xed, 0x45, 0x55, 0x02, 0x60, 0xc9, 0x2e,
+	     0x9a, 0xda, 0x0a, 0xe7, 0xb1, 0x2a, 0xdb, 0x00, 0x54, 0x45,
+	     0xc0, 0x71, 0xf3, 0x97, 0x01, 0x4e, 0x16, 0x10, 0xe3, 0x74,
+	     0xc3, 0x5d, 0xa5, 0xa0, 0x05, 0xf0, 0xab, 0x0c, 0x80, 0x4c,
+	     0x59, 0x23, 0x05, 0xc0, 0xd9, 0xf0, 0x17, 0x0a, 0x0c, 0xb0,
+	     0x9a, 0xcd, 0x09, 0x0d, 0x02, 0x50, 0x39, 0x2f, 0x00, 0x00,
+	     0xc6, 0x80, 0x4e, 0x10, 0x00, 0x4e, 0x17, 0x0d, 0x53, 0xfd,
+	     0xee, 0xf0, 0xb6, 0x80, 0x39, 0x80, 0x11, 0xb1, 0x03, 0x00,
+	     0xf3, 0xf4, 0x93, 0x23, 0xcd, 0x80, 0x87, 0xad, 0x77, 0xf6,
+	     0x67, 0x06, 0x90, 0x38, 0x74, 0xc0, 0x4a, 0x04, 0x80, 0x2d,
+	     0xf4, 0x76, 0x80, 0x66, 0x7a, 0xc3, 0x4e, 0xa2, 0x00, 0x40,
+	     0xf9, 0x2c, 0xb3, 0xdf, 0xa4, 0x36, 0x42, 0xa7, 0xd8, 0x88,
+	     0x7c, 0x17, 0x4c, 0x4f, 0x74, 0xbb, 0xd9, 0xa6, 0x73, 0x7d,
+	     0x80, 0x08, 0xb0, 0xcf, 0x3f, 0x1e, 0x25, 0x00, 0x21, 0x89,
+	     0x12, 0xbd, 0x4c, 0x39, 0x9e, 0xbd, 0xe9, 0x16, 0x20, 0x66,
+	     0x1d, 0xc0, 0x03, 0x40, 0xb9, 0xe6, 0x00, 0xe8, 0x24, 0xc5,
+	     0x2a, 0x02, 0xb4, 0x84, 0x0a, 0xd4, 0x73, 0xd0, 0xc7, 0x22,
+	     0x6d, 0xd9, 0x1c, 0xc3, 0x87, 0x04, 0x90, 0x00, 0x00, 0xa1,
+	     0x7b, 0x4c, 0xe1, 0x89, 0x00, 0x48, 0x35, 0xa6, 0xc1, 0x28,
+	     0x2d, 0x9a, 0x41, 0x12, 0xc0, 0xb9, 0x07, 0x00, 0x18, 0x28,
+	     0x3b, 0x00, 0xb0, 0x15, 0xc2, 0xda, 0x80, 0x4b, 0x3f, 0xb8,
+	     0xd9, 0x02, 0x32, 0x65, 0x30, 0x1b, 0x00, 0xac, 0xee, 0x12,
+	     0x0d, 0x87, 0x6c, 0x95, 0xc0, 0x01, 0xa2, 0x00, 0xe7, 0x67,
+	     0x55, 0x62, 0x00, 0x6e, 0x15, 0x42, 0x63, 0x0c, 0x88, 0x8e,
+	     0x00, 0x42, 0x76, 0xb8, 0xdb, 0xa1, 0x1e, 0x77, 0xab, 0xdc,
+	     0x2c, 0x92, 0xce, 0x17, 0x01, 0x67, 0x70, 0x06, 0x02, 0xc9,
+	     0x02, 0xb8, 0x08, 0x06, 0xf9, 0x57, 0x8e, 0xdb, 0x00, 0x68,
+	     0x59, 0x04, 0x60, 0x04, 0xc6, 0x20, 0xaa, 0x16, 0x40, 0x91,
+	     0x31, 0x45, 0xf0, 0x00, 0xc0, 0x95, 0xda, 0x4d, 0xad, 0x7d,
+	     0xde, 0x19, 0x80, 0x5d, 0x5e, 0x91, 0xf4, 0xcc, 0x1a, 0xd5,
+	     0xb5, 0x7f, 0xcd, 0x0e, 0xc8, 0x3b, 0x11, 0x4f, 0x20, 0x82,
+	     0xa3, 0xe4, 0x6b, 0x08, 0xf3, 0x06, 0x08, 0x92, 0xc4, 0xec,
+	     0x6d, 0x9f, 0x03, 0xdc, 0x45, 0x3c, 0x91, 0xfe, 0x3b, 0xef,
+	     0xaf, 0x35, 0x9b, 0x1b, 0x3c, 0x03, 0x90, 0xab, 0xdd, 0x70,
+	     0x2f, 0xfa, 0x73, 0xf3, 0x02, 0xe2, 0x92, 0xe3, 0xc9, 0xf0,
+	     0x00, 0xaf, 0x4e, 0xc4, 0x8b, 0x35, 0x0b, 0xe6, 0x6f, 0x01,
+	     0x18, 0x63, 0x36, 0x75, 0x79, 0x02, 0x32, 0x6c, 0x4f, 0x02,
+	     0x00, 0x02, 0x1c, 0x16, 0x00, 0xa4, 0x06, 0x1f, 0xc4, 0x5d,
+	     0x21, 0x6c, 0xef, 0x9e, 0x23, 0xe0, 0x5a, 0x92, 0x00, 0xb6,
+	     0x85, 0x0b, 0x80, 0x3b, 0x4e, 0x72, 0xd7, 0x4b, 0xd4, 0x05,
+	     0x70, 0x9f, 0x4d, 0x27, 0xee, 0x0b, 0x31, 0x7e, 0x00, 0xb8,
+	     0xfd, 0x4a, 0x66, 0xb1, 0xfd, 0x14, 0xca, 0x9e, 0xbe, 0x0d,
+	     0x88, 0xc8, 0x00, 0xec, 0x50, 0x77, 0x0a, 0xb0, 0x19, 0x96,
+	     0x04, 0xde, 0x81, 0x8f, 0x36, 0x28, 0x04, 0x40, 0x4c, 0xe4,
+	     0xce, 0x0f, 0x72, 0xdf, 0xac, 0x08, 0xc0, 0x2e, 0x86, 0xe8,
+	     0x38, 0x74, 0x40, 0x3a, 0xb0, 0x05, 0x2c, 0xc7, 0xb8, 0x0b,
+	     0xa0, 0x2d, 0x88, 0xcb, 0x30, 0x23, 0x91, 0x91, 0xf5, 0x5a,
+	     0x02, 0x7b, 0x4a, 0x7c, 0x7d, 0xe1, 0x72, 0xa3, 0xf6, 0x30,
+	     0x79, 0x57, 0x9c, 0x1c, 0x4c, 0x01, 0x00, 0x00, 0x45, 0x1d,
+	     0x03, 0xc4, 0x96, 0x68, 0xb7, 0x5c, 0x3d, 0xdc, 0xde, 0x16,
+	     0x80, 0x80, 0x3f, 0x5c, 0xfc, 0xf3, 0x26, 0x3b, 0x72, 0x02,
+	     0xb2, 0x92, 0x41, 0x98, 0xce, 0xaa, 0x00, 0x40, 0x68, 0x78,
+	     0x01, 0xf2, 0x75, 0x40, 0x8c, 0x11, 0x66, 0x01, 0x22, 0x52,
+	     0x2c, 0x4a, 0x04, 0x90, 0xef, 0xf5, 0x16, 0x60, 0x23, 0xed,
+	     0x01, 0x10, 0x00, 0x70, 0x84, 0xf6, 0x3c, 0x0b, 0x6f, 0x17,
+	     0xc0, 0x9b, 0xda, 0x97, 0xc9, 0x01, 0x10, 0x42, 0xda, 0x68,
+	     0xe9, 0x00, 0xfa, 0x80, 0x23, 0x00, 0x40, 0xa8, 0x02, 0x32,
+	     0x80, 0xc8, 0xac, 0xf1, 0x55, 0xfa, 0x9e, 0x2d, 0x63, 0x10,
+	     0x58, 0x9c, 0x73, 0xd5, 0x2d, 0xe7, 0x1d, 0xc2, 0x06, 0xa8,
+	     0x65, 0x6b, 0x40, 0xd7, 0xe2, 0xa5, 0x82, 0xad, 0x73, 0x4e,
+	     0xb1, 0xfa, 0x34, 0x00, 0x52, 0x00, 0xf6, 0x15, 0xe0, 0x3c,
+	     0x6c, 0x01, 0x42, 0xc0, 0x2f, 0xeb, 0x60, 0xac, 0x00, 0x17,
+	     0xc0, 0xf5, 0x17, 0xe5, 0x02, 0xdc, 0x65, 0xd5, 0xdd, 0x52,
+	     0x36, 0x79, 0xf2, 0x18, 0x29, 0x40, 0x24, 0x06, 0xdc, 0xd3,
+	     0x01, 0x31, 0x60, 0x0d, 0x40, 0x80, 0x72, 0x0f, 0x92, 0x0d,
+	     0x00, 0x03, 0xf0, 0x5d, 0x70, 0xc0, 0xbd, 0x07, 0x20, 0x6d,
+	     0xcb, 0x1c, 0x25, 0x60, 0x09, 0x00, 0x34, 0x91, 0x8e, 0xd5,
+	     0xc6, 0xb3, 0x00, 0xac, 0xb7, 0xb3, 0xa7, 0xa5, 0xca, 0x02,
+	     0x30, 0xcd, 0x73, 0x4a, 0x46, 0x39, 0x28, 0xad, 0x01, 0x00,
+	     0x82, 0xbd, 0x40, 0xba, 0x0a, 0x8b, 0x82, 0xbd, 0x12, 0x60,
+	     0x95, 0x30, 0xc8, 0x80, 0x58, 0x8f, 0x58, 0x1b, 0x54, 0xe2,
+	     0x62, 0xc0, 0xf1, 0x41, 0xa8, 0x62, 0xdd, 0x70, 0x80, 0xa6,
+	     0xb7, 0x30, 0x01, 0xdc, 0xe9, 0xbb, 0xd0, 0x72, 0x57, 0xa6,
+	     0x15, 0x9f, 0xfa, 0x97, 0x07, 0xf0, 0xc5, 0x9b, 0x0b, 0xfd,
+	     0x0d, 0xd0, 0x86, 0x02, 0x8e, 0x00, 0xe8, 0x98, 0x84, 0xf0,
+	     0x69, 0xd2, 0xf7, 0x59, 0x0e, 0x00, 0xb8, 0xe5, 0x00, 0x46,
+	     0xb0, 0xc5, 0xb8, 0x7d, 0x03, 0xa2, 0x66, 0x40, 0x63, 0x3e,
+	     0x80, 0x33, 0x08, 0x61, 0x37, 0xed, 0x0f, 0xc0, 0xab, 0xfd,
+	     0xb0, 0xb4, 0xc1, 0x8f, 0xb3, 0x33, 0x84, 0x00, 0x06, 0x28,
+	     0x66, 0x5d, 0x02, 0xbc, 0x14, 0x00, 0x99, 0x77, 0x02, 0x18,
+	     0x00, 0x3c, 0x40, 0xf7, 0x49, 0x4d, 0x00, 0xe2, 0x39, 0x56,
+	     0x8f, 0x2b, 0x6d, 0x77, 0xd1, 0xe0, 0x09, 0x00, 0xb0, 0xd8,
+	     0x27, 0x6c, 0x06, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x6e, 0x3a,
+	     0x47, 0x49, 0x05, 0x58, 0x5a, 0xe4, 0x9a, 0x9d, 0xff, 0x03,
+	     0x40, 0xac, 0x0a, 0xe3, 0x10, 0xc0, 0x05, 0x01, 0x80, 0x7f,
+	     0x94, 0x23, 0x63, 0xe3, 0xca, 0xd2, 0xda, 0x1c, 0xe1, 0x0b,
+	     0x00, 0x52, 0x82, 0x7a, 0x97, 0x33, 0xa0, 0x00, 0x62, 0xb2,
+	     0x14, 0x80, 0xfa, 0x5c, 0xbf, 0x04, 0x04, 0xdc, 0x62, 0xef,
+	     0x12, 0xb0, 0xe0, 0x47, 0xaa, 0x00, 0x00, 0x0f, 0x00, 0x00,
+	     0xec, 0x78, 0x2b, 0x00, 0x00, 0xf4, 0x05, 0x24, 0xe0, 0x12,
+	     0xc3, 0xf6, 0xff, 0x6e, 0xbe, 0xe4, 0x00, 0xb0, 0x3c, 0x1d,
+	     0x07, 0x78, 0x63, 0x38, 0x73, 0x33, 0xe3, 0x91, 0xa2, 0xc9,
+	     0x17, 0x9f, 0xd9, 0x04, 0xa4, 0xb5, 0x41, 0xdb, 0x08, 0x20,
+	     0x2a, 0xad, 0xd9, 0xa6, 0xfc, 0xf6, 0x12, 0xb0, 0xcb, 0x5e,
+	     0x42, 0x80, 0x29, 0xa0, 0x08, 0x00, 0x84, 0x93, 0x56, 0x24,
+	     0xa0, 0x60, 0xec, 0xc1, 0xd6, 0x00, 0x8b, 0x40, 0x79, 0xe6,
+	     0xd6, 0x01, 0x23, 0x80, 0x21, 0xa7, 0x5c, 0x16, 0x5e, 0x05,
+	     0xa9, 0x8d, 0x07, 0x70, 0x00, 0xd4, 0xcc, 0xbc, 0x1a, 0xc7,
+	     0x91, 0x4c, 0x6e, 0x00, 0x68, 0x7f, 0xe7, 0x00, 0xb8, 0xb1,
+	     0x27, 0xc6, 0x98, 0x7f, 0x76, 0xeb, 0xa7, 0x6b, 0x40, 0x17,
+	     0x11, 0x65, 0x01, 0x5c, 0xbf, 0x5e, 0x91, 0x02, 0x58, 0x01,
+	     0x6c, 0x60, 0x80, 0x17, 0x30, 0x2a, 0x13, 0x01, 0x00, 0x40,
+	     0xe6, 0x0e, 0x28, 0x63, 0xdd, 0xfc, 0x0b, 0x6e, 0x5a, 0x6c,
+	     0x00, 0xe2, 0xb3, 0xa4, 0xaa, 0x37, 0x2f, 0x7a, 0x80, 0x8e,
+	     0x59, 0x7b, 0x69, 0x53, 0xbe, 0x11, 0xa7, 0x91, 0x98, 0x96,
+	     0x05, 0xe0, 0x89, 0x58, 0x40, 0x3f, 0xfe, 0xc9, 0x93, 0xfd,
+	     0x00, 0x2e, 0xa0, 0xe3, 0xed, 0x00, 0x5a, 0x6e, 0x03, 0x12,
+	     0x50, 0xde, 0xd1, 0x8e, 0xc9, 0x1e, 0xa0, 0x50, 0x30, 0x7f,
+	     0x4e, 0x49, 0x2a, 0x7c, 0x03, 0x48, 0xfb, 0x24, 0x00, 0x5e,
+	     0x0d, 0xe0, 0x4b, 0x80, 0xc5, 0x5c, 0x50, 0x11, 0x70, 0x89,
+	     0x03, 0x84, 0x97, 0xef, 0xd7, 0x46, 0x07, 0x00, 0x00, 0x00,
+	     0xc0, 0xf7, 0x9c, 0x76, 0x8f, 0xbf, 0x6f, 0xb3, 0x2c, 0x8d,
+	     0x75, 0x1c, 0x01, 0x04, 0x00, 0x00, 0x0f, 0x24, 0xb8, 0x94,
+	     0x3c, 0x7a, 0x16, 0x00, 0x7f, 0xc9, 0x39, 0xa8, 0x3b, 0x06,
+	     0xd0, 0x9b, 0x02, 0x00, 0x24, 0xb7, 0xbb, 0x36, 0xfa, 0xe8,
+	     0x01, 0xff, 0xce, 0xd1, 0x0d, 0x03, 0x68, 0xff, 0xcc, 0x6f,
+	     0x00, 0x3f, 0x85, 0x7d, 0x45, 0x15, 0x99, 0x59, 0x0e, 0xb0,
+	     0xe5, 0x05, 0x2a, 0x19, 0x55, 0xa6, 0x2c, 0xaa, 0xdd, 0x35,
+	     0x00, 0xf6, 0xcf, 0x68, 0x02, 0x96, 0x49, 0x25, 0xe5, 0x80,
+	     0x11, 0x03, 0x92, 0x6f, 0x64, 0x41, 0x29, 0xbc, 0x23, 0x01,
+	     0x42, 0xda, 0x68, 0x1c, 0xc4, 0xa4, 0x12, 0x99, 0x0b, 0x42,
+	     0x43, 0x01, 0x38, 0x1b, 0x06, 0x80, 0xfe, 0xbf, 0x9a, 0xe7,
+	     0x00, 0x71, 0x00, 0xb9, 0x6b, 0x05, 0x04, 0xd2, 0xcb, 0xaf,
+	     0xb7, 0x09, 0x20, 0x82, 0x65, 0x39, 0xa9, 0x0a, 0x2e, 0x66,
+	     0xd6, 0x01, 0x7e, 0x40, 0xe8, 0x3e, 0xe8, 0x8b, 0x35, 0x78,
+	     0x79, 0x60, 0xfe, 0x05, 0x00, 0x64, 0xe9, 0x0d, 0x4e, 0x6c,
+	     0xff, 0x02, 0xc8, 0x6e, 0x00, 0x80, 0x0b, 0x10, 0xd3, 0xae,
+	     0x56, 0x92, 0x81, 0x8b, 0xa6, 0x01, 0x24, 0xf3, 0x0b, 0x00,
+	     0x50, 0x00, 0x74, 0xb9, 0x96, 0x93, 0xe9, 0x6f, 0x89, 0x2d,
+	     0xb0, 0x2c, 0xb0, 0xb5, 0xc8, 0x66, 0x6f, 0xd4, 0x1d, 0x17,
+	     0x60, 0x45, 0xe7, 0x8b, 0x15, 0x2f, 0x1c, 0xc0, 0x2b, 0xbc,
+	     0x44, 0x1f, 0xce, 0xa6, 0x0d, 0xd0, 0xe9, 0xb5, 0x5c, 0x4d,
+	     0x00, 0x60, 0xfc, 0x18, 0x02, 0x00, 0x00, 0x80, 0x17, 0x01,
+	     0x98, 0x40, 0x62, 0xe6, 0xec, 0x11, 0xf0, 0x04, 0x84, 0xa9,
+	     0x71, 0xb2, 0xc5, 0xbc, 0xce, 0x39, 0x28, 0x52, 0x32, 0x51,
+	     0xa4, 0xfa, 0xca, 0x36, 0xf9, 0xaf, 0x8d, 0x52, 0x72, 0x2f,
+	     0x9f, 0xeb, 0x13, 0x00, 0xea, 0x03, 0x44, 0x5c, 0xbe, 0x74,
+	     0x59, 0xa9, 0xd9, 0x01, 0x98, 0xfb, 0xc5, 0xf2, 0xdc, 0x9a,
+	     0x4a, 0xbc, 0xa3, 0xf8, 0x3e, 0x0c, 0x58, 0x0f, 0x01, 0x0c,
+	     0x0c, 0xe3, 0xa3, 0xc2, 0xf6, 0xca, 0xac, 0x78, 0xac, 0xa4,
+	     0x55, 0x00, 0xd8, 0x78, 0x91, 0x88, 0xf8, 0x2c, 0x60, 0x01,
+	     0x2a, 0x80, 0x13, 0x30, 0xd3, 0x48, 0x10, 0x58, 0x84, 0x34,
+	     0x26, 0x51, 0x38, 0x4e, 0x2f, 0x35, 0x3d, 0x78, 0x99, 0xdf,
+	     0x0d, 0x80, 0x56, 0x05, 0x00, 0xf8, 0xaa, 0x42, 0x66, 0x5f,
+	     0x1b, 0xb0, 0xcb, 0x98, 0xe6, 0x0a, 0x80, 0x01, 0x6b, 0xe6,
+	     0xd4, 0x6d, 0x59, 0xfc, 0xa2, 0xb1, 0x23, 0x02, 0xd6, 0xc3,
+	     0x3a, 0x87, 0x98, 0x89, 0x45, 0x10, 0xae, 0x9e, 0x7d, 0x79,
+	     0x10, 0x90, 0xf8, 0x57, 0x07, 0xbd, 0xab, 0xb4, 0x02, 0x8a,
+	     0x69, 0x2b, 0x20, 0x0b, 0x70, 0xb7, 0x78, 0xb2, 0x27, 0xe2,
+	     0x01, 0xd8, 0x3c, 0xcc, 0x9f, 0x99, 0x38, 0x26, 0x35, 0x00,
+	     0x8a, 0x01, 0xe9, 0x6c, 0x14, 0x8b, 0x7d, 0x39, 0x31, 0x37,
+	     0xa5, 0x53, 0xd7, 0xb9, 0xe8, 0x8b, 0x28, 0x00, 0xa1, 0x18,
+	     0x09, 0x01, 0x57, 0x80, 0xb5, 0x1f, 0xf7, 0xe4, 0x19, 0x16,
+	     0x70, 0x00, 0x05, 0x10, 0x54, 0x01, 0x00, 0x74, 0x1c, 0x36,
+	     0x04, 0xe4, 0x30, 0x33, 0xb6, 0x50, 0x1b, 0xe0, 0x95, 0x01,
+	     0xb2, 0xb9, 0x3b, 0x80, 0x45, 0x11, 0xd4, 0x57, 0x7b, 0x00,
+	     0x50, 0xb6, 0x3b, 0x00, 0x31, 0x00, 0x60, 0xf7, 0x26, 0x43,
+	     0xe3, 0x02, 0x27, 0x40, 0x07, 0x80, 0xe4, 0x0b, 0x60, 0x00,
+	     0xa0, 0x64, 0x58, 0x53, 0x01, 0x28, 0xac, 0x8b, 0x3c, 0x00,
+	     0xf0, 0x31, 0x5d, 0xd6, 0xb8, 0xa9, 0x62, 0x21, 0xc7, 0xeb,
+	     0xb9, 0x5a, 0x2f, 0xdf, 0x77, 0xfd, 0xdc, 0xe4, 0x49, 0x6d,
+	     0x05, 0x38, 0x2d, 0xf6, 0x98, 0x5a, 0x07, 0x00, 0xd0, 0x01,
+	     0x4f, 0xc0, 0x00, 0x80, 0xb3, 0x8b, 0x54, 0x3f, 0x00, 0xca,
+	     0x05, 0x94, 0x84, 0x4b, 0xe9, 0x04, 0xde, 0x09, 0xd8, 0x9e,
+	     0xc7, 0x80, 0xea, 0xba, 0xbb, 0x10, 0x52, 0x00, 0xd9, 0xaf,
+	     0x0c, 0x66, 0xf8, 0x35, 0x00, 0x80, 0x08, 0xb3, 0xe5, 0xbc,
+	     0x01, 0x38, 0x00, 0xf5, 0x15, 0x90, 0x0a, 0xe5, 0xb0, 0x0a,
+	     0xfe, 0x6d, 0x9e, 0x3e, 0xea, 0x08, 0x00, 0x36, 0xc0, 0x6e,
+	     0x75, 0x0a, 0xac, 0xcc, 0xb0, 0x12, 0x60, 0xc4, 0x73, 0x81,
+	     0x91, 0xbc, 0xa9, 0xda, 0x95, 0x5d, 0x01, 0x7f, 0x80, 0x13,
+	     0xd0, 0x4e, 0x3a, 0x69, 0xe3, 0x34, 0xc0, 0x2c, 0x0b, 0xa7,
+	     0x00, 0x00, 0xc0, 0x12, 0xee, 0x01, 0xe0, 0x00, 0x38, 0x90,
+	     0x01, 0x00, 0x78, 0xce, 0x16, 0xf9, 0x3a, 0xf6, 0xb9, 0x2f,
+	     0x7f, 0x33, 0xe6, 0x1a, 0x03, 0xb0, 0xde, 0x2c, 0xe8, 0x00,
+	     0x66, 0xa0, 0x35, 0x28, 0x59, 0xd2, 0xbf, 0x00, 0xa0, 0x6c,
+	     0x3f, 0xbb, 0x0d, 0x20, 0xb8, 0x48, 0x0b, 0x88, 0x01, 0xde,
+	     0x5d, 0x00, 0x20, 0x74, 0x07, 0x50, 0xbf, 0xb6, 0x7d, 0xec,
+	     0x30, 0xeb, 0xbb, 0xd8, 0x00, 0x3b, 0x00, 0x80, 0x8e, 0xa3,
+	     0xf6, 0x03, 0x7e, 0x88, 0x22, 0xa8, 0x1e, 0x0a, 0x62, 0x11,
+	     0x37, 0x08, 0xe7, 0x64, 0x9b, 0xb6, 0x94, 0xc6, 0x30, 0x3c,
+	     0x78, 0x94, 0x61, 0x2d, 0x23, 0x1f, 0x85, 0x03, 0x52, 0x24,
+	     0xe5, 0x3b, 0x3c, 0x5c, 0x00, 0x00, 0x35, 0xb3, 0xbf, 0x92,
+	     0x5e, 0x7a, 0x4d, 0xc0, 0xe1, 0x2e, 0x62, 0x05, 0x6c, 0xfd,
+	     0x96, 0x3e, 0xa0, 0xde, 0x1e, 0xc6, 0x00, 0xd0, 0x03, 0x00,
+	     0x27, 0x46, 0x34, 0x73, 0xed, 0x3f, 0xf5, 0x31, 0x7b, 0x49,
+	     0x7b, 0x50, 0x00, 0xbf, 0xa1, 0x94, 0x01, 0xd0, 0x6c, 0xcf,
+	     0x53, 0x0d, 0x80, 0x30, 0xa2, 0x00, 0xeb, 0x90, 0xd1, 0x34,
+	     0x7d, 0x00, 0xc8, 0x02, 0x00, 0x00, 0x68, 0x0d, 0x9d, 0x88,
+	     0x3a, 0x00, 0xfd, 0xe5, 0xd9, 0x20, 0x0d, 0x0c, 0xe0, 0x4d,
+	     0x07, 0x44, 0xbd, 0x80, 0x6b, 0x9e, 0x42, 0xe9, 0xe5, 0xd1,
+	     0x88, 0x7b, 0x0a, 0x07, 0x00, 0x03, 0x98, 0x8a, 0x69, 0x0f,
+	     0x40, 0x06, 0x4c, 0x9b, 0xe8, 0x71, 0x0a, 0x59, 0x20, 0x7f,
+	     0x3a, 0x18, 0x4e, 0xff, 0x0d, 0xb0, 0x78, 0x84, 0x00, 0x00,
+	     0x6f, 0x0f, 0xb8, 0xa7, 0x69, 0x06, 0x42, 0x15, 0x50, 0x00,
+	     0xd8, 0xf5, 0x80, 0x15, 0x8d, 0x70, 0x8b, 0x7b, 0x18, 0x80,
+	     0x80, 0x02, 0x00, 0x00, 0x78, 0x6e, 0x00, 0xf3, 0x6c, 0x2e,
+	     0x06, 0x20, 0xaf, 0xe6, 0xfd, 0xeb, 0xf6, 0xad, 0xbb, 0x00,
+	     0x55, 0xca, 0x6a, 0x0b, 0xf5, 0x3f, 0x68, 0x00, 0x2a, 0x9d,
+	     0xa4, 0xaf, 0x02, 0x2c, 0xe1, 0x5c, 0x19, 0x10, 0x01, 0xa8,
+	     0x01, 0x55, 0x53, 0x44, 0x4e, 0x53, 0x17, 0x95, 0xf4, 0x08,
+	     0x20, 0x4b, 0xae, 0x72, 0xf2, 0x6a, 0x4d, 0xfa, 0x6a, 0x04,
+	     0x64, 0x48, 0x03, 0xd3, 0x0b, 0x50, 0x48, 0xf9, 0xf2, 0xbc,
+	     0xfe, 0xff, 0x04, 0x70, 0xd8, 0x3b, 0x11, 0x31, 0x20, 0x15,
+	     0x00, 0x00, 0x01, 0x4a, 0x40, 0x99, 0x76, 0x03, 0xac, 0xae,
+	     0x00, 0x00, 0x0c, 0xc0, 0xbb, 0x0c, 0x31, 0x11, 0xc3, 0xdc,
+	     0xb4, 0x6d, 0x6f, 0xde, 0xad, 0x44, 0x17, 0xd0, 0x6d, 0xd7,
+	     0xd5, 0xdb, 0x16, 0x60, 0xf3, 0x31, 0x87, 0xd1, 0x41, 0x07,
+	     0xf1, 0xb3, 0x07, 0x04, 0x00, 0xa5, 0x2c, 0x67, 0x68, 0x02,
+	     0xf4, 0xce, 0xbc, 0x03, 0xa0, 0x03, 0x98, 0x12, 0x00, 0x43,
+	     0xdb, 0x03, 0xf0, 0xe9, 0x03, 0xf6, 0x10, 0xcb, 0x1c, 0xad,
+	     0x53, 0xc1, 0x52, 0xf1, 0x87, 0xc1, 0x6c, 0x01, 0x01, 0xfc,
+	     0x00, 0xb2, 0xd4, 0x13, 0x5e, 0x07, 0x49, 0x03, 0x10, 0x00,
+	     0x0c, 0x50, 0x52, 0xe1, 0x80, 0x11, 0xef, 0xc7, 0x06, 0x9c,
+	     0xe3, 0x80, 0x53, 0x08, 0x00, 0x10, 0xb8, 0x7d, 0x80, 0x5a,
+	     0x0e, 0xc0, 0x06, 0x00, 0x9c, 0x5b, 0x3b, 0x40, 0x71, 0x86,
+	     0x21, 0x01, 0x3f, 0x00, 0x80, 0x9c, 0x40, 0x84, 0xaa, 0x80,
+	     0xdc, 0x3e, 0xb8, 0x4d, 0x54, 0x59, 0x66, 0x00, 0x57, 0x0a,
+	     0x90, 0xd2, 0x69, 0xc7, 0x3e, 0xdb, 0x97, 0x69, 0x02, 0x00,
+	     0x00, 0xb7, 0x02, 0x90, 0xa6, 0x07, 0x8d, 0xb7, 0xbb, 0xe7,
+	     0x02, 0xbe, 0x54, 0x11, 0xab, 0x1a, 0xe0, 0xd1, 0x05, 0xa8,
+	     0xda, 0xfe, 0xdd, 0x4c, 0x01, 0x06, 0x04, 0xe2, 0xce, 0xcb,
+	     0xb4, 0x3e, 0xcc, 0xdb, 0xde, 0x1d, 0xc0, 0xd5, 0xee, 0x05,
+	     0x38, 0x03, 0x70, 0x22, 0x00, 0x11, 0xde, 0x47, 0x00, 0xd6,
+	     0x0a, 0x20, 0xd3, 0xe2, 0x32, 0x9f, 0xaa, 0xfe, 0x4a, 0x03,
+	     0x05, 0x6c, 0x00, 0x98, 0x05, 0x00, 0x1b, 0x82, 0xd3, 0xdf,
+	     0x00, 0x00, 0x0c, 0x00, 0x40, 0xc7, 0x00, 0x80, 0xb8, 0x0c,
+	     0xb0, 0x04, 0x6c, 0xc8, 0x2f, 0x40, 0x77, 0x09, 0x00, 0x88,
+	     0xb3, 0x10, 0x21, 0x10, 0x01, 0xe8, 0x0c, 0x32, 0x6c, 0x00,
+	     0x60, 0xf3, 0x7f, 0xd5, 0x12, 0xca, 0x2e, 0x0a, 0x8d, 0x61,
+	     0x2f, 0xb8, 0x66, 0x29, 0x80, 0xd6, 0x06, 0x5c, 0x2a, 0x9f,
+	     0x92, 0x1c, 0x96, 0x5c, 0x85, 0xad, 0xe0, 0x44, 0x0c, 0xa1,
+	     0xa3, 0x49, 0x01, 0x1b, 0x00, 0x80, 0xe7, 0x88, 0xfb, 0x1d,
+	     0x73, 0x24, 0x00, 0xf0, 0x38, 0xbe, 0x01, 0x36, 0x65, 0x28,
+	     0x92, 0xd0, 0xde, 0x3e, 0xe7, 0x3e, 0xa0, 0xe4, 0x6e, 0x35,
+	     0xde, 0xc6, 0xc3, 0x0f, 0x7a, 0xb9, 0xa8, 0x79, 0x80, 0x73,
+	     0x0e, 0x90, 0xde, 0x01, 0x38, 0xfd, 0xcc, 0xd4, 0x80, 0x96,
+	     0x1b, 0x00, 0x06, 0x9d, 0xe9, 0x8e, 0x5a, 0x14, 0x01, 0x8d,
+	     0xe4, 0xd0, 0x41, 0xea, 0x78, 0x5b, 0x3e, 0x40, 0x05, 0xd0,
+	     0x8b, 0x06, 0x80, 0xe5, 0xb4, 0x0c, 0xc8, 0x63, 0x50, 0x51,
+	     0x80, 0x2f, 0xe0, 0x0b, 0xf8, 0x27, 0xd9, 0x95, 0x0f, 0xbb,
+	     0x0c, 0x18, 0xb0, 0xf0, 0x00, 0xf9, 0x58, 0xf5, 0x86, 0xaf,
+	     0x03, 0x80, 0xbc, 0x22, 0xb6, 0x2f, 0xf7, 0x2c, 0x00, 0xa9,
+	     0x17, 0x7e, 0x48, 0x2d, 0x2b, 0x71, 0xc0, 0x6b, 0xf3, 0x21,
+	     0x03, 0x98, 0xfd, 0x0f, 0x80, 0x40, 0xae, 0x7d, 0x2c, 0xee,
+	     0x44, 0xb5, 0xae, 0xad, 0xf2, 0x4e, 0x00, 0xc5, 0x00, 0x00,
+	     0xd8, 0x00, 0x3a, 0x80, 0x56, 0x4f, 0x69, 0x68, 0xc5, 0x33,
+	     0xbb, 0x1c, 0xac, 0x99, 0x56, 0x98, 0xc3, 0x4f, 0xc0, 0x19,
+	     0x00, 0x28, 0x67, 0xd2, 0x76, 0xab, 0x71, 0x3a, 0xff, 0x50,
+	     0x00, 0xe3, 0x41, 0x2c, 0x0d, 0xc8, 0xb7, 0xb8, 0x65, 0x00,
+	     0xdc, 0x5a, 0xcf, 0x91, 0x01, 0x55, 0x8d, 0x2d, 0xdd, 0xb0,
+	     0xe0, 0x94, 0x15, 0x40, 0xac, 0xb9, 0x09, 0x03, 0xa6, 0x60,
+	     0xd1, 0x89, 0xd3, 0x00, 0x6d, 0x41, 0x3e, 0xa2, 0x92, 0x0f,
+	     0x68, 0xab, 0xd8, 0x55, 0x42, 0xf4, 0x06, 0x72, 0xf6, 0xb3,
+	     0xea, 0x88, 0x49, 0x0e, 0x03, 0x64, 0xfa, 0x59, 0x30, 0xf5,
+	     0xd1, 0xe1, 0x15, 0x00, 0x9f, 0x17, 0x0c, 0x70, 0x78, 0xdd,
+	     0x52, 0x9e, 0x2e, 0x20, 0xb6, 0x09, 0x7a, 0xf6, 0xb8, 0x57,
+	     0x00, 0x2f, 0x06, 0x00, 0x00, 0x01, 0x15, 0xa0, 0x88, 0x24,
+	     0x6b, 0x6c, 0x75, 0x92, 0x38, 0xdb, 0x09, 0x5e, 0x49, 0xdd,
+	     0x27, 0x2f, 0x99, 0x80, 0x07, 0x1e, 0xdc, 0xe2, 0x2a, 0x88,
+	     0x80, 0x0f, 0xbe, 0x99, 0xdf, 0xd0, 0x03, 0x00, 0x00, 0x2a,
+	     0x7a, 0xd1, 0xf8, 0x0c, 0x38, 0x02, 0x04, 0x7d, 0xc3, 0xae,
+	     0x0c, 0x08, 0x13, 0x24, 0x80, 0xb8, 0xa2, 0x27, 0x23, 0x03,
+	     0x76, 0xae, 0x23, 0x78, 0x09, 0x00, 0x2c, 0x01, 0x80, 0xc6,
+	     0x07, 0x09, 0x04, 0xd8, 0x77, 0x8d, 0x1d, 0xc0, 0x10, 0x01,
+	     0xcc, 0x01, 0xcd, 0xdd, 0x40, 0x64, 0x5c, 0x07, 0x9c, 0x13,
+	     0xe7, 0xa5, 0x81, 0xd0, 0x16, 0xcc, 0xa0, 0xa5, 0xc1, 0x6a,
+	     0x05, 0x84, 0x19, 0xa1, 0x14, 0x20, 0x17, 0x61, 0xc2, 0xeb,
+	     0x0f, 0x9b, 0x02, 0x0d, 0x58, 0x33, 0x42, 0x80, 0x69, 0x4a,
+	     0x28, 0x5f, 0x9c, 0xbf, 0x67, 0x71, 0x42, 0x00, 0x30, 0x01,
+	     0xca, 0x96, 0xc4, 0x15, 0x68, 0xce, 0x84, 0xe3, 0x4e, 0xc0,
+	     0xfb, 0x08, 0xde, 0xdb, 0xe5, 0x20, 0x26, 0xe0, 0x79, 0x7b,
+	     0x9e, 0x01, 0x68, 0x5b, 0x53, 0x4d, 0x07, 0x28, 0xa3, 0x67,
+	     0x00, 0x20, 0x10, 0x08, 0x49, 0x00, 0x00, 0xe2, 0x94, 0xb7,
+	     0x5d, 0xf0, 0x3d, 0x73, 0xd0, 0xe4, 0x1c, 0x40, 0xb2, 0x79,
+	     0xb6, 0x3b, 0x4b, 0xb4, 0x0e, 0x05, 0x09, 0xa9, 0x8c, 0x6f,
+	     0xe9, 0xb5, 0x83, 0xb2, 0x80, 0xef, 0xc7, 0x07, 0x00, 0x14,
+	     0xc6, 0x30, 0xfd, 0xa0, 0xd6, 0xbc, 0xe4, 0xbb, 0xb5, 0x34,
+	     0x42, 0x31, 0xab, 0x32, 0x36, 0x89, 0xbf, 0x3a, 0x04, 0x7f,
+	     0xf3, 0xa3, 0xc1, 0x07, 0x8c, 0x29, 0x07, 0x24, 0x73, 0xbe,
+	     0x26, 0x80, 0xcc, 0x19, 0x92, 0x01, 0xac, 0x09, 0x69, 0xfe,
+	     0xaf, 0x03, 0x2e, 0x3b, 0xf4, 0x0b, 0x00, 0xd3, 0x01, 0x52,
+	     0x07, 0x1e, 0x20, 0x33, 0xfb, 0x81, 0x4f, 0x38, 0x00, 0x16,
+	     0xc0, 0x26, 0x6a, 0xca, 0x11, 0x42, 0x88, 0xb4, 0xd5, 0x89,
+	     0x01, 0x59, 0x13, 0x20, 0x7c, 0x4f, 0x61, 0x01, 0xbb, 0x2b,
+	     0xb0, 0x69, 0x7f, 0x7e, 0x91, 0x0c, 0xc0, 0x1d, 0x60, 0xba,
+	     0x6b, 0xc1, 0x80, 0x9b, 0x58, 0x93, 0xc5, 0xf4, 0x58, 0x80,
+	     0x3b, 0x60, 0x07, 0x0d, 0xfa, 0xa9, 0x58, 0x25, 0xa9, 0x5b,
+	     0x44, 0xd6, 0xb8, 0x1a, 0x2e, 0x93, 0x1a, 0x06, 0x00, 0x90,
+	     0x50, 0xc3, 0x3b, 0x8a, 0x05, 0x00, 0x3a, 0xb0, 0x92, 0xde,
+	     0x22, 0x05, 0x64, 0x01, 0x91, 0x58, 0x08, 0xf9, 0x03, 0xa8,
+	     0xae, 0x2d, 0xd3, 0x70, 0xf3, 0x33, 0xef, 0x61, 0x0b, 0x00,
+	     0x51, 0x8c, 0xe0, 0x11, 0x01, 0x3d, 0xd7, 0x11, 0xa0, 0x04,
+	     0xb0, 0xd2, 0x00, 0x76, 0xbd, 0x48, 0x70, 0xb9, 0xb4, 0xe7,
+	     0x7f, 0x76, 0x94, 0x1c, 0x63, 0x72, 0x2e, 0x0b, 0xa0, 0x4e,
+	     0x01, 0x00, 0xac, 0x62, 0x80, 0x17, 0x79, 0x54, 0x77, 0xef,
+	     0x68, 0xbc, 0x15, 0xa0, 0x06, 0xd8, 0x1f, 0x82, 0x11, 0x65,
+	     0x66, 0x06, 0xfc, 0xb9, 0x69, 0x1b, 0xa9, 0x00, 0x48, 0xba,
+	     0x00, 0x32, 0x66, 0x62, 0xd0, 0x49, 0x43, 0x5c, 0x48, 0xd7,
+	     0xfc, 0xf7, 0xc7, 0x20, 0xbb, 0xae, 0xf3, 0xb0, 0xea, 0xe2,
+	     0x5d, 0x00, 0xa9, 0x20, 0x00, 0x00, 0xd8, 0x6b, 0x01, 0x32,
+	     0x07, 0xfe, 0xc0, 0xd2, 0xc3, 0x5a, 0x00, 0xe5, 0x85, 0x3f,
+	     0xa7, 0x02, 0x4c, 0x00, 0x40, 0x1c, 0xbf, 0xee, 0x47, 0x15,
+	     0x2f, 0x9d, 0xe3, 0xd1, 0x07, 0x20, 0xd0, 0x0f, 0x93, 0xf4,
+	     0xf9, 0x6e, 0xe0, 0x0a, 0x00, 0x0c, 0xe0, 0xec, 0xea, 0x01,
+	     0xaa, 0x21, 0x40, 0xee, 0x01, 0x88, 0xc3, 0xfe, 0xbe, 0xa8,
+	     0x68, 0x63, 0xe9, 0x00, 0x00, 0x40, 0x40, 0x1e, 0xc2, 0x5b,
+	     0x20, 0x6c, 0x00, 0x27, 0x40, 0xe2, 0x02, 0x50, 0x27, 0xb9,
+	     0x1a, 0xef, 0x04, 0xd0, 0x67, 0xaf, 0x0d, 0x24, 0x40, 0x0e,
+	     0xe0, 0x7e, 0x84, 0x70, 0x6b, 0x80, 0x38, 0x07, 0x2c, 0xb8,
+	     0xe7, 0x61, 0x99, 0x04, 0x00, 0xb0, 0x01, 0x7a, 0xc0, 0x97,
+	     0x9b, 0x37, 0x03, 0x1c, 0x95, 0x6e, 0x8d, 0x00, 0x78, 0x8b,
+	     0xcd, 0x92, 0x9e, 0xdd, 0x77, 0x04, 0xe4, 0x00, 0xd8, 0xbb,
+	     0x65, 0x2a, 0xf8, 0x36, 0x62, 0x96, 0x2a, 0x20, 0xa3, 0x08,
+	     0x01, 0xd2, 0x01, 0xfa, 0xae, 0xc9, 0xcd, 0x00, 0xec, 0xf1,
+	     0xc9, 0xbd, 0x6d, 0x00, 0x10, 0x03, 0x8d, 0x71, 0x68, 0x1c,
+	     0x25, 0x62, 0x41, 0xca, 0x1b, 0x00, 0x80, 0x76, 0x38, 0x2a,
+	     0x80, 0x8f, 0x1a, 0x85, 0x2b, 0x81, 0x00, 0x1f, 0x4b, 0x2b,
+	     0x04, 0xa0, 0x8c, 0x0a, 0x85, 0x00, 0x1a, 0xb1, 0x2a, 0xd0,
+	     0x9c, 0x78, 0x80, 0xf1, 0x20, 0x49, 0x7f, 0x00, 0x3e, 0xaf,
+	     0xbe, 0x08, 0x70, 0x78, 0x28, 0xba, 0x78, 0x74, 0x5f, 0x9f,
+	     0x52, 0x44, 0x80, 0x90, 0x04, 0x30, 0xe0, 0x02, 0x64, 0x80,
+	     0xa3, 0x49, 0xef, 0x04, 0x00, 0x42, 0xb4, 0x4e, 0x17, 0x80,
+	     0x02, 0xd8, 0x85, 0x90, 0x58, 0x74, 0x83, 0xae, 0x74, 0x90,
+	     0x4f, 0xc9, 0xeb, 0x22, 0x81, 0x86, 0x93, 0xf6, 0x66, 0x12,
+	     0x90, 0xc8, 0x21, 0x2d, 0x0d, 0x28, 0xe0, 0xbc, 0x85, 0x4e,
+	     0x01, 0x7e, 0x3e, 0x82, 0x4c, 0xb5, 0x32, 0x0f, 0xfc, 0x8e,
+	     0xf4, 0x01, 0xf0, 0xde, 0xeb, 0x80, 0x41, 0x64, 0xcd, 0x2c,
+	     0x00, 0xda, 0x6a, 0x2f, 0x02, 0x10, 0xd6, 0xa5, 0x30, 0x80,
+	     0x4f, 0x0d, 0xf0, 0x72, 0x46, 0xd1, 0x1c, 0xc0, 0x26, 0xbc,
+	     0x41, 0xd1, 0x70, 0x00, 0xd1, 0x36, 0xc2, 0x02, 0x74, 0x01,
+	     0x9f, 0x11, 0x87, 0x02, 0xad, 0x8f, 0x3d, 0x02, 0x69, 0x19,
+	     0x8d, 0x0c, 0x82, 0x42, 0x40, 0x87, 0x56, 0x67, 0xea, 0x34,
+	     0x52, 0x9d, 0xf4, 0xa9, 0x17, 0xd8, 0x44, 0xd0, 0x4c, 0x80,
+	     0x01, 0xd8, 0x73, 0x3a, 0xe7, 0x60, 0x02, 0x16, 0x60, 0x07,
+	     0xd0, 0x5e, 0xa3, 0x6f, 0x07, 0x80, 0x96, 0x01, 0x00, 0xb1,
+	     0x71, 0x63, 0x0c, 0x00, 0x1c, 0xbe, 0x80, 0x27, 0x7b, 0xbf,
+	     0xda, 0x2e, 0x01, 0x27, 0xab, 0x65, 0x48, 0x3e, 0x9e, 0xc1,
+	     0x25, 0x56, 0xd2, 0xb0, 0xc4, 0x01, 0x2a, 0x20, 0x75, 0x02,
+	     0x00, 0x60, 0x97, 0x1e, 0x71, 0x40, 0xf6, 0xbe, 0xf9, 0xb3,
+	     0x97, 0x21, 0x4e, 0xa8, 0x1a, 0x6a, 0x9a, 0xf5, 0x64, 0x24,
+	     0x5e, 0xbe, 0x1f, 0x49, 0x0d, 0x1f, 0x93, 0x1c, 0x08, 0x80,
+	     0xed, 0xd8, 0x29, 0x82, 0xce, 0x4a, 0x01, 0x02, 0x3a, 0x41,
+	     0x20, 0x7d, 0xd2, 0x63, 0x02, 0xfa, 0x64, 0xc0, 0xbf, 0x03,
+	     0x88, 0x4e, 0x6a, 0x23, 0xc0, 0x0e, 0xe0, 0x01, 0x00, 0x5a,
+	     0x60, 0x05, 0xbb, 0x60, 0x55, 0x09, 0xb4, 0x04, 0xec, 0x13,
+	     0x91, 0x77, 0x64, 0x45, 0xb1, 0x3f, 0x8e, 0x6a, 0x40, 0x2b,
+	     0x00, 0x69, 0x3c, 0x20, 0xbd, 0x66, 0x92, 0xe3, 0x24, 0x40,
+	     0x3a, 0xe6, 0x60, 0x95, 0x92, 0x58, 0xf6, 0xfb, 0xdd, 0xac,
+	     0x0d, 0x71, 0xca, 0xa6, 0x29, 0x0a, 0x05, 0x80, 0x71, 0xf0,
+	     0x9d, 0x29, 0xbb, 0x01, 0x00, 0xca, 0x80, 0x09, 0x60, 0xeb,
+	     0x1d, 0x2d, 0xe4, 0xeb, 0x91, 0x59, 0xac, 0x05, 0x01, 0xb4,
+	     0x00, 0x88, 0x54, 0xbf, 0x25, 0x92, 0x01, 0x80, 0x3e, 0x60,
+	     0x48, 0xb6, 0x24, 0x0e, 0xb6, 0xc7, 0x4e, 0x1d, 0xc5, 0x03,
+	     0x4e, 0x12, 0xbb, 0x10, 0xd0, 0xf6, 0x75, 0x00, 0x21, 0x40,
+	     0x31, 0x84, 0x05, 0x00, 0x62, 0xee, 0x1a, 0x20, 0xc5, 0x95,
+	     0x93, 0x01, 0x80, 0xdb, 0xdb, 0x47, 0x07, 0xa6, 0xa9, 0x0b,
+	     0x0b, 0x14, 0x00, 0xf8, 0x44, 0x27, 0x00, 0x26, 0x20, 0xae,
+	     0x40, 0xa3, 0x01, 0x8e, 0x90, 0xbb, 0x67, 0x6b, 0x46, 0x0f,
+	     0x0a, 0xc6, 0xb0, 0xa4, 0x07, 0x10, 0x33, 0xff, 0xf3, 0x9c,
+	     0x8b, 0xdb, 0x47, 0x01, 0x1c, 0xb2, 0xcc, 0x06, 0x00, 0x38,
+	     0x8a, 0x81, 0xe1, 0xe7, 0x8f, 0x74, 0x02, 0x38, 0x4e, 0x10,
+	     0x55, 0x9d, 0x07, 0x14, 0xd4, 0x4a, 0xe1, 0xba, 0x73, 0x49,
+	     0x00, 0xae, 0x24, 0xc0, 0xa5, 0xb3, 0xa9, 0xa6, 0x01, 0xbd,
+	     0x48, 0x0c, 0xdb, 0x06, 0x00, 0x2c, 0xe0, 0x8f, 0x01, 0x80,
+	     0x8b, 0xf7, 0x00, 0x5c, 0xbb, 0xfb, 0x07, 0xb0, 0x00, 0x00,
+	     0x1e, 0x0c, 0x41, 0xc8, 0x4d, 0x94, 0xf9, 0x17, 0x2e, 0xd7,
+	     0x41, 0x33, 0x08, 0x00, 0xd9, 0x74, 0x59, 0x01, 0xb9, 0xab,
+	     0x78, 0x44, 0x55, 0x4e, 0xe6, 0xd6, 0x62, 0x24, 0x38, 0x36,
+	     0x00, 0x15, 0x06, 0x00, 0x32, 0xc7, 0xcc, 0x85, 0x2b, 0xd8,
+	     0x5e, 0x12, 0x8d, 0x14, 0x72, 0xf8, 0xbc, 0x03, 0xb6, 0xe8,
+	     0x96, 0x1b, 0x05, 0x00, 0x00, 0x00, 0x64, 0x41, 0xd3, 0x4a,
+	     0x9d, 0x01, 0x00, 0x08, 0x00, 0x60, 0xa5, 0x04, 0xa4, 0xa8,
+	     0x6a, 0x92, 0x18, 0x20, 0x17, 0xfd, 0x01, 0xe6, 0xad, 0xf4,
+	     0xea, 0x4f, 0x41, 0x14, 0x80, 0xa1, 0x8e, 0x08, 0x20, 0x0a,
+	     0x91, 0x20, 0xb0, 0x2f, 0x6f, 0x4b, 0x73, 0xc7, 0x61, 0x26,
+	     0x14, 0x10, 0x5b, 0xa7, 0x00, 0x00, 0x37, 0x02, 0x9c, 0x8f,
+	     0x90, 0xc6, 0x04, 0x2e, 0xa7, 0xc2, 0xd9, 0x02, 0x26, 0xe3,
+	     0x8b, 0x23, 0x0c, 0xb0, 0x4f, 0x50, 0x7b, 0xb9, 0xc5, 0x4c,
+	     0xa6, 0x01, 0x00, 0x00, 0x15, 0x00, 0x10, 0x16, 0xdc, 0x8a,
+	     0xe4, 0xc4, 0xc3, 0xee, 0xdd, 0x48, 0xac, 0x58, 0x8b, 0xde,
+	     0xaa, 0x90, 0xb7, 0xab, 0x66, 0x6e, 0x9e, 0xe9, 0x1e, 0x3f,
+	     0x88, 0xe1, 0x34, 0x97, 0x18, 0x93, 0x0f, 0x9f, 0xa5, 0xa0,
+	     0xa4, 0xc5, 0xe9, 0xba, 0xab, 0xce, 0x1a, 0x6a, 0x44, 0xc7,
+	     0x01, 0xca, 0xed, 0x3c, 0x07, 0xe0, 0x03, 0x08, 0x41, 0x7c,
+	     0xe5, 0x54, 0xd5, 0xd4, 0xf1, 0x88, 0xad, 0x2a, 0xe8, 0x45,
+	     0xf0, 0xb2, 0x52, 0xab, 0x6c, 0x9a, 0x29, 0x40, 0x90, 0xe3,
+	     0x74, 0xaf, 0x64, 0x87, 0x8d, 0x1c, 0x2a, 0xaa, 0x54, 0x62,
+	     0xd8, 0xff, 0x64, 0x5b, 0xf8, 0x80, 0x1a, 0x50, 0x04, 0x44,
+	     0x30, 0xd2, 0xf2, 0xbc, 0xa3, 0x39, 0xb2, 0xc3, 0xb1, 0x46,
+	     0x08, 0x30, 0x76, 0x01, 0x3e, 0x11, 0x49, 0x01, 0xc0, 0xa8,
+	     0x03, 0x8a, 0x6a, 0x46, 0x1f, 0x4c, 0xe1, 0xaf, 0xbf, 0x75,
+	     0x80, 0xe0, 0x79, 0x58, 0x20, 0xde, 0x7e, 0xa2, 0x2b, 0x56,
+	     0x72, 0x02, 0xfa, 0x92, 0x0e, 0xb5, 0x05, 0x00, 0x14, 0xc8,
+	     0x20, 0x80, 0x39, 0x2d, 0x07, 0x28, 0x3b, 0x10, 0x00, 0x80,
+	     0x95, 0x35, 0xd8, 0x53, 0x00, 0x15, 0x20, 0x05, 0x00, 0xb4,
+	     0xf3, 0x26, 0x80, 0xa8, 0xb2, 0x12, 0x71, 0x38, 0x75, 0x0d,
+	     0x10, 0x14, 0xfa, 0xc6, 0x93, 0xba, 0xf3, 0x05, 0x30, 0x05,
+	     0x24, 0x17, 0x80, 0x56, 0x86, 0x02, 0xc0, 0x17, 0x7f, 0x0e,
+	     0x00, 0x4c, 0x30, 0x52, 0xdc, 0x01, 0x80, 0xbd, 0x0e, 0x00,
+	     0xf0, 0x03, 0x04, 0x79, 0x00, 0x30, 0x07, 0x08, 0x17, 0x00,
+	     0xab, 0x5b, 0xcd, 0x1f, 0x4c, 0x8b, 0x53, 0x00, 0x00, 0x45,
+	     0xf8, 0xb5, 0x1c, 0xe6, 0x16, 0x00, 0xc0, 0x80, 0x13, 0x73,
+	     0xda, 0x80, 0x2f, 0x19, 0x10, 0x01, 0x70, 0x01, 0x2c, 0x40,
+	     0x1a, 0xa0, 0xf8, 0xa5, 0x01, 0x6b, 0x38, 0x00, 0x5c, 0x84,
+	     0x00, 0x8e, 0x00, 0x40, 0xc9, 0x65, 0xf8, 0x01, 0x00, 0x68,
+	     0xfd, 0xdc, 0x97, 0xb4, 0x65, 0xbe, 0x2b, 0x82, 0x0b, 0x70,
+	     0x01, 0xf8, 0x57, 0x2f, 0x09, 0xa9, 0xa1, 0xe5, 0x62, 0x9c,
+	     0x00, 0x60, 0x10, 0xac, 0x99, 0x00, 0xb4, 0xd1, 0x65, 0xfa,
+	     0xd8, 0x46, 0x6b, 0x4f, 0xe7, 0xcb, 0x79, 0xff, 0xda, 0x01,
+	     0x66, 0x72, 0x96, 0xd2, 0xeb, 0xbc, 0x57, 0x98, 0x58, 0x6e,
+	     0x3b, 0xc2, 0x16, 0x3f, 0xbf, 0xc8, 0x77, 0x14, 0x0c, 0x10,
+	     0x97, 0xfd, 0x00, 0x80, 0xd2, 0x33, 0x73, 0xb8, 0x01, 0x3a,
+	     0x1a, 0x00, 0xb0, 0xf9, 0x75, 0x25, 0x3d, 0x80, 0xc6, 0xc6,
+	     0xf3, 0x24, 0x06, 0x00, 0x47, 0x3a, 0x00, 0x00, 0x58, 0xe0,
+	     0x5e, 0xda, 0x15, 0x50, 0xaa, 0xe0, 0xc8, 0x3f, 0x80, 0x01,
+	     0x90, 0x01, 0x9c, 0x00, 0xdb, 0x1a, 0x1a, 0x40, 0xbb, 0xc9,
+	     0x55, 0x87, 0x39, 0x00, 0x80, 0x07, 0x01, 0xe4, 0xb5, 0x83,
+	     0x0d, 0xb0, 0xc3, 0xab, 0xad, 0x06, 0x80, 0x8f, 0x3b, 0xe5,
+	     0x0f, 0xfe, 0x95, 0x05, 0x40, 0x6c, 0x29, 0x6a, 0x00, 0x52,
+	     0x40, 0x33, 0xb8, 0xf9, 0x00, 0xca, 0x00, 0x9c, 0xdb, 0x00,
+	     0xa0, 0x6b, 0x3f, 0x31, 0x3f, 0xa0, 0x6d, 0x70, 0x00, 0xde,
+	     0x64, 0xc0, 0x7c, 0x07, 0xe0, 0xad, 0x01, 0x51, 0xb2, 0x1a,
+	     0x00, 0x02, 0x34, 0xd7, 0x80, 0x31, 0xe0, 0x74, 0xdb, 0xe0,
+	     0xee, 0x4b, 0x00, 0x19, 0x50, 0x55, 0xb6, 0x01, 0x76, 0xc0,
+	     0xe3, 0xff, 0x5d, 0x56, 0x97, 0x80, 0x76, 0xda, 0xe9, 0x06,
+	     0x5c, 0x19, 0x86, 0xc4, 0x73, 0x07, 0x08, 0x7c, 0x00, 0x70,
+	     0x08, 0x20, 0x69, 0x74, 0x03, 0xfc, 0x2a, 0xd9, 0xbf, 0x21,
+	     0x79, 0xfc, 0x33, 0x6a, 0x08, 0xc0, 0x0b, 0x2d, 0x13, 0x6b,
+	     0x80, 0x32, 0x00, 0x30, 0x16, 0x00, 0x86, 0xfc, 0x27, 0xc0,
+	     0x81, 0xdc, 0xff, 0x65, 0x8c, 0x62, 0x18, 0x0c, 0x18, 0xfa,
+	     0x19, 0xae, 0x20, 0xaa, 0x02, 0xa0, 0x02, 0x9c, 0x4d, 0xd6,
+	     0x59, 0x31, 0xde, 0x26, 0x21, 0x00, 0x0e, 0x00, 0x00, 0x20,
+	     0x72, 0x4d, 0xc5, 0x36, 0xb2, 0x04, 0x3a, 0x5d, 0x7c, 0x9e,
+	     0x30, 0x83, 0x0a, 0xa0, 0x8d, 0xd0, 0x6e, 0x40, 0x0f, 0x90,
+	     0x9e, 0xf0, 0x01, 0x80, 0x69, 0xd8, 0x70, 0xfa, 0xa6, 0x77,
+	     0x30, 0xf3, 0x18, 0x55, 0xfa, 0xf2, 0x3f, 0x56, 0x10, 0x40,
+	     0x09, 0xc0, 0xf8, 0xa6, 0x87, 0x9d, 0x0a, 0x80, 0x79, 0x61,
+	     0x58, 0xde, 0xe2, 0x97, 0x69, 0x7c, 0x51, 0xb3, 0x1f, 0x0a,
+	     0xdd, 0x96, 0x36, 0x00, 0xd0, 0x47, 0x61, 0x16, 0x80, 0x00,
+	     0x00, 0xda, 0xad, 0x26, 0x80, 0x02, 0x00, 0x0c, 0xd2, 0x1f,
+	     0x40, 0xe1, 0x79, 0x22, 0xe1, 0x01, 0x98, 0x06, 0x80, 0xd0,
+	     0x02, 0x18, 0x01, 0x00, 0xa8, 0x04, 0xa0, 0x05, 0xe4, 0x01,
+	     0x10, 0x40, 0x15, 0xd0, 0x33, 0xb4, 0x20, 0xed, 0x2d, 0xc1,
+	     0x07, 0x28, 0x13, 0x28, 0x00, 0x04, 0x04, 0xf0, 0x01, 0x00,
+	     0x44, 0xec, 0x70, 0x1b, 0xb4, 0x5a, 0x03, 0x92, 0x6f, 0x80,
+	     0x4a, 0xe8, 0x29, 0x50, 0x01, 0x80, 0x1c, 0x00, 0x1a, 0x69,
+	     0xc2, 0x00, 0x1f, 0x66, 0xeb, 0x08, 0x1a, 0x02, 0x98, 0x16,
+	     0xc0, 0x12, 0x0f, 0x34, 0x80, 0x01, 0xe2, 0xdf, 0x0a, 0x60,
+	     0x00, 0xa4, 0xbf, 0x0e, 0x7f, 0xec, 0x38, 0x01, 0x7c, 0x00,
+	     0xa9, 0x1c, 0xe3, 0xa8, 0xfe, 0xed, 0x8c, 0x0b, 0xca, 0xf8,
+	     0x32, 0x35, 0x00, 0xb8, 0x9b, 0x60, 0x6b, 0x9d, 0x8c, 0xc8,
+	     0x7f, 0x80, 0x01, 0xe0, 0xc0, 0x29, 0xd7, 0x16, 0x00, 0x00,
+	     0x00, 0xd0, 0xa6, 0x01, 0x00, 0xab, 0xbf, 0x8d, 0x09, 0x20,
+	     0x01, 0x18, 0x00, 0x75, 0x03, 0x09, 0xc0, 0x02, 0x5e, 0x5c,
+	     0x0d, 0x13, 0x00, 0x28, 0x00, 0x10, 0xb1, 0x8c, 0x5d, 0x92,
+	     0x06, 0x40, 0x13, 0xfb, 0xc6, 0xcf, 0xb7, 0xaa, 0x02, 0xca,
+	     0x00, 0x80, 0x1f, 0x00, 0x18, 0xd2, 0x03, 0x65, 0x91, 0x65,
+	     0x05, 0xe0, 0x70, 0xcb, 0x2c, 0x54, 0xbf, 0x05, 0x00, 0x24,
+	     0x7a, 0xe6, 0x72, 0xf6, 0x50, 0x95, 0xaf, 0x69, 0x64, 0x00,
+	     0x6b, 0x93, 0xac, 0x7a, 0x00, 0x76, 0x5c, 0x1a, 0xfc, 0xe2,
+	     0xde, 0xe5, 0x8b, 0xbc, 0xd3, 0x40, 0xe7, 0x05, 0x2e, 0x7d,
+	     0xcf, 0x74, 0x7e, 0xd6, 0x53, 0xd1, 0x80, 0x6b, 0x7b, 0x56,
+	     0x0c, 0x15, 0x22, 0x5c, 0x24, 0xa0, 0x63, 0x9d, 0x18, 0xdb,
+	     0x38, 0x9c, 0xb7, 0x23, 0x2a, 0x91, 0x36, 0x01, 0x4e, 0xab,
+	     0x1f, 0x80, 0x9c, 0x5c, 0xc8, 0xad, 0xd9, 0x4c, 0x71, 0x0c,
+	     0x83, 0xae, 0xb7, 0x6f, 0x3c, 0xab, 0xaa, 0x00, 0x4e, 0x9f,
+	     0xb0, 0x6b, 0xde, 0x02, 0x00, 0x31, 0x9c, 0x2c, 0x1f, 0x03,
+	     0x3c, 0x15, 0x7f, 0x00, 0x20, 0xa9, 0x03, 0x20, 0x05, 0x80,
+	     0x31, 0xa5, 0x35, 0x7e, 0xae, 0xec, 0x2e, 0x49, 0xb1, 0x87,
+	     0x5d, 0x02, 0xda, 0x4a, 0x74, 0x1e, 0x50, 0xd3, 0x4e, 0xa9,
+	     0x94, 0x56, 0x71, 0xe3, 0x68, 0x2a, 0x36, 0x12, 0x40, 0x8b,
+	     0x08, 0x28, 0x02, 0x58, 0x01, 0xc5, 0xc5, 0x81, 0xe5, 0x39,
+	     0x00, 0x02, 0x7a, 0xf0, 0xd3, 0x27, 0xdb, 0xf4, 0x2e, 0xff,
+	     0x3b, 0x16, 0x7d, 0xd6, 0x75, 0x35, 0x67, 0x1d, 0x00, 0x70,
+	     0x12, 0xb0, 0x00, 0x80, 0x87, 0x0b, 0x30, 0xc6, 0x00, 0x87,
+	     0xe3, 0x67, 0xc4, 0x00, 0xec, 0x32, 0x4d, 0x40, 0x3a, 0x51,
+	     0x06, 0x00, 0x18, 0x81, 0xe6, 0x44, 0x0a, 0xa8, 0xf5, 0xa6,
+	     0xb9, 0xf8, 0x2b, 0xb1, 0x82, 0x3b, 0x9c, 0x8f, 0x39, 0xeb,
+	     0xf6, 0x87, 0x50, 0xaa, 0x52, 0xbe, 0xeb, 0x0c, 0x00, 0x24,
+	     0x9e, 0x1e, 0x40, 0xc4, 0x04, 0xd0, 0x00, 0x18, 0x27, 0xf9,
+	     0x85, 0x02, 0x60, 0x73, 0xd5, 0x6d, 0x3a, 0x9f, 0xed, 0xef,
+	     0x0a, 0x94, 0xec, 0xa7, 0x0d, 0xdb, 0x29, 0xcb, 0xcb, 0x97,
+	     0x71, 0x01, 0x20, 0xe0, 0x43, 0x99, 0x80, 0x08, 0xc0, 0x49,
+	     0x46, 0x7c, 0x4a, 0x4a, 0x80, 0x98, 0xab, 0x33, 0xbe, 0x96,
+	     0x52, 0xc0, 0xba, 0x03, 0x88, 0xc2, 0x59, 0xad, 0x1b, 0x20,
+	     0xc6, 0x7b, 0x1f, 0x25, 0x00, 0x60, 0xe3, 0xe5, 0xea, 0x02,
+	     0x9c, 0x8d, 0x37, 0x6f, 0xf9, 0x32, 0x27, 0x09, 0x74, 0x40,
+	     0xb9, 0x8f, 0xf3, 0xbd, 0x47, 0x24, 0xbe, 0x39, 0x57, 0x85,
+	     0x9d, 0xfd, 0x1b, 0xc1, 0x1e, 0xc0, 0xe2, 0xe7, 0xdb, 0xda,
+	     0x7a, 0xa7, 0x60, 0xe4, 0x1f, 0xf2, 0xef, 0x3f, 0x61, 0x02,
+	     0x21, 0x9c, 0x1b, 0xa7, 0x19, 0xf1, 0xa6, 0x66, 0x01, 0x74,
+	     0x43, 0xb3, 0x65, 0x2a, 0x02, 0xbc, 0x00, 0x66, 0xc0, 0xa0,
+	     0x01, 0xf8, 0x25, 0x01, 0x7c, 0x3d, 0x11, 0xe0, 0x9b, 0x93,
+	     0xa1, 0x80, 0xa1, 0xc1, 0x07, 0xc0, 0x84, 0x60, 0x25, 0xc0,
+	     0x6d, 0xf7, 0xb7, 0x00, 0xf0, 0x00, 0x00, 0x57, 0x0d, 0xca,
+	     0x00, 0x3c, 0x99, 0x1a, 0x40, 0x72, 0x85, 0x3c, 0x53, 0xfa,
+	     0x0f, 0x40, 0xd2, 0x8d, 0xdd, 0x94, 0x80, 0xf4, 0xf0, 0x6c,
+	     0x07, 0x00, 0xfe, 0x00, 0xc0, 0xa7, 0x5b, 0x79, 0x23, 0xc1,
+	     0x43, 0x6c, 0x38, 0x03, 0x00, 0x50, 0x7d, 0xc1, 0x65, 0x27,
+	     0xe8, 0x1c, 0x03, 0x48, 0xbe, 0xd7, 0x40, 0xcd, 0x5a, 0x76,
+	     0x34, 0x97, 0xd4, 0x0a, 0x48, 0xf8, 0x51, 0xa1, 0xd1, 0x5b,
+	     0x9c, 0x20, 0x32, 0x3f, 0x55, 0x56, 0x0b, 0x06, 0xc0, 0x56,
+	     0x01, 0x0a, 0x00, 0x00, 0x80, 0x6b, 0xab, 0x00, 0x90, 0x00,
+	     0x95, 0xe9, 0xd2, 0xbc, 0xa4, 0x69, 0x2e, 0x40, 0xba, 0xcc,
+	     0x35, 0xb1, 0xd9, 0xea, 0xae, 0xca, 0x4c, 0x24, 0x5f, 0x43,
+	     0x00, 0x40, 0x07, 0x0a, 0x38, 0x92, 0xf2, 0x80, 0xf8, 0xa9,
+	     0x79, 0x89, 0xd9, 0x67, 0x80, 0xb7, 0x5c, 0x13, 0x0e, 0x69,
+	     0x31, 0xe0, 0x15, 0x5a, 0x21, 0x79, 0xd8, 0xce, 0x00, 0x22,
+	     0x00, 0x00, 0x40, 0xee, 0xbf, 0x05, 0x00, 0x07, 0xb0, 0x0f,
+	     0xdc, 0x00, 0x39, 0x00, 0xc0, 0x52, 0x1b, 0xd0, 0x49, 0x62,
+	     0xb0, 0x96, 0x8a, 0x39, 0x3e, 0x51, 0xb3, 0x97, 0xc9, 0xcc,
+	     0x45, 0x9f, 0xb8, 0x36, 0x80, 0xe3, 0x0a, 0xd8, 0x24, 0xdb,
+	     0x75, 0xd7, 0x30, 0x29, 0x04, 0x8c, 0x9e, 0x2b, 0x00, 0x77,
+	     0x06, 0xa8, 0xb1, 0x86, 0x00, 0x05, 0x0a, 0x38, 0x55, 0x02,
+	     0x10, 0x80, 0x71, 0x0d, 0x55, 0xf3, 0xf8, 0x87, 0x5f, 0xdd,
+	     0x1f, 0x00, 0x38, 0x7c, 0x20, 0x36, 0x15, 0x40, 0x18, 0xda,
+	     0x25, 0x9e, 0x00, 0x80, 0x0e, 0x70, 0xd2, 0x87, 0xf1, 0xc9,
+	     0xc3, 0x0c, 0x02, 0x5d, 0x03, 0x00, 0x54, 0xa6, 0x14, 0xc8,
+	     0x04, 0xc8, 0x0e, 0x80, 0x46, 0x1d, 0x00, 0x60, 0x15, 0x01,
+	     0x5d, 0x73, 0x65, 0xdb, 0xc5, 0x02, 0x9c, 0x3f, 0x40, 0xf5,
+	     0xbf, 0x06, 0x00, 0xc8, 0x46, 0x59, 0x8f, 0x01, 0xb0, 0xf0,
+	     0x01, 0xcc, 0xe7, 0x18, 0x00, 0xf0, 0x06, 0x91, 0x00, 0x58,
+	     0x66, 0x7d, 0x00, 0x1c, 0x65, 0x51, 0xf6, 0x02, 0x00, 0x80,
+	     0x57, 0x74, 0xa5, 0x3c, 0x4d, 0xb6, 0x7e, 0x0a, 0xec, 0x33,
+	     0x80, 0x1d, 0x07, 0xf0, 0x17, 0x51, 0xbf, 0x04, 0x80, 0x6b,
+	     0x23, 0x45, 0x27, 0x15, 0x83, 0x82, 0x2c, 0x5d, 0x1d, 0xf0,
+	     0x00, 0x2d, 0x00, 0x80, 0x80, 0xdf, 0xbb, 0x1e, 0x00, 0xa0,
+	     0x23, 0x62, 0x03, 0xa6, 0x00, 0x00, 0x80, 0xda, 0x94, 0x62,
+	     0x73, 0x8e, 0x39, 0x06, 0x20, 0x4f, 0xa2, 0x8a, 0x47, 0x2b,
+	     0xf9, 0x57, 0xce, 0x61, 0x00, 0x7a, 0x34, 0x40, 0x03, 0x01,
+	     0x7c, 0x20, 0x7a, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x49,
+	     0xa5, 0xa0, 0x5f, 0x25, 0x01, 0x00, 0xa3, 0x20, 0x00, 0x90,
+	     0x06, 0x00, 0x54, 0x18, 0x06, 0x60, 0x05, 0x05, 0x00, 0x3e,
+	     0x77, 0x01, 0x03, 0xe5, 0xac, 0xa7, 0x99, 0xbd, 0xa3, 0x16,
+	     0x0c, 0x60, 0x9d, 0x12, 0x42, 0x2d, 0xc0, 0xda, 0x8c, 0x4a,
+	     0xb3, 0x21, 0xe2, 0x3f, 0x0e, 0x40, 0xa3, 0x01, 0x80, 0xc7,
+	     0x4d, 0x24, 0x46, 0x90, 0x01, 0x00, 0x1e, 0xc0, 0x16, 0x16,
+	     0x84, 0x67, 0x80, 0xa3, 0x17, 0x30, 0x36, 0x00, 0xe8, 0x00,
+	     0x3b, 0x20, 0xfc, 0x91, 0x22, 0x00, 0xe7, 0x33, 0xc0, 0xd6,
+	     0xe5, 0x28, 0x4f, 0xe3, 0x5d, 0x1d, 0x10, 0x01, 0x4c, 0xe4,
+	     0x00, 0x2e, 0x40, 0xab, 0x71, 0x41, 0xf5, 0x14, 0x40, 0xc7,
+	     0x3f, 0x6f, 0x01, 0x68, 0x86, 0xf1, 0x13, 0x80, 0x7b, 0x49,
+	     0x38, 0x80, 0x14, 0x80, 0x0a, 0x88, 0x46, 0xaa, 0xe5, 0x01,
+	     0x40, 0x06, 0xfb, 0x02, 0xec, 0x6e, 0xa9, 0xc3, 0xf8, 0x83,
+	     0x00, 0x34, 0x43, 0x00, 0x60, 0x43, 0x77, 0xc6, 0xc5, 0xc5,
+	     0xa3, 0x5f, 0xcb, 0x95, 0xea, 0x60, 0x00, 0xc0, 0xef, 0x3b,
+	     0x25, 0x96, 0x80, 0x2a, 0xec, 0x9d, 0x87, 0x0c, 0x01, 0xe8,
+	     0x75, 0x00, 0x00, 0x10, 0xc5, 0x69, 0xc1, 0x7e, 0x1d, 0xa0,
+	     0xed, 0xe6, 0x03, 0x4c, 0x48, 0xc8, 0xf3, 0x89, 0x00, 0x78,
+	     0xcf, 0xa9, 0xe9, 0xc1, 0x29, 0x63, 0x03, 0x02, 0x7f, 0xef,
+	     0x09, 0xe0, 0x5b, 0x82, 0x01, 0xee, 0x08, 0x00, 0x30, 0xfb,
+	     0x89, 0xba, 0xd4, 0x2d, 0x00, 0xf0, 0x34, 0x6f, 0xdb, 0x33,
+	     0x3c, 0x80, 0xa3, 0x30, 0x13, 0xb4, 0x40, 0x6d, 0x0a, 0x00,
+	     0x00, 0x88, 0xc9, 0xb4, 0xea, 0x0b, 0x90, 0x06, 0x00, 0x00,
+	     0xc6, 0x00, 0x80, 0x34, 0x36, 0x00, 0x00, 0x1d, 0x00, 0x38,
+	     0x41, 0xa7, 0x60, 0xc7, 0x7b, 0x8e, 0x86, 0x06, 0x70, 0xcf,
+	     0x1e, 0xd4, 0x2b, 0x13, 0xa5, 0x00, 0x00, 0x00, 0x0d, 0xac,
+	     0x66, 0x08, 0xf0, 0x00, 0xa0, 0x80, 0x95, 0xd7, 0xbb, 0x05,
+	     0x00, 0xd4, 0x4c, 0x00, 0x00, 0x65, 0x8e, 0x01, 0xca, 0x00,
+	     0x00, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x95, 0x4c, 0x0d, 0x00,
+	     0x78, 0x2a, 0x00, 0x3f, 0x80, 0x12, 0x90, 0x41, 0xe5, 0x01,
+	     0x00, 0x83, 0x86, 0x6f, 0x4c, 0xdb, 0xfc, 0x7e, 0xb4, 0xf3,
+	     0x51, 0x9a, 0x93, 0xed, 0x7f, 0xc5, 0x8f, 0xc6, 0x2f, 0xc1,
+	     0x04, 0xd1, 0x22, 0x00, 0x90, 0x99, 0x02, 0xb5, 0x7a, 0xea,
+	     0x1d, 0x00, 0x90, 0x03, 0xca, 0x54, 0x40, 0x19, 0x10, 0x86,
+	     0x73, 0x00, 0x0e, 0x00, 0xa0, 0x03, 0xe8, 0x9d, 0x51, 0x00,
+	     0xc0, 0x18, 0xa0, 0x56, 0xfd, 0x01, 0xbb, 0xce, 0x28, 0x49,
+	     0x06, 0x1c, 0x4d, 0x9c, 0x97, 0x77, 0xbd, 0xc2, 0xef, 0x06,
+	     0x23, 0x3b, 0x80, 0xc5, 0xd8, 0x46, 0x85, 0x05, 0x76, 0xa0,
+	     0x90, 0x19, 0x82, 0x75, 0x00, 0x40, 0x2f, 0x56, 0xb9, 0x01,
+	     0x5e, 0x75, 0x5a, 0x67, 0xc0, 0x04, 0x74, 0xbe, 0xb8, 0x69,
+	     0x13, 0xc0, 0xca, 0x05, 0xde, 0xf6, 0x48, 0x07, 0x00, 0x60,
+	     0x70, 0x61, 0x00, 0xc0, 0x9e, 0x0c, 0x98, 0xe6, 0x6b, 0x8e,
+	     0x75, 0x65, 0x02, 0x70, 0x5a, 0xf0, 0x12, 0x6b, 0x08, 0x90,
+	     0xf5, 0xe0, 0x01, 0x5f, 0x06, 0x40, 0x8b, 0x7f, 0x2c, 0xc9,
+	     0x0f, 0xc0, 0x22, 0x9d, 0xb2, 0xde, 0x93, 0x48, 0x00, 0x00,
+	     0xd0, 0x15, 0xd3, 0x3d, 0x00, 0x3d, 0xc0, 0x2b, 0x45, 0xa9,
+	     0x33, 0xc9, 0x24, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x80,
+	     0x0c, 0xc0, 0x18, 0xf0, 0x54, 0x6a, 0x89, 0x0e, 0x0d, 0x90,
+	     0xc7, 0x00, 0x00, 0x99, 0x1c, 0x20, 0x51, 0x00, 0x1c, 0x6c,
+	     0xc0, 0x1e, 0xa0, 0x45, 0x03, 0xa2, 0xf1, 0x27, 0x12, 0x04,
+	     0xed, 0x02, 0x86, 0x6f, 0x09, 0xd2, 0x72, 0x4f, 0xa0, 0x33,
+	     0x21, 0x89, 0x12, 0x70, 0xc0, 0x03, 0x08, 0x00, 0xff, 0xc3,
+	     0x83, 0xed, 0x9a, 0xbc, 0x00, 0x70, 0xeb, 0x79, 0x29, 0x00,
+	     0x06, 0x60, 0x33, 0x00, 0x00, 0x04, 0x3c, 0x12, 0x5d, 0x29,
+	     0xa0, 0x54, 0x03, 0x70, 0x10, 0xbb, 0xc9, 0x2b, 0xaf, 0xc9,
+	     0x22, 0x78, 0x00, 0xa4, 0x83, 0x99, 0x03, 0x00, 0x78, 0x5b,
+	     0x00, 0xe1, 0x50, 0x24, 0x7d, 0xab, 0x9f, 0x07, 0x68, 0xcf,
+	     0x06, 0x00, 0x7a, 0x80, 0x31, 0x68, 0x0b, 0xf0, 0x01, 0x98,
+	     0x49, 0x00, 0xa0, 0x81, 0xce, 0x2e, 0x5a, 0x1d, 0xbb, 0xb5,
+	     0x0d, 0xe8, 0x63, 0xa8, 0xef, 0x35, 0xe0, 0xe0, 0x52, 0x43,
+	     0xfe, 0xfa, 0x22, 0x00, 0x60, 0xd1, 0x79, 0x9b, 0x0d, 0xd1,
+	     0x37, 0xab, 0x04, 0x88, 0x15, 0x6e, 0x00, 0x40, 0x0f, 0x28,
+	     0x88, 0xa8, 0xac, 0x3d, 0x60, 0x05, 0x38, 0x1c, 0x06, 0x8a,
+	     0x7c, 0xc2, 0x65, 0xc0, 0x03, 0x00, 0xf2, 0x9e, 0xb3, 0xb8,
+	     0x2e, 0x02, 0xe6, 0x00, 0x5d, 0x07, 0x10, 0x92, 0x02, 0xbc,
+	     0x80, 0x94, 0x1a, 0x10, 0x05, 0xd0, 0x01, 0x2d, 0x00, 0x67,
+	     0x1f, 0x81, 0x8a, 0xc1, 0x00, 0x6b, 0xee, 0xec, 0x06, 0x00,
+	     0x7c, 0x64, 0x40, 0xed, 0x92, 0x76, 0x08, 0x8b, 0x76, 0x31,
+	     0x40, 0x09, 0x30, 0x01, 0xec, 0xab, 0x0f, 0x00, 0xf0, 0x82,
+	     0x9d, 0x00, 0x80, 0x5f, 0x58, 0x06, 0x40, 0x1a, 0x00, 0x80,
+	     0xb2, 0x6a, 0xd1, 0xb3, 0x51, 0xce, 0x78, 0x0e, 0xe0, 0x18,
+	     0x05, 0x6c, 0x1e, 0x80, 0x6d, 0x9f, 0xa4, 0x4b, 0x46, 0x4a,
+	     0x00, 0x8f, 0x34, 0x50, 0x2e, 0xcd, 0xd5, 0x80, 0xf9, 0xf1,
+	     0x0f, 0xc0, 0x6f, 0x01, 0x00, 0xb6, 0xbb, 0xa6, 0x1a, 0x75,
+	     0x72, 0x2e, 0x04, 0x0d, 0x05, 0x16, 0x42, 0x0d, 0x2c, 0x13,
+	     0x7f, 0x0d, 0x40, 0x22, 0xa8, 0xc6, 0x08, 0x73, 0xf4, 0xb6,
+	     0xf3, 0xa5, 0xaa, 0xf5, 0xfb, 0x0b, 0x01, 0x30, 0x00, 0x80,
+	     0x7e, 0x10, 0xe1, 0x50, 0x00, 0x12, 0x2b, 0x08, 0x20, 0xca,
+	     0xa7, 0x95, 0x56, 0x86, 0xb5, 0xcc, 0x3c, 0xe0, 0xf7, 0xad,
+	     0x00, 0x00, 0xa0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x40, 0x01,
+	     0xc0, 0xa1, 0x01, 0x04, 0x80, 0x10, 0x08, 0x00, 0x00, 0x00,
+	     0x9c, 0x55, 0x27, 0x16, 0x30, 0xc7, 0xd4, 0x3e, 0x92, 0x25,
+	     0x4d, 0x08, 0xa8, 0xc9, 0xd0, 0x00, 0x0b, 0x60, 0x76, 0x6c,
+	     0xf8, 0x2a, 0x74, 0x33, 0xa0, 0x11, 0x52, 0x71, 0x00, 0x2b,
+	     0xa4, 0x52, 0x0d, 0x20, 0xc5, 0x94, 0xf8, 0x66, 0x03, 0x30,
+	     0xaa, 0x84, 0xd9, 0x73, 0x00, 0x00, 0x50, 0x92, 0x80, 0x01,
+	     0x80, 0xb4, 0xf8, 0x04, 0x00, 0x08, 0x5e, 0x38, 0x54, 0x0b,
+	     0x00, 0x48, 0x5c, 0x1a, 0x75, 0x3e, 0xc0, 0xd9, 0x02, 0x02,
+	     0x3a, 0x00, 0x0a, 0x41, 0x56, 0xc6, 0x02, 0x4a, 0x55, 0x22,
+	     0xc0, 0xe7, 0x42, 0x60, 0x9d, 0x19, 0xee, 0x92, 0xe5, 0x5c,
+	     0x37, 0xbe, 0x00, 0x33, 0x5d, 0xb3, 0xeb, 0x00, 0x26, 0x79,
+	     0x00, 0x60, 0x03, 0xbe, 0x00, 0xd0, 0xca, 0x0a, 0x20, 0x83,
+	     0x00, 0x14, 0xd0, 0x16, 0x00, 0x00, 0xd0, 0xe1, 0xd2, 0xea,
+	     0x3f, 0x01, 0x40, 0x7c, 0xd6, 0x8a, 0xec, 0xe2, 0x77, 0xc3,
+	     0x8f, 0x02, 0x50, 0x17, 0x00, 0x3c, 0x20, 0x81, 0x04, 0xd4,
+	     0x14, 0xac, 0x21, 0xd5, 0x02, 0xe8, 0xd4, 0x01, 0x4f, 0x09,
+	     0x00, 0x00, 0x60, 0x86, 0x01, 0x00, 0xe1, 0x28, 0x9e, 0x49,
+	     0xaf, 0xb2, 0x80, 0x36, 0xe0, 0x06, 0x00, 0x00, 0xf6, 0x3f,
+	     0xfd, 0x67, 0x01, 0x00, 0x50, 0x03, 0x7d, 0x80, 0x04, 0x00,
+	     0x48, 0x00, 0x00, 0x5d, 0xc0, 0xda, 0xb5, 0xc2, 0x03, 0x00,
+	     0x86, 0x63, 0x5c, 0x43, 0xc3, 0x00, 0x00, 0xb2, 0x9f, 0x13,
+	     0x90, 0x5b, 0x1d, 0xfc, 0x4a, 0x00, 0xe0, 0x07, 0x08, 0x39,
+	     0x7c, 0x80, 0xb5, 0x6c, 0x7a, 0x51, 0xa2, 0x80, 0x95, 0x37,
+	     0x7c, 0x0f, 0x18, 0x7b, 0xb9, 0x81, 0x2f, 0x73, 0xcb, 0x24,
+	     0x23, 0x0f, 0x67, 0x32, 0x02, 0x00, 0x20, 0xd7, 0xf0, 0x0d,
+	     0x00, 0x20, 0x20, 0x51, 0x69, 0x00, 0xa6, 0xb0, 0xdc, 0x07,
+	     0x40, 0x56, 0xbb, 0x51, 0x11, 0x00, 0x10, 0xaf, 0xc4, 0xef,
+	     0xca, 0x4e, 0x14, 0xd4, 0x05, 0x00, 0xae, 0x54, 0x01, 0xc0,
+	     0xea, 0xb8, 0x9c, 0xe8, 0x00, 0x80, 0x96, 0xae, 0x01, 0xbe,
+	     0x00, 0x00, 0x00, 0x1d, 0x38, 0x59, 0x6b, 0x3a, 0x33, 0xb7,
+	     0xdb, 0x00, 0x00, 0x5d, 0x01, 0x22, 0x3c, 0x60, 0xd6, 0x04,
+	     0x43, 0x01, 0x38, 0x00, 0x20, 0x9d, 0x71, 0x00, 0xb4, 0x00,
+	     0xc0, 0xb0, 0x0a, 0x00, 0x74, 0xb0, 0x00, 0x6d, 0x1a, 0xcc,
+	     0x05, 0x20, 0xef, 0x5c, 0x21, 0x36, 0xf8, 0x4e, 0x9e, 0x2e,
+	     0x00, 0xc0, 0xd3, 0x0c, 0xb0, 0x03, 0x12, 0x80, 0xc5, 0xb8,
+	     0x2b, 0x00, 0x00, 0x86, 0x20, 0x40, 0x08, 0x90, 0x04, 0xfc,
+	     0x33, 0x93, 0x34, 0xe1, 0x86, 0xf0, 0x09, 0xea, 0x8a, 0x1e,
+	     0x32, 0xc8, 0xb5, 0x01, 0x44, 0xfb, 0xde, 0x40, 0xe0, 0x8e,
+	     0x23, 0x14, 0x81, 0xa1, 0xbe, 0xfe, 0x03, 0x3c, 0x00, 0x00,
+	     0x58, 0x59, 0x9e, 0x02, 0x00, 0x16, 0x23, 0x00, 0x40, 0x58,
+	     0xb9, 0xe0, 0xc9, 0x50, 0x61, 0x23, 0x93, 0x68, 0x01, 0xa6,
+	     0x82, 0xa8, 0xbd, 0x0c, 0x20, 0x3e, 0x5b, 0x80, 0xc7, 0x16,
+	     0xe0, 0x1c, 0x7a, 0xb7, 0x30, 0x34, 0x00, 0xe8, 0x01, 0x00,
+	     0x00, 0x18, 0x16, 0x23, 0x26, 0xa5, 0x01, 0xe6, 0x77, 0x00,
+	     0x1a, 0x10, 0x04, 0x0d, 0x72, 0x80, 0xb2, 0x84, 0xaa, 0x06,
+	     0x9c, 0x00, 0x80, 0x08, 0xe0, 0x58, 0xed, 0x09, 0x67, 0x8b,
+	     0x6d, 0xf0, 0x19, 0xd0, 0x3b, 0x5a, 0x00, 0x40, 0x1a, 0x00,
+	     0x29, 0x5c, 0x65, 0xe0, 0xcb, 0x12, 0xf1, 0x31, 0x82, 0x84,
+	     0x00, 0x57, 0x08, 0x00, 0x28, 0x0a, 0xa6, 0x17, 0x02, 0x0b,
+	     0xb0, 0x02, 0xbc, 0x9d, 0x9e, 0x49, 0x07, 0xe0, 0x04, 0x38,
+	     0xbd, 0x00, 0x80, 0x04, 0x50, 0xdc, 0x27, 0x75, 0x2b, 0x9c,
+	     0x01, 0x06, 0xe0, 0x5b, 0x43, 0xc5, 0x08, 0x2f, 0x40, 0x3f,
+	     0x03, 0x12, 0xec, 0x5d, 0xa9, 0x08, 0x00, 0xf0, 0xd1, 0x47,
+	     0x00, 0x00, 0x9d, 0x1a, 0x03, 0x00, 0x7f, 0xa7, 0x13, 0xba,
+	     0xa0, 0xe7, 0x08, 0xc9, 0x2c, 0x55, 0x24, 0x09, 0xa2, 0xa9,
+	     0x1c, 0xc0, 0x11, 0x60, 0x6a, 0x7b, 0x7f, 0xe9, 0x52, 0xbe,
+	     0x87, 0x03, 0x00, 0x72, 0x0e, 0x00, 0x00, 0x80, 0xb2, 0x00,
+	     0xf2, 0x9d, 0x3b, 0xa0, 0x08, 0x00, 0x28, 0x51, 0x05, 0xfc,
+	     0xf2, 0xab, 0x88, 0x92, 0x00, 0x00, 0x27, 0x00, 0x90, 0x1e,
+	     0xa1, 0x54, 0x01, 0x91, 0x4b, 0x07, 0x48, 0x2b, 0x88, 0x1f,
+	     0x70, 0xa1, 0x50, 0x8a, 0x55, 0x01, 0x47, 0x40, 0xdb, 0xde,
+	     0x3e, 0x00, 0x6a, 0x28, 0xc9, 0x7f, 0x98, 0x09, 0x13, 0x10,
+	     0x60, 0x50, 0x12, 0x00, 0x50, 0x01, 0x2e, 0x80, 0x2c, 0x28,
+	     0x0a, 0x00, 0x00, 0xfa, 0x64, 0x40, 0x3e, 0x00, 0xc0, 0xc8,
+	     0x85, 0x40, 0x00, 0x00, 0xd0, 0x93, 0x79, 0x00, 0x84, 0x16,
+	     0x00, 0x00, 0x3b, 0x80, 0xb7, 0x3f, 0x00, 0x60, 0x05, 0xb8,
+	     0xd2, 0xb4, 0x53, 0xc0, 0x07, 0x80, 0x3c, 0x03, 0xd0, 0xca,
+	     0x35, 0x20, 0x77, 0x05, 0x5c, 0x86, 0xc3, 0x44, 0xf3, 0x08,
+	     0x08, 0xf1, 0x0a, 0x80, 0x2f, 0xcd, 0x78, 0xc1, 0x9a, 0x7d,
+	     0xcc, 0xa5, 0x11, 0x00, 0x78, 0x03, 0xb4, 0x92, 0x8f, 0x59,
+	     0x6b, 0x12, 0xa5, 0x01, 0xf6, 0xdc, 0x43, 0x0e, 0x18, 0x66,
+	     0x43, 0x00, 0xc0, 0xed, 0x77, 0xcf, 0x68, 0xb1, 0xa3, 0x37,
+	     0x19, 0xe0, 0xdd, 0x99, 0x37, 0x8c, 0x15, 0x2d, 0x02, 0x09,
+	     0x5b, 0x3a, 0x22, 0x40, 0x26, 0x43, 0xbf, 0xf5, 0x36, 0x43,
+	     0x00, 0xe0, 0xee, 0x39, 0x8e, 0xe9, 0x4d, 0xc0, 0x07, 0xe0,
+	     0xd8, 0xf0, 0xbd, 0x53, 0x35, 0x00, 0x40, 0x35, 0x96, 0x88,
+	     0x96, 0x5c, 0x98, 0x69, 0x1c, 0x03, 0xe2, 0x43, 0xc0, 0xf8,
+	     0x4f, 0x02, 0xa8, 0x00, 0x00, 0xc0, 0x14, 0x3f, 0xb3, 0x3d,
+	     0x01, 0x00, 0x00, 0x40, 0x88, 0xa9, 0x29, 0x01, 0x0c, 0x77,
+	     0x74, 0xc3, 0x02, 0x60, 0xfc, 0xba, 0xd3, 0xc2, 0xe8, 0x4f,
+	     0x07, 0x99, 0x6f, 0x80, 0x08, 0x90, 0x03, 0x14, 0xe4, 0x00,
+	     0x40, 0x51, 0x38, 0x4e, 0x52, 0x2d, 0x09, 0x00, 0x80, 0xa4,
+	     0x54, 0x3a, 0x00, 0x80, 0x7d, 0x86, 0x0c, 0x98, 0x95, 0x01,
+	     0x5e, 0x80, 0x81, 0xee, 0xec, 0xe9, 0x4a, 0x00, 0x40, 0x19,
+	     0xe0, 0x47, 0x2f, 0x54, 0x14, 0x6c, 0x2a, 0x59, 0x06, 0xa4,
+	     0x00, 0x65, 0x09, 0x00, 0x35, 0xf8, 0x3e, 0x00, 0x40, 0x40,
+	     0x02, 0x24, 0x05, 0xd8, 0x8b, 0x5f, 0x80, 0xa4, 0x0c, 0xb0,
+	     0x05, 0x00, 0xcc, 0xe2, 0x01, 0xc0, 0x07, 0xe8, 0x00, 0x00,
+	     0x33, 0x27, 0x7e, 0xa1, 0xc6, 0x52, 0x80, 0x95, 0x96, 0x5b,
+	     0x01, 0x38, 0x00, 0x00, 0x27, 0x00, 0xa0, 0xee, 0x03, 0x5c,
+	     0x00, 0x40, 0xdb, 0x3c, 0x67, 0x03, 0xde, 0x00, 0x6e, 0x83,
+	     0x97, 0xe1, 0xfa, 0x61, 0x80, 0x38, 0x00, 0x0a, 0x10, 0xbf,
+	     0xde, 0x32, 0x00, 0x43, 0x05, 0x62, 0x97, 0xe3, 0x34, 0xbc,
+	     0x1b, 0x00, 0xa0, 0x2f, 0xfe, 0x43, 0x12, 0xa1, 0x04, 0xa8,
+	     0x01, 0x00, 0x00, 0xb7, 0x3f, 0xfd, 0x02, 0x00, 0x68, 0x00,
+	     0x8c, 0xf2, 0x7f, 0x47, 0xf0, 0x1c, 0x10, 0x59, 0x0a, 0xc0,
+	     0x71, 0x36, 0x7f, 0x0e, 0x80, 0x19, 0xf0, 0x44, 0xaa, 0x83,
+	     0x80, 0x4b, 0xd5, 0xf8, 0x4d, 0xf7, 0x02, 0xd9, 0xf1, 0xed,
+	     0xe2, 0xd2, 0xb1, 0x2a, 0x00, 0x40, 0x91, 0xd5, 0xa3, 0x03,
+	     0x00, 0x80, 0x21, 0x40, 0x01, 0x18, 0xe3, 0x57, 0x5a, 0x36,
+	     0x00, 0xd0, 0xe5, 0x45, 0x01, 0x35, 0xcf, 0xcf, 0xa3, 0xf5,
+	     0x1c, 0x01, 0xdc, 0x4c, 0x6c, 0x4c, 0xaa, 0x2b, 0xb1, 0x07,
+	     0x2c, 0x80, 0xe8, 0x07, 0xfc, 0x00, 0x5d, 0x11, 0x60, 0x30,
+	     0x9e, 0x02, 0x10, 0x00, 0xbc, 0x00, 0x00, 0xb8, 0xbe, 0x93,
+	     0x94, 0x9c, 0xf8, 0xc5, 0x04, 0xe4, 0xc5, 0x4e, 0x1c, 0x00,
+	     0x00, 0x10, 0x01, 0x00, 0x00, 0xb0, 0x5b, 0x9d, 0x86, 0xd9,
+	     0x01, 0x80, 0x59, 0xc6, 0x0a, 0x90, 0x30, 0x64, 0x54, 0xf1,
+	     0x10, 0xa0, 0x98, 0x1a, 0xb0, 0x6e, 0xc0, 0xd5, 0xeb, 0xcf,
+	     0x98, 0xc9, 0xe7, 0x06, 0x00, 0x00, 0x28, 0x28, 0xac, 0xe0,
+	     0x20, 0x1c, 0xdc, 0xab, 0x03, 0x00, 0x7e, 0x4d, 0xf6, 0xbe,
+	     0x0c, 0x08, 0x32, 0xfc, 0x36, 0x40, 0xfd, 0x93, 0xe7, 0x2d,
+	     0x99, 0x08, 0xf6, 0x02, 0x25, 0x05, 0xb6, 0x00, 0x40, 0xc8,
+	     0xbc, 0xa1, 0x00, 0x00, 0x41, 0x3b, 0x00, 0x70, 0xfa, 0x89,
+	     0x56, 0xd6, 0x04, 0x0c, 0x40, 0xa5, 0xfb, 0x61, 0x56, 0x00,
+	     0x00, 0xed, 0x03, 0x7c, 0x01, 0x00, 0xdf, 0x1e, 0xf3, 0x03,
+	     0x60, 0xa5, 0x00, 0xd5, 0x0e, 0x40, 0xb6, 0x56, 0x96, 0xb2,
+	     0x39, 0x40, 0xc5, 0x7a, 0xb7, 0x01, 0xac, 0x85, 0x8f, 0xa1,
+	     0xa2, 0x50, 0x77, 0x5d, 0x00, 0x80, 0x16, 0xab, 0xce, 0x7e,
+	     0xa4, 0xbe, 0x4a, 0xb3, 0x00, 0x00, 0x96, 0x00, 0x26, 0x00,
+	     0x41, 0x02, 0x30, 0x45, 0x73, 0xb9, 0x6f, 0xd6, 0x7e, 0xad,
+	     0x3a, 0xc6, 0x15, 0x12, 0x00, 0x00, 0xcd, 0x56, 0x1a, 0x25,
+	     0x20, 0x18, 0xbc, 0x03, 0xb0, 0xdb, 0x53, 0x01, 0xc0, 0x3b,
+	     0xc7, 0x6f, 0x93, 0x02, 0x1d, 0x60, 0x86, 0xd0, 0xf4, 0x5c,
+	     0x16, 0x00, 0xf0, 0x03, 0x00, 0xa6, 0x2e, 0x40, 0x65, 0x00,
+	     0x06, 0x00, 0x00, 0x00, 0xde, 0x2a, 0x0b, 0x28, 0xdd, 0x00,
+	     0x13, 0xc0, 0xb8, 0x26, 0x00, 0xfc, 0x04, 0x00, 0x36, 0xf0,
+	     0xbf, 0x06, 0x9c, 0xa9, 0xfd, 0x07, 0xe0, 0x83, 0x6a, 0x69,
+	     0x01, 0x7f, 0x0d, 0x04, 0xaa, 0x01, 0x70, 0x6d, 0x13, 0xc0,
+	     0x31, 0x01, 0xd8, 0x16, 0x6a, 0xc8, 0xe1, 0x57, 0xb0, 0x05,
+	     0xa0, 0x00, 0x08, 0xea, 0x47, 0x18, 0x06, 0x00, 0x4e, 0xb6,
+	     0x1e, 0x20, 0x9b, 0x03, 0x8c, 0x57, 0x80, 0x5f, 0x12, 0x06,
+	     0x03, 0x60, 0xaf, 0x00, 0x00, 0xf9, 0x0a, 0xb0, 0x25, 0xc4,
+	     0x7e, 0x40, 0xd7, 0x3b, 0x78, 0x03, 0x56, 0x4c, 0xc5, 0xc0,
+	     0xdc, 0x87, 0x4a, 0x01, 0xe7, 0x56, 0x0c, 0xe1, 0x08, 0x23,
+	     0x4a, 0x00, 0x66, 0x85, 0x94, 0x01, 0x14, 0x50, 0x55, 0x6e,
+	     0x03, 0x00, 0x00, 0x30, 0x8f, 0x0b, 0x40, 0x23, 0x61, 0x8e,
+	     0x11, 0x01, 0x48, 0x0c, 0x00, 0x4b, 0xf8, 0x01, 0x00, 0x38,
+	     0x08, 0x00, 0xe0, 0x07, 0x00, 0x3c, 0x72, 0x00, 0x00, 0x60,
+	     0x98, 0x73, 0x00, 0x80, 0xe7, 0x0c, 0x00, 0x40, 0x09, 0xf6,
+	     0x80, 0x6f, 0x00, 0x54, 0x4c, 0x73, 0x00, 0x2f, 0xa6, 0x05,
+	     0x46, 0x63, 0x79, 0x99, 0xe7, 0xad, 0x72, 0xbb, 0x3d, 0x01,
+	     0x9c, 0x6e, 0x71, 0x03, 0x80, 0x51, 0x0b, 0x91, 0x90, 0xf0,
+	     0xc8, 0x72, 0xcf, 0xa6, 0x70, 0x00, 0x40, 0x42, 0x04, 0x48,
+	     0x20, 0x00, 0x50, 0x3e, 0x47, 0xd5, 0x89, 0x63, 0x83, 0x00,
+	     0xad, 0xa1, 0x0b, 0x28, 0x17, 0x03, 0x63, 0xc0, 0x5d, 0x3a,
+	     0xb8, 0xaf, 0x0e, 0x00, 0x40, 0xfe, 0xf2, 0xb0, 0x03, 0x50,
+	     0x96, 0x28, 0xc0, 0xdb, 0xe6, 0xce, 0x1a, 0x00, 0x07, 0x16,
+	     0x30, 0x61, 0x54, 0x00, 0x2a, 0xc2, 0x48, 0xe7, 0x33, 0x00,
+	     0x00, 0x05, 0xac, 0x7f, 0x33, 0x8d, 0x56, 0xf0, 0x4f, 0x00,
+	     0x20, 0x03, 0xda, 0x9b, 0x01, 0x75, 0x04, 0x20, 0x0b, 0x28,
+	     0x03, 0xc4, 0xb8, 0xad, 0x07, 0xb0, 0xf9, 0x55, 0x00, 0x80,
+	     0xf4, 0x0f, 0xa0, 0xbb, 0x37, 0x67, 0xac, 0xa7, 0xc9, 0xcf,
+	     0x78, 0x14, 0xe7, 0x3e, 0xe2, 0x15, 0x04, 0x91, 0x39, 0x6f,
+	     0x30, 0x61, 0x69, 0x7d, 0x22, 0xf1, 0xc7, 0x5c, 0xc0, 0x0d,
+	     0xb0, 0xc7, 0x02, 0xd0, 0x70, 0x00, 0x08, 0x40, 0xfd, 0xea,
+	     0x65, 0xb6, 0xaa, 0x0e, 0x37, 0x22, 0x44, 0x72, 0x65, 0xfe,
+	     0x8c, 0x0b, 0x68, 0x03, 0x1e, 0x2a, 0xf9, 0x1b, 0x02, 0x00,
+	     0x58, 0x44, 0x0d, 0x80, 0x00, 0xb0, 0x05, 0x68, 0x48, 0x51,
+	     0x80, 0xab, 0x10, 0x04, 0x14, 0x00, 0x13, 0xbe, 0x78, 0xda,
+	     0xfe, 0x56, 0x00, 0xb8, 0x0d, 0xb5, 0x62, 0x99, 0x03, 0x4c,
+	     0x12, 0x66, 0xe5, 0x39, 0xa2, 0x02, 0x00, 0x62, 0x4f, 0xf0,
+	     0x0a, 0x58, 0x01, 0xa8, 0x54, 0x80, 0x9e, 0x8c, 0x83, 0x00,
+	     0xd0, 0x00, 0xc0, 0xd3, 0x22, 0xc9, 0x88, 0x01, 0x00, 0x40,
+	     0xee, 0xee, 0x05, 0x70, 0x34, 0x65, 0x80, 0x15, 0x00, 0x08,
+	     0x03, 0x5c, 0x00, 0x11, 0x0d, 0x00, 0xb0, 0x03, 0xe6, 0x06,
+	     0x6d, 0x0a, 0x60, 0xf8, 0x7c, 0x44, 0x38, 0x2b, 0x60, 0x99,
+	     0x00, 0x00, 0x00, 0x88, 0xd4, 0xfb, 0xd6, 0x03, 0xf8, 0x01,
+	     0x00, 0x00, 0x66, 0xdb, 0x03, 0xe0, 0xb5, 0x82, 0xc1, 0x4e,
+	     0xaf, 0x19, 0x57, 0xb4, 0xcf, 0xdf, 0x1a, 0x00, 0xf8, 0xf3,
+	     0x93, 0x80, 0x9f, 0x0b, 0x70, 0x06, 0x00, 0x00, 0x06, 0xf7,
+	     0x0d, 0x40, 0x2b, 0x2e, 0x01, 0x3a, 0xfa, 0x68, 0x3c, 0xf8,
+	     0x44, 0xc9, 0x25, 0xe0, 0xb3, 0xb0, 0x87, 0x06, 0x2f, 0x80,
+	     0x72, 0x23, 0xcf, 0xa6, 0xde, 0x6b, 0x80, 0x3f, 0x00, 0x00,
+	     0x09, 0x25, 0x00, 0x80, 0xed, 0xfc, 0x07, 0x10, 0x03, 0xe4,
+	     0x00, 0xfa, 0x7c, 0x07, 0x48, 0x66, 0x97, 0xfc, 0x19, 0x07,
+	     0x80, 0x79, 0x02, 0xce, 0x00, 0x3d, 0xc0, 0xff, 0x43, 0x01,
+	     0x00, 0xce, 0x11, 0x80, 0xc9, 0xe5, 0x02, 0x70, 0x54, 0x40,
+	     0x13, 0x00, 0xd0, 0x62, 0x01, 0xc2, 0xf2, 0x0a, 0x3d, 0x4f,
+	     0x92, 0x0d, 0x00, 0x9d, 0x85, 0x5a, 0x59, 0x5c, 0xde, 0x45,
+	     0x78, 0x4a, 0x68, 0xee, 0x1e, 0x64, 0x01, 0xf0, 0xba, 0x01,
+	     0x00, 0x84, 0xd9, 0x00, 0x00, 0x40, 0x91, 0x91, 0xef, 0x01,
+	     0x8b, 0xaf, 0x60, 0x60, 0xfa, 0x64, 0x01, 0x00, 0x80, 0xcc,
+	     0x45, 0x5d, 0x01, 0xdc, 0xed, 0x9b, 0x0b, 0x00, 0x00, 0xf8,
+	     0x93, 0x38, 0x8e, 0x14, 0xf0, 0xa3, 0xb5, 0xe6, 0x78, 0x80,
+	     0x02, 0xd0, 0x09, 0x39, 0xdb, 0xba, 0xc3, 0x2a, 0x04, 0x00,
+	     0x00, 0xda, 0x7c, 0x00, 0x29, 0x19, 0xcd, 0x1e, 0x01, 0x80,
+	     0x60, 0xeb, 0x6c, 0x9a, 0x99, 0x00, 0x00, 0x00, 0x58, 0x03,
+	     0x00, 0x50, 0x69, 0x00, 0xc0, 0x07, 0x50, 0x05, 0x02, 0x0e,
+	     0x1a, 0x1f, 0xcc, 0x87, 0x68, 0xa9, 0x12, 0x1c, 0x0c, 0xe0,
+	     0xbf, 0x53, 0xbe, 0x57, 0x46, 0x83, 0x14, 0xa0, 0x61, 0x00,
+	     0x52, 0x03, 0x00, 0x83, 0x01, 0x60, 0x01, 0xfa, 0x80, 0xd7,
+	     0x95, 0x12, 0x7c, 0x6b, 0x3b, 0x3a, 0x35, 0xa0, 0xe7, 0xda,
+	     0x03, 0xbc, 0x0a, 0x56, 0x1b, 0x20, 0x53, 0x0c, 0x00, 0xbd,
+	     0x32, 0x40, 0xa3, 0x03, 0x54, 0x7c, 0x00, 0xf7, 0x3c, 0x90,
+	     0xa5, 0x02, 0x98, 0xca, 0xff, 0x04, 0xa0, 0x01, 0xa4, 0x01,
+	     0x52, 0xbc, 0x5d, 0x0a, 0x20, 0x02, 0x00, 0x0d, 0xcf, 0x28,
+	     0xfc, 0x01, 0x00, 0x00, 0x00, 0x57, 0x77, 0xfc, 0xa0, 0x12,
+	     0x00, 0x88, 0x22, 0xf2, 0x69, 0x17, 0x93, 0x01, 0x3e, 0xee,
+	     0x16, 0x07, 0x58, 0xb0, 0xfc, 0x8a, 0xfe, 0xf4, 0x0d, 0xb0,
+	     0xdb, 0xfc, 0x3a, 0x00, 0x80, 0x14, 0x43, 0x03, 0x00, 0x63,
+	     0x5e, 0x1b, 0x2f, 0x00, 0x64, 0x00, 0x8a, 0x9e, 0x05, 0x00,
+	     0x98, 0x03, 0x00, 0x76, 0x21, 0xc0, 0x35, 0x67, 0xfa, 0x00,
+	     0x9c, 0xfa, 0xfb, 0xc9, 0xf4, 0x04, 0x39, 0x1b, 0x00, 0x00,
+	     0x90, 0x66, 0x2b, 0x2f, 0x00, 0x80, 0x41, 0x47, 0x09, 0xbb,
+	     0x01, 0xa6, 0x90, 0xe7, 0xf6, 0x45, 0xde, 0x01, 0xde, 0x26,
+	     0x40, 0x39, 0x46, 0xbd, 0x0f, 0x79, 0x86, 0x61, 0x7e, 0xb7,
+	     0x90, 0x6d, 0x6d, 0x10, 0xc4, 0x33, 0xe9, 0x79, 0x0a, 0x34,
+	     0x80, 0x06, 0xa0, 0x06, 0xf8, 0x01, 0x8c, 0x57, 0x19, 0x20,
+	     0x03, 0xf0, 0x00, 0x9b, 0x44, 0xd8, 0xa3, 0x07, 0xec, 0xce,
+	     0xee, 0x53, 0x99, 0x02, 0xe0, 0x29, 0x01, 0x74, 0x98, 0x41,
+	     0x41, 0x00, 0x40, 0x01, 0x40, 0x33, 0xdc, 0x50, 0x05, 0x00,
+	     0xfa, 0x2f, 0x80, 0x99, 0xac, 0x35, 0x00, 0xe6, 0x13, 0x40,
+	     0xb8, 0x27, 0x06, 0xd4, 0x9b, 0xbb, 0x40, 0x7b, 0xbb, 0x4d,
+	     0x03, 0x22, 0x2d, 0xa7, 0x12, 0x14, 0x3b, 0xa0, 0x90, 0x6e,
+	     0x6f, 0xe7, 0xa3, 0xeb, 0xaa, 0x10, 0x61, 0x1b, 0x40, 0xe1,
+	     0x36, 0x0c, 0x1e, 0x7c, 0x16, 0x80, 0xba, 0x37, 0xd7, 0xa3,
+	     0x00, 0x73, 0x86, 0x0c, 0x28, 0x25, 0xc5, 0xf5, 0x27, 0x00,
+	     0x55, 0x46, 0x67, 0xbc, 0x53, 0x00, 0xc0, 0x0d, 0x00, 0xcc,
+	     0x1a, 0x00, 0x1c, 0x40, 0xa1, 0x4f, 0x6c, 0xa1, 0x1e, 0xea,
+	     0x68, 0xf5, 0x02, 0x00, 0x00, 0x00, 0xc0, 0xb5, 0x7b, 0x01,
+	     0x00, 0x2e, 0x00, 0x14, 0x1b, 0xa3, 0x03, 0x84, 0xb9, 0x6d,
+	     0x21, 0x80, 0xa3, 0x07, 0x14, 0x6f, 0x81, 0x05, 0xa0, 0x06,
+	     0xc6, 0xf7, 0x6d, 0x9a, 0x4d, 0xf6, 0x0f, 0x80, 0x79, 0x46,
+	     0x76, 0x88, 0xcc, 0xdb, 0xa2, 0x5c, 0x6a, 0xf4, 0x73, 0x21,
+	     0xec, 0x04, 0x78, 0x3a, 0x00, 0xe4, 0x1d, 0x0f, 0x00, 0x00,
+	     0x52, 0x80, 0x0a, 0xde, 0xdd, 0xe6, 0x9a, 0x54, 0x5c, 0x40,
+	     0x26, 0xea, 0xcb, 0xb9, 0x6b, 0xa0, 0x21, 0x0b, 0x60, 0x46,
+	     0xf8, 0x01, 0x29, 0x4c, 0x03, 0xd0, 0x4c, 0x00, 0xd2, 0x80,
+	     0xf8, 0xfc, 0xdd, 0x4d, 0x64, 0x01, 0x6f, 0x0c, 0x3f, 0xf8,
+	     0x4d, 0x9c, 0x01, 0x1e, 0xd3, 0x1d, 0x30, 0x01, 0x00, 0x40,
+	     0x00, 0x38, 0x8e, 0xc2, 0x4f, 0xae, 0xa5, 0x0a, 0x4d, 0x14,
+	     0xf0, 0x8e, 0x84, 0xe2, 0x2c, 0x1a, 0x61, 0xa9, 0xdf, 0x86,
+	     0x24, 0x7b, 0x06, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x5f,
+	     0x18, 0xc3, 0x78, 0x4b, 0x75, 0x00, 0x80, 0xd2, 0x38, 0xa0,
+	     0x00, 0x00, 0x02, 0x80, 0xe2, 0x9a, 0xb3, 0x00, 0xfe, 0x55,
+	     0xc0, 0xd4, 0x71, 0x04, 0xfc, 0x00, 0x39, 0xc0, 0x34, 0xfe,
+	     0x07, 0xc8, 0x7a, 0xff, 0x3b, 0x60, 0x55, 0xf3, 0x8a, 0x00,
+	     0x11, 0x46, 0x5c, 0x0d, 0x90, 0x9d, 0x01, 0x00, 0x94, 0xfa,
+	     0xc2, 0x02, 0x08, 0x01, 0x00, 0xa0, 0xfc, 0x03, 0xc0, 0x9a,
+	     0xa4, 0xd3, 0x3c, 0xa3, 0xdd, 0x7e, 0xa2, 0x81, 0x80, 0x67,
+	     0x79, 0xfe, 0xb8, 0x50, 0xc0, 0xe5, 0x02, 0xc0, 0x1d, 0x2d,
+	     0x3d, 0xa6, 0x9e, 0xb2, 0x70, 0x70, 0xa7, 0x01, 0x18, 0xcc,
+	     0x2d, 0xc0, 0x02, 0x58, 0x35, 0xd5, 0x43, 0x23, 0x20, 0xc2,
+	     0x66, 0x4e, 0x2f, 0x45, 0x97, 0x87, 0xad, 0x8b, 0x90, 0x7a,
+	     0xf7, 0xb9, 0x56, 0x00, 0xa8, 0xb7, 0x01, 0x69, 0x9e, 0x11,
+	     0x90, 0x4c, 0x4f, 0x00, 0x3c, 0xd4, 0xfa, 0x5a, 0xe6, 0x6b,
+	     0xe5, 0x00, 0x20, 0xe0, 0x79, 0x89, 0x02, 0x00, 0x80, 0x0a,
+	     0x40, 0xa1, 0x94, 0xe1, 0xf8, 0x80, 0x2b, 0x61, 0x07, 0x00,
+	     0x9c, 0x28, 0x00, 0x80, 0x5e, 0xdd, 0x4d, 0x03, 0x82, 0x03,
+	     0xa3, 0x1f, 0x50, 0xb6, 0x02, 0x38, 0x7d, 0xc0, 0x8c, 0x30,
+	     0x02, 0x30, 0x01, 0x00, 0x80, 0x39, 0x92, 0xe8, 0x97, 0x95,
+	     0x52, 0x80, 0xa4, 0xd1, 0xf6, 0x9c, 0xc4, 0xcc, 0xb2, 0x34,
+	     0x10, 0x01, 0x80, 0xa1, 0x80, 0xbf, 0x93, 0x38, 0x82, 0x97,
+	     0xe4, 0x80, 0x01, 0x12, 0xc0, 0x52, 0xf0, 0xe5, 0x5f, 0x80,
+	     0x03, 0x90, 0xe5, 0x90, 0x2e, 0x31, 0x04, 0x9c, 0x0f, 0xe0,
+	     0x02, 0xfe, 0x00, 0x9b, 0xc1, 0x06, 0x88, 0x2f, 0x3f, 0x35,
+	     0x00, 0x00, 0xf0, 0x07, 0x2c, 0x2a, 0xc3, 0x2d, 0xad, 0x57,
+	     0xd5, 0x68, 0x1f, 0x2a, 0xc0, 0x05, 0x30, 0xd7, 0xd3, 0x1d,
+	     0xe5, 0x26, 0x40, 0x1c, 0x05, 0x38, 0x99, 0x50, 0x00, 0x00,
+	     0x00, 0xe8, 0x56, 0x7f, 0x01, 0x00, 0xd5, 0xa9, 0xc5, 0x00,
+	     0x0e, 0xd1, 0x10, 0x20, 0x13, 0x67, 0x03, 0xfc, 0xdb, 0xf9,
+	     0x6b, 0x80, 0x01, 0x38, 0x01, 0x91, 0x10, 0x1c, 0x60, 0x04,
+	     0x00, 0x00, 0xee, 0x71, 0xbb, 0x01, 0x00, 0x00, 0xe4, 0xaa,
+	     0x32, 0x00, 0x40, 0x03, 0x08, 0x01, 0x80, 0x87, 0x07, 0x70,
+	     0x03, 0x98, 0x28, 0xf1, 0x3d, 0x60, 0x9b, 0x52, 0x28, 0x00,
+	     0xed, 0x32, 0x33, 0x20, 0x69, 0x1f, 0x9e, 0xfc, 0x7a, 0x17,
+	     0xc0, 0x53, 0xec, 0x9a, 0x88, 0x17, 0x20, 0x89, 0x1c, 0xac,
+	     0xa1, 0xe5, 0x27, 0x40, 0xe8, 0xd7, 0x00, 0xd0, 0x49, 0xc0,
+	     0x00, 0x00, 0x00, 0x58, 0xc6, 0x14, 0x00, 0x62, 0x5b, 0x06,
+	     0xd0, 0x76, 0x0b, 0x80, 0x6d, 0x7a, 0x27, 0x01, 0x90, 0x70,
+	     0x87, 0x95, 0xbf, 0xf4, 0x9a, 0x00, 0x00, 0x80, 0x0e, 0xd4,
+	     0x19, 0x97, 0x44, 0xea, 0xb2, 0x79, 0x92, 0x03, 0x01, 0x64,
+	     0x8a, 0x4c, 0x10, 0xe2, 0x98, 0x27, 0x3c, 0x72, 0x86, 0x87,
+	     0x0d, 0x98, 0x44, 0x01, 0x00, 0x7d, 0x0a, 0x00, 0x30, 0x75,
+	     0x01, 0x19, 0xe6, 0x96, 0xee, 0xe7, 0x7b, 0x00, 0x00, 0x00,
+	     0x61, 0x08, 0x30, 0x1c, 0xa1, 0x61, 0xf4, 0x6f, 0x0d, 0x00,
+	     0x88, 0x61, 0x80, 0x8b, 0x19, 0xf0, 0x01, 0x3c, 0x60, 0x80,
+	     0x25, 0xe0, 0xb7, 0x01, 0x00, 0xb2, 0x2e, 0x00, 0x23, 0x0b,
+	     0xf0, 0xea, 0x34, 0x9c, 0xd4, 0xd7, 0x0c, 0x00, 0x88, 0xb4,
+	     0x67, 0x11, 0xbb, 0x91, 0xfd, 0x03, 0x00, 0x00, 0x1f, 0x2a,
+	     0xee, 0xd3, 0x01, 0xd4, 0x8a, 0x42, 0xee, 0x0b, 0x18, 0x02,
+	     0xb8, 0x78, 0x9f, 0x76, 0x09, 0xac, 0x09, 0x23, 0x80, 0xed,
+	     0x10, 0xa6, 0xe2, 0x1f, 0x00, 0x7d, 0x3d, 0x00, 0x00, 0xf0,
+	     0xb7, 0xe0, 0x27, 0x70, 0x01, 0x40, 0x56, 0x03, 0xdc, 0x97,
+	     0xa5, 0x0a, 0x01, 0x00, 0x8c, 0x3a, 0x00, 0x40, 0x2e, 0x61,
+	     0xae, 0x82, 0xf3, 0x37, 0x1c, 0xc0, 0x1c, 0x63, 0x65, 0x01,
+	     0xef, 0x3d, 0x98, 0x29, 0xf4, 0xa7, 0x1b, 0x35, 0x1f, 0x00,
+	     0x30, 0xeb, 0xf6, 0xd1, 0x13, 0x9e, 0xac, 0x01, 0xe8, 0x05,
+	     0xa7, 0x72, 0x6d, 0xf5, 0x05, 0x10, 0x02, 0x70, 0x92, 0xe2,
+	     0x07, 0x40, 0x7b, 0xb2, 0x19, 0x86, 0xbd, 0x5d, 0xc1, 0x1f,
+	     0x63, 0x01, 0x32, 0x80, 0x5b, 0x94, 0x40, 0x17, 0xf3, 0xcd,
+	     0x92, 0x11, 0x73, 0x95, 0x00, 0x00, 0xe5, 0x3f, 0x89, 0x04,
+	     0x00, 0x00, 0x02, 0x21, 0x40, 0x7f, 0x0c, 0xe3, 0x60, 0x54,
+	     0x80, 0x03, 0x00, 0x80, 0x02, 0x00, 0x5a, 0xef, 0x32, 0xa0,
+	     0x73, 0x5f, 0x7d, 0x97, 0x3f, 0x39, 0x38, 0x09, 0x88, 0x00,
+	     0x3a, 0x4c, 0x20, 0x1e, 0x00, 0xe8, 0x7b, 0xb1, 0xd4, 0x9b,
+	     0x1d, 0xf0, 0x05, 0xf4, 0x3b, 0x80, 0xf7, 0x71, 0xa0, 0x01,
+	     0x00, 0x44, 0x8b, 0x11, 0xc0, 0xb0, 0xb6, 0xdb, 0x01, 0xb0,
+	     0x1e, 0xa0, 0xb2, 0x64, 0x00, 0xf8, 0x27, 0x12, 0xc0, 0x07,
+	     0xe8, 0x4d, 0x9f, 0xb1, 0xc3, 0x9b, 0xe1, 0x03, 0x64, 0xb9,
+	     0x00, 0x1a, 0x20, 0x1f, 0x04, 0x00, 0xa2, 0x68, 0x66, 0xe4,
+	     0x0e, 0xe0, 0x41, 0xa3, 0x0d, 0x18, 0x1a, 0xc0, 0xc5, 0x7e,
+	     0xdd, 0x00, 0x93, 0x31, 0xbe, 0xf6, 0x5a, 0x88, 0x0b, 0x40,
+	     0xde, 0x83, 0x46, 0x42, 0x99, 0x80, 0x24, 0x60, 0x6d, 0x00,
+	     0xf4, 0x00, 0x80, 0xd1, 0x14, 0x40, 0x2b, 0x98, 0xd1, 0x00,
+	     0x40, 0xd8, 0x07, 0xa0, 0x9d, 0x82, 0xe5, 0xfc, 0x31, 0xce,
+	     0x84, 0xe8, 0xa4, 0x00, 0xd6, 0x18, 0x00, 0x60, 0x5f, 0x39,
+	     0x6a, 0x40, 0x0a, 0x00, 0xa0, 0xf9, 0xe5, 0x84, 0x1f, 0xc0,
+	     0x05, 0xf8, 0xaa, 0x70, 0x80, 0xda, 0xde, 0x3d, 0x03, 0x00,
+	     0x74, 0x00, 0x03, 0xdf, 0x09, 0xe0, 0x1a, 0xf3, 0x4e, 0xf1,
+	     0x1f, 0xbc, 0xe5, 0x48, 0x33, 0x30, 0xc0, 0x42, 0x8a, 0x06,
+	     0x94, 0x4b, 0x0a, 0x31, 0x00, 0x70, 0xf6, 0x02, 0xfa, 0x00,
+	     0x00, 0x00, 0xfb, 0x03, 0x84, 0xa1, 0x60, 0x80, 0xb7, 0xfa,
+	     0x86, 0xa0, 0xea, 0x34, 0x27, 0x80, 0xf0, 0x94, 0xdf, 0x01,
+	     0x78, 0x3e, 0xc0, 0x0e, 0x88, 0x01, 0x22, 0x00, 0x2c, 0x10,
+	     0xeb, 0xb8, 0x75, 0x00, 0x31, 0x91, 0x7c, 0x1a, 0x8b, 0xea,
+	     0x00, 0x00, 0x0b, 0x42, 0x08, 0xe8, 0x89, 0xc7, 0x60, 0x2e,
+	     0x00, 0x20, 0x1b, 0x01, 0x16, 0xee, 0x48, 0x15, 0x80, 0xd0,
+	     0x41, 0x01, 0x1e, 0xc0, 0x04, 0xa0, 0x46, 0xb0, 0x3b, 0x1c,
+	     0x80, 0x01, 0xe0, 0x03, 0x00, 0xb4, 0x00, 0x90, 0x4b, 0x9a,
+	     0xda, 0x79, 0x89, 0x83, 0xa4, 0x10, 0x59, 0xac, 0x2b, 0x01,
+	     0x5b, 0x01, 0x25, 0x3e, 0x01, 0x90, 0x01, 0xea, 0x36, 0x00,
+	     0x50, 0x50, 0xc3, 0x68, 0x00, 0xc0, 0x59, 0x63, 0x96, 0xbc,
+	     0x01, 0x52, 0x16, 0xa0, 0x22, 0x07, 0xbb, 0xbd, 0x45, 0x00,
+	     0xe0, 0x17, 0x41, 0x24, 0x49, 0x20, 0x2d, 0x13, 0xd0, 0x27,
+	     0x72, 0x00, 0x28, 0xc0, 0x1a, 0x00, 0xe8, 0x25, 0x01, 0xee,
+	     0xcb, 0xad, 0xf0, 0x30, 0xfd, 0x1a, 0x85, 0x13, 0x00, 0x72,
+	     0x0b, 0xe1, 0xb7, 0xa6, 0x45, 0x18, 0x10, 0x02, 0x6b, 0x3d,
+	     0xeb, 0x30, 0x00, 0x40, 0xfb, 0x0c, 0x01, 0x55, 0x99, 0x51,
+	     0x09, 0x37, 0x00, 0x00, 0xbb, 0x84, 0x14, 0x00, 0x00, 0x78,
+	     0xf0, 0x80, 0x3e, 0x45, 0x4d, 0x7b, 0x2c, 0xd0, 0x60, 0x00,
+	     0x6e, 0x0c, 0x00, 0xf8, 0x05, 0x00, 0x80, 0x40, 0x13, 0x66,
+	     0x1f, 0xd9, 0x0b, 0x6b, 0x24, 0x0b, 0x80, 0x02, 0x76, 0x80,
+	     0x73, 0x6a, 0xa8, 0x3c, 0xc6, 0x79, 0xd7, 0xb7, 0x02, 0x00,
+	     0x08, 0x3b, 0x30, 0x00, 0xae, 0xf6, 0x06, 0xc8, 0x43, 0x05,
+	     0x05, 0x00, 0x63, 0x3f, 0xc7, 0xda, 0xde, 0x38, 0x12, 0x20,
+	     0x0a, 0x10, 0x03, 0x7c, 0x51, 0x1b, 0xd3, 0x04, 0x18, 0xef,
+	     0x3f, 0x7c, 0xb8, 0x6d, 0xb3, 0x08, 0xa8, 0xb5, 0xcd, 0xcb,
+	     0x45, 0x2f, 0x00, 0x00, 0xb8, 0x36, 0xd7, 0x1d, 0x00, 0x00,
+	     0x42, 0x01, 0x32, 0x00, 0xa0, 0x5e, 0x03, 0x01, 0x5e, 0xcf,
+	     0x34, 0x40, 0x07, 0x37, 0x79, 0x79, 0x27, 0x28, 0x7f, 0xc9,
+	     0x01, 0xdc, 0x01, 0x9c, 0xb8, 0x8c, 0xe7, 0xa1, 0xe3, 0x62,
+	     0x47, 0x00, 0xde, 0xb2, 0x0e, 0xac, 0x39, 0xb6, 0x4a, 0xdb,
+	     0x6f, 0x66, 0x3b, 0x01, 0x9a, 0xb1, 0xf1, 0x32, 0x97, 0xf7,
+	     0x8b, 0xd2, 0xe3, 0xaf, 0x18, 0x03, 0x48, 0xc3, 0x00, 0x7a,
+	     0xf3, 0xc1, 0x03, 0x48, 0x31, 0x80, 0xf7, 0xe2, 0x59, 0x75,
+	     0x03, 0x92, 0x2d, 0x00, 0xb5, 0x85, 0x6f, 0x52, 0x3b, 0x80,
+	     0x13, 0x08, 0xd0, 0xc7, 0x64, 0xd7, 0x5f, 0x55, 0x9d, 0x42,
+	     0x39, 0xa2, 0x3a, 0x99, 0x3c, 0xc0, 0x7e, 0xc0, 0xe9, 0x39,
+	     0x00, 0xc0, 0x77, 0xb0, 0x05, 0xc4, 0x21, 0x19, 0x31, 0x16,
+	     0x3c, 0x7d, 0xf6, 0x78, 0xdd, 0x3b, 0x40, 0xc4, 0xf6, 0xc2,
+	     0x94, 0x19, 0xc0, 0x58, 0x28, 0xee, 0x06, 0x59, 0x6d, 0x40,
+	     0x1e, 0x00, 0x00, 0x4c, 0x00, 0x21, 0x55, 0x61, 0xee, 0xfb,
+	     0x1f, 0x40, 0x33, 0x1f, 0x80, 0x02, 0xf0, 0x01, 0xf6, 0xd8,
+	     0x31, 0x00, 0x00, 0x20, 0xd8, 0x00, 0xb1, 0xac, 0xc3, 0xe3,
+	     0x17, 0xe3, 0x3b, 0xab, 0x3f, 0x60, 0x6c, 0xe2, 0xdd, 0x01,
+	     0x8e, 0x0e, 0x09, 0x00, 0xc0, 0xa2, 0x6c, 0x35, 0x00, 0x80,
+	     0x8e, 0x81, 0x88, 0x6f, 0xfc, 0xa0, 0x42, 0xcb, 0x03, 0x3c,
+	     0x01, 0xd1, 0x3a, 0x40, 0x41, 0xe5, 0x53, 0x55, 0x0b, 0x15,
+	     0x08, 0x00, 0x12, 0xac, 0x53, 0x7a, 0x2b, 0x00, 0x30, 0x03,
+	     0x08, 0xcc, 0x00, 0xb9, 0xf5, 0xf7, 0x02, 0x64, 0x01, 0x5f,
+	     0xcf, 0x3b, 0x02, 0x00, 0xac, 0x01, 0x00, 0xcc, 0x0e, 0x00,
+	     0x8c, 0x90, 0x50, 0x3e, 0x70, 0x15, 0xda, 0xf6, 0x86, 0x72,
+	     0xaf, 0x7b, 0xa9, 0x79, 0x13, 0x64, 0xa7, 0x11, 0x95, 0x1a,
+	     0x40, 0x01, 0x7c, 0x00, 0x00, 0xc0, 0xa1, 0x28, 0x05, 0xbc,
+	     0x2f, 0x80, 0xc5, 0x18, 0x70, 0xca, 0x44, 0x6b, 0x09, 0x30,
+	     0xe0, 0x0f, 0x78, 0x19, 0xd3, 0x26, 0x00, 0x1b, 0x0a, 0x00,
+	     0x00, 0xae, 0x4c, 0x90, 0x33, 0x06, 0x18, 0x6f, 0xcb, 0x48,
+	     0x00, 0x00, 0x40, 0x3f, 0x13, 0x01, 0xb8, 0xf5, 0x48, 0xbb,
+	     0x3c, 0x03, 0xb8, 0x00, 0x00, 0x20, 0xdc, 0xb9, 0x01, 0x7e,
+	     0x00, 0x74, 0x1c, 0x70, 0x02, 0x74, 0x01, 0xba, 0xaf, 0xb8,
+	     0xf3, 0x03, 0x00, 0x6e, 0x00, 0xc0, 0x65, 0xcc, 0x62, 0xe5,
+	     0x36, 0x08, 0xac, 0x77, 0x09, 0xd8, 0x4f, 0x4a, 0xc8, 0x0f,
+	     0xda, 0x64, 0x07, 0xd8, 0xac, 0x29, 0x07, 0xc4, 0xd9, 0x1d,
+	     0xdc, 0xa0, 0x80, 0x34, 0x48, 0xc1, 0x02, 0xf4, 0x65, 0x00,
+	     0x33, 0x00, 0xde, 0xa3, 0x02, 0x00, 0x60, 0x0b, 0xc0, 0xca,
+	     0xac, 0x66, 0x0f, 0x6e, 0xc0, 0x4c, 0x8f, 0x03, 0x34, 0x2e,
+	     0x71, 0x40, 0x47, 0xdb, 0xa2, 0xaf, 0x0e, 0x00, 0x1b, 0x98,
+	     0x2a, 0x00, 0x40, 0x23, 0x46, 0xc0, 0x1c, 0x60, 0x01, 0x4c,
+	     0x1c, 0x69, 0x80, 0x44, 0xdf, 0xea, 0x1e, 0xcc, 0x38, 0x00,
+	     0x0a, 0x0e, 0x38, 0x5b, 0x7f, 0x99, 0xdd, 0x06, 0x60, 0x01,
+	     0xd8, 0x00, 0x23, 0xcd, 0xca, 0x74, 0x08, 0xcd, 0x44, 0x54,
+	     0x91, 0x76, 0xaa, 0xbd, 0x02, 0x7a, 0x00, 0x36, 0x60, 0xe3,
+	     0xb8, 0x03, 0x76, 0x97, 0x0c, 0x60, 0x03, 0x38, 0x14, 0xbe,
+	     0xaa, 0x12, 0x00, 0x50, 0xa8, 0x03, 0x5c, 0x9b, 0xf3, 0x93,
+	     0x95, 0x77, 0x20, 0x50, 0xd1, 0x3c, 0x60, 0x5c, 0x07, 0xb0,
+	     0x00, 0x80, 0xdf, 0xd0, 0x7d, 0x74, 0x99, 0x00, 0x80, 0xe7,
+	     0xc2, 0x94, 0xed, 0xf9, 0x51, 0x66, 0x00, 0x57, 0x45, 0xc2,
+	     0x0b, 0xa9, 0x00, 0x80, 0x89, 0x03, 0x78, 0xcb, 0x6b, 0x85,
+	     0xb7, 0xb3, 0xd6, 0xd9, 0x03, 0x00, 0xee, 0xc0, 0x9b, 0x0a,
+	     0x10, 0x92, 0xc7, 0x6d, 0xf3, 0xab, 0x08, 0x83, 0x87, 0x00,
+	     0xaf, 0x2b, 0xe0, 0x2c, 0x8f, 0x1b, 0x2b, 0x25, 0x80, 0x22,
+	     0x14, 0x07, 0x48, 0x01, 0x00, 0x80, 0x33, 0xe2, 0x50, 0x00,
+	     0x00, 0x0a, 0x12, 0x00, 0x00, 0xb0, 0x65, 0x05, 0x73, 0x31,
+	     0xa0, 0x1d, 0xec, 0xe2, 0x8a, 0x58, 0x40, 0x06, 0x70, 0x37,
+	     0xeb, 0x8e, 0x00, 0xc0, 0x14, 0xa0, 0xb0, 0x29, 0xb7, 0x0f,
+	     0x7f, 0x13, 0x60, 0x05, 0xa0, 0x00, 0xf4, 0xe4, 0x13, 0xd0,
+	     0x0b, 0x83, 0x2f, 0x81, 0x0b, 0xc1, 0x0f, 0xf0, 0x02, 0x9c,
+	     0x13, 0x32, 0xd3, 0x23, 0xcc, 0x00, 0xae, 0x00, 0xc0, 0xda,
+	     0x06, 0xb0, 0x8c, 0x01, 0x9f, 0x8b, 0x57, 0x87, 0x99, 0xb6,
+	     0xfa, 0x80, 0x86, 0xe0, 0x6c, 0xc3, 0x35, 0x82, 0x4e, 0x03,
+	     0x00, 0x2e, 0x06, 0x38, 0x78, 0xf4, 0x5a, 0x15, 0x60, 0xd5,
+	     0x2a, 0xca, 0x80, 0x30, 0x40, 0x07, 0x28, 0xd9, 0x88, 0x6d,
+	     0x00, 0x0f, 0x00, 0xf0, 0x30, 0x45, 0x00, 0xde, 0x1a, 0x00,
+	     0x28, 0x98, 0x00, 0x80, 0x1f, 0x05, 0x70, 0x5a, 0x0f, 0x01,
+	     0x00, 0x2c, 0x11, 0x80, 0x00, 0xb4, 0x75, 0x80, 0xc5, 0x20,
+	     0xa6, 0x36, 0x02, 0x00, 0x78, 0x31, 0x17, 0x2d, 0x57, 0x01,
+	     0xda, 0xdd, 0x3d, 0x07, 0xb0, 0x45, 0xcd, 0x5f, 0x4c, 0x00,
+	     0xf7, 0xb8, 0x05, 0x00, 0x4d, 0x80, 0xc4, 0x4e, 0x73, 0x37,
+	     0xfa, 0xa3, 0x00, 0x00, 0xda, 0x01, 0x00, 0x60, 0x06, 0x00,
+	     0xdf, 0x04, 0x0f, 0x00, 0xc8, 0x27, 0x00, 0x9d, 0xb1, 0x62,
+	     0x5d, 0xb7, 0x51, 0xb8, 0x22, 0x08, 0xe1, 0xf4, 0xfe, 0xf1,
+	     0x72, 0x2d, 0x20, 0x0d, 0x38, 0x01, 0x00, 0x51, 0x25, 0x94,
+	     0xa4, 0x04, 0xd0, 0x39, 0x24, 0x00, 0x40, 0xef, 0xec, 0x0d,
+	     0xf1, 0xfb, 0x02, 0x77, 0xc1, 0x00, 0x68, 0x63, 0x3a, 0x80,
+	     0xbd, 0x01, 0x90, 0x03, 0x8a, 0xd1, 0x14, 0x80, 0x55, 0xae,
+	     0xb8, 0x70, 0x80, 0x7f, 0xfc, 0x0b, 0x98, 0x98, 0x00, 0x77,
+	     0x00, 0x40, 0x75, 0xf3, 0x25, 0x78, 0x46, 0x3c, 0x80, 0x75,
+	     0x6f, 0x70, 0xfa, 0x72, 0x11, 0x76, 0x16, 0x01, 0x9c, 0x4c,
+	     0x7a, 0x39, 0x00, 0x50, 0xfe, 0x23, 0x66, 0x80, 0x4a, 0x03,
+	     0xa0, 0x1b, 0x03, 0x98, 0xe5, 0xf3, 0x31, 0x12, 0x7f, 0xf7,
+	     0x01, 0x98, 0x1e, 0x64, 0x35, 0x05, 0xfc, 0x77, 0xc5, 0x1d,
+	     0x20, 0x03, 0xe8, 0x03, 0x81, 0xe8, 0x19, 0x00, 0xc0, 0x94,
+	     0x00, 0x16, 0x00, 0xdb, 0x39, 0x04, 0x27, 0x05, 0x2a, 0x2b,
+	     0x00, 0x80, 0x2f, 0xc7, 0x7a, 0x00, 0x80, 0xa4, 0x65, 0xfc,
+	     0x80, 0x00, 0x90, 0x65, 0x00, 0x1e, 0xc0, 0xd5, 0x95, 0x76,
+	     0x00, 0xfa, 0x99, 0x03, 0x9b, 0x0f, 0xb1, 0x39, 0x18, 0x90,
+	     0x0f, 0x90, 0x2b, 0x01, 0x7e, 0x39, 0x84, 0x11, 0x4c, 0x11,
+	     0x5c, 0x46, 0xd1, 0x6b, 0x88, 0x04, 0xa4, 0x3d, 0x83, 0x33,
+	     0xe0, 0x3d, 0xa0, 0x02, 0x4e, 0x9d, 0x19, 0xa0, 0xc1, 0x02,
+	     0xec, 0x3d, 0x00, 0x00, 0x41, 0x39, 0x48, 0x00, 0x9b, 0x2c,
+	     0x80, 0x5a, 0xac, 0x00, 0x50, 0xd4, 0x6d, 0x5d, 0x13, 0x00,
+	     0x50, 0x01, 0xee, 0x23, 0x29, 0xe3, 0x1c, 0x07, 0x34, 0xd3,
+	     0x00, 0x41, 0xc4, 0x82, 0x73, 0xc7, 0x76, 0x00, 0xb6, 0xdb,
+	     0x00, 0x12, 0xe4, 0x01, 0x40, 0x40, 0x07, 0x60, 0xdb, 0x03,
+	     0xda, 0xcf, 0x77, 0x2e, 0xfb, 0xa8, 0x01, 0xc3, 0xd0, 0xb5,
+	     0xee, 0xbb, 0xf0, 0x01, 0xc8, 0x1f, 0x80, 0x44, 0xdc, 0x65,
+	     0xa4, 0x01, 0x76, 0x00, 0x60, 0xc6, 0x02, 0xf8, 0x36, 0xc8,
+	     0x39, 0x60, 0x2a, 0xbf, 0xf8, 0xcd, 0xa4, 0x2c, 0xf9, 0x9b,
+	     0x05, 0x94, 0x04, 0x14, 0x00, 0xed, 0x70, 0x9e, 0x03, 0xba,
+	     0x40, 0xa1, 0x60, 0x0d, 0x20, 0x01, 0xba, 0x12, 0x7a, 0x38,
+	     0xcc, 0x29, 0x69, 0xac, 0x16, 0xd5, 0x1a, 0x4b, 0x03, 0x68,
+	     0x01, 0xf9, 0x69, 0x04, 0xd0, 0x2d, 0xbc, 0x43, 0x50, 0x8c,
+	     0xfa, 0xfd, 0x7d, 0xde, 0xb7, 0x00, 0x3d, 0x00, 0x00, 0x30,
+	     0x07, 0x9e, 0x80, 0xdf, 0x90, 0xb2, 0xd4, 0x01, 0xf0, 0xd8,
+	     0xf2, 0xe0, 0xa7, 0xc5, 0x3e, 0x3c, 0x5c, 0x00, 0x00, 0xa0,
+	     0x87, 0xbe, 0x08, 0xc2, 0xe6, 0xce, 0x05, 0x38, 0x9c, 0x0b,
+	     0xcf, 0x73, 0x08, 0xfa, 0x04, 0x00, 0xa8, 0x80, 0x92, 0x2f,
+	     0x0d, 0x48, 0x02, 0x00, 0x0c, 0x80, 0xe6, 0x03, 0x60, 0x12,
+	     0x38, 0x5f, 0x9b, 0x3a, 0x4d, 0x38, 0x00, 0x98, 0x4a, 0xbb,
+	     0xd6, 0x09, 0x88, 0x00, 0x7e, 0x40, 0x0e, 0x00, 0x60, 0x00,
+	     0x00, 0x00, 0x01, 0x40, 0x95, 0x7b, 0xa8, 0xa5, 0x61, 0xb2,
+	     0x91, 0x03, 0x00, 0x00, 0x2c, 0xfd, 0x0f, 0x19, 0x13, 0xe0,
+	     0x74, 0x13, 0x9f, 0x3d, 0x00, 0xa0, 0x08, 0xf0, 0x00, 0x34,
+	     0x80, 0x57, 0x09, 0xc0, 0x11, 0x2f, 0xb0, 0x17, 0x6a, 0xa4,
+	     0x1a, 0x75, 0x52, 0x96, 0xcf, 0x28, 0x40, 0x03, 0xf8, 0xbc,
+	     0xc1, 0x12, 0xc0, 0x01, 0xd0, 0xa4, 0x9b, 0x1a, 0xc9, 0x12,
+	     0xc4, 0x34, 0x05, 0x00, 0x72, 0x29, 0x1d, 0x81, 0x54, 0x07,
+	     0xa4, 0x01, 0x4d, 0xc0, 0x95, 0xc8, 0x07, 0xd4, 0x00, 0x2a,
+	     0x80, 0x14, 0xe0, 0x09, 0xd7, 0x00, 0x0d, 0x2f, 0x17, 0x00,
+	     0x28, 0x03, 0x1c, 0xe2, 0xc1, 0x8e, 0xa7, 0x01, 0x78, 0x01,
+	     0x66, 0xc0, 0x60, 0x97, 0xaa, 0x01, 0x48, 0x00, 0x2b, 0x40,
+	     0xfa, 0x4f, 0x53, 0x00, 0x0f, 0x80, 0x55, 0x07, 0x50, 0x24,
+	     0xa1, 0x79, 0x9d, 0x0e, 0x70, 0x05, 0x00, 0x00, 0x34, 0xc0,
+	     0x4a, 0x50, 0x63, 0xb2, 0xf1, 0x00, 0xbf, 0x62, 0x01, 0x40,
+	     0xd9, 0x4c, 0xbb, 0x5f, 0x0c, 0xb0, 0x05, 0x40, 0x15, 0x61,
+	     0x6c, 0xc2, 0x03, 0xe8, 0xaa, 0x45, 0x93, 0x2c, 0x40, 0xbf,
+	     0x4c, 0xed, 0x90, 0x82, 0x13, 0x40, 0xca, 0xb8, 0x86, 0x92,
+	     0xde, 0xe1, 0xaa, 0x0a, 0x18, 0x69, 0xb0, 0x00, 0x63, 0x6b,
+	     0x09, 0x00, 0x00, 0xda, 0x42, 0xb8, 0x17, 0x00, 0xf8, 0x9f,
+	     0x00, 0x05, 0xf7, 0x66, 0xb9, 0x99, 0x49, 0x7f, 0xd4, 0x54,
+	     0x05, 0x60, 0xd4, 0xd3, 0x28, 0x08, 0x00, 0x16, 0x90, 0x00,
+	     0xfc, 0xa7, 0x00, 0x11, 0x8f, 0x0a, 0x30, 0xca, 0xd1, 0x15,
+	     0xc0, 0x35, 0xd7, 0xbb, 0xb8, 0x01, 0x00, 0x25, 0x33, 0x0f,
+	     0x20, 0xb0, 0x78, 0x9a, 0x20, 0x00, 0x3d, 0xe8, 0xe2, 0x24,
+	     0x00, 0x61, 0xe3, 0x02, 0x10, 0xf7, 0x00, 0x00, 0x03, 0xe0,
+	     0x0e, 0x00, 0x70, 0xd8, 0x80, 0xdc, 0x85, 0x6a, 0x05, 0x00,
+	     0x94, 0x00, 0xc0, 0xaa, 0xf1, 0x00, 0x34, 0x96, 0x35, 0x00,
+	     0x00, 0x10, 0x2b, 0x0b, 0x96, 0x80, 0x74, 0x23, 0x17, 0x11,
+	     0x15, 0x01, 0xa1, 0x2e, 0x00, 0xf0, 0x58, 0x01, 0x20, 0x6b,
+	     0x40, 0x41, 0x23, 0x07, 0x4c, 0x01, 0x8b, 0x12, 0x20, 0x57,
+	     0x96, 0x01, 0xc0, 0xb9, 0x05, 0x40, 0x77, 0x9a, 0x03, 0x62,
+	     0x47, 0xc3, 0xed, 0x0c, 0x00, 0xe8, 0x30, 0x62, 0x52, 0x70,
+	     0xa8, 0x06, 0x9c, 0xac, 0xbd, 0x2f, 0x1d, 0xd0, 0xe2, 0x5d,
+	     0x21, 0x80, 0xf3, 0x3b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x45,
+	     0xa7, 0x07, 0x00, 0x00, 0x74, 0x7c, 0x00, 0xc0, 0xa2, 0x06,
+	     0x00, 0xac, 0x32, 0x60, 0x9d, 0x95, 0x28, 0x03, 0xbe, 0xfa,
+	     0x44, 0xa2, 0x0c, 0x00, 0x50, 0x20, 0x80, 0x3b, 0x98, 0x94,
+	     0xda, 0x1a, 0x00, 0x7c, 0x0c, 0x60, 0x46, 0xfc, 0xb0, 0xf1,
+	     0x00, 0xc0, 0x00, 0xf0, 0xfe, 0xaa, 0x8e, 0xfc, 0x25, 0x1a,
+	     0x00, 0xf0, 0xc1, 0x00, 0xb7, 0x3a, 0x26, 0xcb, 0x8f, 0x02,
+	     0x00, 0x00, 0x7c, 0x85, 0x59, 0xa5, 0x22, 0x1c, 0x2f, 0x29,
+	     0x8c, 0x8c, 0x5a, 0x02, 0xc0, 0xd5, 0x1f, 0x20, 0x72, 0x51,
+	     0x00, 0x22, 0xf0, 0xb7, 0xf7, 0xd6, 0x74, 0x3c, 0x00, 0x70,
+	     0xc0, 0x88, 0x08, 0x68, 0x0a, 0x48, 0x2a, 0x00, 0xe0, 0xe6,
+	     0xfe, 0x29, 0x60, 0xb0, 0x01, 0x20, 0x02, 0xd0, 0x53, 0x57,
+	     0x33, 0x42, 0xd8, 0x1d, 0x93, 0x30, 0x46, 0x6d, 0x00, 0x00,
+	     0x80, 0x2a, 0x59, 0x00, 0xe1, 0xff, 0x50, 0x07, 0x68, 0x3d,
+	     0x57, 0x3b, 0x19, 0xff, 0x0a, 0x00, 0x00, 0x0a, 0xcd, 0x18,
+	     0x20, 0xcd, 0x06, 0x9c, 0xd5, 0x84, 0x19, 0x00, 0x79, 0x72,
+	     0xcb, 0xc9, 0x65, 0x97, 0x43, 0x0b, 0x70, 0xad, 0x74, 0x91,
+	     0x29, 0xb1, 0xf2, 0x6f, 0x65, 0x88, 0xf0, 0x75, 0xb3, 0x0f,
+	     0x18, 0xfc, 0x0c, 0x9e, 0x40, 0x1c, 0x20, 0x3d, 0x16, 0x2b,
+	     0xdf, 0xb6, 0xba, 0x6d, 0x2e, 0xfc, 0xeb, 0xce, 0x1d, 0xa6,
+	     0x55, 0x23, 0x35, 0xb5, 0xdf, 0x7a, 0xb8, 0xf2, 0xd8, 0x03,
+	     0x4e, 0x00, 0x00, 0x00, 0xec, 0xa7, 0x03, 0xc4, 0xeb, 0x18,
+	     0x19, 0x00, 0x27, 0x04, 0x70, 0x79, 0x80, 0x84, 0x96, 0x4d,
+	     0x00, 0x52, 0x80, 0x67, 0x7d, 0x4a, 0xa4, 0x67, 0x75, 0x80,
+	     0x3e, 0x60, 0x40, 0x31, 0xe8, 0x01, 0x00, 0x00, 0x20, 0x03,
+	     0xe0, 0x14, 0x00, 0x4f, 0xe0, 0x26, 0x2e, 0xfd, 0x37, 0x75,
+	     0x4b, 0xee, 0x53, 0xfb, 0xff, 0x7b, 0x53, 0x86, 0x05, 0x15,
+	     0x24, 0x8f, 0x03, 0x1e, 0x2d, 0x44, 0xd9, 0xc0, 0x22, 0x86,
+	     0x05, 0x66, 0xf4, 0x73, 0x01, 0xb0, 0x19, 0x76, 0x00, 0xe4,
+	     0x15, 0x70, 0x02, 0x00, 0x00, 0x83, 0xf6, 0xdc, 0xce, 0x01,
+	     0x68, 0x23, 0x77, 0x06, 0x78, 0xb9, 0xa6, 0x3b, 0x00, 0x00,
+	     0x80, 0xf8, 0x07, 0x00, 0xd4, 0xe2, 0x62, 0x8f, 0x44, 0x0b,
+	     0x20, 0x7e, 0x00, 0xf5, 0x6c, 0x0d, 0x40, 0x03, 0xcc, 0x36,
+	     0x80, 0x39, 0xcf, 0x78, 0xbe, 0xc0, 0x00, 0x00, 0xc0, 0x7e,
+	     0x04, 0x00, 0x00, 0x3c, 0x88, 0xcb, 0xed, 0x09, 0x20, 0x1a,
+	     0xef, 0x00, 0x00, 0x75, 0x00, 0x88, 0xca, 0xd0, 0x74, 0x52,
+	     0x41, 0xc4, 0xd8, 0x01, 0xc6, 0x22, 0xc0, 0xa0, 0x6c, 0x94,
+	     0x1d, 0x00, 0x5f, 0x9d, 0x11, 0xc0, 0xaa, 0x8e, 0x0f, 0x88,
+	     0xb5, 0x0e, 0x00, 0xf8, 0x67, 0xec, 0xe3, 0xa9, 0x07, 0xa0,
+	     0x16, 0xda, 0x00, 0xa7, 0x5e, 0x00, 0x00, 0xa0, 0x0e, 0x7d,
+	     0x42, 0xe4, 0x35, 0xca, 0xfe, 0x03, 0xaa, 0x80, 0x22, 0x0e,
+	     0x20, 0xd9, 0xf5, 0xa4, 0x7c, 0xc0, 0x05, 0xc0, 0x04, 0x00,
+	     0xaa, 0x00, 0x21, 0x3e, 0x01, 0x28, 0x8f, 0xb2, 0x6a, 0x22,
+	     0xa7, 0x7c, 0x9b, 0x67, 0xd6, 0x80, 0x0b, 0x41, 0xfc, 0x00,
+	     0x40, 0x38, 0x00, 0x40, 0x6a, 0xd0, 0x05, 0x49, 0x01, 0x00,
+	     0x80, 0x14, 0xe0, 0x07, 0x00, 0x21, 0x2a, 0x0a, 0xb5, 0xbe,
+	     0x70, 0x95, 0xaf, 0x09, 0x00, 0x5a, 0x89, 0x21, 0xa3, 0x56,
+	     0xa0, 0x16, 0x72, 0x1c, 0x01, 0x00, 0x00, 0x75, 0x40, 0x57,
+	     0xe7, 0x1c, 0x02, 0xe6, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00,
+	     0xc6, 0x46, 0xc1, 0x8c, 0x03, 0x00, 0x00, 0xaa, 0x6c, 0x15,
+	     0x1b, 0xf0, 0xcc, 0x02, 0x00, 0x00, 0x29, 0x00, 0x60, 0xa1,
+	     0x16, 0x01, 0x45, 0xc0, 0x89, 0x0a, 0x00, 0xec, 0x43, 0x52,
+	     0x00, 0xe0, 0xb7, 0xc7, 0x9c, 0x1a, 0xc4, 0xc5, 0x13, 0xa0,
+	     0x01, 0x20, 0x49, 0x03, 0x02, 0x80, 0x35, 0xb3, 0x03, 0xb0,
+	     0xcd, 0xcc, 0x13, 0xd0, 0x74, 0xbc, 0x01, 0x6a, 0xc0, 0xa3,
+	     0x08, 0x00, 0x94, 0x35, 0x1d, 0xdc, 0x98, 0x6f, 0xa9, 0x42,
+	     0x01, 0x80, 0x0e, 0xc0, 0x0e, 0x03, 0xcc, 0xad, 0xae, 0xd3,
+	     0xf8, 0x0f, 0x90, 0x03, 0xc2, 0x40, 0xc6, 0x79, 0x09, 0x30,
+	     0x92, 0x01, 0x00, 0xc6, 0xa3, 0x28, 0xb2, 0xce, 0x1b, 0x75,
+	     0x00, 0x80, 0x03, 0x90, 0xd5, 0x2d, 0x66, 0xf0, 0x1c, 0x90,
+	     0x25, 0x6e, 0x39, 0x5f, 0x2d, 0x40, 0x2f, 0x3d, 0x49, 0xf3,
+	     0x00, 0xca, 0xa9, 0xa7, 0x2a, 0x7d, 0x01, 0x00, 0xe8, 0x2d,
+	     0x92, 0xcb, 0x0f, 0x60, 0x6d, 0x3c, 0xc0, 0xff, 0x07, 0x00,
+	     0x00, 0xe9, 0x2e, 0xc0, 0x05, 0x58, 0x7f, 0xf7, 0x6c, 0xc0,
+	     0x12, 0x00, 0x00, 0x00, 0xee, 0x53, 0xc0, 0x6b, 0x05, 0x05,
+	     0x98, 0x5c, 0x3f, 0x80, 0x08, 0x00, 0x00, 0x50, 0x33, 0x00,
+	     0x20, 0x5b, 0x09, 0x32, 0xaf, 0x01, 0x61, 0x6d, 0xdb, 0x2b,
+	     0x2f, 0x6f, 0xbf, 0x4d, 0xc0, 0x58, 0x07, 0x00, 0xac, 0x01,
+	     0x80, 0x3b, 0xe0, 0xd9, 0xca, 0x7d, 0x02, 0xef, 0x39, 0x40,
+	     0xf8, 0x03, 0xbc, 0xcd, 0x00, 0x21, 0x40, 0x0e, 0x20, 0xff,
+	     0x52, 0x55, 0x12, 0x33, 0x53, 0x51, 0x03, 0x00, 0x80, 0x54,
+	     0x8a, 0x0f, 0x58, 0xf1, 0x82, 0x7c, 0xd2, 0x3c, 0x32, 0x4f,
+	     0x66, 0x05, 0x31, 0xf2, 0xb5, 0xce, 0x77, 0xe0, 0x01, 0x18,
+	     0x9d, 0x17, 0xa0, 0x8d, 0x7a, 0x19, 0x00, 0x00, 0xe0, 0x0c,
+	     0xc0, 0x03, 0x52, 0x32, 0x11, 0xa0, 0x03, 0xc8, 0x02, 0x00,
+	     0x01, 0x40, 0x4b, 0x52, 0x00, 0x44, 0x67, 0x6c, 0x40, 0x04,
+	     0xd0, 0x3b, 0x4c, 0x01, 0x49, 0x00, 0xa4, 0xda, 0x68, 0x56,
+	     0x3f, 0xf8, 0x69, 0x6f, 0x66, 0xcd, 0x00, 0xa6, 0xe4, 0x12,
+	     0x40, 0x4c, 0x53, 0x3c, 0x6b, 0x10, 0xc0, 0xbb, 0xfd, 0x67,
+	     0x8e, 0xed, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x09, 0xe8, 0x0a,
+	     0xf9, 0xd9, 0xfa, 0x09, 0x03, 0x06, 0x72, 0x00, 0x7e, 0x09,
+	     0x74, 0x00, 0xa6, 0x8e, 0x0a, 0xec, 0x2c, 0x04, 0xec, 0x00,
+	     0xe1, 0x5b, 0x3c, 0x03, 0x24, 0x2d, 0x01, 0x80, 0xfd, 0xc6,
+	     0x05, 0x60, 0x36, 0xdd, 0xdc, 0xd2, 0xb2, 0x40, 0x03, 0xbc,
+	     0x00, 0x00, 0x00, 0x6d, 0x05, 0x38, 0x99, 0xc3, 0xc0, 0xde,
+	     0x48, 0x20, 0x77, 0x02, 0xa6, 0x00, 0xf7, 0x1a, 0x10, 0xb1,
+	     0xed, 0x4a, 0x58, 0x25, 0x40, 0x96, 0x96, 0xc1, 0x14, 0x49,
+	     0xd9, 0x96, 0x21, 0x04, 0x00, 0xf0, 0x17, 0x6b, 0x49, 0x43,
+	     0xf5, 0x75, 0x01, 0xba, 0xd6, 0x1f, 0x00, 0xc0, 0xd6, 0x67,
+	     0x80, 0x32, 0x60, 0x7f, 0x03, 0x03, 0x3e, 0x73, 0x80, 0x73,
+	     0xa9, 0x03, 0x4c, 0x51, 0x00, 0x80, 0x0f, 0x60, 0x04, 0xd8,
+	     0x4b, 0x00, 0x2e, 0x40, 0x0f, 0x00, 0x14, 0x00, 0x00, 0xad,
+	     0xc5, 0x45, 0xa4, 0x4b, 0xad, 0xcc, 0x35, 0x00, 0x0f, 0xe0,
+	     0x79, 0x1c, 0x65, 0x0c, 0x40, 0x16, 0xa6, 0x72, 0xd3, 0x6a,
+	     0x09, 0xc0, 0xa2, 0x23, 0xae, 0x01, 0x00, 0xd8, 0x2f, 0x35,
+	     0xfe, 0xf1, 0x88, 0xed, 0x08, 0xc4, 0x99, 0xbf, 0x01, 0x42,
+	     0x80, 0x14, 0x00, 0x30, 0x1a, 0x8d, 0x7d, 0xcf, 0x9f, 0x15,
+	     0xe0, 0xb0, 0x67, 0x31, 0xb4, 0xd7, 0x25, 0x3d, 0x56, 0x01,
+	     0xe4, 0x57, 0x87, 0xb3, 0x09, 0x00, 0xd4, 0x83, 0xed, 0x0d,
+	     0x00, 0x10, 0x45, 0x00, 0xe8, 0x45, 0x80, 0x1e, 0xe0, 0x56,
+	     0xa9, 0x00, 0x80, 0x1e, 0x19, 0x00, 0x00, 0x90, 0x00, 0x80,
+	     0x09, 0x12, 0xb0, 0x00, 0x00, 0x00, 0xe9, 0x17, 0x40, 0xdb,
+	     0x2e, 0x52, 0x25, 0x4b, 0x00, 0x00, 0x00, 0x98, 0x02, 0x1a,
+	     0x38, 0xc9, 0x80, 0xa1, 0x44, 0x00, 0x42, 0x00, 0xf7, 0x9e,
+	     0xe9, 0xf3, 0xd8, 0xa4, 0x21, 0x40, 0xce, 0xcb, 0xc4, 0x0e,
+	     0xe6, 0xa3, 0xe4, 0x4d, 0xdd, 0x00, 0x00, 0x00, 0x11, 0xc0,
+	     0xca, 0x00, 0x00, 0xb0, 0x58, 0x47, 0x6c, 0xf9, 0x9a, 0x06,
+	     0x24, 0xf5, 0x73, 0x00, 0xe8, 0x0a, 0xf8, 0x39, 0x7c, 0x0f,
+	     0x40, 0x47, 0x02, 0xb0, 0xcf, 0x01, 0xb9, 0xeb, 0x06, 0x00,
+	     0x90, 0xf8, 0x5c, 0x87, 0x41, 0x1b, 0x20, 0xd8, 0x70, 0x25,
+	     0x00, 0x80, 0x4a, 0x0b, 0x00, 0x7c, 0xf5, 0x17, 0xa9, 0x15,
+	     0x60, 0xb2, 0xbc, 0x14, 0x43, 0x4f, 0xae, 0x04, 0x6e, 0x3d,
+	     0xcd, 0x75, 0x00, 0x60, 0x27, 0x46, 0x9e, 0x01, 0x26, 0x13,
+	     0xa0, 0x3a, 0x10, 0x2e, 0x7b, 0x00, 0x00, 0xc0, 0x06, 0x95,
+	     0x02, 0x00, 0x00, 0x33, 0x4e, 0x01, 0xf0, 0x6b, 0x4c, 0x59,
+	     0xe4, 0x6c, 0x0b, 0x06, 0x00, 0x74, 0xb7, 0x18, 0x2f, 0x07,
+	     0x00, 0x28, 0xac, 0x44, 0x80, 0xad, 0x01, 0x00, 0x00, 0x84,
+	     0x1c, 0xef, 0x7e, 0xd7, 0xd6, 0x95, 0x53, 0x80, 0x01, 0xef,
+	     0xe6, 0xf0, 0x67, 0x45, 0x19, 0x40, 0x14, 0x00, 0x69, 0x03,
+	     0x0e, 0xb7, 0xc7, 0x56, 0x6d, 0x59, 0xb5, 0x82, 0xab, 0x02,
+	     0x05, 0x30, 0x24, 0xab, 0xc6, 0x4f, 0x80, 0x0a, 0x0d, 0x00,
+	     0xec, 0x76, 0x54, 0x80, 0x18, 0x80, 0x06, 0x80, 0xa1, 0x60,
+	     0x21, 0x40, 0x72, 0x04, 0x00, 0x00, 0xc3, 0x59, 0x10, 0x10,
+	     0x2a, 0x6a, 0x69, 0x2d, 0x00, 0x0c, 0x00, 0xa1, 0x1f, 0x67,
+	     0x00, 0x1d, 0x81, 0xcb, 0xde, 0x9a, 0x18, 0x00, 0x7c, 0x09,
+	     0xb9, 0xd9, 0xd5, 0xa2, 0x25, 0xa3, 0x0d, 0x10, 0x03, 0x24,
+	     0x01, 0x00, 0xd6, 0x30, 0x31, 0x06, 0x00, 0x00, 0x00, 0xa6,
+	     0x05, 0x30, 0x01, 0x6c, 0x0f, 0x00, 0x05, 0x80, 0xdc, 0x07,
+	     0xb4, 0xf7, 0x02, 0xdb, 0xdc, 0x0c, 0x00, 0x02, 0x00, 0xcc,
+	     0x5c, 0x0e, 0x60, 0x9a, 0x2c, 0x01, 0x79, 0x80, 0x82, 0xe6,
+	     0x1c, 0x05, 0x20, 0x25, 0xeb, 0x04, 0x30, 0xa1, 0xdb, 0x00,
+	     0x28, 0x80, 0xd4, 0x7e, 0x04, 0xc4, 0xd9, 0x80, 0x80, 0xaf,
+	     0x08, 0x00, 0xa8, 0x00, 0x1f, 0x80, 0x07, 0xa0, 0x04, 0x4c,
+	     0xf8, 0x00, 0x80, 0x71, 0xf2, 0xdf, 0xfa, 0xfc, 0xf8, 0x24,
+	     0xce, 0x04, 0x01, 0x8c, 0x00, 0x00, 0xf7, 0xc7, 0xb0, 0xad,
+	     0x8e, 0xc1, 0x60, 0x00, 0xe0, 0x09, 0x00, 0x68, 0xf0, 0x17,
+	     0x56, 0x0d, 0xf9, 0x5a, 0x02, 0x42, 0x8f, 0x14, 0x48, 0xd7,
+	     0xae, 0x01, 0x00, 0x08, 0x10, 0xa0, 0x4c, 0x07, 0x00, 0x2e,
+	     0x2b, 0x40, 0xba, 0xd0, 0x10, 0x8b, 0xb5, 0x4f, 0x39, 0xf4,
+	     0x05, 0xe8, 0x13, 0x59, 0x00, 0x39, 0x4f, 0x61, 0x43, 0x02,
+	     0x47, 0x3f, 0x30, 0x1c, 0x00, 0x00, 0xa4, 0x47, 0xdf, 0xa2,
+	     0x00, 0x00, 0xc0, 0xdf, 0xab, 0x80, 0xba, 0x00, 0x0e, 0x00,
+	     0x48, 0x3e, 0x60, 0x80, 0x23, 0xa3, 0x28, 0x52, 0x01, 0x00,
+	     0x90, 0x15, 0x18, 0x74, 0x9d, 0x0e, 0x73, 0xd1, 0x58, 0x3a,
+	     0x0f, 0x07, 0x07, 0x53, 0x69, 0xe0, 0x2c, 0xac, 0xe1, 0xde,
+	     0x3c, 0x67, 0x0b, 0x94, 0x32, 0x03, 0xea, 0x73, 0xfe, 0x26,
+	     0x4c, 0x00, 0xb4, 0x00, 0xb3, 0x2f, 0x80, 0x0d, 0x48, 0xa6,
+	     0xd3, 0x8a, 0x15, 0x40, 0xa9, 0x07, 0xe8, 0x3f, 0x00, 0x40,
+	     0x25, 0x75, 0x06, 0x00, 0x45, 0x92, 0x90, 0x11, 0x20, 0x5c,
+	     0x01, 0x0e, 0xaa, 0x30, 0x4a, 0x9d, 0x01, 0x78, 0xc7, 0xe9,
+	     0x2d, 0xc0, 0x00, 0x58, 0xc1, 0x01, 0x3f, 0x34, 0xa0, 0xd1,
+	     0x13, 0xa0, 0xdf, 0xa6, 0x2a, 0x00, 0x00, 0xb0, 0x90, 0x51,
+	     0xf0, 0x1c, 0xed, 0xd2, 0xce, 0x7e, 0xc7, 0x05, 0x7c, 0xc8,
+	     0x42, 0xb7, 0x24, 0x75, 0xab, 0x9d, 0x3b, 0x82, 0x91, 0x03,
+	     0xbc, 0xa2, 0xd0, 0x03, 0x11, 0x04, 0xf4, 0x56, 0x2a, 0x00,
+	     0x00, 0xd0, 0x06, 0x78, 0x06, 0x80, 0xd1, 0x1f, 0x00, 0xc8,
+	     0x03, 0x84, 0x43, 0x13, 0x00, 0x40, 0x68, 0x03, 0x00, 0x00,
+	     0x40, 0x10, 0xa0, 0x3e, 0x63, 0x7b, 0x2f, 0xd9, 0x18, 0x10,
+	     0x8e, 0x8b, 0x00, 0x41, 0x00, 0x00, 0x70, 0x45, 0xe9, 0x49,
+	     0x37, 0x23, 0x16, 0x4e, 0x07, 0x64, 0xc0, 0x80, 0x3a, 0x2d,
+	     0x26, 0x5c, 0x85, 0x6b, 0x17, 0x05, 0x80, 0xba, 0x39, 0x68,
+	     0xde, 0x00, 0x00, 0x80, 0x07, 0x80, 0x87, 0x9b, 0xd3, 0x3c,
+	     0x6e, 0x02, 0x00, 0x03, 0xb6, 0x00, 0x2e, 0xd4, 0x15, 0x20,
+	     0x43, 0xce, 0x60, 0x40, 0x54, 0xfa, 0x8d, 0x23, 0x00, 0x80,
+	     0x5f, 0x42, 0x01, 0xe8, 0xa6, 0x6b, 0x6c, 0x49, 0x32, 0x9c,
+	     0xf6, 0x67, 0x0c, 0xbd, 0xc9, 0x44, 0xa3, 0x5d, 0x02, 0x00,
+	     0x97, 0x2f, 0x40, 0x0d, 0x18, 0xa0, 0xbc, 0x00, 0xba, 0x37,
+	     0xe5, 0x06, 0x10, 0x00, 0x2d, 0xdb, 0x78, 0xf4, 0x06, 0x00,
+	     0x00, 0x00, 0xc6, 0xa4, 0xdb, 0x49, 0xdc, 0x60, 0x80, 0xfc,
+	     0x10, 0x82, 0xac, 0x33, 0x14, 0x4e, 0x0a, 0xd6, 0x01, 0x80,
+	     0x78, 0x81, 0x89, 0xc5, 0x03, 0x20, 0x9d, 0xd4, 0x4f, 0x6f,
+	     0x2e, 0xc0, 0x0d, 0xf0, 0xf1, 0x31, 0x00, 0x32, 0xc0, 0xc9,
+	     0x73, 0x02, 0x36, 0xb9, 0x33, 0x00, 0xe0, 0x98, 0x34, 0xc6,
+	     0x5d, 0xc0, 0xac, 0xa7, 0x02, 0x58, 0x52, 0xb5, 0x34, 0x60,
+	     0xf3, 0xe6, 0xd7, 0x9b, 0xca, 0xcd, 0xe6, 0x53, 0x03, 0x00,
+	     0x38, 0x8e, 0x21, 0x00, 0x00, 0x38, 0x03, 0x00, 0xe2, 0xb3,
+	     0x0a, 0x80, 0x75, 0x02, 0x78, 0xbe, 0x18, 0xf9, 0x06, 0x00,
+	     0x00, 0x06, 0xd7, 0x0f, 0x02, 0xe0, 0x08, 0x1c, 0x96, 0x6d,
+	     0xf4, 0x8a, 0xc1, 0xce, 0xa1, 0x01, 0x5f, 0x89, 0x10, 0xb0,
+	     0x1e, 0x4a, 0x85, 0x1b, 0x94, 0x82, 0x2d, 0x00, 0x00, 0x56,
+	     0x6c, 0xb7, 0x7a, 0xb0, 0x07, 0x00, 0x00, 0x80, 0x14, 0x5b,
+	     0xae, 0x04, 0xcc, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
+	     0x01, 0xda, 0x8d, 0x1b, 0x50, 0xdf, 0x37, 0x3b, 0x6f, 0x22,
+	     0xa0, 0x0e, 0x00, 0xa6, 0x57, 0x7b, 0x95, 0x0c, 0x00, 0x00,
+	     0x00, 0x00, 0x8b, 0x26, 0x80, 0xe1, 0x01, 0x84, 0x23, 0x56,
+	     0x1f, 0xc4, 0x0a, 0x00, 0x90, 0x00, 0x3d, 0x40, 0x17, 0x10,
+	     0x00, 0x75, 0x9c, 0x00, 0x21, 0x5c, 0x68, 0xee, 0x12, 0x01,
+	     0x12, 0x2d, 0x60, 0x00, 0x3b, 0xed, 0x19, 0xc1, 0x29, 0x6b,
+	     0x0a, 0xb8, 0x03, 0xf8, 0x7e, 0x4b, 0x02, 0x80, 0xa2, 0x71,
+	     0x09, 0x29, 0x37, 0xe0, 0x41, 0x7d, 0x23, 0x00, 0x8e, 0x19,
+	     0xc0, 0x3b, 0x05, 0x00, 0xe6, 0xff, 0x85, 0x84, 0x24, 0x92,
+	     0x00, 0xc2, 0xae, 0x2c, 0x15, 0x10, 0x95, 0x4e, 0xb8, 0x04,
+	     0x00, 0xa9, 0x87, 0x3a, 0x13, 0xd8, 0x00, 0x00, 0xc0, 0xa9,
+	     0xc4, 0xd6, 0xb6, 0x0c, 0x1c, 0xc3, 0x09, 0x00, 0x40, 0x1e,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	};
+	static const uint32_t lcp[16] = {
+	    3, 4, 5, 6, 7, 11, 12, 13, 14, 15, 
+	    17, 19, 20, 21, 22, 23, 
+	};
+	static const uint8_t pg[5633] = {
+	     0x00, 0x90, 0xca, 0x94, 0xcf, 0x74, 0xde, 0x0c, 0x00, 0x00,
+	     0xe0, 0xb1, 0xd6, 0x56, 0x84, 0x3c, 0xc0, 0x54, 0xca, 0xcb,
+	     0x8f, 0x00, 0x20, 0xbc, 0x00, 0x00, 0x00, 0x7f, 0x0a, 0x00,
+	     0xa5, 0x0a, 0x00, 0x02, 0x19, 0x1e, 0x6a, 0x8e, 0x3c, 0xed,
+	     0xb3, 0x65, 0x8e, 0x0d, 0x00, 0x25, 0x0f, 0x00, 0x0a, 0x0a,
+	     0x00, 0xa0, 0x08, 0x00, 0x00, 0x30, 0x5b, 0xb4, 0x2e, 0x15,
+	     0x00, 0xf0, 0x53, 0x8c, 0xd9, 0x9e, 0x00, 0x30, 0x40, 0x03,
+	     0x4e, 0x72, 0x18, 0x7a, 0x45, 0x00, 0x00, 0x00, 0x00, 0x50,
+	     0x6e, 0x94, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 0x02, 0x00,
+	     0x98, 0x42, 0x6c, 0xd7, 0xc7, 0x52, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0xe6, 0xc9, 0x81, 0xcd, 0xce, 0x4f, 0x00, 0x20,
+	     0x4b, 0xc4, 0x07, 0x00, 0xb9, 0x01, 0x00, 0x68, 0xad, 0x7a,
+	     0x9d, 0xb4, 0x74, 0x46, 0xe7, 0x62, 0x00, 0xc0, 0x74, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x09, 0x00, 0x48, 0x75,
+	     0xd0, 0x00, 0xc0, 0x36, 0xc3, 0x07, 0xb6, 0x9e, 0x65, 0x8c,
+	     0xa6, 0x00, 0x00, 0x8b, 0xfd, 0x3b, 0x96, 0x92, 0x98, 0x10,
+	     0x02, 0x00, 0x7a, 0xfc, 0xcb, 0x4e, 0x52, 0xfd, 0xd4, 0x0d,
+	     0x00, 0x27, 0x6c, 0x74, 0x00, 0x10, 0x80, 0xd0, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x5e, 0x92, 0x66, 0x00, 0xe0, 0x2e, 0xc6,
+	     0x11, 0x22, 0x00, 0xe0, 0x3e, 0x00, 0x60, 0x23, 0x00, 0xf0,
+	     0x5d, 0x2a, 0x2d, 0x68, 0x63, 0x06, 0x00, 0x9d, 0xe5, 0x41,
+	     0x74, 0x9c, 0x6d, 0x00, 0xd0, 0xc4, 0x13, 0x03, 0x00, 0xe6,
+	     0x37, 0xe4, 0x9b, 0x7b, 0x64, 0xc8, 0xdf, 0x3c, 0x00, 0xa0,
+	     0x08, 0xeb, 0x87, 0x25, 0x13, 0x5a, 0xd7, 0xbb, 0x6f, 0x12,
+	     0x8d, 0x07, 0x00, 0x00, 0xe0, 0xac, 0x7f, 0x63, 0x87, 0x00,
+	     0xd0, 0x97, 0xae, 0x0c, 0x00, 0x00, 0x90, 0x22, 0xca, 0x05,
+	     0x00, 0xc0, 0x05, 0x00, 0x00, 0x50, 0x1f, 0x3d, 0x9c, 0xb0,
+	     0x00, 0x80, 0x84, 0x00, 0x00, 0x00, 0xdf, 0xf2, 0x10, 0xb3,
+	     0x55, 0x8a, 0x12, 0x01, 0x00, 0xbc, 0xbb, 0x5b, 0x00, 0x20,
+	     0x62, 0x66, 0x0a, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x07, 0x20,
+	     0x99, 0x84, 0x9c, 0xb0, 0x00, 0x00, 0x44, 0xc5, 0x78, 0x00,
+	     0x00, 0x00, 0xe9, 0x08, 0x00, 0x25, 0xad, 0xbc, 0x2d, 0xa7,
+	     0xf6, 0x38, 0x0d, 0x00, 0x95, 0x0a, 0x00, 0x40, 0xe3, 0xba,
+	     0x00, 0xc0, 0x8a, 0xac, 0x78, 0x67, 0x92, 0x3b, 0x3e, 0xc5,
+	     0xda, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xca, 0x00, 0x50,
+	     0x07, 0x4c, 0xce, 0x68, 0x61, 0x57, 0xd9, 0x66, 0x05, 0x00,
+	     0x5d, 0x2e, 0x94, 0x00, 0x40, 0x9b, 0xa4, 0x66, 0xff, 0xc0,
+	     0x05, 0x00, 0x00, 0xc0, 0xd6, 0x8d, 0x05, 0x00, 0x00, 0x60,
+	     0x9b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0x5b,
+	     0xe2, 0x02, 0x00, 0x00, 0xf0, 0x2d, 0x11, 0x08, 0x00, 0x2c,
+	     0x06, 0x00, 0x41, 0x75, 0xe0, 0x2d, 0x85, 0xa1, 0x50, 0xb7,
+	     0x96, 0x5f, 0xb2, 0x43, 0x09, 0x28, 0x77, 0xae, 0x2c, 0xf5,
+	     0xe1, 0xa3, 0xd0, 0x7f, 0x0f, 0x00, 0x00, 0xd0, 0x0d, 0x00,
+	     0x00, 0x00, 0x4d, 0x74, 0xc2, 0x1f, 0x0d, 0x3b, 0x69, 0x03,
+	     0x00, 0x5a, 0xd4, 0xb9, 0x4d, 0x3d, 0x84, 0xdc, 0xb0, 0xd6,
+	     0x54, 0x47, 0x53, 0x9c, 0x67, 0x02, 0x8f, 0x0b, 0xde, 0x5b,
+	     0xee, 0x9a, 0x8b, 0xb6, 0x59, 0xce, 0x54, 0x50, 0x15, 0x2a,
+	     0xdd, 0x9e, 0x00, 0x00, 0x81, 0x24, 0x61, 0x00, 0x20, 0x05,
+	     0x46, 0x98, 0xb9, 0x94, 0x31, 0x7f, 0x55, 0xa4, 0x38, 0x00,
+	     0x40, 0x97, 0x78, 0x05, 0x00, 0xda, 0x95, 0x57, 0xad, 0x33,
+	     0x81, 0xa2, 0x35, 0xb5, 0x3d, 0xa7, 0x91, 0x00, 0x00, 0x00,
+	     0x64, 0x59, 0xc1, 0x95, 0x0f, 0x00, 0x00, 0xc0, 0x84, 0x6d,
+	     0xc5, 0x57, 0x0d, 0x97, 0xa4, 0x00, 0xa0, 0x67, 0x62, 0xe5,
+	     0x98, 0x00, 0x10, 0x6d, 0x86, 0x04, 0x00, 0x00, 0x40, 0x80,
+	     0x37, 0x04, 0x00, 0x2b, 0x0b, 0x65, 0x98, 0x2b, 0x4e, 0xb3,
+	     0x04, 0x00, 0x06, 0x14, 0x7b, 0x00, 0x30, 0x7b, 0xcd, 0x03,
+	     0x00, 0x00, 0x00, 0x00, 0x9e, 0x04, 0x00, 0x00, 0x00, 0x00,
+	     0xf2, 0x37, 0x61, 0x31, 0xd1, 0x8e, 0xb2, 0x05, 0x00, 0x30,
+	     0x09, 0x00, 0xce, 0x09, 0x00, 0x1e, 0x97, 0x35, 0x00, 0x00,
+	     0x00, 0x6e, 0x0c, 0x6a, 0x3b, 0x5f, 0x0a, 0xc5, 0x76, 0xf7,
+	     0xbc, 0x56, 0x7a, 0x00, 0xb0, 0x4b, 0xd9, 0xc7, 0xd9, 0x00,
+	     0x30, 0x24, 0x3d, 0x3e, 0x58, 0xa3, 0x09, 0x00, 0xa2, 0x77,
+	     0x76, 0xe2, 0xbf, 0xe3, 0xe8, 0x0c, 0x00, 0x77, 0x84, 0x7a,
+	     0x00, 0x00, 0x00, 0x9a, 0x26, 0x44, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x79, 0xd1, 0x0e, 0x00, 0x00, 0x10, 0xa5, 0x57, 0x0b,
+	     0x00, 0xb7, 0x4d, 0x5a, 0x00, 0x10, 0x80, 0x6e, 0x0b, 0x00,
+	     0x00, 0x00, 0x00, 0x5a, 0x0f, 0x00, 0x08, 0xb9, 0x4f, 0xb1,
+	     0x08, 0x00, 0x2f, 0x05, 0x00, 0x60, 0x58, 0x45, 0xe9, 0x7d,
+	     0x06, 0x39, 0x05, 0xa8, 0x00, 0x00, 0x00, 0xc1, 0xa5, 0x8a,
+	     0x00, 0xe0, 0x55, 0xc0, 0xc7, 0x79, 0x70, 0x7d, 0x83, 0x3b,
+	     0x09, 0x00, 0xeb, 0x13, 0x5f, 0x2f, 0x0c, 0x00, 0xcf, 0x05,
+	     0x0f, 0x4e, 0x6c, 0xe5, 0xe0, 0x31, 0xcd, 0x83, 0xb1, 0x17,
+	     0x95, 0xb0, 0x7e, 0x8a, 0x7c, 0x47, 0x3d, 0x60, 0x88, 0x8b,
+	     0x0e, 0x00, 0x00, 0xf0, 0xc5, 0x8a, 0x02, 0x00, 0xf9, 0x07,
+	     0x00, 0x05, 0x0c, 0x00, 0x00, 0x20, 0xc9, 0x00, 0xc0, 0x9f,
+	     0xef, 0x86, 0x70, 0x28, 0x3e, 0x11, 0x3e, 0x72, 0x85, 0x00,
+	     0x40, 0xfd, 0x00, 0xf0, 0x9e, 0x6b, 0x80, 0x56, 0x00, 0x50,
+	     0x28, 0x0b, 0x57, 0x06, 0x43, 0xac, 0x12, 0xf1, 0x2f, 0xc5,
+	     0x91, 0x6a, 0xf7, 0x67, 0xca, 0x4b, 0xd6, 0x09, 0x00, 0x00,
+	     0x80, 0x16, 0x00, 0x00, 0x00, 0xe1, 0xed, 0x2f, 0xf1, 0x1f,
+	     0x6e, 0x00, 0xf0, 0x97, 0x36, 0x27, 0xf3, 0x00, 0x50, 0x63,
+	     0x95, 0xdd, 0x5b, 0x02, 0x04, 0x00, 0x00, 0xb0, 0xf8, 0x77,
+	     0x37, 0xfa, 0x00, 0xf0, 0xed, 0xf4, 0x15, 0x6a, 0x00, 0x20,
+	     0x93, 0x00, 0xd0, 0x89, 0xae, 0xb6, 0x0a, 0x00, 0xe0, 0x3e,
+	     0x9e, 0x53, 0x4a, 0xf6, 0xd6, 0xd0, 0xa7, 0x00, 0x07, 0x00,
+	     0x00, 0x00, 0x00, 0x50, 0x03, 0x00, 0xa0, 0x75, 0x71, 0x59,
+	     0xb8, 0x00, 0x00, 0x00, 0x00, 0x50, 0xf8, 0x85, 0xf4, 0x51,
+	     0xa8, 0xae, 0x9d, 0x1b, 0x85, 0x1e, 0x6f, 0xf2, 0x0a, 0x00,
+	     0x00, 0x00, 0x3d, 0x1d, 0xb5, 0x43, 0x03, 0x00, 0x00, 0x40,
+	     0xf8, 0x61, 0x02, 0x3e, 0x0b, 0xb6, 0x22, 0x00, 0x30, 0xb6,
+	     0x8c, 0xb1, 0x23, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x29,
+	     0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xd7,
+	     0x23, 0x9d, 0xc4, 0x71, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x00,
+	     0xb7, 0x09, 0x00, 0x72, 0x04, 0xb5, 0x40, 0x72, 0x67, 0x00,
+	     0x60, 0x0a, 0x00, 0x00, 0x00, 0xdf, 0x18, 0x98, 0x7b, 0xd6,
+	     0x4c, 0xe7, 0x0c, 0x00, 0xbb, 0xbe, 0x14, 0x65, 0xf1, 0x3f,
+	     0x00, 0x00, 0x00, 0x00, 0x70, 0x7f, 0x35, 0xd2, 0x34, 0x00,
+	     0x50, 0xfc, 0x00, 0x20, 0x56, 0x00, 0x60, 0xa5, 0x00, 0xd0,
+	     0x0b, 0x00, 0x30, 0x77, 0x73, 0x02, 0xba, 0xdb, 0x67, 0x69,
+	     0x0a, 0x07, 0x00, 0x30, 0xc6, 0x1f, 0x00, 0x00, 0x00, 0x46,
+	     0x06, 0x00, 0x00, 0x10, 0x51, 0x00, 0x00, 0x00, 0xd5, 0xe2,
+	     0xc4, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x09, 0x77, 0x0e, 0x00,
+	     0x00, 0x80, 0xe8, 0x46, 0xbf, 0xe4, 0x43, 0x64, 0xae, 0x53,
+	     0xdb, 0x57, 0x1e, 0xb0, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x40,
+	     0x16, 0xdb, 0xc6, 0x58, 0x00, 0x00, 0x00, 0x1e, 0x40, 0xf3,
+	     0x93, 0xb4, 0x7f, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x3f,
+	     0x0a, 0x00, 0x64, 0x09, 0x00, 0x9b, 0x0d, 0x00, 0x00, 0xf0,
+	     0x93, 0x45, 0x00, 0x00, 0x63, 0xf0, 0xe6, 0x36, 0x01, 0x00,
+	     0x4e, 0x0c, 0x00, 0x00, 0x60, 0xa8, 0x06, 0x01, 0x33, 0x00,
+	     0x80, 0x57, 0x00, 0x10, 0x09, 0x10, 0x1c, 0x2c, 0xf3, 0x00,
+	     0x00, 0x00, 0xf0, 0x55, 0x71, 0xe1, 0x3b, 0x0f, 0x11, 0x07,
+	     0x70, 0xc3, 0x85, 0xca, 0x53, 0x3c, 0x1d, 0x80, 0x07, 0x00,
+	     0x10, 0xd3, 0x00, 0xe0, 0x4e, 0x00, 0xe0, 0x77, 0x1a, 0x0d,
+	     0x00, 0x00, 0x10, 0x97, 0xd8, 0x7e, 0x12, 0x2e, 0xfa, 0x57,
+	     0x53, 0x83, 0xb6, 0xca, 0x0c, 0x00, 0x00, 0xd0, 0x74, 0x00,
+	     0x40, 0xb8, 0x51, 0x03, 0x00, 0x30, 0x0f, 0x00, 0x00, 0x30,
+	     0x4b, 0xe3, 0x7a, 0x43, 0xeb, 0x00, 0x00, 0xd7, 0xd7, 0x86,
+	     0xa6, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00,
+	     0xa0, 0x29, 0xa7, 0xf7, 0x55, 0x39, 0x02, 0x00, 0x30, 0x02,
+	     0x00, 0x00, 0x80, 0x8d, 0x00, 0x40, 0x7e, 0x4f, 0x76, 0x6f,
+	     0xa0, 0xcd, 0x5a, 0x00, 0x00, 0x00, 0x59, 0x0f, 0x00, 0x34,
+	     0x35, 0x98, 0xe4, 0x5c, 0x13, 0x27, 0x04, 0x00, 0xf0, 0x56,
+	     0xff, 0x47, 0xda, 0x6a, 0x9e, 0x7d, 0x14, 0x04, 0x31, 0x0e,
+	     0xe0, 0x32, 0x68, 0xcf, 0x0c, 0x00, 0x2f, 0xdb, 0x75, 0x00,
+	     0xb0, 0x0e, 0x10, 0xe7, 0x1a, 0x00, 0x90, 0x64, 0x8e, 0x1d,
+	     0x13, 0x9f, 0x00, 0x00, 0xc6, 0x62, 0x0c, 0x9d, 0x8c, 0xe5,
+	     0x00, 0x20, 0x7a, 0xa2, 0x25, 0xb0, 0xe1, 0x05, 0x00, 0x4f,
+	     0x03, 0x00, 0x48, 0xf9, 0xd9, 0x00, 0xe0, 0x98, 0x0f, 0x0b,
+	     0xe1, 0x3a, 0x09, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x14, 0xb5,
+	     0x00, 0xe0, 0x96, 0x79, 0x0d, 0x00, 0x00, 0x40, 0x20, 0x2e,
+	     0x01, 0x00, 0x00, 0xe0, 0x1c, 0x06, 0xbc, 0x51, 0x07, 0xe5,
+	     0x8d, 0x33, 0xe2, 0xd3, 0x00, 0x00, 0x00, 0xe2, 0x9f, 0x86,
+	     0x19, 0x04, 0x00, 0x00, 0xd0, 0x3e, 0x4c, 0x0d, 0x00, 0x50,
+	     0x00, 0xd2, 0xe3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x14,
+	     0x8f, 0x1c, 0x08, 0xe2, 0xfb, 0x27, 0xbf, 0x2d, 0x0e, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x30, 0x3d, 0x65, 0x6d, 0xa5, 0x64,
+	     0xb0, 0x36, 0x6d, 0x01, 0x00, 0x60, 0x01, 0x6c, 0x41, 0x58,
+	     0x47, 0xd0, 0x99, 0xb8, 0x17, 0xf6, 0x02, 0xca, 0x3d, 0x8c,
+	     0x00, 0x70, 0x6c, 0x00, 0x00, 0x00, 0x8f, 0x0c, 0x00, 0x95,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x20,
+	     0x8b, 0x00, 0x70, 0x99, 0x79, 0xc4, 0x0b, 0xfe, 0x00, 0x9c,
+	     0x14, 0xca, 0x65, 0x00, 0x00, 0x00, 0x27, 0x15, 0x43, 0xc6,
+	     0x64, 0x70, 0x0d, 0x78, 0x7d, 0xc8, 0x0c, 0x00, 0x00, 0x20,
+	     0x6e, 0x00, 0x30, 0xc0, 0xbc, 0xa7, 0x2b, 0x00, 0xc0, 0x68,
+	     0x1c, 0x01, 0x00, 0xf4, 0x9c, 0x21, 0x00, 0x00, 0x00, 0xa2,
+	     0x8d, 0x42, 0x00, 0x00, 0x00, 0x00, 0x60, 0xb2, 0xbf, 0x0c,
+	     0x00, 0xfd, 0x0d, 0x00, 0x9c, 0x09, 0x00, 0x00, 0x70, 0xc9,
+	     0xa7, 0x99, 0x32, 0x00, 0x40, 0x41, 0x28, 0x04, 0x00, 0x4f,
+	     0xf1, 0x63, 0x00, 0xf0, 0x8a, 0x00, 0x00, 0x00, 0x56, 0xbe,
+	     0x07, 0x00, 0x00, 0x00, 0x9a, 0x83, 0x94, 0xd4, 0x24, 0x5e,
+	     0xbb, 0xa2, 0x57, 0x32, 0xce, 0x64, 0xf4, 0x67, 0xf0, 0x00,
+	     0x90, 0xc0, 0x63, 0x04, 0x00, 0x19, 0x01, 0x00, 0xd3, 0x0d,
+	     0x00, 0xec, 0x05, 0x00, 0x15, 0x0d, 0xdc, 0x00, 0x00, 0x00,
+	     0xfb, 0xae, 0x74, 0x80, 0x34, 0xda, 0x00, 0x10, 0xfd, 0x49,
+	     0x55, 0x9d, 0x63, 0xc9, 0x70, 0x72, 0x08, 0x00, 0x6c, 0x00,
+	     0x00, 0x23, 0x05, 0x00, 0x8c, 0x23, 0x6c, 0x00, 0x00, 0x00,
+	     0xb3, 0xdb, 0xc2, 0xc9, 0x09, 0xa3, 0xb9, 0x71, 0x47, 0x00,
+	     0x00, 0x00, 0x74, 0x15, 0x8d, 0x0f, 0x07, 0x00, 0x00, 0x60,
+	     0x3b, 0x00, 0xf0, 0x69, 0x00, 0xd0, 0x37, 0x90, 0xd6, 0x7c,
+	     0xd2, 0x38, 0x12, 0x00, 0x30, 0xa6, 0xa7, 0xd1, 0xa9, 0x00,
+	     0x00, 0x00, 0xa8, 0x2a, 0x7b, 0x00, 0x60, 0x42, 0x77, 0xcd,
+	     0x6d, 0xab, 0x10, 0xd9, 0xa9, 0x03, 0x00, 0x00, 0x80, 0x3e,
+	     0x6f, 0xeb, 0x24, 0xe1, 0x9c, 0x7a, 0x7d, 0x8c, 0x7e, 0x15,
+	     0xe8, 0xf4, 0x00, 0xe0, 0xa5, 0x4b, 0x07, 0x00, 0xfe, 0xa4,
+	     0xf9, 0x73, 0x04, 0x00, 0xe0, 0x12, 0x33, 0x00, 0xc0, 0x73,
+	     0x00, 0x00, 0x00, 0x00, 0x70, 0x74, 0xe5, 0xc8, 0x99, 0x49,
+	     0x06, 0x00, 0xec, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+	     0xb4, 0x8f, 0xc8, 0x5d, 0x00, 0x80, 0xb4, 0x5e, 0xec, 0xb0,
+	     0x80, 0x65, 0x23, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	     0x08, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xa0, 0xd6, 0x00, 0x00,
+	     0x26, 0xc0, 0x92, 0x45, 0x00, 0x00, 0x00, 0x25, 0x97, 0x9f,
+	     0x63, 0x0b, 0x6d, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x1a, 0x00,
+	     0xb0, 0x19, 0x00, 0x00, 0x00, 0xcf, 0x0f, 0x00, 0x00, 0x20,
+	     0xb8, 0x2b, 0x67, 0xcc, 0x20, 0x90, 0xdf, 0x00, 0xe0, 0x7e,
+	     0x1b, 0x5a, 0x66, 0xd2, 0x57, 0xab, 0xce, 0x02, 0x00, 0x65,
+	     0x6c, 0xae, 0x0d, 0xf9, 0xb1, 0xbc, 0x03, 0x42, 0x4f, 0x9b,
+	     0x52, 0x2e, 0x80, 0x2b, 0x01, 0xe3, 0x39, 0x80, 0xe6, 0x3b,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x78, 0xb0, 0x6d,
+	     0x00, 0x00, 0x00, 0xe0, 0xf3, 0x38, 0x05, 0x00, 0xd2, 0x4c,
+	     0xf2, 0x00, 0x20, 0xb9, 0x51, 0x14, 0x09, 0xe0, 0xd7, 0x3c,
+	     0x00, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x84, 0x23, 0x6a, 0x0d,
+	     0xa8, 0x32, 0x00, 0x00, 0x00, 0xbe, 0x6f, 0x42, 0x53, 0xa2,
+	     0x00, 0xf9, 0x08, 0x00, 0x00, 0x10, 0x50, 0x67, 0x05, 0x00,
+	     0x00, 0xf0, 0x85, 0xd7, 0xeb, 0x35, 0xae, 0x00, 0x00, 0x1c,
+	     0x01, 0x00, 0xa8, 0xd5, 0x5a, 0x00, 0xa0, 0x73, 0xcd, 0x48,
+	     0x72, 0x9a, 0x97, 0x8a, 0xdf, 0xf5, 0xc7, 0xe2, 0x04, 0x00,
+	     0x50, 0x35, 0x24, 0xf2, 0x30, 0x38, 0x19, 0xff, 0xf3, 0x26,
+	     0x7b, 0x8c, 0x99, 0x04, 0x00, 0x7e, 0x0d, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0xe0, 0x3a, 0x00, 0x00, 0x00, 0x7f, 0x67, 0x2d,
+	     0x22, 0xe2, 0xb9, 0xae, 0xe9, 0x80, 0x44, 0x02, 0x00, 0x82,
+	     0x05, 0x00, 0x72, 0x19, 0x73, 0x00, 0x90, 0x0a, 0x00, 0x00,
+	     0x00, 0xf7, 0x6f, 0xf2, 0x3a, 0xa2, 0x50, 0xcd, 0xdd, 0x19,
+	     0xcf, 0x02, 0x00, 0x00, 0x60, 0xde, 0xc2, 0x05, 0x2e, 0x4c,
+	     0x09, 0x00, 0x78, 0xf4, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0xc0, 0xd7, 0xcf, 0x00, 0xd0, 0x07, 0x00, 0xb0, 0xce,
+	     0x00, 0x00, 0x00, 0xab, 0x22, 0xdb, 0x00, 0x70, 0x19, 0xf7,
+	     0x03, 0x00, 0x00, 0x00, 0x00, 0x41, 0xb6, 0x1f, 0x00, 0x90,
+	     0x29, 0x9c, 0x03, 0x25, 0xaa, 0x0a, 0x00, 0x63, 0x0a, 0xbd,
+	     0xbc, 0x0f, 0x00, 0x00, 0x40, 0x50, 0x52, 0x57, 0x3a, 0x63,
+	     0x09, 0x00, 0xb5, 0x85, 0x74, 0xe3, 0xa1, 0x4e, 0x8d, 0x45,
+	     0xef, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x5c,
+	     0x81, 0x11, 0x1b, 0xcd, 0x0b, 0x00, 0x4a, 0x28, 0x06, 0x80,
+	     0x05, 0x00, 0x24, 0xfb, 0x36, 0x00, 0xe0, 0xcb, 0x44, 0x18,
+	     0x36, 0xa8, 0x05, 0x00, 0x25, 0xb5, 0x62, 0x00, 0x00, 0x00,
+	     0x41, 0x35, 0x22, 0xc3, 0x76, 0x9a, 0x55, 0xd1, 0x8b, 0x25,
+	     0x02, 0x00, 0x5c, 0xb1, 0x17, 0x87, 0x78, 0x3e, 0x8e, 0x0c,
+	     0x00, 0x70, 0x31, 0x61, 0x00, 0xa0, 0x04, 0x00, 0x00, 0x00,
+	     0xdd, 0x05, 0x00, 0x00, 0xa0, 0x81, 0x00, 0xa0, 0x52, 0xd0,
+	     0x04, 0x00, 0x00, 0xb0, 0xea, 0x00, 0x00, 0x00, 0x01, 0x60,
+	     0xfd, 0x43, 0x07, 0x00, 0x6e, 0x59, 0x7d, 0xe4, 0xa4, 0x45,
+	     0x65, 0x06, 0x00, 0x7a, 0x06, 0x00, 0x00, 0xb0, 0xe3, 0x00,
+	     0x00, 0x00, 0x3f, 0x54, 0x34, 0x42, 0x65, 0x8b, 0x00, 0x00,
+	     0x00, 0x20, 0x7b, 0x16, 0x00, 0x60, 0x7d, 0x6d, 0xc8, 0x08,
+	     0x35, 0x60, 0x55, 0x4f, 0xb5, 0x0e, 0xed, 0x08, 0xe9, 0xdb,
+	     0x0d, 0x00, 0x1d, 0x07, 0x00, 0x00, 0xf0, 0xf5, 0xcf, 0x07,
+	     0x17, 0x70, 0x63, 0x5b, 0x14, 0xfd, 0x69, 0x91, 0x54, 0x2c,
+	     0x29, 0x04, 0x00, 0xb0, 0x03, 0x00, 0xba, 0x86, 0x87, 0x00,
+	     0xc0, 0x07, 0x1b, 0x54, 0x16, 0x54, 0x08, 0x00, 0xae, 0xe5,
+	     0x74, 0x5a, 0xb3, 0xdb, 0xef, 0x34, 0x9b, 0x00, 0x00, 0x00,
+	     0x61, 0x04, 0x00, 0x00, 0xb0, 0x57, 0x2f, 0x0a, 0x00, 0x25,
+	     0x09, 0x00, 0xba, 0x13, 0x75, 0x80, 0x08, 0x00, 0x07, 0x06,
+	     0x00, 0xab, 0x3e, 0x0c, 0x4f, 0xb7, 0x2b, 0x42, 0x09, 0x00,
+	     0xd1, 0x8e, 0x14, 0xca, 0x20, 0xa8, 0x00, 0x50, 0x4e, 0x00,
+	     0x00, 0x00, 0x7a, 0x39, 0xc1, 0xae, 0x4e, 0x5a, 0x00, 0xd0,
+	     0x7e, 0x9d, 0xa8, 0x1b, 0xa2, 0x02, 0x00, 0xb0, 0x0b, 0x00,
+	     0xd1, 0x04, 0x00, 0x00, 0x20, 0x96, 0x7f, 0x0d, 0x00, 0x9e,
+	     0x04, 0x00, 0xf0, 0x5e, 0xc4, 0xb4, 0xb5, 0xe0, 0x00, 0xe0,
+	     0x40, 0x00, 0x40, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x60, 0x47,
+	     0xd1, 0xf5, 0x41, 0x55, 0x0e, 0x00, 0x00, 0xb0, 0x73, 0x38,
+	     0x9c, 0x55, 0x00, 0x70, 0x55, 0xbd, 0x1f, 0x2a, 0x9c, 0x8a,
+	     0x5e, 0x60, 0x30, 0x22, 0xec, 0xec, 0x18, 0xfb, 0x0e, 0x00,
+	     0x00, 0x90, 0xe6, 0x00, 0x80, 0x81, 0xde, 0x8d, 0x09, 0xe7,
+	     0x01, 0x00, 0x39, 0x09, 0x95, 0x00, 0x30, 0xe8, 0x00, 0xd0,
+	     0x65, 0xe2, 0x06, 0x00, 0x25, 0x08, 0x00, 0x4c, 0x43, 0x91,
+	     0x00, 0x10, 0x2b, 0x00, 0x10, 0xd9, 0x5d, 0x3f, 0x7d, 0x00,
+	     0x70, 0xb3, 0x00, 0x30, 0x30, 0x00, 0xe0, 0xee, 0x89, 0x82,
+	     0xbc, 0x55, 0x09, 0x00, 0x70, 0xb9, 0x01, 0x00, 0x00, 0x00,
+	     0x80, 0x0a, 0x00, 0x72, 0x04, 0x00, 0x06, 0x06, 0xcb, 0xcc,
+	     0x08, 0x00, 0x00, 0xc0, 0xcb, 0x62, 0xf8, 0xf9, 0x15, 0x24,
+	     0x8c, 0x00, 0x50, 0xa8, 0x0f, 0x04, 0x00, 0xdf, 0xb0, 0xdd,
+	     0x5b, 0x11, 0x04, 0x46, 0x37, 0x7e, 0xef, 0x07, 0x00, 0x00,
+	     0x60, 0x53, 0xd3, 0x29, 0xbe, 0xb9, 0x21, 0x50, 0xc9, 0x00,
+	     0x00, 0x7f, 0x01, 0x00, 0x94, 0x22, 0x0b, 0xad, 0x01, 0x00,
+	     0x24, 0x84, 0x7c, 0xe3, 0x05, 0x00, 0x72, 0x2e, 0x30, 0x76,
+	     0x02, 0x00, 0x27, 0xd2, 0x17, 0xb3, 0x33, 0x6d, 0x00, 0x20,
+	     0x0c, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xc0, 0xb2,
+	     0x3a, 0x94, 0xfe, 0x00, 0x60, 0x68, 0x27, 0xcf, 0xb3, 0x00,
+	     0xa0, 0x99, 0x47, 0x08, 0x00, 0xeb, 0x60, 0x65, 0x68, 0x43,
+	     0x21, 0x3d, 0x08, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xbd, 0x95,
+	     0x14, 0xc0, 0xea, 0xa1, 0x08, 0x00, 0x3e, 0xee, 0x07, 0x00,
+	     0x00, 0xfb, 0x12, 0x09, 0x00, 0x80, 0x27, 0x43, 0x8d, 0x0b,
+	     0x00, 0x85, 0xc6, 0x6d, 0x69, 0x0b, 0x00, 0xf7, 0x75, 0x73,
+	     0x00, 0xf0, 0x4c, 0x01, 0x02, 0x00, 0x00, 0x30, 0x89, 0xeb,
+	     0x70, 0xa0, 0x00, 0x00, 0x00, 0x8b, 0x23, 0xa8, 0x89, 0xd4,
+	     0x17, 0x33, 0xa6, 0xdf, 0x00, 0x00, 0x00, 0xe3, 0x25, 0x7a,
+	     0x00, 0xb0, 0xe4, 0x32, 0x06, 0x00, 0x2c, 0x00, 0x00, 0xd3,
+	     0x7d, 0x7d, 0xc2, 0x04, 0x00, 0x0e, 0x02, 0xd0, 0x00, 0x80,
+	     0x49, 0x12, 0x08, 0x22, 0x00, 0x00, 0x00, 0x49, 0xc2, 0xbc,
+	     0x00, 0xa0, 0xef, 0xc9, 0x46, 0x50, 0x1e, 0x8e, 0xed, 0x93,
+	     0xfb, 0x13, 0x43, 0x01, 0x00, 0x96, 0x0d, 0x00, 0x00, 0x90,
+	     0x05, 0xa4, 0x0f, 0x00, 0x3a, 0x09, 0x00, 0x53, 0x22, 0x96,
+	     0x02, 0xf5, 0x93, 0x7a, 0xd8, 0x96, 0x00, 0x00, 0x00, 0x9f,
+	     0x4b, 0xc8, 0x1d, 0x02, 0xb4, 0x58, 0x57, 0x5d, 0x5d, 0x06,
+	     0x00, 0x2d, 0xa0, 0x98, 0x17, 0xbf, 0x17, 0x00, 0x90, 0x88,
+	     0x0c, 0x0c, 0x00, 0x00, 0x40, 0x4b, 0xc4, 0xff, 0x1e, 0x00,
+	     0x40, 0x0b, 0x00, 0xf0, 0x99, 0x7d, 0x04, 0x00, 0x00, 0x00,
+	     0x00, 0xa0, 0xc3, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x40, 0x39,
+	     0x61, 0xe3, 0x51, 0x00, 0xb0, 0x82, 0x00, 0xa0, 0xcd, 0x6f,
+	     0x05, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0x00,
+	     0x00, 0xe7, 0x08, 0x00, 0x00, 0x80, 0x6b, 0x00, 0xf0, 0xa0,
+	     0xbd, 0x5e, 0x89, 0xdf, 0x31, 0xc7, 0x00, 0x00, 0x00, 0x9f,
+	     0x24, 0xaa, 0x61, 0x09, 0x00, 0x83, 0x04, 0x0a, 0x73, 0x06,
+	     0x00, 0x00, 0x20, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x70, 0xf1,
+	     0xa3, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x36, 0x08, 0x00, 0xdf,
+	     0x3d, 0x9d, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1b, 0x76, 0x01,
+	     0x00, 0x4f, 0x01, 0x00, 0xe1, 0xc5, 0x84, 0x5e, 0xd0, 0x61,
+	     0x00, 0xa0, 0xdc, 0xc1, 0xf8, 0x3d, 0x03, 0x08, 0x00, 0x00,
+	     0x00, 0x00, 0x30, 0x84, 0x12, 0x3d, 0xd0, 0x05, 0x00, 0x40,
+	     0xcb, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0xc2, 0x09, 0x24,
+	     0xac, 0x5a, 0x74, 0xa0, 0x25, 0x36, 0x22, 0xac, 0x44, 0xc6,
+	     0x2b, 0x8a, 0xa2, 0xd5, 0x85, 0x00, 0x00, 0x00, 0xdd, 0xdf,
+	     0x17, 0x00, 0x00, 0x00, 0x66, 0x6f, 0x30, 0x26, 0xe2, 0xea,
+	     0x00, 0x00, 0x00, 0x00, 0xf0, 0xb3, 0xf3, 0x03, 0x00, 0x00,
+	     0x70, 0x5f, 0x51, 0x06, 0x00, 0x6b, 0x07, 0x00, 0x00, 0x10,
+	     0x79, 0x00, 0x50, 0x63, 0x00, 0xd0, 0x63, 0x9f, 0xe2, 0x5b,
+	     0x0a, 0x97, 0x56, 0xf3, 0x0a, 0x24, 0xa8, 0x06, 0x00, 0x00,
+	     0x00, 0x00, 0x50, 0x74, 0x62, 0x00, 0x00, 0x00, 0x7a, 0xaa,
+	     0x54, 0xe8, 0x91, 0x48, 0xa2, 0x27, 0x54, 0x5f, 0x05, 0x00,
+	     0x00, 0x60, 0x47, 0x52, 0x33, 0xbc, 0x00, 0x00, 0x00, 0x00,
+	     0x70, 0x96, 0x23, 0xe0, 0xba, 0xd0, 0x04, 0x00, 0xbb, 0x05,
+	     0x00, 0xb6, 0xe2, 0x09, 0x67, 0x0e, 0x00, 0x00, 0x00, 0x00,
+	     0xaa, 0x16, 0x9d, 0xe4, 0x0b, 0x00, 0xdd, 0x70, 0x75, 0xbb,
+	     0x27, 0x26, 0xd0, 0x0b, 0x00, 0x8e, 0x0c, 0x00, 0x54, 0xf2,
+	     0x08, 0xb3, 0xf3, 0x34, 0xbd, 0x06, 0x00, 0x7a, 0x07, 0x00,
+	     0x4f, 0x16, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x40, 0x83, 0x24,
+	     0x01, 0x00, 0x30, 0xba, 0x2d, 0xbf, 0x83, 0x1c, 0xf2, 0x30,
+	     0xa3, 0xd6, 0x57, 0x3a, 0x6c, 0x00, 0x00, 0xfc, 0x0e, 0x4f,
+	     0x08, 0x00, 0x00, 0xf7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x40, 0x97, 0x6b, 0x77, 0xbe, 0x82, 0x00,
+	     0x00, 0x6e, 0x2b, 0x6e, 0xc0, 0x96, 0x63, 0x6b, 0x02, 0xa1,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0xc0, 0x09, 0x4c,
+	     0x7f, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
+	     0x35, 0xb7, 0x0b, 0x00, 0x00, 0x50, 0xa9, 0x56, 0x02, 0xce,
+	     0x8a, 0x0a, 0xd6, 0xe8, 0x04, 0x00, 0xf0, 0x7c, 0x1f, 0x13,
+	     0x00, 0x00, 0x87, 0x75, 0x40, 0x76, 0x29, 0xfb, 0xec, 0x0d,
+	     0x00, 0xcb, 0x03, 0x00, 0x05, 0x91, 0x28, 0x00, 0x70, 0x86,
+	     0xc7, 0x83, 0x60, 0x00, 0xf0, 0x2f, 0x00, 0x00, 0x00, 0x5f,
+	     0x46, 0x37, 0xa8, 0x06, 0x00, 0xea, 0x0b, 0x00, 0x66, 0x3f,
+	     0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xa3, 0xd1,
+	     0x00, 0xf0, 0x3b, 0x00, 0xe0, 0xc9, 0xfb, 0x87, 0xb6, 0xc5,
+	     0x10, 0x7e, 0x06, 0xdd, 0x0f, 0x7f, 0xe5, 0x0f, 0x00, 0x00,
+	     0x00, 0x64, 0xb9, 0xb6, 0x00, 0x92, 0x56, 0xcf, 0x01, 0x00,
+	     0xf1, 0x94, 0x6c, 0x74, 0x17, 0x51, 0x00, 0xa0, 0xa8, 0x00,
+	     0x00, 0x00, 0x92, 0x77, 0x5f, 0xc3, 0x02, 0x00, 0x00, 0xd0,
+	     0xeb, 0x82, 0x0b, 0x00, 0x00, 0x70, 0xd9, 0x00, 0x70, 0x40,
+	     0x37, 0xad, 0x3e, 0x44, 0xd5, 0x3f, 0x00, 0x40, 0x7b, 0xff,
+	     0xfd, 0x78, 0xb3, 0x86, 0x5f, 0x00, 0xe0, 0x23, 0xb2, 0xa8,
+	     0x32, 0x00, 0xf0, 0x13, 0x94, 0x09, 0x28, 0xeb, 0x36, 0x4e,
+	     0xf9, 0xb2, 0x4a, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x10, 0x00, 0x65, 0xd7, 0x01, 0x00, 0x70, 0x7e, 0x00, 0x00,
+	     0x00, 0x00, 0xf0, 0x73, 0x19, 0x0b, 0x00, 0x50, 0x40, 0x60,
+	     0x29, 0xb1, 0xfa, 0xe6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x2c, 0x02, 0x00, 0xb5, 0x01, 0x00, 0xfb, 0x03,
+	     0x00, 0x00, 0x90, 0x81, 0x00, 0x00, 0x49, 0x18, 0x41, 0x75,
+	     0xde, 0x6d, 0xdb, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x46, 0x25,
+	     0xfa, 0x6e, 0x8d, 0x81, 0x3b, 0xbf, 0x3e, 0x6f, 0x27, 0xb2,
+	     0x5b, 0xde, 0x96, 0xe6, 0x00, 0x00, 0x00, 0x50, 0x0d, 0x79,
+	     0xbd, 0x7f, 0x7e, 0x00, 0x10, 0x78, 0x8a, 0x3a, 0x46, 0x00,
+	     0x40, 0x7e, 0x00, 0x00, 0x00, 0xf5, 0x6c, 0x81, 0xa3, 0x45,
+	     0x25, 0xee, 0xd9, 0xc3, 0x00, 0xd0, 0x73, 0x82, 0xb0, 0x2d,
+	     0x66, 0x99, 0x4a, 0xc1, 0x88, 0xe3, 0xb2, 0x22, 0x37, 0x64,
+	     0xf4, 0xe9, 0x8a, 0x07, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xe4,
+	     0xe7, 0xdd, 0x0c, 0x00, 0xf2, 0x0f, 0x00, 0xb6, 0x0f, 0x00,
+	     0x00, 0x00, 0x00, 0xfc, 0xbf, 0xd6, 0x0e, 0x7d, 0x61, 0x4d,
+	     0xf9, 0xf6, 0x61, 0xc8, 0x11, 0xf6, 0xf6, 0x0f, 0xa6, 0x00,
+	     0x00, 0x1d, 0x05, 0x00, 0x00, 0xa0, 0xdc, 0xee, 0x07, 0x00,
+	     0x00, 0x90, 0x4d, 0x55, 0x73, 0x52, 0x00, 0x10, 0x95, 0x00,
+	     0x40, 0xf6, 0xa6, 0x05, 0x00, 0xac, 0x0c, 0x00, 0x87, 0x91,
+	     0xe6, 0x65, 0x1f, 0xac, 0x00, 0xe0, 0x11, 0xe8, 0xb2, 0x46,
+	     0x3e, 0x85, 0x0f, 0x11, 0x46, 0xed, 0x00, 0x90, 0xd4, 0xb6,
+	     0x9a, 0x5b, 0x00, 0x50, 0x7a, 0x00, 0xb0, 0x29, 0x24, 0x01,
+	     0x00, 0xa4, 0xb9, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x40, 0xdc,
+	     0xc1, 0x45, 0x26, 0xf2, 0x85, 0x76, 0xfc, 0xf2, 0xaa, 0x00,
+	     0xc0, 0xed, 0xf2, 0x96, 0xa1, 0x00, 0x20, 0x9b, 0x05, 0x0f,
+	     0x00, 0x00, 0x70, 0x95, 0x70, 0x4d, 0x5b, 0x00, 0x00, 0x00,
+	     0x00, 0x10, 0xd4, 0xfd, 0x66, 0x7f, 0x5c, 0x0e, 0x00, 0x0e,
+	     0xcf, 0x53, 0xca, 0x74, 0x4e, 0x65, 0x0c, 0x89, 0x50, 0x2e,
+	     0x97, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x10, 0xb5, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xa3,
+	     0xd1, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x53, 0x92,
+	     0x79, 0xa5, 0x0c, 0x96, 0x9c, 0x72, 0x4c, 0xa1, 0x10, 0x6a,
+	     0x00, 0xb0, 0x0c, 0x81, 0xa1, 0x14, 0x80, 0x06, 0x00, 0x5f,
+	     0xf1, 0x1f, 0x50, 0xc6, 0xbb, 0x8e, 0x8a, 0xe8, 0x6e, 0x52,
+	     0xa8, 0xeb, 0x44, 0x6d, 0x81, 0x63, 0x77, 0x00, 0x00, 0x00,
+	     0x00, 0x90, 0x7a, 0x00, 0x00, 0x00, 0x15, 0xd1, 0x9a, 0x66,
+	     0x75, 0xd8, 0x3e, 0x02, 0xae, 0xbc, 0x6e, 0xae, 0x9b, 0x00,
+	     0x00, 0x00, 0xf0, 0x18, 0x00, 0x90, 0xb5, 0xf5, 0x0c, 0x00,
+	     0x00, 0x50, 0xf6, 0xfd, 0x82, 0x26, 0x00, 0x00, 0x00, 0xa3,
+	     0x41, 0x41, 0x51, 0x7e, 0x37, 0x6d, 0x07, 0x00, 0x00, 0x40,
+	     0xfb, 0x3e, 0x06, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3e, 0xbc,
+	     0x52, 0x07, 0x00, 0x67, 0x0d, 0x00, 0x00, 0xe0, 0x80, 0xea,
+	     0x36, 0x3f, 0x4a, 0x05, 0x00, 0x00, 0x50, 0x60, 0x2a, 0x17,
+	     0x11, 0xca, 0x06, 0x00, 0x5e, 0x0a, 0x00, 0x00, 0x00, 0x67,
+	     0xe3, 0x0f, 0x00, 0x00, 0xd0, 0xfc, 0x00, 0x40, 0x74, 0x00,
+	     0x20, 0xc7, 0x00, 0x50, 0xc0, 0xed, 0x0b, 0x00, 0x50, 0xba,
+	     0x97, 0xbf, 0x49, 0x75, 0x36, 0xd8, 0xa6, 0xe4, 0x2d, 0x24,
+	     0x00, 0x60, 0x68, 0xb6, 0xe2, 0x46, 0xea, 0x0c, 0x00, 0x15,
+	     0xf4, 0x06, 0x9b, 0x23, 0xfb, 0x00, 0x50, 0x28, 0x00, 0x10,
+	     0x91, 0xc0, 0x06, 0x50, 0x46, 0x32, 0xa4, 0x69, 0x3f, 0xdb,
+	     0x34, 0x6f, 0xbb, 0x3e, 0x01, 0x00, 0x48, 0xe5, 0x01, 0x14,
+	     0x04, 0x7f, 0x00, 0xa0, 0xfd, 0x5d, 0x0b, 0x00, 0x00, 0x00,
+	     0x00, 0xa9, 0xce, 0xe5, 0x46, 0x07, 0x00, 0x00, 0xd0, 0x0d,
+	     0x00, 0x70, 0x0b, 0x00, 0x00, 0x00, 0xd1, 0x80, 0xfe, 0x66,
+	     0xa6, 0x74, 0x00, 0x20, 0x9b, 0x48, 0x1a, 0x3e, 0x9f, 0x84,
+	     0x68, 0x94, 0x70, 0x4a, 0x00, 0xe0, 0x1c, 0xc9, 0xf0, 0x60,
+	     0x3b, 0x00, 0x00, 0x6b, 0x0f, 0x00, 0xe5, 0x02, 0x00, 0x4e,
+	     0x02, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xf0, 0xc8, 0x00, 0x30,
+	     0xf5, 0x66, 0x9a, 0x36, 0x00, 0x70, 0xf4, 0x00, 0x60, 0x00,
+	     0x00, 0xd0, 0xd0, 0x00, 0x60, 0x5e, 0xef, 0xcd, 0x57, 0x00,
+	     0x70, 0x17, 0xcf, 0xd0, 0xba, 0xc9, 0x38, 0xb7, 0xdc, 0xd0,
+	     0x2e, 0x00, 0xb0, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+	     0x4e, 0x04, 0x00, 0x72, 0x6f, 0x06, 0x00, 0x00, 0x00, 0x39,
+	     0x15, 0x9c, 0x00, 0x00, 0x00, 0x27, 0x07, 0x00, 0xc8, 0x1d,
+	     0xb4, 0xde, 0x6d, 0x09, 0xd8, 0x42, 0x06, 0xe1, 0x54, 0xf3,
+	     0x40, 0x2f, 0x08, 0xa0, 0x8d, 0x25, 0x8b, 0xf0, 0x4a, 0x00,
+	     0x80, 0xf4, 0x00, 0x00, 0x00, 0x4a, 0x02, 0x00, 0x59, 0x09,
+	     0x00, 0x00, 0x10, 0xc7, 0xea, 0x22, 0x0a, 0xf0, 0x0d, 0x00,
+	     0xb3, 0xe9, 0x74, 0x31, 0x04, 0x00, 0x6e, 0xf7, 0x84, 0x8b,
+	     0x24, 0x5f, 0x4a, 0xc7, 0x8f, 0x00, 0x50, 0x15, 0x98, 0x05,
+	     0x00, 0x16, 0xf9, 0x31, 0xc3, 0xbf, 0x58, 0x53, 0x15, 0x13,
+	     0x5b, 0x02, 0x00, 0x45, 0x07, 0x00, 0x96, 0x04, 0x00, 0x32,
+	     0x1a, 0x78, 0xab, 0x9f, 0xc2, 0x8e, 0xfc, 0xec, 0x7a, 0x19,
+	     0x24, 0x00, 0x90, 0x08, 0x00, 0xd0, 0xe2, 0x78, 0x0c, 0x00,
+	     0x73, 0xe3, 0x00, 0xf6, 0x81, 0x24, 0x00, 0x00, 0x00, 0x00,
+	     0x70, 0x78, 0xbb, 0x09, 0xd7, 0x9b, 0x71, 0x86, 0x68, 0xe8,
+	     0x3e, 0x5f, 0xe9, 0xd6, 0x00, 0x90, 0xf2, 0xf2, 0xb4, 0x19,
+	     0x48, 0x00, 0x00, 0xf3, 0xd3, 0xe3, 0xde, 0x02, 0x00, 0xd1,
+	     0xc4, 0xff, 0x00, 0x20, 0x49, 0x14, 0x05, 0x00, 0xc7, 0xe1,
+	     0x1b, 0x54, 0x0b, 0x00, 0xfe, 0x4e, 0x76, 0xb4, 0x28, 0x90,
+	     0x96, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x03, 0x00, 0x00,
+	     0x00, 0x00, 0x4b, 0x6b, 0x23, 0x00, 0x40, 0x0f, 0x00, 0xc0,
+	     0x3d, 0xe7, 0xe3, 0xa4, 0x6a, 0xfe, 0xa3, 0xe9, 0x37, 0xd3,
+	     0x0c, 0x33, 0x0d, 0x65, 0xd0, 0xe4, 0x00, 0x00, 0x00, 0x07,
+	     0x81, 0xb4, 0x81, 0x04, 0x00, 0x63, 0x06, 0x00, 0x81, 0x78,
+	     0x5b, 0x0b, 0x98, 0x0c, 0x00, 0x40, 0x6a, 0x2d, 0xea, 0x3e,
+	     0x7e, 0x9a, 0x93, 0xb0, 0xc5, 0xdd, 0x65, 0x08, 0x00, 0x12,
+	     0x05, 0x00, 0x00, 0x20, 0xf0, 0x00, 0x10, 0x57, 0x42, 0x07,
+	     0x00, 0x6a, 0xe0, 0x6a, 0xaa, 0x0a, 0x21, 0x80, 0x07, 0x00,
+	     0x00, 0xe0, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x40, 0xa8, 0x00, 0x17, 0x73, 0x6d, 0x57, 0x29, 0xa1, 0x0f,
+	     0x00, 0x25, 0x93, 0xc1, 0x00, 0x20, 0xa4, 0xbd, 0x0d, 0x00,
+	     0x08, 0x2c, 0x3e, 0xb3, 0x55, 0x26, 0x67, 0xa4, 0x3a, 0xbb,
+	     0x96, 0x48, 0x11, 0x27, 0xa3, 0x00, 0x40, 0x4e, 0x00, 0x00,
+	     0x00, 0x99, 0x11, 0x55, 0x00, 0x10, 0x2e, 0xf5, 0xd1, 0x60,
+	     0x00, 0x60, 0xa0, 0x92, 0x5a, 0x5b, 0x98, 0x23, 0x75, 0x00,
+	     0xa0, 0x46, 0xac, 0x16, 0xc4, 0x85, 0x5b, 0x9d, 0x00, 0x50,
+	     0x0f, 0xc0, 0xac, 0x84, 0x00, 0x30, 0xa1, 0xbe, 0xd4, 0xb1,
+	     0x44, 0x6e, 0x50, 0x5e, 0x00, 0x3b, 0x1c, 0xe1, 0x42, 0xe4,
+	     0x01, 0x00, 0xbe, 0xe1, 0x09, 0x5b, 0x0f, 0x00, 0x2b, 0xd1,
+	     0x37, 0x00, 0x00, 0xfd, 0x1f, 0x0b, 0x00, 0x8b, 0xc4, 0x0c,
+	     0x00, 0x00, 0x00, 0xf3, 0x05, 0xcc, 0x00, 0x50, 0xdd, 0x00,
+	     0x60, 0x70, 0x89, 0x68, 0x5c, 0xe3, 0x83, 0x8d, 0xad, 0x12,
+	     0x88, 0xa0, 0x0f, 0x00, 0xd5, 0x0f, 0x00, 0x63, 0x03, 0x00,
+	     0x00, 0x10, 0x0b, 0x7f, 0x0c, 0x00, 0xa7, 0x13, 0x6e, 0x2d,
+	     0x31, 0x5d, 0x2b, 0x7d, 0x35, 0x00, 0x30, 0xa4, 0x88, 0x21,
+	     0xd6, 0x55, 0xb1, 0x12, 0x59, 0x05, 0x00, 0x00, 0x80, 0x9b,
+	     0x21, 0x78, 0xf0, 0x00, 0x60, 0x41, 0xb9, 0x00, 0x29, 0x00,
+	     0x00, 0x00, 0x18, 0x0f, 0x00, 0x00, 0x40, 0x3f, 0x00, 0xb0,
+	     0xd0, 0x1c, 0x92, 0xec, 0x00, 0x00, 0x00, 0xae, 0x49, 0x15,
+	     0x6c, 0x03, 0x00, 0xcd, 0x09, 0x00, 0x3c, 0xc6, 0xec, 0x23,
+	     0x9b, 0x69, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xc7, 0xbb, 0x0a,
+	     0x00, 0xc1, 0x38, 0xfd, 0xa9, 0xcd, 0x50, 0x00, 0x00, 0x00,
+	     0x00, 0x40, 0x30, 0x56, 0xa1, 0x1f, 0x0f, 0x08, 0x00, 0xd0,
+	     0x17, 0x49, 0x2b, 0xc7, 0x10, 0x00, 0x00, 0x00, 0xa5, 0x2b,
+	     0xb7, 0x57, 0xcc, 0x81, 0xde, 0x0d, 0x00, 0x35, 0x25, 0xd9,
+	     0xd6, 0x59, 0x63, 0x00, 0x60, 0x0f, 0x0e, 0xd3, 0x3b, 0x81,
+	     0xd9, 0xd8, 0xaf, 0x08, 0x00, 0xee, 0x09, 0x00, 0x00, 0x00,
+	     0x00, 0x60, 0x4d, 0x66, 0x67, 0x02, 0x00, 0x64, 0xf4, 0x25,
+	     0x45, 0x52, 0xef, 0x00, 0x1c, 0xf0, 0xa8, 0x2f, 0xbd, 0x76,
+	     0x05, 0x00, 0x00, 0x30, 0x97, 0x67, 0x91, 0x97, 0x00, 0xc0,
+	     0x7a, 0x00, 0xc0, 0x02, 0x3f, 0x36, 0x5c, 0x5c, 0x35, 0x9e,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xb6, 0xf0,
+	     0xee, 0x0c, 0x00, 0x20, 0x8d, 0x33, 0xf7, 0x64, 0xa3, 0x0d,
+	     0x00, 0x39, 0x01, 0x00, 0x3d, 0x0d, 0x00, 0xbe, 0x99, 0x0f,
+	     0x00, 0x20, 0x04, 0x00, 0x50, 0xb0, 0xde, 0x02, 0xe0, 0x00,
+	     0x00, 0x00, 0x00, 0xd0, 0x7d, 0xdf, 0x53, 0xf5, 0x45, 0xd8,
+	     0x91, 0xa1, 0x1e, 0x81, 0x00, 0xe0, 0x1f, 0x50, 0x09, 0x00,
+	     0x00, 0x00, 0x00, 0xe3, 0x07, 0x00, 0x00, 0x80, 0xa1, 0x00,
+	     0x20, 0x88, 0x00, 0x00, 0x00, 0xcf, 0x9b, 0x73, 0x8b, 0x09,
+	     0xec, 0xba, 0x01, 0x00, 0xf9, 0x7c, 0xbd, 0x10, 0xc0, 0xfd,
+	     0xd3, 0x04, 0x00, 0x24, 0xa0, 0xf7, 0x00, 0x90, 0x44, 0x00,
+	     0xe0, 0xfd, 0x7c, 0xff, 0xab, 0xad, 0x44, 0x59, 0x00, 0x60,
+	     0x30, 0xad, 0x69, 0xa6, 0x00, 0x70, 0x74, 0xdb, 0x06, 0x00,
+	     0x12, 0x39, 0x21, 0xe5, 0x0b, 0x00, 0x51, 0x2d, 0x43, 0x00,
+	     0x30, 0xba, 0x00, 0x00, 0x00, 0x00, 0x90, 0x74, 0x14, 0x98,
+	     0x3d, 0x72, 0xbd, 0x1d, 0xb1, 0x17, 0x9c, 0x75, 0x40, 0x57,
+	     0x97, 0x45, 0x4f, 0x00, 0xe0, 0xf2, 0x04, 0xe0, 0x0f, 0xaf,
+	     0x0b, 0x00, 0x5b, 0xd8, 0x15, 0x0a, 0xe4, 0x42, 0xe4, 0x23,
+	     0x55, 0x00, 0x40, 0x0a, 0x00, 0x40, 0xf0, 0xa1, 0x03, 0x00,
+	     0x16, 0x03, 0x00, 0x00, 0x40, 0xe4, 0x7f, 0x35, 0x09, 0x56,
+	     0x83, 0x21, 0x27, 0x0a, 0x00, 0x5b, 0x01, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x50, 0xce, 0x1c, 0x09, 0x00, 0x09, 0x91, 0xbe,
+	     0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 0x84, 0x0c, 0x00, 0xe1,
+	     0x05, 0x00, 0x3b, 0x07, 0x00, 0xfa, 0x10, 0x0f, 0x00, 0xe0,
+	     0xd6, 0x6b, 0xd2, 0x5c, 0x65, 0x0c, 0x00, 0xb0, 0x51, 0x11,
+	     0x00, 0x80, 0x36, 0x00, 0xf0, 0xc2, 0x00, 0x00, 0x00, 0xb5,
+	     0x0d, 0x00, 0x21, 0x1a, 0x17, 0xf8, 0x07, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0xa0, 0x46, 0xa5, 0xa1, 0x22, 0x00, 0x00, 0x00,
+	     0xcc, 0x07, 0x00, 0x91, 0xa9, 0x84, 0x97, 0xcd, 0xa1, 0x50,
+	     0x1f, 0xa7, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x80,
+	     0x7c, 0x35, 0x37, 0xea, 0x00, 0xb0, 0x98, 0x00, 0xb0, 0x75,
+	     0xfd, 0x52, 0xc4, 0x0e, 0x06, 0x00, 0x43, 0x07, 0x00, 0xa9,
+	     0xb9, 0xde, 0x51, 0xe7, 0x59, 0x69, 0x03, 0x00, 0x00, 0xb0,
+	     0xe2, 0x72, 0x0e, 0x00, 0xc2, 0x0a, 0x00, 0x00, 0x60, 0xf0,
+	     0x9d, 0x72, 0x69, 0x00, 0x00, 0x00, 0x99, 0x09, 0x00, 0xa9,
+	     0x06, 0x56, 0x00, 0x00, 0x00, 0xb5, 0x8d, 0x53, 0x72, 0x0b,
+	     0x00, 0xb6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x55, 0x04, 0x00,
+	     0x9e, 0x05, 0x00, 0x00, 0xc0, 0x8f, 0xaa, 0x94, 0xab, 0xc1,
+	     0x0c, 0x00, 0x00, 0xf0, 0x5e, 0x00, 0xd0, 0x18, 0xf3, 0x49,
+	     0x57, 0xf8, 0xb9, 0xdd, 0x00, 0x00, 0x84, 0xbf, 0xcb, 0x0d,
+	     0x30, 0x36, 0xc9, 0x64, 0x55, 0x40, 0xec, 0x00, 0x00, 0x70,
+	     0x98, 0xae, 0x66, 0x0c, 0x00, 0xc1, 0x4c, 0xc4, 0x82, 0x0d,
+	     0x00, 0xa4, 0x2e, 0x1c, 0x00, 0x00, 0x00, 0xfc, 0xad, 0xef,
+	     0x00, 0x70, 0x51, 0x00, 0x00, 0x00, 0xd1, 0x77, 0x47, 0x7d,
+	     0x10, 0x7b, 0xac, 0x0a, 0x00, 0xbb, 0x03, 0x00, 0x93, 0xc6,
+	     0x4c, 0x00, 0x90, 0x59, 0x97, 0xa6, 0x6f, 0x00, 0x00, 0x00,
+	     0x00, 0x80, 0x15, 0x00, 0x40, 0x95, 0x33, 0x5a, 0x95, 0xfe,
+	     0x06, 0x00, 0x00, 0x90, 0xc9, 0x1f, 0x73, 0xd9, 0x00, 0x40,
+	     0xbc, 0xd5, 0xa2, 0xca, 0xf8, 0x02, 0x2d, 0x00, 0x00, 0x00,
+	     0x00, 0xa0, 0x18, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e,
+	     0x0e, 0x00, 0x00, 0xf0, 0xea, 0x00, 0x00, 0x00, 0xdb, 0xc5,
+	     0x9f, 0x51, 0x76, 0x5a, 0xd4, 0x02, 0x00, 0xfa, 0xa4, 0x6c,
+	     0xb7, 0x14, 0x4a, 0x50, 0x00, 0x00, 0x00, 0xb0, 0x94, 0x00,
+	     0xf0, 0x00, 0x00, 0x2e, 0x18, 0xb4, 0x9e, 0x23, 0x61, 0xd5,
+	     0x44, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xfc, 0x8d, 0x4d, 0xaf,
+	     0x00, 0x00, 0x00, 0x2a, 0x0d, 0x00, 0x00, 0x10, 0x2f, 0x70,
+	     0x9e, 0x8b, 0x4d, 0x05, 0x00, 0xa0, 0x42, 0xf9, 0xc5, 0x0e,
+	     0x00, 0x2d, 0xf2, 0x8f, 0x13, 0xa6, 0x52, 0xe7, 0xaa, 0xb7,
+	     0xfa, 0xaf, 0xc3, 0x3a, 0x1a, 0x35, 0x00, 0x50, 0x7b, 0xec,
+	     0x0b, 0x00, 0x44, 0x04, 0x00, 0x00, 0xe0, 0x2d, 0xa1, 0x00,
+	     0x00, 0x00, 0xc0, 0x01, 0x07, 0x7f, 0xaf, 0xb4, 0x0f, 0x00,
+	     0xf4, 0x0e, 0x00, 0x1f, 0x17, 0xc5, 0x80, 0xda, 0x94, 0x47,
+	     0x98, 0x1f, 0x00, 0xc0, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x40,
+	     0x12, 0xc8, 0x01, 0x00, 0xf3, 0x26, 0x84, 0x37, 0x54, 0x79,
+	     0x00, 0x80, 0xa2, 0x20, 0x2f, 0x47, 0x00, 0x60, 0x2a, 0x00,
+	     0xe0, 0xe5, 0x00, 0xc0, 0x9a, 0xfc, 0x10, 0x7d, 0x00, 0x30,
+	     0x9e, 0x98, 0xe1, 0x7c, 0x03, 0x3a, 0x1b, 0x37, 0x39, 0x6a,
+	     0x00, 0x10, 0x5d, 0xfd, 0x08, 0x00, 0x00, 0x60, 0x1a, 0x00,
+	     0x00, 0x1c, 0x00, 0x40, 0x27, 0xfb, 0xd2, 0x76, 0xc6, 0x5a,
+	     0x45, 0x60, 0x09, 0x00, 0x29, 0x01, 0x00, 0x04, 0x6b, 0xfc,
+	     0xcc, 0x03, 0x00, 0x89, 0x02, 0x00, 0x39, 0xaa, 0x37, 0x62,
+	     0x63, 0x2a, 0xbd, 0xca, 0x37, 0x0b, 0x02, 0x86, 0x5c, 0x6e,
+	     0x73, 0x90, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x50, 0xe9,
+	     0x21, 0x32, 0x77, 0x17, 0x03, 0x00, 0x2c, 0x84, 0x8c, 0x29,
+	     0x95, 0x9a, 0x00, 0xe0, 0xac, 0x5c, 0x01, 0x00, 0x8e, 0x01,
+	     0x00, 0x33, 0x69, 0xe9, 0x5d, 0x0b, 0x00, 0xb8, 0x0b, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x30, 0xe5, 0x1a, 0x04, 0x00, 0x00,
+	     0x50, 0x91, 0x89, 0x0e, 0x00, 0x74, 0x06, 0x00, 0x41, 0xf5,
+	     0x39, 0x60, 0x24, 0x9e, 0x27, 0xf0, 0x35, 0x00, 0x20, 0x47,
+	     0xc7, 0x01, 0x00, 0xd4, 0xa6, 0xd4, 0x95, 0x31, 0x2f, 0x00,
+	     0x00, 0x00, 0x00, 0xe0, 0xb3, 0x35, 0xc7, 0x73, 0x3e, 0x03,
+	     0xb8, 0x00, 0x90, 0x8a, 0x00, 0x00, 0x00, 0x05, 0x73, 0x26,
+	     0x00, 0x00, 0x00, 0xd2, 0x05, 0x00, 0x1f, 0x37, 0x21, 0xa1,
+	     0x05, 0x00, 0x00, 0x90, 0xce, 0x6c, 0xed, 0x1e, 0x62, 0x2b,
+	     0x57, 0x11, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x24, 0x14, 0x1f,
+	     0xb1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x65,
+	     0x3a, 0xe9, 0x8c, 0x6e, 0x2a, 0x04, 0x03, 0x00, 0x9a, 0xda,
+	     0x5d, 0xa2, 0x08, 0x00, 0x71, 0x37, 0x8b, 0x00, 0x00, 0x00,
+	     0x00, 0xa0, 0x76, 0x00, 0x00, 0x00, 0x3f, 0x04, 0x00, 0xc9,
+	     0x09, 0x00, 0xf7, 0x0a, 0x00, 0xac, 0x02, 0x00, 0x00, 0x20,
+	     0x99, 0xe6, 0x00, 0x00, 0x4c, 0x70, 0x8e, 0x00, 0xa0, 0x6a,
+	     0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0xb8, 0x6a,
+	     0x0e, 0x20, 0x4c, 0xe3, 0xe3, 0x29, 0x05, 0x1d, 0x00, 0x00,
+	     0x00, 0x72, 0x26, 0xd9, 0x24, 0xa2, 0x8c, 0xdf, 0x92, 0x8b,
+	     0x00, 0x00, 0x00, 0xe1, 0xc5, 0x1b, 0x00, 0xa0, 0x93, 0x00,
+	     0xe0, 0x79, 0x1b, 0x4f, 0xf0, 0x2e, 0xf1, 0x1e, 0xb7, 0x09,
+	     0x00, 0x00, 0x00, 0x21, 0x56, 0x0e, 0x00, 0xb9, 0x02, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x30, 0x55, 0x41, 0x03, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x0d, 0x00, 0xa6, 0x69,
+	     0x43, 0xf3, 0x04, 0x00, 0xef, 0x7c, 0xf3, 0x05, 0x00, 0x00,
+	     0x64, 0x0f, 0x00, 0x52, 0x11, 0x3d, 0x00, 0xc0, 0x25, 0x6f,
+	     0xda, 0x26, 0x4c, 0x6a, 0x3e, 0x00, 0x80, 0x91, 0x3e, 0xb3,
+	     0x35, 0x00, 0x00, 0x00, 0x8b, 0x07, 0x00, 0x5c, 0x73, 0x21,
+	     0xc9, 0x00, 0x00, 0x06, 0xe6, 0x8b, 0x08, 0x69, 0x0d, 0x00,
+	     0x20, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x3a, 0xb6, 0x09,
+	     0x00, 0x4d, 0x00, 0x00, 0x54, 0xf2, 0xf1, 0x93, 0x07, 0x00,
+	     0xa6, 0xf6, 0x98, 0xb4, 0x90, 0xa6, 0x69, 0x8e, 0x27, 0x00,
+	     0xa0, 0x07, 0x94, 0x9e, 0xf4, 0x15, 0x32, 0xa9, 0x2f, 0x02,
+	     0x00, 0x19, 0xdb, 0x5e, 0x69, 0x0c, 0x00, 0x77, 0x02, 0x00,
+	     0x00, 0x00, 0x00, 0x90, 0x67, 0x92, 0xf8, 0x0b, 0x00, 0x00,
+	     0x70, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x70, 0x47, 0x00, 0x30,
+	     0x65, 0x00, 0x00, 0x00, 0x00, 0x60, 0x87, 0x95, 0xfa, 0x86,
+	     0xf8, 0x7e, 0x4f, 0xb4, 0x01, 0x00, 0x00, 0xd0, 0x26, 0xfb,
+	     0x05, 0x00, 0xbd, 0x50, 0x07, 0x00, 0x60, 0x27, 0x43, 0x05,
+	     0x00, 0x00, 0x00, 0x00, 0x83, 0x81, 0x03, 0xd0, 0x93, 0x26,
+	     0xbe, 0xf3, 0x3a, 0x00, 0x40, 0x2b, 0x2e, 0x0c, 0x00, 0x00,
+	     0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x80, 0x8b, 0xdb, 0xd4,
+	     0x6d, 0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x83, 0x02, 0x00,
+	     0x00, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00, 0x00, 0x00, 0xb3,
+	     0xaa, 0x8d, 0xa7, 0x00, 0x00, 0x4a, 0x8f, 0x98, 0x00, 0x00,
+	     0x00, 0xf0, 0xf9, 0x19, 0x36, 0xf4, 0x4a, 0x6f, 0x08, 0x00,
+	     0x73, 0xf9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa6, 0x41,
+	     0x02, 0x00, 0x97, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	     0x00, 0x00, 0x00,
+	};
+	uint8_t buf[7];
+	uint32_t val, l, nbytes, bucket;
+	size_t len;
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x66ef438d), (uint32_t *)h);
+
+	h[0] = h[0] % 24800;
+	h[1] = h[1] % 24800;
+	h[2] = h[2] % 24800;
+	val = _getbits(g, h[0], 7) ^ _getbits(g, h[1], 7) ^ _getbits(g, h[2], 7);
+	l = lcp[val >> 3];
+	nbytes = (l + 7) >> 3;
+	len = nbytes < keylen ? nbytes : keylen;
+	memcpy(buf, key, len);
+	memset(buf + len, 0, nbytes + 4 - len);
+	if (l & 7)
+		buf[nbytes - 1] &= (uint8_t)(0xff00 >> (l & 7));
+	buf[nbytes] = (uint8_t)(l & 7);
+	mi_vector_hash(buf, nbytes + 1, UINT32_C(0x1befd79f), (uint32_t *)h);
+
+	h[0] = h[0] % 3750;
+	h[1] = h[1] % 3750;
+	h[2] = h[2] % 3750;
+	bucket = _getbits(pg, h[0], 12) ^ _getbits(pg, h[1], 12) ^ _getbits(pg, h[2], 12);
+	return (bucket << 3) | (val & 0x7);
+}
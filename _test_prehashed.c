@@ -0,0 +1,2557 @@
+/* generated with rurban/nbperf 08a5797  -H 128 _hashes */
+/* seed[0]: 719885386, seed[1]: 1649760492 */
+#include <stdint.h>
+
+static inline uint64_t _inthash64(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return x ^ (x >> 31);
+}
+
+#include <string.h>
+
+static inline uint64_t
+_fixed_le(const uint8_t *p, unsigned n)
+{
+	uint64_t v = 0;
+
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	memcpy(&v, p, n);
+#else
+	while (n--)
+		v = v << 8 | p[n];
+#endif
+	return v;
+}
+
+static inline void
+_fixedhash(const uint64_t h_lo, const uint64_t h_hi, uint64_t *h)
+{
+	uint64_t x = UINT64_C(0x625558ec2ae8944a);
+
+	x = _inthash64((h_lo ^ x) + h_hi);
+	h[0] = x;
+}
+
+#include <string.h>
+const uint8_t hash_keys[2000][16] = {
+	{ 0x43, 0xe2, 0xd5, 0x65, 0xf8, 0xe4, 0x79, 0x96, 0xfb, 0x90, 0xc3, 0x7b, 0xd2, 0x1a, 0x68, 0x82 },
+	{ 0xe9, 0xa0, 0xaa, 0xb6, 0x5d, 0xb0, 0xc5, 0x21, 0x11, 0x1a, 0x49, 0x1d, 0x1d, 0x32, 0x41, 0xe9 },
+	{ 0xe4, 0xcb, 0xec, 0x0e, 0x5d, 0xaa, 0xad, 0x21, 0x84, 0xaa, 0x95, 0x7c, 0xfd, 0xd0, 0xe8, 0x80 },
+	{ 0x44, 0x9d, 0x8d, 0x4f, 0x2a, 0x59, 0xa5, 0x38, 0xe4, 0x7a, 0x6e, 0x42, 0x11, 0x84, 0xfc, 0xef },
+	{ 0xc0, 0x24, 0x59, 0xc2, 0x9e, 0x04, 0x15, 0xe1, 0xc0, 0xf2, 0x82, 0xfe, 0x4a, 0xfe, 0x6b, 0x3a },
+	{ 0x4e, 0xc9, 0x20, 0xe0, 0x2f, 0x0c, 0xfb, 0xeb, 0xfe, 0xab, 0xa6, 0xf6, 0x73, 0xde, 0xf1, 0x1c },
+	{ 0x13, 0x6f, 0x47, 0x20, 0xd2, 0x30, 0x41, 0xef, 0x4b, 0x9a, 0x68, 0xe2, 0xa0, 0xf8, 0xe3, 0xa7 },
+	{ 0x57, 0xe2, 0xdc, 0xda, 0xfd, 0x16, 0xf3, 0xb8, 0x2f, 0xdb, 0x1c, 0x4b, 0x13, 0x5a, 0xf7, 0x0b },
+	{ 0xad, 0xdf, 0x09, 0x37, 0xcb, 0x46, 0xc7, 0x60, 0x75, 0x92, 0xd4, 0xf5, 0x48, 0x28, 0x71, 0x1e },
+	{ 0x22, 0xd9, 0x04, 0xcd, 0x54, 0x89, 0x0f, 0xb8, 0xf2, 0xcb, 0xa5, 0x57, 0xb0, 0x8a, 0xf8, 0x9a },
+	{ 0xf1, 0xe9, 0x32, 0x7d, 0x7a, 0x8d, 0x18, 0x15, 0x59, 0x42, 0x37, 0x3e, 0x2e, 0xb3, 0xbd, 0x24 },
+	{ 0x29, 0xe5, 0xbd, 0x68, 0x3b, 0x4b, 0x11, 0x56, 0x51, 0xb8, 0x17, 0x3f, 0x5f, 0x0a, 0x9c, 0x0c },
+	{ 0xe6, 0x02, 0xe8, 0x02, 0x43, 0x66, 0x97, 0xbf, 0x56, 0x27, 0x54, 0xc3, 0x8c, 0xef, 0x33, 0x8a },
+	{ 0xa3, 0x89, 0x7e, 0x11, 0xc7, 0x20, 0x7e, 0x3e, 0x5b, 0x27, 0xe2, 0x67, 0x47, 0xab, 0x92, 0x65 },
+	{ 0x60, 0xe6, 0x1c, 0x8b, 0x4c, 0x68, 0x71, 0x4e, 0x60, 0xed, 0xb5, 0x32, 0x63, 0x44, 0x08, 0xb5 },
+	{ 0xe5, 0xda, 0x94, 0x22, 0x8c, 0x04, 0xc0, 0xa1, 0x6d, 0x08, 0xb5, 0xf6, 0x79, 0x7f, 0x4f, 0x06 },
+	{ 0xf7, 0x79, 0xa8, 0x0e, 0xad, 0x07, 0x5c, 0xb7, 0xcf, 0x9b, 0x95, 0xa5, 0x8c, 0x7d, 0xaa, 0xfa },
+	{ 0xdb, 0xdc, 0x28, 0xa9, 0x8d, 0x12, 0xa9, 0xc3, 0x53, 0xb5, 0xd9, 0x01, 0xfd, 0x77, 0xcc, 0x1d },
+	{ 0xa3, 0x35, 0x8e, 0xe7, 0xc9, 0x3a, 0x97, 0x60, 0x5b, 0xb3, 0x6d, 0xb4, 0x09, 0x66, 0xc0, 0x4d },
+	{ 0x4f, 0xc3, 0x4c, 0xa9, 0xdf, 0xac, 0x93, 0x34, 0xe7, 0xec, 0xe8, 0x03, 0xa1, 0xfb, 0x63, 0x5c },
+	{ 0xf8, 0xa1, 0xfb, 0xee, 0x63, 0x69, 0x33, 0xd5, 0xb8, 0xba, 0x34, 0x72, 0x9f, 0xed, 0x8e, 0x7e },
+	{ 0x50, 0xeb, 0x9f, 0x89, 0x96, 0x0e, 0x6b, 0x52, 0xd0, 0x0b, 0x88, 0xd0, 0xb3, 0x6b, 0x48, 0xe0 },
+	{ 0xfe, 0x1c, 0xf5, 0x35, 0x17, 0x2a, 0xfd, 0x3f, 0x2e, 0xf7, 0xb5, 0x6c, 0xae, 0x26, 0x87, 0x0e },
+	{ 0xb5, 0x52, 0x8a, 0x92, 0xe6, 0x96, 0x0d, 0xc3, 0xbd, 0xf4, 0x7c, 0xf0, 0xf8, 0xcb, 0xd6, 0xe5 },
+	{ 0x56, 0x3c, 0xa1, 0x3b, 0x4b, 0x5c, 0x41, 0x4e, 0x46, 0x0e, 0x4f, 0xf1, 0x23, 0x82, 0x57, 0xe4 },
+	{ 0x2b, 0xdd, 0x44, 0x7d, 0xa3, 0xda, 0x8d, 0x4d, 0x23, 0xde, 0x3e, 0x3f, 0x00, 0x75, 0x09, 0x44 },
+	{ 0x11, 0x77, 0xc0, 0x0b, 0x6a, 0xa1, 0xc4, 0xf7, 0x79, 0x74, 0x41, 0xe2, 0xff, 0x8d, 0x76, 0x70 },
+	{ 0x6e, 0x41, 0x32, 0x24, 0xa0, 0x66, 0x2d, 0x97, 0x1e, 0xc1, 0xd3, 0x2d, 0xf6, 0x27, 0xb6, 0x22 },
+	{ 0xf0, 0xc1, 0xdf, 0x9c, 0xc3, 0x2b, 0x41, 0xf7, 0x70, 0x23, 0x98, 0x71, 0x1b, 0x43, 0xd9, 0xa0 },
+	{ 0x53, 0x89, 0x62, 0x3d, 0xb1, 0x58, 0x99, 0xb4, 0x8b, 0xfe, 0x7c, 0x2a, 0x44, 0xae, 0x55, 0x3f },
+	{ 0xf1, 0x13, 0x2b, 0x12, 0x79, 0x00, 0x0c, 0x84, 0x59, 0x7c, 0xf1, 0x17, 0xcd, 0xd5, 0xa6, 0xb0 },
+	{ 0xba, 0x12, 0xcc, 0xef, 0x67, 0xe3, 0xab, 0x8b, 0x4a, 0x47, 0x53, 0x24, 0xc9, 0x9b, 0x3a, 0x08 },
+	{ 0xa2, 0xf8, 0xbe, 0xbc, 0x93, 0x1f, 0x46, 0x0b, 0x72, 0x77, 0xf1, 0x7a, 0xa7, 0x64, 0xe7, 0x83 },
+	{ 0xd6, 0x1c, 0xe7, 0x4b, 0x0c, 0xc6, 0x0a, 0xfb, 0xc6, 0x62, 0x03, 0xce, 0x2c, 0xa8, 0x68, 0xfb },
+	{ 0xfa, 0x17, 0x6b, 0xc2, 0xc7, 0x51, 0x8a, 0x19, 0x8a, 0x8e, 0x8a, 0xff, 0x1c, 0xc0, 0xb7, 0x59 },
+	{ 0x20, 0x0b, 0x76, 0x4d, 0xeb, 0x6c, 0x86, 0x2f, 0x20, 0xe0, 0x38, 0x31, 0xae, 0x42, 0x74, 0xef },
+	{ 0xb7, 0x5f, 0x8d, 0xf1, 0xcd, 0xdf, 0x03, 0xf2, 0x8f, 0x37, 0x81, 0x5d, 0xe9, 0xc7, 0x38, 0x63 },
+	{ 0xff, 0xc2, 0x30, 0xd5, 0xc9, 0xe4, 0xae, 0xaa, 0x17, 0xc4, 0x83, 0xc6, 0x9d, 0xfe, 0x26, 0x36 },
+	{ 0x1e, 0x80, 0x8a, 0x2f, 0x08, 0xcb, 0xb5, 0xb3, 0x4e, 0xef, 0x05, 0x37, 0xe1, 0xde, 0x56, 0xce },
+	{ 0x01, 0x0f, 0xa8, 0x13, 0x2f, 0x5a, 0x12, 0x80, 0xe9, 0x5d, 0x1f, 0x7a, 0x7c, 0xae, 0x66, 0x85 },
+	{ 0x03, 0xb3, 0x3e, 0xfe, 0x99, 0x03, 0xa8, 0x99, 0xbb, 0x0f, 0xd2, 0xc6, 0xdf, 0xd3, 0x01, 0xa5 },
+	{ 0x4b, 0x16, 0xe2, 0xe1, 0x95, 0x08, 0x53, 0x52, 0x43, 0x9c, 0xd4, 0x2f, 0x94, 0x0a, 0xf0, 0x77 },
+	{ 0xbe, 0x41, 0x4e, 0xf8, 0xb5, 0x2e, 0x12, 0x21, 0xee, 0xe9, 0x38, 0x6b, 0xf9, 0x24, 0xf3, 0x48 },
+	{ 0xd3, 0xe7, 0x90, 0x0c, 0x6e, 0x1b, 0x3d, 0xae, 0x0b, 0x01, 0x60, 0x94, 0x29, 0x3c, 0x22, 0xfa },
+	{ 0xd8, 0xbc, 0x4e, 0xb4, 0x6e, 0x21, 0x55, 0xae, 0x98, 0x70, 0x13, 0x35, 0x49, 0x9d, 0x7a, 0x62 },
+	{ 0xac, 0x63, 0xc6, 0x2c, 0x17, 0xff, 0x08, 0x65, 0x8c, 0xff, 0xc0, 0x75, 0xf8, 0x72, 0xba, 0x82 },
+	{ 0x83, 0xe7, 0x74, 0x38, 0x58, 0x53, 0x58, 0x24, 0x3b, 0xd8, 0xfa, 0x56, 0x26, 0x3f, 0xe5, 0xd3 },
+	{ 0x16, 0x76, 0x76, 0x48, 0x69, 0x1a, 0xd0, 0x66, 0x06, 0x1e, 0xaf, 0x5c, 0xbe, 0x11, 0xb8, 0x64 },
+	{ 0x65, 0x3d, 0xf2, 0x73, 0x51, 0x15, 0xaf, 0x01, 0xed, 0xae, 0x3a, 0x46, 0xa6, 0x3d, 0xa5, 0x79 },
+	{ 0x77, 0x6f, 0x6a, 0x69, 0xed, 0x2a, 0x9f, 0x9b, 0x4f, 0x0d, 0x27, 0xef, 0xe4, 0x34, 0xb0, 0x57 },
+	{ 0xbd, 0x5c, 0x9e, 0x79, 0x85, 0x47, 0xf3, 0x0f, 0x05, 0xc6, 0xd3, 0xca, 0x1b, 0x99, 0x75, 0x4f },
+	{ 0x04, 0xc2, 0xe6, 0x11, 0xc9, 0x5d, 0xba, 0x19, 0xa4, 0x6d, 0xf1, 0x40, 0x5c, 0x82, 0x68, 0x2a },
+	{ 0xa3, 0x5f, 0x86, 0x7c, 0xc8, 0xad, 0x8a, 0xcf, 0x5b, 0xed, 0x27, 0x8e, 0xa8, 0x88, 0xa9, 0xd9 },
+	{ 0xfc, 0x4e, 0x66, 0xb6, 0xad, 0x0d, 0x74, 0xb7, 0x5c, 0x0b, 0x49, 0x46, 0xac, 0xde, 0x02, 0x63 },
+	{ 0xc8, 0x6d, 0xe1, 0x88, 0xbb, 0xe1, 0x67, 0xd4, 0x08, 0x1b, 0x71, 0x1f, 0x5c, 0x7f, 0xe8, 0x75 },
+	{ 0x98, 0x8d, 0xb7, 0x4c, 0x10, 0x40, 0x83, 0xb1, 0x58, 0xef, 0x21, 0x80, 0x56, 0x56, 0x14, 0x85 },
+	{ 0x59, 0x04, 0x5c, 0x84, 0x64, 0x19, 0x63, 0x1f, 0x01, 0x3b, 0xfe, 0x24, 0x53, 0xe7, 0x4d, 0xcf },
+	{ 0xfd, 0xdf, 0x25, 0x0b, 0xe1, 0x0e, 0xac, 0xea, 0x45, 0xbb, 0x39, 0x33, 0x4c, 0x25, 0xae, 0x44 },
+	{ 0x9c, 0xd1, 0xb5, 0x9f, 0xdd, 0x44, 0x63, 0x7e, 0xfc, 0xae, 0xe4, 0x33, 0xd6, 0x70, 0xc1, 0x0b },
+	{ 0x5b, 0x50, 0xd3, 0xc2, 0xc9, 0x8e, 0xc6, 0xf4, 0xd3, 0xd4, 0x99, 0xd8, 0x31, 0x97, 0x8d, 0x1e },
+	{ 0xf3, 0x20, 0x2e, 0x71, 0x60, 0x49, 0x02, 0xb3, 0x2b, 0xbf, 0xf5, 0x84, 0xbd, 0xd1, 0x08, 0x2e },
+	{ 0x6e, 0x80, 0xa6, 0x03, 0x1e, 0x93, 0x9a, 0x3d, 0x1e, 0x18, 0x6b, 0x74, 0xe4, 0xdb, 0x93, 0xf4 },
+	{ 0xa2, 0xb9, 0x4a, 0xdd, 0x15, 0xf3, 0xd8, 0x64, 0x72, 0x20, 0x5a, 0x34, 0xb9, 0xb0, 0x09, 0xb2 },
+	{ 0x44, 0x5e, 0x19, 0x70, 0xac, 0x2c, 0x38, 0x92, 0xe4, 0x23, 0xd7, 0xfb, 0x22, 0xd0, 0x1e, 0x1e },
+	{ 0xe1, 0x18, 0xae, 0x10, 0xc3, 0xa6, 0x05, 0x88, 0xc9, 0x9a, 0xc3, 0xb5, 0x1d, 0xfd, 0xe6, 0xdb },
+	{ 0x52, 0x76, 0x8b, 0xa7, 0x79, 0xb0, 0x3b, 0xce, 0xa2, 0xfc, 0xba, 0xca, 0x80, 0xcf, 0x65, 0x01 },
+	{ 0x25, 0xa1, 0xbf, 0x15, 0x6e, 0x46, 0x31, 0x89, 0xad, 0xf8, 0x54, 0x8b, 0xdf, 0xef, 0xee, 0x85 },
+	{ 0x58, 0x5e, 0x20, 0xe5, 0xb1, 0x5e, 0xb1, 0xb4, 0x18, 0x6e, 0x30, 0xcb, 0x63, 0x0f, 0xae, 0xa7 },
+	{ 0x30, 0x49, 0x96, 0xb0, 0x27, 0x41, 0x45, 0x38, 0xb0, 0xbc, 0xa0, 0xbf, 0x92, 0xff, 0x9a, 0x4e },
+	{ 0x7d, 0x81, 0xf7, 0x3b, 0x24, 0x4c, 0x08, 0xf1, 0xc5, 0xb8, 0x56, 0xc9, 0x66, 0x97, 0xe1, 0x89 },
+	{ 0xf0, 0xac, 0x63, 0x52, 0x44, 0x72, 0xc7, 0xbf, 0x70, 0x06, 0xbb, 0x04, 0xcc, 0xb1, 0xe4, 0x5a },
+	{ 0x3f, 0x9e, 0xd7, 0x12, 0x2b, 0xe0, 0x99, 0xc9, 0x57, 0xd1, 0x00, 0xc8, 0x52, 0x00, 0xbb, 0xfb },
+	{ 0xcd, 0x2d, 0x23, 0xe6, 0x3c, 0x2e, 0x06, 0x9d, 0x95, 0x6d, 0x47, 0x53, 0x2c, 0x4f, 0x4c, 0x98 },
+	{ 0x96, 0x2c, 0xc4, 0xc3, 0x2b, 0x11, 0xa6, 0xa4, 0x86, 0x38, 0xa9, 0x5f, 0x28, 0x15, 0xe0, 0xef },
+	{ 0xbe, 0x17, 0x56, 0x63, 0xb7, 0xbb, 0x1e, 0xb2, 0xee, 0xaf, 0x7e, 0x91, 0x5a, 0x02, 0x0a, 0xbd },
+	{ 0xf3, 0x0b, 0xb2, 0x26, 0xe1, 0x8f, 0x88, 0x7b, 0x2b, 0xa2, 0x18, 0x18, 0x6e, 0x40, 0x14, 0xe8 },
+	{ 0xee, 0x9f, 0x60, 0xf3, 0x5c, 0x29, 0xd1, 0x90, 0x9e, 0xc3, 0xb6, 0x97, 0xdb, 0xb5, 0x82, 0xdd },
+	{ 0xe1, 0x81, 0x1a, 0x85, 0x3f, 0x46, 0x66, 0x9d, 0xc9, 0x2b, 0x15, 0xd6, 0xaa, 0xd3, 0xad, 0x39 },
+	{ 0xa1, 0x7c, 0x7b, 0xb2, 0xdf, 0xd7, 0x87, 0x0f, 0x89, 0xe4, 0xdd, 0xfa, 0x56, 0xaf, 0x30, 0xe8 },
+	{ 0x9e, 0x08, 0xb1, 0x93, 0xc3, 0x00, 0x4d, 0x1c, 0xce, 0x2b, 0xa3, 0x7a, 0x65, 0x8f, 0x0c, 0x15 },
+	{ 0x95, 0x86, 0x88, 0x24, 0x79, 0x56, 0xf4, 0x39, 0x9d, 0x6b, 0xdb, 0x05, 0x39, 0x3d, 0x40, 0xc8 },
+	{ 0xf5, 0x03, 0x39, 0x3b, 0x49, 0x1f, 0x05, 0x73, 0xfd, 0xc7, 0x3f, 0x18, 0x0f, 0xab, 0x81, 0x1f },
+	{ 0xb7, 0x89, 0x85, 0x86, 0xcc, 0x52, 0xf7, 0x60, 0x8f, 0x71, 0x3b, 0x37, 0x88, 0xea, 0x21, 0xef },
+	{ 0xbe, 0x56, 0xca, 0x42, 0x35, 0xe8, 0x8b, 0x58, 0xee, 0x06, 0x16, 0xd8, 0x48, 0xb6, 0xe7, 0x8e },
+	{ 0x8f, 0x89, 0x77, 0x9c, 0xc1, 0xee, 0x04, 0x1c, 0x27, 0xdd, 0x88, 0x98, 0x06, 0x6c, 0x03, 0xdc },
+	{ 0xc4, 0x3e, 0x5f, 0x80, 0x6d, 0x96, 0x01, 0x3f, 0x64, 0x78, 0x8b, 0xd8, 0x2b, 0xf6, 0x2f, 0x35 },
+	{ 0xf4, 0xb1, 0xed, 0xc5, 0x93, 0x4a, 0x3a, 0xe6, 0x14, 0x6f, 0xe6, 0x71, 0x5d, 0x18, 0xb4, 0x0f },
+	{ 0xbc, 0x34, 0x4b, 0x99, 0xce, 0xe5, 0x1b, 0xf2, 0x1c, 0xa7, 0x34, 0xfe, 0x08, 0x29, 0x91, 0xcb },
+	{ 0x49, 0x5d, 0xcf, 0xac, 0xab, 0xa5, 0x43, 0x01, 0x71, 0xcd, 0x44, 0x76, 0xe1, 0x53, 0x60, 0x12 },
+	{ 0x7b, 0x9e, 0xec, 0x71, 0x3b, 0x76, 0x05, 0x31, 0xf3, 0xaf, 0x0c, 0x36, 0x15, 0xbe, 0x68, 0x98 },
+	{ 0x50, 0xd6, 0x23, 0x3f, 0x17, 0x55, 0xf1, 0x1a, 0xd0, 0xee, 0xaa, 0x63, 0x64, 0xda, 0x53, 0x9a },
+	{ 0xed, 0xba, 0xb0, 0x74, 0x2c, 0x42, 0xb2, 0x7f, 0xb5, 0x9f, 0x51, 0xf7, 0xfd, 0x29, 0x05, 0xe4 },
+	{ 0x41, 0xea, 0x4e, 0x51, 0x90, 0x55, 0xfd, 0x9e, 0x29, 0x6b, 0x9c, 0x7b, 0x31, 0xb0, 0xfa, 0x4a },
+	{ 0x33, 0x65, 0x41, 0x23, 0x3e, 0xe4, 0x4d, 0xe7, 0x6b, 0x5d, 0xc4, 0xa6, 0xff, 0xa9, 0x63, 0x51 },
+	{ 0xbd, 0xda, 0x86, 0x38, 0x81, 0xa0, 0xcd, 0x5c, 0x05, 0x74, 0x02, 0x58, 0xf8, 0x00, 0x31, 0xf3 },
+	{ 0x1b, 0x21, 0x3c, 0x5b, 0x6b, 0xad, 0xf4, 0xf7, 0x93, 0x53, 0xa8, 0x23, 0x3f, 0x50, 0x27, 0x41 },
+	{ 0xb1, 0x4d, 0x00, 0x1f, 0x97, 0xbe, 0x9a, 0x9c, 0x19, 0x8c, 0x51, 0x83, 0x67, 0x65, 0x07, 0x31 },
+	{ 0x06, 0x66, 0x7d, 0xfc, 0x33, 0x07, 0x50, 0x33, 0x76, 0x1f, 0xa4, 0x8d, 0xbf, 0xa7, 0x03, 0x4a },
+	{ 0x4a, 0x03, 0x0b, 0x4c, 0x5e, 0x60, 0xf5, 0x6b, 0x5a, 0x9a, 0x12, 0xd0, 0xd0, 0x2b, 0x00, 0x3a },
+	{ 0x10, 0x25, 0x75, 0x96, 0xb4, 0xcc, 0xf9, 0x6a, 0x90, 0x1b, 0xe8, 0x3b, 0x4e, 0xfb, 0xa8, 0x60 },
+	{ 0x58, 0x49, 0xa4, 0x9a, 0x32, 0xa5, 0x37, 0x7d, 0x18, 0x51, 0x53, 0x5e, 0x14, 0x7e, 0xb9, 0x61 },
+	{ 0x15, 0xa6, 0x42, 0x14, 0xb8, 0xec, 0x2a, 0x8d, 0x1d, 0x17, 0x27, 0x29, 0x30, 0x17, 0x2f, 0xb1 },
+	{ 0x6a, 0x90, 0x98, 0xda, 0x4d, 0x74, 0xa1, 0x4e, 0x7a, 0xcc, 0x1c, 0x74, 0xa2, 0x06, 0xb9, 0x85 },
+	{ 0xa6, 0x3c, 0xbd, 0x0f, 0x61, 0x24, 0x26, 0xd8, 0x16, 0x37, 0xb4, 0x2e, 0x27, 0x7f, 0x94, 0x0a },
+	{ 0x9f, 0x45, 0x80, 0xbe, 0xf9, 0x1b, 0x9e, 0x71, 0xb7, 0x67, 0x1f, 0xb4, 0xc7, 0x90, 0xe5, 0xde },
+	{ 0x61, 0xa1, 0xd4, 0x74, 0x7e, 0xdc, 0x9c, 0xf0, 0x49, 0xd7, 0x60, 0xf9, 0xa1, 0xad, 0x9c, 0x22 },
+	{ 0x5f, 0x2b, 0x65, 0xa1, 0x1a, 0xf4, 0x45, 0xac, 0x77, 0x03, 0x0b, 0x6c, 0x24, 0xdb, 0x73, 0x47 },
+	{ 0x82, 0x80, 0xad, 0x78, 0x23, 0xc5, 0x13, 0x60, 0x52, 0x62, 0xc4, 0x43, 0x25, 0x1b, 0x23, 0x7e },
+	{ 0xb1, 0xe4, 0x93, 0xaa, 0x1a, 0x1f, 0x3a, 0x87, 0x19, 0xfb, 0xff, 0x62, 0xda, 0x8e, 0x40, 0xd3 },
+	{ 0x06, 0x7b, 0xf9, 0x46, 0xb3, 0xc0, 0xc9, 0x6a, 0x76, 0x3c, 0x81, 0xfa, 0x0e, 0x39, 0xf8, 0x8f },
+	{ 0xbe, 0xed, 0x5d, 0xce, 0xb8, 0x48, 0x2b, 0x43, 0xee, 0x75, 0xc4, 0xb7, 0xbb, 0xdf, 0x20, 0x31 },
+	{ 0xbe, 0x80, 0xc2, 0xd7, 0x33, 0x5b, 0x7f, 0xc7, 0xee, 0x40, 0xd0, 0xb1, 0xe7, 0xd8, 0xd0, 0x1a },
+	{ 0x22, 0xc4, 0x88, 0x82, 0xd5, 0xcf, 0x95, 0x80, 0xf2, 0xae, 0xc8, 0xea, 0x60, 0xf9, 0x03, 0x55 },
+	{ 0x6f, 0x3b, 0x5e, 0xed, 0x4f, 0x07, 0xc6, 0xdf, 0x07, 0x02, 0x16, 0x3b, 0x23, 0x45, 0x28, 0x62 },
+	{ 0xd5, 0x8b, 0x27, 0xf7, 0xd8, 0xc4, 0xd2, 0xc7, 0xdd, 0xb2, 0x12, 0xe1, 0x8c, 0x61, 0xbd, 0x19 },
+	{ 0xf0, 0xd6, 0x5b, 0xe7, 0x42, 0xe5, 0xba, 0x2e, 0x70, 0x40, 0x75, 0xde, 0x6a, 0xd4, 0xcd, 0xe6 },
+	{ 0xc6, 0xb4, 0xce, 0x53, 0xd1, 0x7e, 0x58, 0x83, 0x36, 0x4c, 0xe1, 0x65, 0xa9, 0xc8, 0x58, 0x10 },
+	{ 0x10, 0x10, 0xf9, 0x4b, 0x35, 0x13, 0x80, 0x33, 0x90, 0xfe, 0x0a, 0xcf, 0xfe, 0x69, 0xb4, 0x1a },
+	{ 0xd1, 0x71, 0x21, 0x39, 0x0a, 0x33, 0xe6, 0x69, 0x39, 0x2d, 0x0a, 0x07, 0xac, 0x69, 0xf9, 0x1e },
+	{ 0x2c, 0x98, 0xfc, 0x66, 0xd5, 0x4e, 0xb9, 0xef, 0x0c, 0xc8, 0xe9, 0x05, 0x3f, 0xde, 0x9d, 0xb1 },
+	{ 0x8b, 0x1b, 0x81, 0xb4, 0xf5, 0x76, 0x31, 0xe0, 0x83, 0xe3, 0x0b, 0x0b, 0xe8, 0x2e, 0x6d, 0xc9 },
+	{ 0x71, 0x33, 0xe5, 0x01, 0xb8, 0x96, 0x42, 0xd7, 0xd9, 0x27, 0x3d, 0x3b, 0xc4, 0xaf, 0x95, 0x99 },
+	{ 0x38, 0x10, 0x07, 0x36, 0x40, 0x77, 0x72, 0x78, 0xf8, 0x92, 0xbd, 0x6d, 0x80, 0xe8, 0xd2, 0x2d },
+	{ 0x77, 0xae, 0xde, 0x48, 0x6b, 0x57, 0x0c, 0x42, 0x4f, 0x64, 0xbe, 0x35, 0xd3, 0xe8, 0x8d, 0x29 },
+	{ 0x12, 0x32, 0x78, 0xf5, 0x9b, 0x15, 0xf0, 0x99, 0x62, 0x5e, 0xec, 0xa8, 0x3e, 0xf7, 0x0a, 0xde },
+	{ 0xb9, 0x6c, 0x90, 0x50, 0xb5, 0x28, 0xfa, 0x20, 0x61, 0x7a, 0x85, 0xca, 0xd9, 0xc3, 0x9a, 0xe0 },
+	{ 0x3a, 0x32, 0x86, 0xdf, 0xa6, 0x79, 0xe2, 0xde, 0xca, 0xf2, 0x9e, 0x47, 0xc0, 0x75, 0x29, 0xf1 },
+	{ 0x2d, 0x3e, 0x38, 0x06, 0x88, 0x09, 0x6b, 0x5a, 0xf5, 0x94, 0xb7, 0x5f, 0x2e, 0xb6, 0x3d, 0xd9 },
+	{ 0x60, 0x92, 0x2c, 0x61, 0x4f, 0x82, 0x8a, 0x70, 0x60, 0x79, 0x41, 0x7f, 0x25, 0xff, 0x35, 0x9d },
+	{ 0x26, 0x08, 0x87, 0xd5, 0xa2, 0xd4, 0x75, 0x4d, 0x96, 0x6e, 0x8b, 0x9e, 0xe0, 0x13, 0xb1, 0xdb },
+	{ 0xab, 0xd2, 0x06, 0xd8, 0xe3, 0xfd, 0xd0, 0x31, 0xa3, 0x4f, 0xd0, 0x88, 0x58, 0x2c, 0x0f, 0xa1 },
+	{ 0x31, 0x58, 0x3e, 0xc4, 0x56, 0x9b, 0x57, 0xb8, 0x99, 0x1a, 0xc0, 0x39, 0x0f, 0xae, 0x01, 0xd4 },
+	{ 0xfd, 0x8b, 0x35, 0xe1, 0xe3, 0x28, 0xc5, 0x0c, 0x45, 0x47, 0xc5, 0x7f, 0x0e, 0xe0, 0xdb, 0x2c },
+	{ 0xeb, 0xd7, 0xa5, 0xaa, 0x43, 0x6c, 0xaf, 0xbf, 0xe3, 0x96, 0x07, 0x64, 0xac, 0x50, 0x8c, 0xf2 },
+	{ 0x3f, 0x07, 0x44, 0x87, 0xa7, 0x7f, 0xfa, 0xde, 0x57, 0x62, 0x52, 0xe8, 0xdf, 0xd6, 0x81, 0x59 },
+	{ 0xcb, 0x5f, 0x94, 0x66, 0xd3, 0x11, 0x7d, 0x14, 0xc3, 0x81, 0xda, 0x2c, 0x2a, 0x07, 0xc8, 0xec },
+	{ 0x80, 0x1f, 0xba, 0xef, 0x3e, 0x96, 0x36, 0x53, 0x80, 0xab, 0x4b, 0x23, 0xf7, 0xd9, 0xee, 0xe8 },
+	{ 0x11, 0xa1, 0xb8, 0xa0, 0x68, 0x14, 0xb8, 0x66, 0x79, 0xae, 0xfb, 0xbb, 0x9e, 0xb0, 0x5f, 0xfc },
+	{ 0x50, 0x00, 0x1c, 0xd4, 0x15, 0xc8, 0xe4, 0x89, 0xd0, 0x28, 0x65, 0x3d, 0x03, 0xfd, 0x3c, 0x26 },
+	{ 0x44, 0x34, 0x21, 0xdb, 0xad, 0xb9, 0x44, 0x23, 0xe4, 0xe9, 0x1c, 0x22, 0x84, 0xad, 0x35, 0x92 },
+	{ 0x2d, 0xff, 0xc3, 0x26, 0x0a, 0xdd, 0xfd, 0xb3, 0xf5, 0x3d, 0x20, 0x19, 0x40, 0x02, 0x60, 0x07 },
+	{ 0x24, 0x4f, 0x74, 0xa0, 0xb8, 0x71, 0x66, 0xfc, 0xc4, 0x9f, 0xfb, 0xe4, 0x2d, 0x5d, 0x21, 0x76 },
+	{ 0xdb, 0x1b, 0x9d, 0x88, 0x0b, 0x3f, 0x16, 0x6a, 0x53, 0x0c, 0x71, 0x48, 0xeb, 0x2b, 0xaa, 0xef },
+	{ 0xeb, 0xec, 0x21, 0xf5, 0xc2, 0x25, 0x29, 0xf7, 0xe3, 0xb3, 0xe4, 0xd0, 0xfb, 0xe1, 0x80, 0x38 },
+	{ 0xc8, 0x82, 0x5d, 0xd3, 0x3a, 0x9b, 0xe1, 0x0b, 0x08, 0x38, 0x4e, 0x8c, 0xab, 0x10, 0xdd, 0xbb },
+	{ 0x8d, 0x7c, 0x74, 0x3d, 0xda, 0xa5, 0x0e, 0xed, 0x55, 0x9a, 0x84, 0x2b, 0x16, 0x70, 0xa1, 0x5e },
+	{ 0xc7, 0x06, 0x1a, 0xc9, 0x86, 0x53, 0x23, 0x10, 0x1f, 0xa5, 0x3a, 0x0c, 0x5b, 0x5b, 0x26, 0x20 },
+	{ 0xab, 0xa8, 0x0e, 0x43, 0xe5, 0x8a, 0xdd, 0xc2, 0xa3, 0x15, 0x16, 0xaf, 0xb9, 0x09, 0x26, 0x15 },
+	{ 0x73, 0x7f, 0x5c, 0x40, 0x1d, 0x0c, 0xa6, 0xac, 0xab, 0xc1, 0xd8, 0xee, 0xa2, 0x5f, 0xd5, 0xe8 },
+	{ 0xa5, 0xab, 0xfd, 0xba, 0x2d, 0x23, 0xee, 0xa4, 0x2d, 0x87, 0xc3, 0x41, 0x87, 0x38, 0xe9, 0x28 },
+	{ 0x83, 0xfc, 0xf0, 0x82, 0xd7, 0x0c, 0xd2, 0x5b, 0x3b, 0xf5, 0xd7, 0xc3, 0x75, 0xd0, 0xd9, 0x19 },
+	{ 0x11, 0xcb, 0xb0, 0x35, 0x67, 0x87, 0xab, 0xd5, 0x79, 0xe8, 0xb5, 0x95, 0x3d, 0xd3, 0x48, 0x88 },
+	{ 0xde, 0xb9, 0x5f, 0x3c, 0x26, 0x89, 0x44, 0xcc, 0x0e, 0xff, 0x65, 0xa2, 0x7b, 0x6e, 0xb7, 0x4e },
+	{ 0x3c, 0x15, 0x91, 0xa9, 0x8f, 0x4f, 0xe5, 0x9e, 0x9c, 0xfb, 0xe8, 0xda, 0x11, 0x4f, 0xa2, 0xe2 },
+	{ 0x97, 0x26, 0xf0, 0x8c, 0xdb, 0xb1, 0x3e, 0xed, 0x6f, 0x79, 0xeb, 0x6c, 0x55, 0x32, 0x52, 0x2f },
+	{ 0xd0, 0x5e, 0x4a, 0xa3, 0xd2, 0x8a, 0x88, 0x83, 0x50, 0x2b, 0x48, 0xa7, 0xe8, 0x8a, 0x09, 0xe1 },
+	{ 0xb9, 0x2d, 0x1c, 0x71, 0x37, 0xfc, 0x8c, 0x7a, 0x61, 0x23, 0xee, 0x83, 0xeb, 0x0f, 0xbd, 0x0e },
+	{ 0x94, 0x5e, 0x35, 0x44, 0xc2, 0xf4, 0x1c, 0x1c, 0xb4, 0x4c, 0x3c, 0x39, 0x26, 0xcd, 0x5b, 0x44 },
+	{ 0x25, 0x62, 0x4b, 0x36, 0xf0, 0x19, 0xc4, 0xe2, 0xad, 0xa1, 0xbd, 0x44, 0xf1, 0x3b, 0x11, 0xb4 },
+	{ 0xe1, 0xab, 0x12, 0x1a, 0x3e, 0xb9, 0x59, 0x0c, 0xc9, 0x65, 0xcf, 0xaf, 0x49, 0xf6, 0x96, 0xc5 },
+	{ 0xf5, 0x2d, 0x31, 0xd0, 0x47, 0x92, 0xf8, 0xe1, 0xfd, 0x01, 0xfa, 0xf1, 0xad, 0xcd, 0x6a, 0xab },
+	{ 0x4c, 0x25, 0x8a, 0xf5, 0xc4, 0x62, 0x65, 0xd2, 0x2c, 0xfa, 0xf3, 0xa9, 0x10, 0xb9, 0x56, 0xfd },
+	{ 0xe3, 0x25, 0xb1, 0x6f, 0xaa, 0xef, 0xfb, 0xb6, 0x9b, 0xdd, 0xc7, 0x22, 0x0e, 0xf9, 0x48, 0x59 },
+	{ 0x79, 0xbb, 0xe1, 0xa7, 0x52, 0xa0, 0x02, 0x71, 0x21, 0xa7, 0xc2, 0xa2, 0xc3, 0xe4, 0xef, 0xa6 },
+	{ 0x4d, 0x77, 0xd5, 0x6a, 0x7a, 0x37, 0x30, 0x5f, 0x15, 0x53, 0x4d, 0x50, 0xc2, 0x4b, 0x24, 0x0d },
+	{ 0xed, 0xcf, 0x2c, 0xbf, 0xab, 0xfb, 0x2b, 0xb7, 0xb5, 0xbc, 0x2e, 0x64, 0x4d, 0xbb, 0xf9, 0x29 },
+	{ 0xd4, 0xfa, 0x67, 0xa2, 0xa5, 0xc3, 0x9a, 0x94, 0xf4, 0x02, 0x22, 0xf4, 0xec, 0x1a, 0x12, 0x38 },
+	{ 0x1a, 0x3c, 0x8c, 0xdc, 0x3a, 0xc6, 0xd5, 0xe6, 0xaa, 0x2f, 0x43, 0x83, 0x61, 0xc4, 0xa9, 0x47 },
+	{ 0x2a, 0x4c, 0x85, 0x28, 0x70, 0xd9, 0x55, 0x1a, 0x3a, 0x2e, 0x4e, 0x52, 0x60, 0x2e, 0x5e, 0x62 },
+	{ 0x29, 0xa6, 0x49, 0x89, 0xbd, 0x1e, 0xa4, 0xaf, 0x51, 0x61, 0x80, 0xf8, 0x70, 0x56, 0xbe, 0x3a },
+	{ 0xf2, 0xf8, 0xda, 0x90, 0xa9, 0xe7, 0x2a, 0x95, 0x42, 0xa0, 0x56, 0xb8, 0xaa, 0x61, 0x24, 0xaa },
+	{ 0xc8, 0x97, 0xd9, 0x1d, 0xba, 0x54, 0x5b, 0x43, 0x08, 0x55, 0x2b, 0xf9, 0xfa, 0xa1, 0xd1, 0x01 },
+	{ 0xb9, 0x57, 0x14, 0x06, 0x36, 0x6f, 0x80, 0xe9, 0x61, 0x5d, 0xa8, 0x5d, 0x8a, 0x32, 0xa6, 0x9a },
+	{ 0x5a, 0xbf, 0x13, 0x6e, 0x96, 0x8d, 0x8e, 0xc1, 0xea, 0x24, 0xa9, 0xeb, 0x91, 0x50, 0xe2, 0x3c },
+	{ 0x36, 0x03, 0x04, 0xd7, 0x58, 0x2e, 0x7c, 0x49, 0x26, 0x50, 0xb9, 0x00, 0x90, 0xec, 0x70, 0xb0 },
+	{ 0xaf, 0x55, 0x79, 0x0a, 0x2f, 0x2f, 0x1e, 0xa5, 0x47, 0x66, 0x2a, 0x83, 0xc6, 0xfa, 0x99, 0xf9 },
+	{ 0x9c, 0x53, 0xcd, 0xe0, 0xe1, 0xeb, 0x88, 0x31, 0xfc, 0x00, 0xb6, 0xa6, 0xf9, 0x08, 0x06, 0x68 },
+	{ 0xc7, 0x30, 0x12, 0x5e, 0x85, 0xc6, 0x16, 0x7f, 0x1f, 0xdf, 0xf4, 0xe5, 0xf9, 0x7d, 0x0f, 0xac },
+	{ 0x62, 0xf3, 0x1f, 0xea, 0x33, 0xb1, 0x67, 0x7d, 0x32, 0x30, 0xba, 0x9f, 0x53, 0x40, 0x6a, 0x32 },
+	{ 0xc4, 0x92, 0x4f, 0xaa, 0x6a, 0x7c, 0xe8, 0x1c, 0x64, 0xec, 0xff, 0x8b, 0x69, 0x3b, 0x02, 0x4d },
+	{ 0x31, 0x04, 0x4e, 0x9a, 0x59, 0xb5, 0x70, 0xda, 0x99, 0xa6, 0x4b, 0x86, 0xd1, 0x68, 0x2f, 0xbc },
+	{ 0x28, 0x7e, 0xf6, 0xa8, 0x06, 0xbd, 0xcc, 0x91, 0x68, 0x42, 0xe1, 0x2b, 0x5e, 0xe6, 0xd9, 0xb6 },
+	{ 0xd2, 0x02, 0xe1, 0x8d, 0x3d, 0x34, 0x1e, 0x9d, 0x22, 0xdd, 0xfa, 0xf3, 0x4b, 0xb0, 0xa4, 0x00 },
+	{ 0x15, 0x91, 0xc6, 0xc9, 0x38, 0x33, 0xb1, 0x55, 0x1d, 0xfa, 0x49, 0xbc, 0xe0, 0x85, 0x3a, 0x6b },
+	{ 0xc3, 0x40, 0x04, 0x35, 0xb5, 0xa7, 0x1d, 0x90, 0x7b, 0x93, 0xa6, 0xe5, 0xb7, 0xa8, 0x34, 0x3d },
+	{ 0x43, 0x21, 0x4a, 0x45, 0x76, 0x11, 0xe7, 0x3c, 0xfb, 0xe7, 0x5a, 0xc2, 0xc0, 0xce, 0x45, 0x54 },
+	{ 0x53, 0x74, 0xe6, 0xf2, 0x31, 0x9f, 0x1f, 0x7d, 0x8b, 0xe1, 0x9f, 0xbd, 0xf4, 0x1c, 0x61, 0xf9 },
+	{ 0x88, 0x7d, 0xbe, 0x00, 0xdb, 0x2c, 0x03, 0x7e, 0xc8, 0xf0, 0x16, 0xb1, 0x57, 0xec, 0x5f, 0x6a },
+	{ 0x6d, 0x04, 0x63, 0xf9, 0x69, 0x4b, 0xdc, 0x41, 0x35, 0x85, 0x57, 0xf4, 0x93, 0x26, 0xdd, 0x58 },
+	{ 0x17, 0x07, 0x36, 0x9d, 0x9c, 0x1b, 0x08, 0x9a, 0xef, 0xcd, 0x9f, 0x49, 0x5e, 0x58, 0x63, 0x46 },
+	{ 0x7d, 0xc0, 0x6b, 0x1b, 0xa2, 0x78, 0x75, 0x97, 0xc5, 0x0f, 0xee, 0x0f, 0x55, 0x4b, 0xbf, 0x5b },
+	{ 0x59, 0xc5, 0xe7, 0xa4, 0xe6, 0xec, 0xf5, 0x78, 0x01, 0xe4, 0x66, 0xde, 0x64, 0x33, 0x70, 0xfd },
+	{ 0xc2, 0x46, 0xd8, 0x6b, 0x05, 0x07, 0x85, 0x47, 0x92, 0x52, 0x64, 0xd8, 0x8a, 0x8b, 0xc2, 0xfd },
+	{ 0xf0, 0x58, 0x73, 0x28, 0x47, 0x8c, 0xe0, 0xe1, 0x70, 0x92, 0x46, 0x51, 0x8e, 0x6c, 0x12, 0x43 },
+	{ 0xd8, 0x92, 0x56, 0x1f, 0x70, 0xae, 0x61, 0x3f, 0x98, 0x36, 0x59, 0x5b, 0xaa, 0x7a, 0x91, 0xd6 },
+	{ 0xec, 0xa7, 0xd9, 0xde, 0xf4, 0x99, 0x54, 0x99, 0xcc, 0x9d, 0x8f, 0x97, 0x3a, 0x4b, 0x15, 0xa6 },
+	{ 0x2d, 0xd5, 0xcb, 0x91, 0x0b, 0x6a, 0x0a, 0x45, 0xf5, 0x03, 0x66, 0x3f, 0xa1, 0xdf, 0x76, 0x7b },
+	{ 0xf5, 0x81, 0x21, 0xfa, 0x44, 0x78, 0xdf, 0xbf, 0xfd, 0x75, 0x6e, 0xa5, 0xeb, 0x12, 0x3d, 0xc3 },
+	{ 0xc9, 0x3d, 0x15, 0xbd, 0x6c, 0x0f, 0x0d, 0xae, 0xf1, 0x21, 0xf9, 0x52, 0xea, 0x79, 0x71, 0x29 },
+	{ 0x72, 0x9a, 0xac, 0xc1, 0xec, 0x24, 0x87, 0x9b, 0xc2, 0x9d, 0x73, 0x4e, 0xc5, 0xd3, 0x57, 0xef },
+	{ 0xa5, 0xd5, 0xf5, 0x4f, 0x2c, 0x96, 0xe1, 0x13, 0x2d, 0xc1, 0x7d, 0x1b, 0x26, 0x5b, 0xd2, 0xb4 },
+	{ 0x26, 0x47, 0xfb, 0xb4, 0x20, 0x01, 0xe3, 0xf3, 0x96, 0xc5, 0x22, 0xe5, 0xce, 0xc7, 0x8e, 0xad },
+	{ 0x49, 0x72, 0x4b, 0xf7, 0x2a, 0x5f, 0xbd, 0x38, 0x71, 0xea, 0x21, 0xe3, 0x30, 0xe5, 0x54, 0x58 },
+	{ 0x67, 0xc8, 0xdd, 0x91, 0x34, 0xb7, 0x7f, 0x7d, 0xbf, 0x9f, 0x6d, 0x40, 0x73, 0xa1, 0xc2, 0x9a },
+	{ 0x6d, 0x2e, 0x5b, 0x8e, 0x68, 0xbe, 0xcf, 0xb0, 0x35, 0xbf, 0x11, 0xce, 0x32, 0x49, 0xc6, 0xe4 },
+	{ 0xa4, 0xf0, 0x45, 0xd1, 0xfb, 0xae, 0xc2, 0x02, 0x44, 0x9d, 0x18, 0x7b, 0x48, 0xcf, 0x54, 0xbb },
+	{ 0xf0, 0x97, 0xe7, 0x07, 0xc5, 0xb8, 0x4d, 0x88, 0x70, 0xe9, 0xdd, 0x97, 0x7c, 0x20, 0xf0, 0x14 },
+	{ 0x97, 0xbd, 0x83, 0x18, 0x5f, 0x12, 0xde, 0xd7, 0x6f, 0xe8, 0x99, 0x4c, 0xc8, 0x5b, 0x8b, 0xd1 },
+	{ 0xbb, 0xcd, 0x83, 0xd9, 0x99, 0x57, 0xd7, 0x2d, 0x33, 0x31, 0xfe, 0xea, 0x07, 0x05, 0xcf, 0x75 },
+	{ 0x9e, 0x75, 0x4c, 0x8a, 0x48, 0xee, 0xf8, 0x97, 0xce, 0x60, 0x97, 0x80, 0x39, 0x96, 0x5c, 0x2b },
+	{ 0x4f, 0x6f, 0x5c, 0x7f, 0xe2, 0xc6, 0xac, 0x56, 0xe7, 0x78, 0x74, 0x50, 0x63, 0xb6, 0x91, 0x44 },
+	{ 0xc3, 0x01, 0x90, 0x55, 0x37, 0x7b, 0xb0, 0xe9, 0x7b, 0x3c, 0x0f, 0x9f, 0xc9, 0xf4, 0x56, 0x6b },
+	{ 0x2b, 0xc8, 0xc8, 0x32, 0x24, 0x21, 0x14, 0x16, 0x23, 0xc1, 0x61, 0xd2, 0xb0, 0xe3, 0x14, 0xfe },
+	{ 0x77, 0x1b, 0x7a, 0x3f, 0xf0, 0x44, 0xb8, 0xbd, 0x4f, 0x99, 0xb2, 0x3b, 0xa7, 0xef, 0xdd, 0x3f },
+	{ 0xee, 0x60, 0xec, 0x13, 0xdf, 0xfc, 0x63, 0xea, 0x9e, 0x6c, 0x1f, 0x51, 0xed, 0x01, 0xa5, 0x0b },
+	{ 0xd6, 0x9a, 0xcf, 0x0a, 0x08, 0x1f, 0xe5, 0x47, 0xc6, 0x10, 0x32, 0x5b, 0x09, 0x10, 0x24, 0x9f },
+	{ 0xdf, 0x5f, 0x9b, 0xdb, 0xd8, 0x43, 0xf6, 0x36, 0xf7, 0xcb, 0x33, 0xfc, 0x6a, 0x46, 0x57, 0x76 },
+	{ 0x42, 0x66, 0x92, 0x5b, 0x44, 0x9d, 0xbb, 0x9a, 0x12, 0xfe, 0xaf, 0xfb, 0x81, 0x65, 0xb1, 0xe6 },
+	{ 0x4f, 0x45, 0x64, 0xea, 0xe3, 0x53, 0xb9, 0xe7, 0xe7, 0x3e, 0xba, 0x76, 0xc4, 0x93, 0xa8, 0xb8 },
+	{ 0x83, 0x3b, 0x65, 0x62, 0x55, 0x39, 0x3f, 0x02, 0x3b, 0x4c, 0x6f, 0x0a, 0x64, 0x84, 0xb7, 0xeb },
+	{ 0x9d, 0x23, 0x01, 0x15, 0x93, 0x19, 0x2e, 0x0b, 0xe5, 0x07, 0x3e, 0xda, 0x87, 0x03, 0x8f, 0x1b },
+	{ 0x7f, 0xcd, 0x6e, 0x7a, 0x89, 0xc1, 0x6b, 0xc6, 0x97, 0x52, 0xf2, 0x7c, 0x45, 0x47, 0x21, 0xd9 },
+	{ 0xb1, 0x23, 0x08, 0x8a, 0x98, 0x4b, 0xa7, 0x2d, 0x19, 0x52, 0x97, 0xa9, 0xc8, 0x42, 0x1e, 0xa5 },
+	{ 0xe5, 0xb0, 0x9c, 0x8d, 0x8d, 0x91, 0xcc, 0x32, 0x6d, 0xce, 0xfa, 0x1c, 0xdb, 0x5c, 0x66, 0x7a },
+	{ 0x7a, 0xf8, 0xb0, 0xd2, 0x88, 0xbb, 0x53, 0xc6, 0x0a, 0xe3, 0x3e, 0xdc, 0x25, 0xe6, 0xc8, 0x70 },
+	{ 0x37, 0x7f, 0x47, 0xe1, 0x0c, 0x76, 0x3a, 0x45, 0x0f, 0xe3, 0xcc, 0x80, 0xe0, 0xa1, 0x27, 0x4c },
+	{ 0xb0, 0xd1, 0xbc, 0x14, 0xe3, 0x76, 0xdc, 0xa0, 0x30, 0xf9, 0x3d, 0x03, 0x17, 0xb0, 0x50, 0x95 },
+	{ 0x55, 0xc0, 0x5d, 0x31, 0x97, 0x14, 0x83, 0x52, 0x5d, 0x7b, 0x3b, 0x71, 0xd3, 0xcc, 0xa0, 0x48 },
+	{ 0x41, 0x14, 0x47, 0xe6, 0x8e, 0xc8, 0xf0, 0x0d, 0x29, 0xa5, 0x56, 0x55, 0xd0, 0xd2, 0xe3, 0xd6 },
+	{ 0xd9, 0xe4, 0xa1, 0x94, 0x25, 0x83, 0x2c, 0xcc, 0x81, 0x8f, 0xb2, 0x01, 0x5c, 0x0d, 0x5f, 0xe6 },
+	{ 0x5b, 0xe7, 0x66, 0x4e, 0x4d, 0xef, 0x65, 0xdf, 0xd3, 0x43, 0x48, 0xb8, 0xa4, 0xc0, 0xc6, 0xc0 },
+	{ 0xa1, 0x52, 0x83, 0x1d, 0xe1, 0x64, 0x94, 0xa0, 0x89, 0xaa, 0x23, 0x21, 0xb8, 0x8c, 0x47, 0x5c },
+	{ 0x9b, 0x40, 0xf6, 0x4a, 0xaa, 0x43, 0x2b, 0x4b, 0x13, 0xff, 0xf3, 0x46, 0x36, 0x2a, 0x16, 0x2a },
+	{ 0x96, 0x95, 0x30, 0x38, 0xa8, 0xb0, 0x06, 0xba, 0x86, 0xc9, 0xfa, 0x7f, 0xb5, 0xeb, 0xa6, 0x4d },
+	{ 0x02, 0x37, 0xfb, 0xf3, 0xe5, 0xbb, 0xe9, 0x9d, 0xd2, 0x7c, 0xbe, 0x46, 0x8f, 0x1e, 0x4b, 0x09 },
+	{ 0x99, 0xca, 0x86, 0x77, 0x46, 0x5b, 0xd4, 0x06, 0x41, 0x2b, 0x9e, 0xb9, 0xb8, 0x57, 0xed, 0x4e },
+	{ 0x23, 0xa9, 0x38, 0x01, 0x06, 0xb7, 0xb4, 0x91, 0xdb, 0xd2, 0x2d, 0x8b, 0x3e, 0x85, 0x81, 0x4e },
+	{ 0xa8, 0x1f, 0xc8, 0xd9, 0x49, 0xfa, 0x28, 0x98, 0xe8, 0x3f, 0xfe, 0xc1, 0x78, 0x58, 0x0d, 0xfc },
+	{ 0x43, 0x0c, 0xce, 0xfa, 0xf6, 0x57, 0x6d, 0x05, 0xfb, 0xca, 0x7d, 0x55, 0x71, 0x3d, 0x51, 0x0e },
+	{ 0xe1, 0x2d, 0x2a, 0x5b, 0x42, 0x60, 0x7f, 0xbf, 0xc9, 0xb7, 0xa0, 0x22, 0x6d, 0x8e, 0xdb, 0x21 },
+	{ 0x80, 0x73, 0xaa, 0x19, 0x3c, 0x7c, 0x1d, 0x31, 0x80, 0x1f, 0xc0, 0xd6, 0x34, 0x1f, 0xc1, 0x00 },
+	{ 0xae, 0x31, 0x55, 0xac, 0x80, 0x1b, 0x92, 0xed, 0x5e, 0xeb, 0x2d, 0x9c, 0xfa, 0xba, 0x3e, 0x2e },
+	{ 0x46, 0x80, 0x98, 0x19, 0x13, 0x2f, 0xa8, 0xf8, 0xb6, 0x83, 0xb8, 0xd5, 0x62, 0x5d, 0x75, 0xe1 },
+	{ 0x13, 0xae, 0xbb, 0xff, 0x4f, 0x5d, 0xae, 0x95, 0x4b, 0xf1, 0xff, 0x28, 0x8f, 0xac, 0xc1, 0x79 },
+	{ 0x9b, 0x55, 0x72, 0x95, 0x29, 0xfd, 0xa4, 0x82, 0x13, 0x1c, 0xd1, 0xb3, 0x85, 0xbb, 0x0a, 0x70 },
+	{ 0xb5, 0x13, 0x16, 0xb3, 0x68, 0x6a, 0xa0, 0x1c, 0xbd, 0x9d, 0xe5, 0xa9, 0x0a, 0x18, 0xf9, 0x13 },
+	{ 0xf2, 0x8f, 0x6e, 0x1c, 0x2d, 0x48, 0xca, 0x7f, 0x42, 0x0f, 0x05, 0x98, 0x1d, 0x8b, 0x5d, 0x4c },
+	{ 0x89, 0x8c, 0x66, 0x14, 0x0a, 0x87, 0x15, 0xfe, 0xb1, 0x4e, 0x36, 0x2b, 0xd4, 0x9a, 0xc6, 0xef },
+	{ 0x55, 0x96, 0x65, 0x9c, 0x98, 0xa1, 0x8f, 0xe3, 0x5d, 0x41, 0x81, 0x97, 0x34, 0xaa, 0xb7, 0xbc },
+	{ 0x4f, 0x99, 0x54, 0x14, 0xe1, 0x39, 0xa0, 0xc5, 0xe7, 0xb2, 0x2e, 0x2a, 0x02, 0xd9, 0x7a, 0xd0 },
+	{ 0x6f, 0xd2, 0xf1, 0x78, 0xd3, 0x67, 0x65, 0xca, 0x07, 0x71, 0xc4, 0x1a, 0x96, 0x6e, 0x61, 0x04 },
+	{ 0x74, 0x10, 0x1c, 0x95, 0x50, 0x0d, 0xde, 0xdf, 0x94, 0x71, 0xc9, 0xdb, 0x42, 0xa6, 0x80, 0xca },
+	{ 0x7f, 0x8e, 0xfa, 0x9a, 0x0b, 0x95, 0xfe, 0x1f, 0x97, 0xfb, 0x5a, 0x36, 0x57, 0x93, 0x43, 0x07 },
+	{ 0x68, 0x2f, 0xa5, 0x51, 0x69, 0x45, 0xc4, 0x41, 0xa8, 0x15, 0xa4, 0x53, 0x74, 0xc5, 0x84, 0xf0 },
+	{ 0x17, 0x1c, 0xb2, 0xe7, 0x1b, 0xd5, 0x81, 0xd1, 0xef, 0xea, 0x7c, 0xb6, 0xad, 0xe9, 0x57, 0x8c },
+	{ 0x3a, 0xde, 0x95, 0xb5, 0xa9, 0x93, 0xfb, 0x00, 0xca, 0x7e, 0x2a, 0x94, 0x82, 0x30, 0x57, 0xd9 },
+	{ 0x93, 0xf7, 0x6d, 0x84, 0x8d, 0x66, 0xd8, 0x57, 0xcb, 0xd6, 0x05, 0x26, 0x25, 0xa9, 0x99, 0xee },
+	{ 0x0d, 0xb1, 0xaa, 0x77, 0x98, 0xf5, 0xbe, 0x77, 0xd5, 0x62, 0xad, 0xbb, 0x5c, 0xdb, 0x84, 0x8d },
+	{ 0x96, 0x80, 0xb4, 0xed, 0x28, 0xf7, 0x8c, 0x82, 0x86, 0xac, 0x1d, 0x13, 0x66, 0x5a, 0xb2, 0x07 },
+	{ 0x1e, 0x6b, 0x0e, 0xe5, 0x88, 0x11, 0x3c, 0x7c, 0x4e, 0xd2, 0x28, 0xca, 0x91, 0x4d, 0x62, 0x88 },
+	{ 0xd2, 0x6b, 0x4d, 0x02, 0xba, 0xd3, 0x7e, 0xb2, 0x22, 0x6e, 0x4c, 0x14, 0xd9, 0x86, 0x6b, 0x5e },
+	{ 0xcd, 0x96, 0x8f, 0x5a, 0xb9, 0xcd, 0x66, 0xb2, 0x95, 0xfe, 0x98, 0x73, 0xb9, 0x25, 0x13, 0xf6 },
+	{ 0xd5, 0x09, 0x10, 0xb6, 0xd4, 0x1d, 0xad, 0x14, 0xdd, 0x60, 0x41, 0x6e, 0x69, 0xc9, 0x78, 0xbd },
+	{ 0x4b, 0x94, 0xca, 0xa0, 0x91, 0x61, 0x2d, 0x9f, 0x43, 0x4a, 0x03, 0xbd, 0x70, 0x72, 0xab, 0x1b },
+	{ 0xa9, 0xda, 0x7f, 0xc3, 0x7b, 0x6e, 0x54, 0x3a, 0xd1, 0x29, 0xa9, 0x88, 0xb7, 0xc1, 0xa1, 0x69 },
+	{ 0x78, 0xc1, 0xb5, 0xde, 0xa2, 0xff, 0x69, 0x28, 0x38, 0x66, 0x80, 0x95, 0x96, 0xc7, 0x7d, 0x67 },
+	{ 0x92, 0x51, 0x32, 0xe5, 0xda, 0xab, 0x26, 0xed, 0xe2, 0x09, 0x38, 0xcc, 0x35, 0xd1, 0xf9, 0xc6 },
+	{ 0xa5, 0x57, 0x0d, 0x91, 0x30, 0x3d, 0x07, 0xc7, 0x2d, 0x13, 0x4f, 0x8e, 0x49, 0xf3, 0x16, 0x11 },
+	{ 0x0e, 0xd9, 0xfd, 0x57, 0x4f, 0x57, 0x96, 0x95, 0xbe, 0x81, 0x4c, 0x88, 0x6f, 0x4b, 0x69, 0x11 },
+	{ 0xaf, 0xec, 0x0c, 0x96, 0xb2, 0x8f, 0xbd, 0x8f, 0x47, 0xd5, 0xd8, 0x62, 0x39, 0x24, 0xd3, 0x9b },
+	{ 0xff, 0xad, 0xb4, 0x8a, 0x4a, 0x2b, 0x35, 0x73, 0x17, 0xa7, 0xa6, 0x59, 0x4e, 0x6d, 0x32, 0xf0 },
+	{ 0x61, 0x38, 0x68, 0x00, 0x02, 0x3d, 0x3c, 0xdb, 0x49, 0x46, 0x0f, 0xd9, 0x14, 0xd7, 0xd5, 0xc4 },
+	{ 0x98, 0xb7, 0xaf, 0xe1, 0x0e, 0xb3, 0x76, 0x20, 0x58, 0x29, 0xdc, 0x59, 0xf5, 0x78, 0xfd, 0x10 },
+	{ 0xc0, 0x63, 0xcd, 0xa1, 0x1c, 0x31, 0x82, 0x87, 0xc0, 0x49, 0x1a, 0x45, 0x39, 0xb2, 0x49, 0x0c },
+	{ 0xf6, 0xd3, 0x6c, 0x6f, 0xfa, 0x4c, 0xaa, 0x4c, 0xe6, 0xce, 0xc7, 0x4b, 0x9d, 0xa5, 0x0a, 0xd3 },
+	{ 0xf6, 0xa9, 0x74, 0xda, 0xfb, 0xd9, 0xb6, 0xdd, 0xe6, 0x94, 0x0d, 0x72, 0xfe, 0x82, 0x21, 0x47 },
+	{ 0xe3, 0xa3, 0x99, 0x2e, 0xa6, 0x48, 0xd6, 0x03, 0x9b, 0x8b, 0xf6, 0xaf, 0xea, 0x60, 0x04, 0xfd },
+	{ 0xa0, 0x00, 0x38, 0xa8, 0x2b, 0x90, 0xc9, 0x13, 0xa0, 0x51, 0xca, 0x7a, 0x06, 0xfa, 0x79, 0x4c },
+	{ 0x76, 0xde, 0xaa, 0x14, 0xba, 0x29, 0x67, 0x68, 0x66, 0x5d, 0x36, 0x02, 0x45, 0xee, 0x04, 0x76 },
+	{ 0xd3, 0x69, 0xa8, 0x4d, 0x72, 0xc2, 0x62, 0x61, 0x0b, 0x53, 0x31, 0x07, 0x4d, 0xd4, 0x66, 0x56 },
+	{ 0x7e, 0x7b, 0x23, 0x05, 0xd4, 0xec, 0xa0, 0x39, 0xae, 0xf9, 0x98, 0xd6, 0x93, 0xb4, 0x53, 0xc9 },
+	{ 0xc6, 0x8a, 0xd6, 0xbe, 0xd2, 0x0b, 0x65, 0x14, 0x36, 0x12, 0x27, 0x8c, 0x0a, 0xa6, 0x6f, 0x84 },
+	{ 0xf9, 0x9b, 0x27, 0xb8, 0x13, 0x0a, 0xcc, 0x1d, 0xa1, 0xfb, 0x76, 0x7f, 0xcc, 0x0a, 0x01, 0xbe },
+	{ 0x27, 0x5a, 0xd2, 0x4a, 0x58, 0xa9, 0x40, 0xda, 0x7f, 0xc7, 0xe4, 0x44, 0x92, 0xa6, 0x7e, 0xeb },
+	{ 0x4b, 0x7f, 0x4e, 0x56, 0x12, 0xa8, 0xb3, 0x67, 0x43, 0x2d, 0x26, 0x50, 0x21, 0xe1, 0xb6, 0xd5 },
+	{ 0x12, 0x08, 0x80, 0x60, 0x9d, 0xa2, 0xfc, 0x2a, 0x62, 0x24, 0x32, 0xcf, 0x9f, 0xd4, 0x21, 0x52 },
+	{ 0x12, 0xde, 0x87, 0xcb, 0x9e, 0x2f, 0x09, 0xbc, 0x62, 0xea, 0x77, 0xf5, 0x00, 0xb2, 0x38, 0xc6 },
+	{ 0x63, 0x45, 0x6b, 0x5f, 0xe9, 0x85, 0x32, 0x0a, 0x1b, 0x89, 0x13, 0x46, 0x05, 0xd3, 0x37, 0x42 },
+	{ 0x13, 0x99, 0x3f, 0xb5, 0xd0, 0xa3, 0x34, 0x5e, 0x4b, 0xd4, 0x22, 0xbc, 0x3f, 0x1b, 0xcd, 0x33 },
+	{ 0xae, 0x5b, 0x4d, 0x41, 0x7f, 0x8e, 0x85, 0x5c, 0x5e, 0x25, 0xe8, 0x75, 0x99, 0xdd, 0x27, 0xba },
+	{ 0x2b, 0xb3, 0x4c, 0xe8, 0xa4, 0x67, 0x9a, 0xde, 0x23, 0xa4, 0x84, 0x65, 0x61, 0x52, 0x20, 0xb8 },
+	{ 0x28, 0x00, 0x0e, 0xea, 0x0a, 0x64, 0xf2, 0x44, 0x68, 0x94, 0xb2, 0x9e, 0x81, 0x7e, 0x1e, 0x13 },
+	{ 0xfd, 0x61, 0x3d, 0x4c, 0xe5, 0xb5, 0xd1, 0x9d, 0x45, 0x0d, 0x0b, 0xa6, 0x6f, 0xbd, 0xf2, 0xa0 },
+	{ 0xb1, 0xcf, 0x17, 0x60, 0x9b, 0x65, 0xc0, 0x4f, 0x19, 0xde, 0x22, 0xf6, 0x8a, 0xfd, 0x4b, 0x8d },
+	{ 0xca, 0xa4, 0xdc, 0x7c, 0xa1, 0x9d, 0x51, 0x72, 0xda, 0x97, 0x2f, 0x66, 0xeb, 0x9d, 0x33, 0x7f },
+	{ 0x62, 0x32, 0x94, 0xc9, 0xb1, 0xdd, 0xd4, 0x23, 0x32, 0x87, 0x51, 0xe6, 0x41, 0xf4, 0x47, 0x04 },
+	{ 0x12, 0x1d, 0xfc, 0xaa, 0x1c, 0x5c, 0x76, 0x62, 0x62, 0x41, 0x0f, 0x3c, 0xef, 0x65, 0x16, 0x98 },
+	{ 0xc9, 0x67, 0x0d, 0x52, 0x6b, 0x82, 0x00, 0x1d, 0xf1, 0x5b, 0xb3, 0x2c, 0x89, 0x9c, 0x5a, 0xb5 },
+	{ 0x8c, 0x15, 0xad, 0x7d, 0xa5, 0x17, 0xca, 0x28, 0x6c, 0x24, 0x4e, 0x18, 0x15, 0x4c, 0xdf, 0x08 },
+	{ 0x8a, 0x9f, 0x3d, 0xaa, 0x41, 0x2f, 0x73, 0xe4, 0x9a, 0x50, 0xf8, 0x8a, 0x97, 0x79, 0xb6, 0x2d },
+	{ 0x78, 0x2a, 0x22, 0x53, 0x1f, 0x9f, 0xca, 0x3d, 0x38, 0xf7, 0xd1, 0xb5, 0x23, 0x9e, 0x44, 0xc5 },
+	{ 0x43, 0xf7, 0x51, 0xb0, 0x77, 0x9e, 0xf3, 0xcd, 0xfb, 0xad, 0xa0, 0xe8, 0x21, 0xac, 0x5c, 0xc8 },
+	{ 0x05, 0x29, 0xae, 0xd1, 0xfd, 0xeb, 0xfe, 0xdd, 0x8d, 0xe3, 0x27, 0x54, 0x5d, 0xa6, 0x2a, 0x80 },
+	{ 0x85, 0xdf, 0xfb, 0x4c, 0xc0, 0xe2, 0xd4, 0x1b, 0x0d, 0xfe, 0x21, 0x57, 0xc7, 0xa9, 0x52, 0x0b },
+	{ 0x2a, 0x0d, 0x11, 0x49, 0xf2, 0xac, 0xe8, 0x73, 0x3a, 0xd7, 0xb6, 0x0b, 0x72, 0x7a, 0x80, 0x90 },
+	{ 0x0b, 0x7a, 0xaf, 0x83, 0xb2, 0x39, 0xd5, 0xd9, 0x03, 0xe6, 0xee, 0x74, 0xcd, 0xbc, 0x39, 0x84 },
+	{ 0x6f, 0x50, 0xda, 0x37, 0xcf, 0xc0, 0x3f, 0x17, 0x07, 0x1f, 0xf3, 0xa7, 0x72, 0xd6, 0x1c, 0xa8 },
+	{ 0x3b, 0x6f, 0x55, 0x0a, 0xdd, 0x94, 0x33, 0x34, 0xb3, 0x2e, 0x1b, 0x81, 0x22, 0x77, 0x02, 0xbb },
+	{ 0x59, 0x43, 0xd0, 0x63, 0xe2, 0x45, 0xd0, 0xc5, 0x01, 0x92, 0x95, 0x6b, 0x41, 0x9b, 0x2b, 0xa1 },
+	{ 0xe2, 0xbe, 0xe9, 0xaf, 0x75, 0x61, 0xb7, 0xf2, 0xb2, 0x67, 0x91, 0x0f, 0x0d, 0xd5, 0x86, 0x03 },
+	{ 0xca, 0xce, 0xd4, 0x11, 0xa0, 0x10, 0x45, 0xe1, 0xda, 0xd1, 0xe9, 0x3f, 0x8a, 0xc0, 0x1c, 0x0b },
+	{ 0x83, 0x11, 0x6d, 0xcd, 0x56, 0xc6, 0x4b, 0x93, 0x3b, 0x12, 0xb5, 0x30, 0xc5, 0x61, 0xce, 0x5f },
+	{ 0xa6, 0x66, 0xb5, 0xa4, 0x5f, 0x97, 0x19, 0x47, 0x16, 0x71, 0x6e, 0x08, 0xc6, 0xa1, 0x7d, 0x96 },
+	{ 0xe5, 0x5c, 0xac, 0x63, 0x90, 0xab, 0xe5, 0x54, 0x6d, 0x5a, 0x86, 0x69, 0x9d, 0x17, 0x94, 0x62 },
+	{ 0x05, 0xea, 0x39, 0xf2, 0x7f, 0xbf, 0x91, 0x37, 0x8d, 0x8c, 0x90, 0x0d, 0x6f, 0xf2, 0x4c, 0xae },
+	{ 0x58, 0xb2, 0x10, 0x0f, 0xaf, 0x44, 0x98, 0x92, 0x18, 0xe2, 0xa4, 0x7e, 0xa1, 0x54, 0x80, 0xbf },
+	{ 0xe0, 0x87, 0xee, 0xbb, 0x8f, 0xa5, 0xcd, 0x54, 0xe0, 0xea, 0xd2, 0xc8, 0x7d, 0xb6, 0x3b, 0xfa },
+	{ 0x3b, 0xae, 0xc9, 0xe9, 0x5a, 0xc1, 0xa0, 0xda, 0xb3, 0x85, 0xb2, 0xc7, 0x10, 0x2b, 0xe0, 0x8c },
+	{ 0x5d, 0x72, 0x52, 0x6c, 0x30, 0x91, 0x36, 0x5b, 0xa5, 0x34, 0x7b, 0xb2, 0x71, 0x24, 0xe4, 0xe1 },
+	{ 0x38, 0x3a, 0xff, 0xca, 0x3e, 0xea, 0x65, 0xe7, 0xf8, 0xcc, 0x77, 0x47, 0x1f, 0x0b, 0xbc, 0xb9 },
+	{ 0x24, 0xbc, 0x0f, 0x97, 0x3d, 0x5f, 0x12, 0x78, 0xc4, 0xd4, 0xef, 0xea, 0x01, 0x64, 0x71, 0x8c },
+	{ 0x6c, 0x5e, 0x27, 0x5a, 0xb7, 0x90, 0x2a, 0xd7, 0x4c, 0xb8, 0x89, 0x9a, 0xa4, 0x4e, 0x3d, 0x31 },
+	{ 0xca, 0xf8, 0xcc, 0xa6, 0x9e, 0x83, 0x38, 0x50, 0xda, 0x0b, 0xa4, 0x19, 0x29, 0xe3, 0x05, 0x97 },
+	{ 0x29, 0x7c, 0x51, 0xf4, 0xbe, 0xab, 0xb0, 0x40, 0x51, 0x27, 0xc6, 0x1e, 0xd2, 0x33, 0xd5, 0xae },
+	{ 0x7c, 0x6e, 0x20, 0xa6, 0xec, 0xa3, 0xaa, 0x0a, 0xdc, 0xb6, 0x94, 0x69, 0xa3, 0xb8, 0xf1, 0x4b },
+	{ 0xed, 0xf9, 0x24, 0x54, 0xaa, 0x6e, 0x1f, 0x26, 0xb5, 0xf6, 0xe8, 0x3d, 0xec, 0xdd, 0xe2, 0xb5 },
+	{ 0xd6, 0x85, 0x53, 0xc0, 0x88, 0x65, 0x6b, 0x10, 0xc6, 0xf3, 0x54, 0xee, 0xb9, 0x7e, 0x2f, 0x59 },
+	{ 0x62, 0xde, 0xa3, 0x9f, 0xb4, 0xf7, 0xed, 0x45, 0x32, 0x13, 0xdd, 0x32, 0x04, 0xaf, 0x75, 0xec },
+	{ 0x3e, 0x8b, 0x00, 0x7d, 0xf3, 0x37, 0x3c, 0xe3, 0x6e, 0xcf, 0x3e, 0x68, 0x8f, 0x21, 0xcb, 0xbd },
+	{ 0x1b, 0x60, 0xb0, 0x3a, 0xe9, 0xd9, 0x61, 0x9e, 0x93, 0xaa, 0x3f, 0x6a, 0x2d, 0x04, 0x05, 0x13 },
+	{ 0xbc, 0x73, 0xbf, 0x78, 0x4c, 0x12, 0x89, 0x98, 0x1c, 0xfe, 0xcb, 0x44, 0xf7, 0xdc, 0x6e, 0x9d },
+	{ 0x7a, 0xce, 0xb8, 0x3d, 0x8a, 0x48, 0x60, 0x57, 0x0a, 0xa9, 0x84, 0x02, 0x87, 0xc3, 0xdf, 0xe4 },
+	{ 0x0a, 0xaa, 0x7b, 0x4f, 0x01, 0x0c, 0x30, 0x00, 0x1a, 0xdf, 0x66, 0x41, 0x3f, 0xc2, 0xb0, 0xd0 },
+	{ 0x9a, 0x85, 0x3e, 0x61, 0x78, 0xcf, 0xff, 0xa8, 0x2a, 0x15, 0x49, 0x80, 0xf7, 0xc0, 0x81, 0xbc },
+	{ 0x47, 0xfc, 0xdb, 0x23, 0xc7, 0x76, 0x66, 0xf4, 0x9f, 0x16, 0xcc, 0x55, 0xb3, 0x12, 0x2c, 0x7d },
+	{ 0xa2, 0xce, 0xc6, 0x27, 0x95, 0xac, 0x52, 0x9c, 0x72, 0x3d, 0x37, 0xa1, 0x08, 0x42, 0xfe, 0xf7 },
+	{ 0x86, 0x9a, 0xb3, 0x36, 0xf2, 0x56, 0x00, 0xbe, 0xf6, 0xe7, 0xcc, 0x1d, 0x06, 0x13, 0xe7, 0x78 },
+	{ 0xde, 0x7a, 0xeb, 0x5c, 0xa8, 0x5c, 0xd7, 0x25, 0x0e, 0xa8, 0xce, 0x5b, 0x8d, 0xba, 0xd9, 0x7c },
+	{ 0x84, 0x4e, 0x3c, 0xf8, 0x8c, 0xe1, 0x9c, 0xe8, 0x24, 0x4e, 0x31, 0x6a, 0x27, 0x63, 0xa7, 0x29 },
+	{ 0xe4, 0x1f, 0xdd, 0x38, 0x5a, 0x90, 0x94, 0xff, 0x84, 0x1e, 0x0a, 0x30, 0x3b, 0x16, 0xbb, 0x98 },
+	{ 0x41, 0xff, 0xca, 0x9b, 0x0f, 0x0f, 0x77, 0xd6, 0x29, 0x88, 0x79, 0xe8, 0x80, 0x41, 0xef, 0x90 },
+	{ 0xb1, 0x62, 0x7c, 0x69, 0x16, 0x78, 0x14, 0xd4, 0x19, 0xa9, 0x2e, 0xf0, 0xb6, 0xf6, 0xfb, 0x76 },
+	{ 0xb8, 0xdb, 0xd0, 0xfb, 0x81, 0x27, 0xc2, 0xed, 0x78, 0xca, 0x94, 0xdd, 0x39, 0x7d, 0xef, 0xfe },
+	{ 0x42, 0x3c, 0x9a, 0xc6, 0x45, 0x2a, 0xc8, 0x2b, 0x12, 0xc4, 0xf5, 0x21, 0xe3, 0x42, 0xc8, 0x5a },
+	{ 0x76, 0x1d, 0x1f, 0xf4, 0x37, 0x56, 0xd4, 0x0e, 0x66, 0xb4, 0xcd, 0x48, 0x33, 0xa2, 0xe2, 0x47 },
+	{ 0xbb, 0x8e, 0x0f, 0xfa, 0x1b, 0x2b, 0x6a, 0x87, 0x33, 0xda, 0x66, 0xa4, 0x19, 0x51, 0xf1, 0xa3 },
+	{ 0xe2, 0xd3, 0x65, 0xfa, 0xf4, 0x1a, 0x31, 0x2a, 0xb2, 0x84, 0x6e, 0x7c, 0x5c, 0x66, 0x7b, 0x49 },
+	{ 0x8c, 0x2a, 0x29, 0xc8, 0x24, 0xd1, 0x43, 0x60, 0x6c, 0x41, 0x2b, 0x85, 0x64, 0xdd, 0xd3, 0x4e },
+	{ 0xf2, 0xa4, 0xea, 0x66, 0xac, 0x01, 0x44, 0xb7, 0x42, 0x2c, 0xe2, 0x04, 0x6d, 0x1c, 0x52, 0x92 },
+	{ 0x1f, 0x11, 0x4a, 0x84, 0x3b, 0xcc, 0xed, 0xe6, 0x37, 0x9f, 0xf6, 0x23, 0x81, 0x25, 0x02, 0xb0 },
+	{ 0x0c, 0xcc, 0xfa, 0xf8, 0x67, 0x0e, 0xa0, 0x66, 0xec, 0x3e, 0x48, 0x1b, 0x7f, 0x4f, 0x07, 0x94 },
+	{ 0xf4, 0x9c, 0x71, 0x7b, 0x14, 0x91, 0xc0, 0xae, 0x14, 0x52, 0x09, 0x05, 0x0e, 0x87, 0xbf, 0xc9 },
+	{ 0x45, 0x2e, 0x4d, 0xa4, 0x5d, 0x5a, 0xdd, 0x6b, 0xcd, 0x2a, 0x5f, 0x2f, 0xb1, 0xca, 0xa7, 0xd1 },
+	{ 0xdd, 0x13, 0x24, 0x9d, 0x73, 0xce, 0x92, 0x61, 0x25, 0x32, 0x98, 0x48, 0x8c, 0x96, 0x17, 0x27 },
+	{ 0x39, 0x4d, 0xd6, 0x60, 0x76, 0x92, 0xc3, 0xcd, 0xe1, 0xce, 0x39, 0xa7, 0xe2, 0xe9, 0xab, 0xf7 },
+	{ 0x5e, 0xc4, 0x9d, 0xe1, 0xe5, 0x65, 0x01, 0xe8, 0x8e, 0x8d, 0xd4, 0x58, 0x23, 0xb7, 0xb1, 0xf1 },
+	{ 0x89, 0x23, 0xfa, 0x9f, 0x8d, 0xe7, 0xb4, 0xe8, 0xb1, 0xbd, 0xe4, 0x0a, 0x47, 0xc4, 0xff, 0x91 },
+	{ 0x40, 0x83, 0x87, 0x91, 0x5b, 0xc7, 0xb8, 0xda, 0x40, 0xf5, 0x65, 0x68, 0x30, 0x8c, 0x38, 0xf5 },
+	{ 0x37, 0x2b, 0x57, 0xb7, 0x0f, 0x90, 0x53, 0x67, 0x0f, 0x6f, 0x58, 0xcd, 0xa2, 0x5c, 0x55, 0x34 },
+	{ 0xe0, 0xc6, 0x62, 0x9b, 0x0d, 0xd2, 0x3a, 0xfb, 0xe0, 0x41, 0x6a, 0x0f, 0x6c, 0x6a, 0x19, 0xcc },
+	{ 0xc8, 0xc1, 0xd1, 0xb2, 0xb8, 0xc7, 0x4e, 0xb2, 0x08, 0x8f, 0xe5, 0xd2, 0x99, 0xc4, 0xba, 0x8d },
+	{ 0x82, 0x56, 0xb5, 0xe3, 0x24, 0x52, 0x20, 0xf1, 0x52, 0x28, 0x0a, 0x6a, 0x86, 0xf8, 0x39, 0xf2 },
+	{ 0x30, 0x9d, 0x86, 0xda, 0x24, 0x27, 0x2c, 0x16, 0xb0, 0x30, 0x15, 0x73, 0xd0, 0x44, 0x6d, 0x66 },
+	{ 0x39, 0xb6, 0x42, 0xd5, 0xf2, 0x31, 0x24, 0xe3, 0xe1, 0x5f, 0x8b, 0xc7, 0x6f, 0xc0, 0x72, 0x55 },
+	{ 0xb1, 0x38, 0x84, 0xd4, 0x17, 0x05, 0x21, 0x65, 0x19, 0x6f, 0x74, 0x16, 0x18, 0xd4, 0x12, 0xeb },
+	{ 0x3d, 0xfa, 0x40, 0x28, 0xc0, 0x36, 0x04, 0xb0, 0x85, 0x1f, 0x4e, 0x7b, 0xef, 0xda, 0x1f, 0xdc },
+	{ 0x71, 0x5d, 0xdd, 0x96, 0xb6, 0x09, 0x36, 0x46, 0xd9, 0x61, 0xf7, 0x14, 0x63, 0xd2, 0x7e, 0x25 },
+	{ 0xd0, 0x34, 0x52, 0x0e, 0xd4, 0x17, 0x95, 0x14, 0x50, 0xf1, 0x8d, 0xcd, 0x49, 0x68, 0x20, 0x55 },
+	{ 0x07, 0x21, 0x35, 0xe6, 0x65, 0x7b, 0x7b, 0xd5, 0x5f, 0x09, 0x4f, 0x54, 0xfe, 0x10, 0x98, 0xb7 },
+	{ 0x3f, 0xf2, 0xc7, 0x3c, 0x28, 0xc6, 0x80, 0xa7, 0x57, 0x45, 0x75, 0x7b, 0x90, 0x45, 0x8d, 0x13 },
+	{ 0xe3, 0x3a, 0x2d, 0xba, 0x29, 0xa9, 0x75, 0xee, 0x9b, 0xfa, 0xa4, 0x8f, 0x5d, 0x8a, 0x3d, 0x9f },
+	{ 0x8d, 0xbb, 0xe8, 0x1c, 0x58, 0xd2, 0x7b, 0x93, 0x55, 0xf1, 0x1b, 0x72, 0x04, 0x24, 0x7f, 0x30 },
+	{ 0xa0, 0x82, 0x4f, 0xe9, 0x2f, 0x37, 0xef, 0xc6, 0xa0, 0xa3, 0x9b, 0xed, 0x29, 0x92, 0xbe, 0xa8 },
+	{ 0xdf, 0x20, 0x27, 0xfc, 0x5a, 0x17, 0x89, 0x90, 0xf7, 0x74, 0x9c, 0xb5, 0x7c, 0x92, 0x79, 0xa4 },
+	{ 0x6f, 0xbd, 0x75, 0x2e, 0x54, 0xae, 0xeb, 0x92, 0x07, 0x54, 0xe7, 0xad, 0x46, 0xdd, 0x6c, 0xbe },
+	{ 0x54, 0x6e, 0x12, 0xbc, 0xe1, 0x3f, 0xb8, 0xc5, 0x74, 0x22, 0xe2, 0xca, 0x21, 0x3a, 0xd3, 0x38 },
+	{ 0x2c, 0x59, 0x88, 0x87, 0x57, 0x22, 0x4c, 0x49, 0x0c, 0x71, 0x52, 0xbf, 0x50, 0x2a, 0xc0, 0xdf },
+	{ 0xb6, 0x22, 0xbe, 0xc6, 0x97, 0xc4, 0xb2, 0x9c, 0xa6, 0xfb, 0x04, 0x24, 0x87, 0xc6, 0x5f, 0x99 },
+	{ 0x46, 0x95, 0x14, 0x64, 0x92, 0xe8, 0x21, 0x30, 0xb6, 0xa0, 0x95, 0x42, 0xb2, 0xee, 0x69, 0x27 },
+	{ 0x89, 0x0e, 0x7e, 0x55, 0x0e, 0x2e, 0x3b, 0xb1, 0xb1, 0xa0, 0x07, 0x9e, 0xf7, 0x32, 0x0b, 0x4c },
+	{ 0x15, 0xfa, 0x32, 0x3e, 0xb5, 0xd2, 0x11, 0x6b, 0x1d, 0x8b, 0x9b, 0xdc, 0x6d, 0x5c, 0x01, 0xc9 },
+	{ 0x2b, 0xf2, 0xc0, 0xc7, 0x22, 0x94, 0x07, 0x85, 0x23, 0xfb, 0x1b, 0xac, 0x4f, 0x06, 0xfe, 0x89 },
+	{ 0x7f, 0x79, 0x7e, 0x50, 0x8c, 0xdb, 0x84, 0xe8, 0x97, 0xde, 0x7d, 0xc9, 0x07, 0x02, 0x4f, 0xc1 },
+	{ 0xa7, 0xcd, 0x7c, 0x64, 0x94, 0x25, 0x5e, 0x0b, 0xff, 0xe6, 0xa4, 0x1b, 0xc7, 0xc5, 0x3f, 0xec },
+	{ 0x92, 0x12, 0xbe, 0x05, 0x5d, 0x7f, 0xb9, 0x46, 0xe2, 0xb2, 0xa0, 0x85, 0x47, 0x1d, 0x1c, 0xf5 },
+	{ 0x0c, 0xa2, 0x02, 0x64, 0x69, 0x9b, 0xac, 0xf7, 0xec, 0x04, 0x8e, 0x41, 0xe0, 0x2c, 0x1e, 0x08 },
+	{ 0xbd, 0xb0, 0x8e, 0xa3, 0x82, 0x2d, 0xda, 0xed, 0x05, 0x3a, 0x48, 0x7e, 0x59, 0xde, 0x47, 0x67 },
+	{ 0x5f, 0x94, 0xd1, 0x15, 0x97, 0x93, 0xa6, 0xc1, 0x77, 0x94, 0x5c, 0x8c, 0xb1, 0xb1, 0x3a, 0xa5 },
+	{ 0x02, 0x8b, 0xeb, 0x1d, 0xe3, 0xa1, 0xd0, 0x7b, 0xd2, 0xf0, 0x32, 0xfa, 0xcc, 0x63, 0x1d, 0x21 },
+	{ 0xf0, 0x6d, 0xef, 0x72, 0xc6, 0x45, 0x5a, 0x19, 0x70, 0xaf, 0x23, 0xbe, 0xdd, 0xfd, 0x06, 0x89 },
+	{ 0xce, 0xfd, 0x56, 0x1a, 0xee, 0x5b, 0xab, 0x76, 0x7e, 0x74, 0xcf, 0x86, 0xba, 0x49, 0xd5, 0x4b },
+	{ 0x5f, 0x01, 0x6d, 0x0c, 0x1c, 0x81, 0x52, 0x3d, 0x77, 0xc9, 0x50, 0x92, 0x85, 0xb8, 0x8a, 0xbb },
+	{ 0x3b, 0xc3, 0x45, 0x34, 0xda, 0x7a, 0x1a, 0x12, 0xb3, 0xa2, 0x8f, 0x34, 0x60, 0xbc, 0xd4, 0xd2 },
+	{ 0x88, 0xd1, 0xae, 0x2a, 0xd8, 0x12, 0xea, 0x5b, 0xc8, 0x64, 0x8b, 0x64, 0x95, 0x31, 0x32, 0x82 },
+	{ 0x66, 0x4c, 0x9a, 0x87, 0x80, 0x6f, 0xc1, 0x81, 0xd6, 0x0c, 0x5a, 0xc0, 0x22, 0xec, 0x0b, 0xff },
+	{ 0x87, 0x55, 0x6b, 0x20, 0x24, 0xcb, 0x2b, 0x60, 0xdf, 0xd1, 0x77, 0xe4, 0x44, 0x7c, 0x7b, 0xe6 },
+	{ 0x0e, 0x18, 0x72, 0x37, 0xcd, 0x83, 0x03, 0x3c, 0xbe, 0xd8, 0xe3, 0xce, 0x5d, 0xff, 0x46, 0xe3 },
+	{ 0x24, 0xfb, 0x83, 0x76, 0xbb, 0x8b, 0x7f, 0x1e, 0xc4, 0x2b, 0x87, 0x31, 0xf0, 0x17, 0x4f, 0x5e },
+	{ 0x95, 0x9b, 0x04, 0x6f, 0xf8, 0x0f, 0x6e, 0x71, 0x9d, 0x88, 0xb8, 0x72, 0x88, 0xce, 0x34, 0x0e },
+	{ 0xd7, 0x01, 0x97, 0xca, 0x3c, 0xad, 0x29, 0x0c, 0xaf, 0x86, 0x68, 0x6e, 0x0a, 0x34, 0xe6, 0xf4 },
+	{ 0xe7, 0x69, 0xaf, 0xc2, 0x77, 0xf4, 0xdb, 0x83, 0x3f, 0x9d, 0x8a, 0xd6, 0x8d, 0x13, 0xf6, 0xdf },
+	{ 0x1a, 0x51, 0x08, 0x27, 0xba, 0x7f, 0x4f, 0x1e, 0xaa, 0x4c, 0x20, 0xf0, 0xb0, 0x55, 0x9e, 0x8d },
+	{ 0xd1, 0xef, 0x09, 0xf8, 0x05, 0x8c, 0xc0, 0xb6, 0x39, 0xdb, 0x38, 0x94, 0x88, 0xd1, 0xb4, 0xc2 },
+	{ 0x08, 0x88, 0xfc, 0xa5, 0x9a, 0x09, 0xc0, 0x99, 0x48, 0x7f, 0x85, 0x67, 0xff, 0x34, 0x5a, 0x0d },
+	{ 0x95, 0xb0, 0x80, 0xb9, 0x77, 0xc9, 0xe7, 0xa8, 0x9d, 0xa5, 0x95, 0xdf, 0xd7, 0x5f, 0x29, 0x54 },
+	{ 0xb9, 0x81, 0x0c, 0x9b, 0x34, 0xe2, 0x73, 0x58, 0x61, 0x97, 0x62, 0x37, 0x29, 0x55, 0x8f, 0x26 },
+	{ 0x2e, 0x90, 0x83, 0x7b, 0x3d, 0xde, 0x35, 0xe7, 0xde, 0xed, 0x10, 0x06, 0xe0, 0x48, 0x0b, 0xe9 },
+	{ 0xdf, 0x74, 0x17, 0x26, 0x58, 0xfd, 0x6f, 0x6e, 0xf7, 0xe8, 0x10, 0x69, 0xba, 0xd7, 0x4b, 0xbc },
+	{ 0x9c, 0x7d, 0xc5, 0x75, 0xe0, 0x5e, 0x7c, 0xa0, 0xfc, 0x3a, 0x70, 0x80, 0x98, 0x2b, 0xef, 0xf3 },
+	{ 0xd8, 0x7d, 0xda, 0xd4, 0xf0, 0xf4, 0xe7, 0x07, 0x98, 0x19, 0x7c, 0xee, 0x5a, 0xe9, 0x9c, 0x90 },
+	{ 0x9c, 0x68, 0x49, 0x2b, 0x61, 0xa5, 0x02, 0x69, 0xfc, 0x1d, 0x93, 0x13, 0x49, 0x9a, 0xfa, 0xad },
+	{ 0x07, 0x75, 0x25, 0x10, 0x63, 0x61, 0x62, 0xb3, 0x5f, 0x7d, 0xc3, 0x07, 0x3c, 0x56, 0x6a, 0xcf },
+	{ 0x53, 0x9e, 0xde, 0x87, 0x30, 0x12, 0x13, 0xec, 0x8b, 0x1b, 0x5a, 0x97, 0x93, 0x3f, 0x4a, 0x85 },
+	{ 0x6f, 0xe7, 0x6d, 0xc3, 0x52, 0x21, 0xdf, 0x01, 0x07, 0x8e, 0xa1, 0x87, 0xe5, 0xff, 0x55, 0x4a },
+	{ 0x59, 0xef, 0xdf, 0x39, 0xe5, 0x5f, 0xe9, 0xe7, 0x01, 0x1e, 0x21, 0xb8, 0x03, 0x56, 0x59, 0x89 },
+	{ 0x24, 0x3a, 0xf8, 0x55, 0x39, 0xb8, 0xec, 0xc4, 0xc4, 0x82, 0x1e, 0x78, 0xde, 0xcb, 0x2c, 0x30 },
+	{ 0x02, 0x4c, 0x77, 0x3e, 0x65, 0x75, 0x63, 0xd5, 0xd2, 0x99, 0x9b, 0xb3, 0xde, 0xaf, 0x3f, 0x4f },
+	{ 0x23, 0x55, 0x48, 0xd7, 0x08, 0xd1, 0xcd, 0xb3, 0xdb, 0x5e, 0xb9, 0xd7, 0x00, 0x40, 0xaf, 0x36 },
+	{ 0xa5, 0x42, 0x91, 0x46, 0xb1, 0x83, 0x8d, 0x8f, 0x2d, 0xf6, 0x71, 0x21, 0xfa, 0x61, 0x22, 0xcb },
+	{ 0xb5, 0x3d, 0x0e, 0x48, 0x67, 0xdd, 0x93, 0x8b, 0xbd, 0xd7, 0x9f, 0x83, 0xa9, 0x3a, 0xe2, 0x9f },
+	{ 0x17, 0x9e, 0xc9, 0x28, 0x20, 0x7c, 0xa7, 0x84, 0xef, 0x3c, 0x4e, 0x29, 0xd1, 0x81, 0x9c, 0xe8 },
+	{ 0xbc, 0x0a, 0x53, 0x04, 0xd0, 0x72, 0x28, 0x83, 0x1c, 0x6d, 0x7a, 0x24, 0x6a, 0x06, 0xa8, 0x3f },
+	{ 0xaf, 0x01, 0x89, 0xe0, 0x31, 0x49, 0x37, 0xc7, 0x47, 0xf2, 0xb5, 0xcf, 0x88, 0xb5, 0xc7, 0xe1 },
+	{ 0x37, 0xa9, 0x3f, 0x76, 0x0b, 0xe9, 0x2d, 0xb4, 0x0f, 0x1d, 0x87, 0x5a, 0x7f, 0xc4, 0x10, 0xd8 },
+	{ 0x51, 0x67, 0xe3, 0x93, 0x4a, 0x56, 0x29, 0x4e, 0xb9, 0x9e, 0x9b, 0x50, 0x04, 0x21, 0xff, 0x7b },
+	{ 0x79, 0x67, 0xf1, 0x7d, 0x55, 0xba, 0x1b, 0x93, 0x21, 0x33, 0x4e, 0xef, 0x85, 0x9f, 0x1d, 0x8f },
+	{ 0x0e, 0x03, 0xf6, 0xec, 0x4d, 0xca, 0x89, 0x04, 0xbe, 0xbb, 0x06, 0x62, 0x0e, 0x6e, 0x52, 0x9d },
+	{ 0xe5, 0x86, 0xa4, 0xf8, 0x8e, 0x1e, 0xd9, 0xc3, 0x6d, 0x94, 0x40, 0x43, 0x3c, 0x3a, 0x7d, 0xee },
+	{ 0xe7, 0xbd, 0x9f, 0xec, 0x74, 0xda, 0xc2, 0x61, 0x3f, 0x11, 0xff, 0x89, 0xcb, 0x58, 0xc8, 0xf7 },
+	{ 0x93, 0x64, 0x09, 0x7b, 0x12, 0x54, 0x84, 0xd3, 0xcb, 0x0b, 0xfa, 0x2b, 0xf9, 0xaf, 0xe9, 0x04 },
+	{ 0x90, 0x59, 0xab, 0xd0, 0x72, 0x1c, 0xaa, 0xf5, 0x10, 0xe4, 0x10, 0xcc, 0x94, 0x66, 0x8c, 0x8f },
+	{ 0x2b, 0x9e, 0xd0, 0x9d, 0x25, 0xae, 0x20, 0xa7, 0x23, 0x87, 0xa7, 0xf8, 0x11, 0xc1, 0x2b, 0x72 },
+	{ 0xda, 0xb4, 0xd5, 0xc8, 0xd6, 0xb0, 0xd1, 0xa5, 0x6a, 0x96, 0x3a, 0x35, 0xea, 0x07, 0xe8, 0x99 },
+	{ 0x6f, 0x11, 0x66, 0x58, 0x51, 0x94, 0xd2, 0x70, 0x07, 0xc8, 0x5b, 0x61, 0x84, 0x22, 0x3f, 0xd6 },
+	{ 0x58, 0x34, 0x28, 0x50, 0xb3, 0xeb, 0xbd, 0x45, 0x18, 0x34, 0x76, 0xf1, 0xc4, 0xec, 0xc4, 0x1b },
+	{ 0xaa, 0x6b, 0x3f, 0x18, 0xaf, 0x6f, 0x8c, 0x6d, 0xba, 0xd9, 0x99, 0x75, 0x57, 0x08, 0x4d, 0x4b },
+	{ 0x3f, 0x74, 0xdf, 0x7d, 0x2c, 0x6d, 0xa6, 0x5a, 0x57, 0x97, 0x46, 0xee, 0xb3, 0xdd, 0xd1, 0x6f },
+	{ 0xce, 0xd3, 0x5e, 0x85, 0xef, 0xe8, 0xb7, 0x07, 0x7e, 0x3a, 0x15, 0xad, 0x1b, 0x27, 0xec, 0xbf },
+	{ 0x60, 0xa7, 0xa8, 0xab, 0xce, 0x3b, 0x04, 0xa8, 0x60, 0x96, 0x1e, 0xec, 0x74, 0x90, 0x2a, 0xe3 },
+	{ 0x58, 0x73, 0x9c, 0x2f, 0x31, 0x18, 0x2b, 0xec, 0x18, 0x8b, 0x0d, 0x38, 0xb3, 0xa0, 0xa2, 0xed },
+	{ 0xda, 0x9f, 0x59, 0x7e, 0x57, 0xf7, 0x57, 0x6e, 0x6a, 0x79, 0x5d, 0xc8, 0x9a, 0x76, 0xf3, 0x53 },
+	{ 0x0b, 0x8f, 0x2b, 0xce, 0x31, 0xf3, 0x4e, 0x11, 0x03, 0x03, 0xcc, 0xe1, 0x1c, 0x4e, 0x2e, 0xca },
+	{ 0xbd, 0x86, 0x96, 0x0e, 0x84, 0xba, 0xe6, 0x7e, 0x05, 0x00, 0x8e, 0xa4, 0xba, 0xbb, 0x5e, 0xdb },
+	{ 0xd7, 0xec, 0x1a, 0x80, 0xbd, 0xf3, 0xaf, 0xd4, 0xaf, 0x69, 0x8b, 0x01, 0xbb, 0xa2, 0xf1, 0xae },
+	{ 0x89, 0x77, 0xea, 0xc9, 0x8a, 0xcd, 0x9b, 0xc6, 0xb1, 0x31, 0x59, 0xbe, 0x84, 0x09, 0xd2, 0xa9 },
+	{ 0x55, 0xea, 0x55, 0xc6, 0x95, 0x87, 0x76, 0xc1, 0x5d, 0xb5, 0xf5, 0x4a, 0x72, 0xef, 0x89, 0xd4 },
+	{ 0x46, 0x6b, 0x1c, 0xcf, 0x93, 0x75, 0x2e, 0xc1, 0xb6, 0x66, 0xdb, 0x68, 0x13, 0xcc, 0x80, 0x9b },
+	{ 0x2a, 0x37, 0x09, 0xde, 0xf0, 0x1f, 0xdc, 0xe2, 0x3a, 0x11, 0x71, 0xe5, 0x10, 0x9d, 0x69, 0x1c },
+	{ 0x5e, 0x03, 0x12, 0xc1, 0x63, 0x92, 0x6e, 0x8e, 0x8e, 0xe4, 0x6b, 0x9f, 0x11, 0x6b, 0x8f, 0xc3 },
+	{ 0xba, 0xfd, 0x4f, 0xa5, 0xe8, 0x29, 0x32, 0x54, 0x4a, 0x2a, 0x76, 0xb7, 0x79, 0x0a, 0x46, 0xc2 },
+	{ 0xf9, 0x47, 0x37, 0x8e, 0x16, 0x24, 0xe5, 0x3f, 0xa1, 0x87, 0x02, 0xcc, 0x8e, 0xc5, 0x2e, 0xa6 },
+	{ 0x18, 0x6e, 0xfd, 0x5c, 0xd1, 0xa9, 0x4c, 0x5e, 0xd8, 0x43, 0xd6, 0x5c, 0x5f, 0x7c, 0x25, 0x9c },
+	{ 0xd1, 0xda, 0x8d, 0xad, 0x86, 0xd2, 0x46, 0x7f, 0x39, 0xbe, 0x5b, 0x27, 0x39, 0x40, 0xc0, 0x7c },
+	{ 0x28, 0x15, 0x8a, 0x34, 0x8a, 0x1d, 0x6c, 0x7c, 0x68, 0xb1, 0x8f, 0x0b, 0xd1, 0x0f, 0x13, 0x59 },
+	{ 0x91, 0xd5, 0xee, 0xda, 0x26, 0x64, 0x68, 0xf1, 0xf9, 0x76, 0x24, 0x4c, 0xe5, 0x1b, 0x43, 0x2b },
+	{ 0x58, 0x9d, 0x94, 0xc4, 0x2f, 0x8b, 0x1e, 0x5b, 0x18, 0xc5, 0xc7, 0x11, 0x52, 0xc3, 0x8b, 0x79 },
+	{ 0x23, 0x2b, 0x50, 0x42, 0x0a, 0x5e, 0xda, 0x44, 0xdb, 0x24, 0xff, 0xfd, 0x61, 0x1d, 0xc6, 0xaa },
+	{ 0x54, 0xf0, 0x29, 0xfd, 0xe5, 0xe6, 0xdd, 0x78, 0x74, 0x74, 0xb3, 0x3d, 0x45, 0xd2, 0x17, 0x95 },
+	{ 0x57, 0x36, 0xcd, 0x04, 0xfb, 0xfc, 0xd9, 0x96, 0x2f, 0x4f, 0x91, 0xfe, 0x50, 0x9f, 0xc9, 0x23 },
+	{ 0x10, 0x64, 0xe9, 0x75, 0x32, 0xf9, 0x66, 0x11, 0x90, 0x72, 0x7f, 0x82, 0x3c, 0xaf, 0x86, 0x32 },
+	{ 0x1f, 0x8f, 0x32, 0x43, 0x37, 0x25, 0xc8, 0x33, 0x37, 0x4d, 0x25, 0xb1, 0x5d, 0x8d, 0xbd, 0x53 },
+	{ 0x19, 0xd5, 0xc4, 0x1c, 0x06, 0x38, 0x91, 0x22, 0xc1, 0xb9, 0x0c, 0x70, 0x60, 0xa0, 0xe7, 0xf1 },
+	{ 0x79, 0xa6, 0x65, 0x5d, 0xd3, 0xe6, 0x88, 0x39, 0x21, 0x8a, 0xe5, 0x35, 0x74, 0x53, 0xfb, 0x60 },
+	{ 0x5c, 0xb7, 0x9a, 0x82, 0xfe, 0x1c, 0x0b, 0xb9, 0xbc, 0x4a, 0xd0, 0xeb, 0x32, 0xbb, 0x4f, 0x74 },
+	{ 0x4e, 0x47, 0x09, 0x9f, 0x2b, 0x65, 0xd5, 0x38, 0xfe, 0x59, 0xd5, 0x83, 0x50, 0x46, 0xad, 0xc0 },
+	{ 0xe5, 0x9b, 0x20, 0x43, 0x0e, 0xd8, 0x52, 0xfb, 0x6d, 0xb1, 0x1d, 0xb0, 0x8b, 0xcb, 0x71, 0x34 },
+	{ 0xb0, 0x7d, 0xcc, 0xea, 0xe5, 0x90, 0xf5, 0xc2, 0x30, 0x85, 0xc9, 0x4f, 0xd9, 0x6a, 0x7e, 0x7d },
+	{ 0xc3, 0xad, 0x9f, 0x2b, 0x3a, 0x95, 0xc9, 0x0b, 0x7b, 0xc8, 0x9a, 0xeb, 0x8b, 0xaf, 0x84, 0x53 },
+	{ 0xda, 0xc9, 0x51, 0x13, 0x56, 0x6a, 0x4b, 0xdd, 0x6a, 0xb3, 0x17, 0xa2, 0x39, 0x99, 0xdc, 0xdf },
+	{ 0xae, 0x46, 0xd1, 0xf6, 0xff, 0xd4, 0x0b, 0x25, 0x5e, 0x08, 0x0b, 0x09, 0x4a, 0x4c, 0x33, 0x74 },
+	{ 0x6a, 0x66, 0xa0, 0x45, 0x4f, 0x01, 0xae, 0xdf, 0x7a, 0x92, 0x62, 0x9a, 0x03, 0xe4, 0xcf, 0xf9 },
+	{ 0x93, 0xb8, 0xf9, 0xa4, 0x0f, 0x3a, 0x6b, 0xb1, 0xcb, 0x7f, 0x6e, 0xdf, 0x36, 0xf5, 0xbb, 0x1c },
+	{ 0xe8, 0x63, 0xdb, 0x8b, 0x27, 0x95, 0x74, 0xcc, 0x28, 0xde, 0xcc, 0xe3, 0xba, 0x30, 0x68, 0x1f },
+	{ 0xbf, 0x93, 0x99, 0x6d, 0x6b, 0x03, 0xdd, 0xad, 0xd7, 0x42, 0x92, 0x11, 0xab, 0xb7, 0xc0, 0x58 },
+	{ 0xea, 0x07, 0x72, 0x76, 0x92, 0x3e, 0x0a, 0xe6, 0xfa, 0x8f, 0x7f, 0x30, 0x1e, 0x56, 0x03, 0x3f },
+	{ 0x19, 0x29, 0xb5, 0x46, 0x03, 0x1e, 0x78, 0x00, 0xc1, 0x2d, 0x81, 0x23, 0x9e, 0xe5, 0xb9, 0x09 },
+	{ 0xa4, 0x05, 0xc2, 0x1b, 0x7b, 0x68, 0x3c, 0x3a, 0x44, 0xba, 0xf5, 0xe7, 0x97, 0x60, 0x49, 0x01 },
+	{ 0xe8, 0x4e, 0x5f, 0x41, 0xa8, 0xdb, 0xfa, 0x94, 0x28, 0xc1, 0xef, 0x76, 0x6b, 0x9f, 0x73, 0xd9 },
+	{ 0x5d, 0x48, 0x5a, 0xd7, 0x31, 0x1e, 0x43, 0xec, 0xa5, 0xfa, 0xc0, 0xd8, 0xd2, 0x01, 0xfb, 0x55 },
+	{ 0x4b, 0x6a, 0xd2, 0x0b, 0x93, 0xee, 0x39, 0x30, 0x43, 0x10, 0x49, 0xe3, 0xd1, 0x4f, 0xc2, 0x8f },
+	{ 0x65, 0xd0, 0x56, 0x7d, 0xcc, 0x27, 0x03, 0x86, 0xed, 0x79, 0x46, 0x40, 0xd2, 0x36, 0x55, 0x63 },
+	{ 0x7d, 0xd5, 0xe7, 0x65, 0x21, 0x32, 0xef, 0xce, 0xc5, 0x2c, 0xcb, 0x7c, 0xa4, 0xdc, 0xb3, 0xa1 },
+	{ 0x14, 0x00, 0x07, 0x75, 0x05, 0x32, 0x79, 0x22, 0x34, 0x4a, 0x59, 0xcf, 0x40, 0x3f, 0x8f, 0x89 },
+	{ 0x1d, 0x58, 0x37, 0x4f, 0x51, 0x69, 0xde, 0x95, 0x65, 0xd0, 0x66, 0x6a, 0xce, 0x6e, 0x72, 0x4a },
+	{ 0x07, 0x4b, 0x2d, 0x7b, 0x64, 0xee, 0x6e, 0x44, 0x5f, 0x43, 0x09, 0x2e, 0x9d, 0x33, 0x81, 0x43 },
+	{ 0xaf, 0x16, 0x05, 0x2b, 0xb1, 0x02, 0xb1, 0xfe, 0x47, 0x0f, 0x93, 0x3c, 0xd8, 0x46, 0xbc, 0x27 },
+	{ 0xfa, 0xc3, 0x7a, 0x98, 0xca, 0x6b, 0xa3, 0x3b, 0x8a, 0x1a, 0x16, 0x4c, 0xdf, 0x7a, 0xe5, 0x41 },
+	{ 0x76, 0x8a, 0xba, 0xea, 0xbc, 0x43, 0x80, 0x8a, 0x66, 0xe9, 0xc1, 0x4e, 0x07, 0xa9, 0x32, 0x5e },
+	{ 0x7a, 0xe3, 0x34, 0x88, 0x09, 0x02, 0xda, 0x8e, 0x0a, 0xc6, 0x61, 0x6f, 0xd6, 0x54, 0xd4, 0x2a },
+	{ 0x1c, 0xdc, 0xf3, 0x44, 0x9d, 0x21, 0x20, 0x9a, 0x7c, 0x3d, 0x53, 0xea, 0x7d, 0xb9, 0xbb, 0xae },
+	{ 0xbb, 0x79, 0x93, 0xaf, 0x9c, 0x71, 0xf0, 0x4f, 0x33, 0xbd, 0x89, 0x37, 0xca, 0xbf, 0xfc, 0x5d },
+	{ 0xdb, 0x30, 0x19, 0xd3, 0x8a, 0xf8, 0x8f, 0xa1, 0x53, 0x29, 0x4e, 0xb5, 0x3a, 0xbd, 0x9e, 0x35 },
+	{ 0xb7, 0x35, 0x95, 0x5c, 0xcf, 0x6c, 0x10, 0x83, 0x8f, 0xfd, 0xc6, 0x83, 0x4a, 0xa5, 0x4f, 0xd7 },
+	{ 0x14, 0x69, 0x73, 0xe9, 0x81, 0xd1, 0xd9, 0x37, 0x34, 0xdb, 0xaa, 0xef, 0xcd, 0x15, 0x56, 0xe7 },
+	{ 0x1f, 0x65, 0x3a, 0xae, 0x38, 0xb2, 0xd4, 0xc4, 0x37, 0x13, 0x6b, 0xd7, 0xbe, 0x6a, 0xd4, 0xc7 },
+	{ 0x6e, 0xbf, 0x1a, 0xe3, 0x9b, 0xbf, 0x07, 0xe4, 0x1e, 0x6f, 0x02, 0xbb, 0xd2, 0x8f, 0x71, 0xc6 },
+	{ 0x3c, 0x00, 0x15, 0x5f, 0x10, 0x96, 0x6b, 0x67, 0x9c, 0xde, 0x0b, 0x6e, 0xc2, 0xbd, 0xad, 0x9c },
+	{ 0x9b, 0xec, 0x05, 0x21, 0xad, 0x5d, 0x44, 0x6d, 0x13, 0x8b, 0x7f, 0x93, 0xf8, 0xe4, 0x43, 0x12 },
+	{ 0x1d, 0x04, 0x47, 0x25, 0x54, 0x83, 0xf7, 0xb7, 0x65, 0x5c, 0xf2, 0xb6, 0x90, 0x29, 0xa0, 0x32 },
+	{ 0xaa, 0x17, 0x4f, 0xee, 0xb1, 0x89, 0xa5, 0x8f, 0xba, 0x65, 0x25, 0xc2, 0x19, 0xc3, 0x7a, 0x33 },
+	{ 0x2c, 0x6e, 0x04, 0xd2, 0xd6, 0xdb, 0xc5, 0x80, 0x0c, 0x8e, 0x2f, 0x2c, 0xa0, 0xbb, 0xb4, 0x25 },
+	{ 0x26, 0xde, 0x8e, 0x40, 0xa4, 0x61, 0x82, 0xde, 0x96, 0x34, 0xd1, 0xc4, 0x41, 0xf1, 0xc7, 0x4f },
+	{ 0x88, 0xe6, 0x2a, 0x75, 0x57, 0xcc, 0x63, 0x93, 0xc8, 0x81, 0x68, 0xd1, 0xe4, 0xc2, 0x26, 0xc8 },
+	{ 0xc5, 0x38, 0x8b, 0x49, 0x1d, 0x37, 0x9a, 0x87, 0x4d, 0xb9, 0xcd, 0xe5, 0x58, 0x13, 0xa2, 0x74 },
+	{ 0xec, 0x68, 0x65, 0xff, 0x76, 0x6d, 0xe7, 0xf2, 0xcc, 0x46, 0xf8, 0x50, 0x4c, 0x97, 0x37, 0xd4 },
+	{ 0x8f, 0x4a, 0x03, 0xbd, 0x43, 0xc2, 0x97, 0x75, 0x27, 0x86, 0xf1, 0x51, 0x18, 0xb8, 0x25, 0x0a },
+	{ 0x2a, 0xf8, 0x94, 0xfe, 0x72, 0xf3, 0x6e, 0x3c, 0x3a, 0xba, 0xd9, 0x9e, 0x22, 0xe9, 0x8b, 0x4a },
+	{ 0xd5, 0xca, 0x9b, 0xd6, 0x56, 0xf1, 0x3f, 0x6e, 0xdd, 0x09, 0xaa, 0x27, 0x7b, 0x15, 0x9b, 0xeb },
+	{ 0x8a, 0xf3, 0x2d, 0xd4, 0x3e, 0x15, 0x5a, 0xc2, 0x9a, 0xc4, 0x6c, 0x3e, 0xd5, 0xbe, 0x88, 0x45 },
+	{ 0xc7, 0xdc, 0x21, 0x34, 0x88, 0xe0, 0x2f, 0xa1, 0x1f, 0x6b, 0x80, 0x32, 0xbc, 0x38, 0x3d, 0x94 },
+	{ 0x04, 0xad, 0x6a, 0xc7, 0x49, 0xa4, 0x40, 0xe2, 0xa4, 0x50, 0x14, 0xd4, 0x0c, 0xf1, 0x73, 0xe4 },
+	{ 0xdc, 0x58, 0x6c, 0xb3, 0x41, 0x5a, 0x67, 0xbf, 0x3c, 0x48, 0xed, 0x81, 0x4d, 0x2d, 0x83, 0xb9 },
+	{ 0x56, 0x12, 0xa9, 0xa6, 0x4c, 0xe9, 0x4d, 0xdf, 0x46, 0xd4, 0x94, 0x17, 0x85, 0x5f, 0x6e, 0x58 },
+	{ 0x4d, 0x23, 0xe5, 0x40, 0x7d, 0x51, 0x49, 0x81, 0x15, 0xdf, 0xd8, 0x9c, 0x84, 0x06, 0x52, 0xf5 },
+	{ 0x82, 0x95, 0x29, 0xc3, 0xa2, 0x7e, 0x8d, 0x97, 0x52, 0x7f, 0xa1, 0xb0, 0x74, 0xac, 0x17, 0xc4 },
+	{ 0x24, 0x10, 0x00, 0xc1, 0x3a, 0x45, 0xf9, 0x55, 0xc4, 0x48, 0x64, 0x9e, 0x3f, 0xa9, 0x43, 0xa4 },
+	{ 0xe8, 0xe5, 0xf2, 0xcc, 0x2b, 0x3c, 0x9a, 0x7f, 0x28, 0x30, 0x9e, 0x56, 0xde, 0xc8, 0xac, 0x7b },
+	{ 0x96, 0xaa, 0xac, 0x82, 0x27, 0x6a, 0x80, 0xf1, 0x86, 0xe6, 0xd7, 0xec, 0x04, 0x7d, 0x9b, 0x93 },
+	{ 0x65, 0x52, 0x6e, 0xbe, 0xd0, 0xce, 0x28, 0x39, 0xed, 0xcb, 0x17, 0xb3, 0xf5, 0xce, 0x99, 0xbf },
+	{ 0x2d, 0xea, 0x47, 0xdc, 0x8a, 0x23, 0x84, 0x7c, 0xf5, 0x20, 0x43, 0xac, 0xf0, 0x70, 0x6b, 0xc1 },
+	{ 0xd9, 0x4d, 0x0e, 0x09, 0xa2, 0x22, 0x8d, 0xe1, 0x81, 0x20, 0x04, 0x22, 0xe9, 0xe3, 0x25, 0x44 },
+	{ 0x0d, 0x48, 0x3e, 0x03, 0x1c, 0x56, 0x5e, 0x62, 0xd5, 0xd1, 0x5b, 0x9b, 0xcf, 0x04, 0xbe, 0x2f },
+	{ 0x28, 0x3f, 0x82, 0xc9, 0x88, 0x90, 0x5f, 0xeb, 0x68, 0xeb, 0x49, 0xe5, 0x6f, 0x32, 0xfc, 0xe4 },
+	{ 0x8c, 0x97, 0xc4, 0xbe, 0xa9, 0xbe, 0xef, 0xdb, 0x6c, 0x76, 0x1f, 0x8b, 0x38, 0xe4, 0x23, 0x65 },
+	{ 0xd7, 0x98, 0x2a, 0x56, 0xc0, 0x0d, 0xc9, 0xf6, 0xaf, 0xf5, 0x16, 0x4e, 0x7d, 0x5d, 0x1f, 0x97 },
+	{ 0x09, 0x2e, 0x38, 0x45, 0x4d, 0xc4, 0x71, 0x04, 0x31, 0x4c, 0x53, 0xc1, 0xee, 0x0c, 0xfa, 0x34 },
+	{ 0x56, 0x66, 0x99, 0xd0, 0x49, 0xcf, 0x34, 0xbd, 0x46, 0x48, 0x09, 0xcb, 0xc2, 0xa4, 0x40, 0x70 },
+	{ 0x1f, 0xfc, 0xcd, 0x39, 0xbc, 0x12, 0x74, 0xaf, 0x37, 0x82, 0x19, 0xb7, 0x31, 0x94, 0x0d, 0x6a },
+	{ 0x92, 0x7b, 0x2a, 0x7a, 0xd9, 0x1e, 0x1a, 0x5c, 0xe2, 0x43, 0xf2, 0xa5, 0xd4, 0xf3, 0xe2, 0x52 },
+	{ 0x6b, 0x8e, 0xf3, 0x25, 0x06, 0x63, 0x85, 0xfd, 0x63, 0xb1, 0x01, 0x67, 0x16, 0x54, 0xb4, 0x7d },
+	{ 0xc7, 0xf1, 0x9d, 0x7e, 0x07, 0x9a, 0xa9, 0xd8, 0x1f, 0x88, 0x5d, 0x9f, 0x0b, 0xca, 0x31, 0xda },
+	{ 0x14, 0x7e, 0xef, 0x33, 0x01, 0x8b, 0x53, 0x6f, 0x34, 0xf8, 0x87, 0x5c, 0x1d, 0xa7, 0x4a, 0x2d },
+	{ 0x25, 0xcb, 0xb7, 0xaa, 0x6c, 0xb9, 0x24, 0xf8, 0xad, 0x32, 0x0f, 0x65, 0x7e, 0x12, 0xd8, 0x11 },
+	{ 0xaa, 0x41, 0x47, 0x83, 0xb0, 0xfc, 0x98, 0xfe, 0xba, 0x9f, 0xdf, 0x9b, 0xb8, 0xe5, 0x63, 0xbf },
+	{ 0xdf, 0xf6, 0x2e, 0x67, 0x5c, 0xa4, 0x95, 0x21, 0xf7, 0x3a, 0xe2, 0xdb, 0xdd, 0x6f, 0x90, 0x18 },
+	{ 0xf9, 0xc5, 0x1f, 0x4d, 0x12, 0x7d, 0xbf, 0x8c, 0xa1, 0x35, 0x31, 0x59, 0x6b, 0x2d, 0xea, 0x49 },
+	{ 0x63, 0x99, 0x5b, 0x89, 0xe6, 0x6b, 0x19, 0xe8, 0x1b, 0xfd, 0x87, 0xf9, 0x42, 0x18, 0x0a, 0x5a },
+	{ 0xac, 0x8d, 0xbe, 0xc1, 0x15, 0x72, 0xfc, 0xd3, 0x8c, 0x39, 0x7b, 0x4f, 0x97, 0x95, 0xa3, 0x0e },
+	{ 0x1f, 0x50, 0xbe, 0x63, 0xb9, 0xf8, 0x5a, 0x8d, 0x37, 0xf6, 0x8d, 0x6a, 0x6f, 0xd9, 0xdf, 0x81 },
+	{ 0x80, 0x9d, 0xa2, 0xae, 0x3a, 0xef, 0x10, 0xa0, 0x80, 0x59, 0x7a, 0xb0, 0xd3, 0x41, 0xaa, 0x8c },
+	{ 0x48, 0x8d, 0x9b, 0x78, 0xfa, 0x77, 0x9e, 0x27, 0x88, 0xc6, 0xbc, 0x42, 0x53, 0x59, 0xd7, 0x5e },
+	{ 0x95, 0xda, 0x78, 0x4e, 0x76, 0x3c, 0xdb, 0x17, 0x9d, 0xdf, 0x4f, 0xb9, 0x76, 0x82, 0x12, 0xe0 },
+	{ 0x49, 0x87, 0xc7, 0x41, 0xaa, 0x18, 0x37, 0x70, 0x71, 0x07, 0xff, 0x4f, 0x80, 0x76, 0x49, 0x9e },
+	{ 0x82, 0x2c, 0xbd, 0x4e, 0x26, 0xdf, 0x2c, 0x82, 0x52, 0xee, 0x4f, 0x90, 0xe7, 0xd5, 0x50, 0x66 },
+	{ 0xde, 0xa4, 0xe3, 0xf1, 0xa6, 0xcf, 0xca, 0x94, 0x0e, 0xe2, 0x88, 0x35, 0x2c, 0xdd, 0xc2, 0x08 },
+	{ 0x2c, 0xad, 0x78, 0xb1, 0x54, 0x08, 0x33, 0x27, 0x0c, 0xe5, 0xc6, 0x72, 0x8e, 0x6f, 0x92, 0xf7 },
+	{ 0xea, 0x5b, 0x62, 0xa0, 0x8f, 0x24, 0xf1, 0xc3, 0xfa, 0x03, 0xf4, 0xe3, 0x5b, 0x9b, 0xd5, 0x56 },
+	{ 0x63, 0x6f, 0x63, 0xf4, 0xe7, 0xf8, 0x25, 0x79, 0x1b, 0xc3, 0xcd, 0x1f, 0xa4, 0xf5, 0x20, 0xce },
+	{ 0xc3, 0xd7, 0x97, 0xc0, 0x38, 0x08, 0xbd, 0x7a, 0x7b, 0x02, 0x55, 0xc5, 0x2a, 0xd2, 0x6d, 0xdf },
+	{ 0xb6, 0x8f, 0x59, 0xbd, 0x1c, 0xb2, 0x5e, 0x18, 0xa6, 0x30, 0xf9, 0x29, 0x5b, 0xcd, 0xaf, 0xaf },
+	{ 0xe7, 0xd2, 0x1b, 0x37, 0xf4, 0x93, 0x3c, 0x99, 0x3f, 0x2e, 0xdc, 0xf6, 0x1a, 0xea, 0xbc, 0x3d },
+	{ 0x0f, 0x40, 0xc5, 0x17, 0x84, 0xe5, 0xda, 0x59, 0xa7, 0xf7, 0x82, 0x9b, 0x70, 0x6f, 0x2b, 0x67 },
+	{ 0xb8, 0xc6, 0x54, 0xb1, 0x02, 0x6e, 0x48, 0xb6, 0x78, 0xad, 0xb7, 0x70, 0xea, 0xeb, 0xfa, 0xb8 },
+	{ 0x46, 0xd4, 0x88, 0x43, 0x10, 0x15, 0x8f, 0xd6, 0xb6, 0xf7, 0x2c, 0x89, 0xa0, 0xa2, 0x47, 0xf9 },
+	{ 0x35, 0x72, 0x44, 0x82, 0x25, 0x2d, 0x44, 0x16, 0x3d, 0xa0, 0xc8, 0x13, 0xf0, 0xa5, 0xc5, 0xce },
+	{ 0x4f, 0xae, 0xd0, 0x5e, 0x60, 0xf3, 0x19, 0xfd, 0xe7, 0xcf, 0x0b, 0x97, 0x51, 0x6a, 0x6f, 0x16 },
+	{ 0xee, 0xb4, 0xdc, 0x3d, 0xdc, 0xe2, 0x4a, 0xc8, 0x9e, 0xe0, 0x93, 0x04, 0x2b, 0x47, 0x77, 0x23 },
+	{ 0xd2, 0x41, 0x55, 0x6d, 0xbb, 0x60, 0x8b, 0x43, 0x22, 0x34, 0x92, 0x3a, 0x3a, 0x64, 0x82, 0xd2 },
+	{ 0x61, 0x8c, 0x58, 0x2a, 0xff, 0x22, 0x23, 0xb9, 0x49, 0xba, 0x83, 0x8c, 0x52, 0x1c, 0xa8, 0xdc },
+	{ 0x1b, 0xcd, 0x4b, 0x31, 0x6e, 0xc7, 0x0d, 0x1a, 0x93, 0xdf, 0x33, 0x70, 0x01, 0x0b, 0x55, 0x29 },
+	{ 0xef, 0x30, 0x20, 0x48, 0x90, 0x2a, 0x09, 0xc4, 0x87, 0x73, 0xa7, 0x84, 0x7b, 0xfc, 0x2d, 0xbf },
+	{ 0x08, 0x73, 0x80, 0x5b, 0x1b, 0x50, 0x46, 0x62, 0x48, 0x62, 0xa8, 0xfa, 0xaf, 0xa3, 0x65, 0xc7 },
+	{ 0xc1, 0xdf, 0x10, 0xac, 0xd0, 0x78, 0x40, 0x83, 0xa9, 0xdc, 0x2d, 0xc5, 0x89, 0x67, 0x00, 0xa8 },
+	{ 0x39, 0x77, 0xce, 0xf5, 0x74, 0x05, 0xb7, 0x3c, 0xe1, 0x08, 0xf4, 0x80, 0x81, 0x0c, 0x95, 0x83 },
+	{ 0x61, 0x4d, 0xe4, 0x4a, 0x81, 0xf6, 0xb5, 0x12, 0x49, 0x63, 0xec, 0x45, 0x64, 0x68, 0xca, 0x0a },
+	{ 0xb3, 0x06, 0x13, 0x54, 0x81, 0x21, 0xaa, 0xed, 0xeb, 0x5a, 0xe1, 0x3c, 0x1a, 0x1c, 0x97, 0x96 },
+	{ 0x89, 0xf9, 0x01, 0x0b, 0x8f, 0x74, 0xc1, 0x79, 0xb1, 0x83, 0x2a, 0x31, 0xa8, 0xa1, 0x16, 0x06 },
+	{ 0x90, 0x44, 0x2f, 0x86, 0xf3, 0x62, 0x30, 0xbe, 0x10, 0xc7, 0x33, 0x5f, 0x45, 0xd5, 0x97, 0x49 },
+	{ 0xec, 0x7d, 0xe1, 0x49, 0xf6, 0x26, 0x61, 0x2a, 0xcc, 0x63, 0xd5, 0xbd, 0x9b, 0x28, 0x2c, 0x1a },
+	{ 0xa5, 0x81, 0x05, 0x26, 0x2f, 0xb0, 0xfa, 0x35, 0x2d, 0x4d, 0x09, 0x68, 0xe8, 0x15, 0x00, 0x9d },
+	{ 0x7f, 0xe2, 0xea, 0xc4, 0x08, 0x7b, 0xe5, 0xfd, 0x97, 0x6f, 0xcf, 0xe9, 0x94, 0xd8, 0x15, 0x1f },
+	{ 0x46, 0x56, 0xa0, 0x84, 0x14, 0xbc, 0xb4, 0x89, 0xb6, 0x49, 0xfe, 0xfb, 0xc3, 0x3a, 0x8c, 0x55 },
+	{ 0x89, 0x38, 0x76, 0xea, 0x0c, 0xa1, 0x2e, 0x20, 0xb1, 0xda, 0xc1, 0x77, 0x96, 0x55, 0xf4, 0xd7 },
+	{ 0x5c, 0xcc, 0x16, 0xcd, 0x7d, 0xd6, 0x84, 0xf0, 0xbc, 0x67, 0xad, 0x58, 0x82, 0x4c, 0x44, 0xba },
+	{ 0xef, 0xf1, 0xab, 0x68, 0x12, 0xfe, 0x9b, 0x1d, 0x87, 0x1c, 0x10, 0x3e, 0x8d, 0x48, 0x50, 0xed },
+	{ 0x9f, 0x30, 0x04, 0x74, 0x7a, 0x62, 0x24, 0x3a, 0xb7, 0x4a, 0x42, 0x47, 0x78, 0xff, 0xf0, 0x98 },
+	{ 0xd0, 0x0a, 0x5a, 0x79, 0xd5, 0xa4, 0xa1, 0xa5, 0x50, 0xb7, 0xd3, 0xf3, 0xaa, 0x45, 0x37, 0xc9 },
+	{ 0x54, 0x05, 0xa6, 0x47, 0x65, 0xa0, 0x57, 0xb0, 0x74, 0x91, 0x90, 0xaa, 0x94, 0x63, 0x0c, 0xdb },
+	{ 0xa1, 0x67, 0xff, 0x67, 0x60, 0x1e, 0x0e, 0xd8, 0x89, 0xc7, 0x00, 0x8e, 0x07, 0x1e, 0x3c, 0xa2 },
+	{ 0x6b, 0xf7, 0x5f, 0x9a, 0x82, 0x02, 0xe6, 0x12, 0x63, 0x42, 0x53, 0x87, 0xa3, 0x2a, 0x7b, 0xdb },
+	{ 0x57, 0x21, 0x51, 0xba, 0x7b, 0x43, 0x60, 0x5f, 0x2f, 0x32, 0xb4, 0x91, 0x01, 0x0e, 0xd5, 0xdd },
+	{ 0xfe, 0x46, 0xed, 0xca, 0x15, 0x9d, 0xf0, 0xae, 0x2e, 0x31, 0x70, 0x46, 0x4d, 0x49, 0x70, 0x9a },
+	{ 0x5b, 0xd2, 0xea, 0x03, 0xce, 0x35, 0xec, 0xa7, 0xd3, 0x26, 0x6b, 0x4b, 0x55, 0x2f, 0xd2, 0x7a },
+	{ 0xa3, 0x4a, 0x0a, 0x32, 0x49, 0xf4, 0x10, 0x98, 0x5b, 0xd0, 0x4a, 0x21, 0x59, 0xf7, 0xb4, 0x93 },
+	{ 0x51, 0xd0, 0x4f, 0x08, 0xc7, 0xf5, 0x89, 0x63, 0xb9, 0x2f, 0xed, 0x70, 0x91, 0xf7, 0xc5, 0xd9 },
+	{ 0x5b, 0x26, 0xdb, 0x2d, 0xcb, 0x1b, 0xd3, 0x85, 0xd3, 0x9a, 0xdf, 0xfe, 0x92, 0x74, 0xa4, 0x92 },
+	{ 0xf1, 0x52, 0x9f, 0xf1, 0xf6, 0x2c, 0x79, 0x2a, 0x59, 0xd3, 0x88, 0x5e, 0xbb, 0x89, 0x84, 0x82 },
+	{ 0xfb, 0x7e, 0x32, 0x82, 0xfc, 0xdf, 0xce, 0xdd, 0x73, 0x04, 0xc1, 0x12, 0x1e, 0xe4, 0x79, 0xaf },
+	{ 0xdc, 0xeb, 0xd0, 0xbc, 0xbc, 0x6c, 0xbb, 0x43, 0x3c, 0x13, 0xf9, 0x7b, 0x79, 0x26, 0x33, 0xa3 },
+	{ 0xfd, 0xb5, 0x2d, 0x76, 0xe2, 0x9b, 0xb8, 0x7b, 0x45, 0x81, 0x7f, 0x59, 0xad, 0x02, 0xc5, 0xb8 },
+	{ 0x33, 0x3b, 0x49, 0x8e, 0x3f, 0x71, 0x5a, 0x78, 0x6b, 0x23, 0x0a, 0xcd, 0x60, 0x87, 0x7a, 0xc5 },
+	{ 0x54, 0x1a, 0x22, 0x92, 0xe4, 0x59, 0xd1, 0xe7, 0x74, 0xae, 0x6d, 0x17, 0xe4, 0xf4, 0x00, 0x21 },
+	{ 0xd8, 0x3e, 0x66, 0xf5, 0x72, 0xc8, 0x7a, 0x61, 0x98, 0xc2, 0xe4, 0xa7, 0x6c, 0x35, 0xbf, 0xbe },
+	{ 0xaf, 0xd7, 0x90, 0x4b, 0x33, 0xd6, 0x43, 0x58, 0x47, 0xb8, 0xfb, 0xf5, 0xe9, 0x92, 0xde, 0x55 },
+	{ 0x2a, 0x22, 0x8d, 0x93, 0x71, 0x66, 0x62, 0xab, 0x3a, 0xf4, 0x93, 0x78, 0xc1, 0x0b, 0x75, 0xd6 },
+	{ 0xa4, 0x44, 0x36, 0xfb, 0xf8, 0x94, 0xa9, 0xe0, 0x44, 0x11, 0x8d, 0x2e, 0x86, 0x14, 0x27, 0xd3 },
+	{ 0x69, 0x96, 0x6c, 0x11, 0x9e, 0xd3, 0x08, 0x06, 0x91, 0x8b, 0xda, 0x66, 0x75, 0xe9, 0x46, 0x46 },
+	{ 0xb4, 0x82, 0x56, 0x5e, 0x35, 0x69, 0x68, 0xe9, 0xd4, 0xed, 0xf4, 0xbc, 0x6a, 0xd1, 0x4d, 0x32 },
+	{ 0xb7, 0x9e, 0x01, 0xd1, 0x4b, 0x0c, 0x71, 0x98, 0x8f, 0x8e, 0x18, 0xa4, 0xd7, 0x7b, 0x16, 0x35 },
+	{ 0xf4, 0x72, 0x79, 0xe6, 0x15, 0x1e, 0xcd, 0x3f, 0x14, 0x18, 0x4f, 0x2b, 0x6f, 0x64, 0xd6, 0x3d },
+	{ 0xf2, 0xb9, 0x66, 0xb1, 0x2b, 0xbb, 0xbd, 0xee, 0x42, 0x49, 0xbf, 0x71, 0xbc, 0xad, 0x46, 0xd8 },
+	{ 0xc0, 0xa2, 0x41, 0x81, 0x9a, 0x5d, 0xef, 0x2d, 0xc0, 0xa0, 0xb1, 0x8b, 0x27, 0x66, 0x27, 0xde },
+	{ 0xac, 0x24, 0x52, 0x4d, 0x99, 0xd2, 0x9b, 0xbe, 0x8c, 0xa8, 0x29, 0x2f, 0x0a, 0xbf, 0xdc, 0xb0 },
+	{ 0x42, 0x7b, 0x0e, 0xa6, 0xc3, 0x56, 0x35, 0xd2, 0x12, 0x1b, 0x8d, 0x68, 0xd1, 0xf6, 0xa5, 0x2c },
+	{ 0x09, 0x58, 0x30, 0xda, 0x4b, 0x37, 0x65, 0x73, 0x31, 0x86, 0x0d, 0x9b, 0x8d, 0x2f, 0xe3, 0xc0 },
+	{ 0x55, 0x14, 0x4e, 0x5b, 0x94, 0xfa, 0x69, 0x30, 0x5d, 0xef, 0xaf, 0x24, 0x11, 0x12, 0x73, 0x60 },
+	{ 0xf2, 0xce, 0xe2, 0xfb, 0xaa, 0x74, 0x37, 0x26, 0x42, 0x66, 0x9c, 0xde, 0x0b, 0x3f, 0x3b, 0x1e },
+	{ 0x22, 0x18, 0x79, 0xac, 0xd2, 0xb5, 0x7c, 0x5e, 0xf2, 0x22, 0x3d, 0x9e, 0x9e, 0x3e, 0xd6, 0x6c },
+	{ 0xe3, 0x64, 0x25, 0x4f, 0x28, 0x1c, 0x69, 0x5d, 0x9b, 0x34, 0x5f, 0x69, 0xfc, 0xac, 0x26, 0x2b },
+	{ 0xab, 0x26, 0xf7, 0x01, 0xe1, 0xe3, 0xb7, 0x0f, 0xa3, 0xc3, 0x44, 0x3c, 0x96, 0x71, 0xe1, 0xb8 },
+	{ 0x55, 0xd5, 0xd9, 0x7b, 0x16, 0xce, 0xfc, 0x89, 0x5d, 0x98, 0x18, 0xde, 0x22, 0x5e, 0x95, 0x8e },
+	{ 0xd9, 0xf9, 0x1d, 0xdf, 0xa4, 0x3c, 0xa6, 0x03, 0x81, 0xac, 0x8f, 0x6e, 0xab, 0x9e, 0x53, 0x2c },
+	{ 0xbd, 0xef, 0x02, 0x83, 0x00, 0x5a, 0x47, 0x94, 0x05, 0x91, 0xdf, 0xc4, 0x47, 0x92, 0x25, 0x39 },
+	{ 0x13, 0xc3, 0x37, 0x4a, 0xcf, 0x16, 0x28, 0xcd, 0x4b, 0x0e, 0xdd, 0x95, 0xde, 0x3d, 0xb6, 0xbf },
+	{ 0x69, 0xab, 0xe8, 0x5b, 0x1d, 0x8d, 0x82, 0x3d, 0x91, 0xa8, 0xb7, 0xd3, 0xc4, 0x7a, 0x3b, 0x8c },
+	{ 0x6e, 0x95, 0x22, 0x4e, 0x9d, 0x4c, 0x14, 0x75, 0x1e, 0x35, 0x48, 0xe1, 0x33, 0x6d, 0x88, 0x3a },
+	{ 0xa7, 0x79, 0x8c, 0x3a, 0x97, 0x3f, 0x77, 0x2d, 0xff, 0x72, 0x30, 0x68, 0x89, 0x80, 0x6d, 0xd4 },
+	{ 0x7b, 0xdd, 0x60, 0x51, 0xb9, 0xa2, 0x72, 0xd7, 0xf3, 0x06, 0xa4, 0x7c, 0x03, 0x72, 0x46, 0x6a },
+	{ 0xf9, 0x71, 0x2f, 0x23, 0x15, 0x97, 0xd8, 0xae, 0xa1, 0xc1, 0xbc, 0xa5, 0x2d, 0xe8, 0x17, 0x32 },
+	{ 0xb0, 0x68, 0x50, 0xa0, 0x66, 0xd7, 0x7b, 0x8b, 0x30, 0x68, 0xec, 0xe2, 0x89, 0xd9, 0x89, 0x37 },
+	{ 0x23, 0x7f, 0x40, 0x6c, 0x07, 0x44, 0xc1, 0x22, 0xdb, 0x98, 0x73, 0xb1, 0x9f, 0x62, 0x98, 0xc2 },
+	{ 0x26, 0xc9, 0x12, 0xf6, 0x24, 0xa8, 0x08, 0xa7, 0x96, 0x17, 0xf4, 0x57, 0xf2, 0x5f, 0xd3, 0x09 },
+	{ 0x0f, 0x55, 0x41, 0x62, 0x03, 0x9f, 0x54, 0x91, 0xa7, 0x14, 0x60, 0x08, 0xc0, 0x00, 0x20, 0xad },
+	{ 0xcf, 0x4f, 0xa2, 0x8f, 0xa3, 0x30, 0x76, 0x03, 0x67, 0xcd, 0x28, 0x2d, 0x6c, 0xdc, 0xa2, 0x5b },
+	{ 0x57, 0xa3, 0x68, 0xfb, 0x7f, 0xea, 0x85, 0x12, 0x2f, 0x84, 0x85, 0x04, 0x25, 0xa6, 0x19, 0x3a },
+	{ 0x87, 0x01, 0x7b, 0xf6, 0x26, 0xe5, 0x44, 0x82, 0xdf, 0x5d, 0x03, 0x31, 0x07, 0x37, 0xa9, 0xce },
+	{ 0xff, 0x16, 0x21, 0xff, 0xc6, 0xca, 0x95, 0x88, 0x17, 0x38, 0xf8, 0x79, 0xdb, 0x43, 0xf9, 0x4d },
+	{ 0x1f, 0x3b, 0x42, 0x19, 0x3a, 0x3f, 0xe1, 0x55, 0x37, 0xd9, 0xb0, 0xfd, 0x1f, 0x48, 0xeb, 0x3b },
+	{ 0x12, 0x47, 0xf4, 0x3f, 0x1b, 0xcf, 0x69, 0xd1, 0x62, 0x7b, 0xc9, 0x15, 0x8e, 0x88, 0xff, 0x23 },
+	{ 0x60, 0xbc, 0x24, 0xf6, 0x4d, 0xf5, 0x7d, 0xdf, 0x60, 0xb3, 0xfb, 0x58, 0xc4, 0x21, 0x1f, 0x29 },
+	{ 0x9e, 0x8a, 0xc8, 0xd4, 0xc7, 0xa7, 0x72, 0xcf, 0xce, 0x7d, 0x74, 0xed, 0x88, 0x27, 0x51, 0x71 },
+	{ 0x48, 0xb7, 0x93, 0x0d, 0xf9, 0xea, 0x91, 0x96, 0x88, 0x00, 0x77, 0x1c, 0xf2, 0x7b, 0xc0, 0xea },
+	{ 0x35, 0x33, 0xd0, 0xa2, 0xa7, 0x00, 0xd7, 0x6f, 0x3d, 0x49, 0x31, 0xcd, 0x01, 0xf2, 0xe7, 0xfc },
+	{ 0x98, 0x78, 0x3b, 0x02, 0x91, 0x86, 0x09, 0x7a, 0x58, 0xd2, 0x44, 0x13, 0x07, 0xc5, 0x1f, 0x3f },
+	{ 0x9d, 0x62, 0x75, 0xf4, 0x10, 0x46, 0x9b, 0xb1, 0xe5, 0x5e, 0xd5, 0x20, 0x76, 0xb7, 0x6c, 0xed },
+	{ 0x0b, 0x3b, 0x3b, 0xa4, 0x34, 0x0d, 0x68, 0x33, 0x03, 0x8f, 0x57, 0x2e, 0xdf, 0x08, 0x5c, 0xb2 },
+	{ 0x09, 0x82, 0x28, 0x6f, 0x4a, 0xaa, 0x58, 0xe2, 0x31, 0xc0, 0xc7, 0x74, 0x2c, 0x52, 0xcc, 0x4c },
+	{ 0xf1, 0xd4, 0xb6, 0x32, 0xfb, 0xd3, 0x9e, 0xdd, 0x59, 0x25, 0x5a, 0xd1, 0xde, 0x21, 0xc9, 0xde },
+	{ 0xac, 0x78, 0x42, 0x77, 0x96, 0xb8, 0x82, 0x9c, 0x8c, 0x1c, 0x9e, 0xe2, 0x47, 0x04, 0xaf, 0xc8 },
+	{ 0xc2, 0x70, 0xd0, 0x00, 0x04, 0x7a, 0x78, 0xb6, 0x92, 0x8c, 0x1e, 0xb2, 0x29, 0xae, 0xab, 0x89 },
+	{ 0x28, 0x54, 0xfe, 0x13, 0x08, 0x4a, 0xd9, 0x22, 0x68, 0x08, 0x27, 0x52, 0xbf, 0xc3, 0xf0, 0x2a },
+	{ 0xb2, 0xde, 0xbf, 0x73, 0xca, 0xbf, 0xd2, 0xcf, 0x02, 0x3c, 0x42, 0x70, 0x07, 0xac, 0xb2, 0x12 },
+	{ 0x82, 0x41, 0x39, 0x99, 0xa5, 0x98, 0xa6, 0xb9, 0x52, 0x0b, 0x2d, 0xfd, 0x36, 0x67, 0x45, 0xac },
+	{ 0x4e, 0xf3, 0x18, 0x75, 0x2e, 0x7f, 0xee, 0x5a, 0xfe, 0xe5, 0x60, 0xd0, 0x12, 0x01, 0xdb, 0xa8 },
+	{ 0xad, 0x09, 0x02, 0xcc, 0xc9, 0xb9, 0xba, 0xcf, 0x75, 0xcc, 0x8e, 0xcf, 0xe7, 0x4a, 0x5a, 0xaa },
+	{ 0xb9, 0xab, 0x04, 0x30, 0x33, 0x55, 0x67, 0xc7, 0x61, 0xd1, 0x1c, 0x11, 0xc8, 0x77, 0x78, 0xb2 },
+	{ 0x8e, 0xe3, 0x3b, 0xfd, 0x0e, 0x34, 0x53, 0xb1, 0x3e, 0x10, 0xbb, 0x3e, 0x17, 0x94, 0x63, 0xb4 },
+	{ 0x95, 0x04, 0x71, 0xe3, 0x74, 0xaf, 0xce, 0x86, 0x9d, 0x19, 0x0a, 0x93, 0x15, 0xa5, 0xfb, 0x6b },
+	{ 0x2e, 0x7b, 0x07, 0x31, 0xbe, 0x24, 0xbc, 0xaf, 0xde, 0xd0, 0x33, 0x99, 0x90, 0xb7, 0x16, 0xa3 },
+	{ 0x5f, 0x40, 0xe1, 0xeb, 0x99, 0xad, 0xbf, 0xe3, 0x77, 0x20, 0xe8, 0xd8, 0x73, 0x6c, 0x68, 0x8d },
+	{ 0x15, 0xe5, 0xb6, 0xf3, 0x35, 0x19, 0x98, 0x33, 0x1d, 0x6e, 0xbe, 0x6f, 0x1e, 0xcb, 0x0c, 0x83 },
+	{ 0x7c, 0x59, 0xa4, 0x5b, 0x6d, 0xea, 0x30, 0xd3, 0xdc, 0x99, 0xb7, 0xfc, 0x53, 0x27, 0xfd, 0x05 },
+	{ 0xa7, 0xe2, 0xf8, 0xae, 0x13, 0xdf, 0xd7, 0x42, 0xff, 0x03, 0x82, 0x88, 0x16, 0x57, 0x34, 0x32 },
+	{ 0x84, 0x8d, 0xb0, 0xd7, 0x0a, 0x0e, 0x0a, 0x8f, 0x24, 0xa5, 0xc8, 0xb0, 0x15, 0x17, 0x85, 0xfb },
+	{ 0x36, 0x18, 0x80, 0x21, 0xd8, 0xe7, 0xf5, 0x80, 0x26, 0x6d, 0x96, 0x6d, 0xdf, 0x7d, 0x65, 0xf6 },
+	{ 0x56, 0x51, 0x1d, 0x86, 0xca, 0x15, 0xbb, 0x85, 0x46, 0x2b, 0x2c, 0x5e, 0x73, 0x13, 0x4c, 0x2a },
+	{ 0xc5, 0xf9, 0x16, 0x6a, 0x9f, 0x0a, 0x2d, 0xe1, 0x4d, 0x62, 0x36, 0x9f, 0x6a, 0x5f, 0xc4, 0xa2 },
+	{ 0x29, 0xbb, 0xc5, 0xd3, 0x3c, 0xd8, 0x1d, 0xe7, 0x51, 0x7e, 0x5d, 0x65, 0xc0, 0xe7, 0xb2, 0x80 },
+	{ 0x3e, 0xf8, 0x9b, 0x73, 0x78, 0x25, 0xe8, 0x5e, 0x6e, 0x04, 0x33, 0x6e, 0x63, 0x28, 0x1b, 0xd4 },
+	{ 0xdc, 0x6d, 0xe8, 0xfd, 0xc0, 0x13, 0xe1, 0xf6, 0x3c, 0x65, 0xca, 0xee, 0x9c, 0xbe, 0x77, 0xff },
+	{ 0x37, 0x6a, 0xcb, 0x96, 0x8d, 0xbc, 0xc0, 0x0d, 0x0f, 0xc6, 0xef, 0x13, 0x91, 0x10, 0x33, 0x06 },
+	{ 0x0e, 0xc4, 0x81, 0x0d, 0xd0, 0x9d, 0x1c, 0x5e, 0xbe, 0x64, 0x6f, 0x1b, 0x20, 0xba, 0x74, 0xcb },
+	{ 0x52, 0x61, 0x0f, 0x5d, 0xfa, 0xf6, 0xc1, 0x96, 0xa2, 0xdf, 0xdd, 0x5d, 0x31, 0x3e, 0x71, 0xbb },
+	{ 0x44, 0x88, 0x11, 0x05, 0xab, 0x9f, 0x2b, 0x01, 0xe4, 0x5d, 0x91, 0xd5, 0xc1, 0xf2, 0x07, 0xaa },
+	{ 0x49, 0x09, 0xdf, 0x82, 0xae, 0xbf, 0x5c, 0x23, 0x71, 0x59, 0xd0, 0xc2, 0xa3, 0x0e, 0x8e, 0xfa },
+	{ 0x5a, 0x41, 0x2b, 0xaf, 0x9a, 0x34, 0xb4, 0x74, 0xea, 0x76, 0x7a, 0x5e, 0xb5, 0xe8, 0x26, 0x99 },
+	{ 0x0b, 0x50, 0xb7, 0xee, 0xb3, 0xc6, 0xe1, 0x6a, 0x03, 0xac, 0x34, 0x9b, 0x2e, 0x9a, 0x50, 0xf8 },
+	{ 0xec, 0x92, 0x5d, 0x94, 0x75, 0xe0, 0xda, 0x61, 0xcc, 0x80, 0xb2, 0x2a, 0xeb, 0xb9, 0x20, 0x60 },
+	{ 0xcf, 0x8e, 0x16, 0x6f, 0x21, 0x5d, 0xe3, 0xa9, 0x67, 0x24, 0xc0, 0x73, 0x5a, 0x90, 0x80, 0x2d },
+	{ 0x25, 0xb6, 0x3b, 0x60, 0xed, 0xff, 0xaa, 0xc0, 0xad, 0x15, 0x32, 0xf8, 0x2e, 0x81, 0xe3, 0xcb },
+	{ 0x07, 0x0c, 0xb9, 0x9b, 0xe6, 0xc1, 0x01, 0x9e, 0x5f, 0xec, 0x71, 0xe7, 0xae, 0x7f, 0xa3, 0x71 },
+	{ 0xda, 0x60, 0xe5, 0x9e, 0xd9, 0xca, 0xea, 0xc7, 0x6a, 0x22, 0xc6, 0x81, 0xac, 0xc2, 0x15, 0x82 },
+	{ 0xe0, 0xdb, 0xde, 0xe5, 0x8c, 0x8b, 0xb4, 0x32, 0xe0, 0x5e, 0x47, 0x7c, 0xbb, 0xfb, 0x0d, 0x12 },
+	{ 0x19, 0xc0, 0x48, 0xd2, 0x86, 0x7e, 0x17, 0xeb, 0xc1, 0x9c, 0x2f, 0x03, 0x11, 0x0f, 0xf3, 0xab },
+	{ 0x2f, 0xb8, 0xd6, 0x5b, 0xf4, 0x3f, 0x0d, 0x05, 0xc7, 0x0c, 0xb0, 0xd2, 0xf2, 0xb8, 0xef, 0x6c },
+	{ 0x20, 0x20, 0xf2, 0x97, 0x6a, 0x26, 0x00, 0x67, 0x20, 0xfd, 0x15, 0x9e, 0xfd, 0xd3, 0x68, 0x35 },
+	{ 0x06, 0x51, 0x01, 0xb2, 0xb4, 0x4d, 0xd6, 0xfb, 0x76, 0x02, 0xc7, 0x20, 0x70, 0x16, 0x0f, 0x04 },
+	{ 0x81, 0x2e, 0x62, 0x03, 0x6e, 0xf0, 0x48, 0xd3, 0x69, 0x09, 0x6b, 0x9d, 0x73, 0x88, 0x55, 0x6e },
+	{ 0x69, 0xea, 0x5c, 0x3b, 0x9b, 0xb9, 0xef, 0xe3, 0x91, 0xff, 0x4e, 0x1a, 0xb3, 0x2e, 0x19, 0x5e },
+	{ 0x81, 0xda, 0x71, 0xd9, 0x70, 0x0a, 0x62, 0xf5, 0x69, 0x95, 0xf6, 0xe9, 0x35, 0x43, 0x83, 0x56 },
+	{ 0x46, 0xe9, 0x04, 0x8e, 0x8f, 0xce, 0x08, 0x0e, 0xb6, 0x14, 0x0a, 0xf6, 0xef, 0x33, 0x3c, 0x3f },
+	{ 0xd3, 0xfc, 0x0c, 0x57, 0xed, 0xd4, 0xb6, 0xe5, 0x0b, 0x1e, 0x3d, 0x01, 0x79, 0xcd, 0x16, 0x40 },
+	{ 0xbf, 0x7e, 0x1d, 0x23, 0xec, 0x49, 0x63, 0x76, 0xd7, 0x25, 0xb5, 0xa4, 0x5b, 0x26, 0xcc, 0x12 },
+	{ 0x1c, 0x73, 0x87, 0xd0, 0x20, 0x82, 0xbf, 0x84, 0x7c, 0xac, 0x01, 0xca, 0xf0, 0xe2, 0xf4, 0x50 },
+	{ 0x22, 0x9a, 0x90, 0xed, 0xd6, 0x5c, 0xa2, 0x11, 0xf2, 0x74, 0x0e, 0x11, 0xc2, 0xd6, 0x1a, 0xc9 },
+	{ 0x1a, 0xcf, 0xf0, 0xe5, 0xb5, 0xd8, 0x29, 0x6b, 0xaa, 0xfa, 0x4e, 0x7d, 0x8d, 0xbd, 0x59, 0x31 },
+	{ 0x63, 0xae, 0xd7, 0xd3, 0x65, 0x25, 0x93, 0x1f, 0x1b, 0x1a, 0x65, 0x66, 0x92, 0xa9, 0xfe, 0x9f },
+	{ 0x32, 0x80, 0x91, 0xa4, 0x0d, 0xfd, 0x2e, 0xd6, 0x82, 0x39, 0x5f, 0x06, 0x22, 0x1e, 0xe6, 0x57 },
+	{ 0xcb, 0x20, 0x20, 0x87, 0x55, 0xe5, 0x0f, 0x6e, 0xc3, 0x2a, 0x43, 0xe6, 0x3b, 0x53, 0xea, 0x1a },
+	{ 0x73, 0x55, 0x64, 0xab, 0x1e, 0x99, 0xb2, 0x3d, 0xab, 0x87, 0x1e, 0x15, 0x04, 0x3d, 0xec, 0x5c },
+	{ 0xfa, 0x2c, 0xe7, 0x0c, 0x47, 0x0b, 0x04, 0x51, 0x8a, 0xab, 0x67, 0x6c, 0x6c, 0x51, 0xac, 0x9f },
+	{ 0xa8, 0x73, 0xb8, 0x03, 0x47, 0xe0, 0x0f, 0x76, 0xe8, 0xb3, 0x72, 0x75, 0xb6, 0x9d, 0xdf, 0x13 },
+	{ 0xe2, 0x12, 0xda, 0xd9, 0x72, 0x47, 0x9e, 0xd0, 0xb2, 0xdb, 0x05, 0xc3, 0x4a, 0x1a, 0x59, 0x1b },
+	{ 0x0a, 0xfe, 0x6b, 0x79, 0xfe, 0xf1, 0x16, 0xde, 0x1a, 0x53, 0xdb, 0xf4, 0x7c, 0x07, 0x83, 0xe8 },
+	{ 0x4c, 0xd1, 0x99, 0xcb, 0xc7, 0x7c, 0x7e, 0xf4, 0x2c, 0x86, 0x7f, 0xf6, 0xd2, 0x73, 0x84, 0xe5 },
+	{ 0x92, 0x27, 0x3a, 0x50, 0xdc, 0x38, 0x33, 0x7e, 0xe2, 0xcf, 0x7d, 0xf2, 0x96, 0xae, 0x10, 0x3b },
+	{ 0x8f, 0x5f, 0x7f, 0x07, 0xc3, 0x7b, 0x11, 0xad, 0x27, 0xa3, 0xce, 0xbe, 0x67, 0x49, 0x1a, 0x50 },
+	{ 0xa6, 0xfd, 0x48, 0x30, 0xe3, 0xf7, 0xb8, 0x31, 0x16, 0xe0, 0x1c, 0xe8, 0x38, 0xcb, 0xb6, 0x38 },
+	{ 0x7e, 0x27, 0x33, 0xdb, 0xd6, 0x06, 0xba, 0x5b, 0xae, 0x85, 0x24, 0x23, 0x56, 0x6f, 0x81, 0xb1 },
+	{ 0x68, 0xf0, 0x30, 0x72, 0xeb, 0x18, 0x57, 0x9b, 0xa8, 0xbe, 0x0c, 0x0d, 0x86, 0x11, 0xa7, 0x1e },
+	{ 0x7d, 0xab, 0xef, 0xd0, 0x22, 0xbf, 0xfb, 0x5f, 0xc5, 0xf2, 0x10, 0xa3, 0x05, 0xba, 0xca, 0x15 },
+	{ 0xbd, 0x9b, 0x12, 0x59, 0x03, 0x74, 0x60, 0xb6, 0x05, 0x1d, 0x6b, 0x11, 0x0a, 0x4d, 0x53, 0x21 },
+	{ 0x99, 0xb5, 0x0a, 0x2d, 0xc7, 0xa1, 0x5a, 0xcf, 0x41, 0x0e, 0xc1, 0x4c, 0x69, 0xc6, 0xf8, 0x08 },
+	{ 0x1d, 0x6d, 0xb3, 0x99, 0xd0, 0x22, 0x58, 0xcd, 0x65, 0xed, 0x43, 0xd7, 0x1d, 0x00, 0x67, 0x90 },
+	{ 0x43, 0x36, 0xc6, 0x8f, 0xf5, 0xca, 0x60, 0x74, 0xfb, 0x04, 0x38, 0x2f, 0x10, 0x60, 0x3a, 0x9a },
+	{ 0x8c, 0xd6, 0x38, 0x9e, 0x27, 0xeb, 0x5c, 0x82, 0x6c, 0xcd, 0xb6, 0xd1, 0x26, 0x98, 0x01, 0x37 },
+	{ 0x67, 0x74, 0xed, 0x67, 0x37, 0xd1, 0x98, 0x9f, 0xbf, 0x2b, 0xf9, 0x8c, 0x35, 0x5c, 0xf0, 0x82 },
+	{ 0x12, 0x5c, 0x70, 0x8a, 0x9a, 0x88, 0xe3, 0x08, 0x62, 0x98, 0xa6, 0x82, 0xdd, 0x19, 0xf4, 0x69 },
+	{ 0xcd, 0xab, 0x0b, 0xa5, 0x38, 0x87, 0xe0, 0xe9, 0x95, 0x1b, 0x76, 0xe0, 0x08, 0xb7, 0x07, 0x3c },
+	{ 0x74, 0xbc, 0x2b, 0x6b, 0x53, 0x27, 0xf7, 0x01, 0x94, 0xfd, 0x54, 0x28, 0x05, 0x61, 0xae, 0xb2 },
+	{ 0x2d, 0xc0, 0x4f, 0x47, 0x8c, 0xb0, 0x90, 0x0d, 0xf5, 0xe6, 0x88, 0xd2, 0x51, 0x4e, 0x82, 0x35 },
+	{ 0xb1, 0xf9, 0x0f, 0xf5, 0x99, 0xd8, 0xb3, 0xbe, 0x19, 0x18, 0xdd, 0xcf, 0x29, 0x20, 0x35, 0x19 },
+	{ 0xe7, 0xe7, 0x97, 0x81, 0x73, 0x4d, 0xb6, 0xd0, 0x3f, 0x4b, 0xb9, 0x63, 0x6a, 0x7b, 0xb1, 0x83 },
+	{ 0x3b, 0x5a, 0xd9, 0xbf, 0x5d, 0xdb, 0xb9, 0xfc, 0xb3, 0x11, 0x3e, 0x14, 0xd3, 0xe5, 0x0d, 0x75 },
+	{ 0x33, 0xfc, 0xd4, 0xae, 0xc1, 0x44, 0xed, 0xd1, 0x6b, 0xcc, 0x72, 0x86, 0x72, 0xd3, 0x9c, 0xf3 },
+	{ 0xa4, 0xc6, 0x4d, 0x3c, 0xfd, 0x3b, 0xcf, 0x93, 0x44, 0x63, 0x5e, 0xa1, 0xa9, 0xac, 0x6b, 0x2f },
+	{ 0x2f, 0xcd, 0x52, 0xa6, 0x73, 0xf9, 0x86, 0x3c, 0xc7, 0x29, 0x8d, 0x3f, 0x42, 0x4a, 0xe4, 0xb2 },
+	{ 0x14, 0x15, 0x83, 0xbf, 0x84, 0xeb, 0xf2, 0x59, 0x34, 0x67, 0x36, 0x3c, 0x90, 0xd0, 0x83, 0xcf },
+	{ 0xe7, 0xa8, 0x23, 0xa2, 0xf5, 0x20, 0x49, 0x2a, 0x3f, 0xf4, 0x21, 0x1d, 0x7c, 0xc7, 0xd3, 0xb1 },
+	{ 0x02, 0xa0, 0x67, 0x68, 0x62, 0x5b, 0x4a, 0xb3, 0xd2, 0x0d, 0x10, 0x67, 0x1c, 0xf5, 0x11, 0x67 },
+	{ 0x3d, 0xa6, 0x50, 0xfe, 0xc2, 0x50, 0x1d, 0xd2, 0x85, 0xab, 0xd9, 0xc7, 0xb1, 0x95, 0x4d, 0xc4 },
+	{ 0xb4, 0xd6, 0x46, 0x88, 0x32, 0x4f, 0x4f, 0xc7, 0xd4, 0x61, 0x69, 0x70, 0xa8, 0x16, 0x20, 0x4a },
+	{ 0x62, 0xb4, 0xab, 0x0a, 0xb6, 0x84, 0xfa, 0xd6, 0x32, 0xd9, 0x22, 0x59, 0x65, 0x8c, 0x8c, 0x60 },
+	{ 0x61, 0x23, 0xec, 0xb5, 0x82, 0x83, 0xc2, 0xa3, 0x49, 0x29, 0x32, 0x6c, 0xc5, 0x45, 0xe1, 0x7e },
+	{ 0x95, 0x19, 0xed, 0x2d, 0xf4, 0x68, 0x48, 0xbe, 0x9d, 0x36, 0xe7, 0xff, 0x64, 0x36, 0xf0, 0xb1 },
+	{ 0xf7, 0x4f, 0xb0, 0x79, 0xae, 0x94, 0x68, 0x48, 0xcf, 0x61, 0xdb, 0xcb, 0xed, 0x5a, 0xc1, 0x6e },
+	{ 0x0d, 0x72, 0x36, 0x98, 0x1a, 0xc9, 0x51, 0xd1, 0xd5, 0x0b, 0x16, 0x75, 0x6e, 0x27, 0xa7, 0xbb },
+	{ 0x3e, 0x4c, 0x8c, 0x9d, 0x75, 0x0b, 0xcf, 0x3c, 0x6e, 0x78, 0xa7, 0x21, 0xa1, 0x6d, 0xed, 0xeb },
+	{ 0x73, 0x40, 0xe8, 0x60, 0x9f, 0xdf, 0x38, 0x06, 0xab, 0x6a, 0x41, 0xa8, 0xb4, 0xab, 0xf7, 0x16 },
+	{ 0x8f, 0x74, 0xfb, 0x51, 0x42, 0x35, 0x8b, 0xe4, 0x27, 0xc0, 0xab, 0x2b, 0xb7, 0xda, 0x0e, 0x96 },
+	{ 0x7d, 0x6c, 0x7b, 0xf1, 0xa4, 0x92, 0x8e, 0xb9, 0xc5, 0x9b, 0x79, 0x5c, 0x17, 0x06, 0xed, 0x43 },
+	{ 0x2a, 0x61, 0x01, 0x73, 0xef, 0x92, 0xcf, 0x51, 0x3a, 0x4b, 0x2b, 0xbf, 0xaf, 0xbf, 0x52, 0xa8 },
+	{ 0x73, 0xec, 0xf7, 0x36, 0xa2, 0xf9, 0x51, 0x28, 0xab, 0xf6, 0xcc, 0xf4, 0x76, 0x66, 0x25, 0xff },
+	{ 0xfd, 0x76, 0xb9, 0x96, 0x64, 0x6f, 0x4b, 0xd5, 0x45, 0x2a, 0xe8, 0x12, 0xbf, 0x4e, 0xe7, 0xe6 },
+	{ 0x0c, 0xf6, 0xf2, 0x8d, 0x66, 0x81, 0x93, 0xd5, 0xec, 0x78, 0x02, 0xf5, 0x1d, 0x72, 0xf0, 0x1f },
+	{ 0x62, 0x1d, 0x18, 0x7f, 0x32, 0x24, 0x5b, 0xec, 0x32, 0x6a, 0x74, 0x79, 0xf2, 0x62, 0x53, 0xbe },
+	{ 0x2d, 0x29, 0xbc, 0xbb, 0x08, 0x50, 0xf1, 0x22, 0xf5, 0x77, 0xda, 0xf2, 0xde, 0x24, 0x49, 0x93 },
+	{ 0xe8, 0x0f, 0xeb, 0x61, 0x2a, 0xaf, 0x8d, 0xee, 0x28, 0x6a, 0x58, 0x30, 0x7d, 0xeb, 0x95, 0x07 },
+	{ 0xa9, 0xb0, 0x87, 0x2e, 0x7d, 0xfb, 0x60, 0xcb, 0xd1, 0xef, 0xee, 0xae, 0x18, 0x9f, 0xb8, 0xdd },
+	{ 0x86, 0x70, 0xbb, 0xa1, 0xf3, 0xe3, 0x0c, 0x4f, 0xf6, 0xad, 0x12, 0x44, 0x67, 0xf0, 0xfd, 0xec },
+	{ 0xca, 0xe3, 0x50, 0x5c, 0x1f, 0xca, 0xbe, 0x18, 0xda, 0xee, 0xc6, 0xac, 0xd9, 0x51, 0x11, 0x51 },
+	{ 0xeb, 0x16, 0x1a, 0x8a, 0xc1, 0x98, 0x1c, 0x66, 0xe3, 0xed, 0x9e, 0xaa, 0x9a, 0x04, 0x6a, 0xc4 },
+	{ 0x4e, 0x32, 0x8d, 0x54, 0xac, 0xab, 0x5b, 0x01, 0xfe, 0x3c, 0xf8, 0x16, 0x01, 0xb5, 0xb8, 0x7a },
+	{ 0x3f, 0xdd, 0x4b, 0xf2, 0xa8, 0x0c, 0x07, 0x70, 0x57, 0x28, 0x98, 0x0e, 0x41, 0xb4, 0x98, 0xcd },
+	{ 0xe7, 0x7e, 0x2b, 0x0d, 0xf7, 0xad, 0x55, 0xbb, 0x3f, 0xba, 0x67, 0x43, 0xdd, 0xa4, 0xea, 0x25 },
+	{ 0x16, 0x8b, 0xf2, 0x92, 0xe8, 0xd3, 0x49, 0x9e, 0x06, 0x3b, 0x8c, 0xc9, 0x0d, 0xa3, 0xac, 0xaa },
+	{ 0x14, 0x54, 0xf7, 0x9e, 0x02, 0x18, 0x60, 0x00, 0x34, 0xbe, 0xcd, 0x82, 0x7e, 0x84, 0x61, 0xa1 },
+	{ 0xbe, 0x6b, 0x46, 0x8d, 0xb4, 0xa1, 0x05, 0x90, 0xee, 0x23, 0xf3, 0x44, 0x98, 0x47, 0xdc, 0xd4 },
+	{ 0xaa, 0x02, 0xd3, 0xa3, 0x32, 0xd0, 0x2b, 0x58, 0xba, 0x48, 0x48, 0x55, 0xca, 0x31, 0x86, 0xed },
+	{ 0x3b, 0x84, 0xd1, 0x54, 0x5c, 0x4e, 0xad, 0x6b, 0xb3, 0x4b, 0xf8, 0xed, 0x71, 0x08, 0xf7, 0x00 },
+	{ 0xf8, 0x34, 0x60, 0xf8, 0xde, 0x7b, 0x87, 0x59, 0xb8, 0x85, 0x40, 0x6c, 0xcb, 0xe6, 0x3e, 0x68 },
+	{ 0x6c, 0xb2, 0x17, 0x84, 0xb4, 0x76, 0x11, 0xb5, 0x4c, 0x2c, 0xfe, 0x4d, 0xe2, 0x93, 0x0f, 0x49 },
+	{ 0x70, 0xe1, 0x99, 0x8c, 0x02, 0xc2, 0x77, 0x4a, 0xf0, 0xce, 0xe3, 0x94, 0x12, 0x1d, 0xc8, 0x89 },
+	{ 0x73, 0x01, 0x74, 0x81, 0x21, 0xb3, 0xcb, 0x5f, 0xab, 0x13, 0xaa, 0x61, 0xc6, 0xf7, 0x19, 0x45 },
+	{ 0x4e, 0xb4, 0xa4, 0x95, 0xb0, 0x52, 0x81, 0xb4, 0xfe, 0x8e, 0xc9, 0x89, 0x24, 0x4d, 0xfd, 0xd6 },
+	{ 0x91, 0x6c, 0x82, 0x66, 0xaa, 0xc4, 0x07, 0xdc, 0xf9, 0xe5, 0xd2, 0x2b, 0x58, 0x45, 0x7c, 0xcd },
+	{ 0x13, 0x02, 0xac, 0x29, 0x4d, 0x43, 0x95, 0x73, 0x4b, 0x65, 0x74, 0xdc, 0xcc, 0xf1, 0x93, 0x91 },
+	{ 0xf7, 0x64, 0x2c, 0xc4, 0x2d, 0x4e, 0xe2, 0x7f, 0xcf, 0x7e, 0xb8, 0x38, 0x3d, 0xec, 0xb5, 0xb4 },
+	{ 0xe8, 0x39, 0xe3, 0xf6, 0x28, 0x22, 0x81, 0x5d, 0x28, 0xa4, 0x12, 0x0a, 0x1c, 0x0e, 0x7f, 0x93 },
+	{ 0x16, 0x0d, 0x0a, 0xd4, 0xec, 0x7a, 0x6f, 0x51, 0x06, 0x8d, 0x5d, 0x3c, 0x31, 0x3b, 0xf1, 0x06 },
+	{ 0x64, 0xc1, 0xae, 0x69, 0x9d, 0xcd, 0xf0, 0x05, 0x04, 0x1c, 0x27, 0xc6, 0x55, 0x88, 0xee, 0xdd },
+	{ 0xf9, 0xb0, 0xa3, 0x02, 0x93, 0xc3, 0x45, 0x55, 0xa1, 0x18, 0x54, 0xec, 0x1b, 0x9c, 0xf5, 0x03 },
+	{ 0x05, 0xc0, 0x41, 0x5d, 0x81, 0x4c, 0x9e, 0xc8, 0x8d, 0x52, 0xd6, 0x33, 0xd0, 0xcf, 0x63, 0x22 },
+	{ 0x05, 0x14, 0x32, 0x87, 0x7e, 0x32, 0x85, 0xa6, 0x8d, 0xc6, 0x4a, 0xe7, 0x0d, 0x15, 0x36, 0x3a },
+	{ 0xef, 0x45, 0x9c, 0x92, 0x0f, 0xe4, 0x82, 0xfb, 0x87, 0x90, 0x84, 0xf1, 0xca, 0x8d, 0x22, 0x05 },
+	{ 0x46, 0xaa, 0x90, 0xae, 0x11, 0xa2, 0x9b, 0x67, 0xb6, 0xbd, 0x72, 0xaf, 0x01, 0x80, 0x5e, 0x6d },
+	{ 0x9e, 0x9f, 0x44, 0x1f, 0x47, 0x61, 0xec, 0x06, 0xce, 0x9a, 0x51, 0x5a, 0xd8, 0xb8, 0x45, 0xb7 },
+	{ 0xfa, 0x41, 0x63, 0x57, 0xc6, 0xc4, 0x7d, 0x88, 0x8a, 0xc8, 0x44, 0xd9, 0xbb, 0xe2, 0xa0, 0xe5 },
+	{ 0xf4, 0xdb, 0xe5, 0x5a, 0x92, 0xbd, 0x2d, 0x55, 0x14, 0xa9, 0xa0, 0x4b, 0xfc, 0x3a, 0x9d, 0x9b },
+	{ 0xe2, 0xa9, 0x6d, 0x65, 0xf6, 0xa7, 0x3d, 0xbb, 0xb2, 0x4a, 0xb4, 0xa2, 0xbd, 0x43, 0x92, 0xbd },
+	{ 0xcb, 0x89, 0x8c, 0xfb, 0xd1, 0x84, 0x70, 0x83, 0xc3, 0xbb, 0x94, 0x06, 0xc9, 0x29, 0xb1, 0x78 },
+	{ 0x38, 0xfb, 0x8a, 0xeb, 0xc0, 0xbd, 0xf8, 0x40, 0xf8, 0x75, 0xe0, 0x00, 0x31, 0x57, 0xde, 0xe7 },
+	{ 0x9c, 0xbc, 0x39, 0x55, 0x5e, 0x8b, 0xe9, 0x46, 0xfc, 0x91, 0x07, 0xc7, 0x86, 0xdf, 0xcc, 0xc5 },
+	{ 0xa4, 0x1a, 0x3e, 0x66, 0xfa, 0x21, 0xb6, 0x71, 0x44, 0xd7, 0xd2, 0x54, 0xe7, 0xf1, 0x3d, 0x47 },
+	{ 0x59, 0xda, 0x63, 0xef, 0x65, 0xa6, 0x6f, 0xb0, 0x01, 0x01, 0x44, 0x4b, 0xb4, 0xc4, 0x64, 0x43 },
+	{ 0x63, 0x84, 0xdf, 0x3e, 0x67, 0xb2, 0x9f, 0xb0, 0x1b, 0xe0, 0xaa, 0x8c, 0xf3, 0x86, 0x15, 0x14 },
+	{ 0xb4, 0xac, 0x4e, 0xf3, 0x33, 0xdc, 0x5b, 0x58, 0xd4, 0x27, 0xaf, 0x96, 0x09, 0xf4, 0x36, 0xbe },
+	{ 0x8d, 0x67, 0xf8, 0xf2, 0x5a, 0xec, 0x94, 0xb5, 0x55, 0x7d, 0xa7, 0xbe, 0xc6, 0xde, 0xac, 0x18 },
+	{ 0x51, 0x7c, 0x5f, 0xde, 0xc9, 0x0f, 0xa3, 0x85, 0xb9, 0xbb, 0x78, 0xbd, 0x53, 0xb2, 0xf3, 0xc1 },
+	{ 0x75, 0x8c, 0x5f, 0x9f, 0x04, 0x55, 0x9c, 0xdb, 0x7d, 0x04, 0xdd, 0x5b, 0x93, 0x5b, 0x37, 0x66 },
+	{ 0xb3, 0xf1, 0x96, 0x09, 0x02, 0x68, 0x30, 0xb6, 0xeb, 0x3d, 0x04, 0xd0, 0xca, 0x8a, 0xa2, 0x50 },
+	{ 0xa6, 0x27, 0x41, 0xc5, 0xe1, 0x6a, 0xac, 0xa0, 0x16, 0x1a, 0xd7, 0xc1, 0xd7, 0xed, 0x9f, 0xc4 },
+	{ 0xe5, 0x71, 0x28, 0xae, 0x0f, 0x65, 0x5f, 0x8c, 0x6d, 0x77, 0x63, 0xd6, 0xec, 0xa8, 0x88, 0xa8 },
+	{ 0x38, 0xd1, 0x92, 0x56, 0xc2, 0x4a, 0x05, 0xd2, 0xf8, 0x3b, 0x26, 0x27, 0x92, 0x34, 0xf5, 0x5b },
+	{ 0x32, 0x6b, 0x15, 0x5a, 0x8e, 0x43, 0xb5, 0x9e, 0x82, 0x1c, 0x82, 0x99, 0xd2, 0x8c, 0xf1, 0x11 },
+	{ 0x6a, 0x7b, 0x1c, 0x90, 0xce, 0xba, 0x27, 0x17, 0x7a, 0xaf, 0x3f, 0x07, 0x53, 0x75, 0xc4, 0x3f },
+	{ 0x6b, 0xcd, 0x67, 0x05, 0x84, 0x8f, 0xf2, 0xa3, 0x63, 0x08, 0x99, 0xad, 0x04, 0x08, 0x92, 0x4f },
+	{ 0x74, 0x92, 0x33, 0xd6, 0x54, 0xb4, 0x03, 0x93, 0x94, 0xc3, 0x9a, 0x4e, 0x66, 0x3e, 0xc5, 0x26 },
+	{ 0x85, 0x33, 0xec, 0x76, 0xbd, 0xc8, 0xbb, 0xf9, 0x0d, 0x72, 0x96, 0x0a, 0x05, 0xef, 0x24, 0x23 },
+	{ 0x99, 0x33, 0xf3, 0xeb, 0xc2, 0xfa, 0x34, 0x1c, 0x41, 0xbc, 0xef, 0xd9, 0x45, 0x2e, 0xb4, 0xac },
+	{ 0x76, 0xf3, 0x26, 0x5f, 0x39, 0xe3, 0xe0, 0x9f, 0x66, 0x7a, 0x13, 0x6f, 0x94, 0x7f, 0xf9, 0xbb },
+	{ 0xb3, 0x84, 0xfb, 0x12, 0x7d, 0x7a, 0x84, 0x3a, 0xeb, 0x08, 0x10, 0xca, 0xf6, 0x83, 0x52, 0x3a },
+	{ 0x07, 0x60, 0xa9, 0xc5, 0xe3, 0xa7, 0xe8, 0x7b, 0x5f, 0x60, 0xe6, 0x9a, 0xec, 0xc4, 0x75, 0x89 },
+	{ 0x47, 0x3b, 0x50, 0x03, 0x45, 0xa3, 0xd3, 0x9a, 0x9f, 0x6d, 0x63, 0x9c, 0xa1, 0xc6, 0x09, 0x4f },
+	{ 0x49, 0x1e, 0x5b, 0xcd, 0x2d, 0x79, 0xd6, 0x5a, 0x71, 0x76, 0xad, 0x2f, 0xf3, 0x9f, 0x82, 0x40 },
+	{ 0x4b, 0x40, 0xda, 0x76, 0x94, 0x7b, 0x46, 0xc1, 0x43, 0xd6, 0x8e, 0x09, 0x33, 0x2d, 0xd9, 0x03 },
+	{ 0x81, 0xc5, 0xf5, 0x8e, 0xf1, 0x50, 0xe8, 0xbd, 0x69, 0x78, 0x19, 0x7d, 0xe6, 0xb1, 0x8e, 0x10 },
+	{ 0x70, 0x63, 0xb1, 0xcd, 0x06, 0x69, 0x9d, 0xfd, 0xf0, 0x20, 0xb5, 0x07, 0x36, 0xb5, 0x0c, 0xe6 },
+	{ 0x16, 0x37, 0x02, 0x69, 0xeb, 0xed, 0x62, 0xc0, 0x06, 0xc7, 0x17, 0x16, 0xd0, 0x5d, 0xda, 0x92 },
+	{ 0x91, 0xab, 0xf6, 0x45, 0x28, 0xf1, 0x74, 0x82, 0xf9, 0x3c, 0x6a, 0x72, 0x46, 0xf9, 0x59, 0x9f },
+	{ 0x5f, 0x55, 0x5d, 0x36, 0x19, 0x67, 0x39, 0x1b, 0x77, 0x3d, 0xc5, 0x45, 0xc3, 0xfd, 0x5c, 0xd3 },
+	{ 0xd0, 0x49, 0xce, 0x58, 0x53, 0xd1, 0x0e, 0x4c, 0x50, 0x0e, 0x6b, 0x3a, 0x99, 0xf9, 0x14, 0x9b },
+	{ 0x96, 0x17, 0x48, 0x79, 0xac, 0x57, 0x2c, 0x6d, 0x86, 0x1b, 0xcc, 0xf2, 0xd8, 0x83, 0xeb, 0xa9 },
+	{ 0x01, 0xa6, 0x3b, 0x9f, 0xb2, 0xba, 0xb1, 0x6a, 0xe9, 0xcc, 0xcd, 0x59, 0xef, 0xd7, 0x9f, 0x27 },
+	{ 0xc2, 0x9a, 0xc8, 0x95, 0x02, 0xed, 0x6b, 0x25, 0x92, 0xc6, 0xd8, 0x8b, 0xc8, 0xd0, 0x94, 0x15 },
+	{ 0xca, 0x8f, 0x60, 0x32, 0x22, 0xe4, 0xd7, 0x3a, 0xda, 0x7a, 0x52, 0xf9, 0x9b, 0x0c, 0x3f, 0x39 },
+	{ 0xeb, 0xc2, 0x29, 0x60, 0xc4, 0xb2, 0x35, 0x88, 0xe3, 0x79, 0x2a, 0xf7, 0x5c, 0xbf, 0x97, 0xac },
+	{ 0x09, 0x43, 0xb4, 0x8f, 0xcc, 0x7d, 0xeb, 0x3b, 0x31, 0x69, 0x30, 0x2e, 0x3e, 0x9e, 0xee, 0x7a },
+	{ 0xfb, 0x93, 0xae, 0xcc, 0x7b, 0x99, 0x48, 0x15, 0x73, 0x21, 0x9e, 0x7f, 0x6d, 0x75, 0x6e, 0xf5 },
+	{ 0x31, 0xef, 0xd1, 0x4f, 0xda, 0xfb, 0xf6, 0xa2, 0x99, 0x89, 0x6e, 0x19, 0x82, 0xd7, 0x3a, 0x76 },
+	{ 0x3e, 0x61, 0x08, 0xe8, 0xf4, 0xc4, 0x48, 0x74, 0x6e, 0x95, 0x84, 0x8e, 0xf0, 0xfe, 0xe1, 0x31 },
+	{ 0x25, 0x4d, 0xcf, 0xeb, 0x70, 0x60, 0x4a, 0xab, 0xad, 0x84, 0xe0, 0xd7, 0xa1, 0xaa, 0x1c, 0x6e },
+	{ 0xd4, 0x24, 0x60, 0x37, 0xa4, 0x36, 0x8e, 0x03, 0xf4, 0x3c, 0xdc, 0xcd, 0x8b, 0x3d, 0xfb, 0xc3 },
+	{ 0x03, 0xdd, 0x36, 0x93, 0x98, 0x76, 0x9b, 0x08, 0xbb, 0x49, 0x8c, 0xa0, 0x7e, 0xf6, 0xea, 0x30 },
+	{ 0xe6, 0xed, 0x6b, 0xb8, 0xc3, 0xac, 0x1d, 0x88, 0x56, 0x0a, 0x77, 0x56, 0x3d, 0x5e, 0x3f, 0x44 },
+	{ 0x52, 0x22, 0x9b, 0x7d, 0x7c, 0xca, 0x54, 0xf0, 0xa2, 0x88, 0x46, 0x17, 0x43, 0x8a, 0x93, 0xe9 },
+	{ 0x61, 0x62, 0x60, 0x95, 0x00, 0xb0, 0x2f, 0x4a, 0x49, 0x80, 0xc9, 0xb2, 0xb3, 0xf9, 0xbe, 0x50 },
+	{ 0x77, 0x84, 0xe6, 0xb3, 0x6c, 0xe4, 0x18, 0xd3, 0x4f, 0x2a, 0x04, 0x5c, 0x34, 0xc6, 0xa4, 0x9d },
+	{ 0x3e, 0x37, 0x10, 0x53, 0xf6, 0x51, 0x55, 0x05, 0x6e, 0x5b, 0xca, 0xb4, 0x51, 0xdc, 0xf8, 0xa5 },
+	{ 0x7b, 0x74, 0xf4, 0xdc, 0x3c, 0x03, 0x12, 0xc2, 0xf3, 0x75, 0x52, 0x5c, 0x76, 0x9b, 0x7f, 0x0c },
+	{ 0xdf, 0x4a, 0x1f, 0x91, 0x59, 0x8a, 0x7c, 0xff, 0xf7, 0xae, 0x56, 0x8f, 0x1b, 0xb5, 0x62, 0x30 },
+	{ 0xd3, 0xa8, 0x1c, 0x2d, 0xf0, 0xee, 0xcf, 0x07, 0x0b, 0xaa, 0xc8, 0x4d, 0x3b, 0x88, 0x44, 0x28 },
+	{ 0x6b, 0x21, 0x58, 0x2f, 0x81, 0x75, 0xd9, 0x81, 0x63, 0x7c, 0x0d, 0x61, 0x42, 0x4d, 0x64, 0x67 },
+	{ 0xe3, 0xb8, 0x15, 0x79, 0x25, 0x02, 0x50, 0x3b, 0x9b, 0xa8, 0xd3, 0x1c, 0x3a, 0xf2, 0xf8, 0x42 },
+	{ 0xed, 0x38, 0x99, 0x33, 0x28, 0x9b, 0x8c, 0xcc, 0xb5, 0x4d, 0x80, 0x84, 0xda, 0x91, 0xc0, 0x87 },
+	{ 0x28, 0xeb, 0x91, 0x9f, 0x8b, 0xaa, 0x78, 0x0d, 0x68, 0x77, 0xd5, 0x31, 0x32, 0xed, 0x29, 0xcd },
+	{ 0x07, 0xf7, 0x3c, 0x51, 0x67, 0x08, 0x88, 0x66, 0x5f, 0xcf, 0x94, 0x7a, 0x5f, 0xee, 0xae, 0x2b },
+	{ 0x70, 0xb7, 0xa1, 0xf7, 0x03, 0x4f, 0x84, 0xdb, 0xf0, 0x94, 0x29, 0xbb, 0x73, 0xfa, 0xde, 0xfd },
+	{ 0x37, 0x40, 0xd3, 0x01, 0x8f, 0x49, 0xcd, 0x9e, 0x0f, 0x8c, 0x35, 0x3a, 0xf2, 0xed, 0x49, 0x7a },
+	{ 0x8c, 0x00, 0x31, 0x33, 0x26, 0x5e, 0x50, 0xf1, 0x6c, 0x07, 0x71, 0xab, 0xc5, 0xba, 0xea, 0xc2 },
+	{ 0x42, 0x90, 0x8a, 0xf0, 0x42, 0x10, 0xaf, 0x09, 0x12, 0x38, 0x6a, 0xd5, 0x20, 0x88, 0x9a, 0x72 },
+	{ 0x35, 0x09, 0xd8, 0x0d, 0xa9, 0x8d, 0xe3, 0x00, 0x3d, 0x0f, 0x77, 0xf3, 0x62, 0xcf, 0xfe, 0x70 },
+	{ 0x78, 0xd6, 0x31, 0x29, 0x22, 0xb9, 0xe3, 0x5f, 0x38, 0x83, 0x5d, 0x02, 0xe6, 0x58, 0x72, 0xad },
+	{ 0x5c, 0xa2, 0x1e, 0x38, 0x7f, 0x63, 0x91, 0x81, 0xbc, 0x2d, 0xf3, 0x7e, 0xe3, 0x29, 0x5b, 0x2e },
+	{ 0xf0, 0x43, 0xf7, 0xdd, 0xc7, 0xd2, 0x66, 0xaa, 0x70, 0x75, 0x69, 0xe4, 0x3e, 0xdb, 0x1d, 0xfd },
+	{ 0xe4, 0xe0, 0x68, 0x59, 0xdc, 0x63, 0x27, 0x59, 0x84, 0xc7, 0x72, 0xe9, 0x4c, 0x62, 0xdd, 0xc6 },
+	{ 0x87, 0xec, 0xfe, 0xab, 0xa7, 0x2b, 0xcb, 0x4a, 0xdf, 0x40, 0x26, 0xc4, 0xb7, 0xa5, 0xb4, 0x88 },
+	{ 0xb7, 0xb3, 0x7d, 0x1b, 0xcb, 0xc5, 0xea, 0xcf, 0x8f, 0xab, 0xf5, 0x10, 0x27, 0x0d, 0x0b, 0x7b },
+	{ 0x7e, 0x66, 0xa7, 0xba, 0x54, 0x33, 0x27, 0x02, 0xae, 0xdc, 0xbb, 0x69, 0x44, 0x23, 0x5f, 0x83 },
+	{ 0x48, 0x63, 0xa3, 0xe3, 0xfb, 0x04, 0xab, 0xb8, 0x88, 0x8c, 0x02, 0x69, 0xb4, 0x36, 0xee, 0xd2 },
+	{ 0x7a, 0x0d, 0x2d, 0x1d, 0x08, 0x75, 0xcd, 0xfd, 0x0a, 0x00, 0x1c, 0x49, 0x75, 0x77, 0xbd, 0xb6 },
+	{ 0xe5, 0xc5, 0x18, 0xd8, 0x0c, 0x4b, 0x46, 0x6a, 0x6d, 0xeb, 0xd7, 0x89, 0x2a, 0xee, 0x5a, 0xc0 },
+	{ 0xf6, 0x94, 0xf8, 0x8f, 0x7c, 0x20, 0x3d, 0xa6, 0xe6, 0x77, 0x30, 0x05, 0xaf, 0xf1, 0x2c, 0x01 },
+	{ 0xce, 0xbe, 0xe2, 0x3a, 0x70, 0x2f, 0x3e, 0xd0, 0x7e, 0x1d, 0x38, 0x40, 0xcc, 0x95, 0xf7, 0x79 },
+	{ 0xf7, 0x25, 0xb8, 0xe4, 0xaf, 0x21, 0x75, 0xd9, 0xcf, 0x27, 0x21, 0xf2, 0x4e, 0x38, 0xd8, 0xe2 },
+	{ 0xd5, 0xb5, 0x1f, 0x8c, 0xd7, 0x37, 0xc6, 0x36, 0xdd, 0xec, 0xcc, 0xba, 0x2b, 0x84, 0xa6, 0xa5 },
+	{ 0xb5, 0xfe, 0x99, 0x68, 0xe9, 0xb0, 0x26, 0xe5, 0xbd, 0x80, 0x08, 0x3d, 0xbb, 0x86, 0x04, 0xce },
+	{ 0x90, 0xdb, 0xc2, 0x11, 0x77, 0xc3, 0xcf, 0xa8, 0x10, 0x36, 0xe2, 0x3e, 0xb8, 0xfe, 0xd0, 0xeb },
+	{ 0xa3, 0x9e, 0xfa, 0x5b, 0x46, 0xda, 0xf7, 0x75, 0x5b, 0x44, 0xbf, 0xd4, 0x96, 0x3c, 0x87, 0xab },
+	{ 0x8e, 0x37, 0x2c, 0x27, 0x0c, 0x1a, 0x3a, 0x8f, 0x3e, 0x84, 0x2f, 0xf2, 0x54, 0xd9, 0x35, 0xcc },
+	{ 0xb2, 0x60, 0xd7, 0xb4, 0xce, 0x66, 0xf8, 0x82, 0x02, 0x8e, 0x13, 0xe3, 0x2a, 0x44, 0xf7, 0x6e },
+	{ 0x5e, 0x85, 0x29, 0x02, 0x68, 0x39, 0x94, 0x41, 0x8e, 0x36, 0x3d, 0x12, 0x35, 0x03, 0xd4, 0x1f },
+	{ 0x2e, 0x66, 0x8b, 0xe6, 0x3e, 0x6b, 0x42, 0x78, 0xde, 0xb3, 0x56, 0x2c, 0x41, 0x26, 0x22, 0x5d },
+	{ 0xfd, 0xf4, 0xa1, 0x55, 0x60, 0xc8, 0x25, 0x22, 0x45, 0xd8, 0x16, 0xa0, 0x9b, 0xb6, 0xa2, 0x8a },
+	{ 0x7c, 0x1a, 0x30, 0x7c, 0xef, 0xbd, 0xc3, 0x2c, 0xdc, 0x42, 0x20, 0xb6, 0x65, 0x73, 0x1f, 0x34 },
+	{ 0x79, 0x91, 0xe9, 0x12, 0x54, 0x2d, 0x0f, 0x02, 0x21, 0x6d, 0x08, 0xc9, 0x24, 0xc2, 0x06, 0x1b },
+	{ 0x70, 0xcc, 0x1d, 0x42, 0x83, 0x08, 0xfe, 0x12, 0xf0, 0xb1, 0x06, 0x28, 0xc3, 0x8b, 0xd3, 0x43 },
+	{ 0xcf, 0xb8, 0x0e, 0x04, 0x20, 0xd0, 0xd6, 0x18, 0x67, 0x5e, 0x7a, 0x4d, 0xf9, 0xb2, 0x69, 0xb9 },
+	{ 0x4b, 0x2b, 0x5e, 0x2c, 0x15, 0xc2, 0xcc, 0x89, 0x43, 0xb9, 0xb1, 0x9c, 0xe3, 0x9b, 0xe4, 0xbd },
+	{ 0x0e, 0x2d, 0xee, 0x81, 0x4c, 0x3d, 0x7d, 0x73, 0xbe, 0xf5, 0xc0, 0x3b, 0xad, 0x90, 0x3b, 0x29 },
+	{ 0xba, 0x27, 0x48, 0x3a, 0xe7, 0x9c, 0x25, 0xc3, 0x4a, 0x64, 0x30, 0x91, 0x18, 0x2d, 0x2f, 0x4e },
+	{ 0x84, 0xa2, 0x2c, 0x22, 0x8a, 0xc7, 0x83, 0xc6, 0x24, 0xc2, 0xa5, 0x1d, 0x65, 0xa8, 0x79, 0x41 },
+	{ 0x22, 0x2d, 0xf5, 0xf6, 0x51, 0x6f, 0xf6, 0x95, 0xf2, 0x3f, 0x1a, 0x0b, 0xee, 0xcf, 0xca, 0xb2 },
+	{ 0x9d, 0x0e, 0x85, 0xca, 0x13, 0x60, 0xb4, 0xd3, 0xe5, 0xea, 0x60, 0x6d, 0x38, 0x72, 0x9a, 0xd5 },
+	{ 0xa0, 0xc1, 0xc3, 0xc8, 0xad, 0x63, 0x5c, 0x6d, 0xa0, 0xfa, 0x32, 0x34, 0x18, 0x46, 0x9c, 0x7a },
+	{ 0xb3, 0x1b, 0x8f, 0x9e, 0x00, 0xdb, 0x23, 0x25, 0xeb, 0x77, 0xbe, 0xa9, 0x69, 0xad, 0x8b, 0xdc },
+	{ 0xe9, 0xdf, 0x1e, 0x96, 0xdb, 0xdc, 0x32, 0xc8, 0x11, 0x71, 0xe0, 0x63, 0x0b, 0xe6, 0x1e, 0xbb },
+	{ 0xaa, 0x95, 0x37, 0xad, 0xad, 0xe2, 0x7f, 0xdc, 0xba, 0x13, 0x54, 0x4f, 0xf6, 0x2a, 0x36, 0xd7 },
+	{ 0x27, 0xae, 0xc2, 0x74, 0x55, 0x8f, 0x27, 0xb8, 0x7f, 0x3b, 0x59, 0xf8, 0xcf, 0xeb, 0x50, 0x03 },
+	{ 0x79, 0x3d, 0xf9, 0xe8, 0x56, 0x47, 0x28, 0x24, 0x21, 0xf9, 0x93, 0x15, 0xe7, 0x7c, 0x34, 0x03 },
+	{ 0x4d, 0x4d, 0xdd, 0xd5, 0x7b, 0xc4, 0x3c, 0xf0, 0x15, 0x19, 0x93, 0x76, 0x23, 0x29, 0x3b, 0x81 },
+	{ 0x44, 0xb2, 0x09, 0x9a, 0xa9, 0x12, 0x1f, 0x70, 0xe4, 0x97, 0x4b, 0xaf, 0x60, 0x15, 0xf1, 0x35 },
+	{ 0xdd, 0xe9, 0x2b, 0x08, 0x75, 0x5b, 0x9f, 0xf2, 0x25, 0xf8, 0xdd, 0x6e, 0xed, 0x73, 0x2e, 0x9b },
+	{ 0xcc, 0xf0, 0x53, 0xbb, 0x06, 0x13, 0xb5, 0x47, 0xac, 0x31, 0xcb, 0x19, 0xca, 0x4d, 0x73, 0xce },
+	{ 0x6e, 0xaa, 0x9e, 0x98, 0x1c, 0x06, 0x8e, 0xac, 0x1e, 0x52, 0x25, 0x4e, 0x83, 0xfe, 0x7c, 0x80 },
+	{ 0x92, 0xfd, 0x41, 0xbb, 0xdd, 0xc5, 0x3f, 0x0f, 0xe2, 0x95, 0xc3, 0x18, 0xf8, 0x8b, 0x27, 0xaf },
+	{ 0x4c, 0xbc, 0x1d, 0x81, 0x48, 0xc3, 0x04, 0xbd, 0x2c, 0x69, 0xa2, 0x89, 0x83, 0xe2, 0x8f, 0x9f },
+	{ 0xcd, 0x42, 0x9f, 0x30, 0xbc, 0xe7, 0x7f, 0xd4, 0x95, 0x8a, 0x24, 0xc0, 0x7b, 0xe0, 0x40, 0xde },
+	{ 0x0f, 0x94, 0xb5, 0x41, 0x81, 0xcb, 0xc1, 0x37, 0xa7, 0x6b, 0xf7, 0x4e, 0xae, 0xb4, 0xfd, 0x7e },
+	{ 0x06, 0x90, 0x75, 0x91, 0x32, 0x7a, 0x43, 0xa2, 0x76, 0x59, 0x5e, 0x67, 0x5e, 0xca, 0xec, 0xd5 },
+	{ 0x95, 0xef, 0xf4, 0x98, 0xf5, 0xf5, 0x54, 0x4f, 0x9d, 0xfc, 0x2c, 0x26, 0xc6, 0x13, 0x07, 0x26 },
+	{ 0xdd, 0x28, 0xa0, 0xe7, 0xf2, 0x87, 0x0c, 0x99, 0x25, 0x4f, 0x75, 0xb5, 0xdb, 0x27, 0x0c, 0x6d },
+	{ 0x18, 0xad, 0x71, 0x3c, 0x4f, 0xd6, 0xb9, 0x04, 0xd8, 0x9a, 0x6d, 0xa3, 0x4d, 0x30, 0x03, 0x6e },
+	{ 0x27, 0x84, 0xca, 0xdf, 0x56, 0x1c, 0x34, 0x49, 0x7f, 0x01, 0x9f, 0x1e, 0x31, 0xc9, 0x67, 0x77 },
+	{ 0xb7, 0x4a, 0x11, 0xa7, 0x4e, 0x26, 0x8a, 0xba, 0x8f, 0x1a, 0xa4, 0xf0, 0x99, 0x36, 0x44, 0x1d },
+	{ 0xe4, 0x49, 0xd5, 0xcd, 0x58, 0x03, 0x88, 0x6e, 0x84, 0x58, 0xc4, 0x09, 0xda, 0x38, 0xa4, 0x24 },
+	{ 0xfa, 0xd8, 0xf6, 0xe2, 0x49, 0x25, 0x1d, 0x73, 0x8a, 0x37, 0xf3, 0xb8, 0x2e, 0x0c, 0xda, 0x87 },
+	{ 0x18, 0x59, 0x81, 0x12, 0x52, 0xf0, 0xd2, 0x26, 0xd8, 0x26, 0xf9, 0xef, 0x0f, 0xeb, 0x30, 0x56 },
+	{ 0xef, 0xdc, 0x2f, 0x1e, 0x93, 0x44, 0x22, 0xe6, 0x87, 0xff, 0x32, 0xd1, 0x3d, 0xb7, 0x5b, 0xa7 },
+	{ 0xfc, 0x63, 0xe2, 0x00, 0x2d, 0xc7, 0xed, 0xee, 0x5c, 0x28, 0x26, 0xb3, 0xfb, 0x6f, 0xf7, 0xa8 },
+	{ 0xc5, 0x0e, 0x93, 0xb4, 0x1e, 0xc4, 0xa6, 0x18, 0x4d, 0x7f, 0x13, 0x0c, 0xba, 0xf0, 0xb8, 0xe8 },
+	{ 0xda, 0x75, 0x61, 0xe9, 0x58, 0x84, 0x64, 0xff, 0x6a, 0x3f, 0xa3, 0xee, 0xfb, 0x53, 0x0a, 0xc8 },
+	{ 0xe6, 0xd8, 0xef, 0x6d, 0x44, 0xf3, 0xa3, 0x50, 0x56, 0xed, 0x99, 0xe9, 0xed, 0xcc, 0x4a, 0xfe },
+	{ 0x7f, 0x0c, 0xe3, 0x59, 0x07, 0xee, 0xd8, 0x6c, 0x97, 0xa9, 0x89, 0xc3, 0x33, 0xfb, 0xfe, 0xaa },
+	{ 0x5e, 0x70, 0xad, 0xb7, 0xe8, 0x7f, 0x1a, 0x0a, 0x8e, 0x19, 0x60, 0xa5, 0xe5, 0x71, 0xdf, 0xd9 },
+	{ 0xb4, 0x00, 0x3f, 0x1d, 0x31, 0xc2, 0x42, 0x36, 0xd4, 0x9b, 0x23, 0x4a, 0x47, 0x39, 0x09, 0xd6 },
+	{ 0xbb, 0xe2, 0xff, 0x23, 0x19, 0x11, 0x51, 0x65, 0x33, 0x4e, 0xdb, 0x57, 0x57, 0x96, 0xc3, 0xbb },
+	{ 0x01, 0x91, 0xbf, 0x54, 0x33, 0x01, 0x38, 0x33, 0xe9, 0xaf, 0xf0, 0xec, 0x9f, 0x46, 0xab, 0xe1 },
+	{ 0x69, 0xc0, 0x64, 0xa6, 0x9c, 0x46, 0xfc, 0x74, 0x91, 0xc5, 0x94, 0x40, 0x14, 0x0c, 0x30, 0xd2 },
+	{ 0x98, 0x39, 0xc7, 0x22, 0x13, 0x5a, 0x9c, 0xd3, 0x58, 0x7b, 0xad, 0xcc, 0x18, 0x11, 0x42, 0x6d },
+	{ 0x8a, 0xb4, 0xb9, 0xf4, 0xc0, 0xe8, 0xec, 0x1b, 0x9a, 0x6d, 0xd5, 0xf7, 0xe6, 0x0a, 0xab, 0x73 },
+	{ 0x06, 0xba, 0x6d, 0x26, 0x31, 0xed, 0x36, 0x11, 0x76, 0x93, 0x18, 0x41, 0xfd, 0xec, 0xd5, 0x61 },
+	{ 0xb8, 0x1a, 0x45, 0xdb, 0xff, 0x53, 0x2f, 0x94, 0x78, 0x21, 0x2c, 0x24, 0x28, 0x31, 0xcd, 0xd0 },
+	{ 0x57, 0xb8, 0xe4, 0x45, 0xff, 0xa3, 0xff, 0x49, 0x2f, 0xa1, 0x62, 0x71, 0x74, 0x37, 0x0e, 0x80 },
+	{ 0x22, 0xaf, 0x0c, 0x38, 0x56, 0x16, 0x1c, 0x49, 0xf2, 0x91, 0xeb, 0x7d, 0x11, 0x68, 0x0f, 0x0f },
+	{ 0x3a, 0xf3, 0x11, 0x00, 0x29, 0x4d, 0x75, 0x38, 0xca, 0x9b, 0x07, 0x01, 0xd2, 0xc1, 0x4b, 0x1f },
+	{ 0xf6, 0xfd, 0x64, 0x04, 0xf9, 0xbf, 0x9d, 0xbb, 0xe6, 0x08, 0x82, 0x25, 0x3c, 0xc8, 0xf3, 0x5e },
+	{ 0x87, 0x40, 0xef, 0xd5, 0xa4, 0x11, 0xb2, 0x28, 0xdf, 0xb4, 0x9a, 0x77, 0xf5, 0xea, 0x86, 0xa0 },
+	{ 0xf3, 0x4a, 0x26, 0x06, 0x5f, 0xbc, 0xf5, 0x21, 0x2b, 0xf9, 0xaf, 0x5e, 0x5c, 0xf4, 0xf1, 0xb9 },
+	{ 0xa5, 0xc0, 0x79, 0x05, 0xad, 0xdc, 0x67, 0xdc, 0x2d, 0xa4, 0xa0, 0xae, 0xd6, 0xc9, 0xdd, 0x6e },
+	{ 0xb9, 0x96, 0x88, 0xe5, 0xb3, 0x9b, 0xed, 0x8f, 0x61, 0xb4, 0x3f, 0xa4, 0x78, 0xe6, 0x83, 0x6c },
+	{ 0xcc, 0x9c, 0x63, 0x91, 0x09, 0x2d, 0xce, 0x69, 0xac, 0xbd, 0x56, 0x66, 0x8c, 0x08, 0xa1, 0xb6 },
+	{ 0xac, 0x4e, 0x4a, 0xe2, 0x97, 0x45, 0x8f, 0x2d, 0x8c, 0xe2, 0xe3, 0x08, 0xa9, 0xe1, 0xc5, 0x3c },
+	{ 0xc3, 0xc2, 0x1b, 0x76, 0xb9, 0x4e, 0x43, 0x43, 0x7b, 0xe5, 0x77, 0x58, 0xdb, 0x40, 0x79, 0x99 },
+	{ 0xb6, 0xb9, 0x51, 0x52, 0x1b, 0x25, 0x52, 0x87, 0xa6, 0x6a, 0xb3, 0x03, 0xfa, 0xef, 0x98, 0x3b },
+	{ 0x8f, 0xb3, 0x6f, 0x31, 0xc0, 0x61, 0xf8, 0x8a, 0x27, 0x17, 0x43, 0x72, 0xa5, 0x8e, 0xec, 0x67 },
+	{ 0x51, 0x52, 0x67, 0x49, 0xcb, 0x9c, 0xaf, 0x16, 0xb9, 0x81, 0xbe, 0xe3, 0xb4, 0x8f, 0x0a, 0x36 },
+	{ 0x56, 0x27, 0x25, 0xf1, 0xcb, 0xa2, 0xc7, 0x16, 0x46, 0xf1, 0x71, 0x84, 0xd4, 0xf0, 0x62, 0x9e },
+	{ 0x23, 0x6a, 0xc4, 0x21, 0x88, 0x8a, 0x47, 0xeb, 0xdb, 0x7b, 0x96, 0x44, 0x50, 0xd1, 0xa3, 0x7c },
+	{ 0xe6, 0x2c, 0xe0, 0x97, 0x41, 0xd9, 0x8a, 0x2e, 0x56, 0x61, 0x0e, 0x9d, 0x2b, 0x12, 0x1d, 0x16 },
+	{ 0xec, 0x29, 0xf1, 0x1f, 0xf9, 0x40, 0x7a, 0x4c, 0xcc, 0xef, 0x60, 0x0a, 0x5e, 0xe3, 0x59, 0x02 },
+	{ 0x5b, 0x65, 0x4f, 0x0d, 0x49, 0x48, 0x40, 0x2c, 0xd3, 0xf1, 0x76, 0x45, 0x81, 0x28, 0x82, 0x64 },
+	{ 0x4d, 0x62, 0x59, 0x20, 0xfb, 0x7d, 0xb6, 0x27, 0x15, 0x36, 0x70, 0xe3, 0x72, 0xba, 0x2f, 0xc7 },
+	{ 0xc1, 0xb5, 0x18, 0x17, 0xd2, 0x05, 0x4d, 0x14, 0xa9, 0xa2, 0x73, 0xeb, 0xea, 0x44, 0x17, 0x1c },
+	{ 0x93, 0xcd, 0x75, 0xef, 0x8e, 0xf3, 0xe4, 0xe8, 0xcb, 0x9c, 0x4b, 0x4c, 0x86, 0x86, 0xb0, 0x62 },
+	{ 0xff, 0xec, 0x28, 0x6a, 0xc8, 0x57, 0xa2, 0x19, 0x17, 0xfe, 0x3d, 0xa0, 0x3c, 0x21, 0x10, 0xc2 },
+	{ 0x3b, 0x45, 0x5d, 0x75, 0xde, 0x21, 0x40, 0xc5, 0xb3, 0xf4, 0x60, 0xa7, 0x83, 0x54, 0x19, 0x2f },
+	{ 0x28, 0x69, 0x7a, 0x5e, 0x87, 0x03, 0x53, 0x5a, 0x68, 0x25, 0x04, 0xbf, 0x0e, 0x55, 0xe5, 0x70 },
+	{ 0x93, 0x8e, 0x01, 0x10, 0x11, 0xc7, 0x77, 0x42, 0xcb, 0x45, 0xb4, 0x05, 0x98, 0xd2, 0xd2, 0x90 },
+	{ 0x99, 0x09, 0xfb, 0x56, 0xc4, 0x87, 0x41, 0xad, 0x41, 0x82, 0x35, 0x00, 0xa7, 0x0b, 0xcb, 0x20 },
+	{ 0x67, 0xf2, 0xd5, 0x26, 0x33, 0x2a, 0x73, 0xec, 0xbf, 0xd9, 0x27, 0x1a, 0x12, 0xc4, 0xab, 0x26 },
+	{ 0x35, 0x48, 0x4c, 0xed, 0x26, 0xba, 0x50, 0xa7, 0x3d, 0x66, 0x0e, 0x3a, 0x51, 0x83, 0xdc, 0x42 },
+	{ 0x30, 0x73, 0x8e, 0x45, 0x26, 0xb4, 0x38, 0xa7, 0xb0, 0xf6, 0x5a, 0x99, 0x31, 0x22, 0x84, 0xda },
+	{ 0x50, 0x2a, 0x14, 0x69, 0x14, 0x3b, 0xd8, 0xf8, 0xd0, 0x62, 0x1f, 0x17, 0xa2, 0x1f, 0x26, 0xb2 },
+	{ 0xfa, 0x56, 0xdf, 0xa1, 0x45, 0x7e, 0xf7, 0xbf, 0x8a, 0xe5, 0x21, 0x46, 0x0b, 0x74, 0x95, 0x2b },
+	{ 0x10, 0x4f, 0x6d, 0x2b, 0xb3, 0x3f, 0xed, 0xd9, 0x90, 0x55, 0xa2, 0x15, 0xed, 0x1d, 0x92, 0xec },
+	{ 0x83, 0xbd, 0x7c, 0xa3, 0x59, 0xe0, 0x64, 0xb5, 0x3b, 0x9e, 0x40, 0x7d, 0x87, 0x1c, 0xfc, 0x47 },
+	{ 0x0e, 0xee, 0x79, 0xa2, 0xce, 0x10, 0x10, 0xcd, 0xbe, 0x9e, 0x29, 0xf5, 0xbe, 0xdc, 0x5d, 0x57 },
+	{ 0x34, 0xb7, 0x8c, 0x98, 0xf3, 0xb8, 0x18, 0x74, 0x54, 0xb6, 0x1d, 0x4d, 0xb1, 0x3c, 0x31, 0x61 },
+	{ 0x14, 0x3f, 0x7b, 0x54, 0x83, 0x5e, 0xe6, 0xc8, 0x34, 0xa1, 0xf0, 0x15, 0x2f, 0xf3, 0x6c, 0x5b },
+	{ 0x56, 0x7b, 0x15, 0x1b, 0xc9, 0x88, 0xae, 0xf4, 0x46, 0x65, 0xe6, 0x37, 0x12, 0x36, 0x35, 0xb6 },
+	{ 0x13, 0xed, 0x2f, 0xdf, 0xcd, 0x89, 0x1b, 0x3c, 0x4b, 0x48, 0x97, 0x6f, 0x7d, 0x60, 0x9f, 0x4b },
+	{ 0x88, 0xbc, 0x32, 0xe0, 0x58, 0x59, 0x70, 0x24, 0xc8, 0x47, 0xae, 0xf7, 0x45, 0xa0, 0x3d, 0x3c },
+	{ 0x88, 0xa7, 0xb6, 0x95, 0xd9, 0x9f, 0xf6, 0xec, 0xc8, 0x2a, 0xd1, 0x8a, 0xf6, 0x0e, 0x49, 0xf6 },
+	{ 0xc1, 0x09, 0x09, 0x41, 0xcf, 0xeb, 0x33, 0xf2, 0xa9, 0x16, 0xe8, 0x9e, 0x28, 0x8a, 0xe9, 0x33 },
+	{ 0xd2, 0xed, 0x64, 0x43, 0xbe, 0x7a, 0xa4, 0x65, 0x22, 0xc0, 0x1d, 0x87, 0xfc, 0x1e, 0xb0, 0xba },
+	{ 0x6d, 0xef, 0xe6, 0xae, 0xea, 0x91, 0x62, 0x0a, 0x35, 0x68, 0x7a, 0x87, 0x44, 0x95, 0xe8, 0x12 },
+	{ 0xba, 0xe8, 0xd3, 0x5a, 0x69, 0x70, 0xb8, 0x1c, 0x4a, 0x0d, 0x99, 0x4a, 0x2a, 0x79, 0x51, 0x7c },
+	{ 0x11, 0x8c, 0x3c, 0x56, 0xe9, 0x5a, 0x3e, 0x2f, 0x79, 0x91, 0x1e, 0x4f, 0x4f, 0x1f, 0x6b, 0xb6 },
+	{ 0xaf, 0x2b, 0x81, 0x75, 0x30, 0xbc, 0x2a, 0x36, 0x47, 0x2c, 0x70, 0xa9, 0x27, 0xd8, 0xb0, 0x6d },
+	{ 0x9f, 0x6f, 0x78, 0x53, 0xf8, 0x8e, 0x91, 0xe0, 0xb7, 0xa1, 0xd9, 0x8d, 0x66, 0xb3, 0xce, 0x6a },
+	{ 0xa0, 0xd6, 0x3f, 0x13, 0x2d, 0x1d, 0xd6, 0xa4, 0xa0, 0x17, 0x10, 0xa1, 0x67, 0xd7, 0x90, 0xc0 },
+	{ 0x78, 0x15, 0xa6, 0x08, 0xa0, 0xe5, 0x50, 0x06, 0x38, 0xda, 0xf4, 0x48, 0xd4, 0x0c, 0x50, 0x7f },
+	{ 0x45, 0xef, 0xd8, 0xc4, 0xdf, 0x2d, 0x70, 0xc5, 0xcd, 0xd3, 0xc7, 0xe8, 0xc2, 0x16, 0xca, 0xff },
+	{ 0xc6, 0x4b, 0x62, 0xdf, 0x54, 0xdf, 0xf7, 0x6d, 0x36, 0xbb, 0x8f, 0x45, 0x1c, 0xf2, 0x91, 0xb2 },
+	{ 0xe9, 0x09, 0x17, 0x2b, 0xda, 0x4f, 0x26, 0x37, 0x11, 0xab, 0x9a, 0x3d, 0xaa, 0x08, 0x08, 0x47 },
+	{ 0xba, 0xbe, 0xdb, 0xc5, 0x6a, 0xfd, 0xc4, 0xad, 0x4a, 0xd3, 0xde, 0x70, 0x8b, 0x56, 0x68, 0xf0 },
+	{ 0x09, 0x6d, 0xac, 0x24, 0xcb, 0xf0, 0xde, 0xaa, 0x31, 0xa3, 0xea, 0x07, 0xdd, 0xc0, 0xd7, 0x06 },
+	{ 0xe7, 0x54, 0x33, 0x78, 0xf8, 0x3a, 0x62, 0x4c, 0x3f, 0x80, 0xad, 0x69, 0x3e, 0x82, 0x01, 0x9a },
+	{ 0x1f, 0x7a, 0xb6, 0xf8, 0xb7, 0x6b, 0x4e, 0xfc, 0x37, 0x30, 0x48, 0x44, 0x0e, 0xfc, 0xc8, 0x0d },
+	{ 0x35, 0x9c, 0x3c, 0x17, 0x24, 0xa0, 0x37, 0x85, 0x3d, 0xda, 0x82, 0xed, 0x8e, 0xc8, 0xae, 0x5a },
+	{ 0xa2, 0x22, 0xb7, 0x51, 0x92, 0x92, 0x39, 0x7a, 0x72, 0xb1, 0xab, 0x54, 0x46, 0x87, 0xd0, 0x0f },
+	{ 0xec, 0x3e, 0x6d, 0x6a, 0x78, 0xfa, 0xf3, 0x83, 0xcc, 0x0c, 0x3e, 0x77, 0xad, 0x74, 0x4e, 0x48 },
+	{ 0xe1, 0x57, 0x22, 0xf0, 0x40, 0xd3, 0x72, 0x2e, 0xc9, 0xf1, 0x5a, 0xfc, 0x0b, 0xb1, 0xc4, 0xad },
+	{ 0xb5, 0x7c, 0x82, 0x27, 0xe5, 0x09, 0x01, 0x32, 0xbd, 0x2e, 0x37, 0xca, 0x97, 0xee, 0xbf, 0x71 },
+	{ 0xfa, 0x02, 0xef, 0x77, 0x48, 0x98, 0x10, 0xe2, 0x8a, 0x71, 0xad, 0x92, 0xcd, 0x2e, 0xc3, 0x13 },
+	{ 0x01, 0xbb, 0xb7, 0xe9, 0x31, 0x74, 0x2b, 0xa2, 0xe9, 0xe9, 0xaa, 0xc6, 0x3e, 0x69, 0x94, 0x6d },
+	{ 0xd6, 0x31, 0x63, 0x96, 0x8b, 0x7f, 0x84, 0x32, 0xc6, 0x7f, 0xe0, 0x3a, 0x7c, 0x39, 0x5d, 0x41 },
+	{ 0x7a, 0x37, 0x25, 0xb2, 0x06, 0xe8, 0xc0, 0x6c, 0x0a, 0x3a, 0xd6, 0x22, 0x14, 0x9a, 0xa6, 0x42 },
+	{ 0x4b, 0x55, 0x56, 0xc1, 0x13, 0x35, 0xc0, 0xf8, 0x43, 0xf3, 0x6b, 0x76, 0x82, 0xbe, 0xcd, 0x49 },
+	{ 0x56, 0xa5, 0x0d, 0xb0, 0xc7, 0xfb, 0xa1, 0x63, 0x46, 0x9f, 0xa0, 0x11, 0xb1, 0x58, 0x1e, 0x42 },
+	{ 0x46, 0xbf, 0x0c, 0xf9, 0x90, 0x5b, 0x15, 0x9f, 0xb6, 0xda, 0x4f, 0x1c, 0x51, 0x11, 0x53, 0xb3 },
+	{ 0x79, 0x52, 0x75, 0x33, 0xd6, 0x00, 0xa2, 0x5b, 0x21, 0x16, 0x71, 0x82, 0x36, 0x0e, 0x29, 0x49 },
+	{ 0x9d, 0x4d, 0xf9, 0xa9, 0x91, 0x8c, 0x21, 0x7a, 0xe5, 0x41, 0xf8, 0xb3, 0x26, 0x26, 0x78, 0xa7 },
+	{ 0x5b, 0xfc, 0xe2, 0x98, 0xcc, 0xa8, 0xdf, 0x16, 0xd3, 0x60, 0x25, 0x25, 0xf4, 0x51, 0xbb, 0x06 },
+	{ 0x0c, 0x0b, 0x6f, 0xd8, 0xe5, 0x3a, 0x0d, 0x0d, 0xec, 0x95, 0xdf, 0x61, 0x6d, 0x03, 0xe5, 0x65 },
+	{ 0x5c, 0xe1, 0x92, 0x17, 0xfd, 0x8f, 0xfe, 0x27, 0xbc, 0x84, 0x8a, 0xc5, 0xd1, 0xdd, 0x38, 0x00 },
+	{ 0x69, 0x81, 0xf0, 0xc6, 0x1e, 0x1a, 0x8f, 0xce, 0x91, 0x6e, 0xfd, 0xf9, 0x25, 0x58, 0x52, 0x00 },
+	{ 0xcc, 0xc6, 0x5b, 0x26, 0x08, 0xa0, 0xc1, 0xd8, 0xac, 0xf7, 0x10, 0x40, 0x2b, 0x2b, 0x8a, 0x42 },
+	{ 0xb3, 0x6f, 0x7f, 0xc8, 0xfd, 0xc0, 0x0a, 0x03, 0xeb, 0xeb, 0x32, 0x5d, 0xa7, 0xf2, 0x5d, 0xf4 },
+	{ 0xe8, 0xfa, 0x6e, 0x17, 0xab, 0xf5, 0x13, 0xb7, 0x28, 0x4d, 0x7b, 0xc3, 0x2d, 0x5a, 0xa1, 0xc1 },
+	{ 0xe9, 0x8b, 0x2e, 0x6c, 0xde, 0xf6, 0x4b, 0xea, 0x11, 0xfd, 0x6b, 0xb0, 0xcd, 0xa0, 0x4c, 0xa3 },
+	{ 0xe6, 0x6b, 0x54, 0x77, 0xbf, 0x05, 0xf8, 0xd4, 0x56, 0xb8, 0xa5, 0xe3, 0x19, 0xc6, 0xfa, 0xe7 },
+	{ 0x83, 0xa8, 0x00, 0x59, 0xda, 0x26, 0xeb, 0x7d, 0x3b, 0x81, 0x63, 0x10, 0x38, 0x8b, 0x07, 0x02 },
+	{ 0xd9, 0xcf, 0x25, 0x4a, 0xa6, 0xc9, 0xb2, 0x94, 0x81, 0x72, 0xd5, 0x94, 0x0c, 0x7c, 0x6a, 0xa0 },
+	{ 0x8f, 0x35, 0x87, 0x72, 0xc4, 0x08, 0x1e, 0x3e, 0x27, 0x69, 0x14, 0xe5, 0xc8, 0x26, 0x31, 0xc4 },
+	{ 0xc9, 0x52, 0x91, 0x07, 0xec, 0xc8, 0x86, 0xe5, 0xf1, 0x3e, 0xd6, 0xbf, 0x39, 0x0b, 0x66, 0x6f },
+	{ 0x59, 0x19, 0xd8, 0xce, 0xe3, 0xd2, 0xdc, 0x56, 0x01, 0x58, 0xdb, 0x91, 0xa2, 0x78, 0x42, 0x15 },
+	{ 0x39, 0x62, 0x52, 0xab, 0xf5, 0x4b, 0x3d, 0x05, 0xe1, 0xeb, 0x16, 0x14, 0x32, 0x7b, 0xa0, 0x3d },
+	{ 0xc8, 0xd6, 0x4d, 0xfd, 0x37, 0x81, 0xc8, 0xe9, 0x08, 0xac, 0xc2, 0x3f, 0xe9, 0x55, 0xaf, 0xd3 },
+	{ 0xa7, 0x64, 0x10, 0xf0, 0x17, 0x86, 0xfd, 0xf5, 0xff, 0x55, 0x53, 0xfb, 0x39, 0xef, 0x78, 0x8e },
+	{ 0x84, 0x78, 0x34, 0x8d, 0x8b, 0x54, 0x90, 0x57, 0x24, 0x88, 0xeb, 0x43, 0xc6, 0x85, 0x90, 0xb5 },
+	{ 0x77, 0x30, 0xf6, 0x89, 0x6f, 0xfe, 0x31, 0xf5, 0x4f, 0xb6, 0x8f, 0xa8, 0xf6, 0x80, 0xd2, 0x85 },
+	{ 0x66, 0x0d, 0x26, 0xa8, 0x02, 0x43, 0x54, 0xdb, 0xd6, 0xb5, 0xc2, 0x79, 0x34, 0x38, 0x2e, 0x2d },
+	{ 0x5c, 0x63, 0xaa, 0x58, 0x01, 0x37, 0x24, 0xdb, 0xbc, 0xd6, 0x5b, 0x38, 0xf5, 0x75, 0x7d, 0x5c },
+	{ 0xd0, 0xf5, 0xdd, 0x2e, 0x56, 0xeb, 0x27, 0x6e, 0x50, 0x9a, 0xf6, 0x86, 0x5b, 0xb4, 0x42, 0x83 },
+	{ 0xae, 0x9a, 0xc1, 0x20, 0xfd, 0xba, 0xf2, 0x02, 0x5e, 0x7c, 0x7f, 0xbc, 0x87, 0x91, 0x05, 0x8c },
+	{ 0x41, 0x29, 0xc3, 0x30, 0x0e, 0x82, 0x6a, 0x45, 0x29, 0xc2, 0x33, 0xc2, 0x1f, 0x64, 0xd8, 0x1c },
+	{ 0x57, 0x0c, 0xd5, 0x6f, 0xfc, 0x89, 0xe6, 0x27, 0x2f, 0x15, 0xd7, 0x24, 0xb2, 0x7c, 0xe0, 0x97 },
+	{ 0x86, 0xd9, 0x27, 0x16, 0x70, 0x83, 0x6d, 0x64, 0xf6, 0x3e, 0x64, 0x64, 0xf4, 0xc6, 0xc4, 0x4a },
+	{ 0x88, 0x92, 0x3a, 0x4b, 0x5a, 0xe6, 0x7c, 0xb5, 0xc8, 0x0d, 0xf4, 0x1d, 0xa7, 0x7d, 0x54, 0xb0 },
+	{ 0x1f, 0x26, 0xc6, 0xce, 0xba, 0x85, 0x67, 0x1e, 0x37, 0xbc, 0xd3, 0x90, 0xd0, 0xb6, 0xf6, 0xf5 },
+	{ 0x34, 0x8d, 0x94, 0x03, 0xf5, 0x45, 0x25, 0x05, 0x54, 0x7c, 0x63, 0x73, 0x12, 0x1a, 0x48, 0xd5 },
+	{ 0x27, 0xc3, 0x3e, 0xbf, 0xd4, 0x48, 0xa1, 0xef, 0x7f, 0x58, 0x36, 0x65, 0x1f, 0x7d, 0x45, 0x49 },
+	{ 0xc5, 0x4d, 0x07, 0x94, 0x9c, 0xf0, 0x13, 0xbf, 0x4d, 0xd6, 0xaa, 0x52, 0xa8, 0xa4, 0x96, 0xba },
+	{ 0xe3, 0x4f, 0xa9, 0x04, 0xa9, 0x62, 0xef, 0x25, 0x9b, 0x17, 0x82, 0xfc, 0xac, 0x1b, 0x32, 0xe5 },
+	{ 0xee, 0xc9, 0x58, 0x88, 0x5b, 0x9c, 0xc4, 0xff, 0x9e, 0xfd, 0x70, 0x71, 0x7a, 0xd8, 0x6b, 0x69 },
+	{ 0x17, 0x31, 0x2e, 0x32, 0x9b, 0x8e, 0xfb, 0x08, 0xef, 0x07, 0x5a, 0x23, 0xfd, 0x7a, 0x4c, 0xd2 },
+	{ 0xd8, 0x29, 0xea, 0xaa, 0xf3, 0x0e, 0x01, 0x2a, 0x98, 0xa5, 0x07, 0x3b, 0x1d, 0xa4, 0xca, 0x78 },
+	{ 0xd5, 0xa0, 0xa3, 0x41, 0x58, 0x7e, 0x4c, 0xff, 0xdd, 0xcf, 0xef, 0x4d, 0xdc, 0xf2, 0xb1, 0x5f },
+	{ 0x5c, 0x8d, 0xa2, 0xed, 0xff, 0xa9, 0x17, 0x4a, 0xbc, 0x10, 0x16, 0x12, 0x94, 0x98, 0x66, 0xe8 },
+	{ 0x39, 0xcb, 0xbe, 0x1f, 0x72, 0xeb, 0x9d, 0x1a, 0xe1, 0x7c, 0x68, 0x34, 0xbf, 0x51, 0x67, 0x9b },
+	{ 0xe6, 0x17, 0x64, 0x4d, 0xc2, 0x1f, 0x11, 0xf7, 0x56, 0x44, 0x31, 0x30, 0xdc, 0x80, 0x28, 0xd0 },
+	{ 0x5d, 0x1e, 0x62, 0x42, 0x33, 0xab, 0x4f, 0x7d, 0xa5, 0xc0, 0x06, 0xff, 0x33, 0xdf, 0x11, 0xca },
+	{ 0x03, 0x07, 0x2f, 0x28, 0x97, 0xe9, 0x8e, 0x77, 0xbb, 0x83, 0x46, 0x7a, 0x1d, 0x19, 0xd4, 0xbc },
+	{ 0x19, 0xff, 0xbc, 0xb1, 0x04, 0xab, 0x84, 0x91, 0xc1, 0xf3, 0xc6, 0x49, 0xff, 0xc2, 0xd0, 0x7d },
+	{ 0xf8, 0xcb, 0xf3, 0x83, 0x62, 0xdc, 0x26, 0x44, 0xb8, 0xf4, 0xee, 0x4b, 0x3e, 0x10, 0x78, 0x0a },
+	{ 0xd7, 0x16, 0x13, 0x15, 0xbc, 0x66, 0xa3, 0x43, 0xaf, 0xa3, 0x45, 0xdb, 0x59, 0xc5, 0xda, 0x3a },
+	{ 0x38, 0xa7, 0x9a, 0xc1, 0xc3, 0xd7, 0x11, 0x63, 0xf8, 0x01, 0x6c, 0x4d, 0xf3, 0x11, 0x0c, 0xd0 },
+	{ 0x72, 0x70, 0xb4, 0x2c, 0xee, 0xb1, 0x93, 0x2c, 0xc2, 0x63, 0xb9, 0x74, 0x26, 0xb1, 0x6e, 0x63 },
+	{ 0x37, 0x16, 0xdb, 0x6c, 0x90, 0xd6, 0xd9, 0x2f, 0x0f, 0x52, 0x7b, 0x60, 0x53, 0xcb, 0x60, 0xee },
+	{ 0x34, 0xe1, 0x84, 0x2d, 0xf2, 0x2b, 0x0c, 0xe3, 0x54, 0xf0, 0xd7, 0x26, 0x50, 0x5f, 0x1a, 0xed },
+	{ 0xbf, 0xfc, 0x05, 0xe2, 0xe7, 0xa2, 0x3d, 0xc3, 0xd7, 0xd3, 0xe3, 0x31, 0x38, 0x8e, 0x87, 0xb6 },
+	{ 0x9b, 0x16, 0xfe, 0xb5, 0xab, 0xd0, 0x37, 0xdc, 0x13, 0xc5, 0x39, 0x6d, 0x97, 0x07, 0x2d, 0x9e },
+	{ 0x50, 0x54, 0x0c, 0xfe, 0x12, 0xae, 0xcb, 0x67, 0xd0, 0x9c, 0xd9, 0xf0, 0x40, 0x42, 0x0f, 0x3e },
+	{ 0x62, 0xc9, 0x27, 0x55, 0x35, 0x3e, 0x74, 0x0e, 0x32, 0xf6, 0xff, 0xc5, 0xb4, 0x1d, 0x81, 0xa6 },
+	{ 0x25, 0x77, 0xc7, 0x80, 0x6f, 0xd3, 0x3d, 0x1a, 0xad, 0xbe, 0x9a, 0xb1, 0x40, 0xcd, 0x05, 0xfa },
+	{ 0x0f, 0xa9, 0x31, 0x8c, 0x00, 0x85, 0x3b, 0x6f, 0xa7, 0x88, 0xd4, 0xbb, 0xfd, 0x45, 0xf2, 0xc4 },
+	{ 0xc5, 0xe4, 0x9a, 0x1f, 0x20, 0x51, 0xb3, 0xa9, 0x4d, 0x45, 0x59, 0x32, 0x1b, 0xce, 0xcf, 0x5c },
+	{ 0x3e, 0x0d, 0x18, 0xbe, 0xf7, 0xde, 0x61, 0x96, 0x6e, 0x21, 0x10, 0xdb, 0xb2, 0xb9, 0x0f, 0x1a },
+	{ 0x51, 0xe5, 0xcb, 0x52, 0x46, 0xaf, 0x03, 0x9b, 0xb9, 0x4c, 0xca, 0xdd, 0xe0, 0x88, 0xba, 0x1f },
+	{ 0x2b, 0x07, 0x3d, 0x12, 0xa2, 0x4d, 0x81, 0xbc, 0x23, 0x18, 0xf9, 0x18, 0x9f, 0x97, 0xf2, 0xcf },
+	{ 0xb4, 0xeb, 0xc2, 0xd2, 0xb1, 0x08, 0xc9, 0xfe, 0xd4, 0x7e, 0x46, 0xdd, 0xf7, 0xa7, 0x14, 0x90 },
+	{ 0x84, 0xb7, 0xa8, 0x6c, 0x09, 0x81, 0xfd, 0xfd, 0x24, 0xdf, 0x82, 0x8a, 0xb4, 0x39, 0x6e, 0x87 },
+	{ 0x6c, 0x9d, 0x9b, 0x39, 0x35, 0xbd, 0x97, 0x7d, 0x4c, 0x0f, 0x21, 0xe1, 0x92, 0x02, 0x1b, 0x03 },
+	{ 0x30, 0xb2, 0x02, 0x25, 0xa4, 0xe0, 0xa5, 0x4d, 0xb0, 0x4d, 0xf2, 0xdf, 0x1f, 0xd6, 0x61, 0xac },
+	{ 0xf5, 0x18, 0xb5, 0x85, 0xc8, 0xd8, 0x7e, 0xaa, 0xfd, 0xe4, 0x1c, 0x85, 0x5e, 0x3c, 0x76, 0x65 },
+	{ 0x8e, 0x22, 0xb0, 0xdc, 0x8c, 0x60, 0xc0, 0x57, 0x3e, 0x67, 0x52, 0x85, 0x05, 0x48, 0x41, 0x86 },
+	{ 0xaa, 0x2c, 0xcb, 0x38, 0x31, 0x43, 0x1f, 0xc7, 0xba, 0x82, 0x02, 0x2f, 0x69, 0x54, 0x6f, 0x79 },
+	{ 0x00, 0x7e, 0xe8, 0xbe, 0xfb, 0x58, 0xda, 0x4c, 0x00, 0xae, 0x2e, 0x8d, 0xdc, 0x67, 0xbb, 0xa3 },
+	{ 0x68, 0x83, 0x95, 0x7b, 0x66, 0x2b, 0xab, 0x1f, 0xa8, 0x89, 0x18, 0x07, 0xb2, 0x0a, 0x57, 0x08 },
+	{ 0xc2, 0x1c, 0xe0, 0xd6, 0x06, 0x94, 0x91, 0xd8, 0x92, 0x18, 0xaa, 0xfe, 0xeb, 0x68, 0xd9, 0x71 },
+	{ 0x35, 0x1e, 0x54, 0x58, 0x28, 0x47, 0x5d, 0x38, 0x3d, 0x2c, 0x54, 0x60, 0xb2, 0x60, 0xf3, 0xb6 },
+	{ 0xcd, 0x81, 0x13, 0x10, 0x3a, 0x14, 0xed, 0x7a, 0x95, 0xe1, 0xbb, 0x06, 0x6a, 0x94, 0x1e, 0xb0 },
+	{ 0xae, 0x70, 0xc9, 0x8b, 0xfe, 0x47, 0xff, 0x93, 0x5e, 0x42, 0xc5, 0xe2, 0xe8, 0x6e, 0x1c, 0x00 },
+	{ 0x88, 0xfb, 0xa6, 0xbf, 0xd6, 0x85, 0xdd, 0xca, 0xc8, 0x9e, 0x45, 0x3e, 0x34, 0x54, 0x1b, 0x0e },
+	{ 0xd1, 0xc5, 0x11, 0x63, 0x07, 0x19, 0xcd, 0x47, 0x39, 0xa1, 0x7e, 0xba, 0xe9, 0xae, 0xcb, 0x36 },
+	{ 0x76, 0x9f, 0x36, 0x35, 0x3c, 0xfd, 0xf9, 0xc1, 0x66, 0x06, 0x9f, 0xbb, 0x56, 0x3a, 0x27, 0xa4 },
+	{ 0xcc, 0x2f, 0xc8, 0x9a, 0x84, 0x3f, 0x22, 0xee, 0xac, 0x88, 0x62, 0x60, 0xb8, 0x01, 0x51, 0xa0 },
+	{ 0x5e, 0xaf, 0x21, 0x97, 0x66, 0xac, 0x87, 0xb0, 0x8e, 0x70, 0xf7, 0xeb, 0xd3, 0x25, 0xbd, 0xab },
+	{ 0x39, 0x38, 0x5a, 0x16, 0xf7, 0xd8, 0x49, 0x96, 0xe1, 0xb1, 0x5c, 0x3a, 0x93, 0x58, 0xb7, 0xb1 },
+	{ 0xab, 0xbd, 0x8a, 0x8d, 0x64, 0x44, 0x57, 0xfa, 0xa3, 0x32, 0xf3, 0x1b, 0x09, 0x9b, 0x1a, 0x5b },
+	{ 0x48, 0xa2, 0x17, 0xc3, 0x79, 0x31, 0x18, 0x5f, 0x88, 0xe3, 0x99, 0xaf, 0xa2, 0xea, 0xcb, 0xa4 },
+	{ 0x00, 0x3f, 0x74, 0xdf, 0x7d, 0x2c, 0x6d, 0xa6, 0x00, 0x57, 0x97, 0x46, 0xee, 0xb3, 0xdd, 0xd1 },
+	{ 0x63, 0xc3, 0x53, 0x1e, 0xe5, 0xde, 0x0c, 0x57, 0x1b, 0x37, 0x42, 0xd3, 0xe1, 0x3a, 0xf3, 0xe5 },
+	{ 0x77, 0x5a, 0xee, 0x1e, 0x6e, 0x71, 0x25, 0x64, 0x4f, 0xf0, 0x49, 0x82, 0x95, 0xa3, 0xbb, 0x11 },
+	{ 0xcb, 0x4a, 0x18, 0x1c, 0x54, 0x58, 0x03, 0xdd, 0xc3, 0x64, 0xfd, 0xbf, 0xda, 0x75, 0xd3, 0xa6 },
+	{ 0x9a, 0x70, 0xc2, 0x16, 0xf9, 0x15, 0x86, 0x71, 0x2a, 0xf8, 0x6b, 0x13, 0xa8, 0x2f, 0x8d, 0x76 },
+	{ 0xd3, 0xd2, 0x14, 0xc2, 0xee, 0x61, 0xc3, 0x76, 0x0b, 0xe4, 0x82, 0x27, 0xda, 0xaa, 0x2d, 0xb4 },
+	{ 0x66, 0x22, 0xa2, 0xf2, 0x81, 0xfc, 0xcd, 0x12, 0xd6, 0xd2, 0x9f, 0xe6, 0x83, 0xc9, 0x22, 0x73 },
+	{ 0xc4, 0xbc, 0x47, 0x3f, 0x69, 0xef, 0xdb, 0x8b, 0x64, 0x26, 0xba, 0x65, 0x08, 0x5e, 0xeb, 0xd8 },
+	{ 0x47, 0x50, 0xcc, 0x4d, 0xc4, 0x5c, 0x4d, 0xd2, 0x9f, 0x8a, 0x40, 0x09, 0xf1, 0x57, 0xfe, 0x94 },
+	{ 0xa6, 0x12, 0xc5, 0x7a, 0x62, 0xb1, 0x32, 0x69, 0x16, 0xfd, 0xf9, 0x54, 0x88, 0x5c, 0xab, 0x7e },
+	{ 0x3d, 0x7c, 0x58, 0x69, 0xc4, 0xdd, 0x29, 0x63, 0x85, 0x71, 0x1f, 0xee, 0x12, 0x73, 0x64, 0x38 },
+	{ 0x42, 0xba, 0x82, 0x85, 0x41, 0x83, 0xa2, 0x78, 0x12, 0x72, 0x24, 0xaf, 0xbf, 0xaa, 0x83, 0xfe },
+	{ 0xf3, 0x35, 0xaa, 0xbb, 0xdf, 0x02, 0x7c, 0xea, 0x2b, 0xdc, 0xd2, 0xf1, 0x0c, 0x63, 0xfd, 0x73 },
+	{ 0x11, 0xe0, 0x2c, 0x80, 0xe6, 0x40, 0x25, 0x0d, 0x79, 0x05, 0x93, 0x02, 0x8d, 0x64, 0x3d, 0xce },
+	{ 0x2d, 0xab, 0xd3, 0xfc, 0x0c, 0xf7, 0x16, 0xd6, 0xf5, 0xc9, 0xab, 0x65, 0x02, 0xbd, 0x8d, 0xef },
+	{ 0x12, 0xf3, 0x03, 0x16, 0x1e, 0xe9, 0x82, 0xf3, 0x62, 0x07, 0x55, 0x62, 0x50, 0x43, 0x2d, 0x0c },
+	{ 0xe8, 0x24, 0x67, 0xac, 0xa9, 0x68, 0x07, 0x26, 0x28, 0x87, 0x35, 0x9d, 0xcc, 0x7c, 0x8a, 0x4d },
+	{ 0xce, 0x27, 0x4f, 0xaf, 0xec, 0xce, 0x9e, 0xe5, 0x7e, 0xae, 0x89, 0x60, 0x59, 0x6c, 0xbe, 0xd7 },
+	{ 0xf4, 0xc6, 0x69, 0x10, 0x13, 0x04, 0xb4, 0x1d, 0x14, 0x8c, 0xc3, 0xde, 0xac, 0xa9, 0xa8, 0x55 },
+	{ 0x24, 0x25, 0x7c, 0x0b, 0xba, 0xfe, 0x72, 0x8d, 0xc4, 0x65, 0x41, 0x0b, 0x8f, 0x3a, 0x38, 0xea },
+	{ 0xeb, 0xad, 0xad, 0x15, 0x45, 0xf9, 0xbb, 0x50, 0xe3, 0x5c, 0x4d, 0x8a, 0x0d, 0x2e, 0xa3, 0x66 },
+	{ 0x16, 0x61, 0xfa, 0xfd, 0xe9, 0x60, 0x56, 0x2f, 0x06, 0x01, 0xd2, 0xef, 0x6e, 0x80, 0xc3, 0x1e },
+	{ 0x6d, 0xda, 0x6a, 0x64, 0x6b, 0xd8, 0xe8, 0xd2, 0x35, 0x4b, 0x9d, 0x1a, 0xf5, 0x03, 0xf4, 0xcc },
+	{ 0x16, 0x4c, 0x7e, 0xb3, 0x6a, 0xa7, 0xdc, 0xf7, 0x06, 0xe4, 0xf4, 0x82, 0x1f, 0xef, 0xce, 0xd8 },
+	{ 0x47, 0x26, 0xd4, 0xb8, 0xc5, 0xe9, 0x59, 0x63, 0x9f, 0x50, 0x86, 0x2f, 0x52, 0x35, 0x15, 0x09 },
+	{ 0x52, 0xe3, 0x26, 0x9e, 0xfe, 0x9d, 0xe7, 0x49, 0xa2, 0x31, 0xaf, 0xd0, 0x54, 0xd6, 0xb5, 0x17 },
+	{ 0x71, 0xf4, 0x70, 0x22, 0x3a, 0x6a, 0xd5, 0x30, 0xd9, 0xd0, 0xa5, 0xf4, 0xd5, 0xfb, 0xb7, 0xc7 },
+	{ 0xda, 0x8a, 0xdd, 0x33, 0xd8, 0x3d, 0xde, 0x36, 0x6a, 0x5c, 0x80, 0x5b, 0x4b, 0xe5, 0xfe, 0x0d },
+	{ 0xea, 0x31, 0x6a, 0x0b, 0x91, 0xb1, 0xfd, 0x54, 0xfa, 0xc9, 0x39, 0x0a, 0xbd, 0x78, 0xec, 0xca },
+	{ 0xf7, 0x8e, 0x24, 0x59, 0x2c, 0xc1, 0xd5, 0xee, 0xcf, 0xb8, 0x72, 0x12, 0xdc, 0x0e, 0x9f, 0x40 },
+	{ 0x01, 0x24, 0x24, 0x5e, 0xae, 0x13, 0x8c, 0xb7, 0xe9, 0x7a, 0xfc, 0xe6, 0xcb, 0x3f, 0x5b, 0xcb },
+	{ 0x51, 0x91, 0xdb, 0x28, 0x49, 0xc9, 0x1c, 0xbd, 0xb9, 0xd8, 0x55, 0x2a, 0xa3, 0x43, 0xe8, 0x07 },
+	{ 0x35, 0x87, 0xc0, 0xcc, 0xa4, 0xe6, 0xbd, 0x4d, 0x3d, 0xbd, 0xa5, 0x80, 0x3f, 0x37, 0xba, 0x14 },
+	{ 0xce, 0x3c, 0xcb, 0xf9, 0x6b, 0x88, 0x18, 0x1d, 0x7e, 0xcb, 0x66, 0xcd, 0xa8, 0xfd, 0xb2, 0x1d },
+	{ 0x71, 0x1e, 0x69, 0xb7, 0x38, 0xdd, 0xc8, 0x9f, 0xd9, 0x0a, 0x60, 0xce, 0x74, 0x1e, 0xa1, 0x53 },
+	{ 0x8b, 0x5a, 0xf5, 0x93, 0x73, 0xa3, 0x9e, 0x86, 0x83, 0x3a, 0xa3, 0x51, 0xd6, 0xe2, 0x4a, 0x9b },
+	{ 0x3a, 0xc9, 0x19, 0x6b, 0x2a, 0xda, 0x81, 0xc9, 0xca, 0x61, 0x4d, 0x27, 0x33, 0x9f, 0x62, 0x93 },
+	{ 0x03, 0x46, 0xa3, 0x07, 0x15, 0x16, 0xfc, 0x1d, 0xbb, 0xda, 0xdd, 0xc0, 0x0b, 0xcd, 0xb1, 0x8e },
+	{ 0x31, 0x19, 0xca, 0xe4, 0xd8, 0x6e, 0xea, 0x11, 0x99, 0xc3, 0x28, 0xf3, 0x20, 0xfa, 0x23, 0x02 },
+	{ 0x4c, 0xe6, 0x15, 0x16, 0x47, 0x36, 0xf8, 0x2b, 0x2c, 0xa3, 0x5c, 0x63, 0x22, 0x05, 0x79, 0x2b },
+	{ 0x4a, 0x85, 0x22, 0x8d, 0x62, 0x07, 0x1b, 0x1f, 0x5a, 0xec, 0xe3, 0x42, 0xf4, 0xc3, 0x44, 0x96 },
+	{ 0xcf, 0x3a, 0x26, 0x45, 0x24, 0x77, 0xfc, 0xcb, 0x67, 0xb0, 0x4b, 0xc0, 0x1c, 0x4b, 0xae, 0x15 },
+	{ 0x0d, 0x5d, 0xba, 0x4d, 0x9b, 0x0f, 0xd8, 0x99, 0xd5, 0xee, 0x38, 0x08, 0x1f, 0x96, 0xb2, 0x75 },
+	{ 0xc6, 0x60, 0xde, 0x29, 0xd4, 0x98, 0x71, 0xa5, 0x36, 0xd8, 0x6c, 0xb2, 0x6b, 0x83, 0x86, 0xf8 },
+	{ 0x07, 0x36, 0xb1, 0x30, 0xe5, 0x34, 0xf5, 0x0c, 0x5f, 0x26, 0x2c, 0xc1, 0x4d, 0xa2, 0x8c, 0xfd },
+	{ 0x92, 0xe8, 0xc5, 0x70, 0x5e, 0x0c, 0xc6, 0xd7, 0xe2, 0x78, 0xe6, 0xab, 0xa8, 0xfa, 0x32, 0x69 },
+	{ 0xa8, 0xe0, 0x53, 0xfa, 0xcb, 0xcd, 0xbb, 0xf1, 0xe8, 0xe8, 0x66, 0x7b, 0x8a, 0xa4, 0x2f, 0x2a },
+	{ 0x58, 0x88, 0x18, 0x7a, 0xb0, 0xd1, 0xa4, 0x23, 0x18, 0xa8, 0xea, 0xa4, 0x02, 0x32, 0x97, 0x33 },
+	{ 0x87, 0xd7, 0x82, 0x61, 0x28, 0x72, 0x51, 0x13, 0xdf, 0x23, 0x49, 0x57, 0x68, 0x14, 0xc0, 0x42 },
+	{ 0x69, 0xd5, 0xe0, 0xf0, 0x1b, 0x00, 0x76, 0xac, 0x91, 0xe2, 0x71, 0xad, 0x63, 0x9d, 0x24, 0x18 },
+	{ 0x7e, 0x12, 0xb7, 0x90, 0x57, 0x4d, 0x40, 0x24, 0xae, 0x68, 0x47, 0xb6, 0x06, 0xde, 0x8c, 0x6b },
+	{ 0xa9, 0x9b, 0x0b, 0xe4, 0xfd, 0x41, 0xe7, 0x93, 0xd1, 0xd2, 0x11, 0x42, 0xc9, 0x0d, 0xc4, 0x97 },
+	{ 0xa2, 0xe3, 0x42, 0x72, 0x14, 0x66, 0xcc, 0xd3, 0x72, 0x5a, 0x14, 0x0e, 0x58, 0xd3, 0xf2, 0x3d },
+	{ 0x03, 0xf2, 0xb2, 0xdd, 0x17, 0x30, 0x15, 0x40, 0xbb, 0x66, 0x69, 0x0d, 0xce, 0x87, 0xdf, 0x76 },
+	{ 0x1d, 0x2e, 0x3f, 0xba, 0x52, 0xf6, 0xea, 0x26, 0x65, 0x96, 0xac, 0x90, 0x2f, 0x4c, 0x89, 0xbe },
+	{ 0xf1, 0xfe, 0xae, 0xc7, 0xf9, 0x46, 0x92, 0x4c, 0x59, 0x5f, 0x14, 0xab, 0x7d, 0x44, 0xb2, 0x6a },
+	{ 0x86, 0x5b, 0x3f, 0x57, 0x74, 0x2a, 0x93, 0x17, 0xf6, 0x90, 0x35, 0xd7, 0x17, 0x5f, 0x09, 0xa7 },
+	{ 0xbc, 0xe0, 0x5a, 0x6f, 0xd1, 0xff, 0x34, 0x14, 0x1c, 0x33, 0xc0, 0x4a, 0xcb, 0xe3, 0xbe, 0xb3 },
+	{ 0x1b, 0xf7, 0x43, 0xc6, 0x6c, 0x3a, 0x01, 0x89, 0x93, 0x19, 0xee, 0x49, 0xa0, 0x2d, 0x3e, 0xb5 },
+	{ 0x2e, 0x3c, 0x93, 0x51, 0x40, 0xf8, 0x4e, 0x09, 0xde, 0x79, 0x9c, 0x52, 0xa2, 0x03, 0x39, 0xd1 },
+	{ 0x74, 0xa7, 0xaf, 0x20, 0xd4, 0x6d, 0x7d, 0xca, 0x94, 0xe0, 0x77, 0xbb, 0xb5, 0xcf, 0xb9, 0x6c },
+	{ 0xc1, 0xf4, 0x8c, 0xf6, 0x4f, 0x32, 0xba, 0xba, 0xa9, 0xf9, 0x0a, 0x32, 0xd9, 0xf8, 0xf4, 0xed },
+	{ 0x1e, 0xfe, 0x72, 0xee, 0x03, 0x24, 0x90, 0x00, 0x4e, 0x9d, 0x34, 0xc4, 0xbd, 0x46, 0x12, 0x72 },
+	{ 0xf5, 0x6c, 0xa5, 0xaf, 0xc5, 0xbe, 0x65, 0x88, 0xfd, 0x58, 0x91, 0x38, 0x9c, 0x81, 0x48, 0x7d },
+	{ 0x08, 0xdc, 0xec, 0xcf, 0x97, 0xef, 0xa6, 0x77, 0x48, 0xf3, 0xf9, 0x1a, 0x3d, 0x7a, 0x2c, 0x25 },
+	{ 0x09, 0x04, 0x40, 0xb0, 0x4e, 0x51, 0x7e, 0x95, 0x31, 0x12, 0x99, 0xe7, 0x4f, 0xea, 0x10, 0xa9 },
+	{ 0x40, 0x6e, 0x0b, 0x47, 0xdc, 0x0d, 0x3f, 0xa3, 0x40, 0xd8, 0x88, 0xfb, 0xe0, 0xfa, 0x43, 0xaf },
+	{ 0x35, 0x5d, 0xc8, 0x37, 0xa6, 0x73, 0xca, 0xde, 0x3d, 0x83, 0xeb, 0xa6, 0xa0, 0x14, 0xd1, 0x88 },
+	{ 0x99, 0xf4, 0x7e, 0x0c, 0x45, 0xce, 0xc7, 0x75, 0x41, 0x65, 0x58, 0x93, 0x57, 0x7a, 0xd6, 0xda },
+	{ 0xfc, 0xd0, 0x7d, 0xf7, 0xb1, 0xb4, 0x99, 0x6a, 0x5c, 0x5d, 0x1a, 0xb9, 0xcf, 0x76, 0x47, 0xbf },
+	{ 0xc1, 0x1e, 0x85, 0x8b, 0x4e, 0xa5, 0xad, 0x29, 0xa9, 0x33, 0xc5, 0x0b, 0x78, 0x1b, 0xde, 0x79 },
+	{ 0x0f, 0x6a, 0xbd, 0xac, 0x82, 0x58, 0xce, 0xc8, 0xa7, 0x31, 0x3d, 0x75, 0x0f, 0x92, 0x14, 0xf3 },
+	{ 0xe4, 0xf5, 0xe4, 0xa3, 0x5b, 0x1d, 0xa1, 0x90, 0x84, 0xe4, 0x4f, 0x56, 0x9c, 0xf3, 0xd1, 0x0c },
+	{ 0xfb, 0xe7, 0x9e, 0xf6, 0x78, 0x7f, 0x2f, 0xf3, 0x73, 0x95, 0x12, 0x33, 0xab, 0xba, 0x40, 0x0d },
+	{ 0x68, 0x05, 0xad, 0xbc, 0x6a, 0xd2, 0xd0, 0xd2, 0xa8, 0xdb, 0xe9, 0x79, 0xd5, 0xa2, 0x9b, 0x64 },
+	{ 0xf9, 0x86, 0xab, 0x6d, 0x94, 0x50, 0x52, 0xe6, 0xa1, 0xde, 0x99, 0x12, 0x7d, 0x79, 0x0c, 0x78 },
+	{ 0x5a, 0x95, 0x1b, 0xd9, 0x97, 0x1a, 0x9b, 0x52, 0xea, 0xea, 0xee, 0x11, 0xf3, 0x2d, 0xf9, 0xb0 },
+	{ 0x19, 0x3e, 0x31, 0x91, 0x82, 0xd7, 0xf1, 0x37, 0xc1, 0x4a, 0x5e, 0x90, 0xed, 0x76, 0xae, 0x4f },
+	{ 0x5a, 0xaa, 0x97, 0x23, 0x17, 0xd4, 0x14, 0x8a, 0xea, 0x07, 0xcc, 0x7e, 0x42, 0xbf, 0xed, 0xf6 },
+	{ 0x4a, 0xee, 0x8e, 0x01, 0xdf, 0xa6, 0x7b, 0x34, 0x5a, 0x7d, 0x35, 0x63, 0x81, 0x9a, 0x0b, 0xf4 },
+	{ 0x68, 0x44, 0x21, 0x9c, 0xe8, 0xfe, 0x3d, 0x79, 0xa8, 0x32, 0x81, 0xc0, 0xc3, 0x56, 0x79, 0x36 },
+	{ 0x23, 0x40, 0xcc, 0x8c, 0x89, 0x17, 0x54, 0x7c, 0xdb, 0x41, 0xdc, 0x6a, 0xb1, 0xae, 0xba, 0xf0 },
+	{ 0x6a, 0x27, 0x2c, 0x66, 0xd1, 0xd4, 0x40, 0x39, 0x7a, 0x3b, 0xcb, 0x53, 0x15, 0x30, 0xf2, 0x27 },
+	{ 0x21, 0x72, 0x3d, 0x0d, 0x20, 0xfb, 0xca, 0xf3, 0x09, 0x56, 0x6f, 0x44, 0xaf, 0x66, 0x36, 0x45 },
+	{ 0x9c, 0xe6, 0x31, 0xea, 0x5c, 0xfe, 0xdc, 0xb5, 0xfc, 0xcb, 0xc1, 0xa0, 0x25, 0x02, 0xb6, 0x51 },
+	{ 0x90, 0x2f, 0xb3, 0x3b, 0x74, 0xa9, 0xb6, 0x86, 0x10, 0xaa, 0x56, 0xf2, 0xf5, 0x43, 0xa3, 0x03 },
+	{ 0x78, 0x3f, 0x9e, 0x9d, 0x9e, 0x58, 0x44, 0x75, 0x38, 0x14, 0xaf, 0x22, 0x73, 0x2f, 0x39, 0x0b },
+	{ 0x54, 0x44, 0x1a, 0x27, 0xe3, 0xcc, 0xc4, 0x56, 0x74, 0xe8, 0x27, 0xf1, 0x82, 0x17, 0xea, 0xac },
+	{ 0x32, 0xaa, 0x89, 0x39, 0x0c, 0x70, 0x22, 0x45, 0x82, 0x73, 0x19, 0xe0, 0xc0, 0x40, 0xcf, 0xe3 },
+	{ 0xdc, 0xac, 0x5c, 0xdd, 0x3e, 0x40, 0x4e, 0x9d, 0x3c, 0xbc, 0x61, 0x35, 0x8b, 0x72, 0x55, 0xd1 },
+	{ 0x73, 0x6a, 0xe0, 0xf5, 0x9d, 0x52, 0x2c, 0x75, 0xab, 0xa4, 0xfb, 0x81, 0x53, 0xce, 0xe0, 0xa2 },
+	{ 0x86, 0xc4, 0xab, 0xcb, 0xf0, 0xc9, 0xf3, 0x2c, 0xf6, 0x21, 0x87, 0xf7, 0xa4, 0x35, 0xd0, 0x04 },
+	{ 0xa9, 0x86, 0x8f, 0x99, 0x7e, 0x88, 0x6d, 0x5c, 0xd1, 0xb5, 0x34, 0xd5, 0x79, 0x7c, 0xcf, 0x51 },
+	{ 0xb6, 0xf8, 0xc5, 0x31, 0x99, 0x51, 0xbf, 0x2d, 0xa6, 0xc1, 0x4a, 0x4a, 0xe8, 0xa3, 0x76, 0x0d },
+	{ 0xb2, 0xf3, 0x3b, 0xbe, 0x49, 0x79, 0x4c, 0x07, 0x02, 0x59, 0x1f, 0xdd, 0x56, 0x3d, 0xa7, 0x58 },
+	{ 0x4e, 0x1d, 0x11, 0x0a, 0x2d, 0xf2, 0xe1, 0xc9, 0xfe, 0x1f, 0x1b, 0xaa, 0xb1, 0x23, 0xc4, 0x34 },
+	{ 0x6d, 0xc5, 0xee, 0x19, 0xec, 0x1e, 0x6f, 0x9b, 0x35, 0x2e, 0xc0, 0xad, 0xa5, 0x72, 0xff, 0x86 },
+	{ 0x68, 0x6e, 0x19, 0x31, 0xe7, 0x71, 0x31, 0xe8, 0xa8, 0x6c, 0x3b, 0x9a, 0x62, 0x79, 0x62, 0xc2 },
+	{ 0x40, 0x1a, 0x1b, 0x1d, 0xdf, 0x27, 0x58, 0xc5, 0x40, 0x64, 0x14, 0x48, 0xa3, 0xb5, 0x71, 0x97 },
+	{ 0x9f, 0x06, 0x0c, 0xdf, 0x7b, 0xef, 0x30, 0xcb, 0xb7, 0x10, 0x88, 0x6d, 0xd9, 0xdc, 0x07, 0x0d },
+	{ 0x8e, 0xb9, 0x43, 0x68, 0x10, 0xc1, 0x5f, 0x42, 0x3e, 0xd6, 0x00, 0x65, 0x78, 0x71, 0x7a, 0x28 },
+	{ 0xf6, 0xe8, 0xe8, 0xb9, 0x79, 0x06, 0x24, 0x84, 0xe6, 0xeb, 0xa4, 0xb8, 0xec, 0x36, 0xff, 0x18 },
+	{ 0x3c, 0x2a, 0x0d, 0xf4, 0x0e, 0x09, 0x5f, 0xd6, 0x9c, 0x18, 0xc6, 0x47, 0x61, 0xe0, 0x96, 0x28 },
+	{ 0x6b, 0xb8, 0xeb, 0xba, 0x04, 0xd6, 0x78, 0x6c, 0x63, 0xeb, 0xbb, 0x40, 0xb5, 0x76, 0x9d, 0x09 },
+	{ 0xff, 0x01, 0xa5, 0xb4, 0x47, 0x11, 0x1c, 0x51, 0x17, 0x1b, 0x1b, 0x0d, 0x8c, 0xb2, 0x04, 0x08 },
+	{ 0x59, 0xb0, 0x6b, 0x5a, 0x67, 0x33, 0x7c, 0x41, 0x01, 0xc7, 0x89, 0x71, 0x15, 0xa2, 0x7b, 0xb7 },
+	{ 0x42, 0xa5, 0x06, 0x3b, 0xc2, 0xc9, 0x28, 0x41, 0x12, 0x55, 0x47, 0x42, 0x70, 0x19, 0x8f, 0xb8 },
+	{ 0xb0, 0x92, 0x48, 0x35, 0x65, 0x4a, 0x6f, 0xfa, 0x30, 0xa2, 0xa6, 0xbc, 0x28, 0xfc, 0x72, 0xc3 },
+	{ 0xae, 0xc4, 0xb9, 0xb5, 0xfb, 0x2d, 0xe6, 0x71, 0x5e, 0xb6, 0x39, 0x96, 0x26, 0xb4, 0xee, 0x17 },
+	{ 0xd7, 0xd7, 0x9e, 0x35, 0x3e, 0x3a, 0x36, 0x9d, 0xaf, 0x4c, 0xae, 0x94, 0x6b, 0x11, 0xfd, 0x68 },
+	{ 0x3a, 0x08, 0x8e, 0x4a, 0xa8, 0x06, 0xef, 0x6f, 0xca, 0xb8, 0xe4, 0x6d, 0x21, 0x53, 0x40, 0x65 },
+	{ 0x10, 0xd1, 0x84, 0x6c, 0xb7, 0xe6, 0x12, 0x8d, 0x90, 0xa7, 0x73, 0x88, 0x10, 0xb6, 0xd6, 0x48 },
+	{ 0x32, 0xe9, 0xfd, 0x18, 0x8a, 0x9c, 0x8f, 0xeb, 0x82, 0xca, 0xb0, 0x26, 0xaf, 0xf4, 0xac, 0xb5 },
+	{ 0xdd, 0x3d, 0x1c, 0x32, 0x72, 0x41, 0x86, 0xd0, 0x25, 0x6c, 0x52, 0x22, 0x2b, 0xb9, 0x00, 0xb3 },
+	{ 0x24, 0xd1, 0x8b, 0xe1, 0xbc, 0x18, 0x8c, 0xaf, 0xc4, 0xf1, 0xcc, 0x57, 0x51, 0xf5, 0x65, 0xd2 },
+	{ 0x34, 0xf6, 0x00, 0x78, 0x71, 0xe5, 0x85, 0x1a, 0x54, 0x0d, 0xb5, 0x93, 0x9f, 0xf0, 0x0e, 0x33 },
+	{ 0x27, 0x6f, 0x4e, 0x95, 0xd7, 0x62, 0xba, 0x11, 0x7f, 0xe4, 0xc1, 0xb1, 0xe1, 0x37, 0x73, 0x31 },
+	{ 0xd6, 0x70, 0xd7, 0x75, 0x09, 0xac, 0xf1, 0xd8, 0xc6, 0xd6, 0x77, 0x81, 0x6a, 0xed, 0x3a, 0x13 },
+	{ 0xde, 0xe3, 0x57, 0xd1, 0x24, 0xfc, 0x37, 0x3b, 0x0e, 0x39, 0x20, 0x7c, 0x1a, 0x91, 0xa0, 0xda },
+	{ 0xc4, 0xd1, 0xc3, 0x89, 0xe8, 0xa8, 0x55, 0xc3, 0x64, 0x43, 0x97, 0xd2, 0x57, 0xef, 0xdf, 0x1e },
+	{ 0x8b, 0x84, 0xed, 0x28, 0x72, 0x16, 0x92, 0xf5, 0x83, 0x74, 0x5d, 0x2b, 0x75, 0x05, 0x34, 0x27 },
+	{ 0x7b, 0xb3, 0x68, 0xbc, 0xba, 0x2f, 0x7f, 0x68, 0xf3, 0xcc, 0xe9, 0xa2, 0x64, 0x4f, 0x5d, 0xde },
+	{ 0xd2, 0x56, 0xd1, 0xb7, 0x3a, 0x1a, 0x05, 0x7b, 0x22, 0x51, 0x6f, 0xa7, 0x89, 0xf5, 0x76, 0x18 },
+	{ 0xee, 0x4b, 0x70, 0xc9, 0x5f, 0x43, 0xea, 0xb2, 0x9e, 0x4f, 0x42, 0xe4, 0x9d, 0x70, 0xb0, 0xc5 },
+	{ 0x6a, 0x3c, 0xa8, 0xb0, 0x50, 0x8e, 0xba, 0x70, 0x7a, 0x58, 0xa8, 0xc0, 0x64, 0xc1, 0xe6, 0x6d },
+	{ 0x09, 0x19, 0xbc, 0xfa, 0xcd, 0x0a, 0xf8, 0xcc, 0x31, 0x2f, 0x76, 0x54, 0x9f, 0x7b, 0x05, 0xef },
+	{ 0x45, 0xda, 0x5c, 0x7a, 0x60, 0x74, 0xf6, 0x8d, 0xcd, 0xb6, 0xea, 0x7b, 0x73, 0x85, 0xd5, 0xb9 },
+	{ 0xdb, 0xc7, 0xac, 0x5e, 0x0e, 0x59, 0x2f, 0x8c, 0x53, 0x98, 0xfc, 0x94, 0xad, 0xe6, 0xd7, 0xd7 },
+	{ 0x85, 0x5d, 0xe4, 0x0b, 0xbc, 0x3b, 0xaf, 0x68, 0x0d, 0xac, 0x50, 0xe4, 0xa3, 0x11, 0x0e, 0xaf },
+	{ 0xab, 0x11, 0x7b, 0xb7, 0x61, 0x2a, 0x3e, 0xd8, 0xa3, 0xa6, 0x67, 0xcf, 0x46, 0xe0, 0xec, 0x72 },
+	{ 0x5e, 0xd9, 0x19, 0x2c, 0x65, 0x1f, 0x7b, 0x1f, 0x8e, 0xaa, 0xb1, 0xc5, 0x72, 0x48, 0xa6, 0x37 },
+	{ 0x15, 0xd0, 0x3a, 0xa9, 0xb6, 0x5f, 0x1e, 0xfc, 0x1d, 0x51, 0xe1, 0x02, 0xcf, 0x39, 0x18, 0x3d },
+	{ 0x5d, 0xf4, 0x69, 0xad, 0x34, 0x38, 0x5c, 0x0e, 0xa5, 0x86, 0x4c, 0x25, 0x95, 0xbc, 0x28, 0x3e },
+	{ 0xa1, 0xa6, 0x73, 0x47, 0xde, 0x4a, 0x7b, 0x7e, 0x89, 0x1e, 0x98, 0xd4, 0xf5, 0xd1, 0x19, 0x74 },
+	{ 0x2d, 0x14, 0x40, 0x71, 0x89, 0x96, 0x77, 0xeb, 0xf5, 0x5a, 0xfd, 0x85, 0x8f, 0x93, 0x54, 0x4d },
+	{ 0x29, 0xd0, 0x41, 0x1e, 0xbc, 0x91, 0x97, 0x1e, 0x51, 0x9b, 0x3a, 0xd2, 0x0f, 0x79, 0xa7, 0xc6 },
+	{ 0x75, 0x4d, 0xeb, 0xbf, 0x86, 0x28, 0x2f, 0x35, 0x7d, 0xad, 0x45, 0x15, 0xa5, 0xa7, 0x59, 0x94 },
+	{ 0x2f, 0x0c, 0xc7, 0x85, 0xf1, 0x25, 0xf4, 0xe2, 0xc7, 0x80, 0x24, 0x86, 0x30, 0xfe, 0xc1, 0x84 },
+	{ 0xbe, 0x2c, 0xd2, 0xad, 0x36, 0x75, 0x98, 0xe9, 0xee, 0xcc, 0x5b, 0xfe, 0xa9, 0x93, 0xfe, 0x02 },
+	{ 0x83, 0xd2, 0xf8, 0xed, 0xd8, 0x99, 0xde, 0xec, 0x3b, 0xbb, 0x1d, 0xea, 0xd6, 0xad, 0xf0, 0x8d },
+	{ 0x4c, 0xfb, 0x91, 0x60, 0xc6, 0xef, 0x71, 0x63, 0x2c, 0xc0, 0x39, 0xd0, 0x71, 0x96, 0x6d, 0x71 },
+	{ 0x44, 0x73, 0x95, 0xba, 0x2b, 0xe6, 0xb1, 0xc9, 0xe4, 0x40, 0xb4, 0x68, 0x72, 0x61, 0x13, 0x64 },
+	{ 0x0d, 0x87, 0xb2, 0xe2, 0x99, 0x82, 0xcb, 0x08, 0xd5, 0x28, 0xf3, 0xe1, 0xbd, 0xb8, 0x9b, 0x01 },
+	{ 0xa8, 0x34, 0x44, 0x24, 0xc9, 0xb3, 0xa2, 0xcf, 0xe8, 0x5c, 0xdb, 0x2e, 0xc8, 0xe9, 0x01, 0x42 },
+	{ 0x0b, 0x65, 0x33, 0x39, 0x33, 0x80, 0x5b, 0xa2, 0x03, 0xc9, 0x11, 0x08, 0x7e, 0x2b, 0x45, 0x3e },
+	{ 0x18, 0xc2, 0xed, 0x86, 0xce, 0x8f, 0x33, 0x3c, 0xd8, 0xb7, 0x4a, 0x10, 0x9d, 0xc1, 0xf7, 0xb3 },
+	{ 0xde, 0x8f, 0x67, 0xa7, 0x27, 0x16, 0x51, 0x5d, 0x0e, 0xc5, 0xab, 0xc8, 0xdc, 0x4b, 0xce, 0xc2 },
+	{ 0x2b, 0x89, 0x54, 0x53, 0xa6, 0xf4, 0xa6, 0x6f, 0x23, 0x6a, 0xca, 0x8b, 0xc2, 0x2f, 0x37, 0x2c },
+	{ 0xa4, 0x2f, 0xba, 0xb0, 0x79, 0xdb, 0x2f, 0xa9, 0x44, 0xf4, 0xaf, 0xc1, 0x36, 0x83, 0x32, 0x8d },
+	{ 0x71, 0x48, 0x61, 0x4c, 0x37, 0x50, 0xbc, 0x0e, 0xd9, 0x44, 0x1a, 0xa8, 0x13, 0x41, 0x8a, 0xdf },
+	{ 0xe4, 0x0a, 0x61, 0xee, 0xda, 0xd6, 0x1a, 0xc8, 0x84, 0x01, 0x2d, 0xc3, 0xeb, 0x84, 0xc6, 0x52 },
+	{ 0xfc, 0xe5, 0xf9, 0x41, 0x31, 0x6e, 0x13, 0xa2, 0x5c, 0x7a, 0xf7, 0x25, 0x1f, 0x08, 0x3c, 0x05 },
+	{ 0x6f, 0x26, 0xe2, 0xa2, 0xd0, 0x4d, 0x4c, 0xa8, 0x07, 0xe5, 0x38, 0xce, 0xd3, 0xb3, 0x33, 0x1c },
+	{ 0xf7, 0x3a, 0x34, 0x2f, 0x2f, 0xdb, 0xee, 0x10, 0xcf, 0x44, 0xfe, 0x5e, 0x9e, 0xc9, 0xcc, 0x28 },
+	{ 0x2c, 0x83, 0x80, 0x1c, 0x56, 0x95, 0x3f, 0xb8, 0x0c, 0xab, 0x0c, 0x99, 0xef, 0x4c, 0xa9, 0x6b },
+	{ 0x9a, 0x5b, 0x46, 0xcc, 0x79, 0x5c, 0x0c, 0x3a, 0x2a, 0xdb, 0x8e, 0xa6, 0x58, 0x9e, 0x98, 0x30 },
+	{ 0xec, 0x53, 0xe9, 0xb4, 0xf7, 0xb3, 0x6d, 0xbb, 0xcc, 0x29, 0x1b, 0xe4, 0xfc, 0x05, 0x43, 0x8e },
+	{ 0x2c, 0x1a, 0x14, 0xa8, 0xd9, 0xf5, 0xde, 0xa2, 0x0c, 0x1a, 0xbb, 0x78, 0x62, 0x76, 0xe2, 0x0d },
+	{ 0xe0, 0xb1, 0xe6, 0x50, 0x8e, 0x18, 0xc1, 0xc3, 0xe0, 0x24, 0x8d, 0xa2, 0x1c, 0xd9, 0x24, 0x86 },
+	{ 0x44, 0x49, 0x9d, 0x25, 0x2d, 0x73, 0xbe, 0x5a, 0xe4, 0x06, 0xfa, 0x8e, 0xd3, 0x3e, 0x2a, 0xd8 },
+	{ 0xcb, 0x35, 0x9c, 0xd1, 0xd4, 0x9e, 0x89, 0xa5, 0xc3, 0x47, 0x20, 0x53, 0x8b, 0xe4, 0xde, 0x60 },
+	{ 0x04, 0x98, 0xee, 0x7c, 0xca, 0xea, 0xc6, 0xaa, 0xa4, 0x33, 0x37, 0x67, 0xbd, 0x5f, 0x7f, 0x9e },
+	{ 0x7b, 0x4a, 0xfc, 0x47, 0x3e, 0x90, 0x1e, 0x53, 0xf3, 0x3b, 0x98, 0x82, 0xd7, 0x78, 0x96, 0x80 },
+	{ 0xce, 0xa9, 0x66, 0xf0, 0xf0, 0x75, 0xc4, 0x98, 0x7e, 0x00, 0x5b, 0xd3, 0x7c, 0x04, 0x03, 0x34 },
+	{ 0x7c, 0x44, 0x28, 0x11, 0xee, 0x30, 0xb7, 0x9b, 0xdc, 0x7c, 0xda, 0x8f, 0x04, 0x96, 0x08, 0xc0 },
+	{ 0x4c, 0xa7, 0xa1, 0x36, 0xc9, 0x09, 0x8b, 0x85, 0x2c, 0x4c, 0xc5, 0x1c, 0x34, 0x51, 0x9b, 0x59 },
+	{ 0x67, 0xb3, 0x61, 0x47, 0xb5, 0xfd, 0x05, 0x46, 0xbf, 0x82, 0x90, 0xd3, 0x23, 0x10, 0xce, 0x54 },
+	{ 0x3f, 0xb3, 0x53, 0x5d, 0xaa, 0x99, 0x13, 0x01, 0x57, 0xee, 0xdd, 0x34, 0xa2, 0x91, 0xaf, 0x41 },
+	{ 0x3e, 0x76, 0x84, 0x32, 0x74, 0x7e, 0xc2, 0xab, 0x6e, 0xb2, 0x61, 0xfb, 0x3f, 0x90, 0xd6, 0x77 },
+	{ 0xee, 0x8a, 0xe4, 0xa8, 0xdd, 0x6f, 0x57, 0x59, 0x9e, 0xa6, 0xd9, 0x2a, 0x8c, 0x24, 0x8e, 0x97 },
+	{ 0xe4, 0x34, 0x59, 0x83, 0xd9, 0x49, 0x0e, 0x37, 0x84, 0x3b, 0xe7, 0x9c, 0x8a, 0xa7, 0xaf, 0xde },
+	{ 0x15, 0xbb, 0xbe, 0x5e, 0x37, 0xa6, 0xa4, 0xc4, 0x1d, 0x34, 0x04, 0x96, 0x7f, 0xa8, 0x23, 0xf7 },
+	{ 0xa8, 0x0a, 0x4c, 0x8f, 0xca, 0x40, 0xaf, 0x60, 0xe8, 0x22, 0x21, 0x55, 0x29, 0xc7, 0x18, 0xb6 },
+	{ 0x78, 0xeb, 0xad, 0x73, 0xa1, 0x72, 0x5d, 0x97, 0x38, 0xa0, 0x3a, 0x6f, 0x35, 0xea, 0x66, 0xf3 },
+	{ 0xf3, 0xf6, 0x35, 0xdc, 0x61, 0xd6, 0x0e, 0x44, 0x2b, 0x85, 0x3b, 0xab, 0x1e, 0xaf, 0x1f, 0xa2 },
+	{ 0x8a, 0x8a, 0xc1, 0x5f, 0xc2, 0x75, 0xf9, 0xac, 0x9a, 0x33, 0x1b, 0x1e, 0x48, 0xe8, 0xc1, 0xe7 },
+	{ 0x9a, 0x9a, 0xba, 0xab, 0xf7, 0x88, 0x79, 0xe0, 0x2a, 0x32, 0x26, 0xed, 0x46, 0x52, 0x76, 0x02 },
+	{ 0xea, 0x70, 0xde, 0xea, 0x0e, 0xde, 0x6a, 0xfb, 0xfa, 0x20, 0xd1, 0x50, 0xab, 0x2c, 0xca, 0x9c },
+	{ 0xf5, 0x96, 0x9d, 0x44, 0xc4, 0x31, 0x59, 0xf7, 0xfd, 0x92, 0x4b, 0x12, 0x3b, 0xa4, 0x31, 0x09 },
+	{ 0x0f, 0xbe, 0xad, 0xd6, 0x7f, 0x3e, 0xb5, 0xa6, 0xa7, 0xa5, 0xb1, 0x28, 0x4d, 0xd7, 0xe6, 0x0a },
+	{ 0x07, 0xe2, 0xc0, 0x06, 0xe8, 0x4e, 0x0e, 0x2f, 0x5f, 0xb2, 0xb7, 0x0d, 0x10, 0x5d, 0xba, 0xe5 },
+	{ 0x7b, 0x89, 0x70, 0x27, 0xbc, 0xbc, 0x8b, 0xf9, 0xf3, 0x92, 0x2f, 0xc9, 0xc5, 0x2c, 0x74, 0x52 },
+	{ 0xc1, 0xa0, 0x9c, 0xcc, 0x52, 0x4c, 0xd3, 0xdc, 0xa9, 0x85, 0x96, 0x7e, 0x9b, 0xb3, 0x22, 0xd6 },
+	{ 0x8a, 0x08, 0xaa, 0x1e, 0xbe, 0xce, 0xd3, 0xf9, 0x9a, 0xe1, 0x49, 0xab, 0x24, 0x50, 0x7d, 0x8b },
+	{ 0x01, 0xe5, 0xaf, 0x7e, 0x30, 0xe7, 0x1e, 0x11, 0xe9, 0x23, 0x65, 0xa0, 0xdd, 0x8b, 0x7d, 0xf9 },
+	{ 0x18, 0x2f, 0x89, 0x7d, 0x53, 0x7d, 0xdf, 0xb7, 0xd8, 0xec, 0x3e, 0x16, 0x71, 0xc8, 0x47, 0xca },
+	{ 0x55, 0xff, 0xd1, 0x10, 0x15, 0x41, 0xf0, 0xf8, 0x5d, 0xd2, 0xd2, 0xb7, 0xc1, 0x80, 0x7e, 0x1a },
+	{ 0x80, 0x0a, 0x3e, 0xa5, 0xbf, 0xdc, 0xbc, 0x1b, 0x80, 0x8e, 0x6e, 0xb6, 0xa7, 0x48, 0xfa, 0xa2 },
+	{ 0x47, 0x11, 0x58, 0x6e, 0x46, 0x30, 0xe0, 0x2b, 0x9f, 0x33, 0xa9, 0xc2, 0x02, 0xa4, 0x20, 0xc3 },
+	{ 0x64, 0xd6, 0x2a, 0xb4, 0x1c, 0x87, 0x6a, 0x3d, 0x04, 0x39, 0x04, 0x33, 0xa5, 0x19, 0xe3, 0x23 },
+	{ 0xe9, 0x76, 0xb2, 0x21, 0x5f, 0x3d, 0xd2, 0xb2, 0x11, 0xe0, 0x8e, 0x43, 0x7e, 0x0f, 0x58, 0x5d },
+	{ 0xfb, 0xd2, 0x22, 0xac, 0xf9, 0xc5, 0xb5, 0xbb, 0x73, 0x78, 0x35, 0xc6, 0x5b, 0x29, 0x4c, 0xc7 },
+	{ 0x01, 0xd0, 0x33, 0x34, 0xb1, 0x2d, 0xa5, 0xd9, 0xe9, 0x06, 0x88, 0x33, 0x8e, 0xfa, 0x88, 0xb3 },
+	{ 0x98, 0x24, 0x4b, 0xd8, 0x93, 0xa0, 0x22, 0x9c, 0x58, 0x5e, 0xd0, 0x5f, 0xc9, 0x7f, 0x4d, 0x27 },
+	{ 0x41, 0x96, 0x5e, 0x27, 0x93, 0x6f, 0x16, 0xc1, 0x29, 0xf7, 0x27, 0xc8, 0xf3, 0x6a, 0x28, 0x33 },
+	{ 0x11, 0x4d, 0xc8, 0x76, 0x6b, 0x2e, 0xd1, 0x88, 0x79, 0x3a, 0x87, 0x08, 0x61, 0x6b, 0x8d, 0xe4 },
+	{ 0x04, 0x44, 0xfe, 0x52, 0xcd, 0x04, 0xe0, 0xcc, 0xa4, 0xbf, 0xc2, 0xb3, 0x7f, 0x1a, 0xad, 0x86 },
+	{ 0x00, 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x00, 0x1d, 0xdd, 0x6c, 0x4f, 0x91, 0xf4, 0x45 },
+	{ 0x96, 0x6b, 0x38, 0xa3, 0xa9, 0x3d, 0x13, 0x4b, 0x86, 0x8f, 0x40, 0xa6, 0x16, 0xc9, 0xbd, 0xc1 },
+	{ 0x3f, 0x89, 0x5b, 0xc8, 0xab, 0x26, 0x20, 0x92, 0x57, 0xb4, 0x23, 0x5b, 0x03, 0x6f, 0xc6, 0xb5 },
+	{ 0xeb, 0x98, 0x31, 0xcb, 0xc5, 0x3f, 0x42, 0x19, 0xe3, 0x3f, 0x70, 0x1d, 0xbe, 0x9c, 0xae, 0x20 },
+	{ 0xd4, 0x4e, 0x58, 0xcc, 0xa2, 0xa9, 0x81, 0x72, 0xf4, 0x76, 0x96, 0xa7, 0x2a, 0x60, 0xe4, 0x4f },
+	{ 0x9e, 0xb4, 0xc0, 0x69, 0xc6, 0x1a, 0x66, 0x3e, 0xce, 0xb7, 0x2e, 0xc7, 0x27, 0x4a, 0x3a, 0xfd },
+	{ 0x61, 0x77, 0xdc, 0xdf, 0x7f, 0x69, 0xa9, 0x81, 0x49, 0x9d, 0xa6, 0x1f, 0x03, 0x8b, 0xb3, 0x96 },
+	{ 0xe9, 0xf4, 0x9a, 0xe0, 0x5a, 0x96, 0xac, 0xff, 0x11, 0x8e, 0xbd, 0xd0, 0x5a, 0x77, 0x13, 0x01 },
+	{ 0x72, 0x5b, 0x38, 0xe2, 0x6e, 0xf8, 0x19, 0xf5, 0xc2, 0x46, 0xdc, 0x07, 0xd7, 0x1f, 0x7a, 0x1d },
+	{ 0x29, 0x0f, 0xb6, 0xfd, 0x39, 0xbe, 0x04, 0xc5, 0x51, 0xf2, 0xd1, 0x18, 0xfe, 0x2c, 0x85, 0x98 },
+	{ 0x1e, 0x95, 0x06, 0x7a, 0x87, 0x84, 0x2f, 0xeb, 0x4e, 0x0c, 0xe3, 0xa3, 0x30, 0x70, 0x4b, 0x14 },
+	{ 0xdf, 0x35, 0xa3, 0x46, 0xda, 0xd0, 0x02, 0xc8, 0xf7, 0x91, 0x79, 0x22, 0xcc, 0x23, 0x6e, 0xea },
+	{ 0x78, 0xac, 0x39, 0x94, 0x23, 0x46, 0xf0, 0xf0, 0x38, 0x49, 0xa3, 0x28, 0x47, 0x36, 0x89, 0x21 },
+	{ 0x8b, 0x6f, 0x71, 0xde, 0xf2, 0x5c, 0x18, 0xbe, 0x83, 0x57, 0x80, 0xbe, 0x25, 0x74, 0x3f, 0xe1 },
+	{ 0x71, 0x09, 0xed, 0x6c, 0xb9, 0x23, 0x4f, 0x68, 0xd9, 0xed, 0x82, 0x61, 0x25, 0x8d, 0xac, 0x0d },
+	{ 0x66, 0xe3, 0x2d, 0x13, 0x04, 0xd0, 0x60, 0x6c, 0xd6, 0x7b, 0x08, 0xa0, 0x95, 0x15, 0x45, 0xa1 },
+	{ 0xed, 0xe4, 0xa8, 0x09, 0x2b, 0xb5, 0xa5, 0xee, 0xb5, 0xd9, 0x0b, 0xd1, 0x9c, 0x4c, 0xee, 0x6f },
+	{ 0xc7, 0x1b, 0x96, 0x13, 0x06, 0x0d, 0x9d, 0x47, 0x1f, 0xc2, 0x17, 0x79, 0xaa, 0xec, 0x1a, 0x66 },
+	{ 0x0f, 0xd3, 0x29, 0x21, 0xff, 0xf7, 0x2e, 0xde, 0xa7, 0xc2, 0x8e, 0x95, 0x9c, 0x68, 0xdb, 0x50 },
+	{ 0xc1, 0xca, 0x94, 0x61, 0x51, 0xbf, 0xc6, 0x4b, 0xa9, 0xbf, 0x50, 0x58, 0x3a, 0xd6, 0x0b, 0x62 },
+	{ 0xd8, 0x68, 0x5e, 0x8a, 0x71, 0x3b, 0x6e, 0xd0, 0x98, 0xfc, 0x9e, 0x81, 0x0b, 0x58, 0xa8, 0x4a },
+	{ 0xc4, 0x68, 0x57, 0x15, 0x6c, 0x09, 0xf5, 0xad, 0x64, 0xb2, 0x45, 0xb2, 0xca, 0x18, 0x19, 0xc1 },
+	{ 0x40, 0x05, 0x9f, 0xd2, 0x5f, 0x6e, 0xde, 0x8d, 0x40, 0x47, 0x37, 0xdb, 0x53, 0x24, 0x7d, 0x51 },
+	{ 0xc9, 0xfe, 0xa0, 0xdd, 0xee, 0xe2, 0x9f, 0x07, 0xf1, 0xca, 0x61, 0x0c, 0xfc, 0xc5, 0x93, 0x57 },
+	{ 0x01, 0xfa, 0x2b, 0xc9, 0xaf, 0xa0, 0x98, 0x48, 0xe9, 0x40, 0x42, 0x0d, 0x2d, 0x1d, 0x72, 0x3f },
+	{ 0xe0, 0x05, 0xd7, 0x7a, 0x8b, 0xfe, 0xa7, 0xa1, 0xe0, 0x98, 0x01, 0x56, 0x5a, 0x1e, 0xf7, 0x9d },
+	{ 0xca, 0x0d, 0x49, 0xf1, 0x1d, 0x3d, 0xb2, 0x87, 0xda, 0x28, 0x81, 0x86, 0x78, 0x74, 0xfa, 0xdc },
+	{ 0x32, 0xd4, 0x81, 0xce, 0x0a, 0xe3, 0x15, 0xb4, 0x82, 0xad, 0xd3, 0xb9, 0x5f, 0x63, 0xb8, 0x6f },
+	{ 0x75, 0x38, 0x6f, 0x75, 0x07, 0x6f, 0xb5, 0xfd, 0x7d, 0x90, 0x68, 0xa8, 0x55, 0x16, 0x65, 0x4e },
+	{ 0x30, 0xdc, 0xfa, 0xb9, 0xa2, 0x53, 0x99, 0xbc, 0xb0, 0x87, 0xac, 0xb9, 0xbe, 0xf8, 0x4a, 0x38 },
+	{ 0x10, 0xfb, 0x7c, 0x01, 0xb6, 0x59, 0x06, 0xfc, 0x90, 0xe1, 0x2d, 0x62, 0xaf, 0xd8, 0xbf, 0xd4 },
+	{ 0x26, 0x5c, 0x77, 0xff, 0x9f, 0xba, 0x5c, 0x2b, 0x96, 0xe2, 0xff, 0x51, 0x1e, 0x59, 0x83, 0xf3 },
+	{ 0x81, 0xef, 0xed, 0x23, 0xf0, 0xc3, 0xdb, 0x2c, 0x69, 0xb2, 0xd3, 0x56, 0x85, 0xd4, 0x77, 0x9c },
+	{ 0x26, 0x1d, 0x03, 0x20, 0x22, 0x8e, 0xef, 0x84, 0x96, 0x8b, 0x68, 0x0b, 0x30, 0xa5, 0xa5, 0x21 },
+	{ 0x0c, 0xb7, 0x7e, 0xae, 0xe8, 0x54, 0x26, 0x2f, 0xec, 0x21, 0x6b, 0xae, 0x2f, 0xbe, 0x12, 0x4e },
+	{ 0x91, 0xc0, 0x72, 0x90, 0xa7, 0xaa, 0xee, 0xb9, 0xf9, 0x59, 0x47, 0xdf, 0x95, 0x8a, 0x4e, 0xe5 },
+	{ 0x3d, 0xe5, 0xc4, 0xdd, 0x40, 0x7d, 0x8a, 0x78, 0x85, 0x02, 0x71, 0x0e, 0xa0, 0x49, 0x2b, 0x96 },
+	{ 0x40, 0x59, 0x8f, 0xfc, 0x5c, 0x54, 0xc5, 0x6b, 0x40, 0xbb, 0xab, 0x8e, 0x91, 0x69, 0x4f, 0x69 },
+	{ 0x45, 0xc5, 0xe0, 0x2f, 0xe1, 0xba, 0x7c, 0x56, 0xcd, 0x99, 0x0d, 0x0f, 0x24, 0xf4, 0xe0, 0x73 },
+	{ 0x3f, 0xc8, 0xcf, 0xa7, 0x29, 0x53, 0x8d, 0x38, 0x57, 0x0b, 0xbb, 0xa1, 0xf1, 0x22, 0xa4, 0x87 },
+	{ 0x64, 0x3f, 0x97, 0x28, 0x99, 0x26, 0xcb, 0x52, 0x04, 0xca, 0x55, 0x53, 0x32, 0xf0, 0xa9, 0x81 },
+	{ 0xf3, 0x74, 0x1e, 0x9b, 0x5d, 0x2f, 0xe9, 0x90, 0x2b, 0x33, 0x6a, 0x38, 0xfb, 0x16, 0xdb, 0x45 },
+	{ 0x40, 0x44, 0x13, 0xb2, 0xdd, 0x9a, 0x4b, 0x34, 0x40, 0x9e, 0xce, 0x21, 0x42, 0xd8, 0x5a, 0x23 },
+	{ 0x70, 0xa2, 0x25, 0xad, 0x84, 0x95, 0x0a, 0xa4, 0xf0, 0x77, 0x4c, 0x4e, 0x24, 0x69, 0xea, 0xb7 },
+	{ 0x34, 0xcc, 0x08, 0xe3, 0x72, 0x72, 0x92, 0xab, 0x54, 0xd3, 0xfa, 0xb9, 0x00, 0xce, 0x25, 0xa7 },
+	{ 0x29, 0x91, 0xcd, 0x3e, 0x3e, 0x65, 0x2a, 0x78, 0x51, 0x44, 0xa3, 0x8b, 0x21, 0xc5, 0xc9, 0xf4 },
+	{ 0xbc, 0x5e, 0x43, 0x2e, 0xcd, 0x58, 0x0f, 0x61, 0x1c, 0xe1, 0xee, 0xd7, 0xa7, 0x4b, 0x7a, 0x57 },
+	{ 0x6e, 0x2c, 0xb6, 0xd9, 0x20, 0xad, 0xb3, 0x5f, 0x1e, 0xa4, 0xf6, 0xc0, 0xa6, 0x96, 0xc1, 0xdc },
+	{ 0xdb, 0x45, 0x95, 0x1d, 0x0a, 0xb2, 0x09, 0xd9, 0x53, 0x46, 0x2b, 0x22, 0x8a, 0x4e, 0x93, 0x7b },
+	{ 0x7c, 0x05, 0xb4, 0x31, 0x70, 0x04, 0x4a, 0xf5, 0xdc, 0x25, 0x43, 0x49, 0x16, 0xe2, 0x2a, 0xee },
+	{ 0xc0, 0x4e, 0x51, 0x57, 0x9d, 0x77, 0x08, 0x50, 0xc0, 0x2c, 0x3d, 0xd8, 0xe9, 0x20, 0x55, 0xc6 },
+	{ 0x00, 0x54, 0xf0, 0x29, 0xfd, 0xe5, 0xe6, 0xdd, 0x00, 0x74, 0x74, 0xb3, 0x3d, 0x45, 0xd2, 0x17 },
+	{ 0x3d, 0x91, 0xd4, 0xb3, 0x43, 0x97, 0xa3, 0x9a, 0x85, 0x8e, 0xfc, 0x5a, 0x62, 0x04, 0x59, 0x7e },
+	{ 0xee, 0x36, 0xf4, 0x7e, 0xe0, 0x89, 0x70, 0x7b, 0x9e, 0x32, 0x65, 0x77, 0x4e, 0xdf, 0xbb, 0x7f },
+	{ 0xa5, 0x6c, 0x89, 0xdb, 0xaf, 0xf6, 0x80, 0xfe, 0x2d, 0x30, 0x2c, 0xfb, 0x98, 0x84, 0x0b, 0x57 },
+	{ 0x6d, 0x19, 0xdf, 0x43, 0xe9, 0x04, 0x56, 0x79, 0x35, 0xa2, 0x34, 0x61, 0xe3, 0xb7, 0xd1, 0x9e },
+	{ 0xd8, 0x53, 0xe2, 0x3f, 0xf2, 0x81, 0xf4, 0x98, 0x98, 0xdf, 0xc1, 0x14, 0xbc, 0xc6, 0xb3, 0x04 },
+	{ 0xfe, 0x70, 0xe5, 0x5f, 0x14, 0x10, 0xe4, 0x1d, 0x2e, 0x6b, 0x2a, 0x20, 0xec, 0x6b, 0x59, 0x26 },
+	{ 0x3a, 0x47, 0x02, 0x2a, 0x26, 0x33, 0x5c, 0x16, 0xca, 0x0f, 0x7c, 0xb4, 0x0f, 0x07, 0x1e, 0x37 },
+	{ 0x6b, 0xe2, 0xe3, 0x4f, 0x03, 0x49, 0x6c, 0xdb, 0x63, 0x25, 0x76, 0x1a, 0x54, 0x99, 0x86, 0x95 },
+	{ 0x84, 0x63, 0xb8, 0x42, 0x0c, 0x9b, 0x16, 0x20, 0x24, 0x6b, 0x0e, 0xd7, 0x76, 0xf4, 0x9b, 0x6f },
+	{ 0x2e, 0xa5, 0xff, 0xc5, 0xbc, 0x97, 0xaf, 0x1e, 0xde, 0x0a, 0xee, 0x72, 0x2f, 0xda, 0xff, 0x2e },
+	{ 0x74, 0xfb, 0x9f, 0x4a, 0xd1, 0x53, 0x64, 0xa8, 0x94, 0x54, 0xec, 0x6e, 0xf3, 0x14, 0x8c, 0x84 },
+	{ 0x51, 0xbb, 0xd3, 0xbd, 0x47, 0x3c, 0x10, 0x2c, 0xb9, 0x12, 0x10, 0x04, 0x42, 0x66, 0xd1, 0x93 },
+	{ 0xc0, 0x39, 0xd5, 0x0c, 0x1e, 0xbe, 0x8e, 0x18, 0xc0, 0x0f, 0x60, 0x6b, 0x9a, 0x8f, 0x60, 0x80 },
+	{ 0x54, 0x2f, 0x9e, 0xdc, 0x63, 0x13, 0x4b, 0x1f, 0x74, 0xcb, 0x4a, 0x84, 0x33, 0x86, 0xf5, 0x66 },
+	{ 0x65, 0x7c, 0x66, 0x53, 0xcf, 0x41, 0x1c, 0xa8, 0xed, 0x05, 0xd2, 0x8c, 0x94, 0xf1, 0x82, 0x4b },
+	{ 0xe3, 0x79, 0xa1, 0x99, 0xa7, 0xd5, 0xe2, 0x94, 0x9b, 0x51, 0x3c, 0xd6, 0x4b, 0x3e, 0x1b, 0x71 },
+	{ 0x08, 0xb2, 0xf4, 0x3a, 0x99, 0x7c, 0xb3, 0x08, 0x48, 0xb9, 0x3f, 0x41, 0x9e, 0x57, 0x43, 0x99 },
+	{ 0x67, 0x89, 0x69, 0xb2, 0xb6, 0x8a, 0x12, 0xd7, 0xbf, 0x48, 0xd6, 0xf9, 0x84, 0xed, 0xe4, 0xc8 },
+	{ 0xfc, 0x24, 0x6e, 0x21, 0xaf, 0x9a, 0x80, 0x48, 0x5c, 0xd1, 0x8e, 0x6c, 0x0d, 0xbc, 0x19, 0xd7 },
+	{ 0xcd, 0x6c, 0x97, 0xc5, 0xba, 0x5a, 0x73, 0x43, 0x95, 0xc4, 0xde, 0x99, 0x1a, 0x03, 0x2a, 0x6a },
+	{ 0xaf, 0xc2, 0x14, 0x01, 0xb4, 0x1c, 0xca, 0x20, 0x47, 0x9b, 0x1e, 0x89, 0x9a, 0x01, 0xea, 0x0f },
+	{ 0xd9, 0x23, 0x16, 0x74, 0xa3, 0xaf, 0x99, 0x72, 0x81, 0xe6, 0x49, 0x48, 0x4a, 0xc1, 0x3c, 0xb8 },
+	{ 0xbb, 0xa3, 0x8b, 0x44, 0x9b, 0xe4, 0xe3, 0xbe, 0x33, 0xf7, 0x43, 0x11, 0x69, 0xe2, 0xe5, 0xe9 },
+	{ 0x7a, 0x22, 0xa9, 0x67, 0x87, 0x2e, 0x47, 0x35, 0x0a, 0x1d, 0xf9, 0xb5, 0xc4, 0x08, 0xb2, 0xfc },
+	{ 0xea, 0x9a, 0xd6, 0x7f, 0x0d, 0x51, 0x5e, 0x6a, 0xfa, 0x5a, 0x8b, 0x2a, 0x4a, 0x4f, 0xb3, 0x28 },
+	{ 0xc7, 0x5a, 0x0a, 0xf3, 0x83, 0x39, 0x0a, 0xee, 0x1f, 0x19, 0xaf, 0xbf, 0x98, 0xa0, 0xf8, 0x37 },
+	{ 0x16, 0xa0, 0x6e, 0xdd, 0x67, 0x8d, 0xc3, 0xd5, 0x06, 0x58, 0x69, 0x36, 0x5d, 0x34, 0xa1, 0xf0 },
+	{ 0x72, 0x85, 0x30, 0x77, 0x6d, 0x6b, 0x0d, 0x64, 0xc2, 0x80, 0x96, 0xe1, 0x75, 0x42, 0x63, 0xa9 },
+	{ 0x6c, 0x34, 0x2f, 0xc5, 0xb8, 0x1d, 0x37, 0x68, 0x4c, 0x7e, 0xcf, 0xc0, 0x05, 0x2c, 0x54, 0xa5 },
+	{ 0x85, 0x48, 0x68, 0xc1, 0x3c, 0x82, 0x35, 0x31, 0x0d, 0x8f, 0x73, 0x77, 0x54, 0x80, 0x19, 0x69 },
+	{ 0x02, 0x61, 0xf3, 0x88, 0xe4, 0x2e, 0xdd, 0x0c, 0xd2, 0xb6, 0x78, 0x20, 0x2e, 0x41, 0x34, 0x95 },
+	{ 0xea, 0x1c, 0xee, 0xc0, 0x11, 0xf8, 0x83, 0x1d, 0xfa, 0xac, 0x5c, 0x9d, 0x6d, 0xe7, 0xf7, 0x84 },
+	{ 0x97, 0xe7, 0x7b, 0xad, 0x5d, 0x85, 0xd1, 0x46, 0x6f, 0x22, 0x54, 0x26, 0x67, 0x7e, 0x74, 0x5d },
+	{ 0x22, 0xee, 0x80, 0x17, 0xd4, 0x42, 0x89, 0xef, 0xf2, 0xe8, 0x82, 0xc4, 0xff, 0x1b, 0xed, 0xe0 },
+	{ 0xc3, 0x16, 0x0c, 0xa0, 0xb6, 0x34, 0x2a, 0x21, 0x7b, 0x59, 0xec, 0x0b, 0x19, 0x86, 0x4b, 0xb1 },
+	{ 0x49, 0x33, 0xd7, 0x17, 0xad, 0x32, 0x50, 0x92, 0x71, 0x93, 0x8a, 0x9c, 0x42, 0x31, 0x77, 0x86 },
+	{ 0xcb, 0x9e, 0x08, 0x46, 0x51, 0x3e, 0xea, 0xba, 0xc3, 0xd8, 0x71, 0x73, 0x18, 0xbb, 0xa5, 0xbe },
+	{ 0x03, 0x31, 0x27, 0xbd, 0x95, 0x5c, 0x82, 0xe6, 0xbb, 0xbd, 0x00, 0x54, 0xbc, 0x3b, 0xbd, 0x48 },
+	{ 0x7f, 0xa3, 0x76, 0xe5, 0x8a, 0x4e, 0x78, 0x57, 0x97, 0x18, 0x38, 0xa3, 0xa6, 0x24, 0x38, 0x4d },
+	{ 0x30, 0x88, 0x0a, 0x90, 0xa5, 0x6d, 0xb2, 0xde, 0xb0, 0x13, 0x38, 0x06, 0x81, 0xb3, 0x78, 0x20 },
+	{ 0xaf, 0x40, 0xfd, 0xbf, 0xaf, 0x75, 0xa4, 0x6d, 0x47, 0x49, 0x4d, 0x16, 0x77, 0x69, 0xa5, 0xb3 },
+	{ 0x7e, 0x3c, 0xaf, 0x25, 0x56, 0xc0, 0x33, 0x93, 0xae, 0xa2, 0x01, 0x90, 0xa5, 0x00, 0x76, 0xf7 },
+	{ 0xb6, 0xce, 0xcd, 0x9c, 0x9a, 0xde, 0xcb, 0xbe, 0xa6, 0x87, 0x90, 0x70, 0x49, 0x81, 0x8d, 0x81 },
+	{ 0xa7, 0xf7, 0x74, 0xf9, 0x92, 0x98, 0x51, 0x7a, 0xff, 0x20, 0x5f, 0xf5, 0x65, 0xe8, 0x28, 0x78 },
+	{ 0xe5, 0x47, 0x30, 0x19, 0x11, 0xf2, 0x6b, 0x1d, 0x6d, 0x3d, 0xa9, 0xfc, 0x4d, 0x86, 0x9f, 0x1c },
+	{ 0xc8, 0xac, 0x55, 0x68, 0x39, 0x0e, 0xd5, 0x7a, 0x08, 0x72, 0x08, 0x66, 0x4a, 0x33, 0xc6, 0x47 },
+	{ 0xd4, 0x78, 0x50, 0x61, 0xa1, 0x1c, 0x75, 0xe1, 0xf4, 0xb0, 0x50, 0x81, 0xc9, 0x82, 0xcd, 0xdb },
+	{ 0xd7, 0xc2, 0x22, 0xeb, 0xbe, 0x80, 0xbc, 0x65, 0xaf, 0x2f, 0xd1, 0x27, 0x1c, 0x80, 0x08, 0x23 },
+	{ 0xd2, 0x17, 0x5d, 0xd8, 0xbc, 0xed, 0x97, 0xd4, 0x22, 0xfa, 0xd7, 0x60, 0x9b, 0x41, 0x99, 0x46 },
+	{ 0xe2, 0xfd, 0x5d, 0x8f, 0xf3, 0x8d, 0x24, 0x99, 0xb2, 0xbe, 0x28, 0x56, 0xfb, 0x88, 0x64, 0xd5 },
+	{ 0x94, 0x49, 0xb9, 0xf9, 0x42, 0x3b, 0xa3, 0xe4, 0xb4, 0x2f, 0x5f, 0xcc, 0xd6, 0x3b, 0x67, 0xfe },
+	{ 0x6e, 0x56, 0xae, 0x6e, 0x1f, 0x20, 0xa7, 0xce, 0x1e, 0xde, 0xb0, 0x9a, 0x45, 0xb9, 0xaa, 0x68 },
+	{ 0x9d, 0x77, 0xf1, 0x3e, 0x90, 0xff, 0x14, 0xe9, 0xe5, 0x7b, 0xb2, 0x8d, 0xc5, 0x48, 0x61, 0x33 },
+	{ 0xd0, 0x1f, 0xd6, 0xc3, 0x54, 0x5e, 0x1b, 0xdd, 0x50, 0xd4, 0xb0, 0x60, 0xfa, 0xd6, 0x2b, 0x0f },
+	{ 0x8e, 0x0d, 0x34, 0x92, 0x0d, 0xa7, 0x46, 0x20, 0x3e, 0x4a, 0x75, 0x18, 0xb6, 0xb6, 0x4c, 0x40 },
+	{ 0xe6, 0x56, 0xd8, 0x2c, 0x40, 0x4c, 0x7e, 0x9d, 0x56, 0x9b, 0xc8, 0x76, 0xca, 0x34, 0x06, 0xa2 },
+	{ 0xd4, 0x8d, 0xcc, 0xab, 0x20, 0xd6, 0xee, 0x18, 0xf4, 0xcd, 0x2d, 0xee, 0x18, 0x14, 0xc2, 0x21 },
+	{ 0x75, 0x62, 0x67, 0x0a, 0x06, 0xe2, 0xa8, 0x6c, 0x7d, 0xca, 0x22, 0x82, 0xf4, 0x38, 0x4e, 0xda },
+	{ 0x4a, 0xaf, 0x1a, 0x22, 0x61, 0x7a, 0x0e, 0x8e, 0x5a, 0x26, 0x9e, 0x1c, 0x93, 0xe6, 0x2d, 0x22 },
+	{ 0x8d, 0x3d, 0x00, 0x5e, 0x5c, 0x79, 0xa1, 0x46, 0x55, 0x43, 0xed, 0xe4, 0x27, 0xbc, 0xc3, 0x8c },
+	{ 0x08, 0xc7, 0x70, 0x85, 0x18, 0x36, 0x2d, 0x40, 0x48, 0xd6, 0x1c, 0xae, 0xed, 0xe8, 0x37, 0xdf },
+	{ 0x06, 0xe4, 0x65, 0xbb, 0x2f, 0x60, 0x2a, 0x80, 0x76, 0xcd, 0xd2, 0x1a, 0x9c, 0x0f, 0xbf, 0xed },
+	{ 0x3c, 0x54, 0x05, 0x89, 0x0d, 0x7c, 0x52, 0x45, 0x9c, 0x52, 0x80, 0x21, 0x00, 0x03, 0x80, 0xb4 },
+	{ 0x7b, 0xc8, 0xe4, 0x06, 0x3a, 0xe9, 0xf8, 0x9f, 0xf3, 0xe9, 0xc6, 0x0f, 0xb4, 0xe0, 0x51, 0x24 },
+	{ 0xc0, 0x78, 0x49, 0xec, 0x9b, 0xea, 0xfb, 0xbe, 0xc0, 0x66, 0xf7, 0xb1, 0x88, 0x43, 0x3e, 0x52 },
+	{ 0x05, 0x3e, 0x2a, 0x1c, 0x7d, 0xa5, 0x78, 0x15, 0x8d, 0x00, 0x05, 0xc1, 0xac, 0x37, 0x1f, 0xc6 },
+	{ 0x2c, 0x44, 0x0c, 0x3d, 0xd8, 0x68, 0xd2, 0x11, 0x0c, 0x54, 0x75, 0x52, 0x01, 0x99, 0xcb, 0x99 },
+	{ 0x3c, 0x3f, 0x89, 0x3e, 0x8e, 0xc2, 0xd8, 0x0d, 0x9c, 0x35, 0xa3, 0xb4, 0xb0, 0x71, 0x8b, 0x6e },
+	{ 0xb0, 0x53, 0xd4, 0x55, 0xe7, 0x1d, 0x02, 0x54, 0x30, 0x4b, 0x0f, 0x76, 0x3a, 0x48, 0x95, 0xf1 },
+	{ 0xc9, 0x28, 0x99, 0x72, 0xed, 0x55, 0x93, 0x76, 0xf1, 0x04, 0x1c, 0xe6, 0x9a, 0xe8, 0x7c, 0xe3 },
+	{ 0x0d, 0x1e, 0x46, 0x6e, 0x1d, 0xe3, 0x6a, 0xf3, 0xd5, 0x97, 0xa1, 0xc1, 0x30, 0xe2, 0xd4, 0xa3 },
+	{ 0x8b, 0x45, 0x79, 0x49, 0xf4, 0xe9, 0x24, 0x4f, 0x83, 0x1d, 0xc6, 0xe4, 0x86, 0x51, 0x56, 0x55 },
+	{ 0xe2, 0x27, 0x56, 0x24, 0xf2, 0x00, 0x18, 0x08, 0xb2, 0xf8, 0xe2, 0x2f, 0x9a, 0xab, 0x4d, 0x61 },
+	{ 0x02, 0xb5, 0xe3, 0xb2, 0xe1, 0x14, 0xc4, 0xea, 0xd2, 0x2a, 0xed, 0xd3, 0x6b, 0x86, 0x06, 0xad },
+	{ 0x98, 0xa2, 0x33, 0x97, 0x8f, 0xf9, 0xfc, 0xe8, 0x58, 0x0c, 0xff, 0xec, 0xa5, 0xe7, 0x08, 0xcb },
+	{ 0xcf, 0x64, 0x1e, 0xda, 0x22, 0xea, 0xef, 0x3a, 0x67, 0xea, 0x05, 0x9a, 0xbb, 0x6d, 0x97, 0xa1 },
+	{ 0x75, 0x0e, 0x77, 0xe0, 0x08, 0xfc, 0xc1, 0x8e, 0x7d, 0x56, 0xae, 0xce, 0xb6, 0xf3, 0x7b, 0xc2 },
+	{ 0x1d, 0x43, 0xbb, 0x04, 0xd2, 0xaf, 0x64, 0x5e, 0x65, 0xb3, 0x89, 0xfd, 0x7e, 0xdd, 0x7d, 0x04 },
+	{ 0xd1, 0xb0, 0x95, 0x18, 0x88, 0x5f, 0x53, 0x10, 0x39, 0x84, 0xa1, 0x4d, 0x9a, 0x1d, 0xd7, 0xf0 },
+	{ 0x0a, 0x95, 0xff, 0x04, 0x82, 0x52, 0xb6, 0xc8, 0x1a, 0xc2, 0x89, 0xd4, 0xef, 0x30, 0xbc, 0x8a },
+	{ 0x6b, 0x0c, 0xdc, 0xe4, 0x01, 0xbc, 0x5f, 0x4a, 0x63, 0x5f, 0x30, 0xf4, 0xf2, 0xbb, 0x6f, 0x21 },
+	{ 0x06, 0xcf, 0xe9, 0x70, 0xb0, 0xa6, 0xb0, 0x48, 0x76, 0xb0, 0xf5, 0xad, 0x4c, 0x7e, 0xca, 0xa7 },
+	{ 0xfe, 0x31, 0x71, 0x80, 0x96, 0xe3, 0x76, 0x77, 0x2e, 0x14, 0x93, 0xd9, 0xfd, 0xb7, 0x7b, 0x54 },
+	{ 0xdc, 0x82, 0x64, 0x48, 0x40, 0xcd, 0x5a, 0x2e, 0x3c, 0x82, 0xa7, 0x5b, 0xec, 0x4f, 0x6c, 0x45 },
+	{ 0x00, 0x93, 0x64, 0x09, 0x7b, 0x12, 0x54, 0x84, 0x00, 0xcb, 0x0b, 0xfa, 0x2b, 0xf9, 0xaf, 0xe9 },
+	{ 0x11, 0x62, 0x44, 0xc1, 0xea, 0xe7, 0x4a, 0xc0, 0x79, 0x57, 0x64, 0x75, 0xb0, 0xfc, 0x81, 0x2a },
+	{ 0xff, 0xd7, 0xac, 0x1f, 0x49, 0x9e, 0x28, 0xe2, 0x17, 0xe1, 0x60, 0x33, 0xed, 0x8f, 0x1b, 0x7c },
+	{ 0xbb, 0xb8, 0x07, 0x8f, 0x1a, 0x9e, 0x5d, 0xf6, 0x33, 0x14, 0x21, 0x7e, 0xb8, 0x73, 0xda, 0x2f },
+	{ 0x36, 0xaf, 0x13, 0xad, 0x5b, 0x48, 0x95, 0x6b, 0x26, 0xdc, 0x44, 0x4d, 0x52, 0xa7, 0x9e, 0x98 },
+	{ 0xc6, 0x75, 0x5a, 0x74, 0x53, 0x52, 0xeb, 0xdc, 0x36, 0xf5, 0x49, 0x1f, 0xbb, 0x14, 0x7b, 0x3e },
+	{ 0xb6, 0xe3, 0x49, 0xe7, 0x19, 0x98, 0x45, 0xf6, 0xa6, 0xa4, 0x6d, 0xdd, 0x98, 0x12, 0x82, 0xc7 },
+	{ 0xaa, 0x56, 0xc3, 0xcd, 0x2f, 0xb6, 0x12, 0x36, 0xba, 0xbc, 0xbc, 0x08, 0x08, 0x77, 0x58, 0x05 },
+	{ 0xfd, 0xca, 0xa9, 0xc0, 0x61, 0x55, 0x32, 0xb3, 0x45, 0x9e, 0x5c, 0xc6, 0xfc, 0x93, 0xb9, 0xfe },
+	{ 0xbd, 0x71, 0x1a, 0xc4, 0x04, 0x01, 0x6d, 0x47, 0x05, 0xe3, 0xb0, 0x37, 0x6b, 0x2a, 0x6a, 0x95 },
+	{ 0x3c, 0xd6, 0x1c, 0xca, 0x11, 0x23, 0x78, 0xf8, 0x9c, 0xa4, 0x51, 0x94, 0x23, 0x9b, 0xc4, 0x10 },
+	{ 0x51, 0xa6, 0x57, 0x73, 0xc8, 0x82, 0x96, 0xf4, 0xb9, 0xf5, 0x32, 0x97, 0xf2, 0xd4, 0xdc, 0x4d },
+	{ 0x34, 0x78, 0x18, 0xb9, 0x75, 0x8c, 0xab, 0xcd, 0x54, 0x5f, 0x86, 0x06, 0xc3, 0x88, 0x53, 0x8f },
+	{ 0x4d, 0x38, 0x61, 0x8b, 0xfc, 0x0a, 0xc3, 0xb8, 0x15, 0xfc, 0xb5, 0x09, 0xd4, 0x97, 0x46, 0x3b },
+	{ 0x93, 0x79, 0x85, 0xc5, 0x91, 0x0d, 0xfe, 0x0a, 0xcb, 0x28, 0xd7, 0x98, 0x48, 0x41, 0xde, 0x4a },
+	{ 0x7e, 0xe8, 0xbe, 0xfb, 0x58, 0xda, 0x4c, 0xb5, 0xae, 0x2e, 0x8d, 0xdc, 0x67, 0xbb, 0xa3, 0xdf },
+	{ 0x80, 0x88, 0x26, 0x64, 0xbb, 0x35, 0x97, 0x68, 0x80, 0x3c, 0x9d, 0x43, 0x84, 0xb0, 0xb5, 0x46 },
+	{ 0x75, 0x77, 0xe3, 0x54, 0x85, 0x9b, 0x22, 0xa4, 0x7d, 0xe7, 0xff, 0xee, 0x43, 0xca, 0x42, 0x20 },
+	{ 0x04, 0x59, 0x7a, 0x9d, 0x4c, 0xbe, 0x59, 0x04, 0xa4, 0xdc, 0x9f, 0x20, 0xcf, 0xab, 0xa1, 0xcc },
+	{ 0xd1, 0x86, 0x9d, 0x83, 0x89, 0xec, 0x5f, 0xa1, 0x39, 0x4a, 0xe7, 0x73, 0xfb, 0xfa, 0xed, 0x64 },
+	{ 0xc0, 0x0f, 0xdd, 0x77, 0x1f, 0x4b, 0x9b, 0xa9, 0xc0, 0xd5, 0xa5, 0x91, 0xfb, 0x6c, 0x77, 0xf4 },
+	{ 0xb0, 0xbc, 0x40, 0xca, 0x63, 0xbd, 0x62, 0x69, 0x30, 0xdc, 0x60, 0x96, 0xc7, 0x1e, 0x5c, 0x4f },
+	{ 0x55, 0x81, 0xe9, 0x51, 0x19, 0xe8, 0x15, 0xac, 0x5d, 0x24, 0xa4, 0x2a, 0xe5, 0x18, 0xc3, 0x76 },
+	{ 0xbf, 0xe7, 0x89, 0x97, 0x68, 0xe9, 0xc3, 0x8b, 0xd7, 0xb6, 0x06, 0xc5, 0xe8, 0xfc, 0x92, 0x70 },
+	{ 0xc9, 0x13, 0x1d, 0x28, 0x6e, 0x9c, 0x19, 0x3f, 0xf1, 0xe7, 0x3e, 0x79, 0x4b, 0x57, 0x88, 0x9d },
+	{ 0x8c, 0xac, 0x40, 0x09, 0x29, 0x78, 0x69, 0x13, 0x6c, 0x93, 0xfc, 0xf7, 0x87, 0x75, 0x18, 0xab },
+	{ 0x0c, 0x20, 0xeb, 0x22, 0x65, 0xf4, 0x86, 0x44, 0xec, 0xb2, 0xbc, 0xce, 0xbc, 0x94, 0xd9, 0xab },
+	{ 0xd6, 0x46, 0xdf, 0xe0, 0x0a, 0x39, 0xfe, 0x69, 0xc6, 0x9c, 0xbd, 0xa7, 0xcb, 0xca, 0x51, 0x87 },
+	{ 0x52, 0x4c, 0x93, 0x12, 0x7b, 0x3d, 0x48, 0x5f, 0xa2, 0xc2, 0x00, 0xf1, 0xe1, 0xac, 0x7c, 0x75 },
+	{ 0x1d, 0x19, 0xc3, 0x6f, 0xd3, 0x3c, 0x71, 0xef, 0x65, 0x79, 0xcf, 0x23, 0xe0, 0xba, 0x94, 0x78 },
+	{ 0x33, 0xe7, 0x58, 0x64, 0x42, 0x8b, 0x73, 0x9a, 0x6b, 0xaf, 0x95, 0x19, 0x23, 0x42, 0xa8, 0xad },
+	{ 0xd1, 0x5c, 0xa5, 0xee, 0x8a, 0x79, 0x6c, 0x32, 0x39, 0x10, 0x2d, 0x9a, 0x5c, 0xd8, 0x04, 0xd9 },
+	{ 0x77, 0x99, 0x62, 0xfe, 0xeb, 0x9d, 0x92, 0x0a, 0x4f, 0x47, 0xe1, 0xc8, 0x83, 0x57, 0x99, 0xe3 },
+	{ 0x59, 0x2e, 0x54, 0x19, 0x63, 0x8c, 0x56, 0x8e, 0x01, 0x75, 0xb8, 0xfe, 0xf1, 0x09, 0x37, 0x5b },
+	{ 0x90, 0xc6, 0x46, 0xc7, 0xf7, 0x09, 0x56, 0x71, 0x10, 0x19, 0x05, 0xd2, 0x68, 0x6d, 0xdc, 0xa5 },
+	{ 0x17, 0xdd, 0x3d, 0x08, 0x9e, 0xa8, 0x14, 0x2b, 0xef, 0x93, 0xe5, 0x6f, 0xbf, 0x35, 0x7a, 0xba },
+	{ 0xba, 0x3c, 0xc4, 0x84, 0x66, 0x56, 0x9f, 0xfa, 0x4a, 0x81, 0x0d, 0xfe, 0x67, 0xbe, 0x23, 0x94 },
+	{ 0x16, 0x22, 0x86, 0x1e, 0x6c, 0x34, 0xe9, 0x88, 0x06, 0xaa, 0x3a, 0xa9, 0x80, 0xcc, 0xe5, 0x4c },
+	{ 0x94, 0x34, 0x3d, 0xaf, 0xc3, 0x81, 0x29, 0xad, 0xb4, 0x12, 0x82, 0x5f, 0x87, 0xaa, 0x72, 0xb8 },
+	{ 0x94, 0x1f, 0xc1, 0x64, 0x44, 0xc8, 0xaf, 0x75, 0xb4, 0xf5, 0xa4, 0xf2, 0x37, 0x19, 0x7e, 0x72 },
+	{ 0x2f, 0xf7, 0x4a, 0x3b, 0x72, 0x6c, 0x7a, 0xab, 0xc7, 0x63, 0x47, 0x19, 0xe1, 0x6c, 0xcd, 0x3e },
+	{ 0x00, 0x2a, 0xf8, 0x94, 0xfe, 0x72, 0xf3, 0x6e, 0x00, 0x3a, 0xba, 0xd9, 0x9e, 0x22, 0xe9, 0x8b },
+	{ 0x53, 0xf2, 0xce, 0xb1, 0x2d, 0xf8, 0xf9, 0xc9, 0x8b, 0x8f, 0xce, 0x4a, 0xd1, 0x84, 0x1c, 0x9d },
+	{ 0x9e, 0xc9, 0x3c, 0xb4, 0x45, 0xd4, 0xdf, 0x75, 0xce, 0xd4, 0x0b, 0x34, 0x77, 0xdb, 0x2e, 0x43 },
+	{ 0x8b, 0x06, 0x05, 0x6a, 0x76, 0xbd, 0xb7, 0xa8, 0x83, 0xc6, 0x2e, 0x9e, 0x98, 0x9d, 0x78, 0x83 },
+	{ 0x72, 0xc4, 0xa4, 0x56, 0xeb, 0x97, 0x7a, 0x0a, 0xc2, 0xd7, 0x2d, 0x28, 0x64, 0xf6, 0x40, 0x7b },
+	{ 0x9c, 0xa7, 0xbd, 0x0a, 0xdf, 0xd1, 0x6f, 0x0f, 0xfc, 0x74, 0x2a, 0x5a, 0x37, 0x4e, 0xd8, 0x7f },
+	{ 0x12, 0x71, 0xec, 0xd4, 0x19, 0x42, 0x5d, 0x40, 0x62, 0xb5, 0x83, 0xef, 0x2c, 0xab, 0xe8, 0xaf },
+	{ 0x92, 0x66, 0xae, 0x2f, 0x5a, 0x65, 0xa0, 0x24, 0xe2, 0x26, 0x15, 0x39, 0x85, 0x62, 0xee, 0x0c },
+	{ 0x7c, 0x2f, 0xac, 0xc6, 0x6e, 0x77, 0x3d, 0x64, 0xdc, 0x5f, 0xfd, 0x22, 0xb5, 0x04, 0x14, 0x7a },
+	{ 0x04, 0x6e, 0xf6, 0xe7, 0xcb, 0x77, 0xd3, 0x3b, 0xa4, 0xf9, 0x7c, 0x8d, 0x1e, 0x3d, 0x96, 0x12 },
+	{ 0x5e, 0xee, 0x95, 0x76, 0xe4, 0xd8, 0xf4, 0x56, 0x8e, 0xc7, 0x8e, 0x32, 0xc2, 0xd9, 0x9a, 0x7d },
+	{ 0x3b, 0xd8, 0xc1, 0x7e, 0x59, 0x34, 0x94, 0x49, 0xb3, 0xbf, 0x6c, 0xa1, 0xaf, 0x4d, 0xc9, 0x18 },
+	{ 0x3c, 0xeb, 0x98, 0x14, 0x91, 0xdc, 0xf1, 0x2f, 0x9c, 0xc1, 0x2e, 0x01, 0x73, 0x2c, 0xb9, 0x56 },
+	{ 0x26, 0x32, 0x7f, 0x6a, 0xa1, 0x47, 0x69, 0xbc, 0x96, 0xa8, 0x45, 0x78, 0x7f, 0x36, 0x9a, 0x67 },
+	{ 0x7f, 0xf7, 0x66, 0x0f, 0x88, 0x34, 0x5f, 0x35, 0x97, 0x8c, 0xac, 0x56, 0xe4, 0x69, 0x0a, 0x65 },
+	{ 0x1a, 0xba, 0x74, 0x9b, 0x36, 0x1f, 0xb0, 0x33, 0xaa, 0xdd, 0x71, 0x10, 0x3e, 0x2c, 0x65, 0xeb },
+	{ 0xc8, 0xeb, 0xc9, 0x47, 0xb7, 0x3a, 0x42, 0x21, 0x08, 0xc9, 0x9f, 0xac, 0x38, 0xe7, 0xa3, 0x19 },
+	{ 0xcf, 0x79, 0x9a, 0x24, 0xa2, 0xa3, 0x69, 0x72, 0x67, 0x07, 0xe3, 0x06, 0x0b, 0xff, 0x8b, 0xe7 },
+	{ 0xbf, 0xbd, 0x91, 0x02, 0x6a, 0x76, 0xd0, 0x1c, 0xd7, 0x7c, 0x4c, 0xeb, 0x49, 0xda, 0xa9, 0xe4 },
+	{ 0x9a, 0xaf, 0x36, 0xf6, 0x76, 0x42, 0xf3, 0x17, 0x2a, 0x4f, 0x03, 0x5a, 0x96, 0xe3, 0x6a, 0x48 },
+	{ 0x20, 0xcc, 0x01, 0x6e, 0x6d, 0x40, 0x19, 0x89, 0x20, 0x89, 0xa1, 0xea, 0xbf, 0x8e, 0x96, 0x1d },
+	{ 0xe0, 0x9c, 0x6a, 0x06, 0x0f, 0x5f, 0x47, 0x8c, 0xe0, 0x07, 0xb0, 0x35, 0xcd, 0x47, 0x30, 0x40 },
+	{ 0x94, 0x73, 0xb1, 0x8e, 0x41, 0xae, 0x96, 0x53, 0xb4, 0x69, 0x19, 0xa6, 0x75, 0x5e, 0x50, 0x8a },
+	{ 0xdd, 0xfe, 0xa7, 0x52, 0xf4, 0x14, 0x19, 0x2a, 0x25, 0x15, 0xbb, 0xdb, 0x3c, 0x05, 0x23, 0xe1 },
+	{ 0xb6, 0xa4, 0xd5, 0x07, 0x9c, 0x6b, 0xd8, 0x4f, 0xa6, 0x4d, 0xd6, 0x96, 0xaa, 0x5e, 0xa4, 0xf5 },
+	{ 0xd5, 0xdf, 0x17, 0x21, 0xd6, 0xaa, 0xb9, 0xa5, 0xdd, 0x26, 0x87, 0x94, 0xca, 0xa6, 0x8f, 0x31 },
+	{ 0x6c, 0x73, 0xa3, 0xa4, 0x36, 0x4a, 0xa4, 0x0e, 0x4c, 0xd5, 0x66, 0x07, 0xf4, 0xdf, 0x31, 0x77 },
+	{ 0xf1, 0x28, 0xa7, 0x5c, 0xf8, 0xb9, 0x85, 0xbb, 0x59, 0x99, 0xce, 0x84, 0x1c, 0x67, 0x9b, 0xf6 },
+	{ 0x72, 0xd9, 0x20, 0xa1, 0x6a, 0x51, 0xf4, 0x41, 0xc2, 0xf4, 0x0a, 0x95, 0xb3, 0x87, 0x35, 0xc1 },
+	{ 0x0a, 0xbf, 0xf7, 0x99, 0x80, 0xc5, 0xa9, 0x37, 0x1a, 0xfc, 0x43, 0xae, 0x8e, 0x53, 0xa5, 0x16 },
+	{ 0xf6, 0x27, 0x5d, 0x99, 0xf7, 0x32, 0x91, 0x2a, 0xe6, 0x42, 0x3c, 0xff, 0xda, 0xea, 0xdc, 0xea },
+	{ 0x45, 0x04, 0x55, 0x0f, 0x5f, 0xe7, 0xe9, 0xfc, 0xcd, 0xf0, 0xa4, 0x55, 0x12, 0xa8, 0xbe, 0x45 },
+	{ 0x2f, 0x4b, 0x3b, 0x65, 0x6f, 0x52, 0x61, 0x89, 0xc7, 0xd7, 0xbb, 0xcc, 0x1e, 0xb2, 0x9f, 0x56 },
+	{ 0x87, 0x16, 0xf7, 0x40, 0xa6, 0x9e, 0xbe, 0xb9, 0xdf, 0x7a, 0xe0, 0x9d, 0x56, 0xc8, 0x9d, 0x14 },
+	{ 0x60, 0xd1, 0xa0, 0x40, 0xcd, 0xae, 0xf7, 0x16, 0x60, 0xd0, 0xd8, 0xc5, 0x13, 0xb3, 0x13, 0x6f },
+	{ 0xfe, 0x5b, 0x69, 0x15, 0x95, 0x56, 0x6a, 0xe6, 0x2e, 0x4e, 0x4d, 0xb3, 0x9c, 0xda, 0x64, 0xe0 },
+	{ 0x4f, 0x5a, 0xe0, 0x34, 0x63, 0x0d, 0x33, 0x1f, 0xe7, 0x5b, 0x97, 0xe3, 0x13, 0x25, 0x9d, 0xfe },
+	{ 0x4e, 0xde, 0x9c, 0x2a, 0xaf, 0xc5, 0x74, 0x23, 0xfe, 0xc8, 0x83, 0x63, 0xc3, 0x6f, 0xe6, 0x62 },
+	{ 0xf9, 0x5c, 0xb3, 0xd8, 0x95, 0xdd, 0x5e, 0x77, 0xa1, 0xa4, 0xdf, 0x38, 0xde, 0x56, 0x23, 0xec },
+	{ 0x40, 0x2f, 0x97, 0x67, 0x5e, 0xe1, 0xd1, 0xfc, 0x40, 0x81, 0xf1, 0xb4, 0xf2, 0x46, 0x66, 0xdd },
+	{ 0xed, 0x0e, 0xa1, 0x9e, 0x29, 0x28, 0x99, 0x5d, 0xb5, 0x13, 0xc6, 0xaa, 0x3b, 0x6f, 0xd7, 0xfb },
+	{ 0x3c, 0x69, 0x81, 0xd3, 0x8c, 0x35, 0xcc, 0x7c, 0x9c, 0x6f, 0x5d, 0x8e, 0x4f, 0x94, 0x74, 0xfa },
+	{ 0x36, 0xee, 0x87, 0x8c, 0xd9, 0x74, 0x02, 0x12, 0x26, 0x33, 0xdc, 0x93, 0x40, 0x5b, 0x7c, 0x6a },
+	{ 0x5d, 0xdf, 0xed, 0x62, 0xb5, 0x7e, 0xe2, 0xd6, 0xa5, 0x69, 0x6f, 0xb8, 0x45, 0x2b, 0x34, 0xf8 },
+	{ 0x9c, 0x92, 0x41, 0xc0, 0x5f, 0x18, 0xf6, 0xd7, 0xfc, 0x57, 0x4d, 0xed, 0xe7, 0xbc, 0xe3, 0x39 },
+	{ 0x20, 0xf6, 0xf9, 0x02, 0x6c, 0xb3, 0x0c, 0xf8, 0x20, 0xc3, 0x5b, 0xc4, 0x5e, 0xb1, 0x7f, 0xa9 },
+	{ 0xd8, 0xa7, 0xd2, 0x69, 0xef, 0x67, 0xdb, 0x76, 0x98, 0x53, 0x36, 0xc8, 0xf9, 0x0b, 0x86, 0x1c },
+	{ 0xb0, 0xa7, 0xc4, 0x7f, 0xe4, 0x03, 0xe9, 0x31, 0x30, 0xbf, 0x83, 0x29, 0x78, 0x8d, 0x67, 0x09 },
+	{ 0xc6, 0xde, 0xc6, 0xe8, 0xcf, 0xf1, 0x4b, 0xf2, 0x36, 0x86, 0x9b, 0x3f, 0x48, 0xeb, 0x41, 0x9c },
+	{ 0xd2, 0x2c, 0xd9, 0x22, 0x3c, 0xa7, 0x11, 0x0c, 0x22, 0x17, 0xb5, 0xcd, 0xea, 0xd2, 0x8d, 0x8c },
+	{ 0x30, 0x5e, 0x12, 0xfb, 0xa6, 0xfa, 0xbe, 0x6f, 0xb0, 0xd9, 0x7d, 0x2c, 0xe2, 0x90, 0x8f, 0x94 },
+	{ 0x17, 0xb3, 0x45, 0x73, 0x9f, 0x35, 0x21, 0xbc, 0xef, 0x59, 0x2b, 0x96, 0x20, 0x13, 0x91, 0x2e },
+	{ 0x81, 0x9b, 0xfd, 0xf9, 0xf2, 0xdd, 0xf4, 0x4e, 0x69, 0x3e, 0x5f, 0xa3, 0x47, 0x8f, 0xa5, 0x84 },
+	{ 0x75, 0x23, 0xf3, 0x2a, 0x88, 0xb5, 0x3b, 0xc6, 0x7d, 0x73, 0x8b, 0x3b, 0x06, 0x85, 0x70, 0x08 },
+	{ 0x20, 0xa2, 0x09, 0xd9, 0x6e, 0xcd, 0x25, 0x1a, 0x20, 0x4f, 0xe7, 0x10, 0x21, 0x6c, 0xad, 0x91 },
+	{ 0x52, 0x0d, 0x1f, 0x33, 0xfd, 0x10, 0xdb, 0xb8, 0xa2, 0x6b, 0x69, 0xaa, 0xf3, 0xf8, 0x9e, 0xa3 },
+	{ 0x13, 0xd8, 0xb3, 0x94, 0x4e, 0xd0, 0xa1, 0x04, 0x4b, 0x2b, 0xba, 0x02, 0x2e, 0xcf, 0xaa, 0x05 },
+	{ 0x9b, 0xd7, 0x89, 0xd6, 0x2d, 0xa4, 0xca, 0x35, 0x13, 0x6e, 0xa2, 0x26, 0xa9, 0x53, 0x4f, 0xcc },
+	{ 0xfb, 0x69, 0xb6, 0x37, 0x7d, 0x26, 0x55, 0xa6, 0x73, 0xe7, 0xe3, 0xa5, 0xce, 0x52, 0x85, 0x69 },
+	{ 0x63, 0x30, 0xef, 0x14, 0x6a, 0xcc, 0xb8, 0xd2, 0x1b, 0x6c, 0x36, 0xd9, 0xb5, 0x41, 0x43, 0xfc },
+	{ 0xdd, 0x52, 0x98, 0x7c, 0xf1, 0xfa, 0xff, 0x07, 0x25, 0x89, 0x2f, 0x8f, 0x7a, 0x4a, 0xf5, 0xf8 },
+	{ 0x5b, 0x3b, 0x57, 0x78, 0x4a, 0xd5, 0x4c, 0xbd, 0xd3, 0xb7, 0xbc, 0x6b, 0xe2, 0x05, 0x99, 0xd8 },
+	{ 0xed, 0xa5, 0x34, 0x2a, 0xad, 0x88, 0x38, 0x48, 0xb5, 0x82, 0x74, 0x8a, 0xae, 0x98, 0x10, 0x9e },
+	{ 0x0e, 0xaf, 0x05, 0xc3, 0x50, 0xe4, 0xa2, 0x26, 0xbe, 0x47, 0x92, 0xae, 0xd0, 0x28, 0x80, 0x85 },
+	{ 0x97, 0x11, 0x74, 0x42, 0x5c, 0xf8, 0xc4, 0xb5, 0x6f, 0x5c, 0x0e, 0x00, 0x06, 0xa1, 0x5d, 0xe9 },
+	{ 0x99, 0x48, 0x6f, 0x36, 0x42, 0xb4, 0xae, 0x53, 0x41, 0xd9, 0xcc, 0x46, 0x95, 0xbf, 0xa8, 0xf2 },
+	{ 0xfc, 0x39, 0xea, 0x6b, 0x2e, 0x54, 0xfa, 0x7f, 0x5c, 0xee, 0x6b, 0xd9, 0x5c, 0x4d, 0x0e, 0x1d },
+	{ 0xc2, 0x31, 0x5c, 0x21, 0x86, 0x4d, 0x0b, 0x10, 0x92, 0x35, 0x87, 0x6b, 0x3b, 0xfa, 0xcd, 0xb7 },
+	{ 0xe8, 0x78, 0x57, 0xd6, 0xa6, 0x4e, 0xee, 0x03, 0x28, 0xfb, 0xa9, 0x50, 0x0a, 0xc2, 0x5c, 0x65 },
+	{ 0xda, 0x4b, 0x69, 0x54, 0x5a, 0x11, 0x71, 0x90, 0x6a, 0x05, 0xe9, 0x14, 0x5d, 0x31, 0x21, 0x3c },
+	{ 0xbe, 0x02, 0xda, 0x18, 0x38, 0x02, 0xa5, 0x7a, 0xee, 0x92, 0xa1, 0x24, 0x0b, 0x71, 0x15, 0x77 },
+	{ 0xd9, 0x38, 0x92, 0xbe, 0x22, 0x69, 0x13, 0xaa, 0x81, 0x03, 0x27, 0xb5, 0x99, 0x52, 0x31, 0xfe },
+	{ 0x80, 0x49, 0xb2, 0x84, 0x3d, 0x09, 0x2a, 0xc2, 0x80, 0xe5, 0x05, 0xfd, 0x95, 0xfc, 0xd7, 0x74 },
+	{ 0xbf, 0xa8, 0x15, 0xb8, 0xea, 0xbc, 0x56, 0xe5, 0xd7, 0x5f, 0x6f, 0x7e, 0xfa, 0x48, 0xb5, 0x9e },
+	{ 0xab, 0xe7, 0x82, 0x22, 0x63, 0xb7, 0x4a, 0x69, 0xa3, 0x6c, 0xad, 0xf5, 0xa7, 0xbd, 0x03, 0xe7 },
+	{ 0xf2, 0x65, 0x76, 0x87, 0x2e, 0xd5, 0xd6, 0x10, 0x42, 0xd5, 0x4a, 0xbe, 0x7e, 0x68, 0x74, 0xc0 },
+	{ 0x08, 0x9d, 0x78, 0xf0, 0x19, 0xc3, 0x39, 0xd1, 0x48, 0x9c, 0x62, 0xd4, 0x4e, 0xc6, 0x4e, 0x53 },
+	{ 0x8d, 0x91, 0xf0, 0x87, 0x59, 0x5f, 0x88, 0x24, 0x55, 0xb7, 0x61, 0x98, 0x65, 0x01, 0x96, 0xa4 },
+	{ 0xcc, 0x1a, 0x4c, 0x50, 0x05, 0x86, 0xa8, 0xb6, 0xac, 0x6b, 0x85, 0xf3, 0x68, 0x70, 0x5c, 0x5a },
+	{ 0x47, 0xe7, 0x5f, 0xd9, 0x47, 0xbd, 0xec, 0xbc, 0x9f, 0xf9, 0xee, 0xe8, 0x63, 0x81, 0x37, 0x37 },
+	{ 0x04, 0x83, 0x72, 0x32, 0x4b, 0x31, 0x4d, 0x73, 0xa4, 0x16, 0x5a, 0xfa, 0x6d, 0xce, 0x8a, 0x58 },
+	{ 0x66, 0x37, 0x1e, 0x3d, 0x01, 0xb6, 0x47, 0x4a, 0xd6, 0xef, 0x7c, 0x53, 0xd3, 0x5a, 0x17, 0xb9 },
+	{ 0x62, 0x9f, 0x2f, 0xc0, 0x36, 0xcb, 0x80, 0x9f, 0x32, 0xbc, 0x45, 0xec, 0x15, 0xfb, 0x97, 0x1a },
+	{ 0x9d, 0xf9, 0x08, 0x80, 0x94, 0xa6, 0x3a, 0x9c, 0xe5, 0xcd, 0x83, 0x00, 0xe9, 0xe0, 0xa5, 0x8f },
+	{ 0x4d, 0x8c, 0x51, 0xb5, 0xf9, 0xf0, 0xa9, 0x96, 0x15, 0x70, 0x2a, 0xbd, 0x11, 0xdd, 0x18, 0x53 },
+	{ 0xb2, 0x9f, 0x4b, 0x94, 0x4c, 0x93, 0x65, 0x29, 0x02, 0xe5, 0xaa, 0x29, 0x19, 0xf8, 0xd4, 0x40 },
+	{ 0xb3, 0x30, 0x0b, 0xe9, 0x7f, 0x94, 0x9d, 0x5c, 0xeb, 0x94, 0x9b, 0x16, 0xb9, 0x3e, 0x80, 0x22 },
+	{ 0xf8, 0x1f, 0xe4, 0xad, 0x5f, 0xc2, 0x0d, 0x22, 0xb8, 0x68, 0x63, 0xff, 0x7b, 0x55, 0x4a, 0x22 },
+	{ 0xae, 0xaf, 0x3d, 0x6b, 0x7c, 0x74, 0x6c, 0x3a, 0x5e, 0x99, 0x5c, 0x29, 0xd7, 0x22, 0xfa, 0xd1 },
+	{ 0x4c, 0x92, 0x25, 0xec, 0x49, 0x50, 0x11, 0x4e, 0x2c, 0x2f, 0xe8, 0xaf, 0xe4, 0xbf, 0xa6, 0x13 },
+	{ 0xba, 0xd3, 0x57, 0x10, 0xea, 0xb6, 0x3e, 0xe5, 0x4a, 0xf0, 0xbb, 0xdd, 0xda, 0xe7, 0x5c, 0x36 },
+	{ 0x8a, 0xde, 0xb1, 0x89, 0xbf, 0x5b, 0xe0, 0x8a, 0x9a, 0xa7, 0x8f, 0xd1, 0x85, 0x2d, 0x94, 0xff },
+	{ 0x41, 0xab, 0xda, 0x71, 0x12, 0x29, 0x90, 0xf8, 0x29, 0x14, 0x05, 0x35, 0x43, 0xfc, 0x1c, 0x79 },
+	{ 0x43, 0xb8, 0xdd, 0xd0, 0xf9, 0x71, 0x86, 0x27, 0xfb, 0x56, 0x09, 0xa2, 0x33, 0xf8, 0x7e, 0xf6 },
+	{ 0x72, 0xee, 0x9c, 0xeb, 0xe9, 0x0a, 0x6e, 0x79, 0xc2, 0x11, 0xe8, 0x01, 0x03, 0x19, 0x2a, 0x07 },
+	{ 0x89, 0x62, 0x6e, 0x7f, 0x0b, 0x14, 0x22, 0x8f, 0xb1, 0x14, 0x7c, 0x51, 0x35, 0x78, 0xdd, 0x63 },
+	{ 0xd9, 0x0e, 0x9a, 0x29, 0x24, 0xf6, 0x1f, 0x3b, 0x81, 0xc9, 0x6c, 0xdb, 0xfa, 0x2f, 0x48, 0x72 },
+	{ 0x8e, 0xf8, 0xb7, 0x47, 0x8e, 0xed, 0xcc, 0xe8, 0x3e, 0x2d, 0x98, 0xab, 0x66, 0x25, 0x58, 0xfa },
+	{ 0xa5, 0x96, 0x81, 0x70, 0xae, 0x69, 0x74, 0x6d, 0x2d, 0x6a, 0xe6, 0xd4, 0x37, 0xa7, 0xf4, 0xe2 },
+	{ 0x9d, 0xe4, 0x8c, 0x35, 0x15, 0xed, 0xc0, 0x64, 0xe5, 0xb0, 0xa6, 0x93, 0x99, 0x4f, 0xb1, 0x49 },
+	{ 0x6a, 0x51, 0x24, 0xfb, 0xcf, 0x47, 0x34, 0xa8, 0x7a, 0x75, 0x85, 0x2d, 0xb4, 0x52, 0xdb, 0xb3 },
+	{ 0xe0, 0xf0, 0x5a, 0x30, 0x0c, 0x45, 0x2e, 0x6a, 0xe0, 0x7b, 0x24, 0xe9, 0x0a, 0x8d, 0x02, 0x58 },
+	{ 0xb2, 0x8a, 0xcf, 0x49, 0xcd, 0xd9, 0xeb, 0xf1, 0x02, 0xc8, 0xcd, 0xbc, 0xc9, 0x66, 0xe0, 0xfa },
+	{ 0xa6, 0xd3, 0x50, 0x9b, 0xe4, 0x84, 0xc5, 0xc2, 0x16, 0xa6, 0x62, 0x0e, 0x9a, 0xa8, 0xcd, 0xac },
+	{ 0x5a, 0x56, 0xa7, 0xf9, 0x19, 0xee, 0x2d, 0xac, 0xea, 0x93, 0x57, 0xcb, 0x04, 0x7a, 0x1b, 0xdf },
+	{ 0x90, 0x05, 0xbb, 0xa6, 0x75, 0x36, 0xc3, 0x17, 0x10, 0x70, 0x9c, 0x18, 0x57, 0x21, 0xba, 0x77 },
+	{ 0xcc, 0x05, 0xd0, 0x05, 0x86, 0xcc, 0x2e, 0x7f, 0xac, 0x4e, 0xa8, 0x86, 0x19, 0xdf, 0x67, 0x14 },
+	{ 0x22, 0x03, 0xfd, 0x61, 0x53, 0xfc, 0x02, 0x27, 0xf2, 0x05, 0x60, 0x31, 0x4f, 0xad, 0xe1, 0x26 },
+	{ 0x86, 0x85, 0x37, 0xec, 0x72, 0x9d, 0x86, 0x86, 0xf6, 0xca, 0xef, 0xb0, 0xb6, 0x81, 0xf2, 0x32 },
+	{ 0x62, 0x08, 0x9c, 0x34, 0xb3, 0x6a, 0xe1, 0xb4, 0x32, 0x4d, 0x97, 0x0c, 0xa3, 0xd1, 0x5e, 0x78 },
+	{ 0x34, 0xa2, 0x10, 0x4e, 0x74, 0xff, 0x9e, 0x3c, 0x54, 0x99, 0x40, 0xe0, 0x61, 0xab, 0x3c, 0x1b },
+	{ 0x94, 0x0a, 0x45, 0x1a, 0xc5, 0x0e, 0x36, 0x3e, 0xb4, 0xd8, 0xc7, 0x85, 0xe8, 0x87, 0x89, 0x2c },
+	{ 0xd0, 0xcb, 0xe5, 0x99, 0x57, 0x78, 0x34, 0xff, 0x50, 0x60, 0x3c, 0xad, 0xbc, 0x91, 0x59, 0xf7 },
+	{ 0x9b, 0x01, 0x82, 0x6b, 0x2c, 0x17, 0xbe, 0xa4, 0x13, 0xa8, 0x5c, 0x00, 0x48, 0x76, 0x38, 0x58 },
+	{ 0x4a, 0x9a, 0x9e, 0xd7, 0xe1, 0xc0, 0x94, 0x56, 0x5a, 0x09, 0xc1, 0xaf, 0x43, 0x55, 0x39, 0xdc },
+	{ 0x45, 0x19, 0xd1, 0x59, 0xde, 0xa0, 0x63, 0x34, 0xcd, 0x0d, 0x82, 0xc2, 0x61, 0x39, 0xb3, 0x8b },
+	{ 0x48, 0xcc, 0x0f, 0x58, 0x78, 0xa4, 0x0b, 0xce, 0x88, 0x1d, 0x54, 0x89, 0x41, 0x0d, 0xb5, 0x30 },
+	{ 0x73, 0x2b, 0x6c, 0x16, 0x20, 0x26, 0xbf, 0xce, 0xab, 0x4d, 0x64, 0x3b, 0x65, 0x1a, 0x03, 0xd1 },
+	{ 0x17, 0xf2, 0xb9, 0x52, 0x1d, 0x62, 0x8e, 0x62, 0xef, 0xb0, 0xc2, 0xdc, 0x0e, 0xc7, 0x6e, 0x00 },
+	{ 0xef, 0x1b, 0xa4, 0xfd, 0x10, 0x71, 0x8f, 0x8c, 0x87, 0x56, 0xca, 0x17, 0x2c, 0x6b, 0x39, 0x79 },
+	{ 0xfb, 0xbd, 0xa6, 0x61, 0x7a, 0x0c, 0x3c, 0x84, 0x73, 0x5b, 0x58, 0x59, 0x0c, 0x98, 0x57, 0x81 },
+	{ 0xb2, 0xb4, 0xc7, 0xde, 0xcb, 0x4c, 0xdf, 0x60, 0x02, 0x02, 0x88, 0x96, 0x68, 0x89, 0xc9, 0x86 },
+	{ 0x53, 0xb3, 0x5a, 0xd2, 0xaf, 0xcb, 0x8c, 0x23, 0x8b, 0x38, 0x37, 0x04, 0xe3, 0xd0, 0x3e, 0xcb },
+	{ 0xb6, 0x0d, 0x42, 0x7c, 0x18, 0x0b, 0x39, 0x65, 0xa6, 0xde, 0x27, 0xb7, 0x37, 0x35, 0x6b, 0x53 },
+	{ 0x33, 0x11, 0x51, 0xf9, 0x40, 0xfe, 0x66, 0x09, 0x6b, 0xe9, 0x4f, 0xf3, 0xc1, 0x64, 0x91, 0x39 },
+	{ 0xa2, 0xa4, 0xce, 0x92, 0x96, 0x39, 0x5f, 0x2d, 0x72, 0x03, 0x7d, 0xc7, 0x69, 0x1f, 0x15, 0x6c },
+	{ 0x33, 0x26, 0xcd, 0x43, 0xc0, 0xb7, 0xe0, 0x40, 0x6b, 0x06, 0x2d, 0x60, 0x11, 0xf6, 0x85, 0x7f },
+	{ 0x90, 0x1a, 0x37, 0xf1, 0xf4, 0xef, 0x3c, 0x4f, 0x10, 0x8d, 0x79, 0x85, 0xa6, 0xb2, 0xae, 0xbd },
+	{ 0xa9, 0xc5, 0x03, 0x79, 0xfc, 0xb4, 0xda, 0x02, 0xd1, 0x0c, 0xcc, 0x1b, 0x68, 0x30, 0xad, 0x23 },
+	{ 0x1a, 0x66, 0x84, 0x71, 0x39, 0x39, 0xc9, 0x55, 0xaa, 0x69, 0xfd, 0x5c, 0x00, 0xe7, 0x92, 0xd3 },
+	{ 0x48, 0xf6, 0x07, 0xed, 0x76, 0x17, 0xff, 0x3c, 0x88, 0x57, 0x0e, 0x63, 0xe0, 0x2f, 0x9e, 0xbc },
+	{ 0x81, 0xb0, 0x79, 0x44, 0x72, 0x97, 0x6e, 0x86, 0x69, 0x5b, 0x3c, 0x10, 0x97, 0x20, 0x9a, 0xca },
+	{ 0xaa, 0x80, 0xbb, 0x62, 0x2e, 0x29, 0x06, 0xa5, 0xba, 0xf6, 0x76, 0xe2, 0xa6, 0x99, 0x41, 0x91 },
+	{ 0xf8, 0xe0, 0x6f, 0xce, 0xe1, 0x95, 0xa0, 0x7b, 0xb8, 0x11, 0xcc, 0xb8, 0x8d, 0xa1, 0x6c, 0x50 },
+	{ 0x87, 0x2b, 0x73, 0x8b, 0x25, 0x58, 0x38, 0xf1, 0xdf, 0x97, 0xbd, 0x0a, 0xa6, 0x59, 0x92, 0x5a },
+	{ 0xf1, 0x67, 0x1b, 0x3c, 0x76, 0xe6, 0xf2, 0x61, 0x59, 0xf0, 0x65, 0xcb, 0x0a, 0x1b, 0x79, 0xc8 },
+	{ 0x70, 0x8d, 0xa9, 0x62, 0x05, 0xdc, 0x90, 0x6c, 0xf0, 0x5a, 0x6f, 0xe1, 0xd4, 0xd7, 0xf5, 0x71 },
+	{ 0x1e, 0xd4, 0x7a, 0x59, 0x05, 0xb1, 0x9c, 0x91, 0x4e, 0x63, 0x7a, 0xea, 0x1e, 0x24, 0x29, 0xe6 },
+	{ 0x14, 0x2a, 0xff, 0x09, 0x04, 0xa5, 0x6c, 0x91, 0x34, 0x84, 0x13, 0xa9, 0xdf, 0x61, 0x78, 0x15 },
+	{ 0xec, 0x14, 0x75, 0xd5, 0x79, 0x87, 0x00, 0x15, 0xcc, 0xd2, 0x83, 0x9d, 0x0e, 0x52, 0x65, 0xbc },
+	{ 0x87, 0x6a, 0xe7, 0x6a, 0xa3, 0x84, 0xa5, 0x97, 0xdf, 0xee, 0x54, 0x51, 0x94, 0x0d, 0x70, 0x2c },
+	{ 0x91, 0x57, 0x06, 0x1c, 0x2b, 0x0b, 0x8e, 0xa4, 0xf9, 0xc8, 0xf5, 0xbe, 0x08, 0xb4, 0x87, 0x87 },
+	{ 0x8c, 0xc1, 0xbc, 0x53, 0xa8, 0x31, 0xe3, 0x4a, 0x6c, 0xb0, 0xd9, 0x64, 0xd7, 0x06, 0x0d, 0xf1 },
+	{ 0x52, 0xf8, 0xa2, 0xe8, 0x7d, 0x57, 0x61, 0x81, 0xa2, 0x4e, 0x8c, 0x3d, 0xa4, 0x67, 0xaa, 0x5d },
+	{ 0xdf, 0x0b, 0xab, 0xb1, 0xdb, 0x5d, 0x0f, 0x59, 0xf7, 0x57, 0xbf, 0x48, 0x2d, 0x01, 0x85, 0x5e },
+	{ 0xbc, 0x49, 0xc7, 0xe3, 0x4d, 0x9f, 0x95, 0x29, 0x1c, 0xc4, 0x11, 0x6b, 0x58, 0xba, 0x85, 0x11 },
+	{ 0x90, 0xf0, 0x3e, 0x5c, 0xf6, 0x7c, 0x49, 0xe0, 0x10, 0x53, 0xbf, 0xab, 0x07, 0x90, 0xc5, 0x31 },
+	{ 0x54, 0x83, 0x8e, 0x06, 0x61, 0xf9, 0x31, 0xfd, 0x74, 0x3f, 0xbf, 0x37, 0x71, 0xcb, 0xc7, 0x7e },
+	{ 0xc2, 0xaf, 0x44, 0xe0, 0x81, 0xa6, 0xe5, 0x5c, 0x92, 0xe3, 0xb5, 0xf8, 0x17, 0x62, 0x89, 0x5b },
+	{ 0x2f, 0x36, 0xbf, 0x1a, 0xf0, 0x98, 0xe7, 0x51, 0xc7, 0xba, 0xde, 0x5f, 0xcf, 0x20, 0xab, 0x10 },
+	{ 0x25, 0x8c, 0x43, 0xcb, 0xee, 0x8c, 0xb7, 0x51, 0xad, 0xdb, 0x77, 0x1e, 0x90, 0x5e, 0xfa, 0x3f },
+	{ 0xd7, 0x2b, 0x8f, 0x5f, 0x3b, 0x20, 0x1d, 0x7b, 0xaf, 0xc0, 0x22, 0x48, 0xa9, 0x56, 0xcf, 0x80 },
+	{ 0x99, 0x1e, 0x77, 0xa1, 0x43, 0x41, 0xbb, 0xe4, 0x41, 0x9f, 0x12, 0x6d, 0xf6, 0x9c, 0xbf, 0x66 },
+	{ 0x3d, 0xbb, 0xcc, 0x48, 0x42, 0x0a, 0x97, 0x09, 0x85, 0xc8, 0xb6, 0x34, 0x01, 0x27, 0x42, 0x0a },
+	{ 0x14, 0x93, 0x6b, 0x7e, 0x80, 0x44, 0xcd, 0xa6, 0x34, 0x15, 0x65, 0xc9, 0x6c, 0x38, 0x3f, 0x73 },
+	{ 0x54, 0x59, 0x96, 0x71, 0x62, 0x86, 0x3e, 0x8e, 0x74, 0x05, 0x05, 0x5e, 0xd2, 0xa8, 0xde, 0xf2 },
+	{ 0xb3, 0x5a, 0x03, 0x7e, 0x7e, 0x07, 0x91, 0xcb, 0xeb, 0xce, 0x55, 0xf0, 0x57, 0x61, 0x69, 0xae },
+	{ 0x4f, 0x84, 0xd8, 0xc9, 0x61, 0x80, 0x26, 0x8e, 0xe7, 0x95, 0x51, 0xbd, 0xb2, 0x47, 0x86, 0x8a },
+	{ 0xf0, 0x82, 0x6b, 0xbd, 0x45, 0xff, 0xd3, 0x50, 0x70, 0xcc, 0x00, 0x2b, 0x2d, 0x8f, 0xfb, 0xce },
+	{ 0xc9, 0x7c, 0x89, 0x9c, 0xea, 0x3b, 0x7a, 0x54, 0xf1, 0x78, 0x90, 0x99, 0xd8, 0x2d, 0x4f, 0xfb },
+	{ 0xd3, 0x7e, 0x24, 0x98, 0xf1, 0x7b, 0xdc, 0x98, 0x0b, 0x70, 0x0e, 0x74, 0x9c, 0x65, 0x5b, 0x9c },
+	{ 0xdf, 0x89, 0x93, 0x70, 0xd7, 0xb6, 0xe9, 0xa5, 0xf7, 0x05, 0xee, 0xd5, 0x09, 0x69, 0x40, 0x02 },
+	{ 0x98, 0x63, 0xbf, 0xb7, 0x11, 0xcd, 0x8f, 0x42, 0x58, 0xb5, 0x67, 0xa6, 0xb7, 0x33, 0x2b, 0xf9 },
+	{ 0xf5, 0x42, 0xad, 0x1a, 0xc7, 0x4b, 0x72, 0x19, 0xfd, 0x1e, 0xd7, 0x5e, 0xfd, 0x5e, 0x5f, 0xf1 },
+	{ 0x71, 0xdf, 0xf4, 0xd7, 0xba, 0xb0, 0x5b, 0xf9, 0xd9, 0xb3, 0xc8, 0x87, 0x86, 0x6a, 0xc3, 0x81 },
+	{ 0x2e, 0xba, 0x7b, 0x10, 0x3c, 0x51, 0x29, 0x56, 0xde, 0x27, 0xcb, 0xdf, 0x7e, 0x6b, 0xf4, 0x74 },
+	{ 0xb7, 0x74, 0x09, 0x3c, 0x4d, 0x99, 0x7d, 0x29, 0x8f, 0x54, 0x5e, 0xca, 0x38, 0x59, 0x2d, 0xa9 },
+	{ 0x21, 0x5d, 0xc1, 0xc2, 0xa0, 0x41, 0x51, 0xbc, 0x09, 0x39, 0x92, 0xd7, 0x5f, 0xd5, 0x41, 0xff },
+	{ 0x4d, 0xa1, 0xcd, 0xff, 0x78, 0xaa, 0x23, 0xce, 0x15, 0x8d, 0x07, 0x2a, 0x61, 0x6e, 0x0d, 0x99 },
+	{ 0x1b, 0x0c, 0xc0, 0x10, 0xec, 0xf3, 0x7a, 0xc0, 0x93, 0x36, 0xcb, 0xb6, 0xef, 0xbe, 0x32, 0xfb },
+	{ 0x53, 0xdd, 0x52, 0x67, 0xae, 0x3e, 0x80, 0x92, 0x8b, 0x72, 0xf1, 0xdd, 0x81, 0xf3, 0x27, 0x57 },
+	{ 0xdb, 0x5a, 0x11, 0x68, 0x89, 0x6b, 0x83, 0x10, 0x53, 0x63, 0x08, 0x8f, 0xd9, 0xdf, 0x87, 0xc1 },
+	{ 0x30, 0xc7, 0x7e, 0x6f, 0x23, 0x9a, 0x1f, 0x85, 0xb0, 0x6a, 0xcf, 0x4c, 0x6f, 0x67, 0x56, 0xf2 },
+	{ 0xa9, 0x71, 0x13, 0x4f, 0xff, 0xce, 0xf3, 0x24, 0xd1, 0x98, 0x57, 0x68, 0x2a, 0xeb, 0xda, 0x0b },
+	{ 0x4d, 0xb6, 0x49, 0x4a, 0xf8, 0x63, 0x9d, 0x05, 0x15, 0xaa, 0xe4, 0x96, 0xb0, 0xff, 0x01, 0xdf },
+	{ 0x7d, 0x96, 0x73, 0x86, 0xa3, 0x05, 0x82, 0x28, 0xc5, 0xd5, 0x33, 0x36, 0xb6, 0x28, 0xd6, 0xcf },
+	{ 0x7b, 0x5f, 0x78, 0x92, 0xbd, 0x49, 0x98, 0x8a, 0xf3, 0x58, 0x75, 0xef, 0x26, 0x0a, 0x8b, 0xc6 },
+	{ 0xc7, 0x45, 0x8e, 0xa8, 0x04, 0x80, 0x90, 0xb6, 0x1f, 0xfc, 0xd1, 0x52, 0x49, 0x0f, 0x04, 0xf2 },
+	{ 0xc2, 0x85, 0x4c, 0x4b, 0x83, 0x33, 0xf2, 0xed, 0x92, 0xa9, 0xfb, 0x1e, 0x79, 0x3f, 0xa0, 0xcf },
+	{ 0x52, 0x37, 0x17, 0xc8, 0xfb, 0x83, 0xce, 0x27, 0xa2, 0xa5, 0x23, 0x84, 0x92, 0x1b, 0x88, 0x2f },
+	{ 0x8f, 0x9e, 0xf3, 0xe6, 0x40, 0xa8, 0x7e, 0x53, 0x27, 0xfa, 0x65, 0x05, 0x56, 0xfd, 0xf7, 0x21 },
+	{ 0x66, 0xf8, 0xa9, 0x5d, 0x83, 0x89, 0xda, 0xa3, 0xd6, 0x98, 0xe5, 0x0c, 0xe5, 0xa6, 0x39, 0xe7 },
+	{ 0xbd, 0xc5, 0x0a, 0xee, 0x01, 0xe7, 0x53, 0x25, 0x05, 0x57, 0x25, 0xeb, 0xa8, 0x6f, 0x3c, 0xad },
+	{ 0x31, 0x43, 0xc2, 0x79, 0xd7, 0xe1, 0xdd, 0x80, 0x99, 0xfd, 0xe2, 0xcc, 0xbf, 0x1c, 0x0d, 0x8e },
+	{ 0x1a, 0x7b, 0x00, 0xbc, 0xb8, 0xf2, 0x42, 0x8d, 0xaa, 0x86, 0xda, 0xc9, 0x4f, 0x78, 0x87, 0x19 },
+	{ 0x66, 0xce, 0xb1, 0xc8, 0x84, 0x16, 0xe7, 0x34, 0xd6, 0x5e, 0x2b, 0x33, 0x46, 0x84, 0x50, 0x5b },
+	{ 0x5e, 0x9a, 0xa5, 0x4c, 0xe7, 0xf2, 0x0d, 0x79, 0x8e, 0x53, 0x1a, 0x7f, 0x84, 0x94, 0xc8, 0x65 },
+	{ 0x9e, 0xde, 0xb8, 0xfe, 0xc4, 0x8d, 0x59, 0xad, 0xce, 0xf1, 0xe8, 0xa0, 0xc6, 0x6c, 0x23, 0x89 },
+	{ 0x94, 0x88, 0x2d, 0xd9, 0xc0, 0x67, 0x10, 0x8b, 0xb4, 0x86, 0xf6, 0x12, 0xc5, 0xef, 0x44, 0xd0 },
+	{ 0x83, 0x26, 0xe9, 0x17, 0xd6, 0x7f, 0xc5, 0xca, 0x3b, 0x2f, 0x92, 0x9d, 0x14, 0xf3, 0xc2, 0xa5 },
+	{ 0xb8, 0xf0, 0x4c, 0x46, 0x01, 0xe1, 0x3b, 0x25, 0x78, 0xe7, 0x71, 0x4a, 0x89, 0x0e, 0xe4, 0x44 },
+	{ 0xf4, 0x87, 0xf5, 0x30, 0x95, 0xd7, 0x46, 0x77, 0x14, 0x35, 0x2c, 0x98, 0xbe, 0xf5, 0xca, 0x83 },
+	{ 0x1b, 0xe2, 0xc7, 0x7b, 0xed, 0x80, 0x87, 0x51, 0x93, 0xfc, 0x10, 0xdd, 0x50, 0x9c, 0x49, 0x6f },
+	{ 0x37, 0x94, 0xc3, 0x2b, 0x8c, 0x2f, 0xb4, 0x7c, 0x0f, 0x00, 0xaa, 0xed, 0x2f, 0x33, 0x1c, 0x92 },
+	{ 0x1e, 0xe9, 0xf6, 0xa3, 0x84, 0x6a, 0x16, 0xc9, 0x4e, 0x80, 0x57, 0x57, 0x6e, 0xb5, 0x1d, 0x2c },
+	{ 0x8a, 0xc9, 0x35, 0x3f, 0x40, 0xa2, 0x66, 0x53, 0x9a, 0x8a, 0xb2, 0x64, 0x36, 0x9c, 0x9f, 0xb9 },
+	{ 0x38, 0xe6, 0x0e, 0xa1, 0x41, 0x04, 0x7f, 0x09, 0xf8, 0x58, 0x03, 0x94, 0xe1, 0xc5, 0xe9, 0xa1 },
+	{ 0x13, 0x84, 0xc3, 0x6a, 0x51, 0xea, 0xba, 0x26, 0x4b, 0xb7, 0x45, 0x4f, 0xf0, 0x89, 0xd8, 0xed },
+	{ 0x85, 0xf4, 0x77, 0x97, 0x3f, 0x9c, 0x4e, 0x53, 0x0d, 0x1b, 0xff, 0xc3, 0x16, 0x3b, 0x47, 0x51 },
+	{ 0x81, 0x04, 0x6a, 0x6e, 0x6f, 0x7d, 0x55, 0x64, 0x69, 0xcf, 0xb0, 0xc3, 0xd4, 0x65, 0x6c, 0xe2 },
+	{ 0x84, 0xcc, 0x24, 0xb7, 0x88, 0x3a, 0x77, 0x35, 0x24, 0xfc, 0x5f, 0xf7, 0x03, 0xcb, 0x62, 0xcd },
+	{ 0xee, 0x75, 0x68, 0x5e, 0x5e, 0xb6, 0xdd, 0x21, 0x9e, 0x89, 0xfc, 0xbd, 0x3c, 0x93, 0x99, 0x51 },
+	{ 0xde, 0xce, 0xdb, 0x86, 0xa5, 0x42, 0xbe, 0x03, 0x0e, 0x1c, 0x43, 0x0f, 0xcb, 0xff, 0xab, 0x94 },
+	{ 0x4a, 0x18, 0x87, 0x96, 0xdd, 0x19, 0x6f, 0xa3, 0x5a, 0xb7, 0xef, 0x3c, 0x20, 0xbd, 0xf4, 0x7f },
+	{ 0xb2, 0x75, 0x53, 0xff, 0x4d, 0x20, 0x72, 0xba, 0x02, 0xab, 0xf0, 0x4f, 0x7a, 0xd5, 0xeb, 0xb4 },
+	{ 0x48, 0x78, 0x1f, 0x2e, 0x7b, 0xbe, 0x24, 0xf0, 0x88, 0xa9, 0xdf, 0xd5, 0x03, 0xc8, 0xe2, 0x18 },
+	{ 0x4e, 0x08, 0x95, 0xbf, 0xad, 0x38, 0x68, 0x92, 0xfe, 0x02, 0x3e, 0x3d, 0x62, 0x92, 0xcf, 0xee },
+	{ 0xc2, 0x5b, 0x54, 0xb6, 0x84, 0xc0, 0xfe, 0x7e, 0x92, 0x6f, 0x41, 0x45, 0xda, 0x1c, 0xb7, 0x43 },
+	{ 0xbf, 0xd2, 0x0d, 0x4d, 0xe9, 0x2f, 0x4a, 0x54, 0xd7, 0x99, 0x29, 0x58, 0x99, 0x6b, 0x9e, 0x2a },
+	{ 0x47, 0x65, 0x48, 0x98, 0x43, 0x16, 0xc7, 0x09, 0x9f, 0xa7, 0x1d, 0x76, 0x40, 0xe9, 0xf2, 0xda },
+	{ 0xa9, 0x04, 0x78, 0x58, 0x7a, 0xe1, 0x47, 0xa9, 0xd1, 0x63, 0x63, 0x62, 0x56, 0xe4, 0x8a, 0xf5 },
+	{ 0x94, 0xf5, 0xc8, 0xcf, 0x45, 0x55, 0xbc, 0x06, 0xb4, 0xbb, 0xea, 0x18, 0x99, 0xf6, 0x94, 0xe6 },
+	{ 0xf6, 0xbe, 0xf0, 0x24, 0x7b, 0x93, 0x30, 0x15, 0xe6, 0xb1, 0xea, 0xde, 0x4d, 0x14, 0x16, 0x8d },
+	{ 0x39, 0x8c, 0x4a, 0x40, 0xf4, 0xbe, 0x30, 0x74, 0xe1, 0x25, 0xd1, 0xed, 0xd0, 0x9d, 0x89, 0xc9 },
+	{ 0x79, 0x7c, 0x6d, 0xc8, 0xd4, 0x73, 0x95, 0xca, 0x21, 0x50, 0x2b, 0x5c, 0xd5, 0x30, 0x12, 0xd5 },
+	{ 0x7a, 0x4c, 0xa1, 0xfc, 0x85, 0xa1, 0x3a, 0xa4, 0x0a, 0x57, 0xb3, 0x8f, 0x63, 0x2b, 0x9b, 0x88 },
+	{ 0x37, 0x55, 0x4f, 0x4c, 0x0e, 0x03, 0x47, 0xd6, 0x0f, 0xa9, 0x12, 0xa7, 0x41, 0x7f, 0x3e, 0xc0 },
+	{ 0x8b, 0x30, 0xfd, 0xfe, 0x74, 0x30, 0xab, 0x17, 0x83, 0x00, 0xe9, 0x77, 0x37, 0xc0, 0x61, 0x0f },
+	{ 0xb4, 0xc1, 0xca, 0x3d, 0xb3, 0x95, 0xd5, 0x8f, 0xd4, 0x44, 0x8c, 0x03, 0x59, 0x85, 0x2b, 0x04 },
+	{ 0xad, 0x33, 0xfa, 0x60, 0xc8, 0x2c, 0xae, 0x3e, 0x75, 0x06, 0x49, 0xa9, 0x86, 0x6d, 0x43, 0x36 },
+	{ 0xdc, 0xd6, 0x54, 0x72, 0x3d, 0xb3, 0x41, 0x0c, 0x3c, 0xf6, 0x1b, 0x0f, 0x2a, 0x95, 0x3e, 0x5d },
+	{ 0x73, 0x16, 0xf0, 0xcb, 0xa0, 0x6c, 0x45, 0x97, 0xab, 0x30, 0x87, 0xce, 0x15, 0x89, 0x0e, 0x8b },
+	{ 0x9d, 0x38, 0x7d, 0x5f, 0x12, 0xd3, 0xa7, 0x42, 0xe5, 0x24, 0x1b, 0x47, 0xd7, 0x94, 0x83, 0x61 },
+	{ 0x31, 0x2e, 0x46, 0x2f, 0x58, 0x28, 0x64, 0x49, 0x99, 0xe0, 0x05, 0x60, 0x70, 0x8b, 0x18, 0x48 },
+	{ 0x21, 0x33, 0xc9, 0x2d, 0xa2, 0xce, 0x5d, 0x4d, 0x09, 0xff, 0xd7, 0xfd, 0xc0, 0xb2, 0x58, 0x73 },
+	{ 0x45, 0x58, 0x45, 0x39, 0x5c, 0xcd, 0xd0, 0xda, 0xcd, 0x64, 0x19, 0x09, 0x50, 0xed, 0x90, 0x5d },
+	{ 0x50, 0xc1, 0xa7, 0xf4, 0x97, 0x9b, 0x77, 0xe3, 0xd0, 0xd1, 0xcd, 0xf6, 0x14, 0x49, 0x5f, 0x54 },
+	{ 0xe1, 0x96, 0x96, 0xcf, 0xbe, 0xff, 0xdf, 0xd4, 0xc9, 0x48, 0xf2, 0x42, 0xfa, 0x64, 0xa2, 0x7f },
+	{ 0x82, 0x6b, 0x31, 0x2e, 0xa4, 0x0b, 0x9a, 0x28, 0x52, 0x45, 0xe7, 0xd6, 0xd5, 0x89, 0x2e, 0x38 },
+	{ 0xd5, 0x1e, 0x8c, 0x00, 0x54, 0xd7, 0x26, 0x4c, 0xdd, 0x7d, 0x1e, 0xdb, 0xb8, 0x5a, 0x6d, 0x03 },
+	{ 0xcb, 0x74, 0x10, 0xb1, 0x52, 0xcb, 0xf6, 0x4b, 0xc3, 0x9e, 0xb7, 0x99, 0x79, 0x98, 0xbc, 0x32 },
+	{ 0xc5, 0x23, 0x0f, 0xff, 0x9d, 0x7d, 0x20, 0x50, 0x4d, 0x9c, 0xf0, 0x78, 0x09, 0x82, 0xad, 0x2e },
+	{ 0xde, 0xf8, 0xd3, 0x1b, 0xa4, 0xb5, 0xb1, 0x72, 0x0e, 0x56, 0xfd, 0xe8, 0x69, 0x22, 0x95, 0x20 },
+	{ 0xbc, 0xf5, 0xd6, 0xb9, 0x50, 0xb9, 0xae, 0x4b, 0x1c, 0x50, 0x9d, 0xb7, 0x1a, 0x75, 0xb3, 0xf9 },
+	{ 0x91, 0xea, 0x6a, 0x25, 0xa6, 0x1d, 0xe2, 0x28, 0xf9, 0x93, 0x01, 0xb9, 0x34, 0xad, 0x37, 0x71 },
+	{ 0x6c, 0x88, 0x1f, 0xef, 0xb5, 0x03, 0x1e, 0x46, 0x4c, 0xf2, 0x43, 0x74, 0x43, 0x71, 0x26, 0xbd },
+	{ 0x48, 0xe1, 0x8b, 0xa2, 0xf7, 0x5d, 0x85, 0x05, 0x88, 0x3a, 0x31, 0xf6, 0x90, 0x9e, 0xa9, 0x76 },
+	{ 0x67, 0xdd, 0x59, 0xdc, 0xb3, 0x70, 0xf9, 0xb4, 0xbf, 0xbc, 0x4a, 0xad, 0xc2, 0x32, 0xb7, 0xe0 },
+	{ 0x9f, 0x84, 0xf4, 0x9d, 0x77, 0x48, 0x0b, 0x18, 0xb7, 0xbe, 0xb6, 0xfa, 0xb5, 0x44, 0xc3, 0xb0 },
+	{ 0x29, 0xfa, 0x39, 0xb3, 0xba, 0x04, 0x8b, 0x8d, 0x51, 0xd5, 0xf4, 0xab, 0xae, 0x9b, 0x90, 0x52 },
+	{ 0xf5, 0x57, 0x29, 0x65, 0x46, 0x05, 0xec, 0x50, 0xfd, 0x3b, 0xb4, 0xcb, 0x4c, 0xf0, 0x53, 0x37 },
+	{ 0x8d, 0xa6, 0x6c, 0xd2, 0xd8, 0x18, 0x02, 0x5c, 0x55, 0xd4, 0x3e, 0x05, 0xb5, 0x92, 0x8a, 0xea },
+	{ 0x02, 0x76, 0x6f, 0xd3, 0x63, 0xe8, 0x56, 0x44, 0xd2, 0xd3, 0x55, 0x8d, 0x7d, 0xd2, 0x28, 0xdb },
+	{ 0x60, 0x10, 0x15, 0x20, 0x4b, 0xdb, 0x64, 0xbd, 0x60, 0x27, 0x70, 0x0c, 0x02, 0x67, 0xf1, 0x40 },
+	{ 0x80, 0x34, 0x36, 0x3a, 0xbe, 0x4f, 0xb0, 0x8a, 0x80, 0xc8, 0x28, 0x90, 0x46, 0x6b, 0xe3, 0x2e },
+	{ 0xb5, 0x28, 0x92, 0xfd, 0xe7, 0x23, 0x1a, 0x54, 0xbd, 0xba, 0xc2, 0x16, 0x5a, 0xa9, 0xed, 0x59 },
+	{ 0xc6, 0xc9, 0x4a, 0x9e, 0x50, 0x38, 0xd2, 0xba, 0x36, 0x69, 0xbe, 0xd2, 0xf8, 0x59, 0x4d, 0x56 },
+	{ 0x32, 0xbf, 0x05, 0x84, 0x8b, 0x29, 0x9c, 0x7c, 0x82, 0x90, 0xf6, 0x4c, 0x10, 0xd2, 0xc3, 0x29 },
+	{ 0x68, 0x59, 0x9d, 0xe6, 0x67, 0xb8, 0xb7, 0xb0, 0xa8, 0x4f, 0x5e, 0x2d, 0x13, 0xe8, 0x6d, 0x7c },
+	{ 0x77, 0x45, 0x72, 0xd4, 0xee, 0xb7, 0xab, 0x2c, 0x4f, 0xd3, 0x6c, 0x15, 0x46, 0x12, 0xc7, 0xcb },
+	{ 0xfe, 0xf2, 0xfc, 0xa0, 0x18, 0xb7, 0x09, 0xd1, 0x2e, 0xbd, 0xfb, 0x92, 0x0f, 0x04, 0x9e, 0x82 },
+	{ 0x88, 0x68, 0x42, 0xb6, 0x5b, 0x73, 0x89, 0x46, 0xc8, 0xd3, 0x39, 0x44, 0x08, 0x5b, 0x6b, 0x24 },
+	{ 0x10, 0xe6, 0x00, 0xb7, 0x36, 0xa0, 0x8c, 0xc4, 0x90, 0xc4, 0x50, 0xf5, 0x5f, 0x47, 0xcb, 0x8e },
+	{ 0x42, 0x27, 0x1e, 0x7c, 0xc6, 0x70, 0x4e, 0xf4, 0x12, 0xa7, 0x18, 0xb5, 0x93, 0xb1, 0xd3, 0x14 },
+	{ 0xce, 0xe8, 0xda, 0xcf, 0x6e, 0xa2, 0x31, 0x3f, 0x7e, 0x57, 0xf2, 0x19, 0x6b, 0xb8, 0xe0, 0x05 },
+	{ 0x1c, 0xb2, 0xfb, 0xaf, 0x9e, 0xae, 0x2c, 0x2b, 0x7c, 0x03, 0x99, 0x10, 0xdf, 0x96, 0xd2, 0x22 },
+	{ 0x27, 0xd8, 0xba, 0x09, 0x54, 0x02, 0x1b, 0x27, 0x7f, 0x75, 0x13, 0xd2, 0x6e, 0x0e, 0x3a, 0x8f },
+	{ 0x00, 0x69, 0x6c, 0x74, 0x7c, 0x9f, 0x60, 0x15, 0x00, 0x91, 0x51, 0x20, 0x8d, 0xd6, 0xc6, 0x5d },
+	{ 0x49, 0x48, 0x53, 0x62, 0x2c, 0xec, 0xc9, 0xc9, 0x71, 0xb0, 0x67, 0x09, 0x92, 0xc2, 0x6b, 0xcc },
+	{ 0xa7, 0xa3, 0x84, 0xcf, 0x95, 0xb2, 0x6a, 0x9c, 0xff, 0xac, 0xea, 0x41, 0x28, 0xa3, 0x56, 0x60 },
+	{ 0xfa, 0xed, 0x72, 0x2d, 0xc9, 0xde, 0x96, 0xaa, 0x8a, 0x54, 0xd0, 0x25, 0x7e, 0x9d, 0xce, 0xcd },
+	{ 0x15, 0x0f, 0xaf, 0x88, 0x34, 0x8c, 0x8b, 0xa2, 0x1d, 0xa8, 0x78, 0x49, 0xbd, 0xed, 0xf5, 0x0e },
+	{ 0xf4, 0xf0, 0x61, 0xa5, 0x11, 0x77, 0xa7, 0x8c, 0x14, 0xc6, 0x7d, 0xb8, 0x4b, 0xcc, 0x91, 0xe1 },
+	{ 0xea, 0x46, 0xe6, 0x55, 0x10, 0x6b, 0x77, 0x8c, 0xfa, 0xe6, 0x16, 0x77, 0x0c, 0x0a, 0xe1, 0x10 },
+	{ 0xf2, 0xe3, 0x5e, 0x46, 0x2a, 0x2e, 0xb1, 0x5d, 0x42, 0x83, 0x79, 0x4b, 0x5b, 0xd0, 0x2f, 0x64 },
+	{ 0x76, 0xc9, 0x2e, 0xca, 0x3a, 0x70, 0xed, 0x30, 0x66, 0x40, 0x59, 0x95, 0xf5, 0x5c, 0x10, 0x30 },
+	{ 0x5f, 0x6a, 0xd9, 0x80, 0x98, 0x20, 0xb3, 0x52, 0x77, 0x5a, 0xa2, 0xb2, 0x12, 0x8f, 0x51, 0x19 },
+	{ 0xd1, 0x9b, 0x19, 0xce, 0x08, 0xa6, 0xd9, 0xd8, 0x39, 0x67, 0xc4, 0xe0, 0x4a, 0x8c, 0xe2, 0xaa },
+	{ 0x8f, 0xc8, 0xeb, 0x7b, 0x3f, 0x1b, 0x72, 0xc2, 0x27, 0x34, 0x20, 0xdf, 0xf4, 0x1f, 0xe1, 0xad },
+	{ 0xeb, 0x01, 0x9e, 0x3f, 0x42, 0xdf, 0xa2, 0x2e, 0xe3, 0xd0, 0xc1, 0x3d, 0x4b, 0x73, 0x75, 0x7e },
+	{ 0xc7, 0x6f, 0x86, 0x3d, 0x03, 0xf3, 0x83, 0x25, 0x1f, 0x36, 0x8c, 0x2c, 0xe8, 0x31, 0xed, 0x7d },
+	{ 0x1c, 0x88, 0x03, 0x1b, 0xa0, 0x3b, 0x39, 0xbc, 0x7c, 0xc9, 0xde, 0x36, 0x40, 0x74, 0xe9, 0x96 },
+	{ 0x2e, 0x51, 0x0f, 0x9c, 0xbf, 0xb1, 0xc8, 0x40, 0xde, 0x96, 0x79, 0xbf, 0xf1, 0x94, 0x2d, 0x17 },
+	{ 0x93, 0xa3, 0x7d, 0x5a, 0x90, 0x80, 0xf1, 0x79, 0xcb, 0x62, 0x91, 0x72, 0xe7, 0x63, 0xc7, 0xd6 },
+	{ 0x20, 0x8d, 0x8d, 0x8e, 0xef, 0x13, 0xac, 0xe2, 0x20, 0x32, 0x0a, 0xa4, 0xd1, 0xda, 0xb8, 0x4b },
+	{ 0x23, 0x94, 0xbc, 0xb6, 0x86, 0xfd, 0x3a, 0x5a, 0xdb, 0xb5, 0x50, 0x1e, 0xef, 0xf3, 0x8c, 0x08 },
+	{ 0x3d, 0x67, 0xdc, 0x1e, 0x45, 0x24, 0xb0, 0x2b, 0x85, 0x54, 0x42, 0x81, 0xc3, 0xe1, 0x6f, 0xf2 },
+	{ 0xb3, 0x45, 0x87, 0x33, 0xff, 0x4d, 0x17, 0x94, 0xeb, 0xb1, 0x78, 0x83, 0x08, 0xd0, 0x74, 0x68 },
+	{ 0x21, 0x48, 0x45, 0x78, 0x21, 0x88, 0xd7, 0x84, 0x09, 0x1c, 0xb5, 0x6a, 0x10, 0x44, 0x4d, 0xb9 },
+	{ 0xae, 0x85, 0x45, 0xd6, 0x7d, 0x01, 0x79, 0xcb, 0x5e, 0x5f, 0xa2, 0x4f, 0x38, 0x00, 0x11, 0x46 },
+	{ 0x41, 0xd5, 0xd2, 0x06, 0x11, 0x9c, 0x83, 0x67, 0x29, 0x4e, 0xbf, 0x0e, 0xe2, 0x1e, 0x06, 0x05 },
+	{ 0x3a, 0x1d, 0x0a, 0x95, 0x27, 0xc0, 0x68, 0xa7, 0xca, 0xd5, 0xc1, 0xda, 0x70, 0xe4, 0x34, 0xab },
+	{ 0xc4, 0xa7, 0xcb, 0xf4, 0xe9, 0x35, 0x62, 0x54, 0x64, 0x09, 0xdd, 0xf8, 0xb8, 0xcc, 0xf6, 0x92 },
+	{ 0xa8, 0x49, 0xc0, 0x6e, 0x48, 0x6d, 0x1c, 0x07, 0xe8, 0x79, 0xb8, 0x9b, 0x17, 0x7b, 0xf6, 0x87 },
+	{ 0x81, 0x19, 0xe6, 0xb8, 0xee, 0x36, 0xcf, 0x9b, 0x69, 0xec, 0x8d, 0x30, 0x24, 0xf7, 0x60, 0x28 },
+	{ 0x64, 0xeb, 0xa6, 0xfe, 0x9b, 0x40, 0xe4, 0x74, 0x04, 0x56, 0xe1, 0x9f, 0xf4, 0xaa, 0xd7, 0x69 },
+	{ 0xdc, 0x97, 0xe0, 0x92, 0xbf, 0x86, 0xd4, 0x65, 0x3c, 0x9f, 0x84, 0xc8, 0x3b, 0xe1, 0x60, 0x8b },
+	{ 0x9a, 0xd9, 0x2e, 0x8b, 0x75, 0xb5, 0xe6, 0x86, 0x2a, 0x89, 0xbd, 0x33, 0x35, 0x06, 0x54, 0xd4 },
+	{ 0xa8, 0x5e, 0x3c, 0xb9, 0xc7, 0x26, 0x96, 0x3e, 0xe8, 0x96, 0x95, 0x08, 0x67, 0x0c, 0xeb, 0xcd },
+	{ 0x5f, 0x7f, 0x55, 0xcb, 0x17, 0xda, 0x2c, 0x8a, 0x77, 0x77, 0x7f, 0x1f, 0x62, 0x20, 0x46, 0x5f },
+	{ 0x45, 0x43, 0xc9, 0xee, 0xdc, 0x13, 0x57, 0xa3, 0xcd, 0x47, 0x3c, 0x9c, 0x00, 0x5c, 0x9c, 0x17 },
+	{ 0x96, 0x56, 0xbc, 0x58, 0x2a, 0x84, 0x99, 0x13, 0x86, 0x72, 0x63, 0x39, 0xc7, 0x37, 0xc9, 0x7b },
+	{ 0xe4, 0xb6, 0x70, 0xc4, 0xdd, 0xf0, 0x33, 0xea, 0x84, 0x8d, 0xb8, 0x0f, 0xae, 0x3f, 0xf4, 0x3a },
+	{ 0xbc, 0x1f, 0xcf, 0x4e, 0x4f, 0x2c, 0xa2, 0xba, 0x1c, 0x8a, 0x57, 0x91, 0xb9, 0x97, 0x9c, 0x85 },
+	{ 0xa0, 0x15, 0xb4, 0xf2, 0xaa, 0x49, 0x43, 0x4b, 0xa0, 0x6e, 0xa7, 0xe7, 0x55, 0x8b, 0x6e, 0x92 },
+	{ 0x7c, 0xf0, 0x37, 0xe7, 0xf0, 0x4a, 0xd0, 0xbd, 0xdc, 0x08, 0x66, 0xdc, 0xc6, 0x50, 0x36, 0xa8 },
+	{ 0xe1, 0x42, 0xa6, 0xa5, 0xc1, 0x19, 0xf9, 0xf6, 0xc9, 0xd4, 0x7d, 0x8f, 0xbc, 0x1f, 0xd0, 0x67 },
+	{ 0x5d, 0x09, 0xe6, 0xf7, 0xb3, 0xf1, 0xd5, 0x45, 0xa5, 0xa3, 0x29, 0x92, 0xe4, 0x4d, 0x1d, 0x84 },
+	{ 0xa7, 0xb8, 0x00, 0x1a, 0x15, 0x6c, 0xe4, 0xd3, 0xff, 0xc9, 0xc7, 0xae, 0x77, 0x34, 0x4b, 0xa6 },
+	{ 0x57, 0xcd, 0x60, 0x90, 0x7e, 0x5d, 0x79, 0x81, 0x2f, 0xbe, 0x3f, 0xde, 0xc3, 0xc8, 0x02, 0xc6 },
+	{ 0xa7, 0x8e, 0x08, 0x85, 0x16, 0xf9, 0xf0, 0x64, 0xff, 0x8f, 0x0d, 0xd5, 0xd8, 0x11, 0x62, 0x1a },
+	{ 0x1a, 0xa5, 0xf8, 0x50, 0xb7, 0x65, 0x36, 0xfc, 0xaa, 0xc0, 0x94, 0xa3, 0xee, 0x9a, 0x70, 0xa5 },
+	{ 0x44, 0xc7, 0x85, 0xe4, 0x28, 0xcc, 0x98, 0xa7, 0xe4, 0xb4, 0x28, 0x1c, 0xb0, 0xa6, 0xe5, 0x7b },
+	{ 0x85, 0xca, 0x7f, 0x02, 0x41, 0x29, 0x5b, 0xe4, 0x0d, 0xe1, 0x44, 0xea, 0x77, 0x18, 0x5e, 0xc5 },
+	{ 0x7d, 0xea, 0x63, 0xb0, 0xa0, 0xeb, 0x68, 0x06, 0xc5, 0x49, 0xa8, 0xe9, 0xf3, 0x6d, 0xa8, 0xe7 },
+	{ 0x8e, 0xce, 0xbf, 0xb2, 0x8f, 0x7a, 0xd9, 0x79, 0x3e, 0xf3, 0xdd, 0xd1, 0xc7, 0x02, 0x6f, 0x6e },
+	{ 0x24, 0xe6, 0x07, 0x2c, 0x3c, 0xd2, 0x05, 0xe7, 0xc4, 0x0e, 0xaa, 0xc4, 0xa0, 0x86, 0x5a, 0x18 },
+	{ 0x7a, 0xb9, 0x3c, 0xf3, 0x0a, 0x8f, 0xe6, 0x1f, 0x0a, 0x8c, 0xa7, 0x95, 0x37, 0x32, 0xeb, 0x9e },
+	{ 0x65, 0x91, 0xe2, 0x9d, 0x4e, 0xfb, 0x95, 0xdf, 0xed, 0x22, 0xaf, 0xf9, 0xe3, 0x82, 0x77, 0x91 },
+	{ 0x19, 0xea, 0x40, 0x67, 0x85, 0xf1, 0x0a, 0x5a, 0xc1, 0xd6, 0xe9, 0xdc, 0xaf, 0x31, 0xdc, 0x37 },
+	{ 0x70, 0x78, 0x2d, 0x18, 0x86, 0x22, 0x17, 0x35, 0xf0, 0x3d, 0x92, 0x74, 0x85, 0x46, 0x01, 0x2c },
+	{ 0xcf, 0xcd, 0x8a, 0x4e, 0x9f, 0x89, 0x50, 0x50, 0x67, 0x7b, 0x57, 0xba, 0x48, 0x44, 0x5e, 0xff },
+	{ 0x18, 0x44, 0x05, 0xc8, 0xd2, 0x36, 0x59, 0xef, 0xd8, 0x09, 0x1c, 0x83, 0xc0, 0x59, 0x3c, 0x10 },
+	{ 0x21, 0x9c, 0x35, 0xa2, 0x1e, 0x6e, 0xbe, 0x62, 0x09, 0x90, 0x29, 0x1e, 0x4e, 0x89, 0x1f, 0xd1 },
+	{ 0x55, 0xab, 0xe1, 0xe6, 0x17, 0x5b, 0x09, 0x1b, 0x5d, 0x5e, 0x5e, 0x04, 0x84, 0x3b, 0xac, 0x02 },
+	{ 0xb8, 0x2f, 0xc1, 0x25, 0x7f, 0x0d, 0xa9, 0xcb, 0x78, 0x3e, 0x09, 0x91, 0x77, 0xc2, 0xc1, 0x16 },
+	{ 0x21, 0x1e, 0x4d, 0xe3, 0x22, 0x15, 0xe4, 0x15, 0x09, 0xe2, 0xfa, 0x90, 0x71, 0x21, 0x64, 0x2d },
+	{ 0x65, 0xa6, 0x5e, 0xe8, 0xcd, 0xb4, 0x0f, 0x17, 0xed, 0x3f, 0x8c, 0x66, 0x33, 0x14, 0x6c, 0xd7 },
+	{ 0x11, 0xb6, 0x34, 0xeb, 0xe7, 0xcd, 0x31, 0x9e, 0x79, 0xcb, 0xd8, 0x28, 0xee, 0x41, 0x54, 0x42 },
+	{ 0x82, 0xaa, 0xa5, 0x0d, 0x22, 0x38, 0x07, 0xcf, 0x52, 0x9c, 0x7e, 0x1d, 0xc4, 0x3d, 0x0c, 0x0a },
+	{ 0x0b, 0x11, 0x43, 0x0f, 0x36, 0x9a, 0x74, 0xc4, 0x03, 0x55, 0x9d, 0x54, 0x40, 0xe6, 0x72, 0x26 },
+	{ 0xe2, 0xe8, 0xe1, 0x44, 0x74, 0xd4, 0xaa, 0x61, 0xb2, 0xa1, 0x4b, 0xe9, 0xab, 0xf7, 0x6f, 0x8f },
+	{ 0x19, 0x14, 0x39, 0xfc, 0x83, 0x64, 0xfe, 0xc8, 0xc1, 0x10, 0xa4, 0xb6, 0x4e, 0x54, 0xc5, 0xc3 },
+	{ 0x6f, 0xfc, 0xe9, 0x0d, 0xd2, 0xda, 0x58, 0x39, 0x07, 0xab, 0x7e, 0xf4, 0x34, 0x91, 0x4a, 0x90 },
+	{ 0x97, 0xfc, 0xf7, 0xf7, 0xdc, 0x3e, 0x4b, 0x7e, 0x6f, 0x3f, 0x31, 0x93, 0xb6, 0x0f, 0x69, 0xa3 },
+	{ 0xe7, 0x93, 0xa7, 0x57, 0x76, 0x67, 0xcf, 0xf2, 0x3f, 0xd7, 0x44, 0xb0, 0x2c, 0x36, 0xdf, 0x6b },
+	{ 0xb7, 0x20, 0x19, 0x12, 0x50, 0xb3, 0x96, 0x4b, 0x8f, 0xe0, 0xe9, 0x16, 0xfb, 0x13, 0x5b, 0x91 },
+	{ 0x2f, 0x21, 0x43, 0xd0, 0x70, 0xdf, 0x6d, 0x1a, 0xc7, 0x9d, 0x01, 0xf3, 0x7f, 0x8f, 0xb6, 0xca },
+	{ 0xa3, 0xb3, 0x76, 0xa6, 0xc5, 0x93, 0x71, 0xad, 0x5b, 0x61, 0x9c, 0x41, 0xe6, 0xcd, 0x7b, 0xf1 },
+	{ 0xff, 0x98, 0x38, 0x40, 0xcb, 0x71, 0xbb, 0x3b, 0x17, 0x8a, 0xc9, 0xec, 0xfe, 0xdb, 0x3d, 0xaa },
+	{ 0x42, 0x51, 0x16, 0x11, 0xc5, 0xe3, 0x41, 0x63, 0x12, 0xe1, 0xd2, 0x8e, 0x32, 0xd4, 0xbc, 0xa0 },
+	{ 0xb5, 0x91, 0xfe, 0x71, 0x64, 0xc3, 0x7a, 0x69, 0xbd, 0x4b, 0x14, 0x37, 0xe7, 0x7f, 0xb4, 0xb7 },
+	{ 0x0a, 0x80, 0x83, 0xba, 0x02, 0x99, 0x3c, 0x91, 0x1a, 0xa5, 0xac, 0x67, 0xa0, 0x9f, 0xc7, 0x44 },
+	{ 0x9f, 0x5a, 0xfc, 0x08, 0x79, 0xd5, 0x17, 0xa9, 0xb7, 0x84, 0xfc, 0x20, 0x17, 0x22, 0xda, 0x24 },
+	{ 0x31, 0x6d, 0xba, 0x0e, 0xd6, 0x54, 0xd1, 0xef, 0x99, 0x37, 0x9d, 0xa6, 0x5e, 0x3f, 0xf6, 0x19 },
+	{ 0x33, 0x7a, 0xbd, 0x6d, 0xbd, 0x9d, 0xc7, 0x1e, 0x6b, 0x7a, 0xa1, 0x13, 0x4f, 0x3b, 0x58, 0x97 },
+	{ 0x57, 0xf7, 0x58, 0x25, 0x7d, 0xd0, 0x6c, 0xf0, 0x2f, 0xf8, 0xf9, 0xb7, 0x62, 0xeb, 0xeb, 0x51 },
+	{ 0x86, 0xaf, 0x2f, 0x81, 0x71, 0x10, 0x7a, 0xf5, 0xf6, 0x04, 0xaa, 0x8a, 0x55, 0xa4, 0xdb, 0xbe },
+	{ 0xd6, 0x5b, 0x5b, 0x2b, 0x8a, 0xf2, 0x77, 0xa1, 0xc6, 0xb9, 0x9a, 0x14, 0x1b, 0x5c, 0x46, 0xcd },
+	{ 0xb1, 0x0e, 0x8c, 0x3f, 0x19, 0x92, 0x2d, 0xf6, 0x19, 0x35, 0xba, 0x3c, 0x79, 0xb1, 0x29, 0x5f },
+	{ 0x4c, 0x10, 0x0e, 0xab, 0x45, 0xa9, 0xeb, 0x9a, 0x2c, 0xdd, 0x16, 0x3d, 0xc1, 0x27, 0x62, 0xb7 },
+	{ 0x1c, 0xc7, 0x77, 0xfa, 0x1d, 0x68, 0xa6, 0x62, 0x7c, 0x20, 0x76, 0x7d, 0x2e, 0x28, 0xc7, 0x68 },
+	{ 0x6a, 0xfd, 0x33, 0xd1, 0xd2, 0x61, 0x4d, 0xca, 0x7a, 0x01, 0x11, 0x7a, 0x76, 0x0d, 0x09, 0x9c },
+	{ 0x65, 0x67, 0xea, 0x08, 0x50, 0x88, 0xa2, 0x70, 0xed, 0xe8, 0xf4, 0x1f, 0x45, 0x60, 0x8e, 0x05 },
+	{ 0x1a, 0x90, 0x7c, 0x06, 0x38, 0xac, 0xbc, 0xc4, 0xaa, 0xa3, 0xb7, 0x36, 0x9f, 0x09, 0x7c, 0x5f },
+	{ 0xad, 0xb5, 0x11, 0xa2, 0xcc, 0xd3, 0xd3, 0xf1, 0x75, 0x58, 0x1a, 0x1c, 0xaa, 0x05, 0x88, 0x92 },
+	{ 0x2a, 0x8b, 0xf9, 0x07, 0xee, 0x05, 0xc3, 0xc0, 0x3a, 0x85, 0xe5, 0x98, 0x4e, 0xe2, 0x3b, 0x34 },
+	{ 0xb9, 0x42, 0x98, 0xbb, 0xb6, 0xb5, 0x06, 0xb2, 0x61, 0x40, 0xcb, 0xf0, 0x3a, 0xa1, 0xb1, 0x54 },
+	{ 0x6c, 0x1f, 0xb3, 0x7a, 0x39, 0x64, 0xbd, 0x30, 0x4c, 0x61, 0xf2, 0x53, 0xb6, 0x9a, 0x5f, 0x5f },
+	{ 0xf7, 0xa3, 0xa0, 0xa3, 0xab, 0x7a, 0x4f, 0x26, 0xcf, 0xd5, 0x4f, 0x7f, 0x2b, 0xa0, 0x93, 0x86 },
+	{ 0xa8, 0xf5, 0xcf, 0x44, 0x4b, 0x87, 0x35, 0x29, 0xe8, 0x05, 0x44, 0xe8, 0xd9, 0x35, 0x24, 0x70 },
+	{ 0xc4, 0x7d, 0xd3, 0x5f, 0xeb, 0xc2, 0x6e, 0xe5, 0x64, 0xcf, 0x22, 0x1f, 0x1a, 0xaa, 0x0d, 0x07 },
+	{ 0xed, 0x23, 0x1d, 0xe9, 0xa8, 0xe1, 0x12, 0x95, 0xb5, 0x30, 0xa3, 0x17, 0x8b, 0x00, 0xcc, 0x41 },
+	{ 0x64, 0x2a, 0x1b, 0xde, 0x19, 0x6d, 0x51, 0x1b, 0x04, 0xad, 0x78, 0xe6, 0xe2, 0x5e, 0xb5, 0x3b },
+	{ 0x64, 0x15, 0x9f, 0x93, 0x9a, 0xb3, 0xd7, 0xe3, 0x04, 0x90, 0x9b, 0x79, 0x93, 0xcd, 0xc0, 0xf5 },
+	{ 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x1e, 0x1d, 0xdd, 0x6c, 0x4f, 0x91, 0xf4, 0x45, 0x25 },
+	{ 0xac, 0x39, 0xce, 0x97, 0x18, 0x8c, 0x15, 0xf6, 0x8c, 0xc5, 0x06, 0x9c, 0x59, 0x50, 0xd1, 0xf6 },
+	{ 0xe9, 0xca, 0xa2, 0x4b, 0x5c, 0x23, 0xb9, 0x90, 0x11, 0x54, 0x03, 0xf7, 0xbb, 0x54, 0x2a, 0x75 },
+	{ 0x2f, 0xe2, 0xce, 0xf0, 0xf2, 0xb2, 0x00, 0x74, 0xc7, 0x46, 0x6a, 0xac, 0x91, 0xdb, 0xd8, 0xf8 },
+	{ 0xba, 0x51, 0x40, 0xcf, 0xe5, 0x0f, 0x19, 0x32, 0x4a, 0x9e, 0xea, 0x6a, 0xb7, 0x4f, 0x18, 0xda },
+	{ 0xd2, 0xd8, 0xe8, 0xf8, 0x3e, 0xc1, 0x2a, 0x2e, 0x22, 0xa3, 0x40, 0x1a, 0xad, 0x8d, 0xbb, 0x74 },
+	{ 0xca, 0x7a, 0xe4, 0xe7, 0xa2, 0x2a, 0x5e, 0x03, 0xda, 0x5d, 0x75, 0x8c, 0x4c, 0x7b, 0x4a, 0xf3 },
+	{ 0xa1, 0x13, 0x0f, 0x3e, 0x63, 0x38, 0x27, 0xfa, 0x89, 0x53, 0x8c, 0xda, 0xc9, 0xd8, 0x69, 0x8a },
+	{ 0x85, 0x1e, 0x70, 0x2c, 0x3e, 0x0f, 0x42, 0xc2, 0x0d, 0x55, 0xb9, 0x9d, 0xb5, 0x5d, 0x30, 0xdd },
+	{ 0x7d, 0xff, 0xdf, 0xfa, 0x1f, 0xa5, 0xe2, 0x3d, 0xc5, 0x66, 0x85, 0x56, 0x43, 0xff, 0x9c, 0x2d },
+	{ 0x66, 0x61, 0x16, 0xd2, 0xff, 0x28, 0x3b, 0xb9, 0xd6, 0x29, 0x37, 0x2d, 0x72, 0x7d, 0x00, 0x45 },
+	{ 0x56, 0x90, 0x91, 0x65, 0x48, 0x42, 0x28, 0x2c, 0x46, 0x82, 0xc3, 0xa4, 0x61, 0xc7, 0x29, 0xfc },
+	{ 0xfb, 0x54, 0x3a, 0xed, 0xfd, 0x6c, 0xdb, 0x6e, 0x73, 0xca, 0x06, 0x39, 0x7f, 0xc1, 0x90, 0x23 },
+	{ 0xb9, 0xc0, 0x80, 0x7a, 0xb2, 0x0e, 0xe1, 0xfe, 0x61, 0xee, 0xf9, 0x7d, 0x17, 0x09, 0x6d, 0xf8 },
+	{ 0xc3, 0xec, 0x13, 0x0b, 0xb8, 0xc1, 0x36, 0xb2, 0x7b, 0x1f, 0x32, 0x32, 0x7a, 0x63, 0x62, 0x25 },
+	{ 0xbb, 0x64, 0x17, 0x65, 0x1d, 0xb8, 0x76, 0x18, 0x33, 0xa0, 0xac, 0xca, 0x7a, 0x2e, 0x08, 0x18 },
+	{ 0x36, 0xc4, 0x8f, 0xf7, 0xda, 0x01, 0x0f, 0xa3, 0x26, 0xf9, 0x21, 0xba, 0xa1, 0x38, 0x93, 0xde },
+	{ 0x2a, 0x76, 0x7d, 0xbd, 0x6e, 0x4c, 0x49, 0x89, 0x3a, 0x68, 0x08, 0x2c, 0xff, 0x50, 0x47, 0xee },
+	{ 0x31, 0xda, 0x55, 0x05, 0x5b, 0x42, 0x7d, 0x6b, 0x99, 0x6c, 0x91, 0xac, 0x32, 0x46, 0x46, 0x30 },
+	{ 0xa2, 0x37, 0x33, 0x9c, 0x11, 0x4c, 0xb3, 0xb1, 0x72, 0xce, 0x88, 0xc1, 0x95, 0x18, 0xc5, 0x55 },
+	{ 0xc5, 0xcf, 0x1e, 0xd5, 0xa0, 0x97, 0x39, 0x72, 0x4d, 0x28, 0x7c, 0xc5, 0xcb, 0x3c, 0xdb, 0x16 },
+	{ 0x5d, 0x33, 0xde, 0x8c, 0xb2, 0x64, 0xc9, 0xb4, 0xa5, 0xdd, 0xe3, 0x6b, 0x83, 0x70, 0x06, 0x10 },
+	{ 0x5c, 0x78, 0x26, 0xa3, 0x80, 0xf0, 0x9d, 0x12, 0xbc, 0xf3, 0x38, 0xa5, 0x44, 0x07, 0x72, 0xa2 },
+	{ 0xf1, 0x3d, 0x23, 0xa7, 0x77, 0x73, 0xff, 0xf2, 0x59, 0xb6, 0xab, 0xf1, 0x6b, 0xf8, 0x8f, 0x3c },
+	{ 0x50, 0x15, 0x98, 0x1e, 0x95, 0x81, 0x5e, 0xc1, 0xd0, 0x45, 0x42, 0xaa, 0x52, 0x8e, 0x31, 0x6c },
+	{ 0x0c, 0xe1, 0x76, 0x43, 0xe7, 0xc7, 0x19, 0x9e, 0xec, 0x5b, 0x25, 0x88, 0xce, 0xe0, 0xfb, 0xd9 },
+	{ 0x69, 0xff, 0xd8, 0x85, 0x1a, 0x73, 0x69, 0x1b, 0x91, 0x1c, 0x2c, 0x87, 0x02, 0xc0, 0x0d, 0xa4 },
+	{ 0xab, 0x93, 0x92, 0xf8, 0x65, 0xd1, 0x63, 0x8b, 0xa3, 0xf8, 0x38, 0x42, 0x6a, 0x78, 0x31, 0xcf },
+	{ 0x67, 0x5f, 0x71, 0x1d, 0xb8, 0x17, 0x1f, 0x68, 0xbf, 0x0e, 0x1c, 0x20, 0xe6, 0xca, 0xfb, 0x3c },
+	{ 0x10, 0x3a, 0xf1, 0xe0, 0x33, 0x86, 0x73, 0xa2, 0x90, 0x38, 0xc5, 0xa8, 0x9d, 0x8c, 0x9d, 0xa6 },
+	{ 0xa6, 0x51, 0x39, 0x5a, 0xe0, 0xdd, 0x9f, 0x0f, 0x16, 0x54, 0x91, 0x9b, 0x76, 0x10, 0x89, 0x50 },
+	{ 0x1c, 0x5e, 0x0b, 0x86, 0xa1, 0xc8, 0x45, 0x4d, 0x7c, 0x8f, 0x24, 0x5d, 0xa1, 0x51, 0x00, 0x0b },
+	{ 0x9a, 0xc4, 0xb2, 0x40, 0xf6, 0xfb, 0x6c, 0x4f, 0x2a, 0x6c, 0xe0, 0xc6, 0xe5, 0x74, 0x5f, 0x8e },
+	{ 0x18, 0x98, 0xf5, 0xf1, 0xcf, 0x1c, 0x40, 0xcd, 0xd8, 0x7d, 0x90, 0x36, 0xfe, 0x9e, 0x0e, 0x28 },
+	{ 0x89, 0x4d, 0xf2, 0x34, 0x8c, 0x5a, 0xa8, 0x57, 0xb1, 0xf7, 0x9e, 0xe4, 0xe5, 0xe6, 0xe8, 0x1d },
+	{ 0xad, 0xa0, 0x95, 0x57, 0x4d, 0x1a, 0x5a, 0xba, 0x75, 0x3b, 0x3d, 0xaf, 0x5a, 0x74, 0x93, 0x4c },
+	{ 0x53, 0x07, 0x4b, 0xfc, 0xac, 0xb1, 0x73, 0x01, 0x8b, 0xac, 0xab, 0xb7, 0x20, 0x16, 0x11, 0xe3 },
+	{ 0x53, 0xc8, 0xd6, 0x1c, 0x2f, 0x85, 0x06, 0x5b, 0x8b, 0x55, 0x14, 0x71, 0x32, 0x62, 0x33, 0x11 },
+	{ 0x0d, 0x33, 0xc2, 0xb8, 0x9c, 0x9c, 0xe4, 0x2a, 0xd5, 0xb4, 0x7e, 0x2e, 0x80, 0x73, 0xc9, 0xe9 },
+	{ 0xe6, 0x41, 0x5c, 0xe2, 0xc0, 0x92, 0x04, 0x66, 0x56, 0x7e, 0xeb, 0x09, 0x7b, 0xa3, 0x11, 0x5c },
+	{ 0x09, 0xef, 0xc3, 0x65, 0xcf, 0x97, 0x04, 0x5e, 0x31, 0xf5, 0xbb, 0x7a, 0x00, 0x59, 0x1c, 0x63 },
+	{ 0x5a, 0x80, 0x9f, 0x8e, 0x18, 0x61, 0x21, 0x1b, 0xea, 0xcd, 0x11, 0xa5, 0xa3, 0x9c, 0x04, 0x6b },
+	{ 0x92, 0x3c, 0xb6, 0x9a, 0x5b, 0xf2, 0xac, 0xb5, 0xe2, 0xec, 0x5a, 0x5f, 0xe6, 0x3f, 0x05, 0x81 },
+	{ 0x06, 0xa5, 0xf1, 0xdb, 0xb1, 0x33, 0xbd, 0xd9, 0x76, 0x76, 0x3b, 0xd4, 0xad, 0x5b, 0xe1, 0x1b },
+	{ 0x3b, 0x99, 0x4d, 0x9f, 0xdb, 0x07, 0x27, 0xa3, 0xb3, 0x68, 0xd5, 0x5a, 0xc1, 0x99, 0xeb, 0x46 },
+	{ 0x5b, 0x11, 0x5f, 0xe3, 0x4b, 0x62, 0x59, 0x4e, 0xd3, 0x7d, 0x02, 0x92, 0x43, 0xe3, 0xaf, 0x4c },
+	{ 0x74, 0xe6, 0x23, 0x00, 0x52, 0x9a, 0xea, 0x70, 0x94, 0x37, 0x0f, 0x02, 0xa4, 0x83, 0x97, 0x3e },
+	{ 0x74, 0xd1, 0xa7, 0xb5, 0xd2, 0xe0, 0x70, 0x39, 0x94, 0x1a, 0x32, 0x95, 0x54, 0xf2, 0xa2, 0xf8 },
+	{ 0xf3, 0x5f, 0xa2, 0x50, 0xde, 0x75, 0x6f, 0x59, 0x2b, 0x16, 0x8d, 0xcb, 0xab, 0x85, 0xe6, 0xff },
+	{ 0x93, 0xe2, 0xf1, 0x39, 0x0e, 0xad, 0x5e, 0x20, 0xcb, 0xb9, 0x28, 0xb9, 0xd5, 0x17, 0xa5, 0xa8 },
+	{ 0x05, 0x53, 0xa6, 0x66, 0xfc, 0x5e, 0xf2, 0x4c, 0x8d, 0x1d, 0xe2, 0x2d, 0xfc, 0xc8, 0x13, 0x0c },
+	{ 0xa6, 0xe8, 0xcc, 0xe5, 0x63, 0x3e, 0x3f, 0xfa, 0x16, 0xc3, 0x3f, 0x7b, 0xe9, 0x39, 0xc2, 0xf2 },
+	{ 0x1d, 0xef, 0xca, 0xda, 0xd4, 0xc9, 0x7d, 0x80, 0x65, 0x3f, 0x15, 0x4a, 0x41, 0x98, 0xab, 0xec },
+	{ 0xf8, 0xf5, 0xeb, 0x18, 0x61, 0x4f, 0x1a, 0xb3, 0xb8, 0x2e, 0xa9, 0x25, 0xdd, 0x32, 0x61, 0x96 },
+	{ 0xab, 0xfc, 0xfe, 0x6c, 0xe2, 0x70, 0xc4, 0xa0, 0xa3, 0x89, 0x8a, 0x62, 0xf7, 0x4e, 0xf8, 0x2c },
+	{ 0x69, 0x6c, 0x74, 0x7c, 0x9f, 0x60, 0x15, 0x97, 0x91, 0x51, 0x20, 0x8d, 0xd6, 0xc6, 0x5d, 0xba },
+	{ 0x50, 0x3f, 0x90, 0xb3, 0x93, 0xf4, 0x51, 0x30, 0xd0, 0x7f, 0xfc, 0x83, 0xf1, 0xb0, 0x1a, 0xf8 },
+	{ 0xe9, 0xb5, 0x26, 0x01, 0xdd, 0x69, 0x3f, 0x59, 0x11, 0x37, 0x26, 0x8a, 0x6c, 0xc3, 0x35, 0x2f },
+	{ 0xf8, 0x0a, 0x68, 0x63, 0xe0, 0x08, 0x94, 0xea, 0xb8, 0x4b, 0x86, 0x92, 0x2c, 0xc4, 0x55, 0xdc },
+	{ 0x7e, 0xfd, 0x3a, 0x46, 0xd8, 0x93, 0xc6, 0xec, 0xae, 0x4b, 0x6a, 0x49, 0xb7, 0x4c, 0x98, 0x25 },
+	{ 0x39, 0xa1, 0xc6, 0x8a, 0x73, 0x78, 0xaa, 0xab, 0xe1, 0x42, 0xae, 0x5a, 0x20, 0x2f, 0x7e, 0x0f },
+	{ 0xf2, 0x7a, 0xf2, 0xd1, 0xad, 0x8e, 0x50, 0x48, 0x42, 0xf2, 0x27, 0x2b, 0xce, 0xf9, 0x68, 0x06 },
+	{ 0x3d, 0xd0, 0x48, 0x93, 0xc1, 0xc3, 0x10, 0x41, 0x85, 0xe5, 0x93, 0xa1, 0x50, 0xb8, 0x36, 0x50 },
+	{ 0x9b, 0x2b, 0x7a, 0x00, 0x2b, 0x8a, 0xb1, 0x13, 0x13, 0xe2, 0x16, 0xda, 0xe6, 0x98, 0x21, 0xe4 },
+	{ 0xce, 0x12, 0xd3, 0x64, 0x6d, 0x15, 0x25, 0xae, 0x7e, 0x91, 0xac, 0xf3, 0x09, 0xdb, 0xc9, 0x91 },
+	{ 0x9e, 0xf3, 0x34, 0x49, 0x44, 0x47, 0xd3, 0xe4, 0xce, 0x0e, 0xc6, 0x0d, 0x16, 0xfe, 0x17, 0xcf },
+	{ 0x61, 0x0e, 0x70, 0x6b, 0x03, 0xca, 0x48, 0x6c, 0x49, 0x0c, 0x55, 0xff, 0x75, 0xb4, 0xec, 0x38 },
+	{ 0x8d, 0x28, 0x84, 0x13, 0xdd, 0xbf, 0x27, 0x0f, 0x55, 0x26, 0x10, 0x78, 0xd8, 0x2a, 0xcf, 0x46 },
+	{ 0xbf, 0x11, 0x82, 0x2c, 0x67, 0x5c, 0xb7, 0xfa, 0xd7, 0xf0, 0xc0, 0x9e, 0x87, 0x1f, 0x7c, 0xfc },
+	{ 0x1c, 0xf1, 0x6f, 0x8f, 0x1c, 0xdb, 0x99, 0xd1, 0x7c, 0x5a, 0x30, 0x57, 0xcd, 0x4a, 0xb0, 0xf4 },
+	{ 0xd4, 0x39, 0xdc, 0x81, 0x23, 0xf0, 0x07, 0x3b, 0xf4, 0x59, 0xb9, 0x3a, 0xdb, 0xce, 0xef, 0x09 },
+	{ 0xa0, 0xac, 0x47, 0x7e, 0x2e, 0xaa, 0xe2, 0x35, 0xa0, 0xdd, 0x55, 0xc7, 0xc8, 0xb4, 0xa7, 0x34 },
+	{ 0x0a, 0x13, 0xe8, 0xc3, 0x7d, 0xab, 0x90, 0x15, 0x1a, 0x70, 0xb8, 0x61, 0xcc, 0x98, 0x77, 0x2e },
+	{ 0xbb, 0x4f, 0x9b, 0x1a, 0x9e, 0xfe, 0xfc, 0xe0, 0x33, 0x83, 0xcf, 0x5d, 0x2b, 0x9d, 0x13, 0xd2 },
+	{ 0x03, 0xc8, 0xba, 0x48, 0x19, 0xbd, 0x21, 0xd1, 0xbb, 0x2c, 0xaf, 0x33, 0x2f, 0x65, 0xf6, 0xea },
+	{ 0x80, 0x5e, 0x2e, 0xcf, 0xbc, 0xc2, 0xa3, 0xf9, 0x80, 0x02, 0xe3, 0x69, 0xe5, 0x8d, 0xcc, 0xba },
+	{ 0xea, 0x85, 0x5a, 0x35, 0x8e, 0x97, 0xe4, 0x32, 0xfa, 0x3d, 0xae, 0xbd, 0xfa, 0xbd, 0xbe, 0xe2 },
+	{ 0xd5, 0xf4, 0x93, 0x6b, 0x55, 0x64, 0x33, 0xdd, 0xdd, 0x43, 0x64, 0x01, 0x1a, 0x38, 0x84, 0x77 },
+	{ 0xf4, 0x05, 0xde, 0xef, 0x90, 0x30, 0x21, 0xc4, 0x14, 0xe3, 0x5a, 0x25, 0x9b, 0x5d, 0x86, 0x27 },
+	{ 0xfe, 0x85, 0x61, 0xaa, 0x93, 0xc9, 0x5d, 0x55, 0x2e, 0x88, 0x07, 0x8d, 0x3b, 0xfd, 0x4d, 0x6c },
+	{ 0x32, 0x95, 0x0d, 0xef, 0x8c, 0xb6, 0xa8, 0x0d, 0x82, 0x56, 0x3c, 0x73, 0x71, 0xaf, 0xda, 0x9d },
+	{ 0xdc, 0xc1, 0xd8, 0x27, 0xbe, 0xf9, 0xc7, 0xd4, 0x3c, 0xd9, 0x3e, 0xa2, 0xda, 0x03, 0x4a, 0x17 },
+	{ 0xd0, 0xe0, 0x61, 0xe4, 0xd6, 0x31, 0xae, 0x36, 0x50, 0x7d, 0x19, 0x1a, 0x0c, 0x23, 0x4e, 0x3d },
+	{ 0x98, 0x4e, 0x43, 0x6d, 0x92, 0x13, 0x16, 0x0b, 0x58, 0x98, 0x8a, 0x39, 0x68, 0xa2, 0x36, 0xb3 },
+	{ 0x5d, 0x5d, 0xd6, 0x21, 0xb1, 0xd7, 0xbc, 0x23, 0xa5, 0x17, 0x9e, 0x45, 0x22, 0x93, 0xef, 0x9b },
+	{ 0xd7, 0xad, 0xa6, 0xa0, 0x3f, 0xc7, 0x42, 0x2e, 0xaf, 0x12, 0xf4, 0xba, 0xcc, 0xee, 0x13, 0xdd },
+	{ 0x27, 0x99, 0x46, 0x2a, 0xd6, 0xd5, 0xad, 0x80, 0x7f, 0x1e, 0x7c, 0x8b, 0x80, 0x5a, 0x5c, 0xbd },
+	{ 0x0a, 0xe9, 0xef, 0x2e, 0x7f, 0x38, 0x9d, 0xa6, 0x1a, 0x36, 0xfe, 0x87, 0x2d, 0x76, 0x8e, 0xa2 },
+	{ 0x0d, 0x9c, 0x2e, 0x2d, 0x19, 0x3c, 0x45, 0x40, 0xd5, 0x45, 0xd0, 0x4e, 0x0d, 0x4a, 0x90, 0x47 },
+	{ 0xa3, 0x74, 0x02, 0xc7, 0x47, 0x67, 0x04, 0x07, 0x5b, 0x0a, 0x05, 0xfb, 0xf7, 0x19, 0x9e, 0x1f },
+	{ 0x0e, 0x42, 0x6a, 0xcc, 0xcb, 0xf6, 0xf6, 0xaa, 0xbe, 0x12, 0x9e, 0xa8, 0xfc, 0x21, 0x30, 0x6f },
+	{ 0x60, 0xfb, 0x98, 0xd5, 0xcb, 0x21, 0xeb, 0x85, 0x60, 0x0a, 0x93, 0x9f, 0xb2, 0xd5, 0xfc, 0xfa },
+	{ 0xc6, 0x9f, 0x52, 0x09, 0x52, 0xc5, 0xde, 0x4b, 0x36, 0x2f, 0x04, 0xf9, 0x59, 0x37, 0x64, 0xca },
+	{ 0x7f, 0xb8, 0xf2, 0x2f, 0x0a, 0x08, 0xf2, 0x8e, 0x97, 0x35, 0x15, 0x10, 0xf6, 0xb5, 0x2c, 0x93 },
+	{ 0x91, 0x81, 0xfe, 0xb0, 0x29, 0x7e, 0x81, 0x13, 0xf9, 0x02, 0xb0, 0x98, 0xa7, 0xd6, 0x70, 0x13 },
+	{ 0x6a, 0x12, 0xb0, 0x1b, 0x52, 0x1b, 0xc7, 0x01, 0x7a, 0x1e, 0xee, 0xe6, 0xc5, 0x9e, 0xfd, 0xe1 },
+	{ 0x97, 0xd2, 0xff, 0x62, 0xde, 0xcb, 0x57, 0x0f, 0x6f, 0x05, 0x77, 0xb9, 0x17, 0xed, 0x7f, 0x17 },
+	{ 0xcc, 0xdb, 0xd7, 0x70, 0x87, 0x59, 0x3b, 0x10, 0xac, 0x14, 0xee, 0xac, 0x7a, 0xbc, 0x7e, 0x88 },
+	{ 0xcb, 0x0b, 0xa4, 0x3c, 0xd6, 0x2b, 0x96, 0x36, 0xc3, 0x0d, 0x66, 0x79, 0xec, 0xc1, 0xf5, 0xd4 },
+	{ 0x40, 0x98, 0x03, 0xdc, 0xda, 0x80, 0x32, 0x12, 0x40, 0x12, 0x43, 0xd5, 0x7f, 0x1d, 0x2d, 0x3b },
+	{ 0x7e, 0x51, 0x2b, 0x70, 0xd5, 0x79, 0xad, 0xca, 0xae, 0xbf, 0xde, 0xfc, 0xf4, 0x91, 0x6a, 0x3d },
+	{ 0x18, 0x83, 0x79, 0xa7, 0x50, 0x63, 0xc6, 0x95, 0xd8, 0x60, 0xb3, 0xc9, 0xae, 0x0d, 0x1a, 0xe2 },
+	{ 0xdd, 0x7c, 0x90, 0x11, 0xf0, 0x6d, 0xf3, 0x76, 0x25, 0xc3, 0xe9, 0x68, 0x19, 0x6d, 0xde, 0x84 },
+	{ 0x36, 0x9a, 0x97, 0x62, 0xdc, 0x8e, 0x1b, 0x34, 0x26, 0xbf, 0x67, 0xe0, 0x02, 0x16, 0xaa, 0x52 },
+	{ 0x49, 0xf4, 0x62, 0x38, 0x2f, 0x06, 0xe3, 0xeb, 0x71, 0x3c, 0xf3, 0x55, 0x54, 0x7d, 0x99, 0xb4 },
+	{ 0x64, 0x00, 0x23, 0x49, 0x1b, 0xfa, 0x5d, 0xac, 0x04, 0x73, 0xbe, 0x0c, 0x44, 0x3c, 0xcc, 0xaf },
+	{ 0x1c, 0x9d, 0x7f, 0x65, 0x1f, 0xf5, 0xb2, 0xf3, 0x7c, 0xe6, 0xbb, 0xa3, 0x8f, 0x05, 0xde, 0xdc },
+	{ 0x7c, 0xdb, 0xbb, 0x9c, 0x71, 0x91, 0x56, 0x86, 0xdc, 0xeb, 0x88, 0x6f, 0x77, 0xbf, 0x41, 0x62 },
+	{ 0xb4, 0x97, 0xd2, 0xa8, 0xb4, 0x22, 0xe2, 0x20, 0xd4, 0x0a, 0xd2, 0x29, 0xba, 0x62, 0x42, 0x78 },
+	{ 0x03, 0x1c, 0xab, 0x72, 0x16, 0xa3, 0x08, 0xaf, 0xbb, 0xa0, 0x23, 0xe7, 0x6c, 0xaa, 0xc8, 0x02 },
+	{ 0x28, 0x2a, 0x06, 0x7f, 0x09, 0xd7, 0xe5, 0xb3, 0x68, 0xce, 0x6c, 0x78, 0x20, 0xa1, 0x07, 0x9f },
+	{ 0x9f, 0x1b, 0x88, 0x29, 0xfb, 0xa8, 0xaa, 0x02, 0xb7, 0x2d, 0x65, 0xda, 0x28, 0x6e, 0xfc, 0x52 },
+	{ 0xfe, 0x07, 0x79, 0xeb, 0x97, 0x70, 0x83, 0x08, 0x2e, 0xda, 0xd8, 0xff, 0x5e, 0x95, 0x92, 0xc8 },
+	{ 0xe0, 0x1a, 0x53, 0xc5, 0x0a, 0xb8, 0x21, 0xd9, 0xe0, 0xb5, 0xde, 0xc2, 0xa9, 0xaf, 0xeb, 0xe3 },
+	{ 0xb5, 0x67, 0x06, 0xdd, 0x65, 0x50, 0x87, 0xfa, 0xbd, 0x11, 0x5a, 0x5d, 0x48, 0x5d, 0xcb, 0x2b },
+	{ 0x2b, 0x1c, 0xb9, 0x5c, 0x21, 0x07, 0xfb, 0xf3, 0x23, 0x35, 0xd6, 0x85, 0xee, 0x28, 0xe7, 0x15 },
+	{ 0xad, 0xf4, 0x85, 0x81, 0x4a, 0x00, 0x41, 0x98, 0x75, 0xaf, 0xb1, 0x62, 0x98, 0xb9, 0x65, 0x64 },
+	{ 0x8b, 0x99, 0x69, 0x73, 0xf1, 0xcf, 0x0b, 0x2d, 0x83, 0x91, 0x3a, 0x98, 0xc4, 0x96, 0x28, 0x6d },
+	{ 0xb8, 0x05, 0xc9, 0x90, 0x80, 0x9a, 0xb5, 0x5c, 0x78, 0x04, 0x4f, 0xb7, 0xd8, 0x9f, 0xd8, 0x8a },
+	{ 0x96, 0x41, 0x40, 0x0e, 0xab, 0xca, 0x1f, 0xdc, 0x86, 0x55, 0x86, 0xcc, 0x77, 0xa6, 0xd4, 0x35 },
+	{ 0xd4, 0x0f, 0xe4, 0xec, 0x24, 0x7d, 0x14, 0xcc, 0xf4, 0x1f, 0xff, 0x60, 0x3c, 0xac, 0x06, 0x7e },
+	{ 0x70, 0x4e, 0x35, 0x83, 0x87, 0xaf, 0x23, 0xc6, 0xf0, 0x03, 0xd8, 0x9a, 0xe6, 0x23, 0x18, 0xa0 },
+	{ 0x84, 0x39, 0xc0, 0xad, 0x0d, 0x28, 0x23, 0xb1, 0x24, 0x31, 0x54, 0xfd, 0xd7, 0xd1, 0xb2, 0xe3 },
+	{ 0x33, 0x50, 0xc5, 0xd8, 0xbe, 0x2a, 0xd4, 0xaf, 0x6b, 0x40, 0xe7, 0x39, 0xb0, 0x18, 0x6f, 0x0b },
+	{ 0x4a, 0xc4, 0x96, 0x6c, 0xe0, 0x33, 0x88, 0xc5, 0x5a, 0x43, 0x7b, 0x89, 0xe2, 0x77, 0x22, 0x68 },
+	{ 0x0b, 0x26, 0xbf, 0x59, 0xb5, 0x53, 0xee, 0xfb, 0x03, 0x72, 0x7a, 0xc1, 0x8f, 0x77, 0x67, 0x6c },
+	{ 0x8c, 0xeb, 0xb4, 0xe8, 0xa6, 0xa4, 0xd6, 0xb9, 0x6c, 0xea, 0x93, 0x3e, 0x76, 0x29, 0xf6, 0x7c },
+	{ 0x26, 0xf3, 0x0a, 0x8b, 0x23, 0x1b, 0xfc, 0x15, 0x96, 0x51, 0xae, 0x31, 0x91, 0x82, 0xbc, 0x95 },
+	{ 0xc0, 0x8d, 0xc5, 0x36, 0x1b, 0xa4, 0x75, 0xf6, 0xc0, 0x83, 0xd4, 0x1e, 0xd8, 0xd4, 0x32, 0x98 },
+	{ 0xa1, 0x91, 0xf7, 0xfc, 0x5e, 0x91, 0x01, 0x47, 0x89, 0x01, 0xbb, 0x67, 0xa6, 0x40, 0x25, 0x2e },
+	{ 0x76, 0xb4, 0xb2, 0x7f, 0xbb, 0xb6, 0x73, 0xf9, 0x66, 0x23, 0x7c, 0x28, 0xa6, 0xcb, 0x1b, 0xea },
+	{ 0x17, 0xc8, 0xc1, 0xbd, 0x1e, 0xef, 0x9a, 0xf3, 0xef, 0x76, 0x08, 0x03, 0x70, 0xa4, 0x85, 0x74 },
+	{ 0x20, 0xb7, 0x85, 0x23, 0xee, 0x86, 0x9f, 0x51, 0x20, 0x6c, 0xc4, 0x7d, 0x70, 0xfd, 0xa1, 0xd7 },
+	{ 0xc4, 0x53, 0xdb, 0xca, 0xec, 0x4f, 0x7b, 0x76, 0x64, 0x95, 0x68, 0x45, 0x7b, 0x87, 0x24, 0x7b },
+	{ 0xd9, 0xba, 0xa9, 0xff, 0x26, 0x10, 0x39, 0x5d, 0x81, 0x55, 0xf8, 0x27, 0xbd, 0xea, 0x75, 0x5a },
+	{ 0xa2, 0x0d, 0x3b, 0x07, 0x13, 0xd9, 0xbf, 0x42, 0x72, 0x94, 0xce, 0xe7, 0xf6, 0xf5, 0xdb, 0xc9 },
+	{ 0x34, 0x0b, 0x7d, 0xc2, 0xf0, 0x9e, 0xff, 0x51, 0x54, 0x2a, 0x92, 0x00, 0xef, 0x81, 0x03, 0x79 },
+	{ 0xf8, 0xb6, 0x77, 0x39, 0xe3, 0x22, 0xad, 0x0c, 0xb8, 0xd7, 0x11, 0xdf, 0xee, 0x7e, 0x83, 0xc4 },
+	{ 0xa0, 0x97, 0xcb, 0x33, 0xaf, 0xf0, 0x68, 0xfe, 0xa0, 0xc0, 0x78, 0x5a, 0x79, 0x23, 0xb3, 0xee },
+	{ 0xad, 0x1e, 0x7e, 0x16, 0x49, 0x73, 0x34, 0x07, 0x75, 0xe9, 0x6b, 0x3c, 0x37, 0xdc, 0x4e, 0xf0 },
+	{ 0xb8, 0xb1, 0xd8, 0x66, 0x83, 0xb4, 0xce, 0x7e, 0x78, 0x90, 0xda, 0x03, 0x9b, 0x5a, 0x06, 0x73 },
+	{ 0x41, 0xc0, 0x56, 0xbc, 0x91, 0xe2, 0x09, 0x30, 0x29, 0x31, 0xe2, 0xa1, 0x92, 0x8d, 0x11, 0xbf },
+	{ 0x38, 0x25, 0x83, 0x80, 0xbf, 0x30, 0xec, 0xaf, 0xf8, 0xaf, 0x9a, 0xda, 0xcf, 0x79, 0xc7, 0x73 },
+	{ 0xe1, 0x6c, 0x9e, 0x3a, 0xc0, 0x8c, 0xec, 0x65, 0xc9, 0x0e, 0x38, 0x69, 0x5b, 0x42, 0xb9, 0xf3 },
+	{ 0xef, 0xc7, 0xb3, 0xd3, 0x13, 0x8b, 0xa8, 0xae, 0x87, 0xe2, 0x55, 0x64, 0xee, 0x25, 0x67, 0x61 },
+	{ 0x6e, 0x6b, 0x2a, 0xb9, 0x9e, 0xd9, 0x20, 0x06, 0x1e, 0xfb, 0x8d, 0x07, 0x95, 0x4a, 0x9f, 0xae },
+	{ 0x65, 0xbb, 0xda, 0x32, 0x4d, 0x6e, 0x89, 0x4e, 0xed, 0x5c, 0x69, 0xd3, 0x82, 0xa5, 0x60, 0x1d },
+	{ 0x1b, 0x36, 0xb8, 0xa5, 0xea, 0x66, 0x6e, 0x2f, 0x93, 0x70, 0x85, 0x90, 0x8e, 0xe1, 0x1b, 0x87 },
+	{ 0xf6, 0x12, 0xe1, 0x4e, 0x78, 0x79, 0x17, 0xf3, 0xe6, 0x25, 0x5f, 0x92, 0x8b, 0x59, 0xe8, 0xa4 },
+	{ 0x43, 0xcd, 0x59, 0x1b, 0x79, 0x2b, 0x00, 0x5f, 0xfb, 0x73, 0xe6, 0x0e, 0x83, 0x89, 0x73, 0x3c },
+	{ 0xb2, 0xc9, 0x43, 0x29, 0x4b, 0x06, 0x59, 0x98, 0x02, 0x1f, 0x65, 0x03, 0xb8, 0x1a, 0xbe, 0xcc },
+	{ 0xa4, 0xdb, 0xc9, 0x86, 0x7c, 0xf5, 0x48, 0xcb, 0x44, 0x80, 0x3b, 0x0e, 0xf9, 0x3d, 0x60, 0x75 },
+	{ 0xfb, 0xa8, 0x2a, 0x17, 0xfb, 0x52, 0xc2, 0x4c, 0x73, 0x3e, 0x7b, 0xec, 0xbc, 0x06, 0x63, 0x3b },
+	{ 0x85, 0x09, 0xf4, 0xe1, 0xbe, 0x55, 0xc8, 0x8a, 0x0d, 0x38, 0xdc, 0x30, 0x66, 0xcc, 0x3b, 0x97 },
+	{ 0x5a, 0x6b, 0x23, 0x44, 0x99, 0xa7, 0xa7, 0xe3, 0xea, 0xb0, 0x34, 0x38, 0x54, 0x0b, 0x10, 0x25 },
+	{ 0x1b, 0x4b, 0x34, 0xf0, 0x69, 0x20, 0xe8, 0x66, 0x93, 0x8d, 0x62, 0xfd, 0xdd, 0x72, 0x10, 0xcd },
+	{ 0x63, 0x5a, 0xe7, 0xa9, 0x68, 0x3f, 0xac, 0x41, 0x1b, 0xa6, 0xf0, 0xb2, 0x54, 0x64, 0x2c, 0x88 },
+	{ 0x02, 0x22, 0x7f, 0xa9, 0x66, 0x02, 0x70, 0x66, 0xd2, 0x5f, 0xe1, 0xd9, 0x3f, 0x8d, 0x56, 0xc3 },
+	{ 0xfd, 0xa0, 0xb1, 0x2b, 0x63, 0xe2, 0x3e, 0x44, 0x45, 0x64, 0xa2, 0xec, 0x5d, 0x71, 0xd0, 0x72 },
+	{ 0xc3, 0x2b, 0x88, 0xea, 0x35, 0xee, 0xa3, 0x58, 0x7b, 0x76, 0xc9, 0x78, 0x68, 0x17, 0x40, 0xf7 },
+	{ 0xdb, 0xf1, 0xa4, 0xf3, 0x0c, 0xcc, 0x22, 0xfb, 0x53, 0xd2, 0xb6, 0x6e, 0x4c, 0x09, 0xc1, 0x63 },
+	{ 0x99, 0xdf, 0x02, 0xc2, 0xc5, 0x14, 0x4e, 0x3e, 0x41, 0x48, 0x7b, 0x26, 0x08, 0xe9, 0xe1, 0x94 },
+	{ 0xcf, 0xa3, 0x92, 0xb9, 0xa0, 0x16, 0x5d, 0xe1, 0x67, 0x41, 0x9d, 0xe0, 0xa9, 0x21, 0x75, 0x73 },
+	{ 0x68, 0x1a, 0x29, 0x07, 0xea, 0x8b, 0x4a, 0x0a, 0xa8, 0xf8, 0xc6, 0xe6, 0x24, 0x34, 0x90, 0xaa },
+	{ 0x95, 0xc5, 0xfc, 0x03, 0xf7, 0x82, 0x61, 0xe0, 0x9d, 0xc2, 0x72, 0x4c, 0x27, 0xf1, 0x1d, 0x9a },
+	{ 0x78, 0x00, 0x2a, 0xbe, 0x20, 0x2c, 0xd7, 0xce, 0x38, 0xbd, 0x17, 0xdc, 0x84, 0x7b, 0x5b, 0x39 },
+	{ 0x36, 0xd9, 0x0b, 0x42, 0x5a, 0xbb, 0x88, 0xda, 0x26, 0x16, 0xff, 0x26, 0xf1, 0xc9, 0x87, 0x24 },
+	{ 0xcd, 0x57, 0x1b, 0x7b, 0x3b, 0xa1, 0xf9, 0x0b, 0x95, 0xa7, 0x01, 0x2d, 0xcb, 0x71, 0x35, 0x24 },
+	{ 0x27, 0xed, 0x36, 0x54, 0xd3, 0xbb, 0x94, 0x5e, 0x7f, 0x92, 0xf0, 0x3e, 0xbe, 0x9f, 0x2e, 0xd5 },
+	{ 0x5f, 0x16, 0xe9, 0x56, 0x9b, 0x3a, 0xcc, 0x74, 0x77, 0xe6, 0x2d, 0xff, 0xd4, 0x49, 0x7f, 0x01 },
+	{ 0x0a, 0xd4, 0x73, 0xe4, 0xff, 0x7e, 0x23, 0x6f, 0x1a, 0x19, 0x21, 0x1b, 0xde, 0xe4, 0x99, 0x5c },
+	{ 0x74, 0x7d, 0xb7, 0x8b, 0xd5, 0xfa, 0x89, 0x5b, 0x94, 0xa6, 0xbd, 0xe1, 0x16, 0xad, 0xd0, 0xe0 },
+	{ 0x08, 0xf1, 0x68, 0x1a, 0x17, 0xa9, 0x20, 0xaf, 0x48, 0x10, 0xd7, 0x87, 0x8c, 0x0b, 0x21, 0x6b },
+	{ 0x3e, 0x22, 0x94, 0x08, 0x77, 0x98, 0xdb, 0xcd, 0x6e, 0x3e, 0xed, 0x47, 0x02, 0x4b, 0x04, 0x60 },
+	{ 0xfc, 0xfa, 0x75, 0x8c, 0xb0, 0x27, 0x8d, 0xd9, 0x5c, 0x97, 0xd4, 0x92, 0x6e, 0x99, 0x30, 0x4b },
+	{ 0xca, 0xb9, 0x58, 0xc7, 0x20, 0x57, 0xcb, 0xa9, 0xda, 0xb4, 0x0c, 0xd3, 0x3a, 0x2f, 0x28, 0xc5 },
+	{ 0x05, 0xff, 0xb5, 0x3c, 0xff, 0x78, 0x0b, 0x6f, 0x8d, 0xa9, 0x6d, 0x7a, 0xbe, 0x83, 0x41, 0xf4 },
+	{ 0x0b, 0xa4, 0xa7, 0x18, 0xb1, 0xac, 0xc8, 0x48, 0x03, 0x20, 0xa9, 0x4e, 0x6c, 0xdf, 0x22, 0x10 },
+	{ 0xe3, 0x8e, 0x1d, 0xe4, 0x26, 0x8f, 0x5c, 0xcc, 0x9b, 0x6e, 0x19, 0x43, 0x9b, 0xcf, 0x0f, 0xb7 },
+	{ 0xcc, 0xb1, 0xdf, 0xdb, 0x88, 0xe6, 0x47, 0xa1, 0xac, 0xda, 0x33, 0xd3, 0xdb, 0x99, 0x95, 0xfc },
+	{ 0xa9, 0xef, 0xfb, 0x0d, 0xfb, 0x27, 0xce, 0x71, 0xd1, 0x46, 0x86, 0xf5, 0x06, 0x53, 0x96, 0xaf },
+	{ 0xdd, 0x67, 0x14, 0xc7, 0x70, 0xb4, 0x79, 0x3f, 0x25, 0xa6, 0x0c, 0xfc, 0xc9, 0xdb, 0xe9, 0x3e },
+	{ 0xad, 0xca, 0x8d, 0xec, 0x4b, 0x8d, 0x4d, 0x29, 0x75, 0x75, 0xf7, 0x88, 0xf9, 0x96, 0x7c, 0xd8 },
+	{ 0x6b, 0xa3, 0x6f, 0x70, 0x85, 0x1c, 0xff, 0x34, 0x63, 0xce, 0xde, 0xd3, 0x65, 0xe5, 0xa8, 0xc3 },
+	{ 0xff, 0x83, 0xbc, 0xf5, 0x4b, 0xb8, 0x41, 0x04, 0x17, 0x6d, 0xec, 0x7f, 0xaf, 0x4a, 0x49, 0x64 },
+	{ 0x0f, 0x7f, 0x39, 0xf7, 0x01, 0x12, 0x48, 0x00, 0xa7, 0x4e, 0x1a, 0xe2, 0x5e, 0x23, 0x09, 0x39 },
+	{ 0x6d, 0xb0, 0x72, 0xcf, 0x6c, 0x65, 0xf5, 0x63, 0x35, 0x11, 0xe3, 0x40, 0x56, 0xe1, 0x0a, 0x41 },
+	{ 0xdb, 0x06, 0x21, 0x3e, 0x8c, 0x85, 0x9c, 0x32, 0x53, 0xef, 0x93, 0xdb, 0x9b, 0x9a, 0xb5, 0xa9 },
+	{ 0x91, 0x96, 0x7a, 0xfb, 0xa8, 0x37, 0xfb, 0x4a, 0xf9, 0x1f, 0x8d, 0x05, 0xf7, 0x67, 0x65, 0x59 },
+	{ 0x4a, 0xd9, 0x12, 0xb7, 0x5f, 0xed, 0x01, 0xfd, 0x5a, 0x60, 0x58, 0xf6, 0x31, 0x09, 0x17, 0xae },
+	{ 0xfc, 0x0f, 0xf2, 0xd6, 0x2f, 0xe1, 0x06, 0x11, 0x5c, 0xb4, 0xb1, 0xff, 0xbd, 0x2a, 0x25, 0x91 },
+	{ 0x1e, 0xbf, 0xfe, 0x0e, 0x86, 0xf7, 0x22, 0x5a, 0x4e, 0x46, 0x9d, 0x7d, 0xcf, 0x92, 0x34, 0xa0 },
+	{ 0xd3, 0xbd, 0x98, 0x77, 0x6f, 0xa8, 0x49, 0x3f, 0x0b, 0xc7, 0xa5, 0xba, 0x8a, 0x19, 0x39, 0x6e },
+	{ 0xef, 0x06, 0x28, 0xb3, 0x91, 0xb7, 0x15, 0x55, 0x87, 0x39, 0xed, 0xaa, 0xdc, 0xd9, 0x44, 0x33 },
+	{ 0x97, 0xa8, 0x07, 0xce, 0xdf, 0x58, 0x64, 0xa0, 0x6f, 0xcb, 0xbc, 0xdf, 0x78, 0xca, 0x96, 0x8b },
+	{ 0x8d, 0x52, 0x7c, 0xa8, 0xdb, 0x32, 0x1b, 0x7e, 0x55, 0x60, 0xca, 0x51, 0x77, 0x4d, 0xb8, 0xd2 },
+	{ 0xac, 0xa2, 0x3a, 0x0c, 0x95, 0x2b, 0x76, 0x0b, 0x8c, 0x56, 0x58, 0xbc, 0xe6, 0x26, 0x98, 0x54 },
+	{ 0x67, 0x9e, 0xe5, 0xfc, 0x35, 0x44, 0x8c, 0x0e, 0xbf, 0x65, 0xb3, 0x66, 0xd4, 0x7e, 0xd9, 0x0e },
+	{ 0x5a, 0xd4, 0x8f, 0xb8, 0x15, 0x47, 0x08, 0xf9, 0xea, 0x41, 0x86, 0x58, 0xe1, 0xe1, 0xd6, 0x82 },
+	{ 0xa0, 0xeb, 0xbb, 0x5d, 0xac, 0xd6, 0x4f, 0xdc, 0xa0, 0x34, 0xed, 0x0d, 0xb7, 0x68, 0x85, 0x06 },
+	{ 0x20, 0xe1, 0x7d, 0xb8, 0xec, 0xf9, 0x92, 0xc0, 0x20, 0xa6, 0x7e, 0x57, 0x0f, 0x20, 0x8b, 0x63 },
+	{ 0x6c, 0x49, 0xab, 0x0f, 0x38, 0xd7, 0xb0, 0x9f, 0x4c, 0x9b, 0xac, 0x2d, 0x55, 0xbd, 0x48, 0xeb },
+	{ 0xa1, 0x3d, 0x07, 0xd3, 0x61, 0xab, 0x1a, 0x69, 0x89, 0x8d, 0x46, 0xb4, 0x68, 0xfb, 0x52, 0x16 },
+	{ 0x1e, 0xaa, 0x82, 0xc4, 0x06, 0x3e, 0xa9, 0x22, 0x4e, 0x29, 0xc0, 0x10, 0x80, 0x01, 0x40, 0x5a },
+	{ 0x2c, 0x2f, 0x90, 0xf2, 0x58, 0xaf, 0x58, 0xda, 0x0c, 0x37, 0x98, 0xe5, 0xb1, 0x07, 0xd7, 0x53 },
+	{ 0x9a, 0x46, 0xca, 0x81, 0xfa, 0xa2, 0x92, 0x02, 0x2a, 0xbe, 0xb1, 0x39, 0x09, 0x0d, 0xa4, 0xea },
+	{ 0xc8, 0x00, 0x46, 0x92, 0x36, 0xf4, 0xbb, 0x58, 0x08, 0xe6, 0x7c, 0x19, 0x88, 0x78, 0x98, 0x5f },
+	{ 0xf9, 0x32, 0xbb, 0x43, 0x97, 0x6a, 0x6b, 0x08, 0xa1, 0x6a, 0x25, 0x5f, 0x3f, 0x34, 0x3a, 0x60 },
+	{ 0xd4, 0x63, 0xd4, 0x16, 0x22, 0x63, 0xfb, 0xa9, 0xf4, 0x93, 0x73, 0x14, 0x7a, 0xf1, 0xd8, 0x95 },
+	{ 0xa1, 0x28, 0x8b, 0x88, 0xe2, 0xf1, 0xa0, 0x31, 0x89, 0x70, 0x69, 0x47, 0x19, 0x6a, 0x5e, 0xd0 },
+	{ 0x38, 0xbc, 0x16, 0x0c, 0x43, 0x91, 0x8b, 0x9a, 0xf8, 0x1e, 0x49, 0xba, 0x42, 0xa3, 0x00, 0x16 },
+	{ 0x72, 0xaf, 0x28, 0x0c, 0x6c, 0xde, 0x00, 0xd3, 0xc2, 0xba, 0x50, 0xbb, 0x14, 0x65, 0x4c, 0x35 },
+	{ 0xd3, 0x93, 0xa0, 0xe2, 0x70, 0x35, 0x56, 0xd0, 0x0b, 0x8d, 0xeb, 0xe0, 0xeb, 0xf6, 0x4f, 0xe2 },
+	{ 0xa4, 0xb1, 0xd1, 0xf1, 0x7d, 0x82, 0x55, 0x5c, 0x44, 0x46, 0x81, 0x34, 0x5a, 0x1b, 0x77, 0xe9 },
+	{ 0x76, 0x08, 0xa3, 0xa9, 0xb8, 0x9c, 0x5a, 0xd7, 0x66, 0x97, 0xf0, 0xdb, 0xe3, 0x10, 0xee, 0x01 },
+	{ 0x05, 0xd5, 0xbd, 0xa7, 0x00, 0x06, 0x18, 0x00, 0x8d, 0x6f, 0xb3, 0xa0, 0x1f, 0x61, 0x58, 0x68 },
+	{ 0x21, 0x87, 0xb9, 0x57, 0x9f, 0xb4, 0x44, 0x2b, 0x09, 0x73, 0x4c, 0xb1, 0xfe, 0xf7, 0x2a, 0x8b },
+	{ 0x23, 0xbe, 0xb4, 0x4b, 0x85, 0x70, 0x2e, 0xc9, 0xdb, 0xef, 0x0a, 0xf8, 0x8d, 0x16, 0x76, 0x94 },
+};
+
+uint16_t
+hash(const uint64_t h_lo, const uint64_t h_hi)
+{
+	uint16_t result;
+	static const uint16_t g[4001] = {
+	    0x020b, 0x0000, 0x05cc, 0x0000, 0x0074, 0x0350, 0x0000, 0x0000,
+	    0x061e, 0x05a0, 0x0000, 0x0230, 0x0000, 0x0000, 0x010c, 0x0655,
+	    0x0000, 0x0000, 0x0000, 0x01a5, 0x05aa, 0x059f, 0x046a, 0x0000,
+	    0x0000, 0x02b5, 0x01b9, 0x0736, 0x0000, 0x0566, 0x0000, 0x041d,
+	    0x078c, 0x0000, 0x00ac, 0x011c, 0x03f1, 0x0000, 0x036e, 0x0691,
+	    0x0628, 0x0000, 0x0000, 0x052c, 0x0406, 0x01d9, 0x06f8, 0x05a3,
+	    0x019c, 0x0688, 0x0000, 0x0000, 0x0395, 0x0000, 0x018d, 0x0173,
+	    0x0000, 0x07b3, 0x0000, 0x0000, 0x0000, 0x0000, 0x07b5, 0x0000,
+	    0x05f8, 0x0484, 0x0040, 0x064e, 0x05f0, 0x068b, 0x05a6, 0x0000,
+	    0x0000, 0x0000, 0x0581, 0x0487, 0x0000, 0x0000, 0x0000, 0x028d,
+	    0x0032, 0x0000, 0x0501, 0x074d, 0x05ec, 0x0000, 0x068c, 0x0000,
+	    0x0506, 0x0000, 0x04bd, 0x0000, 0x0000, 0x02f9, 0x0385, 0x0054,
+	    0x0000, 0x0000, 0x0000, 0x0491, 0x00ba, 0x0000, 0x0000, 0x003d,
+	    0x0216, 0x0000, 0x042e, 0x0449, 0x04a3, 0x04c2, 0x032a, 0x06a9,
+	    0x0326, 0x067d, 0x0209, 0x0624, 0x04b3, 0x0688, 0x06e7, 0x0601,
+	    0x0225, 0x0000, 0x0000, 0x01c0, 0x0123, 0x052a, 0x07c7, 0x0000,
+	    0x0000, 0x02c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0755,
+	    0x012c, 0x0000, 0x03ec, 0x0105, 0x051d, 0x0595, 0x0000, 0x0000,
+	    0x037c, 0x0147, 0x0000, 0x0000, 0x06b3, 0x0000, 0x0000, 0x0055,
+	    0x06f0, 0x0340, 0x068a, 0x0000, 0x0702, 0x0000, 0x0000, 0x0000,
+	    0x0549, 0x0000, 0x0568, 0x01d5, 0x06ad, 0x0000, 0x0000, 0x0594,
+	    0x0000, 0x0416, 0x0000, 0x0000, 0x073e, 0x0000, 0x0000, 0x001c,
+	    0x0000, 0x0000, 0x0000, 0x0549, 0x0000, 0x05f8, 0x0000, 0x0000,
+	    0x041e, 0x0000, 0x07b5, 0x057e, 0x05e4, 0x0654, 0x0000, 0x053f,
+	    0x0000, 0x0000, 0x0209, 0x0000, 0x0326, 0x0000, 0x03fb, 0x078c,
+	    0x0000, 0x03bd, 0x060b, 0x0000, 0x04dc, 0x02d3, 0x06d5, 0x0000,
+	    0x0492, 0x0690, 0x0000, 0x0000, 0x03c8, 0x0464, 0x02ba, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x03c4, 0x04b6, 0x0637, 0x0000, 0x0509,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0341, 0x0000, 0x0000,
+	    0x0642, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0115, 0x07b0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07ba, 0x06d1,
+	    0x0000, 0x0000, 0x004b, 0x0765, 0x0000, 0x0000, 0x047e, 0x0000,
+	    0x0000, 0x00f9, 0x0000, 0x03bf, 0x071d, 0x03ea, 0x02ad, 0x0000,
+	    0x0346, 0x051c, 0x0660, 0x0000, 0x0095, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x079e, 0x0000, 0x0000, 0x0757, 0x03b8, 0x053f, 0x034f,
+	    0x0258, 0x00da, 0x0000, 0x02d6, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x046b, 0x0000, 0x0000, 0x0743, 0x072c, 0x063f, 0x0000, 0x0576,
+	    0x0000, 0x02a0, 0x0000, 0x0000, 0x069d, 0x0293, 0x0000, 0x07cf,
+	    0x0060, 0x0000, 0x0096, 0x01ca, 0x0206, 0x06d5, 0x0000, 0x0000,
+	    0x011d, 0x0775, 0x017d, 0x06e1, 0x0000, 0x02a6, 0x0000, 0x06e0,
+	    0x007c, 0x0000, 0x0578, 0x004f, 0x02e4, 0x034c, 0x0735, 0x0224,
+	    0x0000, 0x06b7, 0x0000, 0x000a, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x02c5, 0x0000, 0x03d3, 0x033c, 0x0000, 0x0681, 0x0000, 0x0000,
+	    0x07a3, 0x0474, 0x0149, 0x0000, 0x0000, 0x0637, 0x02e0, 0x0000,
+	    0x0000, 0x02bd, 0x0000, 0x0215, 0x0000, 0x0000, 0x0000, 0x007d,
+	    0x0000, 0x0000, 0x0174, 0x0313, 0x01d3, 0x0767, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0368, 0x0000, 0x0000, 0x0729, 0x0083,
+	    0x01a9, 0x0082, 0x04c0, 0x0554, 0x065d, 0x0000, 0x0000, 0x0000,
+	    0x0637, 0x0070, 0x05fa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x038f, 0x0000, 0x06af, 0x0106, 0x0000, 0x02d5, 0x0216,
+	    0x0799, 0x06f4, 0x03fb, 0x0000, 0x00cd, 0x0450, 0x01ea, 0x0000,
+	    0x0000, 0x0255, 0x0639, 0x0000, 0x0000, 0x038d, 0x0789, 0x03ab,
+	    0x0311, 0x0000, 0x0481, 0x07b5, 0x01c0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x058b, 0x0000, 0x06c8, 0x0545, 0x0036, 0x0720, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fd, 0x014a, 0x0494,
+	    0x008e, 0x074a, 0x0505, 0x0035, 0x040e, 0x00b7, 0x01aa, 0x0000,
+	    0x05c9, 0x0000, 0x0000, 0x0000, 0x07b0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0042, 0x0000, 0x0000, 0x0431, 0x06db, 0x0085, 0x02a4,
+	    0x0000, 0x0006, 0x049d, 0x0618, 0x05bc, 0x0000, 0x0319, 0x0000,
+	    0x074a, 0x02e5, 0x0000, 0x0000, 0x054d, 0x0000, 0x03f7, 0x04ad,
+	    0x053d, 0x03b3, 0x04f1, 0x01ff, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x043a, 0x0000, 0x063c, 0x070b, 0x0000, 0x0000,
+	    0x07be, 0x0000, 0x0000, 0x0000, 0x02cc, 0x01e8, 0x053d, 0x04d1,
+	    0x0622, 0x0786, 0x05c3, 0x07c9, 0x06d8, 0x0000, 0x0000, 0x0000,
+	    0x0112, 0x0000, 0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0588,
+	    0x006b, 0x0000, 0x0000, 0x035d, 0x00af, 0x01ea, 0x07cc, 0x00e3,
+	    0x0000, 0x03fa, 0x06fb, 0x02f3, 0x0000, 0x0000, 0x03c9, 0x0000,
+	    0x0000, 0x04e1, 0x0727, 0x017e, 0x0000, 0x030a, 0x0000, 0x0000,
+	    0x0000, 0x05e5, 0x0000, 0x043e, 0x0000, 0x0000, 0x059b, 0x0155,
+	    0x0647, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0142,
+	    0x02a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0474, 0x01a3, 0x05b9, 0x060d, 0x06e2, 0x04e4, 0x0600, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0630, 0x0000, 0x0000, 0x06a5, 0x0251,
+	    0x0000, 0x005e, 0x0000, 0x02fa, 0x0768, 0x0000, 0x0428, 0x0461,
+	    0x0546, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x02e8, 0x06e1,
+	    0x0000, 0x0534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x007f, 0x0318, 0x0760, 0x045d, 0x0000, 0x0229, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0153, 0x0000,
+	    0x0000, 0x00b4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0023,
+	    0x0000, 0x05cb, 0x01e5, 0x0000, 0x0439, 0x0000, 0x0000, 0x03c9,
+	    0x0000, 0x0158, 0x054e, 0x01dd, 0x0000, 0x0157, 0x058b, 0x0298,
+	    0x0013, 0x0000, 0x0400, 0x0522, 0x0582, 0x0000, 0x00cf, 0x0000,
+	    0x0000, 0x06e6, 0x0000, 0x005c, 0x0215, 0x0000, 0x0000, 0x0000,
+	    0x00af, 0x04ba, 0x0000, 0x016f, 0x0528, 0x0000, 0x070a, 0x043e,
+	    0x0000, 0x07ae, 0x0000, 0x0583, 0x0000, 0x0000, 0x0120, 0x04a8,
+	    0x03b0, 0x00af, 0x0773, 0x0000, 0x0000, 0x0000, 0x06a8, 0x0000,
+	    0x0244, 0x0000, 0x0093, 0x06b5, 0x01b0, 0x0000, 0x0000, 0x029a,
+	    0x0000, 0x04b1, 0x0000, 0x050c, 0x0000, 0x0500, 0x0000, 0x05f6,
+	    0x07b4, 0x041e, 0x0597, 0x00bc, 0x067b, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x007d, 0x0000, 0x0000, 0x068f, 0x0000, 0x029f, 0x0000,
+	    0x06a0, 0x0000, 0x0000, 0x0790, 0x0351, 0x06ff, 0x0108, 0x020f,
+	    0x0000, 0x0413, 0x0000, 0x064e, 0x0000, 0x0000, 0x0623, 0x03ed,
+	    0x0000, 0x0773, 0x0000, 0x052b, 0x02d7, 0x029b, 0x0000, 0x0000,
+	    0x0000, 0x010f, 0x0000, 0x0000, 0x0000, 0x073d, 0x0000, 0x0183,
+	    0x0000, 0x0778, 0x0000, 0x02d2, 0x0000, 0x0000, 0x0000, 0x02f1,
+	    0x0000, 0x00fd, 0x0008, 0x00fd, 0x02a2, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0164, 0x0719, 0x0304, 0x00f3, 0x0000, 0x0000,
+	    0x0000, 0x0546, 0x0000, 0x0651, 0x06fc, 0x00d0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x044b, 0x0000, 0x0000, 0x0000,
+	    0x0186, 0x0000, 0x0000, 0x0006, 0x06d8, 0x00ee, 0x015d, 0x04a0,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0218, 0x0008, 0x02c3, 0x0000,
+	    0x0771, 0x01cf, 0x0344, 0x0349, 0x03c2, 0x0000, 0x0000, 0x0000,
+	    0x0330, 0x059d, 0x0000, 0x0000, 0x04c2, 0x0000, 0x0000, 0x0092,
+	    0x0000, 0x0000, 0x02cb, 0x0000, 0x0015, 0x0000, 0x02e6, 0x0000,
+	    0x0099, 0x0000, 0x0084, 0x02e6, 0x0509, 0x0413, 0x012c, 0x0000,
+	    0x04da, 0x0000, 0x0468, 0x0000, 0x0000, 0x0000, 0x0597, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x07b7, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x03de, 0x0000, 0x0000, 0x0290, 0x0579, 0x067d, 0x0000,
+	    0x0589, 0x0608, 0x0000, 0x01bf, 0x0000, 0x0000, 0x077a, 0x0000,
+	    0x0378, 0x0000, 0x0000, 0x0439, 0x024d, 0x0311, 0x01a5, 0x03e7,
+	    0x05bb, 0x05c9, 0x0000, 0x0414, 0x0000, 0x05c9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03ff, 0x06ba, 0x0000,
+	    0x0000, 0x0268, 0x01a6, 0x05e0, 0x03f0, 0x032d, 0x0000, 0x0518,
+	    0x0000, 0x01bb, 0x0000, 0x0000, 0x0000, 0x054e, 0x0342, 0x0363,
+	    0x0518, 0x0150, 0x04b3, 0x005d, 0x0000, 0x01d9, 0x0390, 0x0008,
+	    0x0000, 0x0439, 0x0000, 0x0550, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0233, 0x0389, 0x03ab, 0x032b, 0x0000,
+	    0x0000, 0x021f, 0x064f, 0x06c7, 0x0453, 0x0000, 0x0000, 0x077d,
+	    0x0000, 0x001a, 0x0255, 0x04a1, 0x05dd, 0x039e, 0x0000, 0x0000,
+	    0x0484, 0x073b, 0x0647, 0x0000, 0x0000, 0x06ea, 0x03ce, 0x033e,
+	    0x0000, 0x0579, 0x0000, 0x078d, 0x02d9, 0x0114, 0x0000, 0x0000,
+	    0x0000, 0x02fc, 0x014c, 0x0393, 0x0000, 0x0000, 0x0735, 0x0000,
+	    0x0444, 0x01d0, 0x0000, 0x0000, 0x0750, 0x0000, 0x00f6, 0x0286,
+	    0x06f0, 0x066a, 0x0701, 0x0771, 0x034d, 0x0000, 0x0000, 0x06fe,
+	    0x0628, 0x06c5, 0x03e2, 0x001f, 0x0000, 0x018e, 0x0000, 0x0000,
+	    0x03f8, 0x0000, 0x078e, 0x04a2, 0x0000, 0x0000, 0x0102, 0x071b,
+	    0x0000, 0x0000, 0x0013, 0x0000, 0x0015, 0x0000, 0x03b8, 0x0000,
+	    0x0394, 0x0000, 0x0000, 0x03e4, 0x0286, 0x0000, 0x0000, 0x078d,
+	    0x0282, 0x03d1, 0x0615, 0x00d1, 0x036f, 0x0000, 0x0000, 0x0664,
+	    0x0597, 0x06d5, 0x052e, 0x0090, 0x0000, 0x0767, 0x0000, 0x0000,
+	    0x062b, 0x0155, 0x0000, 0x03d9, 0x00bb, 0x0000, 0x039f, 0x061e,
+	    0x0000, 0x0000, 0x0000, 0x054d, 0x02c0, 0x0000, 0x0000, 0x006a,
+	    0x0000, 0x029d, 0x0000, 0x044c, 0x035f, 0x038e, 0x0000, 0x033d,
+	    0x0000, 0x0712, 0x015a, 0x0000, 0x02dc, 0x0197, 0x0000, 0x0296,
+	    0x05bf, 0x00f1, 0x0000, 0x0388, 0x0000, 0x069a, 0x0000, 0x0000,
+	    0x0065, 0x0000, 0x0000, 0x0000, 0x05c2, 0x06a9, 0x0000, 0x000b,
+	    0x0000, 0x06de, 0x003c, 0x0311, 0x0000, 0x02e3, 0x034f, 0x0000,
+	    0x02e1, 0x0493, 0x0000, 0x06a0, 0x0184, 0x0000, 0x0000, 0x0000,
+	    0x05c1, 0x0000, 0x04be, 0x0000, 0x0000, 0x0000, 0x06f8, 0x0000,
+	    0x0136, 0x06cb, 0x0000, 0x0000, 0x0000, 0x0403, 0x0000, 0x06a2,
+	    0x07b9, 0x079b, 0x0000, 0x030d, 0x0000, 0x0000, 0x0000, 0x0142,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06b0, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0025,
+	    0x0000, 0x0000, 0x0145, 0x0000, 0x0155, 0x027d, 0x0000, 0x05e3,
+	    0x031a, 0x00b6, 0x0000, 0x0000, 0x03ce, 0x075a, 0x0000, 0x009a,
+	    0x0000, 0x0476, 0x0000, 0x0000, 0x0000, 0x029e, 0x0000, 0x0000,
+	    0x01fa, 0x0000, 0x0750, 0x0000, 0x0000, 0x0179, 0x05f4, 0x0335,
+	    0x03e6, 0x073b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03e2,
+	    0x01e6, 0x0000, 0x0000, 0x0000, 0x027c, 0x06e9, 0x0000, 0x0000,
+	    0x043c, 0x0000, 0x0000, 0x023f, 0x01a0, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0301, 0x033b, 0x01df, 0x06f3, 0x0000, 0x071c,
+	    0x0000, 0x0000, 0x0100, 0x042b, 0x0608, 0x027f, 0x0000, 0x015a,
+	    0x0000, 0x060f, 0x0000, 0x0371, 0x069b, 0x0000, 0x062d, 0x068c,
+	    0x0000, 0x041b, 0x017d, 0x060d, 0x0487, 0x0000, 0x0267, 0x0000,
+	    0x01d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01da, 0x0370,
+	    0x032f, 0x03c1, 0x0000, 0x0000, 0x0000, 0x05a1, 0x0000, 0x0000,
+	    0x070f, 0x078a, 0x009d, 0x0000, 0x0195, 0x0489, 0x05bd, 0x0000,
+	    0x0000, 0x02a7, 0x0000, 0x0000, 0x00d1, 0x0000, 0x0000, 0x022e,
+	    0x0000, 0x0000, 0x0423, 0x0000, 0x01fa, 0x0000, 0x008a, 0x0000,
+	    0x0510, 0x0000, 0x03e5, 0x008a, 0x015a, 0x0000, 0x00a0, 0x0000,
+	    0x003f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02d3,
+	    0x0321, 0x0269, 0x05d3, 0x0000, 0x01b2, 0x0000, 0x0519, 0x0000,
+	    0x0000, 0x038b, 0x0000, 0x0000, 0x0000, 0x0000, 0x061c, 0x03cb,
+	    0x0761, 0x070d, 0x0526, 0x01ba, 0x0458, 0x0786, 0x0000, 0x0000,
+	    0x0313, 0x0000, 0x0143, 0x0000, 0x0000, 0x0528, 0x04cf, 0x0528,
+	    0x0000, 0x0000, 0x049c, 0x04be, 0x0000, 0x0450, 0x01f2, 0x0000,
+	    0x05e9, 0x0000, 0x03dc, 0x0450, 0x0766, 0x0158, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0404, 0x0000, 0x0000, 0x0000, 0x0248,
+	    0x0599, 0x0000, 0x0000, 0x0000, 0x037c, 0x0000, 0x0740, 0x0000,
+	    0x0719, 0x0000, 0x04ab, 0x03ca, 0x028a, 0x0464, 0x0000, 0x0000,
+	    0x0116, 0x0000, 0x06a4, 0x01a2, 0x01e0, 0x06b4, 0x0000, 0x070e,
+	    0x0000, 0x0114, 0x01d9, 0x0000, 0x0000, 0x0178, 0x0710, 0x0045,
+	    0x02bf, 0x0429, 0x02b3, 0x0000, 0x0000, 0x0565, 0x0000, 0x0707,
+	    0x0000, 0x02bd, 0x0000, 0x01bb, 0x020f, 0x0000, 0x0000, 0x009d,
+	    0x07ae, 0x0168, 0x07ba, 0x030f, 0x0000, 0x0000, 0x0498, 0x0000,
+	    0x0000, 0x005c, 0x0000, 0x0508, 0x035b, 0x0710, 0x03ac, 0x0146,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x044f, 0x0000, 0x0000, 0x0000,
+	    0x0341, 0x0000, 0x0000, 0x0000, 0x02e5, 0x04dd, 0x0466, 0x0000,
+	    0x0077, 0x0169, 0x06aa, 0x0094, 0x07c4, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x01f8, 0x066a, 0x0067, 0x0559, 0x0180,
+	    0x0505, 0x026a, 0x0000, 0x0000, 0x0000, 0x06f4, 0x04ae, 0x078e,
+	    0x0000, 0x0101, 0x06a3, 0x01d0, 0x00b7, 0x0000, 0x0000, 0x027b,
+	    0x00a6, 0x03b4, 0x0000, 0x021a, 0x0776, 0x0000, 0x0000, 0x065c,
+	    0x0000, 0x04b6, 0x0552, 0x07a8, 0x0000, 0x0000, 0x0360, 0x0000,
+	    0x0000, 0x0317, 0x0000, 0x05f2, 0x0000, 0x0000, 0x0416, 0x00d6,
+	    0x02e2, 0x00cf, 0x0000, 0x0000, 0x0514, 0x0000, 0x0000, 0x0000,
+	    0x04a2, 0x0000, 0x0000, 0x05c7, 0x000a, 0x079b, 0x011e, 0x002c,
+	    0x0000, 0x0000, 0x00cb, 0x0400, 0x00ce, 0x0256, 0x0000, 0x0000,
+	    0x038a, 0x0000, 0x0652, 0x0165, 0x06f8, 0x06e9, 0x0000, 0x027c,
+	    0x0000, 0x0000, 0x00b2, 0x0000, 0x0000, 0x0488, 0x0739, 0x0040,
+	    0x04a3, 0x0000, 0x0000, 0x00bd, 0x01c9, 0x0000, 0x0269, 0x0000,
+	    0x05a7, 0x041c, 0x0387, 0x0000, 0x0000, 0x01ff, 0x02b7, 0x0000,
+	    0x0000, 0x05a9, 0x0000, 0x0000, 0x0623, 0x0380, 0x0000, 0x0217,
+	    0x01c5, 0x014f, 0x0000, 0x0000, 0x0000, 0x0000, 0x011a, 0x0000,
+	    0x0000, 0x06f8, 0x04b7, 0x02aa, 0x0545, 0x074d, 0x062e, 0x0000,
+	    0x049e, 0x0000, 0x0000, 0x079d, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0636, 0x0404, 0x078e, 0x06df, 0x0000, 0x0117, 0x0000,
+	    0x02ea, 0x05f2, 0x04e6, 0x0000, 0x075f, 0x0381, 0x0000, 0x0000,
+	    0x03fb, 0x0000, 0x06a3, 0x0540, 0x07a0, 0x0000, 0x0000, 0x057d,
+	    0x0760, 0x0000, 0x0000, 0x04f2, 0x0485, 0x04b4, 0x06b1, 0x03a3,
+	    0x0000, 0x0000, 0x0000, 0x02ae, 0x0000, 0x0000, 0x0279, 0x06e4,
+	    0x0000, 0x0000, 0x043c, 0x0000, 0x0000, 0x0691, 0x0000, 0x0000,
+	    0x02c3, 0x00f1, 0x04d9, 0x07bb, 0x0000, 0x0000, 0x043b, 0x043a,
+	    0x0350, 0x00ff, 0x03a5, 0x040d, 0x0000, 0x0217, 0x076e, 0x0000,
+	    0x065d, 0x0000, 0x0485, 0x0167, 0x0000, 0x0107, 0x00c5, 0x0247,
+	    0x0000, 0x0000, 0x0497, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04af, 0x0000, 0x051f, 0x02a8, 0x00a4, 0x04a2,
+	    0x042f, 0x0000, 0x0000, 0x0000, 0x047d, 0x0000, 0x0000, 0x00ec,
+	    0x00e1, 0x00d2, 0x0000, 0x026b, 0x0000, 0x0000, 0x0000, 0x051f,
+	    0x0000, 0x01d4, 0x0000, 0x0000, 0x079f, 0x03df, 0x0000, 0x07a7,
+	    0x0430, 0x0000, 0x0000, 0x0349, 0x01f6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x07ca, 0x0000, 0x0000, 0x0000,
+	    0x01c3, 0x0000, 0x0506, 0x0175, 0x059d, 0x0000, 0x03c8, 0x0000,
+	    0x0000, 0x06f8, 0x0500, 0x02d0, 0x0000, 0x00c4, 0x0000, 0x0354,
+	    0x05a5, 0x0000, 0x001e, 0x0293, 0x060a, 0x0134, 0x00f5, 0x0000,
+	    0x06d6, 0x0659, 0x0000, 0x0000, 0x035f, 0x0000, 0x0000, 0x0515,
+	    0x0000, 0x0000, 0x010c, 0x0000, 0x045e, 0x04d2, 0x0000, 0x0000,
+	    0x0000, 0x0144, 0x0000, 0x0000, 0x0099, 0x0000, 0x0000, 0x0000,
+	    0x063a, 0x07cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x03a0, 0x03e7, 0x066b, 0x055a, 0x0000, 0x05c8, 0x0029, 0x0000,
+	    0x0000, 0x04fb, 0x0000, 0x060b, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0403, 0x0000, 0x0000, 0x0000, 0x0000, 0x0761, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x07c6, 0x0723, 0x0000, 0x0000, 0x0284,
+	    0x0178, 0x0000, 0x06b1, 0x0000, 0x0000, 0x0000, 0x0032, 0x0000,
+	    0x0000, 0x0000, 0x06e1, 0x0168, 0x0453, 0x0000, 0x078e, 0x0000,
+	    0x0000, 0x0000, 0x0510, 0x0000, 0x05a0, 0x0000, 0x0068, 0x0530,
+	    0x0000, 0x04ef, 0x0000, 0x0000, 0x0000, 0x0000, 0x030a, 0x0000,
+	    0x0641, 0x06cf, 0x0000, 0x04f5, 0x0000, 0x0000, 0x0245, 0x033f,
+	    0x0590, 0x0000, 0x0000, 0x0000, 0x0255, 0x0025, 0x042b, 0x0000,
+	    0x0000, 0x06a0, 0x0000, 0x0657, 0x0738, 0x07a8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x034d, 0x0594, 0x0095, 0x0000, 0x0000, 0x0049,
+	    0x0000, 0x0081, 0x0000, 0x0218, 0x01e6, 0x01aa, 0x0000, 0x0000,
+	    0x0000, 0x0693, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01e7, 0x0000, 0x0000, 0x0425, 0x0609, 0x0000, 0x0000, 0x0000,
+	    0x02ca, 0x0000, 0x0000, 0x0000, 0x005f, 0x0000, 0x0462, 0x003f,
+	    0x0000, 0x050c, 0x004b, 0x042e, 0x0000, 0x0683, 0x04de, 0x0026,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x045f,
+	    0x06ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x06ba, 0x0000, 0x034e,
+	    0x0000, 0x011a, 0x043b, 0x0568, 0x075c, 0x0700, 0x03f1, 0x0000,
+	    0x0000, 0x019d, 0x00c9, 0x01d7, 0x0000, 0x04d4, 0x0000, 0x047a,
+	    0x07a5, 0x0000, 0x0000, 0x0098, 0x05d5, 0x00d3, 0x0000, 0x0645,
+	    0x0000, 0x0000, 0x0000, 0x04b3, 0x051a, 0x01ce, 0x0756, 0x0000,
+	    0x065d, 0x0000, 0x0665, 0x0000, 0x049f, 0x0000, 0x0436, 0x0567,
+	    0x0000, 0x0020, 0x00be, 0x01c8, 0x0000, 0x0126, 0x01d5, 0x060a,
+	    0x00c1, 0x0000, 0x00f5, 0x01f0, 0x0000, 0x064e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x04bf,
+	    0x0025, 0x0000, 0x0128, 0x0000, 0x0000, 0x0413, 0x0215, 0x047e,
+	    0x0319, 0x007c, 0x01c8, 0x0000, 0x0450, 0x0000, 0x0000, 0x079d,
+	    0x0000, 0x0000, 0x0000, 0x05e6, 0x0042, 0x0000, 0x019c, 0x00d4,
+	    0x0199, 0x013a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01cd,
+	    0x0000, 0x0346, 0x0000, 0x0241, 0x0398, 0x0000, 0x0222, 0x0438,
+	    0x061b, 0x062f, 0x0000, 0x0000, 0x0000, 0x0280, 0x02af, 0x0000,
+	    0x0273, 0x0312, 0x035e, 0x0000, 0x019b, 0x007d, 0x0000, 0x0000,
+	    0x0000, 0x05d7, 0x01b6, 0x0000, 0x07ca, 0x01a3, 0x0000, 0x0000,
+	    0x051f, 0x0000, 0x0000, 0x0000, 0x048e, 0x000f, 0x0649, 0x0127,
+	    0x00f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0135,
+	    0x06cc, 0x04c1, 0x0000, 0x0000, 0x0000, 0x0111, 0x0557, 0x0000,
+	    0x0000, 0x0750, 0x0000, 0x0000, 0x03b7, 0x0354, 0x0000, 0x0000,
+	    0x034a, 0x062d, 0x05d9, 0x0234, 0x0000, 0x0000, 0x0000, 0x0077,
+	    0x0565, 0x0367, 0x0000, 0x0000, 0x02fe, 0x0000, 0x02ef, 0x0706,
+	    0x04b7, 0x0000, 0x0000, 0x0367, 0x0000, 0x0000, 0x0412, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x051a, 0x0000, 0x0000, 0x0000, 0x04c3,
+	    0x0000, 0x077f, 0x0364, 0x0000, 0x0270, 0x0000, 0x0612, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x03fd, 0x0016, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0599, 0x049a, 0x0000, 0x057e, 0x0000, 0x0000, 0x0000,
+	    0x04b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x025b,
+	    0x0000, 0x0000, 0x07c1, 0x0000, 0x0000, 0x0103, 0x0000, 0x0000,
+	    0x0000, 0x0001, 0x0000, 0x00b6, 0x0000, 0x04fb, 0x0000, 0x04f9,
+	    0x00ba, 0x0000, 0x0096, 0x0000, 0x0384, 0x0000, 0x0710, 0x06d2,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x02e9, 0x03d7, 0x0554, 0x0000,
+	    0x0072, 0x0000, 0x0532, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0178, 0x0000, 0x05ba, 0x0000, 0x0000, 0x0000, 0x05b8, 0x0492,
+	    0x0000, 0x0000, 0x04f4, 0x002d, 0x008d, 0x0219, 0x01b8, 0x070c,
+	    0x0775, 0x034c, 0x07bc, 0x0695, 0x0700, 0x0199, 0x0000, 0x0000,
+	    0x0500, 0x0000, 0x06cf, 0x0000, 0x00cf, 0x0000, 0x0000, 0x0000,
+	    0x06ab, 0x06d6, 0x05e1, 0x0000, 0x0685, 0x0000, 0x0705, 0x0000,
+	    0x0000, 0x0000, 0x0365, 0x03c8, 0x01a6, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0761, 0x0792, 0x0387, 0x02a4, 0x0000,
+	    0x0000, 0x01cf, 0x02cf, 0x0000, 0x032b, 0x02a8, 0x049d, 0x0000,
+	    0x0000, 0x056e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0356, 0x012f, 0x0000, 0x03c5, 0x0066, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0782, 0x0533, 0x07c8, 0x002e, 0x0373, 0x0000,
+	    0x07a5, 0x0000, 0x0000, 0x0171, 0x0000, 0x02df, 0x0000, 0x0000,
+	    0x0138, 0x032d, 0x0000, 0x004f, 0x0000, 0x0000, 0x02b2, 0x0000,
+	    0x0490, 0x0337, 0x019b, 0x00fb, 0x0703, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0154, 0x0000, 0x003d, 0x02f3, 0x0000, 0x0000, 0x074b,
+	    0x0783, 0x0000, 0x0000, 0x0000, 0x01bd, 0x06dd, 0x0339, 0x0000,
+	    0x06b4, 0x0000, 0x066f, 0x0000, 0x0000, 0x0242, 0x0786, 0x066f,
+	    0x04b8, 0x0001, 0x05e6, 0x0000, 0x04e6, 0x060d, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04cd, 0x0634, 0x07be, 0x0000, 0x0000, 0x0000,
+	    0x05e8, 0x0000, 0x0000, 0x0000, 0x05ea, 0x04aa, 0x00da, 0x0000,
+	    0x05f4, 0x0000, 0x0206, 0x0000, 0x00cb, 0x0403, 0x0000, 0x02e9,
+	    0x0666, 0x0029, 0x0646, 0x0000, 0x0000, 0x065c, 0x01a1, 0x0000,
+	    0x0000, 0x03c6, 0x0296, 0x006c, 0x0000, 0x0000, 0x04e5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0297, 0x0000, 0x0000, 0x017a,
+	    0x04ba, 0x0000, 0x0106, 0x0000, 0x03ce, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01e1, 0x0000, 0x0000, 0x0126, 0x04e0, 0x05ed, 0x075e,
+	    0x0000, 0x06f6, 0x00ad, 0x0000, 0x0000, 0x0000, 0x0314, 0x0000,
+	    0x0000, 0x0000, 0x02e0, 0x04f7, 0x0654, 0x0715, 0x07c6, 0x03ca,
+	    0x023d, 0x0751, 0x0000, 0x0000, 0x0000, 0x0213, 0x0329, 0x0000,
+	    0x0744, 0x004b, 0x0000, 0x03e8, 0x0579, 0x0000, 0x0000, 0x079c,
+	    0x05fc, 0x0000, 0x0561, 0x04c1, 0x0000, 0x0458, 0x0000, 0x0211,
+	    0x00ae, 0x0530, 0x0000, 0x0000, 0x03bf, 0x0000, 0x05ca, 0x0286,
+	    0x0000, 0x0000, 0x0650, 0x0000, 0x065a, 0x069e, 0x0779, 0x0000,
+	    0x0000, 0x0622, 0x0000, 0x05c6, 0x0020, 0x0000, 0x03c4, 0x0000,
+	    0x0000, 0x0000, 0x031b, 0x0000, 0x00fc, 0x059b, 0x0000, 0x0610,
+	    0x003a, 0x016d, 0x0567, 0x0000, 0x0000, 0x0000, 0x006e, 0x023c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03b3, 0x01f0,
+	    0x0000, 0x0000, 0x0266, 0x0000, 0x06a7, 0x0451, 0x0000, 0x00c3,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x029e, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0604, 0x00d1, 0x0676, 0x0488, 0x030f, 0x061b,
+	    0x0436, 0x058f, 0x06a8, 0x0541, 0x0140, 0x0614, 0x0000, 0x0000,
+	    0x0000, 0x04e4, 0x0063, 0x03f4, 0x0000, 0x0000, 0x033a, 0x0433,
+	    0x04a2, 0x0009, 0x0000, 0x0328, 0x0531, 0x0000, 0x0000, 0x06a5,
+	    0x0000, 0x0000, 0x0652, 0x0754, 0x0153, 0x0000, 0x0000, 0x051d,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0075,
+	    0x0000, 0x0000, 0x0000, 0x0160, 0x0000, 0x0649, 0x0000, 0x0000,
+	    0x0695, 0x01fd, 0x0000, 0x0745, 0x005b, 0x06ac, 0x0000, 0x00f6,
+	    0x0000, 0x0707, 0x0000, 0x0127, 0x0233, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x04b5, 0x0000, 0x0000, 0x017d, 0x0000, 0x030c,
+	    0x0000, 0x0602, 0x07b7, 0x01a4, 0x0000, 0x0000, 0x00f4, 0x021d,
+	    0x007b, 0x0000, 0x0000, 0x021d, 0x0000, 0x03b6, 0x0000, 0x0000,
+	    0x0788, 0x06fd, 0x0000, 0x02e6, 0x03b3, 0x0000, 0x0000, 0x0486,
+	    0x0000, 0x0000, 0x0289, 0x0000, 0x04f7, 0x0442, 0x0000, 0x054a,
+	    0x06c3, 0x0000, 0x01d1, 0x0000, 0x0000, 0x0085, 0x0288, 0x0000,
+	    0x0000, 0x07c0, 0x07c7, 0x0128, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0280, 0x06b5, 0x001a, 0x0000, 0x0000, 0x035d,
+	    0x0000, 0x0000, 0x0000, 0x05fa, 0x0000, 0x0000, 0x0000, 0x0356,
+	    0x0000, 0x040f, 0x0000, 0x0000, 0x0721, 0x0000, 0x014a, 0x0521,
+	    0x0531, 0x00d1, 0x0000, 0x0520, 0x0000, 0x0444, 0x051e, 0x05f3,
+	    0x0000, 0x01df, 0x0000, 0x0000, 0x0777, 0x0000, 0x03a6, 0x04bb,
+	    0x0000, 0x0000, 0x0000, 0x0241, 0x0046, 0x04f0, 0x01a0, 0x0000,
+	    0x00c8, 0x06c6, 0x06d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0553, 0x068e, 0x0400, 0x0000, 0x0000, 0x0000, 0x03ca, 0x0000,
+	    0x0000, 0x0000, 0x034f, 0x0000, 0x0000, 0x0000, 0x04b4, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f9, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x004e, 0x0000, 0x0243, 0x0000, 0x0508, 0x0000,
+	    0x046c, 0x0016, 0x05f9, 0x0000, 0x00c4, 0x0000, 0x0000, 0x04d1,
+	    0x0000, 0x0000, 0x0320, 0x0000, 0x0000, 0x076b, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x051d, 0x0000, 0x0000, 0x0222, 0x00a9,
+	    0x0000, 0x005a, 0x05b2, 0x0000, 0x0000, 0x0755, 0x0000, 0x001f,
+	    0x021f, 0x0794, 0x0000, 0x0000, 0x0000, 0x02e0, 0x04cf, 0x0764,
+	    0x05a0, 0x0000, 0x0268, 0x074e, 0x031c, 0x06af, 0x0757, 0x0373,
+	    0x010c, 0x0000, 0x0000, 0x01fe, 0x0000, 0x00bb, 0x0000, 0x04be,
+	    0x04d5, 0x034e, 0x03a6, 0x0000, 0x0000, 0x03a9, 0x0000, 0x04d4,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01cb,
+	    0x02e6, 0x0000, 0x0231, 0x0602, 0x01ec, 0x0000, 0x0455, 0x00b9,
+	    0x0376, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x037e, 0x0000,
+	    0x0000, 0x0217, 0x073f, 0x0000, 0x0000, 0x0000, 0x0000, 0x05f5,
+	    0x000e, 0x0000, 0x0194, 0x0000, 0x0000, 0x0000, 0x03b5, 0x0000,
+	    0x0610, 0x0000, 0x0000, 0x0783, 0x0362, 0x0000, 0x0000, 0x0309,
+	    0x0544, 0x0000, 0x0000, 0x0000, 0x0761, 0x0018, 0x035c, 0x03e6,
+	    0x0127, 0x046d, 0x0000, 0x03d5, 0x05f1, 0x0000, 0x0000, 0x0000,
+	    0x03e9, 0x020d, 0x0544, 0x0000, 0x0692, 0x0692, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0239, 0x0000, 0x0000,
+	    0x0184, 0x0524, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x077a, 0x0789, 0x0000, 0x0473, 0x04ce,
+	    0x04c8, 0x0221, 0x0000, 0x0000, 0x0634, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x03b6, 0x00f7, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x078e, 0x00c4, 0x06be, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0253, 0x052a, 0x0000, 0x0000, 0x0000, 0x049e,
+	    0x0206, 0x0000, 0x0000, 0x0000, 0x0389, 0x0000, 0x0000, 0x0401,
+	    0x0455, 0x0561, 0x0000, 0x0000, 0x0683, 0x0000, 0x01a8, 0x0200,
+	    0x0132, 0x0758, 0x0000, 0x0000, 0x0000, 0x040e, 0x0000, 0x06ba,
+	    0x01d3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0166, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x03f3, 0x0351, 0x065d, 0x06c9, 0x0000, 0x0000,
+	    0x0000, 0x05dc, 0x0000, 0x0349, 0x04a7, 0x0000, 0x0000, 0x01ac,
+	    0x066d, 0x0114, 0x0000, 0x0000, 0x0000, 0x0485, 0x04ba, 0x0000,
+	    0x04c9, 0x0000, 0x0024, 0x0105, 0x07cd, 0x0000, 0x044c, 0x00af,
+	    0x0303, 0x0000, 0x0000, 0x0335, 0x001b, 0x0000, 0x0000, 0x05e9,
+	    0x02d6, 0x0000, 0x0000, 0x0000, 0x0000, 0x047d, 0x0000, 0x0195,
+	    0x0000, 0x0262, 0x0000, 0x0105, 0x06ce, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02ff, 0x0000, 0x0661, 0x0000, 0x0000, 0x06c7, 0x0000,
+	    0x01fc, 0x01b8, 0x0000, 0x0000, 0x016a, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04ba, 0x07a1, 0x0000, 0x0716, 0x0320,
+	    0x0280, 0x0000, 0x0000, 0x0422, 0x0000, 0x0200, 0x0000, 0x03a3,
+	    0x0000, 0x058e, 0x0321, 0x0000, 0x032f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0694, 0x0000, 0x0000, 0x0166, 0x0000, 0x0000,
+	    0x026a, 0x0000, 0x0167, 0x0507, 0x0410, 0x0000, 0x0000, 0x02f0,
+	    0x0000, 0x006b, 0x0000, 0x073e, 0x060e, 0x0000, 0x0646, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04e7,
+	    0x0333, 0x0000, 0x031f, 0x04f5, 0x050b, 0x04a3, 0x0699, 0x0000,
+	    0x0008, 0x06ec, 0x0000, 0x0000, 0x0396, 0x0000, 0x0000, 0x03d8,
+	    0x0000, 0x0000, 0x0000, 0x00d2, 0x0000, 0x07ae, 0x0000, 0x041b,
+	    0x063f, 0x0000, 0x0000, 0x0574, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x04a7, 0x0000, 0x0000, 0x0000, 0x06bf, 0x04a6, 0x07be, 0x0661,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x05d4, 0x04c5, 0x04da, 0x0000,
+	    0x0000, 0x06ad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0747,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x03f6, 0x0000, 0x0000, 0x0000,
+	    0x056e, 0x0000, 0x0000, 0x03b1, 0x0000, 0x0567, 0x0000, 0x02d1,
+	    0x0000, 0x0611, 0x00d1, 0x0000, 0x0000, 0x05d3, 0x0000, 0x0552,
+	    0x0694, 0x0000, 0x0000, 0x0685, 0x0000, 0x0000, 0x0268, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x069a, 0x0284, 0x00d6, 0x006f,
+	    0x0302, 0x00ec, 0x0000, 0x0000, 0x04eb, 0x0000, 0x0000, 0x0000,
+	    0x0029, 0x0000, 0x0000, 0x06e0, 0x00a7, 0x0000, 0x0083, 0x0000,
+	    0x0000, 0x049c, 0x0000, 0x04a4, 0x0000, 0x0000, 0x0000, 0x0675,
+	    0x064d, 0x0000, 0x0038, 0x07a8, 0x0000, 0x050d, 0x0000, 0x03ac,
+	    0x0134, 0x006e, 0x0000, 0x04cc, 0x0332, 0x0000, 0x06ac, 0x0000,
+	    0x0000, 0x0000, 0x0383, 0x0592, 0x0000, 0x0234, 0x0000, 0x06e9,
+	    0x0500, 0x052a, 0x045e, 0x06aa, 0x0412, 0x0112, 0x0305, 0x06d2,
+	    0x05a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0051, 0x0000, 0x0000,
+	    0x0000, 0x01eb, 0x0000, 0x0000, 0x0000, 0x0536, 0x0774, 0x0191,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x012e, 0x0000, 0x0120, 0x0050, 0x0000, 0x0000, 0x04ed, 0x0000,
+	    0x0775, 0x0000, 0x02c2, 0x0000, 0x0132, 0x0000, 0x0795, 0x0707,
+	    0x0000, 0x0044, 0x0000, 0x0000, 0x0000, 0x0248, 0x0534, 0x0652,
+	    0x0000, 0x028c, 0x072e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x00b9, 0x00bf, 0x0000, 0x03e0, 0x02f0, 0x0000, 0x0626, 0x025e,
+	    0x0218, 0x0000, 0x0456, 0x03d2, 0x0000, 0x0159, 0x0000, 0x02de,
+	    0x0000, 0x0000, 0x0000, 0x0204, 0x02c9, 0x0000, 0x0000, 0x05db,
+	    0x046e, 0x0224, 0x0072, 0x0121, 0x0000, 0x0107, 0x0000, 0x0000,
+	    0x048a, 0x010c, 0x004a, 0x0000, 0x070f, 0x0003, 0x00a4, 0x062a,
+	    0x0499, 0x00be, 0x0436, 0x02b8, 0x0000, 0x0161, 0x043a, 0x0000,
+	    0x046a, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dd, 0x020a, 0x029b,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0715, 0x014f, 0x0000, 0x0000,
+	    0x0000, 0x01c2, 0x0591, 0x00a7, 0x06f8, 0x035c, 0x04b2, 0x0359,
+	    0x0000, 0x0312, 0x0463, 0x04d2, 0x0289, 0x01f9, 0x0000, 0x06ac,
+	    0x016c, 0x051c, 0x0000, 0x054e, 0x0000, 0x0000, 0x0000, 0x05e3,
+	    0x0000, 0x0000, 0x04ed, 0x048d, 0x0000, 0x015d, 0x063b, 0x050b,
+	    0x0000, 0x05f7, 0x0000, 0x055f, 0x0574, 0x0160, 0x008e, 0x0000,
+	    0x0000, 0x0172, 0x05cf, 0x0000, 0x0000, 0x0000, 0x0372, 0x03d0,
+	    0x01d3, 0x0000, 0x0000, 0x070f, 0x0183, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02e1, 0x0000, 0x0000, 0x0000, 0x0616,
+	    0x00ae, 0x0000, 0x0301, 0x0441, 0x010d, 0x0000, 0x074c, 0x0000,
+	    0x0000, 0x05b1, 0x04a4, 0x0000, 0x0000, 0x0000, 0x079b, 0x0000,
+	    0x0320, 0x0000, 0x0000, 0x0000, 0x00c6, 0x0000, 0x030e, 0x0000,
+	    0x0000, 0x0339, 0x01a6, 0x0000, 0x03b4, 0x0000, 0x0000, 0x0000,
+	    0x01c1, 0x0000, 0x003b, 0x0345, 0x0000, 0x0026, 0x0626, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x07b8, 0x0000, 0x0000, 0x07b0,
+	    0x0502, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0619, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x04bf, 0x0601, 0x0000, 0x00e0, 0x0000,
+	    0x0000, 0x0000, 0x0158, 0x0000, 0x0563, 0x0147, 0x05d2, 0x05c8,
+	    0x0000, 0x0000, 0x041d, 0x0150, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x05b1, 0x06ca, 0x0000, 0x028f, 0x0000, 0x0000, 0x0000, 0x0641,
+	    0x0000, 0x0000, 0x033a, 0x0149, 0x0000, 0x0000, 0x0000, 0x0039,
+	    0x0656, 0x0000, 0x0571, 0x050d, 0x0000, 0x027b, 0x0581, 0x0000,
+	    0x001d, 0x032c, 0x001f, 0x0000, 0x0262, 0x0000, 0x02b3, 0x0000,
+	    0x0000, 0x0534, 0x04ac, 0x0000, 0x05f7, 0x0000, 0x034e, 0x0000,
+	    0x0000, 0x04bb, 0x0329, 0x0000, 0x0000, 0x0490, 0x0000, 0x0000,
+	    0x0000, 0x0467, 0x0000, 0x0000, 0x05b8, 0x02f3, 0x03a2, 0x0000,
+	    0x0168, 0x0000, 0x06c6, 0x04a2, 0x0000, 0x0000, 0x061b, 0x0000,
+	    0x0000, 0x0769, 0x0000, 0x0476, 0x0000, 0x031f, 0x0323, 0x0673,
+	    0x0000, 0x0606, 0x0000, 0x0392, 0x0765, 0x0710, 0x0000, 0x0000,
+	    0x0000, 0x055b, 0x0020, 0x0000, 0x0576, 0x011f, 0x0000, 0x06cc,
+	    0x0000, 0x0000, 0x0000, 0x0757, 0x0701, 0x037a, 0x0000, 0x0000,
+	    0x027b, 0x0000, 0x0000, 0x0177, 0x0673, 0x0280, 0x0000, 0x0042,
+	    0x0000, 0x0000, 0x03d6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x00ca, 0x0000, 0x0078, 0x0000, 0x0337, 0x076a, 0x0000, 0x0000,
+	    0x0000, 0x0285, 0x0164, 0x050e, 0x03d7, 0x0239, 0x065e, 0x0000,
+	    0x0000, 0x0632, 0x0000, 0x0522, 0x0000, 0x023f, 0x03eb, 0x0000,
+	    0x01a6, 0x0550, 0x0000, 0x05b6, 0x071e, 0x0000, 0x07b4, 0x0762,
+	    0x04c8, 0x0054, 0x0000, 0x0782, 0x0000, 0x011b, 0x0000, 0x0000,
+	    0x0000, 0x06a0, 0x0111, 0x0588, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0359, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04c2, 0x01d4,
+	    0x053f, 0x0732, 0x0000, 0x0000, 0x0000, 0x0455, 0x0067, 0x0704,
+	    0x0131, 0x021d, 0x0517, 0x0278, 0x0000, 0x026e, 0x0000, 0x0625,
+	    0x0000, 0x075d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0503, 0x0000,
+	    0x0000, 0x064f, 0x02da, 0x0367, 0x05de, 0x04c4, 0x048c, 0x055c,
+	    0x0000, 0x0000, 0x0000, 0x0770, 0x0000, 0x0718, 0x0081, 0x0000,
+	    0x0450, 0x0000, 0x0000, 0x0000, 0x064a, 0x0000, 0x0394, 0x0000,
+	    0x0000, 0x0440, 0x0394, 0x065c, 0x0000, 0x0473, 0x0000, 0x0000,
+	    0x0000, 0x05df, 0x0158, 0x0769, 0x0000, 0x03a2, 0x0000, 0x0000,
+	    0x02b6, 0x0000, 0x0000, 0x0000, 0x0237, 0x029e, 0x07a3, 0x01b8,
+	    0x0000, 0x0037, 0x0000, 0x0000, 0x05db, 0x02eb, 0x036f, 0x0693,
+	    0x0000, 0x0283, 0x02a4, 0x0000, 0x055a, 0x0487, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0337, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x05ea, 0x03f0, 0x0000, 0x078d, 0x0000, 0x00cd, 0x0592,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0195, 0x01b1, 0x037e,
+	    0x0000, 0x00d7, 0x02b0, 0x0550, 0x00a1, 0x0000, 0x0000, 0x0582,
+	    0x04bc, 0x0000, 0x0682, 0x05df, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0184, 0x0000, 0x01d5, 0x0138, 0x0000, 0x0000, 0x05f7, 0x0654,
+	    0x00c2, 0x0000, 0x002c, 0x0000, 0x0405, 0x0261, 0x069d, 0x0000,
+	    0x0000, 0x04c0, 0x0000, 0x0000, 0x030a, 0x0000, 0x0440, 0x0000,
+	    0x0088, 0x0407, 0x0000, 0x06e4, 0x0000, 0x0430, 0x05f3, 0x0000,
+	    0x0000, 0x0000, 0x0772, 0x0000, 0x0000, 0x0000, 0x0784, 0x05f5,
+	    0x0000, 0x058b, 0x05a5, 0x0000, 0x05fc, 0x0000, 0x0000, 0x0589,
+	    0x0000, 0x0000, 0x0199, 0x0177, 0x047b, 0x02c9, 0x0000, 0x0000,
+	    0x0000, 0x0635, 0x031e, 0x0000, 0x04ff, 0x06f6, 0x013b, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0219, 0x05d9, 0x0000, 0x0000, 0x03a8,
+	    0x0000, 0x0000, 0x0000, 0x01ac, 0x0129, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0709, 0x06b6, 0x03c7, 0x0000, 0x022d,
+	    0x0055, 0x04ab, 0x078c, 0x0000, 0x0000, 0x02e8, 0x05e1, 0x0000,
+	    0x02a9, 0x0000, 0x02b7, 0x0000, 0x0326, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x054b, 0x0000, 0x0772, 0x0000, 0x0000, 0x0000, 0x0349,
+	    0x0000, 0x0542, 0x0000, 0x0000, 0x0000, 0x0452, 0x0000, 0x01a8,
+	    0x0726, 0x03f0, 0x0000, 0x0000, 0x0000, 0x00ae, 0x0435, 0x0000,
+	    0x0000, 0x00f8, 0x0000, 0x0000, 0x0623, 0x0000, 0x0000, 0x0000,
+	    0x03bb, 0x0000, 0x0269, 0x04b5, 0x05b8, 0x0363, 0x03ad, 0x0374,
+	    0x0000, 0x0000, 0x0000, 0x0709, 0x07b8, 0x0000, 0x0000, 0x0000,
+	    0x0146, 0x0554, 0x0000, 0x03f4, 0x0727, 0x0124, 0x05ee, 0x00ce,
+	    0x043e, 0x0000, 0x06dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02e3, 0x0519, 0x0061, 0x0000, 0x0000, 0x05dd,
+	    0x0000, 0x0425, 0x02de, 0x0523, 0x0000, 0x0000, 0x0353, 0x0000,
+	    0x00bf, 0x0000, 0x0523, 0x0000, 0x045b, 0x029e, 0x0000, 0x018a,
+	    0x0000, 0x01af, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0678,
+	    0x0000, 0x0000, 0x057b, 0x0236, 0x0238, 0x058c, 0x0056, 0x004b,
+	    0x0460, 0x0000, 0x0000, 0x0531, 0x070a, 0x028b, 0x01f9, 0x0222,
+	    0x01f2, 0x04c3, 0x03c0, 0x028c, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x07a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f8, 0x031d, 0x0274,
+	    0x078d, 0x02f0, 0x0146, 0x06ae, 0x0000, 0x0000, 0x05b4, 0x0000,
+	    0x0000,
+	};
+	uint16_t h[4];
+
+	_fixedhash(h_lo, h_hi, (uint64_t*)h);
+
+	h[0] = h[0] % 4001;
+	h[1] = h[1] % 4001;
+	result = (g[h[0]] + g[h[1]]) % 2000;
+	return (_fixed_le(hash_keys[result] + 0, 8) == h_lo &&
+	    _fixed_le(hash_keys[result] + 8, 8) == h_hi) ? result : (uint16_t)-1;
+}
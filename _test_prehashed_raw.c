@@ -0,0 +1,345 @@
+/* generated with rurban/nbperf 08a5797  -H 128 -R _hashes.bin */
+/* seed[0]: 596516649, seed[1]: 1189641421 */
+#include <stdint.h>
+
+static inline uint64_t _inthash64(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return x ^ (x >> 31);
+}
+
+static inline void
+_fixedhash(const uint64_t h_lo, const uint64_t h_hi, uint64_t *h)
+{
+	uint64_t x = UINT64_C(0x46e87ccd238e1f29);
+
+	x = _inthash64((h_lo ^ x) + h_hi);
+	h[0] = x;
+}
+
+uint16_t
+hash(const uint64_t h_lo, const uint64_t h_hi)
+{
+	static const uint16_t g[2481] = {
+	    0x014f, 0x0000, 0x06fc, 0x0000, 0x03e1, 0x0000, 0x0345, 0x0132,
+	    0x03f7, 0x04c8, 0x064a, 0x0000, 0x0003, 0x0450, 0x0193, 0x0000,
+	    0x0236, 0x0291, 0x02c0, 0x0232, 0x05e3, 0x065e, 0x06d6, 0x024f,
+	    0x0127, 0x0000, 0x06fd, 0x0741, 0x067d, 0x0000, 0x0352, 0x032e,
+	    0x0490, 0x0717, 0x0351, 0x061c, 0x0129, 0x03d7, 0x0274, 0x071f,
+	    0x0735, 0x000c, 0x0297, 0x07c2, 0x0530, 0x00c9, 0x011f, 0x0000,
+	    0x04dd, 0x07c1, 0x0215, 0x003b, 0x06cd, 0x01f9, 0x02fb, 0x0000,
+	    0x0069, 0x0000, 0x0000, 0x0346, 0x0000, 0x0168, 0x0520, 0x05d0,
+	    0x00e5, 0x0000, 0x0000, 0x062c, 0x0133, 0x02ea, 0x02bd, 0x0000,
+	    0x051f, 0x00b4, 0x0459, 0x02bc, 0x02aa, 0x015f, 0x0637, 0x0001,
+	    0x07bb, 0x05c1, 0x0000, 0x06fb, 0x040e, 0x0260, 0x0221, 0x0714,
+	    0x031b, 0x04e2, 0x0522, 0x0000, 0x005c, 0x02cc, 0x072f, 0x005a,
+	    0x0000, 0x01a4, 0x050f, 0x0000, 0x05e4, 0x0000, 0x04bf, 0x0516,
+	    0x0556, 0x0321, 0x01ea, 0x0575, 0x01fe, 0x0405, 0x0232, 0x0000,
+	    0x043d, 0x0000, 0x0557, 0x0442, 0x01cd, 0x01d1, 0x06c3, 0x0000,
+	    0x0564, 0x04e2, 0x0510, 0x049f, 0x066b, 0x0597, 0x0539, 0x0708,
+	    0x0008, 0x02ec, 0x03cf, 0x07a2, 0x01ce, 0x0000, 0x0693, 0x007b,
+	    0x0746, 0x05c3, 0x020e, 0x01bc, 0x028f, 0x0399, 0x02d6, 0x0113,
+	    0x0799, 0x034e, 0x03f9, 0x00cf, 0x0000, 0x0000, 0x0151, 0x01e3,
+	    0x05ce, 0x0054, 0x0742, 0x03dc, 0x03bd, 0x0312, 0x0000, 0x021d,
+	    0x0124, 0x0477, 0x02db, 0x01ca, 0x0366, 0x024a, 0x0606, 0x029e,
+	    0x0109, 0x0000, 0x071b, 0x0000, 0x02ba, 0x0390, 0x071c, 0x0000,
+	    0x021b, 0x01c5, 0x006a, 0x046d, 0x0000, 0x06bc, 0x0000, 0x0000,
+	    0x040b, 0x009e, 0x04c4, 0x0286, 0x005c, 0x0062, 0x04f1, 0x0789,
+	    0x0785, 0x01ba, 0x03f0, 0x0000, 0x0636, 0x05bd, 0x020e, 0x00a6,
+	    0x0200, 0x0130, 0x039f, 0x0240, 0x05ab, 0x04cf, 0x0769, 0x022d,
+	    0x0714, 0x0000, 0x03c6, 0x055d, 0x05b1, 0x00a2, 0x0000, 0x0068,
+	    0x0000, 0x0600, 0x07ad, 0x0792, 0x0000, 0x06e2, 0x02ff, 0x0632,
+	    0x02da, 0x02a6, 0x044b, 0x0551, 0x0177, 0x0000, 0x0000, 0x0222,
+	    0x046b, 0x0432, 0x043f, 0x048a, 0x036e, 0x04bc, 0x0000, 0x01d8,
+	    0x0000, 0x0174, 0x01d8, 0x00ea, 0x04f3, 0x02a7, 0x0599, 0x04ca,
+	    0x006c, 0x05d5, 0x079f, 0x0000, 0x03f2, 0x0202, 0x0582, 0x0260,
+	    0x00fa, 0x01d2, 0x0000, 0x03b8, 0x02d4, 0x020a, 0x04dc, 0x0000,
+	    0x078c, 0x0128, 0x0000, 0x0517, 0x0785, 0x065f, 0x0703, 0x02f7,
+	    0x073d, 0x01be, 0x0000, 0x0548, 0x03ad, 0x066b, 0x0000, 0x0466,
+	    0x0000, 0x06c6, 0x00e0, 0x0199, 0x01de, 0x0500, 0x0000, 0x0000,
+	    0x02d1, 0x01b7, 0x0782, 0x05f5, 0x02a6, 0x060f, 0x065e, 0x031e,
+	    0x0057, 0x0765, 0x0761, 0x0000, 0x01df, 0x004d, 0x05ec, 0x031b,
+	    0x05c3, 0x0000, 0x058e, 0x0000, 0x07ae, 0x070f, 0x0127, 0x00c5,
+	    0x04c1, 0x013e, 0x0000, 0x04bc, 0x0527, 0x0735, 0x0457, 0x04cc,
+	    0x056c, 0x00ba, 0x0671, 0x0000, 0x0780, 0x0798, 0x0612, 0x043c,
+	    0x03bd, 0x0000, 0x0471, 0x0356, 0x0577, 0x01ec, 0x07ae, 0x0359,
+	    0x06b3, 0x060a, 0x055c, 0x0000, 0x02ee, 0x070e, 0x0537, 0x02c0,
+	    0x0000, 0x04cb, 0x04a4, 0x060a, 0x0604, 0x00d6, 0x0118, 0x0000,
+	    0x0000, 0x04f1, 0x0000, 0x0000, 0x0797, 0x00a0, 0x00c4, 0x00e2,
+	    0x0261, 0x05c1, 0x0000, 0x0000, 0x0000, 0x06be, 0x02e6, 0x04af,
+	    0x06c0, 0x02b4, 0x0000, 0x0693, 0x0689, 0x02f8, 0x0000, 0x0503,
+	    0x05fa, 0x0478, 0x06c1, 0x0059, 0x04bf, 0x0000, 0x016b, 0x0660,
+	    0x05dd, 0x0583, 0x0564, 0x03b7, 0x0415, 0x00e4, 0x0259, 0x0061,
+	    0x06b8, 0x0338, 0x03f5, 0x058c, 0x05f0, 0x06ba, 0x0000, 0x02a6,
+	    0x01c6, 0x01c3, 0x0578, 0x05d3, 0x02b8, 0x031e, 0x0632, 0x04ca,
+	    0x0000, 0x00d9, 0x0529, 0x06fb, 0x05df, 0x07af, 0x0000, 0x031a,
+	    0x04c0, 0x0000, 0x04d1, 0x065d, 0x051f, 0x0000, 0x0000, 0x02b7,
+	    0x0370, 0x0064, 0x0114, 0x016e, 0x0000, 0x06c5, 0x0000, 0x005a,
+	    0x052f, 0x03b7, 0x008f, 0x000b, 0x0000, 0x0000, 0x0000, 0x0537,
+	    0x0000, 0x0032, 0x0000, 0x0000, 0x0403, 0x0018, 0x0186, 0x01e3,
+	    0x016d, 0x0000, 0x0330, 0x008e, 0x000d, 0x064d, 0x069d, 0x03f4,
+	    0x005d, 0x047a, 0x0005, 0x0632, 0x0263, 0x060c, 0x0273, 0x0212,
+	    0x0792, 0x0262, 0x0116, 0x033e, 0x024d, 0x07c7, 0x02fb, 0x011e,
+	    0x065a, 0x05e3, 0x0503, 0x01b7, 0x05a5, 0x0000, 0x0000, 0x0000,
+	    0x0571, 0x0390, 0x0000, 0x0659, 0x0052, 0x05fd, 0x046f, 0x0203,
+	    0x0047, 0x0114, 0x0194, 0x0000, 0x047e, 0x072b, 0x07a1, 0x0023,
+	    0x0159, 0x0692, 0x059a, 0x03cb, 0x02b5, 0x0280, 0x0459, 0x0000,
+	    0x02cb, 0x0799, 0x01d2, 0x07c2, 0x0129, 0x060a, 0x036e, 0x022a,
+	    0x03b1, 0x072c, 0x0299, 0x0415, 0x046d, 0x0331, 0x025c, 0x00af,
+	    0x0000, 0x03d9, 0x0282, 0x0000, 0x0000, 0x02c2, 0x03ba, 0x012e,
+	    0x0095, 0x051b, 0x03bd, 0x0000, 0x018a, 0x027e, 0x06c7, 0x0000,
+	    0x06f2, 0x03a7, 0x0000, 0x0000, 0x01e8, 0x0769, 0x013a, 0x0438,
+	    0x053e, 0x04cc, 0x0379, 0x020e, 0x0024, 0x0791, 0x03ae, 0x042b,
+	    0x0369, 0x01f5, 0x038c, 0x0000, 0x013c, 0x04a0, 0x0000, 0x05c7,
+	    0x0350, 0x063a, 0x0000, 0x0000, 0x01f6, 0x0766, 0x03f6, 0x0195,
+	    0x0140, 0x021f, 0x059a, 0x064b, 0x002e, 0x0148, 0x05d0, 0x068e,
+	    0x0489, 0x0032, 0x0375, 0x0595, 0x0091, 0x0000, 0x0590, 0x0000,
+	    0x01ab, 0x017c, 0x071d, 0x03a3, 0x0522, 0x0000, 0x042d, 0x0000,
+	    0x0069, 0x0704, 0x02dd, 0x0000, 0x01a8, 0x02be, 0x014c, 0x05e6,
+	    0x058c, 0x0619, 0x0463, 0x0367, 0x07ca, 0x0000, 0x0028, 0x0724,
+	    0x014d, 0x006f, 0x06ee, 0x01c3, 0x0000, 0x05f5, 0x0000, 0x064d,
+	    0x060f, 0x04c4, 0x0000, 0x0000, 0x0690, 0x0344, 0x0000, 0x0000,
+	    0x001e, 0x00d0, 0x0000, 0x0000, 0x009d, 0x0768, 0x04a8, 0x0742,
+	    0x0000, 0x04de, 0x0799, 0x03c3, 0x0369, 0x04d5, 0x0369, 0x03be,
+	    0x0087, 0x01b4, 0x01f0, 0x008c, 0x06aa, 0x0000, 0x0072, 0x049e,
+	    0x03ee, 0x028d, 0x04fd, 0x0224, 0x00e8, 0x0000, 0x0000, 0x02ef,
+	    0x0069, 0x05d9, 0x06cf, 0x03bc, 0x0488, 0x058e, 0x0126, 0x064c,
+	    0x0373, 0x0000, 0x0605, 0x0347, 0x0208, 0x00f8, 0x0591, 0x04a4,
+	    0x00b8, 0x04e3, 0x0000, 0x040d, 0x0164, 0x0000, 0x008c, 0x0339,
+	    0x0000, 0x06ce, 0x00af, 0x000a, 0x0781, 0x0000, 0x0000, 0x073b,
+	    0x0576, 0x02dc, 0x001b, 0x02e8, 0x013c, 0x0494, 0x04d9, 0x074a,
+	    0x0242, 0x03aa, 0x05a3, 0x0389, 0x04fc, 0x0039, 0x04dc, 0x050b,
+	    0x049d, 0x0131, 0x06e8, 0x0137, 0x0000, 0x0318, 0x030b, 0x05a2,
+	    0x0047, 0x0569, 0x0613, 0x0000, 0x0000, 0x0000, 0x0173, 0x065c,
+	    0x00a3, 0x074e, 0x06e7, 0x0000, 0x0000, 0x03d8, 0x03d2, 0x016b,
+	    0x0549, 0x0000, 0x0704, 0x0247, 0x0524, 0x02af, 0x0000, 0x0198,
+	    0x05b3, 0x034c, 0x07ae, 0x0000, 0x0000, 0x0000, 0x036d, 0x02d1,
+	    0x04f3, 0x0582, 0x0129, 0x047a, 0x0170, 0x0020, 0x0414, 0x0192,
+	    0x0000, 0x0639, 0x032e, 0x05cd, 0x044e, 0x0000, 0x0261, 0x02d4,
+	    0x0788, 0x020b, 0x03e3, 0x0456, 0x0000, 0x02b1, 0x0270, 0x000c,
+	    0x0470, 0x012d, 0x008d, 0x0747, 0x017d, 0x0000, 0x0000, 0x0584,
+	    0x006f, 0x012c, 0x00f6, 0x001f, 0x014b, 0x0153, 0x0046, 0x0000,
+	    0x00b0, 0x0000, 0x06e0, 0x0000, 0x02c7, 0x0000, 0x0252, 0x0132,
+	    0x010c, 0x02c8, 0x0563, 0x05fe, 0x03dd, 0x074a, 0x0223, 0x0599,
+	    0x047b, 0x04fc, 0x04b5, 0x0732, 0x00f6, 0x059e, 0x005d, 0x0559,
+	    0x0000, 0x0168, 0x0012, 0x0000, 0x0676, 0x01fa, 0x0593, 0x0157,
+	    0x0767, 0x030d, 0x07bb, 0x0000, 0x0000, 0x04c7, 0x0585, 0x00ef,
+	    0x0355, 0x0000, 0x0321, 0x075d, 0x0026, 0x0369, 0x05c8, 0x0000,
+	    0x020d, 0x07a9, 0x0390, 0x0592, 0x0729, 0x06e8, 0x05ad, 0x0532,
+	    0x0000, 0x0250, 0x0113, 0x0566, 0x0006, 0x05de, 0x020f, 0x0206,
+	    0x01fb, 0x0000, 0x0000, 0x042d, 0x0758, 0x0387, 0x07c3, 0x0000,
+	    0x00dd, 0x0251, 0x06f3, 0x0051, 0x02a3, 0x0626, 0x06b3, 0x0726,
+	    0x01fa, 0x074f, 0x0593, 0x0651, 0x0000, 0x0696, 0x025e, 0x00f5,
+	    0x0609, 0x0248, 0x0266, 0x0000, 0x01ad, 0x02db, 0x0067, 0x053b,
+	    0x03f9, 0x05d3, 0x021d, 0x04aa, 0x014c, 0x068a, 0x0356, 0x0000,
+	    0x056b, 0x0257, 0x032f, 0x063e, 0x00c0, 0x078e, 0x0292, 0x0516,
+	    0x0000, 0x0695, 0x0014, 0x06d7, 0x0576, 0x0484, 0x0007, 0x0000,
+	    0x0769, 0x062e, 0x05b9, 0x004b, 0x04bd, 0x0517, 0x0181, 0x0656,
+	    0x074d, 0x0000, 0x0462, 0x02a4, 0x0527, 0x0678, 0x0355, 0x0000,
+	    0x0000, 0x0119, 0x07a8, 0x0000, 0x01e6, 0x0000, 0x074a, 0x043d,
+	    0x046a, 0x03bf, 0x0309, 0x0000, 0x0530, 0x0000, 0x03d8, 0x03d7,
+	    0x0000, 0x0131, 0x0000, 0x0607, 0x02f7, 0x0075, 0x0000, 0x0000,
+	    0x03bd, 0x03fa, 0x00cd, 0x0000, 0x0000, 0x04f3, 0x0000, 0x063e,
+	    0x030f, 0x06e2, 0x0000, 0x064a, 0x0255, 0x0000, 0x018f, 0x0069,
+	    0x068f, 0x0000, 0x0429, 0x043d, 0x01fb, 0x015a, 0x0205, 0x0035,
+	    0x037c, 0x0000, 0x06c0, 0x00ba, 0x0415, 0x0017, 0x0000, 0x043c,
+	    0x0653, 0x0074, 0x0282, 0x02d3, 0x0668, 0x030d, 0x00e4, 0x0244,
+	    0x0215, 0x04f1, 0x0690, 0x0561, 0x0734, 0x0085, 0x0000, 0x0476,
+	    0x0194, 0x02bb, 0x0023, 0x0327, 0x011a, 0x0710, 0x062d, 0x0134,
+	    0x009e, 0x04e4, 0x0652, 0x04ea, 0x0162, 0x0000, 0x0000, 0x01d6,
+	    0x0000, 0x00b9, 0x03aa, 0x0712, 0x0000, 0x0614, 0x0000, 0x034c,
+	    0x00b6, 0x0000, 0x071d, 0x0161, 0x07b2, 0x0000, 0x00f9, 0x01ab,
+	    0x066f, 0x0000, 0x0000, 0x0000, 0x0000, 0x048f, 0x07ac, 0x065b,
+	    0x01c1, 0x04eb, 0x07c0, 0x05c8, 0x000d, 0x0000, 0x06e8, 0x0764,
+	    0x05ef, 0x0488, 0x0121, 0x0000, 0x0000, 0x04e0, 0x0000, 0x0211,
+	    0x00e9, 0x045a, 0x06d3, 0x0329, 0x0000, 0x050a, 0x0433, 0x020e,
+	    0x0000, 0x04ee, 0x038e, 0x04a1, 0x0048, 0x0000, 0x03f8, 0x030d,
+	    0x0574, 0x0068, 0x058d, 0x0091, 0x0222, 0x0000, 0x0692, 0x0234,
+	    0x0000, 0x02ed, 0x0049, 0x04a3, 0x0000, 0x00da, 0x029d, 0x06c3,
+	    0x0000, 0x0575, 0x02fb, 0x03bc, 0x0000, 0x01ee, 0x04c5, 0x0000,
+	    0x05b2, 0x0000, 0x0000, 0x05bb, 0x0000, 0x0000, 0x0454, 0x003f,
+	    0x065e, 0x057e, 0x04df, 0x0662, 0x0385, 0x04ca, 0x0000, 0x05c1,
+	    0x05c8, 0x0320, 0x00e4, 0x0427, 0x02b2, 0x07c0, 0x00d0, 0x00f8,
+	    0x0000, 0x0000, 0x0074, 0x0709, 0x0540, 0x06f5, 0x0226, 0x0000,
+	    0x0238, 0x0000, 0x0000, 0x061f, 0x035f, 0x00c4, 0x0450, 0x041f,
+	    0x00d8, 0x02b5, 0x01f7, 0x004d, 0x03ab, 0x0184, 0x054f, 0x06f5,
+	    0x0726, 0x0407, 0x0434, 0x0000, 0x0116, 0x0000, 0x0000, 0x0000,
+	    0x02b2, 0x04b1, 0x0000, 0x0682, 0x0683, 0x0000, 0x051b, 0x071b,
+	    0x068b, 0x0431, 0x0172, 0x0000, 0x0718, 0x06d5, 0x026c, 0x0450,
+	    0x0184, 0x00d6, 0x04d0, 0x05e9, 0x00e4, 0x03b1, 0x0099, 0x06dd,
+	    0x0132, 0x0000, 0x024d, 0x0000, 0x035d, 0x0661, 0x04cf, 0x0451,
+	    0x03a4, 0x0016, 0x02bf, 0x01bf, 0x0162, 0x0262, 0x0000, 0x0532,
+	    0x0000, 0x0555, 0x0000, 0x00fb, 0x03c5, 0x0573, 0x0000, 0x05b9,
+	    0x0720, 0x0717, 0x0096, 0x061a, 0x015a, 0x064f, 0x0615, 0x0780,
+	    0x00ec, 0x0042, 0x02ab, 0x02e7, 0x0000, 0x0103, 0x00eb, 0x06b4,
+	    0x02d8, 0x06a7, 0x0117, 0x0146, 0x0000, 0x0000, 0x011b, 0x071d,
+	    0x0773, 0x010f, 0x036a, 0x000f, 0x0000, 0x0000, 0x000f, 0x0000,
+	    0x0486, 0x0061, 0x0035, 0x0541, 0x059b, 0x07b8, 0x0483, 0x02bb,
+	    0x0050, 0x0000, 0x0080, 0x0381, 0x0000, 0x078d, 0x0424, 0x01d8,
+	    0x00a2, 0x01bf, 0x0000, 0x0000, 0x05b6, 0x023b, 0x027d, 0x05c5,
+	    0x0000, 0x0541, 0x0346, 0x0000, 0x0325, 0x0000, 0x0213, 0x05ce,
+	    0x00de, 0x0717, 0x0000, 0x00a7, 0x002b, 0x0000, 0x0510, 0x062c,
+	    0x0000, 0x056f, 0x0000, 0x0000, 0x013c, 0x06cf, 0x053e, 0x0072,
+	    0x0407, 0x0060, 0x03ae, 0x0000, 0x032e, 0x0250, 0x0000, 0x0207,
+	    0x070a, 0x0589, 0x0633, 0x0000, 0x0474, 0x0290, 0x043b, 0x0000,
+	    0x0557, 0x03df, 0x04e2, 0x0737, 0x004b, 0x027d, 0x06cd, 0x0722,
+	    0x0037, 0x01ad, 0x016a, 0x0074, 0x06c2, 0x0501, 0x0592, 0x039a,
+	    0x02da, 0x07b9, 0x0000, 0x0198, 0x06b0, 0x0360, 0x0218, 0x034f,
+	    0x0291, 0x02a3, 0x0636, 0x0000, 0x00e6, 0x030d, 0x0701, 0x039b,
+	    0x021d, 0x05fb, 0x00a1, 0x0000, 0x0428, 0x0000, 0x0218, 0x0639,
+	    0x00ad, 0x0000, 0x0085, 0x0725, 0x002c, 0x0000, 0x0495, 0x0000,
+	    0x0559, 0x0639, 0x069a, 0x07c7, 0x0000, 0x0225, 0x0272, 0x05e7,
+	    0x00e1, 0x0000, 0x0000, 0x01d8, 0x0261, 0x06ee, 0x0580, 0x041a,
+	    0x0505, 0x01fd, 0x0000, 0x0724, 0x069e, 0x0000, 0x00c0, 0x003f,
+	    0x0000, 0x0396, 0x0299, 0x0282, 0x0655, 0x05f7, 0x0000, 0x03f9,
+	    0x0000, 0x0279, 0x018d, 0x015b, 0x054c, 0x079e, 0x01a0, 0x0000,
+	    0x04a2, 0x01f2, 0x0595, 0x0000, 0x070a, 0x0000, 0x0716, 0x0056,
+	    0x05f9, 0x024c, 0x0000, 0x0000, 0x03ea, 0x03c3, 0x051b, 0x07a5,
+	    0x0191, 0x0163, 0x0000, 0x03c2, 0x0780, 0x060a, 0x0507, 0x0000,
+	    0x0000, 0x059f, 0x0034, 0x02d4, 0x0008, 0x02b8, 0x023d, 0x0006,
+	    0x06d6, 0x03b2, 0x03ee, 0x00a6, 0x0784, 0x049c, 0x0000, 0x0000,
+	    0x0000, 0x022b, 0x0181, 0x07ad, 0x0421, 0x0000, 0x0000, 0x06ef,
+	    0x066d, 0x042a, 0x06bf, 0x0232, 0x0284, 0x056f, 0x04ba, 0x0000,
+	    0x05a4, 0x04af, 0x0696, 0x07bb, 0x040f, 0x0205, 0x01da, 0x076b,
+	    0x07a7, 0x000f, 0x0000, 0x01db, 0x0667, 0x0575, 0x0000, 0x0551,
+	    0x02dc, 0x04ad, 0x0530, 0x04fa, 0x03a3, 0x04dc, 0x0388, 0x0000,
+	    0x021a, 0x02e3, 0x0196, 0x06f4, 0x0382, 0x00e5, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x079e, 0x0382, 0x077e, 0x05c4, 0x0314, 0x0000,
+	    0x0000, 0x01bf, 0x0166, 0x0259, 0x003f, 0x055d, 0x05f2, 0x0466,
+	    0x0343, 0x03ef, 0x0464, 0x01f7, 0x01b3, 0x0646, 0x0297, 0x0000,
+	    0x032d, 0x0249, 0x0659, 0x0000, 0x0000, 0x0000, 0x0000, 0x04aa,
+	    0x01fc, 0x05d9, 0x021f, 0x014d, 0x0629, 0x0459, 0x0000, 0x0455,
+	    0x030b, 0x025d, 0x01e1, 0x0272, 0x05c2, 0x003c, 0x07c2, 0x0000,
+	    0x01c0, 0x02b3, 0x03e1, 0x0000, 0x0763, 0x068b, 0x0000, 0x057e,
+	    0x0000, 0x0559, 0x0401, 0x0000, 0x0117, 0x0695, 0x06af, 0x00e3,
+	    0x02c1, 0x064f, 0x026e, 0x02fd, 0x0000, 0x0776, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x033e, 0x007e, 0x00a3, 0x0797, 0x0012, 0x04d3,
+	    0x0000, 0x0000, 0x06ee, 0x05e0, 0x0000, 0x051d, 0x0000, 0x02cf,
+	    0x0000, 0x0000, 0x0270, 0x052e, 0x0000, 0x0268, 0x0000, 0x0497,
+	    0x016e, 0x075d, 0x008a, 0x0762, 0x02db, 0x0000, 0x0000, 0x07aa,
+	    0x06a6, 0x0545, 0x0593, 0x07b8, 0x0463, 0x01c9, 0x00eb, 0x048c,
+	    0x040f, 0x059b, 0x07c4, 0x0000, 0x0190, 0x0000, 0x00e1, 0x04b4,
+	    0x0319, 0x0000, 0x0697, 0x011b, 0x0030, 0x04ea, 0x02e9, 0x01ad,
+	    0x0000, 0x026b, 0x0349, 0x04a8, 0x03eb, 0x02ea, 0x04a1, 0x0410,
+	    0x0451, 0x0730, 0x0390, 0x02df, 0x0082, 0x0000, 0x0632, 0x0553,
+	    0x0000, 0x0398, 0x00d6, 0x079e, 0x078f, 0x076d, 0x034a, 0x00d0,
+	    0x0775, 0x0000, 0x04d8, 0x06b7, 0x02cf, 0x0483, 0x0780, 0x0000,
+	    0x00d8, 0x0000, 0x01f6, 0x0718, 0x03eb, 0x005e, 0x010a, 0x0000,
+	    0x01b7, 0x00d0, 0x0000, 0x07c3, 0x01ac, 0x06ea, 0x0625, 0x068e,
+	    0x0740, 0x06d3, 0x0137, 0x05d1, 0x046f, 0x0324, 0x05d4, 0x02fb,
+	    0x0559, 0x0000, 0x031c, 0x056f, 0x022f, 0x0004, 0x06a7, 0x01a7,
+	    0x04c5, 0x027f, 0x011c, 0x0066, 0x023b, 0x0210, 0x0185, 0x00c4,
+	    0x0000, 0x01b9, 0x01e4, 0x065b, 0x0000, 0x0124, 0x0520, 0x005e,
+	    0x01e0, 0x078c, 0x0514, 0x073b, 0x05ed, 0x0360, 0x0450, 0x05c2,
+	    0x0008, 0x0000, 0x0000, 0x0000, 0x0615, 0x001b, 0x0568, 0x07a1,
+	    0x0704, 0x004f, 0x02dd, 0x00bf, 0x039d, 0x01e6, 0x0000, 0x04c6,
+	    0x0000, 0x0119, 0x0512, 0x0365, 0x044a, 0x075e, 0x0450, 0x0445,
+	    0x0099, 0x035b, 0x0000, 0x03f9, 0x02a1, 0x016c, 0x060e, 0x06ce,
+	    0x0491, 0x0754, 0x02a0, 0x0169, 0x00a4, 0x0000, 0x0246, 0x026b,
+	    0x03a5, 0x06da, 0x0427, 0x065e, 0x002d, 0x053b, 0x069b, 0x024e,
+	    0x0765, 0x04e8, 0x02ed, 0x01b8, 0x0700, 0x007a, 0x0352, 0x0000,
+	    0x01b3, 0x001a, 0x0525, 0x008d, 0x007b, 0x05b1, 0x0000, 0x05e3,
+	    0x0603, 0x0056, 0x04ed, 0x0000, 0x012f, 0x0603, 0x060e, 0x030b,
+	    0x046f, 0x01c7, 0x0000, 0x05fb, 0x059f, 0x0000, 0x0000, 0x067b,
+	    0x0000, 0x0000, 0x016a, 0x0681, 0x04f1, 0x0792, 0x04b8, 0x0410,
+	    0x0388, 0x0797, 0x04e0, 0x0000, 0x0000, 0x05b0, 0x01c8, 0x070a,
+	    0x0000, 0x0000, 0x069e, 0x0661, 0x0000, 0x023b, 0x0041, 0x04f8,
+	    0x0515, 0x0504, 0x05f4, 0x077f, 0x0139, 0x0143, 0x0784, 0x0003,
+	    0x0682, 0x0000, 0x0311, 0x0050, 0x0000, 0x0527, 0x0000, 0x02f9,
+	    0x00ab, 0x0000, 0x028b, 0x0467, 0x0378, 0x0000, 0x0196, 0x009d,
+	    0x06da, 0x02d6, 0x040e, 0x0092, 0x04ef, 0x05da, 0x0679, 0x06fd,
+	    0x036b, 0x0000, 0x06d9, 0x031f, 0x06ed, 0x0000, 0x0091, 0x01fe,
+	    0x039d, 0x0000, 0x027e, 0x0000, 0x071a, 0x034b, 0x01ab, 0x0000,
+	    0x044c, 0x0519, 0x063f, 0x0000, 0x046e, 0x0000, 0x0624, 0x066b,
+	    0x046b, 0x06c3, 0x0775, 0x0000, 0x0697, 0x07aa, 0x0398, 0x0617,
+	    0x0101, 0x03e2, 0x0000, 0x043e, 0x01e8, 0x00f8, 0x0182, 0x04a5,
+	    0x0008, 0x0000, 0x01ff, 0x001a, 0x00b2, 0x0516, 0x044f, 0x05dd,
+	    0x0500, 0x01de, 0x024c, 0x0666, 0x0748, 0x06e4, 0x00f8, 0x07bd,
+	    0x070b, 0x0242, 0x068b, 0x01a8, 0x03c0, 0x0749, 0x059d, 0x0000,
+	    0x07a6, 0x0172, 0x03e4, 0x063c, 0x0000, 0x0000, 0x064b, 0x028b,
+	    0x0000, 0x051d, 0x03a1, 0x05c7, 0x0470, 0x0351, 0x0000, 0x0158,
+	    0x06ef, 0x0707, 0x016b, 0x0010, 0x0335, 0x067f, 0x06d8, 0x0496,
+	    0x028e, 0x04d7, 0x0036, 0x0161, 0x0000, 0x078a, 0x0648, 0x0586,
+	    0x0204, 0x016c, 0x051d, 0x04a7, 0x0472, 0x0000, 0x05c6, 0x07ba,
+	    0x079b, 0x059e, 0x07af, 0x01cf, 0x00c5, 0x0109, 0x0000, 0x05c8,
+	    0x012f, 0x0483, 0x00b0, 0x0166, 0x0000, 0x060d, 0x0000, 0x0259,
+	    0x077b, 0x030f, 0x0060, 0x04da, 0x0716, 0x0000, 0x0000, 0x0115,
+	    0x0596, 0x05ba, 0x000c, 0x06b6, 0x00e0, 0x045b, 0x0610, 0x05e0,
+	    0x032a, 0x0160, 0x0000, 0x0000, 0x0000, 0x03ed, 0x01f0, 0x02de,
+	    0x0000, 0x03fb, 0x0067, 0x056a, 0x0000, 0x0743, 0x04b4, 0x0215,
+	    0x0115, 0x0000, 0x0000, 0x02b2, 0x06de, 0x0000, 0x0712, 0x003b,
+	    0x0797, 0x01b8, 0x0313, 0x02be, 0x0074, 0x0000, 0x0652, 0x041a,
+	    0x0245, 0x0658, 0x016e, 0x0000, 0x072e, 0x0612, 0x02b1, 0x03e2,
+	    0x0000, 0x0000, 0x0661, 0x07ae, 0x0102, 0x0354, 0x012e, 0x0120,
+	    0x0531, 0x008b, 0x0730, 0x063e, 0x02c1, 0x04a4, 0x06a9, 0x0632,
+	    0x0259, 0x0441, 0x03f1, 0x0066, 0x0799, 0x028f, 0x0000, 0x0590,
+	    0x074f, 0x0000, 0x0078, 0x05c6, 0x0710, 0x04b4, 0x00c4, 0x0000,
+	    0x0314, 0x0000, 0x0000, 0x00aa, 0x0668, 0x006a, 0x0000, 0x05d6,
+	    0x0000, 0x0000, 0x0450, 0x0010, 0x0044, 0x06b3, 0x01aa, 0x0312,
+	    0x0722, 0x0023, 0x046c, 0x0621, 0x0062, 0x0356, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x052c, 0x078c, 0x0000, 0x04a7, 0x006c, 0x0339,
+	    0x0690, 0x0000, 0x0000, 0x0000, 0x047e, 0x04cb, 0x00e1, 0x06b1,
+	    0x0000, 0x00cd, 0x0000, 0x0000, 0x0000, 0x04ae, 0x060e, 0x065b,
+	    0x0745, 0x054e, 0x0154, 0x0000, 0x056c, 0x0584, 0x02c1, 0x0000,
+	    0x017e, 0x0672, 0x0000, 0x0273, 0x0000, 0x01a8, 0x071d, 0x0645,
+	    0x0000, 0x02e1, 0x0000, 0x01e9, 0x04f5, 0x0207, 0x0468, 0x059a,
+	    0x0000, 0x0000, 0x06cf, 0x0681, 0x07a8, 0x019c, 0x068e, 0x04d2,
+	    0x032d, 0x01cd, 0x00af, 0x027b, 0x0106, 0x0248, 0x01c7, 0x028c,
+	    0x0293, 0x065d, 0x06ee, 0x01e0, 0x0237, 0x0066, 0x00ff, 0x0628,
+	    0x01c6, 0x0360, 0x0370, 0x05b6, 0x0578, 0x0353, 0x06ff, 0x014d,
+	    0x0000, 0x06be, 0x032f, 0x06c9, 0x054c, 0x01c7, 0x0006, 0x06aa,
+	    0x065f, 0x049d, 0x0000, 0x0200, 0x075a, 0x0464, 0x049a, 0x0000,
+	    0x001f, 0x0385, 0x0096, 0x059d, 0x0178, 0x0672, 0x0000, 0x074b,
+	    0x042e, 0x01aa, 0x0000, 0x0000, 0x01e8, 0x0070, 0x06fd, 0x03aa,
+	    0x061c, 0x0412, 0x009c, 0x0000, 0x0685, 0x0000, 0x06b8, 0x0000,
+	    0x0433, 0x0439, 0x0546, 0x0080, 0x006d, 0x012d, 0x0550, 0x0084,
+	    0x01e6, 0x06bd, 0x0000, 0x05b5, 0x06b5, 0x0000, 0x073d, 0x063d,
+	    0x0000, 0x0000, 0x04ab, 0x0000, 0x0000, 0x05cc, 0x0000, 0x003f,
+	    0x064d, 0x0379, 0x05c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x01d5,
+	    0x0000, 0x0205, 0x0000, 0x0000, 0x0000, 0x0261, 0x0000, 0x069e,
+	    0x0392, 0x04b8, 0x0000, 0x0436, 0x0226, 0x021f, 0x0248, 0x0000,
+	    0x0464, 0x06e1, 0x0000, 0x01e2, 0x05ab, 0x03ba, 0x0744, 0x02e1,
+	    0x024d, 0x01d6, 0x035f, 0x04c7, 0x06a5, 0x015a, 0x037c, 0x01c9,
+	    0x07cf, 0x0782, 0x03fa, 0x01e8, 0x06eb, 0x0519, 0x0007, 0x0252,
+	    0x0201, 0x057e, 0x06ad, 0x0198, 0x010a, 0x0000, 0x0085, 0x04f3,
+	    0x0657, 0x00f8, 0x068c, 0x026f, 0x0327, 0x0295, 0x0322, 0x0425,
+	    0x06db, 0x012d, 0x0000, 0x0058, 0x06ab, 0x0205, 0x0728, 0x0421,
+	    0x0019, 0x0250, 0x02cc, 0x0000, 0x0693, 0x0000, 0x0000, 0x069f,
+	    0x0108, 0x0039, 0x0142, 0x01aa, 0x0078, 0x0098, 0x0160, 0x0262,
+	    0x0383, 0x0041, 0x0229, 0x04fb, 0x03f6, 0x03d5, 0x0042, 0x0000,
+	    0x01d7, 0x05f5, 0x0000, 0x061d, 0x0642, 0x022a, 0x0000, 0x0076,
+	    0x0042, 0x01d4, 0x024f, 0x0379, 0x00db, 0x00bb, 0x03ce, 0x0358,
+	    0x060a, 0x0000, 0x0000, 0x025a, 0x077a, 0x06ae, 0x0077, 0x061c,
+	    0x0000, 0x027d, 0x0641, 0x07b4, 0x05f9, 0x018d, 0x0000, 0x0295,
+	    0x0525, 0x06de, 0x059b, 0x006d, 0x05b1, 0x0000, 0x0543, 0x07b3,
+	    0x0084, 0x0486, 0x0000, 0x01f9, 0x0706, 0x0366, 0x0730, 0x0000,
+	    0x0751, 0x0000, 0x061b, 0x0741, 0x05d5, 0x00fc, 0x0000, 0x031d,
+	    0x072a, 0x051f, 0x000e, 0x0669, 0x0725, 0x0418, 0x0499, 0x0361,
+	    0x0797, 0x0000, 0x0245, 0x0000, 0x0640, 0x02eb, 0x02e3, 0x0000,
+	    0x01c4, 0x0247, 0x00d0, 0x06f8, 0x06dd, 0x0000, 0x0000, 0x0480,
+	    0x0000, 0x04cd, 0x075b, 0x0269, 0x047a, 0x0296, 0x02a8, 0x0637,
+	    0x0439, 0x021a, 0x048e, 0x0000, 0x010c, 0x051c, 0x03fd, 0x0080,
+	    0x05df, 0x0000, 0x0073, 0x0566, 0x0661, 0x0302, 0x018c, 0x031c,
+	    0x01e5, 0x00a6, 0x06d2, 0x0000, 0x06ae, 0x0000, 0x0312, 0x01f1,
+	    0x0000, 0x00a5, 0x0758, 0x0000, 0x03a1, 0x03f5, 0x04d1, 0x0000,
+	    0x0547, 0x026a, 0x00ca, 0x0419, 0x0489, 0x04e5, 0x0000, 0x0000,
+	    0x0213, 0x05e2, 0x0555, 0x0182, 0x0777, 0x025e, 0x0265, 0x0640,
+	    0x045b, 0x0000, 0x036f, 0x0000, 0x0644, 0x0444, 0x0000, 0x05bf,
+	    0x061c, 0x01a2, 0x01c0, 0x06a7, 0x05fa, 0x0000, 0x072c, 0x0753,
+	    0x0413, 0x070a, 0x04a1, 0x03d7, 0x06a4, 0x0581, 0x0784, 0x0630,
+	    0x0499, 0x0287, 0x0172, 0x0649, 0x024b, 0x0192, 0x0175, 0x005d,
+	    0x0476, 0x0000, 0x00d3, 0x02a8, 0x067e, 0x0062, 0x000c, 0x0293,
+	    0x020e, 0x0000, 0x03ba, 0x03c4, 0x049b, 0x05b2, 0x0205, 0x0266,
+	    0x00e0, 0x04cb, 0x0434, 0x074c, 0x0000, 0x0377, 0x07bd, 0x03cc,
+	    0x02d7,
+	};
+	uint16_t h[8];
+
+	_fixedhash(h_lo, h_hi, (uint64_t*)h);
+
+	h[0] = h[0] % 2481;
+	h[1] = h[1] % 2481;
+	h[2] = h[2] % 2481;
+	return (g[h[0]] + g[h[1]] + g[h[2]]) % 2000;
+}
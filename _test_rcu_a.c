@@ -0,0 +1,52 @@
+/* generated with rurban/nbperf 08a5797  _words64 */
+/* seed[0]: 1804289383, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+const char * const rcu_a_keys[64] = {
+	"aa", "aaamvo", "aaaoepsaxqker", "aaawkatdsy",	/* 4 */
+	"aaazaiwmzo", "aabozllo", "aacwukjxnef", "aafjjxv",	/* 8 */
+	"aafkxt", "aafyjfdobuf", "aagbaqo", "aagwgqbdhc",	/* 12 */
+	"aahpgumys", "aahqwu", "aajoixnfterwky", "aakgie",	/* 16 */
+	"aalazfxybys", "aalqbxuarll", "aamevrbsmiecou", "aanimh",	/* 20 */
+	"aarfotdcsb", "aau", "aauljgrerearvd", "aaupkdl",	/* 24 */
+	"aavgjlqyprl", "aawplxnsl", "aaxw", "ab",	/* 28 */
+	"aba", "abb", "abcroqn", "abcyoudhuyoxv",	/* 32 */
+	"abded", "abdpauwxnyjjw", "abdvzz", "abemcsgtsaqf",	/* 36 */
+	"abgcyzzmsfaohz", "abgfzpabokt", "abghylkt", "abmtelekzgph",	/* 40 */
+	"abnnfppd", "abnznvhmvnpdsm", "abqg", "abrbqe",	/* 44 */
+	"abri", "abrsthrindrt", "abrvngkjcvst", "abttuirixp",	/* 48 */
+	"abucje", "abvlrapgztar", "abxrbvbhskm", "abzjq",	/* 52 */
+	"ac", "aca", "acat", "accdawrk",	/* 56 */
+	"acdumcj", "acfctctvvuqq", "acgeshhyiqp", "acgq",	/* 60 */
+	"acgsyaenn", "achaergtd", "acjqckgbahcww", "acklttjonmfsqw",	/* 64 */
+	};
+uint16_t
+rcu_a(const void * __restrict key, size_t keylen)
+{
+	uint8_t result;
+	static const uint8_t g[129] = {
+	    0x29, 0x08, 0x2a, 0x0a, 0x00, 0x36, 0x1e, 0x00, 0x1b, 0x00,
+	    0x00, 0x01, 0x00, 0x14, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00,
+	    0x3d, 0x00, 0x00, 0x13, 0x00, 0x00, 0x39, 0x00, 0x00, 0x0c,
+	    0x00, 0x21, 0x00, 0x19, 0x3d, 0x00, 0x00, 0x13, 0x00, 0x00,
+	    0x0d, 0x00, 0x15, 0x3c, 0x00, 0x00, 0x00, 0x13, 0x0a, 0x00,
+	    0x18, 0x00, 0x1c, 0x2c, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x3e,
+	    0x00, 0x00, 0x00, 0x00, 0x18, 0x3f, 0x33, 0x00, 0x28, 0x09,
+	    0x03, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x3b, 0x15, 0x0d, 0x3b,
+	    0x00, 0x3e, 0x00, 0x02, 0x2f, 0x00, 0x21, 0x06, 0x09, 0x00,
+	    0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x08, 0x00, 0x00,
+	    0x12, 0x00, 0x00, 0x13, 0x00, 0x00, 0x2c, 0x00, 0x3c, 0x00,
+	    0x27, 0x16, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x04, 0x28, 0x29,
+	    0x26, 0x00, 0x00, 0x24, 0x34, 0x10, 0x02, 0x00, 0x00,
+	};
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x6b8b4567), (uint32_t *)h);
+
+	h[0] = h[0] % 129;
+	h[1] = h[1] % 129;
+	result = (g[h[0]] + g[h[1]]) % 64;
+	return (strcmp(rcu_a_keys[result], key) == 0) ? result : (uint16_t)-1;
+}
@@ -0,0 +1,524 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 596516649, seed[1]: 0 */
+#include <stdint.h>
+#include "mi_vector_hash.h"
+
+#include <string.h>
+const char * const rcu_b_keys[1000] = {
+	"aa", "aaamvo", "aaaoepsaxqker", "aaawkatdsy",	/* 4 */
+	"aaazaiwmzo", "aabozllo", "aacwukjxnef", "aafjjxv",	/* 8 */
+	"aafkxt", "aafyjfdobuf", "aagbaqo", "aagwgqbdhc",	/* 12 */
+	"aahpgumys", "aahqwu", "aajoixnfterwky", "aakgie",	/* 16 */
+	"aalazfxybys", "aalqbxuarll", "aamevrbsmiecou", "aanimh",	/* 20 */
+	"aarfotdcsb", "aau", "aauljgrerearvd", "aaupkdl",	/* 24 */
+	"aavgjlqyprl", "aawplxnsl", "aaxw", "ab",	/* 28 */
+	"aba", "abb", "abcroqn", "abcyoudhuyoxv",	/* 32 */
+	"abded", "abdpauwxnyjjw", "abdvzz", "abemcsgtsaqf",	/* 36 */
+	"abgcyzzmsfaohz", "abgfzpabokt", "abghylkt", "abmtelekzgph",	/* 40 */
+	"abnnfppd", "abnznvhmvnpdsm", "abqg", "abrbqe",	/* 44 */
+	"abri", "abrsthrindrt", "abrvngkjcvst", "abttuirixp",	/* 48 */
+	"abucje", "abvlrapgztar", "abxrbvbhskm", "abzjq",	/* 52 */
+	"ac", "aca", "acat", "accdawrk",	/* 56 */
+	"acdumcj", "acfctctvvuqq", "acgeshhyiqp", "acgq",	/* 60 */
+	"acgsyaenn", "achaergtd", "acjqckgbahcww", "acklttjonmfsqw",	/* 64 */
+	"ackosnzmlndp", "aclya", "acndzbghzsnf", "acnjhah",	/* 68 */
+	"acq", "acqg", "acqzgdmgrudfev", "acrupnq",	/* 72 */
+	"actluu", "actnmsaqlxj", "acurtnbcgiuxz", "acvikspj",	/* 76 */
+	"acwmemtmnml", "acwuopbsjrdasc", "acyvmwnl", "ad",	/* 80 */
+	"adbb", "adcncxngm", "adcxr", "adfwg",	/* 84 */
+	"adgcouasqg", "adgnv", "adgorwmlnymtjv", "adgxbuovjvzrjs",	/* 88 */
+	"adhh", "adjgncgej", "adjzjjfcahdzbu", "adkrmjcofnbo",	/* 92 */
+	"adkvocwahadyny", "adnldbde", "adoalbcaylnjdp", "adoinuly",	/* 96 */
+	"adowolj", "adptyuhmk", "adsetbfuyqmlq", "adsyjfsp",	/* 100 */
+	"adu", "aduidlcplhjlw", "advxvdrmq", "advzb",	/* 104 */
+	"adwf", "adwfkizxbp", "adzplry", "adzrfo",	/* 108 */
+	"aeabb", "aeahcthpdbaspv", "aeahwehgc", "aebqchhcmwqshj",	/* 112 */
+	"aec", "aecdpkro", "aeckwcuomuwt", "aedk",	/* 116 */
+	"aedygfpc", "aeejqumjzwwp", "aegnwaegqii", "aegttb",	/* 120 */
+	"aegxoejdtmmrv", "aejhlhfpfwbweh", "aejijtnvnjlf", "aejzdahwbtl",	/* 124 */
+	"aeku", "aeooeu", "aepqhpwunt", "aernwcvnqoqe",	/* 128 */
+	"aerwh", "aesv", "aet", "aetazxsti",	/* 132 */
+	"aeuemhbrat", "aewcxnpkqffcsc", "aeyida", "aezbgcagmrrp",	/* 136 */
+	"af", "afa", "afabswrbr", "afapfsisywdfnf",	/* 140 */
+	"afcapeu", "afdajpdgtnfvw", "afdakepdzxw", "afddxironm",	/* 144 */
+	"affqgbqdmbu", "afftzswhrkc", "afkomgzyzuuwi", "afli",	/* 148 */
+	"afmnbtd", "afngooxtxdncoa", "afnnyjqxaxrb", "afnup",	/* 152 */
+	"afoeyyvxslene", "afovbwhaw", "afp", "afpbwckga",	/* 156 */
+	"afpnnyablos", "afqo", "afrhifomx", "afryjz",	/* 160 */
+	"afu", "afuza", "afwmxu", "afyiwr",	/* 164 */
+	"afypvnadao", "afystviiojvx", "afzaozrqjxnd", "agagun",	/* 168 */
+	"agb", "agbbgucvne", "agbeeflmdidbw", "agbsnfsithwad",	/* 172 */
+	"agbv", "agc", "agcsd", "agdehlqiefh",	/* 176 */
+	"agdpcsrr", "ageqe", "aggii", "agillaghnklvt",	/* 180 */
+	"agimtxt", "agl", "aglwcuiueqio", "agmgy",	/* 184 */
+	"agnqlevdskdkq", "ago", "agplhuovfvrna", "agqmjnishvnq",	/* 188 */
+	"agqynkpfvjit", "agsjix", "agtmromi", "agtybphmu",	/* 192 */
+	"aguaogtcduseei", "aguic", "aguytjckmbl", "agvqdjegqjuqsr",	/* 196 */
+	"agwprdfxkote", "agybygrpdnd", "ah", "ahbhifaktmf",	/* 200 */
+	"ahcct", "ahcsdwuzxmetm", "ahduwpxnwat", "ahefdmovzsj",	/* 204 */
+	"aheoqxi", "ahewgvpsiufqx", "ahf", "ahfqkurbpmnkzk",	/* 208 */
+	"ahhryg", "ahhsabofye", "ahhtnic", "ahlgnmozmmnkn",	/* 212 */
+	"ahlykcsbfezz", "ahmadaj", "ahor", "ahpib",	/* 216 */
+	"ahrkhwhlmdzr", "ahrycyyg", "ahs", "ahtjsnkbpuhw",	/* 220 */
+	"ahvmo", "ahwbwarqo", "ahylzbulai", "ahzhm",	/* 224 */
+	"ahzvwxaxic", "ai", "aiabbdwlhf", "aialwmtykvoz",	/* 228 */
+	"aiamjyqonb", "aicawrwtslqawy", "aig", "aihaiukqsvfylo",	/* 232 */
+	"aihejtm", "aihs", "aij", "aijbmhwsoasy",	/* 236 */
+	"aijebj", "aijjdynfcxgv", "aijsj", "aijxwzfpmr",	/* 240 */
+	"aikdmo", "ailhkdpxhle", "aingte", "aintnw",	/* 244 */
+	"air", "airrvbjwdb", "aitazbtn", "aiuvbj",	/* 248 */
+	"aivfpzdv", "aivraamggx", "aivrmjybsv", "aiwco",	/* 252 */
+	"aiwtcn", "aixlmqiyyutkb", "aiyzuochuktjgr", "aiz",	/* 256 */
+	"aizx", "aj", "ajcebz", "ajexeuma",	/* 260 */
+	"ajfujbdn", "ajirnfcltff", "ajj", "ajlw",	/* 264 */
+	"ajni", "ajogop", "ajpeg", "ajpkohinytla",	/* 268 */
+	"ajpnyfjl", "ajufbpaxc", "ajukmqlxl", "ajusjcrruqqrss",	/* 272 */
+	"ajvn", "ajwnad", "ajxfglmqkd", "ajxxmhjpbst",	/* 276 */
+	"ajy", "ajykjjue", "ajzkohlbnpfn", "ak",	/* 280 */
+	"akbzrbdp", "akcxbwl", "akd", "akdlazy",	/* 284 */
+	"akdwgr", "akdxmrlmj", "akefpqxsrzirma", "akfzpgvbi",	/* 288 */
+	"akgezjlnha", "akhowmxjnmg", "akjqay", "akkadpkznbkjrm",	/* 292 */
+	"aklkzzrtgi", "aklqzw", "aklyfeuf", "akmpovgxd",	/* 296 */
+	"akowhnzwlmbv", "akpca", "akpgjhg", "akpwxtipo",	/* 300 */
+	"akqwfhfoctaka", "akrjrqaqqwqed", "akroj", "akrupa",	/* 304 */
+	"akssyan", "aktpm", "akufanjkxmoxet", "akyaeacuxejm",	/* 308 */
+	"akywfelhvsbwzx", "akzcid", "akztebpoapmapf", "al",	/* 312 */
+	"aleejapuapcyzs", "alfzrlptvhdikn", "algykc", "alh",	/* 316 */
+	"alhwkvvhxdwq", "alipupnolwtat", "alirx", "aliu",	/* 320 */
+	"alkndu", "alllruhtbki", "alnncrnou", "alpgzprsmya",	/* 324 */
+	"alqlsmfpewpo", "alrokxhurell", "alrpbhdkfvd", "als",	/* 328 */
+	"aluqswv", "alv", "alwbqvrib", "alwodnzveidli",	/* 332 */
+	"alybopztfvkmwl", "am", "amafiexdione", "amagl",	/* 336 */
+	"amdtrjkowurky", "amdxqzu", "amepbcmqers", "amgl",	/* 340 */
+	"amglwwmvafic", "amhocvas", "amianjuvwy", "amiwnd",	/* 344 */
+	"amjfbefm", "amjr", "amjyxnjsu", "amk",	/* 348 */
+	"aml", "amlajk", "amlkgaoelk", "amnd",	/* 352 */
+	"amp", "amqumqgepywx", "amtespnycxhrna", "amua",	/* 356 */
+	"amuaclj", "amvjbh", "amvuhhqkzczohh", "amw",	/* 360 */
+	"amxjh", "amxqtdhni", "amyg", "amyic",	/* 364 */
+	"amypheipnls", "an", "anai", "anbvfjavrwpyin",	/* 368 */
+	"anemeaieosxx", "anff", "angdqpdmft", "anguwxzlilk",	/* 372 */
+	"aninljfxl", "anlfb", "anlvcbtkbgqhf", "anptornqlqtpis",	/* 376 */
+	"anpzxxcntx", "anqeya", "anqgigorvtg", "anqw",	/* 380 */
+	"anrkwivghygoiv", "ans", "ant", "anuuwxgudkzdw",	/* 384 */
+	"anwklkxyn", "anxwedh", "anzigluouypzo", "anzrgxko",	/* 388 */
+	"ao", "aoaqfafxmywmkf", "aob", "aobm",	/* 392 */
+	"aocbjq", "aocgprkwsyelk", "aofdiebh", "aofeeilsphqi",	/* 396 */
+	"aogr", "aohfxjunb", "aohshtvbl", "aoipkjqnskqxv",	/* 400 */
+	"aojp", "aojpzddjar", "aokjjy", "aokszgzzmb",	/* 404 */
+	"aolgzpjcanya", "aolismvrqhw", "aoluupkbomvtw", "aongrogeaitfe",	/* 408 */
+	"aonm", "aoobzdhtvvwy", "aooidxlqowtb", "aopphpcemi",	/* 412 */
+	"aoqclsk", "aoqvpwifudrraw", "aordmjaccjfra", "aoreagatoud",	/* 416 */
+	"aovjcrmiu", "aovk", "aovoufl", "aovvtczrc",	/* 420 */
+	"aovxq", "aox", "aoxkxeye", "aoxxzsgg",	/* 424 */
+	"aoyla", "aoymp", "aoz", "aozchu",	/* 428 */
+	"ap", "apdbribsdymcir", "apdq", "apdumidzy",	/* 432 */
+	"apfpjgsiztsi", "apght", "apijmcafchdgjq", "apjqh",	/* 436 */
+	"apmb", "apnbsvx", "apnsa", "apnxqbhntoevwz",	/* 440 */
+	"apoagwnopnc", "apoksoahdk", "apoxufrps", "appxvypap",	/* 444 */
+	"aprkejwd", "aprrxamsubs", "apszjdhexvgrhi", "aptmbojveltgbm",	/* 448 */
+	"aptnbhdxmvrqas", "apuw", "apv", "apvecnkopt",	/* 452 */
+	"apwilmyz", "apxvrkgnsi", "apyotdpei", "apzvkshb",	/* 456 */
+	"aq", "aqaeyen", "aqaxxjbxfl", "aqbacwwhqor",	/* 460 */
+	"aqbj", "aqdayjchue", "aqdekxkzks", "aqdhf",	/* 464 */
+	"aqfhlnmxzcdi", "aqftiwbsvmutcd", "aqfuykqjfa", "aqg",	/* 468 */
+	"aqgqyaujeajf", "aqiy", "aqjlr", "aqjra",	/* 472 */
+	"aqkr", "aql", "aqlduhjid", "aqlhyotznj",	/* 476 */
+	"aqlxubdylgq", "aqm", "aqnwqkbt", "aqozrrayhcz",	/* 480 */
+	"aqspytz", "aqt", "aqtkglsvjlwg", "aqvpvvskgmdzda",	/* 484 */
+	"aqxydxmjjdl", "aqynpq", "aqyom", "aqz",	/* 488 */
+	"aqzfqhxs", "aqzite", "ar", "ara",	/* 492 */
+	"arcpe", "arcuckn", "ardxeq", "ardzqqnzee",	/* 496 */
+	"are", "arghlqfwhnodip", "arhpfrahecaek", "aribks",	/* 500 */
+	"arict", "arikk", "arivnzklsg", "arjvyxuecqlsz",	/* 504 */
+	"ark", "arkhlu", "arlxkk", "armorcdpej",	/* 508 */
+	"armqdlybyplyn", "arms", "arnrjwcdzkwzqo", "arnzzukeimkcc",	/* 512 */
+	"arohoeaiy", "arqeqfnk", "arrbknk", "arrdni",	/* 516 */
+	"arrtztk", "aru", "arucxbw", "arxcppjvzzmw",	/* 520 */
+	"aryswrjcv", "arzbdrgcmfau", "arzhnfvf", "arzuljwsk",	/* 524 */
+	"asalrmfafppxfd", "asbeorwhpaatq", "ascmpo", "asdgbs",	/* 528 */
+	"asfxudbxe", "asgecyh", "asglzmhxtvfdk", "asgshnvjawpg",	/* 532 */
+	"ashlpq", "ashulbmpklnf", "asiozyxlcb", "asiq",	/* 536 */
+	"asitgqqvz", "asizstlxnmldg", "asjizgsn", "aslx",	/* 540 */
+	"asnhn", "asnjeueyiibnr", "aso", "asp",	/* 544 */
+	"asr", "asroqqyd", "assdbsqadkklyr", "asss",	/* 548 */
+	"assujmboblyla", "assvf", "asukvsmwgtztm", "asun",	/* 552 */
+	"asupfarknyyqhu", "asxbiaro", "asxtnyw", "aszjj",	/* 556 */
+	"aszqjyz", "at", "atasxvjfdd", "atbgsbxekj",	/* 560 */
+	"atdxmowgxodbg", "atg", "atgflcfwh", "atghmtgzeb",	/* 564 */
+	"atgs", "ath", "atij", "atkramwifnwq",	/* 568 */
+	"atkwncxsx", "atlzvm", "atmuiszpjkp", "ato",	/* 572 */
+	"atrb", "attdvy", "attt", "atuavewemtrsm",	/* 576 */
+	"atumme", "atur", "atvaeladu", "atvruu",	/* 580 */
+	"atwxgh", "atzyt", "au", "auarghyogn",	/* 584 */
+	"auby", "aucfoymvqzjeeq", "auehjyeax", "auemxrdoay",	/* 588 */
+	"auepbxwj", "aufjgmihgiwou", "augdbjermtl", "augkpkwxbi",	/* 592 */
+	"augpp", "augqmrgdnuuq", "augyhqves", "augyyboevwfgt",	/* 596 */
+	"auhr", "aujwepnim", "aulld", "aumywooz",	/* 600 */
+	"auomaojqsownim", "auoypcs", "auqrwvdyryab", "aurghovsqy",	/* 604 */
+	"aurwo", "ausybq", "autcnzpgn", "autoht",	/* 608 */
+	"auvbuykmd", "auvnrkb", "auvwrpfygwjgen", "auyxu",	/* 612 */
+	"av", "avap", "avbcyego", "avc",	/* 616 */
+	"avcmlnhmcmvwph", "avctrko", "avejfof", "avelskvcusw",	/* 620 */
+	"avfgogievupuf", "avhd", "avhks", "avhnhwgots",	/* 624 */
+	"avhrnkcn", "aviqn", "avknwpc", "avlbkhyycggr",	/* 628 */
+	"avlez", "avlijhsccnty", "avoewxrvewnk", "avpxgzavyb",	/* 632 */
+	"avrtcuwxd", "avsmcb", "avsnfa", "avsoi",	/* 636 */
+	"avstzwuxnyukeb", "avucflgumvboz", "avvm", "avvrcjnpw",	/* 640 */
+	"avytejzij", "avz", "aw", "awadf",	/* 644 */
+	"awaenhasdvibam", "awbxrtjoa", "awckekjgfbhfoz", "awdwwfpce",	/* 648 */
+	"awelebpxvyz", "awfzwgoeyh", "awktgwbrh", "awmr",	/* 652 */
+	"awpceoqjuewew", "awq", "awrlebnfhidt", "awrpp",	/* 656 */
+	"awwaipm", "awwbunk", "awwdaxmozk", "awwvjop",	/* 660 */
+	"awxjflfkvzcf", "awyyehm", "awzpvraboqxrh", "ax",	/* 664 */
+	"axbub", "axcus", "axfpbzmiscjwe", "axgvfbwvwn",	/* 668 */
+	"axifhymfsrre", "axirzlmia", "axjovnoynhxcgp", "axjqcyho",	/* 672 */
+	"axkyzbvmj", "axmatqc", "axpaljfblns", "axpjimge",	/* 676 */
+	"axqclcoujeu", "axqfflmwagnb", "axvbmjcmu", "axxhcrfysw",	/* 680 */
+	"axxwaq", "axzhnlgyw", "axznsdejodm", "ay",	/* 684 */
+	"ayaguqcyf", "ayardvhgchqlwt", "aybkz", "aybsbwif",	/* 688 */
+	"aycixdathok", "ayd", "aydt", "aydvrvlia",	/* 692 */
+	"aye", "ayfle", "ayfpvmjju", "ayfyqo",	/* 696 */
+	"aygjtv", "aygl", "aygse", "aygvbpwqxto",	/* 700 */
+	"ayk", "ayndurltg", "ayqroi", "ayrtxzkgx",	/* 704 */
+	"ayurhakpbgm", "ayv", "ayvhf", "ayvidfhrm",	/* 708 */
+	"ayvs", "ayvz", "ayxdzd", "ayxkgs",	/* 712 */
+	"ayy", "az", "azaeznmkwi", "azbibra",	/* 716 */
+	"azdcmxfes", "azdkvwfwudtabt", "azdrbjhmwqmlxq", "azeu",	/* 720 */
+	"azgiwdgycss", "azhq", "azhxsnqtjp", "azkewersoh",	/* 724 */
+	"azkgkokspcsxyy", "azlldh", "azmbiqx", "aznft",	/* 728 */
+	"azojzmhmvgw", "azqzqvhelmnekn", "azsjaleohobshu", "azunqkleaevv",	/* 732 */
+	"azuvj", "azuvtvfjghuvki", "azvkpvmmqv", "azzcerqz",	/* 736 */
+	"azzeqljhdz", "ba", "baazajzi", "babof",	/* 740 */
+	"badoc", "badrq", "baeaifbpywwns", "baediyfxp",	/* 744 */
+	"baefi", "baeq", "bagqafqf", "bagufnamedqhln",	/* 748 */
+	"bahpxm", "bahqzidllfa", "bahvobkwdidd", "baicsilotqif",	/* 752 */
+	"baixrb", "bajgfdbgxfkrlv", "bakpwahrebmdh", "bakvd",	/* 756 */
+	"bakxb", "balrxviengxws", "bammvjyqvjhx", "bamudyxdpugduv",	/* 760 */
+	"banv", "baotq", "bappr", "bav",	/* 764 */
+	"bawvglqhodxlv", "bawzbmwv", "baxmmnvestev", "baymotz",	/* 768 */
+	"baziywgorpwxn", "bb", "bbaibijfrptw", "bbaqrzywu",	/* 772 */
+	"bbayrlie", "bbbzxvaokcjjn", "bbdkzao", "bbdtbwrrzyp",	/* 776 */
+	"bbetmejicwr", "bbglsgkhhpjgy", "bbh", "bbjmzj",	/* 780 */
+	"bbrciffax", "bbtbfnuuhcind", "bbtjg", "bbtrkn",	/* 784 */
+	"bbuwoojy", "bbvatgkvdogzxw", "bbvkeedqgsf", "bbwoeopqygz",	/* 788 */
+	"bbww", "bbxgulxlql", "bbxy", "bbynjbzndb",	/* 792 */
+	"bbytzrg", "bc", "bca", "bcbogjbvqrza",	/* 796 */
+	"bcbue", "bccuohhjalg", "bcemhv", "bcf",	/* 800 */
+	"bcfqaunfrb", "bcfxvjqoqaccu", "bcgejmayphgj", "bcgfmuo",	/* 804 */
+	"bckeht", "bckldqjbp", "bclavkpvnjmu", "bcleg",	/* 808 */
+	"bclpx", "bcmtpljsczw", "bcnkqlrhjq", "bcnqq",	/* 812 */
+	"bcnzjtwyiyy", "bcosnlgqblp", "bcpkhby", "bcpkng",	/* 816 */
+	"bcqvvjzlegnf", "bcr", "bcrzqzn", "bcsm",	/* 820 */
+	"bcsykbyrcb", "bctpqwmsnvh", "bcuh", "bcvljjb",	/* 824 */
+	"bcvqnowfeg", "bcxd", "bczt", "bd",	/* 828 */
+	"bdacsmnculmcq", "bdcprnlpdkrvl", "bdfnevzpq", "bdhccb",	/* 832 */
+	"bdjilotpkildck", "bdkndvylxuxo", "bdl", "bdlyrtxes",	/* 836 */
+	"bdmfyqwxuf", "bdnbkoe", "bdnejntcdrqve", "bdnufpoxdxux",	/* 840 */
+	"bdpnc", "bdpybuwwa", "bdrapgoaq", "bdrkkeq",	/* 844 */
+	"bdrrborticaxib", "bdseqqylrizsul", "bdtqq", "bdudzrtalhwcap",	/* 848 */
+	"bdui", "bdvuvhboykx", "bdw", "bdycki",	/* 852 */
+	"bdyzmnp", "be", "beagrthtp", "becmmblivgijmo",	/* 856 */
+	"bedwfiaesztb", "beedabmibnzzb", "behahrymnzmlgc", "beilkaiubdvku",	/* 860 */
+	"beivnwe", "bekxbx", "belpl", "belw",	/* 864 */
+	"bemcinpjdq", "beolqvpzfxf", "beoxxqgo", "bepewpnpjatiru",	/* 868 */
+	"bepiorywl", "bepmsur", "beqzxtqbfdr", "berwgeebepz",	/* 872 */
+	"besmlmrphhawpr", "bevbeeofe", "bevz", "bewamoowipmcb",	/* 876 */
+	"bewwuq", "bexgr", "beyxvt", "bezoe",	/* 880 */
+	"bf", "bfasppnandsz", "bfcfvan", "bfdixpxt",	/* 884 */
+	"bfex", "bfezpbufygz", "bff", "bffuecdod",	/* 888 */
+	"bfgndmggnr", "bfgwpr", "bfirbahyc", "bfkjw",	/* 892 */
+	"bfleejld", "bfmoevqtgxr", "bfnotan", "bfocrratxrcfqm",	/* 896 */
+	"bfor", "bfqdcut", "bfqgtpjkndqch", "bfqhuvfmvzyji",	/* 900 */
+	"bfry", "bfud", "bfudo", "bfuelxdm",	/* 904 */
+	"bfulzk", "bfvkfarob", "bfvqoc", "bfx",	/* 908 */
+	"bfxojuzxhqu", "bfyavwepuqps", "bfyeovbyiuw", "bfzsfvxobwhfok",	/* 912 */
+	"bg", "bgaj", "bgakdggioxxtsd", "bganhvs",	/* 916 */
+	"bgaxooeiqvbmtz", "bgc", "bgckovjdh", "bgdfc",	/* 920 */
+	"bgdrlzv", "bgh", "bgiuabechv", "bgjingfapqbe",	/* 924 */
+	"bgld", "bgmlldvucq", "bgn", "bgnhp",	/* 928 */
+	"bgnkeruy", "bgonv", "bgqigoxdfl", "bgqkccdufr",	/* 932 */
+	"bgsdzqeklmuyn", "bgtfqtqzskrp", "bgu", "bgvwfdzhllnt",	/* 936 */
+	"bgwpygmkjptqi", "bgwzmhj", "bgyojmkonvnszc", "bgzyhxcsvstjpq",	/* 940 */
+	"bgzzd", "bh", "bhbidhdvx", "bhcklnltpaetl",	/* 944 */
+	"bhcqzspz", "bhdrcxio", "bhezkqganmkla", "bhftwm",	/* 948 */
+	"bhfukaju", "bhha", "bhjnmrmwuufq", "bhkdpkcplsk",	/* 952 */
+	"bhkmw", "bhmsap", "bhqjgtptbak", "bhrcwalapbux",	/* 956 */
+	"bhsfq", "bhswgx", "bhw", "bhwbjuoghpyphf",	/* 960 */
+	"bhwdvywdg", "bhwtetktboou", "bhyvanlexudizp", "bhyzesomeviv",	/* 964 */
+	"bi", "biamytpegbp", "bic", "bidznmilgb",	/* 968 */
+	"bigmtmnhlhcadk", "bikawv", "bimnkx", "bink",	/* 972 */
+	"biopdqt", "bip", "biph", "biqakmpoxsdtg",	/* 976 */
+	"biqgcz", "biqnbx", "birtinutrik", "bisahszesqkyfq",	/* 980 */
+	"biszstem", "bitbidpy", "biteikqwq", "bivh",	/* 984 */
+	"bivy", "biycafsmilc", "biygzzsmxiy", "biziirfyc",	/* 988 */
+	"bizj", "bizk", "bj", "bja",	/* 992 */
+	"bjbfr", "bjbiknmw", "bjceinmzedt", "bjcopoptplk",	/* 996 */
+	"bjd", "bjdiiqxrit", "bjeapaqyqb", "bjehuqnch",	/* 1000 */
+	};
+uint16_t
+rcu_b(const void * __restrict key, size_t keylen)
+{
+	uint16_t result;
+	static const uint16_t g[2001] = {
+	    0x02f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0342, 0x0000, 0x0000, 0x0000, 0x00d2, 0x0000,
+	    0x0174, 0x0000, 0x0000, 0x025d, 0x0058, 0x032b, 0x0000, 0x0000,
+	    0x0000, 0x029f, 0x0000, 0x0000, 0x00e5, 0x0000, 0x003c, 0x0224,
+	    0x00c1, 0x0000, 0x02f0, 0x0123, 0x0000, 0x0000, 0x015b, 0x01f3,
+	    0x0000, 0x029d, 0x0000, 0x0061, 0x03c4, 0x0316, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0278, 0x02ac, 0x0000, 0x01ec, 0x0000,
+	    0x0000, 0x0000, 0x0099, 0x004c, 0x0000, 0x02a1, 0x039d, 0x0000,
+	    0x0307, 0x020d, 0x03db, 0x0369, 0x0389, 0x035e, 0x03b7, 0x0000,
+	    0x00c0, 0x008b, 0x02e9, 0x0378, 0x0000, 0x0000, 0x0000, 0x002b,
+	    0x023a, 0x0078, 0x00cb, 0x0000, 0x0000, 0x0000, 0x0285, 0x03a7,
+	    0x0000, 0x021d, 0x0052, 0x0000, 0x03de, 0x0205, 0x03c4, 0x0000,
+	    0x0000, 0x0000, 0x02b9, 0x03cf, 0x0352, 0x0000, 0x0000, 0x02cd,
+	    0x00d7, 0x03c6, 0x0000, 0x02da, 0x0000, 0x0153, 0x01b6, 0x02ae,
+	    0x0000, 0x0000, 0x02b6, 0x0000, 0x0000, 0x0377, 0x011f, 0x013c,
+	    0x033b, 0x0000, 0x0029, 0x0000, 0x013b, 0x0073, 0x0157, 0x00be,
+	    0x0000, 0x0383, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x031e, 0x030d, 0x0000, 0x02da, 0x01e9, 0x0000, 0x0000, 0x0000,
+	    0x00b0, 0x032d, 0x034a, 0x03dd, 0x03d7, 0x0022, 0x0023, 0x0203,
+	    0x036d, 0x0000, 0x0169, 0x0385, 0x0000, 0x0000, 0x029d, 0x0000,
+	    0x00a5, 0x0000, 0x0258, 0x0000, 0x0000, 0x0000, 0x0242, 0x0021,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0105, 0x03cd, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0343, 0x025e, 0x0000, 0x0000,
+	    0x0159, 0x01bb, 0x018b, 0x0000, 0x0000, 0x0008, 0x0000, 0x0000,
+	    0x029e, 0x0000, 0x0000, 0x0000, 0x0000, 0x01a5, 0x01c3, 0x016d,
+	    0x0000, 0x0000, 0x0000, 0x03de, 0x0000, 0x01ea, 0x02d6, 0x01ae,
+	    0x0379, 0x0000, 0x0000, 0x0000, 0x012a, 0x0000, 0x009d, 0x0000,
+	    0x0274, 0x012c, 0x01f0, 0x0000, 0x00c5, 0x0000, 0x00d7, 0x010c,
+	    0x0382, 0x0000, 0x0378, 0x018e, 0x004e, 0x02d4, 0x0320, 0x03b7,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x034a, 0x0000,
+	    0x0000, 0x0000, 0x006d, 0x0000, 0x03c9, 0x0000, 0x01d1, 0x0197,
+	    0x00b8, 0x02ab, 0x0000, 0x0000, 0x02ec, 0x0330, 0x0128, 0x0000,
+	    0x0074, 0x03d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0374, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0153, 0x0003, 0x036b, 0x02c9, 0x0073,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02fc,
+	    0x03ac, 0x0168, 0x0000, 0x0247, 0x0000, 0x0165, 0x0108, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00ae, 0x0000, 0x0085, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a9, 0x0302, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0163, 0x0000, 0x0217, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x036a, 0x0026, 0x0125,
+	    0x0000, 0x00fd, 0x0134, 0x0000, 0x0000, 0x0281, 0x0000, 0x0217,
+	    0x0192, 0x0166, 0x00a5, 0x01b2, 0x0000, 0x0000, 0x022f, 0x0304,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0329, 0x01de,
+	    0x02f7, 0x0000, 0x015f, 0x01da, 0x037e, 0x0000, 0x02d4, 0x00a9,
+	    0x0000, 0x03e7, 0x0116, 0x00d7, 0x01b4, 0x0094, 0x0000, 0x0000,
+	    0x0004, 0x03ad, 0x0000, 0x00eb, 0x0000, 0x029c, 0x03df, 0x0000,
+	    0x00ae, 0x0356, 0x0000, 0x0000, 0x0000, 0x0079, 0x0306, 0x0000,
+	    0x0000, 0x0106, 0x0000, 0x0000, 0x0092, 0x0330, 0x0000, 0x00ac,
+	    0x0000, 0x0000, 0x0000, 0x037c, 0x00cf, 0x0004, 0x02e7, 0x0240,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0208, 0x0000, 0x0120,
+	    0x0000, 0x0000, 0x0000, 0x0182, 0x0275, 0x02c1, 0x0029, 0x0000,
+	    0x00df, 0x0000, 0x0000, 0x0000, 0x0000, 0x01a5, 0x0137, 0x0000,
+	    0x00c9, 0x0000, 0x0000, 0x0000, 0x009f, 0x0357, 0x0000, 0x0000,
+	    0x0000, 0x03bb, 0x0000, 0x02df, 0x0000, 0x0383, 0x0088, 0x00f6,
+	    0x0000, 0x0000, 0x03e7, 0x0000, 0x01d8, 0x03a3, 0x0000, 0x00bf,
+	    0x0000, 0x0000, 0x02a5, 0x0139, 0x0351, 0x0149, 0x0000, 0x03e1,
+	    0x01b3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0121, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0185, 0x00ad, 0x0326, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02bf, 0x032f, 0x0354, 0x0000, 0x03d2,
+	    0x0108, 0x0000, 0x0000, 0x0000, 0x0143, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x02c0, 0x0000, 0x0055, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0048, 0x0211, 0x0311, 0x003e, 0x0000,
+	    0x022f, 0x0000, 0x026f, 0x0342, 0x0046, 0x0000, 0x0000, 0x0000,
+	    0x0122, 0x0337, 0x03ab, 0x0000, 0x012b, 0x0000, 0x0000, 0x0000,
+	    0x0270, 0x01c3, 0x0000, 0x020a, 0x0000, 0x0327, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024c, 0x01f3, 0x0175,
+	    0x002f, 0x0000, 0x0000, 0x037a, 0x0000, 0x0313, 0x02c1, 0x03e2,
+	    0x0353, 0x0000, 0x0201, 0x0065, 0x0000, 0x0000, 0x00f6, 0x0000,
+	    0x03a7, 0x0000, 0x008d, 0x0000, 0x02d3, 0x03d7, 0x0000, 0x0000,
+	    0x0000, 0x01b1, 0x0000, 0x0155, 0x0359, 0x00da, 0x0000, 0x0000,
+	    0x0189, 0x0000, 0x0000, 0x01d3, 0x0000, 0x0305, 0x0000, 0x038f,
+	    0x0000, 0x0264, 0x0000, 0x0000, 0x035f, 0x0000, 0x0335, 0x0000,
+	    0x0000, 0x0000, 0x03d3, 0x020b, 0x0000, 0x02ea, 0x0000, 0x0026,
+	    0x0000, 0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0347, 0x0000,
+	    0x0000, 0x0000, 0x00f8, 0x0192, 0x0000, 0x0000, 0x0205, 0x0000,
+	    0x00a6, 0x00ca, 0x0000, 0x02ec, 0x0250, 0x00f3, 0x01ba, 0x0000,
+	    0x0000, 0x0000, 0x0225, 0x0379, 0x02cd, 0x01f5, 0x01c5, 0x01c3,
+	    0x0000, 0x01b9, 0x01dc, 0x0000, 0x0000, 0x0000, 0x010b, 0x02bd,
+	    0x0000, 0x001c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0127, 0x01a1,
+	    0x0185, 0x027b, 0x0133, 0x0296, 0x0360, 0x0064, 0x023a, 0x0288,
+	    0x029a, 0x015d, 0x015a, 0x0364, 0x000f, 0x0000, 0x0258, 0x0000,
+	    0x03ac, 0x0000, 0x02f7, 0x0026, 0x036d, 0x0000, 0x0183, 0x0000,
+	    0x0000, 0x0046, 0x034d, 0x0384, 0x0000, 0x003d, 0x0000, 0x0000,
+	    0x0000, 0x023b, 0x0087, 0x0000, 0x02c8, 0x02b2, 0x0000, 0x0000,
+	    0x0000, 0x0039, 0x0000, 0x004c, 0x00a1, 0x0000, 0x0000, 0x021f,
+	    0x0000, 0x01ff, 0x0151, 0x0000, 0x0150, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0371, 0x0000, 0x0000, 0x003f,
+	    0x0000, 0x0000, 0x0000, 0x03ab, 0x0190, 0x0000, 0x0000, 0x0392,
+	    0x0280, 0x00c1, 0x00e8, 0x0000, 0x0303, 0x0000, 0x0000, 0x012d,
+	    0x01d4, 0x0000, 0x0144, 0x0000, 0x01be, 0x00ff, 0x0000, 0x0000,
+	    0x03aa, 0x009c, 0x0000, 0x0000, 0x00f6, 0x0287, 0x03b0, 0x0000,
+	    0x014b, 0x0269, 0x0000, 0x0000, 0x01c8, 0x0000, 0x025f, 0x0000,
+	    0x0298, 0x017a, 0x00f3, 0x0221, 0x0262, 0x02c7, 0x0063, 0x0000,
+	    0x0000, 0x033d, 0x03b8, 0x00fc, 0x0000, 0x00ab, 0x0144, 0x0000,
+	    0x0000, 0x005c, 0x0000, 0x0000, 0x0000, 0x0352, 0x015d, 0x0334,
+	    0x036c, 0x0000, 0x038d, 0x0375, 0x0000, 0x0000, 0x0347, 0x0000,
+	    0x0000, 0x02f3, 0x0000, 0x0000, 0x02b6, 0x017b, 0x0000, 0x0000,
+	    0x0000, 0x0281, 0x01b7, 0x02df, 0x0358, 0x0232, 0x0000, 0x0187,
+	    0x0000, 0x00ca, 0x0151, 0x0000, 0x0189, 0x0358, 0x0184, 0x0000,
+	    0x0000, 0x021e, 0x0000, 0x0250, 0x0000, 0x0000, 0x0000, 0x013c,
+	    0x011f, 0x0000, 0x03e5, 0x0000, 0x02ab, 0x0162, 0x0000, 0x013c,
+	    0x0309, 0x0000, 0x03d3, 0x0000, 0x0047, 0x0000, 0x0047, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x004c, 0x0316,
+	    0x0160, 0x00e5, 0x0230, 0x03dc, 0x0000, 0x021b, 0x0000, 0x0138,
+	    0x03a1, 0x031f, 0x02bd, 0x03a7, 0x0000, 0x03b3, 0x00bf, 0x0396,
+	    0x0016, 0x00f9, 0x0353, 0x028f, 0x0000, 0x0000, 0x029b, 0x0000,
+	    0x0000, 0x01f5, 0x0346, 0x0097, 0x0059, 0x0186, 0x03b7, 0x0000,
+	    0x0095, 0x03b0, 0x0000, 0x0000, 0x0360, 0x0241, 0x0000, 0x0000,
+	    0x0144, 0x027f, 0x0000, 0x0121, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x027f, 0x00b8, 0x01a1, 0x009e, 0x0000, 0x0000, 0x01f1, 0x0000,
+	    0x0000, 0x0193, 0x0000, 0x01a9, 0x037e, 0x031c, 0x0325, 0x0259,
+	    0x0000, 0x030f, 0x0340, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01e0, 0x00a9, 0x0260, 0x0048, 0x02cc, 0x0336, 0x0000,
+	    0x01b4, 0x003d, 0x0000, 0x0000, 0x0000, 0x0198, 0x0000, 0x0084,
+	    0x0000, 0x0218, 0x02f3, 0x0000, 0x02e7, 0x0252, 0x029c, 0x02de,
+	    0x02e8, 0x0000, 0x007c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0326,
+	    0x0000, 0x03a4, 0x0000, 0x0000, 0x0000, 0x00f9, 0x01a0, 0x0269,
+	    0x0270, 0x00fb, 0x0081, 0x001c, 0x025a, 0x0000, 0x01e0, 0x03d6,
+	    0x0000, 0x00eb, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ed, 0x0000,
+	    0x0000, 0x01ac, 0x03d0, 0x0000, 0x0000, 0x02ce, 0x0000, 0x0000,
+	    0x03c9, 0x0000, 0x02a0, 0x0000, 0x0019, 0x033c, 0x0103, 0x03c9,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0299, 0x03a4, 0x0000, 0x03a4,
+	    0x0000, 0x0273, 0x00f6, 0x0000, 0x024e, 0x0000, 0x03ca, 0x02d9,
+	    0x0000, 0x01ae, 0x0000, 0x0000, 0x034b, 0x0207, 0x0000, 0x0000,
+	    0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x02af, 0x0000, 0x00ee,
+	    0x02ee, 0x0000, 0x0298, 0x0000, 0x0202, 0x0000, 0x0000, 0x0000,
+	    0x03e6, 0x003d, 0x0232, 0x0366, 0x01c2, 0x0000, 0x03ad, 0x01c7,
+	    0x0181, 0x02b9, 0x0000, 0x0000, 0x00b9, 0x03bd, 0x02d5, 0x02ef,
+	    0x0000, 0x01e1, 0x0000, 0x0000, 0x02f3, 0x0258, 0x03e5, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x026a, 0x0000, 0x012d,
+	    0x0388, 0x0000, 0x0000, 0x0308, 0x0000, 0x00aa, 0x0113, 0x0000,
+	    0x0000, 0x017d, 0x02c3, 0x0000, 0x024f, 0x0351, 0x0000, 0x0000,
+	    0x00aa, 0x00f5, 0x0000, 0x0130, 0x0149, 0x0213, 0x0000, 0x038f,
+	    0x0000, 0x0363, 0x0354, 0x01f3, 0x0000, 0x0000, 0x020b, 0x0000,
+	    0x0000, 0x01f9, 0x0000, 0x0257, 0x02d4, 0x0000, 0x033d, 0x0000,
+	    0x0000, 0x018f, 0x03b0, 0x0000, 0x01fd, 0x0317, 0x0000, 0x0000,
+	    0x0000, 0x03c9, 0x0000, 0x0000, 0x00aa, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x03de, 0x00d4, 0x0000, 0x0019, 0x0181, 0x023d,
+	    0x0036, 0x0267, 0x02ef, 0x035a, 0x0000, 0x008f, 0x0000, 0x008d,
+	    0x0000, 0x01eb, 0x01e3, 0x03b4, 0x03bb, 0x026e, 0x0142, 0x0000,
+	    0x00e7, 0x0070, 0x0008, 0x0235, 0x0000, 0x01f7, 0x0000, 0x0000,
+	    0x010d, 0x01ee, 0x0000, 0x03ce, 0x01be, 0x0040, 0x0159, 0x02de,
+	    0x00d1, 0x0000, 0x0345, 0x0000, 0x0000, 0x0000, 0x0000, 0x0093,
+	    0x02de, 0x02d4, 0x015d, 0x0344, 0x0238, 0x02f4, 0x0000, 0x02b2,
+	    0x0000, 0x0000, 0x0000, 0x00a8, 0x0350, 0x0386, 0x032a, 0x0000,
+	    0x0000, 0x0000, 0x0367, 0x02b5, 0x0000, 0x0385, 0x03e5, 0x0000,
+	    0x028e, 0x008d, 0x0000, 0x0342, 0x0203, 0x0170, 0x0086, 0x0000,
+	    0x0000, 0x025d, 0x01bc, 0x0000, 0x0000, 0x0000, 0x0054, 0x0068,
+	    0x0000, 0x0000, 0x02f4, 0x0373, 0x0117, 0x0000, 0x00fd, 0x002a,
+	    0x02f9, 0x0000, 0x035b, 0x0000, 0x0000, 0x0118, 0x01d1, 0x0012,
+	    0x0000, 0x00a4, 0x0000, 0x02ca, 0x0000, 0x02a6, 0x0000, 0x0361,
+	    0x0161, 0x0252, 0x039a, 0x0017, 0x0015, 0x0089, 0x0000, 0x0000,
+	    0x0000, 0x0228, 0x0000, 0x0081, 0x0000, 0x0341, 0x0000, 0x0000,
+	    0x006a, 0x0000, 0x0000, 0x0000, 0x0000, 0x02af, 0x03db, 0x0381,
+	    0x0000, 0x03a2, 0x0104, 0x0000, 0x03db, 0x0174, 0x01bb, 0x00cc,
+	    0x0000, 0x0387, 0x0000, 0x0390, 0x02a5, 0x0000, 0x0000, 0x0072,
+	    0x0000, 0x038f, 0x0000, 0x01ba, 0x0275, 0x00b8, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x005e, 0x0000, 0x0328, 0x00ea, 0x0000, 0x0000,
+	    0x0000, 0x0139, 0x0000, 0x03e6, 0x003e, 0x0000, 0x02f0, 0x0000,
+	    0x0000, 0x013e, 0x036e, 0x0000, 0x01ad, 0x00ea, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x00fe, 0x023e, 0x0000, 0x0000, 0x0000,
+	    0x02fb, 0x0090, 0x00c1, 0x0000, 0x0000, 0x0017, 0x0285, 0x0000,
+	    0x0000, 0x0260, 0x0000, 0x01a4, 0x01aa, 0x0000, 0x0000, 0x0268,
+	    0x0000, 0x0000, 0x0266, 0x01b0, 0x01b5, 0x0000, 0x020c, 0x019e,
+	    0x012b, 0x000b, 0x0000, 0x0180, 0x0027, 0x016b, 0x0095, 0x0000,
+	    0x016c, 0x0000, 0x0000, 0x0080, 0x0000, 0x01c8, 0x01e5, 0x0316,
+	    0x0024, 0x000f, 0x0000, 0x0000, 0x00e4, 0x0000, 0x0000, 0x0000,
+	    0x03c7, 0x0000, 0x0000, 0x0000, 0x007b, 0x0000, 0x027e, 0x0000,
+	    0x0200, 0x0214, 0x0261, 0x0000, 0x0000, 0x0392, 0x0000, 0x031b,
+	    0x0009, 0x0000, 0x0000, 0x0267, 0x0000, 0x0000, 0x02a0, 0x0000,
+	    0x02c8, 0x0000, 0x02e2, 0x0000, 0x0198, 0x0096, 0x0000, 0x011f,
+	    0x0310, 0x00b8, 0x0000, 0x0000, 0x011b, 0x014b, 0x0000, 0x0000,
+	    0x0000, 0x02ca, 0x0394, 0x01b4, 0x0199, 0x01a7, 0x005c, 0x0000,
+	    0x0138, 0x0214, 0x0000, 0x0000, 0x0000, 0x0000, 0x009c, 0x0100,
+	    0x0000, 0x0000, 0x021a, 0x0159, 0x0120, 0x0000, 0x0000, 0x02fb,
+	    0x0036, 0x0000, 0x021c, 0x0000, 0x0257, 0x0000, 0x03d8, 0x0018,
+	    0x00b4, 0x0000, 0x0000, 0x0000, 0x0091, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0365, 0x0000, 0x0365, 0x0000, 0x0000, 0x0000, 0x00b9,
+	    0x02f6, 0x0264, 0x0000, 0x0000, 0x036f, 0x0000, 0x022e, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0289, 0x031c, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x02f5, 0x025c, 0x0290, 0x0000, 0x0000,
+	    0x0000, 0x03da, 0x0000, 0x0000, 0x00c3, 0x0000, 0x03cd, 0x0000,
+	    0x0000, 0x0000, 0x033a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x01d9, 0x0000, 0x0000, 0x0000, 0x03a0, 0x02a0, 0x0000, 0x03d7,
+	    0x0248, 0x0000, 0x0000, 0x03ac, 0x0000, 0x0000, 0x00c2, 0x0000,
+	    0x0000, 0x0141, 0x0000, 0x0070, 0x016f, 0x0160, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0235, 0x0000, 0x0000, 0x0356,
+	    0x0073, 0x0000, 0x0274, 0x000f, 0x024e, 0x0000, 0x02e5, 0x0000,
+	    0x018b, 0x0191, 0x0000, 0x0000, 0x0000, 0x030e, 0x01d2, 0x0000,
+	    0x025f, 0x0394, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x037f, 0x0000, 0x0163, 0x0133, 0x0000, 0x00ec,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0105,
+	    0x0099, 0x00cd, 0x00dc, 0x019a, 0x026f, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0187, 0x02f6, 0x02ec, 0x0000, 0x021c, 0x00d1, 0x00a2,
+	    0x0000, 0x0000, 0x020c, 0x009f, 0x0162, 0x0000, 0x0000, 0x0000,
+	    0x006d, 0x0000, 0x0362, 0x0194, 0x0000, 0x0080, 0x02d2, 0x02e2,
+	    0x0000, 0x00d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x01b9, 0x00e0, 0x0000, 0x0000, 0x03d5, 0x0031, 0x0000,
+	    0x01c8, 0x02c3, 0x02f1, 0x0000, 0x0000, 0x03c5, 0x02a4, 0x02d3,
+	    0x025a, 0x02fb, 0x0000, 0x0000, 0x0000, 0x01da, 0x0000, 0x0000,
+	    0x02e9, 0x039a, 0x0210, 0x0032, 0x02dc, 0x0000, 0x0283, 0x0000,
+	    0x0000, 0x00ec, 0x0215, 0x0020, 0x0000, 0x0000, 0x0000, 0x009c,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x00d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0331, 0x0000, 0x0240, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x03a3, 0x0000, 0x0000, 0x0186,
+	    0x02df, 0x0000, 0x0153, 0x0000, 0x0000, 0x0000, 0x0319, 0x0000,
+	    0x0000, 0x03a4, 0x0000, 0x0000, 0x025e, 0x0000, 0x0000, 0x03cb,
+	    0x00fa, 0x0000, 0x0120, 0x0000, 0x00df, 0x0000, 0x0284, 0x0000,
+	    0x0133, 0x0000, 0x0000, 0x0000, 0x01c9, 0x0000, 0x0000, 0x0000,
+	    0x0232, 0x013f, 0x0000, 0x0246, 0x01a6, 0x0266, 0x022d, 0x0000,
+	    0x0000, 0x0000, 0x01bc, 0x0320, 0x00fa, 0x02bf, 0x0000, 0x03ae,
+	    0x0000, 0x0235, 0x009a, 0x0000, 0x0000, 0x0088, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0135, 0x0000, 0x0355, 0x0000, 0x0000, 0x004a,
+	    0x0000, 0x01e1, 0x0000, 0x0000, 0x0000, 0x02e0, 0x0343, 0x0264,
+	    0x0009, 0x0395, 0x0000, 0x0117, 0x0000, 0x01cd, 0x004f, 0x0000,
+	    0x0000, 0x02dc, 0x035d, 0x0000, 0x0198, 0x0249, 0x03d6, 0x0308,
+	    0x01ba, 0x0000, 0x01ba, 0x0000, 0x0000, 0x0000, 0x0314, 0x02ad,
+	    0x0089, 0x0000, 0x0000, 0x015a, 0x0364, 0x020c, 0x0222, 0x0000,
+	    0x0320, 0x0000, 0x005c, 0x0000, 0x00ea, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02a8, 0x02ca, 0x0336, 0x0280, 0x0000, 0x0000,
+	    0x0000, 0x0056, 0x01ff, 0x01dc, 0x0230, 0x0000, 0x0000, 0x0000,
+	    0x0219, 0x01fe, 0x0367, 0x0000, 0x0000, 0x03bd, 0x0000, 0x0055,
+	    0x0000, 0x0000, 0x0039, 0x0000, 0x0000, 0x0011, 0x0000, 0x001d,
+	    0x0000, 0x0000, 0x0000, 0x0101, 0x0323, 0x0000, 0x0000, 0x03d1,
+	    0x02db, 0x0000, 0x0000, 0x0000, 0x01f0, 0x0000, 0x0062, 0x0000,
+	    0x0109, 0x026d, 0x00db, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0273, 0x01e5, 0x0000, 0x0000, 0x0000, 0x0076,
+	    0x0000, 0x019b, 0x0000, 0x0000, 0x0291, 0x0000, 0x015f, 0x0093,
+	    0x0000, 0x0000, 0x0000, 0x030c, 0x0000, 0x03c6, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x038b, 0x0237, 0x0360, 0x0000, 0x0000, 0x0000,
+	    0x01c3, 0x0000, 0x0170, 0x027f, 0x03e6, 0x01f2, 0x0000, 0x0314,
+	    0x01e6, 0x038f, 0x0209, 0x0000, 0x0000, 0x0125, 0x0000, 0x034d,
+	    0x0000, 0x0036, 0x0000, 0x0000, 0x0229, 0x00d9, 0x0299, 0x0000,
+	    0x0000, 0x0240, 0x0000, 0x0256, 0x01c4, 0x0110, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x02a2, 0x0000, 0x0000, 0x027a, 0x0000, 0x0397,
+	    0x0188, 0x01a8, 0x00af, 0x004a, 0x022d, 0x0360, 0x0000, 0x02ef,
+	    0x0000, 0x0000, 0x01a7, 0x0000, 0x0000, 0x0000, 0x0270, 0x008d,
+	    0x0143, 0x0000, 0x026c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x019a, 0x012e, 0x0000, 0x001f, 0x01f4, 0x0000, 0x0000, 0x0000,
+	    0x0318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x0000, 0x0229, 0x0253, 0x022c, 0x0000, 0x02b7, 0x0150, 0x00c8,
+	    0x005e, 0x021c, 0x0000, 0x0330, 0x0000, 0x00f3, 0x0000, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0040, 0x0000, 0x0000, 0x0345, 0x0000,
+	    0x0000, 0x0000, 0x0000, 0x0000, 0x015e, 0x0347, 0x0000, 0x0000,
+	    0x0317, 0x0000, 0x0000, 0x01d9, 0x0339, 0x00a6, 0x0196, 0x0000,
+	    0x0000, 0x014c, 0x0000, 0x028c, 0x03bf, 0x0000, 0x00c2, 0x0234,
+	    0x0000, 0x0000, 0x02f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	    0x008a, 0x0025, 0x01e1, 0x0000, 0x0000, 0x03b1, 0x0281, 0x0000,
+	    0x0000, 0x02c8, 0x02d1, 0x0203, 0x0000, 0x017b, 0x0000, 0x0000,
+	    0x0000,
+	};
+	uint16_t h[6];
+
+	mi_vector_hash(key, keylen, UINT32_C(0x238e1f29), (uint32_t *)h);
+
+	h[0] = h[0] % 2001;
+	h[1] = h[1] % 2001;
+	result = (g[h[0]] + g[h[1]]) % 1000;
+	return (strcmp(rcu_b_keys[result], key) == 0) ? result : (uint16_t)-1;
+}
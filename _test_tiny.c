@@ -0,0 +1,4665 @@
+/* generated with rurban/nbperf 08a5797  _words1000 */
+/* seed[0]: 0, seed[1]: 0 */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+uint32_t
+hash(const void * __restrict key, size_t keylen)
+{
+	switch (keylen) {
+	case 2:
+		switch (((const uint8_t *)key)[1]) {
+		case 'a':
+			if (memcmp(key, "aa", 2) == 0)
+				return 0;
+			if (memcmp(key, "ba", 2) == 0)
+				return 737;
+			return (uint32_t)-1;
+		case 'b':
+			if (memcmp(key, "ab", 2) == 0)
+				return 27;
+			if (memcmp(key, "bb", 2) == 0)
+				return 769;
+			return (uint32_t)-1;
+		case 'c':
+			if (memcmp(key, "ac", 2) == 0)
+				return 52;
+			if (memcmp(key, "bc", 2) == 0)
+				return 793;
+			return (uint32_t)-1;
+		case 'd':
+			if (memcmp(key, "ad", 2) == 0)
+				return 79;
+			if (memcmp(key, "bd", 2) == 0)
+				return 827;
+			return (uint32_t)-1;
+		case 'e':
+			if (memcmp(key, "be", 2) == 0)
+				return 853;
+			return (uint32_t)-1;
+		case 'f':
+			if (memcmp(key, "af", 2) == 0)
+				return 136;
+			if (memcmp(key, "bf", 2) == 0)
+				return 880;
+			return (uint32_t)-1;
+		case 'g':
+			if (memcmp(key, "bg", 2) == 0)
+				return 912;
+			return (uint32_t)-1;
+		case 'h':
+			if (memcmp(key, "ah", 2) == 0)
+				return 198;
+			if (memcmp(key, "bh", 2) == 0)
+				return 941;
+			return (uint32_t)-1;
+		case 'i':
+			if (memcmp(key, "ai", 2) == 0)
+				return 225;
+			if (memcmp(key, "bi", 2) == 0)
+				return 964;
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, "aj", 2) == 0)
+				return 257;
+			if (memcmp(key, "bj", 2) == 0)
+				return 990;
+			return (uint32_t)-1;
+		case 'k':
+			if (memcmp(key, "ak", 2) == 0)
+				return 279;
+			return (uint32_t)-1;
+		case 'l':
+			if (memcmp(key, "al", 2) == 0)
+				return 311;
+			return (uint32_t)-1;
+		case 'm':
+			if (memcmp(key, "am", 2) == 0)
+				return 333;
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, "an", 2) == 0)
+				return 365;
+			return (uint32_t)-1;
+		case 'o':
+			if (memcmp(key, "ao", 2) == 0)
+				return 388;
+			return (uint32_t)-1;
+		case 'p':
+			if (memcmp(key, "ap", 2) == 0)
+				return 428;
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, "aq", 2) == 0)
+				return 456;
+			return (uint32_t)-1;
+		case 'r':
+			if (memcmp(key, "ar", 2) == 0)
+				return 490;
+			return (uint32_t)-1;
+		case 't':
+			if (memcmp(key, "at", 2) == 0)
+				return 557;
+			return (uint32_t)-1;
+		case 'u':
+			if (memcmp(key, "au", 2) == 0)
+				return 582;
+			return (uint32_t)-1;
+		case 'v':
+			if (memcmp(key, "av", 2) == 0)
+				return 612;
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, "aw", 2) == 0)
+				return 642;
+			return (uint32_t)-1;
+		case 'x':
+			if (memcmp(key, "ax", 2) == 0)
+				return 663;
+			return (uint32_t)-1;
+		case 'y':
+			if (memcmp(key, "ay", 2) == 0)
+				return 683;
+			return (uint32_t)-1;
+		case 'z':
+			if (memcmp(key, "az", 2) == 0)
+				return 713;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 3:
+		switch (((const uint8_t *)key)[2]) {
+		case 'a':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "aba", 3) == 0)
+					return 28;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "aca", 3) == 0)
+					return 53;
+				if (memcmp(key, "bca", 3) == 0)
+					return 794;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afa", 3) == 0)
+					return 137;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "bja", 3) == 0)
+					return 991;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "ara", 3) == 0)
+					return 491;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'b':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abb", 3) == 0)
+					return 29;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agb", 3) == 0)
+					return 168;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aob", 3) == 0)
+					return 390;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'c':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "aec", 3) == 0)
+					return 112;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agc", 3) == 0)
+					return 173;
+				if (memcmp(key, "bgc", 3) == 0)
+					return 917;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "bic", 3) == 0)
+					return 966;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avc", 3) == 0)
+					return 615;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'd':
+			switch (((const uint8_t *)key)[1]) {
+			case 'j':
+				if (memcmp(key, "bjd", 3) == 0)
+					return 996;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "akd", 3) == 0)
+					return 282;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "ayd", 3) == 0)
+					return 689;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'e':
+			if (memcmp(key, "are", 3) == 0)
+				return 496;
+			if (memcmp(key, "aye", 3) == 0)
+				return 692;
+			return (uint32_t)-1;
+		case 'f':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "bcf", 3) == 0)
+					return 799;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bff", 3) == 0)
+					return 886;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "ahf", 3) == 0)
+					return 206;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[1]) {
+			case 'i':
+				if (memcmp(key, "aig", 3) == 0)
+					return 230;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqg", 3) == 0)
+					return 467;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atg", 3) == 0)
+					return 561;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "bbh", 3) == 0)
+					return 778;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgh", 3) == 0)
+					return 921;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alh", 3) == 0)
+					return 315;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "ath", 3) == 0)
+					return 565;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, "aij", 3) == 0)
+				return 234;
+			if (memcmp(key, "ajj", 3) == 0)
+				return 262;
+			return (uint32_t)-1;
+		case 'k':
+			switch (((const uint8_t *)key)[1]) {
+			case 'm':
+				if (memcmp(key, "amk", 3) == 0)
+					return 347;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "ark", 3) == 0)
+					return 504;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "ayk", 3) == 0)
+					return 700;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "bdl", 3) == 0)
+					return 834;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agl", 3) == 0)
+					return 181;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "aml", 3) == 0)
+					return 348;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aql", 3) == 0)
+					return 473;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			if (memcmp(key, "aqm", 3) == 0)
+				return 477;
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, "bgn", 3) == 0)
+				return 926;
+			return (uint32_t)-1;
+		case 'o':
+			switch (((const uint8_t *)key)[1]) {
+			case 'g':
+				if (memcmp(key, "ago", 3) == 0)
+					return 185;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "aso", 3) == 0)
+					return 542;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "ato", 3) == 0)
+					return 571;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'p':
+			switch (((const uint8_t *)key)[1]) {
+			case 'f':
+				if (memcmp(key, "afp", 3) == 0)
+					return 154;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "bip", 3) == 0)
+					return 973;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amp", 3) == 0)
+					return 352;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asp", 3) == 0)
+					return 543;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, "acq", 3) == 0)
+				return 68;
+			if (memcmp(key, "awq", 3) == 0)
+				return 653;
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "bcr", 3) == 0)
+					return 817;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "air", 3) == 0)
+					return 244;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asr", 3) == 0)
+					return 544;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			switch (((const uint8_t *)key)[1]) {
+			case 'h':
+				if (memcmp(key, "ahs", 3) == 0)
+					return 218;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "als", 3) == 0)
+					return 327;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "ans", 3) == 0)
+					return 381;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 't':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "aet", 3) == 0)
+					return 130;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "ant", 3) == 0)
+					return 382;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqt", 3) == 0)
+					return 481;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'u':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aau", 3) == 0)
+					return 21;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "adu", 3) == 0)
+					return 100;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afu", 3) == 0)
+					return 160;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgu", 3) == 0)
+					return 934;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "aru", 3) == 0)
+					return 517;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "bav", 3) == 0)
+					return 763;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alv", 3) == 0)
+					return 329;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apv", 3) == 0)
+					return 450;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "ayv", 3) == 0)
+					return 705;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "bdw", 3) == 0)
+					return 850;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bhw", 3) == 0)
+					return 958;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amw", 3) == 0)
+					return 359;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'x':
+			if (memcmp(key, "aox", 3) == 0)
+				return 421;
+			if (memcmp(key, "bfx", 3) == 0)
+				return 907;
+			return (uint32_t)-1;
+		case 'y':
+			if (memcmp(key, "ajy", 3) == 0)
+				return 276;
+			if (memcmp(key, "ayy", 3) == 0)
+				return 712;
+			return (uint32_t)-1;
+		case 'z':
+			switch (((const uint8_t *)key)[1]) {
+			case 'i':
+				if (memcmp(key, "aiz", 3) == 0)
+					return 255;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aoz", 3) == 0)
+					return 426;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqz", 3) == 0)
+					return 487;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avz", 3) == 0)
+					return 641;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 4:
+		switch (((const uint8_t *)key)[2]) {
+		case 'a':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "acat", 4) == 0)
+					return 54;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgaj", 4) == 0)
+					return 913;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anai", 4) == 0)
+					return 366;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avap", 4) == 0)
+					return 613;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'b':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "adbb", 4) == 0)
+					return 80;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agbv", 4) == 0)
+					return 172;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aobm", 4) == 0)
+					return 391;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqbj", 4) == 0)
+					return 460;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "auby", 4) == 0)
+					return 584;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'd':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "aedk", 4) == 0)
+					return 115;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apdq", 4) == 0)
+					return 430;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "aydt", 4) == 0)
+					return 690;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'e':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "baeq", 4) == 0)
+					return 745;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfex", 4) == 0)
+					return 884;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azeu", 4) == 0)
+					return 719;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'f':
+			if (memcmp(key, "anff", 4) == 0)
+				return 369;
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "acgq", 4) == 0)
+					return 59;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amgl", 4) == 0)
+					return 339;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aogr", 4) == 0)
+					return 396;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atgs", 4) == 0)
+					return 564;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "aygl", 4) == 0)
+					return 697;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "adhh", 4) == 0)
+					return 88;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bhha", 4) == 0)
+					return 949;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aihs", 4) == 0)
+					return 233;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "auhr", 4) == 0)
+					return 596;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avhd", 4) == 0)
+					return 621;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azhq", 4) == 0)
+					return 721;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'i':
+			switch (((const uint8_t *)key)[1]) {
+			case 'l':
+				if (memcmp(key, "aliu", 4) == 0)
+					return 319;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqiy", 4) == 0)
+					return 469;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asiq", 4) == 0)
+					return 535;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atij", 4) == 0)
+					return 566;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, "amjr", 4) == 0)
+				return 345;
+			if (memcmp(key, "aojp", 4) == 0)
+				return 400;
+			return (uint32_t)-1;
+		case 'k':
+			if (memcmp(key, "aeku", 4) == 0)
+				return 124;
+			if (memcmp(key, "aqkr", 4) == 0)
+				return 472;
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "belw", 4) == 0)
+					return 863;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afli", 4) == 0)
+					return 147;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgld", 4) == 0)
+					return 924;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "ajlw", 4) == 0)
+					return 263;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "aslx", 4) == 0)
+					return 539;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			switch (((const uint8_t *)key)[1]) {
+			case 'p':
+				if (memcmp(key, "apmb", 4) == 0)
+					return 436;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arms", 4) == 0)
+					return 509;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "awmr", 4) == 0)
+					return 651;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'n':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "banv", 4) == 0)
+					return 760;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "bink", 4) == 0)
+					return 971;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "ajni", 4) == 0)
+					return 264;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amnd", 4) == 0)
+					return 351;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aonm", 4) == 0)
+					return 408;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'o':
+			if (memcmp(key, "ahor", 4) == 0)
+				return 214;
+			if (memcmp(key, "bfor", 4) == 0)
+				return 896;
+			return (uint32_t)-1;
+		case 'p':
+			if (memcmp(key, "biph", 4) == 0)
+				return 974;
+			return (uint32_t)-1;
+		case 'q':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abqg", 4) == 0)
+					return 42;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "acqg", 4) == 0)
+					return 69;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afqo", 4) == 0)
+					return 157;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anqw", 4) == 0)
+					return 379;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abri", 4) == 0)
+					return 44;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfry", 4) == 0)
+					return 900;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atrb", 4) == 0)
+					return 572;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "bcsm", 4) == 0)
+					return 819;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "aesv", 4) == 0)
+					return 129;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asss", 4) == 0)
+					return 547;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 't':
+			if (memcmp(key, "attt", 4) == 0)
+				return 574;
+			return (uint32_t)-1;
+		case 'u':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "bcuh", 4) == 0)
+					return 822;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "bdui", 4) == 0)
+					return 848;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfud", 4) == 0)
+					return 901;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amua", 4) == 0)
+					return 355;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apuw", 4) == 0)
+					return 449;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asun", 4) == 0)
+					return 551;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atur", 4) == 0)
+					return 577;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[3]) {
+			case 'h':
+				if (memcmp(key, "bivh", 4) == 0)
+					return 983;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "aovk", 4) == 0)
+					return 417;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "avvm", 4) == 0)
+					return 638;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "ajvn", 4) == 0)
+					return 272;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "ayvs", 4) == 0)
+					return 708;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "bivy", 4) == 0)
+					return 984;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "ayvz", 4) == 0)
+					return 709;
+				if (memcmp(key, "bevz", 4) == 0)
+					return 874;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, "adwf", 4) == 0)
+				return 104;
+			if (memcmp(key, "bbww", 4) == 0)
+				return 788;
+			return (uint32_t)-1;
+		case 'x':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aaxw", 4) == 0)
+					return 26;
+				return (uint32_t)-1;
+			case 'b':
+				if (memcmp(key, "bbxy", 4) == 0)
+					return 790;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "bcxd", 4) == 0)
+					return 825;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'y':
+			if (memcmp(key, "amyg", 4) == 0)
+				return 362;
+			return (uint32_t)-1;
+		case 'z':
+			switch (((const uint8_t *)key)[3]) {
+			case 'j':
+				if (memcmp(key, "bizj", 4) == 0)
+					return 988;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "bizk", 4) == 0)
+					return 989;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "bczt", 4) == 0)
+					return 826;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "aizx", 4) == 0)
+					return 256;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 5:
+		switch (((const uint8_t *)key)[1]) {
+		case 'a':
+			switch (((const uint8_t *)key)[3]) {
+			case 'f':
+				if (memcmp(key, "baefi", 5) == 0)
+					return 744;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "babof", 5) == 0)
+					return 739;
+				if (memcmp(key, "badoc", 5) == 0)
+					return 740;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "bappr", 5) == 0)
+					return 762;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "badrq", 5) == 0)
+					return 741;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "baotq", 5) == 0)
+					return 761;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "bakvd", 5) == 0)
+					return 755;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "bakxb", 5) == 0)
+					return 756;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'b':
+			switch (((const uint8_t *)key)[2]) {
+			case 'd':
+				if (memcmp(key, "abded", 5) == 0)
+					return 32;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "bbtjg", 5) == 0)
+					return 782;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "abzjq", 5) == 0)
+					return 51;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'c':
+			switch (((const uint8_t *)key)[3]) {
+			case 'e':
+				if (memcmp(key, "bcleg", 5) == 0)
+					return 807;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "bclpx", 5) == 0)
+					return 808;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "bcnqq", 5) == 0)
+					return 811;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "bcbue", 5) == 0)
+					return 796;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "aclya", 5) == 0)
+					return 65;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'd':
+			switch (((const uint8_t *)key)[2]) {
+			case 'c':
+				if (memcmp(key, "adcxr", 5) == 0)
+					return 82;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "adfwg", 5) == 0)
+					return 83;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "adgnv", 5) == 0)
+					return 85;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "bdpnc", 5) == 0)
+					return 840;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "bdtqq", 5) == 0)
+					return 846;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "advzb", 5) == 0)
+					return 103;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'e':
+			switch (((const uint8_t *)key)[2]) {
+			case 'a':
+				if (memcmp(key, "aeabb", 5) == 0)
+					return 108;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "belpl", 5) == 0)
+					return 862;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "aerwh", 5) == 0)
+					return 128;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "bexgr", 5) == 0)
+					return 877;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "bezoe", 5) == 0)
+					return 879;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'f':
+			switch (((const uint8_t *)key)[3]) {
+			case 'd':
+				if (memcmp(key, "bfudo", 5) == 0)
+					return 902;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "bfkjw", 5) == 0)
+					return 891;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "afnup", 5) == 0)
+					return 151;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "afuza", 5) == 0)
+					return 161;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[2]) {
+			case 'c':
+				if (memcmp(key, "agcsd", 5) == 0)
+					return 174;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "bgdfc", 5) == 0)
+					return 919;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "ageqe", 5) == 0)
+					return 177;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "aggii", 5) == 0)
+					return 178;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "agmgy", 5) == 0)
+					return 183;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "bgnhp", 5) == 0)
+					return 927;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "bgonv", 5) == 0)
+					return 929;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "aguic", 5) == 0)
+					return 193;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "bgzzd", 5) == 0)
+					return 940;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			switch (((const uint8_t *)key)[2]) {
+			case 'c':
+				if (memcmp(key, "ahcct", 5) == 0)
+					return 200;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "bhkmw", 5) == 0)
+					return 952;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "ahpib", 5) == 0)
+					return 215;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "bhsfq", 5) == 0)
+					return 956;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "ahvmo", 5) == 0)
+					return 220;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "ahzhm", 5) == 0)
+					return 223;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'i':
+			if (memcmp(key, "aijsj", 5) == 0)
+				return 238;
+			if (memcmp(key, "aiwco", 5) == 0)
+				return 251;
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, "ajpeg", 5) == 0)
+				return 266;
+			if (memcmp(key, "bjbfr", 5) == 0)
+				return 992;
+			return (uint32_t)-1;
+		case 'k':
+			switch (((const uint8_t *)key)[2]) {
+			case 'p':
+				if (memcmp(key, "akpca", 5) == 0)
+					return 297;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "akroj", 5) == 0)
+					return 302;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "aktpm", 5) == 0)
+					return 305;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'l':
+			if (memcmp(key, "alirx", 5) == 0)
+				return 318;
+			return (uint32_t)-1;
+		case 'm':
+			switch (((const uint8_t *)key)[2]) {
+			case 'a':
+				if (memcmp(key, "amagl", 5) == 0)
+					return 335;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "amxjh", 5) == 0)
+					return 360;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "amyic", 5) == 0)
+					return 363;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, "anlfb", 5) == 0)
+				return 373;
+			return (uint32_t)-1;
+		case 'o':
+			switch (((const uint8_t *)key)[3]) {
+			case 'l':
+				if (memcmp(key, "aoyla", 5) == 0)
+					return 424;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "aoymp", 5) == 0)
+					return 425;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "aovxq", 5) == 0)
+					return 420;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'p':
+			switch (((const uint8_t *)key)[2]) {
+			case 'g':
+				if (memcmp(key, "apght", 5) == 0)
+					return 433;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "apjqh", 5) == 0)
+					return 435;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "apnsa", 5) == 0)
+					return 438;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'q':
+			switch (((const uint8_t *)key)[3]) {
+			case 'h':
+				if (memcmp(key, "aqdhf", 5) == 0)
+					return 463;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "aqjlr", 5) == 0)
+					return 470;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aqyom", 5) == 0)
+					return 486;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "aqjra", 5) == 0)
+					return 471;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[3]) {
+			case 'c':
+				if (memcmp(key, "arict", 5) == 0)
+					return 500;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "arikk", 5) == 0)
+					return 501;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "arcpe", 5) == 0)
+					return 492;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			switch (((const uint8_t *)key)[2]) {
+			case 'n':
+				if (memcmp(key, "asnhn", 5) == 0)
+					return 540;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "assvf", 5) == 0)
+					return 549;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "aszjj", 5) == 0)
+					return 555;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 't':
+			if (memcmp(key, "atzyt", 5) == 0)
+				return 581;
+			return (uint32_t)-1;
+		case 'u':
+			switch (((const uint8_t *)key)[2]) {
+			case 'g':
+				if (memcmp(key, "augpp", 5) == 0)
+					return 592;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "aulld", 5) == 0)
+					return 598;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "aurwo", 5) == 0)
+					return 604;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "auyxu", 5) == 0)
+					return 611;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[2]) {
+			case 'h':
+				if (memcmp(key, "avhks", 5) == 0)
+					return 622;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aviqn", 5) == 0)
+					return 625;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "avlez", 5) == 0)
+					return 628;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "avsoi", 5) == 0)
+					return 635;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, "awadf", 5) == 0)
+				return 643;
+			if (memcmp(key, "awrpp", 5) == 0)
+				return 655;
+			return (uint32_t)-1;
+		case 'x':
+			if (memcmp(key, "axbub", 5) == 0)
+				return 664;
+			if (memcmp(key, "axcus", 5) == 0)
+				return 665;
+			return (uint32_t)-1;
+		case 'y':
+			switch (((const uint8_t *)key)[2]) {
+			case 'b':
+				if (memcmp(key, "aybkz", 5) == 0)
+					return 686;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "ayfle", 5) == 0)
+					return 693;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "aygse", 5) == 0)
+					return 698;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "ayvhf", 5) == 0)
+					return 706;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'z':
+			if (memcmp(key, "aznft", 5) == 0)
+				return 727;
+			if (memcmp(key, "azuvj", 5) == 0)
+				return 732;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 6:
+		switch (((const uint8_t *)key)[2]) {
+		case 'a':
+			if (memcmp(key, "aaamvo", 6) == 0)
+				return 1;
+			if (memcmp(key, "agagun", 6) == 0)
+				return 167;
+			return (uint32_t)-1;
+		case 'c':
+			switch (((const uint8_t *)key)[1]) {
+			case 'j':
+				if (memcmp(key, "ajcebz", 6) == 0)
+					return 258;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aocbjq", 6) == 0)
+					return 392;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "ascmpo", 6) == 0)
+					return 526;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'd':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abdvzz", 6) == 0)
+					return 34;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "akdwgr", 6) == 0)
+					return 284;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "ardxeq", 6) == 0)
+					return 494;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asdgbs", 6) == 0)
+					return 527;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'e':
+			if (memcmp(key, "bcemhv", 6) == 0)
+				return 798;
+			return (uint32_t)-1;
+		case 'f':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aafkxt", 6) == 0)
+					return 8;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bhftwm", 6) == 0)
+					return 947;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "ayfyqo", 6) == 0)
+					return 695;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "aegttb", 6) == 0)
+					return 119;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfgwpr", 6) == 0)
+					return 889;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "algykc", 6) == 0)
+					return 314;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "aygjtv", 6) == 0)
+					return 696;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			switch (((const uint8_t *)key)[3]) {
+			case 'c':
+				if (memcmp(key, "bdhccb", 6) == 0)
+					return 831;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "ashlpq", 6) == 0)
+					return 532;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "bahpxm", 6) == 0)
+					return 748;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aahqwu", 6) == 0)
+					return 13;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "ahhryg", 6) == 0)
+					return 208;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'i':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "baixrb", 6) == 0)
+					return 752;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amiwnd", 6) == 0)
+					return 343;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "aribks", 6) == 0)
+					return 499;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'j':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "bbjmzj", 6) == 0)
+					return 779;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aijebj", 6) == 0)
+					return 236;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "akjqay", 6) == 0)
+					return 290;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'k':
+			switch (((const uint8_t *)key)[3]) {
+			case 'a':
+				if (memcmp(key, "bikawv", 6) == 0)
+					return 969;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "aikdmo", 6) == 0)
+					return 240;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "bckeht", 6) == 0)
+					return 804;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "aakgie", 6) == 0)
+					return 15;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "arkhlu", 6) == 0)
+					return 505;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "aokjjy", 6) == 0)
+					return 402;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "alkndu", 6) == 0)
+					return 320;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "bekxbx", 6) == 0)
+					return 861;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[1]) {
+			case 'k':
+				if (memcmp(key, "aklqzw", 6) == 0)
+					return 293;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amlajk", 6) == 0)
+					return 349;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arlxkk", 6) == 0)
+					return 506;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atlzvm", 6) == 0)
+					return 569;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azlldh", 6) == 0)
+					return 725;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			if (memcmp(key, "bhmsap", 6) == 0)
+				return 953;
+			if (memcmp(key, "bimnkx", 6) == 0)
+				return 970;
+			return (uint32_t)-1;
+		case 'n':
+			switch (((const uint8_t *)key)[3]) {
+			case 'g':
+				if (memcmp(key, "aingte", 6) == 0)
+					return 242;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aanimh", 6) == 0)
+					return 19;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "aintnw", 6) == 0)
+					return 243;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'o':
+			if (memcmp(key, "aeooeu", 6) == 0)
+				return 125;
+			if (memcmp(key, "ajogop", 6) == 0)
+				return 265;
+			return (uint32_t)-1;
+		case 'p':
+			if (memcmp(key, "bcpkng", 6) == 0)
+				return 815;
+			return (uint32_t)-1;
+		case 'q':
+			switch (((const uint8_t *)key)[3]) {
+			case 'e':
+				if (memcmp(key, "anqeya", 6) == 0)
+					return 377;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "biqgcz", 6) == 0)
+					return 976;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "biqnbx", 6) == 0)
+					return 977;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "ayqroi", 6) == 0)
+					return 702;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abrbqe", 6) == 0)
+					return 43;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afryjz", 6) == 0)
+					return 159;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "akrupa", 6) == 0)
+					return 303;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arrdni", 6) == 0)
+					return 515;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			switch (((const uint8_t *)key)[3]) {
+			case 'j':
+				if (memcmp(key, "agsjix", 6) == 0)
+					return 189;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "avsmcb", 6) == 0)
+					return 633;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "avsnfa", 6) == 0)
+					return 634;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "bhswgx", 6) == 0)
+					return 957;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "ausybq", 6) == 0)
+					return 605;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 't':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "bbtrkn", 6) == 0)
+					return 783;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "actluu", 6) == 0)
+					return 72;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "attdvy", 6) == 0)
+					return 573;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "autoht", 6) == 0)
+					return 607;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'u':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abucje", 6) == 0)
+					return 48;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfulzk", 6) == 0)
+					return 904;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aiuvbj", 6) == 0)
+					return 247;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atumme", 6) == 0)
+					return 576;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[1]) {
+			case 'f':
+				if (memcmp(key, "bfvqoc", 6) == 0)
+					return 906;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amvjbh", 6) == 0)
+					return 357;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atvruu", 6) == 0)
+					return 579;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "bewwuq", 6) == 0)
+					return 876;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afwmxu", 6) == 0)
+					return 162;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aiwtcn", 6) == 0)
+					return 252;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "ajwnad", 6) == 0)
+					return 273;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atwxgh", 6) == 0)
+					return 580;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'x':
+			switch (((const uint8_t *)key)[3]) {
+			case 'd':
+				if (memcmp(key, "ayxdzd", 6) == 0)
+					return 710;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "ayxkgs", 6) == 0)
+					return 711;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "axxwaq", 6) == 0)
+					return 680;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'y':
+			switch (((const uint8_t *)key)[4]) {
+			case 'd':
+				if (memcmp(key, "aeyida", 6) == 0)
+					return 134;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "bdycki", 6) == 0)
+					return 851;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "aqynpq", 6) == 0)
+					return 485;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "beyxvt", 6) == 0)
+					return 878;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "afyiwr", 6) == 0)
+					return 163;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'z':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "adzrfo", 6) == 0)
+					return 107;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "akzcid", 6) == 0)
+					return 309;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aozchu", 6) == 0)
+					return 427;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqzite", 6) == 0)
+					return 489;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 7:
+		switch (((const uint8_t *)key)[6]) {
+		case 'a':
+			if (memcmp(key, "azbibra", 7) == 0)
+				return 715;
+			return (uint32_t)-1;
+		case 'b':
+			if (memcmp(key, "auvnrkb", 7) == 0)
+				return 609;
+			if (memcmp(key, "bcvljjb", 7) == 0)
+				return 823;
+			return (uint32_t)-1;
+		case 'c':
+			switch (((const uint8_t *)key)[1]) {
+			case 'h':
+				if (memcmp(key, "ahhtnic", 7) == 0)
+					return 210;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avknwpc", 7) == 0)
+					return 626;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "axmatqc", 7) == 0)
+					return 673;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'd':
+			if (memcmp(key, "afmnbtd", 7) == 0)
+				return 148;
+			return (uint32_t)-1;
+		case 'e':
+			if (memcmp(key, "bdnbkoe", 7) == 0)
+				return 837;
+			if (memcmp(key, "beivnwe", 7) == 0)
+				return 860;
+			return (uint32_t)-1;
+		case 'f':
+			if (memcmp(key, "avejfof", 7) == 0)
+				return 618;
+			return (uint32_t)-1;
+		case 'g':
+			if (memcmp(key, "akpgjhg", 7) == 0)
+				return 298;
+			if (memcmp(key, "bbytzrg", 7) == 0)
+				return 792;
+			return (uint32_t)-1;
+		case 'h':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "acnjhah", 7) == 0)
+					return 67;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anxwedh", 7) == 0)
+					return 385;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asgecyh", 7) == 0)
+					return 529;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'i':
+			if (memcmp(key, "aheoqxi", 7) == 0)
+				return 204;
+			return (uint32_t)-1;
+		case 'j':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "acdumcj", 7) == 0)
+					return 56;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "adowolj", 7) == 0)
+					return 96;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgwzmhj", 7) == 0)
+					return 937;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "ahmadaj", 7) == 0)
+					return 213;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amuaclj", 7) == 0)
+					return 356;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'k':
+			switch (((const uint8_t *)key)[4]) {
+			case 'k':
+				if (memcmp(key, "arrbknk", 7) == 0)
+					return 514;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "aoqclsk", 7) == 0)
+					return 412;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "awwbunk", 7) == 0)
+					return 657;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "arrtztk", 7) == 0)
+					return 516;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aaupkdl", 7) == 0)
+					return 23;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "akcxbwl", 7) == 0)
+					return 281;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aovoufl", 7) == 0)
+					return 418;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			switch (((const uint8_t *)key)[2]) {
+			case 'h':
+				if (memcmp(key, "aihejtm", 7) == 0)
+					return 232;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "awwaipm", 7) == 0)
+					return 656;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "awyyehm", 7) == 0)
+					return 661;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'n':
+			switch (((const uint8_t *)key)[3]) {
+			case 'e':
+				if (memcmp(key, "aqaeyen", 7) == 0)
+					return 457;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfcfvan", 7) == 0)
+					return 882;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "bfnotan", 7) == 0)
+					return 894;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "abcroqn", 7) == 0)
+					return 30;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "akssyan", 7) == 0)
+					return 304;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "arcuckn", 7) == 0)
+					return 493;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "bcrzqzn", 7) == 0)
+					return 818;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'o':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aagbaqo", 7) == 0)
+					return 10;
+				return (uint32_t)-1;
+			case 'b':
+				if (memcmp(key, "bbdkzao", 7) == 0)
+					return 774;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "bcgfmuo", 7) == 0)
+					return 803;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avctrko", 7) == 0)
+					return 617;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'p':
+			if (memcmp(key, "awwvjop", 7) == 0)
+				return 659;
+			if (memcmp(key, "bdyzmnp", 7) == 0)
+				return 852;
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, "acrupnq", 7) == 0)
+				return 71;
+			if (memcmp(key, "bdrkkeq", 7) == 0)
+				return 843;
+			return (uint32_t)-1;
+		case 'r':
+			if (memcmp(key, "bepmsur", 7) == 0)
+				return 869;
+			return (uint32_t)-1;
+		case 's':
+			if (memcmp(key, "auoypcs", 7) == 0)
+				return 601;
+			if (memcmp(key, "bganhvs", 7) == 0)
+				return 915;
+			return (uint32_t)-1;
+		case 't':
+			switch (((const uint8_t *)key)[1]) {
+			case 'f':
+				if (memcmp(key, "bfqdcut", 7) == 0)
+					return 897;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agimtxt", 7) == 0)
+					return 180;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "biopdqt", 7) == 0)
+					return 972;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'u':
+			if (memcmp(key, "afcapeu", 7) == 0)
+				return 140;
+			if (memcmp(key, "amdxqzu", 7) == 0)
+				return 337;
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aafjjxv", 7) == 0)
+					return 7;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgdrlzv", 7) == 0)
+					return 920;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "aluqswv", 7) == 0)
+					return 328;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, "arucxbw", 7) == 0)
+				return 518;
+			if (memcmp(key, "asxtnyw", 7) == 0)
+				return 554;
+			return (uint32_t)-1;
+		case 'x':
+			if (memcmp(key, "apnbsvx", 7) == 0)
+				return 437;
+			if (memcmp(key, "azmbiqx", 7) == 0)
+				return 726;
+			return (uint32_t)-1;
+		case 'y':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "bcpkhby", 7) == 0)
+					return 814;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "adzplry", 7) == 0)
+					return 106;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "akdlazy", 7) == 0)
+					return 283;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'z':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "baymotz", 7) == 0)
+					return 767;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqspytz", 7) == 0)
+					return 480;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "aszqjyz", 7) == 0)
+					return 556;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 8:
+		switch (((const uint8_t *)key)[6]) {
+		case 'a':
+			if (memcmp(key, "amhocvas", 8) == 0)
+				return 341;
+			return (uint32_t)-1;
+		case 'b':
+			if (memcmp(key, "aofdiebh", 8) == 0)
+				return 394;
+			if (memcmp(key, "aqnwqkbt", 8) == 0)
+				return 478;
+			return (uint32_t)-1;
+		case 'c':
+			if (memcmp(key, "avhrnkcn", 8) == 0)
+				return 624;
+			return (uint32_t)-1;
+		case 'd':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "adnldbde", 8) == 0)
+					return 93;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfuelxdm", 8) == 0)
+					return 903;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aivfpzdv", 8) == 0)
+					return 248;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "ajfujbdn", 8) == 0)
+					return 260;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "akbzrbdp", 8) == 0)
+					return 280;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'e':
+			if (memcmp(key, "biszstem", 8) == 0)
+				return 980;
+			return (uint32_t)-1;
+		case 'f':
+			if (memcmp(key, "amjfbefm", 8) == 0)
+				return 344;
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "beoxxqgo", 8) == 0)
+					return 866;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aoxxzsgg", 8) == 0)
+					return 423;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avbcyego", 8) == 0)
+					return 614;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "axpjimge", 8) == 0)
+					return 675;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			if (memcmp(key, "apzvkshb", 8) == 0)
+				return 455;
+			if (memcmp(key, "axjqcyho", 8) == 0)
+				return 671;
+			return (uint32_t)-1;
+		case 'i':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "bbayrlie", 8) == 0)
+					return 772;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bhdrcxio", 8) == 0)
+					return 945;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "aybsbwif", 8) == 0)
+					return 687;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'j':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "bbuwoojy", 8) == 0)
+					return 784;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bhfukaju", 8) == 0)
+					return 948;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "ajpnyfjl", 8) == 0)
+					return 268;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'k':
+			if (memcmp(key, "abghylkt", 8) == 0)
+				return 38;
+			if (memcmp(key, "anzrgxko", 8) == 0)
+				return 387;
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aabozllo", 8) == 0)
+					return 5;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "adoinuly", 8) == 0)
+					return 95;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfleejld", 8) == 0)
+					return 892;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			switch (((const uint8_t *)key)[2]) {
+			case 'b':
+				if (memcmp(key, "bjbiknmw", 8) == 0)
+					return 993;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "ajexeuma", 8) == 0)
+					return 259;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "agtmromi", 8) == 0)
+					return 190;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, "acyvmwnl", 8) == 0)
+				return 78;
+			if (memcmp(key, "arqeqfnk", 8) == 0)
+				return 513;
+			return (uint32_t)-1;
+		case 'o':
+			if (memcmp(key, "aumywooz", 8) == 0)
+				return 599;
+			return (uint32_t)-1;
+		case 'p':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abnnfppd", 8) == 0)
+					return 40;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "acvikspj", 8) == 0)
+					return 75;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "aedygfpc", 8) == 0)
+					return 116;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bhcqzspz", 8) == 0)
+					return 944;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "bitbidpy", 8) == 0)
+					return 981;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, "azzcerqz", 8) == 0)
+				return 735;
+			if (memcmp(key, "bagqafqf", 8) == 0)
+				return 746;
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "accdawrk", 8) == 0)
+					return 55;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "aecdpkro", 8) == 0)
+					return 113;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agdpcsrr", 8) == 0)
+					return 176;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asxbiaro", 8) == 0)
+					return 553;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			if (memcmp(key, "adsyjfsp", 8) == 0)
+				return 99;
+			if (memcmp(key, "asjizgsn", 8) == 0)
+				return 538;
+			return (uint32_t)-1;
+		case 't':
+			if (memcmp(key, "aitazbtn", 8) == 0)
+				return 246;
+			return (uint32_t)-1;
+		case 'u':
+			switch (((const uint8_t *)key)[1]) {
+			case 'g':
+				if (memcmp(key, "bgnkeruy", 8) == 0)
+					return 928;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "ajykjjue", 8) == 0)
+					return 277;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "aklyfeuf", 8) == 0)
+					return 294;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'v':
+			if (memcmp(key, "arzhnfvf", 8) == 0)
+				return 522;
+			return (uint32_t)-1;
+		case 'w':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "bawzbmwv", 8) == 0)
+					return 765;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "aprkejwd", 8) == 0)
+					return 444;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "auepbxwj", 8) == 0)
+					return 588;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'x':
+			if (memcmp(key, "aqzfqhxs", 8) == 0)
+				return 488;
+			if (memcmp(key, "bfdixpxt", 8) == 0)
+				return 883;
+			return (uint32_t)-1;
+		case 'y':
+			switch (((const uint8_t *)key)[1]) {
+			case 'h':
+				if (memcmp(key, "ahrycyyg", 8) == 0)
+					return 217;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aoxkxeye", 8) == 0)
+					return 422;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apwilmyz", 8) == 0)
+					return 452;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asroqqyd", 8) == 0)
+					return 545;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'z':
+			if (memcmp(key, "baazajzi", 8) == 0)
+				return 738;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 9:
+		switch (((const uint8_t *)key)[1]) {
+		case 'a':
+			switch (((const uint8_t *)key)[2]) {
+			case 'e':
+				if (memcmp(key, "baediyfxp", 9) == 0)
+					return 743;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "aahpgumys", 9) == 0)
+					return 12;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "aawplxnsl", 9) == 0)
+					return 25;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'b':
+			if (memcmp(key, "bbaqrzywu", 9) == 0)
+				return 771;
+			if (memcmp(key, "bbrciffax", 9) == 0)
+				return 780;
+			return (uint32_t)-1;
+		case 'c':
+			switch (((const uint8_t *)key)[2]) {
+			case 'g':
+				if (memcmp(key, "acgsyaenn", 9) == 0)
+					return 60;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "achaergtd", 9) == 0)
+					return 61;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "bckldqjbp", 9) == 0)
+					return 805;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'd':
+			switch (((const uint8_t *)key)[4]) {
+			case 'b':
+				if (memcmp(key, "bdpybuwwa", 9) == 0)
+					return 841;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "adcncxngm", 9) == 0)
+					return 81;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "bdfnevzpq", 9) == 0)
+					return 830;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "adjgncgej", 9) == 0)
+					return 89;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "bdrapgoaq", 9) == 0)
+					return 842;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "bdlyrtxes", 9) == 0)
+					return 835;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "advxvdrmq", 9) == 0)
+					return 102;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "adptyuhmk", 9) == 0)
+					return 97;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'e':
+			switch (((const uint8_t *)key)[3]) {
+			case 'a':
+				if (memcmp(key, "aetazxsti", 9) == 0)
+					return 131;
+				return (uint32_t)-1;
+			case 'b':
+				if (memcmp(key, "bevbeeofe", 9) == 0)
+					return 873;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "beagrthtp", 9) == 0)
+					return 854;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "aeahwehgc", 9) == 0)
+					return 110;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "bepiorywl", 9) == 0)
+					return 868;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'f':
+			switch (((const uint8_t *)key)[2]) {
+			case 'a':
+				if (memcmp(key, "afabswrbr", 9) == 0)
+					return 138;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bffuecdod", 9) == 0)
+					return 887;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "bfirbahyc", 9) == 0)
+					return 890;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "afovbwhaw", 9) == 0)
+					return 153;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "afpbwckga", 9) == 0)
+					return 155;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "afrhifomx", 9) == 0)
+					return 158;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "bfvkfarob", 9) == 0)
+					return 905;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'g':
+			if (memcmp(key, "agtybphmu", 9) == 0)
+				return 191;
+			if (memcmp(key, "bgckovjdh", 9) == 0)
+				return 918;
+			return (uint32_t)-1;
+		case 'h':
+			switch (((const uint8_t *)key)[3]) {
+			case 'b':
+				if (memcmp(key, "ahwbwarqo", 9) == 0)
+					return 221;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "bhwdvywdg", 9) == 0)
+					return 960;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "bhbidhdvx", 9) == 0)
+					return 942;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'i':
+			if (memcmp(key, "biteikqwq", 9) == 0)
+				return 982;
+			if (memcmp(key, "biziirfyc", 9) == 0)
+				return 987;
+			return (uint32_t)-1;
+		case 'j':
+			switch (((const uint8_t *)key)[3]) {
+			case 'f':
+				if (memcmp(key, "ajufbpaxc", 9) == 0)
+					return 269;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bjehuqnch", 9) == 0)
+					return 999;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "ajukmqlxl", 9) == 0)
+					return 270;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'k':
+			switch (((const uint8_t *)key)[2]) {
+			case 'd':
+				if (memcmp(key, "akdxmrlmj", 9) == 0)
+					return 285;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "akfzpgvbi", 9) == 0)
+					return 287;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "akmpovgxd", 9) == 0)
+					return 295;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "akpwxtipo", 9) == 0)
+					return 299;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'l':
+			if (memcmp(key, "alnncrnou", 9) == 0)
+				return 322;
+			if (memcmp(key, "alwbqvrib", 9) == 0)
+				return 330;
+			return (uint32_t)-1;
+		case 'm':
+			if (memcmp(key, "amjyxnjsu", 9) == 0)
+				return 346;
+			if (memcmp(key, "amxqtdhni", 9) == 0)
+				return 361;
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, "aninljfxl", 9) == 0)
+				return 372;
+			if (memcmp(key, "anwklkxyn", 9) == 0)
+				return 384;
+			return (uint32_t)-1;
+		case 'o':
+			switch (((const uint8_t *)key)[3]) {
+			case 'f':
+				if (memcmp(key, "aohfxjunb", 9) == 0)
+					return 397;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "aovjcrmiu", 9) == 0)
+					return 416;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "aohshtvbl", 9) == 0)
+					return 398;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "aovvtczrc", 9) == 0)
+					return 419;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'p':
+			switch (((const uint8_t *)key)[2]) {
+			case 'd':
+				if (memcmp(key, "apdumidzy", 9) == 0)
+					return 431;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "apoxufrps", 9) == 0)
+					return 442;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "appxvypap", 9) == 0)
+					return 443;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "apyotdpei", 9) == 0)
+					return 454;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, "aqlduhjid", 9) == 0)
+				return 474;
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[2]) {
+			case 'o':
+				if (memcmp(key, "arohoeaiy", 9) == 0)
+					return 512;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "aryswrjcv", 9) == 0)
+					return 520;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "arzuljwsk", 9) == 0)
+					return 523;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			if (memcmp(key, "asfxudbxe", 9) == 0)
+				return 528;
+			if (memcmp(key, "asitgqqvz", 9) == 0)
+				return 536;
+			return (uint32_t)-1;
+		case 't':
+			switch (((const uint8_t *)key)[2]) {
+			case 'g':
+				if (memcmp(key, "atgflcfwh", 9) == 0)
+					return 562;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "atkwncxsx", 9) == 0)
+					return 568;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "atvaeladu", 9) == 0)
+					return 578;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'u':
+			switch (((const uint8_t *)key)[2]) {
+			case 'e':
+				if (memcmp(key, "auehjyeax", 9) == 0)
+					return 586;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "augyhqves", 9) == 0)
+					return 594;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "aujwepnim", 9) == 0)
+					return 597;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "autcnzpgn", 9) == 0)
+					return 606;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "auvbuykmd", 9) == 0)
+					return 608;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[2]) {
+			case 'r':
+				if (memcmp(key, "avrtcuwxd", 9) == 0)
+					return 632;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avvrcjnpw", 9) == 0)
+					return 639;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "avytejzij", 9) == 0)
+					return 640;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			switch (((const uint8_t *)key)[2]) {
+			case 'b':
+				if (memcmp(key, "awbxrtjoa", 9) == 0)
+					return 645;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "awdwwfpce", 9) == 0)
+					return 647;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "awktgwbrh", 9) == 0)
+					return 650;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'x':
+			switch (((const uint8_t *)key)[2]) {
+			case 'i':
+				if (memcmp(key, "axirzlmia", 9) == 0)
+					return 669;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "axkyzbvmj", 9) == 0)
+					return 672;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "axvbmjcmu", 9) == 0)
+					return 678;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "axzhnlgyw", 9) == 0)
+					return 681;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'y':
+			switch (((const uint8_t *)key)[2]) {
+			case 'a':
+				if (memcmp(key, "ayaguqcyf", 9) == 0)
+					return 684;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "aydvrvlia", 9) == 0)
+					return 691;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "ayfpvmjju", 9) == 0)
+					return 694;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "ayndurltg", 9) == 0)
+					return 701;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "ayrtxzkgx", 9) == 0)
+					return 703;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "ayvidfhrm", 9) == 0)
+					return 707;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'z':
+			if (memcmp(key, "azdcmxfes", 9) == 0)
+				return 716;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 10:
+		switch (((const uint8_t *)key)[2]) {
+		case 'a':
+			switch (((const uint8_t *)key)[3]) {
+			case 'b':
+				if (memcmp(key, "aiabbdwlhf", 10) == 0)
+					return 226;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "azaeznmkwi", 10) == 0)
+					return 714;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "aiamjyqonb", 10) == 0)
+					return 228;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "auarghyogn", 10) == 0)
+					return 583;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "atasxvjfdd", 10) == 0)
+					return 558;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "aaawkatdsy", 10) == 0)
+					return 3;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "aqaxxjbxfl", 10) == 0)
+					return 458;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "aaazaiwmzo", 10) == 0)
+					return 4;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'b':
+			if (memcmp(key, "agbbgucvne", 10) == 0)
+				return 169;
+			if (memcmp(key, "atbgsbxekj", 10) == 0)
+				return 559;
+			return (uint32_t)-1;
+		case 'd':
+			switch (((const uint8_t *)key)[4]) {
+			case 'i':
+				if (memcmp(key, "bjdiiqxrit", 10) == 0)
+					return 997;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "aqdekxkzks", 10) == 0)
+					return 462;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "bidznmilgb", 10) == 0)
+					return 967;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "ardzqqnzee", 10) == 0)
+					return 495;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "afddxironm", 10) == 0)
+					return 143;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "aqdayjchue", 10) == 0)
+					return 461;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'e':
+			if (memcmp(key, "auemxrdoay", 10) == 0)
+				return 587;
+			if (memcmp(key, "bjeapaqyqb", 10) == 0)
+				return 998;
+			return (uint32_t)-1;
+		case 'f':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "bcfqaunfrb", 10) == 0)
+					return 800;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqfuykqjfa", 10) == 0)
+					return 466;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "awfzwgoeyh", 10) == 0)
+					return 649;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aagwgqbdhc", 10) == 0)
+					return 11;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "adgcouasqg", 10) == 0)
+					return 84;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfgndmggnr", 10) == 0)
+					return 888;
+				return (uint32_t)-1;
+			case 'k':
+				if (memcmp(key, "akgezjlnha", 10) == 0)
+					return 288;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "angdqpdmft", 10) == 0)
+					return 370;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atghmtgzeb", 10) == 0)
+					return 563;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "augkpkwxbi", 10) == 0)
+					return 591;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "axgvfbwvwn", 10) == 0)
+					return 667;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			switch (((const uint8_t *)key)[1]) {
+			case 'h':
+				if (memcmp(key, "ahhsabofye", 10) == 0)
+					return 209;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avhnhwgots", 10) == 0)
+					return 623;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azhxsnqtjp", 10) == 0)
+					return 722;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'i':
+			switch (((const uint8_t *)key)[1]) {
+			case 'g':
+				if (memcmp(key, "bgiuabechv", 10) == 0)
+					return 922;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amianjuvwy", 10) == 0)
+					return 342;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arivnzklsg", 10) == 0)
+					return 502;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asiozyxlcb", 10) == 0)
+					return 534;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, "aijxwzfpmr", 10) == 0)
+				return 239;
+			if (memcmp(key, "aojpzddjar", 10) == 0)
+				return 401;
+			return (uint32_t)-1;
+		case 'k':
+			if (memcmp(key, "aokszgzzmb", 10) == 0)
+				return 403;
+			if (memcmp(key, "azkewersoh", 10) == 0)
+				return 723;
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[1]) {
+			case 'k':
+				if (memcmp(key, "aklkzzrtgi", 10) == 0)
+					return 292;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amlkgaoelk", 10) == 0)
+					return 350;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqlhyotznj", 10) == 0)
+					return 475;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "bdmfyqwxuf", 10) == 0)
+					return 836;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "bemcinpjdq", 10) == 0)
+					return 864;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgmlldvucq", 10) == 0)
+					return 925;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "armorcdpej", 10) == 0)
+					return 507;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, "bcnkqlrhjq", 10) == 0)
+				return 810;
+			return (uint32_t)-1;
+		case 'o':
+			if (memcmp(key, "apoksoahdk", 10) == 0)
+				return 441;
+			return (uint32_t)-1;
+		case 'p':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "aepqhpwunt", 10) == 0)
+					return 126;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anpzxxcntx", 10) == 0)
+					return 376;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aopphpcemi", 10) == 0)
+					return 411;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avpxgzavyb", 10) == 0)
+					return 631;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, "bgqigoxdfl", 10) == 0)
+				return 930;
+			if (memcmp(key, "bgqkccdufr", 10) == 0)
+				return 931;
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aarfotdcsb", 10) == 0)
+					return 20;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "airrvbjwdb", 10) == 0)
+					return 245;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "aurghovsqy", 10) == 0)
+					return 603;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			if (memcmp(key, "bcsykbyrcb", 10) == 0)
+				return 820;
+			return (uint32_t)-1;
+		case 't':
+			if (memcmp(key, "abttuirixp", 10) == 0)
+				return 47;
+			return (uint32_t)-1;
+		case 'u':
+			if (memcmp(key, "aeuemhbrat", 10) == 0)
+				return 132;
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[4]) {
+			case 'a':
+				if (memcmp(key, "aivraamggx", 10) == 0)
+					return 249;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "apvecnkopt", 10) == 0)
+					return 451;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "aivrmjybsv", 10) == 0)
+					return 250;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "bcvqnowfeg", 10) == 0)
+					return 824;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "azvkpvmmqv", 10) == 0)
+					return 734;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, "adwfkizxbp", 10) == 0)
+				return 105;
+			if (memcmp(key, "awwdaxmozk", 10) == 0)
+				return 658;
+			return (uint32_t)-1;
+		case 'x':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "bbxgulxlql", 10) == 0)
+					return 789;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "ajxfglmqkd", 10) == 0)
+					return 274;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apxvrkgnsi", 10) == 0)
+					return 453;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "axxhcrfysw", 10) == 0)
+					return 679;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'y':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "bbynjbzndb", 10) == 0)
+					return 791;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afypvnadao", 10) == 0)
+					return 164;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "ahylzbulai", 10) == 0)
+					return 222;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'z':
+			if (memcmp(key, "ahzvwxaxic", 10) == 0)
+				return 224;
+			if (memcmp(key, "azzeqljhdz", 10) == 0)
+				return 736;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 11:
+		switch (((const uint8_t *)key)[3]) {
+		case 'a':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aalazfxybys", 11) == 0)
+					return 16;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afdakepdzxw", 11) == 0)
+					return 142;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apoagwnopnc", 11) == 0)
+					return 440;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqbacwwhqor", 11) == 0)
+					return 459;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "axpaljfblns", 11) == 0)
+					return 674;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'b':
+			if (memcmp(key, "agybygrpdnd", 11) == 0)
+				return 197;
+			return (uint32_t)-1;
+		case 'c':
+			if (memcmp(key, "axqclcoujeu", 11) == 0)
+				return 676;
+			if (memcmp(key, "biycafsmilc", 11) == 0)
+				return 985;
+			return (uint32_t)-1;
+		case 'd':
+			if (memcmp(key, "augdbjermtl", 11) == 0)
+				return 590;
+			if (memcmp(key, "bhkdpkcplsk", 11) == 0)
+				return 951;
+			return (uint32_t)-1;
+		case 'e':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "acgeshhyiqp", 11) == 0)
+					return 58;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfyeovbyiuw", 11) == 0)
+					return 910;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agdehlqiefh", 11) == 0)
+					return 175;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "bjceinmzedt", 11) == 0)
+					return 994;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aoreagatoud", 11) == 0)
+					return 415;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'f':
+			if (memcmp(key, "abgfzpabokt", 11) == 0)
+				return 37;
+			if (memcmp(key, "ahefdmovzsj", 11) == 0)
+				return 203;
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aavgjlqyprl", 11) == 0)
+					return 24;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "biygzzsmxiy", 11) == 0)
+					return 986;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alpgzprsmya", 11) == 0)
+					return 323;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anqgigorvtg", 11) == 0)
+					return 378;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			if (memcmp(key, "ahbhifaktmf", 11) == 0)
+				return 199;
+			if (memcmp(key, "ailhkdpxhle", 11) == 0)
+				return 241;
+			return (uint32_t)-1;
+		case 'i':
+			switch (((const uint8_t *)key)[1]) {
+			case 'o':
+				if (memcmp(key, "aolismvrqhw", 11) == 0)
+					return 405;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "aycixdathok", 11) == 0)
+					return 688;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azgiwdgycss", 11) == 0)
+					return 720;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, "azojzmhmvgw", 11) == 0)
+				return 728;
+			if (memcmp(key, "bhqjgtptbak", 11) == 0)
+				return 954;
+			return (uint32_t)-1;
+		case 'k':
+			if (memcmp(key, "bbvkeedqgsf", 11) == 0)
+				return 786;
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "beolqvpzfxf", 11) == 0)
+					return 865;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alllruhtbki", 11) == 0)
+					return 321;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avelskvcusw", 11) == 0)
+					return 619;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "awelebpxvyz", 11) == 0)
+					return 648;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			if (memcmp(key, "acwmemtmnml", 11) == 0)
+				return 76;
+			if (memcmp(key, "biamytpegbp", 11) == 0)
+				return 965;
+			return (uint32_t)-1;
+		case 'n':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "actnmsaqlxj", 11) == 0)
+					return 73;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "aegnwaegqii", 11) == 0)
+					return 118;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afpnnyablos", 11) == 0)
+					return 156;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "axznsdejodm", 11) == 0)
+					return 682;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'o':
+			switch (((const uint8_t *)key)[2]) {
+			case 'c':
+				if (memcmp(key, "bjcopoptplk", 11) == 0)
+					return 995;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "akhowmxjnmg", 11) == 0)
+					return 289;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "bfmoevqtgxr", 11) == 0)
+					return 893;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "bbwoeopqygz", 11) == 0)
+					return 787;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "bfxojuzxhqu", 11) == 0)
+					return 908;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'p':
+			switch (((const uint8_t *)key)[2]) {
+			case 'e':
+				if (memcmp(key, "amepbcmqers", 11) == 0)
+					return 338;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "alrpbhdkfvd", 11) == 0)
+					return 326;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "bctpqwmsnvh", 11) == 0)
+					return 821;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "amypheipnls", 11) == 0)
+					return 364;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'q':
+			switch (((const uint8_t *)key)[2]) {
+			case 'f':
+				if (memcmp(key, "affqgbqdmbu", 11) == 0)
+					return 144;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bahqzidllfa", 11) == 0)
+					return 749;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "aalqbxuarll", 11) == 0)
+					return 17;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abxrbvbhskm", 11) == 0)
+					return 50;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "ajirnfcltff", 11) == 0)
+					return 261;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "aprrxamsubs", 11) == 0)
+					return 445;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "ayurhakpbgm", 11) == 0)
+					return 704;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			if (memcmp(key, "bcosnlgqblp", 11) == 0)
+				return 813;
+			return (uint32_t)-1;
+		case 't':
+			switch (((const uint8_t *)key)[2]) {
+			case 'd':
+				if (memcmp(key, "bbdtbwrrzyp", 11) == 0)
+					return 775;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "bbetmejicwr", 11) == 0)
+					return 776;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afftzswhrkc", 11) == 0)
+					return 145;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "bcmtpljsczw", 11) == 0)
+					return 809;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "birtinutrik", 11) == 0)
+					return 978;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'u':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "bccuohhjalg", 11) == 0)
+					return 797;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "bdvuvhboykx", 11) == 0)
+					return 849;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "ahduwpxnwat", 11) == 0)
+					return 202;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anguwxzlilk", 11) == 0)
+					return 371;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atmuiszpjkp", 11) == 0)
+					return 570;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'v':
+			if (memcmp(key, "aygvbpwqxto", 11) == 0)
+				return 699;
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, "aacwukjxnef", 11) == 0)
+				return 6;
+			if (memcmp(key, "berwgeebepz", 11) == 0)
+				return 871;
+			return (uint32_t)-1;
+		case 'x':
+			if (memcmp(key, "ajxxmhjpbst", 11) == 0)
+				return 275;
+			if (memcmp(key, "aqlxubdylgq", 11) == 0)
+				return 476;
+			return (uint32_t)-1;
+		case 'y':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aafyjfdobuf", 11) == 0)
+					return 9;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "aguytjckmbl", 11) == 0)
+					return 194;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqxydxmjjdl", 11) == 0)
+					return 484;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'z':
+			switch (((const uint8_t *)key)[2]) {
+			case 'e':
+				if (memcmp(key, "bfezpbufygz", 11) == 0)
+					return 885;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "aejzdahwbtl", 11) == 0)
+					return 123;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "bcnzjtwyiyy", 11) == 0)
+					return 812;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aqozrrayhcz", 11) == 0)
+					return 479;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "beqzxtqbfdr", 11) == 0)
+					return 870;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 12:
+		switch (((const uint8_t *)key)[6]) {
+		case 'a':
+			switch (((const uint8_t *)key)[2]) {
+			case 'd':
+				if (memcmp(key, "bedwfiaesztb", 12) == 0)
+					return 856;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bcgejmayphgj", 12) == 0)
+					return 802;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "aezbgcagmrrp", 12) == 0)
+					return 135;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'b':
+			if (memcmp(key, "bcbogjbvqrza", 12) == 0)
+				return 795;
+			return (uint32_t)-1;
+		case 'c':
+			if (memcmp(key, "adkrmjcofnbo", 12) == 0)
+				return 91;
+			if (memcmp(key, "akyaeacuxejm", 12) == 0)
+				return 307;
+			return (uint32_t)-1;
+		case 'd':
+			if (memcmp(key, "auqrwvdyryab", 12) == 0)
+				return 602;
+			return (uint32_t)-1;
+		case 'e':
+			if (memcmp(key, "abmtelekzgph", 12) == 0)
+				return 39;
+			if (memcmp(key, "bfyavwepuqps", 12) == 0)
+				return 909;
+			return (uint32_t)-1;
+		case 'f':
+			switch (((const uint8_t *)key)[2]) {
+			case 'j':
+				if (memcmp(key, "bgjingfapqbe", 12) == 0)
+					return 923;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "alqlsmfpewpo", 12) == 0)
+					return 324;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "agwprdfxkote", 12) == 0)
+					return 196;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "awxjflfkvzcf", 12) == 0)
+					return 660;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abemcsgtsaqf", 12) == 0)
+					return 35;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "acndzbghzsnf", 12) == 0)
+					return 66;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amqumqgepywx", 12) == 0)
+					return 353;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arzbdrgcmfau", 12) == 0)
+					return 521;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "augqmrgdnuuq", 12) == 0)
+					return 593;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			switch (((const uint8_t *)key)[1]) {
+			case 'h':
+				if (memcmp(key, "ahrkhwhlmdzr", 12) == 0)
+					return 216;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alrokxhurell", 12) == 0)
+					return 325;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aoobzdhtvvwy", 12) == 0)
+					return 409;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'i':
+			switch (((const uint8_t *)key)[2]) {
+			case 'e':
+				if (memcmp(key, "anemeaieosxx", 12) == 0)
+					return 368;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "aglwcuiueqio", 12) == 0)
+					return 182;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "ajpkohinytla", 12) == 0)
+					return 267;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "agqmjnishvnq", 12) == 0)
+					return 187;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "afystviiojvx", 12) == 0)
+					return 165;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'j':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "bbaibijfrptw", 12) == 0)
+					return 770;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aolgzpjcanya", 12) == 0)
+					return 404;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arxcppjvzzmw", 12) == 0)
+					return 519;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'k':
+			switch (((const uint8_t *)key)[2]) {
+			case 'h':
+				if (memcmp(key, "bahvobkwdidd", 12) == 0)
+					return 750;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "abrvngkjcvst", 12) == 0)
+					return 46;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "ahtjsnkbpuhw", 12) == 0)
+					return 219;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "bhwtetktboou", 12) == 0)
+					return 961;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[2]) {
+			case 'f':
+				if (memcmp(key, "aofeeilsphqi", 12) == 0)
+					return 395;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "baicsilotqif", 12) == 0)
+					return 751;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aooidxlqowtb", 12) == 0)
+					return 410;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "bhrcwalapbux", 12) == 0)
+					return 955;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "azunqkleaevv", 12) == 0)
+					return 731;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "ajzkohlbnpfn", 12) == 0)
+					return 278;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			switch (((const uint8_t *)key)[2]) {
+			case 'e':
+				if (memcmp(key, "aeejqumjzwwp", 12) == 0)
+					return 117;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "aqfhlnmxzcdi", 12) == 0)
+					return 464;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "amglwwmvafic", 12) == 0)
+					return 340;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "ashulbmpklnf", 12) == 0)
+					return 533;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "axifhymfsrre", 12) == 0)
+					return 668;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "bhjnmrmwuufq", 12) == 0)
+					return 950;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "axqfflmwagnb", 12) == 0)
+					return 677;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'n':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "aejijtnvnjlf", 12) == 0)
+					return 122;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfasppnandsz", 12) == 0)
+					return 881;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aijjdynfcxgv", 12) == 0)
+					return 237;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "awrlebnfhidt", 12) == 0)
+					return 654;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'o':
+			if (memcmp(key, "bdnufpoxdxux", 12) == 0)
+				return 839;
+			if (memcmp(key, "bhyzesomeviv", 12) == 0)
+				return 963;
+			return (uint32_t)-1;
+		case 'p':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abvlrapgztar", 12) == 0)
+					return 49;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "bclavkpvnjmu", 12) == 0)
+					return 806;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agqynkpfvjit", 12) == 0)
+					return 188;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, "afnnyjqxaxrb", 12) == 0)
+				return 150;
+			if (memcmp(key, "bgtfqtqzskrp", 12) == 0)
+				return 933;
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abrsthrindrt", 12) == 0)
+					return 45;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afzaozrqjxnd", 12) == 0)
+					return 166;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avoewxrvewnk", 12) == 0)
+					return 630;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			switch (((const uint8_t *)key)[1]) {
+			case 'h':
+				if (memcmp(key, "ahlykcsbfezz", 12) == 0)
+					return 212;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apfpjgsiztsi", 12) == 0)
+					return 432;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqtkglsvjlwg", 12) == 0)
+					return 482;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avlijhsccnty", 12) == 0)
+					return 629;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 't':
+			if (memcmp(key, "acfctctvvuqq", 12) == 0)
+				return 57;
+			if (memcmp(key, "aialwmtykvoz", 12) == 0)
+				return 227;
+			return (uint32_t)-1;
+		case 'u':
+			if (memcmp(key, "aeckwcuomuwt", 12) == 0)
+				return 114;
+			if (memcmp(key, "aqgqyaujeajf", 12) == 0)
+				return 468;
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "baxmmnvestev", 12) == 0)
+					return 766;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "aernwcvnqoqe", 12) == 0)
+					return 127;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alhwkvvhxdwq", 12) == 0)
+					return 316;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asgshnvjawpg", 12) == 0)
+					return 531;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, "aijbmhwsoasy", 12) == 0)
+				return 235;
+			if (memcmp(key, "atkramwifnwq", 12) == 0)
+				return 567;
+			return (uint32_t)-1;
+		case 'x':
+			if (memcmp(key, "amafiexdione", 12) == 0)
+				return 334;
+			return (uint32_t)-1;
+		case 'y':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "bammvjyqvjhx", 12) == 0)
+					return 758;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "bdkndvylxuxo", 12) == 0)
+					return 833;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avlbkhyycggr", 12) == 0)
+					return 627;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'z':
+			switch (((const uint8_t *)key)[2]) {
+			case 'k':
+				if (memcmp(key, "ackosnzmlndp", 12) == 0)
+					return 64;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "akowhnzwlmbv", 12) == 0)
+					return 296;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "bcqvvjzlegnf", 12) == 0)
+					return 816;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "bgvwfdzhllnt", 12) == 0)
+					return 935;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 13:
+		switch (((const uint8_t *)key)[8]) {
+		case 'a':
+			if (memcmp(key, "acjqckgbahcww", 13) == 0)
+				return 62;
+			if (memcmp(key, "aongrogeaitfe", 13) == 0)
+				return 407;
+			return (uint32_t)-1;
+		case 'b':
+			switch (((const uint8_t *)key)[2]) {
+			case 'e':
+				if (memcmp(key, "beedabmibnzzb", 13) == 0)
+					return 857;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "beilkaiubdvku", 13) == 0)
+					return 859;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "anlvcbtkbgqhf", 13) == 0)
+					return 374;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "assujmboblyla", 13) == 0)
+					return 548;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'c':
+			switch (((const uint8_t *)key)[1]) {
+			case 'k':
+				if (memcmp(key, "akqwfhfoctaka", 13) == 0)
+					return 300;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aordmjaccjfra", 13) == 0)
+					return 414;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arjvyxuecqlsz", 13) == 0)
+					return 503;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'd':
+			switch (((const uint8_t *)key)[2]) {
+			case 'b':
+				if (memcmp(key, "agbeeflmdidbw", 13) == 0)
+					return 170;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "bdcprnlpdkrvl", 13) == 0)
+					return 829;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "bdnejntcdrqve", 13) == 0)
+					return 838;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "anuuwxgudkzdw", 13) == 0)
+					return 383;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'e':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "bakpwahrebmdh", 13) == 0)
+					return 754;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alwodnzveidli", 13) == 0)
+					return 331;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arhpfrahecaek", 13) == 0)
+					return 498;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'f':
+			if (memcmp(key, "agplhuovfvrna", 13) == 0)
+				return 186;
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[1]) {
+			case 'c':
+				if (memcmp(key, "acurtnbcgiuxz", 13) == 0)
+					return 74;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asukvsmwgtztm", 13) == 0)
+					return 550;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "aufjgmihgiwou", 13) == 0)
+					return 589;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			if (memcmp(key, "bbglsgkhhpjgy", 13) == 0)
+				return 777;
+			if (memcmp(key, "bbtbfnuuhcind", 13) == 0)
+				return 781;
+			return (uint32_t)-1;
+		case 'i':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "bewamoowipmcb", 13) == 0)
+					return 875;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "ahewgvpsiufqx", 13) == 0)
+					return 205;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arnzzukeimkcc", 13) == 0)
+					return 511;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asnjeueyiibnr", 13) == 0)
+					return 541;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, "bgwpygmkjptqi", 13) == 0)
+				return 936;
+			return (uint32_t)-1;
+		case 'k':
+			if (memcmp(key, "bbbzxvaokcjjn", 13) == 0)
+				return 773;
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "aduidlcplhjlw", 13) == 0)
+					return 101;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgsdzqeklmuyn", 13) == 0)
+					return 932;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alipupnolwtat", 13) == 0)
+					return 317;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			switch (((const uint8_t *)key)[1]) {
+			case 'h':
+				if (memcmp(key, "ahlgnmozmmnkn", 13) == 0)
+					return 211;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atuavewemtrsm", 13) == 0)
+					return 575;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avucflgumvboz", 13) == 0)
+					return 637;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'n':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "balrxviengxws", 13) == 0)
+					return 757;
+				return (uint32_t)-1;
+			case 'b':
+				if (memcmp(key, "abdpauwxnyjjw", 13) == 0)
+					return 33;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfqgtpjkndqch", 13) == 0)
+					return 898;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agillaghnklvt", 13) == 0)
+					return 179;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bhezkqganmkla", 13) == 0)
+					return 946;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asizstlxnmldg", 13) == 0)
+					return 537;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'o':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "bawvglqhodxlv", 13) == 0)
+					return 764;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aoluupkbomvtw", 13) == 0)
+					return 406;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "awzpvraboqxrh", 13) == 0)
+					return 662;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'p':
+			if (memcmp(key, "asbeorwhpaatq", 13) == 0)
+				return 525;
+			if (memcmp(key, "bhcklnltpaetl", 13) == 0)
+				return 943;
+			return (uint32_t)-1;
+		case 'q':
+			if (memcmp(key, "akrjrqaqqwqed", 13) == 0)
+				return 301;
+			if (memcmp(key, "bcfxvjqoqaccu", 13) == 0)
+				return 801;
+			return (uint32_t)-1;
+		case 'r':
+			if (memcmp(key, "baziywgorpwxn", 13) == 0)
+				return 768;
+			return (uint32_t)-1;
+		case 's':
+			switch (((const uint8_t *)key)[2]) {
+			case 'c':
+				if (memcmp(key, "aocgprkwsyelk", 13) == 0)
+					return 393;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "axfpbzmiscjwe", 13) == 0)
+					return 666;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aoipkjqnskqxv", 13) == 0)
+					return 399;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "agnqlevdskdkq", 13) == 0)
+					return 184;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "afoeyyvxslene", 13) == 0)
+					return 152;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 't':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "aegxoejdtmmrv", 13) == 0)
+					return 120;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afdajpdgtnfvw", 13) == 0)
+					return 141;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agbsnfsithwad", 13) == 0)
+					return 171;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asglzmhxtvfdk", 13) == 0)
+					return 530;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'u':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abcyoudhuyoxv", 13) == 0)
+					return 31;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "bdacsmnculmcq", 13) == 0)
+					return 828;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anzigluouypzo", 13) == 0)
+					return 386;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "awpceoqjuewew", 13) == 0)
+					return 652;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[1]) {
+			case 'f':
+				if (memcmp(key, "bfqhuvfmvzyji", 13) == 0)
+					return 899;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "augyyboevwfgt", 13) == 0)
+					return 595;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avfgogievupuf", 13) == 0)
+					return 620;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, "amdtrjkowurky", 13) == 0)
+				return 336;
+			return (uint32_t)-1;
+		case 'x':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aaaoepsaxqker", 13) == 0)
+					return 2;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "ahcsdwuzxmetm", 13) == 0)
+					return 201;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "biqakmpoxsdtg", 13) == 0)
+					return 975;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "atdxmowgxodbg", 13) == 0)
+					return 560;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'y':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "baeaifbpywwns", 13) == 0)
+					return 742;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "adsetbfuyqmlq", 13) == 0)
+					return 98;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aixlmqiyyutkb", 13) == 0)
+					return 253;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "armqdlybyplyn", 13) == 0)
+					return 508;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'z':
+			if (memcmp(key, "afkomgzyzuuwi", 13) == 0)
+				return 146;
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	case 14:
+		switch (((const uint8_t *)key)[3]) {
+		case 'a':
+			switch (((const uint8_t *)key)[7]) {
+			case 'a':
+				if (memcmp(key, "adoalbcaylnjdp", 14) == 0)
+					return 94;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "aguaogtcduseei", 14) == 0)
+					return 192;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "bisahszesqkyfq", 14) == 0)
+					return 979;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "behahrymnzmlgc", 14) == 0)
+					return 858;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aihaiukqsvfylo", 14) == 0)
+					return 231;
+				return (uint32_t)-1;
+			case 't':
+				if (memcmp(key, "aicawrwtslqawy", 14) == 0)
+					return 229;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "bbvatgkvdogzxw", 14) == 0)
+					return 785;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "akkadpkznbkjrm", 14) == 0)
+					return 291;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'b':
+			switch (((const uint8_t *)key)[1]) {
+			case 'h':
+				if (memcmp(key, "bhwbjuoghpyphf", 14) == 0)
+					return 959;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alybopztfvkmwl", 14) == 0)
+					return 332;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apdbribsdymcir", 14) == 0)
+					return 429;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'c':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abgcyzzmsfaohz", 14) == 0)
+					return 36;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "aewcxnpkqffcsc", 14) == 0)
+					return 133;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "bfocrratxrcfqm", 14) == 0)
+					return 895;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'd':
+			if (memcmp(key, "assdbsqadkklyr", 14) == 0)
+				return 546;
+			if (memcmp(key, "bdudzrtalhwcap", 14) == 0)
+				return 847;
+			return (uint32_t)-1;
+		case 'e':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aamevrbsmiecou", 14) == 0)
+					return 18;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "bdseqqylrizsul", 14) == 0)
+					return 845;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "bepewpnpjatiru", 14) == 0)
+					return 867;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "aleejapuapcyzs", 14) == 0)
+					return 312;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "amtespnycxhrna", 14) == 0)
+					return 354;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "awaenhasdvibam", 14) == 0)
+					return 644;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'f':
+			switch (((const uint8_t *)key)[2]) {
+			case 'c':
+				if (memcmp(key, "aucfoymvqzjeeq", 14) == 0)
+					return 585;
+				return (uint32_t)-1;
+			case 'e':
+				if (memcmp(key, "akefpqxsrzirma", 14) == 0)
+					return 286;
+				return (uint32_t)-1;
+			case 'u':
+				if (memcmp(key, "akufanjkxmoxet", 14) == 0)
+					return 306;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'g':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "bajgfdbgxfkrlv", 14) == 0)
+					return 753;
+				return (uint32_t)-1;
+			case 'f':
+				if (memcmp(key, "afngooxtxdncoa", 14) == 0)
+					return 149;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azkgkokspcsxyy", 14) == 0)
+					return 724;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'h':
+			switch (((const uint8_t *)key)[2]) {
+			case 'a':
+				if (memcmp(key, "aeahcthpdbaspv", 14) == 0)
+					return 109;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "arghlqfwhnodip", 14) == 0)
+					return 497;
+				return (uint32_t)-1;
+			case 'j':
+				if (memcmp(key, "aejhlhfpfwbweh", 14) == 0)
+					return 121;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'i':
+			if (memcmp(key, "bdjilotpkildck", 14) == 0)
+				return 832;
+			return (uint32_t)-1;
+		case 'j':
+			if (memcmp(key, "apijmcafchdgjq", 14) == 0)
+				return 434;
+			if (memcmp(key, "azsjaleohobshu", 14) == 0)
+				return 730;
+			return (uint32_t)-1;
+		case 'k':
+			switch (((const uint8_t *)key)[1]) {
+			case 'g':
+				if (memcmp(key, "bgakdggioxxtsd", 14) == 0)
+					return 914;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anrkwivghygoiv", 14) == 0)
+					return 380;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "awckekjgfbhfoz", 14) == 0)
+					return 646;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azdkvwfwudtabt", 14) == 0)
+					return 717;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'l':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aauljgrerearvd", 14) == 0)
+					return 22;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "acklttjonmfsqw", 14) == 0)
+					return 63;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asalrmfafppxfd", 14) == 0)
+					return 524;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'm':
+			switch (((const uint8_t *)key)[7]) {
+			case 'h':
+				if (memcmp(key, "bigmtmnhlhcadk", 14) == 0)
+					return 968;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "becmmblivgijmo", 14) == 0)
+					return 855;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "avcmlnhmcmvwph", 14) == 0)
+					return 616;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "besmlmrphhawpr", 14) == 0)
+					return 872;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "auomaojqsownim", 14) == 0)
+					return 600;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "aptmbojveltgbm", 14) == 0)
+					return 447;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'n':
+			if (memcmp(key, "aptnbhdxmvrqas", 14) == 0)
+				return 448;
+			return (uint32_t)-1;
+		case 'o':
+			switch (((const uint8_t *)key)[1]) {
+			case 'a':
+				if (memcmp(key, "aajoixnfterwky", 14) == 0)
+					return 14;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "adgorwmlnymtjv", 14) == 0)
+					return 86;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgyojmkonvnszc", 14) == 0)
+					return 938;
+				return (uint32_t)-1;
+			case 'x':
+				if (memcmp(key, "axjovnoynhxcgp", 14) == 0)
+					return 670;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'p':
+			switch (((const uint8_t *)key)[1]) {
+			case 'f':
+				if (memcmp(key, "afapfsisywdfnf", 14) == 0)
+					return 139;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqvpvvskgmdzda", 14) == 0)
+					return 483;
+				return (uint32_t)-1;
+			case 's':
+				if (memcmp(key, "asupfarknyyqhu", 14) == 0)
+					return 552;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'q':
+			switch (((const uint8_t *)key)[1]) {
+			case 'e':
+				if (memcmp(key, "aebqchhcmwqshj", 14) == 0)
+					return 111;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "agvqdjegqjuqsr", 14) == 0)
+					return 195;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "ahfqkurbpmnkzk", 14) == 0)
+					return 207;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aoaqfafxmywmkf", 14) == 0)
+					return 389;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'r':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "bdrrborticaxib", 14) == 0)
+					return 844;
+				return (uint32_t)-1;
+			case 'r':
+				if (memcmp(key, "arnrjwcdzkwzqo", 14) == 0)
+					return 510;
+				return (uint32_t)-1;
+			case 'y':
+				if (memcmp(key, "ayardvhgchqlwt", 14) == 0)
+					return 685;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azdrbjhmwqmlxq", 14) == 0)
+					return 718;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 's':
+			if (memcmp(key, "ajusjcrruqqrss", 14) == 0)
+				return 271;
+			if (memcmp(key, "bfzsfvxobwhfok", 14) == 0)
+				return 911;
+			return (uint32_t)-1;
+		case 't':
+			switch (((const uint8_t *)key)[1]) {
+			case 'k':
+				if (memcmp(key, "akztebpoapmapf", 14) == 0)
+					return 310;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anptornqlqtpis", 14) == 0)
+					return 375;
+				return (uint32_t)-1;
+			case 'q':
+				if (memcmp(key, "aqftiwbsvmutcd", 14) == 0)
+					return 465;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "avstzwuxnyukeb", 14) == 0)
+					return 636;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'u':
+			switch (((const uint8_t *)key)[2]) {
+			case 'g':
+				if (memcmp(key, "bagufnamedqhln", 14) == 0)
+					return 747;
+				return (uint32_t)-1;
+			case 'm':
+				if (memcmp(key, "bamudyxdpugduv", 14) == 0)
+					return 759;
+				return (uint32_t)-1;
+			case 'v':
+				if (memcmp(key, "amvuhhqkzczohh", 14) == 0)
+					return 358;
+				return (uint32_t)-1;
+			case 'w':
+				if (memcmp(key, "acwuopbsjrdasc", 14) == 0)
+					return 77;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'v':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "adkvocwahadyny", 14) == 0)
+					return 92;
+				return (uint32_t)-1;
+			case 'h':
+				if (memcmp(key, "bhyvanlexudizp", 14) == 0)
+					return 962;
+				return (uint32_t)-1;
+			case 'n':
+				if (memcmp(key, "anbvfjavrwpyin", 14) == 0)
+					return 367;
+				return (uint32_t)-1;
+			case 'o':
+				if (memcmp(key, "aoqvpwifudrraw", 14) == 0)
+					return 413;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azuvtvfjghuvki", 14) == 0)
+					return 733;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'w':
+			if (memcmp(key, "akywfelhvsbwzx", 14) == 0)
+				return 308;
+			if (memcmp(key, "auvwrpfygwjgen", 14) == 0)
+				return 610;
+			return (uint32_t)-1;
+		case 'x':
+			switch (((const uint8_t *)key)[1]) {
+			case 'd':
+				if (memcmp(key, "adgxbuovjvzrjs", 14) == 0)
+					return 87;
+				return (uint32_t)-1;
+			case 'g':
+				if (memcmp(key, "bgaxooeiqvbmtz", 14) == 0)
+					return 916;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apnxqbhntoevwz", 14) == 0)
+					return 439;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		case 'y':
+			if (memcmp(key, "bgzyhxcsvstjpq", 14) == 0)
+				return 939;
+			return (uint32_t)-1;
+		case 'z':
+			switch (((const uint8_t *)key)[1]) {
+			case 'b':
+				if (memcmp(key, "abnznvhmvnpdsm", 14) == 0)
+					return 41;
+				return (uint32_t)-1;
+			case 'c':
+				if (memcmp(key, "acqzgdmgrudfev", 14) == 0)
+					return 70;
+				return (uint32_t)-1;
+			case 'd':
+				if (memcmp(key, "adjzjjfcahdzbu", 14) == 0)
+					return 90;
+				return (uint32_t)-1;
+			case 'i':
+				if (memcmp(key, "aiyzuochuktjgr", 14) == 0)
+					return 254;
+				return (uint32_t)-1;
+			case 'l':
+				if (memcmp(key, "alfzrlptvhdikn", 14) == 0)
+					return 313;
+				return (uint32_t)-1;
+			case 'p':
+				if (memcmp(key, "apszjdhexvgrhi", 14) == 0)
+					return 446;
+				return (uint32_t)-1;
+			case 'z':
+				if (memcmp(key, "azqzqvhelmnekn", 14) == 0)
+					return 729;
+				return (uint32_t)-1;
+			}
+			return (uint32_t)-1;
+		}
+		return (uint32_t)-1;
+	}
+	return (uint32_t)-1;
+}
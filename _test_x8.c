@@ -0,0 +1,227 @@
+/* generated with rurban/nbperf 08a5797 -bI _rand200 */
+/* seed[0]: 1804289383, seed[1]: 846930886 */
+#include <stdint.h>
+#include <stddef.h>
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__) && \
+    !defined NBPERF_NO_DISPATCH
+#ifndef NBPERF_DISPATCH
+#define NBPERF_DISPATCH
+#endif
+#include <immintrin.h>
+#elif defined __AVX2__ || defined __AVX512F__
+#include <immintrin.h>
+#endif
+
+static inline void _inthash2(const int32_t key, uint32_t *h)
+{
+	*h = (key * (UINT32_C(0xEB382D69) + UINT32_C(1804289383)))
+		 + UINT32_C(846930886);
+}
+
+static const uint16_t inthash_g[404] = {
+	     178,  173,   33,    0,   12,   56,    6,   51,
+	     133,  126,    1,    0,    0,    0,    0,  197,
+	     189,  198,   79,  146,   93,  120,    0,    0,
+	       0,    0,   71,  195,   54,  171,   19,  179,
+	      89,    0,    0,    0,    0,   17,    0,    0,
+	       0,    0,    0,    0,    0,    0,    0,    0,
+	       8,   64,   56,    2,  115,   72,  106,    0,
+	       0,    0,    0,    0,    0,    0,    0,    0,
+	       0,    0,    0,    0,    0,   89,   48,   52,
+	     183,  166,  130,  181,    0,    0,    0,    0,
+	       0,    0,    0,    0,    0,    0,    0,    0,
+	       0,    0,    0,   49,   26,  122,   17,   97,
+	     124,  100,    0,    0,    0,    0,    0,    0,
+	       0,    0,    0,    0,    0,    0,    0,    0,
+	       0,  114,   29,   73,  136,  193,   44,  194,
+	       0,    0,    0,    0,    0,    0,    0,    0,
+	       0,    0,    0,    0,    0,    0,    1,   84,
+	     118,  121,   38,   66,  148,    0,    0,    0,
+	       0,    0,    0,    0,    0,    0,    0,    0,
+	       0,    0,    0,    0,  189,  105,   75,  159,
+	      26,   93,  117,    0,    0,    0,    0,    0,
+	       0,    0,    0,    0,    0,    0,    0,    0,
+	       0,    0,  138,   11,   48,   26,  173,  118,
+	     109,    0,    0,    0,    0,    0,    0,    0,
+	       0,    0,    0,    0,    0,    0,    0,   30,
+	      36,   77,   98,   45,   81,   63,    0,    0,
+	       0,    0,    0,    0,    0,  112,   17,  116,
+	     115,    0,    0,    0,    0,    5,   15,  191,
+	      22,  139,  153,   28,    0,    0,    0,    0,
+	      51,  148,  129,  161,   76,   61,  133,    0,
+	       0,    0,    0,  136,  170,  110,   20,  172,
+	       9,   92,    0,    0,    0,   16,   74,   80,
+	     119,  199,   14,   35,    0,    0,    0,    0,
+	      82,  196,  106,   70,   72,  117,  186,    0,
+	       0,    0,    0,  164,   27,   39,  124,  160,
+	     155,  167,    0,    0,    0,    0,  175,   82,
+	     126,   90,  148,  127,  136,    0,    0,    0,
+	       0,   87,  171,   12,  147,   98,  126,   55,
+	       0,    0,    0,    0,  185,  153,  102,  128,
+	      91,  197,   25,    0,    0,    0,  120,   63,
+	      28,   91,   83,  105,  100,    0,    0,    0,
+	       0,    0,   63,  126,  152,    0,   86,   23,
+	       0,    0,    0,    0,  110,   38,  191,   13,
+	      95,   17,   92,    0,    0,    0,    0,  194,
+	     141,  103,  102,  134,  128,  157,    0,    0,
+	       0,    0,   21,  181,  187,   24,   29,  138,
+	      86,    0,    0,    0,    0,   40,    1,   36,
+	       3,  150,   97,  171,    0,    0,    0,    0,
+	     185,   11,  125,   31,   83,   91,    0,    0,
+	       0,    0,    0,   43,   15,  113,  137,  108,
+	     109,
+};
+
+uint16_t
+inthash(const int32_t key)
+{
+	const uint16_t *g = inthash_g;
+	uint16_t h[2];
+
+	_inthash2(key, (uint32_t*)h);
+
+	h[0] = h[0] % 401;
+	h[1] = h[1] % 401;
+	return (g[h[0]] + g[h[1]]) % 200;
+}
+
+void
+inthash_prefetch(const int32_t key)
+{
+	uint16_t h[2];
+
+	_inthash2(key, (uint32_t*)h);
+
+	h[0] = h[0] % 401;
+	h[1] = h[1] % 401;
+	__builtin_prefetch(&inthash_g[h[0]]);
+	__builtin_prefetch(&inthash_g[h[1]]);
+}
+
+void
+inthash_batch(const int32_t *keys, uint32_t *out, size_t n)
+{
+	const uint16_t *g = inthash_g;
+	uint16_t hb[8][2];
+
+	for (size_t s = 0; s < n; s += 8) {
+		const size_t nb = n - s < 8 ? n - s : 8;
+		for (size_t j = 0; j < nb; j++) {
+			const int32_t key = keys[s + j];
+			uint16_t h[2];
+
+			_inthash2(key, (uint32_t*)h);
+
+			h[0] = h[0] % 401;
+			h[1] = h[1] % 401;
+			hb[j][0] = h[0];
+			__builtin_prefetch(&g[h[0]]);
+			hb[j][1] = h[1];
+			__builtin_prefetch(&g[h[1]]);
+		}
+		for (size_t j = 0; j < nb; j++) {
+			const uint16_t *h = hb[j];
+			uint16_t result = (g[h[0]] + g[h[1]]) % 200;
+			out[s + j] = result;
+		}
+	}
+}
+
+#if defined NBPERF_DISPATCH || defined __AVX512F__
+#ifdef NBPERF_DISPATCH
+__attribute__((target("avx512f")))
+#endif
+static size_t
+inthash_x8_avx512(const int32_t *keys, uint32_t *out, size_t n)
+{
+	size_t i = 0;
+	const __m512i mul = _mm512_set1_epi32((int)UINT32_C(0x56c372d0));
+	const __m512i add = _mm512_set1_epi32((int)UINT32_C(846930886));
+	const __m512i lo16 = _mm512_set1_epi32(0xffff);
+	const __m512i m = _mm512_set1_epi32((int)(UINT32_C(0xFFFFFFFF) / 401 + 1));
+	const __m512i v = _mm512_set1_epi32(401);
+	const __m512i e = _mm512_set1_epi32(200);
+	const __m512i gmask = _mm512_set1_epi32(0xffff);
+
+	for (; i + 16 <= n; i += 16) {
+		const __m512i k = _mm512_loadu_si512((const void *)(keys + i));
+		const __m512i h = _mm512_add_epi32(_mm512_mullo_epi32(k, mul), add);
+		__m512i h0 = _mm512_and_si512(h, lo16);
+		__m512i h1 = _mm512_srli_epi32(h, 16);
+		h0 = _mm512_mullo_epi32(h0, m);
+		h0 = _mm512_mask_blend_epi32(0xAAAA,
+		    _mm512_srli_epi64(_mm512_mul_epu32(h0, v), 32),
+		    _mm512_mul_epu32(_mm512_srli_epi64(h0, 32), v));
+		h1 = _mm512_mullo_epi32(h1, m);
+		h1 = _mm512_mask_blend_epi32(0xAAAA,
+		    _mm512_srli_epi64(_mm512_mul_epu32(h1, v), 32),
+		    _mm512_mul_epu32(_mm512_srli_epi64(h1, 32), v));
+		const __m512i g0 = _mm512_and_si512(gmask, _mm512_i32gather_epi32(h0, (const void *)inthash_g, 2));
+		const __m512i g1 = _mm512_and_si512(gmask, _mm512_i32gather_epi32(h1, (const void *)inthash_g, 2));
+		__m512i r = _mm512_add_epi32(g0, g1);
+		r = _mm512_mask_sub_epi32(r, _mm512_cmpge_epu32_mask(r, e), r, e);
+		_mm512_storeu_si512((void *)(out + i), r);
+	}
+	return i;
+}
+#endif
+
+#if defined NBPERF_DISPATCH || defined __AVX2__ && !defined __AVX512F__
+#ifdef NBPERF_DISPATCH
+__attribute__((target("avx2")))
+#endif
+static size_t
+inthash_x8_avx2(const int32_t *keys, uint32_t *out, size_t n)
+{
+	size_t i = 0;
+	const __m256i mul = _mm256_set1_epi32((int)UINT32_C(0x56c372d0));
+	const __m256i add = _mm256_set1_epi32((int)UINT32_C(846930886));
+	const __m256i lo16 = _mm256_set1_epi32(0xffff);
+	const __m256i m = _mm256_set1_epi32((int)(UINT32_C(0xFFFFFFFF) / 401 + 1));
+	const __m256i v = _mm256_set1_epi32(401);
+	const __m256i e = _mm256_set1_epi32(200);
+	const __m256i gmask = _mm256_set1_epi32(0xffff);
+
+	for (; i + 8 <= n; i += 8) {
+		const __m256i k = _mm256_loadu_si256((const __m256i *)(keys + i));
+		const __m256i h = _mm256_add_epi32(_mm256_mullo_epi32(k, mul), add);
+		__m256i h0 = _mm256_and_si256(h, lo16);
+		__m256i h1 = _mm256_srli_epi32(h, 16);
+		h0 = _mm256_mullo_epi32(h0, m);
+		h0 = _mm256_blend_epi32(
+		    _mm256_srli_epi64(_mm256_mul_epu32(h0, v), 32),
+		    _mm256_mul_epu32(_mm256_srli_epi64(h0, 32), v), 0xAA);
+		h1 = _mm256_mullo_epi32(h1, m);
+		h1 = _mm256_blend_epi32(
+		    _mm256_srli_epi64(_mm256_mul_epu32(h1, v), 32),
+		    _mm256_mul_epu32(_mm256_srli_epi64(h1, 32), v), 0xAA);
+		const __m256i g0 = _mm256_and_si256(gmask, _mm256_i32gather_epi32((const int *)inthash_g, h0, 2));
+		const __m256i g1 = _mm256_and_si256(gmask, _mm256_i32gather_epi32((const int *)inthash_g, h1, 2));
+		__m256i r = _mm256_add_epi32(g0, g1);
+		r = _mm256_sub_epi32(r, _mm256_and_si256(_mm256_cmpgt_epi32(r,
+		    _mm256_sub_epi32(e, _mm256_set1_epi32(1))), e));
+		_mm256_storeu_si256((void *)(out + i), r);
+	}
+	return i;
+}
+#endif
+
+void
+inthash_x8(const int32_t *keys, uint32_t *out, size_t n)
+{
+	size_t i = 0;
+#if defined NBPERF_DISPATCH
+	if (__builtin_cpu_supports("avx512f"))
+		i = inthash_x8_avx512(keys, out, n);
+	else if (__builtin_cpu_supports("avx2"))
+		i = inthash_x8_avx2(keys, out, n);
+#elif defined __AVX512F__
+	i = inthash_x8_avx512(keys, out, n);
+#elif defined __AVX2__
+	i = inthash_x8_avx2(keys, out, n);
+#endif
+	for (; i < n; i++) {
+		const uint16_t r = inthash(keys[i]);
+		out[i] = r;
+	}
+}
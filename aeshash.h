@@ -0,0 +1,262 @@
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * aeshash2 and aeshash4: 2 or 4 32bit hashes of the key from AES rounds,
+ * for long keys.  Four 128bit lanes absorb 64 bytes per step with one
+ * AES round each, the last 1 - 16 bytes go to the last lane, and the
+ * lanes are folded with three more rounds.  The AES-NI instructions and
+ * the portable version compute the same values, so a hash built on one
+ * host works on any other.  With -maes the instructions are used
+ * directly, otherwise on x86 with GCC or clang they are selected at
+ * run-time with cpuid, on the first call.  Define NBPERF_AESHASH_SW to
+ * always use the portable version, or NBPERF_AESHASH_DISPATCH to select
+ * at run-time also with -maes.
+ */
+#if defined NBPERF_AESHASH_SW
+#elif defined __GNUC__ && (defined __x86_64__ || defined __i386__) && \
+    (!defined __AES__ || defined NBPERF_AESHASH_DISPATCH)
+# define AESHASH_HW
+# ifndef NBPERF_AESHASH_DISPATCH
+#  define NBPERF_AESHASH_DISPATCH
+# endif
+# include <wmmintrin.h>
+#elif defined __AES__ && (defined __x86_64__ || defined __i386__)
+# define AESHASH_HW
+# include <wmmintrin.h>
+#endif
+
+/* the key k = seed0, seed1, seed0, seed1 xor these: 4 lanes, absorb, final */
+static const uint32_t aeshash_c[6][4] = {
+	{ 0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344 },
+	{ 0xA4093822, 0x299F31D0, 0x082EFA98, 0xEC4E6C89 },
+	{ 0x452821E6, 0x38D01377, 0xBE5466CF, 0x34E90C6C },
+	{ 0xC0AC29B7, 0xC97C50DD, 0x3F84D5B5, 0xB5470917 },
+	{ 0x9216D5D9, 0x8979FB1B, 0xD1310BA6, 0x98DFB5AC },
+	{ 0x2FFD72DB, 0xD01ADFB7, 0xB8E1AFED, 0x6A267E96 },
+};
+
+static inline uint32_t
+aeshash_le32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 |
+	    (uint32_t)p[3] << 24;
+}
+
+/* the key xor aeshash_c[i], as bytes */
+static inline void
+aeshash_key(uint8_t k[16], uint64_t seed, size_t i)
+{
+	unsigned j;
+	for (j = 0; j < 4; j++) {
+		const uint32_t w = (uint32_t)(seed >> (j & 1 ? 32 : 0)) ^
+		    aeshash_c[i][j];
+		k[4 * j] = (uint8_t)w;
+		k[4 * j + 1] = (uint8_t)(w >> 8);
+		k[4 * j + 2] = (uint8_t)(w >> 16);
+		k[4 * j + 3] = (uint8_t)(w >> 24);
+	}
+}
+
+#if !defined AESHASH_HW || defined NBPERF_AESHASH_DISPATCH
+
+static const uint8_t aeshash_sbox[256] = {
+	0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b,
+	0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+	0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26,
+	0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+	0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2,
+	0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+	0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed,
+	0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+	0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f,
+	0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+	0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec,
+	0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+	0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14,
+	0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+	0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d,
+	0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+	0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f,
+	0x4b, 0xbd, 0x8b, 0x8a, 0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+	0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e, 0xe1, 0xf8, 0x98, 0x11,
+	0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+	0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f,
+	0xb0, 0x54, 0xbb, 0x16
+};
+
+static inline uint8_t
+aeshash_xtime(uint8_t x)
+{
+	return (uint8_t)((x << 1) ^ ((x >> 7) * 0x1b));
+}
+
+/* s = MixColumns(ShiftRows(SubBytes(s))) ^ k, as aesenc */
+static inline void
+aeshash_enc(uint8_t s[16], const uint8_t k[16])
+{
+	uint8_t t[16];
+	unsigned i;
+
+	for (i = 0; i < 16; i++)
+		t[i] = aeshash_sbox[s[(i + 4 * (i % 4)) % 16]];
+	for (i = 0; i < 16; i += 4) {
+		const uint8_t all = t[i] ^ t[i + 1] ^ t[i + 2] ^ t[i + 3];
+		s[i] = t[i] ^ all ^ aeshash_xtime(t[i] ^ t[i + 1]) ^ k[i];
+		s[i + 1] = t[i + 1] ^ all ^ aeshash_xtime(t[i + 1] ^ t[i + 2]) ^
+		    k[i + 1];
+		s[i + 2] = t[i + 2] ^ all ^ aeshash_xtime(t[i + 2] ^ t[i + 3]) ^
+		    k[i + 2];
+		s[i + 3] = t[i + 3] ^ all ^ aeshash_xtime(t[i + 3] ^ t[i]) ^
+		    k[i + 3];
+	}
+}
+
+static inline void
+aeshash_xor(uint8_t s[16], const uint8_t *p)
+{
+	unsigned i;
+	for (i = 0; i < 16; i++)
+		s[i] ^= p[i];
+}
+
+static inline void
+aeshash_sw(const void *key, size_t len, uint64_t seed, uint32_t *hashes,
+    unsigned n)
+{
+	const uint8_t *p = (const uint8_t *)key;
+	uint8_t l[4][16], k[16], f[16], x[16];
+	unsigned i;
+
+	for (i = 0; i < 4; i++)
+		aeshash_key(l[i], seed, i);
+	aeshash_key(k, seed, 4);
+	aeshash_key(f, seed, 5);
+	for (i = 0; i < 8; i++)
+		l[0][i] ^= (uint8_t)((uint64_t)len >> (8 * i));
+	if (len <= 16) {
+		memset(x, 0, sizeof(x));
+		if (len)
+			memcpy(x, p, len);
+	} else {
+		for (; len > 64; len -= 64, p += 64)
+			for (i = 0; i < 4; i++) {
+				aeshash_xor(l[i], p + 16 * i);
+				aeshash_enc(l[i], k);
+			}
+		for (i = 0; 16 * i + 16 < len; i++) {
+			aeshash_xor(l[i], p + 16 * i);
+			aeshash_enc(l[i], k);
+		}
+		memcpy(x, p + len - 16, 16);
+	}
+	aeshash_xor(l[3], x);
+	aeshash_enc(l[3], k);
+	aeshash_xor(l[0], l[2]);
+	aeshash_enc(l[0], f);
+	aeshash_xor(l[1], l[3]);
+	aeshash_enc(l[1], f);
+	aeshash_enc(l[0], l[1]);
+	aeshash_enc(l[0], f);
+	for (i = 0; i < n; i++)
+		hashes[i] = aeshash_le32(l[0] + 4 * i);
+}
+
+#endif
+
+#ifdef AESHASH_HW
+
+#ifdef NBPERF_AESHASH_DISPATCH
+#define AESHASH_TARGET __attribute__((target("aes,sse2")))
+#else
+#define AESHASH_TARGET
+#endif
+
+AESHASH_TARGET static inline void
+aeshash_hw(const void *key, size_t len, uint64_t seed, uint32_t *hashes,
+    unsigned n)
+{
+	const uint8_t *p = (const uint8_t *)key;
+	const __m128i s = _mm_set_epi64x((long long)seed, (long long)seed);
+	const __m128i k = _mm_xor_si128(s,
+	    _mm_loadu_si128((const __m128i *)aeshash_c[4]));
+	const __m128i f = _mm_xor_si128(s,
+	    _mm_loadu_si128((const __m128i *)aeshash_c[5]));
+	uint8_t b[16];
+	__m128i l[4], x;
+	unsigned i;
+
+	for (i = 0; i < 4; i++)
+		l[i] = _mm_xor_si128(s,
+		    _mm_loadu_si128((const __m128i *)aeshash_c[i]));
+	l[0] = _mm_xor_si128(l[0], _mm_set_epi64x(0, (long long)len));
+	if (len <= 16) {
+		memset(b, 0, sizeof(b));
+		if (len)
+			memcpy(b, p, len);
+		x = _mm_loadu_si128((const __m128i *)b);
+	} else {
+		for (; len > 64; len -= 64, p += 64)
+			for (i = 0; i < 4; i++)
+				l[i] = _mm_aesenc_si128(_mm_xor_si128(l[i],
+				    _mm_loadu_si128((const __m128i *)(p + 16 * i))), k);
+		for (i = 0; 16 * i + 16 < len; i++)
+			l[i] = _mm_aesenc_si128(_mm_xor_si128(l[i],
+			    _mm_loadu_si128((const __m128i *)(p + 16 * i))), k);
+		x = _mm_loadu_si128((const __m128i *)(p + len - 16));
+	}
+	l[3] = _mm_aesenc_si128(_mm_xor_si128(l[3], x), k);
+	l[0] = _mm_aesenc_si128(_mm_xor_si128(l[0], l[2]), f);
+	l[1] = _mm_aesenc_si128(_mm_xor_si128(l[1], l[3]), f);
+	l[0] = _mm_aesenc_si128(_mm_aesenc_si128(l[0], l[1]), f);
+	_mm_storeu_si128((__m128i *)b, l[0]);
+	for (i = 0; i < n; i++)
+		hashes[i] = aeshash_le32(b + 4 * i);
+}
+
+#endif
+
+#if defined NBPERF_AESHASH_DISPATCH
+
+typedef void (*aeshash_fn)(const void *, size_t, uint64_t, uint32_t *,
+    unsigned);
+
+static inline void aeshash_resolve(const void *, size_t, uint64_t,
+    uint32_t *, unsigned);
+static aeshash_fn aeshash_impl __attribute__((unused)) = aeshash_resolve;
+
+/* the first call replaces the function pointer */
+static inline void
+aeshash_resolve(const void *key, size_t len, uint64_t seed, uint32_t *hashes,
+    unsigned n)
+{
+	aeshash_fn fn;
+
+	__builtin_cpu_init();
+	fn = __builtin_cpu_supports("aes") ? aeshash_hw : aeshash_sw;
+	__atomic_store_n(&aeshash_impl, fn, __ATOMIC_RELAXED);
+	fn(key, len, seed, hashes, n);
+}
+
+#define AESHASH(key, len, seed, hashes, n) \
+	__atomic_load_n(&aeshash_impl, __ATOMIC_RELAXED)(key, len, seed, \
+	    hashes, n)
+#elif defined AESHASH_HW
+#define AESHASH aeshash_hw
+#else
+#define AESHASH aeshash_sw
+#endif
+
+/* for chm or hashes16 */
+static inline void
+aeshash2(const void *key, size_t len, uint64_t seed, uint32_t *hashes)
+{
+	AESHASH(key, len, seed, hashes, 2);
+}
+
+static inline void
+aeshash4(const void *key, size_t len, uint64_t seed, uint32_t *hashes)
+{
+	AESHASH(key, len, seed, hashes, 4);
+}
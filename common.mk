@@ -3,15 +3,17 @@
 
 PROG=	nbperf
 SRCS=	nbperf.c
-SRCS+=	nbperf-bdz.c nbperf-chm.c nbperf-chm3.c	graph2.c graph3.c
-HEADERS = mi_vector_hash.h mi_wyhash.h wyhash.h fnv3.h crc3.h
+SRCS+=	nbperf-bdz.c nbperf-chm.c nbperf-chm3.c	nbperf-monotone.c nbperf-tiny.c \
+	nbperf-dense.c graph2.c graph3.c
+HEADERS = mi_vector_hash.h mi_wyhash.h wyhash.h fnv3.h crc3.h aeshash.h \
+	  nbperf_rcu.h nbperf_constexpr.h nbperf_static_map.h
 WORDS = /usr/share/dict/words
 RANDBIG = _randbig
 RANDHEX = _randhex
 
 $(PROG): $(SRCS) mi_vector_hash.c mi_vector_hash.h wyhash.h nbtool_config.h VERSION
 	$(CC) $(CFLAGS) -DVERSION="\"$(shell cat VERSION)\"" -DHAVE_NBTOOL_CONFIG_H $(SRCS) \
-	  mi_vector_hash.c -o $@ -lm
+	  mi_vector_hash.c -o $@ -lm -pthread
 perf: perf.h perf_test.c perf.cc
 	c++ $(CFLAGS) perf.cc -o $@
 VERSION: nbtool_config.h $(SRC) $(HEADERS) README.md nbperf.1
@@ -23,14 +25,55 @@ $(RANDHEX):
 	seq 2000 | random | xargs printf "0x%x\n" > $@
 _rand200:
 	seq 200 | random > $@
+_randruns:
+	(seq 100 400; seq 1000 2 1400; seq 70000 7000 1000000) \
+	  | random > $@
+# 32-bit keys, above 16 bit and negative
+_randneg:
+	seq 2000 | random | while read i; do echo $$((i * 70001 - 70000000)); done > $@
+_seq200:
+	seq 200 > $@
+# 64-bit keys with the same lower half, negative or hex
+_rand64:
+	seq 2000 | random | while read i; do \
+	  if [ $$((i % 2)) = 1 ]; then echo $$((-(i << 33) + 5)); \
+	  else printf '0x%x\n' $$(((i << 33) + 5)); fi; done > $@
+_dense64:
+	seq 2000 | random | while read i; do echo $$(((1 << 40) + i)); done > $@
+# UUIDs, as text and as 16 byte records
+_uuids:
+	seq 2000 | random | while read i; do \
+	  printf '%08x-%04x-4%03x-8%03x-%012x\n' \
+	    $$((i * 2654435761 % 4294967296)) $$((i % 65536)) \
+	    $$((i % 4096)) $$((i * 7 % 4096)) $$((i * i)); done > $@
+_uuids.bin: _uuids
+	perl -ne 'chomp; s/-//g; print pack("H*", $$_)' _uuids > $@
+# a 64-bit and a small field
+_pairs:
+	seq 2000 | random | while read i; do \
+	  echo $$(((i << 33) + 5)) $$((i % 16)); done > $@
+# 128-bit hashes, as text and as the records of h_lo, h_hi
+_hashes:
+	seq 2000 | random | while read i; do \
+	  printf '%016x%016x\n' $$((i * 0x2545F4914F6CDD1D)) \
+	    $$((i * 0x1E3779B97F4A7C15)); done > $@
+_hashes.bin: _hashes
+	perl -ne 'print pack("Q<Q<", hex(substr($$_, 16, 16)), hex(substr($$_, 0, 16)))' \
+	  _hashes > $@
 _words: $(WORDS)
 	cp $(WORDS) $@
 _words1000:
 	head -n 1000 $(WORDS) > $@
 _words100:
 	head -n 100 $(WORDS) > $@
+_words64:
+	head -n 64 $(WORDS) > $@
+_words_sorted: $(WORDS)
+	LC_ALL=C sort -u $(WORDS) > $@
 
-check: $(PROG) _words1000 _words $(RANDBIG) $(RANDHEX) _rand200
+check: $(PROG) _words1000 _words64 _words _words_sorted $(RANDBIG) $(RANDHEX) _rand200 \
+	  _randruns _randneg _seq200 _rand64 _dense64 _uuids _uuids.bin _pairs \
+	  _hashes _hashes.bin
 	@echo test building a few with big sets
 	./$(PROG) -o _test_chm.c $(WORDS)
 	$(CC) $(CFLAGS) -I. -Dchm -o _test_chm _test_chm.c test_main.c mi_vector_hash.c
@@ -50,6 +93,77 @@ check: $(PROG) _words1000 _words $(RANDBIG) $(RANDHEX) _rand200
 	./$(PROG) -M -a bdz -o _test_Mbdz.c -m _words.map _words
 	$(CC) $(CFLAGS) -I. -Dbdz -o _test_Mbdz _test_Mbdz.c test_main.c mi_vector_hash.c
 	./_test_Mbdz _words
+	./$(PROG) -d -O 8 -o _test_Ochm.c _words
+	$(CC) $(CFLAGS) -I. -Dchm -D_OVERFLOW -o _test_Ochm _test_Ochm.c test_main.c mi_vector_hash.c
+	./_test_Ochm _words
+	./$(PROG) -d -O 8 -a bdz -o _test_Obdz.c -m _words.map _words
+	$(CC) $(CFLAGS) -I. -Dbdz -D_OVERFLOW -o _test_Obdz _test_Obdz.c test_main.c mi_vector_hash.c
+	./_test_Obdz _words
+	./$(PROG) -b -d -a chm3 -o _test_Bchm3.c _words
+	$(CC) $(CFLAGS) -I. -Dchm3 -D_BATCH -o _test_Bchm3 _test_Bchm3.c test_main.c mi_vector_hash.c
+	./_test_Bchm3 _words
+	./$(PROG) -g -b -a chm3 -o _test_Gchm3.c _words
+	$(CC) $(CFLAGS) -I. -Dchm3 -D_BATCH -o _test_Gchm3 _test_Gchm3.c test_main.c mi_vector_hash.c
+	./_test_Gchm3 _words
+	./$(PROG) -F 16 -b -d -a chm3 -o _test_Fchm3.c _words
+	$(CC) $(CFLAGS) -I. -Dchm3 -D_BATCH -D_MISSES -o _test_Fchm3 _test_Fchm3.c test_main.c mi_vector_hash.c
+	./_test_Fchm3 _words
+	./$(PROG) -k -b -d -o _test_Kchm.c _words
+	$(CC) $(CFLAGS) -I. -Dchm -D_BATCH -o _test_Kchm _test_Kchm.c test_main.c mi_vector_hash.c
+	./_test_Kchm _words
+	./$(PROG) -e _test_Echm.bin -k -b -d -o _test_Echm.c _words
+	$(CC) $(CFLAGS) -I. -Dchm -D_BATCH -o _test_Echm _test_Echm.c test_main.c mi_vector_hash.c
+	./_test_Echm _words
+	./$(PROG) -e _test_Ebdz.bin -b -a bdz -o _test_Ebdz.c -m _words.map _words
+	$(CC) $(CFLAGS) -I. -Dbdz -D_BATCH -o _test_Ebdz _test_Ebdz.c test_main.c mi_vector_hash.c
+	./_test_Ebdz _words
+	./$(PROG) -S -d -o _test_Schm.c _words
+	$(CC) $(CFLAGS) -I. -Dchm -D_MISSES -o _test_Schm _test_Schm.c test_main.c
+	./_test_Schm _words
+	./$(PROG) -S -d -b -a bdz -o _test_Sbdz.c -m _words.map _words
+	$(CC) $(CFLAGS) -I. -Dbdz -D_BATCH -D_MISSES -o _test_Sbdz _test_Sbdz.c test_main.c
+	./_test_Sbdz _words
+	./$(PROG) -K -d -o _test_chm_keypos.c _words
+	$(CC) $(CFLAGS) -I. -Dchm -D_MISSES -o _test_chm_keypos _test_chm_keypos.c test_main.c mi_vector_hash.c
+	./_test_chm_keypos _words
+	./$(PROG) -K -d -b -h fnv -a bdz -o _test_bdz_keypos.c -m _words.map _words
+	$(CC) $(CFLAGS) -I. -Dbdz -D_BATCH -D_MISSES -o _test_bdz_keypos _test_bdz_keypos.c test_main.c
+	./_test_bdz_keypos _words
+	./$(PROG) -a tiny -o _test_tiny.c _words1000
+	$(CC) $(CFLAGS) -I. -Dchm -D_MISSES -o _test_tiny _test_tiny.c test_main.c
+	./_test_tiny _words1000
+	./$(PROG) -d -o _test_dtiny.c _words64
+	$(CC) $(CFLAGS) -I. -Dchm -D_MISSES -o _test_dtiny _test_dtiny.c test_main.c
+	./_test_dtiny _words64
+	./$(PROG) -C -d -n words -o _test_Cchm.hh _words1000
+	c++ $(CFLAGS) -std=c++17 -I. -c -o _test_Cchm.o test_constexpr.cc
+	$(CC) $(CFLAGS) -I. -Dchm -o _test_Cchm _test_Cchm.o test_main.c
+	./_test_Cchm _words1000
+	./$(PROG) -b -a bdz -o _test_Bbdz.c -m _words.map _words
+	$(CC) $(CFLAGS) -I. -Dbdz -D_BATCH -o _test_Bbdz _test_Bbdz.c test_main.c mi_vector_hash.c
+	./_test_Bbdz _words
+	./$(PROG) -b -r 1 -a bdz -o _test_Rbdz.c -m _words.map _words
+	$(CC) $(CFLAGS) -I. -Dbdz -D_BATCH -o _test_Rbdz _test_Rbdz.c test_main.c mi_vector_hash.c
+	./_test_Rbdz _words
+	./$(PROG) -g -b -a bdz -o _test_Gbdz.c _words
+	$(CC) $(CFLAGS) -I. -Dbdz -D_BATCH -o _test_Gbdz _test_Gbdz.c test_main.c mi_vector_hash.c
+	./_test_Gbdz _words
+	./$(PROG) -b -I -o _test_x8.c _rand200
+	$(CC) $(CFLAGS) -I. -D_INTKEYS -Dchm -D_X8 -o _test_x8 _test_x8.c test_main.c
+	./_test_x8 _rand200
+	./$(PROG) -b -I -d -a chm -o _test_dx8.c _randneg
+	$(CC) $(CFLAGS) -I. -D_INTKEYS -Dchm -D_X8 -o _test_dx8 _test_dx8.c test_main.c
+	./_test_dx8 _randneg
+	./$(PROG) -d -a chm -n rcu_a -o _test_rcu_a.c _words64
+	./$(PROG) -d -a chm -n rcu_b -o _test_rcu_b.c _words1000
+	$(CC) $(CFLAGS) -I. -pthread -o _test_rcu test_rcu.c _test_rcu_a.c \
+	  _test_rcu_b.c mi_vector_hash.c
+	./_test_rcu
+	c++ $(CFLAGS) -std=c++17 -I. -o _test_static_map test_static_map.cc
+	./_test_static_map
+	./$(PROG) -P -a bdz -o _test_Pbdz.c -m _words.map _words
+	$(CC) $(CFLAGS) -I. -Dbdz -D_NONMINIMAL -o _test_Pbdz _test_Pbdz.c test_main.c mi_vector_hash.c
+	./_test_Pbdz _words
 	./$(PROG) -h wyhash -o _test_chm_wy.c $(WORDS)
 	$(CC) $(CFLAGS) -I. -Dchm -o _test_chm_wy _test_chm_wy.c test_main.c
 	./_test_chm_wy $(WORDS)
@@ -59,23 +173,80 @@ check: $(PROG) _words1000 _words $(RANDBIG) $(RANDHEX) _rand200
 	./$(PROG) -h wyhash -a chm3 -o _test_chm3_wy.c $(WORDS)
 	$(CC) $(CFLAGS) -I. -Dchm3 -o _test_chm3_wy _test_chm3_wy.c test_main.c
 	./_test_chm3_wy $(WORDS)
+	./$(PROG) -h crc -o _test_chm_crc.c _words
+	$(CC) $(CFLAGS) -I. -Dchm -DNBPERF_CRC_SW -o _test_chm_crc _test_chm_crc.c test_main.c
+	./_test_chm_crc _words
+	./$(PROG) -h crc -a chm3 -o _test_chm3_crc.c _words
+	$(CC) $(CFLAGS) -I. -Dchm3 -DNBPERF_CRC_DISPATCH -o _test_chm3_crc _test_chm3_crc.c test_main.c
+	./_test_chm3_crc _words
+	./$(PROG) -h aeshash -a chm3 -o _test_chm3_aes.c _words
+	$(CC) $(CFLAGS) -I. -Dchm3 -DNBPERF_AESHASH_SW -o _test_chm3_aes _test_chm3_aes.c test_main.c
+	./_test_chm3_aes _words
+	./$(PROG) -a monotone -o _test_monotone.c _words_sorted
+	$(CC) $(CFLAGS) -I. -Dmonotone -o _test_monotone _test_monotone.c test_main.c mi_vector_hash.c
+	./_test_monotone _words_sorted
+	./$(PROG) -h wyhash -a monotone -d -o _test_monotone_wy.c _words_sorted
+	$(CC) $(CFLAGS) -I. -Dmonotone -o _test_monotone_wy _test_monotone_wy.c test_main.c
+	./_test_monotone_wy _words_sorted
 	@echo
 	@echo test building intkeys
-	./$(PROG) -I -o _test_int.c $(RANDBIG)
+	./$(PROG) -I -a chm -o _test_int.c $(RANDBIG)
 	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS -o _test_int _test_int.c test_main.c
 	./_test_int $(RANDBIG)
+	./$(PROG) -I -d -a chm -o _test_intneg.c _randneg
+	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS -o _test_intneg _test_intneg.c test_main.c
+	./_test_intneg _randneg
+	./$(PROG) -I -d -a chm3 -o _test_intneg3.c _randneg
+	$(CC) $(CFLAGS) -I. -Dchm3 -D_INTKEYS -o _test_intneg3 _test_intneg3.c test_main.c
+	./_test_intneg3 _randneg
 	./$(PROG) -I -a bdz -o _test_intbdz.c -m $(RANDBIG).map $(RANDBIG)
 	$(CC) $(CFLAGS) -I. -Dbdz -D_INTKEYS -o _test_intbdz _test_intbdz.c test_main.c
 	./_test_intbdz $(RANDBIG)
-	./$(PROG) -I -o _test_inthex.c $(RANDHEX)
+	./$(PROG) -I -a chm -o _test_inthex.c $(RANDHEX)
 	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS -o _test_inthex _test_inthex.c test_main.c
 	./_test_inthex $(RANDHEX)
 	./$(PROG) -IM -o _test_Mint.c $(RANDBIG)
 	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS -o _test_Mint _test_Mint.c test_main.c
 	./_test_Mint $(RANDBIG)
-	./$(PROG) -Ipd -o _test_dint.c _rand200
+	./$(PROG) -Ipd -a chm -o _test_dint.c _rand200
 	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS -o _test_dint _test_dint.c test_main.c
 	./_test_dint _rand200
+	./$(PROG) -I -o _test_dense.c $(RANDBIG)
+	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS -o _test_dense _test_dense.c test_main.c
+	./_test_dense $(RANDBIG)
+	./$(PROG) -I -o _test_dense_runs.c _randruns
+	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS -o _test_dense_runs _test_dense_runs.c test_main.c
+	./_test_dense_runs _randruns
+	./$(PROG) -I -o _test_dense_seq.c _seq200
+	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS -o _test_dense_seq _test_dense_seq.c test_main.c
+	./_test_dense_seq _seq200
+	./$(PROG) -L -d -o _test_int64.c _rand64
+	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS64 -o _test_int64 _test_int64.c test_main.c
+	./_test_int64 _rand64
+	./$(PROG) -L -a chm3 -o _test_int64chm3.c _rand64
+	$(CC) $(CFLAGS) -I. -Dchm3 -D_INTKEYS64 -o _test_int64chm3 _test_int64chm3.c test_main.c
+	./_test_int64chm3 _rand64
+	./$(PROG) -L -o _test_dense64.c _dense64
+	$(CC) $(CFLAGS) -I. -Dchm -D_INTKEYS64 -o _test_dense64 _test_dense64.c test_main.c
+	./_test_dense64 _dense64
+	./$(PROG) -B 16 -d -o _test_fixed.c _uuids
+	$(CC) $(CFLAGS) -I. -Dchm -D_FIXED16 -o _test_fixed _test_fixed.c test_main.c
+	./_test_fixed _uuids
+	./$(PROG) -B 16 -R -a chm3 -o _test_fixed_raw.c _uuids.bin
+	$(CC) $(CFLAGS) -I. -Dchm3 -D_FIXED16 -o _test_fixed_raw _test_fixed_raw.c test_main.c
+	./_test_fixed_raw _uuids
+	./$(PROG) -B 16 -a bdz -o _test_fixed_bdz.c -m _uuids.map _uuids
+	$(CC) $(CFLAGS) -I. -Dbdz -D_FIXED16 -o _test_fixed_bdz _test_fixed_bdz.c test_main.c
+	./_test_fixed_bdz _uuids
+	./$(PROG) -B u64,u32 -d -o _test_fields.c _pairs
+	$(CC) $(CFLAGS) -I. -Dchm -D_FIELDS -o _test_fields _test_fields.c test_main.c
+	./_test_fields _pairs
+	./$(PROG) -H 128 -d -o _test_prehashed.c _hashes
+	$(CC) $(CFLAGS) -I. -Dchm -D_PREHASHED -o _test_prehashed _test_prehashed.c test_main.c
+	./_test_prehashed _hashes
+	./$(PROG) -H 128 -R -a chm3 -o _test_prehashed_raw.c _hashes.bin
+	$(CC) $(CFLAGS) -I. -Dchm3 -D_PREHASHED -o _test_prehashed_raw _test_prehashed_raw.c test_main.c
+	./_test_prehashed_raw _hashes
 	@echo
 	@echo test all combinations and results with a small set
 	CFLAGS="$(CFLAGS)" ./test
@@ -85,7 +256,8 @@ run-perf: $(PROG) perf
 	./perf && ./perf_img.sh && rm VERSION
 
 clean:
-	-rm -f $(PROG) _test_* test_{bdz,chm,chm3}* _words* _rand* a.out \
+	-rm -f $(PROG) _test_* test_{bdz,chm,chm3}* _words* _rand* _seq* _dense64 \
+	  _uuids* _pairs _hashes* a.out \
 	  perf _perf_*
 install: $(PROG)
 	sudo cp $(PROG) /usr/local/bin/
@@ -231,11 +231,11 @@ SIZED2(_hash)(struct nbperf *nbperf, struct SIZED(graph) * graph)
 
 	for (i = 0; i < graph->e; ++i) {
 		if (nbperf->hashes16)
-			(*nbperf->compute_hash)(nbperf, nbperf->keys[i],
-			    nbperf->keylens[i], (uint32_t *)hashes16);
+			(*nbperf->compute_hash)(nbperf, nbperf->hash_keys[i],
+			    nbperf->hash_keylens[i], (uint32_t *)hashes16);
 		else
-			(*nbperf->compute_hash)(nbperf, nbperf->keys[i],
-			    nbperf->keylens[i], hashes);
+			(*nbperf->compute_hash)(nbperf, nbperf->hash_keys[i],
+			    nbperf->hash_keylens[i], hashes);
 		e = graph->edges + i;
 		for (j = 0; j < GRAPH_SIZE; ++j) {
 			if (nbperf->hashes16)
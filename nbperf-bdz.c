@@ -79,11 +79,9 @@ struct state {
 	struct SIZED(graph) graph;
 	//uint32_t r;
 	uint8_t *visited;
-	uint32_t *ranking;
 	uint8_t *g;
         unsigned g_size;
         unsigned visited_size;
-        unsigned ranking_size;
 };
 
 static const uint8_t bitmask[] = {
@@ -99,25 +97,6 @@ static const uint8_t valuemask[] = { 0xfc, 0xf3, 0xcf, 0x3f };
 #define SETI2(g, i, v) (g[i >> 2] &= (uint8_t)((v << ((i & 3) << 1)) | valuemask[i & 3]))
 #define UNVISITED 3
 
-static const uint8_t bits_per_byte[256] = {
-        4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,
-        4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,
-        4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,
-        3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,
-        4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,
-        4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,
-        4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,
-        3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,
-        4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,
-        4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,
-        4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,
-        3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,
-        3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,
-        3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,
-        3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,
-        2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 1, 1, 1, 0
-};
-
 static void
 assign_nodes(struct state *state)
 {
@@ -170,27 +149,516 @@ assign_nodes(struct state *state)
 	}
 }
 
-// build the ranking table: number of bits in g
+// the authoritive vertex of key i
+static uint32_t
+key_vertex(struct state *state, uint32_t i)
+{
+	const uint32_t *v = state->graph.edges[i].vertices;
+	return v[(GETI2(state->g, v[0]) + GETI2(state->g, v[1]) +
+		     GETI2(state->g, v[2])) % 3];
+}
+
+// with -P the keys are indexed by their vertex
 static void
-ranking(struct state *state)
+embed_data_vertex(struct nbperf *nbperf, struct state *state)
+{
+	const char **keys;
+	uint32_t i;
+
+	keys = calloc(state->graph.va, sizeof(*keys));
+	if (keys == NULL)
+		err(1, "malloc failed");
+	for (i = 0; i < state->graph.e; i++)
+		keys[key_vertex(state, i)] = nbperf->keys[i];
+	fprintf(nbperf->output, "%sconst char * const %s_keys[%" PRIu32 "] = {\n",
+		nbperf->static_hash ? "static " : "",
+		nbperf->hash_name, state->graph.va);
+	for (i = 0; i < state->graph.va; i++) {
+		if (!i)
+			fprintf(nbperf->output, "\t");
+		if (keys[i])
+			fprintf(nbperf->output, "\"%s\",", keys[i]);
+		else
+			fprintf(nbperf->output, "NULL,");
+		if ((i + 1) % 4)
+			fprintf(nbperf->output, " ");
+		else
+			fprintf(nbperf->output, "\t/* %u */\n\t", i + 1);
+	}
+	fprintf(nbperf->output, "};\n\n");
+	free(keys);
+}
+
+/*
+ * With ranking, g is interleaved with the rank samples, similar to rank9:
+ * each block is one 64bit header and rank_words (1, 3 or 7) words of g,
+ * 32 vertices per word.  With 7 words a block is one 64 byte cache line.
+ * The header holds the rank of the block in the lower 32 bits, and in
+ * the upper 32 bits 4 8bit sub-ranks, the number of assigned vertices
+ * before every step'th word of the block.  The rank of a vertex is then
+ * the header plus at most one full and one masked popcount of the words.
+ */
+#define RANK_STEP(w) (((w) + 3) / 4)
+
+// g byte of vertex i as emitted before, i.e. 0 after the g_size bytes
+static uint8_t
+emitted_g(struct state *state, uint64_t byte)
+{
+	if (byte < state->g_size)
+		return state->g[byte];
+	return byte == state->g_size ? 0 : 0xff;
+}
+
+// number of assigned, i.e. non-3, vertices in a word of g
+static unsigned
+word_rank(uint64_t x)
+{
+	x = x & (x >> 1) & UINT64_C(0x5555555555555555);
+	return 32 - __builtin_popcountll(x);
+}
+
+static uint64_t *
+interleave_g(struct nbperf *nbperf, struct state *state, size_t *sizep)
 {
+	const unsigned w = nbperf->rank_words, step = RANK_STEP(w);
+	uint64_t vertices = 4 * ((uint64_t)state->g_size + 1);
+	uint64_t words, blocks, *a, rank = 0;
 	size_t i, j;
-        const uint32_t k = 1U << 7; // for 32bit ranking
-        state->ranking_size = ceil(state->graph.v / k) + 1;
-        state->ranking = (uint32_t*)calloc(state->ranking_size, sizeof(uint32_t));
-        state->ranking[0] = 0;
-        uint32_t offset = 0U, sum = 0U, size = (k >> 2U),
-                nbytes_total = state->g_size * 4, nbytes;
-	for (i=1; i < state->ranking_size; i++) {
-		nbytes = size < nbytes_total ? size : nbytes_total;
-		for (j = 0; j < nbytes; j++) {
-			sum += bits_per_byte[*(state->g + offset + j)];
+
+	if (vertices < state->graph.va)
+		vertices = state->graph.va;
+	words = (vertices + 31) / 32;
+	blocks = (words + w - 1) / w;
+	*sizep = blocks * (w + 1);
+	a = calloc(*sizep, sizeof(*a));
+	if (a == NULL)
+		err(1, "malloc failed");
+	for (i = 0; i < blocks; i++) {
+		uint64_t *blk = a + i * (w + 1), sub = 0;
+		if (rank > UINT32_MAX)
+			errx(1, "rank overflow");
+		blk[0] = rank;
+		for (j = 0; j < w; j++) {
+			uint64_t x = 0;
+			for (unsigned b = 0; b < 8; b++)
+				x |= (uint64_t)emitted_g(state, (i * w + j) * 8 + b)
+				    << (8 * b);
+			blk[1 + j] = x;
+			if (j && j % step == 0)
+				blk[0] |= sub << (32 + 8 * (j / step));
+			sub += word_rank(x);
 		}
-		state->ranking[i] = sum;
-		offset += nbytes;
-		nbytes_total -= size;
-                DEBUGP("ranking[%zu]: %u\n", i, sum);
+		rank += sub;
 	}
+	return a;
+}
+
+struct table {
+	const void *a;
+	size_t size;
+	const char *indent;
+	int width, per_line;
+};
+
+static char *
+interleaved_entry(char *p, size_t i, const void *ctx)
+{
+	const struct table *t = ctx;
+
+	if (i % 3 == 0) {
+		p = fmt_str(p, t->indent);
+		*p++ = '\t';
+	} else
+		*p++ = ' ';
+	p = fmt_str(p, "UINT64_C(0x");
+	p = fmt_hex(p, ((const uint64_t *)t->a)[i], 16);
+	p = fmt_str(p, "),");
+	if (i % 3 == 2 || i + 1 == t->size)
+		*p++ = '\n';
+	return p;
+}
+
+static void
+print_interleaved(struct nbperf *nbperf, struct state *state,
+    const char *indent, const char *prefix, const char *sep)
+{
+	struct table t;
+	size_t size;
+	uint64_t *a = interleave_g(nbperf, state, &size);
+
+	if (nbperf->blob) {
+		const size_t len = strlen(prefix) + sizeof("_g");
+		char *name = malloc(len);
+
+		if (name == NULL)
+			err(1, "malloc failed");
+		snprintf(name, len, "%s%sg", prefix, sep);
+		blob_print(nbperf, *indent ? "\tstatic " : "static ",
+		    "uint64_t", name, a, 8, size, size);
+		free(name);
+		free(a);
+		return;
+	}
+	fprintf(nbperf->output,
+	    "%sstatic const uint64_t %s%sg[%zu] NBPERF_ALIGN64 = {\n",
+	    indent, prefix, sep, size);
+	t.a = a;
+	t.size = size;
+	t.indent = indent;
+	table_print(nbperf->output, size, 32 + strlen(indent),
+	    interleaved_entry, &t);
+	fprintf(nbperf->output, "%s};\n", indent);
+	free(a);
+}
+
+static char *
+output_order_entry(char *p, size_t i, const void *ctx)
+{
+	const struct table *t = ctx;
+
+	if (!i)
+		p = fmt_str(p, "\t    ");
+	p = fmt_dec(p, ((const uint32_t *)t->a)[i], t->width);
+	*p++ = ',';
+	if ((i + 1) % t->per_line == 0)
+		p = fmt_str(p, "\n\t    ");
+	return p;
+}
+
+static char *
+g_entry(char *p, size_t i, const void *ctx)
+{
+	const struct table *t = ctx;
+
+	if (!i)
+		p = fmt_str(p, "\t    ");
+	p = fmt_str(p, " 0x");
+	p = fmt_hex(p, ((const uint8_t *)t->a)[i], 0);
+	*p++ = ',';
+	if ((i + 1) % 10 == 0)
+		p = fmt_str(p, "\n\t    ");
+	return p;
+}
+
+/* with -b the tables are at file scope, shared with the batch functions */
+static void
+print_tables(struct nbperf *nbperf, struct state *state, const char *g_type,
+    int g_width, int per_line, int has_ranking)
+{
+	const char *indent = nbperf->batch ? "" : "\t";
+	const char *prefix = nbperf->batch ? nbperf->hash_name : "";
+	const char *sep = nbperf->batch ? "_" : "";
+	struct table t;
+	size_t i;
+
+	if (nbperf->non_minimal)
+		;
+	else if (nbperf->embed_map && nbperf->packed) {
+		/* the indices < n at bitpack_width(n) bits */
+		const unsigned bits = bitpack_width(nbperf->n);
+		const size_t size = bitpack_size(state->graph.e, bits);
+		const size_t len = strlen(prefix) + sizeof("_output_order");
+		uint8_t *a = calloc(size, 1);
+		char *name = malloc(len);
+
+		if (a == NULL || name == NULL)
+			err(1, "malloc failed");
+		for (i = 0; i < state->graph.e; ++i)
+			bitpack_set(a, i, bits, state->graph.output_order[i]);
+		snprintf(name, len, "%s%soutput_order", prefix, sep);
+		bitpack_print(nbperf, indent, name, a, size);
+		free(name);
+		free(a);
+	} else if (nbperf->embed_map && nbperf->blob) {
+		const size_t len = strlen(prefix) + sizeof("_output_order");
+		char *name = malloc(len);
+
+		if (name == NULL)
+			err(1, "malloc failed");
+		snprintf(name, len, "%s%soutput_order", prefix, sep);
+		blob_print(nbperf, *indent ? "\tstatic " : "static ", g_type,
+		    name, state->graph.output_order, 4, state->graph.e,
+		    state->graph.e);
+		free(name);
+	} else if (nbperf->embed_map) {
+                assert(state->graph.e == nbperf->n);
+                fprintf(nbperf->output,
+                        "%sstatic const %s %s%soutput_order[%zu] = {\n",
+                        indent, g_type, prefix, sep, nbperf->n);
+		t.a = state->graph.output_order;
+		t.width = g_width;
+		t.per_line = per_line;
+		table_print(nbperf->output, state->graph.e, 32 + g_width,
+		    output_order_entry, &t);
+                fprintf(nbperf->output, "};\n");
+	}
+	if (has_ranking) {
+		print_interleaved(nbperf, state, indent, prefix, sep);
+		if (nbperf->batch)
+			fprintf(nbperf->output, "\n");
+		return;
+	}
+	if (nbperf->blob) {
+		const size_t len = strlen(prefix) + sizeof("_g");
+		char *name = malloc(len);
+
+		if (name == NULL)
+			err(1, "malloc failed");
+		snprintf(name, len, "%s%sg", prefix, sep);
+		blob_print(nbperf, *indent ? "\tstatic " : "static ",
+		    "uint8_t", name, state->g, 1, state->g_size,
+		    state->g_size + 1);
+		free(name);
+		if (nbperf->batch)
+			fprintf(nbperf->output, "\n");
+		return;
+	}
+	fprintf(nbperf->output,
+                "%sstatic const uint8_t %s%sg[%" PRIu8 "] = {\n", indent,
+                prefix, sep, state->g_size + 1);
+	t.a = state->g;
+	table_print(nbperf->output, state->g_size, 32, g_entry, &t);
+	i = state->g_size;
+	fprintf(nbperf->output, "%s\t 0x00 };\n", (i % 10 ? "\n" : ""));
+
+	if (nbperf->batch)
+		fprintf(nbperf->output, "\n");
+}
+
+/* local aliases for the file scope tables */
+static void
+print_aliases(struct nbperf *nbperf, const char *g_type, int has_ranking)
+{
+	const char *name = nbperf->hash_name;
+
+	if (!nbperf->non_minimal && nbperf->embed_map)
+		fprintf(nbperf->output, "\tconst %s *output_order = %s_output_order;\n",
+		    nbperf->packed ? "uint8_t" : g_type, name);
+	fprintf(nbperf->output, "\tconst %s *g = %s_g;\n",
+	    has_ranking ? "uint64_t" : "uint8_t", name);
+}
+
+static void
+print_h(struct nbperf *nbperf, const char *indent)
+{
+        if (nbperf->hashes16)
+                fprintf(nbperf->output, "%suint16_t h[%u];\n\n", indent,
+                        nbperf->hash_size * 2);
+        else
+                fprintf(nbperf->output, "%suint32_t h[%u];\n\n", indent,
+                        nbperf->hash_size);
+}
+
+/* hash the key and reduce h[] to vertices */
+static void
+print_vertices(struct nbperf *nbperf, struct state *state, const char *indent)
+{
+	FILE *out = nbperf->output;
+	const char *in = indent;
+
+	(*nbperf->print_hash)(nbperf, indent, "key", "keylen", "h");
+
+	if (nbperf->fastmod) { // TODO and state->graph.v is not power of 2
+		if (nbperf->hashes16) {
+			fprintf(out,
+			    "\n%sconst uint32_t m = UINT32_C(0xFFFFFFFF) / %" PRIu16
+			    " + 1;\n", in,
+			    state->graph.v);
+			fprintf(out,
+			    "%sconst uint32_t low0 = m * h[0];\n", in);
+			fprintf(out,
+			    "%sconst uint32_t low1 = m * h[1];\n", in);
+			fprintf(out,
+			    "%sconst uint32_t low2 = m * h[2];\n", in);
+			fprintf(out,
+			    "%sh[0] = (uint16_t)((((uint64_t)low0) * %" PRIu32
+			    ") >> 32);\n", in,
+			    state->graph.v);
+			fprintf(out,
+			    "%sh[1] = (uint16_t)((((uint64_t)low1) * %" PRIu32
+			    ") >> 32);\n", in,
+			    state->graph.v);
+			fprintf(out,
+			    "%sh[2] = (uint16_t)((((uint64_t)low2) * %" PRIu32
+			    ") >> 32);\n", in,
+			    state->graph.v);
+		} else {
+			fprintf(out,
+			    "\n%sconst uint64_t m = UINT64_C(0xFFFFFFFFFFFFFFFF) / %" PRIu32
+			    " + 1;\n", in,
+			    state->graph.v);
+			fprintf(out,
+			    "%sconst uint64_t low0 = m * h[0];\n", in);
+			fprintf(out,
+			    "%sconst uint64_t low1 = m * h[1];\n", in);
+			fprintf(out,
+			    "%sconst uint64_t low2 = m * h[2];\n", in);
+			fprintf(out,
+			    "%sh[0] = (uint32_t)((((__uint128_t)low0) * %" PRIu32
+			    ") >> 64);\n", in,
+			    state->graph.v);
+			fprintf(out,
+			    "%sh[1] = (uint32_t)((((__uint128_t)low1) * %" PRIu32
+			    ") >> 64);\n", in,
+			    state->graph.v);
+			fprintf(out,
+			    "%sh[2] = (uint32_t)((((__uint128_t)low2) * %" PRIu32
+			    ") >> 64);\n", in,
+			    state->graph.v);
+		}
+	} else {
+		fprintf(out, "\n%sh[0] = h[0] %% %" PRIu32 ";\n", in,
+                        state->graph.v);
+		fprintf(out, "%sh[1] = h[1] %% %" PRIu32 ";\n", in,
+                        state->graph.v);
+		fprintf(out, "%sh[2] = h[2] %% %" PRIu32 ";\n", in,
+		    state->graph.v);
+	}
+
+	if (state->graph.hash_fudge & 1)
+		fprintf(out, "%sh[1] ^= (h[0] == h[1]);\n", in);
+
+	if (state->graph.hash_fudge & 2) {
+		fprintf(out,
+		    "%sh[2] ^= (h[0] == h[2] || h[1] == h[2]);\n", in);
+		fprintf(out,
+		    "%sh[2] ^= 2 * (h[0] == h[2] || h[1] == h[2]);\n", in);
+	}
+}
+
+/* vertex -> result, the rank lookup */
+static void
+print_rank(struct nbperf *nbperf, const char *indent, const char *lhs,
+    const char *hashtype)
+{
+	FILE *out = nbperf->output;
+	const char *in = indent;
+	const unsigned w = nbperf->rank_words;
+
+        // rank lookup: vertex -> block header + popcounts
+        fprintf(out,
+                "%sindex = vertex >> 5;\n"
+                "%sidx_v = index %% %u;\n"
+                "%sblk = g + index / %u * %u;\n"
+                "%sbase_rank = (uint32_t)blk[0] + (uint32_t)"
+                "((blk[0] >> (32 + 8 * (idx_v / %u))) & 0xff);\n",
+                in, in, w, in, w, w + 1, in, RANK_STEP(w));
+        if (RANK_STEP(w) == 2)
+                fprintf(out,
+                        "%sbase_rank += (idx_v & 1) * "
+                        "(32 - popcount64(THREES(blk[idx_v])));\n",
+                        in);
+        fprintf(out,
+                "%sidx_b = (vertex & 31) << 1;\n"
+                "%sbase_rank += (vertex & 31) - popcount64("
+                "THREES(blk[1 + idx_v])\n"
+                "%s    & ((UINT64_C(1) << idx_b) - 1));\n",
+                in, in, in);
+        if (nbperf->embed_map && nbperf->packed)
+                fprintf(out, "%s%s (%s)_getbits(output_order, base_rank, %u);\n",
+                        in, lhs, hashtype, bitpack_width(nbperf->n));
+        else if (nbperf->embed_map)
+                fprintf(out, "%s%s (%s)output_order[base_rank];\n",
+                        in, lhs, hashtype);
+        else
+                fprintf(out, "%s%s base_rank;\n", in, lhs);
+}
+
+/*
+ * With -b also emit NAME_prefetch(key) and NAME_batch(keys, ..., out, n).
+ * The batch hashes a group of keys and prefetches their g[] lines, then
+ * computes the vertices and prefetches their rank block, and finally
+ * resolves the ranks.  So the cache misses of the whole group overlap.
+ */
+static void
+print_batch(struct nbperf *nbperf, struct state *state, const char *g_type,
+    const char *hashtype, int has_ranking)
+{
+	FILE *out = nbperf->output;
+	const char *name = nbperf->hash_name;
+	const char *h_type = nbperf->hashes16 ? "uint16_t" : "uint32_t";
+	int j;
+
+	fprintf(out, "\n%svoid\n", nbperf->static_hash ? "static " : "");
+	if (!nbperf->intkeys)
+		fprintf(out, "%s_prefetch(const void * __restrict key, size_t keylen)\n",
+		    name);
+	else
+		fprintf(out, "%s_prefetch(const int32_t key)\n", name);
+	fprintf(out, "{\n");
+	print_h(nbperf, "\t");
+	print_vertices(nbperf, state, "\t");
+	for (j = 0; j < 3; j++)
+		fprintf(out, "\t__builtin_prefetch(&%s_g[GWORD(h[%d])]);\n", name, j);
+	fprintf(out, "}\n\n");
+
+	fprintf(out, "%svoid\n", nbperf->static_hash ? "static " : "");
+	if (!nbperf->intkeys)
+		fprintf(out, "%s_batch(const void * __restrict const *keys, "
+		    "const size_t *keylens,\n\t%s *out, size_t n)\n", name,
+		    hashtype);
+	else
+		fprintf(out, "%s_batch(const int32_t *keys, %s *out, size_t n)\n",
+		    name, hashtype);
+	fprintf(out, "{\n");
+	print_aliases(nbperf, g_type, has_ranking);
+	fprintf(out, "\t%s hb[%d][3];\n", h_type, NBPERF_BATCH);
+	if (!nbperf->non_minimal)
+		fprintf(out, "\tuint32_t vb[%d];\n", NBPERF_BATCH);
+	fprintf(out, "\n"
+	    "\tfor (size_t s = 0; s < n; s += %d) {\n"
+	    "\t\tconst size_t nb = n - s < %d ? n - s : %d;\n"
+	    "\t\tfor (size_t j = 0; j < nb; j++) {\n",
+	    NBPERF_BATCH, NBPERF_BATCH, NBPERF_BATCH);
+	if (!nbperf->intkeys)
+		fprintf(out, "\t\t\tconst void *key = keys[s + j];\n"
+		    "\t\t\tconst size_t keylen = keylens[s + j];\n");
+	else
+		fprintf(out, "\t\t\tconst int32_t key = keys[s + j];\n");
+	print_h(nbperf, "\t\t\t");
+	print_vertices(nbperf, state, "\t\t\t");
+	for (j = 0; j < 3; j++)
+		fprintf(out, "\t\t\thb[j][%d] = h[%d];\n"
+		    "\t\t\t__builtin_prefetch(&g[GWORD(h[%d])]);\n", j, j, j);
+	fprintf(out, "\t\t}\n"
+	    "\t\tfor (size_t j = 0; j < nb; j++) {\n"
+	    "\t\t\tconst %s *h = hb[j];\n"
+	    "\t\t\tconst uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + "
+	    "GETI2(g, h[2]);\n", h_type);
+	if (nbperf->non_minimal) {
+		if (!nbperf->embed_data)
+			fprintf(out, "\t\t\tout[s + j] = (%s)h[i %% 3];\n",
+			    hashtype);
+		else
+			fprintf(out, "\t\t\tconst %s result = (%s)h[i %% 3];\n"
+			    "\t\t\tout[s + j] = (%s_keys[result] && "
+			    "strcmp(%s_keys[result], keys[s + j]) == 0)\n"
+			    "\t\t\t    ? result : (%s)-1;\n"
+			    "\t\t}\n\t}\n}\n", hashtype, hashtype, name, name,
+			    hashtype);
+		if (!nbperf->embed_data)
+			fprintf(out, "\t\t}\n\t}\n}\n");
+		return;
+	}
+	fprintf(out, "\t\t\tvb[j] = h[i %% 3] %% %" PRIu32 ";\n", state->graph.v);
+	if (has_ranking)
+		fprintf(out, "\t\t\t__builtin_prefetch(&g[(vb[j] >> 5) / %u * %u]);\n",
+		    nbperf->rank_words, nbperf->rank_words + 1);
+	fprintf(out, "\t\t}\n"
+	    "\t\tfor (size_t j = 0; j < nb; j++) {\n"
+	    "\t\t\tconst uint32_t vertex = vb[j];\n");
+	if (has_ranking)
+		fprintf(out, "\t\t\tuint32_t index, base_rank, idx_v, idx_b;\n"
+		    "\t\t\tconst uint64_t *blk;\n");
+	fprintf(out, "\t\t\t%s result;\n", hashtype);
+	print_rank(nbperf, "\t\t\t", "result =", hashtype);
+	if (!nbperf->embed_data)
+		fprintf(out, "\t\t\tout[s + j] = result;\n");
+	else
+		fprintf(out, "\t\t\tout[s + j] = (strcmp(%s_keys[result], "
+		    "keys[s + j]) == 0)\n"
+		    "\t\t\t    ? result : (%s)-1;\n", name, hashtype);
+	fprintf(out, "\t\t}\n\t}\n}\n");
 }
 
 static void
@@ -200,70 +668,65 @@ print_hash(struct nbperf *nbperf, struct state *state)
 	size_t i;
         const char *g_type;
         int g_width, per_line;
+        /* the minimal function ranks in the interleave_g() directory */
+        const int has_ranking = !nbperf->non_minimal;
 
 	print_coda(nbperf);
 	fprintf(nbperf->output, "#include <string.h>\n");
-        fprintf(nbperf->output, "#if defined __WORDSIZE && __WORDSIZE < 64\n"
-                "#define NO_POPCOUNT64\n"
-                "#endif\n"
-                "#define NO_POPCOUNT64\n"
-                "#if !defined NO_POPCOUNT64 && (__GNUC__ > 4 "
-                "|| (__GNUC__ == 4 && __GNUC_MINOR__ >= 5))\n" // since gcc 4.5
-                "#define HAVE_POPCOUNT64\n"
-                "#define popcount64 __builtin_popcountll\n"
-                "#else\n");
-        fprintf(nbperf->output, "static const uint8_t %s_bits_per_byte[256] = {\n",
-                nbperf->hash_name);
-        fprintf(nbperf->output,
-                "\t4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,\n"
-                "\t4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,\n"
-                "\t4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,\n"
-                "\t3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,\n"
-                "\t4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,\n"
-                "\t4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,\n"
-                "\t4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,\n"
-                "\t3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,\n"
-                "\t4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,\n"
-                "\t4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,\n"
-                "\t4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 3, 3, 2,\n"
-                "\t3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,\n"
-                "\t3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,\n"
-                "\t3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,\n"
-                "\t3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3, 2, 2, 2, 2, 1,\n"
-                "\t2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 1, 1, 1, 1, 0 };\n");
-        fprintf(nbperf->output, "#endif\n\n");
+	if (has_ranking) {
+		fprintf(nbperf->output,
+		    "#ifndef popcount64\n"
+		    "#if defined __GNUC__ || defined __clang__\n"
+		    "#define popcount64 __builtin_popcountll\n"
+		    "#else\n"
+		    "static inline unsigned\n"
+		    "%s_popcount64(uint64_t x)\n"
+		    "{\n"
+		    "\tx -= (x >> 1) & UINT64_C(0x5555555555555555);\n"
+		    "\tx = (x & UINT64_C(0x3333333333333333)) + "
+		    "((x >> 2) & UINT64_C(0x3333333333333333));\n"
+		    "\tx = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);\n"
+		    "\treturn (unsigned)((x * UINT64_C(0x0101010101010101)) >> 56);\n"
+		    "}\n"
+		    "#define popcount64 %s_popcount64\n"
+		    "#endif\n"
+		    "#endif\n"
+		    "#ifdef __GNUC__\n"
+		    "#define NBPERF_ALIGN64 __attribute__((aligned(64)))\n"
+		    "#else\n"
+		    "#define NBPERF_ALIGN64\n"
+		    "#endif\n"
+		    "/* one bit per unassigned (3) vertex of a g word */\n"
+		    "#define THREES(x) ((x) & ((x) >> 1) & "
+		    "UINT64_C(0x5555555555555555))\n\n",
+		    nbperf->hash_name, nbperf->hash_name);
+	}
 
 	if (nbperf->intkeys) {
 		inthash4_addprint(nbperf);
 	}
-	fprintf(nbperf->output,
-	    "#define GETI2(g, i) ((uint8_t)((g[i >> 2] >> ((i & 3) << 1U)) & 3))\n\n");
-	if (nbperf->embed_data) {
+	if (nbperf->packed && nbperf->embed_map && !nbperf->non_minimal)
+		bitpack_addprint(nbperf);
+	if (has_ranking)
+		fprintf(nbperf->output,
+		    "#define GWORD(i) (((i) >> 5) / %u * %u + 1 + ((i) >> 5) %% %u)\n"
+		    "#define GETI2(g, i) ((uint8_t)((g[GWORD(i)] >> (((i) & 31) << 1)) & 3))\n\n",
+		    nbperf->rank_words, nbperf->rank_words + 1, nbperf->rank_words);
+	else
+		fprintf(nbperf->output,
+		    "#define GWORD(i) ((i) >> 2)\n"
+		    "#define GETI2(g, i) ((uint8_t)((g[i >> 2] >> ((i & 3) << 1U)) & 3))\n\n");
+	if (nbperf->embed_data && nbperf->non_minimal) {
+		embed_data_vertex(nbperf, state);
+	} else if (nbperf->embed_data) {
 		fprintf(nbperf->output, "%sconst char * const %s_keys[%" PRIu64 "] = {\n",
                         nbperf->static_hash ? "static " : "",
                         nbperf->hash_name, nbperf->n);
-                for (size_t i = 0; i < nbperf->n; i++) {
-                        if (!i)
-                                fprintf(nbperf->output, "\t");
-                        if ((i + 1) % 4)
-                                fprintf(nbperf->output, "\"%s\", ", nbperf->keys[i]);
-                        else
-                                fprintf(nbperf->output, "\"%s\",\t/* %lu */\n\t", nbperf->keys[i], i+1);
-                }
+		keys_print(nbperf);
                 fprintf(nbperf->output, "};\n\n");
 	}
 
 	const char* hashtype = nbperf->n >= 4294967295U ? "uint64_t" : "uint32_t";
-	fprintf(nbperf->output, "%s%s\n",
-                nbperf->static_hash ? "static " : "", hashtype);
-	if (!nbperf->intkeys)
-		fprintf(nbperf->output,
-		    "%s(const void * __restrict key, size_t keylen)\n",
-		    nbperf->hash_name);
-	else
-		fprintf(nbperf->output,	"%s(const int32_t key)\n", nbperf->hash_name);
-	fprintf(nbperf->output, "{\n");
-
         if (nbperf->n >= 4294967295U) {
                 g_type = "uint64_t";
                 g_width = 16;
@@ -284,173 +747,73 @@ print_hash(struct nbperf *nbperf, struct state *state)
                 g_width = 3;
                 per_line = 10;
         }
-	if (nbperf->embed_map) {
-                assert(state->graph.e == nbperf->n);
-                fprintf(nbperf->output,
-                        "\tstatic const %s output_order[%zu] = {\n",
-                        g_type, nbperf->n);
-		for (i = 0; i < state->graph.e; ++i) {
-                        if (!i)
-                                fprintf(nbperf->output, "\t    ");
-			fprintf(nbperf->output, "%*u,",
-                                g_width, state->graph.output_order[i]);
-                        if ((i + 1) % per_line == 0)
-                                fprintf(nbperf->output, "\n\t    ");
-                }
-                fprintf(nbperf->output, "};\n");
-	}
-	fprintf(nbperf->output,
-                "\tstatic const uint8_t g[%" PRIu8 "] = {\n", state->g_size + 1);
-	for (i = 0; i < state->g_size; ++i) {
-                if (!i)
-                        fprintf(nbperf->output, "\t    ");
-                fprintf(nbperf->output, " 0x%x,",
-                        state->g[i]);
-                if ((i + 1) % 10 == 0)
-                        fprintf(nbperf->output, "\n\t    ");
-	}
-	fprintf(nbperf->output, "%s\t 0x00 };\n", (i % 10 ? "\n" : ""));
+	if (nbperf->batch)
+		print_tables(nbperf, state, g_type, g_width, per_line, has_ranking);
 
-        //const uint32_t b = 7;       // number of bits of k
-        //const uint32_t k = 1U << b; // kth index in ranking
-        const int has_ranking = state->ranking_size > 1 || state->ranking[0] != 0;
-        if (has_ranking) {
-                fprintf(nbperf->output,
-                        "\tstatic const uint32_t ranking[%" PRId32 "] = {\n",
-                        state->ranking_size);
-                for (i = 0; i < state->ranking_size; ++i) {
-                        if (!i)
-                                fprintf(nbperf->output, "\t    ");
-                        fprintf(nbperf->output, "%" PRIu32 ", ", state->ranking[i]);
-                        if ((i + 1) % 5 == 0)
-                                fprintf(nbperf->output, "\n\t    ");
-                }
-                fprintf(nbperf->output, "\n\t};\n");
-                fprintf(nbperf->output, "\tconst uint32_t b = 7;\n"
-                        "\tuint32_t index, base_rank, idx_v, idx_b, end_idx_b;\n");
-        }
+	fprintf(nbperf->output, "%s%s\n",
+                nbperf->static_hash ? "static " : "", hashtype);
+	if (nbperf->fixed)
+		fixed_signature_print(nbperf);
+	else if (!nbperf->intkeys)
+		fprintf(nbperf->output,
+		    "%s(const void * __restrict key, size_t keylen)\n",
+		    nbperf->hash_name);
+	else
+		fprintf(nbperf->output,	"%s(const %s key)\n", nbperf->hash_name,
+		    nbperf->intkeys64 ? "uint64_t" : "int32_t");
+	fprintf(nbperf->output, "{\n");
+
+	if (nbperf->non_minimal)
+		fprintf(nbperf->output, "\t/* non-minimal: returns 0 .. %" PRIu32 " */\n",
+		    state->graph.va - 1);
+	if (nbperf->batch)
+		print_aliases(nbperf, g_type, has_ranking);
+	else
+		print_tables(nbperf, state, g_type, g_width, per_line, has_ranking);
+        if (has_ranking)
+                fprintf(nbperf->output, "\tuint32_t index, base_rank, idx_v, idx_b;\n"
+                        "\tconst uint64_t *blk;\n");
         if (nbperf->embed_data)
                 fprintf(nbperf->output, "\t%s result;\n", hashtype);
-	fprintf(nbperf->output, "\tuint32_t vertex;\n");
-        if (nbperf->hashes16)
-                fprintf(nbperf->output, "\tuint16_t h[%u];\n\n", nbperf->hash_size * 2);
-        else
-                fprintf(nbperf->output, "\tuint32_t h[%u];\n\n", nbperf->hash_size);
-
-	(*nbperf->print_hash)(nbperf, "\t", "key", "keylen", "h");
-
-	if (nbperf->fastmod) { // TODO and state->graph.v is not power of 2
-		if (nbperf->hashes16) {
-			fprintf(nbperf->output,
-			    "\n\tconst uint32_t m = UINT32_C(0xFFFFFFFF) / %" PRIu16
-			    " + 1;\n",
-			    state->graph.v);
-			fprintf(nbperf->output,
-			    "\tconst uint32_t low0 = m * h[0];\n");
-			fprintf(nbperf->output,
-			    "\tconst uint32_t low1 = m * h[1];\n");
-			fprintf(nbperf->output,
-			    "\tconst uint32_t low2 = m * h[2];\n");
-			fprintf(nbperf->output,
-			    "\th[0] = (uint16_t)((((uint64_t)low0) * %" PRIu32
-			    ") >> 32);\n",
-			    state->graph.v);
-			fprintf(nbperf->output,
-			    "\th[1] = (uint16_t)((((uint64_t)low1) * %" PRIu32
-			    ") >> 32);\n",
-			    state->graph.v);
-			fprintf(nbperf->output,
-			    "\th[2] = (uint16_t)((((uint64_t)low2) * %" PRIu32
-			    ") >> 32);\n",
-			    state->graph.v);
-		} else {
-			fprintf(nbperf->output,
-			    "\n\tconst uint64_t m = UINT64_C(0xFFFFFFFFFFFFFFFF) / %" PRIu32
-			    " + 1;\n",
-			    state->graph.v);
-			fprintf(nbperf->output,
-			    "\tconst uint64_t low0 = m * h[0];\n");
-			fprintf(nbperf->output,
-			    "\tconst uint64_t low1 = m * h[1];\n");
-			fprintf(nbperf->output,
-			    "\tconst uint64_t low2 = m * h[2];\n");
-			fprintf(nbperf->output,
-			    "\th[0] = (uint32_t)((((__uint128_t)low0) * %" PRIu32
-			    ") >> 64);\n",
-			    state->graph.v);
-			fprintf(nbperf->output,
-			    "\th[1] = (uint32_t)((((__uint128_t)low1) * %" PRIu32
-			    ") >> 64);\n",
-			    state->graph.v);
-			fprintf(nbperf->output,
-			    "\th[2] = (uint32_t)((((__uint128_t)low2) * %" PRIu32
-			    ") >> 64);\n",
-			    state->graph.v);
-		}
-	} else {
-		fprintf(nbperf->output, "\n\th[0] = h[0] %% %" PRIu32 ";\n",
-                        state->graph.v);
-		fprintf(nbperf->output, "\th[1] = h[1] %% %" PRIu32 ";\n",
-                        state->graph.v);
-		fprintf(nbperf->output, "\th[2] = h[2] %% %" PRIu32 ";\n",
-		    state->graph.v);
-	}
-
-	if (state->graph.hash_fudge & 1)
-		fprintf(nbperf->output, "\th[1] ^= (h[0] == h[1]);\n");
-
-	if (state->graph.hash_fudge & 2) {
-		fprintf(nbperf->output,
-		    "\th[2] ^= (h[0] == h[2] || h[1] == h[2]);\n");
-		fprintf(nbperf->output,
-		    "\th[2] ^= 2 * (h[0] == h[2] || h[1] == h[2]);\n");
-	}
+	if (!nbperf->non_minimal)
+		fprintf(nbperf->output, "\tuint32_t vertex;\n");
+	shape_reject_print(nbperf, "\t", hashtype);
+	print_h(nbperf, "\t");
+	print_vertices(nbperf, state, "\t");
 
         fprintf(nbperf->output,
                 "\tconst uint8_t i = GETI2(g, h[0]) + GETI2(g, h[1]) + GETI2(g, h[2]);\n");
+        if (nbperf->non_minimal) {
+                fprintf(nbperf->output, "\t%s (%s)h[i %% 3];\n",
+                        nbperf->embed_data ? "result =" : "return", hashtype);
+                if (nbperf->embed_data)
+                        fprintf(nbperf->output, "\treturn (%s_keys[result] && "
+                                "strcmp(%s_keys[result], key) == 0)"
+                                " ? result : (%s)-1;\n",
+                                nbperf->hash_name, nbperf->hash_name, hashtype);
+                fprintf(nbperf->output, "}\n");
+                if (nbperf->batch)
+                        print_batch(nbperf, state, g_type, hashtype, has_ranking);
+                if (nbperf->map_output != NULL) {
+                        for (i = 0; i < state->graph.e; ++i)
+                                fprintf(nbperf->map_output, "%" PRIu32 "\n",
+                                    key_vertex(state, i));
+                }
+                return;
+        }
         fprintf(nbperf->output,
                 "\tvertex = h[i %% 3] %% %" PRIu32 ";\n\n", state->graph.v);
-        if (state->ranking_size > 1 || state->ranking[0] != 0) {
-                // rank lookup: vertex -> base_rank
-                fprintf(nbperf->output,
-                        "\tindex = vertex >> b;\n"
-                        "\tbase_rank = ranking[index];\n"
-                        "\tidx_v = index << b;\n"
-                        "\tidx_b = idx_v >> 2;\n"
-                        "\tend_idx_b = vertex >> 2;\n"
-                        "\twhile (idx_b < end_idx_b)\n"
-                        "\t    base_rank += %s_bits_per_byte[*(g + idx_b++)];\n"
-                        "\tidx_v = idx_b << 2;\n"
-                        "\twhile (idx_v < vertex)\n"
-                        "\t{\n"
-                        "\t      if (GETI2(g, idx_v) != 3) base_rank++;\n"
-                        "\t      idx_v++;\n"
-                        "\t}\n", nbperf->hash_name);
-                if (nbperf->embed_map)
-                        fprintf(nbperf->output, "\t%s (%s)output_order[base_rank];\n",
-                                nbperf->embed_data ? "result =" : "return", hashtype);
-                else
-                        fprintf(nbperf->output, "\t%s base_rank;\n",
-                                nbperf->embed_data ? "result =" : "return");
-        } else {
-                if (nbperf->embed_map)
-                        fprintf(nbperf->output, "\t%s (%s)output_order[vertex];\n",
-                                nbperf->embed_data ? "result =" : "return", hashtype);
-                else
-                        fprintf(nbperf->output, "\t%s (%s)vertex;\n",
-                                nbperf->embed_data ? "result =" : "return", hashtype);
-        }
+        print_rank(nbperf, "\t",
+                nbperf->embed_data ? "result =" : "return", hashtype);
         if (nbperf->embed_data)
                 fprintf(nbperf->output, "\treturn (strcmp(%s_keys[result], key) == 0)"
                         " ? result : (%s)-1;\n",
                         nbperf->hash_name, hashtype);
 	fprintf(nbperf->output, "}\n");
+	if (nbperf->batch)
+		print_batch(nbperf, state, g_type, hashtype, has_ranking);
 
-	if (nbperf->map_output != NULL) {
-		for (i = 0; i < state->graph.e; ++i)
-			fprintf(nbperf->map_output, "%" PRIu32 "\n",
-			    state->graph.output_order[i]);
-	}
+	map_print(nbperf, state->graph.output_order, state->graph.e);
 }
 
 int
@@ -498,7 +861,7 @@ bpz_compute(struct nbperf *nbperf)
 
 	graph3_setup(&state.graph, v, e, va);
 
-        state.g_size = ceil(v / 4);
+        state.g_size = (v + 3) / 4;
 	state.g = calloc(state.g_size, sizeof(uint32_t));
         state.visited_size = (v >> 3) + 1;
 	state.visited = calloc(state.visited_size, sizeof(uint32_t));
@@ -510,7 +873,6 @@ bpz_compute(struct nbperf *nbperf)
 	if (SIZED2(_output_order)(&state.graph))
 		goto failed;
 	assign_nodes(&state);
-	ranking(&state);
 	print_hash(nbperf, &state);
 
 	retval = 0;
@@ -519,6 +881,5 @@ failed:
 	SIZED2(_free)(&state.graph);
 	free(state.g);
         free(state.visited);
-        free(state.ranking);
 	return retval;
 }
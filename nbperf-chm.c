@@ -155,204 +155,786 @@ embed_data_string(struct nbperf *nbperf)
 	fprintf(nbperf->output, "%sconst char * const %s_keys[%" PRIu64 "] = {\n",
 		nbperf->static_hash ? "static " : "",
 		nbperf->hash_name, nbperf->n);
-	for (size_t i = 0; i < nbperf->n; i++) {
-		if (!i)
-			fprintf(nbperf->output, "\t");
-		if ((i + 1) % 4)
-			fprintf(nbperf->output, "\"%s\", ", nbperf->keys[i]);
-		else
-			fprintf(nbperf->output, "\"%s\",\t/* %lu */\n\t", nbperf->keys[i], i+1);
-	}
+	keys_print(nbperf);
 	fprintf(nbperf->output, "};\n");
 }
 
+/* with -C the keys are string_views, to be compared in constexpr lookups */
 static void
-embed_data_int(struct nbperf *nbperf, const char* hashtype)
+embed_data_string_view(struct nbperf *nbperf)
 {
-	fprintf(nbperf->output, "%sconst %s %s_keys[%" PRIu64 "] = {\n",
-		nbperf->static_hash ? "static " : "",
-		hashtype,
+	fprintf(nbperf->output,
+		"%s constexpr std::string_view %s_keys[%" PRIu64 "] = {\n",
+		nbperf->static_hash ? "static" : "inline",
 		nbperf->hash_name, nbperf->n);
 	for (size_t i = 0; i < nbperf->n; i++) {
-		if (!i)
-			fprintf(nbperf->output, "\t");
-		if ((i + 1) % 10)
-			fprintf(nbperf->output, "%ld, ", (long)nbperf->keys[i]);
+		/* with the length, or the constexpr strlen of big sets
+		   runs into the evaluation limits of the compilers */
+		fprintf(nbperf->output, "%s{", i % 4 ? " " : "\t");
+		key_print(nbperf->output, nbperf->keys[i], nbperf->keylens[i]);
+		fprintf(nbperf->output, ", %zu}", nbperf->keylens[i]);
+		if ((i + 1) % 4)
+			fprintf(nbperf->output, ",");
 		else
-			fprintf(nbperf->output, "%ld,\t/* %lu */\n\t",
-				(long)nbperf->keys[i], i+1);
+			fprintf(nbperf->output, ",\t/* %lu */\n", i + 1);
 	}
-	fprintf(nbperf->output, "};\n");
+	fprintf(nbperf->output, "%s};\n\n", nbperf->n % 4 ? "\n" : "");
+}
+
+/* the type of the -I keys, uint64_t with -L */
+static const char *
+int_keytype(const struct nbperf *nbperf)
+{
+	return nbperf->intkeys64 ? "uint64_t" : "int32_t";
+}
+
+/* the -d integer keys, 10 per line */
+static char *
+int_entry(char *p, size_t i, const void *ctx)
+{
+	const struct nbperf *nbperf = ctx;
+	const long k = (long)nbperf->keys[i];
+
+	if (!i)
+		*p++ = '\t';
+	if (nbperf->intkeys64) {
+		p = fmt_dec(p, (uint64_t)k, 0);
+		if (k < 0)
+			*p++ = 'u';
+	} else {
+		if (k < 0)
+			*p++ = '-';
+		p = fmt_dec(p, k < 0 ? -(uint64_t)k : (uint64_t)k, 0);
+	}
+	if ((i + 1) % 10)
+		return fmt_str(p, ", ");
+	p = fmt_str(p, ",\t/* ");
+	p = fmt_dec(p, i + 1, 0);
+	return fmt_str(p, " */\n\t");
 }
 
 static void
-print_hash(struct nbperf *nbperf, struct state *state)
+embed_data_int(struct nbperf *nbperf)
 {
-	uint32_t i, per_line;
-	const char *g_type;
-	int g_width;
+	if (nbperf->blob) {
+		const size_t len = strlen(nbperf->hash_name) + sizeof("_keys");
+		char *name = malloc(len);
 
-	print_coda(nbperf);
-        if (nbperf->embed_data && !nbperf->intkeys)
-                fprintf(nbperf->output, "#include <string.h>\n");
-	if (nbperf->intkeys) {
-#if GRAPH_SIZE >= 3
-		inthash4_addprint(nbperf);
-#else
-                inthash_addprint(nbperf);
-#endif
+		if (name == NULL)
+			err(1, "malloc failed");
+		snprintf(name, len, "%s_keys", nbperf->hash_name);
+		blob_print(nbperf, nbperf->static_hash ? "static " : "",
+		    int_keytype(nbperf), name, (const void *)nbperf->keys, sizeof(*nbperf->keys),
+		    nbperf->n, nbperf->n);
+		free(name);
+		return;
 	}
-        const char* hashtype = nbperf->n >= 4294967295U ? "uint64_t"
-                : !nbperf->hashes16 ? "uint32_t" : "uint16_t";
-	if (nbperf->embed_data) {
-		if (nbperf->intkeys)
-			embed_data_int(nbperf, hashtype);
-		else
-			embed_data_string(nbperf);
-        }
+	fprintf(nbperf->output, "%s%s %s %s_keys[%" PRIu64 "] = {\n",
+		nbperf->cxx ? (nbperf->static_hash ? "static " : "inline ") :
+		nbperf->static_hash ? "static " : "",
+		nbperf->cxx ? "constexpr" : "const",
+		int_keytype(nbperf),
+		nbperf->hash_name, (uint64_t)nbperf->n);
+	table_print(nbperf->output, nbperf->n, 64, int_entry, nbperf);
+	fprintf(nbperf->output, "};\n");
+}
 
-	fprintf(nbperf->output, "%s%s\n",
-                nbperf->static_hash ? "static " : "", hashtype);
-	if (!nbperf->intkeys)
-		fprintf(nbperf->output,
-			"%s(const void * __restrict key, size_t keylen)\n",
-			nbperf->hash_name);
-	else
-		fprintf(nbperf->output,	"%s(const %s key)\n",
-			nbperf->hash_name, hashtype);
-	fprintf(nbperf->output, "{\n");
-	if (state->graph.v >= 65536) {
-		g_type = "uint32_t";
-		g_width = 6;
-		per_line = 8;
-	} else if (state->graph.v >= 256) {
-		g_type = "uint16_t";
-		g_width = 4;
-		per_line = 8;
-	} else {
-		g_type = "uint8_t";
-		g_width = 2;
-		per_line = 10;
+struct g_fmt {
+	const uint32_t *g;
+	int width, hex;
+	uint32_t per_line;
+};
+
+static char *
+g_entry(char *p, size_t i, const void *ctx)
+{
+	const struct g_fmt *f = ctx;
+
+	p = fmt_str(p, i % f->per_line == 0 ? "\t    " : " ");
+	if (f->hex) {
+		p = fmt_str(p, "0x");
+		p = fmt_hex(p, f->g[i], f->width);
+	} else
+		p = fmt_dec(p, f->g[i], f->width);
+	*p++ = ',';
+	if (i % f->per_line == f->per_line - 1)
+		*p++ = '\n';
+	return p;
+}
+
+static void
+print_g(struct nbperf *nbperf, struct state *state, const char *g_type,
+    int g_width, uint32_t per_line)
+{
+	struct g_fmt g_fmt;
+	uint32_t i;
+
+	if (nbperf->packed) {
+		/* g[i] < e, so bitpack_width(e) bits suffice */
+		const unsigned bits = bitpack_width(state->graph.e);
+		const size_t size = bitpack_size(state->graph.v, bits);
+		uint8_t *a = calloc(size, 1);
+		char *name = NULL;
+
+		if (a == NULL)
+			err(1, "malloc failed");
+		for (i = 0; i < state->graph.v; ++i)
+			bitpack_set(a, i, bits, state->g[i]);
+		if (nbperf->batch) {
+			const size_t len = strlen(nbperf->hash_name) + sizeof("_g");
+			if ((name = malloc(len)) == NULL)
+				err(1, "malloc failed");
+			snprintf(name, len, "%s_g", nbperf->hash_name);
+		}
+		bitpack_print(nbperf, nbperf->batch ? "" : "\t",
+		    nbperf->batch ? name : "g", a, size);
+		if (nbperf->batch)
+			fprintf(nbperf->output, "\n");
+		free(name);
+		free(a);
+		return;
 	}
-	if (nbperf->embed_data)
-                fprintf(nbperf->output, "\t%s result;\n", g_type);
-	fprintf(nbperf->output, "\tstatic const %s g[%" PRId32 "] = {\n",
-	    g_type, state->graph.v);
-	for (i = 0; i < state->graph.v; ++i) {
-		if (nbperf->intkeys)
-			fprintf(nbperf->output, "%s%*" PRIu32 ",%s",
-				(i % per_line == 0 ? "\t    " : " "),
-				g_width, state->g[i],
-				(i % per_line == per_line - 1 ? "\n" : ""));
-		else
-			fprintf(nbperf->output, "%s0x%0*" PRIx32 ",%s",
-				(i % per_line == 0 ? "\t    " : " "),
-				g_width, state->g[i],
-				(i % per_line == per_line - 1 ? "\n" : ""));
+	if (nbperf->blob) {
+		const size_t len = strlen(nbperf->hash_name) + sizeof("_g");
+		char *name = malloc(len);
+
+		if (name == NULL)
+			err(1, "malloc failed");
+		snprintf(name, len, "%s_g", nbperf->hash_name);
+		blob_print(nbperf, nbperf->batch ? "static " : "\tstatic ",
+		    g_type, nbperf->batch ? name : "g", state->g, 4,
+		    state->graph.v,
+		    state->graph.v + (nbperf->batch && nbperf->intkeys ? 3 : 0));
+		if (nbperf->batch)
+			fprintf(nbperf->output, "\n");
+		free(name);
+		return;
 	}
+	/* with -b the table is shared with the batch functions */
+	if (nbperf->batch)
+		/* padded for the 32bit gathers of NAME_x8 */
+		fprintf(nbperf->output, "static const %s %s_g[%" PRId32 "] = {\n",
+		    g_type, nbperf->hash_name,
+		    state->graph.v + (nbperf->intkeys ? 3 : 0));
+	/* a constexpr function cannot have a static table */
+	else if (nbperf->cxx)
+		fprintf(nbperf->output, "%s constexpr %s %s_g[%" PRId32 "] = {\n",
+		    nbperf->static_hash ? "static" : "inline", g_type,
+		    nbperf->hash_name, state->graph.v);
+	else
+		fprintf(nbperf->output, "\tstatic const %s g[%" PRId32 "] = {\n",
+		    g_type, state->graph.v);
+	g_fmt.g = state->g;
+	g_fmt.width = g_width;
+	g_fmt.per_line = per_line;
+	g_fmt.hex = !nbperf->intkeys;
+	table_print(nbperf->output, state->graph.v, 32, g_entry, &g_fmt);
+	i = state->graph.v;
 	if (i % per_line != 0)
-		fprintf(nbperf->output, "\n\t};\n");
+		fprintf(nbperf->output, "\n%s};\n",
+		    nbperf->batch || nbperf->cxx ? "" : "\t");
 	else
-		fprintf(nbperf->output, "\t};\n");
+		fprintf(nbperf->output, "%s};\n",
+		    nbperf->batch || nbperf->cxx ? "" : "\t");
+	if (nbperf->batch || nbperf->cxx)
+		fprintf(nbperf->output, "\n");
+}
+
+static void
+print_h(struct nbperf *nbperf, const char *indent)
+{
 	if (nbperf->hashes16) {
                 if (nbperf->hash_size == 2 && nbperf->intkeys)
-                        fprintf(nbperf->output, "\tuint16_t h[%u];\n\n", 2);
+                        fprintf(nbperf->output, "%suint16_t h[%u];\n\n", indent, 2);
                 else
-                        fprintf(nbperf->output, "\tuint16_t h[%u];\n\n", nbperf->hash_size * 2);
+                        fprintf(nbperf->output, "%suint16_t h[%u];\n\n", indent,
+			    nbperf->hash_size * 2);
         }
 	else
-		fprintf(nbperf->output, "\tuint32_t h[%u];\n\n",
+		fprintf(nbperf->output, "%suint32_t h[%u];\n\n", indent,
 		    nbperf->hash_size);
-	(*nbperf->print_hash)(nbperf, "\t", "key", "keylen", "h");
+}
+
+/* the sum of the g entries of the vertices, mod e */
+static void
+print_lookup(struct nbperf *nbperf, struct state *state, const char *indent,
+    const char *lhs)
+{
+	const unsigned bits = bitpack_width(state->graph.e);
+	int j;
+
+	fprintf(nbperf->output, "%s%s (", indent, lhs);
+	for (j = 0; j < GRAPH_SIZE; j++) {
+		if (nbperf->packed)
+			fprintf(nbperf->output, "%s_getbits(g, h[%d], %u)",
+			    j ? " + " : "", j, bits);
+		else
+			fprintf(nbperf->output, "%sg[h[%d]]", j ? " + " : "", j);
+	}
+	fprintf(nbperf->output, ") %% %" PRIu32 ";\n", state->graph.e);
+}
+
+/* reduce the hashes h[] to vertices */
+static void
+print_reduce(struct nbperf *nbperf, struct state *state, const char *indent)
+{
+	FILE *out = nbperf->output;
+	const char *in = indent;
 
 	if (nbperf->fastmod) {
 		if (nbperf->hashes16) {
-			fprintf(nbperf->output,
-			    "\n\tconst uint32_t m = UINT32_C(0xFFFFFFFF) / %" PRIu16
-			    " + 1;\n", state->graph.v);
-			fprintf(nbperf->output,
-			    "\tconst uint32_t low0 = m * h[0];\n");
-			fprintf(nbperf->output,
-			    "\tconst uint32_t low1 = m * h[1];\n");
+			fprintf(out,
+			    "\n%sconst uint32_t m = UINT32_C(0xFFFFFFFF) / %" PRIu16
+			    " + 1;\n", in, state->graph.v);
+			fprintf(out,
+			    "%sconst uint32_t low0 = m * h[0];\n", in);
+			fprintf(out,
+			    "%sconst uint32_t low1 = m * h[1];\n", in);
 #if GRAPH_SIZE >= 3
-			fprintf(nbperf->output,
-			    "\tconst uint32_t low2 = m * h[2];\n");
+			fprintf(out,
+			    "%sconst uint32_t low2 = m * h[2];\n", in);
 #endif
-			fprintf(nbperf->output,
-			    "\th[0] = (uint16_t)((((uint64_t)low0) * %" PRIu32
-			    ") >> 32);\n",
+			fprintf(out,
+			    "%sh[0] = (uint16_t)((((uint64_t)low0) * %" PRIu32
+			    ") >> 32);\n", in,
 			    state->graph.v);
-			fprintf(nbperf->output,
-			    "\th[1] = (uint16_t)((((uint64_t)low1) * %" PRIu32
-			    ") >> 32);\n",
+			fprintf(out,
+			    "%sh[1] = (uint16_t)((((uint64_t)low1) * %" PRIu32
+			    ") >> 32);\n", in,
 			    state->graph.v);
 #if GRAPH_SIZE >= 3
-			fprintf(nbperf->output,
-			    "\th[2] = (uint16_t)((((uint64_t)low2) * %" PRIu32
-			    ") >> 32);\n",
+			fprintf(out,
+			    "%sh[2] = (uint16_t)((((uint64_t)low2) * %" PRIu32
+			    ") >> 32);\n", in,
 			    state->graph.v);
 #endif
 		} else {
-			fprintf(nbperf->output,
-			    "\n\tconst uint64_t m = UINT64_C(0xFFFFFFFFFFFFFFFF) / %" PRIu32
-			    " + 1;\n",
+			fprintf(out,
+			    "\n%sconst uint64_t m = UINT64_C(0xFFFFFFFFFFFFFFFF) / %" PRIu32
+			    " + 1;\n", in,
 			    state->graph.v);
-			fprintf(nbperf->output,
-			    "\tconst uint64_t low0 = m * h[0];\n");
-			fprintf(nbperf->output,
-			    "\tconst uint64_t low1 = m * h[1];\n");
+			fprintf(out,
+			    "%sconst uint64_t low0 = m * h[0];\n", in);
+			fprintf(out,
+			    "%sconst uint64_t low1 = m * h[1];\n", in);
 #if GRAPH_SIZE >= 3
-			fprintf(nbperf->output,
-			    "\tconst uint64_t low2 = m * h[2];\n");
+			fprintf(out,
+			    "%sconst uint64_t low2 = m * h[2];\n", in);
 #endif
-			fprintf(nbperf->output,
-			    "\th[0] = (uint32_t)((((__uint128_t)low0) * %" PRIu32
-			    ") >> 64);\n",
+			fprintf(out,
+			    "%sh[0] = (uint32_t)((((__uint128_t)low0) * %" PRIu32
+			    ") >> 64);\n", in,
 			    state->graph.v);
-			fprintf(nbperf->output,
-			    "\th[1] = (uint32_t)((((__uint128_t)low1) * %" PRIu32
-			    ") >> 64);\n",
+			fprintf(out,
+			    "%sh[1] = (uint32_t)((((__uint128_t)low1) * %" PRIu32
+			    ") >> 64);\n", in,
 			    state->graph.v);
 #if GRAPH_SIZE >= 3
-			fprintf(nbperf->output,
-			    "\th[2] = (uint32_t)((((__uint128_t)low2) * %" PRIu32
-			    ") >> 64);\n",
+			fprintf(out,
+			    "%sh[2] = (uint32_t)((((__uint128_t)low2) * %" PRIu32
+			    ") >> 64);\n", in,
 			    state->graph.v);
 #endif
 		}
 	} else {
-		fprintf(nbperf->output, "\n\th[0] = h[0] %% %" PRIu32 ";\n",
+		fprintf(out, "\n%sh[0] = h[0] %% %" PRIu32 ";\n", in,
                         state->graph.v);
-                fprintf(nbperf->output, "\th[1] = h[1] %% %" PRIu32 ";\n",
+                fprintf(out, "%sh[1] = h[1] %% %" PRIu32 ";\n", in,
                         state->graph.v);
 #if GRAPH_SIZE >= 3
-                fprintf(nbperf->output, "\th[2] = h[2] %% %" PRIu32 ";\n",
+                fprintf(out, "%sh[2] = h[2] %% %" PRIu32 ";\n", in,
                         state->graph.v);
 #endif
 	}
 
 	if (state->graph.hash_fudge & 1)
-		fprintf(nbperf->output, "\th[1] ^= (h[0] == h[1]);\n");
+		fprintf(out, "%sh[1] ^= (h[0] == h[1]);\n", in);
 
 #if GRAPH_SIZE >= 3
 	if (state->graph.hash_fudge & 2) {
-		fprintf(nbperf->output,
-		    "\th[2] ^= (h[0] == h[2] || h[1] == h[2]);\n");
-		fprintf(nbperf->output,
-		    "\th[2] ^= 2 * (h[0] == h[2] || h[1] == h[2]);\n");
+		fprintf(out,
+		    "%sh[2] ^= (h[0] == h[2] || h[1] == h[2]);\n", in);
+		fprintf(out,
+		    "%sh[2] ^= 2 * (h[0] == h[2] || h[1] == h[2]);\n", in);
+	}
+#endif
+}
+
+/* hash the key, set the fingerprint fp if not NULL, and reduce h[] to vertices */
+static void
+print_vertices(struct nbperf *nbperf, struct state *state, const char *indent,
+    const char *fp)
+{
+	(*nbperf->print_hash)(nbperf, indent, "key", "keylen", "h");
+	if (fp != NULL)
+		fingerprint_print(nbperf, indent, fp, GRAPH_SIZE);
+	print_reduce(nbperf, state, indent);
+}
+
+/*
+ * With -b also emit NAME_prefetch(key) and NAME_batch(keys, ..., out, n).
+ * The batch hashes a group of keys first and prefetches all their g[]
+ * lines, so the cache misses of the group overlap.
+ */
+static void
+print_batch(struct nbperf *nbperf, struct state *state, const char *g_type)
+{
+	FILE *out = nbperf->output;
+	const char *name = nbperf->hash_name;
+	const char *h_type = nbperf->hashes16 ? "uint16_t" : "uint32_t";
+	/* the results are not truncated to 16 bit */
+	const char *out_type = nbperf->n >= 4294967295U ? "uint64_t" : "uint32_t";
+	char lhs[32];
+	int j;
+
+	fprintf(out, "\n%svoid\n", nbperf->static_hash ? "static " : "");
+	if (!nbperf->intkeys)
+		fprintf(out, "%s_prefetch(const void * __restrict key, size_t keylen)\n",
+		    name);
+	else
+		fprintf(out, "%s_prefetch(const %s key)\n", name,
+		    int_keytype(nbperf));
+	fprintf(out, "{\n");
+	print_h(nbperf, "\t");
+	print_vertices(nbperf, state, "\t", NULL);
+	for (j = 0; j < GRAPH_SIZE; j++) {
+		if (nbperf->packed)
+			fprintf(out, "\t__builtin_prefetch(&%s_g[(h[%d] * %u) >> 3]);\n",
+			    name, j, bitpack_width(state->graph.e));
+		else
+			fprintf(out, "\t__builtin_prefetch(&%s_g[h[%d]]);\n", name, j);
+	}
+	fprintf(out, "}\n\n");
+
+	fprintf(out, "%svoid\n", nbperf->static_hash ? "static " : "");
+	if (!nbperf->intkeys)
+		fprintf(out, "%s_batch(const void * __restrict const *keys, "
+		    "const size_t *keylens,\n\t%s *out, size_t n)\n", name,
+		    out_type);
+	else
+		fprintf(out, "%s_batch(const %s *keys, %s *out, size_t n)\n",
+		    name, int_keytype(nbperf), out_type);
+	fprintf(out, "{\n"
+	    "\tconst %s *g = %s_g;\n"
+	    "\t%s hb[%d][%d];\n",
+	    nbperf->packed ? "uint8_t" : g_type, name, h_type, NBPERF_BATCH,
+	    GRAPH_SIZE);
+	if (nbperf->fingerprint)
+		fprintf(out, "\tuint%u_t fb[%d];\n", nbperf->fingerprint,
+		    NBPERF_BATCH);
+	fprintf(out, "\n"
+	    "\tfor (size_t s = 0; s < n; s += %d) {\n"
+	    "\t\tconst size_t nb = n - s < %d ? n - s : %d;\n"
+	    "\t\tfor (size_t j = 0; j < nb; j++) {\n",
+	    NBPERF_BATCH, NBPERF_BATCH, NBPERF_BATCH);
+	if (!nbperf->intkeys)
+		fprintf(out, "\t\t\tconst void *key = keys[s + j];\n"
+		    "\t\t\tconst size_t keylen = keylens[s + j];\n");
+	else
+		fprintf(out, "\t\t\tconst %s key = keys[s + j];\n",
+		    int_keytype(nbperf));
+	print_h(nbperf, "\t\t\t");
+	print_vertices(nbperf, state, "\t\t\t",
+	    nbperf->fingerprint ? "fb[j]" : NULL);
+	for (j = 0; j < GRAPH_SIZE; j++) {
+		if (nbperf->packed)
+			fprintf(out, "\t\t\thb[j][%d] = h[%d];\n"
+			    "\t\t\t__builtin_prefetch(&g[(h[%d] * %u) >> 3]);\n",
+			    j, j, j, bitpack_width(state->graph.e));
+		else
+			fprintf(out, "\t\t\thb[j][%d] = h[%d];\n"
+			    "\t\t\t__builtin_prefetch(&g[h[%d]]);\n", j, j, j);
+	}
+	fprintf(out, "\t\t}\n"
+	    "\t\tfor (size_t j = 0; j < nb; j++) {\n"
+	    "\t\t\tconst %s *h = hb[j];\n", h_type);
+	snprintf(lhs, sizeof(lhs), "%s result =", g_type);
+	print_lookup(nbperf, state, "\t\t\t", lhs);
+	if (!nbperf->embed_data)
+		fprintf(out, "\t\t\tout[s + j] = result;\n");
+	else if (nbperf->keypool && nbperf->fingerprint)
+		fprintf(out, "\t\t\tout[s + j] = (%s_fp[result] == fb[j] &&\n"
+		    "\t\t\t    %s_keycmp(result, keys[s + j], keylens[s + j]))\n"
+		    "\t\t\t    ? result : (%s)-1;\n", name, name, out_type);
+	else if (nbperf->keypool)
+		fprintf(out, "\t\t\tout[s + j] = %s_keycmp(result, keys[s + j], "
+		    "keylens[s + j])\n"
+		    "\t\t\t    ? result : (%s)-1;\n", name, out_type);
+	else if (nbperf->fingerprint)
+		fprintf(out, "\t\t\tout[s + j] = (%s_fp[result] == fb[j] &&\n"
+		    "\t\t\t    %s_keylens[result] == keylens[s + j] &&\n"
+		    "\t\t\t    memcmp(%s_keys[result], keys[s + j], "
+		    "keylens[s + j]) == 0)\n"
+		    "\t\t\t    ? result : (%s)-1;\n", name, name, name, out_type);
+	else if (!nbperf->intkeys)
+		fprintf(out, "\t\t\tout[s + j] = (strcmp(%s_keys[result], "
+		    "keys[s + j]) == 0)\n"
+		    "\t\t\t    ? result : (%s)-1;\n", name, out_type);
+	else
+		fprintf(out, "\t\t\tout[s + j] = (%s_keys[result] == keys[s + j])"
+		    " ? result : (%s)-1;\n", name, out_type);
+	fprintf(out, "\t\t}\n\t}\n}\n");
+}
+
+#if GRAPH_SIZE == 2
+/*
+ * The SIMD loop of NAME_x8 for 16bit integer hashes: _inthash2, the
+ * fastmod reduction and the g[] gathers for 8 (AVX2) or 16 (AVX-512)
+ * keys.  The 32bit fastmod is exact for 16bit hashes if v <= 65536.
+ */
+static void
+print_x8_simd(struct nbperf *nbperf, struct state *state, const char *g_type,
+    int avx512)
+{
+	FILE *out = nbperf->output;
+	const char *name = nbperf->hash_name;
+	const char *mm = avx512 ? "_mm512" : "_mm256";
+	const char *vt = avx512 ? "__m512i" : "__m256i";
+	const int lanes = avx512 ? 16 : 8;
+	const int bits = lanes * 32;
+	const int g_scale = strcmp(g_type, "uint8_t") == 0 ? 1 :
+	    strcmp(g_type, "uint16_t") == 0 ? 2 : 4;
+	int j;
+
+	fprintf(out,
+	    "\tconst %s mul = %s_set1_epi32((int)UINT32_C(0x%08" PRIx32 "));\n"
+	    "\tconst %s add = %s_set1_epi32((int)UINT32_C(%" PRIu32 "));\n"
+	    "\tconst %s lo16 = %s_set1_epi32(0xffff);\n"
+	    "\tconst %s m = %s_set1_epi32((int)(UINT32_C(0xFFFFFFFF) / %" PRIu32
+	    " + 1));\n"
+	    "\tconst %s v = %s_set1_epi32(%" PRIu32 ");\n"
+	    "\tconst %s e = %s_set1_epi32(%" PRIu32 ");\n",
+	    vt, mm, UINT32_C(0xEB382D69) + nbperf->seed[0],
+	    vt, mm, nbperf->seed[1], vt, mm, vt, mm, state->graph.v,
+	    vt, mm, state->graph.v, vt, mm, state->graph.e);
+	if (g_scale < 4)
+		fprintf(out, "\tconst %s gmask = %s_set1_epi32(0x%x);\n", vt, mm,
+		    g_scale == 1 ? 0xff : 0xffff);
+	fprintf(out, "\n\tfor (; i + %d <= n; i += %d) {\n", lanes, lanes);
+	if (avx512)
+		fprintf(out, "\t\tconst __m512i k = _mm512_loadu_si512("
+		    "(const void *)(keys + i));\n");
+	else
+		fprintf(out, "\t\tconst __m256i k = _mm256_loadu_si256("
+		    "(const __m256i *)(keys + i));\n");
+	fprintf(out,
+	    "\t\tconst %s h = %s_add_epi32(%s_mullo_epi32(k, mul), add);\n"
+	    "\t\t%s h0 = %s_and_si%d(h, lo16);\n"
+	    "\t\t%s h1 = %s_srli_epi32(h, 16);\n",
+	    vt, mm, mm, vt, mm, bits, vt, mm);
+	/* fastmod: the high 32 bits of (m * h) * v, even and odd lanes */
+	for (j = 0; j < 2; j++) {
+		fprintf(out, "\t\th%d = %s_mullo_epi32(h%d, m);\n", j, mm, j);
+		if (avx512)
+			fprintf(out,
+			    "\t\th%d = _mm512_mask_blend_epi32(0xAAAA,\n"
+			    "\t\t    _mm512_srli_epi64(_mm512_mul_epu32(h%d, v), 32),\n"
+			    "\t\t    _mm512_mul_epu32(_mm512_srli_epi64(h%d, 32), v));\n",
+			    j, j, j);
+		else
+			fprintf(out,
+			    "\t\th%d = _mm256_blend_epi32(\n"
+			    "\t\t    _mm256_srli_epi64(_mm256_mul_epu32(h%d, v), 32),\n"
+			    "\t\t    _mm256_mul_epu32(_mm256_srli_epi64(h%d, 32), v), 0xAA);\n",
+			    j, j, j);
+	}
+	if (state->graph.hash_fudge & 1) {
+		if (avx512)
+			fprintf(out, "\t\th1 = _mm512_mask_xor_epi32(h1, "
+			    "_mm512_cmpeq_epi32_mask(h0, h1), h1,\n"
+			    "\t\t    _mm512_set1_epi32(1));\n");
+		else
+			fprintf(out, "\t\th1 = _mm256_xor_si256(h1, _mm256_and_si256("
+			    "_mm256_cmpeq_epi32(h0, h1),\n"
+			    "\t\t    _mm256_set1_epi32(1)));\n");
+	}
+	/* the gathers read 32bit, mask smaller g values */
+	for (j = 0; j < 2; j++) {
+		fprintf(out, "\t\tconst %s g%d = ", vt, j);
+		if (g_scale < 4)
+			fprintf(out, "%s_and_si%d(gmask, ", mm, bits);
+		if (avx512)
+			fprintf(out, "_mm512_i32gather_epi32(h%d, "
+			    "(const void *)%s_g, %d)", j, name, g_scale);
+		else
+			fprintf(out, "_mm256_i32gather_epi32((const int *)%s_g, "
+			    "h%d, %d)", name, j, g_scale);
+		fprintf(out, "%s;\n", g_scale < 4 ? ")" : "");
+	}
+	fprintf(out, "\t\t%s r = %s_add_epi32(g0, g1);\n", vt, mm);
+	if (avx512)
+		fprintf(out, "\t\tr = _mm512_mask_sub_epi32(r, "
+		    "_mm512_cmpge_epu32_mask(r, e), r, e);\n");
+	else
+		fprintf(out, "\t\tr = _mm256_sub_epi32(r, _mm256_and_si256("
+		    "_mm256_cmpgt_epi32(r,\n"
+		    "\t\t    _mm256_sub_epi32(e, _mm256_set1_epi32(1))), e));\n");
+	if (nbperf->embed_data) {
+		if (avx512)
+			fprintf(out,
+			    "\t\tconst __m512i kk = _mm512_i32gather_epi32(r,\n"
+			    "\t\t    (const void *)%s_keys, 4);\n"
+			    "\t\tr = _mm512_mask_mov_epi32(_mm512_set1_epi32(-1),\n"
+			    "\t\t    _mm512_cmpeq_epi32_mask(kk, k), r);\n", name);
+		else
+			fprintf(out,
+			    "\t\tconst __m256i kk = _mm256_i32gather_epi32(\n"
+			    "\t\t    (const int *)%s_keys, r, 4);\n"
+			    "\t\tr = _mm256_or_si256(r, _mm256_xor_si256("
+			    "_mm256_cmpeq_epi32(kk, k),\n"
+			    "\t\t    _mm256_set1_epi32(-1)));\n", name);
+	}
+	fprintf(out, "\t\t%s_storeu_si%d((void *)(out + i), r);\n\t}\n",
+	    mm, bits);
+}
+#endif
+
+#if GRAPH_SIZE == 2
+/* NAME_x8_avx512 or NAME_x8_avx2, which return the number of keys done */
+static void
+print_x8_kernel(struct nbperf *nbperf, struct state *state, const char *g_type,
+    const char *out_type, int avx512)
+{
+	FILE *out = nbperf->output;
+	const char *isa = avx512 ? "avx512" : "avx2";
+
+	fprintf(out, "\n#if defined NBPERF_DISPATCH || defined %s\n"
+	    "#ifdef NBPERF_DISPATCH\n"
+	    "__attribute__((target(\"%s\")))\n"
+	    "#endif\n"
+	    "static size_t\n"
+	    "%s_x8_%s(const %s *keys, %s *out, size_t n)\n"
+	    "{\n"
+	    "\tsize_t i = 0;\n",
+	    avx512 ? "__AVX512F__" : "__AVX2__ && !defined __AVX512F__",
+	    avx512 ? "avx512f" : "avx2",
+	    nbperf->hash_name, isa, int_keytype(nbperf), out_type);
+	print_x8_simd(nbperf, state, g_type, avx512);
+	fprintf(out, "\treturn i;\n}\n#endif\n");
+}
+#endif
+
+/*
+ * With -b -I also emit NAME_x8(keys, out, n) for arrays of integer keys.
+ * For chm with 16bit hashes this is vectorized with AVX2 or AVX-512.  With
+ * GCC or clang on x86 the kernel is selected at run-time with cpuid, so
+ * one binary runs on any CPU, otherwise if enabled at compile-time.  The
+ * tail, older CPUs and other architectures, e.g. NEON without gathers,
+ * loop over NAME.
+ */
+static void
+print_x8(struct nbperf *nbperf, struct state *state, const char *g_type,
+    const char *hashtype)
+{
+	FILE *out = nbperf->output;
+	const char *name = nbperf->hash_name;
+	const char *out_type = nbperf->n >= 4294967295U ? "uint64_t" : "uint32_t";
+	int simd = 0;
+
+#if GRAPH_SIZE == 2
+	if (nbperf->hashes16 && state->graph.v <= 65536 && !nbperf->packed) {
+		simd = 1;
+		print_x8_kernel(nbperf, state, g_type, out_type, 1);
+		print_x8_kernel(nbperf, state, g_type, out_type, 0);
 	}
-        fprintf(nbperf->output,
-	    "\t%s (g[h[0]] + g[h[1]] + g[h[2]]) %% "
-                "%" PRIu32 ";\n", nbperf->embed_data ? "result =" : "return",
-                state->graph.e);
 #else
-	fprintf(nbperf->output,
-	    "\t%s (g[h[0]] + g[h[1]]) %% "
-	    "%" PRIu32 ";\n", nbperf->embed_data ? "result =" : "return",
-	    state->graph.e);
+	(void)state;
+	(void)g_type;
 #endif
+	fprintf(out, "\n%svoid\n"
+	    "%s_x8(const %s *keys, %s *out, size_t n)\n"
+	    "{\n"
+	    "\tsize_t i = 0;\n",
+	    nbperf->static_hash ? "static " : "", name, int_keytype(nbperf),
+	    out_type);
+	if (simd)
+		fprintf(out, "#if defined NBPERF_DISPATCH\n"
+		    "\tif (__builtin_cpu_supports(\"avx512f\"))\n"
+		    "\t\ti = %s_x8_avx512(keys, out, n);\n"
+		    "\telse if (__builtin_cpu_supports(\"avx2\"))\n"
+		    "\t\ti = %s_x8_avx2(keys, out, n);\n"
+		    "#elif defined __AVX512F__\n"
+		    "\ti = %s_x8_avx512(keys, out, n);\n"
+		    "#elif defined __AVX2__\n"
+		    "\ti = %s_x8_avx2(keys, out, n);\n"
+		    "#endif\n", name, name, name, name);
+	fprintf(out, "\tfor (; i < n; i++) {\n"
+	    "\t\tconst %s r = %s(keys[i]);\n", hashtype, name);
+	if (nbperf->embed_data && strcmp(hashtype, out_type))
+		fprintf(out, "\t\tout[i] = r == (%s)-1 ? (%s)-1 : r;\n",
+		    hashtype, out_type);
+	else
+		fprintf(out, "\t\tout[i] = r;\n");
+	fprintf(out, "\t}\n}\n");
+}
+
+/*
+ * With -C a C++17 header with constexpr tables and a constexpr lookup,
+ * so that constant keys fold to constant indices, e.g. in case labels.
+ */
+static void
+print_hash_cxx(struct nbperf *nbperf, struct state *state, const char *g_type,
+    int g_width, uint32_t per_line, const char *hashtype)
+{
+	FILE *out = nbperf->output;
+	const char *name = nbperf->hash_name;
+	const char *st = nbperf->static_hash ? "static " : "";
+	char lhs[32];
+
+	if (nbperf->embed_data) {
+		if (nbperf->intkeys)
+			embed_data_int(nbperf);
+		else
+			embed_data_string_view(nbperf);
+	}
+	print_g(nbperf, state, g_type, g_width, per_line);
+
+	fprintf(out, "%sconstexpr %s\n", st, hashtype);
+	if (!nbperf->intkeys)
+		fprintf(out, "%s(const char *key, size_t keylen)\n", name);
+	else
+		fprintf(out, "%s(const %s key)\n", name, int_keytype(nbperf));
+	fprintf(out, "{\n"
+	    "\tconst %s *g = %s_g;\n", g_type, name);
+	constexpr_hash_print(nbperf, "\t", "key", "keylen");
+	print_reduce(nbperf, state, "\t");
+	snprintf(lhs, sizeof(lhs), "const %s result =", g_type);
+	print_lookup(nbperf, state, "\t",
+	    nbperf->embed_data ? lhs : "return");
+	if (nbperf->embed_data && nbperf->intkeys)
+		fprintf(out, "\treturn %s_keys[result] == key ? result : (%s)-1;\n",
+		    name, hashtype);
+	else if (nbperf->embed_data)
+		fprintf(out, "\treturn %s_keys[result] == std::string_view(key, keylen)\n"
+		    "\t    ? result : (%s)-1;\n", name, hashtype);
+	fprintf(out, "}\n");
+	if (!nbperf->intkeys)
+		fprintf(out, "\n%sconstexpr %s\n"
+		    "%s(std::string_view key)\n"
+		    "{\n"
+		    "\treturn %s(key.data(), key.size());\n"
+		    "}\n", st, hashtype, name, name);
+}
+
+
+static void
+print_hash(struct nbperf *nbperf, struct state *state)
+{
+	uint32_t per_line;
+	const char *g_type;
+	int g_width;
+
+	print_coda(nbperf);
+	if (state->graph.v >= 65536) {
+		g_type = "uint32_t";
+		g_width = 6;
+		per_line = 8;
+	} else if (state->graph.v >= 256) {
+		g_type = "uint16_t";
+		g_width = 4;
+		per_line = 8;
+	} else {
+		g_type = "uint8_t";
+		g_width = 2;
+		per_line = 10;
+	}
+        const char* hashtype = nbperf->n >= 4294967295U ? "uint64_t"
+                : !nbperf->hashes16 ? "uint32_t" : "uint16_t";
+	if (nbperf->cxx) {
+		print_hash_cxx(nbperf, state, g_type, g_width, per_line,
+		    hashtype);
+		map_print(nbperf, NULL, state->graph.e);
+		return;
+	}
+        if ((nbperf->embed_data && !nbperf->intkeys) || nbperf->packed)
+                fprintf(nbperf->output, "#include <string.h>\n");
+	else if (nbperf->batch)
+		fprintf(nbperf->output, "#include <stddef.h>\n");
+	if (nbperf->batch && nbperf->intkeys)
+		/* the AVX kernels of NAME_x8 are selected at run-time */
+		fprintf(nbperf->output,
+		    "#if defined __GNUC__ && (defined __x86_64__ || defined __i386__) && \\\n"
+		    "    !defined NBPERF_NO_DISPATCH\n"
+		    "#ifndef NBPERF_DISPATCH\n"
+		    "#define NBPERF_DISPATCH\n"
+		    "#endif\n"
+		    "#include <immintrin.h>\n"
+		    "#elif defined __AVX2__ || defined __AVX512F__\n"
+		    "#include <immintrin.h>\n"
+		    "#endif\n");
+	if (nbperf->intkeys) {
+#if GRAPH_SIZE >= 3
+		inthash4_addprint(nbperf);
+#else
+                inthash_addprint(nbperf);
+#endif
+	}
+	if (nbperf->packed)
+		bitpack_addprint(nbperf);
+	if (nbperf->embed_data) {
+		if (nbperf->fixed)
+			fixed_embed_print(nbperf);
+		else if (nbperf->intkeys)
+			embed_data_int(nbperf);
+		else if (nbperf->keypool)
+			keypool_addprint(nbperf);
+		else
+			embed_data_string(nbperf);
+		if (nbperf->fingerprint)
+			fingerprint_addprint(nbperf, GRAPH_SIZE);
+        }
+	if (nbperf->batch)
+		print_g(nbperf, state, g_type, g_width, per_line);
+
+	fprintf(nbperf->output, "%s%s\n",
+                nbperf->static_hash ? "static " : "", hashtype);
+	if (nbperf->fixed)
+		fixed_signature_print(nbperf);
+	else if (!nbperf->intkeys)
+		fprintf(nbperf->output,
+			"%s(const void * __restrict key, size_t keylen)\n",
+			nbperf->hash_name);
+	else
+		fprintf(nbperf->output,	"%s(const %s key)\n",
+			nbperf->hash_name, int_keytype(nbperf));
+	fprintf(nbperf->output, "{\n");
+	if (nbperf->embed_data)
+                fprintf(nbperf->output, "\t%s result;\n", g_type);
+	if (nbperf->fingerprint)
+		fprintf(nbperf->output, "\tuint%u_t fp;\n", nbperf->fingerprint);
+	if (nbperf->batch)
+		fprintf(nbperf->output, "\tconst %s *g = %s_g;\n",
+		    nbperf->packed ? "uint8_t" : g_type, nbperf->hash_name);
+	else
+		print_g(nbperf, state, g_type, g_width, per_line);
+	shape_reject_print(nbperf, "\t", hashtype);
+	print_h(nbperf, "\t");
+	print_vertices(nbperf, state, "\t", nbperf->fingerprint ? "fp" : NULL);
+
+	print_lookup(nbperf, state, "\t",
+	    nbperf->embed_data ? "result =" : "return");
         if (nbperf->embed_data) {
-		if (!nbperf->intkeys)
+		if (nbperf->fingerprint)
+			/* most misses end here, without touching the key */
+			fprintf(nbperf->output,
+				"\tif (%s_fp[result] != fp)\n"
+				"\t\treturn (%s)-1;\n",
+				nbperf->hash_name, hashtype);
+		if (nbperf->keypool)
+			fprintf(nbperf->output,
+				"\treturn %s_keycmp(result, key, keylen) ? result : (%s)-1;\n",
+				nbperf->hash_name, hashtype);
+		else if (nbperf->fingerprint)
+			fprintf(nbperf->output,
+				"\treturn (%s_keylens[result] == keylen &&\n"
+				"\t    memcmp(%s_keys[result], key, keylen) == 0) ? result : (%s)-1;\n",
+				nbperf->hash_name, nbperf->hash_name, hashtype);
+		else if (nbperf->fixed) {
+			fprintf(nbperf->output, "\treturn (");
+			fixed_cmp_print(nbperf, "result");
+			fprintf(nbperf->output, ") ? result : (%s)-1;\n",
+				hashtype);
+		} else if (!nbperf->intkeys)
 			fprintf(nbperf->output, "\treturn (strcmp(%s_keys[result], key) == 0)"
 				" ? result : (%s)-1;\n",
 				nbperf->hash_name, hashtype);
@@ -362,11 +944,12 @@ print_hash(struct nbperf *nbperf, struct state *state)
 				nbperf->hash_name, hashtype);
 	}
 	fprintf(nbperf->output, "}\n");
+	if (nbperf->batch)
+		print_batch(nbperf, state, g_type);
+	if (nbperf->batch && nbperf->intkeys)
+		print_x8(nbperf, state, g_type, hashtype);
 
-	if (nbperf->map_output != NULL) {
-		for (i = 0; i < state->graph.e; ++i)
-			fprintf(nbperf->map_output, "%" PRIu32 "\n", i);
-	}
+	map_print(nbperf, NULL, state->graph.e);
 }
 
 int
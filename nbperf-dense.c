@@ -0,0 +1,370 @@
+/*-
+ * Copyright (c) 2022 Reini Urban
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#if HAVE_NBTOOL_CONFIG_H
+#include "nbtool_config.h"
+#endif
+
+#include <err.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nbperf.h"
+
+/*
+ * Integer keys, e.g. Unicode code points, are often a few runs of
+ * consecutive or nearly consecutive values.  For those no hash is
+ * needed: the key minus the base of its run indexes a table with the
+ * index of the key in the input, so a lookup costs a subtraction and a
+ * compare instead of the multiply, the modulos and the g table reads.
+ * The few keys outside of the runs are found by a binary search in a
+ * sorted table.  The result is the index of the key in the input, as
+ * with chm, and -1 for all other keys, also without -d.
+ */
+
+/* the largest gap between two keys of a run */
+#define DENSE_GAP 8
+/* the least keys of a run, unless it has all keys */
+#define DENSE_MIN_RUN 8
+#define DENSE_MAX_RUNS 16
+/* the most keys outside of the runs */
+#define DENSE_MAX_SPARSE 256
+
+struct pair {
+	uint64_t key; /* sign-extended without -L */
+	uint32_t idx;
+};
+
+struct run {
+	size_t first, n; /* of the sorted pairs */
+	uint32_t span; /* last key - first key + 1 */
+	uint32_t offset; /* in the table */
+};
+
+struct dense {
+	struct pair *pairs;
+	struct run runs[DENSE_MAX_RUNS];
+	unsigned nruns;
+	size_t nsparse;
+	uint32_t table_size;
+};
+
+/* the keys are int32_t, or uint64_t with -L */
+static int sorting_signed;
+
+static uint64_t
+key_value(const struct nbperf *nbperf, size_t i)
+{
+	const uint64_t k = (uint64_t)(uintptr_t)nbperf->keys[i];
+
+	return nbperf->intkeys64 ? k : (uint64_t)(int64_t)(int32_t)k;
+}
+
+static int
+pair_cmp(const void *a_, const void *b_)
+{
+	const struct pair *a = a_, *b = b_;
+
+	if (a->key != b->key) {
+		if (sorting_signed)
+			return (int64_t)a->key < (int64_t)b->key ? -1 : 1;
+		return a->key < b->key ? -1 : 1;
+	}
+	return a->idx < b->idx ? -1 : a->idx > b->idx;
+}
+
+static int
+run_cmp(const void *a_, const void *b_)
+{
+	const struct run *a = a_, *b = b_;
+
+	/* the biggest runs are checked first */
+	if (a->n != b->n)
+		return a->n > b->n ? -1 : 1;
+	return a->first < b->first ? -1 : a->first > b->first;
+}
+
+/*
+ * Split the sorted keys into the runs and the sparse keys.  Returns 0 if
+ * the runs have at least half of the keys, with at most twice as many
+ * table entries, else -1.
+ */
+static int
+dense_analyse(const struct nbperf *nbperf, struct dense *d)
+{
+	const size_t n = nbperf->n;
+	size_t i, j, covered = 0;
+	uint64_t table_size = 0;
+
+	memset(d, 0, sizeof(*d));
+	if (n == 0)
+		return -1;
+	d->pairs = calloc(n, sizeof(*d->pairs));
+	if (d->pairs == NULL)
+		err(1, "malloc failed");
+	for (i = 0; i < n; i++) {
+		d->pairs[i].key = key_value(nbperf, i);
+		d->pairs[i].idx = (uint32_t)i;
+	}
+	sorting_signed = !nbperf->intkeys64;
+	/* e.g. the code points of tables are often sorted already */
+	for (i = 1; i < n; i++)
+		if (pair_cmp(&d->pairs[i - 1], &d->pairs[i]) > 0)
+			break;
+	if (i < n)
+		qsort(d->pairs, n, sizeof(*d->pairs), pair_cmp);
+
+	for (i = 0; i < n; i = j) {
+		for (j = i + 1; j < n; j++)
+			if (d->pairs[j].key - d->pairs[j - 1].key > DENSE_GAP)
+				break;
+		const uint64_t span = d->pairs[j - 1].key - d->pairs[i].key + 1;
+		if ((j - i < DENSE_MIN_RUN && j - i < n) || span > 2 * (j - i)) {
+			d->nsparse += j - i;
+			continue;
+		}
+		if (d->nruns == DENSE_MAX_RUNS)
+			return -1;
+		d->runs[d->nruns].first = i;
+		d->runs[d->nruns].n = j - i;
+		d->runs[d->nruns].span = (uint32_t)span;
+		d->runs[d->nruns].offset = (uint32_t)table_size;
+		d->nruns++;
+		covered += j - i;
+		table_size += span;
+	}
+	if (d->nruns == 0 || covered < n - covered ||
+	    d->nsparse > DENSE_MAX_SPARSE || table_size > 2 * covered)
+		return -1;
+	d->table_size = (uint32_t)table_size;
+	qsort(d->runs, d->nruns, sizeof(*d->runs), run_cmp);
+	return 0;
+}
+
+/* the analysis of dense_check, reused by dense_compute */
+static struct dense checked;
+static const struct nbperf *checked_nbperf;
+
+int
+dense_check(struct nbperf *nbperf)
+{
+	free(checked.pairs);
+	if (dense_analyse(nbperf, &checked) != 0) {
+		free(checked.pairs);
+		checked.pairs = NULL;
+		return 0;
+	}
+	checked_nbperf = nbperf;
+	return 1;
+}
+
+struct table_fmt {
+	const uint32_t *a;
+	const uint64_t *keys;
+	int keys_signed;
+	size_t per_line;
+};
+
+static char *
+table_entry(char *p, size_t i, const void *ctx)
+{
+	const struct table_fmt *f = ctx;
+
+	p = fmt_str(p, i % f->per_line == 0 ? "\t" : " ");
+	if (f->keys && f->keys_signed) {
+		const int64_t k = (int64_t)f->keys[i];
+
+		if (k < 0)
+			*p++ = '-';
+		p = fmt_dec(p, k < 0 ? -(uint64_t)k : (uint64_t)k, 0);
+	} else if (f->keys) {
+		p = fmt_dec(p, f->keys[i], 0);
+		if (f->keys[i] > INT64_MAX)
+			*p++ = 'u';
+	} else
+		p = fmt_dec(p, f->a[i], 0);
+	*p++ = ',';
+	if (i % f->per_line == f->per_line - 1)
+		*p++ = '\n';
+	return p;
+}
+
+static void
+array_print(struct nbperf *nbperf, const char *type, const char *suffix,
+    const uint32_t *a, const uint64_t *keys, size_t n)
+{
+	struct table_fmt f = { a, keys, !nbperf->intkeys64, 10 };
+
+	fprintf(nbperf->output, "%sconst %s %s_%s[%zu] = {\n",
+	    nbperf->static_hash ? "static " : "", type, nbperf->hash_name,
+	    suffix, n);
+	table_print(nbperf->output, n, 24, table_entry, &f);
+	fprintf(nbperf->output, "%s};\n\n", n % f.per_line ? "\n" : "");
+}
+
+static void
+print_sparse(struct nbperf *nbperf, const struct dense *d, const char *type,
+    const uint8_t *in_run)
+{
+	uint64_t *keys;
+	uint32_t *idx;
+	size_t i, j;
+
+	keys = calloc(d->nsparse, sizeof(*keys));
+	idx = calloc(d->nsparse, sizeof(*idx));
+	if (keys == NULL || idx == NULL)
+		err(1, "malloc failed");
+	for (i = j = 0; i < nbperf->n; i++) {
+		if (in_run[i])
+			continue;
+		keys[j] = d->pairs[i].key;
+		idx[j] = d->pairs[i].idx;
+		j++;
+	}
+	array_print(nbperf, nbperf->intkeys64 ? "uint64_t" : "int32_t", "sparse",
+	    NULL, keys, d->nsparse);
+	array_print(nbperf, type, "sparse_idx", idx, NULL, d->nsparse);
+	free(keys);
+	free(idx);
+}
+
+int
+dense_compute(struct nbperf *nbperf)
+{
+	const char *name = nbperf->hash_name;
+	const char *keytype = nbperf->intkeys64 ? "uint64_t" : "int32_t";
+	const char *dtype = nbperf->intkeys64 ? "uint64_t" : "uint32_t";
+	const char *type;
+	struct dense d;
+	FILE *out;
+	uint32_t *table;
+	uint8_t *in_run;
+	size_t i;
+	unsigned r;
+	int direct, rv;
+
+	if (checked_nbperf == nbperf) {
+		d = checked;
+		rv = 0;
+		checked.pairs = NULL;
+		checked_nbperf = NULL;
+	} else
+		rv = dense_analyse(nbperf, &d);
+	for (i = 1; i < nbperf->n; i++) {
+		if (d.pairs[i - 1].key == d.pairs[i].key) {
+			nbperf->has_duplicates = 1;
+			free(d.pairs);
+			return -1;
+		}
+	}
+	if (rv != 0)
+		errx(1, "The keys are not dense enough for -a dense");
+	/* a contiguous run of the keys in sorted order needs no table */
+	direct = d.nruns == 1 && d.nsparse == 0 && d.table_size == nbperf->n;
+	for (i = 0; direct && i < nbperf->n; i++)
+		direct = d.pairs[i].idx == i;
+
+	type = nbperf->n < 255 ? "uint8_t" : nbperf->n < 65535 ? "uint16_t"
+	    : "uint32_t";
+	table = calloc(d.table_size, sizeof(*table));
+	in_run = calloc(nbperf->n, 1);
+	if (table == NULL || in_run == NULL)
+		err(1, "malloc failed");
+	/* the index + 1 of the key, 0 for the values between the keys */
+	for (r = 0; r < d.nruns; r++) {
+		const struct run *run = &d.runs[r];
+		const uint64_t base = d.pairs[run->first].key;
+
+		for (i = run->first; i < run->first + run->n; i++) {
+			table[run->offset + (d.pairs[i].key - base)] =
+			    d.pairs[i].idx + 1;
+			in_run[i] = 1;
+		}
+	}
+
+	nbperf->hash_header = NULL;
+	print_coda(nbperf);
+	out = nbperf->output;
+	fprintf(out, "\n");
+	if (!direct)
+		array_print(nbperf, type, "table", table, NULL, d.table_size);
+	if (d.nsparse)
+		print_sparse(nbperf, &d, type, in_run);
+
+	fprintf(out, "%suint32_t\n"
+	    "%s(const %s key)\n"
+	    "{\n"
+	    "\t%s d;\n\n",
+	    nbperf->static_hash ? "static " : "", name, keytype, dtype);
+	for (r = 0; r < d.nruns; r++) {
+		const struct run *run = &d.runs[r];
+		const uint64_t base = d.pairs[run->first].key;
+
+		if (nbperf->intkeys64)
+			fprintf(out, "\td = key - UINT64_C(%" PRIu64 ");\n", base);
+		else
+			fprintf(out, "\td = (uint32_t)key - UINT32_C(%" PRIu32 ");\n",
+			    (uint32_t)base);
+		if (direct) {
+			fprintf(out, "\treturn d < %" PRIu32 " ? (uint32_t)d : "
+			    "(uint32_t)-1;\n", run->span);
+			break;
+		}
+		fprintf(out, "\tif (d < %" PRIu32 ")\n"
+		    "\t\treturn (uint32_t)%s_table[d", run->span, name);
+		if (run->offset)
+			fprintf(out, " + %" PRIu32, run->offset);
+		fprintf(out, "] - 1;\n");
+	}
+	if (d.nsparse) {
+		/* a branchless lower bound */
+		fprintf(out,
+		    "\t{\n"
+		    "\t\tconst %s *p = %s_sparse;\n"
+		    "\t\tuint32_t n = %zu;\n\n"
+		    "\t\twhile (n > 1) {\n"
+		    "\t\t\tconst uint32_t half = n / 2;\n"
+		    "\t\t\tp = p[half] <= key ? p + half : p;\n"
+		    "\t\t\tn -= half;\n"
+		    "\t\t}\n"
+		    "\t\tif (*p == key)\n"
+		    "\t\t\treturn %s_sparse_idx[p - %s_sparse];\n"
+		    "\t}\n", keytype, name, d.nsparse, name, name);
+	}
+	if (!direct)
+		fprintf(out, "\treturn (uint32_t)-1;\n");
+	fprintf(out, "}\n");
+	map_print(nbperf, NULL, nbperf->n);
+	free(in_run);
+	free(table);
+	free(d.pairs);
+	return 0;
+}
@@ -0,0 +1,565 @@
+/*-
+ * Copyright (c) 2022 Reini Urban
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#if HAVE_NBTOOL_CONFIG_H
+#include "nbtool_config.h"
+#endif
+
+#include <err.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+#include "nbperf.h"
+
+/*
+ * A description of LCP bucketing can be found in:
+ * "Monotone Minimal Perfect Hashing: Searching a Sorted Table with O(1)
+ * Accesses" by Belazzougui, Boldi, Pagh and Vigna, SODA 2009.
+ */
+
+/*
+ * The keys must be sorted. They are split into buckets of 2^b consecutive
+ * keys. Each key is seen as the bit string key || '\0', so the set is
+ * prefix-free. The longest common prefix (LCP) of all keys in a bucket
+ * is unique for this bucket: if two buckets i < j had the same LCP p,
+ * the last key of i starts with p1, so all keys of j would start with p1
+ * and the LCP of j would be longer than p.
+ *
+ * Two static functions are built on random, acyclic 3-graphs, as with
+ * bdz, but with the XOR of the three vertex values as result:
+ * - key -> (index of the LCP length of its bucket, offset in its bucket)
+ * - LCP prefix -> bucket
+ * The rank of a key is then (bucket << b) | offset. Only the distinct
+ * LCP lengths are stored, so the whole function needs about
+ * 1.24 * (b + log2(distinct LCP lengths)) bits per key.
+ */
+
+#define GRAPH_SIZE 3
+#include "graph2.h"
+
+#define MAX_PREFIX_ITERATIONS 1000
+#define PREFIX_C 1.5
+
+struct state {
+	struct SIZED(graph) graph;	/* key -> lcp index, offset */
+	struct SIZED(graph) pgraph;	/* bucket prefix -> bucket */
+	struct nbperf prefixes;
+	uint8_t *visited;
+	uint8_t *g, *pg;
+	size_t g_size, pg_size;
+	uint32_t *values;
+	uint32_t *lcps;
+	uint32_t *lcp_values;
+	uint32_t lcp_count;
+	uint32_t nbuckets;
+	size_t max_prefix;
+	unsigned b, d, r, pr;
+};
+
+static inline uint8_t
+key_byte(const struct nbperf *nbperf, size_t k, size_t i)
+{
+	return i < nbperf->keylens[k] ? ((const uint8_t *)nbperf->keys[k])[i]
+				      : 0;
+}
+
+/* LCP in bits of key a and b, with the terminating NUL. */
+static uint32_t
+lcp_bits(const struct nbperf *nbperf, size_t a, size_t b)
+{
+	size_t i, len;
+	uint32_t bits;
+	uint8_t x;
+
+	len = nbperf->keylens[a] < nbperf->keylens[b] ? nbperf->keylens[a]
+						      : nbperf->keylens[b];
+	for (i = 0; i <= len; i++) {
+		x = key_byte(nbperf, a, i) ^ key_byte(nbperf, b, i);
+		if (x) {
+			bits = i * 8;
+			while (!(x & 0x80)) {
+				x <<= 1;
+				bits++;
+			}
+			return bits;
+		}
+	}
+	errx(1, "Keys must not contain NUL bytes, line %zu", b + 1);
+}
+
+static int
+check_sorted(struct nbperf *nbperf)
+{
+	size_t i, len;
+	int cmp;
+
+	for (i = 1; i < nbperf->n; i++) {
+		len = nbperf->keylens[i - 1] < nbperf->keylens[i]
+		    ? nbperf->keylens[i - 1] : nbperf->keylens[i];
+		cmp = memcmp(nbperf->keys[i - 1], nbperf->keys[i], len);
+		if (cmp == 0) {
+			if (nbperf->keylens[i - 1] == nbperf->keylens[i]) {
+				fprintf(stderr, "Duplicate %s\n",
+				    nbperf->keys[i]);
+				nbperf->has_duplicates = 1;
+				return -1;
+			}
+			cmp = nbperf->keylens[i - 1] < nbperf->keylens[i]
+			    ? -1 : 1;
+		}
+		if (cmp > 0)
+			errx(1, "Keys must be sorted for -a monotone, "
+			     "see line %zu. Use LC_ALL=C sort", i + 1);
+	}
+	return 0;
+}
+
+static int
+uint32_cmp(const void *a_, const void *b_)
+{
+	const uint32_t a = *(const uint32_t *)a_, b = *(const uint32_t *)b_;
+	return a < b ? -1 : a > b;
+}
+
+/* Fill lcps for bucket size 2^b, and the sorted distinct lcp_values. */
+static void
+bucket_lcps(struct nbperf *nbperf, struct state *state, unsigned b)
+{
+	uint32_t i, j, first, last;
+
+	state->b = b;
+	state->nbuckets = (uint32_t)((nbperf->n + (1U << b) - 1) >> b);
+	for (i = 0; i < state->nbuckets; i++) {
+		first = i << b;
+		last = first + (1U << b) - 1;
+		if (last >= nbperf->n)
+			last = nbperf->n - 1;
+		if (first == last) /* the full key */
+			state->lcps[i] = (nbperf->keylens[first] + 1) * 8;
+		else
+			state->lcps[i] = lcp_bits(nbperf, first, last);
+	}
+	memcpy(state->lcp_values, state->lcps,
+	    state->nbuckets * sizeof(uint32_t));
+	qsort(state->lcp_values, state->nbuckets, sizeof(uint32_t),
+	    uint32_cmp);
+	for (i = j = 1; i < state->nbuckets; i++)
+		if (state->lcp_values[i] != state->lcp_values[j - 1])
+			state->lcp_values[j++] = state->lcp_values[i];
+	state->lcp_count = j;
+}
+
+/*
+ * Select the bucket size with the smallest estimated output size.
+ */
+static void
+select_buckets(struct nbperf *nbperf, struct state *state)
+{
+	const unsigned maxb = bitpack_width(nbperf->n);
+	double size, best_size = 0;
+	unsigned b, d, best_b = maxb;
+
+	for (b = 1; b < maxb; b++) {
+		bucket_lcps(nbperf, state, b);
+		d = state->lcp_count > 1 ? bitpack_width(state->lcp_count) : 0;
+		size = nbperf->c * (b + d) * nbperf->n +
+		    PREFIX_C * bitpack_width(state->nbuckets) *
+		    state->nbuckets + 32.0 * (1U << d);
+		if (!best_size || size < best_size) {
+			best_size = size;
+			best_b = b;
+		}
+	}
+	if (best_size == 0 || nbperf->c * maxb * nbperf->n < best_size) {
+		/* one bucket: store the rank directly */
+		state->b = maxb;
+		state->nbuckets = 1;
+		state->lcp_count = 0;
+		state->d = 0;
+		state->r = maxb;
+		return;
+	}
+	bucket_lcps(nbperf, state, best_b);
+	state->d = state->lcp_count > 1 ? bitpack_width(state->lcp_count) : 0;
+	state->r = state->b + state->d;
+	state->pr = bitpack_width(state->nbuckets);
+}
+
+static void
+assign_values(struct SIZED(graph) *graph, const uint32_t *values,
+    uint8_t *g, unsigned bits, uint8_t *visited)
+{
+	struct SIZED(edge) *e;
+	uint32_t i, j, k, v, val;
+
+	memset(visited, 0, graph->va);
+	for (i = 0; i < graph->e; ++i) {
+		j = graph->output_order[i];
+		e = &graph->edges[j];
+		for (k = 0; k < GRAPH_SIZE; k++)
+			if (!visited[e->vertices[k]])
+				break;
+		assert(k < GRAPH_SIZE);
+		v = e->vertices[k];
+		val = values ? values[j] : j;
+		for (k = 0; k < GRAPH_SIZE; k++)
+			if (e->vertices[k] != v)
+				val ^= (uint32_t)bitpack_get(g, e->vertices[k],
+				    bits);
+		bitpack_set(g, v, bits, val);
+		for (k = 0; k < GRAPH_SIZE; k++)
+			visited[e->vertices[k]] = 1;
+	}
+}
+
+static uint32_t
+graph_size(struct nbperf *nbperf, double c, uint32_t n, uint32_t *va)
+{
+	const double min_c = 1.24;
+	uint32_t v = c * n;
+
+	if (min_c * n > v)
+		++v;
+	if (v < 8)
+		v = 8;
+	if (nbperf->allow_hash_fudging) // two more as reserve
+		*va = (v + 2) | 3;
+	else
+		*va = v;
+	return v;
+}
+
+/*
+ * Build the bucket prefixes as keys for the second graph.
+ * The lcp bits are masked and the number of bits in the last byte is
+ * appended to tell prefixes with the same bytes apart.
+ */
+static void
+build_prefixes(struct nbperf *nbperf, struct state *state)
+{
+	const char **keys;
+	size_t *keylens;
+	uint32_t i, l, nbytes, j;
+	uint8_t *buf;
+
+	keys = calloc(state->nbuckets, sizeof(*keys));
+	keylens = calloc(state->nbuckets, sizeof(*keylens));
+	if (keys == NULL || keylens == NULL)
+		err(1, "malloc failed");
+	state->max_prefix = 0;
+	for (i = 0; i < state->nbuckets; i++) {
+		l = state->lcps[i];
+		nbytes = (l + 7) >> 3;
+		if (nbytes > state->max_prefix)
+			state->max_prefix = nbytes;
+		/* padded for mi_vector_hash */
+		buf = calloc(((nbytes + 4) & ~3U) + 4, 1);
+		if (buf == NULL)
+			err(1, "malloc failed");
+		for (j = 0; j < nbytes; j++)
+			buf[j] = key_byte(nbperf, (size_t)i << state->b, j);
+		if (l & 7)
+			buf[nbytes - 1] &= (uint8_t)(0xff00 >> (l & 7));
+		buf[nbytes] = (uint8_t)(l & 7);
+		keys[i] = (const char *)buf;
+		keylens[i] = nbytes + 1;
+	}
+	state->prefixes = *nbperf;
+	state->prefixes.n = state->nbuckets;
+	state->prefixes.keys = keys;
+	state->prefixes.keylens = keylens;
+	state->prefixes.hash_keys = keys;
+	state->prefixes.hash_keylens = keylens;
+}
+
+static void
+free_prefixes(struct state *state)
+{
+	uint32_t i;
+
+	if (state->prefixes.keys == NULL)
+		return;
+	for (i = 0; i < state->prefixes.n; i++)
+		free((void *)state->prefixes.keys[i]);
+	free((void *)state->prefixes.keys);
+	free((void *)state->prefixes.keylens);
+}
+
+static void
+print_reduce(struct nbperf *nbperf, const struct SIZED(graph) *graph)
+{
+	unsigned i;
+
+	if (nbperf->fastmod && nbperf->hashes16) {
+		fprintf(nbperf->output,
+		    "\n\tm = UINT32_C(0xFFFFFFFF) / %" PRIu32 " + 1;\n",
+		    graph->v);
+		for (i = 0; i < GRAPH_SIZE; i++)
+			fprintf(nbperf->output,
+			    "\th[%u] = (uint16_t)((((uint64_t)(m * h[%u])) * %"
+			    PRIu32 ") >> 32);\n", i, i, graph->v);
+	} else if (nbperf->fastmod) {
+		fprintf(nbperf->output,
+		    "\n\tm = UINT64_C(0xFFFFFFFFFFFFFFFF) / %" PRIu32 " + 1;\n",
+		    graph->v);
+		for (i = 0; i < GRAPH_SIZE; i++)
+			fprintf(nbperf->output,
+			    "\th[%u] = (uint32_t)((((__uint128_t)(m * h[%u])) * %"
+			    PRIu32 ") >> 64);\n", i, i, graph->v);
+	} else {
+		fprintf(nbperf->output, "\n");
+		for (i = 0; i < GRAPH_SIZE; i++)
+			fprintf(nbperf->output, "\th[%u] = h[%u] %% %" PRIu32
+			    ";\n", i, i, graph->v);
+	}
+	if (graph->hash_fudge & 1)
+		fprintf(nbperf->output, "\th[1] ^= (h[0] == h[1]);\n");
+	if (graph->hash_fudge & 2) {
+		fprintf(nbperf->output,
+		    "\th[2] ^= (h[0] == h[2] || h[1] == h[2]);\n");
+		fprintf(nbperf->output,
+		    "\th[2] ^= 2 * (h[0] == h[2] || h[1] == h[2]);\n");
+	}
+}
+
+static void
+print_hash(struct nbperf *nbperf, struct state *state)
+{
+	uint32_t i;
+
+	print_coda(nbperf);
+	fprintf(nbperf->output, "#include <string.h>\n");
+	bitpack_addprint(nbperf);
+	if (nbperf->embed_data && nbperf->keypool)
+		keypool_addprint(nbperf);
+	else if (nbperf->embed_data) {
+		fprintf(nbperf->output, "%sconst char * const %s_keys[%" PRIu64 "] = {\n",
+			nbperf->static_hash ? "static " : "",
+			nbperf->hash_name, nbperf->n);
+		keys_print(nbperf);
+		fprintf(nbperf->output, "};\n\n");
+	}
+
+	fprintf(nbperf->output, "%suint32_t\n",
+	    nbperf->static_hash ? "static " : "");
+	fprintf(nbperf->output,
+	    "%s(const void * __restrict key, size_t keylen)\n",
+	    nbperf->hash_name);
+	fprintf(nbperf->output, "{\n");
+	bitpack_print(nbperf, "\t", "g", state->g, state->g_size);
+	if (state->nbuckets > 1) {
+		if (state->d) {
+			/* padded to 2^d for non-keys */
+			fprintf(nbperf->output,
+			    "\tstatic const uint32_t lcp[%u] = {\n\t    ",
+			    1U << state->d);
+			for (i = 0; i < (1U << state->d); i++) {
+				fprintf(nbperf->output, "%" PRIu32 ", ",
+				    state->lcp_values[i < state->lcp_count ? i
+					: state->lcp_count - 1]);
+				if ((i + 1) % 10 == 0 && i + 1 < (1U << state->d))
+					fprintf(nbperf->output, "\n\t    ");
+			}
+			fprintf(nbperf->output, "\n\t};\n");
+		}
+		bitpack_print(nbperf, "\t", "pg", state->pg, state->pg_size);
+		fprintf(nbperf->output, "\tuint8_t buf[%zu];\n",
+		    state->max_prefix + 4);
+		fprintf(nbperf->output,
+		    "\tuint32_t val, l, nbytes, bucket;\n\tsize_t len;\n");
+	} else
+		fprintf(nbperf->output, "\tuint32_t val;\n");
+	if (nbperf->embed_data)
+		fprintf(nbperf->output, "\tuint32_t result;\n");
+	if (nbperf->fastmod)
+		fprintf(nbperf->output, "\tuint%u_t m;\n",
+		    nbperf->hashes16 ? 32 : 64);
+	if (nbperf->hashes16)
+		fprintf(nbperf->output, "\tuint16_t h[%u];\n\n", nbperf->hash_size * 2);
+	else
+		fprintf(nbperf->output, "\tuint32_t h[%u];\n\n", nbperf->hash_size);
+
+	(*nbperf->print_hash)(nbperf, "\t", "key", "keylen", "h");
+	print_reduce(nbperf, &state->graph);
+	fprintf(nbperf->output,
+	    "\tval = _getbits(g, h[0], %u) ^ _getbits(g, h[1], %u) ^ "
+	    "_getbits(g, h[2], %u);\n", state->r, state->r, state->r);
+	if (state->nbuckets > 1) {
+		if (state->d)
+			fprintf(nbperf->output, "\tl = lcp[val >> %u];\n",
+			    state->b);
+		else
+			fprintf(nbperf->output, "\tl = %" PRIu32 ";\n",
+			    state->lcp_values[0]);
+		fprintf(nbperf->output,
+		    "\tnbytes = (l + 7) >> 3;\n"
+		    "\tlen = nbytes < keylen ? nbytes : keylen;\n"
+		    "\tmemcpy(buf, key, len);\n"
+		    "\tmemset(buf + len, 0, nbytes + 4 - len);\n"
+		    "\tif (l & 7)\n"
+		    "\t\tbuf[nbytes - 1] &= (uint8_t)(0xff00 >> (l & 7));\n"
+		    "\tbuf[nbytes] = (uint8_t)(l & 7);\n");
+		(*state->prefixes.print_hash)(&state->prefixes, "\t", "buf",
+		    "nbytes + 1", "h");
+		print_reduce(nbperf, &state->pgraph);
+		fprintf(nbperf->output,
+		    "\tbucket = _getbits(pg, h[0], %u) ^ _getbits(pg, h[1], %u) ^ "
+		    "_getbits(pg, h[2], %u);\n", state->pr, state->pr, state->pr);
+		fprintf(nbperf->output,
+		    "\t%s (bucket << %u) | (val & 0x%" PRIx32 ");\n",
+		    nbperf->embed_data ? "result =" : "return", state->b,
+		    (uint32_t)((1U << state->b) - 1));
+	} else
+		fprintf(nbperf->output, "\t%s val;\n",
+		    nbperf->embed_data ? "result =" : "return");
+	if (nbperf->embed_data && nbperf->keypool)
+		fprintf(nbperf->output,
+		    "\treturn (result < %" PRIu64 " && %s_keycmp(result, key, keylen))"
+		    " ? result : (uint32_t)-1;\n",
+		    nbperf->n, nbperf->hash_name);
+	else if (nbperf->embed_data)
+		fprintf(nbperf->output,
+		    "\treturn (result < %" PRIu64 " && strcmp(%s_keys[result], key) == 0)"
+		    " ? result : (uint32_t)-1;\n",
+		    nbperf->n, nbperf->hash_name);
+	fprintf(nbperf->output, "}\n");
+
+	map_print(nbperf, NULL, nbperf->n);
+}
+
+int
+monotone_compute(struct nbperf *nbperf)
+{
+	struct state state;
+	int retval = -1;
+	uint32_t v, va, i, idx;
+	uint32_t *p;
+
+	if (nbperf->n < 1)
+		errx(1, "Not enough members, n < 1");
+	if (nbperf->intkeys)
+		errx(1, "-a monotone does not support integer keys");
+	if (nbperf->c == 0)
+		nbperf->c = 1.24;
+	if (nbperf->c < 1.24)
+		errx(1, "The argument for option -c must be at least 1.24");
+	if (nbperf->hash_size < 3)
+		errx(1, "The hash function must generate at least 3 values");
+	if (check_sorted(nbperf))
+		return -1;
+
+	memset(&state, 0, sizeof(state));
+	state.lcps = calloc(nbperf->n, sizeof(uint32_t));
+	state.lcp_values = calloc(nbperf->n, sizeof(uint32_t));
+	state.values = calloc(nbperf->n, sizeof(uint32_t));
+	if (state.lcps == NULL || state.lcp_values == NULL ||
+	    state.values == NULL)
+		err(1, "malloc failed");
+	select_buckets(nbperf, &state);
+	for (i = 0; i < nbperf->n; i++) {
+		idx = 0;
+		if (state.d) {
+			p = bsearch(&state.lcps[i >> state.b], state.lcp_values,
+			    state.lcp_count, sizeof(uint32_t), uint32_cmp);
+			assert(p != NULL);
+			idx = p - state.lcp_values;
+		}
+		state.values[i] = (idx << state.b) |
+		    (i & ((UINT32_C(1) << state.b) - 1));
+	}
+
+	(*nbperf->seed_hash)(nbperf);
+	v = graph_size(nbperf, nbperf->c, nbperf->n, &va);
+	graph3_setup(&state.graph, v, nbperf->n, va);
+	state.g_size = bitpack_size(va, state.r);
+	state.g = calloc(state.g_size, 1);
+	state.visited = calloc(va, 1);
+	if (state.g == NULL || state.visited == NULL)
+		err(1, "malloc failed");
+	if (graph3_hash(nbperf, &state.graph))
+		goto failed;
+	if (graph3_output_order(&state.graph))
+		goto failed;
+
+	if (state.nbuckets > 1) {
+		build_prefixes(nbperf, &state);
+		/* The prefix graph is small, trade some space for less
+		 * iterations. */
+		v = graph_size(nbperf, nbperf->c < PREFIX_C ? PREFIX_C : nbperf->c,
+		    state.nbuckets, &va);
+		graph3_setup(&state.pgraph, v, state.nbuckets, va);
+		state.pg_size = bitpack_size(va, state.pr);
+		state.pg = calloc(state.pg_size, 1);
+		if (state.pg == NULL)
+			err(1, "malloc failed");
+		/* The prefixes are independent of the keys graph, so only
+		 * retry with a new seed for them. */
+		for (i = 0;; i++) {
+			if (i == MAX_PREFIX_ITERATIONS)
+				goto failed;
+			(*state.prefixes.seed_hash)(&state.prefixes);
+			if (graph3_hash(&state.prefixes, &state.pgraph)) {
+				if (state.prefixes.has_duplicates)
+					errx(1, "Duplicate bucket prefixes");
+				continue;
+			}
+			if (graph3_output_order(&state.pgraph) == 0)
+				break;
+			
+		}
+		if (va > state.graph.va &&
+		    (state.visited = realloc(state.visited, va)) == NULL)
+			err(1, "malloc failed");
+	}
+	assign_values(&state.graph, state.values, state.g, state.r,
+	    state.visited);
+	if (state.nbuckets > 1)
+		assign_values(&state.pgraph, NULL, state.pg, state.pr,
+		    state.visited);
+	print_hash(nbperf, &state);
+
+	retval = 0;
+
+failed:
+	graph3_free(&state.graph);
+	if (state.nbuckets > 1)
+		graph3_free(&state.pgraph);
+	free_prefixes(&state);
+	free(state.g);
+	free(state.pg);
+	free(state.visited);
+	free(state.values);
+	free(state.lcps);
+	free(state.lcp_values);
+	return retval;
+}
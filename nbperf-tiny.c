@@ -0,0 +1,273 @@
+/*-
+ * Copyright (c) 2022 Reini Urban
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#if HAVE_NBTOOL_CONFIG_H
+#include "nbtool_config.h"
+#endif
+
+#include <ctype.h>
+#include <err.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nbperf.h"
+
+/*
+ * For small sets, e.g. keywords, the hash, the modulo and the g table
+ * reads cost more than comparing the key with a few candidates.  The
+ * tiny function is a comparison tree instead: a switch on the key
+ * length, then nested switches on the key byte which splits the keys of
+ * a node into the most groups, until at most two keys are left, which
+ * are compared with memcmp.  The result is the index of the key in the
+ * input, as with chm, and -1 for all other keys.
+ */
+
+/* a node of the tree: the keys idx[0 .. n-1] of one length */
+struct node {
+	uint32_t *idx;
+	size_t n;
+	size_t len;
+};
+
+static const struct nbperf *sorting_nbperf;
+
+static int
+sorting_cmp(const void *a_, const void *b_)
+{
+	const uint32_t *a = a_, *b = b_;
+	const size_t la = sorting_nbperf->keylens[*a];
+	const size_t lb = sorting_nbperf->keylens[*b];
+	int i;
+
+	if (la != lb)
+		return la < lb ? -1 : 1;
+	i = memcmp(sorting_nbperf->keys[*a], sorting_nbperf->keys[*b], la);
+	if (i != 0)
+		return i;
+	return *a < *b ? -1 : *a > *b;
+}
+
+static uint8_t
+key_byte(const struct nbperf *nbperf, uint32_t i, size_t pos)
+{
+	return ((const uint8_t *)nbperf->keys[i])[pos];
+}
+
+/* the position with the most distinct bytes of the keys, or -1 */
+static long
+best_position(const struct nbperf *nbperf, const struct node *node,
+    const uint8_t *used)
+{
+	uint8_t seen[256];
+	size_t pos, i, count, best_count = 1;
+	long best = -1;
+
+	for (pos = 0; pos < node->len; pos++) {
+		if (used[pos])
+			continue;
+		memset(seen, 0, sizeof(seen));
+		count = 0;
+		for (i = 0; i < node->n; i++) {
+			const uint8_t c = key_byte(nbperf, node->idx[i], pos);
+			count += !seen[c];
+			seen[c] = 1;
+		}
+		if (count > best_count) {
+			best_count = count;
+			best = (long)pos;
+		}
+	}
+	return best;
+}
+
+static void
+print_indent(FILE *out, unsigned depth)
+{
+	while (depth--)
+		fputc('\t', out);
+}
+
+static void
+print_byte(FILE *out, uint8_t c)
+{
+	if (isalnum(c) || c == '_')
+		fprintf(out, "'%c'", c);
+	else
+		fprintf(out, "0x%02x", c);
+}
+
+static void
+print_leaf(struct nbperf *nbperf, const struct node *node, unsigned depth,
+    const char *hashtype)
+{
+	FILE *out = nbperf->output;
+	size_t i;
+
+	for (i = 0; i < node->n; i++) {
+		const uint32_t k = node->idx[i];
+
+		if (node->len == 0) {
+			print_indent(out, depth);
+			fprintf(out, "return %" PRIu32 ";\n", k);
+			return;
+		}
+		print_indent(out, depth);
+		fprintf(out, "if (memcmp(key, ");
+		if (nbperf->embed_data)
+			fprintf(out, "%s_keys[%" PRIu32 "]", nbperf->hash_name,
+			    k);
+		else
+			key_print(out, nbperf->keys[k], node->len);
+		fprintf(out, ", %zu) == 0)\n", node->len);
+		print_indent(out, depth + 1);
+		fprintf(out, "return %" PRIu32 ";\n", k);
+	}
+	print_indent(out, depth);
+	fprintf(out, "return (%s)-1;\n", hashtype);
+}
+
+/* a switch on the best position, or the leaf with the keys of node */
+static void
+print_node(struct nbperf *nbperf, const struct node *node, uint8_t *used,
+    unsigned depth, const char *hashtype)
+{
+	FILE *out = nbperf->output;
+	struct node child;
+	unsigned b;
+	long pos;
+	size_t i;
+
+	pos = node->n > 2 ? best_position(nbperf, node, used) : -1;
+	if (pos < 0) {
+		print_leaf(nbperf, node, depth, hashtype);
+		return;
+	}
+	used[pos] = 1;
+	print_indent(out, depth);
+	fprintf(out, "switch (((const uint8_t *)key)[%ld]) {\n", pos);
+	child.idx = calloc(node->n, sizeof(*child.idx));
+	if (child.idx == NULL)
+		err(1, "malloc failed");
+	child.len = node->len;
+	/* a case for each byte at pos, in the order of the bytes */
+	for (b = 0; b < 256; b++) {
+		child.n = 0;
+		for (i = 0; i < node->n; i++)
+			if (key_byte(nbperf, node->idx[i], pos) == b)
+				child.idx[child.n++] = node->idx[i];
+		if (child.n == 0)
+			continue;
+		print_indent(out, depth);
+		fprintf(out, "case ");
+		print_byte(out, (uint8_t)b);
+		fprintf(out, ":\n");
+		print_node(nbperf, &child, used, depth + 1, hashtype);
+	}
+	free(child.idx);
+	print_indent(out, depth);
+	fprintf(out, "}\n");
+	print_indent(out, depth);
+	fprintf(out, "return (%s)-1;\n", hashtype);
+	used[pos] = 0;
+}
+
+int
+tiny_compute(struct nbperf *nbperf)
+{
+	/* uint64_t only for 2^32-1 keys and more, like bdz */
+	const char *hashtype = nbperf->n >= 4294967295U ? "uint64_t"
+	    : "uint32_t";
+	FILE *out;
+	struct node node;
+	uint32_t *idx;
+	uint8_t *used;
+	size_t i, j, maxlen = 0;
+
+	/* the keys sorted by length */
+	idx = calloc(nbperf->n + 1, sizeof(*idx));
+	if (idx == NULL)
+		err(1, "malloc failed");
+	for (i = 0; i < nbperf->n; i++) {
+		idx[i] = (uint32_t)i;
+		if (nbperf->keylens[i] > maxlen)
+			maxlen = nbperf->keylens[i];
+	}
+	sorting_nbperf = nbperf;
+	qsort(idx, nbperf->n, sizeof(*idx), sorting_cmp);
+	for (i = 1; i < nbperf->n; i++) {
+		if (nbperf->keylens[idx[i - 1]] == nbperf->keylens[idx[i]] &&
+		    memcmp(nbperf->keys[idx[i - 1]], nbperf->keys[idx[i]],
+			nbperf->keylens[idx[i]]) == 0) {
+			nbperf->has_duplicates = 1;
+			free(idx);
+			return -1;
+		}
+	}
+	used = calloc(maxlen + 1, 1);
+	if (used == NULL)
+		err(1, "malloc failed");
+
+	nbperf->hash_header = NULL;
+	print_coda(nbperf);
+	out = nbperf->output;
+	fprintf(out, "#include <stddef.h>\n"
+	    "#include <string.h>\n\n");
+	if (nbperf->embed_data) {
+		fprintf(out, "%sconst char * const %s_keys[%" PRIu64 "] = {\n",
+		    nbperf->static_hash ? "static " : "", nbperf->hash_name,
+		    (uint64_t)nbperf->n);
+		keys_print(nbperf);
+		fprintf(out, "};\n\n");
+	}
+	fprintf(out, "%s%s\n"
+	    "%s(const void * __restrict key, size_t keylen)\n"
+	    "{\n"
+	    "\tswitch (keylen) {\n",
+	    nbperf->static_hash ? "static " : "", hashtype, nbperf->hash_name);
+	for (i = 0; i < nbperf->n; i = j) {
+		node.idx = idx + i;
+		node.len = nbperf->keylens[idx[i]];
+		for (j = i + 1; j < nbperf->n; j++)
+			if (nbperf->keylens[idx[j]] != node.len)
+				break;
+		node.n = j - i;
+		fprintf(out, "\tcase %zu:\n", node.len);
+		print_node(nbperf, &node, used, 2, hashtype);
+	}
+	fprintf(out, "\t}\n"
+	    "\treturn (%s)-1;\n"
+	    "}\n", hashtype);
+
+	map_print(nbperf, NULL, nbperf->n);
+	free(used);
+	free(idx);
+	return 0;
+}
@@ -45,6 +45,8 @@ __RCSID("$NetBSD: nbperf.c,v 1.7 2021/01/12 14:21:18 joerg Exp $");
 #include <err.h>
 #include <errno.h>
 #include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -64,14 +66,15 @@ __RCSID("$NetBSD: nbperf.c,v 1.7 2021/01/12 14:21:18 joerg Exp $");
 #include "crc3.h"
 #endif
 #include "fnv16.h"
+#include "aeshash.h"
 
 static void
 usage(void)
 {
 	fprintf(stderr,
 	    "rurban/nbperf v%s\n"
-	    "nbperf [-dfIMps] [-c utilisation] [-i iterations] [-n name] "
-                "[-h hash] [-o output] [-m mapfile] input\n", VERSION);
+	    "nbperf [-bCdfgIKkLMPpRSs] [-B layout] [-H bits] [-c utilisation] [-e blobfile] [-F bits] [-i iterations] [-n name] "
+                "[-h hash] [-O size] [-r words] [-o output] [-m mapfile] input\n", VERSION);
 	exit(1);
 }
 
@@ -244,11 +247,67 @@ crc_print(struct nbperf *nbperf, const char *indent, const char *key,
 }
 #endif
 
+static void
+aeshash2_compute(struct nbperf *nbperf, const void *key, size_t keylen,
+    uint32_t *hashes)
+{
+	aeshash2(key, keylen, *(uint64_t *)nbperf->seed, hashes);
+}
+static void
+aeshash4_compute(struct nbperf *nbperf, const void *key, size_t keylen,
+    uint32_t *hashes)
+{
+	aeshash4(key, keylen, *(uint64_t *)nbperf->seed, hashes);
+}
+static void
+aeshash_print(struct nbperf *nbperf, const char *indent, const char *key,
+    const char *keylen, const char *hash)
+{
+	fprintf(nbperf->output,
+	    "%saeshash%s(%s, %s, UINT64_C(0x%" PRIx64 "), (uint32_t*)%s);\n",
+	    indent, nbperf->compute_hash == aeshash2_compute ? "2" : "4", key,
+	    keylen, *(uint64_t *)nbperf->seed, hash);
+}
+
+/*
+ * -L: the 64-bit keys are mixed with the splitmix64 finalizer, so that
+ * keys which differ only in the upper half still differ in all hashes.
+ */
+static uint64_t
+inthash64_mix(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return x ^ (x >> 31);
+}
+
+static uint64_t
+inthash64_seed(const struct nbperf *nbperf)
+{
+	return (uint64_t)nbperf->seed[1] << 32 | nbperf->seed[0];
+}
+
+static void
+inthash64_addprint(struct nbperf *nbperf)
+{
+	fprintf(nbperf->output,
+	    "\nstatic inline uint64_t _inthash64(uint64_t x)\n{\n"
+	    "\tx = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);\n"
+	    "\tx = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);\n"
+	    "\treturn x ^ (x >> 31);\n"
+	    "}\n");
+}
+
 void
 inthash_compute(struct nbperf *nbperf, const void *key, size_t keylen,
     uint32_t *hashes)
 {
 	(void)keylen;
+	if (nbperf->intkeys64) {
+		*(uint64_t *)hashes = inthash64_mix((uint64_t)(uintptr_t)key +
+		    inthash64_seed(nbperf));
+		return;
+	}
         /* mult factor from CityHash to reach into 2nd 32bit slot */
 	*(uint64_t *)hashes = ((int64_t)key *
 				  (UINT64_C(0x9DDFEA08EB382D69) +
@@ -260,6 +319,11 @@ inthash2_compute(struct nbperf *nbperf, const void *key, size_t keylen,
     uint32_t *hashes)
 {
 	(void)keylen;
+	if (nbperf->intkeys64) {
+		*hashes = (uint32_t)inthash64_mix((uint64_t)(uintptr_t)key +
+		    inthash64_seed(nbperf));
+		return;
+	}
 	*hashes = ((int32_t)(ptrdiff_t)key * (UINT32_C(0xEB382D69) + nbperf->seed[0])) +
 	    nbperf->seed[1];
 }
@@ -267,7 +331,19 @@ inthash2_compute(struct nbperf *nbperf, const void *key, size_t keylen,
 void
 inthash_addprint(struct nbperf *nbperf)
 {
-	if (!nbperf->hashes16) {
+	if (nbperf->intkeys64) {
+		inthash64_addprint(nbperf);
+		if (!nbperf->hashes16)
+			fprintf(nbperf->output,
+			    "\nstatic inline void _inthash(const uint64_t key, uint64_t *h)\n{\n"
+			    "\t*h = _inthash64(key + UINT64_C(0x%" PRIx64 "));\n",
+			    inthash64_seed(nbperf));
+		else
+			fprintf(nbperf->output,
+			    "\nstatic inline void _inthash2(const uint64_t key, uint32_t *h)\n{\n"
+			    "\t*h = (uint32_t)_inthash64(key + UINT64_C(0x%" PRIx64 "));\n",
+			    inthash64_seed(nbperf));
+	} else if (!nbperf->hashes16) {
 		fprintf(nbperf->output,
 		    "\nstatic inline void _inthash(const int32_t key, uint64_t *h)\n{\n");
 		fprintf(nbperf->output,
@@ -285,12 +361,24 @@ inthash_addprint(struct nbperf *nbperf)
 	fprintf(nbperf->output, "}\n\n");
 }
 
+/* -L: the second 64 bits from the key with another offset */
+#define INTHASH64_SEED2 UINT64_C(0x9E3779B97F4A7C15)
+
 void
 inthash4_compute(struct nbperf *nbperf, const void *key, size_t keylen,
     uint32_t *hashes)
 {
 	uint64_t *h64 = (uint64_t *)hashes;
 	(void)keylen;
+	if (nbperf->intkeys64) {
+		const uint64_t k = (uint64_t)(uintptr_t)key +
+		    inthash64_seed(nbperf);
+
+		h64[0] = inthash64_mix(k);
+		if (!nbperf->hashes16)
+			h64[1] = inthash64_mix(k + INTHASH64_SEED2);
+		return;
+	}
         /* mult factor from CityHash to reach into 2nd 32bit slot, but
            not the 3rd */
 	h64[0] = ((int64_t)key *
@@ -305,6 +393,22 @@ inthash4_compute(struct nbperf *nbperf, const void *key, size_t keylen,
 void
 inthash4_addprint(struct nbperf *nbperf)
 {
+	if (nbperf->intkeys64) {
+		const uint64_t seed = inthash64_seed(nbperf);
+
+		inthash64_addprint(nbperf);
+		fprintf(nbperf->output,
+		    "\nstatic inline void _inthash4(const uint64_t key, uint64_t *h)\n"
+		    "{\n"
+		    "\t*h = _inthash64(key + UINT64_C(0x%" PRIx64 "));\n",
+		    seed);
+		if (!nbperf->hashes16)
+			fprintf(nbperf->output,
+			    "\t*(h+1) = _inthash64(key + UINT64_C(0x%" PRIx64 "));\n",
+			    seed + INTHASH64_SEED2);
+		fprintf(nbperf->output, "}\n\n");
+		return;
+	}
 	fprintf(nbperf->output,
 	    "\nstatic inline void _inthash4(const int32_t key, uint64_t *h)\n");
 	fprintf(nbperf->output, "{\n");
@@ -340,6 +444,1519 @@ inthash4_print(struct nbperf *nbperf, const char *indent, const char *key,
 		    hash);
 }
 
+/* the value of the 8 decimal digits at p, or -1 if not all are digits */
+static int
+parse_digits8(const char *p, uint64_t *v)
+{
+	uint64_t x = 0;
+	int i;
+
+	for (i = 7; i >= 0; i--)
+		x = x << 8 | (uint8_t)p[i];
+	/* each byte 0x30 .. 0x39 */
+	if (((x & UINT64_C(0xF0F0F0F0F0F0F0F0)) |
+	    (((x + UINT64_C(0x0606060606060606)) &
+	      UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4)) !=
+	    UINT64_C(0x3333333333333333))
+		return -1;
+	/* the digits to 4 pairs, to 2 quads and to the value, in parallel */
+	x -= UINT64_C(0x3030303030303030);
+	x = x * 10 + (x >> 8);
+	x = ((x & UINT64_C(0x000000FF000000FF)) * UINT64_C(0x000F424000000064) +
+	    ((x >> 16) & UINT64_C(0x000000FF000000FF)) *
+	    UINT64_C(0x0000271000000001)) >> 32;
+	*v = x;
+	return 0;
+}
+
+static int
+hex_digit(int c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	c |= 0x20;
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	return -1;
+}
+
+/*
+ * An -I key, decimal or hex with 0x, of the line without the newline.
+ * Negative keys are stored as their two's complement.  Returns 0, -1 if
+ * it is not a number or -2 if it does not fit into 32 bit, resp. 64 bit
+ * with -L.
+ */
+static int
+parse_intkey(const char *p, size_t len, int wide, uint64_t *key)
+{
+	const char *end = p + len;
+	uint64_t v = 0, d;
+	int neg = 0, c;
+
+	if (end > p && end[-1] == '\r')
+		end--;
+	if (p < end && (*p == '-' || *p == '+'))
+		neg = *p++ == '-';
+	if (p == end)
+		return -1;
+	if (end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+		for (p += 2; p < end; p++) {
+			if ((c = hex_digit((uint8_t)*p)) < 0)
+				return -1;
+			if (v >> 60)
+				return -2;
+			v = v << 4 | (uint64_t)c;
+		}
+	} else {
+		for (; end - p >= 8 && parse_digits8(p, &d) == 0; p += 8) {
+			if (v > (UINT64_MAX - d) / 100000000)
+				return -2;
+			v = v * 100000000 + d;
+		}
+		for (; p < end; p++) {
+			if (*p < '0' || *p > '9')
+				return -1;
+			d = (uint64_t)(*p - '0');
+			if (v > (UINT64_MAX - d) / 10)
+				return -2;
+			v = v * 10 + d;
+		}
+	}
+	if (neg) {
+		if (v > (wide ? UINT64_C(1) << 63 : UINT64_C(1) << 31))
+			return -2;
+		v = -v;
+	} else if (!wide && v > UINT32_MAX)
+		return -2;
+	/* as the int32_t key of the generated function */
+	if (!wide)
+		v = (uint64_t)(int64_t)(int32_t)(uint32_t)v;
+	*key = v;
+	return 0;
+}
+
+/*
+ * -B: fixed-width keys, a byte array or a few integer fields, which are
+ * passed to the generated function as such.  They are hashed in chunks
+ * of up to 64 bit, a field each or 8 bytes of the array, without any
+ * length handling.  The keys are kept as their little-endian bytes.
+ */
+static const char *const field_types[] = {
+	NULL, "uint8_t", "uint16_t", NULL, "uint32_t",
+	NULL, NULL, NULL, "uint64_t"
+};
+
+/* the parameter of field i */
+static const char *
+fixed_field_name(const struct nbperf *nbperf, unsigned i)
+{
+	static const char *const names[NBPERF_MAX_FIELDS] = {
+		"a", "b", "c", "d", "e", "f", "g", "h"
+	};
+
+	if (nbperf->prehashed)
+		return i ? "h_hi" : "h_lo";
+	return names[i];
+}
+
+/*
+ * -H: the keys are hashes of 64 or 128 bit, computed by the caller, as
+ * the fields h_lo and h_hi.  They are only mixed with the seed, once.
+ */
+static void
+prehashed_parse_bits(struct nbperf *nbperf, const char *arg)
+{
+	if (strcmp(arg, "64") == 0)
+		nbperf->nfields = 1;
+	else if (strcmp(arg, "128") == 0)
+		nbperf->nfields = 2;
+	else
+		errx(1, "Invalid argument for -H, only 64 or 128");
+	nbperf->field_size[0] = nbperf->field_size[1] = 8;
+	nbperf->fixed = 8 * nbperf->nfields;
+	nbperf->prehashed = 1;
+}
+
+/*
+ * A -H key of a line: the hash as one hex number of up to 16 or 32
+ * digits, optionally with 0x, the low 64 bits last.
+ */
+static int
+prehashed_parse(const struct nbperf *nbperf, const char *p, size_t len,
+    uint8_t *key)
+{
+	const char *end = p + len;
+	uint64_t lo = 0, hi = 0;
+	unsigned i;
+	int d;
+
+	if (end > p && end[-1] == '\r')
+		end--;
+	if (end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+		p += 2;
+	if (p == end)
+		return -1;
+	if (end - p > 2 * (ptrdiff_t)nbperf->fixed)
+		return -2;
+	for (; p < end; p++) {
+		if ((d = hex_digit((uint8_t)*p)) < 0)
+			return -1;
+		hi = hi << 4 | lo >> 60;
+		lo = lo << 4 | (uint64_t)d;
+	}
+	for (i = 0; i < 8; i++) {
+		key[i] = (uint8_t)(lo >> (8 * i));
+		if (nbperf->nfields == 2)
+			key[8 + i] = (uint8_t)(hi >> (8 * i));
+	}
+	return 0;
+}
+
+static void
+fixed_parse_layout(struct nbperf *nbperf, const char *arg)
+{
+	const char *p = arg;
+	char *eos;
+	long tmp;
+
+	if (*arg >= '0' && *arg <= '9') {
+		errno = 0;
+		tmp = strtol(arg, &eos, 10);
+		if (errno || eos[0] || tmp < 1 || tmp > 1024)
+			errx(1, "-B %s: the key bytes must be 1 .. 1024", arg);
+		nbperf->fixed = (unsigned)tmp;
+		nbperf->nfields = 0;
+		return;
+	}
+	nbperf->fixed = 0;
+	for (nbperf->nfields = 0; *p; nbperf->nfields++) {
+		if (nbperf->nfields == NBPERF_MAX_FIELDS)
+			errx(1, "-B %s: at most %d fields", arg,
+			    NBPERF_MAX_FIELDS);
+		if (*p++ != 'u')
+			errx(1, "-B %s: the fields must be u8, u16, u32 "
+			    "or u64", arg);
+		tmp = strtol(p, &eos, 10);
+		if (eos == p || (tmp != 8 && tmp != 16 && tmp != 32 &&
+		    tmp != 64) || (*eos && *eos != ','))
+			errx(1, "-B %s: the fields must be u8, u16, u32 "
+			    "or u64", arg);
+		nbperf->field_size[nbperf->nfields] = (uint8_t)(tmp / 8);
+		nbperf->fixed += (unsigned)tmp / 8;
+		p = *eos ? eos + 1 : eos;
+	}
+}
+
+/* the little-endian value of the n bytes at p */
+static uint64_t
+fixed_le(const uint8_t *p, unsigned n)
+{
+	uint64_t v = 0;
+
+	while (n--)
+		v = v << 8 | p[n];
+	return v;
+}
+
+/*
+ * A -B key of a line: the hex digits of the bytes, optionally with -
+ * or :, or the fields as -I keys, separated by blanks or commas.
+ * Returns 0, -1 if it is malformed or -2 if a field is out of range.
+ */
+static int
+fixed_parse(const struct nbperf *nbperf, const char *p, size_t len,
+    uint8_t *key)
+{
+	const char *end = p + len;
+	unsigned i, j, size;
+	int hi, lo;
+	uint64_t v;
+
+	if (end > p && end[-1] == '\r')
+		end--;
+	if (!nbperf->nfields) {
+		if (end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+			p += 2;
+		for (i = 0; p < end; i++) {
+			while (p < end && (*p == '-' || *p == ':'))
+				p++;
+			if (end - p < 2 || i == nbperf->fixed)
+				return -1;
+			hi = hex_digit((uint8_t)p[0]);
+			lo = hex_digit((uint8_t)p[1]);
+			if (hi < 0 || lo < 0)
+				return -1;
+			key[i] = (uint8_t)(hi << 4 | lo);
+			p += 2;
+		}
+		return i == nbperf->fixed ? 0 : -1;
+	}
+	for (i = j = 0; i < nbperf->nfields; i++) {
+		const char *tok;
+		int rv;
+
+		while (p < end && (*p == ' ' || *p == '\t' || *p == ','))
+			p++;
+		for (tok = p; p < end && *p != ' ' && *p != '\t' && *p != ',';)
+			p++;
+		if (tok == p)
+			return -1;
+		if ((rv = parse_intkey(tok, (size_t)(p - tok), 1, &v)) != 0)
+			return rv;
+		/* the unsigned or the signed values of the field */
+		size = nbperf->field_size[i];
+		if (size < 8 && v >> (8 * size) &&
+		    ~v >> (8 * size - 1) != 0)
+			return -2;
+		for (; size--; v >>= 8)
+			key[j++] = (uint8_t)v;
+	}
+	while (p < end && (*p == ' ' || *p == '\t'))
+		p++;
+	return p == end ? 0 : -1;
+}
+
+static void
+fixed_compute(struct nbperf *nbperf, const void *key, size_t keylen,
+    uint32_t *hashes)
+{
+	const uint8_t *p = key;
+	uint64_t *h64 = (uint64_t *)hashes;
+	uint64_t x = inthash64_seed(nbperf);
+	unsigned i, o, n;
+
+	(void)keylen;
+	if (nbperf->prehashed) {
+		/* a single mix of the hash with the seed */
+		x = inthash64_mix((fixed_le(p, 8) ^ x) +
+		    (nbperf->nfields == 2 ? fixed_le(p + 8, 8) : 0));
+	} else {
+		/* a chunk per field, or per 8 bytes */
+		for (i = o = 0; o < nbperf->fixed; i++, o += n) {
+			n = nbperf->nfields ? nbperf->field_size[i] :
+			    nbperf->fixed - o < 8 ? nbperf->fixed - o : 8;
+			x = inthash64_mix(x ^ fixed_le(p + o, n));
+		}
+	}
+	h64[0] = x;
+	if (nbperf->hash_size == 4 && !nbperf->hashes16)
+		h64[1] = inthash64_mix(x + INTHASH64_SEED2);
+}
+
+/* the parameters of the generated function, a, b, ... or key */
+static void
+fixed_params_print(struct nbperf *nbperf)
+{
+	unsigned i;
+
+	if (!nbperf->nfields) {
+		fprintf(nbperf->output, "const uint8_t key[%u]", nbperf->fixed);
+		return;
+	}
+	for (i = 0; i < nbperf->nfields; i++)
+		fprintf(nbperf->output, "%sconst %s %s", i ? ", " : "",
+		    field_types[nbperf->field_size[i]],
+		    fixed_field_name(nbperf, i));
+}
+
+void
+fixed_signature_print(struct nbperf *nbperf)
+{
+	fprintf(nbperf->output, "%s(", nbperf->hash_name);
+	fixed_params_print(nbperf);
+	fprintf(nbperf->output, ")\n");
+}
+
+static void
+fixed_addprint(struct nbperf *nbperf)
+{
+	FILE *out = nbperf->output;
+	unsigned i, o, n;
+
+	inthash64_addprint(nbperf);
+	/* with a constant n a single load on little-endian CPUs */
+	if (!nbperf->nfields || nbperf->embed_data)
+		fprintf(out,
+		    "\n#include <string.h>\n\n"
+		    "static inline uint64_t\n"
+		    "_fixed_le(const uint8_t *p, unsigned n)\n"
+		    "{\n"
+		    "\tuint64_t v = 0;\n\n"
+		    "#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__\n"
+		    "\tmemcpy(&v, p, n);\n"
+		    "#else\n"
+		    "\twhile (n--)\n"
+		    "\t\tv = v << 8 | p[n];\n"
+		    "#endif\n"
+		    "\treturn v;\n"
+		    "}\n");
+	fprintf(out, "\nstatic inline void\n_fixedhash(");
+	fixed_params_print(nbperf);
+	fprintf(out, ", uint64_t *h)\n"
+	    "{\n"
+	    "\tuint64_t x = UINT64_C(0x%" PRIx64 ");\n\n",
+	    inthash64_seed(nbperf));
+	if (nbperf->prehashed)
+		fprintf(out, "\tx = _inthash64(%s);\n",
+		    nbperf->nfields == 2 ? "(h_lo ^ x) + h_hi" : "h_lo ^ x");
+	else if (nbperf->nfields)
+		for (i = 0; i < nbperf->nfields; i++)
+			fprintf(out, "\tx = _inthash64(x ^ %s);\n",
+			    fixed_field_name(nbperf, i));
+	else
+		for (o = 0; o < nbperf->fixed; o += n) {
+			n = nbperf->fixed - o < 8 ? nbperf->fixed - o : 8;
+			fprintf(out, "\tx = _inthash64(x ^ _fixed_le(key + %u, %u));\n",
+			    o, n);
+		}
+	fprintf(out, "\th[0] = x;\n");
+	if (nbperf->hash_size == 4 && !nbperf->hashes16)
+		fprintf(out, "\th[1] = _inthash64(x + UINT64_C(0x%" PRIx64 "));\n",
+		    inthash64_seed(nbperf) + INTHASH64_SEED2);
+	fprintf(out, "}\n\n");
+}
+
+static void
+fixed_print(struct nbperf *nbperf, const char *indent, const char *key,
+    const char *keylen, const char *hash)
+{
+	unsigned i;
+
+	(void)keylen;
+	fprintf(nbperf->output, "%s_fixedhash(", indent);
+	if (!nbperf->nfields)
+		fprintf(nbperf->output, "%s", key);
+	for (i = 0; i < nbperf->nfields; i++)
+		fprintf(nbperf->output, "%s, ", fixed_field_name(nbperf, i));
+	fprintf(nbperf->output, "%s(uint64_t*)%s);\n",
+	    nbperf->nfields ? "" : ", ", hash);
+}
+
+/* -B -d: the keys as the bytes of each */
+static char *
+fixed_key_entry(char *p, size_t i, const void *ctx)
+{
+	const struct nbperf *nbperf = ctx;
+	const uint8_t *key = (const uint8_t *)nbperf->keys[i];
+	unsigned j;
+
+	p = fmt_str(p, "\t{ ");
+	for (j = 0; j < nbperf->fixed; j++) {
+		p = fmt_str(p, j ? ", 0x" : "0x");
+		p = fmt_hex(p, key[j], 2);
+	}
+	return fmt_str(p, " },\n");
+}
+
+void
+fixed_embed_print(struct nbperf *nbperf)
+{
+	fprintf(nbperf->output, "%sconst uint8_t %s_keys[%zu][%u] = {\n",
+	    nbperf->static_hash ? "static " : "", nbperf->hash_name,
+	    nbperf->n, nbperf->fixed);
+	table_print(nbperf->output, nbperf->n, 6 * nbperf->fixed + 16,
+	    fixed_key_entry, nbperf);
+	fprintf(nbperf->output, "};\n\n");
+}
+
+/* -B -d: the condition that the key is NAME_keys[result] */
+void
+fixed_cmp_print(struct nbperf *nbperf, const char *result)
+{
+	unsigned i, o;
+
+	if (!nbperf->nfields) {
+		fprintf(nbperf->output, "memcmp(%s_keys[%s], key, %u) == 0",
+		    nbperf->hash_name, result, nbperf->fixed);
+		return;
+	}
+	for (i = o = 0; i < nbperf->nfields; o += nbperf->field_size[i++])
+		fprintf(nbperf->output, "%s_fixed_le(%s_keys[%s] + %u, %u) == %s",
+		    i ? " &&\n\t    " : "", nbperf->hash_name, result, o,
+		    nbperf->field_size[i], fixed_field_name(nbperf, i));
+}
+
+/*
+ * -S: the key lengths of the set.  lenmap has bit i set if there is a key
+ * of length i < 64.
+ */
+static void
+shape_analyse(struct nbperf *nbperf)
+{
+	size_t i, len;
+
+	nbperf->minlen = SIZE_MAX;
+	nbperf->maxlen = 0;
+	nbperf->lenmap = 0;
+	for (i = 0; i < nbperf->n; i++) {
+		len = nbperf->keylens[i];
+		if (len < nbperf->minlen)
+			nbperf->minlen = len;
+		if (len > nbperf->maxlen)
+			nbperf->maxlen = len;
+		if (len < 64)
+			nbperf->lenmap |= UINT64_C(1) << len;
+	}
+}
+
+/* the lowest and highest key length in lo .. hi < 64, or 0 if none */
+static int
+shape_class(const struct nbperf *nbperf, unsigned lo, unsigned hi,
+    unsigned *first, unsigned *last)
+{
+	const uint64_t m = nbperf->lenmap & ((UINT64_C(2) << hi) - 1) &
+	    ~((UINT64_C(1) << lo) - 1);
+
+	if (m == 0)
+		return 0;
+	*first = (unsigned)__builtin_ctzll(m);
+	*last = 63 - (unsigned)__builtin_clzll(m);
+	return 1;
+}
+
+/* the condition for the key lengths first .. last */
+static void
+shape_cond_print(struct nbperf *nbperf, const char *indent, const char *el,
+    unsigned first, unsigned last)
+{
+	if (first == last)
+		fprintf(nbperf->output, "%s%sif (len == %u) {\n", indent, el,
+		    first);
+	else if (first == 0)
+		fprintf(nbperf->output, "%s%sif (len <= %u) {\n", indent, el,
+		    last);
+	else
+		fprintf(nbperf->output, "%s%sif (len - %u <= %u) {\n", indent,
+		    el, first, last - first);
+}
+
+/*
+ * -S with wyhash: _wyhash_shape() computes mi_wyhash2 or mi_wyhash4 as
+ * wyhash_compute, but has only the branches of wyhash for the key lengths
+ * up to 16 of the set.  With all keys of 4 to 7 or of 8 to 15 bytes the
+ * load offsets are constant, with one length all of them.  Other lengths
+ * call the generic function, so the function is defined for all keys.
+ */
+static void
+shape_addprint(struct nbperf *nbperf)
+{
+	FILE *out = nbperf->output;
+	const uint64_t seed = *(uint64_t *)nbperf->seed;
+	const int h4 = nbperf->compute_hash == wyhash4_compute;
+	const char *el = "";
+	unsigned first, last;
+
+	fprintf(out, "/* keys of %zu to %zu bytes */\n"
+	    "static inline void\n"
+	    "_wyhash_shape(const void *key, size_t len, %s *h)\n"
+	    "{\n"
+	    "\tconst uint8_t *p = (const uint8_t *)key;\n"
+	    "\tconst uint64_t seed = UINT64_C(0x%" PRIx64 ") ^ _wyp[0];\n"
+	    "\tuint64_t a, b;\n\n",
+	    nbperf->minlen, nbperf->maxlen, h4 ? "uint64_t" : "uint32_t",
+	    seed);
+	if (shape_class(nbperf, 4, 16, &first, &last)) {
+		shape_cond_print(nbperf, "\t", el, first, last);
+		if (first == last)
+			fprintf(out,
+			    "\t\ta = _wyr4(p) << 32 | _wyr4(p + %u);\n"
+			    "\t\tb = _wyr4(p + %u) << 32 | _wyr4(p + %u);\n",
+			    (first >> 3) << 2, first - 4,
+			    first - 4 - ((first >> 3) << 2));
+		else if (last < 8)
+			fprintf(out,
+			    "\t\ta = _wyr4(p) << 32 | _wyr4(p);\n"
+			    "\t\tb = _wyr4(p + len - 4) << 32 | _wyr4(p + len - 4);\n");
+		else if (first >= 8 && last < 16)
+			fprintf(out,
+			    "\t\ta = _wyr4(p) << 32 | _wyr4(p + 4);\n"
+			    "\t\tb = _wyr4(p + len - 4) << 32 | _wyr4(p + len - 8);\n");
+		else
+			fprintf(out,
+			    "\t\tconst size_t o = (len >> 3) << 2;\n\n"
+			    "\t\ta = _wyr4(p) << 32 | _wyr4(p + o);\n"
+			    "\t\tb = _wyr4(p + len - 4) << 32 | _wyr4(p + len - 4 - o);\n");
+		el = "} else ";
+	}
+	if (shape_class(nbperf, 1, 3, &first, &last)) {
+		shape_cond_print(nbperf, "\t", el, first, last);
+		if (first == last)
+			fprintf(out, "\t\ta = _wyr3(p, %u);\n", first);
+		else
+			fprintf(out, "\t\ta = _wyr3(p, len);\n");
+		fprintf(out, "\t\tb = 0;\n");
+		el = "} else ";
+	}
+	if (nbperf->lenmap & 1) {
+		shape_cond_print(nbperf, "\t", el, 0, 0);
+		fprintf(out, "\t\ta = b = 0;\n");
+		el = "} else ";
+	}
+	fprintf(out, "\t%s{\n", el);
+	if (h4)
+		fprintf(out, "\t\tmi_wyhash4(key, len, UINT64_C(0x%" PRIx64
+		    "), h);\n", seed);
+	else
+		fprintf(out, "\t\tmi_wyhash2(key, len, UINT64_C(0x%" PRIx64
+		    "), h);\n", seed);
+	fprintf(out, "\t\treturn;\n"
+	    "\t}\n");
+	if (h4)
+		fprintf(out,
+		    "\th[0] = _wymix(_wyp[1] ^ len, _wymix(a ^ _wyp[1], b ^ seed));\n"
+		    "\th[1] = _wymix(b ^ _wyp[1], a ^ seed);\n");
+	else
+		fprintf(out,
+		    "\ta = _wymix(_wyp[1] ^ len, _wymix(a ^ _wyp[1], b ^ seed));\n"
+		    "\th[0] = (uint32_t)a;\n"
+		    "\th[1] = (uint32_t)(a >> 32);\n");
+	fprintf(out, "}\n\n");
+}
+
+static void
+shape_print(struct nbperf *nbperf, const char *indent, const char *key,
+    const char *keylen, const char *hash)
+{
+	fprintf(nbperf->output, "%s_wyhash_shape(%s, %s, (%s *)%s);\n",
+	    indent, key, keylen,
+	    nbperf->compute_hash == wyhash4_compute ? "uint64_t" : "uint32_t",
+	    hash);
+}
+
+/*
+ * -S -d: return early for a key length of no key, before hashing.  With
+ * gaps in the lengths below 64 this tests the bit in lenmap.
+ */
+void
+shape_reject_print(struct nbperf *nbperf, const char *indent,
+    const char *hashtype)
+{
+	const size_t min = nbperf->minlen, max = nbperf->maxlen;
+	const uint64_t range = max < 64 ? ((UINT64_C(2) << max) - 1) &
+	    ~((UINT64_C(1) << min) - 1) : 0;
+
+	if (!nbperf->shape || !nbperf->embed_data || nbperf->intkeys)
+		return;
+	if (max < 64 && nbperf->lenmap != range)
+		fprintf(nbperf->output,
+		    "%sif (keylen > %zu || !((UINT64_C(0x%" PRIx64
+		    ") >> keylen) & 1))\n", indent, max, nbperf->lenmap);
+	else if (min == max)
+		fprintf(nbperf->output, "%sif (keylen != %zu)\n", indent, max);
+	else if (min == 0)
+		fprintf(nbperf->output, "%sif (keylen > %zu)\n", indent, max);
+	else
+		fprintf(nbperf->output, "%sif (keylen - %zu > %zu)\n", indent,
+		    min, max - min);
+	fprintf(nbperf->output, "%s\treturn (%s)-1;\n", indent, hashtype);
+}
+
+/*
+ * -K: as gperf, hash only the key bytes at some positions, and the length.
+ * Position i >= 0 is byte i of the key, i < 0 byte keylen + i, and a key
+ * too short for it has a 0 there.  The bytes of the positions and the
+ * length, 1 byte below 256 or else 4, form the key which is hashed.
+ */
+static uint8_t
+keypos_byte(const uint8_t *key, size_t keylen, int pos)
+{
+	if (pos >= 0)
+		return (size_t)pos < keylen ? key[pos] : 0;
+	return (size_t)-pos <= keylen ? key[keylen + pos] : 0;
+}
+
+static void
+keypos_gather(const struct nbperf *nbperf, const uint8_t *key, size_t keylen,
+    uint8_t *kp)
+{
+	unsigned i;
+
+	for (i = 0; i < nbperf->npositions; i++)
+		kp[i] = keypos_byte(key, keylen, nbperf->positions[i]);
+	for (; i < nbperf->keypos_len; i++, keylen >>= 8)
+		kp[i] = (uint8_t)keylen;
+}
+
+/*
+ * Split the classes cls[] of the keys by their byte at pos, or by the
+ * length with pos INT_MIN, into the new dense classes out[] if not NULL.
+ * Returns the number of new classes.
+ */
+static uint32_t
+keypos_split(const struct nbperf *nbperf, const uint32_t *cls, int pos,
+    uint32_t *out, uint64_t *tab, uint32_t *ids, unsigned bits)
+{
+	const size_t mask = ((size_t)1 << bits) - 1;
+	uint32_t count = 0;
+	uint64_t k;
+	size_t i, j;
+
+	memset(tab, 0xff, (mask + 1) * sizeof(*tab));
+	for (i = 0; i < nbperf->n; i++) {
+		k = (uint64_t)cls[i] << 32 | (pos == INT_MIN ?
+		    (uint32_t)nbperf->keylens[i] : keypos_byte((const uint8_t *)
+		    nbperf->keys[i], nbperf->keylens[i], pos));
+		for (j = (k * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - bits);
+		    tab[j] != k && tab[j] != UINT64_MAX; j = (j + 1) & mask)
+			;
+		if (tab[j] == UINT64_MAX) {
+			tab[j] = k;
+			ids[j] = count++;
+		}
+		if (out != NULL)
+			out[i] = ids[j];
+	}
+	return count;
+}
+
+/*
+ * Add the position which splits the keys into the most classes, until
+ * all keys are apart.  The candidates are the first and the last 255
+ * bytes.
+ */
+static void
+keypos_select(struct nbperf *nbperf)
+{
+	const int maxpos = nbperf->maxlen < 255 ? (int)nbperf->maxlen : 255;
+	uint32_t *cls, *ids, count, best_count, c;
+	uint64_t *tab;
+	unsigned bits = 1, i, size;
+	int d, pos, best;
+	const char **hash_keys;
+	size_t k, *hash_keylens;
+	uint8_t *kp;
+
+	while (((size_t)1 << bits) < 2 * nbperf->n)
+		bits++;
+	cls = calloc(nbperf->n, sizeof(*cls));
+	tab = calloc((size_t)1 << bits, sizeof(*tab));
+	ids = calloc((size_t)1 << bits, sizeof(*ids));
+	if (cls == NULL || tab == NULL || ids == NULL)
+		err(1, "malloc failed");
+
+	count = keypos_split(nbperf, cls, INT_MIN, cls, tab, ids, bits);
+	nbperf->npositions = 0;
+	while (count < nbperf->n) {
+		best_count = count;
+		best = 0;
+		/* 0, -1, 1, -2, ... prefers the positions near the ends */
+		for (d = 0; d < 2 * maxpos; d++) {
+			pos = d & 1 ? -(d + 1) / 2 : d / 2;
+			for (i = 0; i < nbperf->npositions; i++)
+				if (nbperf->positions[i] == pos)
+					break;
+			if (i < nbperf->npositions)
+				continue;
+			c = keypos_split(nbperf, cls, pos, NULL, tab, ids, bits);
+			if (c > best_count) {
+				best_count = c;
+				best = pos;
+			}
+		}
+		if (best_count == count)
+			errx(1, "Duplicate keys detected");
+		if (nbperf->npositions == NBPERF_MAX_KEYPOS)
+			errx(1, "-K needs more than %d key positions",
+			    NBPERF_MAX_KEYPOS);
+		nbperf->positions[nbperf->npositions++] = best;
+		count = keypos_split(nbperf, cls, best, cls, tab, ids, bits);
+	}
+	free(cls);
+	free(tab);
+	free(ids);
+
+	nbperf->keypos_len = nbperf->npositions +
+	    (nbperf->maxlen < 256 ? 1 : 4);
+	/* padded for mi_vector_hash */
+	size = (nbperf->keypos_len + 3) & ~3U;
+	hash_keys = calloc(nbperf->n, sizeof(*hash_keys));
+	hash_keylens = calloc(nbperf->n, sizeof(*hash_keylens));
+	kp = calloc(nbperf->n, size);
+	if (hash_keys == NULL || hash_keylens == NULL || kp == NULL)
+		err(1, "malloc failed");
+	for (k = 0; k < nbperf->n; k++) {
+		keypos_gather(nbperf, (const uint8_t *)nbperf->keys[k],
+		    nbperf->keylens[k], kp + k * size);
+		hash_keys[k] = (const char *)(kp + k * size);
+		hash_keylens[k] = nbperf->keypos_len;
+	}
+	nbperf->hash_keys = hash_keys;
+	nbperf->hash_keylens = hash_keylens;
+}
+
+/* keypos_gather, the bytes of the key in kp[] */
+static void
+keypos_addprint(struct nbperf *nbperf)
+{
+	FILE *out = nbperf->output;
+	unsigned i, pad = (nbperf->keypos_len + 3) & ~3U;
+	int pos;
+
+	fprintf(out, "static inline void\n"
+	    "%s_keypos(const void *key, size_t keylen, uint8_t *kp)\n"
+	    "{\n"
+	    "\tconst uint8_t *p = (const uint8_t *)key;\n\n",
+	    nbperf->hash_name);
+	for (i = 0; i < nbperf->npositions; i++) {
+		pos = nbperf->positions[i];
+		if (pos >= 0)
+			fprintf(out, "\tkp[%u] = keylen > %d ? p[%d] : 0;\n",
+			    i, pos, pos);
+		else
+			fprintf(out,
+			    "\tkp[%u] = keylen >= %d ? p[keylen - %d] : 0;\n",
+			    i, -pos, -pos);
+	}
+	if (nbperf->maxlen < 256)
+		fprintf(out, "\tkp[%u] = (uint8_t)keylen;\n", i++);
+	else
+		for (; i < nbperf->keypos_len; i++)
+			fprintf(out, "\tkp[%u] = (uint8_t)(keylen >> %u);\n", i,
+			    8 * (i - nbperf->npositions));
+	for (; i < pad; i++)
+		fprintf(out, "\tkp[%u] = 0;\n", i);
+	fprintf(out, "}\n\n");
+}
+
+static void
+keypos_print(struct nbperf *nbperf, const char *indent, const char *key,
+    const char *keylen, const char *hash)
+{
+	char len[16];
+
+	fprintf(nbperf->output, "%suint8_t kp[%u];\n"
+	    "%s%s_keypos(%s, %s, kp);\n",
+	    indent, (nbperf->keypos_len + 3) & ~3U,
+	    indent, nbperf->hash_name, key, keylen);
+	snprintf(len, sizeof(len), "%u", nbperf->keypos_len);
+	(*nbperf->keypos_print_hash)(nbperf, indent, "kp", len, hash);
+}
+
+/*
+ * With -C the hash is one of the constexpr functions of nbperf_constexpr.h,
+ * which return the words of the C hash.  h is a std::array of the 16 or
+ * 32bit hash words, as the uint16_t or uint32_t h[] of the C output.
+ */
+void
+constexpr_hash_print(struct nbperf *nbperf, const char *indent,
+    const char *key, const char *keylen)
+{
+	const uint64_t seed = *(uint64_t *)nbperf->seed;
+	void (*compute)(struct nbperf *, const void *, size_t, uint32_t *) =
+	    nbperf->compute_hash;
+	FILE *out = nbperf->output;
+
+	fprintf(out, "%sauto h = %snbperf::", indent,
+	    nbperf->hashes16 ? "nbperf::split16(" : "");
+	if (compute == mi_vector_hash_compute)
+		fprintf(out, "mi_vector_hash(%s, %s, UINT32_C(0x%08" PRIx32 "))",
+		    key, keylen, nbperf->seed[0]);
+	else if (compute == wyhash2_compute || compute == wyhash4_compute ||
+	    compute == fnv_compute || compute == fnv3_compute)
+		fprintf(out, "%s(%s, %s, UINT64_C(0x%" PRIx64 "))",
+		    compute == wyhash2_compute ? "wyhash2" :
+		    compute == wyhash4_compute ? "wyhash4" :
+		    compute == fnv_compute ? "fnv" : "fnv3",
+		    key, keylen, seed);
+	else if (compute == fnv32_compute)
+		fprintf(out, "fnv32_2(%s, %s, 0x%" PRIx32 ", 0x%" PRIx32 ")",
+		    key, keylen, nbperf->seed[0], nbperf->seed[1]);
+	else if (compute == fnv16_compute)
+		fprintf(out, "fnv16_2(%s, %s, 0x%" PRIx32 ", 0x%" PRIx32 ")",
+		    key, keylen, nbperf->seed[0] & 0xffff, nbperf->seed[0] >> 16);
+	else if (compute == inthash_compute || compute == inthash2_compute ||
+	    compute == inthash4_compute)
+		fprintf(out, "%s(%s, UINT32_C(%" PRIu32 "), UINT32_C(%" PRIu32 "))",
+		    compute == inthash_compute ? "inthash" :
+		    compute == inthash2_compute ? "inthash2" : "inthash4",
+		    key, nbperf->seed[0], nbperf->seed[1]);
+	else
+		errx(1, "-C is not supported with this hash function");
+	fprintf(out, "%s;\n", nbperf->hashes16 ? ")" : "");
+}
+
+/* A C string literal of the key, with the special characters escaped. */
+void
+key_print(FILE *out, const char *key, size_t keylen)
+{
+	const unsigned char *k = (const unsigned char *)key;
+	size_t j;
+
+	fputc('"', out);
+	for (j = 0; j < keylen; j++) {
+		if (k[j] < 0x20 || k[j] >= 0x7f || k[j] == '"' ||
+		    k[j] == '\\' || k[j] == '?')
+			fprintf(out, "\\%03o", k[j]);
+		else
+			fputc(k[j], out);
+	}
+	fputc('"', out);
+}
+
+/*
+ * The tables are formatted into big buffers instead of with one fprintf
+ * per entry.  A table_entry_fn formats entry i of a table, including its
+ * separators, and must only depend on i.  So big tables are split into
+ * chunks, which are formatted in parallel by worker threads and written
+ * in order.  The buffers grow with what a chunk actually holds, so one
+ * long entry does not make every entry cost max bytes.
+ */
+#define TABLE_CHUNK	65536	/* entries per chunk */
+#define TABLE_THREADS	8
+
+struct table_job {
+	table_entry_fn entry;
+	const void *ctx;
+	size_t from, to, max;
+	char *buf, *end;
+	size_t size;
+};
+
+static void *
+table_format(void *arg)
+{
+	struct table_job *job = arg;
+	size_t i, used = 0;
+
+	for (i = job->from; i < job->to; i++) {
+		if (job->size - used < job->max) {
+			job->size = 2 * job->size + job->max;
+			job->buf = realloc(job->buf, job->size);
+			if (job->buf == NULL)
+				err(1, "realloc failed");
+		}
+		used = (*job->entry)(job->buf + used, i, job->ctx) - job->buf;
+	}
+	job->end = job->buf + used;
+	return NULL;
+}
+
+/* Write the n entries of a table, each at most max bytes long. */
+void
+table_print(FILE *out, size_t n, size_t max, table_entry_fn entry,
+    const void *ctx)
+{
+	static long ncpu;
+	struct table_job jobs[TABLE_THREADS];
+	pthread_t tid[TABLE_THREADS];
+	int started[TABLE_THREADS];
+	size_t nthreads, from, t, j;
+
+	if (ncpu == 0) {
+		ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+		if (ncpu < 1)
+			ncpu = 1;
+		if (ncpu > TABLE_THREADS)
+			ncpu = TABLE_THREADS;
+	}
+	nthreads = (n + TABLE_CHUNK - 1) / TABLE_CHUNK;
+	if (nthreads > (size_t)ncpu)
+		nthreads = ncpu;
+	for (t = 0; t < nthreads; t++) {
+		jobs[t].entry = entry;
+		jobs[t].ctx = ctx;
+		jobs[t].max = max;
+		jobs[t].buf = NULL;
+		jobs[t].size = 0;
+	}
+	for (from = 0; from < n;) {
+		for (t = 0; t < nthreads && from < n; t++) {
+			jobs[t].from = from;
+			from = n - from > TABLE_CHUNK ? from + TABLE_CHUNK : n;
+			jobs[t].to = from;
+			/* on failure formatted below, in this thread */
+			started[t] = t > 0 &&
+			    pthread_create(&tid[t], NULL, table_format,
+				&jobs[t]) == 0;
+		}
+		for (j = 0; j < t; j++)
+			if (!started[j])
+				table_format(&jobs[j]);
+		for (j = 0; j < t; j++) {
+			if (started[j])
+				pthread_join(tid[j], NULL);
+			fwrite(jobs[j].buf, 1, jobs[j].end - jobs[j].buf, out);
+		}
+	}
+	for (t = 0; t < nthreads; t++)
+		free(jobs[t].buf);
+}
+
+/* v right-aligned in width characters, as "%*" PRIu64 */
+char *
+fmt_dec(char *p, uint64_t v, int width)
+{
+	char tmp[20];
+	int len = 0;
+
+	do
+		tmp[len++] = '0' + v % 10;
+	while (v /= 10);
+	for (; width > len; width--)
+		*p++ = ' ';
+	while (len > 0)
+		*p++ = tmp[--len];
+	return p;
+}
+
+/* v with at least width digits, as "%0*" PRIx64 */
+char *
+fmt_hex(char *p, uint64_t v, int width)
+{
+	char tmp[16];
+	int len = 0;
+
+	do
+		tmp[len++] = "0123456789abcdef"[v & 15];
+	while (v >>= 4);
+	for (; width > len; width--)
+		*p++ = '0';
+	while (len > 0)
+		*p++ = tmp[--len];
+	return p;
+}
+
+char *
+fmt_str(char *p, const char *s)
+{
+	while (*s)
+		*p++ = *s++;
+	return p;
+}
+
+/* the -d string keys, 4 per line */
+static char *
+key_entry(char *p, size_t i, const void *ctx)
+{
+	const struct nbperf *nbperf = ctx;
+
+	if (!i)
+		*p++ = '\t';
+	*p++ = '"';
+	p = fmt_str(p, nbperf->keys[i]);
+	if ((i + 1) % 4)
+		return fmt_str(p, "\", ");
+	p = fmt_str(p, "\",\t/* ");
+	p = fmt_dec(p, i + 1, 0);
+	return fmt_str(p, " */\n\t");
+}
+
+void
+keys_print(struct nbperf *nbperf)
+{
+	size_t i, max = 0;
+
+	for (i = 0; i < nbperf->n; i++)
+		if (max < nbperf->keylens[i])
+			max = nbperf->keylens[i];
+	table_print(nbperf->output, nbperf->n, max + 32, key_entry, nbperf);
+}
+
+/* the map file, one index per line */
+static char *
+map_entry(char *p, size_t i, const void *ctx)
+{
+	const uint32_t *map = ctx;
+
+	p = fmt_dec(p, map ? map[i] : i, 0);
+	*p++ = '\n';
+	return p;
+}
+
+/* map[i] or with map NULL i for the n keys */
+void
+map_print(struct nbperf *nbperf, const uint32_t *map, size_t n)
+{
+	if (nbperf->map_output != NULL)
+		table_print(nbperf->map_output, n, 12, map_entry, map);
+}
+
+/*
+ * With -e the big tables are written to a binary file instead of as
+ * array initializers, which are the slowest part of compiling the
+ * output.  The file is included as NAME_blob with C23 #embed, else with
+ * an .incbin directive of the ELF assembler.  The tables are little-endian,
+ * each at a 64 byte aligned offset of NAME_blob.
+ */
+void
+blob_addprint(struct nbperf *nbperf)
+{
+	const char *name = nbperf->hash_name, *file = nbperf->blob_name;
+
+	fprintf(nbperf->output,
+	    "#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__\n"
+	    "#error \"the tables in %s are little-endian\"\n"
+	    "#endif\n"
+	    "#ifdef __has_embed\n"
+	    "static _Alignas(64) const unsigned char %s_blob[] = {\n"
+	    "#embed \"%s\"\n"
+	    "};\n"
+	    "#elif defined __ELF__\n"
+	    "__asm__(\".pushsection .rodata\\n\"\n"
+	    "\t\".balign 64\\n\"\n"
+	    "\t\"%s_blob:\\n\"\n"
+	    "\t\".incbin \\\"%s\\\"\\n\"\n"
+	    "\t\".popsection\\n\");\n"
+	    "extern const unsigned char %s_blob[];\n"
+	    "#else\n"
+	    "#error \"%s needs #embed or an ELF assembler\"\n"
+	    "#endif\n\n",
+	    file, name, file, name, file, name, file);
+}
+
+/*
+ * Appends the n entries of a, of size bytes each, to the -e file as
+ * entries of type, followed by zeros up to len entries.  Prints decl,
+ * the name as a pointer into NAME_blob, instead of the array.
+ */
+void
+blob_print(struct nbperf *nbperf, const char *decl, const char *type,
+    const char *name, const void *a, unsigned size, size_t n, size_t len)
+{
+	static const uint8_t zero[64];
+	const char *digits = type + strcspn(type, "0123456789");
+	const unsigned width = *digits ? (unsigned)atoi(digits) / 8 : 1;
+	const size_t off = (nbperf->blob_size + 63) & ~(size_t)63;
+	uint8_t buf[8192];
+	size_t i, pos = 0;
+	uint64_t v;
+	unsigned j;
+
+	if (fwrite(zero, 1, off - nbperf->blob_size, nbperf->blob) !=
+	    off - nbperf->blob_size)
+		err(1, "cannot write %s", nbperf->blob_name);
+	for (i = 0; i < len; i++) {
+		v = 0;
+		if (i < n) {
+			const uint8_t *p = (const uint8_t *)a + i * size;
+			if (size == 1)
+				v = *p;
+			else if (size == 2)
+				v = *(const uint16_t *)p;
+			else if (size == 4)
+				v = *(const uint32_t *)p;
+			else
+				v = *(const uint64_t *)p;
+		}
+		for (j = 0; j < width; j++)
+			buf[pos++] = (uint8_t)(v >> (8 * j));
+		if (pos + 8 > sizeof(buf) || i + 1 == len) {
+			if (fwrite(buf, 1, pos, nbperf->blob) != pos)
+				err(1, "cannot write %s", nbperf->blob_name);
+			pos = 0;
+		}
+	}
+	nbperf->blob_size = off + len * width;
+	fprintf(nbperf->output,
+	    "%sconst %s *const %s = (const %s *)(%s_blob + %zu);\n",
+	    decl, type, name, type, nbperf->hash_name, off);
+}
+
+/* Number of bits needed to store the values 0 .. n-1, at least 1. */
+unsigned
+bitpack_width(uint64_t n)
+{
+	unsigned bits = 1;
+	while (bits < 64 && (UINT64_C(1) << bits) < n)
+		bits++;
+	return bits;
+}
+
+/* Bytes for n entries of bits width, plus 8 bytes slack for the
+ * unaligned 64-bit load in _getbits(). */
+size_t
+bitpack_size(uint64_t n, unsigned bits)
+{
+	return ((n * bits + 7) >> 3) + 8;
+}
+
+/* Entries are stored LSB first, little-endian. bits must be <= 57. */
+void
+bitpack_set(uint8_t *a, uint64_t i, unsigned bits, uint64_t v)
+{
+	uint64_t bit = i * bits;
+	unsigned j;
+	for (j = 0; j < bits; j++, bit++) {
+		if (v & (UINT64_C(1) << j))
+			a[bit >> 3] |= (uint8_t)(1U << (bit & 7));
+		else
+			a[bit >> 3] &= (uint8_t)~(1U << (bit & 7));
+	}
+}
+
+uint64_t
+bitpack_get(const uint8_t *a, uint64_t i, unsigned bits)
+{
+	uint64_t bit = i * bits, v = 0;
+	unsigned j;
+	for (j = 0; j < bits; j++, bit++)
+		if (a[bit >> 3] & (1U << (bit & 7)))
+			v |= UINT64_C(1) << j;
+	return v;
+}
+
+void
+bitpack_addprint(struct nbperf *nbperf)
+{
+	/* guarded, as it may be needed by more than one table */
+	fprintf(nbperf->output,
+	    "\n#ifndef NBPERF_GETBITS\n"
+	    "#define NBPERF_GETBITS\n"
+	    "static inline uint32_t _getbits(const uint8_t *g, uint64_t i, "
+	    "const unsigned bits)\n"
+	    "{\n"
+	    "\tuint64_t x;\n"
+	    "\tconst uint64_t bit = i * bits;\n"
+	    "\tmemcpy(&x, g + (bit >> 3), sizeof(x));\n"
+	    "#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__\n"
+	    "\tx = __builtin_bswap64(x);\n"
+	    "#endif\n"
+	    "\treturn (uint32_t)((x >> (bit & 7)) & ((UINT64_C(1) << bits) - 1));\n"
+	    "}\n"
+	    "#endif\n\n");
+}
+
+struct bytes {
+	const uint8_t *a;
+	size_t size;
+};
+
+static char *
+bitpack_entry(char *p, size_t i, const void *ctx)
+{
+	const struct bytes *b = ctx;
+
+	if (!i)
+		p = fmt_str(p, "\t    ");
+	p = fmt_str(p, " 0x");
+	p = fmt_hex(p, b->a[i], 2);
+	*p++ = ',';
+	if ((i + 1) % 10 == 0 && i + 1 < b->size)
+		p = fmt_str(p, "\n\t    ");
+	return p;
+}
+
+void
+bitpack_print(struct nbperf *nbperf, const char *indent, const char *name,
+    const uint8_t *a, size_t size)
+{
+	struct bytes b = { a, size };
+
+	if (nbperf->blob) {
+		blob_print(nbperf, *indent ? "\tstatic " : "static ", "uint8_t",
+		    name, a, 1, size, size);
+		return;
+	}
+	fprintf(nbperf->output, "%sstatic const uint8_t %s[%zu] = {\n", indent,
+	    name, size);
+	table_print(nbperf->output, size, 16, bitpack_entry, &b);
+	fprintf(nbperf->output, "\n%s};\n", indent);
+}
+
+/*
+ * With -k the -d keys are emitted as one string pool and bit-packed
+ * offsets, instead of an array of pointers to string literals.  That
+ * needs no load-time relocations in PIE binaries and much less space.
+ * NAME_keycmp(i, key, keylen) compares the length and the bytes of key i.
+ */
+void
+keypool_addprint(struct nbperf *nbperf)
+{
+	FILE *out = nbperf->output;
+	const char *name = nbperf->hash_name;
+	uint64_t total = 0;
+	unsigned bits;
+	size_t i, size, len;
+	uint8_t *off;
+	char *offname;
+
+	for (i = 0; i < nbperf->n; i++)
+		total += nbperf->keylens[i];
+	if (total > UINT32_MAX)
+		errx(1, "-k key pool too large");
+	bits = bitpack_width(total + 1);
+	size = bitpack_size(nbperf->n + 1, bits);
+	if ((off = calloc(size, 1)) == NULL)
+		err(1, "malloc failed");
+	total = 0;
+	for (i = 0; i < nbperf->n; i++) {
+		bitpack_set(off, i, bits, total);
+		total += nbperf->keylens[i];
+	}
+	bitpack_set(off, nbperf->n, bits, total);
+
+	bitpack_addprint(nbperf);
+	len = strlen(name) + sizeof("_pool");
+	if ((offname = malloc(len)) == NULL)
+		err(1, "malloc failed");
+	snprintf(offname, len, "%s_pool", name);
+	if (nbperf->blob) {
+		char *pool = malloc(total + 1);
+
+		if (pool == NULL)
+			err(1, "malloc failed");
+		for (i = 0, total = 0; i < nbperf->n; i++) {
+			memcpy(pool + total, nbperf->keys[i], nbperf->keylens[i]);
+			total += nbperf->keylens[i];
+		}
+		pool[total] = '\0';
+		blob_print(nbperf, nbperf->static_hash ? "static " : "", "char",
+		    offname, pool, 1, total + 1, total + 1);
+		free(pool);
+	} else {
+		fprintf(out, "%sconst char %s[%" PRIu64 "] =\n",
+		    nbperf->static_hash ? "static " : "", offname, total + 1);
+		for (i = 0; i < nbperf->n; i++) {
+			fprintf(out, "\t");
+			key_print(out, nbperf->keys[i], nbperf->keylens[i]);
+			fprintf(out, "%s\n", i + 1 == nbperf->n ? ";" : "");
+		}
+	}
+	free(offname);
+	len = strlen(name) + sizeof("_off");
+	if ((offname = malloc(len)) == NULL)
+		err(1, "malloc failed");
+	snprintf(offname, len, "%s_off", name);
+	bitpack_print(nbperf, "", offname, off, size);
+	free(offname);
+	free(off);
+	fprintf(out, "\nstatic inline int\n"
+	    "%s_keycmp(uint32_t i, const void *key, size_t keylen)\n"
+	    "{\n"
+	    "\tconst uint32_t o = _getbits(%s_off, i, %u);\n\n"
+	    "\treturn _getbits(%s_off, i + 1, %u) - o == keylen &&\n"
+	    "\t    memcmp(%s_pool + o, key, keylen) == 0;\n"
+	    "}\n\n", name, name, bits, name, bits, name);
+}
+
+/*
+ * With -F the -d key check is preceded by a fingerprint check, so most
+ * misses are rejected without touching the key.  The fingerprint uses
+ * the hash bits which are not reduced to a vertex: a spare hash word if
+ * there is one, else the upper bits of the xor of the used words.
+ */
+static const char *
+fingerprint_type(struct nbperf *nbperf)
+{
+	return nbperf->fingerprint == 8 ? "uint8_t" : "uint16_t";
+}
+
+/* number of hash words h[] of the emitted code, 16 or 32 bit */
+static unsigned
+fingerprint_words(struct nbperf *nbperf)
+{
+	/* fnv16_2 writes only two 16bit hashes */
+	if (nbperf->compute_hash == fnv16_compute)
+		return nbperf->hashes16 ? 2 : 1;
+	return nbperf->hashes16 ? 2 * nbperf->hash_size : nbperf->hash_size;
+}
+
+static uint32_t
+fingerprint_compute(struct nbperf *nbperf, size_t i, unsigned graph_size)
+{
+	const unsigned words = fingerprint_words(nbperf);
+	const unsigned wbits = nbperf->hashes16 ? 16 : 32;
+	const uint32_t mask = (UINT32_C(1) << nbperf->fingerprint) - 1;
+	uint32_t hashes[NBPERF_MAX_HASH_SIZE] = { 0 }, x = 0;
+	uint16_t hashes16[2 * NBPERF_MAX_HASH_SIZE] = { 0 };
+	unsigned j;
+
+	if (nbperf->hashes16)
+		(*nbperf->compute_hash)(nbperf, nbperf->hash_keys[i],
+		    nbperf->hash_keylens[i], (uint32_t *)hashes16);
+	else
+		(*nbperf->compute_hash)(nbperf, nbperf->hash_keys[i],
+		    nbperf->hash_keylens[i], hashes);
+	if (words > graph_size)
+		x = nbperf->hashes16 ? hashes16[graph_size] : hashes[graph_size];
+	else
+		for (j = 0; j < graph_size; j++)
+			x ^= nbperf->hashes16 ? hashes16[j] : hashes[j];
+	return (x >> (wbits - nbperf->fingerprint)) & mask;
+}
+
+/* the -F key lengths, 10 per line */
+static char *
+keylen_entry(char *p, size_t i, const void *ctx)
+{
+	const struct nbperf *nbperf = ctx;
+
+	*p++ = i % 10 ? ' ' : '\t';
+	p = fmt_dec(p, nbperf->keylens[i], 0);
+	*p++ = ',';
+	if (i % 10 == 9 || i + 1 == nbperf->n)
+		*p++ = '\n';
+	return p;
+}
+
+/*
+ * Without -k, the lengths of the keys in NAME_keylens, so the key check
+ * after the fingerprint compares the length first and then the bytes.
+ */
+static void
+keylens_addprint(struct nbperf *nbperf)
+{
+	const size_t len = strlen(nbperf->hash_name) + sizeof("_keylens");
+	const char *type;
+	size_t i, max = 0;
+	char *name;
+
+	for (i = 0; i < nbperf->n; i++)
+		if (max < nbperf->keylens[i])
+			max = nbperf->keylens[i];
+	if (max > UINT32_MAX)
+		errx(1, "-F key too long");
+	type = max <= UINT8_MAX ? "uint8_t" :
+	    max <= UINT16_MAX ? "uint16_t" : "uint32_t";
+	if ((name = malloc(len)) == NULL)
+		err(1, "malloc failed");
+	snprintf(name, len, "%s_keylens", nbperf->hash_name);
+	if (nbperf->blob)
+		blob_print(nbperf, nbperf->static_hash ? "static " : "",
+		    type, name, nbperf->keylens, sizeof(*nbperf->keylens),
+		    nbperf->n, nbperf->n);
+	else {
+		fprintf(nbperf->output, "%sconst %s %s[%zu] = {\n",
+		    nbperf->static_hash ? "static " : "", type, name,
+		    nbperf->n);
+		table_print(nbperf->output, nbperf->n, 24, keylen_entry, nbperf);
+		fprintf(nbperf->output, "};\n");
+	}
+	free(name);
+}
+
+/* the fingerprints of all keys, in key order like NAME_keys */
+void
+fingerprint_addprint(struct nbperf *nbperf, unsigned graph_size)
+{
+	size_t i;
+
+	if (!nbperf->keypool)
+		keylens_addprint(nbperf);
+
+	if (nbperf->blob) {
+		const size_t len = strlen(nbperf->hash_name) + sizeof("_fp");
+		uint32_t *fp = malloc(nbperf->n * sizeof(*fp));
+		char *name = malloc(len);
+
+		if (fp == NULL || name == NULL)
+			err(1, "malloc failed");
+		for (i = 0; i < nbperf->n; i++)
+			fp[i] = fingerprint_compute(nbperf, i, graph_size);
+		snprintf(name, len, "%s_fp", nbperf->hash_name);
+		blob_print(nbperf, nbperf->static_hash ? "static " : "",
+		    fingerprint_type(nbperf), name, fp, 4, nbperf->n,
+		    nbperf->n);
+		free(name);
+		free(fp);
+		return;
+	}
+	fprintf(nbperf->output, "%sconst %s %s_fp[%zu] = {\n",
+	    nbperf->static_hash ? "static " : "", fingerprint_type(nbperf),
+	    nbperf->hash_name, nbperf->n);
+	for (i = 0; i < nbperf->n; i++) {
+		fprintf(nbperf->output, "%s0x%0*" PRIx32 ",%s",
+		    i % 10 ? " " : "\t", nbperf->fingerprint / 4,
+		    fingerprint_compute(nbperf, i, graph_size),
+		    i % 10 == 9 || i + 1 == nbperf->n ? "\n" : "");
+	}
+	fprintf(nbperf->output, "};\n");
+}
+
+/* lhs = fingerprint of the unreduced h[], before the vertices */
+void
+fingerprint_print(struct nbperf *nbperf, const char *indent, const char *lhs,
+    unsigned graph_size)
+{
+	const unsigned words = fingerprint_words(nbperf);
+	const unsigned wbits = nbperf->hashes16 ? 16 : 32;
+	const char *type = fingerprint_type(nbperf);
+	unsigned j;
+
+	if (words > graph_size) {
+		fprintf(nbperf->output, "%s%s = (%s)(h[%u] >> %u);\n", indent,
+		    lhs, type, graph_size, wbits - nbperf->fingerprint);
+		return;
+	}
+	fprintf(nbperf->output, "%s%s = (%s)((", indent, lhs, type);
+	for (j = 0; j < graph_size; j++)
+		fprintf(nbperf->output, "%sh[%u]", j ? " ^ " : "", j);
+	fprintf(nbperf->output, ") >> %u);\n", wbits - nbperf->fingerprint);
+}
+
+/*
+ * With -O the perfect hash is emitted as NAME_static, and a wrapper NAME
+ * checks a small open addressing table on a miss. Keys can be added at
+ * run-time with NAME_insert, they get the results n .. n+size-1.
+ * NAME_rebuild_hook is called once, when the table becomes 3/4 full, to
+ * schedule a regeneration with the new keys. The inserted keys are not
+ * copied.
+ */
+void
+overflow_print(struct nbperf *nbperf, const char *name, int static_hash)
+{
+	const uint32_t size = nbperf->overflow;
+	const char *st = static_hash ? "static " : "";
+
+	fprintf(nbperf->output,
+	    "\n/* run-time overflow table for keys added after generation */\n"
+	    "static const char *%s_overflow_keys[%" PRIu32 "];\n"
+	    "static size_t %s_overflow_lens[%" PRIu32 "];\n"
+	    "static uint32_t %s_overflow_count;\n"
+	    "%svoid (*%s_rebuild_hook)(uint32_t count);\n\n",
+	    name, size, name, size, name, st, name);
+	fprintf(nbperf->output,
+	    "static inline uint32_t\n"
+	    "%s_overflow_slot(const void * __restrict key, size_t keylen)\n"
+	    "{\n"
+	    "\tconst unsigned char *p = (const unsigned char *)key;\n"
+	    "\tuint32_t h = UINT32_C(0x811c9dc5);\n"
+	    "\twhile (keylen--)\n"
+	    "\t\th = (h ^ *p++) * UINT32_C(0x01000193);\n"
+	    "\treturn h & %" PRIu32 ";\n"
+	    "}\n\n", name, size - 1);
+	fprintf(nbperf->output,
+	    "%suint32_t\n"
+	    "%s(const void * __restrict key, size_t keylen)\n"
+	    "{\n"
+	    "\tuint32_t result = %s_static(key, keylen);\n"
+	    "\tif (result < %" PRIu64 ")\n"
+	    "\t\treturn result;\n"
+	    "\tif (!%s_overflow_count)\n"
+	    "\t\treturn (uint32_t)-1;\n"
+	    "\tresult = %s_overflow_slot(key, keylen);\n"
+	    "\tfor (uint32_t i = 0; i < %" PRIu32 "; i++) {\n"
+	    "\t\tif (!%s_overflow_keys[result])\n"
+	    "\t\t\tbreak;\n"
+	    "\t\tif (%s_overflow_lens[result] == keylen &&\n"
+	    "\t\t    memcmp(%s_overflow_keys[result], key, keylen) == 0)\n"
+	    "\t\t\treturn %" PRIu64 " + result;\n"
+	    "\t\tresult = (result + 1) & %" PRIu32 ";\n"
+	    "\t}\n"
+	    "\treturn (uint32_t)-1;\n"
+	    "}\n\n",
+	    st, name, name, (uint64_t)nbperf->n, name, name, size, name, name,
+	    name, (uint64_t)nbperf->n, size - 1);
+	fprintf(nbperf->output,
+	    "%suint32_t\n"
+	    "%s_insert(const void * __restrict key, size_t keylen)\n"
+	    "{\n"
+	    "\tuint32_t result = %s(key, keylen);\n"
+	    "\tif (result != (uint32_t)-1 || %s_overflow_count == %" PRIu32 ")\n"
+	    "\t\treturn result;\n"
+	    "\tresult = %s_overflow_slot(key, keylen);\n"
+	    "\twhile (%s_overflow_keys[result])\n"
+	    "\t\tresult = (result + 1) & %" PRIu32 ";\n"
+	    "\t%s_overflow_keys[result] = (const char *)key;\n"
+	    "\t%s_overflow_lens[result] = keylen;\n"
+	    "\tif (++%s_overflow_count == %" PRIu32 " && %s_rebuild_hook)\n"
+	    "\t\t%s_rebuild_hook(%s_overflow_count);\n"
+	    "\treturn %" PRIu64 " + result;\n"
+	    "}\n",
+	    st, name, name, name, size, name, name, size - 1, name, name,
+	    name, size - size / 4, name, name, name, (uint64_t)nbperf->n);
+}
+
 void
 print_coda(struct nbperf *nbperf)
 {
@@ -348,18 +1965,54 @@ print_coda(struct nbperf *nbperf)
 #ifdef VERSION
 	fprintf(nbperf->output, "%s ", VERSION);
 #endif
+	if (nbperf->batch) {
+		fprintf(nbperf->output, "%sb", saw_dash ? "" : "-");
+		saw_dash = 1;
+	}
+	if (nbperf->cxx) {
+		fprintf(nbperf->output, "%sC", saw_dash ? "" : "-");
+		saw_dash = 1;
+	}
 	if (nbperf->allow_hash_fudging) {
 		fprintf(nbperf->output, "%sf", saw_dash ? "" : "-");
 		saw_dash = 1;
 	}
 	if (nbperf->intkeys) {
-		fprintf(nbperf->output, "%sI", saw_dash ? "" : "-");
+		fprintf(nbperf->output, "%s%s", saw_dash ? "" : "-",
+		    nbperf->intkeys64 ? "L" : "I");
 		saw_dash = 1;
 	}
 	if (nbperf->predictable) {
 		fprintf(nbperf->output, "%sp", saw_dash ? "" : "-");
 		saw_dash = 1;
 	}
+	if (nbperf->non_minimal) {
+		fprintf(nbperf->output, "%sP", saw_dash ? "" : "-");
+		saw_dash = 1;
+	}
+	if (nbperf->overflow) {
+		fprintf(nbperf->output, "%s -O %" PRIu32, saw_dash ? "" : " ",
+		    nbperf->overflow);
+		saw_dash = 0;
+	}
+	if (nbperf->blob) {
+		fprintf(nbperf->output, " -e %s", nbperf->blob_name);
+		saw_dash = 0;
+	}
+	if (nbperf->fixed) {
+		fprintf(nbperf->output, " %s %s%s",
+		    nbperf->prehashed ? "-H" : "-B", nbperf->layout,
+		    nbperf->raw ? " -R" : "");
+		saw_dash = 0;
+	}
+	if (nbperf->keypos) {
+		fprintf(nbperf->output, "%sK", saw_dash ? "" : "-");
+		saw_dash = 1;
+	}
+	if (nbperf->shape) {
+		fprintf(nbperf->output, "%sS", saw_dash ? "" : "-");
+		saw_dash = 1;
+	}
 	if (nbperf->static_hash) {
 		fprintf(nbperf->output, "%ss", saw_dash ? "" : "-");
 		saw_dash = 1;
@@ -377,9 +2030,19 @@ print_coda(struct nbperf *nbperf)
 	//if (!nbperf->intkeys)
 	//	fprintf(nbperf->output, "#include <stdlib.h>\n");
 	fprintf(nbperf->output, "#include <stdint.h>\n");
-	if (nbperf->hash_header)
+	if (nbperf->cxx)
+		fprintf(nbperf->output, "#include \"nbperf_constexpr.h\"\n\n");
+	else if (nbperf->hash_header)
 		fprintf(nbperf->output, "#include \"%s\"\n\n",
 		    nbperf->hash_header);
+	if (nbperf->print_hash == shape_print)
+		shape_addprint(nbperf);
+	if (nbperf->fixed)
+		fixed_addprint(nbperf);
+	if (nbperf->keypos)
+		keypos_addprint(nbperf);
+	if (nbperf->blob)
+		blob_addprint(nbperf);
 }
 
 static void
@@ -449,11 +2112,38 @@ set_hash(struct nbperf *nbperf, const char *arg)
 		nbperf->print_hash = fnv_print;
 		return;
         }
+	else if (strcmp(arg, "aeshash") == 0) {
+		nbperf->hash_size = 4;
+		nbperf->compute_hash = aeshash4_compute;
+		nbperf->hash_header = "aeshash.h";
+		nbperf->seed_hash = fnv_seed;
+		nbperf->print_hash = aeshash_print;
+		return;
+	}
 	errx(1, "Unknown hash function: %s. "
-             "Known hashes: mi_vector_hash wyhash fnv fnv32 fnv16 crc",
+             "Known hashes: mi_vector_hash wyhash fnv fnv32 fnv16 crc aeshash",
              arg);
 }
 
+/* -R: the next record of size bytes, as getline */
+static ssize_t
+raw_read(char **buf, size_t *allocated, size_t size, FILE *input)
+{
+	size_t got;
+
+	if (*allocated < size) {
+		if ((*buf = realloc(*buf, size)) == NULL)
+			err(1, "realloc failed");
+		*allocated = size;
+	}
+	got = fread(*buf, 1, size, input);
+	if (got == 0 && feof(input))
+		return -1;
+	if (got != size)
+		errx(2, "Truncated record at the end of the input");
+	return (ssize_t)size;
+}
+
 int
 main(int argc, char **argv)
 {
@@ -470,6 +2160,19 @@ main(int argc, char **argv)
 		.intkeys = 0,
 		.embed_data = 0,
 		.embed_map = 1,
+		.non_minimal = 0,
+		.overflow = 0,
+		.batch = 0,
+		.packed = 0,
+		.keypool = 0,
+		.fingerprint = 0,
+		.cxx = 0,
+		.shape = 0,
+		.keypos = 0,
+		.blob = NULL,
+		.blob_name = NULL,
+		.blob_size = 0,
+		.rank_words = 7,
 	};
 	FILE *input;
 	size_t curlen = 0, curalloc = 0;
@@ -483,6 +2186,10 @@ main(int argc, char **argv)
 	uint32_t max_iterations = MAX_ITERATIONS;
 	long tmp;
 	int looped, ch;
+	char *overflow_name = NULL;
+	const char *public_name = NULL;
+	int overflow_static = 0;
+	int hash_given = 0, algorithm_given = 0;
 	int (*build_hash)(struct nbperf *) = chm_compute;
 
 #ifdef ASAN
@@ -499,7 +2206,7 @@ main(int argc, char **argv)
 # endif
 #endif
 
-	while ((ch = getopt(argc, argv, "a:c:dfh:i:m:n:o:psIM")) != -1) {
+	while ((ch = getopt(argc, argv, "a:B:bCc:de:F:fgH:h:i:Kkm:n:O:o:pPRr:SsILM")) != -1) {
 		switch (ch) {
 		case 'a':
 			/* Accept bdz as alias for netbsd-6 compat. */
@@ -510,8 +2217,27 @@ main(int argc, char **argv)
 			else if ((strcmp(optarg, "bpz") == 0 ||
                                   strcmp(optarg, "bdz") == 0))
 				build_hash = bpz_compute;
+			else if (strcmp(optarg, "monotone") == 0)
+				build_hash = monotone_compute;
+			else if (strcmp(optarg, "tiny") == 0)
+				build_hash = tiny_compute;
+			else if (strcmp(optarg, "dense") == 0)
+				build_hash = dense_compute;
 			else
-				errx(1, "Unsupported algorithm -a %s. Only chm,chm3,bpz,bdz.", optarg);
+				errx(1, "Unsupported algorithm -a %s. Only chm,chm3,bpz,bdz,monotone,tiny,dense.", optarg);
+			algorithm_given = 1;
+			break;
+		case 'B':
+			if (nbperf.prehashed)
+				errx(1, "-B is not supported with -H");
+			fixed_parse_layout(&nbperf, optarg);
+			nbperf.layout = optarg;
+			break;
+		case 'b':
+			nbperf.batch = 1;
+			break;
+		case 'C':
+			nbperf.cxx = 1;
 			break;
 		case 'c':
 			errno = 0;
@@ -522,11 +2248,39 @@ main(int argc, char **argv)
 		case 'd':
 			nbperf.embed_data = 1;
 			break;
+		case 'e':
+			if (strpbrk(optarg, "\"\\\n") != NULL)
+				errx(1, "Invalid argument for -e");
+			if (nbperf.blob)
+				fclose(nbperf.blob);
+			nbperf.blob = fopen(optarg, "wb");
+			if (nbperf.blob == NULL)
+				err(2, "cannot open blob file");
+			nbperf.blob_name = optarg;
+			break;
+		case 'F':
+			errno = 0;
+			tmp = strtol(optarg, &eos, 0);
+			if (errno || eos == optarg || *eos ||
+			    (tmp != 8 && tmp != 16))
+				errx(1, "Invalid argument for -F, only 8 or 16");
+			nbperf.fingerprint = (unsigned)tmp;
+			break;
 		case 'f':
 			nbperf.allow_hash_fudging = 1;
 			break;
+		case 'g':
+			nbperf.packed = 1;
+			break;
+		case 'H':
+			if (nbperf.fixed && !nbperf.prehashed)
+				errx(1, "-B is not supported with -H");
+			prehashed_parse_bits(&nbperf, optarg);
+			nbperf.layout = optarg;
+			break;
 		case 'h':
 			set_hash(&nbperf, optarg);
+			hash_given = 1;
 			break;
 		case 'i':
 			errno = 0;
@@ -536,12 +2290,21 @@ main(int argc, char **argv)
 				errx(2, "-i %ld iteration count must be < 10000", tmp);
 			max_iterations = (uint32_t)tmp;
 			break;
+		case 'L':
+			nbperf.intkeys64 = 1;
+			/* FALLTHROUGH */
 		case 'I':
 			nbperf.intkeys = 1;
 			set_hash(&nbperf, "inthash");
 			if (strcmp(nbperf.hash_name, "hash") == 0)
 				nbperf.hash_name = "inthash";
 			break;
+		case 'K':
+			nbperf.keypos = 1;
+			break;
+		case 'k':
+			nbperf.keypool = 1;
+			break;
 		case 'M':
 			nbperf.fastmod = 1;
 			break;
@@ -556,6 +2319,17 @@ main(int argc, char **argv)
 		case 'n':
 			nbperf.hash_name = optarg;
 			break;
+		case 'O':
+			errno = 0;
+			tmp = strtol(optarg, &eos, 0);
+			if (errno || eos == optarg || *eos || tmp < 2 ||
+			    tmp > 65536)
+				errx(1, "Invalid argument for -O");
+			/* round up to a power of 2 for the probe mask */
+			nbperf.overflow = 2;
+			while (nbperf.overflow < (uint32_t)tmp)
+				nbperf.overflow <<= 1;
+			break;
 		case 'o':
 			if (nbperf.output)
 				fclose(nbperf.output);
@@ -566,6 +2340,23 @@ main(int argc, char **argv)
 		case 'p':
 			nbperf.predictable = 1;
 			break;
+		case 'P':
+			nbperf.non_minimal = 1;
+			break;
+		case 'R':
+			nbperf.raw = 1;
+			break;
+		case 'r':
+			errno = 0;
+			tmp = strtol(optarg, &eos, 0);
+			if (errno || eos == optarg || *eos ||
+			    (tmp != 1 && tmp != 3 && tmp != 7))
+				errx(1, "Invalid argument for -r, only 1, 3 or 7");
+			nbperf.rank_words = (unsigned)tmp;
+			break;
+		case 'S':
+			nbperf.shape = 1;
+			break;
 		case 's':
 			nbperf.static_hash = 1;
 			break;
@@ -583,6 +2374,112 @@ main(int argc, char **argv)
 
 	if (argc > 1)
 		usage();
+	if (nbperf.non_minimal && build_hash != bpz_compute)
+		errx(1, "-P is only supported with -a bdz");
+	if (nbperf.rank_words != 7 && build_hash != bpz_compute)
+		errx(1, "-r is only supported with -a bdz");
+	if (nbperf.embed_data && nbperf.intkeys && build_hash == bpz_compute)
+		errx(1, "-d with -I or -L is not supported with -a bdz");
+	if (nbperf.packed && build_hash == monotone_compute)
+		errx(1, "-g is not supported with -a monotone");
+	if (nbperf.keypool) {
+		if (!nbperf.embed_data || nbperf.intkeys)
+			errx(1, "-k requires -d with string keys");
+		if (build_hash == bpz_compute)
+			errx(1, "-k is not supported with -a bdz");
+	}
+	if (nbperf.fingerprint) {
+		if (!nbperf.embed_data || nbperf.intkeys)
+			errx(1, "-F requires -d with string keys");
+		if (build_hash != chm_compute && build_hash != chm3_compute)
+			errx(1, "-F is only supported with -a chm or chm3");
+	}
+	if (nbperf.cxx) {
+		if (build_hash != chm_compute && build_hash != chm3_compute)
+			errx(1, "-C is only supported with -a chm or chm3");
+		if (nbperf.batch || nbperf.packed || nbperf.keypool ||
+		    nbperf.fingerprint || nbperf.overflow)
+			errx(1, "-C is not supported with -b, -g, -k, -F or -O");
+		if (nbperf.blob)
+			errx(1, "-C is not supported with -e");
+	}
+	if (nbperf.batch && build_hash == monotone_compute)
+		errx(1, "-b is not supported with -a monotone");
+	if (build_hash == tiny_compute) {
+		if (nbperf.intkeys)
+			errx(1, "-a tiny requires string keys");
+		if (nbperf.batch || nbperf.cxx || nbperf.blob ||
+		    nbperf.fingerprint || nbperf.packed || nbperf.keypos ||
+		    nbperf.keypool || nbperf.overflow || nbperf.shape)
+			errx(1, "-a tiny is not supported with -b, -C, -e, -F, "
+			    "-g, -K, -k, -O or -S");
+	}
+	if (nbperf.intkeys64 && (nbperf.batch || nbperf.cxx))
+		errx(1, "-L is not supported with -b or -C");
+	if (nbperf.raw && !nbperf.fixed)
+		errx(1, "-R requires -B or -H");
+	if (nbperf.fixed) {
+		const char *opt = nbperf.prehashed ? "-H" : "-B";
+
+		if (nbperf.intkeys)
+			errx(1, "%s is not supported with -I or -L", opt);
+		if (nbperf.batch || nbperf.cxx || nbperf.fingerprint ||
+		    nbperf.keypos || nbperf.keypool || nbperf.overflow ||
+		    nbperf.shape)
+			errx(1, "%s is not supported with -b, -C, -F, -K, -k, "
+			    "-O or -S", opt);
+		if (hash_given)
+			errx(1, "%s is not supported with -h", opt);
+		if (build_hash != chm_compute && build_hash != chm3_compute &&
+		    build_hash != bpz_compute)
+			errx(1, "%s is only supported with -a chm, chm3 or bdz",
+			    opt);
+		if (nbperf.embed_data && build_hash == bpz_compute)
+			errx(1, "%s -d is not supported with -a bdz", opt);
+		nbperf.hash_header = NULL;
+		nbperf.seed_hash = fnv_seed;
+		nbperf.compute_hash = fixed_compute;
+		nbperf.print_hash = fixed_print;
+		nbperf.hash_size = build_hash == chm_compute ? 2 : 4;
+	}
+	if (build_hash == dense_compute) {
+		if (!nbperf.intkeys)
+			errx(1, "-a dense requires -I");
+		if (nbperf.batch || nbperf.cxx || nbperf.blob ||
+		    nbperf.packed || nbperf.fastmod)
+			errx(1, "-a dense is not supported with -b, -C, -e, -g "
+			    "or -M");
+	}
+	if (nbperf.shape) {
+		if (nbperf.intkeys)
+			errx(1, "-S requires string keys");
+		if (nbperf.cxx || build_hash == monotone_compute)
+			errx(1, "-S is not supported with -C or -a monotone");
+	}
+	if (nbperf.keypos) {
+		if (nbperf.intkeys)
+			errx(1, "-K requires string keys");
+		if (nbperf.cxx || nbperf.shape || build_hash == monotone_compute)
+			errx(1, "-K is not supported with -C, -S or -a monotone");
+	}
+	if (nbperf.overflow) {
+		if (nbperf.batch)
+			errx(1, "-b is not supported with -O");
+		if (!nbperf.embed_data)
+			errx(1, "-O requires -d");
+		if (nbperf.intkeys || nbperf.non_minimal ||
+		    build_hash == monotone_compute)
+			errx(1, "-O is not supported with -I, -P or -a monotone");
+		tmp = strlen(nbperf.hash_name) + sizeof("_static");
+		if ((overflow_name = malloc(tmp)) == NULL)
+			err(1, "malloc failed");
+		snprintf(overflow_name, tmp, "%s_static", nbperf.hash_name);
+		/* the public name is the wrapper */
+		overflow_static = nbperf.static_hash;
+		public_name = nbperf.hash_name;
+		nbperf.hash_name = overflow_name;
+		nbperf.static_hash = 1;
+	}
 
 	//if (build_hash == chm_compute && nbperf.hash_size == 3)
 	//	nbperf.hash_size = 2; // wyhash not
@@ -611,8 +2508,10 @@ main(int argc, char **argv)
 
 	line = NULL;
 	line_allocated = 0;
-	while ((line_len = getline(&line, &line_allocated, input)) != -1) {
-		if (line_len && line[line_len - 1] == '\n')
+	while ((line_len = nbperf.raw ?
+	    raw_read(&line, &line_allocated, nbperf.fixed, input) :
+	    getline(&line, &line_allocated, input)) != -1) {
+		if (!nbperf.raw && line_len && line[line_len - 1] == '\n')
 			--line_len;
 		if (curlen == curalloc) {
 			if (curalloc < 256)
@@ -626,24 +2525,44 @@ main(int argc, char **argv)
 			if (keylens == NULL)
 				err(1, "realloc failed");
 		}
-		if (nbperf.intkeys) {
+		if (nbperf.fixed) {
+			uint8_t *key;
+			if (!nbperf.raw && (!line_len || line[0] == '#'))
+				continue;
+			/* padded for the 4 byte reads of the string hashes */
+			key = calloc((nbperf.fixed + 3) & ~3U, 1);
+			if (key == NULL)
+				err(1, "calloc failed");
+			if (nbperf.raw)
+				memcpy(key, line, nbperf.fixed);
+			else switch (nbperf.prehashed ?
+			    prehashed_parse(&nbperf, line, line_len, key) :
+			    fixed_parse(&nbperf, line, line_len, key)) {
+			case -1:
+				errx(2, "Invalid %s %s key \"%.*s\" at line %lu of %s",
+				    nbperf.prehashed ? "-H" : "-B", nbperf.layout,
+				    (int)line_len, line, curlen, nbperf.input);
+			case -2:
+				errx(2, "%s %s key \"%.*s\" at line %lu of %s is "
+				    "out of range", nbperf.prehashed ? "-H" : "-B",
+				    nbperf.layout, (int)line_len, line, curlen,
+				    nbperf.input);
+			}
+			keys[curlen] = (const char *)key;
+			line_len = nbperf.fixed;
+		} else if (nbperf.intkeys) {
 			uint64_t i;
 			if (!line_len || line[0] == '#') {
 				continue; // skip comment or empy lines, intkeys only
 			}
-			if (line[0] == '0' &&
-			    (line[1] == 'x' || line[1] == 'X')) {
-				if (1 != sscanf(&line[2], "%lx", &i))
-					errx(2,
-					    "Invalid integer hex key \"%s\" at line %lu of %s",
-					    line, curlen, nbperf.input);
-			} else {
-				errno = 0;
-				i = strtod(line, &eos);
-				if (errno || (eos[0] != '\n' && eos[0] != '\r'))
-					errx(2,
-					    "Invalid integer key \"%s\" at line %lu of %s",
-					    line, curlen, nbperf.input);
+			switch (parse_intkey(line, line_len, nbperf.intkeys64, &i)) {
+			case -1:
+				errx(2, "Invalid integer key \"%.*s\" at line %lu of %s",
+				    (int)line_len, line, curlen, nbperf.input);
+			case -2:
+				errx(2, "Integer key \"%.*s\" at line %lu of %s is "
+				    "out of range%s", (int)line_len, line, curlen,
+				    nbperf.input, nbperf.intkeys64 ? "" : ", use -L");
 			}
 			memcpy(&keys[curlen], &i, sizeof(char *));
 		} else if (line_len % 4 == 0) {
@@ -667,6 +2586,33 @@ main(int argc, char **argv)
 	nbperf.n = curlen;
 	nbperf.keys = keys;
 	nbperf.keylens = keylens;
+	nbperf.hash_keys = keys;
+	nbperf.hash_keylens = keylens;
+
+	/* a few string keys are faster compared than hashed */
+	if (!algorithm_given && nbperf.embed_data && !nbperf.intkeys &&
+	    !nbperf.fixed && curlen > 0 && curlen <= NBPERF_TINY &&
+	    !nbperf.batch && !nbperf.cxx &&
+	    !nbperf.blob && !nbperf.fingerprint && !nbperf.packed &&
+	    !nbperf.keypos && !nbperf.keypool && !nbperf.overflow &&
+	    !nbperf.shape)
+		build_hash = tiny_compute;
+	/* runs of integer keys are indexed directly */
+	if (!algorithm_given && nbperf.intkeys && !nbperf.batch &&
+	    !nbperf.cxx && !nbperf.blob && !nbperf.packed && !nbperf.fastmod &&
+	    dense_check(&nbperf))
+		build_hash = dense_compute;
+	if (nbperf.keypos) {
+		shape_analyse(&nbperf);
+		keypos_select(&nbperf);
+	}
+
+	/* short keys are hashed by wyhash without its generic length branches */
+	if (nbperf.shape) {
+		shape_analyse(&nbperf);
+		if (!hash_given && nbperf.maxlen <= 16)
+			set_hash(&nbperf, "wyhash");
+	}
 
 	/* with less keys we can use smaller and esp. faster 16bit hashes */
 	if (curlen <= 65534) {
@@ -689,6 +2635,9 @@ main(int argc, char **argv)
 			} else if (nbperf.compute_hash == fnv3_compute) {
 				nbperf.hash_size = 2;
 				nbperf.compute_hash = fnv_compute;
+			} else if (nbperf.compute_hash == aeshash4_compute) {
+				nbperf.hash_size = 2;
+				nbperf.compute_hash = aeshash2_compute;
 			}
 		}
 	} else if (build_hash == chm_compute) {
@@ -702,6 +2651,19 @@ main(int argc, char **argv)
 			nbperf.compute_hash = crc2_compute;
 		}
 #endif
+		else if (nbperf.compute_hash == aeshash4_compute) {
+			nbperf.hash_size = 2;
+			nbperf.compute_hash = aeshash2_compute;
+		}
+	}
+
+	if (nbperf.shape && nbperf.minlen <= 16 &&
+	    (nbperf.compute_hash == wyhash2_compute ||
+	     nbperf.compute_hash == wyhash4_compute))
+		nbperf.print_hash = shape_print;
+	if (nbperf.keypos) {
+		nbperf.keypos_print_hash = nbperf.print_hash;
+		nbperf.print_hash = keypos_print;
 	}
 
 	looped = 0;
@@ -727,7 +2689,16 @@ main(int argc, char **argv)
 	}
 	if (looped)
 		fputc('\n', stderr);
+	if (nbperf.overflow) {
+		overflow_print(&nbperf, public_name, overflow_static);
+		free(overflow_name);
+	}
 
+	if (nbperf.keypos) {
+		free((void *)nbperf.hash_keys[0]);
+		free((void *)nbperf.hash_keys);
+		free((void *)nbperf.hash_keylens);
+	}
 	free(keylens);
 	if (!nbperf.intkeys)
 		for (unsigned i = 0; i < curlen; i++)
@@ -737,5 +2708,7 @@ main(int argc, char **argv)
 		fclose(nbperf.output);
 	if (nbperf.map_output)
 		fclose(nbperf.map_output);
+	if (nbperf.blob && fclose(nbperf.blob))
+		err(1, "cannot write %s", nbperf.blob_name);
 	return 0;
 }
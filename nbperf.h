@@ -35,26 +35,68 @@
 // number of u32 results
 #define NBPERF_MIN_HASH_SIZE 2
 #define NBPERF_MAX_HASH_SIZE 4
+// number of keys per group in NAME_batch
+#define NBPERF_BATCH 8
+// the most keys for which -d selects -a tiny
+#define NBPERF_TINY 64
+// the most key positions of -K
+#define NBPERF_MAX_KEYPOS 32
+// the most fields of -B
+#define NBPERF_MAX_FIELDS 8
 
 struct nbperf {
 	FILE *output;
 	FILE *map_output;
+	FILE *blob; /* -e binary tables file, or NULL */
+	const char *blob_name;
+	size_t blob_size;
 	const char *input;
 	const char *hash_name;
 	const char *hash_header;
 	size_t n;
 	const char *__restrict *keys;
 	const size_t *keylens;
+	/* the keys as hashed: the keys, or with -K their key positions */
+	const char *__restrict *hash_keys;
+	const size_t *hash_keylens;
 	unsigned static_hash : 1;
 	unsigned allow_hash_fudging : 1;
 	unsigned predictable : 1;
 	unsigned intkeys : 1;
+	unsigned intkeys64 : 1; /* -L: 64-bit integer keys */
 	unsigned check_duplicates : 1;
 	unsigned has_duplicates : 1;
 	unsigned hashes16 : 1; // 16bit hashes only
 	unsigned fastmod : 1;
 	unsigned embed_data : 1;
 	unsigned embed_map : 1;
+	unsigned non_minimal : 1;
+	unsigned batch : 1; /* also emit NAME_prefetch and NAME_batch */
+	unsigned packed : 1; /* bit-pack the g table */
+	unsigned keypool : 1; /* -d keys as one pool with packed offsets */
+	unsigned cxx : 1; /* C++ header with constexpr tables and lookup */
+	unsigned shape : 1; /* -S: specialize to the key lengths */
+	unsigned keypos : 1; /* -K: hash only the key positions */
+	unsigned raw : 1; /* -R: the -B keys are binary records */
+	unsigned prehashed : 1; /* -H: the keys are 64 or 128-bit hashes */
+
+	uint32_t overflow; /* size of the run-time overflow table, or 0 */
+	unsigned rank_words; /* bpz: g words per rank sample, 1, 3 or 7 */
+	unsigned fingerprint; /* bits of the -d key fingerprints, 0, 8 or 16 */
+	size_t minlen, maxlen; /* of the keys, with -S */
+	uint64_t lenmap; /* bit i: a key of length i < 64, with -S */
+	/* -K: byte i of the key if >= 0, of the end if < 0 */
+	int positions[NBPERF_MAX_KEYPOS];
+	unsigned npositions;
+	unsigned keypos_len; /* the bytes hashed, with the length */
+	void (*keypos_print_hash)(struct nbperf *, const char *, const char *,
+	    const char *, const char *);
+	/* -B: the bytes of the fixed-width keys, or 0 */
+	unsigned fixed;
+	const char *layout;
+	/* -B: the bytes of each field, or no fields for a byte array */
+	unsigned nfields;
+	uint8_t field_size[NBPERF_MAX_FIELDS];
 
 	double c;
 
@@ -69,11 +111,48 @@ struct nbperf {
 int chm_compute(struct nbperf *);
 int chm3_compute(struct nbperf *);
 int bpz_compute(struct nbperf *);
+int monotone_compute(struct nbperf *);
+int tiny_compute(struct nbperf *);
+int dense_check(struct nbperf *);
+int dense_compute(struct nbperf *);
 void print_coda(struct nbperf *);
 void mi_vector_hash_print(struct nbperf *nbperf, const char *indent, const char *key,
                           const char *keylen, const char *hash);
 void inthash_addprint(struct nbperf *nbperf);
 void inthash4_addprint(struct nbperf *nbperf);
+unsigned bitpack_width(uint64_t n);
+size_t bitpack_size(uint64_t n, unsigned bits);
+void bitpack_set(uint8_t *a, uint64_t i, unsigned bits, uint64_t v);
+uint64_t bitpack_get(const uint8_t *a, uint64_t i, unsigned bits);
+void bitpack_addprint(struct nbperf *nbperf);
+void bitpack_print(struct nbperf *nbperf, const char *indent, const char *name,
+                   const uint8_t *a, size_t size);
+void keypool_addprint(struct nbperf *nbperf);
+void shape_reject_print(struct nbperf *nbperf, const char *indent,
+                        const char *hashtype);
+void fixed_signature_print(struct nbperf *nbperf);
+void fixed_embed_print(struct nbperf *nbperf);
+void fixed_cmp_print(struct nbperf *nbperf, const char *result);
+void blob_addprint(struct nbperf *nbperf);
+void blob_print(struct nbperf *nbperf, const char *decl, const char *type,
+                const char *name, const void *a, unsigned size, size_t n,
+                size_t len);
+void key_print(FILE *out, const char *key, size_t keylen);
+void constexpr_hash_print(struct nbperf *nbperf, const char *indent,
+                          const char *key, const char *keylen);
+void fingerprint_addprint(struct nbperf *nbperf, unsigned graph_size);
+void fingerprint_print(struct nbperf *nbperf, const char *indent,
+                       const char *lhs, unsigned graph_size);
+/* formats entry i of a table at p, and returns the end */
+typedef char *(*table_entry_fn)(char *p, size_t i, const void *ctx);
+void table_print(FILE *out, size_t n, size_t max, table_entry_fn entry,
+                 const void *ctx);
+char *fmt_dec(char *p, uint64_t v, int width);
+char *fmt_hex(char *p, uint64_t v, int width);
+char *fmt_str(char *p, const char *s);
+void keys_print(struct nbperf *nbperf);
+void map_print(struct nbperf *nbperf, const uint32_t *map, size_t n);
+void overflow_print(struct nbperf *nbperf, const char *name, int static_hash);
 
 #ifdef DEBUG
 #define DEBUGP(args...) do { \
@@ -0,0 +1,239 @@
+/*
+ * constexpr versions of the nbperf hash functions, for the C++ headers
+ * written by nbperf -C.
+ *
+ * They return the same words as mi_vector_hash.h, mi_wyhash.h, fnv3.h,
+ * fnv16.h and the emitted _inthash functions do on a little-endian host,
+ * so a lookup with a constant key folds to a constant, e.g. as a case
+ * label. The loads are composed from bytes, which compilers merge into
+ * single loads for the lookups at run-time. Requires C++17.
+ */
+#ifndef NBPERF_CONSTEXPR_H
+#define NBPERF_CONSTEXPR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <array>
+#include <string_view>
+
+namespace nbperf {
+
+/* the 32bit words of the C hashes[], zero-filled */
+typedef std::array<uint32_t, 4> hashes;
+
+constexpr uint32_t le32(const char *p)
+{
+  return (uint32_t)(uint8_t)p[0] | (uint32_t)(uint8_t)p[1] << 8 |
+         (uint32_t)(uint8_t)p[2] << 16 | (uint32_t)(uint8_t)p[3] << 24;
+}
+
+constexpr uint64_t le64(const char *p)
+{
+  return le32(p) | (uint64_t)le32(p + 4) << 32;
+}
+
+/* the 16bit view of the words, as with nbperf->hashes16 */
+constexpr std::array<uint16_t, 8> split16(const hashes &w)
+{
+  return {{ (uint16_t)w[0], (uint16_t)(w[0] >> 16),
+            (uint16_t)w[1], (uint16_t)(w[1] >> 16),
+            (uint16_t)w[2], (uint16_t)(w[2] >> 16),
+            (uint16_t)w[3], (uint16_t)(w[3] >> 16) }};
+}
+
+constexpr hashes split64(uint64_t h0, uint64_t h1 = 0)
+{
+  return {{ (uint32_t)h0, (uint32_t)(h0 >> 32),
+            (uint32_t)h1, (uint32_t)(h1 >> 32) }};
+}
+
+/* mi_vector_hash.c */
+constexpr void mi_mix(uint32_t &a, uint32_t &b, uint32_t &c)
+{
+  a -= b; a -= c; a ^= (c >> 13);
+  b -= c; b -= a; b ^= (a << 8);
+  c -= a; c -= b; c ^= (b >> 13);
+  a -= b; a -= c; a ^= (c >> 12);
+  b -= c; b -= a; b ^= (a << 16);
+  c -= a; c -= b; c ^= (b >> 5);
+  a -= b; a -= c; a ^= (c >> 3);
+  b -= c; b -= a; b ^= (a << 10);
+  c -= a; c -= b; c ^= (b >> 15);
+}
+
+constexpr hashes mi_vector_hash(const char *k, size_t len, uint32_t seed)
+{
+  uint32_t a = 0x9e3779b9, b = 0x9e3779b9, c = seed;
+  const uint32_t orig_len = (uint32_t)len;
+
+  while (len >= 12) {
+    a += le32(k);
+    b += le32(k + 4);
+    c += le32(k + 8);
+    mi_mix(a, b, c);
+    k += 12;
+    len -= 12;
+  }
+  c += orig_len;
+  if (len > 8) {
+    for (size_t i = len; i > 8; i--)
+      c += (uint32_t)(uint8_t)k[i - 1] << (8 * (i - 8));
+    b += le32(k + 4);
+    a += le32(k);
+  } else if (len > 4) {
+    for (size_t i = len; i > 4; i--)
+      b += (uint32_t)(uint8_t)k[i - 1] << (8 * (i - 5));
+    a += le32(k);
+  } else {
+    for (size_t i = len; i > 0; i--)
+      a += (uint32_t)(uint8_t)k[i - 1] << (8 * (i - 1));
+  }
+  mi_mix(a, b, c);
+  return {{ a, b, c, 0 }};
+}
+
+/* wyhash.h with WYHASH_CONDOM 1 */
+constexpr uint64_t wyp[4] = {
+  0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+  0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull
+};
+
+constexpr uint64_t wymix(uint64_t A, uint64_t B)
+{
+#ifdef __SIZEOF_INT128__
+  const __uint128_t r = (__uint128_t)A * B;
+  return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+  const uint64_t ha = A >> 32, hb = B >> 32, la = (uint32_t)A, lb = (uint32_t)B;
+  const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  const uint64_t t = rl + (rm0 << 32), lo = t + (rm1 << 32);
+  const uint64_t c = (t < rl) + (lo < t);
+  return lo ^ (rh + (rm0 >> 32) + (rm1 >> 32) + c);
+#endif
+}
+
+/* the common part of wyhash and mi_wyhash4: set a, b and seed */
+constexpr void wyabs(const char *p, size_t len, uint64_t &seed, uint64_t &a,
+                     uint64_t &b)
+{
+  seed ^= wyp[0];
+  if (len <= 16) {
+    if (len >= 4) {
+      a = (uint64_t)le32(p) << 32 | le32(p + ((len >> 3) << 2));
+      b = (uint64_t)le32(p + len - 4) << 32 |
+          le32(p + len - 4 - ((len >> 3) << 2));
+    } else if (len > 0) {
+      a = (uint64_t)(uint8_t)p[0] << 16 | (uint64_t)(uint8_t)p[len >> 1] << 8 |
+          (uint8_t)p[len - 1];
+      b = 0;
+    } else
+      a = b = 0;
+  } else {
+    size_t i = len;
+    if (i > 48) {
+      uint64_t see1 = seed, see2 = seed;
+      do {
+        seed = wymix(le64(p) ^ wyp[1], le64(p + 8) ^ seed);
+        see1 = wymix(le64(p + 16) ^ wyp[2], le64(p + 24) ^ see1);
+        see2 = wymix(le64(p + 32) ^ wyp[3], le64(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = wymix(le64(p) ^ wyp[1], le64(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = le64(p + i - 16);
+    b = le64(p + i - 8);
+  }
+}
+
+/* mi_wyhash2 */
+constexpr hashes wyhash2(const char *key, size_t len, uint64_t seed)
+{
+  uint64_t a = 0, b = 0;
+  wyabs(key, len, seed, a, b);
+  return split64(wymix(wyp[1] ^ len, wymix(a ^ wyp[1], b ^ seed)));
+}
+
+/* mi_wyhash4 */
+constexpr hashes wyhash4(const char *key, size_t len, uint64_t seed)
+{
+  uint64_t a = 0, b = 0;
+  wyabs(key, len, seed, a, b);
+  return split64(wymix(wyp[1] ^ len, wymix(a ^ wyp[1], b ^ seed)),
+                 wymix(b ^ wyp[1], a ^ seed));
+}
+
+/* fnv3.h */
+constexpr hashes fnv(const char *key, size_t len, uint64_t seed)
+{
+  uint64_t h = seed ^ UINT64_C(0xcbf29ce484222325);
+  for (size_t i = 0; i < len; i++) {
+    h ^= (uint8_t)key[i];
+    h *= UINT64_C(0x100000001b3);
+  }
+  return split64(h);
+}
+
+constexpr hashes fnv3(const char *key, size_t len, uint64_t seed)
+{
+  uint64_t h0 = seed ^ UINT64_C(0xcbf29ce484222325);
+  uint64_t h1 = seed ^ UINT64_C(0xc4ceb9fe1a85ec53);
+  for (size_t i = 0; i < len; i++) {
+    h0 ^= (uint8_t)key[i];
+    h0 *= UINT64_C(0x100000001b3);
+    h1 ^= (uint8_t)key[i];
+    h1 *= UINT64_C(0x100000001b3);
+  }
+  return split64(h0, h1);
+}
+
+constexpr hashes fnv32_2(const char *key, size_t len, uint32_t seed0,
+                         uint32_t seed1)
+{
+  uint32_t h0 = seed0 ^ 0x811c9dc5, h1 = seed1 ^ 0x811c9dc5;
+  for (size_t i = 0; i < len; i++) {
+    h0 = (h0 ^ (uint8_t)key[i]) * 0x1000193;
+    h1 = (h1 ^ (uint8_t)key[i]) * 0x1000193;
+  }
+  return {{ h0, h1, 0, 0 }};
+}
+
+/* fnv16.h, both 16bit hashes in the first word */
+constexpr hashes fnv16_2(const char *key, size_t len, uint16_t seed0,
+                         uint16_t seed1)
+{
+  uint16_t h0 = seed0 ^ 0x811c, h1 = seed1 ^ 0x9dc5;
+  for (size_t i = 0; i < len; i++) {
+    h0 = (uint16_t)((h0 ^ (uint8_t)key[i]) * 0x1003u);
+    h1 = (uint16_t)((h1 ^ (uint8_t)key[i]) * 0x1193u);
+  }
+  return {{ (uint32_t)h0 | (uint32_t)h1 << 16, 0, 0, 0 }};
+}
+
+/* the _inthash, _inthash2 and _inthash4 functions of the C output */
+constexpr hashes inthash(int32_t key, uint32_t seed0, uint32_t seed1)
+{
+  return split64((uint64_t)(int64_t)key *
+                     (UINT64_C(0x9DDFEA08EB382D69) + seed0) + seed1);
+}
+
+constexpr hashes inthash2(int32_t key, uint32_t seed0, uint32_t seed1)
+{
+  return {{ (uint32_t)key * (UINT32_C(0xEB382D69) + seed0) + seed1, 0, 0, 0 }};
+}
+
+constexpr hashes inthash4(int32_t key, uint32_t seed0, uint32_t seed1)
+{
+  return split64((uint64_t)(int64_t)key *
+                     (UINT64_C(0x9DDFEA08EB382D69) + seed0) + seed1,
+                 (uint64_t)(int64_t)key * seed0 + seed1);
+}
+
+} // namespace nbperf
+
+#endif
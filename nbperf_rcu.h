@@ -0,0 +1,148 @@
+/*
+ * Run-time hot-swap of generated nbperf lookups with lock-free readers.
+ *
+ * A service which regenerates its set compiles the nbperf output of the
+ * new keys into a shared object, e.g. with -e so the tables are in its
+ * rodata, loads it and publishes a struct nbperf_rcu_table with its NAME
+ * function.  Readers register once per thread and call nbperf_rcu_lookup,
+ * which only stores the current epoch into their own cache line: no lock
+ * and no shared refcount on the hot path.
+ * nbperf_rcu_swap publishes the new table, advances the epoch and waits
+ * until no reader is still inside an older epoch.  It then returns the
+ * old table, whose object can be unloaded.
+ * A reader, e.g. of an exiting thread, is removed with
+ * nbperf_rcu_unregister before its memory is reused.  The writers and the
+ * changes of the reader list are serialized by a spin lock, which is never
+ * taken on the read side.  Requires C11 atomics.
+ *
+ * The lookups return NBPERF_RCU_RESULT, uint32_t unless defined before.
+ * Note that sets up to 65534 keys return uint16_t, and -L or sets of 2^32
+ * keys uint64_t.
+ */
+#ifndef NBPERF_RCU_H
+#define NBPERF_RCU_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include <sched.h>
+
+#ifndef NBPERF_RCU_RESULT
+#define NBPERF_RCU_RESULT uint32_t
+#endif
+
+/* a generated lookup and what the caller needs to release it */
+struct nbperf_rcu_table {
+	NBPERF_RCU_RESULT (*hash)(const void *key, size_t keylen);
+	void *handle;		/* e.g. of dlopen */
+};
+
+/* a cache line each, also in arrays */
+struct nbperf_rcu_reader {
+	_Alignas(64) _Atomic uint64_t epoch; /* 0 outside of a lookup */
+	struct nbperf_rcu_reader *next;
+};
+
+struct nbperf_rcu {
+	_Atomic(const struct nbperf_rcu_table *) table;
+	_Atomic uint64_t epoch;
+	struct nbperf_rcu_reader *readers; /* under lock */
+	atomic_flag lock;
+};
+
+static inline void
+nbperf_rcu_init(struct nbperf_rcu *rcu, const struct nbperf_rcu_table *table)
+{
+	atomic_init(&rcu->table, table);
+	atomic_init(&rcu->epoch, 1);
+	rcu->readers = NULL;
+	atomic_flag_clear(&rcu->lock);
+}
+
+static inline void
+nbperf_rcu_lock(struct nbperf_rcu *rcu)
+{
+	while (atomic_flag_test_and_set_explicit(&rcu->lock,
+	    memory_order_acquire))
+		sched_yield();
+}
+
+static inline void
+nbperf_rcu_unlock(struct nbperf_rcu *rcu)
+{
+	atomic_flag_clear_explicit(&rcu->lock, memory_order_release);
+}
+
+/* Once per reader thread, before its first lookup. */
+static inline void
+nbperf_rcu_register(struct nbperf_rcu *rcu, struct nbperf_rcu_reader *r)
+{
+	atomic_init(&r->epoch, 0);
+	nbperf_rcu_lock(rcu);
+	r->next = rcu->readers;
+	rcu->readers = r;
+	nbperf_rcu_unlock(rcu);
+}
+
+/* Outside of a read section.  Afterwards r can be freed. */
+static inline void
+nbperf_rcu_unregister(struct nbperf_rcu *rcu, struct nbperf_rcu_reader *r)
+{
+	struct nbperf_rcu_reader **p;
+
+	nbperf_rcu_lock(rcu);
+	for (p = &rcu->readers; *p; p = &(*p)->next)
+		if (*p == r) {
+			*p = r->next;
+			break;
+		}
+	nbperf_rcu_unlock(rcu);
+}
+
+/* The current table, valid until nbperf_rcu_leave. */
+static inline const struct nbperf_rcu_table *
+nbperf_rcu_enter(struct nbperf_rcu *rcu, struct nbperf_rcu_reader *r)
+{
+	/* seq_cst: the epoch store must be visible before the table load */
+	atomic_store(&r->epoch,
+	    atomic_load_explicit(&rcu->epoch, memory_order_acquire));
+	return atomic_load(&rcu->table);
+}
+
+static inline void
+nbperf_rcu_leave(struct nbperf_rcu_reader *r)
+{
+	atomic_store_explicit(&r->epoch, 0, memory_order_release);
+}
+
+/* NAME(key, keylen) of the current table. */
+static inline NBPERF_RCU_RESULT
+nbperf_rcu_lookup(struct nbperf_rcu *rcu, struct nbperf_rcu_reader *r,
+    const void *key, size_t keylen)
+{
+	const struct nbperf_rcu_table *t = nbperf_rcu_enter(rcu, r);
+	const NBPERF_RCU_RESULT h = (*t->hash)(key, keylen);
+
+	nbperf_rcu_leave(r);
+	return h;
+}
+
+/* Publish table, wait for the old readers, and return the old table. */
+static inline const struct nbperf_rcu_table *
+nbperf_rcu_swap(struct nbperf_rcu *rcu, const struct nbperf_rcu_table *table)
+{
+	const struct nbperf_rcu_table *old;
+	struct nbperf_rcu_reader *r;
+	uint64_t epoch, e;
+
+	nbperf_rcu_lock(rcu);
+	old = atomic_exchange(&rcu->table, table);
+	epoch = atomic_fetch_add(&rcu->epoch, 1) + 1;
+	for (r = rcu->readers; r; r = r->next)
+		while ((e = atomic_load(&r->epoch)) != 0 && e < epoch)
+			sched_yield();
+	nbperf_rcu_unlock(rcu);
+	return old;
+}
+
+#endif
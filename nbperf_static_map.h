@@ -0,0 +1,229 @@
+/*
+ * A minimal perfect hash of a constant set of string keys, built by the
+ * C++ compiler instead of by nbperf:
+ *
+ *   static constexpr std::string_view kw[] = { "if", "else", "while" };
+ *   static constexpr auto kwmap = nbperf::make_static_map(kw);
+ *   static_assert(kwmap("else") == 1);
+ *
+ * The lookup returns the index of the key in the set, or (uint32_t)-1 if
+ * it is not one of the keys. Only the g table, the seed and the key views
+ * are stored, which end up in .rodata.
+ *
+ * The builder is the chm algorithm of nbperf-chm.c and graph2.c with hash
+ * fudging, as nbperf -a chm -f -p with mi_vector_hash: the seeds 0, 1, 2,
+ * ... are tried until the graph is acyclic. Each try takes some 100 steps
+ * per key, so a few thousand keys need a higher -fconstexpr-steps with
+ * clang, or -fconstexpr-ops-limit with gcc. Duplicate keys, or no acyclic
+ * graph after 1000 tries, fail the constant evaluation in
+ * static_map_failed(). Requires C++17, with C++20 the builder is consteval.
+ */
+#ifndef NBPERF_STATIC_MAP_H
+#define NBPERF_STATIC_MAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <array>
+#include <string_view>
+#include <type_traits>
+
+#include "nbperf_constexpr.h"
+
+#if defined __cpp_consteval && __cpp_consteval >= 201811L
+#define NBPERF_CONSTEVAL consteval
+#else
+#define NBPERF_CONSTEVAL constexpr
+#endif
+
+namespace nbperf {
+
+template <size_t N>
+struct static_map {
+  static_assert(N > 0 && N < UINT32_MAX / 4, "invalid number of keys");
+
+  /* v = 2n + 1 as with nbperf -a chm, plus one as reserve for fudging */
+  static constexpr uint32_t v = 2 * N + 1;
+  static constexpr uint32_t va = (v + 1) | 1;
+  /* g[i] < n */
+  typedef std::conditional_t<(N <= 256), uint8_t,
+          std::conditional_t<(N <= 65536), uint16_t, uint32_t>> g_type;
+
+  std::array<std::string_view, N> keys;
+  std::array<g_type, va> g;
+  uint32_t seed;
+
+  /* the two vertices of a key */
+  static constexpr std::array<uint32_t, 2> vertices(std::string_view key,
+                                                    uint32_t seed)
+  {
+    const hashes h = mi_vector_hash(key.data(), key.size(), seed);
+    const uint32_t v0 = h[0] % v;
+    const uint32_t v1 = h[1] % v;
+    return {{ v0, v1 ^ (v0 == v1) }};
+  }
+
+  constexpr uint32_t operator()(std::string_view key) const
+  {
+    const std::array<uint32_t, 2> e = vertices(key, seed);
+    const uint32_t i = (g[e[0]] + g[e[1]]) % N;
+    return keys[i] == key ? i : (uint32_t)-1;
+  }
+
+  static constexpr size_t size() { return N; }
+};
+
+/* not constexpr, so that calling it stops the constant evaluation */
+inline void static_map_failed(const char *) {}
+
+namespace detail {
+
+struct vertex {
+  uint32_t edges; /* xor of the edges of the vertex */
+  uint32_t degree;
+};
+
+template <size_t N>
+struct graph {
+  typedef static_map<N> map;
+
+  std::array<std::array<uint32_t, 2>, N> edges{};
+  std::array<vertex, map::va> verts{};
+  std::array<uint32_t, N> output_order{};
+  size_t output_index = N;
+
+  constexpr void remove_vertex(uint32_t i)
+  {
+    if (verts[i].degree != 1)
+      return;
+    const uint32_t e = verts[i].edges;
+    output_order[--output_index] = e;
+    for (uint32_t j : edges[e]) {
+      verts[j].edges ^= e;
+      --verts[j].degree;
+    }
+  }
+
+  /* graph2_output_order */
+  constexpr bool peel()
+  {
+    for (uint32_t i = 0; i < map::v; ++i)
+      remove_vertex(i);
+    for (size_t i = N; output_index > 0 && i > output_index;) {
+      const std::array<uint32_t, 2> e = edges[output_order[--i]];
+      remove_vertex(e[0]);
+      remove_vertex(e[1]);
+    }
+    return output_index == 0;
+  }
+};
+
+/* std::swap is constexpr only with C++20 */
+template <typename T>
+constexpr void swap(T &a, T &b)
+{
+  T t = a;
+  a = b;
+  b = t;
+}
+
+/* duplicate keys have the same edge; sort the edges and compare them */
+template <size_t N>
+constexpr bool has_duplicates(const std::array<std::string_view, N> &keys,
+                              const graph<N> &gr)
+{
+  std::array<uint64_t, N> e{};
+  std::array<uint32_t, N> idx{};
+
+  for (size_t i = 0; i < N; ++i) {
+    const uint64_t a = gr.edges[i][0], b = gr.edges[i][1];
+    e[i] = a < b ? a << 32 | b : b << 32 | a;
+    idx[i] = (uint32_t)i;
+  }
+  /* heapsort */
+  for (size_t n = N, root = N / 2;;) {
+    if (root > 0)
+      --root;
+    else if (--n > 0) {
+      detail::swap(e[0], e[n]);
+      detail::swap(idx[0], idx[n]);
+    } else
+      break;
+    for (size_t p = root; 2 * p + 1 < n;) {
+      size_t c = 2 * p + 1;
+      if (c + 1 < n && e[c + 1] > e[c])
+        ++c;
+      if (e[p] >= e[c])
+        break;
+      detail::swap(e[p], e[c]);
+      detail::swap(idx[p], idx[c]);
+      p = c;
+    }
+  }
+  for (size_t i = 1; i < N; ++i)
+    for (size_t j = i; j-- > 0 && e[j] == e[i];)
+      if (keys[idx[i]] == keys[idx[j]])
+        return true;
+  return false;
+}
+
+} // namespace detail
+
+template <size_t N>
+NBPERF_CONSTEVAL static_map<N>
+make_static_map(const std::array<std::string_view, N> &keys)
+{
+  typedef static_map<N> map;
+  map m{};
+
+  m.keys = keys;
+  for (uint32_t seed = 0; seed < 1000; ++seed) {
+    detail::graph<N> gr{};
+
+    for (size_t i = 0; i < N; ++i) {
+      gr.edges[i] = map::vertices(keys[i], seed);
+      for (uint32_t j : gr.edges[i]) {
+        gr.verts[j].edges ^= (uint32_t)i;
+        ++gr.verts[j].degree;
+      }
+    }
+    if (!gr.peel()) {
+      if (seed == 0 && detail::has_duplicates(keys, gr)) {
+        static_map_failed("duplicate keys");
+        return m;
+      }
+      continue;
+    }
+    /* assign_nodes: g[v0] = e - g[v1] mod n, at an unvisited v0 */
+    std::array<bool, map::va> visited{};
+    std::array<uint32_t, map::va> g{};
+    for (uint32_t e : gr.output_order) {
+      uint32_t v0 = gr.edges[e][0], v1 = gr.edges[e][1];
+      if (visited[v0]) {
+        v0 = gr.edges[e][1];
+        v1 = gr.edges[e][0];
+      }
+      g[v0] = (e + N - g[v1]) % N;
+      visited[v0] = visited[v1] = true;
+    }
+    for (size_t i = 0; i < map::va; ++i)
+      m.g[i] = (typename map::g_type)g[i];
+    m.seed = seed;
+    return m;
+  }
+  static_map_failed("iteration count reached");
+  return m;
+}
+
+template <size_t N>
+NBPERF_CONSTEVAL static_map<N>
+make_static_map(const std::string_view (&keys)[N])
+{
+  std::array<std::string_view, N> a{};
+  for (size_t i = 0; i < N; ++i)
+    a[i] = keys[i];
+  return make_static_map(a);
+}
+
+} // namespace nbperf
+
+#endif
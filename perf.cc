@@ -30,6 +30,9 @@ vector<string> options = {
 	"-a chm -h crc -p",
 	"-a chm3 -h crc -p",
 	"-a bpz -h crc -p",
+	"-a chm -h aeshash -p",
+	"-a chm3 -h aeshash -p",
+	"-a bpz -h aeshash -p",
 	"-I -p",
 	"-I -a chm3 -p",
 	"-I -a bdz -p",
@@ -256,7 +259,7 @@ int main (int argc, char **argv)
          if (is_bdz && isword)
              defines += "-Dbdz ";
 #if defined __amd64__ || defined __x86_64__
-         if (hash == "crc")
+         if (hash == "crc" || hash == "aeshash")
              defines += "-march=native";
 #endif
          ret = compile_result (needs_mi_vector, defines.c_str());
@@ -284,7 +287,7 @@ int main (int argc, char **argv)
      {
        const uint32_t size = sizes[i];
        for (auto alg: {"chm", "chm3", "bdz"}) {
-           for (auto hash: {"", "wyhash", "fnv", "crc"}) {
+           for (auto hash: {"", "wyhash", "fnv", "crc", "aeshash"}) {
                set_names (alg, hash, size, true);
                cleanup_files ();
            }
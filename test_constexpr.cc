@@ -0,0 +1,29 @@
+// test the constexpr lookup of nbperf -C -d -n words,
+// from _test_Cchm.hh, at compile-time and with test_main.c at run-time
+#include <stdint.h>
+#include <stddef.h>
+#include "_test_Cchm.hh"
+
+static_assert(words(words_keys[0]) == 0, "first key");
+static_assert(words(words_keys[7]) == 7, "constant key");
+static_assert(words("\001 not a key") == (decltype(words(""))) - 1, "miss");
+
+// a constant key is a case label
+static int
+is_key7(const char *key, size_t keylen)
+{
+    switch (words(key, keylen)) {
+    case words(words_keys[7]):
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+extern "C" uint32_t hash(const void *key, size_t keylen)
+{
+    const char *k = static_cast<const char *>(key);
+    if (is_key7(k, keylen) != (words(k, keylen) == 7))
+        return (uint32_t)-1;
+    return words(k, keylen);
+}
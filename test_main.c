@@ -6,12 +6,47 @@
 #include <assert.h>
 #include <errno.h>
 
-#ifdef _INTKEYS
-uint32_t inthash(const uint32_t key);
+#ifdef _INTKEYS64 // -L
+#define _INTKEYS
+typedef uint64_t intkey_t;
+#define INTKEY(s) strtoull(s, NULL, 0)
+#elif defined _INTKEYS
+typedef int32_t intkey_t;
+#define INTKEY(s) (int32_t)strtoll(s, NULL, 0)
+#endif
+#ifdef _FIXED16 // -B 16
+uint32_t hash(const uint8_t key[16]);
+#elif defined _FIELDS // -B u64,u32
+uint32_t hash(const uint64_t a, const uint32_t b);
+#elif defined _PREHASHED // -H 128
+uint32_t hash(const uint64_t h_lo, const uint64_t h_hi);
+#elif defined _INTKEYS
+uint32_t inthash(const intkey_t key);
 #else
 uint32_t hash(const void * __restrict key, size_t keylen);
 #endif
 #define PERF_ROUNDS  100000
+// as assert(), but also with -DNDEBUG
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#ifdef _BATCH
+void hash_batch(const void * __restrict const *keys, const size_t *keylens,
+                uint32_t *out, size_t n);
+#endif
+#ifdef _X8
+void inthash_x8(const int32_t *keys, uint32_t *out, size_t n);
+#endif
+#ifdef _OVERFLOW
+uint32_t hash_insert(const void * __restrict key, size_t keylen);
+extern void (*hash_rebuild_hook)(uint32_t count);
+static uint32_t rebuild_count, rebuild_calls;
+static void rebuild(uint32_t count) { rebuild_count = count; rebuild_calls++; }
+#endif
 
 int main(int argc, char **argv)
 {
@@ -26,7 +61,7 @@ int main(int argc, char **argv)
 #if defined bdz && !defined _NOMAP
     uint32_t *map;
 #elif defined _INTKEYS
-    int32_t *map;
+    intkey_t *map;
 #endif
 
     if (argc > 1 && strcmp(argv[i], "-v") == 0)
@@ -42,7 +77,17 @@ int main(int argc, char **argv)
     } else
         strcpy(mapfile, "_words.map");
 #endif
-#ifndef PERF
+#ifdef _FIXED16
+    uint8_t fk[16];
+    memset(fk, 0xff, sizeof(fk));
+    h = hash(fk);
+    if (verbose)
+        printf("%s: %d\n", "ff..ff", h);
+#elif defined _FIELDS || defined _PREHASHED
+    h = hash(0, 0);
+    if (verbose)
+        printf("%s: %d\n", "0 0", h);
+#elif !defined PERF
 # ifdef _INTKEYS
     h = inthash(1);
     if (verbose)
@@ -77,7 +122,8 @@ int main(int argc, char **argv)
     fclose(f);
 #elif defined _INTKEYS
     size_t lines = 1000;
-    map = calloc (lines, 4);
+    char buf[32];
+    map = calloc (lines, sizeof(*map));
     i = 0;
     // read input file for the indices
     f = fopen(input, "r");
@@ -85,13 +131,13 @@ int main(int argc, char **argv)
 	perror("fopen input");
 	exit(1);
     }
-    errno = 0;
-    while (1 == fscanf(f, "%d\n", &map[i]) && !errno) {
+    while (fgets(buf, sizeof(buf), f)) {
+        map[i] = INTKEY(buf);
         i++;
         if (i >= lines) {
             fprintf(stderr, "more than %lu lines in %s\n", lines, input);
             lines *= 2;
-            map = realloc (map, lines * 4);
+            map = realloc (map, lines * sizeof(*map));
         }
     }
     fclose(f);
@@ -110,13 +156,36 @@ int main(int argc, char **argv)
 	    line[line_len] = '\0';
 	}
 #ifdef _INTKEYS
-        int32_t l = atoi(line);
+        intkey_t l = INTKEY(line);
+#elif defined _FIXED16
+        // the hex digits of a UUID
+        uint8_t fk[16];
+        for (unsigned j = 0, k = 0; j < 16 && line[k]; k += 2) {
+            if (line[k] == '-')
+                k++;
+            sscanf(line + k, "%2hhx", &fk[j++]);
+        }
+#elif defined _FIELDS
+        char *e;
+        const uint64_t fa = strtoull(line, &e, 0);
+        const uint32_t fb = (uint32_t)strtoul(e, NULL, 0);
+#elif defined _PREHASHED
+        // 32 hex digits, the high half first
+        char hi[17];
+        memcpy(hi, line, 16);
+        hi[16] = '\0';
+        const uint64_t fa = strtoull(line + 16, NULL, 16);
+        const uint64_t fb = strtoull(hi, NULL, 16);
 #endif
 #ifdef PERF
         for (int j=0; j < PERF_ROUNDS; j++) {
 #endif
 #ifdef _INTKEYS
             h = inthash(l);
+#elif defined _FIXED16
+            h = hash(fk);
+#elif defined _FIELDS || defined _PREHASHED
+            h = hash(fa, fb);
 #else
             h = hash(line, strlen(line));
 #endif
@@ -130,18 +199,57 @@ int main(int argc, char **argv)
         printf("%s[%u]: %d\n", line, i, h);
 #endif
 
+#ifdef _BATCH
+        {
+            // all keys of a file at once, compared to the single lookups
+            static const char **bkeys;
+            static size_t *blens, balloc;
+            static uint32_t *bout, *bh;
+            if (i >= balloc) {
+                balloc = balloc ? balloc * 2 : 1024;
+                bkeys = realloc(bkeys, balloc * sizeof(*bkeys));
+                blens = realloc(blens, balloc * sizeof(*blens));
+                bout = realloc(bout, balloc * sizeof(*bout));
+                bh = realloc(bh, balloc * sizeof(*bh));
+            }
+            bkeys[i] = strdup(line);
+            blens[i] = line_len;
+            bh[i] = h;
+            if (feof(f) || (ungetc(getc(f), f) == EOF)) {
+                hash_batch((const void **)bkeys, blens, bout, i + 1);
+                unsigned errors = 0;
+                for (unsigned k = 0; k <= i; k++) {
+                    if (bout[k] != bh[k]) {
+                        printf("batch %s[%u]: %u != %u\n", bkeys[k], k,
+                               bout[k], bh[k]);
+                        errors++;
+                    }
+                    free((void *)bkeys[k]);
+                }
+                free(bkeys); free(blens); free(bout); free(bh);
+                if (errors)
+                    exit(1);
+            }
+        }
+#endif
 #ifndef PERF
-# if (defined chm || defined chm3 || defined _NOMAP) && !defined _INTKEYS
+# if (defined chm || defined chm3 || defined monotone || defined _NOMAP) && !defined _INTKEYS
 	if (h != i && verbose)
             printf("%s[%u]: %d != %d\n", line, i, i, h);
-        assert(h == i);
+        CHECK(h == i);
 #else
 #if defined _INTKEYS && !defined bdz
-	if (l != map[h] && verbose)
-            printf("%s[%u]: %d != %d (%d)\n", line, i, l, map[h], h);
-	assert(l == map[h]);
+	if (h >= lines || l != map[h]) {
+            printf("%s[%u]: %lld != %lld (%d)\n", line, i, (long long)l,
+                   h < lines ? (long long)map[h] : 0LL, h);
+            exit(1);
+        }
+#elif defined _NONMINIMAL // bdz -P
+	if (map[i] != h && verbose)
+            printf("%s[%u]: %u != %u\n", line, i, map[i], h);
+	CHECK(map[i] == h);
 #else // bdz
-	if (map[h] != i && verbose)
+	if (verbose && h != (uint32_t)-1 && map[h] != i)
             printf("%s[%u]: %d != %u (%d)\n", line, i, i, map[h], h);
 	//assert(map[h] == i); // GH #15
 #endif
@@ -150,6 +258,60 @@ int main(int argc, char **argv)
 	i++;
     }
     free(line);
+#ifdef _X8
+    {
+        // the vectorized lookup of all keys and of some others, compared
+        // to the single lookups
+        const unsigned xn = i + 17;
+        int32_t *xkeys = calloc(xn, sizeof(*xkeys));
+        uint32_t *xout = calloc(xn, sizeof(*xout));
+        unsigned errors = 0;
+        for (unsigned k = 0; k < xn; k++)
+            xkeys[k] = k < i ? (int32_t)map[k] : (int32_t)(k * 0x9E3779B1U);
+        inthash_x8(xkeys, xout, xn);
+        for (unsigned k = 0; k < xn; k++) {
+            const uint32_t r = inthash(xkeys[k]);
+            // small sets miss with a uint16_t -1, NAME_x8 with a uint32_t
+            if (xout[k] != r &&
+                (xout[k] != (uint32_t)-1 || (uint16_t)r != (uint16_t)-1)) {
+                printf("x8 %d[%u]: %u != %u\n", xkeys[k], k, xout[k], r);
+                errors++;
+            }
+        }
+        free(xkeys);
+        free(xout);
+        if (errors)
+            exit(1);
+    }
+#endif
+#ifdef _OVERFLOW
+    {
+        // add 8 new keys at run-time, the overflow table has 8 slots
+        static char added[8][16];
+        const uint32_t n = i;
+        hash_rebuild_hook = rebuild;
+        for (unsigned j = 0; j < 8; j++) {
+            snprintf(added[j], sizeof(added[j]), "_overflow%u", j);
+            CHECK(hash(added[j], strlen(added[j])) == (uint32_t)-1);
+            h = hash_insert(added[j], strlen(added[j]));
+            CHECK(h >= n && h < n + 8);
+            CHECK(hash(added[j], strlen(added[j])) == h);
+            CHECK(hash_insert(added[j], strlen(added[j])) == h);
+        }
+        // once, at 3/4 full
+        CHECK(rebuild_calls == 1 && rebuild_count == 6);
+        CHECK(hash_insert("_overflow8", 10) == (uint32_t)-1);
+    }
+#endif
+#ifdef _MISSES
+    // -d: keys of other lengths are rejected, also without a NUL.
+    // small sets return a uint16_t
+#define MISS(key, keylen) ((uint16_t)hash(key, keylen) == (uint16_t)-1)
+    CHECK(MISS("", 0));
+    CHECK(MISS("\001", 1));
+    CHECK(MISS("\001 not a key, longer than the keys", 36));
+    CHECK(MISS("\001 not a key", 5));
+#endif
 #if defined _INTKEYS || (defined bdz && !defined _NOMAP)
     free(map);
 #endif
@@ -0,0 +1,122 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#undef NDEBUG
+#include <assert.h>
+// the generated lookups of small sets return uint16_t
+#define NBPERF_RCU_RESULT uint16_t
+#include "nbperf_rcu.h"
+
+// readers look up the keys of the current table and check that it is
+// never freed under them, the churn threads register and unregister
+// readers on their stack meanwhile.  The two tables are the -d lookups
+// of _words64 and _words1000, as rcu_a and rcu_b.
+#define NREADERS 4
+#define NCHURN   2
+#define NSWAPS   200
+
+uint16_t rcu_a(const void *key, size_t keylen);
+uint16_t rcu_b(const void *key, size_t keylen);
+extern const char * const rcu_a_keys[64];
+extern const char * const rcu_b_keys[1000];
+
+struct set {
+    const char * const *keys;
+    size_t n;
+};
+static const struct set set_a = { rcu_a_keys, 64 };
+static const struct set set_b = { rcu_b_keys, 1000 };
+
+static struct nbperf_rcu rcu;
+static struct nbperf_rcu_reader readers[NREADERS];
+static _Atomic int done, started;
+
+static uint16_t poisoned(const void *key, size_t keylen)
+{
+    (void)key; (void)keylen;
+    fprintf(stderr, "rcu: lookup in a freed table\n");
+    abort();
+}
+
+// one key of the current table, which must map to its index
+static void lookup(struct nbperf_rcu_reader *r, size_t i)
+{
+    const struct nbperf_rcu_table *t = nbperf_rcu_enter(&rcu, r);
+    const struct set *s = t->handle;
+    const char *key = s->keys[i % s->n];
+    assert((*t->hash)(key, strlen(key)) == i % s->n);
+    nbperf_rcu_leave(r);
+}
+
+static void *reader(void *arg)
+{
+    struct nbperf_rcu_reader *r = arg;
+    unsigned long lookups = 0;
+    nbperf_rcu_register(&rcu, r);
+    atomic_fetch_add(&started, 1);
+    while (!atomic_load(&done))
+        lookup(r, lookups++);
+    // and the typed lookup, a non-key of both sets
+    assert(nbperf_rcu_lookup(&rcu, r, "-", 1) == (uint16_t)-1);
+    return (void *)lookups;
+}
+
+static void *churn(void *arg)
+{
+    unsigned long rounds = 0;
+    (void)arg;
+    while (!atomic_load(&done)) {
+        struct nbperf_rcu_reader r;
+        nbperf_rcu_register(&rcu, &r);
+        lookup(&r, rounds);
+        nbperf_rcu_unregister(&rcu, &r);
+        // a swap still walking to r would notice
+        memset(&r, 0xff, sizeof(r));
+        rounds++;
+    }
+    return (void *)rounds;
+}
+
+static struct nbperf_rcu_table *new_table(uint32_t i)
+{
+    struct nbperf_rcu_table *t = malloc(sizeof(*t));
+    t->hash = i & 1 ? rcu_b : rcu_a;
+    t->handle = (void *)(i & 1 ? &set_b : &set_a);
+    return t;
+}
+
+int main(void)
+{
+    pthread_t th[NREADERS], ch[NCHURN];
+    assert(sizeof(readers[0]) == 64 && (uintptr_t)&readers[1] % 64 == 0);
+    nbperf_rcu_init(&rcu, new_table(0));
+    for (int i = 0; i < NREADERS; i++)
+        pthread_create(&th[i], NULL, reader, &readers[i]);
+    for (int i = 0; i < NCHURN; i++)
+        pthread_create(&ch[i], NULL, churn, NULL);
+    while (atomic_load(&started) < NREADERS)
+        sched_yield();
+    for (uint32_t i = 1; i <= NSWAPS; i++) {
+        struct nbperf_rcu_table *old =
+            (struct nbperf_rcu_table *)nbperf_rcu_swap(&rcu, new_table(i));
+        // poison before free, a reader still using it would notice
+        old->hash = poisoned;
+        old->handle = NULL;
+        free(old);
+    }
+    atomic_store(&done, 1);
+    for (int i = 0; i < NREADERS; i++)
+        pthread_join(th[i], NULL);
+    for (int i = 0; i < NCHURN; i++)
+        pthread_join(ch[i], NULL);
+    // only the readers are left registered
+    int left = 0;
+    for (struct nbperf_rcu_reader *r = rcu.readers; r; r = r->next, left++)
+        assert(r >= readers && r < readers + NREADERS);
+    assert(left == NREADERS);
+    free((void *)nbperf_rcu_swap(&rcu, NULL));
+    printf("rcu: %d swaps ok\n", NSWAPS);
+    return 0;
+}
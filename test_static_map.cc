@@ -0,0 +1,78 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string_view>
+#undef NDEBUG
+#include <assert.h>
+#include "nbperf_static_map.h"
+
+// the C keywords, and a bigger set of 2000 keys made at compile-time
+static constexpr std::string_view keywords[] = {
+    "auto", "break", "case", "char", "const", "continue", "default", "do",
+    "double", "else", "enum", "extern", "float", "for", "goto", "if",
+    "inline", "int", "long", "register", "restrict", "return", "short",
+    "signed", "sizeof", "static", "struct", "switch", "typedef", "union",
+    "unsigned", "void", "volatile", "while", "_Bool", "_Complex",
+    "_Imaginary",
+};
+static constexpr auto kwmap = nbperf::make_static_map(keywords);
+
+static_assert(kwmap("auto") == 0, "first key");
+static_assert(kwmap("while") == 33, "key");
+static_assert(kwmap("_Imaginary") == 36, "last key");
+static_assert(kwmap("whilst") == (uint32_t)-1, "miss");
+static_assert(kwmap("") == (uint32_t)-1, "empty miss");
+
+#define NKEYS 2000
+struct numbers {
+    char buf[NKEYS][12];
+    size_t len[NKEYS];
+};
+static constexpr numbers
+make_numbers()
+{
+    numbers n{};
+    for (size_t i = 0; i < NKEYS; i++) {
+        size_t k = i * 7919 + 13, l = 0;
+        n.buf[i][l++] = 'k';
+        do
+            n.buf[i][l++] = (char)('0' + k % 10);
+        while (k /= 10);
+        n.len[i] = l;
+    }
+    return n;
+}
+static constexpr numbers nums = make_numbers();
+static constexpr std::array<std::string_view, NKEYS>
+make_views()
+{
+    std::array<std::string_view, NKEYS> a{};
+    for (size_t i = 0; i < NKEYS; i++)
+        a[i] = std::string_view(nums.buf[i], nums.len[i]);
+    return a;
+}
+static constexpr std::array<std::string_view, NKEYS> views = make_views();
+static constexpr auto nummap = nbperf::make_static_map(views);
+
+static_assert(nummap(views[1234]) == 1234, "key");
+static_assert(nummap("k") == (uint32_t)-1, "miss");
+
+int main(void)
+{
+    char buf[32];
+
+    for (uint32_t i = 0; i < kwmap.size(); i++) {
+        snprintf(buf, sizeof(buf), "%.*s", (int)keywords[i].size(),
+                 keywords[i].data());
+        assert(kwmap(buf) == i);
+        assert(kwmap(std::string_view(buf, keywords[i].size() - 1)) ==
+               (uint32_t)-1);
+    }
+    for (uint32_t i = 0; i < NKEYS; i++) {
+        assert(nummap(views[i]) == i);
+        snprintf(buf, sizeof(buf), "%.*s0", (int)views[i].size(),
+                 views[i].data());
+        assert(nummap(buf) == (uint32_t)-1 || views[nummap(buf)] == buf);
+    }
+    printf("seeds %u %u\n", kwmap.seed, nummap.seed);
+    return 0;
+}